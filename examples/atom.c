@@ -11,58 +11,125 @@
         - the audio beeper
         - the optional VIA 6522
         - REPT key (and some other special keys)
+
+    The actual emulator is in systems/atom.h, this is just the
+    sokol-app shell around it.
+
+    On startup, the post-boot snapshot atom.boot (written by the build) is
+    restored instead of a cold boot, '-coldboot' forces a cold boot.
 */
 #include "sokol_app.h"
 #include "sokol_time.h"
 #define CHIPS_IMPL
-#include "chips/m6502.h"
-#include "chips/mc6847.h"
-#include "chips/i8255.h"
-#include "chips/kbd.h"
-#include "chips/mem.h"
-#include "roms/atom-roms.h"
+#include "systems/atom.h"
 #include "common/gfx.h"
+#include "common/romfile.h"
+#include "common/warp.h"
+#include "common/emuthread.h"
+#include "common/bootsnap.h"
 #include <ctype.h> /* isupper, islower, toupper, tolower */
+#include <stdlib.h> /* malloc, free */
+#include <string.h> /* strcmp */
 
-/* Atom emulator state and callbacks */
-#define ATOM_FREQ (1000000)
-typedef struct {
-    m6502_t cpu;
-    mc6847_t vdg;
-    i8255_t ppi;
-    kbd_t kbd;
-    mem_t mem;
-    int counter_2_4khz;
-    int period_2_4khz;
-    bool state_2_4khz;
-    uint8_t ram[1<<16];     /* only 40 KByte used */
-} atom_t;
 atom_t atom;
-
-void atom_init(void);
-uint64_t atom_cpu_tick(uint64_t pins);
-uint64_t atom_vdg_fetch(uint64_t pins);
-uint8_t atom_ppi_in(int port_id);
-uint64_t atom_ppi_out(int port_id, uint64_t pins, uint8_t data);
-
 uint32_t overrun_ticks;
 uint64_t last_time_stamp;
+warp_t warp;
 
-/* xorshift randomness for memory initialization */
-uint32_t xorshift_state = 0x6D98302B;
-uint32_t xorshift32() {
-    uint32_t x = xorshift_state;
-    x ^= x<<13; x ^= x>>17; x ^= x<<5;
-    xorshift_state = x;
-    return x;
+/* optional ROM directory ('-roms dir' command line arg), files are memory-mapped */
+const char* rom_dir;
+romfile_t rom_abasic, rom_afloat, rom_dosrom;
+
+/* post-boot snapshot, restored on startup instead of a cold boot unless
+   '-coldboot' or '-roms dir' is given ('-boot file' overrides the path),
+   '-save-boot file' boots headless and writes it (done by the build),
+   the Atom has no audio output, so the sample rate is recorded as 0
+*/
+#define BOOT_TICKS (ATOM_FREQ * 2)
+const char* boot_path = "atom.boot";
+const char* save_boot_path;
+bool cold_boot;
+bool save_boot_snapshot(void) {
+    atom_init(&atom, &(atom_desc_t){
+        .rgba8_buffer = rgba8_buffer,
+        .rgba8_buffer_size = sizeof(rgba8_buffer)
+    });
+    atom_exec(&atom, BOOT_TICKS);
+    const uint32_t size = atom_snapshot_size();
+    uint8_t* buf = (uint8_t*) malloc(size);
+    const bool ok = (size == atom_save_snapshot(&atom, buf, size)) && bootsnap_save(save_boot_path, 0, buf, size);
+    free(buf);
+    printf("%s post-boot snapshot '%s'\n", ok ? "wrote" : "failed to write", save_boot_path);
+    return ok;
+}
+bool restore_boot_snapshot(void) {
+    uint32_t size;
+    uint8_t* buf = bootsnap_load(boot_path, 0, &size);
+    const bool ok = buf && atom_load_snapshot(&atom, buf, size);
+    if (buf && !ok) {
+        printf("post-boot snapshot '%s' doesn't match this build, cold booting\n", boot_path);
+    }
+    free(buf);
+    return ok;
 }
 
+/* optional PC-sampling profiler ('-prof' and '-labels file' command line args), reported at exit */
+pcprof_t* prof;
+pcprof_labels_t prof_labels;
+
+/* optional mode, run the emulator on its own thread ('-threaded' command line arg) */
+bool threaded;
+emu_thread_t emu_thread;
+void run_frame(double frame_time);
+void handle_input(const void* event);
+
+/* optional frame capture ('-capture file.raw' or '-capture prefix' for a PNG sequence) */
+const char* capture_path;
+
 /* sokol-app entry, configure application callbacks and window */
 void app_init(void);
 void app_frame(void);
 void app_input(const sapp_event*);
 void app_cleanup(void);
 sapp_desc sokol_main(int argc, char* argv[]) {
+    #if defined(CHIPS_WASM_THREADS)
+    /* the multithreaded web build always runs the emulator on a worker thread */
+    threaded = true;
+    #endif
+    #if !defined(__EMSCRIPTEN__)
+    for (int i = 1; i < argc; i++) {
+        if (0 == strcmp(argv[i], "-threaded")) {
+            threaded = true;
+        }
+        else if ((0 == strcmp(argv[i], "-roms")) && (i+1 < argc)) {
+            rom_dir = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "-capture")) && (i+1 < argc)) {
+            capture_path = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "-boot")) && (i+1 < argc)) {
+            boot_path = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "-save-boot")) && (i+1 < argc)) {
+            save_boot_path = argv[++i];
+        }
+        else if (0 == strcmp(argv[i], "-coldboot")) {
+            cold_boot = true;
+        }
+        else if (0 == strcmp(argv[i], "-prof")) {
+            prof = (pcprof_t*) malloc(sizeof(pcprof_t));
+            pcprof_init(prof, PCPROF_DEFAULT_INTERVAL);
+        }
+        else if ((0 == strcmp(argv[i], "-labels")) && (i+1 < argc)) {
+            if (!pcprof_load_labels(&prof_labels, argv[++i])) {
+                printf("failed to load label file '%s'\n", argv[i]);
+            }
+        }
+    }
+    if (save_boot_path) {
+        exit(save_boot_snapshot() ? 0 : 10);
+    }
+    #endif
     return (sapp_desc) {
         .init_cb = app_init,
         .frame_cb = app_frame,
@@ -77,27 +144,86 @@ sapp_desc sokol_main(int argc, char* argv[]) {
 /* one-time application init */
 void app_init(void) {
     gfx_init(MC6847_DISPLAY_WIDTH, MC6847_DISPLAY_HEIGHT);
-    atom_init();
+    if (capture_path) {
+        gfx_enable_capture(capture_path);
+    }
+    atom_init(&atom, &(atom_desc_t){
+        .rgba8_buffer = rgba8_buffer,
+        .rgba8_buffer_size = sizeof(rgba8_buffer),
+        .rom_abasic = romfile_load(&rom_abasic, rom_dir, "abasic.ic20", dump_abasic, sizeof(dump_abasic)),
+        .rom_afloat = romfile_load(&rom_afloat, rom_dir, "afloat.ic21", dump_afloat, sizeof(dump_afloat)),
+        .rom_dosrom = romfile_load(&rom_dosrom, rom_dir, "dosrom.u15", dump_dosrom, sizeof(dump_dosrom)),
+        .prof = prof
+    });
+    if (!cold_boot && !rom_dir) {
+        restore_boot_snapshot();
+    }
     last_time_stamp = stm_now();
+    if (threaded) {
+        /* run the emulator on its own thread, frames are handed over to gfx_draw() */
+        gfx_enable_frame_handoff();
+        threaded = emu_thread_start(&emu_thread, &(emu_thread_desc_t){
+            .frame_hz = 50,
+            .frame_cb = run_frame,
+            .event_cb = handle_input,
+            .event_size = sizeof(sapp_event)
+        });
+        if (!threaded) {
+            /* fall back to running the emulator in app_frame() */
+            gfx_disable_frame_handoff();
+        }
+    }
 }
 
-/* per frame stuff, tick the emulator, handle input, decode and draw emulator display */
-void app_frame(void) {
-    double frame_time = stm_sec(stm_laptime(&last_time_stamp));
-    /* skip long pauses when the app was suspended */
-    if (frame_time > 0.1) {
-        frame_time = 0.1;
-    }
+/* tick the emulator for one frame, and decode the emulator display */
+void run_frame(double frame_time) {
     uint32_t ticks_to_run = (uint32_t) ((ATOM_FREQ * frame_time) - overrun_ticks);
-    uint32_t ticks_executed = m6502_exec(&atom.cpu, ticks_to_run);
+    uint32_t ticks_executed = atom_exec(&atom, ticks_to_run);
     assert(ticks_executed >= ticks_to_run);
     overrun_ticks = ticks_executed - ticks_to_run;
     kbd_update(&atom.kbd);
+    if (threaded) {
+        gfx_publish_frame();
+    }
+}
+
+/* run one emulated frame in warp mode (the video chip always renders its output) */
+void warp_frame(bool decode) {
+    (void)decode;
+    atom_exec(&atom, ATOM_FREQ / 50);
+    kbd_update(&atom.kbd);
+}
+
+/* per frame stuff, tick the emulator, handle input, decode and draw emulator display */
+void app_frame(void) {
+    if (warp.enabled) {
+        /* run as fast as possible */
+        warp_run(&warp, warp_frame, 1.0 / 50.0);
+    }
+    else if (!threaded) {
+        double frame_time = stm_sec(stm_laptime(&last_time_stamp));
+        /* skip long pauses when the app was suspended */
+        if (frame_time > 0.1) {
+            frame_time = 0.1;
+        }
+        run_frame(frame_time);
+    }
     gfx_draw();
 }
 
-/* keyboard input handling */
+/* keyboard input handling, forwarded to the emulation thread in threaded mode */
 void app_input(const sapp_event* event) {
+    if (threaded) {
+        emu_thread_push_event(&emu_thread, event);
+    }
+    else {
+        handle_input(event);
+    }
+}
+
+/* keyboard input handling */
+void handle_input(const void* ev) {
+    const sapp_event* event = (const sapp_event*) ev;
     switch (event->type) {
         int c = 0;
         case SAPP_EVENTTYPE_CHAR:
@@ -116,6 +242,11 @@ void app_input(const sapp_event* event) {
             break;
         case SAPP_EVENTTYPE_KEY_UP:
         case SAPP_EVENTTYPE_KEY_DOWN:
+            if (!threaded && (event->key_code == SAPP_KEYCODE_END) && (event->type == SAPP_EVENTTYPE_KEY_DOWN)) {
+                /* toggle warp mode */
+                warp_enable(&warp, !warp.enabled);
+                break;
+            }
             switch (event->key_code) {
                 case SAPP_KEYCODE_ENTER:        c = 0x0D; break;
                 case SAPP_KEYCODE_RIGHT:        c = 0x09; break;
@@ -145,240 +276,16 @@ void app_input(const sapp_event* event) {
 
 /* application cleanup callback */
 void app_cleanup(void) {
-    gfx_shutdown();
-}
-
-/* Atom emulator initialization */
-void atom_init(void) {
-    /* setup memory map, first fill memory with random values */
-    for (int i = 0; i < (int)sizeof(atom.ram);) {
-        uint32_t r = xorshift32();
-        atom.ram[i++]=r>>24; atom.ram[i++]=r>>16; atom.ram[i++]=r>>8; atom.ram[i++]=r;
-    }
-    mem_init(&atom.mem);
-    /* 32 KByte RAM + 8 KByte vidmem */
-    mem_map_ram(&atom.mem, 0, 0x0000, 0xA000, atom.ram);
-    /* hole in 0xA000 to 0xAFFF for utility roms */
-    /* 0xB000 to 0xBFFF is memory-mapped IO area (not mapped to host memory) */
-    /* 0xC000 to 0xFFFF are operating system roms */
-    mem_map_rom(&atom.mem, 0, 0xC000, 0x1000, dump_abasic);
-    mem_map_rom(&atom.mem, 0, 0xD000, 0x1000, dump_afloat);
-    mem_map_rom(&atom.mem, 0, 0xE000, 0x1000, dump_dosrom);
-    mem_map_rom(&atom.mem, 0, 0xF000, 0x1000, dump_abasic+0x1000);
-
-    /*  setup the keyboard matrix
-        the Atom has a 10x8 keyboard matrix, where the
-        entire line 6 is for the Ctrl key, and the entire
-        line 7 is the Shift key
-    */
-    kbd_init(&atom.kbd, 1);
-    /* shift key is entire line 7 */
-    const int shift = (1<<0); kbd_register_modifier_line(&atom.kbd, 0, 7);
-    /* ctrl key is entire line 6 */
-    const int ctrl = (1<<1); kbd_register_modifier_line(&atom.kbd, 1, 6);
-    /* alpha-numeric keys */
-    const char* keymap = 
-        /* no shift */
-        "     ^]\\[ "/**/"3210      "/* */"-,;:987654"/**/"GFEDCBA@/."/**/"QPONMLKJIH"/**/" ZYXWVUTSR"
-        /* shift */
-        "          "/* */"#\"!       "/**/"=<+*)('&%$"/**/"gfedcba ?>"/**/"qponmlkjih"/**/" zyxwvutsr";
-    for (int layer = 0; layer < 2; layer++) {
-        for (int col = 0; col < 10; col++) {
-            for (int line = 0; line < 6; line++) {
-                int c = keymap[layer*60 + line*10 + col];
-                if (c != 0x20) {
-                    kbd_register_key(&atom.kbd, c, col, line, layer?shift:0);
-                }
-            }
-        }
-    }
-    /* special keys */
-    kbd_register_key(&atom.kbd, 0x20, 9, 0, 0);      /* space */
-    kbd_register_key(&atom.kbd, 0x01, 4, 1, 0);      /* backspace */
-    kbd_register_key(&atom.kbd, 0x08, 3, 0, shift);  /* left */
-    kbd_register_key(&atom.kbd, 0x09, 3, 0, 0);      /* right */
-    kbd_register_key(&atom.kbd, 0x0A, 2, 0, shift);  /* down */
-    kbd_register_key(&atom.kbd, 0x0B, 2, 0, 0);      /* up */
-    kbd_register_key(&atom.kbd, 0x0D, 6, 1, 0);      /* return/enter */
-    kbd_register_key(&atom.kbd, 0x1B, 0, 5, 0);      /* escape */
-    kbd_register_key(&atom.kbd, 0x0C, 5, 4, ctrl);   /* Ctrl+L, clear screen, mapped to F1 */
-
-    /* initialize chips */
-    m6502_init(&atom.cpu, &(m6502_desc_t){
-        .tick_cb = atom_cpu_tick
-    });
-    mc6847_init(&atom.vdg, &(mc6847_desc_t){
-        .tick_hz = ATOM_FREQ,
-        .rgba8_buffer = rgba8_buffer,
-        .rgba8_buffer_size = sizeof(rgba8_buffer),
-        .fetch_cb = atom_vdg_fetch
-    });
-    i8255_init(&atom.ppi, atom_ppi_in, atom_ppi_out);
-
-    /* initialize 2.4 khz counter */
-    atom.period_2_4khz = ATOM_FREQ / 2400;
-    atom.counter_2_4khz = 0;
-    atom.state_2_4khz = false;
-
-    /* reset the CPU to go into 'start state' */
-    m6502_reset(&atom.cpu);
-}
-
-/* CPU tick callback */
-uint64_t atom_cpu_tick(uint64_t pins) {
-    /* tick the video chip */
-    mc6847_tick(&atom.vdg);
-
-    /* tick the 2.4khz counter */
-    atom.counter_2_4khz++;
-    if (atom.counter_2_4khz >= atom.period_2_4khz) {
-        atom.state_2_4khz = !atom.state_2_4khz;
-        atom.counter_2_4khz -= atom.period_2_4khz;
-    }
-
-    /* decode address for memory-mapped IO and memory read/write */
-    const uint16_t addr = M6502_GET_ADDR(pins);
-    if ((addr >= 0xB000) && (addr < 0xC000)) {
-        /* memory-mapped IO area */
-        if ((addr >= 0xB000) && (addr < 0xB400)) {
-            /* i8255 PPI: http://www.acornatom.nl/sites/fpga/www.howell1964.freeserve.co.uk/acorn/atom/amb/amb_8255.htm */
-            uint64_t ppi_pins = (pins & M6502_PIN_MASK) | I8255_CS;
-            if (pins & M6502_RW) { ppi_pins |= I8255_RD; }  /* PPI read access */
-            else { ppi_pins |= I8255_WR; }                  /* PPI write access */
-            if (pins & M6502_A0) { ppi_pins |= I8255_A0; }  /* PPI has 4 addresses (port A,B,C or control word */
-            if (pins & M6502_A1) { ppi_pins |= I8255_A1; }
-            pins = i8255_iorq(&atom.ppi, ppi_pins) & M6502_PIN_MASK;
-        }
-        else {
-            /* remaining IO space is for expansion devices */
-            if (pins & M6502_RW) {
-                M6502_SET_DATA(pins, 0x00);
-            }
-        }
-    }
-    else {
-        /* memory access */
-        if (pins & M6502_RW) {
-            /* memory read */
-            M6502_SET_DATA(pins, mem_rd(&atom.mem, addr));
-        }
-        else {
-            /* memory access */
-            mem_wr(&atom.mem, addr, M6502_GET_DATA(pins));
-        }
-    }
-    return pins;
-}
-
-/* video memory fetch callback */
-uint64_t atom_vdg_fetch(uint64_t pins) {
-    const uint16_t addr = MC6847_GET_ADDR(pins);
-    uint8_t data = atom.ram[(addr + 0x8000) & 0xFFFF];
-    MC6847_SET_DATA(pins, data);
-
-    /*  the upper 2 databus bits are directly wired to MC6847 pins:
-        bit 7 -> INV pin (in text mode, invert pixel pattern)
-        bit 6 -> A/S and INT/EXT pin, A/S actives semigraphics mode
-                 and INT/EXT selects the 2x3 semigraphics pattern
-                 (so 4x4 semigraphics isn't possible)
-    */
-    if (data & (1<<7)) { pins |= MC6847_INV; }
-    else               { pins &= ~MC6847_INV; }
-    if (data & (1<<6)) { pins |= (MC6847_AS|MC6847_INTEXT); }
-    else               { pins &= ~(MC6847_AS|MC6847_INTEXT); }
-    return pins;
-}
-
-/* i8255 PPI output */
-uint64_t atom_ppi_out(int port_id, uint64_t pins, uint8_t data) {
-    /*
-        FROM Atom Theory and Praxis (and MAME)
-        The  8255  Programmable  Peripheral  Interface  Adapter  contains  three
-        8-bit ports, and all but one of these lines is used by the ATOM.
-        Port A - #B000
-               Output bits:      Function:
-                    O -- 3     Keyboard column
-                    4 -- 7     Graphics mode (4: A/G, 5..7: GM0..2)
-        Port B - #B001
-               Input bits:       Function:
-                    O -- 5     Keyboard row
-                      6        CTRL key (low when pressed)
-                      7        SHIFT keys {low when pressed)
-        Port C - #B002
-               Output bits:      Function:
-                    O          Tape output
-                    1          Enable 2.4 kHz to cassette output
-                    2          Loudspeaker
-                    3          Not used (??? see below)
-               Input bits:       Function:
-                    4          2.4 kHz input
-                    5          Cassette input
-                    6          REPT key (low when pressed)
-                    7          60 Hz sync signal (low during flyback)
-        The port C output lines, bits O to 3, may be used for user
-        applications when the cassette interface is not being used.
-    */
-    if (I8255_PORT_A == port_id) {
-        /* PPI port A
-            0..3:   keyboard matrix column to scan next
-            4:      MC6847 A/G
-            5:      MC6847 GM0
-            6:      MC6847 GM1
-            7:      MC6847 GM2
-        */
-        kbd_set_active_columns(&atom.kbd, 1<<(data & 0x0F));
-        uint64_t vdg_pins = 0;
-        uint64_t vdg_mask = MC6847_AG|MC6847_GM0|MC6847_GM1|MC6847_GM2;
-        if (data & (1<<4)) { vdg_pins |= MC6847_AG; }
-        if (data & (1<<5)) { vdg_pins |= MC6847_GM0; }
-        if (data & (1<<6)) { vdg_pins |= MC6847_GM1; }
-        if (data & (1<<7)) { vdg_pins |= MC6847_GM2; }
-        mc6847_ctrl(&atom.vdg, vdg_pins, vdg_mask);
-    }
-    else if (I8255_PORT_C == port_id) {
-        /* PPI port C output:
-            0:  output: cass 0
-            1:  output: cass 1
-            2:  output: speaker
-            3:  output: MC6847 CSS
-
-            NOTE: only the MC6847 CSS pin is emulated here
-        */
-        uint64_t vdg_pins = 0;
-        uint64_t vdg_mask = MC6847_CSS;
-        if (data & (1<<3)) {
-            vdg_pins |= MC6847_CSS;
-        }
-        mc6847_ctrl(&atom.vdg, vdg_pins, vdg_mask);
-    }
-    return pins;
-}
-
-/* i8255 PPI input callback */
-uint8_t atom_ppi_in(int port_id) {
-    uint8_t data = 0;
-    if (I8255_PORT_B == port_id) {
-        /* keyboard row state */
-        data = ~kbd_scan_lines(&atom.kbd);
+    if (threaded) {
+        emu_thread_stop(&emu_thread);
     }
-    else if (I8255_PORT_C == port_id) {
-        /*  PPI port C input:
-            4:  input: 2400 Hz
-            5:  input: cassette
-            6:  input: keyboard repeat
-            7:  input: MC6847 FSYNC
-
-            NOTE: only the 2400 Hz oscillator and FSYNC pins is emulated here
-        */
-        if (atom.state_2_4khz) {
-            data |= (1<<4);
-        }
-        /* FIXME: always send REPEAT key as 'not pressed' */
-        data |= (1<<6);
-        /* vblank pin (cleared during vblank) */
-        if (0 == (atom.vdg.pins & MC6847_FS)) {
-            data |= (1<<7);
-        }
+    gfx_shutdown();
+    romfile_unmap(&rom_abasic);
+    romfile_unmap(&rom_afloat);
+    romfile_unmap(&rom_dosrom);
+    if (prof) {
+        pcprof_report(prof, &prof_labels, stdout, 32);
+        pcprof_free_labels(&prof_labels);
+        free(prof);
     }
-    return data;
 }
@@ -0,0 +1,2129 @@
+//------------------------------------------------------------------------------
+//  bench.c
+//
+//  Headless benchmark for the example emulators. Boots each system core
+//  and runs it unthrottled for a number of emulated seconds (frame by frame,
+//  like the sokol-app shells do, but without display and input), then
+//  reports the emulated cycles per wall-clock second, emulated frames per
+//  second and nanoseconds per emulated tick.
+//
+//  Usage:
+//
+//      chips-bench [-n instances] [-j threads] [-s] [-r] [-d] [-t] [-i] [-l] [-b] [-c] [seconds] [system]
+//
+//  The default is to run 10 emulated seconds on one instance of each
+//  system. With -n and -j, the given number of independent instances
+//  of each system are stepped concurrently on a pool of worker threads
+//  (-j 0 means one thread per CPU core), and the aggregate throughput
+//  is reported. With -s, snapshot size and save/restore times are
+//  measured, restoring a snapshot into a separate instance is checked, and
+//  that a snapshot from another build is rejected.
+//  With -r, every frame is recorded into a rewind history (see
+//  common/rewind.h), and the history memory footprint per emulated second,
+//  and the cost of pushing a frame and of rolling back are reported.
+//  With -d, the fast paths are timed against their straightforward
+//  implementation:
+//      - the video decoders against the original decoders, and the KC87
+//        and Z1013 glyph cache and the ZX Spectrum decoder against per-pixel
+//        decoding
+//      - the CPC's scanline-batched CRT and video decoding against per-tick
+//        decoding
+//      - the Atom's batched MC6847 ticks against ticking it with the CPU
+//      - the C64's lazy CIA ticks against ticking the CIAs with the CPU
+//      - the KC87's batched CTC ticks against ticking the CTC with the CPU,
+//        and a bare CTC both ways
+//      - the ZX Spectrum with and without contended memory wait states
+//      - the MZ-800's GDG scanline decoder against a per-bit decoder
+//      - the batched audio synthesis of the C64, CPC and ZX Spectrum against
+//        ticking the audio chips with the CPU
+//      - the KC87 and Z1013 video decoding pipelined on a worker thread
+//        (see common/vidworker.h) against decoding after each frame
+//      - the C64 and CPC debugger hooks (see common/debugger.h) with no
+//        debugger, an empty one, and a watched boot
+//      - the C64 and CPC per-page access counters (see common/heatmap.h)
+//  The checks that these give identical results are test programs in
+//  tests/.
+//  With -t (only in builds with CHIPS_CHIPTIME), the host time per frame
+//  is broken down by chip for the systems which are instrumented (see
+//  common/chiptime.h).
+//  With -i, the Z1013 is run with and without idle loop skipping (see
+//  systems/z1013.h) while typing a few keys, and the results are compared.
+//  With -l, 1, 4, 16 and 64 instances of the C64 and CPC are stepped frame
+//  by frame on a single thread, and the throughput and the L1 data cache
+//  misses per emulated tick (from the Linux perf counters) are reported,
+//  together with the size of the per-tick state at the start of the
+//  system structs.
+//  With -b, the system tick functions are called with the same memory
+//  reads once through a function pointer (like the CPU exec loops call
+//  the tick callback) and once directly, where the compiler can inline
+//  them. This is only a measurement of the dispatch cost per system, the
+//  emulators always run through the tick callback pointer (the exec loops
+//  are part of the CPU cores in the chips library).
+//  With -c, 64 copy-on-write clones of a booted C64, CPC and ZX Spectrum
+//  are created from a shared base snapshot (see common/clone.h), and their
+//  private and resident memory is reported after cloning and after running
+//  a frame, also checking that a clone continues like a restored snapshot.
+//------------------------------------------------------------------------------
+#define CHIPS_IMPL
+#include "systems/atom.h"
+#include "systems/c64.h"
+#include "systems/cpc6128.h"
+#include "systems/kc87.h"
+#include "systems/mz800.h"
+#include "systems/z1013.h"
+#include "systems/zx128k.h"
+#include "common/thread.h"
+#include "common/rewind.h"
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include "common/vidworker.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <stddef.h> /* offsetof */
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+/* type-erased init/exec wrappers for the system table */
+static void atom_bench_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    atom_init((atom_t*)sys, &(atom_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static uint32_t atom_bench_exec(void* sys, uint32_t ticks) {
+    return atom_exec((atom_t*)sys, ticks);
+}
+static uint32_t atom_bench_save(const void* sys, void* buf, uint32_t buf_size) {
+    return atom_save_snapshot((const atom_t*)sys, buf, buf_size);
+}
+static bool atom_bench_load(void* sys, const void* buf, uint32_t buf_size) {
+    return atom_load_snapshot((atom_t*)sys, buf, buf_size);
+}
+static void c64_bench_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    c64_init((c64_t*)sys, &(c64_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static uint32_t c64_bench_exec(void* sys, uint32_t ticks) {
+    return c64_exec((c64_t*)sys, ticks);
+}
+static uint32_t c64_bench_save(const void* sys, void* buf, uint32_t buf_size) {
+    return c64_save_snapshot((const c64_t*)sys, buf, buf_size);
+}
+static bool c64_bench_load(void* sys, const void* buf, uint32_t buf_size) {
+    return c64_load_snapshot((c64_t*)sys, buf, buf_size);
+}
+static bool c64_bench_clone_base(clone_base_t* base, const void* buf, uint32_t buf_size) {
+    return c64_clone_base(base, buf, buf_size);
+}
+static void* c64_bench_clone(const clone_base_t* base, uint32_t* fb, uint32_t fb_size) {
+    return c64_clone(base, fb, fb_size);
+}
+static void c64_bench_free_clone(const clone_base_t* base, void* sys) {
+    c64_free_clone(base, (c64_t*)sys);
+}
+static void cpc_bench_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    cpc_init((cpc_t*)sys, &(cpc_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static uint32_t cpc_bench_exec(void* sys, uint32_t ticks) {
+    return cpc_exec((cpc_t*)sys, ticks);
+}
+static uint32_t cpc_bench_save(const void* sys, void* buf, uint32_t buf_size) {
+    return cpc_save_snapshot((const cpc_t*)sys, buf, buf_size);
+}
+static bool cpc_bench_load(void* sys, const void* buf, uint32_t buf_size) {
+    return cpc_load_snapshot((cpc_t*)sys, buf, buf_size);
+}
+static bool cpc_bench_clone_base(clone_base_t* base, const void* buf, uint32_t buf_size) {
+    return cpc_clone_base(base, buf, buf_size);
+}
+static void* cpc_bench_clone(const clone_base_t* base, uint32_t* fb, uint32_t fb_size) {
+    return cpc_clone(base, fb, fb_size);
+}
+static void cpc_bench_free_clone(const clone_base_t* base, void* sys) {
+    cpc_free_clone(base, (cpc_t*)sys);
+}
+static void kc87_bench_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    kc87_init((kc87_t*)sys, &(kc87_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static uint32_t kc87_bench_exec(void* sys, uint32_t ticks) {
+    return kc87_exec((kc87_t*)sys, ticks);
+}
+static uint32_t kc87_bench_save(const void* sys, void* buf, uint32_t buf_size) {
+    return kc87_save_snapshot((const kc87_t*)sys, buf, buf_size);
+}
+static bool kc87_bench_load(void* sys, const void* buf, uint32_t buf_size) {
+    return kc87_load_snapshot((kc87_t*)sys, buf, buf_size);
+}
+static void mz800_bench_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    mz800_init((mz800_t*)sys, &(mz800_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static uint32_t mz800_bench_exec(void* sys, uint32_t ticks) {
+    return mz800_exec((mz800_t*)sys, ticks);
+}
+static uint32_t mz800_bench_save(const void* sys, void* buf, uint32_t buf_size) {
+    return mz800_save_snapshot((const mz800_t*)sys, buf, buf_size);
+}
+static bool mz800_bench_load(void* sys, const void* buf, uint32_t buf_size) {
+    return mz800_load_snapshot((mz800_t*)sys, buf, buf_size);
+}
+static void z1013_bench_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    z1013_init((z1013_t*)sys, &(z1013_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static uint32_t z1013_bench_exec(void* sys, uint32_t ticks) {
+    return z1013_exec((z1013_t*)sys, ticks);
+}
+static uint32_t z1013_bench_save(const void* sys, void* buf, uint32_t buf_size) {
+    return z1013_save_snapshot((const z1013_t*)sys, buf, buf_size);
+}
+static bool z1013_bench_load(void* sys, const void* buf, uint32_t buf_size) {
+    return z1013_load_snapshot((z1013_t*)sys, buf, buf_size);
+}
+static void zx_bench_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    zx_init((zx128k_t*)sys, &(zx_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static uint32_t zx_bench_exec(void* sys, uint32_t ticks) {
+    return zx_exec((zx128k_t*)sys, ticks);
+}
+static uint32_t zx_bench_save(const void* sys, void* buf, uint32_t buf_size) {
+    return zx_save_snapshot((const zx128k_t*)sys, buf, buf_size);
+}
+static bool zx_bench_load(void* sys, const void* buf, uint32_t buf_size) {
+    return zx_load_snapshot((zx128k_t*)sys, buf, buf_size);
+}
+static bool zx_bench_clone_base(clone_base_t* base, const void* buf, uint32_t buf_size) {
+    return zx_clone_base(base, buf, buf_size);
+}
+static void* zx_bench_clone(const clone_base_t* base, uint32_t* fb, uint32_t fb_size) {
+    return zx_clone(base, fb, fb_size);
+}
+static void zx_bench_free_clone(const clone_base_t* base, void* sys) {
+    zx_free_clone(base, (zx128k_t*)sys);
+}
+
+typedef struct {
+    const char* name;
+    uint32_t freq_hz;           /* emulated CPU clock frequency */
+    uint32_t frame_hz;          /* emulated video frame rate */
+    uint32_t state_size;        /* size of the system state struct */
+    uint32_t fb_size;           /* size of the framebuffer in bytes */
+    void (*init)(void* sys, uint32_t* fb, uint32_t fb_size);
+    uint32_t (*exec)(void* sys, uint32_t ticks);
+    uint32_t (*snapshot_size)(void);
+    uint32_t (*save_snapshot)(const void* sys, void* buf, uint32_t buf_size);
+    bool (*load_snapshot)(void* sys, const void* buf, uint32_t buf_size);
+    /* copy-on-write clones (see common/clone.h), only on some systems */
+    bool (*clone_base)(clone_base_t* base, const void* buf, uint32_t buf_size);
+    void* (*clone)(const clone_base_t* base, uint32_t* fb, uint32_t fb_size);
+    void (*free_clone)(const clone_base_t* base, void* sys);
+} bench_system_t;
+
+#define FB_SIZE(w,h) ((w)*(h)*sizeof(uint32_t))
+static const bench_system_t systems[] = {
+    { "atom", ATOM_FREQ, 60, sizeof(atom_t), FB_SIZE(MC6847_DISPLAY_WIDTH, MC6847_DISPLAY_HEIGHT),
+      atom_bench_init, atom_bench_exec, atom_snapshot_size, atom_bench_save, atom_bench_load },
+    { "c64", C64_FREQ, 50, sizeof(c64_t), FB_SIZE(C64_DISP_WIDTH, C64_DISP_HEIGHT),
+      c64_bench_init, c64_bench_exec, c64_snapshot_size, c64_bench_save, c64_bench_load,
+      c64_bench_clone_base, c64_bench_clone, c64_bench_free_clone },
+    { "cpc6128", CPC_FREQ, 50, sizeof(cpc_t), FB_SIZE(CPC_DISP_WIDTH, CPC_DISP_HEIGHT),
+      cpc_bench_init, cpc_bench_exec, cpc_snapshot_size, cpc_bench_save, cpc_bench_load,
+      cpc_bench_clone_base, cpc_bench_clone, cpc_bench_free_clone },
+    { "kc87", KC87_FREQ, 50, sizeof(kc87_t), FB_SIZE(KC87_DISP_WIDTH, KC87_DISP_HEIGHT),
+      kc87_bench_init, kc87_bench_exec, kc87_snapshot_size, kc87_bench_save, kc87_bench_load },
+    { "mz800", MZ800_FREQ, 50, sizeof(mz800_t), FB_SIZE(MZ800_DISP_WIDTH, MZ800_DISP_HEIGHT),
+      mz800_bench_init, mz800_bench_exec, mz800_snapshot_size, mz800_bench_save, mz800_bench_load },
+    { "z1013", Z1013_FREQ, 50, sizeof(z1013_t), FB_SIZE(Z1013_DISP_WIDTH, Z1013_DISP_HEIGHT),
+      z1013_bench_init, z1013_bench_exec, z1013_snapshot_size, z1013_bench_save, z1013_bench_load },
+    { "zx128k", ZX128K_FREQ, 50, sizeof(zx128k_t), FB_SIZE(ZX128K_DISP_WIDTH, ZX128K_DISP_HEIGHT),
+      zx_bench_init, zx_bench_exec, zx_snapshot_size, zx_bench_save, zx_bench_load,
+      zx_bench_clone_base, zx_bench_clone, zx_bench_free_clone },
+};
+#define NUM_SYSTEMS (sizeof(systems)/sizeof(systems[0]))
+
+/* one emulator instance with its own state and framebuffer */
+typedef struct {
+    void* state;
+    uint32_t* fb;
+    uint64_t ticks;
+} bench_instance_t;
+
+/* a batch of instances shared between the worker threads */
+typedef struct {
+    const bench_system_t* sys;
+    int num_frames;
+    int num_instances;
+    bench_instance_t* instances;
+    volatile int32_t next_instance;
+} bench_job_t;
+
+/* boot an instance and run it for the given number of frames */
+static void bench_run_instance(const bench_system_t* sys, bench_instance_t* inst, int num_frames) {
+    sys->init(inst->state, inst->fb, sys->fb_size);
+    const uint32_t ticks_per_frame = sys->freq_hz / sys->frame_hz;
+    uint32_t overrun_ticks = 0;
+    for (int i = 0; i < num_frames; i++) {
+        uint32_t ticks_to_run = ticks_per_frame - overrun_ticks;
+        uint32_t ticks_executed = sys->exec(inst->state, ticks_to_run);
+        overrun_ticks = ticks_executed - ticks_to_run;
+        inst->ticks += ticks_executed;
+    }
+}
+
+/* worker thread function, grabs instances until none are left */
+static void bench_worker(void* arg) {
+    bench_job_t* job = (bench_job_t*) arg;
+    int32_t i;
+    while ((i = thread_atomic_add(&job->next_instance, 1)) < job->num_instances) {
+        bench_run_instance(job->sys, &job->instances[i], job->num_frames);
+    }
+}
+
+/* run a system for the given number of emulated seconds and print the results */
+static bool bench(const bench_system_t* sys, int seconds, int num_instances, int num_threads) {
+    bench_job_t job = {
+        .sys = sys,
+        .num_frames = seconds * sys->frame_hz,
+        .num_instances = num_instances,
+        .instances = (bench_instance_t*) calloc(num_instances, sizeof(bench_instance_t)),
+        .next_instance = 0
+    };
+    if (!job.instances) {
+        return false;
+    }
+    for (int i = 0; i < num_instances; i++) {
+        job.instances[i].state = thread_aligned_calloc(sys->state_size);
+        job.instances[i].fb = (uint32_t*) calloc(1, sys->fb_size);
+        if (!job.instances[i].state || !job.instances[i].fb) {
+            fprintf(stderr, "%s: out of memory for %d instances\n", sys->name, num_instances);
+            return false;
+        }
+    }
+    if (num_threads > num_instances) {
+        num_threads = num_instances;
+    }
+
+    uint64_t start = stm_now();
+    if (num_threads <= 1) {
+        bench_worker(&job);
+    }
+    else {
+        thread_t* threads = (thread_t*) calloc(num_threads, sizeof(thread_t));
+        int num_started = 0;
+        for (int i = 0; i < num_threads; i++) {
+            if (thread_start(&threads[i], bench_worker, &job)) {
+                num_started++;
+            }
+        }
+        if (0 == num_started) {
+            bench_worker(&job);
+        }
+        for (int i = 0; i < num_started; i++) {
+            thread_join(&threads[i]);
+        }
+        free(threads);
+    }
+    double wall_sec = stm_sec(stm_since(start));
+    if (wall_sec <= 0.0) {
+        wall_sec = 1e-9;
+    }
+
+    uint64_t ticks_total = 0;
+    for (int i = 0; i < num_instances; i++) {
+        ticks_total += job.instances[i].ticks;
+        thread_aligned_free(job.instances[i].state);
+        free(job.instances[i].fb);
+    }
+    free(job.instances);
+
+    const int64_t frames_total = (int64_t)job.num_frames * num_instances;
+    const double mhz = (ticks_total / wall_sec) / 1000000.0;
+    const double fps = frames_total / wall_sec;
+    const double ns_per_tick = (wall_sec * 1e9) / (double)ticks_total;
+    const double realtime = (ticks_total / wall_sec) / sys->freq_hz;
+    printf("%-10s %12"PRIu64" ticks %8.3f s %10.3f MHz %10.1f fps %8.2f ns/tick %8.1fx realtime\n",
+        sys->name, ticks_total, wall_sec, mhz, fps, ns_per_tick, realtime);
+    return true;
+}
+
+#if defined(CHIPS_CHIPTIME)
+/* the systems with chiptime instrumentation */
+typedef struct {
+    const char* name;
+    size_t offset;          /* offset of the chiptime pointer in the system state */
+    int num_slots;
+    const char* slot_names[CHIPTIME_MAX_SLOTS];
+} bench_chiptime_system_t;
+
+static const bench_chiptime_system_t chiptime_systems[] = {
+    { "c64", offsetof(c64_t, chiptime), C64_CHIPTIME_NUM, { C64_CHIPTIME_NAMES } },
+    { "cpc6128", offsetof(cpc_t, chiptime), CPC_CHIPTIME_NUM, { CPC_CHIPTIME_NAMES } },
+};
+
+/* run an instance with chiptime accounting and print the per-chip breakdown */
+static bool bench_chiptime(const bench_system_t* sys, int seconds) {
+    const bench_chiptime_system_t* cs = 0;
+    for (size_t i = 0; i < sizeof(chiptime_systems)/sizeof(chiptime_systems[0]); i++) {
+        if (0 == strcmp(sys->name, chiptime_systems[i].name)) {
+            cs = &chiptime_systems[i];
+        }
+    }
+    if (!cs) {
+        return true;
+    }
+    bench_instance_t inst = { .state = thread_aligned_calloc(sys->state_size), .fb = (uint32_t*) calloc(1, sys->fb_size) };
+    if (!inst.state || !inst.fb) {
+        fprintf(stderr, "%s: out of memory\n", sys->name);
+        thread_aligned_free(inst.state); free(inst.fb);
+        return false;
+    }
+    chiptime_desc_t desc = { .name = sys->name, .num_slots = cs->num_slots };
+    memcpy(desc.slot_names, cs->slot_names, sizeof(desc.slot_names));
+    chiptime_t ct;
+    chiptime_init(&ct, &desc);
+    sys->init(inst.state, inst.fb, sys->fb_size);
+    *(chiptime_t**)((uint8_t*)inst.state + cs->offset) = &ct;
+    const int num_frames = seconds * sys->frame_hz;
+    const uint32_t ticks_per_frame = sys->freq_hz / sys->frame_hz;
+    uint32_t overrun_ticks = 0;
+    for (int i = 0; i < num_frames; i++) {
+        uint32_t ticks_to_run = ticks_per_frame - overrun_ticks;
+        overrun_ticks = sys->exec(inst.state, ticks_to_run) - ticks_to_run;
+        chiptime_frame(&ct);
+    }
+    chiptime_print(&ct, stdout);
+    thread_aligned_free(inst.state); free(inst.fb);
+    return true;
+}
+#else
+static bool bench_chiptime(const bench_system_t* sys, int seconds) {
+    (void)sys; (void)seconds;
+    fprintf(stderr, "-t needs a build with CHIPS_CHIPTIME\n");
+    return false;
+}
+#endif
+
+/* take snapshots of a running instance, restore them into another instance
+   with its own framebuffer, check that both instances produce the same next
+   frame, and that a snapshot from another executable is rejected
+*/
+static bool bench_snapshot(const bench_system_t* sys, int seconds) {
+    const int num_iters = 100;
+    const uint32_t ticks_per_frame = sys->freq_hz / sys->frame_hz;
+    const uint32_t snapshot_size = sys->snapshot_size();
+    bench_instance_t a = { .state = thread_aligned_calloc(sys->state_size), .fb = (uint32_t*) calloc(1, sys->fb_size) };
+    bench_instance_t b = { .state = thread_aligned_calloc(sys->state_size), .fb = (uint32_t*) calloc(1, sys->fb_size) };
+    uint8_t* buf = (uint8_t*) malloc(snapshot_size);
+    bool ok = a.state && a.fb && b.state && b.fb && buf;
+    if (ok) {
+        bench_run_instance(sys, &a, seconds * sys->frame_hz);
+        sys->init(b.state, b.fb, sys->fb_size);
+
+        uint64_t start = stm_now();
+        for (int i = 0; i < num_iters; i++) {
+            ok &= (snapshot_size == sys->save_snapshot(a.state, buf, snapshot_size));
+        }
+        const double save_us = stm_us(stm_since(start)) / num_iters;
+        start = stm_now();
+        for (int i = 0; i < num_iters; i++) {
+            ok &= sys->load_snapshot(b.state, buf, snapshot_size);
+        }
+        const double load_us = stm_us(stm_since(start)) / num_iters;
+
+        /* both instances must now behave identically */
+        if (ok) {
+            ok = sys->exec(a.state, ticks_per_frame) == sys->exec(b.state, ticks_per_frame);
+            ok &= 0 == memcmp(a.fb, b.fb, sys->fb_size);
+        }
+        bool reject_ok = (snapshot_size == sys->save_snapshot(a.state, buf, snapshot_size));
+        ((snapshot_header_t*)buf)->image_layout++;
+        reject_ok &= !sys->load_snapshot(b.state, buf, snapshot_size);
+        printf("%-10s snapshot %8u bytes, save %8.2f us, load %8.2f us, %s, %s\n",
+            sys->name, snapshot_size, save_us, load_us, ok ? "restore ok" : "RESTORE MISMATCH",
+            reject_ok ? "foreign build rejected" : "FOREIGN BUILD ACCEPTED");
+        ok &= reject_ok;
+    }
+    else {
+        fprintf(stderr, "%s: out of memory\n", sys->name);
+    }
+    thread_aligned_free(a.state); free(a.fb);
+    thread_aligned_free(b.state); free(b.fb);
+    free(buf);
+    return ok;
+}
+
+/* record every frame into a rewind history, then measure rollback cost */
+static bool bench_rewind(const bench_system_t* sys, int seconds) {
+    const int num_frames = seconds * sys->frame_hz;
+    const uint32_t ticks_per_frame = sys->freq_hz / sys->frame_hz;
+    const uint32_t snapshot_size = sys->snapshot_size();
+    bench_instance_t inst = { .state = thread_aligned_calloc(sys->state_size), .fb = (uint32_t*) calloc(1, sys->fb_size) };
+    uint8_t* buf = (uint8_t*) malloc(snapshot_size);
+    uint8_t* check = (uint8_t*) malloc(snapshot_size);
+    rewind_t rw;
+    bool ok = inst.state && inst.fb && buf && check && rewind_init(&rw, &(rewind_desc_t){
+        .snapshot_size = snapshot_size,
+        .buffer_size = 256 * 1024 * 1024,
+        .max_frames = num_frames
+    });
+    if (!ok) {
+        fprintf(stderr, "%s: out of memory\n", sys->name);
+        thread_aligned_free(inst.state); free(inst.fb); free(buf); free(check);
+        return false;
+    }
+    sys->init(inst.state, inst.fb, sys->fb_size);
+    uint64_t push_ticks = 0;
+    uint32_t overrun_ticks = 0;
+    for (int i = 0; i < num_frames; i++) {
+        uint32_t ticks_to_run = ticks_per_frame - overrun_ticks;
+        overrun_ticks = sys->exec(inst.state, ticks_to_run) - ticks_to_run;
+        uint64_t start = stm_now();
+        sys->save_snapshot(inst.state, buf, snapshot_size);
+        rewind_push(&rw, buf);
+        push_ticks += stm_since(start);
+    }
+    const int recorded = rw.num_frames;
+    const uint32_t bytes = rewind_bytes_used(&rw);
+    /* rolling back needs to decode a frame and load the snapshot */
+    ok = rewind_get(&rw, 0, check) && (0 == memcmp(check, buf, snapshot_size));
+    const int num_iters = (recorded < 100) ? recorded : 100;
+    uint64_t start = stm_now();
+    for (int i = 0; i < num_iters; i++) {
+        ok &= rewind_get(&rw, i, buf);
+        ok &= sys->load_snapshot(inst.state, buf, snapshot_size);
+    }
+    const double rollback_us = num_iters > 0 ? (stm_us(stm_since(start)) / num_iters) : 0.0;
+    const double push_us = stm_us(push_ticks) / num_frames;
+    const double kb_per_sec = (bytes / 1024.0) * sys->frame_hz / (recorded > 0 ? recorded : 1);
+    printf("%-10s rewind %6d frames, %8.1f KB/s history, push %8.2f us, rollback %8.2f us, %s\n",
+        sys->name, recorded, kb_per_sec, push_us, rollback_us, ok ? "ok" : "REWIND MISMATCH");
+    rewind_discard(&rw);
+    thread_aligned_free(inst.state); free(inst.fb);
+    free(buf); free(check);
+    return ok;
+}
+
+/* the original per-pixel CPC decoder, as reference for the table-driven decoder */
+static void cpc_ref_decode_pixels(cpc_t* sys, uint32_t* dst, uint64_t crtc_pins) {
+    const uint16_t ma = MC6845_GET_ADDR(crtc_pins);
+    const uint8_t ra = MC6845_GET_RA(crtc_pins);
+    const uint32_t page_index  = (ma>>12) & 3;
+    const uint32_t page_offset = ((ma & 0x03FF)<<1) | ((ra & 7)<<11);
+    const uint8_t* src = &(sys->ram[page_index][page_offset]);
+    uint8_t c;
+    uint32_t p;
+    if (0 == sys->ga_video_mode) {
+        for (int i = 0; i < 2; i++) {
+            c = *src++;
+            p = sys->ga_palette[((c>>7)&0x1)|((c>>2)&0x2)|((c>>3)&0x4)|((c<<2)&0x8)];
+            *dst++ = p; *dst++ = p; *dst++ = p; *dst++ = p;
+            p = sys->ga_palette[((c>>6)&0x1)|((c>>1)&0x2)|((c>>2)&0x4)|((c<<3)&0x8)];
+            *dst++ = p; *dst++ = p; *dst++ = p; *dst++ = p;
+        }
+    }
+    else if (1 == sys->ga_video_mode) {
+        for (int i = 0; i < 2; i++) {
+            c = *src++;
+            p = sys->ga_palette[((c>>2)&2)|((c>>7)&1)];
+            *dst++ = p; *dst++ = p;
+            p = sys->ga_palette[((c>>1)&2)|((c>>6)&1)];
+            *dst++ = p; *dst++ = p;
+            p = sys->ga_palette[((c>>0)&2)|((c>>5)&1)];
+            *dst++ = p; *dst++ = p;
+            p = sys->ga_palette[((c<<1)&2)|((c>>4)&1)];
+            *dst++ = p; *dst++ = p;
+        }
+    }
+    else if (2 == sys->ga_video_mode) {
+        for (int i = 0; i < 2; i++) {
+            c = *src++;
+            for (int j = 7; j >= 0; j--) {
+                *dst++ = sys->ga_palette[(c>>j)&1];
+            }
+        }
+    }
+}
+
+typedef void (*bench_decode_func_t)(cpc_t* sys, uint32_t* dst, uint64_t crtc_pins);
+
+/* decode a number of full 'frames' of 48x200 characters, returns microseconds per frame */
+static double bench_cpc_decode_frames(cpc_t* sys, bench_decode_func_t func, int num_frames) {
+    uint64_t start = stm_now();
+    for (int frame = 0; frame < num_frames; frame++) {
+        for (int y = 0; y < 200; y++) {
+            uint32_t* dst = &sys->rgba8_buffer[y * CPC_DISP_WIDTH];
+            for (int x = 0; x < 48; x++) {
+                const uint16_t ma = (uint16_t)(0x3000 + (y>>3)*48 + x);
+                const uint64_t crtc_pins = ma | ((uint64_t)(y & 7) * MC6845_RA0);
+                func(sys, dst + x*16, crtc_pins);
+            }
+        }
+    }
+    return stm_us(stm_since(start)) / num_frames;
+}
+
+/* compare the table-driven CPC pixel decoder against the reference decoder */
+static bool bench_decode(void) {
+    const int num_frames = 200;
+    const uint32_t fb_size = FB_SIZE(CPC_DISP_WIDTH, CPC_DISP_HEIGHT);
+    cpc_t* sys = (cpc_t*) thread_aligned_calloc(sizeof(cpc_t));
+    uint32_t* ref_fb = (uint32_t*) calloc(1, fb_size);
+    uint32_t* fb = (uint32_t*) calloc(1, fb_size);
+    bool ok = sys && ref_fb && fb;
+    if (ok) {
+        cpc_init(sys, &(cpc_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+        uint32_t x = 0x6D98302B;
+        for (int i = 0; i < (int)sizeof(sys->ram); i++) {
+            x ^= x<<13; x ^= x>>17; x ^= x<<5;
+            ((uint8_t*)sys->ram)[i] = (uint8_t) x;
+        }
+        for (int i = 0; i < 16; i++) {
+            sys->ga_palette[i] = cpc_colors[(i * 7 + 3) & 0x1F];
+        }
+        for (int mode = 0; mode < 3; mode++) {
+            sys->ga_video_mode = mode;
+            sys->ga_decode_dirty = true;
+            sys->rgba8_buffer = ref_fb;
+            const double ref_us = bench_cpc_decode_frames(sys, cpc_ref_decode_pixels, num_frames);
+            sys->rgba8_buffer = fb;
+            const double us = bench_cpc_decode_frames(sys, cpc_ga_decode_pixels, num_frames);
+            const bool match = 0 == memcmp(ref_fb, fb, fb_size);
+            printf("cpc6128    mode %d decode: reference %8.2f us/frame, table %8.2f us/frame, %5.2fx, %s\n",
+                mode, ref_us, us, (us > 0.0) ? (ref_us / us) : 0.0, match ? "ok" : "MISMATCH");
+            ok &= match;
+        }
+    }
+    else {
+        fprintf(stderr, "cpc6128: out of memory\n");
+    }
+    thread_aligned_free(sys); free(ref_fb); free(fb);
+    return ok;
+}
+
+/* border color and video mode changes on every few gate array ticks, like raster effects do:
+
+    4000: DI
+          LD BC,7F10h       select the border pen
+          OUT (C),C
+          LD D,40h          border color
+          LD E,8Ch          video mode, ROMs disabled
+    loop: OUT (C),D
+          INC D
+          LD A,D
+          AND 5Fh
+          LD D,A
+          OUT (C),E
+          INC E
+          LD A,E
+          AND 83h
+          OR 8Ch
+          LD E,A
+          JR loop
+*/
+static const uint8_t cpc_raster_prog[] = {
+    0xF3, 0x01, 0x10, 0x7F, 0xED, 0x49, 0x16, 0x40, 0x1E, 0x8C,
+    0xED, 0x51, 0x14, 0x7A, 0xE6, 0x5F, 0x57, 0xED, 0x59, 0x1C, 0x7B, 0xE6, 0x83, 0xF6, 0x8C, 0x5F, 0x18, 0xEE,
+};
+
+/* compare the scanline-batched CRT and video decoding against per-tick decoding,
+   while booting, and with mid-scanline border color and video mode changes
+*/
+static bool bench_cpc_line_batch(void) {
+    const int num_boot_frames = 150;
+    const int num_raster_frames = 100;
+    const uint32_t ticks_per_frame = CPC_FREQ / 50;
+    const uint32_t fb_size = FB_SIZE(CPC_DISP_WIDTH, CPC_DISP_HEIGHT);
+    cpc_t* sys[2] = { (cpc_t*) thread_aligned_calloc(sizeof(cpc_t)), (cpc_t*) thread_aligned_calloc(sizeof(cpc_t)) };
+    uint32_t* fb[2] = { (uint32_t*) calloc(1, fb_size), (uint32_t*) calloc(1, fb_size) };
+    if (!sys[0] || !sys[1] || !fb[0] || !fb[1]) {
+        fprintf(stderr, "cpc6128: out of memory\n");
+        return false;
+    }
+    bool match = true;
+    uint64_t elapsed[2] = { 0, 0 };
+    uint32_t overrun_ticks[2] = { 0, 0 };
+    for (int i = 0; i < 2; i++) {
+        cpc_init(sys[i], &(cpc_desc_t){
+            .rgba8_buffer = fb[i],
+            .rgba8_buffer_size = fb_size,
+            .disable_line_batching = (0 == i)
+        });
+    }
+    for (int frame = 0; frame < num_boot_frames + num_raster_frames; frame++) {
+        if (frame == num_boot_frames) {
+            for (int i = 0; i < 2; i++) {
+                mem_write_range(&sys[i]->mem, 0x4000, cpc_raster_prog, sizeof(cpc_raster_prog));
+                sys[i]->cpu.state.PC = 0x4000;
+            }
+        }
+        for (int i = 0; i < 2; i++) {
+            const uint32_t ticks_to_run = ticks_per_frame - overrun_ticks[i];
+            const uint64_t start = stm_now();
+            overrun_ticks[i] = cpc_exec(sys[i], ticks_to_run) - ticks_to_run;
+            elapsed[i] += stm_since(start);
+        }
+        match &= 0 == memcmp(fb[0], fb[1], fb_size);
+    }
+    const int num_frames = num_boot_frames + num_raster_frames;
+    const double us[2] = { stm_us(elapsed[0]) / num_frames, stm_us(elapsed[1]) / num_frames };
+    printf("cpc6128    line batching: per-tick %8.2f us/frame, batched %8.2f us/frame, %5.2fx, %s\n",
+        us[0], us[1], (us[1] > 0.0) ? (us[0] / us[1]) : 0.0, match ? "ok" : "MISMATCH");
+    thread_aligned_free(sys[0]); thread_aligned_free(sys[1]);
+    free(fb[0]); free(fb[1]);
+    return match;
+}
+
+/* video memory writes and video mode changes on every few ticks:
+
+    2900: SEI
+          LDX #0
+    loop: TXA
+          STA $8000,X
+          STA $8100,X
+          AND #$F0          graphics mode bits of PPI port A
+          STA $B000
+          INX
+          JMP loop
+*/
+static const uint8_t atom_vdg_prog[] = {
+    0x78, 0xA2, 0x00, 0x8A, 0x9D, 0x00, 0x80, 0x9D, 0x00, 0x81, 0x29, 0xF0, 0x8D, 0x00, 0xB0, 0xE8, 0x4C, 0x03, 0x29,
+};
+
+/* compare the batched MC6847 ticks against ticking the MC6847 with the CPU,
+   while booting, and with video memory writes and video mode changes
+*/
+static bool bench_atom_vdg_batch(void) {
+    const int num_boot_frames = 120;
+    const int num_prog_frames = 60;
+    const uint32_t ticks_per_frame = ATOM_FREQ / 60;
+    const uint32_t fb_size = FB_SIZE(MC6847_DISPLAY_WIDTH, MC6847_DISPLAY_HEIGHT);
+    atom_t* sys[2] = { (atom_t*) thread_aligned_calloc(sizeof(atom_t)), (atom_t*) thread_aligned_calloc(sizeof(atom_t)) };
+    uint32_t* fb[2] = { (uint32_t*) calloc(1, fb_size), (uint32_t*) calloc(1, fb_size) };
+    if (!sys[0] || !sys[1] || !fb[0] || !fb[1]) {
+        fprintf(stderr, "atom: out of memory\n");
+        return false;
+    }
+    bool match = true;
+    uint64_t elapsed[2] = { 0, 0 };
+    uint32_t overrun_ticks[2] = { 0, 0 };
+    for (int i = 0; i < 2; i++) {
+        atom_init(sys[i], &(atom_desc_t){
+            .rgba8_buffer = fb[i],
+            .rgba8_buffer_size = fb_size,
+            .disable_vdg_batching = (0 == i)
+        });
+    }
+    for (int frame = 0; frame < num_boot_frames + num_prog_frames; frame++) {
+        if (frame == num_boot_frames) {
+            for (int i = 0; i < 2; i++) {
+                mem_write_range(&sys[i]->mem, 0x2900, atom_vdg_prog, sizeof(atom_vdg_prog));
+                sys[i]->cpu.state.PC = 0x2900;
+            }
+        }
+        for (int i = 0; i < 2; i++) {
+            const uint32_t ticks_to_run = ticks_per_frame - overrun_ticks[i];
+            const uint64_t start = stm_now();
+            overrun_ticks[i] = atom_exec(sys[i], ticks_to_run) - ticks_to_run;
+            elapsed[i] += stm_since(start);
+        }
+        match &= 0 == memcmp(fb[0], fb[1], fb_size);
+    }
+    const int num_frames = num_boot_frames + num_prog_frames;
+    const double us[2] = { stm_us(elapsed[0]) / num_frames, stm_us(elapsed[1]) / num_frames };
+    printf("atom       vdg batching: per-tick %8.2f us/frame, batched %8.2f us/frame, %5.2fx, %s\n",
+        us[0], us[1], (us[1] > 0.0) ? (us[0] / us[1]) : 0.0, match ? "ok" : "MISMATCH");
+    thread_aligned_free(sys[0]); thread_aligned_free(sys[1]);
+    free(fb[0]); free(fb[1]);
+    return match;
+}
+
+/* C64 test program at C000, reprograms the CIA-1 timer A (the KERNAL's
+   jiffy interrupt) to a period of 2000 ticks, and then polls the timer:
+
+          LDA #$D0
+          STA $DC04
+          LDA #$07
+          STA $DC05
+          LDA #$11          force load, start continuous
+          STA $DC0E
+          LDX #0
+    loop: LDA $DC04
+          STA $0400,X
+          INX
+          JMP loop
+*/
+static const uint8_t c64_cia_prog[] = {
+    0xA9, 0xD0, 0x8D, 0x04, 0xDC, 0xA9, 0x07, 0x8D, 0x05, 0xDC, 0xA9, 0x11, 0x8D, 0x0E, 0xDC,
+    0xA2, 0x00, 0xAD, 0x04, 0xDC, 0x9D, 0x00, 0x04, 0xE8, 0x4C, 0x11, 0xC0,
+};
+
+/* compare the C64's lazy CIA ticks against ticking the CIAs with the CPU,
+   first while booting (the CIAs are only accessed by the KERNAL's interrupt
+   service routine), then with a program which polls a CIA timer
+*/
+static bool bench_c64_cia_lazy(void) {
+    const int num_boot_frames = 180;
+    const int num_prog_frames = 60;
+    const uint32_t ticks_per_frame = C64_FREQ / 50;
+    const uint32_t fb_size = FB_SIZE(C64_DISP_WIDTH, C64_DISP_HEIGHT);
+    c64_t* sys[2] = { (c64_t*) thread_aligned_calloc(sizeof(c64_t)), (c64_t*) thread_aligned_calloc(sizeof(c64_t)) };
+    uint32_t* fb[2] = { (uint32_t*) calloc(1, fb_size), (uint32_t*) calloc(1, fb_size) };
+    if (!sys[0] || !sys[1] || !fb[0] || !fb[1]) {
+        fprintf(stderr, "c64: out of memory\n");
+        return false;
+    }
+    bool match = true;
+    uint64_t elapsed[2][2] = { { 0, 0 }, { 0, 0 } };
+    uint32_t overrun_ticks[2] = { 0, 0 };
+    for (int i = 0; i < 2; i++) {
+        c64_init(sys[i], &(c64_desc_t){
+            .rgba8_buffer = fb[i],
+            .rgba8_buffer_size = fb_size,
+            .disable_cia_lazy = (0 == i)
+        });
+    }
+    for (int frame = 0; frame < num_boot_frames + num_prog_frames; frame++) {
+        const int phase = (frame < num_boot_frames) ? 0 : 1;
+        if (frame == num_boot_frames) {
+            for (int i = 0; i < 2; i++) {
+                memcpy(&sys[i]->ram[0xC000], c64_cia_prog, sizeof(c64_cia_prog));
+                sys[i]->cpu.state.PC = 0xC000;
+            }
+        }
+        for (int i = 0; i < 2; i++) {
+            const uint32_t ticks_to_run = ticks_per_frame - overrun_ticks[i];
+            const uint64_t start = stm_now();
+            overrun_ticks[i] = c64_exec(sys[i], ticks_to_run) - ticks_to_run;
+            elapsed[phase][i] += stm_since(start);
+        }
+        match &= (0 == memcmp(fb[0], fb[1], fb_size)) && (0 == memcmp(sys[0]->ram, sys[1]->ram, sizeof(sys[0]->ram)));
+    }
+    const char* names[2] = { "boot", "poll" };
+    const int num_frames[2] = { num_boot_frames, num_prog_frames };
+    for (int phase = 0; phase < 2; phase++) {
+        const double us[2] = { stm_us(elapsed[phase][0]) / num_frames[phase], stm_us(elapsed[phase][1]) / num_frames[phase] };
+        printf("c64        lazy cia (%s): per-tick %8.2f us/frame, lazy %8.2f us/frame, %5.2fx, %s\n",
+            names[phase], us[0], us[1], (us[1] > 0.0) ? (us[0] / us[1]) : 0.0, match ? "ok" : "MISMATCH");
+    }
+    thread_aligned_free(sys[0]); thread_aligned_free(sys[1]);
+    free(fb[0]); free(fb[1]);
+    return match;
+}
+
+/* the KC87's batched CTC ticks against ticking the CTC with the CPU, while
+   booting and waiting in the OS prompt (the CTC drives the OS clock interrupt
+   through the channel 2 to 3 cascade), tests/kc87-ctc-test.c checks that
+   both are identical
+*/
+static bool bench_kc87_ctc_batch(void) {
+    const int num_frames = 300;
+    const uint32_t ticks_per_frame = KC87_FREQ / 50;
+    const uint32_t fb_size = FB_SIZE(KC87_DISP_WIDTH, KC87_DISP_HEIGHT);
+    kc87_t* sys[2] = { (kc87_t*) thread_aligned_calloc(sizeof(kc87_t)), (kc87_t*) thread_aligned_calloc(sizeof(kc87_t)) };
+    uint32_t* fb[2] = { (uint32_t*) calloc(1, fb_size), (uint32_t*) calloc(1, fb_size) };
+    if (!sys[0] || !sys[1] || !fb[0] || !fb[1]) {
+        fprintf(stderr, "kc87: out of memory\n");
+        return false;
+    }
+    uint64_t elapsed[2] = { 0, 0 };
+    uint32_t overrun_ticks[2] = { 0, 0 };
+    for (int i = 0; i < 2; i++) {
+        kc87_init(sys[i], &(kc87_desc_t){
+            .rgba8_buffer = fb[i],
+            .rgba8_buffer_size = fb_size,
+            .disable_ctc_batching = (0 == i)
+        });
+    }
+    for (int frame = 0; frame < num_frames; frame++) {
+        for (int i = 0; i < 2; i++) {
+            const uint32_t ticks_to_run = ticks_per_frame - overrun_ticks[i];
+            const uint64_t start = stm_now();
+            overrun_ticks[i] = kc87_exec(sys[i], ticks_to_run) - ticks_to_run;
+            elapsed[i] += stm_since(start);
+        }
+    }
+    const double us[2] = { stm_us(elapsed[0]) / num_frames, stm_us(elapsed[1]) / num_frames };
+    printf("kc87       batched ctc: per-tick %8.2f us/frame, batched %8.2f us/frame, %5.2fx\n",
+        us[0], us[1], (us[1] > 0.0) ? (us[0] / us[1]) : 0.0);
+    thread_aligned_free(sys[0]); thread_aligned_free(sys[1]);
+    free(fb[0]); free(fb[1]);
+    return true;
+}
+
+/* the throughput of a bare CTC with the KC87's channel 2 to 3 cascade, ticked
+   per tick and advanced with common/ctcbatch.h between zero counts (the
+   equivalence is checked in tests/z80ctc-test.c)
+*/
+static void bench_z80ctc_out(z80ctc_t* ctc, int chn_id, uint8_t data) {
+    uint64_t pins = Z80CTC_CE|Z80_IORQ|Z80_WR;
+    if (chn_id & 1) { pins |= Z80CTC_CS0; }
+    if (chn_id & 2) { pins |= Z80CTC_CS1; }
+    Z80_SET_DATA(pins, data);
+    z80ctc_iorq(ctc, pins);
+}
+
+static void bench_z80ctc_setup(z80ctc_t* ctc) {
+    z80ctc_init(ctc);
+    const uint8_t timer = Z80CTC_CTRL_EI|Z80CTC_CTRL_MODE_TIMER|Z80CTC_CTRL_TRIGGER_AUTO|Z80CTC_CTRL_CONST_FOLLOWS|Z80CTC_CTRL_CONTROL;
+    const uint8_t counter = Z80CTC_CTRL_EI|Z80CTC_CTRL_MODE_COUNTER|Z80CTC_CTRL_EDGE_RISING|Z80CTC_CTRL_CONST_FOLLOWS|Z80CTC_CTRL_CONTROL;
+    bench_z80ctc_out(ctc, 0, timer|Z80CTC_CTRL_PRESCALER_16);
+    bench_z80ctc_out(ctc, 0, 10);
+    bench_z80ctc_out(ctc, 1, timer|Z80CTC_CTRL_PRESCALER_256);
+    bench_z80ctc_out(ctc, 1, 0);
+    bench_z80ctc_out(ctc, 2, timer|Z80CTC_CTRL_PRESCALER_16);
+    bench_z80ctc_out(ctc, 2, 3);
+    bench_z80ctc_out(ctc, 3, counter);
+    bench_z80ctc_out(ctc, 3, 5);
+}
+
+static bool bench_z80ctc_batch(void) {
+    const uint32_t num_ticks = 50000000;
+    z80ctc_t ctc;
+    uint32_t num_zcto[2] = { 0, 0 };
+    uint32_t num_batched = 0;
+    double sec[2];
+
+    bench_z80ctc_setup(&ctc);
+    uint64_t pins = 0;
+    uint64_t start = stm_now();
+    for (uint32_t i = 0; i < num_ticks; i++) {
+        pins = ctcbatch_tick_cascade(&ctc, pins);
+        num_zcto[0] += (pins & Z80CTC_ZCTO2) ? 1 : 0;
+    }
+    sec[0] = stm_sec(stm_since(start));
+
+    bench_z80ctc_setup(&ctc);
+    pins = 0;
+    start = stm_now();
+    pins = ctcbatch_run_cascade(&ctc, pins, num_ticks, &num_batched, &num_zcto[1]);
+    sec[1] = stm_sec(stm_since(start));
+
+    printf("z80ctc     batched ctc: per-tick %8.1f Mticks/s, batched %8.1f Mticks/s (%.1f%% of the ticks batched), %u/%u zero counts\n",
+        (num_ticks / 1000000.0) / (sec[0] > 0.0 ? sec[0] : 1e-9),
+        (num_ticks / 1000000.0) / (sec[1] > 0.0 ? sec[1] : 1e-9),
+        (100.0 * num_batched) / num_ticks, num_zcto[0], num_zcto[1]);
+    return true;
+}
+
+/* the original per-pixel KC87 and Z1013 decoders, as reference for the glyph cache */
+static void kc87_ref_decode_vidmem(kc87_t* sys) {
+    uint32_t* dst = sys->rgba8_buffer;
+    const uint8_t* vidmem = &sys->mem[0xEC00];
+    const uint8_t* colmem = &sys->mem[0xE800];
+    const uint8_t* font = dump_kc87_font_2;
+    int offset = 0;
+    uint32_t fg, bg;
+    for (int y = 0; y < 24; y++) {
+        for (int py = 0; py < 8; py++) {
+            for (int x = 0; x < 40; x++) {
+                uint8_t chr = vidmem[offset+x];
+                uint8_t pixels = font[(chr<<3)|py];
+                uint8_t color = colmem[offset+x];
+                if ((color & 0x80) && sys->blink_flip_flop) {
+                    fg = kc87_palette[color&7];
+                    bg = kc87_palette[(color>>4)&7];
+                }
+                else {
+                    fg = kc87_palette[(color>>4)&7];
+                    bg = kc87_palette[color&7];
+                }
+                for (int px = 7; px >= 0; px--) {
+                    *dst++ = pixels & (1<<px) ? fg:bg;
+                }
+            }
+        }
+        offset += 40;
+    }
+}
+
+static void z1013_ref_decode_vidmem(z1013_t* sys) {
+    uint32_t* dst = sys->rgba8_buffer;
+    const uint8_t* src = &sys->mem[0xEC00];
+    const uint8_t* font = dump_z1013_font;
+    for (int y = 0; y < 32; y++) {
+        for (int py = 0; py < 8; py++) {
+            for (int x = 0; x < 32; x++) {
+                uint8_t chr = src[(y<<5) + x];
+                uint8_t bits = font[(chr<<3)|py];
+                for (int px = 7; px >=0; px--) {
+                    *dst++ = bits & (1<<px) ? 0xFFFFFFFF : 0xFF000000;
+                }
+            }
+        }
+    }
+}
+
+/* fill the KC87/Z1013 video RAM with random characters, and a few color pairs */
+static void bench_fill_vidmem(uint8_t* mem, bool color) {
+    uint32_t x = 0x6D98302B;
+    for (int i = 0; i < 0x400; i++) {
+        x ^= x<<13; x ^= x>>17; x ^= x<<5;
+        mem[0xEC00 + i] = (uint8_t) x;
+        if (color) {
+            mem[0xE800 + i] = (uint8_t)(0x70 | ((x>>8) & 3) | ((x>>4) & 0x80));
+        }
+    }
+}
+
+/* compare the glyph cache decoders against the reference decoders (full redraws) */
+static bool bench_decode_glyphs(void) {
+    const int num_frames = 200;
+    bool ok = true;
+    {
+        const uint32_t fb_size = FB_SIZE(KC87_DISP_WIDTH, KC87_DISP_HEIGHT);
+        kc87_t* sys = (kc87_t*) thread_aligned_calloc(sizeof(kc87_t));
+        uint32_t* ref_fb = (uint32_t*) calloc(1, fb_size);
+        uint32_t* fb = (uint32_t*) calloc(1, fb_size);
+        if (!sys || !ref_fb || !fb) {
+            fprintf(stderr, "kc87: out of memory\n");
+            return false;
+        }
+        kc87_init(sys, &(kc87_desc_t){ .rgba8_buffer = ref_fb, .rgba8_buffer_size = fb_size });
+        bench_fill_vidmem(sys->mem, true);
+        uint64_t start = stm_now();
+        for (int i = 0; i < num_frames; i++) {
+            kc87_ref_decode_vidmem(sys);
+        }
+        const double ref_us = stm_us(stm_since(start)) / num_frames;
+        sys->rgba8_buffer = fb;
+        start = stm_now();
+        for (int i = 0; i < num_frames; i++) {
+            sys->vid_dirty_all = true;
+            kc87_decode_vidmem(sys);
+        }
+        const double us = stm_us(stm_since(start)) / num_frames;
+        const bool match = 0 == memcmp(ref_fb, fb, fb_size);
+        const glyph_cache_t* gc = &sys->glyph_cache;
+        printf("kc87       full redraw: reference %8.2f us/frame, glyph cache %8.2f us/frame, %5.2fx, %s\n",
+            ref_us, us, (us > 0.0) ? (ref_us / us) : 0.0, match ? "ok" : "MISMATCH");
+        printf("kc87       glyph cache: %u KB for %d color pairs, %.2f%% hits\n",
+            glyph_cache_size(KC87_GLYPH_CACHE_SLOTS) / 1024, KC87_GLYPH_CACHE_SLOTS,
+            (100.0 * gc->hits) / (double)(gc->hits + gc->misses));
+        ok &= match;
+        thread_aligned_free(sys); free(ref_fb); free(fb);
+    }
+    {
+        const uint32_t fb_size = FB_SIZE(Z1013_DISP_WIDTH, Z1013_DISP_HEIGHT);
+        z1013_t* sys = (z1013_t*) thread_aligned_calloc(sizeof(z1013_t));
+        uint32_t* ref_fb = (uint32_t*) calloc(1, fb_size);
+        uint32_t* fb = (uint32_t*) calloc(1, fb_size);
+        if (!sys || !ref_fb || !fb) {
+            fprintf(stderr, "z1013: out of memory\n");
+            return false;
+        }
+        z1013_init(sys, &(z1013_desc_t){ .rgba8_buffer = ref_fb, .rgba8_buffer_size = fb_size });
+        bench_fill_vidmem(sys->mem, false);
+        uint64_t start = stm_now();
+        for (int i = 0; i < num_frames; i++) {
+            z1013_ref_decode_vidmem(sys);
+        }
+        const double ref_us = stm_us(stm_since(start)) / num_frames;
+        sys->rgba8_buffer = fb;
+        start = stm_now();
+        for (int i = 0; i < num_frames; i++) {
+            sys->vid_dirty_all = true;
+            z1013_decode_vidmem(sys);
+        }
+        const double us = stm_us(stm_since(start)) / num_frames;
+        const bool match = 0 == memcmp(ref_fb, fb, fb_size);
+        const glyph_cache_t* gc = &sys->glyph_cache;
+        printf("z1013      full redraw: reference %8.2f us/frame, glyph cache %8.2f us/frame, %5.2fx, %s\n",
+            ref_us, us, (us > 0.0) ? (ref_us / us) : 0.0, match ? "ok" : "MISMATCH");
+        printf("z1013      glyph cache: %u KB for %d color pairs, %.2f%% hits\n",
+            glyph_cache_size(Z1013_GLYPH_CACHE_SLOTS) / 1024, Z1013_GLYPH_CACHE_SLOTS,
+            (100.0 * gc->hits) / (double)(gc->hits + gc->misses));
+        ok &= match;
+        thread_aligned_free(sys); free(ref_fb); free(fb);
+    }
+    return ok;
+}
+
+/* time the ZX Spectrum scanline decoder for full redraws and for unchanged frames */
+static bool bench_decode_zx(void) {
+    const int num_frames = 200;
+    const uint32_t fb_size = FB_SIZE(ZX128K_DISP_WIDTH, ZX128K_DISP_HEIGHT);
+    zx128k_t* sys = (zx128k_t*) thread_aligned_calloc(sizeof(zx128k_t));
+    uint32_t* fb = (uint32_t*) calloc(1, fb_size);
+    if (!sys || !fb) {
+        fprintf(stderr, "zx128k: out of memory\n");
+        return false;
+    }
+    zx_init(sys, &(zx_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+    uint32_t x = 0x6D98302B;
+    for (int i = 0; i < 0x1B00; i++) {
+        x ^= x<<13; x ^= x>>17; x ^= x<<5;
+        sys->ram[5][i] = (uint8_t) x;
+    }
+    double us[2];
+    for (int pass = 0; pass < 2; pass++) {
+        uint64_t start = stm_now();
+        for (int frame = 0; frame < num_frames; frame++) {
+            if (0 == pass) {
+                sys->vid_redraw_lines = ZX128K_DISP_HEIGHT;
+            }
+            for (int line = 0; line < ZX128K_SCANLINES; line++) {
+                zx_decode_scanline(sys);
+            }
+        }
+        us[pass] = stm_us(stm_since(start)) / num_frames;
+    }
+    printf("zx128k     scanline decode: full redraw %8.2f us/frame, unchanged %8.2f us/frame\n", us[0], us[1]);
+    thread_aligned_free(sys); free(fb);
+    return true;
+}
+
+/* per-bit reference decoder for the MZ-800 GDG display modes */
+static void mz800_gdg_reference_line(const gdg_whid65040_032_t* gdg, int y, const uint8_t* vram, uint32_t* dst) {
+    for (int x = 0; x < GDG_DISPLAY_WIDTH; x++) {
+        int v;
+        if (gdg->dmd & GDG_DMD_640) {
+            v = (vram[y*80 + x/8] >> (x & 7)) & 1;
+        }
+        else {
+            const int px = x / 2;
+            const int offset = y*40 + px/8;
+            v = ((vram[offset] >> (px & 7)) & 1) | (((vram[0x2000 + offset] >> (px & 7)) & 1) << 1);
+        }
+        dst[x] = gdg_whid65040_032_colors[gdg->plt[v] & 0xF];
+    }
+}
+
+/* MZ-800 GDG scanline decoding with the plane-combining lookup table, checked against the per-bit reference */
+static bool bench_mz800_gdg(void) {
+    const int num_frames = 200;
+    const uint32_t fb_size = FB_SIZE(MZ800_DISP_WIDTH, MZ800_DISP_HEIGHT);
+    mz800_t* sys = (mz800_t*) thread_aligned_calloc(sizeof(mz800_t));
+    uint32_t* fb[2] = { (uint32_t*) calloc(1, fb_size), (uint32_t*) calloc(1, fb_size) };
+    if (!sys || !fb[0] || !fb[1]) {
+        fprintf(stderr, "mz800: out of memory\n");
+        return false;
+    }
+    mz800_init(sys, &(mz800_desc_t){ .rgba8_buffer = fb[0], .rgba8_buffer_size = fb_size });
+    uint32_t x = 0x2F6B1D37;
+    for (int i = 0; i < GDG_VRAM_SIZE; i++) {
+        x ^= x<<13; x ^= x>>17; x ^= x<<5;
+        sys->vram[i] = (uint8_t) x;
+    }
+    /* palette: pen 0..3 => blue, light red, green, light white */
+    static const uint8_t plt[4] = { 0x01, 0x1A, 0x24, 0x3F };
+    bool ok = true;
+    for (int mode = 0; mode < 2; mode++) {
+        gdg_whid65040_032_t* gdg = &sys->gdg;
+        gdg_whid65040_032_iorq(gdg, Z80_IORQ|Z80_WR|0x00CE|((uint64_t)(mode ? GDG_DMD_640 : 0)<<16));
+        for (int i = 0; i < 4; i++) {
+            gdg_whid65040_032_iorq(gdg, Z80_IORQ|Z80_WR|0x00F0|((uint64_t)plt[i]<<16));
+        }
+        double us[3];
+        for (int pass = 0; pass < 3; pass++) {
+            uint64_t start = stm_now();
+            for (int frame = 0; frame < num_frames; frame++) {
+                if (0 == pass) {
+                    for (int y = 0; y < MZ800_DISP_HEIGHT; y++) {
+                        mz800_gdg_reference_line(gdg, y, sys->vram, fb[1] + y * MZ800_DISP_WIDTH);
+                    }
+                    continue;
+                }
+                if (1 == pass) {
+                    gdg_whid65040_032_invalidate(gdg);
+                }
+                for (int y = 0; y < MZ800_DISP_HEIGHT; y++) {
+                    gdg_whid65040_032_decode_line(gdg, y, sys->vram, fb[0] + y * MZ800_DISP_WIDTH);
+                }
+            }
+            us[pass] = stm_us(stm_since(start)) / num_frames;
+        }
+        const bool match = 0 == memcmp(fb[0], fb[1], fb_size);
+        ok &= match;
+        printf("mz800      GDG %s: per-bit %8.2f us/frame, lookup %8.2f us/frame, %5.2fx, unchanged %8.2f us/frame, %s\n",
+            mode ? "640x200" : "320x200", us[0], us[1], us[0] / us[1], us[2], match ? "ok" : "MISMATCH");
+    }
+    thread_aligned_free(sys); free(fb[0]); free(fb[1]);
+    return ok;
+}
+
+/* run the Z1013 with and without idle loop skipping, the results must be identical */
+static bool bench_idle(int seconds) {
+    const int num_frames = seconds * 50;
+    const uint32_t ticks_per_frame = Z1013_FREQ / 50;
+    const uint32_t fb_size = FB_SIZE(Z1013_DISP_WIDTH, Z1013_DISP_HEIGHT);
+    z1013_t* sys[2] = { (z1013_t*) thread_aligned_calloc(sizeof(z1013_t)), (z1013_t*) thread_aligned_calloc(sizeof(z1013_t)) };
+    uint32_t* fb[2] = { (uint32_t*) calloc(1, fb_size), (uint32_t*) calloc(1, fb_size) };
+    if (!sys[0] || !sys[1] || !fb[0] || !fb[1]) {
+        fprintf(stderr, "z1013: out of memory\n");
+        return false;
+    }
+    double us[2];
+    uint64_t ticks[2];
+    for (int i = 0; i < 2; i++) {
+        z1013_init(sys[i], &(z1013_desc_t){
+            .rgba8_buffer = fb[i],
+            .rgba8_buffer_size = fb_size,
+            .disable_idle_skip = (0 == i)
+        });
+        ticks[i] = 0;
+        uint32_t overrun_ticks = 0;
+        uint64_t start = stm_now();
+        for (int frame = 0; frame < num_frames; frame++) {
+            /* type a key every second, so that the monitor leaves the idle loop */
+            if ((frame % 50) == 10) {
+                kbd_key_down(&sys[i]->kbd, 'A' + ((frame / 50) % 26));
+            }
+            else if ((frame % 50) == 15) {
+                kbd_key_up(&sys[i]->kbd, 'A' + ((frame / 50) % 26));
+            }
+            uint32_t ticks_to_run = ticks_per_frame - overrun_ticks;
+            uint32_t ticks_executed = z1013_exec(sys[i], ticks_to_run);
+            overrun_ticks = ticks_executed - ticks_to_run;
+            ticks[i] += ticks_executed;
+            kbd_update(&sys[i]->kbd);
+        }
+        us[i] = stm_us(stm_since(start)) / num_frames;
+    }
+    const bool match = (ticks[0] == ticks[1]) &&
+        (0 == memcmp(&sys[0]->cpu.state, &sys[1]->cpu.state, sizeof(z80_state_t))) &&
+        (0 == memcmp(sys[0]->mem, sys[1]->mem, sizeof(sys[0]->mem))) &&
+        (0 == memcmp(fb[0], fb[1], fb_size));
+    printf("z1013      idle skip: off %8.2f us/frame, on %8.2f us/frame, %5.2fx, %5.1f%% ticks skipped, %s\n",
+        us[0], us[1], (us[1] > 0.0) ? (us[0] / us[1]) : 0.0,
+        (100.0 * sys[1]->idle_ticks) / (double)(ticks[1] > 0 ? ticks[1] : 1), match ? "ok" : "MISMATCH");
+    thread_aligned_free(sys[0]); thread_aligned_free(sys[1]);
+    free(fb[0]); free(fb[1]);
+    return match;
+}
+
+/* the cost of the contended memory wait state lookup on the ZX Spectrum,
+   the ROM boot code runs mostly in uncontended memory, so additionally
+   run a loop in contended memory which reads and writes the display RAM
+*/
+static const uint8_t zx_contention_prog[] = {
+    /* 8000: DI; LD SP,8000h; loop: LD HL,4000h; LD BC,1B00h; inner: LD A,(HL); INC A; LD (HL),A; INC HL; DEC BC; LD A,B; OR C; JR NZ,inner; JR loop */
+    0xF3, 0x31, 0x00, 0x80, 0x21, 0x00, 0x40, 0x01, 0x00, 0x1B, 0x7E, 0x3C, 0x77, 0x23, 0x0B, 0x78, 0xB1, 0x20, 0xF7, 0x18, 0xEF,
+};
+
+static bool bench_zx_contention(void) {
+    const int num_boot_frames = 200;
+    const int num_prog_frames = 200;
+    const uint32_t ticks_per_frame = ZX128K_FREQ / 50;
+    const uint32_t fb_size = FB_SIZE(ZX128K_DISP_WIDTH, ZX128K_DISP_HEIGHT);
+    zx128k_t* sys = (zx128k_t*) thread_aligned_calloc(sizeof(zx128k_t));
+    uint32_t* fb = (uint32_t*) calloc(1, fb_size);
+    if (!sys || !fb) {
+        fprintf(stderr, "zx128k: out of memory\n");
+        return false;
+    }
+    double us[2][2];
+    for (int contention = 0; contention < 2; contention++) {
+        zx_init(sys, &(zx_desc_t){
+            .rgba8_buffer = fb,
+            .rgba8_buffer_size = fb_size,
+            .disable_contention = (0 == contention)
+        });
+        uint32_t overrun_ticks = 0;
+        for (int phase = 0; phase < 2; phase++) {
+            if (1 == phase) {
+                mem_write_range(&sys->mem, 0x8000, zx_contention_prog, sizeof(zx_contention_prog));
+                sys->cpu.state.PC = 0x8000;
+            }
+            const int num_frames = (0 == phase) ? num_boot_frames : num_prog_frames;
+            const uint64_t start = stm_now();
+            for (int frame = 0; frame < num_frames; frame++) {
+                const uint32_t ticks_to_run = ticks_per_frame - overrun_ticks;
+                overrun_ticks = zx_exec(sys, ticks_to_run) - ticks_to_run;
+            }
+            us[contention][phase] = stm_us(stm_since(start)) / num_frames;
+        }
+    }
+    for (int phase = 0; phase < 2; phase++) {
+        printf("zx128k     contention %s: off %8.2f us/frame, on %8.2f us/frame, %+5.1f%%\n",
+            (0 == phase) ? "(boot)      " : "(display RAM)", us[0][phase], us[1][phase],
+            (us[0][phase] > 0.0) ? (100.0 * (us[1][phase] - us[0][phase]) / us[0][phase]) : 0.0);
+    }
+    thread_aligned_free(sys); free(fb);
+    return true;
+}
+
+/* programs which play a tone with a changing frequency, to time batched
+   audio synthesis against ticking the audio chips with the CPU (the same
+   programs are in tests/audio-batch-test.c)
+*/
+/* C000: LDA #$0F; STA $D418; LDA #0; STA $D405; LDA #$F0; STA $D406; LDA #$21; STA $D404;
+         loop: INC $D401; LDY #0; dly: DEY; BNE dly; JMP loop
+*/
+static const uint8_t c64_audio_prog[] = {
+    0xA9, 0x0F, 0x8D, 0x18, 0xD4, 0xA9, 0x00, 0x8D, 0x05, 0xD4, 0xA9, 0xF0, 0x8D, 0x06, 0xD4, 0xA9, 0x21, 0x8D, 0x04, 0xD4,
+    0xEE, 0x01, 0xD4, 0xA0, 0x00, 0x88, 0xD0, 0xFD, 0x4C, 0x14, 0xC0,
+};
+/* 4000: DI; LD BC,F782h; OUT (C),C; loop: LD A,7; LD E,3Eh; CALL wr; LD A,8; LD E,0Fh; CALL wr; XOR A; LD E,D; CALL wr;
+         INC D; LD L,0; dly: DEC L; JR NZ,dly; JR loop;
+         wr: LD B,F4h; OUT (C),A; LD BC,F6C0h; OUT (C),C; LD BC,F600h; OUT (C),C;
+             LD B,F4h; OUT (C),E; LD BC,F680h; OUT (C),C; LD BC,F600h; OUT (C),C; RET
+*/
+static const uint8_t cpc_audio_prog[] = {
+    0xF3, 0x01, 0x82, 0xF7, 0xED, 0x49, 0x3E, 0x07, 0x1E, 0x3E, 0xCD, 0x21, 0x40, 0x3E, 0x08, 0x1E, 0x0F, 0xCD, 0x21, 0x40,
+    0xAF, 0x5A, 0xCD, 0x21, 0x40, 0x14, 0x2E, 0x00, 0x2D, 0x20, 0xFD, 0x18, 0xE5,
+    0x06, 0xF4, 0xED, 0x79, 0x01, 0xC0, 0xF6, 0xED, 0x49, 0x01, 0x00, 0xF6, 0xED, 0x49,
+    0x06, 0xF4, 0xED, 0x59, 0x01, 0x80, 0xF6, 0xED, 0x49, 0x01, 0x00, 0xF6, 0xED, 0x49, 0xC9,
+};
+/* 8000: DI; LD BC,FFFDh; LD A,7; OUT (C),A; LD B,BFh; LD A,3Eh; OUT (C),A; LD B,FFh; LD A,8; OUT (C),A; LD B,BFh; LD A,0Fh; OUT (C),A;
+         loop: LD B,FFh; XOR A; OUT (C),A; LD B,BFh; LD A,D; OUT (C),A; INC D; LD A,D; AND 10h; OUT (FEh),A;
+         LD E,0; dly: DEC E; JR NZ,dly; JR loop
+*/
+static const uint8_t zx_audio_prog[] = {
+    0xF3, 0x01, 0xFD, 0xFF, 0x3E, 0x07, 0xED, 0x79, 0x06, 0xBF, 0x3E, 0x3E, 0xED, 0x79, 0x06, 0xFF, 0x3E, 0x08, 0xED, 0x79,
+    0x06, 0xBF, 0x3E, 0x0F, 0xED, 0x79, 0x06, 0xFF, 0xAF, 0xED, 0x79, 0x06, 0xBF, 0x7A, 0xED, 0x79, 0x14, 0x7A, 0xE6, 0x10,
+    0xD3, 0xFE, 0x1E, 0x00, 0x1D, 0x20, 0xFD, 0x18, 0xE9,
+};
+
+/* the number of samples passed to the audio callback of the instance being run */
+static uint32_t bench_audio_count[2];
+static int bench_audio_cur;
+static void bench_audio_cb(const float* samples, int num_samples) {
+    (void)samples;
+    bench_audio_count[bench_audio_cur] += (uint32_t)num_samples;
+}
+
+static void c64_audio_bench_init(void* sys, uint32_t* fb, uint32_t fb_size, bool batching) {
+    c64_init((c64_t*)sys, &(c64_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .audio_cb = bench_audio_cb, .disable_audio_batching = !batching });
+}
+static void c64_audio_bench_prog(void* sys) {
+    memcpy(&((c64_t*)sys)->ram[0xC000], c64_audio_prog, sizeof(c64_audio_prog));
+    ((c64_t*)sys)->cpu.state.PC = 0xC000;
+}
+static void cpc_audio_bench_init(void* sys, uint32_t* fb, uint32_t fb_size, bool batching) {
+    cpc_init((cpc_t*)sys, &(cpc_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .audio_cb = bench_audio_cb, .disable_audio_batching = !batching });
+}
+static void cpc_audio_bench_prog(void* sys) {
+    mem_write_range(&((cpc_t*)sys)->mem, 0x4000, cpc_audio_prog, sizeof(cpc_audio_prog));
+    ((cpc_t*)sys)->cpu.state.PC = 0x4000;
+}
+static void zx_audio_bench_init(void* sys, uint32_t* fb, uint32_t fb_size, bool batching) {
+    zx_init((zx128k_t*)sys, &(zx_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .audio_cb = bench_audio_cb, .disable_audio_batching = !batching });
+}
+static void zx_audio_bench_prog(void* sys) {
+    mem_write_range(&((zx128k_t*)sys)->mem, 0x8000, zx_audio_prog, sizeof(zx_audio_prog));
+    ((zx128k_t*)sys)->cpu.state.PC = 0x8000;
+}
+
+/* the cost of batched audio synthesis (audio chip ticks deferred until the
+   chip is accessed or the frame ends) against ticking the audio chips with
+   the CPU, tests/audio-batch-test.c checks that the samples are bit-identical
+*/
+static bool bench_audio_batch(void) {
+    static const struct {
+        const char* name;
+        size_t size;
+        uint32_t fb_size;
+        uint32_t ticks_per_frame;
+        void (*init)(void* sys, uint32_t* fb, uint32_t fb_size, bool batching);
+        void (*prog)(void* sys);
+        uint32_t (*exec)(void* sys, uint32_t ticks);
+    } audio_systems[] = {
+        { "c64", sizeof(c64_t), FB_SIZE(C64_DISP_WIDTH, C64_DISP_HEIGHT), C64_FREQ / 50, c64_audio_bench_init, c64_audio_bench_prog, c64_bench_exec },
+        { "cpc6128", sizeof(cpc_t), FB_SIZE(CPC_DISP_WIDTH, CPC_DISP_HEIGHT), CPC_FREQ / 50, cpc_audio_bench_init, cpc_audio_bench_prog, cpc_bench_exec },
+        { "zx128k", sizeof(zx128k_t), FB_SIZE(ZX128K_DISP_WIDTH, ZX128K_DISP_HEIGHT), ZX128K_FREQ / 50, zx_audio_bench_init, zx_audio_bench_prog, zx_bench_exec },
+    };
+    const int num_boot_frames = 150;
+    const int num_prog_frames = 100;
+    for (size_t s = 0; s < sizeof(audio_systems) / sizeof(audio_systems[0]); s++) {
+        void* sys[2] = { thread_aligned_calloc(audio_systems[s].size), thread_aligned_calloc(audio_systems[s].size) };
+        uint32_t* fb[2] = { (uint32_t*) calloc(1, audio_systems[s].fb_size), (uint32_t*) calloc(1, audio_systems[s].fb_size) };
+        if (!sys[0] || !sys[1] || !fb[0] || !fb[1]) {
+            fprintf(stderr, "%s: out of memory\n", audio_systems[s].name);
+            return false;
+        }
+        uint64_t elapsed[2] = { 0, 0 };
+        uint32_t overrun_ticks[2] = { 0, 0 };
+        for (int i = 0; i < 2; i++) {
+            bench_audio_count[i] = 0;
+            audio_systems[s].init(sys[i], fb[i], audio_systems[s].fb_size, 0 != i);
+        }
+        for (int frame = 0; frame < num_boot_frames + num_prog_frames; frame++) {
+            for (int i = 0; i < 2; i++) {
+                if (frame == num_boot_frames) {
+                    audio_systems[s].prog(sys[i]);
+                }
+                const uint32_t ticks_to_run = audio_systems[s].ticks_per_frame - overrun_ticks[i];
+                bench_audio_cur = i;
+                const uint64_t start = stm_now();
+                overrun_ticks[i] = audio_systems[s].exec(sys[i], ticks_to_run) - ticks_to_run;
+                elapsed[i] += stm_since(start);
+            }
+        }
+        const int num_frames = num_boot_frames + num_prog_frames;
+        const double us[2] = { stm_us(elapsed[0]) / num_frames, stm_us(elapsed[1]) / num_frames };
+        printf("%-10s audio batching: per-tick %8.2f us/frame, batched %8.2f us/frame, %5.2fx, %u samples\n",
+            audio_systems[s].name, us[0], us[1], (us[1] > 0.0) ? (us[0] / us[1]) : 0.0, bench_audio_count[1]);
+        thread_aligned_free(sys[0]); thread_aligned_free(sys[1]);
+        free(fb[0]); free(fb[1]);
+    }
+    return true;
+}
+
+/* the pipelined video decoding of the KC87 and Z1013 examples: capture the
+   video state after each frame and decode it on a worker thread while the
+   next frame is emulated, compared against decoding it after each frame
+*/
+typedef struct {
+    void* sys;
+    void* frame;
+    uint32_t* dst;
+    void (*decode)(void* sys, void* frame, uint32_t* dst);
+} bench_vid_job_t;
+static void bench_vid_job(void* arg) {
+    bench_vid_job_t* job = (bench_vid_job_t*) arg;
+    job->decode(job->sys, job->frame, job->dst);
+}
+static void kc87_vid_bench_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    kc87_init((kc87_t*)sys, &(kc87_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static void kc87_vid_bench_key(void* sys, int key, bool down) {
+    kc87_t* kc87 = (kc87_t*) sys;
+    if (down) {
+        kbd_key_down(&kc87->kbd, key);
+    }
+    else {
+        kbd_key_up(&kc87->kbd, key);
+    }
+    z80pio_write_port(&kc87->pio2, Z80PIO_PORT_B, ~kbd_scan_lines(&kc87->kbd));
+}
+static void kc87_vid_bench_skip(void* sys, bool skip) { ((kc87_t*)sys)->skip_video = skip; }
+static void kc87_vid_bench_update(void* sys) { kbd_update(&((kc87_t*)sys)->kbd); }
+static void kc87_vid_bench_capture(void* sys, void* frame) { kc87_capture_video((kc87_t*)sys, (kc87_video_frame_t*)frame); }
+static void kc87_vid_bench_decode(void* sys, void* frame, uint32_t* dst) { kc87_decode_video((kc87_t*)sys, (kc87_video_frame_t*)frame, dst); }
+static void z1013_vid_bench_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    z1013_init((z1013_t*)sys, &(z1013_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static void z1013_vid_bench_key(void* sys, int key, bool down) {
+    if (down) {
+        kbd_key_down(&((z1013_t*)sys)->kbd, key);
+    }
+    else {
+        kbd_key_up(&((z1013_t*)sys)->kbd, key);
+    }
+}
+static void z1013_vid_bench_skip(void* sys, bool skip) { ((z1013_t*)sys)->skip_video = skip; }
+static void z1013_vid_bench_update(void* sys) { kbd_update(&((z1013_t*)sys)->kbd); }
+static void z1013_vid_bench_capture(void* sys, void* frame) { z1013_capture_video((z1013_t*)sys, (z1013_video_frame_t*)frame); }
+static void z1013_vid_bench_decode(void* sys, void* frame, uint32_t* dst) { z1013_decode_video((z1013_t*)sys, (z1013_video_frame_t*)frame, dst); }
+
+static bool bench_async_video(void) {
+    static const struct {
+        const char* name;
+        size_t size;
+        size_t frame_size;
+        uint32_t fb_size;
+        uint32_t ticks_per_frame;
+        void (*init)(void* sys, uint32_t* fb, uint32_t fb_size);
+        void (*key)(void* sys, int key, bool down);
+        void (*skip)(void* sys, bool skip);
+        void (*update)(void* sys);
+        void (*capture)(void* sys, void* frame);
+        void (*decode)(void* sys, void* frame, uint32_t* dst);
+        uint32_t (*exec)(void* sys, uint32_t ticks);
+    } vid_systems[] = {
+        { "kc87", sizeof(kc87_t), sizeof(kc87_video_frame_t), FB_SIZE(KC87_DISP_WIDTH, KC87_DISP_HEIGHT), KC87_FREQ / 50,
+          kc87_vid_bench_init, kc87_vid_bench_key, kc87_vid_bench_skip, kc87_vid_bench_update, kc87_vid_bench_capture, kc87_vid_bench_decode, kc87_bench_exec },
+        { "z1013", sizeof(z1013_t), sizeof(z1013_video_frame_t), FB_SIZE(Z1013_DISP_WIDTH, Z1013_DISP_HEIGHT), Z1013_FREQ / 50,
+          z1013_vid_bench_init, z1013_vid_bench_key, z1013_vid_bench_skip, z1013_vid_bench_update, z1013_vid_bench_capture, z1013_vid_bench_decode, z1013_bench_exec },
+    };
+    const int num_frames = 500;
+    vidworker_t* worker = (vidworker_t*) thread_aligned_calloc(sizeof(vidworker_t));
+    if (!worker || !vidworker_start(worker)) {
+        fprintf(stderr, "failed to start the video decode thread\n");
+        return false;
+    }
+    bool all_match = true;
+    for (size_t s = 0; s < sizeof(vid_systems) / sizeof(vid_systems[0]); s++) {
+        const uint32_t fb_size = vid_systems[s].fb_size;
+        void* sys[2] = { thread_aligned_calloc(vid_systems[s].size), thread_aligned_calloc(vid_systems[s].size) };
+        uint32_t* fb[2] = { (uint32_t*) calloc(1, fb_size), (uint32_t*) calloc(1, fb_size) };
+        uint32_t* prev_fb = (uint32_t*) calloc(1, fb_size);     /* the synchronous output of the previous frame */
+        uint32_t* worker_fb = (uint32_t*) calloc(1, fb_size);
+        void* frame = calloc(1, vid_systems[s].frame_size);
+        if (!sys[0] || !sys[1] || !fb[0] || !fb[1] || !prev_fb || !worker_fb || !frame) {
+            fprintf(stderr, "%s: out of memory\n", vid_systems[s].name);
+            return false;
+        }
+        const uint64_t work_ticks = worker->work_ticks;
+        const uint64_t wait_ticks = worker->wait_ticks;
+        const uint32_t num_jobs = worker->num_jobs;
+        bench_vid_job_t job = { sys[1], frame, worker_fb, vid_systems[s].decode };
+        bool match = true;
+        uint64_t elapsed[2] = { 0, 0 };
+        uint32_t overrun_ticks[2] = { 0, 0 };
+        for (int i = 0; i < 2; i++) {
+            vid_systems[s].init(sys[i], fb[i], fb_size);
+        }
+        vid_systems[s].skip(sys[1], true);
+        for (int f = 0; f < num_frames; f++) {
+            if ((f % 25) == 10) {
+                for (int i = 0; i < 2; i++) {
+                    vid_systems[s].key(sys[i], 'A' + ((f / 25) % 26), true);
+                }
+            }
+            else if ((f % 25) == 15) {
+                for (int i = 0; i < 2; i++) {
+                    vid_systems[s].key(sys[i], 'A' + ((f / 25) % 26), false);
+                }
+            }
+            for (int i = 0; i < 2; i++) {
+                const uint32_t ticks_to_run = vid_systems[s].ticks_per_frame - overrun_ticks[i];
+                const uint64_t start = stm_now();
+                overrun_ticks[i] = vid_systems[s].exec(sys[i], ticks_to_run) - ticks_to_run;
+                if (1 == i) {
+                    /* the worker's previous frame is presented here, and the new frame is handed to it */
+                    vidworker_wait(worker);
+                    if (f > 0) {
+                        match &= 0 == memcmp(worker_fb, prev_fb, fb_size);
+                    }
+                    vid_systems[s].capture(sys[1], frame);
+                    vidworker_kick(worker, bench_vid_job, &job);
+                }
+                elapsed[i] += stm_since(start);
+                vid_systems[s].update(sys[i]);
+            }
+            memcpy(prev_fb, fb[0], fb_size);
+        }
+        vidworker_wait(worker);
+        match &= 0 == memcmp(worker_fb, fb[0], fb_size);
+        const uint32_t jobs = worker->num_jobs - num_jobs;
+        const double work_us = stm_us(worker->work_ticks - work_ticks) / jobs;
+        const double wait_us = stm_us(worker->wait_ticks - wait_ticks) / jobs;
+        const double us[2] = { stm_us(elapsed[0]) / num_frames, stm_us(elapsed[1]) / num_frames };
+        printf("%-10s async video: sync %8.2f us/frame, pipelined %8.2f us/frame, decode %6.2f us/frame, %5.1f%% overlapped, %s\n",
+            vid_systems[s].name, us[0], us[1], work_us, (work_us > wait_us) ? (100.0 * (work_us - wait_us) / work_us) : 0.0,
+            match ? "ok" : "MISMATCH");
+        all_match &= match;
+        thread_aligned_free(sys[0]); thread_aligned_free(sys[1]);
+        free(fb[0]); free(fb[1]);
+        free(prev_fb); free(worker_fb); free(frame);
+    }
+    vidworker_stop(worker);
+    free(worker);
+    return all_match;
+}
+
+/* the cost of the debugger hooks in the C64 and CPC tick callbacks: without
+   a debugger, with an empty debugger, and with a breakpoint on the reset
+   entry point and a write watchpoint (tests/debugger-test.c checks that the
+   emulation is identical and that the breakpoint and watchpoint are hit)
+*/
+static void c64_dbg_bench_init(void* sys, uint32_t* fb, uint32_t fb_size, dbg_t* dbg) {
+    c64_init((c64_t*)sys, &(c64_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .dbg = dbg });
+}
+static void cpc_dbg_bench_init(void* sys, uint32_t* fb, uint32_t fb_size, dbg_t* dbg) {
+    cpc_init((cpc_t*)sys, &(cpc_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .dbg = dbg });
+}
+
+static bool bench_debugger(void) {
+    static const struct {
+        const char* name;
+        size_t size;
+        uint32_t fb_size;
+        uint32_t ticks_per_frame;
+        uint16_t break_addr;        /* the reset entry point */
+        uint16_t watch_addr;        /* written during boot */
+        void (*init)(void* sys, uint32_t* fb, uint32_t fb_size, dbg_t* dbg);
+        uint32_t (*exec)(void* sys, uint32_t ticks);
+    } dbg_systems[] = {
+        { "c64", sizeof(c64_t), FB_SIZE(C64_DISP_WIDTH, C64_DISP_HEIGHT), C64_FREQ / 50, 0xFCE2, 0xD020, c64_dbg_bench_init, c64_bench_exec },
+        { "cpc6128", sizeof(cpc_t), FB_SIZE(CPC_DISP_WIDTH, CPC_DISP_HEIGHT), CPC_FREQ / 50, 0x0000, 0xC000, cpc_dbg_bench_init, cpc_bench_exec },
+    };
+    const int num_frames = 150;
+    for (size_t s = 0; s < sizeof(dbg_systems) / sizeof(dbg_systems[0]); s++) {
+        /* 0: no debugger, 1: empty debugger, 2: breakpoint and watchpoint */
+        void* sys[3];
+        uint32_t* fb[3];
+        dbg_t dbg[2];
+        uint64_t elapsed[3] = { 0, 0, 0 };
+        uint32_t overrun_ticks[3] = { 0, 0, 0 };
+        dbg_init(&dbg[0]);
+        dbg_init(&dbg[1]);
+        dbg_add_breakpoint(&dbg[1], dbg_systems[s].break_addr);
+        dbg_add_watchpoint(&dbg[1], dbg_systems[s].watch_addr, 1, DBG_WATCH_WRITE);
+        for (int i = 0; i < 3; i++) {
+            sys[i] = thread_aligned_calloc(dbg_systems[s].size);
+            fb[i] = (uint32_t*) calloc(1, dbg_systems[s].fb_size);
+            if (!sys[i] || !fb[i]) {
+                fprintf(stderr, "%s: out of memory\n", dbg_systems[s].name);
+                return false;
+            }
+            dbg_systems[s].init(sys[i], fb[i], dbg_systems[s].fb_size, (i > 0) ? &dbg[i - 1] : 0);
+        }
+        for (int frame = 0; frame < num_frames; frame++) {
+            for (int i = 0; i < 3; i++) {
+                const uint32_t ticks_to_run = dbg_systems[s].ticks_per_frame - overrun_ticks[i];
+                const uint64_t start = stm_now();
+                overrun_ticks[i] = dbg_systems[s].exec(sys[i], ticks_to_run) - ticks_to_run;
+                elapsed[i] += stm_since(start);
+            }
+            /* continue after a hit */
+            if (dbg_stopped(&dbg[1])) {
+                dbg_resume(&dbg[1]);
+            }
+        }
+        const double us[3] = { stm_us(elapsed[0]) / num_frames, stm_us(elapsed[1]) / num_frames, stm_us(elapsed[2]) / num_frames };
+        printf("%-10s debugger: none %8.2f us/frame, empty %8.2f us/frame (%+5.1f%%), watched %8.2f us/frame (%+5.1f%%), %u hits\n",
+            dbg_systems[s].name, us[0], us[1], (us[0] > 0.0) ? (100.0 * (us[1] - us[0]) / us[0]) : 0.0,
+            us[2], (us[0] > 0.0) ? (100.0 * (us[2] - us[0]) / us[0]) : 0.0, dbg[1].num_hits);
+        for (int i = 0; i < 3; i++) {
+            thread_aligned_free(sys[i]);
+            free(fb[i]);
+        }
+    }
+    return true;
+}
+
+/* the cost of the per-page access counters in the C64 and CPC, and the
+   counted accesses (tests/heatmap-test.c checks the per-frame counts against
+   the totals, and that the emulation is identical)
+*/
+static void c64_heatmap_bench_init(void* sys, uint32_t* fb, uint32_t fb_size, heatmap_t* heatmap) {
+    c64_init((c64_t*)sys, &(c64_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .heatmap = heatmap });
+}
+static void cpc_heatmap_bench_init(void* sys, uint32_t* fb, uint32_t fb_size, heatmap_t* heatmap) {
+    cpc_init((cpc_t*)sys, &(cpc_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .heatmap = heatmap });
+}
+
+static bool bench_heatmap(void) {
+    static const struct {
+        const char* name;
+        size_t size;
+        uint32_t fb_size;
+        uint32_t ticks_per_frame;
+        void (*init)(void* sys, uint32_t* fb, uint32_t fb_size, heatmap_t* heatmap);
+        uint32_t (*exec)(void* sys, uint32_t ticks);
+    } heatmap_systems[] = {
+        { "c64", sizeof(c64_t), FB_SIZE(C64_DISP_WIDTH, C64_DISP_HEIGHT), C64_FREQ / 50, c64_heatmap_bench_init, c64_bench_exec },
+        { "cpc6128", sizeof(cpc_t), FB_SIZE(CPC_DISP_WIDTH, CPC_DISP_HEIGHT), CPC_FREQ / 50, cpc_heatmap_bench_init, cpc_bench_exec },
+    };
+    const int num_frames = 150;
+    heatmap_t* heatmap = (heatmap_t*) malloc(sizeof(heatmap_t));
+    heatmap_frame_t* frame_counts = (heatmap_frame_t*) malloc(sizeof(heatmap_frame_t));
+    if (!heatmap || !frame_counts) {
+        fprintf(stderr, "heatmap: out of memory\n");
+        return false;
+    }
+    for (size_t s = 0; s < sizeof(heatmap_systems) / sizeof(heatmap_systems[0]); s++) {
+        void* sys[2] = { thread_aligned_calloc(heatmap_systems[s].size), thread_aligned_calloc(heatmap_systems[s].size) };
+        uint32_t* fb[2] = { (uint32_t*) calloc(1, heatmap_systems[s].fb_size), (uint32_t*) calloc(1, heatmap_systems[s].fb_size) };
+        if (!sys[0] || !sys[1] || !fb[0] || !fb[1]) {
+            fprintf(stderr, "%s: out of memory\n", heatmap_systems[s].name);
+            return false;
+        }
+        heatmap_init(heatmap);
+        for (int i = 0; i < 2; i++) {
+            heatmap_systems[s].init(sys[i], fb[i], heatmap_systems[s].fb_size, (0 != i) ? heatmap : 0);
+        }
+        uint64_t elapsed[2] = { 0, 0 };
+        uint32_t overrun_ticks[2] = { 0, 0 };
+        uint64_t frame_sums[HEATMAP_NUM_KINDS] = { 0 };
+        for (int frame = 0; frame < num_frames; frame++) {
+            for (int i = 0; i < 2; i++) {
+                const uint32_t ticks_to_run = heatmap_systems[s].ticks_per_frame - overrun_ticks[i];
+                const uint64_t start = stm_now();
+                overrun_ticks[i] = heatmap_systems[s].exec(sys[i], ticks_to_run) - ticks_to_run;
+                elapsed[i] += stm_since(start);
+            }
+            heatmap_frame(heatmap, frame_counts);
+            for (int k = 0; k < HEATMAP_NUM_KINDS; k++) {
+                for (int p = 0; p < 256; p++) {
+                    frame_sums[k] += frame_counts->counts[k][p];
+                }
+            }
+        }
+        int hot_page = 0;
+        for (int p = 0; p < 256; p++) {
+            if (heatmap->counts[HEATMAP_FETCH][p] > heatmap->counts[HEATMAP_FETCH][hot_page]) {
+                hot_page = p;
+            }
+        }
+        const double us[2] = { stm_us(elapsed[0]) / num_frames, stm_us(elapsed[1]) / num_frames };
+        printf("%-10s heatmap: off %8.2f us/frame, on %8.2f us/frame (%+5.1f%%), %.1fM fetch/%.1fM read/%.1fM write/%.1fM io, hottest code page %02X00\n",
+            heatmap_systems[s].name, us[0], us[1], (us[0] > 0.0) ? (100.0 * (us[1] - us[0]) / us[0]) : 0.0,
+            frame_sums[HEATMAP_FETCH] / 1e6, frame_sums[HEATMAP_READ] / 1e6, frame_sums[HEATMAP_WRITE] / 1e6, frame_sums[HEATMAP_IO] / 1e6,
+            hot_page);
+        thread_aligned_free(sys[0]); thread_aligned_free(sys[1]);
+        free(fb[0]); free(fb[1]);
+    }
+    free(heatmap);
+    free(frame_counts);
+    return true;
+}
+
+/* L1 data cache read misses of the calling thread (Linux perf counters), -1 if not available */
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+static int bench_l1_open(void) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int) syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+static void bench_l1_start(int fd) {
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+}
+static int64_t bench_l1_stop(int fd) {
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t count = 0;
+    return ((ssize_t)sizeof(count) == read(fd, &count, sizeof(count))) ? (int64_t)count : -1;
+}
+static void bench_l1_close(int fd) {
+    close(fd);
+}
+#else
+static int bench_l1_open(void) { return -1; }
+static void bench_l1_start(int fd) { (void)fd; }
+static int64_t bench_l1_stop(int fd) { (void)fd; return -1; }
+static void bench_l1_close(int fd) { (void)fd; }
+#endif
+
+/* the size of the per-tick state at the start of the system structs (see c64_t and cpc_t) */
+typedef struct {
+    const char* name;
+    uint32_t hot_size;
+} bench_layout_system_t;
+static const bench_layout_system_t layout_systems[] = {
+    { "c64", offsetof(c64_t, cia_1) },
+    { "cpc6128", offsetof(cpc_t, io_pages) },
+};
+
+/* step 1..64 instances frame by frame in round-robin order on one thread
+   (like a worker thread stepping many instances), and report the throughput
+   and the L1 data cache misses per emulated tick
+*/
+static bool bench_layout(const bench_system_t* sys, int seconds) {
+    const bench_layout_system_t* ls = 0;
+    for (size_t i = 0; i < sizeof(layout_systems)/sizeof(layout_systems[0]); i++) {
+        if (0 == strcmp(sys->name, layout_systems[i].name)) {
+            ls = &layout_systems[i];
+        }
+    }
+    if (!ls) {
+        return true;
+    }
+    printf("%-10s layout: %u bytes per-tick state (%u cache lines) of %u bytes\n",
+        sys->name, ls->hot_size, (ls->hot_size + CHIPS_CACHE_LINE_SIZE - 1) / CHIPS_CACHE_LINE_SIZE, sys->state_size);
+    enum { MAX_INSTANCES = 64 };
+    bench_instance_t inst[MAX_INSTANCES];
+    uint32_t overrun_ticks[MAX_INSTANCES];
+    memset(inst, 0, sizeof(inst));
+    bool ok = true;
+    for (int i = 0; i < MAX_INSTANCES; i++) {
+        inst[i].state = thread_aligned_calloc(sys->state_size);
+        inst[i].fb = (uint32_t*) calloc(1, sys->fb_size);
+        ok &= inst[i].state && inst[i].fb;
+    }
+    const int fd = bench_l1_open();
+    const uint32_t ticks_per_frame = sys->freq_hz / sys->frame_hz;
+    for (int num_instances = 1; ok && (num_instances <= MAX_INSTANCES); num_instances *= 4) {
+        /* the same number of emulated frames in total, split between the instances */
+        int num_frames = (seconds * sys->frame_hz) / num_instances;
+        if (num_frames < 1) {
+            num_frames = 1;
+        }
+        for (int i = 0; i < num_instances; i++) {
+            sys->init(inst[i].state, inst[i].fb, sys->fb_size);
+            overrun_ticks[i] = 0;
+            inst[i].ticks = 0;
+        }
+        if (fd >= 0) {
+            bench_l1_start(fd);
+        }
+        const uint64_t start = stm_now();
+        for (int f = 0; f < num_frames; f++) {
+            for (int i = 0; i < num_instances; i++) {
+                const uint32_t ticks_to_run = ticks_per_frame - overrun_ticks[i];
+                const uint32_t ticks_executed = sys->exec(inst[i].state, ticks_to_run);
+                overrun_ticks[i] = ticks_executed - ticks_to_run;
+                inst[i].ticks += ticks_executed;
+            }
+        }
+        const double secs = stm_sec(stm_since(start));
+        const int64_t misses = (fd >= 0) ? bench_l1_stop(fd) : -1;
+        uint64_t ticks = 0;
+        for (int i = 0; i < num_instances; i++) {
+            ticks += inst[i].ticks;
+        }
+        char miss_str[32];
+        if (misses >= 0) {
+            snprintf(miss_str, sizeof(miss_str), "%.3f", (double)misses / (double)ticks);
+        }
+        else {
+            snprintf(miss_str, sizeof(miss_str), "n/a");
+        }
+        printf("%-10s layout: %2d instance(s) on 1 thread, %8.2f MHz, %s L1D misses/tick\n",
+            sys->name, num_instances, (secs > 0.0) ? ((double)ticks / secs / 1000000.0) : 0.0, miss_str);
+    }
+    if (fd >= 0) {
+        bench_l1_close(fd);
+    }
+    for (int i = 0; i < MAX_INSTANCES; i++) {
+        thread_aligned_free(inst[i].state);
+        free(inst[i].fb);
+    }
+    if (!ok) {
+        fprintf(stderr, "%s: out of memory\n", sys->name);
+    }
+    return ok;
+}
+
+/* measures the cost of dispatching the CPU memory cycles through the tick
+   callback pointer (as z80_exec() and m6502_exec() do) versus calling the
+   tick function directly from the same translation unit, where the compiler
+   can inline it into the loop; both loops issue the same memory reads on two
+   identically booted instances, the read data must match
+*/
+typedef uint64_t (*bench_m6502_tick_t)(uint64_t pins);
+typedef uint64_t (*bench_z80_tick_t)(int num_ticks, uint64_t pins);
+
+/* the address of the Nth read, walks the lower 32 KB (RAM or ROM on all systems) */
+#define BENCH_TICK_ADDR(i) ((uint16_t)(((i) * 0x0107) & 0x7FFF))
+
+#define BENCH_TICK_DIRECT_M6502(name, tick) \
+static uint64_t name(uint32_t num) { \
+    uint64_t pins = M6502_RW; \
+    uint64_t hash = 0; \
+    for (uint32_t i = 0; i < num; i++) { \
+        M6502_SET_ADDR(pins, BENCH_TICK_ADDR(i)); \
+        pins = tick(pins); \
+        hash = (hash * 31) ^ M6502_GET_DATA(pins); \
+    } \
+    return hash; \
+}
+#define BENCH_TICK_DIRECT_Z80(name, tick) \
+static uint64_t name(uint32_t num) { \
+    uint64_t pins = Z80_MREQ|Z80_RD; \
+    uint64_t hash = 0; \
+    for (uint32_t i = 0; i < num; i++) { \
+        Z80_SET_ADDR(pins, BENCH_TICK_ADDR(i)); \
+        pins = tick(3, pins); \
+        hash = (hash * 31) ^ Z80_GET_DATA(pins); \
+    } \
+    return hash; \
+}
+BENCH_TICK_DIRECT_M6502(atom_direct_ticks, atom_cpu_tick)
+BENCH_TICK_DIRECT_M6502(c64_direct_ticks, c64_cpu_tick)
+BENCH_TICK_DIRECT_Z80(cpc_direct_ticks, cpc_cpu_tick)
+BENCH_TICK_DIRECT_Z80(kc87_direct_ticks, kc87_tick)
+BENCH_TICK_DIRECT_Z80(mz800_direct_ticks, mz800_cpu_tick)
+BENCH_TICK_DIRECT_Z80(z1013_direct_ticks, z1013_tick)
+BENCH_TICK_DIRECT_Z80(zx_direct_ticks, zx_cpu_tick)
+
+/* the runtime-pointer path, the pointer is read through a volatile so that it can't be devirtualized */
+static volatile bench_m6502_tick_t bench_m6502_tick_ptr;
+static volatile bench_z80_tick_t bench_z80_tick_ptr;
+static uint64_t bench_m6502_pointer_ticks(uint32_t num) {
+    const bench_m6502_tick_t tick = bench_m6502_tick_ptr;
+    uint64_t pins = M6502_RW;
+    uint64_t hash = 0;
+    for (uint32_t i = 0; i < num; i++) {
+        M6502_SET_ADDR(pins, BENCH_TICK_ADDR(i));
+        pins = tick(pins);
+        hash = (hash * 31) ^ M6502_GET_DATA(pins);
+    }
+    return hash;
+}
+static uint64_t bench_z80_pointer_ticks(uint32_t num) {
+    const bench_z80_tick_t tick = bench_z80_tick_ptr;
+    uint64_t pins = Z80_MREQ|Z80_RD;
+    uint64_t hash = 0;
+    for (uint32_t i = 0; i < num; i++) {
+        Z80_SET_ADDR(pins, BENCH_TICK_ADDR(i));
+        pins = tick(3, pins);
+        hash = (hash * 31) ^ Z80_GET_DATA(pins);
+    }
+    return hash;
+}
+
+typedef struct {
+    const char* name;
+    bench_m6502_tick_t m6502_tick;      /* the tick callback of 6502 systems, or 0 */
+    bench_z80_tick_t z80_tick;          /* the tick callback of Z80 systems, or 0 */
+    uint64_t (*direct)(uint32_t num);
+} bench_tick_system_t;
+static const bench_tick_system_t tick_systems[] = {
+    { "atom", atom_cpu_tick, 0, atom_direct_ticks },
+    { "c64", c64_cpu_tick, 0, c64_direct_ticks },
+    { "cpc6128", 0, cpc_cpu_tick, cpc_direct_ticks },
+    { "kc87", 0, kc87_tick, kc87_direct_ticks },
+    { "mz800", 0, mz800_cpu_tick, mz800_direct_ticks },
+    { "z1013", 0, z1013_tick, z1013_direct_ticks },
+    { "zx128k", 0, zx_cpu_tick, zx_direct_ticks },
+};
+
+static bool bench_tick_dispatch(const bench_system_t* sys, int seconds) {
+    const bench_tick_system_t* ts = 0;
+    for (size_t i = 0; i < sizeof(tick_systems)/sizeof(tick_systems[0]); i++) {
+        if (0 == strcmp(sys->name, tick_systems[i].name)) {
+            ts = &tick_systems[i];
+        }
+    }
+    if (!ts) {
+        return true;
+    }
+    bench_m6502_tick_ptr = ts->m6502_tick;
+    bench_z80_tick_ptr = ts->z80_tick;
+    /* one tick callback per 6502 cycle, one per 3-cycle Z80 memory cycle */
+    const uint32_t num_calls = ts->m6502_tick ? (sys->freq_hz * seconds) : ((sys->freq_hz / 3) * seconds);
+    const uint32_t ticks_per_frame = sys->freq_hz / sys->frame_hz;
+    bench_instance_t inst[2];
+    bool ok = true;
+    for (int i = 0; i < 2; i++) {
+        inst[i].state = thread_aligned_calloc(sys->state_size);
+        inst[i].fb = (uint32_t*) calloc(1, sys->fb_size);
+        ok &= inst[i].state && inst[i].fb;
+    }
+    if (!ok) {
+        fprintf(stderr, "%s: out of memory\n", sys->name);
+    }
+    double ns[2] = { 0.0, 0.0 };
+    uint64_t hash[2] = { 0, 0 };
+    for (int i = 0; ok && (i < 2); i++) {
+        /* boot (the same number of ticks on both instances), exec also makes this the
+           system instance of the calling thread, which the tick callback uses
+        */
+        sys->init(inst[i].state, inst[i].fb, sys->fb_size);
+        uint32_t overrun_ticks = 0;
+        for (uint32_t f = 0; f < sys->frame_hz; f++) {
+            const uint32_t ticks_to_run = ticks_per_frame - overrun_ticks;
+            overrun_ticks = sys->exec(inst[i].state, ticks_to_run) - ticks_to_run;
+        }
+        const uint64_t start = stm_now();
+        if (0 == i) {
+            hash[i] = ts->m6502_tick ? bench_m6502_pointer_ticks(num_calls) : bench_z80_pointer_ticks(num_calls);
+        }
+        else {
+            hash[i] = ts->direct(num_calls);
+        }
+        ns[i] = stm_ns(stm_since(start)) / num_calls;
+    }
+    if (ok) {
+        ok = (hash[0] == hash[1]);
+        printf("%-10s tick dispatch: pointer %6.2f ns/call, direct %6.2f ns/call, %5.2fx, %s\n",
+            sys->name, ns[0], ns[1], (ns[1] > 0.0) ? (ns[0] / ns[1]) : 0.0, ok ? "ok" : "MISMATCH");
+    }
+    for (int i = 0; i < 2; i++) {
+        thread_aligned_free(inst[i].state);
+        free(inst[i].fb);
+    }
+    return ok;
+}
+
+#define BENCH_NUM_CLONES (64)
+
+/* print the private and resident KB per instance, averaged over a number of instances */
+static void bench_print_pages(const char* what, const clone_pages_t* pages, int num) {
+    if (pages->valid) {
+        printf(", %s %7.1f KB private %7.1f KB resident", what,
+            (pages->private_pages * (double)pages->page_size) / (1024.0 * num),
+            (pages->resident * (double)pages->page_size) / (1024.0 * num));
+    }
+    else {
+        printf(", %s n/a", what);
+    }
+}
+
+/* boot an instance, clone a number of copy-on-write instances from its
+   snapshot, and report their private and resident pages after cloning and
+   after running each clone for a frame, the first clone must continue
+   identically to an instance restored from the same snapshot
+*/
+static bool bench_clone(const bench_system_t* sys, int seconds) {
+    if (!sys->clone_base) {
+        return true;
+    }
+    const uint32_t ticks_per_frame = sys->freq_hz / sys->frame_hz;
+    const uint32_t snapshot_size = sys->snapshot_size();
+    bench_instance_t a = { .state = thread_aligned_calloc(sys->state_size), .fb = (uint32_t*) calloc(1, sys->fb_size) };
+    bench_instance_t b = { .state = thread_aligned_calloc(sys->state_size), .fb = (uint32_t*) calloc(1, sys->fb_size) };
+    bench_instance_t clones[BENCH_NUM_CLONES];
+    memset(clones, 0, sizeof(clones));
+    uint8_t* buf = (uint8_t*) malloc(snapshot_size);
+    clone_base_t base;
+    bool ok = a.state && a.fb && b.state && b.fb && buf;
+    if (ok) {
+        bench_run_instance(sys, &a, seconds * sys->frame_hz);
+        ok = (snapshot_size == sys->save_snapshot(a.state, buf, snapshot_size));
+        ok = ok && sys->clone_base(&base, buf, snapshot_size);
+    }
+    if (!ok) {
+        fprintf(stderr, "%s: failed to create the clone base\n", sys->name);
+        thread_aligned_free(a.state); free(a.fb);
+        thread_aligned_free(b.state); free(b.fb);
+        free(buf);
+        return false;
+    }
+    sys->init(b.state, b.fb, sys->fb_size);
+    ok = sys->load_snapshot(b.state, buf, snapshot_size);
+
+    uint64_t start = stm_now();
+    for (int i = 0; (i < BENCH_NUM_CLONES) && ok; i++) {
+        clones[i].fb = (uint32_t*) calloc(1, sys->fb_size);
+        clones[i].state = clones[i].fb ? sys->clone(&base, clones[i].fb, sys->fb_size) : 0;
+        ok = 0 != clones[i].state;
+    }
+    const double clone_us = stm_us(stm_since(start)) / BENCH_NUM_CLONES;
+    clone_pages_t idle = { 0 }, busy = { 0 };
+    if (ok) {
+        for (int i = 0; i < BENCH_NUM_CLONES; i++) {
+            const clone_pages_t p = clone_pages(clones[i].state, sys->state_size);
+            idle.valid = p.valid;
+            idle.page_size = p.page_size;
+            idle.resident += p.resident;
+            idle.private_pages += p.private_pages;
+        }
+        /* the first clone must behave like the restored instance */
+        ok = sys->exec(b.state, ticks_per_frame) == sys->exec(clones[0].state, ticks_per_frame);
+        ok &= 0 == memcmp(b.fb, clones[0].fb, sys->fb_size);
+        for (int i = 1; i < BENCH_NUM_CLONES; i++) {
+            sys->exec(clones[i].state, ticks_per_frame);
+        }
+        for (int i = 0; i < BENCH_NUM_CLONES; i++) {
+            const clone_pages_t p = clone_pages(clones[i].state, sys->state_size);
+            busy.valid = p.valid;
+            busy.page_size = p.page_size;
+            busy.resident += p.resident;
+            busy.private_pages += p.private_pages;
+        }
+        printf("%-10s clone %3d instances of %4u KB, %6.2f us/clone", sys->name,
+            BENCH_NUM_CLONES, (unsigned)(sys->state_size / 1024), clone_us);
+        bench_print_pages("idle", &idle, BENCH_NUM_CLONES);
+        bench_print_pages("after 1 frame", &busy, BENCH_NUM_CLONES);
+        printf(", %s\n", ok ? "ok" : "MISMATCH");
+    }
+    else {
+        fprintf(stderr, "%s: failed to clone %d instances\n", sys->name, BENCH_NUM_CLONES);
+    }
+    for (int i = 0; i < BENCH_NUM_CLONES; i++) {
+        sys->free_clone(&base, clones[i].state);
+        free(clones[i].fb);
+    }
+    clone_base_discard(&base);
+    thread_aligned_free(a.state); free(a.fb);
+    thread_aligned_free(b.state); free(b.fb);
+    free(buf);
+    return ok;
+}
+
+static int usage(const char* exe) {
+    fprintf(stderr, "usage: %s [-n instances] [-j threads] [-s] [-r] [-d] [-t] [-i] [-l] [-b] [-c] [seconds] [system]\n", exe);
+    return 10;
+}
+
+int main(int argc, char* argv[]) {
+    int seconds = 10;
+    int num_instances = 1;
+    int num_threads = 1;
+    bool snapshots = false;
+    bool rewinds = false;
+    bool decoders = false;
+    bool chiptimes = false;
+    bool idle = false;
+    bool layouts = false;
+    bool ticks = false;
+    bool clones = false;
+    const char* only = 0;
+    int pos_arg = 0;
+    for (int i = 1; i < argc; i++) {
+        if ((0 == strcmp(argv[i], "-n")) && (i+1 < argc)) {
+            num_instances = atoi(argv[++i]);
+            if (num_instances <= 0) {
+                return usage(argv[0]);
+            }
+        }
+        else if ((0 == strcmp(argv[i], "-j")) && (i+1 < argc)) {
+            num_threads = atoi(argv[++i]);
+            if (num_threads < 0) {
+                return usage(argv[0]);
+            }
+        }
+        else if (0 == strcmp(argv[i], "-s")) {
+            snapshots = true;
+        }
+        else if (0 == strcmp(argv[i], "-r")) {
+            rewinds = true;
+        }
+        else if (0 == strcmp(argv[i], "-d")) {
+            decoders = true;
+        }
+        else if (0 == strcmp(argv[i], "-t")) {
+            chiptimes = true;
+        }
+        else if (0 == strcmp(argv[i], "-i")) {
+            idle = true;
+        }
+        else if (0 == strcmp(argv[i], "-l")) {
+            layouts = true;
+        }
+        else if (0 == strcmp(argv[i], "-b")) {
+            ticks = true;
+        }
+        else if (0 == strcmp(argv[i], "-c")) {
+            clones = true;
+        }
+        else if (pos_arg == 0) {
+            seconds = atoi(argv[i]);
+            if (seconds <= 0) {
+                return usage(argv[0]);
+            }
+            pos_arg++;
+        }
+        else if (pos_arg == 1) {
+            only = argv[i];
+            pos_arg++;
+        }
+        else {
+            return usage(argv[0]);
+        }
+    }
+    if (0 == num_threads) {
+        num_threads = thread_num_cores();
+    }
+    stm_setup();
+    printf("running %d emulated seconds on %d instance(s) per system, %d thread(s)\n",
+        seconds, num_instances, num_threads);
+    int num_run = 0;
+    for (size_t i = 0; i < NUM_SYSTEMS; i++) {
+        if (!only || (0 == strcmp(only, systems[i].name))) {
+            if (!bench(&systems[i], seconds, num_instances, num_threads)) {
+                return 10;
+            }
+            if (snapshots && !bench_snapshot(&systems[i], seconds)) {
+                return 10;
+            }
+            if (rewinds && !bench_rewind(&systems[i], seconds)) {
+                return 10;
+            }
+            if (chiptimes && !bench_chiptime(&systems[i], seconds)) {
+                return 10;
+            }
+            if (layouts && !bench_layout(&systems[i], seconds)) {
+                return 10;
+            }
+            if (ticks && !bench_tick_dispatch(&systems[i], seconds)) {
+                return 10;
+            }
+            if (clones && !bench_clone(&systems[i], seconds)) {
+                return 10;
+            }
+            num_run++;
+        }
+    }
+    if (0 == num_run) {
+        fprintf(stderr, "unknown system '%s'\n", only);
+        return 10;
+    }
+    if (decoders && !(bench_decode() && bench_cpc_line_batch() && bench_atom_vdg_batch() && bench_c64_cia_lazy() && bench_kc87_ctc_batch() && bench_z80ctc_batch() && bench_decode_glyphs() && bench_decode_zx() && bench_zx_contention() && bench_mz800_gdg() && bench_audio_batch() && bench_async_video() && bench_debugger() && bench_heatmap())) {
+        return 10;
+    }
+    if (idle && !bench_idle(seconds)) {
+        return 10;
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+//------------------------------------------------------------------------------
+//  bustrace-decode.c
+//
+//  Turns a binary bus cycle trace written by common/bustrace.h (for
+//  instance by the C64 and CPC examples with -trace) into text, one
+//  line per bus cycle:
+//
+//      tick ticks addr data pins
+//
+//  Usage:
+//
+//      bustrace-decode trace-file [first-cycle] [num-cycles]
+//
+//  Positive cycle numbers count from the oldest recorded cycle, negative
+//  numbers from the end of the trace, the trigger cycle is marked with
+//  '<== TRIGGER'.
+//------------------------------------------------------------------------------
+#include "chips/z80.h"
+#include "chips/m6502.h"
+#include "common/bustrace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+typedef struct {
+    uint64_t mask;
+    const char* name;
+} pin_name_t;
+
+static const pin_name_t z80_pins[] = {
+    { Z80_M1, "M1" }, { Z80_MREQ, "MREQ" }, { Z80_IORQ, "IORQ" }, { Z80_RD, "RD" },
+    { Z80_WR, "WR" }, { Z80_HALT, "HALT" }, { Z80_INT, "INT" }, { Z80_RETI, "RETI" },
+};
+static const pin_name_t m6502_pins[] = {
+    { M6502_SYNC, "SYNC" }, { M6502_IRQ, "IRQ" }, { M6502_NMI, "NMI" }, { M6502_RDY, "RDY" },
+    { M6502_AEC, "AEC" }, { M6502_RES, "RES" },
+};
+
+static void print_entry(int cpu, const bustrace_entry_t* e, uint64_t tick) {
+    printf("%12"PRIu64" %3u  ", tick, e->num_ticks);
+    if (cpu == BUSTRACE_CPU_Z80) {
+        printf("%04X %02X ", Z80_GET_ADDR(e->pins), Z80_GET_DATA(e->pins));
+        for (size_t i = 0; i < sizeof(z80_pins)/sizeof(z80_pins[0]); i++) {
+            if (e->pins & z80_pins[i].mask) {
+                printf(" %s", z80_pins[i].name);
+            }
+        }
+        if (Z80_GET_WAIT(e->pins)) {
+            printf(" WAIT:%d", (int)Z80_GET_WAIT(e->pins));
+        }
+    }
+    else {
+        printf("%04X %02X  %s", M6502_GET_ADDR(e->pins), M6502_GET_DATA(e->pins), (e->pins & M6502_RW) ? "R" : "W");
+        for (size_t i = 0; i < sizeof(m6502_pins)/sizeof(m6502_pins[0]); i++) {
+            if (e->pins & m6502_pins[i].mask) {
+                printf(" %s", m6502_pins[i].name);
+            }
+        }
+    }
+    if (e->flags & BUSTRACE_FLAG_TRIGGER) {
+        printf("  <== TRIGGER");
+    }
+    printf("\n");
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s trace-file [first-cycle] [num-cycles]\n", argv[0]);
+        return 10;
+    }
+    FILE* fp = fopen(argv[1], "rb");
+    if (!fp) {
+        fprintf(stderr, "failed to open '%s'\n", argv[1]);
+        return 10;
+    }
+    bustrace_header_t hdr;
+    if ((1 != fread(&hdr, sizeof(hdr), 1, fp)) ||
+        (hdr.magic != BUSTRACE_MAGIC) ||
+        (hdr.version != BUSTRACE_VERSION) ||
+        (hdr.entry_size != sizeof(bustrace_entry_t)) ||
+        ((hdr.cpu != BUSTRACE_CPU_Z80) && (hdr.cpu != BUSTRACE_CPU_M6502)))
+    {
+        fprintf(stderr, "'%s' is not a bus trace file\n", argv[1]);
+        fclose(fp);
+        return 10;
+    }
+    int64_t first = (argc > 2) ? strtoll(argv[2], 0, 10) : 0;
+    int64_t num = (argc > 3) ? strtoll(argv[3], 0, 10) : (int64_t)hdr.num_entries;
+    if (first < 0) {
+        first += hdr.num_entries;
+        if (first < 0) {
+            first = 0;
+        }
+    }
+    printf("%s trace, %u cycles\n", (hdr.cpu == BUSTRACE_CPU_Z80) ? "Z80" : "6502", hdr.num_entries);
+    printf("        tick ticks addr data pins\n");
+    uint64_t tick = hdr.first_tick;
+    uint32_t prev_tick = 0;
+    bustrace_entry_t e;
+    for (int64_t i = 0; (i < (int64_t)hdr.num_entries) && (i < first + num); i++) {
+        if (1 != fread(&e, sizeof(e), 1, fp)) {
+            fprintf(stderr, "trace file truncated at cycle %"PRId64"\n", i);
+            fclose(fp);
+            return 10;
+        }
+        /* extend the 32-bit tick counters to 64 bits */
+        if (i > 0) {
+            tick += (uint32_t)(e.tick - prev_tick);
+        }
+        prev_tick = e.tick;
+        if (i >= first) {
+            print_entry(hdr.cpu, &e, tick);
+        }
+    }
+    fclose(fp);
+    return 0;
+}
@@ -1,58 +1,268 @@
 /*
     c64.c
-    SID is emulated, but there's no sound output. No tape or disc emulation.
+    No tape or disc emulation.
     The original is part of the YAKC emulator: https://github.com/floooh/yakc
+
+    The actual emulator is in systems/c64.h, this is just the
+    sokol-app shell around it.
+
+    Hold PageUp to rewind, press PageDown to cycle the run-ahead
+    frames (0..2) which hides input latency.
+
+    '-telemetry' shows the emulated speed, the emulation, decode and upload
+    times, overrun ticks and audio buffer fill in an overlay and logs them
+    every 5 seconds, '-telemetry-log' only logs them.
+
+    Key events go through a cycle-stamped input queue (common/inputq.h),
+    '-input-record file' writes them into an input log, '-input-replay file'
+    replays such a log instead of the keyboard input.
+
+    On startup, the post-boot snapshot c64.boot (written by the build) is
+    restored instead of a cold boot, '-coldboot' forces a cold boot.
 */
 #include "sokol_app.h"
 #include "sokol_time.h"
 #define CHIPS_IMPL
-#include "chips/m6502.h"
-#include "chips/m6526.h"
-#include "chips/m6569.h"
-#include "chips/m6581.h"
-#include "chips/kbd.h"
-#include "chips/mem.h"
-#include "roms/c64-roms.h"
+#include "systems/c64.h"
 #include "common/gfx.h"
+#include "common/romfile.h"
+#include "common/bustrace.h"
+#include "common/debugger.h"
+#include "common/heatmap.h"
+#include "common/warp.h"
+#include "common/rewind.h"
+#include "common/audio.h"
+#include "common/inputq.h"
+#include "common/quickload.h"
+#include "common/bootsnap.h"
+#include "common/framepace.h"
+#include "common/telemetry.h"
+#include <stdlib.h> /* malloc, free */
+#include <string.h> /* strcmp */
 #include <ctype.h> /* isupper, islower, toupper, tolower */
 
-/* C64 (PAL) emulator state and callbacks */
-#define C64_FREQ (985248)
-#define C64_DISP_X (64)
-#define C64_DISP_Y (24)
-#define C64_DISP_WIDTH (392)
-#define C64_DISP_HEIGHT (272)
-
-typedef struct {
-    m6502_t cpu;
-    m6526_t cia_1;
-    m6526_t cia_2;
-    m6569_t vic;
-    m6581_t sid;
-    kbd_t kbd;                  // keyboard matrix
-    mem_t mem_cpu;              // how the CPU sees memory
-    mem_t mem_vic;              // how the VIC sees memory
-    uint8_t cpu_port;           // last state of CPU port (for memory mapping)
-    uint16_t vic_bank_select;   // upper 4 address bits from CIA-2 port A
-    bool io_mapped;             // true when D000..DFFF is has IO area mapped in
-    uint8_t color_ram[1024];    // special static color ram
-    uint8_t ram[1<<16];         // general ram
-} c64_t;
 c64_t c64;
-
 uint32_t overrun_ticks;
 uint64_t last_time_stamp;
+warp_t warp;
+
+/* frame pacing, '-framelock' runs exactly one emulated frame per host frame
+   when the display refresh matches the C64's, see common/framepace.h
+*/
+bool frame_lock;
+framepace_t pace;
+
+/* optional performance telemetry, '-telemetry' shows the min/avg/max over the
+   last frames in an overlay and logs them every few seconds, '-telemetry-log'
+   only logs them, see common/telemetry.h
+*/
+#define TELEMETRY_LOG_SEC (5.0)
+bool telemetry_enabled;
+bool telemetry_overlay;
+telemetry_t telemetry;
+double telemetry_sec;   /* wall-clock time since the last telemetry sample */
+void push_telemetry(uint32_t ticks_executed, uint64_t emu_time) {
+    const gfx_stats_t gfx = gfx_stats();
+    const audio_stats_t audio = audio_stats();
+    const bool refreshed = telemetry_push(&telemetry, &(telemetry_sample_t){
+        .frame_sec = telemetry_sec,
+        .ticks = ticks_executed,
+        .emu_ms = stm_ms(emu_time),
+        .decode_ms = gfx.last_decode_ms,
+        .upload_ms = gfx.last_upload_ms,
+        .overrun_ticks = overrun_ticks,
+        .audio_fill_ms = audio.fill_ms
+    });
+    telemetry_sec = 0.0;
+    if (refreshed && telemetry_overlay) {
+        gfx_set_overlay(telemetry_text(&telemetry));
+    }
+}
+
+/* optional ROM directory ('-roms dir' command line arg), files are memory-mapped */
+const char* rom_dir;
+romfile_t rom_char, rom_basic, rom_kernal;
+
+/* optional PC-sampling profiler ('-prof' and '-labels file' command line args), reported at exit */
+pcprof_t* prof;
+pcprof_labels_t prof_labels;
+
+/* optional bus cycle trace ('-trace' command line arg), press Insert to save the
+   last cycles to 'c64.trace', with '-trace-pc addr' the trace is saved
+   automatically after the CPU executed the instruction at addr (hex)
+*/
+#define TRACE_NUM_ENTRIES (1<<20)
+bustrace_t trace;
+bustrace_entry_t* trace_buffer;
+void save_trace(void) {
+    const char* path = "c64.trace";
+    if (bustrace_save(&trace, path)) {
+        printf("saved %u bus cycles to '%s'\n", bustrace_num_entries(&trace), path);
+    }
+    else {
+        printf("failed to write '%s'\n", path);
+    }
+}
+
+/* optional breakpoints and watchpoints ('-break addr', '-watch addr' and
+   '-watch-rd addr' command line args, hex), the emulation pauses after the
+   frame which hit one, press Home to continue
+*/
+dbg_t* debugger;
+bool debugger_paused;
+void check_debugger(void) {
+    if (debugger && dbg_stopped(debugger)) {
+        dbg_print_hit(debugger);
+        printf("debugger: paused, press Home to continue\n");
+        dbg_resume(debugger);
+        debugger_paused = true;
+    }
+}
+/* hits in re-run or run-ahead frames are ignored */
+void ignore_debugger(void) {
+    if (debugger) {
+        dbg_resume(debugger);
+    }
+}
+bool add_debugger_arg(const char* arg, const char* addr_str) {
+    uint16_t addr;
+    if (!dbg_parse_addr(addr_str, &addr)) {
+        printf("invalid address '%s' for %s\n", addr_str, arg);
+        return false;
+    }
+    if (!debugger) {
+        debugger = (dbg_t*) malloc(sizeof(dbg_t));
+        dbg_init(debugger);
+    }
+    bool ok;
+    if (0 == strcmp(arg, "-break")) {
+        ok = dbg_add_breakpoint(debugger, addr);
+    }
+    else {
+        ok = dbg_add_watchpoint(debugger, addr, 1, (0 == strcmp(arg, "-watch-rd")) ? DBG_WATCH_READ : DBG_WATCH_WRITE);
+    }
+    if (!ok) {
+        printf("too many breakpoints or watchpoints\n");
+    }
+    return ok;
+}
+
+/* optional per-page memory access counters ('-heatmap prefix' command line
+   arg), written to prefix.csv and prefix.ppm on exit
+*/
+const char* heatmap_prefix;
+heatmap_t* heatmap;
+void save_heatmap(void) {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s.csv", heatmap_prefix);
+    const bool csv_ok = heatmap_save_csv(heatmap, path);
+    snprintf(path, sizeof(path), "%s.ppm", heatmap_prefix);
+    const bool ppm_ok = heatmap_save_ppm(heatmap, path);
+    printf("%s memory access heatmap to '%s.csv' and '%s.ppm'\n", (csv_ok && ppm_ok) ? "saved" : "failed to save", heatmap_prefix, heatmap_prefix);
+}
+
+#if defined(CHIPS_CHIPTIME)
+/* per-chip host time accounting, a breakdown is printed every 300 frames */
+chiptime_t chiptime;
+#endif
+
+/* rewind history and run-ahead */
+#define REWIND_BUFFER_SIZE (8 * 1024 * 1024)
+#define REWIND_MAX_FRAMES (5 * 60 * 60)
+#define RUNAHEAD_MAX_FRAMES (2)
+rewind_t history;
+uint8_t* snapshot;
+bool rewinding;
+int runahead_frames;
+bool audio_muted;
+
+/* forward audio samples to the audio backend, except when re-running frames */
+void app_audio(const float* samples, int num_samples) {
+    if (!audio_muted) {
+        audio_push(samples, num_samples);
+    }
+}
 
-void c64_init(void);
-void c64_update_memory_map(void);
-uint64_t c64_cpu_tick(uint64_t pins);
-uint8_t c64_cpu_port_in(void);
-void c64_cpu_port_out(uint8_t data);
-void c64_cia1_out(int port_id, uint8_t data);
-uint8_t c64_cia1_in(int port_id);
-void c64_cia2_out(int port_id, uint8_t data);
-uint8_t c64_cia2_in(int port_id);
-uint16_t c64_vic_fetch(uint16_t addr);
+/* cycle-stamped key events, optionally recorded into or replayed from an input log */
+inputq_t inputq;
+const char* input_record_path;
+const char* input_replay_path;
+
+uint32_t input_exec(void* user_data, uint32_t ticks) {
+    (void)user_data;
+    return c64_exec(&c64, ticks);
+}
+
+void input_key(void* user_data, int key, bool down) {
+    (void)user_data;
+    if (down) {
+        kbd_key_down(&c64.kbd, key);
+    }
+    else {
+        kbd_key_up(&c64.kbd, key);
+    }
+}
+
+void input_update(void* user_data) {
+    (void)user_data;
+    kbd_update(&c64.kbd);
+}
+
+/* post-boot snapshot, restored on startup instead of a cold boot unless
+   '-coldboot' or '-roms dir' is given ('-boot file' overrides the path),
+   '-save-boot file' boots headless and writes it (done by the build)
+*/
+#define BOOT_TICKS (C64_FREQ * 3)
+const char* boot_path = "c64.boot";
+const char* save_boot_path;
+bool cold_boot;
+bool booted;
+bool save_boot_snapshot(void) {
+    c64_init(&c64, &(c64_desc_t){
+        .rgba8_buffer = rgba8_buffer,
+        .rgba8_buffer_size = sizeof(rgba8_buffer),
+        .audio_sample_rate = BOOTSNAP_SAMPLE_RATE
+    });
+    c64_exec(&c64, BOOT_TICKS);
+    const uint32_t size = c64_snapshot_size();
+    uint8_t* buf = (uint8_t*) malloc(size);
+    const bool ok = (size == c64_save_snapshot(&c64, buf, size)) && bootsnap_save(save_boot_path, BOOTSNAP_SAMPLE_RATE, buf, size);
+    free(buf);
+    printf("%s post-boot snapshot '%s'\n", ok ? "wrote" : "failed to write", save_boot_path);
+    return ok;
+}
+bool restore_boot_snapshot(void) {
+    uint32_t size;
+    uint8_t* buf = bootsnap_load(boot_path, audio_sample_rate(), &size);
+    const bool ok = buf && c64_load_snapshot(&c64, buf, size);
+    if (buf && !ok) {
+        printf("post-boot snapshot '%s' doesn't match this build, cold booting\n", boot_path);
+    }
+    free(buf);
+    return ok;
+}
+
+/* optional program to load ('-load file.prg' command line arg), without a
+   post-boot snapshot the system boots unthrottled before the program is
+   copied into memory
+*/
+const char* load_path;
+void load_program(void) {
+    uint32_t size;
+    uint8_t* data = quickload_read(load_path, &size);
+    if (data && !booted) {
+        audio_muted = true;
+        c64_exec(&c64, BOOT_TICKS);
+        audio_muted = false;
+    }
+    if (!data || !c64_quickload(&c64, data, size)) {
+        printf("failed to load '%s'\n", load_path);
+    }
+    free(data);
+}
+
+/* optional frame capture ('-capture file.raw' or '-capture prefix' for a PNG sequence) */
+const char* capture_path;
 
 /* sokol-app entry, configure application callbacks and window */
 void app_init(void);
@@ -61,6 +271,72 @@ void app_input(const sapp_event*);
 void app_cleanup(void);
 
 sapp_desc sokol_main(int argc, char* argv[]) {
+    #if !defined(__EMSCRIPTEN__)
+    for (int i = 1; i < argc; i++) {
+        if ((0 == strcmp(argv[i], "-roms")) && (i+1 < argc)) {
+            rom_dir = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "-capture")) && (i+1 < argc)) {
+            capture_path = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "-trace")) && !trace_buffer) {
+            trace_buffer = (bustrace_entry_t*) malloc(TRACE_NUM_ENTRIES * sizeof(bustrace_entry_t));
+            bustrace_init(&trace, BUSTRACE_CPU_M6502, trace_buffer, TRACE_NUM_ENTRIES);
+        }
+        else if ((0 == strcmp(argv[i], "-trace-pc")) && trace_buffer && (i+1 < argc)) {
+            const uint64_t addr = strtoul(argv[++i], 0, 16) & 0xFFFF;
+            bustrace_set_trigger(&trace, M6502_SYNC|0xFFFF, M6502_SYNC|addr, TRACE_NUM_ENTRIES / 2);
+        }
+        else if (0 == strcmp(argv[i], "-prof")) {
+            prof = (pcprof_t*) malloc(sizeof(pcprof_t));
+            pcprof_init(prof, PCPROF_DEFAULT_INTERVAL);
+        }
+        else if ((0 == strcmp(argv[i], "-labels")) && (i+1 < argc)) {
+            if (!pcprof_load_labels(&prof_labels, argv[++i])) {
+                printf("failed to load label file '%s'\n", argv[i]);
+            }
+        }
+        else if (((0 == strcmp(argv[i], "-break")) || (0 == strcmp(argv[i], "-watch")) || (0 == strcmp(argv[i], "-watch-rd"))) && (i+1 < argc)) {
+            add_debugger_arg(argv[i], argv[i+1]);
+            i++;
+        }
+        else if ((0 == strcmp(argv[i], "-load")) && (i+1 < argc)) {
+            load_path = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "-boot")) && (i+1 < argc)) {
+            boot_path = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "-save-boot")) && (i+1 < argc)) {
+            save_boot_path = argv[++i];
+        }
+        else if (0 == strcmp(argv[i], "-coldboot")) {
+            cold_boot = true;
+        }
+        else if (0 == strcmp(argv[i], "-framelock")) {
+            frame_lock = true;
+        }
+        else if (0 == strcmp(argv[i], "-telemetry")) {
+            telemetry_enabled = telemetry_overlay = true;
+        }
+        else if (0 == strcmp(argv[i], "-telemetry-log")) {
+            telemetry_enabled = true;
+        }
+        else if ((0 == strcmp(argv[i], "-heatmap")) && (i+1 < argc) && !heatmap) {
+            heatmap_prefix = argv[++i];
+            heatmap = (heatmap_t*) malloc(sizeof(heatmap_t));
+            heatmap_init(heatmap);
+        }
+        else if ((0 == strcmp(argv[i], "-input-record")) && (i+1 < argc)) {
+            input_record_path = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "-input-replay")) && (i+1 < argc)) {
+            input_replay_path = argv[++i];
+        }
+    }
+    if (save_boot_path) {
+        exit(save_boot_snapshot() ? 0 : 10);
+    }
+    #endif
     return (sapp_desc) {
         .init_cb = app_init,
         .frame_cb = app_frame,
@@ -74,24 +350,164 @@ sapp_desc sokol_main(int argc, char* argv[]) {
 
 /* one-time application init */
 void app_init(void) {
+    #if defined(CHIPS_CHIPTIME)
+    chiptime_init(&chiptime, &(chiptime_desc_t){
+        .name = "C64",
+        .slot_names = { C64_CHIPTIME_NAMES },
+        .num_slots = C64_CHIPTIME_NUM,
+        .report_frames = 300
+    });
+    #endif
+    audio_init(0);
     gfx_init(C64_DISP_WIDTH, C64_DISP_HEIGHT);
-    c64_init();
+    if (capture_path) {
+        gfx_enable_capture(capture_path);
+    }
+    c64_init(&c64, &(c64_desc_t){
+        .rgba8_buffer = rgba8_buffer,
+        .rgba8_buffer_size = sizeof(rgba8_buffer),
+        .audio_cb = app_audio,
+        .audio_sample_rate = audio_sample_rate(),
+        .rom_char = romfile_load(&rom_char, rom_dir, "c64_char.bin", dump_c64_char, sizeof(dump_c64_char)),
+        .rom_basic = romfile_load(&rom_basic, rom_dir, "c64_basic.bin", dump_c64_basic, sizeof(dump_c64_basic)),
+        .rom_kernal = romfile_load(&rom_kernal, rom_dir, "c64_kernalv3.bin", dump_c64_kernalv3, sizeof(dump_c64_kernalv3)),
+        .prof = prof,
+        .trace = trace_buffer ? &trace : 0,
+        .dbg = debugger,
+        .heatmap = heatmap,
+        #if defined(CHIPS_CHIPTIME)
+        .chiptime = &chiptime,
+        #endif
+    });
+    if (!cold_boot && !rom_dir) {
+        booted = restore_boot_snapshot();
+    }
+    if (load_path) {
+        load_program();
+    }
+    snapshot = (uint8_t*) malloc(c64_snapshot_size());
+    rewind_init(&history, &(rewind_desc_t){
+        .snapshot_size = c64_snapshot_size(),
+        .buffer_size = REWIND_BUFFER_SIZE,
+        .max_frames = REWIND_MAX_FRAMES
+    });
+    inputq_init(&inputq, &(inputq_desc_t){
+        .exec_cb = input_exec,
+        .key_cb = input_key,
+        .update_cb = input_update,
+        .update_ticks = C64_FREQ / 50
+    });
+    if (input_record_path && !inputq_record(&inputq, input_record_path)) {
+        printf("failed to create input log '%s'\n", input_record_path);
+    }
+    if (input_replay_path && !inputq_replay(&inputq, input_replay_path)) {
+        printf("failed to load input log '%s'\n", input_replay_path);
+    }
+    framepace_init(&pace, &(framepace_desc_t){
+        .freq_hz = C64_FREQ,
+        .frame_ticks = C64_FRAME_TICKS,
+        .lock = frame_lock
+    });
+    if (telemetry_enabled) {
+        telemetry_init(&telemetry, &(telemetry_desc_t){
+            .name = "c64",
+            .freq_hz = C64_FREQ,
+            .log_interval_sec = TELEMETRY_LOG_SEC
+        });
+    }
     last_time_stamp = stm_now();
 }
 
+/* run one emulated frame in warp mode (the video chip always renders its output) */
+void warp_frame(bool decode) {
+    (void)decode;
+    inputq_exec(&inputq, C64_FREQ / 50);
+}
+
 /* per frame stuff, tick the emulator, handle input, decode and draw emulator display */
 void app_frame(void) {
+    #if defined(CHIPS_CHIPTIME)
+    chiptime_frame(&chiptime);
+    #endif
+    if (trace_buffer && bustrace_stopped(&trace) && trace.triggered) {
+        /* the trigger hit in the last frame, save once */
+        save_trace();
+        trace.triggered = false;
+    }
+    if (debugger_paused) {
+        /* stopped at a breakpoint or watchpoint */
+        stm_laptime(&last_time_stamp);
+        overrun_ticks = 0;
+        gfx_draw();
+        return;
+    }
     double frame_time = stm_sec(stm_laptime(&last_time_stamp));
     /* skip long pauses when the app was suspended */
     if (frame_time > 0.1) {
         frame_time = 0.1;
     }
-    uint32_t ticks_to_run = (uint32_t) ((C64_FREQ * frame_time) - overrun_ticks);
-    uint32_t ticks_executed = m6502_exec(&c64.cpu, ticks_to_run);
+    if (warp.enabled) {
+        /* run as fast as possible, and only present the last frame */
+        warp_run(&warp, warp_frame, 1.0 / 50.0);
+        check_debugger();
+        gfx_draw();
+        return;
+    }
+    const uint32_t snapshot_size = c64_snapshot_size();
+    if (rewinding) {
+        /* step back one frame, and run a single frame to regenerate the display */
+        if (history.num_frames > 1) {
+            rewind_pop(&history, 1);
+        }
+        if (rewind_get(&history, 0, snapshot)) {
+            c64_load_snapshot(&c64, snapshot, snapshot_size);
+            audio_muted = true;
+            c64_exec(&c64, C64_FREQ / 50);
+            audio_muted = false;
+            ignore_debugger();
+            gfx_draw();
+            c64_load_snapshot(&c64, snapshot, snapshot_size);
+            overrun_ticks = 0;
+            return;
+        }
+    }
+    telemetry_sec += frame_time;
+    const uint32_t budget = framepace_ticks(&pace, frame_time);
+    const audio_stats_t audio = audio_stats();
+    audio_set_resample_ratio(framepace_resample_ratio(&pace, audio.fill, 2 * audio.buffer_frames));
+    if (budget <= overrun_ticks) {
+        /* locked to a faster display, present the last emulated frame again */
+        overrun_ticks -= budget;
+        gfx_draw();
+        return;
+    }
+    const uint64_t emu_start = stm_now();
+    uint32_t ticks_to_run = budget - overrun_ticks;
+    uint32_t ticks_executed = inputq_exec(&inputq, ticks_to_run);
     assert(ticks_executed >= ticks_to_run);
     overrun_ticks = ticks_executed - ticks_to_run;
-    kbd_update(&c64.kbd);
+    check_debugger();
+    c64_save_snapshot(&c64, snapshot, snapshot_size);
+    rewind_push(&history, snapshot);
+    if (runahead_frames > 0) {
+        /* display the state N frames ahead, then roll back */
+        audio_muted = true;
+        c64_exec(&c64, runahead_frames * (C64_FREQ / 50));
+        audio_muted = false;
+        ignore_debugger();
+        const uint64_t emu_time = stm_since(emu_start);
+        gfx_draw();
+        c64_load_snapshot(&c64, snapshot, snapshot_size);
+        if (telemetry_enabled) {
+            push_telemetry(ticks_executed, emu_time);
+        }
+        return;
+    }
+    const uint64_t emu_time = stm_since(emu_start);
     gfx_draw();
+    if (telemetry_enabled) {
+        push_telemetry(ticks_executed, emu_time);
+    }
 }
 
 /* keyboard input handling */
@@ -109,12 +525,39 @@ void app_input(const sapp_event* event) {
                 else if (islower(c)) {
                     c = toupper(c);
                 }
-                kbd_key_down(&c64.kbd, c);
-                kbd_key_up(&c64.kbd, c);
+                inputq_push(&inputq, c, true);
+                inputq_push(&inputq, c, false);
             }
             break;
         case SAPP_EVENTTYPE_KEY_DOWN:
         case SAPP_EVENTTYPE_KEY_UP:
+            if ((event->key_code == SAPP_KEYCODE_END) && (event->type == SAPP_EVENTTYPE_KEY_DOWN)) {
+                /* toggle warp mode */
+                warp_enable(&warp, !warp.enabled);
+                audio_set_muted(warp.enabled);
+                break;
+            }
+            if (event->key_code == SAPP_KEYCODE_PAGE_UP) {
+                rewinding = (event->type == SAPP_EVENTTYPE_KEY_DOWN);
+                break;
+            }
+            if ((event->key_code == SAPP_KEYCODE_PAGE_DOWN) && (event->type == SAPP_EVENTTYPE_KEY_DOWN)) {
+                runahead_frames = (runahead_frames + 1) % (RUNAHEAD_MAX_FRAMES + 1);
+                break;
+            }
+            if ((event->key_code == SAPP_KEYCODE_HOME) && (event->type == SAPP_EVENTTYPE_KEY_DOWN)) {
+                /* continue after a breakpoint or watchpoint */
+                debugger_paused = false;
+                break;
+            }
+            if ((event->key_code == SAPP_KEYCODE_INSERT) && (event->type == SAPP_EVENTTYPE_KEY_DOWN)) {
+                /* save the bus trace and continue recording */
+                if (trace_buffer) {
+                    save_trace();
+                    bustrace_restart(&trace);
+                }
+                break;
+            }
             switch (event->key_code) {
                 case SAPP_KEYCODE_SPACE:        c = 0x20; break;
                 case SAPP_KEYCODE_LEFT:         c = 0x08; break;
@@ -135,12 +578,7 @@ void app_input(const sapp_event* event) {
                 default:                        c = 0; break;
             }
             if (c) {
-                if (event->type == SAPP_EVENTTYPE_KEY_DOWN) {
-                    kbd_key_down(&c64.kbd, c);
-                }
-                else {
-                    kbd_key_up(&c64.kbd, c);
-                }
+                inputq_push(&inputq, c, event->type == SAPP_EVENTTYPE_KEY_DOWN);
             }
             break;
         default:
@@ -150,407 +588,26 @@ void app_input(const sapp_event* event) {
 
 /* application cleanup callback */
 void app_cleanup(void) {
-    gfx_shutdown();
-}
-
-/* C64 emulator init */
-void c64_init(void) {
-    c64.cpu_port = 0xF7;        // for initial memory configuration
-    c64.io_mapped = true;
-
-    /* initialize the CPU */
-    m6502_init(&c64.cpu, &(m6502_desc_t){
-        .tick_cb = c64_cpu_tick,
-        .in_cb = c64_cpu_port_in,
-        .out_cb = c64_cpu_port_out,
-        .m6510_io_pullup = 0x17,
-        .m6510_io_floating = 0xC8
-    });
-
-    /* initialize the CIAs */
-    m6526_init(&c64.cia_1, c64_cia1_in, c64_cia1_out);
-    m6526_init(&c64.cia_2, c64_cia2_in, c64_cia2_out);
-
-    /* initialize the VIC-II display chip */
-    m6569_init(&c64.vic, &(m6569_desc_t){
-        .fetch_cb = c64_vic_fetch,
-        .rgba8_buffer = rgba8_buffer,
-        .rgba8_buffer_size = sizeof(rgba8_buffer),
-        .vis_x = C64_DISP_X,
-        .vis_y = C64_DISP_Y,
-        .vis_w = C64_DISP_WIDTH,
-        .vis_h = C64_DISP_HEIGHT
-    });
-
-    /* initialize the SID audio chip */
-    m6581_init(&c64.sid, &(m6581_desc_t){
-        .tick_hz = C64_FREQ,
-        .sound_hz = 44100,
-        .magnitude = 1.0
-    });
-
-    /* initial memory map
-
-        the C64 has a weird RAM init pattern of 64 bytes 00 and 64 bytes FF
-        alternating, probably with some randomness sprinkled in
-        (see this thread: http://csdb.dk/forums/?roomid=11&topicid=116800&firstpost=2)
-        this is important at least for the value of the 'ghost byte' at 0x3FFF,
-        which is 0xFF
-    */
-    for (int i = 0; i < (1<<16); i++) {
-        c64.ram[i] = (i & (1<<6)) ? 0xFF : 0x00;
-    }
-
-    /* setup the initial CPU memory map
-       0000..9FFF and C000.CFFF is always RAM
-    */
-    mem_map_ram(&c64.mem_cpu, 0, 0x0000, 0xA000, c64.ram);
-    mem_map_ram(&c64.mem_cpu, 0, 0xC000, 0x1000, c64.ram+0xC000);
-    /* A000..BFFF, D000..DFFF and E000..FFFF are configurable */
-    c64_update_memory_map();
-
-    /* setup the separate VIC-II memory map (64 KByte RAM) overlayed with
-       character ROMS at 0x1000.0x1FFF and 0x9000..0x9FFF
-    */
-    mem_map_ram(&c64.mem_vic, 1, 0x0000, 0x10000, c64.ram);
-    mem_map_rom(&c64.mem_vic, 0, 0x1000, 0x1000, dump_c64_char);
-    mem_map_rom(&c64.mem_vic, 0, 0x9000, 0x1000, dump_c64_char);
-
-    /* put the CPU into start state */
-    m6502_reset(&c64.cpu);
-
-    /* setup the keyboard matrix
-        http://sta.c64.org/cbm64kbdlay.html
-        http://sta.c64.org/cbm64petkey.html
-    */
-    kbd_init(&c64.kbd, 1);
-    const char* keymap =
-        // no shift
-        "        "
-        "3WA4ZSE "
-        "5RD6CFTX"
-        "7YG8BHUV"
-        "9IJ0MKON"
-        "+PL-.:@,"
-        "~*;  = /"  // ~ is actually the British Pound sign
-        "1  2  Q "
-
-        // shift
-        "        "
-        "#wa$zse "
-        "%rd&cftx"
-        "'yg(bhuv"
-        ")ij0mkon"
-        " pl >[ <"
-        "$ ]    ?"
-        "!  \"  q ";
-    assert(strlen(keymap) == 128);
-    /* shift is column 7, line 1 */
-    kbd_register_modifier(&c64.kbd, 0, 7, 1);
-    /* ctrl is column 2, line 7 */
-    kbd_register_modifier(&c64.kbd, 1, 2, 7);
-    for (int shift = 0; shift < 2; shift++) {
-        for (int col = 0; col < 8; col++) {
-            for (int line = 0; line < 8; line++) {
-                int c = keymap[shift*64 + line*8 + col];
-                if (c != 0x20) {
-                    kbd_register_key(&c64.kbd, c, col, line, shift?(1<<0):0);
-                }
-            }
-        }
-    }
-
-    /* special keys */
-    kbd_register_key(&c64.kbd, 0x20, 4, 7, 0);    // space
-    kbd_register_key(&c64.kbd, 0x08, 2, 0, 1);    // cursor left
-    kbd_register_key(&c64.kbd, 0x09, 2, 0, 0);    // cursor right
-    kbd_register_key(&c64.kbd, 0x0A, 7, 0, 0);    // cursor down
-    kbd_register_key(&c64.kbd, 0x0B, 7, 0, 1);    // cursor up
-    kbd_register_key(&c64.kbd, 0x01, 0, 0, 0);    // delete
-    kbd_register_key(&c64.kbd, 0x0C, 3, 6, 1);    // clear
-    kbd_register_key(&c64.kbd, 0x0D, 1, 0, 0);    // return
-    kbd_register_key(&c64.kbd, 0x03, 7, 7, 0);    // stop
-    kbd_register_key(&c64.kbd, 0xF1, 4, 0, 0);
-    kbd_register_key(&c64.kbd, 0xF2, 4, 0, 1);
-    kbd_register_key(&c64.kbd, 0xF3, 5, 0, 0);
-    kbd_register_key(&c64.kbd, 0xF4, 5, 0, 1);
-    kbd_register_key(&c64.kbd, 0xF5, 6, 0, 0);
-    kbd_register_key(&c64.kbd, 0xF6, 6, 0, 1);
-    kbd_register_key(&c64.kbd, 0xF7, 3, 0, 0);
-    kbd_register_key(&c64.kbd, 0xF8, 3, 0, 1);
-}
-
-uint64_t c64_cpu_tick(uint64_t pins) {
-    const uint16_t addr = M6502_GET_ADDR(pins);
-
-    /* FIXME: tick the datasette, when the datasette output pulse
-       toggles, the FLAG input pin on CIA-1 will go active for 1 tick
-    */
-    uint64_t cia1_pins = pins;
-    /*
-    if (c64_tape_tick()) {
-        cia1_pins |= M6526_FLAG;
-    }
-    */
-
-    /* tick the SID */
-    if (m6581_tick(&c64.sid)) {
-        /* FIXME: new sample ready, copy to audio buffer */
-    }
-
-    /* tick the CIAs:
-        - CIA-1 gets the FLAG pin from the datasette
-        - the CIA-1 IRQ pin is connected to the CPU IRQ pin
-        - the CIA-2 IRQ pin is connected to the CPU NMI pin
-    */
-    if (m6526_tick(&c64.cia_1, cia1_pins & ~M6502_IRQ) & M6502_IRQ) {
-        pins |= M6502_IRQ;
-    }
-    if (m6526_tick(&c64.cia_2, pins & ~M6502_IRQ) & M6502_IRQ) {
-        pins |= M6502_NMI;
-    }
-
-    /* tick the VIC-II display chip:
-        - the VIC-II IRQ pin is connected to the CPU IRQ pin and goes
-        active when the VIC-II requests a rasterline interrupt
-        - the VIC-II BA pin is connected to the CPU RDY pin, and stops
-        the CPU on the first CPU read access after BA goes active
-        - the VIC-II AEC pin is connected to the CPU AEC pin, currently
-        this goes active during a badline, but is not checked
-    */
-    pins = m6569_tick(&c64.vic, pins);
-
-    /* Special handling when the VIC-II asks the CPU to stop during a
-        'badline' via the BA=>RDY pin. If the RDY pin is active, the
-        CPU will 'loop' on the tick callback during the next READ access
-        until the RDY pin goes inactive. The tick callback must make sure
-        that only a single READ access happens during the entire RDY period.
-        Currently this happens on the very last tick when RDY goes from
-        active to inactive (I haven't found definitive documentation if
-        this is the right behaviour, but it made the Boulderdash fast loader work).
-    */
-    if ((pins & (M6502_RDY|M6502_RW)) == (M6502_RDY|M6502_RW)) {
-        return pins;
-    }
-
-    /* handle IO requests */
-    if (M6510_CHECK_IO(pins)) {
-        /* ...the integrated IO port in the M6510 CPU at addresses 0 and 1 */
-        pins = m6510_iorq(&c64.cpu, pins);
-    }
-    else {
-        /* ...the memory-mapped IO area from 0xD000 to 0xDFFF */
-        if (c64.io_mapped && ((addr & 0xF000) == 0xD000)) {
-            if (addr < 0xD400) {
-                /* VIC-II (D000..D3FF) */
-                uint64_t vic_pins = (pins & M6502_PIN_MASK)|M6569_CS;
-                pins = m6569_iorq(&c64.vic, vic_pins) & M6502_PIN_MASK;
-            }
-            else if (addr < 0xD800) {
-                /* SID (D400..D7FF) */
-                uint64_t sid_pins = (pins & M6502_PIN_MASK)|M6581_CS;
-                pins = m6581_iorq(&c64.sid, sid_pins) & M6502_PIN_MASK;
-            }
-            else if (addr < 0xDC00) {
-                /* read or write the special color Static-RAM bank (D800..DBFF) */
-                if (pins & M6502_RW) {
-                    M6502_SET_DATA(pins, c64.color_ram[addr & 0x03FF]);
-                }
-                else {
-                    c64.color_ram[addr & 0x03FF] = M6502_GET_DATA(pins);
-                }
-            }
-            else if (addr < 0xDD00) {
-                /* CIA-1 (DC00..DCFF) */
-                uint64_t cia_pins = (pins & M6502_PIN_MASK)|M6526_CS;
-                pins = m6526_iorq(&c64.cia_1, cia_pins) & M6502_PIN_MASK;
-            }
-            else if (addr < 0xDE00) {
-                /* CIA-2 (DD00..DDFF) */
-                uint64_t cia_pins = (pins & M6502_PIN_MASK)|M6526_CS;
-                pins = m6526_iorq(&c64.cia_2, cia_pins) & M6502_PIN_MASK;
-            }
-            else {
-                /* FIXME: expansion system (not implemented) */
-            }
-        }
-        else {
-            /* a regular memory access */
-            if (pins & M6502_RW) {
-                /* memory read */
-                M6502_SET_DATA(pins, mem_rd(&c64.mem_cpu, addr));
-            }
-            else {
-                /* memory write */
-                mem_wr(&c64.mem_cpu, addr, M6502_GET_DATA(pins));
-            }
-        }
+    if (frame_lock) {
+        framepace_print(&pace);
     }
-    return pins;
-}
-
-uint8_t c64_cpu_port_in(void) {
-    /*
-        Input from the integrated M6510 CPU IO port
-
-        bit 4: [in] datasette button status (1: no button pressed)
-    */
-    uint8_t val = 7;
-    /* FIXME: datasette not implemented
-    if (!tape_playing) {
-        val |= (1<<4);
-    }
-    */
-    return val;
-}
-
-void c64_cpu_port_out(uint8_t data) {
-    /*
-        Output to the integrated M6510 CPU IO port
-
-        bits 0..2:  [out] memory configuration
-
-        bit 3: [out] datasette output signal level
-        bit 5: [out] datasette motor control (1: motor off)
-    */
-    /* FIXME: datasette not implemented
-    if (data & (1<<5)) {
-        tape_stop_motor();
-    }
-    else {
-        tape_start_motor();
-    }
-    */
-    /* only update memory configuration if the relevant bits have changed */
-    bool need_mem_update = 0 != ((c64.cpu_port ^ data) & 7);
-    c64.cpu_port = data;
-    if (need_mem_update) {
-        c64_update_memory_map();
-    }
-}
-
-void c64_cia1_out(int port_id, uint8_t data) {
-    /*
-        Write CIA-1 ports:
-
-        port A:
-            write keyboard matrix lines
-        port B:
-            ---
-    */
-    if (port_id == M6526_PORT_A) {
-        kbd_set_active_lines(&c64.kbd, ~data);
-    }
-}
-
-uint8_t c64_cia1_in(int port_id) {
-    /*
-        Read CIA-1 ports:
-
-        Port A:
-            joystick 2 input
-        Port B:
-            combined keyboard matrix columns and joystick 1
-    */
-    if (port_id == M6526_PORT_A) {
-        /* joystick 2 not implemented */
-        return ~0;
-    }
-    else {
-        /* read keyboard matrix columns (joystick 1 not implemented) */
-        return ~kbd_scan_columns(&c64.kbd);
-    }
-}
-
-void c64_cia2_out(int port_id, uint8_t data) {
-    /*
-        Write CIA-2 ports:
-
-        Port A:
-            bits 0..1: VIC-II bank select:
-                00: bank 3 C000..FFFF
-                01: bank 2 8000..BFFF
-                10: bank 1 4000..7FFF
-                11: bank 0 0000..3FFF
-            bit 2: RS-232 TXD Outout (not implemented)
-            bit 3..5: serial bus output (not implemented)
-            bit 6..7: input (see cia2_in)
-        Port B:
-            RS232 / user functionality (not implemented)
-    */
-    if (port_id == M6526_PORT_A) {
-        c64.vic_bank_select = ((~data)&3)<<14;
-    }
-}
-
-uint8_t c64_cia2_in(int port_id) {
-    /*
-        Read CIA-2 ports:
-
-        Port A:
-            bits 0..5: output (see cia2_out)
-            bits 6..7: serial bus input, not implemented
-        Port B:
-            RS232 / user functionality (not implemented)
-    */
-    return ~0;
-}
-
-uint16_t c64_vic_fetch(uint16_t addr) {
-    /*
-        Fetch data into the VIC-II.
-
-        The VIC-II has a 14-bit address bus and 12-bit data bus, and
-        has a different memory mapping then the CPU (that's why it
-        goes through the mem_vic pagetable):
-            - a full 16-bit address is formed by taking the address bits
-              14 and 15 from the value written to CIA-1 port A
-            - the lower 8 bits of the VIC-II data bus are connected
-              to the shared system data bus, this is used to read
-              character mask and pixel data
-            - the upper 4 bits of the VIC-II data bus are hardwired to the
-              static color RAM
-    */
-    addr |= c64.vic_bank_select;
-    uint16_t data = (c64.color_ram[addr & 0x03FF]<<8) | mem_rd(&c64.mem_vic, addr);
-    return data;
-}
-
-void c64_update_memory_map(void) {
-    c64.io_mapped = false;
-    uint8_t* read_ptr;
-    const uint8_t charen = (1<<2);
-    const uint8_t hiram = (1<<1);
-    const uint8_t loram = (1<<0);
-    /* shortcut if HIRAM and LORAM is 0, everything is RAM */
-    if ((c64.cpu_port & (hiram|loram)) == 0) {
-        mem_map_ram(&c64.mem_cpu, 0, 0xA000, 0x6000, c64.ram+0xA000);
+    inputq_close(&inputq);
+    rewind_discard(&history);
+    free(snapshot);
+    audio_shutdown();
+    gfx_shutdown();
+    romfile_unmap(&rom_char);
+    romfile_unmap(&rom_basic);
+    romfile_unmap(&rom_kernal);
+    if (prof) {
+        pcprof_report(prof, &prof_labels, stdout, 32);
+        pcprof_free_labels(&prof_labels);
+        free(prof);
     }
-    else {
-        /* A000..BFFF is either RAM-behind-BASIC-ROM or RAM */
-        if ((c64.cpu_port & (hiram|loram)) == (hiram|loram)) {
-            read_ptr = dump_c64_basic;
-        }
-        else {
-            read_ptr = c64.ram + 0xA000;
-        }
-        mem_map_rw(&c64.mem_cpu, 0, 0xA000, 0x2000, read_ptr, c64.ram+0xA000);
-
-        /* E000..FFFF is either RAM-behind-KERNAL-ROM or RAM */
-        if (c64.cpu_port & hiram) {
-            read_ptr = dump_c64_kernalv3;
-        }
-        else {
-            read_ptr = c64.ram + 0xE000;
-        }
-        mem_map_rw(&c64.mem_cpu, 0, 0xE000, 0x2000, read_ptr, c64.ram+0xE000);
-
-        /* D000..DFFF can be Char-ROM or I/O */
-        if  (c64.cpu_port & charen) {
-            c64.io_mapped = true;
-        }
-        else {
-            mem_map_rw(&c64.mem_cpu, 0, 0xD000, 0x1000, dump_c64_char, c64.ram+0xD000);
-        }
+    free(trace_buffer);
+    free(debugger);
+    if (heatmap) {
+        save_heatmap();
+        free(heatmap);
     }
 }
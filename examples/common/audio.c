@@ -0,0 +1,163 @@
+#include "sokol_audio.h"
+#include "audio.h"
+#include "thread.h"
+
+#include <string.h>
+#include <stdio.h>
+
+static float ring[AUDIO_RING_SIZE];
+static volatile uint32_t ring_head;     /* only written by the emulator thread */
+static volatile uint32_t ring_tail;     /* only written by the audio thread */
+static volatile uint32_t underruns;     /* only written by the audio thread */
+static uint32_t dropped;
+static uint64_t pushed;
+static uint32_t max_fill;
+static int buffer_frames;
+static bool muted;
+
+/* drift correction resampler, resample_pos is the position of the next
+   played sample relative to the first sample of the next pushed batch
+   (-1.0 is the last sample of the previous batch)
+*/
+#define RESAMPLE_CHUNK (512)
+#define RESAMPLE_MIN_RATIO (0.9)
+#define RESAMPLE_MAX_RATIO (1.1)
+static double resample_ratio = 1.0;
+static double resample_pos;
+static float resample_last;
+static float resample_buf[(RESAMPLE_CHUNK * 10) / 9 + 2];    /* RESAMPLE_CHUNK / RESAMPLE_MIN_RATIO */
+
+/* called on the audio thread, pulls samples out of the ring buffer */
+static void _audio_stream_cb(float* buffer, int num_frames, int num_channels) {
+    const uint32_t tail = ring_tail;
+    const uint32_t head = thread_atomic_load(&ring_head);
+    const uint32_t avail = head - tail;
+    const uint32_t num = ((uint32_t)num_frames < avail) ? (uint32_t)num_frames : avail;
+    for (uint32_t i = 0; i < num; i++) {
+        const float s = ring[(tail + i) & (AUDIO_RING_SIZE-1)];
+        for (int c = 0; c < num_channels; c++) {
+            *buffer++ = s;
+        }
+    }
+    if (num < (uint32_t)num_frames) {
+        memset(buffer, 0, (num_frames - num) * num_channels * sizeof(float));
+        thread_atomic_store(&underruns, underruns + 1);
+    }
+    thread_atomic_store(&ring_tail, tail + num);
+}
+
+void audio_init(const audio_desc_t* desc) {
+    const audio_desc_t def = { 0 };
+    if (!desc) {
+        desc = &def;
+    }
+    buffer_frames = desc->buffer_frames > 0 ? desc->buffer_frames : 512;
+    saudio_setup(&(saudio_desc){
+        .sample_rate = desc->sample_rate > 0 ? desc->sample_rate : 44100,
+        .num_channels = 1,
+        .buffer_frames = buffer_frames,
+        .stream_cb = _audio_stream_cb
+    });
+    if (desc->max_latency_ms > 0) {
+        max_fill = (uint32_t) (((uint64_t)audio_sample_rate() * desc->max_latency_ms) / 1000);
+    }
+    else {
+        max_fill = 4 * buffer_frames;
+    }
+    if (max_fill > AUDIO_RING_SIZE) {
+        max_fill = AUDIO_RING_SIZE;
+    }
+}
+
+int audio_sample_rate(void) {
+    const int rate = saudio_sample_rate();
+    return rate > 0 ? rate : 44100;
+}
+
+void audio_set_muted(bool m) {
+    muted = m;
+}
+
+void audio_set_resample_ratio(double ratio) {
+    if (ratio < RESAMPLE_MIN_RATIO) {
+        ratio = RESAMPLE_MIN_RATIO;
+    }
+    else if (ratio > RESAMPLE_MAX_RATIO) {
+        ratio = RESAMPLE_MAX_RATIO;
+    }
+    resample_ratio = ratio;
+}
+
+/* copy samples into the ring buffer, drops samples which don't fit */
+static void _audio_write(const float* samples, uint32_t num) {
+    const uint32_t head = ring_head;
+    const uint32_t fill = head - thread_atomic_load(&ring_tail);
+    if ((fill + num) > max_fill) {
+        const uint32_t space = (fill < max_fill) ? (max_fill - fill) : 0;
+        dropped += num - space;
+        num = space;
+    }
+    /* copy in up to 2 chunks, the ring buffer may wrap around */
+    const uint32_t pos = head & (AUDIO_RING_SIZE-1);
+    const uint32_t num0 = ((pos + num) > AUDIO_RING_SIZE) ? (AUDIO_RING_SIZE - pos) : num;
+    memcpy(&ring[pos], samples, num0 * sizeof(float));
+    memcpy(&ring[0], samples + num0, (num - num0) * sizeof(float));
+    thread_atomic_store(&ring_head, head + num);
+}
+
+/* resample up to RESAMPLE_CHUNK samples into resample_buf, returns the number of output samples */
+static uint32_t _audio_resample(const float* in, int num_in) {
+    uint32_t num_out = 0;
+    double pos = resample_pos;
+    while (pos < (double)(num_in - 1)) {
+        const int i = (int)(pos + 1.0) - 1;
+        const float s0 = (i < 0) ? resample_last : in[i];
+        const float s1 = in[i + 1];
+        resample_buf[num_out++] = s0 + (s1 - s0) * (float)(pos - i);
+        pos += resample_ratio;
+    }
+    resample_pos = pos - num_in;
+    resample_last = in[num_in - 1];
+    return num_out;
+}
+
+void audio_push(const float* samples, int num_samples) {
+    if (muted) {
+        return;
+    }
+    pushed += num_samples;
+    if ((1.0 == resample_ratio) || (num_samples <= 0)) {
+        _audio_write(samples, (uint32_t)num_samples);
+        resample_pos = 0.0;
+        resample_last = (num_samples > 0) ? samples[num_samples - 1] : resample_last;
+        return;
+    }
+    while (num_samples > 0) {
+        const int num = (num_samples < RESAMPLE_CHUNK) ? num_samples : RESAMPLE_CHUNK;
+        _audio_write(resample_buf, _audio_resample(samples, num));
+        samples += num;
+        num_samples -= num;
+    }
+}
+
+audio_stats_t audio_stats(void) {
+    audio_stats_t stats = { 0 };
+    stats.sample_rate = audio_sample_rate();
+    stats.buffer_frames = buffer_frames;
+    stats.fill = (int) (thread_atomic_load(&ring_head) - thread_atomic_load(&ring_tail));
+    stats.fill_ms = (1000.0 * stats.fill) / stats.sample_rate;
+    stats.underruns = thread_atomic_load(&underruns);
+    stats.dropped = dropped;
+    stats.pushed = pushed;
+    stats.resample_ratio = resample_ratio;
+    return stats;
+}
+
+void audio_shutdown(void) {
+    if (pushed > 0) {
+        const audio_stats_t stats = audio_stats();
+        printf("audio: %d Hz, %u underruns, %u samples dropped, %.1f ms buffered\n",
+            stats.sample_rate, stats.underruns, stats.dropped, stats.fill_ms);
+    }
+    saudio_shutdown();
+}
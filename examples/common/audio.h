@@ -0,0 +1,52 @@
+#pragma once
+/*
+    Common audio output for the chips-test example emulators.
+
+    The emulator pushes batches of mono samples with audio_push(),
+    the audio backend (sokol_audio) pulls them from its own thread.
+    Both sides meet in a single-producer/single-consumer lock-free
+    ring buffer, audio_push() never allocates, locks or blocks.
+    If the ring buffer holds more than max_latency_ms worth of
+    samples, new samples are dropped to keep the latency bounded.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* size of the sample ring buffer, must be a power of 2 */
+#define AUDIO_RING_SIZE (1<<14)
+
+typedef struct {
+    int sample_rate;        /* default: 44100 */
+    int buffer_frames;      /* samples per backend callback, default: 512 */
+    int max_latency_ms;     /* max amount of buffered audio, default: 4x buffer_frames */
+} audio_desc_t;
+
+typedef struct {
+    int sample_rate;
+    int buffer_frames;
+    int fill;               /* samples currently in the ring buffer */
+    double fill_ms;         /* same in milliseconds */
+    uint32_t underruns;     /* backend callbacks which couldn't be fully filled */
+    uint32_t dropped;       /* samples dropped because the ring buffer was too full */
+    uint64_t pushed;        /* total number of samples pushed */
+    double resample_ratio;  /* see audio_set_resample_ratio() */
+} audio_stats_t;
+
+/* setup the audio backend (desc can be 0 for defaults) */
+extern void audio_init(const audio_desc_t* desc);
+/* the actual playback sample rate, pass this to the emulator */
+extern int audio_sample_rate(void);
+/* push a batch of samples, only call from a single thread */
+extern void audio_push(const float* samples, int num_samples);
+/* resample the pushed samples by linear interpolation, ratio is the number
+   of pushed samples per played sample (1.0: no resampling), used by the
+   display-locked frame pacing to correct the drift between the emulated and
+   the host's frame rate (see framepace.h)
+*/
+extern void audio_set_resample_ratio(double ratio);
+/* drop all pushed samples while muted (e.g. in warp mode) */
+extern void audio_set_muted(bool muted);
+/* get the current fill level and underrun counters */
+extern audio_stats_t audio_stats(void);
+/* shutdown the audio backend */
+extern void audio_shutdown(void);
@@ -0,0 +1,77 @@
+#pragma once
+/*
+    Post-boot snapshots for instant startup of the examples.
+
+    A cold boot spends one to several seconds of emulated time in the
+    ROM init code (the C64 KERNAL RAM test, the CPC firmware init, the
+    ZX 128 menu) before the machine is usable. After building the Atom,
+    C64, CPC and ZX Spectrum examples, the build runs each of them once
+    with '-save-boot [file]', which boots the system headless with the
+    embedded ROM dumps and writes a system snapshot into [system].boot in
+    the deploy directory. On startup, the examples restore this snapshot
+    instead of booting, unless '-coldboot' or '-roms dir' (a different ROM
+    set) is given, or the snapshot doesn't match.
+
+    The file is a small header and a snapshot from common/snapshot.h,
+    which only restores into the executable which wrote it. The header
+    records the audio sample rate of the booted system (the audio chips'
+    sample periods are part of the snapshot), a different playback rate
+    also falls back to a cold boot.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* the audio sample rate the headless boot uses (the audio.h default) */
+#define BOOTSNAP_SAMPLE_RATE (44100)
+#define BOOTSNAP_MAGIC (0x544F4F42)    /* 'BOOT' */
+#define BOOTSNAP_MAX_SIZE (1<<20)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t sample_rate;       /* audio sample rate of the system, 0 for systems without audio */
+    uint32_t snapshot_size;
+    uint32_t reserved;
+} bootsnap_header_t;
+
+/* write a snapshot as post-boot snapshot file */
+static inline bool bootsnap_save(const char* path, int sample_rate, const void* snapshot, uint32_t snapshot_size) {
+    FILE* fp = fopen(path, "wb");
+    if (!fp) {
+        return false;
+    }
+    const bootsnap_header_t hdr = { BOOTSNAP_MAGIC, (uint32_t)sample_rate, snapshot_size, 0 };
+    bool ok = (1 == fwrite(&hdr, sizeof(hdr), 1, fp)) && (1 == fwrite(snapshot, snapshot_size, 1, fp));
+    ok &= (0 == fclose(fp));
+    return ok;
+}
+
+/* read the snapshot from a post-boot snapshot file into a malloc'ed buffer,
+   returns 0 if the file doesn't exist or was written for a different sample rate
+*/
+static inline uint8_t* bootsnap_load(const char* path, int sample_rate, uint32_t* out_size) {
+    *out_size = 0;
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        return 0;
+    }
+    uint8_t* buf = 0;
+    bootsnap_header_t hdr;
+    if ((1 == fread(&hdr, sizeof(hdr), 1, fp)) &&
+        (BOOTSNAP_MAGIC == hdr.magic) &&
+        ((uint32_t)sample_rate == hdr.sample_rate) &&
+        (hdr.snapshot_size > 0) && (hdr.snapshot_size <= BOOTSNAP_MAX_SIZE))
+    {
+        buf = (uint8_t*) malloc(hdr.snapshot_size);
+        if (buf && (1 != fread(buf, hdr.snapshot_size, 1, fp))) {
+            free(buf);
+            buf = 0;
+        }
+    }
+    fclose(fp);
+    if (buf) {
+        *out_size = hdr.snapshot_size;
+    }
+    return buf;
+}
@@ -0,0 +1,167 @@
+#pragma once
+/*
+    Binary bus cycle trace recorder.
+
+    Records the CPU pins (address, data and control pins) after each tick
+    callback, together with the tick count, into a fixed-size ring buffer
+    provided by the caller, so recording doesn't allocate and doesn't
+    format any text. The oldest entries are overwritten when the ring
+    buffer is full.
+
+    An optional trigger (a pin mask and value, for instance an opcode
+    fetch at a specific address) stops the recording a given number of
+    cycles after the trigger hit, so that the ring buffer holds the bus
+    activity around the trigger. bustrace_save() writes the ring buffer
+    into a file, which is turned into text by the bustrace-decode tool.
+
+    File format (little endian):
+
+        header:  bustrace_header_t
+        entries: bustrace_entry_t[num_entries], oldest first
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#define BUSTRACE_MAGIC (0x43525442)     /* 'BTRC' */
+#define BUSTRACE_VERSION (1)
+
+/* the CPU type, the decoder needs this to interpret the pins */
+enum {
+    BUSTRACE_CPU_Z80 = 1,
+    BUSTRACE_CPU_M6502 = 2,
+};
+
+/* bustrace_entry_t.flags */
+#define BUSTRACE_FLAG_TRIGGER (1<<0)    /* this cycle hit the trigger */
+
+/* one bus cycle, 16 bytes */
+typedef struct {
+    uint64_t pins;          /* CPU pins as returned from the tick callback */
+    uint32_t tick;          /* lower 32 bits of the tick counter at the start of the cycle */
+    uint16_t num_ticks;     /* length of the cycle in ticks (including wait states) */
+    uint16_t flags;         /* BUSTRACE_FLAG_* */
+} bustrace_entry_t;
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t cpu;           /* BUSTRACE_CPU_* */
+    uint32_t num_entries;
+    uint32_t entry_size;
+    uint64_t first_tick;    /* full tick counter of the first entry */
+} bustrace_header_t;
+
+typedef struct {
+    bustrace_entry_t* entries;  /* ring buffer, num_entries must be a power of two */
+    uint32_t mask;              /* num_entries - 1 */
+    int cpu;                    /* BUSTRACE_CPU_* */
+    bool recording;             /* false after the trigger countdown */
+    uint64_t pos;               /* number of recorded cycles */
+    uint64_t tick;              /* tick counter */
+    uint64_t last_tick;         /* tick counter at the last recorded cycle */
+    /* trigger, (pins & trigger_mask) == trigger_value */
+    bool trigger_enabled;
+    bool triggered;
+    uint64_t trigger_mask;
+    uint64_t trigger_value;
+    uint32_t post_trigger;      /* number of cycles to record after the trigger hit */
+    uint32_t countdown;
+} bustrace_t;
+
+/* initialize with a caller-provided ring buffer (num_entries must be a power of two) */
+static inline void bustrace_init(bustrace_t* t, int cpu, bustrace_entry_t* entries, uint32_t num_entries) {
+    memset(t, 0, sizeof(bustrace_t));
+    t->entries = entries;
+    t->mask = num_entries - 1;
+    t->cpu = cpu;
+    t->recording = true;
+}
+
+/* stop the recording post_trigger cycles after (pins & mask) == value */
+static inline void bustrace_set_trigger(bustrace_t* t, uint64_t mask, uint64_t value, uint32_t post_trigger) {
+    t->trigger_enabled = true;
+    t->triggered = false;
+    t->trigger_mask = mask;
+    t->trigger_value = value;
+    t->post_trigger = post_trigger;
+}
+
+/* restart recording, keeps the trigger */
+static inline void bustrace_restart(bustrace_t* t) {
+    t->pos = 0;
+    t->triggered = false;
+    t->recording = true;
+}
+
+/* true when the recording was stopped by the trigger */
+static inline bool bustrace_stopped(const bustrace_t* t) {
+    return !t->recording;
+}
+
+/* record one bus cycle, call at the end of the tick callback */
+static inline void bustrace_record(bustrace_t* t, uint64_t pins, uint32_t num_ticks) {
+    if (t->recording) {
+        bustrace_entry_t* e = &t->entries[t->pos++ & t->mask];
+        e->pins = pins;
+        e->tick = (uint32_t) t->tick;
+        e->num_ticks = (uint16_t) num_ticks;
+        e->flags = 0;
+        t->last_tick = t->tick;
+        if (t->triggered) {
+            if (--t->countdown == 0) {
+                t->recording = false;
+            }
+        }
+        else if (t->trigger_enabled && ((pins & t->trigger_mask) == t->trigger_value)) {
+            e->flags = BUSTRACE_FLAG_TRIGGER;
+            t->triggered = true;
+            t->countdown = t->post_trigger;
+            if (0 == t->countdown) {
+                t->recording = false;
+            }
+        }
+    }
+    t->tick += num_ticks;
+}
+
+/* number of valid entries in the ring buffer */
+static inline uint32_t bustrace_num_entries(const bustrace_t* t) {
+    return (t->pos > t->mask) ? (t->mask + 1) : (uint32_t)t->pos;
+}
+
+/* write the ring buffer content into a file, oldest entry first */
+static inline bool bustrace_save(const bustrace_t* t, const char* path) {
+    FILE* fp = fopen(path, "wb");
+    if (!fp) {
+        return false;
+    }
+    const uint32_t num = bustrace_num_entries(t);
+    const uint64_t first = t->pos - num;
+    bustrace_header_t hdr = {
+        .magic = BUSTRACE_MAGIC,
+        .version = BUSTRACE_VERSION,
+        .cpu = (uint16_t) t->cpu,
+        .num_entries = num,
+        .entry_size = sizeof(bustrace_entry_t),
+    };
+    if (num > 0) {
+        /* reconstruct the full tick counter of the oldest entry from its lower 32 bits */
+        const bustrace_entry_t* e = &t->entries[first & t->mask];
+        const uint32_t span = (uint32_t)t->last_tick - e->tick;
+        hdr.first_tick = t->last_tick - span;
+    }
+    bool ok = 1 == fwrite(&hdr, sizeof(hdr), 1, fp);
+    /* the ring buffer may wrap around, write it in two parts */
+    const uint32_t start = (uint32_t)(first & t->mask);
+    const uint32_t n0 = (num < (t->mask + 1 - start)) ? num : (t->mask + 1 - start);
+    if (ok && (n0 > 0)) {
+        ok = n0 == fwrite(&t->entries[start], sizeof(bustrace_entry_t), n0, fp);
+    }
+    if (ok && (num > n0)) {
+        ok = (num - n0) == fwrite(&t->entries[0], sizeof(bustrace_entry_t), num - n0, fp);
+    }
+    fclose(fp);
+    return ok;
+}
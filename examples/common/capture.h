@@ -0,0 +1,321 @@
+#pragma once
+/*
+    Asynchronous frame capture.
+
+    Finished frames are copied into a pool of preallocated frame buffers
+    (no allocation per frame) and handed to an encoder thread through a
+    single-producer/single-consumer ring, the encoder thread writes them
+    either as a PNG sequence (path_000000.png, path_000001.png, ...) or
+    as a single raw RGBA stream which can be converted with:
+
+        ffmpeg -f rawvideo -pix_fmt rgba -video_size WxH -framerate 60 -i capture.raw ...
+
+    The thread pushing frames never waits for the encoder: when all pool
+    buffers are still queued, the frame is dropped and counted. The PNG
+    files use uncompressed deflate blocks, so they are lossless and cheap
+    to write, but large (they can be recompressed offline).
+
+    capture_write_png() writes a single frame as PNG file on the calling
+    thread, without the encoder thread and frame pool.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "thread.h"
+
+#define CAPTURE_POOL_SIZE (8)               /* must be a power of 2 */
+#define CAPTURE_MAX_PATH (1024)
+
+typedef enum {
+    CAPTURE_FORMAT_RAW,                     /* one file, RGBA8 frames back to back */
+    CAPTURE_FORMAT_PNG,                     /* one PNG file per frame */
+} capture_format_t;
+
+typedef struct {
+    capture_format_t format;
+    const char* path;                       /* raw: file name, PNG: file name prefix */
+    int width;
+    int height;
+} capture_desc_t;
+
+typedef struct {
+    capture_desc_t desc;
+    char path[CAPTURE_MAX_PATH];
+    thread_t thread;
+    volatile uint32_t stop;
+    volatile uint32_t head;                 /* only written by the producer */
+    volatile uint32_t tail;                 /* only written by the encoder thread */
+    uint32_t* frames[CAPTURE_POOL_SIZE];    /* RGBA8 frame pool */
+    uint32_t num_pushed;
+    uint32_t num_dropped;
+    /* only accessed by the encoder thread until capture_stop() */
+    FILE* fp;
+    uint8_t* png;                           /* PNG file scratch buffer */
+    uint32_t num_written;
+    bool failed;
+    uint32_t crc_table[256];
+} capture_t;
+
+static inline void _capture_be32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24); p[1] = (uint8_t)(v >> 16); p[2] = (uint8_t)(v >> 8); p[3] = (uint8_t)v;
+}
+
+static inline uint32_t _capture_crc(const capture_t* cap, const uint8_t* p, size_t num) {
+    uint32_t c = 0xFFFFFFFF;
+    for (size_t i = 0; i < num; i++) {
+        c = cap->crc_table[(c ^ p[i]) & 0xFF] ^ (c >> 8);
+    }
+    return c ^ 0xFFFFFFFF;
+}
+
+/* worst-case PNG file size for RGB without compression */
+static inline size_t _capture_png_size(int w, int h) {
+    const size_t raw = (size_t)h * (1 + 3 * (size_t)w);
+    const size_t num_blocks = (raw + 0xFFFE) / 0xFFFF;
+    return 8 + 25 + (12 + 2 + raw + 5 * num_blocks + 4) + 12;
+}
+
+/* build a PNG file (8-bit RGB, stored deflate blocks) in cap->png, returns its size */
+static inline size_t _capture_encode_png(capture_t* cap, const uint32_t* frame) {
+    const int w = cap->desc.width;
+    const int h = cap->desc.height;
+    uint8_t* p = cap->png;
+    static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    memcpy(p, sig, 8); p += 8;
+    /* IHDR */
+    _capture_be32(p, 13); memcpy(p + 4, "IHDR", 4);
+    _capture_be32(p + 8, (uint32_t)w); _capture_be32(p + 12, (uint32_t)h);
+    p[16] = 8; p[17] = 2; p[18] = 0; p[19] = 0; p[20] = 0;
+    _capture_be32(p + 21, _capture_crc(cap, p + 4, 17));
+    p += 25;
+    /* IDAT, a zlib stream of stored blocks over the filtered rows */
+    uint8_t* idat = p;
+    p += 8;
+    *p++ = 0x78; *p++ = 0x01;
+    const uint32_t raw_size = (uint32_t)h * (1 + 3 * (uint32_t)w);
+    uint32_t a = 1, b = 0, block_left = 0, raw_left = raw_size;
+    for (int y = 0; y < h; y++) {
+        const uint32_t* src = frame + y * w;
+        for (int x = -1; x < w; x++) {
+            uint8_t px[3];
+            int n;
+            if (x < 0) {
+                px[0] = 0;  /* filter type: none */
+                n = 1;
+            }
+            else {
+                const uint32_t c = src[x];
+                px[0] = (uint8_t)c; px[1] = (uint8_t)(c >> 8); px[2] = (uint8_t)(c >> 16);
+                n = 3;
+            }
+            for (int i = 0; i < n; i++) {
+                if (0 == block_left) {
+                    block_left = (raw_left < 0xFFFF) ? raw_left : 0xFFFF;
+                    raw_left -= block_left;
+                    *p++ = (0 == raw_left) ? 1 : 0;
+                    p[0] = (uint8_t)block_left; p[1] = (uint8_t)(block_left >> 8);
+                    p[2] = (uint8_t)~block_left; p[3] = (uint8_t)(~block_left >> 8);
+                    p += 4;
+                }
+                *p++ = px[i];
+                block_left--;
+                a = (a + px[i]) % 65521;
+                b = (b + a) % 65521;
+            }
+        }
+    }
+    _capture_be32(p, (b << 16) | a); p += 4;
+    const uint32_t idat_len = (uint32_t)(p - idat - 8);
+    _capture_be32(idat, idat_len); memcpy(idat + 4, "IDAT", 4);
+    _capture_be32(p, _capture_crc(cap, idat + 4, idat_len + 4)); p += 4;
+    /* IEND */
+    _capture_be32(p, 0); memcpy(p + 4, "IEND", 4);
+    _capture_be32(p + 8, _capture_crc(cap, p + 4, 4));
+    p += 12;
+    return (size_t)(p - cap->png);
+}
+
+static inline void _capture_write(capture_t* cap, const uint32_t* frame) {
+    if (cap->failed) {
+        return;
+    }
+    const int w = cap->desc.width;
+    const int h = cap->desc.height;
+    if (cap->desc.format == CAPTURE_FORMAT_RAW) {
+        cap->failed = (size_t)h != fwrite(frame, (size_t)w * 4, (size_t)h, cap->fp);
+    }
+    else {
+        char path[CAPTURE_MAX_PATH + 16];
+        snprintf(path, sizeof(path), "%s_%06u.png", cap->path, cap->num_written);
+        FILE* fp = fopen(path, "wb");
+        if (fp) {
+            const size_t size = _capture_encode_png(cap, frame);
+            cap->failed = 1 != fwrite(cap->png, size, 1, fp);
+            fclose(fp);
+        }
+        else {
+            cap->failed = true;
+        }
+    }
+    if (cap->failed) {
+        printf("capture: failed to write frame %u\n", cap->num_written);
+    }
+    else {
+        cap->num_written++;
+    }
+}
+
+static void _capture_thread_func(void* arg) {
+    capture_t* cap = (capture_t*) arg;
+    uint32_t tail = cap->tail;
+    while (true) {
+        if (tail != thread_atomic_load(&cap->head)) {
+            _capture_write(cap, cap->frames[tail & (CAPTURE_POOL_SIZE-1)]);
+            tail++;
+            thread_atomic_store(&cap->tail, tail);
+        }
+        else if (thread_atomic_load(&cap->stop)) {
+            break;
+        }
+        else {
+            thread_sleep_us(1000);
+        }
+    }
+}
+
+static inline void _capture_init_crc(capture_t* cap) {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1);
+        }
+        cap->crc_table[n] = c;
+    }
+}
+
+/* allocate the frame pool, open the output and start the encoder thread */
+static inline bool capture_start(capture_t* cap, const capture_desc_t* desc) {
+    memset(cap, 0, sizeof(capture_t));
+    cap->desc = *desc;
+    if (!desc->path || (desc->width <= 0) || (desc->height <= 0)) {
+        return false;
+    }
+    snprintf(cap->path, sizeof(cap->path), "%s", desc->path);
+    cap->desc.path = cap->path;
+    _capture_init_crc(cap);
+    if (desc->format == CAPTURE_FORMAT_RAW) {
+        cap->fp = fopen(cap->path, "wb");
+        if (!cap->fp) {
+            return false;
+        }
+    }
+    else {
+        cap->png = (uint8_t*) malloc(_capture_png_size(desc->width, desc->height));
+    }
+    const size_t frame_size = (size_t)desc->width * desc->height * sizeof(uint32_t);
+    for (int i = 0; i < CAPTURE_POOL_SIZE; i++) {
+        cap->frames[i] = (uint32_t*) malloc(frame_size);
+    }
+    if (!thread_start(&cap->thread, _capture_thread_func, cap)) {
+        for (int i = 0; i < CAPTURE_POOL_SIZE; i++) {
+            free(cap->frames[i]);
+            cap->frames[i] = 0;
+        }
+        free(cap->png);
+        cap->png = 0;
+        if (cap->fp) {
+            fclose(cap->fp);
+            cap->fp = 0;
+        }
+        return false;
+    }
+    return true;
+}
+
+/* get a free pool buffer for the next frame, or 0 if the encoder is behind (the frame is dropped) */
+static inline uint32_t* _capture_next(capture_t* cap) {
+    cap->num_pushed++;
+    if ((cap->head - thread_atomic_load(&cap->tail)) >= CAPTURE_POOL_SIZE) {
+        cap->num_dropped++;
+        return 0;
+    }
+    return cap->frames[cap->head & (CAPTURE_POOL_SIZE-1)];
+}
+
+static inline void _capture_commit(capture_t* cap) {
+    thread_atomic_store(&cap->head, cap->head + 1);
+}
+
+/* queue an RGBA8 frame (width*height pixels) */
+static inline void capture_push_rgba8(capture_t* cap, const uint32_t* pixels) {
+    uint32_t* dst = _capture_next(cap);
+    if (dst) {
+        const int num = cap->desc.width * cap->desc.height;
+        for (int i = 0; i < num; i++) {
+            dst[i] = pixels[i] | 0xFF000000;
+        }
+        _capture_commit(cap);
+    }
+}
+
+/* queue an 8-bit indexed frame, converted to RGBA8 through the palette */
+static inline void capture_push_pal8(capture_t* cap, const uint8_t* pixels, const uint32_t* palette) {
+    uint32_t* dst = _capture_next(cap);
+    if (dst) {
+        const int num = cap->desc.width * cap->desc.height;
+        for (int i = 0; i < num; i++) {
+            dst[i] = palette[pixels[i]] | 0xFF000000;
+        }
+        _capture_commit(cap);
+    }
+}
+
+/* write the remaining queued frames, stop the encoder thread and print the capture statistics */
+static inline void capture_stop(capture_t* cap) {
+    if (!cap->frames[0]) {
+        return;
+    }
+    thread_atomic_store(&cap->stop, 1);
+    thread_join(&cap->thread);
+    printf("capture: %u frames, %u written to '%s%s', %u dropped because the encoder fell behind\n",
+        cap->num_pushed, cap->num_written, cap->path,
+        (cap->desc.format == CAPTURE_FORMAT_PNG) ? "_*.png" : "", cap->num_dropped);
+    if (cap->fp) {
+        fclose(cap->fp);
+        cap->fp = 0;
+    }
+    free(cap->png);
+    cap->png = 0;
+    for (int i = 0; i < CAPTURE_POOL_SIZE; i++) {
+        free(cap->frames[i]);
+        cap->frames[i] = 0;
+    }
+}
+
+/* encode an RGBA8 frame (width*height pixels) and write it as PNG file on the calling thread */
+static inline bool capture_write_png(const char* path, const uint32_t* pixels, int width, int height) {
+    if ((width <= 0) || (height <= 0)) {
+        return false;
+    }
+    capture_t* cap = (capture_t*) calloc(1, sizeof(capture_t));
+    if (!cap) {
+        return false;
+    }
+    cap->desc.format = CAPTURE_FORMAT_PNG;
+    cap->desc.width = width;
+    cap->desc.height = height;
+    _capture_init_crc(cap);
+    cap->png = (uint8_t*) malloc(_capture_png_size(width, height));
+    bool ok = false;
+    FILE* fp = cap->png ? fopen(path, "wb") : 0;
+    if (fp) {
+        const size_t size = _capture_encode_png(cap, pixels);
+        ok = (1 == fwrite(cap->png, size, 1, fp));
+        ok &= (0 == fclose(fp));
+    }
+    free(cap->png);
+    free(cap);
+    return ok;
+}
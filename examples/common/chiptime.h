@@ -0,0 +1,167 @@
+#pragma once
+/*
+    Per-chip host time accounting for the emulator cores.
+
+    Compiled in only when CHIPS_CHIPTIME is defined (cmake -DCHIPS_CHIPTIME=ON),
+    otherwise the CHIPTIME_*() macros expand to nothing.
+
+    The tick callbacks place CHIPTIME_MARK(ct, slot) after each chip they
+    tick, which adds the host cycles elapsed since the previous mark
+    to that slot, so each mark costs one counter read and there is no
+    per-call bookkeeping beyond a fixed-size array. The first mark in
+    the tick callback gets the time spent in the CPU emulation between
+    two tick callbacks. CHIPTIME_START() at the start of an exec call
+    makes sure that time spent outside the emulator isn't counted.
+
+    The host counter is rdtsc on x86, the virtual counter on arm64,
+    and the monotonic clock elsewhere. When the counter doesn't run in
+    nanoseconds, it is calibrated against the monotonic clock over each
+    report interval.
+
+    The app calls chiptime_frame() once per frame, which prints the
+    per-chip breakdown every report_frames frames (if not 0). Note that
+    the counter reads themselves slow down the instrumented build.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#define CHIPTIME_MAX_SLOTS (8)
+
+typedef struct {
+    const char* name;                           /* system name for the report */
+    const char* slot_names[CHIPTIME_MAX_SLOTS];
+    int num_slots;
+    int report_frames;                          /* print a report every N frames (0: never) */
+} chiptime_desc_t;
+
+typedef struct {
+    chiptime_desc_t desc;
+    uint64_t last;                              /* counter value at the last mark */
+    uint64_t acc[CHIPTIME_MAX_SLOTS];           /* counter ticks per slot in the current interval */
+    uint64_t frame_start_total;                 /* sum of acc[] at the start of the current frame */
+    uint64_t max_frame;                         /* most counter ticks of a single frame */
+    int num_frames;                             /* frames in the current interval */
+    uint64_t start_counter;                     /* for calibrating the counter */
+    uint64_t start_ns;
+} chiptime_t;
+
+#if defined(CHIPS_CHIPTIME)
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <intrin.h>
+#else
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#endif
+
+#define CHIPTIME_START(ct) do { if (ct) { (ct)->last = chiptime_now(); } } while (0)
+#define CHIPTIME_MARK(ct, slot) do { if (ct) { chiptime_mark((ct), (slot)); } } while (0)
+
+/* monotonic clock in nanoseconds */
+static inline uint64_t chiptime_ns(void) {
+    #if defined(_WIN32)
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (uint64_t) ((count.QuadPart / freq.QuadPart) * 1000000000 + ((count.QuadPart % freq.QuadPart) * 1000000000) / freq.QuadPart);
+    #else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+    #endif
+}
+
+/* the host counter */
+static inline uint64_t chiptime_now(void) {
+    #if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+    #elif defined(__aarch64__)
+    uint64_t val;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(val));
+    return val;
+    #else
+    return chiptime_ns();
+    #endif
+}
+
+static inline void chiptime_reset(chiptime_t* ct) {
+    memset(ct->acc, 0, sizeof(ct->acc));
+    ct->frame_start_total = 0;
+    ct->max_frame = 0;
+    ct->num_frames = 0;
+    ct->start_counter = chiptime_now();
+    ct->start_ns = chiptime_ns();
+    ct->last = ct->start_counter;
+}
+
+static inline void chiptime_init(chiptime_t* ct, const chiptime_desc_t* desc) {
+    memset(ct, 0, sizeof(chiptime_t));
+    ct->desc = *desc;
+    if (ct->desc.num_slots > CHIPTIME_MAX_SLOTS) {
+        ct->desc.num_slots = CHIPTIME_MAX_SLOTS;
+    }
+    chiptime_reset(ct);
+}
+
+/* attribute the counter ticks since the last mark to a slot */
+static inline void chiptime_mark(chiptime_t* ct, int slot) {
+    const uint64_t now = chiptime_now();
+    ct->acc[slot] += now - ct->last;
+    ct->last = now;
+}
+
+static inline uint64_t _chiptime_total(const chiptime_t* ct) {
+    uint64_t total = 0;
+    for (int i = 0; i < ct->desc.num_slots; i++) {
+        total += ct->acc[i];
+    }
+    return total;
+}
+
+/* print the per-chip breakdown of the current interval */
+static inline void chiptime_print(const chiptime_t* ct, FILE* fp) {
+    if (ct->num_frames == 0) {
+        return;
+    }
+    /* counter ticks per microsecond over the interval */
+    const uint64_t elapsed_ns = chiptime_ns() - ct->start_ns;
+    const uint64_t elapsed_counter = chiptime_now() - ct->start_counter;
+    const double ticks_per_us = (elapsed_ns > 0) ? ((elapsed_counter * 1000.0) / elapsed_ns) : 1.0;
+    const uint64_t total = _chiptime_total(ct);
+    const double frame_us = (total / ticks_per_us) / ct->num_frames;
+    fprintf(fp, "%s: %d frames, %.1f us/frame (max %.1f us):",
+        ct->desc.name, ct->num_frames, frame_us, ct->max_frame / ticks_per_us);
+    for (int i = 0; i < ct->desc.num_slots; i++) {
+        fprintf(fp, " %s %.1f%% (%.1f us)", ct->desc.slot_names[i],
+            total > 0 ? (100.0 * ct->acc[i] / total) : 0.0,
+            (ct->acc[i] / ticks_per_us) / ct->num_frames);
+    }
+    fprintf(fp, "\n");
+}
+
+/* call once per frame, prints and restarts the interval every report_frames frames */
+static inline void chiptime_frame(chiptime_t* ct) {
+    const uint64_t total = _chiptime_total(ct);
+    if ((total - ct->frame_start_total) > ct->max_frame) {
+        ct->max_frame = total - ct->frame_start_total;
+    }
+    ct->frame_start_total = total;
+    ct->num_frames++;
+    if ((ct->desc.report_frames > 0) && (ct->num_frames >= ct->desc.report_frames)) {
+        chiptime_print(ct, stdout);
+        const uint64_t last = ct->last;
+        chiptime_reset(ct);
+        ct->last = last;
+    }
+}
+#else
+#define CHIPTIME_START(ct) ((void)0)
+#define CHIPTIME_MARK(ct, slot) ((void)0)
+#endif
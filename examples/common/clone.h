@@ -0,0 +1,269 @@
+#pragma once
+/*
+    Copy-on-write clones of a system instance from a shared base snapshot.
+
+    When many instances of the same machine are started from the same
+    state (a booted system, a loaded program), each of them would need
+    its own copy of the whole system struct, which is mostly RAM that
+    the instance never writes. Here, the system struct of a snapshot is
+    copied once into an anonymous shared memory object (the base), and
+    each clone maps a private copy-on-write view of it: all pages start
+    as shared, read-only references to the base, and the host MMU copies
+    a page on the first write into it. Pages which are only read stay
+    shared between all clones, pages which are never touched are not
+    resident at all.
+
+    Write tracking is done by the host MMU on its page size (usually 4 KB)
+    instead of the mem_t write mappings: the cores also write RAM directly
+    (quickloaders, the CPU port of the C64) and the video decoders read it
+    directly, so a software trap in the mem_t layer would need a check on
+    every access outside of mem_t as well.
+
+    The per-system clone functions (c64_clone(), cpc_clone(), zx_clone())
+    restore the pointers of a mapped clone like a restored snapshot (see
+    snapshot.h): the clone gets its own framebuffer, the chip callbacks
+    are set again and the memory mapping is rebuilt, which only writes the
+    pages of the struct head in front of the RAM arrays. The clone is
+    detached from the audio callback and the instrumentation of the
+    instance the snapshot was taken from, but shares its ROM pointers, so the base snapshot must
+    have been taken in this process.
+
+    clone_pages() reports the resident and private (copied) pages of an
+    instance, from /proc/self/pagemap on Linux. On other platforms only
+    the total is known. On platforms without shared memory (WASM), the
+    base is a cache-line aligned heap buffer (see thread_aligned_calloc())
+    and each clone is a full private copy.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+#include "common/snapshot.h"
+#include "common/thread.h"
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+    #define CLONE_SHARED (1)
+#elif defined(__EMSCRIPTEN__)
+    #define CLONE_SHARED (0)
+#else
+    #include <sys/mman.h>
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <stdio.h>
+    #if defined(__linux__)
+    #include <sys/syscall.h>
+    #endif
+    #define CLONE_SHARED (1)
+#endif
+
+typedef struct {
+    uint32_t system_size;       /* size of the system struct */
+    uint32_t map_size;          /* system size rounded up to the host page size */
+    #if defined(_WIN32)
+    HANDLE handle;
+    #elif CLONE_SHARED
+    int fd;
+    #else
+    void* buf;
+    #endif
+    bool valid;
+} clone_base_t;
+
+typedef struct {
+    bool valid;                 /* false if the resident and private pages are unknown */
+    uint32_t page_size;         /* host page size in bytes */
+    uint32_t total;             /* pages spanned by the instance */
+    uint32_t resident;          /* pages in memory (shared or private) */
+    uint32_t private_pages;     /* pages copied on write, owned by this instance */
+} clone_pages_t;
+
+static inline uint32_t clone_page_size(void) {
+    #if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    /* views must start on the allocation granularity, but copy-on-write works on pages */
+    return (uint32_t) info.dwPageSize;
+    #elif CLONE_SHARED
+    return (uint32_t) sysconf(_SC_PAGESIZE);
+    #else
+    return 4096;
+    #endif
+}
+
+#if CLONE_SHARED && !defined(_WIN32)
+/* open an anonymous shared memory object */
+static inline int _clone_shm_open(void) {
+    #if defined(__linux__)
+    int fd = -1;
+    #if defined(SYS_memfd_create)
+    fd = (int) syscall(SYS_memfd_create, "chips-clone", 0);
+    #endif
+    if (fd < 0) {
+        /* kernels without memfd: an unlinked temp file (shm_open() would need librt) */
+        char name[] = "/tmp/chips-clone-XXXXXX";
+        fd = mkstemp(name);
+        if (fd >= 0) {
+            unlink(name);
+        }
+    }
+    return fd;
+    #else
+    char name[64];
+    static uint32_t counter;
+    snprintf(name, sizeof(name), "/chips-clone-%d-%u", (int) getpid(), counter++);
+    int fd = shm_open(name, O_RDWR|O_CREAT|O_EXCL, 0600);
+    if (fd >= 0) {
+        shm_unlink(name);
+    }
+    return fd;
+    #endif
+}
+#endif
+
+/* create a base from a snapshot of a system (see snapshot_save()), the
+   snapshot buffer isn't needed afterwards, returns false if the snapshot
+   doesn't match the system, wasn't taken in this process, or no shared
+   memory could be created
+*/
+static inline bool clone_base_init(clone_base_t* base, const void* buf, uint32_t buf_size, uint32_t system_id, uint32_t system_size) {
+    memset(base, 0, sizeof(clone_base_t));
+    if (!_snapshot_valid(buf, buf_size, system_id, system_size) || !_snapshot_same_process(buf)) {
+        return false;
+    }
+    const snapshot_header_t* hdr = (const snapshot_header_t*) buf;
+    const uint32_t page_size = clone_page_size();
+    base->system_size = system_size;
+    base->map_size = ((system_size + page_size - 1) / page_size) * page_size;
+    #if defined(_WIN32)
+    base->handle = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, base->map_size, NULL);
+    if (!base->handle) {
+        return false;
+    }
+    void* ptr = MapViewOfFile(base->handle, FILE_MAP_WRITE, 0, 0, base->map_size);
+    if (!ptr) {
+        CloseHandle(base->handle);
+        return false;
+    }
+    memcpy(ptr, hdr + 1, system_size);
+    UnmapViewOfFile(ptr);
+    #elif CLONE_SHARED
+    base->fd = _clone_shm_open();
+    if (base->fd < 0) {
+        return false;
+    }
+    if (0 != ftruncate(base->fd, base->map_size)) {
+        close(base->fd);
+        return false;
+    }
+    void* ptr = mmap(0, base->map_size, PROT_READ|PROT_WRITE, MAP_SHARED, base->fd, 0);
+    if (MAP_FAILED == ptr) {
+        close(base->fd);
+        return false;
+    }
+    memcpy(ptr, hdr + 1, system_size);
+    munmap(ptr, base->map_size);
+    #else
+    base->buf = thread_aligned_calloc(system_size);
+    if (!base->buf) {
+        return false;
+    }
+    memcpy(base->buf, hdr + 1, system_size);
+    #endif
+    base->valid = true;
+    return true;
+}
+
+/* release the base, existing clones keep their mapping */
+static inline void clone_base_discard(clone_base_t* base) {
+    if (base->valid) {
+        #if defined(_WIN32)
+        CloseHandle(base->handle);
+        #elif CLONE_SHARED
+        close(base->fd);
+        #else
+        thread_aligned_free(base->buf);
+        #endif
+    }
+    memset(base, 0, sizeof(clone_base_t));
+}
+
+/* map a copy-on-write clone of the base, returns 0 on failure, this is
+   called by the per-system clone functions, which then restore the
+   pointers in the clone
+*/
+static inline void* clone_map(const clone_base_t* base) {
+    if (!base->valid) {
+        return 0;
+    }
+    #if defined(_WIN32)
+    void* sys = MapViewOfFile(base->handle, FILE_MAP_COPY, 0, 0, base->map_size);
+    if (!sys) {
+        return 0;
+    }
+    #elif CLONE_SHARED
+    void* sys = mmap(0, base->map_size, PROT_READ|PROT_WRITE, MAP_PRIVATE, base->fd, 0);
+    if (MAP_FAILED == sys) {
+        return 0;
+    }
+    #else
+    void* sys = thread_aligned_calloc(base->system_size);
+    if (!sys) {
+        return 0;
+    }
+    memcpy(sys, base->buf, base->system_size);
+    #endif
+    return sys;
+}
+
+/* unmap a clone, its private pages are released */
+static inline void clone_unmap(const clone_base_t* base, void* sys) {
+    if (sys) {
+        #if defined(_WIN32)
+        (void)base;
+        UnmapViewOfFile(sys);
+        #elif CLONE_SHARED
+        munmap(sys, base->map_size);
+        #else
+        (void)base;
+        thread_aligned_free(sys);
+        #endif
+    }
+}
+
+/* count the resident and private pages of the memory range of an instance
+   (cloned or not, a private heap page counts as private once touched)
+*/
+static inline clone_pages_t clone_pages(const void* sys, uint32_t size) {
+    clone_pages_t res;
+    memset(&res, 0, sizeof(res));
+    res.page_size = clone_page_size();
+    const uintptr_t start = (uintptr_t) sys / res.page_size;
+    const uintptr_t end = ((uintptr_t) sys + size + res.page_size - 1) / res.page_size;
+    res.total = (uint32_t)(end - start);
+    #if defined(__linux__) && !defined(__EMSCRIPTEN__)
+    /* one 64-bit entry per virtual page: bit 63 present, bit 61 file-backed or shared */
+    int fd = open("/proc/self/pagemap", O_RDONLY);
+    if (fd < 0) {
+        return res;
+    }
+    res.valid = true;
+    for (uintptr_t page = start; page < end; page++) {
+        uint64_t entry = 0;
+        if (sizeof(entry) != pread(fd, &entry, sizeof(entry), (off_t)(page * sizeof(entry)))) {
+            res.valid = false;
+            break;
+        }
+        if (entry & (1ULL<<63)) {
+            res.resident++;
+            if (0 == (entry & (1ULL<<61))) {
+                res.private_pages++;
+            }
+        }
+    }
+    close(fd);
+    #endif
+    return res;
+}
@@ -0,0 +1,116 @@
+#pragma once
+/*
+    Multi-tick advance of a Z80 CTC (chips/z80ctc.h).
+
+    Between zero counts, a CTC channel in timer mode is just a prescaler
+    and a down counter which are decremented by the system clock, and the
+    channels in counter mode (or waiting for a timer trigger) don't change
+    as long as their CLKTRG input doesn't change. In such a stretch, none
+    of the ZCTO outputs or interrupt requests can change, so instead of
+    calling z80ctc_tick() for every tick, the system can advance the CTC
+    by a number of ticks at once:
+
+    ctcbatch_safe_ticks() computes the number of upcoming ticks in which
+    no channel can reach zero with the given CLKTRG input pins, directly
+    from the prescaler and down counter of the running timers.
+    ctcbatch_advance() then applies up to that many ticks to the running
+    timers with a few arithmetic operations per channel.
+
+    The result is identical to ticking the CTC tick by tick (this is
+    cross-checked in tests/z80ctc-test.c with ctcbatch_run_cascade(), which
+    chips-bench -d also times against ticking the CTC tick by tick).
+*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* the CLKTRG input pins of all channels */
+#define CTCBATCH_CLKTRG_MASK (Z80CTC_CLKTRG0|Z80CTC_CLKTRG1|Z80CTC_CLKTRG2|Z80CTC_CLKTRG3)
+
+/* true if a channel counts system clock ticks (timer mode, started and not in reset) */
+static inline bool ctcbatch_timer_running(const z80ctc_channel_t* chn) {
+    return !chn->waiting_for_trigger &&
+        ((chn->control & (Z80CTC_CTRL_MODE|Z80CTC_CTRL_RESET|Z80CTC_CTRL_CONST_FOLLOWS)) == Z80CTC_CTRL_MODE_TIMER);
+}
+
+/* the number of ticks until a running timer's next down counter decrement */
+static inline uint32_t _ctcbatch_first_count(const z80ctc_channel_t* chn) {
+    return (((uint8_t)(chn->prescaler - 1)) & chn->prescaler_mask) + 1;
+}
+
+/* the number of upcoming ticks in which no channel of the CTC reaches zero
+   while the CLKTRG inputs stay at clktrg_pins, returns 0 if a channel which
+   watches its trigger input would see an edge
+*/
+static inline uint32_t ctcbatch_safe_ticks(const z80ctc_t* ctc, uint64_t clktrg_pins) {
+    uint32_t ticks = 0xFFFFFFFF;
+    for (int i = 0; i < Z80CTC_NUM_CHANNELS; i++) {
+        const z80ctc_channel_t* chn = &ctc->chn[i];
+        if (chn->waiting_for_trigger || ((chn->control & Z80CTC_CTRL_MODE) == Z80CTC_CTRL_MODE_COUNTER)) {
+            /* only an edge on the trigger input does something */
+            const bool trg = 0 != (clktrg_pins & (Z80CTC_CLKTRG0<<i));
+            if (trg != chn->ext_trigger) {
+                return 0;
+            }
+        }
+        else if (ctcbatch_timer_running(chn)) {
+            /* a down counter of 0 counts 256 prescaler periods */
+            const uint32_t counter = chn->down_counter ? chn->down_counter : 256;
+            const uint32_t zero = _ctcbatch_first_count(chn) + (counter - 1) * ((uint32_t)chn->prescaler_mask + 1);
+            if ((zero - 1) < ticks) {
+                ticks = zero - 1;
+            }
+        }
+    }
+    return ticks;
+}
+
+/* advance the running timers of a CTC by a number of ticks, which must not
+   be more than ctcbatch_safe_ticks() returned for the current CLKTRG inputs
+*/
+static inline void ctcbatch_advance(z80ctc_t* ctc, uint32_t ticks) {
+    for (int i = 0; i < Z80CTC_NUM_CHANNELS; i++) {
+        z80ctc_channel_t* chn = &ctc->chn[i];
+        if (ctcbatch_timer_running(chn)) {
+            const uint32_t first = _ctcbatch_first_count(chn);
+            if (ticks >= first) {
+                const uint32_t counts = 1 + (ticks - first) / ((uint32_t)chn->prescaler_mask + 1);
+                chn->down_counter = (uint8_t)(chn->down_counter - counts);
+            }
+            chn->prescaler = (uint8_t)(chn->prescaler - ticks);
+        }
+    }
+}
+
+/* one tick of the KC87's system clock cascade, where the ZCTO2 output of
+   channel 2 drives the CLKTRG3 input of channel 3, returns the new pins
+*/
+static inline uint64_t ctcbatch_tick_cascade(z80ctc_t* ctc, uint64_t pins) {
+    if (pins & Z80CTC_ZCTO2) { pins |= Z80CTC_CLKTRG3; }
+    else                     { pins &= ~Z80CTC_CLKTRG3; }
+    return z80ctc_tick(ctc, pins);
+}
+
+/* run the channel 2 to 3 cascade of a CTC for a number of ticks, tick by
+   tick around the zero counts and with ctcbatch_advance() in between,
+   pins carries the ZCTO2 state from the previous call, returns the new
+   pins, num_batched counts the advanced ticks and num_zcto the ticks with
+   an active ZCTO2
+*/
+static inline uint64_t ctcbatch_run_cascade(z80ctc_t* ctc, uint64_t pins, uint32_t ticks, uint32_t* num_batched, uint32_t* num_zcto) {
+    while (ticks > 0) {
+        const uint32_t safe = (pins & Z80CTC_ZCTO2) ? 0 : ctcbatch_safe_ticks(ctc, 0);
+        if (safe > 0) {
+            const uint32_t n = (safe < ticks) ? safe : ticks;
+            ctcbatch_advance(ctc, n);
+            pins &= ~(Z80CTC_ZCTO0|Z80CTC_ZCTO1|Z80CTC_ZCTO2|Z80CTC_CLKTRG3);
+            ticks -= n;
+            *num_batched += n;
+        }
+        else {
+            pins = ctcbatch_tick_cascade(ctc, pins);
+            *num_zcto += (pins & Z80CTC_ZCTO2) ? 1 : 0;
+            ticks--;
+        }
+    }
+    return pins;
+}
@@ -0,0 +1,194 @@
+#pragma once
+/*
+    PC breakpoints and memory watchpoints for the system cores.
+
+    Breakpoints and watchpoints mark their 256-byte pages in a page flag
+    table, the tick callback only looks up the page of the current access
+    and takes the slow path when the page is flagged:
+
+        if (sys->dbg && dbg_watched(sys->dbg, addr)) {
+            dbg_access(sys->dbg, addr, data, fetch, write, pc);
+        }
+
+    Breakpoints are only checked on instruction fetch cycles (M6502 SYNC,
+    Z80 M1), watchpoints on read or write cycles. Without a debugger
+    attached (sys->dbg == 0), the cost is a single predictable branch, with
+    a debugger but no breakpoints, one table lookup per memory access.
+
+    The debugger doesn't stop the CPU in the middle of an exec call, it
+    records the first hit since the last dbg_resume(), and the example
+    shells pause the emulation after the exec call which hit it.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#define DBG_MAX_BREAKPOINTS (16)
+#define DBG_MAX_WATCHPOINTS (16)
+
+/* page flags */
+#define DBG_PAGE_BREAK (1<<0)
+#define DBG_PAGE_READ (1<<1)
+#define DBG_PAGE_WRITE (1<<2)
+
+/* watchpoint modes */
+#define DBG_WATCH_READ (1<<0)
+#define DBG_WATCH_WRITE (1<<1)
+
+typedef enum {
+    DBG_HIT_NONE = 0,
+    DBG_HIT_BREAK,
+    DBG_HIT_READ,
+    DBG_HIT_WRITE,
+} dbg_hit_t;
+
+typedef struct {
+    uint16_t addr;
+    uint16_t size;              /* watched bytes starting at addr */
+    uint8_t mode;               /* DBG_WATCH_* */
+} dbg_watchpoint_t;
+
+typedef struct {
+    uint8_t pages[256];         /* DBG_PAGE_* per 256-byte page */
+    int num_breakpoints;
+    uint16_t breakpoints[DBG_MAX_BREAKPOINTS];
+    int num_watchpoints;
+    dbg_watchpoint_t watchpoints[DBG_MAX_WATCHPOINTS];
+    /* the first hit since the last dbg_resume() */
+    dbg_hit_t hit;
+    uint16_t hit_pc;            /* PC of the CPU (for watchpoints, the PC register during the access) */
+    uint16_t hit_addr;
+    uint8_t hit_data;           /* the byte written by a write access */
+    uint32_t num_hits;          /* all hits, including the ones after the first */
+} dbg_t;
+
+static inline void _dbg_update_pages(dbg_t* d) {
+    memset(d->pages, 0, sizeof(d->pages));
+    for (int i = 0; i < d->num_breakpoints; i++) {
+        d->pages[d->breakpoints[i] >> 8] |= DBG_PAGE_BREAK;
+    }
+    for (int i = 0; i < d->num_watchpoints; i++) {
+        const dbg_watchpoint_t* w = &d->watchpoints[i];
+        const uint8_t flags = ((w->mode & DBG_WATCH_READ) ? DBG_PAGE_READ : 0) | ((w->mode & DBG_WATCH_WRITE) ? DBG_PAGE_WRITE : 0);
+        const uint32_t last = (uint32_t)w->addr + w->size - 1;
+        for (uint32_t p = w->addr >> 8; p <= ((last >> 8) & 0xFF); p++) {
+            d->pages[p] |= flags;
+        }
+    }
+}
+
+static inline void dbg_init(dbg_t* d) {
+    memset(d, 0, sizeof(dbg_t));
+}
+
+static inline bool dbg_add_breakpoint(dbg_t* d, uint16_t addr) {
+    if (d->num_breakpoints >= DBG_MAX_BREAKPOINTS) {
+        return false;
+    }
+    d->breakpoints[d->num_breakpoints++] = addr;
+    _dbg_update_pages(d);
+    return true;
+}
+
+/* watch size bytes starting at addr (the range must not wrap around), mode is DBG_WATCH_READ and/or DBG_WATCH_WRITE */
+static inline bool dbg_add_watchpoint(dbg_t* d, uint16_t addr, uint16_t size, uint8_t mode) {
+    if ((d->num_watchpoints >= DBG_MAX_WATCHPOINTS) || (0 == size) || (((uint32_t)addr + size) > 0x10000)) {
+        return false;
+    }
+    dbg_watchpoint_t* w = &d->watchpoints[d->num_watchpoints++];
+    w->addr = addr;
+    w->size = size;
+    w->mode = mode;
+    _dbg_update_pages(d);
+    return true;
+}
+
+static inline void dbg_clear(dbg_t* d) {
+    d->num_breakpoints = 0;
+    d->num_watchpoints = 0;
+    _dbg_update_pages(d);
+}
+
+/* true if an access to addr must take the slow path */
+static inline bool dbg_watched(const dbg_t* d, uint16_t addr) {
+    return 0 != d->pages[addr >> 8];
+}
+
+static inline void _dbg_hit(dbg_t* d, dbg_hit_t hit, uint16_t pc, uint16_t addr, uint8_t data) {
+    if (DBG_HIT_NONE == d->hit) {
+        d->hit = hit;
+        d->hit_pc = pc;
+        d->hit_addr = addr;
+        d->hit_data = data;
+    }
+    d->num_hits++;
+}
+
+/* the slow path for accesses to flagged pages */
+static inline void dbg_access(dbg_t* d, uint16_t addr, uint8_t data, bool fetch, bool write, uint16_t pc) {
+    const uint8_t flags = d->pages[addr >> 8];
+    if (fetch) {
+        if (flags & DBG_PAGE_BREAK) {
+            for (int i = 0; i < d->num_breakpoints; i++) {
+                if (d->breakpoints[i] == addr) {
+                    _dbg_hit(d, DBG_HIT_BREAK, addr, addr, 0);
+                    return;
+                }
+            }
+        }
+    }
+    if (flags & (write ? DBG_PAGE_WRITE : DBG_PAGE_READ)) {
+        const uint8_t mode = write ? DBG_WATCH_WRITE : DBG_WATCH_READ;
+        for (int i = 0; i < d->num_watchpoints; i++) {
+            const dbg_watchpoint_t* w = &d->watchpoints[i];
+            if ((w->mode & mode) && (addr >= w->addr) && ((uint32_t)addr < ((uint32_t)w->addr + w->size))) {
+                _dbg_hit(d, write ? DBG_HIT_WRITE : DBG_HIT_READ, pc, addr, data);
+                return;
+            }
+        }
+    }
+}
+
+/* true if a breakpoint or watchpoint was hit since the last dbg_resume() */
+static inline bool dbg_stopped(const dbg_t* d) {
+    return DBG_HIT_NONE != d->hit;
+}
+
+static inline void dbg_resume(dbg_t* d) {
+    d->hit = DBG_HIT_NONE;
+}
+
+/* print the first hit */
+static inline void dbg_print_hit(const dbg_t* d) {
+    switch (d->hit) {
+        case DBG_HIT_BREAK:
+            printf("debugger: breakpoint at %04X\n", d->hit_pc);
+            break;
+        case DBG_HIT_READ:
+            printf("debugger: read from %04X (PC=%04X)\n", d->hit_addr, d->hit_pc);
+            break;
+        case DBG_HIT_WRITE:
+            printf("debugger: write %02X to %04X (PC=%04X)\n", d->hit_data, d->hit_addr, d->hit_pc);
+            break;
+        default:
+            break;
+    }
+}
+
+/* parse a command line address (hex, with optional '$' or '0x' prefix) */
+static inline bool dbg_parse_addr(const char* str, uint16_t* out_addr) {
+    if ('$' == str[0]) {
+        str++;
+    }
+    else if (('0' == str[0]) && (('x' == str[1]) || ('X' == str[1]))) {
+        str += 2;
+    }
+    unsigned int addr;
+    char extra;
+    if ((1 != sscanf(str, "%x%c", &addr, &extra)) || (addr > 0xFFFF)) {
+        return false;
+    }
+    *out_addr = (uint16_t) addr;
+    return true;
+}
@@ -0,0 +1,96 @@
+#pragma once
+/*
+    Run an emulator on its own thread (optional mode of the example
+    emulators, enabled with the '-threaded' command line arg).
+
+    The emulation thread runs frame_cb() at a fixed frame rate, the
+    frame callback publishes its finished framebuffer with
+    gfx_publish_frame() (a lock-free triple buffer which is consumed
+    by gfx_draw() on the render thread). Input events are copied into
+    a single-producer/single-consumer queue on the render thread, and
+    handed to event_cb() on the emulation thread before each frame.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "sokol_time.h"
+#include "thread.h"
+
+#define EMU_THREAD_MAX_EVENTS (256)         /* must be a power of 2 */
+#define EMU_THREAD_MAX_EVENT_SIZE (256)
+
+typedef struct {
+    int frame_hz;                           /* emulated frames per second, default: 50 */
+    void (*frame_cb)(double frame_time);    /* run one frame on the emulation thread */
+    void (*event_cb)(const void* event);    /* handle an input event on the emulation thread */
+    int event_size;                         /* size of an input event in bytes */
+} emu_thread_desc_t;
+
+typedef struct {
+    emu_thread_desc_t desc;
+    thread_t thread;
+    volatile uint32_t stop;
+    volatile uint32_t event_head;           /* only written by the render thread */
+    volatile uint32_t event_tail;           /* only written by the emulation thread */
+    uint32_t dropped_events;
+    uint8_t events[EMU_THREAD_MAX_EVENTS][EMU_THREAD_MAX_EVENT_SIZE];
+} emu_thread_t;
+
+static void _emu_thread_func(void* arg) {
+    emu_thread_t* et = (emu_thread_t*) arg;
+    const double frame_time = 1.0 / et->desc.frame_hz;
+    const uint64_t frame_ticks = (uint64_t) (frame_time * 1000000000.0);   /* sokol_time ticks are ns */
+    uint64_t next_frame = stm_now();
+    while (!thread_atomic_load(&et->stop)) {
+        /* forward queued input events */
+        const uint32_t head = thread_atomic_load(&et->event_head);
+        uint32_t tail = et->event_tail;
+        while (tail != head) {
+            et->desc.event_cb(et->events[tail & (EMU_THREAD_MAX_EVENTS-1)]);
+            tail++;
+        }
+        thread_atomic_store(&et->event_tail, tail);
+
+        /* run one frame, and wait for the next frame's start time */
+        et->desc.frame_cb(frame_time);
+        next_frame += frame_ticks;
+        const uint64_t now = stm_now();
+        if (now < next_frame) {
+            thread_sleep_us((uint32_t) ((next_frame - now) / 1000));
+        }
+        else if ((now - next_frame) > (100 * 1000000)) {
+            /* more than 100ms behind (e.g. the process was suspended), don't try to catch up */
+            next_frame = now;
+        }
+    }
+}
+
+/* start the emulation thread */
+static inline bool emu_thread_start(emu_thread_t* et, const emu_thread_desc_t* desc) {
+    memset(et, 0, sizeof(emu_thread_t));
+    et->desc = *desc;
+    if (et->desc.frame_hz <= 0) {
+        et->desc.frame_hz = 50;
+    }
+    if ((et->desc.event_size <= 0) || (et->desc.event_size > EMU_THREAD_MAX_EVENT_SIZE)) {
+        return false;
+    }
+    return thread_start(&et->thread, _emu_thread_func, et);
+}
+
+/* queue an input event for the emulation thread (call from the render thread only) */
+static inline void emu_thread_push_event(emu_thread_t* et, const void* event) {
+    const uint32_t head = et->event_head;
+    if ((head - thread_atomic_load(&et->event_tail)) >= EMU_THREAD_MAX_EVENTS) {
+        et->dropped_events++;
+        return;
+    }
+    memcpy(et->events[head & (EMU_THREAD_MAX_EVENTS-1)], event, et->desc.event_size);
+    thread_atomic_store(&et->event_head, head + 1);
+}
+
+/* stop the emulation thread and wait for it to finish */
+static inline void emu_thread_stop(emu_thread_t* et) {
+    thread_atomic_store(&et->stop, 1);
+    thread_join(&et->thread);
+}
@@ -0,0 +1,191 @@
+#pragma once
+/*
+    Display-locked frame pacing for the example emulators ('-framelock'
+    command line arg of the C64, CPC and ZX Spectrum examples).
+
+    By default, app_frame() runs as many ticks as wall-clock time has
+    passed since the previous host frame, so the emulated frame boundaries
+    drift against the host's vsync, a host frame sometimes shows two new
+    emulated frames or none, and the work per host frame is uneven.
+
+    In locked mode, when the measured host frame interval is close to the
+    emulated frame duration (or an integer fraction of it, e.g. a 50 Hz
+    machine on a 100 Hz display), each emulated video frame is run with
+    its exact tick budget (the system's FRAME_TICKS) on every Nth host
+    frame. Each emulated frame is then presented for exactly N host
+    frames. When the host frame interval doesn't match (e.g. a 60 Hz
+    display), the pacer falls back to the wall-clock budget.
+
+    In locked mode the emulation runs at the host's refresh rate instead
+    of the machine's (e.g. 50.00 Hz instead of the C64's 50.12 Hz), the
+    audio samples are resampled to correct this drift:
+    framepace_resample_ratio() returns the ratio of emulated to host frame
+    rate, corrected by the fill level of the audio ring buffer, which is
+    passed to audio_set_resample_ratio().
+
+    The host frame times and the tick budgets per host frame are recorded,
+    framepace_print() reports their mean and standard deviation.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/* lock when the host frame interval is within 1% of 1/N of the emulated frame duration, unlock at 2% */
+#define FRAMEPACE_LOCK_TOLERANCE (0.01)
+#define FRAMEPACE_UNLOCK_TOLERANCE (0.02)
+#define FRAMEPACE_MAX_DIVIDER (4)
+/* consecutive matching host frames before locking */
+#define FRAMEPACE_LOCK_FRAMES (30)
+/* max audio drift correction on top of the frame rate ratio */
+#define FRAMEPACE_MAX_AUDIO_CORRECTION (0.005)
+
+typedef struct {
+    uint32_t freq_hz;           /* emulated CPU clock frequency */
+    uint32_t frame_ticks;       /* exact ticks per emulated video frame */
+    bool lock;                  /* false: always use the wall-clock budget */
+} framepace_desc_t;
+
+typedef struct {
+    double sum;
+    double sum_sq;
+    uint32_t num;
+} framepace_stat_t;
+
+typedef struct {
+    uint32_t freq_hz;
+    uint32_t frame_ticks;
+    bool lock;
+    double frame_sec;           /* emulated frame duration */
+    double host_sec;            /* smoothed host frame interval */
+    int divider;                /* host frames per emulated frame while locked, 0 if not locked */
+    int candidate;              /* divider which matched the last host frames */
+    int matching_frames;        /* consecutive host frames which matched the candidate */
+    int phase;                  /* host frames since the last emulated frame while locked */
+    uint32_t locked_frames;     /* host frames in locked mode */
+    uint32_t free_frames;       /* host frames with the wall-clock budget */
+    uint32_t num_locks;         /* switches into locked mode */
+    framepace_stat_t host_ms;   /* host frame times */
+    framepace_stat_t budget;    /* tick budget per host frame */
+} framepace_t;
+
+static inline void framepace_init(framepace_t* p, const framepace_desc_t* desc) {
+    memset(p, 0, sizeof(framepace_t));
+    p->freq_hz = desc->freq_hz;
+    p->frame_ticks = desc->frame_ticks;
+    p->lock = desc->lock;
+    p->frame_sec = (double)desc->frame_ticks / (double)desc->freq_hz;
+}
+
+static inline void _framepace_stat(framepace_stat_t* s, double val) {
+    s->sum += val;
+    s->sum_sq += val * val;
+    s->num++;
+}
+
+/* the host frames per emulated frame which match the smoothed host interval within tolerance, or 0 */
+static inline int _framepace_match(const framepace_t* p, double tolerance) {
+    for (int n = 1; n <= FRAMEPACE_MAX_DIVIDER; n++) {
+        const double err = (p->host_sec * n - p->frame_sec) / p->frame_sec;
+        if ((err > -tolerance) && (err < tolerance)) {
+            return n;
+        }
+    }
+    return 0;
+}
+
+/* the tick budget for this host frame, frame_time is the wall-clock time since the
+   previous host frame (clamped by the caller), in locked mode this is FRAME_TICKS on
+   every Nth host frame and 0 otherwise
+*/
+static inline uint32_t framepace_ticks(framepace_t* p, double frame_time) {
+    _framepace_stat(&p->host_ms, frame_time * 1000.0);
+    uint32_t ticks;
+    if (p->lock) {
+        /* skip outliers (missed vsyncs, hitches) in the smoothed interval */
+        if ((frame_time > 0.5 * p->host_sec) && (frame_time < 1.5 * p->host_sec)) {
+            p->host_sec += (frame_time - p->host_sec) * 0.05;
+        }
+        else if (0 == p->divider) {
+            p->host_sec = frame_time;
+        }
+        if (p->divider) {
+            if (p->divider != _framepace_match(p, FRAMEPACE_UNLOCK_TOLERANCE)) {
+                p->divider = 0;
+                p->matching_frames = 0;
+            }
+        }
+        else {
+            const int n = _framepace_match(p, FRAMEPACE_LOCK_TOLERANCE);
+            p->matching_frames = ((n != 0) && (n == p->candidate)) ? p->matching_frames + 1 : 0;
+            p->candidate = n;
+            if (p->matching_frames >= FRAMEPACE_LOCK_FRAMES) {
+                p->divider = n;
+                p->phase = 0;
+                p->num_locks++;
+            }
+        }
+    }
+    if (p->divider) {
+        /* a missed vsync counts as several host frames */
+        int host_frames = (int)(frame_time / p->host_sec + 0.5);
+        if (host_frames < 1) {
+            host_frames = 1;
+        }
+        p->phase += host_frames;
+        const int emu_frames = p->phase / p->divider;
+        p->phase %= p->divider;
+        ticks = (uint32_t)emu_frames * p->frame_ticks;
+        p->locked_frames++;
+    }
+    else {
+        ticks = (uint32_t)(p->freq_hz * frame_time);
+        p->free_frames++;
+    }
+    _framepace_stat(&p->budget, (double)ticks);
+    return ticks;
+}
+
+static inline bool framepace_locked(const framepace_t* p) {
+    return 0 != p->divider;
+}
+
+/* the audio resample ratio (pushed per played samples) for the current mode,
+   fill and target_fill are the current and desired number of samples in the audio ring buffer
+*/
+static inline double framepace_resample_ratio(const framepace_t* p, int fill, int target_fill) {
+    if (!p->divider || (target_fill <= 0)) {
+        return 1.0;
+    }
+    /* emulated seconds per host second */
+    const double rate_ratio = p->frame_sec / (p->host_sec * p->divider);
+    /* consume faster when the buffer fills up, slower when it drains */
+    double correction = 0.01 * (double)(fill - target_fill) / (double)target_fill;
+    if (correction > FRAMEPACE_MAX_AUDIO_CORRECTION) {
+        correction = FRAMEPACE_MAX_AUDIO_CORRECTION;
+    }
+    else if (correction < -FRAMEPACE_MAX_AUDIO_CORRECTION) {
+        correction = -FRAMEPACE_MAX_AUDIO_CORRECTION;
+    }
+    return rate_ratio * (1.0 + correction);
+}
+
+static inline void _framepace_mean_stddev(const framepace_stat_t* s, double* mean, double* stddev) {
+    *mean = 0.0;
+    *stddev = 0.0;
+    if (s->num > 0) {
+        *mean = s->sum / s->num;
+        const double var = (s->sum_sq / s->num) - (*mean * *mean);
+        *stddev = (var > 0.0) ? sqrt(var) : 0.0;
+    }
+}
+
+static inline void framepace_print(const framepace_t* p) {
+    double host_mean, host_stddev, budget_mean, budget_stddev;
+    _framepace_mean_stddev(&p->host_ms, &host_mean, &host_stddev);
+    _framepace_mean_stddev(&p->budget, &budget_mean, &budget_stddev);
+    printf("framepace: %u host frames locked (%u locks), %u free, host frame time %.2f ms (stddev %.3f ms), "
+        "ticks per host frame %.0f (stddev %.1f)\n",
+        p->locked_frames, p->num_locks, p->free_frames, host_mean, host_stddev, budget_mean, budget_stddev);
+}
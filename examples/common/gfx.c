@@ -2,20 +2,147 @@
 #include "sokol_app.h"
 #include "sokol_time.h"
 #include "gfx.h"
+#include "thread.h"
+#include "capture.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h> /* malloc, free */
+#include <math.h> /* sqrt */
 
 extern const char* vs_src; 
 extern const char* fs_src;
+extern const char* fs_pal_src;
+
+/* on the GL backends, the framebuffer is streamed into a ring of textures
+   so that an upload never has to wait for the GPU to finish rendering
+   from the texture uploaded in the previous frame (Metal and D3D11 already
+   handle this inside sokol_gfx)
+*/
+#if defined(SOKOL_GLCORE33) || defined(SOKOL_GLES2)
+#define GFX_NUM_FB_IMAGES (3)
+#else
+#define GFX_NUM_FB_IMAGES (1)
+#endif
 
 static const sg_pass_action pass_action = { .colors[0].action = SG_ACTION_DONTCARE };
 static sg_draw_state draw_state;
+static sg_image fb_images[GFX_NUM_FB_IMAGES];
+static int cur_fb_image;
 static int fb_width;
 static int fb_height;
+static bool indexed;
+static bool palette_dirty;
+static uint32_t palette[GFX_MAX_PALETTE_COLORS];
+static uint64_t row_hash[GFX_MAX_FB_HEIGHT];
+static bool hash_valid;
+static gfx_stats_t stats;
+static uint64_t last_new_frame_time;
+static double frame_interval_sum;
+static double frame_interval_sqr_sum;
+
+/* triple-buffered framebuffer handoff from an emulation thread: the
+   emulation thread owns the back frame, the render thread owns the
+   front frame, and both exchange their frame with the ready frame
+*/
+#define GFX_FRAME_NEW (4)   /* set in handoff_ready when it holds a frame not yet drawn */
+static bool handoff;
+static uint32_t frame_size;
+static uint8_t* handoff_frames[3];
+static uint32_t handoff_back;           /* only used by the emulation thread */
+static uint32_t handoff_front;          /* only used by the render thread */
+static volatile uint32_t handoff_ready;
+
+/* optional frame capture, frames are pushed by the thread which finished them */
+static bool capturing;
+static capture_t capture;
+
+/* optional text overlay, rendered into an RGBA8 texture of the framebuffer
+   size and alpha-blended over the display, the texture is only updated when
+   the text changes
+*/
+#define GFX_GLYPH_WIDTH (6)
+#define GFX_GLYPH_HEIGHT (9)
+#define GFX_OVERLAY_BORDER (2)
+#define GFX_OVERLAY_TEXT_COLOR (0xFFFFFFFF)
+#define GFX_OVERLAY_BACK_COLOR (0xB0000000)
+static bool overlay_visible;
+static bool overlay_dirty;
+static uint32_t* overlay_pixels;
+static sg_draw_state overlay_draw_state;
+
+/* 5x7 font for ASCII 0x20..0x5A (the characters of the telemetry text, the others
+   are blank), one byte per row, bit 4 is the leftmost pixel
+*/
+static const uint8_t overlay_font[0x5B - 0x20][7] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /*   */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /* ! */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /* " */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /* # */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /* $ */
+    { 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03 },   /* % */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /* & */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /* ' */
+    { 0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02 },   /* ( */
+    { 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08 },   /* ) */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /* * */
+    { 0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00 },   /* + */
+    { 0x00, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x08 },   /* , */
+    { 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00 },   /* - */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C },   /* . */
+    { 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00 },   /* / */
+    { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E },   /* 0 */
+    { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E },   /* 1 */
+    { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F },   /* 2 */
+    { 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E },   /* 3 */
+    { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 },   /* 4 */
+    { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E },   /* 5 */
+    { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E },   /* 6 */
+    { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 },   /* 7 */
+    { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E },   /* 8 */
+    { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C },   /* 9 */
+    { 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00 },   /* : */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /* ; */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /* < */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /* = */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /* > */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /* ? */
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   /* @ */
+    { 0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 },   /* A */
+    { 0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E },   /* B */
+    { 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E },   /* C */
+    { 0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C },   /* D */
+    { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F },   /* E */
+    { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10 },   /* F */
+    { 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F },   /* G */
+    { 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 },   /* H */
+    { 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E },   /* I */
+    { 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C },   /* J */
+    { 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 },   /* K */
+    { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F },   /* L */
+    { 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11 },   /* M */
+    { 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11 },   /* N */
+    { 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E },   /* O */
+    { 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10 },   /* P */
+    { 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D },   /* Q */
+    { 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11 },   /* R */
+    { 0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E },   /* S */
+    { 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },   /* T */
+    { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E },   /* U */
+    { 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04 },   /* V */
+    { 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A },   /* W */
+    { 0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11 },   /* X */
+    { 0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04 },   /* Y */
+    { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F },   /* Z */
+};
 
 uint32_t rgba8_buffer[GFX_MAX_FB_WIDTH * GFX_MAX_FB_HEIGHT];
+uint8_t pal8_buffer[GFX_MAX_FB_WIDTH * GFX_MAX_FB_HEIGHT];
 
-void gfx_init(int w, int h) {
+static void _gfx_init(int w, int h, bool use_indexed) {
     fb_width = w;
     fb_height = h;
+    indexed = use_indexed;
     sg_setup(&(sg_desc){
         .mtl_device = sapp_metal_get_device(),
         .mtl_renderpass_descriptor_cb = sapp_metal_get_renderpass_descriptor,
@@ -35,9 +162,10 @@ void gfx_init(int w, int h) {
     sg_shader fsq_shd = sg_make_shader(&(sg_shader_desc){
         .fs.images = {
             [0] = { .name="tex", .type=SG_IMAGETYPE_2D },
+            [1] = { .name=indexed ? "pal" : 0, .type=indexed ? SG_IMAGETYPE_2D : _SG_IMAGETYPE_DEFAULT },
         },
         .vs.source = vs_src,
-        .fs.source = fs_src,
+        .fs.source = indexed ? fs_pal_src : fs_src,
     });
     draw_state.pipeline = sg_make_pipeline(&(sg_pipeline_desc){
         .layout = {
@@ -46,48 +174,392 @@ void gfx_init(int w, int h) {
         .shader = fsq_shd,
         .primitive_type = SG_PRIMITIVETYPE_TRIANGLE_STRIP
     });
-    draw_state.fs_images[0] = sg_make_image(&(sg_image_desc){
+    /* pen indices must not be filtered, the palette lookup happens in the fragment shader */
+    for (int i = 0; i < GFX_NUM_FB_IMAGES; i++) {
+        fb_images[i] = sg_make_image(&(sg_image_desc){
+            .width = fb_width,
+            .height = fb_height,
+            .pixel_format = indexed ? SG_PIXELFORMAT_L8 : SG_PIXELFORMAT_RGBA8,
+            .usage = SG_USAGE_STREAM,
+            .min_filter = indexed ? SG_FILTER_NEAREST : SG_FILTER_LINEAR,
+            .mag_filter = indexed ? SG_FILTER_NEAREST : SG_FILTER_LINEAR,
+            .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+            .wrap_v = SG_WRAP_CLAMP_TO_EDGE
+        });
+    }
+    cur_fb_image = 0;
+    draw_state.fs_images[0] = fb_images[0];
+    if (indexed) {
+        draw_state.fs_images[1] = sg_make_image(&(sg_image_desc){
+            .width = GFX_MAX_PALETTE_COLORS,
+            .height = 1,
+            .pixel_format = SG_PIXELFORMAT_RGBA8,
+            .usage = SG_USAGE_STREAM,
+            .min_filter = SG_FILTER_NEAREST,
+            .mag_filter = SG_FILTER_NEAREST,
+            .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+            .wrap_v = SG_WRAP_CLAMP_TO_EDGE
+        });
+    }
+}
+
+void gfx_init(int w, int h) {
+    _gfx_init(w, h, false);
+}
+
+void gfx_init_indexed(int w, int h, const uint32_t* colors, int num_colors) {
+    _gfx_init(w, h, true);
+    gfx_set_palette(colors, num_colors);
+}
+
+void gfx_set_palette(const uint32_t* colors, int num_colors) {
+    if (num_colors > GFX_MAX_PALETTE_COLORS) {
+        num_colors = GFX_MAX_PALETTE_COLORS;
+    }
+    memcpy(palette, colors, num_colors * sizeof(uint32_t));
+    palette_dirty = true;
+}
+
+/* hash a framebuffer row, the row size must be a multiple of 8 bytes */
+static uint64_t _gfx_hash_row(const uint64_t* ptr, int num_words) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (int i = 0; i < num_words; i++) {
+        h = (h ^ ptr[i]) * 0x100000001b3ULL;
+        h ^= h >> 29;
+    }
+    return h;
+}
+
+/* check which rows have changed since the last upload, returns false if none */
+static bool _gfx_scan_dirty_rows(const void* fb, int row_bytes) {
+    const int num_words = row_bytes / 8;
+    const uint8_t* ptr = (const uint8_t*) fb;
+    int y0 = fb_height, y1 = 0;
+    for (int y = 0; y < fb_height; y++, ptr += row_bytes) {
+        uint64_t h = _gfx_hash_row((const uint64_t*)ptr, num_words);
+        for (int i = num_words*8; i < row_bytes; i++) {
+            h = (h ^ ptr[i]) * 0x100000001b3ULL;
+        }
+        if (!hash_valid || (h != row_hash[y])) {
+            row_hash[y] = h;
+            if (y < y0) {
+                y0 = y;
+            }
+            y1 = y + 1;
+        }
+    }
+    hash_valid = true;
+    if (y0 >= y1) {
+        stats.dirty_y0 = stats.dirty_y1 = 0;
+        return false;
+    }
+    stats.dirty_y0 = y0;
+    stats.dirty_y1 = y1;
+    return true;
+}
+
+void gfx_enable_frame_handoff(void) {
+    frame_size = fb_width * fb_height * (indexed ? 1 : sizeof(uint32_t));
+    for (int i = 0; i < 3; i++) {
+        handoff_frames[i] = (uint8_t*) calloc(1, frame_size);
+    }
+    handoff_back = 0;
+    handoff_ready = 1;
+    handoff_front = 2;
+    handoff = true;
+}
+
+void gfx_disable_frame_handoff(void) {
+    handoff = false;
+    for (int i = 0; i < 3; i++) {
+        free(handoff_frames[i]);
+        handoff_frames[i] = 0;
+    }
+}
+
+/* hand a finished frame to the capture encoder thread */
+static void _gfx_capture_frame(const void* fb) {
+    if (indexed) {
+        capture_push_pal8(&capture, (const uint8_t*)fb, palette);
+    }
+    else {
+        capture_push_rgba8(&capture, (const uint32_t*)fb);
+    }
+}
+
+bool gfx_enable_capture(const char* path) {
+    const size_t len = strlen(path);
+    const bool raw = (len > 4) && (0 == strcmp(path + len - 4, ".raw"));
+    capturing = capture_start(&capture, &(capture_desc_t){
+        .format = raw ? CAPTURE_FORMAT_RAW : CAPTURE_FORMAT_PNG,
+        .path = path,
+        .width = fb_width,
+        .height = fb_height
+    });
+    if (!capturing) {
+        printf("capture: failed to start capturing to '%s'\n", path);
+    }
+    return capturing;
+}
+
+/* create the overlay texture and blending pipeline on first use */
+static void _gfx_init_overlay(void) {
+    overlay_pixels = (uint32_t*) calloc(1, fb_width * fb_height * sizeof(uint32_t));
+    overlay_draw_state.vertex_buffers[0] = draw_state.vertex_buffers[0];
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .fs.images[0] = { .name="tex", .type=SG_IMAGETYPE_2D },
+        .vs.source = vs_src,
+        .fs.source = fs_src,
+    });
+    overlay_draw_state.pipeline = sg_make_pipeline(&(sg_pipeline_desc){
+        .layout = {
+            .attrs[0] = { .name="pos", .sem_name="POSITION", .format=SG_VERTEXFORMAT_FLOAT2 }
+        },
+        .shader = shd,
+        .primitive_type = SG_PRIMITIVETYPE_TRIANGLE_STRIP,
+        .blend = {
+            .enabled = true,
+            .src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA,
+            .dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA
+        }
+    });
+    overlay_draw_state.fs_images[0] = sg_make_image(&(sg_image_desc){
         .width = fb_width,
         .height = fb_height,
         .pixel_format = SG_PIXELFORMAT_RGBA8,
-        .usage = SG_USAGE_STREAM,
-        .min_filter = SG_FILTER_LINEAR,
-        .mag_filter = SG_FILTER_LINEAR,
+        .usage = SG_USAGE_DYNAMIC,
+        .min_filter = SG_FILTER_NEAREST,
+        .mag_filter = SG_FILTER_NEAREST,
         .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
         .wrap_v = SG_WRAP_CLAMP_TO_EDGE
     });
 }
 
+/* fill a rectangle of the overlay, clipped to the overlay size */
+static void _gfx_overlay_fill(int x0, int y0, int x1, int y1, uint32_t color) {
+    x1 = (x1 < fb_width) ? x1 : fb_width;
+    y1 = (y1 < fb_height) ? y1 : fb_height;
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            overlay_pixels[y * fb_width + x] = color;
+        }
+    }
+}
+
+static void _gfx_overlay_glyph(int x0, int y0, char c) {
+    if ((c >= 'a') && (c <= 'z')) {
+        c -= 'a' - 'A';
+    }
+    if ((c < 0x20) || (c > 0x5A)) {
+        return;
+    }
+    const uint8_t* glyph = overlay_font[c - 0x20];
+    for (int y = 0; y < 7; y++) {
+        for (int x = 0; x < 5; x++) {
+            if ((glyph[y] & (0x10 >> x)) && ((x0 + x) < fb_width) && ((y0 + y) < fb_height)) {
+                overlay_pixels[(y0 + y) * fb_width + x0 + x] = GFX_OVERLAY_TEXT_COLOR;
+            }
+        }
+    }
+}
+
+void gfx_set_overlay(const char* text) {
+    overlay_visible = (0 != text);
+    if (!text) {
+        return;
+    }
+    if (!overlay_pixels) {
+        _gfx_init_overlay();
+    }
+    /* size of the text block */
+    int num_lines = 0, max_len = 0, len = 0;
+    for (const char* p = text; ; p++) {
+        if (('\n' == *p) || (0 == *p)) {
+            if (len > 0) {
+                num_lines++;
+            }
+            max_len = (len > max_len) ? len : max_len;
+            len = 0;
+            if (0 == *p) {
+                break;
+            }
+        }
+        else {
+            len++;
+        }
+    }
+    memset(overlay_pixels, 0, fb_width * fb_height * sizeof(uint32_t));
+    if (num_lines > 0) {
+        _gfx_overlay_fill(0, 0, max_len * GFX_GLYPH_WIDTH + 2 * GFX_OVERLAY_BORDER,
+            num_lines * GFX_GLYPH_HEIGHT + 2 * GFX_OVERLAY_BORDER, GFX_OVERLAY_BACK_COLOR);
+    }
+    int x = GFX_OVERLAY_BORDER, y = GFX_OVERLAY_BORDER;
+    for (const char* p = text; *p; p++) {
+        if ('\n' == *p) {
+            x = GFX_OVERLAY_BORDER;
+            y += GFX_GLYPH_HEIGHT;
+        }
+        else {
+            _gfx_overlay_glyph(x, y, *p);
+            x += GFX_GLYPH_WIDTH;
+        }
+    }
+    overlay_dirty = true;
+}
+
+void gfx_publish_frame(void) {
+    if (capturing) {
+        _gfx_capture_frame(indexed ? (const void*)pal8_buffer : (const void*)rgba8_buffer);
+    }
+    memcpy(handoff_frames[handoff_back], indexed ? (const void*)pal8_buffer : (const void*)rgba8_buffer, frame_size);
+    handoff_back = thread_atomic_exchange(&handoff_ready, handoff_back | GFX_FRAME_NEW) & 3;
+}
+
+/* track the time between presenting new emulator frames */
+static void _gfx_track_new_frame(uint64_t now) {
+    if (stats.new_frames > 0) {
+        const double interval = stm_ms(stm_diff(now, last_new_frame_time));
+        frame_interval_sum += interval;
+        frame_interval_sqr_sum += interval * interval;
+        if (interval > stats.frame_interval_max_ms) {
+            stats.frame_interval_max_ms = interval;
+        }
+    }
+    last_new_frame_time = now;
+    stats.new_frames++;
+}
+
 void gfx_draw() {
-    sg_update_image(draw_state.fs_images[0], &(sg_image_content){
-        .subimage[0][0] = { 
-            .ptr = rgba8_buffer,
-            .size = fb_width*fb_height*sizeof(uint32_t)
+    /* sg_update_image() can only update the whole image, so if any row has
+       changed the entire framebuffer is uploaded, otherwise the texture
+       keeps its content from the last upload
+    */
+    const uint64_t start = stm_now();
+    stats.frames++;
+    stats.last_frame_bytes = 0;
+    const void* fb = indexed ? (const void*)pal8_buffer : (const void*)rgba8_buffer;
+    bool new_frame = true;
+    if (handoff) {
+        new_frame = 0 != (thread_atomic_load(&handoff_ready) & GFX_FRAME_NEW);
+        if (new_frame) {
+            handoff_front = thread_atomic_exchange(&handoff_ready, handoff_front) & 3;
         }
-    });
+        fb = handoff_frames[handoff_front];
+    }
+    if (new_frame) {
+        _gfx_track_new_frame(start);
+        if (capturing && !handoff) {
+            _gfx_capture_frame(fb);
+        }
+    }
+    const int row_bytes = fb_width * (indexed ? 1 : (int)sizeof(uint32_t));
+    const bool fb_dirty = new_frame && _gfx_scan_dirty_rows(fb, row_bytes);
+    const uint64_t upload_start = stm_now();
+    stats.last_decode_ms = stm_ms(stm_diff(upload_start, start));
+    if (fb_dirty) {
+        stats.uploads++;
+        stats.last_frame_bytes += row_bytes * fb_height;
+        cur_fb_image = (cur_fb_image + 1) % GFX_NUM_FB_IMAGES;
+        draw_state.fs_images[0] = fb_images[cur_fb_image];
+    }
+    if (indexed) {
+        /* one byte per pixel, plus the palette only when it has changed */
+        if (fb_dirty) {
+            sg_update_image(draw_state.fs_images[0], &(sg_image_content){
+                .subimage[0][0] = {
+                    .ptr = fb,
+                    .size = fb_width*fb_height
+                }
+            });
+        }
+        if (palette_dirty) {
+            palette_dirty = false;
+            stats.last_frame_bytes += sizeof(palette);
+            sg_update_image(draw_state.fs_images[1], &(sg_image_content){
+                .subimage[0][0] = {
+                    .ptr = palette,
+                    .size = sizeof(palette)
+                }
+            });
+        }
+    }
+    else if (fb_dirty) {
+        sg_update_image(draw_state.fs_images[0], &(sg_image_content){
+            .subimage[0][0] = { 
+                .ptr = fb,
+                .size = fb_width*fb_height*sizeof(uint32_t)
+            }
+        });
+    }
+    stats.bytes_uploaded += stats.last_frame_bytes;
+    stats.last_upload_ms = stm_ms(stm_since(upload_start));
+    if (overlay_visible && overlay_dirty) {
+        overlay_dirty = false;
+        sg_update_image(overlay_draw_state.fs_images[0], &(sg_image_content){
+            .subimage[0][0] = {
+                .ptr = overlay_pixels,
+                .size = fb_width*fb_height*sizeof(uint32_t)
+            }
+        });
+    }
     sg_begin_default_pass(&pass_action, sapp_width(), sapp_height());
     sg_apply_draw_state(&draw_state);
     sg_draw(0, 4, 1);
+    if (overlay_visible) {
+        sg_apply_draw_state(&overlay_draw_state);
+        sg_draw(0, 4, 1);
+    }
     sg_end_pass();
     sg_commit();
+    const uint64_t draw_ticks = stm_since(start);
+    stats.draw_ticks += draw_ticks;
+    stats.last_draw_ms = stm_ms(draw_ticks);
+}
+
+gfx_stats_t gfx_stats(void) {
+    gfx_stats_t res = stats;
+    if (stats.new_frames > 1) {
+        const double n = stats.new_frames - 1;
+        const double avg = frame_interval_sum / n;
+        const double var = (frame_interval_sqr_sum / n) - (avg * avg);
+        res.frame_interval_ms = avg;
+        res.frame_jitter_ms = (var > 0.0) ? sqrt(var) : 0.0;
+    }
+    return res;
 }
 
 void gfx_shutdown() {
+    if (stats.frames > 0) {
+        printf("gfx: %u frames, %u framebuffer uploads, %.1f KB uploaded per frame, %.3f ms per gfx_draw()\n",
+            stats.frames, stats.uploads,
+            (double)stats.bytes_uploaded / (1024.0 * stats.frames),
+            stm_ms(stats.draw_ticks) / stats.frames);
+        const gfx_stats_t res = gfx_stats();
+        printf("gfx: %u new frames presented%s, interval %.2f ms, jitter %.2f ms, max %.2f ms\n",
+            res.new_frames, handoff ? " (emulation thread)" : "",
+            res.frame_interval_ms, res.frame_jitter_ms, res.frame_interval_max_ms);
+    }
+    if (capturing) {
+        capture_stop(&capture);
+        capturing = false;
+    }
+    gfx_disable_frame_handoff();
+    free(overlay_pixels);
+    overlay_pixels = 0;
+    overlay_visible = false;
     sg_shutdown();
 }
 
 /* shader source code for GL, GLES2, Metal and D3D11 */
 #if defined(SOKOL_GLCORE33)
-#error "FIXME: SOKOL_GLCORE33"
-/*
 const char* vs_src =
     "#version 330\n"
     "in vec2 pos;\n"
     "out vec2 uv;\n"
     "void main() {\n"
     "  gl_Position = vec4(pos*2.0-1.0, 0.5, 1.0);\n"
-    "  uv0 = vec2(pos.x, 1.0-pos.y);\n"
-    "}\n",
+    "  uv = vec2(pos.x, 1.0-pos.y);\n"
+    "}\n";
 const char* fs_src =
     "#version 330\n"
     "uniform sampler2D tex;\n"
@@ -95,8 +567,17 @@ const char* fs_src =
     "out vec4 frag_color;\n"
     "void main() {\n"
     "  frag_color = texture(tex, uv);\n"
-    "}\n"
-*/
+    "}\n";
+const char* fs_pal_src =
+    "#version 330\n"
+    "uniform sampler2D tex;\n"
+    "uniform sampler2D pal;\n"
+    "in vec2 uv;\n"
+    "out vec4 frag_color;\n"
+    "void main() {\n"
+    "  float index = texture(tex, uv).x * (255.0/256.0) + (0.5/256.0);\n"
+    "  frag_color = texture(pal, vec2(index, 0.5));\n"
+    "}\n";
 #elif defined(SOKOL_GLES2)
 const char* vs_src =
     "attribute vec2 pos;\n"
@@ -112,6 +593,15 @@ const char* fs_src =
     "void main() {\n"
     "  gl_FragColor = texture2D(tex, uv);\n"
     "}\n";
+const char* fs_pal_src =
+    "precision mediump float;\n"
+    "uniform sampler2D tex;"
+    "uniform sampler2D pal;"
+    "varying vec2 uv;\n"
+    "void main() {\n"
+    "  float index = texture2D(tex, uv).x * (255.0/256.0) + (0.5/256.0);\n"
+    "  gl_FragColor = texture2D(pal, vec2(index, 0.5));\n"
+    "}\n";
 #elif defined(SOKOL_METAL)
 const char* vs_src =
     "#include <metal_stdlib>\n"
@@ -138,6 +628,16 @@ const char* fs_src =
     "fragment float4 _main(fs_in in [[stage_in]], texture2d<float> tex [[texture(0)]], sampler smp [[sampler(0)]]) {\n"
     "  return tex.sample(smp, in.uv);\n"
     "}\n";
+const char* fs_pal_src =
+    "#include <metal_stdlib>\n"
+    "using namespace metal;\n"
+    "struct fs_in {\n"
+    "  float2 uv;\n"
+    "};\n"
+    "fragment float4 _main(fs_in in [[stage_in]], texture2d<float> tex [[texture(0)]], sampler smp [[sampler(0)]], texture2d<float> pal [[texture(1)]], sampler pal_smp [[sampler(1)]]) {\n"
+    "  float index = tex.sample(smp, in.uv).x * (255.0/256.0) + (0.5/256.0);\n"
+    "  return pal.sample(pal_smp, float2(index, 0.5));\n"
+    "}\n";
 #elif defined(SOKOL_D3D11)
 const char* vs_src =
     "struct vs_in {\n"
@@ -159,4 +659,13 @@ const char* fs_src =
     "float4 main(float2 uv: TEXCOORD0): SV_Target0 {\n"
     "  return tex.Sample(smp, uv);\n"
     "}\n";
+const char* fs_pal_src =
+    "Texture2D<float4> tex: register(t0);\n"
+    "Texture2D<float4> pal: register(t1);\n"
+    "sampler smp: register(s0);\n"
+    "sampler pal_smp: register(s1);\n"
+    "float4 main(float2 uv: TEXCOORD0): SV_Target0 {\n"
+    "  float index = tex.Sample(smp, uv).x * (255.0/256.0) + (0.5/256.0);\n"
+    "  return pal.Sample(pal_smp, float2(index, 0.5));\n"
+    "}\n";
 #endif
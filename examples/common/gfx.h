@@ -1,10 +1,65 @@
 #pragma once
 /* 
     Common graphics functions for the chips-test example emulators.
+
+    gfx_draw() keeps a hash per framebuffer row and only uploads the
+    framebuffer texture when at least one row has changed since the
+    last upload. On the GL backends the framebuffer is streamed
+    into a small ring of textures, so that an upload doesn't stall
+    on the texture the GPU is still reading from.
+
+    gfx_set_overlay() shows a block of text (e.g. the performance
+    telemetry from common/telemetry.h) in the upper left corner. The
+    text is rendered with a built-in 5x7 font into a separate texture,
+    which is only uploaded when the text changes and is alpha-blended
+    over the emulator display, so the framebuffer itself (and frame
+    capture) is not affected.
 */
+#include <stdint.h>
+#include <stdbool.h>
 #define GFX_MAX_FB_WIDTH (1024)
 #define GFX_MAX_FB_HEIGHT (1024)
+#define GFX_MAX_PALETTE_COLORS (256)
+/* setup for an RGBA8 framebuffer (rgba8_buffer) */
 extern void gfx_init(int w, int h);
+/* setup for an 8-bit indexed framebuffer (pal8_buffer), colors are looked up on the GPU */
+extern void gfx_init_indexed(int w, int h, const uint32_t* palette, int num_colors);
+/* update the palette for the indexed framebuffer */
+extern void gfx_set_palette(const uint32_t* palette, int num_colors);
 extern void gfx_draw(void);
 extern void gfx_shutdown(void);
+
+/* framebuffer upload statistics, printed by gfx_shutdown() */
+typedef struct {
+    uint32_t frames;            /* number of gfx_draw() calls */
+    uint32_t uploads;           /* number of frames which uploaded the framebuffer */
+    uint64_t bytes_uploaded;    /* total number of bytes uploaded */
+    uint32_t last_frame_bytes;  /* bytes uploaded in the last frame */
+    int dirty_y0, dirty_y1;     /* range of changed rows in the last frame (y0 == y1 if unchanged) */
+    uint64_t draw_ticks;        /* total CPU time spent in gfx_draw() in sokol_time ticks */
+    double last_draw_ms;        /* CPU time of the last gfx_draw() call in milliseconds */
+    double last_decode_ms;      /* ...of which the frame handoff and changed row detection */
+    double last_upload_ms;      /* ...of which the framebuffer texture upload */
+    uint32_t new_frames;        /* number of presented frames with new emulator output */
+    double frame_interval_ms;   /* average time between presenting new emulator frames */
+    double frame_jitter_ms;     /* standard deviation of the time between new emulator frames */
+    double frame_interval_max_ms;
+} gfx_stats_t;
+extern gfx_stats_t gfx_stats(void);
+
+/* get emulator frames from an emulation thread via a triple buffer, call after gfx_init() */
+extern void gfx_enable_frame_handoff(void);
+/* switch back to drawing rgba8_buffer or pal8_buffer directly */
+extern void gfx_disable_frame_handoff(void);
+/* called on the emulation thread when rgba8_buffer or pal8_buffer holds a finished frame */
+extern void gfx_publish_frame(void);
+/* capture every finished frame on a background thread, a path ending in '.raw' writes a
+   raw RGBA8 stream, any other path is the file name prefix of a PNG sequence, call after gfx_init()
+*/
+extern bool gfx_enable_capture(const char* path);
+/* show a text overlay over the emulator display, lines are separated by '\n',
+   lower case letters are shown as upper case, pass 0 to hide the overlay
+*/
+extern void gfx_set_overlay(const char* text);
 extern uint32_t rgba8_buffer[GFX_MAX_FB_WIDTH * GFX_MAX_FB_HEIGHT];
+extern uint8_t pal8_buffer[GFX_MAX_FB_WIDTH * GFX_MAX_FB_HEIGHT];
@@ -0,0 +1,115 @@
+#pragma once
+/*
+    A cache of pre-rasterized 8x8 RGBA8 character tiles for the
+    character-mode video decoders (KC87, Z1013).
+
+    Each cache slot holds all 256 characters of a font for one
+    foreground/background color pair. Tiles are rasterized on first
+    use, so decoding a character cell becomes 8 row copies.
+    Slots are keyed by the actual RGBA8 colors (not palette indices),
+    when all slots are in use, the least recently used slot is
+    recycled.
+
+    The cache lives in the system struct behind all emulator state,
+    but isn't part of snapshots. Call glyph_cache_reset() after
+    restoring a snapshot, or when the font changes.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+typedef struct {
+    uint32_t fg;
+    uint32_t bg;
+    uint32_t last_use;
+    bool used;
+    bool valid[256];
+    uint32_t tiles[256][64];
+} glyph_slot_t;
+
+typedef struct {
+    int num_slots;
+    int last_slot;
+    uint32_t clock;
+    uint32_t hits;              /* tile lookups which didn't need rasterizing */
+    uint32_t misses;            /* tile lookups which rasterized a tile */
+} glyph_cache_t;
+
+/* memory used by a glyph cache with the given number of slots */
+static inline uint32_t glyph_cache_size(int num_slots) {
+    return (uint32_t)(sizeof(glyph_cache_t) + num_slots * sizeof(glyph_slot_t));
+}
+
+/* invalidate all slots */
+static inline void glyph_cache_reset(glyph_cache_t* gc, glyph_slot_t* slots) {
+    for (int i = 0; i < gc->num_slots; i++) {
+        slots[i].used = false;
+    }
+    gc->last_slot = 0;
+}
+
+/* initialize a glyph cache with an array of slots */
+static inline void glyph_cache_init(glyph_cache_t* gc, glyph_slot_t* slots, int num_slots) {
+    memset(gc, 0, sizeof(glyph_cache_t));
+    gc->num_slots = num_slots;
+    glyph_cache_reset(gc, slots);
+}
+
+/* find or assign the cache slot for a color pair */
+static inline glyph_slot_t* _glyph_cache_slot(glyph_cache_t* gc, glyph_slot_t* slots, uint32_t fg, uint32_t bg) {
+    glyph_slot_t* slot = &slots[gc->last_slot];
+    if (slot->used && (slot->fg == fg) && (slot->bg == bg)) {
+        slot->last_use = ++gc->clock;
+        return slot;
+    }
+    int free_slot = -1;
+    int lru = 0;
+    for (int i = 0; i < gc->num_slots; i++) {
+        slot = &slots[i];
+        if (!slot->used) {
+            if (free_slot < 0) {
+                free_slot = i;
+            }
+        }
+        else if ((slot->fg == fg) && (slot->bg == bg)) {
+            gc->last_slot = i;
+            slot->last_use = ++gc->clock;
+            return slot;
+        }
+        else if (slot->last_use < slots[lru].last_use) {
+            lru = i;
+        }
+    }
+    if (free_slot >= 0) {
+        lru = free_slot;
+    }
+    slot = &slots[lru];
+    slot->fg = fg;
+    slot->bg = bg;
+    slot->used = true;
+    slot->last_use = ++gc->clock;
+    memset(slot->valid, 0, sizeof(slot->valid));
+    gc->last_slot = lru;
+    return slot;
+}
+
+/* get the 8x8 RGBA8 tile for a character of an 8x8 font (8 bytes per character, MSB is leftmost pixel) */
+static inline const uint32_t* glyph_cache_tile(glyph_cache_t* gc, glyph_slot_t* slots, const uint8_t* font, uint8_t chr, uint32_t fg, uint32_t bg) {
+    glyph_slot_t* slot = _glyph_cache_slot(gc, slots, fg, bg);
+    uint32_t* tile = slot->tiles[chr];
+    if (slot->valid[chr]) {
+        gc->hits++;
+    }
+    else {
+        const uint8_t* src = &font[chr<<3];
+        for (int py = 0; py < 8; py++) {
+            const uint8_t pixels = src[py];
+            for (int px = 0; px < 8; px++) {
+                tile[(py<<3) + px] = (pixels & (0x80>>px)) ? fg : bg;
+            }
+        }
+        slot->valid[chr] = true;
+        gc->misses++;
+    }
+    return tile;
+}
@@ -0,0 +1,150 @@
+#pragma once
+/*
+    Per-page memory access heatmap.
+
+    Counts the CPU's memory and IO accesses per 256-byte page and access
+    kind (read, write, opcode fetch, IO), fed from the MREQ/IORQ branches
+    of the tick callbacks. The kind is computed from the pins without
+    branches (bit 0: write, bit 1: opcode fetch, both bits: IO), so
+    counting is a single increment of a table entry:
+
+        heatmap_count(sys->heatmap, HEATMAP_KIND(write, fetch), addr);
+
+    The counters are totals since heatmap_init(), heatmap_frame() returns
+    the counts since the previous heatmap_frame() call (e.g. per emulated
+    frame). heatmap_save_csv() writes the totals as a table (one row per
+    page), heatmap_save_ppm() as an image with one 16x16 page grid per
+    access kind (log-scaled).
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* access kinds */
+#define HEATMAP_READ (0)
+#define HEATMAP_WRITE (1)
+#define HEATMAP_FETCH (2)
+#define HEATMAP_IO (3)
+#define HEATMAP_NUM_KINDS (4)
+
+/* access kind from two conditions without branches (fetch and write are exclusive) */
+#define HEATMAP_KIND(write, fetch) ((int)(0 != (write)) | ((int)(0 != (fetch)) << 1))
+
+/* the heatmap image: 4 page grids side by side, 8x8 pixels per page */
+#define HEATMAP_CELL_SIZE (8)
+#define HEATMAP_IMAGE_WIDTH (HEATMAP_NUM_KINDS * 16 * HEATMAP_CELL_SIZE)
+#define HEATMAP_IMAGE_HEIGHT (16 * HEATMAP_CELL_SIZE)
+
+typedef struct {
+    uint32_t counts[HEATMAP_NUM_KINDS][256];
+} heatmap_frame_t;
+
+typedef struct {
+    uint64_t counts[HEATMAP_NUM_KINDS][256];    /* totals since heatmap_init() */
+    uint64_t prev[HEATMAP_NUM_KINDS][256];      /* totals at the last heatmap_frame() */
+} heatmap_t;
+
+static const char* _heatmap_kind_names[HEATMAP_NUM_KINDS] = { "read", "write", "fetch", "io" };
+
+static inline void heatmap_init(heatmap_t* h) {
+    memset(h, 0, sizeof(heatmap_t));
+}
+
+static inline void heatmap_count(heatmap_t* h, int kind, uint16_t addr) {
+    h->counts[kind][addr >> 8]++;
+}
+
+/* the accesses since the previous call */
+static inline void heatmap_frame(heatmap_t* h, heatmap_frame_t* out) {
+    for (int k = 0; k < HEATMAP_NUM_KINDS; k++) {
+        for (int p = 0; p < 256; p++) {
+            out->counts[k][p] = (uint32_t)(h->counts[k][p] - h->prev[k][p]);
+        }
+    }
+    memcpy(h->prev, h->counts, sizeof(h->prev));
+}
+
+/* total number of accesses of one kind */
+static inline uint64_t heatmap_total(const heatmap_t* h, int kind) {
+    uint64_t total = 0;
+    for (int p = 0; p < 256; p++) {
+        total += h->counts[kind][p];
+    }
+    return total;
+}
+
+/* write the totals as CSV, one row per page with at least one access */
+static inline bool heatmap_save_csv(const heatmap_t* h, const char* path) {
+    FILE* fp = fopen(path, "w");
+    if (!fp) {
+        return false;
+    }
+    fprintf(fp, "page,%s,%s,%s,%s\n", _heatmap_kind_names[0], _heatmap_kind_names[1], _heatmap_kind_names[2], _heatmap_kind_names[3]);
+    for (int p = 0; p < 256; p++) {
+        if (h->counts[0][p] | h->counts[1][p] | h->counts[2][p] | h->counts[3][p]) {
+            fprintf(fp, "%02X00,%llu,%llu,%llu,%llu\n", p,
+                (unsigned long long)h->counts[0][p], (unsigned long long)h->counts[1][p],
+                (unsigned long long)h->counts[2][p], (unsigned long long)h->counts[3][p]);
+        }
+    }
+    const bool ok = !ferror(fp);
+    fclose(fp);
+    return ok;
+}
+
+/* approximate log2(1 + v) (linear between powers of 2, no libm needed) */
+static inline double _heatmap_log2(uint64_t v) {
+    v++;
+    int bit = 63;
+    while (0 == (v & (1ULL << bit))) {
+        bit--;
+    }
+    return (double)bit + ((double)(v - (1ULL << bit)) / (double)(1ULL << bit));
+}
+
+/* log-scaled black => red => yellow => white ramp, t is 0..1 */
+static inline void _heatmap_color(double t, uint8_t* rgb) {
+    const double c = t * 3.0;
+    rgb[0] = (uint8_t)(255.0 * ((c > 1.0) ? 1.0 : c));
+    rgb[1] = (uint8_t)(255.0 * ((c > 2.0) ? 1.0 : ((c > 1.0) ? (c - 1.0) : 0.0)));
+    rgb[2] = (uint8_t)(255.0 * ((c > 2.0) ? (c - 2.0) : 0.0));
+}
+
+/* write the totals as binary PPM image, one 16x16 page grid per access kind
+   (read, write, fetch, io from left to right, page 00 top left), each
+   grid is scaled to its own maximum
+*/
+static inline bool heatmap_save_ppm(const heatmap_t* h, const char* path) {
+    static uint8_t rgb[HEATMAP_IMAGE_HEIGHT][HEATMAP_IMAGE_WIDTH][3];
+    for (int k = 0; k < HEATMAP_NUM_KINDS; k++) {
+        uint64_t max_count = 0;
+        for (int p = 0; p < 256; p++) {
+            if (h->counts[k][p] > max_count) {
+                max_count = h->counts[k][p];
+            }
+        }
+        const double scale = (max_count > 0) ? (1.0 / _heatmap_log2(max_count)) : 0.0;
+        for (int p = 0; p < 256; p++) {
+            uint8_t color[3];
+            _heatmap_color(_heatmap_log2(h->counts[k][p]) * scale, color);
+            const int x0 = (k * 16 + (p & 15)) * HEATMAP_CELL_SIZE;
+            const int y0 = (p >> 4) * HEATMAP_CELL_SIZE;
+            for (int y = 0; y < HEATMAP_CELL_SIZE; y++) {
+                for (int x = 0; x < HEATMAP_CELL_SIZE; x++) {
+                    /* one pixel gaps between the grids */
+                    const bool gap = ((p & 15) == 15) && (x == (HEATMAP_CELL_SIZE - 1));
+                    memcpy(rgb[y0 + y][x0 + x], gap ? (const uint8_t*)"\x40\x40\x40" : color, 3);
+                }
+            }
+        }
+    }
+    FILE* fp = fopen(path, "wb");
+    if (!fp) {
+        return false;
+    }
+    fprintf(fp, "P6\n%d %d\n255\n", HEATMAP_IMAGE_WIDTH, HEATMAP_IMAGE_HEIGHT);
+    const bool ok = 1 == fwrite(rgb, sizeof(rgb), 1, fp);
+    fclose(fp);
+    return ok;
+}
@@ -0,0 +1,207 @@
+#pragma once
+/*
+    Cycle-stamped input event queue.
+
+    Key events from the host are not applied to the emulator immediately,
+    instead they are stamped with the emulated tick at which they should
+    apply and pushed into a fixed-size ring buffer. inputq_exec() is called
+    instead of the system's exec function, it runs the emulator in slices
+    up to the tick of the next queued event, applies the event through the
+    key callback, and also calls the update callback (kbd_update) at a
+    fixed emulated tick interval instead of once per host frame.
+
+    This way, key timing no longer depends on where the host frame
+    boundaries fall, and a recorded input log replays deterministically:
+    events are applied at the first instruction boundary at or after
+    their tick, no matter how the emulated time is split into host frames.
+
+    New events are stamped with the current tick of the queue (the
+    emulated time at the start of the next inputq_exec() call), so they
+    are applied as early as possible. The queue tick only advances in
+    inputq_exec(), so frames which are emulated ahead and rolled back
+    (run-ahead) or re-run from the rewind history must call the system's
+    exec function directly.
+
+    Input log format (text, one event per line):
+
+        tick key d|u
+
+    When a log is replayed, the events from the log are applied at their
+    recorded ticks, and events pushed by the host are ignored. To replay
+    a log, the emulator must run from the same initial state as during
+    recording, without rewinding.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <assert.h>
+
+#define INPUTQ_MAX_EVENTS (256)         /* must be a power of two */
+
+typedef struct {
+    uint64_t tick;          /* emulated tick at which the event is applied */
+    int key;                /* key code as passed to kbd_key_down/kbd_key_up */
+    bool down;
+} inputq_event_t;
+
+typedef struct {
+    uint32_t (*exec_cb)(void* user_data, uint32_t ticks);   /* run the emulator for at least ticks */
+    void (*key_cb)(void* user_data, int key, bool down);    /* apply a key event */
+    void (*update_cb)(void* user_data);                     /* optional, called every update_ticks */
+    uint32_t update_ticks;                                  /* for instance FREQ/50 */
+    void* user_data;
+} inputq_desc_t;
+
+typedef struct {
+    inputq_desc_t desc;
+    uint64_t tick;              /* emulated ticks executed through inputq_exec() */
+    uint64_t next_update;       /* tick of the next update_cb call */
+    uint32_t head, tail;
+    inputq_event_t events[INPUTQ_MAX_EVENTS];
+    uint32_t num_dropped;       /* events dropped because the ring buffer was full */
+    FILE* record_fp;            /* optional input log being recorded */
+    inputq_event_t* replay;     /* optional input log being replayed */
+    uint32_t replay_num;
+    uint32_t replay_pos;
+} inputq_t;
+
+static inline void inputq_init(inputq_t* q, const inputq_desc_t* desc) {
+    assert(desc->exec_cb && desc->key_cb);
+    assert(!desc->update_cb || (desc->update_ticks > 0));
+    memset(q, 0, sizeof(inputq_t));
+    q->desc = *desc;
+    q->next_update = desc->update_ticks;
+}
+
+/* push a key event, stamped with the current tick, ignored while replaying */
+static inline bool inputq_push(inputq_t* q, int key, bool down) {
+    if (q->replay) {
+        return false;
+    }
+    if ((q->tail - q->head) >= INPUTQ_MAX_EVENTS) {
+        q->num_dropped++;
+        return false;
+    }
+    inputq_event_t* e = &q->events[q->tail++ & (INPUTQ_MAX_EVENTS-1)];
+    e->tick = q->tick;
+    e->key = key;
+    e->down = down;
+    return true;
+}
+
+/* record the applied events into a text file */
+static inline bool inputq_record(inputq_t* q, const char* path) {
+    q->record_fp = fopen(path, "w");
+    return 0 != q->record_fp;
+}
+
+/* load an input log, its events replace the host input */
+static inline bool inputq_replay(inputq_t* q, const char* path) {
+    FILE* fp = fopen(path, "r");
+    if (!fp) {
+        return false;
+    }
+    uint32_t cap = 0;
+    uint64_t tick;
+    int key;
+    char type;
+    bool ok = true;
+    while (3 == fscanf(fp, "%"SCNu64" %d %c", &tick, &key, &type)) {
+        if ((q->replay_num > 0) && (tick < q->replay[q->replay_num-1].tick)) {
+            /* events must be sorted by tick */
+            ok = false;
+            break;
+        }
+        if (q->replay_num == cap) {
+            cap = cap ? (2 * cap) : 256;
+            q->replay = (inputq_event_t*) realloc(q->replay, cap * sizeof(inputq_event_t));
+        }
+        inputq_event_t* e = &q->replay[q->replay_num++];
+        e->tick = tick;
+        e->key = key;
+        e->down = (type == 'd');
+    }
+    ok &= 0 != feof(fp);
+    fclose(fp);
+    if (!ok || !q->replay) {
+        free(q->replay);
+        q->replay = 0;
+        q->replay_num = 0;
+        return false;
+    }
+    return true;
+}
+
+/* true while a replayed input log has events left */
+static inline bool inputq_replaying(const inputq_t* q) {
+    return q->replay && (q->replay_pos < q->replay_num);
+}
+
+/* close the input log being recorded, and free the replayed input log */
+static inline void inputq_close(inputq_t* q) {
+    if (q->record_fp) {
+        fclose(q->record_fp);
+        q->record_fp = 0;
+    }
+    free(q->replay);
+    q->replay = 0;
+    q->replay_num = q->replay_pos = 0;
+}
+
+/* the next pending event, or 0 */
+static inline const inputq_event_t* _inputq_peek(const inputq_t* q) {
+    if (q->replay) {
+        return (q->replay_pos < q->replay_num) ? &q->replay[q->replay_pos] : 0;
+    }
+    return (q->head != q->tail) ? &q->events[q->head & (INPUTQ_MAX_EVENTS-1)] : 0;
+}
+
+static inline void _inputq_pop(inputq_t* q) {
+    if (q->replay) {
+        q->replay_pos++;
+    }
+    else {
+        q->head++;
+    }
+}
+
+/* run the emulator for at least ticks, applying queued events and updates at their ticks */
+static inline uint32_t inputq_exec(inputq_t* q, uint32_t ticks) {
+    if (0 == ticks) {
+        return 0;
+    }
+    const uint64_t end = q->tick + ticks;
+    uint32_t executed = 0;
+    do {
+        const inputq_event_t* e;
+        while ((e = _inputq_peek(q)) && (e->tick <= q->tick)) {
+            q->desc.key_cb(q->desc.user_data, e->key, e->down);
+            if (q->record_fp) {
+                fprintf(q->record_fp, "%"PRIu64" %d %c\n", e->tick, e->key, e->down ? 'd' : 'u');
+            }
+            _inputq_pop(q);
+        }
+        if (q->desc.update_cb) {
+            while (q->next_update <= q->tick) {
+                q->desc.update_cb(q->desc.user_data);
+                q->next_update += q->desc.update_ticks;
+            }
+        }
+        /* run up to the next event, update or the end of the requested time slice */
+        uint64_t stop = end;
+        if (e && (e->tick < stop)) {
+            stop = e->tick;
+        }
+        if (q->desc.update_cb && (q->next_update < stop)) {
+            stop = q->next_update;
+        }
+        const uint32_t n = q->desc.exec_cb(q->desc.user_data, (uint32_t)(stop - q->tick));
+        q->tick += n;
+        executed += n;
+    }
+    while (q->tick < end);
+    return executed;
+}
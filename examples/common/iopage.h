@@ -0,0 +1,35 @@
+#pragma once
+/*
+    Page-indexed address decoding for the system cores.
+
+    An iopage_t holds one byte per 256-byte page of the 16-bit address
+    space. The system decides what the byte means (a device id for
+    memory-mapped IO like on the C64 and Atom, or a mask of selected
+    chips for the partially decoded CPC IO ports), so that the tick
+    callback only needs a single table lookup to find out which
+    device(s) an address belongs to. Tables are rebuilt whenever the
+    address decoding changes (e.g. on a memory mapping change).
+*/
+#include <stdint.h>
+#include <string.h>
+
+typedef struct {
+    uint8_t page[256];
+} iopage_t;
+
+/* set all pages to the same value */
+static inline void iopage_init(iopage_t* t, uint8_t val) {
+    memset(t->page, val, sizeof(t->page));
+}
+
+/* set the value of an address range, addr and size must be multiples of 256 */
+static inline void iopage_map(iopage_t* t, uint16_t addr, uint32_t size, uint8_t val) {
+    for (uint32_t i = (addr >> 8); (i < 256) && (size >= 256); i++, size -= 256) {
+        t->page[i] = val;
+    }
+}
+
+/* get the value for an address */
+static inline uint8_t iopage_get(const iopage_t* t, uint16_t addr) {
+    return t->page[addr >> 8];
+}
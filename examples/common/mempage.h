@@ -0,0 +1,64 @@
+#pragma once
+/*
+    Direct page-pointer access for chips mem_t.
+
+    mem_rd() and mem_wr() do a page-table lookup for every byte, which is
+    fine for the CPU tick callbacks, but wasteful for bulk copies (program
+    loaders, test setup, video decoders walking through a mapped address
+    range). The helpers here resolve the page once and hand out the host
+    pointer together with the number of bytes until the end of the page
+    (pages are MEM_PAGE_SIZE bytes, and contiguous within a page), so that
+    the caller can use plain pointer access or memcpy for the whole run.
+
+    The pointers are only valid until the next memory mapping change.
+    Unmapped pages resolve to the mem_t junk page, just like mem_rd/mem_wr.
+*/
+#include <stdint.h>
+#include <string.h>
+#include "chips/mem.h"
+
+/* get the host read pointer for an address, and the bytes until the end of its page */
+static inline const uint8_t* mem_page_readptr(const mem_t* mem, uint16_t addr, uint32_t* out_avail) {
+    if (out_avail) {
+        *out_avail = MEM_PAGE_SIZE - (addr & MEM_PAGE_MASK);
+    }
+    return mem->page_table[addr >> MEM_PAGE_SHIFT].read_ptr + (addr & MEM_PAGE_MASK);
+}
+
+/* get the host write pointer for an address, and the bytes until the end of its page */
+static inline uint8_t* mem_page_writeptr(mem_t* mem, uint16_t addr, uint32_t* out_avail) {
+    if (out_avail) {
+        *out_avail = MEM_PAGE_SIZE - (addr & MEM_PAGE_MASK);
+    }
+    return mem->page_table[addr >> MEM_PAGE_SHIFT].write_ptr + (addr & MEM_PAGE_MASK);
+}
+
+/* copy bytes out of the CPU-visible address space (wraps around at 0xFFFF) */
+static inline void mem_copy_from(const mem_t* mem, uint16_t addr, void* dst, uint32_t num_bytes) {
+    uint8_t* d = (uint8_t*) dst;
+    while (num_bytes > 0) {
+        uint32_t avail;
+        const uint8_t* src = mem_page_readptr(mem, addr, &avail);
+        uint32_t n = (num_bytes < avail) ? num_bytes : avail;
+        memcpy(d, src, n);
+        d += n;
+        addr = (uint16_t)(addr + n);
+        num_bytes -= n;
+    }
+}
+
+/* copy bytes into the CPU-visible address space, honouring ROM write-through
+   (same result as mem_write_range(), but with one lookup per page)
+*/
+static inline void mem_copy_to(mem_t* mem, uint16_t addr, const void* src, uint32_t num_bytes) {
+    const uint8_t* s = (const uint8_t*) src;
+    while (num_bytes > 0) {
+        uint32_t avail;
+        uint8_t* dst = mem_page_writeptr(mem, addr, &avail);
+        uint32_t n = (num_bytes < avail) ? num_bytes : avail;
+        memcpy(dst, s, n);
+        s += n;
+        addr = (uint16_t)(addr + n);
+        num_bytes -= n;
+    }
+}
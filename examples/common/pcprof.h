@@ -0,0 +1,248 @@
+#pragma once
+/*
+    PC-sampling profiler for emulated programs.
+
+    The system tick callbacks call pcprof_tick() with the number of ticks
+    and the address of the current opcode fetch (Z80 M1 cycle, 6502 SYNC
+    cycle). Every 'interval' ticks, the next opcode fetch address is
+    counted in a 64K-entry histogram, so the cost per tick is one
+    subtraction and compare. The period is randomly jittered around the
+    interval, so that loops with a length which divides the interval
+    don't always get sampled at the same instruction. When no profiler is attached to a system,
+    the tick callbacks only test a null pointer.
+
+    pcprof_report() writes the hottest addresses (and the hottest labels,
+    with the samples of all addresses belonging to a label folded
+    together), optionally symbolized with a label file loaded by
+    pcprof_load_labels(). Label files can have one of these line formats
+    (hex addresses, ';' starts a comment):
+
+        C000 label          ($C000 and 0xC000 are also accepted)
+        label = $C000       (or 'label equ $C000')
+        al C:c000 .label    (VICE monitor labels)
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define PCPROF_DEFAULT_INTERVAL (64)
+#define PCPROF_MAX_LABEL_LEN (32)
+#define PCPROF_MAX_LABEL_DIST (0x400)  /* addresses further behind a label are not symbolized */
+
+typedef struct {
+    uint32_t interval;          /* sample every N ticks */
+    int32_t countdown;          /* ticks until the next sample is taken */
+    uint32_t rand;              /* xorshift state for the period jitter */
+    uint64_t num_samples;
+    uint32_t hist[1<<16];       /* samples per address */
+} pcprof_t;
+
+typedef struct {
+    uint16_t addr;
+    char name[PCPROF_MAX_LABEL_LEN];
+} pcprof_label_t;
+
+typedef struct {
+    int num;
+    pcprof_label_t* items;      /* sorted by address */
+} pcprof_labels_t;
+
+/* initialize a profiler, interval is the sampling period in CPU ticks (0 for default) */
+static inline void pcprof_init(pcprof_t* p, uint32_t interval) {
+    memset(p, 0, sizeof(pcprof_t));
+    p->interval = interval > 0 ? interval : PCPROF_DEFAULT_INTERVAL;
+    p->countdown = (int32_t) p->interval;
+    p->rand = 0x6D98302B;
+}
+
+/* clear the histogram */
+static inline void pcprof_reset(pcprof_t* p) {
+    pcprof_init(p, p->interval);
+}
+
+/* call from the tick callback, fetch is true in an opcode fetch cycle */
+static inline void pcprof_tick(pcprof_t* p, int num_ticks, bool fetch, uint16_t addr) {
+    p->countdown -= num_ticks;
+    if ((p->countdown <= 0) && fetch) {
+        p->hist[addr]++;
+        p->num_samples++;
+        /* next sample in interval/2 .. interval*3/2 ticks */
+        uint32_t x = p->rand;
+        x ^= x<<13; x ^= x>>17; x ^= x<<5;
+        p->rand = x;
+        p->countdown = (int32_t) ((p->interval>>1) + (x % (p->interval + 1)));
+    }
+}
+
+static inline bool _pcprof_parse_hex(const char* str, uint16_t* out) {
+    if (str[0] == '$') {
+        str++;
+    }
+    else if ((str[0] == '0') && ((str[1] == 'x') || (str[1] == 'X'))) {
+        str += 2;
+    }
+    char* end;
+    unsigned long val = strtoul(str, &end, 16);
+    if ((end == str) || (*end != 0) || (val > 0xFFFF)) {
+        return false;
+    }
+    *out = (uint16_t) val;
+    return true;
+}
+
+static inline int _pcprof_cmp_labels(const void* a, const void* b) {
+    return (int)((const pcprof_label_t*)a)->addr - (int)((const pcprof_label_t*)b)->addr;
+}
+
+/* load a label file, returns false if the file can't be opened */
+static inline bool pcprof_load_labels(pcprof_labels_t* labels, const char* path) {
+    memset(labels, 0, sizeof(pcprof_labels_t));
+    FILE* fp = fopen(path, "r");
+    if (!fp) {
+        return false;
+    }
+    int cap = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), fp)) {
+        char* comment = strchr(line, ';');
+        if (comment) {
+            *comment = 0;
+        }
+        /* split into up to 3 tokens */
+        char* tok[3] = { 0 };
+        int num_tok = 0;
+        for (char* s = strtok(line, " \t\r\n="); s && (num_tok < 3); s = strtok(0, " \t\r\n=")) {
+            tok[num_tok++] = s;
+        }
+        uint16_t addr;
+        const char* name = 0;
+        if ((num_tok == 3) && (0 == strcmp(tok[0], "al")) && (strlen(tok[1]) > 2) && (tok[1][1] == ':')) {
+            /* VICE: al C:c000 .label */
+            if (_pcprof_parse_hex(tok[1] + 2, &addr)) {
+                name = (tok[2][0] == '.') ? tok[2] + 1 : tok[2];
+            }
+        }
+        else if ((num_tok >= 2) && _pcprof_parse_hex(tok[0], &addr)) {
+            /* C000 label */
+            name = tok[1];
+        }
+        else if ((num_tok >= 2) && _pcprof_parse_hex(tok[num_tok-1], &addr) && (isalpha((unsigned char)tok[0][0]) || (tok[0][0] == '_'))) {
+            /* label = $C000, label equ $C000 */
+            name = tok[0];
+        }
+        if (name) {
+            if (labels->num == cap) {
+                cap = cap ? cap * 2 : 256;
+                labels->items = (pcprof_label_t*) realloc(labels->items, (size_t)cap * sizeof(pcprof_label_t));
+            }
+            pcprof_label_t* l = &labels->items[labels->num++];
+            l->addr = addr;
+            strncpy(l->name, name, PCPROF_MAX_LABEL_LEN - 1);
+            l->name[PCPROF_MAX_LABEL_LEN - 1] = 0;
+        }
+    }
+    fclose(fp);
+    if (labels->num > 0) {
+        qsort(labels->items, (size_t)labels->num, sizeof(pcprof_label_t), _pcprof_cmp_labels);
+    }
+    return true;
+}
+
+static inline void pcprof_free_labels(pcprof_labels_t* labels) {
+    free(labels->items);
+    memset(labels, 0, sizeof(pcprof_labels_t));
+}
+
+/* find the label an address belongs to (the closest label in front of it), or -1 */
+static inline int pcprof_find_label(const pcprof_labels_t* labels, uint16_t addr) {
+    if (!labels || (0 == labels->num)) {
+        return -1;
+    }
+    int lo = 0, hi = labels->num - 1, found = -1;
+    while (lo <= hi) {
+        const int mid = (lo + hi) / 2;
+        if (labels->items[mid].addr <= addr) {
+            found = mid;
+            lo = mid + 1;
+        }
+        else {
+            hi = mid - 1;
+        }
+    }
+    if ((found >= 0) && ((addr - labels->items[found].addr) < PCPROF_MAX_LABEL_DIST)) {
+        return found;
+    }
+    return -1;
+}
+
+typedef struct {
+    uint32_t count;
+    int index;      /* address or label index */
+} _pcprof_entry_t;
+
+static inline int _pcprof_cmp_entries(const void* a, const void* b) {
+    const _pcprof_entry_t* ea = (const _pcprof_entry_t*) a;
+    const _pcprof_entry_t* eb = (const _pcprof_entry_t*) b;
+    if (ea->count != eb->count) {
+        return (ea->count < eb->count) ? 1 : -1;
+    }
+    return ea->index - eb->index;
+}
+
+/* write the max_entries hottest addresses (and labels if provided) sorted by sample count */
+static inline void pcprof_report(const pcprof_t* p, const pcprof_labels_t* labels, FILE* fp, int max_entries) {
+    const double total = (p->num_samples > 0) ? (double)p->num_samples : 1.0;
+    _pcprof_entry_t* entries = (_pcprof_entry_t*) malloc((1<<16) * sizeof(_pcprof_entry_t));
+    int num = 0;
+    for (int addr = 0; addr < (1<<16); addr++) {
+        if (p->hist[addr] > 0) {
+            entries[num].count = p->hist[addr];
+            entries[num].index = addr;
+            num++;
+        }
+    }
+    qsort(entries, (size_t)num, sizeof(_pcprof_entry_t), _pcprof_cmp_entries);
+    fprintf(fp, "PC profile: %llu samples (every %u ticks), %d addresses\n",
+        (unsigned long long)p->num_samples, p->interval, num);
+    for (int i = 0; (i < num) && (i < max_entries); i++) {
+        const uint16_t addr = (uint16_t) entries[i].index;
+        const int l = pcprof_find_label(labels, addr);
+        fprintf(fp, "  %6.2f%% %10u  %04X", 100.0 * entries[i].count / total, entries[i].count, addr);
+        if (l >= 0) {
+            const int offset = addr - labels->items[l].addr;
+            if (offset > 0) {
+                fprintf(fp, "  %s+%d", labels->items[l].name, offset);
+            }
+            else {
+                fprintf(fp, "  %s", labels->items[l].name);
+            }
+        }
+        fprintf(fp, "\n");
+    }
+    if (labels && (labels->num > 0)) {
+        /* fold the samples per label */
+        num = 0;
+        for (int i = 0; i < labels->num; i++) {
+            entries[i].count = 0;
+            entries[i].index = i;
+        }
+        for (int addr = 0; addr < (1<<16); addr++) {
+            if (p->hist[addr] > 0) {
+                const int l = pcprof_find_label(labels, (uint16_t)addr);
+                if (l >= 0) {
+                    entries[l].count += p->hist[addr];
+                }
+            }
+        }
+        qsort(entries, (size_t)labels->num, sizeof(_pcprof_entry_t), _pcprof_cmp_entries);
+        fprintf(fp, "by label:\n");
+        for (int i = 0; (i < labels->num) && (i < max_entries) && (entries[i].count > 0); i++) {
+            const pcprof_label_t* l = &labels->items[entries[i].index];
+            fprintf(fp, "  %6.2f%% %10u  %04X  %s\n", 100.0 * entries[i].count / total, entries[i].count, l->addr, l->name);
+        }
+    }
+    free(entries);
+}
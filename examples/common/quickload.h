@@ -0,0 +1,61 @@
+#pragma once
+/*
+    Reading program files for the quickloaders of the system cores
+    ('-load file' command line arg of the examples).
+
+    The system cores have no tape or disc emulation, their quickload
+    functions copy a program image straight into RAM (and set the CPU
+    registers for snapshot formats), so that the program can run in the
+    next frame instead of after the real-time loading duration.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+/* largest accepted program file (a 128K .sna is 144 KB) */
+#define QUICKLOAD_MAX_SIZE (1<<20)
+
+/* read a whole file into a malloc'ed buffer, returns 0 on failure */
+static inline uint8_t* quickload_read(const char* path, uint32_t* out_size) {
+    *out_size = 0;
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        return 0;
+    }
+    uint8_t* buf = 0;
+    long size = -1;
+    if (0 == fseek(fp, 0, SEEK_END)) {
+        size = ftell(fp);
+    }
+    if ((size > 0) && (size <= QUICKLOAD_MAX_SIZE) && (0 == fseek(fp, 0, SEEK_SET))) {
+        buf = (uint8_t*) malloc((size_t)size);
+        if (buf && (1 != fread(buf, (size_t)size, 1, fp))) {
+            free(buf);
+            buf = 0;
+        }
+    }
+    fclose(fp);
+    if (buf) {
+        *out_size = (uint32_t)size;
+    }
+    return buf;
+}
+
+/* case-insensitive file extension check, ext includes the dot */
+static inline bool quickload_has_ext(const char* path, const char* ext) {
+    const size_t path_len = strlen(path);
+    const size_t ext_len = strlen(ext);
+    if (path_len < ext_len) {
+        return false;
+    }
+    const char* p = path + path_len - ext_len;
+    for (size_t i = 0; i < ext_len; i++) {
+        if (tolower((unsigned char)p[i]) != tolower((unsigned char)ext[i])) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,331 @@
+#pragma once
+/*
+    rewind.h
+
+    A history ring buffer of per-frame system snapshots (see snapshot.h).
+
+    Every few frames a keyframe is stored, all other frames are stored
+    as the XOR delta against the most recent keyframe, and both are
+    run-length encoded (runs of zero bytes are skipped). Since only a
+    few hundred bytes of a 64..128 KByte machine state change within
+    a handful of frames, a frame typically compresses to a few hundred
+    bytes, and minutes of history fit into a few MBytes.
+
+    When the byte buffer or frame ring is full, the oldest frames are
+    dropped, always up to the next keyframe so that no delta frame
+    is orphaned.
+
+    Do this:
+        #define CHIPS_IMPL
+    before you include this file in *one* C file to create the
+    implementation.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct {
+    uint32_t snapshot_size;     /* size of one system snapshot in bytes */
+    uint32_t buffer_size;       /* size of the compressed history buffer in bytes */
+    int max_frames;             /* max number of frames in the history */
+    int keyframe_interval;      /* store a keyframe every N frames (default: 64) */
+} rewind_desc_t;
+
+typedef struct {
+    uint32_t offset;            /* byte offset into the history buffer */
+    uint32_t size;              /* encoded size in bytes */
+    bool keyframe;
+} rewind_frame_t;
+
+typedef struct {
+    uint32_t snapshot_size;
+    int keyframe_interval;
+    int max_frames;
+    rewind_frame_t* frames;     /* ring of max_frames frame entries */
+    int oldest;                 /* index of the oldest frame entry */
+    int num_frames;             /* number of frames in the history */
+    int key_index;              /* ring index of the newest keyframe, or -1 */
+    uint8_t* buf;               /* the compressed history buffer */
+    uint32_t buf_size;
+    uint32_t head;              /* next write offset into buf */
+    uint8_t* key_raw;           /* decoded newest keyframe */
+    uint8_t* scratch;           /* encoder output, worst-case size */
+} rewind_t;
+
+/* allocate and initialize a rewind history */
+extern bool rewind_init(rewind_t* rw, const rewind_desc_t* desc);
+/* free a rewind history */
+extern void rewind_discard(rewind_t* rw);
+/* clear the history */
+extern void rewind_reset(rewind_t* rw);
+/* push a new frame snapshot to the history */
+extern void rewind_push(rewind_t* rw, const uint8_t* snapshot);
+/* decode the snapshot N frames back (0 is the newest frame) into out_snapshot */
+extern bool rewind_get(rewind_t* rw, int frames_back, uint8_t* out_snapshot);
+/* drop the N newest frames (e.g. after rewinding) */
+extern void rewind_pop(rewind_t* rw, int num);
+/* number of bytes currently used by the compressed history */
+extern uint32_t rewind_bytes_used(const rewind_t* rw);
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#ifdef CHIPS_IMPL
+#include <stdlib.h>
+#include <string.h>
+#ifndef CHIPS_ASSERT
+    #include <assert.h>
+    #define CHIPS_ASSERT(c) assert(c)
+#endif
+
+/* a literal run only ends at this many zero bytes, so the RLE doesn't degrade on noise */
+#define _REWIND_MIN_ZERO_RUN (8)
+
+static inline uint8_t* _rewind_put_varint(uint8_t* out, uint32_t val) {
+    while (val >= 0x80) {
+        *out++ = (uint8_t)(val | 0x80);
+        val >>= 7;
+    }
+    *out++ = (uint8_t) val;
+    return out;
+}
+
+static inline const uint8_t* _rewind_get_varint(const uint8_t* in, uint32_t* val) {
+    uint32_t v = 0;
+    int shift = 0;
+    uint8_t b;
+    do {
+        b = *in++;
+        v |= (uint32_t)(b & 0x7F) << shift;
+        shift += 7;
+    } while (b & 0x80);
+    *val = v;
+    return in;
+}
+
+/* encode (cur XOR ref) as (zero-run, literal-run, literals)* tuples, ref may be null */
+static uint32_t _rewind_encode(const uint8_t* cur, const uint8_t* ref, uint32_t size, uint8_t* out) {
+    uint8_t* dst = out;
+    uint32_t pos = 0;
+    while (pos < size) {
+        /* skip unchanged bytes */
+        uint32_t start = pos;
+        if (ref) {
+            while ((pos < size) && (cur[pos] == ref[pos])) { pos++; }
+        }
+        else {
+            while ((pos < size) && (cur[pos] == 0)) { pos++; }
+        }
+        const uint32_t zero_run = pos - start;
+        if (pos == size) {
+            break;
+        }
+        /* find the end of the changed run */
+        start = pos;
+        uint32_t zeros = 0;
+        while ((pos < size) && (zeros < _REWIND_MIN_ZERO_RUN)) {
+            const uint8_t x = ref ? (cur[pos] ^ ref[pos]) : cur[pos];
+            zeros = x ? 0 : (zeros + 1);
+            pos++;
+        }
+        pos -= zeros;
+        const uint32_t lit_run = pos - start;
+        dst = _rewind_put_varint(dst, zero_run);
+        dst = _rewind_put_varint(dst, lit_run);
+        if (ref) {
+            for (uint32_t i = start; i < pos; i++) {
+                *dst++ = cur[i] ^ ref[i];
+            }
+        }
+        else {
+            memcpy(dst, &cur[start], lit_run);
+            dst += lit_run;
+        }
+    }
+    return (uint32_t)(dst - out);
+}
+
+/* XOR-apply an encoded frame onto buf */
+static void _rewind_decode(const uint8_t* in, uint32_t in_size, uint8_t* buf, uint32_t size) {
+    const uint8_t* end = in + in_size;
+    uint32_t pos = 0;
+    while (in < end) {
+        uint32_t zero_run, lit_run;
+        in = _rewind_get_varint(in, &zero_run);
+        in = _rewind_get_varint(in, &lit_run);
+        pos += zero_run;
+        CHIPS_ASSERT((pos + lit_run) <= size);
+        for (uint32_t i = 0; i < lit_run; i++) {
+            buf[pos++] ^= *in++;
+        }
+    }
+}
+
+/* worst case encoded size: one tuple per MIN_ZERO_RUN+1 bytes */
+static uint32_t _rewind_max_encoded_size(uint32_t size) {
+    return size + (size / (_REWIND_MIN_ZERO_RUN + 1) + 1) * 10;
+}
+
+static inline int _rewind_ring_index(const rewind_t* rw, int i) {
+    return (rw->oldest + i) % rw->max_frames;
+}
+
+bool rewind_init(rewind_t* rw, const rewind_desc_t* desc) {
+    CHIPS_ASSERT(rw && desc && (desc->snapshot_size > 0) && (desc->max_frames > 0));
+    memset(rw, 0, sizeof(rewind_t));
+    rw->snapshot_size = desc->snapshot_size;
+    rw->keyframe_interval = desc->keyframe_interval > 0 ? desc->keyframe_interval : 64;
+    rw->max_frames = desc->max_frames;
+    rw->buf_size = desc->buffer_size;
+    rw->frames = (rewind_frame_t*) calloc(rw->max_frames, sizeof(rewind_frame_t));
+    rw->buf = (uint8_t*) malloc(rw->buf_size);
+    rw->key_raw = (uint8_t*) malloc(rw->snapshot_size);
+    rw->scratch = (uint8_t*) malloc(_rewind_max_encoded_size(rw->snapshot_size));
+    rw->key_index = -1;
+    if (!rw->frames || !rw->buf || !rw->key_raw || !rw->scratch) {
+        rewind_discard(rw);
+        return false;
+    }
+    return true;
+}
+
+void rewind_discard(rewind_t* rw) {
+    CHIPS_ASSERT(rw);
+    free(rw->frames);
+    free(rw->buf);
+    free(rw->key_raw);
+    free(rw->scratch);
+    memset(rw, 0, sizeof(rewind_t));
+}
+
+void rewind_reset(rewind_t* rw) {
+    CHIPS_ASSERT(rw);
+    rw->oldest = 0;
+    rw->num_frames = 0;
+    rw->key_index = -1;
+    rw->head = 0;
+}
+
+/* drop the oldest frame, and any delta frames which depend on its keyframe */
+static void _rewind_drop_oldest(rewind_t* rw) {
+    do {
+        if (rw->oldest == rw->key_index) {
+            rw->key_index = -1;
+        }
+        rw->oldest = (rw->oldest + 1) % rw->max_frames;
+        rw->num_frames--;
+    } while ((rw->num_frames > 0) && !rw->frames[rw->oldest].keyframe);
+}
+
+/* make room for size bytes at the write head, returns write offset */
+static uint32_t _rewind_alloc(rewind_t* rw, uint32_t size) {
+    if ((rw->head + size) > rw->buf_size) {
+        rw->head = 0;
+    }
+    while (rw->num_frames > 0) {
+        const rewind_frame_t* f = &rw->frames[rw->oldest];
+        const bool overlaps = (f->offset < (rw->head + size)) && ((f->offset + f->size) > rw->head);
+        if (overlaps || (rw->num_frames == rw->max_frames)) {
+            _rewind_drop_oldest(rw);
+        }
+        else {
+            break;
+        }
+    }
+    const uint32_t offset = rw->head;
+    rw->head += size;
+    return offset;
+}
+
+void rewind_push(rewind_t* rw, const uint8_t* snapshot) {
+    CHIPS_ASSERT(rw && rw->buf && snapshot);
+    bool keyframe = (rw->key_index < 0) ||
+        (((rw->oldest + rw->num_frames - rw->key_index + rw->max_frames) % rw->max_frames) >= rw->keyframe_interval);
+    uint32_t size = _rewind_encode(snapshot, keyframe ? 0 : rw->key_raw, rw->snapshot_size, rw->scratch);
+    if (size > rw->buf_size / 2) {
+        /* history buffer too small to hold this frame */
+        rewind_reset(rw);
+        return;
+    }
+    uint32_t offset = _rewind_alloc(rw, size);
+    if (!keyframe && (rw->key_index < 0)) {
+        /* making room has dropped our keyframe, need to store a keyframe instead */
+        keyframe = true;
+        rw->head = offset;
+        size = _rewind_encode(snapshot, 0, rw->snapshot_size, rw->scratch);
+        if (size > rw->buf_size / 2) {
+            rewind_reset(rw);
+            return;
+        }
+        offset = _rewind_alloc(rw, size);
+    }
+    memcpy(rw->buf + offset, rw->scratch, size);
+    const int index = _rewind_ring_index(rw, rw->num_frames);
+    rw->frames[index].offset = offset;
+    rw->frames[index].size = size;
+    rw->frames[index].keyframe = keyframe;
+    rw->num_frames++;
+    if (keyframe) {
+        rw->key_index = index;
+        memcpy(rw->key_raw, snapshot, rw->snapshot_size);
+    }
+}
+
+bool rewind_get(rewind_t* rw, int frames_back, uint8_t* out_snapshot) {
+    CHIPS_ASSERT(rw && out_snapshot);
+    if ((frames_back < 0) || (frames_back >= rw->num_frames)) {
+        return false;
+    }
+    int i = rw->num_frames - 1 - frames_back;
+    const rewind_frame_t* f = &rw->frames[_rewind_ring_index(rw, i)];
+    /* find the keyframe this frame depends on */
+    int ki = i;
+    while (!rw->frames[_rewind_ring_index(rw, ki)].keyframe) {
+        ki--;
+        CHIPS_ASSERT(ki >= 0);
+    }
+    const rewind_frame_t* kf = &rw->frames[_rewind_ring_index(rw, ki)];
+    if ((rw->key_index >= 0) && (kf == &rw->frames[rw->key_index])) {
+        memcpy(out_snapshot, rw->key_raw, rw->snapshot_size);
+    }
+    else {
+        memset(out_snapshot, 0, rw->snapshot_size);
+        _rewind_decode(rw->buf + kf->offset, kf->size, out_snapshot, rw->snapshot_size);
+    }
+    if (!f->keyframe) {
+        _rewind_decode(rw->buf + f->offset, f->size, out_snapshot, rw->snapshot_size);
+    }
+    return true;
+}
+
+void rewind_pop(rewind_t* rw, int num) {
+    CHIPS_ASSERT(rw);
+    while ((num-- > 0) && (rw->num_frames > 0)) {
+        const int index = _rewind_ring_index(rw, rw->num_frames - 1);
+        rw->num_frames--;
+        rw->head = rw->frames[index].offset;
+        if (index == rw->key_index) {
+            /* find and decode the previous keyframe */
+            rw->key_index = -1;
+            for (int i = rw->num_frames - 1; i >= 0; i--) {
+                const int ki = _rewind_ring_index(rw, i);
+                if (rw->frames[ki].keyframe) {
+                    rw->key_index = ki;
+                    memset(rw->key_raw, 0, rw->snapshot_size);
+                    _rewind_decode(rw->buf + rw->frames[ki].offset, rw->frames[ki].size, rw->key_raw, rw->snapshot_size);
+                    break;
+                }
+            }
+        }
+    }
+    if (0 == rw->num_frames) {
+        rewind_reset(rw);
+    }
+}
+
+uint32_t rewind_bytes_used(const rewind_t* rw) {
+    CHIPS_ASSERT(rw);
+    uint32_t bytes = 0;
+    for (int i = 0; i < rw->num_frames; i++) {
+        bytes += rw->frames[_rewind_ring_index(rw, i)].size;
+    }
+    return bytes;
+}
+#endif /* CHIPS_IMPL */
@@ -0,0 +1,124 @@
+#pragma once
+/*
+    Runtime ROM loading for the example emulators.
+
+    Memory-maps ROM image files read-only from a directory, so that a
+    different ROM set can be used without rebuilding. The system cores
+    map their ROM areas directly onto the mapped file pages (no copy),
+    and all processes using the same ROM files share the same physical
+    pages.
+
+    romfile_load() falls back to the embedded ROM dump if the file
+    doesn't exist or doesn't have the expected size (and always on
+    emscripten, which has no file system to map from).
+
+    The mapped pointers must stay valid while an emulator instance
+    uses them, call romfile_unmap() only after the instance is discarded.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+typedef struct {
+    const uint8_t* ptr;     /* mapped file content, or the fallback */
+    uint32_t size;
+    bool mapped;            /* true if ptr points to a mapped file */
+} romfile_t;
+
+/* map a file read-only, returns false if the file doesn't exist or has the wrong size */
+static inline bool romfile_map(romfile_t* rf, const char* dir, const char* name, uint32_t expected_size) {
+    rf->ptr = 0;
+    rf->size = 0;
+    rf->mapped = false;
+    #if defined(__EMSCRIPTEN__)
+    (void)dir; (void)name; (void)expected_size;
+    return false;
+    #else
+    char path[1024];
+    if (snprintf(path, sizeof(path), "%s/%s", dir, name) >= (int)sizeof(path)) {
+        return false;
+    }
+    #if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (INVALID_HANDLE_VALUE == file) {
+        return false;
+    }
+    const DWORD size = GetFileSize(file, NULL);
+    if (size != expected_size) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping) {
+        return false;
+    }
+    const void* ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    /* the view keeps the mapping alive */
+    CloseHandle(mapping);
+    if (!ptr) {
+        return false;
+    }
+    #else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if ((0 != fstat(fd, &st)) || (st.st_size != (off_t)expected_size)) {
+        close(fd);
+        return false;
+    }
+    const void* ptr = mmap(0, expected_size, PROT_READ, MAP_SHARED, fd, 0);
+    /* the mapping keeps the file alive */
+    close(fd);
+    if (MAP_FAILED == ptr) {
+        return false;
+    }
+    #endif
+    rf->ptr = (const uint8_t*) ptr;
+    rf->size = expected_size;
+    rf->mapped = true;
+    return true;
+    #endif
+}
+
+/* release a mapped file (does nothing for the fallback) */
+static inline void romfile_unmap(romfile_t* rf) {
+    #if defined(_WIN32)
+    if (rf->mapped) {
+        UnmapViewOfFile((LPCVOID)rf->ptr);
+    }
+    #elif !defined(__EMSCRIPTEN__)
+    if (rf->mapped) {
+        munmap((void*)rf->ptr, rf->size);
+    }
+    #endif
+    rf->ptr = 0;
+    rf->size = 0;
+    rf->mapped = false;
+}
+
+/* map a ROM file from dir (if dir is not null), or fall back to the embedded dump */
+static inline const uint8_t* romfile_load(romfile_t* rf, const char* dir, const char* name, const uint8_t* fallback, uint32_t size) {
+    if (dir && romfile_map(rf, dir, name, size)) {
+        printf("mapped ROM '%s/%s'\n", dir, name);
+    }
+    else {
+        rf->ptr = fallback;
+        rf->size = size;
+        rf->mapped = false;
+    }
+    return rf->ptr;
+}
@@ -0,0 +1,115 @@
+#pragma once
+/*
+    Tick-stamped event scheduler.
+
+    Replaces the per-tick countdown counters of periodic system events
+    (scanline timers, blink counters, oscillators) with deadlines keyed
+    by the absolute emulated tick. The tick callback only advances the
+    scheduler's tick counter and compares it with the earliest deadline,
+    and dispatches the due events by their id:
+
+        if (sched_advance(&sys->sched, num_ticks)) {
+            int id;
+            while ((id = sched_pop(&sys->sched)) >= 0) {
+                switch (id) { ... }
+            }
+        }
+
+    Events are identified by a small integer id (0..SCHED_MAX_EVENTS-1)
+    instead of a callback pointer, so a sched_t can live in the system
+    struct and is saved and restored with snapshots. There are only a
+    handful of events per system, so they are kept in a plain array
+    indexed by id, and the earliest deadline is cached (a linear scan
+    over a few slots is cheaper than maintaining a heap).
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+
+#define SCHED_MAX_EVENTS (8)
+#define SCHED_NEVER (UINT64_MAX)
+
+typedef struct {
+    uint64_t now;                           /* ticks executed since sched_init() */
+    uint64_t next;                          /* earliest deadline of all events */
+    uint64_t due[SCHED_MAX_EVENTS];         /* absolute deadline per event, or SCHED_NEVER */
+    uint32_t period[SCHED_MAX_EVENTS];      /* > 0 for periodic events */
+} sched_t;
+
+static inline void _sched_update_next(sched_t* s) {
+    uint64_t next = SCHED_NEVER;
+    for (int i = 0; i < SCHED_MAX_EVENTS; i++) {
+        if (s->due[i] < next) {
+            next = s->due[i];
+        }
+    }
+    s->next = next;
+}
+
+static inline void sched_init(sched_t* s) {
+    memset(s, 0, sizeof(sched_t));
+    for (int i = 0; i < SCHED_MAX_EVENTS; i++) {
+        s->due[i] = SCHED_NEVER;
+    }
+    s->next = SCHED_NEVER;
+}
+
+/* schedule an event at an absolute tick, with period > 0 it repeats every period ticks */
+static inline void sched_set(sched_t* s, int id, uint64_t tick, uint32_t period) {
+    assert((id >= 0) && (id < SCHED_MAX_EVENTS));
+    s->due[id] = tick;
+    s->period[id] = period;
+    _sched_update_next(s);
+}
+
+/* schedule an event relative to the current tick */
+static inline void sched_set_in(sched_t* s, int id, uint32_t ticks, uint32_t period) {
+    sched_set(s, id, s->now + ticks, period);
+}
+
+static inline void sched_cancel(sched_t* s, int id) {
+    sched_set(s, id, SCHED_NEVER, 0);
+}
+
+/* advance the current tick, returns true if an event is due */
+static inline bool sched_advance(sched_t* s, uint32_t ticks) {
+    s->now += ticks;
+    return s->now >= s->next;
+}
+
+/* number of ticks until an event is due (0 if it is due) */
+static inline uint64_t sched_ticks_left(const sched_t* s, int id) {
+    assert((id >= 0) && (id < SCHED_MAX_EVENTS));
+    return (s->due[id] > s->now) ? (s->due[id] - s->now) : 0;
+}
+
+/* number of ticks until the next event is due, for running straight-line code up to it */
+static inline uint64_t sched_ticks_to_next(const sched_t* s) {
+    return (s->next > s->now) ? (s->next - s->now) : 0;
+}
+
+/* pop the due event with the earliest deadline (periodic events are
+   rescheduled one period after their deadline), returns -1 if no
+   event is due
+*/
+static inline int sched_pop(sched_t* s) {
+    if (s->now < s->next) {
+        return -1;
+    }
+    int id = -1;
+    for (int i = 0; i < SCHED_MAX_EVENTS; i++) {
+        if ((s->due[i] <= s->now) && ((id < 0) || (s->due[i] < s->due[id]))) {
+            id = i;
+        }
+    }
+    assert(id >= 0);
+    if (s->period[id] > 0) {
+        s->due[id] += s->period[id];
+    }
+    else {
+        s->due[id] = SCHED_NEVER;
+    }
+    _sched_update_next(s);
+    return id;
+}
@@ -0,0 +1,107 @@
+#pragma once
+/*
+    Snapshot helpers for the system cores in examples/systems/.
+
+    The system structs are flat POD, so a snapshot is a small header
+    followed by a plain memory copy of the system struct. The only
+    problem are pointers inside the struct (the mem_t page tables, the
+    framebuffer and ROM pointers, the chip callbacks), which belong to
+    the instance and process the snapshot was taken from.
+
+    snapshot_load() only checks the header and copies the struct, the
+    per-system load functions (e.g. c64_load_snapshot()) then restore
+    every pointer explicitly: the framebuffer, ROMs, audio output and
+    instrumentation of the destination instance are kept, the chip
+    callbacks are set again, and the mem_t page tables are rebuilt from
+    the memory configuration state through the system's memory mapping
+    function. This means a snapshot can be restored into any initialized
+    instance of the same system, not just the one it was taken from,
+    and also into an instance in another process of the same executable
+    (the post-boot snapshots of the examples).
+
+    The header records the distance of an anchor object in the executable
+    image to a function in the image, which identifies the executable
+    layout: snapshots from a different executable (or build), where the
+    system structs may differ, are rejected. The address of the anchor
+    tells whether the snapshot was taken in this process (the clone bases
+    in common/clone.h need that, since the clones share the ROM pointers
+    of the snapshot).
+
+    The framebuffer content is not part of the snapshot, it will be
+    regenerated by the next emulated frame.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define SNAPSHOT_VERSION (3)
+#define SNAPSHOT_FOURCC(a,b,c,d) ((uint32_t)(a)|((uint32_t)(b)<<8)|((uint32_t)(c)<<16)|((uint32_t)(d)<<24))
+
+typedef struct {
+    uint32_t system_id;         /* SNAPSHOT_FOURCC of the system */
+    uint32_t version;           /* SNAPSHOT_VERSION */
+    uint32_t system_size;       /* sizeof() the system struct */
+    uint32_t reserved;
+    uint64_t image_base;        /* address of the anchor in the source executable image */
+    uint64_t image_layout;      /* distance of the anchor to a function in the image */
+} snapshot_header_t;
+
+/* any object in the executable image will do as anchor */
+static const uint8_t _snapshot_image_anchor = 0;
+
+/* size of a snapshot for a system struct of the given size */
+static inline uint32_t snapshot_size(uint32_t system_size) {
+    return (uint32_t) sizeof(snapshot_header_t) + system_size;
+}
+
+static inline uintptr_t _snapshot_image_base(void) {
+    return (uintptr_t) &_snapshot_image_anchor;
+}
+
+static inline uint64_t _snapshot_image_layout(void) {
+    return (uint64_t)(_snapshot_image_base() - (uintptr_t) &snapshot_size);
+}
+
+/* write a snapshot into buf, returns number of bytes written, or 0 if buf is too small */
+static inline uint32_t snapshot_save(void* buf, uint32_t buf_size, uint32_t system_id, const void* sys, uint32_t system_size) {
+    const uint32_t size = snapshot_size(system_size);
+    if (!buf || (buf_size < size)) {
+        return 0;
+    }
+    snapshot_header_t* hdr = (snapshot_header_t*) buf;
+    memset(hdr, 0, sizeof(snapshot_header_t));
+    hdr->system_id = system_id;
+    hdr->version = SNAPSHOT_VERSION;
+    hdr->system_size = system_size;
+    hdr->image_base = (uint64_t) _snapshot_image_base();
+    hdr->image_layout = _snapshot_image_layout();
+    memcpy(hdr + 1, sys, system_size);
+    return size;
+}
+
+/* check that a snapshot matches the system and this executable */
+static inline bool _snapshot_valid(const void* buf, uint32_t buf_size, uint32_t system_id, uint32_t system_size) {
+    const snapshot_header_t* hdr = (const snapshot_header_t*) buf;
+    return buf && (buf_size >= snapshot_size(system_size)) &&
+        (hdr->system_id == system_id) &&
+        (hdr->version == SNAPSHOT_VERSION) &&
+        (hdr->system_size == system_size) &&
+        (hdr->image_layout == _snapshot_image_layout());
+}
+
+/* true if a valid snapshot was taken in this process */
+static inline bool _snapshot_same_process(const void* buf) {
+    return ((const snapshot_header_t*) buf)->image_base == (uint64_t) _snapshot_image_base();
+}
+
+/* copy the system struct of a snapshot into an instance, returns false if
+   the snapshot doesn't match the system, the caller must restore all
+   pointers in the struct afterwards
+*/
+static inline bool snapshot_load(const void* buf, uint32_t buf_size, uint32_t system_id, void* sys, uint32_t system_size) {
+    if (!_snapshot_valid(buf, buf_size, system_id, system_size)) {
+        return false;
+    }
+    memcpy(sys, (const snapshot_header_t*) buf + 1, system_size);
+    return true;
+}
@@ -0,0 +1,183 @@
+#pragma once
+/*
+    Performance telemetry for the example emulators ('-telemetry' and
+    '-telemetry-log' command line args of the C64 and CPC examples).
+
+    The shells push one sample per emulated host frame (the emulated ticks
+    and the wall-clock time since the previous sample, the time spent in the
+    emulation, the framebuffer decode and upload times of gfx_draw(), the
+    overrun ticks and the audio buffer fill). The samples go into fixed
+    ring buffers of the last TELEMETRY_WINDOW frames, pushing a sample is a
+    handful of stores and needs no allocation, so the telemetry can stay
+    enabled in production.
+
+    Every TELEMETRY_REFRESH_SEC, the min/avg/max over the window are
+    computed and formatted into a text block for the on-screen overlay
+    (see gfx_set_overlay()), and every log_interval_sec a single summary
+    line is printed to stdout.
+
+    The emulated speed is the percentage of the system's clock frequency
+    which the emulation reached in a frame, the average over the window is
+    the total emulated ticks over the total wall-clock time (so frames which
+    only present the previous frame on a faster display don't count as
+    standing still).
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TELEMETRY_WINDOW (128)      /* frames, must be a power of 2 */
+#define TELEMETRY_REFRESH_SEC (0.5)
+#define TELEMETRY_TEXT_SIZE (512)
+
+typedef enum {
+    TELEMETRY_SPEED,            /* emulated speed in percent of the clock frequency */
+    TELEMETRY_EMU_MS,           /* time spent in the emulation */
+    TELEMETRY_DECODE_MS,        /* framebuffer decode and change detection in gfx_draw() */
+    TELEMETRY_UPLOAD_MS,        /* framebuffer texture upload in gfx_draw() */
+    TELEMETRY_OVERRUN,          /* overrun_ticks after the frame */
+    TELEMETRY_AUDIO_MS,         /* audio ring buffer fill */
+    TELEMETRY_NUM
+} telemetry_channel_t;
+
+typedef struct {
+    const char* name;           /* system name for the log line */
+    uint32_t freq_hz;           /* emulated CPU clock frequency */
+    double log_interval_sec;    /* seconds between log lines, 0 for no log */
+} telemetry_desc_t;
+
+/* one sample per host frame which ran the emulation */
+typedef struct {
+    double frame_sec;           /* wall-clock time since the previous sample */
+    uint32_t ticks;             /* emulated ticks executed in the frame */
+    double emu_ms;
+    double decode_ms;
+    double upload_ms;
+    uint32_t overrun_ticks;
+    double audio_fill_ms;
+} telemetry_sample_t;
+
+typedef struct {
+    float min;
+    float avg;
+    float max;
+} telemetry_range_t;
+
+typedef struct {
+    const char* name;
+    uint32_t freq_hz;
+    double log_interval_sec;
+    uint32_t pos;               /* number of samples pushed, the ring position is pos & (TELEMETRY_WINDOW-1) */
+    float values[TELEMETRY_NUM][TELEMETRY_WINDOW];
+    double frame_sec[TELEMETRY_WINDOW];
+    uint32_t ticks[TELEMETRY_WINDOW];
+    double refresh_sec;         /* time since the last refresh */
+    double log_sec;             /* time since the last log line */
+    telemetry_range_t range[TELEMETRY_NUM];
+    char text[TELEMETRY_TEXT_SIZE];
+} telemetry_t;
+
+static inline void telemetry_init(telemetry_t* t, const telemetry_desc_t* desc) {
+    memset(t, 0, sizeof(telemetry_t));
+    t->name = desc->name;
+    t->freq_hz = desc->freq_hz;
+    t->log_interval_sec = desc->log_interval_sec;
+}
+
+/* compute the min/avg/max over the filled part of the window */
+static inline void _telemetry_update_ranges(telemetry_t* t) {
+    const uint32_t num = (t->pos < TELEMETRY_WINDOW) ? t->pos : TELEMETRY_WINDOW;
+    if (0 == num) {
+        return;
+    }
+    for (int c = 0; c < TELEMETRY_NUM; c++) {
+        float min = t->values[c][0], max = min;
+        double sum = 0.0;
+        for (uint32_t i = 0; i < num; i++) {
+            const float v = t->values[c][i];
+            min = (v < min) ? v : min;
+            max = (v > max) ? v : max;
+            sum += v;
+        }
+        t->range[c].min = min;
+        t->range[c].max = max;
+        t->range[c].avg = (float)(sum / num);
+    }
+    double total_sec = 0.0;
+    uint64_t total_ticks = 0;
+    for (uint32_t i = 0; i < num; i++) {
+        total_sec += t->frame_sec[i];
+        total_ticks += t->ticks[i];
+    }
+    if (total_sec > 0.0) {
+        t->range[TELEMETRY_SPEED].avg = (float)((100.0 * total_ticks) / (total_sec * t->freq_hz));
+    }
+}
+
+static inline void _telemetry_format(telemetry_t* t) {
+    static const char* labels[TELEMETRY_NUM] = {
+        "SPEED %", "EMU MS", "DECODE MS", "UPLOAD MS", "OVERRUN", "AUDIO MS"
+    };
+    int len = snprintf(t->text, sizeof(t->text), "%-10s %7s %7s %7s\n", "", "MIN", "AVG", "MAX");
+    for (int c = 0; (c < TELEMETRY_NUM) && (len > 0) && (len < (int)sizeof(t->text)); c++) {
+        const telemetry_range_t* r = &t->range[c];
+        if (TELEMETRY_OVERRUN == c) {
+            len += snprintf(t->text + len, sizeof(t->text) - len, "%-10s %7.0f %7.0f %7.0f\n", labels[c], r->min, r->avg, r->max);
+        }
+        else {
+            len += snprintf(t->text + len, sizeof(t->text) - len, "%-10s %7.2f %7.2f %7.2f\n", labels[c], r->min, r->avg, r->max);
+        }
+    }
+}
+
+static inline void _telemetry_log(const telemetry_t* t) {
+    const telemetry_range_t* r = t->range;
+    printf("%s telemetry: speed %.1f/%.1f/%.1f%%, emu %.2f/%.2f/%.2f ms, decode %.2f/%.2f/%.2f ms, "
+        "upload %.2f/%.2f/%.2f ms, overrun %.0f/%.0f/%.0f ticks, audio %.1f/%.1f/%.1f ms (min/avg/max of %u frames)\n",
+        t->name,
+        r[TELEMETRY_SPEED].min, r[TELEMETRY_SPEED].avg, r[TELEMETRY_SPEED].max,
+        r[TELEMETRY_EMU_MS].min, r[TELEMETRY_EMU_MS].avg, r[TELEMETRY_EMU_MS].max,
+        r[TELEMETRY_DECODE_MS].min, r[TELEMETRY_DECODE_MS].avg, r[TELEMETRY_DECODE_MS].max,
+        r[TELEMETRY_UPLOAD_MS].min, r[TELEMETRY_UPLOAD_MS].avg, r[TELEMETRY_UPLOAD_MS].max,
+        r[TELEMETRY_OVERRUN].min, r[TELEMETRY_OVERRUN].avg, r[TELEMETRY_OVERRUN].max,
+        r[TELEMETRY_AUDIO_MS].min, r[TELEMETRY_AUDIO_MS].avg, r[TELEMETRY_AUDIO_MS].max,
+        (t->pos < TELEMETRY_WINDOW) ? t->pos : TELEMETRY_WINDOW);
+    fflush(stdout);
+}
+
+/* push the sample of a frame, returns true when the overlay text was refreshed */
+static inline bool telemetry_push(telemetry_t* t, const telemetry_sample_t* s) {
+    const uint32_t i = t->pos++ & (TELEMETRY_WINDOW-1);
+    t->frame_sec[i] = s->frame_sec;
+    t->ticks[i] = s->ticks;
+    t->values[TELEMETRY_SPEED][i] = (s->frame_sec > 0.0) ? (float)((100.0 * s->ticks) / (s->frame_sec * t->freq_hz)) : 0.0f;
+    t->values[TELEMETRY_EMU_MS][i] = (float)s->emu_ms;
+    t->values[TELEMETRY_DECODE_MS][i] = (float)s->decode_ms;
+    t->values[TELEMETRY_UPLOAD_MS][i] = (float)s->upload_ms;
+    t->values[TELEMETRY_OVERRUN][i] = (float)s->overrun_ticks;
+    t->values[TELEMETRY_AUDIO_MS][i] = (float)s->audio_fill_ms;
+    t->refresh_sec += s->frame_sec;
+    t->log_sec += s->frame_sec;
+    if (t->refresh_sec < TELEMETRY_REFRESH_SEC) {
+        return false;
+    }
+    t->refresh_sec = 0.0;
+    _telemetry_update_ranges(t);
+    _telemetry_format(t);
+    if ((t->log_interval_sec > 0.0) && (t->log_sec >= t->log_interval_sec)) {
+        t->log_sec = 0.0;
+        _telemetry_log(t);
+    }
+    return true;
+}
+
+/* the min/avg/max of a channel at the last refresh */
+static inline telemetry_range_t telemetry_range(const telemetry_t* t, telemetry_channel_t c) {
+    return t->range[c];
+}
+
+/* the overlay text of the last refresh (one line per channel) */
+static inline const char* telemetry_text(const telemetry_t* t) {
+    return t->text;
+}
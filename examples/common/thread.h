@@ -0,0 +1,176 @@
+#pragma once
+/*
+    Minimal threading helpers for the chips-test example emulators
+    (pthreads on POSIX, Win32 threads on Windows).
+
+    CHIPS_THREAD_LOCAL is used by the system cores to associate the
+    running emulator instance with the current thread, since the chip
+    callbacks don't have a user-data argument.
+
+    CHIPS_CACHE_ALIGNED aligns the hot state of the system structs to
+    cache lines (this also keeps instances stepped on different threads
+    from sharing cache lines).
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <intrin.h> /* _ReadWriteBarrier */
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#if defined(_MSC_VER)
+#define CHIPS_THREAD_LOCAL __declspec(thread)
+#else
+#define CHIPS_THREAD_LOCAL __thread
+#endif
+
+/* the system cores keep their per-tick state on separate cache lines from
+   the rest of the system struct, heap-allocated instances need the same
+   alignment (see thread_aligned_calloc())
+*/
+#define CHIPS_CACHE_LINE_SIZE (64)
+#if defined(_MSC_VER)
+#define CHIPS_CACHE_ALIGNED __declspec(align(64))
+#else
+#define CHIPS_CACHE_ALIGNED __attribute__((aligned(64)))
+#endif
+
+typedef void (*thread_func_t)(void* arg);
+
+typedef struct {
+    thread_func_t func;
+    void* arg;
+    #if defined(_WIN32)
+    HANDLE handle;
+    #else
+    pthread_t handle;
+    #endif
+} thread_t;
+
+#if defined(_WIN32)
+static inline DWORD WINAPI _thread_entry(LPVOID arg) {
+    thread_t* t = (thread_t*) arg;
+    t->func(t->arg);
+    return 0;
+}
+#else
+static inline void* _thread_entry(void* arg) {
+    thread_t* t = (thread_t*) arg;
+    t->func(t->arg);
+    return 0;
+}
+#endif
+
+/* start a thread, the thread_t object must be alive until thread_join() */
+static inline bool thread_start(thread_t* t, thread_func_t func, void* arg) {
+    t->func = func;
+    t->arg = arg;
+    #if defined(_WIN32)
+    t->handle = CreateThread(NULL, 0, _thread_entry, t, 0, NULL);
+    return 0 != t->handle;
+    #else
+    return 0 == pthread_create(&t->handle, 0, _thread_entry, t);
+    #endif
+}
+
+/* wait for a thread to finish */
+static inline void thread_join(thread_t* t) {
+    #if defined(_WIN32)
+    WaitForSingleObject(t->handle, INFINITE);
+    CloseHandle(t->handle);
+    #else
+    pthread_join(t->handle, 0);
+    #endif
+}
+
+/* return the number of logical CPU cores */
+static inline int thread_num_cores(void) {
+    #if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int) info.dwNumberOfProcessors;
+    #else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? (int) n : 1;
+    #endif
+}
+
+/* atomically add a value and return the previous value */
+static inline int32_t thread_atomic_add(volatile int32_t* ptr, int32_t val) {
+    #if defined(_MSC_VER)
+    return (int32_t) InterlockedExchangeAdd((volatile LONG*)ptr, val);
+    #else
+    return __atomic_fetch_add(ptr, val, __ATOMIC_SEQ_CST);
+    #endif
+}
+
+/* load a value written by another thread (acquire semantics) */
+static inline uint32_t thread_atomic_load(const volatile uint32_t* ptr) {
+    #if defined(_MSC_VER)
+    const uint32_t val = *ptr;
+    _ReadWriteBarrier();
+    return val;
+    #else
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+    #endif
+}
+
+/* publish a value to another thread (release semantics) */
+static inline void thread_atomic_store(volatile uint32_t* ptr, uint32_t val) {
+    #if defined(_MSC_VER)
+    _ReadWriteBarrier();
+    *ptr = val;
+    #else
+    __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+    #endif
+}
+
+/* atomically replace a value, returns the previous value */
+static inline uint32_t thread_atomic_exchange(volatile uint32_t* ptr, uint32_t val) {
+    #if defined(_MSC_VER)
+    return (uint32_t) InterlockedExchange((volatile LONG*)ptr, (LONG)val);
+    #else
+    return __atomic_exchange_n(ptr, val, __ATOMIC_ACQ_REL);
+    #endif
+}
+
+/* put the current thread to sleep for (at least) the given number of microseconds */
+static inline void thread_sleep_us(uint32_t us) {
+    #if defined(_WIN32)
+    Sleep((us + 999) / 1000);
+    #else
+    usleep(us);
+    #endif
+}
+
+/* zero-initialized cache-line aligned allocation (for system instances), free with thread_aligned_free() */
+static inline void* thread_aligned_calloc(size_t size) {
+    void* ptr = 0;
+    #if defined(_WIN32)
+    ptr = _aligned_malloc(size, CHIPS_CACHE_LINE_SIZE);
+    #else
+    if (0 != posix_memalign(&ptr, CHIPS_CACHE_LINE_SIZE, size)) {
+        ptr = 0;
+    }
+    #endif
+    if (ptr) {
+        memset(ptr, 0, size);
+    }
+    return ptr;
+}
+
+static inline void thread_aligned_free(void* ptr) {
+    #if defined(_WIN32)
+    _aligned_free(ptr);
+    #else
+    free(ptr);
+    #endif
+}
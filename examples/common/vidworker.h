@@ -0,0 +1,106 @@
+#pragma once
+/*
+    Pipelined video decoding on a worker thread (optional mode of the
+    KC87 and Z1013 examples, enabled with the '-async-video' command line
+    arg).
+
+    The full-frame video decoders of these systems run after the CPU
+    emulation of a frame. In pipelined mode, the emulator captures a copy
+    of the video state at the end of each frame (the video/color RAM and
+    the dirty cells, a few KB), and the worker thread decodes it into a
+    separate framebuffer while the emulator already runs the next frame.
+    Before the next capture, the emulator thread waits for the worker and
+    presents the decoded frame, so the display is one frame behind.
+
+    The worker measures the time spent in the decode function, and the
+    emulator thread the time spent waiting for the worker. The difference
+    is the decode time which overlapped with the emulation.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "sokol_time.h"
+#include "thread.h"
+
+typedef void (*vidworker_func_t)(void* arg);
+
+typedef struct {
+    thread_t thread;
+    volatile uint32_t stop;
+    volatile uint32_t kicked;       /* only written by the emulator thread */
+    volatile uint32_t done;         /* only written by the worker thread */
+    vidworker_func_t func;
+    void* arg;
+    bool running;
+    uint32_t num_jobs;
+    uint64_t work_ticks;            /* sokol_time ticks in func on the worker thread */
+    uint64_t wait_ticks;            /* sokol_time ticks the emulator thread waited for the worker */
+} vidworker_t;
+
+static void _vidworker_thread_func(void* arg) {
+    vidworker_t* w = (vidworker_t*) arg;
+    uint32_t done = w->done;
+    while (!thread_atomic_load(&w->stop)) {
+        if (done != thread_atomic_load(&w->kicked)) {
+            const uint64_t start = stm_now();
+            w->func(w->arg);
+            w->work_ticks += stm_since(start);
+            done++;
+            thread_atomic_store(&w->done, done);
+        }
+        else {
+            thread_sleep_us(100);
+        }
+    }
+}
+
+static inline bool vidworker_start(vidworker_t* w) {
+    memset(w, 0, sizeof(vidworker_t));
+    w->running = thread_start(&w->thread, _vidworker_thread_func, w);
+    return w->running;
+}
+
+/* wait until the worker has finished its current job */
+static inline void vidworker_wait(vidworker_t* w) {
+    if (thread_atomic_load(&w->done) != w->kicked) {
+        const uint64_t start = stm_now();
+        while (thread_atomic_load(&w->done) != w->kicked) {
+            thread_sleep_us(50);
+        }
+        w->wait_ticks += stm_since(start);
+    }
+}
+
+/* hand a job to the worker, the previous job must be finished (see vidworker_wait()) */
+static inline void vidworker_kick(vidworker_t* w, vidworker_func_t func, void* arg) {
+    vidworker_wait(w);
+    w->func = func;
+    w->arg = arg;
+    w->num_jobs++;
+    thread_atomic_store(&w->kicked, w->kicked + 1);
+}
+
+/* the percentage of the decode time which overlapped with the emulation */
+static inline double vidworker_overlap(const vidworker_t* w) {
+    if ((0 == w->work_ticks) || (w->wait_ticks >= w->work_ticks)) {
+        return 0.0;
+    }
+    return (100.0 * (double)(w->work_ticks - w->wait_ticks)) / (double)w->work_ticks;
+}
+
+/* finish the current job, stop the worker thread and print the overlap statistics */
+static inline void vidworker_stop(vidworker_t* w) {
+    if (!w->running) {
+        return;
+    }
+    vidworker_wait(w);
+    thread_atomic_store(&w->stop, 1);
+    thread_join(&w->thread);
+    w->running = false;
+    if (w->num_jobs > 0) {
+        printf("async video: %u frames, %.1f us/frame decode, %.1f us/frame waited, %.1f%% overlapped\n",
+            w->num_jobs, stm_us(w->work_ticks) / w->num_jobs, stm_us(w->wait_ticks) / w->num_jobs,
+            vidworker_overlap(w));
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+/*
+    Warp mode for the chips-test example emulators: run the emulator
+    as fast as possible, and only decode the video output of every
+    WARP_DECODE_INTERVAL-th emulated frame.
+
+    warp_run() is called from app_frame() instead of the regular 1x
+    real-time emulation, it runs whole emulated frames back-to-back
+    until the frame budget of the host frame is used up.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "sokol_time.h"
+
+#define WARP_DECODE_INTERVAL (8)        /* decode the video output on every 8th emulated frame */
+#define WARP_FRAME_BUDGET_MS (14.0)     /* emulation time per host frame in warp mode */
+
+typedef struct {
+    bool enabled;
+    uint64_t start_time;        /* time stamp when warp mode was enabled */
+    double emulated_sec;        /* emulated time since warp mode was enabled */
+    uint32_t num_frames;        /* emulated frames since warp mode was enabled */
+} warp_t;
+
+/* current speed-up factor against real time */
+static inline double warp_speedup(const warp_t* w) {
+    const double elapsed = stm_sec(stm_since(w->start_time));
+    return (elapsed > 0.0) ? (w->emulated_sec / elapsed) : 0.0;
+}
+
+/* switch warp mode on or off, prints the achieved speed-up when switched off */
+static inline void warp_enable(warp_t* w, bool enable) {
+    if (enable && !w->enabled) {
+        w->start_time = stm_now();
+        w->emulated_sec = 0.0;
+        w->num_frames = 0;
+    }
+    else if (!enable && w->enabled) {
+        printf("warp: %u frames, %.1f emulated seconds, %.1fx speed-up\n",
+            w->num_frames, w->emulated_sec, warp_speedup(w));
+    }
+    w->enabled = enable;
+}
+
+/* run emulated frames until the frame budget is used up, exec_frame(decode) must run one emulated frame */
+static inline void warp_run(warp_t* w, void (*exec_frame)(bool decode), double frame_sec) {
+    const uint64_t start = stm_now();
+    do {
+        w->num_frames++;
+        exec_frame(0 == (w->num_frames % WARP_DECODE_INTERVAL));
+        w->emulated_sec += frame_sec;
+    }
+    while (stm_ms(stm_since(start)) < WARP_FRAME_BUDGET_MS);
+}
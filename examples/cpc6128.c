@@ -1,118 +1,267 @@
 /*
     cpc.c
 
-    Amstrad CPC 6128. No tape or disc emulation, audio is emulated but
-    not output.
+    Amstrad CPC 6128. No tape or disc emulation.
+
+    The actual emulator is in systems/cpc6128.h, this is just the
+    sokol-app shell around it.
+
+    Hold PageUp to rewind, press PageDown to cycle the run-ahead
+    frames (0..2) which hides input latency.
+
+    '-telemetry' shows the emulated speed, the emulation, decode and upload
+    times, overrun ticks and audio buffer fill in an overlay and logs them
+    every 5 seconds, '-telemetry-log' only logs them.
+
+    Key events go through a cycle-stamped input queue (common/inputq.h),
+    '-input-record file' writes them into an input log, '-input-replay file'
+    replays such a log instead of the keyboard input.
+
+    On startup, the post-boot snapshot cpc6128.boot (written by the build)
+    is restored instead of a cold boot, '-coldboot' forces a cold boot.
 */
 #include "sokol_app.h"
 #include "sokol_time.h"
 #define CHIPS_IMPL
-#include "chips/z80.h"
-#include "chips/ay38910.h"
-#include "chips/i8255.h"
-#include "chips/mc6845.h"
-#include "chips/crt.h"
-#include "chips/kbd.h"
-#include "chips/mem.h"
-#include "roms/cpc-roms.h"
+#include "systems/cpc6128.h"
 #include "common/gfx.h"
+#include "common/romfile.h"
+#include "common/bustrace.h"
+#include "common/debugger.h"
+#include "common/heatmap.h"
+#include "common/warp.h"
+#include "common/rewind.h"
+#include "common/audio.h"
+#include "common/inputq.h"
+#include "common/quickload.h"
+#include "common/bootsnap.h"
+#include "common/framepace.h"
+#include "common/telemetry.h"
+#include <stdlib.h> /* malloc, free */
+#include <string.h> /* strcmp */
 
-/* CPC 6128 emulator state and callbacks */
-#define CPC_FREQ (4000000)
-#define CPC_DISP_WIDTH (768)
-#define CPC_DISP_HEIGHT (272)
+cpc_t cpc;
+uint32_t overrun_ticks;
+uint64_t last_time_stamp;
+warp_t warp;
 
-typedef struct {
-    z80_t cpu;
-    ay38910_t psg;
-    mc6845_t vdg;
-    i8255_t ppi;
+/* frame pacing, '-framelock' runs exactly one emulated frame per host frame
+   when the display refresh matches the CPC's, see common/framepace.h
+*/
+bool frame_lock;
+framepace_t pace;
 
-    uint32_t tick_count;
-    uint8_t upper_rom_select;
+/* optional performance telemetry, '-telemetry' shows the min/avg/max over the
+   last frames in an overlay and logs them every few seconds, '-telemetry-log'
+   only logs them, see common/telemetry.h
+*/
+#define TELEMETRY_LOG_SEC (5.0)
+bool telemetry_enabled;
+bool telemetry_overlay;
+telemetry_t telemetry;
+double telemetry_sec;   /* wall-clock time since the last telemetry sample */
+void push_telemetry(uint32_t ticks_executed, uint64_t emu_time) {
+    const gfx_stats_t gfx = gfx_stats();
+    const audio_stats_t audio = audio_stats();
+    const bool refreshed = telemetry_push(&telemetry, &(telemetry_sample_t){
+        .frame_sec = telemetry_sec,
+        .ticks = ticks_executed,
+        .emu_ms = stm_ms(emu_time),
+        .decode_ms = gfx.last_decode_ms,
+        .upload_ms = gfx.last_upload_ms,
+        .overrun_ticks = overrun_ticks,
+        .audio_fill_ms = audio.fill_ms
+    });
+    telemetry_sec = 0.0;
+    if (refreshed && telemetry_overlay) {
+        gfx_set_overlay(telemetry_text(&telemetry));
+    }
+}
 
-    uint8_t ga_config;              // out to port 0x7Fxx func 0x80
-    uint8_t ga_next_video_mode;
-    uint8_t ga_video_mode;
-    uint8_t ga_ram_config;          // out to port 0x7Fxx func 0xC0
-    uint8_t ga_pen;                 // currently selected pen (or border)
-    uint32_t ga_palette[16];        // the current pen colors
-    uint32_t ga_border_color;       // the current border color
-    int ga_hsync_irq_counter;       // incremented each scanline, reset at 52
-    int ga_hsync_after_vsync_counter;   // for 2-hsync-delay after vsync
-    int ga_hsync_delay_counter;     // hsync to monitor is delayed 2 ticks
-    int ga_hsync_counter;           // countdown until hsync to monitor is deactivated
-    bool ga_sync;                   // gate-array generated video sync (modified HSYNC)
-    bool ga_int;                    // GA interrupt pin active
-    uint64_t ga_crtc_pins;          // store CRTC pins to detect rising/falling bits
+/* optional ROM directory ('-roms dir' command line arg), files are memory-mapped */
+const char* rom_dir;
+romfile_t rom_os, rom_basic, rom_amsdos;
 
-    crt_t crt;
-    kbd_t kbd;
-    mem_t mem;
-    uint8_t ram[8][0x4000];
-} cpc_t;
-cpc_t cpc;
+/* optional PC-sampling profiler ('-prof' and '-labels file' command line args), reported at exit */
+pcprof_t* prof;
+pcprof_labels_t prof_labels;
 
-uint32_t overrun_ticks;
-uint64_t last_time_stamp;
+/* optional bus cycle trace ('-trace' command line arg), press Insert to save the
+   last cycles to 'cpc.trace', with '-trace-pc addr' the trace is saved
+   automatically after the CPU executed the instruction at addr (hex)
+*/
+#define TRACE_NUM_ENTRIES (1<<20)
+bustrace_t trace;
+bustrace_entry_t* trace_buffer;
+void save_trace(void) {
+    const char* path = "cpc.trace";
+    if (bustrace_save(&trace, path)) {
+        printf("saved %u bus cycles to '%s'\n", bustrace_num_entries(&trace), path);
+    }
+    else {
+        printf("failed to write '%s'\n", path);
+    }
+}
 
-/*
-    the fixed hardware color palette
+/* optional breakpoints and watchpoints ('-break addr', '-watch addr' and
+   '-watch-rd addr' command line args, hex), the emulation pauses after the
+   frame which hit one, press Home to continue
+*/
+dbg_t* debugger;
+bool debugger_paused;
+void check_debugger(void) {
+    if (debugger && dbg_stopped(debugger)) {
+        dbg_print_hit(debugger);
+        printf("debugger: paused, press Home to continue\n");
+        dbg_resume(debugger);
+        debugger_paused = true;
+    }
+}
+/* hits in re-run or run-ahead frames are ignored */
+void ignore_debugger(void) {
+    if (debugger) {
+        dbg_resume(debugger);
+    }
+}
+bool add_debugger_arg(const char* arg, const char* addr_str) {
+    uint16_t addr;
+    if (!dbg_parse_addr(addr_str, &addr)) {
+        printf("invalid address '%s' for %s\n", addr_str, arg);
+        return false;
+    }
+    if (!debugger) {
+        debugger = (dbg_t*) malloc(sizeof(dbg_t));
+        dbg_init(debugger);
+    }
+    bool ok;
+    if (0 == strcmp(arg, "-break")) {
+        ok = dbg_add_breakpoint(debugger, addr);
+    }
+    else {
+        ok = dbg_add_watchpoint(debugger, addr, 1, (0 == strcmp(arg, "-watch-rd")) ? DBG_WATCH_READ : DBG_WATCH_WRITE);
+    }
+    if (!ok) {
+        printf("too many breakpoints or watchpoints\n");
+    }
+    return ok;
+}
+
+/* optional per-page memory access counters ('-heatmap prefix' command line
+   arg), written to prefix.csv and prefix.ppm on exit
+*/
+const char* heatmap_prefix;
+heatmap_t* heatmap;
+void save_heatmap(void) {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s.csv", heatmap_prefix);
+    const bool csv_ok = heatmap_save_csv(heatmap, path);
+    snprintf(path, sizeof(path), "%s.ppm", heatmap_prefix);
+    const bool ppm_ok = heatmap_save_ppm(heatmap, path);
+    printf("%s memory access heatmap to '%s.csv' and '%s.ppm'\n", (csv_ok && ppm_ok) ? "saved" : "failed to save", heatmap_prefix, heatmap_prefix);
+}
+
+#if defined(CHIPS_CHIPTIME)
+/* per-chip host time accounting, a breakdown is printed every 300 frames */
+chiptime_t chiptime;
+#endif
+
+/* rewind history and run-ahead */
+#define REWIND_BUFFER_SIZE (8 * 1024 * 1024)
+#define REWIND_MAX_FRAMES (5 * 60 * 60)
+#define RUNAHEAD_MAX_FRAMES (2)
+rewind_t history;
+uint8_t* snapshot;
+bool rewinding;
+int runahead_frames;
+bool audio_muted;
+
+/* forward audio samples to the audio backend, except when re-running frames */
+void app_audio(const float* samples, int num_samples) {
+    if (!audio_muted) {
+        audio_push(samples, num_samples);
+    }
+}
+
+/* cycle-stamped key events, optionally recorded into or replayed from an input log */
+inputq_t inputq;
+const char* input_record_path;
+const char* input_replay_path;
+
+uint32_t input_exec(void* user_data, uint32_t ticks) {
+    (void)user_data;
+    return cpc_exec(&cpc, ticks);
+}
+
+void input_key(void* user_data, int key, bool down) {
+    (void)user_data;
+    if (down) {
+        kbd_key_down(&cpc.kbd, key);
+    }
+    else {
+        kbd_key_up(&cpc.kbd, key);
+    }
+}
 
-    http://www.cpcwiki.eu/index.php/CPC_Palette
-    http://www.grimware.org/doku.php/documentations/devices/gatearray
+void input_update(void* user_data) {
+    (void)user_data;
+    kbd_update(&cpc.kbd);
+}
 
-    index into this palette is the 'hardware color number' & 0x1F
-    order is ABGR
+/* post-boot snapshot, restored on startup instead of a cold boot unless
+   '-coldboot' or '-roms dir' is given ('-boot file' overrides the path),
+   '-save-boot file' boots headless and writes it (done by the build)
 */
-const uint32_t cpc_colors[32] = {
-    0xff6B7D6E,         // #40 white
-    0xff6D7D6E,         // #41 white
-    0xff6BF300,         // #42 sea green
-    0xff6DF3F3,         // #43 pastel yellow
-    0xff6B0200,         // #44 blue
-    0xff6802F0,         // #45 purple
-    0xff687800,         // #46 cyan
-    0xff6B7DF3,         // #47 pink
-    0xff6802F3,         // #48 purple
-    0xff6BF3F3,         // #49 pastel yellow
-    0xff0DF3F3,         // #4A bright yellow
-    0xffF9F3FF,         // #4B bright white
-    0xff0605F3,         // #4C bright red
-    0xffF402F3,         // #4D bright magenta
-    0xff0D7DF3,         // #4E orange
-    0xffF980FA,         // #4F pastel magenta
-    0xff680200,         // #50 blue
-    0xff6BF302,         // #51 sea green
-    0xff01F002,         // #52 bright green
-    0xffF2F30F,         // #53 bright cyan
-    0xff010200,         // #54 black
-    0xffF4020C,         // #55 bright blue
-    0xff017802,         // #56 green
-    0xffF47B0C,         // #57 sky blue
-    0xff680269,         // #58 magenta
-    0xff6BF371,         // #59 pastel green
-    0xff04F571,         // #5A lime
-    0xffF4F371,         // #5B pastel cyan
-    0xff01026C,         // #5C red
-    0xffF2026C,         // #5D mauve
-    0xff017B6E,         // #5E yellow
-    0xffF67B6E,         // #5F pastel blue
-};
+#define BOOT_TICKS (CPC_FREQ * 3)
+const char* boot_path = "cpc6128.boot";
+const char* save_boot_path;
+bool cold_boot;
+bool booted;
+bool save_boot_snapshot(void) {
+    cpc_init(&cpc, &(cpc_desc_t){
+        .pal8_buffer = pal8_buffer,
+        .pal8_buffer_size = sizeof(pal8_buffer),
+        .audio_sample_rate = BOOTSNAP_SAMPLE_RATE
+    });
+    cpc_exec(&cpc, BOOT_TICKS);
+    const uint32_t size = cpc_snapshot_size();
+    uint8_t* buf = (uint8_t*) malloc(size);
+    const bool ok = (size == cpc_save_snapshot(&cpc, buf, size)) && bootsnap_save(save_boot_path, BOOTSNAP_SAMPLE_RATE, buf, size);
+    free(buf);
+    printf("%s post-boot snapshot '%s'\n", ok ? "wrote" : "failed to write", save_boot_path);
+    return ok;
+}
+bool restore_boot_snapshot(void) {
+    uint32_t size;
+    uint8_t* buf = bootsnap_load(boot_path, audio_sample_rate(), &size);
+    const bool ok = buf && cpc_load_snapshot(&cpc, buf, size);
+    if (buf && !ok) {
+        printf("post-boot snapshot '%s' doesn't match this build, cold booting\n", boot_path);
+    }
+    free(buf);
+    return ok;
+}
 
-void cpc_init(void);
-void cpc_init_keymap(void);
-void cpc_update_memory_mapping(void);
-uint64_t cpc_cpu_tick(int num_ticks, uint64_t pins);
-uint64_t cpc_cpu_iorq(uint64_t pins);
-uint64_t cpc_ppi_out(int port_id, uint64_t pins, uint8_t data);
-uint8_t cpc_ppi_in(int port_id);
-void cpc_psg_out(int port_id, uint8_t data);
-uint8_t cpc_psg_in(int port_id);
-uint64_t cpc_ga_tick(uint64_t pins);
-void cpc_ga_int_ack();
-void cpc_ga_decode_video(uint64_t crtc_pins);
-void cpc_ga_decode_pixels(uint32_t* dst, uint64_t crtc_pins);
+/* optional program to load ('-load file.bin' command line arg), without a
+   post-boot snapshot the system boots unthrottled before the program is
+   copied into memory
+*/
+const char* load_path;
+void load_program(void) {
+    uint32_t size;
+    uint8_t* data = quickload_read(load_path, &size);
+    if (data && !booted) {
+        audio_muted = true;
+        cpc_exec(&cpc, BOOT_TICKS);
+        audio_muted = false;
+    }
+    if (!data || !cpc_quickload(&cpc, data, size)) {
+        printf("failed to load '%s'\n", load_path);
+    }
+    free(data);
+}
+
+/* optional frame capture ('-capture file.raw' or '-capture prefix' for a PNG sequence) */
+const char* capture_path;
 
 /* sokol-app entry, configure application callbacks and window */
 void app_init(void);
@@ -121,6 +270,72 @@ void app_input(const sapp_event*);
 void app_cleanup(void);
 
 sapp_desc sokol_main(int argc, char* argv[]) {
+    #if !defined(__EMSCRIPTEN__)
+    for (int i = 1; i < argc; i++) {
+        if ((0 == strcmp(argv[i], "-roms")) && (i+1 < argc)) {
+            rom_dir = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "-capture")) && (i+1 < argc)) {
+            capture_path = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "-trace")) && !trace_buffer) {
+            trace_buffer = (bustrace_entry_t*) malloc(TRACE_NUM_ENTRIES * sizeof(bustrace_entry_t));
+            bustrace_init(&trace, BUSTRACE_CPU_Z80, trace_buffer, TRACE_NUM_ENTRIES);
+        }
+        else if ((0 == strcmp(argv[i], "-trace-pc")) && trace_buffer && (i+1 < argc)) {
+            const uint64_t addr = strtoul(argv[++i], 0, 16) & 0xFFFF;
+            bustrace_set_trigger(&trace, Z80_M1|Z80_MREQ|0xFFFF, Z80_M1|Z80_MREQ|addr, TRACE_NUM_ENTRIES / 2);
+        }
+        else if (0 == strcmp(argv[i], "-prof")) {
+            prof = (pcprof_t*) malloc(sizeof(pcprof_t));
+            pcprof_init(prof, PCPROF_DEFAULT_INTERVAL);
+        }
+        else if ((0 == strcmp(argv[i], "-labels")) && (i+1 < argc)) {
+            if (!pcprof_load_labels(&prof_labels, argv[++i])) {
+                printf("failed to load label file '%s'\n", argv[i]);
+            }
+        }
+        else if (((0 == strcmp(argv[i], "-break")) || (0 == strcmp(argv[i], "-watch")) || (0 == strcmp(argv[i], "-watch-rd"))) && (i+1 < argc)) {
+            add_debugger_arg(argv[i], argv[i+1]);
+            i++;
+        }
+        else if ((0 == strcmp(argv[i], "-load")) && (i+1 < argc)) {
+            load_path = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "-boot")) && (i+1 < argc)) {
+            boot_path = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "-save-boot")) && (i+1 < argc)) {
+            save_boot_path = argv[++i];
+        }
+        else if (0 == strcmp(argv[i], "-coldboot")) {
+            cold_boot = true;
+        }
+        else if (0 == strcmp(argv[i], "-framelock")) {
+            frame_lock = true;
+        }
+        else if (0 == strcmp(argv[i], "-telemetry")) {
+            telemetry_enabled = telemetry_overlay = true;
+        }
+        else if (0 == strcmp(argv[i], "-telemetry-log")) {
+            telemetry_enabled = true;
+        }
+        else if ((0 == strcmp(argv[i], "-heatmap")) && (i+1 < argc) && !heatmap) {
+            heatmap_prefix = argv[++i];
+            heatmap = (heatmap_t*) malloc(sizeof(heatmap_t));
+            heatmap_init(heatmap);
+        }
+        else if ((0 == strcmp(argv[i], "-input-record")) && (i+1 < argc)) {
+            input_record_path = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "-input-replay")) && (i+1 < argc)) {
+            input_replay_path = argv[++i];
+        }
+    }
+    if (save_boot_path) {
+        exit(save_boot_snapshot() ? 0 : 10);
+    }
+    #endif
     return (sapp_desc) {
         .init_cb = app_init,
         .frame_cb = app_frame,
@@ -134,24 +349,168 @@ sapp_desc sokol_main(int argc, char* argv[]) {
 
 /* one-time application init */
 void app_init(void) {
-    gfx_init(CPC_DISP_WIDTH, CPC_DISP_HEIGHT);
-    cpc_init();
+    #if defined(CHIPS_CHIPTIME)
+    chiptime_init(&chiptime, &(chiptime_desc_t){
+        .name = "CPC 6128",
+        .slot_names = { CPC_CHIPTIME_NAMES },
+        .num_slots = CPC_CHIPTIME_NUM,
+        .report_frames = 300
+    });
+    #endif
+    audio_init(0);
+    /* the CPC decodes 8-bit color indices, the palette lookup happens on the GPU */
+    uint32_t palette[CPC_PAL8_NUM_COLORS];
+    cpc_pal8_colors(palette);
+    gfx_init_indexed(CPC_DISP_WIDTH, CPC_DISP_HEIGHT, palette, CPC_PAL8_NUM_COLORS);
+    if (capture_path) {
+        gfx_enable_capture(capture_path);
+    }
+    cpc_init(&cpc, &(cpc_desc_t){
+        .pal8_buffer = pal8_buffer,
+        .pal8_buffer_size = sizeof(pal8_buffer),
+        .audio_cb = app_audio,
+        .audio_sample_rate = audio_sample_rate(),
+        .rom_os = romfile_load(&rom_os, rom_dir, "cpc6128_os.bin", dump_cpc6128_os, sizeof(dump_cpc6128_os)),
+        .rom_basic = romfile_load(&rom_basic, rom_dir, "cpc6128_basic.bin", dump_cpc6128_basic, sizeof(dump_cpc6128_basic)),
+        .rom_amsdos = romfile_load(&rom_amsdos, rom_dir, "cpc6128_amsdos.bin", dump_cpc6128_amsdos, sizeof(dump_cpc6128_amsdos)),
+        .prof = prof,
+        .trace = trace_buffer ? &trace : 0,
+        .dbg = debugger,
+        .heatmap = heatmap,
+        #if defined(CHIPS_CHIPTIME)
+        .chiptime = &chiptime,
+        #endif
+    });
+    if (!cold_boot && !rom_dir) {
+        booted = restore_boot_snapshot();
+    }
+    if (load_path) {
+        load_program();
+    }
+    snapshot = (uint8_t*) malloc(cpc_snapshot_size());
+    rewind_init(&history, &(rewind_desc_t){
+        .snapshot_size = cpc_snapshot_size(),
+        .buffer_size = REWIND_BUFFER_SIZE,
+        .max_frames = REWIND_MAX_FRAMES
+    });
+    inputq_init(&inputq, &(inputq_desc_t){
+        .exec_cb = input_exec,
+        .key_cb = input_key,
+        .update_cb = input_update,
+        .update_ticks = CPC_FREQ / 50
+    });
+    if (input_record_path && !inputq_record(&inputq, input_record_path)) {
+        printf("failed to create input log '%s'\n", input_record_path);
+    }
+    if (input_replay_path && !inputq_replay(&inputq, input_replay_path)) {
+        printf("failed to load input log '%s'\n", input_replay_path);
+    }
+    framepace_init(&pace, &(framepace_desc_t){
+        .freq_hz = CPC_FREQ,
+        .frame_ticks = CPC_FRAME_TICKS,
+        .lock = frame_lock
+    });
+    if (telemetry_enabled) {
+        telemetry_init(&telemetry, &(telemetry_desc_t){
+            .name = "cpc6128",
+            .freq_hz = CPC_FREQ,
+            .log_interval_sec = TELEMETRY_LOG_SEC
+        });
+    }
     last_time_stamp = stm_now();
 }
 
+/* run one emulated frame in warp mode, only decode the video output when requested */
+void warp_frame(bool decode) {
+    cpc.skip_video = !decode;
+    inputq_exec(&inputq, CPC_FREQ / 50);
+    cpc.skip_video = false;
+}
+
 /* per frame stuff, tick the emulator, handle input, decode and draw emulator display */
 void app_frame(void) {
+    #if defined(CHIPS_CHIPTIME)
+    chiptime_frame(&chiptime);
+    #endif
+    if (trace_buffer && bustrace_stopped(&trace) && trace.triggered) {
+        /* the trigger hit in the last frame, save once */
+        save_trace();
+        trace.triggered = false;
+    }
+    if (debugger_paused) {
+        /* stopped at a breakpoint or watchpoint */
+        stm_laptime(&last_time_stamp);
+        overrun_ticks = 0;
+        gfx_draw();
+        return;
+    }
     double frame_time = stm_sec(stm_laptime(&last_time_stamp));
     /* skip long pauses when the app was suspended */
     if (frame_time > 0.1) {
         frame_time = 0.1;
     }
-    uint32_t ticks_to_run = (uint32_t) ((CPC_FREQ * frame_time) - overrun_ticks);
-    uint32_t ticks_executed = z80_exec(&cpc.cpu, ticks_to_run);
+    if (warp.enabled) {
+        /* run as fast as possible, and only present the last frame */
+        warp_run(&warp, warp_frame, 1.0 / 50.0);
+        check_debugger();
+        gfx_draw();
+        return;
+    }
+    const uint32_t snapshot_size = cpc_snapshot_size();
+    if (rewinding) {
+        /* step back one frame, and run a single frame to regenerate the display */
+        if (history.num_frames > 1) {
+            rewind_pop(&history, 1);
+        }
+        if (rewind_get(&history, 0, snapshot)) {
+            cpc_load_snapshot(&cpc, snapshot, snapshot_size);
+            audio_muted = true;
+            cpc_exec(&cpc, CPC_FREQ / 50);
+            audio_muted = false;
+            ignore_debugger();
+            gfx_draw();
+            cpc_load_snapshot(&cpc, snapshot, snapshot_size);
+            overrun_ticks = 0;
+            return;
+        }
+    }
+    telemetry_sec += frame_time;
+    const uint32_t budget = framepace_ticks(&pace, frame_time);
+    const audio_stats_t audio = audio_stats();
+    audio_set_resample_ratio(framepace_resample_ratio(&pace, audio.fill, 2 * audio.buffer_frames));
+    if (budget <= overrun_ticks) {
+        /* locked to a faster display, present the last emulated frame again */
+        overrun_ticks -= budget;
+        gfx_draw();
+        return;
+    }
+    const uint64_t emu_start = stm_now();
+    uint32_t ticks_to_run = budget - overrun_ticks;
+    uint32_t ticks_executed = inputq_exec(&inputq, ticks_to_run);
     assert(ticks_executed >= ticks_to_run);
     overrun_ticks = ticks_executed - ticks_to_run;
-    kbd_update(&cpc.kbd);
+    check_debugger();
+    cpc_save_snapshot(&cpc, snapshot, snapshot_size);
+    rewind_push(&history, snapshot);
+    if (runahead_frames > 0) {
+        /* display the state N frames ahead, then roll back */
+        audio_muted = true;
+        cpc_exec(&cpc, runahead_frames * (CPC_FREQ / 50));
+        audio_muted = false;
+        ignore_debugger();
+        const uint64_t emu_time = stm_since(emu_start);
+        gfx_draw();
+        cpc_load_snapshot(&cpc, snapshot, snapshot_size);
+        if (telemetry_enabled) {
+            push_telemetry(ticks_executed, emu_time);
+        }
+        return;
+    }
+    const uint64_t emu_time = stm_since(emu_start);
     gfx_draw();
+    if (telemetry_enabled) {
+        push_telemetry(ticks_executed, emu_time);
+    }
 }
 
 /* keyboard input handling */
@@ -162,12 +521,39 @@ void app_input(const sapp_event* event) {
         case SAPP_EVENTTYPE_CHAR:
             c = (int) event->char_code;
             if (c < KBD_MAX_KEYS) {
-                kbd_key_down(&cpc.kbd, c);
-                kbd_key_up(&cpc.kbd, c);
+                inputq_push(&inputq, c, true);
+                inputq_push(&inputq, c, false);
             }
             break;
         case SAPP_EVENTTYPE_KEY_DOWN:
         case SAPP_EVENTTYPE_KEY_UP:
+            if ((event->key_code == SAPP_KEYCODE_END) && (event->type == SAPP_EVENTTYPE_KEY_DOWN)) {
+                /* toggle warp mode */
+                warp_enable(&warp, !warp.enabled);
+                audio_set_muted(warp.enabled);
+                break;
+            }
+            if (event->key_code == SAPP_KEYCODE_PAGE_UP) {
+                rewinding = (event->type == SAPP_EVENTTYPE_KEY_DOWN);
+                break;
+            }
+            if ((event->key_code == SAPP_KEYCODE_PAGE_DOWN) && (event->type == SAPP_EVENTTYPE_KEY_DOWN)) {
+                runahead_frames = (runahead_frames + 1) % (RUNAHEAD_MAX_FRAMES + 1);
+                break;
+            }
+            if ((event->key_code == SAPP_KEYCODE_HOME) && (event->type == SAPP_EVENTTYPE_KEY_DOWN)) {
+                /* continue after a breakpoint or watchpoint */
+                debugger_paused = false;
+                break;
+            }
+            if ((event->key_code == SAPP_KEYCODE_INSERT) && (event->type == SAPP_EVENTTYPE_KEY_DOWN)) {
+                /* save the bus trace and continue recording */
+                if (trace_buffer) {
+                    save_trace();
+                    bustrace_restart(&trace);
+                }
+                break;
+            }
             switch (event->key_code) {
                 case SAPP_KEYCODE_SPACE:        c = 0x20; break; 
                 case SAPP_KEYCODE_LEFT:         c = 0x08; break;
@@ -193,12 +579,7 @@ void app_input(const sapp_event* event) {
                 default:                        c = 0; break;
             }
             if (c) {
-                if (event->type == SAPP_EVENTTYPE_KEY_DOWN) {
-                    kbd_key_down(&cpc.kbd, c);
-                }
-                else {
-                    kbd_key_up(&cpc.kbd, c);
-                }
+                inputq_push(&inputq, c, event->type == SAPP_EVENTTYPE_KEY_DOWN);
             }
             break;
         default:
@@ -208,661 +589,26 @@ void app_input(const sapp_event* event) {
 
 /* application cleanup callback */
 void app_cleanup(void) {
-    gfx_shutdown();
-}
-
-/* CPC 6128 emulator init */
-void cpc_init(void) {
-    cpc.upper_rom_select = 0;
-    cpc.tick_count = 0;
-    cpc.ga_next_video_mode = 1;
-    cpc.ga_video_mode = 1;
-    cpc.ga_hsync_delay_counter = 2;
-    cpc_init_keymap();
-    cpc_update_memory_mapping();
-
-    z80_init(&cpc.cpu, cpc_cpu_tick);
-    i8255_init(&cpc.ppi, cpc_ppi_in, cpc_ppi_out);
-    mc6845_init(&cpc.vdg, MC6845_TYPE_UM6845R);
-    crt_init(&cpc.crt, CRT_PAL, 6, 32, CPC_DISP_WIDTH/16, CPC_DISP_HEIGHT);
-    ay38910_init(&cpc.psg, &(ay38910_desc_t){
-        .type = AY38910_TYPE_8912,
-        .in_cb = cpc_psg_in,
-        .out_cb = cpc_psg_out,
-        .tick_hz = 1000000,
-        .sound_hz = 44100,
-        .magnitude = 0.5
-    });
-
-    /* CPU start address */
-    cpc.cpu.state.PC = 0x0000;
-}
-
-void cpc_init_keymap() {
-    /*
-        http://cpctech.cpc-live.com/docs/keyboard.html
-    
-        CPC has a 10 columns by 8 lines keyboard matrix. The 10 columns
-        are lit up by bits 0..3 of PPI port C connected to a 74LS145
-        BCD decoder, and the lines are read through port A of the
-        AY-3-8910 chip.
-    */
-    kbd_init(&cpc.kbd, 1);
-    const char* keymap =
-        /* no shift */
-        "   ^08641 "
-        "  [-97532 "
-        "   @oure  "
-        "  ]piytwq "
-        "   ;lhgs  "
-        "   :kjfda "
-        "  \\/mnbc  "
-        "   ., vxz "
-
-        /* shift */
-        "    _(&$! "
-        "  {=)'%#\" "
-        "   |OURE  "
-        "  }PIYTWQ "
-        "   +LHGS  "
-        "   *KJFDA "
-        "  `?MNBC  "
-        "   >< VXZ ";
-    /* shift key is on column 2, line 5 */
-    kbd_register_modifier(&cpc.kbd, 0, 2, 5);
-    /* ctrl key is on column 2, line 7 */
-    kbd_register_modifier(&cpc.kbd, 1, 2, 7);
-
-    for (int shift = 0; shift < 2; shift++) {
-        for (int col = 0; col < 10; col++) {
-            for (int line = 0; line < 8; line++) {
-                int c = keymap[shift*80 + line*10 + col];
-                if (c != 0x20) {
-                    kbd_register_key(&cpc.kbd, c, col, line, shift?(1<<0):0);
-                }
-            }
-        }
-    }
-
-    /* special keys */
-    kbd_register_key(&cpc.kbd, 0x20, 5, 7, 0);    // space
-    kbd_register_key(&cpc.kbd, 0x08, 1, 0, 0);    // cursor left
-    kbd_register_key(&cpc.kbd, 0x09, 0, 1, 0);    // cursor right
-    kbd_register_key(&cpc.kbd, 0x0A, 0, 2, 0);    // cursor down
-    kbd_register_key(&cpc.kbd, 0x0B, 0, 0, 0);    // cursor up
-    kbd_register_key(&cpc.kbd, 0x01, 9, 7, 0);    // delete
-    kbd_register_key(&cpc.kbd, 0x0C, 2, 0, 0);    // clr
-    kbd_register_key(&cpc.kbd, 0x0D, 2, 2, 0);    // return
-    kbd_register_key(&cpc.kbd, 0x03, 8, 2, 0);    // escape
-}
-
-static const int cpc_ram_config_table[8][4] = {
-    { 0, 1, 2, 3 },
-    { 0, 1, 2, 7 },
-    { 4, 5, 6, 7 },
-    { 0, 3, 2, 7 },
-    { 0, 4, 2, 3 },
-    { 0, 5, 2, 3 },
-    { 0, 6, 2, 3 },
-    { 0, 7, 2, 3 },
-};
-
-void cpc_update_memory_mapping() {
-    /* index into RAM config array */
-    int ram_table_index = cpc.ga_ram_config & 0x07;
-    const uint8_t* rom0_ptr = dump_cpc6128_os;
-    const uint8_t* rom1_ptr;
-    if (cpc.upper_rom_select == 7) {
-        rom1_ptr = dump_cpc6128_amsdos;
-    }
-    else {
-        rom1_ptr = dump_cpc6128_basic;
-    }
-    const int i0 = cpc_ram_config_table[ram_table_index][0];
-    const int i1 = cpc_ram_config_table[ram_table_index][1];
-    const int i2 = cpc_ram_config_table[ram_table_index][2];
-    const int i3 = cpc_ram_config_table[ram_table_index][3];
-    /* 0x0000..0x3FFF */
-    if (cpc.ga_config & (1<<2)) {
-        /* read/write from and to RAM bank */
-        mem_map_ram(&cpc.mem, 0, 0x0000, 0x4000, cpc.ram[i0]);
-    }
-    else {
-        /* read from ROM, write to RAM */
-        mem_map_rw(&cpc.mem, 0, 0x0000, 0x4000, rom0_ptr, cpc.ram[i0]);
-    }
-    /* 0x4000..0x7FFF */
-    mem_map_ram(&cpc.mem, 0, 0x4000, 0x4000, cpc.ram[i1]);
-    /* 0x8000..0xBFFF */
-    mem_map_ram(&cpc.mem, 0, 0x8000, 0x4000, cpc.ram[i2]);
-    /* 0xC000..0xFFFF */
-    if (cpc.ga_config & (1<<3)) {
-        /* read/write from and to RAM bank */
-        mem_map_ram(&cpc.mem, 0, 0xC000, 0x4000, cpc.ram[i3]);
-    }
-    else {
-        /* read from ROM, write to RAM */
-        mem_map_rw(&cpc.mem, 0, 0xC000, 0x4000, rom1_ptr, cpc.ram[i3]);
-    }
-}
-
-uint64_t cpc_cpu_tick(int num_ticks, uint64_t pins) {
-    /* interrupt acknowledge? */
-    if ((pins & (Z80_M1|Z80_IORQ)) == (Z80_M1|Z80_IORQ)) {
-        cpc_ga_int_ack();
-    }
-
-    /* memory and IO requests */
-    if (pins & Z80_MREQ) {
-        /* CPU MEMORY REQUEST */
-        const uint16_t addr = Z80_GET_ADDR(pins);
-        if (pins & Z80_RD) {
-            Z80_SET_DATA(pins, mem_rd(&cpc.mem, addr));
-        }
-        else if (pins & Z80_WR) {
-            mem_wr(&cpc.mem, addr, Z80_GET_DATA(pins));
-        }
-    }
-    else if ((pins & Z80_IORQ) && (pins & (Z80_RD|Z80_WR))) {
-        /* CPU IO REQUEST */
-        pins = cpc_cpu_iorq(pins);
-    }
-    
-    /*
-        tick the gate array and audio chip at 1 MHz, and decide how many wait
-        states must be injected, the CPC signals the wait line in 3 out of 4
-        cycles:
-    
-         0: wait inactive
-         1: wait active
-         2: wait active
-         3: wait active
-    
-        the CPU samples the wait line only on specific clock ticks
-        during memory or IO operations, wait states are only injected
-        if the 'wait active' happens on the same clock tick as the
-        CPU would sample the wait line
-    */
-    int wait_scan_tick = -1;
-    if (pins & Z80_MREQ) {
-        /* a memory request or opcode fetch, wait is sampled on second clock tick */
-        wait_scan_tick = 1;
-    }
-    else if (pins & Z80_IORQ) {
-        if (pins & Z80_M1) {
-            /* an interrupt acknowledge cycle, wait is sampled on fourth clock tick */
-            wait_scan_tick = 3;
-        }
-        else {
-            /* an IO cycle, wait is sampled on third clock tick */
-            wait_scan_tick = 2;
-        }
-    }
-    bool wait = false;
-    uint32_t wait_cycles = 0;
-    for (int i = 0; i<num_ticks; i++) {
-        do {
-            /* CPC gate array sets the wait pin for 3 out of 4 clock ticks */
-            bool wait_pin = (cpc.tick_count++ & 3) != 0;
-            wait = (wait_pin && (wait || (i == wait_scan_tick)));
-            if (wait) {
-                wait_cycles++;
-            }
-            /* on every 4th clock cycle, tick the system */
-            if (!wait_pin) {
-                if (ay38910_tick(&cpc.psg)) {
-                    /* FIXME: new sample ready, write to audio buffer */
-                }
-                pins = cpc_ga_tick(pins);
-            }
-        }
-        while (wait);
-    }
-    Z80_SET_WAIT(pins, wait_cycles);
-
-    return pins;
-}
-
-uint64_t cpc_cpu_iorq(uint64_t pins) {
-    /*
-        CPU IO REQUEST
-
-        For address decoding, see the main board schematics!
-        also: http://cpcwiki.eu/index.php/Default_I/O_Port_Summary
-
-        Z80 to i8255 PPI pin connections:
-            ~A11 -> CS (CS is active-low)
-                A8 -> A0
-                A9 -> A1
-                RD -> RD
-                WR -> WR
-            D0..D7 -> D0..D7
-    */
-    if ((pins & Z80_A11) == 0) {
-        /* i8255 in/out */
-        uint64_t ppi_pins = (pins & Z80_PIN_MASK)|I8255_CS;
-        if (pins & Z80_A9) { ppi_pins |= I8255_A1; }
-        if (pins & Z80_A8) { ppi_pins |= I8255_A0; }
-        if (pins & Z80_RD) { ppi_pins |= I8255_RD; }
-        if (pins & Z80_WR) { ppi_pins |= I8255_WR; }
-        pins = i8255_iorq(&cpc.ppi, ppi_pins) & Z80_PIN_MASK;
-    }
-    /*
-        Z80 to MC6845 pin connections:
-
-            ~A14 -> CS (CS is active low)
-            A9  -> RW (high: read, low: write)
-            A8  -> RS
-        D0..D7  -> D0..D7
-    */
-    if ((pins & Z80_A14) == 0) {
-        /* 6845 in/out */
-        uint64_t vdg_pins = (pins & Z80_PIN_MASK)|MC6845_CS;
-        if (pins & Z80_A9) { vdg_pins |= MC6845_RW; }
-        if (pins & Z80_A8) { vdg_pins |= MC6845_RS; }
-        pins = mc6845_iorq(&cpc.vdg, vdg_pins) & Z80_PIN_MASK;
-    }
-    /*
-        Gate Array Function (only writing to the gate array
-        is possible, but the gate array doesn't check the
-        CPU R/W pins, so each access is a write).
-
-        This is used by the Arnold Acid test "OnlyInc", which
-        access the PPI and gate array in the same IO operation
-        to move data directly from the PPI into the gate array.
-    */
-    if ((pins & (Z80_A15|Z80_A14)) == Z80_A14) {
-        /* D6 and D7 select the gate array operation */
-        const uint8_t data = Z80_GET_DATA(pins);
-        switch (data & ((1<<7)|(1<<6))) {
-            case 0:
-                /* select pen:
-                    bit 4 set means 'select border', otherwise
-                    bits 0..3 contain the pen number
-                */
-                cpc.ga_pen = data & 0x1F;
-                break;
-            case (1<<6):
-                /* select color for border or selected pen: */
-                if (cpc.ga_pen & (1<<4)) {
-                    /* border color */
-                    cpc.ga_border_color = cpc_colors[data & 0x1F];
-                }
-                else {
-                    cpc.ga_palette[cpc.ga_pen & 0x0F] = cpc_colors[data & 0x1F];
-                }
-                break;
-            case (1<<7):
-                /* select screen mode, ROM config and interrupt control
-                    - bits 0 and 1 select the screen mode
-                        00: Mode 0 (160x200 @ 16 colors)
-                        01: Mode 1 (320x200 @ 4 colors)
-                        02: Mode 2 (640x200 @ 2 colors)
-                        11: Mode 3 (160x200 @ 2 colors, undocumented)
-                  
-                    - bit 2: disable/enable lower ROM
-                    - bit 3: disable/enable upper ROM
-                  
-                    - bit 4: interrupt generation control
-                */
-                cpc.ga_config = data;
-                cpc.ga_next_video_mode = data & 3;
-                if (data & (1<<4)) {
-                    cpc.ga_hsync_irq_counter = 0;
-                    cpc.ga_int = false;
-                }
-                cpc_update_memory_mapping();
-                break;
-            case (1<<7)|(1<<6):
-                /* RAM memory management (only CPC6128) */
-                cpc.ga_ram_config = data;
-                cpc_update_memory_mapping();
-                break;
-        }
-    }
-    /*
-        Upper ROM Bank number
-
-        This is used to select a ROM in the
-        0xC000..0xFFFF region, without expansions,
-        this is just the BASIC and AMSDOS ROM.
-    */
-    if ((pins & Z80_A13) == 0) {
-        cpc.upper_rom_select = Z80_GET_DATA(pins);
-        cpc_update_memory_mapping();
-    }
-    /*
-        Floppy Disk Interface
-    */
-    if ((pins & (Z80_A10|Z80_A8|Z80_A7)) == 0) {
-        /* FIXME: floppy disk motor control */
-    }
-    else if ((pins & (Z80_A10|Z80_A8|Z80_A7)) == Z80_A8) {
-        /* floppy controller status/data register */
-        if (pins & Z80_RD) {
-            Z80_SET_DATA(pins, 0xFF);
-        }
-    }
-    return pins;
-}
-
-uint64_t cpc_ppi_out(int port_id, uint64_t pins, uint8_t data) {
-    /*
-        i8255 PPI to AY-3-8912 PSG pin connections:
-            PA0..PA7    -> D0..D7
-                 PC7    -> BDIR
-                 PC6    -> BC1
-    */
-    if ((I8255_PORT_A == port_id) || (I8255_PORT_C == port_id)) {
-        const uint8_t ay_ctrl = cpc.ppi.output[I8255_PORT_C] & ((1<<7)|(1<<6));
-        if (ay_ctrl) {
-            uint64_t ay_pins = 0;
-            if (ay_ctrl & (1<<7)) { ay_pins |= AY38910_BDIR; }
-            if (ay_ctrl & (1<<6)) { ay_pins |= AY38910_BC1; }
-            const uint8_t ay_data = cpc.ppi.output[I8255_PORT_A];
-            AY38910_SET_DATA(ay_pins, ay_data);
-            ay38910_iorq(&cpc.psg, ay_pins);
-        }
-    }
-    if (I8255_PORT_C == port_id) {
-        // bits 0..3: select keyboard matrix line
-        kbd_set_active_columns(&cpc.kbd, 1<<(data & 0x0F));
-
-        /* FIXME: cassette write data */
-        /* FIXME: cassette deck motor control */
-        if (data & (1<<4)) {
-            // tape_start_motor();
-        }
-        else {
-            // tape_stop_motor();
-        }
-    }
-    return pins;
-}
-
-uint8_t cpc_ppi_in(int port_id) {
-    if (I8255_PORT_A == port_id) {
-        /* AY-3-8912 PSG function (indirectly this may also trigger
-            a read of the keyboard matrix via the AY's IO port
-        */
-        uint64_t ay_pins = 0;
-        uint8_t ay_ctrl = cpc.ppi.output[I8255_PORT_C];
-        if (ay_ctrl & (1<<7)) ay_pins |= AY38910_BDIR;
-        if (ay_ctrl & (1<<6)) ay_pins |= AY38910_BC1;
-        uint8_t ay_data = cpc.ppi.output[I8255_PORT_A];
-        AY38910_SET_DATA(ay_pins, ay_data);
-        ay_pins = ay38910_iorq(&cpc.psg, ay_pins);
-        return AY38910_GET_DATA(ay_pins);
-    }
-    else if (I8255_PORT_B == port_id) {
-        /*
-            Bit 7: cassette data input
-            Bit 6: printer port ready (1=not ready, 0=ready)
-            Bit 5: expansion port /EXP pin
-            Bit 4: screen refresh rate (1=50Hz, 0=60Hz)
-            Bit 3..1: distributor id (shown in start screen)
-                0: Isp
-                1: Triumph
-                2: Saisho
-                3: Solavox
-                4: Awa
-                5: Schneider
-                6: Orion
-                7: Amstrad
-            Bit 0: vsync
-        */
-        uint8_t val = (1<<4) | (7<<1);    // 50Hz refresh rate, Amstrad
-        /* PPI Port B Bit 0 is directly wired to the 6845 VSYNC pin (see schematics) */
-        if (cpc.vdg.vs) {
-            val |= (1<<0);
-        }
-        return val;
-    }
-    else {
-        /* shouldn't happen */
-        return 0xFF;
+    if (frame_lock) {
+        framepace_print(&pace);
     }
-}
-
-void cpc_psg_out(int port_id, uint8_t data) {
-    /* this shouldn't be called */
-}
-
-uint8_t cpc_psg_in(int port_id) {
-    /* read the keyboard matrix and joystick port */
-    if (port_id == AY38910_PORT_A) {
-        uint8_t data = (uint8_t) kbd_scan_lines(&cpc.kbd);
-        if (cpc.kbd.active_columns & (1<<9)) {
-            /* FIXME: joystick input not implemented
-
-                joystick input is implemented like this:
-                - the keyboard column 9 is routed to the joystick
-                  ports "COM1" pin, this means the joystick is only
-                  "powered" when the keyboard line 9 is active
-                - the joysticks direction and fire pins are
-                  connected to the keyboard matrix lines as
-                  input to PSG port A
-                - thus, only when the keyboard matrix column 9 is sampled,
-                  joystick input will be provided on the keyboard
-                  matrix lines
-            */
-            // data |= cpc.joymask;
-        }
-        return ~data;
-    }
-    else {
-        /* this shouldn't happen since the AY-3-8912 only has one IO port */
-        return 0xFF;
-    }
-}
-
-void cpc_ga_int_ack() {
-    /* on interrupt acknowledge from the CPU, clear the top bit from the
-        hsync counter, so the next interrupt can't occur closer then 
-        32 HSYNC, and clear the gate array interrupt pin state
-    */
-    cpc.ga_hsync_irq_counter &= 0x1F;
-    cpc.ga_int = false;
-}
-
-static bool falling_edge(uint64_t new_pins, uint64_t old_pins, uint64_t mask) {
-    return 0 != (mask & (~new_pins & (new_pins ^ old_pins)));
-}
-
-static bool rising_edge(uint64_t new_pins, uint64_t old_pins, uint64_t mask) {
-    return 0 != (mask & (new_pins & (new_pins ^ old_pins)));
-}
-
-uint64_t cpc_ga_tick(uint64_t cpu_pins) {
-    /*
-        http://cpctech.cpc-live.com/docs/ints.html
-        http://www.cpcwiki.eu/forum/programming/frame-flyback-and-interrupts/msg25106/#msg25106
-        https://web.archive.org/web/20170612081209/http://www.grimware.org/doku.php/documentations/devices/gatearray
-    */
-    uint64_t crtc_pins = mc6845_tick(&cpc.vdg);
-
-    /*
-        INTERRUPT GENERATION:
-
-        From: https://web.archive.org/web/20170612081209/http://www.grimware.org/doku.php/documentations/devices/gatearray
-
-        - On every falling edge of the HSYNC signal (from the 6845),
-          the gate array will increment the counter by one. When the
-          counter reaches 52, the gate array will raise the INT signal
-          and reset the counter.
-        - When the CPU acknowledges the interrupt, the gate array will
-          reset bit5 of the counter, so the next interrupt can't occur
-          closer than 32 HSync.
-        - When a VSync occurs, the gate array will wait for 2 HSync and:
-            - if the counter>=32 (bit5=1) then no interrupt request is issued
-              and counter is reset to 0
-            - if the counter<32 (bit5=0) then an interrupt request is issued
-              and counter is reset to 0
-        - This 2 HSync delay after a VSync is used to let the main program,
-          executed by the CPU, enough time to sense the VSync...
-
-        From: http://www.cpcwiki.eu/index.php?title=CRTC
-        
-        - The HSYNC is modified before being sent to the monitor. It happens
-          2us after the HSYNC from the CRTC and lasts 4us when HSYNC length
-          is greater or equal to 6.
-        - The VSYNC is also modified before being sent to the monitor, it happens
-          two lines after the VSYNC from the CRTC and stay 2 lines (same cut
-          rule if VSYNC is lower than 4).
-
-        NOTES:
-            - the interrupt acknowledge is handled once per machine 
-              cycle in cpu_tick()
-            - the video mode will take effect *after the next HSYNC*
-    */
-    if (rising_edge(crtc_pins, cpc.ga_crtc_pins, MC6845_VS)) {
-        cpc.ga_hsync_after_vsync_counter = 2;
-    }
-    if (falling_edge(crtc_pins, cpc.ga_crtc_pins, MC6845_HS)) {
-        cpc.ga_video_mode = cpc.ga_next_video_mode;
-        cpc.ga_hsync_irq_counter = (cpc.ga_hsync_irq_counter + 1) & 0x3F;
-
-        /* 2 HSync delay? */
-        if (cpc.ga_hsync_after_vsync_counter > 0) {
-            cpc.ga_hsync_after_vsync_counter--;
-            if (cpc.ga_hsync_after_vsync_counter == 0) {
-                if (cpc.ga_hsync_irq_counter >= 32) {
-                    cpc.ga_int = true;
-                }
-                cpc.ga_hsync_irq_counter = 0;
-            }
-        }
-        /* normal behaviour, request interrupt each 52 scanlines */
-        if (cpc.ga_hsync_irq_counter == 52) {
-            cpc.ga_hsync_irq_counter = 0;
-            cpc.ga_int = true;
-        }
-    }
-
-    /* generate HSYNC signal to monitor:
-        - starts 2 ticks after HSYNC rising edge from CRTC
-        - stays active for 4 ticks or less if CRTC HSYNC goes inactive earlier
-    */
-    if (rising_edge(crtc_pins, cpc.ga_crtc_pins, MC6845_HS)) {
-        cpc.ga_hsync_delay_counter = 3;
-    }
-    if (falling_edge(crtc_pins, cpc.ga_crtc_pins, MC6845_HS)) {
-        cpc.ga_hsync_delay_counter = 0;
-        cpc.ga_hsync_counter = 0;
-        cpc.ga_sync = false;
-    }
-    if (cpc.ga_hsync_delay_counter > 0) {
-        cpc.ga_hsync_delay_counter--;
-        if (cpc.ga_hsync_delay_counter == 0) {
-            cpc.ga_sync = true;
-            cpc.ga_hsync_counter = 5;
-        }
-    }
-    if (cpc.ga_hsync_counter > 0) {
-        cpc.ga_hsync_counter--;
-        if (cpc.ga_hsync_counter == 0) {
-            cpc.ga_sync = false;
-        }
-    }
-
-    // FIXME delayed VSYNC to monitor
-
-    const bool vsync = 0 != (crtc_pins & MC6845_VS);
-    crt_tick(&cpc.crt, cpc.ga_sync, vsync);
-    cpc_ga_decode_video(crtc_pins);
-
-    cpc.ga_crtc_pins = crtc_pins;
-
-    if (cpc.ga_int) {
-        cpu_pins |= Z80_INT;
-    }
-    return cpu_pins;
-}
-
-void cpc_ga_decode_pixels(uint32_t* dst, uint64_t crtc_pins) {
-    /*
-        compute the source address from current CRTC ma (memory address)
-        and ra (raster address) like this:
-    
-        |ma12|ma11|ra2|ra1|ra0|ma9|ma8|...|ma2|ma1|ma0|0|
-    
-       Bits ma12 and m11 point to the 16 KByte page, and all
-       other bits are the index into that page.
-    */
-    const uint16_t ma = MC6845_GET_ADDR(crtc_pins);
-    const uint8_t ra = MC6845_GET_RA(crtc_pins);
-    const uint32_t page_index  = (ma>>12) & 3;
-    const uint32_t page_offset = ((ma & 0x03FF)<<1) | ((ra & 7)<<11);
-    const uint8_t* src = &(cpc.ram[page_index][page_offset]);
-    uint8_t c;
-    uint32_t p;
-    if (0 == cpc.ga_video_mode) {
-        /* 160x200 @ 16 colors
-           pixel    bit mask
-           0:       |3|7|
-           1:       |2|6|
-           2:       |1|5|
-           3:       |0|4|
-        */
-        for (int i = 0; i < 2; i++) {
-            c = *src++;
-            p = cpc.ga_palette[((c>>7)&0x1)|((c>>2)&0x2)|((c>>3)&0x4)|((c<<2)&0x8)];
-            *dst++ = p; *dst++ = p; *dst++ = p; *dst++ = p;
-            p = cpc.ga_palette[((c>>6)&0x1)|((c>>1)&0x2)|((c>>2)&0x4)|((c<<3)&0x8)];
-            *dst++ = p; *dst++ = p; *dst++ = p; *dst++ = p;
-        }
-    }
-    else if (1 == cpc.ga_video_mode) {
-        /* 320x200 @ 4 colors
-           pixel    bit mask
-           0:       |3|7|
-           1:       |2|6|
-           2:       |1|5|
-           3:       |0|4|
-        */
-        for (int i = 0; i < 2; i++) {
-            c = *src++;
-            p = cpc.ga_palette[((c>>2)&2)|((c>>7)&1)];
-            *dst++ = p; *dst++ = p;
-            p = cpc.ga_palette[((c>>1)&2)|((c>>6)&1)];
-            *dst++ = p; *dst++ = p;
-            p = cpc.ga_palette[((c>>0)&2)|((c>>5)&1)];
-            *dst++ = p; *dst++ = p;
-            p = cpc.ga_palette[((c<<1)&2)|((c>>4)&1)];
-            *dst++ = p; *dst++ = p;
-        }
-    }
-    else if (2 == cpc.ga_video_mode) {
-        /* 640x200 @ 2 colors */
-        for (int i = 0; i < 2; i++) {
-            c = *src++;
-            for (int j = 7; j >= 0; j--) {
-                *dst++ = cpc.ga_palette[(c>>j)&1];
-            }
-        }
-    }
-}
-
-void cpc_ga_decode_video(uint64_t crtc_pins) {
-    if (cpc.crt.visible) {
-        int dst_x = cpc.crt.pos_x * 16;
-        int dst_y = cpc.crt.pos_y;
-        uint32_t* dst = &(rgba8_buffer[dst_x + dst_y * CPC_DISP_WIDTH]);
-        if (crtc_pins & MC6845_DE) {
-            /* decode visible pixels */
-            cpc_ga_decode_pixels(dst, crtc_pins);
-        }
-        else if (crtc_pins & (MC6845_HS|MC6845_VS)) {
-            /* during horizontal/vertical sync: blacker than black */
-            for (int i = 0; i < 16; i++) {
-                dst[i] = 0xFF000000;
-            }
-        }
-        else {
-            /* border color */
-            for (int i = 0; i < 16; i++) {
-                dst[i] = cpc.ga_border_color;
-            }
-        }
+    inputq_close(&inputq);
+    rewind_discard(&history);
+    free(snapshot);
+    audio_shutdown();
+    gfx_shutdown();
+    romfile_unmap(&rom_os);
+    romfile_unmap(&rom_basic);
+    romfile_unmap(&rom_amsdos);
+    if (prof) {
+        pcprof_report(prof, &prof_labels, stdout, 32);
+        pcprof_free_labels(&prof_labels);
+        free(prof);
+    }
+    free(trace_buffer);
+    free(debugger);
+    if (heatmap) {
+        save_heatmap();
+        free(heatmap);
     }
 }
@@ -6,6 +6,25 @@
 //  found in the SHARP MZ-800 computer. It is used mainly as CRT controller.
 //  The GDG acts as memory controller, too. We don't emulate that here.
 //
+//  The video output is decoded one scanline at a time from the planar
+//  VRAM into packed RGBA8 pixels. The planes are combined with a lookup
+//  table which spreads the 8 pixel bits of a plane byte into 8 nibbles,
+//  so a plane byte is combined in one step instead of bit by bit. VRAM
+//  writes mark their scanline as dirty, and only dirty lines are decoded
+//  (a change of the display mode or palette marks all lines as dirty).
+//
+//  The CPU side of the planar VRAM access (the write and read format
+//  registers) isn't emulated, the CPU sees the 16 KB VRAM linearly:
+//
+//  - 320x200 (4 colors): plane I at 0x0000, plane II at 0x2000,
+//    40 bytes per line in each plane
+//  - 640x200 (2 colors): plane I at 0x0000, 80 bytes per line
+//
+//  The leftmost pixel is bit 0 of a plane byte. The 16-color and 640x200
+//  4-color modes need the VRAM extension (planes III and IV), they are
+//  decoded with those planes empty. The MZ-700 compatibility mode isn't
+//  emulated (the display is black).
+//
 //  Created by Gunter Hager on 03.07.18.
 //
 
@@ -16,6 +35,18 @@
 extern "C" {
 #endif
 
+/* size of the decoded display area */
+#define GDG_DISPLAY_WIDTH (640)
+#define GDG_DISPLAY_HEIGHT (200)
+/* size of the VRAM (without the VRAM extension) */
+#define GDG_VRAM_SIZE (0x4000)
+
+/* display mode register bits */
+#define GDG_DMD_FRAME_B  (1<<0)     /* display frame B (VRAM extension) */
+#define GDG_DMD_16COLORS (1<<1)     /* 16 colors in 320 mode, 4 colors in 640 mode (VRAM extension) */
+#define GDG_DMD_640      (1<<2)     /* 640x200 instead of 320x200 */
+#define GDG_DMD_MZ700    (1<<3)     /* MZ-700 compatibility mode */
+
     /// GDG WHID 65040-032 state
     typedef struct {
         /// Write format register
@@ -44,6 +75,18 @@ extern "C" {
         
         /// Superimpose bit
         uint8_t cksw;
+        
+        /// Palette registers (color codes of the 4 pens)
+        uint8_t plt[4];
+        /// Palette switch register (pen group of the 16-color mode)
+        uint8_t plt_sw;
+        
+        /// RGBA8 colors of the combined plane values, updated from dmd and plt
+        uint32_t pens[16];
+        /// Lines which have to be decoded again
+        uint8_t dirty[GDG_DISPLAY_HEIGHT];
+        /// Plane byte to nibble-per-pixel lookup table
+        uint32_t spread[256];
     } gdg_whid65040_032_t;
     
     /*
@@ -83,6 +126,14 @@ extern "C" {
     extern void gdg_whid65040_032_reset(gdg_whid65040_032_t* gdg);
     /* perform an IORQ machine cycle */
     extern uint64_t gdg_whid65040_032_iorq(gdg_whid65040_032_t* gdg, uint64_t pins);
+    /* mark the scanline of a CPU write into the VRAM (offset 0..0x3FFF) as dirty */
+    extern void gdg_whid65040_032_vram_write(gdg_whid65040_032_t* gdg, uint16_t offset);
+    /* mark all scanlines as dirty */
+    extern void gdg_whid65040_032_invalidate(gdg_whid65040_032_t* gdg);
+    /* decode scanline y (0..199) into dst (640 pixels) if it is dirty, returns true if decoded */
+    extern bool gdg_whid65040_032_decode_line(gdg_whid65040_032_t* gdg, int y, const uint8_t* vram, uint32_t* dst);
+    /* RGBA8 colors of the 16 MZ-800 color codes */
+    extern const uint32_t gdg_whid65040_032_colors[16];
 
 /*-- IMPLEMENTATION ----------------------------------------------------------*/
 #ifdef CHIPS_IMPL
@@ -108,6 +159,28 @@ extern "C" {
         gdg_whid65040_032_reset(gdg);
     }
     
+    /* the 16 fixed colors: 8 colors in 2 intensities, bit 0 blue, bit 1 red, bit 2 green, bit 3 intensity */
+    const uint32_t gdg_whid65040_032_colors[16] = {
+        0xFF000000, 0xFFC00000, 0xFF0000C0, 0xFFC000C0, 0xFF00C000, 0xFFC0C000, 0xFF00C0C0, 0xFFC0C0C0,
+        0xFF555555, 0xFFFF0000, 0xFF0000FF, 0xFFFF00FF, 0xFF00FF00, 0xFFFFFF00, 0xFF00FFFF, 0xFFFFFFFF,
+    };
+    
+    /* update the RGBA8 colors of the combined plane values, and redraw everything */
+    static void _gdg_update_pens(gdg_whid65040_032_t* gdg) {
+        for (int v = 0; v < 16; v++) {
+            uint8_t code;
+            if (gdg->dmd & GDG_DMD_16COLORS) {
+                // 16 colors: the pen group selected by the palette switch goes through the palette
+                code = ((v >> 2) == (gdg->plt_sw & 3)) ? gdg->plt[v & 3] : (uint8_t)v;
+            }
+            else {
+                code = gdg->plt[v & 3];
+            }
+            gdg->pens[v] = gdg_whid65040_032_colors[code & 0xF];
+        }
+        gdg_whid65040_032_invalidate(gdg);
+    }
+    
     /**
      gdg_whid65040_032_reset
      
@@ -116,6 +189,17 @@ extern "C" {
     void gdg_whid65040_032_reset(gdg_whid65040_032_t* gdg) {
         CHIPS_ASSERT(gdg);
         memset(gdg, 0, sizeof(*gdg));
+        // bit n of a plane byte goes into bit 4*n
+        for (int i = 0; i < 256; i++) {
+            uint32_t v = 0;
+            for (int b = 0; b < 8; b++) {
+                if (i & (1<<b)) {
+                    v |= 1U << (4*b);
+                }
+            }
+            gdg->spread[i] = v;
+        }
+        _gdg_update_pens(gdg);
     }
 
     /**
@@ -138,6 +222,24 @@ extern "C" {
                 gdg->bcol = Z80_GET_DATA(pins);
             }
             
+            // Display mode register
+            else if (((address & 0xff) == 0xce) && (pins & GDG_WR)) {
+                gdg->dmd = Z80_GET_DATA(pins) & 0x0f;
+                _gdg_update_pens(gdg);
+            }
+            
+            // Palette register: a palette entry, or the palette switch if bit 6 is set
+            else if (((address & 0xff) == 0xf0) && (pins & GDG_WR)) {
+                const uint8_t data = Z80_GET_DATA(pins);
+                if (data & 0x40) {
+                    gdg->plt_sw = data & 3;
+                }
+                else {
+                    gdg->plt[(data >> 4) & 3] = data & 0x0f;
+                }
+                _gdg_update_pens(gdg);
+            }
+            
             // DEBUG
             else {
                 CHIPS_ASSERT(1);
@@ -147,6 +249,76 @@ extern "C" {
         
         return outpins;
     }
+    
+    /**
+     gdg_whid65040_032_vram_write
+     
+     Mark the scanline which displays the written VRAM offset as dirty.
+     */
+    void gdg_whid65040_032_vram_write(gdg_whid65040_032_t* gdg, uint16_t offset) {
+        int y;
+        if (gdg->dmd & GDG_DMD_640) {
+            y = (offset & (GDG_VRAM_SIZE-1)) / 80;
+        }
+        else {
+            y = (offset & 0x1fff) / 40;
+        }
+        if (y < GDG_DISPLAY_HEIGHT) {
+            gdg->dirty[y] = 1;
+        }
+    }
+    
+    /**
+     gdg_whid65040_032_invalidate
+     
+     Mark all scanlines as dirty, so that the whole display is decoded again.
+     */
+    void gdg_whid65040_032_invalidate(gdg_whid65040_032_t* gdg) {
+        memset(gdg->dirty, 1, sizeof(gdg->dirty));
+    }
+    
+    /**
+     gdg_whid65040_032_decode_line
+     
+     Decode a dirty scanline from the planar VRAM into 640 RGBA8 pixels.
+     */
+    bool gdg_whid65040_032_decode_line(gdg_whid65040_032_t* gdg, int y, const uint8_t* vram, uint32_t* dst) {
+        CHIPS_ASSERT((y >= 0) && (y < GDG_DISPLAY_HEIGHT));
+        if (!gdg->dirty[y]) {
+            return false;
+        }
+        gdg->dirty[y] = 0;
+        const uint32_t* pens = gdg->pens;
+        const uint32_t* spread = gdg->spread;
+        if (gdg->dmd & GDG_DMD_MZ700) {
+            for (int x = 0; x < GDG_DISPLAY_WIDTH; x++) {
+                dst[x] = 0xFF000000;
+            }
+        }
+        else if (gdg->dmd & GDG_DMD_640) {
+            // one plane, 8 pixels per byte
+            const uint8_t* p1 = vram + y * 80;
+            for (int x = 0; x < 80; x++, dst += 8) {
+                const uint32_t c = spread[p1[x]];
+                dst[0] = pens[c & 0xf];         dst[1] = pens[(c >> 4) & 0xf];
+                dst[2] = pens[(c >> 8) & 0xf];  dst[3] = pens[(c >> 12) & 0xf];
+                dst[4] = pens[(c >> 16) & 0xf]; dst[5] = pens[(c >> 20) & 0xf];
+                dst[6] = pens[(c >> 24) & 0xf]; dst[7] = pens[c >> 28];
+            }
+        }
+        else {
+            // two planes combined into 2-bit pixels, each pixel is 2 display pixels wide
+            const uint8_t* p1 = vram + y * 40;
+            const uint8_t* p2 = p1 + 0x2000;
+            for (int x = 0; x < 40; x++, dst += 16) {
+                const uint32_t c = spread[p1[x]] | (spread[p2[x]] << 1);
+                for (int i = 0; i < 8; i++) {
+                    dst[2*i] = dst[2*i + 1] = pens[(c >> (4*i)) & 0xf];
+                }
+            }
+        }
+        return true;
+    }
 
 #endif /* CHIPS_IMPL */
     
@@ -0,0 +1,205 @@
+//------------------------------------------------------------------------------
+//  mem-bench.c
+//
+//  Throughput benchmark for the chips mem_t page-table. Sets up the memory
+//  layouts of the C64 (RAM under BASIC/CHAR/KERNAL ROM), the CPC 6128
+//  (ram[8][0x4000] with the lower/upper ROM overlays) and the ZX Spectrum 128
+//  (ROM at 0x0000, RAM bank 5/2 and a pageable bank at 0xC000), and reports:
+//
+//  - random byte reads and writes per second through mem_rd()/mem_wr()
+//  - bulk copy throughput of the per-byte path versus the direct
+//    page-pointer helpers in common/mempage.h
+//  - bank switches per second for the system's paging scheme
+//
+//  The page-pointer copies are checked against the per-byte results.
+//
+//  Usage:
+//
+//      mem-bench [rounds]
+//------------------------------------------------------------------------------
+#define CHIPS_IMPL
+#include "chips/mem.h"
+#include "common/mempage.h"
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_ADDRS (1<<16)
+
+static uint8_t rom[4][0x4000];
+static uint8_t ram[8][0x4000];
+static uint8_t ram_ref[8][0x4000];
+static uint16_t addrs[NUM_ADDRS];
+static uint8_t copy_buf[2][1<<16];
+static volatile uint32_t sink;
+
+/* C64: rom[0] = BASIC+KERNAL, rom[1] = CHAR ROM, ram[0..3] = 64 KB RAM */
+static void c64_map(mem_t* mem, int cfg) {
+    uint8_t* r = &ram[0][0];
+    mem_unmap_layer(mem, 0);
+    mem_map_ram(mem, 0, 0x0000, 0xA000, r);
+    mem_map_ram(mem, 0, 0xC000, 0x1000, r + 0xC000);
+    if (cfg & 1) {
+        mem_map_rw(mem, 0, 0xA000, 0x2000, rom[0], r + 0xA000);
+        mem_map_rw(mem, 0, 0xE000, 0x2000, rom[0] + 0x2000, r + 0xE000);
+    }
+    else {
+        mem_map_ram(mem, 0, 0xA000, 0x2000, r + 0xA000);
+        mem_map_ram(mem, 0, 0xE000, 0x2000, r + 0xE000);
+    }
+    if (cfg & 2) {
+        mem_map_rw(mem, 0, 0xD000, 0x1000, rom[1], r + 0xD000);
+    }
+    else {
+        mem_map_ram(mem, 0, 0xD000, 0x1000, r + 0xD000);
+    }
+}
+
+/* CPC 6128: the 8 RAM configurations, plus lower/upper ROM on layer 0 */
+static void cpc_map(mem_t* mem, int cfg) {
+    static const int ram_config[8][4] = {
+        { 0, 1, 2, 3 }, { 0, 1, 2, 7 }, { 4, 5, 6, 7 }, { 0, 3, 2, 7 },
+        { 0, 4, 2, 3 }, { 0, 5, 2, 3 }, { 0, 6, 2, 3 }, { 0, 7, 2, 3 },
+    };
+    const int* c = ram_config[cfg & 7];
+    mem_unmap_layer(mem, 0);
+    mem_map_rw(mem, 0, 0x0000, 0x4000, rom[0], ram[c[0]]);
+    mem_map_ram(mem, 0, 0x4000, 0x4000, ram[c[1]]);
+    mem_map_ram(mem, 0, 0x8000, 0x4000, ram[c[2]]);
+    mem_map_rw(mem, 0, 0xC000, 0x4000, rom[1], ram[c[3]]);
+}
+
+/* ZX 128: ROM 0/1 at 0x0000, RAM 5 at 0x4000, RAM 2 at 0x8000, RAM 0..7 at 0xC000 */
+static void zx_map(mem_t* mem, int cfg) {
+    mem_map_rom(mem, 0, 0x0000, 0x4000, rom[(cfg >> 3) & 1]);
+    mem_map_ram(mem, 0, 0x4000, 0x4000, ram[5]);
+    mem_map_ram(mem, 0, 0x8000, 0x4000, ram[2]);
+    mem_map_ram(mem, 0, 0xC000, 0x4000, ram[cfg & 7]);
+}
+
+typedef struct {
+    const char* name;
+    void (*map)(mem_t* mem, int cfg);
+    int num_configs;
+} layout_t;
+
+static const layout_t layouts[] = {
+    { "c64", c64_map, 4 },
+    { "cpc6128", cpc_map, 8 },
+    { "zx128k", zx_map, 16 },
+};
+#define NUM_LAYOUTS (sizeof(layouts)/sizeof(layout_t))
+
+static double mps(double count, uint64_t ticks) {
+    double sec = stm_sec(ticks);
+    return (sec > 0.0) ? (count / sec) / 1000000.0 : 0.0;
+}
+
+static bool bench_layout(const layout_t* l, int rounds) {
+    mem_t mem;
+    mem_init(&mem);
+    l->map(&mem, l->num_configs - 1);
+    const double num_bytes = (double)rounds * (double)NUM_ADDRS;
+
+    /* random reads and writes through the page table */
+    uint64_t start = stm_now();
+    uint32_t acc = 0;
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < NUM_ADDRS; i++) {
+            acc += mem_rd(&mem, addrs[i]);
+        }
+    }
+    const double rd_mps = mps(num_bytes, stm_since(start));
+    sink = acc;
+    start = stm_now();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < NUM_ADDRS; i++) {
+            mem_wr(&mem, addrs[i], (uint8_t)(i ^ r));
+        }
+    }
+    const double wr_mps = mps(num_bytes, stm_since(start));
+
+    /* bulk copy out of the address space: per-byte versus page pointers */
+    start = stm_now();
+    for (int r = 0; r < rounds; r++) {
+        for (uint32_t i = 0; i < (1<<16); i++) {
+            copy_buf[0][i] = mem_rd(&mem, (uint16_t)(i + r));
+        }
+    }
+    const double copy_rd_byte = mps(num_bytes, stm_since(start));
+    start = stm_now();
+    for (int r = 0; r < rounds; r++) {
+        mem_copy_from(&mem, (uint16_t)r, copy_buf[1], 1<<16);
+    }
+    const double copy_rd_page = mps(num_bytes, stm_since(start));
+    if (0 != memcmp(copy_buf[0], copy_buf[1], sizeof(copy_buf[0]))) {
+        fprintf(stderr, "%s: mem_copy_from() result differs from mem_rd()!\n", l->name);
+        return false;
+    }
+
+    /* bulk copy into the address space: mem_write_range versus page pointers */
+    start = stm_now();
+    for (int r = 0; r < rounds; r++) {
+        mem_write_range(&mem, (uint16_t)r, copy_buf[0], 1<<16);
+    }
+    const double copy_wr_byte = mps(num_bytes, stm_since(start));
+    memcpy(ram_ref, ram, sizeof(ram));
+    start = stm_now();
+    for (int r = 0; r < rounds; r++) {
+        mem_copy_to(&mem, (uint16_t)r, copy_buf[0], 1<<16);
+    }
+    const double copy_wr_page = mps(num_bytes, stm_since(start));
+    if (0 != memcmp(ram_ref, ram, sizeof(ram))) {
+        fprintf(stderr, "%s: mem_copy_to() result differs from mem_write_range()!\n", l->name);
+        return false;
+    }
+
+    /* bank switching */
+    const int num_switches = rounds * 1024;
+    start = stm_now();
+    for (int i = 0; i < num_switches; i++) {
+        l->map(&mem, i % l->num_configs);
+    }
+    const double switch_mps = mps(num_switches, stm_since(start));
+
+    printf("%s:\n", l->name);
+    printf("  mem_rd:          %8.1f M/s\n", rd_mps);
+    printf("  mem_wr:          %8.1f M/s\n", wr_mps);
+    printf("  copy out:        %8.1f MB/s per byte, %8.1f MB/s per page (%.1fx)\n",
+        copy_rd_byte, copy_rd_page, (copy_rd_byte > 0.0) ? copy_rd_page / copy_rd_byte : 0.0);
+    printf("  copy in:         %8.1f MB/s per byte, %8.1f MB/s per page (%.1fx)\n",
+        copy_wr_byte, copy_wr_page, (copy_wr_byte > 0.0) ? copy_wr_page / copy_wr_byte : 0.0);
+    printf("  bank switches:   %8.2f M/s\n", switch_mps);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    int rounds = 256;
+    if (argc > 1) {
+        rounds = atoi(argv[1]);
+        if (rounds <= 0) {
+            fprintf(stderr, "usage: %s [rounds]\n", argv[0]);
+            return 10;
+        }
+    }
+    stm_setup();
+    /* distinguishable ROM content, and a reproducible random address stream */
+    memset(rom[0], 0xAA, sizeof(rom[0]));
+    memset(rom[1], 0xBB, sizeof(rom[1]));
+    uint32_t x = 0x12345678;
+    for (int i = 0; i < NUM_ADDRS; i++) {
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        addrs[i] = (uint16_t) x;
+    }
+    printf("mem-bench: %d rounds of 64 KB per measurement\n", rounds);
+    for (size_t i = 0; i < NUM_LAYOUTS; i++) {
+        memset(ram, 0, sizeof(ram));
+        if (!bench_layout(&layouts[i], rounds)) {
+            return 10;
+        }
+    }
+    return 0;
+}
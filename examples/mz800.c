@@ -3,122 +3,22 @@
 //
 // Emulator for the SHARP MZ-800
 //
+// The actual emulator is in systems/mz800.h, this is just the
+// sokol-app shell around it.
 //------------------------------------------------------------------------------
 
 #include "sokol_app.h"
 #include "sokol_time.h"
 #define CHIPS_IMPL
-#include "chips/z80.h"
-#include "chips/z80pio.h"
-#include "chips/z80ctc.h"
-#include "chips/crt.h"
-#include "chips/kbd.h"
-#include "chips/mem.h"
-#include "gdg_whid65040_032.h"
-#include "roms/mz800-roms.h"
+#include "systems/mz800.h"
 #include "common/gfx.h"
+#include "common/warp.h"
 #include <ctype.h> /* isupper, islower, toupper, tolower */
 
-/* MZ-800 emulator state and callbacks */
-#define MZ800_FREQ (3546895) // 3.546895 MHz
-#define MZ800_DISP_WIDTH (640)
-#define MZ800_DISP_HEIGHT (200)
-
-typedef struct {
-    
-    // CPU Z80A
-    z80_t cpu;
-    uint32_t tick_count;
-    
-    // PPI i8255, keyboard and cassette driver
-    // CTC i8253, programmable counter/timer
-    // PIO Z80 PIO, parallel I/O unit
-    // PSG SN 76489 AN, sound generator
-    
-    // GDG WHID 65040-032, CRT controller
-    gdg_whid65040_032_t gdg;
-    
-    // CRT
-    crt_t crt;
-    
-    // Keyboard
-    kbd_t kbd;
-    
-    // Memory
-    mem_t mem;
-    
-    // ROM
-    uint8_t rom1[0x1000];  // 0x0000-0x0fff
-    uint8_t cgrom[0x1000]; // 0x1000-0x1fff
-    uint8_t rom2[0x2000];  // 0xe000-0xffff
-    // VRAM
-    uint8_t vram[0x4000];  // 0x8000-0xbfff
-    // RAM
-    uint8_t dram0[0x1000]; // 0x0000-0x0fff
-    uint8_t dram1[0x1000]; // 0x1000-0x1fff
-    uint8_t dram2[0x6000]; // 0x2000-0x7fff
-    uint8_t dram3[0x4000]; // 0x8000-0xbfff
-    uint8_t dram4[0x2000]; // 0xc000-0xdfff
-    uint8_t dram5[0x2000]; // 0xe000-0xffff
-
-
-
-} mz800_t;
 mz800_t mz800;
-
-#define I(a) ((a) | Z80_RD | Z80_IORQ)
-#define O(a) ((a) | Z80_WR | Z80_IORQ)
-
-// Memory layout
-// Memory in the ranges 0x2000-0x7fff, 0xc000-0xdfff are always DRAM
-// The memory bank values below can be used directly as bit mask for Z80 pins.
-// | I/O        | 0x0000 | 0x1000 | 0x8000 | 0xe000 |
-// | Address    | 0x0fff | 0x1fff | 0xbfff | 0xffff |
-const uint32_t mz800_mem_banks[9] = {
-    I(0xe0), // | x      | CGROM  | VRAM   | x      |
-    I(0xe1), // | x      | DRAM   | DRAM   | x      |
-    O(0xe0), // | DRAM   | DRAM   | x      | x      |
-    O(0xe1), // | x      | x      | x      | DRAM   |
-    O(0xe2), // | ROM    | x      | x      | x      |
-    O(0xe3), // | x      | x      | x      | ROM    |
-    O(0xe4), // | ROM    | CGROM  | VRAM   | ROM    |
-    O(0xe5), // | x      | x      | x      | PROHIB | // Prohibited
-    O(0xe6)  // | x      | x      | x      | RETURN | // Return to previous state
-};
-
-/// Colors - the MZ-800 has 16 fixed colors.
-const uint32_t mz800_colors[16] = {
-    // Intensity low
-    0x000000, // black
-    0x000030, // blue
-    0x003000, // red
-    0x003030, // purple
-    0x300000, // green
-    0x300030, // cyan
-    0x303000, // yellow
-    0x303030, // white
-    // Intensity high
-    0x151515, // gray
-    0x00003f, // light blue
-    0x003f00, // light red
-    0x003f3f, // light purple
-    0x3f0000, // light green
-    0x3f003f, // light cyan
-    0x3f3f00, // light yellow
-    0x3f3f3f  // light white
-};
-
-
 uint32_t overrun_ticks;
 uint64_t last_time_stamp;
-
-// MARK: - Function declarations
-
-void mz800_init(void);
-void mz800_init_memory_mapping(void);
-void mz800_update_memory_mapping(uint64_t pins);
-uint64_t mz800_cpu_tick(int num_ticks, uint64_t pins);
-uint64_t mz800_cpu_iorq(uint64_t pins);
+warp_t warp;
 
 /* sokol-app entry, configure application callbacks and window */
 void app_init(void);
@@ -147,10 +47,19 @@ sapp_desc sokol_main(int argc, char* argv[]) {
 /* one-time application init */
 void app_init() {
     gfx_init(MZ800_DISP_WIDTH, MZ800_DISP_HEIGHT);
-    mz800_init();
+    mz800_init(&mz800, &(mz800_desc_t){
+        .rgba8_buffer = rgba8_buffer,
+        .rgba8_buffer_size = sizeof(rgba8_buffer)
+    });
     last_time_stamp = stm_now();
 }
 
+/* run one emulated frame in warp mode (the video chip always renders its output) */
+void warp_frame(bool decode) {
+    (void)decode;
+    mz800_exec(&mz800, MZ800_FREQ / 50);
+}
+
 /* per frame stuff, tick the emulator, handle input, decode and draw emulator display */
 void app_frame() {
     double frame_time = stm_sec(stm_laptime(&last_time_stamp));
@@ -158,8 +67,14 @@ void app_frame() {
     if (frame_time > 0.1) {
         frame_time = 0.1;
     }
+    if (warp.enabled) {
+        /* run as fast as possible, and only present the last frame */
+        warp_run(&warp, warp_frame, 1.0 / 50.0);
+        gfx_draw();
+        return;
+    }
     uint32_t ticks_to_run = (uint32_t) ((MZ800_FREQ * frame_time) - overrun_ticks);
-    uint32_t ticks_executed = z80_exec(&mz800.cpu, ticks_to_run);
+    uint32_t ticks_executed = mz800_exec(&mz800, ticks_to_run);
     assert(ticks_executed >= ticks_to_run);
     overrun_ticks = ticks_executed - ticks_to_run;
     // TODO: Keyboard update
@@ -169,147 +84,13 @@ void app_frame() {
 
 /* keyboard input handling */
 void app_input(const sapp_event* event) {
+    if ((event->type == SAPP_EVENTTYPE_KEY_DOWN) && (event->key_code == SAPP_KEYCODE_END)) {
+        /* toggle warp mode */
+        warp_enable(&warp, !warp.enabled);
+    }
 }
 
 /* application cleanup callback */
 void app_cleanup() {
     gfx_shutdown();
 }
-
-// MARK: - MZ-800 specific functions
-
-void mz800_init(void) {
-    mz800.tick_count = 0;
-    
-    mz800_init_memory_mapping();
-    z80_init(&mz800.cpu, mz800_cpu_tick);
-    
-    /* CPU start address */
-    mz800.cpu.state.PC = 0x2000;
-}
-
-/**
- Setup the initial memory mapping with ROM1 and ROM2, the rest is DRAM.
- */
-void mz800_init_memory_mapping(void) {
-    // TODO: check if the initial setting is correct.
-    mem_map_rom(&mz800.mem, 0, 0x0000, 0x1000, mz800.rom1);
-    mem_map_ram(&mz800.mem, 0, 0x1000, 0x1000, mz800.dram1);
-    mem_map_ram(&mz800.mem, 0, 0x2000, 0x6000, dump_mz800_dram2); // 'load' custom program
-    mem_map_ram(&mz800.mem, 0, 0x8000, 0x4000, mz800.dram3);
-    mem_map_ram(&mz800.mem, 0, 0xc000, 0x2000, mz800.dram4);
-    mem_map_rom(&mz800.mem, 0, 0xe000, 0x2000, mz800.rom2);
-}
-
-/**
- Updates the memory mapping for the bank switch IO requests.
-
- @param pins Z80 pins with IO request for bank switching.
- */
-void mz800_update_memory_mapping(uint64_t pins) {
-    uint64_t pins_to_check = pins & (Z80_RD | Z80_WR | Z80_IORQ | 0xff);
-    if (pins_to_check == mz800_mem_banks[0]) {
-        mem_map_rom(&mz800.mem, 0, 0x1000, 0x1000, mz800.cgrom);
-        mem_map_ram(&mz800.mem, 0, 0x8000, 0x4000, mz800.vram);
-    } else if (pins_to_check == mz800_mem_banks[1]) {
-        mem_map_ram(&mz800.mem, 0, 0x1000, 0x1000, mz800.dram1);
-        mem_map_ram(&mz800.mem, 0, 0x8000, 0x4000, mz800.dram3);
-    } else if (pins_to_check == mz800_mem_banks[2]) {
-        mem_map_ram(&mz800.mem, 0, 0x0000, 0x1000, mz800.dram0);
-        mem_map_ram(&mz800.mem, 0, 0x1000, 0x1000, mz800.dram1);
-    } else if (pins_to_check == mz800_mem_banks[3]) {
-        mem_map_ram(&mz800.mem, 0, 0xe000, 0x2000, mz800.dram5);
-    } else if (pins_to_check == mz800_mem_banks[4]) {
-        mem_map_rom(&mz800.mem, 0, 0x0000, 0x1000, mz800.rom1);
-    } else if (pins_to_check == mz800_mem_banks[5]) {
-        mem_map_rom(&mz800.mem, 0, 0xe000, 0x2000, mz800.rom2);
-    } else if (pins_to_check == mz800_mem_banks[6]) {
-        mem_map_rom(&mz800.mem, 0, 0x0000, 0x1000, mz800.rom1);
-        mem_map_rom(&mz800.mem, 0, 0x1000, 0x1000, mz800.cgrom);
-        mem_map_ram(&mz800.mem, 0, 0x8000, 0x4000, mz800.vram);
-        mem_map_rom(&mz800.mem, 0, 0xe000, 0x2000, mz800.rom2);
-    } else if (pins_to_check == mz800_mem_banks[7]) {
-        // PROHIBIT not implemented
-    } else if (pins_to_check == mz800_mem_banks[8]) {
-        // RETURN not implemented
-    }
-}
-
-uint64_t mz800_cpu_tick(int num_ticks, uint64_t pins) {
-    uint64_t out_pins = pins;
-    
-    // TODO: interrupt acknowledge
-    
-    // Memory request
-    if (pins & Z80_MREQ) {
-        const uint16_t addr = Z80_GET_ADDR(pins);
-        if (pins & Z80_RD) {
-            Z80_SET_DATA(out_pins, mem_rd(&mz800.mem, addr));
-        }
-        else if (pins & Z80_WR) {
-            mem_wr(&mz800.mem, addr, Z80_GET_DATA(pins));
-        }
-    }
-    
-    // IO request
-    if ((pins & Z80_IORQ) && (pins & (Z80_RD|Z80_WR))) {
-        out_pins = mz800_cpu_iorq(pins);
-    }
-
-    return out_pins;
-}
-
-#define IN_RANGE(A,B,C) (((A)>=(B))&&((A)<=(C)))
-
-uint64_t mz800_cpu_iorq(uint64_t pins) {
-    uint16_t address = Z80_GET_ADDR(pins) & 0xff; // check only the lower byte of the address
-    
-    // Serial I/O
-    if (IN_RANGE(address, 0xb0, 0xb3)) {
-        // TODO: not implemented
-    }
-    // GDG WHID 65040-032, CRT controller
-    else if (IN_RANGE(address, 0xcc, 0xcf)) {
-        gdg_whid65040_032_iorq(&mz800.gdg, pins);
-    }
-    // PPI i8255, keyboard and cassette driver
-    else if (IN_RANGE(address, 0xd0, 0xd3)) {
-        // TODO: not implemented
-    }
-    // CTC i8253, programmable counter/timer
-    else if (IN_RANGE(address, 0xd4, 0xd7)) {
-        // TODO: not implemented
-    }
-    // FDC, floppy disc controller
-    else if (IN_RANGE(address, 0xd8, 0xdf)) {
-        // TODO: not implemented
-    }
-    // GDG WHID 65040-032, Memory bank switch
-    else if (IN_RANGE(address, 0xe0, 0xe6)) {
-        // Currently this isn't supported by the GDG emulation,
-        // so we do the bank switch directly here.
-        mz800_update_memory_mapping(pins);
-    }
-    // Joystick
-    else if (IN_RANGE(address, 0xf0, 0xf1)) {
-        // TODO: not implemented
-    }
-    // PSG SN 76489 AN, sound generator
-    else if (address == 0xf2) {
-        // TODO: not implemented
-    }
-    // QDC, quick disk controller
-    else if (IN_RANGE(address, 0xf4, 0xf7)) {
-        // TODO: not implemented
-    }
-    // PIO Z80 PIO, parallel I/O unit
-    else if (IN_RANGE(address, 0xfc, 0xff)) {
-        // TODO: not implemented
-    }
-    // DEBUG
-    else {
-        CHIPS_ASSERT(1);
-    }
-    
-    return pins;
-}
@@ -1,1041 +1,531 @@
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include "atom-roms.h"
-unsigned char dump_abasic[8192] = {
-0x3c, 0x3d, 0x3e, 0xfe, 0x2d, 0x2b, 0xc8, 0x23, 0x28, 0x21, 0x3f, 0x52, 0x54, 0x4c, 0x43, 0x41, 
-0x50, 0x45, 0x47, 0x42, 0x46, 0xf0, 0x54, 0xff, 0x4f, 0xcb, 0x53, 0xcb, 0x54, 0x45, 0x50, 0xcb, 
-0x54, 0xc3, 0x48, 0x45, 0x4e, 0xc3, 0x22, 0x24, 0xce, 0xce, 0xcc, 0x24, 0x2c, 0xc5, 0x24, 0x26, 
-0x3b, 0xd, 0x2c, 0xc3, 0xc5, 0xc2, 0x3e, 0xc7, 0x3d, 0xc7, 0xc7, 0xc7, 0x3d, 0xc7, 0xc7, 0xc8, 
-0x52, 0xc7, 0xc7, 0x4f, 0x41, 0xfe, 0x24, 0xc7, 0x48, 0xc9, 0x45, 0x4e, 0xc9, 0x4e, 0x44, 0xc7, 
-0xc9, 0xc9, 0xc9, 0xc9, 0x4e, 0x44, 0xc9, 0x4f, 0x50, 0xc9, 0x4f, 0x55, 0x4e, 0x54, 0xc9, 0x42, 
-0x53, 0xc9, 0x54, 0x52, 0xcf, 0x58, 0x54, 0xcf, 0x45, 0x54, 0xcf, 0x47, 0x45, 0x54, 0xcf, 0x49, 
-0x4e, 0xcf, 0x4f, 0x55, 0x54, 0xcf, 0xc3, 0xc3, 0x52, 0x49, 0x4e, 0x54, 0xc3, 0x4e, 0x4c, 0x55, 
-0x4e, 0x49, 0x47, 0x52, 0x46, 0x21, 0x3f, 0x24, 0x50, 0x44, 0x4c, 0x53, 0x42, 0x2a, 0x45, 0xf0, 
-0x41, 0x56, 0x45, 0xcf, 0x45, 0x57, 0xc2, 0x4f, 0xcc, 0x45, 0x54, 0xc3, 0x49, 0x4e, 0x4b, 0xc3, 
-0x49, 0x53, 0x54, 0xca, 0x4f, 0x41, 0x44, 0xce, 0x4e, 0x54, 0x49, 0x4c, 0xcc, 0x45, 0x58, 0x54, 
-0xca, 0x46, 0xc5, 0x4e, 0x50, 0x55, 0x54, 0xcc, 0x4f, 0x53, 0x55, 0x42, 0xcb, 0x4f, 0x54, 0x4f, 
-0xcc, 0x45, 0x54, 0x55, 0x52, 0x4e, 0xcb, 0x45, 0x4d, 0xc5, 0x55, 0x4e, 0xf1, 0x4f, 0x52, 0xcb, 
-0x4e, 0x44, 0xcd, 0x47, 0x45, 0x54, 0xcf, 0x50, 0x55, 0x54, 0xcf, 0x48, 0x55, 0x54, 0xcf, 0x50, 
-0x55, 0x54, 0xcf, 0x54, 0x52, 0xcf, 0x55, 0x54, 0xcf, 0xc3, 0xc4, 0xcd, 0xc4, 0x2c, 0xfe, 0x36, 
-0x3b, 0x3c, 0xc0, 0x3f, 0x6, 0xdc, 0x50, 0x51, 0x52, 0x53, 0x54, 0x57, 0x4a, 0x5a, 0x5f, 0x62, 
-0x65, 0x68, 0x6b, 0x6f, 0x2e, 0x18, 0xac, 0x17, 0x81, 0x1c, 0xbe, 0x17, 0x17, 0x17, 0xa2, 0x22, 
-0x1b, 0x17, 0x17, 0x17, 0x1b, 0x29, 0x28, 0xb6, 0xbf, 0xb6, 0x2a, 0xb7, 0x58, 0x76, 0x77, 0x34, 
-0x34, 0x7c, 0x3f, 0x4a, 0x78, 0x38, 0x6d, 0x3a, 0x64, 0x74, 0x5b, 0x3e, 0x7b, 0x82, 0xc1, 0x45, 
-0x22, 0x31, 0x40, 0x4d, 0x4d, 0x42, 0x53, 0x15, 0xd2, 0x15, 0x15, 0xbd, 0x45, 0x45, 0x14, 0xa, 
-0x44, 0x5f, 0x4c, 0x15, 0x15, 0x86, 0x15, 0x15, 0x73, 0x48, 0x15, 0x15, 0x15, 0x7a, 0x15, 0x15, 
-0x2, 0x15, 0x15, 0x29, 0x15, 0x15, 0x28, 0x15, 0x15, 0x66, 0x15, 0x15, 0x15, 0x5b, 0x72, 0x15, 
-0xa6, 0x15, 0x15, 0x15, 0xa7, 0x90, 0x35, 0xe3, 0x8f, 0x8f, 0x8f, 0x34, 0x94, 0xa0, 0xa8, 0xad, 
-0xb1, 0xbd, 0xc1, 0xcd, 0xe9, 0xea, 0xeb, 0x78, 0x97, 0x99, 0xd3, 0xdf, 0xec, 0xd0, 0x4b, 0x8f, 
-0x8f, 0x8f, 0xa, 0x8f, 0xad, 0xad, 0x8f, 0xf0, 0x9c, 0x8f, 0x25, 0x8f, 0x8f, 0x8f, 0xb2, 0xa4, 
-0x9c, 0x8f, 0x51, 0x99, 0x8f, 0x8f, 0xed, 0x8f, 0x8f, 0x8f, 0x8f, 0xd2, 0x8f, 0x8f, 0x8f, 0xcd, 
-0xb3, 0x66, 0x8f, 0x8f, 0x8f, 0x8f, 0x81, 0x8f, 0x8f, 0x8f, 0x8f, 0xd2, 0x8f, 0xb8, 0x8f, 0x5, 
-0xca, 0xc7, 0x8f, 0x8f, 0x8f, 0xec, 0x8f, 0x8f, 0x75, 0x8f, 0x8f, 0x41, 0x8f, 0x8f, 0x57, 0x8f, 
-0x8f, 0x98, 0xd7, 0x8f, 0x8f, 0xe3, 0xdb, 0x8f, 0x8f, 0xc5, 0x90, 0x8f, 0x8f, 0xb6, 0x8f, 0x8f, 
-0x8f, 0x8f, 0xe6, 0x8f, 0x47, 0x8f, 0x8f, 0x95, 0xee, 0x6, 0x5c, 0xf, 0x35, 0x2d, 0x2b, 0x7c, 
-0x3a, 0xfe, 0x2a, 0x2f, 0x25, 0x21, 0x3f, 0x26, 0xfe, 0x29, 0xff, 0x3d, 0xff, 0x21, 0x3f, 0x24, 
-0xff, 0x3d, 0x21, 0x3f, 0xff, 0x27, 0x22, 0xfe, 0xb7, 0x9a, 0xd3, 0xef, 0xef, 0x13, 0x5e, 0x70, 
-0xb3, 0x9c, 0x7b, 0x7b, 0x78, 0x78, 0x78, 0x78, 0xee, 0x6, 0x5c, 0x5c, 0xe5, 0x75, 0x7b, 0x7b, 
-0x6f, 0x7a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc2, 0xc2, 
-0xc2, 0xc2, 0xc3, 0xc4, 0xcd, 0xcd, 0xc3, 0xcd, 0xcd, 0xcd, 0xc3, 0xc3, 0x20, 0x3e, 0xcf, 0x84, 
-0xf, 0xa2, 0xed, 0xa4, 0x3, 0x88, 0xc8, 0xb1, 0x5, 0xc9, 0x20, 0xf0, 0xf9, 0x84, 0x5e, 0x85, 
-0x52, 0xe8, 0xbd, 0xff, 0xbf, 0x30, 0x24, 0xc5, 0x52, 0xd0, 0xf6, 0xbd, 0xee, 0xc0, 0xaa, 0xe8, 
-0xc8, 0xbd, 0xff, 0xbf, 0x30, 0x15, 0xd1, 0x5, 0xf0, 0xf5, 0xb1, 0x5, 0xc9, 0x2e, 0xf0, 0x4, 
-0xa4, 0x5e, 0x10, 0xe7, 0xe8, 0xbd, 0xff, 0xbf, 0x10, 0xfa, 0xc8, 0xc9, 0xfe, 0xb0, 0x3b, 0x85, 
-0x53, 0xbd, 0xee, 0xc0, 0x90, 0x29, 0xa6, 0x4, 0x60, 0xa2, 0xe, 0xa4, 0x3, 0x88, 0xc8, 0xb1, 
-0x5, 0xc9, 0x20, 0xf0, 0xf9, 0xdd, 0xdd, 0xc1, 0xf0, 0xc, 0x85, 0x52, 0xe8, 0xbd, 0xdd, 0xc1, 
-0x30, 0x16, 0xc5, 0x52, 0xd0, 0xf6, 0xbd, 0x12, 0xc2, 0x85, 0x53, 0xbd, 0xf8, 0xc1, 0xc8, 0x85, 
-0x52, 0x84, 0x3, 0xa6, 0x4, 0x6c, 0x52, 0x0, 0xc9, 0xfe, 0xf0, 0xca, 0x0, 0x20, 0xe4, 0xc4, 
-0xd0, 0x4, 0xa9, 0x29, 0x85, 0x12, 0xa9, 0xd, 0xa4, 0x12, 0x84, 0xe, 0xa0, 0x0, 0x84, 0xd, 
-0x91, 0xd, 0xa9, 0xff, 0xc8, 0x91, 0xd, 0xc8, 0x84, 0xd, 0xa9, 0x8, 0x8d, 0x21, 0x3, 0xa9, 
-0x3e, 0xd8, 0x20, 0xf, 0xcd, 0xa2, 0x1, 0x86, 0x6, 0xca, 0x86, 0x5, 0x86, 0x1, 0x86, 0x2, 
-0xa9, 0xd8, 0x8d, 0x2, 0x2, 0xa9, 0xc9, 0x8d, 0x3, 0x2, 0xa9, 0xe7, 0x85, 0x10, 0xa9, 0xc9, 
-0x85, 0x11, 0xa2, 0xff, 0x9a, 0xa9, 0x0, 0x85, 0x4, 0x85, 0x3, 0x85, 0x15, 0x85, 0x13, 0x85, 
-0x14, 0xa2, 0x34, 0x9d, 0x8c, 0x3, 0xca, 0xd0, 0xfa, 0x20, 0x34, 0xc4, 0xb0, 0x21, 0x20, 0x6a, 
-0xc4, 0x90, 0x3, 0x4c, 0xc9, 0xcd, 0xa2, 0x7d, 0x4c, 0x33, 0xc2, 0x20, 0x34, 0xc4, 0xb0, 0xf, 
-0xa2, 0x7f, 0x4c, 0x33, 0xc2, 0x20, 0x34, 0xc4, 0xb0, 0x5, 0xa2, 0x10, 0x4c, 0x7b, 0xc2, 0xa2, 
-0x14, 0x4c, 0x7b, 0xc2, 0x38, 0x66, 0xf, 0x20, 0x72, 0xc3, 0xa2, 0x2e, 0x4c, 0x33, 0xc2, 0x20, 
-0x8b, 0xc7, 0x20, 0xcb, 0xc3, 0xa5, 0xf, 0x30, 0x21, 0xa2, 0x0, 0x86, 0x27, 0xa0, 0x0, 0xb9, 
-0x52, 0x0, 0x48, 0x29, 0xf, 0x95, 0x45, 0x68, 0x4a, 0x4a, 0x4a, 0x4a, 0xe8, 0x95, 0x45, 0xe8, 
-0xc8, 0xc0, 0x4, 0x90, 0xea, 0x20, 0xc8, 0xc5, 0x30, 0xcd, 0x20, 0x89, 0xc5, 0x30, 0xc8, 0x20, 
-0x54, 0xcd, 0xa2, 0x18, 0x4c, 0x7b, 0xc2, 0x20, 0x4c, 0xca, 0xb1, 0x5, 0xc8, 0xc9, 0xd, 0xf0, 
-0x1c, 0x84, 0x3, 0xc9, 0x22, 0xd0, 0xf0, 0xb1, 0x5, 0xc9, 0x22, 0xd0, 0xe5, 0xc8, 0xb0, 0xe7, 
-0x20, 0x8b, 0xc7, 0x20, 0xcb, 0xc3, 0x5, 0x54, 0x5, 0x53, 0xf0, 0xe, 0xa0, 0x0, 0xb1, 0x52, 
-0xc9, 0xd, 0xf0, 0x93, 0x20, 0x4c, 0xca, 0xc8, 0xd0, 0xf4, 0xa5, 0x52, 0x20, 0x4c, 0xca, 0x4c, 
-0x37, 0xc3, 0x20, 0xc8, 0xc3, 0x20, 0xe4, 0xc4, 0xad, 0x22, 0x3, 0xae, 0x39, 0x3, 0xac, 0x3a, 
-0x3, 0x20, 0xa5, 0xc2, 0xd8, 0x4c, 0x5b, 0xc5, 0x20, 0xbc, 0xc8, 0xa0, 0x52, 0xca, 0x86, 0x4, 
-0xb5, 0x16, 0x99, 0x0, 0x0, 0xb5, 0x25, 0x99, 0x1, 0x0, 0xb5, 0x34, 0x99, 0x2, 0x0, 0xb5, 
-0x43, 0x99, 0x3, 0x0, 0x60, 0x20, 0xe1, 0xc4, 0x20, 0x2f, 0xca, 0x4c, 0x5b, 0xc5, 0x20, 0xbc, 
-0xc8, 0x20, 0x93, 0xce, 0xb5, 0x26, 0xc8, 0x91, 0x52, 0xc8, 0xb5, 0x35, 0x91, 0x52, 0xc8, 0xb5, 
-0x44, 0x91, 0x52, 0x4c, 0x5b, 0xc5, 0x20, 0xbc, 0xc8, 0x20, 0x93, 0xce, 0x4c, 0x5b, 0xc5, 0xa2, 
-0x0, 0xb1, 0x5, 0x9d, 0x0, 0x1, 0x84, 0x3, 0xc8, 0xe8, 0xc9, 0xd, 0xd0, 0xf3, 0x20, 0xf7, 
-0xff, 0x4c, 0x58, 0xc5, 0xad, 0x0, 0xd0, 0xc9, 0xaa, 0xd0, 0x38, 0x4a, 0xcd, 0x1, 0xd0, 0xd0, 
-0x32, 0xa4, 0x5e, 0x60, 0xa4, 0x3, 0x10, 0x3, 0xc8, 0x84, 0x3, 0xb1, 0x5, 0xc9, 0x20, 0xf0, 
-0xf7, 0xc9, 0x5b, 0xb0, 0x1e, 0xe9, 0x3f, 0x90, 0x1b, 0xa6, 0x4, 0x95, 0x16, 0xc8, 0xb1, 0x5, 
-0xc9, 0x2e, 0xf0, 0xf, 0xc9, 0x5b, 0xb0, 0x4, 0xc9, 0x40, 0xb0, 0x7, 0xe8, 0x86, 0x4, 0x38, 
-0x84, 0x3, 0x60, 0x18, 0x60, 0x20, 0x34, 0xc4, 0xb0, 0xbb, 0xa2, 0x0, 0xa4, 0x3, 0x86, 0x52, 
-0x86, 0x53, 0x86, 0x54, 0x86, 0x55, 0x88, 0xc8, 0xb1, 0x5, 0x38, 0xe9, 0x30, 0x30, 0x54, 0xc9, 
-0xa, 0xb0, 0x50, 0xa6, 0x53, 0x48, 0xa5, 0x55, 0x48, 0xa5, 0x54, 0x48, 0xa5, 0x52, 0xa, 0x26, 
-0x53, 0x26, 0x54, 0x26, 0x55, 0x30, 0xd4, 0xa, 0x26, 0x53, 0x26, 0x54, 0x26, 0x55, 0x30, 0xcb, 
-0x65, 0x52, 0x85, 0x52, 0x8a, 0x65, 0x53, 0x85, 0x53, 0x68, 0x65, 0x54, 0x85, 0x54, 0x68, 0x65, 
-0x55, 0x6, 0x52, 0x26, 0x53, 0x26, 0x54, 0x2a, 0x30, 0xb1, 0x85, 0x55, 0x68, 0x65, 0x52, 0x85, 
-0x52, 0x90, 0xc, 0xe6, 0x53, 0xd0, 0x8, 0xe6, 0x54, 0xd0, 0x4, 0xe6, 0x55, 0x30, 0x9c, 0xa2, 
-0xff, 0xd0, 0xa4, 0x8a, 0xf0, 0x8d, 0x38, 0x84, 0x3, 0xa0, 0x52, 0x4c, 0x9f, 0xc9, 0x20, 0x79, 
-0xc2, 0x20, 0x8b, 0xc7, 0xa4, 0x3, 0x88, 0xc8, 0xb1, 0x5, 0xc9, 0x20, 0xf0, 0xf9, 0xc9, 0x3b, 
-0xf0, 0x4, 0xc9, 0xd, 0xd0, 0x66, 0x18, 0x98, 0x65, 0x5, 0x85, 0x5, 0x90, 0x2, 0xe6, 0x6, 
-0xa0, 0x1, 0x84, 0x3, 0xad, 0x1, 0xb0, 0x29, 0x20, 0xf0, 0x3c, 0x60, 0x20, 0xe4, 0xc4, 0x88, 
-0xb1, 0x5, 0xc9, 0x3b, 0xf0, 0xf5, 0xa5, 0x6, 0xc9, 0x1, 0xf0, 0x7a, 0xc8, 0xb1, 0x5, 0x30, 
-0x3b, 0x85, 0x2, 0xc8, 0xb1, 0x5, 0x85, 0x1, 0xc8, 0xb1, 0x5, 0x88, 0xc9, 0x61, 0x90, 0xc7, 
-0xe9, 0x61, 0xc9, 0x1b, 0xb0, 0xc0, 0xc8, 0xa, 0xaa, 0x20, 0xf6, 0xc4, 0xa5, 0x5, 0x9d, 0x8d, 
-0x3, 0xa5, 0x6, 0x9d, 0x8e, 0x3, 0x60, 0x4c, 0xcf, 0xc2, 0x88, 0x20, 0xf6, 0xc4, 0xd0, 0xb, 
-0x20, 0x24, 0xc4, 0x90, 0x3, 0x6c, 0x2, 0xd0, 0x20, 0xe4, 0xc4, 0xa0, 0x0, 0xb1, 0x5, 0xc9, 
-0x3b, 0xd0, 0x1a, 0x4c, 0x1b, 0xc3, 0x20, 0xc, 0xc7, 0xca, 0x86, 0x4, 0xb5, 0x16, 0xf0, 0x5, 
-0xa2, 0x20, 0x4c, 0x33, 0xc2, 0xa9, 0xd, 0x88, 0xc8, 0xd1, 0x5, 0xd0, 0xfb, 0xa5, 0x6, 0xc9, 
-0x1, 0xf0, 0xc4, 0x20, 0x1c, 0xc5, 0x4c, 0x1b, 0xc3, 0xa5, 0x43, 0x85, 0x27, 0x10, 0x4, 0xe8, 
-0x20, 0xc4, 0xc8, 0xa2, 0x9, 0xa9, 0x0, 0x95, 0x45, 0x38, 0xa5, 0x16, 0xfd, 0x8, 0xc6, 0x48, 
-0xa5, 0x25, 0xfd, 0x10, 0xc6, 0x48, 0xa5, 0x34, 0xfd, 0x1a, 0xc6, 0xa8, 0xa5, 0x43, 0xfd, 0x24, 
-0xc6, 0x90, 0xe, 0x85, 0x43, 0x84, 0x34, 0x68, 0x85, 0x25, 0x68, 0x85, 0x16, 0xf6, 0x45, 0xd0, 
-0xd8, 0x68, 0x68, 0xca, 0x10, 0xcf, 0xa2, 0xa, 0xca, 0xf0, 0x4, 0xb5, 0x45, 0xf0, 0xf9, 0x86, 
-0x52, 0x24, 0x27, 0x10, 0x2, 0xe6, 0x52, 0x38, 0xad, 0x21, 0x3, 0xf0, 0x2, 0xe9, 0x1, 0xe5, 
-0x52, 0xf0, 0xb, 0x90, 0x9, 0xa8, 0xa9, 0x20, 0x20, 0x4c, 0xca, 0x88, 0xd0, 0xf8, 0x24, 0x27, 
-0x10, 0x5, 0xa9, 0x2d, 0x20, 0x4c, 0xca, 0xb5, 0x45, 0xc9, 0xa, 0x90, 0x2, 0x69, 0x6, 0x69, 
-0x30, 0x20, 0x4c, 0xca, 0xca, 0x10, 0xf0, 0x60, 0x1, 0xa, 0x64, 0xe8, 0x10, 0xa0, 0x40, 0x80, 
-0x0, 0x0, 0x0, 0x3, 0x27, 0x86, 0x42, 0x96, 0xe1, 0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 
-0xf, 0x98, 0xf5, 0x9a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x3b, 0xc6, 0x4, 
-0xa6, 0x4, 0xa0, 0x0, 0x84, 0x58, 0xa5, 0x12, 0x85, 0x59, 0x88, 0xa9, 0xd, 0xc8, 0xd1, 0x58, 
-0xd0, 0xfb, 0x20, 0xa1, 0xce, 0xb1, 0x58, 0xc8, 0xd5, 0x25, 0x90, 0xef, 0xd0, 0x12, 0xb1, 0x58, 
-0xd5, 0x16, 0x90, 0xe7, 0xd0, 0xa, 0x85, 0x1, 0xb5, 0x25, 0x85, 0x2, 0x20, 0xa1, 0xce, 0x18, 
-0x60, 0x20, 0xbc, 0xc8, 0xb5, 0x42, 0x55, 0x41, 0x85, 0x52, 0x20, 0x5, 0xc9, 0xa0, 0x53, 0x20, 
-0xcd, 0xc3, 0xb5, 0x42, 0x95, 0x43, 0x20, 0x7, 0xc9, 0xa0, 0x57, 0x20, 0xcd, 0xc3, 0xa0, 0x0, 
-0x84, 0x5b, 0x84, 0x5c, 0x84, 0x5d, 0x84, 0x5e, 0x60, 0x20, 0x61, 0xc6, 0xa5, 0x54, 0x20, 0x5, 
-0xc7, 0xf0, 0xec, 0xa0, 0x20, 0x88, 0xf0, 0x41, 0x6, 0x57, 0x26, 0x58, 0x26, 0x59, 0x26, 0x5a, 
-0x10, 0xf3, 0x26, 0x57, 0x26, 0x58, 0x26, 0x59, 0x26, 0x5a, 0x26, 0x5b, 0x26, 0x5c, 0x26, 0x5d, 
-0x26, 0x5e, 0x38, 0xa5, 0x5b, 0xe5, 0x53, 0x48, 0xa5, 0x5c, 0xe5, 0x54, 0x48, 0xa5, 0x5d, 0xe5, 
-0x55, 0xaa, 0xa5, 0x5e, 0xe5, 0x56, 0x90, 0xc, 0x85, 0x5e, 0x86, 0x5d, 0x68, 0x85, 0x5c, 0x68, 
-0x85, 0x5b, 0xb0, 0x2, 0x68, 0x68, 0x88, 0xd0, 0xc9, 0x60, 0x20, 0x8b, 0xc7, 0xca, 0x86, 0x4, 
-0xb5, 0x42, 0x49, 0x80, 0x85, 0x52, 0xb5, 0x43, 0x49, 0x80, 0x85, 0x54, 0xa0, 0x0, 0x38, 0xb5, 
-0x15, 0xf5, 0x16, 0x85, 0x53, 0xb5, 0x24, 0xf5, 0x25, 0x85, 0x55, 0xb5, 0x33, 0xf5, 0x34, 0x85, 
-0x56, 0xa5, 0x52, 0xe5, 0x54, 0x5, 0x53, 0x5, 0x55, 0x5, 0x56, 0x60, 0x20, 0x2c, 0xc7, 0xa2, 
-0x43, 0x4c, 0x33, 0xc2, 0x20, 0x2c, 0xc7, 0xb5, 0x14, 0x35, 0x15, 0x95, 0x14, 0xc6, 0x4, 0x4c, 
-0xf, 0xc7, 0x20, 0x2c, 0xc7, 0xb5, 0x14, 0x15, 0x15, 0x4c, 0x1b, 0xc7, 0xa2, 0x46, 0x4c, 0x33, 
-0xc2, 0x20, 0x8b, 0xc7, 0x20, 0xae, 0xce, 0xb5, 0x15, 0x85, 0x54, 0xb5, 0x24, 0x85, 0x55, 0xa0, 
-0xff, 0xc8, 0xb1, 0x54, 0xd1, 0x52, 0xd0, 0x7, 0x49, 0xd, 0xd0, 0xf5, 0xa8, 0xf0, 0x11, 0xa0, 
-0x0, 0xf0, 0xe, 0x20, 0x8b, 0xc7, 0xa2, 0x0, 0x4c, 0x33, 0xc2, 0x20, 0xda, 0xc6, 0xd0, 0x1, 
-0xc8, 0x94, 0x15, 0x60, 0x20, 0xda, 0xc6, 0xf0, 0xf7, 0x90, 0xf5, 0xb0, 0xf4, 0x20, 0xda, 0xc6, 
-0xd0, 0xee, 0xf0, 0xed, 0x20, 0xda, 0xc6, 0x90, 0xe7, 0xb0, 0xe6, 0x20, 0xda, 0xc6, 0xb0, 0xe0, 
-0x90, 0xdf, 0x20, 0xda, 0xc6, 0xf0, 0xda, 0xb0, 0xd7, 0x90, 0xd6, 0x20, 0xb, 0xc8, 0x4c, 0x95, 
-0xc7, 0x95, 0x41, 0xc6, 0x4, 0xa2, 0x0, 0x4c, 0x7b, 0xc2, 0x20, 0xb, 0xc8, 0x18, 0xb5, 0x14, 
-0x75, 0x15, 0x95, 0x14, 0xb5, 0x23, 0x75, 0x24, 0x95, 0x23, 0xb5, 0x32, 0x75, 0x33, 0x95, 0x32, 
-0xb5, 0x41, 0x75, 0x42, 0x4c, 0x91, 0xc7, 0x20, 0xb, 0xc8, 0xb5, 0x14, 0xf5, 0x15, 0x95, 0x14, 
-0xb5, 0x23, 0xf5, 0x24, 0x95, 0x23, 0xb5, 0x32, 0xf5, 0x33, 0x95, 0x32, 0xb5, 0x41, 0xf5, 0x42, 
-0x4c, 0x91, 0xc7, 0x20, 0xb, 0xc8, 0xb5, 0x14, 0x15, 0x15, 0x95, 0x14, 0xb5, 0x23, 0x15, 0x24, 
-0x95, 0x23, 0xb5, 0x32, 0x15, 0x33, 0x95, 0x32, 0xb5, 0x41, 0x15, 0x42, 0x4c, 0x91, 0xc7, 0x20, 
-0xb, 0xc8, 0xb5, 0x14, 0x55, 0x15, 0x95, 0x14, 0xb5, 0x23, 0x55, 0x24, 0x95, 0x23, 0xb5, 0x32, 
-0x55, 0x33, 0x95, 0x32, 0xb5, 0x41, 0x55, 0x42, 0x4c, 0x91, 0xc7, 0x20, 0xbc, 0xc8, 0xa2, 0x5, 
-0x4c, 0x7b, 0xc2, 0x20, 0x61, 0xc6, 0x46, 0x5a, 0x66, 0x59, 0x66, 0x58, 0x66, 0x57, 0x90, 0x19, 
-0x18, 0x98, 0x65, 0x53, 0xa8, 0xa5, 0x5c, 0x65, 0x54, 0x85, 0x5c, 0xa5, 0x5d, 0x65, 0x55, 0x85, 
-0x5d, 0xa5, 0x5e, 0x65, 0x56, 0x29, 0x7f, 0x85, 0x5e, 0x6, 0x53, 0x26, 0x54, 0x26, 0x55, 0x26, 
-0x56, 0xa5, 0x57, 0x5, 0x58, 0x5, 0x59, 0x5, 0x5a, 0xd0, 0xcb, 0x84, 0x5b, 0xa5, 0x52, 0x8, 
-0xa0, 0x5b, 0x20, 0x9f, 0xc9, 0x28, 0x10, 0x3, 0x20, 0xc4, 0xc8, 0x4c, 0xe, 0xc8, 0x20, 0x89, 
-0xc6, 0x26, 0x57, 0x26, 0x58, 0x26, 0x59, 0x26, 0x5a, 0x24, 0x52, 0x8, 0xa0, 0x57, 0xd0, 0xe2, 
-0x20, 0x89, 0xc6, 0xa6, 0x4, 0xb5, 0x44, 0x8, 0x4c, 0x50, 0xc8, 0x20, 0xbc, 0xc8, 0xca, 0x86, 
-0x4, 0xb5, 0x15, 0x35, 0x16, 0x95, 0x15, 0xb5, 0x24, 0x35, 0x25, 0x95, 0x24, 0xb5, 0x33, 0x35, 
-0x34, 0x95, 0x33, 0xb5, 0x42, 0x35, 0x43, 0x95, 0x42, 0x4c, 0xe, 0xc8, 0x20, 0xa2, 0xc8, 0x4c, 
-0xe, 0xc8, 0x20, 0xbc, 0xc8, 0x18, 0xb5, 0x15, 0x75, 0x14, 0xa8, 0xb5, 0x24, 0x75, 0x23, 0xca, 
-0x4c, 0x53, 0xc9, 0x20, 0xa2, 0xc8, 0x20, 0x62, 0xc9, 0x4c, 0xe, 0xc8, 0xa2, 0x4, 0x4c, 0x33, 
-0xc2, 0x20, 0xdc, 0xc8, 0x38, 0xa9, 0x0, 0xa8, 0xf5, 0x15, 0x95, 0x15, 0x98, 0xf5, 0x24, 0x95, 
-0x24, 0x98, 0xf5, 0x33, 0x95, 0x33, 0x98, 0xf5, 0x42, 0x95, 0x42, 0x60, 0x20, 0x34, 0xc4, 0x90, 
-0x17, 0xb4, 0x15, 0xb9, 0x21, 0x3, 0x95, 0x15, 0xb9, 0x57, 0x3, 0x95, 0x33, 0xb9, 0x3c, 0x3, 
-0x95, 0x24, 0xb9, 0x72, 0x3, 0x95, 0x42, 0x60, 0x20, 0x6a, 0xc4, 0xb0, 0xfa, 0xa2, 0x7, 0x4c, 
-0x33, 0xc2, 0x20, 0xbc, 0xc8, 0xb5, 0x42, 0x30, 0xbb, 0x60, 0xa2, 0x0, 0x86, 0x52, 0x86, 0x53, 
-0x86, 0x54, 0x86, 0x55, 0x88, 0xc8, 0xb1, 0x5, 0xc9, 0x30, 0x90, 0x22, 0xc9, 0x3a, 0x90, 0xa, 
-0xe9, 0x37, 0xc9, 0xa, 0x90, 0x18, 0xc9, 0x10, 0xb0, 0x14, 0xa, 0xa, 0xa, 0xa, 0xa2, 0x3, 
-0xa, 0x26, 0x52, 0x26, 0x53, 0x26, 0x54, 0x26, 0x55, 0xca, 0x10, 0xf4, 0x30, 0xd7, 0x8a, 0x10, 
-0x18, 0x4c, 0xd6, 0xc4, 0x20, 0xc, 0xc7, 0xa2, 0xc, 0x4c, 0x7b, 0xc2, 0x20, 0xbc, 0xc8, 0xb4, 
-0x15, 0xb5, 0x24, 0x85, 0x53, 0x84, 0x52, 0xca, 0xa0, 0x0, 0xb1, 0x52, 0x4c, 0x7c, 0xc9, 0x20, 
-0x4c, 0xc9, 0xa0, 0x1, 0xb1, 0x52, 0x95, 0x24, 0xc8, 0xb1, 0x52, 0x95, 0x33, 0xc8, 0xb1, 0x52, 
-0x95, 0x42, 0x60, 0xa0, 0xd, 0x20, 0xa1, 0xc9, 0xf0, 0x7, 0xa5, 0x7, 0x20, 0xb3, 0xc9, 0x95, 
-0x24, 0x95, 0x33, 0x95, 0x42, 0x60, 0xa0, 0x20, 0xa5, 0xa, 0x4a, 0x4a, 0x4a, 0x45, 0xc, 0x6a, 
-0x26, 0x8, 0x26, 0x9, 0x26, 0xa, 0x26, 0xb, 0x26, 0xc, 0x88, 0xd0, 0xeb, 0xa0, 0x8, 0xa6, 
-0x4, 0xb9, 0x1, 0x0, 0x95, 0x25, 0xb9, 0x2, 0x0, 0x95, 0x34, 0xb9, 0x3, 0x0, 0x95, 0x43, 
-0xb9, 0x0, 0x0, 0x95, 0x16, 0xe8, 0x86, 0x4, 0xa4, 0x3, 0xa9, 0x0, 0x60, 0x20, 0xbc, 0xc8, 
-0x20, 0xcb, 0xc3, 0xa0, 0x0, 0xa9, 0xd, 0xd1, 0x52, 0xf0, 0x3, 0xc8, 0xd0, 0xf9, 0x98, 0x4c, 
-0x7c, 0xc9, 0x20, 0xb1, 0xce, 0x4c, 0x58, 0xc9, 0x68, 0x68, 0x85, 0x0, 0xa5, 0x10, 0x85, 0x5, 
-0xa5, 0x11, 0x85, 0x6, 0x4c, 0xf2, 0xc2, 0x40, 0x3d, 0x31, 0x3b, 0x50, 0x2e, 0x24, 0x36, 0x24, 
-0x37, 0x27, 0x22, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x20, 0x22, 0x3f, 0x30, 0x3b, 0x40, 0x3d, 0x38, 
-0x3b, 0x49, 0x46, 0x3f, 0x31, 0x7c, 0x3f, 0x32, 0x50, 0x2e, 0x22, 0x20, 0x4c, 0x49, 0x4e, 0x45, 
-0x22, 0x21, 0x31, 0x26, 0x20, 0x23, 0x46, 0x46, 0x46, 0x46, 0xd, 0x0, 0x0, 0x50, 0x2e, 0x27, 
-0x3b, 0x45, 0x2e, 0xd, 0x20, 0x24, 0xc4, 0x90, 0xf2, 0x6c, 0x4, 0xd0, 0x20, 0x8b, 0xc7, 0xa6, 
-0x4, 0xca, 0xca, 0x86, 0x4, 0xb4, 0x16, 0xb5, 0x17, 0x99, 0x21, 0x3, 0xb5, 0x26, 0x99, 0x3c, 
-0x3, 0xb5, 0x35, 0x99, 0x57, 0x3, 0xb5, 0x44, 0x99, 0x72, 0x3, 0x60, 0xe6, 0x7, 0x6c, 0x8, 
-0x2, 0xa9, 0x0, 0x20, 0x7c, 0xc9, 0xa9, 0xff, 0x20, 0x7c, 0xc9, 0x85, 0x4, 0xa0, 0x7f, 0x84, 
-0x26, 0x20, 0x65, 0xc4, 0x90, 0x52, 0x20, 0x31, 0xc2, 0xb0, 0x58, 0x20, 0x65, 0xc4, 0xa2, 0x1, 
-0x86, 0x4, 0x20, 0xe4, 0xc4, 0x20, 0x2e, 0xc6, 0x90, 0x30, 0x88, 0xb0, 0x21, 0xa9, 0x5, 0x8d, 
-0x21, 0x3, 0x20, 0x89, 0xc5, 0xa9, 0x8, 0x8d, 0x21, 0x3, 0xa4, 0x3, 0xb1, 0x58, 0xc9, 0xd, 
-0xf0, 0x6, 0x20, 0x4c, 0xca, 0xc8, 0xd0, 0xf4, 0x20, 0x54, 0xcd, 0x20, 0xa1, 0xce, 0xb1, 0x58, 
-0x85, 0x25, 0xc8, 0xb1, 0x58, 0x85, 0x16, 0xc8, 0x84, 0x3, 0xa5, 0x16, 0x18, 0xe5, 0x17, 0xa5, 
-0x25, 0xe5, 0x26, 0x90, 0xc8, 0x4c, 0xcf, 0xc2, 0x20, 0x31, 0xc2, 0xe6, 0x4, 0x20, 0x65, 0xc4, 
-0x4c, 0x6e, 0xca, 0xa5, 0x16, 0xa4, 0x25, 0x85, 0x17, 0x84, 0x26, 0xb0, 0xa1, 0x20, 0x34, 0xc4, 
-0xa4, 0x15, 0xf0, 0x10, 0x90, 0xf, 0xc6, 0x4, 0xb5, 0x15, 0xd9, 0x3f, 0x2, 0xf0, 0x6, 0x88, 
-0x84, 0x15, 0xd0, 0xf6, 0x0, 0xbe, 0x3f, 0x2, 0x18, 0xbd, 0x21, 0x3, 0x79, 0x4a, 0x2, 0x9d, 
-0x21, 0x3, 0x85, 0x52, 0xbd, 0x3c, 0x3, 0x79, 0x55, 0x2, 0x9d, 0x3c, 0x3, 0x85, 0x53, 0xbd, 
-0x57, 0x3, 0x79, 0x60, 0x2, 0x9d, 0x57, 0x3, 0x85, 0x54, 0xbd, 0x72, 0x3, 0x79, 0x6b, 0x2, 
-0x9d, 0x72, 0x3, 0xaa, 0xa5, 0x52, 0x38, 0xf9, 0x76, 0x2, 0x85, 0x52, 0xa5, 0x53, 0xf9, 0x81, 
-0x2, 0x85, 0x53, 0xa5, 0x54, 0xf9, 0x8c, 0x2, 0x85, 0x54, 0x8a, 0xf9, 0x97, 0x2, 0x5, 0x52, 
-0x5, 0x53, 0x5, 0x54, 0xf0, 0xf, 0x8a, 0x59, 0x6b, 0x2, 0x59, 0x97, 0x2, 0x10, 0x4, 0xb0, 
-0x4, 0x90, 0xf, 0xb0, 0xd, 0xb9, 0xa2, 0x2, 0x85, 0x5, 0xb9, 0xad, 0x2, 0x85, 0x6, 0x4c, 
-0xff, 0xcb, 0xc6, 0x15, 0x4c, 0x58, 0xc5, 0x20, 0x34, 0xc4, 0x90, 0x11, 0x20, 0x79, 0xc2, 0x20, 
-0x2c, 0xca, 0x98, 0xa4, 0x15, 0xc0, 0xb, 0xb0, 0x4, 0x99, 0x40, 0x2, 0xa9, 0x0, 0x99, 0x6c, 
-0x2, 0x99, 0x61, 0x2, 0x99, 0x56, 0x2, 0xa9, 0x1, 0x99, 0x4b, 0x2, 0xa2, 0x16, 0x4c, 0x33, 
-0xc2, 0x20, 0x8b, 0xc7, 0xa4, 0x15, 0xca, 0x86, 0x4, 0xb5, 0x16, 0x99, 0x77, 0x2, 0xb5, 0x25, 
-0x99, 0x82, 0x2, 0xb5, 0x34, 0x99, 0x8d, 0x2, 0xb5, 0x43, 0x99, 0x98, 0x2, 0xa2, 0x1a, 0x4c, 
-0x33, 0xc2, 0x20, 0x8b, 0xc7, 0xa4, 0x15, 0xca, 0x86, 0x4, 0xb5, 0x16, 0x99, 0x4b, 0x2, 0xb5, 
-0x25, 0x99, 0x56, 0x2, 0xb5, 0x34, 0x99, 0x61, 0x2, 0xb5, 0x43, 0x99, 0x6c, 0x2, 0x20, 0xc, 
-0xc5, 0xa4, 0x15, 0xa5, 0x5, 0x99, 0xa3, 0x2, 0xa5, 0x6, 0x99, 0xae, 0x2, 0xe6, 0x15, 0x4c, 
-0x1b, 0xc3, 0x20, 0x1f, 0xcc, 0x20, 0xc, 0xc5, 0xa4, 0x14, 0xc0, 0xe, 0xb0, 0x22, 0xa5, 0x5, 
-0x99, 0xcf, 0x2, 0xa5, 0x6, 0x99, 0xdd, 0x2, 0xe6, 0x14, 0x90, 0x1f, 0x20, 0xe4, 0xc4, 0xa4, 
-0x14, 0xf0, 0x2a, 0xc6, 0x14, 0xb9, 0xce, 0x2, 0x85, 0x5, 0xb9, 0xdc, 0x2, 0x85, 0x6, 0x20, 
-0x0, 0xc5, 0x4c, 0x1b, 0xc3, 0x20, 0x1f, 0xcc, 0x20, 0xe4, 0xc4, 0xa5, 0x57, 0xd0, 0x5, 0x20, 
-0x2e, 0xc6, 0xb0, 0x69, 0xa4, 0x58, 0xa5, 0x59, 0x84, 0x5, 0x4c, 0xfd, 0xcb, 0x0, 0xc8, 0xb1, 
-0x5, 0xc9, 0x20, 0xf0, 0xf9, 0xc9, 0x61, 0x90, 0x50, 0x85, 0x57, 0xe9, 0x61, 0xc9, 0x1b, 0xb0, 
-0x48, 0xa, 0xaa, 0xbd, 0x8d, 0x3, 0x85, 0x58, 0x20, 0xf6, 0xc4, 0xbd, 0x8e, 0x3, 0x85, 0x59, 
-0x5, 0x58, 0xd0, 0x34, 0xa8, 0xa5, 0x12, 0x85, 0x59, 0x88, 0xa9, 0xd, 0xc8, 0xd1, 0x58, 0xd0, 
-0xfb, 0xc8, 0xb1, 0x58, 0x30, 0x45, 0x85, 0x2, 0xc8, 0xb1, 0x58, 0x85, 0x1, 0xc8, 0xb1, 0x58, 
-0x88, 0xc5, 0x57, 0xf0, 0x6, 0x20, 0xa1, 0xce, 0x4c, 0x4a, 0xcc, 0x20, 0xa2, 0xce, 0xa5, 0x58, 
-0x9d, 0x8d, 0x3, 0xa5, 0x59, 0x9d, 0x8e, 0x3, 0x60, 0x20, 0xbc, 0xc8, 0xa9, 0x0, 0x85, 0x57, 
-0x60, 0x20, 0x72, 0xc3, 0x20, 0x34, 0xc4, 0xb0, 0x5, 0xa2, 0x2b, 0x4c, 0x33, 0xc2, 0x20, 0x9, 
-0xcd, 0xa5, 0x5, 0x48, 0xa5, 0x6, 0x48, 0xa5, 0x3, 0x48, 0xa0, 0x0, 0x84, 0x3, 0xc8, 0x84, 
-0x6, 0xa0, 0x40, 0x84, 0x5, 0x20, 0x2c, 0xca, 0x68, 0x85, 0x3, 0x68, 0x85, 0x6, 0x68, 0x85, 
-0x5, 0xa2, 0x2c, 0x4c, 0x33, 0xc2, 0x20, 0x8b, 0xc7, 0xa0, 0x54, 0x20, 0xcd, 0xc3, 0x20, 0x9, 
-0xcd, 0xa2, 0x40, 0xa0, 0x0, 0xbd, 0x0, 0x1, 0x91, 0x54, 0xc9, 0xd, 0xf0, 0xb3, 0xe8, 0xc8, 
-0xd0, 0xf3, 0x20, 0xc, 0xc7, 0xa4, 0x13, 0xf0, 0xeb, 0xca, 0x86, 0x4, 0xb5, 0x16, 0xf0, 0x5, 
-0xc6, 0x13, 0x4c, 0x58, 0xc5, 0xb9, 0xb8, 0x2, 0x85, 0x5, 0xb9, 0xc3, 0x2, 0x4c, 0xfd, 0xcb, 
-0xa6, 0x13, 0xe0, 0xb, 0xb0, 0x1a, 0x88, 0x20, 0xf6, 0xc4, 0xa5, 0x5, 0x9d, 0xb9, 0x2, 0xa5, 
-0x6, 0x9d, 0xc4, 0x2, 0xe6, 0x13, 0x4c, 0x1b, 0xc3, 0xa9, 0x3f, 0xa0, 0x40, 0xd0, 0x2, 0xa0, 
-0x0, 0x20, 0x4c, 0xca, 0x84, 0x52, 0xa4, 0x52, 0x20, 0xe6, 0xff, 0xc9, 0x7f, 0xd0, 0x7, 0x88, 
-0xc4, 0x52, 0x10, 0xf4, 0x30, 0xf0, 0xc9, 0x18, 0xd0, 0x6, 0x20, 0x54, 0xcd, 0x4c, 0x16, 0xcd, 
-0xc9, 0x1b, 0xd0, 0x3, 0x4c, 0xcf, 0xc2, 0x99, 0x0, 0x1, 0xc9, 0xd, 0xf0, 0x19, 0xc8, 0x98, 
-0x38, 0xe5, 0x52, 0xc9, 0x40, 0x90, 0xd1, 0x20, 0xe3, 0xff, 0xc9, 0x7f, 0xd0, 0xf9, 0x20, 0xf4, 
-0xff, 0x4c, 0x1f, 0xcd, 0x20, 0xed, 0xff, 0xa9, 0x0, 0x85, 0x7, 0x60, 0x20, 0x8b, 0xc7, 0x20, 
-0xae, 0xce, 0xa0, 0x54, 0x20, 0xcd, 0xc3, 0xa0, 0xff, 0xc8, 0xb1, 0x52, 0x91, 0x54, 0xc9, 0xd, 
-0xd0, 0xf7, 0x4c, 0x58, 0xc5, 0x20, 0x81, 0xcd, 0x4c, 0xf1, 0xc3, 0x20, 0x81, 0xcd, 0x4c, 0x9, 
-0xc4, 0x20, 0xe1, 0xc8, 0x20, 0xbc, 0xc8, 0xca, 0x18, 0xb5, 0x16, 0x75, 0x15, 0x95, 0x15, 0xb5, 
-0x25, 0x75, 0x24, 0x95, 0x24, 0x86, 0x4, 0x60, 0x20, 0xe4, 0xc4, 0xa5, 0x12, 0x85, 0xe, 0xa0, 
-0x0, 0x84, 0xd, 0x88, 0xc8, 0xb1, 0xd, 0xc9, 0xd, 0xd0, 0xf9, 0x20, 0xbc, 0xcd, 0xb1, 0xd, 
-0x30, 0x3, 0xc8, 0xd0, 0xef, 0xc8, 0x20, 0xbc, 0xcd, 0x4c, 0xcf, 0xc2, 0x18, 0x98, 0x65, 0xd, 
-0x85, 0xd, 0x90, 0x2, 0xe6, 0xe, 0xa0, 0x1, 0x60, 0x84, 0x56, 0x20, 0x2e, 0xc6, 0xb0, 0x48, 
-0xa5, 0x58, 0x85, 0x52, 0xe9, 0x1, 0x85, 0x58, 0x85, 0xd, 0xa5, 0x59, 0x85, 0x53, 0xe9, 0x0, 
-0x85, 0xe, 0x85, 0x59, 0xa9, 0xd, 0xc8, 0xd1, 0x52, 0xd0, 0xfb, 0x18, 0x98, 0x65, 0x52, 0x85, 
-0x52, 0x90, 0x2, 0xe6, 0x53, 0xa0, 0x0, 0xb1, 0x52, 0x91, 0xd, 0xc9, 0xd, 0xf0, 0x9, 0xc8, 
-0xd0, 0xf5, 0xe6, 0x53, 0xe6, 0xe, 0xd0, 0xef, 0xc8, 0xd0, 0x4, 0xe6, 0x53, 0xe6, 0xe, 0xb1, 
-0x52, 0x91, 0xd, 0x10, 0xea, 0x20, 0xbd, 0xcd, 0xa0, 0x1, 0x84, 0x57, 0x88, 0xa9, 0xd, 0xd1, 
-0x56, 0xf0, 0x5d, 0xc8, 0xd1, 0x56, 0xd0, 0xfb, 0xc8, 0xc8, 0xa5, 0xd, 0x85, 0x54, 0xa5, 0xe, 
-0x85, 0x55, 0x20, 0xbd, 0xcd, 0x85, 0x52, 0xa5, 0xe, 0x85, 0x53, 0x88, 0xa9, 0x55, 0x91, 0xd, 
-0xd1, 0xd, 0xd0, 0xb2, 0xa, 0x91, 0xd, 0xd1, 0xd, 0xd0, 0xab, 0xb1, 0x54, 0x91, 0x52, 0x98, 
-0xd0, 0x4, 0xc6, 0x55, 0xc6, 0x53, 0x88, 0x98, 0x65, 0x54, 0xa6, 0x55, 0x90, 0x1, 0xe8, 0xc5, 
-0x58, 0x8a, 0xe5, 0x59, 0xb0, 0xe5, 0xa0, 0x1, 0xa5, 0x25, 0x91, 0x58, 0xc8, 0xa5, 0x16, 0x91, 
-0x58, 0x38, 0x20, 0xa2, 0xce, 0xa0, 0xff, 0xc8, 0xb1, 0x56, 0x91, 0x58, 0xc9, 0xd, 0xd0, 0xf7, 
-0x4c, 0xcf, 0xc2, 0x20, 0xe4, 0xc4, 0xa0, 0x0, 0x84, 0x5, 0x84, 0x3, 0xa5, 0x12, 0x85, 0x6, 
-0x4c, 0x5b, 0xc5, 0x20, 0xde, 0xc4, 0xca, 0x20, 0xcb, 0xc3, 0xa0, 0x0, 0xb5, 0x17, 0x91, 0x52, 
-0x60, 0x18, 0x98, 0x65, 0x58, 0x85, 0x58, 0x90, 0x2, 0xe6, 0x59, 0x4c, 0x0, 0xc5, 0x20, 0x79, 
-0xc2, 0xa2, 0x26, 0x4c, 0x33, 0xc2, 0x20, 0x8b, 0xc7, 0x20, 0xcb, 0xc3, 0xa4, 0x3, 0x60, 0x20, 
-0xf6, 0xc4, 0x84, 0x53, 0x88, 0xa2, 0x0, 0xb1, 0x5, 0xc9, 0xd, 0xf0, 0xf9, 0x9d, 0x40, 0x1, 
-0xe8, 0xc8, 0xc9, 0x22, 0xd0, 0xf1, 0xb1, 0x5, 0xc9, 0x22, 0xf0, 0xe, 0xa9, 0xd, 0x9d, 0x3f, 
-0x1, 0x84, 0x3, 0xa9, 0x40, 0x85, 0x52, 0xa6, 0x4, 0x60, 0xc8, 0xb0, 0xda, 0x20, 0xfa, 0xce, 
-0x88, 0x84, 0x56, 0x38, 0x20, 0xe0, 0xff, 0x4c, 0x9b, 0xcd, 0x20, 0xb1, 0xce, 0x20, 0xe4, 0xc4, 
-0x88, 0x84, 0x54, 0xa5, 0x12, 0x85, 0x55, 0xa2, 0x52, 0x60, 0x20, 0xfa, 0xce, 0x84, 0x58, 0x85, 
-0x59, 0xa5, 0xd, 0x85, 0x5a, 0xa5, 0xe, 0x85, 0x5b, 0xa9, 0xb2, 0x85, 0x56, 0xa9, 0xc2, 0x85, 
-0x57, 0x18, 0x20, 0xdd, 0xff, 0x4c, 0x5b, 0xc5, 0x38, 0xa9, 0x0, 0x2a, 0x48, 0x20, 0x3e, 0xcf, 
-0xa2, 0x52, 0x68, 0x20, 0xda, 0xff, 0xa0, 0x52, 0x20, 0x9f, 0xc9, 0x95, 0x42, 0x60, 0x20, 0xbc, 
-0xc8, 0xb4, 0x15, 0xca, 0x86, 0x4, 0x60, 0x20, 0xbc, 0xc8, 0x20, 0xde, 0xc4, 0x20, 0xcb, 0xc3, 
-0x20, 0x41, 0xcf, 0xa2, 0x52, 0x20, 0xd7, 0xff, 0x4c, 0x5b, 0xc5, 0x20, 0x3e, 0xcf, 0x84, 0x52, 
-0x20, 0xd4, 0xff, 0x4c, 0x7c, 0xc9, 0x20, 0x5b, 0xcf, 0xa4, 0x52, 0x20, 0xd4, 0xff, 0x95, 0x24, 
-0x20, 0xd4, 0xff, 0x95, 0x33, 0x20, 0xd4, 0xff, 0x95, 0x42, 0x60, 0x20, 0xbc, 0xc8, 0x20, 0x31, 
-0xc2, 0x20, 0xe1, 0xc4, 0x20, 0xcb, 0xc3, 0x20, 0x41, 0xcf, 0xa5, 0x52, 0x6c, 0x16, 0x2, 0x20, 
-0x7b, 0xcf, 0x4c, 0x5b, 0xc5, 0x20, 0x7b, 0xcf, 0xa2, 0x1, 0xb5, 0x52, 0x20, 0xd1, 0xff, 0xe8, 
-0xe0, 0x4, 0x90, 0xf6, 0xb0, 0xec, 0x38, 0x8, 0x20, 0xb1, 0xce, 0xa2, 0x52, 0x28, 0x20, 0xce, 
-0xff, 0xa6, 0x4, 0x4c, 0x7c, 0xc9, 0x20, 0xbc, 0xc8, 0x20, 0xe4, 0xc4, 0x20, 0x41, 0xcf, 0x20, 
-0xcb, 0xff, 0x4c, 0x5b, 0xc5, 0x20, 0x2c, 0xc2, 0x20, 0xb1, 0xce, 0x20, 0xe4, 0xc4, 0x88, 0xb1, 
-0x52, 0x84, 0x55, 0xa4, 0xf, 0x48, 0x20, 0xd1, 0xff, 0x68, 0xc9, 0xd, 0xf0, 0xe4, 0xa4, 0x55, 
-0xc8, 0xd0, 0xec, 0x20, 0x2c, 0xc2, 0x20, 0xe1, 0xc4, 0x20, 0xcb, 0xc3, 0xa0, 0x0, 0x84, 0x55, 
-0xa4, 0xf, 0x20, 0xd4, 0xff, 0xa4, 0x55, 0x91, 0x52, 0xc8, 0xc9, 0xd, 0xd0, 0xf0, 0xf0, 0xc2, 
-0x50, 0x4c, 0x4f, 0x54, 0xf5, 0x4e, 0x44, 0x52, 0x41, 0x57, 0xf5, 0x42, 0x4d, 0x4f, 0x56, 0x45, 
-0xf5, 0x46, 0x43, 0x4c, 0x45, 0x41, 0x52, 0xf6, 0x7b, 0x44, 0x49, 0x4d, 0xf0, 0xae, 0x5b, 0xf2, 
-0xa1, 0x4f, 0x4c, 0x44, 0xf5, 0x31, 0x57, 0x41, 0x49, 0x54, 0xf1, 0x4c, 0xc5, 0x50, 0xa4, 0x5e, 
-0xb1, 0x5, 0xc9, 0x40, 0x90, 0x12, 0xc9, 0x5b, 0xb0, 0xe, 0xc8, 0xd1, 0x5, 0xd0, 0x9, 0x20, 
-0x8b, 0xf0, 0x20, 0x4f, 0xc9, 0x4c, 0x62, 0xc9, 0x4c, 0x24, 0xca, 0xa2, 0xff, 0xa4, 0x5e, 0xc6, 
-0x5e, 0xb1, 0x5, 0xc9, 0x40, 0x90, 0x9, 0xc9, 0x5b, 0xb0, 0x5, 0xc8, 0xd1, 0x5, 0xf0, 0x25, 
-0xa4, 0x5e, 0xe8, 0xc8, 0xbd, 0x0, 0xf0, 0x30, 0xc, 0xd1, 0x5, 0xf0, 0xf5, 0xe8, 0xbd, 0xff, 
-0xef, 0x10, 0xfa, 0xd0, 0xeb, 0x85, 0x53, 0xbd, 0x1, 0xf0, 0x85, 0x52, 0x84, 0x3, 0xa6, 0x4, 
-0xe6, 0x5e, 0x6c, 0x52, 0x0, 0x20, 0x8b, 0xf0, 0x4c, 0xf1, 0xc3, 0xc8, 0x84, 0x3, 0xe9, 0x40, 
-0x48, 0x20, 0xbc, 0xc8, 0x68, 0xa8, 0xb5, 0x15, 0xa, 0x36, 0x24, 0xa, 0x36, 0x24, 0x18, 0x79, 
-0xeb, 0x2, 0x95, 0x15, 0xb5, 0x24, 0x79, 0x6, 0x3, 0x95, 0x24, 0xb0, 0xd7, 0x60, 0xa5, 0x1, 
-0x5, 0x2, 0xf0, 0x22, 0x20, 0x34, 0xc4, 0x90, 0x1e, 0x20, 0xbc, 0xc8, 0xca, 0xca, 0x86, 0x4, 
-0xb4, 0x16, 0x38, 0xa5, 0x23, 0x99, 0x21, 0x3, 0x75, 0x17, 0x85, 0x23, 0xa5, 0x24, 0x99, 0x3c, 
-0x3, 0x75, 0x26, 0x4c, 0x19, 0xf1, 0x0, 0xa4, 0x3, 0xb1, 0x5, 0xc9, 0x40, 0x90, 0xf7, 0xc9, 
-0x5b, 0xb0, 0xf3, 0xc8, 0xd1, 0x5, 0xd0, 0xee, 0xe9, 0x40, 0x48, 0xc8, 0x84, 0x3, 0x20, 0xbc, 
-0xc8, 0x68, 0xa8, 0xa5, 0x23, 0x99, 0xeb, 0x2, 0xa5, 0x24, 0x99, 0x6, 0x3, 0xca, 0x86, 0x4, 
-0xb4, 0x16, 0xc8, 0xd0, 0x2, 0xf6, 0x25, 0x98, 0xa, 0x36, 0x25, 0xa, 0x36, 0x25, 0x18, 0x65, 
-0x23, 0x85, 0x23, 0xb5, 0x25, 0x65, 0x24, 0xb0, 0xbd, 0x85, 0x24, 0xa0, 0x0, 0xa9, 0xaa, 0x91, 
-0x23, 0xd1, 0x23, 0xd0, 0xf7, 0x4a, 0x91, 0x23, 0xd1, 0x23, 0xd0, 0xf0, 0x20, 0x34, 0xc4, 0xb0, 
-0xa5, 0xa4, 0x3, 0xb1, 0x5, 0xc9, 0x2c, 0xd0, 0x5, 0xe6, 0x3, 0x4c, 0xae, 0xf0, 0x4c, 0x58, 
-0xc5, 0xa5, 0xd, 0x85, 0x23, 0xa5, 0xe, 0x85, 0x24, 0x4c, 0x83, 0xce, 0x20, 0xe4, 0xc4, 0x20, 
-0x66, 0xfe, 0x4c, 0x5b, 0xc5, 0x1c, 0x8a, 0x1c, 0x23, 0x5d, 0x8b, 0x1b, 0xa1, 0x9d, 0x8a, 0x1d, 
-0x23, 0x9d, 0x8b, 0x1d, 0xa1, 0x0, 0x29, 0x19, 0xae, 0x69, 0xa8, 0x19, 0x23, 0x24, 0x53, 0x1b, 
-0x23, 0x24, 0x53, 0x19, 0xa1, 0x0, 0x1a, 0x5b, 0x5b, 0xa5, 0x69, 0x24, 0x24, 0xae, 0xae, 0xa8, 
-0xad, 0x29, 0x0, 0x7c, 0x0, 0x15, 0x9c, 0x6d, 0x9c, 0xa5, 0x69, 0x29, 0x53, 0x84, 0x13, 0x34, 
-0x11, 0xa5, 0x69, 0x23, 0xa0, 0xd8, 0x62, 0x5a, 0x48, 0x26, 0x62, 0x94, 0x88, 0x54, 0x44, 0xc8, 
-0x54, 0x68, 0x44, 0xe8, 0x94, 0x0, 0xb4, 0x8, 0x84, 0x74, 0xb4, 0x28, 0x6e, 0x74, 0xf4, 0xcc, 
-0x4a, 0x72, 0xf2, 0xa4, 0x8a, 0x0, 0xaa, 0xa2, 0xa2, 0x74, 0x74, 0x74, 0x72, 0x44, 0x68, 0xb2, 
-0x32, 0xb2, 0x0, 0x22, 0x0, 0x1a, 0x1a, 0x26, 0x26, 0x72, 0x72, 0x88, 0xc8, 0xc4, 0xca, 0x26, 
-0x48, 0x44, 0x44, 0xa2, 0xc8, 0x0, 0x2, 0x0, 0x8, 0xf2, 0xff, 0x80, 0x1, 0xc0, 0xe2, 0xc0, 
-0xc0, 0xff, 0x0, 0x0, 0x8, 0x0, 0x10, 0x80, 0x40, 0xc0, 0x0, 0xc0, 0x0, 0x40, 0x0, 0x0, 
-0xe4, 0x20, 0x80, 0x0, 0xfc, 0x0, 0x8, 0x8, 0xf8, 0xfc, 0xf4, 0xc, 0x10, 0x4, 0xf4, 0x0, 
-0x20, 0x10, 0x0, 0x0, 0xf, 0x1, 0x1, 0x1, 0x11, 0x11, 0x2, 0x2, 0x11, 0x11, 0x2, 0x12, 
-0x2, 0x0, 0x8, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38, 0x40, 0x48, 0x50, 0x58, 0x60, 0x68, 0x70, 
-0x78, 0x80, 0x88, 0x90, 0x98, 0xa0, 0xa8, 0xb0, 0xb8, 0xc0, 0xc8, 0xd0, 0xd8, 0xe0, 0xe8, 0xf0, 
-0xf8, 0xc, 0x2c, 0x4c, 0x4c, 0x8c, 0xac, 0xcc, 0xec, 0x8a, 0x9a, 0xaa, 0xba, 0xca, 0xda, 0xea, 
-0xfa, 0xe, 0x2e, 0x4e, 0x6e, 0x8e, 0xae, 0xce, 0xee, 0xd, 0x2d, 0x4d, 0x6d, 0x8d, 0xad, 0xcd, 
-0xed, 0xd, 0xd, 0xc, 0xd, 0xe, 0xd, 0xc, 0xd, 0xd, 0xd, 0xc, 0xd, 0xd, 0xd, 0xc, 
-0xd, 0xf, 0xd, 0xc, 0xd, 0x9, 0xd, 0xc, 0xd, 0x8, 0xd, 0xc, 0xd, 0x8, 0xd, 0xc, 
-0xd, 0xf, 0x6, 0xb, 0xb, 0x4, 0xa, 0x8, 0x8, 0xd, 0xd, 0xd, 0xd, 0xd, 0xf, 0xd, 
-0xf, 0x7, 0x7, 0x7, 0x7, 0x5, 0x9, 0x3, 0x3, 0x1, 0x1, 0x1, 0x1, 0x2, 0x1, 0x1, 
-0x1, 0xa4, 0x3, 0xb1, 0x5, 0xe6, 0x3, 0xc9, 0x20, 0xf0, 0xf6, 0x60, 0xe6, 0x3, 0x4c, 0x1b, 
-0xc3, 0xb1, 0x5, 0xc9, 0x5d, 0xf0, 0xf5, 0x20, 0xf6, 0xc4, 0xc6, 0x3, 0x20, 0x8e, 0xf3, 0xc6, 
-0x3, 0xa5, 0x52, 0x48, 0xa5, 0x53, 0x48, 0xad, 0x21, 0x3, 0x48, 0xa9, 0x0, 0x85, 0x34, 0x85, 
-0x43, 0xa9, 0x5, 0x8d, 0x21, 0x3, 0xa5, 0x1, 0x85, 0x16, 0xa5, 0x2, 0x85, 0x25, 0x20, 0x89, 
-0xc5, 0x20, 0x79, 0xf3, 0x68, 0x8d, 0x21, 0x3, 0x68, 0x20, 0x7e, 0xf3, 0x68, 0x20, 0x76, 0xf3, 
-0xa0, 0x0, 0xc4, 0x0, 0xf0, 0x9, 0xb9, 0x66, 0x0, 0x20, 0x76, 0xf3, 0xc8, 0xd0, 0xf3, 0xc0, 
-0x3, 0xf0, 0xc, 0x20, 0x79, 0xf3, 0x20, 0x4c, 0xca, 0x20, 0x4c, 0xca, 0xc8, 0xd0, 0xf0, 0xa0, 
-0x0, 0xb1, 0x5, 0xc9, 0x3b, 0xf0, 0xa, 0xc9, 0xd, 0xf0, 0x6, 0x20, 0x4c, 0xca, 0xc8, 0xd0, 
-0xf0, 0x20, 0x54, 0xcd, 0x20, 0xe4, 0xc4, 0x88, 0xb1, 0x5, 0xc8, 0xc9, 0x3b, 0xf0, 0xc, 0xa5, 
-0x6, 0xc9, 0x1, 0xd0, 0x3, 0x4c, 0xcf, 0xc2, 0x20, 0x1d, 0xc5, 0x4c, 0xa1, 0xf2, 0x20, 0x91, 
-0xf2, 0x85, 0x66, 0x20, 0x91, 0xf2, 0xc5, 0x66, 0xd0, 0x10, 0xc9, 0x40, 0x90, 0xc, 0xc9, 0x5b, 
-0xb0, 0x8, 0x38, 0x20, 0x8e, 0xf0, 0x20, 0xcb, 0xc3, 0xa0, 0x0, 0xad, 0x31, 0x3, 0x91, 0x52, 
-0xad, 0x4c, 0x3, 0xc8, 0x91, 0x52, 0xa9, 0x0, 0xc8, 0x91, 0x52, 0xc8, 0x91, 0x52, 0xd0, 0x36, 
-0x20, 0x91, 0xf2, 0xc9, 0x3b, 0xf0, 0x4, 0xc9, 0xd, 0xd0, 0xf5, 0xad, 0x31, 0x3, 0x85, 0x52, 
-0xad, 0x4c, 0x3, 0x85, 0x53, 0x60, 0x20, 0x7e, 0xf3, 0xa9, 0x20, 0x4c, 0x4c, 0xca, 0xa2, 0xff, 
-0x48, 0x4a, 0x4a, 0x4a, 0x4a, 0x20, 0xf9, 0xc5, 0x68, 0x29, 0xf, 0x4c, 0xf9, 0xc5, 0xa2, 0x0, 
-0x86, 0x0, 0x86, 0x64, 0x86, 0x65, 0x20, 0x91, 0xf2, 0xc9, 0x3a, 0xf0, 0x91, 0xc9, 0x3b, 0xf0, 
-0xca, 0xc9, 0xd, 0xf0, 0xc6, 0xc9, 0x5c, 0xf0, 0xb7, 0xa0, 0x5, 0x38, 0x69, 0x0, 0xa, 0xa, 
-0xa, 0xa, 0x26, 0x6a, 0x26, 0x69, 0x88, 0xd0, 0xf8, 0xe8, 0xe0, 0x3, 0xd0, 0xd8, 0x6, 0x6a, 
-0x26, 0x69, 0xa2, 0x40, 0xa5, 0x69, 0xdd, 0x54, 0xf1, 0xf0, 0x4, 0xca, 0xd0, 0xf8, 0x0, 0xbc, 
-0x94, 0xf1, 0xc4, 0x6a, 0xd0, 0xf5, 0xbd, 0x10, 0xf2, 0x85, 0x66, 0xbc, 0x50, 0xf2, 0x84, 0xf, 
-0x66, 0x64, 0x66, 0x65, 0x88, 0xd0, 0xf9, 0xa4, 0xf, 0xc0, 0xd, 0xd0, 0x5, 0xa2, 0x0, 0x4c, 
-0x9b, 0xf4, 0x20, 0x91, 0xf2, 0xc9, 0x40, 0xf0, 0x5b, 0xc9, 0x28, 0xf0, 0x65, 0xa2, 0x1, 0xc9, 
-0x41, 0xf0, 0xec, 0xc6, 0x3, 0x20, 0x8b, 0xc7, 0x20, 0x91, 0xf2, 0xc9, 0x2c, 0xd0, 0x31, 0x20, 
-0x91, 0xf2, 0xa4, 0x25, 0xf0, 0x15, 0xa2, 0x9, 0xc9, 0x58, 0xf0, 0x7f, 0xca, 0xc9, 0x59, 0xd0, 
-0x79, 0xa5, 0xf, 0xc9, 0x9, 0xd0, 0x74, 0xa2, 0xe, 0xd0, 0x70, 0xa2, 0x4, 0xc9, 0x58, 0xf0, 
-0x6a, 0xc9, 0x59, 0xd0, 0x65, 0xca, 0xa4, 0xf, 0xc0, 0x3, 0xb0, 0x5f, 0xa2, 0x8, 0xd0, 0x5b, 
-0xc6, 0x3, 0xa2, 0x2, 0xa4, 0xf, 0xc0, 0xc, 0xf0, 0x51, 0xa2, 0x5, 0xa5, 0x25, 0xf0, 0x4b, 
-0xa2, 0xc, 0xd0, 0x47, 0x20, 0x8b, 0xc7, 0xa5, 0xf, 0xa2, 0x6, 0xc9, 0x1, 0xf0, 0x3c, 0xe8, 
-0xd0, 0x39, 0x20, 0x8b, 0xc7, 0x20, 0x91, 0xf2, 0xc9, 0x29, 0xf0, 0x16, 0xc9, 0x2c, 0xd0, 0x2a, 
-0x20, 0x91, 0xf2, 0xc9, 0x58, 0xd0, 0x23, 0x20, 0x91, 0xf2, 0xc9, 0x29, 0xd0, 0x1c, 0xa2, 0xb, 
-0xd0, 0x19, 0xa2, 0xd, 0xa5, 0xf, 0xc9, 0xb, 0xf0, 0x11, 0xa2, 0xa, 0x20, 0x91, 0xf2, 0xc9, 
-0x2c, 0xd0, 0x7, 0x20, 0x91, 0xf2, 0xc9, 0x59, 0xf0, 0x1, 0x0, 0x20, 0x60, 0xf3, 0xbd, 0xd5, 
-0xf1, 0xf0, 0x4, 0x25, 0x64, 0xd0, 0x7, 0xbd, 0xe4, 0xf1, 0x25, 0x65, 0xf0, 0xec, 0x18, 0xbd, 
-0xf3, 0xf1, 0x65, 0x66, 0x85, 0x66, 0xbd, 0x2, 0xf2, 0xa2, 0x0, 0x86, 0x4, 0xa4, 0x16, 0x84, 
-0x67, 0xa4, 0x25, 0x84, 0x68, 0xc9, 0xf, 0xf0, 0x23, 0x29, 0xf, 0xa8, 0xc8, 0x84, 0x0, 0xc0, 
-0x2, 0xd0, 0x4, 0xa4, 0x68, 0xd0, 0xc3, 0xa0, 0x0, 0xb9, 0x66, 0x0, 0x91, 0x52, 0xc8, 0xee, 
-0x31, 0x3, 0xd0, 0x3, 0xee, 0x4c, 0x3, 0xc4, 0x0, 0xd0, 0xee, 0x60, 0xa9, 0x2, 0x85, 0x0, 
-0x38, 0xa5, 0x67, 0xed, 0x31, 0x3, 0x85, 0x67, 0xa5, 0x68, 0xed, 0x4c, 0x3, 0x85, 0x68, 0x38, 
-0xa5, 0x67, 0xe9, 0x2, 0x85, 0x67, 0xa8, 0xa5, 0x68, 0xe9, 0x0, 0xf0, 0x1f, 0xc9, 0xff, 0xf0, 
-0x16, 0x20, 0xd1, 0xf7, 0x4f, 0x55, 0x54, 0x20, 0x4f, 0x46, 0x20, 0x52, 0x41, 0x4e, 0x47, 0x45, 
-0x3a, 0xa, 0xd, 0x84, 0x67, 0x30, 0xb0, 0x98, 0x30, 0xad, 0x10, 0xe5, 0x98, 0x10, 0xa8, 0x30, 
-0xe0, 0x20, 0xe4, 0xc4, 0x88, 0x84, 0x52, 0xa5, 0x12, 0x85, 0x53, 0x98, 0xc8, 0x91, 0x52, 0x4c, 
-0x9b, 0xcd, 0xa2, 0x5, 0xd0, 0x2, 0xa2, 0xc, 0x86, 0x16, 0xe6, 0x4, 0xd0, 0x6, 0x20, 0xbc, 
-0xc8, 0x20, 0x31, 0xc2, 0x20, 0xbc, 0xc8, 0x20, 0x31, 0xc2, 0x20, 0xbc, 0xc8, 0x20, 0xe4, 0xc4, 
-0xb5, 0x15, 0x85, 0x5c, 0xb5, 0x24, 0x85, 0x5d, 0xb5, 0x14, 0x85, 0x5a, 0xb5, 0x23, 0x85, 0x5b, 
-0xa2, 0x0, 0x86, 0x4, 0xa2, 0x3, 0xbd, 0xc1, 0x3, 0x95, 0x52, 0xca, 0x10, 0xf8, 0xa5, 0x16, 
-0x29, 0x4, 0xd0, 0x13, 0xa2, 0x2, 0x18, 0xb5, 0x5a, 0x75, 0x52, 0x95, 0x5a, 0xb5, 0x5b, 0x75, 
-0x53, 0x95, 0x5b, 0xca, 0xca, 0x10, 0xef, 0xa2, 0x3, 0xb5, 0x5a, 0x9d, 0xc1, 0x3, 0xca, 0x10, 
-0xf8, 0xa5, 0x16, 0x29, 0x3, 0xf0, 0xb, 0x85, 0x5e, 0xa5, 0x16, 0x29, 0x8, 0xf0, 0x6, 0x20, 
-0x78, 0xf6, 0x4c, 0x5b, 0xc5, 0xa2, 0x2, 0x38, 0xb5, 0x5a, 0xf5, 0x52, 0xb4, 0x52, 0x94, 0x5a, 
-0x95, 0x52, 0xb4, 0x53, 0xb5, 0x5b, 0xf5, 0x53, 0x94, 0x5b, 0x95, 0x53, 0x95, 0x56, 0x10, 0xd, 
-0xa9, 0x0, 0x38, 0xf5, 0x52, 0x95, 0x52, 0xa9, 0x0, 0xf5, 0x53, 0x95, 0x53, 0xca, 0xca, 0x10, 
-0xd6, 0xa5, 0x54, 0xc5, 0x52, 0xa5, 0x55, 0xe5, 0x53, 0x90, 0x31, 0xa9, 0x0, 0xe5, 0x54, 0x85, 
-0x57, 0xa9, 0x0, 0xe5, 0x55, 0x38, 0x6a, 0x85, 0x59, 0x66, 0x57, 0x20, 0x78, 0xf6, 0xa5, 0x5c, 
-0xcd, 0xc3, 0x3, 0xd0, 0xa, 0xa5, 0x5d, 0xcd, 0xc4, 0x3, 0xd0, 0x3, 0x4c, 0x5b, 0xc5, 0x20, 
-0x55, 0xf6, 0xa5, 0x59, 0x30, 0xe5, 0x20, 0x44, 0xf6, 0x4c, 0xfb, 0xf5, 0xa5, 0x53, 0x4a, 0x85, 
-0x59, 0xa5, 0x52, 0x6a, 0x85, 0x57, 0x20, 0x78, 0xf6, 0xa5, 0x5a, 0xcd, 0xc1, 0x3, 0xd0, 0x7, 
-0xa5, 0x5b, 0xcd, 0xc2, 0x3, 0xf0, 0xd5, 0x20, 0x44, 0xf6, 0xa5, 0x59, 0x10, 0xe8, 0x20, 0x55, 
-0xf6, 0x4c, 0x26, 0xf6, 0x38, 0xa5, 0x57, 0xe5, 0x54, 0x85, 0x57, 0xa5, 0x59, 0xe5, 0x55, 0x85, 
-0x59, 0xa2, 0x0, 0xf0, 0xf, 0x18, 0xa5, 0x57, 0x65, 0x52, 0x85, 0x57, 0xa5, 0x59, 0x65, 0x53, 
-0x85, 0x59, 0xa2, 0x2, 0xb5, 0x56, 0x10, 0x9, 0xb5, 0x5a, 0xd0, 0x2, 0xd6, 0x5b, 0xd6, 0x5a, 
-0x60, 0xf6, 0x5a, 0xd0, 0xfb, 0xf6, 0x5b, 0x60, 0x6c, 0xfe, 0x3, 0x20, 0xc8, 0xc3, 0xa0, 0x0, 
-0xa5, 0x52, 0xf0, 0x3e, 0xc9, 0x5, 0x90, 0x2, 0xa9, 0x4, 0xa2, 0x80, 0x86, 0x54, 0x84, 0x53, 
-0x85, 0x52, 0xaa, 0xbd, 0xce, 0xf6, 0xa6, 0x12, 0x10, 0x4, 0xc5, 0x12, 0xb0, 0xe1, 0xaa, 0x98, 
-0x91, 0x53, 0x88, 0xd0, 0xfb, 0xe6, 0x54, 0xe4, 0x54, 0xd0, 0xf5, 0xa4, 0x52, 0xb9, 0xd8, 0xf6, 
-0x8d, 0xff, 0x3, 0xb9, 0xd3, 0xf6, 0x8d, 0xfe, 0x3, 0xb9, 0xdd, 0xf6, 0x8d, 0x0, 0xb0, 0x4c, 
-0x58, 0xc5, 0xa9, 0x40, 0x99, 0x0, 0x80, 0x99, 0x0, 0x81, 0x88, 0xd0, 0xf7, 0xf0, 0xdc, 0x84, 
-0x86, 0x8c, 0x98, 0xe2, 0x3b, 0x54, 0x6d, 0xaa, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0x0, 0x30, 0x70, 
-0xb0, 0xf0, 0xa5, 0x5b, 0x5, 0x5d, 0xd0, 0x52, 0xa5, 0x5a, 0xc9, 0x40, 0xb0, 0x4c, 0x4a, 0x85, 
-0x5f, 0xa9, 0x2f, 0x38, 0xe5, 0x5c, 0xc9, 0x30, 0xb0, 0x40, 0xa2, 0xff, 0x38, 0xe8, 0xe9, 0x3, 
-0xb0, 0xfb, 0x69, 0x3, 0x85, 0x61, 0x8a, 0xa, 0xa, 0xa, 0xa, 0xa, 0x5, 0x5f, 0x85, 0x5f, 
-0xa9, 0x80, 0x69, 0x0, 0x85, 0x60, 0xa5, 0x5a, 0x4a, 0xa5, 0x61, 0x2a, 0xa8, 0xb9, 0xcb, 0xf7, 
-0xa0, 0x0, 0xa6, 0x5e, 0xca, 0xf0, 0xf, 0xca, 0xf0, 0x7, 0x49, 0xff, 0x31, 0x5f, 0x91, 0x5f, 
-0x60, 0x51, 0x5f, 0x91, 0x5f, 0x60, 0x11, 0x5f, 0x91, 0x5f, 0x60, 0xa5, 0x5b, 0x5, 0x5d, 0xd0, 
-0xf9, 0xa5, 0x5a, 0x30, 0xf5, 0x4a, 0x4a, 0x4a, 0x85, 0x5f, 0xa9, 0x3f, 0x38, 0xe5, 0x5c, 0xc9, 
-0x40, 0x90, 0x32, 0x60, 0xa5, 0x5b, 0x5, 0x5d, 0xd0, 0xe0, 0xa5, 0x5a, 0x30, 0xdc, 0x4a, 0x4a, 
-0x4a, 0x85, 0x5f, 0xa9, 0x5f, 0x38, 0xe5, 0x5c, 0xc9, 0x60, 0x90, 0x19, 0x60, 0xa5, 0x5b, 0x5, 
-0x5d, 0xd0, 0xc7, 0xa5, 0x5a, 0x30, 0xc3, 0x4a, 0x4a, 0x4a, 0x85, 0x5f, 0xa9, 0xbf, 0x38, 0xe5, 
-0x5c, 0xc9, 0xc0, 0xb0, 0xb5, 0xa0, 0x0, 0x84, 0x60, 0xa, 0x26, 0x60, 0xa, 0x26, 0x60, 0xa, 
-0x26, 0x60, 0xa, 0x26, 0x60, 0x65, 0x5f, 0x85, 0x5f, 0xa5, 0x60, 0x69, 0x80, 0x85, 0x60, 0xa5, 
-0x5a, 0x29, 0x7, 0xa8, 0xb9, 0xc9, 0xf7, 0x4c, 0x20, 0xf7, 0xa5, 0x5b, 0x5, 0x5d, 0xd0, 0xbc, 
-0xa5, 0x5a, 0x4a, 0x4a, 0x4a, 0x85, 0x5f, 0xa9, 0xbf, 0x38, 0xe5, 0x5c, 0xc9, 0xc0, 0xb0, 0xac, 
-0xa0, 0x0, 0x84, 0x60, 0xa, 0x26, 0x60, 0x10, 0xc0, 0x80, 0x40, 0x20, 0x10, 0x8, 0x4, 0x2, 
-0x1, 0x68, 0x85, 0xe8, 0x68, 0x85, 0xe9, 0xa0, 0x0, 0xe6, 0xe8, 0xd0, 0x2, 0xe6, 0xe9, 0xb1, 
-0xe8, 0x30, 0x6, 0x20, 0xf4, 0xff, 0x4c, 0xd7, 0xf7, 0x6c, 0xe8, 0x0, 0xa2, 0xd4, 0x20, 0xf1, 
-0xf7, 0xb5, 0x1, 0x20, 0x2, 0xf8, 0xe8, 0xe8, 0xb5, 0xfe, 0x20, 0x2, 0xf8, 0xa9, 0x20, 0x4c, 
-0xf4, 0xff, 0x48, 0x4a, 0x4a, 0x4a, 0x4a, 0x20, 0xb, 0xf8, 0x68, 0x29, 0xf, 0xc9, 0xa, 0x90, 
-0x2, 0x69, 0x6, 0x69, 0x30, 0x4c, 0xf4, 0xff, 0x20, 0x76, 0xf8, 0xa2, 0x0, 0xc9, 0x22, 0xf0, 
-0x6, 0xe8, 0xd0, 0x1b, 0x4c, 0x7d, 0xfa, 0xc8, 0xb9, 0x0, 0x1, 0xc9, 0xd, 0xf0, 0xf5, 0x9d, 
-0x40, 0x1, 0xe8, 0xc9, 0x22, 0xd0, 0xf0, 0xc8, 0xb9, 0x0, 0x1, 0xc9, 0x22, 0xf0, 0xe8, 0xa9, 
-0xd, 0x9d, 0x3f, 0x1, 0xa9, 0x40, 0x85, 0xc9, 0xa9, 0x1, 0x85, 0xca, 0xa2, 0xc9, 0x60, 0xa0, 
-0x0, 0xb5, 0x0, 0x99, 0xc9, 0x0, 0xe8, 0xc8, 0xc0, 0xa, 0x90, 0xf5, 0xa0, 0xff, 0xa9, 0xd, 
-0xc8, 0xc0, 0xe, 0xb0, 0x7, 0xd1, 0xc9, 0xd0, 0xf7, 0xc0, 0x0, 0x60, 0x20, 0xd1, 0xf7, 0x4e, 
-0x41, 0x4d, 0x45, 0xea, 0x0, 0xc8, 0xb9, 0x0, 0x1, 0xc9, 0x20, 0xf0, 0xf8, 0x60, 0xc9, 0x30, 
-0x90, 0xf, 0xc9, 0x3a, 0x90, 0x8, 0xe9, 0x7, 0x90, 0x7, 0xc9, 0x40, 0xb0, 0x2, 0x29, 0xf, 
-0x60, 0x38, 0x60, 0xa9, 0x0, 0x95, 0x0, 0x95, 0x1, 0x95, 0x2, 0x20, 0x76, 0xf8, 0xb9, 0x0, 
-0x1, 0x20, 0x7e, 0xf8, 0xb0, 0x15, 0xa, 0xa, 0xa, 0xa, 0x94, 0x2, 0xa0, 0x4, 0xa, 0x36, 
-0x0, 0x36, 0x1, 0x88, 0xd0, 0xf8, 0xb4, 0x2, 0xc8, 0xd0, 0xe3, 0xb5, 0x2, 0x60, 0x43, 0x41, 
-0x54, 0xfa, 0x2a, 0x4c, 0x4f, 0x41, 0x44, 0xf9, 0x58, 0x53, 0x41, 0x56, 0x45, 0xfa, 0xbb, 0x52, 
-0x55, 0x4e, 0xfa, 0x20, 0x4d, 0x4f, 0x4e, 0xfa, 0x1a, 0x4e, 0x4f, 0x4d, 0x4f, 0x4e, 0xfa, 0x19, 
-0x46, 0x4c, 0x4f, 0x41, 0x44, 0xf9, 0x55, 0x44, 0x4f, 0x53, 0xd, 0xe0, 0x0, 0xf9, 0x26, 0xa2, 
-0xff, 0xd8, 0xa0, 0x0, 0x84, 0xdd, 0x20, 0x76, 0xf8, 0x88, 0xc8, 0xe8, 0xbd, 0xbe, 0xf8, 0x30, 
-0x18, 0xd9, 0x0, 0x1, 0xf0, 0xf4, 0xca, 0xe8, 0xbd, 0xbe, 0xf8, 0x10, 0xfa, 0xe8, 0xb9, 0x0, 
-0x1, 0xc9, 0x2e, 0xd0, 0xdd, 0xc8, 0xca, 0xb0, 0xe3, 0x85, 0xca, 0xbd, 0xbf, 0xf8, 0x85, 0xc9, 
-0x18, 0xa2, 0x0, 0x6c, 0xc9, 0x0, 0x20, 0xd1, 0xf7, 0x43, 0x4f, 0x4d, 0x3f, 0xea, 0x0, 0x20, 
-0x8e, 0xfb, 0x50, 0xfa, 0xf0, 0xf9, 0x20, 0x2b, 0xfc, 0xa0, 0x0, 0x20, 0xd4, 0xff, 0x91, 0xcb, 
-0xe6, 0xcb, 0xd0, 0x2, 0xe6, 0xcc, 0xa2, 0xd4, 0x20, 0x8, 0xfa, 0xd0, 0xee, 0x38, 0x66, 0xdd, 
-0x18, 0x66, 0xdd, 0x28, 0x60, 0x38, 0x66, 0xdd, 0x20, 0x18, 0xf8, 0xa2, 0xcb, 0x20, 0x93, 0xf8, 
-0xf0, 0x4, 0xa9, 0xff, 0x85, 0xcd, 0x20, 0x76, 0xfa, 0xa2, 0xc9, 0x6c, 0xc, 0x2, 0x8, 0x78, 
-0x20, 0x4f, 0xf8, 0x8, 0x20, 0x3e, 0xfc, 0x28, 0xf0, 0xb5, 0xa9, 0x0, 0x85, 0xd0, 0x85, 0xd1, 
-0x20, 0xa2, 0xf9, 0x90, 0xc9, 0xe6, 0xd0, 0xe6, 0xcc, 0xd0, 0xf5, 0x18, 0x90, 0xc0, 0x20, 0xf4, 
-0xff, 0xc8, 0xb9, 0xed, 0x0, 0xc9, 0xd, 0xd0, 0xf5, 0xc8, 0x20, 0xfd, 0xf7, 0xc0, 0xe, 0x90, 
-0xf8, 0x60, 0xa9, 0x0, 0x85, 0xdc, 0x20, 0x8e, 0xfb, 0x50, 0xf8, 0xd0, 0xf5, 0x20, 0xc9, 0xfb, 
-0x8, 0x20, 0xe2, 0xfb, 0x28, 0xf0, 0x10, 0xa5, 0xdb, 0x29, 0x20, 0x5, 0xea, 0xd0, 0xe3, 0x20, 
-0x92, 0xf9, 0x20, 0xed, 0xff, 0xd0, 0xdb, 0xa2, 0x2, 0xa5, 0xdd, 0x30, 0x13, 0xb5, 0xcf, 0xd5, 
-0xd8, 0xb0, 0x8, 0xa9, 0x5, 0x20, 0x40, 0xfc, 0x20, 0x3e, 0xfc, 0xd0, 0xc5, 0xca, 0xd0, 0xed, 
-0x20, 0x2b, 0xfc, 0x24, 0xdb, 0x50, 0xb, 0x88, 0xc8, 0x20, 0xd4, 0xff, 0x91, 0xcb, 0xc4, 0xd8, 
-0xd0, 0xf6, 0xa5, 0xdc, 0x85, 0xce, 0x20, 0xd4, 0xff, 0xc5, 0xce, 0xf0, 0x8, 0x20, 0xd1, 0xf7, 
-0x53, 0x55, 0x4d, 0xea, 0x0, 0x26, 0xdb, 0x60, 0xf6, 0x0, 0xd0, 0x2, 0xf6, 0x1, 0xb5, 0x0, 
-0xd5, 0x2, 0xd0, 0x4, 0xb5, 0x1, 0xd5, 0x3, 0x60, 0xca, 0x20, 0x76, 0xfa, 0x86, 0xea, 0x60, 
-0x20, 0x58, 0xf9, 0x24, 0xdd, 0x70, 0x4c, 0x6c, 0xd6, 0x0, 0x8, 0x20, 0x76, 0xfa, 0x20, 0x3e, 
-0xfc, 0x20, 0x8e, 0xfb, 0x70, 0x2, 0x28, 0x60, 0xf0, 0xa, 0xa0, 0x0, 0x20, 0x99, 0xf9, 0x20, 
-0xec, 0xf7, 0xd0, 0x19, 0x20, 0xc9, 0xfb, 0x20, 0xe2, 0xfb, 0x20, 0x92, 0xf9, 0x20, 0xec, 0xf7, 
-0x26, 0xdb, 0x10, 0x9, 0xe8, 0x20, 0xf1, 0xf7, 0xb5, 0xfd, 0x20, 0x2, 0xf8, 0x20, 0xed, 0xff, 
-0xd0, 0xcf, 0x4c, 0xed, 0xff, 0x20, 0x93, 0xf8, 0xf0, 0x13, 0x60, 0xa2, 0xcb, 0x20, 0x65, 0xfa, 
-0x20, 0x76, 0xfa, 0x6c, 0xcb, 0x0, 0x20, 0x76, 0xf8, 0xc9, 0xd, 0xf0, 0xa2, 0x20, 0xd1, 0xf7, 
-0x53, 0x59, 0x4e, 0x3f, 0xea, 0x0, 0x38, 0xa5, 0xd1, 0xe5, 0xcf, 0x48, 0xa5, 0xd2, 0xe5, 0xd0, 
-0xa8, 0x68, 0x18, 0x65, 0xcb, 0x85, 0xcd, 0x98, 0x65, 0xcc, 0x85, 0xce, 0xa0, 0x4, 0xb9, 0xca, 
-0x0, 0x20, 0xd1, 0xff, 0x88, 0xd0, 0xf7, 0xb1, 0xcf, 0x20, 0xd1, 0xff, 0xe6, 0xcf, 0xd0, 0x2, 
-0xe6, 0xd0, 0xa2, 0xcb, 0x20, 0x8, 0xfa, 0xd0, 0xee, 0x28, 0x60, 0x20, 0x18, 0xf8, 0xa2, 0xcb, 
-0x20, 0x65, 0xfa, 0xa2, 0xd1, 0x20, 0x65, 0xfa, 0xa2, 0xcd, 0x20, 0x93, 0xf8, 0x8, 0xa5, 0xcb, 
-0xa6, 0xcc, 0x28, 0xd0, 0x4, 0x85, 0xcd, 0x86, 0xce, 0x85, 0xcf, 0x86, 0xd0, 0x20, 0x76, 0xfa, 
-0xa2, 0xc9, 0x6c, 0xe, 0x2, 0x8, 0x78, 0x20, 0x4f, 0xf8, 0x8, 0xa9, 0x6, 0x20, 0x40, 0xfc, 
-0xa2, 0x7, 0x20, 0x7a, 0xfb, 0x28, 0xf0, 0x8e, 0xa2, 0x4, 0xb5, 0xce, 0x95, 0xd2, 0xca, 0xd0, 
-0xf9, 0x86, 0xd0, 0x86, 0xd1, 0xa5, 0xd5, 0xd0, 0x2, 0xc6, 0xd6, 0xc6, 0xd5, 0x18, 0x66, 0xd2, 
-0x38, 0xa2, 0xff, 0xa5, 0xd5, 0xe5, 0xd3, 0x85, 0xcf, 0xa5, 0xd6, 0xe5, 0xd4, 0x8, 0x66, 0xd2, 
-0x28, 0x90, 0x6, 0x18, 0xf0, 0x3, 0x86, 0xcf, 0x38, 0x66, 0xd2, 0xe8, 0x20, 0x3b, 0xfb, 0xe6, 
-0xd0, 0xe6, 0xd4, 0xe6, 0xcc, 0x26, 0xd2, 0xb0, 0xd5, 0x28, 0x60, 0xa2, 0x7, 0x20, 0x7a, 0xfb, 
-0x86, 0xdc, 0xa0, 0x4, 0xa9, 0x2a, 0x20, 0xd1, 0xff, 0x88, 0xd0, 0xf8, 0xb1, 0xc9, 0x20, 0xd1, 
-0xff, 0xc8, 0xc9, 0xd, 0xd0, 0xf6, 0xa0, 0x8, 0xb9, 0xca, 0x0, 0x20, 0xd1, 0xff, 0x88, 0xd0, 
-0xf7, 0x20, 0x81, 0xfb, 0x24, 0xd2, 0x50, 0xb, 0x88, 0xc8, 0xb1, 0xd3, 0x20, 0xd1, 0xff, 0xc4, 
-0xcf, 0xd0, 0xf6, 0xa5, 0xdc, 0x20, 0xd1, 0xff, 0xa2, 0x4, 0x8e, 0x2, 0xb0, 0xa2, 0x78, 0xd0, 
-0x2, 0xa2, 0x1e, 0x20, 0x66, 0xfe, 0xca, 0xd0, 0xfa, 0x60, 0xa2, 0x6, 0xd0, 0xf5, 0x2c, 0x1, 
-0xb0, 0x10, 0xfb, 0x50, 0xf9, 0xa0, 0x0, 0x85, 0xc3, 0xa9, 0x10, 0x85, 0xc2, 0x2c, 0x1, 0xb0, 
-0x10, 0xf, 0x50, 0xd, 0x20, 0xbd, 0xfc, 0xb0, 0xec, 0xc6, 0xc3, 0xd0, 0xf0, 0xc6, 0xc2, 0xd0, 
-0xec, 0x70, 0x1, 0x60, 0xa0, 0x4, 0x8, 0x20, 0xe4, 0xfb, 0x28, 0xa0, 0x4, 0xa9, 0x2a, 0xd9, 
-0xd3, 0x0, 0xd0, 0x3, 0x88, 0xd0, 0xf8, 0x60, 0xc8, 0x20, 0xd4, 0xff, 0x99, 0xed, 0x0, 0xc9, 
-0xd, 0xd0, 0xf5, 0xa0, 0xff, 0xc8, 0xb1, 0xc9, 0xd9, 0xed, 0x0, 0xd0, 0xea, 0xc9, 0xd, 0xd0, 
-0xf4, 0x60, 0xa0, 0x8, 0x20, 0xd4, 0xff, 0x99, 0xd3, 0x0, 0x88, 0xd0, 0xf7, 0x60, 0x86, 0xec, 
-0x84, 0xc3, 0x8, 0x78, 0xa9, 0x78, 0x85, 0xc0, 0x20, 0xbd, 0xfc, 0x90, 0xf7, 0xe6, 0xc0, 0x10, 
-0xf7, 0xa9, 0x53, 0x85, 0xc4, 0xa2, 0x0, 0xac, 0x2, 0xb0, 0x20, 0xcd, 0xfc, 0xf0, 0x0, 0xf0, 
-0x1, 0xe8, 0xc6, 0xc4, 0xd0, 0xf4, 0xe0, 0xc, 0x66, 0xc0, 0x90, 0xe5, 0xa5, 0xc0, 0x28, 0xa4, 
-0xc3, 0xa6, 0xec, 0x48, 0x18, 0x65, 0xdc, 0x85, 0xdc, 0x68, 0x60, 0xa5, 0xcd, 0x30, 0x8, 0xa5, 
-0xd4, 0x85, 0xcb, 0xa5, 0xd5, 0x85, 0xcc, 0x60, 0xb0, 0x4, 0xa9, 0x6, 0xd0, 0x2, 0xa9, 0x4, 
-0xa2, 0x7, 0x8e, 0x2, 0xb0, 0x24, 0xea, 0xd0, 0x2d, 0xc9, 0x5, 0xf0, 0x16, 0xb0, 0x9, 0x20, 
-0xd1, 0xf7, 0x50, 0x4c, 0x41, 0x59, 0xd0, 0x15, 0x20, 0xd1, 0xf7, 0x52, 0x45, 0x43, 0x4f, 0x52, 
-0x44, 0xd0, 0xa, 0x20, 0xd1, 0xf7, 0x52, 0x45, 0x57, 0x49, 0x4e, 0x44, 0xea, 0x20, 0xd1, 0xf7, 
-0x20, 0x54, 0x41, 0x50, 0x45, 0xea, 0x20, 0xe3, 0xff, 0x4c, 0xed, 0xff, 0x86, 0xec, 0x84, 0xc3, 
-0x8, 0x78, 0x48, 0x20, 0x23, 0xfc, 0x85, 0xc0, 0x20, 0xd8, 0xfc, 0xa9, 0xa, 0x85, 0xc1, 0x18, 
-0x90, 0xa, 0xa2, 0x7, 0x8e, 0x2, 0xb0, 0x20, 0xda, 0xfc, 0x30, 0x13, 0xa0, 0x4, 0xa9, 0x4, 
-0x8d, 0x2, 0xb0, 0x20, 0xd8, 0xfc, 0xee, 0x2, 0xb0, 0x20, 0xd8, 0xfc, 0x88, 0xd0, 0xef, 0x38, 
-0x66, 0xc0, 0xc6, 0xc1, 0xd0, 0xda, 0xa4, 0xc3, 0xa6, 0xec, 0x68, 0x28, 0x60, 0xa2, 0x0, 0xac, 
-0x2, 0xb0, 0xe8, 0xf0, 0x7, 0x20, 0xcd, 0xfc, 0xf0, 0xf8, 0xe0, 0x8, 0x60, 0x84, 0xc5, 0xad, 
-0x2, 0xb0, 0xa8, 0x45, 0xc5, 0x29, 0x20, 0x60, 0xa2, 0x0, 0xa9, 0x10, 0x2c, 0x2, 0xb0, 0xf0, 
-0xfb, 0x2c, 0x2, 0xb0, 0xd0, 0xfb, 0xca, 0x10, 0xf3, 0x60, 0xc9, 0x6, 0xf0, 0x1d, 0xc9, 0x15, 
-0xf0, 0x1f, 0xa4, 0xe0, 0x30, 0x23, 0xc9, 0x1b, 0xf0, 0x11, 0xc9, 0x7, 0xf0, 0x1c, 0x20, 0x44, 
-0xfd, 0xa2, 0xa, 0x20, 0xc5, 0xfe, 0xd0, 0x21, 0x4c, 0xb7, 0xfe, 0x18, 0xa2, 0x0, 0x8e, 0x0, 
-0xb0, 0xa2, 0x2, 0x8, 0x16, 0xde, 0x28, 0x76, 0xde, 0x60, 0xa9, 0x5, 0xa8, 0x8d, 0x3, 0xb0, 
-0xca, 0xd0, 0xfd, 0x49, 0x1, 0xc8, 0x10, 0xf5, 0x60, 0xc9, 0x20, 0x90, 0x17, 0x69, 0x1f, 0x30, 
-0x2, 0x49, 0x60, 0x20, 0x6b, 0xfe, 0x91, 0xde, 0xc8, 0xc0, 0x20, 0x90, 0x5, 0x20, 0xec, 0xfd, 
-0xa0, 0x0, 0x84, 0xe0, 0x48, 0x20, 0x6b, 0xfe, 0xb1, 0xde, 0x45, 0xe1, 0x91, 0xde, 0x68, 0x60, 
-0x20, 0x35, 0xfe, 0xa9, 0x20, 0x20, 0x6b, 0xfe, 0x91, 0xde, 0x10, 0xe6, 0x20, 0x35, 0xfe, 0x4c, 
-0x42, 0xfd, 0x20, 0xec, 0xfd, 0xa4, 0xe0, 0x10, 0xd9, 0xa0, 0x80, 0x84, 0xe1, 0xa0, 0x0, 0x8c, 
-0x0, 0xb0, 0xa9, 0x20, 0x99, 0x0, 0x80, 0x99, 0x0, 0x81, 0xc8, 0xd0, 0xf7, 0xa9, 0x80, 0xa0, 
-0x0, 0x85, 0xdf, 0x84, 0xde, 0xf0, 0xbb, 0x20, 0x3a, 0xfe, 0x4c, 0x42, 0xfd, 0x18, 0xa9, 0x10, 
-0x85, 0xe6, 0xa2, 0x8, 0x20, 0x13, 0xfd, 0x4c, 0x44, 0xfd, 0xa5, 0xe7, 0x49, 0x60, 0x85, 0xe7, 
-0xb0, 0x9, 0x29, 0x5, 0x2e, 0x1, 0xb0, 0x2a, 0x20, 0xea, 0xfc, 0x4c, 0x9a, 0xfe, 0xa4, 0xe0, 
-0x20, 0x6b, 0xfe, 0xb1, 0xde, 0x45, 0xe1, 0x30, 0x2, 0x49, 0x60, 0xe9, 0x20, 0x4c, 0xe9, 0xfd, 
-0xa9, 0x5f, 0x49, 0x20, 0xd0, 0x23, 0x45, 0xe7, 0x2c, 0x1, 0xb0, 0x30, 0x2, 0x49, 0x60, 0x4c, 
-0xdf, 0xfd, 0x69, 0x39, 0x90, 0xf2, 0x49, 0x10, 0x2c, 0x1, 0xb0, 0x30, 0x2, 0x49, 0x10, 0x18, 
-0x69, 0x20, 0x2c, 0x1, 0xb0, 0x70, 0x2, 0x29, 0x1f, 0x4c, 0x60, 0xfe, 0xa5, 0xde, 0xa4, 0xdf, 
-0xc0, 0x81, 0x90, 0x38, 0xc9, 0xe0, 0x90, 0x34, 0xa4, 0xe6, 0x30, 0xc, 0x88, 0xd0, 0x7, 0x20, 
-0x71, 0xfe, 0xb0, 0xfb, 0xa0, 0x10, 0x84, 0xe6, 0xa0, 0x20, 0x20, 0x66, 0xfe, 0xb9, 0x0, 0x80, 
-0x99, 0xe0, 0x7f, 0xc8, 0xd0, 0xf7, 0x20, 0x6b, 0xfe, 0xb9, 0x0, 0x81, 0x99, 0xe0, 0x80, 0xc8, 
-0xd0, 0xf7, 0xa0, 0x1f, 0xa9, 0x20, 0x91, 0xde, 0x88, 0x10, 0xfb, 0x60, 0x69, 0x20, 0x85, 0xde, 
-0xd0, 0x2, 0xe6, 0xdf, 0x60, 0x88, 0x10, 0x19, 0xa0, 0x1f, 0xa5, 0xde, 0xd0, 0xb, 0xa6, 0xdf, 
-0xe0, 0x80, 0xd0, 0x5, 0x68, 0x68, 0x4c, 0x65, 0xfd, 0xe9, 0x20, 0x85, 0xde, 0xb0, 0x2, 0xc6, 
-0xdf, 0x60, 0x20, 0xfb, 0xfe, 0x8, 0x48, 0xd8, 0x84, 0xe5, 0x86, 0xe4, 0x20, 0xea, 0xfc, 0x68, 
-0xa6, 0xe4, 0xa4, 0xe5, 0x28, 0x60, 0x2c, 0x2, 0xb0, 0x10, 0xfb, 0x2c, 0x2, 0xb0, 0x30, 0xfb, 
-0x60, 0xa0, 0x3b, 0x18, 0xa9, 0x20, 0xa2, 0xa, 0x2c, 0x1, 0xb0, 0xf0, 0x8, 0xee, 0x0, 0xb0, 
-0x88, 0xca, 0xd0, 0xf4, 0x4a, 0x8, 0x48, 0xad, 0x0, 0xb0, 0x29, 0xf0, 0x8d, 0x0, 0xb0, 0x68, 
-0x28, 0xd0, 0xe3, 0x60, 0x8, 0xd8, 0x86, 0xe4, 0x84, 0xe5, 0x2c, 0x2, 0xb0, 0x50, 0x5, 0x20, 
-0x71, 0xfe, 0x90, 0xf6, 0x20, 0x8a, 0xfb, 0x20, 0x71, 0xfe, 0xb0, 0xfb, 0x20, 0x71, 0xfe, 0xb0, 
-0xf6, 0x98, 0xa2, 0x17, 0x20, 0xc5, 0xfe, 0xbd, 0xe3, 0xfe, 0x85, 0xe2, 0xa9, 0xfd, 0x85, 0xe3, 
-0x98, 0x6c, 0xe2, 0x0, 0xca, 0xdd, 0xcb, 0xfe, 0x90, 0xfa, 0x60, 0x0, 0x8, 0x9, 0xa, 0xb, 
-0xc, 0xd, 0xe, 0xf, 0x1e, 0x7f, 0x0, 0x1, 0x5, 0x6, 0x8, 0xe, 0xf, 0x10, 0x11, 0x1c, 
-0x20, 0x21, 0x3b, 0x44, 0x5c, 0x38, 0x62, 0x87, 0x69, 0x40, 0x8d, 0x92, 0x7d, 0x50, 0xdf, 0xd2, 
-0x9a, 0xa2, 0xe2, 0xae, 0xc0, 0xdf, 0xd8, 0xd6, 0xc8, 0xc6, 0xc2, 0x48, 0xc9, 0x2, 0xf0, 0x27, 
-0xc9, 0x3, 0xf0, 0x34, 0xc5, 0xfe, 0xf0, 0x2e, 0xad, 0xc, 0xb8, 0x29, 0xe, 0xf0, 0x27, 0x68, 
-0x2c, 0x1, 0xb8, 0x30, 0xfb, 0x8d, 0x1, 0xb8, 0x48, 0xad, 0xc, 0xb8, 0x29, 0xf0, 0x9, 0xc, 
-0x8d, 0xc, 0xb8, 0x9, 0x2, 0xd0, 0xc, 0xa9, 0x7f, 0x8d, 0x3, 0xb8, 0xad, 0xc, 0xb8, 0x29, 
-0xf0, 0x9, 0xe, 0x8d, 0xc, 0xb8, 0x68, 0x60, 0xad, 0xc, 0xb8, 0x29, 0xf0, 0xb0, 0xf4, 0xa2, 
-0x17, 0xbd, 0x9a, 0xff, 0x9d, 0x4, 0x2, 0xca, 0x10, 0xf7, 0x9a, 0x8a, 0xe8, 0x86, 0xea, 0x86, 
-0xe1, 0x86, 0xe7, 0xa2, 0x33, 0x9d, 0xeb, 0x2, 0xca, 0x10, 0xfa, 0xa9, 0xa, 0x85, 0xfe, 0xa9, 
-0x8a, 0x8d, 0x3, 0xb0, 0xa9, 0x7, 0x8d, 0x2, 0xb0, 0x20, 0xd1, 0xf7, 0x6, 0xc, 0xf, 0x41, 
-0x43, 0x4f, 0x52, 0x4e, 0x20, 0x41, 0x54, 0x4f, 0x4d, 0xa, 0xa, 0xd, 0xa9, 0x82, 0x85, 0x12, 
-0x58, 0xa9, 0x55, 0x8d, 0x1, 0x29, 0xcd, 0x1, 0x29, 0xd0, 0xc, 0xa, 0x8d, 0x1, 0x29, 0xcd, 
-0x1, 0x29, 0xd0, 0x3, 0x4c, 0xb2, 0xc2, 0x4c, 0xb6, 0xc2, 0x0, 0xa0, 0xef, 0xf8, 0x52, 0xfe, 
-0x94, 0xfe, 0x6e, 0xf9, 0xe5, 0xfa, 0xac, 0xc2, 0xac, 0xc2, 0xee, 0xfb, 0x7c, 0xfc, 0x38, 0xfc, 
-0x78, 0xc2, 0x85, 0xff, 0x68, 0x48, 0x29, 0x10, 0xd0, 0x6, 0xa5, 0xff, 0x48, 0x6c, 0x4, 0x2, 
-0xa5, 0xff, 0x28, 0x8, 0x6c, 0x2, 0x2, 0x48, 0x6c, 0x0, 0x2, 0x6c, 0x1a, 0x2, 0x6c, 0x18, 
-0x2, 0x6c, 0x16, 0x2, 0x6c, 0x14, 0x2, 0x6c, 0x12, 0x2, 0x6c, 0x10, 0x2, 0x6c, 0xe, 0x2, 
-0x6c, 0xc, 0x2, 0x6c, 0xa, 0x2, 0x20, 0xe3, 0xff, 0xc9, 0xd, 0xd0, 0x7, 0xa9, 0xa, 0x20, 
-0xf4, 0xff, 0xa9, 0xd, 0x6c, 0x8, 0x2, 0x6c, 0x6, 0x2, 0xc7, 0xff, 0x3f, 0xff, 0xb2, 0xff, 
-
-};
-unsigned char dump_afloat[4096] = {
-0xaa, 0x55, 0xe, 0xd1, 0x5e, 0xd1, 0x28, 0xd0, 0xe4, 0x41, 0x43, 0x53, 0xd2, 0x1e, 0x41, 0x53, 
-0x4e, 0xd2, 0x24, 0x41, 0x54, 0x4e, 0xdc, 0x64, 0x41, 0x42, 0x53, 0xd2, 0x15, 0x43, 0x4f, 0x53, 
-0xdc, 0xe3, 0x45, 0x58, 0x50, 0xdd, 0xd4, 0x48, 0x54, 0x4e, 0xde, 0x72, 0x4c, 0x4f, 0x47, 0xdb, 
-0xb3, 0x50, 0x49, 0xd2, 0xc3, 0x53, 0x49, 0x4e, 0xdc, 0xee, 0x53, 0x51, 0x52, 0xdb, 0x6f, 0x54, 
-0x41, 0x4e, 0xda, 0xc4, 0x44, 0x45, 0x47, 0xd2, 0x73, 0x52, 0x41, 0x44, 0xd2, 0x65, 0x53, 0x47, 
-0x4e, 0xd2, 0x86, 0x56, 0x41, 0x4c, 0xd2, 0xe0, 0x46, 0x4c, 0x54, 0xd2, 0x9a, 0x46, 0x47, 0x45, 
-0x54, 0xd2, 0xcc, 0xd2, 0x96, 0x25, 0xd3, 0xb, 0x46, 0x49, 0x46, 0xd3, 0xa8, 0x46, 0x55, 0x4e, 
-0x54, 0x49, 0x4c, 0xd3, 0xae, 0x43, 0x4f, 0x4c, 0x4f, 0x55, 0x52, 0xdf, 0x2, 0x46, 0x44, 0x49, 
-0x4d, 0xd3, 0xd3, 0x53, 0x54, 0x52, 0xd3, 0x1f, 0x46, 0x50, 0x52, 0x49, 0x4e, 0x54, 0xd3, 0x31, 
-0x46, 0x49, 0x4e, 0x50, 0x55, 0x54, 0xd3, 0x6a, 0x46, 0x50, 0x55, 0x54, 0xd3, 0xb4, 0xd4, 0xaf, 
-0x2b, 0xd1, 0x77, 0x2d, 0xd1, 0x83, 0xfe, 0x2a, 0xd1, 0x8f, 0x2f, 0xd1, 0x9b, 0xfe, 0x5e, 0xd1, 
-0xa7, 0xfe, 0x2b, 0xd1, 0xcb, 0x2d, 0xd1, 0xbc, 0xd1, 0xcb, 0x29, 0xc2, 0x78, 0xff, 0x3b, 0xc5, 
-0x4a, 0xd, 0xc5, 0x4a, 0x2c, 0xd3, 0x31, 0xd3, 0x39, 0x2c, 0xd3, 0x6a, 0xc5, 0x58, 0x3d, 0xd9, 
-0xf6, 0x3c, 0x3e, 0xd9, 0xfe, 0x3c, 0x3d, 0xd9, 0xfa, 0x3c, 0xda, 0x2, 0x3e, 0x3d, 0xda, 0x6, 
-0x3e, 0xda, 0xa, 0xff, 0x20, 0xfc, 0xd0, 0xa2, 0xb4, 0xd0, 0x20, 0x18, 0x66, 0x73, 0xa2, 0xac, 
-0xd0, 0x19, 0x20, 0x5d, 0xd8, 0x20, 0x6, 0xd1, 0xa2, 0xa1, 0xd0, 0xf, 0x20, 0xf5, 0xd0, 0xa2, 
-0x9a, 0xd0, 0x8, 0x20, 0x5d, 0xd8, 0x20, 0xeb, 0xd0, 0xa2, 0xa8, 0x18, 0x90, 0x5, 0xa2, 0x5f, 
-0x84, 0x3, 0x38, 0x66, 0x53, 0xa4, 0x3, 0x88, 0xc8, 0xb1, 0x5, 0xc9, 0x20, 0xf0, 0xf9, 0x88, 
-0x84, 0x52, 0xca, 0xa4, 0x52, 0xe8, 0xc8, 0xbd, 0x6, 0xd0, 0x30, 0x1a, 0xd1, 0x5, 0xf0, 0xf5, 
-0xca, 0xe8, 0xbd, 0x6, 0xd0, 0x10, 0xfa, 0xe8, 0x24, 0x53, 0x10, 0xe7, 0xb1, 0x5, 0xc9, 0x2e, 
-0xd0, 0xe1, 0xc8, 0xca, 0xb0, 0xe1, 0xc9, 0xfe, 0xb0, 0x11, 0x85, 0x53, 0xbd, 0x7, 0xd0, 0x85, 
-0x52, 0x84, 0x3, 0xa6, 0x4, 0x6c, 0x52, 0x0, 0xa6, 0x4, 0x60, 0xf0, 0xfb, 0x0, 0x84, 0x3, 
-0x20, 0xec, 0xd0, 0x20, 0x9a, 0xd8, 0xa5, 0x5a, 0x85, 0x60, 0xa5, 0x5b, 0x85, 0x5f, 0xa5, 0x5c, 
-0x85, 0x5e, 0xa0, 0x5d, 0x4c, 0x9f, 0xc9, 0x20, 0xf2, 0xd0, 0x20, 0x70, 0xd8, 0x20, 0x3c, 0xd9, 
-0x4c, 0xff, 0xd0, 0x20, 0xf2, 0xd0, 0x20, 0x70, 0xd8, 0x20, 0x39, 0xd9, 0x4c, 0xff, 0xd0, 0x20, 
-0x3, 0xd1, 0x20, 0x70, 0xd8, 0x20, 0x45, 0xda, 0x4c, 0xf8, 0xd0, 0x20, 0x3, 0xd1, 0x20, 0x70, 
-0xd8, 0x20, 0xb6, 0xda, 0x4c, 0xf8, 0xd0, 0x20, 0xb6, 0xdb, 0x20, 0x5d, 0xd8, 0x20, 0xeb, 0xd0, 
-0x20, 0x70, 0xd8, 0x20, 0x45, 0xda, 0x20, 0xd7, 0xdd, 0x4c, 0x9, 0xd1, 0x20, 0xcb, 0xd1, 0x20, 
-0x86, 0xd6, 0xf0, 0x6, 0xa5, 0x57, 0x49, 0x80, 0x85, 0x57, 0x60, 0xa4, 0x3, 0x88, 0xc8, 0xb1, 
-0x5, 0xc9, 0x20, 0xf0, 0xf9, 0xc9, 0x25, 0xd0, 0x32, 0xe6, 0x3, 0x20, 0x44, 0xd4, 0x90, 0x2b, 
-0xa0, 0x6f, 0x20, 0xcd, 0xc3, 0xa0, 0x4, 0xa9, 0x0, 0x85, 0x5e, 0x85, 0x58, 0x85, 0x57, 0xb1, 
-0x6f, 0x99, 0x59, 0x0, 0x5, 0x57, 0x85, 0x57, 0x88, 0x10, 0xf4, 0xaa, 0xf0, 0x9, 0xa5, 0x5a, 
-0x85, 0x57, 0x9, 0x80, 0x85, 0x5a, 0x8a, 0x60, 0x84, 0x3, 0x60, 0x20, 0xa5, 0xd5, 0xb0, 0xf8, 
-0xa2, 0x0, 0x4c, 0x12, 0xd1, 0x20, 0xeb, 0xd0, 0x20, 0x86, 0xd6, 0x30, 0xa7, 0x60, 0x20, 0x24, 
-0xd2, 0x4c, 0x86, 0xdc, 0x20, 0xeb, 0xd0, 0x20, 0x86, 0xd6, 0x10, 0xa, 0xa9, 0x0, 0x85, 0x57, 
-0x20, 0x36, 0xd2, 0x4c, 0x75, 0xdc, 0x20, 0x2c, 0xd8, 0x20, 0x45, 0xda, 0x20, 0x31, 0xd8, 0x20, 
-0x8d, 0xde, 0x20, 0x33, 0xd9, 0x20, 0x72, 0xdb, 0x20, 0x86, 0xd6, 0xf0, 0x12, 0x20, 0x31, 0xd8, 
-0x20, 0xa6, 0xdb, 0x20, 0xe5, 0xd1, 0x20, 0xaa, 0xdb, 0x20, 0xdc, 0xda, 0x4c, 0x67, 0xdc, 0x20, 
-0x93, 0xdd, 0x4c, 0xe5, 0xd1, 0x20, 0xeb, 0xd0, 0xa0, 0x7c, 0xa9, 0xd2, 0x84, 0x6f, 0x85, 0x70, 
-0x4c, 0x45, 0xda, 0x20, 0xeb, 0xd0, 0xa0, 0x81, 0xa9, 0xd2, 0xd0, 0xf0, 0x7b, 0xe, 0xfa, 0x35, 
-0x12, 0x86, 0x65, 0x2e, 0xe0, 0xd3, 0x20, 0xeb, 0xd0, 0x20, 0x86, 0xd6, 0xf0, 0x7, 0x48, 0x20, 
-0x8d, 0xde, 0x68, 0x85, 0x57, 0x60, 0x24, 0x73, 0x30, 0x26, 0x20, 0xbc, 0xc8, 0xa0, 0x5d, 0x20, 
-0xcd, 0xc3, 0x85, 0x5a, 0xa5, 0x5f, 0x85, 0x5b, 0xa5, 0x5e, 0x85, 0x5c, 0xa9, 0xa0, 0x85, 0x59, 
-0xa0, 0x0, 0x84, 0x5e, 0xa5, 0x5a, 0x85, 0x57, 0x10, 0x3, 0x20, 0xd5, 0xd8, 0x4c, 0xc8, 0xd7, 
-0x4c, 0x1b, 0xca, 0x20, 0x93, 0xdd, 0x20, 0xe5, 0xd1, 0xe6, 0x59, 0x60, 0x20, 0x3e, 0xcf, 0xa2, 
-0x4, 0x20, 0xd4, 0xff, 0x9d, 0xc5, 0x3, 0xca, 0x10, 0xf7, 0x20, 0xaa, 0xdb, 0x4c, 0xe5, 0xd1, 
-0x20, 0xb1, 0xce, 0xa0, 0x0, 0x20, 0x4, 0xd3, 0xc9, 0x2b, 0xf0, 0xf, 0xc9, 0x2d, 0xd0, 0xe, 
-0x20, 0x3, 0xd3, 0x84, 0x54, 0x20, 0xb1, 0xd5, 0x4c, 0xbf, 0xd1, 0x20, 0x3, 0xd3, 0x84, 0x54, 
-0x4c, 0xb1, 0xd5, 0xc8, 0xb1, 0x52, 0xc9, 0x20, 0xf0, 0xf9, 0x60, 0x20, 0x44, 0xd4, 0x90, 0xd4, 
-0x20, 0x79, 0xc2, 0x20, 0xfc, 0xd0, 0x20, 0xe4, 0xc4, 0x20, 0x36, 0xd8, 0x4c, 0x5b, 0xc5, 0x20, 
-0xfc, 0xd0, 0x20, 0x31, 0xc2, 0x20, 0xe1, 0xc4, 0x20, 0xcb, 0xc3, 0x20, 0xd0, 0xd4, 0x4c, 0x5b, 
-0xc5, 0x20, 0x72, 0xc3, 0xa2, 0xb8, 0x4c, 0xb, 0xd1, 0x20, 0xfc, 0xd0, 0xa9, 0xc5, 0x85, 0x52, 
-0xa9, 0x3, 0x85, 0x53, 0x20, 0xd0, 0xd4, 0xc6, 0x6f, 0xad, 0x21, 0x3, 0x38, 0xe5, 0x6f, 0x90, 
-0xb, 0xf0, 0x9, 0xa8, 0xa9, 0x20, 0x20, 0x4c, 0xca, 0x88, 0xd0, 0xfa, 0xa0, 0x0, 0xb1, 0x52, 
-0xc9, 0xd, 0xf0, 0xcd, 0x20, 0x4c, 0xca, 0xc8, 0xd0, 0xf4, 0x20, 0x72, 0xc3, 0xb1, 0x5, 0xc9, 
-0x25, 0xd0, 0x8, 0xc8, 0x84, 0x3, 0x20, 0x44, 0xd4, 0xb0, 0x5, 0xa2, 0xc3, 0x4c, 0xb, 0xd1, 
-0x20, 0x9, 0xcd, 0xa8, 0xa5, 0x5, 0x48, 0xa5, 0x6, 0x48, 0xa5, 0x3, 0x48, 0x84, 0x3, 0xc8, 
-0x84, 0x6, 0xa9, 0x40, 0x85, 0x5, 0x20, 0xfc, 0xd0, 0x68, 0x85, 0x3, 0x68, 0x85, 0x6, 0x68, 
-0x85, 0x5, 0x20, 0x36, 0xd8, 0x4c, 0x7b, 0xd3, 0x20, 0xeb, 0xd9, 0x4c, 0x69, 0xc5, 0x20, 0xeb, 
-0xd9, 0x4c, 0xd5, 0xcc, 0x20, 0x94, 0xd4, 0x20, 0xfc, 0xd0, 0x20, 0xe4, 0xc4, 0x20, 0x31, 0xd8, 
-0xa6, 0x4, 0x20, 0x41, 0xcf, 0xa2, 0x4, 0xbd, 0xc5, 0x3, 0x20, 0xd1, 0xff, 0xca, 0x10, 0xf7, 
-0x4c, 0x5b, 0xc5, 0xa5, 0x1, 0x5, 0x2, 0xf0, 0x6a, 0x20, 0x34, 0xc4, 0xb0, 0x65, 0xa4, 0x3, 
-0xb1, 0x5, 0xc9, 0x25, 0xd0, 0x5d, 0xc8, 0xb1, 0x5, 0xc8, 0xd1, 0x5, 0xd0, 0x55, 0xc9, 0x5b, 
-0xb0, 0x51, 0xe9, 0x3f, 0x90, 0x4d, 0xc8, 0x84, 0x3, 0x48, 0x20, 0x8b, 0xc7, 0xf6, 0x15, 0xd0, 
-0x2, 0xf6, 0x24, 0x20, 0x9a, 0xd4, 0x68, 0xa8, 0x18, 0xa5, 0x23, 0x99, 0x87, 0x28, 0x65, 0x16, 
-0x85, 0x23, 0xa5, 0x24, 0x99, 0xa2, 0x28, 0x65, 0x25, 0x85, 0x24, 0xa0, 0x0, 0x84, 0x4, 0xa9, 
-0xaa, 0x91, 0x23, 0xd1, 0x23, 0xd0, 0x1c, 0x4a, 0x91, 0x23, 0xd1, 0x23, 0xd0, 0x15, 0x20, 0x34, 
-0xc4, 0xb0, 0x10, 0xa4, 0x3, 0xb1, 0x5, 0xc9, 0x2c, 0xd0, 0x5, 0xe6, 0x3, 0x4c, 0xd3, 0xd3, 
-0x4c, 0x58, 0xc5, 0x0, 0x20, 0x34, 0xc4, 0x90, 0xe, 0xb5, 0x15, 0xa, 0xa, 0x75, 0x15, 0x95, 
-0x15, 0xa9, 0x28, 0x95, 0x24, 0x38, 0x60, 0xa4, 0x3, 0xb1, 0x5, 0xc9, 0x21, 0xd0, 0x7, 0xe6, 
-0x3, 0x20, 0xbc, 0xc8, 0x38, 0x60, 0xc8, 0xd1, 0x5, 0xd0, 0x8, 0xc9, 0x5b, 0xb0, 0x4, 0xe9, 
-0x3f, 0xb0, 0x2, 0x18, 0x60, 0xc8, 0x84, 0x3, 0x48, 0x20, 0xbc, 0xc8, 0x20, 0x9a, 0xd4, 0x68, 
-0xa8, 0xb0, 0x10, 0xb9, 0x87, 0x28, 0x75, 0x15, 0x95, 0x15, 0xb9, 0xa2, 0x28, 0x75, 0x24, 0x95, 
-0x24, 0x90, 0xd1, 0x0, 0x20, 0xbc, 0xc8, 0x4c, 0x31, 0xc2, 0xb4, 0x24, 0xb5, 0x15, 0xa, 0x36, 
-0x24, 0xa, 0x36, 0x24, 0x18, 0x75, 0x15, 0x95, 0x15, 0x98, 0x75, 0x24, 0x95, 0x24, 0x60, 0xad, 
-0x4, 0xe0, 0xc9, 0xbf, 0xf0, 0xa, 0xad, 0x0, 0xa0, 0xc9, 0x40, 0xd0, 0x83, 0x4c, 0x2, 0xa0, 
-0x4c, 0x5, 0xe0, 0xc9, 0x3a, 0xb0, 0x7, 0xc9, 0x30, 0x90, 0x2, 0xe9, 0x30, 0x60, 0x18, 0x60, 
-0xa9, 0x0, 0x85, 0x6f, 0x20, 0x86, 0xd6, 0xd0, 0x12, 0xa9, 0x30, 0x20, 0x8d, 0xd5, 0xa9, 0x2e, 
-0x20, 0x8d, 0xd5, 0xa9, 0x30, 0x20, 0x8d, 0xd5, 0x4c, 0x71, 0xd5, 0x10, 0x5, 0xa9, 0x2d, 0x20, 
-0x8d, 0xd5, 0xa9, 0x0, 0x85, 0x6d, 0xa5, 0x59, 0xc9, 0x81, 0xb0, 0x8, 0x20, 0xa0, 0xd6, 0xc6, 
-0x6d, 0x4c, 0xf6, 0xd4, 0xc9, 0x84, 0x90, 0x10, 0xd0, 0x6, 0xa5, 0x5a, 0xc9, 0xa0, 0x90, 0x8, 
-0x20, 0x1b, 0xd7, 0xe6, 0x6d, 0x4c, 0xf6, 0xd4, 0xa5, 0x59, 0xc9, 0x84, 0xb0, 0x7, 0x20, 0xd8, 
-0xd6, 0xe6, 0x59, 0xd0, 0xf3, 0x38, 0xa9, 0xff, 0x20, 0x36, 0xd6, 0xa5, 0x5a, 0xc9, 0xa0, 0xb0, 
-0xdf, 0xa9, 0x1, 0xa4, 0x6d, 0x30, 0xa, 0xc0, 0x8, 0xb0, 0x6, 0xc8, 0xa9, 0x0, 0x85, 0x6d, 
-0x98, 0x85, 0x70, 0xa2, 0x9, 0x86, 0x54, 0x20, 0x75, 0xd5, 0xc6, 0x70, 0xd0, 0x5, 0xa9, 0x2e, 
-0x20, 0x8d, 0xd5, 0xc6, 0x54, 0xd0, 0xf0, 0xa5, 0x6d, 0xf0, 0x16, 0xa9, 0x45, 0x20, 0x8d, 0xd5, 
-0xa5, 0x6d, 0x10, 0xa, 0xa9, 0x2d, 0x20, 0x8d, 0xd5, 0x38, 0xa9, 0x0, 0xe5, 0x6d, 0x20, 0x87, 
-0xd5, 0xa9, 0xd, 0xd0, 0x18, 0xa5, 0x5a, 0x4a, 0x4a, 0x4a, 0x4a, 0x20, 0x8b, 0xd5, 0xa5, 0x5a, 
-0x29, 0xf, 0x85, 0x5a, 0x4c, 0x4e, 0xd6, 0xc9, 0xa, 0xb0, 0x9, 0x9, 0x30, 0xa4, 0x6f, 0x91, 
-0x52, 0xe6, 0x6f, 0x60, 0xa2, 0xff, 0xe8, 0xe9, 0xa, 0xb0, 0xfb, 0x69, 0xa, 0x48, 0x8a, 0x20, 
-0x87, 0xd5, 0x68, 0x10, 0xe6, 0xa5, 0x3, 0x85, 0x54, 0xa5, 0x5, 0x85, 0x52, 0xa5, 0x6, 0x85, 
-0x53, 0x20, 0xa4, 0xda, 0x85, 0x6c, 0x85, 0x6d, 0x20, 0x7b, 0xd6, 0xc9, 0x2e, 0xf0, 0xe, 0x20, 
-0xc3, 0xd4, 0x90, 0x71, 0x85, 0x5e, 0x20, 0x7b, 0xd6, 0xc9, 0x2e, 0xd0, 0x9, 0xa5, 0x6c, 0x18, 
-0xd0, 0x3a, 0xe6, 0x6c, 0xd0, 0xf0, 0xc9, 0x45, 0xf0, 0x27, 0x20, 0xc3, 0xd4, 0x90, 0x2d, 0x85, 
-0x6e, 0xa5, 0x5a, 0xc9, 0x18, 0x90, 0x8, 0xa5, 0x6c, 0xd0, 0xdb, 0xe6, 0x6d, 0xb0, 0xd7, 0xa5, 
-0x6c, 0xf0, 0x2, 0xc6, 0x6d, 0x20, 0x4e, 0xd6, 0x18, 0xa5, 0x6e, 0x20, 0x36, 0xd6, 0x4c, 0xc6, 
-0xd5, 0x20, 0x7b, 0xd6, 0x20, 0x78, 0xd7, 0x18, 0x65, 0x6d, 0x85, 0x6d, 0xa9, 0xa8, 0x85, 0x59, 
-0x20, 0x86, 0xd6, 0xf0, 0x1c, 0x20, 0xc8, 0xd7, 0xa5, 0x6d, 0x30, 0xb, 0xf0, 0x10, 0x20, 0xa0, 
-0xd6, 0xc6, 0x6d, 0xd0, 0xf9, 0xf0, 0x7, 0x20, 0x1b, 0xd7, 0xe6, 0x6d, 0xd0, 0xf9, 0x20, 0x9b, 
-0xda, 0x38, 0xa4, 0x54, 0x88, 0x60, 0xa2, 0x5, 0x75, 0x59, 0x95, 0x59, 0xa9, 0x0, 0xca, 0xd0, 
-0xf7, 0x60, 0xa2, 0x5, 0xb5, 0x59, 0x75, 0x61, 0x95, 0x59, 0xca, 0xd0, 0xf7, 0x60, 0xa2, 0x5, 
-0xa9, 0x0, 0x85, 0x67, 0xa9, 0x0, 0x85, 0x68, 0xb5, 0x59, 0xa, 0x26, 0x68, 0xa, 0x26, 0x68, 
-0x18, 0x75, 0x59, 0x90, 0x2, 0xe6, 0x68, 0xa, 0x26, 0x68, 0x18, 0x65, 0x67, 0x90, 0x2, 0xe6, 
-0x68, 0x95, 0x59, 0xa5, 0x68, 0x85, 0x67, 0xca, 0xd0, 0xda, 0x60, 0x84, 0x55, 0xa4, 0x54, 0xb1, 
-0x52, 0xa4, 0x55, 0xe6, 0x54, 0x60, 0xa5, 0x5a, 0x5, 0x5b, 0x5, 0x5c, 0x5, 0x5d, 0x5, 0x5e, 
-0xf0, 0x7, 0xa5, 0x57, 0xd0, 0x9, 0xa9, 0x1, 0x60, 0x85, 0x57, 0x85, 0x59, 0x85, 0x58, 0x60, 
-0x18, 0xa5, 0x59, 0x69, 0x3, 0x85, 0x59, 0x90, 0x2, 0xe6, 0x58, 0x20, 0xc3, 0xd6, 0x20, 0xfb, 
-0xd6, 0x20, 0xfb, 0xd6, 0x20, 0x42, 0xd6, 0x90, 0x9, 0x20, 0xd8, 0xd6, 0xe6, 0x59, 0xd0, 0x2, 
-0xe6, 0x58, 0x60, 0xa2, 0x8, 0xb5, 0x56, 0x95, 0x5e, 0xca, 0xd0, 0xf9, 0x60, 0x6, 0x5e, 0x26, 
-0x5d, 0x26, 0x5c, 0x26, 0x5b, 0x26, 0x5a, 0x60, 0x66, 0x5a, 0x66, 0x5b, 0x66, 0x5c, 0x66, 0x5d, 
-0x66, 0x5e, 0x60, 0xa5, 0x5d, 0x85, 0x5e, 0xa5, 0x5c, 0x85, 0x5d, 0xa5, 0x5b, 0x85, 0x5c, 0xa5, 
-0x5a, 0x85, 0x5b, 0xa9, 0x0, 0x85, 0x5a, 0x60, 0x20, 0xc3, 0xd6, 0x46, 0x62, 0x66, 0x63, 0x66, 
-0x64, 0x66, 0x65, 0x66, 0x66, 0x60, 0xa5, 0x65, 0x85, 0x66, 0xa5, 0x64, 0x85, 0x65, 0xa5, 0x63, 
-0x85, 0x64, 0xa5, 0x62, 0x85, 0x63, 0xa9, 0x0, 0x85, 0x62, 0x60, 0x38, 0xa5, 0x59, 0xe9, 0x4, 
-0x85, 0x59, 0xb0, 0x2, 0xc6, 0x58, 0x20, 0xf8, 0xd6, 0x20, 0xb4, 0xd6, 0x20, 0xf8, 0xd6, 0x20, 
-0xfb, 0xd6, 0x20, 0xfb, 0xd6, 0x20, 0xfb, 0xd6, 0x20, 0xb4, 0xd6, 0xa9, 0x0, 0x85, 0x62, 0xa5, 
-0x5a, 0x85, 0x63, 0xa5, 0x5b, 0x85, 0x64, 0xa5, 0x5c, 0x85, 0x65, 0xa5, 0x5d, 0x85, 0x66, 0xa5, 
-0x5e, 0x2a, 0x20, 0xb4, 0xd6, 0xa9, 0x0, 0x85, 0x62, 0x85, 0x63, 0xa5, 0x5a, 0x85, 0x64, 0xa5, 
-0x5b, 0x85, 0x65, 0xa5, 0x5c, 0x85, 0x66, 0xa5, 0x5d, 0x2a, 0x20, 0xb4, 0xd6, 0xa5, 0x5b, 0x2a, 
-0xa5, 0x5a, 0x20, 0x36, 0xd6, 0x4c, 0xb7, 0xd6, 0xa0, 0xff, 0xc9, 0x2b, 0xf0, 0x5, 0xc9, 0x2d, 
-0xd0, 0x4, 0xc8, 0x20, 0x7b, 0xd6, 0x20, 0xc3, 0xd4, 0x90, 0x24, 0xaa, 0x20, 0x7b, 0xd6, 0x20, 
-0xc3, 0xd4, 0x90, 0x10, 0x85, 0x6e, 0x20, 0x7b, 0xd6, 0x8a, 0x85, 0x67, 0xa, 0xa, 0x65, 0x67, 
-0xa, 0x65, 0x6e, 0xaa, 0x98, 0xd0, 0x6, 0x86, 0x6e, 0x38, 0xe5, 0x6e, 0x60, 0x8a, 0x60, 0xa9, 
-0x0, 0x60, 0x48, 0x20, 0xa4, 0xda, 0x68, 0xf0, 0xf8, 0x10, 0x7, 0x85, 0x57, 0xa9, 0x0, 0x38, 
-0xe5, 0x57, 0x85, 0x5a, 0xa9, 0x88, 0x85, 0x59, 0x20, 0x86, 0xd6, 0xf0, 0xe4, 0xa5, 0x5a, 0xd0, 
-0x21, 0xa5, 0x5b, 0x85, 0x5a, 0xa5, 0x5c, 0x85, 0x5b, 0xa5, 0x5d, 0x85, 0x5c, 0xa5, 0x5e, 0x85, 
-0x5d, 0xa9, 0x0, 0x85, 0x5e, 0x38, 0xa5, 0x59, 0xe9, 0x8, 0x85, 0x59, 0xb0, 0xdf, 0xc6, 0x58, 
-0x90, 0xdb, 0xa5, 0x5a, 0x30, 0xbb, 0x20, 0xcd, 0xd6, 0xa5, 0x59, 0xd0, 0x2, 0xc6, 0x58, 0xc6, 
-0x59, 0x4c, 0xf2, 0xd7, 0xa0, 0x4, 0xa9, 0x0, 0x85, 0x66, 0x85, 0x60, 0x85, 0x5f, 0xb1, 0x6f, 
-0x99, 0x61, 0x0, 0x5, 0x5f, 0x85, 0x5f, 0x88, 0x10, 0xf4, 0xaa, 0xf0, 0x9, 0xa5, 0x62, 0x85, 
-0x5f, 0x9, 0x80, 0x85, 0x62, 0x8a, 0x60, 0x20, 0xa2, 0xdb, 0xd0, 0x11, 0x20, 0xa6, 0xdb, 0xd0, 
-0xc, 0x20, 0xaa, 0xdb, 0xd0, 0x7, 0xa6, 0x4, 0xa0, 0x6f, 0x20, 0xcd, 0xc3, 0xa0, 0x0, 0xa5, 
-0x59, 0x91, 0x6f, 0xc8, 0xa5, 0x57, 0x29, 0x80, 0x85, 0x57, 0xa5, 0x5a, 0x29, 0x7f, 0x5, 0x57, 
-0x91, 0x6f, 0xc8, 0xb9, 0x59, 0x0, 0x91, 0x6f, 0xc0, 0x4, 0xd0, 0xf6, 0x60, 0xa0, 0x52, 0x84, 
-0x6f, 0xa9, 0x0, 0x85, 0x70, 0x20, 0x3d, 0xd8, 0x20, 0xd9, 0xc4, 0xa5, 0x56, 0x95, 0x73, 0x60, 
-0xa6, 0x4, 0x20, 0xcb, 0xc3, 0xb5, 0x74, 0x85, 0x56, 0x84, 0x6f, 0xa9, 0x0, 0x85, 0x70, 0x60, 
-0xa5, 0x5e, 0xc9, 0x80, 0x90, 0x7, 0xf0, 0xa, 0xa9, 0xff, 0x20, 0x72, 0xd7, 0xa9, 0x0, 0x85, 
-0x5e, 0x60, 0xa5, 0x5d, 0x9, 0x1, 0x85, 0x5d, 0xd0, 0xf3, 0x20, 0xc7, 0xd8, 0xf0, 0x6, 0xa5, 
-0x59, 0xc9, 0xa0, 0xb0, 0x14, 0x46, 0x5a, 0x66, 0x5b, 0x66, 0x5c, 0x66, 0x5d, 0x66, 0x62, 0x66, 
-0x63, 0x66, 0x64, 0x66, 0x65, 0xe6, 0x59, 0xd0, 0xe6, 0xf0, 0x16, 0xa9, 0x7f, 0x85, 0x5a, 0xa9, 
-0xff, 0x85, 0x5b, 0x85, 0x5c, 0x85, 0x5d, 0xa2, 0x8, 0xa9, 0x0, 0x95, 0x5f, 0xca, 0xd0, 0xfb, 
-0x60, 0xa5, 0x57, 0x10, 0xc, 0x38, 0xa2, 0x4, 0xa9, 0x0, 0xf5, 0x59, 0x95, 0x59, 0xca, 0xd0, 
-0xf7, 0x60, 0xa5, 0x62, 0x10, 0x23, 0xa2, 0x4, 0xa9, 0x0, 0xf5, 0x61, 0x95, 0x61, 0xca, 0xd0, 
-0xf7, 0xa5, 0x57, 0x49, 0x80, 0x85, 0x57, 0x10, 0x11, 0xe6, 0x5d, 0xd0, 0xc, 0xe6, 0x5c, 0xd0, 
-0x8, 0xe6, 0x5b, 0xd0, 0x4, 0xe6, 0x5a, 0xf0, 0xb2, 0x60, 0x20, 0xd5, 0xd8, 0x20, 0xf9, 0xd8, 
-0x4c, 0xd5, 0xd8, 0xa2, 0x5, 0xb5, 0x61, 0x95, 0x59, 0xca, 0xd0, 0xf9, 0xa9, 0x80, 0x85, 0x59, 
-0x4c, 0xc8, 0xd7, 0x20, 0x4, 0xd8, 0x20, 0x3d, 0xd8, 0xa2, 0x8, 0xb5, 0x5e, 0x95, 0x56, 0xca, 
-0xd0, 0xf9, 0x60, 0x20, 0x39, 0xd9, 0x4c, 0xbf, 0xd1, 0x20, 0xbf, 0xd1, 0x20, 0x4, 0xd8, 0xf0, 
-0xf1, 0x20, 0x86, 0xd6, 0xf0, 0xe3, 0xa5, 0x59, 0xc5, 0x61, 0xf0, 0x26, 0x90, 0xf, 0xe5, 0x61, 
-0xc9, 0x21, 0xb0, 0xde, 0xaa, 0x20, 0xfb, 0xd6, 0xca, 0xd0, 0xfa, 0xf0, 0x15, 0x38, 0xa5, 0x61, 
-0xe5, 0x59, 0xc9, 0x21, 0xb0, 0xc3, 0xaa, 0x18, 0x20, 0xd8, 0xd6, 0xca, 0xd0, 0xf9, 0xa5, 0x61, 
-0x85, 0x59, 0xa5, 0x57, 0x45, 0x5f, 0x10, 0x49, 0xa5, 0x5a, 0xc5, 0x62, 0xd0, 0x1b, 0xa5, 0x5b, 
-0xc5, 0x63, 0xd0, 0x15, 0xa5, 0x5c, 0xc5, 0x64, 0xd0, 0xf, 0xa5, 0x5d, 0xc5, 0x65, 0xd0, 0x9, 
-0xa5, 0x5e, 0xc5, 0x66, 0xd0, 0x3, 0x4c, 0xa4, 0xda, 0xb0, 0x2d, 0x38, 0xa5, 0x66, 0xe5, 0x5e, 
-0x85, 0x5e, 0xa5, 0x65, 0xe5, 0x5d, 0x85, 0x5d, 0xa5, 0x64, 0xe5, 0x5c, 0x85, 0x5c, 0xa5, 0x63, 
-0xe5, 0x5b, 0x85, 0x5b, 0xa5, 0x62, 0xe5, 0x5a, 0x85, 0x5a, 0xa5, 0x5f, 0x85, 0x57, 0x4c, 0x98, 
-0xda, 0x18, 0x20, 0xb4, 0xd6, 0x4c, 0x9b, 0xda, 0x38, 0xa5, 0x5e, 0xe5, 0x66, 0x85, 0x5e, 0xa5, 
-0x5d, 0xe5, 0x65, 0x85, 0x5d, 0xa5, 0x5c, 0xe5, 0x64, 0x85, 0x5c, 0xa5, 0x5b, 0xe5, 0x63, 0x85, 
-0x5b, 0xa5, 0x5a, 0xe5, 0x62, 0x85, 0x5a, 0x4c, 0x98, 0xda, 0x0, 0x20, 0xfc, 0xd0, 0xa9, 0xc7, 
-0x48, 0xa2, 0xc8, 0x4c, 0xb, 0xd1, 0xa9, 0x5d, 0xd0, 0x12, 0xa9, 0x66, 0xd0, 0xe, 0xa9, 0x6f, 
-0xd0, 0xa, 0xa9, 0x76, 0xd0, 0x6, 0xa9, 0x7d, 0xd0, 0x2, 0xa9, 0x84, 0x48, 0x20, 0x5d, 0xd8, 
-0x20, 0xfc, 0xd0, 0x20, 0x70, 0xd8, 0xe6, 0x4, 0x20, 0x4, 0xd8, 0xa5, 0x5f, 0x29, 0x80, 0x85, 
-0x5f, 0xa0, 0x0, 0xa5, 0x57, 0x29, 0x80, 0xc5, 0x5f, 0xd0, 0xd, 0xa2, 0x0, 0xb5, 0x61, 0xd5, 
-0x59, 0xd0, 0xa, 0xe8, 0xe0, 0x5, 0xd0, 0xf5, 0x8, 0xa6, 0x4, 0x28, 0x60, 0x6a, 0x45, 0x5f, 
-0x2a, 0xa9, 0x1, 0xd0, 0xf3, 0x20, 0x86, 0xd6, 0xf0, 0xf2, 0x20, 0x4, 0xd8, 0xd0, 0x3, 0x4c, 
-0xa4, 0xda, 0x18, 0xa5, 0x59, 0x65, 0x61, 0x85, 0x59, 0x90, 0x2, 0xe6, 0x58, 0x38, 0xa5, 0x59, 
-0xe9, 0x80, 0x85, 0x59, 0xb0, 0x2, 0xc6, 0x58, 0xa2, 0x5, 0xa0, 0x0, 0xb5, 0x59, 0x95, 0x66, 
-0x94, 0x59, 0xca, 0xd0, 0xf7, 0xa5, 0x57, 0x45, 0x5f, 0x85, 0x57, 0xa0, 0x20, 0x20, 0xfb, 0xd6, 
-0xa5, 0x67, 0x10, 0x4, 0x18, 0x20, 0x42, 0xd6, 0x20, 0xfb, 0xd6, 0x6, 0x6b, 0x26, 0x6a, 0x26, 
-0x69, 0x26, 0x68, 0x26, 0x67, 0x88, 0xd0, 0xe8, 0x20, 0xc8, 0xd7, 0x20, 0x80, 0xd8, 0xa5, 0x58, 
-0xf0, 0xb, 0x10, 0x3, 0xa2, 0x8, 0xa9, 0x0, 0x95, 0x56, 0xca, 0xd0, 0xfb, 0x60, 0x20, 0x31, 
-0xd8, 0x20, 0x8d, 0xde, 0xd0, 0x26, 0x20, 0x86, 0xd6, 0xf0, 0xec, 0x20, 0xc3, 0xd6, 0x20, 0xe5, 
-0xd1, 0xd0, 0x23, 0x60, 0x20, 0xeb, 0xd0, 0x20, 0x9e, 0xdb, 0x20, 0x3d, 0xd8, 0x20, 0xe6, 0xdc, 
-0x20, 0x9e, 0xdb, 0x20, 0x23, 0xd9, 0x20, 0xf1, 0xdc, 0x20, 0x9e, 0xdb, 0x20, 0x86, 0xd6, 0xf0, 
-0xcc, 0x20, 0x4, 0xd8, 0xf0, 0xc1, 0xa5, 0x57, 0x45, 0x5f, 0x85, 0x57, 0x38, 0xa5, 0x59, 0xe5, 
-0x61, 0x85, 0x59, 0xb0, 0x2, 0xc6, 0x58, 0x18, 0xa5, 0x59, 0x69, 0x81, 0x85, 0x59, 0x90, 0x2, 
-0xe6, 0x58, 0xa2, 0x5, 0xb5, 0x59, 0x95, 0x66, 0xca, 0xd0, 0xf9, 0x46, 0x67, 0x66, 0x68, 0x66, 
-0x69, 0x66, 0x6a, 0x66, 0x6b, 0x20, 0xfb, 0xd6, 0xa2, 0x27, 0xa5, 0x67, 0xc5, 0x62, 0xd0, 0x16, 
-0xa5, 0x68, 0xc5, 0x63, 0xd0, 0x10, 0xa5, 0x69, 0xc5, 0x64, 0xd0, 0xa, 0xa5, 0x6a, 0xc5, 0x65, 
-0xd0, 0x4, 0xa5, 0x6b, 0xc5, 0x66, 0x90, 0x24, 0xa5, 0x6b, 0xe5, 0x66, 0x85, 0x6b, 0xa5, 0x6a, 
-0xe5, 0x65, 0x85, 0x6a, 0xa5, 0x69, 0xe5, 0x64, 0x85, 0x69, 0xa5, 0x68, 0xe5, 0x63, 0x85, 0x68, 
-0xa5, 0x67, 0xe5, 0x62, 0x85, 0x67, 0xa5, 0x5e, 0x9, 0x1, 0x85, 0x5e, 0x20, 0xcd, 0xd6, 0x6, 
-0x6b, 0x26, 0x6a, 0x26, 0x69, 0x26, 0x68, 0x26, 0x67, 0xca, 0xd0, 0xae, 0x4c, 0x98, 0xda, 0x20, 
-0xeb, 0xd0, 0x20, 0x86, 0xd6, 0xf0, 0x26, 0x10, 0x1, 0x0, 0x20, 0x31, 0xd8, 0xa5, 0x59, 0x4a, 
-0x69, 0x40, 0x85, 0x59, 0xa9, 0x5, 0x85, 0x6e, 0x20, 0x27, 0xd8, 0x20, 0xaa, 0xdb, 0x20, 0xb6, 
-0xda, 0x20, 0xa2, 0xdb, 0x20, 0x3c, 0xd9, 0xc6, 0x59, 0xc6, 0x6e, 0xd0, 0xeb, 0x60, 0xa9, 0xd4, 
-0xd0, 0xa, 0xa9, 0xca, 0xd0, 0x6, 0xa9, 0xcf, 0xd0, 0x2, 0xa9, 0xc5, 0x85, 0x6f, 0xa9, 0x3, 
-0x85, 0x70, 0x60, 0x20, 0xeb, 0xd0, 0x20, 0x86, 0xd6, 0xf0, 0x2, 0x10, 0x1, 0x0, 0xa5, 0x59, 
-0x48, 0xa9, 0x81, 0x85, 0x59, 0x20, 0xc7, 0xd8, 0xa9, 0xc0, 0x85, 0x62, 0xa9, 0x81, 0x85, 0x61, 
-0x85, 0x5f, 0x20, 0x41, 0xd9, 0xe6, 0x59, 0xa9, 0xfe, 0xa0, 0xdb, 0x20, 0x27, 0xdc, 0x20, 0x31, 
-0xd8, 0x68, 0x38, 0xe9, 0x81, 0x20, 0xb2, 0xd7, 0xa9, 0xf9, 0x85, 0x6f, 0xa9, 0xdb, 0x85, 0x70, 
-0x20, 0x45, 0xda, 0x20, 0xaa, 0xdb, 0x4c, 0x3c, 0xd9, 0x80, 0x31, 0x72, 0x17, 0xf8, 0x7, 0x85, 
-0x17, 0x6e, 0xd4, 0x85, 0x80, 0x28, 0xc7, 0x12, 0xa0, 0x84, 0x70, 0x4e, 0x5f, 0xf2, 0x81, 0x0, 
-0x0, 0xfe, 0xef, 0x84, 0xf, 0xff, 0xda, 0xe1, 0x81, 0x7f, 0xff, 0xff, 0x93, 0x82, 0x40, 0x0, 
-0x0, 0xc, 0x7f, 0x4f, 0x99, 0x1f, 0x65, 0x85, 0x71, 0x84, 0x72, 0x20, 0x31, 0xd8, 0xa0, 0x0, 
-0xb1, 0x71, 0x85, 0x6c, 0xe6, 0x71, 0xd0, 0x2, 0xe6, 0x72, 0xa5, 0x71, 0x85, 0x6f, 0xa5, 0x72, 
-0x85, 0x70, 0x20, 0xe5, 0xd1, 0x20, 0xaa, 0xdb, 0x20, 0xb6, 0xda, 0x18, 0xa5, 0x71, 0x69, 0x5, 
-0x85, 0x71, 0x85, 0x6f, 0xa5, 0x72, 0x69, 0x0, 0x85, 0x72, 0x85, 0x70, 0x20, 0x3c, 0xd9, 0xc6, 
-0x6c, 0xd0, 0xe2, 0x60, 0x20, 0xeb, 0xd0, 0x20, 0x86, 0xd6, 0xf0, 0xd, 0x10, 0xc, 0xa9, 0x0, 
-0x85, 0x57, 0x20, 0x7a, 0xdc, 0xa9, 0x80, 0x85, 0x57, 0x60, 0xa5, 0x59, 0xc9, 0x81, 0x90, 0xc, 
-0x20, 0xae, 0xda, 0x20, 0x8c, 0xdc, 0x20, 0x93, 0xdd, 0x4c, 0x39, 0xd9, 0xa5, 0x59, 0xc9, 0x73, 
-0x90, 0xe7, 0x20, 0x2c, 0xd8, 0x20, 0xc7, 0xd8, 0xa9, 0x80, 0x85, 0x61, 0x85, 0x62, 0x85, 0x5f, 
-0x20, 0x41, 0xd9, 0xa9, 0xb0, 0xa0, 0xdc, 0x20, 0x27, 0xdc, 0x20, 0xa6, 0xdb, 0x4c, 0x45, 0xda, 
-0x9, 0x85, 0xa3, 0x59, 0xe8, 0x67, 0x80, 0x1c, 0x9d, 0x7, 0x36, 0x80, 0x57, 0xbb, 0x78, 0xdf, 
-0x80, 0xca, 0x9a, 0xe, 0x83, 0x84, 0x8c, 0xbb, 0xca, 0x6e, 0x81, 0x95, 0x96, 0x6, 0xde, 0x81, 
-0xa, 0xc7, 0x6c, 0x52, 0x7f, 0x7d, 0xad, 0x90, 0xa1, 0x82, 0xfb, 0x62, 0x57, 0x2f, 0x80, 0x6d, 
-0x63, 0x38, 0x2c, 0x20, 0xeb, 0xd0, 0x20, 0x24, 0xdd, 0xe6, 0x6e, 0x4c, 0xf4, 0xdc, 0x20, 0xeb, 
-0xd0, 0x20, 0x24, 0xdd, 0x46, 0x6e, 0x90, 0x3, 0x20, 0x86, 0xdc, 0x46, 0x6e, 0x90, 0x6, 0x20, 
-0x5, 0xdd, 0x4c, 0xbf, 0xd1, 0x20, 0x2c, 0xd8, 0x20, 0x93, 0xdd, 0x20, 0x4, 0xd8, 0xc6, 0x61, 
-0xa9, 0x80, 0x85, 0x5f, 0x20, 0x41, 0xd9, 0xa9, 0xa6, 0xa0, 0xdd, 0x20, 0x27, 0xdc, 0x20, 0xa6, 
-0xdb, 0x4c, 0x45, 0xda, 0xa5, 0x59, 0xc9, 0x98, 0xb0, 0x54, 0x20, 0x31, 0xd8, 0x20, 0x93, 0xdd, 
-0x20, 0xdc, 0xda, 0x20, 0x9a, 0xd8, 0xa5, 0x5d, 0x85, 0x6e, 0x5, 0x5c, 0x5, 0x5b, 0x5, 0x5a, 
-0xf0, 0x3e, 0x20, 0xac, 0xd2, 0x20, 0x27, 0xd8, 0x20, 0x86, 0xdd, 0x20, 0x45, 0xda, 0x20, 0xaa, 
-0xdb, 0x20, 0x3c, 0xd9, 0x20, 0x3d, 0xd8, 0x20, 0xa2, 0xdb, 0x20, 0xe5, 0xd1, 0x20, 0x8a, 0xdd, 
-0x20, 0x45, 0xda, 0x20, 0xaa, 0xdb, 0x20, 0x3c, 0xd9, 0xa5, 0x57, 0x10, 0x12, 0x20, 0x8a, 0xdd, 
-0x20, 0x33, 0xd9, 0x20, 0x86, 0xdd, 0x20, 0x33, 0xd9, 0xc6, 0x6e, 0x4c, 0x69, 0xdd, 0x0, 0x60, 
-0x20, 0xda, 0xd2, 0x4c, 0x69, 0xdd, 0xa9, 0x97, 0xd0, 0x2, 0xa9, 0x9c, 0x85, 0x6f, 0xa9, 0xdd, 
-0x85, 0x70, 0x60, 0xa9, 0xa1, 0xd0, 0xf5, 0x81, 0xc9, 0x0, 0x0, 0x0, 0x75, 0xfd, 0xaa, 0x22, 
-0x17, 0x81, 0x49, 0xf, 0xda, 0xa2, 0x8, 0x84, 0x4, 0xc7, 0x3c, 0xfb, 0x81, 0xe0, 0x4f, 0x5d, 
-0xad, 0x82, 0x80, 0x0, 0x69, 0xb8, 0x82, 0x5b, 0xcf, 0x1d, 0xb5, 0x82, 0xbf, 0xce, 0x82, 0x1e, 
-0x82, 0x45, 0x44, 0x7f, 0x32, 0x7f, 0x62, 0x44, 0x5a, 0xd2, 0x83, 0x82, 0x14, 0x8a, 0x27, 0x80, 
-0x66, 0x7b, 0x21, 0x4d, 0x20, 0xeb, 0xd0, 0xa5, 0x59, 0xc9, 0x87, 0x90, 0x10, 0xd0, 0x6, 0xa5, 
-0x5a, 0xc9, 0xb3, 0x90, 0x8, 0xa5, 0x57, 0x10, 0x3, 0x4c, 0xa4, 0xda, 0x0, 0xa5, 0x59, 0xc9, 
-0x80, 0x90, 0x29, 0x20, 0x9a, 0xd8, 0x20, 0xe2, 0xd8, 0xa5, 0x5d, 0x85, 0x6e, 0x20, 0x13, 0xd9, 
-0x20, 0x1c, 0xde, 0x20, 0x2c, 0xd8, 0xa9, 0x23, 0x85, 0x6f, 0xa9, 0xde, 0x85, 0x70, 0x20, 0xe5, 
-0xd1, 0xa5, 0x6e, 0x20, 0x51, 0xde, 0x20, 0xa6, 0xdb, 0x4c, 0x45, 0xda, 0xa9, 0x28, 0xa0, 0xde, 
-0x4c, 0x27, 0xdc, 0x82, 0x2d, 0xf8, 0x54, 0x58, 0x7, 0x83, 0xe0, 0x20, 0x86, 0x5b, 0x82, 0x80, 
-0x53, 0x93, 0xb8, 0x83, 0x20, 0x0, 0x6, 0xa1, 0x82, 0x0, 0x0, 0x21, 0x63, 0x82, 0xc0, 0x0, 
-0x0, 0x2, 0x82, 0x80, 0x0, 0x0, 0xc, 0x81, 0x0, 0x0, 0x0, 0x0, 0x81, 0x0, 0x0, 0x0, 
-0x0, 0xaa, 0x10, 0x9, 0xca, 0x8a, 0x49, 0xff, 0x48, 0x20, 0xae, 0xda, 0x68, 0x48, 0x20, 0x31, 
-0xd8, 0x20, 0x8d, 0xde, 0x68, 0xf0, 0xa, 0x38, 0xe9, 0x1, 0x48, 0x20, 0x45, 0xda, 0x4c, 0x64, 
-0xde, 0x60, 0x20, 0xeb, 0xd0, 0xa5, 0x57, 0x10, 0xa, 0xa9, 0x0, 0x85, 0x57, 0x20, 0x83, 0xde, 
-0x4c, 0xbf, 0xd1, 0xa5, 0x59, 0xc9, 0x81, 0x90, 0x33, 0xc9, 0x85, 0x90, 0xb, 0x20, 0xa4, 0xda, 
-0xa0, 0x80, 0x84, 0x5a, 0xc8, 0x84, 0x59, 0x60, 0xe6, 0x59, 0xa9, 0x80, 0x85, 0x57, 0x20, 0xd7, 
-0xdd, 0x20, 0x31, 0xd8, 0x20, 0x8d, 0xde, 0x20, 0x3c, 0xd9, 0x20, 0x27, 0xd8, 0x20, 0x8d, 0xde, 
-0x20, 0xaa, 0xdb, 0x20, 0x33, 0xd9, 0x20, 0xa2, 0xdb, 0x4c, 0xdc, 0xda, 0x20, 0x2c, 0xd8, 0x20, 
-0x8d, 0xde, 0xc6, 0x59, 0x20, 0x33, 0xd9, 0xa9, 0xd4, 0xa0, 0xde, 0x20, 0x27, 0xdc, 0x20, 0xa6, 
-0xdb, 0x4c, 0x45, 0xda, 0x8, 0x7e, 0x85, 0x51, 0xb3, 0xc, 0x86, 0xde, 0xb0, 0x7d, 0x73, 0x7c, 
-0x23, 0xd8, 0xe9, 0x9a, 0x87, 0x34, 0x82, 0x1d, 0x80, 0x81, 0x9a, 0x20, 0x6c, 0xed, 0x81, 0xbd, 
-0x32, 0x34, 0x2e, 0x7f, 0x5d, 0x46, 0x87, 0xb4, 0x82, 0x68, 0x3e, 0x43, 0xf7, 0x80, 0x6c, 0x9a, 
-0x9e, 0xbb, 0x20, 0xc8, 0xc3, 0xa5, 0x52, 0x29, 0x3, 0xa8, 0xb9, 0x4e, 0xdf, 0x8d, 0xfd, 0x3, 
-0xad, 0x0, 0xb0, 0x29, 0xf0, 0xc9, 0x70, 0xd0, 0xc, 0xa9, 0x0, 0xa8, 0x99, 0x0, 0x86, 0x99, 
-0x0, 0x87, 0x88, 0xd0, 0xf7, 0xad, 0x0, 0xb0, 0x29, 0xdf, 0x8d, 0x0, 0xb0, 0x2a, 0x2a, 0x2a, 
-0x29, 0x3, 0xa8, 0xb9, 0x42, 0xdf, 0x8d, 0xfe, 0x3, 0xb9, 0x46, 0xdf, 0x8d, 0xff, 0x3, 0x4c, 
-0x58, 0xc5, 0x52, 0x70, 0x88, 0xa0, 0xdf, 0xdf, 0xdf, 0xdf, 0x3f, 0xcf, 0xf3, 0xfc, 0x0, 0x55, 
-0xaa, 0xff, 0xa5, 0x5b, 0x5, 0x5d, 0xd0, 0x47, 0xa5, 0x5a, 0xc9, 0x40, 0xb0, 0x41, 0x4a, 0x4a, 
-0x85, 0x5f, 0xa0, 0x0, 0x84, 0x60, 0xa9, 0x3f, 0x38, 0xe5, 0x5c, 0xc9, 0x40, 0x90, 0x4f, 0x60, 
-0xa5, 0x5b, 0x5, 0x5d, 0xd0, 0x29, 0xa5, 0x5a, 0x30, 0x25, 0x4a, 0x4a, 0x85, 0x5f, 0xa9, 0x3f, 
-0x38, 0xe5, 0x5c, 0xc9, 0x40, 0x90, 0x30, 0x60, 0xa5, 0x5b, 0x5, 0x5d, 0xd0, 0x11, 0xa5, 0x5a, 
-0x30, 0xd, 0x4a, 0x4a, 0x85, 0x5f, 0xa9, 0x5f, 0x38, 0xe5, 0x5c, 0xc9, 0x60, 0x90, 0x18, 0x60, 
-0xa5, 0x5b, 0x5, 0x5d, 0xd0, 0xf9, 0xa5, 0x5a, 0x30, 0xf5, 0x4a, 0x4a, 0x85, 0x5f, 0xa9, 0xbf, 
-0x38, 0xe5, 0x5c, 0xc9, 0xc0, 0xb0, 0xe8, 0xa0, 0x0, 0x84, 0x60, 0xa, 0x26, 0x60, 0xa, 0x26, 
-0x60, 0xa, 0x26, 0x60, 0xa, 0x26, 0x60, 0xa, 0x26, 0x60, 0x65, 0x5f, 0x85, 0x5f, 0xa5, 0x60, 
-0x69, 0x80, 0x85, 0x60, 0xa5, 0x5a, 0x29, 0x3, 0xaa, 0xbd, 0x4a, 0xdf, 0xa6, 0x5e, 0xca, 0xf0, 
-0xf, 0xca, 0xf0, 0x5, 0x31, 0x5f, 0x91, 0x5f, 0x60, 0x49, 0xff, 0x51, 0x5f, 0x91, 0x5f, 0x60, 
-0xaa, 0x31, 0x5f, 0x91, 0x5f, 0x8a, 0x49, 0xff, 0x2d, 0xfd, 0x3, 0x11, 0x5f, 0x91, 0x5f, 0x60, 
-
-};
-unsigned char dump_dosrom[4096] = {
-0xa9, 0x1, 0x8d, 0x2, 0xa, 0xa9, 0x0, 0x8d, 0x2, 0xa, 0x4c, 0xe2, 0xee, 0x20, 0x16, 0xe0, 
-0x44, 0x49, 0x53, 0x4b, 0x20, 0xea, 0x68, 0x85, 0xea, 0x68, 0x85, 0xeb, 0xa0, 0x0, 0xe6, 0xea, 
-0xd0, 0x2, 0xe6, 0xeb, 0xb1, 0xea, 0x30, 0x8, 0xf0, 0x6, 0x20, 0xf4, 0xff, 0x4c, 0x1e, 0xe0, 
-0x6c, 0xea, 0x0, 0x84, 0xe9, 0x20, 0x41, 0xe0, 0x20, 0xc9, 0xe5, 0xa4, 0xe9, 0xa2, 0x0, 0xf0, 
-0x2, 0xa2, 0x40, 0x20, 0x76, 0xf8, 0x86, 0x9a, 0xc9, 0x22, 0xf0, 0x43, 0xc9, 0xd, 0xf0, 0xc, 
-0x9d, 0x0, 0x1, 0xe8, 0xc8, 0xb9, 0x0, 0x1, 0xc9, 0x20, 0xd0, 0xf0, 0xa9, 0xd, 0x9d, 0x0, 
-0x1, 0xa9, 0x1, 0x85, 0x9b, 0xa2, 0x9a, 0x60, 0xa0, 0x0, 0xb5, 0x0, 0x99, 0x9a, 0x0, 0xe8, 
-0xc8, 0xc0, 0xa, 0x90, 0xf5, 0xa9, 0x20, 0xa0, 0x6, 0x99, 0xa5, 0x0, 0x88, 0x10, 0xfa, 0xc8, 
-0xb1, 0x9a, 0xc9, 0xd, 0xf0, 0xe1, 0xc0, 0x7, 0xb0, 0x21, 0x99, 0xa5, 0x0, 0xd0, 0xf0, 0xc8, 
-0xb9, 0x0, 0x1, 0xc9, 0xd, 0xf0, 0x14, 0x9d, 0x0, 0x1, 0xe8, 0xc9, 0x22, 0xd0, 0xf0, 0xca, 
-0xc8, 0xb9, 0x0, 0x1, 0xc9, 0x22, 0xd0, 0xb4, 0xe8, 0xb0, 0xe4, 0x20, 0x16, 0xe0, 0x4e, 0x41, 
-0x4d, 0x45, 0x3f, 0x0, 0xa2, 0x9c, 0xa9, 0x0, 0x95, 0x0, 0x95, 0x1, 0x95, 0x2, 0x20, 0x76, 
-0xf8, 0xb9, 0x0, 0x1, 0xc9, 0x30, 0x90, 0x21, 0xc9, 0x3a, 0x90, 0x8, 0xe9, 0x7, 0x90, 0x19, 
-0xc9, 0x40, 0xb0, 0x15, 0xa, 0xa, 0xa, 0xa, 0x94, 0x2, 0xa0, 0x4, 0xa, 0x36, 0x0, 0x36, 
-0x1, 0x88, 0xd0, 0xf8, 0xb4, 0x2, 0xc8, 0xd0, 0xd8, 0xb5, 0x2, 0x60, 0xa9, 0x20, 0x4c, 0xf4, 
-0xff, 0xa0, 0x6, 0x20, 0xec, 0xe0, 0x88, 0xd0, 0xfa, 0x60, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x60, 
-0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0x60, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-0x88, 0x60, 0xa5, 0x9c, 0x38, 0xe9, 0x1, 0x85, 0xc9, 0xa5, 0x9d, 0xe9, 0x0, 0x85, 0xca, 0xa9, 
-0xff, 0x85, 0xec, 0x18, 0x65, 0xa0, 0xa5, 0xa1, 0x69, 0x0, 0x85, 0xcb, 0xa5, 0xa2, 0x20, 0xfb, 
-0xe0, 0x85, 0xcc, 0xa5, 0xa2, 0x29, 0xf, 0xaa, 0xa5, 0xa3, 0x38, 0xe6, 0xec, 0xe9, 0xa, 0xb0, 
-0xfa, 0xca, 0x10, 0xf6, 0x69, 0xa, 0x85, 0xed, 0x60, 0x20, 0xc9, 0xe5, 0x20, 0x68, 0xe0, 0x20, 
-0x5d, 0xe1, 0xb0, 0xf4, 0x20, 0x16, 0xe0, 0x46, 0x49, 0x4c, 0x45, 0x3f, 0x0, 0x20, 0x23, 0xe2, 
-0xa0, 0xf8, 0x20, 0x0, 0xe1, 0xcc, 0x5, 0x21, 0xb0, 0x20, 0xb9, 0xf, 0x20, 0x29, 0x7f, 0xc5, 
-0xac, 0xd0, 0xef, 0x20, 0x1, 0xe1, 0xa2, 0x6, 0xb9, 0x7, 0x20, 0xd5, 0xa5, 0xd0, 0x5, 0x88, 
-0xca, 0x10, 0xf5, 0x60, 0x88, 0xca, 0x10, 0xfc, 0x30, 0xd8, 0x18, 0x60, 0xb9, 0xf, 0x20, 0x30, 
-0x19, 0xb9, 0x10, 0x20, 0x99, 0x8, 0x20, 0xb9, 0x10, 0x21, 0x99, 0x8, 0x21, 0xc8, 0xcc, 0x5, 
-0x21, 0x90, 0xee, 0x98, 0xe9, 0x8, 0x8d, 0x5, 0x21, 0x60, 0x20, 0x16, 0xe0, 0x50, 0x52, 0x4f, 
-0x54, 0x0, 0x20, 0x49, 0xe1, 0x20, 0xbf, 0xe1, 0x4c, 0x60, 0xe4, 0xa5, 0xef, 0xd0, 0x71, 0xb9, 
-0xf, 0x20, 0x29, 0x7f, 0x20, 0xf4, 0xff, 0x20, 0xec, 0xe0, 0xbe, 0xf, 0x20, 0x10, 0x2, 0xa9, 
-0x23, 0x20, 0xf4, 0xff, 0xa2, 0x7, 0xb9, 0x8, 0x20, 0x20, 0xf4, 0xff, 0xc8, 0xca, 0xd0, 0xf6, 
-0x20, 0xec, 0xe0, 0xb9, 0x2, 0x21, 0x20, 0x2, 0xf8, 0xb9, 0x1, 0x21, 0x20, 0x2, 0xf8, 0xc8, 
-0xe8, 0xc8, 0xe0, 0x2, 0x90, 0xea, 0x20, 0xec, 0xe0, 0x20, 0xec, 0xe0, 0xb9, 0x3, 0x21, 0x20, 
-0xfb, 0xe0, 0x20, 0xb, 0xf8, 0xb9, 0x2, 0x21, 0x20, 0x2, 0xf8, 0xb9, 0x1, 0x21, 0x20, 0x2, 
-0xf8, 0x20, 0xec, 0xe0, 0xb9, 0x3, 0x21, 0x20, 0xb, 0xf8, 0xb9, 0x4, 0x21, 0x20, 0x2, 0xf8, 
-0x20, 0xed, 0xff, 0x20, 0x31, 0xe7, 0x2c, 0x0, 0xa, 0x30, 0xfb, 0x2c, 0x0, 0xa, 0x30, 0xf6, 
-0x60, 0x20, 0x2a, 0xe4, 0x4c, 0x23, 0xe2, 0x20, 0x31, 0xe2, 0xa2, 0x0, 0x86, 0xb6, 0xbd, 0x0, 
-0x20, 0xe0, 0x8, 0x90, 0x3, 0xbd, 0xf8, 0x20, 0x20, 0xf4, 0xff, 0xe8, 0xe0, 0xd, 0xd0, 0xee, 
-0x20, 0x16, 0xe0, 0x20, 0x44, 0x52, 0x49, 0x56, 0x45, 0x20, 0xa5, 0xee, 0x20, 0xb, 0xf8, 0x20, 
-0x16, 0xe0, 0x20, 0x51, 0x55, 0x41, 0x4c, 0x20, 0xa5, 0xac, 0x20, 0xf4, 0xff, 0xa0, 0x0, 0x20, 
-0x88, 0xe2, 0x90, 0x4a, 0x20, 0x9, 0xe1, 0xb9, 0x8, 0x20, 0x29, 0x7f, 0x99, 0x8, 0x20, 0x98, 
-0xd0, 0xf2, 0x4c, 0xed, 0xff, 0x20, 0x0, 0xe1, 0xcc, 0x5, 0x21, 0xb0, 0x5, 0xb9, 0x8, 0x20, 
-0x30, 0xf3, 0x60, 0xa4, 0xb8, 0xf0, 0x5, 0x20, 0xed, 0xff, 0xa0, 0xff, 0xc8, 0x84, 0xb8, 0x20, 
-0xf1, 0xe0, 0xa9, 0x23, 0xa4, 0xb7, 0xbe, 0xf, 0x20, 0x30, 0x2, 0xa9, 0x20, 0x20, 0xf4, 0xff, 
-0xa2, 0x0, 0xb5, 0xae, 0x20, 0xf4, 0xff, 0xe8, 0xe0, 0x7, 0xd0, 0xf6, 0xf0, 0xaf, 0x84, 0xb7, 
-0xa2, 0x0, 0xb9, 0x8, 0x20, 0x29, 0x7f, 0x95, 0xae, 0xc8, 0xe8, 0xe0, 0x8, 0xd0, 0xf3, 0x20, 
-0x88, 0xe2, 0xb0, 0x1d, 0xa2, 0x6, 0x38, 0xb9, 0xe, 0x20, 0xf5, 0xae, 0x88, 0xca, 0x10, 0xf7, 
-0x20, 0x1, 0xe1, 0xb9, 0xf, 0x20, 0x29, 0x7f, 0xe5, 0xb5, 0x90, 0xd2, 0x20, 0x0, 0xe1, 0xb0, 
-0xde, 0xa4, 0xb7, 0xb9, 0x8, 0x20, 0x9, 0x80, 0x99, 0x8, 0x20, 0xa5, 0xb5, 0xc5, 0xb6, 0xf0, 
-0x92, 0x85, 0xb6, 0x20, 0xed, 0xff, 0xa5, 0xb5, 0x20, 0xf4, 0xff, 0xa9, 0x3a, 0x20, 0xf4, 0xff, 
-0xa0, 0x4, 0x20, 0xf3, 0xe0, 0x84, 0xb8, 0xf0, 0x89, 0xb9, 0xe, 0x21, 0x20, 0xfb, 0xe0, 0x85, 
-0xa2, 0x18, 0xa9, 0xff, 0x79, 0xc, 0x21, 0xb9, 0xf, 0x21, 0x79, 0xd, 0x21, 0x85, 0xa3, 0xb9, 
-0xe, 0x21, 0x29, 0xf, 0x65, 0xa2, 0x85, 0xa2, 0x38, 0xb9, 0x7, 0x21, 0xe5, 0xa3, 0x48, 0xb9, 
-0x6, 0x21, 0x29, 0xf, 0xe5, 0xa2, 0xaa, 0xa9, 0x0, 0xc5, 0xa0, 0x68, 0xe5, 0xa1, 0x8a, 0xe9, 
-0x0, 0x60, 0xa2, 0x2, 0xd0, 0x2, 0xa2, 0x0, 0x84, 0xbf, 0xbc, 0x8, 0x2, 0xb5, 0xbb, 0x94, 
-0xbb, 0x9d, 0x8, 0x2, 0xe8, 0x8a, 0x4a, 0xb0, 0xf1, 0xa4, 0xbf, 0x60, 0x43, 0x41, 0x54, 0xe2, 
-0x37, 0x44, 0x49, 0x52, 0xe2, 0x31, 0x49, 0x4e, 0x46, 0x4f, 0xe1, 0xb2, 0x4c, 0x4f, 0x41, 0x44, 
-0xe4, 0x65, 0x53, 0x41, 0x56, 0x45, 0xe5, 0xe6, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0xe4, 0x1a, 
-0x52, 0x55, 0x4e, 0xe5, 0xa, 0x4c, 0x4f, 0x43, 0x4b, 0xe5, 0x99, 0x55, 0x4e, 0x4c, 0x4f, 0x43, 
-0x4b, 0xe5, 0x9a, 0x4d, 0x4f, 0x4e, 0xe4, 0x5b, 0x4e, 0x4f, 0x4d, 0x4f, 0x4e, 0xe4, 0x59, 0x53, 
-0x45, 0x54, 0xe5, 0x72, 0x44, 0x52, 0x49, 0x56, 0x45, 0xe4, 0x2a, 0x54, 0x49, 0x54, 0x4c, 0x45, 
-0xe5, 0x78, 0x55, 0x53, 0x45, 0xe5, 0xaf, 0x45, 0x58, 0x45, 0x43, 0xe5, 0x19, 0x53, 0x48, 0x55, 
-0x54, 0xe8, 0x9c, 0x47, 0x4f, 0xe5, 0x65, 0x53, 0x50, 0x4f, 0x4f, 0x4c, 0xe5, 0x47, 0x56, 0x44, 
-0x55, 0xe6, 0xb8, 0xe4, 0xc5, 0xa2, 0xff, 0xd8, 0xa0, 0x0, 0x20, 0x76, 0xf8, 0x88, 0xc8, 0xe8, 
-0xbd, 0x6c, 0xe3, 0x30, 0x18, 0xd9, 0x0, 0x1, 0xf0, 0xf4, 0xca, 0xe8, 0xbd, 0x6c, 0xe3, 0x10, 
-0xfa, 0xe8, 0xb9, 0x0, 0x1, 0xc9, 0x2e, 0xd0, 0xdf, 0xc8, 0xca, 0xb0, 0xe3, 0x85, 0x9b, 0xbd, 
-0x6d, 0xe3, 0x85, 0x9a, 0x18, 0xa2, 0x0, 0x6c, 0x9a, 0x0, 0x20, 0x49, 0xe1, 0x84, 0x9a, 0x20, 
-0xbb, 0xe1, 0xa4, 0x9a, 0x20, 0x8c, 0xe1, 0x4c, 0xa9, 0xe5, 0x20, 0x76, 0xf8, 0xc9, 0xd, 0xf0, 
-0x1d, 0xc8, 0x48, 0x20, 0xcc, 0xe5, 0x68, 0xc9, 0x30, 0x90, 0x14, 0xc9, 0x34, 0xb0, 0x10, 0x29, 
-0x3, 0x45, 0xee, 0x20, 0x26, 0xe2, 0xc9, 0x80, 0xf0, 0x4, 0x45, 0xee, 0x85, 0xee, 0x60, 0x20, 
-0x16, 0xe0, 0x44, 0x52, 0x49, 0x56, 0x45, 0x3f, 0x0, 0xa2, 0xff, 0x20, 0xcc, 0xe5, 0x86, 0xef, 
-0xa5, 0xcd, 0x85, 0xac, 0x60, 0x20, 0x41, 0xe0, 0x20, 0xb4, 0xe0, 0xf0, 0x4, 0xa9, 0xff, 0x85, 
-0x9e, 0xa2, 0x9a, 0x18, 0x6c, 0xc, 0x2, 0x8, 0x20, 0x84, 0xe4, 0x28, 0x90, 0x3, 0x20, 0x26, 
-0xe2, 0x4c, 0x60, 0xe4, 0x20, 0x4c, 0xe1, 0x84, 0x9a, 0xa2, 0x0, 0xa5, 0x9e, 0x10, 0x4, 0xa2, 
-0x2, 0xc8, 0xc8, 0xb9, 0x8, 0x21, 0x95, 0x9c, 0xc8, 0xe8, 0xe0, 0x8, 0xd0, 0xf5, 0xa4, 0x9a, 
-0x20, 0xbb, 0xe1, 0x20, 0x92, 0xe7, 0xa9, 0x53, 0x85, 0xad, 0x20, 0x12, 0xe1, 0x20, 0x16, 0xe8, 
-0xf0, 0x12, 0x20, 0x46, 0xe8, 0xa5, 0xad, 0x20, 0xed, 0xe7, 0x20, 0xa4, 0xe7, 0xd0, 0xf3, 0x20, 
-0x39, 0xe8, 0xd0, 0xe9, 0x60, 0x20, 0x33, 0xe0, 0xa5, 0xee, 0x85, 0xc7, 0xa5, 0xac, 0x85, 0xc8, 
-0xa9, 0x20, 0x85, 0xac, 0xa9, 0x0, 0x85, 0x9e, 0x20, 0x3f, 0xe4, 0xa2, 0x9a, 0x20, 0x68, 0xe0, 
-0x20, 0x5d, 0xe1, 0xb0, 0xf, 0x20, 0x0, 0xe5, 0x20, 0x16, 0xe0, 0x43, 0x4f, 0x4d, 0x4d, 0x41, 
-0x4e, 0x44, 0x3f, 0x0, 0x20, 0x87, 0xe4, 0x20, 0x26, 0xe2, 0x20, 0x0, 0xe5, 0x6c, 0x9e, 0x0, 
-0xa5, 0xc7, 0x20, 0x3f, 0xe4, 0xa5, 0xc8, 0x85, 0xac, 0x60, 0x20, 0x33, 0xe0, 0x20, 0x6f, 0xe4, 
-0x20, 0x26, 0xe2, 0x6c, 0x9e, 0x0, 0x4c, 0x54, 0xe1, 0x20, 0xc9, 0xe5, 0x20, 0xce, 0xff, 0xa8, 
-0xf0, 0xf4, 0x85, 0xb9, 0x20, 0x52, 0xe3, 0xa9, 0x33, 0xa0, 0xe5, 0x9d, 0x6, 0x2, 0x98, 0x9d, 
-0x7, 0x2, 0x60, 0x84, 0xe9, 0xa4, 0xb9, 0x20, 0xd4, 0xff, 0x90, 0x8, 0x20, 0xcb, 0xff, 0xa4, 
-0xe9, 0x6c, 0xa, 0x2, 0xa4, 0xe9, 0x60, 0x20, 0xc9, 0xe5, 0x18, 0x20, 0xce, 0xff, 0x85, 0xba, 
-0x20, 0x56, 0xe3, 0xa9, 0x59, 0xa0, 0xe5, 0xd0, 0xd2, 0x84, 0xe9, 0xa4, 0xba, 0x20, 0xd1, 0xff, 
-0xa4, 0xe9, 0x6c, 0xbb, 0x0, 0x20, 0xb4, 0xe0, 0x8, 0x20, 0xcc, 0xe5, 0x28, 0xf0, 0xa1, 0x6c, 
-0x9c, 0x0, 0x20, 0xb3, 0xe5, 0x85, 0xcd, 0x60, 0x20, 0x41, 0xe0, 0x20, 0x31, 0xe2, 0xa2, 0xc, 
-0xa9, 0x20, 0x20, 0xbd, 0xe5, 0xca, 0x10, 0xfa, 0xe8, 0xbd, 0x40, 0x1, 0xc9, 0xd, 0xf0, 0x19, 
-0x20, 0xbd, 0xe5, 0xe0, 0xc, 0x90, 0xf1, 0xb0, 0x10, 0x38, 0x8, 0x20, 0x49, 0xe1, 0xa5, 0xac, 
-0x2a, 0x28, 0x6a, 0x99, 0xf, 0x20, 0x20, 0xbb, 0xe1, 0x20, 0x4a, 0xe7, 0x4c, 0x60, 0xe4, 0xa5, 
-0xac, 0x85, 0xcd, 0xc8, 0x20, 0xcc, 0xe5, 0xb9, 0xff, 0x0, 0x85, 0xac, 0x60, 0xe0, 0x8, 0x90, 
-0x4, 0x9d, 0xf8, 0x20, 0x60, 0x9d, 0x0, 0x20, 0x60, 0x20, 0x41, 0xe0, 0x20, 0x76, 0xf8, 0xc9, 
-0xd, 0xf0, 0xf5, 0x20, 0x16, 0xe0, 0x53, 0x59, 0x4e, 0x54, 0x41, 0x58, 0x3f, 0x0, 0x20, 0x16, 
-0xe0, 0x46, 0x55, 0x4c, 0x4c, 0x0, 0x20, 0x41, 0xe0, 0x20, 0xb4, 0xe0, 0xf0, 0xe5, 0xa2, 0xa2, 
-0x20, 0xb6, 0xe0, 0xf0, 0xde, 0xa2, 0x9e, 0x20, 0xb6, 0xe0, 0x8, 0xa5, 0x9c, 0xa6, 0x9d, 0x28, 
-0xd0, 0x4, 0x85, 0x9e, 0x86, 0x9f, 0x85, 0xa0, 0x86, 0xa1, 0x20, 0xcc, 0xe5, 0xa2, 0x9a, 0x18, 
-0x4c, 0xdd, 0xff, 0x8, 0x20, 0xad, 0xe6, 0x4c, 0x7b, 0xe4, 0x20, 0x68, 0xe0, 0x20, 0x5d, 0xe1, 
-0x90, 0x3, 0x20, 0x8c, 0xe1, 0xa5, 0xa0, 0x48, 0xa5, 0xa1, 0x48, 0x38, 0xa5, 0xa2, 0xe5, 0xa0, 
-0x85, 0xa0, 0xa5, 0xa3, 0xe5, 0xa1, 0x85, 0xa1, 0xa9, 0x0, 0x85, 0xa2, 0xa9, 0x2, 0x85, 0xa3, 
-0xac, 0x5, 0x21, 0xf0, 0x3a, 0xc0, 0xf8, 0xb0, 0x95, 0x20, 0x38, 0xe3, 0x4c, 0x55, 0xe6, 0x20, 
-0x9, 0xe1, 0x20, 0x19, 0xe3, 0x98, 0xf0, 0x2, 0x90, 0xf5, 0xb0, 0xb, 0x20, 0x16, 0xe0, 0x4e, 
-0x4f, 0x20, 0x52, 0x4f, 0x4f, 0x4d, 0x0, 0x84, 0xea, 0xac, 0x5, 0x21, 0xc4, 0xea, 0xf0, 0xf, 
-0xb9, 0x7, 0x20, 0x99, 0xf, 0x20, 0xb9, 0x7, 0x21, 0x99, 0xf, 0x21, 0x88, 0xb0, 0xed, 0xa2, 
-0x0, 0xb5, 0xa5, 0x99, 0x8, 0x20, 0xc8, 0xe8, 0xe0, 0x8, 0xd0, 0xf5, 0xb5, 0x9b, 0x88, 0x99, 
-0x8, 0x21, 0xca, 0xd0, 0xf7, 0x20, 0xbb, 0xe1, 0x68, 0x85, 0x9d, 0x68, 0x85, 0x9c, 0xac, 0x5, 
-0x21, 0x20, 0x0, 0xe1, 0x8c, 0x5, 0x21, 0x20, 0x4a, 0xe7, 0x4c, 0x26, 0xe2, 0x20, 0x1a, 0xe6, 
-0x20, 0x96, 0xe7, 0xa9, 0x4b, 0x4c, 0xa8, 0xe4, 0x20, 0xb4, 0xe0, 0x8, 0x20, 0xcc, 0xe5, 0xa2, 
-0x0, 0x28, 0xf0, 0x6, 0xa5, 0x9c, 0xf0, 0x2, 0xa2, 0x4, 0xbd, 0xf7, 0xe6, 0x8d, 0x8, 0x2, 
-0xbd, 0xf8, 0xe6, 0x8d, 0x9, 0x2, 0xbd, 0xf9, 0xe6, 0x8d, 0xa, 0x2, 0xbd, 0xfa, 0xe6, 0x8d, 
-0xb, 0x2, 0x20, 0x16, 0xe0, 0x6, 0xf, 0xc, 0x41, 0x43, 0x4f, 0x52, 0x4e, 0x20, 0x41, 0x54, 
-0x4f, 0x4d, 0xa, 0xa, 0xd, 0xea, 0x60, 0x52, 0xfe, 0x94, 0xfe, 0x94, 0xed, 0x22, 0xed, 0xa9, 
-0x0, 0x85, 0xec, 0x85, 0xed, 0xa9, 0x2, 0x85, 0xf1, 0xa0, 0x16, 0xa9, 0x29, 0x85, 0xd5, 0xa9, 
-0xe7, 0x85, 0xd6, 0xb9, 0x62, 0xe8, 0x20, 0xd2, 0xe7, 0xc8, 0xb9, 0x62, 0xe8, 0xc9, 0xea, 0xf0, 
-0x6, 0x20, 0x9, 0xe8, 0x4c, 0x19, 0xe7, 0xc8, 0x60, 0x20, 0xe4, 0xe7, 0xa9, 0xa, 0x85, 0xf0, 
-0x60, 0x20, 0x7a, 0xe7, 0xd0, 0x13, 0x20, 0x5b, 0xe7, 0x20, 0xff, 0xe6, 0x20, 0x92, 0xe7, 0xa9, 
-0x53, 0x20, 0xed, 0xe7, 0x20, 0xa4, 0xe7, 0xd0, 0xf3, 0x60, 0x20, 0xff, 0xe6, 0x20, 0x96, 0xe7, 
-0xa9, 0x4b, 0x20, 0xed, 0xe7, 0x20, 0xa4, 0xe7, 0xd0, 0xf3, 0x60, 0xa5, 0xee, 0x29, 0x3, 0xa8, 
-0x9, 0x80, 0x85, 0xee, 0xa9, 0x3a, 0x20, 0xdb, 0xe7, 0xa9, 0x23, 0x20, 0x9, 0xe8, 0xb9, 0x8e, 
-0xe7, 0x20, 0x9, 0xe8, 0x20, 0x7a, 0xe7, 0xf0, 0xfb, 0x60, 0xa5, 0xee, 0x10, 0xd, 0xa9, 0x6c, 
-0x20, 0xd2, 0xe7, 0x20, 0xe4, 0xe7, 0x90, 0x3, 0x20, 0xfb, 0xe0, 0x29, 0x4, 0x60, 0x48, 0x88, 
-0x68, 0xa8, 0xa0, 0xa, 0xd0, 0x2, 0xa0, 0x12, 0xa2, 0xb, 0xb9, 0x4f, 0xe8, 0x95, 0xf1, 0x88, 
-0xca, 0xd0, 0xf7, 0x60, 0x20, 0xe4, 0xe7, 0xf0, 0xfa, 0xc9, 0x12, 0xd0, 0x8, 0x20, 0xd, 0xe0, 
-0x50, 0x52, 0x4f, 0x54, 0x0, 0xc9, 0x16, 0xd0, 0x5, 0x20, 0xd, 0xe0, 0x3f, 0x0, 0xc6, 0xf0, 
-0xd0, 0xe1, 0x48, 0x20, 0xd, 0xe0, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x20, 0xea, 0x68, 0x20, 0x2, 
-0xf8, 0x0, 0x48, 0xa5, 0xee, 0x6a, 0x68, 0x90, 0x2, 0x49, 0xc0, 0x2c, 0x0, 0xa, 0x30, 0xfb, 
-0x8d, 0x0, 0xa, 0x60, 0xad, 0x0, 0xa, 0x30, 0xfb, 0xad, 0x1, 0xa, 0x60, 0x20, 0xd2, 0xe7, 
-0x18, 0x68, 0x69, 0x1, 0x85, 0xd5, 0x68, 0x69, 0x0, 0x85, 0xd6, 0xa5, 0xec, 0x20, 0x9, 0xe8, 
-0xa5, 0xed, 0x20, 0x9, 0xe8, 0xa5, 0xf1, 0x9, 0x20, 0x48, 0xad, 0x0, 0xa, 0x29, 0x20, 0xd0, 
-0xf9, 0x68, 0x8d, 0x1, 0xa, 0x60, 0xa9, 0xa, 0x85, 0xf0, 0x38, 0xa9, 0xa, 0xe5, 0xed, 0xa4, 
-0xcc, 0xd0, 0x6, 0xc5, 0xcb, 0x90, 0x2, 0xa5, 0xcb, 0x85, 0xf1, 0x38, 0xa5, 0xcb, 0xe5, 0xf1, 
-0x85, 0xcb, 0xb0, 0x2, 0xc6, 0xcc, 0xa5, 0xf1, 0x60, 0x85, 0xed, 0xa5, 0xf6, 0x85, 0xc9, 0xa5, 
-0xf7, 0x85, 0xca, 0xe6, 0xec, 0x60, 0xa5, 0xc9, 0x85, 0xf6, 0xa5, 0xca, 0x85, 0xf7, 0x60, 0xad, 
-0x4, 0xa, 0x8d, 0xff, 0x1f, 0x68, 0x40, 0x4c, 0xf5, 0x0, 0xad, 0xff, 0x1f, 0x8d, 0x4, 0xa, 
-0x68, 0x40, 0x35, 0xd, 0x14, 0x5, 0xca, 0xea, 0x35, 0x10, 0xff, 0xff, 0x0, 0xea, 0x35, 0x18, 
-0xff, 0xff, 0x0, 0xea, 0x3a, 0x17, 0xc1, 0xea, 0x69, 0x0, 0xea, 0xad, 0x0, 0xa, 0x29, 0x4, 
-0xf0, 0x9, 0xe6, 0xf6, 0xd0, 0x2, 0xe6, 0xf7, 0x4c, 0xf2, 0x0, 0x8a, 0x48, 0x98, 0x48, 0xd8, 
-0x20, 0x99, 0xe8, 0x68, 0xa8, 0x68, 0xaa, 0x68, 0x40, 0x6c, 0xd5, 0x0, 0xa0, 0x0, 0x48, 0xd8, 
-0x98, 0xd0, 0xf, 0x18, 0x69, 0x20, 0xf0, 0x8, 0xa8, 0x20, 0x9e, 0xe8, 0xd0, 0xf5, 0xa6, 0xc6, 
-0x68, 0x60, 0x20, 0x7c, 0xea, 0xb0, 0xf7, 0xc4, 0xb9, 0xd0, 0x6, 0x20, 0x52, 0xe3, 0x4a, 0x85, 
-0xb9, 0xc4, 0xba, 0xd0, 0x5, 0x20, 0x56, 0xe3, 0x85, 0xba, 0xb9, 0x17, 0x22, 0x29, 0x60, 0xf0, 
-0x35, 0x20, 0x12, 0xe9, 0xb9, 0x17, 0x22, 0x29, 0x20, 0xf0, 0x25, 0xa6, 0xc4, 0xb9, 0x14, 0x22, 
-0x9d, 0xc, 0x21, 0xb9, 0x15, 0x22, 0x9d, 0xd, 0x21, 0xb9, 0x16, 0x22, 0xa, 0xa, 0xa, 0xa, 
-0x5d, 0xe, 0x21, 0x29, 0xf0, 0x5d, 0xe, 0x21, 0x9d, 0xe, 0x21, 0x20, 0x4a, 0xe7, 0xa4, 0xc2, 
-0x20, 0x76, 0xeb, 0x20, 0x0, 0xe5, 0xb9, 0x1b, 0x22, 0x49, 0xff, 0x25, 0xc0, 0x85, 0xc0, 0x4c, 
-0xae, 0xe8, 0x20, 0x3e, 0xe9, 0xa2, 0x7, 0xb9, 0xc, 0x22, 0x95, 0xa4, 0x88, 0x88, 0xca, 0xd0, 
-0xf6, 0x20, 0x5d, 0xe1, 0x90, 0x34, 0x84, 0xc4, 0xb9, 0xe, 0x21, 0xbe, 0xf, 0x21, 0xa4, 0xc2, 
-0x59, 0xd, 0x22, 0x29, 0xf, 0xd0, 0x23, 0x8a, 0xd9, 0xf, 0x22, 0xd0, 0x1d, 0x60, 0xa5, 0xee, 
-0x85, 0xc7, 0xa5, 0xac, 0x85, 0xc8, 0xb9, 0xe, 0x22, 0x29, 0x7f, 0x85, 0xac, 0xb9, 0x17, 0x22, 
-0x4c, 0x3f, 0xe4, 0xd8, 0x98, 0x48, 0x86, 0xc6, 0x8, 0xb5, 0x0, 0x85, 0x9a, 0xb5, 0x1, 0x85, 
-0x9b, 0x20, 0x75, 0xe0, 0x20, 0x5d, 0xe1, 0xb0, 0x1f, 0x28, 0x90, 0x5, 0xa0, 0x0, 0x4c, 0x51, 
-0xea, 0xa9, 0x0, 0xa2, 0x8, 0x95, 0x9b, 0xca, 0xd0, 0xfb, 0xa9, 0x40, 0x85, 0xa3, 0xa2, 0x9a, 
-0x20, 0x1a, 0xe6, 0xa6, 0xc6, 0x18, 0x90, 0xd0, 0x84, 0xc3, 0xa9, 0x0, 0x85, 0xc2, 0xa0, 0xa0, 
-0xa9, 0x8, 0x24, 0xc0, 0xf0, 0x28, 0x48, 0x84, 0xc4, 0xa6, 0xc3, 0xa9, 0x8, 0x85, 0xc5, 0xb9, 
-0x0, 0x22, 0xdd, 0x8, 0x20, 0xd0, 0x1e, 0xc8, 0xb9, 0x0, 0x22, 0xdd, 0x8, 0x21, 0xd0, 0x15, 
-0xc8, 0xe8, 0xc6, 0xc5, 0xd0, 0xe9, 0xa4, 0xc4, 0xa6, 0xc6, 0x20, 0x9e, 0xe8, 0x68, 0x84, 0xc2, 
-0x85, 0xc1, 0x4c, 0xc8, 0xe9, 0xa4, 0xc4, 0x68, 0x48, 0x98, 0x38, 0xe9, 0x20, 0xa8, 0x68, 0xa, 
-0xd0, 0xc0, 0xa4, 0xc2, 0xf0, 0xb5, 0xa6, 0xc3, 0xa9, 0x8, 0x85, 0xc5, 0xbd, 0x8, 0x20, 0x99, 
-0x0, 0x22, 0xc8, 0xbd, 0x8, 0x21, 0x99, 0x0, 0x22, 0xc8, 0xe8, 0xc6, 0xc5, 0xd0, 0xed, 0xa2, 
-0x10, 0xa9, 0x0, 0x99, 0x0, 0x22, 0xc8, 0xca, 0xd0, 0xf9, 0xa5, 0xc2, 0xa8, 0x20, 0xfa, 0xe0, 
-0x69, 0x22, 0x99, 0x13, 0x22, 0xa5, 0xc1, 0x99, 0x1b, 0x22, 0x5, 0xc0, 0x85, 0xc0, 0xb9, 0x9, 
-0x22, 0x69, 0xff, 0xb9, 0xb, 0x22, 0x69, 0x0, 0x99, 0x19, 0x22, 0xb9, 0xd, 0x22, 0x9, 0xf, 
-0x69, 0x0, 0x20, 0xfb, 0xe0, 0x99, 0x1a, 0x22, 0x28, 0x90, 0x2f, 0xb9, 0x9, 0x22, 0x99, 0x14, 
-0x22, 0xb9, 0xb, 0x22, 0x99, 0x15, 0x22, 0xb9, 0xd, 0x22, 0x20, 0xfb, 0xe0, 0x99, 0x16, 0x22, 
-0xa5, 0xee, 0x29, 0xf, 0x19, 0x17, 0x22, 0x99, 0x17, 0x22, 0x20, 0xd1, 0xea, 0xa5, 0xcd, 0x85, 
-0xac, 0x84, 0xc3, 0xa6, 0xc6, 0x68, 0xa8, 0xa5, 0xc3, 0x60, 0xa9, 0x20, 0x99, 0x17, 0x22, 0xd0, 
-0xdf, 0x48, 0x84, 0xc2, 0xa, 0xa, 0x65, 0xc2, 0xa8, 0xb9, 0x10, 0x22, 0x95, 0x0, 0xb9, 0x11, 
-0x22, 0x95, 0x1, 0xb9, 0x12, 0x22, 0x95, 0x2, 0xa4, 0xc2, 0x68, 0x60, 0x48, 0x86, 0xc6, 0x98, 
-0x29, 0xe0, 0x85, 0xc2, 0xf0, 0x11, 0x20, 0xfa, 0xe0, 0xa8, 0xa9, 0x0, 0x38, 0x6a, 0x88, 0xd0, 
-0xfc, 0xa4, 0xc2, 0x24, 0xc0, 0xd0, 0x3, 0x68, 0x38, 0x60, 0x68, 0x18, 0x60, 0xa2, 0x20, 0x8a, 
-0x18, 0x79, 0x0, 0x22, 0xc8, 0xca, 0xd0, 0xf9, 0x69, 0x0, 0xa4, 0xc2, 0x60, 0x20, 0x9d, 0xea, 
-0xc9, 0xff, 0xf0, 0xe8, 0x0, 0x18, 0xb9, 0xf, 0x22, 0x79, 0x11, 0x22, 0x85, 0xa3, 0x99, 0x1c, 
-0x22, 0xb9, 0xd, 0x22, 0x29, 0xf, 0x79, 0x12, 0x22, 0x85, 0xa2, 0x99, 0x1d, 0x22, 0x20, 0x65, 
-0xeb, 0xa9, 0xff, 0x99, 0x1f, 0x22, 0x20, 0x9d, 0xea, 0x49, 0xff, 0x99, 0x1f, 0x22, 0x60, 0x18, 
-0x79, 0x1f, 0x22, 0x69, 0x0, 0xd0, 0xf4, 0x20, 0xe6, 0xff, 0xc9, 0x4, 0xf0, 0x22, 0x18, 0x60, 
-0xd8, 0x98, 0xf0, 0xf3, 0x20, 0x7c, 0xea, 0xb0, 0x3b, 0x98, 0x20, 0xfa, 0xec, 0xd0, 0x15, 0xb9, 
-0x17, 0x22, 0x29, 0x10, 0xd0, 0x4f, 0xa9, 0x10, 0x20, 0x67, 0xeb, 0x20, 0xd1, 0xea, 0xa6, 0xc6, 
-0xa9, 0xff, 0x38, 0x60, 0xb9, 0x17, 0x22, 0x30, 0x10, 0x20, 0xad, 0xea, 0x20, 0x3e, 0xe9, 0x20, 
-0x76, 0xeb, 0x38, 0x20, 0x7e, 0xeb, 0x20, 0x0, 0xe5, 0xb9, 0x10, 0x22, 0x85, 0x9a, 0xb9, 0x13, 
-0x22, 0x85, 0x9b, 0xa0, 0x0, 0xb1, 0x9a, 0x48, 0xa4, 0xc2, 0xa9, 0xfe, 0x20, 0xdf, 0xea, 0xa6, 
-0x9a, 0xe8, 0x8a, 0x99, 0x10, 0x22, 0xd0, 0x19, 0x18, 0xb9, 0x11, 0x22, 0x69, 0x1, 0x99, 0x11, 
-0x22, 0xb9, 0x12, 0x22, 0x69, 0x0, 0x99, 0x12, 0x22, 0x20, 0x6c, 0xeb, 0xa9, 0x80, 0x20, 0xdf, 
-0xea, 0x18, 0x4c, 0xae, 0xe8, 0xa9, 0x80, 0x19, 0x17, 0x22, 0xd0, 0x5, 0xa9, 0x7f, 0x39, 0x17, 
-0x22, 0x99, 0x17, 0x22, 0x18, 0x60, 0xb9, 0x17, 0x22, 0x29, 0x40, 0xf0, 0x3a, 0x18, 0x8, 0x20, 
-0x5b, 0xe7, 0xa4, 0xc2, 0xb9, 0x13, 0x22, 0x85, 0x9d, 0xa9, 0x0, 0x85, 0x9c, 0x85, 0xa0, 0xa9, 
-0x1, 0x85, 0xa1, 0x28, 0xb0, 0x16, 0xb9, 0x1c, 0x22, 0x85, 0xa3, 0xb9, 0x1d, 0x22, 0x85, 0xa2, 
-0x20, 0xb0, 0xe6, 0xa4, 0xc2, 0xa9, 0xbf, 0x20, 0x6e, 0xeb, 0x90, 0x6, 0x20, 0xb5, 0xea, 0x20, 
-0xa3, 0xe4, 0x20, 0x26, 0xe2, 0xa4, 0xc2, 0x60, 0x68, 0x4c, 0xe9, 0xff, 0xd8, 0x48, 0x98, 0xf0, 
-0xf7, 0x20, 0x7c, 0xea, 0xb0, 0x59, 0x20, 0xad, 0xea, 0xb9, 0xe, 0x22, 0x30, 0xbc, 0x20, 0x3e, 
-0xe9, 0x98, 0x18, 0x69, 0x4, 0x20, 0xfa, 0xec, 0xd0, 0x51, 0x20, 0x15, 0xe9, 0xa6, 0xc4, 0x38, 
-0xbd, 0x7, 0x21, 0xfd, 0xf, 0x21, 0x48, 0xbd, 0x6, 0x21, 0xfd, 0xe, 0x21, 0x29, 0xf, 0x85, 
-0xc3, 0xa, 0xa, 0xa, 0xa, 0x5d, 0xe, 0x21, 0x29, 0xf0, 0x5d, 0xe, 0x21, 0xdd, 0xe, 0x21, 
-0x9d, 0xe, 0x21, 0xd0, 0xd, 0x68, 0xdd, 0xd, 0x21, 0xd0, 0x8, 0x20, 0x0, 0xe5, 0x20, 0x9e, 
-0xe8, 0x0, 0x68, 0x9d, 0xd, 0x21, 0x99, 0x19, 0x22, 0xa5, 0xc3, 0x99, 0x1a, 0x22, 0xa9, 0x0, 
-0x9d, 0xc, 0x21, 0x20, 0x4a, 0xe7, 0x20, 0x26, 0xe2, 0xa4, 0xc2, 0xb9, 0x17, 0x22, 0x30, 0x17, 
-0x20, 0x76, 0xeb, 0xb9, 0x14, 0x22, 0xd0, 0xb, 0x98, 0x20, 0xfa, 0xec, 0xd0, 0x5, 0x20, 0xb5, 
-0xea, 0xd0, 0x4, 0x38, 0x20, 0x7e, 0xeb, 0xb9, 0x10, 0x22, 0x85, 0x9a, 0xb9, 0x13, 0x22, 0x85, 
-0x9b, 0x68, 0xa0, 0x0, 0x91, 0x9a, 0x48, 0xa4, 0xc2, 0xa9, 0x40, 0x20, 0x67, 0xeb, 0xe6, 0x9a, 
-0xa5, 0x9a, 0x99, 0x10, 0x22, 0xd0, 0x13, 0x20, 0x6c, 0xeb, 0xb9, 0x11, 0x22, 0x69, 0x1, 0x99, 
-0x11, 0x22, 0xb9, 0x12, 0x22, 0x69, 0x0, 0x99, 0x12, 0x22, 0x98, 0x20, 0xfa, 0xec, 0x90, 0x17, 
-0xa9, 0x20, 0x20, 0x67, 0xeb, 0xb9, 0x10, 0x22, 0x99, 0x14, 0x22, 0xb9, 0x11, 0x22, 0x99, 0x15, 
-0x22, 0xb9, 0x12, 0x22, 0x99, 0x16, 0x22, 0x20, 0xd1, 0xea, 0x20, 0x0, 0xe5, 0x4c, 0x61, 0xeb, 
-0x48, 0x20, 0x7c, 0xea, 0xb0, 0xd0, 0x20, 0xad, 0xea, 0xa6, 0xc6, 0x20, 0x4, 0xe1, 0x20, 0x12, 
-0xed, 0x90, 0x63, 0xa4, 0xc2, 0x20, 0x12, 0xed, 0xb0, 0x7, 0xa9, 0xff, 0x20, 0xbc, 0xeb, 0xd0, 
-0xf4, 0xb5, 0x0, 0x99, 0x10, 0x22, 0xb5, 0x1, 0x99, 0x11, 0x22, 0xb5, 0x2, 0x99, 0x12, 0x22, 
-0xa9, 0x6f, 0x20, 0x6e, 0xeb, 0xb9, 0xf, 0x22, 0x79, 0x11, 0x22, 0x85, 0xc5, 0xb9, 0xd, 0x22, 
-0x29, 0xf, 0x79, 0x12, 0x22, 0xd9, 0x1d, 0x22, 0xd0, 0xa, 0xa5, 0xc5, 0xd9, 0x1c, 0x22, 0xd0, 
-0x3, 0x20, 0x65, 0xeb, 0x20, 0xd1, 0xea, 0x4c, 0x61, 0xeb, 0xaa, 0xb9, 0x12, 0x22, 0xdd, 0x16, 
-0x22, 0xd0, 0xe, 0xb9, 0x11, 0x22, 0xdd, 0x15, 0x22, 0xd0, 0x6, 0xb9, 0x10, 0x22, 0xdd, 0x14, 
-0x22, 0x60, 0xb9, 0x14, 0x22, 0xd5, 0x0, 0xb9, 0x15, 0x22, 0xf5, 0x1, 0xb9, 0x16, 0x22, 0xf5, 
-0x2, 0x60, 0x8, 0xd8, 0x86, 0xe4, 0x84, 0xe5, 0x2c, 0x2, 0xb0, 0x50, 0x5, 0x20, 0x71, 0xfe, 
-0x90, 0xf6, 0x20, 0x8a, 0xfb, 0x20, 0x71, 0xfe, 0xb0, 0xfb, 0x20, 0x71, 0xfe, 0xb0, 0xf6, 0x98, 
-0xa2, 0x17, 0x20, 0xc5, 0xfe, 0xbd, 0x48, 0xed, 0x85, 0xe2, 0xbd, 0x55, 0xed, 0x85, 0xe3, 0x98, 
-0x6c, 0xe2, 0x0, 0xdf, 0xd2, 0x9a, 0x88, 0xe2, 0x81, 0xc0, 0xdf, 0xd8, 0xd6, 0xc8, 0xc6, 0xc2, 
-0xfd, 0xfd, 0xfd, 0xed, 0xfd, 0xed, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xa9, 0xb, 0xd0, 
-0xa, 0xa9, 0x8, 0xd0, 0x6, 0xa9, 0x9, 0xd0, 0x2, 0xa9, 0xa, 0x20, 0x97, 0xed, 0x4c, 0x22, 
-0xed, 0xa0, 0x0, 0xb1, 0xd2, 0x4c, 0x60, 0xfe, 0x29, 0x5, 0x2e, 0x1, 0xb0, 0x2a, 0x20, 0x1f, 
-0xee, 0x4c, 0x28, 0xed, 0x20, 0xfb, 0xfe, 0x8, 0x48, 0xd8, 0x84, 0xe9, 0x20, 0x1f, 0xee, 0x68, 
-0xa4, 0xe9, 0x28, 0x60, 0x68, 0x68, 0x60, 0x88, 0x10, 0x14, 0xa0, 0x27, 0xa5, 0xce, 0xc9, 0x18, 
-0xb0, 0xf2, 0xe6, 0xce, 0xa5, 0xcf, 0xe9, 0x27, 0x85, 0xcf, 0xb0, 0x2, 0xc6, 0xd0, 0x60, 0xc6, 
-0xce, 0x60, 0xa0, 0x28, 0x20, 0xf6, 0xed, 0xa5, 0xd2, 0x85, 0xcf, 0xa5, 0xd4, 0x85, 0xd0, 0xa5, 
-0xce, 0xd0, 0xec, 0xa0, 0xd, 0x8c, 0x0, 0x8, 0xa5, 0xcf, 0x38, 0xe9, 0xc0, 0x8d, 0x1, 0x8, 
-0x88, 0x8c, 0x0, 0x8, 0xa5, 0xd0, 0xe9, 0x3, 0x8d, 0x1, 0x8, 0xa0, 0x27, 0xa9, 0x20, 0x20, 
-0xb, 0xee, 0x88, 0x10, 0xfa, 0x60, 0x48, 0x18, 0x98, 0x65, 0xcf, 0x85, 0xd2, 0xa5, 0xd0, 0x69, 
-0x0, 0x85, 0xd4, 0x29, 0x7, 0x9, 0x4, 0x85, 0xd3, 0x68, 0x60, 0x20, 0xf6, 0xed, 0x84, 0xd4, 
-0xa0, 0x0, 0x91, 0xd2, 0xa4, 0xd4, 0x60, 0x18, 0x8, 0x6, 0xd1, 0x28, 0x66, 0xd1, 0x60, 0xc9, 
-0x6, 0xf0, 0xf4, 0xc9, 0x15, 0xf0, 0xf1, 0xa4, 0xd1, 0x30, 0x2d, 0xc9, 0x20, 0x90, 0x34, 0xc9, 
-0x7f, 0xf0, 0x26, 0x20, 0xb, 0xee, 0xc8, 0xc0, 0x28, 0x90, 0x5, 0x20, 0xc2, 0xed, 0xa0, 0x0, 
-0x20, 0xf6, 0xed, 0x84, 0xd1, 0xa0, 0xf, 0x8c, 0x0, 0x8, 0xa5, 0xd2, 0x8d, 0x1, 0x8, 0x88, 
-0x8c, 0x0, 0x8, 0xa4, 0xd4, 0x8c, 0x1, 0x8, 0x60, 0x20, 0xa7, 0xed, 0xa9, 0x20, 0x20, 0xb, 
-0xee, 0x10, 0xdd, 0xc9, 0xd, 0xf0, 0xd7, 0xc9, 0xa, 0xf0, 0x20, 0xc9, 0xc, 0xf0, 0x3b, 0xc9, 
-0x8, 0xf0, 0x12, 0xc9, 0x1e, 0xf0, 0x1c, 0xc9, 0xb, 0xf0, 0x29, 0xc9, 0x7, 0xf0, 0x5b, 0xc9, 
-0x9, 0xd0, 0xb0, 0xb0, 0xb1, 0x20, 0xa7, 0xed, 0x4c, 0x40, 0xee, 0x20, 0xc2, 0xed, 0xa4, 0xd1, 
-0x4c, 0x40, 0xee, 0xa9, 0x18, 0xa4, 0xce, 0x85, 0xce, 0xc0, 0x18, 0xb0, 0xa1, 0xc8, 0x20, 0xb4, 
-0xed, 0x4c, 0x99, 0xee, 0x20, 0xac, 0xed, 0x4c, 0x40, 0xee, 0xa9, 0x20, 0xa0, 0x0, 0x99, 0x0, 
-0x4, 0x99, 0x0, 0x5, 0x99, 0x0, 0x6, 0x99, 0x0, 0x7, 0xc8, 0xd0, 0xf1, 0x84, 0xcf, 0x84, 
-0xd1, 0xa0, 0xd, 0x8c, 0x0, 0x8, 0xb9, 0x1c, 0xef, 0x8d, 0x1, 0x8, 0x88, 0x10, 0xf4, 0xa9, 
-0x18, 0x85, 0xce, 0xa9, 0x4, 0x85, 0xd0, 0x4c, 0x3e, 0xee, 0x86, 0xd2, 0x20, 0x1a, 0xfd, 0xa6, 
-0xd2, 0x60, 0xa2, 0xc, 0xbd, 0x1e, 0xef, 0x9d, 0x0, 0x2, 0xe8, 0xe0, 0x1c, 0xd0, 0xf5, 0xa9, 
-0x7b, 0x8d, 0x0, 0x2, 0xa9, 0xe8, 0x8d, 0x1, 0x2, 0xa9, 0xe5, 0x8d, 0x6, 0x2, 0xa9, 0xe3, 
-0x8d, 0x7, 0x2, 0xa9, 0x20, 0x85, 0xcd, 0x85, 0xac, 0xa0, 0x0, 0x84, 0xee, 0x84, 0xc0, 0x84, 
-0xb9, 0x84, 0xba, 0xa2, 0x4, 0x20, 0x13, 0xe7, 0xca, 0xd0, 0xfa, 0x60, 0x3f, 0x28, 0x33, 0x44, 
-0x1e, 0x2, 0x19, 0x1b, 0x3, 0x12, 0x72, 0x13, 0x4, 0x0, 0x77, 0xe4, 0x13, 0xe6, 0x61, 0xea, 
-0xa0, 0xec, 0xf0, 0xea, 0xbc, 0xeb, 0x53, 0xe9, 0x9e, 0xe8, 0x49, 0x43, 0x45, 0x53, 0x2e, 0xd, 
-0x0, 0x20, 0x53, 0x43, 0x52, 0x41, 0x20, 0x2a, 0x20, 0x24, 0x30, 0x34, 0x30, 0x30, 0xd, 0x0, 
-0x30, 0x53, 0x43, 0x52, 0x42, 0x20, 0x2a, 0x20, 0x24, 0x30, 0x35, 0x30, 0x30, 0xd, 0x0, 0x40, 
-0x53, 0x43, 0x52, 0x43, 0x20, 0x2a, 0x20, 0x24, 0x30, 0x36, 0x30, 0x30, 0xd, 0x0, 0x50, 0x53, 
-0x43, 0x52, 0x44, 0x20, 0x2a, 0x20, 0x24, 0x30, 0x37, 0x30, 0x30, 0xd, 0x0, 0x60, 0x48, 0x53, 
-0x59, 0x4e, 0x43, 0x20, 0x2a, 0x20, 0x24, 0x33, 0x33, 0xd, 0x0, 0x70, 0x4b, 0x42, 0x49, 0x4e, 
-0x20, 0x50, 0x48, 0x50, 0xd, 0x0, 0x80, 0x20, 0x43, 0x4c, 0x44, 0xd, 0x0, 0x90, 0x20, 0x53, 
-0x54, 0x58, 0x20, 0x24, 0x30, 0x30, 0x45, 0x34, 0xd, 0x1, 0x0, 0x20, 0x53, 0x54, 0x59, 0x20, 
-0x24, 0x30, 0x30, 0x45, 0x35, 0xd, 0x1, 0x10, 0x46, 0x49, 0x4e, 0x44, 0x4b, 0x59, 0x20, 0x42, 
-0x49, 0x54, 0x20, 0x24, 0x42, 0x30, 0x30, 0x32, 0xd, 0x1, 0x20, 0x20, 0x42, 0x56, 0x43, 0x20, 
-0x52, 0x45, 0x50, 0x54, 0x54, 0x54, 0xd, 0x1, 0x30, 0x4e, 0x4f, 0x52, 0x45, 0x50, 0x54, 0x20, 
-0x4a, 0x53, 0x52, 0x20, 0x24, 0x46, 0x45, 0x37, 0x31, 0xd, 0x1, 0x40, 0x20, 0x42, 0x43, 0x43, 
-0x20, 0x46, 0x49, 0x4e, 0x44, 0x4b, 0x59, 0xd, 0x0, 0x0, 0x0, 0x0, 0x40, 0x40, 0x40, 0x40, 
-
-};
-dump_item dump_items[DUMP_NUM_ITEMS] = {
+static const unsigned char dump_abasic_lz4[] =
+"\xf0\x2c\x3c\x3d\x3e\xfe\x2d\x2b\xc8\x23\x28\x21\x3f\x52\x54\x4c\x43\x41\x50\x45\x47\x42\x46\xf0\x54\xff\x4f\xcb\x53\xcb\x54\x45"
+"\x50\xcb\x54\xc3\x48\x45\x4e\xc3\x22\x24\xce\xce\xcc\x24\x2c\xc5\x24\x26\x3b\x0d\x2c\xc3\xc5\xc2\x3e\xc7\x3d\xc7\xc7\x04\x00\xf0"
+"\x71\xc8\x52\xc7\xc7\x4f\x41\xfe\x24\xc7\x48\xc9\x45\x4e\xc9\x4e\x44\xc7\xc9\xc9\xc9\xc9\x4e\x44\xc9\x4f\x50\xc9\x4f\x55\x4e\x54"
+"\xc9\x42\x53\xc9\x54\x52\xcf\x58\x54\xcf\x45\x54\xcf\x47\x45\x54\xcf\x49\x4e\xcf\x4f\x55\x54\xcf\xc3\xc3\x52\x49\x4e\x54\xc3\x4e"
+"\x4c\x55\x4e\x49\x47\x52\x46\x21\x3f\x24\x50\x44\x4c\x53\x42\x2a\x45\xf0\x41\x56\x45\xcf\x45\x57\xc2\x4f\xcc\x45\x54\xc3\x49\x4e"
+"\x4b\xc3\x49\x53\x54\xca\x4f\x41\x44\xce\x4e\x54\x49\x4c\xcc\x45\x58\x54\xca\x46\xc5\x4e\x50\x55\x54\xcc\x4f\x53\x55\x42\xcb\x4f"
+"\x54\x28\x00\xf0\x01\x55\x52\x4e\xcb\x45\x4d\xc5\x55\x4e\xf1\x4f\x52\xcb\x4e\x44\xcd\x68\x00\x80\x50\x55\x54\xcf\x48\x55\x54\xcf"
+"\x08\x00\x30\x54\x52\xcf\x73\x00\xf0\xa9\xc4\xcd\xc4\x2c\xfe\x36\x3b\x3c\xc0\x3f\x06\xdc\x50\x51\x52\x53\x54\x57\x4a\x5a\x5f\x62"
+"\x65\x68\x6b\x6f\x2e\x18\xac\x17\x81\x1c\xbe\x17\x17\x17\xa2\x22\x1b\x17\x17\x17\x1b\x29\x28\xb6\xbf\xb6\x2a\xb7\x58\x76\x77\x34"
+"\x34\x7c\x3f\x4a\x78\x38\x6d\x3a\x64\x74\x5b\x3e\x7b\x82\xc1\x45\x22\x31\x40\x4d\x4d\x42\x53\x15\xd2\x15\x15\xbd\x45\x45\x14\x0a"
+"\x44\x5f\x4c\x15\x15\x86\x15\x15\x73\x48\x15\x15\x15\x7a\x15\x15\x02\x15\x15\x29\x15\x15\x28\x15\x15\x66\x15\x15\x15\x5b\x72\x15"
+"\xa6\x15\x15\x15\xa7\x90\x35\xe3\x8f\x8f\x8f\x34\x94\xa0\xa8\xad\xb1\xbd\xc1\xcd\xe9\xea\xeb\x78\x97\x99\xd3\xdf\xec\xd0\x4b\x8f"
+"\x8f\x8f\x0a\x8f\xad\xad\x8f\xf0\x9c\x8f\x25\x8f\x8f\x8f\xb2\xa4\x9c\x8f\x51\x99\x8f\x8f\xed\x8f\x8f\x8f\x8f\xd2\x8f\x8f\x8f\xcd"
+"\xb3\x66\x0b\x00\x10\x81\x05\x00\xf0\x14\xd2\x8f\xb8\x8f\x05\xca\xc7\x8f\x8f\x8f\xec\x8f\x8f\x75\x8f\x8f\x41\x8f\x8f\x57\x8f\x8f"
+"\x98\xd7\x8f\x8f\xe3\xdb\x8f\x8f\xc5\x90\x8f\x8f\xb6\x27\x00\xf0\x32\xe6\x8f\x47\x8f\x8f\x95\xee\x06\x5c\x0f\x35\x2d\x2b\x7c\x3a"
+"\xfe\x2a\x2f\x25\x21\x3f\x26\xfe\x29\xff\x3d\xff\x21\x3f\x24\xff\x3d\x21\x3f\xff\x27\x22\xfe\xb7\x9a\xd3\xef\xef\x13\x5e\x70\xb3"
+"\x9c\x7b\x7b\x78\x78\x78\x78\xee\x06\x5c\x5c\xe5\x75\x7b\x7b\x6f\x7a\xc7\x01\x00\x12\xc8\x01\x00\xf0\x24\xc2\xc2\xc2\xc2\xc3\xc4"
+"\xcd\xcd\xc3\xcd\xcd\xcd\xc3\xc3\x20\x3e\xcf\x84\x0f\xa2\xed\xa4\x03\x88\xc8\xb1\x05\xc9\x20\xf0\xf9\x84\x5e\x85\x52\xe8\xbd\xff"
+"\xbf\x30\x24\xc5\x52\xd0\xf6\xbd\xee\xc0\xaa\xe8\xc8\x0f\x00\xf0\x00\x15\xd1\x05\xf0\xf5\xb1\x05\xc9\x2e\xf0\x04\xa4\x5e\x10\xe7"
+"\x23\x00\xf6\x04\x10\xfa\xc8\xc9\xfe\xb0\x3b\x85\x53\xbd\xee\xc0\x90\x29\xa6\x04\x60\xa2\x0e\x48\x00\x50\xdd\xdd\xc1\xf0\x0c\x4b"
+"\x00\x41\xdd\xc1\x30\x16\x4b\x00\xf0\x75\x12\xc2\x85\x53\xbd\xf8\xc1\xc8\x85\x52\x84\x03\xa6\x04\x6c\x52\x00\xc9\xfe\xf0\xca\x00"
+"\x20\xe4\xc4\xd0\x04\xa9\x29\x85\x12\xa9\x0d\xa4\x12\x84\x0e\xa0\x00\x84\x0d\x91\x0d\xa9\xff\xc8\x91\x0d\xc8\x84\x0d\xa9\x08\x8d"
+"\x21\x03\xa9\x3e\xd8\x20\x0f\xcd\xa2\x01\x86\x06\xca\x86\x05\x86\x01\x86\x02\xa9\xd8\x8d\x02\x02\xa9\xc9\x8d\x03\x02\xa9\xe7\x85"
+"\x10\xa9\xc9\x85\x11\xa2\xff\x9a\xa9\x00\x85\x04\x85\x03\x85\x15\x85\x13\x85\x14\xa2\x34\x9d\x8c\x03\xca\xd0\xfa\x20\x34\xc4\xb0"
+"\x21\x20\x6a\xc4\x90\x03\x4c\xc9\xcd\xa2\x7d\x4c\x33\xc2\x12\x00\x33\x0f\xa2\x7f\x0a\x00\xf0\x04\x05\xa2\x10\x4c\x7b\xc2\xa2\x14"
+"\x4c\x7b\xc2\x38\x66\x0f\x20\x72\xc3\xa2\x2e\x1a\x00\xf1\x42\x8b\xc7\x20\xcb\xc3\xa5\x0f\x30\x21\xa2\x00\x86\x27\xa0\x00\xb9\x52"
+"\x00\x48\x29\x0f\x95\x45\x68\x4a\x4a\x4a\x4a\xe8\x95\x45\xe8\xc8\xc0\x04\x90\xea\x20\xc8\xc5\x30\xcd\x20\x89\xc5\x30\xc8\x20\x54"
+"\xcd\xa2\x18\x4c\x7b\xc2\x20\x4c\xca\xb1\x05\xc8\xc9\x0d\xf0\x1c\x84\x03\xc9\x22\xd0\xf0\xb1\x05\xc9\x22\xd0\xe5\xc8\xb0\xe7\x20"
+"\x51\x00\xf2\x46\x05\x54\x05\x53\xf0\x0e\xa0\x00\xb1\x52\xc9\x0d\xf0\x93\x20\x4c\xca\xc8\xd0\xf4\xa5\x52\x20\x4c\xca\x4c\x37\xc3"
+"\x20\xc8\xc3\x20\xe4\xc4\xad\x22\x03\xae\x39\x03\xac\x3a\x03\x20\xa5\xc2\xd8\x4c\x5b\xc5\x20\xbc\xc8\xa0\x52\xca\x86\x04\xb5\x16"
+"\x99\x00\x00\xb5\x25\x99\x01\x00\xb5\x34\x99\x02\x00\xb5\x43\x99\x03\x00\x60\x20\xe1\xc4\x20\x2f\xca\x26\x00\xb0\x20\x93\xce\xb5"
+"\x26\xc8\x91\x52\xc8\xb5\x35\x05\x00\x35\x44\x91\x52\x18\x00\xf1\x20\x4c\x5b\xc5\xa2\x00\xb1\x05\x9d\x00\x01\x84\x03\xc8\xe8\xc9"
+"\x0d\xd0\xf3\x20\xf7\xff\x4c\x58\xc5\xad\x00\xd0\xc9\xaa\xd0\x38\x4a\xcd\x01\xd0\xd0\x32\xa4\x5e\x60\xa4\x03\x10\x03\xc8\x84\x03"
+"\x04\x02\xd0\xf7\xc9\x5b\xb0\x1e\xe9\x3f\x90\x1b\xa6\x04\x95\x16\x17\x02\xf0\x05\x2e\xf0\x0f\xc9\x5b\xb0\x04\xc9\x40\xb0\x07\xe8"
+"\x86\x04\x38\x84\x03\x60\x18\x60\x4a\x01\xd0\xbb\xa2\x00\xa4\x03\x86\x52\x86\x53\x86\x54\x86\x55\x41\x02\xf4\x0e\x38\xe9\x30\x30"
+"\x54\xc9\x0a\xb0\x50\xa6\x53\x48\xa5\x55\x48\xa5\x54\x48\xa5\x52\x0a\x26\x53\x26\x54\x26\x55\x30\xd4\x09\x00\xf0\x05\xcb\x65\x52"
+"\x85\x52\x8a\x65\x53\x85\x53\x68\x65\x54\x85\x54\x68\x65\x55\x06\x52\x24\x00\x60\x2a\x30\xb1\x85\x55\x68\x1d\x00\xf6\x14\x90\x0c"
+"\xe6\x53\xd0\x08\xe6\x54\xd0\x04\xe6\x55\x30\x9c\xa2\xff\xd0\xa4\x8a\xf0\x8d\x38\x84\x03\xa0\x52\x4c\x9f\xc9\x20\x79\xc2\x20\x8b"
+"\xc7\x69\x02\xf0\x60\xc9\x3b\xf0\x04\xc9\x0d\xd0\x66\x18\x98\x65\x05\x85\x05\x90\x02\xe6\x06\xa0\x01\x84\x03\xad\x01\xb0\x29\x20"
+"\xf0\x3c\x60\x20\xe4\xc4\x88\xb1\x05\xc9\x3b\xf0\xf5\xa5\x06\xc9\x01\xf0\x7a\xc8\xb1\x05\x30\x3b\x85\x02\xc8\xb1\x05\x85\x01\xc8"
+"\xb1\x05\x88\xc9\x61\x90\xc7\xe9\x61\xc9\x1b\xb0\xc0\xc8\x0a\xaa\x20\xf6\xc4\xa5\x05\x9d\x8d\x03\xa5\x06\x9d\x8e\x03\x60\x4c\xcf"
+"\xc2\x88\x20\xf6\xc4\xd0\x0b\x20\x24\xc4\x90\x03\x6c\x02\xd0\x20\xe4\xc4\xa0\x00\x4d\x00\x81\xd0\x1a\x4c\x1b\xc3\x20\x0c\xc7\x9c"
+"\x01\xf1\x00\xf0\x05\xa2\x20\x4c\x33\xc2\xa9\x0d\x88\xc8\xd1\x05\xd0\xfb\x67\x00\xf0\x8a\xc4\x20\x1c\xc5\x4c\x1b\xc3\xa5\x43\x85"
+"\x27\x10\x04\xe8\x20\xc4\xc8\xa2\x09\xa9\x00\x95\x45\x38\xa5\x16\xfd\x08\xc6\x48\xa5\x25\xfd\x10\xc6\x48\xa5\x34\xfd\x1a\xc6\xa8"
+"\xa5\x43\xfd\x24\xc6\x90\x0e\x85\x43\x84\x34\x68\x85\x25\x68\x85\x16\xf6\x45\xd0\xd8\x68\x68\xca\x10\xcf\xa2\x0a\xca\xf0\x04\xb5"
+"\x45\xf0\xf9\x86\x52\x24\x27\x10\x02\xe6\x52\x38\xad\x21\x03\xf0\x02\xe9\x01\xe5\x52\xf0\x0b\x90\x09\xa8\xa9\x20\x20\x4c\xca\x88"
+"\xd0\xf8\x24\x27\x10\x05\xa9\x2d\x20\x4c\xca\xb5\x45\xc9\x0a\x90\x02\x69\x06\x69\x30\x20\x4c\xca\xca\x10\xf0\x60\x01\x0a\x64\xe8"
+"\x10\xa0\x40\x80\x00\x00\x00\x03\x27\x86\x42\x96\xe1\xca\x00\x01\x00\x50\x01\x0f\x98\xf5\x9a\x09\x00\x00\x04\x00\xf3\x68\x05\x3b"
+"\xc6\x04\xa6\x04\xa0\x00\x84\x58\xa5\x12\x85\x59\x88\xa9\x0d\xc8\xd1\x58\xd0\xfb\x20\xa1\xce\xb1\x58\xc8\xd5\x25\x90\xef\xd0\x12"
+"\xb1\x58\xd5\x16\x90\xe7\xd0\x0a\x85\x01\xb5\x25\x85\x02\x20\xa1\xce\x18\x60\x20\xbc\xc8\xb5\x42\x55\x41\x85\x52\x20\x05\xc9\xa0"
+"\x53\x20\xcd\xc3\xb5\x42\x95\x43\x20\x07\xc9\xa0\x57\x20\xcd\xc3\xa0\x00\x84\x5b\x84\x5c\x84\x5d\x84\x5e\x60\x20\x61\xc6\xa5\x54"
+"\x20\x05\xc7\xf0\xec\xa0\x20\x88\xf0\x41\x06\x57\x26\x58\x26\x59\x26\x5a\x10\xf3\x26\x0a\x00\xf1\x23\x26\x5b\x26\x5c\x26\x5d\x26"
+"\x5e\x38\xa5\x5b\xe5\x53\x48\xa5\x5c\xe5\x54\x48\xa5\x5d\xe5\x55\xaa\xa5\x5e\xe5\x56\x90\x0c\x85\x5e\x86\x5d\x68\x85\x5c\x68\x85"
+"\x5b\xb0\x02\x68\x68\x88\xd0\xc9\x60\x20\x8b\x74\x01\xf0\x21\x42\x49\x80\x85\x52\xb5\x43\x49\x80\x85\x54\xa0\x00\x38\xb5\x15\xf5"
+"\x16\x85\x53\xb5\x24\xf5\x25\x85\x55\xb5\x33\xf5\x34\x85\x56\xa5\x52\xe5\x54\x05\x53\x05\x55\x05\x56\x60\x20\x2c\xc7\xa2\x43\xd5"
+"\x03\xe0\x2c\xc7\xb5\x14\x35\x15\x95\x14\xc6\x04\x4c\x0f\xc7\x20\x0e\x00\x70\x15\x15\x4c\x1b\xc7\xa2\x46\x1d\x00\xf0\x17\x8b\xc7"
+"\x20\xae\xce\xb5\x15\x85\x54\xb5\x24\x85\x55\xa0\xff\xc8\xb1\x54\xd1\x52\xd0\x07\x49\x0d\xd0\xf5\xa8\xf0\x11\xa0\x00\xf0\x0e\x20"
+"\x8b\xc7\xa2\x00\x2a\x00\xf0\x17\xda\xc6\xd0\x01\xc8\x94\x15\x60\x20\xda\xc6\xf0\xf7\x90\xf5\xb0\xf4\x20\xda\xc6\xd0\xee\xf0\xed"
+"\x20\xda\xc6\x90\xe7\xb0\xe6\x20\xda\xc6\xb0\xe0\x90\xdf\x1e\x00\xf0\x02\xda\xb0\xd7\x90\xd6\x20\x0b\xc8\x4c\x95\xc7\x95\x41\xc6"
+"\x04\xa2\x00\x23\x04\xf1\x13\x0b\xc8\x18\xb5\x14\x75\x15\x95\x14\xb5\x23\x75\x24\x95\x23\xb5\x32\x75\x33\x95\x32\xb5\x41\x75\x42"
+"\x4c\x91\xc7\x20\x0b\xc8\xb5\x14\xf5\x1c\x00\x11\xf5\x1c\x00\x11\xf5\x1c\x00\x15\xf5\x1c\x00\x11\x15\x1c\x00\x11\x15\x1c\x00\x11"
+"\x15\x1c\x00\x15\x15\x1c\x00\x11\x55\x1c\x00\x11\x55\x1c\x00\x11\x55\x1c\x00\x11\x55\x1c\x00\x40\xbc\xc8\xa2\x05\x79\x00\xf1\x17"
+"\x61\xc6\x46\x5a\x66\x59\x66\x58\x66\x57\x90\x19\x18\x98\x65\x53\xa8\xa5\x5c\x65\x54\x85\x5c\xa5\x5d\x65\x55\x85\x5d\xa5\x5e\x65"
+"\x56\x29\x7f\x85\x5e\x06\xaa\x03\xf4\x13\x26\x56\xa5\x57\x05\x58\x05\x59\x05\x5a\xd0\xcb\x84\x5b\xa5\x52\x08\xa0\x5b\x20\x9f\xc9"
+"\x28\x10\x03\x20\xc4\xc8\x4c\x0e\xc8\x20\x89\xc6\xbf\x01\xf0\x06\x24\x52\x08\xa0\x57\xd0\xe2\x20\x89\xc6\xa6\x04\xb5\x44\x08\x4c"
+"\x50\xc8\x20\xbc\xc8\x15\x03\xf0\x08\x15\x35\x16\x95\x15\xb5\x24\x35\x25\x95\x24\xb5\x33\x35\x34\x95\x33\xb5\x42\x35\x43\x95\x42"
+"\x3e\x00\x11\xa2\x44\x00\xf0\x0c\xbc\xc8\x18\xb5\x15\x75\x14\xa8\xb5\x24\x75\x23\xca\x4c\x53\xc9\x20\xa2\xc8\x20\x62\xc9\x4c\x0e"
+"\xc8\xa2\x04\x66\x01\xf0\x0a\xdc\xc8\x38\xa9\x00\xa8\xf5\x15\x95\x15\x98\xf5\x24\x95\x24\x98\xf5\x33\x95\x33\x98\xf5\x42\x95\x42"
+"\x77\x04\xf0\x07\x90\x17\xb4\x15\xb9\x21\x03\x95\x15\xb9\x57\x03\x95\x33\xb9\x3c\x03\x95\x24\xb9\x72\x03\x1c\x00\x60\x6a\xc4\xb0"
+"\xfa\xa2\x07\x41\x00\x00\xa1\x02\x58\x30\xbb\x60\xa2\x00\x9e\x04\xf1\x0b\xc9\x30\x90\x22\xc9\x3a\x90\x0a\xe9\x37\xc9\x0a\x90\x18"
+"\xc9\x10\xb0\x14\x0a\x0a\x0a\x0a\xa2\x03\x0a\x26\x80\x04\xf0\x03\x26\x55\xca\x10\xf4\x30\xd7\x8a\x10\x18\x4c\xd6\xc4\x20\x0c\xc7"
+"\xa2\x0c\x39\x01\xb0\xbc\xc8\xb4\x15\xb5\x24\x85\x53\x84\x52\xca\xbc\x05\xf0\x02\x4c\x7c\xc9\x20\x4c\xc9\xa0\x01\xb1\x52\x95\x24"
+"\xc8\xb1\x52\x95\x33\x05\x00\xf0\x3c\x42\x60\xa0\x0d\x20\xa1\xc9\xf0\x07\xa5\x07\x20\xb3\xc9\x95\x24\x95\x33\x95\x42\x60\xa0\x20"
+"\xa5\x0a\x4a\x4a\x4a\x45\x0c\x6a\x26\x08\x26\x09\x26\x0a\x26\x0b\x26\x0c\x88\xd0\xeb\xa0\x08\xa6\x04\xb9\x01\x00\x95\x25\xb9\x02"
+"\x00\x95\x34\xb9\x03\x00\x95\x43\xb9\x00\x00\x95\x16\xe8\x86\x04\xa4\x03\xa9\x00\x5c\x03\xf0\x00\x20\xcb\xc3\xa0\x00\xa9\x0d\xd1"
+"\x52\xf0\x03\xc8\xd0\xf9\x98\x73\x00\xf0\x42\xb1\xce\x4c\x58\xc9\x68\x68\x85\x00\xa5\x10\x85\x05\xa5\x11\x85\x06\x4c\xf2\xc2\x40"
+"\x3d\x31\x3b\x50\x2e\x24\x36\x24\x37\x27\x22\x45\x52\x52\x4f\x52\x20\x22\x3f\x30\x3b\x40\x3d\x38\x3b\x49\x46\x3f\x31\x7c\x3f\x32"
+"\x50\x2e\x22\x20\x4c\x49\x4e\x45\x22\x21\x31\x26\x20\x23\x46\x46\x46\x46\x0d\x00\x00\x50\x2e\x27\x3b\x45\x2e\x0d\xd4\x04\xf1\x4e"
+"\xf2\x6c\x04\xd0\x20\x8b\xc7\xa6\x04\xca\xca\x86\x04\xb4\x16\xb5\x17\x99\x21\x03\xb5\x26\x99\x3c\x03\xb5\x35\x99\x57\x03\xb5\x44"
+"\x99\x72\x03\x60\xe6\x07\x6c\x08\x02\xa9\x00\x20\x7c\xc9\xa9\xff\x20\x7c\xc9\x85\x04\xa0\x7f\x84\x26\x20\x65\xc4\x90\x52\x20\x31"
+"\xc2\xb0\x58\x20\x65\xc4\xa2\x01\x86\x04\x20\xe4\xc4\x20\x2e\xc6\x90\x30\x88\xb0\x21\xa9\x05\x8d\x21\x03\x20\x89\xc5\xbb\x07\x82"
+"\xa4\x03\xb1\x58\xc9\x0d\xf0\x06\xee\x06\x31\x20\x54\xcd\x59\x04\xf0\xad\x85\x25\xc8\xb1\x58\x85\x16\xc8\x84\x03\xa5\x16\x18\xe5"
+"\x17\xa5\x25\xe5\x26\x90\xc8\x4c\xcf\xc2\x20\x31\xc2\xe6\x04\x20\x65\xc4\x4c\x6e\xca\xa5\x16\xa4\x25\x85\x17\x84\x26\xb0\xa1\x20"
+"\x34\xc4\xa4\x15\xf0\x10\x90\x0f\xc6\x04\xb5\x15\xd9\x3f\x02\xf0\x06\x88\x84\x15\xd0\xf6\x00\xbe\x3f\x02\x18\xbd\x21\x03\x79\x4a"
+"\x02\x9d\x21\x03\x85\x52\xbd\x3c\x03\x79\x55\x02\x9d\x3c\x03\x85\x53\xbd\x57\x03\x79\x60\x02\x9d\x57\x03\x85\x54\xbd\x72\x03\x79"
+"\x6b\x02\x9d\x72\x03\xaa\xa5\x52\x38\xf9\x76\x02\x85\x52\xa5\x53\xf9\x81\x02\x85\x53\xa5\x54\xf9\x8c\x02\x85\x54\x8a\xf9\x97\x02"
+"\x05\x52\x05\x53\x05\x54\xf0\x0f\x8a\x59\x6b\x02\x59\x97\x02\x10\x04\xb0\x04\x90\x0f\xb0\x0d\xb9\xa2\x02\x85\x05\xb9\xad\x02\x85"
+"\x06\x4c\xff\xcb\xc6\x15\x4c\x58\xc5\x20\x34\xc4\x90\x11\x7e\x06\xf0\x0f\x2c\xca\x98\xa4\x15\xc0\x0b\xb0\x04\x99\x40\x02\xa9\x00"
+"\x99\x6c\x02\x99\x61\x02\x99\x56\x02\xa9\x01\x99\x4b\x02\xa2\x16\x7f\x02\x40\x8b\xc7\xa4\x15\x08\x03\xfa\x06\x16\x99\x77\x02\xb5"
+"\x25\x99\x82\x02\xb5\x34\x99\x8d\x02\xb5\x43\x99\x98\x02\xa2\x1a\x21\x00\x10\x4b\x21\x00\x10\x56\x21\x00\x10\x61\x21\x00\xf0\x04"
+"\x6c\x02\x20\x0c\xc5\xa4\x15\xa5\x05\x99\xa3\x02\xa5\x06\x99\xae\x02\xe6\x15\x6c\x06\x20\x1f\xcc\x17\x00\x90\x14\xc0\x0e\xb0\x22"
+"\xa5\x05\x99\xcf\x1b\x00\xf0\x02\xdd\x02\xe6\x14\x90\x1f\x20\xe4\xc4\xa4\x14\xf0\x2a\xc6\x14\xb9\xce\xb0\x00\x60\xdc\x02\x85\x06"
+"\x20\x00\x7c\x06\xf0\x0a\x20\x1f\xcc\x20\xe4\xc4\xa5\x57\xd0\x05\x20\x2e\xc6\xb0\x69\xa4\x58\xa5\x59\x84\x05\x4c\xfd\xcb\x00\xd1"
+"\x07\x91\x20\xf0\xf9\xc9\x61\x90\x50\x85\x57\xfb\x06\xf8\x06\x48\x0a\xaa\xbd\x8d\x03\x85\x58\x20\xf6\xc4\xbd\x8e\x03\x85\x59\x05"
+"\x58\xd0\x34\xa8\x0f\x06\x50\xc8\xb1\x58\x30\x45\x35\x07\x10\x58\x35\x07\xf0\x02\x58\x88\xc5\x57\xf0\x06\x20\xa1\xce\x4c\x4a\xcc"
+"\x20\xa2\xce\xa5\x58\x32\x07\x10\x59\x32\x07\xb0\x20\xbc\xc8\xa9\x00\x85\x57\x60\x20\x72\xc3\x1f\x08\x30\x05\xa2\x2b\xec\x00\xf0"
+"\x15\x09\xcd\xa5\x05\x48\xa5\x06\x48\xa5\x03\x48\xa0\x00\x84\x03\xc8\x84\x06\xa0\x40\x84\x05\x20\x2c\xca\x68\x85\x03\x68\x85\x06"
+"\x68\x85\x05\xa2\x2c\x28\x00\xf1\x13\x8b\xc7\xa0\x54\x20\xcd\xc3\x20\x09\xcd\xa2\x40\xa0\x00\xbd\x00\x01\x91\x54\xc9\x0d\xf0\xb3"
+"\xe8\xc8\xd0\xf3\x20\x0c\xc7\xa4\x13\xf0\xeb\x53\x01\x90\xf0\x05\xc6\x13\x4c\x58\xc5\xb9\xb8\xf0\x00\xb0\xc3\x02\x4c\xfd\xcb\xa6"
+"\x13\xe0\x0b\xb0\x1a\xac\x07\xf0\x40\xa5\x05\x9d\xb9\x02\xa5\x06\x9d\xc4\x02\xe6\x13\x4c\x1b\xc3\xa9\x3f\xa0\x40\xd0\x02\xa0\x00"
+"\x20\x4c\xca\x84\x52\xa4\x52\x20\xe6\xff\xc9\x7f\xd0\x07\x88\xc4\x52\x10\xf4\x30\xf0\xc9\x18\xd0\x06\x20\x54\xcd\x4c\x16\xcd\xc9"
+"\x1b\xd0\x03\x4c\xcf\xc2\x99\x00\x01\xc9\x0d\xf0\x19\xc8\x98\x38\xe5\x52\xc9\x40\x90\xd1\x20\xe3\x2f\x00\xe0\xf9\x20\xf4\xff\x4c"
+"\x1f\xcd\x20\xed\xff\xa9\x00\x85\x07\x82\x06\x31\x20\xae\xce\xa9\x00\x00\x28\x06\x10\x52\xa4\x00\x20\xd0\xf7\x1e\x02\xd1\x81\xcd"
+"\x4c\xf1\xc3\x20\x81\xcd\x4c\x09\xc4\x20\xe1\x09\x05\xf0\x00\x18\xb5\x16\x75\x15\x95\x15\xb5\x25\x75\x24\x95\x24\x86\x04\x8c\x08"
+"\x31\xa5\x12\x85\xe3\x0a\xf0\x19\x88\xc8\xb1\x0d\xc9\x0d\xd0\xf9\x20\xbc\xcd\xb1\x0d\x30\x03\xc8\xd0\xef\xc8\x20\xbc\xcd\x4c\xcf"
+"\xc2\x18\x98\x65\x0d\x85\x0d\x90\x02\xe6\x0e\xa0\x01\x60\x84\x56\xbc\x01\xf0\x06\x48\xa5\x58\x85\x52\xe9\x01\x85\x58\x85\x0d\xa5"
+"\x59\x85\x53\xe9\x00\x85\x0e\x85\x59\xa9\x07\x51\x52\xd0\xfb\x18\x98\x30\x09\x30\x02\xe6\x53\x9d\x04\xf0\x03\x91\x0d\xc9\x0d\xf0"
+"\x09\xc8\xd0\xf5\xe6\x53\xe6\x0e\xd0\xef\xc8\xd0\x04\x09\x00\xf1\x27\xb1\x52\x91\x0d\x10\xea\x20\xbd\xcd\xa0\x01\x84\x57\x88\xa9"
+"\x0d\xd1\x56\xf0\x5d\xc8\xd1\x56\xd0\xfb\xc8\xc8\xa5\x0d\x85\x54\xa5\x0e\x85\x55\x20\xbd\xcd\x85\x52\xa5\x0e\x85\x53\x88\xa9\x55"
+"\x91\x0d\xd1\x0d\xd0\xb2\x0a\x07\x00\xf0\x1c\xab\xb1\x54\x91\x52\x98\xd0\x04\xc6\x55\xc6\x53\x88\x98\x65\x54\xa6\x55\x90\x01\xe8"
+"\xc5\x58\x8a\xe5\x59\xb0\xe5\xa0\x01\xa5\x25\x91\x58\xc8\xa5\x16\x91\x58\x38\x20\xa2\xce\x0e\x01\x70\x56\x91\x58\xc9\x0d\xd0\xf7"
+"\xcb\x03\x00\x2b\x09\x80\x84\x05\x84\x03\xa5\x12\x85\x06\x8d\x0a\x31\xde\xc4\xca\xd7\x04\xf2\x08\xb5\x17\x91\x52\x60\x18\x98\x65"
+"\x58\x85\x58\x90\x02\xe6\x59\x4c\x00\xc5\x20\x79\xc2\xa2\x26\x00\x02\xc0\x20\xcb\xc3\xa4\x03\x60\x20\xf6\xc4\x84\x53\x88\xb6\x0a"
+"\xd0\xc9\x0d\xf0\xf9\x9d\x40\x01\xe8\xc8\xc9\x22\xd0\xf1\x4f\x0b\xf0\x14\xf0\x0e\xa9\x0d\x9d\x3f\x01\x84\x03\xa9\x40\x85\x52\xa6"
+"\x04\x60\xc8\xb0\xda\x20\xfa\xce\x88\x84\x56\x38\x20\xe0\xff\x4c\x9b\xcd\x20\xb1\xce\xf1\x09\xf0\x2b\x84\x54\xa5\x12\x85\x55\xa2"
+"\x52\x60\x20\xfa\xce\x84\x58\x85\x59\xa5\x0d\x85\x5a\xa5\x0e\x85\x5b\xa9\xb2\x85\x56\xa9\xc2\x85\x57\x18\x20\xdd\xff\x4c\x5b\xc5"
+"\x38\xa9\x00\x2a\x48\x20\x3e\xcf\xa2\x52\x68\x20\xda\xff\xa0\x52\x20\x9f\xc9\x46\x06\x00\xf2\x05\x10\xca\xaf\x01\xf0\x00\xbc\xc8"
+"\x20\xde\xc4\x20\xcb\xc3\x20\x41\xcf\xa2\x52\x20\xd7\x33\x00\x00\x2f\x0d\x40\x52\x20\xd4\xff\x94\x05\x30\x5b\xcf\xa4\x0b\x00\x70"
+"\x95\x24\x20\xd4\xff\x95\x33\x05\x00\x11\x42\xbe\x05\x20\x31\xc2\x9c\x0b\x01\x37\x00\x80\xa5\x52\x6c\x16\x02\x20\x7b\xcf\x02\x01"
+"\xf0\x0e\x7b\xcf\xa2\x01\xb5\x52\x20\xd1\xff\xe8\xe0\x04\x90\xf6\xb0\xec\x38\x08\x20\xb1\xce\xa2\x52\x28\x20\xce\xff\xa6\x04\x50"
+"\x00\x20\xbc\xc8\x47\x05\x41\x41\xcf\x20\xcb\x6a\x00\x23\x2c\xc2\xce\x00\xf3\x07\xb1\x52\x84\x55\xa4\x0f\x48\x20\xd1\xff\x68\xc9"
+"\x0d\xf0\xe4\xa4\x55\xc8\xd0\xec\x20\x2c\x65\x00\x20\xa0\x00\x1d\x00\xf0\x39\x20\xd4\xff\xa4\x55\x91\x52\xc8\xc9\x0d\xd0\xf0\xf0"
+"\xc2\x50\x4c\x4f\x54\xf5\x4e\x44\x52\x41\x57\xf5\x42\x4d\x4f\x56\x45\xf5\x46\x43\x4c\x45\x41\x52\xf6\x7b\x44\x49\x4d\xf0\xae\x5b"
+"\xf2\xa1\x4f\x4c\x44\xf5\x31\x57\x41\x49\x54\xf1\x4c\xc5\x50\xa4\x5e\xb1\x05\xc9\x40\x90\x12\xc9\x5b\xb0\x0e\xc2\x0a\xf2\x03\x09"
+"\x20\x8b\xf0\x20\x4f\xc9\x4c\x62\xc9\x4c\x24\xca\xa2\xff\xa4\x5e\xc6\x21\x00\xf0\x04\x09\xc9\x5b\xb0\x05\xc8\xd1\x05\xf0\x25\xa4"
+"\x5e\xe8\xc8\xbd\x00\xf0\x30\x0c\x13\x0e\xd2\xe8\xbd\xff\xef\x10\xfa\xd0\xeb\x85\x53\xbd\x01\xf0\xdb\x0d\xf0\x13\xe6\x5e\x6c\x52"
+"\x00\x20\x8b\xf0\x4c\xf1\xc3\xc8\x84\x03\xe9\x40\x48\x20\xbc\xc8\x68\xa8\xb5\x15\x0a\x36\x24\x0a\x36\x24\x18\x79\xeb\x02\x1d\x08"
+"\xe0\x79\x06\x03\x95\x24\xb0\xd7\x60\xa5\x01\x05\x02\xf0\x22\x5d\x05\x10\x1e\x3e\x08\x01\x8b\x06\xf0\x07\x38\xa5\x23\x99\x21\x03"
+"\x75\x17\x85\x23\xa5\x24\x99\x3c\x03\x75\x26\x4c\x19\xf1\x00\xa4\x9e\x0c\x20\x40\x90\x9e\x0c\x10\xf3\xa9\x00\x71\xee\xe9\x40\x48"
+"\xc8\x84\x03\x5d\x00\xa1\xa5\x23\x99\xeb\x02\xa5\x24\x99\x06\x03\x40\x00\xf1\x15\xc8\xd0\x02\xf6\x25\x98\x0a\x36\x25\x0a\x36\x25"
+"\x18\x65\x23\x85\x23\xb5\x25\x65\x24\xb0\xbd\x85\x24\xa0\x00\xa9\xaa\x91\x23\xd1\x23\xd0\xf7\x4a\x07\x00\x10\xf0\xa8\x04\x11\xa5"
+"\x5a\x00\xf0\x06\x2c\xd0\x05\xe6\x03\x4c\xae\xf0\x4c\x58\xc5\xa5\x0d\x85\x23\xa5\x0e\x85\x24\x4c\x83\x4f\x02\xf0\xfb\x20\x66\xfe"
+"\x4c\x5b\xc5\x1c\x8a\x1c\x23\x5d\x8b\x1b\xa1\x9d\x8a\x1d\x23\x9d\x8b\x1d\xa1\x00\x29\x19\xae\x69\xa8\x19\x23\x24\x53\x1b\x23\x24"
+"\x53\x19\xa1\x00\x1a\x5b\x5b\xa5\x69\x24\x24\xae\xae\xa8\xad\x29\x00\x7c\x00\x15\x9c\x6d\x9c\xa5\x69\x29\x53\x84\x13\x34\x11\xa5"
+"\x69\x23\xa0\xd8\x62\x5a\x48\x26\x62\x94\x88\x54\x44\xc8\x54\x68\x44\xe8\x94\x00\xb4\x08\x84\x74\xb4\x28\x6e\x74\xf4\xcc\x4a\x72"
+"\xf2\xa4\x8a\x00\xaa\xa2\xa2\x74\x74\x74\x72\x44\x68\xb2\x32\xb2\x00\x22\x00\x1a\x1a\x26\x26\x72\x72\x88\xc8\xc4\xca\x26\x48\x44"
+"\x44\xa2\xc8\x00\x02\x00\x08\xf2\xff\x80\x01\xc0\xe2\xc0\xc0\xff\x00\x00\x08\x00\x10\x80\x40\xc0\x00\xc0\x00\x40\x00\x00\xe4\x20"
+"\x80\x00\xfc\x00\x08\x08\xf8\xfc\xf4\x0c\x10\x04\xf4\x00\x20\x10\x00\x00\x0f\x01\x01\x01\x11\x11\x02\x02\x11\x11\x02\x12\x02\x00"
+"\x08\x10\x18\x20\x28\x30\x38\x40\x48\x50\x58\x60\x68\x70\x78\x80\x88\x90\x98\xa0\xa8\xb0\xb8\xc0\xc8\xd0\xd8\xe0\xe8\xf0\xf8\x0c"
+"\x2c\x4c\x4c\x8c\xac\xcc\xec\x8a\x9a\xaa\xba\xca\xda\xea\xfa\x0e\x2e\x4e\x6e\x8e\xae\xce\xee\x0d\x2d\x4d\x6d\x8d\xad\xcd\xed\x0d"
+"\x0d\x0c\x0d\x0e\x0d\x0c\x0d\x08\x00\x00\x04\x00\x93\x0f\x0d\x0c\x0d\x09\x0d\x0c\x0d\x08\x04\x00\x90\x0f\x06\x0b\x0b\x04\x0a\x08"
+"\x08\x0d\x01\x00\xf0\x04\x0f\x0d\x0f\x07\x07\x07\x07\x05\x09\x03\x03\x01\x01\x01\x01\x02\x01\x01\x01\x60\x01\xf1\x1d\xe6\x03\xc9"
+"\x20\xf0\xf6\x60\xe6\x03\x4c\x1b\xc3\xb1\x05\xc9\x5d\xf0\xf5\x20\xf6\xc4\xc6\x03\x20\x8e\xf3\xc6\x03\xa5\x52\x48\xa5\x53\x48\xad"
+"\x21\x03\x48\xa9\x00\x85\x34\x85\x43\x44\x08\xf1\x24\xa5\x01\x85\x16\xa5\x02\x85\x25\x20\x89\xc5\x20\x79\xf3\x68\x8d\x21\x03\x68"
+"\x20\x7e\xf3\x68\x20\x76\xf3\xa0\x00\xc4\x00\xf0\x09\xb9\x66\x00\x20\x76\xf3\xc8\xd0\xf3\xc0\x03\xf0\x0c\x20\x79\xf3\x20\x4c\xca"
+"\x67\x08\x12\xf0\xa4\x0d\x25\xf0\x0a\x79\x08\x10\xf0\x79\x08\x01\x08\x0e\x50\xc8\xc9\x3b\xf0\x0c\xa2\x0d\x01\xf1\x05\xf1\x0f\x20"
+"\x1d\xc5\x4c\xa1\xf2\x20\x91\xf2\x85\x66\x20\x91\xf2\xc5\x66\xd0\x10\xc9\x40\x90\x0c\xc9\x5b\xb0\x08\x38\x20\x8e\xf0\xaf\x04\xd0"
+"\xad\x31\x03\x91\x52\xad\x4c\x03\xc8\x91\x52\xa9\x00\x62\x0f\x73\x91\x52\xd0\x36\x20\x91\xf2\x75\x0e\x50\xf5\xad\x31\x03\x85\x20"
+"\x00\xe0\x85\x53\x60\x20\x7e\xf3\xa9\x20\x4c\x4c\xca\xa2\xff\x48\x29\x10\xf0\x02\x20\xf9\xc5\x68\x29\x0f\x4c\xf9\xc5\xa2\x00\x86"
+"\x00\x86\x64\x86\x65\x36\x00\xf0\x05\x3a\xf0\x91\xc9\x3b\xf0\xca\xc9\x0d\xf0\xc6\xc9\x5c\xf0\xb7\xa0\x05\x38\x69\x00\x84\x0a\xf0"
+"\x31\x26\x6a\x26\x69\x88\xd0\xf8\xe8\xe0\x03\xd0\xd8\x06\x6a\x26\x69\xa2\x40\xa5\x69\xdd\x54\xf1\xf0\x04\xca\xd0\xf8\x00\xbc\x94"
+"\xf1\xc4\x6a\xd0\xf5\xbd\x10\xf2\x85\x66\xbc\x50\xf2\x84\x0f\x66\x64\x66\x65\x88\xd0\xf9\xa4\x0f\xc0\x0d\xd0\x05\xa2\x00\x4c\x9b"
+"\xf4\x5c\x00\xf0\x00\x40\xf0\x5b\xc9\x28\xf0\x65\xa2\x01\xc9\x41\xf0\xec\xc6\x03\x75\x10\xf0\x42\x91\xf2\xc9\x2c\xd0\x31\x20\x91"
+"\xf2\xa4\x25\xf0\x15\xa2\x09\xc9\x58\xf0\x7f\xca\xc9\x59\xd0\x79\xa5\x0f\xc9\x09\xd0\x74\xa2\x0e\xd0\x70\xa2\x04\xc9\x58\xf0\x6a"
+"\xc9\x59\xd0\x65\xca\xa4\x0f\xc0\x03\xb0\x5f\xa2\x08\xd0\x5b\xc6\x03\xa2\x02\xa4\x0f\xc0\x0c\xf0\x51\xa2\x05\xa5\x25\xf0\x4b\xa2"
+"\x0c\xd0\x47\x20\x8b\xc7\xa5\x0f\xa2\x43\x0f\x43\x3c\xe8\xd0\x39\x5d\x00\x70\x29\xf0\x16\xc9\x2c\xd0\x2a\x7e\x00\x30\x58\xd0\x23"
+"\x07\x00\xf0\x02\x29\xd0\x1c\xa2\x0b\xd0\x19\xa2\x0d\xa5\x0f\xc9\x0b\xf0\x11\xa2\x0a\x15\x00\x30\x2c\xd0\x07\x07\x00\xf1\x8b\x59"
+"\xf0\x01\x00\x20\x60\xf3\xbd\xd5\xf1\xf0\x04\x25\x64\xd0\x07\xbd\xe4\xf1\x25\x65\xf0\xec\x18\xbd\xf3\xf1\x65\x66\x85\x66\xbd\x02"
+"\xf2\xa2\x00\x86\x04\xa4\x16\x84\x67\xa4\x25\x84\x68\xc9\x0f\xf0\x23\x29\x0f\xa8\xc8\x84\x00\xc0\x02\xd0\x04\xa4\x68\xd0\xc3\xa0"
+"\x00\xb9\x66\x00\x91\x52\xc8\xee\x31\x03\xd0\x03\xee\x4c\x03\xc4\x00\xd0\xee\x60\xa9\x02\x85\x00\x38\xa5\x67\xed\x31\x03\x85\x67"
+"\xa5\x68\xed\x4c\x03\x85\x68\x38\xa5\x67\xe9\x02\x85\x67\xa8\xa5\x68\xe9\x00\xf0\x1f\xc9\xff\xf0\x16\x20\xd1\xf7\x4f\x55\x54\x20"
+"\x4f\x46\x20\x52\x41\x4e\x47\x45\x3a\x0a\x0d\x84\x67\x30\xb0\x98\x30\xad\x10\xe5\x98\x10\xa8\x30\xe0\x34\x06\xf6\x0f\x52\xa5\x12"
+"\x85\x53\x98\xc8\x91\x52\x4c\x9b\xcd\xa2\x05\xd0\x02\xa2\x0c\x86\x16\xe6\x04\xd0\x06\x20\xbc\xc8\x20\x31\xc2\x06\x00\xf0\x03\xe4"
+"\xc4\xb5\x15\x85\x5c\xb5\x24\x85\x5d\xb5\x14\x85\x5a\xb5\x23\x85\x5b\xb7\x00\xf2\x1b\xa2\x03\xbd\xc1\x03\x95\x52\xca\x10\xf8\xa5"
+"\x16\x29\x04\xd0\x13\xa2\x02\x18\xb5\x5a\x75\x52\x95\x5a\xb5\x5b\x75\x53\x95\x5b\xca\xca\x10\xef\xa2\x03\xb5\x5a\x9d\xc1\x03\x23"
+"\x00\xe0\x03\xf0\x0b\x85\x5e\xa5\x16\x29\x08\xf0\x06\x20\x78\xf6\xa6\x11\xf0\x47\x02\x38\xb5\x5a\xf5\x52\xb4\x52\x94\x5a\x95\x52"
+"\xb4\x53\xb5\x5b\xf5\x53\x94\x5b\x95\x53\x95\x56\x10\x0d\xa9\x00\x38\xf5\x52\x95\x52\xa9\x00\xf5\x53\x95\x53\xca\xca\x10\xd6\xa5"
+"\x54\xc5\x52\xa5\x55\xe5\x53\x90\x31\xa9\x00\xe5\x54\x85\x57\xa9\x00\xe5\x55\x38\x6a\x85\x59\x66\x57\x20\x78\xf6\xa5\x5c\xcd\xc3"
+"\x03\xd0\x0a\xa5\x5d\xcd\xc4\x03\xd0\x03\x7a\x06\xf1\x06\x55\xf6\xa5\x59\x30\xe5\x20\x44\xf6\x4c\xfb\xf5\xa5\x53\x4a\x85\x59\xa5"
+"\x52\x6a\x85\x2b\x00\xf0\x0e\x5a\xcd\xc1\x03\xd0\x07\xa5\x5b\xcd\xc2\x03\xf0\xd5\x20\x44\xf6\xa5\x59\x10\xe8\x20\x55\xf6\x4c\x26"
+"\xf6\x38\xa5\x57\x5a\x00\xf0\xad\xa5\x59\xe5\x55\x85\x59\xa2\x00\xf0\x0f\x18\xa5\x57\x65\x52\x85\x57\xa5\x59\x65\x53\x85\x59\xa2"
+"\x02\xb5\x56\x10\x09\xb5\x5a\xd0\x02\xd6\x5b\xd6\x5a\x60\xf6\x5a\xd0\xfb\xf6\x5b\x60\x6c\xfe\x03\x20\xc8\xc3\xa0\x00\xa5\x52\xf0"
+"\x3e\xc9\x05\x90\x02\xa9\x04\xa2\x80\x86\x54\x84\x53\x85\x52\xaa\xbd\xce\xf6\xa6\x12\x10\x04\xc5\x12\xb0\xe1\xaa\x98\x91\x53\x88"
+"\xd0\xfb\xe6\x54\xe4\x54\xd0\xf5\xa4\x52\xb9\xd8\xf6\x8d\xff\x03\xb9\xd3\xf6\x8d\xfe\x03\xb9\xdd\xf6\x8d\x00\xb0\x4c\x58\xc5\xa9"
+"\x40\x99\x00\x80\x99\x00\x81\x88\xd0\xf7\xf0\xdc\x84\x86\x8c\x98\xe2\x3b\x54\x6d\xaa\xf6\xf7\xf7\xf7\xf7\x00\x30\x70\xb0\xf0\xa5"
+"\x5b\x05\x5d\xd0\x52\xa5\x5a\xc9\x40\xb0\x4c\x4a\x85\x5f\xa9\x2f\x38\xe5\x5c\xc9\x30\xb0\x40\xa2\xff\x38\xe8\xe9\x03\xb0\xfb\x69"
+"\x03\x85\x61\x8a\x59\x03\xf0\x18\x0a\x05\x5f\x85\x5f\xa9\x80\x69\x00\x85\x60\xa5\x5a\x4a\xa5\x61\x2a\xa8\xb9\xcb\xf7\xa0\x00\xa6"
+"\x5e\xca\xf0\x0f\xca\xf0\x07\x49\xff\x31\x5f\x91\x5f\x60\x51\x05\x00\x10\x11\x05\x00\x01\x59\x00\x70\xf9\xa5\x5a\x30\xf5\x4a\x4a"
+"\x59\x00\x10\x3f\x59\x00\x41\x40\x90\x32\x60\x19\x00\x52\xe0\xa5\x5a\x30\xdc\x19\x00\x10\x5f\x19\x00\x32\x60\x90\x19\x19\x00\x52"
+"\xc7\xa5\x5a\x30\xc3\x19\x00\x10\xbf\x19\x00\x96\xc0\xb0\xb5\xa0\x00\x84\x60\x0a\x26\x03\x00\x80\x65\x5f\x85\x5f\xa5\x60\x69\x80"
+"\x89\x00\x91\x29\x07\xa8\xb9\xc9\xf7\x4c\x20\xf7\x56\x00\x39\xbc\xa5\x5a\x3b\x00\x13\xac\x3b\x00\xf0\x0d\x10\xc0\x80\x40\x20\x10"
+"\x08\x04\x02\x01\x68\x85\xe8\x68\x85\xe9\xa0\x00\xe6\xe8\xd0\x02\xe6\xe9\xb1\xe8\x30\x06\x95\x0a\xf3\x0b\xd7\xf7\x6c\xe8\x00\xa2"
+"\xd4\x20\xf1\xf7\xb5\x01\x20\x02\xf8\xe8\xe8\xb5\xfe\x20\x02\xf8\xa9\x20\x4c\xf4\x82\x04\x54\x0b\xf8\x68\x29\x0f\x14\x12\xf1\x05"
+"\x4c\xf4\xff\x20\x76\xf8\xa2\x00\xc9\x22\xf0\x06\xe8\xd0\x1b\x4c\x7d\xfa\xc8\xb9\xf1\x0a\x10\xf5\x62\x09\x00\xb0\x14\x01\x10\x00"
+"\x31\x22\xf0\xe8\x63\x09\xf1\x22\xa9\x40\x85\xc9\xa9\x01\x85\xca\xa2\xc9\x60\xa0\x00\xb5\x00\x99\xc9\x00\xe8\xc8\xc0\x0a\x90\xf5"
+"\xa0\xff\xa9\x0d\xc8\xc0\x0e\xb0\x07\xd1\xc9\xd0\xf7\xc0\x00\x60\x20\xd1\xf7\x4e\x41\x4d\x45\xea\x00\x3e\x00\xf0\x1d\x20\xf0\xf8"
+"\x60\xc9\x30\x90\x0f\xc9\x3a\x90\x08\xe9\x07\x90\x07\xc9\x40\xb0\x02\x29\x0f\x60\x38\x60\xa9\x00\x95\x00\x95\x01\x95\x02\x20\x76"
+"\xf8\xb9\x00\x01\x20\x7e\xf8\xb0\x15\x9f\x01\xf0\x22\x94\x02\xa0\x04\x0a\x36\x00\x36\x01\x88\xd0\xf8\xb4\x02\xc8\xd0\xe3\xb5\x02"
+"\x60\x43\x41\x54\xfa\x2a\x4c\x4f\x41\x44\xf9\x58\x53\x41\x56\x45\xfa\xbb\x52\x55\x4e\xfa\x20\x4d\x4f\x4e\xfa\x1a\x4e\x4f\x07\x00"
+"\x21\x19\x46\x1e\x00\xf0\x12\x55\x44\x4f\x53\x0d\xe0\x00\xf9\x26\xa2\xff\xd8\xa0\x00\x84\xdd\x20\x76\xf8\x88\xc8\xe8\xbd\xbe\xf8"
+"\x30\x18\xd9\x00\x01\xf0\xf4\xca\x0c\x00\x30\x10\xfa\xe8\xe6\x00\xf0\x85\x2e\xd0\xdd\xc8\xca\xb0\xe3\x85\xca\xbd\xbf\xf8\x85\xc9"
+"\x18\xa2\x00\x6c\xc9\x00\x20\xd1\xf7\x43\x4f\x4d\x3f\xea\x00\x20\x8e\xfb\x50\xfa\xf0\xf9\x20\x2b\xfc\xa0\x00\x20\xd4\xff\x91\xcb"
+"\xe6\xcb\xd0\x02\xe6\xcc\xa2\xd4\x20\x08\xfa\xd0\xee\x38\x66\xdd\x18\x66\xdd\x28\x60\x38\x66\xdd\x20\x18\xf8\xa2\xcb\x20\x93\xf8"
+"\xf0\x04\xa9\xff\x85\xcd\x20\x76\xfa\xa2\xc9\x6c\x0c\x02\x08\x78\x20\x4f\xf8\x08\x20\x3e\xfc\x28\xf0\xb5\xa9\x00\x85\xd0\x85\xd1"
+"\x20\xa2\xf9\x90\xc9\xe6\xd0\xe6\xcc\xd0\xf5\x18\x90\xc0\x20\xf4\xff\xc8\xb9\xed\x00\xc9\x0d\xd0\xf5\xc8\x20\xfd\xf7\xc0\x0e\x90"
+"\xf8\x60\xa9\x00\x85\xdc\x77\x00\xf1\x30\xf8\xd0\xf5\x20\xc9\xfb\x08\x20\xe2\xfb\x28\xf0\x10\xa5\xdb\x29\x20\x05\xea\xd0\xe3\x20"
+"\x92\xf9\x20\xed\xff\xd0\xdb\xa2\x02\xa5\xdd\x30\x13\xb5\xcf\xd5\xd8\xb0\x08\xa9\x05\x20\x40\xfc\x20\x3e\xfc\xd0\xc5\xca\xd0\xed"
+"\x20\x2b\xfc\x24\xdb\x50\x0b\x88\xc8\xae\x00\xf0\x4d\xc4\xd8\xd0\xf6\xa5\xdc\x85\xce\x20\xd4\xff\xc5\xce\xf0\x08\x20\xd1\xf7\x53"
+"\x55\x4d\xea\x00\x26\xdb\x60\xf6\x00\xd0\x02\xf6\x01\xb5\x00\xd5\x02\xd0\x04\xb5\x01\xd5\x03\x60\xca\x20\x76\xfa\x86\xea\x60\x20"
+"\x58\xf9\x24\xdd\x70\x4c\x6c\xd6\x00\x08\x20\x76\xfa\x20\x3e\xfc\x20\x8e\xfb\x70\x02\x28\x60\xf0\x0a\xa0\x00\x20\x99\xf9\x20\xec"
+"\xf7\xd0\x19\x20\xc9\xfb\x20\xe2\xfb\x8b\x00\x70\xec\xf7\x26\xdb\x10\x09\xe8\x67\x02\x40\xfd\x20\x02\xf8\x9b\x00\x40\xcf\x4c\xed"
+"\xff\x08\x01\xf0\x05\x13\x60\xa2\xcb\x20\x65\xfa\x20\x76\xfa\x6c\xcb\x00\x20\x76\xf8\xc9\x0d\xf0\xa2\x80\x00\xf1\x24\x59\x4e\x3f"
+"\xea\x00\x38\xa5\xd1\xe5\xcf\x48\xa5\xd2\xe5\xd0\xa8\x68\x18\x65\xcb\x85\xcd\x98\x65\xcc\x85\xce\xa0\x04\xb9\xca\x00\x20\xd1\xff"
+"\x88\xd0\xf7\xb1\xcf\x20\xd1\xff\xe6\xcf\xd0\x02\xe6\xd0\xa2\xcb\x6c\x01\x22\x28\x60\x63\x01\xf2\x0d\x65\xfa\xa2\xd1\x20\x65\xfa"
+"\xa2\xcd\x20\x93\xf8\x08\xa5\xcb\xa6\xcc\x28\xd0\x04\x85\xcd\x86\xce\x85\xcf\x86\xd0\x77\x01\x13\x0e\x77\x01\xf1\x41\xa9\x06\x20"
+"\x40\xfc\xa2\x07\x20\x7a\xfb\x28\xf0\x8e\xa2\x04\xb5\xce\x95\xd2\xca\xd0\xf9\x86\xd0\x86\xd1\xa5\xd5\xd0\x02\xc6\xd6\xc6\xd5\x18"
+"\x66\xd2\x38\xa2\xff\xa5\xd5\xe5\xd3\x85\xcf\xa5\xd6\xe5\xd4\x08\x66\xd2\x28\x90\x06\x18\xf0\x03\x86\xcf\x38\x66\xd2\xe8\x20\x3b"
+"\xfb\xe6\xd0\xe6\xd4\xe6\xcc\x26\xd2\xb0\xd5\x28\x60\x4b\x00\x61\x86\xdc\xa0\x04\xa9\x2a\xa5\x00\x60\xf8\xb1\xc9\x20\xd1\xff\x58"
+"\x0b\x35\xf6\xa0\x08\xba\x00\x50\x20\x81\xfb\x24\xd2\x81\x01\x70\xb1\xd3\x20\xd1\xff\xc4\xcf\x81\x01\xf0\x19\x20\xd1\xff\xa2\x04"
+"\x8e\x02\xb0\xa2\x78\xd0\x02\xa2\x1e\x20\x66\xfe\xca\xd0\xfa\x60\xa2\x06\xd0\xf5\x2c\x01\xb0\x10\xfb\x50\xf9\xa0\x00\x85\xc3\xa9"
+"\x10\x85\xc2\x0f\x00\xf0\x0b\x0f\x50\x0d\x20\xbd\xfc\xb0\xec\xc6\xc3\xd0\xf0\xc6\xc2\xd0\xec\x70\x01\x60\xa0\x04\x08\x20\xe4\xfb"
+"\x28\x79\x00\x90\xd9\xd3\x00\xd0\x03\x88\xd0\xf8\x60\xe0\x01\x12\x99\x3a\x02\x00\x5e\x0d\xf0\x57\xc9\xd9\xed\x00\xd0\xea\xc9\x0d"
+"\xd0\xf4\x60\xa0\x08\x20\xd4\xff\x99\xd3\x00\x88\xd0\xf7\x60\x86\xec\x84\xc3\x08\x78\xa9\x78\x85\xc0\x20\xbd\xfc\x90\xf7\xe6\xc0"
+"\x10\xf7\xa9\x53\x85\xc4\xa2\x00\xac\x02\xb0\x20\xcd\xfc\xf0\x00\xf0\x01\xe8\xc6\xc4\xd0\xf4\xe0\x0c\x66\xc0\x90\xe5\xa5\xc0\x28"
+"\xa4\xc3\xa6\xec\x48\x18\x65\xdc\x85\xdc\x68\x60\xa5\xcd\x30\x08\xa5\xd4\x85\xcb\xa5\xd5\x85\xcc\x60\xb0\x04\xa9\x06\xd0\xb6\x05"
+"\xf1\x13\x07\x8e\x02\xb0\x24\xea\xd0\x2d\xc9\x05\xf0\x16\xb0\x09\x20\xd1\xf7\x50\x4c\x41\x59\xd0\x15\x20\xd1\xf7\x52\x45\x43\x4f"
+"\x52\x44\xd0\x0a\x0b\x00\xf2\x05\x57\x49\x4e\x44\xea\x20\xd1\xf7\x20\x54\x41\x50\x45\xea\x20\xe3\xff\x4c\xed\xff\x8e\x00\xf0\x02"
+"\x48\x20\x23\xfc\x85\xc0\x20\xd8\xfc\xa9\x0a\x85\xc1\x18\x90\x0a\xa2\x52\x00\xf1\x01\x20\xda\xfc\x30\x13\xa0\x04\xa9\x04\x8d\x02"
+"\xb0\x20\xd8\xfc\xee\x06\x00\xa0\x88\xd0\xef\x38\x66\xc0\xc6\xc1\xd0\xda\x97\x00\x31\x68\x28\x60\xb8\x00\x30\xe8\xf0\x07\xbb\x00"
+"\xf1\x7d\xf8\xe0\x08\x60\x84\xc5\xad\x02\xb0\xa8\x45\xc5\x29\x20\x60\xa2\x00\xa9\x10\x2c\x02\xb0\xf0\xfb\x2c\x02\xb0\xd0\xfb\xca"
+"\x10\xf3\x60\xc9\x06\xf0\x1d\xc9\x15\xf0\x1f\xa4\xe0\x30\x23\xc9\x1b\xf0\x11\xc9\x07\xf0\x1c\x20\x44\xfd\xa2\x0a\x20\xc5\xfe\xd0"
+"\x21\x4c\xb7\xfe\x18\xa2\x00\x8e\x00\xb0\xa2\x02\x08\x16\xde\x28\x76\xde\x60\xa9\x05\xa8\x8d\x03\xb0\xca\xd0\xfd\x49\x01\xc8\x10"
+"\xf5\x60\xc9\x20\x90\x17\x69\x1f\x30\x02\x49\x60\x20\x6b\xfe\x91\xde\xc8\xc0\x20\x90\x05\x20\xec\xfd\xa0\x00\x84\xe0\x48\x20\x6b"
+"\xfe\xb1\xde\x45\xe1\x91\xde\x68\x60\x20\x35\xfe\xa9\x20\x22\x00\xf2\x0b\x10\xe6\x20\x35\xfe\x4c\x42\xfd\x20\xec\xfd\xa4\xe0\x10"
+"\xd9\xa0\x80\x84\xe1\xa0\x00\x8c\x00\xb0\xa9\x20\xb0\x06\xf0\x00\xc8\xd0\xf7\xa9\x80\xa0\x00\x85\xdf\x84\xde\xf0\xbb\x20\x3a\x2b"
+"\x00\xf3\x14\x18\xa9\x10\x85\xe6\xa2\x08\x20\x13\xfd\x4c\x44\xfd\xa5\xe7\x49\x60\x85\xe7\xb0\x09\x29\x05\x2e\x01\xb0\x2a\x20\xea"
+"\xfc\x4c\x9a\xfe\xa4\xe0\x6b\x00\x00\x88\x00\xf0\x01\xe9\x20\x4c\xe9\xfd\xa9\x5f\x49\x20\xd0\x23\x45\xe7\x2c\x01\xb0\x14\x00\x92"
+"\x4c\xdf\xfd\x69\x39\x90\xf2\x49\x10\x10\x00\xf0\x7d\x10\x18\x69\x20\x2c\x01\xb0\x70\x02\x29\x1f\x4c\x60\xfe\xa5\xde\xa4\xdf\xc0"
+"\x81\x90\x38\xc9\xe0\x90\x34\xa4\xe6\x30\x0c\x88\xd0\x07\x20\x71\xfe\xb0\xfb\xa0\x10\x84\xe6\xa0\x20\x20\x66\xfe\xb9\x00\x80\x99"
+"\xe0\x7f\xc8\xd0\xf7\x20\x6b\xfe\xb9\x00\x81\x99\xe0\x80\xc8\xd0\xf7\xa0\x1f\xa9\x20\x91\xde\x88\x10\xfb\x60\x69\x20\x85\xde\xd0"
+"\x02\xe6\xdf\x60\x88\x10\x19\xa0\x1f\xa5\xde\xd0\x0b\xa6\xdf\xe0\x80\xd0\x05\x68\x68\x4c\x65\xfd\xe9\x20\x85\xde\xb0\x02\xc6\xdf"
+"\x60\x20\xfb\xfe\x08\x48\xd8\x84\xe5\x86\xe4\x20\xea\xfc\x68\xa6\xe4\xa4\xe5\x28\x60\x2c\x02\xb0\x10\x8a\x01\xf1\x2a\x30\xfb\x60"
+"\xa0\x3b\x18\xa9\x20\xa2\x0a\x2c\x01\xb0\xf0\x08\xee\x00\xb0\x88\xca\xd0\xf4\x4a\x08\x48\xad\x00\xb0\x29\xf0\x8d\x00\xb0\x68\x28"
+"\xd0\xe3\x60\x08\xd8\x86\xe4\x84\xe5\x2c\x02\xb0\x50\x05\x20\x71\xfe\x90\xf6\x20\x8a\xfb\xa8\x00\x00\x05\x00\xf0\x5a\xf6\x98\xa2"
+"\x17\x20\xc5\xfe\xbd\xe3\xfe\x85\xe2\xa9\xfd\x85\xe3\x98\x6c\xe2\x00\xca\xdd\xcb\xfe\x90\xfa\x60\x00\x08\x09\x0a\x0b\x0c\x0d\x0e"
+"\x0f\x1e\x7f\x00\x01\x05\x06\x08\x0e\x0f\x10\x11\x1c\x20\x21\x3b\x44\x5c\x38\x62\x87\x69\x40\x8d\x92\x7d\x50\xdf\xd2\x9a\xa2\xe2"
+"\xae\xc0\xdf\xd8\xd6\xc8\xc6\xc2\x48\xc9\x02\xf0\x27\xc9\x03\xf0\x34\xc5\xfe\xf0\x2e\xad\x0c\xb8\x29\x0e\xf0\x27\x68\x2c\x01\xb8"
+"\x30\xfb\x8d\x01\xb8\x48\x11\x00\xf2\x00\xf0\x09\x0c\x8d\x0c\xb8\x09\x02\xd0\x0c\xa9\x7f\x8d\x03\xb8\x13\x00\x61\x0e\x8d\x0c\xb8"
+"\x68\x60\x0c\x00\xf0\x1a\xb0\xf4\xa2\x17\xbd\x9a\xff\x9d\x04\x02\xca\x10\xf7\x9a\x8a\xe8\x86\xea\x86\xe1\x86\xe7\xa2\x33\x9d\xeb"
+"\x02\xca\x10\xfa\xa9\x0a\x85\xfe\xa9\x8a\x8d\x03\xb0\xa9\x07\xc6\x02\xf3\x13\xd1\xf7\x06\x0c\x0f\x41\x43\x4f\x52\x4e\x20\x41\x54"
+"\x4f\x4d\x0a\x0a\x0d\xa9\x82\x85\x12\x58\xa9\x55\x8d\x01\x29\xcd\x01\x29\xd0\x0c\x0a\x09\x00\xf0\x44\x03\x4c\xb2\xc2\x4c\xb6\xc2"
+"\x00\xa0\xef\xf8\x52\xfe\x94\xfe\x6e\xf9\xe5\xfa\xac\xc2\xac\xc2\xee\xfb\x7c\xfc\x38\xfc\x78\xc2\x85\xff\x68\x48\x29\x10\xd0\x06"
+"\xa5\xff\x48\x6c\x04\x02\xa5\xff\x28\x08\x6c\x02\x02\x48\x6c\x00\x02\x6c\x1a\x02\x6c\x18\x02\x6c\x16\x02\x6c\x14\x02\x6c\x12\x02"
+"\x6c\x10\x02\x6c\x0e\x02\x6c\x0c\x02\x6c\x0a\x02\x9f\x12\xf0\x07\x0d\xd0\x07\xa9\x0a\x20\xf4\xff\xa9\x0d\x6c\x08\x02\x6c\x06\x02"
+"\xc7\xff\x3f\xff\xb2\xff"
+;
+unsigned char dump_abasic[8192];
+static const unsigned char dump_afloat_lz4[] =
+"\xf0\x8a\xaa\x55\x0e\xd1\x5e\xd1\x28\xd0\xe4\x41\x43\x53\xd2\x1e\x41\x53\x4e\xd2\x24\x41\x54\x4e\xdc\x64\x41\x42\x53\xd2\x15\x43"
+"\x4f\x53\xdc\xe3\x45\x58\x50\xdd\xd4\x48\x54\x4e\xde\x72\x4c\x4f\x47\xdb\xb3\x50\x49\xd2\xc3\x53\x49\x4e\xdc\xee\x53\x51\x52\xdb"
+"\x6f\x54\x41\x4e\xda\xc4\x44\x45\x47\xd2\x73\x52\x41\x44\xd2\x65\x53\x47\x4e\xd2\x86\x56\x41\x4c\xd2\xe0\x46\x4c\x54\xd2\x9a\x46"
+"\x47\x45\x54\xd2\xcc\xd2\x96\x25\xd3\x0b\x46\x49\x46\xd3\xa8\x46\x55\x4e\x54\x49\x4c\xd3\xae\x43\x4f\x4c\x4f\x55\x52\xdf\x02\x46"
+"\x44\x49\x4d\xd3\xd3\x53\x54\x52\xd3\x1f\x46\x50\x52\x49\x4e\x54\xd3\x31\x46\x49\x4e\x50\x55\x54\xd3\x6a\x46\x06\x00\xf0\x57\xb4"
+"\xd4\xaf\x2b\xd1\x77\x2d\xd1\x83\xfe\x2a\xd1\x8f\x2f\xd1\x9b\xfe\x5e\xd1\xa7\xfe\x2b\xd1\xcb\x2d\xd1\xbc\xd1\xcb\x29\xc2\x78\xff"
+"\x3b\xc5\x4a\x0d\xc5\x4a\x2c\xd3\x31\xd3\x39\x2c\xd3\x6a\xc5\x58\x3d\xd9\xf6\x3c\x3e\xd9\xfe\x3c\x3d\xd9\xfa\x3c\xda\x02\x3e\x3d"
+"\xda\x06\x3e\xda\x0a\xff\x20\xfc\xd0\xa2\xb4\xd0\x20\x18\x66\x73\xa2\xac\xd0\x19\x20\x5d\xd8\x20\x06\xd1\xa2\xa1\xd0\x0f\x20\xf5"
+"\xd0\xa2\x9a\xd0\x08\x11\x00\xf3\x6d\xeb\xd0\xa2\xa8\x18\x90\x05\xa2\x5f\x84\x03\x38\x66\x53\xa4\x03\x88\xc8\xb1\x05\xc9\x20\xf0"
+"\xf9\x88\x84\x52\xca\xa4\x52\xe8\xc8\xbd\x06\xd0\x30\x1a\xd1\x05\xf0\xf5\xca\xe8\xbd\x06\xd0\x10\xfa\xe8\x24\x53\x10\xe7\xb1\x05"
+"\xc9\x2e\xd0\xe1\xc8\xca\xb0\xe1\xc9\xfe\xb0\x11\x85\x53\xbd\x07\xd0\x85\x52\x84\x03\xa6\x04\x6c\x52\x00\xa6\x04\x60\xf0\xfb\x00"
+"\x84\x03\x20\xec\xd0\x20\x9a\xd8\xa5\x5a\x85\x60\xa5\x5b\x85\x5f\xa5\x5c\x85\x5e\xa0\x5d\x4c\x9f\xc9\x20\xf2\xd0\x20\x70\xd8\x20"
+"\x3c\xd9\x4c\xff\xd0\x0c\x00\x11\x39\x0c\x00\x20\x03\xd1\x18\x00\x62\x45\xda\x4c\xf8\xd0\x20\x0c\x00\x11\xb6\x0c\x00\x22\xb6\xdb"
+"\xa7\x00\x02\x1e\x00\xf6\x06\x20\xd7\xdd\x4c\x09\xd1\x20\xcb\xd1\x20\x86\xd6\xf0\x06\xa5\x57\x49\x80\x85\x57\x60\xb6\x00\xf2\x40"
+"\xc9\x25\xd0\x32\xe6\x03\x20\x44\xd4\x90\x2b\xa0\x6f\x20\xcd\xc3\xa0\x04\xa9\x00\x85\x5e\x85\x58\x85\x57\xb1\x6f\x99\x59\x00\x05"
+"\x57\x85\x57\x88\x10\xf4\xaa\xf0\x09\xa5\x5a\x85\x57\x09\x80\x85\x5a\x8a\x60\x84\x03\x60\x20\xa5\xd5\xb0\xf8\xa2\x00\x4c\x12\xd1"
+"\x20\xeb\xd0\x20\x86\xd6\x30\xa7\x60\x20\x24\xd2\x4c\x86\xdc\x0f\x00\xf0\x0f\x10\x0a\xa9\x00\x85\x57\x20\x36\xd2\x4c\x75\xdc\x20"
+"\x2c\xd8\x20\x45\xda\x20\x31\xd8\x20\x8d\xde\x20\x33\xd9\x20\x72\xdb\x89\x00\x10\x12\x11\x00\xf0\x04\xa6\xdb\x20\xe5\xd1\x20\xaa"
+"\xdb\x20\xdc\xda\x4c\x67\xdc\x20\x93\xdd\x4c\xe5\x50\x00\xf2\x0f\xa0\x7c\xa9\xd2\x84\x6f\x85\x70\x4c\x45\xda\x20\xeb\xd0\xa0\x81"
+"\xa9\xd2\xd0\xf0\x7b\x0e\xfa\x35\x12\x86\x65\x2e\xe0\xd3\x62\x00\xf0\x19\xf0\x07\x48\x20\x8d\xde\x68\x85\x57\x60\x24\x73\x30\x26"
+"\x20\xbc\xc8\xa0\x5d\x20\xcd\xc3\x85\x5a\xa5\x5f\x85\x5b\xa5\x5e\x85\x5c\xa9\xa0\x85\x59\xa0\x00\x84\x5e\xb6\x00\xf0\x16\x10\x03"
+"\x20\xd5\xd8\x4c\xc8\xd7\x4c\x1b\xca\x20\x93\xdd\x20\xe5\xd1\xe6\x59\x60\x20\x3e\xcf\xa2\x04\x20\xd4\xff\x9d\xc5\x03\xca\x10\xf7"
+"\x20\xaa\xdb\x7b\x00\xf1\x0b\xb1\xce\xa0\x00\x20\x04\xd3\xc9\x2b\xf0\x0f\xc9\x2d\xd0\x0e\x20\x03\xd3\x84\x54\x20\xb1\xd5\x4c\xbf"
+"\xd1\x0b\x00\x60\x4c\xb1\xd5\xc8\xb1\x52\xeb\x01\x10\x60\x30\x01\xf0\x01\xd4\x20\x79\xc2\x20\xfc\xd0\x20\xe4\xc4\x20\x36\xd8\x4c"
+"\x5b\xc5\x0c\x00\xb0\x31\xc2\x20\xe1\xc4\x20\xcb\xc3\x20\xd0\xd4\x12\x00\xf0\x34\x72\xc3\xa2\xb8\x4c\x0b\xd1\x20\xfc\xd0\xa9\xc5"
+"\x85\x52\xa9\x03\x85\x53\x20\xd0\xd4\xc6\x6f\xad\x21\x03\x38\xe5\x6f\x90\x0b\xf0\x09\xa8\xa9\x20\x20\x4c\xca\x88\xd0\xfa\xa0\x00"
+"\xb1\x52\xc9\x0d\xf0\xcd\x20\x4c\xca\xc8\xd0\xf4\x20\x72\xc3\xb1\x05\xc9\x25\xd0\x08\xc8\x84\x9b\x01\x40\xb0\x05\xa2\xc3\x47\x00"
+"\xf0\x12\x09\xcd\xa8\xa5\x05\x48\xa5\x06\x48\xa5\x03\x48\x84\x03\xc8\x84\x06\xa9\x40\x85\x05\x20\xfc\xd0\x68\x85\x03\x68\x85\x06"
+"\x68\x85\x05\x89\x00\x80\x7b\xd3\x20\xeb\xd9\x4c\x69\xc5\x06\x00\x50\xd5\xcc\x20\x94\xd4\x98\x00\xf1\x16\xe4\xc4\x20\x31\xd8\xa6"
+"\x04\x20\x41\xcf\xa2\x04\xbd\xc5\x03\x20\xd1\xff\xca\x10\xf7\x4c\x5b\xc5\xa5\x01\x05\x02\xf0\x6a\x20\x34\xc4\xb0\x65\xa4\x03\x73"
+"\x00\xf1\x34\x5d\xc8\xb1\x05\xc8\xd1\x05\xd0\x55\xc9\x5b\xb0\x51\xe9\x3f\x90\x4d\xc8\x84\x03\x48\x20\x8b\xc7\xf6\x15\xd0\x02\xf6"
+"\x24\x20\x9a\xd4\x68\xa8\x18\xa5\x23\x99\x87\x28\x65\x16\x85\x23\xa5\x24\x99\xa2\x28\x65\x25\x85\x24\xa0\x00\x84\x04\xa9\xaa\x91"
+"\x23\xd1\x23\xd0\x1c\x4a\x07\x00\x10\x15\x55\x00\x11\x10\x55\x00\xf1\x10\x2c\xd0\x05\xe6\x03\x4c\xd3\xd3\x4c\x58\xc5\x00\x20\x34"
+"\xc4\x90\x0e\xb5\x15\x0a\x0a\x75\x15\x95\x15\xa9\x28\x95\x24\x38\x60\x24\x00\xa0\x21\xd0\x07\xe6\x03\x20\xbc\xc8\x38\x60\x7d\x00"
+"\xb1\x08\xc9\x5b\xb0\x04\xe9\x3f\xb0\x02\x18\x60\x7f\x00\x21\xbc\xc8\x79\x00\x50\xb0\x10\xb9\x87\x28\x39\x00\xf0\x0c\xb9\xa2\x28"
+"\x75\x24\x95\x24\x90\xd1\x00\x20\xbc\xc8\x4c\x31\xc2\xb4\x24\xb5\x15\x0a\x36\x24\x0a\x36\x24\x18\x1f\x00\x10\x98\x1d\x00\xf0\x23"
+"\x60\xad\x04\xe0\xc9\xbf\xf0\x0a\xad\x00\xa0\xc9\x40\xd0\x83\x4c\x02\xa0\x4c\x05\xe0\xc9\x3a\xb0\x07\xc9\x30\x90\x02\xe9\x30\x60"
+"\x18\x60\xa9\x00\x85\x6f\x20\x86\xd6\xd0\x12\xa9\x30\x20\x8d\xd5\xa9\x2e\x05\x00\x00\x0a\x00\x70\x4c\x71\xd5\x10\x05\xa9\x2d\x0f"
+"\x00\xf0\x12\x00\x85\x6d\xa5\x59\xc9\x81\xb0\x08\x20\xa0\xd6\xc6\x6d\x4c\xf6\xd4\xc9\x84\x90\x10\xd0\x06\xa5\x5a\xc9\xa0\x90\x08"
+"\x20\x1b\xd7\xe6\x14\x00\xf0\x04\xa5\x59\xc9\x84\xb0\x07\x20\xd8\xd6\xe6\x59\xd0\xf3\x38\xa9\xff\x20\x36\xd6\x21\x00\xf1\x10\xb0"
+"\xdf\xa9\x01\xa4\x6d\x30\x0a\xc0\x08\xb0\x06\xc8\xa9\x00\x85\x6d\x98\x85\x70\xa2\x09\x86\x54\x20\x75\xd5\xc6\x70\xd0\x05\x70\x00"
+"\xf1\x02\xc6\x54\xd0\xf0\xa5\x6d\xf0\x16\xa9\x45\x20\x8d\xd5\xa5\x6d\x10\x0a\x77\x00\xf1\x4e\x38\xa9\x00\xe5\x6d\x20\x87\xd5\xa9"
+"\x0d\xd0\x18\xa5\x5a\x4a\x4a\x4a\x4a\x20\x8b\xd5\xa5\x5a\x29\x0f\x85\x5a\x4c\x4e\xd6\xc9\x0a\xb0\x09\x09\x30\xa4\x6f\x91\x52\xe6"
+"\x6f\x60\xa2\xff\xe8\xe9\x0a\xb0\xfb\x69\x0a\x48\x8a\x20\x87\xd5\x68\x10\xe6\xa5\x03\x85\x54\xa5\x05\x85\x52\xa5\x06\x85\x53\x20"
+"\xa4\xda\x85\x6c\x85\x6d\x20\x7b\xd6\xc9\x2e\xf0\x0e\x20\xc3\xd4\x90\x71\x85\x5e\x0e\x00\xf0\x00\xd0\x09\xa5\x6c\x18\xd0\x3a\xe6"
+"\x6c\xd0\xf0\xc9\x45\xf0\x27\x1b\x00\xf0\x23\x2d\x85\x6e\xa5\x5a\xc9\x18\x90\x08\xa5\x6c\xd0\xdb\xe6\x6d\xb0\xd7\xa5\x6c\xf0\x02"
+"\xc6\x6d\x20\x4e\xd6\x18\xa5\x6e\x20\x36\xd6\x4c\xc6\xd5\x20\x7b\xd6\x20\x78\xd7\x18\x65\x6d\x85\x6d\xa9\xa8\x85\x59\xc8\x03\xa1"
+"\x1c\x20\xc8\xd7\xa5\x6d\x30\x0b\xf0\x10\x22\x01\x41\xd0\xf9\xf0\x07\x17\x01\xf2\x0f\xd0\xf9\x20\x9b\xda\x38\xa4\x54\x88\x60\xa2"
+"\x05\x75\x59\x95\x59\xa9\x00\xca\xd0\xf7\x60\xa2\x05\xb5\x59\x75\x61\x95\x59\x0c\x00\xf1\x07\xa9\x00\x85\x67\xa9\x00\x85\x68\xb5"
+"\x59\x0a\x26\x68\x0a\x26\x68\x18\x75\x59\x90\x02\xe6\x0a\x00\x20\x65\x67\x0a\x00\xf0\x26\x95\x59\xa5\x68\x85\x67\xca\xd0\xda\x60"
+"\x84\x55\xa4\x54\xb1\x52\xa4\x55\xe6\x54\x60\xa5\x5a\x05\x5b\x05\x5c\x05\x5d\x05\x5e\xf0\x07\xa5\x57\xd0\x09\xa9\x01\x60\x85\x57"
+"\x85\x59\x85\x58\x60\x18\xa5\x59\x69\x03\x85\x44\x00\x61\x58\x20\xc3\xd6\x20\xfb\x03\x00\x42\x42\xd6\x90\x09\x9b\x01\xf0\x5e\x02"
+"\xe6\x58\x60\xa2\x08\xb5\x56\x95\x5e\xca\xd0\xf9\x60\x06\x5e\x26\x5d\x26\x5c\x26\x5b\x26\x5a\x60\x66\x5a\x66\x5b\x66\x5c\x66\x5d"
+"\x66\x5e\x60\xa5\x5d\x85\x5e\xa5\x5c\x85\x5d\xa5\x5b\x85\x5c\xa5\x5a\x85\x5b\xa9\x00\x85\x5a\x60\x20\xc3\xd6\x46\x62\x66\x63\x66"
+"\x64\x66\x65\x66\x66\x60\xa5\x65\x85\x66\xa5\x64\x85\x65\xa5\x63\x85\x64\xa5\x62\x85\x63\xa9\x00\x85\x62\x60\x38\xa5\x59\xe9\x04"
+"\x85\x59\xb0\x02\xc6\x58\x20\xf8\xd6\x20\xb4\xd6\x06\x00\x02\x81\x00\x10\xfb\x0f\x00\x00\x25\x00\xf0\x07\xa5\x5a\x85\x63\xa5\x5b"
+"\x85\x64\xa5\x5c\x85\x65\xa5\x5d\x85\x66\xa5\x5e\x2a\x20\xb4\xd6\x1a\x00\xf0\x01\x85\x63\xa5\x5a\x85\x64\xa5\x5b\x85\x65\xa5\x5c"
+"\x85\x66\xa5\x5d\x18\x00\x50\xa5\x5b\x2a\xa5\x5a\x77\x01\xd0\xb7\xd6\xa0\xff\xc9\x2b\xf0\x05\xc9\x2d\xd0\x04\xc8\x82\x01\x53\xc3"
+"\xd4\x90\x24\xaa\x09\x00\xf2\x24\x10\x85\x6e\x20\x7b\xd6\x8a\x85\x67\x0a\x0a\x65\x67\x0a\x65\x6e\xaa\x98\xd0\x06\x86\x6e\x38\xe5"
+"\x6e\x60\x8a\x60\xa9\x00\x60\x48\x20\xa4\xda\x68\xf0\xf8\x10\x07\x85\x57\xa9\x00\x38\xe5\x57\x85\x5a\xa9\x88\xb8\x01\xf0\x06\xe4"
+"\xa5\x5a\xd0\x21\xa5\x5b\x85\x5a\xa5\x5c\x85\x5b\xa5\x5d\x85\x5c\xa5\x5e\x85\x5d\xfa\x05\x00\xca\x00\xf1\x0c\x08\x85\x59\xb0\xdf"
+"\xc6\x58\x90\xdb\xa5\x5a\x30\xbb\x20\xcd\xd6\xa5\x59\xd0\x02\xc6\x58\xc6\x59\x4c\xf2\xd7\x1f\x06\xe3\x66\x85\x60\x85\x5f\xb1\x6f"
+"\x99\x61\x00\x05\x5f\x85\x5f\x1f\x06\xf2\x0b\x62\x85\x5f\x09\x80\x85\x62\x8a\x60\x20\xa2\xdb\xd0\x11\x20\xa6\xdb\xd0\x0c\x20\xaa"
+"\xdb\xd0\x07\xa6\x04\x58\x06\xf2\x2c\x00\xa5\x59\x91\x6f\xc8\xa5\x57\x29\x80\x85\x57\xa5\x5a\x29\x7f\x05\x57\x91\x6f\xc8\xb9\x59"
+"\x00\x91\x6f\xc0\x04\xd0\xf6\x60\xa0\x52\x84\x6f\xa9\x00\x85\x70\x20\x3d\xd8\x20\xd9\xc4\xa5\x56\x95\x73\x60\xa6\x04\x20\xcb\xc3"
+"\xb5\x74\x85\x56\x1a\x00\xe0\x60\xa5\x5e\xc9\x80\x90\x07\xf0\x0a\xa9\xff\x20\x72\xd7\xac\x00\xf4\x06\x60\xa5\x5d\x09\x01\x85\x5d"
+"\xd0\xf3\x20\xc7\xd8\xf0\x06\xa5\x59\xc9\xa0\xb0\x14\x46\xcd\x01\x03\xb2\x01\xf2\x18\xe6\x59\xd0\xe6\xf0\x16\xa9\x7f\x85\x5a\xa9"
+"\xff\x85\x5b\x85\x5c\x85\x5d\xa2\x08\xa9\x00\x95\x5f\xca\xd0\xfb\x60\xa5\x57\x10\x0c\x38\xa2\x04\xa9\x00\xf5\x59\x94\x02\x41\xa5"
+"\x62\x10\x23\x10\x00\x62\x61\x95\x61\xca\xd0\xf7\x2d\x07\xf1\x10\x10\x11\xe6\x5d\xd0\x0c\xe6\x5c\xd0\x08\xe6\x5b\xd0\x04\xe6\x5a"
+"\xf0\xb2\x60\x20\xd5\xd8\x20\xf9\xd8\x4c\xd5\xd8\xa2\x05\xb5\xcf\x02\xf0\x05\xf9\xa9\x80\x85\x59\x4c\xc8\xd7\x20\x04\xd8\x20\x3d"
+"\xd8\xa2\x08\xb5\x5e\x95\x56\x66\x02\x30\x20\x39\xd9\x3e\x06\x70\xbf\xd1\x20\x04\xd8\xf0\xf1\x31\x03\xf1\x64\xe3\xa5\x59\xc5\x61"
+"\xf0\x26\x90\x0f\xe5\x61\xc9\x21\xb0\xde\xaa\x20\xfb\xd6\xca\xd0\xfa\xf0\x15\x38\xa5\x61\xe5\x59\xc9\x21\xb0\xc3\xaa\x18\x20\xd8"
+"\xd6\xca\xd0\xf9\xa5\x61\x85\x59\xa5\x57\x45\x5f\x10\x49\xa5\x5a\xc5\x62\xd0\x1b\xa5\x5b\xc5\x63\xd0\x15\xa5\x5c\xc5\x64\xd0\x0f"
+"\xa5\x5d\xc5\x65\xd0\x09\xa5\x5e\xc5\x66\xd0\x03\x4c\xa4\xda\xb0\x2d\x38\xa5\x66\xe5\x5e\x85\x5e\xa5\x65\xe5\x5d\x85\x5d\xa5\x64"
+"\xe5\x5c\x85\x5c\xa5\x63\xe5\x5b\x85\x5b\xa5\x62\xe5\x5a\x16\x07\xf0\x1f\x57\x4c\x98\xda\x18\x20\xb4\xd6\x4c\x9b\xda\x38\xa5\x5e"
+"\xe5\x66\x85\x5e\xa5\x5d\xe5\x65\x85\x5d\xa5\x5c\xe5\x64\x85\x5c\xa5\x5b\xe5\x63\x85\x5b\xa5\x5a\xe5\x62\x85\x5a\x4c\x98\xda\x00"
+"\xb2\x06\xf0\x0f\xc7\x48\xa2\xc8\x4c\x0b\xd1\xa9\x5d\xd0\x12\xa9\x66\xd0\x0e\xa9\x6f\xd0\x0a\xa9\x76\xd0\x06\xa9\x7d\xd0\x02\xa9"
+"\x84\x48\x63\x08\x10\xfc\x99\x08\xd0\xe6\x04\x20\x04\xd8\xa5\x5f\x29\x80\x85\x5f\xa0\x00\xdf\x01\xf0\x0f\xc5\x5f\xd0\x0d\xa2\x00"
+"\xb5\x61\xd5\x59\xd0\x0a\xe8\xe0\x05\xd0\xf5\x08\xa6\x04\x28\x60\x6a\x45\x5f\x2a\xa9\x01\xd0\xf3\x04\x01\x41\xf2\x20\x04\xd8\xb9"
+"\x00\x52\x18\xa5\x59\x65\x61\xb2\x03\x00\x78\x02\x12\x80\x42\x03\x90\xa2\x05\xa0\x00\xb5\x59\x95\x66\x94\x28\x04\x00\x03\x01\xe0"
+"\x85\x57\xa0\x20\x20\xfb\xd6\xa5\x67\x10\x04\x18\x20\x42\xd7\x03\xf1\x0a\x06\x6b\x26\x6a\x26\x69\x26\x68\x26\x67\x88\xd0\xe8\x20"
+"\xc8\xd7\x20\x80\xd8\xa5\x58\xf0\x0b\x10\x03\xdd\x01\x10\x56\xdd\x01\x00\x61\x08\x40\x8d\xde\xd0\x26\x71\x00\x10\xec\x10\x04\x50"
+"\xe5\xd1\xd0\x23\x60\x3e\x08\x20\x9e\xdb\x65\x02\xa1\xe6\xdc\x20\x9e\xdb\x20\x23\xd9\x20\xf1\x09\x00\x40\x86\xd6\xf0\xcc\xa5\x01"
+"\x12\xc1\x71\x00\x52\x38\xa5\x59\xe5\x61\x8f\x00\x00\x57\x04\x12\x81\xa5\x00\x00\xc0\x04\xf6\x4a\x95\x66\xca\xd0\xf9\x46\x67\x66"
+"\x68\x66\x69\x66\x6a\x66\x6b\x20\xfb\xd6\xa2\x27\xa5\x67\xc5\x62\xd0\x16\xa5\x68\xc5\x63\xd0\x10\xa5\x69\xc5\x64\xd0\x0a\xa5\x6a"
+"\xc5\x65\xd0\x04\xa5\x6b\xc5\x66\x90\x24\xa5\x6b\xe5\x66\x85\x6b\xa5\x6a\xe5\x65\x85\x6a\xa5\x69\xe5\x64\x85\x69\xa5\x68\xe5\x63"
+"\x85\x68\xa5\x67\xe5\x62\x85\x67\xa5\x5e\x09\x01\x85\x5e\x20\xcd\xd6\xd4\x00\x50\xca\xd0\xae\x4c\x98\xfc\x08\x00\xbc\x00\xf0\x06"
+"\x26\x10\x01\x00\x20\x31\xd8\xa5\x59\x4a\x69\x40\x85\x59\xa9\x05\x85\x6e\x20\x27\xd8\x35\x09\xf1\x14\xb6\xda\x20\xa2\xdb\x20\x3c"
+"\xd9\xc6\x59\xc6\x6e\xd0\xeb\x60\xa9\xd4\xd0\x0a\xa9\xca\xd0\x06\xa9\xcf\xd0\x02\xa9\xc5\x85\x6f\xa9\x03\x85\x70\xef\x00\xf0\x2a"
+"\x86\xd6\xf0\x02\x10\x01\x00\xa5\x59\x48\xa9\x81\x85\x59\x20\xc7\xd8\xa9\xc0\x85\x62\xa9\x81\x85\x61\x85\x5f\x20\x41\xd9\xe6\x59"
+"\xa9\xfe\xa0\xdb\x20\x27\xdc\x20\x31\xd8\x68\x38\xe9\x81\x20\xb2\xd7\xa9\xf9\x85\x6f\xa9\xdb\x85\x70\xb7\x09\xf3\x3f\xaa\xdb\x4c"
+"\x3c\xd9\x80\x31\x72\x17\xf8\x07\x85\x17\x6e\xd4\x85\x80\x28\xc7\x12\xa0\x84\x70\x4e\x5f\xf2\x81\x00\x00\xfe\xef\x84\x0f\xff\xda"
+"\xe1\x81\x7f\xff\xff\x93\x82\x40\x00\x00\x0c\x7f\x4f\x99\x1f\x65\x85\x71\x84\x72\x20\x31\xd8\xa0\x00\xb1\x71\x85\x6c\xe6\x71\xd0"
+"\x02\xe6\x72\xa5\x71\x85\x6f\xa5\x72\x85\x70\xef\x09\x81\xb6\xda\x18\xa5\x71\x69\x05\x85\x16\x00\x30\x69\x00\x85\x1a\x00\x64\x3c"
+"\xd9\xc6\x6c\xd0\xe2\xb1\x00\x31\x0d\x10\x0c\x42\x0a\x30\x7a\xdc\xa9\xaf\x0a\x00\x84\x07\x71\x90\x0c\x20\xae\xda\x20\x8c\x27\x0a"
+"\x80\x39\xd9\xa5\x59\xc9\x73\x90\xe7\x5c\x0a\x81\xc7\xd8\xa9\x80\x85\x61\x85\x62\xce\x00\x40\xa9\xb0\xa0\xdc\xcc\x00\xf0\x29\xa6"
+"\xdb\x4c\x45\xda\x09\x85\xa3\x59\xe8\x67\x80\x1c\x9d\x07\x36\x80\x57\xbb\x78\xdf\x80\xca\x9a\x0e\x83\x84\x8c\xbb\xca\x6e\x81\x95"
+"\x96\x06\xde\x81\x0a\xc7\x6c\x52\x7f\x7d\xad\x90\xa1\x82\xfb\x62\x57\x2f\x80\x6d\x63\x38\x2c\x1f\x02\x61\x24\xdd\xe6\x6e\x4c\xf4"
+"\xca\x0a\xf0\x01\x24\xdd\x46\x6e\x90\x03\x20\x86\xdc\x46\x6e\x90\x06\x20\x05\xdd\xcc\x03\x20\x2c\xd8\x45\x0a\x62\x04\xd8\xc6\x61"
+"\xa9\x80\x74\x00\x35\xa6\xa0\xdd\x74\x00\x60\xa5\x59\xc9\x98\xb0\x54\x7c\x02\x50\x93\xdd\x20\xdc\xda\xd0\x0b\xe0\x5d\x85\x6e\x05"
+"\x5c\x05\x5b\x05\x5a\xf0\x3e\x20\xac\xd2\xbd\x01\x22\x86\xdd\x5b\x01\x30\x20\x3c\xd9\x8a\x02\x11\xa2\x07\x0b\x16\x8a\x15\x00\x70"
+"\xa5\x57\x10\x12\x20\x8a\xdd\x2e\x0b\x10\x86\x06\x00\xf3\x53\xc6\x6e\x4c\x69\xdd\x00\x60\x20\xda\xd2\x4c\x69\xdd\xa9\x97\xd0\x02"
+"\xa9\x9c\x85\x6f\xa9\xdd\x85\x70\x60\xa9\xa1\xd0\xf5\x81\xc9\x00\x00\x00\x75\xfd\xaa\x22\x17\x81\x49\x0f\xda\xa2\x08\x84\x04\xc7"
+"\x3c\xfb\x81\xe0\x4f\x5d\xad\x82\x80\x00\x69\xb8\x82\x5b\xcf\x1d\xb5\x82\xbf\xce\x82\x1e\x82\x45\x44\x7f\x32\x7f\x62\x44\x5a\xd2"
+"\x83\x82\x14\x8a\x27\x80\x66\x7b\x21\x4d\x20\xeb\xd0\xa5\x59\xc9\x87\xd5\x08\x60\xb3\x90\x08\xa5\x57\x10\x53\x04\xf1\x11\x00\xa5"
+"\x59\xc9\x80\x90\x29\x20\x9a\xd8\x20\xe2\xd8\xa5\x5d\x85\x6e\x20\x13\xd9\x20\x1c\xde\x20\x2c\xd8\xa9\x23\x85\x6f\xa9\xde\xcc\x01"
+"\x61\xa5\x6e\x20\x51\xde\x20\x6c\x01\xf1\x21\xa9\x28\xa0\xde\x4c\x27\xdc\x82\x2d\xf8\x54\x58\x07\x83\xe0\x20\x86\x5b\x82\x80\x53"
+"\x93\xb8\x83\x20\x00\x06\xa1\x82\x00\x00\x21\x63\x82\xc0\x00\x00\x02\x82\x80\x00\x00\x0c\x81\x00\x00\x00\x00\x05\x00\xd0\xaa\x10"
+"\x09\xca\x8a\x49\xff\x48\x20\xae\xda\x68\x48\x34\x01\xf0\x00\x8d\xde\x68\xf0\x0a\x38\xe9\x01\x48\x20\x45\xda\x4c\x64\xde\x0e\x02"
+"\x23\xa5\x57\x4d\x0c\x51\x83\xde\x4c\xbf\xd1\x09\x02\xf0\x03\x33\xc9\x85\x90\x0b\x20\xa4\xda\xa0\x80\x84\x5a\xc8\x84\x59\x60\xe6"
+"\x59\x25\x02\x32\x20\xd7\xdd\x43\x00\x00\x56\x01\x11\x27\x6e\x0c\x20\xaa\xdb\x43\x01\x50\xa2\xdb\x4c\xdc\xda\x2a\x02\xb5\x8d\xde"
+"\xc6\x59\x20\x33\xd9\xa9\xd4\xa0\xde\xb0\x01\xf0\x42\x08\x7e\x85\x51\xb3\x0c\x86\xde\xb0\x7d\x73\x7c\x23\xd8\xe9\x9a\x87\x34\x82"
+"\x1d\x80\x81\x9a\x20\x6c\xed\x81\xbd\x32\x34\x2e\x7f\x5d\x46\x87\xb4\x82\x68\x3e\x43\xf7\x80\x6c\x9a\x9e\xbb\x20\xc8\xc3\xa5\x52"
+"\x29\x03\xa8\xb9\x4e\xdf\x8d\xfd\x03\xad\x00\xb0\x29\xf0\xc9\x70\xd0\x0c\xa9\x00\xa8\x99\x00\x86\x99\x00\x87\x88\xd0\xf7\x15\x00"
+"\x70\xdf\x8d\x00\xb0\x2a\x2a\x2a\x29\x00\xf0\x1d\x42\xdf\x8d\xfe\x03\xb9\x46\xdf\x8d\xff\x03\x4c\x58\xc5\x52\x70\x88\xa0\xdf\xdf"
+"\xdf\xdf\x3f\xcf\xf3\xfc\x00\x55\xaa\xff\xa5\x5b\x05\x5d\xd0\x47\xa5\x5a\xc9\x40\xb0\x41\x4a\x4a\x41\x05\xc1\x84\x60\xa9\x3f\x38"
+"\xe5\x5c\xc9\x40\x90\x4f\x60\x1e\x00\x50\x29\xa5\x5a\x30\x25\x1c\x00\x04\x18\x00\x12\x30\x18\x00\x51\x11\xa5\x5a\x30\x0d\x18\x00"
+"\x10\x5f\x30\x00\x32\x60\x90\x18\x18\x00\x51\xf9\xa5\x5a\x30\xf5\x18\x00\x10\xbf\x18\x00\x99\xc0\xb0\xe8\xa0\x00\x84\x60\x0a\x26"
+"\x03\x00\xf0\x13\x65\x5f\x85\x5f\xa5\x60\x69\x80\x85\x60\xa5\x5a\x29\x03\xaa\xbd\x4a\xdf\xa6\x5e\xca\xf0\x0f\xca\xf0\x05\x31\x5f"
+"\x91\x5f\x60\x49\xff\x51\x07\x00\x10\xaa\x0d\x00\xb0\x8a\x49\xff\x2d\xfd\x03\x11\x5f\x91\x5f\x60"
+;
+unsigned char dump_afloat[4096];
+static const unsigned char dump_dosrom_lz4[] =
+"\xf1\x80\xa9\x01\x8d\x02\x0a\xa9\x00\x8d\x02\x0a\x4c\xe2\xee\x20\x16\xe0\x44\x49\x53\x4b\x20\xea\x68\x85\xea\x68\x85\xeb\xa0\x00"
+"\xe6\xea\xd0\x02\xe6\xeb\xb1\xea\x30\x08\xf0\x06\x20\xf4\xff\x4c\x1e\xe0\x6c\xea\x00\x84\xe9\x20\x41\xe0\x20\xc9\xe5\xa4\xe9\xa2"
+"\x00\xf0\x02\xa2\x40\x20\x76\xf8\x86\x9a\xc9\x22\xf0\x43\xc9\x0d\xf0\x0c\x9d\x00\x01\xe8\xc8\xb9\x00\x01\xc9\x20\xd0\xf0\xa9\x0d"
+"\x9d\x00\x01\xa9\x01\x85\x9b\xa2\x9a\x60\xa0\x00\xb5\x00\x99\x9a\x00\xe8\xc8\xc0\x0a\x90\xf5\xa9\x20\xa0\x06\x99\xa5\x00\x88\x10"
+"\xfa\xc8\xb1\x9a\xc9\x0d\xf0\xe1\xc0\x07\xb0\x21\x99\xa5\x00\xd0\xf0\x3b\x00\x30\x0d\xf0\x14\x47\x00\x51\xc9\x22\xd0\xf0\xca\x11"
+"\x00\xf0\x0d\x22\xd0\xb4\xe8\xb0\xe4\x20\x16\xe0\x4e\x41\x4d\x45\x3f\x00\xa2\x9c\xa9\x00\x95\x00\x95\x01\x95\x02\x20\x76\xf8\x6c"
+"\x00\xf0\x27\x30\x90\x21\xc9\x3a\x90\x08\xe9\x07\x90\x19\xc9\x40\xb0\x15\x0a\x0a\x0a\x0a\x94\x02\xa0\x04\x0a\x36\x00\x36\x01\x88"
+"\xd0\xf8\xb4\x02\xc8\xd0\xd8\xb5\x02\x60\xa9\x20\x4c\xf4\xff\xa0\x06\x20\xec\xe0\x88\xd0\xfa\x60\x4a\x01\x00\x23\x60\xc8\x01\x00"
+"\x23\x60\x88\x01\x00\xf1\x9f\x60\xa5\x9c\x38\xe9\x01\x85\xc9\xa5\x9d\xe9\x00\x85\xca\xa9\xff\x85\xec\x18\x65\xa0\xa5\xa1\x69\x00"
+"\x85\xcb\xa5\xa2\x20\xfb\xe0\x85\xcc\xa5\xa2\x29\x0f\xaa\xa5\xa3\x38\xe6\xec\xe9\x0a\xb0\xfa\xca\x10\xf6\x69\x0a\x85\xed\x60\x20"
+"\xc9\xe5\x20\x68\xe0\x20\x5d\xe1\xb0\xf4\x20\x16\xe0\x46\x49\x4c\x45\x3f\x00\x20\x23\xe2\xa0\xf8\x20\x00\xe1\xcc\x05\x21\xb0\x20"
+"\xb9\x0f\x20\x29\x7f\xc5\xac\xd0\xef\x20\x01\xe1\xa2\x06\xb9\x07\x20\xd5\xa5\xd0\x05\x88\xca\x10\xf5\x60\x88\xca\x10\xfc\x30\xd8"
+"\x18\x60\xb9\x0f\x20\x30\x19\xb9\x10\x20\x99\x08\x20\xb9\x10\x21\x99\x08\x21\xc8\xcc\x05\x21\x90\xee\x98\xe9\x08\x8d\x05\x21\x60"
+"\x20\x16\xe0\x50\x52\x4f\x54\x00\x20\x49\xe1\x20\xbf\xe1\x4c\x60\xe4\xa5\xef\xd0\x71\x55\x00\xf0\x18\x20\xf4\xff\x20\xec\xe0\xbe"
+"\x0f\x20\x10\x02\xa9\x23\x20\xf4\xff\xa2\x07\xb9\x08\x20\x20\xf4\xff\xc8\xca\xd0\xf6\x20\xec\xe0\xb9\x02\x21\x20\x02\xf8\xb9\x01"
+"\x06\x00\xa0\xc8\xe8\xc8\xe0\x02\x90\xea\x20\xec\xe0\x19\x00\x88\x03\x21\x20\xfb\xe0\x20\x0b\xf8\x22\x00\x03\x18\x00\x40\x0b\xf8"
+"\xb9\x04\x31\x00\xb0\x20\xed\xff\x20\x31\xe7\x2c\x00\x0a\x30\xfb\x05\x00\xf0\x09\xf6\x60\x20\x2a\xe4\x4c\x23\xe2\x20\x31\xe2\xa2"
+"\x00\x86\xb6\xbd\x00\x20\xe0\x08\x90\x03\xbd\xf8\x6f\x00\x40\xe8\xe0\x0d\xd0\x43\x02\xf3\x23\x20\x44\x52\x49\x56\x45\x20\xa5\xee"
+"\x20\x0b\xf8\x20\x16\xe0\x20\x51\x55\x41\x4c\x20\xa5\xac\x20\xf4\xff\xa0\x00\x20\x88\xe2\x90\x4a\x20\x09\xe1\xb9\x08\x20\x29\x7f"
+"\x99\x08\x20\x98\xd0\xf2\x4c\xed\xff\x23\x01\xf0\x11\x05\xb9\x08\x20\x30\xf3\x60\xa4\xb8\xf0\x05\x20\xed\xff\xa0\xff\xc8\x84\xb8"
+"\x20\xf1\xe0\xa9\x23\xa4\xb7\xbe\x0f\x20\x30\x02\xa9\x65\x00\xf1\x03\xa2\x00\xb5\xae\x20\xf4\xff\xe8\xe0\x07\xd0\xf6\xf0\xaf\x84"
+"\xb7\xa2\x00\x4b\x00\xf1\x0d\x95\xae\xc8\xe8\xe0\x08\xd0\xf3\x20\x88\xe2\xb0\x1d\xa2\x06\x38\xb9\x0e\x20\xf5\xae\x88\xca\x10\xf7"
+"\x20\x01\xe1\x24\x01\xf0\x16\xe5\xb5\x90\xd2\x20\x00\xe1\xb0\xde\xa4\xb7\xb9\x08\x20\x09\x80\x99\x08\x20\xa5\xb5\xc5\xb6\xf0\x92"
+"\x85\xb6\x20\xed\xff\xa5\xb5\x20\xf4\xff\xa9\x3a\xa3\x00\xa0\x04\x20\xf3\xe0\x84\xb8\xf0\x89\xb9\x0e\x1d\x01\xf1\x6f\x85\xa2\x18"
+"\xa9\xff\x79\x0c\x21\xb9\x0f\x21\x79\x0d\x21\x85\xa3\xb9\x0e\x21\x29\x0f\x65\xa2\x85\xa2\x38\xb9\x07\x21\xe5\xa3\x48\xb9\x06\x21"
+"\x29\x0f\xe5\xa2\xaa\xa9\x00\xc5\xa0\x68\xe5\xa1\x8a\xe9\x00\x60\xa2\x02\xd0\x02\xa2\x00\x84\xbf\xbc\x08\x02\xb5\xbb\x94\xbb\x9d"
+"\x08\x02\xe8\x8a\x4a\xb0\xf1\xa4\xbf\x60\x43\x41\x54\xe2\x37\x44\x49\x52\xe2\x31\x49\x4e\x46\x4f\xe1\xb2\x4c\x4f\x41\x44\xe4\x65"
+"\x53\x41\x56\x45\xe5\xe6\x44\x45\x4c\x45\x54\x45\xe4\x1a\x52\x55\x4e\xe5\x0a\x4c\x4f\x43\x4b\xe5\x99\x55\x4e\x08\x00\x80\x9a\x4d"
+"\x4f\x4e\xe4\x5b\x4e\x4f\x07\x00\x61\x59\x53\x45\x54\xe5\x72\x60\x01\xf0\x33\xe4\x2a\x54\x49\x54\x4c\x45\xe5\x78\x55\x53\x45\xe5"
+"\xaf\x45\x58\x45\x43\xe5\x19\x53\x48\x55\x54\xe8\x9c\x47\x4f\xe5\x65\x53\x50\x4f\x4f\x4c\xe5\x47\x56\x44\x55\xe6\xb8\xe4\xc5\xa2"
+"\xff\xd8\xa0\x00\x20\x76\xf8\x88\xc8\xe8\xbd\x6c\xe3\x30\x18\xd9\x00\x01\xf0\xf4\xca\x0c\x00\x30\x10\xfa\xe8\x41\x03\xf0\x04\x2e"
+"\xd0\xdf\xc8\xca\xb0\xe3\x85\x9b\xbd\x6d\xe3\x85\x9a\x18\xa2\x00\x6c\x9a\x68\x02\xf0\x22\x84\x9a\x20\xbb\xe1\xa4\x9a\x20\x8c\xe1"
+"\x4c\xa9\xe5\x20\x76\xf8\xc9\x0d\xf0\x1d\xc8\x48\x20\xcc\xe5\x68\xc9\x30\x90\x14\xc9\x34\xb0\x10\x29\x03\x45\xee\x20\x26\xe2\xc9"
+"\x80\xf0\x04\x45\xee\x85\xee\xa5\x02\x01\x9e\x00\xe0\x3f\x00\xa2\xff\x20\xcc\xe5\x86\xef\xa5\xcd\x85\xac\x60\x30\x04\xf1\x20\xb4"
+"\xe0\xf0\x04\xa9\xff\x85\x9e\xa2\x9a\x18\x6c\x0c\x02\x08\x20\x84\xe4\x28\x90\x03\x20\x26\xe2\x4c\x60\xe4\x20\x4c\xe1\x84\x9a\xa2"
+"\x00\xa5\x9e\x10\x04\xa2\x02\xc8\xc8\xb9\x08\x21\x95\x9c\xcf\x01\x20\xf5\xa4\x81\x00\xf3\x2b\x20\x92\xe7\xa9\x53\x85\xad\x20\x12"
+"\xe1\x20\x16\xe8\xf0\x12\x20\x46\xe8\xa5\xad\x20\xed\xe7\x20\xa4\xe7\xd0\xf3\x20\x39\xe8\xd0\xe9\x60\x20\x33\xe0\xa5\xee\x85\xc7"
+"\xa5\xac\x85\xc8\xa9\x20\x85\xac\xa9\x00\x85\x9e\x20\x3f\xe4\xa2\x9a\x91\x03\xf0\x14\x0f\x20\x00\xe5\x20\x16\xe0\x43\x4f\x4d\x4d"
+"\x41\x4e\x44\x3f\x00\x20\x87\xe4\x20\x26\xe2\x20\x00\xe5\x6c\x9e\x00\xa5\xc7\x20\x3f\xe4\xa5\xc8\xa5\x00\x40\x33\xe0\x20\x6f\x19"
+"\x00\x60\x6c\x9e\x00\x4c\x54\xe1\xd0\x03\xf0\x1a\xce\xff\xa8\xf0\xf4\x85\xb9\x20\x52\xe3\xa9\x33\xa0\xe5\x9d\x06\x02\x98\x9d\x07"
+"\x02\x60\x84\xe9\xa4\xb9\x20\xd4\xff\x90\x08\x20\xcb\xff\xa4\xe9\x6c\x0a\x02\xa4\xe9\xfe\x03\xf0\x06\x18\x20\xce\xff\x85\xba\x20"
+"\x56\xe3\xa9\x59\xa0\xe5\xd0\xd2\x84\xe9\xa4\xba\x20\xd1\x21\x00\xf1\x05\xbb\x00\x20\xb4\xe0\x08\x20\xcc\xe5\x28\xf0\xa1\x6c\x9c"
+"\x00\x20\xb3\xe5\x85\xcd\x13\x01\xf0\x21\x31\xe2\xa2\x0c\xa9\x20\x20\xbd\xe5\xca\x10\xfa\xe8\xbd\x40\x01\xc9\x0d\xf0\x19\x20\xbd"
+"\xe5\xe0\x0c\x90\xf1\xb0\x10\x38\x08\x20\x49\xe1\xa5\xac\x2a\x28\x6a\x99\x0f\x20\x20\xbb\xe1\x20\x4a\xe7\xf4\x03\xf1\x09\xac\x85"
+"\xcd\xc8\x20\xcc\xe5\xb9\xff\x00\x85\xac\x60\xe0\x08\x90\x04\x9d\xf8\x20\x60\x9d\x00\x20\x51\x00\x01\xa2\x01\xc0\xf5\x20\x16\xe0"
+"\x53\x59\x4e\x54\x41\x58\x3f\x00\x8a\x04\x43\x55\x4c\x4c\x00\x81\x01\xf2\x1e\xe5\xa2\xa2\x20\xb6\xe0\xf0\xde\xa2\x9e\x20\xb6\xe0"
+"\x08\xa5\x9c\xa6\x9d\x28\xd0\x04\x85\x9e\x86\x9f\x85\xa0\x86\xa1\x20\xcc\xe5\xa2\x9a\x18\x4c\xdd\xff\x08\x20\xad\xe6\x4c\x7b\xe4"
+"\x3d\x01\xf0\x2d\x90\x03\x20\x8c\xe1\xa5\xa0\x48\xa5\xa1\x48\x38\xa5\xa2\xe5\xa0\x85\xa0\xa5\xa3\xe5\xa1\x85\xa1\xa9\x00\x85\xa2"
+"\xa9\x02\x85\xa3\xac\x05\x21\xf0\x3a\xc0\xf8\xb0\x95\x20\x38\xe3\x4c\x55\xe6\x20\x09\xe1\x20\x19\xe3\x98\xf0\x02\x90\xf5\xb0\x0b"
+"\xb1\x05\xf2\x17\x4f\x20\x52\x4f\x4f\x4d\x00\x84\xea\xac\x05\x21\xc4\xea\xf0\x0f\xb9\x07\x20\x99\x0f\x20\xb9\x07\x21\x99\x0f\x21"
+"\x88\xb0\xed\xa2\x00\xb5\xa5\x99\x08\x20\xee\x01\xf0\x0c\xb5\x9b\x88\x99\x08\x21\xca\xd0\xf7\x20\xbb\xe1\x68\x85\x9d\x68\x85\x9c"
+"\xac\x05\x21\x20\x00\xe1\x8c\x05\x21\xfe\x00\xd3\x26\xe2\x20\x1a\xe6\x20\x96\xe7\xa9\x4b\x4c\xa8\xe4\x53\x01\xf1\x6e\xa2\x00\x28"
+"\xf0\x06\xa5\x9c\xf0\x02\xa2\x04\xbd\xf7\xe6\x8d\x08\x02\xbd\xf8\xe6\x8d\x09\x02\xbd\xf9\xe6\x8d\x0a\x02\xbd\xfa\xe6\x8d\x0b\x02"
+"\x20\x16\xe0\x06\x0f\x0c\x41\x43\x4f\x52\x4e\x20\x41\x54\x4f\x4d\x0a\x0a\x0d\xea\x60\x52\xfe\x94\xfe\x94\xed\x22\xed\xa9\x00\x85"
+"\xec\x85\xed\xa9\x02\x85\xf1\xa0\x16\xa9\x29\x85\xd5\xa9\xe7\x85\xd6\xb9\x62\xe8\x20\xd2\xe7\xc8\xb9\x62\xe8\xc9\xea\xf0\x06\x20"
+"\x09\xe8\x4c\x19\xe7\xc8\x60\x20\xe4\xe7\xa9\x0a\x85\xf0\x60\x20\x7a\xe7\xd0\x13\x20\x5b\xe7\x20\xff\xe6\x99\x02\x04\x8a\x02\x10"
+"\x60\x11\x00\x00\x9d\x00\x05\x11\x00\xf0\x39\xa5\xee\x29\x03\xa8\x09\x80\x85\xee\xa9\x3a\x20\xdb\xe7\xa9\x23\x20\x09\xe8\xb9\x8e"
+"\xe7\x20\x09\xe8\x20\x7a\xe7\xf0\xfb\x60\xa5\xee\x10\x0d\xa9\x6c\x20\xd2\xe7\x20\xe4\xe7\x90\x03\x20\xfb\xe0\x29\x04\x60\x48\x88"
+"\x68\xa8\xa0\x0a\xd0\x02\xa0\x12\xa2\x0b\xb9\x4f\xe8\x95\xf1\x88\xca\xd0\xf7\x7b\x00\x82\xf0\xfa\xc9\x12\xd0\x08\x20\x0d\x03\x06"
+"\xf0\x17\xc9\x16\xd0\x05\x20\x0d\xe0\x3f\x00\xc6\xf0\xd0\xe1\x48\x20\x0d\xe0\x45\x52\x52\x4f\x52\x20\xea\x68\x20\x02\xf8\x00\x48"
+"\xa5\xee\x6a\x68\x90\x02\x49\xc0\xb0\x05\x60\xfb\x8d\x00\x0a\x60\xad\xbe\x05\xf0\x0a\xad\x01\x0a\x60\x20\xd2\xe7\x18\x68\x69\x01"
+"\x85\xd5\x68\x69\x00\x85\xd6\xa5\xec\x20\x09\xe8\xa5\xed\x05\x00\xf0\x01\xf1\x09\x20\x48\xad\x00\x0a\x29\x20\xd0\xf9\x68\x8d\x01"
+"\x0a\x60\xea\x00\xf0\x47\x38\xa9\x0a\xe5\xed\xa4\xcc\xd0\x06\xc5\xcb\x90\x02\xa5\xcb\x85\xf1\x38\xa5\xcb\xe5\xf1\x85\xcb\xb0\x02"
+"\xc6\xcc\xa5\xf1\x60\x85\xed\xa5\xf6\x85\xc9\xa5\xf7\x85\xca\xe6\xec\x60\xa5\xc9\x85\xf6\xa5\xca\x85\xf7\x60\xad\x04\x0a\x8d\xff"
+"\x1f\x68\x40\x4c\xf5\x00\xad\xff\x1f\x8d\x04\x0a\x68\x40\x35\x0d\x14\x05\xca\xea\x35\x10\xff\xff\x00\xea\x35\x18\x06\x00\x70\x3a"
+"\x17\xc1\xea\x69\x00\xea\x71\x00\xf0\x46\x04\xf0\x09\xe6\xf6\xd0\x02\xe6\xf7\x4c\xf2\x00\x8a\x48\x98\x48\xd8\x20\x99\xe8\x68\xa8"
+"\x68\xaa\x68\x40\x6c\xd5\x00\xa0\x00\x48\xd8\x98\xd0\x0f\x18\x69\x20\xf0\x08\xa8\x20\x9e\xe8\xd0\xf5\xa6\xc6\x68\x60\x20\x7c\xea"
+"\xb0\xf7\xc4\xb9\xd0\x06\x20\x52\xe3\x4a\x85\xb9\xc4\xba\xd0\x05\x20\x56\xe3\x85\xba\xb9\x17\x22\x29\x60\xf0\x35\x20\x12\xe9\x0a"
+"\x00\xf0\x05\x20\xf0\x25\xa6\xc4\xb9\x14\x22\x9d\x0c\x21\xb9\x15\x22\x9d\x0d\x21\xb9\x16\x22\x18\x08\xa0\x5d\x0e\x21\x29\xf0\x5d"
+"\x0e\x21\x9d\x0e\x54\x02\xf0\x11\xa4\xc2\x20\x76\xeb\x20\x00\xe5\xb9\x1b\x22\x49\xff\x25\xc0\x85\xc0\x4c\xae\xe8\x20\x3e\xe9\xa2"
+"\x07\xb9\x0c\x22\x95\xa4\x88\x88\x41\x07\xf4\x0d\x5d\xe1\x90\x34\x84\xc4\xb9\x0e\x21\xbe\x0f\x21\xa4\xc2\x59\x0d\x22\x29\x0f\xd0"
+"\x23\x8a\xd9\x0f\x22\xd0\x1d\x60\x76\x04\xf1\x0e\xb9\x0e\x22\x29\x7f\x85\xac\xb9\x17\x22\x4c\x3f\xe4\xd8\x98\x48\x86\xc6\x08\xb5"
+"\x00\x85\x9a\xb5\x01\x85\x9b\x20\x75\x15\x08\xf1\x31\x1f\x28\x90\x05\xa0\x00\x4c\x51\xea\xa9\x00\xa2\x08\x95\x9b\xca\xd0\xfb\xa9"
+"\x40\x85\xa3\xa2\x9a\x20\x1a\xe6\xa6\xc6\x18\x90\xd0\x84\xc3\xa9\x00\x85\xc2\xa0\xa0\xa9\x08\x24\xc0\xf0\x28\x48\x84\xc4\xa6\xc3"
+"\xa9\x08\x85\xc5\xb9\x00\x22\xdd\x08\x20\xd0\x1e\xc8\x09\x00\xf2\x1a\x21\xd0\x15\xc8\xe8\xc6\xc5\xd0\xe9\xa4\xc4\xa6\xc6\x20\x9e"
+"\xe8\x68\x84\xc2\x85\xc1\x4c\xc8\xe9\xa4\xc4\x68\x48\x98\x38\xe9\x20\xa8\x68\x0a\xd0\xc0\xa4\xc2\xf0\xb5\x3d\x00\xa0\xbd\x08\x20"
+"\x99\x00\x22\xc8\xbd\x08\x21\x07\x00\x00\x39\x00\x50\xed\xa2\x10\xa9\x00\x0d\x00\xf0\x30\xca\xd0\xf9\xa5\xc2\xa8\x20\xfa\xe0\x69"
+"\x22\x99\x13\x22\xa5\xc1\x99\x1b\x22\x05\xc0\x85\xc0\xb9\x09\x22\x69\xff\xb9\x0b\x22\x69\x00\x99\x19\x22\xb9\x0d\x22\x09\x0f\x69"
+"\x00\x20\xfb\xe0\x99\x1a\x22\x28\x90\x2f\xb9\x09\x22\x99\x14\x22\xb9\x0b\x22\x99\x15\x1c\x00\x00\x18\x00\xf0\x00\x16\x22\xa5\xee"
+"\x29\x0f\x19\x17\x22\x99\x17\x22\x20\xd1\xea\xed\x05\xf0\x60\x84\xc3\xa6\xc6\x68\xa8\xa5\xc3\x60\xa9\x20\x99\x17\x22\xd0\xdf\x48"
+"\x84\xc2\x0a\x0a\x65\xc2\xa8\xb9\x10\x22\x95\x00\xb9\x11\x22\x95\x01\xb9\x12\x22\x95\x02\xa4\xc2\x68\x60\x48\x86\xc6\x98\x29\xe0"
+"\x85\xc2\xf0\x11\x20\xfa\xe0\xa8\xa9\x00\x38\x6a\x88\xd0\xfc\xa4\xc2\x24\xc0\xd0\x03\x68\x38\x60\x68\x18\x60\xa2\x20\x8a\x18\x79"
+"\x00\x22\xc8\xca\xd0\xf9\x69\x00\xa4\xc2\x60\x20\x9d\xea\xc9\xff\xf0\xe8\x00\x18\xb9\x0f\x22\x79\x11\x22\x85\xa3\x99\x1c\x8a\x00"
+"\xf0\x07\x29\x0f\x79\x12\x22\x85\xa2\x99\x1d\x22\x20\x65\xeb\xa9\xff\x99\x1f\x22\x20\x9d\xea\x49\x08\x00\xf0\x07\x60\x18\x79\x1f"
+"\x22\x69\x00\xd0\xf4\x20\xe6\xff\xc9\x04\xf0\x22\x18\x60\xd8\x98\xf0\xf3\x42\x02\x70\x3b\x98\x20\xfa\xec\xd0\x15\x2b\x02\xf1\x13"
+"\x10\xd0\x4f\xa9\x10\x20\x67\xeb\x20\xd1\xea\xa6\xc6\xa9\xff\x38\x60\xb9\x17\x22\x30\x10\x20\xad\xea\x20\x3e\xe9\x20\x76\xeb\x38"
+"\x20\x7e\x23\x02\xf0\x1a\x10\x22\x85\x9a\xb9\x13\x22\x85\x9b\xa0\x00\xb1\x9a\x48\xa4\xc2\xa9\xfe\x20\xdf\xea\xa6\x9a\xe8\x8a\x99"
+"\x10\x22\xd0\x19\x18\xb9\x11\x22\x69\x01\x99\x11\x22\xb9\x12\x3e\x01\xf1\x09\x12\x22\x20\x6c\xeb\xa9\x80\x20\xdf\xea\x18\x4c\xae"
+"\xe8\xa9\x80\x19\x17\x22\xd0\x05\xa9\x7f\x39\x2a\x01\x10\x18\x62\x00\xb0\x29\x40\xf0\x3a\x18\x08\x20\x5b\xe7\xa4\xc2\x56\x00\xf0"
+"\x1a\x9d\xa9\x00\x85\x9c\x85\xa0\xa9\x01\x85\xa1\x28\xb0\x16\xb9\x1c\x22\x85\xa3\xb9\x1d\x22\x85\xa2\x20\xb0\xe6\xa4\xc2\xa9\xbf"
+"\x20\x6e\xeb\x90\x06\x20\xb5\xea\x20\xa3\xa2\x06\xc0\xa4\xc2\x60\x68\x4c\xe9\xff\xd8\x48\x98\xf0\xf7\xcd\x00\xf0\x01\x59\x20\xad"
+"\xea\xb9\x0e\x22\x30\xbc\x20\x3e\xe9\x98\x18\x69\x04\xdb\x00\xf0\x03\x51\x20\x15\xe9\xa6\xc4\x38\xbd\x07\x21\xfd\x0f\x21\x48\xbd"
+"\x06\x21\xfd\xbb\x08\x28\x85\xc3\x05\x03\x11\xdd\x08\x03\x80\xd0\x0d\x68\xdd\x0d\x21\xd0\x08\x26\x07\xf0\x04\x9e\xe8\x00\x68\x9d"
+"\x0d\x21\x99\x19\x22\xa5\xc3\x99\x1a\x22\xa9\x00\x9d\x0c\x28\x03\x50\x20\x26\xe2\xa4\xc2\x17\x01\x91\x17\x20\x76\xeb\xb9\x14\x22"
+"\xd0\x0b\x3f\x01\x60\x05\x20\xb5\xea\xd0\x04\x21\x01\x15\xb9\x1e\x01\x41\x68\xa0\x00\x91\x1f\x01\x80\x40\x20\x67\xeb\xe6\x9a\xa5"
+"\x9a\x1f\x01\x4c\x13\x20\x6c\xeb\x21\x01\x00\x42\x00\x91\x90\x17\xa9\x20\x20\x67\xeb\xb9\x10\x5a\x02\x11\x11\x5a\x02\x40\x12\x22"
+"\x99\x16\x4d\x02\x70\x20\x00\xe5\x4c\x61\xeb\x48\xe0\x00\xf0\x13\xd0\x20\xad\xea\xa6\xc6\x20\x04\xe1\x20\x12\xed\x90\x63\xa4\xc2"
+"\x20\x12\xed\xb0\x07\xa9\xff\x20\xbc\xeb\xd0\xf4\xb5\x00\x99\x10\x22\xb5\x7a\x01\xa3\xb5\x02\x99\x12\x22\xa9\x6f\x20\x6e\xeb\x1f"
+"\x02\x20\xc5\xb9\xad\x03\xf0\x02\x79\x12\x22\xd9\x1d\x22\xd0\x0a\xa5\xc5\xd9\x1c\x22\xd0\x03\x20\x65\xe9\x01\xf1\x33\x4c\x61\xeb"
+"\xaa\xb9\x12\x22\xdd\x16\x22\xd0\x0e\xb9\x11\x22\xdd\x15\x22\xd0\x06\xb9\x10\x22\xdd\x14\x22\x60\xb9\x14\x22\xd5\x00\xb9\x15\x22"
+"\xf5\x01\xb9\x16\x22\xf5\x02\x60\x08\xd8\x86\xe4\x84\xe5\x2c\x02\xb0\x50\x05\x20\x71\xfe\x90\xf6\x20\x8a\xfb\x20\x71\xfe\xb0\x05"
+"\x00\xf2\x1a\xf6\x98\xa2\x17\x20\xc5\xfe\xbd\x48\xed\x85\xe2\xbd\x55\xed\x85\xe3\x98\x6c\xe2\x00\xdf\xd2\x9a\x88\xe2\x81\xc0\xdf"
+"\xd8\xd6\xc8\xc6\xc2\xfd\xfd\xfd\xed\xfd\xed\xfd\x01\x00\xf0\x65\xa9\x0b\xd0\x0a\xa9\x08\xd0\x06\xa9\x09\xd0\x02\xa9\x0a\x20\x97"
+"\xed\x4c\x22\xed\xa0\x00\xb1\xd2\x4c\x60\xfe\x29\x05\x2e\x01\xb0\x2a\x20\x1f\xee\x4c\x28\xed\x20\xfb\xfe\x08\x48\xd8\x84\xe9\x20"
+"\x1f\xee\x68\xa4\xe9\x28\x60\x68\x68\x60\x88\x10\x14\xa0\x27\xa5\xce\xc9\x18\xb0\xf2\xe6\xce\xa5\xcf\xe9\x27\x85\xcf\xb0\x02\xc6"
+"\xd0\x60\xc6\xce\x60\xa0\x28\x20\xf6\xed\xa5\xd2\x85\xcf\xa5\xd4\x85\xd0\xa5\xce\xd0\xec\xa0\x0d\x8c\x00\x08\xa5\xcf\x38\xe9\xc0"
+"\x8d\x01\x08\x88\x0c\x00\xf0\x4c\xd0\xe9\x03\x8d\x01\x08\xa0\x27\xa9\x20\x20\x0b\xee\x88\x10\xfa\x60\x48\x18\x98\x65\xcf\x85\xd2"
+"\xa5\xd0\x69\x00\x85\xd4\x29\x07\x09\x04\x85\xd3\x68\x60\x20\xf6\xed\x84\xd4\xa0\x00\x91\xd2\xa4\xd4\x60\x18\x08\x06\xd1\x28\x66"
+"\xd1\x60\xc9\x06\xf0\xf4\xc9\x15\xf0\xf1\xa4\xd1\x30\x2d\xc9\x20\x90\x34\xc9\x7f\xf0\x26\x20\x0b\xee\xc8\xc0\x28\x90\x05\x20\xc2"
+"\xed\xa0\x00\x35\x00\x30\xd1\xa0\x0f\x66\x00\x13\xd2\x6f\x00\x91\xa4\xd4\x8c\x01\x08\x60\x20\xa7\xed\x6f\x00\xf0\x36\x10\xdd\xc9"
+"\x0d\xf0\xd7\xc9\x0a\xf0\x20\xc9\x0c\xf0\x3b\xc9\x08\xf0\x12\xc9\x1e\xf0\x1c\xc9\x0b\xf0\x29\xc9\x07\xf0\x5b\xc9\x09\xd0\xb0\xb0"
+"\xb1\x20\xa7\xed\x4c\x40\xee\x20\xc2\xed\xa4\xd1\x4c\x40\xee\xa9\x18\xa4\xce\x85\xce\xc0\x18\xb0\xa1\xc8\x20\xb4\xed\x4c\x99\xee"
+"\x20\xac\x1f\x00\xf1\x08\xa9\x20\xa0\x00\x99\x00\x04\x99\x00\x05\x99\x00\x06\x99\x00\x07\xc8\xd0\xf1\x84\xcf\x84\xd1\xee\x00\x30"
+"\xb9\x1c\xef\x7d\x00\xf1\x79\x10\xf4\xa9\x18\x85\xce\xa9\x04\x85\xd0\x4c\x3e\xee\x86\xd2\x20\x1a\xfd\xa6\xd2\x60\xa2\x0c\xbd\x1e"
+"\xef\x9d\x00\x02\xe8\xe0\x1c\xd0\xf5\xa9\x7b\x8d\x00\x02\xa9\xe8\x8d\x01\x02\xa9\xe5\x8d\x06\x02\xa9\xe3\x8d\x07\x02\xa9\x20\x85"
+"\xcd\x85\xac\xa0\x00\x84\xee\x84\xc0\x84\xb9\x84\xba\xa2\x04\x20\x13\xe7\xca\xd0\xfa\x60\x3f\x28\x33\x44\x1e\x02\x19\x1b\x03\x12"
+"\x72\x13\x04\x00\x77\xe4\x13\xe6\x61\xea\xa0\xec\xf0\xea\xbc\xeb\x53\xe9\x9e\xe8\x49\x43\x45\x53\x2e\x0d\x00\x20\x53\x43\x52\x41"
+"\x20\x2a\x20\x24\x30\x34\x30\x30\x0d\x00\x30\x53\x43\x52\x42\x0f\x00\x10\x35\x0f\x00\x51\x40\x53\x43\x52\x43\x0f\x00\x10\x36\x0f"
+"\x00\x51\x50\x53\x43\x52\x44\x0f\x00\x10\x37\x0f\x00\x51\x60\x48\x53\x59\x4e\x1f\x00\xf1\x19\x33\x33\x0d\x00\x70\x4b\x42\x49\x4e"
+"\x20\x50\x48\x50\x0d\x00\x80\x20\x43\x4c\x44\x0d\x00\x90\x20\x53\x54\x58\x20\x24\x30\x30\x45\x34\x0d\x01\x00\x20\x53\x54\x59\x0d"
+"\x00\xf0\x18\x35\x0d\x01\x10\x46\x49\x4e\x44\x4b\x59\x20\x42\x49\x54\x20\x24\x42\x30\x30\x32\x0d\x01\x20\x20\x42\x56\x43\x20\x52"
+"\x45\x50\x54\x54\x54\x0d\x01\x30\x4e\x4f\x0b\x00\xf2\x03\x20\x4a\x53\x52\x20\x24\x46\x45\x37\x31\x0d\x01\x40\x20\x42\x43\x43\x20"
+"\x39\x00\x90\x0d\x00\x00\x00\x00\x40\x40\x40\x40"
+;
+unsigned char dump_dosrom[4096];
+#include <string.h>
+static void _atom_dump_init_lz4(const unsigned char* src, int src_size, unsigned char* dst) {
+    const unsigned char* end = src + src_size;
+    while (src < end) {
+        const unsigned char token = *src++;
+        int len = token >> 4;
+        if (len == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }
+        memcpy(dst, src, len); dst += len; src += len;
+        if (src >= end) { break; }
+        const unsigned char* m = dst - (src[0] | (src[1]<<8)); src += 2;
+        len = (token & 15) + 4;
+        if ((token & 15) == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }
+        while (len-- > 0) { *dst++ = *m++; }
+    }
+}
+static void atom_dump_init(void) {
+    _atom_dump_init_lz4(dump_abasic_lz4, sizeof(dump_abasic_lz4) - 1, dump_abasic);
+    _atom_dump_init_lz4(dump_afloat_lz4, sizeof(dump_afloat_lz4) - 1, dump_afloat);
+    _atom_dump_init_lz4(dump_dosrom_lz4, sizeof(dump_dosrom_lz4) - 1, dump_dosrom);
+}
+#if defined(_MSC_VER)
+#pragma section(".CRT$XCU", read)
+__declspec(allocate(".CRT$XCU")) void (*_atom_dump_init_ctor)(void) = atom_dump_init;
+#else
+__attribute__((constructor)) static void _atom_dump_init_ctor(void) { atom_dump_init(); }
+#endif
+dump_item atom_dump_items[ATOM_DUMP_NUM_ITEMS] = {
+{ "abasic", dump_abasic, 8192 },
 { "afloat", dump_afloat, 4096 },
 { "dosrom", dump_dosrom, 4096 },
-{ "abasic", dump_abasic, 8192 },
 };
@@ -1,1297 +1,599 @@
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include "c64-roms.h"
-unsigned char dump_c64_basic[8192] = {
-0x94, 0xe3, 0x7b, 0xe3, 0x43, 0x42, 0x4d, 0x42, 0x41, 0x53, 0x49, 0x43, 0x30, 0xa8, 0x41, 0xa7, 
-0x1d, 0xad, 0xf7, 0xa8, 0xa4, 0xab, 0xbe, 0xab, 0x80, 0xb0, 0x5, 0xac, 0xa4, 0xa9, 0x9f, 0xa8, 
-0x70, 0xa8, 0x27, 0xa9, 0x1c, 0xa8, 0x82, 0xa8, 0xd1, 0xa8, 0x3a, 0xa9, 0x2e, 0xa8, 0x4a, 0xa9, 
-0x2c, 0xb8, 0x67, 0xe1, 0x55, 0xe1, 0x64, 0xe1, 0xb2, 0xb3, 0x23, 0xb8, 0x7f, 0xaa, 0x9f, 0xaa, 
-0x56, 0xa8, 0x9b, 0xa6, 0x5d, 0xa6, 0x85, 0xaa, 0x29, 0xe1, 0xbd, 0xe1, 0xc6, 0xe1, 0x7a, 0xab, 
-0x41, 0xa6, 0x39, 0xbc, 0xcc, 0xbc, 0x58, 0xbc, 0x10, 0x3, 0x7d, 0xb3, 0x9e, 0xb3, 0x71, 0xbf, 
-0x97, 0xe0, 0xea, 0xb9, 0xed, 0xbf, 0x64, 0xe2, 0x6b, 0xe2, 0xb4, 0xe2, 0xe, 0xe3, 0xd, 0xb8, 
-0x7c, 0xb7, 0x65, 0xb4, 0xad, 0xb7, 0x8b, 0xb7, 0xec, 0xb6, 0x0, 0xb7, 0x2c, 0xb7, 0x37, 0xb7, 
-0x79, 0x69, 0xb8, 0x79, 0x52, 0xb8, 0x7b, 0x2a, 0xba, 0x7b, 0x11, 0xbb, 0x7f, 0x7a, 0xbf, 0x50, 
-0xe8, 0xaf, 0x46, 0xe5, 0xaf, 0x7d, 0xb3, 0xbf, 0x5a, 0xd3, 0xae, 0x64, 0x15, 0xb0, 0x45, 0x4e, 
-0xc4, 0x46, 0x4f, 0xd2, 0x4e, 0x45, 0x58, 0xd4, 0x44, 0x41, 0x54, 0xc1, 0x49, 0x4e, 0x50, 0x55, 
-0x54, 0xa3, 0x49, 0x4e, 0x50, 0x55, 0xd4, 0x44, 0x49, 0xcd, 0x52, 0x45, 0x41, 0xc4, 0x4c, 0x45, 
-0xd4, 0x47, 0x4f, 0x54, 0xcf, 0x52, 0x55, 0xce, 0x49, 0xc6, 0x52, 0x45, 0x53, 0x54, 0x4f, 0x52, 
-0xc5, 0x47, 0x4f, 0x53, 0x55, 0xc2, 0x52, 0x45, 0x54, 0x55, 0x52, 0xce, 0x52, 0x45, 0xcd, 0x53, 
-0x54, 0x4f, 0xd0, 0x4f, 0xce, 0x57, 0x41, 0x49, 0xd4, 0x4c, 0x4f, 0x41, 0xc4, 0x53, 0x41, 0x56, 
-0xc5, 0x56, 0x45, 0x52, 0x49, 0x46, 0xd9, 0x44, 0x45, 0xc6, 0x50, 0x4f, 0x4b, 0xc5, 0x50, 0x52, 
-0x49, 0x4e, 0x54, 0xa3, 0x50, 0x52, 0x49, 0x4e, 0xd4, 0x43, 0x4f, 0x4e, 0xd4, 0x4c, 0x49, 0x53, 
-0xd4, 0x43, 0x4c, 0xd2, 0x43, 0x4d, 0xc4, 0x53, 0x59, 0xd3, 0x4f, 0x50, 0x45, 0xce, 0x43, 0x4c, 
-0x4f, 0x53, 0xc5, 0x47, 0x45, 0xd4, 0x4e, 0x45, 0xd7, 0x54, 0x41, 0x42, 0xa8, 0x54, 0xcf, 0x46, 
-0xce, 0x53, 0x50, 0x43, 0xa8, 0x54, 0x48, 0x45, 0xce, 0x4e, 0x4f, 0xd4, 0x53, 0x54, 0x45, 0xd0, 
-0xab, 0xad, 0xaa, 0xaf, 0xde, 0x41, 0x4e, 0xc4, 0x4f, 0xd2, 0xbe, 0xbd, 0xbc, 0x53, 0x47, 0xce, 
-0x49, 0x4e, 0xd4, 0x41, 0x42, 0xd3, 0x55, 0x53, 0xd2, 0x46, 0x52, 0xc5, 0x50, 0x4f, 0xd3, 0x53, 
-0x51, 0xd2, 0x52, 0x4e, 0xc4, 0x4c, 0x4f, 0xc7, 0x45, 0x58, 0xd0, 0x43, 0x4f, 0xd3, 0x53, 0x49, 
-0xce, 0x54, 0x41, 0xce, 0x41, 0x54, 0xce, 0x50, 0x45, 0x45, 0xcb, 0x4c, 0x45, 0xce, 0x53, 0x54, 
-0x52, 0xa4, 0x56, 0x41, 0xcc, 0x41, 0x53, 0xc3, 0x43, 0x48, 0x52, 0xa4, 0x4c, 0x45, 0x46, 0x54, 
-0xa4, 0x52, 0x49, 0x47, 0x48, 0x54, 0xa4, 0x4d, 0x49, 0x44, 0xa4, 0x47, 0xcf, 0x0, 0x54, 0x4f, 
-0x4f, 0x20, 0x4d, 0x41, 0x4e, 0x59, 0x20, 0x46, 0x49, 0x4c, 0x45, 0xd3, 0x46, 0x49, 0x4c, 0x45, 
-0x20, 0x4f, 0x50, 0x45, 0xce, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4f, 0x50, 
-0x45, 0xce, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x46, 0x4f, 0x55, 0x4e, 0xc4, 
-0x44, 0x45, 0x56, 0x49, 0x43, 0x45, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x50, 0x52, 0x45, 0x53, 0x45, 
-0x4e, 0xd4, 0x4e, 0x4f, 0x54, 0x20, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x20, 0x46, 0x49, 0x4c, 0xc5, 
-0x4e, 0x4f, 0x54, 0x20, 0x4f, 0x55, 0x54, 0x50, 0x55, 0x54, 0x20, 0x46, 0x49, 0x4c, 0xc5, 0x4d, 
-0x49, 0x53, 0x53, 0x49, 0x4e, 0x47, 0x20, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x4e, 0x41, 0x4d, 0xc5, 
-0x49, 0x4c, 0x4c, 0x45, 0x47, 0x41, 0x4c, 0x20, 0x44, 0x45, 0x56, 0x49, 0x43, 0x45, 0x20, 0x4e, 
-0x55, 0x4d, 0x42, 0x45, 0xd2, 0x4e, 0x45, 0x58, 0x54, 0x20, 0x57, 0x49, 0x54, 0x48, 0x4f, 0x55, 
-0x54, 0x20, 0x46, 0x4f, 0xd2, 0x53, 0x59, 0x4e, 0x54, 0x41, 0xd8, 0x52, 0x45, 0x54, 0x55, 0x52, 
-0x4e, 0x20, 0x57, 0x49, 0x54, 0x48, 0x4f, 0x55, 0x54, 0x20, 0x47, 0x4f, 0x53, 0x55, 0xc2, 0x4f, 
-0x55, 0x54, 0x20, 0x4f, 0x46, 0x20, 0x44, 0x41, 0x54, 0xc1, 0x49, 0x4c, 0x4c, 0x45, 0x47, 0x41, 
-0x4c, 0x20, 0x51, 0x55, 0x41, 0x4e, 0x54, 0x49, 0x54, 0xd9, 0x4f, 0x56, 0x45, 0x52, 0x46, 0x4c, 
-0x4f, 0xd7, 0x4f, 0x55, 0x54, 0x20, 0x4f, 0x46, 0x20, 0x4d, 0x45, 0x4d, 0x4f, 0x52, 0xd9, 0x55, 
-0x4e, 0x44, 0x45, 0x46, 0x27, 0x44, 0x20, 0x53, 0x54, 0x41, 0x54, 0x45, 0x4d, 0x45, 0x4e, 0xd4, 
-0x42, 0x41, 0x44, 0x20, 0x53, 0x55, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0xd4, 0x52, 0x45, 0x44, 
-0x49, 0x4d, 0x27, 0x44, 0x20, 0x41, 0x52, 0x52, 0x41, 0xd9, 0x44, 0x49, 0x56, 0x49, 0x53, 0x49, 
-0x4f, 0x4e, 0x20, 0x42, 0x59, 0x20, 0x5a, 0x45, 0x52, 0xcf, 0x49, 0x4c, 0x4c, 0x45, 0x47, 0x41, 
-0x4c, 0x20, 0x44, 0x49, 0x52, 0x45, 0x43, 0xd4, 0x54, 0x59, 0x50, 0x45, 0x20, 0x4d, 0x49, 0x53, 
-0x4d, 0x41, 0x54, 0x43, 0xc8, 0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x20, 0x54, 0x4f, 0x4f, 0x20, 
-0x4c, 0x4f, 0x4e, 0xc7, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x44, 0x41, 0x54, 0xc1, 0x46, 0x4f, 0x52, 
-0x4d, 0x55, 0x4c, 0x41, 0x20, 0x54, 0x4f, 0x4f, 0x20, 0x43, 0x4f, 0x4d, 0x50, 0x4c, 0x45, 0xd8, 
-0x43, 0x41, 0x4e, 0x27, 0x54, 0x20, 0x43, 0x4f, 0x4e, 0x54, 0x49, 0x4e, 0x55, 0xc5, 0x55, 0x4e, 
-0x44, 0x45, 0x46, 0x27, 0x44, 0x20, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0xce, 0x56, 0x45, 
-0x52, 0x49, 0x46, 0xd9, 0x4c, 0x4f, 0x41, 0xc4, 0x9e, 0xa1, 0xac, 0xa1, 0xb5, 0xa1, 0xc2, 0xa1, 
-0xd0, 0xa1, 0xe2, 0xa1, 0xf0, 0xa1, 0xff, 0xa1, 0x10, 0xa2, 0x25, 0xa2, 0x35, 0xa2, 0x3b, 0xa2, 
-0x4f, 0xa2, 0x5a, 0xa2, 0x6a, 0xa2, 0x72, 0xa2, 0x7f, 0xa2, 0x90, 0xa2, 0x9d, 0xa2, 0xaa, 0xa2, 
-0xba, 0xa2, 0xc8, 0xa2, 0xd5, 0xa2, 0xe4, 0xa2, 0xed, 0xa2, 0x0, 0xa3, 0xe, 0xa3, 0x1e, 0xa3, 
-0x24, 0xa3, 0x83, 0xa3, 0xd, 0x4f, 0x4b, 0xd, 0x0, 0x20, 0x20, 0x45, 0x52, 0x52, 0x4f, 0x52, 
-0x0, 0x20, 0x49, 0x4e, 0x20, 0x0, 0xd, 0xa, 0x52, 0x45, 0x41, 0x44, 0x59, 0x2e, 0xd, 0xa, 
-0x0, 0xd, 0xa, 0x42, 0x52, 0x45, 0x41, 0x4b, 0x0, 0xa0, 0xba, 0xe8, 0xe8, 0xe8, 0xe8, 0xbd, 
-0x1, 0x1, 0xc9, 0x81, 0xd0, 0x21, 0xa5, 0x4a, 0xd0, 0xa, 0xbd, 0x2, 0x1, 0x85, 0x49, 0xbd, 
-0x3, 0x1, 0x85, 0x4a, 0xdd, 0x3, 0x1, 0xd0, 0x7, 0xa5, 0x49, 0xdd, 0x2, 0x1, 0xf0, 0x7, 
-0x8a, 0x18, 0x69, 0x12, 0xaa, 0xd0, 0xd8, 0x60, 0x20, 0x8, 0xa4, 0x85, 0x31, 0x84, 0x32, 0x38, 
-0xa5, 0x5a, 0xe5, 0x5f, 0x85, 0x22, 0xa8, 0xa5, 0x5b, 0xe5, 0x60, 0xaa, 0xe8, 0x98, 0xf0, 0x23, 
-0xa5, 0x5a, 0x38, 0xe5, 0x22, 0x85, 0x5a, 0xb0, 0x3, 0xc6, 0x5b, 0x38, 0xa5, 0x58, 0xe5, 0x22, 
-0x85, 0x58, 0xb0, 0x8, 0xc6, 0x59, 0x90, 0x4, 0xb1, 0x5a, 0x91, 0x58, 0x88, 0xd0, 0xf9, 0xb1, 
-0x5a, 0x91, 0x58, 0xc6, 0x5b, 0xc6, 0x59, 0xca, 0xd0, 0xf2, 0x60, 0xa, 0x69, 0x3e, 0xb0, 0x35, 
-0x85, 0x22, 0xba, 0xe4, 0x22, 0x90, 0x2e, 0x60, 0xc4, 0x34, 0x90, 0x28, 0xd0, 0x4, 0xc5, 0x33, 
-0x90, 0x22, 0x48, 0xa2, 0x9, 0x98, 0x48, 0xb5, 0x57, 0xca, 0x10, 0xfa, 0x20, 0x26, 0xb5, 0xa2, 
-0xf7, 0x68, 0x95, 0x61, 0xe8, 0x30, 0xfa, 0x68, 0xa8, 0x68, 0xc4, 0x34, 0x90, 0x6, 0xd0, 0x5, 
-0xc5, 0x33, 0xb0, 0x1, 0x60, 0xa2, 0x10, 0x6c, 0x0, 0x3, 0x8a, 0xa, 0xaa, 0xbd, 0x26, 0xa3, 
-0x85, 0x22, 0xbd, 0x27, 0xa3, 0x85, 0x23, 0x20, 0xcc, 0xff, 0xa9, 0x0, 0x85, 0x13, 0x20, 0xd7, 
-0xaa, 0x20, 0x45, 0xab, 0xa0, 0x0, 0xb1, 0x22, 0x48, 0x29, 0x7f, 0x20, 0x47, 0xab, 0xc8, 0x68, 
-0x10, 0xf4, 0x20, 0x7a, 0xa6, 0xa9, 0x69, 0xa0, 0xa3, 0x20, 0x1e, 0xab, 0xa4, 0x3a, 0xc8, 0xf0, 
-0x3, 0x20, 0xc2, 0xbd, 0xa9, 0x76, 0xa0, 0xa3, 0x20, 0x1e, 0xab, 0xa9, 0x80, 0x20, 0x90, 0xff, 
-0x6c, 0x2, 0x3, 0x20, 0x60, 0xa5, 0x86, 0x7a, 0x84, 0x7b, 0x20, 0x73, 0x0, 0xaa, 0xf0, 0xf0, 
-0xa2, 0xff, 0x86, 0x3a, 0x90, 0x6, 0x20, 0x79, 0xa5, 0x4c, 0xe1, 0xa7, 0x20, 0x6b, 0xa9, 0x20, 
-0x79, 0xa5, 0x84, 0xb, 0x20, 0x13, 0xa6, 0x90, 0x44, 0xa0, 0x1, 0xb1, 0x5f, 0x85, 0x23, 0xa5, 
-0x2d, 0x85, 0x22, 0xa5, 0x60, 0x85, 0x25, 0xa5, 0x5f, 0x88, 0xf1, 0x5f, 0x18, 0x65, 0x2d, 0x85, 
-0x2d, 0x85, 0x24, 0xa5, 0x2e, 0x69, 0xff, 0x85, 0x2e, 0xe5, 0x60, 0xaa, 0x38, 0xa5, 0x5f, 0xe5, 
-0x2d, 0xa8, 0xb0, 0x3, 0xe8, 0xc6, 0x25, 0x18, 0x65, 0x22, 0x90, 0x3, 0xc6, 0x23, 0x18, 0xb1, 
-0x22, 0x91, 0x24, 0xc8, 0xd0, 0xf9, 0xe6, 0x23, 0xe6, 0x25, 0xca, 0xd0, 0xf2, 0x20, 0x59, 0xa6, 
-0x20, 0x33, 0xa5, 0xad, 0x0, 0x2, 0xf0, 0x88, 0x18, 0xa5, 0x2d, 0x85, 0x5a, 0x65, 0xb, 0x85, 
-0x58, 0xa4, 0x2e, 0x84, 0x5b, 0x90, 0x1, 0xc8, 0x84, 0x59, 0x20, 0xb8, 0xa3, 0xa5, 0x14, 0xa4, 
-0x15, 0x8d, 0xfe, 0x1, 0x8c, 0xff, 0x1, 0xa5, 0x31, 0xa4, 0x32, 0x85, 0x2d, 0x84, 0x2e, 0xa4, 
-0xb, 0x88, 0xb9, 0xfc, 0x1, 0x91, 0x5f, 0x88, 0x10, 0xf8, 0x20, 0x59, 0xa6, 0x20, 0x33, 0xa5, 
-0x4c, 0x80, 0xa4, 0xa5, 0x2b, 0xa4, 0x2c, 0x85, 0x22, 0x84, 0x23, 0x18, 0xa0, 0x1, 0xb1, 0x22, 
-0xf0, 0x1d, 0xa0, 0x4, 0xc8, 0xb1, 0x22, 0xd0, 0xfb, 0xc8, 0x98, 0x65, 0x22, 0xaa, 0xa0, 0x0, 
-0x91, 0x22, 0xa5, 0x23, 0x69, 0x0, 0xc8, 0x91, 0x22, 0x86, 0x22, 0x85, 0x23, 0x90, 0xdd, 0x60, 
-0xa2, 0x0, 0x20, 0x12, 0xe1, 0xc9, 0xd, 0xf0, 0xd, 0x9d, 0x0, 0x2, 0xe8, 0xe0, 0x59, 0x90, 
-0xf1, 0xa2, 0x17, 0x4c, 0x37, 0xa4, 0x4c, 0xca, 0xaa, 0x6c, 0x4, 0x3, 0xa6, 0x7a, 0xa0, 0x4, 
-0x84, 0xf, 0xbd, 0x0, 0x2, 0x10, 0x7, 0xc9, 0xff, 0xf0, 0x3e, 0xe8, 0xd0, 0xf4, 0xc9, 0x20, 
-0xf0, 0x37, 0x85, 0x8, 0xc9, 0x22, 0xf0, 0x56, 0x24, 0xf, 0x70, 0x2d, 0xc9, 0x3f, 0xd0, 0x4, 
-0xa9, 0x99, 0xd0, 0x25, 0xc9, 0x30, 0x90, 0x4, 0xc9, 0x3c, 0x90, 0x1d, 0x84, 0x71, 0xa0, 0x0, 
-0x84, 0xb, 0x88, 0x86, 0x7a, 0xca, 0xc8, 0xe8, 0xbd, 0x0, 0x2, 0x38, 0xf9, 0x9e, 0xa0, 0xf0, 
-0xf5, 0xc9, 0x80, 0xd0, 0x30, 0x5, 0xb, 0xa4, 0x71, 0xe8, 0xc8, 0x99, 0xfb, 0x1, 0xb9, 0xfb, 
-0x1, 0xf0, 0x36, 0x38, 0xe9, 0x3a, 0xf0, 0x4, 0xc9, 0x49, 0xd0, 0x2, 0x85, 0xf, 0x38, 0xe9, 
-0x55, 0xd0, 0x9f, 0x85, 0x8, 0xbd, 0x0, 0x2, 0xf0, 0xdf, 0xc5, 0x8, 0xf0, 0xdb, 0xc8, 0x99, 
-0xfb, 0x1, 0xe8, 0xd0, 0xf0, 0xa6, 0x7a, 0xe6, 0xb, 0xc8, 0xb9, 0x9d, 0xa0, 0x10, 0xfa, 0xb9, 
-0x9e, 0xa0, 0xd0, 0xb4, 0xbd, 0x0, 0x2, 0x10, 0xbe, 0x99, 0xfd, 0x1, 0xc6, 0x7b, 0xa9, 0xff, 
-0x85, 0x7a, 0x60, 0xa5, 0x2b, 0xa6, 0x2c, 0xa0, 0x1, 0x85, 0x5f, 0x86, 0x60, 0xb1, 0x5f, 0xf0, 
-0x1f, 0xc8, 0xc8, 0xa5, 0x15, 0xd1, 0x5f, 0x90, 0x18, 0xf0, 0x3, 0x88, 0xd0, 0x9, 0xa5, 0x14, 
-0x88, 0xd1, 0x5f, 0x90, 0xc, 0xf0, 0xa, 0x88, 0xb1, 0x5f, 0xaa, 0x88, 0xb1, 0x5f, 0xb0, 0xd7, 
-0x18, 0x60, 0xd0, 0xfd, 0xa9, 0x0, 0xa8, 0x91, 0x2b, 0xc8, 0x91, 0x2b, 0xa5, 0x2b, 0x18, 0x69, 
-0x2, 0x85, 0x2d, 0xa5, 0x2c, 0x69, 0x0, 0x85, 0x2e, 0x20, 0x8e, 0xa6, 0xa9, 0x0, 0xd0, 0x2d, 
-0x20, 0xe7, 0xff, 0xa5, 0x37, 0xa4, 0x38, 0x85, 0x33, 0x84, 0x34, 0xa5, 0x2d, 0xa4, 0x2e, 0x85, 
-0x2f, 0x84, 0x30, 0x85, 0x31, 0x84, 0x32, 0x20, 0x1d, 0xa8, 0xa2, 0x19, 0x86, 0x16, 0x68, 0xa8, 
-0x68, 0xa2, 0xfa, 0x9a, 0x48, 0x98, 0x48, 0xa9, 0x0, 0x85, 0x3e, 0x85, 0x10, 0x60, 0x18, 0xa5, 
-0x2b, 0x69, 0xff, 0x85, 0x7a, 0xa5, 0x2c, 0x69, 0xff, 0x85, 0x7b, 0x60, 0x90, 0x6, 0xf0, 0x4, 
-0xc9, 0xab, 0xd0, 0xe9, 0x20, 0x6b, 0xa9, 0x20, 0x13, 0xa6, 0x20, 0x79, 0x0, 0xf0, 0xc, 0xc9, 
-0xab, 0xd0, 0x8e, 0x20, 0x73, 0x0, 0x20, 0x6b, 0xa9, 0xd0, 0x86, 0x68, 0x68, 0xa5, 0x14, 0x5, 
-0x15, 0xd0, 0x6, 0xa9, 0xff, 0x85, 0x14, 0x85, 0x15, 0xa0, 0x1, 0x84, 0xf, 0xb1, 0x5f, 0xf0, 
-0x43, 0x20, 0x2c, 0xa8, 0x20, 0xd7, 0xaa, 0xc8, 0xb1, 0x5f, 0xaa, 0xc8, 0xb1, 0x5f, 0xc5, 0x15, 
-0xd0, 0x4, 0xe4, 0x14, 0xf0, 0x2, 0xb0, 0x2c, 0x84, 0x49, 0x20, 0xcd, 0xbd, 0xa9, 0x20, 0xa4, 
-0x49, 0x29, 0x7f, 0x20, 0x47, 0xab, 0xc9, 0x22, 0xd0, 0x6, 0xa5, 0xf, 0x49, 0xff, 0x85, 0xf, 
-0xc8, 0xf0, 0x11, 0xb1, 0x5f, 0xd0, 0x10, 0xa8, 0xb1, 0x5f, 0xaa, 0xc8, 0xb1, 0x5f, 0x86, 0x5f, 
-0x85, 0x60, 0xd0, 0xb5, 0x4c, 0x86, 0xe3, 0x6c, 0x6, 0x3, 0x10, 0xd7, 0xc9, 0xff, 0xf0, 0xd3, 
-0x24, 0xf, 0x30, 0xcf, 0x38, 0xe9, 0x7f, 0xaa, 0x84, 0x49, 0xa0, 0xff, 0xca, 0xf0, 0x8, 0xc8, 
-0xb9, 0x9e, 0xa0, 0x10, 0xfa, 0x30, 0xf5, 0xc8, 0xb9, 0x9e, 0xa0, 0x30, 0xb2, 0x20, 0x47, 0xab, 
-0xd0, 0xf5, 0xa9, 0x80, 0x85, 0x10, 0x20, 0xa5, 0xa9, 0x20, 0x8a, 0xa3, 0xd0, 0x5, 0x8a, 0x69, 
-0xf, 0xaa, 0x9a, 0x68, 0x68, 0xa9, 0x9, 0x20, 0xfb, 0xa3, 0x20, 0x6, 0xa9, 0x18, 0x98, 0x65, 
-0x7a, 0x48, 0xa5, 0x7b, 0x69, 0x0, 0x48, 0xa5, 0x3a, 0x48, 0xa5, 0x39, 0x48, 0xa9, 0xa4, 0x20, 
-0xff, 0xae, 0x20, 0x8d, 0xad, 0x20, 0x8a, 0xad, 0xa5, 0x66, 0x9, 0x7f, 0x25, 0x62, 0x85, 0x62, 
-0xa9, 0x8b, 0xa0, 0xa7, 0x85, 0x22, 0x84, 0x23, 0x4c, 0x43, 0xae, 0xa9, 0xbc, 0xa0, 0xb9, 0x20, 
-0xa2, 0xbb, 0x20, 0x79, 0x0, 0xc9, 0xa9, 0xd0, 0x6, 0x20, 0x73, 0x0, 0x20, 0x8a, 0xad, 0x20, 
-0x2b, 0xbc, 0x20, 0x38, 0xae, 0xa5, 0x4a, 0x48, 0xa5, 0x49, 0x48, 0xa9, 0x81, 0x48, 0x20, 0x2c, 
-0xa8, 0xa5, 0x7a, 0xa4, 0x7b, 0xc0, 0x2, 0xea, 0xf0, 0x4, 0x85, 0x3d, 0x84, 0x3e, 0xa0, 0x0, 
-0xb1, 0x7a, 0xd0, 0x43, 0xa0, 0x2, 0xb1, 0x7a, 0x18, 0xd0, 0x3, 0x4c, 0x4b, 0xa8, 0xc8, 0xb1, 
-0x7a, 0x85, 0x39, 0xc8, 0xb1, 0x7a, 0x85, 0x3a, 0x98, 0x65, 0x7a, 0x85, 0x7a, 0x90, 0x2, 0xe6, 
-0x7b, 0x6c, 0x8, 0x3, 0x20, 0x73, 0x0, 0x20, 0xed, 0xa7, 0x4c, 0xae, 0xa7, 0xf0, 0x3c, 0xe9, 
-0x80, 0x90, 0x11, 0xc9, 0x23, 0xb0, 0x17, 0xa, 0xa8, 0xb9, 0xd, 0xa0, 0x48, 0xb9, 0xc, 0xa0, 
-0x48, 0x4c, 0x73, 0x0, 0x4c, 0xa5, 0xa9, 0xc9, 0x3a, 0xf0, 0xd6, 0x4c, 0x8, 0xaf, 0xc9, 0x4b, 
-0xd0, 0xf9, 0x20, 0x73, 0x0, 0xa9, 0xa4, 0x20, 0xff, 0xae, 0x4c, 0xa0, 0xa8, 0x38, 0xa5, 0x2b, 
-0xe9, 0x1, 0xa4, 0x2c, 0xb0, 0x1, 0x88, 0x85, 0x41, 0x84, 0x42, 0x60, 0x20, 0xe1, 0xff, 0xb0, 
-0x1, 0x18, 0xd0, 0x3c, 0xa5, 0x7a, 0xa4, 0x7b, 0xa6, 0x3a, 0xe8, 0xf0, 0xc, 0x85, 0x3d, 0x84, 
-0x3e, 0xa5, 0x39, 0xa4, 0x3a, 0x85, 0x3b, 0x84, 0x3c, 0x68, 0x68, 0xa9, 0x81, 0xa0, 0xa3, 0x90, 
-0x3, 0x4c, 0x69, 0xa4, 0x4c, 0x86, 0xe3, 0xd0, 0x17, 0xa2, 0x1a, 0xa4, 0x3e, 0xd0, 0x3, 0x4c, 
-0x37, 0xa4, 0xa5, 0x3d, 0x85, 0x7a, 0x84, 0x7b, 0xa5, 0x3b, 0xa4, 0x3c, 0x85, 0x39, 0x84, 0x3a, 
-0x60, 0x8, 0xa9, 0x0, 0x20, 0x90, 0xff, 0x28, 0xd0, 0x3, 0x4c, 0x59, 0xa6, 0x20, 0x60, 0xa6, 
-0x4c, 0x97, 0xa8, 0xa9, 0x3, 0x20, 0xfb, 0xa3, 0xa5, 0x7b, 0x48, 0xa5, 0x7a, 0x48, 0xa5, 0x3a, 
-0x48, 0xa5, 0x39, 0x48, 0xa9, 0x8d, 0x48, 0x20, 0x79, 0x0, 0x20, 0xa0, 0xa8, 0x4c, 0xae, 0xa7, 
-0x20, 0x6b, 0xa9, 0x20, 0x9, 0xa9, 0x38, 0xa5, 0x39, 0xe5, 0x14, 0xa5, 0x3a, 0xe5, 0x15, 0xb0, 
-0xb, 0x98, 0x38, 0x65, 0x7a, 0xa6, 0x7b, 0x90, 0x7, 0xe8, 0xb0, 0x4, 0xa5, 0x2b, 0xa6, 0x2c, 
-0x20, 0x17, 0xa6, 0x90, 0x1e, 0xa5, 0x5f, 0xe9, 0x1, 0x85, 0x7a, 0xa5, 0x60, 0xe9, 0x0, 0x85, 
-0x7b, 0x60, 0xd0, 0xfd, 0xa9, 0xff, 0x85, 0x4a, 0x20, 0x8a, 0xa3, 0x9a, 0xc9, 0x8d, 0xf0, 0xb, 
-0xa2, 0xc, 0x2c, 0xa2, 0x11, 0x4c, 0x37, 0xa4, 0x4c, 0x8, 0xaf, 0x68, 0x68, 0x85, 0x39, 0x68, 
-0x85, 0x3a, 0x68, 0x85, 0x7a, 0x68, 0x85, 0x7b, 0x20, 0x6, 0xa9, 0x98, 0x18, 0x65, 0x7a, 0x85, 
-0x7a, 0x90, 0x2, 0xe6, 0x7b, 0x60, 0xa2, 0x3a, 0x2c, 0xa2, 0x0, 0x86, 0x7, 0xa0, 0x0, 0x84, 
-0x8, 0xa5, 0x8, 0xa6, 0x7, 0x85, 0x7, 0x86, 0x8, 0xb1, 0x7a, 0xf0, 0xe8, 0xc5, 0x8, 0xf0, 
-0xe4, 0xc8, 0xc9, 0x22, 0xd0, 0xf3, 0xf0, 0xe9, 0x20, 0x9e, 0xad, 0x20, 0x79, 0x0, 0xc9, 0x89, 
-0xf0, 0x5, 0xa9, 0xa7, 0x20, 0xff, 0xae, 0xa5, 0x61, 0xd0, 0x5, 0x20, 0x9, 0xa9, 0xf0, 0xbb, 
-0x20, 0x79, 0x0, 0xb0, 0x3, 0x4c, 0xa0, 0xa8, 0x4c, 0xed, 0xa7, 0x20, 0x9e, 0xb7, 0x48, 0xc9, 
-0x8d, 0xf0, 0x4, 0xc9, 0x89, 0xd0, 0x91, 0xc6, 0x65, 0xd0, 0x4, 0x68, 0x4c, 0xef, 0xa7, 0x20, 
-0x73, 0x0, 0x20, 0x6b, 0xa9, 0xc9, 0x2c, 0xf0, 0xee, 0x68, 0x60, 0xa2, 0x0, 0x86, 0x14, 0x86, 
-0x15, 0xb0, 0xf7, 0xe9, 0x2f, 0x85, 0x7, 0xa5, 0x15, 0x85, 0x22, 0xc9, 0x19, 0xb0, 0xd4, 0xa5, 
-0x14, 0xa, 0x26, 0x22, 0xa, 0x26, 0x22, 0x65, 0x14, 0x85, 0x14, 0xa5, 0x22, 0x65, 0x15, 0x85, 
-0x15, 0x6, 0x14, 0x26, 0x15, 0xa5, 0x14, 0x65, 0x7, 0x85, 0x14, 0x90, 0x2, 0xe6, 0x15, 0x20, 
-0x73, 0x0, 0x4c, 0x71, 0xa9, 0x20, 0x8b, 0xb0, 0x85, 0x49, 0x84, 0x4a, 0xa9, 0xb2, 0x20, 0xff, 
-0xae, 0xa5, 0xe, 0x48, 0xa5, 0xd, 0x48, 0x20, 0x9e, 0xad, 0x68, 0x2a, 0x20, 0x90, 0xad, 0xd0, 
-0x18, 0x68, 0x10, 0x12, 0x20, 0x1b, 0xbc, 0x20, 0xbf, 0xb1, 0xa0, 0x0, 0xa5, 0x64, 0x91, 0x49, 
-0xc8, 0xa5, 0x65, 0x91, 0x49, 0x60, 0x4c, 0xd0, 0xbb, 0x68, 0xa4, 0x4a, 0xc0, 0xbf, 0xd0, 0x4c, 
-0x20, 0xa6, 0xb6, 0xc9, 0x6, 0xd0, 0x3d, 0xa0, 0x0, 0x84, 0x61, 0x84, 0x66, 0x84, 0x71, 0x20, 
-0x1d, 0xaa, 0x20, 0xe2, 0xba, 0xe6, 0x71, 0xa4, 0x71, 0x20, 0x1d, 0xaa, 0x20, 0xc, 0xbc, 0xaa, 
-0xf0, 0x5, 0xe8, 0x8a, 0x20, 0xed, 0xba, 0xa4, 0x71, 0xc8, 0xc0, 0x6, 0xd0, 0xdf, 0x20, 0xe2, 
-0xba, 0x20, 0x9b, 0xbc, 0xa6, 0x64, 0xa4, 0x63, 0xa5, 0x65, 0x4c, 0xdb, 0xff, 0xb1, 0x22, 0x20, 
-0x80, 0x0, 0x90, 0x3, 0x4c, 0x48, 0xb2, 0xe9, 0x2f, 0x4c, 0x7e, 0xbd, 0xa0, 0x2, 0xb1, 0x64, 
-0xc5, 0x34, 0x90, 0x17, 0xd0, 0x7, 0x88, 0xb1, 0x64, 0xc5, 0x33, 0x90, 0xe, 0xa4, 0x65, 0xc4, 
-0x2e, 0x90, 0x8, 0xd0, 0xd, 0xa5, 0x64, 0xc5, 0x2d, 0xb0, 0x7, 0xa5, 0x64, 0xa4, 0x65, 0x4c, 
-0x68, 0xaa, 0xa0, 0x0, 0xb1, 0x64, 0x20, 0x75, 0xb4, 0xa5, 0x50, 0xa4, 0x51, 0x85, 0x6f, 0x84, 
-0x70, 0x20, 0x7a, 0xb6, 0xa9, 0x61, 0xa0, 0x0, 0x85, 0x50, 0x84, 0x51, 0x20, 0xdb, 0xb6, 0xa0, 
-0x0, 0xb1, 0x50, 0x91, 0x49, 0xc8, 0xb1, 0x50, 0x91, 0x49, 0xc8, 0xb1, 0x50, 0x91, 0x49, 0x60, 
-0x20, 0x86, 0xaa, 0x4c, 0xb5, 0xab, 0x20, 0x9e, 0xb7, 0xf0, 0x5, 0xa9, 0x2c, 0x20, 0xff, 0xae, 
-0x8, 0x86, 0x13, 0x20, 0x18, 0xe1, 0x28, 0x4c, 0xa0, 0xaa, 0x20, 0x21, 0xab, 0x20, 0x79, 0x0, 
-0xf0, 0x35, 0xf0, 0x43, 0xc9, 0xa3, 0xf0, 0x50, 0xc9, 0xa6, 0x18, 0xf0, 0x4b, 0xc9, 0x2c, 0xf0, 
-0x37, 0xc9, 0x3b, 0xf0, 0x5e, 0x20, 0x9e, 0xad, 0x24, 0xd, 0x30, 0xde, 0x20, 0xdd, 0xbd, 0x20, 
-0x87, 0xb4, 0x20, 0x21, 0xab, 0x20, 0x3b, 0xab, 0xd0, 0xd3, 0xa9, 0x0, 0x9d, 0x0, 0x2, 0xa2, 
-0xff, 0xa0, 0x1, 0xa5, 0x13, 0xd0, 0x10, 0xa9, 0xd, 0x20, 0x47, 0xab, 0x24, 0x13, 0x10, 0x5, 
-0xa9, 0xa, 0x20, 0x47, 0xab, 0x49, 0xff, 0x60, 0x38, 0x20, 0xf0, 0xff, 0x98, 0x38, 0xe9, 0xa, 
-0xb0, 0xfc, 0x49, 0xff, 0x69, 0x1, 0xd0, 0x16, 0x8, 0x38, 0x20, 0xf0, 0xff, 0x84, 0x9, 0x20, 
-0x9b, 0xb7, 0xc9, 0x29, 0xd0, 0x59, 0x28, 0x90, 0x6, 0x8a, 0xe5, 0x9, 0x90, 0x5, 0xaa, 0xe8, 
-0xca, 0xd0, 0x6, 0x20, 0x73, 0x0, 0x4c, 0xa2, 0xaa, 0x20, 0x3b, 0xab, 0xd0, 0xf2, 0x20, 0x87, 
-0xb4, 0x20, 0xa6, 0xb6, 0xaa, 0xa0, 0x0, 0xe8, 0xca, 0xf0, 0xbc, 0xb1, 0x22, 0x20, 0x47, 0xab, 
-0xc8, 0xc9, 0xd, 0xd0, 0xf3, 0x20, 0xe5, 0xaa, 0x4c, 0x28, 0xab, 0xa5, 0x13, 0xf0, 0x3, 0xa9, 
-0x20, 0x2c, 0xa9, 0x1d, 0x2c, 0xa9, 0x3f, 0x20, 0xc, 0xe1, 0x29, 0xff, 0x60, 0xa5, 0x11, 0xf0, 
-0x11, 0x30, 0x4, 0xa0, 0xff, 0xd0, 0x4, 0xa5, 0x3f, 0xa4, 0x40, 0x85, 0x39, 0x84, 0x3a, 0x4c, 
-0x8, 0xaf, 0xa5, 0x13, 0xf0, 0x5, 0xa2, 0x18, 0x4c, 0x37, 0xa4, 0xa9, 0xc, 0xa0, 0xad, 0x20, 
-0x1e, 0xab, 0xa5, 0x3d, 0xa4, 0x3e, 0x85, 0x7a, 0x84, 0x7b, 0x60, 0x20, 0xa6, 0xb3, 0xc9, 0x23, 
-0xd0, 0x10, 0x20, 0x73, 0x0, 0x20, 0x9e, 0xb7, 0xa9, 0x2c, 0x20, 0xff, 0xae, 0x86, 0x13, 0x20, 
-0x1e, 0xe1, 0xa2, 0x1, 0xa0, 0x2, 0xa9, 0x0, 0x8d, 0x1, 0x2, 0xa9, 0x40, 0x20, 0xf, 0xac, 
-0xa6, 0x13, 0xd0, 0x13, 0x60, 0x20, 0x9e, 0xb7, 0xa9, 0x2c, 0x20, 0xff, 0xae, 0x86, 0x13, 0x20, 
-0x1e, 0xe1, 0x20, 0xce, 0xab, 0xa5, 0x13, 0x20, 0xcc, 0xff, 0xa2, 0x0, 0x86, 0x13, 0x60, 0xc9, 
-0x22, 0xd0, 0xb, 0x20, 0xbd, 0xae, 0xa9, 0x3b, 0x20, 0xff, 0xae, 0x20, 0x21, 0xab, 0x20, 0xa6, 
-0xb3, 0xa9, 0x2c, 0x8d, 0xff, 0x1, 0x20, 0xf9, 0xab, 0xa5, 0x13, 0xf0, 0xd, 0x20, 0xb7, 0xff, 
-0x29, 0x2, 0xf0, 0x6, 0x20, 0xb5, 0xab, 0x4c, 0xf8, 0xa8, 0xad, 0x0, 0x2, 0xd0, 0x1e, 0xa5, 
-0x13, 0xd0, 0xe3, 0x20, 0x6, 0xa9, 0x4c, 0xfb, 0xa8, 0xa5, 0x13, 0xd0, 0x6, 0x20, 0x45, 0xab, 
-0x20, 0x3b, 0xab, 0x4c, 0x60, 0xa5, 0xa6, 0x41, 0xa4, 0x42, 0xa9, 0x98, 0x2c, 0xa9, 0x0, 0x85, 
-0x11, 0x86, 0x43, 0x84, 0x44, 0x20, 0x8b, 0xb0, 0x85, 0x49, 0x84, 0x4a, 0xa5, 0x7a, 0xa4, 0x7b, 
-0x85, 0x4b, 0x84, 0x4c, 0xa6, 0x43, 0xa4, 0x44, 0x86, 0x7a, 0x84, 0x7b, 0x20, 0x79, 0x0, 0xd0, 
-0x20, 0x24, 0x11, 0x50, 0xc, 0x20, 0x24, 0xe1, 0x8d, 0x0, 0x2, 0xa2, 0xff, 0xa0, 0x1, 0xd0, 
-0xc, 0x30, 0x75, 0xa5, 0x13, 0xd0, 0x3, 0x20, 0x45, 0xab, 0x20, 0xf9, 0xab, 0x86, 0x7a, 0x84, 
-0x7b, 0x20, 0x73, 0x0, 0x24, 0xd, 0x10, 0x31, 0x24, 0x11, 0x50, 0x9, 0xe8, 0x86, 0x7a, 0xa9, 
-0x0, 0x85, 0x7, 0xf0, 0xc, 0x85, 0x7, 0xc9, 0x22, 0xf0, 0x7, 0xa9, 0x3a, 0x85, 0x7, 0xa9, 
-0x2c, 0x18, 0x85, 0x8, 0xa5, 0x7a, 0xa4, 0x7b, 0x69, 0x0, 0x90, 0x1, 0xc8, 0x20, 0x8d, 0xb4, 
-0x20, 0xe2, 0xb7, 0x20, 0xda, 0xa9, 0x4c, 0x91, 0xac, 0x20, 0xf3, 0xbc, 0xa5, 0xe, 0x20, 0xc2, 
-0xa9, 0x20, 0x79, 0x0, 0xf0, 0x7, 0xc9, 0x2c, 0xf0, 0x3, 0x4c, 0x4d, 0xab, 0xa5, 0x7a, 0xa4, 
-0x7b, 0x85, 0x43, 0x84, 0x44, 0xa5, 0x4b, 0xa4, 0x4c, 0x85, 0x7a, 0x84, 0x7b, 0x20, 0x79, 0x0, 
-0xf0, 0x2d, 0x20, 0xfd, 0xae, 0x4c, 0x15, 0xac, 0x20, 0x6, 0xa9, 0xc8, 0xaa, 0xd0, 0x12, 0xa2, 
-0xd, 0xc8, 0xb1, 0x7a, 0xf0, 0x6c, 0xc8, 0xb1, 0x7a, 0x85, 0x3f, 0xc8, 0xb1, 0x7a, 0xc8, 0x85, 
-0x40, 0x20, 0xfb, 0xa8, 0x20, 0x79, 0x0, 0xaa, 0xe0, 0x83, 0xd0, 0xdc, 0x4c, 0x51, 0xac, 0xa5, 
-0x43, 0xa4, 0x44, 0xa6, 0x11, 0x10, 0x3, 0x4c, 0x27, 0xa8, 0xa0, 0x0, 0xb1, 0x43, 0xf0, 0xb, 
-0xa5, 0x13, 0xd0, 0x7, 0xa9, 0xfc, 0xa0, 0xac, 0x4c, 0x1e, 0xab, 0x60, 0x3f, 0x45, 0x58, 0x54, 
-0x52, 0x41, 0x20, 0x49, 0x47, 0x4e, 0x4f, 0x52, 0x45, 0x44, 0xd, 0x0, 0x3f, 0x52, 0x45, 0x44, 
-0x4f, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x53, 0x54, 0x41, 0x52, 0x54, 0xd, 0x0, 0xd0, 0x4, 
-0xa0, 0x0, 0xf0, 0x3, 0x20, 0x8b, 0xb0, 0x85, 0x49, 0x84, 0x4a, 0x20, 0x8a, 0xa3, 0xf0, 0x5, 
-0xa2, 0xa, 0x4c, 0x37, 0xa4, 0x9a, 0x8a, 0x18, 0x69, 0x4, 0x48, 0x69, 0x6, 0x85, 0x24, 0x68, 
-0xa0, 0x1, 0x20, 0xa2, 0xbb, 0xba, 0xbd, 0x9, 0x1, 0x85, 0x66, 0xa5, 0x49, 0xa4, 0x4a, 0x20, 
-0x67, 0xb8, 0x20, 0xd0, 0xbb, 0xa0, 0x1, 0x20, 0x5d, 0xbc, 0xba, 0x38, 0xfd, 0x9, 0x1, 0xf0, 
-0x17, 0xbd, 0xf, 0x1, 0x85, 0x39, 0xbd, 0x10, 0x1, 0x85, 0x3a, 0xbd, 0x12, 0x1, 0x85, 0x7a, 
-0xbd, 0x11, 0x1, 0x85, 0x7b, 0x4c, 0xae, 0xa7, 0x8a, 0x69, 0x11, 0xaa, 0x9a, 0x20, 0x79, 0x0, 
-0xc9, 0x2c, 0xd0, 0xf1, 0x20, 0x73, 0x0, 0x20, 0x24, 0xad, 0x20, 0x9e, 0xad, 0x18, 0x24, 0x38, 
-0x24, 0xd, 0x30, 0x3, 0xb0, 0x3, 0x60, 0xb0, 0xfd, 0xa2, 0x16, 0x4c, 0x37, 0xa4, 0xa6, 0x7a, 
-0xd0, 0x2, 0xc6, 0x7b, 0xc6, 0x7a, 0xa2, 0x0, 0x24, 0x48, 0x8a, 0x48, 0xa9, 0x1, 0x20, 0xfb, 
-0xa3, 0x20, 0x83, 0xae, 0xa9, 0x0, 0x85, 0x4d, 0x20, 0x79, 0x0, 0x38, 0xe9, 0xb1, 0x90, 0x17, 
-0xc9, 0x3, 0xb0, 0x13, 0xc9, 0x1, 0x2a, 0x49, 0x1, 0x45, 0x4d, 0xc5, 0x4d, 0x90, 0x61, 0x85, 
-0x4d, 0x20, 0x73, 0x0, 0x4c, 0xbb, 0xad, 0xa6, 0x4d, 0xd0, 0x2c, 0xb0, 0x7b, 0x69, 0x7, 0x90, 
-0x77, 0x65, 0xd, 0xd0, 0x3, 0x4c, 0x3d, 0xb6, 0x69, 0xff, 0x85, 0x22, 0xa, 0x65, 0x22, 0xa8, 
-0x68, 0xd9, 0x80, 0xa0, 0xb0, 0x67, 0x20, 0x8d, 0xad, 0x48, 0x20, 0x20, 0xae, 0x68, 0xa4, 0x4b, 
-0x10, 0x17, 0xaa, 0xf0, 0x56, 0xd0, 0x5f, 0x46, 0xd, 0x8a, 0x2a, 0xa6, 0x7a, 0xd0, 0x2, 0xc6, 
-0x7b, 0xc6, 0x7a, 0xa0, 0x1b, 0x85, 0x4d, 0xd0, 0xd7, 0xd9, 0x80, 0xa0, 0xb0, 0x48, 0x90, 0xd9, 
-0xb9, 0x82, 0xa0, 0x48, 0xb9, 0x81, 0xa0, 0x48, 0x20, 0x33, 0xae, 0xa5, 0x4d, 0x4c, 0xa9, 0xad, 
-0x4c, 0x8, 0xaf, 0xa5, 0x66, 0xbe, 0x80, 0xa0, 0xa8, 0x68, 0x85, 0x22, 0xe6, 0x22, 0x68, 0x85, 
-0x23, 0x98, 0x48, 0x20, 0x1b, 0xbc, 0xa5, 0x65, 0x48, 0xa5, 0x64, 0x48, 0xa5, 0x63, 0x48, 0xa5, 
-0x62, 0x48, 0xa5, 0x61, 0x48, 0x6c, 0x22, 0x0, 0xa0, 0xff, 0x68, 0xf0, 0x23, 0xc9, 0x64, 0xf0, 
-0x3, 0x20, 0x8d, 0xad, 0x84, 0x4b, 0x68, 0x4a, 0x85, 0x12, 0x68, 0x85, 0x69, 0x68, 0x85, 0x6a, 
-0x68, 0x85, 0x6b, 0x68, 0x85, 0x6c, 0x68, 0x85, 0x6d, 0x68, 0x85, 0x6e, 0x45, 0x66, 0x85, 0x6f, 
-0xa5, 0x61, 0x60, 0x6c, 0xa, 0x3, 0xa9, 0x0, 0x85, 0xd, 0x20, 0x73, 0x0, 0xb0, 0x3, 0x4c, 
-0xf3, 0xbc, 0x20, 0x13, 0xb1, 0x90, 0x3, 0x4c, 0x28, 0xaf, 0xc9, 0xff, 0xd0, 0xf, 0xa9, 0xa8, 
-0xa0, 0xae, 0x20, 0xa2, 0xbb, 0x4c, 0x73, 0x0, 0x82, 0x49, 0xf, 0xda, 0xa1, 0xc9, 0x2e, 0xf0, 
-0xde, 0xc9, 0xab, 0xf0, 0x58, 0xc9, 0xaa, 0xf0, 0xd1, 0xc9, 0x22, 0xd0, 0xf, 0xa5, 0x7a, 0xa4, 
-0x7b, 0x69, 0x0, 0x90, 0x1, 0xc8, 0x20, 0x87, 0xb4, 0x4c, 0xe2, 0xb7, 0xc9, 0xa8, 0xd0, 0x13, 
-0xa0, 0x18, 0xd0, 0x3b, 0x20, 0xbf, 0xb1, 0xa5, 0x65, 0x49, 0xff, 0xa8, 0xa5, 0x64, 0x49, 0xff, 
-0x4c, 0x91, 0xb3, 0xc9, 0xa5, 0xd0, 0x3, 0x4c, 0xf4, 0xb3, 0xc9, 0xb4, 0x90, 0x3, 0x4c, 0xa7, 
-0xaf, 0x20, 0xfa, 0xae, 0x20, 0x9e, 0xad, 0xa9, 0x29, 0x2c, 0xa9, 0x28, 0x2c, 0xa9, 0x2c, 0xa0, 
-0x0, 0xd1, 0x7a, 0xd0, 0x3, 0x4c, 0x73, 0x0, 0xa2, 0xb, 0x4c, 0x37, 0xa4, 0xa0, 0x15, 0x68, 
-0x68, 0x4c, 0xfa, 0xad, 0x38, 0xa5, 0x64, 0xe9, 0x0, 0xa5, 0x65, 0xe9, 0xa0, 0x90, 0x8, 0xa9, 
-0xa2, 0xe5, 0x64, 0xa9, 0xe3, 0xe5, 0x65, 0x60, 0x20, 0x8b, 0xb0, 0x85, 0x64, 0x84, 0x65, 0xa6, 
-0x45, 0xa4, 0x46, 0xa5, 0xd, 0xf0, 0x26, 0xa9, 0x0, 0x85, 0x70, 0x20, 0x14, 0xaf, 0x90, 0x1c, 
-0xe0, 0x54, 0xd0, 0x18, 0xc0, 0xc9, 0xd0, 0x14, 0x20, 0x84, 0xaf, 0x84, 0x5e, 0x88, 0x84, 0x71, 
-0xa0, 0x6, 0x84, 0x5d, 0xa0, 0x24, 0x20, 0x68, 0xbe, 0x4c, 0x6f, 0xb4, 0x60, 0x24, 0xe, 0x10, 
-0xd, 0xa0, 0x0, 0xb1, 0x64, 0xaa, 0xc8, 0xb1, 0x64, 0xa8, 0x8a, 0x4c, 0x91, 0xb3, 0x20, 0x14, 
-0xaf, 0x90, 0x2d, 0xe0, 0x54, 0xd0, 0x1b, 0xc0, 0x49, 0xd0, 0x25, 0x20, 0x84, 0xaf, 0x98, 0xa2, 
-0xa0, 0x4c, 0x4f, 0xbc, 0x20, 0xde, 0xff, 0x86, 0x64, 0x84, 0x63, 0x85, 0x65, 0xa0, 0x0, 0x84, 
-0x62, 0x60, 0xe0, 0x53, 0xd0, 0xa, 0xc0, 0x54, 0xd0, 0x6, 0x20, 0xb7, 0xff, 0x4c, 0x3c, 0xbc, 
-0xa5, 0x64, 0xa4, 0x65, 0x4c, 0xa2, 0xbb, 0xa, 0x48, 0xaa, 0x20, 0x73, 0x0, 0xe0, 0x8f, 0x90, 
-0x20, 0x20, 0xfa, 0xae, 0x20, 0x9e, 0xad, 0x20, 0xfd, 0xae, 0x20, 0x8f, 0xad, 0x68, 0xaa, 0xa5, 
-0x65, 0x48, 0xa5, 0x64, 0x48, 0x8a, 0x48, 0x20, 0x9e, 0xb7, 0x68, 0xa8, 0x8a, 0x48, 0x4c, 0xd6, 
-0xaf, 0x20, 0xf1, 0xae, 0x68, 0xa8, 0xb9, 0xea, 0x9f, 0x85, 0x55, 0xb9, 0xeb, 0x9f, 0x85, 0x56, 
-0x20, 0x54, 0x0, 0x4c, 0x8d, 0xad, 0xa0, 0xff, 0x2c, 0xa0, 0x0, 0x84, 0xb, 0x20, 0xbf, 0xb1, 
-0xa5, 0x64, 0x45, 0xb, 0x85, 0x7, 0xa5, 0x65, 0x45, 0xb, 0x85, 0x8, 0x20, 0xfc, 0xbb, 0x20, 
-0xbf, 0xb1, 0xa5, 0x65, 0x45, 0xb, 0x25, 0x8, 0x45, 0xb, 0xa8, 0xa5, 0x64, 0x45, 0xb, 0x25, 
-0x7, 0x45, 0xb, 0x4c, 0x91, 0xb3, 0x20, 0x90, 0xad, 0xb0, 0x13, 0xa5, 0x6e, 0x9, 0x7f, 0x25, 
-0x6a, 0x85, 0x6a, 0xa9, 0x69, 0xa0, 0x0, 0x20, 0x5b, 0xbc, 0xaa, 0x4c, 0x61, 0xb0, 0xa9, 0x0, 
-0x85, 0xd, 0xc6, 0x4d, 0x20, 0xa6, 0xb6, 0x85, 0x61, 0x86, 0x62, 0x84, 0x63, 0xa5, 0x6c, 0xa4, 
-0x6d, 0x20, 0xaa, 0xb6, 0x86, 0x6c, 0x84, 0x6d, 0xaa, 0x38, 0xe5, 0x61, 0xf0, 0x8, 0xa9, 0x1, 
-0x90, 0x4, 0xa6, 0x61, 0xa9, 0xff, 0x85, 0x66, 0xa0, 0xff, 0xe8, 0xc8, 0xca, 0xd0, 0x7, 0xa6, 
-0x66, 0x30, 0xf, 0x18, 0x90, 0xc, 0xb1, 0x6c, 0xd1, 0x62, 0xf0, 0xef, 0xa2, 0xff, 0xb0, 0x2, 
-0xa2, 0x1, 0xe8, 0x8a, 0x2a, 0x25, 0x12, 0xf0, 0x2, 0xa9, 0xff, 0x4c, 0x3c, 0xbc, 0x20, 0xfd, 
-0xae, 0xaa, 0x20, 0x90, 0xb0, 0x20, 0x79, 0x0, 0xd0, 0xf4, 0x60, 0xa2, 0x0, 0x20, 0x79, 0x0, 
-0x86, 0xc, 0x85, 0x45, 0x20, 0x79, 0x0, 0x20, 0x13, 0xb1, 0xb0, 0x3, 0x4c, 0x8, 0xaf, 0xa2, 
-0x0, 0x86, 0xd, 0x86, 0xe, 0x20, 0x73, 0x0, 0x90, 0x5, 0x20, 0x13, 0xb1, 0x90, 0xb, 0xaa, 
-0x20, 0x73, 0x0, 0x90, 0xfb, 0x20, 0x13, 0xb1, 0xb0, 0xf6, 0xc9, 0x24, 0xd0, 0x6, 0xa9, 0xff, 
-0x85, 0xd, 0xd0, 0x10, 0xc9, 0x25, 0xd0, 0x13, 0xa5, 0x10, 0xd0, 0xd0, 0xa9, 0x80, 0x85, 0xe, 
-0x5, 0x45, 0x85, 0x45, 0x8a, 0x9, 0x80, 0xaa, 0x20, 0x73, 0x0, 0x86, 0x46, 0x38, 0x5, 0x10, 
-0xe9, 0x28, 0xd0, 0x3, 0x4c, 0xd1, 0xb1, 0xa0, 0x0, 0x84, 0x10, 0xa5, 0x2d, 0xa6, 0x2e, 0x86, 
-0x60, 0x85, 0x5f, 0xe4, 0x30, 0xd0, 0x4, 0xc5, 0x2f, 0xf0, 0x22, 0xa5, 0x45, 0xd1, 0x5f, 0xd0, 
-0x8, 0xa5, 0x46, 0xc8, 0xd1, 0x5f, 0xf0, 0x7d, 0x88, 0x18, 0xa5, 0x5f, 0x69, 0x7, 0x90, 0xe1, 
-0xe8, 0xd0, 0xdc, 0xc9, 0x41, 0x90, 0x5, 0xe9, 0x5b, 0x38, 0xe9, 0xa5, 0x60, 0x68, 0x48, 0xc9, 
-0x2a, 0xd0, 0x5, 0xa9, 0x13, 0xa0, 0xbf, 0x60, 0xa5, 0x45, 0xa4, 0x46, 0xc9, 0x54, 0xd0, 0xb, 
-0xc0, 0xc9, 0xf0, 0xef, 0xc0, 0x49, 0xd0, 0x3, 0x4c, 0x8, 0xaf, 0xc9, 0x53, 0xd0, 0x4, 0xc0, 
-0x54, 0xf0, 0xf5, 0xa5, 0x2f, 0xa4, 0x30, 0x85, 0x5f, 0x84, 0x60, 0xa5, 0x31, 0xa4, 0x32, 0x85, 
-0x5a, 0x84, 0x5b, 0x18, 0x69, 0x7, 0x90, 0x1, 0xc8, 0x85, 0x58, 0x84, 0x59, 0x20, 0xb8, 0xa3, 
-0xa5, 0x58, 0xa4, 0x59, 0xc8, 0x85, 0x2f, 0x84, 0x30, 0xa0, 0x0, 0xa5, 0x45, 0x91, 0x5f, 0xc8, 
-0xa5, 0x46, 0x91, 0x5f, 0xa9, 0x0, 0xc8, 0x91, 0x5f, 0xc8, 0x91, 0x5f, 0xc8, 0x91, 0x5f, 0xc8, 
-0x91, 0x5f, 0xc8, 0x91, 0x5f, 0xa5, 0x5f, 0x18, 0x69, 0x2, 0xa4, 0x60, 0x90, 0x1, 0xc8, 0x85, 
-0x47, 0x84, 0x48, 0x60, 0xa5, 0xb, 0xa, 0x69, 0x5, 0x65, 0x5f, 0xa4, 0x60, 0x90, 0x1, 0xc8, 
-0x85, 0x58, 0x84, 0x59, 0x60, 0x90, 0x80, 0x0, 0x0, 0x0, 0x20, 0xbf, 0xb1, 0xa5, 0x64, 0xa4, 
-0x65, 0x60, 0x20, 0x73, 0x0, 0x20, 0x9e, 0xad, 0x20, 0x8d, 0xad, 0xa5, 0x66, 0x30, 0xd, 0xa5, 
-0x61, 0xc9, 0x90, 0x90, 0x9, 0xa9, 0xa5, 0xa0, 0xb1, 0x20, 0x5b, 0xbc, 0xd0, 0x7a, 0x4c, 0x9b, 
-0xbc, 0xa5, 0xc, 0x5, 0xe, 0x48, 0xa5, 0xd, 0x48, 0xa0, 0x0, 0x98, 0x48, 0xa5, 0x46, 0x48, 
-0xa5, 0x45, 0x48, 0x20, 0xb2, 0xb1, 0x68, 0x85, 0x45, 0x68, 0x85, 0x46, 0x68, 0xa8, 0xba, 0xbd, 
-0x2, 0x1, 0x48, 0xbd, 0x1, 0x1, 0x48, 0xa5, 0x64, 0x9d, 0x2, 0x1, 0xa5, 0x65, 0x9d, 0x1, 
-0x1, 0xc8, 0x20, 0x79, 0x0, 0xc9, 0x2c, 0xf0, 0xd2, 0x84, 0xb, 0x20, 0xf7, 0xae, 0x68, 0x85, 
-0xd, 0x68, 0x85, 0xe, 0x29, 0x7f, 0x85, 0xc, 0xa6, 0x2f, 0xa5, 0x30, 0x86, 0x5f, 0x85, 0x60, 
-0xc5, 0x32, 0xd0, 0x4, 0xe4, 0x31, 0xf0, 0x39, 0xa0, 0x0, 0xb1, 0x5f, 0xc8, 0xc5, 0x45, 0xd0, 
-0x6, 0xa5, 0x46, 0xd1, 0x5f, 0xf0, 0x16, 0xc8, 0xb1, 0x5f, 0x18, 0x65, 0x5f, 0xaa, 0xc8, 0xb1, 
-0x5f, 0x65, 0x60, 0x90, 0xd7, 0xa2, 0x12, 0x2c, 0xa2, 0xe, 0x4c, 0x37, 0xa4, 0xa2, 0x13, 0xa5, 
-0xc, 0xd0, 0xf7, 0x20, 0x94, 0xb1, 0xa5, 0xb, 0xa0, 0x4, 0xd1, 0x5f, 0xd0, 0xe7, 0x4c, 0xea, 
-0xb2, 0x20, 0x94, 0xb1, 0x20, 0x8, 0xa4, 0xa0, 0x0, 0x84, 0x72, 0xa2, 0x5, 0xa5, 0x45, 0x91, 
-0x5f, 0x10, 0x1, 0xca, 0xc8, 0xa5, 0x46, 0x91, 0x5f, 0x10, 0x2, 0xca, 0xca, 0x86, 0x71, 0xa5, 
-0xb, 0xc8, 0xc8, 0xc8, 0x91, 0x5f, 0xa2, 0xb, 0xa9, 0x0, 0x24, 0xc, 0x50, 0x8, 0x68, 0x18, 
-0x69, 0x1, 0xaa, 0x68, 0x69, 0x0, 0xc8, 0x91, 0x5f, 0xc8, 0x8a, 0x91, 0x5f, 0x20, 0x4c, 0xb3, 
-0x86, 0x71, 0x85, 0x72, 0xa4, 0x22, 0xc6, 0xb, 0xd0, 0xdc, 0x65, 0x59, 0xb0, 0x5d, 0x85, 0x59, 
-0xa8, 0x8a, 0x65, 0x58, 0x90, 0x3, 0xc8, 0xf0, 0x52, 0x20, 0x8, 0xa4, 0x85, 0x31, 0x84, 0x32, 
-0xa9, 0x0, 0xe6, 0x72, 0xa4, 0x71, 0xf0, 0x5, 0x88, 0x91, 0x58, 0xd0, 0xfb, 0xc6, 0x59, 0xc6, 
-0x72, 0xd0, 0xf5, 0xe6, 0x59, 0x38, 0xa5, 0x31, 0xe5, 0x5f, 0xa0, 0x2, 0x91, 0x5f, 0xa5, 0x32, 
-0xc8, 0xe5, 0x60, 0x91, 0x5f, 0xa5, 0xc, 0xd0, 0x62, 0xc8, 0xb1, 0x5f, 0x85, 0xb, 0xa9, 0x0, 
-0x85, 0x71, 0x85, 0x72, 0xc8, 0x68, 0xaa, 0x85, 0x64, 0x68, 0x85, 0x65, 0xd1, 0x5f, 0x90, 0xe, 
-0xd0, 0x6, 0xc8, 0x8a, 0xd1, 0x5f, 0x90, 0x7, 0x4c, 0x45, 0xb2, 0x4c, 0x35, 0xa4, 0xc8, 0xa5, 
-0x72, 0x5, 0x71, 0x18, 0xf0, 0xa, 0x20, 0x4c, 0xb3, 0x8a, 0x65, 0x64, 0xaa, 0x98, 0xa4, 0x22, 
-0x65, 0x65, 0x86, 0x71, 0xc6, 0xb, 0xd0, 0xca, 0x85, 0x72, 0xa2, 0x5, 0xa5, 0x45, 0x10, 0x1, 
-0xca, 0xa5, 0x46, 0x10, 0x2, 0xca, 0xca, 0x86, 0x28, 0xa9, 0x0, 0x20, 0x55, 0xb3, 0x8a, 0x65, 
-0x58, 0x85, 0x47, 0x98, 0x65, 0x59, 0x85, 0x48, 0xa8, 0xa5, 0x47, 0x60, 0x84, 0x22, 0xb1, 0x5f, 
-0x85, 0x28, 0x88, 0xb1, 0x5f, 0x85, 0x29, 0xa9, 0x10, 0x85, 0x5d, 0xa2, 0x0, 0xa0, 0x0, 0x8a, 
-0xa, 0xaa, 0x98, 0x2a, 0xa8, 0xb0, 0xa4, 0x6, 0x71, 0x26, 0x72, 0x90, 0xb, 0x18, 0x8a, 0x65, 
-0x28, 0xaa, 0x98, 0x65, 0x29, 0xa8, 0xb0, 0x93, 0xc6, 0x5d, 0xd0, 0xe3, 0x60, 0xa5, 0xd, 0xf0, 
-0x3, 0x20, 0xa6, 0xb6, 0x20, 0x26, 0xb5, 0x38, 0xa5, 0x33, 0xe5, 0x31, 0xa8, 0xa5, 0x34, 0xe5, 
-0x32, 0xa2, 0x0, 0x86, 0xd, 0x85, 0x62, 0x84, 0x63, 0xa2, 0x90, 0x4c, 0x44, 0xbc, 0x38, 0x20, 
-0xf0, 0xff, 0xa9, 0x0, 0xf0, 0xeb, 0xa6, 0x3a, 0xe8, 0xd0, 0xa0, 0xa2, 0x15, 0x2c, 0xa2, 0x1b, 
-0x4c, 0x37, 0xa4, 0x20, 0xe1, 0xb3, 0x20, 0xa6, 0xb3, 0x20, 0xfa, 0xae, 0xa9, 0x80, 0x85, 0x10, 
-0x20, 0x8b, 0xb0, 0x20, 0x8d, 0xad, 0x20, 0xf7, 0xae, 0xa9, 0xb2, 0x20, 0xff, 0xae, 0x48, 0xa5, 
-0x48, 0x48, 0xa5, 0x47, 0x48, 0xa5, 0x7b, 0x48, 0xa5, 0x7a, 0x48, 0x20, 0xf8, 0xa8, 0x4c, 0x4f, 
-0xb4, 0xa9, 0xa5, 0x20, 0xff, 0xae, 0x9, 0x80, 0x85, 0x10, 0x20, 0x92, 0xb0, 0x85, 0x4e, 0x84, 
-0x4f, 0x4c, 0x8d, 0xad, 0x20, 0xe1, 0xb3, 0xa5, 0x4f, 0x48, 0xa5, 0x4e, 0x48, 0x20, 0xf1, 0xae, 
-0x20, 0x8d, 0xad, 0x68, 0x85, 0x4e, 0x68, 0x85, 0x4f, 0xa0, 0x2, 0xb1, 0x4e, 0x85, 0x47, 0xaa, 
-0xc8, 0xb1, 0x4e, 0xf0, 0x99, 0x85, 0x48, 0xc8, 0xb1, 0x47, 0x48, 0x88, 0x10, 0xfa, 0xa4, 0x48, 
-0x20, 0xd4, 0xbb, 0xa5, 0x7b, 0x48, 0xa5, 0x7a, 0x48, 0xb1, 0x4e, 0x85, 0x7a, 0xc8, 0xb1, 0x4e, 
-0x85, 0x7b, 0xa5, 0x48, 0x48, 0xa5, 0x47, 0x48, 0x20, 0x8a, 0xad, 0x68, 0x85, 0x4e, 0x68, 0x85, 
-0x4f, 0x20, 0x79, 0x0, 0xf0, 0x3, 0x4c, 0x8, 0xaf, 0x68, 0x85, 0x7a, 0x68, 0x85, 0x7b, 0xa0, 
-0x0, 0x68, 0x91, 0x4e, 0x68, 0xc8, 0x91, 0x4e, 0x68, 0xc8, 0x91, 0x4e, 0x68, 0xc8, 0x91, 0x4e, 
-0x68, 0xc8, 0x91, 0x4e, 0x60, 0x20, 0x8d, 0xad, 0xa0, 0x0, 0x20, 0xdf, 0xbd, 0x68, 0x68, 0xa9, 
-0xff, 0xa0, 0x0, 0xf0, 0x12, 0xa6, 0x64, 0xa4, 0x65, 0x86, 0x50, 0x84, 0x51, 0x20, 0xf4, 0xb4, 
-0x86, 0x62, 0x84, 0x63, 0x85, 0x61, 0x60, 0xa2, 0x22, 0x86, 0x7, 0x86, 0x8, 0x85, 0x6f, 0x84, 
-0x70, 0x85, 0x62, 0x84, 0x63, 0xa0, 0xff, 0xc8, 0xb1, 0x6f, 0xf0, 0xc, 0xc5, 0x7, 0xf0, 0x4, 
-0xc5, 0x8, 0xd0, 0xf3, 0xc9, 0x22, 0xf0, 0x1, 0x18, 0x84, 0x61, 0x98, 0x65, 0x6f, 0x85, 0x71, 
-0xa6, 0x70, 0x90, 0x1, 0xe8, 0x86, 0x72, 0xa5, 0x70, 0xf0, 0x4, 0xc9, 0x2, 0xd0, 0xb, 0x98, 
-0x20, 0x75, 0xb4, 0xa6, 0x6f, 0xa4, 0x70, 0x20, 0x88, 0xb6, 0xa6, 0x16, 0xe0, 0x22, 0xd0, 0x5, 
-0xa2, 0x19, 0x4c, 0x37, 0xa4, 0xa5, 0x61, 0x95, 0x0, 0xa5, 0x62, 0x95, 0x1, 0xa5, 0x63, 0x95, 
-0x2, 0xa0, 0x0, 0x86, 0x64, 0x84, 0x65, 0x84, 0x70, 0x88, 0x84, 0xd, 0x86, 0x17, 0xe8, 0xe8, 
-0xe8, 0x86, 0x16, 0x60, 0x46, 0xf, 0x48, 0x49, 0xff, 0x38, 0x65, 0x33, 0xa4, 0x34, 0xb0, 0x1, 
-0x88, 0xc4, 0x32, 0x90, 0x11, 0xd0, 0x4, 0xc5, 0x31, 0x90, 0xb, 0x85, 0x33, 0x84, 0x34, 0x85, 
-0x35, 0x84, 0x36, 0xaa, 0x68, 0x60, 0xa2, 0x10, 0xa5, 0xf, 0x30, 0xb6, 0x20, 0x26, 0xb5, 0xa9, 
-0x80, 0x85, 0xf, 0x68, 0xd0, 0xd0, 0xa6, 0x37, 0xa5, 0x38, 0x86, 0x33, 0x85, 0x34, 0xa0, 0x0, 
-0x84, 0x4f, 0x84, 0x4e, 0xa5, 0x31, 0xa6, 0x32, 0x85, 0x5f, 0x86, 0x60, 0xa9, 0x19, 0xa2, 0x0, 
-0x85, 0x22, 0x86, 0x23, 0xc5, 0x16, 0xf0, 0x5, 0x20, 0xc7, 0xb5, 0xf0, 0xf7, 0xa9, 0x7, 0x85, 
-0x53, 0xa5, 0x2d, 0xa6, 0x2e, 0x85, 0x22, 0x86, 0x23, 0xe4, 0x30, 0xd0, 0x4, 0xc5, 0x2f, 0xf0, 
-0x5, 0x20, 0xbd, 0xb5, 0xf0, 0xf3, 0x85, 0x58, 0x86, 0x59, 0xa9, 0x3, 0x85, 0x53, 0xa5, 0x58, 
-0xa6, 0x59, 0xe4, 0x32, 0xd0, 0x7, 0xc5, 0x31, 0xd0, 0x3, 0x4c, 0x6, 0xb6, 0x85, 0x22, 0x86, 
-0x23, 0xa0, 0x0, 0xb1, 0x22, 0xaa, 0xc8, 0xb1, 0x22, 0x8, 0xc8, 0xb1, 0x22, 0x65, 0x58, 0x85, 
-0x58, 0xc8, 0xb1, 0x22, 0x65, 0x59, 0x85, 0x59, 0x28, 0x10, 0xd3, 0x8a, 0x30, 0xd0, 0xc8, 0xb1, 
-0x22, 0xa0, 0x0, 0xa, 0x69, 0x5, 0x65, 0x22, 0x85, 0x22, 0x90, 0x2, 0xe6, 0x23, 0xa6, 0x23, 
-0xe4, 0x59, 0xd0, 0x4, 0xc5, 0x58, 0xf0, 0xba, 0x20, 0xc7, 0xb5, 0xf0, 0xf3, 0xb1, 0x22, 0x30, 
-0x35, 0xc8, 0xb1, 0x22, 0x10, 0x30, 0xc8, 0xb1, 0x22, 0xf0, 0x2b, 0xc8, 0xb1, 0x22, 0xaa, 0xc8, 
-0xb1, 0x22, 0xc5, 0x34, 0x90, 0x6, 0xd0, 0x1e, 0xe4, 0x33, 0xb0, 0x1a, 0xc5, 0x60, 0x90, 0x16, 
-0xd0, 0x4, 0xe4, 0x5f, 0x90, 0x10, 0x86, 0x5f, 0x85, 0x60, 0xa5, 0x22, 0xa6, 0x23, 0x85, 0x4e, 
-0x86, 0x4f, 0xa5, 0x53, 0x85, 0x55, 0xa5, 0x53, 0x18, 0x65, 0x22, 0x85, 0x22, 0x90, 0x2, 0xe6, 
-0x23, 0xa6, 0x23, 0xa0, 0x0, 0x60, 0xa5, 0x4f, 0x5, 0x4e, 0xf0, 0xf5, 0xa5, 0x55, 0x29, 0x4, 
-0x4a, 0xa8, 0x85, 0x55, 0xb1, 0x4e, 0x65, 0x5f, 0x85, 0x5a, 0xa5, 0x60, 0x69, 0x0, 0x85, 0x5b, 
-0xa5, 0x33, 0xa6, 0x34, 0x85, 0x58, 0x86, 0x59, 0x20, 0xbf, 0xa3, 0xa4, 0x55, 0xc8, 0xa5, 0x58, 
-0x91, 0x4e, 0xaa, 0xe6, 0x59, 0xa5, 0x59, 0xc8, 0x91, 0x4e, 0x4c, 0x2a, 0xb5, 0xa5, 0x65, 0x48, 
-0xa5, 0x64, 0x48, 0x20, 0x83, 0xae, 0x20, 0x8f, 0xad, 0x68, 0x85, 0x6f, 0x68, 0x85, 0x70, 0xa0, 
-0x0, 0xb1, 0x6f, 0x18, 0x71, 0x64, 0x90, 0x5, 0xa2, 0x17, 0x4c, 0x37, 0xa4, 0x20, 0x75, 0xb4, 
-0x20, 0x7a, 0xb6, 0xa5, 0x50, 0xa4, 0x51, 0x20, 0xaa, 0xb6, 0x20, 0x8c, 0xb6, 0xa5, 0x6f, 0xa4, 
-0x70, 0x20, 0xaa, 0xb6, 0x20, 0xca, 0xb4, 0x4c, 0xb8, 0xad, 0xa0, 0x0, 0xb1, 0x6f, 0x48, 0xc8, 
-0xb1, 0x6f, 0xaa, 0xc8, 0xb1, 0x6f, 0xa8, 0x68, 0x86, 0x22, 0x84, 0x23, 0xa8, 0xf0, 0xa, 0x48, 
-0x88, 0xb1, 0x22, 0x91, 0x35, 0x98, 0xd0, 0xf8, 0x68, 0x18, 0x65, 0x35, 0x85, 0x35, 0x90, 0x2, 
-0xe6, 0x36, 0x60, 0x20, 0x8f, 0xad, 0xa5, 0x64, 0xa4, 0x65, 0x85, 0x22, 0x84, 0x23, 0x20, 0xdb, 
-0xb6, 0x8, 0xa0, 0x0, 0xb1, 0x22, 0x48, 0xc8, 0xb1, 0x22, 0xaa, 0xc8, 0xb1, 0x22, 0xa8, 0x68, 
-0x28, 0xd0, 0x13, 0xc4, 0x34, 0xd0, 0xf, 0xe4, 0x33, 0xd0, 0xb, 0x48, 0x18, 0x65, 0x33, 0x85, 
-0x33, 0x90, 0x2, 0xe6, 0x34, 0x68, 0x86, 0x22, 0x84, 0x23, 0x60, 0xc4, 0x18, 0xd0, 0xc, 0xc5, 
-0x17, 0xd0, 0x8, 0x85, 0x16, 0xe9, 0x3, 0x85, 0x17, 0xa0, 0x0, 0x60, 0x20, 0xa1, 0xb7, 0x8a, 
-0x48, 0xa9, 0x1, 0x20, 0x7d, 0xb4, 0x68, 0xa0, 0x0, 0x91, 0x62, 0x68, 0x68, 0x4c, 0xca, 0xb4, 
-0x20, 0x61, 0xb7, 0xd1, 0x50, 0x98, 0x90, 0x4, 0xb1, 0x50, 0xaa, 0x98, 0x48, 0x8a, 0x48, 0x20, 
-0x7d, 0xb4, 0xa5, 0x50, 0xa4, 0x51, 0x20, 0xaa, 0xb6, 0x68, 0xa8, 0x68, 0x18, 0x65, 0x22, 0x85, 
-0x22, 0x90, 0x2, 0xe6, 0x23, 0x98, 0x20, 0x8c, 0xb6, 0x4c, 0xca, 0xb4, 0x20, 0x61, 0xb7, 0x18, 
-0xf1, 0x50, 0x49, 0xff, 0x4c, 0x6, 0xb7, 0xa9, 0xff, 0x85, 0x65, 0x20, 0x79, 0x0, 0xc9, 0x29, 
-0xf0, 0x6, 0x20, 0xfd, 0xae, 0x20, 0x9e, 0xb7, 0x20, 0x61, 0xb7, 0xf0, 0x4b, 0xca, 0x8a, 0x48, 
-0x18, 0xa2, 0x0, 0xf1, 0x50, 0xb0, 0xb6, 0x49, 0xff, 0xc5, 0x65, 0x90, 0xb1, 0xa5, 0x65, 0xb0, 
-0xad, 0x20, 0xf7, 0xae, 0x68, 0xa8, 0x68, 0x85, 0x55, 0x68, 0x68, 0x68, 0xaa, 0x68, 0x85, 0x50, 
-0x68, 0x85, 0x51, 0xa5, 0x55, 0x48, 0x98, 0x48, 0xa0, 0x0, 0x8a, 0x60, 0x20, 0x82, 0xb7, 0x4c, 
-0xa2, 0xb3, 0x20, 0xa3, 0xb6, 0xa2, 0x0, 0x86, 0xd, 0xa8, 0x60, 0x20, 0x82, 0xb7, 0xf0, 0x8, 
-0xa0, 0x0, 0xb1, 0x22, 0xa8, 0x4c, 0xa2, 0xb3, 0x4c, 0x48, 0xb2, 0x20, 0x73, 0x0, 0x20, 0x8a, 
-0xad, 0x20, 0xb8, 0xb1, 0xa6, 0x64, 0xd0, 0xf0, 0xa6, 0x65, 0x4c, 0x79, 0x0, 0x20, 0x82, 0xb7, 
-0xd0, 0x3, 0x4c, 0xf7, 0xb8, 0xa6, 0x7a, 0xa4, 0x7b, 0x86, 0x71, 0x84, 0x72, 0xa6, 0x22, 0x86, 
-0x7a, 0x18, 0x65, 0x22, 0x85, 0x24, 0xa6, 0x23, 0x86, 0x7b, 0x90, 0x1, 0xe8, 0x86, 0x25, 0xa0, 
-0x0, 0xb1, 0x24, 0x48, 0x98, 0x91, 0x24, 0x20, 0x79, 0x0, 0x20, 0xf3, 0xbc, 0x68, 0xa0, 0x0, 
-0x91, 0x24, 0xa6, 0x71, 0xa4, 0x72, 0x86, 0x7a, 0x84, 0x7b, 0x60, 0x20, 0x8a, 0xad, 0x20, 0xf7, 
-0xb7, 0x20, 0xfd, 0xae, 0x4c, 0x9e, 0xb7, 0xa5, 0x66, 0x30, 0x9d, 0xa5, 0x61, 0xc9, 0x91, 0xb0, 
-0x97, 0x20, 0x9b, 0xbc, 0xa5, 0x64, 0xa4, 0x65, 0x84, 0x14, 0x85, 0x15, 0x60, 0xa5, 0x15, 0x48, 
-0xa5, 0x14, 0x48, 0x20, 0xf7, 0xb7, 0xa0, 0x0, 0xb1, 0x14, 0xa8, 0x68, 0x85, 0x14, 0x68, 0x85, 
-0x15, 0x4c, 0xa2, 0xb3, 0x20, 0xeb, 0xb7, 0x8a, 0xa0, 0x0, 0x91, 0x14, 0x60, 0x20, 0xeb, 0xb7, 
-0x86, 0x49, 0xa2, 0x0, 0x20, 0x79, 0x0, 0xf0, 0x3, 0x20, 0xf1, 0xb7, 0x86, 0x4a, 0xa0, 0x0, 
-0xb1, 0x14, 0x45, 0x4a, 0x25, 0x49, 0xf0, 0xf8, 0x60, 0xa9, 0x11, 0xa0, 0xbf, 0x4c, 0x67, 0xb8, 
-0x20, 0x8c, 0xba, 0xa5, 0x66, 0x49, 0xff, 0x85, 0x66, 0x45, 0x6e, 0x85, 0x6f, 0xa5, 0x61, 0x4c, 
-0x6a, 0xb8, 0x20, 0x99, 0xb9, 0x90, 0x3c, 0x20, 0x8c, 0xba, 0xd0, 0x3, 0x4c, 0xfc, 0xbb, 0xa6, 
-0x70, 0x86, 0x56, 0xa2, 0x69, 0xa5, 0x69, 0xa8, 0xf0, 0xce, 0x38, 0xe5, 0x61, 0xf0, 0x24, 0x90, 
-0x12, 0x84, 0x61, 0xa4, 0x6e, 0x84, 0x66, 0x49, 0xff, 0x69, 0x0, 0xa0, 0x0, 0x84, 0x56, 0xa2, 
-0x61, 0xd0, 0x4, 0xa0, 0x0, 0x84, 0x70, 0xc9, 0xf9, 0x30, 0xc7, 0xa8, 0xa5, 0x70, 0x56, 0x1, 
-0x20, 0xb0, 0xb9, 0x24, 0x6f, 0x10, 0x57, 0xa0, 0x61, 0xe0, 0x69, 0xf0, 0x2, 0xa0, 0x69, 0x38, 
-0x49, 0xff, 0x65, 0x56, 0x85, 0x70, 0xb9, 0x4, 0x0, 0xf5, 0x4, 0x85, 0x65, 0xb9, 0x3, 0x0, 
-0xf5, 0x3, 0x85, 0x64, 0xb9, 0x2, 0x0, 0xf5, 0x2, 0x85, 0x63, 0xb9, 0x1, 0x0, 0xf5, 0x1, 
-0x85, 0x62, 0xb0, 0x3, 0x20, 0x47, 0xb9, 0xa0, 0x0, 0x98, 0x18, 0xa6, 0x62, 0xd0, 0x4a, 0xa6, 
-0x63, 0x86, 0x62, 0xa6, 0x64, 0x86, 0x63, 0xa6, 0x65, 0x86, 0x64, 0xa6, 0x70, 0x86, 0x65, 0x84, 
-0x70, 0x69, 0x8, 0xc9, 0x20, 0xd0, 0xe4, 0xa9, 0x0, 0x85, 0x61, 0x85, 0x66, 0x60, 0x65, 0x56, 
-0x85, 0x70, 0xa5, 0x65, 0x65, 0x6d, 0x85, 0x65, 0xa5, 0x64, 0x65, 0x6c, 0x85, 0x64, 0xa5, 0x63, 
-0x65, 0x6b, 0x85, 0x63, 0xa5, 0x62, 0x65, 0x6a, 0x85, 0x62, 0x4c, 0x36, 0xb9, 0x69, 0x1, 0x6, 
-0x70, 0x26, 0x65, 0x26, 0x64, 0x26, 0x63, 0x26, 0x62, 0x10, 0xf2, 0x38, 0xe5, 0x61, 0xb0, 0xc7, 
-0x49, 0xff, 0x69, 0x1, 0x85, 0x61, 0x90, 0xe, 0xe6, 0x61, 0xf0, 0x42, 0x66, 0x62, 0x66, 0x63, 
-0x66, 0x64, 0x66, 0x65, 0x66, 0x70, 0x60, 0xa5, 0x66, 0x49, 0xff, 0x85, 0x66, 0xa5, 0x62, 0x49, 
-0xff, 0x85, 0x62, 0xa5, 0x63, 0x49, 0xff, 0x85, 0x63, 0xa5, 0x64, 0x49, 0xff, 0x85, 0x64, 0xa5, 
-0x65, 0x49, 0xff, 0x85, 0x65, 0xa5, 0x70, 0x49, 0xff, 0x85, 0x70, 0xe6, 0x70, 0xd0, 0xe, 0xe6, 
-0x65, 0xd0, 0xa, 0xe6, 0x64, 0xd0, 0x6, 0xe6, 0x63, 0xd0, 0x2, 0xe6, 0x62, 0x60, 0xa2, 0xf, 
-0x4c, 0x37, 0xa4, 0xa2, 0x25, 0xb4, 0x4, 0x84, 0x70, 0xb4, 0x3, 0x94, 0x4, 0xb4, 0x2, 0x94, 
-0x3, 0xb4, 0x1, 0x94, 0x2, 0xa4, 0x68, 0x94, 0x1, 0x69, 0x8, 0x30, 0xe8, 0xf0, 0xe6, 0xe9, 
-0x8, 0xa8, 0xa5, 0x70, 0xb0, 0x14, 0x16, 0x1, 0x90, 0x2, 0xf6, 0x1, 0x76, 0x1, 0x76, 0x1, 
-0x76, 0x2, 0x76, 0x3, 0x76, 0x4, 0x6a, 0xc8, 0xd0, 0xec, 0x18, 0x60, 0x81, 0x0, 0x0, 0x0, 
-0x0, 0x3, 0x7f, 0x5e, 0x56, 0xcb, 0x79, 0x80, 0x13, 0x9b, 0xb, 0x64, 0x80, 0x76, 0x38, 0x93, 
-0x16, 0x82, 0x38, 0xaa, 0x3b, 0x20, 0x80, 0x35, 0x4, 0xf3, 0x34, 0x81, 0x35, 0x4, 0xf3, 0x34, 
-0x80, 0x80, 0x0, 0x0, 0x0, 0x80, 0x31, 0x72, 0x17, 0xf8, 0x20, 0x2b, 0xbc, 0xf0, 0x2, 0x10, 
-0x3, 0x4c, 0x48, 0xb2, 0xa5, 0x61, 0xe9, 0x7f, 0x48, 0xa9, 0x80, 0x85, 0x61, 0xa9, 0xd6, 0xa0, 
-0xb9, 0x20, 0x67, 0xb8, 0xa9, 0xdb, 0xa0, 0xb9, 0x20, 0xf, 0xbb, 0xa9, 0xbc, 0xa0, 0xb9, 0x20, 
-0x50, 0xb8, 0xa9, 0xc1, 0xa0, 0xb9, 0x20, 0x43, 0xe0, 0xa9, 0xe0, 0xa0, 0xb9, 0x20, 0x67, 0xb8, 
-0x68, 0x20, 0x7e, 0xbd, 0xa9, 0xe5, 0xa0, 0xb9, 0x20, 0x8c, 0xba, 0xd0, 0x3, 0x4c, 0x8b, 0xba, 
-0x20, 0xb7, 0xba, 0xa9, 0x0, 0x85, 0x26, 0x85, 0x27, 0x85, 0x28, 0x85, 0x29, 0xa5, 0x70, 0x20, 
-0x59, 0xba, 0xa5, 0x65, 0x20, 0x59, 0xba, 0xa5, 0x64, 0x20, 0x59, 0xba, 0xa5, 0x63, 0x20, 0x59, 
-0xba, 0xa5, 0x62, 0x20, 0x5e, 0xba, 0x4c, 0x8f, 0xbb, 0xd0, 0x3, 0x4c, 0x83, 0xb9, 0x4a, 0x9, 
-0x80, 0xa8, 0x90, 0x19, 0x18, 0xa5, 0x29, 0x65, 0x6d, 0x85, 0x29, 0xa5, 0x28, 0x65, 0x6c, 0x85, 
-0x28, 0xa5, 0x27, 0x65, 0x6b, 0x85, 0x27, 0xa5, 0x26, 0x65, 0x6a, 0x85, 0x26, 0x66, 0x26, 0x66, 
-0x27, 0x66, 0x28, 0x66, 0x29, 0x66, 0x70, 0x98, 0x4a, 0xd0, 0xd6, 0x60, 0x85, 0x22, 0x84, 0x23, 
-0xa0, 0x4, 0xb1, 0x22, 0x85, 0x6d, 0x88, 0xb1, 0x22, 0x85, 0x6c, 0x88, 0xb1, 0x22, 0x85, 0x6b, 
-0x88, 0xb1, 0x22, 0x85, 0x6e, 0x45, 0x66, 0x85, 0x6f, 0xa5, 0x6e, 0x9, 0x80, 0x85, 0x6a, 0x88, 
-0xb1, 0x22, 0x85, 0x69, 0xa5, 0x61, 0x60, 0xa5, 0x69, 0xf0, 0x1f, 0x18, 0x65, 0x61, 0x90, 0x4, 
-0x30, 0x1d, 0x18, 0x2c, 0x10, 0x14, 0x69, 0x80, 0x85, 0x61, 0xd0, 0x3, 0x4c, 0xfb, 0xb8, 0xa5, 
-0x6f, 0x85, 0x66, 0x60, 0xa5, 0x66, 0x49, 0xff, 0x30, 0x5, 0x68, 0x68, 0x4c, 0xf7, 0xb8, 0x4c, 
-0x7e, 0xb9, 0x20, 0xc, 0xbc, 0xaa, 0xf0, 0x10, 0x18, 0x69, 0x2, 0xb0, 0xf2, 0xa2, 0x0, 0x86, 
-0x6f, 0x20, 0x77, 0xb8, 0xe6, 0x61, 0xf0, 0xe7, 0x60, 0x84, 0x20, 0x0, 0x0, 0x0, 0x20, 0xc, 
-0xbc, 0xa9, 0xf9, 0xa0, 0xba, 0xa2, 0x0, 0x86, 0x6f, 0x20, 0xa2, 0xbb, 0x4c, 0x12, 0xbb, 0x20, 
-0x8c, 0xba, 0xf0, 0x76, 0x20, 0x1b, 0xbc, 0xa9, 0x0, 0x38, 0xe5, 0x61, 0x85, 0x61, 0x20, 0xb7, 
-0xba, 0xe6, 0x61, 0xf0, 0xba, 0xa2, 0xfc, 0xa9, 0x1, 0xa4, 0x6a, 0xc4, 0x62, 0xd0, 0x10, 0xa4, 
-0x6b, 0xc4, 0x63, 0xd0, 0xa, 0xa4, 0x6c, 0xc4, 0x64, 0xd0, 0x4, 0xa4, 0x6d, 0xc4, 0x65, 0x8, 
-0x2a, 0x90, 0x9, 0xe8, 0x95, 0x29, 0xf0, 0x32, 0x10, 0x34, 0xa9, 0x1, 0x28, 0xb0, 0xe, 0x6, 
-0x6d, 0x26, 0x6c, 0x26, 0x6b, 0x26, 0x6a, 0xb0, 0xe6, 0x30, 0xce, 0x10, 0xe2, 0xa8, 0xa5, 0x6d, 
-0xe5, 0x65, 0x85, 0x6d, 0xa5, 0x6c, 0xe5, 0x64, 0x85, 0x6c, 0xa5, 0x6b, 0xe5, 0x63, 0x85, 0x6b, 
-0xa5, 0x6a, 0xe5, 0x62, 0x85, 0x6a, 0x98, 0x4c, 0x4f, 0xbb, 0xa9, 0x40, 0xd0, 0xce, 0xa, 0xa, 
-0xa, 0xa, 0xa, 0xa, 0x85, 0x70, 0x28, 0x4c, 0x8f, 0xbb, 0xa2, 0x14, 0x4c, 0x37, 0xa4, 0xa5, 
-0x26, 0x85, 0x62, 0xa5, 0x27, 0x85, 0x63, 0xa5, 0x28, 0x85, 0x64, 0xa5, 0x29, 0x85, 0x65, 0x4c, 
-0xd7, 0xb8, 0x85, 0x22, 0x84, 0x23, 0xa0, 0x4, 0xb1, 0x22, 0x85, 0x65, 0x88, 0xb1, 0x22, 0x85, 
-0x64, 0x88, 0xb1, 0x22, 0x85, 0x63, 0x88, 0xb1, 0x22, 0x85, 0x66, 0x9, 0x80, 0x85, 0x62, 0x88, 
-0xb1, 0x22, 0x85, 0x61, 0x84, 0x70, 0x60, 0xa2, 0x5c, 0x2c, 0xa2, 0x57, 0xa0, 0x0, 0xf0, 0x4, 
-0xa6, 0x49, 0xa4, 0x4a, 0x20, 0x1b, 0xbc, 0x86, 0x22, 0x84, 0x23, 0xa0, 0x4, 0xa5, 0x65, 0x91, 
-0x22, 0x88, 0xa5, 0x64, 0x91, 0x22, 0x88, 0xa5, 0x63, 0x91, 0x22, 0x88, 0xa5, 0x66, 0x9, 0x7f, 
-0x25, 0x62, 0x91, 0x22, 0x88, 0xa5, 0x61, 0x91, 0x22, 0x84, 0x70, 0x60, 0xa5, 0x6e, 0x85, 0x66, 
-0xa2, 0x5, 0xb5, 0x68, 0x95, 0x60, 0xca, 0xd0, 0xf9, 0x86, 0x70, 0x60, 0x20, 0x1b, 0xbc, 0xa2, 
-0x6, 0xb5, 0x60, 0x95, 0x68, 0xca, 0xd0, 0xf9, 0x86, 0x70, 0x60, 0xa5, 0x61, 0xf0, 0xfb, 0x6, 
-0x70, 0x90, 0xf7, 0x20, 0x6f, 0xb9, 0xd0, 0xf2, 0x4c, 0x38, 0xb9, 0xa5, 0x61, 0xf0, 0x9, 0xa5, 
-0x66, 0x2a, 0xa9, 0xff, 0xb0, 0x2, 0xa9, 0x1, 0x60, 0x20, 0x2b, 0xbc, 0x85, 0x62, 0xa9, 0x0, 
-0x85, 0x63, 0xa2, 0x88, 0xa5, 0x62, 0x49, 0xff, 0x2a, 0xa9, 0x0, 0x85, 0x65, 0x85, 0x64, 0x86, 
-0x61, 0x85, 0x70, 0x85, 0x66, 0x4c, 0xd2, 0xb8, 0x46, 0x66, 0x60, 0x85, 0x24, 0x84, 0x25, 0xa0, 
-0x0, 0xb1, 0x24, 0xc8, 0xaa, 0xf0, 0xc4, 0xb1, 0x24, 0x45, 0x66, 0x30, 0xc2, 0xe4, 0x61, 0xd0, 
-0x21, 0xb1, 0x24, 0x9, 0x80, 0xc5, 0x62, 0xd0, 0x19, 0xc8, 0xb1, 0x24, 0xc5, 0x63, 0xd0, 0x12, 
-0xc8, 0xb1, 0x24, 0xc5, 0x64, 0xd0, 0xb, 0xc8, 0xa9, 0x7f, 0xc5, 0x70, 0xb1, 0x24, 0xe5, 0x65, 
-0xf0, 0x28, 0xa5, 0x66, 0x90, 0x2, 0x49, 0xff, 0x4c, 0x31, 0xbc, 0xa5, 0x61, 0xf0, 0x4a, 0x38, 
-0xe9, 0xa0, 0x24, 0x66, 0x10, 0x9, 0xaa, 0xa9, 0xff, 0x85, 0x68, 0x20, 0x4d, 0xb9, 0x8a, 0xa2, 
-0x61, 0xc9, 0xf9, 0x10, 0x6, 0x20, 0x99, 0xb9, 0x84, 0x68, 0x60, 0xa8, 0xa5, 0x66, 0x29, 0x80, 
-0x46, 0x62, 0x5, 0x62, 0x85, 0x62, 0x20, 0xb0, 0xb9, 0x84, 0x68, 0x60, 0xa5, 0x61, 0xc9, 0xa0, 
-0xb0, 0x20, 0x20, 0x9b, 0xbc, 0x84, 0x70, 0xa5, 0x66, 0x84, 0x66, 0x49, 0x80, 0x2a, 0xa9, 0xa0, 
-0x85, 0x61, 0xa5, 0x65, 0x85, 0x7, 0x4c, 0xd2, 0xb8, 0x85, 0x62, 0x85, 0x63, 0x85, 0x64, 0x85, 
-0x65, 0xa8, 0x60, 0xa0, 0x0, 0xa2, 0xa, 0x94, 0x5d, 0xca, 0x10, 0xfb, 0x90, 0xf, 0xc9, 0x2d, 
-0xd0, 0x4, 0x86, 0x67, 0xf0, 0x4, 0xc9, 0x2b, 0xd0, 0x5, 0x20, 0x73, 0x0, 0x90, 0x5b, 0xc9, 
-0x2e, 0xf0, 0x2e, 0xc9, 0x45, 0xd0, 0x30, 0x20, 0x73, 0x0, 0x90, 0x17, 0xc9, 0xab, 0xf0, 0xe, 
-0xc9, 0x2d, 0xf0, 0xa, 0xc9, 0xaa, 0xf0, 0x8, 0xc9, 0x2b, 0xf0, 0x4, 0xd0, 0x7, 0x66, 0x60, 
-0x20, 0x73, 0x0, 0x90, 0x5c, 0x24, 0x60, 0x10, 0xe, 0xa9, 0x0, 0x38, 0xe5, 0x5e, 0x4c, 0x49, 
-0xbd, 0x66, 0x5f, 0x24, 0x5f, 0x50, 0xc3, 0xa5, 0x5e, 0x38, 0xe5, 0x5d, 0x85, 0x5e, 0xf0, 0x12, 
-0x10, 0x9, 0x20, 0xfe, 0xba, 0xe6, 0x5e, 0xd0, 0xf9, 0xf0, 0x7, 0x20, 0xe2, 0xba, 0xc6, 0x5e, 
-0xd0, 0xf9, 0xa5, 0x67, 0x30, 0x1, 0x60, 0x4c, 0xb4, 0xbf, 0x48, 0x24, 0x5f, 0x10, 0x2, 0xe6, 
-0x5d, 0x20, 0xe2, 0xba, 0x68, 0x38, 0xe9, 0x30, 0x20, 0x7e, 0xbd, 0x4c, 0xa, 0xbd, 0x48, 0x20, 
-0xc, 0xbc, 0x68, 0x20, 0x3c, 0xbc, 0xa5, 0x6e, 0x45, 0x66, 0x85, 0x6f, 0xa6, 0x61, 0x4c, 0x6a, 
-0xb8, 0xa5, 0x5e, 0xc9, 0xa, 0x90, 0x9, 0xa9, 0x64, 0x24, 0x60, 0x30, 0x11, 0x4c, 0x7e, 0xb9, 
-0xa, 0xa, 0x18, 0x65, 0x5e, 0xa, 0x18, 0xa0, 0x0, 0x71, 0x7a, 0x38, 0xe9, 0x30, 0x85, 0x5e, 
-0x4c, 0x30, 0xbd, 0x9b, 0x3e, 0xbc, 0x1f, 0xfd, 0x9e, 0x6e, 0x6b, 0x27, 0xfd, 0x9e, 0x6e, 0x6b, 
-0x28, 0x0, 0xa9, 0x71, 0xa0, 0xa3, 0x20, 0xda, 0xbd, 0xa5, 0x3a, 0xa6, 0x39, 0x85, 0x62, 0x86, 
-0x63, 0xa2, 0x90, 0x38, 0x20, 0x49, 0xbc, 0x20, 0xdf, 0xbd, 0x4c, 0x1e, 0xab, 0xa0, 0x1, 0xa9, 
-0x20, 0x24, 0x66, 0x10, 0x2, 0xa9, 0x2d, 0x99, 0xff, 0x0, 0x85, 0x66, 0x84, 0x71, 0xc8, 0xa9, 
-0x30, 0xa6, 0x61, 0xd0, 0x3, 0x4c, 0x4, 0xbf, 0xa9, 0x0, 0xe0, 0x80, 0xf0, 0x2, 0xb0, 0x9, 
-0xa9, 0xbd, 0xa0, 0xbd, 0x20, 0x28, 0xba, 0xa9, 0xf7, 0x85, 0x5d, 0xa9, 0xb8, 0xa0, 0xbd, 0x20, 
-0x5b, 0xbc, 0xf0, 0x1e, 0x10, 0x12, 0xa9, 0xb3, 0xa0, 0xbd, 0x20, 0x5b, 0xbc, 0xf0, 0x2, 0x10, 
-0xe, 0x20, 0xe2, 0xba, 0xc6, 0x5d, 0xd0, 0xee, 0x20, 0xfe, 0xba, 0xe6, 0x5d, 0xd0, 0xdc, 0x20, 
-0x49, 0xb8, 0x20, 0x9b, 0xbc, 0xa2, 0x1, 0xa5, 0x5d, 0x18, 0x69, 0xa, 0x30, 0x9, 0xc9, 0xb, 
-0xb0, 0x6, 0x69, 0xff, 0xaa, 0xa9, 0x2, 0x38, 0xe9, 0x2, 0x85, 0x5e, 0x86, 0x5d, 0x8a, 0xf0, 
-0x2, 0x10, 0x13, 0xa4, 0x71, 0xa9, 0x2e, 0xc8, 0x99, 0xff, 0x0, 0x8a, 0xf0, 0x6, 0xa9, 0x30, 
-0xc8, 0x99, 0xff, 0x0, 0x84, 0x71, 0xa0, 0x0, 0xa2, 0x80, 0xa5, 0x65, 0x18, 0x79, 0x19, 0xbf, 
-0x85, 0x65, 0xa5, 0x64, 0x79, 0x18, 0xbf, 0x85, 0x64, 0xa5, 0x63, 0x79, 0x17, 0xbf, 0x85, 0x63, 
-0xa5, 0x62, 0x79, 0x16, 0xbf, 0x85, 0x62, 0xe8, 0xb0, 0x4, 0x10, 0xde, 0x30, 0x2, 0x30, 0xda, 
-0x8a, 0x90, 0x4, 0x49, 0xff, 0x69, 0xa, 0x69, 0x2f, 0xc8, 0xc8, 0xc8, 0xc8, 0x84, 0x47, 0xa4, 
-0x71, 0xc8, 0xaa, 0x29, 0x7f, 0x99, 0xff, 0x0, 0xc6, 0x5d, 0xd0, 0x6, 0xa9, 0x2e, 0xc8, 0x99, 
-0xff, 0x0, 0x84, 0x71, 0xa4, 0x47, 0x8a, 0x49, 0xff, 0x29, 0x80, 0xaa, 0xc0, 0x24, 0xf0, 0x4, 
-0xc0, 0x3c, 0xd0, 0xa6, 0xa4, 0x71, 0xb9, 0xff, 0x0, 0x88, 0xc9, 0x30, 0xf0, 0xf8, 0xc9, 0x2e, 
-0xf0, 0x1, 0xc8, 0xa9, 0x2b, 0xa6, 0x5e, 0xf0, 0x2e, 0x10, 0x8, 0xa9, 0x0, 0x38, 0xe5, 0x5e, 
-0xaa, 0xa9, 0x2d, 0x99, 0x1, 0x1, 0xa9, 0x45, 0x99, 0x0, 0x1, 0x8a, 0xa2, 0x2f, 0x38, 0xe8, 
-0xe9, 0xa, 0xb0, 0xfb, 0x69, 0x3a, 0x99, 0x3, 0x1, 0x8a, 0x99, 0x2, 0x1, 0xa9, 0x0, 0x99, 
-0x4, 0x1, 0xf0, 0x8, 0x99, 0xff, 0x0, 0xa9, 0x0, 0x99, 0x0, 0x1, 0xa9, 0x0, 0xa0, 0x1, 
-0x60, 0x80, 0x0, 0x0, 0x0, 0x0, 0xfa, 0xa, 0x1f, 0x0, 0x0, 0x98, 0x96, 0x80, 0xff, 0xf0, 
-0xbd, 0xc0, 0x0, 0x1, 0x86, 0xa0, 0xff, 0xff, 0xd8, 0xf0, 0x0, 0x0, 0x3, 0xe8, 0xff, 0xff, 
-0xff, 0x9c, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xa, 0x80, 0x0, 0x3, 
-0x4b, 0xc0, 0xff, 0xff, 0x73, 0x60, 0x0, 0x0, 0xe, 0x10, 0xff, 0xff, 0xfd, 0xa8, 0x0, 0x0, 
-0x0, 0x3c, 0xec, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-0xaa, 0x20, 0xc, 0xbc, 0xa9, 0x11, 0xa0, 0xbf, 0x20, 0xa2, 0xbb, 0xf0, 0x70, 0xa5, 0x69, 0xd0, 
-0x3, 0x4c, 0xf9, 0xb8, 0xa2, 0x4e, 0xa0, 0x0, 0x20, 0xd4, 0xbb, 0xa5, 0x6e, 0x10, 0xf, 0x20, 
-0xcc, 0xbc, 0xa9, 0x4e, 0xa0, 0x0, 0x20, 0x5b, 0xbc, 0xd0, 0x3, 0x98, 0xa4, 0x7, 0x20, 0xfe, 
-0xbb, 0x98, 0x48, 0x20, 0xea, 0xb9, 0xa9, 0x4e, 0xa0, 0x0, 0x20, 0x28, 0xba, 0x20, 0xed, 0xbf, 
-0x68, 0x4a, 0x90, 0xa, 0xa5, 0x61, 0xf0, 0x6, 0xa5, 0x66, 0x49, 0xff, 0x85, 0x66, 0x60, 0x81, 
-0x38, 0xaa, 0x3b, 0x29, 0x7, 0x71, 0x34, 0x58, 0x3e, 0x56, 0x74, 0x16, 0x7e, 0xb3, 0x1b, 0x77, 
-0x2f, 0xee, 0xe3, 0x85, 0x7a, 0x1d, 0x84, 0x1c, 0x2a, 0x7c, 0x63, 0x59, 0x58, 0xa, 0x7e, 0x75, 
-0xfd, 0xe7, 0xc6, 0x80, 0x31, 0x72, 0x18, 0x10, 0x81, 0x0, 0x0, 0x0, 0x0, 0xa9, 0xbf, 0xa0, 
-0xbf, 0x20, 0x28, 0xba, 0xa5, 0x70, 0x69, 0x50, 0x90, 0x3, 0x20, 0x23, 0xbc, 0x4c, 0x0, 0xe0, 
-
-};
-unsigned char dump_c64_char[4096] = {
-0x3c, 0x66, 0x6e, 0x6e, 0x60, 0x62, 0x3c, 0x0, 0x18, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x0, 
-0x7c, 0x66, 0x66, 0x7c, 0x66, 0x66, 0x7c, 0x0, 0x3c, 0x66, 0x60, 0x60, 0x60, 0x66, 0x3c, 0x0, 
-0x78, 0x6c, 0x66, 0x66, 0x66, 0x6c, 0x78, 0x0, 0x7e, 0x60, 0x60, 0x78, 0x60, 0x60, 0x7e, 0x0, 
-0x7e, 0x60, 0x60, 0x78, 0x60, 0x60, 0x60, 0x0, 0x3c, 0x66, 0x60, 0x6e, 0x66, 0x66, 0x3c, 0x0, 
-0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x0, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0, 
-0x1e, 0xc, 0xc, 0xc, 0xc, 0x6c, 0x38, 0x0, 0x66, 0x6c, 0x78, 0x70, 0x78, 0x6c, 0x66, 0x0, 
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7e, 0x0, 0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x0, 
-0x66, 0x76, 0x7e, 0x7e, 0x6e, 0x66, 0x66, 0x0, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x0, 
-0x7c, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x60, 0x0, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0xe, 0x0, 
-0x7c, 0x66, 0x66, 0x7c, 0x78, 0x6c, 0x66, 0x0, 0x3c, 0x66, 0x60, 0x3c, 0x6, 0x66, 0x3c, 0x0, 
-0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x0, 
-0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x0, 0x63, 0x63, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x0, 
-0x66, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0x66, 0x0, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x0, 
-0x7e, 0x6, 0xc, 0x18, 0x30, 0x60, 0x7e, 0x0, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x0, 
-0xc, 0x12, 0x30, 0x7c, 0x30, 0x62, 0xfc, 0x0, 0x3c, 0xc, 0xc, 0xc, 0xc, 0xc, 0x3c, 0x0, 
-0x0, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x0, 0x10, 0x30, 0x7f, 0x7f, 0x30, 0x10, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0x18, 0x0, 0x0, 0x18, 0x0, 
-0x66, 0x66, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0xff, 0x66, 0xff, 0x66, 0x66, 0x0, 
-0x18, 0x3e, 0x60, 0x3c, 0x6, 0x7c, 0x18, 0x0, 0x62, 0x66, 0xc, 0x18, 0x30, 0x66, 0x46, 0x0, 
-0x3c, 0x66, 0x3c, 0x38, 0x67, 0x66, 0x3f, 0x0, 0x6, 0xc, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xc, 0x18, 0x30, 0x30, 0x30, 0x18, 0xc, 0x0, 0x30, 0x18, 0xc, 0xc, 0xc, 0x18, 0x30, 0x0, 
-0x0, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x0, 0x0, 0x0, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x30, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 0x0, 0x3, 0x6, 0xc, 0x18, 0x30, 0x60, 0x0, 
-0x3c, 0x66, 0x6e, 0x76, 0x66, 0x66, 0x3c, 0x0, 0x18, 0x18, 0x38, 0x18, 0x18, 0x18, 0x7e, 0x0, 
-0x3c, 0x66, 0x6, 0xc, 0x30, 0x60, 0x7e, 0x0, 0x3c, 0x66, 0x6, 0x1c, 0x6, 0x66, 0x3c, 0x0, 
-0x6, 0xe, 0x1e, 0x66, 0x7f, 0x6, 0x6, 0x0, 0x7e, 0x60, 0x7c, 0x6, 0x6, 0x66, 0x3c, 0x0, 
-0x3c, 0x66, 0x60, 0x7c, 0x66, 0x66, 0x3c, 0x0, 0x7e, 0x66, 0xc, 0x18, 0x18, 0x18, 0x18, 0x0, 
-0x3c, 0x66, 0x66, 0x3c, 0x66, 0x66, 0x3c, 0x0, 0x3c, 0x66, 0x66, 0x3e, 0x6, 0x66, 0x3c, 0x0, 
-0x0, 0x0, 0x18, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18, 0x18, 0x30, 
-0xe, 0x18, 0x30, 0x60, 0x30, 0x18, 0xe, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x7e, 0x0, 0x0, 0x0, 
-0x70, 0x18, 0xc, 0x6, 0xc, 0x18, 0x70, 0x0, 0x3c, 0x66, 0x6, 0xc, 0x18, 0x0, 0x18, 0x0, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x8, 0x1c, 0x3e, 0x7f, 0x7f, 0x1c, 0x3e, 0x0, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 
-0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0x0, 0x0, 0x0, 0xe0, 0xf0, 0x38, 0x18, 0x18, 
-0x18, 0x18, 0x1c, 0xf, 0x7, 0x0, 0x0, 0x0, 0x18, 0x18, 0x38, 0xf0, 0xe0, 0x0, 0x0, 0x0, 
-0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0xe, 0x7, 0x3, 
-0x3, 0x7, 0xe, 0x1c, 0x38, 0x70, 0xe0, 0xc0, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xff, 0xff, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x3c, 0x7e, 0x7e, 0x7e, 0x7e, 0x3c, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x36, 0x7f, 0x7f, 0x7f, 0x3e, 0x1c, 0x8, 0x0, 
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x0, 0x0, 0x0, 0x7, 0xf, 0x1c, 0x18, 0x18, 
-0xc3, 0xe7, 0x7e, 0x3c, 0x3c, 0x7e, 0xe7, 0xc3, 0x0, 0x3c, 0x7e, 0x66, 0x66, 0x7e, 0x3c, 0x0, 
-0x18, 0x18, 0x66, 0x66, 0x18, 0x18, 0x3c, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 
-0x8, 0x1c, 0x3e, 0x7f, 0x3e, 0x1c, 0x8, 0x0, 0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 
-0xc0, 0xc0, 0x30, 0x30, 0xc0, 0xc0, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x0, 0x0, 0x3, 0x3e, 0x76, 0x36, 0x36, 0x0, 0xff, 0x7f, 0x3f, 0x1f, 0xf, 0x7, 0x3, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 
-0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc, 0x33, 0x33, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 
-0x0, 0x0, 0x0, 0x0, 0xcc, 0xcc, 0x33, 0x33, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 
-0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x18, 0x18, 0x18, 
-0x0, 0x0, 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 
-0x0, 0x0, 0x0, 0x1f, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0xff, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0xf8, 0x18, 0x18, 0x18, 
-0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 
-0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xf0, 0xf0, 0xf0, 
-0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0xf8, 0xf8, 0x0, 0x0, 0x0, 
-0xf0, 0xf0, 0xf0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf, 0xf, 0xf, 0xf, 
-0xc3, 0x99, 0x91, 0x91, 0x9f, 0x99, 0xc3, 0xff, 0xe7, 0xc3, 0x99, 0x81, 0x99, 0x99, 0x99, 0xff, 
-0x83, 0x99, 0x99, 0x83, 0x99, 0x99, 0x83, 0xff, 0xc3, 0x99, 0x9f, 0x9f, 0x9f, 0x99, 0xc3, 0xff, 
-0x87, 0x93, 0x99, 0x99, 0x99, 0x93, 0x87, 0xff, 0x81, 0x9f, 0x9f, 0x87, 0x9f, 0x9f, 0x81, 0xff, 
-0x81, 0x9f, 0x9f, 0x87, 0x9f, 0x9f, 0x9f, 0xff, 0xc3, 0x99, 0x9f, 0x91, 0x99, 0x99, 0xc3, 0xff, 
-0x99, 0x99, 0x99, 0x81, 0x99, 0x99, 0x99, 0xff, 0xc3, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xc3, 0xff, 
-0xe1, 0xf3, 0xf3, 0xf3, 0xf3, 0x93, 0xc7, 0xff, 0x99, 0x93, 0x87, 0x8f, 0x87, 0x93, 0x99, 0xff, 
-0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x81, 0xff, 0x9c, 0x88, 0x80, 0x94, 0x9c, 0x9c, 0x9c, 0xff, 
-0x99, 0x89, 0x81, 0x81, 0x91, 0x99, 0x99, 0xff, 0xc3, 0x99, 0x99, 0x99, 0x99, 0x99, 0xc3, 0xff, 
-0x83, 0x99, 0x99, 0x83, 0x9f, 0x9f, 0x9f, 0xff, 0xc3, 0x99, 0x99, 0x99, 0x99, 0xc3, 0xf1, 0xff, 
-0x83, 0x99, 0x99, 0x83, 0x87, 0x93, 0x99, 0xff, 0xc3, 0x99, 0x9f, 0xc3, 0xf9, 0x99, 0xc3, 0xff, 
-0x81, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xff, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xc3, 0xff, 
-0x99, 0x99, 0x99, 0x99, 0x99, 0xc3, 0xe7, 0xff, 0x9c, 0x9c, 0x9c, 0x94, 0x80, 0x88, 0x9c, 0xff, 
-0x99, 0x99, 0xc3, 0xe7, 0xc3, 0x99, 0x99, 0xff, 0x99, 0x99, 0x99, 0xc3, 0xe7, 0xe7, 0xe7, 0xff, 
-0x81, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x81, 0xff, 0xc3, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xc3, 0xff, 
-0xf3, 0xed, 0xcf, 0x83, 0xcf, 0x9d, 0x3, 0xff, 0xc3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xc3, 0xff, 
-0xff, 0xe7, 0xc3, 0x81, 0xe7, 0xe7, 0xe7, 0xe7, 0xff, 0xef, 0xcf, 0x80, 0x80, 0xcf, 0xef, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0xe7, 0xff, 
-0x99, 0x99, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x99, 0x0, 0x99, 0x0, 0x99, 0x99, 0xff, 
-0xe7, 0xc1, 0x9f, 0xc3, 0xf9, 0x83, 0xe7, 0xff, 0x9d, 0x99, 0xf3, 0xe7, 0xcf, 0x99, 0xb9, 0xff, 
-0xc3, 0x99, 0xc3, 0xc7, 0x98, 0x99, 0xc0, 0xff, 0xf9, 0xf3, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xf3, 0xe7, 0xcf, 0xcf, 0xcf, 0xe7, 0xf3, 0xff, 0xcf, 0xe7, 0xf3, 0xf3, 0xf3, 0xe7, 0xcf, 0xff, 
-0xff, 0x99, 0xc3, 0x0, 0xc3, 0x99, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0x81, 0xe7, 0xe7, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xcf, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0xff, 
-0xc3, 0x99, 0x91, 0x89, 0x99, 0x99, 0xc3, 0xff, 0xe7, 0xe7, 0xc7, 0xe7, 0xe7, 0xe7, 0x81, 0xff, 
-0xc3, 0x99, 0xf9, 0xf3, 0xcf, 0x9f, 0x81, 0xff, 0xc3, 0x99, 0xf9, 0xe3, 0xf9, 0x99, 0xc3, 0xff, 
-0xf9, 0xf1, 0xe1, 0x99, 0x80, 0xf9, 0xf9, 0xff, 0x81, 0x9f, 0x83, 0xf9, 0xf9, 0x99, 0xc3, 0xff, 
-0xc3, 0x99, 0x9f, 0x83, 0x99, 0x99, 0xc3, 0xff, 0x81, 0x99, 0xf3, 0xe7, 0xe7, 0xe7, 0xe7, 0xff, 
-0xc3, 0x99, 0x99, 0xc3, 0x99, 0x99, 0xc3, 0xff, 0xc3, 0x99, 0x99, 0xc1, 0xf9, 0x99, 0xc3, 0xff, 
-0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xe7, 0xcf, 
-0xf1, 0xe7, 0xcf, 0x9f, 0xcf, 0xe7, 0xf1, 0xff, 0xff, 0xff, 0x81, 0xff, 0x81, 0xff, 0xff, 0xff, 
-0x8f, 0xe7, 0xf3, 0xf9, 0xf3, 0xe7, 0x8f, 0xff, 0xc3, 0x99, 0xf9, 0xf3, 0xe7, 0xff, 0xe7, 0xff, 
-0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf7, 0xe3, 0xc1, 0x80, 0x80, 0xe3, 0xc1, 0xff, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 
-0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0x1f, 0xf, 0xc7, 0xe7, 0xe7, 
-0xe7, 0xe7, 0xe3, 0xf0, 0xf8, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xc7, 0xf, 0x1f, 0xff, 0xff, 0xff, 
-0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x0, 0x0, 0x3f, 0x1f, 0x8f, 0xc7, 0xe3, 0xf1, 0xf8, 0xfc, 
-0xfc, 0xf8, 0xf1, 0xe3, 0xc7, 0x8f, 0x1f, 0x3f, 0x0, 0x0, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 
-0x0, 0x0, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xc3, 0x81, 0x81, 0x81, 0x81, 0xc3, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xc9, 0x80, 0x80, 0x80, 0xc1, 0xe3, 0xf7, 0xff, 
-0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0xe3, 0xe7, 0xe7, 
-0x3c, 0x18, 0x81, 0xc3, 0xc3, 0x81, 0x18, 0x3c, 0xff, 0xc3, 0x81, 0x99, 0x99, 0x81, 0xc3, 0xff, 
-0xe7, 0xe7, 0x99, 0x99, 0xe7, 0xe7, 0xc3, 0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 
-0xf7, 0xe3, 0xc1, 0x80, 0xc1, 0xe3, 0xf7, 0xff, 0xe7, 0xe7, 0xe7, 0x0, 0x0, 0xe7, 0xe7, 0xe7, 
-0x3f, 0x3f, 0xcf, 0xcf, 0x3f, 0x3f, 0xcf, 0xcf, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 
-0xff, 0xff, 0xfc, 0xc1, 0x89, 0xc9, 0xc9, 0xff, 0x0, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 
-0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 
-0x33, 0x33, 0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 
-0xff, 0xff, 0xff, 0xff, 0x33, 0x33, 0xcc, 0xcc, 0x0, 0x1, 0x3, 0x7, 0xf, 0x1f, 0x3f, 0x7f, 
-0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xe7, 0xe7, 0xe7, 0xe0, 0xe0, 0xe7, 0xe7, 0xe7, 
-0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xe7, 0xe7, 0xe7, 0xe0, 0xe0, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x7, 0x7, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 
-0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0x0, 0x0, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x0, 0x0, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0x7, 0x7, 0xe7, 0xe7, 0xe7, 
-0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 
-0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 
-0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf, 0xf, 0xf, 0xf, 
-0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xe7, 0x7, 0x7, 0xff, 0xff, 0xff, 
-0xf, 0xf, 0xf, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf, 0xf, 0xf, 0xf, 0xf0, 0xf0, 0xf0, 0xf0, 
-0x3c, 0x66, 0x6e, 0x6e, 0x60, 0x62, 0x3c, 0x0, 0x0, 0x0, 0x3c, 0x6, 0x3e, 0x66, 0x3e, 0x0, 
-0x0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x0, 0x0, 0x0, 0x3c, 0x60, 0x60, 0x60, 0x3c, 0x0, 
-0x0, 0x6, 0x6, 0x3e, 0x66, 0x66, 0x3e, 0x0, 0x0, 0x0, 0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x0, 
-0x0, 0xe, 0x18, 0x3e, 0x18, 0x18, 0x18, 0x0, 0x0, 0x0, 0x3e, 0x66, 0x66, 0x3e, 0x6, 0x7c, 
-0x0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x0, 0x0, 0x18, 0x0, 0x38, 0x18, 0x18, 0x3c, 0x0, 
-0x0, 0x6, 0x0, 0x6, 0x6, 0x6, 0x6, 0x3c, 0x0, 0x60, 0x60, 0x6c, 0x78, 0x6c, 0x66, 0x0, 
-0x0, 0x38, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0, 0x0, 0x0, 0x66, 0x7f, 0x7f, 0x6b, 0x63, 0x0, 
-0x0, 0x0, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x0, 0x0, 0x0, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x0, 
-0x0, 0x0, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x0, 0x0, 0x3e, 0x66, 0x66, 0x3e, 0x6, 0x6, 
-0x0, 0x0, 0x7c, 0x66, 0x60, 0x60, 0x60, 0x0, 0x0, 0x0, 0x3e, 0x60, 0x3c, 0x6, 0x7c, 0x0, 
-0x0, 0x18, 0x7e, 0x18, 0x18, 0x18, 0xe, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x0, 
-0x0, 0x0, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x0, 0x0, 0x0, 0x63, 0x6b, 0x7f, 0x3e, 0x36, 0x0, 
-0x0, 0x0, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x3e, 0xc, 0x78, 
-0x0, 0x0, 0x7e, 0xc, 0x18, 0x30, 0x7e, 0x0, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x0, 
-0xc, 0x12, 0x30, 0x7c, 0x30, 0x62, 0xfc, 0x0, 0x3c, 0xc, 0xc, 0xc, 0xc, 0xc, 0x3c, 0x0, 
-0x0, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x0, 0x10, 0x30, 0x7f, 0x7f, 0x30, 0x10, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0x18, 0x0, 0x0, 0x18, 0x0, 
-0x66, 0x66, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0xff, 0x66, 0xff, 0x66, 0x66, 0x0, 
-0x18, 0x3e, 0x60, 0x3c, 0x6, 0x7c, 0x18, 0x0, 0x62, 0x66, 0xc, 0x18, 0x30, 0x66, 0x46, 0x0, 
-0x3c, 0x66, 0x3c, 0x38, 0x67, 0x66, 0x3f, 0x0, 0x6, 0xc, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xc, 0x18, 0x30, 0x30, 0x30, 0x18, 0xc, 0x0, 0x30, 0x18, 0xc, 0xc, 0xc, 0x18, 0x30, 0x0, 
-0x0, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x0, 0x0, 0x0, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x30, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 0x0, 0x3, 0x6, 0xc, 0x18, 0x30, 0x60, 0x0, 
-0x3c, 0x66, 0x6e, 0x76, 0x66, 0x66, 0x3c, 0x0, 0x18, 0x18, 0x38, 0x18, 0x18, 0x18, 0x7e, 0x0, 
-0x3c, 0x66, 0x6, 0xc, 0x30, 0x60, 0x7e, 0x0, 0x3c, 0x66, 0x6, 0x1c, 0x6, 0x66, 0x3c, 0x0, 
-0x6, 0xe, 0x1e, 0x66, 0x7f, 0x6, 0x6, 0x0, 0x7e, 0x60, 0x7c, 0x6, 0x6, 0x66, 0x3c, 0x0, 
-0x3c, 0x66, 0x60, 0x7c, 0x66, 0x66, 0x3c, 0x0, 0x7e, 0x66, 0xc, 0x18, 0x18, 0x18, 0x18, 0x0, 
-0x3c, 0x66, 0x66, 0x3c, 0x66, 0x66, 0x3c, 0x0, 0x3c, 0x66, 0x66, 0x3e, 0x6, 0x66, 0x3c, 0x0, 
-0x0, 0x0, 0x18, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18, 0x18, 0x30, 
-0xe, 0x18, 0x30, 0x60, 0x30, 0x18, 0xe, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x7e, 0x0, 0x0, 0x0, 
-0x70, 0x18, 0xc, 0x6, 0xc, 0x18, 0x70, 0x0, 0x3c, 0x66, 0x6, 0xc, 0x18, 0x0, 0x18, 0x0, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x18, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x0, 
-0x7c, 0x66, 0x66, 0x7c, 0x66, 0x66, 0x7c, 0x0, 0x3c, 0x66, 0x60, 0x60, 0x60, 0x66, 0x3c, 0x0, 
-0x78, 0x6c, 0x66, 0x66, 0x66, 0x6c, 0x78, 0x0, 0x7e, 0x60, 0x60, 0x78, 0x60, 0x60, 0x7e, 0x0, 
-0x7e, 0x60, 0x60, 0x78, 0x60, 0x60, 0x60, 0x0, 0x3c, 0x66, 0x60, 0x6e, 0x66, 0x66, 0x3c, 0x0, 
-0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x0, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0, 
-0x1e, 0xc, 0xc, 0xc, 0xc, 0x6c, 0x38, 0x0, 0x66, 0x6c, 0x78, 0x70, 0x78, 0x6c, 0x66, 0x0, 
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7e, 0x0, 0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x0, 
-0x66, 0x76, 0x7e, 0x7e, 0x6e, 0x66, 0x66, 0x0, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x0, 
-0x7c, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x60, 0x0, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0xe, 0x0, 
-0x7c, 0x66, 0x66, 0x7c, 0x78, 0x6c, 0x66, 0x0, 0x3c, 0x66, 0x60, 0x3c, 0x6, 0x66, 0x3c, 0x0, 
-0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x0, 
-0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x0, 0x63, 0x63, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x0, 
-0x66, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0x66, 0x0, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x0, 
-0x7e, 0x6, 0xc, 0x18, 0x30, 0x60, 0x7e, 0x0, 0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 
-0xc0, 0xc0, 0x30, 0x30, 0xc0, 0xc0, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x33, 0x33, 0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc, 0x33, 0x99, 0xcc, 0x66, 0x33, 0x99, 0xcc, 0x66, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 
-0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc, 0x33, 0x33, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 
-0x0, 0x0, 0x0, 0x0, 0xcc, 0xcc, 0x33, 0x33, 0xcc, 0x99, 0x33, 0x66, 0xcc, 0x99, 0x33, 0x66, 
-0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x18, 0x18, 0x18, 
-0x0, 0x0, 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 
-0x0, 0x0, 0x0, 0x1f, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0xff, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0xf8, 0x18, 0x18, 0x18, 
-0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 
-0x1, 0x3, 0x6, 0x6c, 0x78, 0x70, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xf0, 0xf0, 0xf0, 
-0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0xf8, 0xf8, 0x0, 0x0, 0x0, 
-0xf0, 0xf0, 0xf0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf, 0xf, 0xf, 0xf, 
-0xc3, 0x99, 0x91, 0x91, 0x9f, 0x99, 0xc3, 0xff, 0xff, 0xff, 0xc3, 0xf9, 0xc1, 0x99, 0xc1, 0xff, 
-0xff, 0x9f, 0x9f, 0x83, 0x99, 0x99, 0x83, 0xff, 0xff, 0xff, 0xc3, 0x9f, 0x9f, 0x9f, 0xc3, 0xff, 
-0xff, 0xf9, 0xf9, 0xc1, 0x99, 0x99, 0xc1, 0xff, 0xff, 0xff, 0xc3, 0x99, 0x81, 0x9f, 0xc3, 0xff, 
-0xff, 0xf1, 0xe7, 0xc1, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xc1, 0x99, 0x99, 0xc1, 0xf9, 0x83, 
-0xff, 0x9f, 0x9f, 0x83, 0x99, 0x99, 0x99, 0xff, 0xff, 0xe7, 0xff, 0xc7, 0xe7, 0xe7, 0xc3, 0xff, 
-0xff, 0xf9, 0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0xc3, 0xff, 0x9f, 0x9f, 0x93, 0x87, 0x93, 0x99, 0xff, 
-0xff, 0xc7, 0xe7, 0xe7, 0xe7, 0xe7, 0xc3, 0xff, 0xff, 0xff, 0x99, 0x80, 0x80, 0x94, 0x9c, 0xff, 
-0xff, 0xff, 0x83, 0x99, 0x99, 0x99, 0x99, 0xff, 0xff, 0xff, 0xc3, 0x99, 0x99, 0x99, 0xc3, 0xff, 
-0xff, 0xff, 0x83, 0x99, 0x99, 0x83, 0x9f, 0x9f, 0xff, 0xff, 0xc1, 0x99, 0x99, 0xc1, 0xf9, 0xf9, 
-0xff, 0xff, 0x83, 0x99, 0x9f, 0x9f, 0x9f, 0xff, 0xff, 0xff, 0xc1, 0x9f, 0xc3, 0xf9, 0x83, 0xff, 
-0xff, 0xe7, 0x81, 0xe7, 0xe7, 0xe7, 0xf1, 0xff, 0xff, 0xff, 0x99, 0x99, 0x99, 0x99, 0xc1, 0xff, 
-0xff, 0xff, 0x99, 0x99, 0x99, 0xc3, 0xe7, 0xff, 0xff, 0xff, 0x9c, 0x94, 0x80, 0xc1, 0xc9, 0xff, 
-0xff, 0xff, 0x99, 0xc3, 0xe7, 0xc3, 0x99, 0xff, 0xff, 0xff, 0x99, 0x99, 0x99, 0xc1, 0xf3, 0x87, 
-0xff, 0xff, 0x81, 0xf3, 0xe7, 0xcf, 0x81, 0xff, 0xc3, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xc3, 0xff, 
-0xf3, 0xed, 0xcf, 0x83, 0xcf, 0x9d, 0x3, 0xff, 0xc3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xc3, 0xff, 
-0xff, 0xe7, 0xc3, 0x81, 0xe7, 0xe7, 0xe7, 0xe7, 0xff, 0xef, 0xcf, 0x80, 0x80, 0xcf, 0xef, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0xe7, 0xff, 
-0x99, 0x99, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x99, 0x0, 0x99, 0x0, 0x99, 0x99, 0xff, 
-0xe7, 0xc1, 0x9f, 0xc3, 0xf9, 0x83, 0xe7, 0xff, 0x9d, 0x99, 0xf3, 0xe7, 0xcf, 0x99, 0xb9, 0xff, 
-0xc3, 0x99, 0xc3, 0xc7, 0x98, 0x99, 0xc0, 0xff, 0xf9, 0xf3, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xf3, 0xe7, 0xcf, 0xcf, 0xcf, 0xe7, 0xf3, 0xff, 0xcf, 0xe7, 0xf3, 0xf3, 0xf3, 0xe7, 0xcf, 0xff, 
-0xff, 0x99, 0xc3, 0x0, 0xc3, 0x99, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0x81, 0xe7, 0xe7, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xcf, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0xff, 
-0xc3, 0x99, 0x91, 0x89, 0x99, 0x99, 0xc3, 0xff, 0xe7, 0xe7, 0xc7, 0xe7, 0xe7, 0xe7, 0x81, 0xff, 
-0xc3, 0x99, 0xf9, 0xf3, 0xcf, 0x9f, 0x81, 0xff, 0xc3, 0x99, 0xf9, 0xe3, 0xf9, 0x99, 0xc3, 0xff, 
-0xf9, 0xf1, 0xe1, 0x99, 0x80, 0xf9, 0xf9, 0xff, 0x81, 0x9f, 0x83, 0xf9, 0xf9, 0x99, 0xc3, 0xff, 
-0xc3, 0x99, 0x9f, 0x83, 0x99, 0x99, 0xc3, 0xff, 0x81, 0x99, 0xf3, 0xe7, 0xe7, 0xe7, 0xe7, 0xff, 
-0xc3, 0x99, 0x99, 0xc3, 0x99, 0x99, 0xc3, 0xff, 0xc3, 0x99, 0x99, 0xc1, 0xf9, 0x99, 0xc3, 0xff, 
-0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xe7, 0xcf, 
-0xf1, 0xe7, 0xcf, 0x9f, 0xcf, 0xe7, 0xf1, 0xff, 0xff, 0xff, 0x81, 0xff, 0x81, 0xff, 0xff, 0xff, 
-0x8f, 0xe7, 0xf3, 0xf9, 0xf3, 0xe7, 0x8f, 0xff, 0xc3, 0x99, 0xf9, 0xf3, 0xe7, 0xff, 0xe7, 0xff, 
-0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe7, 0xc3, 0x99, 0x81, 0x99, 0x99, 0x99, 0xff, 
-0x83, 0x99, 0x99, 0x83, 0x99, 0x99, 0x83, 0xff, 0xc3, 0x99, 0x9f, 0x9f, 0x9f, 0x99, 0xc3, 0xff, 
-0x87, 0x93, 0x99, 0x99, 0x99, 0x93, 0x87, 0xff, 0x81, 0x9f, 0x9f, 0x87, 0x9f, 0x9f, 0x81, 0xff, 
-0x81, 0x9f, 0x9f, 0x87, 0x9f, 0x9f, 0x9f, 0xff, 0xc3, 0x99, 0x9f, 0x91, 0x99, 0x99, 0xc3, 0xff, 
-0x99, 0x99, 0x99, 0x81, 0x99, 0x99, 0x99, 0xff, 0xc3, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xc3, 0xff, 
-0xe1, 0xf3, 0xf3, 0xf3, 0xf3, 0x93, 0xc7, 0xff, 0x99, 0x93, 0x87, 0x8f, 0x87, 0x93, 0x99, 0xff, 
-0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x81, 0xff, 0x9c, 0x88, 0x80, 0x94, 0x9c, 0x9c, 0x9c, 0xff, 
-0x99, 0x89, 0x81, 0x81, 0x91, 0x99, 0x99, 0xff, 0xc3, 0x99, 0x99, 0x99, 0x99, 0x99, 0xc3, 0xff, 
-0x83, 0x99, 0x99, 0x83, 0x9f, 0x9f, 0x9f, 0xff, 0xc3, 0x99, 0x99, 0x99, 0x99, 0xc3, 0xf1, 0xff, 
-0x83, 0x99, 0x99, 0x83, 0x87, 0x93, 0x99, 0xff, 0xc3, 0x99, 0x9f, 0xc3, 0xf9, 0x99, 0xc3, 0xff, 
-0x81, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xff, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xc3, 0xff, 
-0x99, 0x99, 0x99, 0x99, 0x99, 0xc3, 0xe7, 0xff, 0x9c, 0x9c, 0x9c, 0x94, 0x80, 0x88, 0x9c, 0xff, 
-0x99, 0x99, 0xc3, 0xe7, 0xc3, 0x99, 0x99, 0xff, 0x99, 0x99, 0x99, 0xc3, 0xe7, 0xe7, 0xe7, 0xff, 
-0x81, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x81, 0xff, 0xe7, 0xe7, 0xe7, 0x0, 0x0, 0xe7, 0xe7, 0xe7, 
-0x3f, 0x3f, 0xcf, 0xcf, 0x3f, 0x3f, 0xcf, 0xcf, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 
-0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc, 0x33, 0x33, 0xcc, 0x66, 0x33, 0x99, 0xcc, 0x66, 0x33, 0x99, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 
-0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 
-0x33, 0x33, 0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 
-0xff, 0xff, 0xff, 0xff, 0x33, 0x33, 0xcc, 0xcc, 0x33, 0x66, 0xcc, 0x99, 0x33, 0x66, 0xcc, 0x99, 
-0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xe7, 0xe7, 0xe7, 0xe0, 0xe0, 0xe7, 0xe7, 0xe7, 
-0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xe7, 0xe7, 0xe7, 0xe0, 0xe0, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x7, 0x7, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 
-0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0x0, 0x0, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x0, 0x0, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0x7, 0x7, 0xe7, 0xe7, 0xe7, 
-0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 
-0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 
-0xfe, 0xfc, 0xf9, 0x93, 0x87, 0x8f, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xf, 0xf, 0xf, 
-0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xe7, 0x7, 0x7, 0xff, 0xff, 0xff, 
-0xf, 0xf, 0xf, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf, 0xf, 0xf, 0xf, 0xf0, 0xf0, 0xf0, 0xf0, 
-
-};
-unsigned char dump_c64_kernalv3[8192] = {
-0x85, 0x56, 0x20, 0xf, 0xbc, 0xa5, 0x61, 0xc9, 0x88, 0x90, 0x3, 0x20, 0xd4, 0xba, 0x20, 0xcc, 
-0xbc, 0xa5, 0x7, 0x18, 0x69, 0x81, 0xf0, 0xf3, 0x38, 0xe9, 0x1, 0x48, 0xa2, 0x5, 0xb5, 0x69, 
-0xb4, 0x61, 0x95, 0x61, 0x94, 0x69, 0xca, 0x10, 0xf5, 0xa5, 0x56, 0x85, 0x70, 0x20, 0x53, 0xb8, 
-0x20, 0xb4, 0xbf, 0xa9, 0xc4, 0xa0, 0xbf, 0x20, 0x59, 0xe0, 0xa9, 0x0, 0x85, 0x6f, 0x68, 0x20, 
-0xb9, 0xba, 0x60, 0x85, 0x71, 0x84, 0x72, 0x20, 0xca, 0xbb, 0xa9, 0x57, 0x20, 0x28, 0xba, 0x20, 
-0x5d, 0xe0, 0xa9, 0x57, 0xa0, 0x0, 0x4c, 0x28, 0xba, 0x85, 0x71, 0x84, 0x72, 0x20, 0xc7, 0xbb, 
-0xb1, 0x71, 0x85, 0x67, 0xa4, 0x71, 0xc8, 0x98, 0xd0, 0x2, 0xe6, 0x72, 0x85, 0x71, 0xa4, 0x72, 
-0x20, 0x28, 0xba, 0xa5, 0x71, 0xa4, 0x72, 0x18, 0x69, 0x5, 0x90, 0x1, 0xc8, 0x85, 0x71, 0x84, 
-0x72, 0x20, 0x67, 0xb8, 0xa9, 0x5c, 0xa0, 0x0, 0xc6, 0x67, 0xd0, 0xe4, 0x60, 0x98, 0x35, 0x44, 
-0x7a, 0x0, 0x68, 0x28, 0xb1, 0x46, 0x0, 0x20, 0x2b, 0xbc, 0x30, 0x37, 0xd0, 0x20, 0x20, 0xf3, 
-0xff, 0x86, 0x22, 0x84, 0x23, 0xa0, 0x4, 0xb1, 0x22, 0x85, 0x62, 0xc8, 0xb1, 0x22, 0x85, 0x64, 
-0xa0, 0x8, 0xb1, 0x22, 0x85, 0x63, 0xc8, 0xb1, 0x22, 0x85, 0x65, 0x4c, 0xe3, 0xe0, 0xa9, 0x8b, 
-0xa0, 0x0, 0x20, 0xa2, 0xbb, 0xa9, 0x8d, 0xa0, 0xe0, 0x20, 0x28, 0xba, 0xa9, 0x92, 0xa0, 0xe0, 
-0x20, 0x67, 0xb8, 0xa6, 0x65, 0xa5, 0x62, 0x85, 0x65, 0x86, 0x62, 0xa6, 0x63, 0xa5, 0x64, 0x85, 
-0x63, 0x86, 0x64, 0xa9, 0x0, 0x85, 0x66, 0xa5, 0x61, 0x85, 0x70, 0xa9, 0x80, 0x85, 0x61, 0x20, 
-0xd7, 0xb8, 0xa2, 0x8b, 0xa0, 0x0, 0x4c, 0xd4, 0xbb, 0xc9, 0xf0, 0xd0, 0x7, 0x84, 0x38, 0x86, 
-0x37, 0x4c, 0x63, 0xa6, 0xaa, 0xd0, 0x2, 0xa2, 0x1e, 0x4c, 0x37, 0xa4, 0x20, 0xd2, 0xff, 0xb0, 
-0xe8, 0x60, 0x20, 0xcf, 0xff, 0xb0, 0xe2, 0x60, 0x20, 0xad, 0xe4, 0xb0, 0xdc, 0x60, 0x20, 0xc6, 
-0xff, 0xb0, 0xd6, 0x60, 0x20, 0xe4, 0xff, 0xb0, 0xd0, 0x60, 0x20, 0x8a, 0xad, 0x20, 0xf7, 0xb7, 
-0xa9, 0xe1, 0x48, 0xa9, 0x46, 0x48, 0xad, 0xf, 0x3, 0x48, 0xad, 0xc, 0x3, 0xae, 0xd, 0x3, 
-0xac, 0xe, 0x3, 0x28, 0x6c, 0x14, 0x0, 0x8, 0x8d, 0xc, 0x3, 0x8e, 0xd, 0x3, 0x8c, 0xe, 
-0x3, 0x68, 0x8d, 0xf, 0x3, 0x60, 0x20, 0xd4, 0xe1, 0xa6, 0x2d, 0xa4, 0x2e, 0xa9, 0x2b, 0x20, 
-0xd8, 0xff, 0xb0, 0x95, 0x60, 0xa9, 0x1, 0x2c, 0xa9, 0x0, 0x85, 0xa, 0x20, 0xd4, 0xe1, 0xa5, 
-0xa, 0xa6, 0x2b, 0xa4, 0x2c, 0x20, 0xd5, 0xff, 0xb0, 0x57, 0xa5, 0xa, 0xf0, 0x17, 0xa2, 0x1c, 
-0x20, 0xb7, 0xff, 0x29, 0x10, 0xd0, 0x17, 0xa5, 0x7a, 0xc9, 0x2, 0xf0, 0x7, 0xa9, 0x64, 0xa0, 
-0xa3, 0x4c, 0x1e, 0xab, 0x60, 0x20, 0xb7, 0xff, 0x29, 0xbf, 0xf0, 0x5, 0xa2, 0x1d, 0x4c, 0x37, 
-0xa4, 0xa5, 0x7b, 0xc9, 0x2, 0xd0, 0xe, 0x86, 0x2d, 0x84, 0x2e, 0xa9, 0x76, 0xa0, 0xa3, 0x20, 
-0x1e, 0xab, 0x4c, 0x2a, 0xa5, 0x20, 0x8e, 0xa6, 0x20, 0x33, 0xa5, 0x4c, 0x77, 0xa6, 0x20, 0x19, 
-0xe2, 0x20, 0xc0, 0xff, 0xb0, 0xb, 0x60, 0x20, 0x19, 0xe2, 0xa5, 0x49, 0x20, 0xc3, 0xff, 0x90, 
-0xc3, 0x4c, 0xf9, 0xe0, 0xa9, 0x0, 0x20, 0xbd, 0xff, 0xa2, 0x1, 0xa0, 0x0, 0x20, 0xba, 0xff, 
-0x20, 0x6, 0xe2, 0x20, 0x57, 0xe2, 0x20, 0x6, 0xe2, 0x20, 0x0, 0xe2, 0xa0, 0x0, 0x86, 0x49, 
-0x20, 0xba, 0xff, 0x20, 0x6, 0xe2, 0x20, 0x0, 0xe2, 0x8a, 0xa8, 0xa6, 0x49, 0x4c, 0xba, 0xff, 
-0x20, 0xe, 0xe2, 0x4c, 0x9e, 0xb7, 0x20, 0x79, 0x0, 0xd0, 0x2, 0x68, 0x68, 0x60, 0x20, 0xfd, 
-0xae, 0x20, 0x79, 0x0, 0xd0, 0xf7, 0x4c, 0x8, 0xaf, 0xa9, 0x0, 0x20, 0xbd, 0xff, 0x20, 0x11, 
-0xe2, 0x20, 0x9e, 0xb7, 0x86, 0x49, 0x8a, 0xa2, 0x1, 0xa0, 0x0, 0x20, 0xba, 0xff, 0x20, 0x6, 
-0xe2, 0x20, 0x0, 0xe2, 0x86, 0x4a, 0xa0, 0x0, 0xa5, 0x49, 0xe0, 0x3, 0x90, 0x1, 0x88, 0x20, 
-0xba, 0xff, 0x20, 0x6, 0xe2, 0x20, 0x0, 0xe2, 0x8a, 0xa8, 0xa6, 0x4a, 0xa5, 0x49, 0x20, 0xba, 
-0xff, 0x20, 0x6, 0xe2, 0x20, 0xe, 0xe2, 0x20, 0x9e, 0xad, 0x20, 0xa3, 0xb6, 0xa6, 0x22, 0xa4, 
-0x23, 0x4c, 0xbd, 0xff, 0xa9, 0xe0, 0xa0, 0xe2, 0x20, 0x67, 0xb8, 0x20, 0xc, 0xbc, 0xa9, 0xe5, 
-0xa0, 0xe2, 0xa6, 0x6e, 0x20, 0x7, 0xbb, 0x20, 0xc, 0xbc, 0x20, 0xcc, 0xbc, 0xa9, 0x0, 0x85, 
-0x6f, 0x20, 0x53, 0xb8, 0xa9, 0xea, 0xa0, 0xe2, 0x20, 0x50, 0xb8, 0xa5, 0x66, 0x48, 0x10, 0xd, 
-0x20, 0x49, 0xb8, 0xa5, 0x66, 0x30, 0x9, 0xa5, 0x12, 0x49, 0xff, 0x85, 0x12, 0x20, 0xb4, 0xbf, 
-0xa9, 0xea, 0xa0, 0xe2, 0x20, 0x67, 0xb8, 0x68, 0x10, 0x3, 0x20, 0xb4, 0xbf, 0xa9, 0xef, 0xa0, 
-0xe2, 0x4c, 0x43, 0xe0, 0x20, 0xca, 0xbb, 0xa9, 0x0, 0x85, 0x12, 0x20, 0x6b, 0xe2, 0xa2, 0x4e, 
-0xa0, 0x0, 0x20, 0xf6, 0xe0, 0xa9, 0x57, 0xa0, 0x0, 0x20, 0xa2, 0xbb, 0xa9, 0x0, 0x85, 0x66, 
-0xa5, 0x12, 0x20, 0xdc, 0xe2, 0xa9, 0x4e, 0xa0, 0x0, 0x4c, 0xf, 0xbb, 0x48, 0x4c, 0x9d, 0xe2, 
-0x81, 0x49, 0xf, 0xda, 0xa2, 0x83, 0x49, 0xf, 0xda, 0xa2, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x5, 
-0x84, 0xe6, 0x1a, 0x2d, 0x1b, 0x86, 0x28, 0x7, 0xfb, 0xf8, 0x87, 0x99, 0x68, 0x89, 0x1, 0x87, 
-0x23, 0x35, 0xdf, 0xe1, 0x86, 0xa5, 0x5d, 0xe7, 0x28, 0x83, 0x49, 0xf, 0xda, 0xa2, 0xa5, 0x66, 
-0x48, 0x10, 0x3, 0x20, 0xb4, 0xbf, 0xa5, 0x61, 0x48, 0xc9, 0x81, 0x90, 0x7, 0xa9, 0xbc, 0xa0, 
-0xb9, 0x20, 0xf, 0xbb, 0xa9, 0x3e, 0xa0, 0xe3, 0x20, 0x43, 0xe0, 0x68, 0xc9, 0x81, 0x90, 0x7, 
-0xa9, 0xe0, 0xa0, 0xe2, 0x20, 0x50, 0xb8, 0x68, 0x10, 0x3, 0x4c, 0xb4, 0xbf, 0x60, 0xb, 0x76, 
-0xb3, 0x83, 0xbd, 0xd3, 0x79, 0x1e, 0xf4, 0xa6, 0xf5, 0x7b, 0x83, 0xfc, 0xb0, 0x10, 0x7c, 0xc, 
-0x1f, 0x67, 0xca, 0x7c, 0xde, 0x53, 0xcb, 0xc1, 0x7d, 0x14, 0x64, 0x70, 0x4c, 0x7d, 0xb7, 0xea, 
-0x51, 0x7a, 0x7d, 0x63, 0x30, 0x88, 0x7e, 0x7e, 0x92, 0x44, 0x99, 0x3a, 0x7e, 0x4c, 0xcc, 0x91, 
-0xc7, 0x7f, 0xaa, 0xaa, 0xaa, 0x13, 0x81, 0x0, 0x0, 0x0, 0x0, 0x20, 0xcc, 0xff, 0xa9, 0x0, 
-0x85, 0x13, 0x20, 0x7a, 0xa6, 0x58, 0xa2, 0x80, 0x6c, 0x0, 0x3, 0x8a, 0x30, 0x3, 0x4c, 0x3a, 
-0xa4, 0x4c, 0x74, 0xa4, 0x20, 0x53, 0xe4, 0x20, 0xbf, 0xe3, 0x20, 0x22, 0xe4, 0xa2, 0xfb, 0x9a, 
-0xd0, 0xe4, 0xe6, 0x7a, 0xd0, 0x2, 0xe6, 0x7b, 0xad, 0x60, 0xea, 0xc9, 0x3a, 0xb0, 0xa, 0xc9, 
-0x20, 0xf0, 0xef, 0x38, 0xe9, 0x30, 0x38, 0xe9, 0xd0, 0x60, 0x80, 0x4f, 0xc7, 0x52, 0x58, 0xa9, 
-0x4c, 0x85, 0x54, 0x8d, 0x10, 0x3, 0xa9, 0x48, 0xa0, 0xb2, 0x8d, 0x11, 0x3, 0x8c, 0x12, 0x3, 
-0xa9, 0x91, 0xa0, 0xb3, 0x85, 0x5, 0x84, 0x6, 0xa9, 0xaa, 0xa0, 0xb1, 0x85, 0x3, 0x84, 0x4, 
-0xa2, 0x1c, 0xbd, 0xa2, 0xe3, 0x95, 0x73, 0xca, 0x10, 0xf8, 0xa9, 0x3, 0x85, 0x53, 0xa9, 0x0, 
-0x85, 0x68, 0x85, 0x13, 0x85, 0x18, 0xa2, 0x1, 0x8e, 0xfd, 0x1, 0x8e, 0xfc, 0x1, 0xa2, 0x19, 
-0x86, 0x16, 0x38, 0x20, 0x9c, 0xff, 0x86, 0x2b, 0x84, 0x2c, 0x38, 0x20, 0x99, 0xff, 0x86, 0x37, 
-0x84, 0x38, 0x86, 0x33, 0x84, 0x34, 0xa0, 0x0, 0x98, 0x91, 0x2b, 0xe6, 0x2b, 0xd0, 0x2, 0xe6, 
-0x2c, 0x60, 0xa5, 0x2b, 0xa4, 0x2c, 0x20, 0x8, 0xa4, 0xa9, 0x73, 0xa0, 0xe4, 0x20, 0x1e, 0xab, 
-0xa5, 0x37, 0x38, 0xe5, 0x2b, 0xaa, 0xa5, 0x38, 0xe5, 0x2c, 0x20, 0xcd, 0xbd, 0xa9, 0x60, 0xa0, 
-0xe4, 0x20, 0x1e, 0xab, 0x4c, 0x44, 0xa6, 0x8b, 0xe3, 0x83, 0xa4, 0x7c, 0xa5, 0x1a, 0xa7, 0xe4, 
-0xa7, 0x86, 0xae, 0xa2, 0xb, 0xbd, 0x47, 0xe4, 0x9d, 0x0, 0x3, 0xca, 0x10, 0xf7, 0x60, 0x0, 
-0x20, 0x42, 0x41, 0x53, 0x49, 0x43, 0x20, 0x42, 0x59, 0x54, 0x45, 0x53, 0x20, 0x46, 0x52, 0x45, 
-0x45, 0xd, 0x0, 0x93, 0xd, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x43, 0x4f, 
-0x4d, 0x4d, 0x4f, 0x44, 0x4f, 0x52, 0x45, 0x20, 0x36, 0x34, 0x20, 0x42, 0x41, 0x53, 0x49, 0x43, 
-0x20, 0x56, 0x32, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0xd, 0xd, 0x20, 0x36, 0x34, 0x4b, 0x20, 0x52, 
-0x41, 0x4d, 0x20, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4d, 0x20, 0x20, 0x0, 0x81, 0x48, 0x20, 0xc9, 
-0xff, 0xaa, 0x68, 0x90, 0x1, 0x8a, 0x60, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-0xaa, 0xaa, 0xaa, 0x85, 0xa9, 0xa9, 0x1, 0x85, 0xab, 0x60, 0xad, 0x86, 0x2, 0x91, 0xf3, 0x60, 
-0x69, 0x2, 0xa4, 0x91, 0xc8, 0xd0, 0x4, 0xc5, 0xa1, 0xd0, 0xf7, 0x60, 0x19, 0x26, 0x44, 0x19, 
-0x1a, 0x11, 0xe8, 0xd, 0x70, 0xc, 0x6, 0x6, 0xd1, 0x2, 0x37, 0x1, 0xae, 0x0, 0x69, 0x0, 
-0xa2, 0x0, 0xa0, 0xdc, 0x60, 0xa2, 0x28, 0xa0, 0x19, 0x60, 0xb0, 0x7, 0x86, 0xd6, 0x84, 0xd3, 
-0x20, 0x6c, 0xe5, 0xa6, 0xd6, 0xa4, 0xd3, 0x60, 0x20, 0xa0, 0xe5, 0xa9, 0x0, 0x8d, 0x91, 0x2, 
-0x85, 0xcf, 0xa9, 0x48, 0x8d, 0x8f, 0x2, 0xa9, 0xeb, 0x8d, 0x90, 0x2, 0xa9, 0xa, 0x8d, 0x89, 
-0x2, 0x8d, 0x8c, 0x2, 0xa9, 0xe, 0x8d, 0x86, 0x2, 0xa9, 0x4, 0x8d, 0x8b, 0x2, 0xa9, 0xc, 
-0x85, 0xcd, 0x85, 0xcc, 0xad, 0x88, 0x2, 0x9, 0x80, 0xa8, 0xa9, 0x0, 0xaa, 0x94, 0xd9, 0x18, 
-0x69, 0x28, 0x90, 0x1, 0xc8, 0xe8, 0xe0, 0x1a, 0xd0, 0xf3, 0xa9, 0xff, 0x95, 0xd9, 0xa2, 0x18, 
-0x20, 0xff, 0xe9, 0xca, 0x10, 0xfa, 0xa0, 0x0, 0x84, 0xd3, 0x84, 0xd6, 0xa6, 0xd6, 0xa5, 0xd3, 
-0xb4, 0xd9, 0x30, 0x8, 0x18, 0x69, 0x28, 0x85, 0xd3, 0xca, 0x10, 0xf4, 0x20, 0xf0, 0xe9, 0xa9, 
-0x27, 0xe8, 0xb4, 0xd9, 0x30, 0x6, 0x18, 0x69, 0x28, 0xe8, 0x10, 0xf6, 0x85, 0xd5, 0x4c, 0x24, 
-0xea, 0xe4, 0xc9, 0xf0, 0x3, 0x4c, 0xed, 0xe6, 0x60, 0xea, 0x20, 0xa0, 0xe5, 0x4c, 0x66, 0xe5, 
-0xa9, 0x3, 0x85, 0x9a, 0xa9, 0x0, 0x85, 0x99, 0xa2, 0x2f, 0xbd, 0xb8, 0xec, 0x9d, 0xff, 0xcf, 
-0xca, 0xd0, 0xf7, 0x60, 0xac, 0x77, 0x2, 0xa2, 0x0, 0xbd, 0x78, 0x2, 0x9d, 0x77, 0x2, 0xe8, 
-0xe4, 0xc6, 0xd0, 0xf5, 0xc6, 0xc6, 0x98, 0x58, 0x18, 0x60, 0x20, 0x16, 0xe7, 0xa5, 0xc6, 0x85, 
-0xcc, 0x8d, 0x92, 0x2, 0xf0, 0xf7, 0x78, 0xa5, 0xcf, 0xf0, 0xc, 0xa5, 0xce, 0xae, 0x87, 0x2, 
-0xa0, 0x0, 0x84, 0xcf, 0x20, 0x13, 0xea, 0x20, 0xb4, 0xe5, 0xc9, 0x83, 0xd0, 0x10, 0xa2, 0x9, 
-0x78, 0x86, 0xc6, 0xbd, 0xe6, 0xec, 0x9d, 0x76, 0x2, 0xca, 0xd0, 0xf7, 0xf0, 0xcf, 0xc9, 0xd, 
-0xd0, 0xc8, 0xa4, 0xd5, 0x84, 0xd0, 0xb1, 0xd1, 0xc9, 0x20, 0xd0, 0x3, 0x88, 0xd0, 0xf7, 0xc8, 
-0x84, 0xc8, 0xa0, 0x0, 0x8c, 0x92, 0x2, 0x84, 0xd3, 0x84, 0xd4, 0xa5, 0xc9, 0x30, 0x1b, 0xa6, 
-0xd6, 0x20, 0x91, 0xe5, 0xe4, 0xc9, 0xd0, 0x12, 0xa5, 0xca, 0x85, 0xd3, 0xc5, 0xc8, 0x90, 0xa, 
-0xb0, 0x2b, 0x98, 0x48, 0x8a, 0x48, 0xa5, 0xd0, 0xf0, 0x93, 0xa4, 0xd3, 0xb1, 0xd1, 0x85, 0xd7, 
-0x29, 0x3f, 0x6, 0xd7, 0x24, 0xd7, 0x10, 0x2, 0x9, 0x80, 0x90, 0x4, 0xa6, 0xd4, 0xd0, 0x4, 
-0x70, 0x2, 0x9, 0x40, 0xe6, 0xd3, 0x20, 0x84, 0xe6, 0xc4, 0xc8, 0xd0, 0x17, 0xa9, 0x0, 0x85, 
-0xd0, 0xa9, 0xd, 0xa6, 0x99, 0xe0, 0x3, 0xf0, 0x6, 0xa6, 0x9a, 0xe0, 0x3, 0xf0, 0x3, 0x20, 
-0x16, 0xe7, 0xa9, 0xd, 0x85, 0xd7, 0x68, 0xaa, 0x68, 0xa8, 0xa5, 0xd7, 0xc9, 0xde, 0xd0, 0x2, 
-0xa9, 0xff, 0x18, 0x60, 0xc9, 0x22, 0xd0, 0x8, 0xa5, 0xd4, 0x49, 0x1, 0x85, 0xd4, 0xa9, 0x22, 
-0x60, 0x9, 0x40, 0xa6, 0xc7, 0xf0, 0x2, 0x9, 0x80, 0xa6, 0xd8, 0xf0, 0x2, 0xc6, 0xd8, 0xae, 
-0x86, 0x2, 0x20, 0x13, 0xea, 0x20, 0xb6, 0xe6, 0x68, 0xa8, 0xa5, 0xd8, 0xf0, 0x2, 0x46, 0xd4, 
-0x68, 0xaa, 0x68, 0x18, 0x58, 0x60, 0x20, 0xb3, 0xe8, 0xe6, 0xd3, 0xa5, 0xd5, 0xc5, 0xd3, 0xb0, 
-0x3f, 0xc9, 0x4f, 0xf0, 0x32, 0xad, 0x92, 0x2, 0xf0, 0x3, 0x4c, 0x67, 0xe9, 0xa6, 0xd6, 0xe0, 
-0x19, 0x90, 0x7, 0x20, 0xea, 0xe8, 0xc6, 0xd6, 0xa6, 0xd6, 0x16, 0xd9, 0x56, 0xd9, 0xe8, 0xb5, 
-0xd9, 0x9, 0x80, 0x95, 0xd9, 0xca, 0xa5, 0xd5, 0x18, 0x69, 0x28, 0x85, 0xd5, 0xb5, 0xd9, 0x30, 
-0x3, 0xca, 0xd0, 0xf9, 0x4c, 0xf0, 0xe9, 0xc6, 0xd6, 0x20, 0x7c, 0xe8, 0xa9, 0x0, 0x85, 0xd3, 
-0x60, 0xa6, 0xd6, 0xd0, 0x6, 0x86, 0xd3, 0x68, 0x68, 0xd0, 0x9d, 0xca, 0x86, 0xd6, 0x20, 0x6c, 
-0xe5, 0xa4, 0xd5, 0x84, 0xd3, 0x60, 0x48, 0x85, 0xd7, 0x8a, 0x48, 0x98, 0x48, 0xa9, 0x0, 0x85, 
-0xd0, 0xa4, 0xd3, 0xa5, 0xd7, 0x10, 0x3, 0x4c, 0xd4, 0xe7, 0xc9, 0xd, 0xd0, 0x3, 0x4c, 0x91, 
-0xe8, 0xc9, 0x20, 0x90, 0x10, 0xc9, 0x60, 0x90, 0x4, 0x29, 0xdf, 0xd0, 0x2, 0x29, 0x3f, 0x20, 
-0x84, 0xe6, 0x4c, 0x93, 0xe6, 0xa6, 0xd8, 0xf0, 0x3, 0x4c, 0x97, 0xe6, 0xc9, 0x14, 0xd0, 0x2e, 
-0x98, 0xd0, 0x6, 0x20, 0x1, 0xe7, 0x4c, 0x73, 0xe7, 0x20, 0xa1, 0xe8, 0x88, 0x84, 0xd3, 0x20, 
-0x24, 0xea, 0xc8, 0xb1, 0xd1, 0x88, 0x91, 0xd1, 0xc8, 0xb1, 0xf3, 0x88, 0x91, 0xf3, 0xc8, 0xc4, 
-0xd5, 0xd0, 0xef, 0xa9, 0x20, 0x91, 0xd1, 0xad, 0x86, 0x2, 0x91, 0xf3, 0x10, 0x4d, 0xa6, 0xd4, 
-0xf0, 0x3, 0x4c, 0x97, 0xe6, 0xc9, 0x12, 0xd0, 0x2, 0x85, 0xc7, 0xc9, 0x13, 0xd0, 0x3, 0x20, 
-0x66, 0xe5, 0xc9, 0x1d, 0xd0, 0x17, 0xc8, 0x20, 0xb3, 0xe8, 0x84, 0xd3, 0x88, 0xc4, 0xd5, 0x90, 
-0x9, 0xc6, 0xd6, 0x20, 0x7c, 0xe8, 0xa0, 0x0, 0x84, 0xd3, 0x4c, 0xa8, 0xe6, 0xc9, 0x11, 0xd0, 
-0x1d, 0x18, 0x98, 0x69, 0x28, 0xa8, 0xe6, 0xd6, 0xc5, 0xd5, 0x90, 0xec, 0xf0, 0xea, 0xc6, 0xd6, 
-0xe9, 0x28, 0x90, 0x4, 0x85, 0xd3, 0xd0, 0xf8, 0x20, 0x7c, 0xe8, 0x4c, 0xa8, 0xe6, 0x20, 0xcb, 
-0xe8, 0x4c, 0x44, 0xec, 0x29, 0x7f, 0xc9, 0x7f, 0xd0, 0x2, 0xa9, 0x5e, 0xc9, 0x20, 0x90, 0x3, 
-0x4c, 0x91, 0xe6, 0xc9, 0xd, 0xd0, 0x3, 0x4c, 0x91, 0xe8, 0xa6, 0xd4, 0xd0, 0x3f, 0xc9, 0x14, 
-0xd0, 0x37, 0xa4, 0xd5, 0xb1, 0xd1, 0xc9, 0x20, 0xd0, 0x4, 0xc4, 0xd3, 0xd0, 0x7, 0xc0, 0x4f, 
-0xf0, 0x24, 0x20, 0x65, 0xe9, 0xa4, 0xd5, 0x20, 0x24, 0xea, 0x88, 0xb1, 0xd1, 0xc8, 0x91, 0xd1, 
-0x88, 0xb1, 0xf3, 0xc8, 0x91, 0xf3, 0x88, 0xc4, 0xd3, 0xd0, 0xef, 0xa9, 0x20, 0x91, 0xd1, 0xad, 
-0x86, 0x2, 0x91, 0xf3, 0xe6, 0xd8, 0x4c, 0xa8, 0xe6, 0xa6, 0xd8, 0xf0, 0x5, 0x9, 0x40, 0x4c, 
-0x97, 0xe6, 0xc9, 0x11, 0xd0, 0x16, 0xa6, 0xd6, 0xf0, 0x37, 0xc6, 0xd6, 0xa5, 0xd3, 0x38, 0xe9, 
-0x28, 0x90, 0x4, 0x85, 0xd3, 0x10, 0x2a, 0x20, 0x6c, 0xe5, 0xd0, 0x25, 0xc9, 0x12, 0xd0, 0x4, 
-0xa9, 0x0, 0x85, 0xc7, 0xc9, 0x1d, 0xd0, 0x12, 0x98, 0xf0, 0x9, 0x20, 0xa1, 0xe8, 0x88, 0x84, 
-0xd3, 0x4c, 0xa8, 0xe6, 0x20, 0x1, 0xe7, 0x4c, 0xa8, 0xe6, 0xc9, 0x13, 0xd0, 0x6, 0x20, 0x44, 
-0xe5, 0x4c, 0xa8, 0xe6, 0x9, 0x80, 0x20, 0xcb, 0xe8, 0x4c, 0x4f, 0xec, 0x46, 0xc9, 0xa6, 0xd6, 
-0xe8, 0xe0, 0x19, 0xd0, 0x3, 0x20, 0xea, 0xe8, 0xb5, 0xd9, 0x10, 0xf4, 0x86, 0xd6, 0x4c, 0x6c, 
-0xe5, 0xa2, 0x0, 0x86, 0xd8, 0x86, 0xc7, 0x86, 0xd4, 0x86, 0xd3, 0x20, 0x7c, 0xe8, 0x4c, 0xa8, 
-0xe6, 0xa2, 0x2, 0xa9, 0x0, 0xc5, 0xd3, 0xf0, 0x7, 0x18, 0x69, 0x28, 0xca, 0xd0, 0xf6, 0x60, 
-0xc6, 0xd6, 0x60, 0xa2, 0x2, 0xa9, 0x27, 0xc5, 0xd3, 0xf0, 0x7, 0x18, 0x69, 0x28, 0xca, 0xd0, 
-0xf6, 0x60, 0xa6, 0xd6, 0xe0, 0x19, 0xf0, 0x2, 0xe6, 0xd6, 0x60, 0xa2, 0xf, 0xdd, 0xda, 0xe8, 
-0xf0, 0x4, 0xca, 0x10, 0xf8, 0x60, 0x8e, 0x86, 0x2, 0x60, 0x90, 0x5, 0x1c, 0x9f, 0x9c, 0x1e, 
-0x1f, 0x9e, 0x81, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0xa5, 0xac, 0x48, 0xa5, 0xad, 0x48, 
-0xa5, 0xae, 0x48, 0xa5, 0xaf, 0x48, 0xa2, 0xff, 0xc6, 0xd6, 0xc6, 0xc9, 0xce, 0xa5, 0x2, 0xe8, 
-0x20, 0xf0, 0xe9, 0xe0, 0x18, 0xb0, 0xc, 0xbd, 0xf1, 0xec, 0x85, 0xac, 0xb5, 0xda, 0x20, 0xc8, 
-0xe9, 0x30, 0xec, 0x20, 0xff, 0xe9, 0xa2, 0x0, 0xb5, 0xd9, 0x29, 0x7f, 0xb4, 0xda, 0x10, 0x2, 
-0x9, 0x80, 0x95, 0xd9, 0xe8, 0xe0, 0x18, 0xd0, 0xef, 0xa5, 0xf1, 0x9, 0x80, 0x85, 0xf1, 0xa5, 
-0xd9, 0x10, 0xc3, 0xe6, 0xd6, 0xee, 0xa5, 0x2, 0xa9, 0x7f, 0x8d, 0x0, 0xdc, 0xad, 0x1, 0xdc, 
-0xc9, 0xfb, 0x8, 0xa9, 0x7f, 0x8d, 0x0, 0xdc, 0x28, 0xd0, 0xb, 0xa0, 0x0, 0xea, 0xca, 0xd0, 
-0xfc, 0x88, 0xd0, 0xf9, 0x84, 0xc6, 0xa6, 0xd6, 0x68, 0x85, 0xaf, 0x68, 0x85, 0xae, 0x68, 0x85, 
-0xad, 0x68, 0x85, 0xac, 0x60, 0xa6, 0xd6, 0xe8, 0xb5, 0xd9, 0x10, 0xfb, 0x8e, 0xa5, 0x2, 0xe0, 
-0x18, 0xf0, 0xe, 0x90, 0xc, 0x20, 0xea, 0xe8, 0xae, 0xa5, 0x2, 0xca, 0xc6, 0xd6, 0x4c, 0xda, 
-0xe6, 0xa5, 0xac, 0x48, 0xa5, 0xad, 0x48, 0xa5, 0xae, 0x48, 0xa5, 0xaf, 0x48, 0xa2, 0x19, 0xca, 
-0x20, 0xf0, 0xe9, 0xec, 0xa5, 0x2, 0x90, 0xe, 0xf0, 0xc, 0xbd, 0xef, 0xec, 0x85, 0xac, 0xb5, 
-0xd8, 0x20, 0xc8, 0xe9, 0x30, 0xe9, 0x20, 0xff, 0xe9, 0xa2, 0x17, 0xec, 0xa5, 0x2, 0x90, 0xf, 
-0xb5, 0xda, 0x29, 0x7f, 0xb4, 0xd9, 0x10, 0x2, 0x9, 0x80, 0x95, 0xda, 0xca, 0xd0, 0xec, 0xae, 
-0xa5, 0x2, 0x20, 0xda, 0xe6, 0x4c, 0x58, 0xe9, 0x29, 0x3, 0xd, 0x88, 0x2, 0x85, 0xad, 0x20, 
-0xe0, 0xe9, 0xa0, 0x27, 0xb1, 0xac, 0x91, 0xd1, 0xb1, 0xae, 0x91, 0xf3, 0x88, 0x10, 0xf5, 0x60, 
-0x20, 0x24, 0xea, 0xa5, 0xac, 0x85, 0xae, 0xa5, 0xad, 0x29, 0x3, 0x9, 0xd8, 0x85, 0xaf, 0x60, 
-0xbd, 0xf0, 0xec, 0x85, 0xd1, 0xb5, 0xd9, 0x29, 0x3, 0xd, 0x88, 0x2, 0x85, 0xd2, 0x60, 0xa0, 
-0x27, 0x20, 0xf0, 0xe9, 0x20, 0x24, 0xea, 0x20, 0xda, 0xe4, 0xa9, 0x20, 0x91, 0xd1, 0x88, 0x10, 
-0xf6, 0x60, 0xea, 0xa8, 0xa9, 0x2, 0x85, 0xcd, 0x20, 0x24, 0xea, 0x98, 0xa4, 0xd3, 0x91, 0xd1, 
-0x8a, 0x91, 0xf3, 0x60, 0xa5, 0xd1, 0x85, 0xf3, 0xa5, 0xd2, 0x29, 0x3, 0x9, 0xd8, 0x85, 0xf4, 
-0x60, 0x20, 0xea, 0xff, 0xa5, 0xcc, 0xd0, 0x29, 0xc6, 0xcd, 0xd0, 0x25, 0xa9, 0x14, 0x85, 0xcd, 
-0xa4, 0xd3, 0x46, 0xcf, 0xae, 0x87, 0x2, 0xb1, 0xd1, 0xb0, 0x11, 0xe6, 0xcf, 0x85, 0xce, 0x20, 
-0x24, 0xea, 0xb1, 0xf3, 0x8d, 0x87, 0x2, 0xae, 0x86, 0x2, 0xa5, 0xce, 0x49, 0x80, 0x20, 0x1c, 
-0xea, 0xa5, 0x1, 0x29, 0x10, 0xf0, 0xa, 0xa0, 0x0, 0x84, 0xc0, 0xa5, 0x1, 0x9, 0x20, 0xd0, 
-0x8, 0xa5, 0xc0, 0xd0, 0x6, 0xa5, 0x1, 0x29, 0x1f, 0x85, 0x1, 0x20, 0x87, 0xea, 0xad, 0xd, 
-0xdc, 0x68, 0xa8, 0x68, 0xaa, 0x68, 0x40, 0xa9, 0x0, 0x8d, 0x8d, 0x2, 0xa0, 0x40, 0x84, 0xcb, 
-0x8d, 0x0, 0xdc, 0xae, 0x1, 0xdc, 0xe0, 0xff, 0xf0, 0x61, 0xa8, 0xa9, 0x81, 0x85, 0xf5, 0xa9, 
-0xeb, 0x85, 0xf6, 0xa9, 0xfe, 0x8d, 0x0, 0xdc, 0xa2, 0x8, 0x48, 0xad, 0x1, 0xdc, 0xcd, 0x1, 
-0xdc, 0xd0, 0xf8, 0x4a, 0xb0, 0x16, 0x48, 0xb1, 0xf5, 0xc9, 0x5, 0xb0, 0xc, 0xc9, 0x3, 0xf0, 
-0x8, 0xd, 0x8d, 0x2, 0x8d, 0x8d, 0x2, 0x10, 0x2, 0x84, 0xcb, 0x68, 0xc8, 0xc0, 0x41, 0xb0, 
-0xb, 0xca, 0xd0, 0xdf, 0x38, 0x68, 0x2a, 0x8d, 0x0, 0xdc, 0xd0, 0xcc, 0x68, 0x6c, 0x8f, 0x2, 
-0xa4, 0xcb, 0xb1, 0xf5, 0xaa, 0xc4, 0xc5, 0xf0, 0x7, 0xa0, 0x10, 0x8c, 0x8c, 0x2, 0xd0, 0x36, 
-0x29, 0x7f, 0x2c, 0x8a, 0x2, 0x30, 0x16, 0x70, 0x49, 0xc9, 0x7f, 0xf0, 0x29, 0xc9, 0x14, 0xf0, 
-0xc, 0xc9, 0x20, 0xf0, 0x8, 0xc9, 0x1d, 0xf0, 0x4, 0xc9, 0x11, 0xd0, 0x35, 0xac, 0x8c, 0x2, 
-0xf0, 0x5, 0xce, 0x8c, 0x2, 0xd0, 0x2b, 0xce, 0x8b, 0x2, 0xd0, 0x26, 0xa0, 0x4, 0x8c, 0x8b, 
-0x2, 0xa4, 0xc6, 0x88, 0x10, 0x1c, 0xa4, 0xcb, 0x84, 0xc5, 0xac, 0x8d, 0x2, 0x8c, 0x8e, 0x2, 
-0xe0, 0xff, 0xf0, 0xe, 0x8a, 0xa6, 0xc6, 0xec, 0x89, 0x2, 0xb0, 0x6, 0x9d, 0x77, 0x2, 0xe8, 
-0x86, 0xc6, 0xa9, 0x7f, 0x8d, 0x0, 0xdc, 0x60, 0xad, 0x8d, 0x2, 0xc9, 0x3, 0xd0, 0x15, 0xcd, 
-0x8e, 0x2, 0xf0, 0xee, 0xad, 0x91, 0x2, 0x30, 0x1d, 0xad, 0x18, 0xd0, 0x49, 0x2, 0x8d, 0x18, 
-0xd0, 0x4c, 0x76, 0xeb, 0xa, 0xc9, 0x8, 0x90, 0x2, 0xa9, 0x6, 0xaa, 0xbd, 0x79, 0xeb, 0x85, 
-0xf5, 0xbd, 0x7a, 0xeb, 0x85, 0xf6, 0x4c, 0xe0, 0xea, 0x81, 0xeb, 0xc2, 0xeb, 0x3, 0xec, 0x78, 
-0xec, 0x14, 0xd, 0x1d, 0x88, 0x85, 0x86, 0x87, 0x11, 0x33, 0x57, 0x41, 0x34, 0x5a, 0x53, 0x45, 
-0x1, 0x35, 0x52, 0x44, 0x36, 0x43, 0x46, 0x54, 0x58, 0x37, 0x59, 0x47, 0x38, 0x42, 0x48, 0x55, 
-0x56, 0x39, 0x49, 0x4a, 0x30, 0x4d, 0x4b, 0x4f, 0x4e, 0x2b, 0x50, 0x4c, 0x2d, 0x2e, 0x3a, 0x40, 
-0x2c, 0x5c, 0x2a, 0x3b, 0x13, 0x1, 0x3d, 0x5e, 0x2f, 0x31, 0x5f, 0x4, 0x32, 0x20, 0x2, 0x51, 
-0x3, 0xff, 0x94, 0x8d, 0x9d, 0x8c, 0x89, 0x8a, 0x8b, 0x91, 0x23, 0xd7, 0xc1, 0x24, 0xda, 0xd3, 
-0xc5, 0x1, 0x25, 0xd2, 0xc4, 0x26, 0xc3, 0xc6, 0xd4, 0xd8, 0x27, 0xd9, 0xc7, 0x28, 0xc2, 0xc8, 
-0xd5, 0xd6, 0x29, 0xc9, 0xca, 0x30, 0xcd, 0xcb, 0xcf, 0xce, 0xdb, 0xd0, 0xcc, 0xdd, 0x3e, 0x5b, 
-0xba, 0x3c, 0xa9, 0xc0, 0x5d, 0x93, 0x1, 0x3d, 0xde, 0x3f, 0x21, 0x5f, 0x4, 0x22, 0xa0, 0x2, 
-0xd1, 0x83, 0xff, 0x94, 0x8d, 0x9d, 0x8c, 0x89, 0x8a, 0x8b, 0x91, 0x96, 0xb3, 0xb0, 0x97, 0xad, 
-0xae, 0xb1, 0x1, 0x98, 0xb2, 0xac, 0x99, 0xbc, 0xbb, 0xa3, 0xbd, 0x9a, 0xb7, 0xa5, 0x9b, 0xbf, 
-0xb4, 0xb8, 0xbe, 0x29, 0xa2, 0xb5, 0x30, 0xa7, 0xa1, 0xb9, 0xaa, 0xa6, 0xaf, 0xb6, 0xdc, 0x3e, 
-0x5b, 0xa4, 0x3c, 0xa8, 0xdf, 0x5d, 0x93, 0x1, 0x3d, 0xde, 0x3f, 0x81, 0x5f, 0x4, 0x95, 0xa0, 
-0x2, 0xab, 0x83, 0xff, 0xc9, 0xe, 0xd0, 0x7, 0xad, 0x18, 0xd0, 0x9, 0x2, 0xd0, 0x9, 0xc9, 
-0x8e, 0xd0, 0xb, 0xad, 0x18, 0xd0, 0x29, 0xfd, 0x8d, 0x18, 0xd0, 0x4c, 0xa8, 0xe6, 0xc9, 0x8, 
-0xd0, 0x7, 0xa9, 0x80, 0xd, 0x91, 0x2, 0x30, 0x9, 0xc9, 0x9, 0xd0, 0xee, 0xa9, 0x7f, 0x2d, 
-0x91, 0x2, 0x8d, 0x91, 0x2, 0x4c, 0xa8, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x1c, 0x17, 0x1, 0x9f, 0x1a, 0x13, 0x5, 0xff, 0x9c, 0x12, 0x4, 0x1e, 0x3, 0x6, 0x14, 0x18, 
-0x1f, 0x19, 0x7, 0x9e, 0x2, 0x8, 0x15, 0x16, 0x12, 0x9, 0xa, 0x92, 0xd, 0xb, 0xf, 0xe, 
-0xff, 0x10, 0xc, 0xff, 0xff, 0x1b, 0x0, 0xff, 0x1c, 0xff, 0x1d, 0xff, 0xff, 0x1f, 0x1e, 0xff, 
-0x90, 0x6, 0xff, 0x5, 0xff, 0xff, 0x11, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9b, 0x37, 0x0, 0x0, 0x0, 0x8, 
-0x0, 0x14, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x6, 0x1, 0x2, 0x3, 0x4, 0x0, 
-0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x4c, 0x4f, 0x41, 0x44, 0xd, 0x52, 0x55, 0x4e, 0xd, 
-0x0, 0x28, 0x50, 0x78, 0xa0, 0xc8, 0xf0, 0x18, 0x40, 0x68, 0x90, 0xb8, 0xe0, 0x8, 0x30, 0x58, 
-0x80, 0xa8, 0xd0, 0xf8, 0x20, 0x48, 0x70, 0x98, 0xc0, 0x9, 0x40, 0x2c, 0x9, 0x20, 0x20, 0xa4, 
-0xf0, 0x48, 0x24, 0x94, 0x10, 0xa, 0x38, 0x66, 0xa3, 0x20, 0x40, 0xed, 0x46, 0x94, 0x46, 0xa3, 
-0x68, 0x85, 0x95, 0x78, 0x20, 0x97, 0xee, 0xc9, 0x3f, 0xd0, 0x3, 0x20, 0x85, 0xee, 0xad, 0x0, 
-0xdd, 0x9, 0x8, 0x8d, 0x0, 0xdd, 0x78, 0x20, 0x8e, 0xee, 0x20, 0x97, 0xee, 0x20, 0xb3, 0xee, 
-0x78, 0x20, 0x97, 0xee, 0x20, 0xa9, 0xee, 0xb0, 0x64, 0x20, 0x85, 0xee, 0x24, 0xa3, 0x10, 0xa, 
-0x20, 0xa9, 0xee, 0x90, 0xfb, 0x20, 0xa9, 0xee, 0xb0, 0xfb, 0x20, 0xa9, 0xee, 0x90, 0xfb, 0x20, 
-0x8e, 0xee, 0xa9, 0x8, 0x85, 0xa5, 0xad, 0x0, 0xdd, 0xcd, 0x0, 0xdd, 0xd0, 0xf8, 0xa, 0x90, 
-0x3f, 0x66, 0x95, 0xb0, 0x5, 0x20, 0xa0, 0xee, 0xd0, 0x3, 0x20, 0x97, 0xee, 0x20, 0x85, 0xee, 
-0xea, 0xea, 0xea, 0xea, 0xad, 0x0, 0xdd, 0x29, 0xdf, 0x9, 0x10, 0x8d, 0x0, 0xdd, 0xc6, 0xa5, 
-0xd0, 0xd4, 0xa9, 0x4, 0x8d, 0x7, 0xdc, 0xa9, 0x19, 0x8d, 0xf, 0xdc, 0xad, 0xd, 0xdc, 0xad, 
-0xd, 0xdc, 0x29, 0x2, 0xd0, 0xa, 0x20, 0xa9, 0xee, 0xb0, 0xf4, 0x58, 0x60, 0xa9, 0x80, 0x2c, 
-0xa9, 0x3, 0x20, 0x1c, 0xfe, 0x58, 0x18, 0x90, 0x4a, 0x85, 0x95, 0x20, 0x36, 0xed, 0xad, 0x0, 
-0xdd, 0x29, 0xf7, 0x8d, 0x0, 0xdd, 0x60, 0x85, 0x95, 0x20, 0x36, 0xed, 0x78, 0x20, 0xa0, 0xee, 
-0x20, 0xbe, 0xed, 0x20, 0x85, 0xee, 0x20, 0xa9, 0xee, 0x30, 0xfb, 0x58, 0x60, 0x24, 0x94, 0x30, 
-0x5, 0x38, 0x66, 0x94, 0xd0, 0x5, 0x48, 0x20, 0x40, 0xed, 0x68, 0x85, 0x95, 0x18, 0x60, 0x78, 
-0x20, 0x8e, 0xee, 0xad, 0x0, 0xdd, 0x9, 0x8, 0x8d, 0x0, 0xdd, 0xa9, 0x5f, 0x2c, 0xa9, 0x3f, 
-0x20, 0x11, 0xed, 0x20, 0xbe, 0xed, 0x8a, 0xa2, 0xa, 0xca, 0xd0, 0xfd, 0xaa, 0x20, 0x85, 0xee, 
-0x4c, 0x97, 0xee, 0x78, 0xa9, 0x0, 0x85, 0xa5, 0x20, 0x85, 0xee, 0x20, 0xa9, 0xee, 0x10, 0xfb, 
-0xa9, 0x1, 0x8d, 0x7, 0xdc, 0xa9, 0x19, 0x8d, 0xf, 0xdc, 0x20, 0x97, 0xee, 0xad, 0xd, 0xdc, 
-0xad, 0xd, 0xdc, 0x29, 0x2, 0xd0, 0x7, 0x20, 0xa9, 0xee, 0x30, 0xf4, 0x10, 0x18, 0xa5, 0xa5, 
-0xf0, 0x5, 0xa9, 0x2, 0x4c, 0xb2, 0xed, 0x20, 0xa0, 0xee, 0x20, 0x85, 0xee, 0xa9, 0x40, 0x20, 
-0x1c, 0xfe, 0xe6, 0xa5, 0xd0, 0xca, 0xa9, 0x8, 0x85, 0xa5, 0xad, 0x0, 0xdd, 0xcd, 0x0, 0xdd, 
-0xd0, 0xf8, 0xa, 0x10, 0xf5, 0x66, 0xa4, 0xad, 0x0, 0xdd, 0xcd, 0x0, 0xdd, 0xd0, 0xf8, 0xa, 
-0x30, 0xf5, 0xc6, 0xa5, 0xd0, 0xe4, 0x20, 0xa0, 0xee, 0x24, 0x90, 0x50, 0x3, 0x20, 0x6, 0xee, 
-0xa5, 0xa4, 0x58, 0x18, 0x60, 0xad, 0x0, 0xdd, 0x29, 0xef, 0x8d, 0x0, 0xdd, 0x60, 0xad, 0x0, 
-0xdd, 0x9, 0x10, 0x8d, 0x0, 0xdd, 0x60, 0xad, 0x0, 0xdd, 0x29, 0xdf, 0x8d, 0x0, 0xdd, 0x60, 
-0xad, 0x0, 0xdd, 0x9, 0x20, 0x8d, 0x0, 0xdd, 0x60, 0xad, 0x0, 0xdd, 0xcd, 0x0, 0xdd, 0xd0, 
-0xf8, 0xa, 0x60, 0x8a, 0xa2, 0xb8, 0xca, 0xd0, 0xfd, 0xaa, 0x60, 0xa5, 0xb4, 0xf0, 0x47, 0x30, 
-0x3f, 0x46, 0xb6, 0xa2, 0x0, 0x90, 0x1, 0xca, 0x8a, 0x45, 0xbd, 0x85, 0xbd, 0xc6, 0xb4, 0xf0, 
-0x6, 0x8a, 0x29, 0x4, 0x85, 0xb5, 0x60, 0xa9, 0x20, 0x2c, 0x94, 0x2, 0xf0, 0x14, 0x30, 0x1c, 
-0x70, 0x14, 0xa5, 0xbd, 0xd0, 0x1, 0xca, 0xc6, 0xb4, 0xad, 0x93, 0x2, 0x10, 0xe3, 0xc6, 0xb4, 
-0xd0, 0xdf, 0xe6, 0xb4, 0xd0, 0xf0, 0xa5, 0xbd, 0xf0, 0xed, 0xd0, 0xea, 0x70, 0xe9, 0x50, 0xe6, 
-0xe6, 0xb4, 0xa2, 0xff, 0xd0, 0xcb, 0xad, 0x94, 0x2, 0x4a, 0x90, 0x7, 0x2c, 0x1, 0xdd, 0x10, 
-0x1d, 0x50, 0x1e, 0xa9, 0x0, 0x85, 0xbd, 0x85, 0xb5, 0xae, 0x98, 0x2, 0x86, 0xb4, 0xac, 0x9d, 
-0x2, 0xcc, 0x9e, 0x2, 0xf0, 0x13, 0xb1, 0xf9, 0x85, 0xb6, 0xee, 0x9d, 0x2, 0x60, 0xa9, 0x40, 
-0x2c, 0xa9, 0x10, 0xd, 0x97, 0x2, 0x8d, 0x97, 0x2, 0xa9, 0x1, 0x8d, 0xd, 0xdd, 0x4d, 0xa1, 
-0x2, 0x9, 0x80, 0x8d, 0xa1, 0x2, 0x8d, 0xd, 0xdd, 0x60, 0xa2, 0x9, 0xa9, 0x20, 0x2c, 0x93, 
-0x2, 0xf0, 0x1, 0xca, 0x50, 0x2, 0xca, 0xca, 0x60, 0xa6, 0xa9, 0xd0, 0x33, 0xc6, 0xa8, 0xf0, 
-0x36, 0x30, 0xd, 0xa5, 0xa7, 0x45, 0xab, 0x85, 0xab, 0x46, 0xa7, 0x66, 0xaa, 0x60, 0xc6, 0xa8, 
-0xa5, 0xa7, 0xf0, 0x67, 0xad, 0x93, 0x2, 0xa, 0xa9, 0x1, 0x65, 0xa8, 0xd0, 0xef, 0xa9, 0x90, 
-0x8d, 0xd, 0xdd, 0xd, 0xa1, 0x2, 0x8d, 0xa1, 0x2, 0x85, 0xa9, 0xa9, 0x2, 0x4c, 0x3b, 0xef, 
-0xa5, 0xa7, 0xd0, 0xea, 0x4c, 0xd3, 0xe4, 0xac, 0x9b, 0x2, 0xc8, 0xcc, 0x9c, 0x2, 0xf0, 0x2a, 
-0x8c, 0x9b, 0x2, 0x88, 0xa5, 0xaa, 0xae, 0x98, 0x2, 0xe0, 0x9, 0xf0, 0x4, 0x4a, 0xe8, 0xd0, 
-0xf8, 0x91, 0xf7, 0xa9, 0x20, 0x2c, 0x94, 0x2, 0xf0, 0xb4, 0x30, 0xb1, 0xa5, 0xa7, 0x45, 0xab, 
-0xf0, 0x3, 0x70, 0xa9, 0x2c, 0x50, 0xa6, 0xa9, 0x1, 0x2c, 0xa9, 0x4, 0x2c, 0xa9, 0x80, 0x2c, 
-0xa9, 0x2, 0xd, 0x97, 0x2, 0x8d, 0x97, 0x2, 0x4c, 0x7e, 0xef, 0xa5, 0xaa, 0xd0, 0xf1, 0xf0, 
-0xec, 0x85, 0x9a, 0xad, 0x94, 0x2, 0x4a, 0x90, 0x29, 0xa9, 0x2, 0x2c, 0x1, 0xdd, 0x10, 0x1d, 
-0xd0, 0x20, 0xad, 0xa1, 0x2, 0x29, 0x2, 0xd0, 0xf9, 0x2c, 0x1, 0xdd, 0x70, 0xfb, 0xad, 0x1, 
-0xdd, 0x9, 0x2, 0x8d, 0x1, 0xdd, 0x2c, 0x1, 0xdd, 0x70, 0x7, 0x30, 0xf9, 0xa9, 0x40, 0x8d, 
-0x97, 0x2, 0x18, 0x60, 0x20, 0x28, 0xf0, 0xac, 0x9e, 0x2, 0xc8, 0xcc, 0x9d, 0x2, 0xf0, 0xf4, 
-0x8c, 0x9e, 0x2, 0x88, 0xa5, 0x9e, 0x91, 0xf9, 0xad, 0xa1, 0x2, 0x4a, 0xb0, 0x1e, 0xa9, 0x10, 
-0x8d, 0xe, 0xdd, 0xad, 0x99, 0x2, 0x8d, 0x4, 0xdd, 0xad, 0x9a, 0x2, 0x8d, 0x5, 0xdd, 0xa9, 
-0x81, 0x20, 0x3b, 0xef, 0x20, 0x6, 0xef, 0xa9, 0x11, 0x8d, 0xe, 0xdd, 0x60, 0x85, 0x99, 0xad, 
-0x94, 0x2, 0x4a, 0x90, 0x28, 0x29, 0x8, 0xf0, 0x24, 0xa9, 0x2, 0x2c, 0x1, 0xdd, 0x10, 0xad, 
-0xf0, 0x22, 0xad, 0xa1, 0x2, 0x4a, 0xb0, 0xfa, 0xad, 0x1, 0xdd, 0x29, 0xfd, 0x8d, 0x1, 0xdd, 
-0xad, 0x1, 0xdd, 0x29, 0x4, 0xf0, 0xf9, 0xa9, 0x90, 0x18, 0x4c, 0x3b, 0xef, 0xad, 0xa1, 0x2, 
-0x29, 0x12, 0xf0, 0xf3, 0x18, 0x60, 0xad, 0x97, 0x2, 0xac, 0x9c, 0x2, 0xcc, 0x9b, 0x2, 0xf0, 
-0xb, 0x29, 0xf7, 0x8d, 0x97, 0x2, 0xb1, 0xf7, 0xee, 0x9c, 0x2, 0x60, 0x9, 0x8, 0x8d, 0x97, 
-0x2, 0xa9, 0x0, 0x60, 0x48, 0xad, 0xa1, 0x2, 0xf0, 0x11, 0xad, 0xa1, 0x2, 0x29, 0x3, 0xd0, 
-0xf9, 0xa9, 0x10, 0x8d, 0xd, 0xdd, 0xa9, 0x0, 0x8d, 0xa1, 0x2, 0x68, 0x60, 0xd, 0x49, 0x2f, 
-0x4f, 0x20, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x20, 0xa3, 0xd, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 
-0x49, 0x4e, 0x47, 0xa0, 0x46, 0x4f, 0x52, 0xa0, 0xd, 0x50, 0x52, 0x45, 0x53, 0x53, 0x20, 0x50, 
-0x4c, 0x41, 0x59, 0x20, 0x4f, 0x4e, 0x20, 0x54, 0x41, 0x50, 0xc5, 0x50, 0x52, 0x45, 0x53, 0x53, 
-0x20, 0x52, 0x45, 0x43, 0x4f, 0x52, 0x44, 0x20, 0x26, 0x20, 0x50, 0x4c, 0x41, 0x59, 0x20, 0x4f, 
-0x4e, 0x20, 0x54, 0x41, 0x50, 0xc5, 0xd, 0x4c, 0x4f, 0x41, 0x44, 0x49, 0x4e, 0xc7, 0xd, 0x53, 
-0x41, 0x56, 0x49, 0x4e, 0x47, 0xa0, 0xd, 0x56, 0x45, 0x52, 0x49, 0x46, 0x59, 0x49, 0x4e, 0xc7, 
-0xd, 0x46, 0x4f, 0x55, 0x4e, 0x44, 0xa0, 0xd, 0x4f, 0x4b, 0x8d, 0x24, 0x9d, 0x10, 0xd, 0xb9, 
-0xbd, 0xf0, 0x8, 0x29, 0x7f, 0x20, 0xd2, 0xff, 0xc8, 0x28, 0x10, 0xf3, 0x18, 0x60, 0xa5, 0x99, 
-0xd0, 0x8, 0xa5, 0xc6, 0xf0, 0xf, 0x78, 0x4c, 0xb4, 0xe5, 0xc9, 0x2, 0xd0, 0x18, 0x84, 0x97, 
-0x20, 0x86, 0xf0, 0xa4, 0x97, 0x18, 0x60, 0xa5, 0x99, 0xd0, 0xb, 0xa5, 0xd3, 0x85, 0xca, 0xa5, 
-0xd6, 0x85, 0xc9, 0x4c, 0x32, 0xe6, 0xc9, 0x3, 0xd0, 0x9, 0x85, 0xd0, 0xa5, 0xd5, 0x85, 0xc8, 
-0x4c, 0x32, 0xe6, 0xb0, 0x38, 0xc9, 0x2, 0xf0, 0x3f, 0x86, 0x97, 0x20, 0x99, 0xf1, 0xb0, 0x16, 
-0x48, 0x20, 0x99, 0xf1, 0xb0, 0xd, 0xd0, 0x5, 0xa9, 0x40, 0x20, 0x1c, 0xfe, 0xc6, 0xa6, 0xa6, 
-0x97, 0x68, 0x60, 0xaa, 0x68, 0x8a, 0xa6, 0x97, 0x60, 0x20, 0xd, 0xf8, 0xd0, 0xb, 0x20, 0x41, 
-0xf8, 0xb0, 0x11, 0xa9, 0x0, 0x85, 0xa6, 0xf0, 0xf0, 0xb1, 0xb2, 0x18, 0x60, 0xa5, 0x90, 0xf0, 
-0x4, 0xa9, 0xd, 0x18, 0x60, 0x4c, 0x13, 0xee, 0x20, 0x4e, 0xf1, 0xb0, 0xf7, 0xc9, 0x0, 0xd0, 
-0xf2, 0xad, 0x97, 0x2, 0x29, 0x60, 0xd0, 0xe9, 0xf0, 0xee, 0x48, 0xa5, 0x9a, 0xc9, 0x3, 0xd0, 
-0x4, 0x68, 0x4c, 0x16, 0xe7, 0x90, 0x4, 0x68, 0x4c, 0xdd, 0xed, 0x4a, 0x68, 0x85, 0x9e, 0x8a, 
-0x48, 0x98, 0x48, 0x90, 0x23, 0x20, 0xd, 0xf8, 0xd0, 0xe, 0x20, 0x64, 0xf8, 0xb0, 0xe, 0xa9, 
-0x2, 0xa0, 0x0, 0x91, 0xb2, 0xc8, 0x84, 0xa6, 0xa5, 0x9e, 0x91, 0xb2, 0x18, 0x68, 0xa8, 0x68, 
-0xaa, 0xa5, 0x9e, 0x90, 0x2, 0xa9, 0x0, 0x60, 0x20, 0x17, 0xf0, 0x4c, 0xfc, 0xf1, 0x20, 0xf, 
-0xf3, 0xf0, 0x3, 0x4c, 0x1, 0xf7, 0x20, 0x1f, 0xf3, 0xa5, 0xba, 0xf0, 0x16, 0xc9, 0x3, 0xf0, 
-0x12, 0xb0, 0x14, 0xc9, 0x2, 0xd0, 0x3, 0x4c, 0x4d, 0xf0, 0xa6, 0xb9, 0xe0, 0x60, 0xf0, 0x3, 
-0x4c, 0xa, 0xf7, 0x85, 0x99, 0x18, 0x60, 0xaa, 0x20, 0x9, 0xed, 0xa5, 0xb9, 0x10, 0x6, 0x20, 
-0xcc, 0xed, 0x4c, 0x48, 0xf2, 0x20, 0xc7, 0xed, 0x8a, 0x24, 0x90, 0x10, 0xe6, 0x4c, 0x7, 0xf7, 
-0x20, 0xf, 0xf3, 0xf0, 0x3, 0x4c, 0x1, 0xf7, 0x20, 0x1f, 0xf3, 0xa5, 0xba, 0xd0, 0x3, 0x4c, 
-0xd, 0xf7, 0xc9, 0x3, 0xf0, 0xf, 0xb0, 0x11, 0xc9, 0x2, 0xd0, 0x3, 0x4c, 0xe1, 0xef, 0xa6, 
-0xb9, 0xe0, 0x60, 0xf0, 0xea, 0x85, 0x9a, 0x18, 0x60, 0xaa, 0x20, 0xc, 0xed, 0xa5, 0xb9, 0x10, 
-0x5, 0x20, 0xbe, 0xed, 0xd0, 0x3, 0x20, 0xb9, 0xed, 0x8a, 0x24, 0x90, 0x10, 0xe7, 0x4c, 0x7, 
-0xf7, 0x20, 0x14, 0xf3, 0xf0, 0x2, 0x18, 0x60, 0x20, 0x1f, 0xf3, 0x8a, 0x48, 0xa5, 0xba, 0xf0, 
-0x50, 0xc9, 0x3, 0xf0, 0x4c, 0xb0, 0x47, 0xc9, 0x2, 0xd0, 0x1d, 0x68, 0x20, 0xf2, 0xf2, 0x20, 
-0x83, 0xf4, 0x20, 0x27, 0xfe, 0xa5, 0xf8, 0xf0, 0x1, 0xc8, 0xa5, 0xfa, 0xf0, 0x1, 0xc8, 0xa9, 
-0x0, 0x85, 0xf8, 0x85, 0xfa, 0x4c, 0x7d, 0xf4, 0xa5, 0xb9, 0x29, 0xf, 0xf0, 0x23, 0x20, 0xd0, 
-0xf7, 0xa9, 0x0, 0x38, 0x20, 0xdd, 0xf1, 0x20, 0x64, 0xf8, 0x90, 0x4, 0x68, 0xa9, 0x0, 0x60, 
-0xa5, 0xb9, 0xc9, 0x62, 0xd0, 0xb, 0xa9, 0x5, 0x20, 0x6a, 0xf7, 0x4c, 0xf1, 0xf2, 0x20, 0x42, 
-0xf6, 0x68, 0xaa, 0xc6, 0x98, 0xe4, 0x98, 0xf0, 0x14, 0xa4, 0x98, 0xb9, 0x59, 0x2, 0x9d, 0x59, 
-0x2, 0xb9, 0x63, 0x2, 0x9d, 0x63, 0x2, 0xb9, 0x6d, 0x2, 0x9d, 0x6d, 0x2, 0x18, 0x60, 0xa9, 
-0x0, 0x85, 0x90, 0x8a, 0xa6, 0x98, 0xca, 0x30, 0x15, 0xdd, 0x59, 0x2, 0xd0, 0xf8, 0x60, 0xbd, 
-0x59, 0x2, 0x85, 0xb8, 0xbd, 0x63, 0x2, 0x85, 0xba, 0xbd, 0x6d, 0x2, 0x85, 0xb9, 0x60, 0xa9, 
-0x0, 0x85, 0x98, 0xa2, 0x3, 0xe4, 0x9a, 0xb0, 0x3, 0x20, 0xfe, 0xed, 0xe4, 0x99, 0xb0, 0x3, 
-0x20, 0xef, 0xed, 0x86, 0x9a, 0xa9, 0x0, 0x85, 0x99, 0x60, 0xa6, 0xb8, 0xd0, 0x3, 0x4c, 0xa, 
-0xf7, 0x20, 0xf, 0xf3, 0xd0, 0x3, 0x4c, 0xfe, 0xf6, 0xa6, 0x98, 0xe0, 0xa, 0x90, 0x3, 0x4c, 
-0xfb, 0xf6, 0xe6, 0x98, 0xa5, 0xb8, 0x9d, 0x59, 0x2, 0xa5, 0xb9, 0x9, 0x60, 0x85, 0xb9, 0x9d, 
-0x6d, 0x2, 0xa5, 0xba, 0x9d, 0x63, 0x2, 0xf0, 0x5a, 0xc9, 0x3, 0xf0, 0x56, 0x90, 0x5, 0x20, 
-0xd5, 0xf3, 0x90, 0x4f, 0xc9, 0x2, 0xd0, 0x3, 0x4c, 0x9, 0xf4, 0x20, 0xd0, 0xf7, 0xb0, 0x3, 
-0x4c, 0x13, 0xf7, 0xa5, 0xb9, 0x29, 0xf, 0xd0, 0x1f, 0x20, 0x17, 0xf8, 0xb0, 0x36, 0x20, 0xaf, 
-0xf5, 0xa5, 0xb7, 0xf0, 0xa, 0x20, 0xea, 0xf7, 0x90, 0x18, 0xf0, 0x28, 0x4c, 0x4, 0xf7, 0x20, 
-0x2c, 0xf7, 0xf0, 0x20, 0x90, 0xc, 0xb0, 0xf4, 0x20, 0x38, 0xf8, 0xb0, 0x17, 0xa9, 0x4, 0x20, 
-0x6a, 0xf7, 0xa9, 0xbf, 0xa4, 0xb9, 0xc0, 0x60, 0xf0, 0x7, 0xa0, 0x0, 0xa9, 0x2, 0x91, 0xb2, 
-0x98, 0x85, 0xa6, 0x18, 0x60, 0xa5, 0xb9, 0x30, 0xfa, 0xa4, 0xb7, 0xf0, 0xf6, 0xa9, 0x0, 0x85, 
-0x90, 0xa5, 0xba, 0x20, 0xc, 0xed, 0xa5, 0xb9, 0x9, 0xf0, 0x20, 0xb9, 0xed, 0xa5, 0x90, 0x10, 
-0x5, 0x68, 0x68, 0x4c, 0x7, 0xf7, 0xa5, 0xb7, 0xf0, 0xc, 0xa0, 0x0, 0xb1, 0xbb, 0x20, 0xdd, 
-0xed, 0xc8, 0xc4, 0xb7, 0xd0, 0xf6, 0x4c, 0x54, 0xf6, 0x20, 0x83, 0xf4, 0x8c, 0x97, 0x2, 0xc4, 
-0xb7, 0xf0, 0xa, 0xb1, 0xbb, 0x99, 0x93, 0x2, 0xc8, 0xc0, 0x4, 0xd0, 0xf2, 0x20, 0x4a, 0xef, 
-0x8e, 0x98, 0x2, 0xad, 0x93, 0x2, 0x29, 0xf, 0xf0, 0x1c, 0xa, 0xaa, 0xad, 0xa6, 0x2, 0xd0, 
-0x9, 0xbc, 0xc1, 0xfe, 0xbd, 0xc0, 0xfe, 0x4c, 0x40, 0xf4, 0xbc, 0xeb, 0xe4, 0xbd, 0xea, 0xe4, 
-0x8c, 0x96, 0x2, 0x8d, 0x95, 0x2, 0xad, 0x95, 0x2, 0xa, 0x20, 0x2e, 0xff, 0xad, 0x94, 0x2, 
-0x4a, 0x90, 0x9, 0xad, 0x1, 0xdd, 0xa, 0xb0, 0x3, 0x20, 0xd, 0xf0, 0xad, 0x9b, 0x2, 0x8d, 
-0x9c, 0x2, 0xad, 0x9e, 0x2, 0x8d, 0x9d, 0x2, 0x20, 0x27, 0xfe, 0xa5, 0xf8, 0xd0, 0x5, 0x88, 
-0x84, 0xf8, 0x86, 0xf7, 0xa5, 0xfa, 0xd0, 0x5, 0x88, 0x84, 0xfa, 0x86, 0xf9, 0x38, 0xa9, 0xf0, 
-0x4c, 0x2d, 0xfe, 0xa9, 0x7f, 0x8d, 0xd, 0xdd, 0xa9, 0x6, 0x8d, 0x3, 0xdd, 0x8d, 0x1, 0xdd, 
-0xa9, 0x4, 0xd, 0x0, 0xdd, 0x8d, 0x0, 0xdd, 0xa0, 0x0, 0x8c, 0xa1, 0x2, 0x60, 0x86, 0xc3, 
-0x84, 0xc4, 0x6c, 0x30, 0x3, 0x85, 0x93, 0xa9, 0x0, 0x85, 0x90, 0xa5, 0xba, 0xd0, 0x3, 0x4c, 
-0x13, 0xf7, 0xc9, 0x3, 0xf0, 0xf9, 0x90, 0x7b, 0xa4, 0xb7, 0xd0, 0x3, 0x4c, 0x10, 0xf7, 0xa6, 
-0xb9, 0x20, 0xaf, 0xf5, 0xa9, 0x60, 0x85, 0xb9, 0x20, 0xd5, 0xf3, 0xa5, 0xba, 0x20, 0x9, 0xed, 
-0xa5, 0xb9, 0x20, 0xc7, 0xed, 0x20, 0x13, 0xee, 0x85, 0xae, 0xa5, 0x90, 0x4a, 0x4a, 0xb0, 0x50, 
-0x20, 0x13, 0xee, 0x85, 0xaf, 0x8a, 0xd0, 0x8, 0xa5, 0xc3, 0x85, 0xae, 0xa5, 0xc4, 0x85, 0xaf, 
-0x20, 0xd2, 0xf5, 0xa9, 0xfd, 0x25, 0x90, 0x85, 0x90, 0x20, 0xe1, 0xff, 0xd0, 0x3, 0x4c, 0x33, 
-0xf6, 0x20, 0x13, 0xee, 0xaa, 0xa5, 0x90, 0x4a, 0x4a, 0xb0, 0xe8, 0x8a, 0xa4, 0x93, 0xf0, 0xc, 
-0xa0, 0x0, 0xd1, 0xae, 0xf0, 0x8, 0xa9, 0x10, 0x20, 0x1c, 0xfe, 0x2c, 0x91, 0xae, 0xe6, 0xae, 
-0xd0, 0x2, 0xe6, 0xaf, 0x24, 0x90, 0x50, 0xcb, 0x20, 0xef, 0xed, 0x20, 0x42, 0xf6, 0x90, 0x79, 
-0x4c, 0x4, 0xf7, 0x4a, 0xb0, 0x3, 0x4c, 0x13, 0xf7, 0x20, 0xd0, 0xf7, 0xb0, 0x3, 0x4c, 0x13, 
-0xf7, 0x20, 0x17, 0xf8, 0xb0, 0x68, 0x20, 0xaf, 0xf5, 0xa5, 0xb7, 0xf0, 0x9, 0x20, 0xea, 0xf7, 
-0x90, 0xb, 0xf0, 0x5a, 0xb0, 0xda, 0x20, 0x2c, 0xf7, 0xf0, 0x53, 0xb0, 0xd3, 0xa5, 0x90, 0x29, 
-0x10, 0x38, 0xd0, 0x4a, 0xe0, 0x1, 0xf0, 0x11, 0xe0, 0x3, 0xd0, 0xdd, 0xa0, 0x1, 0xb1, 0xb2, 
-0x85, 0xc3, 0xc8, 0xb1, 0xb2, 0x85, 0xc4, 0xb0, 0x4, 0xa5, 0xb9, 0xd0, 0xef, 0xa0, 0x3, 0xb1, 
-0xb2, 0xa0, 0x1, 0xf1, 0xb2, 0xaa, 0xa0, 0x4, 0xb1, 0xb2, 0xa0, 0x2, 0xf1, 0xb2, 0xa8, 0x18, 
-0x8a, 0x65, 0xc3, 0x85, 0xae, 0x98, 0x65, 0xc4, 0x85, 0xaf, 0xa5, 0xc3, 0x85, 0xc1, 0xa5, 0xc4, 
-0x85, 0xc2, 0x20, 0xd2, 0xf5, 0x20, 0x4a, 0xf8, 0x24, 0x18, 0xa6, 0xae, 0xa4, 0xaf, 0x60, 0xa5, 
-0x9d, 0x10, 0x1e, 0xa0, 0xc, 0x20, 0x2f, 0xf1, 0xa5, 0xb7, 0xf0, 0x15, 0xa0, 0x17, 0x20, 0x2f, 
-0xf1, 0xa4, 0xb7, 0xf0, 0xc, 0xa0, 0x0, 0xb1, 0xbb, 0x20, 0xd2, 0xff, 0xc8, 0xc4, 0xb7, 0xd0, 
-0xf6, 0x60, 0xa0, 0x49, 0xa5, 0x93, 0xf0, 0x2, 0xa0, 0x59, 0x4c, 0x2b, 0xf1, 0x86, 0xae, 0x84, 
-0xaf, 0xaa, 0xb5, 0x0, 0x85, 0xc1, 0xb5, 0x1, 0x85, 0xc2, 0x6c, 0x32, 0x3, 0xa5, 0xba, 0xd0, 
-0x3, 0x4c, 0x13, 0xf7, 0xc9, 0x3, 0xf0, 0xf9, 0x90, 0x5f, 0xa9, 0x61, 0x85, 0xb9, 0xa4, 0xb7, 
-0xd0, 0x3, 0x4c, 0x10, 0xf7, 0x20, 0xd5, 0xf3, 0x20, 0x8f, 0xf6, 0xa5, 0xba, 0x20, 0xc, 0xed, 
-0xa5, 0xb9, 0x20, 0xb9, 0xed, 0xa0, 0x0, 0x20, 0x8e, 0xfb, 0xa5, 0xac, 0x20, 0xdd, 0xed, 0xa5, 
-0xad, 0x20, 0xdd, 0xed, 0x20, 0xd1, 0xfc, 0xb0, 0x16, 0xb1, 0xac, 0x20, 0xdd, 0xed, 0x20, 0xe1, 
-0xff, 0xd0, 0x7, 0x20, 0x42, 0xf6, 0xa9, 0x0, 0x38, 0x60, 0x20, 0xdb, 0xfc, 0xd0, 0xe5, 0x20, 
-0xfe, 0xed, 0x24, 0xb9, 0x30, 0x11, 0xa5, 0xba, 0x20, 0xc, 0xed, 0xa5, 0xb9, 0x29, 0xef, 0x9, 
-0xe0, 0x20, 0xb9, 0xed, 0x20, 0xfe, 0xed, 0x18, 0x60, 0x4a, 0xb0, 0x3, 0x4c, 0x13, 0xf7, 0x20, 
-0xd0, 0xf7, 0x90, 0x8d, 0x20, 0x38, 0xf8, 0xb0, 0x25, 0x20, 0x8f, 0xf6, 0xa2, 0x3, 0xa5, 0xb9, 
-0x29, 0x1, 0xd0, 0x2, 0xa2, 0x1, 0x8a, 0x20, 0x6a, 0xf7, 0xb0, 0x12, 0x20, 0x67, 0xf8, 0xb0, 
-0xd, 0xa5, 0xb9, 0x29, 0x2, 0xf0, 0x6, 0xa9, 0x5, 0x20, 0x6a, 0xf7, 0x24, 0x18, 0x60, 0xa5, 
-0x9d, 0x10, 0xfb, 0xa0, 0x51, 0x20, 0x2f, 0xf1, 0x4c, 0xc1, 0xf5, 0xa2, 0x0, 0xe6, 0xa2, 0xd0, 
-0x6, 0xe6, 0xa1, 0xd0, 0x2, 0xe6, 0xa0, 0x38, 0xa5, 0xa2, 0xe9, 0x1, 0xa5, 0xa1, 0xe9, 0x1a, 
-0xa5, 0xa0, 0xe9, 0x4f, 0x90, 0x6, 0x86, 0xa0, 0x86, 0xa1, 0x86, 0xa2, 0xad, 0x1, 0xdc, 0xcd, 
-0x1, 0xdc, 0xd0, 0xf8, 0xaa, 0x30, 0x13, 0xa2, 0xbd, 0x8e, 0x0, 0xdc, 0xae, 0x1, 0xdc, 0xec, 
-0x1, 0xdc, 0xd0, 0xf8, 0x8d, 0x0, 0xdc, 0xe8, 0xd0, 0x2, 0x85, 0x91, 0x60, 0x78, 0xa5, 0xa2, 
-0xa6, 0xa1, 0xa4, 0xa0, 0x78, 0x85, 0xa2, 0x86, 0xa1, 0x84, 0xa0, 0x58, 0x60, 0xa5, 0x91, 0xc9, 
-0x7f, 0xd0, 0x7, 0x8, 0x20, 0xcc, 0xff, 0x85, 0xc6, 0x28, 0x60, 0xa9, 0x1, 0x2c, 0xa9, 0x2, 
-0x2c, 0xa9, 0x3, 0x2c, 0xa9, 0x4, 0x2c, 0xa9, 0x5, 0x2c, 0xa9, 0x6, 0x2c, 0xa9, 0x7, 0x2c, 
-0xa9, 0x8, 0x2c, 0xa9, 0x9, 0x48, 0x20, 0xcc, 0xff, 0xa0, 0x0, 0x24, 0x9d, 0x50, 0xa, 0x20, 
-0x2f, 0xf1, 0x68, 0x48, 0x9, 0x30, 0x20, 0xd2, 0xff, 0x68, 0x38, 0x60, 0xa5, 0x93, 0x48, 0x20, 
-0x41, 0xf8, 0x68, 0x85, 0x93, 0xb0, 0x32, 0xa0, 0x0, 0xb1, 0xb2, 0xc9, 0x5, 0xf0, 0x2a, 0xc9, 
-0x1, 0xf0, 0x8, 0xc9, 0x3, 0xf0, 0x4, 0xc9, 0x4, 0xd0, 0xe1, 0xaa, 0x24, 0x9d, 0x10, 0x17, 
-0xa0, 0x63, 0x20, 0x2f, 0xf1, 0xa0, 0x5, 0xb1, 0xb2, 0x20, 0xd2, 0xff, 0xc8, 0xc0, 0x15, 0xd0, 
-0xf6, 0xa5, 0xa1, 0x20, 0xe0, 0xe4, 0xea, 0x18, 0x88, 0x60, 0x85, 0x9e, 0x20, 0xd0, 0xf7, 0x90, 
-0x5e, 0xa5, 0xc2, 0x48, 0xa5, 0xc1, 0x48, 0xa5, 0xaf, 0x48, 0xa5, 0xae, 0x48, 0xa0, 0xbf, 0xa9, 
-0x20, 0x91, 0xb2, 0x88, 0xd0, 0xfb, 0xa5, 0x9e, 0x91, 0xb2, 0xc8, 0xa5, 0xc1, 0x91, 0xb2, 0xc8, 
-0xa5, 0xc2, 0x91, 0xb2, 0xc8, 0xa5, 0xae, 0x91, 0xb2, 0xc8, 0xa5, 0xaf, 0x91, 0xb2, 0xc8, 0x84, 
-0x9f, 0xa0, 0x0, 0x84, 0x9e, 0xa4, 0x9e, 0xc4, 0xb7, 0xf0, 0xc, 0xb1, 0xbb, 0xa4, 0x9f, 0x91, 
-0xb2, 0xe6, 0x9e, 0xe6, 0x9f, 0xd0, 0xee, 0x20, 0xd7, 0xf7, 0xa9, 0x69, 0x85, 0xab, 0x20, 0x6b, 
-0xf8, 0xa8, 0x68, 0x85, 0xae, 0x68, 0x85, 0xaf, 0x68, 0x85, 0xc1, 0x68, 0x85, 0xc2, 0x98, 0x60, 
-0xa6, 0xb2, 0xa4, 0xb3, 0xc0, 0x2, 0x60, 0x20, 0xd0, 0xf7, 0x8a, 0x85, 0xc1, 0x18, 0x69, 0xc0, 
-0x85, 0xae, 0x98, 0x85, 0xc2, 0x69, 0x0, 0x85, 0xaf, 0x60, 0x20, 0x2c, 0xf7, 0xb0, 0x1d, 0xa0, 
-0x5, 0x84, 0x9f, 0xa0, 0x0, 0x84, 0x9e, 0xc4, 0xb7, 0xf0, 0x10, 0xb1, 0xbb, 0xa4, 0x9f, 0xd1, 
-0xb2, 0xd0, 0xe7, 0xe6, 0x9e, 0xe6, 0x9f, 0xa4, 0x9e, 0xd0, 0xec, 0x18, 0x60, 0x20, 0xd0, 0xf7, 
-0xe6, 0xa6, 0xa4, 0xa6, 0xc0, 0xc0, 0x60, 0x20, 0x2e, 0xf8, 0xf0, 0x1a, 0xa0, 0x1b, 0x20, 0x2f, 
-0xf1, 0x20, 0xd0, 0xf8, 0x20, 0x2e, 0xf8, 0xd0, 0xf8, 0xa0, 0x6a, 0x4c, 0x2f, 0xf1, 0xa9, 0x10, 
-0x24, 0x1, 0xd0, 0x2, 0x24, 0x1, 0x18, 0x60, 0x20, 0x2e, 0xf8, 0xf0, 0xf9, 0xa0, 0x2e, 0xd0, 
-0xdd, 0xa9, 0x0, 0x85, 0x90, 0x85, 0x93, 0x20, 0xd7, 0xf7, 0x20, 0x17, 0xf8, 0xb0, 0x1f, 0x78, 
-0xa9, 0x0, 0x85, 0xaa, 0x85, 0xb4, 0x85, 0xb0, 0x85, 0x9e, 0x85, 0x9f, 0x85, 0x9c, 0xa9, 0x90, 
-0xa2, 0xe, 0xd0, 0x11, 0x20, 0xd7, 0xf7, 0xa9, 0x14, 0x85, 0xab, 0x20, 0x38, 0xf8, 0xb0, 0x6c, 
-0x78, 0xa9, 0x82, 0xa2, 0x8, 0xa0, 0x7f, 0x8c, 0xd, 0xdc, 0x8d, 0xd, 0xdc, 0xad, 0xe, 0xdc, 
-0x9, 0x19, 0x8d, 0xf, 0xdc, 0x29, 0x91, 0x8d, 0xa2, 0x2, 0x20, 0xa4, 0xf0, 0xad, 0x11, 0xd0, 
-0x29, 0xef, 0x8d, 0x11, 0xd0, 0xad, 0x14, 0x3, 0x8d, 0x9f, 0x2, 0xad, 0x15, 0x3, 0x8d, 0xa0, 
-0x2, 0x20, 0xbd, 0xfc, 0xa9, 0x2, 0x85, 0xbe, 0x20, 0x97, 0xfb, 0xa5, 0x1, 0x29, 0x1f, 0x85, 
-0x1, 0x85, 0xc0, 0xa2, 0xff, 0xa0, 0xff, 0x88, 0xd0, 0xfd, 0xca, 0xd0, 0xf8, 0x58, 0xad, 0xa0, 
-0x2, 0xcd, 0x15, 0x3, 0x18, 0xf0, 0x15, 0x20, 0xd0, 0xf8, 0x20, 0xbc, 0xf6, 0x4c, 0xbe, 0xf8, 
-0x20, 0xe1, 0xff, 0x18, 0xd0, 0xb, 0x20, 0x93, 0xfc, 0x38, 0x68, 0x68, 0xa9, 0x0, 0x8d, 0xa0, 
-0x2, 0x60, 0x86, 0xb1, 0xa5, 0xb0, 0xa, 0xa, 0x18, 0x65, 0xb0, 0x18, 0x65, 0xb1, 0x85, 0xb1, 
-0xa9, 0x0, 0x24, 0xb0, 0x30, 0x1, 0x2a, 0x6, 0xb1, 0x2a, 0x6, 0xb1, 0x2a, 0xaa, 0xad, 0x6, 
-0xdc, 0xc9, 0x16, 0x90, 0xf9, 0x65, 0xb1, 0x8d, 0x4, 0xdc, 0x8a, 0x6d, 0x7, 0xdc, 0x8d, 0x5, 
-0xdc, 0xad, 0xa2, 0x2, 0x8d, 0xe, 0xdc, 0x8d, 0xa4, 0x2, 0xad, 0xd, 0xdc, 0x29, 0x10, 0xf0, 
-0x9, 0xa9, 0xf9, 0x48, 0xa9, 0x2a, 0x48, 0x4c, 0x43, 0xff, 0x58, 0x60, 0xae, 0x7, 0xdc, 0xa0, 
-0xff, 0x98, 0xed, 0x6, 0xdc, 0xec, 0x7, 0xdc, 0xd0, 0xf2, 0x86, 0xb1, 0xaa, 0x8c, 0x6, 0xdc, 
-0x8c, 0x7, 0xdc, 0xa9, 0x19, 0x8d, 0xf, 0xdc, 0xad, 0xd, 0xdc, 0x8d, 0xa3, 0x2, 0x98, 0xe5, 
-0xb1, 0x86, 0xb1, 0x4a, 0x66, 0xb1, 0x4a, 0x66, 0xb1, 0xa5, 0xb0, 0x18, 0x69, 0x3c, 0xc5, 0xb1, 
-0xb0, 0x4a, 0xa6, 0x9c, 0xf0, 0x3, 0x4c, 0x60, 0xfa, 0xa6, 0xa3, 0x30, 0x1b, 0xa2, 0x0, 0x69, 
-0x30, 0x65, 0xb0, 0xc5, 0xb1, 0xb0, 0x1c, 0xe8, 0x69, 0x26, 0x65, 0xb0, 0xc5, 0xb1, 0xb0, 0x17, 
-0x69, 0x2c, 0x65, 0xb0, 0xc5, 0xb1, 0x90, 0x3, 0x4c, 0x10, 0xfa, 0xa5, 0xb4, 0xf0, 0x1d, 0x85, 
-0xa8, 0xd0, 0x19, 0xe6, 0xa9, 0xb0, 0x2, 0xc6, 0xa9, 0x38, 0xe9, 0x13, 0xe5, 0xb1, 0x65, 0x92, 
-0x85, 0x92, 0xa5, 0xa4, 0x49, 0x1, 0x85, 0xa4, 0xf0, 0x2b, 0x86, 0xd7, 0xa5, 0xb4, 0xf0, 0x22, 
-0xad, 0xa3, 0x2, 0x29, 0x1, 0xd0, 0x5, 0xad, 0xa4, 0x2, 0xd0, 0x16, 0xa9, 0x0, 0x85, 0xa4, 
-0x8d, 0xa4, 0x2, 0xa5, 0xa3, 0x10, 0x30, 0x30, 0xbf, 0xa2, 0xa6, 0x20, 0xe2, 0xf8, 0xa5, 0x9b, 
-0xd0, 0xb9, 0x4c, 0xbc, 0xfe, 0xa5, 0x92, 0xf0, 0x7, 0x30, 0x3, 0xc6, 0xb0, 0x2c, 0xe6, 0xb0, 
-0xa9, 0x0, 0x85, 0x92, 0xe4, 0xd7, 0xd0, 0xf, 0x8a, 0xd0, 0xa0, 0xa5, 0xa9, 0x30, 0xbd, 0xc9, 
-0x10, 0x90, 0xb9, 0x85, 0x96, 0xb0, 0xb5, 0x8a, 0x45, 0x9b, 0x85, 0x9b, 0xa5, 0xb4, 0xf0, 0xd2, 
-0xc6, 0xa3, 0x30, 0xc5, 0x46, 0xd7, 0x66, 0xbf, 0xa2, 0xda, 0x20, 0xe2, 0xf8, 0x4c, 0xbc, 0xfe, 
-0xa5, 0x96, 0xf0, 0x4, 0xa5, 0xb4, 0xf0, 0x7, 0xa5, 0xa3, 0x30, 0x3, 0x4c, 0x97, 0xf9, 0x46, 
-0xb1, 0xa9, 0x93, 0x38, 0xe5, 0xb1, 0x65, 0xb0, 0xa, 0xaa, 0x20, 0xe2, 0xf8, 0xe6, 0x9c, 0xa5, 
-0xb4, 0xd0, 0x11, 0xa5, 0x96, 0xf0, 0x26, 0x85, 0xa8, 0xa9, 0x0, 0x85, 0x96, 0xa9, 0x81, 0x8d, 
-0xd, 0xdc, 0x85, 0xb4, 0xa5, 0x96, 0x85, 0xb5, 0xf0, 0x9, 0xa9, 0x0, 0x85, 0xb4, 0xa9, 0x1, 
-0x8d, 0xd, 0xdc, 0xa5, 0xbf, 0x85, 0xbd, 0xa5, 0xa8, 0x5, 0xa9, 0x85, 0xb6, 0x4c, 0xbc, 0xfe, 
-0x20, 0x97, 0xfb, 0x85, 0x9c, 0xa2, 0xda, 0x20, 0xe2, 0xf8, 0xa5, 0xbe, 0xf0, 0x2, 0x85, 0xa7, 
-0xa9, 0xf, 0x24, 0xaa, 0x10, 0x17, 0xa5, 0xb5, 0xd0, 0xc, 0xa6, 0xbe, 0xca, 0xd0, 0xb, 0xa9, 
-0x8, 0x20, 0x1c, 0xfe, 0xd0, 0x4, 0xa9, 0x0, 0x85, 0xaa, 0x4c, 0xbc, 0xfe, 0x70, 0x31, 0xd0, 
-0x18, 0xa5, 0xb5, 0xd0, 0xf5, 0xa5, 0xb6, 0xd0, 0xf1, 0xa5, 0xa7, 0x4a, 0xa5, 0xbd, 0x30, 0x3, 
-0x90, 0x18, 0x18, 0xb0, 0x15, 0x29, 0xf, 0x85, 0xaa, 0xc6, 0xaa, 0xd0, 0xdd, 0xa9, 0x40, 0x85, 
-0xaa, 0x20, 0x8e, 0xfb, 0xa9, 0x0, 0x85, 0xab, 0xf0, 0xd0, 0xa9, 0x80, 0x85, 0xaa, 0xd0, 0xca, 
-0xa5, 0xb5, 0xf0, 0xa, 0xa9, 0x4, 0x20, 0x1c, 0xfe, 0xa9, 0x0, 0x4c, 0x4a, 0xfb, 0x20, 0xd1, 
-0xfc, 0x90, 0x3, 0x4c, 0x48, 0xfb, 0xa6, 0xa7, 0xca, 0xf0, 0x2d, 0xa5, 0x93, 0xf0, 0xc, 0xa0, 
-0x0, 0xa5, 0xbd, 0xd1, 0xac, 0xf0, 0x4, 0xa9, 0x1, 0x85, 0xb6, 0xa5, 0xb6, 0xf0, 0x4b, 0xa2, 
-0x3d, 0xe4, 0x9e, 0x90, 0x3e, 0xa6, 0x9e, 0xa5, 0xad, 0x9d, 0x1, 0x1, 0xa5, 0xac, 0x9d, 0x0, 
-0x1, 0xe8, 0xe8, 0x86, 0x9e, 0x4c, 0x3a, 0xfb, 0xa6, 0x9f, 0xe4, 0x9e, 0xf0, 0x35, 0xa5, 0xac, 
-0xdd, 0x0, 0x1, 0xd0, 0x2e, 0xa5, 0xad, 0xdd, 0x1, 0x1, 0xd0, 0x27, 0xe6, 0x9f, 0xe6, 0x9f, 
-0xa5, 0x93, 0xf0, 0xb, 0xa5, 0xbd, 0xa0, 0x0, 0xd1, 0xac, 0xf0, 0x17, 0xc8, 0x84, 0xb6, 0xa5, 
-0xb6, 0xf0, 0x7, 0xa9, 0x10, 0x20, 0x1c, 0xfe, 0xd0, 0x9, 0xa5, 0x93, 0xd0, 0x5, 0xa8, 0xa5, 
-0xbd, 0x91, 0xac, 0x20, 0xdb, 0xfc, 0xd0, 0x43, 0xa9, 0x80, 0x85, 0xaa, 0x78, 0xa2, 0x1, 0x8e, 
-0xd, 0xdc, 0xae, 0xd, 0xdc, 0xa6, 0xbe, 0xca, 0x30, 0x2, 0x86, 0xbe, 0xc6, 0xa7, 0xf0, 0x8, 
-0xa5, 0x9e, 0xd0, 0x27, 0x85, 0xbe, 0xf0, 0x23, 0x20, 0x93, 0xfc, 0x20, 0x8e, 0xfb, 0xa0, 0x0, 
-0x84, 0xab, 0xb1, 0xac, 0x45, 0xab, 0x85, 0xab, 0x20, 0xdb, 0xfc, 0x20, 0xd1, 0xfc, 0x90, 0xf2, 
-0xa5, 0xab, 0x45, 0xbd, 0xf0, 0x5, 0xa9, 0x20, 0x20, 0x1c, 0xfe, 0x4c, 0xbc, 0xfe, 0xa5, 0xc2, 
-0x85, 0xad, 0xa5, 0xc1, 0x85, 0xac, 0x60, 0xa9, 0x8, 0x85, 0xa3, 0xa9, 0x0, 0x85, 0xa4, 0x85, 
-0xa8, 0x85, 0x9b, 0x85, 0xa9, 0x60, 0xa5, 0xbd, 0x4a, 0xa9, 0x60, 0x90, 0x2, 0xa9, 0xb0, 0xa2, 
-0x0, 0x8d, 0x6, 0xdc, 0x8e, 0x7, 0xdc, 0xad, 0xd, 0xdc, 0xa9, 0x19, 0x8d, 0xf, 0xdc, 0xa5, 
-0x1, 0x49, 0x8, 0x85, 0x1, 0x29, 0x8, 0x60, 0x38, 0x66, 0xb6, 0x30, 0x3c, 0xa5, 0xa8, 0xd0, 
-0x12, 0xa9, 0x10, 0xa2, 0x1, 0x20, 0xb1, 0xfb, 0xd0, 0x2f, 0xe6, 0xa8, 0xa5, 0xb6, 0x10, 0x29, 
-0x4c, 0x57, 0xfc, 0xa5, 0xa9, 0xd0, 0x9, 0x20, 0xad, 0xfb, 0xd0, 0x1d, 0xe6, 0xa9, 0xd0, 0x19, 
-0x20, 0xa6, 0xfb, 0xd0, 0x14, 0xa5, 0xa4, 0x49, 0x1, 0x85, 0xa4, 0xf0, 0xf, 0xa5, 0xbd, 0x49, 
-0x1, 0x85, 0xbd, 0x29, 0x1, 0x45, 0x9b, 0x85, 0x9b, 0x4c, 0xbc, 0xfe, 0x46, 0xbd, 0xc6, 0xa3, 
-0xa5, 0xa3, 0xf0, 0x3a, 0x10, 0xf3, 0x20, 0x97, 0xfb, 0x58, 0xa5, 0xa5, 0xf0, 0x12, 0xa2, 0x0, 
-0x86, 0xd7, 0xc6, 0xa5, 0xa6, 0xbe, 0xe0, 0x2, 0xd0, 0x2, 0x9, 0x80, 0x85, 0xbd, 0xd0, 0xd9, 
-0x20, 0xd1, 0xfc, 0x90, 0xa, 0xd0, 0x91, 0xe6, 0xad, 0xa5, 0xd7, 0x85, 0xbd, 0xb0, 0xca, 0xa0, 
-0x0, 0xb1, 0xac, 0x85, 0xbd, 0x45, 0xd7, 0x85, 0xd7, 0x20, 0xdb, 0xfc, 0xd0, 0xbb, 0xa5, 0x9b, 
-0x49, 0x1, 0x85, 0xbd, 0x4c, 0xbc, 0xfe, 0xc6, 0xbe, 0xd0, 0x3, 0x20, 0xca, 0xfc, 0xa9, 0x50, 
-0x85, 0xa7, 0xa2, 0x8, 0x78, 0x20, 0xbd, 0xfc, 0xd0, 0xea, 0xa9, 0x78, 0x20, 0xaf, 0xfb, 0xd0, 
-0xe3, 0xc6, 0xa7, 0xd0, 0xdf, 0x20, 0x97, 0xfb, 0xc6, 0xab, 0x10, 0xd8, 0xa2, 0xa, 0x20, 0xbd, 
-0xfc, 0x58, 0xe6, 0xab, 0xa5, 0xbe, 0xf0, 0x30, 0x20, 0x8e, 0xfb, 0xa2, 0x9, 0x86, 0xa5, 0x86, 
-0xb6, 0xd0, 0x83, 0x8, 0x78, 0xad, 0x11, 0xd0, 0x9, 0x10, 0x8d, 0x11, 0xd0, 0x20, 0xca, 0xfc, 
-0xa9, 0x7f, 0x8d, 0xd, 0xdc, 0x20, 0xdd, 0xfd, 0xad, 0xa0, 0x2, 0xf0, 0x9, 0x8d, 0x15, 0x3, 
-0xad, 0x9f, 0x2, 0x8d, 0x14, 0x3, 0x28, 0x60, 0x20, 0x93, 0xfc, 0xf0, 0x97, 0xbd, 0x93, 0xfd, 
-0x8d, 0x14, 0x3, 0xbd, 0x94, 0xfd, 0x8d, 0x15, 0x3, 0x60, 0xa5, 0x1, 0x9, 0x20, 0x85, 0x1, 
-0x60, 0x38, 0xa5, 0xac, 0xe5, 0xae, 0xa5, 0xad, 0xe5, 0xaf, 0x60, 0xe6, 0xac, 0xd0, 0x2, 0xe6, 
-0xad, 0x60, 0xa2, 0xff, 0x78, 0x9a, 0xd8, 0x20, 0x2, 0xfd, 0xd0, 0x3, 0x6c, 0x0, 0x80, 0x8e, 
-0x16, 0xd0, 0x20, 0xa3, 0xfd, 0x20, 0x50, 0xfd, 0x20, 0x15, 0xfd, 0x20, 0x5b, 0xff, 0x58, 0x6c, 
-0x0, 0xa0, 0xa2, 0x5, 0xbd, 0xf, 0xfd, 0xdd, 0x3, 0x80, 0xd0, 0x3, 0xca, 0xd0, 0xf5, 0x60, 
-0xc3, 0xc2, 0xcd, 0x38, 0x30, 0xa2, 0x30, 0xa0, 0xfd, 0x18, 0x86, 0xc3, 0x84, 0xc4, 0xa0, 0x1f, 
-0xb9, 0x14, 0x3, 0xb0, 0x2, 0xb1, 0xc3, 0x91, 0xc3, 0x99, 0x14, 0x3, 0x88, 0x10, 0xf1, 0x60, 
-0x31, 0xea, 0x66, 0xfe, 0x47, 0xfe, 0x4a, 0xf3, 0x91, 0xf2, 0xe, 0xf2, 0x50, 0xf2, 0x33, 0xf3, 
-0x57, 0xf1, 0xca, 0xf1, 0xed, 0xf6, 0x3e, 0xf1, 0x2f, 0xf3, 0x66, 0xfe, 0xa5, 0xf4, 0xed, 0xf5, 
-0xa9, 0x0, 0xa8, 0x99, 0x2, 0x0, 0x99, 0x0, 0x2, 0x99, 0x0, 0x3, 0xc8, 0xd0, 0xf4, 0xa2, 
-0x3c, 0xa0, 0x3, 0x86, 0xb2, 0x84, 0xb3, 0xa8, 0xa9, 0x3, 0x85, 0xc2, 0xe6, 0xc2, 0xb1, 0xc1, 
-0xaa, 0xa9, 0x55, 0x91, 0xc1, 0xd1, 0xc1, 0xd0, 0xf, 0x2a, 0x91, 0xc1, 0xd1, 0xc1, 0xd0, 0x8, 
-0x8a, 0x91, 0xc1, 0xc8, 0xd0, 0xe8, 0xf0, 0xe4, 0x98, 0xaa, 0xa4, 0xc2, 0x18, 0x20, 0x2d, 0xfe, 
-0xa9, 0x8, 0x8d, 0x82, 0x2, 0xa9, 0x4, 0x8d, 0x88, 0x2, 0x60, 0x6a, 0xfc, 0xcd, 0xfb, 0x31, 
-0xea, 0x2c, 0xf9, 0xa9, 0x7f, 0x8d, 0xd, 0xdc, 0x8d, 0xd, 0xdd, 0x8d, 0x0, 0xdc, 0xa9, 0x8, 
-0x8d, 0xe, 0xdc, 0x8d, 0xe, 0xdd, 0x8d, 0xf, 0xdc, 0x8d, 0xf, 0xdd, 0xa2, 0x0, 0x8e, 0x3, 
-0xdc, 0x8e, 0x3, 0xdd, 0x8e, 0x18, 0xd4, 0xca, 0x8e, 0x2, 0xdc, 0xa9, 0x7, 0x8d, 0x0, 0xdd, 
-0xa9, 0x3f, 0x8d, 0x2, 0xdd, 0xa9, 0xe7, 0x85, 0x1, 0xa9, 0x2f, 0x85, 0x0, 0xad, 0xa6, 0x2, 
-0xf0, 0xa, 0xa9, 0x25, 0x8d, 0x4, 0xdc, 0xa9, 0x40, 0x4c, 0xf3, 0xfd, 0xa9, 0x95, 0x8d, 0x4, 
-0xdc, 0xa9, 0x42, 0x8d, 0x5, 0xdc, 0x4c, 0x6e, 0xff, 0x85, 0xb7, 0x86, 0xbb, 0x84, 0xbc, 0x60, 
-0x85, 0xb8, 0x86, 0xba, 0x84, 0xb9, 0x60, 0xa5, 0xba, 0xc9, 0x2, 0xd0, 0xd, 0xad, 0x97, 0x2, 
-0x48, 0xa9, 0x0, 0x8d, 0x97, 0x2, 0x68, 0x60, 0x85, 0x9d, 0xa5, 0x90, 0x5, 0x90, 0x85, 0x90, 
-0x60, 0x8d, 0x85, 0x2, 0x60, 0x90, 0x6, 0xae, 0x83, 0x2, 0xac, 0x84, 0x2, 0x8e, 0x83, 0x2, 
-0x8c, 0x84, 0x2, 0x60, 0x90, 0x6, 0xae, 0x81, 0x2, 0xac, 0x82, 0x2, 0x8e, 0x81, 0x2, 0x8c, 
-0x82, 0x2, 0x60, 0x78, 0x6c, 0x18, 0x3, 0x48, 0x8a, 0x48, 0x98, 0x48, 0xa9, 0x7f, 0x8d, 0xd, 
-0xdd, 0xac, 0xd, 0xdd, 0x30, 0x1c, 0x20, 0x2, 0xfd, 0xd0, 0x3, 0x6c, 0x2, 0x80, 0x20, 0xbc, 
-0xf6, 0x20, 0xe1, 0xff, 0xd0, 0xc, 0x20, 0x15, 0xfd, 0x20, 0xa3, 0xfd, 0x20, 0x18, 0xe5, 0x6c, 
-0x2, 0xa0, 0x98, 0x2d, 0xa1, 0x2, 0xaa, 0x29, 0x1, 0xf0, 0x28, 0xad, 0x0, 0xdd, 0x29, 0xfb, 
-0x5, 0xb5, 0x8d, 0x0, 0xdd, 0xad, 0xa1, 0x2, 0x8d, 0xd, 0xdd, 0x8a, 0x29, 0x12, 0xf0, 0xd, 
-0x29, 0x2, 0xf0, 0x6, 0x20, 0xd6, 0xfe, 0x4c, 0x9d, 0xfe, 0x20, 0x7, 0xff, 0x20, 0xbb, 0xee, 
-0x4c, 0xb6, 0xfe, 0x8a, 0x29, 0x2, 0xf0, 0x6, 0x20, 0xd6, 0xfe, 0x4c, 0xb6, 0xfe, 0x8a, 0x29, 
-0x10, 0xf0, 0x3, 0x20, 0x7, 0xff, 0xad, 0xa1, 0x2, 0x8d, 0xd, 0xdd, 0x68, 0xa8, 0x68, 0xaa, 
-0x68, 0x40, 0xc1, 0x27, 0x3e, 0x1a, 0xc5, 0x11, 0x74, 0xe, 0xed, 0xc, 0x45, 0x6, 0xf0, 0x2, 
-0x46, 0x1, 0xb8, 0x0, 0x71, 0x0, 0xad, 0x1, 0xdd, 0x29, 0x1, 0x85, 0xa7, 0xad, 0x6, 0xdd, 
-0xe9, 0x1c, 0x6d, 0x99, 0x2, 0x8d, 0x6, 0xdd, 0xad, 0x7, 0xdd, 0x6d, 0x9a, 0x2, 0x8d, 0x7, 
-0xdd, 0xa9, 0x11, 0x8d, 0xf, 0xdd, 0xad, 0xa1, 0x2, 0x8d, 0xd, 0xdd, 0xa9, 0xff, 0x8d, 0x6, 
-0xdd, 0x8d, 0x7, 0xdd, 0x4c, 0x59, 0xef, 0xad, 0x95, 0x2, 0x8d, 0x6, 0xdd, 0xad, 0x96, 0x2, 
-0x8d, 0x7, 0xdd, 0xa9, 0x11, 0x8d, 0xf, 0xdd, 0xa9, 0x12, 0x4d, 0xa1, 0x2, 0x8d, 0xa1, 0x2, 
-0xa9, 0xff, 0x8d, 0x6, 0xdd, 0x8d, 0x7, 0xdd, 0xae, 0x98, 0x2, 0x86, 0xa8, 0x60, 0xaa, 0xad, 
-0x96, 0x2, 0x2a, 0xa8, 0x8a, 0x69, 0xc8, 0x8d, 0x99, 0x2, 0x98, 0x69, 0x0, 0x8d, 0x9a, 0x2, 
-0x60, 0xea, 0xea, 0x8, 0x68, 0x29, 0xef, 0x48, 0x48, 0x8a, 0x48, 0x98, 0x48, 0xba, 0xbd, 0x4, 
-0x1, 0x29, 0x10, 0xf0, 0x3, 0x6c, 0x16, 0x3, 0x6c, 0x14, 0x3, 0x20, 0x18, 0xe5, 0xad, 0x12, 
-0xd0, 0xd0, 0xfb, 0xad, 0x19, 0xd0, 0x29, 0x1, 0x8d, 0xa6, 0x2, 0x4c, 0xdd, 0xfd, 0xa9, 0x81, 
-0x8d, 0xd, 0xdc, 0xad, 0xe, 0xdc, 0x29, 0x80, 0x9, 0x11, 0x8d, 0xe, 0xdc, 0x4c, 0x8e, 0xee, 
-0x3, 0x4c, 0x5b, 0xff, 0x4c, 0xa3, 0xfd, 0x4c, 0x50, 0xfd, 0x4c, 0x15, 0xfd, 0x4c, 0x1a, 0xfd, 
-0x4c, 0x18, 0xfe, 0x4c, 0xb9, 0xed, 0x4c, 0xc7, 0xed, 0x4c, 0x25, 0xfe, 0x4c, 0x34, 0xfe, 0x4c, 
-0x87, 0xea, 0x4c, 0x21, 0xfe, 0x4c, 0x13, 0xee, 0x4c, 0xdd, 0xed, 0x4c, 0xef, 0xed, 0x4c, 0xfe, 
-0xed, 0x4c, 0xc, 0xed, 0x4c, 0x9, 0xed, 0x4c, 0x7, 0xfe, 0x4c, 0x0, 0xfe, 0x4c, 0xf9, 0xfd, 
-0x6c, 0x1a, 0x3, 0x6c, 0x1c, 0x3, 0x6c, 0x1e, 0x3, 0x6c, 0x20, 0x3, 0x6c, 0x22, 0x3, 0x6c, 
-0x24, 0x3, 0x6c, 0x26, 0x3, 0x4c, 0x9e, 0xf4, 0x4c, 0xdd, 0xf5, 0x4c, 0xe4, 0xf6, 0x4c, 0xdd, 
-0xf6, 0x6c, 0x28, 0x3, 0x6c, 0x2a, 0x3, 0x6c, 0x2c, 0x3, 0x4c, 0x9b, 0xf6, 0x4c, 0x5, 0xe5, 
-0x4c, 0xa, 0xe5, 0x4c, 0x0, 0xe5, 0x52, 0x52, 0x42, 0x59, 0x43, 0xfe, 0xe2, 0xfc, 0x48, 0xff, 
-
-};
-dump_item dump_items[DUMP_NUM_ITEMS] = {
-{ "c64_char", dump_c64_char, 4096 },
+static const unsigned char dump_c64_basic_lz4[] =
+"\xf0\xa3\x94\xe3\x7b\xe3\x43\x42\x4d\x42\x41\x53\x49\x43\x30\xa8\x41\xa7\x1d\xad\xf7\xa8\xa4\xab\xbe\xab\x80\xb0\x05\xac\xa4\xa9"
+"\x9f\xa8\x70\xa8\x27\xa9\x1c\xa8\x82\xa8\xd1\xa8\x3a\xa9\x2e\xa8\x4a\xa9\x2c\xb8\x67\xe1\x55\xe1\x64\xe1\xb2\xb3\x23\xb8\x7f\xaa"
+"\x9f\xaa\x56\xa8\x9b\xa6\x5d\xa6\x85\xaa\x29\xe1\xbd\xe1\xc6\xe1\x7a\xab\x41\xa6\x39\xbc\xcc\xbc\x58\xbc\x10\x03\x7d\xb3\x9e\xb3"
+"\x71\xbf\x97\xe0\xea\xb9\xed\xbf\x64\xe2\x6b\xe2\xb4\xe2\x0e\xe3\x0d\xb8\x7c\xb7\x65\xb4\xad\xb7\x8b\xb7\xec\xb6\x00\xb7\x2c\xb7"
+"\x37\xb7\x79\x69\xb8\x79\x52\xb8\x7b\x2a\xba\x7b\x11\xbb\x7f\x7a\xbf\x50\xe8\xaf\x46\xe5\xaf\x7d\xb3\xbf\x5a\xd3\xae\x64\x15\xb0"
+"\x45\x4e\xc4\x46\x4f\xd2\x4e\x45\x58\xd4\x44\x41\x54\xc1\x49\x4e\x50\x55\x54\xa3\x06\x00\xf0\x3f\xd4\x44\x49\xcd\x52\x45\x41\xc4"
+"\x4c\x45\xd4\x47\x4f\x54\xcf\x52\x55\xce\x49\xc6\x52\x45\x53\x54\x4f\x52\xc5\x47\x4f\x53\x55\xc2\x52\x45\x54\x55\x52\xce\x52\x45"
+"\xcd\x53\x54\x4f\xd0\x4f\xce\x57\x41\x49\xd4\x4c\x4f\x41\xc4\x53\x41\x56\xc5\x56\x45\x52\x49\x46\xd9\x44\x45\xc6\x50\x4f\x4b\xc5"
+"\x50\x52\x49\x4e\x54\xa3\x06\x00\xf0\x95\xd4\x43\x4f\x4e\xd4\x4c\x49\x53\xd4\x43\x4c\xd2\x43\x4d\xc4\x53\x59\xd3\x4f\x50\x45\xce"
+"\x43\x4c\x4f\x53\xc5\x47\x45\xd4\x4e\x45\xd7\x54\x41\x42\xa8\x54\xcf\x46\xce\x53\x50\x43\xa8\x54\x48\x45\xce\x4e\x4f\xd4\x53\x54"
+"\x45\xd0\xab\xad\xaa\xaf\xde\x41\x4e\xc4\x4f\xd2\xbe\xbd\xbc\x53\x47\xce\x49\x4e\xd4\x41\x42\xd3\x55\x53\xd2\x46\x52\xc5\x50\x4f"
+"\xd3\x53\x51\xd2\x52\x4e\xc4\x4c\x4f\xc7\x45\x58\xd0\x43\x4f\xd3\x53\x49\xce\x54\x41\xce\x41\x54\xce\x50\x45\x45\xcb\x4c\x45\xce"
+"\x53\x54\x52\xa4\x56\x41\xcc\x41\x53\xc3\x43\x48\x52\xa4\x4c\x45\x46\x54\xa4\x52\x49\x47\x48\x54\xa4\x4d\x49\x44\xa4\x47\xcf\x00"
+"\x54\x4f\x4f\x20\x4d\x41\x4e\x59\x20\x46\x49\x4c\x45\xd3\x05\x00\x10\x20\x97\x00\x01\x09\x00\x3a\x4e\x4f\x54\x0d\x00\xc0\x46\x4f"
+"\x55\x4e\xc4\x44\x45\x56\x49\x43\x45\x20\x1d\x00\x70\x50\x52\x45\x53\x45\x4e\xd4\x0b\x00\x00\x34\x01\x10\x54\x45\x00\x10\xc5\x0e"
+"\x00\x52\x4f\x55\x54\x50\x55\x0f\x00\x70\x4d\x49\x53\x53\x49\x4e\x47\x1b\x00\xe4\x45\x20\x4e\x41\x4d\xc5\x49\x4c\x4c\x45\x47\x41"
+"\x4c\x20\x48\x00\x40\x55\x4d\x42\x45\x81\x01\x70\x54\x20\x57\x49\x54\x48\x4f\x37\x00\x81\x4f\xd2\x53\x59\x4e\x54\x41\xd8\x65\x01"
+"\x15\x4e\x18\x00\x01\x79\x01\x00\x21\x00\x31\x4f\x46\x20\xae\x01\x03\x4a\x00\xf3\x01\x51\x55\x41\x4e\x54\x49\x54\xd9\x4f\x56\x45"
+"\x52\x46\x4c\x4f\xd7\x23\x00\xf5\x32\x4d\x45\x4d\x4f\x52\xd9\x55\x4e\x44\x45\x46\x27\x44\x20\x53\x54\x41\x54\x45\x4d\x45\x4e\xd4"
+"\x42\x41\x44\x20\x53\x55\x42\x53\x43\x52\x49\x50\xd4\x52\x45\x44\x49\x4d\x27\x44\x20\x41\x52\x52\x41\xd9\x44\x49\x56\x49\x53\x49"
+"\x4f\x4e\x20\x42\x59\x20\x5a\x45\x52\xcf\xaa\x00\xf0\x06\x49\x52\x45\x43\xd4\x54\x59\x50\x45\x20\x4d\x49\x53\x4d\x41\x54\x43\xc8"
+"\x53\x54\x52\xd5\x00\x00\x3e\x01\x41\x4c\x4f\x4e\xc7\x2f\x01\x00\x93\x00\x80\x46\x4f\x52\x4d\x55\x4c\x41\x20\x19\x00\xf4\x06\x43"
+"\x4f\x4d\x50\x4c\x45\xd8\x43\x41\x4e\x27\x54\x20\x43\x4f\x4e\x54\x49\x4e\x55\xc5\x8f\x00\x82\x46\x55\x4e\x43\x54\x49\x4f\xce\x2d"
+"\x02\x00\x3b\x02\xf0\xb8\x9e\xa1\xac\xa1\xb5\xa1\xc2\xa1\xd0\xa1\xe2\xa1\xf0\xa1\xff\xa1\x10\xa2\x25\xa2\x35\xa2\x3b\xa2\x4f\xa2"
+"\x5a\xa2\x6a\xa2\x72\xa2\x7f\xa2\x90\xa2\x9d\xa2\xaa\xa2\xba\xa2\xc8\xa2\xd5\xa2\xe4\xa2\xed\xa2\x00\xa3\x0e\xa3\x1e\xa3\x24\xa3"
+"\x83\xa3\x0d\x4f\x4b\x0d\x00\x20\x20\x45\x52\x52\x4f\x52\x00\x20\x49\x4e\x20\x00\x0d\x0a\x52\x45\x41\x44\x59\x2e\x0d\x0a\x00\x0d"
+"\x0a\x42\x52\x45\x41\x4b\x00\xa0\xba\xe8\xe8\xe8\xe8\xbd\x01\x01\xc9\x81\xd0\x21\xa5\x4a\xd0\x0a\xbd\x02\x01\x85\x49\xbd\x03\x01"
+"\x85\x4a\xdd\x03\x01\xd0\x07\xa5\x49\xdd\x02\x01\xf0\x07\x8a\x18\x69\x12\xaa\xd0\xd8\x60\x20\x08\xa4\x85\x31\x84\x32\x38\xa5\x5a"
+"\xe5\x5f\x85\x22\xa8\xa5\x5b\xe5\x60\xaa\xe8\x98\xf0\x23\xa5\x5a\x38\xe5\x22\x85\x5a\xb0\x03\xc6\x5b\x38\xa5\x58\xe5\x22\x85\x58"
+"\xb0\x08\xc6\x59\x90\x04\xb1\x5a\x91\x58\x88\xd0\xf9\x07\x00\xf1\x74\xc6\x5b\xc6\x59\xca\xd0\xf2\x60\x0a\x69\x3e\xb0\x35\x85\x22"
+"\xba\xe4\x22\x90\x2e\x60\xc4\x34\x90\x28\xd0\x04\xc5\x33\x90\x22\x48\xa2\x09\x98\x48\xb5\x57\xca\x10\xfa\x20\x26\xb5\xa2\xf7\x68"
+"\x95\x61\xe8\x30\xfa\x68\xa8\x68\xc4\x34\x90\x06\xd0\x05\xc5\x33\xb0\x01\x60\xa2\x10\x6c\x00\x03\x8a\x0a\xaa\xbd\x26\xa3\x85\x22"
+"\xbd\x27\xa3\x85\x23\x20\xcc\xff\xa9\x00\x85\x13\x20\xd7\xaa\x20\x45\xab\xa0\x00\xb1\x22\x48\x29\x7f\x20\x47\xab\xc8\x68\x10\xf4"
+"\x20\x7a\xa6\xa9\x69\xa0\xa3\x20\x1e\xab\xa4\x3a\xc8\xf0\x03\x20\xc2\xbd\xa9\x76\x0f\x00\xf2\xa0\xa9\x80\x20\x90\xff\x6c\x02\x03"
+"\x20\x60\xa5\x86\x7a\x84\x7b\x20\x73\x00\xaa\xf0\xf0\xa2\xff\x86\x3a\x90\x06\x20\x79\xa5\x4c\xe1\xa7\x20\x6b\xa9\x20\x79\xa5\x84"
+"\x0b\x20\x13\xa6\x90\x44\xa0\x01\xb1\x5f\x85\x23\xa5\x2d\x85\x22\xa5\x60\x85\x25\xa5\x5f\x88\xf1\x5f\x18\x65\x2d\x85\x2d\x85\x24"
+"\xa5\x2e\x69\xff\x85\x2e\xe5\x60\xaa\x38\xa5\x5f\xe5\x2d\xa8\xb0\x03\xe8\xc6\x25\x18\x65\x22\x90\x03\xc6\x23\x18\xb1\x22\x91\x24"
+"\xc8\xd0\xf9\xe6\x23\xe6\x25\xca\xd0\xf2\x20\x59\xa6\x20\x33\xa5\xad\x00\x02\xf0\x88\x18\xa5\x2d\x85\x5a\x65\x0b\x85\x58\xa4\x2e"
+"\x84\x5b\x90\x01\xc8\x84\x59\x20\xb8\xa3\xa5\x14\xa4\x15\x8d\xfe\x01\x8c\xff\x01\xa5\x31\xa4\x32\x85\x2d\x84\x2e\xa4\x0b\x88\xb9"
+"\xfc\x01\x91\x5f\x88\x10\xf8\x3d\x00\xf0\xaf\x4c\x80\xa4\xa5\x2b\xa4\x2c\x85\x22\x84\x23\x18\xa0\x01\xb1\x22\xf0\x1d\xa0\x04\xc8"
+"\xb1\x22\xd0\xfb\xc8\x98\x65\x22\xaa\xa0\x00\x91\x22\xa5\x23\x69\x00\xc8\x91\x22\x86\x22\x85\x23\x90\xdd\x60\xa2\x00\x20\x12\xe1"
+"\xc9\x0d\xf0\x0d\x9d\x00\x02\xe8\xe0\x59\x90\xf1\xa2\x17\x4c\x37\xa4\x4c\xca\xaa\x6c\x04\x03\xa6\x7a\xa0\x04\x84\x0f\xbd\x00\x02"
+"\x10\x07\xc9\xff\xf0\x3e\xe8\xd0\xf4\xc9\x20\xf0\x37\x85\x08\xc9\x22\xf0\x56\x24\x0f\x70\x2d\xc9\x3f\xd0\x04\xa9\x99\xd0\x25\xc9"
+"\x30\x90\x04\xc9\x3c\x90\x1d\x84\x71\xa0\x00\x84\x0b\x88\x86\x7a\xca\xc8\xe8\xbd\x00\x02\x38\xf9\x9e\xa0\xf0\xf5\xc9\x80\xd0\x30"
+"\x05\x0b\xa4\x71\xe8\xc8\x99\xfb\x01\xb9\xfb\x01\xf0\x36\x38\xe9\x3a\xf0\x04\xc9\x49\xd0\x02\x85\x0f\x38\xe9\x55\xd0\x9f\x85\x08"
+"\xbd\x00\x02\xf0\xdf\xc5\x08\xf0\xdb\x24\x00\xf0\x03\xe8\xd0\xf0\xa6\x7a\xe6\x0b\xc8\xb9\x9d\xa0\x10\xfa\xb9\x9e\xa0\xd0\xb4\x82"
+"\x00\xf0\x5c\xbe\x99\xfd\x01\xc6\x7b\xa9\xff\x85\x7a\x60\xa5\x2b\xa6\x2c\xa0\x01\x85\x5f\x86\x60\xb1\x5f\xf0\x1f\xc8\xc8\xa5\x15"
+"\xd1\x5f\x90\x18\xf0\x03\x88\xd0\x09\xa5\x14\x88\xd1\x5f\x90\x0c\xf0\x0a\x88\xb1\x5f\xaa\x88\xb1\x5f\xb0\xd7\x18\x60\xd0\xfd\xa9"
+"\x00\xa8\x91\x2b\xc8\x91\x2b\xa5\x2b\x18\x69\x02\x85\x2d\xa5\x2c\x69\x00\x85\x2e\x20\x8e\xa6\xa9\x00\xd0\x2d\x20\xe7\xff\xa5\x37"
+"\xa4\x38\x85\x33\x84\x34\xa5\x2d\xa4\x2e\x85\x2f\x84\x30\xb8\x02\xf0\x1e\x20\x1d\xa8\xa2\x19\x86\x16\x68\xa8\x68\xa2\xfa\x9a\x48"
+"\x98\x48\xa9\x00\x85\x3e\x85\x10\x60\x18\xa5\x2b\x69\xff\x85\x7a\xa5\x2c\x69\xff\x85\x7b\x60\x90\x06\xf0\x04\xc9\xab\xd0\xe9\x08"
+"\x02\xf0\x23\x13\xa6\x20\x79\x00\xf0\x0c\xc9\xab\xd0\x8e\x20\x73\x00\x20\x6b\xa9\xd0\x86\x68\x68\xa5\x14\x05\x15\xd0\x06\xa9\xff"
+"\x85\x14\x85\x15\xa0\x01\x84\x0f\xb1\x5f\xf0\x43\x20\x2c\xa8\x20\xd7\xaa\xc8\xb1\x5f\x04\x00\xf1\x04\xc5\x15\xd0\x04\xe4\x14\xf0"
+"\x02\xb0\x2c\x84\x49\x20\xcd\xbd\xa9\x20\xa4\x49\x98\x02\xf2\x03\xc9\x22\xd0\x06\xa5\x0f\x49\xff\x85\x0f\xc8\xf0\x11\xb1\x5f\xd0"
+"\x10\xa8\x30\x00\xf0\x1a\x86\x5f\x85\x60\xd0\xb5\x4c\x86\xe3\x6c\x06\x03\x10\xd7\xc9\xff\xf0\xd3\x24\x0f\x30\xcf\x38\xe9\x7f\xaa"
+"\x84\x49\xa0\xff\xca\xf0\x08\xc8\xb9\x9e\xa0\x10\xfa\x30\xf5\x08\x00\xf0\x3a\x30\xb2\x20\x47\xab\xd0\xf5\xa9\x80\x85\x10\x20\xa5"
+"\xa9\x20\x8a\xa3\xd0\x05\x8a\x69\x0f\xaa\x9a\x68\x68\xa9\x09\x20\xfb\xa3\x20\x06\xa9\x18\x98\x65\x7a\x48\xa5\x7b\x69\x00\x48\xa5"
+"\x3a\x48\xa5\x39\x48\xa9\xa4\x20\xff\xae\x20\x8d\xad\x20\x8a\xad\xa5\x66\x09\x7f\x25\x62\x85\x62\xa9\x8b\xa0\xa7\x4d\x02\xf0\x02"
+"\x4c\x43\xae\xa9\xbc\xa0\xb9\x20\xa2\xbb\x20\x79\x00\xc9\xa9\xd0\x06\xe6\x00\xf0\x27\x8a\xad\x20\x2b\xbc\x20\x38\xae\xa5\x4a\x48"
+"\xa5\x49\x48\xa9\x81\x48\x20\x2c\xa8\xa5\x7a\xa4\x7b\xc0\x02\xea\xf0\x04\x85\x3d\x84\x3e\xa0\x00\xb1\x7a\xd0\x43\xa0\x02\xb1\x7a"
+"\x18\xd0\x03\x4c\x4b\xa8\xc8\xb1\x7a\x85\x39\x05\x00\xd0\x3a\x98\x65\x7a\x85\x7a\x90\x02\xe6\x7b\x6c\x08\x03\x4b\x00\xf1\x1e\xed"
+"\xa7\x4c\xae\xa7\xf0\x3c\xe9\x80\x90\x11\xc9\x23\xb0\x17\x0a\xa8\xb9\x0d\xa0\x48\xb9\x0c\xa0\x48\x4c\x73\x00\x4c\xa5\xa9\xc9\x3a"
+"\xf0\xd6\x4c\x08\xaf\xc9\x4b\xd0\xf9\x20\x73\x00\xa8\x00\xf0\x0b\x4c\xa0\xa8\x38\xa5\x2b\xe9\x01\xa4\x2c\xb0\x01\x88\x85\x41\x84"
+"\x42\x60\x20\xe1\xff\xb0\x01\x18\xd0\x3c\x83\x00\x50\xa6\x3a\xe8\xf0\x0c\x83\x00\xf4\x3d\xa5\x39\xa4\x3a\x85\x3b\x84\x3c\x68\x68"
+"\xa9\x81\xa0\xa3\x90\x03\x4c\x69\xa4\x4c\x86\xe3\xd0\x17\xa2\x1a\xa4\x3e\xd0\x03\x4c\x37\xa4\xa5\x3d\x85\x7a\x84\x7b\xa5\x3b\xa4"
+"\x3c\x85\x39\x84\x3a\x60\x08\xa9\x00\x20\x90\xff\x28\xd0\x03\x4c\x59\xa6\x20\x60\xa6\x4c\x97\xa8\xa9\x03\x20\xfb\xa3\xa5\x7b\x48"
+"\xa5\x7a\x27\x01\xa1\x8d\x48\x20\x79\x00\x20\xa0\xa8\x4c\xae\x04\x04\xf0\x09\x09\xa9\x38\xa5\x39\xe5\x14\xa5\x3a\xe5\x15\xb0\x0b"
+"\x98\x38\x65\x7a\xa6\x7b\x90\x07\xe8\xb0\x04\xa9\x02\xf0\x02\x20\x17\xa6\x90\x1e\xa5\x5f\xe9\x01\x85\x7a\xa5\x60\xe9\x00\x85\x7b"
+"\x90\x02\xf0\x01\xff\x85\x4a\x20\x8a\xa3\x9a\xc9\x8d\xf0\x0b\xa2\x0c\x2c\xa2\x11\x72\x03\xf4\x05\x08\xaf\x68\x68\x85\x39\x68\x85"
+"\x3a\x68\x85\x7a\x68\x85\x7b\x20\x06\xa9\x98\x18\x24\x01\xf0\x17\x60\xa2\x3a\x2c\xa2\x00\x86\x07\xa0\x00\x84\x08\xa5\x08\xa6\x07"
+"\x85\x07\x86\x08\xb1\x7a\xf0\xe8\xc5\x08\xf0\xe4\xc8\xc9\x22\xd0\xf3\xf0\xe9\x20\x9e\xad\x99\x01\xf0\x01\x89\xf0\x05\xa9\xa7\x20"
+"\xff\xae\xa5\x61\xd0\x05\x20\x09\xa9\xf0\xae\x01\xf0\x0d\xb0\x03\x4c\xa0\xa8\x4c\xed\xa7\x20\x9e\xb7\x48\xc9\x8d\xf0\x04\xc9\x89"
+"\xd0\x91\xc6\x65\xd0\x04\x68\x4c\xef\xa7\x7b\x01\xf0\x3c\x6b\xa9\xc9\x2c\xf0\xee\x68\x60\xa2\x00\x86\x14\x86\x15\xb0\xf7\xe9\x2f"
+"\x85\x07\xa5\x15\x85\x22\xc9\x19\xb0\xd4\xa5\x14\x0a\x26\x22\x0a\x26\x22\x65\x14\x85\x14\xa5\x22\x65\x15\x85\x15\x06\x14\x26\x15"
+"\xa5\x14\x65\x07\x85\x14\x90\x02\xe6\x15\x20\x73\x00\x4c\x71\xa9\x20\x8b\xb0\x85\x49\x84\x4a\xa9\xb2\x7a\x00\xf1\x37\x0e\x48\xa5"
+"\x0d\x48\x20\x9e\xad\x68\x2a\x20\x90\xad\xd0\x18\x68\x10\x12\x20\x1b\xbc\x20\xbf\xb1\xa0\x00\xa5\x64\x91\x49\xc8\xa5\x65\x91\x49"
+"\x60\x4c\xd0\xbb\x68\xa4\x4a\xc0\xbf\xd0\x4c\x20\xa6\xb6\xc9\x06\xd0\x3d\xa0\x00\x84\x61\x84\x66\x84\x71\x20\x1d\xaa\x20\xe2\xba"
+"\xe6\x71\xa4\x0a\x00\xf5\x6a\x0c\xbc\xaa\xf0\x05\xe8\x8a\x20\xed\xba\xa4\x71\xc8\xc0\x06\xd0\xdf\x20\xe2\xba\x20\x9b\xbc\xa6\x64"
+"\xa4\x63\xa5\x65\x4c\xdb\xff\xb1\x22\x20\x80\x00\x90\x03\x4c\x48\xb2\xe9\x2f\x4c\x7e\xbd\xa0\x02\xb1\x64\xc5\x34\x90\x17\xd0\x07"
+"\x88\xb1\x64\xc5\x33\x90\x0e\xa4\x65\xc4\x2e\x90\x08\xd0\x0d\xa5\x64\xc5\x2d\xb0\x07\xa5\x64\xa4\x65\x4c\x68\xaa\xa0\x00\xb1\x64"
+"\x20\x75\xb4\xa5\x50\xa4\x51\x85\x6f\x84\x70\x20\x7a\xb6\xa9\x61\xa0\x00\x85\x50\x84\x51\x20\xdb\xb6\xa0\x00\xb1\x50\x91\x49\xc8"
+"\x05\x00\xf0\x0f\x60\x20\x86\xaa\x4c\xb5\xab\x20\x9e\xb7\xf0\x05\xa9\x2c\x20\xff\xae\x08\x86\x13\x20\x18\xe1\x28\x4c\xa0\xaa\x20"
+"\x21\xab\xf3\x03\xf0\x12\x35\xf0\x43\xc9\xa3\xf0\x50\xc9\xa6\x18\xf0\x4b\xc9\x2c\xf0\x37\xc9\x3b\xf0\x5e\x20\x9e\xad\x24\x0d\x30"
+"\xde\x20\xdd\xbd\x20\x87\xb4\x28\x00\xf0\x24\x3b\xab\xd0\xd3\xa9\x00\x9d\x00\x02\xa2\xff\xa0\x01\xa5\x13\xd0\x10\xa9\x0d\x20\x47"
+"\xab\x24\x13\x10\x05\xa9\x0a\x20\x47\xab\x49\xff\x60\x38\x20\xf0\xff\x98\x38\xe9\x0a\xb0\xfc\x49\xff\x69\x01\xd0\x16\x08\x11\x00"
+"\xf1\x05\x84\x09\x20\x9b\xb7\xc9\x29\xd0\x59\x28\x90\x06\x8a\xe5\x09\x90\x05\xaa\xe8\xca\x7a\x03\x80\x4c\xa2\xaa\x20\x3b\xab\xd0"
+"\xf2\x5f\x00\xb0\xa6\xb6\xaa\xa0\x00\xe8\xca\xf0\xbc\xb1\x22\xd2\x06\xf0\x1b\xc9\x0d\xd0\xf3\x20\xe5\xaa\x4c\x28\xab\xa5\x13\xf0"
+"\x03\xa9\x20\x2c\xa9\x1d\x2c\xa9\x3f\x20\x0c\xe1\x29\xff\x60\xa5\x11\xf0\x11\x30\x04\xa0\xff\xd0\x04\xa5\x3f\xa4\x40\xef\x02\xf0"
+"\x08\x4c\x08\xaf\xa5\x13\xf0\x05\xa2\x18\x4c\x37\xa4\xa9\x0c\xa0\xad\x20\x1e\xab\xa5\x3d\xa4\x3e\x12\x03\x80\x60\x20\xa6\xb3\xc9"
+"\x23\xd0\x10\x23\x02\x21\x9e\xb7\xfd\x00\xf8\x0a\x86\x13\x20\x1e\xe1\xa2\x01\xa0\x02\xa9\x00\x8d\x01\x02\xa9\x40\x20\x0f\xac\xa6"
+"\x13\xd0\x13\x60\x20\x20\x00\xf0\x07\x20\xce\xab\xa5\x13\x20\xcc\xff\xa2\x00\x86\x13\x60\xc9\x22\xd0\x0b\x20\xbd\xae\xa9\x3b\x59"
+"\x04\xc0\x21\xab\x20\xa6\xb3\xa9\x2c\x8d\xff\x01\x20\xf9\x9e\x00\xf3\x2a\x0d\x20\xb7\xff\x29\x02\xf0\x06\x20\xb5\xab\x4c\xf8\xa8"
+"\xad\x00\x02\xd0\x1e\xa5\x13\xd0\xe3\x20\x06\xa9\x4c\xfb\xa8\xa5\x13\xd0\x06\x20\x45\xab\x20\x3b\xab\x4c\x60\xa5\xa6\x41\xa4\x42"
+"\xa9\x98\x2c\xa9\x00\x85\x11\x86\x43\x84\x44\x70\x02\x00\xe8\x03\x81\x85\x4b\x84\x4c\xa6\x43\xa4\x44\xa2\x07\xc2\x79\x00\xd0\x20"
+"\x24\x11\x50\x0c\x20\x24\xe1\x8d\x6c\x01\x80\xd0\x0c\x30\x75\xa5\x13\xd0\x03\x4a\x00\x21\xf9\xab\x25\x00\xf0\x13\x73\x00\x24\x0d"
+"\x10\x31\x24\x11\x50\x09\xe8\x86\x7a\xa9\x00\x85\x07\xf0\x0c\x85\x07\xc9\x22\xf0\x07\xa9\x3a\x85\x07\xa9\x2c\x18\x85\x08\x58\x00"
+"\xf0\x0a\x69\x00\x90\x01\xc8\x20\x8d\xb4\x20\xe2\xb7\x20\xda\xa9\x4c\x91\xac\x20\xf3\xbc\xa5\x0e\x20\xc2\xa9\xf4\x01\x80\x07\xc9"
+"\x2c\xf0\x03\x4c\x4d\xab\x29\x00\x80\x85\x43\x84\x44\xa5\x4b\xa4\x4c\x33\x01\x00\x1c\x00\xf0\x06\x2d\x20\xfd\xae\x4c\x15\xac\x20"
+"\x06\xa9\xc8\xaa\xd0\x12\xa2\x0d\xc8\xb1\x7a\xf0\x6c\xf3\x04\xf0\x3d\x3f\xc8\xb1\x7a\xc8\x85\x40\x20\xfb\xa8\x20\x79\x00\xaa\xe0"
+"\x83\xd0\xdc\x4c\x51\xac\xa5\x43\xa4\x44\xa6\x11\x10\x03\x4c\x27\xa8\xa0\x00\xb1\x43\xf0\x0b\xa5\x13\xd0\x07\xa9\xfc\xa0\xac\x4c"
+"\x1e\xab\x60\x3f\x45\x58\x54\x52\x41\x20\x49\x47\x4e\x4f\x52\x45\x44\x0d\x00\x3f\x52\x45\x44\x4f\x20\x46\x52\x4f\x4d\x90\x0a\xa3"
+"\x52\x54\x0d\x00\xd0\x04\xa0\x00\xf0\x03\x0f\x01\xf0\x43\x20\x8a\xa3\xf0\x05\xa2\x0a\x4c\x37\xa4\x9a\x8a\x18\x69\x04\x48\x69\x06"
+"\x85\x24\x68\xa0\x01\x20\xa2\xbb\xba\xbd\x09\x01\x85\x66\xa5\x49\xa4\x4a\x20\x67\xb8\x20\xd0\xbb\xa0\x01\x20\x5d\xbc\xba\x38\xfd"
+"\x09\x01\xf0\x17\xbd\x0f\x01\x85\x39\xbd\x10\x01\x85\x3a\xbd\x12\x01\x85\x7a\xbd\x11\x01\x85\x7b\x4c\xae\xa7\x8a\x69\x11\xaa\x9a"
+"\x52\x04\x30\x2c\xd0\xf1\x02\x02\xf0\x17\x24\xad\x20\x9e\xad\x18\x24\x38\x24\x0d\x30\x03\xb0\x03\x60\xb0\xfd\xa2\x16\x4c\x37\xa4"
+"\xa6\x7a\xd0\x02\xc6\x7b\xc6\x7a\xa2\x00\x24\x48\x8a\x48\xa9\x01\x57\x06\xf0\x10\x83\xae\xa9\x00\x85\x4d\x20\x79\x00\x38\xe9\xb1"
+"\x90\x17\xc9\x03\xb0\x13\xc9\x01\x2a\x49\x01\x45\x4d\xc5\x4d\x90\x61\x85\x4d\x32\x04\xf4\x27\xbb\xad\xa6\x4d\xd0\x2c\xb0\x7b\x69"
+"\x07\x90\x77\x65\x0d\xd0\x03\x4c\x3d\xb6\x69\xff\x85\x22\x0a\x65\x22\xa8\x68\xd9\x80\xa0\xb0\x67\x20\x8d\xad\x48\x20\x20\xae\x68"
+"\xa4\x4b\x10\x17\xaa\xf0\x56\xd0\x5f\x46\x0d\x8a\x2a\x6d\x00\x60\xa0\x1b\x85\x4d\xd0\xd7\x28\x00\xf0\x04\x48\x90\xd9\xb9\x82\xa0"
+"\x48\xb9\x81\xa0\x48\x20\x33\xae\xa5\x4d\x4c\xa9\xad\xd1\x02\xf0\x7a\x66\xbe\x80\xa0\xa8\x68\x85\x22\xe6\x22\x68\x85\x23\x98\x48"
+"\x20\x1b\xbc\xa5\x65\x48\xa5\x64\x48\xa5\x63\x48\xa5\x62\x48\xa5\x61\x48\x6c\x22\x00\xa0\xff\x68\xf0\x23\xc9\x64\xf0\x03\x20\x8d"
+"\xad\x84\x4b\x68\x4a\x85\x12\x68\x85\x69\x68\x85\x6a\x68\x85\x6b\x68\x85\x6c\x68\x85\x6d\x68\x85\x6e\x45\x66\x85\x6f\xa5\x61\x60"
+"\x6c\x0a\x03\xa9\x00\x85\x0d\x20\x73\x00\xb0\x03\x4c\xf3\xbc\x20\x13\xb1\x90\x03\x4c\x28\xaf\xc9\xff\xd0\x0f\xa9\xa8\xa0\xae\x20"
+"\xa2\xbb\x4c\x73\x00\x82\x49\x0f\xda\xa1\xc9\x2e\xf0\xde\xc9\xab\xf0\x58\xc9\xaa\xf0\xd1\xc9\x22\xd0\x0f\x20\x02\x02\x49\x02\xf0"
+"\x52\x87\xb4\x4c\xe2\xb7\xc9\xa8\xd0\x13\xa0\x18\xd0\x3b\x20\xbf\xb1\xa5\x65\x49\xff\xa8\xa5\x64\x49\xff\x4c\x91\xb3\xc9\xa5\xd0"
+"\x03\x4c\xf4\xb3\xc9\xb4\x90\x03\x4c\xa7\xaf\x20\xfa\xae\x20\x9e\xad\xa9\x29\x2c\xa9\x28\x2c\xa9\x2c\xa0\x00\xd1\x7a\xd0\x03\x4c"
+"\x73\x00\xa2\x0b\x4c\x37\xa4\xa0\x15\x68\x68\x4c\xfa\xad\x38\xa5\x64\xe9\x00\xa5\x65\xe9\xa0\x90\x08\xa9\xa2\xe5\x64\xa9\xe3\xe5"
+"\x65\x60\x04\x02\xf0\x26\x64\x84\x65\xa6\x45\xa4\x46\xa5\x0d\xf0\x26\xa9\x00\x85\x70\x20\x14\xaf\x90\x1c\xe0\x54\xd0\x18\xc0\xc9"
+"\xd0\x14\x20\x84\xaf\x84\x5e\x88\x84\x71\xa0\x06\x84\x5d\xa0\x24\x20\x68\xbe\x4c\x6f\xb4\x60\x24\x0e\x10\x0d\x0f\x05\x90\xaa\xc8"
+"\xb1\x64\xa8\x8a\x4c\x91\xb3\x33\x00\xf1\x1f\x2d\xe0\x54\xd0\x1b\xc0\x49\xd0\x25\x20\x84\xaf\x98\xa2\xa0\x4c\x4f\xbc\x20\xde\xff"
+"\x86\x64\x84\x63\x85\x65\xa0\x00\x84\x62\x60\xe0\x53\xd0\x0a\xc0\x54\xd0\x06\x20\xb7\xff\x4c\x3c\xbc\x55\x05\xc2\xa2\xbb\x0a\x48"
+"\xaa\x20\x73\x00\xe0\x8f\x90\x20\xc0\x00\x82\x20\xfd\xae\x20\x8f\xad\x68\xaa\x79\x01\xf0\x15\x8a\x48\x20\x9e\xb7\x68\xa8\x8a\x48"
+"\x4c\xd6\xaf\x20\xf1\xae\x68\xa8\xb9\xea\x9f\x85\x55\xb9\xeb\x9f\x85\x56\x20\x54\x00\x4c\x8d\xad\xa0\xff\x2c\x3b\x0a\x00\x19\x01"
+"\xe0\x64\x45\x0b\x85\x07\xa5\x65\x45\x0b\x85\x08\x20\xfc\xbb\x12\x00\xf0\x01\x65\x45\x0b\x25\x08\x45\x0b\xa8\xa5\x64\x45\x0b\x25"
+"\x07\x45\x0b\xa8\x00\xf0\x08\x90\xad\xb0\x13\xa5\x6e\x09\x7f\x25\x6a\x85\x6a\xa9\x69\xa0\x00\x20\x5b\xbc\xaa\x4c\x61\xb0\xa8\x01"
+"\xf0\x39\xc6\x4d\x20\xa6\xb6\x85\x61\x86\x62\x84\x63\xa5\x6c\xa4\x6d\x20\xaa\xb6\x86\x6c\x84\x6d\xaa\x38\xe5\x61\xf0\x08\xa9\x01"
+"\x90\x04\xa6\x61\xa9\xff\x85\x66\xa0\xff\xe8\xc8\xca\xd0\x07\xa6\x66\x30\x0f\x18\x90\x0c\xb1\x6c\xd1\x62\xf0\xef\xa2\xff\xb0\x02"
+"\xa2\x01\xe8\x8a\x2a\x25\x12\xf0\x02\xa9\xde\x00\xc0\x20\xfd\xae\xaa\x20\x90\xb0\x20\x79\x00\xd0\xf4\x2b\x0b\x60\x79\x00\x86\x0c"
+"\x85\x45\xfd\x07\xf0\x03\x13\xb1\xb0\x03\x4c\x08\xaf\xa2\x00\x86\x0d\x86\x0e\x20\x73\x00\x90\x05\x18\x02\x10\x0b\x06\x01\x91\x90"
+"\xfb\x20\x13\xb1\xb0\xf6\xc9\x24\xfb\x09\xf0\x07\x0d\xd0\x10\xc9\x25\xd0\x13\xa5\x10\xd0\xd0\xa9\x80\x85\x0e\x05\x45\x85\x45\x8a"
+"\x09\x80\x28\x00\x60\x86\x46\x38\x05\x10\xe9\x6a\x08\xf0\x43\xd1\xb1\xa0\x00\x84\x10\xa5\x2d\xa6\x2e\x86\x60\x85\x5f\xe4\x30\xd0"
+"\x04\xc5\x2f\xf0\x22\xa5\x45\xd1\x5f\xd0\x08\xa5\x46\xc8\xd1\x5f\xf0\x7d\x88\x18\xa5\x5f\x69\x07\x90\xe1\xe8\xd0\xdc\xc9\x41\x90"
+"\x05\xe9\x5b\x38\xe9\xa5\x60\x68\x48\xc9\x2a\xd0\x05\xa9\x13\xa0\xbf\x60\xa5\x45\xa4\x46\xc9\x54\xd0\x0b\xc0\xc9\xf0\xef\xc0\x49"
+"\xd0\x9c\x00\xf1\x01\xc9\x53\xd0\x04\xc0\x54\xf0\xf5\xa5\x2f\xa4\x30\x85\x5f\x84\x60\x34\x0c\xb2\x5a\x84\x5b\x18\x69\x07\x90\x01"
+"\xc8\x85\x58\x53\x0c\x40\x58\xa4\x59\xc8\xf6\x0a\xf8\x01\xa0\x00\xa5\x45\x91\x5f\xc8\xa5\x46\x91\x5f\xa9\x00\xc8\x91\x5f\x03\x00"
+"\x70\xa5\x5f\x18\x69\x02\xa4\x60\x36\x00\xb2\x47\x84\x48\x60\xa5\x0b\x0a\x69\x05\x65\x5f\x11\x00\x90\x58\x84\x59\x60\x90\x80\x00"
+"\x00\x00\xab\x01\x40\x64\xa4\x65\x60\x2e\x04\xf1\x0f\x9e\xad\x20\x8d\xad\xa5\x66\x30\x0d\xa5\x61\xc9\x90\x90\x09\xa9\xa5\xa0\xb1"
+"\x20\x5b\xbc\xd0\x7a\x4c\x9b\xbc\xa5\x0c\x05\x22\x08\xf1\x1a\xa0\x00\x98\x48\xa5\x46\x48\xa5\x45\x48\x20\xb2\xb1\x68\x85\x45\x68"
+"\x85\x46\x68\xa8\xba\xbd\x02\x01\x48\xbd\x01\x01\x48\xa5\x64\x9d\x02\x01\xa5\x65\x9d\x01\x01\xc8\x85\x04\xf0\x06\xf0\xd2\x84\x0b"
+"\x20\xf7\xae\x68\x85\x0d\x68\x85\x0e\x29\x7f\x85\x0c\xa6\x2f\xa5\x30\x0e\x0b\xf1\x0d\xc5\x32\xd0\x04\xe4\x31\xf0\x39\xa0\x00\xb1"
+"\x5f\xc8\xc5\x45\xd0\x06\xa5\x46\xd1\x5f\xf0\x16\xc8\xb1\x5f\x18\x65\x63\x0b\xf0\x1d\x65\x60\x90\xd7\xa2\x12\x2c\xa2\x0e\x4c\x37"
+"\xa4\xa2\x13\xa5\x0c\xd0\xf7\x20\x94\xb1\xa5\x0b\xa0\x04\xd1\x5f\xd0\xe7\x4c\xea\xb2\x20\x94\xb1\x20\x08\xa4\xa0\x00\x84\x72\xa2"
+"\x05\x02\x01\x31\x10\x01\xca\x05\x01\xf0\x0c\x10\x02\xca\xca\x86\x71\xa5\x0b\xc8\xc8\xc8\x91\x5f\xa2\x0b\xa9\x00\x24\x0c\x50\x08"
+"\x68\x18\x69\x01\xaa\x68\x40\x0d\xf3\x12\x5f\xc8\x8a\x91\x5f\x20\x4c\xb3\x86\x71\x85\x72\xa4\x22\xc6\x0b\xd0\xdc\x65\x59\xb0\x5d"
+"\x85\x59\xa8\x8a\x65\x58\x90\x03\xc8\xf0\x52\x01\x0f\xf1\x5a\xa9\x00\xe6\x72\xa4\x71\xf0\x05\x88\x91\x58\xd0\xfb\xc6\x59\xc6\x72"
+"\xd0\xf5\xe6\x59\x38\xa5\x31\xe5\x5f\xa0\x02\x91\x5f\xa5\x32\xc8\xe5\x60\x91\x5f\xa5\x0c\xd0\x62\xc8\xb1\x5f\x85\x0b\xa9\x00\x85"
+"\x71\x85\x72\xc8\x68\xaa\x85\x64\x68\x85\x65\xd1\x5f\x90\x0e\xd0\x06\xc8\x8a\xd1\x5f\x90\x07\x4c\x45\xb2\x4c\x35\xa4\xc8\xa5\x72"
+"\x05\x71\x18\xf0\x0a\x20\x4c\xb3\x8a\x65\x64\xaa\x98\xa4\x22\x65\x65\x86\x71\xc6\x0b\xd0\xca\x85\xbf\x00\x51\x10\x01\xca\xa5\x46"
+"\xba\x00\xf0\x4a\x28\xa9\x00\x20\x55\xb3\x8a\x65\x58\x85\x47\x98\x65\x59\x85\x48\xa8\xa5\x47\x60\x84\x22\xb1\x5f\x85\x28\x88\xb1"
+"\x5f\x85\x29\xa9\x10\x85\x5d\xa2\x00\xa0\x00\x8a\x0a\xaa\x98\x2a\xa8\xb0\xa4\x06\x71\x26\x72\x90\x0b\x18\x8a\x65\x28\xaa\x98\x65"
+"\x29\xa8\xb0\x93\xc6\x5d\xd0\xe3\x60\xa5\x0d\xf0\x03\x20\xa6\xb6\x20\x26\xb5\x38\xa5\x33\xe5\x31\xa8\xa5\x34\xe5\x32\xf2\x02\x90"
+"\x85\x62\x84\x63\xa2\x90\x4c\x44\xbc\xa5\x08\xf1\x0b\xa9\x00\xf0\xeb\xa6\x3a\xe8\xd0\xa0\xa2\x15\x2c\xa2\x1b\x4c\x37\xa4\x20\xe1"
+"\xb3\x20\xa6\xb3\x20\xfa\xae\x7a\x0c\x20\x8b\xb0\x51\x0c\x21\xf7\xae\x1d\x0a\x72\x48\xa5\x48\x48\xa5\x47\x48\x4d\x0b\xc0\x20\xf8"
+"\xa8\x4c\x4f\xb4\xa9\xa5\x20\xff\xae\x09\xa4\x0c\xf0\x05\x92\xb0\x85\x4e\x84\x4f\x4c\x8d\xad\x20\xe1\xb3\xa5\x4f\x48\xa5\x4e\x48"
+"\x20\xf1\x8e\x0c\xf2\x11\x68\x85\x4e\x68\x85\x4f\xa0\x02\xb1\x4e\x85\x47\xaa\xc8\xb1\x4e\xf0\x99\x85\x48\xc8\xb1\x47\x48\x88\x10"
+"\xfa\xa4\x48\x20\xd4\xbb\x4e\x00\x92\xb1\x4e\x85\x7a\xc8\xb1\x4e\x85\x7b\x63\x00\x32\x20\x8a\xad\x38\x00\x00\x94\x07\x00\x0e\x03"
+"\x02\x57\x0b\x7a\xa0\x00\x68\x91\x4e\x68\xc8\x04\x00\xf0\x07\x60\x20\x8d\xad\xa0\x00\x20\xdf\xbd\x68\x68\xa9\xff\xa0\x00\xf0\x12"
+"\xa6\x64\xa4\x65\x86\x11\x0a\x20\xf4\xb4\x47\x04\x90\x85\x61\x60\xa2\x22\x86\x07\x86\x08\x30\x0a\x00\xfc\x00\xf0\x2e\xa0\xff\xc8"
+"\xb1\x6f\xf0\x0c\xc5\x07\xf0\x04\xc5\x08\xd0\xf3\xc9\x22\xf0\x01\x18\x84\x61\x98\x65\x6f\x85\x71\xa6\x70\x90\x01\xe8\x86\x72\xa5"
+"\x70\xf0\x04\xc9\x02\xd0\x0b\x98\x20\x75\xb4\xa6\x6f\xa4\x70\x20\x88\xb6\xa6\x16\xe0\x22\xd0\x05\xa2\x19\x73\x0c\xf0\x26\x61\x95"
+"\x00\xa5\x62\x95\x01\xa5\x63\x95\x02\xa0\x00\x86\x64\x84\x65\x84\x70\x88\x84\x0d\x86\x17\xe8\xe8\xe8\x86\x16\x60\x46\x0f\x48\x49"
+"\xff\x38\x65\x33\xa4\x34\xb0\x01\x88\xc4\x32\x90\x11\xd0\x04\xc5\x31\x90\x0b\xa4\x0e\xc0\x85\x35\x84\x36\xaa\x68\x60\xa2\x10\xa5"
+"\x0f\x30\x98\x01\xf0\x0a\xa9\x80\x85\x0f\x68\xd0\xd0\xa6\x37\xa5\x38\x86\x33\x85\x34\xa0\x00\x84\x4f\x84\x4e\xa5\x31\xa6\x32\x1f"
+"\x0f\xf0\x06\xa9\x19\xa2\x00\x85\x22\x86\x23\xc5\x16\xf0\x05\x20\xc7\xb5\xf0\xf7\xa9\x07\x85\x53\x66\x04\x00\x15\x00\x03\x66\x04"
+"\xf0\x0e\x05\x20\xbd\xb5\xf0\xf3\x85\x58\x86\x59\xa9\x03\x85\x53\xa5\x58\xa6\x59\xe4\x32\xd0\x07\xc5\x31\xd0\x03\x4c\x06\xb6\x28"
+"\x00\x00\x2d\x11\xc0\xaa\xc8\xb1\x22\x08\xc8\xb1\x22\x65\x58\x85\x58\x07\x00\xe0\x59\x85\x59\x28\x10\xd3\x8a\x30\xd0\xc8\xb1\x22"
+"\xa0\x00\x0d\x04\xf0\x02\x22\x85\x22\x90\x02\xe6\x23\xa6\x23\xe4\x59\xd0\x04\xc5\x58\xf0\xba\x70\x00\xf0\x03\xf3\xb1\x22\x30\x35"
+"\xc8\xb1\x22\x10\x30\xc8\xb1\x22\xf0\x2b\xc8\xb1\x22\x49\x00\x10\xc5\xa8\x11\xf0\x00\x1e\xe4\x33\xb0\x1a\xc5\x60\x90\x16\xd0\x04"
+"\xe4\x5f\x90\x10\xca\x03\xf5\x01\xa5\x22\xa6\x23\x85\x4e\x86\x4f\xa5\x53\x85\x55\xa5\x53\x18\x65\x53\x00\xf0\x12\xa0\x00\x60\xa5"
+"\x4f\x05\x4e\xf0\xf5\xa5\x55\x29\x04\x4a\xa8\x85\x55\xb1\x4e\x65\x5f\x85\x5a\xa5\x60\x69\x00\x85\x5b\xa5\x33\xa6\x34\xbe\x00\xf2"
+"\x06\x20\xbf\xa3\xa4\x55\xc8\xa5\x58\x91\x4e\xaa\xe6\x59\xa5\x59\xc8\x91\x4e\x4c\x2a\xb5\x7e\x06\x21\x20\x83\x8c\x06\xe1\x85\x6f"
+"\x68\x85\x70\xa0\x00\xb1\x6f\x18\x71\x64\x90\x05\xe7\x10\x60\x20\x75\xb4\x20\x7a\xb6\x0a\x0c\x70\x20\xaa\xb6\x20\x8c\xb6\xa5\xaa"
+"\x01\x80\xaa\xb6\x20\xca\xb4\x4c\xb8\xad\x2b\x00\xf0\x19\x48\xc8\xb1\x6f\xaa\xc8\xb1\x6f\xa8\x68\x86\x22\x84\x23\xa8\xf0\x0a\x48"
+"\x88\xb1\x22\x91\x35\x98\xd0\xf8\x68\x18\x65\x35\x85\x35\x90\x02\xe6\x36\x60\x20\x8f\xad\x06\x07\x00\x26\x0f\x40\x20\xdb\xb6\x08"
+"\x31\x01\x13\x48\xec\x00\xf1\x08\xa8\x68\x28\xd0\x13\xc4\x34\xd0\x0f\xe4\x33\xd0\x0b\x48\x18\x65\x33\x85\x33\x90\x02\xe6\x34\x4e"
+"\x00\xf1\x06\x60\xc4\x18\xd0\x0c\xc5\x17\xd0\x08\x85\x16\xe9\x03\x85\x17\xa0\x00\x60\x20\xa1\xb7\x45\x09\xf1\x0e\x7d\xb4\x68\xa0"
+"\x00\x91\x62\x68\x68\x4c\xca\xb4\x20\x61\xb7\xd1\x50\x98\x90\x04\xb1\x50\xaa\x98\x48\x8a\x48\x20\x7d\xb9\x0c\x65\x20\xaa\xb6\x68"
+"\xa8\x68\x24\x01\x42\x98\x20\x8c\xb6\x2c\x00\xc0\x18\xf1\x50\x49\xff\x4c\x06\xb7\xa9\xff\x85\x65\x39\x05\x30\x29\xf0\x06\x8b\x07"
+"\xf0\x0c\x9e\xb7\x20\x61\xb7\xf0\x4b\xca\x8a\x48\x18\xa2\x00\xf1\x50\xb0\xb6\x49\xff\xc5\x65\x90\xb1\xa5\x65\xb0\xad\x56\x05\xf0"
+"\x11\xa8\x68\x85\x55\x68\x68\x68\xaa\x68\x85\x50\x68\x85\x51\xa5\x55\x48\x98\x48\xa0\x00\x8a\x60\x20\x82\xb7\x4c\xa2\xb3\x20\xa3"
+"\xb6\xf4\x03\x10\xa8\x0f\x00\x11\xf0\xde\x00\x70\xa8\x4c\xa2\xb3\x4c\x48\xb2\xe9\x05\xf0\x13\x8a\xad\x20\xb8\xb1\xa6\x64\xd0\xf0"
+"\xa6\x65\x4c\x79\x00\x20\x82\xb7\xd0\x03\x4c\xf7\xb8\xa6\x7a\xa4\x7b\x86\x71\x84\x72\xa6\x22\x86\x7a\xa5\x00\x50\x24\xa6\x23\x86"
+"\x7b\x18\x03\x90\x25\xa0\x00\xb1\x24\x48\x98\x91\x24\x43\x07\x20\xf3\xbc\xe7\x00\x50\x24\xa6\x71\xa4\x72\x99\x0b\x70\x60\x20\x8a"
+"\xad\x20\xf7\xb7\x3f\x0b\xe1\x9e\xb7\xa5\x66\x30\x9d\xa5\x61\xc9\x91\xb0\x97\x20\x9b\x64\x08\xf0\x0a\x84\x14\x85\x15\x60\xa5\x15"
+"\x48\xa5\x14\x48\x20\xf7\xb7\xa0\x00\xb1\x14\xa8\x68\x85\x14\x68\x85\x15\xa2\x00\xf1\x00\xeb\xb7\x8a\xa0\x00\x91\x14\x60\x20\xeb"
+"\xb7\x86\x49\xa2\x00\xf3\x03\x50\x20\xf1\xb7\x86\x4a\x28\x00\xf0\x0a\x45\x4a\x25\x49\xf0\xf8\x60\xa9\x11\xa0\xbf\x4c\x67\xb8\x20"
+"\x8c\xba\xa5\x66\x49\xff\x85\x66\x45\x6e\xdd\x09\xf0\x0c\x4c\x6a\xb8\x20\x99\xb9\x90\x3c\x20\x8c\xba\xd0\x03\x4c\xfc\xbb\xa6\x70"
+"\x86\x56\xa2\x69\xa5\x69\xa8\xf0\xce\x31\x08\xf0\x04\x24\x90\x12\x84\x61\xa4\x6e\x84\x66\x49\xff\x69\x00\xa0\x00\x84\x56\xa2\x61"
+"\x73\x0b\xf0\x5a\x84\x70\xc9\xf9\x30\xc7\xa8\xa5\x70\x56\x01\x20\xb0\xb9\x24\x6f\x10\x57\xa0\x61\xe0\x69\xf0\x02\xa0\x69\x38\x49"
+"\xff\x65\x56\x85\x70\xb9\x04\x00\xf5\x04\x85\x65\xb9\x03\x00\xf5\x03\x85\x64\xb9\x02\x00\xf5\x02\x85\x63\xb9\x01\x00\xf5\x01\x85"
+"\x62\xb0\x03\x20\x47\xb9\xa0\x00\x98\x18\xa6\x62\xd0\x4a\xa6\x63\x86\x62\xa6\x64\x86\x63\xa6\x65\x86\x64\xa6\x70\x86\x65\x84\x70"
+"\x69\x08\xc9\x20\xd0\xe4\xa9\x00\x85\x61\x85\x66\x60\x4c\x00\xf0\x1f\xa5\x65\x65\x6d\x85\x65\xa5\x64\x65\x6c\x85\x64\xa5\x63\x65"
+"\x6b\x85\x63\xa5\x62\x65\x6a\x85\x62\x4c\x36\xb9\x69\x01\x06\x70\x26\x65\x26\x64\x26\x63\x26\x62\x10\xf2\x38\xe5\x61\xb0\xc7\x3e"
+"\x0e\xf2\x04\x85\x61\x90\x0e\xe6\x61\xf0\x42\x66\x62\x66\x63\x66\x64\x66\x65\x66\x70\x60\xf4\x00\xc0\xa5\x62\x49\xff\x85\x62\xa5"
+"\x63\x49\xff\x85\x63\x7d\x0a\x20\x85\x64\x88\x0a\xf0\x0e\x85\x65\xa5\x70\x49\xff\x85\x70\xe6\x70\xd0\x0e\xe6\x65\xd0\x0a\xe6\x64"
+"\xd0\x06\xe6\x63\xd0\x02\xe6\x62\x60\xa2\x0f\x36\x07\xf0\x1a\x25\xb4\x04\x84\x70\xb4\x03\x94\x04\xb4\x02\x94\x03\xb4\x01\x94\x02"
+"\xa4\x68\x94\x01\x69\x08\x30\xe8\xf0\xe6\xe9\x08\xa8\xa5\x70\xb0\x14\x16\x01\x90\x02\xf6\x01\x76\x02\x00\xf0\x1c\x02\x76\x03\x76"
+"\x04\x6a\xc8\xd0\xec\x18\x60\x81\x00\x00\x00\x00\x03\x7f\x5e\x56\xcb\x79\x80\x13\x9b\x0b\x64\x80\x76\x38\x93\x16\x82\x38\xaa\x3b"
+"\x20\x80\x35\x04\xf3\x34\x81\x05\x00\x10\x80\x3b\x08\xb0\x80\x31\x72\x17\xf8\x20\x2b\xbc\xf0\x02\x10\xcd\x0f\xf1\x08\xa5\x61\xe9"
+"\x7f\x48\xa9\x80\x85\x61\xa9\xd6\xa0\xb9\x20\x67\xb8\xa9\xdb\xa0\xb9\x20\x0f\xbb\x80\x12\xb1\x50\xb8\xa9\xc1\xa0\xb9\x20\x43\xe0"
+"\xa9\xe0\x1c\x00\x82\x68\x20\x7e\xbd\xa9\xe5\xa0\xb9\xc1\x01\xf0\x07\x8b\xba\x20\xb7\xba\xa9\x00\x85\x26\x85\x27\x85\x28\x85\x29"
+"\xa5\x70\x20\x59\xba\xa5\x65\x05\x00\x10\x64\x05\x00\x10\x63\x05\x00\xf0\x2b\x62\x20\x5e\xba\x4c\x8f\xbb\xd0\x03\x4c\x83\xb9\x4a"
+"\x09\x80\xa8\x90\x19\x18\xa5\x29\x65\x6d\x85\x29\xa5\x28\x65\x6c\x85\x28\xa5\x27\x65\x6b\x85\x27\xa5\x26\x65\x6a\x85\x26\x66\x26"
+"\x66\x27\x66\x28\x66\x29\x66\x70\x98\x4a\xd0\xd6\x60\xe2\x03\xb0\xa0\x04\xb1\x22\x85\x6d\x88\xb1\x22\x85\x6c\x05\x00\x10\x6b\x05"
+"\x00\x02\x29\x0c\x50\x6e\x09\x80\x85\x6a\x0f\x00\xf1\x11\x69\xa5\x61\x60\xa5\x69\xf0\x1f\x18\x65\x61\x90\x04\x30\x1d\x18\x2c\x10"
+"\x14\x69\x80\x85\x61\xd0\x03\x4c\xfb\xb8\xa5\x6f\x85\x66\x8d\x01\xb0\x30\x05\x68\x68\x4c\xf7\xb8\x4c\x7e\xb9\x20\xe6\x10\xf0\x05"
+"\x10\x18\x69\x02\xb0\xf2\xa2\x00\x86\x6f\x20\x77\xb8\xe6\x61\xf0\xe7\x60\x84\x20\x54\x09\x61\x0c\xbc\xa9\xf9\xa0\xba\x18\x00\xf1"
+"\x66\xa2\xbb\x4c\x12\xbb\x20\x8c\xba\xf0\x76\x20\x1b\xbc\xa9\x00\x38\xe5\x61\x85\x61\x20\xb7\xba\xe6\x61\xf0\xba\xa2\xfc\xa9\x01"
+"\xa4\x6a\xc4\x62\xd0\x10\xa4\x6b\xc4\x63\xd0\x0a\xa4\x6c\xc4\x64\xd0\x04\xa4\x6d\xc4\x65\x08\x2a\x90\x09\xe8\x95\x29\xf0\x32\x10"
+"\x34\xa9\x01\x28\xb0\x0e\x06\x6d\x26\x6c\x26\x6b\x26\x6a\xb0\xe6\x30\xce\x10\xe2\xa8\xa5\x6d\xe5\x65\x85\x6d\xa5\x6c\xe5\x64\x85"
+"\x6c\xa5\x6b\xe5\x63\x85\x6b\xa5\x6a\xe5\x62\x85\x6a\x98\x4c\x4f\xbb\xa9\x40\xd0\xce\x0a\x01\x00\x80\x85\x70\x28\x4c\x8f\xbb\xa2"
+"\x14\xba\x06\xf5\x03\x26\x85\x62\xa5\x27\x85\x63\xa5\x28\x85\x64\xa5\x29\x85\x65\x4c\xd7\xb8\x16\x01\x10\x65\xfd\x00\x10\x64\x05"
+"\x00\x10\x63\x05\x00\x50\x66\x09\x80\x85\x62\x09\x00\xe0\x61\x84\x70\x60\xa2\x5c\x2c\xa2\x57\xa0\x00\xf0\x04\xa6\x85\x0e\x20\x1b"
+"\xbc\x4f\x05\x90\xa0\x04\xa5\x65\x91\x22\x88\xa5\x64\x05\x00\x10\x63\x05\x00\x01\x74\x14\x00\x09\x00\xf2\x10\x61\x91\x22\x84\x70"
+"\x60\xa5\x6e\x85\x66\xa2\x05\xb5\x68\x95\x60\xca\xd0\xf9\x86\x70\x60\x20\x1b\xbc\xa2\x06\xb5\x60\x95\x68\x0f\x00\xf0\x1a\xa5\x61"
+"\xf0\xfb\x06\x70\x90\xf7\x20\x6f\xb9\xd0\xf2\x4c\x38\xb9\xa5\x61\xf0\x09\xa5\x66\x2a\xa9\xff\xb0\x02\xa9\x01\x60\x20\x2b\xbc\x85"
+"\x62\xa9\x00\x85\x63\xa2\x88\xf7\x02\xf1\x07\x2a\xa9\x00\x85\x65\x85\x64\x86\x61\x85\x70\x85\x66\x4c\xd2\xb8\x46\x66\x60\x85\x24"
+"\x84\x90\x04\xf0\x0e\xc8\xaa\xf0\xc4\xb1\x24\x45\x66\x30\xc2\xe4\x61\xd0\x21\xb1\x24\x09\x80\xc5\x62\xd0\x19\xc8\xb1\x24\xc5\x63"
+"\xd0\x12\x07\x00\xf0\x35\x64\xd0\x0b\xc8\xa9\x7f\xc5\x70\xb1\x24\xe5\x65\xf0\x28\xa5\x66\x90\x02\x49\xff\x4c\x31\xbc\xa5\x61\xf0"
+"\x4a\x38\xe9\xa0\x24\x66\x10\x09\xaa\xa9\xff\x85\x68\x20\x4d\xb9\x8a\xa2\x61\xc9\xf9\x10\x06\x20\x99\xb9\x84\x68\x60\xa8\xa5\x66"
+"\x29\x80\x46\x62\x05\x62\x85\x62\x20\xb0\x11\x00\xf0\x2f\xa5\x61\xc9\xa0\xb0\x20\x20\x9b\xbc\x84\x70\xa5\x66\x84\x66\x49\x80\x2a"
+"\xa9\xa0\x85\x61\xa5\x65\x85\x07\x4c\xd2\xb8\x85\x62\x85\x63\x85\x64\x85\x65\xa8\x60\xa0\x00\xa2\x0a\x94\x5d\xca\x10\xfb\x90\x0f"
+"\xc9\x2d\xd0\x04\x86\x67\xf0\x04\xc9\x2b\xd0\x05\x65\x0c\x90\x5b\xc9\x2e\xf0\x2e\xc9\x45\xd0\x30\x0d\x00\xf0\x05\x17\xc9\xab\xf0"
+"\x0e\xc9\x2d\xf0\x0a\xc9\xaa\xf0\x08\xc9\x2b\xf0\x04\xd0\x07\x66\x7e\x0b\x60\x90\x5c\x24\x60\x10\x0e\x22\x02\xf1\x3b\x5e\x4c\x49"
+"\xbd\x66\x5f\x24\x5f\x50\xc3\xa5\x5e\x38\xe5\x5d\x85\x5e\xf0\x12\x10\x09\x20\xfe\xba\xe6\x5e\xd0\xf9\xf0\x07\x20\xe2\xba\xc6\x5e"
+"\xd0\xf9\xa5\x67\x30\x01\x60\x4c\xb4\xbf\x48\x24\x5f\x10\x02\xe6\x5d\x20\xe2\xba\x68\x38\xe9\x30\x20\x7e\xbd\x4c\x0a\xbd\x48\x20"
+"\x0c\xbc\x68\x20\x3c\xbc\xa5\xe3\x02\xf0\x21\xa6\x61\x4c\x6a\xb8\xa5\x5e\xc9\x0a\x90\x09\xa9\x64\x24\x60\x30\x11\x4c\x7e\xb9\x0a"
+"\x0a\x18\x65\x5e\x0a\x18\xa0\x00\x71\x7a\x38\xe9\x30\x85\x5e\x4c\x30\xbd\x9b\x3e\xbc\x1f\xfd\x9e\x6e\x6b\x27\x05\x00\xf0\x23\x28"
+"\x00\xa9\x71\xa0\xa3\x20\xda\xbd\xa5\x3a\xa6\x39\x85\x62\x86\x63\xa2\x90\x38\x20\x49\xbc\x20\xdf\xbd\x4c\x1e\xab\xa0\x01\xa9\x20"
+"\x24\x66\x10\x02\xa9\x2d\x99\xff\x00\x85\x66\x84\x71\xc8\xa9\x30\xa6\x29\x03\xf2\x13\x04\xbf\xa9\x00\xe0\x80\xf0\x02\xb0\x09\xa9"
+"\xbd\xa0\xbd\x20\x28\xba\xa9\xf7\x85\x5d\xa9\xb8\xa0\xbd\x20\x5b\xbc\xf0\x1e\x10\x12\xa9\xb3\x0b\x00\x30\x02\x10\x0e\xc6\x00\x30"
+"\x5d\xd0\xee\xd6\x00\xf0\x25\x5d\xd0\xdc\x20\x49\xb8\x20\x9b\xbc\xa2\x01\xa5\x5d\x18\x69\x0a\x30\x09\xc9\x0b\xb0\x06\x69\xff\xaa"
+"\xa9\x02\x38\xe9\x02\x85\x5e\x86\x5d\x8a\xf0\x02\x10\x13\xa4\x71\xa9\x2e\xc8\x99\xff\x00\x8a\xf0\x06\xa9\x30\x09\x00\x00\xb8\x18"
+"\x80\xa2\x80\xa5\x65\x18\x79\x19\xbf\x6a\x05\x30\x79\x18\xbf\x6b\x05\x30\x79\x17\xbf\x6c\x05\xf2\x1b\x79\x16\xbf\x85\x62\xe8\xb0"
+"\x04\x10\xde\x30\x02\x30\xda\x8a\x90\x04\x49\xff\x69\x0a\x69\x2f\xc8\xc8\xc8\xc8\x84\x47\xa4\x71\xc8\xaa\x29\x7f\x99\xff\x00\xc6"
+"\x5d\xd0\x06\x57\x00\xf1\x1a\x84\x71\xa4\x47\x8a\x49\xff\x29\x80\xaa\xc0\x24\xf0\x04\xc0\x3c\xd0\xa6\xa4\x71\xb9\xff\x00\x88\xc9"
+"\x30\xf0\xf8\xc9\x2e\xf0\x01\xc8\xa9\x2b\xa6\x5e\xf0\x2e\x10\x08\xa2\x01\xf0\x22\xaa\xa9\x2d\x99\x01\x01\xa9\x45\x99\x00\x01\x8a"
+"\xa2\x2f\x38\xe8\xe9\x0a\xb0\xfb\x69\x3a\x99\x03\x01\x8a\x99\x02\x01\xa9\x00\x99\x04\x01\xf0\x08\x99\xff\x00\xa9\x00\x99\x00\x01"
+"\xa9\x00\xa0\x01\x60\x30\x05\xf0\x13\x00\xfa\x0a\x1f\x00\x00\x98\x96\x80\xff\xf0\xbd\xc0\x00\x01\x86\xa0\xff\xff\xd8\xf0\x00\x00"
+"\x03\xe8\xff\xff\xff\x9c\x00\x00\x00\x0a\xff\x01\x00\xff\x0a\xdf\x0a\x80\x00\x03\x4b\xc0\xff\xff\x73\x60\x00\x00\x0e\x10\xff\xff"
+"\xfd\xa8\x00\x00\x00\x3c\xec\xaa\x01\x00\x0a\x30\x20\x0c\xbc\x2b\x07\xf0\x01\x20\xa2\xbb\xf0\x70\xa5\x69\xd0\x03\x4c\xf9\xb8\xa2"
+"\x4e\xa0\x00\x68\x0b\x70\x6e\x10\x0f\x20\xcc\xbc\xa9\x0e\x00\xf1\x00\x5b\xbc\xd0\x03\x98\xa4\x07\x20\xfe\xbb\x98\x48\x20\xea\xb9"
+"\x14\x00\xd2\x28\xba\x20\xed\xbf\x68\x4a\x90\x0a\xa5\x61\xf0\x06\x71\x06\xf1\x1b\x60\x81\x38\xaa\x3b\x29\x07\x71\x34\x58\x3e\x56"
+"\x74\x16\x7e\xb3\x1b\x77\x2f\xee\xe3\x85\x7a\x1d\x84\x1c\x2a\x7c\x63\x59\x58\x0a\x7e\x75\xfd\xe7\xc6\x80\x31\x72\x18\x10\x2c\x06"
+"\xf0\x04\xa9\xbf\xa0\xbf\x20\x28\xba\xa5\x70\x69\x50\x90\x03\x20\x23\xbc\x4c\x00\xe0"
+;
+unsigned char dump_c64_basic[8192];
+static const unsigned char dump_c64_char_lz4[] =
+"\xf0\x04\x3c\x66\x6e\x6e\x60\x62\x3c\x00\x18\x3c\x66\x7e\x66\x66\x66\x00\x7c\x66\x66\x03\x00\xf3\x09\x00\x3c\x66\x60\x60\x60\x66"
+"\x3c\x00\x78\x6c\x66\x66\x66\x6c\x78\x00\x7e\x60\x60\x78\x60\x60\x7e\x08\x00\x10\x60\x20\x00\x72\x6e\x66\x66\x3c\x00\x66\x66\x38"
+"\x00\x20\x3c\x18\x01\x00\xf1\x04\x3c\x00\x1e\x0c\x0c\x0c\x0c\x6c\x38\x00\x66\x6c\x78\x70\x78\x6c\x66\x00\x60\x01\x00\xf0\x05\x7e"
+"\x00\x63\x77\x7f\x6b\x63\x63\x63\x00\x66\x76\x7e\x7e\x6e\x66\x66\x00\x3c\x66\x01\x00\x11\x3c\x70\x00\x20\x60\x60\x50\x00\x51\x66"
+"\x66\x66\x3c\x0e\x10\x00\x00\x38\x00\x90\x3c\x66\x60\x3c\x06\x66\x3c\x00\x7e\x57\x00\x20\x18\x18\x68\x00\x00\x21\x00\x02\x08\x00"
+"\xf0\x03\x3c\x18\x00\x63\x63\x63\x6b\x7f\x77\x63\x00\x66\x66\x3c\x18\x3c\x66\x66\x18\x00\x00\x83\x00\xb0\x00\x7e\x06\x0c\x18\x30"
+"\x60\x7e\x00\x3c\x30\x01\x00\xb0\x3c\x00\x0c\x12\x30\x7c\x30\x62\xfc\x00\x3c\x98\x00\x61\x0c\x3c\x00\x00\x18\x3c\x53\x00\x84\x00"
+"\x10\x30\x7f\x7f\x30\x10\x00\x01\x00\x00\x67\x00\x21\x00\x00\x68\x00\x01\x13\x00\xf1\x14\x66\x66\xff\x66\xff\x66\x66\x00\x18\x3e"
+"\x60\x3c\x06\x7c\x18\x00\x62\x66\x0c\x18\x30\x66\x46\x00\x3c\x66\x3c\x38\x67\x66\x3f\x00\x06\x0c\x18\x28\x00\xf2\x0e\x0c\x18\x30"
+"\x30\x30\x18\x0c\x00\x30\x18\x0c\x0c\x0c\x18\x30\x00\x00\x66\x3c\xff\x3c\x66\x00\x00\x00\x18\x18\x7e\x18\x23\x00\x00\x0c\x00\x51"
+"\x30\x00\x00\x00\x7e\x31\x00\x00\x05\x00\x00\x19\x00\x11\x03\xa9\x00\x50\x00\x3c\x66\x6e\x76\x48\x01\xc1\x18\x18\x38\x18\x18\x18"
+"\x7e\x00\x3c\x66\x06\x0c\xc0\x00\x30\x66\x06\x1c\x00\x01\xc0\x06\x0e\x1e\x66\x7f\x06\x06\x00\x7e\x60\x7c\x06\x10\x00\x40\x3c\x66"
+"\x60\x7c\x30\x00\x31\x7e\x66\x0c\xb3\x00\x30\x3c\x66\x66\x03\x00\x00\x50\x01\x10\x3e\x20\x00\x00\xc4\x00\x11\x00\x78\x00\x11\x18"
+"\x78\x00\x71\x0e\x18\x30\x60\x30\x18\x0e\x7f\x00\x00\x81\x00\x71\x70\x18\x0c\x06\x0c\x18\x70\x68\x00\x12\x18\x29\x00\xd0\xff\xff"
+"\x00\x00\x00\x08\x1c\x3e\x7f\x7f\x1c\x3e\x00\x55\x00\x00\x04\x00\x31\x00\x00\x00\x18\x00\x0c\x07\x00\x00\xbf\x00\x00\x19\x00\x00"
+"\x5e\x01\x00\x04\x00\x01\x57\x01\x80\x0c\x0c\x0c\x00\x00\x00\xe0\xf0\xc3\x00\x41\x18\x1c\x0f\x07\xff\x00\x71\x38\xf0\xe0\x00\x00"
+"\x00\xc0\x01\x00\xf1\x05\xff\xff\xc0\xe0\x70\x38\x1c\x0e\x07\x03\x03\x07\x0e\x1c\x38\x70\xe0\xc0\xff\xff\x19\x00\x41\xc0\xff\xff"
+"\x03\x01\x00\x70\x00\x3c\x7e\x7e\x7e\x7e\x3c\x5f\x00\x01\x73\x00\x73\x36\x7f\x7f\x7f\x3e\x1c\x08\x40\x02\xf3\x14\x60\x60\x00\x00"
+"\x00\x07\x0f\x1c\x18\x18\xc3\xe7\x7e\x3c\x3c\x7e\xe7\xc3\x00\x3c\x7e\x66\x66\x7e\x3c\x00\x18\x18\x66\x66\x18\x18\x3c\x00\x06\x01"
+"\x00\x00\xc8\x00\x00\x38\x00\xc0\x18\x18\x18\xff\xff\x18\x18\x18\xc0\xc0\x30\x30\x04\x00\x00\xd4\x00\x00\x04\x00\xf2\x01\x00\x00"
+"\x03\x3e\x76\x36\x36\x00\xff\x7f\x3f\x1f\x0f\x07\x03\x01\x71\x00\x33\x00\x00\xf0\x01\x00\x00\x10\x00\x10\xff\x01\x00\x00\x09\x00"
+"\x06\x04\x00\x03\xae\x00\x60\xc0\xc0\xcc\xcc\x33\x33\x04\x00\x01\xb5\x00\x30\x03\x03\x03\x23\x00\x00\x10\x00\x84\xff\xfe\xfc\xf8"
+"\xf0\xe0\xc0\x80\x18\x00\x60\x18\x18\x18\x1f\x1f\x18\xe9\x01\x61\x00\x00\x0f\x0f\x0f\x0f\x10\x00\x00\x2d\x00\x43\x00\x00\xf8\xf8"
+"\x18\x00\x01\xe9\x00\x21\x00\x00\x28\x00\x01\xb0\x00\x02\x20\x00\x01\xb8\x00\x31\x18\x18\x18\x28\x00\x02\x26\x01\x33\xc0\xc0\xe0"
+"\x01\x00\x13\x07\x01\x00\x00\x84\x01\x00\x2f\x00\x14\xff\x09\x00\x03\x0d\x00\x02\x80\x00\x02\x15\x00\x00\xd3\x00\x00\x7c\x00\x00"
+"\x1b\x00\x01\x50\x00\x12\x00\xe8\x00\x00\x10\x00\x04\x1c\x00\xf0\x04\xc3\x99\x91\x91\x9f\x99\xc3\xff\xe7\xc3\x99\x81\x99\x99\x99"
+"\xff\x83\x99\x99\x03\x00\x50\xff\xc3\x99\x9f\x9f\x18\x00\xf3\x00\x87\x93\x99\x99\x99\x93\x87\xff\x81\x9f\x9f\x87\x9f\x9f\x81\x08"
+"\x00\x10\x9f\x20\x00\x72\x91\x99\x99\xc3\xff\x99\x99\x38\x00\x20\xc3\xe7\x01\x00\xf1\x04\xc3\xff\xe1\xf3\xf3\xf3\xf3\x93\xc7\xff"
+"\x99\x93\x87\x8f\x87\x93\x99\xff\x9f\x01\x00\xf0\x05\x81\xff\x9c\x88\x80\x94\x9c\x9c\x9c\xff\x99\x89\x81\x81\x91\x99\x99\xff\xc3"
+"\x99\x01\x00\x11\xc3\x70\x00\x20\x9f\x9f\x50\x00\x51\x99\x99\x99\xc3\xf1\x10\x00\x00\x38\x00\x90\xc3\x99\x9f\xc3\xf9\x99\xc3\xff"
+"\x81\x57\x00\x20\xe7\xe7\x68\x00\x00\x21\x00\x02\x08\x00\xf0\x03\xc3\xe7\xff\x9c\x9c\x9c\x94\x80\x88\x9c\xff\x99\x99\xc3\xe7\xc3"
+"\x99\x99\x18\x00\x00\x83\x00\xb0\xff\x81\xf9\xf3\xe7\xcf\x9f\x81\xff\xc3\xcf\x01\x00\xb0\xc3\xff\xf3\xed\xcf\x83\xcf\x9d\x03\xff"
+"\xc3\x98\x00\x61\xf3\xc3\xff\xff\xe7\xc3\x53\x00\x70\xff\xef\xcf\x80\x80\xcf\xef\xea\x01\x01\x04\x00\x00\x67\x00\x21\xff\xff\x68"
+"\x00\x01\x10\x00\xf1\x14\x99\x99\x00\x99\x00\x99\x99\xff\xe7\xc1\x9f\xc3\xf9\x83\xe7\xff\x9d\x99\xf3\xe7\xcf\x99\xb9\xff\xc3\x99"
+"\xc3\xc7\x98\x99\xc0\xff\xf9\xf3\xe7\x28\x00\xf2\x0e\xf3\xe7\xcf\xcf\xcf\xe7\xf3\xff\xcf\xe7\xf3\xf3\xf3\xe7\xcf\xff\xff\x99\xc3"
+"\x00\xc3\x99\xff\xff\xff\xe7\xe7\x81\xe7\x23\x00\x00\x0c\x00\x51\xcf\xff\xff\xff\x81\x31\x00\x00\x05\x00\x00\x19\x00\x11\xfc\xa9"
+"\x00\x50\xff\xc3\x99\x91\x89\x48\x01\xc1\xe7\xe7\xc7\xe7\xe7\xe7\x81\xff\xc3\x99\xf9\xf3\xc0\x00\x30\x99\xf9\xe3\x00\x01\xc0\xf9"
+"\xf1\xe1\x99\x80\xf9\xf9\xff\x81\x9f\x83\xf9\x10\x00\x40\xc3\x99\x9f\x83\x30\x00\x31\x81\x99\xf3\xb3\x00\x30\xc3\x99\x99\x03\x00"
+"\x00\x50\x01\x10\xc1\x20\x00\x00\xc4\x00\x11\xff\x78\x00\x11\xe7\x78\x00\x71\xf1\xe7\xcf\x9f\xcf\xe7\xf1\x7f\x00\x00\x81\x00\x71"
+"\x8f\xe7\xf3\xf9\xf3\xe7\x8f\x68\x00\x12\xe7\x29\x00\x00\x87\x02\x90\xff\xf7\xe3\xc1\x80\x80\xe3\xc1\xff\x55\x00\x00\x04\x00\x01"
+"\x58\x02\x00\xac\x00\x11\xff\x1f\x00\x00\x51\x02\x01\x0e\x00\x00\x05\x00\x00\x12\x00\x00\x5e\x01\x00\x04\x00\x01\x57\x01\x80\xf3"
+"\xf3\xf3\xff\xff\xff\x1f\x0f\xc3\x00\x41\xe7\xe3\xf0\xf8\xff\x00\x71\xc7\x0f\x1f\xff\xff\xff\x3f\x01\x00\xf1\x05\x00\x00\x3f\x1f"
+"\x8f\xc7\xe3\xf1\xf8\xfc\xfc\xf8\xf1\xe3\xc7\x8f\x1f\x3f\x00\x00\x19\x00\x41\x3f\x00\x00\xfc\x01\x00\x70\xff\xc3\x81\x81\x81\x81"
+"\xc3\x5f\x00\x01\x6c\x00\x73\xc9\x80\x80\x80\xc1\xe3\xf7\x40\x02\xf3\x14\x9f\x9f\xff\xff\xff\xf8\xf0\xe3\xe7\xe7\x3c\x18\x81\xc3"
+"\xc3\x81\x18\x3c\xff\xc3\x81\x99\x99\x81\xc3\xff\xe7\xe7\x99\x99\xe7\xe7\xc3\xff\xf9\x01\x00\x00\xc8\x00\x00\x38\x00\xc0\xe7\xe7"
+"\xe7\x00\x00\xe7\xe7\xe7\x3f\x3f\xcf\xcf\x04\x00\x00\xd4\x00\x00\x04\x00\xf2\x01\xff\xff\xfc\xc1\x89\xc9\xc9\xff\x00\x80\xc0\xe0"
+"\xf0\xf8\xfc\xfe\x71\x00\x20\xff\xff\x28\x03\x00\x04\x00\x00\x10\x00\x00\x20\x03\x10\x00\x09\x00\x06\x04\x00\x03\xae\x00\x22\x3f"
+"\x3f\xfe\x03\x21\xcc\xcc\xb5\x00\x30\xfc\xfc\xfc\x23\x00\x00\x14\x00\x84\x00\x01\x03\x07\x0f\x1f\x3f\x7f\x18\x00\x60\xe7\xe7\xe7"
+"\xe0\xe0\xe7\xe9\x01\x20\xff\xff\x6c\x03\x01\x10\x00\x00\x2d\x00\x43\xff\xff\x07\x07\x18\x00\x01\xe9\x00\x21\xff\xff\x28\x00\x01"
+"\xb0\x00\x02\x20\x00\x01\xb8\x00\x31\xe7\xe7\xe7\x28\x00\x02\x26\x01\x33\x3f\x3f\x1f\x01\x00\x13\xf8\x01\x00\x00\x84\x01\x00\x2f"
+"\x00\x01\xa8\x05\x00\x09\x00\x00\x04\x00\x14\x00\x4e\x01\x02\x1e\x00\x00\xd0\x00\x00\x7c\x00\x00\x1b\x00\x01\x50\x00\x12\xff\xe8"
+"\x00\x00\x10\x00\x04\x1c\x00\x04\x00\x08\xa0\x00\x00\x3c\x06\x3e\x66\x3e\x00\x00\x60\x60\x06\xf0\x00\x7c\x00\x00\x00\x3c\x60\x60"
+"\x60\x3c\x00\x00\x06\x06\x3e\x66\x18\x00\x40\x00\x3c\x66\x7e\x10\x00\x32\x0e\x18\x3e\xbf\x04\x00\x17\x00\x22\x06\x7c\x30\x00\x10"
+"\x66\x77\x06\x10\x38\x88\x05\x21\x00\x06\x8b\x05\x50\x3c\x00\x60\x60\x6c\xc8\x07\x11\x00\x14\x06\x00\xd8\x05\x70\x66\x7f\x7f\x6b"
+"\x63\x00\x00\xe2\x07\x10\x66\x21\x07\x00\x02\x08\x00\x18\x00\x00\x6f\x08\x00\xe0\x05\x01\x50\x00\x10\x06\x20\x00\x00\x10\x08\x21"
+"\x00\x00\x79\x07\x20\x00\x00\x47\x07\x01\xc0\x06\x00\x30\x08\x32\x3e\x00\x00\xea\x07\x80\x00\x00\x00\x63\x6b\x7f\x3e\x36\x10\x00"
+"\x00\x01\x08\x00\x08\x00\xbf\x66\x66\x3e\x0c\x78\x00\x00\x7e\x0c\x18\x30\x00\x08\xff\x20\x0f\x00\x0a\xbd\x01\x50\x07\x0f\x00\x08"
+"\x00\x00\xac\x03\x01\x04\x00\x60\x99\xcc\x66\x33\x99\xcc\x89\x02\x01\xef\x03\x00\x28\x03\x00\x04\x00\x00\x0d\x00\x00\x20\x03\x00"
+"\x14\x09\x00\x0c\x00\x03\x04\x00\x0f\x00\x08\x0e\x40\xcc\x99\x33\x66\x04\x00\x02\x80\x07\x21\x03\x03\xf0\x07\x02\x29\x03\x0f\x00"
+"\x08\x5a\x60\x01\x03\x06\x6c\x78\x70\x2f\x09\x02\xec\x07\x00\xe8\x03\x00\xc4\x00\x0f\x00\x08\x0d\xa0\xff\xff\xc3\xf9\xc1\x99\xc1"
+"\xff\xff\x9f\x60\x06\xf0\x00\x83\xff\xff\xff\xc3\x9f\x9f\x9f\xc3\xff\xff\xf9\xf9\xc1\x99\x18\x00\x40\xff\xc3\x99\x81\x10\x00\x32"
+"\xf1\xe7\xc1\xbf\x04\x00\x17\x00\x22\xf9\x83\x30\x00\x10\x99\x77\x06\x10\xc7\x88\x05\x21\xff\xf9\x8b\x05\x50\xc3\xff\x9f\x9f\x93"
+"\xc8\x07\x11\xff\x14\x06\x00\xd8\x05\x70\x99\x80\x80\x94\x9c\xff\xff\xe2\x07\x10\x99\x21\x07\x00\x02\x08\x00\x18\x00\x00\x6f\x08"
+"\x00\xe0\x05\x01\x50\x00\x10\xf9\x20\x00\x00\x10\x08\x21\xff\xff\x79\x07\x20\xff\xff\x47\x07\x01\xc0\x06\x00\x30\x08\x32\xc1\xff"
+"\xff\xea\x07\x80\xff\xff\xff\x9c\x94\x80\xc1\xc9\x10\x00\x00\x01\x08\x00\x08\x00\xbf\x99\x99\xc1\xf3\x87\xff\xff\x81\xf3\xe7\xcf"
+"\x00\x08\xff\x20\x0f\x00\x0a\xbd\x01\x50\x07\x0f\x00\x08\x00\x00\xac\x0b\x01\x04\x00\x01\xfe\x03\x10\x33\x89\x02\x01\xef\x03\x00"
+"\x28\x03\x00\x04\x00\x00\x0d\x00\x00\x30\x03\x0f\x00\x08\x1d\x02\xfe\x03\x2f\xcc\x99\x00\x08\x6d\x60\xfe\xfc\xf9\x93\x87\x8f\x2f"
+"\x09\x02\xec\x07\x00\xd4\x04\x00\xd4\x00\x0f\x00\x08\x00\x50\x0f\xf0\xf0\xf0\xf0"
+;
+unsigned char dump_c64_char[4096];
+static const unsigned char dump_c64_kernalv3_lz4[] =
+"\xf1\x4a\x85\x56\x20\x0f\xbc\xa5\x61\xc9\x88\x90\x03\x20\xd4\xba\x20\xcc\xbc\xa5\x07\x18\x69\x81\xf0\xf3\x38\xe9\x01\x48\xa2\x05"
+"\xb5\x69\xb4\x61\x95\x61\x94\x69\xca\x10\xf5\xa5\x56\x85\x70\x20\x53\xb8\x20\xb4\xbf\xa9\xc4\xa0\xbf\x20\x59\xe0\xa9\x00\x85\x6f"
+"\x68\x20\xb9\xba\x60\x85\x71\x84\x72\x20\xca\xbb\xa9\x57\x20\x28\xba\x20\x5d\xe0\xa9\x57\xa0\x00\x4c\x28\xba\x16\x00\xf1\x10\xc7"
+"\xbb\xb1\x71\x85\x67\xa4\x71\xc8\x98\xd0\x02\xe6\x72\x85\x71\xa4\x72\x20\x28\xba\xa5\x71\xa4\x72\x18\x69\x05\x90\x01\xc8\x24\x00"
+"\xf0\x25\x67\xb8\xa9\x5c\xa0\x00\xc6\x67\xd0\xe4\x60\x98\x35\x44\x7a\x00\x68\x28\xb1\x46\x00\x20\x2b\xbc\x30\x37\xd0\x20\x20\xf3"
+"\xff\x86\x22\x84\x23\xa0\x04\xb1\x22\x85\x62\xc8\xb1\x22\x85\x64\xa0\x08\xb1\x22\x85\x63\x0b\x00\xf0\xcc\x65\x4c\xe3\xe0\xa9\x8b"
+"\xa0\x00\x20\xa2\xbb\xa9\x8d\xa0\xe0\x20\x28\xba\xa9\x92\xa0\xe0\x20\x67\xb8\xa6\x65\xa5\x62\x85\x65\x86\x62\xa6\x63\xa5\x64\x85"
+"\x63\x86\x64\xa9\x00\x85\x66\xa5\x61\x85\x70\xa9\x80\x85\x61\x20\xd7\xb8\xa2\x8b\xa0\x00\x4c\xd4\xbb\xc9\xf0\xd0\x07\x84\x38\x86"
+"\x37\x4c\x63\xa6\xaa\xd0\x02\xa2\x1e\x4c\x37\xa4\x20\xd2\xff\xb0\xe8\x60\x20\xcf\xff\xb0\xe2\x60\x20\xad\xe4\xb0\xdc\x60\x20\xc6"
+"\xff\xb0\xd6\x60\x20\xe4\xff\xb0\xd0\x60\x20\x8a\xad\x20\xf7\xb7\xa9\xe1\x48\xa9\x46\x48\xad\x0f\x03\x48\xad\x0c\x03\xae\x0d\x03"
+"\xac\x0e\x03\x28\x6c\x14\x00\x08\x8d\x0c\x03\x8e\x0d\x03\x8c\x0e\x03\x68\x8d\x0f\x03\x60\x20\xd4\xe1\xa6\x2d\xa4\x2e\xa9\x2b\x20"
+"\xd8\xff\xb0\x95\x60\xa9\x01\x2c\xa9\x00\x85\x0a\x20\xd4\xe1\xa5\x0a\xa6\x2b\xa4\x2c\x20\xd5\xff\xb0\x57\xa5\x0a\xf0\x17\xa2\x1c"
+"\x20\xb7\xff\x29\x10\xd0\x17\xa5\x7a\xc9\x02\xf0\x07\xa9\x64\xa0\xa3\x4c\x1e\xab\x60\x15\x00\xf0\x3e\xbf\xf0\x05\xa2\x1d\x4c\x37"
+"\xa4\xa5\x7b\xc9\x02\xd0\x0e\x86\x2d\x84\x2e\xa9\x76\xa0\xa3\x20\x1e\xab\x4c\x2a\xa5\x20\x8e\xa6\x20\x33\xa5\x4c\x77\xa6\x20\x19"
+"\xe2\x20\xc0\xff\xb0\x0b\x60\x20\x19\xe2\xa5\x49\x20\xc3\xff\x90\xc3\x4c\xf9\xe0\xa9\x00\x20\xbd\xff\xa2\x01\xa0\x00\x20\xba\xff"
+"\x20\x06\xe2\x20\x57\xe2\x06\x00\x63\x00\xe2\xa0\x00\x86\x49\x13\x00\xf0\x0b\x00\xe2\x8a\xa8\xa6\x49\x4c\xba\xff\x20\x0e\xe2\x4c"
+"\x9e\xb7\x20\x79\x00\xd0\x02\x68\x68\x60\x20\xfd\xae\x0b\x00\x41\xf7\x4c\x08\xaf\x45\x00\x97\x20\x11\xe2\x20\x9e\xb7\x86\x49\x8a"
+"\x4e\x00\xd8\x00\xe2\x86\x4a\xa0\x00\xa5\x49\xe0\x03\x90\x01\x88\x4f\x00\x24\x4a\xa5\x5e\x00\xf0\x19\x0e\xe2\x20\x9e\xad\x20\xa3"
+"\xb6\xa6\x22\xa4\x23\x4c\xbd\xff\xa9\xe0\xa0\xe2\x20\x67\xb8\x20\x0c\xbc\xa9\xe5\xa0\xe2\xa6\x6e\x20\x07\xbb\x20\x0c\xbc\x20\xcc"
+"\xbc\x43\x02\xf0\x0d\x20\x53\xb8\xa9\xea\xa0\xe2\x20\x50\xb8\xa5\x66\x48\x10\x0d\x20\x49\xb8\xa5\x66\x30\x09\xa5\x12\x49\xff\x85"
+"\x12\x6d\x02\x00\x1c\x00\x50\x67\xb8\x68\x10\x03\x0d\x00\x60\xef\xa0\xe2\x4c\x43\xe0\x6d\x02\xc1\x00\x85\x12\x20\x6b\xe2\xa2\x4e"
+"\xa0\x00\x20\xf6\x73\x02\x00\x07\x02\x00\xe9\x01\xf0\x06\x12\x20\xdc\xe2\xa9\x4e\xa0\x00\x4c\x0f\xbb\x48\x4c\x9d\xe2\x81\x49\x0f"
+"\xda\xa2\x83\x05\x00\xf1\x10\x7f\x00\x00\x00\x00\x05\x84\xe6\x1a\x2d\x1b\x86\x28\x07\xfb\xf8\x87\x99\x68\x89\x01\x87\x23\x35\xdf"
+"\xe1\x86\xa5\x5d\xe7\x28\x24\x00\x00\x83\x00\x00\x69\x00\xf1\x07\xa5\x61\x48\xc9\x81\x90\x07\xa9\xbc\xa0\xb9\x20\x0f\xbb\xa9\x3e"
+"\xa0\xe3\x20\x43\xe0\x68\x13\x00\x00\xcc\x00\x10\x50\x90\x00\xf0\x2e\x4c\xb4\xbf\x60\x0b\x76\xb3\x83\xbd\xd3\x79\x1e\xf4\xa6\xf5"
+"\x7b\x83\xfc\xb0\x10\x7c\x0c\x1f\x67\xca\x7c\xde\x53\xcb\xc1\x7d\x14\x64\x70\x4c\x7d\xb7\xea\x51\x7a\x7d\x63\x30\x88\x7e\x7e\x92"
+"\x44\x99\x3a\x7e\x4c\xcc\x91\xc7\x7f\xaa\xaa\xaa\x13\x81\x8c\x00\xf0\x99\x20\xcc\xff\xa9\x00\x85\x13\x20\x7a\xa6\x58\xa2\x80\x6c"
+"\x00\x03\x8a\x30\x03\x4c\x3a\xa4\x4c\x74\xa4\x20\x53\xe4\x20\xbf\xe3\x20\x22\xe4\xa2\xfb\x9a\xd0\xe4\xe6\x7a\xd0\x02\xe6\x7b\xad"
+"\x60\xea\xc9\x3a\xb0\x0a\xc9\x20\xf0\xef\x38\xe9\x30\x38\xe9\xd0\x60\x80\x4f\xc7\x52\x58\xa9\x4c\x85\x54\x8d\x10\x03\xa9\x48\xa0"
+"\xb2\x8d\x11\x03\x8c\x12\x03\xa9\x91\xa0\xb3\x85\x05\x84\x06\xa9\xaa\xa0\xb1\x85\x03\x84\x04\xa2\x1c\xbd\xa2\xe3\x95\x73\xca\x10"
+"\xf8\xa9\x03\x85\x53\xa9\x00\x85\x68\x85\x13\x85\x18\xa2\x01\x8e\xfd\x01\x8e\xfc\x01\xa2\x19\x86\x16\x38\x20\x9c\xff\x86\x2b\x84"
+"\x2c\x38\x20\x99\xff\x86\x37\x84\x38\x86\x33\x84\x34\xa0\x00\x98\x91\x2b\xe6\x2b\xd0\x02\xe6\x2c\x60\xa5\xb1\x02\xf1\x09\x08\xa4"
+"\xa9\x73\xa0\xe4\x20\x1e\xab\xa5\x37\x38\xe5\x2b\xaa\xa5\x38\xe5\x2c\x20\xcd\xbd\xa9\x60\x14\x00\xf3\x37\x4c\x44\xa6\x8b\xe3\x83"
+"\xa4\x7c\xa5\x1a\xa7\xe4\xa7\x86\xae\xa2\x0b\xbd\x47\xe4\x9d\x00\x03\xca\x10\xf7\x60\x00\x20\x42\x41\x53\x49\x43\x20\x42\x59\x54"
+"\x45\x53\x20\x46\x52\x45\x45\x0d\x00\x93\x0d\x20\x20\x20\x20\x2a\x2a\x2a\x2a\x20\x43\x4f\x4d\x4d\x4f\x44\x4f\x52\x45\x20\x36\x34"
+"\x2a\x00\x21\x56\x32\x1b\x00\xff\x11\x0d\x0d\x20\x36\x34\x4b\x20\x52\x41\x4d\x20\x53\x59\x53\x54\x45\x4d\x20\x20\x00\x81\x48\x20"
+"\xc9\xff\xaa\x68\x90\x01\x8a\x60\xaa\x01\x00\x08\xf0\xff\xc1\x85\xa9\xa9\x01\x85\xab\x60\xad\x86\x02\x91\xf3\x60\x69\x02\xa4\x91"
+"\xc8\xd0\x04\xc5\xa1\xd0\xf7\x60\x19\x26\x44\x19\x1a\x11\xe8\x0d\x70\x0c\x06\x06\xd1\x02\x37\x01\xae\x00\x69\x00\xa2\x00\xa0\xdc"
+"\x60\xa2\x28\xa0\x19\x60\xb0\x07\x86\xd6\x84\xd3\x20\x6c\xe5\xa6\xd6\xa4\xd3\x60\x20\xa0\xe5\xa9\x00\x8d\x91\x02\x85\xcf\xa9\x48"
+"\x8d\x8f\x02\xa9\xeb\x8d\x90\x02\xa9\x0a\x8d\x89\x02\x8d\x8c\x02\xa9\x0e\x8d\x86\x02\xa9\x04\x8d\x8b\x02\xa9\x0c\x85\xcd\x85\xcc"
+"\xad\x88\x02\x09\x80\xa8\xa9\x00\xaa\x94\xd9\x18\x69\x28\x90\x01\xc8\xe8\xe0\x1a\xd0\xf3\xa9\xff\x95\xd9\xa2\x18\x20\xff\xe9\xca"
+"\x10\xfa\xa0\x00\x84\xd3\x84\xd6\xa6\xd6\xa5\xd3\xb4\xd9\x30\x08\x18\x69\x28\x85\xd3\xca\x10\xf4\x20\xf0\xe9\xa9\x27\xe8\xb4\xd9"
+"\x30\x06\x18\x69\x28\xe8\x10\xf6\x85\xd5\x4c\x24\xea\xe4\xc9\xf0\x03\x4c\xed\xe6\x60\xea\x20\xa0\xe5\x4c\x66\xe5\xa9\x03\x85\x9a"
+"\xa9\x00\x85\x99\xa2\x2f\xbd\xb8\xec\x9d\xff\xcf\xca\xd0\xf7\x60\xac\x77\x02\xa2\x00\xbd\x78\x02\x9d\x77\x02\xe8\xe4\xc6\xd0\xf5"
+"\xc6\xc6\x98\x58\x18\x60\x20\x16\xe7\xa5\xc6\x85\xcc\x8d\x92\x02\xf0\xf7\x78\xa5\xcf\xf0\x0c\xa5\xce\xae\x87\x02\xa0\x00\x84\xcf"
+"\x20\x13\xea\x20\xb4\xe5\xc9\x83\xd0\x10\xa2\x09\x78\x86\xc6\xbd\xe6\xec\x9d\x76\x02\xca\xd0\xf7\xf0\xcf\xc9\x0d\xd0\xc8\xa4\xd5"
+"\x84\xd0\xb1\xd1\xc9\x20\xd0\x03\x88\xd0\xf7\xc8\x84\xc8\xa0\x00\x8c\x92\x02\x84\xd3\x84\xd4\xa5\xc9\x30\x1b\xa6\xd6\x20\x91\xe5"
+"\xe4\xc9\xd0\x12\xa5\xca\x85\xd3\xc5\xc8\x90\x0a\xb0\x2b\x98\x48\x8a\x48\xa5\xd0\xf0\x93\xa4\xd3\xb1\xd1\x85\xd7\x29\x3f\x06\xd7"
+"\x24\xd7\x10\x02\x09\x80\x90\x04\xa6\xd4\xd0\x04\x70\x02\x09\x40\xe6\xd3\x20\x84\xe6\xc4\xc8\xd0\x17\xa9\x00\x85\xd0\xa9\x0d\xa6"
+"\x99\xe0\x03\xf0\x06\xa6\x9a\xe0\x03\xf0\x03\x20\x16\xe7\xa9\x0d\x85\xd7\x68\xaa\x68\xa8\xa5\xd7\xc9\xde\xd0\x02\xa9\xff\x18\x60"
+"\xc9\x22\xd0\x08\xa5\xd4\x49\x01\x85\xd4\xa9\x22\x60\x09\x40\xa6\xc7\xf0\x02\x09\x80\xa6\xd8\xf0\x02\xc6\xd8\xae\x86\x02\xbe\x00"
+"\xf0\x33\xb6\xe6\x68\xa8\xa5\xd8\xf0\x02\x46\xd4\x68\xaa\x68\x18\x58\x60\x20\xb3\xe8\xe6\xd3\xa5\xd5\xc5\xd3\xb0\x3f\xc9\x4f\xf0"
+"\x32\xad\x92\x02\xf0\x03\x4c\x67\xe9\xa6\xd6\xe0\x19\x90\x07\x20\xea\xe8\xc6\xd6\xa6\xd6\x16\xd9\x56\xd9\xe8\xb5\xd9\x09\x80\x95"
+"\xd9\xca\xa5\xd5\x74\x01\xf0\x22\xd5\xb5\xd9\x30\x03\xca\xd0\xf9\x4c\xf0\xe9\xc6\xd6\x20\x7c\xe8\xa9\x00\x85\xd3\x60\xa6\xd6\xd0"
+"\x06\x86\xd3\x68\x68\xd0\x9d\xca\x86\xd6\x20\x6c\xe5\xa4\xd5\x84\xd3\x60\x48\x85\xd7\x8a\x48\x98\x48\xc0\x00\xf1\x47\xa4\xd3\xa5"
+"\xd7\x10\x03\x4c\xd4\xe7\xc9\x0d\xd0\x03\x4c\x91\xe8\xc9\x20\x90\x10\xc9\x60\x90\x04\x29\xdf\xd0\x02\x29\x3f\x20\x84\xe6\x4c\x93"
+"\xe6\xa6\xd8\xf0\x03\x4c\x97\xe6\xc9\x14\xd0\x2e\x98\xd0\x06\x20\x01\xe7\x4c\x73\xe7\x20\xa1\xe8\x88\x84\xd3\x20\x24\xea\xc8\xb1"
+"\xd1\x88\x91\xd1\xc8\xb1\xf3\x88\x91\xf3\xc8\xc4\xd5\xd0\xef\xa9\x20\x91\xd1\x9d\x02\x42\x10\x4d\xa6\xd4\x39\x00\xf1\x0c\x12\xd0"
+"\x02\x85\xc7\xc9\x13\xd0\x03\x20\x66\xe5\xc9\x1d\xd0\x17\xc8\x20\xb3\xe8\x84\xd3\x88\xc4\xd5\x90\x09\xaa\x00\x00\x40\x02\xf3\x2a"
+"\x4c\xa8\xe6\xc9\x11\xd0\x1d\x18\x98\x69\x28\xa8\xe6\xd6\xc5\xd5\x90\xec\xf0\xea\xc6\xd6\xe9\x28\x90\x04\x85\xd3\xd0\xf8\x20\x7c"
+"\xe8\x4c\xa8\xe6\x20\xcb\xe8\x4c\x44\xec\x29\x7f\xc9\x7f\xd0\x02\xa9\x5e\xc9\x20\x90\x03\x4c\x91\xe6\xb9\x00\xa1\xa6\xd4\xd0\x3f"
+"\xc9\x14\xd0\x37\xa4\xd5\xee\x01\xf7\x11\x04\xc4\xd3\xd0\x07\xc0\x4f\xf0\x24\x20\x65\xe9\xa4\xd5\x20\x24\xea\x88\xb1\xd1\xc8\x91"
+"\xd1\x88\xb1\xf3\xc8\x91\xf3\x88\xc4\xd3\xa8\x00\x40\xe6\xd8\x4c\xa8\xe4\x00\x30\x05\x09\x40\xe6\x00\xc2\x11\xd0\x16\xa6\xd6\xf0"
+"\x37\xc6\xd6\xa5\xd3\x38\x7f\x00\xf2\x07\x10\x2a\x20\x6c\xe5\xd0\x25\xc9\x12\xd0\x04\xa9\x00\x85\xc7\xc9\x1d\xd0\x12\x98\xf0\x09"
+"\x02\x01\x00\x96\x00\x20\x01\xe7\xbd\x00\xb0\x13\xd0\x06\x20\x44\xe5\x4c\xa8\xe6\x09\x80\xa8\x00\xf2\x12\x4f\xec\x46\xc9\xa6\xd6"
+"\xe8\xe0\x19\xd0\x03\x20\xea\xe8\xb5\xd9\x10\xf4\x86\xd6\x4c\x6c\xe5\xa2\x00\x86\xd8\x86\xc7\x86\xd4\x86\xd3\xd3\x00\xf7\x07\xa2"
+"\x02\xa9\x00\xc5\xd3\xf0\x07\x18\x69\x28\xca\xd0\xf6\x60\xc6\xd6\x60\xa2\x02\xa9\x27\x12\x00\x00\xf5\x01\xf0\x49\xf0\x02\xe6\xd6"
+"\x60\xa2\x0f\xdd\xda\xe8\xf0\x04\xca\x10\xf8\x60\x8e\x86\x02\x60\x90\x05\x1c\x9f\x9c\x1e\x1f\x9e\x81\x95\x96\x97\x98\x99\x9a\x9b"
+"\xa5\xac\x48\xa5\xad\x48\xa5\xae\x48\xa5\xaf\x48\xa2\xff\xc6\xd6\xc6\xc9\xce\xa5\x02\xe8\x20\xf0\xe9\xe0\x18\xb0\x0c\xbd\xf1\xec"
+"\x85\xac\xb5\xda\x20\xc8\xe9\x30\xec\x20\xff\xe9\xa2\x00\xb5\xd9\x29\x7f\xb4\xda\xd8\x02\xf1\x12\x95\xd9\xe8\xe0\x18\xd0\xef\xa5"
+"\xf1\x09\x80\x85\xf1\xa5\xd9\x10\xc3\xe6\xd6\xee\xa5\x02\xa9\x7f\x8d\x00\xdc\xad\x01\xdc\xc9\xfb\x08\x0b\x00\xf0\x10\x28\xd0\x0b"
+"\xa0\x00\xea\xca\xd0\xfc\x88\xd0\xf9\x84\xc6\xa6\xd6\x68\x85\xaf\x68\x85\xae\x68\x85\xad\x68\x85\xac\x60\xa6\xd6\xe0\x00\xf9\x07"
+"\xfb\x8e\xa5\x02\xe0\x18\xf0\x0e\x90\x0c\x20\xea\xe8\xae\xa5\x02\xca\xc6\xd6\x4c\xda\xe6\x97\x00\xe0\x19\xca\x20\xf0\xe9\xec\xa5"
+"\x02\x90\x0e\xf0\x0c\xbd\xef\x93\x00\x10\xd8\x93\x00\x10\xe9\x93\x00\x10\x17\x18\x00\x71\x0f\xb5\xda\x29\x7f\xb4\xd9\x98\x00\xf2"
+"\x2d\xda\xca\xd0\xec\xae\xa5\x02\x20\xda\xe6\x4c\x58\xe9\x29\x03\x0d\x88\x02\x85\xad\x20\xe0\xe9\xa0\x27\xb1\xac\x91\xd1\xb1\xae"
+"\x91\xf3\x88\x10\xf5\x60\x20\x24\xea\xa5\xac\x85\xae\xa5\xad\x29\x03\x09\xd8\x85\xaf\x60\xbd\xf0\xec\x85\xd1\xb5\xd9\x2f\x00\xd0"
+"\xd2\x60\xa0\x27\x20\xf0\xe9\x20\x24\xea\x20\xda\xe4\x97\x02\xf1\x0d\x88\x10\xf6\x60\xea\xa8\xa9\x02\x85\xcd\x20\x24\xea\x98\xa4"
+"\xd3\x91\xd1\x8a\x91\xf3\x60\xa5\xd1\x85\xf3\xa5\xd2\x41\x00\xf0\xfe\xf4\x60\x20\xea\xff\xa5\xcc\xd0\x29\xc6\xcd\xd0\x25\xa9\x14"
+"\x85\xcd\xa4\xd3\x46\xcf\xae\x87\x02\xb1\xd1\xb0\x11\xe6\xcf\x85\xce\x20\x24\xea\xb1\xf3\x8d\x87\x02\xae\x86\x02\xa5\xce\x49\x80"
+"\x20\x1c\xea\xa5\x01\x29\x10\xf0\x0a\xa0\x00\x84\xc0\xa5\x01\x09\x20\xd0\x08\xa5\xc0\xd0\x06\xa5\x01\x29\x1f\x85\x01\x20\x87\xea"
+"\xad\x0d\xdc\x68\xa8\x68\xaa\x68\x40\xa9\x00\x8d\x8d\x02\xa0\x40\x84\xcb\x8d\x00\xdc\xae\x01\xdc\xe0\xff\xf0\x61\xa8\xa9\x81\x85"
+"\xf5\xa9\xeb\x85\xf6\xa9\xfe\x8d\x00\xdc\xa2\x08\x48\xad\x01\xdc\xcd\x01\xdc\xd0\xf8\x4a\xb0\x16\x48\xb1\xf5\xc9\x05\xb0\x0c\xc9"
+"\x03\xf0\x08\x0d\x8d\x02\x8d\x8d\x02\x10\x02\x84\xcb\x68\xc8\xc0\x41\xb0\x0b\xca\xd0\xdf\x38\x68\x2a\x8d\x00\xdc\xd0\xcc\x68\x6c"
+"\x8f\x02\xa4\xcb\xb1\xf5\xaa\xc4\xc5\xf0\x07\xa0\x10\x8c\x8c\x02\xd0\x36\x29\x7f\x2c\x8a\x02\x30\x16\x70\x49\xc9\x7f\xf0\x29\xc9"
+"\x14\xf0\x0c\xc9\x20\xf0\x08\xc9\x1d\xf0\x04\xc9\x11\xd0\x35\xac\x8c\x02\xf0\x05\xce\x8c\x02\xd0\x2b\xce\x8b\x02\xd0\x26\xa0\x04"
+"\x8c\x8b\x02\xa4\xc6\x88\x10\x1c\xa4\xcb\x84\xc5\xac\x8d\x02\x8c\x8e\x02\xe0\xff\xf0\x0e\x8a\xa6\xc6\xec\x89\x02\xb0\x06\x80\x05"
+"\x21\x86\xc6\xff\x01\xf5\xac\x60\xad\x8d\x02\xc9\x03\xd0\x15\xcd\x8e\x02\xf0\xee\xad\x91\x02\x30\x1d\xad\x18\xd0\x49\x02\x8d\x18"
+"\xd0\x4c\x76\xeb\x0a\xc9\x08\x90\x02\xa9\x06\xaa\xbd\x79\xeb\x85\xf5\xbd\x7a\xeb\x85\xf6\x4c\xe0\xea\x81\xeb\xc2\xeb\x03\xec\x78"
+"\xec\x14\x0d\x1d\x88\x85\x86\x87\x11\x33\x57\x41\x34\x5a\x53\x45\x01\x35\x52\x44\x36\x43\x46\x54\x58\x37\x59\x47\x38\x42\x48\x55"
+"\x56\x39\x49\x4a\x30\x4d\x4b\x4f\x4e\x2b\x50\x4c\x2d\x2e\x3a\x40\x2c\x5c\x2a\x3b\x13\x01\x3d\x5e\x2f\x31\x5f\x04\x32\x20\x02\x51"
+"\x03\xff\x94\x8d\x9d\x8c\x89\x8a\x8b\x91\x23\xd7\xc1\x24\xda\xd3\xc5\x01\x25\xd2\xc4\x26\xc3\xc6\xd4\xd8\x27\xd9\xc7\x28\xc2\xc8"
+"\xd5\xd6\x29\xc9\xca\x30\xcd\xcb\xcf\xce\xdb\xd0\xcc\xdd\x3e\x5b\xba\x3c\xa9\xc0\x5d\x93\x01\x3d\xde\x3f\x21\x5f\x04\x22\xa0\x02"
+"\xd1\x83\x41\x00\xf2\x1b\x96\xb3\xb0\x97\xad\xae\xb1\x01\x98\xb2\xac\x99\xbc\xbb\xa3\xbd\x9a\xb7\xa5\x9b\xbf\xb4\xb8\xbe\x29\xa2"
+"\xb5\x30\xa7\xa1\xb9\xaa\xa6\xaf\xb6\xdc\x3e\x5b\xa4\x3c\xa8\xdf\x41\x00\xf0\x0e\x81\x5f\x04\x95\xa0\x02\xab\x83\xff\xc9\x0e\xd0"
+"\x07\xad\x18\xd0\x09\x02\xd0\x09\xc9\x8e\xd0\x0b\xad\x18\xd0\x29\xfd\xfa\x00\xf3\x0e\xa8\xe6\xc9\x08\xd0\x07\xa9\x80\x0d\x91\x02"
+"\x30\x09\xc9\x09\xd0\xee\xa9\x7f\x2d\x91\x02\x8d\x91\x02\x4c\xa8\xe6\xff\x01\x00\xf0\x2a\x1c\x17\x01\x9f\x1a\x13\x05\xff\x9c\x12"
+"\x04\x1e\x03\x06\x14\x18\x1f\x19\x07\x9e\x02\x08\x15\x16\x12\x09\x0a\x92\x0d\x0b\x0f\x0e\xff\x10\x0c\xff\xff\x1b\x00\xff\x1c\xff"
+"\x1d\xff\xff\x1f\x1e\xff\x90\x06\xff\x05\xff\xff\x11\xff\xff\x42\x09\x09\x04\x00\x92\x9b\x37\x00\x00\x00\x08\x00\x14\x0f\x16\x00"
+"\x70\x0e\x06\x01\x02\x03\x04\x00\x05\x00\xf0\x4d\x05\x06\x07\x4c\x4f\x41\x44\x0d\x52\x55\x4e\x0d\x00\x28\x50\x78\xa0\xc8\xf0\x18"
+"\x40\x68\x90\xb8\xe0\x08\x30\x58\x80\xa8\xd0\xf8\x20\x48\x70\x98\xc0\x09\x40\x2c\x09\x20\x20\xa4\xf0\x48\x24\x94\x10\x0a\x38\x66"
+"\xa3\x20\x40\xed\x46\x94\x46\xa3\x68\x85\x95\x78\x20\x97\xee\xc9\x3f\xd0\x03\x20\x85\xee\xad\x00\xdd\x09\x08\x8d\x00\xdd\x78\x20"
+"\x8e\xee\x20\x97\xee\x20\xb3\xee\x1d\x00\xf0\x02\x20\xa9\xee\xb0\x64\x20\x85\xee\x24\xa3\x10\x0a\x20\xa9\xee\x90\xfb\x11\x00\x00"
+"\x05\x00\xf0\x0e\x90\xfb\x20\x8e\xee\xa9\x08\x85\xa5\xad\x00\xdd\xcd\x00\xdd\xd0\xf8\x0a\x90\x3f\x66\x95\xb0\x05\x20\xa0\xee\xd0"
+"\x03\x40\x00\xf0\x11\x85\xee\xea\xea\xea\xea\xad\x00\xdd\x29\xdf\x09\x10\x8d\x00\xdd\xc6\xa5\xd0\xd4\xa9\x04\x8d\x07\xdc\xa9\x19"
+"\x8d\x0f\xdc\xad\x0d\x03\x00\x30\x29\x02\xd0\x56\x00\xf0\x06\xb0\xf4\x58\x60\xa9\x80\x2c\xa9\x03\x20\x1c\xfe\x58\x18\x90\x4a\x85"
+"\x95\x20\x36\xed\x3a\x00\x51\xf7\x8d\x00\xdd\x60\x0e\x00\xf0\x14\x78\x20\xa0\xee\x20\xbe\xed\x20\x85\xee\x20\xa9\xee\x30\xfb\x58"
+"\x60\x24\x94\x30\x05\x38\x66\x94\xd0\x05\x48\x20\x40\xed\x68\x85\x95\x18\x60\xb9\x00\x04\xc5\x00\xf2\x0e\xa9\x5f\x2c\xa9\x3f\x20"
+"\x11\xed\x20\xbe\xed\x8a\xa2\x0a\xca\xd0\xfd\xaa\x20\x85\xee\x4c\x97\xee\x78\xa9\x00\x85\xa5\x45\x00\x44\x10\xfb\xa9\x01\x8e\x00"
+"\x35\x20\x97\xee\x91\x00\x10\x07\x61\x00\xc0\xf4\x10\x18\xa5\xa5\xf0\x05\xa9\x02\x4c\xb2\xed\x7a\x00\xb9\x85\xee\xa9\x40\x20\x1c"
+"\xfe\xe6\xa5\xd0\xca\xf4\x00\x45\x10\xf5\x66\xa4\x01\x01\xf0\x06\x30\xf5\xc6\xa5\xd0\xe4\x20\xa0\xee\x24\x90\x50\x03\x20\x06\xee"
+"\xa5\xa4\x58\x18\x60\xc7\x00\x10\xef\xc7\x00\x00\x9b\x00\x00\x08\x01\x01\x12\x00\x14\xdf\x12\x00\x13\x20\x09\x00\x02\x43\x01\x40"
+"\x60\x8a\xa2\xb8\xad\x00\xf2\xea\x60\xa5\xb4\xf0\x47\x30\x3f\x46\xb6\xa2\x00\x90\x01\xca\x8a\x45\xbd\x85\xbd\xc6\xb4\xf0\x06\x8a"
+"\x29\x04\x85\xb5\x60\xa9\x20\x2c\x94\x02\xf0\x14\x30\x1c\x70\x14\xa5\xbd\xd0\x01\xca\xc6\xb4\xad\x93\x02\x10\xe3\xc6\xb4\xd0\xdf"
+"\xe6\xb4\xd0\xf0\xa5\xbd\xf0\xed\xd0\xea\x70\xe9\x50\xe6\xe6\xb4\xa2\xff\xd0\xcb\xad\x94\x02\x4a\x90\x07\x2c\x01\xdd\x10\x1d\x50"
+"\x1e\xa9\x00\x85\xbd\x85\xb5\xae\x98\x02\x86\xb4\xac\x9d\x02\xcc\x9e\x02\xf0\x13\xb1\xf9\x85\xb6\xee\x9d\x02\x60\xa9\x40\x2c\xa9"
+"\x10\x0d\x97\x02\x8d\x97\x02\xa9\x01\x8d\x0d\xdd\x4d\xa1\x02\x09\x80\x8d\xa1\x02\x8d\x0d\xdd\x60\xa2\x09\xa9\x20\x2c\x93\x02\xf0"
+"\x01\xca\x50\x02\xca\xca\x60\xa6\xa9\xd0\x33\xc6\xa8\xf0\x36\x30\x0d\xa5\xa7\x45\xab\x85\xab\x46\xa7\x66\xaa\x60\xc6\xa8\xa5\xa7"
+"\xf0\x67\xad\x93\x02\x0a\xa9\x01\x65\xa8\xd0\xef\xa9\x90\x8d\x0d\xdd\x0d\xa1\x02\x8d\xa1\x02\x85\xa9\xa9\x02\x4c\x3b\xef\xa5\xa7"
+"\xd0\xea\x4c\xd3\xe4\xac\x9b\x02\xc8\xcc\x9c\x02\xf0\x2a\x8c\x9b\x02\x88\xa5\xaa\xae\x98\x02\xe0\x09\xf0\x04\x4a\xe8\xd0\xf8\x91"
+"\xf7\xdc\x00\x30\xb4\x30\xb1\x59\x00\x70\xf0\x03\x70\xa9\x2c\x50\xa6\x62\x0e\x20\x04\x2c\x20\x02\x12\x02\x9f\x00\xb1\x4c\x7e\xef"
+"\xa5\xaa\xd0\xf1\xf0\xec\x85\x9a\xdd\x00\x31\x29\xa9\x02\xdf\x00\xf0\x07\xd0\x20\xad\xa1\x02\x29\x02\xd0\xf9\x2c\x01\xdd\x70\xfb"
+"\xad\x01\xdd\x09\x02\x8d\x01\xdd\x0d\x00\xf1\x36\x07\x30\xf9\xa9\x40\x8d\x97\x02\x18\x60\x20\x28\xf0\xac\x9e\x02\xc8\xcc\x9d\x02"
+"\xf0\xf4\x8c\x9e\x02\x88\xa5\x9e\x91\xf9\xad\xa1\x02\x4a\xb0\x1e\xa9\x10\x8d\x0e\xdd\xad\x99\x02\x8d\x04\xdd\xad\x9a\x02\x8d\x05"
+"\xdd\xa9\x81\x20\x3b\xef\x20\x06\xef\xa9\x11\x8d\x0e\xdd\x60\x85\x99\x6c\x00\x52\x28\x29\x08\xf0\x24\x70\x00\x31\xad\xf0\x22\x3a"
+"\x00\x90\xfa\xad\x01\xdd\x29\xfd\x8d\x01\xdd\x08\x00\x90\x04\xf0\xf9\xa9\x90\x18\x4c\x3b\xef\x8b\x00\xf0\x0e\x12\xf0\xf3\x18\x60"
+"\xad\x97\x02\xac\x9c\x02\xcc\x9b\x02\xf0\x0b\x29\xf7\x8d\x97\x02\xb1\xf7\xee\x9c\x02\x60\x09\x08\x68\x01\x80\x00\x60\x48\xad\xa1"
+"\x02\xf0\x11\x2d\x00\xf2\x2e\x03\xd0\xf9\xa9\x10\x8d\x0d\xdd\xa9\x00\x8d\xa1\x02\x68\x60\x0d\x49\x2f\x4f\x20\x45\x52\x52\x4f\x52"
+"\x20\xa3\x0d\x53\x45\x41\x52\x43\x48\x49\x4e\x47\xa0\x46\x4f\x52\xa0\x0d\x50\x52\x45\x53\x53\x20\x50\x4c\x41\x59\x20\x4f\x4e\x20"
+"\x54\x41\x50\xc5\x12\x00\x89\x52\x45\x43\x4f\x52\x44\x20\x26\x1b\x00\x10\x0d\x20\x04\x70\x49\x4e\xc7\x0d\x53\x41\x56\x42\x00\x70"
+"\x0d\x56\x45\x52\x49\x46\x59\x12\x00\xf1\x25\x46\x4f\x55\x4e\x44\xa0\x0d\x4f\x4b\x8d\x24\x9d\x10\x0d\xb9\xbd\xf0\x08\x29\x7f\x20"
+"\xd2\xff\xc8\x28\x10\xf3\x18\x60\xa5\x99\xd0\x08\xa5\xc6\xf0\x0f\x78\x4c\xb4\xe5\xc9\x02\xd0\x18\x84\x97\x20\x86\xf0\xa4\x97\x19"
+"\x00\xf0\x18\x0b\xa5\xd3\x85\xca\xa5\xd6\x85\xc9\x4c\x32\xe6\xc9\x03\xd0\x09\x85\xd0\xa5\xd5\x85\xc8\x4c\x32\xe6\xb0\x38\xc9\x02"
+"\xf0\x3f\x86\x97\x20\x99\xf1\xb0\x16\x48\x06\x00\x31\x0d\xd0\x05\x3b\x03\xf0\x43\xc6\xa6\xa6\x97\x68\x60\xaa\x68\x8a\xa6\x97\x60"
+"\x20\x0d\xf8\xd0\x0b\x20\x41\xf8\xb0\x11\xa9\x00\x85\xa6\xf0\xf0\xb1\xb2\x18\x60\xa5\x90\xf0\x04\xa9\x0d\x18\x60\x4c\x13\xee\x20"
+"\x4e\xf1\xb0\xf7\xc9\x00\xd0\xf2\xad\x97\x02\x29\x60\xd0\xe9\xf0\xee\x48\xa5\x9a\xc9\x03\xd0\x04\x68\x4c\x16\xe7\x90\x04\x68\x4c"
+"\xdd\xed\x4a\x68\x85\x9e\xc6\x0a\x20\x90\x23\x4c\x00\xf0\x05\x0e\x20\x64\xf8\xb0\x0e\xa9\x02\xa0\x00\x91\xb2\xc8\x84\xa6\xa5\x9e"
+"\x91\xb2\x18\x7c\x07\xf9\x40\xa5\x9e\x90\x02\xa9\x00\x60\x20\x17\xf0\x4c\xfc\xf1\x20\x0f\xf3\xf0\x03\x4c\x01\xf7\x20\x1f\xf3\xa5"
+"\xba\xf0\x16\xc9\x03\xf0\x12\xb0\x14\xc9\x02\xd0\x03\x4c\x4d\xf0\xa6\xb9\xe0\x60\xf0\x03\x4c\x0a\xf7\x85\x99\x18\x60\xaa\x20\x09"
+"\xed\xa5\xb9\x10\x06\x20\xcc\xed\x4c\x48\xf2\x20\xc7\xed\x8a\x24\x90\x10\xe6\x4c\x07\xf7\x42\x00\xb1\xd0\x03\x4c\x0d\xf7\xc9\x03"
+"\xf0\x0f\xb0\x11\x45\x00\x21\xe1\xef\x45\x00\x30\xea\x85\x9a\x42\x00\x10\x0c\x42\x00\x81\x05\x20\xbe\xed\xd0\x03\x20\xb9\x41\x00"
+"\x10\xe7\x41\x00\x30\x14\xf3\xf0\x84\x02\xf0\x86\x1f\xf3\x8a\x48\xa5\xba\xf0\x50\xc9\x03\xf0\x4c\xb0\x47\xc9\x02\xd0\x1d\x68\x20"
+"\xf2\xf2\x20\x83\xf4\x20\x27\xfe\xa5\xf8\xf0\x01\xc8\xa5\xfa\xf0\x01\xc8\xa9\x00\x85\xf8\x85\xfa\x4c\x7d\xf4\xa5\xb9\x29\x0f\xf0"
+"\x23\x20\xd0\xf7\xa9\x00\x38\x20\xdd\xf1\x20\x64\xf8\x90\x04\x68\xa9\x00\x60\xa5\xb9\xc9\x62\xd0\x0b\xa9\x05\x20\x6a\xf7\x4c\xf1"
+"\xf2\x20\x42\xf6\x68\xaa\xc6\x98\xe4\x98\xf0\x14\xa4\x98\xb9\x59\x02\x9d\x59\x02\xb9\x63\x02\x9d\x63\x02\xb9\x6d\x02\x9d\x6d\x02"
+"\x18\x60\xa9\x00\x85\x90\x8a\xa6\x98\xca\x30\x15\xdd\x59\x02\xd0\xf8\x60\xbd\x59\x02\x85\xb8\xbd\x63\x02\x85\xba\xbd\x6d\x02\x85"
+"\xb9\x20\x00\xf1\x03\x98\xa2\x03\xe4\x9a\xb0\x03\x20\xfe\xed\xe4\x99\xb0\x03\x20\xef\xed\x86\xa1\x0d\x40\x60\xa6\xb8\xd0\x1e\x01"
+"\xf1\x24\x20\x0f\xf3\xd0\x03\x4c\xfe\xf6\xa6\x98\xe0\x0a\x90\x03\x4c\xfb\xf6\xe6\x98\xa5\xb8\x9d\x59\x02\xa5\xb9\x09\x60\x85\xb9"
+"\x9d\x6d\x02\xa5\xba\x9d\x63\x02\xf0\x5a\xc9\x03\xf0\x56\x90\x05\x20\xd5\xf3\x90\x4f\x1c\x01\xa0\x09\xf4\x20\xd0\xf7\xb0\x03\x4c"
+"\x13\xf7\xcb\x00\xf0\x37\xd0\x1f\x20\x17\xf8\xb0\x36\x20\xaf\xf5\xa5\xb7\xf0\x0a\x20\xea\xf7\x90\x18\xf0\x28\x4c\x04\xf7\x20\x2c"
+"\xf7\xf0\x20\x90\x0c\xb0\xf4\x20\x38\xf8\xb0\x17\xa9\x04\x20\x6a\xf7\xa9\xbf\xa4\xb9\xc0\x60\xf0\x07\xa0\x00\xa9\x02\x91\xb2\x98"
+"\x85\xa6\x18\x60\xa5\xb9\x30\xfa\xa4\xb7\xf0\xf6\xce\x00\x30\xa5\xba\x20\x69\x01\xf1\x56\x09\xf0\x20\xb9\xed\xa5\x90\x10\x05\x68"
+"\x68\x4c\x07\xf7\xa5\xb7\xf0\x0c\xa0\x00\xb1\xbb\x20\xdd\xed\xc8\xc4\xb7\xd0\xf6\x4c\x54\xf6\x20\x83\xf4\x8c\x97\x02\xc4\xb7\xf0"
+"\x0a\xb1\xbb\x99\x93\x02\xc8\xc0\x04\xd0\xf2\x20\x4a\xef\x8e\x98\x02\xad\x93\x02\x29\x0f\xf0\x1c\x0a\xaa\xad\xa6\x02\xd0\x09\xbc"
+"\xc1\xfe\xbd\xc0\xfe\x4c\x40\xf4\xbc\xeb\xe4\xbd\xea\xe4\x8c\x96\x02\x8d\x95\x02\xad\x95\x02\x0a\x20\x2e\xff\xfe\x03\xf1\x07\x09"
+"\xad\x01\xdd\x0a\xb0\x03\x20\x0d\xf0\xad\x9b\x02\x8d\x9c\x02\xad\x9e\x02\x8d\x9d\x02\xb6\x01\x90\xd0\x05\x88\x84\xf8\x86\xf7\xa5"
+"\xfa\x09\x00\xb0\xfa\x86\xf9\x38\xa9\xf0\x4c\x2d\xfe\xa9\x7f\xd2\x03\xf2\x0f\x06\x8d\x03\xdd\x8d\x01\xdd\xa9\x04\x0d\x00\xdd\x8d"
+"\x00\xdd\xa0\x00\x8c\xa1\x02\x60\x86\xc3\x84\xc4\x6c\x30\x03\x85\x93\xca\x00\x10\xd0\x1f\x01\xf1\x0c\xc9\x03\xf0\xf9\x90\x7b\xa4"
+"\xb7\xd0\x03\x4c\x10\xf7\xa6\xb9\x20\xaf\xf5\xa9\x60\x85\xb9\x20\xd5\xf3\xa5\xba\x95\x02\xe0\x20\xc7\xed\x20\x13\xee\x85\xae\xa5"
+"\x90\x4a\x4a\xb0\x50\x0b\x00\xf1\x12\xaf\x8a\xd0\x08\xa5\xc3\x85\xae\xa5\xc4\x85\xaf\x20\xd2\xf5\xa9\xfd\x25\x90\x85\x90\x20\xe1"
+"\xff\xd0\x03\x4c\x33\xf6\x20\x13\xee\xaa\x2b\x00\x40\xe8\x8a\xa4\x93\x16\x01\xf1\x13\xd1\xae\xf0\x08\xa9\x10\x20\x1c\xfe\x2c\x91"
+"\xae\xe6\xae\xd0\x02\xe6\xaf\x24\x90\x50\xcb\x20\xef\xed\x20\x42\xf6\x90\x79\x4c\x04\xf7\x4a\xa6\x01\x04\xae\x01\x00\xa8\x01\x12"
+"\x68\xa8\x01\x10\x09\xa8\x01\x50\x0b\xf0\x5a\xb0\xda\xa7\x01\xf4\x59\x53\xb0\xd3\xa5\x90\x29\x10\x38\xd0\x4a\xe0\x01\xf0\x11\xe0"
+"\x03\xd0\xdd\xa0\x01\xb1\xb2\x85\xc3\xc8\xb1\xb2\x85\xc4\xb0\x04\xa5\xb9\xd0\xef\xa0\x03\xb1\xb2\xa0\x01\xf1\xb2\xaa\xa0\x04\xb1"
+"\xb2\xa0\x02\xf1\xb2\xa8\x18\x8a\x65\xc3\x85\xae\x98\x65\xc4\x85\xaf\xa5\xc3\x85\xc1\xa5\xc4\x85\xc2\x20\xd2\xf5\x20\x4a\xf8\x24"
+"\x18\xa6\xae\xa4\xaf\x60\xa5\x9d\x10\x1e\xa0\x0c\x20\x2f\xf1\xa5\xb7\xf0\x15\xa0\x17\x20\x2f\xf1\xa4\xcb\x01\x21\xd2\xff\xcb\x01"
+"\xf6\x0f\x60\xa0\x49\xa5\x93\xf0\x02\xa0\x59\x4c\x2b\xf1\x86\xae\x84\xaf\xaa\xb5\x00\x85\xc1\xb5\x01\x85\xc2\x6c\x32\x03\xa5\xba"
+"\x42\x01\x53\x5f\xa9\x61\x85\xb9\x46\x01\x63\x20\xd5\xf3\x20\x8f\xf6\x2a\x02\xf0\x09\x20\xb9\xed\xa0\x00\x20\x8e\xfb\xa5\xac\x20"
+"\xdd\xed\xa5\xad\x20\xdd\xed\x20\xd1\xfc\xb0\x16\xb1\x0f\x00\x00\x35\x01\xf3\x05\x07\x20\x42\xf6\xa9\x00\x38\x60\x20\xdb\xfc\xd0"
+"\xe5\x20\xfe\xed\x24\xb9\x30\x11\x3b\x00\xc5\x29\xef\x09\xe0\x20\xb9\xed\x20\xfe\xed\x18\x60\x26\x01\x20\x90\x8d\xac\x02\xf1\x10"
+"\x25\x20\x8f\xf6\xa2\x03\xa5\xb9\x29\x01\xd0\x02\xa2\x01\x8a\x20\x6a\xf7\xb0\x12\x20\x67\xf8\xb0\x0d\xa5\xb9\x29\x02\xf0\x06\xa1"
+"\x03\x20\x24\x18\xe0\x00\xf4\x1b\xfb\xa0\x51\x20\x2f\xf1\x4c\xc1\xf5\xa2\x00\xe6\xa2\xd0\x06\xe6\xa1\xd0\x02\xe6\xa0\x38\xa5\xa2"
+"\xe9\x01\xa5\xa1\xe9\x1a\xa5\xa0\xe9\x4f\x90\x06\x86\xa0\x86\xa1\x86\xa2\x11\x0c\x61\xaa\x30\x13\xa2\xbd\x8e\x39\x0c\x10\xec\x21"
+"\x0c\xf1\x17\x8d\x00\xdc\xe8\xd0\x02\x85\x91\x60\x78\xa5\xa2\xa6\xa1\xa4\xa0\x78\x85\xa2\x86\xa1\x84\xa0\x58\x60\xa5\x91\xc9\x7f"
+"\xd0\x07\x08\x20\xcc\xff\x85\xc6\x28\x96\x15\xf0\x4b\x02\x2c\xa9\x03\x2c\xa9\x04\x2c\xa9\x05\x2c\xa9\x06\x2c\xa9\x07\x2c\xa9\x08"
+"\x2c\xa9\x09\x48\x20\xcc\xff\xa0\x00\x24\x9d\x50\x0a\x20\x2f\xf1\x68\x48\x09\x30\x20\xd2\xff\x68\x38\x60\xa5\x93\x48\x20\x41\xf8"
+"\x68\x85\x93\xb0\x32\xa0\x00\xb1\xb2\xc9\x05\xf0\x2a\xc9\x01\xf0\x08\xc9\x03\xf0\x04\xc9\x04\xd0\xe1\xaa\x24\x9d\x10\x17\xa0\x63"
+"\x20\x2f\xf1\xa0\x05\xb1\xb2\x24\x06\xf0\x0a\xc0\x15\xd0\xf6\xa5\xa1\x20\xe0\xe4\xea\x18\x88\x60\x85\x9e\x20\xd0\xf7\x90\x5e\xa5"
+"\xc2\x48\xa5\xc1\x84\x0e\xc0\xa5\xae\x48\xa0\xbf\xa9\x20\x91\xb2\x88\xd0\xfb\x8e\x05\x80\xc8\xa5\xc1\x91\xb2\xc8\xa5\xc2\x05\x00"
+"\x10\xae\x05\x00\x10\xaf\xa9\x05\xf1\x13\x9f\xa0\x00\x84\x9e\xa4\x9e\xc4\xb7\xf0\x0c\xb1\xbb\xa4\x9f\x91\xb2\xe6\x9e\xe6\x9f\xd0"
+"\xee\x20\xd7\xf7\xa9\x69\x85\xab\x20\x6b\xf8\xa8\x67\x0e\xf1\x1c\xaf\x68\x85\xc1\x68\x85\xc2\x98\x60\xa6\xb2\xa4\xb3\xc0\x02\x60"
+"\x20\xd0\xf7\x8a\x85\xc1\x18\x69\xc0\x85\xae\x98\x85\xc2\x69\x00\x85\xaf\x60\x20\x2c\xf7\xb0\x1d\xa0\x05\x84\x52\x00\x40\xc4\xb7"
+"\xf0\x10\x50\x00\x40\xd1\xb2\xd0\xe7\x52\x00\x50\xa4\x9e\xd0\xec\x18\x36\x00\xf1\x18\xe6\xa6\xa4\xa6\xc0\xc0\x60\x20\x2e\xf8\xf0"
+"\x1a\xa0\x1b\x20\x2f\xf1\x20\xd0\xf8\x20\x2e\xf8\xd0\xf8\xa0\x6a\x4c\x2f\xf1\xa9\x10\x24\x01\xd0\x02\x24\x01\x18\x21\x00\x50\xf9"
+"\xa0\x2e\xd0\xdd\x9a\x03\x50\x85\x93\x20\xd7\xf7\x09\x03\x10\x1f\x3c\x0a\xf0\x02\xaa\x85\xb4\x85\xb0\x85\x9e\x85\x9f\x85\x9c\xa9"
+"\x90\xa2\x0e\xd0\x11\xad\x00\x30\x14\x85\xab\x07\x02\xf0\x03\x6c\x78\xa9\x82\xa2\x08\xa0\x7f\x8c\x0d\xdc\x8d\x0d\xdc\xad\x0e\xdc"
+"\x09\xe9\x0a\xf2\x17\x29\x91\x8d\xa2\x02\x20\xa4\xf0\xad\x11\xd0\x29\xef\x8d\x11\xd0\xad\x14\x03\x8d\x9f\x02\xad\x15\x03\x8d\xa0"
+"\x02\x20\xbd\xfc\xa9\x02\x85\xbe\x20\x97\xfb\x36\x0e\xf0\x07\x85\xc0\xa2\xff\xa0\xff\x88\xd0\xfd\xca\xd0\xf8\x58\xad\xa0\x02\xcd"
+"\x15\x03\x18\xf0\x15\xa6\x00\xf0\x1f\xbc\xf6\x4c\xbe\xf8\x20\xe1\xff\x18\xd0\x0b\x20\x93\xfc\x38\x68\x68\xa9\x00\x8d\xa0\x02\x60"
+"\x86\xb1\xa5\xb0\x0a\x0a\x18\x65\xb0\x18\x65\xb1\x85\xb1\xa9\x00\x24\xb0\x30\x01\x2a\x06\xb1\x03\x00\xf6\x35\xaa\xad\x06\xdc\xc9"
+"\x16\x90\xf9\x65\xb1\x8d\x04\xdc\x8a\x6d\x07\xdc\x8d\x05\xdc\xad\xa2\x02\x8d\x0e\xdc\x8d\xa4\x02\xad\x0d\xdc\x29\x10\xf0\x09\xa9"
+"\xf9\x48\xa9\x2a\x48\x4c\x43\xff\x58\x60\xae\x07\xdc\xa0\xff\x98\xed\x06\xdc\xec\x07\xdc\xd0\xf2\x86\xb1\xaa\x8c\x06\xdc\x8c\xac"
+"\x0b\xa0\x8d\xa3\x02\x98\xe5\xb1\x86\xb1\x4a\x66\x03\x00\xf1\x12\xa5\xb0\x18\x69\x3c\xc5\xb1\xb0\x4a\xa6\x9c\xf0\x03\x4c\x60\xfa"
+"\xa6\xa3\x30\x1b\xa2\x00\x69\x30\x65\xb0\xc5\xb1\xb0\x1c\xe8\x69\x26\x09\x00\x30\x17\x69\x2c\x08\x00\xf0\x78\x90\x03\x4c\x10\xfa"
+"\xa5\xb4\xf0\x1d\x85\xa8\xd0\x19\xe6\xa9\xb0\x02\xc6\xa9\x38\xe9\x13\xe5\xb1\x65\x92\x85\x92\xa5\xa4\x49\x01\x85\xa4\xf0\x2b\x86"
+"\xd7\xa5\xb4\xf0\x22\xad\xa3\x02\x29\x01\xd0\x05\xad\xa4\x02\xd0\x16\xa9\x00\x85\xa4\x8d\xa4\x02\xa5\xa3\x10\x30\x30\xbf\xa2\xa6"
+"\x20\xe2\xf8\xa5\x9b\xd0\xb9\x4c\xbc\xfe\xa5\x92\xf0\x07\x30\x03\xc6\xb0\x2c\xe6\xb0\xa9\x00\x85\x92\xe4\xd7\xd0\x0f\x8a\xd0\xa0"
+"\xa5\xa9\x30\xbd\xc9\x10\x90\xb9\x85\x96\xb0\xb5\x8a\x45\x9b\x85\x9b\xa5\xb4\xf0\xd2\xc6\xa3\x30\xc5\x46\xd7\x66\xbf\xa2\xda\x20"
+"\xe2\xf8\x3b\x00\xf0\x2e\x96\xf0\x04\xa5\xb4\xf0\x07\xa5\xa3\x30\x03\x4c\x97\xf9\x46\xb1\xa9\x93\x38\xe5\xb1\x65\xb0\x0a\xaa\x20"
+"\xe2\xf8\xe6\x9c\xa5\xb4\xd0\x11\xa5\x96\xf0\x26\x85\xa8\xa9\x00\x85\x96\xa9\x81\x8d\x0d\xdc\x85\xb4\xa5\x96\x85\xb5\xf0\x09\xa9"
+"\x00\x85\xb4\x15\x0b\xf1\x04\xdc\xa5\xbf\x85\xbd\xa5\xa8\x05\xa9\x85\xb6\x4c\xbc\xfe\x20\x97\xfb\x85\x9c\x5d\x00\xf1\x0b\xa5\xbe"
+"\xf0\x02\x85\xa7\xa9\x0f\x24\xaa\x10\x17\xa5\xb5\xd0\x0c\xa6\xbe\xca\xd0\x0b\xa9\x08\x20\x1c\xfe\x36\x12\xf1\x44\xaa\x4c\xbc\xfe"
+"\x70\x31\xd0\x18\xa5\xb5\xd0\xf5\xa5\xb6\xd0\xf1\xa5\xa7\x4a\xa5\xbd\x30\x03\x90\x18\x18\xb0\x15\x29\x0f\x85\xaa\xc6\xaa\xd0\xdd"
+"\xa9\x40\x85\xaa\x20\x8e\xfb\xa9\x00\x85\xab\xf0\xd0\xa9\x80\x85\xaa\xd0\xca\xa5\xb5\xf0\x0a\xa9\x04\x20\x1c\xfe\xa9\x00\x4c\x4a"
+"\xfb\x20\xd1\xfc\x90\x03\x4c\x48\xfb\xa6\xa7\xca\xf0\x2d\xa5\xcf\x05\xf0\x3e\xa5\xbd\xd1\xac\xf0\x04\xa9\x01\x85\xb6\xa5\xb6\xf0"
+"\x4b\xa2\x3d\xe4\x9e\x90\x3e\xa6\x9e\xa5\xad\x9d\x01\x01\xa5\xac\x9d\x00\x01\xe8\xe8\x86\x9e\x4c\x3a\xfb\xa6\x9f\xe4\x9e\xf0\x35"
+"\xa5\xac\xdd\x00\x01\xd0\x2e\xa5\xad\xdd\x01\x01\xd0\x27\xe6\x9f\xe6\x9f\xa5\x93\xf0\x0b\xa5\xbd\xa0\x00\xd1\xac\xf0\x17\xc8\x84"
+"\x44\x00\x11\x07\x1d\x06\xb0\xd0\x09\xa5\x93\xd0\x05\xa8\xa5\xbd\x91\xac\x09\x05\x10\x43\x8e\x00\xf0\x19\x78\xa2\x01\x8e\x0d\xdc"
+"\xae\x0d\xdc\xa6\xbe\xca\x30\x02\x86\xbe\xc6\xa7\xf0\x08\xa5\x9e\xd0\x27\x85\xbe\xf0\x23\x20\x93\xfc\x20\x8e\xfb\xa0\x00\x84\xab"
+"\xb1\xac\x0f\x0c\x30\x20\xdb\xfc\xad\x00\xc0\xf2\xa5\xab\x45\xbd\xf0\x05\xa9\x20\x20\x1c\xfe\x7e\x01\xc0\xc2\x85\xad\xa5\xc1\x85"
+"\xac\x60\xa9\x08\x85\xa3\xdf\x01\xf0\x08\x85\xa8\x85\x9b\x85\xa9\x60\xa5\xbd\x4a\xa9\x60\x90\x02\xa9\xb0\xa2\x00\x8d\x06\xdc\x8e"
+"\x07\x18\x0e\x01\x23\x0e\xf3\x27\xa5\x01\x49\x08\x85\x01\x29\x08\x60\x38\x66\xb6\x30\x3c\xa5\xa8\xd0\x12\xa9\x10\xa2\x01\x20\xb1"
+"\xfb\xd0\x2f\xe6\xa8\xa5\xb6\x10\x29\x4c\x57\xfc\xa5\xa9\xd0\x09\x20\xad\xfb\xd0\x1d\xe6\xa9\xd0\x19\x20\xa6\xfb\xd0\x14\x53\x02"
+"\x90\x0f\xa5\xbd\x49\x01\x85\xbd\x29\x01\x0d\x02\xf0\x18\x4c\xbc\xfe\x46\xbd\xc6\xa3\xa5\xa3\xf0\x3a\x10\xf3\x20\x97\xfb\x58\xa5"
+"\xa5\xf0\x12\xa2\x00\x86\xd7\xc6\xa5\xa6\xbe\xe0\x02\xd0\x02\x09\x80\x85\xbd\xd0\xd9\xb5\x00\xf0\x06\x0a\xd0\x91\xe6\xad\xa5\xd7"
+"\x85\xbd\xb0\xca\xa0\x00\xb1\xac\x85\xbd\x45\xd7\x85\xd7\x06\x01\x30\xbb\xa5\x9b\x51\x00\xf0\x3a\x4c\xbc\xfe\xc6\xbe\xd0\x03\x20"
+"\xca\xfc\xa9\x50\x85\xa7\xa2\x08\x78\x20\xbd\xfc\xd0\xea\xa9\x78\x20\xaf\xfb\xd0\xe3\xc6\xa7\xd0\xdf\x20\x97\xfb\xc6\xab\x10\xd8"
+"\xa2\x0a\x20\xbd\xfc\x58\xe6\xab\xa5\xbe\xf0\x30\x20\x8e\xfb\xa2\x09\x86\xa5\x86\xb6\xd0\x83\x08\x78\xad\x11\xd0\x09\x10\x8d\x11"
+"\xd0\x42\x00\xf0\x1a\x7f\x8d\x0d\xdc\x20\xdd\xfd\xad\xa0\x02\xf0\x09\x8d\x15\x03\xad\x9f\x02\x8d\x14\x03\x28\x60\x20\x93\xfc\xf0"
+"\x97\xbd\x93\xfd\x8d\x14\x03\xbd\x94\xfd\x8d\x15\x03\x60\x5f\x12\xf0\x3d\x85\x01\x60\x38\xa5\xac\xe5\xae\xa5\xad\xe5\xaf\x60\xe6"
+"\xac\xd0\x02\xe6\xad\x60\xa2\xff\x78\x9a\xd8\x20\x02\xfd\xd0\x03\x6c\x00\x80\x8e\x16\xd0\x20\xa3\xfd\x20\x50\xfd\x20\x15\xfd\x20"
+"\x5b\xff\x58\x6c\x00\xa0\xa2\x05\xbd\x0f\xfd\xdd\x03\x80\xd0\x03\xca\xd0\xf5\x60\xc3\xc2\xcd\x38\x30\xa2\x30\xa0\xfd\x18\x7c\x08"
+"\xf1\x4d\xa0\x1f\xb9\x14\x03\xb0\x02\xb1\xc3\x91\xc3\x99\x14\x03\x88\x10\xf1\x60\x31\xea\x66\xfe\x47\xfe\x4a\xf3\x91\xf2\x0e\xf2"
+"\x50\xf2\x33\xf3\x57\xf1\xca\xf1\xed\xf6\x3e\xf1\x2f\xf3\x66\xfe\xa5\xf4\xed\xf5\xa9\x00\xa8\x99\x02\x00\x99\x00\x02\x99\x00\x03"
+"\xc8\xd0\xf4\xa2\x3c\xa0\x03\x86\xb2\x84\xb3\xa8\xa9\x03\x85\xc2\xe6\xc2\xb1\xc1\xaa\xa9\x55\x91\xc1\xd1\xc1\xd0\x0f\x2a\x07\x00"
+"\xf0\x06\x08\x8a\x91\xc1\xc8\xd0\xe8\xf0\xe4\x98\xaa\xa4\xc2\x18\x20\x2d\xfe\xa9\x08\x8d\x82\x5c\x18\xb0\x88\x02\x60\x6a\xfc\xcd"
+"\xfb\x31\xea\x2c\xf9\x20\x09\x90\xdc\x8d\x0d\xdd\x8d\x00\xdc\xa9\x08\x9c\x04\xf0\x2b\x0e\xdd\x8d\x0f\xdc\x8d\x0f\xdd\xa2\x00\x8e"
+"\x03\xdc\x8e\x03\xdd\x8e\x18\xd4\xca\x8e\x02\xdc\xa9\x07\x8d\x00\xdd\xa9\x3f\x8d\x02\xdd\xa9\xe7\x85\x01\xa9\x2f\x85\x00\xad\xa6"
+"\x02\xf0\x0a\xa9\x25\x8d\x04\xdc\xa9\x40\x4c\xf3\xfd\xa9\x95\x0a\x00\xf1\x31\x42\x8d\x05\xdc\x4c\x6e\xff\x85\xb7\x86\xbb\x84\xbc"
+"\x60\x85\xb8\x86\xba\x84\xb9\x60\xa5\xba\xc9\x02\xd0\x0d\xad\x97\x02\x48\xa9\x00\x8d\x97\x02\x68\x60\x85\x9d\xa5\x90\x05\x90\x85"
+"\x90\x60\x8d\x85\x02\x60\x90\x06\xae\x83\x02\xac\x84\x02\x8e\x83\x02\x8c\x84\x0f\x00\xf0\x02\x81\x02\xac\x82\x02\x8e\x81\x02\x8c"
+"\x82\x02\x60\x78\x6c\x18\x03\x48\x69\x0c\x00\xa9\x00\x62\xdd\xac\x0d\xdd\x30\x1c\x6f\x01\x50\x02\x80\x20\xbc\xf6\x33\x08\x10\x0c"
+"\x6e\x01\xf0\x02\xa3\xfd\x20\x18\xe5\x6c\x02\xa0\x98\x2d\xa1\x02\xaa\x29\x01\xf0\x28\xf6\x0f\x71\xfb\x05\xb5\x8d\x00\xdd\xad\x42"
+"\x0f\x50\x8a\x29\x12\xf0\x0d\x0d\x08\xf4\x01\x20\xd6\xfe\x4c\x9d\xfe\x20\x07\xff\x20\xbb\xee\x4c\xb6\xfe\x8a\x14\x00\x00\x0b\x00"
+"\x62\x10\xf0\x03\x20\x07\xff\x31\x00\x00\xbf\x0c\xf0\x07\x68\x40\xc1\x27\x3e\x1a\xc5\x11\x74\x0e\xed\x0c\x45\x06\xf0\x02\x46\x01"
+"\xb8\x00\x71\x00\x66\x0e\xf3\x0c\x01\x85\xa7\xad\x06\xdd\xe9\x1c\x6d\x99\x02\x8d\x06\xdd\xad\x07\xdd\x6d\x9a\x02\x8d\x07\xdd\xa9"
+"\x11\x8d\x0f\x71\x00\xd1\xa9\xff\x8d\x06\xdd\x8d\x07\xdd\x4c\x59\xef\xad\x95\x25\x00\x15\x96\x22\x00\x31\xa9\x12\x4d\x97\x0f\x04"
+"\x24\x00\x00\x0f\x10\xf1\x0d\xa8\x60\xaa\xad\x96\x02\x2a\xa8\x8a\x69\xc8\x8d\x99\x02\x98\x69\x00\x8d\x9a\x02\x60\xea\xea\x08\x68"
+"\x29\xef\x48\x01\x01\x30\xba\xbd\x04\xee\x14\xf1\x0b\x03\x6c\x16\x03\x6c\x14\x03\x20\x18\xe5\xad\x12\xd0\xd0\xfb\xad\x19\xd0\x29"
+"\x01\x8d\xa6\x02\x4c\xdd\xfd\x31\x05\xf0\x7e\xad\x0e\xdc\x29\x80\x09\x11\x8d\x0e\xdc\x4c\x8e\xee\x03\x4c\x5b\xff\x4c\xa3\xfd\x4c"
+"\x50\xfd\x4c\x15\xfd\x4c\x1a\xfd\x4c\x18\xfe\x4c\xb9\xed\x4c\xc7\xed\x4c\x25\xfe\x4c\x34\xfe\x4c\x87\xea\x4c\x21\xfe\x4c\x13\xee"
+"\x4c\xdd\xed\x4c\xef\xed\x4c\xfe\xed\x4c\x0c\xed\x4c\x09\xed\x4c\x07\xfe\x4c\x00\xfe\x4c\xf9\xfd\x6c\x1a\x03\x6c\x1c\x03\x6c\x1e"
+"\x03\x6c\x20\x03\x6c\x22\x03\x6c\x24\x03\x6c\x26\x03\x4c\x9e\xf4\x4c\xdd\xf5\x4c\xe4\xf6\x4c\xdd\xf6\x6c\x28\x03\x6c\x2a\x03\x6c"
+"\x2c\x03\x4c\x9b\xf6\x4c\x05\xe5\x4c\x0a\xe5\x4c\x00\xe5\x52\x52\x42\x59\x43\xfe\xe2\xfc\x48\xff"
+;
+unsigned char dump_c64_kernalv3[8192];
+#include <string.h>
+static void _c64_dump_init_lz4(const unsigned char* src, int src_size, unsigned char* dst) {
+    const unsigned char* end = src + src_size;
+    while (src < end) {
+        const unsigned char token = *src++;
+        int len = token >> 4;
+        if (len == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }
+        memcpy(dst, src, len); dst += len; src += len;
+        if (src >= end) { break; }
+        const unsigned char* m = dst - (src[0] | (src[1]<<8)); src += 2;
+        len = (token & 15) + 4;
+        if ((token & 15) == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }
+        while (len-- > 0) { *dst++ = *m++; }
+    }
+}
+static void c64_dump_init(void) {
+    _c64_dump_init_lz4(dump_c64_basic_lz4, sizeof(dump_c64_basic_lz4) - 1, dump_c64_basic);
+    _c64_dump_init_lz4(dump_c64_char_lz4, sizeof(dump_c64_char_lz4) - 1, dump_c64_char);
+    _c64_dump_init_lz4(dump_c64_kernalv3_lz4, sizeof(dump_c64_kernalv3_lz4) - 1, dump_c64_kernalv3);
+}
+#if defined(_MSC_VER)
+#pragma section(".CRT$XCU", read)
+__declspec(allocate(".CRT$XCU")) void (*_c64_dump_init_ctor)(void) = c64_dump_init;
+#else
+__attribute__((constructor)) static void _c64_dump_init_ctor(void) { c64_dump_init(); }
+#endif
+dump_item c64_dump_items[C64_DUMP_NUM_ITEMS] = {
 { "c64_basic", dump_c64_basic, 8192 },
+{ "c64_char", dump_c64_char, 4096 },
 { "c64_kernalv3", dump_c64_kernalv3, 8192 },
 };
@@ -1,10 +1,13 @@
 #pragma once
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include <stdint.h>
 extern unsigned char dump_c64_basic[8192];
 extern unsigned char dump_c64_char[4096];
 extern unsigned char dump_c64_kernalv3[8192];
+#ifndef DUMP_ITEM_DEFINED
+#define DUMP_ITEM_DEFINED
 typedef struct { const char* name; const uint8_t* ptr; int size; } dump_item;
-#define DUMP_NUM_ITEMS (3)
-extern dump_item dump_items[DUMP_NUM_ITEMS];
+#endif
+#define C64_DUMP_NUM_ITEMS (3)
+extern dump_item c64_dump_items[C64_DUMP_NUM_ITEMS];
@@ -1,3089 +1,1431 @@
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include "cpc-roms.h"
-unsigned char dump_cpc6128_basic[16384] = {
-0x80, 0x1, 0x2, 0x0, 0x40, 0xc0, 0x31, 0x0, 0xc0, 0xcd, 0xcb, 0xbc, 0xcd, 0x3f, 0xf5, 0xda, 
-0x0, 0x0, 0xaf, 0x32, 0x0, 0xac, 0x21, 0x33, 0xc0, 0xcd, 0x7d, 0xc3, 0xcd, 0xaa, 0xde, 0xcd, 
-0x37, 0xcb, 0xcd, 0xbb, 0xbd, 0xcd, 0xde, 0xc0, 0xcd, 0x45, 0xc1, 0x11, 0xf0, 0x0, 0xcd, 0xe9, 
-0xf7, 0x18, 0x25, 0x20, 0x42, 0x41, 0x53, 0x49, 0x43, 0x20, 0x31, 0x2e, 0x31, 0xa, 0xa, 0x0, 
-0x42, 0x41, 0x53, 0x49, 0xc3, 0x0, 0xcd, 0x48, 0xcf, 0xc0, 0x31, 0x0, 0xc0, 0xcd, 0x5c, 0xe8, 
-0xcd, 0x54, 0xe2, 0xcd, 0x1, 0xcb, 0x38, 0x5f, 0x31, 0x0, 0xc0, 0xcd, 0x66, 0xc1, 0xcd, 0xb5, 
-0xde, 0xdc, 0xb6, 0xbc, 0xcd, 0xd0, 0xc4, 0xcd, 0xd0, 0xc3, 0x3a, 0x2c, 0xae, 0xb7, 0xc4, 0x45, 
-0xc1, 0x3a, 0x90, 0xad, 0xd6, 0x2, 0x20, 0x9, 0x32, 0x90, 0xad, 0xcd, 0xaa, 0xcb, 0xeb, 0x38, 
-0xc9, 0x21, 0xd7, 0xc0, 0xcd, 0x8b, 0xc3, 0xcd, 0xaa, 0xde, 0x3a, 0x1, 0xac, 0xb7, 0x28, 0x1f, 
-0xcd, 0xd, 0xc1, 0x30, 0xc3, 0xcd, 0x4d, 0xde, 0xcd, 0xcf, 0xee, 0x30, 0xa, 0xcd, 0x4d, 0xde, 
-0xb7, 0x37, 0xcc, 0x64, 0xe8, 0x30, 0xe3, 0xd4, 0xde, 0xc0, 0x21, 0x8a, 0xac, 0x18, 0x8, 0xcd, 
-0xf9, 0xca, 0x30, 0xfb, 0xcd, 0x98, 0xc3, 0xcd, 0x4d, 0xde, 0xb7, 0x28, 0xca, 0xcd, 0xcf, 0xee, 
-0x30, 0xb, 0xcd, 0x4d, 0xfb, 0xcd, 0xa5, 0xe7, 0xcd, 0x8f, 0xc1, 0x18, 0xba, 0xcd, 0xa4, 0xdf, 
-0xcd, 0xd3, 0xc4, 0x2b, 0xc3, 0x60, 0xde, 0x52, 0x65, 0x61, 0x64, 0x79, 0xa, 0x0, 0xaf, 0x18, 
-0x5, 0x22, 0x2, 0xac, 0x3e, 0xff, 0x32, 0x1, 0xac, 0xc9, 0x11, 0xa, 0x0, 0x28, 0x2, 0xfe, 
-0x2c, 0xc4, 0x48, 0xcf, 0xd5, 0x11, 0xa, 0x0, 0xcd, 0x41, 0xde, 0xdc, 0x48, 0xcf, 0xcd, 0x37, 
-0xde, 0xeb, 0x22, 0x4, 0xac, 0xe1, 0xcd, 0xe1, 0xc0, 0xc1, 0xc3, 0x87, 0xc0, 0x2a, 0x2, 0xac, 
-0xeb, 0xd5, 0xcd, 0x38, 0xe2, 0xcd, 0xde, 0xc0, 0xcd, 0x1, 0xcb, 0xd1, 0xd0, 0xe5, 0x2a, 0x4, 
-0xac, 0x19, 0xd4, 0xe1, 0xc0, 0xe1, 0x37, 0xc9, 0xc0, 0xcd, 0x45, 0xc1, 0xc3, 0x58, 0xc0, 0xfe, 
-0xa3, 0x28, 0xc, 0xe5, 0xcd, 0x78, 0xc1, 0xcd, 0x5f, 0xc1, 0xcd, 0x8f, 0xc1, 0xe1, 0xc9, 0xcd, 
-0x2c, 0xde, 0xc3, 0x3d, 0xbd, 0x2a, 0x62, 0xae, 0xeb, 0x2a, 0x5e, 0xae, 0xcd, 0xe4, 0xff, 0x62, 
-0x6b, 0x13, 0xaf, 0x77, 0xed, 0xb0, 0x32, 0x2c, 0xae, 0xcd, 0xea, 0xd5, 0xcd, 0x6f, 0xc1, 0xcd, 
-0x0, 0xd3, 0xaf, 0xcd, 0x97, 0xbd, 0xcd, 0xcc, 0xfb, 0xcd, 0x20, 0xda, 0xc3, 0xa1, 0xc1, 0xcd, 
-0xc5, 0xde, 0xcd, 0xde, 0xc0, 0xcd, 0x89, 0xc1, 0xc5, 0xe5, 0xcd, 0x8c, 0xf6, 0xcd, 0xea, 0xd5, 
-0xcd, 0x38, 0xd6, 0xcd, 0x4d, 0xea, 0xe1, 0xc1, 0xc9, 0xcd, 0x99, 0xf2, 0xcd, 0x61, 0xe7, 0xcd, 
-0xac, 0xcc, 0xcd, 0x7e, 0xcc, 0xcd, 0xa3, 0xc9, 0xcd, 0x4f, 0xf6, 0xcd, 0xe, 0xd6, 0xc3, 0xd4, 
-0xdc, 0xaf, 0xcd, 0xb3, 0xc1, 0xaf, 0xe5, 0xf5, 0xfe, 0x8, 0xdc, 0xb4, 0xbb, 0xf1, 0x21, 0x6, 
-0xac, 0x18, 0x4, 0xe5, 0x21, 0x7, 0xac, 0xd5, 0x5f, 0x7e, 0x73, 0xd1, 0xe1, 0xc9, 0x3a, 0x6, 
-0xac, 0xfe, 0x8, 0xc9, 0x3a, 0x7, 0xac, 0xfe, 0x9, 0xc9, 0xcd, 0xfb, 0xc1, 0x18, 0xd7, 0xcd, 
-0xfb, 0xc1, 0x18, 0x18, 0xcd, 0xfb, 0xc1, 0xcd, 0xb3, 0xc1, 0xc1, 0xf5, 0xcd, 0xc4, 0xc1, 0xcd, 
-0xed, 0xc1, 0xf1, 0x18, 0xce, 0xcd, 0xfb, 0xc1, 0xfe, 0x8, 0x30, 0x31, 0xc1, 0xcd, 0xa6, 0xc1, 
-0xf5, 0x7e, 0xfe, 0x2c, 0xcd, 0xfc, 0xff, 0xf1, 0xc3, 0xa6, 0xc1, 0x7e, 0xfe, 0x23, 0x3e, 0x0, 
-0xc0, 0xcd, 0xd, 0xc2, 0xf5, 0xcd, 0x41, 0xde, 0xd4, 0x37, 0xde, 0xf1, 0xc9, 0xcd, 0x25, 0xde, 
-0x23, 0x3e, 0xa, 0xc5, 0xd5, 0x47, 0xcd, 0xb8, 0xce, 0xb8, 0xd1, 0xc1, 0xd8, 0xc3, 0x4d, 0xcb, 
-0x3e, 0x2, 0x18, 0xef, 0xcd, 0xe5, 0xc1, 0x1, 0x90, 0xbb, 0xc4, 0x3f, 0xc2, 0xcd, 0x41, 0xde, 
-0xd0, 0xcd, 0x20, 0xc2, 0x1, 0x9f, 0xbb, 0x18, 0x9, 0xcd, 0xe5, 0xc1, 0x1, 0x96, 0xbb, 0xcd, 
-0x71, 0xc2, 0xe5, 0xcd, 0xfc, 0xff, 0xe1, 0xc9, 0xcd, 0x62, 0xc2, 0xe5, 0xcd, 0x38, 0xbc, 0xe1, 
-0xc9, 0xcd, 0x71, 0xc2, 0xf5, 0xcd, 0x15, 0xde, 0xcd, 0x62, 0xc2, 0xf1, 0xe5, 0xcd, 0x32, 0xbc, 
-0xe1, 0xc9, 0xcd, 0x6a, 0xc2, 0x41, 0xcd, 0x41, 0xde, 0xd0, 0x3e, 0x20, 0xcd, 0x13, 0xc2, 0x4f, 
-0xc9, 0x3e, 0x10, 0x18, 0x9e, 0x3e, 0x3, 0xcd, 0x13, 0xc2, 0xe5, 0xcd, 0xe, 0xbc, 0xe1, 0xc9, 
-0xcd, 0xe5, 0xc1, 0xe5, 0xcd, 0x6c, 0xbb, 0xe1, 0xc9, 0xcd, 0xd, 0xc2, 0xfe, 0x8, 0x30, 0x8d, 
-0xf5, 0xcd, 0x1d, 0xde, 0xf1, 0xc3, 0xec, 0xc1, 0xcd, 0x89, 0xc2, 0xcd, 0x60, 0xbb, 0xc3, 0x78, 
-0xfa, 0xcd, 0x89, 0xc2, 0xe5, 0xcd, 0xc7, 0xc2, 0x18, 0xa, 0xcd, 0xd, 0xc2, 0xcd, 0x90, 0xc2, 
-0xe5, 0xcd, 0xb9, 0xc2, 0xcd, 0x32, 0xff, 0xe1, 0xc9, 0xcd, 0xbe, 0xc1, 0x3a, 0x8, 0xac, 0xc8, 
-0x3a, 0xa, 0xac, 0xd0, 0xc3, 0xec, 0xc3, 0xcd, 0x78, 0xbb, 0xcd, 0x87, 0xbb, 0x7d, 0xc9, 0xcd, 
-0xbe, 0xc1, 0x28, 0xd, 0xd0, 0xd5, 0xe5, 0xcd, 0x69, 0xbb, 0x7a, 0x94, 0x3c, 0xe1, 0xd1, 0x37, 
-0xc9, 0x3a, 0x9, 0xac, 0xfe, 0xff, 0xc9, 0xe5, 0x67, 0xcd, 0xcf, 0xc2, 0x3f, 0x38, 0xe, 0x6f, 
-0xcd, 0xb9, 0xc2, 0x3d, 0x37, 0x28, 0x6, 0x84, 0x3f, 0x30, 0x2, 0x3d, 0xbd, 0xe1, 0xc9, 0xcd, 
-0xe5, 0xc1, 0xcd, 0x51, 0xc3, 0xe5, 0xeb, 0x24, 0x2c, 0xcd, 0x75, 0xbb, 0xe1, 0xc9, 0xfe, 0xe7, 
-0x28, 0x16, 0xcd, 0xe5, 0xc1, 0xcd, 0x51, 0xc3, 0xd5, 0xcd, 0x15, 0xde, 0xcd, 0x51, 0xc3, 0xe3, 
-0x7a, 0x55, 0x6f, 0xcd, 0x66, 0xbb, 0xe1, 0xc9, 0xcd, 0x2c, 0xde, 0xcd, 0x3e, 0xc3, 0x4f, 0xcd, 
-0x41, 0xde, 0x3e, 0x0, 0xdc, 0x3e, 0xc3, 0x47, 0xe5, 0xcd, 0xb7, 0xbb, 0xe1, 0xc9, 0x3e, 0x8, 
-0xc3, 0x13, 0xc2, 0xcd, 0xe5, 0xc1, 0x3e, 0xff, 0x18, 0x4, 0xcd, 0xe5, 0xc1, 0xaf, 0xc3, 0x63, 
-0xbb, 0xcd, 0x58, 0xc3, 0x53, 0xcd, 0x15, 0xde, 0xd5, 0xcd, 0xc3, 0xce, 0xd1, 0x5f, 0x1d, 0xc9, 
-0xcd, 0xe5, 0xc1, 0x28, 0xa, 0xcd, 0x20, 0xc2, 0xb7, 0xcc, 0x84, 0xbb, 0xc4, 0x81, 0xbb, 0xcd, 
-0x41, 0xde, 0xd0, 0xcd, 0x20, 0xc2, 0xb7, 0xca, 0x7e, 0xbb, 0xc3, 0x7b, 0xbb, 0xe5, 0x21, 0x1, 
-0x84, 0x22, 0x8, 0xac, 0xcd, 0x69, 0xc4, 0xcd, 0xa1, 0xc1, 0xe1, 0xf5, 0xe5, 0x7e, 0x23, 0xb7, 
-0xc4, 0xa0, 0xc3, 0x20, 0xf8, 0xe1, 0xf1, 0xc9, 0xf5, 0x3e, 0xa, 0xcd, 0xa0, 0xc3, 0xf1, 0xc9, 
-0xf5, 0xc5, 0xcd, 0xa8, 0xc3, 0xc1, 0xf1, 0xc9, 0xfe, 0xa, 0x20, 0xc, 0xcd, 0xbe, 0xc1, 0xca, 
-0xf5, 0xc3, 0xd2, 0x31, 0xc4, 0xc3, 0xe2, 0xc3, 0xf5, 0xc5, 0x4f, 0xcd, 0xc1, 0xc3, 0xc1, 0xf1, 
-0xc9, 0x3a, 0x6, 0xac, 0xfe, 0x8, 0xca, 0xfc, 0xc3, 0xd2, 0x38, 0xc4, 0x79, 0xc3, 0xe9, 0xc3, 
-0xaf, 0xcd, 0x63, 0xbb, 0xaf, 0xe5, 0xcd, 0x9f, 0xbb, 0xe1, 0xcd, 0x54, 0xbb, 0xcd, 0xec, 0xc3, 
-0x3d, 0xc8, 0x3e, 0xd, 0xcd, 0xe9, 0xc3, 0x3e, 0xa, 0xc3, 0x5a, 0xbb, 0xc5, 0xe5, 0xcd, 0xc7, 
-0xc2, 0x7c, 0xe1, 0xc1, 0xc9, 0xe, 0xd, 0xcd, 0xfc, 0xc3, 0xe, 0xa, 0xe5, 0x2a, 0x8, 0xac, 
-0xcd, 0x11, 0xc4, 0x32, 0x8, 0xac, 0xe1, 0x79, 0xcd, 0x2b, 0xbd, 0xd8, 0xcd, 0x72, 0xc4, 0x18, 
-0xf6, 0x79, 0xee, 0xd, 0x28, 0x10, 0x79, 0xfe, 0x20, 0x7d, 0xd8, 0x24, 0x28, 0x8, 0xbc, 0x20, 
-0x5, 0xcd, 0x98, 0xc3, 0x3e, 0x1, 0x3c, 0xc0, 0x3d, 0xc9, 0xcd, 0xc3, 0xce, 0x32, 0x9, 0xac, 
-0xc9, 0xe, 0xd, 0xcd, 0x38, 0xc4, 0xe, 0xa, 0xe5, 0x2a, 0xa, 0xac, 0x26, 0xff, 0xcd, 0x11, 
-0xc4, 0x32, 0xa, 0xac, 0xe1, 0x79, 0xcd, 0x95, 0xbc, 0xd8, 0x20, 0x19, 0xc3, 0x37, 0xcc, 0xe5, 
-0xcd, 0x89, 0xbc, 0x28, 0xf7, 0x3f, 0x9f, 0xcd, 0x2d, 0xff, 0xe1, 0xc9, 0xcd, 0x80, 0xbc, 0xd8, 
-0x28, 0xea, 0xee, 0xe, 0xc0, 0xcd, 0x45, 0xcb, 0x1f, 0x3e, 0x1, 0x32, 0xa, 0xac, 0xc9, 0xc3, 
-0x9, 0xbb, 0xcd, 0x9, 0xbb, 0xd0, 0xfe, 0xfc, 0xc0, 0xcd, 0xa1, 0xc4, 0xda, 0x3e, 0xcc, 0xe5, 
-0xc5, 0xd5, 0x11, 0x92, 0xc4, 0xe, 0xfd, 0x3a, 0xb, 0xac, 0xb7, 0xc4, 0x45, 0xbb, 0xd1, 0xc1, 
-0xe1, 0xc9, 0xcd, 0x9, 0xbb, 0x30, 0x4, 0xfe, 0xef, 0x20, 0xf7, 0xcd, 0xa1, 0xc4, 0xc3, 0xf2, 
-0xc8, 0xc5, 0xd5, 0xe5, 0xcd, 0xb6, 0xbc, 0xf5, 0xcd, 0x40, 0xbd, 0x47, 0xcd, 0x81, 0xbb, 0xcd, 
-0x6, 0xbb, 0xfe, 0xef, 0x28, 0xf9, 0xcb, 0x48, 0xc4, 0x84, 0xbb, 0xfe, 0xfc, 0x37, 0x28, 0xb, 
-0xfe, 0x20, 0xc4, 0xc, 0xbb, 0xf1, 0xf5, 0xdc, 0xb9, 0xbc, 0xb7, 0xe1, 0xe1, 0xd1, 0xc1, 0xc9, 
-0xaf, 0x18, 0x2, 0x3e, 0xff, 0x32, 0xb, 0xac, 0xe5, 0xcd, 0x48, 0xbb, 0x18, 0xa2, 0xcd, 0x8c, 
-0xc5, 0xc5, 0xd5, 0xcd, 0x41, 0xde, 0x30, 0x17, 0xcd, 0x8c, 0xc5, 0xc5, 0xd5, 0xcd, 0x15, 0xde, 
-0xcd, 0x8c, 0xc5, 0xc5, 0xe3, 0xcd, 0xd2, 0xbb, 0xe1, 0xd1, 0xe3, 0xcd, 0xcf, 0xbb, 0xe1, 0xd1, 
-0xe3, 0xcd, 0xc9, 0xbb, 0xe1, 0xc9, 0xcd, 0x3d, 0xde, 0xd4, 0xb4, 0xc5, 0xe5, 0xcd, 0xdb, 0xbb, 
-0xe1, 0xc9, 0xcd, 0x71, 0xc2, 0xe5, 0xf5, 0xcd, 0x64, 0xfc, 0xcd, 0xfc, 0xf6, 0x1, 0x1d, 0x0, 
-0xcd, 0xde, 0xff, 0x3e, 0x7, 0xda, 0x55, 0xcb, 0xeb, 0xf1, 0xcd, 0x52, 0xbd, 0xe1, 0xc9, 0x1, 
-0xc0, 0xbb, 0x18, 0x17, 0x1, 0xc3, 0xbb, 0x18, 0x12, 0x1, 0xf6, 0xbb, 0x18, 0xd, 0x1, 0xf9, 
-0xbb, 0x18, 0x8, 0x1, 0xea, 0xbb, 0x18, 0x3, 0x1, 0xed, 0xbb, 0xc5, 0xcd, 0x8c, 0xc5, 0xcd, 
-0x41, 0xde, 0x30, 0x5, 0xfe, 0x2c, 0xc4, 0xba, 0xc5, 0xcd, 0x41, 0xde, 0x30, 0xa, 0x3e, 0x4, 
-0xcd, 0x13, 0xc2, 0xe5, 0xcd, 0x59, 0xbc, 0xe1, 0xe3, 0xc5, 0xe3, 0xc1, 0xcd, 0xfc, 0xff, 0xe1, 
-0xc9, 0x1, 0xf0, 0xbb, 0x18, 0x3, 0x1, 0xf3, 0xbb, 0xc5, 0xcd, 0x8c, 0xc5, 0xcd, 0x1d, 0xde, 
-0xe3, 0xc5, 0xe3, 0xc1, 0xcd, 0xfc, 0xff, 0xcd, 0x32, 0xff, 0xe1, 0xc9, 0xcd, 0xd8, 0xce, 0xd5, 
-0xcd, 0x15, 0xde, 0xcd, 0xd8, 0xce, 0x42, 0x4b, 0xd1, 0xc9, 0xfe, 0xba, 0x28, 0x13, 0xcd, 0x25, 
-0xde, 0xbb, 0xfe, 0x2c, 0xc4, 0xba, 0xc5, 0xcd, 0x41, 0xde, 0xd0, 0xcd, 0x20, 0xc2, 0xc3, 0x46, 
-0xbd, 0xcd, 0x2c, 0xde, 0xcd, 0x71, 0xc2, 0xc3, 0xe4, 0xbb, 0xcd, 0x71, 0xc2, 0xc3, 0xde, 0xbb, 
-0xfe, 0x2c, 0x28, 0x6, 0xcd, 0xb8, 0xce, 0xcd, 0x4c, 0xbd, 0xcd, 0x41, 0xde, 0xd0, 0xcd, 0x20, 
-0xc2, 0xc3, 0x49, 0xbd, 0xcd, 0xec, 0xd6, 0xe5, 0xc5, 0xd5, 0xcd, 0x76, 0xca, 0x22, 0x12, 0xac, 
-0xd5, 0xe5, 0xeb, 0xcd, 0xd9, 0xc6, 0xcc, 0x5d, 0xf6, 0xe1, 0xcd, 0x3d, 0xde, 0x11, 0x0, 0x0, 
-0xd4, 0xbf, 0xd6, 0x44, 0x4d, 0xe1, 0xe3, 0x7a, 0xb3, 0xc4, 0xd8, 0xff, 0xc2, 0x9e, 0xc6, 0xeb, 
-0xcd, 0xb1, 0xde, 0xe3, 0xcd, 0xad, 0xde, 0xe1, 0xf1, 0xe3, 0xd5, 0xc5, 0xe5, 0x1, 0x5, 0x16, 
-0xb9, 0x28, 0x9, 0x1, 0x2, 0x10, 0xb9, 0x3e, 0xd, 0xc2, 0x55, 0xcb, 0x78, 0xcd, 0x72, 0xf6, 
-0x73, 0x23, 0x72, 0x23, 0xe3, 0xcd, 0x21, 0xde, 0xcd, 0x62, 0xcf, 0x79, 0xcd, 0xff, 0xfe, 0xe5, 
-0x21, 0xd, 0xac, 0xcd, 0x83, 0xff, 0xe1, 0xcd, 0x25, 0xde, 0xec, 0xcd, 0x62, 0xcf, 0xe3, 0x79, 
-0xcd, 0xff, 0xfe, 0xcd, 0x83, 0xff, 0xeb, 0xe3, 0xeb, 0x21, 0x1, 0x0, 0xcd, 0x35, 0xff, 0xeb, 
-0x7e, 0xfe, 0xe6, 0x20, 0x6, 0xcd, 0x2c, 0xde, 0xcd, 0x62, 0xcf, 0x79, 0xcd, 0xff, 0xfe, 0xe3, 
-0xcd, 0x83, 0xff, 0xcd, 0xc4, 0xfd, 0xeb, 0x77, 0x23, 0xeb, 0xe1, 0xcd, 0x37, 0xde, 0xeb, 0x73, 
-0x23, 0x72, 0x23, 0xeb, 0xcd, 0xb1, 0xde, 0xeb, 0x73, 0x23, 0x72, 0x23, 0xd1, 0x73, 0x23, 0x72, 
-0x23, 0xed, 0x5b, 0x12, 0xac, 0x73, 0x23, 0x72, 0x23, 0x70, 0xd1, 0x21, 0xd, 0xac, 0xcd, 0x87, 
-0xff, 0xaf, 0x32, 0xc, 0xac, 0xe1, 0xcd, 0xad, 0xde, 0x2a, 0x12, 0xac, 0x18, 0x9, 0xcd, 0x45, 
-0xcb, 0x1, 0x3e, 0xff, 0x32, 0xc, 0xac, 0xeb, 0xcd, 0xd9, 0xc6, 0x20, 0xf1, 0xeb, 0xcd, 0x5d, 
-0xf6, 0xeb, 0xe5, 0xcd, 0x2, 0xc7, 0x28, 0xf, 0xf1, 0x23, 0x5e, 0x23, 0x56, 0x23, 0x7e, 0x23, 
-0x66, 0x6f, 0xcd, 0xad, 0xde, 0xeb, 0xc9, 0x1, 0x5, 0x0, 0x9, 0x5e, 0x23, 0x56, 0xe1, 0xcd, 
-0x5d, 0xf6, 0xeb, 0xcd, 0x41, 0xde, 0x38, 0xcf, 0xc9, 0x2a, 0x6f, 0xb0, 0xe5, 0x2b, 0x46, 0x23, 
-0x7d, 0x90, 0x6f, 0x9f, 0x84, 0x67, 0xe3, 0x78, 0xfe, 0x7, 0x38, 0xf, 0x20, 0x0, 0xe5, 0x2b, 
-0x2b, 0x7e, 0x2b, 0x6e, 0x67, 0xcd, 0xd8, 0xff, 0xe1, 0x20, 0x4, 0xeb, 0xe1, 0x78, 0xc9, 0xe1, 
-0x18, 0xda, 0x5e, 0x23, 0x56, 0x23, 0xe5, 0xfe, 0x10, 0x28, 0x2c, 0x1, 0x5, 0x0, 0x79, 0xeb, 
-0xcd, 0x6c, 0xff, 0xe1, 0x3a, 0xc, 0xac, 0xb7, 0x28, 0x10, 0xe5, 0x9, 0xcd, 0xc, 0xfd, 0xe1, 
-0xe5, 0x2b, 0x56, 0x2b, 0x5e, 0xeb, 0xcd, 0x83, 0xff, 0xe1, 0xe5, 0xe, 0x5, 0xcd, 0x49, 0xfd, 
-0xe1, 0x1, 0xa, 0x0, 0x9, 0x96, 0xc9, 0xeb, 0x5e, 0x23, 0x56, 0x3a, 0xc, 0xac, 0xb7, 0x28, 
-0x16, 0xe3, 0xe5, 0x23, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0xcd, 0x4a, 0xdd, 0x3e, 0x6, 0xd2, 0x55, 
-0xcb, 0xeb, 0xe1, 0xe3, 0x72, 0x2b, 0x73, 0xe1, 0x7e, 0x23, 0xe5, 0x66, 0x6f, 0xeb, 0xcd, 0x2, 
-0xde, 0xe1, 0x23, 0x23, 0x23, 0x96, 0xc9, 0xcd, 0x62, 0xcf, 0xfe, 0xa0, 0x28, 0x4, 0xcd, 0x25, 
-0xde, 0xeb, 0xcd, 0xc4, 0xfd, 0xcc, 0x5b, 0xe9, 0xc8, 0xcd, 0x3d, 0xde, 0xd8, 0xfe, 0x1e, 0x28, 
-0x5, 0xfe, 0x1d, 0xc2, 0x8f, 0xde, 0xcd, 0x27, 0xe8, 0xc0, 0xeb, 0xc9, 0xcd, 0x27, 0xe8, 0xc0, 
-0xeb, 0xe, 0x0, 0xe5, 0x3e, 0x6, 0xcd, 0x72, 0xf6, 0x71, 0x23, 0x73, 0x23, 0x72, 0x23, 0xeb, 
-0xcd, 0xb1, 0xde, 0xeb, 0x73, 0x23, 0x72, 0x23, 0x36, 0x6, 0x23, 0xcd, 0x5d, 0xf6, 0xe1, 0xc9, 
-0xc0, 0xcd, 0xcf, 0xc7, 0xcd, 0x5d, 0xf6, 0x4e, 0x23, 0x5e, 0x23, 0x56, 0x23, 0x7e, 0x23, 0x66, 
-0x6f, 0xcd, 0xad, 0xde, 0xeb, 0x79, 0xfe, 0x1, 0xd8, 0xca, 0x51, 0xc9, 0xc3, 0x61, 0xc9, 0x2a, 
-0x6f, 0xb0, 0x2b, 0x7e, 0xf5, 0x7d, 0x96, 0x6f, 0x9f, 0x84, 0x67, 0x23, 0xf1, 0xfe, 0x6, 0xc8, 
-0xb7, 0x20, 0xef, 0xcd, 0x45, 0xcb, 0x3, 0xe5, 0xcd, 0xc9, 0xca, 0xe5, 0xeb, 0x22, 0x14, 0xac, 
-0xcd, 0x5d, 0xc8, 0xcc, 0x5d, 0xf6, 0x3e, 0x7, 0xcd, 0x72, 0xf6, 0xeb, 0xcd, 0xb1, 0xde, 0xeb, 
-0x73, 0x23, 0x72, 0x23, 0xd1, 0x73, 0x23, 0x72, 0x23, 0xeb, 0xe3, 0xeb, 0x73, 0x23, 0x72, 0x23, 
-0x36, 0x7, 0x23, 0xcd, 0x5d, 0xf6, 0xeb, 0xd1, 0x18, 0x2a, 0xc0, 0xeb, 0xcd, 0x5d, 0xc8, 0x3e, 
-0x1e, 0xc2, 0x55, 0xcb, 0xe5, 0x11, 0x7, 0x0, 0x19, 0xcd, 0x5d, 0xf6, 0xcd, 0xb1, 0xde, 0x22, 
-0x14, 0xac, 0xe1, 0x5e, 0x23, 0x56, 0x23, 0xeb, 0xcd, 0xad, 0xde, 0xeb, 0x5e, 0x23, 0x56, 0x23, 
-0x7e, 0x23, 0x66, 0x6f, 0xd5, 0xcd, 0x62, 0xcf, 0xcd, 0xc4, 0xfd, 0xd1, 0xc0, 0x2a, 0x14, 0xac, 
-0xcd, 0xad, 0xde, 0x3e, 0x7, 0xcd, 0x62, 0xf6, 0xcd, 0x5d, 0xf6, 0xeb, 0xc9, 0x2a, 0x6f, 0xb0, 
-0x2b, 0xe5, 0x7d, 0x96, 0x6f, 0x9f, 0x84, 0x67, 0x23, 0xe3, 0x7e, 0xfe, 0x7, 0x38, 0xe, 0x20, 
-0xe, 0x2b, 0x2b, 0x2b, 0x7e, 0x2b, 0x6e, 0x67, 0xcd, 0xd8, 0xff, 0x20, 0x2, 0xe1, 0xc9, 0xe1, 
-0x18, 0xde, 0xfe, 0x9c, 0xca, 0xb8, 0xcc, 0xcd, 0xb8, 0xce, 0x4f, 0x7e, 0xfe, 0xa0, 0xf5, 0x28, 
-0x5, 0xcd, 0x25, 0xde, 0x9f, 0x2b, 0xcd, 0x2c, 0xde, 0xd, 0x28, 0xa, 0xcd, 0x48, 0xcf, 0xcd, 
-0x41, 0xde, 0x38, 0xf5, 0xf1, 0xc9, 0xcd, 0x27, 0xe8, 0xc4, 0xa3, 0xe9, 0xf1, 0xc2, 0x90, 0xc7, 
-0xeb, 0xc9, 0xaf, 0x32, 0x16, 0xac, 0xcd, 0xfb, 0xbc, 0x30, 0x1d, 0x47, 0x3a, 0x16, 0xac, 0xe6, 
-0x7f, 0x32, 0x16, 0xac, 0xc5, 0xe5, 0xcd, 0xfe, 0xbc, 0xe1, 0xc1, 0x3a, 0x16, 0xac, 0x17, 0xf5, 
-0x78, 0xd4, 0x1, 0xbd, 0xf1, 0x17, 0x30, 0xde, 0x3a, 0x16, 0xac, 0xe6, 0x4, 0xc4, 0x7f, 0xc4, 
-0x2a, 0x1b, 0xae, 0x3a, 0x16, 0xac, 0xe6, 0x3, 0xc8, 0x1f, 0xda, 0x3e, 0xcc, 0x23, 0xf1, 0xc3, 
-0x77, 0xde, 0x22, 0x1c, 0xac, 0x3e, 0x4, 0x30, 0x52, 0x2a, 0x1a, 0xac, 0x7c, 0xb5, 0xc4, 0xb5, 
-0xde, 0x3e, 0x41, 0x30, 0x46, 0xc5, 0xcd, 0xb9, 0xbc, 0xc1, 0x11, 0x17, 0xac, 0xe, 0x2, 0x18, 
-0x22, 0xd5, 0xcd, 0x25, 0xde, 0x9f, 0xcd, 0x27, 0xe8, 0x42, 0x4b, 0xd1, 0xe5, 0x21, 0xa, 0x0, 
-0x19, 0x71, 0x23, 0x70, 0xe1, 0xc9, 0x23, 0x23, 0x23, 0xeb, 0xcd, 0xb5, 0xde, 0x3e, 0x40, 0x30, 
-0x1a, 0xe, 0x1, 0xd5, 0xcd, 0x93, 0xc7, 0x2a, 0x1b, 0xae, 0xeb, 0xe1, 0x70, 0x23, 0x73, 0x23, 
-0x72, 0x23, 0x5e, 0x23, 0x56, 0xeb, 0x22, 0x1b, 0xae, 0x3e, 0xc2, 0x21, 0x16, 0xac, 0xb6, 0x77, 
-0xc9, 0x7e, 0x23, 0x5e, 0x23, 0x56, 0xd5, 0x1, 0xf7, 0xff, 0x9, 0xcd, 0x1, 0xbd, 0xe1, 0x18, 
-0x11, 0x7e, 0x2a, 0x1c, 0xac, 0x1, 0xfc, 0xff, 0x9, 0xcd, 0x1, 0xbd, 0xcd, 0x7f, 0xc4, 0x2a, 
-0x18, 0xac, 0xf1, 0xc3, 0x60, 0xde, 0xcd, 0x7c, 0xc9, 0xc3, 0x2c, 0xde, 0xfe, 0x8b, 0xca, 0xd0, 
-0xc4, 0xfe, 0xce, 0x11, 0x0, 0x0, 0x28, 0x8, 0xcd, 0x25, 0xde, 0x9f, 0xcd, 0x27, 0xe8, 0x2b, 
-0xed, 0x53, 0x1a, 0xac, 0xc3, 0xd3, 0xc4, 0xe5, 0xcd, 0x4, 0xbd, 0xe1, 0xc9, 0xe5, 0xcd, 0x7, 
-0xbd, 0xe1, 0xc9, 0xcd, 0xa7, 0xbc, 0x21, 0x42, 0xac, 0x6, 0x4, 0xe5, 0xcd, 0xec, 0xbc, 0xe1, 
-0x11, 0x12, 0x0, 0x19, 0x10, 0xf5, 0xcd, 0x48, 0xbb, 0xcd, 0xf5, 0xbc, 0x21, 0x0, 0x0, 0x22, 
-0x1a, 0xac, 0xcd, 0x7f, 0xc4, 0x21, 0x1e, 0xac, 0x11, 0x5, 0x3, 0x1, 0x0, 0x8, 0xcd, 0xda, 
-0xc9, 0x21, 0x48, 0xac, 0x11, 0xb, 0x4, 0x1, 0x1, 0x2, 0xc5, 0xd5, 0xe, 0xfd, 0x11, 0x26, 
-0xc9, 0xcd, 0xef, 0xbc, 0xd1, 0xd5, 0x16, 0x0, 0x19, 0xd1, 0xc1, 0x79, 0xb7, 0x28, 0x2, 0xcb, 
-0x0, 0x15, 0x20, 0xe6, 0xc9, 0xcd, 0x19, 0xde, 0xcd, 0xb8, 0xce, 0xf5, 0xcd, 0x10, 0xca, 0xb7, 
-0x20, 0x1d, 0xcd, 0x1d, 0xde, 0xcd, 0x11, 0xc9, 0xf1, 0xe5, 0xeb, 0xcd, 0xb0, 0xbc, 0xe1, 0xc9, 
-0x1f, 0x11, 0x1e, 0xac, 0xd8, 0x1f, 0x11, 0x2a, 0xac, 0xd8, 0x1f, 0x11, 0x36, 0xac, 0xd8, 0xc3, 
-0x4d, 0xcb, 0xcd, 0xce, 0xce, 0x1, 0x0, 0x0, 0x18, 0x5, 0xcd, 0xce, 0xce, 0x42, 0x4b, 0xd5, 
-0xc5, 0xcd, 0x41, 0xde, 0x11, 0x0, 0x0, 0xdc, 0xd8, 0xce, 0xeb, 0xcd, 0x62, 0xca, 0xe5, 0x1, 
-0x6, 0x0, 0x9, 0xeb, 0xcd, 0x11, 0xc9, 0xd1, 0xc1, 0xe3, 0xeb, 0xcd, 0xe9, 0xbc, 0xe1, 0xc9, 
-0xcd, 0xb6, 0xfe, 0xcd, 0x62, 0xca, 0xcd, 0xec, 0xbc, 0x38, 0x3, 0x11, 0x0, 0x0, 0xeb, 0xc3, 
-0x35, 0xff, 0x7c, 0xb7, 0x20, 0xb9, 0x7d, 0xfe, 0x4, 0x30, 0xb4, 0x87, 0x87, 0x87, 0x85, 0x87, 
-0x6f, 0x1, 0x42, 0xac, 0x9, 0xc9, 0xeb, 0xcd, 0xb1, 0xde, 0xeb, 0x2b, 0x6, 0x1, 0xe, 0x1a, 
-0xcd, 0xdd, 0xe9, 0xe5, 0xcd, 0x2c, 0xde, 0xfe, 0xb0, 0x28, 0x8, 0xe1, 0xfe, 0x9e, 0x20, 0xee, 
-0x4, 0x18, 0xeb, 0xf1, 0xeb, 0xe5, 0xcd, 0xb1, 0xde, 0xe3, 0xcd, 0xad, 0xde, 0xeb, 0x5, 0x28, 
-0x24, 0xcd, 0x2c, 0xde, 0x28, 0xe, 0xc5, 0xd5, 0xcd, 0xbf, 0xd6, 0xd1, 0xc1, 0xcd, 0x41, 0xde, 
-0x30, 0x2, 0x10, 0xf2, 0x2b, 0x78, 0xb7, 0x28, 0xc, 0xeb, 0xcd, 0xb1, 0xde, 0xe3, 0xcd, 0xad, 
-0xde, 0xe1, 0xeb, 0x18, 0xb9, 0xd1, 0xc3, 0x2c, 0xde, 0x2b, 0xeb, 0xcd, 0xb1, 0xde, 0xeb, 0x6, 
-0x0, 0x4, 0xe, 0x1d, 0xcd, 0xdd, 0xe9, 0xe5, 0xcd, 0x2c, 0xde, 0xe1, 0xfe, 0xd6, 0x28, 0xf1, 
-0xfe, 0xd5, 0x20, 0xee, 0x10, 0xec, 0xcd, 0x2c, 0xde, 0xc3, 0x2c, 0xde, 0xcd, 0xf9, 0xca, 0xd8, 
-0xcd, 0xa1, 0xc1, 0x31, 0x0, 0xc0, 0xc3, 0x5d, 0xde, 0x21, 0x8a, 0xac, 0x36, 0x0, 0xc3, 0x5e, 
-0xbd, 0x21, 0x8a, 0xac, 0xcd, 0x5e, 0xbd, 0xc3, 0x98, 0xc3, 0xc5, 0x21, 0x8a, 0xac, 0xe5, 0x6, 
-0x0, 0xe, 0xf5, 0x36, 0x0, 0xcd, 0x5c, 0xc4, 0x30, 0x1a, 0xfe, 0xd, 0x28, 0x10, 0x4f, 0x4, 
-0x10, 0x4, 0xfe, 0xa, 0x28, 0xeb, 0x77, 0x23, 0x10, 0xe9, 0xcd, 0x45, 0xcb, 0x17, 0x79, 0xfe, 
-0xa, 0x28, 0xde, 0x37, 0xe1, 0xc1, 0xc9, 0xaf, 0x32, 0x91, 0xad, 0x32, 0x90, 0xad, 0xcd, 0xb1, 
-0xde, 0x22, 0x8c, 0xad, 0xc9, 0xe3, 0x7e, 0x18, 0xc, 0x3e, 0x2, 0x18, 0x8, 0x3e, 0x5, 0x18, 
-0x4, 0xcd, 0xc3, 0xce, 0xc0, 0xcd, 0x3b, 0xcb, 0x2a, 0x1b, 0xae, 0x22, 0x8e, 0xad, 0xcd, 0x83, 
-0xcc, 0xcd, 0x3c, 0xf6, 0x31, 0x0, 0xc0, 0x2a, 0x19, 0xae, 0xcd, 0x6e, 0xf6, 0xcd, 0xcc, 0xfb, 
-0xcd, 0x20, 0xda, 0xcd, 0xaa, 0xcb, 0x2a, 0x96, 0xad, 0xeb, 0x21, 0x98, 0xad, 0x30, 0xc, 0x7a, 
-0xb3, 0x28, 0x8, 0xa6, 0x20, 0x5, 0x35, 0xeb, 0xc3, 0x77, 0xde, 0x36, 0x0, 0x3a, 0x90, 0xad, 
-0xcd, 0x8c, 0xce, 0x2a, 0x8c, 0xad, 0xcd, 0xad, 0xde, 0x3a, 0x90, 0xad, 0xee, 0x20, 0x20, 0x4, 
-0x3a, 0x91, 0xad, 0x17, 0xd4, 0x4, 0xcc, 0xc3, 0x58, 0xc0, 0x2a, 0x8c, 0xad, 0xcd, 0xb8, 0xde, 
-0xd8, 0x21, 0x0, 0x0, 0xc9, 0xd5, 0xe5, 0x21, 0xf6, 0xcd, 0x1e, 0xb, 0x18, 0x7, 0xd5, 0xe5, 
-0x21, 0xbf, 0xcd, 0x1e, 0x6, 0xf5, 0xe5, 0x2a, 0x96, 0xad, 0x7c, 0xb5, 0xe1, 0x7b, 0xc2, 0x55, 
-0xcb, 0xaf, 0xcd, 0xa6, 0xc1, 0xf5, 0xeb, 0xcd, 0x79, 0xce, 0xeb, 0xcd, 0x98, 0xc3, 0xf1, 0xcd, 
-0xa6, 0xc1, 0xf1, 0xe1, 0xd1, 0xc9, 0xcd, 0xd0, 0xc3, 0x21, 0xf1, 0xcb, 0xcd, 0x15, 0xcc, 0x18, 
-0x1c, 0x55, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 
-0x0, 0x11, 0x1c, 0xcc, 0xcd, 0xa1, 0xc1, 0xcd, 0xd0, 0xc3, 0xcd, 0x79, 0xce, 0xcd, 0xb5, 0xde, 
-0xd0, 0xeb, 0x21, 0x21, 0xcc, 0xcd, 0x8b, 0xc3, 0xeb, 0xc3, 0x44, 0xef, 0x42, 0x72, 0x65, 0x61, 
-0xeb, 0x20, 0x69, 0x6e, 0x20, 0x0, 0xc0, 0xe5, 0xcd, 0x1, 0xcc, 0xe1, 0xcd, 0x66, 0xcc, 0x18, 
-0x32, 0xc0, 0xcd, 0x66, 0xcc, 0x18, 0x23, 0x32, 0x91, 0xad, 0xcd, 0x45, 0xcb, 0x20, 0xcd, 0x1, 
-0xcc, 0x2a, 0x1b, 0xae, 0xcd, 0x83, 0xcc, 0x18, 0x1a, 0xcd, 0xb5, 0xde, 0x30, 0x12, 0xcd, 0x7e, 
-0xcc, 0x3a, 0x98, 0xad, 0xb7, 0x3e, 0x13, 0xc2, 0x55, 0xcb, 0xcd, 0xed, 0xd2, 0xcd, 0xf5, 0xd2, 
-0xcd, 0xaa, 0xde, 0xc3, 0x58, 0xc0, 0xeb, 0xcd, 0xb5, 0xde, 0xeb, 0xd0, 0x7e, 0xfe, 0x1, 0x28, 
-0xb, 0x23, 0x7e, 0x23, 0xb6, 0x28, 0x7, 0x23, 0xcd, 0xad, 0xde, 0x23, 0x18, 0x5, 0x21, 0x0, 
-0x0, 0x18, 0xc, 0xeb, 0xcd, 0xb5, 0xde, 0xd0, 0xcd, 0xb1, 0xde, 0x22, 0x94, 0xad, 0xeb, 0x22, 
-0x92, 0xad, 0xc9, 0xc0, 0x2a, 0x92, 0xad, 0x7c, 0xb5, 0x3e, 0x11, 0xca, 0x55, 0xcb, 0xe5, 0x2a, 
-0x94, 0xad, 0xcd, 0xad, 0xde, 0xcd, 0xb9, 0xbc, 0xe1, 0xc3, 0x60, 0xde, 0xaf, 0x32, 0x98, 0xad, 
-0x11, 0x0, 0x0, 0xed, 0x53, 0x96, 0xad, 0xc9, 0xcd, 0x2c, 0xde, 0xcd, 0x25, 0xde, 0xa0, 0xcd, 
-0x48, 0xcf, 0xe5, 0xcd, 0x5c, 0xe8, 0xeb, 0xe1, 0x18, 0xe9, 0xcd, 0xb0, 0xcc, 0x3a, 0x98, 0xad, 
-0xb7, 0xc8, 0xc3, 0x64, 0xcb, 0x28, 0x11, 0xfe, 0xb0, 0x28, 0x14, 0xcd, 0x27, 0xe8, 0xc0, 0xcd, 
-0xfa, 0xcc, 0xeb, 0x23, 0xf1, 0xc3, 0x77, 0xde, 0xcd, 0xfa, 0xcc, 0xf1, 0xc3, 0x60, 0xde, 0xcd, 
-0x2c, 0xde, 0xc0, 0xcd, 0xfa, 0xcc, 0x23, 0xc3, 0xa3, 0xe9, 0x3a, 0x98, 0xad, 0xb7, 0x3e, 0x14, 
-0xca, 0x55, 0xcb, 0xaf, 0x32, 0x90, 0xad, 0x32, 0x98, 0xad, 0x2a, 0x8c, 0xad, 0xcd, 0xad, 0xde, 
-0x2a, 0x8e, 0xad, 0xc9, 0x70, 0xe5, 0x69, 0xee, 0x65, 0xf2, 0x65, 0xf8, 0x69, 0x6f, 0xee, 0x20, 
-0x66, 0xf5, 0x63, 0x6f, 0xed, 0x72, 0x61, 0xee, 0x74, 0x20, 0xef, 0x6d, 0x65, 0xee, 0x74, 0x65, 
-0xe4, 0x57, 0x45, 0x4e, 0xc4, 0x6f, 0x0, 0xee, 0x46, 0x69, 0x6c, 0x65, 0xa0, 0x6e, 0x6f, 0x74, 
-0xa0, 0x74, 0x6f, 0x6f, 0xa0, 0x20, 0x6d, 0x69, 0xf3, 0x4c, 0x1, 0x65, 0xa0, 0x4e, 0x45, 0x58, 
-0xd4, 0x73, 0x4, 0xa0, 0x5, 0x6c, 0xec, 0x20, 0x2, 0x72, 0x6f, 0xf2, 0x52, 0x45, 0x53, 0x55, 
-0x4d, 0xc5, 0x53, 0x74, 0x72, 0x1, 0x67, 0xa0, 0x20, 0x6, 0x6d, 0x61, 0x6e, 0xe4, 0x10, 0x73, 
-0x1, 0xe7, 0x55, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0xee, 0xf, 0x6c, 0x6f, 0x6e, 0xe7, 0x61, 0x6c, 
-0x72, 0x65, 0x61, 0x64, 0x79, 0xa0, 0x55, 0x6e, 0x3, 0x70, 0x65, 0x63, 0xa, 0xa0, 0x69, 0x72, 
-0x65, 0x63, 0x74, 0x98, 0x1a, 0x95, 0x1d, 0x92, 0x53, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x95, 0x1d, 
-0x52, 0x45, 0x54, 0x55, 0x52, 0xce, 0x44, 0x41, 0x54, 0x41, 0x20, 0x3, 0x68, 0x61, 0x75, 0x73, 
-0x8a, 0x49, 0x6d, 0x70, 0x72, 0x6f, 0x0, 0x72, 0x20, 0x61, 0x72, 0x67, 0x75, 0x9, 0xf4, 0x4f, 
-0x76, 0x2, 0x66, 0x6c, 0x6f, 0xf7, 0x4d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x94, 0x11, 0x64, 0x6f, 
-0x65, 0x73, 0x20, 0xe, 0x3, 0x69, 0x73, 0xf4, 0x53, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 
-0x8, 0x75, 0x8, 0x66, 0x20, 0x7, 0x67, 0xe5, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x1c, 0x64, 
-0x69, 0x9, 0x73, 0x4, 0x65, 0xe4, 0x44, 0x69, 0x76, 0x69, 0x13, 0x62, 0x79, 0x20, 0x7a, 0x2, 
-0xef, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x64, 0x9e, 0x54, 0x79, 0x0, 0x10, 0x6d, 
-0x61, 0x74, 0x63, 0xe8, 0x17, 0x73, 0x70, 0x61, 0x63, 0x65, 0x94, 0x17, 0x9b, 0x17, 0x3, 0x70, 
-0x72, 0x65, 0x73, 0x13, 0xf, 0x6, 0x70, 0x6c, 0x83, 0x43, 0x61, 0x6e, 0xe, 0x43, 0x4f, 0x4e, 
-0x54, 0x1, 0x75, 0xe5, 0x1a, 0x20, 0x75, 0x73, 0x2, 0x5, 0x6e, 0x63, 0x74, 0x84, 0x16, 0x99, 
-0x1d, 0x96, 0x44, 0x1e, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0xe4, 0x4f, 0x0, 0x7, 0x64, 0x99, 0x11, 
-0x9b, 0x45, 0x4f, 0x46, 0x20, 0x6d, 0x65, 0xf4, 0xd, 0x74, 0x79, 0x0, 0x95, 0x12, 0x99, 0xd, 
-0x1c, 0x8c, 0x1a, 0x98, 0xb, 0x99, 0x1d, 0x8b, 0xd, 0xe, 0x8c, 0x42, 0x72, 0x6f, 0x6b, 0x65, 
-0x6e, 0x20, 0x81, 0x11, 0x14, 0xcd, 0xcd, 0x92, 0xce, 0xd5, 0x1a, 0xe6, 0x7f, 0xfe, 0x20, 0xd4, 
-0xa0, 0xc3, 0xdc, 0x73, 0xce, 0xd1, 0x1a, 0x13, 0x17, 0x30, 0xee, 0xc9, 0x11, 0x94, 0xcd, 0xfe, 
-0x21, 0xd0, 0xb7, 0xc8, 0xc5, 0x47, 0x1a, 0x13, 0x17, 0x30, 0xfb, 0x10, 0xf9, 0xc1, 0xc9, 0xd3, 
-0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 
-0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xcd, 0xd8, 0xce, 0xf5, 0x7a, 0xb7, 0x20, 0xb, 
-0xf1, 0x7b, 0xc9, 0xcd, 0xd8, 0xce, 0xf5, 0x7a, 0xb3, 0x20, 0xf1, 0xc3, 0x4d, 0xcb, 0xcd, 0xd8, 
-0xce, 0xf5, 0x7a, 0x17, 0x38, 0xf5, 0xf1, 0xc9, 0xcd, 0x62, 0xcf, 0xf5, 0xeb, 0xcd, 0xb6, 0xfe, 
-0xeb, 0xf1, 0xc9, 0xcd, 0x62, 0xcf, 0xcd, 0x66, 0xff, 0x20, 0xd, 0xe5, 0x2a, 0xa0, 0xb0, 0xcd, 
-0x58, 0xfb, 0xeb, 0xe1, 0xc9, 0xcd, 0x62, 0xcf, 0xf5, 0xc5, 0xe5, 0xcd, 0xeb, 0xfe, 0xeb, 0xe1, 
-0xc1, 0xf1, 0xc9, 0xcd, 0x62, 0xcf, 0xc3, 0xf5, 0xfb, 0xcd, 0x62, 0xcf, 0xc3, 0x5e, 0xff, 0x1, 
-0x1, 0x0, 0x11, 0xff, 0xff, 0xcd, 0x41, 0xde, 0xd4, 0x3d, 0xde, 0xd8, 0xfe, 0x23, 0xc8, 0xfe, 
-0xf5, 0x28, 0xa, 0xcd, 0x48, 0xcf, 0x42, 0x4b, 0xc8, 0xcd, 0x41, 0xde, 0xd8, 0xcd, 0x25, 0xde, 
-0xf5, 0x11, 0xff, 0xff, 0xc8, 0xcd, 0x41, 0xde, 0xd8, 0xcd, 0x48, 0xcf, 0xc4, 0x41, 0xde, 0xeb, 
-0xcd, 0xde, 0xff, 0xda, 0x4d, 0xcb, 0xeb, 0xc9, 0x7e, 0x23, 0x5e, 0x23, 0x56, 0xfe, 0x1e, 0x28, 
-0xe, 0xfe, 0x1d, 0xc2, 0x49, 0xcb, 0xe5, 0xeb, 0x23, 0x23, 0x23, 0x5e, 0x23, 0x56, 0xe1, 0xc3, 
-0x2c, 0xde, 0xc5, 0x6, 0x0, 0xcd, 0x6d, 0xcf, 0xc1, 0x2b, 0xc3, 0x2c, 0xde, 0x2b, 0xc5, 0xcd, 
-0x33, 0xd0, 0xe5, 0xe1, 0xc1, 0x7e, 0xfe, 0xee, 0xd8, 0xfe, 0xfe, 0xd0, 0xfe, 0xf4, 0x38, 0x45, 
-0xcc, 0x66, 0xff, 0x20, 0x12, 0xc5, 0xe5, 0x2a, 0xa0, 0xb0, 0xe3, 0xcd, 0x33, 0xd0, 0xcd, 0x5e, 
-0xff, 0xe3, 0xcd, 0x1d, 0xf9, 0x18, 0xdc, 0x7e, 0xd6, 0xf4, 0x5f, 0x87, 0x83, 0xc6, 0xed, 0x5f, 
-0xce, 0xcf, 0x93, 0x57, 0xeb, 0x78, 0xbe, 0xeb, 0xd0, 0xc5, 0xcd, 0x74, 0xff, 0xd5, 0xc5, 0x1a, 
-0x47, 0xcd, 0x6e, 0xcf, 0xc1, 0xe3, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0xeb, 0x79, 0xcd, 0x62, 0xf6, 
-0xcd, 0xfe, 0xff, 0x18, 0xae, 0x78, 0xfe, 0xa, 0xd0, 0xc5, 0x7e, 0xd6, 0xed, 0x47, 0xcd, 0x66, 
-0xff, 0x11, 0xb, 0xd0, 0x20, 0xd4, 0xe5, 0x2a, 0xa0, 0xb0, 0xe3, 0xc5, 0x6, 0xa, 0xcd, 0x6e, 
-0xcf, 0xc1, 0xe3, 0xc5, 0xcd, 0x3f, 0xf9, 0xc1, 0xcd, 0x13, 0xd0, 0x18, 0x86, 0xc, 0xc, 0xfd, 
-0xc, 0x21, 0xfd, 0x12, 0x35, 0xfd, 0x12, 0x52, 0xfd, 0x16, 0x36, 0xd5, 0x10, 0x67, 0xfd, 0x6, 
-0x87, 0xfd, 0xe, 0x79, 0xfd, 0x4, 0x92, 0xfd, 0x2, 0x9c, 0xfd, 0xa, 0xe, 0xd0, 0xc5, 0xcd, 
-0x49, 0xfd, 0xc1, 0xc6, 0x1, 0x8f, 0xa0, 0xc6, 0xff, 0x9f, 0xc3, 0x2d, 0xff, 0x6, 0x14, 0xcd, 
-0x6d, 0xcf, 0xe5, 0xcd, 0xb4, 0xfd, 0xe1, 0xc9, 0x6, 0x8, 0xcd, 0x6d, 0xcf, 0xe5, 0xcd, 0xa6, 
-0xfd, 0xe1, 0xc9, 0xcd, 0x2c, 0xde, 0x28, 0x1d, 0xfe, 0xe, 0x38, 0x38, 0xfe, 0x20, 0x38, 0x52, 
-0xfe, 0x22, 0xca, 0x79, 0xf8, 0xfe, 0xff, 0xca, 0xda, 0xd0, 0xe5, 0x21, 0x59, 0xd0, 0xcd, 0xb4, 
-0xff, 0xe3, 0xc3, 0x2c, 0xde, 0xcd, 0x45, 0xcb, 0x16, 0x8, 0xd7, 0xd0, 0xf5, 0x1d, 0xd0, 0xf4, 
-0x36, 0xd0, 0x28, 0xd1, 0xd0, 0xfe, 0x28, 0xd0, 0xe3, 0x42, 0xd1, 0xe4, 0x8a, 0xd1, 0xac, 0xe2, 
-0xf9, 0x40, 0x4e, 0xd1, 0xcd, 0xc9, 0xd6, 0x30, 0xb, 0xfe, 0x3, 0x28, 0xf, 0xe5, 0xeb, 0xcd, 
-0x6c, 0xff, 0xe1, 0xc9, 0xfe, 0x3, 0xc2, 0x1b, 0xff, 0x11, 0x91, 0xd0, 0xed, 0x53, 0xa0, 0xb0, 
-0xc9, 0x0, 0xd6, 0xe, 0x5f, 0x16, 0x0, 0xfe, 0xa, 0x38, 0x1b, 0x23, 0x5e, 0xfe, 0xb, 0x28, 
-0x15, 0x23, 0x56, 0xfe, 0xf, 0x38, 0xf, 0xfe, 0x11, 0x38, 0x12, 0x20, 0x2a, 0x2b, 0x3e, 0x5, 
-0xcd, 0x6c, 0xff, 0x2b, 0x18, 0x18, 0xeb, 0xcd, 0x35, 0xff, 0xeb, 0x18, 0x11, 0xe5, 0xfe, 0xf, 
-0x20, 0x7, 0x13, 0xeb, 0x23, 0x23, 0x5e, 0x23, 0x56, 0xeb, 0xcd, 0x89, 0xfe, 0xe1, 0xc3, 0x2c, 
-0xde, 0xcd, 0x62, 0xcf, 0xc3, 0x1d, 0xde, 0xc3, 0x49, 0xcb, 0x23, 0x4e, 0xcd, 0x2c, 0xde, 0x79, 
-0xfe, 0x40, 0x38, 0x5, 0xfe, 0x4a, 0xda, 0x10, 0xd1, 0xcd, 0x19, 0xde, 0x79, 0x87, 0xc6, 0x1e, 
-0x4f, 0xfe, 0x59, 0x30, 0xe2, 0xfe, 0x1d, 0x38, 0x9, 0xcd, 0xd1, 0xd0, 0xe5, 0xcd, 0x2, 0xd1, 
-0xe1, 0xc9, 0x11, 0xe5, 0xd1, 0xe5, 0xeb, 0x6, 0x0, 0x9, 0x7e, 0x23, 0x66, 0x6f, 0xe3, 0xc9, 
-0x87, 0x4f, 0x11, 0x97, 0xd0, 0x18, 0xee, 0x4f, 0xc4, 0x30, 0xd1, 0x48, 0xd1, 0x7e, 0xfa, 0x1d, 
-0xd5, 0xc1, 0xd5, 0x39, 0xd1, 0x61, 0xd1, 0x68, 0xd1, 0x2b, 0xd1, 0x3a, 0x91, 0xad, 0x18, 0x3, 
-0x3a, 0x90, 0xad, 0xe5, 0xcd, 0x32, 0xff, 0xe1, 0xc9, 0xe5, 0xcd, 0xd, 0xbd, 0xcd, 0xa5, 0xfe, 
-0xe1, 0xc9, 0xe5, 0xcd, 0xaa, 0xcb, 0x18, 0x14, 0xe5, 0x2a, 0x5e, 0xae, 0x18, 0xe, 0xcd, 0xc9, 
-0xd6, 0xd2, 0x4d, 0xcb, 0xe5, 0xeb, 0x78, 0xfe, 0x3, 0xcc, 0x58, 0xfb, 0xcd, 0x89, 0xfe, 0xe1, 
-0xc9, 0xe5, 0xcd, 0xc6, 0xbb, 0xeb, 0x18, 0x4, 0xe5, 0xcd, 0xc6, 0xbb, 0xcd, 0x35, 0xff, 0xe1, 
-0xc9, 0xcd, 0x25, 0xde, 0xe4, 0xeb, 0xcd, 0xb5, 0xde, 0xeb, 0x3e, 0xc, 0xd2, 0x55, 0xcb, 0xcd, 
-0xdb, 0xd6, 0xeb, 0x73, 0x23, 0x72, 0xeb, 0xc3, 0xa3, 0xe9, 0xcd, 0xdb, 0xd6, 0xc5, 0xe5, 0xeb, 
-0x5e, 0x23, 0x56, 0xeb, 0x7c, 0xb5, 0x3e, 0x12, 0xca, 0x55, 0xcb, 0xcd, 0x2a, 0xda, 0x7e, 0xfe, 
-0x28, 0x20, 0x28, 0xcd, 0x2c, 0xde, 0xe3, 0xcd, 0x19, 0xde, 0xe3, 0xcd, 0x6a, 0xda, 0xe3, 0xd5, 
-0xcd, 0x62, 0xcf, 0xe3, 0x78, 0xcd, 0x9f, 0xd6, 0xe1, 0xcd, 0x41, 0xde, 0x30, 0x6, 0xe3, 0xcd, 
-0x15, 0xde, 0x18, 0xe7, 0xcd, 0x1d, 0xde, 0xe3, 0xcd, 0x1d, 0xde, 0xcd, 0x49, 0xda, 0xcd, 0x21, 
-0xde, 0xcd, 0x62, 0xcf, 0xc2, 0x49, 0xcb, 0xcd, 0x66, 0xff, 0xcc, 0x8a, 0xfb, 0xcd, 0x52, 0xda, 
-0xe1, 0xf1, 0xc3, 0xff, 0xfe, 0x64, 0xf9, 0x8f, 0xf9, 0x69, 0xf9, 0xe5, 0xfa, 0xd3, 0xf9, 0x43, 
-0xd2, 0x3f, 0xd2, 0xaa, 0xc2, 0xd8, 0xf9, 0x6a, 0xd2, 0x8d, 0xfa, 0x71, 0xc5, 0x76, 0xc5, 0x98, 
-0xc2, 0xa1, 0xc2, 0xb0, 0xfd, 0x6e, 0xfa, 0x7e, 0xd5, 0x74, 0xfa, 0xb6, 0xfe, 0x74, 0xd5, 0x14, 
-0xff, 0x60, 0xd5, 0xe, 0xfe, 0x53, 0xfc, 0x56, 0xd4, 0x19, 0xf2, 0x13, 0xfe, 0x70, 0xd4, 0x69, 
-0xfa, 0x6a, 0xd5, 0x65, 0xd5, 0xec, 0xf8, 0x8, 0xf2, 0x50, 0xca, 0x2a, 0xff, 0x6f, 0xd5, 0xad, 
-0xfa, 0x7b, 0xd3, 0x31, 0xd5, 0xbc, 0xf9, 0x79, 0xd5, 0xeb, 0xfe, 0xfa, 0xf8, 0xbe, 0xfa, 0x6, 
-0xff, 0x18, 0x2, 0x6, 0x1, 0xcd, 0x62, 0xcf, 0xcd, 0x41, 0xde, 0xd2, 0x1d, 0xde, 0xcd, 0x74, 
-0xff, 0xcd, 0x62, 0xcf, 0xe5, 0x79, 0xcd, 0x62, 0xf6, 0xc5, 0xe5, 0xcd, 0x49, 0xfd, 0xe1, 0xc1, 
-0xb7, 0x28, 0x4, 0xb8, 0xc4, 0x6f, 0xff, 0xe1, 0x18, 0xde, 0xcd, 0x62, 0xcf, 0xcd, 0x74, 0xff, 
-0xcd, 0x41, 0xde, 0x11, 0x0, 0x0, 0xdc, 0xd8, 0xce, 0xcd, 0x1d, 0xde, 0xe5, 0xd5, 0x21, 0x27, 
-0x0, 0x19, 0x11, 0x4f, 0x0, 0xcd, 0xd8, 0xff, 0xd2, 0x4d, 0xcb, 0xd1, 0x79, 0xcd, 0x62, 0xf6, 
-0x43, 0xcd, 0xd5, 0xfd, 0xe1, 0xc9, 0xc0, 0xe5, 0xcd, 0x0, 0xd3, 0xcd, 0x2a, 0xf7, 0xcd, 0x9b, 
-0xbc, 0xca, 0x37, 0xcc, 0xe1, 0xc3, 0x61, 0xf7, 0xcd, 0xc7, 0xd2, 0xcd, 0x25, 0xf7, 0xcd, 0x69, 
-0xc4, 0xc3, 0x8c, 0xbc, 0xcd, 0xbe, 0xd2, 0xfe, 0x16, 0xc8, 0xcd, 0x45, 0xcb, 0x19, 0xcd, 0xc7, 
-0xd2, 0xcd, 0x20, 0xf7, 0xc3, 0x77, 0xbc, 0xcd, 0x2a, 0xf7, 0xcd, 0x3, 0xcf, 0xe3, 0xeb, 0xcd, 
-0xdb, 0xd2, 0xca, 0x37, 0xcc, 0xe1, 0xd8, 0xcd, 0x45, 0xcb, 0x1b, 0xd5, 0x78, 0xb7, 0x28, 0xa, 
-0x7e, 0xfe, 0x21, 0x3e, 0x0, 0x20, 0x3, 0x23, 0x5, 0x2f, 0xc3, 0x6b, 0xbc, 0xe5, 0xcd, 0x7a, 
-0xbc, 0xe1, 0xc3, 0x59, 0xf7, 0xe5, 0xcd, 0x8f, 0xbc, 0xca, 0x37, 0xcc, 0xe1, 0xc3, 0x5d, 0xf7, 
-0xc5, 0xd5, 0xe5, 0xcd, 0x7d, 0xbc, 0xcd, 0x59, 0xf7, 0xcd, 0x92, 0xbc, 0xcd, 0x5d, 0xf7, 0xe1, 
-0xd1, 0xc1, 0xc9, 0xcd, 0xb8, 0xce, 0x32, 0x99, 0xad, 0xcd, 0x15, 0xde, 0xcd, 0x4c, 0xd4, 0xed, 
-0x53, 0x9c, 0xad, 0xcd, 0x41, 0xde, 0x11, 0x14, 0x0, 0xdc, 0xd8, 0xce, 0xed, 0x53, 0xa0, 0xad, 
-0x1, 0xc, 0x10, 0xcd, 0x5f, 0xd3, 0x32, 0x9f, 0xad, 0xe, 0x0, 0xcd, 0x5f, 0xd3, 0x32, 0x9a, 
-0xad, 0xcd, 0x5f, 0xd3, 0x32, 0x9b, 0xad, 0x6, 0x20, 0xcd, 0x5f, 0xd3, 0x32, 0x9e, 0xad, 0xcd, 
-0x37, 0xde, 0xe5, 0x21, 0x99, 0xad, 0xcd, 0xaa, 0xbc, 0xe1, 0xd8, 0xf1, 0xc3, 0x5d, 0xde, 0xcd, 
-0x41, 0xde, 0x79, 0xd0, 0x7e, 0xfe, 0x2c, 0x79, 0xc8, 0xcd, 0xb8, 0xce, 0xb8, 0xd8, 0x18, 0x2b, 
-0x6, 0x8, 0xcd, 0x69, 0xd3, 0xe5, 0xcd, 0xb3, 0xbc, 0xe1, 0xc9, 0xcd, 0xb6, 0xfe, 0x7d, 0xb7, 
-0x1f, 0x38, 0x6, 0x1f, 0x38, 0x3, 0x1f, 0x30, 0x12, 0xb4, 0x20, 0xf, 0x7d, 0xcd, 0xad, 0xbc, 
-0xc3, 0x32, 0xff, 0xcd, 0xd8, 0xce, 0x7b, 0x87, 0x9f, 0xba, 0xc8, 0xc3, 0x4d, 0xcb, 0xcd, 0xc3, 
-0xce, 0xfe, 0x10, 0x30, 0xf6, 0xf5, 0x11, 0xb7, 0xd3, 0xcd, 0x25, 0xd4, 0xf1, 0xe5, 0x21, 0xa2, 
-0xad, 0x71, 0xcd, 0xbc, 0xbc, 0xe1, 0xc9, 0x7e, 0xfe, 0xef, 0x20, 0x11, 0xcd, 0x2c, 0xde, 0x6, 
-0x10, 0xcd, 0x69, 0xd3, 0xf6, 0x80, 0x4f, 0xcd, 0x15, 0xde, 0xc3, 0xf5, 0xce, 0x6, 0x80, 0xcd, 
-0x69, 0xd3, 0x18, 0x40, 0xcd, 0x93, 0xd3, 0x7a, 0xb7, 0x7b, 0x28, 0x2, 0x2f, 0x3c, 0x5f, 0xb7, 
-0x28, 0xb9, 0xfe, 0x10, 0x30, 0xb5, 0xd5, 0x11, 0xfd, 0xd3, 0xcd, 0x25, 0xd4, 0xd1, 0xe5, 0x21, 
-0xa2, 0xad, 0x7a, 0xe6, 0x80, 0xb1, 0x77, 0x7b, 0xcd, 0xbf, 0xbc, 0xe1, 0xc9, 0x7e, 0xfe, 0xef, 
-0x20, 0xd, 0xcd, 0x2c, 0xde, 0xcd, 0x4c, 0xd4, 0x7a, 0xc6, 0xf0, 0x4f, 0x43, 0x18, 0xd, 0x6, 
-0xf0, 0xcd, 0x69, 0xd3, 0x4f, 0xcd, 0x15, 0xde, 0xcd, 0x93, 0xd3, 0x43, 0xcd, 0x15, 0xde, 0xcd, 
-0xb8, 0xce, 0x57, 0x58, 0xc9, 0x1, 0x0, 0x5, 0xcd, 0x41, 0xde, 0x30, 0x1c, 0xd5, 0xc5, 0xcd, 
-0xfe, 0xff, 0x79, 0xc1, 0xc5, 0xe5, 0x21, 0xa3, 0xad, 0x6, 0x0, 0x9, 0x9, 0x9, 0x77, 0x23, 
-0x73, 0x23, 0x72, 0xe1, 0xc1, 0xc, 0xd1, 0x10, 0xdf, 0xc3, 0x37, 0xde, 0xcd, 0xd8, 0xce, 0x7a, 
-0xe6, 0xf0, 0xc2, 0x9b, 0xd3, 0xc9, 0xcd, 0xb6, 0xfe, 0x11, 0x50, 0x0, 0xcd, 0xd8, 0xff, 0x30, 
-0x22, 0x7d, 0xcd, 0x1e, 0xbb, 0x21, 0xff, 0xff, 0x28, 0x3, 0x69, 0x26, 0x0, 0xc3, 0x35, 0xff, 
-0xcd, 0x24, 0xbb, 0xeb, 0xcd, 0xb6, 0xfe, 0x7c, 0xb5, 0x28, 0x2, 0x53, 0x2b, 0x7c, 0xb5, 0x7a, 
-0xca, 0x32, 0xff, 0xc3, 0x4d, 0xcb, 0xfe, 0x8d, 0x28, 0x16, 0xcd, 0xb8, 0xce, 0xf5, 0xcd, 0x15, 
-0xde, 0xcd, 0x3, 0xcf, 0x48, 0xf1, 0x47, 0xe5, 0xeb, 0xcd, 0xf, 0xbb, 0xe1, 0x30, 0xe4, 0xc9, 
-0xcd, 0x2c, 0xde, 0x6, 0x50, 0xcd, 0x69, 0xd3, 0x4f, 0xcd, 0x15, 0xde, 0x6, 0x2, 0xcd, 0x69, 
-0xd3, 0x1f, 0x9f, 0x47, 0xc5, 0xe5, 0x79, 0xcd, 0x39, 0xbb, 0xe1, 0xc1, 0x11, 0x27, 0xbb, 0xcd, 
-0xcb, 0xd4, 0x11, 0x2d, 0xbb, 0xcd, 0xcb, 0xd4, 0x11, 0x33, 0xbb, 0xcd, 0x41, 0xde, 0xd0, 0xd5, 
-0xcd, 0xb8, 0xce, 0x47, 0xe3, 0x79, 0xcd, 0xfb, 0xff, 0xe1, 0xc9, 0xfe, 0xd9, 0x28, 0x26, 0xfe, 
-0xa4, 0x1, 0x3f, 0xbb, 0x28, 0x8, 0xfe, 0xa2, 0x1, 0x3e, 0xbc, 0xc2, 0x49, 0xcb, 0xc5, 0xcd, 
-0x2c, 0xde, 0xcd, 0xc3, 0xce, 0x4f, 0xcd, 0x15, 0xde, 0xcd, 0xc3, 0xce, 0x5f, 0x51, 0xc1, 0xeb, 
-0xcd, 0xfc, 0xff, 0xeb, 0xc9, 0xcd, 0x2c, 0xde, 0x6, 0x2, 0xcd, 0x69, 0xd3, 0xe5, 0x21, 0xa7, 
-0x0, 0x3d, 0x3e, 0x32, 0x28, 0x2, 0x29, 0xf, 0xcd, 0x68, 0xbc, 0xe1, 0xc9, 0xe5, 0xcd, 0x41, 
-0xff, 0xcd, 0x45, 0xff, 0xcd, 0x9a, 0xbd, 0xe1, 0xc9, 0x3e, 0xff, 0x18, 0x1, 0xaf, 0xc3, 0x97, 
-0xbd, 0x1, 0x9d, 0xbd, 0x18, 0x16, 0xe5, 0xc5, 0xcd, 0x14, 0xff, 0xeb, 0x21, 0xb2, 0xad, 0xcd, 
-0x61, 0xbd, 0xc1, 0xe3, 0x79, 0xcd, 0x6c, 0xff, 0xd1, 0x1, 0xa0, 0xbd, 0xcd, 0x59, 0xd5, 0xd8, 
-0xca, 0xb5, 0xcb, 0xfa, 0xbe, 0xcb, 0xc3, 0x4d, 0xcb, 0xc5, 0xd5, 0xcd, 0x14, 0xff, 0xd1, 0xc9, 
-0x1, 0xa9, 0xbd, 0x18, 0xe7, 0x1, 0xa6, 0xbd, 0x18, 0xe2, 0x1, 0xa3, 0xbd, 0x18, 0xdd, 0x1, 
-0xac, 0xbd, 0x18, 0xd8, 0x1, 0xaf, 0xbd, 0x18, 0xd3, 0x1, 0xb2, 0xbd, 0x18, 0xce, 0x1, 0xb5, 
-0xbd, 0x18, 0xc9, 0x52, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
-0x20, 0x73, 0x65, 0x65, 0x64, 0x20, 0x3f, 0x20, 0x0, 0x28, 0x6, 0xcd, 0x62, 0xcf, 0xe5, 0x18, 
-0x18, 0xe5, 0x21, 0x83, 0xd5, 0xcd, 0x8b, 0xc3, 0xcd, 0xec, 0xca, 0xcd, 0x98, 0xc3, 0xcd, 0x6f, 
-0xed, 0x30, 0xef, 0xcd, 0x4d, 0xde, 0xb7, 0x20, 0xe9, 0xcd, 0x14, 0xff, 0xcd, 0xbe, 0xbd, 0xe1, 
-0xc9, 0x7e, 0xfe, 0x28, 0x20, 0x1b, 0xcd, 0x2c, 0xde, 0xcd, 0x62, 0xcf, 0xcd, 0x1d, 0xde, 0xe5, 
-0xcd, 0x14, 0xff, 0xcd, 0x94, 0xbd, 0x20, 0x5, 0xcd, 0x8b, 0xbd, 0xe1, 0xc9, 0xfc, 0xbe, 0xbd, 
-0xe1, 0xe5, 0xcd, 0x3e, 0xff, 0xcd, 0x7f, 0xbd, 0xe1, 0xc9, 0xcd, 0xfa, 0xd5, 0x2a, 0x66, 0xae, 
-0x22, 0x68, 0xae, 0x22, 0x6a, 0xae, 0x22, 0x6c, 0xae, 0xc9, 0x21, 0xb7, 0xad, 0x3e, 0x36, 0xcd, 
-0x7, 0xd6, 0x21, 0xed, 0xad, 0x3e, 0x6, 0x36, 0x0, 0x23, 0x3d, 0x20, 0xfa, 0xc9, 0x21, 0x0, 
-0x0, 0x22, 0xeb, 0xad, 0xc3, 0x4d, 0xea, 0x3e, 0x5b, 0xed, 0x4b, 0x68, 0xae, 0xb, 0x87, 0xc6, 
-0x35, 0x6f, 0xce, 0xad, 0x95, 0x67, 0xc9, 0xed, 0x4b, 0x6a, 0xae, 0xb, 0xe6, 0x3, 0x3d, 0x87, 
-0xc6, 0xed, 0x6f, 0xce, 0xad, 0x95, 0x67, 0xc9, 0x1, 0x5a, 0x41, 0x1e, 0x5, 0x79, 0x90, 0x38, 
-0x3d, 0xe5, 0x3c, 0x21, 0xb2, 0xad, 0x6, 0x0, 0x9, 0x73, 0x2b, 0x3d, 0x20, 0xfb, 0xe1, 0xc9, 
-0x1e, 0x3, 0x18, 0x6, 0x1e, 0x2, 0x18, 0x2, 0x1e, 0x5, 0x7e, 0xcd, 0x92, 0xff, 0x30, 0x1e, 
-0x4f, 0x47, 0xcd, 0x2c, 0xde, 0xfe, 0x2d, 0x20, 0xc, 0xcd, 0x2c, 0xde, 0xcd, 0x92, 0xff, 0x30, 
-0xd, 0x4f, 0xcd, 0x2c, 0xde, 0xcd, 0x3d, 0xd6, 0xcd, 0x41, 0xde, 0x38, 0xdd, 0xc9, 0xc3, 0x49, 
-0xcb, 0xcd, 0x45, 0xcb, 0x9, 0xcd, 0x45, 0xcb, 0xa, 0xfe, 0xf8, 0xca, 0x45, 0xf2, 0xcd, 0xbf, 
-0xd6, 0xd5, 0xcd, 0x21, 0xde, 0xcd, 0x62, 0xcf, 0x78, 0xe3, 0xcd, 0x9f, 0xd6, 0xe1, 0xc9, 0x47, 
-0xcd, 0x4b, 0xff, 0xb8, 0x78, 0xc4, 0xff, 0xfe, 0xcd, 0x66, 0xff, 0xc2, 0x83, 0xff, 0xe5, 0xcd, 
-0x94, 0xfb, 0xd1, 0xc3, 0x87, 0xff, 0xcd, 0xe0, 0xd7, 0xcd, 0x41, 0xde, 0x38, 0xf8, 0xc9, 0xcd, 
-0x31, 0xd9, 0xcd, 0x6, 0xd8, 0x38, 0x42, 0x18, 0x28, 0xcd, 0x31, 0xd9, 0xcd, 0x6, 0xd8, 0x38, 
-0x38, 0xe5, 0x79, 0xcd, 0x19, 0xd6, 0xcd, 0x17, 0xd7, 0x18, 0x2d, 0xcd, 0x31, 0xd9, 0x38, 0x21, 
-0xe5, 0xcd, 0x17, 0xd6, 0xcd, 0x32, 0xd7, 0xd4, 0x6f, 0xd7, 0x18, 0x1c, 0xcd, 0x31, 0xd9, 0x38, 
-0x10, 0xe5, 0x79, 0xcd, 0x19, 0xd6, 0xcd, 0x17, 0xd7, 0x3a, 0x9f, 0xb0, 0xd4, 0x7b, 0xd7, 0x18, 
-0x7, 0xe5, 0x2a, 0x68, 0xae, 0x2b, 0x19, 0xeb, 0xe1, 0x3a, 0x9f, 0xb0, 0x47, 0x4f, 0xc9, 0xcd, 
-0x31, 0xd9, 0xcd, 0x7a, 0xe9, 0x18, 0xf2, 0xd5, 0xe5, 0x2a, 0x12, 0xae, 0x7c, 0xb5, 0x28, 0x10, 
-0x23, 0x23, 0xc5, 0x1, 0x0, 0x0, 0xcd, 0x40, 0xd7, 0xc1, 0x30, 0x4, 0xf1, 0xf1, 0x37, 0xc9, 
-0xe1, 0xd1, 0xd5, 0xe5, 0xcd, 0x40, 0xd7, 0xe1, 0x38, 0x2, 0xd1, 0xc9, 0xe1, 0xc3, 0x9e, 0xd7, 
-0x7e, 0x23, 0x66, 0x6f, 0xb4, 0xc8, 0x9, 0xe5, 0x23, 0x23, 0xed, 0x5b, 0xe, 0xae, 0x1a, 0xbe, 
-0x20, 0xd, 0x23, 0x13, 0x17, 0x30, 0xf7, 0x3a, 0x9f, 0xb0, 0x3d, 0xae, 0xe6, 0x7, 0xeb, 0xe1, 
-0x20, 0xde, 0x13, 0x37, 0xc9, 0x54, 0x5d, 0x23, 0x23, 0xcb, 0x7e, 0x23, 0x28, 0xfb, 0xc9, 0x3e, 
-0x2, 0xcd, 0x7b, 0xd7, 0x1b, 0x1a, 0xf6, 0x40, 0x12, 0x13, 0xc9, 0xd5, 0xe5, 0xc5, 0xf5, 0xcd, 
-0xa8, 0xd7, 0xf5, 0x2a, 0x6a, 0xae, 0xeb, 0xcd, 0xb8, 0xf6, 0xcd, 0x1a, 0xf6, 0xf1, 0xcd, 0xb8, 
-0xd7, 0xc1, 0xaf, 0x2b, 0x77, 0x10, 0xfc, 0xc1, 0xe3, 0xcd, 0xd0, 0xd7, 0xd1, 0xe1, 0x23, 0x7b, 
-0x91, 0x77, 0x23, 0x7a, 0x98, 0x77, 0x37, 0xc9, 0xc6, 0x3, 0x4f, 0x2a, 0xe, 0xae, 0xaf, 0x47, 
-0x3, 0x3c, 0xcb, 0x7e, 0x23, 0x28, 0xf9, 0xc9, 0x62, 0x6b, 0x9, 0xe5, 0xd5, 0x13, 0x13, 0x2a, 
-0xe, 0xae, 0xcd, 0xec, 0xff, 0x3a, 0x9f, 0xb0, 0x3d, 0x12, 0x13, 0x42, 0x4b, 0xd1, 0xe1, 0xc9, 
-0x7e, 0x12, 0x7b, 0x91, 0x77, 0x23, 0x7e, 0xf5, 0x7a, 0x98, 0x77, 0xf1, 0x13, 0x12, 0x13, 0xc9, 
-0xcd, 0x31, 0xd9, 0x7e, 0xfe, 0x28, 0x28, 0x5, 0xee, 0x5b, 0xc2, 0x49, 0xcb, 0xcd, 0x83, 0xd8, 
-0xe5, 0xc5, 0x3a, 0x9f, 0xb0, 0xcd, 0x27, 0xd6, 0xcd, 0x40, 0xd7, 0xda, 0x85, 0xd6, 0xc1, 0x3e, 
-0xff, 0xcd, 0xb3, 0xd8, 0xe1, 0xc9, 0xf5, 0x7e, 0xfe, 0x28, 0x28, 0x10, 0xee, 0x5b, 0x28, 0xc, 
-0xf1, 0xd0, 0xe5, 0x2a, 0x68, 0xae, 0x2b, 0x19, 0xeb, 0xe1, 0x37, 0xc9, 0xcd, 0x83, 0xd8, 0xf1, 
-0xe5, 0x30, 0x7, 0x2a, 0x6a, 0xae, 0x2b, 0x19, 0x18, 0x15, 0xc5, 0xd5, 0x3a, 0x9f, 0xb0, 0xcd, 
-0x27, 0xd6, 0xcd, 0x40, 0xd7, 0x30, 0xf, 0x13, 0x13, 0xe1, 0xcd, 0x9e, 0xd7, 0xc1, 0xeb, 0x78, 
-0x96, 0xc2, 0x81, 0xd6, 0x18, 0xa, 0xe1, 0xc1, 0xaf, 0xcd, 0xb3, 0xd8, 0xcd, 0x9e, 0xd7, 0xeb, 
-0x11, 0x0, 0x0, 0x46, 0x23, 0xe5, 0xd5, 0x5e, 0x23, 0x56, 0xcd, 0x27, 0xd9, 0xcd, 0xd8, 0xff, 
-0xd2, 0x81, 0xd6, 0xe3, 0xcd, 0x72, 0xdd, 0xd1, 0x19, 0xeb, 0xe1, 0x23, 0x23, 0x10, 0xe6, 0xeb, 
-0x44, 0x4d, 0x3a, 0x9f, 0xb0, 0xd6, 0x3, 0x38, 0x4, 0x29, 0x28, 0x1, 0x29, 0x9, 0x19, 0xeb, 
-0xe1, 0x37, 0xc9, 0xd5, 0xcd, 0x2c, 0xde, 0x3a, 0x9f, 0xb0, 0xf5, 0x6, 0x0, 0xcd, 0xce, 0xce, 
-0xe5, 0x3e, 0x2, 0xcd, 0x72, 0xf6, 0x73, 0x23, 0x72, 0xe1, 0x4, 0xcd, 0x41, 0xde, 0x38, 0xed, 
-0x7e, 0xfe, 0x29, 0x28, 0x5, 0xfe, 0x5d, 0xc2, 0x49, 0xcb, 0xcd, 0x2c, 0xde, 0xf1, 0x32, 0x9f, 
-0xb0, 0xd1, 0xc9, 0xe5, 0x32, 0xd, 0xae, 0xc5, 0x78, 0x87, 0xc6, 0x3, 0xcd, 0xa8, 0xd7, 0xf5, 
-0x2a, 0x6c, 0xae, 0xeb, 0xcd, 0xb8, 0xf6, 0xf1, 0xcd, 0xb8, 0xd7, 0x60, 0x69, 0xc1, 0xd5, 0x23, 
-0x23, 0x3a, 0x9f, 0xb0, 0x5f, 0x16, 0x0, 0x70, 0xe5, 0x23, 0xd5, 0x3a, 0xd, 0xae, 0xb7, 0x11, 
-0xa, 0x0, 0xeb, 0xc4, 0x27, 0xd9, 0xeb, 0x13, 0x73, 0x23, 0x72, 0x23, 0xe3, 0xcd, 0x72, 0xdd, 
-0xda, 0x81, 0xd6, 0xeb, 0xe1, 0x10, 0xe3, 0x42, 0x4b, 0x54, 0x5d, 0xcd, 0xbb, 0xf6, 0x22, 0x6c, 
-0xae, 0xc5, 0x2b, 0x36, 0x0, 0xb, 0x78, 0xb1, 0x20, 0xf8, 0xc1, 0xe1, 0x5e, 0x57, 0xeb, 0x29, 
-0x23, 0x9, 0xeb, 0x2b, 0x2b, 0x73, 0x23, 0x72, 0x23, 0xe3, 0xeb, 0x3a, 0x9f, 0xb0, 0xcd, 0x27, 
-0xd6, 0xcd, 0xd0, 0xd7, 0xd1, 0xe1, 0xc9, 0x3e, 0x2, 0xcd, 0x62, 0xf6, 0x7e, 0x23, 0x66, 0x6f, 
-0xc9, 0xcd, 0xaf, 0xd9, 0x23, 0x5e, 0x23, 0x56, 0x7a, 0xb3, 0x28, 0xa, 0x23, 0x7e, 0x17, 0x30, 
-0xfb, 0xcd, 0x2c, 0xde, 0x37, 0xc9, 0x2b, 0x2b, 0xeb, 0xc1, 0x2a, 0xe, 0xae, 0xe5, 0x21, 0x5e, 
-0xd9, 0xe5, 0xc5, 0xeb, 0xe5, 0xcd, 0x6c, 0xd9, 0xed, 0x53, 0xe, 0xae, 0xd1, 0xc9, 0xe5, 0x2a, 
-0xe, 0xae, 0xcd, 0x6e, 0xf6, 0xe1, 0xe3, 0x22, 0xe, 0xae, 0xe1, 0xc9, 0xe5, 0x7e, 0x23, 0x23, 
-0x23, 0x4e, 0xcb, 0xa9, 0xe3, 0xfe, 0xb, 0x38, 0x17, 0x79, 0xe6, 0x1f, 0xc6, 0xf2, 0x5f, 0xce, 
-0xad, 0x93, 0x57, 0x1a, 0x32, 0x9f, 0xb0, 0x36, 0xd, 0xfe, 0x5, 0x28, 0x3, 0xc6, 0x9, 0x77, 
-0xd1, 0x3e, 0x28, 0xcd, 0x72, 0xf6, 0xe5, 0x6, 0x29, 0x5, 0xca, 0x49, 0xcb, 0x1a, 0x13, 0xe6, 
-0xdf, 0x77, 0x23, 0x17, 0x30, 0xf3, 0xcd, 0x6e, 0xf6, 0xeb, 0x2b, 0xd1, 0xc3, 0x2c, 0xde, 0x7e, 
-0xfe, 0xb, 0x38, 0x2, 0xc6, 0xf7, 0xfe, 0x4, 0x28, 0x9, 0x30, 0x4, 0xfe, 0x2, 0x30, 0x5, 
-0xc3, 0x49, 0xcb, 0x3e, 0x5, 0x32, 0x9f, 0xb0, 0xc9, 0xcd, 0x2, 0xd6, 0x2a, 0x6c, 0xae, 0xeb, 
-0x2a, 0x6a, 0xae, 0xcd, 0xd8, 0xff, 0xc8, 0xd5, 0xcd, 0x65, 0xd7, 0x7e, 0x23, 0xe6, 0x7, 0x3c, 
-0xe5, 0xcd, 0x27, 0xd6, 0xcd, 0xd0, 0xd7, 0xe1, 0x5e, 0x23, 0x56, 0x23, 0x19, 0xd1, 0x18, 0xe3, 
-0xcd, 0x4d, 0xea, 0xcd, 0xfc, 0xd9, 0xcd, 0x41, 0xde, 0x38, 0xf8, 0xc9, 0xcd, 0x31, 0xd9, 0xe5, 
-0x3a, 0x9f, 0xb0, 0xcd, 0x27, 0xd6, 0xcd, 0x40, 0xd7, 0xd2, 0x4d, 0xcb, 0xeb, 0x4e, 0x23, 0x46, 
-0x23, 0x9, 0xcd, 0xe4, 0xff, 0xcd, 0xe5, 0xf6, 0xcd, 0x21, 0xf6, 0xcd, 0xc9, 0xd9, 0xe1, 0xc9, 
-0x21, 0x0, 0x0, 0x22, 0x12, 0xae, 0x22, 0x10, 0xae, 0xc9, 0xe5, 0x2a, 0x10, 0xae, 0xeb, 0x3e, 
-0x6, 0xcd, 0x72, 0xf6, 0x22, 0x10, 0xae, 0x73, 0x23, 0x72, 0x23, 0xaf, 0x77, 0x23, 0x77, 0x23, 
-0xed, 0x5b, 0x12, 0xae, 0x73, 0x23, 0x72, 0xe1, 0xc9, 0xe5, 0x2a, 0x10, 0xae, 0x22, 0x12, 0xae, 
-0xe1, 0xc9, 0x2a, 0x10, 0xae, 0xcd, 0x6e, 0xf6, 0x5e, 0x23, 0x56, 0x23, 0xed, 0x53, 0x10, 0xae, 
-0x23, 0x23, 0x5e, 0x23, 0x56, 0xeb, 0x22, 0x12, 0xae, 0xc9, 0xe5, 0x3e, 0x2, 0xcd, 0x72, 0xf6, 
-0xe3, 0xcd, 0xaf, 0xd9, 0xcd, 0x6c, 0xd9, 0xe3, 0xeb, 0x2a, 0x10, 0xae, 0x23, 0x23, 0x1, 0x0, 
-0x0, 0xcd, 0xd0, 0xd7, 0x3a, 0x9f, 0xb0, 0x47, 0x3c, 0xcd, 0x72, 0xf6, 0x78, 0x3d, 0x77, 0x23, 
-0xeb, 0xe1, 0xc9, 0x2a, 0x10, 0xae, 0x7c, 0xb5, 0x28, 0xe, 0x4e, 0x23, 0x46, 0x23, 0xc5, 0x1, 
-0x0, 0x0, 0xcd, 0xe9, 0xda, 0xe1, 0x18, 0xee, 0x1, 0x41, 0x1a, 0xc5, 0x79, 0xcd, 0x19, 0xd6, 
-0xcd, 0xe9, 0xda, 0xc1, 0xc, 0x10, 0xf4, 0x3e, 0x3, 0xcd, 0x27, 0xd6, 0xe5, 0xe1, 0x4e, 0x23, 
-0x46, 0x78, 0xb1, 0xc8, 0x2a, 0x6a, 0xae, 0x2b, 0x9, 0xe5, 0xd5, 0xcd, 0x65, 0xd7, 0xd1, 0x23, 
-0x4e, 0x23, 0x46, 0x23, 0xe5, 0x9, 0xe3, 0x4e, 0x23, 0x6, 0x0, 0x9, 0x9, 0xc1, 0xcd, 0xde, 
-0xff, 0x28, 0xda, 0xcd, 0x2, 0xdb, 0x23, 0x18, 0xf5, 0x7e, 0x23, 0x66, 0x6f, 0xb4, 0xc8, 0x9, 
-0xe5, 0xd5, 0xcd, 0x65, 0xd7, 0xd1, 0x7e, 0x23, 0xe6, 0x7, 0xfe, 0x2, 0xcc, 0x2, 0xdb, 0xe1, 
-0x18, 0xe7, 0xc5, 0xd5, 0x7e, 0x23, 0x4e, 0x23, 0x46, 0xe5, 0xeb, 0xb7, 0xc4, 0xfb, 0xff, 0xe1, 
-0xd1, 0xc1, 0xc9, 0xcd, 0x25, 0xde, 0xa3, 0xcd, 0xd4, 0xc1, 0xcd, 0x8b, 0xdb, 0xcd, 0xbf, 0xd6, 
-0xcd, 0x5e, 0xff, 0xe5, 0xd5, 0xcd, 0x31, 0xdb, 0xcd, 0x8a, 0xf8, 0xe1, 0xcd, 0xa8, 0xd6, 0xe1, 
-0xc9, 0xcd, 0xc4, 0xc1, 0xd2, 0x57, 0xdc, 0xcd, 0xec, 0xca, 0x3a, 0x14, 0xae, 0xfe, 0x3b, 0xc4, 
-0x98, 0xc3, 0xc9, 0xcd, 0xd4, 0xc1, 0xcd, 0x5b, 0xdb, 0xd5, 0xcd, 0xbf, 0xd6, 0xe3, 0xaf, 0xcd, 
-0xbd, 0xdb, 0x23, 0xe3, 0xcd, 0x41, 0xde, 0x38, 0xf1, 0xd1, 0xc9, 0xcd, 0xc4, 0xc1, 0x30, 0x2b, 
-0xe5, 0xcd, 0x8b, 0xdb, 0xe5, 0xcd, 0x37, 0xdb, 0xeb, 0xe1, 0xcd, 0xcd, 0xdb, 0xc1, 0xd8, 0xc5, 
-0x21, 0x79, 0xdb, 0xcd, 0x8b, 0xc3, 0xe1, 0x18, 0xe7, 0x3f, 0x52, 0x65, 0x64, 0x6f, 0x20, 0x66, 
-0x72, 0x6f, 0x6d, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0xa, 0x0, 0x7e, 0xfe, 0x3b, 0x32, 0x14, 
-0xae, 0xcc, 0x2c, 0xde, 0xfe, 0x22, 0x20, 0xb, 0xcd, 0xb1, 0xdb, 0xcd, 0x41, 0xde, 0xd8, 0xcd, 
-0x25, 0xde, 0x3b, 0xcd, 0xc4, 0xc1, 0xd0, 0x3e, 0x3f, 0xcd, 0xa0, 0xc3, 0x3e, 0x20, 0xc3, 0xa0, 
-0xc3, 0xcd, 0x79, 0xf8, 0xcd, 0xc4, 0xc1, 0xd2, 0xf5, 0xfb, 0xc3, 0xd0, 0xf8, 0xd5, 0xcd, 0xf7, 
-0xdb, 0x30, 0x6, 0xe3, 0xcd, 0x9f, 0xd6, 0xe1, 0xc9, 0xcd, 0x45, 0xcb, 0xd, 0xd5, 0xe5, 0xd5, 
-0xcd, 0xf, 0xd7, 0xe3, 0xaf, 0xcd, 0xf7, 0xdb, 0x30, 0x19, 0xfe, 0x3, 0xcc, 0xf5, 0xfb, 0xe3, 
-0xcd, 0x41, 0xde, 0xe3, 0x7e, 0x30, 0x8, 0xee, 0x2c, 0x20, 0x8, 0x23, 0xe3, 0x18, 0xe1, 0xb7, 
-0x20, 0x1, 0x37, 0xe1, 0xe1, 0xd1, 0xc9, 0x5f, 0xcd, 0x66, 0xff, 0xf5, 0x20, 0x6, 0xcd, 0x15, 
-0xdc, 0x37, 0x18, 0x9, 0xcd, 0xc4, 0xc1, 0xd4, 0x2c, 0xdc, 0xcd, 0x6f, 0xed, 0xf5, 0xdc, 0x4d, 
-0xde, 0xf1, 0xd1, 0x7a, 0xc9, 0xcd, 0xc4, 0xc1, 0x38, 0x6, 0xcd, 0x38, 0xdc, 0xc3, 0x8a, 0xf8, 
-0xcd, 0x4d, 0xde, 0xfe, 0x22, 0xca, 0x79, 0xf8, 0x7b, 0xc3, 0x94, 0xf8, 0xcd, 0x8e, 0xdc, 0x11, 
-0xb5, 0xdc, 0x38, 0x2b, 0xcd, 0x45, 0xcb, 0x18, 0xcd, 0x8e, 0xdc, 0x30, 0xf7, 0xfe, 0x22, 0x28, 
-0x5, 0x11, 0xb9, 0xdc, 0x18, 0x19, 0xcd, 0x99, 0xdc, 0x11, 0x54, 0xdc, 0x38, 0x11, 0x21, 0x8a, 
-0xac, 0x36, 0x0, 0xc9, 0xfe, 0x22, 0xc9, 0xcd, 0x99, 0xdc, 0x30, 0xd8, 0x11, 0xbc, 0xdc, 0x21, 
-0x8a, 0xac, 0xe5, 0x6, 0xff, 0xcd, 0xfe, 0xff, 0x28, 0xc, 0x77, 0x23, 0x5, 0x28, 0x5, 0xcd, 
-0x99, 0xdc, 0x38, 0xf1, 0xf6, 0xff, 0x36, 0x0, 0xe1, 0xc0, 0xfe, 0xd, 0xc8, 0xfe, 0x22, 0xc4, 
-0xbf, 0xdc, 0xc0, 0xcd, 0x8e, 0xdc, 0xd0, 0xcd, 0xb9, 0xdc, 0xc4, 0x86, 0xbc, 0xc9, 0xcd, 0x99, 
-0xdc, 0xd0, 0xcd, 0xbf, 0xdc, 0x28, 0xf7, 0x37, 0xc9, 0xcd, 0x5c, 0xc4, 0xd0, 0xf5, 0xc5, 0x1, 
-0xd, 0xa, 0xb9, 0x28, 0x4, 0xb8, 0x20, 0xa, 0x41, 0xcd, 0x5c, 0xc4, 0x30, 0x4, 0xb8, 0xc4, 
-0x86, 0xbc, 0xc1, 0xf1, 0xc9, 0xcd, 0xbf, 0xdc, 0xc8, 0xfe, 0x2c, 0xc8, 0xfe, 0xd, 0xc9, 0xfe, 
-0x20, 0xc8, 0xfe, 0x9, 0xc8, 0xfe, 0xa, 0xc9, 0x28, 0xa, 0xcd, 0x48, 0xcf, 0xe5, 0xcd, 0x5c, 
-0xe8, 0x2b, 0x18, 0x31, 0xe5, 0x2a, 0x64, 0xae, 0x18, 0x2b, 0xe5, 0x2a, 0x17, 0xae, 0xcd, 0xa, 
-0xdd, 0xe3, 0xcd, 0xbf, 0xd6, 0xe3, 0x23, 0x3e, 0x1, 0xcd, 0xbd, 0xdb, 0x7e, 0xfe, 0x2, 0x38, 
-0xd, 0xfe, 0x2c, 0x28, 0x9, 0x2a, 0x15, 0xae, 0xcd, 0xad, 0xde, 0xc3, 0x49, 0xcb, 0xe3, 0xcd, 
-0x41, 0xde, 0xe3, 0x38, 0xd9, 0x22, 0x17, 0xae, 0xe1, 0xc9, 0x7e, 0xfe, 0x2c, 0xc8, 0xcd, 0xa3, 
-0xe9, 0xb7, 0x20, 0xe, 0x23, 0x7e, 0x23, 0xb6, 0x23, 0x3e, 0x4, 0xca, 0x55, 0xcb, 0x22, 0x15, 
-0xae, 0x23, 0xcd, 0x2c, 0xde, 0xfe, 0x8c, 0x20, 0xe5, 0xc9, 0x44, 0xcd, 0xea, 0xdd, 0x18, 0x2, 
-0x6, 0x0, 0x1e, 0x0, 0xe, 0x2, 0xc9, 0x7c, 0xb7, 0xfa, 0x42, 0xdd, 0xb0, 0xfa, 0xed, 0xdd, 
-0x37, 0xc9, 0xee, 0x80, 0xb5, 0xc0, 0x78, 0x37, 0x8f, 0xc9, 0xb7, 0xed, 0x5a, 0x37, 0xe0, 0xf6, 
-0xff, 0xc9, 0xeb, 0xb7, 0xed, 0x52, 0x37, 0xe0, 0xf6, 0xff, 0xc9, 0xcd, 0x67, 0xdd, 0xcd, 0x72, 
-0xdd, 0xd2, 0x37, 0xdd, 0xf6, 0xff, 0xc9, 0x7c, 0xaa, 0x47, 0xeb, 0xcd, 0xea, 0xdd, 0xeb, 0xc3, 
-0xea, 0xdd, 0x7c, 0xb7, 0x28, 0x5, 0x7a, 0xb7, 0x37, 0xc0, 0xeb, 0xb5, 0xc8, 0x7a, 0xb3, 0x7d, 
-0x6b, 0x62, 0xc8, 0xfe, 0x3, 0x38, 0x10, 0x37, 0x8f, 0x30, 0xfd, 0x29, 0xd8, 0x87, 0x30, 0x2, 
-0x19, 0xd8, 0xfe, 0x80, 0x20, 0xf5, 0xc9, 0xfe, 0x1, 0xc8, 0x29, 0xc9, 0xcd, 0xab, 0xdd, 0xda, 
-0x37, 0xdd, 0xc9, 0x4c, 0xcd, 0xab, 0xdd, 0xeb, 0x41, 0x18, 0xf4, 0xcd, 0x67, 0xdd, 0x7a, 0xb3, 
-0xc8, 0xc5, 0xeb, 0x6, 0x1, 0x7c, 0xb7, 0x20, 0x9, 0x7a, 0xbd, 0x38, 0x5, 0x65, 0x2e, 0x0, 
-0x6, 0x9, 0x7b, 0x95, 0x7a, 0x9c, 0x38, 0x5, 0x4, 0x29, 0x30, 0xf6, 0x3f, 0x3f, 0x78, 0x44, 
-0x4d, 0x21, 0x0, 0x0, 0x18, 0xe, 0xcb, 0x18, 0xcb, 0x19, 0xeb, 0xed, 0x42, 0x30, 0x1, 0x9, 
-0xeb, 0x3f, 0xed, 0x6a, 0x3d, 0x20, 0xef, 0x37, 0xc1, 0xc9, 0x7c, 0xb7, 0xf0, 0xaf, 0x95, 0x6f, 
-0x9c, 0x95, 0xbc, 0x67, 0x37, 0xc0, 0xfe, 0x1, 0xc9, 0x7c, 0xb5, 0xc8, 0x7c, 0x87, 0x9f, 0xd8, 
-0x3c, 0xc9, 0x7c, 0xaa, 0x7c, 0xf2, 0xd, 0xde, 0x87, 0x9f, 0xd8, 0x3c, 0xc9, 0xba, 0x20, 0xf9, 
-0x7d, 0x93, 0x20, 0xf5, 0xc9, 0x3e, 0x2c, 0x18, 0x10, 0x3e, 0x28, 0x18, 0xc, 0x3e, 0x29, 0x18, 
-0x8, 0x3e, 0xef, 0x18, 0x4, 0xe3, 0x7e, 0x23, 0xe3, 0xbe, 0x20, 0xf, 0x23, 0x7e, 0xfe, 0x20, 
-0x28, 0xfa, 0xfe, 0x1, 0xd0, 0xb7, 0xc9, 0x7e, 0xfe, 0x2, 0xd8, 0x18, 0x6a, 0x7e, 0xfe, 0x2, 
-0xc9, 0x2b, 0xcd, 0x2c, 0xde, 0xee, 0x2c, 0xc0, 0xcd, 0x2c, 0xde, 0x37, 0xc9, 0x7e, 0x23, 0xfe, 
-0x20, 0x28, 0xfa, 0xfe, 0x9, 0x28, 0xf6, 0xfe, 0xa, 0x28, 0xf2, 0x2b, 0xc9, 0x2a, 0x1b, 0xae, 
-0x22, 0x1b, 0xae, 0xcd, 0x21, 0xb9, 0xdc, 0xb2, 0xc8, 0xcd, 0x2c, 0xde, 0xc4, 0x8f, 0xde, 0x7e, 
-0xfe, 0x1, 0x28, 0xec, 0x30, 0x31, 0x23, 0x7e, 0x23, 0xb6, 0x23, 0x28, 0xf, 0x22, 0x1d, 0xae, 
-0x23, 0x3a, 0x1f, 0xae, 0xb7, 0x28, 0xd9, 0xcd, 0xca, 0xde, 0x18, 0xd4, 0xc3, 0x49, 0xcc, 0x87, 
-0xd2, 0x89, 0xd6, 0xfe, 0xc3, 0x30, 0x10, 0xeb, 0xc6, 0xe0, 0x6f, 0xce, 0xde, 0x95, 0x67, 0x4e, 
-0x23, 0x46, 0xc5, 0xeb, 0xc3, 0x2c, 0xde, 0xc3, 0x49, 0xcb, 0x21, 0x0, 0x0, 0x22, 0x1d, 0xae, 
-0xc9, 0x2a, 0x1d, 0xae, 0xc9, 0x2a, 0x1d, 0xae, 0x7c, 0xb5, 0xc8, 0x7e, 0x23, 0x66, 0x6f, 0x37, 
-0xc9, 0x3e, 0xff, 0x18, 0x1, 0xaf, 0x32, 0x1f, 0xae, 0xc9, 0x3e, 0x5b, 0xcd, 0xa0, 0xc3, 0xe5, 
-0x2a, 0x1d, 0xae, 0x7e, 0x23, 0x66, 0x6f, 0xcd, 0x44, 0xef, 0xe1, 0x3e, 0x5d, 0xc3, 0xa0, 0xc3, 
-0x22, 0xca, 0xea, 0xc0, 0x48, 0xc2, 0x5c, 0xf2, 0x96, 0xd2, 0xfd, 0xea, 0x2f, 0xc1, 0x6, 0xc5, 
-0xed, 0xd2, 0xf5, 0xd2, 0x80, 0xc2, 0x93, 0xcc, 0xa3, 0xe9, 0x71, 0xd1, 0x54, 0xd6, 0x58, 0xd6, 
-0x50, 0xd6, 0x29, 0xd5, 0xee, 0xe7, 0xb6, 0xd6, 0x39, 0xc5, 0x3e, 0xc5, 0x46, 0xc0, 0xad, 0xe9, 
-0x31, 0xcc, 0xd4, 0xd3, 0x9e, 0xd3, 0xf0, 0xd9, 0x51, 0xcb, 0x2a, 0xca, 0xd4, 0xc5, 0x8c, 0xc7, 
-0x86, 0xc7, 0x67, 0xc7, 0x51, 0xc2, 0x43, 0xdb, 0x86, 0xd4, 0x8e, 0xd6, 0x13, 0xdb, 0xcd, 0xe1, 
-0xb5, 0xea, 0xff, 0xc2, 0x6b, 0xf5, 0x54, 0xeb, 0x7, 0xfa, 0x75, 0xc2, 0x2f, 0xc5, 0x34, 0xc5, 
-0xa2, 0xc6, 0x28, 0xc1, 0x82, 0xc8, 0x76, 0xc9, 0xca, 0xcc, 0xf5, 0xc9, 0xb4, 0xd2, 0xa8, 0xd2, 
-0xde, 0xc4, 0x23, 0xf2, 0x39, 0xc2, 0x24, 0xc2, 0x43, 0xc5, 0x48, 0xc5, 0xf, 0xf2, 0xa4, 0xf2, 
-0xa7, 0xe9, 0x2d, 0xd5, 0x99, 0xd5, 0xda, 0xdc, 0x70, 0xd3, 0xa7, 0xe9, 0x9e, 0xe8, 0xc8, 0xdc, 
-0xd5, 0xcc, 0xb0, 0xc7, 0x78, 0xea, 0xdc, 0xec, 0x13, 0xd3, 0xdb, 0xd4, 0x26, 0xcc, 0x84, 0xf7, 
-0x43, 0xc3, 0x4a, 0xc3, 0xc5, 0xde, 0xc1, 0xde, 0x29, 0xf2, 0x1a, 0xc8, 0xe7, 0xc7, 0x2a, 0xc4, 
-0xe, 0xc3, 0x8, 0xf5, 0x9d, 0xf2, 0x97, 0xc9, 0x9d, 0xc9, 0x12, 0xc5, 0x9a, 0xc5, 0xc0, 0xc5, 
-0x19, 0xbd, 0x60, 0xc3, 0xd5, 0xed, 0x5b, 0x62, 0xae, 0xd5, 0xcd, 0x35, 0xe0, 0x1, 0x2c, 0x1, 
-0xcd, 0xc8, 0xdf, 0x7e, 0xb7, 0x20, 0xf9, 0x3e, 0x2d, 0x91, 0x4f, 0x3e, 0x1, 0x98, 0x47, 0xaf, 
-0x12, 0x13, 0x12, 0x13, 0x12, 0xe1, 0xd1, 0xc9, 0x7e, 0xb7, 0xc8, 0xcd, 0x92, 0xff, 0x38, 0x1c, 
-0xcd, 0xa0, 0xff, 0xda, 0xe2, 0xe0, 0xfe, 0x26, 0xca, 0x36, 0xe1, 0x23, 0xb7, 0xf8, 0xfe, 0x21, 
-0xd2, 0x5c, 0xe1, 0x3a, 0x0, 0xac, 0xb7, 0xc0, 0x3e, 0x20, 0x18, 0x1c, 0xcd, 0x3a, 0xe0, 0xd8, 
-0xfe, 0xc5, 0xca, 0xc3, 0xe1, 0xe5, 0x21, 0x12, 0xe0, 0xcd, 0xca, 0xff, 0xe1, 0x38, 0x18, 0xf5, 
-0xfe, 0x97, 0x3e, 0x1, 0xcc, 0x8, 0xe0, 0xf1, 0x12, 0x13, 0xb, 0x79, 0xb0, 0xc0, 0xcd, 0x45, 
-0xcb, 0x17, 0x8c, 0x8e, 0x90, 0x8f, 0x0, 0xcd, 0x8, 0xe0, 0x7e, 0xb7, 0xc8, 0xfe, 0x3a, 0x28, 
-0x14, 0x23, 0xb7, 0xfa, 0x1a, 0xe0, 0xfe, 0x20, 0x30, 0x2, 0x3e, 0x20, 0xfe, 0x22, 0x20, 0xe7, 
-0xcd, 0x95, 0xe1, 0x18, 0xe5, 0xaf, 0x32, 0x20, 0xae, 0xc9, 0xc5, 0xd5, 0xe5, 0x7e, 0x23, 0xcd, 
-0xab, 0xff, 0xcd, 0xa8, 0xe3, 0xcd, 0xeb, 0xe3, 0x30, 0x26, 0x79, 0xe6, 0x7f, 0xcd, 0x9c, 0xff, 
-0x30, 0x9, 0x1a, 0xfe, 0xe4, 0x7e, 0xc4, 0x9c, 0xff, 0x38, 0x15, 0xf1, 0x1a, 0xb7, 0xfa, 0xaf, 
-0xe0, 0xd1, 0xc1, 0xf5, 0x3e, 0xff, 0xcd, 0x8, 0xe0, 0xf1, 0xcd, 0x8, 0xe0, 0xaf, 0x18, 0x3a, 
-0xe1, 0xd1, 0xc1, 0xe5, 0x2b, 0x23, 0x7e, 0xcd, 0x9c, 0xff, 0x38, 0xf9, 0xcd, 0xd1, 0xe0, 0x38, 
-0x4, 0x3e, 0xd, 0x18, 0x6, 0x23, 0xfe, 0x5, 0x20, 0x1, 0x3d, 0xcd, 0x8, 0xe0, 0xaf, 0xcd, 
-0x8, 0xe0, 0xaf, 0xcd, 0x8, 0xe0, 0xe3, 0x7e, 0xcd, 0x9c, 0xff, 0x30, 0x7, 0x7e, 0xcd, 0x8, 
-0xe0, 0x23, 0x18, 0xf3, 0xcd, 0xb5, 0xe1, 0xe1, 0x3e, 0xff, 0x32, 0x20, 0xae, 0x37, 0xc9, 0xe5, 
-0x4f, 0x21, 0xc3, 0xe0, 0xcd, 0xca, 0xff, 0x9f, 0xe6, 0x1, 0x32, 0x20, 0xae, 0x79, 0xe1, 0xd1, 
-0xc1, 0xb7, 0xc9, 0xc7, 0x81, 0xc6, 0x92, 0x96, 0xc8, 0xe3, 0x97, 0xca, 0xa7, 0xa0, 0xeb, 0x9f, 
-0x0, 0xfe, 0x21, 0x28, 0x7, 0xfe, 0x26, 0xd0, 0xfe, 0x24, 0x3f, 0xd0, 0xde, 0x1f, 0xee, 0x7, 
-0x37, 0xc9, 0x3a, 0x20, 0xae, 0xb7, 0x28, 0x10, 0x7e, 0x23, 0xfa, 0x8, 0xe0, 0x2b, 0xd5, 0xcd, 
-0xcf, 0xee, 0x30, 0x32, 0x3e, 0x1e, 0x18, 0x4d, 0xd5, 0xc5, 0xcd, 0x8a, 0xed, 0xc1, 0x30, 0x26, 
-0xcd, 0x66, 0xff, 0x3e, 0x1f, 0x30, 0x3e, 0xed, 0x5b, 0xa0, 0xb0, 0x7a, 0xb7, 0x3e, 0x1a, 0x20, 
-0x34, 0xe3, 0xeb, 0x7d, 0xfe, 0xa, 0x30, 0x4, 0xc6, 0xe, 0x18, 0x6, 0x3e, 0x19, 0xcd, 0x8, 
-0xe0, 0x7d, 0xe1, 0xc3, 0x8, 0xe0, 0x7e, 0x23, 0xe3, 0xeb, 0xcd, 0x8, 0xe0, 0xeb, 0xe3, 0xcd, 
-0xd8, 0xff, 0x20, 0xf2, 0xd1, 0xc9, 0xd5, 0xc5, 0xcd, 0x8a, 0xed, 0xc1, 0x30, 0xe8, 0xfe, 0x2, 
-0x3e, 0x1b, 0x28, 0x1, 0x3c, 0xd1, 0xcd, 0x8, 0xe0, 0xe5, 0x21, 0xa0, 0xb0, 0xcd, 0x4b, 0xff, 
-0xf5, 0x7e, 0x23, 0xcd, 0x8, 0xe0, 0xf1, 0x3d, 0x20, 0xf6, 0xe1, 0xc9, 0xfe, 0x22, 0x28, 0x35, 
-0xfe, 0x7c, 0x28, 0x3f, 0xc5, 0xd5, 0xee, 0x3f, 0x6, 0xbf, 0x28, 0x10, 0x2b, 0x11, 0x36, 0xe7, 
-0xcd, 0xeb, 0xe3, 0x1a, 0x38, 0x2, 0x7e, 0x23, 0x47, 0xcd, 0x89, 0xe1, 0x32, 0x20, 0xae, 0x78, 
-0xd1, 0xc1, 0xfe, 0xc0, 0x28, 0x36, 0xc3, 0x8, 0xe0, 0x3d, 0xc8, 0xee, 0x22, 0xc8, 0x3a, 0x20, 
-0xae, 0x3c, 0xc8, 0x3d, 0xc9, 0xcd, 0x8, 0xe0, 0x7e, 0xb7, 0xc8, 0x23, 0xfe, 0x22, 0x20, 0xf5, 
-0xc3, 0x8, 0xe0, 0xcd, 0x8, 0xe0, 0xaf, 0x32, 0x20, 0xae, 0xcd, 0x8, 0xe0, 0x7e, 0x23, 0xcd, 
-0x9c, 0xff, 0x38, 0xf6, 0x2b, 0x1b, 0x1a, 0xf6, 0x80, 0x12, 0x13, 0xc9, 0x3e, 0x1, 0xcd, 0x8, 
-0xe0, 0x3e, 0xc0, 0xcd, 0x8, 0xe0, 0x7e, 0x23, 0xb7, 0x20, 0xf8, 0x2b, 0xc9, 0xcd, 0xf, 0xcf, 
-0xc5, 0xd5, 0xcd, 0xca, 0xc1, 0xcd, 0x37, 0xde, 0xcd, 0xaa, 0xde, 0xd1, 0xc1, 0xcd, 0xe3, 0xe1, 
-0xc3, 0x58, 0xc0, 0xd5, 0x50, 0x59, 0xcd, 0x64, 0xe8, 0xd1, 0x4e, 0x23, 0x46, 0x2b, 0x78, 0xb1, 
-0xc8, 0xcd, 0x72, 0xc4, 0xe5, 0x9, 0xe3, 0xd5, 0xe5, 0x23, 0x23, 0x5e, 0x23, 0x56, 0xe1, 0xe3, 
-0xcd, 0xd8, 0xff, 0xe3, 0x38, 0x12, 0xcd, 0x54, 0xe2, 0x21, 0x8a, 0xac, 0xcd, 0x1d, 0xe2, 0x23, 
-0x7e, 0xb7, 0x20, 0xf8, 0xcd, 0x98, 0xc3, 0xb7, 0xd1, 0xe1, 0x30, 0xce, 0xc9, 0xcd, 0xbe, 0xc1, 
-0x7e, 0x38, 0xa, 0xcd, 0xb8, 0xc3, 0xfe, 0xa, 0xc0, 0x3e, 0xd, 0x18, 0x8, 0xfe, 0x20, 0x3e, 
-0x1, 0xdc, 0xb8, 0xc3, 0x7e, 0xc3, 0xb8, 0xc3, 0xcd, 0x64, 0xe8, 0x38, 0x17, 0xeb, 0xcd, 0x4a, 
-0xef, 0x11, 0x0, 0x1, 0x1, 0x8a, 0xac, 0x7e, 0x23, 0x2, 0x3, 0x15, 0xb7, 0x20, 0xf8, 0x2, 
-0xb, 0xc3, 0xe8, 0xe2, 0xe5, 0xcd, 0x3d, 0xe2, 0xe1, 0x23, 0x23, 0x23, 0x23, 0x7e, 0x2, 0xb7, 
-0xc8, 0xcd, 0x66, 0xe2, 0x18, 0xf7, 0xfa, 0xf8, 0xe2, 0xfe, 0x2, 0x38, 0x1c, 0xfe, 0x5, 0x38, 
-0x42, 0xfe, 0xe, 0x38, 0x3e, 0xfe, 0x20, 0x38, 0x31, 0xfe, 0x7c, 0x28, 0x54, 0xcd, 0xd1, 0xe0, 
-0xd4, 0x9c, 0xff, 0xdc, 0xe6, 0xe2, 0x7e, 0x18, 0xd, 0x23, 0x7e, 0xfe, 0xc0, 0x28, 0x5d, 0xfe, 
-0x97, 0x28, 0x69, 0x2b, 0x3e, 0x3a, 0x1e, 0x0, 0xfe, 0x22, 0x20, 0xb, 0xcd, 0xca, 0xe2, 0x23, 
-0x7e, 0xb7, 0xc8, 0xfe, 0x22, 0x20, 0xf5, 0x23, 0x18, 0x20, 0xcd, 0xe6, 0xe2, 0xcd, 0x2f, 0xe3, 
-0x1e, 0x1, 0xc9, 0xcd, 0xe6, 0xe2, 0x7e, 0xf5, 0x23, 0x23, 0x23, 0xcd, 0xdb, 0xe2, 0xf1, 0x1e, 
-0x1, 0xfe, 0xb, 0xd0, 0x1e, 0x0, 0xee, 0x27, 0xe6, 0xfd, 0x2, 0x3, 0x15, 0xc0, 0xb, 0x14, 
-0xc9, 0x1e, 0x1, 0xcd, 0xca, 0xe2, 0x23, 0x7e, 0x23, 0xb7, 0xc0, 0x7e, 0xe6, 0x7f, 0xcd, 0xca, 
-0xe2, 0xbe, 0x23, 0x30, 0xf6, 0xc9, 0x1d, 0xc0, 0x3e, 0x20, 0x18, 0xde, 0xcd, 0xfc, 0xe2, 0x7e, 
-0xb7, 0xc8, 0xcd, 0xca, 0xe2, 0x23, 0x18, 0xf7, 0xfe, 0xc5, 0x28, 0xf0, 0x23, 0xfe, 0xff, 0x20, 
-0x2, 0x7e, 0x23, 0xf5, 0xe5, 0xcd, 0xb8, 0xe3, 0xb7, 0x28, 0x8, 0xf5, 0xcd, 0xe6, 0xe2, 0xf1, 
-0xcd, 0xca, 0xe2, 0x7e, 0xe6, 0x7f, 0xfe, 0x9, 0xc4, 0xca, 0xe2, 0xbe, 0x23, 0x28, 0xf4, 0xcd, 
-0x9c, 0xff, 0x1e, 0x0, 0x30, 0x2, 0x1e, 0x1, 0xe1, 0xf1, 0xd6, 0xe4, 0xc0, 0x5f, 0xc9, 0xd5, 
-0x7e, 0x23, 0xfe, 0x1f, 0x28, 0x5d, 0x5e, 0x23, 0x56, 0x23, 0xfe, 0x1b, 0x28, 0x32, 0xfe, 0x1c, 
-0x28, 0x39, 0xfe, 0x1e, 0x28, 0x23, 0xfe, 0x1d, 0x28, 0x16, 0xfe, 0x1a, 0x28, 0xb, 0x2b, 0x16, 
-0x0, 0xfe, 0x19, 0x28, 0x4, 0x2b, 0xd6, 0xe, 0x5f, 0xe3, 0xeb, 0xcd, 0x35, 0xff, 0x18, 0x3a, 
-0xe5, 0xeb, 0x23, 0x23, 0x23, 0x5e, 0x23, 0x56, 0xe1, 0xe3, 0xeb, 0xcd, 0x4a, 0xef, 0x18, 0x2d, 
-0xe3, 0x3e, 0x58, 0x37, 0xf5, 0xc5, 0x1, 0x1, 0x1, 0x18, 0x7, 0xe3, 0xb7, 0xf5, 0xc5, 0x1, 
-0xf, 0x4, 0xeb, 0xaf, 0xcd, 0xdf, 0xf1, 0xc1, 0x3e, 0x26, 0xcd, 0xca, 0xe2, 0xf1, 0xdc, 0xca, 
-0xe2, 0x18, 0xa, 0x3e, 0x5, 0xcd, 0x6c, 0xff, 0xe3, 0xeb, 0xcd, 0x5a, 0xef, 0x7e, 0x23, 0xcd, 
-0xca, 0xe2, 0x7e, 0xb7, 0x20, 0xf7, 0xe1, 0xc9, 0xe5, 0xd6, 0x41, 0x87, 0xc6, 0x18, 0x6f, 0xce, 
-0xe4, 0x95, 0x67, 0x5e, 0x23, 0x56, 0xe1, 0xc9, 0xc5, 0x4f, 0x6, 0x1a, 0x21, 0x4c, 0xe4, 0xcd, 
-0xd7, 0xe3, 0x38, 0xe, 0x23, 0x10, 0xf8, 0x21, 0x36, 0xe7, 0xcd, 0xd7, 0xe3, 0xd2, 0x49, 0xcb, 
-0x6, 0xc0, 0x78, 0xc6, 0x40, 0xc1, 0xc9, 0x7e, 0xb7, 0xc8, 0xe5, 0x7e, 0x23, 0x17, 0x30, 0xfb, 
-0x7e, 0x23, 0xb9, 0x28, 0x3, 0xf1, 0x18, 0xef, 0xe1, 0x37, 0xc9, 0x1a, 0xb7, 0xc8, 0xe5, 0x1a, 
-0x13, 0xfe, 0x9, 0x28, 0x4, 0xfe, 0x20, 0x20, 0x5, 0xcd, 0x4d, 0xde, 0x18, 0xf1, 0x4f, 0x7e, 
-0x23, 0xcd, 0xab, 0xff, 0xa9, 0x28, 0xe8, 0xe6, 0x7f, 0x28, 0xa, 0x1b, 0x1a, 0x13, 0x17, 0x30, 
-0xfb, 0x13, 0xe1, 0x18, 0xd6, 0xf1, 0x37, 0xc9, 0x20, 0xe7, 0x15, 0xe7, 0xcc, 0xe6, 0x92, 0xe6, 
-0x63, 0xe6, 0x4e, 0xe6, 0x3a, 0xe6, 0x30, 0xe6, 0xf, 0xe6, 0xb, 0xe6, 0x7, 0xe6, 0xdb, 0xe5, 
-0xb1, 0xe5, 0xa6, 0xe5, 0x6e, 0xe5, 0x4a, 0xe5, 0x49, 0xe5, 0xff, 0xe4, 0xbf, 0xe4, 0x93, 0xe4, 
-0x84, 0xe4, 0x7c, 0xe4, 0x5e, 0xe4, 0x56, 0xe4, 0x51, 0xe4, 0x4c, 0xe4, 0x4f, 0x4e, 0xc5, 0xda, 
-0x0, 0x50, 0x4f, 0xd3, 0x48, 0x0, 0x50, 0x4f, 0xd3, 0x47, 0x4f, 0xd2, 0xfd, 0x0, 0x52, 0x49, 
-0x54, 0xc5, 0xd9, 0x49, 0x4e, 0x44, 0x4f, 0xd7, 0xd8, 0x49, 0x44, 0x54, 0xc8, 0xd7, 0x48, 0x49, 
-0x4c, 0xc5, 0xd6, 0x45, 0x4e, 0xc4, 0xd5, 0x41, 0x49, 0xd4, 0xd4, 0x0, 0x50, 0x4f, 0xd3, 0x7f, 
-0x41, 0xcc, 0x1d, 0x0, 0x53, 0x49, 0x4e, 0xc7, 0xed, 0x50, 0x50, 0x45, 0x52, 0xa4, 0x1c, 0x4e, 
-0xd4, 0x1b, 0x0, 0x52, 0x4f, 0xce, 0xd3, 0x52, 0x4f, 0x46, 0xc6, 0xd2, 0xcf, 0xec, 0x49, 0x4d, 
-0xc5, 0x46, 0x48, 0x45, 0xce, 0xeb, 0x45, 0x53, 0x54, 0xd2, 0x7d, 0x45, 0x53, 0xd4, 0x7c, 0x41, 
-0xce, 0x1a, 0x41, 0x47, 0x4f, 0x46, 0xc6, 0xd1, 0x41, 0xc7, 0xd0, 0x41, 0xc2, 0xea, 0x0, 0x59, 
-0x4d, 0x42, 0x4f, 0xcc, 0xcf, 0x57, 0x41, 0xd0, 0xe7, 0x54, 0x52, 0x49, 0x4e, 0x47, 0xa4, 0x7b, 
-0x54, 0x52, 0xa4, 0x19, 0x54, 0x4f, 0xd0, 0xce, 0x54, 0x45, 0xd0, 0xe6, 0x51, 0xd2, 0x18, 0xd1, 
-0x17, 0x50, 0x45, 0x45, 0xc4, 0xcd, 0x50, 0xc3, 0xe5, 0x50, 0x41, 0x43, 0x45, 0xa4, 0x16, 0x4f, 
-0x55, 0x4e, 0xc4, 0xcc, 0x49, 0xce, 0x15, 0x47, 0xce, 0x14, 0x41, 0x56, 0xc5, 0xcb, 0x0, 0x55, 
-0xce, 0xca, 0x4f, 0x55, 0x4e, 0xc4, 0x7a, 0x4e, 0xc4, 0x45, 0x49, 0x47, 0x48, 0x54, 0xa4, 0x79, 
-0x45, 0x54, 0x55, 0x52, 0xce, 0xc9, 0x45, 0x53, 0x55, 0x4d, 0xc5, 0xc8, 0x45, 0x53, 0x54, 0x4f, 
-0x52, 0xc5, 0xc7, 0x45, 0x4e, 0x55, 0xcd, 0xc6, 0x45, 0x4d, 0x41, 0x49, 0xce, 0x13, 0x45, 0xcd, 
-0xc5, 0x45, 0x4c, 0x45, 0x41, 0x53, 0xc5, 0xc4, 0x45, 0x41, 0xc4, 0xc3, 0x41, 0x4e, 0x44, 0x4f, 
-0x4d, 0x49, 0x5a, 0xc5, 0xc2, 0x41, 0xc4, 0xc1, 0x0, 0x0, 0x52, 0x49, 0x4e, 0xd4, 0xbf, 0x4f, 
-0xd3, 0x78, 0x4f, 0x4b, 0xc5, 0xbe, 0x4c, 0x4f, 0x54, 0xd2, 0xbd, 0x4c, 0x4f, 0xd4, 0xbc, 0xc9, 
-0x44, 0x45, 0xce, 0xbb, 0x45, 0x45, 0xcb, 0x12, 0x41, 0x50, 0x45, 0xd2, 0xba, 0x0, 0x55, 0xd4, 
-0xb9, 0x52, 0x49, 0x47, 0x49, 0xce, 0xb8, 0xd2, 0xfc, 0x50, 0x45, 0x4e, 0x4f, 0x55, 0xd4, 0xb7, 
-0x50, 0x45, 0x4e, 0x49, 0xce, 0xb6, 0x4e, 0x20, 0x53, 0xd1, 0xb5, 0x4e, 0x20, 0x45, 0x52, 0x52, 
-0x4f, 0x52, 0x20, 0x47, 0x4f, 0x9, 0x54, 0x4f, 0x20, 0xb0, 0xb4, 0x4e, 0x20, 0x42, 0x52, 0x45, 
-0x41, 0xcb, 0xb3, 0xce, 0xb2, 0x0, 0x4f, 0xd4, 0xfe, 0x45, 0xd7, 0xb1, 0x45, 0x58, 0xd4, 0xb0, 
-0x0, 0x4f, 0x56, 0x45, 0xd2, 0xaf, 0x4f, 0x56, 0xc5, 0xae, 0x4f, 0x44, 0xc5, 0xad, 0x4f, 0xc4, 
-0xfb, 0x49, 0xce, 0x77, 0x49, 0x44, 0xa4, 0xac, 0x45, 0x52, 0x47, 0xc5, 0xab, 0x45, 0x4d, 0x4f, 
-0x52, 0xd9, 0xaa, 0x41, 0xd8, 0x76, 0x41, 0x53, 0xcb, 0xdf, 0x0, 0x4f, 0x57, 0x45, 0x52, 0xa4, 
-0x11, 0x4f, 0x47, 0x31, 0xb0, 0x10, 0x4f, 0xc7, 0xf, 0x4f, 0x43, 0x41, 0x54, 0xc5, 0xa9, 0x4f, 
-0x41, 0xc4, 0xa8, 0x49, 0x53, 0xd4, 0xa7, 0x49, 0x4e, 0xc5, 0xa6, 0x45, 0xd4, 0xa5, 0x45, 0xce, 
-0xe, 0x45, 0x46, 0x54, 0xa4, 0x75, 0x0, 0x45, 0xd9, 0xa4, 0x0, 0x4f, 0xd9, 0xd, 0x0, 0x4e, 
-0xd4, 0xc, 0x4e, 0x53, 0x54, 0xd2, 0x74, 0x4e, 0x50, 0x55, 0xd4, 0xa3, 0x4e, 0xd0, 0xb, 0x4e, 
-0x4b, 0x45, 0x59, 0xa4, 0x43, 0x4e, 0x4b, 0x45, 0xd9, 0xa, 0x4e, 0xcb, 0xa2, 0xc6, 0xa1, 0x0, 
-0x49, 0x4d, 0x45, 0xcd, 0x42, 0x45, 0x58, 0xa4, 0x73, 0x0, 0x52, 0x41, 0x50, 0x48, 0x49, 0x43, 
-0xd3, 0xde, 0x4f, 0x9, 0x54, 0xcf, 0xa0, 0x4f, 0x9, 0x53, 0x55, 0xc2, 0x9f, 0x0, 0x52, 0xc5, 
-0x9, 0x52, 0x41, 0x4d, 0xc5, 0xe0, 0x4f, 0xd2, 0x9e, 0xce, 0xe4, 0x49, 0xd8, 0x8, 0x49, 0x4c, 
-0xcc, 0xdd, 0x0, 0x58, 0xd0, 0x7, 0x56, 0x45, 0x52, 0xd9, 0x9d, 0x52, 0x52, 0x4f, 0xd2, 0x9c, 
-0x52, 0xd2, 0x41, 0x52, 0xcc, 0xe3, 0x52, 0x41, 0x53, 0xc5, 0x9b, 0x4f, 0xc6, 0x40, 0x4e, 0xd6, 
-0x9a, 0x4e, 0xd4, 0x99, 0x4e, 0xc4, 0x98, 0x4c, 0x53, 0xc5, 0x97, 0xc9, 0xdc, 0x44, 0x49, 0xd4, 
-0x96, 0x0, 0x52, 0x41, 0x57, 0xd2, 0x95, 0x52, 0x41, 0xd7, 0x94, 0x49, 0xcd, 0x93, 0xc9, 0xdb, 
-0x45, 0x52, 0xd2, 0x49, 0x45, 0x4c, 0x45, 0x54, 0xc5, 0x92, 0x45, 0xc7, 0x91, 0x45, 0x46, 0x53, 
-0x54, 0xd2, 0x90, 0x45, 0x46, 0x52, 0x45, 0x41, 0xcc, 0x8f, 0x45, 0x46, 0x49, 0x4e, 0xd4, 0x8e, 
-0x45, 0xc6, 0x8d, 0x45, 0x43, 0xa4, 0x72, 0x41, 0x54, 0xc1, 0x8c, 0x0, 0x55, 0x52, 0x53, 0x4f, 
-0xd2, 0xe1, 0x52, 0x45, 0x41, 0xcc, 0x6, 0x4f, 0xd3, 0x5, 0x4f, 0x50, 0x59, 0x43, 0x48, 0x52, 
-0xa4, 0x7e, 0x4f, 0x4e, 0xd4, 0x8b, 0x4c, 0xd3, 0x8a, 0x4c, 0x4f, 0x53, 0x45, 0x4f, 0x55, 0xd4, 
-0x89, 0x4c, 0x4f, 0x53, 0x45, 0x49, 0xce, 0x88, 0x4c, 0xc7, 0x87, 0x4c, 0x45, 0x41, 0xd2, 0x86, 
-0x49, 0x4e, 0xd4, 0x4, 0x48, 0x52, 0xa4, 0x3, 0x48, 0x41, 0x49, 0xce, 0x85, 0x41, 0xd4, 0x84, 
-0x41, 0x4c, 0xcc, 0x83, 0x0, 0x4f, 0x52, 0x44, 0x45, 0xd2, 0x82, 0x49, 0x4e, 0xa4, 0x71, 0x0, 
-0x55, 0x54, 0xcf, 0x81, 0x54, 0xce, 0x2, 0x53, 0xc3, 0x1, 0x4e, 0xc4, 0xfa, 0x46, 0x54, 0x45, 
-0xd2, 0x80, 0x42, 0xd3, 0x0, 0x0, 0xde, 0xf8, 0xdc, 0xf9, 0x3e, 0x9, 0xbd, 0xf0, 0x3d, 0x20, 
-0xbe, 0xf0, 0xbe, 0xee, 0x3c, 0x9, 0xbe, 0xf2, 0x3c, 0x9, 0xbd, 0xf3, 0x3d, 0x20, 0xbc, 0xf3, 
-0xbd, 0xef, 0xbc, 0xf1, 0xaf, 0xf7, 0xba, 0x1, 0xaa, 0xf6, 0xad, 0xf5, 0xab, 0xf4, 0xa7, 0xc0, 
-0x0, 0xaf, 0x2a, 0x64, 0xae, 0x77, 0x23, 0x77, 0x23, 0x77, 0x23, 0x22, 0x66, 0xae, 0x18, 0x11, 
-0x3a, 0x21, 0xae, 0xb7, 0xc8, 0xc5, 0xd5, 0xe5, 0x1, 0x86, 0xe7, 0xcd, 0xb9, 0xe9, 0xe1, 0xd1, 
-0xc1, 0xaf, 0x32, 0x21, 0xae, 0xc9, 0xcd, 0xfd, 0xe9, 0xfe, 0x2, 0xd8, 0xfe, 0x1d, 0x20, 0xf6, 
-0x56, 0x2b, 0x5e, 0x2b, 0xe5, 0xeb, 0x23, 0x23, 0x23, 0x5e, 0x23, 0x56, 0xe1, 0x36, 0x1e, 0x23, 
-0x73, 0x23, 0x72, 0x18, 0xe1, 0x7e, 0xfe, 0x20, 0x20, 0x1, 0x23, 0xcd, 0x70, 0xe7, 0xcd, 0xa4, 
-0xdf, 0xe5, 0xcd, 0x4d, 0xde, 0xb7, 0x28, 0x28, 0xc5, 0xd5, 0x21, 0x4, 0x0, 0x9, 0xe5, 0xe5, 
-0xcd, 0x64, 0xe8, 0xe5, 0xdc, 0xe4, 0xe7, 0xd1, 0xc1, 0xcd, 0xb8, 0xf6, 0xcd, 0x7, 0xf6, 0xeb, 
-0xd1, 0x73, 0x23, 0x72, 0x23, 0xd1, 0x73, 0x23, 0x72, 0x23, 0xc1, 0xeb, 0xe1, 0xed, 0xb0, 0xc9, 
-0xe1, 0xcd, 0x5c, 0xe8, 0x78, 0xb1, 0xc8, 0xeb, 0xcd, 0xe5, 0xf6, 0xc3, 0x7, 0xf6, 0xcd, 0x0, 
-0xe8, 0xcd, 0x37, 0xde, 0xcd, 0x4d, 0xfb, 0xcd, 0x1a, 0xe8, 0xcd, 0x8f, 0xc1, 0xc3, 0x58, 0xc0, 
-0xcd, 0xf, 0xcf, 0xe5, 0xc5, 0xcd, 0x82, 0xe8, 0xd1, 0xe5, 0xcd, 0x64, 0xe8, 0x22, 0x22, 0xae, 
-0xeb, 0xe1, 0xb7, 0xed, 0x52, 0x22, 0x24, 0xae, 0xe1, 0xc9, 0xcd, 0x70, 0xe7, 0xed, 0x4b, 0x24, 
-0xae, 0x2a, 0x22, 0xae, 0xc3, 0xe4, 0xe7, 0x23, 0x5e, 0x23, 0x56, 0xfe, 0x1d, 0x28, 0x2a, 0xfe, 
-0x1e, 0xc2, 0x49, 0xcb, 0xe5, 0xcd, 0xb5, 0xde, 0xdc, 0xd8, 0xff, 0x30, 0xa, 0xe1, 0xe5, 0x23, 
-0xcd, 0xad, 0xe9, 0x23, 0xcd, 0x68, 0xe8, 0xd4, 0x5c, 0xe8, 0x2b, 0xeb, 0xe1, 0x2b, 0x2b, 0x3e, 
-0x1d, 0x32, 0x21, 0xae, 0x77, 0x23, 0x73, 0x23, 0x72, 0xc3, 0x2c, 0xde, 0xcd, 0x64, 0xe8, 0xd8, 
-0xcd, 0x45, 0xcb, 0x8, 0x2a, 0x64, 0xae, 0x23, 0x4e, 0x23, 0x46, 0x2b, 0x78, 0xb1, 0xc8, 0xe5, 
-0x23, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0xeb, 0xcd, 0xd8, 0xff, 0xeb, 0xe1, 0x3f, 0xd0, 0xc8, 0x9, 
-0x18, 0xe6, 0x2a, 0x64, 0xae, 0x23, 0xe5, 0x4e, 0x23, 0x46, 0x23, 0x78, 0xb1, 0x37, 0x28, 0x9, 
-0x7e, 0x23, 0x66, 0x6f, 0xeb, 0xcd, 0xd8, 0xff, 0xeb, 0xe1, 0xd8, 0x9, 0x18, 0xe8, 0x11, 0xa, 
-0x0, 0xc4, 0x1a, 0xe9, 0xd5, 0x11, 0x0, 0x0, 0xcd, 0x41, 0xde, 0xdc, 0x1a, 0xe9, 0xd5, 0x11, 
-0xa, 0x0, 0xcd, 0x41, 0xde, 0xdc, 0x48, 0xcf, 0xcd, 0x37, 0xde, 0xe1, 0xeb, 0xe3, 0xeb, 0xd5, 
-0xe5, 0xcd, 0x64, 0xe8, 0xd1, 0xe5, 0xcd, 0x64, 0xe8, 0xeb, 0xe1, 0xcd, 0xd8, 0xff, 0x38, 0x1d, 
-0xeb, 0xd1, 0xc1, 0xd5, 0xe5, 0xc5, 0x4e, 0x23, 0x46, 0x78, 0xb1, 0x28, 0x13, 0x2b, 0x9, 0x7e, 
-0x23, 0xb6, 0x28, 0xc, 0x2b, 0xc1, 0xe5, 0xeb, 0x9, 0xeb, 0xe1, 0x30, 0xe8, 0xc3, 0x4d, 0xcb, 
-0x1, 0x20, 0xe9, 0xcd, 0xb9, 0xe9, 0xc1, 0xe1, 0xd1, 0xc5, 0xe5, 0x4e, 0x23, 0x46, 0x23, 0x78, 
-0xb1, 0x28, 0xc, 0x73, 0x23, 0x72, 0x23, 0xe1, 0x9, 0xc1, 0xeb, 0x9, 0xeb, 0x18, 0xea, 0xe1, 
-0xe1, 0x1, 0x44, 0xe9, 0xcd, 0xb9, 0xe9, 0xc3, 0x58, 0xc0, 0xfe, 0x2c, 0xc4, 0x48, 0xcf, 0xc9, 
-0xcd, 0xfd, 0xe9, 0xfe, 0x2, 0xd8, 0xfe, 0x1e, 0x20, 0xf6, 0xe5, 0x56, 0x2b, 0x5e, 0xcd, 0x64, 
-0xe8, 0x30, 0xe, 0x2b, 0xeb, 0xe1, 0xe5, 0x72, 0x2b, 0x73, 0x2b, 0x3e, 0x1d, 0x77, 0x32, 0x21, 
-0xae, 0xe1, 0x18, 0xdc, 0xcd, 0xfd, 0xe9, 0xfe, 0x2, 0xd8, 0xfe, 0x1e, 0x20, 0xf6, 0xe5, 0x56, 
-0x2b, 0x5e, 0xcd, 0xb5, 0xde, 0xcd, 0xe6, 0xcb, 0xe1, 0x18, 0xe9, 0x6, 0x0, 0x2b, 0x4, 0xcd, 
-0xfd, 0xe9, 0xfe, 0xa1, 0x28, 0xf8, 0xfe, 0x2, 0x30, 0xf5, 0xb7, 0xc8, 0xcd, 0xfd, 0xe9, 0xfe, 
-0x97, 0x20, 0xef, 0x10, 0xea, 0xcd, 0x2c, 0xde, 0x4, 0xc9, 0x7e, 0xfe, 0x5b, 0x28, 0x3, 0xfe, 
-0x28, 0xc0, 0x6, 0x0, 0x4, 0xcd, 0xfd, 0xe9, 0xfe, 0x5b, 0x28, 0xf8, 0xfe, 0x28, 0x28, 0xf4, 
-0xfe, 0x5d, 0x28, 0xb, 0xfe, 0x29, 0x28, 0x7, 0xfe, 0x2, 0x30, 0xe9, 0xc3, 0x49, 0xcb, 0x10, 
-0xe4, 0x23, 0xc9, 0x6, 0x1, 0x18, 0x8, 0x7e, 0xb7, 0xc8, 0x23, 0x18, 0xfa, 0x6, 0x0, 0x2b, 
-0xcd, 0xfd, 0xe9, 0xb7, 0xc8, 0xb8, 0x20, 0xf8, 0xc9, 0xcd, 0xb1, 0xde, 0xe5, 0x2a, 0x64, 0xae, 
-0x23, 0x7e, 0x23, 0xb6, 0x28, 0x13, 0x23, 0xcd, 0xad, 0xde, 0x23, 0xc5, 0xcd, 0xfc, 0xff, 0xc1, 
-0x2b, 0xcd, 0xef, 0xe9, 0xb7, 0x20, 0xf4, 0x18, 0xe7, 0xe1, 0xc3, 0xad, 0xde, 0xcd, 0xef, 0xe9, 
-0xb7, 0xc0, 0x23, 0x7e, 0x23, 0xb6, 0x79, 0xca, 0x55, 0xcb, 0x23, 0x54, 0x5d, 0x23, 0xc9, 0xcd, 
-0xfd, 0xe9, 0xfe, 0x2, 0xd8, 0xfe, 0x97, 0xc8, 0xfe, 0xeb, 0x20, 0xf3, 0xc9, 0xcd, 0x2c, 0xde, 
-0xc8, 0xfe, 0xe, 0x38, 0x25, 0xfe, 0x20, 0x38, 0x2b, 0xfe, 0x22, 0x28, 0x11, 0xfe, 0x7c, 0x28, 
-0x1b, 0xfe, 0xc0, 0x28, 0x30, 0xfe, 0xc5, 0x28, 0x2c, 0xfe, 0xff, 0xc0, 0x23, 0xc9, 0x23, 0x7e, 
-0xfe, 0x22, 0xc8, 0xb7, 0x20, 0xf8, 0x2b, 0x3e, 0x22, 0xc9, 0x23, 0x23, 0xf5, 0x23, 0x7e, 0x17, 
-0x30, 0xfb, 0xf1, 0xc9, 0xfe, 0x18, 0xd8, 0xfe, 0x19, 0x28, 0x8, 0xfe, 0x1f, 0x38, 0x3, 0x23, 
-0x23, 0x23, 0x23, 0x23, 0xc9, 0xf5, 0x23, 0xcd, 0xa7, 0xe9, 0xf1, 0x2b, 0xc9, 0xc5, 0xd5, 0xe5, 
-0x1, 0x5a, 0xea, 0xcd, 0xb9, 0xe9, 0xe1, 0xd1, 0xc1, 0xc9, 0xe5, 0xcd, 0xfd, 0xe9, 0xd1, 0xfe, 
-0x2, 0xd8, 0xfe, 0xe, 0x30, 0xf4, 0xeb, 0xcd, 0x2c, 0xde, 0xfe, 0xd, 0x38, 0x2, 0x36, 0xd, 
-0x23, 0xaf, 0x77, 0x23, 0x77, 0xeb, 0x18, 0xe2, 0xcd, 0x3d, 0xde, 0xed, 0x5b, 0x64, 0xae, 0x38, 
-0x1d, 0xfe, 0x1e, 0x28, 0x15, 0xfe, 0x1d, 0x28, 0x11, 0xcd, 0xd1, 0xea, 0x21, 0xf1, 0xea, 0xd2, 
-0x13, 0xbd, 0xcd, 0x6d, 0xec, 0x2a, 0x64, 0xae, 0x18, 0x12, 0xcd, 0x27, 0xe8, 0xc0, 0xd5, 0xcd, 
-0x0, 0xd3, 0xcd, 0x78, 0xc1, 0xcd, 0x8f, 0xc1, 0xcd, 0x62, 0xc1, 0xe1, 0xe3, 0xcd, 0x43, 0xbd, 
-0xe1, 0x23, 0xc3, 0x77, 0xde, 0xcd, 0xd1, 0xea, 0x30, 0x6, 0xcd, 0x6d, 0xec, 0xc3, 0x58, 0xc0, 
-0xe5, 0xcd, 0xab, 0xf5, 0x2a, 0x26, 0xae, 0xcd, 0x83, 0xbc, 0xca, 0x37, 0xcc, 0xe1, 0xc3, 0xed, 
-0xd2, 0xcd, 0x54, 0xec, 0xe6, 0xe, 0xee, 0x2, 0x28, 0x8, 0xcd, 0x37, 0xde, 0xcd, 0x6f, 0xc1, 
-0x37, 0xc9, 0xcd, 0x41, 0xde, 0xdc, 0xf5, 0xce, 0xed, 0x53, 0x26, 0xae, 0xcd, 0x37, 0xde, 0xb7, 
-0xc9, 0x2a, 0x26, 0xae, 0xcd, 0x83, 0xbc, 0xe5, 0xdc, 0x7a, 0xbc, 0xe1, 0xc9, 0xee, 0xab, 0x32, 
-0x28, 0xae, 0xcc, 0x2c, 0xde, 0xcd, 0x54, 0xec, 0x11, 0x0, 0x0, 0xcd, 0x41, 0xde, 0x30, 0x6, 
-0x7e, 0xfe, 0x2c, 0xc4, 0xf5, 0xce, 0xd5, 0xcd, 0x41, 0xde, 0x30, 0x8, 0xcd, 0x25, 0xde, 0x92, 
-0xcd, 0x0, 0xe8, 0x37, 0xf5, 0xcd, 0x37, 0xde, 0xcd, 0x4d, 0xfb, 0xcd, 0x64, 0xfc, 0xcd, 0xe, 
-0xd6, 0xf1, 0xdc, 0x1a, 0xe8, 0xcd, 0x47, 0xeb, 0xd1, 0x2a, 0x64, 0xae, 0x7a, 0xb3, 0xc8, 0xcd, 
-0xaa, 0xde, 0xcd, 0x5c, 0xe8, 0x2b, 0xc9, 0x3a, 0x28, 0xae, 0xb7, 0xca, 0x62, 0xec, 0xcd, 0x89, 
-0xc1, 0xc3, 0x6d, 0xec, 0xcd, 0x54, 0xec, 0xcd, 0x37, 0xde, 0xcd, 0x78, 0xc1, 0xcd, 0x62, 0xec, 
-0xc3, 0x58, 0xc0, 0xcd, 0x8f, 0xc1, 0xcd, 0x70, 0xe7, 0xcd, 0x29, 0xf6, 0x2a, 0x66, 0xae, 0xeb, 
-0x2a, 0x64, 0xae, 0x23, 0x22, 0x66, 0xae, 0xeb, 0xcd, 0xe4, 0xff, 0xeb, 0xcd, 0x7, 0xf7, 0xeb, 
-0x2b, 0xed, 0xb8, 0x13, 0xeb, 0xcd, 0x4b, 0xec, 0x30, 0x4a, 0xb3, 0x28, 0x4c, 0xd5, 0xcd, 0x4b, 
-0xec, 0x30, 0x41, 0x7e, 0x23, 0xb6, 0x2b, 0x28, 0x1b, 0xe5, 0x23, 0x23, 0x7e, 0x23, 0x66, 0x6f, 
-0xcd, 0xd8, 0xff, 0xe1, 0x28, 0x7, 0x30, 0xc, 0xcd, 0x19, 0xec, 0x18, 0xe6, 0xd5, 0x5e, 0x23, 
-0x56, 0x2b, 0x19, 0xd1, 0xe5, 0x2a, 0x66, 0xae, 0x23, 0x23, 0x73, 0x23, 0x72, 0x11, 0x1d, 0x0, 
-0x19, 0xeb, 0xe1, 0xe3, 0xeb, 0x19, 0xeb, 0xe3, 0xcd, 0xd8, 0xff, 0x38, 0x25, 0xe3, 0xcd, 0x2c, 
-0xec, 0xe1, 0x38, 0xb1, 0xcd, 0xd9, 0xeb, 0x18, 0x36, 0x7e, 0x23, 0xb6, 0x2b, 0x28, 0x5, 0xcd, 
-0x19, 0xec, 0x18, 0xf5, 0x2a, 0x66, 0xae, 0xaf, 0x77, 0x23, 0x77, 0x23, 0x22, 0x66, 0xae, 0xc3, 
-0xb0, 0xec, 0xcd, 0xd9, 0xeb, 0xcd, 0xaa, 0xde, 0x3e, 0x7, 0x18, 0x15, 0xcd, 0x80, 0xbc, 0xd8, 
-0xfe, 0x1a, 0x37, 0xc8, 0x32, 0x91, 0xad, 0x3f, 0xc9, 0x32, 0x91, 0xad, 0xcd, 0x6f, 0xc1, 0x3e, 
-0x18, 0xf5, 0xcd, 0x0, 0xd3, 0xf1, 0xc3, 0x55, 0xcb, 0xc5, 0xd5, 0x4e, 0x23, 0x46, 0x2b, 0xed, 
-0x5b, 0x66, 0xae, 0xed, 0xb0, 0xed, 0x53, 0x66, 0xae, 0xd1, 0xc1, 0xc9, 0xeb, 0x2a, 0x66, 0xae, 
-0x73, 0x23, 0x72, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x1b, 0x7a, 0xb3, 0x28, 0x8, 0xcd, 0xfc, 
-0xeb, 0x77, 0x23, 0x38, 0xf4, 0xc9, 0x22, 0x66, 0xae, 0x37, 0xc9, 0xcd, 0xfc, 0xeb, 0x5f, 0xdc, 
-0xfc, 0xeb, 0x57, 0xc9, 0xcd, 0x0, 0xd3, 0xcd, 0xbe, 0xd2, 0x32, 0x29, 0xae, 0xed, 0x43, 0x2a, 
-0xae, 0xc9, 0x3a, 0x29, 0xae, 0xb7, 0xca, 0x63, 0xeb, 0xfe, 0x16, 0x20, 0xb, 0x3a, 0x29, 0xae, 
-0xfe, 0x16, 0x28, 0x42, 0xe6, 0xfe, 0x28, 0x4, 0xcd, 0x45, 0xcb, 0x19, 0xcd, 0x8f, 0xc1, 0xcd, 
-0x29, 0xf6, 0xed, 0x4b, 0x64, 0xae, 0x3, 0xcd, 0x7, 0xf7, 0x11, 0x80, 0xff, 0x19, 0xb7, 0xed, 
-0x42, 0xed, 0x5b, 0x2a, 0xae, 0xd4, 0xd8, 0xff, 0xda, 0xf5, 0xeb, 0xeb, 0x9, 0x22, 0x66, 0xae, 
-0x3a, 0x29, 0xae, 0x1f, 0x9f, 0x32, 0x2c, 0xae, 0x60, 0x69, 0xcd, 0x83, 0xbc, 0xca, 0x9, 0xec, 
-0xcd, 0x3c, 0xf6, 0xc3, 0xed, 0xd2, 0xcd, 0x8f, 0xc1, 0xcd, 0xaa, 0xde, 0xcd, 0x29, 0xf6, 0xcd, 
-0xa, 0xcb, 0x30, 0xec, 0xcd, 0x4d, 0xde, 0xb7, 0xc4, 0xcd, 0xec, 0x18, 0xf2, 0xcd, 0xcf, 0xee, 
-0xda, 0xa5, 0xe7, 0x3e, 0x15, 0x28, 0x2, 0x3e, 0x6, 0xc3, 0x55, 0xcb, 0xcd, 0x0, 0xd3, 0xcd, 
-0xa8, 0xd2, 0x6, 0x0, 0xcd, 0x41, 0xde, 0x30, 0x25, 0xcd, 0x25, 0xde, 0xd, 0x23, 0x23, 0x7e, 
-0xe6, 0xdf, 0xf2, 0x49, 0xcb, 0xe5, 0x21, 0x0, 0xed, 0xcd, 0xb4, 0xff, 0xe3, 0xc3, 0x2c, 0xde, 
-0x3, 0x49, 0xcb, 0xc1, 0x53, 0xed, 0xc2, 0x2b, 0xed, 0xd0, 0xc, 0xed, 0x6, 0x1, 0xcd, 0x37, 
-0xde, 0xe5, 0xc5, 0xcd, 0x70, 0xe7, 0xcd, 0x4d, 0xea, 0x2a, 0x64, 0xae, 0x23, 0xeb, 0x2a, 0x66, 
-0xae, 0xb7, 0xed, 0x52, 0xeb, 0xf1, 0x1, 0x0, 0x0, 0x18, 0x20, 0xcd, 0x15, 0xde, 0xcd, 0xf5, 
-0xce, 0xd5, 0xcd, 0x15, 0xde, 0xcd, 0xf5, 0xce, 0xd5, 0xcd, 0x41, 0xde, 0x11, 0x0, 0x0, 0xdc, 
-0xf5, 0xce, 0xd5, 0xcd, 0x37, 0xde, 0x3e, 0x2, 0xc1, 0xd1, 0xe3, 0xcd, 0x98, 0xbc, 0xd2, 0x37, 
-0xcc, 0x18, 0x17, 0xcd, 0x37, 0xde, 0xe5, 0x3e, 0x9, 0xcd, 0xa6, 0xc1, 0xf5, 0x1, 0x1, 0x0, 
-0x11, 0xff, 0xff, 0xcd, 0xe3, 0xe1, 0xf1, 0xcd, 0xa6, 0xc1, 0xcd, 0xf5, 0xd2, 0xe1, 0xc9, 0xcd, 
-0xf, 0xee, 0x20, 0x5, 0xcd, 0x4d, 0xde, 0x18, 0x2f, 0xfe, 0x26, 0x28, 0x1c, 0xcd, 0xa0, 0xff, 
-0x38, 0x26, 0xcd, 0x38, 0xff, 0xcd, 0x1b, 0xff, 0x37, 0xc9, 0xe5, 0xcd, 0x92, 0xed, 0xd1, 0xd8, 
-0xeb, 0xc9, 0x16, 0x0, 0x7e, 0xfe, 0x26, 0x20, 0xf, 0xcd, 0xe7, 0xee, 0xeb, 0xf5, 0xcd, 0x35, 
-0xff, 0xf1, 0xeb, 0xd8, 0xc8, 0xc3, 0xbe, 0xcb, 0xe5, 0x7e, 0x23, 0xfe, 0x2e, 0xcc, 0x4d, 0xde, 
-0xcd, 0xa4, 0xff, 0xe1, 0x38, 0x6, 0x7e, 0xee, 0x2e, 0xc0, 0x23, 0xc9, 0xcd, 0x38, 0xff, 0xd5, 
-0x1, 0x0, 0x0, 0x11, 0x2d, 0xae, 0xcd, 0x1e, 0xee, 0xfe, 0x2e, 0x20, 0xb, 0xcd, 0x94, 0xee, 
-0xcd, 0x41, 0xff, 0xc, 0xcd, 0x1e, 0xee, 0xd, 0xeb, 0x36, 0xff, 0xeb, 0xcd, 0x42, 0xee, 0xd1, 
-0x5f, 0xe5, 0xd5, 0x21, 0x2d, 0xae, 0xcd, 0x99, 0xee, 0xd1, 0xcd, 0x66, 0xff, 0x30, 0x8, 0xe5, 
-0x42, 0xcd, 0x2c, 0xfe, 0xe1, 0x38, 0x11, 0x7a, 0x4e, 0x23, 0xcd, 0xb8, 0xbd, 0x7b, 0xcd, 0x79, 
-0xbd, 0xeb, 0xcd, 0x3e, 0xff, 0xdc, 0x61, 0xbd, 0x3e, 0xa, 0xe1, 0xd8, 0xc3, 0xbe, 0xcb, 0xcd, 
-0x4d, 0xde, 0x23, 0x16, 0xff, 0xfe, 0x2d, 0xc8, 0x14, 0xfe, 0x2b, 0xc8, 0x2b, 0xc9, 0xe5, 0xcd, 
-0x4d, 0xde, 0x23, 0xcd, 0xa4, 0xff, 0x38, 0x4, 0xe1, 0xc3, 0xab, 0xff, 0xe3, 0xe1, 0xd6, 0x30, 
-0x12, 0xb0, 0x28, 0x7, 0x78, 0x4, 0xfe, 0xc, 0x30, 0x1, 0x13, 0x79, 0xb7, 0x28, 0xdf, 0xc, 
-0x18, 0xdc, 0xfe, 0x45, 0x20, 0x10, 0xe5, 0xcd, 0x94, 0xee, 0xcd, 0xf, 0xee, 0xcc, 0x4d, 0xde, 
-0xcd, 0xa4, 0xff, 0x38, 0x4, 0xe1, 0xaf, 0x18, 0x1e, 0xe3, 0xe1, 0xcd, 0x41, 0xff, 0xd5, 0xc5, 
-0xcd, 0x0, 0xef, 0x30, 0x9, 0x7b, 0xd6, 0x64, 0x7a, 0xde, 0x0, 0x7b, 0x38, 0x2, 0x3e, 0x7f, 
-0xc1, 0xd1, 0x14, 0x20, 0x2, 0x2f, 0x3c, 0xc6, 0x80, 0x5f, 0x78, 0xd6, 0xc, 0x30, 0x1, 0xaf, 
-0x91, 0x30, 0x9, 0x83, 0x38, 0x1, 0xaf, 0xfe, 0x1, 0xce, 0x80, 0xc9, 0x83, 0x30, 0x2, 0x3e, 
-0xff, 0xd6, 0x80, 0xc9, 0xcd, 0x4d, 0xde, 0x23, 0xc9, 0xeb, 0x21, 0x3f, 0xae, 0x1, 0x1, 0x5, 
-0x2b, 0x36, 0x0, 0x10, 0xfb, 0x1a, 0xfe, 0xff, 0xc8, 0x77, 0x21, 0x3a, 0xae, 0x13, 0x1a, 0xfe, 
-0xff, 0xc8, 0xd5, 0x41, 0x16, 0x0, 0xe5, 0x5e, 0x62, 0x6b, 0x29, 0x29, 0x19, 0x29, 0x5f, 0x19, 
-0x5d, 0x7c, 0xe1, 0x73, 0x23, 0x10, 0xef, 0xd1, 0xb7, 0x28, 0xdf, 0x77, 0xc, 0x18, 0xdb, 0xc5, 
-0xe5, 0xcd, 0x0, 0xef, 0xeb, 0xcd, 0x35, 0xff, 0xeb, 0xc1, 0x30, 0x6, 0x7a, 0xb3, 0xc6, 0xff, 
-0x38, 0x3, 0x50, 0x59, 0xeb, 0xc1, 0xc9, 0x23, 0xcd, 0x4d, 0xde, 0xcd, 0xab, 0xff, 0x6, 0x2, 
-0xfe, 0x58, 0x28, 0x6, 0x6, 0x10, 0xfe, 0x48, 0x20, 0x4, 0x23, 0xcd, 0x4d, 0xde, 0x18, 0x2, 
-0x6, 0xa, 0xeb, 0xcd, 0x2c, 0xef, 0x26, 0x0, 0x6f, 0x30, 0x1e, 0xe, 0x0, 0xcd, 0x2c, 0xef, 
-0x30, 0x14, 0xd5, 0x16, 0x0, 0x5f, 0xd5, 0x58, 0xcd, 0x72, 0xdd, 0xd1, 0x38, 0x3, 0x19, 0x30, 
-0x2, 0xe, 0xff, 0xd1, 0x18, 0xe7, 0x79, 0xfe, 0x1, 0xeb, 0x78, 0xc9, 0x1a, 0x13, 0xcd, 0xa4, 
-0xff, 0x38, 0xa, 0xcd, 0xab, 0xff, 0xfe, 0x41, 0x3f, 0x30, 0x5, 0xd6, 0x7, 0xd6, 0x30, 0xb8, 
-0xd8, 0x1b, 0xaf, 0xc9, 0xcd, 0x4a, 0xef, 0xc3, 0x8b, 0xc3, 0xd5, 0xc5, 0xcd, 0x35, 0xff, 0xcd, 
-0x3, 0xfd, 0xaf, 0xcd, 0x72, 0xef, 0x23, 0xc1, 0xd1, 0xc9, 0xd5, 0xc5, 0xaf, 0xcd, 0x6a, 0xef, 
-0xc1, 0xd1, 0x7e, 0xfe, 0x20, 0xc0, 0x23, 0xc9, 0x3e, 0x40, 0x22, 0x52, 0xae, 0xf5, 0xcd, 0xf3, 
-0xfc, 0xf1, 0xc5, 0x57, 0xd5, 0xcd, 0x8a, 0xf1, 0xd1, 0xcd, 0x96, 0xef, 0xcd, 0x1a, 0xf1, 0xf1, 
-0x5f, 0x78, 0xb7, 0xcc, 0x2c, 0xf1, 0xcd, 0x45, 0xf1, 0xcd, 0x4f, 0xf1, 0xcd, 0x6f, 0xf1, 0x7a, 
-0x1f, 0xd0, 0x2b, 0x36, 0x25, 0xc9, 0x7a, 0x87, 0x30, 0x2d, 0xfa, 0xed, 0xef, 0x7b, 0x81, 0xd6, 
-0x15, 0xfa, 0x56, 0xf0, 0x7a, 0xf6, 0x41, 0x57, 0x18, 0x43, 0x41, 0x79, 0xb7, 0x28, 0x15, 0x83, 
-0x3d, 0x5f, 0xcd, 0xde, 0xf0, 0x6, 0x1, 0x79, 0xfe, 0x7, 0x38, 0x4, 0xcb, 0x72, 0x20, 0x26, 
-0xb8, 0xc4, 0x74, 0xf0, 0xc3, 0x32, 0xf0, 0x7b, 0xb7, 0xfa, 0xd0, 0xef, 0x20, 0xdc, 0x41, 0xc9, 
-0x43, 0xcd, 0xde, 0xf0, 0x78, 0xb7, 0x28, 0xf6, 0x93, 0x58, 0x47, 0x81, 0x83, 0xfa, 0xaa, 0xef, 
-0xcd, 0x87, 0xf0, 0xc3, 0x74, 0xf0, 0x3e, 0x6, 0x32, 0x52, 0xae, 0x18, 0x2e, 0xcd, 0xfb, 0xf0, 
-0x30, 0x3, 0xcb, 0xc2, 0xaf, 0x47, 0xcc, 0x13, 0xf1, 0x20, 0xe, 0xcb, 0xc2, 0x4, 0x3a, 0x52, 
-0xae, 0xb7, 0x28, 0x5, 0x5, 0x3c, 0x32, 0x52, 0xae, 0xcb, 0x4a, 0x28, 0x7, 0x78, 0x4, 0x5, 
-0xd6, 0x4, 0x30, 0xfb, 0x79, 0xb7, 0x28, 0x4, 0x83, 0x90, 0x5f, 0x78, 0xf5, 0x47, 0xcd, 0x59, 
-0xf0, 0xf1, 0xb8, 0x28, 0xd, 0x1c, 0x23, 0x5, 0xe5, 0x7e, 0xfe, 0x2e, 0x20, 0x1, 0x23, 0x36, 
-0x31, 0xe1, 0x3e, 0x4, 0xcd, 0xc2, 0xf0, 0xe5, 0x21, 0x45, 0x2b, 0x7b, 0xb7, 0xf2, 0x44, 0xf0, 
-0xaf, 0x93, 0x26, 0x2d, 0x22, 0x4c, 0xae, 0x2e, 0x2f, 0x2c, 0xd6, 0xa, 0x30, 0xfb, 0xc6, 0x3a, 
-0x67, 0x22, 0x4e, 0xae, 0xe1, 0xc9, 0xcd, 0x87, 0xf0, 0xcd, 0x13, 0xf1, 0x80, 0xb9, 0x30, 0x5, 
-0xcd, 0x9a, 0xf0, 0x18, 0xa, 0xfe, 0x15, 0x38, 0x2, 0x3e, 0x14, 0x91, 0xc4, 0xc2, 0xf0, 0x3a, 
-0x52, 0xae, 0xb7, 0xc8, 0xe, 0x2e, 0x78, 0xc5, 0x47, 0x4, 0x85, 0x6f, 0x8c, 0x95, 0x67, 0x2b, 
-0x79, 0x4e, 0x77, 0x10, 0xfa, 0xc1, 0xc9, 0x7b, 0x81, 0x47, 0xf0, 0x2f, 0x3c, 0x6, 0x14, 0xb8, 
-0x30, 0x1, 0x47, 0x2b, 0x36, 0x30, 0xc, 0x10, 0xfa, 0xc9, 0x4f, 0x85, 0x6f, 0x8c, 0x95, 0x67, 
-0xe5, 0xc5, 0x7e, 0xfe, 0x35, 0xd4, 0xb4, 0xf0, 0xc1, 0x38, 0x5, 0x2b, 0x36, 0x31, 0x4, 0xc, 
-0xe1, 0x2b, 0x18, 0x38, 0x79, 0xb7, 0xc8, 0x2b, 0xd, 0x7e, 0x34, 0xfe, 0x39, 0xd8, 0x36, 0x30, 
-0x18, 0xf2, 0xd5, 0xc5, 0xeb, 0x47, 0x7b, 0x90, 0x6f, 0x9f, 0x82, 0x67, 0xe5, 0x1a, 0x13, 0x77, 
-0x23, 0xb7, 0x20, 0xf9, 0x2b, 0x36, 0x30, 0x23, 0x10, 0xfb, 0xe1, 0xc1, 0xd1, 0xc9, 0x21, 0x50, 
-0xae, 0x2b, 0x7e, 0xfe, 0x30, 0x20, 0x5, 0xd, 0x4, 0x20, 0xf6, 0x2b, 0xd5, 0xc5, 0x11, 0x4f, 
-0xae, 0x6, 0x0, 0xcd, 0xf5, 0xff, 0xeb, 0x23, 0xc1, 0xd1, 0xc9, 0xc5, 0x7a, 0xe6, 0x4, 0x1f, 
-0x1f, 0x47, 0xcb, 0x62, 0x20, 0x7, 0x7a, 0x87, 0xb3, 0xf2, 0xd, 0xf1, 0x4, 0x3a, 0x53, 0xae, 
-0x90, 0xc1, 0xc9, 0x3a, 0x52, 0xae, 0xb7, 0xc8, 0x3d, 0xc9, 0xcb, 0x4a, 0xc8, 0x78, 0xd6, 0x3, 
-0xd8, 0xc8, 0xf5, 0xe, 0x2c, 0xcd, 0x77, 0xf0, 0x4, 0xf1, 0x18, 0xf2, 0xe5, 0x7e, 0x23, 0x3d, 
-0xfe, 0x30, 0x38, 0xf9, 0x3c, 0x20, 0x1, 0x5f, 0xe1, 0x7a, 0xee, 0x80, 0xf4, 0xfb, 0xf0, 0xd8, 
-0xc8, 0x3e, 0x30, 0x18, 0x6, 0xcb, 0x52, 0xc8, 0x3a, 0x54, 0xae, 0x4, 0x2b, 0x77, 0xc9, 0x7b, 
-0x87, 0x3e, 0x2d, 0x38, 0xe, 0x7a, 0xe6, 0x98, 0xee, 0x80, 0xc8, 0xe6, 0x8, 0x3e, 0x2b, 0x20, 
-0x2, 0x3e, 0x20, 0xcb, 0x62, 0x28, 0xe4, 0x32, 0x50, 0xae, 0xaf, 0x32, 0x51, 0xae, 0xc9, 0x7a, 
-0xb7, 0xf0, 0x3a, 0x53, 0xae, 0x90, 0xc8, 0x38, 0xe, 0x47, 0xcb, 0x6a, 0x3e, 0x2a, 0x20, 0x2, 
-0x3e, 0x20, 0x2b, 0x77, 0x10, 0xfc, 0xc9, 0xcb, 0xc2, 0xc9, 0x11, 0x2d, 0xae, 0xaf, 0x47, 0xb6, 
-0x2b, 0x20, 0x5, 0xd, 0x20, 0xf9, 0x18, 0x28, 0x37, 0x8f, 0x30, 0xfd, 0xeb, 0xd5, 0x57, 0x18, 
-0x11, 0x1a, 0x1b, 0xd5, 0x37, 0x8f, 0x57, 0x58, 0x7e, 0x8f, 0x27, 0x77, 0x23, 0x1d, 0x20, 0xf8, 
-0x30, 0x3, 0x4, 0x36, 0x1, 0x21, 0x2d, 0xae, 0x7a, 0x87, 0x20, 0xea, 0xd1, 0xd, 0x20, 0xe1, 
-0xeb, 0x21, 0x50, 0xae, 0x36, 0x0, 0x78, 0x87, 0x4f, 0xc8, 0x3e, 0x30, 0xeb, 0xed, 0x67, 0x1b, 
-0x12, 0xed, 0x67, 0x1b, 0x12, 0x23, 0x10, 0xf5, 0xeb, 0xfe, 0x30, 0xc0, 0xd, 0x23, 0xc9, 0xd5, 
-0xeb, 0x21, 0x3e, 0xae, 0x36, 0x0, 0x3d, 0xf5, 0x7b, 0xa1, 0xf6, 0xf0, 0x27, 0xc6, 0xa0, 0xce, 
-0x40, 0x2b, 0x77, 0x78, 0xcb, 0x3a, 0xcb, 0x1b, 0x10, 0xfa, 0x47, 0xf1, 0x3d, 0xf2, 0xe7, 0xf1, 
-0x7a, 0xb3, 0x3e, 0x0, 0x20, 0xe1, 0xd1, 0xc9, 0xcd, 0xeb, 0xfe, 0xe7, 0xc3, 0x32, 0xff, 0xcd, 
-0xf5, 0xce, 0xd5, 0xcd, 0x3f, 0xf2, 0xd1, 0x12, 0xc9, 0xcd, 0xb6, 0xfe, 0x44, 0x4d, 0xed, 0x78, 
-0xc3, 0x32, 0xff, 0xcd, 0x3a, 0xf2, 0xed, 0x79, 0xc9, 0xcd, 0x3a, 0xf2, 0x57, 0x3e, 0x0, 0xc4, 
-0x3f, 0xf2, 0x5f, 0xed, 0x78, 0xab, 0xa2, 0x28, 0xfa, 0xc9, 0xcd, 0xf5, 0xce, 0x42, 0x4b, 0xcd, 
-0x15, 0xde, 0xc3, 0xb8, 0xce, 0x23, 0x7e, 0xb7, 0x23, 0xe5, 0xcc, 0xd4, 0xbc, 0xeb, 0xe1, 0x30, 
-0x7, 0x7e, 0x23, 0x17, 0x30, 0xfb, 0x18, 0x9, 0xcd, 0x45, 0xcb, 0x1c, 0xcd, 0xf5, 0xce, 0xe, 
-0xff, 0xed, 0x53, 0x55, 0xae, 0x79, 0x32, 0x57, 0xae, 0xed, 0x73, 0x5a, 0xae, 0x6, 0x20, 0xcd, 
-0x41, 0xde, 0x30, 0x8, 0xc5, 0xcd, 0xe3, 0xce, 0xc1, 0xd5, 0x10, 0xf3, 0xcd, 0x37, 0xde, 0x22, 
-0x58, 0xae, 0x3e, 0x20, 0x90, 0xdd, 0x21, 0x0, 0x0, 0xdd, 0x39, 0xdf, 0x55, 0xae, 0xed, 0x7b, 
-0x5a, 0xae, 0xcd, 0xcc, 0xfb, 0x2a, 0x58, 0xae, 0xc9, 0x3e, 0xd, 0x18, 0x3, 0xcd, 0xc3, 0xce, 
-0x32, 0x5c, 0xae, 0xc9, 0xcd, 0xcf, 0xc1, 0xcd, 0x3d, 0xde, 0xda, 0x98, 0xc3, 0xfe, 0xed, 0xca, 
-0x7e, 0xf3, 0xeb, 0x21, 0xc3, 0xf2, 0xcd, 0xb4, 0xff, 0xeb, 0xcd, 0xfe, 0xff, 0xcd, 0x3d, 0xde, 
-0x30, 0xeb, 0xc9, 0x4, 0xd2, 0xf2, 0x2c, 0x19, 0xf3, 0xe5, 0x34, 0xf3, 0xea, 0x3d, 0xf3, 0x3b, 
-0x2c, 0xde, 0xcd, 0x62, 0xcf, 0xf5, 0xe5, 0xcd, 0x66, 0xff, 0x28, 0xf, 0xcd, 0x68, 0xef, 0xcd, 
-0x8a, 0xf8, 0x36, 0x20, 0x2a, 0xa0, 0xb0, 0x34, 0x7e, 0x18, 0x1f, 0x2a, 0xa0, 0xb0, 0x46, 0xe, 
-0x0, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0x4, 0x18, 0xe, 0x7e, 0xfe, 0x20, 0x23, 0x30, 0x7, 0x3d, 
-0x20, 0x7, 0x5, 0x28, 0x4, 0x23, 0xc, 0x10, 0xf0, 0x79, 0xcd, 0xe7, 0xc2, 0xd4, 0x98, 0xc3, 
-0xcd, 0xd0, 0xf8, 0xe1, 0xf1, 0xcc, 0x98, 0xc3, 0xc9, 0xcd, 0x2c, 0xde, 0x3a, 0x5c, 0xae, 0x4f, 
-0xcd, 0xb9, 0xc2, 0x3d, 0x91, 0x30, 0xfd, 0x2f, 0x3c, 0x47, 0x81, 0xcd, 0xe7, 0xc2, 0xd2, 0x98, 
-0xc3, 0x78, 0x18, 0x1e, 0xcd, 0x5d, 0xf3, 0xcd, 0x69, 0xf3, 0x7b, 0x18, 0x15, 0xcd, 0x5d, 0xf3, 
-0x1b, 0xcd, 0x69, 0xf3, 0xcd, 0xb9, 0xc2, 0x2f, 0x3c, 0x1c, 0x83, 0x38, 0x5, 0xcd, 0x98, 0xc3, 
-0x1d, 0x7b, 0x47, 0x4, 0x5, 0xc8, 0x3e, 0x20, 0xcd, 0xa0, 0xc3, 0x18, 0xf7, 0xcd, 0x2c, 0xde, 
-0xcd, 0x19, 0xde, 0xcd, 0xd8, 0xce, 0xc3, 0x1d, 0xde, 0x7a, 0x17, 0x30, 0x3, 0x11, 0x0, 0x0, 
-0xcd, 0xcf, 0xc2, 0xd0, 0xe5, 0xeb, 0x5f, 0x16, 0x0, 0xcd, 0xae, 0xdd, 0xe1, 0xc9, 0xcd, 0x2c, 
-0xde, 0xcd, 0x9, 0xcf, 0xcd, 0x25, 0xde, 0x3b, 0xe5, 0x2a, 0xa0, 0xb0, 0xe3, 0xcd, 0x62, 0xcf, 
-0xaf, 0x32, 0x5d, 0xae, 0xd1, 0xd5, 0xeb, 0x46, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0xeb, 0xcd, 0xcd, 
-0xf3, 0xd2, 0xab, 0xf4, 0xcd, 0x3d, 0xde, 0x38, 0x11, 0xcd, 0xef, 0xf3, 0x28, 0xc, 0xd5, 0xcd, 
-0x62, 0xcf, 0xd1, 0xcd, 0xcd, 0xf3, 0x30, 0xdc, 0x18, 0xea, 0xf5, 0x3e, 0xff, 0x32, 0x5d, 0xae, 
-0xcd, 0xcd, 0xf3, 0xf1, 0xdc, 0x98, 0xc3, 0xe3, 0xcd, 0x3, 0xfc, 0xe1, 0xc9, 0x78, 0xb7, 0xc8, 
-0xe5, 0x1a, 0xfe, 0x5f, 0x20, 0x7, 0x13, 0x10, 0xc, 0x4, 0x1b, 0x18, 0x8, 0xcd, 0xf7, 0xf3, 
-0xd4, 0x31, 0xf4, 0x38, 0x8, 0x1a, 0xcd, 0xa0, 0xc3, 0x13, 0x10, 0xe5, 0xb7, 0xe1, 0xc9, 0xfe, 
-0x3b, 0xca, 0x2c, 0xde, 0xc3, 0x15, 0xde, 0x1a, 0xe, 0x0, 0xfe, 0x26, 0x28, 0x1e, 0xc, 0xfe, 
-0x21, 0x28, 0x19, 0xee, 0x5c, 0xc0, 0xc5, 0xd5, 0x13, 0x5, 0x28, 0xa, 0xc, 0x1a, 0xfe, 0x5c, 
-0x28, 0x8, 0xfe, 0x20, 0x28, 0xf2, 0xd1, 0xc1, 0xb7, 0xc9, 0xf1, 0xf1, 0x13, 0x5, 0xc5, 0xd5, 
-0x3a, 0x5d, 0xae, 0xb7, 0x20, 0x7, 0xcd, 0xdc, 0xf8, 0x79, 0xcd, 0x52, 0xf3, 0xd1, 0xc1, 0x37, 
-0xc9, 0xcd, 0x48, 0xf4, 0xd0, 0x3a, 0x5d, 0xae, 0xb7, 0x20, 0xb, 0xc5, 0xd5, 0x79, 0xcd, 0x6a, 
-0xef, 0xcd, 0x8b, 0xc3, 0xd1, 0xc1, 0x37, 0xc9, 0xc5, 0xd5, 0xe, 0x80, 0x26, 0x0, 0x1a, 0xfe, 
-0x2b, 0x20, 0x7, 0x13, 0x5, 0x28, 0x24, 0x24, 0xe, 0x88, 0x1a, 0xfe, 0x2e, 0x28, 0x20, 0xfe, 
-0x23, 0x28, 0x3e, 0x13, 0x5, 0x28, 0x14, 0xeb, 0xbe, 0xeb, 0x20, 0xf, 0x24, 0x24, 0x2e, 0x4, 
-0xcd, 0x2, 0xf5, 0x28, 0x24, 0x2e, 0x20, 0xfe, 0x2a, 0x28, 0x11, 0xd1, 0xc1, 0xb7, 0xc9, 0x13, 
-0x5, 0x28, 0xf8, 0x1a, 0xfe, 0x23, 0x20, 0xf3, 0x1b, 0x4, 0x18, 0x15, 0x13, 0x5, 0x28, 0xe, 
-0x1a, 0xcd, 0x2, 0xf5, 0x20, 0x8, 0x24, 0x2e, 0x24, 0x32, 0x54, 0xae, 0x13, 0x5, 0x79, 0xb5, 
-0x4f, 0xf1, 0xf1, 0xcd, 0xae, 0xf4, 0x7c, 0x85, 0xfe, 0x15, 0xd8, 0xc3, 0x4d, 0xcb, 0xaf, 0x6f, 
-0xb0, 0xc8, 0x1a, 0xfe, 0x2e, 0x28, 0xf, 0xfe, 0x23, 0x28, 0x6, 0xfe, 0x2c, 0x20, 0x10, 0xcb, 
-0xc9, 0x24, 0x13, 0x10, 0xed, 0xc9, 0x2c, 0x13, 0x5, 0xc8, 0x1a, 0xfe, 0x23, 0x28, 0xf7, 0xeb, 
-0xe5, 0xfe, 0x5e, 0x20, 0x16, 0x23, 0xbe, 0x20, 0x12, 0x23, 0xbe, 0x20, 0xe, 0x23, 0xbe, 0x20, 
-0xa, 0x23, 0x78, 0xd6, 0x4, 0x38, 0x4, 0x47, 0xe3, 0xcb, 0xf1, 0xe1, 0xeb, 0x4, 0x5, 0xc8, 
-0xcb, 0x59, 0xc0, 0x1a, 0xfe, 0x2d, 0x28, 0x5, 0xfe, 0x2b, 0xc0, 0xcb, 0xd9, 0xcb, 0xe1, 0x13, 
-0x5, 0xc9, 0xfe, 0x24, 0xc8, 0xfe, 0xa3, 0xc9, 0xcd, 0xcf, 0xc1, 0xcd, 0x3d, 0xde, 0xda, 0x98, 
-0xc3, 0xcd, 0x62, 0xcf, 0xf5, 0xe5, 0xcd, 0x66, 0xff, 0x28, 0x8, 0xcd, 0x5a, 0xef, 0xcd, 0x8b, 
-0xc3, 0x18, 0xd, 0x3e, 0x22, 0xcd, 0xa0, 0xc3, 0xcd, 0xd0, 0xf8, 0x3e, 0x22, 0xcd, 0xa0, 0xc3, 
-0xe1, 0xf1, 0xca, 0x98, 0xc3, 0xcd, 0xef, 0xf3, 0x3e, 0x2c, 0xcd, 0xa0, 0xc3, 0x18, 0xd2, 0x1, 
-0x0, 0xac, 0xcd, 0xde, 0xff, 0xd0, 0x22, 0x5e, 0xae, 0x22, 0x73, 0xb0, 0x22, 0x60, 0xae, 0xeb, 
-0x22, 0x62, 0xae, 0x1, 0x2f, 0x1, 0x9, 0xd8, 0x22, 0x64, 0xae, 0xeb, 0x23, 0xed, 0x52, 0xd8, 
-0x7c, 0xfe, 0x4, 0xd8, 0xcd, 0x7f, 0xf7, 0x32, 0x6e, 0xae, 0xc9, 0xcd, 0xf5, 0xce, 0xe5, 0x2a, 
-0x60, 0xae, 0xcd, 0xd8, 0xff, 0x38, 0x31, 0x13, 0xcd, 0xec, 0xf5, 0xdc, 0x8a, 0xf5, 0xeb, 0xcd, 
-0x8, 0xf8, 0x2a, 0x76, 0xb0, 0x22, 0x78, 0xb0, 0xe1, 0xc9, 0xcd, 0xae, 0xbb, 0xed, 0x4b, 0x5e, 
-0xae, 0xdc, 0xe0, 0xf5, 0x38, 0x12, 0x2a, 0x76, 0xb0, 0x2b, 0xcd, 0xe0, 0xf5, 0xd0, 0x3a, 0x75, 
-0xb0, 0xb7, 0xc8, 0xfe, 0x4, 0xca, 0x7f, 0xf7, 0xc3, 0x75, 0xf8, 0xd5, 0xeb, 0x9, 0x2b, 0xed, 
-0x4b, 0x62, 0xae, 0xe3, 0xeb, 0x2a, 0x5e, 0xae, 0xcd, 0xe0, 0xf5, 0xeb, 0xe3, 0xeb, 0xdc, 0xe0, 
-0xf5, 0x30, 0xe5, 0xed, 0x4b, 0x76, 0xb0, 0x21, 0xff, 0xf, 0x9, 0xcd, 0xe0, 0xf5, 0xd1, 0xdc, 
-0xe0, 0xf5, 0xd8, 0xeb, 0x50, 0x59, 0xcd, 0xec, 0xf5, 0xc2, 0x7f, 0xf7, 0x22, 0x78, 0xb0, 0xc9, 
-0xd5, 0xe5, 0xb7, 0xed, 0x42, 0xeb, 0xb7, 0xed, 0x42, 0xeb, 0x18, 0x6, 0xd5, 0xe5, 0x2a, 0x5e, 
-0xae, 0x23, 0xcd, 0xd8, 0xff, 0xe1, 0xd1, 0xc9, 0xd5, 0xe5, 0x2a, 0x71, 0xb0, 0xeb, 0x2a, 0x73, 
-0xb0, 0xcd, 0xe4, 0xff, 0xe1, 0xd1, 0xc9, 0x2a, 0x66, 0xae, 0x9, 0x22, 0x66, 0xae, 0x3a, 0x6e, 
-0xae, 0xb7, 0xc0, 0x2a, 0x68, 0xae, 0x9, 0x22, 0x68, 0xae, 0x2a, 0x6a, 0xae, 0x9, 0x22, 0x6a, 
-0xae, 0x2a, 0x6c, 0xae, 0x9, 0x22, 0x6c, 0xae, 0xc9, 0xcd, 0xfc, 0xf6, 0x44, 0x4d, 0x2a, 0x66, 
-0xae, 0xeb, 0xcd, 0xb8, 0xf6, 0x3e, 0xff, 0x32, 0x6e, 0xae, 0x18, 0xd7, 0xaf, 0x32, 0x6e, 0xae, 
-0x2a, 0x66, 0xae, 0xeb, 0x2a, 0x68, 0xae, 0xcd, 0xe4, 0xff, 0xcd, 0xe5, 0xf6, 0x18, 0xc4, 0x21, 
-0x6f, 0xae, 0x22, 0x6f, 0xb0, 0x3e, 0x1, 0xcd, 0x72, 0xf6, 0x36, 0x0, 0x23, 0x22, 0x19, 0xae, 
-0x18, 0xc, 0x2a, 0x6f, 0xb0, 0x2f, 0x3c, 0xc8, 0x85, 0x6f, 0x3e, 0xff, 0x8c, 0x67, 0x22, 0x6f, 
-0xb0, 0xc9, 0x2a, 0x6f, 0xb0, 0xe5, 0x85, 0x6f, 0x8c, 0x95, 0x67, 0x22, 0x6f, 0xb0, 0x3e, 0x94, 
-0x85, 0x3e, 0x4f, 0x8c, 0xe1, 0xd0, 0xcd, 0x4f, 0xf6, 0xc3, 0x75, 0xf8, 0x2a, 0x73, 0xb0, 0x22, 
-0x71, 0xb0, 0xc9, 0x6, 0x0, 0x2a, 0x6c, 0xae, 0xeb, 0x2a, 0x71, 0xb0, 0xb7, 0xed, 0x42, 0x2b, 
-0x2b, 0xcd, 0xd8, 0xff, 0x30, 0x9, 0xcd, 0x64, 0xfc, 0x38, 0xea, 0xcd, 0x45, 0xcb, 0xe, 0x22, 
-0x71, 0xb0, 0x23, 0x71, 0x23, 0x70, 0x23, 0xc9, 0xcd, 0x14, 0xf7, 0xc5, 0xd5, 0xd5, 0xe5, 0x9, 
-0x38, 0xe, 0xeb, 0xcd, 0x7, 0xf7, 0xcd, 0xd8, 0xff, 0x30, 0x8, 0xcd, 0x64, 0xfc, 0x38, 0xf3, 
-0xc3, 0x75, 0xf8, 0xe1, 0xc1, 0xd5, 0x7d, 0x91, 0x4f, 0x7c, 0x98, 0x47, 0x2b, 0x1b, 0xcd, 0xf5, 
-0xff, 0xe1, 0xd1, 0xc1, 0xc9, 0xc5, 0xd5, 0xeb, 0x9, 0xeb, 0xcd, 0x14, 0xf7, 0xcd, 0xe4, 0xff, 
-0xeb, 0xd1, 0xcd, 0xef, 0xff, 0xd1, 0x21, 0x0, 0x0, 0xc3, 0xe4, 0xff, 0x2a, 0x6c, 0xae, 0xeb, 
-0x2a, 0x71, 0xb0, 0xb7, 0xed, 0x52, 0xc9, 0x3a, 0x6e, 0xae, 0xb7, 0x2a, 0x71, 0xb0, 0xc8, 0x2a, 
-0x68, 0xae, 0x2b, 0xc9, 0x3a, 0x6e, 0xae, 0xb7, 0x2a, 0x6c, 0xae, 0xc8, 0x2a, 0x66, 0xae, 0xc9, 
-0x11, 0x1, 0x0, 0x18, 0x8, 0x11, 0x2, 0x8, 0x18, 0x3, 0x11, 0x0, 0x8, 0xc5, 0xe5, 0x3a, 
-0x75, 0xb0, 0xb7, 0x20, 0x18, 0xd5, 0x2a, 0x5e, 0xae, 0x23, 0x22, 0x78, 0xb0, 0x11, 0x0, 0xf0, 
-0x19, 0xd2, 0x75, 0xf8, 0xcd, 0x8, 0xf8, 0x22, 0x76, 0xb0, 0xd1, 0x3e, 0x4, 0xb3, 0x2a, 0x76, 
-0xb0, 0x1e, 0x0, 0x19, 0xeb, 0xe1, 0xc1, 0x18, 0x27, 0x3e, 0xfe, 0x18, 0x6, 0x3e, 0xfd, 0x18, 
-0x2, 0x3e, 0xff, 0xe5, 0x21, 0x75, 0xb0, 0xa6, 0x77, 0xfe, 0x4, 0x20, 0x9, 0x2a, 0x76, 0xb0, 
-0xeb, 0xcd, 0xec, 0xf5, 0x28, 0x2, 0xe1, 0xc9, 0x2a, 0x78, 0xb0, 0xcd, 0x8, 0xf8, 0xe1, 0xaf, 
-0x32, 0x75, 0xb0, 0xc9, 0xfe, 0x80, 0x28, 0x29, 0xcd, 0xb8, 0xce, 0x4f, 0xcd, 0x15, 0xde, 0x6, 
-0x8, 0x37, 0xd4, 0x41, 0xde, 0x9f, 0xdc, 0xb8, 0xce, 0xf5, 0xb7, 0x10, 0xf5, 0xeb, 0x79, 0xcd, 
-0xa5, 0xbb, 0xd2, 0x4d, 0xcb, 0x1, 0x8, 0x0, 0x9, 0xf1, 0x2b, 0x77, 0xd, 0x20, 0xfa, 0xeb, 
-0xc9, 0xcd, 0x2c, 0xde, 0xcd, 0xd8, 0xce, 0xe5, 0x21, 0x0, 0x1, 0xcd, 0xd8, 0xff, 0xda, 0x4d, 
-0xcb, 0xd5, 0xcd, 0xae, 0xbb, 0xeb, 0x30, 0x1b, 0x2f, 0x6f, 0x26, 0x0, 0x23, 0x29, 0x29, 0x29, 
-0xcd, 0xec, 0xf5, 0xc2, 0x4d, 0xcb, 0x19, 0xcd, 0x8, 0xf8, 0xcd, 0x61, 0xf7, 0x11, 0x0, 0x1, 
-0xcd, 0xab, 0xbb, 0xd1, 0xcd, 0xe9, 0xf7, 0xe1, 0xc9, 0x21, 0x0, 0x1, 0xb7, 0xed, 0x52, 0xc8, 
-0xd5, 0x29, 0x29, 0x29, 0xeb, 0x2a, 0x5e, 0xae, 0xed, 0x52, 0x7c, 0xfe, 0x40, 0xda, 0x75, 0xf8, 
-0x23, 0xcd, 0x8, 0xf8, 0xd1, 0xc3, 0xab, 0xbb, 0xe5, 0xcd, 0x64, 0xfc, 0xeb, 0xcd, 0xf8, 0xf5, 
-0x2a, 0x6c, 0xae, 0x9, 0x3f, 0xdc, 0xd8, 0xff, 0x30, 0x5b, 0x2a, 0x5e, 0xae, 0xeb, 0x37, 0xed, 
-0x52, 0x22, 0x7a, 0xb0, 0xe5, 0x11, 0x65, 0xf8, 0xcd, 0x93, 0xda, 0xc1, 0x78, 0x7, 0x38, 0x14, 
-0xb1, 0x28, 0x2b, 0x2a, 0x73, 0xb0, 0x54, 0x5d, 0x9, 0xe5, 0xcd, 0xf8, 0xf5, 0xeb, 0xcd, 0xf5, 
-0xff, 0xe1, 0x18, 0x13, 0x2a, 0x71, 0xb0, 0x54, 0x5d, 0x9, 0xe5, 0xcd, 0xf8, 0xf5, 0xeb, 0x23, 
-0x13, 0xcd, 0xef, 0xff, 0xeb, 0x2b, 0xd1, 0x22, 0x73, 0xb0, 0xeb, 0x22, 0x71, 0xb0, 0xe1, 0x2b, 
-0x22, 0x5e, 0xae, 0x23, 0xc9, 0x2a, 0x66, 0xae, 0xcd, 0xde, 0xff, 0xd0, 0x2a, 0x7a, 0xb0, 0x9, 
-0xeb, 0x72, 0x2b, 0x73, 0xc9, 0xcd, 0x45, 0xcb, 0x7, 0x23, 0xcd, 0xa7, 0xf8, 0x7e, 0xfe, 0x22, 
-0xca, 0x2c, 0xde, 0xb7, 0x28, 0x31, 0x4, 0x23, 0x18, 0xf3, 0xcd, 0xa7, 0xf8, 0x7e, 0xb7, 0xc8, 
-0x23, 0x4, 0x18, 0xf9, 0xcd, 0xa7, 0xf8, 0x4f, 0x7e, 0xb7, 0x28, 0x1b, 0xb9, 0x28, 0x18, 0xfe, 
-0x2c, 0x28, 0x14, 0x23, 0x4, 0x18, 0xf1, 0x22, 0x9d, 0xb0, 0xd1, 0x6, 0x0, 0xcd, 0xfe, 0xff, 
-0x78, 0x32, 0x9c, 0xb0, 0xc3, 0xd6, 0xfb, 0xe5, 0x4, 0x5, 0x28, 0x12, 0x2b, 0x7e, 0xfe, 0x20, 
-0x28, 0xf7, 0xfe, 0x9, 0x28, 0xf3, 0xfe, 0xd, 0x28, 0xef, 0xfe, 0xa, 0x28, 0xeb, 0xe1, 0xc9, 
-0xcd, 0xf5, 0xfb, 0xc8, 0x1a, 0x13, 0xcd, 0xb8, 0xc3, 0x10, 0xf9, 0xc9, 0xcd, 0xf5, 0xfb, 0xc8, 
-0x79, 0x90, 0x30, 0x5, 0x80, 0x28, 0x2, 0x47, 0xaf, 0x4f, 0x18, 0xe8, 0x1, 0xf1, 0xf8, 0x18, 
-0xc, 0xfe, 0x41, 0xd8, 0xfe, 0x5b, 0xd0, 0xc6, 0x20, 0xc9, 0x1, 0xab, 0xff, 0xc5, 0x2a, 0xa0, 
-0xb0, 0xcd, 0xf5, 0xfb, 0xcd, 0x41, 0xfc, 0x23, 0x4e, 0x23, 0x66, 0x69, 0xc1, 0x3c, 0x3d, 0xca, 
-0xd6, 0xfb, 0xf5, 0x7e, 0x23, 0xcd, 0xfc, 0xff, 0x12, 0x13, 0xf1, 0x18, 0xf1, 0xed, 0x5b, 0xa0, 
-0xb0, 0x1a, 0x86, 0x30, 0x4, 0xcd, 0x45, 0xcb, 0xf, 0xcd, 0x41, 0xfc, 0xcd, 0x59, 0xf9, 0xd5, 
-0xc5, 0x48, 0xcd, 0xd6, 0xfb, 0x79, 0xcd, 0xec, 0xff, 0xc1, 0xe1, 0x79, 0xc3, 0xec, 0xff, 0xcd, 
-0x59, 0xf9, 0xaf, 0xb9, 0x28, 0xf, 0xb8, 0x28, 0xa, 0x5, 0xd, 0x1a, 0x13, 0x96, 0x23, 0x28, 
-0xf2, 0x9f, 0xc0, 0x3c, 0xc9, 0xb8, 0xc8, 0x9f, 0xc9, 0xcd, 0xf5, 0xfb, 0x48, 0xd5, 0xcd, 0x3, 
-0xfc, 0xeb, 0xd1, 0xc9, 0x1, 0x1, 0x1, 0x18, 0x3, 0x1, 0xf, 0x4, 0xc5, 0xcd, 0x62, 0xcf, 
-0xe5, 0xcd, 0xeb, 0xfe, 0xe3, 0xcd, 0x41, 0xde, 0x9f, 0xdc, 0xb8, 0xce, 0xfe, 0x11, 0xd2, 0x4d, 
-0xcb, 0x47, 0xcd, 0x1d, 0xde, 0x78, 0xeb, 0xe1, 0xc1, 0xd5, 0xcd, 0xdf, 0xf1, 0x18, 0x31, 0xcd, 
-0x62, 0xcf, 0xcd, 0x15, 0xde, 0xcd, 0x74, 0xff, 0xcd, 0x3, 0xcf, 0xcd, 0x1d, 0xde, 0xe5, 0x79, 
-0xcd, 0x62, 0xf6, 0xd5, 0x79, 0xcd, 0x6c, 0xff, 0xd1, 0x78, 0xb7, 0xc4, 0x48, 0xf4, 0xd2, 0x4d, 
-0xcb, 0x78, 0xb7, 0xc2, 0x4d, 0xcb, 0x79, 0xcd, 0x6a, 0xef, 0x18, 0x4, 0xe5, 0xcd, 0x68, 0xef, 
-0xe5, 0xe, 0xff, 0xaf, 0xc, 0xbe, 0x23, 0x20, 0xfb, 0xe1, 0x79, 0xcd, 0xd3, 0xfb, 0xcd, 0xec, 
-0xff, 0xe1, 0xc9, 0xcd, 0x43, 0xfa, 0x18, 0x18, 0xcd, 0x43, 0xfa, 0x1a, 0x90, 0x38, 0x11, 0x4f, 
-0x18, 0xe, 0xcd, 0x19, 0xde, 0xcd, 0x43, 0xfa, 0xca, 0x4d, 0xcb, 0x5, 0x48, 0xcd, 0x4f, 0xfa, 
-0xcd, 0x1d, 0xde, 0xe5, 0xeb, 0xcd, 0x60, 0xfa, 0xcd, 0x41, 0xfc, 0xcd, 0x3, 0xfc, 0xeb, 0xcd, 
-0xd6, 0xfb, 0x6, 0x0, 0x9, 0x18, 0x37, 0xcd, 0x19, 0xde, 0xcd, 0xbf, 0xd6, 0xcd, 0x5e, 0xff, 
-0xe5, 0xeb, 0xcd, 0x58, 0xfb, 0xe3, 0xcd, 0x55, 0xfa, 0xca, 0x4d, 0xcb, 0x3d, 0x4f, 0xcd, 0x4f, 
-0xfa, 0xcd, 0x1d, 0xde, 0xcd, 0x21, 0xde, 0xc5, 0xcd, 0x3, 0xcf, 0x78, 0xc1, 0xe3, 0xb8, 0x30, 
-0x1, 0x47, 0xcd, 0x60, 0xfa, 0x23, 0x46, 0x23, 0x66, 0x68, 0x6, 0x0, 0x9, 0xeb, 0xcd, 0xec, 
-0xff, 0xe1, 0xc9, 0xcd, 0x9, 0xcf, 0xeb, 0x2a, 0xa0, 0xb0, 0xeb, 0xe, 0x0, 0x18, 0x6, 0x6, 
-0xff, 0x7e, 0xfe, 0x29, 0xc8, 0xd5, 0xcd, 0x15, 0xde, 0xcd, 0xb8, 0xce, 0x47, 0xd1, 0xb7, 0xc9, 
-0x7e, 0x91, 0x30, 0x1, 0xaf, 0xb8, 0xd8, 0x78, 0xc9, 0xcd, 0xf5, 0xfb, 0x18, 0x3, 0xcd, 0xa6, 
-0xfa, 0xc3, 0x32, 0xff, 0xcd, 0xd9, 0xfa, 0x37, 0x4f, 0x9f, 0xe6, 0x1, 0x18, 0x34, 0xcd, 0x6f, 
-0xc4, 0x30, 0xf5, 0xfe, 0xfc, 0x28, 0xf1, 0xfe, 0xef, 0x28, 0xed, 0x18, 0xea, 0xcd, 0xb8, 0xce, 
-0xf5, 0xcd, 0x15, 0xde, 0xcd, 0x62, 0xcf, 0xcd, 0x1d, 0xde, 0xcd, 0xa1, 0xfa, 0x4f, 0xf1, 0x18, 
-0x11, 0xcd, 0x66, 0xff, 0x20, 0x33, 0xcd, 0xf5, 0xfb, 0x28, 0x37, 0x1a, 0xc9, 0xcd, 0xd9, 0xfa, 
-0xe, 0x20, 0x47, 0xcd, 0xd3, 0xfb, 0x79, 0x4, 0x5, 0xc8, 0x12, 0x13, 0x18, 0xfa, 0xcd, 0xf5, 
-0xfb, 0xca, 0x32, 0xff, 0xeb, 0xe5, 0x5f, 0x16, 0x0, 0x19, 0x5e, 0x72, 0xe3, 0xd5, 0xcd, 0x6f, 
-0xed, 0xd1, 0xe1, 0x73, 0xd8, 0xcd, 0x45, 0xcb, 0xd, 0xe5, 0xcd, 0xb6, 0xfe, 0x7c, 0xb7, 0x7d, 
-0xe1, 0xc8, 0xc3, 0x4d, 0xcb, 0xcd, 0x62, 0xcf, 0xcd, 0x66, 0xff, 0xe, 0x1, 0x28, 0xe, 0xcd, 
-0xd9, 0xfa, 0xb7, 0xca, 0x4d, 0xcb, 0x4f, 0xcd, 0x15, 0xde, 0xcd, 0x9, 0xcf, 0xcd, 0x15, 0xde, 
-0xe5, 0x2a, 0xa0, 0xb0, 0xe3, 0xcd, 0x3, 0xcf, 0xcd, 0x1d, 0xde, 0xe3, 0x79, 0x48, 0xd5, 0xf5, 
-0xcd, 0x3, 0xfc, 0xeb, 0xf1, 0x5f, 0x16, 0x0, 0x19, 0x2b, 0x78, 0x93, 0x3c, 0x47, 0x7b, 0xd1, 
-0x38, 0x25, 0xc, 0xd, 0x28, 0x22, 0xf5, 0x78, 0xb9, 0x38, 0x1b, 0xe5, 0xd5, 0xc5, 0x1a, 0xbe, 
-0x20, 0xb, 0x23, 0x13, 0xd, 0x20, 0xf7, 0xc1, 0xd1, 0xe1, 0xf1, 0x18, 0xb, 0xc1, 0xd1, 0xe1, 
-0xf1, 0x3c, 0x23, 0x5, 0x18, 0xe0, 0xf1, 0xaf, 0xcd, 0x32, 0xff, 0xe1, 0xc9, 0xd5, 0xe5, 0x11, 
-0x65, 0xfb, 0xcd, 0x93, 0xda, 0xe1, 0xd1, 0xc9, 0xe5, 0x7e, 0x23, 0x4e, 0x23, 0x46, 0xeb, 0xb7, 
-0xc4, 0x65, 0xfb, 0xe1, 0xc9, 0x2a, 0x71, 0xb0, 0xcd, 0xde, 0xff, 0x30, 0x7, 0x2a, 0x73, 0xb0, 
-0xcd, 0xde, 0xff, 0xd0, 0xeb, 0x2b, 0x2b, 0xe5, 0xcd, 0xb9, 0xfb, 0xe1, 0x3a, 0x9c, 0xb0, 0x77, 
-0x23, 0xed, 0x5b, 0x9d, 0xb0, 0x73, 0x23, 0x72, 0x23, 0xc9, 0xcd, 0x37, 0xfc, 0xd8, 0xcd, 0xb9, 
-0xfb, 0xc3, 0xd6, 0xfb, 0x2a, 0xa0, 0xb0, 0xcd, 0x1f, 0xfc, 0x78, 0xb7, 0xc8, 0xe5, 0x2a, 0x64, 
-0xae, 0xcd, 0xd8, 0xff, 0x2a, 0x73, 0xb0, 0xeb, 0xdc, 0xd8, 0xff, 0x30, 0xa, 0xed, 0x5b, 0x66, 
-0xae, 0xcd, 0xd8, 0xff, 0xd4, 0x37, 0xfc, 0xe1, 0xd8, 0x7e, 0xcd, 0x41, 0xfc, 0xd5, 0x7e, 0x23, 
-0x4e, 0x23, 0x66, 0x69, 0xcd, 0xec, 0xff, 0xd1, 0x21, 0x9c, 0xb0, 0xc9, 0x21, 0x7e, 0xb0, 0x22, 
-0x7c, 0xb0, 0xc9, 0xcd, 0x41, 0xfc, 0xe5, 0x3e, 0x3, 0x32, 0x9f, 0xb0, 0x2a, 0x7c, 0xb0, 0x22, 
-0xa0, 0xb0, 0x11, 0x9c, 0xb0, 0xcd, 0xd8, 0xff, 0x3e, 0x10, 0xca, 0x55, 0xcb, 0xcd, 0x7c, 0xfb, 
-0x22, 0x7c, 0xb0, 0xe1, 0xc9, 0xe5, 0xcd, 0x5e, 0xff, 0x2a, 0xa0, 0xb0, 0xcd, 0x3, 0xfc, 0xe1, 
-0x78, 0xb7, 0xc9, 0xcd, 0x1f, 0xfc, 0xc0, 0x78, 0xb7, 0xc8, 0x2a, 0x71, 0xb0, 0x23, 0x23, 0x23, 
-0xcd, 0xd8, 0xff, 0xc0, 0x2b, 0x2b, 0x6e, 0x26, 0x0, 0x19, 0x2b, 0x22, 0x71, 0xb0, 0xc9, 0xe5, 
-0xed, 0x5b, 0x7c, 0xb0, 0x1b, 0x1b, 0x1b, 0xcd, 0xd8, 0xff, 0x20, 0x4, 0xed, 0x53, 0x7c, 0xb0, 
-0x46, 0x23, 0x5e, 0x23, 0x56, 0xe1, 0xc9, 0x2a, 0xa0, 0xb0, 0x3e, 0x7d, 0x95, 0x3e, 0xb0, 0x9c, 
-0xc9, 0xe5, 0xc5, 0x4f, 0xb7, 0xc4, 0x93, 0xf6, 0x79, 0x32, 0x9c, 0xb0, 0x22, 0x9d, 0xb0, 0xeb, 
-0xc1, 0xe1, 0xc9, 0xcd, 0x66, 0xff, 0x20, 0x6, 0xcd, 0xf5, 0xfb, 0xcd, 0x64, 0xfc, 0xcd, 0xfc, 
-0xf6, 0xc3, 0x89, 0xfe, 0xe5, 0xd5, 0xc5, 0x21, 0x7e, 0xb0, 0x18, 0xc, 0x7e, 0x23, 0x4e, 0x23, 
-0x46, 0xeb, 0xb7, 0xc4, 0xe3, 0xfc, 0xeb, 0x23, 0xed, 0x5b, 0x7c, 0xb0, 0xcd, 0xd8, 0xff, 0x20, 
-0xeb, 0x11, 0xe3, 0xfc, 0xcd, 0x93, 0xda, 0x2a, 0x73, 0xb0, 0xe5, 0x2a, 0x71, 0xb0, 0x23, 0x5d, 
-0x54, 0x18, 0x14, 0x4e, 0x23, 0x46, 0x4, 0x5, 0x28, 0xb, 0x2b, 0xa, 0x4f, 0x6, 0x0, 0x3, 
-0x3, 0xed, 0xb0, 0x18, 0x2, 0x23, 0x9, 0xc1, 0xc5, 0xcd, 0xde, 0xff, 0x38, 0xe5, 0x1b, 0x2a, 
-0x71, 0xb0, 0xeb, 0xcd, 0xe4, 0xff, 0xd1, 0xcd, 0xd8, 0xff, 0xf5, 0xd5, 0xcd, 0xf5, 0xff, 0xeb, 
-0x22, 0x71, 0xb0, 0xc1, 0x23, 0x18, 0x12, 0x5e, 0x23, 0x56, 0x2b, 0x1a, 0x77, 0x23, 0x36, 0x0, 
-0x23, 0xeb, 0x72, 0x2b, 0x73, 0x6f, 0x26, 0x0, 0x19, 0xcd, 0xde, 0xff, 0x38, 0xe9, 0xf1, 0xc1, 
-0xd1, 0xe1, 0xc9, 0x2a, 0x6c, 0xae, 0xcd, 0xde, 0xff, 0xd0, 0xb, 0x7a, 0x2, 0xb, 0xa, 0x12, 
-0x7b, 0x2, 0xc9, 0xcd, 0x4f, 0xff, 0xd2, 0x76, 0xbd, 0xcd, 0x2a, 0xdd, 0x22, 0xa0, 0xb0, 0x21, 
-0xa1, 0xb0, 0xc9, 0xcd, 0xeb, 0xfe, 0x21, 0xa1, 0xb0, 0xc3, 0x30, 0xdd, 0xcd, 0x3b, 0xfe, 0x30, 
-0x9, 0xcd, 0x4a, 0xdd, 0xda, 0x35, 0xff, 0xcd, 0x78, 0xfe, 0xcd, 0x7c, 0xbd, 0xd8, 0xc3, 0xbe, 
-0xcb, 0xcd, 0x3b, 0xfe, 0x30, 0x9, 0xcd, 0x52, 0xdd, 0xda, 0x35, 0xff, 0xcd, 0x78, 0xfe, 0xcd, 
-0x82, 0xbd, 0xd8, 0x18, 0xe9, 0xcd, 0x3b, 0xfe, 0x30, 0x9, 0xcd, 0x5b, 0xdd, 0xda, 0x35, 0xff, 
-0xcd, 0x78, 0xfe, 0xcd, 0x85, 0xbd, 0xd8, 0x18, 0xd5, 0xcd, 0x3b, 0xfe, 0xda, 0x2, 0xde, 0xc3, 
-0x8e, 0xbd, 0xcd, 0x70, 0xfe, 0xeb, 0xd5, 0xcd, 0x88, 0xbd, 0xd1, 0x1, 0x5, 0x0, 0xed, 0xb0, 
-0xd8, 0xca, 0xb5, 0xcb, 0xc3, 0xbe, 0xcb, 0xcd, 0xc3, 0xfe, 0xeb, 0xcd, 0x9c, 0xdd, 0xda, 0x35, 
-0xff, 0x28, 0x10, 0x21, 0x0, 0x80, 0xc3, 0x89, 0xfe, 0xcd, 0xc3, 0xfe, 0xeb, 0xcd, 0xa3, 0xdd, 
-0xda, 0x35, 0xff, 0xcd, 0x45, 0xcb, 0xb, 0xcd, 0xc3, 0xfe, 0x7b, 0xa5, 0x6f, 0x7c, 0xa2, 0xc3, 
-0x34, 0xff, 0xcd, 0xc3, 0xfe, 0x7b, 0xb5, 0x6f, 0x7a, 0xb4, 0x18, 0xf3, 0xcd, 0xc3, 0xfe, 0x7b, 
-0xad, 0x6f, 0x7c, 0xaa, 0x18, 0xe9, 0xcd, 0xb6, 0xfe, 0x7d, 0x2f, 0x6f, 0x7c, 0x2f, 0x18, 0xdf, 
-0xcd, 0xc4, 0xfd, 0xf0, 0xcd, 0x4f, 0xff, 0xd2, 0x91, 0xbd, 0xcd, 0xed, 0xdd, 0x22, 0xa0, 0xb0, 
-0xd4, 0x89, 0xfe, 0xc9, 0xc5, 0xe5, 0xcd, 0xcc, 0xfd, 0xe1, 0xc1, 0xc9, 0xcd, 0x4f, 0xff, 0xda, 
-0xf9, 0xdd, 0xc3, 0x94, 0xbd, 0xe5, 0x79, 0xcd, 0x6c, 0xff, 0xd1, 0xcd, 0x4f, 0xff, 0x78, 0x30, 
-0xb, 0xb7, 0xf0, 0xcd, 0x93, 0xfe, 0xcd, 0xf4, 0xfd, 0xc3, 0xb6, 0xfe, 0xb7, 0x20, 0x5, 0x11, 
-0x6d, 0xbd, 0x18, 0x26, 0xd5, 0xc5, 0x78, 0xcd, 0x79, 0xbd, 0xdc, 0x6d, 0xbd, 0x78, 0xc1, 0xd1, 
-0x30, 0x8, 0xcd, 0x67, 0xbd, 0xaf, 0x90, 0xc3, 0x79, 0xbd, 0xeb, 0xc3, 0x6f, 0xff, 0x11, 0x70, 
-0xbd, 0x18, 0x3, 0x11, 0x73, 0xbd, 0xcd, 0x4f, 0xff, 0xd8, 0xcd, 0xfe, 0xff, 0xd0, 0x3a, 0x9f, 
-0xb0, 0xcd, 0x2c, 0xfe, 0xd8, 0xcd, 0x45, 0xff, 0x78, 0xc3, 0x67, 0xbd, 0x79, 0xfe, 0x3, 0xd0, 
-0x7e, 0x23, 0x66, 0x6f, 0xcd, 0x37, 0xdd, 0xd0, 0xc3, 0x35, 0xff, 0x79, 0xfe, 0x3, 0x28, 0x2d, 
-0x3a, 0x9f, 0xb0, 0xfe, 0x3, 0x28, 0x26, 0xb9, 0x28, 0x17, 0x30, 0xc, 0xe5, 0x21, 0x9f, 0xb0, 
-0x71, 0x23, 0xcd, 0x8c, 0xfe, 0xd1, 0xb7, 0xc9, 0xcd, 0x8c, 0xfe, 0xb7, 0xeb, 0x21, 0xa0, 0xb0, 
-0xc9, 0xee, 0x2, 0x20, 0xf7, 0x5e, 0x23, 0x56, 0x2a, 0xa0, 0xb0, 0x37, 0xc9, 0xc3, 0x62, 0xff, 
-0x3a, 0x9f, 0xb0, 0xb1, 0xfe, 0x2, 0x20, 0xc3, 0x2a, 0xa0, 0xb0, 0xcd, 0x93, 0xfe, 0x2a, 0x6f, 
-0xb0, 0xcd, 0x8c, 0xfe, 0xeb, 0x21, 0xa0, 0xb0, 0xc9, 0xaf, 0x18, 0x8, 0x5e, 0x23, 0x56, 0x2b, 
-0x7a, 0x18, 0x8, 0x7c, 0xeb, 0x21, 0x9f, 0xb0, 0x36, 0x5, 0x23, 0xeb, 0xf5, 0xb7, 0xfc, 0xed, 
-0xdd, 0xf1, 0xc3, 0x64, 0xbd, 0x22, 0xa0, 0xb0, 0xeb, 0x22, 0xa2, 0xb0, 0x21, 0x9f, 0xb0, 0x36, 
-0x5, 0x23, 0xaf, 0xc3, 0x67, 0xbd, 0xcd, 0xbc, 0xfe, 0xd8, 0x18, 0x3f, 0xcd, 0xce, 0xfe, 0x22, 
-0xa0, 0xb0, 0xc9, 0x79, 0xcd, 0xd5, 0xfe, 0xeb, 0xdc, 0xce, 0xfe, 0xd8, 0x18, 0x2d, 0x21, 0x9f, 
-0xb0, 0x7e, 0x36, 0x2, 0x23, 0xfe, 0x3, 0x38, 0xd, 0xca, 0x62, 0xff, 0xc5, 0xcd, 0x6a, 0xbd, 
-0x47, 0xdc, 0x37, 0xdd, 0xc1, 0xc9, 0x7e, 0x23, 0x66, 0x6f, 0xc9, 0xcd, 0x4f, 0xff, 0xd8, 0xcd, 
-0x6a, 0xbd, 0x30, 0x7, 0x47, 0xfc, 0x37, 0xdd, 0xda, 0x35, 0xff, 0xcd, 0x45, 0xcb, 0x6, 0xe5, 
-0xd5, 0xc5, 0x21, 0x9f, 0xb0, 0xbe, 0xc4, 0xd, 0xff, 0xc1, 0xd1, 0xe1, 0xc9, 0xd6, 0x3, 0x38, 
-0xa5, 0xca, 0x5e, 0xff, 0xcd, 0x4f, 0xff, 0xda, 0x93, 0xfe, 0xc9, 0xe5, 0x21, 0x0, 0x0, 0x22, 
-0xa0, 0xb0, 0x22, 0xa2, 0xb0, 0x22, 0xa3, 0xb0, 0xe1, 0xc9, 0xcd, 0xc4, 0xfd, 0x6f, 0x87, 0x9f, 
-0x18, 0x2, 0x6f, 0xaf, 0x67, 0x22, 0xa0, 0xb0, 0x3e, 0x2, 0x32, 0x9f, 0xb0, 0xc9, 0x21, 0xa0, 
-0xb0, 0x3e, 0x5, 0x18, 0xf5, 0x21, 0x9f, 0xb0, 0x4e, 0x23, 0xc9, 0x3a, 0x9f, 0xb0, 0xc9, 0x3a, 
-0x9f, 0xb0, 0xfe, 0x3, 0x28, 0xc, 0x2a, 0xa0, 0xb0, 0xd8, 0x21, 0xa0, 0xb0, 0xc9, 0xcd, 0x66, 
-0xff, 0xc8, 0xcd, 0x45, 0xcb, 0xd, 0x3a, 0x9f, 0xb0, 0xfe, 0x3, 0xc9, 0x32, 0x9f, 0xb0, 0x11, 
-0xa0, 0xb0, 0x18, 0x13, 0xd5, 0xe5, 0x3a, 0x9f, 0xb0, 0x4f, 0xcd, 0x72, 0xf6, 0xcd, 0x83, 0xff, 
-0xe1, 0xd1, 0xc9, 0xeb, 0x21, 0xa0, 0xb0, 0xc5, 0x3a, 0x9f, 0xb0, 0x4f, 0x6, 0x0, 0xed, 0xb0, 
-0xc1, 0xc9, 0xcd, 0xab, 0xff, 0xfe, 0x41, 0x3f, 0xd0, 0xfe, 0x5b, 0xc9, 0xcd, 0x92, 0xff, 0xd8, 
-0xfe, 0x2e, 0x37, 0xc8, 0xfe, 0x30, 0x3f, 0xd0, 0xfe, 0x3a, 0xc9, 0xfe, 0x61, 0xd8, 0xfe, 0x7b, 
-0xd0, 0xd6, 0x20, 0xc9, 0xf5, 0xc5, 0x46, 0x23, 0xe5, 0x23, 0x23, 0xbe, 0x23, 0x28, 0x3, 0x10, 
-0xf8, 0xe3, 0xf1, 0x7e, 0x23, 0x66, 0x6f, 0xc1, 0xf1, 0xc9, 0xc5, 0x4f, 0x7e, 0xb7, 0x28, 0x5, 
-0x23, 0xb9, 0x20, 0xf8, 0x37, 0x79, 0xc1, 0xc9, 0x7c, 0x92, 0xc0, 0x7d, 0x93, 0xc9, 0x7c, 0x90, 
-0xc0, 0x7d, 0x91, 0xc9, 0xe5, 0xb7, 0xed, 0x52, 0x44, 0x4d, 0xe1, 0xc9, 0x4f, 0x6, 0x0, 0x78, 
-0xb1, 0xc8, 0xed, 0xb0, 0xc9, 0x78, 0xb1, 0xc8, 0xed, 0xb8, 0xc9, 0xe9, 0xc5, 0xc9, 0xd5, 0xc9, 
-
-};
-unsigned char dump_cpc6128_os[16384] = {
-0x1, 0x89, 0x7f, 0xed, 0x49, 0xc3, 0x91, 0x5, 0xc3, 0x8a, 0xb9, 0xc3, 0x84, 0xb9, 0xc5, 0xc9, 
-0xc3, 0x1d, 0xba, 0xc3, 0x17, 0xba, 0xd5, 0xc9, 0xc3, 0xc7, 0xb9, 0xc3, 0xb9, 0xb9, 0xe9, 0x0, 
-0xc3, 0xc6, 0xba, 0xc3, 0xc1, 0xb9, 0x0, 0x0, 0xc3, 0x35, 0xba, 0x0, 0xed, 0x49, 0xd9, 0xfb, 
-0xf3, 0xd9, 0x21, 0x2b, 0x0, 0x71, 0x18, 0x8, 0xc3, 0x41, 0xb9, 0xc9, 0x0, 0x0, 0x0, 0x0, 
-0xcb, 0xd1, 0x18, 0xe8, 0x21, 0x40, 0x0, 0x2d, 0x7e, 0x77, 0x20, 0xfb, 0x3e, 0xc7, 0x32, 0x30, 
-0x0, 0x21, 0xa6, 0x3, 0x11, 0x0, 0xb9, 0x1, 0xe4, 0x1, 0xed, 0xb0, 0xf3, 0x3a, 0xd9, 0xb8, 
-0xed, 0x5b, 0xd7, 0xb8, 0x6, 0xcd, 0x21, 0x2d, 0xb8, 0x36, 0x0, 0x23, 0x10, 0xfb, 0x47, 0xe, 
-0xff, 0xa9, 0xc0, 0x47, 0x5f, 0x57, 0xc9, 0x7c, 0xb5, 0x79, 0x20, 0x4, 0x7d, 0x21, 0x6, 0xc0, 
-0x32, 0xd6, 0xb8, 0x32, 0xd9, 0xb8, 0x22, 0xd7, 0xb8, 0x21, 0xff, 0xab, 0x11, 0x40, 0x0, 0x1, 
-0xff, 0xb0, 0x31, 0x0, 0xc0, 0xdf, 0xd7, 0xb8, 0xc7, 0xf3, 0xed, 0x5b, 0xb6, 0xb8, 0x2a, 0xb4, 
-0xb8, 0xfb, 0xc9, 0xf3, 0xaf, 0x32, 0xb8, 0xb8, 0xed, 0x53, 0xb6, 0xb8, 0x22, 0xb4, 0xb8, 0xfb, 
-0xc9, 0x21, 0xb4, 0xb8, 0x34, 0x23, 0x28, 0xfc, 0x6, 0xf5, 0xed, 0x78, 0x1f, 0x30, 0x8, 0x2a, 
-0xb9, 0xb8, 0x7c, 0xb7, 0xc4, 0x53, 0x1, 0x2a, 0xbb, 0xb8, 0x7c, 0xb7, 0xc4, 0x53, 0x1, 0xcd, 
-0xd7, 0x20, 0x21, 0xbf, 0xb8, 0x35, 0xc0, 0x36, 0x6, 0xcd, 0xf4, 0xbd, 0x2a, 0xbd, 0xb8, 0x7c, 
-0xb7, 0xc8, 0x21, 0x31, 0xb8, 0xcb, 0xc6, 0xc9, 0x2b, 0x36, 0x0, 0x2b, 0x3a, 0x2e, 0xb8, 0xb7, 
-0x20, 0xc, 0x22, 0x2d, 0xb8, 0x22, 0x2f, 0xb8, 0x21, 0x31, 0xb8, 0xcb, 0xf6, 0xc9, 0xed, 0x5b, 
-0x2f, 0xb8, 0x22, 0x2f, 0xb8, 0xeb, 0x73, 0x23, 0x72, 0xc9, 0xed, 0x73, 0x32, 0xb8, 0x31, 0xb4, 
-0xb8, 0xe5, 0xd5, 0xc5, 0x21, 0x31, 0xb8, 0xcb, 0x76, 0x28, 0x1e, 0xcb, 0xfe, 0x2a, 0x2d, 0xb8, 
-0x7c, 0xb7, 0x28, 0xe, 0x5e, 0x23, 0x56, 0xed, 0x53, 0x2d, 0xb8, 0x23, 0xcd, 0x9, 0x2, 0xf3, 
-0x18, 0xeb, 0x21, 0x31, 0xb8, 0xcb, 0x46, 0x28, 0x10, 0x36, 0x0, 0x37, 0x8, 0xcd, 0x89, 0x1, 
-0xb7, 0x8, 0x21, 0x31, 0xb8, 0x7e, 0xb7, 0x20, 0xd2, 0x36, 0x0, 0xc1, 0xd1, 0xe1, 0xed, 0x7b, 
-0x32, 0xb8, 0xc9, 0x5e, 0x23, 0x7e, 0x23, 0xb7, 0xca, 0xe2, 0x1, 0x57, 0xd5, 0xcd, 0xe2, 0x1, 
-0xe1, 0x18, 0xf0, 0xe5, 0x23, 0x23, 0xcd, 0xd2, 0x1, 0xe1, 0x11, 0xb9, 0xb8, 0xc3, 0x79, 0x3, 
-0x11, 0xb9, 0xb8, 0xc3, 0x88, 0x3, 0xe5, 0x23, 0x23, 0xcd, 0xd2, 0x1, 0xe1, 0x11, 0xbb, 0xb8, 
-0xc3, 0x79, 0x3, 0x11, 0xbb, 0xb8, 0xc3, 0x88, 0x3, 0x2a, 0xbd, 0xb8, 0x7c, 0xb7, 0xc8, 0x5e, 
-0x23, 0x56, 0x23, 0x4e, 0x23, 0x46, 0x78, 0xb1, 0x28, 0x16, 0xb, 0x78, 0xb1, 0x20, 0xe, 0xd5, 
-0x23, 0x23, 0xe5, 0x23, 0xcd, 0xe2, 0x1, 0xe1, 0x46, 0x2b, 0x4e, 0x2b, 0xd1, 0x70, 0x2b, 0x71, 
-0xeb, 0x18, 0xd9, 0xe5, 0x23, 0x23, 0xf3, 0x73, 0x23, 0x72, 0x23, 0x71, 0x23, 0x70, 0xe1, 0x11, 
-0xbd, 0xb8, 0xc3, 0x79, 0x3, 0x11, 0xbd, 0xb8, 0xcd, 0x88, 0x3, 0xd0, 0xeb, 0x23, 0x5e, 0x23, 
-0x56, 0xc9, 0xf3, 0x23, 0x23, 0x36, 0x0, 0x23, 0x70, 0x23, 0x73, 0x23, 0x72, 0x23, 0x71, 0x23, 
-0xfb, 0xc9, 0x23, 0x23, 0xf3, 0x7e, 0x34, 0xfa, 0x1, 0x2, 0xb7, 0x20, 0x15, 0x23, 0x7e, 0x2b, 
-0xb7, 0xf2, 0x2e, 0x2, 0x8, 0x30, 0x11, 0x8, 0x87, 0xf2, 0xe8, 0x0, 0x35, 0x23, 0x23, 0x18, 
-0x21, 0x35, 0x8, 0x38, 0x1, 0xfb, 0x8, 0xc9, 0x8, 0xfb, 0x7e, 0x3d, 0xf8, 0xe5, 0xcd, 0x1b, 
-0x2, 0xe1, 0x35, 0xc8, 0xf2, 0xd, 0x2, 0x34, 0xc9, 0x23, 0x23, 0x23, 0x7e, 0x23, 0x1f, 0xd2, 
-0xc1, 0xb9, 0x5e, 0x23, 0x56, 0xeb, 0xe9, 0x21, 0x0, 0x0, 0x22, 0xc1, 0xb8, 0xc9, 0xe5, 0x47, 
-0x11, 0xc3, 0xb8, 0xeb, 0x2b, 0x2b, 0x56, 0x2b, 0x5e, 0x7a, 0xb7, 0x28, 0x7, 0x13, 0x13, 0x13, 
-0x1a, 0xb8, 0x30, 0xef, 0xd1, 0x1b, 0x23, 0x7e, 0x12, 0x1b, 0x72, 0x2b, 0x7e, 0x12, 0x73, 0x8, 
-0x38, 0x1, 0xfb, 0x8, 0xc9, 0xf3, 0x2a, 0xc0, 0xb8, 0x7c, 0xb7, 0x28, 0x17, 0xe5, 0x5e, 0x23, 
-0x56, 0x23, 0x23, 0x3a, 0xc2, 0xb8, 0xbe, 0x30, 0xa, 0xf5, 0x7e, 0x32, 0xc2, 0xb8, 0xed, 0x53, 
-0xc0, 0xb8, 0xf1, 0xe1, 0xfb, 0xc9, 0x32, 0xc2, 0xb8, 0x23, 0x23, 0x35, 0xc8, 0xf3, 0xf2, 0x2e, 
-0x2, 0x34, 0xfb, 0xc9, 0xcd, 0x8d, 0x2, 0x11, 0xc0, 0xb8, 0xc3, 0x88, 0x3, 0x23, 0x23, 0x36, 
-0xc0, 0x2b, 0x2b, 0xc9, 0x21, 0xc2, 0xb8, 0xcb, 0xee, 0xc9, 0x21, 0xc2, 0xb8, 0xcb, 0xae, 0xc9, 
-0xe5, 0xed, 0x5b, 0xd3, 0xb8, 0x22, 0xd3, 0xb8, 0x73, 0x23, 0x72, 0x23, 0x71, 0x23, 0x70, 0xe1, 
-0xc9, 0x11, 0xc3, 0xb8, 0x1, 0x10, 0x0, 0xcd, 0xa1, 0xba, 0xeb, 0x2b, 0xcb, 0xfe, 0x2a, 0xd3, 
-0xb8, 0x7d, 0x18, 0x10, 0xe5, 0x23, 0x23, 0x4e, 0x23, 0x46, 0xcd, 0xf1, 0x2, 0xd1, 0xd8, 0xeb, 
-0x7e, 0x23, 0x66, 0x6f, 0xb4, 0x20, 0xed, 0xe, 0xff, 0xc, 0xcd, 0x7e, 0xba, 0xf5, 0xe6, 0x3, 
-0x47, 0xcc, 0xf1, 0x2, 0xdc, 0x1c, 0x6, 0xf1, 0x87, 0x30, 0xee, 0x79, 0xfe, 0x10, 0x38, 0xe9, 
-0xc9, 0x21, 0x4, 0xc0, 0x78, 0xb7, 0x28, 0x4, 0x60, 0x69, 0xe, 0xff, 0xcd, 0x79, 0xba, 0xc5, 
-0x5e, 0x23, 0x56, 0x23, 0xeb, 0x18, 0x17, 0x1, 0xc3, 0xb8, 0xa, 0xbe, 0x20, 0x8, 0x23, 0x3, 
-0x87, 0x30, 0xf7, 0xeb, 0x18, 0xc, 0x7e, 0x23, 0x87, 0x30, 0xfb, 0x13, 0x13, 0x13, 0x7e, 0xb7, 
-0x20, 0xe5, 0xc1, 0xc3, 0x87, 0xba, 0xe, 0xf, 0xcd, 0x30, 0x3, 0xd, 0xf2, 0x28, 0x3, 0xc9, 
-0x3a, 0xd9, 0xb8, 0xb9, 0xc8, 0x79, 0xfe, 0x10, 0xd0, 0xcd, 0x79, 0xba, 0x3a, 0x0, 0xc0, 0xe6, 
-0x3, 0x3d, 0x20, 0x22, 0xc5, 0x37, 0xcd, 0x6, 0xc0, 0x30, 0x1a, 0xd5, 0x23, 0xeb, 0x21, 0xda, 
-0xb8, 0xed, 0x4b, 0xd6, 0xb8, 0x6, 0x0, 0x9, 0x9, 0x73, 0x23, 0x72, 0x21, 0xfc, 0xff, 0x19, 
-0xcd, 0xa0, 0x2, 0x2b, 0xd1, 0xc1, 0xc3, 0x87, 0xba, 0x7e, 0xbb, 0x23, 0x7e, 0x2b, 0x20, 0x3, 
-0xba, 0x37, 0xc8, 0xb7, 0xc8, 0x6e, 0x67, 0x18, 0xf0, 0xeb, 0xf3, 0xcd, 0x69, 0x3, 0x38, 0x6, 
-0x73, 0x23, 0x72, 0x13, 0xaf, 0x12, 0xfb, 0xc9, 0xeb, 0xf3, 0xcd, 0x69, 0x3, 0x30, 0x6, 0x1a, 
-0x77, 0x13, 0x23, 0x1a, 0x77, 0xfb, 0xc9, 0xf3, 0xd9, 0x21, 0xd5, 0xb8, 0x56, 0x77, 0xf6, 0xc0, 
-0xed, 0x79, 0x7a, 0xd9, 0xfb, 0xc9, 0xc3, 0x5f, 0xba, 0xc3, 0x66, 0xba, 0xc3, 0x51, 0xba, 0xc3, 
-0x58, 0xba, 0xc3, 0x70, 0xba, 0xc3, 0x79, 0xba, 0xc3, 0x9d, 0xba, 0xc3, 0x7e, 0xba, 0xc3, 0x87, 
-0xba, 0xc3, 0xa1, 0xba, 0xc3, 0xa7, 0xba, 0x3a, 0xc1, 0xb8, 0xb7, 0xc8, 0xe5, 0xf3, 0x18, 0x6, 
-0x21, 0xbf, 0xb8, 0x36, 0x1, 0xc9, 0x2a, 0xc0, 0xb8, 0x7c, 0xb7, 0x28, 0x7, 0x23, 0x23, 0x23, 
-0x3a, 0xc2, 0xb8, 0xbe, 0xe1, 0xfb, 0xc9, 0xf3, 0x8, 0x38, 0x33, 0xd9, 0x79, 0x37, 0xfb, 0x8, 
-0xf3, 0xf5, 0xcb, 0x91, 0xed, 0x49, 0xcd, 0xb1, 0x0, 0xb7, 0x8, 0x4f, 0x6, 0x7f, 0x3a, 0x31, 
-0xb8, 0xb7, 0x28, 0x14, 0xfa, 0x72, 0xb9, 0x79, 0xe6, 0xc, 0xf5, 0xcb, 0x91, 0xd9, 0xcd, 0xa, 
-0x1, 0xd9, 0xe1, 0x79, 0xe6, 0xf3, 0xb4, 0x4f, 0xed, 0x49, 0xd9, 0xf1, 0xfb, 0xc9, 0x8, 0xe1, 
-0xf5, 0xcb, 0xd1, 0xed, 0x49, 0xcd, 0x3b, 0x0, 0x18, 0xcf, 0xf3, 0xe5, 0xd9, 0xd1, 0x18, 0x6, 
-0xf3, 0xd9, 0xe1, 0x5e, 0x23, 0x56, 0x8, 0x7a, 0xcb, 0xba, 0xcb, 0xb2, 0x7, 0x7, 0x7, 0x7, 
-0xa9, 0xe6, 0xc, 0xa9, 0xc5, 0xcd, 0xb0, 0xb9, 0xf3, 0xd9, 0x8, 0x79, 0xc1, 0xe6, 0x3, 0xcb, 
-0x89, 0xcb, 0x81, 0xb1, 0x18, 0x1, 0xd5, 0x4f, 0xed, 0x49, 0xb7, 0x8, 0xd9, 0xfb, 0xc9, 0xf3, 
-0x8, 0x79, 0xe5, 0xd9, 0xd1, 0x18, 0x15, 0xf3, 0xe5, 0xd9, 0xe1, 0x18, 0x9, 0xf3, 0xd9, 0xe1, 
-0x5e, 0x23, 0x56, 0x23, 0xe5, 0xeb, 0x5e, 0x23, 0x56, 0x23, 0x8, 0x7e, 0xfe, 0xfc, 0x30, 0xbe, 
-0x6, 0xdf, 0xed, 0x79, 0x21, 0xd6, 0xb8, 0x46, 0x77, 0xc5, 0xfd, 0xe5, 0xfe, 0x10, 0x30, 0xf, 
-0x87, 0xc6, 0xda, 0x6f, 0xce, 0xb8, 0x95, 0x67, 0x7e, 0x23, 0x66, 0x6f, 0xe5, 0xfd, 0xe1, 0x6, 
-0x7f, 0x79, 0xcb, 0xd7, 0xcb, 0x9f, 0xcd, 0xb0, 0xb9, 0xfd, 0xe1, 0xf3, 0xd9, 0x8, 0x59, 0xc1, 
-0x78, 0x6, 0xdf, 0xed, 0x79, 0x32, 0xd6, 0xb8, 0x6, 0x7f, 0x7b, 0x18, 0x90, 0xf3, 0xe5, 0xd9, 
-0xd1, 0x18, 0x8, 0xf3, 0xd9, 0xe1, 0x5e, 0x23, 0x56, 0x23, 0xe5, 0x8, 0x7a, 0xcb, 0xfa, 0xcb, 
-0xf2, 0xe6, 0xc0, 0x7, 0x7, 0x21, 0xd9, 0xb8, 0x86, 0x18, 0xa5, 0xf3, 0xd9, 0xe1, 0x5e, 0x23, 
-0x56, 0xcb, 0x91, 0xed, 0x49, 0xed, 0x53, 0x46, 0xba, 0xd9, 0xfb, 0xcd, 0x45, 0xba, 0xf3, 0xd9, 
-0xcb, 0xd1, 0xed, 0x49, 0xd9, 0xfb, 0xc9, 0xf3, 0xd9, 0x79, 0xcb, 0x91, 0x18, 0x13, 0xf3, 0xd9, 
-0x79, 0xcb, 0xd1, 0x18, 0xc, 0xf3, 0xd9, 0x79, 0xcb, 0x99, 0x18, 0x5, 0xf3, 0xd9, 0x79, 0xcb, 
-0xd9, 0xed, 0x49, 0xd9, 0xfb, 0xc9, 0xf3, 0xd9, 0xa9, 0xe6, 0xc, 0xa9, 0x4f, 0x18, 0xf2, 0xcd, 
-0x5f, 0xba, 0x18, 0xf, 0xcd, 0x79, 0xba, 0x3a, 0x0, 0xc0, 0x2a, 0x1, 0xc0, 0xf5, 0x78, 0xcd, 
-0x70, 0xba, 0xf1, 0xe5, 0xf3, 0x6, 0xdf, 0xed, 0x49, 0x21, 0xd6, 0xb8, 0x46, 0x71, 0x48, 0x47, 
-0xfb, 0xe1, 0xc9, 0x3a, 0xd6, 0xb8, 0xc9, 0xcd, 0xad, 0xba, 0xed, 0xb0, 0xc9, 0xcd, 0xad, 0xba, 
-0xed, 0xb8, 0xc9, 0xf3, 0xd9, 0xe1, 0xc5, 0xcb, 0xd1, 0xcb, 0xd9, 0xed, 0x49, 0xcd, 0xc2, 0xba, 
-0xf3, 0xd9, 0xc1, 0xed, 0x49, 0xd9, 0xfb, 0xc9, 0xe5, 0xd9, 0xfb, 0xc9, 0xf3, 0xd9, 0x59, 0xcb, 
-0xd3, 0xcb, 0xdb, 0xed, 0x59, 0xd9, 0x7e, 0xd9, 0xed, 0x49, 0xd9, 0xfb, 0xc9, 0xd9, 0x79, 0xf6, 
-0xc, 0xed, 0x79, 0xdd, 0x7e, 0x0, 0xed, 0x49, 0xd9, 0xc9, 0x26, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 
-0xc7, 0xf3, 0x1, 0x82, 0xf7, 0xed, 0x49, 0x1, 0x0, 0xf4, 0xed, 0x49, 0x1, 0x0, 0xf6, 0xed, 
-0x49, 0x1, 0x7f, 0xef, 0xed, 0x49, 0x6, 0xf5, 0xed, 0x78, 0xe6, 0x10, 0x21, 0xd5, 0x5, 0x20, 
-0x3, 0x21, 0xe5, 0x5, 0x1, 0xf, 0xbc, 0xed, 0x49, 0x2b, 0x7e, 0x4, 0xed, 0x79, 0x5, 0xd, 
-0xf2, 0xb7, 0x5, 0x18, 0x20, 0x3f, 0x28, 0x2e, 0x8e, 0x26, 0x0, 0x19, 0x1e, 0x0, 0x7, 0x0, 
-0x0, 0x30, 0x0, 0xc0, 0x0, 0x3f, 0x28, 0x2e, 0x8e, 0x1f, 0x6, 0x19, 0x1b, 0x0, 0x7, 0x0, 
-0x0, 0x30, 0x0, 0xc0, 0x0, 0x11, 0x77, 0x6, 0x21, 0x0, 0x0, 0x18, 0x32, 0x31, 0x0, 0xc0, 
-0xe5, 0xcd, 0xe9, 0x1f, 0xf3, 0x1, 0xff, 0xf8, 0xed, 0x49, 0xcd, 0x5c, 0x0, 0xe1, 0xd5, 0xc5, 
-0xe5, 0xcd, 0x98, 0x1b, 0xcd, 0x84, 0x10, 0xcd, 0xd0, 0xa, 0xcd, 0x5f, 0xba, 0xe1, 0xcd, 0x1e, 
-0x0, 0xc1, 0xd1, 0x38, 0x7, 0xeb, 0x48, 0x11, 0xf9, 0x6, 0x18, 0x3, 0x11, 0x37, 0x7, 0xf3, 
-0xed, 0x56, 0xd9, 0x1, 0x0, 0xdf, 0xed, 0x49, 0x1, 0xff, 0xf8, 0xed, 0x49, 0x1, 0xc0, 0x7f, 
-0xed, 0x49, 0x1, 0x7e, 0xfa, 0xaf, 0xed, 0x79, 0x21, 0x0, 0xb1, 0x11, 0x1, 0xb1, 0x1, 0xf9, 
-0x7, 0x77, 0xed, 0xb0, 0x1, 0x89, 0x7f, 0xed, 0x49, 0xd9, 0xaf, 0x8, 0x31, 0x0, 0xc0, 0xe5, 
-0xc5, 0xd5, 0xcd, 0x44, 0x0, 0xcd, 0xbd, 0x8, 0xcd, 0x5c, 0x1b, 0xcd, 0xe9, 0x1f, 0xcd, 0xbf, 
-0xa, 0xcd, 0x74, 0x10, 0xcd, 0xa8, 0x15, 0xcd, 0xbc, 0x24, 0xcd, 0xe0, 0x7, 0xfb, 0xe1, 0xcd, 
-0x1e, 0x0, 0xc1, 0xe1, 0xc3, 0x77, 0x0, 0x21, 0x2, 0x2, 0xcd, 0x70, 0x11, 0xcd, 0x23, 0x7, 
-0xcd, 0xfc, 0x6, 0x21, 0x88, 0x6, 0x18, 0x74, 0x20, 0x31, 0x32, 0x38, 0x4b, 0x20, 0x4d, 0x69, 
-0x63, 0x72, 0x6f, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20, 0x20, 0x28, 0x76, 0x33, 
-0x29, 0x1f, 0x2, 0x4, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x1f, 0x2, 0x4, 
-0xa4, 0x31, 0x39, 0x38, 0x35, 0x20, 0x41, 0x6d, 0x73, 0x74, 0x72, 0x61, 0x64, 0x20, 0x43, 0x6f, 
-0x6e, 0x73, 0x75, 0x6d, 0x65, 0x72, 0x20, 0x45, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x6f, 0x6e, 0x69, 
-0x63, 0x73, 0x20, 0x70, 0x6c, 0x63, 0x1f, 0xc, 0x5, 0x61, 0x6e, 0x64, 0x20, 0x4c, 0x6f, 0x63, 
-0x6f, 0x6d, 0x6f, 0x74, 0x69, 0x76, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 
-0x20, 0x4c, 0x74, 0x64, 0x2e, 0x1f, 0x1, 0x7, 0x0, 0x21, 0x5, 0x7, 0x7e, 0x23, 0xb7, 0xc8, 
-0xcd, 0xfe, 0x13, 0x18, 0xf7, 0x2a, 0x2a, 0x2a, 0x20, 0x50, 0x52, 0x4f, 0x47, 0x52, 0x41, 0x4d, 
-0x20, 0x4c, 0x4f, 0x41, 0x44, 0x20, 0x46, 0x41, 0x49, 0x4c, 0x45, 0x44, 0x20, 0x2a, 0x2a, 0x2a, 
-0xd, 0xa, 0x0, 0x6, 0xf5, 0xed, 0x78, 0x2f, 0xe6, 0xe, 0xf, 0x21, 0x38, 0x7, 0x3c, 0x47, 
-0x7e, 0x23, 0xb7, 0x20, 0xfb, 0x10, 0xf9, 0xc9, 0x41, 0x72, 0x6e, 0x6f, 0x6c, 0x64, 0x0, 0x41, 
-0x6d, 0x73, 0x74, 0x72, 0x61, 0x64, 0x0, 0x4f, 0x72, 0x69, 0x6f, 0x6e, 0x0, 0x53, 0x63, 0x68, 
-0x6e, 0x65, 0x69, 0x64, 0x65, 0x72, 0x0, 0x41, 0x77, 0x61, 0x0, 0x53, 0x6f, 0x6c, 0x61, 0x76, 
-0x6f, 0x78, 0x0, 0x53, 0x61, 0x69, 0x73, 0x68, 0x6f, 0x0, 0x54, 0x72, 0x69, 0x75, 0x6d, 0x70, 
-0x68, 0x0, 0x49, 0x73, 0x70, 0x0, 0xfe, 0x3, 0xd0, 0xf3, 0xd9, 0xcb, 0x89, 0xcb, 0x81, 0xb1, 
-0x4f, 0xed, 0x49, 0xfb, 0xd9, 0xc9, 0xe5, 0x21, 0x0, 0x0, 0x18, 0x4, 0xe5, 0x21, 0x1, 0x0, 
-0xd5, 0xc5, 0xeb, 0x1, 0x10, 0x7f, 0xcd, 0xaa, 0x7, 0x23, 0xe, 0x0, 0xcd, 0xaa, 0x7, 0x19, 
-0xc, 0x79, 0xfe, 0x10, 0x20, 0xf6, 0xc1, 0xd1, 0xe1, 0xc9, 0xed, 0x49, 0x7e, 0xe6, 0x1f, 0xf6, 
-0x40, 0xed, 0x79, 0xc9, 0xf5, 0xc5, 0x6, 0xf5, 0xed, 0x78, 0x1f, 0x30, 0xfb, 0xc1, 0xf1, 0xc9, 
-0xc5, 0xf, 0xf, 0xe6, 0x30, 0x4f, 0x7c, 0x1f, 0xe6, 0x3, 0xb1, 0x1, 0xc, 0xbc, 0xed, 0x49, 
-0x4, 0xed, 0x79, 0x5, 0xc, 0xed, 0x49, 0x4, 0x7c, 0x1f, 0x7d, 0x1f, 0xed, 0x79, 0xc1, 0xc9, 
-0x21, 0xf7, 0x7, 0x11, 0x4, 0xb8, 0x1, 0x15, 0x0, 0xed, 0xb0, 0x21, 0xf1, 0x7, 0xc3, 0xb4, 
-0xa, 0x3, 0xf1, 0xbd, 0xc3, 0x35, 0x8, 0xa, 0xa0, 0x5e, 0xa1, 0x5c, 0xa2, 0x7b, 0xa3, 0x23, 
-0xa6, 0x40, 0xab, 0x7c, 0xac, 0x7d, 0xad, 0x7e, 0xae, 0x5d, 0xaf, 0x5b, 0xe7, 0x87, 0x3c, 0x4f, 
-0x6, 0x0, 0x11, 0x4, 0xb8, 0xfe, 0x2a, 0xdc, 0xa1, 0xba, 0xc9, 0xc5, 0xe5, 0x21, 0x4, 0xb8, 
-0x46, 0x4, 0x5, 0x28, 0xa, 0x23, 0xbe, 0x23, 0x20, 0xf8, 0x7e, 0xfe, 0xff, 0x28, 0x3, 0xcd, 
-0xf1, 0xbd, 0xe1, 0xc1, 0xc9, 0x1, 0x32, 0x0, 0xcd, 0x58, 0x8, 0x30, 0x7, 0x10, 0xf9, 0xd, 
-0x20, 0xf6, 0xb7, 0xc9, 0xc5, 0x6, 0xef, 0xe6, 0x7f, 0xed, 0x79, 0xf6, 0x80, 0xf3, 0xed, 0x79, 
-0xe6, 0x7f, 0xfb, 0xed, 0x79, 0xc1, 0x37, 0xc9, 0xc5, 0x4f, 0x6, 0xf5, 0xed, 0x78, 0x17, 0x17, 
-0x79, 0xc1, 0xc9, 0xf3, 0x6, 0xf4, 0xed, 0x79, 0x6, 0xf6, 0xed, 0x78, 0xf6, 0xc0, 0xed, 0x79, 
-0xe6, 0x3f, 0xed, 0x79, 0x6, 0xf4, 0xed, 0x49, 0x6, 0xf6, 0x4f, 0xf6, 0x80, 0xed, 0x79, 0xed, 
-0x49, 0xfb, 0xc9, 0x1, 0xe, 0xf4, 0xed, 0x49, 0x6, 0xf6, 0xed, 0x78, 0xe6, 0x30, 0x4f, 0xf6, 
-0xc0, 0xed, 0x79, 0xed, 0x49, 0x4, 0x3e, 0x92, 0xed, 0x79, 0xc5, 0xcb, 0xf1, 0x6, 0xf6, 0xed, 
-0x49, 0x6, 0xf4, 0xed, 0x78, 0x46, 0x77, 0xa0, 0x2f, 0x12, 0x23, 0x13, 0xc, 0x79, 0xe6, 0xf, 
-0xfe, 0xa, 0x20, 0xe9, 0xc1, 0x3e, 0x82, 0xed, 0x79, 0x5, 0xed, 0x49, 0xc9, 0x21, 0xde, 0x8, 
-0x11, 0x0, 0xbb, 0x1, 0xcf, 0xcb, 0xcd, 0xcc, 0x8, 0x1, 0xef, 0x20, 0x79, 0x12, 0x13, 0xed, 
-0xa0, 0x3, 0x2f, 0x7, 0x7, 0xe6, 0x80, 0xb6, 0x12, 0x13, 0x23, 0x10, 0xef, 0xc9, 0x5c, 0x1b, 
-0x98, 0x1b, 0xbf, 0x1b, 0xc5, 0x1b, 0xfa, 0x1b, 0x46, 0x1c, 0xb3, 0x1c, 0x4, 0x1c, 0xdb, 0x1c, 
-0xe1, 0x1c, 0x45, 0x1e, 0x38, 0x1d, 0xe5, 0x1d, 0xd8, 0x1e, 0xc4, 0x1e, 0xdd, 0x1e, 0xc9, 0x1e, 
-0xe2, 0x1e, 0xce, 0x1e, 0x34, 0x1e, 0x2f, 0x1e, 0xf6, 0x1d, 0xf2, 0x1d, 0xfa, 0x1d, 0xb, 0x1e, 
-0x19, 0x1e, 0x74, 0x10, 0x84, 0x10, 0x59, 0x14, 0x52, 0x14, 0xfe, 0x13, 0x35, 0x13, 0xac, 0x13, 
-0xa8, 0x13, 0x8, 0x12, 0x52, 0x12, 0x4f, 0x15, 0x5a, 0x11, 0x65, 0x11, 0x70, 0x11, 0x7c, 0x11, 
-0x86, 0x12, 0x97, 0x12, 0x76, 0x12, 0x7e, 0x12, 0xca, 0x11, 0x65, 0x12, 0x65, 0x12, 0xa6, 0x12, 
-0xba, 0x12, 0xab, 0x12, 0xc0, 0x12, 0xc6, 0x12, 0x7b, 0x13, 0x88, 0x13, 0xd4, 0x12, 0xf2, 0x12, 
-0xfe, 0x12, 0x2b, 0x13, 0xd4, 0x14, 0xe4, 0x10, 0x3, 0x11, 0xa8, 0x15, 0xd7, 0x15, 0xfe, 0x15, 
-0xfb, 0x15, 0x6, 0x16, 0xe, 0x16, 0x1c, 0x16, 0xa5, 0x16, 0xea, 0x16, 0x17, 0x17, 0x2d, 0x17, 
-0x36, 0x17, 0x67, 0x17, 0x75, 0x17, 0x6e, 0x17, 0x7a, 0x17, 0x83, 0x17, 0x80, 0x17, 0x97, 0x17, 
-0x94, 0x17, 0xa9, 0x17, 0xa6, 0x17, 0x40, 0x19, 0xbf, 0xa, 0xd0, 0xa, 0x37, 0xb, 0x3c, 0xb, 
-0x56, 0xb, 0xe9, 0xa, 0xc, 0xb, 0x17, 0xb, 0x5d, 0xb, 0x6a, 0xb, 0xaf, 0xb, 0x5, 0xc, 
-0x11, 0xc, 0x1f, 0xc, 0x39, 0xc, 0x8e, 0xc, 0xa7, 0xc, 0xf2, 0xc, 0x1a, 0xd, 0xf7, 0xc, 
-0x1f, 0xd, 0xea, 0xc, 0xee, 0xc, 0xb9, 0xd, 0xbd, 0xd, 0xe5, 0xd, 0x0, 0xe, 0x44, 0xe, 
-0xf9, 0xe, 0x2a, 0xf, 0x55, 0xc, 0x74, 0xc, 0x93, 0xf, 0x9b, 0xf, 0xbc, 0x24, 0xce, 0x24, 
-0xe1, 0x24, 0xbb, 0x2b, 0xbf, 0x2b, 0xc1, 0x2b, 0xe5, 0x24, 0x50, 0x25, 0x57, 0x25, 0xa0, 0x25, 
-0x18, 0x26, 0x7, 0x26, 0x3, 0x26, 0xfe, 0x24, 0x7f, 0x25, 0x99, 0x25, 0xc6, 0x25, 0x53, 0x26, 
-0x92, 0x26, 0xaf, 0x29, 0xa6, 0x29, 0xc1, 0x29, 0xe9, 0x1f, 0x14, 0x21, 0xce, 0x21, 0xeb, 0x21, 
-0xac, 0x21, 0x50, 0x20, 0x6b, 0x20, 0x95, 0x24, 0x9a, 0x24, 0xa6, 0x24, 0xab, 0x24, 0x5c, 0x0, 
-0x26, 0x3, 0x30, 0x3, 0xa0, 0x2, 0xb1, 0x2, 0x63, 0x1, 0x6a, 0x1, 0x70, 0x1, 0x76, 0x1, 
-0x7d, 0x1, 0x83, 0x1, 0xb3, 0x1, 0xc5, 0x1, 0xd2, 0x1, 0xe2, 0x1, 0x27, 0x2, 0x84, 0x2, 
-0x55, 0x2, 0x19, 0x2, 0x76, 0x2, 0x94, 0x2, 0x9a, 0x2, 0x8d, 0x2, 0x99, 0x0, 0xa3, 0x0, 
-0xed, 0x5, 0x1c, 0x6, 0xb4, 0x7, 0x76, 0x7, 0xc0, 0x7, 0x86, 0x7, 0x8c, 0x7, 0xe0, 0x7, 
-0x1b, 0x8, 0x58, 0x8, 0x44, 0x8, 0x63, 0x8, 0xbd, 0x8, 0x3c, 0x1d, 0xfe, 0x1b, 0x60, 0x14, 
-0xec, 0x15, 0xd5, 0x19, 0xb0, 0x17, 0xac, 0x17, 0x2a, 0x16, 0xd9, 0x19, 0x45, 0xb, 0xc, 0x8, 
-0x97, 0x3, 0x2, 0x2c, 0x91, 0x2f, 0x9f, 0x2f, 0xc8, 0x2f, 0xd9, 0x2f, 0x1, 0x30, 0x14, 0x30, 
-0x55, 0x30, 0x5f, 0x30, 0xc6, 0x30, 0xa2, 0x34, 0x59, 0x31, 0x9e, 0x34, 0x77, 0x35, 0x4, 0x36, 
-0x88, 0x31, 0xdf, 0x36, 0x31, 0x37, 0x27, 0x37, 0x45, 0x33, 0x73, 0x2f, 0xac, 0x32, 0xaf, 0x32, 
-0xb6, 0x31, 0xb1, 0x31, 0x2f, 0x32, 0x53, 0x33, 0x49, 0x33, 0xc8, 0x33, 0xd8, 0x33, 0xd1, 0x2f, 
-0x36, 0x31, 0x43, 0x31, 0x4e, 0x6, 0x0, 0x23, 0x5e, 0x23, 0x56, 0x23, 0xed, 0xb0, 0xc9, 0x11, 
-0x52, 0x10, 0xcd, 0x86, 0x7, 0x3e, 0xc0, 0x32, 0xc6, 0xb7, 0xcd, 0xd0, 0xa, 0xc3, 0x12, 0xb, 
-0xaf, 0xcd, 0x55, 0xc, 0x21, 0xdd, 0xa, 0xcd, 0xb4, 0xa, 0xc3, 0xd8, 0xc, 0x9, 0xe5, 0xbd, 
-0xc3, 0x8a, 0xc, 0xc3, 0x71, 0xc, 0xc3, 0x17, 0xb, 0xe6, 0x3, 0xfe, 0x3, 0xd0, 0xf5, 0xcd, 
-0x55, 0xd, 0xd1, 0xcd, 0xb3, 0x10, 0xf5, 0xcd, 0xce, 0x15, 0xe5, 0x7a, 0xcd, 0x31, 0xb, 0xcd, 
-0xeb, 0xbd, 0xe1, 0xcd, 0xae, 0x15, 0xf1, 0xcd, 0xd1, 0x10, 0x18, 0x22, 0x3a, 0xc3, 0xb7, 0xfe, 
-0x1, 0xc9, 0x3e, 0x1, 0xcd, 0x31, 0xb, 0xcd, 0x55, 0xd, 0x21, 0x0, 0x0, 0xcd, 0x37, 0xb, 
-0x2a, 0xc5, 0xb7, 0x2e, 0x0, 0x54, 0x1e, 0x1, 0x1, 0xff, 0x3f, 0x75, 0xed, 0xb0, 0xc3, 0x42, 
-0xd, 0x32, 0xc3, 0xb7, 0xc3, 0x76, 0x7, 0x3a, 0xc6, 0xb7, 0x18, 0x3, 0x2a, 0xc4, 0xb7, 0xcd, 
-0x45, 0xb, 0xc3, 0xc0, 0x7, 0xe6, 0xc0, 0x32, 0xc6, 0xb7, 0xf5, 0x7c, 0xe6, 0x7, 0x67, 0xcb, 
-0x85, 0x22, 0xc4, 0xb7, 0xf1, 0xc9, 0x2a, 0xc4, 0xb7, 0x3a, 0xc6, 0xb7, 0xc9, 0xcd, 0xc, 0xb, 
-0x1, 0x18, 0x13, 0xd8, 0x6, 0x27, 0xc8, 0x6, 0x4f, 0xc9, 0xd5, 0xcd, 0xc, 0xb, 0x6, 0x4, 
-0x38, 0x5, 0x6, 0x2, 0x28, 0x1, 0x5, 0xc5, 0x5c, 0x16, 0x0, 0x62, 0xd5, 0x54, 0x5d, 0x29, 
-0x29, 0x19, 0x29, 0x29, 0x29, 0x29, 0xd1, 0x19, 0x10, 0xfd, 0xed, 0x5b, 0xc4, 0xb7, 0x19, 0x7c, 
-0xe6, 0x7, 0x67, 0x3a, 0xc6, 0xb7, 0x84, 0x67, 0xc1, 0xd1, 0xc9, 0x7b, 0x95, 0x3c, 0x87, 0x87, 
-0x87, 0x5f, 0x7a, 0x94, 0x3c, 0x57, 0xcd, 0x6a, 0xb, 0xaf, 0x82, 0x10, 0xfd, 0x57, 0xc9, 0xd5, 
-0xeb, 0x21, 0xc7, 0x0, 0xb7, 0xed, 0x52, 0x7d, 0xe6, 0x7, 0x87, 0x87, 0x87, 0x4f, 0x7d, 0xe6, 
-0xf8, 0x6f, 0x54, 0x5d, 0x29, 0x29, 0x19, 0x29, 0xd1, 0xc5, 0xcd, 0xf6, 0xb, 0x78, 0xa3, 0x28, 
-0x5, 0xcb, 0x9, 0x3d, 0x20, 0xfb, 0xe3, 0x61, 0x4d, 0xe3, 0x78, 0xf, 0xcb, 0x3a, 0xcb, 0x1b, 
-0xf, 0x38, 0xf9, 0x19, 0xed, 0x5b, 0xc4, 0xb7, 0x19, 0x7c, 0xe6, 0x7, 0x67, 0x3a, 0xc6, 0xb7, 
-0x84, 0x81, 0x67, 0xd1, 0x4a, 0xc9, 0xcd, 0xc, 0xb, 0x1, 0xaa, 0x1, 0xd8, 0x1, 0x88, 0x3, 
-0xc8, 0x1, 0x80, 0x7, 0xc9, 0x2c, 0xc0, 0x24, 0x7c, 0xe6, 0x7, 0xc0, 0x7c, 0xd6, 0x8, 0x67, 
-0xc9, 0x7d, 0x2d, 0xb7, 0xc0, 0x7c, 0x25, 0xe6, 0x7, 0xc0, 0x7c, 0xc6, 0x8, 0x67, 0xc9, 0x7c, 
-0xc6, 0x8, 0x67, 0xe6, 0x38, 0xc0, 0x7c, 0xd6, 0x40, 0x67, 0x7d, 0xc6, 0x50, 0x6f, 0xd0, 0x24, 
-0x7c, 0xe6, 0x7, 0xc0, 0x7c, 0xd6, 0x8, 0x67, 0xc9, 0x7c, 0xd6, 0x8, 0x67, 0xe6, 0x38, 0xfe, 
-0x38, 0xc0, 0x7c, 0xc6, 0x40, 0x67, 0x7d, 0xd6, 0x50, 0x6f, 0xd0, 0x7c, 0x25, 0xe6, 0x7, 0xc0, 
-0x7c, 0xc6, 0x8, 0x67, 0xc9, 0xe6, 0x3, 0x21, 0x74, 0xc, 0x28, 0xc, 0xfe, 0x2, 0x2e, 0x7a, 
-0x38, 0x6, 0x2e, 0x7f, 0x28, 0x2, 0x2e, 0x85, 0x3e, 0xc3, 0x32, 0xc7, 0xb7, 0x22, 0xc8, 0xb7, 
-0xc9, 0xc3, 0xc7, 0xb7, 0x78, 0xae, 0xa1, 0xae, 0x77, 0xc9, 0x78, 0xa1, 0xae, 0x77, 0xc9, 0x79, 
-0x2f, 0xb0, 0xa6, 0x77, 0xc9, 0x78, 0xa1, 0xb6, 0x77, 0xc9, 0x7e, 0xc3, 0xb2, 0xc, 0xc5, 0xd5, 
-0xcd, 0xc8, 0xc, 0x5f, 0xcd, 0xf6, 0xb, 0x6, 0x8, 0xcb, 0xb, 0x17, 0xcb, 0x9, 0x38, 0x2, 
-0xcb, 0x3, 0x10, 0xf5, 0xd1, 0xc1, 0xc9, 0xc5, 0xf5, 0xcd, 0xf6, 0xb, 0xf1, 0xcd, 0xb2, 0xc, 
-0xc1, 0xc9, 0xd5, 0x11, 0x8, 0x0, 0xf, 0xcb, 0x12, 0xcb, 0x9, 0x38, 0x2, 0xcb, 0x1a, 0x1d, 
-0x20, 0xf4, 0x7a, 0xcd, 0xc8, 0xc, 0xd1, 0xc9, 0x57, 0xcd, 0xc, 0xb, 0x7a, 0xd0, 0xf, 0xf, 
-0xce, 0x0, 0xf, 0x9f, 0xe6, 0x6, 0xaa, 0xc9, 0x21, 0x52, 0x10, 0x11, 0xd4, 0xb7, 0x1, 0x22, 
-0x0, 0xed, 0xb0, 0xaf, 0x32, 0xf6, 0xb7, 0x21, 0xa, 0xa, 0x22, 0xd2, 0xb7, 0xc9, 0x2a, 0xd2, 
-0xb7, 0xc9, 0xe6, 0xf, 0x3c, 0x18, 0x1, 0xaf, 0x5f, 0x78, 0xcd, 0x10, 0xd, 0x46, 0x79, 0xcd, 
-0x10, 0xd, 0x4e, 0x7b, 0xcd, 0x35, 0xd, 0x71, 0xeb, 0x70, 0x3e, 0xff, 0x32, 0xf7, 0xb7, 0xc9, 
-0xe6, 0x1f, 0xc6, 0x99, 0x6f, 0xce, 0xd, 0x95, 0x67, 0xc9, 0xe6, 0xf, 0x3c, 0x18, 0x1, 0xaf, 
-0xcd, 0x35, 0xd, 0x1a, 0x5e, 0xcd, 0x2a, 0xd, 0x41, 0x7b, 0xe, 0x0, 0x21, 0x99, 0xd, 0xbe, 
-0xc8, 0x23, 0xc, 0x18, 0xfa, 0x5f, 0x16, 0x0, 0x21, 0xe5, 0xb7, 0x19, 0xeb, 0x21, 0xef, 0xff, 
-0x19, 0xc9, 0x21, 0xf9, 0xb7, 0xe5, 0xcd, 0x70, 0x1, 0xcd, 0x73, 0xd, 0x11, 0x61, 0xd, 0x6, 
-0x81, 0xe1, 0xc3, 0x63, 0x1, 0x21, 0xf9, 0xb7, 0xcd, 0x70, 0x1, 0xcd, 0x87, 0xd, 0xc3, 0x86, 
-0x7, 0x21, 0xf8, 0xb7, 0x35, 0x28, 0xc, 0x2b, 0x7e, 0xb7, 0xc8, 0xcd, 0x87, 0xd, 0xcd, 0x8c, 
-0x7, 0x18, 0xf, 0xcd, 0x87, 0xd, 0x32, 0xf8, 0xb7, 0xcd, 0x8c, 0x7, 0x21, 0xf6, 0xb7, 0x7e, 
-0x2f, 0x77, 0xaf, 0x32, 0xf7, 0xb7, 0xc9, 0x11, 0xe5, 0xb7, 0x3a, 0xf6, 0xb7, 0xb7, 0x3a, 0xd3, 
-0xb7, 0xc8, 0x11, 0xd4, 0xb7, 0x3a, 0xd2, 0xb7, 0xc9, 0x14, 0x4, 0x15, 0x1c, 0x18, 0x1d, 0xc, 
-0x5, 0xd, 0x16, 0x6, 0x17, 0x1e, 0x0, 0x1f, 0xe, 0x7, 0xf, 0x12, 0x2, 0x13, 0x1a, 0x19, 
-0x1b, 0xa, 0x3, 0xb, 0x1, 0x8, 0x9, 0x10, 0x11, 0x4f, 0xcd, 0x9b, 0xb, 0xe5, 0x7a, 0xcd, 
-0xee, 0xe, 0x30, 0x9, 0x42, 0x71, 0xcd, 0x5, 0xc, 0x10, 0xfa, 0x18, 0x10, 0xc5, 0xd5, 0x71, 
-0x15, 0x28, 0x8, 0x4a, 0x6, 0x0, 0x54, 0x5d, 0x13, 0xed, 0xb0, 0xd1, 0xc1, 0xe1, 0xcd, 0x1f, 
-0xc, 0x1d, 0x20, 0xd9, 0xc9, 0x78, 0xa9, 0x4f, 0xcd, 0x6a, 0xb, 0x16, 0x8, 0xe5, 0xc5, 0x7e, 
-0xa9, 0x77, 0xcd, 0x5, 0xc, 0x10, 0xf8, 0xc1, 0xe1, 0xcd, 0x1f, 0xc, 0x15, 0x20, 0xee, 0xc9, 
-0x4f, 0xc5, 0x11, 0xd0, 0xff, 0x6, 0x30, 0xcd, 0x2a, 0xe, 0xc1, 0xcd, 0xb4, 0x7, 0x78, 0xb7, 
-0x20, 0xd, 0x11, 0xb0, 0xff, 0xcd, 0x3d, 0xe, 0x11, 0x0, 0x0, 0x6, 0x20, 0x18, 0xb, 0x11, 
-0x50, 0x0, 0xcd, 0x3d, 0xe, 0x11, 0xb0, 0xff, 0x6, 0x20, 0x2a, 0xc4, 0xb7, 0x19, 0x7c, 0xe6, 
-0x7, 0x67, 0x3a, 0xc6, 0xb7, 0x84, 0x67, 0x50, 0x1e, 0x8, 0xc3, 0xbd, 0xd, 0x2a, 0xc4, 0xb7, 
-0x19, 0xc3, 0x37, 0xb, 0xf5, 0x78, 0xb7, 0x28, 0x30, 0xe5, 0xcd, 0x9b, 0xb, 0xe3, 0x2c, 0xcd, 
-0x6a, 0xb, 0x4a, 0x7b, 0xd6, 0x8, 0x47, 0x28, 0x17, 0xd1, 0xcd, 0xb4, 0x7, 0xc5, 0xe5, 0xd5, 
-0xcd, 0xaa, 0xe, 0xe1, 0xcd, 0x1f, 0xc, 0xeb, 0xe1, 0xcd, 0x1f, 0xc, 0xc1, 0x10, 0xee, 0xd5, 
-0xe1, 0x51, 0x1e, 0x8, 0xf1, 0x4f, 0xc3, 0xbd, 0xd, 0xe5, 0xd5, 0xcd, 0x9b, 0xb, 0x4a, 0x7b, 
-0xd6, 0x8, 0x47, 0xd1, 0xe3, 0x28, 0xe9, 0xc5, 0x6b, 0x54, 0x1c, 0xcd, 0x6a, 0xb, 0xeb, 0xcd, 
-0x6a, 0xb, 0xc1, 0xcd, 0xb4, 0x7, 0xcd, 0x39, 0xc, 0xe5, 0xeb, 0xcd, 0x39, 0xc, 0xe5, 0xc5, 
-0xcd, 0xaa, 0xe, 0xc1, 0xd1, 0xe1, 0x10, 0xee, 0x18, 0xc6, 0x6, 0x0, 0xcd, 0xec, 0xe, 0x38, 
-0x16, 0xcd, 0xec, 0xe, 0x30, 0x25, 0xc5, 0xaf, 0x95, 0x4f, 0xed, 0xb0, 0xc1, 0x2f, 0x3c, 0x81, 
-0x4f, 0x7c, 0xd6, 0x8, 0x67, 0x18, 0x14, 0xcd, 0xec, 0xe, 0x38, 0x12, 0xc5, 0xaf, 0x93, 0x4f, 
-0xed, 0xb0, 0xc1, 0x2f, 0x3c, 0x81, 0x4f, 0x7a, 0xd6, 0x8, 0x57, 0xed, 0xb0, 0xc9, 0x41, 0x7e, 
-0x12, 0xcd, 0x5, 0xc, 0xeb, 0xcd, 0x5, 0xc, 0xeb, 0x10, 0xf4, 0xc9, 0x79, 0xeb, 0x3d, 0x85, 
-0xd0, 0x7c, 0xe6, 0x7, 0xee, 0x7, 0xc0, 0x37, 0xc9, 0xcd, 0xc, 0xb, 0x38, 0xd, 0x28, 0x6, 
-0x1, 0x8, 0x0, 0xed, 0xb0, 0xc9, 0x1, 0x88, 0x2, 0x18, 0x3, 0x1, 0xaa, 0x4, 0x3e, 0x8, 
-0xf5, 0xe5, 0x6e, 0x60, 0xaf, 0xcb, 0x5, 0x30, 0x1, 0xb1, 0xcb, 0x9, 0x30, 0xf7, 0x12, 0x13, 
-0x10, 0xf2, 0x44, 0xe1, 0x23, 0xf1, 0x3d, 0x20, 0xe7, 0xc9, 0x4f, 0xcd, 0x6a, 0xb, 0xcd, 0xc, 
-0xb, 0x6, 0x8, 0x38, 0x36, 0x28, 0xb, 0x7e, 0xa9, 0x2f, 0x12, 0x13, 0xcd, 0x1f, 0xc, 0x10, 
-0xf6, 0xc9, 0xc5, 0xe5, 0xd5, 0xcd, 0x5a, 0xf, 0xcd, 0x5, 0xc, 0xcd, 0x5a, 0xf, 0x7b, 0xd1, 
-0x12, 0x13, 0xe1, 0xcd, 0x1f, 0xc, 0xc1, 0x10, 0xe9, 0xc9, 0x16, 0x88, 0x6, 0x4, 0x7e, 0xa9, 
-0xa2, 0x20, 0x1, 0x37, 0xcb, 0x13, 0xcb, 0xa, 0x10, 0xf4, 0xc9, 0xc5, 0xe5, 0xd5, 0x6, 0x4, 
-0x7e, 0xa9, 0xe6, 0xaa, 0x20, 0x1, 0x37, 0xcb, 0x13, 0x7e, 0xa9, 0xe6, 0x55, 0x20, 0x1, 0x37, 
-0xcb, 0x13, 0xcd, 0x5, 0xc, 0x10, 0xe9, 0x7b, 0xd1, 0x12, 0x13, 0xe1, 0xcd, 0x1f, 0xc, 0xc1, 
-0x10, 0xd9, 0xc9, 0xcd, 0xad, 0xf, 0xcd, 0xc2, 0xf, 0x18, 0x6, 0xcd, 0xad, 0xf, 0xcd, 0x16, 
-0x10, 0x2a, 0x2, 0xb8, 0x7d, 0x32, 0xa3, 0xb6, 0x7c, 0x32, 0xb3, 0xb6, 0xc9, 0xe5, 0x2a, 0xa3, 
-0xb6, 0x32, 0xa3, 0xb6, 0x3a, 0xb3, 0xb6, 0x67, 0x3e, 0xff, 0x32, 0xb3, 0xb6, 0x22, 0x2, 0xb8, 
-0xe1, 0xc9, 0x37, 0xcd, 0x3b, 0x10, 0xcb, 0x0, 0x79, 0x30, 0x13, 0x1d, 0x20, 0x3, 0x15, 0x28, 
-0x2c, 0xcb, 0x9, 0x38, 0x28, 0xcb, 0x78, 0x28, 0x24, 0xb1, 0xcb, 0x0, 0x18, 0xed, 0x1d, 0x20, 
-0x3, 0x15, 0x28, 0xd, 0xcb, 0x9, 0x38, 0x9, 0xcb, 0x78, 0x20, 0x5, 0xb1, 0xcb, 0x0, 0x18, 
-0xed, 0xc5, 0x4f, 0x3a, 0xa4, 0xb6, 0x47, 0x3a, 0xb4, 0xb6, 0xb7, 0x18, 0x7, 0xc5, 0x4f, 0x3a, 
-0xa3, 0xb6, 0x47, 0xaf, 0xcc, 0xe8, 0xbd, 0xc1, 0xcb, 0x79, 0xc4, 0x5, 0xc, 0x7a, 0xb3, 0x20, 
-0xb5, 0x78, 0x32, 0xb3, 0xb6, 0xc9, 0xb7, 0xcd, 0x3b, 0x10, 0xcb, 0x0, 0x3a, 0xa3, 0xb6, 0x38, 
-0x9, 0x3a, 0xb4, 0xb6, 0xb7, 0x20, 0x9, 0x3a, 0xa4, 0xb6, 0xc5, 0x47, 0xcd, 0xe8, 0xbd, 0xc1, 
-0xcd, 0x39, 0xc, 0x1d, 0x20, 0xe4, 0x15, 0x20, 0xe1, 0x18, 0xd6, 0xe5, 0x30, 0x2, 0x62, 0x6b, 
-0xb7, 0xed, 0x42, 0xcd, 0x39, 0x19, 0x24, 0x2c, 0xe3, 0xcd, 0xaf, 0xb, 0x3a, 0xb3, 0xb6, 0x47, 
-0xd1, 0xc9, 0x4, 0x4, 0xa, 0x13, 0xc, 0xb, 0x14, 0x15, 0xd, 0x6, 0x1e, 0x1f, 0x7, 0x12, 
-0x19, 0x4, 0x17, 0x4, 0x4, 0xa, 0x13, 0xc, 0xb, 0x14, 0x15, 0xd, 0x6, 0x1e, 0x1f, 0x7, 
-0x12, 0x19, 0xa, 0x7, 0xcd, 0x84, 0x10, 0xaf, 0x32, 0x35, 0xb7, 0x21, 0x1, 0x0, 0xcd, 0x39, 
-0x11, 0xc3, 0x9f, 0x10, 0x21, 0x8d, 0x10, 0xcd, 0xb4, 0xa, 0xc3, 0x64, 0x14, 0xf, 0xcd, 0xbd, 
-0xc3, 0x5f, 0x12, 0xc3, 0x5f, 0x12, 0xc3, 0x4b, 0x13, 0xc3, 0xbe, 0x13, 0xc3, 0xa, 0x14, 0x3e, 
-0x8, 0x11, 0xb6, 0xb6, 0x21, 0x26, 0xb7, 0x1, 0xe, 0x0, 0xed, 0xb0, 0x3d, 0x20, 0xf5, 0x32, 
-0xb5, 0xb6, 0xc9, 0x3a, 0xb5, 0xb6, 0x4f, 0x6, 0x8, 0x78, 0x3d, 0xcd, 0xe4, 0x10, 0xcd, 0xd0, 
-0xbd, 0xcd, 0xc0, 0x12, 0x32, 0x30, 0xb7, 0xcd, 0xba, 0x12, 0x32, 0x2f, 0xb7, 0x10, 0xea, 0x79, 
-0xc9, 0x4f, 0x6, 0x8, 0x78, 0x3d, 0xcd, 0xe4, 0x10, 0xc5, 0x2a, 0x2f, 0xb7, 0xcd, 0x39, 0x11, 
-0xc1, 0x10, 0xf1, 0x79, 0xe6, 0x7, 0x21, 0xb5, 0xb6, 0xbe, 0xc8, 0xc5, 0xd5, 0x4e, 0x77, 0x47, 
-0x79, 0xcd, 0x26, 0x11, 0xcd, 0x1e, 0x11, 0x78, 0xcd, 0x26, 0x11, 0xeb, 0xcd, 0x1e, 0x11, 0x79, 
-0xd1, 0xc1, 0xc9, 0x3a, 0xb5, 0xb6, 0xf5, 0x79, 0xcd, 0xe4, 0x10, 0x78, 0x32, 0xb5, 0xb6, 0xcd, 
-0x26, 0x11, 0xd5, 0x79, 0xcd, 0x26, 0x11, 0xe1, 0xcd, 0x1e, 0x11, 0xf1, 0x18, 0xc6, 0xc5, 0x1, 
-0xe, 0x0, 0xed, 0xb0, 0xc1, 0xc9, 0xe6, 0x7, 0x5f, 0x87, 0x83, 0x87, 0x83, 0x87, 0xc6, 0xb6, 
-0x5f, 0xce, 0xb6, 0x93, 0x57, 0x21, 0x26, 0xb7, 0xc9, 0xeb, 0x3e, 0x83, 0x32, 0x2e, 0xb7, 0x7a, 
-0xcd, 0xab, 0x12, 0x7b, 0xcd, 0xa6, 0x12, 0xaf, 0xcd, 0xa8, 0x13, 0xcd, 0x7b, 0x13, 0x21, 0x0, 
-0x0, 0x11, 0x7f, 0x7f, 0xcd, 0x8, 0x12, 0xc3, 0x59, 0x14, 0x3d, 0x21, 0x2a, 0xb7, 0x86, 0x2a, 
-0x26, 0xb7, 0x67, 0x18, 0xe, 0x3d, 0x21, 0x29, 0xb7, 0x86, 0x2a, 0x26, 0xb7, 0x6f, 0x18, 0x3, 
-0xcd, 0x86, 0x11, 0xcd, 0xd0, 0xbd, 0x22, 0x26, 0xb7, 0xc3, 0xcd, 0xbd, 0x2a, 0x26, 0xb7, 0xcd, 
-0x93, 0x11, 0x3a, 0x2d, 0xb7, 0xc9, 0x3a, 0x29, 0xb7, 0x3d, 0x85, 0x6f, 0x3a, 0x2a, 0xb7, 0x3d, 
-0x84, 0x67, 0xc9, 0x3a, 0x29, 0xb7, 0x95, 0x2f, 0x3c, 0x3c, 0x6f, 0x3a, 0x2a, 0xb7, 0x94, 0x2f, 
-0x3c, 0x3c, 0x67, 0xc9, 0xcd, 0xd0, 0xbd, 0x2a, 0x26, 0xb7, 0xcd, 0xd6, 0x11, 0x22, 0x26, 0xb7, 
-0xd8, 0xe5, 0x21, 0x2d, 0xb7, 0x78, 0x87, 0x3c, 0x86, 0x77, 0xcd, 0x52, 0x12, 0x3a, 0x30, 0xb7, 
-0xf5, 0xdc, 0x44, 0xe, 0xf1, 0xd4, 0x0, 0xe, 0xe1, 0xc9, 0xcd, 0x86, 0x11, 0xcd, 0xd6, 0x11, 
-0xf5, 0xcd, 0x93, 0x11, 0xf1, 0xc9, 0x3a, 0x2c, 0xb7, 0xbc, 0xf2, 0xe2, 0x11, 0x3a, 0x2a, 0xb7, 
-0x67, 0x2c, 0x3a, 0x2a, 0xb7, 0x3d, 0xbc, 0xfa, 0xef, 0x11, 0x3a, 0x2c, 0xb7, 0x67, 0x2d, 0x3a, 
-0x29, 0xb7, 0x3d, 0xbd, 0xf2, 0x2, 0x12, 0x3a, 0x2b, 0xb7, 0xbd, 0x37, 0xf0, 0x6f, 0x6, 0xff, 
-0xb7, 0xc9, 0x3c, 0x6f, 0x6, 0x0, 0xb7, 0xc9, 0xcd, 0x5d, 0xb, 0x7c, 0xcd, 0x40, 0x12, 0x67, 
-0x7a, 0xcd, 0x40, 0x12, 0x57, 0xbc, 0x30, 0x2, 0x54, 0x67, 0x7d, 0xcd, 0x49, 0x12, 0x6f, 0x7b, 
-0xcd, 0x49, 0x12, 0x5f, 0xbd, 0x30, 0x2, 0x5d, 0x6f, 0x22, 0x29, 0xb7, 0xed, 0x53, 0x2b, 0xb7, 
-0x7c, 0xb5, 0x20, 0x6, 0x7a, 0xa8, 0x20, 0x2, 0x7b, 0xa9, 0x32, 0x28, 0xb7, 0xc3, 0x73, 0x11, 
-0xb7, 0xf2, 0x45, 0x12, 0xaf, 0xb8, 0xd8, 0x78, 0xc9, 0xb7, 0xf2, 0x4e, 0x12, 0xaf, 0xb9, 0xd8, 
-0x79, 0xc9, 0x2a, 0x29, 0xb7, 0xed, 0x5b, 0x2b, 0xb7, 0x3a, 0x28, 0xb7, 0xc6, 0xff, 0xc9, 0x3a, 
-0x2e, 0xb7, 0xe6, 0x3, 0xc0, 0xc5, 0xd5, 0xe5, 0xcd, 0xa7, 0x11, 0xed, 0x4b, 0x2f, 0xb7, 0xcd, 
-0xe5, 0xd, 0xe1, 0xd1, 0xc1, 0xc9, 0xf5, 0x3e, 0xfd, 0xcd, 0x88, 0x12, 0xf1, 0xc9, 0xf5, 0x3e, 
-0x2, 0xcd, 0x99, 0x12, 0xf1, 0xc9, 0x3e, 0xfe, 0xf5, 0xcd, 0xd0, 0xbd, 0xf1, 0xe5, 0x21, 0x2e, 
-0xb7, 0xa6, 0x77, 0xe1, 0xc3, 0xcd, 0xbd, 0x3e, 0x1, 0xf5, 0xcd, 0xd0, 0xbd, 0xf1, 0xe5, 0x21, 
-0x2e, 0xb7, 0xb6, 0x77, 0xe1, 0xc9, 0x21, 0x2f, 0xb7, 0x18, 0x3, 0x21, 0x30, 0xb7, 0xf5, 0xcd, 
-0xd0, 0xbd, 0xf1, 0xcd, 0x8e, 0xc, 0x77, 0xc3, 0xcd, 0xbd, 0x3a, 0x2f, 0xb7, 0xc3, 0xa7, 0xc, 
-0x3a, 0x30, 0xb7, 0xc3, 0xa7, 0xc, 0xcd, 0xd0, 0xbd, 0x2a, 0x2f, 0xb7, 0x7c, 0x65, 0x6f, 0x22, 
-0x2f, 0xb7, 0x18, 0xe3, 0xd5, 0x5f, 0xcd, 0x2b, 0x13, 0x30, 0x9, 0x57, 0x7b, 0x92, 0x3f, 0x30, 
-0x3, 0x5f, 0x18, 0x3, 0x21, 0x0, 0x38, 0xf5, 0x16, 0x0, 0xeb, 0x29, 0x29, 0x29, 0x19, 0xf1, 
-0xd1, 0xc9, 0xeb, 0xcd, 0xd4, 0x12, 0xd0, 0xeb, 0x1, 0x8, 0x0, 0xed, 0xb0, 0xc9, 0xe5, 0x7a, 
-0xb7, 0x16, 0x0, 0x20, 0x19, 0x15, 0xd5, 0x4b, 0xeb, 0x79, 0xcd, 0xd4, 0x12, 0x7c, 0xaa, 0x20, 
-0x4, 0x7d, 0xab, 0x28, 0x8, 0xc5, 0xcd, 0xf8, 0x12, 0xc1, 0xc, 0x20, 0xec, 0xd1, 0xcd, 0x2b, 
-0x13, 0xed, 0x53, 0x34, 0xb7, 0xd1, 0xed, 0x53, 0x36, 0xb7, 0xc9, 0x2a, 0x34, 0xb7, 0x7c, 0xf, 
-0x7d, 0x2a, 0x36, 0xb7, 0xc9, 0x47, 0x3a, 0x2e, 0xb7, 0x7, 0xd8, 0xc5, 0xcd, 0xa4, 0x11, 0x24, 
-0x22, 0x26, 0xb7, 0x25, 0xf1, 0xcd, 0xd3, 0xbd, 0xc3, 0xcd, 0xbd, 0xe5, 0xcd, 0xd4, 0x12, 0x11, 
-0x38, 0xb7, 0xd5, 0xcd, 0xf9, 0xe, 0xd1, 0xe1, 0xcd, 0x6a, 0xb, 0xe, 0x8, 0xc5, 0xe5, 0xc5, 
-0xd5, 0xeb, 0x4e, 0xcd, 0x77, 0x13, 0xcd, 0x5, 0xc, 0xd1, 0x13, 0xc1, 0x10, 0xf1, 0xe1, 0xcd, 
-0x1f, 0xc, 0xc1, 0xd, 0x20, 0xe7, 0xc9, 0x2a, 0x31, 0xb7, 0xe9, 0x21, 0x92, 0x13, 0xb7, 0x28, 
-0x3, 0x21, 0xa0, 0x13, 0x22, 0x31, 0xb7, 0xc9, 0x2a, 0x31, 0xb7, 0x11, 0x6e, 0xec, 0x19, 0x7c, 
-0xb5, 0xc9, 0x2a, 0x2f, 0xb7, 0x79, 0x2f, 0xa4, 0x47, 0x79, 0xa5, 0xb0, 0xe, 0xff, 0x18, 0x3, 
-0x3a, 0x2f, 0xb7, 0x47, 0xeb, 0xc3, 0x74, 0xc, 0x32, 0x33, 0xb7, 0xc9, 0xe5, 0xd5, 0xc5, 0xcd, 
-0xa4, 0x11, 0xcd, 0xd6, 0xbd, 0xf5, 0xcd, 0xcd, 0xbd, 0xf1, 0xc1, 0xd1, 0xe1, 0xc9, 0x3a, 0x30, 
-0xb7, 0x11, 0x38, 0xb7, 0xe5, 0xd5, 0xcd, 0x2a, 0xf, 0xd1, 0xd5, 0x6, 0x8, 0x1a, 0x2f, 0x12, 
-0x13, 0x10, 0xfa, 0xcd, 0xe1, 0x13, 0xd1, 0xe1, 0x30, 0x1, 0xc0, 0x3a, 0x2f, 0xb7, 0xcd, 0x2a, 
-0xf, 0xe, 0x0, 0x79, 0xcd, 0xd4, 0x12, 0x11, 0x38, 0xb7, 0x6, 0x8, 0x1a, 0xbe, 0x20, 0x9, 
-0x23, 0x13, 0x10, 0xf8, 0x79, 0xfe, 0x8f, 0x37, 0xc9, 0xc, 0x20, 0xe7, 0xaf, 0xc9, 0xf5, 0xc5, 
-0xd5, 0xe5, 0xcd, 0xd9, 0xbd, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0x4f, 0x3a, 0x33, 0xb7, 0xb7, 0x79, 
-0xc2, 0x40, 0x19, 0x21, 0x58, 0xb7, 0x46, 0x78, 0xfe, 0xa, 0x30, 0x31, 0xb7, 0x20, 0x6, 0x79, 
-0xfe, 0x20, 0xd2, 0x35, 0x13, 0x4, 0x70, 0x58, 0x16, 0x0, 0x19, 0x71, 0x3a, 0x59, 0xb7, 0x5f, 
-0x21, 0x63, 0xb7, 0x19, 0x19, 0x19, 0x7e, 0xe6, 0xf, 0xb8, 0xd0, 0x3a, 0x2e, 0xb7, 0xa6, 0x7, 
-0x38, 0xb, 0x23, 0x5e, 0x23, 0x56, 0x21, 0x59, 0xb7, 0x79, 0xcd, 0x16, 0x0, 0xaf, 0x32, 0x58, 
-0xb7, 0xc9, 0x3e, 0x81, 0xcd, 0x99, 0x12, 0x18, 0xf4, 0x3e, 0x7e, 0xcd, 0x88, 0x12, 0x18, 0xed, 
-0x3a, 0x2e, 0xb7, 0xc9, 0xaf, 0x32, 0x58, 0xb7, 0x21, 0x74, 0x14, 0x11, 0x63, 0xb7, 0x1, 0x60, 
-0x0, 0xed, 0xb0, 0xc9, 0x80, 0x13, 0x15, 0x81, 0x35, 0x13, 0x80, 0x97, 0x12, 0x80, 0x86, 0x12, 
-0x81, 0xe9, 0xa, 0x81, 0x40, 0x19, 0x0, 0x59, 0x14, 0x80, 0xe1, 0x14, 0x80, 0x19, 0x15, 0x80, 
-0x1e, 0x15, 0x80, 0x23, 0x15, 0x80, 0x28, 0x15, 0x80, 0x4f, 0x15, 0x80, 0x3f, 0x15, 0x81, 0xab, 
-0x12, 0x81, 0xa6, 0x12, 0x80, 0x5e, 0x15, 0x80, 0x99, 0x15, 0x80, 0x8f, 0x15, 0x80, 0x78, 0x15, 
-0x80, 0x65, 0x15, 0x80, 0x52, 0x14, 0x81, 0xec, 0x14, 0x81, 0x55, 0xc, 0x80, 0xc6, 0x12, 0x89, 
-0xd, 0x15, 0x84, 0x1, 0x15, 0x0, 0xeb, 0x14, 0x83, 0xf1, 0x14, 0x82, 0xfa, 0x14, 0x80, 0x39, 
-0x15, 0x82, 0x47, 0x15, 0x21, 0x63, 0xb7, 0xc9, 0x87, 0x0, 0x0, 0x5a, 0x0, 0x0, 0xb, 0x14, 
-0x0, 0xdd, 0xe5, 0x21, 0xd8, 0x14, 0xcd, 0x14, 0x21, 0xdd, 0xe1, 0xc9, 0xf, 0x9f, 0xc3, 0x7b, 
-0x13, 0x23, 0x7e, 0x23, 0x46, 0x23, 0x4e, 0xc3, 0xf2, 0xc, 0x23, 0x46, 0x23, 0x4e, 0xc3, 0xf7, 
-0xc, 0x23, 0x56, 0x23, 0x7e, 0x23, 0x5e, 0x23, 0x6e, 0x67, 0xc3, 0x8, 0x12, 0x23, 0x7e, 0x23, 
-0xc3, 0xf2, 0x12, 0xcd, 0xa4, 0x11, 0xc3, 0xcd, 0xbd, 0x11, 0x0, 0xff, 0x18, 0xd, 0x11, 0x0, 
-0x1, 0x18, 0x8, 0x11, 0x1, 0x0, 0x18, 0x3, 0x11, 0xff, 0x0, 0xd5, 0xcd, 0xa4, 0x11, 0xd1, 
-0x7d, 0x83, 0x6f, 0x7c, 0x82, 0x67, 0xc3, 0x76, 0x11, 0x2a, 0x29, 0xb7, 0xc3, 0x73, 0x11, 0xcd, 
-0xa4, 0x11, 0x3a, 0x2a, 0xb7, 0x18, 0xee, 0x23, 0x56, 0x23, 0x5e, 0xeb, 0xc3, 0x70, 0x11, 0xcd, 
-0xd0, 0xbd, 0x2a, 0x29, 0xb7, 0x22, 0x26, 0xb7, 0xed, 0x5b, 0x2b, 0xb7, 0x18, 0x44, 0xcd, 0xa4, 
-0x11, 0x54, 0x5d, 0x18, 0x3d, 0xcd, 0x8f, 0x15, 0x2a, 0x29, 0xb7, 0xed, 0x5b, 0x2b, 0xb7, 0x3a, 
-0x26, 0xb7, 0x6f, 0x2c, 0xbb, 0xd0, 0x18, 0x11, 0xcd, 0x99, 0x15, 0x2a, 0x29, 0xb7, 0x3a, 0x2c, 
-0xb7, 0x57, 0x3a, 0x26, 0xb7, 0x3d, 0x5f, 0xbd, 0xd8, 0x3a, 0x30, 0xb7, 0xc3, 0xb9, 0xd, 0xcd, 
-0xa4, 0x11, 0x5d, 0x3a, 0x2c, 0xb7, 0x57, 0x18, 0x9, 0xcd, 0xa4, 0x11, 0xeb, 0x6b, 0x3a, 0x2a, 
-0xb7, 0x67, 0xcd, 0x89, 0x15, 0xc3, 0xcd, 0xbd, 0xcd, 0xd7, 0x15, 0x21, 0x1, 0x0, 0x7c, 0xcd, 
-0x6e, 0x17, 0x7d, 0xcd, 0x67, 0x17, 0x21, 0x0, 0x0, 0x54, 0x5d, 0xcd, 0xe, 0x16, 0x11, 0x0, 
-0x80, 0x21, 0xff, 0x7f, 0xe5, 0xd5, 0xcd, 0xa5, 0x16, 0xe1, 0xd1, 0xc3, 0xea, 0x16, 0xcd, 0x7a, 
-0x17, 0x67, 0xcd, 0x75, 0x17, 0x6f, 0xc9, 0xcd, 0xf0, 0x15, 0x21, 0xe0, 0x15, 0xc3, 0xb4, 0xa, 
-0x9, 0xdc, 0xbd, 0xc3, 0x86, 0x17, 0xc3, 0x9a, 0x17, 0xc3, 0xb4, 0x17, 0xaf, 0xcd, 0x55, 0xc, 
-0xaf, 0xcd, 0xd5, 0x19, 0x2f, 0xcd, 0xb0, 0x17, 0xc3, 0xac, 0x17, 0xcd, 0x5d, 0x16, 0xed, 0x53, 
-0x97, 0xb6, 0x22, 0x99, 0xb6, 0xc9, 0xed, 0x5b, 0x97, 0xb6, 0x2a, 0x99, 0xb6, 0xc9, 0xed, 0x53, 
-0x93, 0xb6, 0x22, 0x95, 0xb6, 0x11, 0x0, 0x0, 0x62, 0x6b, 0x18, 0xe2, 0xed, 0x5b, 0x93, 0xb6, 
-0x2a, 0x95, 0xb6, 0xc9, 0xcd, 0x6, 0x16, 0xcd, 0xfe, 0x15, 0xe5, 0xcd, 0xc, 0xb, 0xed, 0x44, 
-0xde, 0xfd, 0x26, 0x0, 0x6f, 0xcb, 0x7a, 0x28, 0x3, 0xeb, 0x19, 0xeb, 0x2f, 0xa3, 0x5f, 0x7d, 
-0x2a, 0x93, 0xb6, 0x19, 0xf, 0xdc, 0xe5, 0x16, 0xf, 0xdc, 0xe5, 0x16, 0xd1, 0xe5, 0x7a, 0x7, 
-0x30, 0x1, 0x13, 0xcb, 0x83, 0x2a, 0x95, 0xb6, 0x19, 0xd1, 0xc3, 0xe5, 0x16, 0xe5, 0x2a, 0x97, 
-0xb6, 0x19, 0xd1, 0xe5, 0x2a, 0x99, 0xb6, 0x19, 0xd1, 0xc9, 0x2a, 0x9b, 0xb6, 0x37, 0xed, 0x52, 
-0xf2, 0x7e, 0x16, 0x2a, 0x9d, 0xb6, 0xb7, 0xed, 0x52, 0x37, 0xf0, 0xf6, 0xff, 0xc9, 0xaf, 0xc9, 
-0x2a, 0x9f, 0xb6, 0xb7, 0xed, 0x52, 0xfa, 0x7b, 0x16, 0x2a, 0xa1, 0xb6, 0x37, 0xed, 0x52, 0xf2, 
-0x7e, 0x16, 0x37, 0xc9, 0xcd, 0x27, 0x16, 0xe5, 0xcd, 0x6a, 0x16, 0xe1, 0xd0, 0xd5, 0xeb, 0xcd, 
-0x80, 0x16, 0xeb, 0xd1, 0xc9, 0xe5, 0xcd, 0xd1, 0x16, 0xd1, 0xe5, 0xcd, 0xd1, 0x16, 0xd1, 0x7b, 
-0x95, 0x7a, 0x9c, 0x38, 0x1, 0xeb, 0x7b, 0xe6, 0xf8, 0x5f, 0x7d, 0xf6, 0x7, 0x6f, 0xcd, 0xc, 
-0xb, 0x3d, 0xfc, 0xe1, 0x16, 0x3d, 0xfc, 0xe1, 0x16, 0xed, 0x53, 0x9b, 0xb6, 0x22, 0x9d, 0xb6, 
-0xc9, 0x7a, 0xb7, 0x21, 0x0, 0x0, 0xf8, 0x21, 0x7f, 0x2, 0x7b, 0x95, 0x7a, 0x9c, 0xd0, 0xeb, 
-0xc9, 0xcb, 0x2a, 0xcb, 0x1b, 0xcb, 0x2c, 0xcb, 0x1d, 0xc9, 0xe5, 0xcd, 0x3, 0x17, 0xd1, 0xe5, 
-0xcd, 0x3, 0x17, 0xd1, 0x7d, 0x93, 0x7c, 0x9a, 0x38, 0x1, 0xeb, 0xed, 0x53, 0x9f, 0xb6, 0x22, 
-0xa1, 0xb6, 0xc9, 0x7a, 0xb7, 0x21, 0x0, 0x0, 0xf8, 0xcb, 0x3a, 0xcb, 0x1b, 0x21, 0xc7, 0x0, 
-0x7b, 0x95, 0x7a, 0x9c, 0xd0, 0xeb, 0xc9, 0xed, 0x5b, 0x9b, 0xb6, 0x2a, 0x9d, 0xb6, 0xcd, 0xc, 
-0xb, 0x3d, 0xfc, 0x27, 0x17, 0x3d, 0xf0, 0x29, 0x23, 0xeb, 0x29, 0xeb, 0xc9, 0xed, 0x5b, 0x9f, 
-0xb6, 0x2a, 0xa1, 0xb6, 0x18, 0xf1, 0xcd, 0x17, 0x17, 0xb7, 0xed, 0x52, 0x23, 0xcd, 0xe5, 0x16, 
-0xcd, 0xe5, 0x16, 0xcb, 0x3d, 0x45, 0xed, 0x5b, 0xa1, 0xb6, 0x2a, 0x9f, 0xb6, 0xe5, 0xb7, 0xed, 
-0x52, 0x23, 0x4d, 0xed, 0x5b, 0x9b, 0xb6, 0xe1, 0xc5, 0xcd, 0xaf, 0xb, 0xd1, 0x3a, 0xa4, 0xb6, 
-0x4f, 0xcd, 0xbd, 0xd, 0xc3, 0x15, 0x16, 0xcd, 0x8e, 0xc, 0x32, 0xa3, 0xb6, 0xc9, 0xcd, 0x8e, 
-0xc, 0x32, 0xa4, 0xb6, 0xc9, 0x3a, 0xa3, 0xb6, 0x18, 0x3, 0x3a, 0xa4, 0xb6, 0xc3, 0xa7, 0xc, 
-0xcd, 0x5d, 0x16, 0xc3, 0xdc, 0xbd, 0xcd, 0x94, 0x16, 0xd0, 0xcd, 0xaf, 0xb, 0x3a, 0xa3, 0xb6, 
-0x47, 0xc3, 0xe8, 0xbd, 0xcd, 0x5d, 0x16, 0xc3, 0xdf, 0xbd, 0xcd, 0x94, 0x16, 0xd2, 0x7a, 0x17, 
-0xcd, 0xaf, 0xb, 0xc3, 0xe5, 0xbd, 0xcd, 0x5d, 0x16, 0xc3, 0xe2, 0xbd, 0x32, 0xb3, 0xb6, 0xc9, 
-0x32, 0xb2, 0xb6, 0xc9, 0xe5, 0xcd, 0x8b, 0x18, 0xe1, 0xcd, 0x27, 0x16, 0xe5, 0x2a, 0xa5, 0xb6, 
-0xb7, 0xed, 0x52, 0x7c, 0x32, 0xad, 0xb6, 0xfc, 0x39, 0x19, 0xd1, 0xe5, 0x2a, 0xa7, 0xb6, 0xb7, 
-0xed, 0x52, 0x7c, 0x32, 0xae, 0xb6, 0xfc, 0x39, 0x19, 0xd1, 0xb7, 0xed, 0x52, 0x19, 0x9f, 0x32, 
-0xaf, 0xb6, 0x3a, 0xae, 0xb6, 0x28, 0x4, 0xeb, 0x3a, 0xad, 0xb6, 0xf5, 0xed, 0x53, 0xab, 0xb6, 
-0x44, 0x4d, 0x3a, 0xb2, 0xb6, 0xb7, 0x28, 0x1, 0x3, 0xed, 0x43, 0xb0, 0xb6, 0xcd, 0x39, 0x19, 
-0xe5, 0x19, 0x22, 0xa9, 0xb6, 0xe1, 0xcb, 0x2c, 0xcb, 0x1d, 0xf1, 0x7, 0x38, 0x12, 0xe5, 0xcd, 
-0x8b, 0x18, 0x2a, 0xad, 0xb6, 0x7c, 0x2f, 0x67, 0x7d, 0x2f, 0x6f, 0x22, 0xad, 0xb6, 0x18, 0x12, 
-0x3a, 0xb2, 0xb6, 0xb7, 0x20, 0xd, 0x19, 0xe5, 0x3a, 0xaf, 0xb6, 0x7, 0xdc, 0xda, 0x18, 0xd4, 
-0x28, 0x19, 0xe1, 0x7a, 0xb3, 0xca, 0x98, 0x18, 0xdd, 0xe5, 0x1, 0x0, 0x0, 0xc5, 0xdd, 0xe1, 
-0xdd, 0xe5, 0xd1, 0xb7, 0xed, 0x5a, 0xed, 0x5b, 0xab, 0xb6, 0xf2, 0x53, 0x18, 0x3, 0xdd, 0x19, 
-0x19, 0x30, 0xfa, 0xaf, 0x93, 0x5f, 0x9f, 0x92, 0x57, 0x19, 0x30, 0x5, 0xdd, 0x19, 0xb, 0x18, 
-0xf8, 0xed, 0x5b, 0xa9, 0xb6, 0x19, 0xc5, 0xe5, 0x2a, 0xb0, 0xb6, 0xb7, 0xed, 0x42, 0x30, 0x6, 
-0x9, 0x44, 0x4d, 0x21, 0x0, 0x0, 0x22, 0xb0, 0xb6, 0xcd, 0x98, 0x18, 0xe1, 0xc1, 0x30, 0x8, 
-0xed, 0x5b, 0xb0, 0xb6, 0x7a, 0xb3, 0x20, 0xb8, 0xdd, 0xe1, 0xc9, 0xd5, 0xcd, 0x24, 0x16, 0xed, 
-0x53, 0xa5, 0xb6, 0x22, 0xa7, 0xb6, 0xd1, 0xc9, 0x3a, 0xaf, 0xb6, 0x7, 0x38, 0x4d, 0x78, 0xb1, 
-0x28, 0x38, 0x2a, 0xa7, 0xb6, 0x9, 0x2b, 0x44, 0x4d, 0xeb, 0xcd, 0x80, 0x16, 0x2a, 0xa7, 0xb6, 
-0xeb, 0x23, 0x22, 0xa7, 0xb6, 0x38, 0x6, 0x28, 0x21, 0xed, 0x4b, 0x9f, 0xb6, 0xcd, 0x80, 0x16, 
-0x38, 0x5, 0xc0, 0xed, 0x5b, 0xa1, 0xb6, 0xd5, 0xed, 0x5b, 0xa5, 0xb6, 0xcd, 0x6a, 0x16, 0xe1, 
-0x38, 0x5, 0x21, 0xad, 0xb6, 0xae, 0xf0, 0xdc, 0x16, 0x10, 0x2a, 0xa5, 0xb6, 0x3a, 0xad, 0xb6, 
-0x7, 0x23, 0x38, 0x2, 0x2b, 0x2b, 0x22, 0xa5, 0xb6, 0x37, 0xc9, 0x78, 0xb1, 0x28, 0x39, 0x2a, 
-0xa5, 0xb6, 0x9, 0x2b, 0x44, 0x4d, 0xeb, 0xcd, 0x6a, 0x16, 0x2a, 0xa5, 0xb6, 0xeb, 0x23, 0x22, 
-0xa5, 0xb6, 0x38, 0x6, 0x28, 0x22, 0xed, 0x4b, 0x9d, 0xb6, 0xcd, 0x6a, 0x16, 0x38, 0x5, 0xc0, 
-0xed, 0x5b, 0x9b, 0xb6, 0xd5, 0xed, 0x5b, 0xa7, 0xb6, 0xcd, 0x80, 0x16, 0xe1, 0x38, 0x5, 0x21, 
-0xae, 0xb6, 0xae, 0xf0, 0xeb, 0xdc, 0xc2, 0xf, 0x2a, 0xa7, 0xb6, 0x3a, 0xae, 0xb6, 0x7, 0x23, 
-0x38, 0x2, 0x2b, 0x2b, 0x22, 0xa7, 0xb6, 0x37, 0xc9, 0xaf, 0x95, 0x6f, 0x9f, 0x94, 0x67, 0xc9, 
-0xdd, 0xe5, 0xcd, 0xd4, 0x12, 0xe5, 0xdd, 0xe1, 0xcd, 0x24, 0x16, 0xcd, 0x97, 0x16, 0x30, 0x4b, 
-0xe5, 0xd5, 0x1, 0x7, 0x0, 0xeb, 0x9, 0xeb, 0xb7, 0xed, 0x42, 0xcd, 0x97, 0x16, 0xd1, 0xe1, 
-0x30, 0x39, 0xcd, 0xaf, 0xb, 0x16, 0x8, 0xe5, 0xdd, 0x5e, 0x0, 0x37, 0xcb, 0x13, 0xcd, 0xc4, 
-0x19, 0xcb, 0x9, 0xdc, 0x5, 0xc, 0xcb, 0x23, 0x20, 0xf4, 0xe1, 0xcd, 0x1f, 0xc, 0xdd, 0x23, 
-0x15, 0x20, 0xe4, 0xdd, 0xe1, 0xcd, 0x6, 0x16, 0xeb, 0xcd, 0xc, 0xb, 0x1, 0x8, 0x0, 0x28, 
-0x4, 0x30, 0x3, 0x9, 0x9, 0x9, 0x9, 0xeb, 0xc3, 0xfe, 0x15, 0x6, 0x8, 0xc5, 0xd5, 0xdd, 
-0x7e, 0x0, 0x37, 0x8f, 0xe5, 0xd5, 0xf5, 0xcd, 0x97, 0x16, 0x30, 0x8, 0xcd, 0xaf, 0xb, 0xf1, 
-0xf5, 0xcd, 0xc4, 0x19, 0xf1, 0xd1, 0xe1, 0x13, 0x87, 0x20, 0xe9, 0xd1, 0x2b, 0xdd, 0x23, 0xc1, 
-0x10, 0xdb, 0x18, 0xbf, 0x3a, 0xa3, 0xb6, 0x38, 0x8, 0x3a, 0xb4, 0xb6, 0xb7, 0xc0, 0x3a, 0xa4, 
-0xb6, 0x47, 0xc3, 0xe8, 0xbd, 0x32, 0xb4, 0xb6, 0xc9, 0x22, 0xa5, 0xb6, 0x36, 0x1, 0x1b, 0xed, 
-0x53, 0xa7, 0xb6, 0xcd, 0x8e, 0xc, 0x32, 0xaa, 0xb6, 0xcd, 0x24, 0x16, 0xcd, 0x97, 0x16, 0xdc, 
-0x42, 0x1b, 0xd0, 0xe5, 0xcd, 0xe7, 0x1a, 0xe3, 0xcd, 0x15, 0x1b, 0xc1, 0x3e, 0xff, 0x32, 0xa9, 
-0xb6, 0xe5, 0xd5, 0xc5, 0xcd, 0xb, 0x1a, 0xc1, 0xd1, 0xe1, 0xaf, 0x32, 0xab, 0xb6, 0xcd, 0xde, 
-0x1a, 0xcd, 0x97, 0x16, 0xdc, 0x50, 0x1a, 0x38, 0xf5, 0x2a, 0xa5, 0xb6, 0xe7, 0xfe, 0x1, 0x28, 
-0x2a, 0x32, 0xab, 0xb6, 0xeb, 0x2a, 0xa7, 0xb6, 0x1, 0x7, 0x0, 0x9, 0x22, 0xa7, 0xb6, 0xeb, 
-0x2b, 0xe7, 0x47, 0x2b, 0xe7, 0x4f, 0x2b, 0xe7, 0x57, 0x2b, 0xe7, 0x5f, 0xd5, 0x2b, 0xe7, 0x57, 
-0x2b, 0xe7, 0x5f, 0x2b, 0x22, 0xa5, 0xb6, 0xeb, 0xd1, 0x18, 0xc6, 0x3a, 0xa9, 0xb6, 0xf, 0xc9, 
-0xed, 0x43, 0xac, 0xb6, 0xcd, 0x42, 0x1b, 0x38, 0x9, 0xcd, 0xf1, 0x1a, 0xd0, 0x22, 0xae, 0xb6, 
-0x18, 0x11, 0xe5, 0xcd, 0x15, 0x1b, 0x22, 0xae, 0xb6, 0xc1, 0x7d, 0x91, 0x7c, 0x98, 0xdc, 0xcb, 
-0x1a, 0x60, 0x69, 0xcd, 0xe7, 0x1a, 0x22, 0xb0, 0xb6, 0xed, 0x4b, 0xac, 0xb6, 0xb7, 0xed, 0x42, 
-0x9, 0x28, 0x11, 0x30, 0x8, 0xcd, 0xf1, 0x1a, 0xdc, 0x9d, 0x1a, 0x18, 0x7, 0xe5, 0x60, 0x69, 
-0xc1, 0xcd, 0xcb, 0x1a, 0x2a, 0xae, 0xb6, 0xed, 0x4b, 0xb0, 0xb6, 0x37, 0xc9, 0xd5, 0xe5, 0x2a, 
-0xa7, 0xb6, 0x11, 0xf9, 0xff, 0x19, 0xd1, 0x30, 0x1c, 0x22, 0xa7, 0xb6, 0x2a, 0xa5, 0xb6, 0x23, 
-0x73, 0x23, 0x72, 0x23, 0xd1, 0x73, 0x23, 0x72, 0x23, 0x71, 0x23, 0x70, 0x23, 0x3a, 0xab, 0xb6, 
-0x77, 0x22, 0xa5, 0xb6, 0xc9, 0xaf, 0x32, 0xa9, 0xb6, 0xd1, 0xc9, 0xcd, 0xd7, 0x1a, 0xcd, 0x42, 
-0x1b, 0xd4, 0xf1, 0x1a, 0xdc, 0x9d, 0x1a, 0x3a, 0xab, 0xb6, 0x2f, 0x32, 0xab, 0xb6, 0x1b, 0x3a, 
-0xab, 0xb6, 0xb7, 0xc8, 0x13, 0x13, 0xc9, 0xaf, 0xed, 0x4b, 0x9f, 0xb6, 0xcd, 0xf3, 0x1a, 0x2b, 
-0xc9, 0x3e, 0xff, 0xc5, 0xd5, 0xe5, 0xf5, 0xcd, 0x4f, 0x1b, 0xf1, 0x47, 0xcd, 0x34, 0x1b, 0x4, 
-0x10, 0x4, 0x30, 0x47, 0xae, 0x77, 0x38, 0x43, 0xe3, 0x23, 0xe3, 0xed, 0x52, 0x28, 0x3c, 0x19, 
-0xcd, 0x39, 0xc, 0x18, 0xe7, 0xc5, 0xd5, 0xe5, 0xed, 0x4b, 0xa1, 0xb6, 0xcd, 0x4f, 0x1b, 0xb7, 
-0xed, 0x52, 0x28, 0x27, 0x19, 0xcd, 0x1f, 0xc, 0xcd, 0x34, 0x1b, 0x28, 0x1e, 0xae, 0x77, 0xe3, 
-0x2b, 0xe3, 0x18, 0xeb, 0x3a, 0xa3, 0xb6, 0xae, 0xa1, 0xc8, 0x3a, 0xaa, 0xb6, 0xae, 0xa1, 0xc8, 
-0x37, 0xc9, 0xc5, 0xd5, 0xe5, 0xcd, 0xaf, 0xb, 0xcd, 0x34, 0x1b, 0xe1, 0xd1, 0xc1, 0xc9, 0xc5, 
-0xd5, 0xcd, 0xaf, 0xb, 0xd1, 0xe3, 0xcd, 0xaf, 0xb, 0xeb, 0xe1, 0xc9, 0x21, 0x2, 0x1e, 0xcd, 
-0xf6, 0x1d, 0xaf, 0x32, 0x55, 0xb6, 0x67, 0x6f, 0x22, 0x31, 0xb6, 0x1, 0xb0, 0xff, 0x11, 0xd6, 
-0xb5, 0x21, 0x92, 0xb6, 0x3e, 0x4, 0xeb, 0x9, 0xeb, 0x72, 0x2b, 0x73, 0x2b, 0x3d, 0x20, 0xf6, 
-0x21, 0xef, 0x1e, 0x1, 0xfa, 0x0, 0xed, 0xb0, 0x6, 0xa, 0x11, 0x35, 0xb6, 0x21, 0x3f, 0xb6, 
-0xaf, 0x12, 0x13, 0x36, 0xff, 0x23, 0x10, 0xf9, 0xcd, 0x75, 0x1e, 0xcd, 0xf8, 0x1b, 0x11, 0x90, 
-0xb5, 0x21, 0x98, 0x0, 0xcd, 0xa, 0x1c, 0x21, 0xb3, 0x1b, 0xcd, 0xb4, 0xa, 0xcd, 0xb4, 0xa, 
-0xc3, 0xb, 0x1e, 0x3, 0xee, 0xbd, 0xc3, 0xb8, 0x1d, 0x3, 0xf4, 0xbd, 0xc3, 0x40, 0x1d, 0xcd, 
-0xc5, 0x1b, 0x30, 0xfb, 0xc9, 0xe5, 0x21, 0x2a, 0xb6, 0x7e, 0x36, 0xff, 0xbe, 0x38, 0x27, 0x2a, 
-0x28, 0xb6, 0x7c, 0xb7, 0x20, 0x11, 0xcd, 0xe1, 0x1c, 0x30, 0x1b, 0xfe, 0x80, 0x38, 0x17, 0xfe, 
-0xa0, 0x3f, 0x38, 0x12, 0x67, 0x2e, 0x0, 0xd5, 0xcd, 0xb3, 0x1c, 0x38, 0x2, 0x26, 0x0, 0x2c, 
-0x22, 0x28, 0xb6, 0xd1, 0x30, 0xe0, 0xe1, 0xc9, 0x3e, 0xff, 0x32, 0x2a, 0xb6, 0xc9, 0xcd, 0xc5, 
-0x1b, 0x38, 0xfb, 0xc9, 0xcd, 0xa, 0x1c, 0x3f, 0xfb, 0xc9, 0xf3, 0x7d, 0xd6, 0x31, 0x7c, 0xde, 
-0x0, 0xd8, 0x19, 0x22, 0x2d, 0xb6, 0xeb, 0x22, 0x2b, 0xb6, 0x1, 0x30, 0xa, 0x36, 0x1, 0x23, 
-0x71, 0x23, 0xc, 0x10, 0xf8, 0xeb, 0x21, 0x3c, 0x1c, 0xe, 0xa, 0xed, 0xb0, 0xeb, 0x6, 0x13, 
-0xaf, 0x77, 0x23, 0x10, 0xfc, 0x22, 0x2f, 0xb6, 0x32, 0x29, 0xb6, 0xc9, 0x1, 0x2e, 0x1, 0xd, 
-0x5, 0x52, 0x55, 0x4e, 0x22, 0xd, 0x78, 0xcd, 0xc3, 0x1c, 0xd0, 0xc5, 0xd5, 0xe5, 0xcd, 0x6a, 
-0x1c, 0x3f, 0xe1, 0xd1, 0xc1, 0xd0, 0x1b, 0x79, 0xc, 0x12, 0x13, 0xe7, 0x23, 0xd, 0x20, 0xf9, 
-0x21, 0x29, 0xb6, 0x78, 0xae, 0x20, 0x1, 0x77, 0x37, 0xc9, 0x6, 0x0, 0x60, 0x6f, 0x79, 0x95, 
-0xc8, 0x30, 0xf, 0x7d, 0x69, 0x4f, 0x19, 0xeb, 0x9, 0xcd, 0xa7, 0x1c, 0x28, 0x23, 0xed, 0xb0, 
-0x18, 0x1f, 0x4f, 0x19, 0xe5, 0x2a, 0x2f, 0xb6, 0x9, 0xeb, 0x2a, 0x2d, 0xb6, 0x7d, 0x93, 0x7c, 
-0x9a, 0xe1, 0xd8, 0xcd, 0xa7, 0x1c, 0x2a, 0x2f, 0xb6, 0x28, 0x6, 0xd5, 0x1b, 0x2b, 0xed, 0xb8, 
-0xd1, 0xed, 0x53, 0x2f, 0xb6, 0xb7, 0xc9, 0x3a, 0x2f, 0xb6, 0x95, 0x4f, 0x3a, 0x30, 0xb6, 0x9c, 
-0x47, 0xb1, 0xc9, 0xcd, 0xc3, 0x1c, 0xd0, 0xbd, 0xc8, 0x3f, 0xd0, 0xe5, 0x26, 0x0, 0x19, 0x7e, 
-0xe1, 0x37, 0xc9, 0xe6, 0x7f, 0xfe, 0x20, 0xd0, 0xe5, 0x2a, 0x2b, 0xb6, 0x11, 0x0, 0x0, 0x3c, 
-0x19, 0x5e, 0x23, 0x3d, 0x20, 0xfa, 0x7b, 0xeb, 0xe1, 0x37, 0xc9, 0xcd, 0xe1, 0x1c, 0x30, 0xfb, 
-0xc9, 0xe5, 0xc5, 0xcd, 0x9d, 0x1e, 0x30, 0x3a, 0x79, 0xfe, 0xef, 0x28, 0x34, 0xe6, 0xf, 0x87, 
-0x87, 0x87, 0x3d, 0x3c, 0xcb, 0x8, 0x30, 0xfb, 0xcd, 0x25, 0x1d, 0x21, 0x32, 0xb6, 0xcb, 0x7e, 
-0x28, 0xa, 0xfe, 0x61, 0x38, 0x6, 0xfe, 0x7b, 0x30, 0x2, 0xc6, 0xe0, 0xfe, 0xff, 0x28, 0xd3, 
-0xfe, 0xfe, 0x21, 0x31, 0xb6, 0x28, 0x5, 0xfe, 0xfd, 0x23, 0x20, 0x5, 0x7e, 0x2f, 0x77, 0x18, 
-0xc2, 0x37, 0xc1, 0xe1, 0xc9, 0xcb, 0x11, 0xda, 0xce, 0x1e, 0x47, 0x3a, 0x31, 0xb6, 0xb1, 0xe6, 
-0x40, 0x78, 0xc2, 0xc9, 0x1e, 0xc3, 0xc4, 0x1e, 0x2a, 0x31, 0xb6, 0xc9, 0x22, 0x31, 0xb6, 0xc9, 
-0x11, 0x49, 0xb6, 0x21, 0x3f, 0xb6, 0xcd, 0x83, 0x8, 0x3a, 0x4b, 0xb6, 0xe6, 0xa0, 0x4f, 0x21, 
-0x37, 0xb6, 0xb6, 0x77, 0x21, 0x49, 0xb6, 0x11, 0x35, 0xb6, 0x6, 0x0, 0x1a, 0xae, 0xa6, 0xc4, 
-0xd1, 0x1d, 0x7e, 0x12, 0x23, 0x13, 0xc, 0x79, 0xe6, 0xf, 0xfe, 0xa, 0x20, 0xee, 0x79, 0xe6, 
-0xa0, 0xcb, 0x71, 0x4f, 0xc4, 0xee, 0xbd, 0x78, 0xb7, 0xc0, 0x21, 0x53, 0xb6, 0x35, 0xc0, 0x2a, 
-0x54, 0xb6, 0xeb, 0x42, 0x16, 0x0, 0x21, 0x35, 0xb6, 0x19, 0x7e, 0x2a, 0x91, 0xb6, 0x19, 0xa6, 
-0xa0, 0xc8, 0x21, 0x53, 0xb6, 0x34, 0x3a, 0x8a, 0xb6, 0xb7, 0xc0, 0x79, 0xb3, 0x4f, 0x3a, 0x33, 
-0xb6, 0x32, 0x53, 0xb6, 0xcd, 0x86, 0x1e, 0x79, 0xe6, 0xf, 0x6f, 0x60, 0x22, 0x54, 0xb6, 0xfe, 
-0x8, 0xc0, 0xcb, 0x60, 0xc0, 0xcb, 0xf1, 0xc9, 0x21, 0x3d, 0xb6, 0xcb, 0x56, 0xc8, 0x79, 0xee, 
-0xa0, 0x20, 0x56, 0xc5, 0x23, 0x6, 0xa, 0x8e, 0x2b, 0x10, 0xfc, 0xc1, 0xfe, 0xa4, 0x20, 0x49, 
-0xc7, 0xe5, 0xd5, 0x5f, 0x2f, 0x3c, 0xa3, 0x47, 0x3a, 0x34, 0xb6, 0xcd, 0xa1, 0x1d, 0x78, 0xab, 
-0x20, 0xf1, 0xd1, 0xe1, 0xc9, 0x3a, 0x3b, 0xb6, 0xe6, 0x7f, 0x6f, 0x3a, 0x3e, 0xb6, 0xe6, 0x7f, 
-0x67, 0xc9, 0x2a, 0x33, 0xb6, 0xc9, 0x22, 0x33, 0xb6, 0xc9, 0xcd, 0xb, 0x1e, 0x21, 0x57, 0xb6, 
-0x6, 0x40, 0xcd, 0xd2, 0x1, 0x3e, 0xff, 0x32, 0x56, 0xb6, 0xc9, 0xc5, 0xd5, 0x21, 0x56, 0xb6, 
-0x36, 0x0, 0x23, 0xcd, 0x84, 0x2, 0xd1, 0xc1, 0xc9, 0x21, 0x56, 0xb6, 0x7e, 0x36, 0x0, 0xbe, 
-0xc8, 0xc5, 0xd5, 0x23, 0xcd, 0xe2, 0x1, 0xe, 0xef, 0xcd, 0x86, 0x1e, 0xd1, 0xc1, 0xc9, 0x2a, 
-0x91, 0xb6, 0x18, 0x1c, 0xfe, 0x50, 0xd0, 0x2a, 0x91, 0xb6, 0xcd, 0x55, 0x1e, 0x2f, 0x4f, 0x7e, 
-0xa8, 0xa1, 0xa8, 0x77, 0xc9, 0xf5, 0x3a, 0x37, 0xb6, 0xe6, 0xa0, 0x4f, 0xf1, 0x21, 0x35, 0xb6, 
-0xcd, 0x55, 0x1e, 0xa6, 0xc9, 0xd5, 0xf5, 0xe6, 0xf8, 0xf, 0xf, 0xf, 0x5f, 0x16, 0x0, 0x19, 
-0xf1, 0xe5, 0x21, 0x6d, 0x1e, 0xe6, 0x7, 0x5f, 0x19, 0x7e, 0xe1, 0xd1, 0xc9, 0x1, 0x2, 0x4, 
-0x8, 0x10, 0x20, 0x40, 0x80, 0xf3, 0x21, 0x86, 0xb6, 0x36, 0x15, 0x23, 0xaf, 0x77, 0x23, 0x36, 
-0x1, 0x23, 0x77, 0x23, 0x77, 0xc9, 0x21, 0x86, 0xb6, 0xb7, 0x35, 0x28, 0xe, 0xcd, 0xb4, 0x1e, 
-0x71, 0x23, 0x70, 0x21, 0x8a, 0xb6, 0x34, 0x21, 0x88, 0xb6, 0x37, 0x34, 0xc9, 0x21, 0x88, 0xb6, 
-0xb7, 0x35, 0x28, 0xe, 0xcd, 0xb4, 0x1e, 0x4e, 0x23, 0x46, 0x21, 0x8a, 0xb6, 0x35, 0x21, 0x86, 
-0xb6, 0x37, 0x34, 0xc9, 0x23, 0x34, 0x7e, 0xfe, 0x14, 0x20, 0x2, 0xaf, 0x77, 0x87, 0xc6, 0x5e, 
-0x6f, 0x26, 0xb6, 0xc9, 0x2a, 0x8b, 0xb6, 0x18, 0x8, 0x2a, 0x8d, 0xb6, 0x18, 0x3, 0x2a, 0x8f, 
-0xb6, 0x85, 0x6f, 0x8c, 0x95, 0x67, 0x7e, 0xc9, 0x2a, 0x8b, 0xb6, 0x18, 0x8, 0x2a, 0x8d, 0xb6, 
-0x18, 0x3, 0x2a, 0x8f, 0xb6, 0xfe, 0x50, 0xd0, 0x85, 0x6f, 0x8c, 0x95, 0x67, 0x70, 0xc9, 0xf0, 
-0xf3, 0xf1, 0x89, 0x86, 0x83, 0x8b, 0x8a, 0xf2, 0xe0, 0x87, 0x88, 0x85, 0x81, 0x82, 0x80, 0x10, 
-0x5b, 0xd, 0x5d, 0x84, 0xff, 0x5c, 0xff, 0x5e, 0x2d, 0x40, 0x70, 0x3b, 0x3a, 0x2f, 0x2e, 0x30, 
-0x39, 0x6f, 0x69, 0x6c, 0x6b, 0x6d, 0x2c, 0x38, 0x37, 0x75, 0x79, 0x68, 0x6a, 0x6e, 0x20, 0x36, 
-0x35, 0x72, 0x74, 0x67, 0x66, 0x62, 0x76, 0x34, 0x33, 0x65, 0x77, 0x73, 0x64, 0x63, 0x78, 0x31, 
-0x32, 0xfc, 0x71, 0x9, 0x61, 0xfd, 0x7a, 0xb, 0xa, 0x8, 0x9, 0x58, 0x5a, 0xff, 0x7f, 0xf4, 
-0xf7, 0xf5, 0x89, 0x86, 0x83, 0x8b, 0x8a, 0xf6, 0xe0, 0x87, 0x88, 0x85, 0x81, 0x82, 0x80, 0x10, 
-0x7b, 0xd, 0x7d, 0x84, 0xff, 0x60, 0xff, 0xa3, 0x3d, 0x7c, 0x50, 0x2b, 0x2a, 0x3f, 0x3e, 0x5f, 
-0x29, 0x4f, 0x49, 0x4c, 0x4b, 0x4d, 0x3c, 0x28, 0x27, 0x55, 0x59, 0x48, 0x4a, 0x4e, 0x20, 0x26, 
-0x25, 0x52, 0x54, 0x47, 0x46, 0x42, 0x56, 0x24, 0x23, 0x45, 0x57, 0x53, 0x44, 0x43, 0x58, 0x21, 
-0x22, 0xfc, 0x51, 0x9, 0x41, 0xfd, 0x5a, 0xb, 0xa, 0x8, 0x9, 0x58, 0x5a, 0xff, 0x7f, 0xf8, 
-0xfb, 0xf9, 0x89, 0x86, 0x83, 0x8c, 0x8a, 0xfa, 0xe0, 0x87, 0x88, 0x85, 0x81, 0x82, 0x80, 0x10, 
-0x1b, 0xd, 0x1d, 0x84, 0xff, 0x1c, 0xff, 0x1e, 0xff, 0x0, 0x10, 0xff, 0xff, 0xff, 0xff, 0x1f, 
-0xff, 0xf, 0x9, 0xc, 0xb, 0xd, 0xff, 0xff, 0xff, 0x15, 0x19, 0x8, 0xa, 0xe, 0xff, 0xff, 
-0xff, 0x12, 0x14, 0x7, 0x6, 0x2, 0x16, 0xff, 0xff, 0x5, 0x17, 0x13, 0x4, 0x3, 0x18, 0xff, 
-0x7e, 0xfc, 0x11, 0xe1, 0x1, 0xfe, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7, 
-0x3, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0x8f, 0x21, 0xed, 0xb1, 0x6, 0x4, 0x36, 0x0, 
-0x23, 0x10, 0xfb, 0x11, 0x8b, 0x20, 0x6, 0x81, 0xcd, 0xd2, 0x1, 0x3e, 0x3f, 0x32, 0xb5, 0xb2, 
-0x21, 0xf8, 0xb1, 0x1, 0x3d, 0x0, 0x11, 0x8, 0x1, 0xaf, 0x77, 0x23, 0x72, 0x23, 0x73, 0x9, 
-0x3c, 0xeb, 0x29, 0xeb, 0xfe, 0x3, 0x20, 0xf2, 0xe, 0x7, 0xdd, 0xe5, 0xe5, 0x21, 0xf0, 0xb1, 
-0x34, 0xe5, 0xdd, 0x21, 0xb9, 0xb1, 0x79, 0xcd, 0x9, 0x22, 0xf5, 0xc5, 0xcd, 0x86, 0x22, 0xcd, 
-0xe7, 0x23, 0xdd, 0xe5, 0xd1, 0x13, 0x13, 0x13, 0x6b, 0x62, 0x13, 0x1, 0x3b, 0x0, 0x36, 0x0, 
-0xed, 0xb0, 0xdd, 0x36, 0x1c, 0x4, 0xc1, 0xf1, 0x20, 0xdd, 0xe1, 0x35, 0xe1, 0xdd, 0xe1, 0xc9, 
-0x21, 0xee, 0xb1, 0xf3, 0x7e, 0x36, 0x0, 0xfb, 0xb7, 0xc8, 0x2b, 0x77, 0x2e, 0x3, 0xe, 0x0, 
-0x3e, 0x7, 0x85, 0xcd, 0x63, 0x8, 0x2d, 0x20, 0xf7, 0x37, 0xc9, 0x11, 0xed, 0xb1, 0x1a, 0xb7, 
-0xc8, 0xd5, 0xdd, 0x21, 0xb9, 0xb1, 0xcd, 0x9, 0x22, 0xf5, 0xdd, 0x7e, 0xf, 0xdc, 0xde, 0x23, 
-0xf1, 0x20, 0xf3, 0xe3, 0x7e, 0x36, 0x0, 0x23, 0x77, 0xe1, 0xc9, 0xdd, 0xe5, 0x3a, 0xee, 0xb1, 
-0xb7, 0x28, 0x3d, 0xf5, 0xdd, 0x21, 0xb9, 0xb1, 0x1, 0x3f, 0x0, 0xdd, 0x9, 0xcb, 0x3f, 0x30, 
-0xfa, 0xf5, 0xdd, 0x7e, 0x4, 0x1f, 0xdc, 0x1f, 0x24, 0xdd, 0x7e, 0x7, 0x1f, 0xdc, 0x1f, 0x23, 
-0xdc, 0x13, 0x22, 0xf1, 0x20, 0xe2, 0xc1, 0x3a, 0xee, 0xb1, 0x2f, 0xa0, 0x28, 0x12, 0xdd, 0x21, 
-0xb9, 0xb1, 0x11, 0x3f, 0x0, 0xdd, 0x19, 0xcb, 0x3f, 0xf5, 0xdc, 0xe7, 0x23, 0xf1, 0x20, 0xf5, 
-0xaf, 0x32, 0xf0, 0xb1, 0xdd, 0xe1, 0xc9, 0x21, 0xee, 0xb1, 0x7e, 0xb7, 0xc8, 0x23, 0x35, 0xc0, 
-0x47, 0x34, 0x23, 0x7e, 0xb7, 0xc0, 0x2b, 0x36, 0x3, 0x21, 0xbe, 0xb1, 0x11, 0x3f, 0x0, 0xaf, 
-0x19, 0xcb, 0x38, 0x30, 0xfb, 0x35, 0x20, 0x5, 0x2b, 0xcb, 0x6, 0x8a, 0x23, 0x23, 0x35, 0x20, 
-0x5, 0x23, 0xcb, 0x6, 0x8a, 0x2b, 0x2b, 0x4, 0x10, 0xe6, 0xb7, 0xc8, 0x21, 0xf0, 0xb1, 0x77, 
-0x23, 0xc3, 0xe2, 0x1, 0xcd, 0x6b, 0x20, 0x7e, 0xe6, 0x7, 0x37, 0xc8, 0x4f, 0xb6, 0xfc, 0x1a, 
-0x20, 0x41, 0xdd, 0x21, 0xb9, 0xb1, 0x11, 0x3f, 0x0, 0xaf, 0xdd, 0x19, 0xcb, 0x38, 0x30, 0xfa, 
-0xdd, 0x72, 0x1e, 0xdd, 0xbe, 0x1c, 0x3f, 0x9f, 0x4, 0x10, 0xef, 0xb7, 0xc0, 0x41, 0x7e, 0x1f, 
-0x1f, 0x1f, 0xb0, 0xe6, 0xf, 0x4f, 0xe5, 0x21, 0xf0, 0xb1, 0x34, 0xe3, 0x23, 0xdd, 0x21, 0xb9, 
-0xb1, 0x11, 0x3f, 0x0, 0xdd, 0x19, 0xcb, 0x38, 0x30, 0xfa, 0xe5, 0xc5, 0xdd, 0x7e, 0x1b, 0xdd, 
-0x34, 0x1b, 0xdd, 0x35, 0x1c, 0xeb, 0xcd, 0x9c, 0x21, 0xe5, 0xeb, 0xdd, 0x7e, 0x1, 0x2f, 0xa1, 
-0x12, 0x13, 0x7e, 0x23, 0x87, 0x87, 0x87, 0x87, 0x47, 0x7e, 0x23, 0xe6, 0xf, 0xb0, 0x12, 0x13, 
-0x1, 0x6, 0x0, 0xed, 0xb0, 0xe1, 0xdd, 0x7e, 0x1a, 0xdd, 0x34, 0x1a, 0xdd, 0xb6, 0x3, 0xcc, 
-0x1f, 0x22, 0xc1, 0xe1, 0x4, 0x10, 0xba, 0xe3, 0x35, 0xe1, 0x37, 0xc9, 0xe6, 0x3, 0x87, 0x87, 
-0x87, 0xc6, 0x1f, 0xdd, 0xe5, 0xe1, 0x85, 0x6f, 0x8c, 0x95, 0x67, 0xc9, 0x6f, 0xcd, 0x6b, 0x20, 
-0x7d, 0xe6, 0x7, 0xc8, 0x21, 0xf0, 0xb1, 0x34, 0xe5, 0xdd, 0x21, 0xb9, 0xb1, 0xcd, 0x9, 0x22, 
-0xf5, 0xdd, 0xcb, 0x3, 0x5e, 0xc4, 0x19, 0x22, 0xf1, 0x20, 0xf2, 0xe1, 0x35, 0xc9, 0xe6, 0x7, 
-0xc8, 0x21, 0xbc, 0xb1, 0x11, 0x3f, 0x0, 0x19, 0x1f, 0x30, 0xfc, 0xf3, 0x7e, 0x87, 0x87, 0x87, 
-0x11, 0x19, 0x0, 0x19, 0xb6, 0x23, 0x23, 0x36, 0x0, 0xfb, 0xc9, 0xe6, 0x7, 0xc8, 0xeb, 0x21, 
-0xd5, 0xb1, 0x1, 0x3f, 0x0, 0x9, 0x1f, 0x30, 0xfc, 0xaf, 0xf3, 0xbe, 0x20, 0x1, 0x7a, 0x23, 
-0x73, 0x23, 0x77, 0xfb, 0xc8, 0xeb, 0xc3, 0xe2, 0x1, 0x11, 0x3f, 0x0, 0xdd, 0x19, 0xcb, 0x3f, 
-0xd8, 0x18, 0xf9, 0xdd, 0x7e, 0x1a, 0xb7, 0x28, 0x6d, 0xdd, 0x7e, 0x19, 0xcd, 0x9c, 0x21, 0x7e, 
-0xb7, 0x28, 0xd, 0xcb, 0x5f, 0x20, 0x59, 0xe5, 0x36, 0x0, 0xcd, 0x90, 0x22, 0xe1, 0x30, 0x56, 
-0xdd, 0x36, 0x3, 0x10, 0x23, 0x7e, 0xe6, 0xf0, 0xf5, 0xae, 0x5f, 0x23, 0x4e, 0x23, 0x56, 0x23, 
-0xb2, 0xb1, 0x28, 0x8, 0xe5, 0xcd, 0x8, 0x24, 0xdd, 0x56, 0x1, 0xe1, 0x4e, 0x23, 0x5e, 0x23, 
-0x7e, 0x23, 0x66, 0x6f, 0xf1, 0xcd, 0xde, 0x22, 0x21, 0xee, 0xb1, 0xdd, 0x46, 0x1, 0x7e, 0xb0, 
-0x77, 0xa8, 0x20, 0x3, 0x23, 0x36, 0x3, 0xdd, 0x34, 0x19, 0xdd, 0x35, 0x1a, 0xdd, 0x34, 0x1c, 
-0xdd, 0x7e, 0x1e, 0xdd, 0x36, 0x1e, 0x0, 0xb7, 0xc8, 0x67, 0xdd, 0x6e, 0x1d, 0xc3, 0xe2, 0x1, 
-0xcb, 0x9e, 0xdd, 0x36, 0x3, 0x8, 0x21, 0xee, 0xb1, 0xdd, 0x7e, 0x1, 0x2f, 0xa6, 0x77, 0xc9, 
-0xdd, 0xe5, 0x47, 0xdd, 0x4e, 0x1, 0xdd, 0x21, 0xf8, 0xb1, 0xcb, 0x47, 0x20, 0xc, 0xdd, 0x21, 
-0x37, 0xb2, 0xcb, 0x4f, 0x20, 0x4, 0xdd, 0x21, 0x76, 0xb2, 0xdd, 0x7e, 0x3, 0xa1, 0x28, 0x27, 
-0x78, 0xdd, 0xbe, 0x1, 0x28, 0x19, 0xdd, 0xe5, 0xdd, 0x21, 0x76, 0xb2, 0xcb, 0x57, 0x20, 0x4, 
-0xdd, 0x21, 0x37, 0xb2, 0xdd, 0x7e, 0x3, 0xa1, 0x28, 0xc, 0xcd, 0x19, 0x22, 0xdd, 0xe1, 0xcd, 
-0x19, 0x22, 0xdd, 0xe1, 0x37, 0xc9, 0xe1, 0xdd, 0xe1, 0xdd, 0x70, 0x3, 0xb7, 0xc9, 0xcb, 0xfb, 
-0xdd, 0x73, 0xf, 0x5f, 0x7d, 0xb4, 0x20, 0x1, 0x2b, 0xdd, 0x75, 0x8, 0xdd, 0x74, 0x9, 0x79, 
-0xb7, 0x28, 0x8, 0x3e, 0x6, 0xcd, 0x63, 0x8, 0xdd, 0x7e, 0x2, 0xb2, 0xcd, 0xe8, 0x23, 0x7b, 
-0xb7, 0x28, 0xa, 0x21, 0xa6, 0xb2, 0x16, 0x0, 0x19, 0x7e, 0xb7, 0x20, 0x3, 0x21, 0x1b, 0x23, 
-0xdd, 0x75, 0xa, 0xdd, 0x74, 0xb, 0xcd, 0xcd, 0x23, 0x18, 0xd, 0x1, 0x1, 0x0, 0xc8, 0xdd, 
-0x6e, 0xd, 0xdd, 0x66, 0xe, 0xdd, 0x5e, 0x10, 0x7b, 0xfe, 0xff, 0x28, 0x75, 0x87, 0x7e, 0x23, 
-0x38, 0x49, 0x28, 0xc, 0x1d, 0xdd, 0x4e, 0xf, 0xb7, 0x20, 0x4, 0xcb, 0x79, 0x28, 0x6, 0x81, 
-0xe6, 0xf, 0xcd, 0xdb, 0x23, 0x4e, 0xdd, 0x7e, 0x9, 0x47, 0x87, 0x38, 0x1b, 0xaf, 0x91, 0xdd, 
-0x86, 0x8, 0x38, 0xc, 0x5, 0xf2, 0x5d, 0x23, 0xdd, 0x4e, 0x8, 0xaf, 0x47, 0xdd, 0x70, 0x9, 
-0xdd, 0x77, 0x8, 0xb0, 0x20, 0x2, 0x1e, 0xff, 0x7b, 0xb7, 0xcc, 0xae, 0x23, 0xdd, 0x73, 0x10, 
-0xf3, 0xdd, 0x71, 0x6, 0xdd, 0x36, 0x7, 0x80, 0xfb, 0xb7, 0xc9, 0x57, 0x4b, 0x3e, 0xd, 0xcd, 
-0x63, 0x8, 0x4a, 0x3e, 0xb, 0xcd, 0x63, 0x8, 0x4e, 0x3e, 0xc, 0xcd, 0x63, 0x8, 0x3e, 0x10, 
-0xcd, 0xdb, 0x23, 0xcd, 0xae, 0x23, 0x7b, 0x3c, 0x20, 0x8e, 0x21, 0x1b, 0x23, 0xcd, 0xcd, 0x23, 
-0x18, 0x86, 0xaf, 0xdd, 0x77, 0x3, 0xdd, 0x77, 0x7, 0xdd, 0x77, 0x4, 0x37, 0xc9, 0xdd, 0x35, 
-0xc, 0x20, 0x1e, 0xdd, 0x7e, 0x9, 0x87, 0x21, 0x1b, 0x23, 0x30, 0x11, 0xdd, 0x34, 0x8, 0x20, 
-0x6, 0xdd, 0x34, 0x9, 0x1e, 0xff, 0xc8, 0xdd, 0x6e, 0xa, 0xdd, 0x66, 0xb, 0x7e, 0xdd, 0x77, 
-0xc, 0x23, 0x5e, 0x23, 0xdd, 0x75, 0xd, 0xdd, 0x74, 0xe, 0xc9, 0xdd, 0x77, 0xf, 0x4f, 0xdd, 
-0x7e, 0x0, 0xc6, 0x8, 0xc3, 0x63, 0x8, 0xaf, 0x47, 0xdd, 0x7e, 0x1, 0xdd, 0xb6, 0x2, 0x21, 
-0xb5, 0xb2, 0xf3, 0xb6, 0xa8, 0xbe, 0x77, 0xfb, 0x20, 0x3, 0x78, 0xb7, 0xc0, 0xaf, 0xcd, 0xde, 
-0x23, 0xf3, 0x4e, 0x3e, 0x7, 0xc3, 0x63, 0x8, 0xcd, 0x81, 0x24, 0x7b, 0xcd, 0xab, 0x24, 0xd0, 
-0x7e, 0xe6, 0x7f, 0xc8, 0xdd, 0x75, 0x11, 0xdd, 0x74, 0x12, 0xcd, 0x70, 0x24, 0x18, 0x9, 0xdd, 
-0x6e, 0x14, 0xdd, 0x66, 0x15, 0xdd, 0x5e, 0x18, 0x4e, 0x23, 0x7b, 0xd6, 0xf0, 0x38, 0x4, 0x1e, 
-0x0, 0x18, 0xe, 0x1d, 0x79, 0x87, 0x9f, 0x57, 0xdd, 0x7e, 0x16, 0x81, 0x4f, 0xdd, 0x7e, 0x17, 
-0x8a, 0x57, 0xcd, 0x81, 0x24, 0x4e, 0x7b, 0xb7, 0x20, 0x19, 0xdd, 0x7e, 0x13, 0x3d, 0x20, 0x10, 
-0xdd, 0x6e, 0x11, 0xdd, 0x66, 0x12, 0x7e, 0xc6, 0x80, 0x38, 0x5, 0xdd, 0x36, 0x4, 0x0, 0xc9, 
-0xcd, 0x70, 0x24, 0xdd, 0x73, 0x18, 0xf3, 0xdd, 0x71, 0x5, 0xdd, 0x36, 0x4, 0x80, 0xfb, 0xc9, 
-0xdd, 0x77, 0x13, 0x23, 0x5e, 0x23, 0xdd, 0x75, 0x14, 0xdd, 0x74, 0x15, 0x7b, 0xb7, 0xc0, 0x1c, 
-0xc9, 0xdd, 0x7e, 0x0, 0x87, 0xf5, 0xdd, 0x71, 0x16, 0xcd, 0x63, 0x8, 0xf1, 0x3c, 0x4a, 0xdd, 
-0x71, 0x17, 0xc3, 0x63, 0x8, 0x11, 0xa6, 0xb2, 0x18, 0x3, 0x11, 0x96, 0xb3, 0xeb, 0xcd, 0xae, 
-0x24, 0xeb, 0xd0, 0xed, 0xb0, 0xc9, 0x21, 0xa6, 0xb2, 0x18, 0x3, 0x21, 0x96, 0xb3, 0xb7, 0xc8, 
-0xfe, 0x10, 0xd0, 0x1, 0x10, 0x0, 0x9, 0x3d, 0x20, 0xfc, 0x37, 0xc9, 0xcd, 0x57, 0x25, 0xcd, 
-0x99, 0x25, 0xaf, 0xcd, 0xe1, 0x24, 0xcd, 0xbf, 0x2b, 0x21, 0x4d, 0x1, 0x3e, 0x19, 0x29, 0x29, 
-0x29, 0x29, 0x29, 0x29, 0xf, 0xf, 0xe6, 0x3f, 0x6f, 0x22, 0xe9, 0xb1, 0x3a, 0xe7, 0xb1, 0x37, 
-0xc9, 0x32, 0x18, 0xb1, 0xc9, 0xdd, 0x21, 0x1a, 0xb1, 0xcd, 0x2, 0x25, 0xe5, 0xdc, 0xac, 0x26, 
-0xe1, 0xd0, 0xed, 0x5b, 0x34, 0xb1, 0xed, 0x4b, 0x37, 0xb1, 0x3a, 0x31, 0xb1, 0xc9, 0xdd, 0x21, 
-0x5f, 0xb1, 0xdd, 0x7e, 0x0, 0xb7, 0x3e, 0xe, 0xc0, 0xdd, 0xe5, 0xe3, 0x34, 0x23, 0x73, 0x23, 
-0x72, 0x23, 0x73, 0x23, 0x72, 0x23, 0xeb, 0xe1, 0xd5, 0xe, 0x40, 0xaf, 0x12, 0x13, 0xd, 0x20, 
-0xfb, 0xd1, 0xd5, 0x78, 0xfe, 0x10, 0x38, 0x2, 0x6, 0x10, 0x4, 0x48, 0x18, 0x7, 0xe7, 0x23, 
-0xcd, 0x26, 0x29, 0x12, 0x13, 0x10, 0xf7, 0xd, 0x28, 0x9, 0x1b, 0x1a, 0xee, 0x20, 0x20, 0x3, 
-0x12, 0x18, 0xf4, 0xe1, 0xdd, 0x34, 0x15, 0xdd, 0x36, 0x17, 0x16, 0xdd, 0x35, 0x1c, 0x37, 0xc9, 
-0x3a, 0x1a, 0xb1, 0xb7, 0x3e, 0xe, 0xc8, 0x21, 0x1a, 0xb1, 0x6, 0x1, 0x7e, 0x36, 0x0, 0xc5, 
-0xcd, 0x6d, 0x25, 0xf1, 0x21, 0xe4, 0xb1, 0xae, 0x37, 0xc0, 0x77, 0x9f, 0xc9, 0xfe, 0x4, 0xd8, 
-0x23, 0x5e, 0x23, 0x56, 0x6b, 0x62, 0x13, 0x36, 0x0, 0x1, 0xff, 0x7, 0xc3, 0xa1, 0xba, 0x3a, 
-0x5f, 0xb1, 0xfe, 0x3, 0x28, 0x13, 0xc6, 0xff, 0x3e, 0xe, 0xd0, 0x21, 0x75, 0xb1, 0x35, 0x23, 
-0x23, 0x7e, 0x23, 0xb6, 0x37, 0xc4, 0x86, 0x27, 0xd0, 0x21, 0x5f, 0xb1, 0x6, 0x2, 0x18, 0xbc, 
-0xe5, 0xd5, 0xc5, 0x6, 0x5, 0xcd, 0xf6, 0x25, 0x20, 0x1a, 0x2a, 0x32, 0xb1, 0x7c, 0xb5, 0x37, 
-0xcc, 0xac, 0x26, 0x30, 0xf, 0x2a, 0x32, 0xb1, 0x2b, 0x22, 0x32, 0xb1, 0x2a, 0x1d, 0xb1, 0xe7, 
-0x23, 0x22, 0x1d, 0xb1, 0x18, 0x2c, 0xe5, 0xd5, 0xc5, 0x4f, 0x21, 0x5f, 0xb1, 0x6, 0x5, 0xcd, 
-0xf9, 0x25, 0x20, 0x1e, 0x2a, 0x77, 0xb1, 0x11, 0x0, 0x8, 0xed, 0x52, 0xc5, 0xd4, 0x86, 0x27, 
-0xc1, 0x30, 0xf, 0x2a, 0x77, 0xb1, 0x23, 0x22, 0x77, 0xb1, 0x2a, 0x62, 0xb1, 0x71, 0x23, 0x22, 
-0x62, 0xb1, 0xc1, 0xd1, 0xe1, 0xc9, 0x21, 0x1a, 0xb1, 0x7e, 0xb8, 0xc8, 0xee, 0x1, 0x3e, 0xe, 
-0xc0, 0x70, 0xc9, 0xcd, 0xa0, 0x25, 0xd0, 0xe5, 0x2a, 0x32, 0xb1, 0x23, 0x22, 0x32, 0xb1, 0x2a, 
-0x1d, 0xb1, 0x2b, 0x22, 0x1d, 0xb1, 0xe1, 0xc9, 0xeb, 0x6, 0x2, 0xcd, 0xf6, 0x25, 0xc0, 0xed, 
-0x53, 0x34, 0xb1, 0xcd, 0x3c, 0x26, 0x2a, 0x34, 0xb1, 0xed, 0x5b, 0x32, 0xb1, 0x19, 0x22, 0x34, 
-0xb1, 0xcd, 0xac, 0x26, 0x38, 0xf0, 0xc8, 0x2a, 0xbe, 0xb1, 0x37, 0xc9, 0x2a, 0x1b, 0xb1, 0xed, 
-0x4b, 0x32, 0xb1, 0x7b, 0x95, 0x7a, 0x9c, 0xda, 0xa1, 0xba, 0x9, 0x2b, 0xeb, 0x9, 0x2b, 0xeb, 
-0xc3, 0xa7, 0xba, 0xe5, 0xc5, 0x4f, 0x21, 0x5f, 0xb1, 0x6, 0x2, 0xcd, 0xf9, 0x25, 0x20, 0x2d, 
-0x79, 0xc1, 0xe1, 0x32, 0x76, 0xb1, 0xed, 0x53, 0x7c, 0xb1, 0xed, 0x43, 0x7e, 0xb1, 0x22, 0x60, 
-0xb1, 0xed, 0x53, 0x77, 0xb1, 0x21, 0xff, 0xf7, 0x19, 0x3f, 0xd8, 0x21, 0x0, 0x8, 0x22, 0x77, 
-0xb1, 0xeb, 0xed, 0x52, 0xe5, 0x2a, 0x60, 0xb1, 0x19, 0xe5, 0xcd, 0x86, 0x27, 0xe1, 0xd1, 0xd0, 
-0x18, 0xdc, 0x21, 0x1a, 0xb1, 0x7e, 0xb7, 0x3e, 0xe, 0xc0, 0x36, 0x4, 0xed, 0x53, 0x1b, 0xb1, 
-0xaf, 0xcd, 0xe1, 0x24, 0xcd, 0xb3, 0x26, 0x38, 0xfb, 0xc3, 0x57, 0x25, 0x3a, 0x30, 0xb1, 0xb7, 
-0x3e, 0xf, 0xc0, 0x1, 0x1, 0x83, 0xcd, 0xe5, 0x27, 0x30, 0x5f, 0x21, 0xa4, 0xb1, 0x11, 0x40, 
-0x0, 0x3e, 0x2c, 0xcd, 0xa6, 0x29, 0x30, 0x52, 0x6, 0x8b, 0xcd, 0x2f, 0x29, 0x28, 0x7, 0xcd, 
-0x37, 0x27, 0x20, 0x53, 0x6, 0x89, 0xcd, 0x4, 0x28, 0xed, 0x5b, 0xb7, 0xb1, 0x2a, 0x34, 0xb1, 
-0x3a, 0x1a, 0xb1, 0xfe, 0x2, 0x28, 0xe, 0x21, 0xff, 0xf7, 0x19, 0x3e, 0x4, 0x38, 0x2b, 0x2a, 
-0x1b, 0xb1, 0x22, 0x1d, 0xb1, 0x3e, 0x16, 0xcd, 0xa6, 0x29, 0x30, 0x1e, 0x21, 0x2f, 0xb1, 0x34, 
-0x3a, 0xb5, 0xb1, 0x23, 0x77, 0xaf, 0x32, 0x36, 0xb1, 0x2a, 0xb7, 0xb1, 0x22, 0x32, 0xb1, 0xcd, 
-0x2f, 0x29, 0x3e, 0x8c, 0xcc, 0x7e, 0x28, 0x37, 0x18, 0x65, 0xb7, 0x21, 0x1a, 0xb1, 0x28, 0x58, 
-0x6, 0x85, 0xcd, 0x85, 0x28, 0x18, 0x94, 0xf5, 0x6, 0x88, 0xcd, 0x4, 0x28, 0xf1, 0x30, 0x8b, 
-0x6, 0x87, 0xcd, 0x83, 0x28, 0x18, 0x84, 0x3a, 0x36, 0xb1, 0xb7, 0x28, 0x1b, 0x3a, 0xbb, 0xb1, 
-0x2f, 0xb7, 0xc0, 0x3a, 0x1f, 0xb1, 0xb7, 0xc4, 0x60, 0x27, 0xc0, 0x21, 0xa4, 0xb1, 0x11, 0x1f, 
-0xb1, 0x1, 0x40, 0x0, 0xed, 0xb0, 0xaf, 0xc9, 0xcd, 0x60, 0x27, 0xc0, 0xeb, 0x1a, 0xbe, 0xc9, 
-0x21, 0x1f, 0xb1, 0x11, 0xa4, 0xb1, 0x6, 0x10, 0x1a, 0xcd, 0x26, 0x29, 0x4f, 0x7e, 0xcd, 0x26, 
-0x29, 0xa9, 0xc0, 0x23, 0x13, 0x10, 0xf1, 0xc9, 0x7e, 0x36, 0x3, 0xcd, 0x6d, 0x25, 0xb7, 0x9f, 
-0xf5, 0xcd, 0xbf, 0x2b, 0xf1, 0xc9, 0x1, 0x2, 0x84, 0xcd, 0xe5, 0x27, 0x30, 0x4a, 0x6, 0x8a, 
-0x11, 0x64, 0xb1, 0xcd, 0x7, 0x28, 0x21, 0x7b, 0xb1, 0xcd, 0xfa, 0x27, 0x30, 0x3a, 0x2a, 0x60, 
-0xb1, 0x22, 0x62, 0xb1, 0x22, 0x79, 0xb1, 0xe5, 0x21, 0x64, 0xb1, 0x11, 0x40, 0x0, 0x3e, 0x2c, 
-0xcd, 0xaf, 0x29, 0xe1, 0x30, 0x22, 0xed, 0x5b, 0x77, 0xb1, 0x3e, 0x16, 0xcd, 0xaf, 0x29, 0x21, 
-0x75, 0xb1, 0xdc, 0xfa, 0x27, 0x30, 0x11, 0x21, 0x0, 0x0, 0x22, 0x77, 0xb1, 0x21, 0x74, 0xb1, 
-0x34, 0xaf, 0x32, 0x7b, 0xb1, 0x37, 0x18, 0xa7, 0xb7, 0x21, 0x5f, 0xb1, 0x28, 0x9a, 0x6, 0x86, 
-0xcd, 0x85, 0x28, 0x18, 0xb9, 0x21, 0xe4, 0xb1, 0x79, 0xbe, 0x71, 0x37, 0xe5, 0xc5, 0xc4, 0xd2, 
-0x28, 0xc1, 0xe1, 0x9f, 0xd0, 0xcd, 0xbb, 0x2b, 0x9f, 0xc9, 0x7e, 0xb7, 0x37, 0xc8, 0x1, 0x2c, 
-0x1, 0xc3, 0xe2, 0x2b, 0x11, 0xa4, 0xb1, 0x3a, 0x18, 0xb1, 0xb7, 0xc0, 0x32, 0x19, 0xb1, 0xcd, 
-0xf3, 0x28, 0xcd, 0x98, 0x28, 0x1a, 0xb7, 0x20, 0xa, 0x3e, 0x8e, 0xcd, 0x99, 0x28, 0x1, 0x10, 
-0x0, 0x18, 0x2e, 0xcd, 0x2f, 0x29, 0x1, 0x0, 0x10, 0x28, 0xd, 0x6b, 0x62, 0x7e, 0xb7, 0x28, 
-0x4, 0xc, 0x23, 0x10, 0xf8, 0x78, 0x41, 0x4f, 0xcd, 0xfd, 0x28, 0x1a, 0xcd, 0x26, 0x29, 0xb7, 
-0x20, 0x2, 0x3e, 0x20, 0xc5, 0xd5, 0xcd, 0x35, 0x13, 0xd1, 0xc1, 0x13, 0x10, 0xed, 0xcd, 0xce, 
-0x28, 0xeb, 0x9, 0xeb, 0x3e, 0x8d, 0xcd, 0x99, 0x28, 0x6, 0x2, 0xcd, 0xfd, 0x28, 0x1a, 0xcd, 
-0x14, 0x29, 0xcd, 0xce, 0x28, 0x13, 0xcd, 0x2f, 0x29, 0x20, 0xb, 0x13, 0x1a, 0xe6, 0xf, 0xc6, 
-0x24, 0xcd, 0xf0, 0x28, 0x18, 0x58, 0x1a, 0x21, 0x19, 0xb1, 0xb6, 0xc8, 0x18, 0x6d, 0xcd, 0x99, 
-0x28, 0x18, 0x68, 0x3e, 0xff, 0xf5, 0xcd, 0x91, 0x28, 0xf1, 0xc6, 0x60, 0xd4, 0xf0, 0x28, 0x18, 
-0x5a, 0xcd, 0x7c, 0x11, 0x25, 0xc4, 0xeb, 0x28, 0x78, 0xe5, 0xe6, 0x7f, 0x47, 0x21, 0x35, 0x29, 
-0x28, 0x7, 0x7e, 0x23, 0xb7, 0x20, 0xfb, 0x10, 0xf9, 0x7e, 0xb7, 0x28, 0x5, 0xcd, 0xb5, 0x28, 
-0x18, 0xf7, 0xe1, 0x23, 0xc9, 0xfa, 0x99, 0x28, 0xe5, 0x6, 0x0, 0x4, 0x7e, 0x23, 0x7, 0x30, 
-0xfa, 0xcd, 0xfd, 0x28, 0xe1, 0x7e, 0x23, 0xe6, 0x7f, 0xcd, 0xf0, 0x28, 0x10, 0xf7, 0x3e, 0x20, 
-0x18, 0x1e, 0x3a, 0x18, 0xb1, 0xb7, 0x37, 0xc0, 0xcd, 0x91, 0x28, 0xcd, 0xfe, 0x1b, 0xcd, 0x76, 
-0x12, 0xcd, 0xdb, 0x1c, 0xcd, 0x7e, 0x12, 0xfe, 0xfc, 0xc8, 0x37, 0xcd, 0xf3, 0x28, 0x3e, 0xa, 
-0xc3, 0xfe, 0x13, 0xf5, 0xe5, 0x3e, 0x1, 0xcd, 0x5a, 0x11, 0xe1, 0xf1, 0xc9, 0xd5, 0xcd, 0x52, 
-0x12, 0x5c, 0xcd, 0x7c, 0x11, 0x7c, 0x3d, 0x83, 0x80, 0x3d, 0xba, 0xd1, 0xd8, 0x3e, 0xff, 0x32, 
-0x19, 0xb1, 0x18, 0xd7, 0x6, 0xff, 0x4, 0xd6, 0xa, 0x30, 0xfb, 0xc6, 0x3a, 0xf5, 0x78, 0xb7, 
-0xc4, 0x14, 0x29, 0xf1, 0x18, 0xca, 0xfe, 0x61, 0xd8, 0xfe, 0x7b, 0xd0, 0xc6, 0xe0, 0xc9, 0x3a, 
-0x1a, 0xb1, 0xfe, 0x4, 0xc9, 0x50, 0x72, 0x65, 0x73, 0xf3, 0x0, 0x50, 0x4c, 0x41, 0xd9, 0x74, 
-0x68, 0x65, 0xee, 0x61, 0x6e, 0xf9, 0x6b, 0x65, 0x79, 0xba, 0x0, 0x65, 0x72, 0x72, 0x6f, 0xf2, 
-0x0, 0x80, 0x81, 0x0, 0x80, 0x52, 0x45, 0xc3, 0x61, 0x6e, 0xe4, 0x81, 0x0, 0x52, 0x65, 0x61, 
-0xe4, 0x82, 0x0, 0x57, 0x72, 0x69, 0x74, 0xe5, 0x82, 0x0, 0x52, 0x65, 0x77, 0x69, 0x6e, 0xe4, 
-0x74, 0x61, 0x70, 0xe5, 0x0, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0xa0, 0x0, 0x4c, 0x6f, 0x61, 
-0x64, 0x69, 0x6e, 0xe7, 0x0, 0x53, 0x61, 0x76, 0x69, 0x6e, 0xe7, 0x0, 0x0, 0x4f, 0xeb, 0x0, 
-0x62, 0x6c, 0x6f, 0x63, 0xeb, 0x0, 0x55, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0xe4, 0x66, 0x69, 0x6c, 
-0x65, 0x20, 0x20, 0x20, 0xa0, 0x0, 0xcd, 0xe3, 0x29, 0xf5, 0x21, 0x28, 0x2a, 0x18, 0x19, 0xcd, 
-0xe3, 0x29, 0xf5, 0xcd, 0xd4, 0x2a, 0x21, 0x67, 0x2a, 0xdc, 0xd, 0x2a, 0xdc, 0xe9, 0x2a, 0x18, 
-0xf, 0xcd, 0xe3, 0x29, 0xf5, 0x21, 0x37, 0x2a, 0xe5, 0xcd, 0x89, 0x2a, 0xe1, 0xdc, 0xd, 0x2a, 
-0xd1, 0xf5, 0x1, 0x82, 0xf7, 0xed, 0x49, 0x1, 0x10, 0xf6, 0xed, 0x49, 0xfb, 0x7a, 0xcd, 0xc1, 
-0x2b, 0xf1, 0xc9, 0x32, 0xe5, 0xb1, 0x1b, 0x1c, 0xe5, 0xd5, 0xcd, 0xe9, 0x1f, 0xd1, 0xdd, 0xe1, 
-0xcd, 0xbb, 0x2b, 0xf3, 0x1, 0xe, 0xf4, 0xed, 0x49, 0x1, 0xd0, 0xf6, 0xed, 0x49, 0xe, 0x10, 
-0xed, 0x49, 0x1, 0x92, 0xf7, 0xed, 0x49, 0x1, 0x58, 0xf6, 0xed, 0x49, 0xc9, 0x7a, 0xb7, 0x28, 
-0xd, 0xe5, 0xd5, 0x1e, 0x0, 0xcd, 0x1e, 0x2a, 0xd1, 0xe1, 0xd0, 0x15, 0x20, 0xf3, 0x1, 0xff, 
-0xff, 0xed, 0x43, 0xeb, 0xb1, 0x16, 0x1, 0xe9, 0xcd, 0x20, 0x2b, 0xd0, 0xdd, 0x77, 0x0, 0xdd, 
-0x23, 0x15, 0x1d, 0x20, 0xf3, 0x18, 0x12, 0xcd, 0x20, 0x2b, 0xd0, 0x47, 0xcd, 0xd7, 0xba, 0xa8, 
-0x3e, 0x3, 0xc0, 0xdd, 0x23, 0x15, 0x1d, 0x20, 0xee, 0x15, 0x28, 0x6, 0xcd, 0x20, 0x2b, 0xd0, 
-0x18, 0xf7, 0xcd, 0x16, 0x2b, 0xcd, 0x20, 0x2b, 0xd0, 0xaa, 0x20, 0x7, 0xcd, 0x20, 0x2b, 0xd0, 
-0xab, 0x37, 0xc8, 0x3e, 0x2, 0xb7, 0xc9, 0xcd, 0xd7, 0xba, 0xcd, 0x68, 0x2b, 0xd0, 0xdd, 0x23, 
-0x15, 0x1d, 0x20, 0xf3, 0x15, 0x28, 0x7, 0xaf, 0xcd, 0x68, 0x2b, 0xd0, 0x18, 0xf6, 0xcd, 0x16, 
-0x2b, 0xcd, 0x68, 0x2b, 0xd0, 0x7b, 0xc3, 0x68, 0x2b, 0xd5, 0xcd, 0x93, 0x2a, 0xd1, 0xd8, 0xb7, 
-0xc8, 0x18, 0xf6, 0x2e, 0x55, 0xcd, 0x3d, 0x2b, 0xd0, 0x11, 0x0, 0x0, 0x62, 0xcd, 0x3d, 0x2b, 
-0xd0, 0xeb, 0x6, 0x0, 0x9, 0xeb, 0x25, 0x20, 0xf4, 0x61, 0x79, 0x92, 0x4f, 0x9f, 0x47, 0xeb, 
-0x9, 0xeb, 0xcd, 0x3d, 0x2b, 0xd0, 0x7a, 0xcb, 0x3f, 0xcb, 0x3f, 0x8a, 0x94, 0x38, 0xea, 0x91, 
-0x38, 0xe7, 0x7a, 0x1f, 0x8a, 0x67, 0x22, 0xe6, 0xb1, 0xcd, 0x20, 0x2b, 0xd0, 0x21, 0xe5, 0xb1, 
-0xae, 0xc0, 0x37, 0xc9, 0xcd, 0xf9, 0x2b, 0x21, 0x1, 0x8, 0xcd, 0xec, 0x2a, 0xd0, 0xb7, 0xcd, 
-0x78, 0x2b, 0xd0, 0x3a, 0xe5, 0xb1, 0xc3, 0x68, 0x2b, 0x21, 0x21, 0x0, 0x6, 0xf4, 0xed, 0x78, 
-0xe6, 0x4, 0xc8, 0xe5, 0x37, 0xcd, 0x78, 0x2b, 0xe1, 0x2b, 0x7c, 0xb5, 0x20, 0xee, 0x37, 0xc9, 
-0x2a, 0xeb, 0xb1, 0xac, 0xf2, 0x10, 0x2b, 0x7c, 0xee, 0x8, 0x67, 0x7d, 0xee, 0x10, 0x6f, 0x37, 
-0xed, 0x6a, 0x22, 0xeb, 0xb1, 0xc9, 0x2a, 0xeb, 0xb1, 0x7d, 0x2f, 0x5f, 0x7c, 0x2f, 0x57, 0xc9, 
-0xd5, 0x1e, 0x8, 0x2a, 0xe6, 0xb1, 0xcd, 0x44, 0x2b, 0xdc, 0x4d, 0x2b, 0x30, 0xd, 0x7c, 0x91, 
-0x9f, 0xcb, 0x12, 0xcd, 0x0, 0x2b, 0x1d, 0x20, 0xea, 0x7a, 0x37, 0xd1, 0xc9, 0x6, 0xf4, 0xed, 
-0x78, 0xe6, 0x4, 0xc8, 0xed, 0x5f, 0xc6, 0x3, 0xf, 0xf, 0xe6, 0x1f, 0x4f, 0x6, 0xf5, 0x79, 
-0xc6, 0x2, 0x4f, 0x38, 0xe, 0xed, 0x78, 0xad, 0xe6, 0x80, 0x20, 0xf3, 0xaf, 0xed, 0x4f, 0xcb, 
-0xd, 0x37, 0xc9, 0xaf, 0xed, 0x4f, 0x3c, 0xc9, 0xd5, 0x1e, 0x8, 0x57, 0xcb, 0x2, 0xcd, 0x78, 
-0x2b, 0x30, 0x3, 0x1d, 0x20, 0xf6, 0xd1, 0xc9, 0xed, 0x4b, 0xe8, 0xb1, 0x2a, 0xea, 0xb1, 0x9f, 
-0x67, 0x28, 0x7, 0x7d, 0x87, 0x80, 0x6f, 0x79, 0x90, 0x4f, 0x7d, 0x32, 0xe8, 0xb1, 0x2e, 0xa, 
-0xcd, 0xa7, 0x2b, 0x38, 0x6, 0x91, 0x30, 0xc, 0x2f, 0x3c, 0x4f, 0x7c, 0xcd, 0x0, 0x2b, 0x2e, 
-0xb, 0xcd, 0xa7, 0x2b, 0x3e, 0x1, 0xc9, 0xed, 0x5f, 0xcb, 0x3f, 0x91, 0x30, 0x3, 0x3c, 0x20, 
-0xfd, 0x6, 0xf7, 0xed, 0x69, 0xf5, 0xaf, 0xed, 0x4f, 0xf1, 0xc9, 0x3e, 0x10, 0x18, 0x2, 0x3e, 
-0xef, 0xc5, 0x6, 0xf6, 0xed, 0x48, 0x4, 0xe6, 0x10, 0x3e, 0x8, 0x28, 0x1, 0x3c, 0xed, 0x79, 
-0x37, 0x28, 0xc, 0x79, 0xe6, 0x10, 0xc5, 0x1, 0xc8, 0x0, 0x37, 0xcc, 0xe2, 0x2b, 0xc1, 0x79, 
-0xc1, 0xc9, 0xc5, 0xe5, 0xcd, 0xf9, 0x2b, 0x3e, 0x42, 0xcd, 0x45, 0x1e, 0xe1, 0xc1, 0x20, 0x7, 
-0xb, 0x78, 0xb1, 0x20, 0xed, 0x37, 0xc9, 0xaf, 0xc9, 0x1, 0x82, 0x6, 0xb, 0x78, 0xb1, 0x20, 
-0xfb, 0xc9, 0xc5, 0xd5, 0xe5, 0xcd, 0xf2, 0x2d, 0x1, 0xff, 0x0, 0x7e, 0xfe, 0x30, 0x38, 0x7, 
-0xfe, 0x3a, 0xdc, 0x42, 0x2c, 0x38, 0xf4, 0x78, 0xb7, 0x7e, 0xc4, 0x42, 0x2c, 0xe5, 0xc, 0x7e, 
-0x23, 0xb7, 0x20, 0xfa, 0x32, 0x15, 0xb1, 0xe1, 0xcd, 0xe4, 0x2e, 0xc5, 0xe5, 0xcd, 0x56, 0x2f, 
-0xe1, 0xc1, 0xcd, 0x48, 0x2c, 0x30, 0xf4, 0xf5, 0xcd, 0x4f, 0x2e, 0xf1, 0xe1, 0xd1, 0xc1, 0xfe, 
-0xfc, 0xc9, 0xc, 0x4, 0x23, 0xc3, 0x25, 0x2f, 0xe5, 0x21, 0x72, 0x2c, 0x5f, 0x78, 0xb1, 0x7b, 
-0x20, 0xb, 0xfe, 0xf0, 0x38, 0x7, 0xfe, 0xf4, 0x30, 0x3, 0x21, 0xae, 0x2c, 0x56, 0x23, 0xe5, 
-0x23, 0x23, 0xbe, 0x23, 0x28, 0x4, 0x15, 0x20, 0xf7, 0xe3, 0xf1, 0x7e, 0x23, 0x66, 0x6f, 0x7b, 
-0xe3, 0xc9, 0x13, 0x8a, 0x2d, 0xfc, 0xd0, 0x2c, 0xef, 0xce, 0x2c, 0xd, 0xf2, 0x2c, 0xf0, 0x3c, 
-0x2d, 0xf1, 0xa, 0x2d, 0xf2, 0x34, 0x2d, 0xf3, 0x2, 0x2d, 0xf8, 0x4f, 0x2d, 0xf9, 0x1d, 0x2d, 
-0xfa, 0x45, 0x2d, 0xfb, 0x14, 0x2d, 0xf4, 0x21, 0x2e, 0xf5, 0x26, 0x2e, 0xf6, 0x1c, 0x2e, 0xf7, 
-0x17, 0x2e, 0xe0, 0x65, 0x2e, 0x7f, 0xc3, 0x2d, 0x10, 0xcd, 0x2d, 0xe1, 0x81, 0x2d, 0x4, 0xfe, 
-0x2c, 0xf0, 0xbd, 0x2c, 0xf1, 0xc1, 0x2c, 0xf2, 0xc9, 0x2c, 0xf3, 0xc5, 0x2c, 0x3e, 0xb, 0x18, 
-0xa, 0x3e, 0xa, 0x18, 0x6, 0x3e, 0x9, 0x18, 0x2, 0x3e, 0x8, 0xcd, 0xfe, 0x13, 0xb7, 0xc9, 
-0xcd, 0xf2, 0x2c, 0xf5, 0x21, 0xea, 0x2c, 0xcd, 0xf2, 0x2c, 0xcd, 0x7c, 0x11, 0x25, 0x28, 0x8, 
-0x3e, 0xd, 0xcd, 0xfe, 0x13, 0xcd, 0xc1, 0x2c, 0xf1, 0xc9, 0x2a, 0x42, 0x72, 0x65, 0x61, 0x6b, 
-0x2a, 0x0, 0xf5, 0x7e, 0x23, 0xb7, 0xc4, 0x25, 0x2f, 0x20, 0xf8, 0xf1, 0x37, 0xc9, 0x3e, 0x7, 
-0x18, 0xc9, 0x16, 0x1, 0xcd, 0x1e, 0x2d, 0x28, 0xf5, 0xc9, 0xcd, 0x73, 0x2d, 0x79, 0x90, 0xba, 
-0x38, 0xec, 0x18, 0xa, 0xcd, 0x73, 0x2d, 0x7a, 0x93, 0xc8, 0x57, 0x18, 0x1, 0x51, 0x78, 0xb9, 
-0xc8, 0xd5, 0xcd, 0xcd, 0x2e, 0x7e, 0xd4, 0x25, 0x2f, 0x4, 0x23, 0xd4, 0xe4, 0x2e, 0xd1, 0x15, 
-0x20, 0xec, 0x18, 0x3c, 0x16, 0x1, 0xcd, 0x50, 0x2d, 0x28, 0xc3, 0xc9, 0xcd, 0x73, 0x2d, 0x78, 
-0xba, 0x38, 0xbb, 0x18, 0xb, 0xcd, 0x73, 0x2d, 0x7b, 0xd6, 0x1, 0xc8, 0x57, 0x18, 0x1, 0x51, 
-0x78, 0xb7, 0xc8, 0xcd, 0xc7, 0x2e, 0x30, 0x7, 0x5, 0x2b, 0x15, 0x20, 0xf3, 0x18, 0x11, 0x78, 
-0xb7, 0x28, 0xa, 0x5, 0x2b, 0xd5, 0xcd, 0xa2, 0x2e, 0xd1, 0x15, 0x20, 0xf2, 0xcd, 0xe4, 0x2e, 
-0xf6, 0xff, 0xc9, 0xe5, 0xcd, 0x52, 0x12, 0x7a, 0x94, 0x3c, 0x57, 0xcd, 0x7c, 0x11, 0x5c, 0xe1, 
-0xc9, 0x3a, 0x15, 0xb1, 0x2f, 0x32, 0x15, 0xb1, 0xb7, 0xc9, 0xb7, 0xc8, 0x5f, 0x3a, 0x15, 0xb1, 
-0xb7, 0x79, 0x28, 0xb, 0xb8, 0x28, 0x8, 0x73, 0x23, 0x4, 0xb7, 0x7b, 0xc3, 0x25, 0x2f, 0xfe, 
-0xff, 0xca, 0xfe, 0x2c, 0xaf, 0x32, 0x14, 0xb1, 0xcd, 0x9b, 0x2d, 0xc, 0xe5, 0x7e, 0x73, 0x5f, 
-0x23, 0xb7, 0x20, 0xf9, 0x77, 0xe1, 0x4, 0x23, 0xcd, 0xe4, 0x2e, 0x3a, 0x14, 0xb1, 0xb7, 0xc4, 
-0xa2, 0x2e, 0xc9, 0x78, 0xb7, 0xc4, 0xc7, 0x2e, 0xd2, 0xfe, 0x2c, 0x5, 0x2b, 0x78, 0xb9, 0xca, 
-0xfe, 0x2c, 0xe5, 0x23, 0x7e, 0x2b, 0x77, 0x23, 0xb7, 0x20, 0xf8, 0x2b, 0x36, 0x20, 0x32, 0x14, 
-0xb1, 0xe3, 0xcd, 0xe4, 0x2e, 0xe3, 0x36, 0x0, 0xe1, 0xd, 0x3a, 0x14, 0xb1, 0xb7, 0xc4, 0xa6, 
-0x2e, 0xc9, 0xaf, 0x32, 0x16, 0xb1, 0x32, 0x17, 0xb1, 0xc9, 0xed, 0x5b, 0x16, 0xb1, 0x7c, 0xaa, 
-0xc0, 0x7d, 0xab, 0xc0, 0x37, 0xc9, 0x4f, 0xcd, 0xc1, 0x2e, 0xc8, 0x7d, 0x81, 0x6f, 0xcd, 0xca, 
-0x11, 0x30, 0xdf, 0x22, 0x16, 0xb1, 0xc9, 0x11, 0x0, 0x1, 0x18, 0xd, 0x11, 0x0, 0xff, 0x18, 
-0x8, 0x11, 0xff, 0x0, 0x18, 0x3, 0x11, 0x1, 0x0, 0xc5, 0xe5, 0xcd, 0xc1, 0x2e, 0xcc, 0x7c, 
-0x11, 0x7c, 0x82, 0x67, 0x7d, 0x83, 0x6f, 0xcd, 0xca, 0x11, 0x30, 0xb, 0xe5, 0xcd, 0x4f, 0x2e, 
-0xe1, 0x22, 0x16, 0xb1, 0xcd, 0x4a, 0x2e, 0xe1, 0xc1, 0xc9, 0x11, 0x65, 0x12, 0x18, 0x3, 0x11, 
-0x65, 0x12, 0xcd, 0xc1, 0x2e, 0xc8, 0xe5, 0xcd, 0x7c, 0x11, 0xe3, 0xcd, 0x70, 0x11, 0xcd, 0x16, 
-0x0, 0xe1, 0xc3, 0x70, 0x11, 0xc5, 0xe5, 0xcd, 0x7c, 0x11, 0xeb, 0xcd, 0xc1, 0x2e, 0x20, 0xc, 
-0x78, 0xb1, 0x20, 0x26, 0xcd, 0x7c, 0x11, 0x22, 0x16, 0xb1, 0x18, 0x6, 0xcd, 0x70, 0x11, 0xcd, 
-0x65, 0x12, 0xcd, 0xac, 0x13, 0xf5, 0xeb, 0xcd, 0x70, 0x11, 0x2a, 0x16, 0xb1, 0x24, 0xcd, 0xca, 
-0x11, 0x30, 0x3, 0x22, 0x16, 0xb1, 0xcd, 0x4a, 0x2e, 0xf1, 0xe1, 0xc1, 0xda, 0x8a, 0x2d, 0xc3, 
-0xfe, 0x2c, 0x16, 0x1, 0x18, 0x2, 0x16, 0xff, 0xc5, 0xe5, 0xd5, 0xcd, 0x4f, 0x2e, 0xd1, 0xcd, 
-0xc1, 0x2e, 0x28, 0x9, 0x7c, 0x82, 0x67, 0xcd, 0xe, 0x2e, 0xcd, 0x4a, 0x2e, 0xe1, 0xc1, 0xb7, 
-0xc9, 0x2a, 0x16, 0xb1, 0x7c, 0xb5, 0xc9, 0xd5, 0x11, 0x8, 0xff, 0x18, 0x4, 0xd5, 0x11, 0x9, 
-0x1, 0xc5, 0xe5, 0xcd, 0x7c, 0x11, 0x7a, 0x84, 0x67, 0xcd, 0xca, 0x11, 0x7b, 0xdc, 0xfe, 0x13, 
-0xe1, 0xc1, 0xd1, 0xc9, 0xc5, 0xe5, 0xeb, 0xcd, 0x7c, 0x11, 0x4f, 0xeb, 0x7e, 0x23, 0xb7, 0xc4, 
-0x2, 0x2f, 0x20, 0xf8, 0xcd, 0x7c, 0x11, 0x91, 0xeb, 0x85, 0x6f, 0xcd, 0x70, 0x11, 0xe1, 0xc1, 
-0xb7, 0xc9, 0xf5, 0xc5, 0xd5, 0xe5, 0x47, 0xcd, 0x7c, 0x11, 0x91, 0x83, 0x5f, 0x48, 0xcd, 0xca, 
-0x11, 0x38, 0x5, 0x78, 0x87, 0x3c, 0x83, 0x5f, 0xeb, 0xcd, 0xca, 0x11, 0x79, 0xdc, 0x25, 0x2f, 
-0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0xf5, 0xc5, 0xd5, 0xe5, 0x47, 0xcd, 0x7c, 0x11, 0x4f, 0xc5, 0xcd, 
-0xca, 0x11, 0xc1, 0xdc, 0xfa, 0x2d, 0xf5, 0xdc, 0x4f, 0x2e, 0x78, 0xc5, 0xcd, 0x35, 0x13, 0xc1, 
-0xcd, 0x7c, 0x11, 0x91, 0xc4, 0x6, 0x2e, 0xf1, 0x30, 0x7, 0x9f, 0x32, 0x14, 0xb1, 0xcd, 0x4a, 
-0x2e, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0xcd, 0x7c, 0x11, 0x4f, 0xcd, 0xca, 0x11, 0xcd, 0xfa, 0x2d, 
-0xda, 0xbf, 0x1b, 0xcd, 0x76, 0x12, 0xcd, 0x7c, 0x11, 0x91, 0xc4, 0x6, 0x2e, 0xcd, 0xbf, 0x1b, 
-0xc3, 0x7e, 0x12, 0x11, 0x78, 0x2f, 0x18, 0x19, 0xa2, 0xda, 0xf, 0x49, 0x82, 0x11, 0x82, 0x2f, 
-0x18, 0xf, 0x0, 0x0, 0x0, 0x0, 0x81, 0xeb, 0x21, 0xe, 0xb1, 0x18, 0x4, 0x11, 0x4, 0xb1, 
-0xeb, 0xe5, 0xd5, 0xc5, 0xeb, 0x1, 0x5, 0x0, 0xed, 0xb0, 0xc1, 0xd1, 0xe1, 0x37, 0xc9, 0xd5, 
-0xc5, 0xf6, 0x7f, 0x47, 0xaf, 0x12, 0x13, 0x12, 0x13, 0xe, 0x90, 0xb4, 0x20, 0xd, 0x4f, 0xb5, 
-0x28, 0xd, 0x6c, 0xe, 0x88, 0x18, 0x4, 0xd, 0xcb, 0x25, 0x8f, 0xf2, 0xb7, 0x2f, 0xa0, 0xeb, 
-0x73, 0x23, 0x77, 0x23, 0x71, 0xc1, 0xe1, 0xc9, 0xc5, 0x1, 0x0, 0xa0, 0xcd, 0xd3, 0x2f, 0xc1, 
-0xc9, 0x6, 0xa8, 0xd5, 0xcd, 0x9c, 0x37, 0xd1, 0xc9, 0xe5, 0xdd, 0xe1, 0xaf, 0xdd, 0x96, 0x4, 
-0x28, 0x1b, 0xc6, 0x90, 0xd0, 0xd5, 0xc5, 0xc6, 0x10, 0xcd, 0x3d, 0x37, 0xcb, 0x21, 0xed, 0x5a, 
-0x28, 0x8, 0xdd, 0x7e, 0x3, 0xb7, 0x3f, 0xc1, 0xd1, 0xc9, 0x9f, 0x18, 0xf9, 0x6f, 0x67, 0x37, 
-0xc9, 0xcd, 0x14, 0x30, 0xd0, 0xf0, 0xe5, 0x79, 0x34, 0x20, 0x6, 0x23, 0x3d, 0x20, 0xf9, 0x34, 
-0xc, 0xe1, 0x37, 0xc9, 0xe5, 0xd5, 0xe5, 0xdd, 0xe1, 0xaf, 0xdd, 0x96, 0x4, 0x20, 0xa, 0x6, 
-0x4, 0x77, 0x23, 0x10, 0xfc, 0xe, 0x1, 0x18, 0x28, 0xc6, 0xa0, 0x30, 0x25, 0xe5, 0xcd, 0x3d, 
-0x37, 0xaf, 0xb8, 0x8f, 0xb1, 0x4d, 0x44, 0xe1, 0x71, 0x23, 0x70, 0x23, 0x73, 0x23, 0x5f, 0x7e, 
-0x72, 0xe6, 0x80, 0x47, 0xe, 0x4, 0xaf, 0xb6, 0x20, 0x5, 0x2b, 0xd, 0x20, 0xf9, 0xc, 0x7b, 
-0xb7, 0x37, 0xd1, 0xe1, 0xc9, 0xcd, 0x14, 0x30, 0xd0, 0xc8, 0xcb, 0x78, 0xc8, 0x18, 0xa7, 0xcd, 
-0x27, 0x37, 0x47, 0x28, 0x52, 0xfc, 0x34, 0x37, 0xe5, 0xdd, 0x7e, 0x4, 0xd6, 0x80, 0x5f, 0x9f, 
-0x57, 0x6b, 0x62, 0x29, 0x29, 0x29, 0x19, 0x29, 0x19, 0x29, 0x29, 0x19, 0x7c, 0xd6, 0x9, 0x4f, 
-0xe1, 0xc5, 0xc4, 0xc8, 0x30, 0x11, 0xbc, 0x30, 0xcd, 0xe2, 0x36, 0x30, 0xb, 0x11, 0xf5, 0x30, 
-0xcd, 0x77, 0x35, 0xd1, 0x1d, 0xd5, 0x18, 0xed, 0x11, 0xc1, 0x30, 0xcd, 0xe2, 0x36, 0x38, 0xb, 
-0x11, 0xf5, 0x30, 0xcd, 0x4, 0x36, 0xd1, 0x1c, 0xd5, 0x18, 0xed, 0xcd, 0x1, 0x30, 0x79, 0xd1, 
-0x42, 0x3d, 0x85, 0x6f, 0xd0, 0x24, 0xc9, 0x5f, 0x77, 0xe, 0x1, 0xc9, 0xf0, 0x1f, 0xbc, 0x3e, 
-0x96, 0xfe, 0x27, 0x6b, 0x6e, 0x9e, 0x2f, 0x3c, 0xb7, 0x37, 0xc8, 0x4f, 0xf2, 0xd1, 0x30, 0x2f, 
-0x3c, 0x11, 0x31, 0x31, 0xd6, 0xd, 0x28, 0x15, 0x38, 0x9, 0xc5, 0xf5, 0xcd, 0xed, 0x30, 0xf1, 
-0xc1, 0x18, 0xee, 0x47, 0x87, 0x87, 0x80, 0x83, 0x5f, 0x3e, 0xff, 0x8a, 0x57, 0x79, 0xb7, 0xf2, 
-0x4, 0x36, 0xc3, 0x77, 0x35, 0x0, 0x0, 0x0, 0x20, 0x84, 0x0, 0x0, 0x0, 0x48, 0x87, 0x0, 
-0x0, 0x0, 0x7a, 0x8a, 0x0, 0x0, 0x40, 0x1c, 0x8e, 0x0, 0x0, 0x50, 0x43, 0x91, 0x0, 0x0, 
-0x24, 0x74, 0x94, 0x0, 0x80, 0x96, 0x18, 0x98, 0x0, 0x20, 0xbc, 0x3e, 0x9b, 0x0, 0x28, 0x6b, 
-0x6e, 0x9e, 0x0, 0xf9, 0x2, 0x15, 0xa2, 0x40, 0xb7, 0x43, 0x3a, 0xa5, 0x10, 0xa5, 0xd4, 0x68, 
-0xa8, 0x2a, 0xe7, 0x84, 0x11, 0xac, 0x21, 0x65, 0x89, 0x22, 0x2, 0xb1, 0x21, 0x7, 0x6c, 0x22, 
-0x0, 0xb1, 0xc9, 0xeb, 0xcd, 0x36, 0x31, 0xeb, 0xcd, 0x27, 0x37, 0xc8, 0x11, 0x0, 0xb1, 0x6, 
-0x4, 0x1a, 0xae, 0x12, 0x13, 0x23, 0x10, 0xf9, 0xc9, 0xe5, 0x2a, 0x2, 0xb1, 0x1, 0x7, 0x6c, 
-0xcd, 0x9c, 0x31, 0xe5, 0x2a, 0x0, 0xb1, 0x1, 0x65, 0x89, 0xcd, 0x9c, 0x31, 0xd5, 0xe5, 0x2a, 
-0x2, 0xb1, 0xcd, 0x9c, 0x31, 0xe3, 0x9, 0x22, 0x0, 0xb1, 0xe1, 0x1, 0x7, 0x6c, 0xed, 0x4a, 
-0xc1, 0x9, 0xc1, 0x9, 0x22, 0x2, 0xb1, 0xe1, 0xe5, 0xdd, 0xe1, 0x2a, 0x0, 0xb1, 0xed, 0x5b, 
-0x2, 0xb1, 0x1, 0x0, 0x0, 0xdd, 0x36, 0x4, 0x80, 0xc3, 0xac, 0x37, 0xeb, 0x21, 0x0, 0x0, 
-0x3e, 0x11, 0x3d, 0xc8, 0x29, 0xcb, 0x13, 0xcb, 0x12, 0x30, 0xf7, 0x9, 0x30, 0xf4, 0x13, 0x18, 
-0xf1, 0x11, 0x2a, 0x32, 0x18, 0x3, 0x11, 0x25, 0x32, 0xcd, 0x27, 0x37, 0x3d, 0xfe, 0x1, 0xd0, 
-0xd5, 0xcd, 0xd3, 0x36, 0xf5, 0xdd, 0x36, 0x4, 0x80, 0x11, 0x20, 0x32, 0xcd, 0xdf, 0x36, 0x30, 
-0x6, 0xdd, 0x34, 0x4, 0xf1, 0x3d, 0xf5, 0xcd, 0x87, 0x2f, 0xd5, 0x11, 0x82, 0x2f, 0xd5, 0xcd, 
-0xa2, 0x34, 0xd1, 0xe3, 0xcd, 0x9a, 0x34, 0xd1, 0xcd, 0x4, 0x36, 0xcd, 0x40, 0x34, 0x4, 0x4c, 
-0x4b, 0x57, 0x5e, 0x7f, 0xd, 0x8, 0x9b, 0x13, 0x80, 0x23, 0x93, 0x38, 0x76, 0x80, 0x20, 0x3b, 
-0xaa, 0x38, 0x82, 0xd5, 0xcd, 0x77, 0x35, 0xd1, 0xe3, 0x7c, 0xb7, 0xf2, 0x10, 0x32, 0x2f, 0x3c, 
-0x6f, 0x7c, 0x26, 0x0, 0xcd, 0x9f, 0x2f, 0xeb, 0xe1, 0xcd, 0xa2, 0x34, 0xd1, 0xc3, 0x77, 0x35, 
-0x34, 0xf3, 0x4, 0x35, 0x80, 0xf8, 0x17, 0x72, 0x31, 0x80, 0x85, 0x9a, 0x20, 0x1a, 0x7f, 0x6, 
-0xe1, 0xcd, 0x92, 0x34, 0xd2, 0x7d, 0x2f, 0x11, 0xa2, 0x32, 0xcd, 0xdf, 0x36, 0xf2, 0xe8, 0x37, 
-0x11, 0xa7, 0x32, 0xcd, 0xdf, 0x36, 0xfa, 0xe2, 0x37, 0x11, 0x9d, 0x32, 0xcd, 0x69, 0x34, 0x7b, 
-0xf2, 0x55, 0x32, 0xed, 0x44, 0xf5, 0xcd, 0x70, 0x35, 0xcd, 0x8d, 0x2f, 0xd5, 0xcd, 0x43, 0x34, 
-0x3, 0xf4, 0x32, 0xeb, 0xf, 0x73, 0x8, 0xb8, 0xd5, 0x52, 0x7b, 0x0, 0x0, 0x0, 0x0, 0x80, 
-0xe3, 0xcd, 0x43, 0x34, 0x2, 0x9, 0x60, 0xde, 0x1, 0x78, 0xf8, 0x17, 0x72, 0x31, 0x7e, 0xcd, 
-0x77, 0x35, 0xd1, 0xe5, 0xeb, 0xcd, 0x9a, 0x34, 0xeb, 0xe1, 0xcd, 0x4, 0x36, 0x11, 0x6b, 0x32, 
-0xcd, 0xa2, 0x34, 0xf1, 0x37, 0xdd, 0x8e, 0x4, 0xdd, 0x77, 0x4, 0x37, 0xc9, 0x29, 0x3b, 0xaa, 
-0x38, 0x81, 0xc7, 0x33, 0xf, 0x30, 0x87, 0xf8, 0x17, 0x72, 0xb1, 0x87, 0x11, 0x6b, 0x32, 0xeb, 
-0xcd, 0x27, 0x37, 0xeb, 0xca, 0x7d, 0x2f, 0xf5, 0xcd, 0x27, 0x37, 0x28, 0x25, 0x47, 0xfc, 0x34, 
-0x37, 0xe5, 0xcd, 0x24, 0x33, 0xe1, 0x38, 0x25, 0xe3, 0xe1, 0xfa, 0xea, 0x32, 0xc5, 0xd5, 0xcd, 
-0xb6, 0x31, 0xd1, 0xdc, 0x77, 0x35, 0xdc, 0x2f, 0x32, 0xc1, 0xd0, 0x78, 0xb7, 0xfc, 0x31, 0x37, 
-0x37, 0xc9, 0xf1, 0x37, 0xf0, 0xcd, 0xe8, 0x37, 0xaf, 0xc9, 0xaf, 0x3c, 0xc9, 0x4f, 0xf1, 0xc5, 
-0xf5, 0x79, 0x37, 0x8f, 0x30, 0xfd, 0x47, 0xcd, 0x8d, 0x2f, 0xeb, 0x78, 0x87, 0x28, 0x15, 0xf5, 
-0xcd, 0x70, 0x35, 0x30, 0x16, 0xf1, 0x30, 0xf4, 0xf5, 0x11, 0x4, 0xb1, 0xcd, 0x77, 0x35, 0x30, 
-0xa, 0xf1, 0x18, 0xe8, 0xf1, 0x37, 0xfc, 0xfb, 0x35, 0x18, 0xbe, 0xf1, 0xf1, 0xc1, 0xfa, 0xe2, 
-0x37, 0xc3, 0xea, 0x37, 0xc5, 0xcd, 0x88, 0x2f, 0xcd, 0x14, 0x30, 0x79, 0xc1, 0x30, 0x2, 0x28, 
-0x3, 0x78, 0xb7, 0xc9, 0x4f, 0x7e, 0x1f, 0x9f, 0xa0, 0x47, 0x79, 0xfe, 0x2, 0x9f, 0xd0, 0x7e, 
-0xfe, 0x27, 0xd8, 0xaf, 0xc9, 0x32, 0x13, 0xb1, 0xc9, 0xcd, 0x27, 0x37, 0xfc, 0x34, 0x37, 0xf6, 
-0x1, 0x18, 0x1, 0xaf, 0xf5, 0x11, 0xb4, 0x33, 0x6, 0xf0, 0x3a, 0x13, 0xb1, 0xb7, 0x28, 0x5, 
-0x11, 0xb9, 0x33, 0x6, 0xf6, 0xcd, 0x92, 0x34, 0x30, 0x3a, 0xf1, 0xcd, 0x6a, 0x34, 0xd0, 0x7b, 
-0x1f, 0xdc, 0x34, 0x37, 0x6, 0xe8, 0xcd, 0x92, 0x34, 0xd2, 0xe2, 0x37, 0xdd, 0x34, 0x4, 0xcd, 
-0x40, 0x34, 0x6, 0x1b, 0x2d, 0x1a, 0xe6, 0x6e, 0xf8, 0xfb, 0x7, 0x28, 0x74, 0x1, 0x89, 0x68, 
-0x99, 0x79, 0xe1, 0xdf, 0x35, 0x23, 0x7d, 0x28, 0xe7, 0x5d, 0xa5, 0x80, 0xa2, 0xda, 0xf, 0x49, 
-0x81, 0xc3, 0x77, 0x35, 0xf1, 0xc2, 0x7d, 0x2f, 0x3a, 0x13, 0xb1, 0xfe, 0x1, 0xd8, 0x11, 0xbe, 
-0x33, 0xc3, 0x77, 0x35, 0x6e, 0x83, 0xf9, 0x22, 0x7f, 0xb6, 0x60, 0xb, 0x36, 0x79, 0x13, 0x35, 
-0xfa, 0xe, 0x7b, 0xd3, 0xe0, 0x2e, 0x65, 0x86, 0xcd, 0x8d, 0x2f, 0xd5, 0xcd, 0x49, 0x33, 0xe3, 
-0xdc, 0x53, 0x33, 0xd1, 0xda, 0x4, 0x36, 0xc9, 0xcd, 0x27, 0x37, 0xf5, 0xfc, 0x34, 0x37, 0x6, 
-0xf0, 0xcd, 0x92, 0x34, 0x30, 0x4a, 0x3d, 0xf5, 0xf4, 0xfb, 0x35, 0xcd, 0x40, 0x34, 0xb, 0xff, 
-0xc1, 0x3, 0xf, 0x77, 0x83, 0xfc, 0xe8, 0xeb, 0x79, 0x6f, 0xca, 0x78, 0x36, 0x7b, 0xd5, 0x3e, 
-0xb0, 0xb5, 0x7c, 0xb0, 0xc1, 0x8b, 0x9, 0x7d, 0xaf, 0xe8, 0x32, 0xb4, 0x7d, 0x74, 0x6c, 0x65, 
-0x62, 0x7d, 0xd1, 0xf5, 0x37, 0x92, 0x7e, 0x7a, 0xc3, 0xcb, 0x4c, 0x7e, 0x83, 0xa7, 0xaa, 0xaa, 
-0x7f, 0xfe, 0xff, 0xff, 0x7f, 0x80, 0xcd, 0x77, 0x35, 0xf1, 0x11, 0x9c, 0x33, 0xf4, 0x9e, 0x34, 
-0x3a, 0x13, 0xb1, 0xb7, 0x11, 0xc3, 0x33, 0xc4, 0x77, 0x35, 0xf1, 0xfc, 0x34, 0x37, 0x37, 0xc9, 
-0xcd, 0x70, 0x35, 0xcd, 0x87, 0x2f, 0xe1, 0x46, 0x23, 0xcd, 0x90, 0x2f, 0x13, 0x13, 0x13, 0x13, 
-0x13, 0xd5, 0x11, 0x9, 0xb1, 0x5, 0xc8, 0xc5, 0x11, 0xe, 0xb1, 0xcd, 0x77, 0x35, 0xc1, 0xd1, 
-0xd5, 0xc5, 0xcd, 0xa2, 0x34, 0xc1, 0xd1, 0x18, 0xe3, 0xaf, 0xf5, 0xcd, 0x77, 0x35, 0xf1, 0x11, 
-0x6b, 0x32, 0xc4, 0xa2, 0x34, 0xe5, 0xcd, 0xd9, 0x2f, 0x30, 0x13, 0xd1, 0xe5, 0xf5, 0xd5, 0x11, 
-0x9, 0xb1, 0xcd, 0x9f, 0x2f, 0xeb, 0xe1, 0xcd, 0x9a, 0x34, 0xf1, 0xd1, 0x37, 0xc9, 0xe1, 0xaf, 
-0x3c, 0xc9, 0xcd, 0xd3, 0x36, 0xf0, 0xb8, 0xc8, 0x3f, 0xc9, 0x3e, 0x1, 0x18, 0x5, 0x3e, 0x80, 
-0x18, 0x1, 0xaf, 0xe5, 0xdd, 0xe1, 0xd5, 0xfd, 0xe1, 0xdd, 0x46, 0x3, 0xfd, 0x4e, 0x3, 0xb7, 
-0x28, 0xa, 0xfa, 0xba, 0x34, 0xf, 0xa9, 0x4f, 0x18, 0x2, 0xa8, 0x47, 0xdd, 0x7e, 0x4, 0xfd, 
-0xbe, 0x4, 0x30, 0x14, 0x50, 0x41, 0x4a, 0xb7, 0x57, 0xfd, 0x7e, 0x4, 0xdd, 0x77, 0x4, 0x28, 
-0x54, 0x92, 0xfe, 0x21, 0x30, 0x4f, 0x18, 0x11, 0xaf, 0xfd, 0x96, 0x4, 0x28, 0x59, 0xdd, 0x86, 
-0x4, 0xfe, 0x21, 0x30, 0x52, 0xe5, 0xfd, 0xe1, 0xeb, 0x5f, 0x78, 0xa9, 0xf5, 0xc5, 0x7b, 0xcd, 
-0x43, 0x37, 0x79, 0xc1, 0x4f, 0xf1, 0xfa, 0x3c, 0x35, 0xfd, 0x7e, 0x0, 0x85, 0x6f, 0xfd, 0x7e, 
-0x1, 0x8c, 0x67, 0xfd, 0x7e, 0x2, 0x8b, 0x5f, 0xfd, 0x7e, 0x3, 0xcb, 0xff, 0x8a, 0x57, 0xd2, 
-0xb7, 0x37, 0xcb, 0x1a, 0xcb, 0x1b, 0xcb, 0x1c, 0xcb, 0x1d, 0xcb, 0x19, 0xdd, 0x34, 0x4, 0xc2, 
-0xb7, 0x37, 0xc3, 0xea, 0x37, 0xfd, 0x7e, 0x2, 0xdd, 0x77, 0x2, 0xfd, 0x7e, 0x1, 0xdd, 0x77, 
-0x1, 0xfd, 0x7e, 0x0, 0xdd, 0x77, 0x0, 0xdd, 0x70, 0x3, 0x37, 0xc9, 0xaf, 0x91, 0x4f, 0xfd, 
-0x7e, 0x0, 0x9d, 0x6f, 0xfd, 0x7e, 0x1, 0x9c, 0x67, 0xfd, 0x7e, 0x2, 0x9b, 0x5f, 0xfd, 0x7e, 
-0x3, 0xcb, 0xff, 0x9a, 0x57, 0x30, 0x16, 0x78, 0x2f, 0x47, 0xaf, 0x91, 0x4f, 0x3e, 0x0, 0x9d, 
-0x6f, 0x3e, 0x0, 0x9c, 0x67, 0x3e, 0x0, 0x9b, 0x5f, 0x3e, 0x0, 0x9a, 0x57, 0xc3, 0xac, 0x37, 
-0x11, 0x9, 0xb1, 0xcd, 0x90, 0x2f, 0xeb, 0xd5, 0xfd, 0xe1, 0xe5, 0xdd, 0xe1, 0xfd, 0x7e, 0x4, 
-0xb7, 0x28, 0x2a, 0x3d, 0xcd, 0xaf, 0x36, 0x28, 0x24, 0x30, 0x1f, 0xf5, 0xc5, 0xcd, 0xb0, 0x35, 
-0x79, 0xc1, 0x4f, 0xf1, 0xcb, 0x7a, 0x20, 0xb, 0x3d, 0x28, 0x12, 0xcb, 0x21, 0xed, 0x6a, 0xcb, 
-0x13, 0xcb, 0x12, 0xdd, 0x77, 0x4, 0xb7, 0xc2, 0xb7, 0x37, 0xc3, 0xea, 0x37, 0xc3, 0xe2, 0x37, 
-0x21, 0x0, 0x0, 0x5d, 0x54, 0xfd, 0x7e, 0x0, 0xcd, 0xf3, 0x35, 0xfd, 0x7e, 0x1, 0xcd, 0xf3, 
-0x35, 0xfd, 0x7e, 0x2, 0xcd, 0xf3, 0x35, 0xfd, 0x7e, 0x3, 0xf6, 0x80, 0x6, 0x8, 0x1f, 0x4f, 
-0x30, 0x14, 0x7d, 0xdd, 0x86, 0x0, 0x6f, 0x7c, 0xdd, 0x8e, 0x1, 0x67, 0x7b, 0xdd, 0x8e, 0x2, 
-0x5f, 0x7a, 0xdd, 0x8e, 0x3, 0x57, 0xcb, 0x1a, 0xcb, 0x1b, 0xcb, 0x1c, 0xcb, 0x1d, 0xcb, 0x19, 
-0x10, 0xde, 0xc9, 0xb7, 0x20, 0xd6, 0x6c, 0x63, 0x5a, 0x57, 0xc9, 0xcd, 0x87, 0x2f, 0xeb, 0xd5, 
-0xcd, 0x7d, 0x2f, 0xd1, 0xd5, 0xfd, 0xe1, 0xe5, 0xdd, 0xe1, 0xaf, 0xfd, 0x96, 0x4, 0x28, 0x5a, 
-0xcd, 0xaf, 0x36, 0xca, 0xe2, 0x37, 0x30, 0x4f, 0xc5, 0x4f, 0x5e, 0x23, 0x56, 0x23, 0x7e, 0x23, 
-0x66, 0x6f, 0xeb, 0xfd, 0x46, 0x3, 0xcb, 0xf8, 0xcd, 0x9d, 0x36, 0x38, 0x6, 0x79, 0xb7, 0x20, 
-0x8, 0x18, 0x33, 0xd, 0x29, 0xcb, 0x13, 0xcb, 0x12, 0xdd, 0x71, 0x4, 0xcd, 0x72, 0x36, 0xdd, 
-0x71, 0x3, 0xcd, 0x72, 0x36, 0xdd, 0x71, 0x2, 0xcd, 0x72, 0x36, 0xdd, 0x71, 0x1, 0xcd, 0x72, 
-0x36, 0x3f, 0xdc, 0x9d, 0x36, 0x3f, 0x9f, 0x69, 0xdd, 0x66, 0x1, 0xdd, 0x5e, 0x2, 0xdd, 0x56, 
-0x3, 0xc1, 0x4f, 0xc3, 0xb7, 0x37, 0xc1, 0xc3, 0xea, 0x37, 0xdd, 0x46, 0x3, 0xcd, 0xea, 0x37, 
-0xaf, 0xc9, 0xe, 0x1, 0x38, 0x8, 0x7a, 0xb8, 0xcc, 0xa0, 0x36, 0x3f, 0x30, 0x13, 0x7d, 0xfd, 
-0x96, 0x0, 0x6f, 0x7c, 0xfd, 0x9e, 0x1, 0x67, 0x7b, 0xfd, 0x9e, 0x2, 0x5f, 0x7a, 0x98, 0x57, 
-0x37, 0xcb, 0x11, 0x9f, 0x29, 0xcb, 0x13, 0xcb, 0x12, 0x3c, 0x20, 0xd8, 0xc9, 0x7a, 0xb8, 0xc0, 
-0x7b, 0xfd, 0xbe, 0x2, 0xc0, 0x7c, 0xfd, 0xbe, 0x1, 0xc0, 0x7d, 0xfd, 0xbe, 0x0, 0xc9, 0x4f, 
-0xdd, 0x7e, 0x3, 0xfd, 0xae, 0x3, 0x47, 0xdd, 0x7e, 0x4, 0xb7, 0xc8, 0x81, 0x4f, 0x1f, 0xa9, 
-0x79, 0xf2, 0xcf, 0x36, 0xdd, 0xcb, 0x3, 0xfe, 0xd6, 0x7f, 0x37, 0xc0, 0xfe, 0x1, 0xc9, 0xb7, 
-0xf8, 0xaf, 0xc9, 0xe5, 0xdd, 0xe1, 0xdd, 0x7e, 0x4, 0xb7, 0xc8, 0xd6, 0x80, 0x37, 0xc9, 0xe5, 
-0xdd, 0xe1, 0xd5, 0xfd, 0xe1, 0xdd, 0x7e, 0x4, 0xfd, 0xbe, 0x4, 0x38, 0x2c, 0x20, 0x33, 0xb7, 
-0xc8, 0xdd, 0x7e, 0x3, 0xfd, 0xae, 0x3, 0xfa, 0x22, 0x37, 0xdd, 0x7e, 0x3, 0xfd, 0x96, 0x3, 
-0x20, 0x17, 0xdd, 0x7e, 0x2, 0xfd, 0x96, 0x2, 0x20, 0xf, 0xdd, 0x7e, 0x1, 0xfd, 0x96, 0x1, 
-0x20, 0x7, 0xdd, 0x7e, 0x0, 0xfd, 0x96, 0x0, 0xc8, 0x9f, 0xfd, 0xae, 0x3, 0x87, 0x9f, 0xd8, 
-0x3c, 0xc9, 0xdd, 0x7e, 0x3, 0x18, 0xf6, 0xe5, 0xdd, 0xe1, 0xdd, 0x7e, 0x4, 0xb7, 0xc8, 0x18, 
-0xf1, 0xe5, 0xdd, 0xe1, 0xdd, 0x7e, 0x3, 0xee, 0x80, 0xdd, 0x77, 0x3, 0xc9, 0xfe, 0x21, 0x38, 
-0x2, 0x3e, 0x21, 0x5e, 0x23, 0x56, 0x23, 0x4e, 0x23, 0x66, 0x69, 0xeb, 0xcb, 0xfa, 0x1, 0x0, 
-0x0, 0x18, 0xb, 0x4f, 0x78, 0xb5, 0x47, 0x79, 0x4d, 0x6c, 0x63, 0x5a, 0x16, 0x0, 0xd6, 0x8, 
-0x30, 0xf1, 0xc6, 0x8, 0xc8, 0xcb, 0x3a, 0xcb, 0x1b, 0xcb, 0x1c, 0xcb, 0x1d, 0xcb, 0x19, 0x3d, 
-0x20, 0xf3, 0xc9, 0x20, 0x17, 0x57, 0x7b, 0xb4, 0xb5, 0xb1, 0xc8, 0x7a, 0xd6, 0x8, 0x38, 0x1a, 
-0xc8, 0x53, 0x5c, 0x65, 0x69, 0xe, 0x0, 0x14, 0x15, 0x28, 0xf1, 0xf8, 0x3d, 0xc8, 0xcb, 0x21, 
-0xed, 0x6a, 0xcb, 0x13, 0xcb, 0x12, 0xf2, 0x8c, 0x37, 0xc9, 0xaf, 0xc9, 0xe5, 0xdd, 0xe1, 0xdd, 
-0x70, 0x4, 0x47, 0x5e, 0x23, 0x56, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0xeb, 0xdd, 0x7e, 0x4, 0x15, 
-0x14, 0xf4, 0x73, 0x37, 0xdd, 0x77, 0x4, 0xcb, 0x21, 0x30, 0x12, 0x2c, 0x20, 0xf, 0x24, 0x20, 
-0xc, 0x13, 0x7a, 0xb3, 0x20, 0x7, 0xdd, 0x34, 0x4, 0x28, 0x1f, 0x16, 0x80, 0x78, 0xf6, 0x7f, 
-0xa2, 0xdd, 0x77, 0x3, 0xdd, 0x73, 0x2, 0xdd, 0x74, 0x1, 0xdd, 0x75, 0x0, 0xdd, 0xe5, 0xe1, 
-0x37, 0xc9, 0xaf, 0xdd, 0x77, 0x4, 0x18, 0xf5, 0x6, 0x0, 0xdd, 0xe5, 0xe1, 0x78, 0xf6, 0x7f, 
-0xdd, 0x77, 0x3, 0xf6, 0xff, 0xdd, 0x77, 0x4, 0x77, 0xdd, 0x77, 0x1, 0xdd, 0x77, 0x2, 0xc9, 
-0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0xff, 
-0xc, 0x18, 0x30, 0x7e, 0xc, 0x18, 0x30, 0x0, 0xff, 0xc3, 0xe7, 0xdb, 0xdb, 0xe7, 0xc3, 0xff, 
-0x0, 0x1, 0x3, 0x6, 0xcc, 0x78, 0x30, 0x0, 0x3c, 0x66, 0xc3, 0xc3, 0xff, 0x24, 0xe7, 0x0, 
-0x0, 0x0, 0x30, 0x60, 0xff, 0x60, 0x30, 0x0, 0x0, 0x0, 0xc, 0x6, 0xff, 0x6, 0xc, 0x0, 
-0x18, 0x18, 0x18, 0x18, 0xdb, 0x7e, 0x3c, 0x18, 0x18, 0x3c, 0x7e, 0xdb, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x5a, 0x3c, 0x99, 0xdb, 0x7e, 0x3c, 0x18, 0x0, 0x3, 0x33, 0x63, 0xfe, 0x60, 0x30, 0x0, 
-0x3c, 0x66, 0xff, 0xdb, 0xdb, 0xff, 0x66, 0x3c, 0x3c, 0x66, 0xc3, 0xdb, 0xdb, 0xc3, 0x66, 0x3c, 
-0xff, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0x3c, 0x7e, 0xdb, 0xdb, 0xdf, 0xc3, 0x66, 0x3c, 
-0x3c, 0x66, 0xc3, 0xdf, 0xdb, 0xdb, 0x7e, 0x3c, 0x3c, 0x66, 0xc3, 0xfb, 0xdb, 0xdb, 0x7e, 0x3c, 
-0x3c, 0x7e, 0xdb, 0xdb, 0xfb, 0xc3, 0x66, 0x3c, 0x0, 0x1, 0x33, 0x1e, 0xce, 0x7b, 0x31, 0x0, 
-0x7e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xe7, 0x3, 0x3, 0x3, 0xff, 0x3, 0x3, 0x3, 0x0, 
-0xff, 0x66, 0x3c, 0x18, 0x18, 0x3c, 0x66, 0xff, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x3c, 0x18, 0x18, 
-0x3c, 0x66, 0x66, 0x30, 0x18, 0x0, 0x18, 0x0, 0x3c, 0x66, 0xc3, 0xff, 0xc3, 0xc3, 0x66, 0x3c, 
-0xff, 0xdb, 0xdb, 0xdb, 0xfb, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xc3, 0xfb, 0xdb, 0xdb, 0xdb, 0xff, 
-0xff, 0xc3, 0xc3, 0xdf, 0xdb, 0xdb, 0xdb, 0xff, 0xff, 0xdb, 0xdb, 0xdb, 0xdf, 0xc3, 0xc3, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0, 0x18, 0x0, 
-0x6c, 0x6c, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x6c, 0xfe, 0x6c, 0xfe, 0x6c, 0x6c, 0x0, 
-0x18, 0x3e, 0x58, 0x3c, 0x1a, 0x7c, 0x18, 0x0, 0x0, 0xc6, 0xcc, 0x18, 0x30, 0x66, 0xc6, 0x0, 
-0x38, 0x6c, 0x38, 0x76, 0xdc, 0xcc, 0x76, 0x0, 0x18, 0x18, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xc, 0x18, 0x30, 0x30, 0x30, 0x18, 0xc, 0x0, 0x30, 0x18, 0xc, 0xc, 0xc, 0x18, 0x30, 0x0, 
-0x0, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x0, 0x0, 0x0, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x30, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 0x6, 0xc, 0x18, 0x30, 0x60, 0xc0, 0x80, 0x0, 
-0x7c, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0x7c, 0x0, 0x18, 0x38, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x0, 
-0x3c, 0x66, 0x6, 0x3c, 0x60, 0x66, 0x7e, 0x0, 0x3c, 0x66, 0x6, 0x1c, 0x6, 0x66, 0x3c, 0x0, 
-0x1c, 0x3c, 0x6c, 0xcc, 0xfe, 0xc, 0x1e, 0x0, 0x7e, 0x62, 0x60, 0x7c, 0x6, 0x66, 0x3c, 0x0, 
-0x3c, 0x66, 0x60, 0x7c, 0x66, 0x66, 0x3c, 0x0, 0x7e, 0x66, 0x6, 0xc, 0x18, 0x18, 0x18, 0x0, 
-0x3c, 0x66, 0x66, 0x3c, 0x66, 0x66, 0x3c, 0x0, 0x3c, 0x66, 0x66, 0x3e, 0x6, 0x66, 0x3c, 0x0, 
-0x0, 0x0, 0x18, 0x18, 0x0, 0x18, 0x18, 0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 0x18, 0x18, 0x30, 
-0xc, 0x18, 0x30, 0x60, 0x30, 0x18, 0xc, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x7e, 0x0, 0x0, 
-0x60, 0x30, 0x18, 0xc, 0x18, 0x30, 0x60, 0x0, 0x3c, 0x66, 0x66, 0xc, 0x18, 0x0, 0x18, 0x0, 
-0x7c, 0xc6, 0xde, 0xde, 0xde, 0xc0, 0x7c, 0x0, 0x18, 0x3c, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x0, 
-0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x0, 0x3c, 0x66, 0xc0, 0xc0, 0xc0, 0x66, 0x3c, 0x0, 
-0xf8, 0x6c, 0x66, 0x66, 0x66, 0x6c, 0xf8, 0x0, 0xfe, 0x62, 0x68, 0x78, 0x68, 0x62, 0xfe, 0x0, 
-0xfe, 0x62, 0x68, 0x78, 0x68, 0x60, 0xf0, 0x0, 0x3c, 0x66, 0xc0, 0xc0, 0xce, 0x66, 0x3e, 0x0, 
-0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x0, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x0, 
-0x1e, 0xc, 0xc, 0xc, 0xcc, 0xcc, 0x78, 0x0, 0xe6, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0xe6, 0x0, 
-0xf0, 0x60, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x0, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0x0, 
-0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0xc6, 0x0, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x0, 
-0xfc, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x0, 0x38, 0x6c, 0xc6, 0xc6, 0xda, 0xcc, 0x76, 0x0, 
-0xfc, 0x66, 0x66, 0x7c, 0x6c, 0x66, 0xe6, 0x0, 0x3c, 0x66, 0x60, 0x3c, 0x6, 0x66, 0x3c, 0x0, 
-0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x0, 
-0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x0, 0xc6, 0xc6, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x0, 
-0xc6, 0x6c, 0x38, 0x38, 0x6c, 0xc6, 0xc6, 0x0, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x3c, 0x0, 
-0xfe, 0xc6, 0x8c, 0x18, 0x32, 0x66, 0xfe, 0x0, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x0, 
-0xc0, 0x60, 0x30, 0x18, 0xc, 0x6, 0x2, 0x0, 0x3c, 0xc, 0xc, 0xc, 0xc, 0xc, 0x3c, 0x0, 
-0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x30, 0x18, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0xc, 0x7c, 0xcc, 0x76, 0x0, 
-0xe0, 0x60, 0x7c, 0x66, 0x66, 0x66, 0xdc, 0x0, 0x0, 0x0, 0x3c, 0x66, 0x60, 0x66, 0x3c, 0x0, 
-0x1c, 0xc, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x0, 0x0, 0x0, 0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x0, 
-0x1c, 0x36, 0x30, 0x78, 0x30, 0x30, 0x78, 0x0, 0x0, 0x0, 0x3e, 0x66, 0x66, 0x3e, 0x6, 0x7c, 
-0xe0, 0x60, 0x6c, 0x76, 0x66, 0x66, 0xe6, 0x0, 0x18, 0x0, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x0, 
-0x6, 0x0, 0xe, 0x6, 0x6, 0x66, 0x66, 0x3c, 0xe0, 0x60, 0x66, 0x6c, 0x78, 0x6c, 0xe6, 0x0, 
-0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0, 0x0, 0x0, 0x6c, 0xfe, 0xd6, 0xd6, 0xc6, 0x0, 
-0x0, 0x0, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x0, 0x0, 0x0, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x0, 
-0x0, 0x0, 0xdc, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x0, 0x0, 0x76, 0xcc, 0xcc, 0x7c, 0xc, 0x1e, 
-0x0, 0x0, 0xdc, 0x76, 0x60, 0x60, 0xf0, 0x0, 0x0, 0x0, 0x3c, 0x60, 0x3c, 0x6, 0x7c, 0x0, 
-0x30, 0x30, 0x7c, 0x30, 0x30, 0x36, 0x1c, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x0, 
-0x0, 0x0, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x0, 0x0, 0x0, 0xc6, 0xd6, 0xd6, 0xfe, 0x6c, 0x0, 
-0x0, 0x0, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x3e, 0x6, 0x7c, 
-0x0, 0x0, 0x7e, 0x4c, 0x18, 0x32, 0x7e, 0x0, 0xe, 0x18, 0x18, 0x70, 0x18, 0x18, 0xe, 0x0, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0, 0x70, 0x18, 0x18, 0xe, 0x18, 0x18, 0x70, 0x0, 
-0x76, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x33, 0xcc, 0x33, 0xcc, 0x33, 0xcc, 0x33, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xf0, 0xf0, 0xf0, 0x0, 0x0, 0x0, 0x0, 
-0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 
-0xf, 0xf, 0xf, 0xf, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 
-0x0, 0x0, 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, 0xf0, 0xf0, 0xf0, 0xf0, 0xf, 0xf, 0xf, 0xf, 
-0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf, 0xf, 0xf, 0xf, 
-0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 
-0xf, 0xf, 0xf, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x1f, 0x1f, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0x1f, 0xf, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x0, 0x0, 0x0, 0xf, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x18, 0x18, 0x18, 
-0x0, 0x0, 0x0, 0xf8, 0xf8, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0xf8, 0xf0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0xff, 0xff, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0xf0, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0xf8, 0x18, 0x18, 0x18, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 
-0x10, 0x38, 0x6c, 0xc6, 0x0, 0x0, 0x0, 0x0, 0xc, 0x18, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x66, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x66, 0x60, 0xf8, 0x60, 0x66, 0xfe, 0x0, 
-0x38, 0x44, 0xba, 0xa2, 0xba, 0x44, 0x38, 0x0, 0x7e, 0xf4, 0xf4, 0x74, 0x34, 0x34, 0x34, 0x0, 
-0x1e, 0x30, 0x38, 0x6c, 0x38, 0x18, 0xf0, 0x0, 0x18, 0x18, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x40, 0xc0, 0x44, 0x4c, 0x54, 0x1e, 0x4, 0x0, 0x40, 0xc0, 0x4c, 0x52, 0x44, 0x8, 0x1e, 0x0, 
-0xe0, 0x10, 0x62, 0x16, 0xea, 0xf, 0x2, 0x0, 0x0, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x7e, 0x0, 
-0x18, 0x18, 0x0, 0x7e, 0x0, 0x18, 0x18, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x6, 0x6, 0x0, 0x0, 
-0x18, 0x0, 0x18, 0x30, 0x66, 0x66, 0x3c, 0x0, 0x18, 0x0, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0, 
-0x0, 0x0, 0x73, 0xde, 0xcc, 0xde, 0x73, 0x0, 0x7c, 0xc6, 0xc6, 0xfc, 0xc6, 0xc6, 0xf8, 0xc0, 
-0x0, 0x66, 0x66, 0x3c, 0x66, 0x66, 0x3c, 0x0, 0x3c, 0x60, 0x60, 0x3c, 0x66, 0x66, 0x3c, 0x0, 
-0x0, 0x0, 0x1e, 0x30, 0x7c, 0x30, 0x1e, 0x0, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x6c, 0x38, 0x0, 
-0x0, 0xc0, 0x60, 0x30, 0x38, 0x6c, 0xc6, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 
-0x0, 0x0, 0x0, 0xfe, 0x6c, 0x6c, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xd8, 0xd8, 0x70, 0x0, 
-0x3, 0x6, 0xc, 0x3c, 0x66, 0x3c, 0x60, 0xc0, 0x3, 0x6, 0xc, 0x66, 0x66, 0x3c, 0x60, 0xc0, 
-0x0, 0xe6, 0x3c, 0x18, 0x38, 0x6c, 0xc7, 0x0, 0x0, 0x0, 0x66, 0xc3, 0xdb, 0xdb, 0x7e, 0x0, 
-0xfe, 0xc6, 0x60, 0x30, 0x60, 0xc6, 0xfe, 0x0, 0x0, 0x7c, 0xc6, 0xc6, 0xc6, 0x6c, 0xee, 0x0, 
-0x18, 0x30, 0x60, 0xc0, 0x80, 0x0, 0x0, 0x0, 0x18, 0xc, 0x6, 0x3, 0x1, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x1, 0x3, 0x6, 0xc, 0x18, 0x0, 0x0, 0x0, 0x80, 0xc0, 0x60, 0x30, 0x18, 
-0x18, 0x3c, 0x66, 0xc3, 0x81, 0x0, 0x0, 0x0, 0x18, 0xc, 0x6, 0x3, 0x3, 0x6, 0xc, 0x18, 
-0x0, 0x0, 0x0, 0x81, 0xc3, 0x66, 0x3c, 0x18, 0x18, 0x30, 0x60, 0xc0, 0xc0, 0x60, 0x30, 0x18, 
-0x18, 0x30, 0x60, 0xc1, 0x83, 0x6, 0xc, 0x18, 0x18, 0xc, 0x6, 0x83, 0xc1, 0x60, 0x30, 0x18, 
-0x18, 0x3c, 0x66, 0xc3, 0xc3, 0x66, 0x3c, 0x18, 0xc3, 0xe7, 0x7e, 0x3c, 0x3c, 0x7e, 0xe7, 0xc3, 
-0x3, 0x7, 0xe, 0x1c, 0x38, 0x70, 0xe0, 0xc0, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0xe, 0x7, 0x3, 
-0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc, 0x33, 0x33, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 
-0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 0xff, 0x7f, 0x3f, 0x1f, 0xf, 0x7, 0x3, 0x1, 
-0x1, 0x3, 0x7, 0xf, 0x1f, 0x3f, 0x7f, 0xff, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 
-0xaa, 0x55, 0xaa, 0x55, 0x0, 0x0, 0x0, 0x0, 0xa, 0x5, 0xa, 0x5, 0xa, 0x5, 0xa, 0x5, 
-0x0, 0x0, 0x0, 0x0, 0xaa, 0x55, 0xaa, 0x55, 0xa0, 0x50, 0xa0, 0x50, 0xa0, 0x50, 0xa0, 0x50, 
-0xaa, 0x54, 0xa8, 0x50, 0xa0, 0x40, 0x80, 0x0, 0xaa, 0x55, 0x2a, 0x15, 0xa, 0x5, 0x2, 0x1, 
-0x1, 0x2, 0x5, 0xa, 0x15, 0x2a, 0x55, 0xaa, 0x0, 0x80, 0x40, 0xa0, 0x50, 0xa8, 0x54, 0xaa, 
-0x7e, 0xff, 0x99, 0xff, 0xbd, 0xc3, 0xff, 0x7e, 0x7e, 0xff, 0x99, 0xff, 0xc3, 0xbd, 0xff, 0x7e, 
-0x38, 0x38, 0xfe, 0xfe, 0xfe, 0x10, 0x38, 0x0, 0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x38, 0x10, 0x0, 
-0x6c, 0xfe, 0xfe, 0xfe, 0x7c, 0x38, 0x10, 0x0, 0x10, 0x38, 0x7c, 0xfe, 0xfe, 0x10, 0x38, 0x0, 
-0x0, 0x3c, 0x66, 0xc3, 0xc3, 0x66, 0x3c, 0x0, 0x0, 0x3c, 0x7e, 0xff, 0xff, 0x7e, 0x3c, 0x0, 
-0x0, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x7e, 0x0, 0x0, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x0, 
-0xf, 0x7, 0xd, 0x78, 0xcc, 0xcc, 0xcc, 0x78, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 
-0xc, 0xc, 0xc, 0xc, 0xc, 0x3c, 0x7c, 0x38, 0x18, 0x1c, 0x1e, 0x1b, 0x18, 0x78, 0xf8, 0x70, 
-0x99, 0x5a, 0x24, 0xc3, 0xc3, 0x24, 0x5a, 0x99, 0x10, 0x38, 0x38, 0x38, 0x38, 0x38, 0x7c, 0xd6, 
-0x18, 0x3c, 0x7e, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x7e, 0x3c, 0x18, 
-0x10, 0x30, 0x70, 0xff, 0xff, 0x70, 0x30, 0x10, 0x8, 0xc, 0xe, 0xff, 0xff, 0xe, 0xc, 0x8, 
-0x0, 0x0, 0x18, 0x3c, 0x7e, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x7e, 0x3c, 0x18, 0x0, 
-0x80, 0xe0, 0xf8, 0xfe, 0xf8, 0xe0, 0x80, 0x0, 0x2, 0xe, 0x3e, 0xfe, 0x3e, 0xe, 0x2, 0x0, 
-0x38, 0x38, 0x92, 0x7c, 0x10, 0x28, 0x28, 0x28, 0x38, 0x38, 0x10, 0xfe, 0x10, 0x28, 0x44, 0x82, 
-0x38, 0x38, 0x12, 0x7c, 0x90, 0x28, 0x24, 0x22, 0x38, 0x38, 0x90, 0x7c, 0x12, 0x28, 0x48, 0x88, 
-0x0, 0x3c, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x0, 0x3c, 0xff, 0xff, 0x18, 0xc, 0x18, 0x30, 0x18, 
-0x18, 0x3c, 0x7e, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x0, 0x24, 0x66, 0xff, 0x66, 0x24, 0x0, 0x0, 
-
-};
-unsigned char dump_cpc6128_amsdos[16384] = {
-0x1, 0x0, 0x5, 0x0, 0x72, 0xc0, 0xc3, 0xbc, 0xc1, 0xc3, 0xb2, 0xc1, 0xc3, 0xd1, 0xcc, 0xc3, 
-0xd5, 0xcc, 0xc3, 0xe4, 0xcc, 0xc3, 0xfd, 0xcc, 0xc3, 0x1, 0xcd, 0xc3, 0x18, 0xcd, 0xc3, 0xda, 
-0xcd, 0xc3, 0xdd, 0xcd, 0xc3, 0xe4, 0xcd, 0xc3, 0xfe, 0xcd, 0xc3, 0x2e, 0xd4, 0xc3, 0x8a, 0xd4, 
-0xc3, 0xc4, 0xd4, 0xc3, 0x72, 0xca, 0xc3, 0xd, 0xc6, 0xc3, 0x81, 0xc5, 0xc3, 0x66, 0xc6, 0xc3, 
-0x4e, 0xc6, 0xc3, 0x52, 0xc6, 0xc3, 0x63, 0xc7, 0xc3, 0x30, 0xc6, 0xc3, 0x3, 0xc6, 0xc3, 0x68, 
-0xc1, 0xc3, 0xdb, 0xc0, 0xc3, 0x89, 0xc3, 0xc3, 0x1, 0xc3, 0xc3, 0xdb, 0xc3, 0xc3, 0xf7, 0xc3, 
-0xc3, 0x35, 0xc4, 0xc3, 0x45, 0xc4, 0xc3, 0xe3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0x3a, 0xc4, 0xc3, 
-0x4b, 0xc4, 0x43, 0x50, 0x4d, 0x20, 0x52, 0x4f, 0xcd, 0x43, 0x50, 0xcd, 0x44, 0x49, 0x53, 0xc3, 
-0x44, 0x49, 0x53, 0x43, 0x2e, 0x49, 0xce, 0x44, 0x49, 0x53, 0x43, 0x2e, 0x4f, 0x55, 0xd4, 0x54, 
-0x41, 0x50, 0xc5, 0x54, 0x41, 0x50, 0x45, 0x2e, 0x49, 0xce, 0x54, 0x41, 0x50, 0x45, 0x2e, 0x4f, 
-0x55, 0xd4, 0xc1, 0xc2, 0x44, 0x52, 0x49, 0x56, 0xc5, 0x55, 0x53, 0x45, 0xd2, 0x44, 0x49, 0xd2, 
-0x45, 0x52, 0xc1, 0x52, 0x45, 0xce, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x0, 
-0x2a, 0x39, 0x0, 0x22, 0x3e, 0xad, 0x3e, 0xc3, 0x32, 0x33, 0xad, 0xaf, 0x32, 0x40, 0xad, 0xf3, 
-0xd9, 0xed, 0x43, 0x3c, 0xad, 0xd9, 0x21, 0xfa, 0xc0, 0x18, 0x1a, 0x21, 0x40, 0xad, 0xbe, 0xc8, 
-0xc5, 0x46, 0x77, 0xb7, 0x78, 0xc1, 0x28, 0xe7, 0xf3, 0x8, 0xd9, 0xed, 0x4b, 0x3c, 0xad, 0xb7, 
-0x8, 0xd9, 0x21, 0x32, 0xc1, 0x22, 0x34, 0xad, 0xfb, 0xc9, 0xf3, 0x8, 0xd9, 0x22, 0x38, 0xad, 
-0xe1, 0xed, 0x73, 0x36, 0xad, 0x31, 0x0, 0xc0, 0xd5, 0xc5, 0xf5, 0xfd, 0xe5, 0xed, 0x4b, 0x3c, 
-0xad, 0xb7, 0xcd, 0x4f, 0xc1, 0xf3, 0x8, 0xd9, 0xed, 0x43, 0x3c, 0xad, 0x21, 0x63, 0xc1, 0x22, 
-0x39, 0x0, 0xfd, 0xe1, 0xf1, 0xc1, 0xd1, 0x2a, 0x38, 0xad, 0x8, 0xd9, 0xed, 0x7b, 0x36, 0xad, 
-0xfb, 0xc9, 0xf3, 0x8, 0xd9, 0xe1, 0xed, 0x73, 0x36, 0xad, 0x31, 0x0, 0xc0, 0xcd, 0x4f, 0xc1, 
-0xf3, 0xd9, 0x21, 0x63, 0xc1, 0x22, 0x39, 0x0, 0xd9, 0xed, 0x7b, 0x36, 0xad, 0xfb, 0xc9, 0xed, 
-0x5b, 0x3e, 0xad, 0xed, 0x53, 0x39, 0x0, 0xfd, 0x21, 0x48, 0xac, 0x5e, 0x23, 0x56, 0xd5, 0x8, 
-0xd9, 0xfb, 0xc9, 0xcd, 0x33, 0xad, 0x38, 0x0, 0x22, 0x3a, 0xad, 0xe1, 0xe5, 0x23, 0x23, 0xe3, 
-0xe5, 0x2a, 0x3a, 0xad, 0xc3, 0x33, 0xad, 0x21, 0x63, 0xc1, 0x22, 0x39, 0x0, 0xeb, 0xe9, 0xc3, 
-0xb2, 0xc1, 0xc3, 0xbe, 0xc2, 0xc3, 0xe1, 0xc2, 0xc3, 0xc3, 0xc2, 0xc3, 0xc8, 0xc2, 0xc3, 0xd2, 
-0xc2, 0xc3, 0xd7, 0xc2, 0xc3, 0xdc, 0xc2, 0xc3, 0xe9, 0xc2, 0xc3, 0xf2, 0xc2, 0xc3, 0x24, 0xc5, 
-0xc3, 0x29, 0xc5, 0xc3, 0x1a, 0xc5, 0xc3, 0xf7, 0xc2, 0xc3, 0xfc, 0xc2, 0xc3, 0xcd, 0xc2, 0xc3, 
-0x5a, 0xc5, 0xcd, 0x12, 0xb9, 0x4f, 0x21, 0xdc, 0xc1, 0xc3, 0x16, 0xbd, 0x38, 0x6, 0xcd, 0x12, 
-0xb9, 0xb7, 0x28, 0x18, 0xfd, 0xe5, 0xd5, 0x11, 0x0, 0xfb, 0x19, 0xe5, 0x23, 0xe5, 0xfd, 0xe1, 
-0xcd, 0xdd, 0xc5, 0xcd, 0xa0, 0xcc, 0xe1, 0xd1, 0xfd, 0xe1, 0x37, 0xc9, 0x31, 0x0, 0xc0, 0xfd, 
-0x21, 0x48, 0xac, 0x11, 0x33, 0xad, 0x1, 0xa5, 0x0, 0xcd, 0xaf, 0xca, 0x21, 0x41, 0xad, 0x35, 
-0x3e, 0x81, 0x32, 0x3, 0x0, 0xaf, 0x32, 0x4, 0x0, 0x21, 0x33, 0xc0, 0x11, 0x80, 0xbe, 0x1, 
-0x3f, 0x0, 0xed, 0xb0, 0xcd, 0xc0, 0xc0, 0xcd, 0xdd, 0xc5, 0xe, 0x41, 0x11, 0x0, 0x0, 0x21, 
-0x0, 0x1, 0xcd, 0x66, 0xc6, 0xdc, 0xac, 0xc2, 0x30, 0xa, 0xeb, 0x1, 0x7f, 0xc1, 0x31, 0x33, 
-0xad, 0xc3, 0x77, 0xc1, 0x3e, 0xf, 0xcd, 0xb8, 0xca, 0x18, 0xdf, 0xcd, 0x6f, 0xc8, 0xcd, 0xb0, 
-0xc8, 0x1, 0x48, 0x1, 0x11, 0x0, 0x0, 0xe5, 0xcd, 0x99, 0xc2, 0xe1, 0xdc, 0xac, 0xc2, 0x30, 
-0x51, 0xe5, 0x23, 0x5e, 0x23, 0x56, 0x21, 0xa4, 0xfc, 0x19, 0xeb, 0xe1, 0x1, 0x0, 0x2, 0xed, 
-0xb0, 0xeb, 0x1, 0x49, 0xa, 0x11, 0x0, 0x0, 0xcd, 0x99, 0xc2, 0x30, 0x35, 0xeb, 0x21, 0x0, 
-0xea, 0x19, 0xe5, 0x21, 0x6, 0xf2, 0x19, 0x3e, 0xc3, 0x32, 0x5, 0x0, 0x22, 0x6, 0x0, 0x32, 
-0x0, 0x0, 0x21, 0x3, 0x0, 0x19, 0x22, 0x1, 0x0, 0x21, 0x7f, 0xc1, 0x1, 0x33, 0x0, 0xed, 
-0xb0, 0x21, 0x4, 0x0, 0x7e, 0xe6, 0xf, 0xfe, 0x2, 0x38, 0x2, 0x36, 0x0, 0x4e, 0xd1, 0xc3, 
-0x77, 0xc1, 0x3e, 0xe, 0xcd, 0xb8, 0xca, 0x18, 0x92, 0xcd, 0x66, 0xc6, 0xd0, 0x79, 0xc, 0xfe, 
-0x49, 0x38, 0x3, 0xe, 0x41, 0x14, 0x24, 0x24, 0x10, 0xef, 0x37, 0xc9, 0xe5, 0x1, 0x2, 0x0, 
-0x7e, 0xbe, 0x23, 0x37, 0x20, 0x6, 0x10, 0xf9, 0xd, 0x20, 0xf6, 0xb7, 0xe1, 0xc9, 0xcd, 0x33, 
-0xad, 0x2b, 0xc2, 0x21, 0x86, 0xc4, 0x18, 0x1c, 0x21, 0x8f, 0xc4, 0x18, 0x17, 0x21, 0x98, 0xc4, 
-0x18, 0x12, 0x21, 0xa1, 0xc4, 0x18, 0xd, 0x21, 0xaa, 0xc4, 0x18, 0x8, 0x21, 0xbc, 0xc4, 0x18, 
-0x3, 0x21, 0x7d, 0xc4, 0xcd, 0x33, 0xad, 0x6a, 0xc4, 0xcd, 0x68, 0xc1, 0x1f, 0xc5, 0x21, 0x89, 
-0xbe, 0xc9, 0xcd, 0x33, 0xad, 0xf0, 0xc4, 0xcd, 0x33, 0xad, 0x4c, 0xc5, 0xcd, 0x33, 0xad, 0x2e, 
-0xc5, 0x32, 0xc5, 0xad, 0x1, 0x81, 0x0, 0x11, 0x42, 0xad, 0xed, 0xb0, 0x21, 0x43, 0xad, 0x22, 
-0xc3, 0xad, 0xc9, 0x21, 0x41, 0xad, 0x7e, 0xb7, 0x28, 0x4, 0x35, 0xcc, 0x81, 0xbb, 0xcd, 0x9, 
-0xbb, 0xdc, 0xc, 0xbb, 0x9f, 0xc9, 0x21, 0x42, 0xad, 0x7e, 0xb7, 0x28, 0x1b, 0xcd, 0x9, 0xbb, 
-0x30, 0xc, 0x21, 0xc5, 0xad, 0x34, 0x35, 0xc0, 0x21, 0x42, 0xad, 0x36, 0x0, 0xc9, 0x35, 0x2a, 
-0xc3, 0xad, 0x7e, 0x23, 0x22, 0xc3, 0xad, 0xc9, 0x21, 0x41, 0xad, 0x7e, 0xb7, 0xc4, 0x81, 0xbb, 
-0x36, 0x0, 0xc3, 0x6, 0xbb, 0x3e, 0x1a, 0xc9, 0x3e, 0xff, 0xc9, 0x21, 0x41, 0xad, 0x7e, 0xb7, 
-0xcc, 0x84, 0xbb, 0x36, 0xff, 0x79, 0xcd, 0x5a, 0xbb, 0xfe, 0x20, 0xd0, 0xcd, 0x78, 0xbb, 0xcd, 
-0x87, 0xbb, 0xd8, 0xcd, 0x8a, 0xbb, 0xc3, 0x8d, 0xbb, 0xcd, 0x2e, 0xbd, 0x3f, 0x9f, 0xc9, 0x79, 
-0xcd, 0x2b, 0xbd, 0xd8, 0xcd, 0xd3, 0xc4, 0x18, 0xf6, 0xf3, 0x1, 0xdd, 0xfa, 0x11, 0xc6, 0xad, 
-0xcd, 0xbd, 0xc3, 0x3, 0x3, 0x13, 0xcd, 0xbd, 0xc3, 0x3e, 0x36, 0x1e, 0xdc, 0xcd, 0xae, 0xc3, 
-0x3e, 0x76, 0x1c, 0xcd, 0xae, 0xc3, 0x3e, 0xb6, 0x1c, 0xcd, 0xae, 0xc3, 0xfb, 0xc9, 0x1, 0xdf, 
-0xfb, 0xed, 0x79, 0x4b, 0x7e, 0x23, 0xed, 0x79, 0x7e, 0x23, 0xed, 0x79, 0xc9, 0x3e, 0x18, 0xed, 
-0x79, 0x3e, 0x4, 0xed, 0x79, 0x7e, 0x23, 0xed, 0x79, 0x3e, 0x5, 0xed, 0x79, 0x7e, 0x12, 0x23, 
-0xed, 0x79, 0x3e, 0x3, 0xed, 0x79, 0x7e, 0x23, 0xed, 0x79, 0xc9, 0x1, 0xdd, 0xfa, 0x21, 0xc6, 
-0xad, 0x18, 0x6, 0x1, 0xdf, 0xfa, 0x21, 0xc7, 0xad, 0xed, 0x78, 0xf, 0x9f, 0xd8, 0xcd, 0x24, 
-0xc4, 0xed, 0x78, 0xf, 0x9f, 0x18, 0x29, 0x1, 0xdd, 0xfa, 0x21, 0xc6, 0xad, 0x18, 0x6, 0x1, 
-0xdf, 0xfa, 0x21, 0xc7, 0xad, 0xed, 0x78, 0xf, 0x38, 0x12, 0xcd, 0x24, 0xc4, 0xcd, 0xc5, 0xc4, 
-0xfe, 0x1a, 0x28, 0xc, 0xed, 0x78, 0xf, 0x30, 0xf4, 0xcd, 0x20, 0xc4, 0xb, 0xed, 0x78, 0xc9, 
-0x1e, 0x0, 0x18, 0x2, 0x1e, 0x80, 0xf3, 0xf5, 0x3e, 0x5, 0xed, 0x79, 0x7e, 0xe6, 0x7f, 0xb3, 
-0xed, 0x79, 0xf1, 0xfb, 0xc9, 0x1, 0xdd, 0xfa, 0x18, 0x3, 0x1, 0xdf, 0xfa, 0xed, 0x78, 0xe6, 
-0x4, 0xc8, 0x37, 0x9f, 0xc9, 0x79, 0x1, 0xdd, 0xfa, 0x18, 0x4, 0x79, 0x1, 0xdf, 0xfa, 0xf5, 
-0xcd, 0xd3, 0xc4, 0xcd, 0x3d, 0xc4, 0x30, 0xf8, 0xf1, 0xb, 0xed, 0x79, 0xc9, 0x21, 0xb3, 0xc4, 
-0x18, 0x8, 0x21, 0xbc, 0xc4, 0x18, 0x3, 0x21, 0xa1, 0xc4, 0x46, 0x23, 0x3a, 0x3, 0x0, 0x7, 
-0x10, 0xfd, 0xe6, 0x6, 0x16, 0x0, 0x5f, 0x19, 0x5e, 0x23, 0x56, 0xeb, 0xe9, 0x1, 0xa7, 0xbe, 
-0x13, 0xc3, 0x5d, 0xc4, 0xb3, 0xbe, 0x1, 0xaa, 0xbe, 0x26, 0xc3, 0x62, 0xc4, 0xb6, 0xbe, 0x1, 
-0xb0, 0xbe, 0x5b, 0xc3, 0x67, 0xc4, 0xbc, 0xbe, 0x3, 0xad, 0xbe, 0x58, 0xc3, 0x79, 0xc3, 0xb9, 
-0xbe, 0x3, 0xb0, 0xbe, 0x5b, 0xc3, 0x7f, 0xc3, 0xbc, 0xbe, 0x5, 0xb0, 0xbe, 0x5a, 0xc3, 0xbc, 
-0xbe, 0x5b, 0xc3, 0x7, 0xa7, 0xbe, 0x58, 0xc3, 0xb3, 0xbe, 0x13, 0xc3, 0x7, 0xaa, 0xbe, 0x55, 
-0xc3, 0xb6, 0xbe, 0x26, 0xc3, 0xcd, 0xd3, 0xc4, 0xfe, 0x13, 0xc0, 0xe5, 0xc5, 0xcd, 0x26, 0xc3, 
-0xc1, 0xe1, 0xc9, 0xe5, 0xd5, 0xc5, 0xcd, 0x13, 0xc3, 0xb7, 0x28, 0xf, 0xcd, 0x26, 0xc3, 0xfe, 
-0x3, 0x20, 0x8, 0x3e, 0xd, 0xcd, 0xeb, 0xca, 0xc3, 0x2b, 0xc2, 0xc1, 0xd1, 0xe1, 0xc9, 0xff, 
-0x79, 0xfe, 0x2, 0x21, 0x0, 0x0, 0xd0, 0x7b, 0x1f, 0x38, 0xf, 0x59, 0x3e, 0x18, 0xcd, 0x5c, 
-0xca, 0xb7, 0x20, 0x6, 0xe5, 0xcd, 0x6c, 0xc5, 0xe1, 0xd0, 0x79, 0x32, 0x53, 0xbe, 0x21, 0x10, 
-0x2, 0xb7, 0x28, 0x3, 0x21, 0x20, 0x2, 0xc3, 0x9f, 0xca, 0xed, 0x43, 0x60, 0xbe, 0xc9, 0xcd, 
-0x6f, 0xc8, 0xe, 0x0, 0x79, 0x32, 0x54, 0xbe, 0xc9, 0x79, 0x32, 0x55, 0xbe, 0xc9, 0xc5, 0x79, 
-0xfe, 0x2, 0xcc, 0xeb, 0xc7, 0xcd, 0x0, 0xc8, 0xdc, 0x1b, 0xc8, 0xcd, 0x32, 0xc8, 0xc1, 0xd0, 
-0xcd, 0xb6, 0xc8, 0xd, 0x37, 0xcc, 0x6f, 0xc8, 0xd0, 0x3e, 0x0, 0xc9, 0xaf, 0x32, 0x59, 0xbe, 
-0xcd, 0x32, 0xc8, 0xcd, 0xc7, 0xc8, 0xd0, 0x3e, 0x0, 0xc9, 0x60, 0x69, 0xc9, 0x1, 0x7e, 0xfb, 
-0x3e, 0x4a, 0xcd, 0x5c, 0xc9, 0x7b, 0xcd, 0x5c, 0xc9, 0xc3, 0xf9, 0xc8, 0xcd, 0x76, 0xc9, 0x3e, 
-0x16, 0xcd, 0x5c, 0xca, 0x57, 0xe, 0x10, 0x21, 0x5d, 0xc5, 0xcd, 0xff, 0xc6, 0xd0, 0x3a, 0x51, 
-0xbe, 0xf5, 0xaf, 0xcd, 0x63, 0xca, 0xe5, 0xeb, 0x21, 0x43, 0xca, 0x1, 0x16, 0x0, 0xed, 0xb0, 
-0xe1, 0xf1, 0xe6, 0xc0, 0xfe, 0x40, 0x37, 0xc8, 0x11, 0xca, 0xc5, 0xfe, 0xc0, 0x28, 0x3, 0x11, 
-0xc0, 0xc5, 0x1a, 0x13, 0x77, 0x23, 0x1a, 0x13, 0x77, 0x1, 0x4, 0x0, 0x9, 0x1a, 0x13, 0x77, 
-0x23, 0x1a, 0x13, 0x77, 0x1, 0x7, 0x0, 0x9, 0xeb, 0x1, 0x6, 0x0, 0xed, 0xb0, 0x37, 0xc9, 
-0x20, 0x0, 0x9b, 0x0, 0x1, 0x0, 0x1, 0x8, 0x2a, 0x50, 0x24, 0x0, 0xb3, 0x0, 0x0, 0x0, 
-0xc1, 0x9, 0x2a, 0x52, 0x32, 0x0, 0xfa, 0x0, 0xaf, 0xf, 0xc, 0x1, 0x3, 0x11, 0x40, 0xbe, 
-0x1, 0x3d, 0x0, 0xcd, 0xaf, 0xca, 0xcd, 0xf4, 0xc9, 0xcd, 0xe8, 0xc9, 0x21, 0xd4, 0xc5, 0xcd, 
-0xd, 0xc6, 0xcd, 0x12, 0xb9, 0x4f, 0x6, 0x80, 0x21, 0x6d, 0xbe, 0x11, 0xd6, 0xc9, 0xcd, 0xef, 
-0xbc, 0x3e, 0x10, 0xe5, 0x2a, 0x66, 0xbe, 0x32, 0x66, 0xbe, 0x7d, 0xe1, 0xc9, 0x11, 0x44, 0xbe, 
-0x1, 0x7, 0x0, 0xed, 0xb0, 0x1, 0x7e, 0xfb, 0x3e, 0x3, 0xcd, 0x5c, 0xc9, 0x3a, 0x4a, 0xbe, 
-0x3d, 0x7, 0x7, 0x7, 0x2f, 0xe6, 0xf0, 0xb6, 0xcd, 0x5c, 0xc9, 0x23, 0x7e, 0xc3, 0x5c, 0xc9, 
-0xcd, 0x38, 0xc6, 0xd0, 0x3a, 0x4c, 0xbe, 0xc9, 0xcd, 0x76, 0xc9, 0xf5, 0xcd, 0x47, 0xc9, 0x1, 
-0x7e, 0xfb, 0x3e, 0x4, 0xcd, 0x5c, 0xc9, 0xf1, 0xcd, 0x5c, 0xc9, 0xc3, 0x1c, 0xc9, 0x3e, 0x45, 
-0x18, 0x2, 0x3e, 0x4d, 0xcd, 0x76, 0xc9, 0x6, 0x11, 0xcd, 0x6d, 0xc6, 0x3a, 0x48, 0xbe, 0x3d, 
-0x3, 0x3, 0x3, 0x20, 0xfa, 0xc9, 0xcd, 0x76, 0xc9, 0x3e, 0x66, 0x6, 0x10, 0x22, 0x62, 0xbe, 
-0x67, 0x69, 0x22, 0x74, 0xbe, 0x48, 0x21, 0x7c, 0xc6, 0xc3, 0xff, 0xc6, 0x2a, 0x74, 0xbe, 0x1, 
-0x7e, 0xfb, 0x7c, 0xcd, 0x5c, 0xc9, 0x7b, 0xcd, 0x5c, 0xc9, 0x7c, 0xfe, 0x4d, 0x20, 0x16, 0x3e, 
-0x14, 0xcd, 0x59, 0xc9, 0x3e, 0x10, 0xcd, 0x59, 0xc9, 0x3e, 0x12, 0xcd, 0x59, 0xc9, 0x3e, 0x13, 
-0xcd, 0x5c, 0xca, 0x18, 0x1c, 0x7a, 0xcd, 0x5c, 0xc9, 0xaf, 0xcd, 0x5c, 0xc9, 0x7d, 0xcd, 0x5c, 
-0xc9, 0x3e, 0x14, 0xcd, 0x59, 0xc9, 0x7d, 0xcd, 0x5c, 0xc9, 0x3e, 0x11, 0xcd, 0x59, 0xc9, 0x3e, 
-0xff, 0xcd, 0xd1, 0xc6, 0xfb, 0xcd, 0x7, 0xc9, 0xd8, 0xc0, 0x3a, 0x4d, 0xbe, 0x87, 0xd8, 0xaf, 
-0xc9, 0xf3, 0xcd, 0x5c, 0xc9, 0x7c, 0x2a, 0x62, 0xbe, 0xfe, 0x66, 0x20, 0x18, 0x18, 0x6, 0xc, 
-0xed, 0x78, 0x77, 0xd, 0x23, 0xed, 0x78, 0xf2, 0xe5, 0xc6, 0xe6, 0x20, 0x20, 0xf1, 0xc9, 0xc, 
-0x7e, 0xed, 0x79, 0xd, 0x23, 0xed, 0x78, 0xf2, 0xf5, 0xc6, 0xe6, 0x20, 0x20, 0xf1, 0xc9, 0x3a, 
-0x66, 0xbe, 0x47, 0xcd, 0x2b, 0xc7, 0xd8, 0x28, 0x19, 0x78, 0xe6, 0x4, 0x28, 0x9, 0xd5, 0x16, 
-0x27, 0xcd, 0x66, 0xc7, 0xd1, 0x18, 0xec, 0xe5, 0x3e, 0x17, 0xcd, 0x63, 0xca, 0x36, 0x0, 0xe1, 
-0x18, 0xe1, 0x79, 0xc5, 0xcd, 0x7a, 0xca, 0xc1, 0x20, 0xd5, 0xc9, 0xcd, 0x54, 0xc7, 0xd8, 0xc8, 
-0xcd, 0x47, 0xc9, 0xcd, 0x54, 0xc7, 0xd8, 0xc8, 0x7a, 0xfe, 0x27, 0x5, 0x30, 0xa, 0x4, 0x14, 
-0xcd, 0x66, 0xc7, 0x15, 0xcd, 0x54, 0xc7, 0xd8, 0xc8, 0x7a, 0xb7, 0x20, 0x2, 0x5, 0xc9, 0x15, 
-0xcd, 0x66, 0xc7, 0x14, 0xcd, 0x66, 0xc7, 0xe5, 0xc5, 0xcd, 0x1e, 0x0, 0xc1, 0xe1, 0xd8, 0x20, 
-0xf3, 0x5, 0xc9, 0xcd, 0x76, 0xc9, 0xe5, 0xd5, 0xc5, 0x3a, 0x66, 0xbe, 0x47, 0x3e, 0x17, 0xcd, 
-0x63, 0xca, 0x7e, 0xb7, 0x20, 0x1f, 0xc5, 0x1, 0x7e, 0xfb, 0x3e, 0x7, 0xcd, 0x5c, 0xc9, 0x7b, 
-0xcd, 0x5c, 0xc9, 0x3e, 0x28, 0xcd, 0xc7, 0xc7, 0x30, 0x2a, 0x3e, 0x16, 0xcd, 0x63, 0xca, 0x36, 
-0x0, 0x23, 0x36, 0xff, 0xc1, 0x2b, 0x7e, 0x92, 0x28, 0x28, 0xc5, 0x1, 0x7e, 0xfb, 0x3e, 0xf, 
-0xcd, 0x5c, 0xc9, 0x7b, 0xcd, 0x5c, 0xc9, 0x7a, 0xcd, 0x5c, 0xc9, 0x96, 0x30, 0x2, 0x7e, 0x92, 
-0x72, 0xcd, 0xc7, 0xc7, 0xc1, 0x38, 0xb, 0x20, 0xbd, 0x5, 0xca, 0xad, 0xc9, 0xcd, 0x47, 0xc9, 
-0x18, 0xb4, 0xc1, 0xd1, 0xe1, 0x37, 0xc9, 0xf5, 0x3a, 0x4a, 0xbe, 0xcd, 0xe0, 0xc7, 0xf1, 0x3d, 
-0x20, 0xf5, 0x3a, 0x49, 0xbe, 0xcd, 0xe0, 0xc7, 0x3e, 0x8, 0xcd, 0x5c, 0xc9, 0xc3, 0xf9, 0xc8, 
-0xf5, 0x3e, 0xf6, 0x3d, 0x20, 0xfd, 0xf1, 0x3d, 0x20, 0xf6, 0xc9, 0x21, 0x53, 0xbe, 0x5e, 0x3e, 
-0x3, 0xcd, 0x5c, 0xca, 0x3c, 0x11, 0x59, 0xbe, 0x12, 0x13, 0x1, 0x3, 0x0, 0xed, 0xb0, 0xc9, 
-0x11, 0x59, 0xbe, 0x1a, 0xb7, 0xc8, 0x13, 0x21, 0x53, 0xbe, 0x6, 0x3, 0x1a, 0xae, 0x20, 0x6, 
-0x13, 0x23, 0x10, 0xf8, 0x37, 0xc9, 0xaf, 0x32, 0x59, 0xbe, 0xc9, 0xf5, 0x21, 0x59, 0xbe, 0x35, 
-0x23, 0x5e, 0x23, 0x23, 0x34, 0xaf, 0xcd, 0x5c, 0xca, 0xbe, 0x20, 0x4, 0x36, 0x0, 0x2b, 0x34, 
-0xf1, 0xc9, 0xf5, 0xcd, 0x54, 0xc8, 0x38, 0x19, 0xcd, 0x6f, 0xc8, 0xc1, 0xd0, 0xc5, 0xcd, 0x80, 
-0xc8, 0xf1, 0x38, 0x6, 0xcd, 0xa2, 0xc8, 0xcd, 0x66, 0xc6, 0xf5, 0x9f, 0x32, 0x5e, 0xbe, 0xf1, 
-0xc9, 0xf1, 0x37, 0xc9, 0x3a, 0x5e, 0xbe, 0xb7, 0xc8, 0x1, 0x53, 0xbe, 0x21, 0x56, 0xbe, 0x5e, 
-0xa, 0xae, 0xc0, 0x3, 0x23, 0xa, 0xae, 0xc0, 0xcd, 0x92, 0xc8, 0xae, 0xc0, 0x37, 0xc9, 0x21, 
-0x5e, 0xbe, 0x36, 0x0, 0x2b, 0x7e, 0xb7, 0x37, 0xc8, 0x34, 0xcd, 0xa2, 0xc8, 0xc3, 0x4e, 0xc6, 
-0x21, 0x56, 0xbe, 0x1, 0x53, 0xbe, 0xa, 0x77, 0x5f, 0x23, 0x3, 0xa, 0x77, 0xcd, 0x92, 0xc8, 
-0x77, 0xc9, 0x3, 0x23, 0x3e, 0x15, 0xcd, 0x5c, 0xca, 0x57, 0xa, 0xcb, 0x3a, 0xd8, 0xcb, 0x3f, 
-0x18, 0xf9, 0xed, 0x5b, 0x56, 0xbe, 0x3e, 0xf, 0xcd, 0x5c, 0xca, 0x21, 0x58, 0xbe, 0x86, 0x4f, 
-0x21, 0xb0, 0x2, 0xc3, 0x9f, 0xca, 0xe5, 0xd5, 0xc5, 0xf5, 0x3e, 0xff, 0x32, 0x5d, 0xbe, 0xcd, 
-0xd6, 0xc8, 0xcd, 0x1b, 0xb9, 0x18, 0xa, 0xe5, 0xd5, 0xc5, 0xf5, 0xcd, 0xd6, 0xc8, 0xeb, 0xed, 
-0xb0, 0xf1, 0xc1, 0xd1, 0xe1, 0xc9, 0x21, 0x53, 0xbe, 0x5e, 0x3e, 0x15, 0xcd, 0x5c, 0xca, 0x3d, 
-0x23, 0x23, 0xa6, 0x11, 0x80, 0x0, 0x21, 0x30, 0x2, 0x3c, 0x19, 0x3d, 0x20, 0xfc, 0xeb, 0xcd, 
-0x98, 0xca, 0x2a, 0x60, 0xbe, 0x1, 0x80, 0x0, 0xc9, 0xcd, 0x1c, 0xc9, 0xd8, 0x3a, 0x4c, 0xbe, 
-0xe6, 0x8, 0xc8, 0x3e, 0x13, 0x18, 0xd, 0xcd, 0xf9, 0xc8, 0xd8, 0xc0, 0x3a, 0x4d, 0xbe, 0xe6, 
-0x2, 0xc8, 0x3e, 0x12, 0xcd, 0x7a, 0xca, 0xd8, 0xca, 0xad, 0xc9, 0xc9, 0xe5, 0xd5, 0x16, 0x0, 
-0x21, 0x4c, 0xbe, 0xe5, 0xed, 0x78, 0xfe, 0xc0, 0x38, 0xfa, 0xc, 0xed, 0x78, 0xd, 0x77, 0x23, 
-0x14, 0x3e, 0x5, 0x3d, 0x20, 0xfd, 0xed, 0x78, 0xe6, 0x10, 0x20, 0xe8, 0xe1, 0x7e, 0xe6, 0xc0, 
-0x2b, 0x72, 0xd1, 0xe1, 0xc0, 0x37, 0xc9, 0xc5, 0x1, 0x7e, 0xfb, 0x3e, 0x8, 0xcd, 0x5c, 0xc9, 
-0xcd, 0x1c, 0xc9, 0xfe, 0x80, 0x20, 0xf4, 0xc1, 0xc9, 0xcd, 0x5c, 0xca, 0xf5, 0xf5, 0xed, 0x78, 
-0x87, 0x30, 0xfb, 0x87, 0x30, 0x3, 0xf1, 0xf1, 0xc9, 0xf1, 0xc, 0xed, 0x79, 0xd, 0x3e, 0x5, 
-0x3d, 0x0, 0x20, 0xfc, 0xf1, 0xc9, 0x22, 0x76, 0xbe, 0xe3, 0xd5, 0xc5, 0xed, 0x73, 0x64, 0xbe, 
-0xe5, 0x21, 0xad, 0xc9, 0xe3, 0xe5, 0xd5, 0xc5, 0xf5, 0xcd, 0xdf, 0xc9, 0x3a, 0x5f, 0xbe, 0xb7, 
-0x20, 0x14, 0x1, 0x7e, 0xfa, 0x3e, 0x1, 0xed, 0x79, 0xed, 0x5b, 0x44, 0xbe, 0xcd, 0xcd, 0xc9, 
-0x3a, 0x5f, 0xbe, 0xb7, 0x28, 0xfa, 0xf1, 0xc1, 0xd1, 0x2a, 0x76, 0xbe, 0xc9, 0xed, 0x7b, 0x64, 
-0xbe, 0xf5, 0xed, 0x5b, 0x46, 0xbe, 0xcd, 0xcd, 0xc9, 0xf1, 0xc1, 0xd1, 0xe1, 0x3e, 0x0, 0xd8, 
-0x21, 0x4c, 0xbe, 0x7e, 0xe6, 0x8, 0x23, 0xb6, 0xf6, 0x40, 0x2b, 0x2b, 0xc9, 0x21, 0x67, 0xbe, 
-0x1, 0x0, 0x0, 0xc3, 0xe9, 0xbc, 0x21, 0x5f, 0xbe, 0x7e, 0x2f, 0x77, 0xb7, 0x28, 0x6, 0x21, 
-0x67, 0xbe, 0xc3, 0xec, 0xbc, 0xcd, 0xdf, 0xc9, 0x3e, 0x0, 0x1, 0x7e, 0xfa, 0xed, 0x79, 0xaf, 
-0x32, 0x5f, 0xbe, 0xc9, 0x21, 0x20, 0x2, 0x11, 0xd0, 0x1, 0xcd, 0x3, 0xca, 0x21, 0x10, 0x2, 
-0x11, 0x90, 0x1, 0xcd, 0x98, 0xca, 0xed, 0x53, 0x42, 0xbe, 0xd5, 0xcd, 0x9f, 0xca, 0x22, 0x40, 
-0xbe, 0xe5, 0x21, 0x43, 0xca, 0x1, 0x19, 0x0, 0xed, 0xb0, 0x4b, 0x42, 0xe1, 0x36, 0x0, 0x23, 
-0x36, 0x0, 0x11, 0x7, 0x0, 0x19, 0x11, 0x30, 0x2, 0xcd, 0x98, 0xca, 0x73, 0x23, 0x72, 0x23, 
-0xd1, 0x73, 0x23, 0x72, 0x23, 0x71, 0x23, 0x70, 0x23, 0xeb, 0x21, 0x10, 0x0, 0x9, 0xeb, 0x73, 
-0x23, 0x72, 0xc9, 0x24, 0x0, 0x3, 0x7, 0x0, 0xaa, 0x0, 0x3f, 0x0, 0xc0, 0x0, 0x10, 0x0, 
-0x2, 0x0, 0x41, 0x9, 0x2a, 0x52, 0xe5, 0x2, 0x4, 0x0, 0x0, 0x0, 0xe5, 0xcd, 0x63, 0xca, 
-0x7e, 0xe1, 0xc9, 0xd5, 0x2a, 0x42, 0xbe, 0x1d, 0x11, 0x40, 0x0, 0x20, 0x1, 0x19, 0x5f, 0x19, 
-0xd1, 0xc9, 0x2a, 0x78, 0xbe, 0x32, 0x78, 0xbe, 0x7d, 0xc9, 0xf5, 0x3a, 0x78, 0xbe, 0xb7, 0x20, 
-0x5, 0xf1, 0x4b, 0xc3, 0xb8, 0xca, 0xf1, 0xaf, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfd, 0xe5, 0xe3, 0x9, 0x44, 0x4d, 0xe1, 0xc9, 0xfd, 0xe5, 0xe3, 0x19, 0xeb, 0xe1, 0xc9, 0xd5, 
-0xfd, 0xe5, 0xd1, 0x19, 0xd1, 0xc9, 0xfe, 0x61, 0xd8, 0xfe, 0x7b, 0xd0, 0xc6, 0xe0, 0xc9, 0xaf, 
-0x12, 0x13, 0xb, 0x78, 0xb1, 0x20, 0xf8, 0xc9, 0xcd, 0xeb, 0xca, 0x3e, 0x14, 0xcd, 0xeb, 0xca, 
-0xcd, 0x9, 0xbb, 0x38, 0xfb, 0xcd, 0x81, 0xbb, 0xcd, 0x6, 0xbb, 0xcd, 0xa6, 0xca, 0xfe, 0x43, 
-0x28, 0x11, 0xfe, 0x49, 0x37, 0x28, 0xc, 0xfe, 0x52, 0x28, 0x7, 0x3e, 0x7, 0xcd, 0x5a, 0xbb, 
-0x18, 0xe6, 0xb7, 0xcd, 0x5a, 0xbb, 0xcd, 0x84, 0xbb, 0x3e, 0x0, 0xe5, 0xc5, 0xf5, 0xe6, 0x7f, 
-0x21, 0x86, 0xcb, 0x47, 0x4, 0x18, 0x5, 0x7e, 0x23, 0x3c, 0x20, 0xfb, 0x10, 0xf9, 0x7e, 0x23, 
-0xfe, 0xff, 0x28, 0xb, 0xe5, 0xd5, 0xc5, 0xcd, 0x13, 0xcb, 0xc1, 0xd1, 0xe1, 0x18, 0xef, 0xf1, 
-0xc1, 0xe1, 0xc9, 0xb7, 0xf2, 0x66, 0xcb, 0xfe, 0xfe, 0x28, 0x46, 0xfe, 0xfc, 0x28, 0x1a, 0xfe, 
-0xfd, 0x20, 0xc8, 0x6, 0x8, 0xcd, 0x2f, 0xcb, 0x3e, 0x2e, 0xcd, 0x83, 0xcb, 0x6, 0x3, 0x13, 
-0x1a, 0xe6, 0x7f, 0xcd, 0x83, 0xcb, 0x10, 0xf7, 0xc9, 0xeb, 0x16, 0x20, 0x1, 0x9c, 0xff, 0xcd, 
-0x4d, 0xcb, 0x1, 0xf6, 0xff, 0xcd, 0x4d, 0xcb, 0x7d, 0xc6, 0x30, 0x18, 0x36, 0x3e, 0xff, 0xe5, 
-0x3c, 0x9, 0x30, 0x4, 0xe3, 0xe1, 0x18, 0xf7, 0xe1, 0xb7, 0x28, 0x2, 0x16, 0x30, 0x82, 0x18, 
-0x22, 0x79, 0xc6, 0x41, 0x18, 0x1d, 0xf5, 0xfe, 0x20, 0x20, 0x17, 0xe5, 0xd5, 0xcd, 0x69, 0xbb, 
-0xcd, 0x78, 0xbb, 0x7a, 0xd6, 0x4, 0x3f, 0x30, 0x1, 0xbc, 0xd1, 0xe1, 0x30, 0x4, 0xf1, 0xc3, 
-0xe9, 0xca, 0xf1, 0xc3, 0x5a, 0xbb, 0xd, 0xa, 0xff, 0x20, 0x20, 0x20, 0xff, 0xfc, 0x4b, 0xff, 
-0x97, 0x82, 0x20, 0x66, 0x72, 0x65, 0x65, 0x97, 0xff, 0x80, 0x42, 0x61, 0x64, 0x20, 0x63, 0x6f, 
-0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x80, 0xff, 0x9b, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 
-0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x80, 0xff, 0x9b, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 
-0x6e, 0x64, 0x80, 0xff, 0x95, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x9a, 
-0xff, 0x98, 0x9a, 0xff, 0x98, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x2c, 0x20, 0x63, 0x6c, 
-0x6f, 0x73, 0x69, 0x6e, 0x67, 0x20, 0xfd, 0x80, 0xff, 0x9b, 0x69, 0x73, 0x20, 0x9d, 0x20, 0x6f, 
-0x6e, 0x6c, 0x79, 0x80, 0xff, 0xfd, 0xff, 0x95, 0x75, 0x73, 0x65, 0x72, 0xfc, 0x80, 0xff, 0x2e, 
-0x2e, 0x2e, 0x5e, 0x43, 0xff, 0x96, 0x43, 0x50, 0x2f, 0x4d, 0x80, 0xff, 0x96, 0x62, 0x6f, 0x6f, 
-0x74, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x80, 0xff, 0x95, 0x9d, 0x99, 0xff, 0x95, 0x9c, 
-0x99, 0xff, 0x98, 0x69, 0x73, 0x20, 0x9c, 0x20, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 0x65, 
-0x64, 0x80, 0xff, 0x98, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x80, 0xff, 0x80, 0x52, 0x65, 
-0x74, 0x72, 0x79, 0x2c, 0x20, 0x49, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x43, 
-0x61, 0x6e, 0x63, 0x65, 0x6c, 0x3f, 0x20, 0xff, 0x80, 0x44, 0x72, 0x69, 0x76, 0x65, 0x20, 0xfe, 
-0x3a, 0x20, 0xff, 0x80, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x6f, 
-0x61, 0x64, 0x20, 0xff, 0x80, 0x80, 0xff, 0x95, 0x64, 0x69, 0x73, 0x63, 0x20, 0xff, 0x20, 0x66, 
-0x61, 0x69, 0x6c, 0x80, 0xff, 0x66, 0x75, 0x6c, 0x6c, 0x80, 0xff, 0x80, 0xfd, 0x20, 0xff, 0x77, 
-0x72, 0x69, 0x74, 0x65, 0xff, 0x72, 0x65, 0x61, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xaf, 0xfd, 0x77, 0x0, 0xfd, 0x77, 0x1, 0x3d, 0xfd, 0x77, 0x8, 0xfd, 0x77, 0x2c, 0xfd, 0x22, 
-0x7d, 0xbe, 0x21, 0x77, 0xbc, 0x11, 0x64, 0x1, 0xcd, 0x98, 0xca, 0x1, 0x27, 0x0, 0xed, 0xb0, 
-0xeb, 0x36, 0x30, 0x23, 0x36, 0xcd, 0x23, 0xcd, 0x12, 0xb9, 0x77, 0x3e, 0xc9, 0x32, 0x7f, 0xbe, 
-0xaf, 0xcd, 0xe4, 0xcc, 0xd0, 0x21, 0x77, 0xbc, 0x6, 0x7, 0xcd, 0xe9, 0xcc, 0xd0, 0x21, 0x9b, 
-0xbc, 0x4, 0x18, 0x5, 0x21, 0x8c, 0xbc, 0x6, 0x5, 0xb7, 0x20, 0x3f, 0x11, 0x8b, 0x1, 0xcd, 
-0x98, 0xca, 0x36, 0xdf, 0x23, 0x73, 0x23, 0x72, 0x23, 0x10, 0xf7, 0x37, 0xc9, 0xcd, 0x18, 0xcd, 
-0xd0, 0x21, 0x64, 0x1, 0x11, 0x77, 0xbc, 0x1, 0x15, 0x0, 0xcd, 0x21, 0xcd, 0xd0, 0x21, 0x88, 
-0x1, 0x11, 0x9b, 0xbc, 0xe, 0x3, 0x18, 0x9, 0x21, 0x79, 0x1, 0x11, 0x8c, 0xbc, 0x1, 0xf, 
-0x0, 0xb7, 0x20, 0x7, 0xcd, 0x9f, 0xca, 0xed, 0xb0, 0x37, 0xc9, 0x3e, 0x4, 0xc3, 0xeb, 0xca, 
-0xfd, 0x2a, 0x7d, 0xbe, 0xf3, 0x8, 0xd9, 0x79, 0xd1, 0xc1, 0xe1, 0xe3, 0xc5, 0xd5, 0x4f, 0x6, 
-0x7f, 0x11, 0xd2, 0x10, 0x19, 0xe5, 0xd9, 0x8, 0xfb, 0xc3, 0x7f, 0xbe, 0xc3, 0xaf, 0xce, 0xc3, 
-0xb6, 0xd1, 0xc3, 0xbc, 0xd1, 0xc3, 0x64, 0xcf, 0xc3, 0xf5, 0xcf, 0xc3, 0x69, 0xd0, 0xc3, 0x65, 
-0xd0, 0xc3, 0x37, 0xcf, 0xc3, 0xd8, 0xd1, 0xc3, 0xc2, 0xd1, 0xc3, 0x8f, 0xd0, 0xc3, 0xd8, 0xd0, 
-0xc3, 0x13, 0xd5, 0xcd, 0x77, 0xcd, 0xc9, 0xe5, 0x21, 0x6, 0x0, 0x39, 0xfd, 0x75, 0x6, 0xfd, 
-0x74, 0x7, 0xe1, 0xc9, 0xcd, 0x77, 0xcd, 0xf5, 0xfd, 0x7e, 0x8, 0x18, 0x7, 0xcd, 0x77, 0xcd, 
-0xf5, 0xfd, 0x7e, 0x2c, 0xfe, 0xff, 0x28, 0x12, 0xcd, 0x16, 0xce, 0xf1, 0xc9, 0xfd, 0x7e, 0x8, 
-0x18, 0x3, 0xfd, 0x7e, 0x2c, 0xcd, 0x77, 0xcd, 0x3c, 0xc8, 0x3e, 0xe, 0xb7, 0x18, 0xa, 0x3e, 
-0x4, 0xcd, 0xca, 0xdb, 0xc6, 0xc, 0xf6, 0x80, 0xbf, 0xfd, 0x6e, 0x6, 0xfd, 0x66, 0x7, 0xf9, 
-0xc9, 0x3d, 0x3d, 0xc8, 0xc3, 0xaf, 0xcd, 0xcd, 0xcf, 0xcd, 0x46, 0x23, 0xc3, 0xf9, 0xdb, 0xdd, 
-0x6e, 0x0, 0xdd, 0x66, 0x1, 0xdd, 0x23, 0xdd, 0x23, 0xc9, 0xaf, 0x18, 0x2, 0x3e, 0x1, 0xcd, 
-0x73, 0xcd, 0x18, 0x13, 0xcd, 0x73, 0xcd, 0xcd, 0xc2, 0xcd, 0xcd, 0xc7, 0xcd, 0x5, 0xc2, 0xaf, 
-0xcd, 0x7e, 0xcd, 0xa6, 0xca, 0xd6, 0x41, 0xcd, 0x16, 0xce, 0xfd, 0x77, 0x0, 0xc9, 0xcd, 0x73, 
-0xcd, 0xcd, 0xc2, 0xcd, 0xcd, 0xcf, 0xcd, 0x11, 0x10, 0x0, 0xcd, 0xf3, 0xdb, 0xd2, 0xaf, 0xcd, 
-0xfd, 0x75, 0x1, 0xc9, 0xa, 0x3, 0xe5, 0xd5, 0xc5, 0xf5, 0x4f, 0x1e, 0xff, 0xfd, 0x7e, 0x8, 
-0xb9, 0x28, 0x8, 0xfd, 0x7e, 0x2c, 0xb9, 0x28, 0x2, 0x1e, 0x0, 0xd5, 0xc5, 0xcd, 0xf0, 0xc4, 
-0xc1, 0xd1, 0x7c, 0xb5, 0xca, 0xaf, 0xcd, 0xfd, 0x75, 0x3, 0xfd, 0x74, 0x4, 0xfd, 0x73, 0x5, 
-0xfd, 0x71, 0x2, 0xf1, 0xc1, 0xd1, 0xe1, 0xc9, 0x21, 0x50, 0x0, 0xcd, 0x5a, 0xce, 0xe5, 0x11, 
-0x42, 0x0, 0x19, 0x36, 0x80, 0xe1, 0xc9, 0x21, 0x9a, 0x0, 0xc5, 0xd5, 0xcd, 0x9f, 0xca, 0x36, 
-0x0, 0x23, 0x73, 0x23, 0x72, 0x23, 0x73, 0x23, 0x72, 0x23, 0xe5, 0xc5, 0x1, 0x45, 0x0, 0xeb, 
-0xcd, 0xaf, 0xca, 0xc1, 0x60, 0x69, 0xd1, 0xd5, 0x1, 0xc, 0x0, 0xed, 0xb0, 0xe1, 0xd1, 0xe5, 
-0x1, 0x12, 0x0, 0x9, 0x36, 0x16, 0x23, 0x23, 0x23, 0x73, 0x23, 0x72, 0x23, 0x36, 0xff, 0xe1, 
-0xc1, 0xc9, 0xe5, 0x21, 0x0, 0x0, 0x54, 0x6, 0x43, 0xe3, 0x7e, 0x23, 0xe3, 0x5f, 0x19, 0x10, 
-0xf8, 0xeb, 0xe1, 0xc9, 0xe5, 0xcd, 0x92, 0xce, 0x73, 0x23, 0x72, 0xe1, 0xc3, 0xf9, 0xd3, 0xcd, 
-0x9d, 0xcd, 0xd5, 0xcd, 0x6f, 0xda, 0xcd, 0x14, 0xce, 0x21, 0x9, 0x0, 0x9, 0x7e, 0x3c, 0x28, 
-0x8, 0xcd, 0x51, 0xd6, 0xd2, 0xc, 0xd5, 0x18, 0x1e, 0xcd, 0xa8, 0xd2, 0xcd, 0x51, 0xd6, 0x38, 
-0x16, 0xcd, 0xb3, 0xd2, 0xcd, 0x51, 0xd6, 0x38, 0xe, 0xcd, 0xb7, 0xd2, 0xcd, 0x51, 0xd6, 0xf5, 
-0xd4, 0xa8, 0xd2, 0xf1, 0xd2, 0xc, 0xd5, 0xd1, 0xcd, 0x48, 0xce, 0xe5, 0x11, 0x8, 0x0, 0xcd, 
-0x98, 0xca, 0xb, 0xa, 0x12, 0xcd, 0x9c, 0xd7, 0x21, 0xe4, 0x0, 0xcd, 0x9f, 0xca, 0xcd, 0x92, 
-0xd3, 0x30, 0x1f, 0xe5, 0xd5, 0xcd, 0x92, 0xce, 0xcd, 0xf9, 0xdb, 0xcd, 0xf3, 0xdb, 0xd1, 0xe1, 
-0x20, 0xd, 0x11, 0x55, 0x0, 0xcd, 0x98, 0xca, 0x1, 0x45, 0x0, 0xed, 0xb0, 0x18, 0x3, 0xcd, 
-0x9c, 0xd7, 0xe1, 0xe5, 0x11, 0x15, 0x0, 0x19, 0x5e, 0x23, 0x56, 0x23, 0x23, 0x4e, 0x23, 0x46, 
-0xe1, 0x37, 0x9f, 0xfd, 0x7e, 0x67, 0xc9, 0xcd, 0xa2, 0xcd, 0xd5, 0xcd, 0x6a, 0xda, 0xcd, 0x14, 
-0xce, 0xd1, 0xcd, 0x57, 0xce, 0xe5, 0xcd, 0xab, 0xd2, 0xcd, 0x76, 0xd6, 0x60, 0x69, 0x2b, 0x11, 
-0x2c, 0x0, 0xcd, 0x98, 0xca, 0x1, 0xd, 0x0, 0xed, 0xb0, 0x1, 0x17, 0x0, 0xcd, 0xaf, 0xca, 
-0xe1, 0x37, 0x9f, 0xc9, 0xe5, 0xd5, 0xc5, 0xcd, 0x74, 0xcf, 0xc1, 0xd1, 0xe1, 0xd0, 0xfe, 0x1a, 
-0x37, 0xc0, 0xb7, 0xc9, 0xcd, 0x84, 0xcd, 0xfd, 0xe5, 0xd1, 0x21, 0x50, 0x0, 0x19, 0x7e, 0xfe, 
-0x2, 0xca, 0xaa, 0xcd, 0x36, 0x1, 0x21, 0x95, 0x0, 0x19, 0x7e, 0x23, 0xb6, 0x23, 0xb6, 0x28, 
-0x36, 0x21, 0x68, 0x0, 0x19, 0x7e, 0x23, 0xb6, 0x2b, 0xcc, 0xcb, 0xcf, 0x7e, 0x23, 0xb6, 0x28, 
-0x26, 0x46, 0x2b, 0x4e, 0xb, 0x71, 0x23, 0x70, 0x21, 0x95, 0x0, 0x19, 0x6, 0x3, 0x7e, 0xd6, 
-0x1, 0x77, 0x30, 0x3, 0x23, 0x10, 0xf7, 0x21, 0x53, 0x0, 0x19, 0x5e, 0x23, 0x56, 0xeb, 0xe7, 
-0xeb, 0x13, 0x72, 0x2b, 0x73, 0x37, 0xc9, 0x3e, 0xf, 0xb7, 0xc9, 0xe5, 0xd5, 0xe5, 0x21, 0x51, 
-0x0, 0x19, 0xcd, 0xf9, 0xdb, 0xe5, 0x1, 0x10, 0x0, 0xcd, 0x49, 0xd0, 0x3e, 0x10, 0x91, 0x47, 
-0xe, 0x0, 0xcb, 0x38, 0xcb, 0x19, 0xd1, 0xe1, 0x71, 0x23, 0x70, 0x1, 0xea, 0xff, 0x9, 0x73, 
-0x23, 0x72, 0xd1, 0xe1, 0xc9, 0xcd, 0x84, 0xcd, 0xe5, 0x21, 0x50, 0x0, 0xcd, 0x9f, 0xca, 0x7e, 
-0xfe, 0x1, 0xca, 0xaa, 0xcd, 0x36, 0x2, 0x11, 0x45, 0x0, 0x19, 0x5e, 0x23, 0x56, 0xe1, 0xd5, 
-0xe5, 0xeb, 0x3e, 0x7, 0xcd, 0xeb, 0xdb, 0x44, 0x4d, 0xe1, 0xcd, 0x49, 0xd0, 0xd1, 0x30, 0x1e, 
-0x7b, 0xe6, 0x7f, 0x28, 0x19, 0xf5, 0xe5, 0x21, 0xe4, 0x0, 0xcd, 0x9f, 0xca, 0xe5, 0x1, 0x1, 
-0x0, 0xcd, 0x49, 0xd0, 0xe1, 0xd1, 0xc1, 0x30, 0x5, 0x48, 0x6, 0x0, 0xed, 0xb0, 0x21, 0x6f, 
-0x0, 0xcd, 0x9f, 0xca, 0x37, 0x9f, 0xc3, 0xf9, 0xdb, 0x18, 0x14, 0xcd, 0x92, 0xd3, 0xd0, 0x11, 
-0x67, 0x0, 0xcd, 0x98, 0xca, 0x1a, 0x1f, 0xdc, 0x52, 0xd2, 0x11, 0x80, 0x0, 0x19, 0xb, 0x78, 
-0xb1, 0x20, 0xe8, 0x37, 0xc9, 0xcd, 0x64, 0xcf, 0xd0, 0xe5, 0xd5, 0xf5, 0x21, 0x53, 0x0, 0xcd, 
-0x9f, 0xca, 0x5e, 0x23, 0x56, 0x1b, 0x72, 0x2b, 0x73, 0x54, 0x5d, 0x21, 0x42, 0x0, 0x19, 0xcd, 
-0xab, 0xd7, 0x21, 0x15, 0x0, 0x19, 0x34, 0x20, 0x2, 0x23, 0x34, 0xf1, 0xd1, 0xe1, 0xc9, 0xcd, 
-0x8d, 0xcd, 0xe5, 0xd5, 0xc5, 0xf5, 0xfd, 0xe5, 0xd1, 0x21, 0x9a, 0x0, 0x19, 0x7e, 0xfe, 0x2, 
-0xca, 0xaa, 0xcd, 0x36, 0x1, 0x21, 0xb2, 0x0, 0x19, 0xe5, 0xcd, 0xf9, 0xdb, 0x1, 0x0, 0xf8, 
-0x9, 0xd5, 0xdc, 0x18, 0xd1, 0xd1, 0xe1, 0x34, 0x23, 0x20, 0x1, 0x34, 0x21, 0xdf, 0x0, 0x19, 
-0xcd, 0xab, 0xd7, 0x21, 0x9d, 0x0, 0x19, 0xf1, 0x4e, 0x23, 0x46, 0x2b, 0x2, 0x34, 0x20, 0x2, 
-0x23, 0x34, 0xc1, 0xd1, 0xe1, 0x37, 0x9f, 0xc9, 0xcd, 0x8d, 0xcd, 0xf5, 0xe5, 0xd5, 0x21, 0x9a, 
-0x0, 0xcd, 0x9f, 0xca, 0x7e, 0xfe, 0x1, 0xca, 0xaa, 0xcd, 0x36, 0x2, 0x11, 0x20, 0x0, 0x19, 
-0x70, 0x2b, 0x71, 0xc1, 0x2b, 0x70, 0x2b, 0x71, 0x11, 0x29, 0x0, 0x19, 0x70, 0x2b, 0x71, 0x11, 
-0xd3, 0xff, 0x19, 0x71, 0x23, 0x70, 0xc1, 0x23, 0x71, 0x23, 0x70, 0x11, 0xe6, 0xff, 0x19, 0x71, 
-0x23, 0x70, 0xf1, 0x11, 0x15, 0x0, 0x19, 0x77, 0xfd, 0xe5, 0xd1, 0x21, 0xb6, 0x0, 0x19, 0x7e, 
-0xb7, 0x28, 0x18, 0x21, 0xb1, 0x0, 0x19, 0x7e, 0xe6, 0xf, 0xfe, 0x6, 0x28, 0xd, 0x21, 0x2c, 
-0x0, 0x19, 0xd5, 0xeb, 0xcd, 0xa7, 0xd7, 0xcd, 0x7d, 0xd7, 0xd1, 0x21, 0xb2, 0x0, 0x19, 0xe5, 
-0x5e, 0x23, 0x56, 0x1, 0xe8, 0xff, 0x9, 0xcd, 0xf9, 0xdb, 0xe5, 0xcd, 0x64, 0xd1, 0xc1, 0xe1, 
-0x36, 0x0, 0x23, 0x36, 0x0, 0x23, 0x23, 0x23, 0x36, 0x0, 0x11, 0xe7, 0xff, 0x19, 0x71, 0x23, 
-0x70, 0x37, 0x9f, 0xc9, 0xd5, 0x3e, 0x7, 0xeb, 0xcd, 0xeb, 0xdb, 0xeb, 0x42, 0x4b, 0xcd, 0x88, 
-0xd1, 0xc1, 0x79, 0xe6, 0x7f, 0xc8, 0x4f, 0x6, 0x0, 0x11, 0xe4, 0x0, 0xcd, 0x98, 0xca, 0xd5, 
-0xcd, 0x1b, 0xb9, 0x3e, 0x1a, 0x12, 0xe1, 0x3, 0x18, 0x27, 0xe5, 0x11, 0xb1, 0x0, 0xcd, 0x98, 
-0xca, 0x1a, 0x1f, 0x30, 0x13, 0xc5, 0x11, 0xe4, 0x0, 0xcd, 0x98, 0xca, 0xd5, 0x1, 0x80, 0x0, 
-0xcd, 0x1b, 0xb9, 0xe1, 0xc1, 0xcd, 0x52, 0xd2, 0xcd, 0xaf, 0xd3, 0xe1, 0x11, 0x80, 0x0, 0x19, 
-0xb, 0x78, 0xb1, 0x20, 0xd5, 0xc9, 0xcd, 0x84, 0xcd, 0xcd, 0xe5, 0xc9, 0xfd, 0x36, 0x8, 0xff, 
-0x18, 0x6e, 0xcd, 0x8d, 0xcd, 0x11, 0x2d, 0x0, 0xcd, 0x98, 0xca, 0xaf, 0xcd, 0x3c, 0xd8, 0x1b, 
-0x3e, 0xff, 0x12, 0xcd, 0x1f, 0xc5, 0x18, 0x58, 0x21, 0xdf, 0x0, 0xcd, 0x9f, 0xca, 0x7e, 0x23, 
-0xb6, 0x23, 0xb6, 0x28, 0xdd, 0xcd, 0x8d, 0xcd, 0xcd, 0x18, 0xd1, 0x11, 0x2c, 0x0, 0xcd, 0x98, 
-0xca, 0xd5, 0xcd, 0x8c, 0xd7, 0x1, 0x9f, 0x0, 0xcd, 0x90, 0xca, 0x21, 0x12, 0x0, 0x9, 0x5e, 
-0x21, 0x9, 0x0, 0x9, 0x7e, 0x3c, 0x20, 0x16, 0x7b, 0xe6, 0xe, 0x20, 0x5, 0xcd, 0xb3, 0xd2, 
-0x18, 0xc, 0xfe, 0x2, 0x20, 0x5, 0xcd, 0xb7, 0xd2, 0x18, 0x3, 0xcd, 0xa8, 0xd2, 0x60, 0x69, 
-0x7b, 0xe6, 0xf, 0xfe, 0x6, 0xc4, 0xa4, 0xce, 0xc1, 0x3e, 0xff, 0x2, 0x3, 0xcd, 0xda, 0xd2, 
-0x37, 0x9f, 0xc9, 0xfd, 0x66, 0x2, 0xfd, 0x36, 0x5, 0x0, 0x11, 0x8, 0x0, 0xcd, 0x43, 0xd2, 
-0x11, 0x2c, 0x0, 0xcd, 0x98, 0xca, 0x1a, 0xbc, 0xc0, 0x3e, 0xff, 0x12, 0x13, 0x3e, 0x9, 0xc3, 
-0xca, 0xdb, 0xe5, 0xc5, 0xe5, 0x11, 0x1, 0x1, 0x6, 0x81, 0x18, 0xe, 0xe3, 0xe7, 0xe3, 0xae, 
-0xdd, 0xae, 0x0, 0xe3, 0x77, 0x23, 0xe3, 0xdd, 0x23, 0x23, 0x15, 0x20, 0x6, 0x16, 0xb, 0xdd, 
-0x21, 0x81, 0xd2, 0x1d, 0x20, 0x5, 0x1e, 0xd, 0x21, 0x8c, 0xd2, 0x10, 0xdf, 0xe1, 0xd1, 0xe1, 
-0xc9, 0x49, 0xb1, 0x36, 0xf0, 0x2e, 0x1e, 0x6, 0x2a, 0x28, 0x19, 0xea, 0xe2, 0x9d, 0xdb, 0x1a, 
-0x42, 0x29, 0x39, 0xc6, 0xb3, 0xc6, 0x90, 0x45, 0x8a, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x42, 
-0x41, 0x4b, 0x42, 0x41, 0x53, 0x42, 0x49, 0x4e, 0xaf, 0x18, 0xe, 0x3e, 0x3, 0x18, 0xa, 0x3e, 
-0x6, 0x18, 0x6, 0x3e, 0x9, 0x18, 0x2, 0x3e, 0xc, 0xd5, 0xc6, 0x99, 0x5f, 0xce, 0xd2, 0x93, 
-0x57, 0x18, 0x7, 0xd5, 0x11, 0xa8, 0x0, 0xcd, 0x98, 0xca, 0xe5, 0xc5, 0x21, 0x9, 0x0, 0x9, 
-0x1, 0x3, 0x0, 0xeb, 0xed, 0xb0, 0xc1, 0xe1, 0xd1, 0xc9, 0x21, 0xc, 0x0, 0x9, 0x36, 0xff, 
-0x23, 0x23, 0x36, 0xff, 0xcd, 0x83, 0xd6, 0xe5, 0x21, 0x0, 0x0, 0xe3, 0xcd, 0xa2, 0xd6, 0xe3, 
-0x30, 0x28, 0xcd, 0xaf, 0xd2, 0xcd, 0xd8, 0xd7, 0x30, 0x8, 0x26, 0x1, 0xcd, 0xd9, 0xd9, 0x38, 
-0x1, 0x24, 0xcd, 0xc3, 0xd2, 0xcd, 0xd8, 0xd7, 0x30, 0x8, 0x2e, 0x1, 0xcd, 0xd9, 0xd9, 0x38, 
-0x1, 0x2c, 0x7c, 0xb7, 0x28, 0xd5, 0x7d, 0xb7, 0x28, 0xd1, 0xf1, 0x7d, 0xb7, 0x28, 0x43, 0x3d, 
-0x28, 0x66, 0x7c, 0xb7, 0x28, 0x3c, 0x3d, 0x28, 0x45, 0xcd, 0x83, 0xd6, 0xcd, 0xa2, 0xd6, 0xd0, 
-0xcd, 0x35, 0xd3, 0x18, 0xf7, 0xcd, 0xaf, 0xd2, 0xcd, 0xd8, 0xd7, 0xda, 0xaa, 0xd4, 0xcd, 0x51, 
-0xd3, 0xd8, 0xcd, 0xc3, 0xd2, 0xcd, 0xd8, 0xd7, 0xd0, 0xc5, 0x42, 0x4b, 0xcd, 0xaf, 0xd2, 0x18, 
-0xd, 0xcd, 0xab, 0xd2, 0xcd, 0xd8, 0xd7, 0xd0, 0xc5, 0x42, 0x4b, 0xcd, 0xc3, 0xd2, 0xc1, 0xc3, 
-0x7a, 0xd9, 0xcd, 0x83, 0xd6, 0xcd, 0xa2, 0xd6, 0xd0, 0xcd, 0x3e, 0xd3, 0x18, 0xf7, 0xcd, 0x83, 
-0xd6, 0xcd, 0xa2, 0xd6, 0xd0, 0xcd, 0x7a, 0xd3, 0x18, 0xf7, 0xcd, 0x51, 0xd3, 0xd8, 0xcd, 0xc3, 
-0xd2, 0xcd, 0xd8, 0xd7, 0xda, 0xaa, 0xd4, 0xc9, 0xcd, 0xc3, 0xd2, 0x50, 0x59, 0x3e, 0xa, 0xc3, 
-0xb1, 0xcd, 0xe5, 0xd5, 0xc5, 0xe5, 0x11, 0x8, 0x0, 0xcd, 0x98, 0xca, 0xcd, 0x10, 0xd4, 0x30, 
-0x8, 0xeb, 0xe3, 0xcd, 0xe8, 0xd9, 0xd1, 0x18, 0x48, 0xe1, 0xc1, 0xd1, 0xe1, 0xb7, 0xc9, 0xe5, 
-0xd5, 0xc5, 0xe5, 0x11, 0x2c, 0x0, 0xcd, 0x98, 0xca, 0xcd, 0xc8, 0xd6, 0x38, 0xb, 0x3e, 0x8, 
-0xc2, 0xb1, 0xcd, 0xcd, 0x8c, 0xd7, 0xcd, 0xfa, 0xd6, 0xcd, 0x2f, 0xd7, 0xe, 0x0, 0x38, 0x18, 
-0xd5, 0xeb, 0xcd, 0x93, 0xd8, 0xeb, 0x3e, 0x8, 0xd2, 0xb1, 0xcd, 0x73, 0x78, 0xb7, 0x28, 0x2, 
-0x23, 0x72, 0xd1, 0xcd, 0x2f, 0xd7, 0xe, 0x2, 0xeb, 0xe3, 0xcd, 0xf3, 0xd9, 0xd1, 0xcd, 0x7d, 
-0xd7, 0xcd, 0xa7, 0xd7, 0xc1, 0xd1, 0xe1, 0x37, 0xc9, 0xe5, 0x11, 0x2c, 0x0, 0xcd, 0x98, 0xca, 
-0xcd, 0x9c, 0xd7, 0xcd, 0x10, 0xd4, 0xeb, 0xe1, 0xe, 0x0, 0xda, 0xf3, 0xd9, 0xc3, 0xaf, 0xcd, 
-0xcd, 0xc8, 0xd6, 0x38, 0x12, 0xc0, 0xcd, 0xfa, 0xd6, 0xd5, 0x42, 0x4b, 0x3, 0xc5, 0xcd, 0xb3, 
-0xd7, 0xeb, 0xd1, 0xdc, 0xdf, 0xdb, 0xd1, 0xdc, 0xc, 0xd7, 0xda, 0x2f, 0xd7, 0xc9, 0xcd, 0x73, 
-0xcd, 0x6, 0x0, 0xb7, 0x28, 0x6, 0xcd, 0xc2, 0xcd, 0xcd, 0xc7, 0xcd, 0xcd, 0xa6, 0xda, 0xcd, 
-0x14, 0xce, 0xcd, 0xd0, 0xdb, 0x3e, 0xc, 0xcd, 0x72, 0xd4, 0x65, 0xe5, 0xcd, 0x83, 0xd6, 0xcd, 
-0x98, 0xd6, 0x30, 0x1a, 0xcd, 0xdf, 0xd9, 0x38, 0xf6, 0xe3, 0xc5, 0x7c, 0xbd, 0xc4, 0xc4, 0xdb, 
-0xcc, 0xe9, 0xca, 0xcd, 0xc8, 0xdb, 0x2d, 0x20, 0x1, 0x6c, 0xc1, 0xe3, 0x18, 0xe1, 0xe1, 0xc3, 
-0x71, 0xd5, 0xc6, 0x3, 0x67, 0xd5, 0xe5, 0xcd, 0x69, 0xbb, 0x7a, 0xe1, 0xd1, 0xc6, 0x4, 0x2e, 
-0x0, 0x2c, 0x94, 0x30, 0xfc, 0x2d, 0xc0, 0x2e, 0x1, 0xc9, 0xcd, 0x73, 0xcd, 0xcd, 0xc2, 0xcd, 
-0xcd, 0xc7, 0xcd, 0xcd, 0x8d, 0xda, 0xcd, 0x14, 0xce, 0xcd, 0x83, 0xd6, 0xcd, 0x98, 0xd6, 0x30, 
-0x6b, 0xcd, 0xb1, 0xd4, 0xcd, 0x98, 0xd6, 0x38, 0xf8, 0xc9, 0xcd, 0xb1, 0xd4, 0xd2, 0xb8, 0xcd, 
-0xc9, 0xcd, 0xd9, 0xd9, 0x3f, 0x3e, 0xa, 0xd2, 0xca, 0xdb, 0xaf, 0xcd, 0x3c, 0xd8, 0x3e, 0xe5, 
-0x12, 0xc3, 0x7a, 0xd9, 0xcd, 0x73, 0xcd, 0xcd, 0xc1, 0xcd, 0xcd, 0xc7, 0xcd, 0xcd, 0x5b, 0xda, 
-0xc5, 0xcd, 0xc7, 0xcd, 0xcd, 0x60, 0xda, 0xe1, 0xa, 0xbe, 0xc2, 0xaf, 0xcd, 0xcd, 0x14, 0xce, 
-0x23, 0xe5, 0xcd, 0x44, 0xd6, 0xe1, 0xc5, 0x44, 0x4d, 0xcd, 0x83, 0xd6, 0xcd, 0x98, 0xd6, 0x30, 
-0x1b, 0xcd, 0xd9, 0xd9, 0xda, 0x8d, 0xd3, 0xe3, 0xe5, 0xc5, 0x1, 0xc, 0x0, 0xed, 0xb0, 0xc1, 
-0xe1, 0xe3, 0xcd, 0x7a, 0xd9, 0xcd, 0x98, 0xd6, 0x38, 0xe7, 0xe1, 0xc9, 0x50, 0x59, 0x3e, 0x6, 
-0xc3, 0xb1, 0xcd, 0xcd, 0x73, 0xcd, 0xd5, 0xdd, 0xe1, 0x1, 0x0, 0x8, 0xcd, 0xaf, 0xca, 0xcd, 
-0x86, 0xda, 0xcd, 0x14, 0xce, 0xcd, 0xd0, 0xdb, 0xaf, 0xf5, 0xcd, 0x83, 0xd6, 0xcd, 0x98, 0xd6, 
-0x30, 0xc, 0xcd, 0xdf, 0xd9, 0x38, 0xf6, 0xe3, 0xcd, 0xaa, 0xd5, 0xe3, 0x38, 0xef, 0x3e, 0x11, 
-0xcd, 0x72, 0xd4, 0x55, 0xf1, 0x1e, 0x0, 0x1c, 0x92, 0x30, 0xfc, 0x82, 0x20, 0x1, 0x1d, 0xdd, 
-0xe5, 0xe1, 0x4b, 0x42, 0xe5, 0xcd, 0x7a, 0xd5, 0xd5, 0xeb, 0x26, 0x0, 0xcd, 0x3a, 0xd6, 0x19, 
-0xd1, 0x10, 0xf2, 0xe1, 0xd5, 0x11, 0xe, 0x0, 0x19, 0xd1, 0xd, 0x28, 0x4, 0x7e, 0xb7, 0x20, 
-0xe2, 0xcd, 0xc2, 0xd8, 0x3e, 0x3, 0xb7, 0xc3, 0xeb, 0xca, 0xe7, 0xb7, 0xc8, 0xe5, 0xd5, 0xc5, 
-0x78, 0xba, 0xc4, 0xc4, 0xdb, 0xcc, 0xe9, 0xca, 0xeb, 0xcd, 0xc8, 0xdb, 0xcd, 0xd9, 0xd9, 0x3e, 
-0x2a, 0x38, 0x2, 0x3e, 0x20, 0xcd, 0x5a, 0xbb, 0x21, 0xc, 0x0, 0x19, 0xe7, 0x5f, 0x23, 0xe7, 
-0x57, 0x3e, 0x2, 0xcd, 0xeb, 0xca, 0xc1, 0xd1, 0xe1, 0xc9, 0xc5, 0x4c, 0x6, 0x0, 0xdd, 0xe5, 
-0xe1, 0xe7, 0xb7, 0x28, 0x50, 0x4, 0xcd, 0x23, 0xd6, 0x28, 0xf, 0x30, 0x26, 0xd5, 0x11, 0xe, 
-0x0, 0x19, 0xd1, 0x78, 0xfe, 0x92, 0x38, 0xe9, 0x18, 0x56, 0xe5, 0xcd, 0xf2, 0xd8, 0xe3, 0x11, 
-0xc, 0x0, 0x19, 0xe7, 0x5f, 0x23, 0xe7, 0x57, 0x2b, 0xe3, 0x19, 0xeb, 0xe1, 0x73, 0x23, 0x72, 
-0x37, 0x18, 0x3d, 0x79, 0xfe, 0x92, 0x28, 0x38, 0xe5, 0xd5, 0xc5, 0xeb, 0x79, 0x90, 0x3c, 0x6f, 
-0x26, 0x0, 0xcd, 0x3a, 0xd6, 0x44, 0x4d, 0x19, 0x2b, 0xeb, 0x21, 0xe, 0x0, 0x19, 0xeb, 0xcd, 
-0x1e, 0xb9, 0xc1, 0xd1, 0xe1, 0xc, 0xc5, 0xd5, 0x36, 0xff, 0x23, 0x13, 0xeb, 0x1, 0xb, 0x0, 
-0xcd, 0x1b, 0xb9, 0xeb, 0xe3, 0xeb, 0xcd, 0xf2, 0xd8, 0xeb, 0xe1, 0x73, 0x23, 0x72, 0xc1, 0x37, 
-0x61, 0xc1, 0xc9, 0xe5, 0xd5, 0xc5, 0x6, 0xb, 0x13, 0x23, 0x1a, 0xe6, 0x7f, 0x4f, 0xe7, 0xe6, 
-0x7f, 0xb9, 0x20, 0x2, 0x10, 0xf2, 0xc1, 0xd1, 0xe1, 0xc9, 0xd5, 0x54, 0x5d, 0x29, 0x19, 0x29, 
-0x19, 0x29, 0xd1, 0xc9, 0xcd, 0x83, 0xd6, 0xcd, 0x98, 0xd6, 0x30, 0x25, 0x3e, 0x5, 0xc3, 0xb1, 
-0xcd, 0xcd, 0x83, 0xd6, 0xcd, 0x98, 0xd6, 0x30, 0x18, 0xe5, 0x21, 0x9, 0x0, 0xcd, 0x9f, 0xca, 
-0xeb, 0xcd, 0xdf, 0xdb, 0xe1, 0xfd, 0x7e, 0x5, 0xb7, 0x37, 0xc0, 0xcd, 0xa2, 0xd6, 0x38, 0xfb, 
-0x37, 0xfd, 0x36, 0x5, 0xff, 0xc9, 0xcd, 0x83, 0xd6, 0xcd, 0x98, 0xd6, 0x30, 0xf3, 0xcd, 0xaa, 
-0xd4, 0x18, 0xf6, 0xc5, 0xcd, 0x1f, 0xc5, 0xc1, 0x21, 0xff, 0xff, 0xfd, 0x7e, 0x5, 0xb7, 0xc0, 
-0xe5, 0xcd, 0x14, 0xd8, 0xe1, 0xc3, 0xa8, 0xd9, 0xcd, 0xa2, 0xd6, 0xd0, 0xcd, 0xd8, 0xd7, 0x30, 
-0xf7, 0xc9, 0x23, 0xfd, 0x7e, 0x5, 0xb7, 0x20, 0x11, 0xcd, 0x1c, 0xd9, 0xd0, 0x1a, 0xfe, 0xe5, 
-0x37, 0xc8, 0xcd, 0xa8, 0xd9, 0x3e, 0xff, 0xc3, 0x3c, 0xd8, 0xcd, 0xb8, 0xd9, 0xd0, 0xc3, 0x1c, 
-0xd9, 0x21, 0x21, 0x0, 0x19, 0xc3, 0xf9, 0xdb, 0x21, 0x23, 0x0, 0x19, 0x7e, 0xb7, 0xc0, 0xcd, 
-0xc1, 0xd6, 0x7c, 0x1f, 0x1f, 0x1f, 0x1f, 0xe6, 0xf, 0x47, 0x29, 0x7c, 0xe6, 0x1f, 0x4f, 0xc5, 
-0x21, 0xf, 0x0, 0x19, 0x7e, 0xa8, 0x20, 0xf, 0x3e, 0x4, 0xcd, 0x54, 0xda, 0x2f, 0x47, 0x2b, 
-0x2b, 0x7e, 0xa9, 0xa0, 0x20, 0x1, 0x37, 0xc1, 0x9f, 0xc9, 0x21, 0xd, 0x0, 0x19, 0x71, 0x23, 
-0x23, 0x70, 0x23, 0xeb, 0x1, 0x11, 0x0, 0xcd, 0xaf, 0xca, 0xeb, 0xc9, 0xd5, 0xcd, 0xc1, 0xd6, 
-0x7c, 0xe6, 0xf, 0x67, 0xe5, 0x21, 0x10, 0x0, 0x19, 0x4e, 0x6, 0x0, 0x2b, 0x2b, 0x2b, 0x66, 
-0x68, 0x3e, 0x1, 0xcd, 0xeb, 0xdb, 0x9, 0xd1, 0x13, 0xcd, 0xf3, 0xdb, 0x3f, 0xd1, 0xc9, 0xcd, 
-0xc1, 0xd6, 0x3e, 0x3, 0xcd, 0x54, 0xda, 0xa5, 0x4f, 0x3e, 0x2, 0xcd, 0x54, 0xda, 0xcd, 0xeb, 
-0xdb, 0x3e, 0x6, 0xcd, 0x54, 0xda, 0x47, 0xb7, 0x7d, 0x21, 0x11, 0x0, 0x19, 0x28, 0xe, 0xe6, 
-0x7, 0x87, 0x85, 0x6f, 0x8c, 0x95, 0x67, 0xe5, 0xcd, 0xf9, 0xdb, 0x18, 0xb, 0xe6, 0xf, 0x85, 
-0x6f, 0x8c, 0x95, 0x67, 0xe5, 0x6e, 0x26, 0x0, 0x7c, 0xb5, 0x28, 0xf, 0xf1, 0x3e, 0x2, 0xcd, 
-0x54, 0xda, 0x29, 0x3d, 0x20, 0xfc, 0x79, 0xb5, 0x6f, 0x37, 0xc9, 0xe1, 0xc9, 0x21, 0x10, 0x0, 
-0x19, 0x7e, 0x34, 0xb7, 0xf0, 0x36, 0x1, 0x2b, 0x2b, 0x2b, 0x34, 0xc9, 0xd5, 0xd5, 0xcd, 0xbb, 
-0xd7, 0xe3, 0x23, 0xcd, 0xdf, 0xdb, 0xe1, 0xcd, 0x7a, 0xd9, 0xd1, 0xc9, 0x21, 0x21, 0x0, 0x19, 
-0xaf, 0x77, 0x23, 0x77, 0x23, 0x77, 0xc9, 0x21, 0x21, 0x0, 0x19, 0x34, 0xc0, 0x23, 0x34, 0xc0, 
-0x23, 0x34, 0xc9, 0xcd, 0x83, 0xd6, 0xcd, 0x98, 0xd6, 0x18, 0x11, 0x21, 0xff, 0xff, 0x23, 0xcd, 
-0x1c, 0xd9, 0x3e, 0x7, 0xd2, 0xb1, 0xcd, 0x1a, 0xfe, 0xe5, 0x20, 0xf2, 0xf5, 0xfd, 0x7e, 0x5, 
-0xb7, 0x3e, 0x9, 0xca, 0xb8, 0xcd, 0xf1, 0xc9, 0xc5, 0xd5, 0xe5, 0x60, 0x69, 0x1a, 0xae, 0x20, 
-0x2d, 0x23, 0x13, 0x6, 0xb, 0x7e, 0xfe, 0x3f, 0x28, 0x6, 0x1a, 0xae, 0xe6, 0x7f, 0x20, 0x1e, 
-0x23, 0x13, 0x10, 0xf1, 0x7e, 0x3c, 0x28, 0xc, 0x3e, 0x4, 0xcd, 0x54, 0xda, 0x2f, 0x47, 0x1a, 
-0xae, 0xa0, 0x20, 0xa, 0x23, 0x13, 0x23, 0x13, 0x7e, 0x3c, 0x28, 0x2, 0x1a, 0xae, 0xe1, 0xd1, 
-0xc1, 0xc0, 0x37, 0xc9, 0x3e, 0x5, 0xcd, 0x45, 0xda, 0x3e, 0x3, 0xcd, 0xeb, 0xdb, 0x23, 0xeb, 
-0x3e, 0xe, 0xcd, 0x3f, 0xda, 0x36, 0x0, 0x23, 0x1b, 0x7a, 0xb3, 0x20, 0xf8, 0x3e, 0x9, 0xcd, 
-0x45, 0xda, 0xeb, 0x3e, 0xe, 0xcd, 0x3f, 0xda, 0x73, 0x23, 0x72, 0xc9, 0xe5, 0xd5, 0xc5, 0x4f, 
-0x21, 0x10, 0x0, 0x19, 0x6, 0x10, 0x5e, 0x23, 0x3e, 0x6, 0xcd, 0x54, 0xda, 0xb7, 0x28, 0x3, 
-0x5, 0x7e, 0x23, 0x57, 0xb3, 0x28, 0xe, 0xe5, 0x3e, 0x5, 0xcd, 0x45, 0xda, 0x7d, 0x93, 0x7c, 
-0x9a, 0xd4, 0x6c, 0xd8, 0xe1, 0x10, 0xdf, 0xc1, 0xd1, 0xe1, 0x37, 0xc9, 0xc5, 0xd5, 0xd5, 0xeb, 
-0x3e, 0x3, 0xcd, 0xeb, 0xdb, 0xeb, 0x3e, 0xe, 0xcd, 0x3f, 0xda, 0x19, 0xd1, 0x7b, 0xe6, 0x7, 
-0x5f, 0x3e, 0x1, 0x1c, 0xf, 0x1d, 0x20, 0xfc, 0x47, 0xa1, 0x4f, 0x78, 0x2f, 0xa6, 0xb1, 0x77, 
-0xd1, 0xc1, 0xc9, 0xc5, 0xd5, 0x3e, 0x5, 0xcd, 0x45, 0xda, 0xeb, 0x3e, 0xe, 0xcd, 0x3f, 0xda, 
-0x1, 0x80, 0x8, 0x7e, 0xa1, 0x28, 0xc, 0xf, 0x4f, 0x7a, 0xb3, 0x28, 0x12, 0x1b, 0x10, 0xf3, 
-0x23, 0x18, 0xed, 0x7e, 0xb1, 0x77, 0x3e, 0x5, 0xcd, 0x45, 0xda, 0xb7, 0xed, 0x52, 0x37, 0xd1, 
-0xc1, 0xc9, 0xc5, 0xe5, 0x21, 0x0, 0x0, 0xe5, 0x3e, 0x5, 0xcd, 0x45, 0xda, 0xeb, 0x3e, 0xe, 
-0xcd, 0x3f, 0xda, 0x1, 0x80, 0x8, 0x7e, 0xa1, 0x20, 0x3, 0xe3, 0x23, 0xe3, 0x79, 0xf, 0x4f, 
-0x7a, 0xb3, 0x28, 0x6, 0x1b, 0x10, 0xef, 0x23, 0x18, 0xe9, 0xe1, 0xcd, 0x10, 0xd9, 0xeb, 0xe1, 
-0xc1, 0xc9, 0xd5, 0x21, 0x10, 0x0, 0x19, 0x11, 0x0, 0x10, 0x3e, 0x6, 0xcd, 0x54, 0xda, 0xb7, 
-0x7e, 0x23, 0x28, 0x3, 0xb6, 0x15, 0x23, 0xb7, 0x28, 0x1, 0x1c, 0x15, 0x20, 0xec, 0xeb, 0xd1, 
-0x3e, 0x2, 0xcd, 0x54, 0xda, 0x3d, 0x3d, 0x3d, 0xc8, 0x29, 0x18, 0xfb, 0xe5, 0xc5, 0x7d, 0xe6, 
-0x3, 0x20, 0x11, 0xeb, 0x3e, 0x7, 0xcd, 0x45, 0xda, 0xcd, 0xf3, 0xdb, 0x3f, 0xeb, 0x30, 0x15, 
-0xcd, 0x48, 0xd9, 0xaf, 0x47, 0x3e, 0x8, 0xcd, 0x3f, 0xda, 0x11, 0x20, 0x0, 0x4, 0x18, 0x1, 
-0x19, 0x10, 0xfd, 0xeb, 0x37, 0xc1, 0xe1, 0xc9, 0x3e, 0x2, 0xcd, 0xeb, 0xdb, 0xeb, 0x3e, 0x8, 
-0xcd, 0x3f, 0xda, 0xcd, 0xe8, 0xd9, 0x3e, 0xb, 0xcd, 0x45, 0xda, 0xeb, 0xcd, 0xf3, 0xdb, 0xeb, 
-0xd0, 0x3e, 0xc, 0xcd, 0x3f, 0xda, 0x19, 0xcd, 0xc8, 0xd9, 0xbe, 0xc8, 0xf5, 0xeb, 0x29, 0x29, 
-0xcd, 0xb8, 0xd9, 0xeb, 0xd1, 0xda, 0x33, 0xd2, 0x72, 0xc9, 0xe5, 0xc5, 0x3e, 0x2, 0xcd, 0xeb, 
-0xdb, 0xeb, 0x3e, 0x8, 0xcd, 0x3f, 0xda, 0xe, 0x1, 0xcd, 0xf3, 0xd9, 0x3e, 0xb, 0xcd, 0x45, 
-0xda, 0xeb, 0xcd, 0xf3, 0xdb, 0xeb, 0x30, 0xa, 0x3e, 0xc, 0xcd, 0x3f, 0xda, 0x19, 0xcd, 0xc8, 
-0xd9, 0x77, 0xc1, 0xe1, 0xcd, 0xb8, 0xd9, 0xd8, 0xd5, 0xe5, 0xeb, 0x13, 0x3e, 0x2, 0xcd, 0x35, 
-0xda, 0x73, 0x23, 0x72, 0xe1, 0xd1, 0x37, 0xc9, 0xd5, 0xe5, 0x3e, 0x2, 0xcd, 0x35, 0xda, 0x5e, 
-0x23, 0x56, 0xe1, 0xcd, 0xf3, 0xdb, 0xd1, 0xc9, 0xc5, 0xe5, 0x6, 0x80, 0x3e, 0x8, 0xcd, 0x3f, 
-0xda, 0xaf, 0x86, 0x23, 0x10, 0xfc, 0xe1, 0xc1, 0xc9, 0xe5, 0x21, 0x9, 0x0, 0x18, 0x4, 0xe5, 
-0x21, 0xa, 0x0, 0x19, 0x7e, 0x87, 0xe1, 0xc9, 0xc5, 0xd5, 0xe5, 0xcd, 0x6, 0xda, 0xcd, 0x4c, 
-0xc5, 0x18, 0xb, 0xc5, 0xd5, 0xe5, 0xc5, 0xcd, 0x6, 0xda, 0xc1, 0xcd, 0x2e, 0xc5, 0xb7, 0xc2, 
-0xb6, 0xcd, 0xe1, 0xd1, 0xc1, 0xc9, 0xd5, 0x44, 0x4d, 0xcd, 0x1a, 0xc5, 0xd1, 0x3e, 0xd, 0xcd, 
-0x45, 0xda, 0x44, 0x4d, 0xaf, 0xcd, 0x45, 0xda, 0xb, 0x3, 0x7b, 0x95, 0x5f, 0x7a, 0x9c, 0x57, 
-0x30, 0xf7, 0x19, 0xe5, 0xcd, 0x24, 0xc5, 0xc1, 0xaf, 0xcd, 0x3f, 0xda, 0xeb, 0xcd, 0x5a, 0xc5, 
-0x4d, 0x44, 0xc3, 0x29, 0xc5, 0xfd, 0x86, 0x3, 0x6f, 0xfd, 0x8e, 0x4, 0x95, 0x67, 0xc9, 0xcd, 
-0x35, 0xda, 0xc3, 0xf9, 0xdb, 0xf5, 0x3e, 0xa, 0xcd, 0x3f, 0xda, 0xf1, 0x85, 0x6f, 0x8c, 0x95, 
-0x67, 0xc3, 0xf9, 0xdb, 0xe5, 0xcd, 0x45, 0xda, 0x7d, 0xe1, 0xc9, 0x11, 0xe4, 0x0, 0x18, 0x3, 
-0x11, 0xf4, 0x0, 0xe, 0x20, 0xcd, 0x74, 0xda, 0x18, 0x2b, 0xcd, 0x6f, 0xda, 0x18, 0x26, 0xe, 
-0xff, 0x11, 0xe4, 0x0, 0xcd, 0xa0, 0xda, 0xc5, 0x16, 0xb, 0x3, 0x3, 0xa, 0xfe, 0x3f, 0x28, 
-0x69, 0x15, 0x20, 0xf7, 0xc1, 0xc9, 0x6, 0x0, 0xcd, 0xa6, 0xda, 0x18, 0x8, 0xe, 0x20, 0x11, 
-0xe4, 0x0, 0xcd, 0xa0, 0xda, 0x21, 0xd, 0x0, 0x9, 0x36, 0xff, 0x23, 0x23, 0x36, 0xff, 0xc9, 
-0xcd, 0xb6, 0xda, 0x28, 0x45, 0xc9, 0xe, 0x20, 0x11, 0xe4, 0x0, 0xcd, 0xb6, 0xda, 0xc5, 0xe, 
-0xb, 0xcc, 0x8e, 0xdb, 0xc1, 0xc9, 0xe5, 0xcd, 0x98, 0xca, 0xd5, 0xfd, 0x7e, 0x0, 0x12, 0x13, 
-0xfd, 0x7e, 0x1, 0x12, 0x13, 0xc5, 0x41, 0xe, 0x8, 0xcd, 0x85, 0xdb, 0x78, 0xe, 0x3, 0xcd, 
-0x90, 0xdb, 0x1, 0x3, 0x0, 0xcd, 0xaf, 0xca, 0xc1, 0xd1, 0xe1, 0xd5, 0xcd, 0xed, 0xda, 0xd1, 
-0x30, 0x8, 0x42, 0x4b, 0x13, 0x13, 0x1a, 0xfe, 0x20, 0xc9, 0xc3, 0xaf, 0xcd, 0x2b, 0xcd, 0x97, 
-0xdb, 0x3f, 0xd8, 0x4f, 0xe5, 0xc5, 0xfe, 0x3a, 0x28, 0x6, 0xcd, 0xa5, 0xdb, 0x38, 0xf7, 0x37, 
-0xc1, 0xe1, 0x79, 0x38, 0x3e, 0x13, 0xfe, 0x30, 0x38, 0x1f, 0xfe, 0x3a, 0x30, 0x1b, 0xd6, 0x30, 
-0x4f, 0x12, 0xcd, 0xa5, 0xdb, 0xfe, 0x30, 0x38, 0x10, 0xfe, 0x3a, 0x30, 0xc, 0xb7, 0xd, 0xc0, 
-0xc6, 0xda, 0xfe, 0x10, 0xd0, 0x12, 0xcd, 0xa5, 0xdb, 0x1b, 0xfe, 0x51, 0x30, 0xa, 0xfe, 0x41, 
-0x38, 0x6, 0xd6, 0x41, 0x12, 0xcd, 0xa5, 0xdb, 0xcd, 0x9b, 0xdb, 0xee, 0x3a, 0xc0, 0xcd, 0x97, 
-0xdb, 0x3f, 0xd8, 0x13, 0x13, 0xfe, 0x2e, 0xc8, 0xe, 0x8, 0xcd, 0x58, 0xdb, 0xd8, 0xee, 0x2e, 
-0xc0, 0xcd, 0x97, 0xdb, 0xe, 0x3, 0x30, 0x2d, 0xfe, 0x20, 0x38, 0x29, 0xe5, 0xc5, 0x47, 0x21, 
-0xb2, 0xdb, 0x7e, 0x23, 0xb7, 0x28, 0x4, 0xb8, 0x20, 0xf8, 0x37, 0x78, 0xc1, 0xe1, 0x38, 0x15, 
-0xd, 0xf8, 0xfe, 0x2a, 0xcc, 0x8e, 0xdb, 0x12, 0x13, 0xcd, 0xa5, 0xdb, 0x30, 0x7, 0xfe, 0x20, 
-0x20, 0xd6, 0xcd, 0x9b, 0xdb, 0xf5, 0x3e, 0x20, 0xcd, 0x90, 0xdb, 0xf1, 0x3f, 0xc9, 0x3e, 0x3f, 
-0xc, 0xd, 0xc8, 0x12, 0x13, 0x18, 0xfa, 0xcd, 0xa5, 0xdb, 0xd0, 0xfe, 0x20, 0x37, 0xc0, 0xcd, 
-0xa5, 0xdb, 0x38, 0xf7, 0xc9, 0x78, 0xb7, 0xc8, 0x23, 0x5, 0xe7, 0xe6, 0x7f, 0xcd, 0xa6, 0xca, 
-0x37, 0xc9, 0x3c, 0x3e, 0x2e, 0x2c, 0x3b, 0x3a, 0x3d, 0x5b, 0x5d, 0x5f, 0x25, 0x7c, 0x28, 0x29, 
-0x2f, 0x5c, 0x7f, 0x0, 0x3e, 0x1, 0x18, 0x2, 0x3e, 0xb, 0xc5, 0xfd, 0x4e, 0x2, 0x18, 0xa, 
-0xc5, 0xa, 0x5f, 0x16, 0x0, 0xb, 0xa, 0x4f, 0x3e, 0xc, 0xcd, 0xeb, 0xca, 0xc1, 0xc9, 0xe5, 
-0xd5, 0xc5, 0x1, 0x20, 0x0, 0xed, 0xb0, 0xc1, 0xd1, 0xe1, 0xc9, 0xcb, 0x3c, 0xcb, 0x1d, 0x3d, 
-0x20, 0xf9, 0xc9, 0xe5, 0xb7, 0xed, 0x52, 0xe1, 0xc9, 0xd5, 0x5e, 0x23, 0x56, 0xeb, 0xd1, 0xc9, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xc3, 0xfb, 0xec, 0xc3, 0xea, 0xec, 0xc3, 0x26, 0xed, 0xc3, 0x15, 0xed, 0xc3, 0xa9, 0xef, 0xc3, 
-0xbb, 0xef, 0xc3, 0xb5, 0xef, 0xc3, 0xd3, 0xed, 0xc3, 0xb0, 0xed, 0xc3, 0x1d, 0xee, 0xc3, 0x66, 
-0xee, 0xc3, 0x7d, 0xee, 0xc3, 0x45, 0xef, 0xc3, 0xa2, 0xee, 0xc3, 0xc6, 0xef, 0xc3, 0xce, 0xef, 
-0xc3, 0xd8, 0xef, 0xc3, 0xd2, 0xef, 0xc3, 0xf2, 0xef, 0xc3, 0x16, 0xf0, 0xc3, 0x32, 0xf0, 0xc3, 
-0x5c, 0xf0, 0xc3, 0x85, 0xf0, 0xc3, 0xae, 0xf0, 0xc3, 0x13, 0xef, 0xc3, 0x46, 0xef, 0xc3, 0x76, 
-0xef, 0xc3, 0xb0, 0xec, 0xc3, 0xb6, 0xe1, 0xc3, 0xf1, 0xe1, 0xc3, 0x70, 0xe2, 0xc3, 0x77, 0xe2, 
-0xc3, 0x83, 0xe2, 0xc3, 0x8f, 0xe2, 0xc3, 0x98, 0xe2, 0xc3, 0x9f, 0xe2, 0xc3, 0xae, 0xe2, 0xc3, 
-0xb5, 0xe2, 0xc3, 0xbc, 0xe2, 0xc3, 0xd5, 0xe2, 0xc3, 0xe4, 0xe2, 0xc3, 0xec, 0xe2, 0xc3, 0xfb, 
-0xe2, 0xc3, 0xa, 0xe3, 0xc3, 0x13, 0xe3, 0xc3, 0x39, 0xe3, 0xc3, 0x40, 0xe3, 0xc3, 0x97, 0xe3, 
-0xc3, 0xb8, 0xe3, 0xc3, 0xd6, 0xe3, 0xc3, 0xfd, 0xe3, 0xc3, 0x3, 0xe4, 0xc3, 0x9a, 0xe4, 0xc3, 
-0xcd, 0xe4, 0xc3, 0xd3, 0xe4, 0xc3, 0xd9, 0xe4, 0xc3, 0x3c, 0xe5, 0xc3, 0x64, 0xe5, 0xc3, 0x72, 
-0xe5, 0xc3, 0x80, 0xe5, 0xc3, 0x87, 0xe5, 0xc3, 0x8e, 0xe5, 0xc3, 0xa4, 0xe5, 0xc3, 0xbd, 0xe5, 
-0xc3, 0x73, 0xe7, 0xc3, 0x8d, 0xe8, 0xc3, 0x45, 0xec, 0xc3, 0x9a, 0xff, 0xc3, 0xaa, 0xff, 0xc3, 
-0xb2, 0xff, 0xc3, 0xc6, 0xff, 0xc3, 0xd0, 0xff, 0xc3, 0xa1, 0xff, 0xc3, 0xb2, 0xff, 0xc3, 0xeb, 
-0xff, 0xc3, 0x24, 0xfb, 0xc3, 0x90, 0xff, 0xc3, 0x74, 0xfc, 0xc3, 0x57, 0xfc, 0xc3, 0xdc, 0xfa, 
-0xc3, 0xec, 0xfa, 0xc3, 0xf, 0xf3, 0xc3, 0xe4, 0xf3, 0xc3, 0x83, 0xf5, 0xc3, 0xb3, 0xf5, 0xc3, 
-0x9, 0xf2, 0xc3, 0xfb, 0xf1, 0xc3, 0xf4, 0xf1, 0xc3, 0x95, 0xf5, 0xc3, 0xe4, 0xf4, 0xc3, 0xb5, 
-0xf2, 0xc3, 0x7b, 0xf2, 0xc3, 0x4a, 0xf2, 0xc3, 0x8, 0xf3, 0xc3, 0x28, 0xf2, 0xc3, 0x89, 0xf7, 
-0xc3, 0x55, 0xfb, 0xc3, 0xcb, 0xf5, 0xc3, 0x54, 0xfb, 0xc3, 0xbc, 0xfb, 0xc3, 0xed, 0xfa, 0xc3, 
-0x83, 0xf7, 0xc3, 0xde, 0xfb, 0xc3, 0x4e, 0xfc, 0xc3, 0xaa, 0xf5, 0xc3, 0x9e, 0xf5, 0xc3, 0x8c, 
-0xf5, 0xc3, 0x30, 0xfb, 0xc3, 0x18, 0xfc, 0xc3, 0xbf, 0xf5, 0xc3, 0xa, 0xfb, 0xc3, 0x3d, 0xfb, 
-0xc3, 0x3e, 0xfb, 0xc3, 0x8, 0xfc, 0xc3, 0x6a, 0xfb, 0xc3, 0x44, 0xfc, 0xc3, 0x4f, 0xfc, 0xc3, 
-0xbd, 0xf2, 0xc3, 0x61, 0xff, 0xc3, 0x74, 0xff, 0xc3, 0xd4, 0xfb, 0xc3, 0x1d, 0xfc, 0xc3, 0xe4, 
-0xfa, 0xc3, 0xe6, 0xfb, 0xc3, 0x45, 0xfc, 0xc3, 0x2, 0xf2, 0xc3, 0xa6, 0xf2, 0xc3, 0xee, 0xfb, 
-0xc3, 0x6c, 0xfc, 0xc3, 0x1d, 0xfb, 0xc3, 0xa4, 0xf1, 0xc3, 0xb9, 0xf1, 0xc3, 0x87, 0xff, 0xc3, 
-0x8e, 0xfc, 0xc3, 0x8c, 0xfc, 0xc3, 0xf2, 0xf0, 0xc3, 0x7f, 0xf1, 0xc3, 0x2b, 0xf1, 0xc3, 0x50, 
-0xf1, 0xc3, 0xac, 0xfa, 0xc3, 0x58, 0xfa, 0xc3, 0x82, 0xfa, 0xc3, 0x94, 0xfc, 0xc3, 0x66, 0xf8, 
-0xc3, 0xb0, 0xfd, 0xc3, 0xe2, 0xfd, 0x21, 0x0, 0x0, 0x22, 0x64, 0x4, 0x22, 0x60, 0x4, 0x2a, 
-0x97, 0x1, 0x2b, 0x22, 0x62, 0x4, 0x2a, 0x97, 0x1, 0x22, 0x68, 0x4, 0xcd, 0xd4, 0xfb, 0x22, 
-0x6a, 0x4, 0x2a, 0x97, 0x1, 0x11, 0x1, 0x0, 0xeb, 0xcd, 0xee, 0xfb, 0x22, 0x70, 0x4, 0x2a, 
-0x99, 0x1, 0x22, 0x78, 0x4, 0x2b, 0x11, 0x1, 0x0, 0xeb, 0xcd, 0xee, 0xfb, 0x22, 0x72, 0x4, 
-0xc9, 0xcd, 0x98, 0xe2, 0x11, 0x1, 0x0, 0xcd, 0x24, 0xfb, 0x28, 0x15, 0x2a, 0x99, 0x1, 0xeb, 
-0x2a, 0x8d, 0x1, 0xcd, 0xa, 0xfb, 0xe5, 0xcd, 0xae, 0xe2, 0x2b, 0xd1, 0xcd, 0xbc, 0xfb, 0x18, 
-0x3, 0x2a, 0x99, 0x1, 0x22, 0x78, 0x4, 0x2a, 0x5e, 0x4, 0x11, 0x1, 0x0, 0xcd, 0x24, 0xfb, 
-0x28, 0xd, 0x2a, 0x8d, 0x1, 0xe5, 0xcd, 0xae, 0xe2, 0xe5, 0xcd, 0xb0, 0xed, 0xd1, 0xd1, 0xcd, 
-0x98, 0xe2, 0x11, 0x1, 0x0, 0xcd, 0x24, 0xfb, 0x28, 0x5, 0xcd, 0xae, 0xe2, 0x18, 0x3, 0x21, 
-0x0, 0x0, 0xe5, 0xcd, 0x26, 0xed, 0xd1, 0x2a, 0x78, 0x4, 0x2b, 0x22, 0x66, 0x4, 0x2a, 0x78, 
-0x4, 0x22, 0x6c, 0x4, 0xcd, 0xd4, 0xfb, 0x22, 0x6e, 0x4, 0xcd, 0xff, 0xeb, 0x28, 0x3, 0xcd, 
-0xc4, 0xe5, 0x2a, 0x5e, 0x4, 0x11, 0x2, 0x0, 0xcd, 0x24, 0xfb, 0xc8, 0xcd, 0x3, 0xe4, 0xc9, 
-0x2a, 0x5c, 0x4, 0x22, 0x5e, 0x4, 0xc9, 0xcd, 0x70, 0xe2, 0x21, 0x0, 0x0, 0x22, 0x5c, 0x4, 
-0xc3, 0xf1, 0xe1, 0xcd, 0x70, 0xe2, 0x21, 0x1, 0x0, 0x22, 0x5c, 0x4, 0xc3, 0xf1, 0xe1, 0x21, 
-0x2, 0x0, 0x22, 0x5c, 0x4, 0xc3, 0x15, 0xed, 0xcd, 0x90, 0xff, 0x2a, 0x5c, 0x4, 0xc9, 0xcd, 
-0x90, 0xff, 0x21, 0x8, 0x0, 0x39, 0x5e, 0x23, 0x56, 0xeb, 0x22, 0x5a, 0x4, 0xc9, 0xcd, 0x90, 
-0xff, 0x2a, 0x5a, 0x4, 0xc9, 0xcd, 0x90, 0xff, 0x2a, 0x58, 0x4, 0xc9, 0xcd, 0x90, 0xff, 0xcd, 
-0x73, 0xe7, 0x21, 0x8, 0x0, 0x39, 0x5e, 0x23, 0x56, 0xeb, 0x22, 0x58, 0x4, 0xe5, 0xcd, 0x45, 
-0xef, 0xd1, 0xc3, 0x73, 0xe7, 0x21, 0x1, 0x0, 0x7d, 0x32, 0x55, 0x4, 0xcd, 0x39, 0xe3, 0x7d, 
-0x32, 0x54, 0x4, 0xc9, 0x21, 0x0, 0x0, 0x7d, 0x32, 0x55, 0x4, 0xc9, 0x21, 0x3, 0x0, 0x7d, 
-0x32, 0x55, 0x4, 0xcd, 0xb5, 0xe2, 0x7d, 0x32, 0x54, 0x4, 0xc9, 0x21, 0x2, 0x0, 0x7d, 0x32, 
-0x55, 0x4, 0xcd, 0x39, 0xe3, 0x7d, 0x32, 0x54, 0x4, 0xc9, 0xcd, 0x90, 0xff, 0x2a, 0x55, 0x4, 
-0x26, 0x0, 0xc9, 0xcd, 0x90, 0xff, 0xcd, 0x73, 0xe7, 0x21, 0x8, 0x0, 0x39, 0x5e, 0x23, 0x56, 
-0xeb, 0x22, 0x56, 0x4, 0xcd, 0x73, 0xe7, 0xcd, 0xa, 0xe3, 0x11, 0x3, 0x0, 0xcd, 0x24, 0xfb, 
-0xc0, 0x2a, 0x56, 0x4, 0x7d, 0x32, 0x54, 0x4, 0xc9, 0xcd, 0x90, 0xff, 0x2a, 0x56, 0x4, 0xc9, 
-0xcd, 0x90, 0xff, 0x21, 0xf3, 0x1, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0xcd, 0xb0, 0xfd, 0xcd, 
-0x87, 0xff, 0x21, 0x8, 0x0, 0x39, 0xcd, 0xfb, 0xf1, 0xcd, 0xe4, 0xf4, 0x21, 0xe7, 0x1, 0xcd, 
-0xfb, 0xf1, 0xcd, 0xf, 0xf3, 0xcd, 0x4a, 0xf2, 0x21, 0xf3, 0x1, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 
-0xf2, 0xcd, 0xe2, 0xfd, 0xcd, 0x87, 0xff, 0x21, 0x10, 0x0, 0x39, 0xcd, 0xfb, 0xf1, 0xcd, 0xe4, 
-0xf4, 0x21, 0xdf, 0x1, 0xcd, 0xfb, 0xf1, 0xcd, 0xf, 0xf3, 0xcd, 0x4a, 0xf2, 0xcd, 0x8d, 0xe8, 
-0xeb, 0x21, 0x10, 0x0, 0x39, 0xf9, 0xc9, 0xcd, 0x90, 0xff, 0x21, 0x10, 0x0, 0x39, 0xcd, 0x9, 
-0xf2, 0xcd, 0x4a, 0xf2, 0x21, 0x10, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0xcd, 0x8d, 
-0xe8, 0xeb, 0x21, 0x10, 0x0, 0x39, 0xf9, 0xc9, 0xcd, 0x90, 0xff, 0x21, 0xf3, 0x1, 0xcd, 0x9, 
-0xf2, 0x21, 0x8, 0x0, 0x39, 0xcd, 0xfb, 0xf1, 0xcd, 0xf, 0xf3, 0xcd, 0x4a, 0xf2, 0xcd, 0xd6, 
-0xe3, 0xeb, 0xcd, 0x87, 0xff, 0xc9, 0xcd, 0x90, 0xff, 0xcd, 0x73, 0xe7, 0x21, 0xf3, 0x1, 0xe5, 
-0x21, 0xa, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0xcd, 0x45, 0xec, 0xcd, 0x87, 0xff, 
-0xe1, 0xcd, 0x28, 0xf2, 0xcd, 0x89, 0xf7, 0x22, 0xfb, 0x1, 0xc3, 0x73, 0xe7, 0x21, 0xf3, 0x1, 
-0xc3, 0x9, 0xf2, 0x2a, 0x66, 0x4, 0xe5, 0x2a, 0x58, 0x4, 0xe5, 0xcd, 0xa2, 0xee, 0xd1, 0xd1, 
-0xc3, 0x73, 0xe7, 0xcd, 0x90, 0xff, 0x21, 0x10, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 
-0xcd, 0x2, 0xe7, 0xcd, 0x87, 0xff, 0xcd, 0x4a, 0xf2, 0x21, 0x10, 0x0, 0x39, 0xcd, 0x9, 0xf2, 
-0xcd, 0x4a, 0xf2, 0xcd, 0x2, 0xe7, 0xcd, 0x87, 0xff, 0xcd, 0x4a, 0xf2, 0xcd, 0xd9, 0xe4, 0xeb, 
-0x21, 0x10, 0x0, 0x39, 0xf9, 0x2a, 0x76, 0x4, 0xe5, 0x2a, 0x74, 0x4, 0xe5, 0xcd, 0x1c, 0xec, 
-0xd1, 0xd1, 0xcd, 0xff, 0xeb, 0x28, 0x42, 0x2a, 0x97, 0x1, 0xed, 0x5b, 0x74, 0x4, 0xcd, 0x6a, 
-0xfb, 0x22, 0x74, 0x4, 0x11, 0x0, 0x0, 0xeb, 0xcd, 0x54, 0xfb, 0x28, 0xb, 0x2a, 0x97, 0x1, 
-0xeb, 0x2a, 0x74, 0x4, 0x19, 0x22, 0x74, 0x4, 0x2a, 0x78, 0x4, 0xed, 0x5b, 0x76, 0x4, 0xcd, 
-0x6a, 0xfb, 0x22, 0x76, 0x4, 0x11, 0x0, 0x0, 0xeb, 0xcd, 0x54, 0xfb, 0x28, 0xb, 0x2a, 0x78, 
-0x4, 0xeb, 0x2a, 0x76, 0x4, 0x19, 0x22, 0x76, 0x4, 0xc9, 0xcd, 0x90, 0xff, 0x21, 0x10, 0x0, 
-0x39, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0x21, 0x10, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 
-0xf2, 0xcd, 0x13, 0xe4, 0xeb, 0x21, 0x10, 0x0, 0x39, 0xf9, 0x2a, 0x54, 0x4, 0xe5, 0x2a, 0x76, 
-0x4, 0xe5, 0x2a, 0x74, 0x4, 0xe5, 0xcd, 0xda, 0xec, 0xd1, 0xd1, 0xd1, 0xc9, 0x21, 0xdf, 0x1, 
-0xc3, 0x9, 0xf2, 0x21, 0xe7, 0x1, 0xc3, 0x9, 0xf2, 0xcd, 0xed, 0xfa, 0xf0, 0xff, 0x21, 0x18, 
-0x0, 0x39, 0xe5, 0x2a, 0x70, 0x4, 0xcd, 0xcb, 0xf5, 0xcd, 0xa6, 0xf2, 0xe1, 0xe5, 0xcd, 0x9, 
-0xf2, 0xcd, 0xf, 0xf3, 0xe1, 0xcd, 0x28, 0xf2, 0x21, 0x20, 0x0, 0x39, 0xe5, 0x2a, 0x72, 0x4, 
-0xcd, 0xcb, 0xf5, 0x21, 0x22, 0x0, 0x39, 0xcd, 0xfb, 0xf1, 0xcd, 0x8, 0xf3, 0xe1, 0xcd, 0x28, 
-0xf2, 0x21, 0x18, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0xcd, 0xc8, 0xe6, 0xeb, 0xcd, 
-0x87, 0xff, 0xeb, 0x22, 0x74, 0x4, 0x21, 0x20, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 
-0xcd, 0xc8, 0xe6, 0xeb, 0xcd, 0x87, 0xff, 0xeb, 0x22, 0x76, 0x4, 0xc9, 0x21, 0xe7, 0x1, 0xcd, 
-0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0x21, 0xdf, 0x1, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0xcd, 0xd9, 
-0xe4, 0xeb, 0x21, 0x10, 0x0, 0x39, 0xf9, 0x2a, 0x74, 0x4, 0x22, 0xef, 0x1, 0x2a, 0x76, 0x4, 
-0x22, 0xf1, 0x1, 0xc9, 0xcd, 0x80, 0xe5, 0xc8, 0xcd, 0x73, 0xe7, 0x21, 0x0, 0x0, 0x22, 0xfd, 
-0x1, 0xc9, 0xcd, 0x80, 0xe5, 0xc0, 0x21, 0x1, 0x0, 0x22, 0xfd, 0x1, 0xcd, 0x73, 0xe7, 0xc9, 
-0xcd, 0x90, 0xff, 0x2a, 0xfd, 0x1, 0xc9, 0x21, 0x0, 0x0, 0x22, 0xff, 0x1, 0xc9, 0xcd, 0x73, 
-0xe7, 0x21, 0x1, 0x0, 0x22, 0xff, 0x1, 0x2a, 0x78, 0x4, 0x7c, 0xb5, 0x28, 0x3, 0xcd, 0xc4, 
-0xe5, 0xc3, 0x73, 0xe7, 0x2a, 0xf1, 0x1, 0xe5, 0x2a, 0xef, 0x1, 0xe5, 0xcd, 0xb0, 0xec, 0xd1, 
-0xd1, 0x28, 0x3, 0xcd, 0x51, 0x4, 0x21, 0x2, 0x0, 0x22, 0xff, 0x1, 0xc9, 0xcd, 0x90, 0xff, 
-0x2a, 0xff, 0x1, 0xc9, 0x18, 0x3, 0xcd, 0x3c, 0xe5, 0x2a, 0xef, 0x1, 0x11, 0x0, 0x0, 0xeb, 
-0xcd, 0x54, 0xfb, 0x28, 0x30, 0x21, 0xe7, 0x1, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0x21, 0xdf, 
-0x1, 0xe5, 0x2a, 0x97, 0x1, 0xcd, 0xcb, 0xf5, 0xcd, 0xa6, 0xf2, 0xe1, 0xe5, 0xcd, 0x9, 0xf2, 
-0xcd, 0xf, 0xf3, 0xe1, 0xcd, 0x28, 0xf2, 0xcd, 0x4a, 0xf2, 0xcd, 0xd9, 0xe4, 0xeb, 0x21, 0x10, 
-0x0, 0x39, 0xf9, 0x18, 0xc1, 0x18, 0x3, 0xcd, 0x3c, 0xe5, 0x2a, 0xef, 0x1, 0xeb, 0x2a, 0x97, 
-0x1, 0xcd, 0x3d, 0xfb, 0x28, 0x30, 0x21, 0xe7, 0x1, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0x21, 
-0xdf, 0x1, 0xe5, 0x2a, 0x97, 0x1, 0xcd, 0xcb, 0xf5, 0xcd, 0xa6, 0xf2, 0xe1, 0xe5, 0xcd, 0x9, 
-0xf2, 0xcd, 0x8, 0xf3, 0xe1, 0xcd, 0x28, 0xf2, 0xcd, 0x4a, 0xf2, 0xcd, 0xd9, 0xe4, 0xeb, 0x21, 
-0x10, 0x0, 0x39, 0xf9, 0x18, 0xc1, 0x18, 0x3, 0xcd, 0x3c, 0xe5, 0x2a, 0xf1, 0x1, 0x11, 0x0, 
-0x0, 0xeb, 0xcd, 0x54, 0xfb, 0x28, 0x30, 0x21, 0xe7, 0x1, 0xe5, 0x2a, 0x78, 0x4, 0xcd, 0xcb, 
-0xf5, 0xcd, 0xa6, 0xf2, 0xe1, 0xe5, 0xcd, 0x9, 0xf2, 0xcd, 0x8, 0xf3, 0xe1, 0xcd, 0x28, 0xf2, 
-0xcd, 0x4a, 0xf2, 0x21, 0xdf, 0x1, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0xcd, 0xd9, 0xe4, 0xeb, 
-0x21, 0x10, 0x0, 0x39, 0xf9, 0x18, 0xc1, 0x18, 0x3, 0xcd, 0x3c, 0xe5, 0x2a, 0xf1, 0x1, 0xeb, 
-0x2a, 0x78, 0x4, 0xcd, 0x3d, 0xfb, 0xc8, 0x21, 0xe7, 0x1, 0xe5, 0x2a, 0x78, 0x4, 0xcd, 0xcb, 
-0xf5, 0xcd, 0xa6, 0xf2, 0xe1, 0xe5, 0xcd, 0x9, 0xf2, 0xcd, 0xf, 0xf3, 0xe1, 0xcd, 0x28, 0xf2, 
-0xcd, 0x4a, 0xf2, 0x21, 0xdf, 0x1, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0xcd, 0xd9, 0xe4, 0xeb, 
-0x21, 0x10, 0x0, 0x39, 0xf9, 0x18, 0xc2, 0xc9, 0xcd, 0x90, 0xff, 0x21, 0x8, 0x0, 0x39, 0xcd, 
-0x9, 0xf2, 0x21, 0xcf, 0x1, 0xcd, 0xfb, 0xf1, 0xcd, 0xaa, 0xf5, 0x28, 0xd, 0xcd, 0x2, 0xf2, 
-0x40, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xb, 0xcd, 0x2, 0xf2, 0xc0, 0x7f, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xb8, 0x21, 0x8, 0x0, 0x39, 0xcd, 0xfb, 0xf1, 0xcd, 0xf, 0xf3, 0xc3, 
-0x89, 0xf7, 0xcd, 0x90, 0xff, 0x21, 0x8, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0xf4, 0xf1, 0xc2, 
-0x3e, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0xaa, 0xf5, 0x28, 0x1e, 0x21, 0x8, 0x0, 0x39, 
-0xcd, 0x9, 0xf2, 0xcd, 0xf4, 0xf1, 0x42, 0x3e, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x9e, 
-0xf5, 0x28, 0x7, 0x21, 0x8, 0x0, 0x39, 0xc3, 0x9, 0xf2, 0xc3, 0x51, 0x4, 0xcd, 0x90, 0xff, 
-0x21, 0x8, 0x0, 0x39, 0x4e, 0x23, 0x46, 0x60, 0x69, 0x11, 0x80, 0x0, 0xcd, 0xdc, 0xfa, 0x28, 
-0xa, 0x21, 0x0, 0xff, 0x50, 0x59, 0xcd, 0xe6, 0xfb, 0x44, 0x4d, 0x21, 0xa, 0x0, 0x39, 0x5e, 
-0x23, 0x56, 0x21, 0x2, 0x0, 0xcd, 0xdc, 0xfa, 0x28, 0x6, 0x60, 0x69, 0xcd, 0xd4, 0xfb, 0xc9, 
-0x60, 0x69, 0xc9, 0xcd, 0x90, 0xff, 0xcd, 0x80, 0xe5, 0xc8, 0xcd, 0x39, 0xe3, 0x7d, 0x32, 0x1, 
-0x2, 0x2a, 0xfb, 0x1, 0x23, 0x23, 0x23, 0x11, 0x6, 0x0, 0xeb, 0xcd, 0xa, 0xfb, 0x11, 0xf, 
-0x0, 0xeb, 0xcd, 0x6a, 0xfb, 0x22, 0x9c, 0x4, 0x2a, 0xfb, 0x1, 0x23, 0x23, 0x23, 0x11, 0x5a, 
-0x0, 0xeb, 0xcd, 0xa, 0xfb, 0x22, 0x9a, 0x4, 0x11, 0x1, 0x0, 0xcd, 0xdc, 0xfa, 0x28, 0xc, 
-0x2a, 0x9c, 0x4, 0x11, 0xf, 0x0, 0xcd, 0x6c, 0xfc, 0x22, 0x9c, 0x4, 0x2a, 0x9c, 0x4, 0x11, 
-0x6, 0x0, 0xcd, 0xbc, 0xfb, 0x11, 0x28, 0x1, 0x19, 0x22, 0x98, 0x4, 0x2a, 0xef, 0x1, 0x22, 
-0x88, 0x4, 0x2a, 0xf1, 0x1, 0x22, 0x8a, 0x4, 0x21, 0x8c, 0x4, 0x44, 0x4d, 0x18, 0x8, 0x21, 
-0x4, 0x0, 0x50, 0x59, 0x19, 0x44, 0x4d, 0x50, 0x59, 0x21, 0x98, 0x4, 0xcd, 0x4e, 0xfc, 0x28, 
-0x7b, 0x21, 0xfc, 0xff, 0x9, 0x5e, 0x23, 0x56, 0xeb, 0x22, 0x7a, 0x4, 0x21, 0xfe, 0xff, 0x9, 
-0x5e, 0x23, 0x56, 0xeb, 0x22, 0x7c, 0x4, 0x2a, 0x9a, 0x4, 0xe5, 0x2a, 0x98, 0x4, 0x23, 0x22, 
-0x98, 0x4, 0x5e, 0x16, 0x0, 0xd5, 0xcd, 0x3d, 0xe7, 0xd1, 0xd1, 0xeb, 0x2a, 0x88, 0x4, 0x19, 
-0xeb, 0x60, 0x69, 0x73, 0x23, 0x72, 0xeb, 0x22, 0x7e, 0x4, 0x2a, 0x9a, 0x4, 0x23, 0xe5, 0x2a, 
-0x98, 0x4, 0x23, 0x22, 0x98, 0x4, 0x5e, 0x16, 0x0, 0xd5, 0xcd, 0x3d, 0xe7, 0xd1, 0xd1, 0xeb, 
-0x2a, 0x8a, 0x4, 0x19, 0xeb, 0x21, 0x2, 0x0, 0x9, 0x73, 0x23, 0x72, 0xeb, 0x22, 0x80, 0x4, 
-0x2a, 0x1, 0x2, 0xe5, 0x2a, 0x80, 0x4, 0xe5, 0x2a, 0x7e, 0x4, 0xe5, 0xcd, 0xda, 0xec, 0xd1, 
-0xd1, 0x2a, 0x1, 0x2, 0xe3, 0xcd, 0xb0, 0xe9, 0xd1, 0xc3, 0xdf, 0xe7, 0x2a, 0x94, 0x4, 0x22, 
-0x7a, 0x4, 0x2a, 0x96, 0x4, 0x22, 0x7c, 0x4, 0x2a, 0x88, 0x4, 0x22, 0x7e, 0x4, 0x2a, 0x8a, 
-0x4, 0x22, 0x80, 0x4, 0x2a, 0x1, 0x2, 0xe5, 0xcd, 0xb0, 0xe9, 0xd1, 0xc9, 0xcd, 0x90, 0xff, 
-0x21, 0x10, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0xcd, 0x2, 0xe7, 0xcd, 0x87, 0xff, 
-0xcd, 0x4a, 0xf2, 0x21, 0x10, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0xcd, 0x2, 0xe7, 
-0xcd, 0x87, 0xff, 0xcd, 0x4a, 0xf2, 0xcd, 0xd9, 0xe4, 0xeb, 0x21, 0x10, 0x0, 0x39, 0xf9, 0x2a, 
-0x76, 0x4, 0xe5, 0x2a, 0x74, 0x4, 0xe5, 0xcd, 0x1c, 0xec, 0xd1, 0xd1, 0xcd, 0x73, 0xe7, 0x2a, 
-0xef, 0x1, 0x22, 0x7a, 0x4, 0x2a, 0xf1, 0x1, 0x22, 0x7c, 0x4, 0x2a, 0x74, 0x4, 0x22, 0xef, 
-0x1, 0x22, 0x7e, 0x4, 0x2a, 0x76, 0x4, 0x22, 0xf1, 0x1, 0x22, 0x80, 0x4, 0x21, 0xdf, 0x1, 
-0xe5, 0x21, 0xa, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xe1, 0xcd, 0x28, 0xf2, 0x21, 0xe7, 0x1, 0xe5, 
-0x21, 0x12, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xe1, 0xcd, 0x28, 0xf2, 0xcd, 0xff, 0xeb, 0xca, 0xa0, 
-0xe9, 0xcd, 0xa, 0xe3, 0xca, 0x9b, 0xe9, 0x2a, 0x54, 0x4, 0xe5, 0xcd, 0xb0, 0xe9, 0xd1, 0x22, 
-0x9e, 0x4, 0x11, 0x1, 0x0, 0xeb, 0xcd, 0xee, 0xfb, 0x44, 0x4d, 0x2a, 0x76, 0x4, 0xe5, 0x2a, 
-0x74, 0x4, 0xe5, 0xcd, 0xb0, 0xec, 0xd1, 0xd1, 0x28, 0x61, 0x2a, 0x7e, 0x4, 0x22, 0x7a, 0x4, 
-0x2a, 0x80, 0x4, 0x22, 0x7c, 0x4, 0x2a, 0x9e, 0x4, 0x29, 0x11, 0x68, 0x4, 0x19, 0x5e, 0x23, 
-0x56, 0xd5, 0x21, 0x7a, 0x4, 0x9, 0x9, 0xd1, 0xe5, 0x7e, 0x23, 0x66, 0x6f, 0x19, 0xeb, 0xe1, 
-0x73, 0x23, 0x72, 0x2a, 0x74, 0x4, 0x22, 0x7e, 0x4, 0x2a, 0x76, 0x4, 0x22, 0x80, 0x4, 0x2a, 
-0x9e, 0x4, 0x29, 0x11, 0x68, 0x4, 0x19, 0x5e, 0x23, 0x56, 0xd5, 0x21, 0x7e, 0x4, 0x9, 0x9, 
-0xd1, 0xe5, 0x7e, 0x23, 0x66, 0x6f, 0x19, 0xeb, 0xe1, 0x73, 0x23, 0x72, 0x2a, 0x7e, 0x4, 0x22, 
-0x74, 0x4, 0x2a, 0x80, 0x4, 0x22, 0x76, 0x4, 0xc3, 0x17, 0xe9, 0xcd, 0xc4, 0xe5, 0x18, 0xd, 
-0xcd, 0xa, 0xe3, 0x28, 0x8, 0x2a, 0x54, 0x4, 0xe5, 0xcd, 0xb0, 0xe9, 0xd1, 0xc3, 0x73, 0xe7, 
-0xcd, 0x90, 0xff, 0x21, 0xff, 0xff, 0x22, 0x86, 0x4, 0x22, 0x84, 0x4, 0x22, 0xa2, 0x4, 0x21, 
-0x0, 0x0, 0x22, 0x82, 0x4, 0x21, 0xff, 0xff, 0x22, 0xa0, 0x4, 0x2a, 0xa0, 0x4, 0x23, 0x22, 
-0xa0, 0x4, 0x11, 0x2, 0x0, 0xeb, 0xcd, 0x54, 0xfb, 0xca, 0x57, 0xea, 0x21, 0xff, 0xff, 0x44, 
-0x4d, 0x3, 0x60, 0x69, 0x11, 0x2, 0x0, 0xeb, 0xcd, 0x54, 0xfb, 0x28, 0x67, 0x60, 0x69, 0x29, 
-0x29, 0x11, 0x60, 0x4, 0x19, 0x5e, 0x23, 0x56, 0xd5, 0x60, 0x69, 0x29, 0xe5, 0x2a, 0xa0, 0x4, 
-0x29, 0x29, 0xd1, 0x19, 0x11, 0x7a, 0x4, 0x19, 0x5e, 0x23, 0x56, 0xeb, 0x22, 0xa4, 0x4, 0xd1, 
-0xeb, 0xcd, 0x54, 0xfb, 0x28, 0x14, 0x21, 0x0, 0x0, 0xe5, 0xc5, 0x2a, 0xa0, 0x4, 0xe5, 0xcd, 
-0xa1, 0xea, 0xd1, 0xd1, 0xd1, 0x22, 0xa2, 0x4, 0x18, 0x28, 0x60, 0x69, 0x29, 0x29, 0x11, 0x62, 
-0x4, 0x19, 0x5e, 0x23, 0x56, 0xd5, 0x2a, 0xa4, 0x4, 0xd1, 0xeb, 0xcd, 0x55, 0xfb, 0x28, 0x12, 
-0x21, 0x1, 0x0, 0xe5, 0xc5, 0x2a, 0xa0, 0x4, 0xe5, 0xcd, 0xa1, 0xea, 0xd1, 0xd1, 0xd1, 0x22, 
-0xa2, 0x4, 0x18, 0x8d, 0xc3, 0xcb, 0xe9, 0x2a, 0x82, 0x4, 0x7c, 0xb5, 0x20, 0x3f, 0x2a, 0x7c, 
-0x4, 0xe5, 0x2a, 0x7a, 0x4, 0xe5, 0xcd, 0xb0, 0xec, 0xd1, 0xd1, 0x20, 0x30, 0x2a, 0x80, 0x4, 
-0xe5, 0x2a, 0x7e, 0x4, 0xe5, 0xcd, 0xb0, 0xec, 0xd1, 0xd1, 0x20, 0x21, 0x21, 0x8, 0x0, 0x39, 
-0x5e, 0x23, 0x56, 0xd5, 0x2a, 0x80, 0x4, 0xe5, 0x2a, 0x7e, 0x4, 0xe5, 0x2a, 0x7c, 0x4, 0xe5, 
-0x2a, 0x7a, 0x4, 0xe5, 0xcd, 0x7d, 0xee, 0xeb, 0x21, 0xa, 0x0, 0x39, 0xf9, 0x2a, 0xa2, 0x4, 
-0xc9, 0xcd, 0x90, 0xff, 0x21, 0xa, 0x0, 0x39, 0x4e, 0x23, 0x46, 0x21, 0x8, 0x0, 0x39, 0x5e, 
-0x23, 0x56, 0xeb, 0x22, 0xa8, 0x4, 0x60, 0x69, 0x29, 0xe5, 0x2a, 0xa8, 0x4, 0x11, 0x1, 0x0, 
-0xcd, 0x18, 0xfc, 0x29, 0x29, 0xd1, 0x19, 0x11, 0x7a, 0x4, 0x19, 0x5e, 0x23, 0x56, 0xd5, 0x60, 
-0x69, 0x29, 0xe5, 0x2a, 0xa8, 0x4, 0x29, 0x29, 0xd1, 0x19, 0x11, 0x7a, 0x4, 0x19, 0x5e, 0x23, 
-0x56, 0xe1, 0xcd, 0x18, 0xfc, 0x22, 0xaa, 0x4, 0x7c, 0xb5, 0xca, 0xa7, 0xeb, 0x2a, 0xaa, 0x4, 
-0xcd, 0xcb, 0xf5, 0xcd, 0x4a, 0xf2, 0x21, 0x1, 0x0, 0x50, 0x59, 0xeb, 0xcd, 0x18, 0xfc, 0x29, 
-0xe5, 0x2a, 0xa8, 0x4, 0x29, 0x29, 0xd1, 0x19, 0x11, 0x7a, 0x4, 0x19, 0x5e, 0x23, 0x56, 0xd5, 
-0x21, 0x1, 0x0, 0x50, 0x59, 0xeb, 0xcd, 0x18, 0xfc, 0x29, 0xe5, 0x2a, 0xa8, 0x4, 0x11, 0x1, 
-0x0, 0xcd, 0x18, 0xfc, 0x29, 0x29, 0xd1, 0x19, 0x11, 0x7a, 0x4, 0x19, 0x5e, 0x23, 0x56, 0xe1, 
-0xcd, 0x18, 0xfc, 0xcd, 0xcb, 0xf5, 0xcd, 0x4a, 0xf2, 0x21, 0x1c, 0x0, 0x39, 0x5e, 0x23, 0x56, 
-0xeb, 0x29, 0xe5, 0x60, 0x69, 0x29, 0x29, 0xd1, 0x19, 0x11, 0x60, 0x4, 0x19, 0x5e, 0x23, 0x56, 
-0xeb, 0x22, 0xac, 0x4, 0xe5, 0x60, 0x69, 0x29, 0xe5, 0x2a, 0xa8, 0x4, 0x29, 0x29, 0xd1, 0x19, 
-0x11, 0x7a, 0x4, 0x19, 0x5e, 0x23, 0x56, 0xe1, 0xcd, 0x18, 0xfc, 0xcd, 0xcb, 0xf5, 0xcd, 0x7b, 
-0xf2, 0xcd, 0xe4, 0xf4, 0xcd, 0x7b, 0xf2, 0xcd, 0xe4, 0xf3, 0xcd, 0x4a, 0xf2, 0xcd, 0xc8, 0xe6, 
-0xeb, 0xcd, 0x87, 0xff, 0xd5, 0x21, 0x1, 0x0, 0x50, 0x59, 0xeb, 0xcd, 0x18, 0xfc, 0x29, 0xe5, 
-0x2a, 0xa8, 0x4, 0x29, 0x29, 0xd1, 0x19, 0x11, 0x7a, 0x4, 0x19, 0xd1, 0xe5, 0x7e, 0x23, 0x66, 
-0x6f, 0x19, 0xeb, 0xe1, 0x73, 0x23, 0x72, 0x2a, 0xac, 0x4, 0xe5, 0x60, 0x69, 0x29, 0xe5, 0x2a, 
-0xa8, 0x4, 0x29, 0x29, 0xd1, 0x19, 0x11, 0x7a, 0x4, 0x19, 0xd1, 0x73, 0x23, 0x72, 0x60, 0x69, 
-0x29, 0xeb, 0x21, 0xc, 0x0, 0x39, 0x7e, 0x23, 0x66, 0x6f, 0x19, 0x22, 0xa6, 0x4, 0xeb, 0x2a, 
-0x84, 0x4, 0xcd, 0x24, 0xfb, 0x28, 0x6, 0x21, 0x1, 0x0, 0x22, 0x82, 0x4, 0x2a, 0xa6, 0x4, 
-0xeb, 0x2a, 0x86, 0x4, 0xcd, 0x24, 0xfb, 0x28, 0x6, 0x21, 0x1, 0x0, 0x22, 0x82, 0x4, 0x2a, 
-0x84, 0x4, 0x22, 0x86, 0x4, 0x2a, 0xa6, 0x4, 0x22, 0x84, 0x4, 0x2a, 0xa6, 0x4, 0xc9, 0xcd, 
-0x90, 0xff, 0x2a, 0xff, 0x1, 0x11, 0x1, 0x0, 0xcd, 0x24, 0xfb, 0x28, 0x7, 0x2a, 0x78, 0x4, 
-0x7c, 0xb5, 0x20, 0x4, 0x21, 0x0, 0x0, 0xc9, 0x21, 0x1, 0x0, 0xc9, 0xcd, 0x90, 0xff, 0x2a, 
-0xff, 0x1, 0x11, 0x2, 0x0, 0xcd, 0x24, 0xfb, 0x28, 0x1a, 0x21, 0xa, 0x0, 0x39, 0x5e, 0x23, 
-0x56, 0xd5, 0x21, 0xa, 0x0, 0x39, 0x5e, 0x23, 0x56, 0xd5, 0xcd, 0xb0, 0xec, 0xd1, 0xd1, 0x28, 
-0x3, 0xcd, 0x51, 0x4, 0xc9, 0xcd, 0x90, 0xff, 0x21, 0x8, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0x21, 
-0xc7, 0x1, 0xcd, 0xfb, 0xf1, 0xcd, 0xaa, 0xf5, 0x28, 0x1c, 0x21, 0x8, 0x0, 0x39, 0xe5, 0x21, 
-0xc7, 0x1, 0xcd, 0x9, 0xf2, 0xcd, 0xa6, 0xf2, 0xe1, 0xe5, 0xcd, 0x9, 0xf2, 0xcd, 0x8, 0xf3, 
-0xe1, 0xcd, 0x28, 0xf2, 0x18, 0xd2, 0x21, 0x8, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0xf4, 0xf1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x95, 0xf5, 0x28, 0x1c, 0x21, 0x8, 0x0, 
-0x39, 0xe5, 0x21, 0xc7, 0x1, 0xcd, 0x9, 0xf2, 0xcd, 0xa6, 0xf2, 0xe1, 0xe5, 0xcd, 0x9, 0xf2, 
-0xcd, 0xf, 0xf3, 0xe1, 0xcd, 0x28, 0xf2, 0x18, 0xcd, 0x21, 0x8, 0x0, 0x39, 0xc3, 0x9, 0xf2, 
-0xc5, 0x21, 0x4, 0x0, 0x39, 0x5e, 0x23, 0x56, 0x23, 0x4e, 0x23, 0x46, 0x2a, 0x66, 0x4, 0x7c, 
-0x17, 0x38, 0x11, 0xed, 0x42, 0x38, 0xd, 0x2a, 0x62, 0x4, 0xed, 0x52, 0x38, 0x6, 0xc1, 0x21, 
-0x0, 0x0, 0xa5, 0xc9, 0xc1, 0x21, 0x1, 0x0, 0xb5, 0xc9, 0xe1, 0x22, 0xae, 0x4, 0xcd, 0xb0, 
-0xec, 0x20, 0x3, 0xcd, 0x66, 0xee, 0x2a, 0xae, 0x4, 0xe9, 0x3a, 0x49, 0x0, 0xcd, 0x9b, 0xbe, 
-0xe, 0xbc, 0x3a, 0x4a, 0x0, 0xcd, 0x9b, 0xbe, 0x9e, 0xbe, 0xc7, 0xaf, 0x32, 0x48, 0x0, 0x3d, 
-0x32, 0x40, 0x0, 0xcd, 0x9b, 0xbe, 0x11, 0xbc, 0x32, 0x49, 0x0, 0xaf, 0xcd, 0x9b, 0xbe, 0x9e, 
-0xbe, 0x32, 0x4a, 0x0, 0xc9, 0xc5, 0x3a, 0xb8, 0x1, 0xcd, 0x34, 0xee, 0x3e, 0x81, 0x32, 0x40, 
-0x0, 0xcd, 0x50, 0xee, 0xc1, 0xc9, 0xc5, 0x21, 0x4, 0x0, 0x39, 0x3a, 0x40, 0x0, 0xbe, 0xca, 
-0xae, 0xed, 0xe5, 0xf5, 0xcd, 0x43, 0xee, 0xf1, 0xb7, 0x3a, 0xb7, 0x1, 0xfc, 0x34, 0xee, 0xcd, 
-0x9b, 0xbe, 0x78, 0xbb, 0x3a, 0x40, 0x0, 0xe6, 0x7f, 0x3d, 0x85, 0x6f, 0xe3, 0x7e, 0x32, 0x40, 
-0x0, 0xd6, 0x1, 0x6f, 0xd2, 0x59, 0xed, 0x2e, 0x18, 0x3a, 0x47, 0x0, 0x67, 0x16, 0x0, 0x1e, 
-0x18, 0xcd, 0x9b, 0xbe, 0x66, 0xbb, 0xe1, 0xcd, 0x24, 0xee, 0x21, 0xc7, 0x0, 0x22, 0x4b, 0x0, 
-0x21, 0x0, 0x0, 0x11, 0x8f, 0x1, 0x3a, 0x40, 0x0, 0xb7, 0xca, 0x8c, 0xed, 0x6f, 0x29, 0x29, 
-0x29, 0x2b, 0x22, 0x4b, 0x0, 0x23, 0x29, 0x2b, 0xcd, 0xc5, 0xf0, 0x19, 0x22, 0x4d, 0x0, 0xcd, 
-0x9b, 0xbe, 0xd2, 0xbb, 0x2a, 0x4b, 0x0, 0x23, 0xcd, 0xc5, 0xf0, 0x11, 0x90, 0x1, 0x19, 0x11, 
-0x40, 0x1, 0xcd, 0x9b, 0xbe, 0xc9, 0xbb, 0x3a, 0x40, 0x0, 0xb7, 0xc4, 0x50, 0xee, 0xc1, 0xc9, 
-0xc5, 0xcd, 0x43, 0xee, 0xcd, 0x5d, 0xee, 0xcd, 0xfd, 0xed, 0xda, 0xce, 0xed, 0xc2, 0xc8, 0xed, 
-0xcd, 0x9b, 0xbe, 0x6c, 0xbb, 0xc3, 0xce, 0xed, 0x78, 0xcd, 0x9b, 0xbe, 0x44, 0xbc, 0xcd, 0x50, 
-0xee, 0xc1, 0xc9, 0x3a, 0x40, 0x0, 0xb7, 0xc8, 0xc5, 0xcd, 0x43, 0xee, 0xcd, 0x5d, 0xee, 0xcd, 
-0xfd, 0xed, 0xda, 0xf8, 0xed, 0x78, 0x6, 0xff, 0xc2, 0xf3, 0xed, 0xcd, 0x9b, 0xbe, 0x4d, 0xbc, 
-0xc3, 0xf8, 0xed, 0xcd, 0x9b, 0xbe, 0x50, 0xbc, 0xcd, 0x50, 0xee, 0xc1, 0xc9, 0xcd, 0x9b, 0xbe, 
-0x99, 0xbb, 0xcd, 0x9b, 0xbe, 0x2c, 0xbc, 0x47, 0x1d, 0x2d, 0x26, 0x0, 0x3a, 0x47, 0x0, 0x57, 
-0x3e, 0x18, 0xbd, 0xd8, 0xbb, 0xd8, 0x7b, 0xee, 0x18, 0xc0, 0x7d, 0xb7, 0xc9, 0xc5, 0xcd, 0x5d, 
-0xee, 0xc1, 0x65, 0x6b, 0x3a, 0x40, 0x0, 0xe6, 0x7f, 0x3d, 0x5f, 0x7d, 0x93, 0x6f, 0xcd, 0x9b, 
-0xbe, 0x75, 0xbb, 0xc9, 0xcd, 0x9b, 0xbe, 0xe, 0xbc, 0xcd, 0x9b, 0xbe, 0x69, 0xbb, 0x7a, 0x32, 
-0x47, 0x0, 0xc9, 0x21, 0x48, 0x0, 0x7e, 0xb7, 0xc0, 0x35, 0xcd, 0x9b, 0xbe, 0x7e, 0xbb, 0xc9, 
-0x21, 0x48, 0x0, 0x7e, 0xb7, 0xc8, 0x34, 0xcd, 0x9b, 0xbe, 0x7b, 0xbb, 0xc9, 0x21, 0x8, 0x0, 
-0x39, 0x5e, 0x2b, 0x2b, 0x6e, 0xc9, 0xc5, 0x21, 0x9, 0x0, 0x39, 0xcd, 0xd6, 0xee, 0xcd, 0xf3, 
-0xee, 0xd5, 0xcd, 0x2, 0xef, 0xe1, 0xcd, 0x9b, 0xbe, 0xea, 0xbb, 0xc1, 0xc9, 0xc5, 0x21, 0xd, 
-0x0, 0x39, 0xcd, 0xd6, 0xee, 0xcd, 0xf3, 0xee, 0xd5, 0xcd, 0x2, 0xef, 0xe3, 0xcd, 0x9b, 0xbe, 
-0xc0, 0xbb, 0xe1, 0xcd, 0xf3, 0xee, 0xd5, 0xcd, 0x2, 0xef, 0xe1, 0xcd, 0x9b, 0xbe, 0xf6, 0xbb, 
-0xc1, 0xc9, 0xc5, 0x21, 0x7, 0x0, 0x39, 0xcd, 0xd, 0xef, 0xeb, 0xcd, 0xc5, 0xf0, 0x11, 0x8f, 
-0x1, 0xd5, 0x19, 0xeb, 0x2a, 0x4d, 0x0, 0xeb, 0xcd, 0xb9, 0xf0, 0xd2, 0xbf, 0xee, 0xeb, 0xd1, 
-0xd5, 0xcd, 0x9b, 0xbe, 0xd2, 0xbb, 0xcd, 0x9b, 0xbe, 0xdb, 0xbb, 0xd1, 0x2a, 0x4d, 0x0, 0xcd, 
-0x9b, 0xbe, 0xd2, 0xbb, 0xc1, 0xc9, 0xcd, 0xd, 0xef, 0x7a, 0x3d, 0xfe, 0x1, 0xca, 0xe1, 0xee, 
-0xaf, 0xe5, 0xcd, 0x9b, 0xbe, 0x59, 0xbc, 0xe1, 0x7b, 0xcd, 0x9b, 0xbe, 0xde, 0xbb, 0xc9, 0x21, 
-0x0, 0x0, 0xc9, 0xcd, 0xd, 0xef, 0xe5, 0x2a, 0x4b, 0x0, 0xeb, 0xcd, 0xc5, 0xf0, 0x19, 0xeb, 
-0xe1, 0xc9, 0xcd, 0xd, 0xef, 0xe5, 0x21, 0xc0, 0xfe, 0x19, 0xeb, 0xe1, 0xc9, 0x56, 0x2b, 0x5e, 
-0x2b, 0x7b, 0xc9, 0xc5, 0x21, 0xb, 0x0, 0x39, 0xcd, 0xd6, 0xee, 0xcd, 0xd, 0xef, 0xd5, 0xcd, 
-0xf3, 0xee, 0xd5, 0xcd, 0x2, 0xef, 0xe1, 0xcd, 0x9b, 0xbe, 0xc0, 0xbb, 0x3e, 0xff, 0xcd, 0x9b, 
-0xbe, 0x63, 0xbb, 0xe1, 0x7e, 0x23, 0xb7, 0xc4, 0x5a, 0xbb, 0xc2, 0x34, 0xef, 0xaf, 0xcd, 0x9b, 
-0xbe, 0x63, 0xbb, 0xc1, 0xc9, 0xc9, 0xc5, 0x21, 0xb, 0x0, 0x39, 0xcd, 0x6c, 0xef, 0x47, 0xcd, 
-0x6c, 0xef, 0x4f, 0x87, 0x87, 0x87, 0x81, 0x80, 0x47, 0xcd, 0x6c, 0xef, 0x4f, 0x87, 0x81, 0x80, 
-0x47, 0x4f, 0xcd, 0xd, 0xef, 0xcd, 0x9b, 0xbe, 0x32, 0xbc, 0xc1, 0xc9, 0xcd, 0xd, 0xef, 0xe6, 
-0x3, 0xfe, 0x3, 0xd8, 0xaf, 0xc9, 0xc5, 0x21, 0x5, 0x0, 0x39, 0xcd, 0xd, 0xef, 0xcd, 0x9b, 
-0xbe, 0x35, 0xbc, 0x21, 0x41, 0x0, 0x3e, 0x6, 0x36, 0x0, 0x23, 0x3d, 0xc2, 0x88, 0xef, 0x68, 
-0x26, 0x9, 0xcd, 0xcf, 0xf0, 0x32, 0x43, 0x0, 0x26, 0x3, 0xcd, 0xcf, 0xf0, 0x32, 0x41, 0x0, 
-0x7d, 0x32, 0x45, 0x0, 0x21, 0x41, 0x0, 0xc1, 0xc9, 0x11, 0x7, 0x0, 0x21, 0x4, 0x0, 0xcd, 
-0xde, 0xef, 0x26, 0x0, 0xc9, 0x11, 0x4, 0x0, 0xc3, 0xdb, 0xef, 0x3a, 0x40, 0x0, 0xb7, 0xc8, 
-0x11, 0xa, 0x0, 0xc3, 0xdb, 0xef, 0x2e, 0x7, 0xe5, 0xcd, 0xbb, 0xef, 0xe1, 0xc9, 0x2a, 0x6, 
-0x0, 0xc9, 0x11, 0x2b, 0x0, 0xc3, 0xdb, 0xef, 0x11, 0xd, 0x0, 0x21, 0x2, 0x0, 0x39, 0xc5, 
-0x4e, 0x2a, 0x1, 0x0, 0x19, 0x7e, 0x23, 0x66, 0x6f, 0xcd, 0xf1, 0xef, 0x6f, 0x67, 0xb7, 0xc1, 
-0xc9, 0xe9, 0x21, 0x2, 0x0, 0x39, 0xcd, 0x25, 0xf0, 0x21, 0x6, 0xf0, 0xe6, 0xf, 0x5f, 0x16, 
-0x0, 0x19, 0x6e, 0x26, 0x0, 0xc9, 0xff, 0x0, 0x4, 0xff, 0x6, 0x7, 0x5, 0x6, 0x2, 0x1, 
-0x3, 0x2, 0xff, 0x0, 0x4, 0xff, 0x21, 0x2, 0x0, 0x39, 0xcd, 0x25, 0xf0, 0x21, 0x0, 0x0, 
-0xe6, 0x30, 0xc8, 0x23, 0xc9, 0xeb, 0xcd, 0x9b, 0xbe, 0x24, 0xbb, 0xeb, 0x7e, 0xb7, 0x7a, 0xc8, 
-0x7b, 0xc9, 0xc5, 0x21, 0x5, 0x0, 0x39, 0xcd, 0xd, 0xef, 0x21, 0xf6, 0xff, 0x39, 0xf9, 0xe5, 
-0x6, 0x9, 0x1a, 0x77, 0x13, 0x23, 0x5, 0xc2, 0x42, 0xf0, 0xe1, 0xe5, 0xcd, 0x9b, 0xbe, 0xaa, 
-0xbc, 0xd2, 0x4c, 0xf0, 0xe1, 0x11, 0xa, 0x0, 0x19, 0xf9, 0xc1, 0xc9, 0xc5, 0x21, 0x5, 0x0, 
-0x39, 0xcd, 0xd, 0xef, 0x21, 0xee, 0xff, 0x39, 0xf9, 0xe5, 0x6, 0x11, 0x1a, 0x77, 0x13, 0x23, 
-0x5, 0xc2, 0x6c, 0xf0, 0xe1, 0xe5, 0x7e, 0x23, 0xcd, 0x9b, 0xbe, 0xbf, 0xbc, 0xe1, 0x11, 0x12, 
-0x0, 0x19, 0xf9, 0xc1, 0xc9, 0xc5, 0x21, 0x5, 0x0, 0x39, 0xcd, 0xd, 0xef, 0x21, 0xee, 0xff, 
-0x39, 0xf9, 0xe5, 0x6, 0x11, 0x1a, 0x77, 0x13, 0x23, 0x5, 0xc2, 0x95, 0xf0, 0xe1, 0xe5, 0x7e, 
-0x23, 0xcd, 0x9b, 0xbe, 0xbc, 0xbc, 0xe1, 0x11, 0x12, 0x0, 0x19, 0xf9, 0xc1, 0xc9, 0xc5, 0x21, 
-0x4, 0x0, 0x39, 0x7e, 0xcd, 0xb3, 0xbc, 0xc1, 0xc9, 0xc5, 0x47, 0x7c, 0xba, 0xc2, 0xc2, 0xf0, 
-0x7d, 0xbb, 0x78, 0xc1, 0xc9, 0xf5, 0x7c, 0x2f, 0x67, 0x7d, 0x2f, 0x6f, 0x23, 0xf1, 0xc9, 0x7c, 
-0xb7, 0xc8, 0xc5, 0x6, 0x8, 0x4c, 0x26, 0x0, 0xb7, 0x7d, 0x17, 0x6f, 0x7c, 0x17, 0x67, 0xb9, 
-0xda, 0xe9, 0xf0, 0x91, 0x67, 0x7d, 0xf6, 0x1, 0x6f, 0x5, 0xc2, 0xd8, 0xf0, 0x7d, 0x6c, 0xc1, 
-0x37, 0xc9, 0x21, 0x2, 0x0, 0x39, 0xc5, 0x1, 0xff, 0x7f, 0x5e, 0x23, 0x56, 0x23, 0x7e, 0x23, 
-0x66, 0x6f, 0x78, 0xb1, 0xca, 0x16, 0xf1, 0x1a, 0xbe, 0xc2, 0x1b, 0xf1, 0xb7, 0xca, 0x16, 0xf1, 
-0x23, 0x13, 0xb, 0xc3, 0x2, 0xf1, 0xc1, 0x21, 0x0, 0x0, 0xc9, 0xc1, 0xda, 0x25, 0xf1, 0x21, 
-0x1, 0x0, 0x7d, 0xb4, 0xc9, 0x21, 0xff, 0xff, 0x7d, 0xb4, 0xc9, 0x21, 0x2, 0x0, 0x39, 0xc5, 
-0x1, 0xff, 0x7f, 0x5e, 0x23, 0x56, 0xd5, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0x78, 0xb1, 0xca, 0x4d, 
-0xf1, 0x7e, 0x12, 0xb7, 0xca, 0x4d, 0xf1, 0x23, 0x13, 0xb, 0xc3, 0x3c, 0xf1, 0xe1, 0xc1, 0xc9, 
-0x21, 0x2, 0x0, 0x39, 0x7e, 0x23, 0x66, 0x6f, 0x11, 0x0, 0x0, 0xaf, 0xbe, 0xca, 0x65, 0xf1, 
-0x13, 0x23, 0xc3, 0x5c, 0xf1, 0xeb, 0x7d, 0xb4, 0xc9, 0x21, 0x2, 0x0, 0x39, 0xc5, 0x5e, 0x23, 
-0x56, 0xd5, 0x23, 0x5e, 0x23, 0x56, 0x23, 0x4e, 0x23, 0x46, 0xeb, 0xd1, 0xc3, 0x2, 0xf1, 0xc5, 
-0x1, 0xff, 0x7f, 0x21, 0x4, 0x0, 0x39, 0x5e, 0x23, 0x56, 0xd5, 0x23, 0x7e, 0x23, 0x66, 0x6f, 
-0xeb, 0x78, 0xb1, 0xca, 0x4d, 0xf1, 0x7e, 0xb7, 0xca, 0xa0, 0xf1, 0x23, 0xb, 0xc3, 0x91, 0xf1, 
-0xeb, 0xc3, 0x3c, 0xf1, 0xd1, 0xe1, 0xe5, 0x73, 0x23, 0x72, 0x23, 0xd5, 0xeb, 0x21, 0x0, 0x0, 
-0x39, 0xeb, 0x73, 0x23, 0x72, 0xaf, 0x67, 0x6f, 0xc9, 0xe1, 0xe1, 0x5e, 0x23, 0x56, 0x23, 0xd5, 
-0x5e, 0x23, 0x56, 0xe1, 0xeb, 0x73, 0x23, 0x72, 0x2b, 0xd1, 0xf9, 0xeb, 0x7c, 0xb5, 0xc9, 0xeb, 
-0x2a, 0x7, 0x1, 0xc5, 0x1a, 0x77, 0x23, 0xe6, 0x7f, 0xd6, 0x40, 0x77, 0x23, 0x36, 0x0, 0x6, 
-0x3, 0x23, 0x13, 0x1a, 0x77, 0x5, 0xc2, 0xe1, 0xf1, 0x6, 0x5, 0xaf, 0x23, 0x77, 0x5, 0xc2, 
-0xec, 0xf1, 0xc1, 0xc9, 0xd1, 0x21, 0x8, 0x0, 0x19, 0xe5, 0xeb, 0xeb, 0x2a, 0x9, 0x1, 0xc3, 
-0xd, 0xf2, 0xd1, 0x21, 0x8, 0x0, 0x19, 0xe5, 0xeb, 0xeb, 0x2a, 0x7, 0x1, 0xc5, 0x1a, 0x77, 
-0x23, 0xe6, 0x7f, 0xd6, 0x40, 0x77, 0x23, 0x36, 0x0, 0x6, 0x7, 0x23, 0x13, 0x1a, 0x77, 0x5, 
-0xc2, 0x1b, 0xf2, 0x23, 0x36, 0x0, 0xc1, 0xc9, 0xc5, 0xe5, 0xcd, 0xd, 0xf6, 0xd1, 0x2a, 0x7, 
-0x1, 0x7e, 0xe6, 0x80, 0x47, 0x23, 0x7e, 0xc6, 0x40, 0xe6, 0x7f, 0xb0, 0x12, 0x23, 0x6, 0x7, 
-0x13, 0x23, 0x7e, 0x12, 0x5, 0xc2, 0x40, 0xf2, 0xc1, 0xc9, 0xe1, 0x22, 0xb0, 0x4, 0xcd, 0xd, 
-0xf6, 0x2a, 0x7, 0x1, 0x11, 0x9, 0x0, 0x19, 0x56, 0x2b, 0x5e, 0x2b, 0xd5, 0x56, 0x2b, 0x5e, 
-0x2b, 0xd5, 0x56, 0x2b, 0x5e, 0x2b, 0xd5, 0x56, 0x2b, 0x2b, 0x7e, 0xc6, 0x40, 0xe6, 0x7f, 0x5f, 
-0x2b, 0x7e, 0xe6, 0x80, 0xb3, 0x5f, 0xd5, 0x2a, 0xb0, 0x4, 0xe9, 0xe1, 0x22, 0xb0, 0x4, 0x2a, 
-0x9, 0x1, 0xd1, 0x73, 0x23, 0x7b, 0xe6, 0x7f, 0xd6, 0x40, 0x77, 0x23, 0x36, 0x0, 0x23, 0x72, 
-0x23, 0xd1, 0x73, 0x23, 0x72, 0x23, 0xd1, 0x73, 0x23, 0x72, 0x23, 0xd1, 0x73, 0x23, 0x72, 0x23, 
-0x36, 0x0, 0x2a, 0xb0, 0x4, 0xe9, 0x2a, 0x9, 0x1, 0xeb, 0x2a, 0x7, 0x1, 0x22, 0x9, 0x1, 
-0xeb, 0x22, 0x7, 0x1, 0xc9, 0x2a, 0x7, 0x1, 0x7e, 0xee, 0x80, 0x77, 0xc9, 0x2a, 0x7, 0x1, 
-0x23, 0x7e, 0xfe, 0xc0, 0xc2, 0x35, 0xfb, 0xc3, 0x29, 0xfb, 0xaf, 0x3d, 0xc1, 0xc9, 0xaf, 0x3c, 
-0xc1, 0xc9, 0xc5, 0x2a, 0x7, 0x1, 0xeb, 0x2a, 0x9, 0x1, 0x1a, 0xb7, 0xfa, 0xe6, 0xf2, 0xae, 
-0xfa, 0xce, 0xf2, 0xc3, 0xeb, 0xf2, 0xae, 0xfa, 0xca, 0xf2, 0xeb, 0x23, 0x13, 0x1a, 0xbe, 0xfa, 
-0xca, 0xf2, 0xc2, 0xce, 0xf2, 0x6, 0x9, 0x23, 0x13, 0x1a, 0xbe, 0xda, 0xca, 0xf2, 0xc2, 0xce, 
-0xf2, 0x5, 0xc2, 0xf7, 0xf2, 0xaf, 0xc1, 0xc9, 0x2a, 0x9, 0x1, 0x7e, 0xee, 0x80, 0x77, 0xc5, 
-0x2a, 0x7, 0x1, 0x11, 0xb, 0x0, 0x19, 0x6, 0x7, 0xaf, 0x77, 0x23, 0x5, 0xc2, 0x1a, 0xf3, 
-0x2a, 0x9, 0x1, 0x11, 0xb, 0x0, 0x19, 0x6, 0x7, 0x77, 0x23, 0x5, 0xc2, 0x29, 0xf3, 0x2a, 
-0x7, 0x1, 0xeb, 0x2a, 0x9, 0x1, 0x23, 0x13, 0x1a, 0x96, 0xf2, 0x40, 0xf3, 0xeb, 0x2f, 0x3c, 
-0x1b, 0x2b, 0x22, 0x9, 0x1, 0xeb, 0x22, 0x7, 0x1, 0xfe, 0x9, 0xd2, 0x34, 0xf6, 0x4f, 0xe5, 
-0xd5, 0xc6, 0x9, 0x5f, 0x16, 0x0, 0x19, 0x22, 0xb2, 0x4, 0xd1, 0x21, 0x9, 0x0, 0x19, 0x22, 
-0xb4, 0x4, 0xe1, 0xeb, 0x1a, 0xae, 0xf2, 0xc6, 0xf3, 0x1a, 0xb7, 0xfa, 0x8d, 0xf3, 0x6, 0x7, 
-0x2a, 0xb2, 0x4, 0xeb, 0x2a, 0xb4, 0x4, 0x1a, 0x9e, 0x12, 0x1b, 0x2b, 0x5, 0xc2, 0x77, 0xf3, 
-0x1a, 0xde, 0x0, 0x12, 0x1b, 0xd, 0xf2, 0x80, 0xf3, 0xeb, 0xc3, 0xa8, 0xf3, 0x6, 0x7, 0x2a, 
-0xb4, 0x4, 0xeb, 0x2a, 0xb2, 0x4, 0x1a, 0x9e, 0x77, 0x1b, 0x2b, 0x5, 0xc2, 0x96, 0xf3, 0x3e, 
-0x0, 0x9e, 0x77, 0x2b, 0xd, 0xf2, 0x9f, 0xf3, 0x23, 0x7e, 0xb7, 0x3e, 0x1, 0xf2, 0xbf, 0xf3, 
-0x11, 0xf, 0x0, 0x19, 0x3e, 0x0, 0x9e, 0x77, 0x2b, 0x1d, 0xf2, 0xb4, 0xf3, 0x3e, 0x81, 0x2a, 
-0x7, 0x1, 0x77, 0xc3, 0x34, 0xf6, 0x6, 0x7, 0x2a, 0xb2, 0x4, 0xeb, 0x2a, 0xb4, 0x4, 0x1a, 
-0x8e, 0x12, 0x1b, 0x2b, 0x5, 0xc2, 0xcf, 0xf3, 0x1a, 0xce, 0x0, 0x12, 0x1b, 0xd, 0xf2, 0xd8, 
-0xf3, 0xc3, 0x34, 0xf6, 0xc5, 0x2a, 0x7, 0x1, 0xeb, 0x2a, 0x9, 0x1, 0x1a, 0xae, 0x12, 0x23, 
-0x13, 0x1a, 0x96, 0x4f, 0xd5, 0xe5, 0x7e, 0xfe, 0xc0, 0xc2, 0x1, 0xf4, 0xe1, 0xe1, 0xc3, 0xbf, 
-0xf6, 0x13, 0x23, 0x6, 0x8, 0x13, 0x23, 0x1a, 0xbe, 0xc2, 0x20, 0xf4, 0x5, 0xc2, 0x5, 0xf4, 
-0xe1, 0xe1, 0xc, 0x71, 0x23, 0x36, 0x0, 0x23, 0x36, 0x1, 0x6, 0x8, 0xaf, 0xc3, 0x58, 0xf6, 
-0xd1, 0xe1, 0x71, 0xda, 0x29, 0xf4, 0xc, 0x71, 0x2b, 0xd5, 0x11, 0x9, 0x0, 0x19, 0x6, 0x8, 
-0x11, 0xe4, 0x4, 0x7e, 0x12, 0x2b, 0x13, 0x5, 0xc2, 0x33, 0xf4, 0xe1, 0x11, 0x9, 0x0, 0x19, 
-0x6, 0x8, 0x11, 0xec, 0x4, 0x7e, 0x12, 0x2b, 0x13, 0x5, 0xc2, 0x45, 0xf4, 0x6, 0x8, 0x21, 
-0xdc, 0x4, 0xaf, 0x77, 0x23, 0x5, 0xc2, 0x53, 0xf4, 0x3e, 0x40, 0x32, 0xdb, 0x4, 0x21, 0xdc, 
-0x4, 0x6, 0x10, 0xb7, 0x7e, 0x8f, 0x77, 0x23, 0x5, 0xc2, 0x64, 0xf4, 0x9f, 0xe6, 0x1, 0x4f, 
-0x6, 0x8, 0x11, 0xe4, 0x4, 0x21, 0xec, 0x4, 0xb7, 0x1a, 0x9e, 0x12, 0x13, 0x23, 0x5, 0xc2, 
-0x79, 0xf4, 0x79, 0xde, 0x0, 0xc2, 0x96, 0xf4, 0x21, 0xdc, 0x4, 0x34, 0x21, 0xdb, 0x4, 0x35, 
-0xc2, 0x5e, 0xf4, 0xc3, 0xc8, 0xf4, 0x21, 0xdb, 0x4, 0x35, 0xca, 0xc8, 0xf4, 0x21, 0xdc, 0x4, 
-0x6, 0x10, 0xb7, 0x7e, 0x8f, 0x77, 0x23, 0x5, 0xc2, 0xa3, 0xf4, 0x9f, 0x4f, 0x6, 0x8, 0x11, 
-0xe4, 0x4, 0x21, 0xec, 0x4, 0xb7, 0x1a, 0x8e, 0x12, 0x13, 0x23, 0x5, 0xc2, 0xb6, 0xf4, 0x79, 
-0xce, 0x0, 0xc2, 0x96, 0xf4, 0xc3, 0x88, 0xf4, 0x2a, 0x7, 0x1, 0x11, 0xc, 0x0, 0x19, 0x36, 
-0x0, 0x2b, 0x36, 0x0, 0x11, 0xdc, 0x4, 0x6, 0x8, 0x2b, 0x1a, 0x77, 0x13, 0x5, 0xc2, 0xd9, 
-0xf4, 0xc3, 0x34, 0xf6, 0xc5, 0x2a, 0x7, 0x1, 0xeb, 0x2a, 0x9, 0x1, 0x1a, 0xae, 0x12, 0x23, 
-0x13, 0x1a, 0xfe, 0xc0, 0xca, 0x4e, 0xf6, 0x86, 0x12, 0x7e, 0xfe, 0xc0, 0xca, 0x4e, 0xf6, 0xd5, 
-0x11, 0x9, 0x0, 0x19, 0x6, 0x8, 0x11, 0xec, 0x4, 0x7e, 0x12, 0x2b, 0x13, 0x5, 0xc2, 0x9, 
-0xf5, 0xe1, 0x11, 0x9, 0x0, 0x19, 0x6, 0x8, 0x11, 0xe4, 0x4, 0x7e, 0x12, 0x2b, 0x13, 0x5, 
-0xc2, 0x1b, 0xf5, 0x6, 0x8, 0x21, 0xdc, 0x4, 0xaf, 0x77, 0x23, 0x5, 0xc2, 0x29, 0xf5, 0x3e, 
-0x40, 0x32, 0xdb, 0x4, 0x21, 0xdc, 0x4, 0x6, 0x10, 0xb7, 0x7e, 0x8f, 0x77, 0x23, 0x5, 0xc2, 
-0x3a, 0xf5, 0xd2, 0x65, 0xf5, 0x6, 0x8, 0x11, 0xdc, 0x4, 0x21, 0xec, 0x4, 0xb7, 0x1a, 0x8e, 
-0x12, 0x13, 0x23, 0x5, 0xc2, 0x4e, 0xf5, 0x6, 0x8, 0x1a, 0xce, 0x0, 0x12, 0xd2, 0x65, 0xf5, 
-0x13, 0x5, 0xc2, 0x59, 0xf5, 0x21, 0xdb, 0x4, 0x35, 0xc2, 0x34, 0xf5, 0x2a, 0x7, 0x1, 0x11, 
-0xc, 0x0, 0x19, 0x11, 0xe2, 0x4, 0x6, 0xa, 0x1a, 0x77, 0x13, 0x2b, 0x5, 0xc2, 0x78, 0xf5, 
-0xc3, 0x34, 0xf6, 0xcd, 0xd2, 0xf2, 0xca, 0x35, 0xfb, 0xc3, 0x29, 0xfb, 0xcd, 0xd2, 0xf2, 0xca, 
-0x29, 0xfb, 0xc3, 0x35, 0xfb, 0xcd, 0xd2, 0xf2, 0xfa, 0x35, 0xfb, 0xc3, 0x29, 0xfb, 0xcd, 0xd2, 
-0xf2, 0xfa, 0x35, 0xfb, 0xca, 0x35, 0xfb, 0xc3, 0x29, 0xfb, 0xcd, 0xd2, 0xf2, 0xfa, 0x29, 0xfb, 
-0xc3, 0x35, 0xfb, 0xcd, 0xd2, 0xf2, 0xfa, 0x29, 0xfb, 0xca, 0x29, 0xfb, 0xc3, 0x35, 0xfb, 0xc5, 
-0x7c, 0xb5, 0xca, 0x4e, 0xf6, 0xeb, 0x6, 0x0, 0xc3, 0xe1, 0xf5, 0xc5, 0x7c, 0xb5, 0xca, 0x4e, 
-0xf6, 0xeb, 0x6, 0x0, 0x7a, 0xb7, 0xf2, 0xe1, 0xf5, 0x2f, 0x57, 0x7b, 0x2f, 0x5f, 0x13, 0x6, 
-0x80, 0x2a, 0x7, 0x1, 0x70, 0x23, 0x7a, 0xb7, 0xc2, 0xf8, 0xf5, 0x36, 0x1, 0x23, 0x36, 0x0, 
-0x23, 0x73, 0x6, 0x7, 0xaf, 0xc3, 0x4, 0xf6, 0x36, 0x2, 0x23, 0x36, 0x0, 0x23, 0x72, 0x23, 
-0x73, 0x6, 0x6, 0xaf, 0x23, 0x77, 0x5, 0xc2, 0x4, 0xf6, 0xc3, 0x92, 0xf6, 0x2a, 0x7, 0x1, 
-0x11, 0xa, 0x0, 0x19, 0x7e, 0xfe, 0x80, 0xd8, 0xc2, 0x21, 0xf6, 0x2b, 0x7e, 0xf6, 0x1, 0x77, 
-0xc9, 0xc5, 0x1, 0x0, 0x8, 0x37, 0x2b, 0x7e, 0x89, 0x77, 0x5, 0xc2, 0x26, 0xf6, 0xb7, 0xc2, 
-0x34, 0xf6, 0xc1, 0xc9, 0x2a, 0x7, 0x1, 0x23, 0x7e, 0x54, 0x5d, 0x23, 0x4f, 0xaf, 0xbe, 0xc2, 
-0x94, 0xf6, 0x6, 0x8, 0x23, 0xbe, 0xc2, 0x60, 0xf6, 0xd, 0x5, 0xc2, 0x44, 0xf6, 0xaf, 0x2a, 
-0x7, 0x1, 0x6, 0xa, 0x77, 0x23, 0x36, 0xc0, 0x23, 0x77, 0x5, 0xc2, 0x58, 0xf6, 0xc1, 0xc9, 
-0x3e, 0x8, 0x90, 0x47, 0xca, 0x80, 0xf6, 0x2b, 0x79, 0x12, 0xd5, 0x13, 0x3e, 0xf, 0x90, 0x4f, 
-0x7e, 0x12, 0x13, 0x23, 0xd, 0xc2, 0x70, 0xf6, 0xaf, 0x12, 0x13, 0x5, 0xc2, 0x79, 0xf6, 0xd1, 
-0x1a, 0xb7, 0xfa, 0x8d, 0xf6, 0xfe, 0x40, 0xda, 0x92, 0xf6, 0xc3, 0xbf, 0xf6, 0xfe, 0xc1, 0xda, 
-0xae, 0xf6, 0xc1, 0xc9, 0xc, 0x79, 0x12, 0x6, 0xf, 0xd5, 0x21, 0x10, 0x0, 0x19, 0x54, 0x5d, 
-0x1b, 0x1a, 0x77, 0x2b, 0x5, 0xc2, 0xa0, 0xf6, 0x36, 0x0, 0xd1, 0xc3, 0x80, 0xf6, 0xaf, 0x2a, 
-0x7, 0x1, 0x23, 0x36, 0xc1, 0x23, 0x77, 0x23, 0x36, 0x1, 0x6, 0x8, 0xc3, 0x58, 0xf6, 0x2a, 
-0x7, 0x1, 0x23, 0x36, 0x3f, 0x23, 0x36, 0x0, 0x3e, 0xff, 0x6, 0x7, 0x23, 0x77, 0x5, 0xc2, 
-0xcc, 0xf6, 0x23, 0x36, 0x0, 0xc1, 0xc9, 0xc5, 0x2a, 0x7, 0x1, 0x36, 0x0, 0x23, 0x36, 0x3, 
-0x11, 0x4, 0x0, 0x19, 0x5d, 0x54, 0x6, 0x5, 0xaf, 0x23, 0x77, 0x5, 0xc2, 0xe9, 0xf6, 0x6, 
-0x4, 0x2a, 0x3, 0x1, 0x23, 0x23, 0x23, 0x7e, 0x2a, 0x3, 0x1, 0xb7, 0xf2, 0x10, 0xf7, 0x3e, 
-0x0, 0x9e, 0x12, 0x23, 0x1b, 0x5, 0xc2, 0xff, 0xf6, 0x1b, 0x3e, 0x80, 0x12, 0xc3, 0x34, 0xf6, 
-0x7e, 0x12, 0x23, 0x1b, 0x5, 0xc2, 0x10, 0xf7, 0xc3, 0x34, 0xf6, 0xc5, 0x2a, 0x3, 0x1, 0x54, 
-0x5d, 0xaf, 0x77, 0x23, 0x77, 0x23, 0x77, 0x23, 0x77, 0x2a, 0x7, 0x1, 0x4e, 0x23, 0x7e, 0xb7, 
-0xca, 0x92, 0xf6, 0xfa, 0x92, 0xf6, 0xfe, 0x5, 0xd2, 0x61, 0xf7, 0x47, 0x23, 0x85, 0x6f, 0xd2, 
-0x43, 0xf7, 0x24, 0x7e, 0x12, 0x13, 0x2b, 0x5, 0xc2, 0x43, 0xf7, 0x79, 0xb7, 0xf2, 0x92, 0xf6, 
-0x6, 0x4, 0x2a, 0x3, 0x1, 0x3e, 0x0, 0x9e, 0x77, 0x23, 0x5, 0xc2, 0x55, 0xf7, 0xc3, 0x92, 
-0xf6, 0xeb, 0x79, 0xb7, 0xfa, 0x75, 0xf7, 0x36, 0x7f, 0x23, 0x36, 0xff, 0x23, 0x36, 0xff, 0x23, 
-0x36, 0xff, 0xc3, 0xdc, 0xf7, 0x36, 0x80, 0x23, 0x36, 0x0, 0x23, 0x36, 0x0, 0x23, 0x36, 0x0, 
-0xc3, 0xdc, 0xf7, 0xc5, 0xe, 0x0, 0xc3, 0x8c, 0xf7, 0xc5, 0xe, 0x1, 0x2a, 0x7, 0x1, 0x46, 
-0x23, 0x7e, 0xb7, 0xca, 0x99, 0xf7, 0xf2, 0x9f, 0xf7, 0x21, 0x0, 0x0, 0xc3, 0x92, 0xf6, 0xfe, 
-0x3, 0xd2, 0xc3, 0xf7, 0x23, 0x85, 0x6f, 0xd2, 0xab, 0xf7, 0x24, 0x5e, 0x2b, 0x56, 0xeb, 0x79, 
-0xb7, 0xca, 0x92, 0xf6, 0x78, 0xb7, 0xf2, 0x92, 0xf6, 0x7c, 0x2f, 0x67, 0x7d, 0x2f, 0x6f, 0x23, 
-0xc3, 0x92, 0xf6, 0x79, 0xb7, 0xc2, 0xce, 0xf7, 0x21, 0xff, 0xff, 0xc3, 0xdc, 0xf7, 0x78, 0xb7, 
-0xfa, 0xd9, 0xf7, 0x21, 0xff, 0x7f, 0xc3, 0xdc, 0xf7, 0x21, 0x0, 0x80, 0xc1, 0xc9, 0x40, 0x80, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0xc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0x40, 0x1, 
-0x47, 0xae, 0x14, 0x7a, 0xe1, 0x48, 0x3f, 0x20, 0xc4, 0x9b, 0xa5, 0xe3, 0x54, 0x0, 0x3f, 0x3, 
-0x46, 0xdc, 0x5d, 0x63, 0x88, 0x66, 0x3e, 0x53, 0xe2, 0xd6, 0x23, 0x8d, 0xa3, 0xcd, 0x3e, 0x8, 
-0x63, 0x7b, 0xd0, 0x5a, 0xf6, 0xc8, 0x3d, 0xd6, 0xbf, 0x94, 0xd5, 0xe5, 0x7a, 0x66, 0x3d, 0x15, 
-0x79, 0x8e, 0xe2, 0x30, 0x8c, 0x3d, 0x3d, 0x2, 0x25, 0xc1, 0x7d, 0x4, 0xda, 0xd3, 0x3c, 0x36, 
-0xf9, 0xbf, 0xb3, 0xaf, 0x7b, 0x80, 0x3c, 0x5, 0x7f, 0x5f, 0xf8, 0x5e, 0x59, 0x26, 0x3b, 0x8c, 
-0xbc, 0xcc, 0x9, 0x6f, 0x50, 0x9a, 0x3b, 0xe, 0x12, 0xe1, 0x34, 0x24, 0xbb, 0x43, 0x3b, 0x1, 
-0x68, 0x49, 0xb8, 0x6a, 0x12, 0xba, 0x3a, 0x24, 0x7, 0x5f, 0x3d, 0xce, 0xac, 0x33, 0x3a, 0x3, 
-0x9a, 0x56, 0x52, 0xfb, 0x11, 0x38, 0xc5, 0x21, 0xc, 0x0, 0x39, 0x5e, 0x23, 0x56, 0xeb, 0x22, 
-0xf4, 0x4, 0x21, 0x4, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0x21, 0xf, 0x0, 0x22, 0xf6, 0x4, 0x2a, 
-0x7, 0x1, 0x7e, 0xb7, 0xf2, 0x93, 0xf8, 0xcd, 0xb5, 0xf2, 0x2a, 0xf4, 0x4, 0x36, 0x2d, 0x23, 
-0x22, 0xf4, 0x4, 0x1, 0x0, 0x0, 0xcd, 0xbd, 0xf2, 0xca, 0x19, 0xf9, 0xcd, 0xf4, 0xf1, 0x41, 
-0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0x7, 0x1, 0x23, 0x7e, 0xfe, 0x1, 0xfa, 0x12, 
-0xf9, 0xca, 0xf9, 0xf8, 0xfe, 0x2, 0xc2, 0xc1, 0xf8, 0x23, 0x23, 0x7e, 0xfe, 0x27, 0xda, 0x1, 
-0xf9, 0xcd, 0x12, 0xfa, 0xcd, 0xf4, 0xf1, 0x40, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9a, 0xcd, 
-0x1e, 0xfa, 0x3, 0xcd, 0x95, 0xf5, 0xc2, 0xcf, 0xf8, 0xcd, 0x12, 0xfa, 0x2a, 0x7, 0x1, 0x23, 
-0x23, 0x23, 0x7e, 0xfe, 0xa, 0xda, 0x19, 0xf9, 0xb, 0xcd, 0x1e, 0xfa, 0xc3, 0x19, 0xf9, 0x2a, 
-0x7, 0x1, 0x23, 0x7e, 0xfe, 0x1, 0xc2, 0x1, 0xf9, 0x23, 0x23, 0x7e, 0xfe, 0xa, 0xda, 0x19, 
-0xf9, 0xcd, 0xe4, 0xf3, 0x3, 0xc3, 0xef, 0xf8, 0x2a, 0x7, 0x1, 0x23, 0x7e, 0xfe, 0x1, 0xf2, 
-0x19, 0xf9, 0xcd, 0x1e, 0xfa, 0xb, 0xc3, 0x8, 0xf9, 0x2a, 0xf6, 0x4, 0x2b, 0x29, 0x29, 0x29, 
-0x11, 0xde, 0xf7, 0x19, 0xcd, 0xfb, 0xf1, 0xcd, 0xf, 0xf3, 0xcd, 0xf4, 0xf1, 0x41, 0xa, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0xaa, 0xf5, 0xca, 0x49, 0xf9, 0x21, 0x1, 0x0, 0xcd, 0xbf, 
-0xf5, 0x3, 0x2a, 0xf6, 0x4, 0x23, 0x22, 0xf6, 0x4, 0x60, 0x69, 0x22, 0xf8, 0x4, 0x3e, 0xff, 
-0x32, 0xfa, 0x4, 0x78, 0xb7, 0xfa, 0x61, 0xf9, 0x79, 0xfe, 0xf, 0xd2, 0x68, 0xf9, 0xc3, 0x88, 
-0xf9, 0x79, 0x2f, 0xfe, 0x1, 0xda, 0x6f, 0xf9, 0xaf, 0x32, 0xfa, 0x4, 0xc3, 0x88, 0xf9, 0x2a, 
-0xf4, 0x4, 0x36, 0x30, 0x23, 0x36, 0x2e, 0x23, 0xb7, 0xca, 0x83, 0xf9, 0x36, 0x30, 0x23, 0x3d, 
-0xc2, 0x7c, 0xf9, 0x22, 0xf4, 0x4, 0x3e, 0xff, 0x4f, 0x6, 0xff, 0x4, 0x3a, 0xf6, 0x4, 0xb8, 
-0xda, 0xbd, 0xf9, 0xca, 0xbd, 0xf9, 0x2a, 0x7, 0x1, 0x23, 0x7e, 0xfe, 0x1, 0x3e, 0x30, 0xc2, 
-0xa7, 0xf9, 0x23, 0x23, 0x86, 0x36, 0x0, 0x2a, 0xf4, 0x4, 0x77, 0x23, 0x78, 0xb9, 0xc2, 0xb4, 
-0xf9, 0x36, 0x2e, 0x23, 0x22, 0xf4, 0x4, 0xcd, 0x1e, 0xfa, 0xc3, 0x8b, 0xf9, 0x2a, 0xf4, 0x4, 
-0x2b, 0x7e, 0xfe, 0x30, 0xca, 0xc0, 0xf9, 0x3a, 0xfa, 0x4, 0xb7, 0xca, 0xd8, 0xf9, 0x7e, 0xfe, 
-0x2e, 0xca, 0xe, 0xfa, 0x23, 0xc3, 0xe, 0xfa, 0x23, 0x36, 0x65, 0x23, 0x36, 0x2b, 0x3a, 0xf9, 
-0x4, 0xb7, 0x3a, 0xf8, 0x4, 0xf2, 0xec, 0xf9, 0x36, 0x2d, 0x2f, 0x3c, 0x23, 0xfe, 0x64, 0xda, 
-0xf7, 0xf9, 0x36, 0x31, 0x23, 0xd6, 0x64, 0x6, 0x0, 0xfe, 0xa, 0xda, 0x4, 0xfa, 0x4, 0xd6, 
-0xa, 0xc3, 0xf9, 0xf9, 0xc6, 0x30, 0x5f, 0x3e, 0x30, 0x80, 0x77, 0x23, 0x73, 0x23, 0x36, 0x0, 
-0xc1, 0xc9, 0xcd, 0xa6, 0xf2, 0x21, 0x1, 0x0, 0xcd, 0xbf, 0xf5, 0xc3, 0xe4, 0xf3, 0xc5, 0x2a, 
-0x7, 0x1, 0x23, 0x34, 0x11, 0x9, 0x0, 0x19, 0xaf, 0x6, 0x8, 0xc5, 0x5e, 0xeb, 0x26, 0x0, 
-0x29, 0x44, 0x4d, 0x29, 0x29, 0x9, 0xeb, 0x83, 0x23, 0x77, 0x7a, 0xce, 0x0, 0x2b, 0x2b, 0xc1, 
-0x5, 0xc2, 0x2b, 0xfa, 0x23, 0x77, 0xb7, 0xca, 0x34, 0xf6, 0x2b, 0x2b, 0x7e, 0xb7, 0xfa, 0x56, 
-0xfa, 0xfe, 0x40, 0xd2, 0xbf, 0xf6, 0xc1, 0xc9, 0xcd, 0x90, 0xff, 0x21, 0x8, 0x0, 0x39, 0x4e, 
-0x23, 0x46, 0x50, 0x59, 0x21, 0x61, 0x0, 0xcd, 0x3d, 0xfb, 0x28, 0x13, 0x50, 0x59, 0x21, 0x7a, 
-0x0, 0xcd, 0x3e, 0xfb, 0x28, 0x9, 0x60, 0x69, 0x11, 0x20, 0x0, 0xcd, 0x6c, 0xfc, 0xc9, 0x60, 
-0x69, 0xc9, 0xcd, 0x90, 0xff, 0x21, 0x8, 0x0, 0x39, 0x4e, 0x23, 0x46, 0x50, 0x59, 0x21, 0x41, 
-0x0, 0xcd, 0x3d, 0xfb, 0x28, 0x13, 0x50, 0x59, 0x21, 0x5a, 0x0, 0xcd, 0x3e, 0xfb, 0x28, 0x9, 
-0x60, 0x69, 0x11, 0x20, 0x0, 0xcd, 0x6c, 0xfc, 0xc9, 0x60, 0x69, 0xc9, 0xcd, 0x90, 0xff, 0x21, 
-0x8, 0x0, 0x39, 0x4e, 0x23, 0x46, 0x60, 0x69, 0x11, 0x20, 0x0, 0xcd, 0x24, 0xfb, 0x20, 0x18, 
-0x60, 0x69, 0x11, 0x9, 0x0, 0xcd, 0x24, 0xfb, 0x20, 0xe, 0x60, 0x69, 0x11, 0xa, 0x0, 0xcd, 
-0x24, 0xfb, 0x20, 0x4, 0x21, 0x0, 0x0, 0xc9, 0x21, 0x1, 0x0, 0xc9, 0x7c, 0xa2, 0x67, 0x7d, 
-0xa3, 0x6f, 0xb4, 0xc9, 0x7c, 0x2f, 0x67, 0x7d, 0x2f, 0x6f, 0xb4, 0xc9, 0xe9, 0xe1, 0xc5, 0x5e, 
-0x23, 0x56, 0x23, 0x44, 0x4d, 0x21, 0x0, 0x0, 0x39, 0xeb, 0x39, 0xf9, 0xd5, 0x60, 0x69, 0xcd, 
-0xec, 0xfa, 0xeb, 0xe1, 0xf9, 0xc1, 0xeb, 0x7c, 0xb5, 0xc9, 0x7a, 0xac, 0x32, 0xfc, 0x4, 0xcd, 
-0x7b, 0xfb, 0xeb, 0x3a, 0xfc, 0x4, 0xb7, 0xfa, 0xd4, 0xfb, 0x7d, 0xb4, 0xc9, 0xcd, 0x94, 0xfb, 
-0xeb, 0x7d, 0xb4, 0xc9, 0xa7, 0xed, 0x52, 0x28, 0xc, 0x21, 0x0, 0x0, 0xaf, 0x54, 0x5d, 0xc9, 
-0xa7, 0xed, 0x52, 0x28, 0xf4, 0x21, 0x1, 0x0, 0x7d, 0xb4, 0x54, 0x5d, 0xc9, 0xeb, 0x7c, 0xaa, 
-0xfa, 0x4c, 0xfb, 0xaf, 0xed, 0x52, 0x67, 0x3f, 0xce, 0x0, 0x6f, 0xc9, 0x7a, 0x7, 0xe6, 0x1, 
-0x6f, 0x26, 0x0, 0xc9, 0xeb, 0x7c, 0xaa, 0xfa, 0x62, 0xfb, 0xaf, 0xed, 0x52, 0x67, 0xce, 0x0, 
-0x6f, 0xc9, 0x7c, 0x7, 0xe6, 0x1, 0x6f, 0x26, 0x0, 0xc9, 0x7a, 0x32, 0xfc, 0x4, 0xcd, 0x7b, 
-0xfb, 0x3a, 0xfc, 0x4, 0xb7, 0xfa, 0xd4, 0xfb, 0x7c, 0xb5, 0xc9, 0x7c, 0xb7, 0xf2, 0x86, 0xfb, 
-0x2f, 0x67, 0x7d, 0x2f, 0x6f, 0x23, 0x7a, 0xb7, 0xf2, 0x94, 0xfb, 0x2f, 0x57, 0x7b, 0x2f, 0x5f, 
-0x13, 0xc3, 0x94, 0xfb, 0xc5, 0x44, 0x4d, 0x21, 0x0, 0x0, 0x3e, 0x10, 0x29, 0xeb, 0x29, 0xeb, 
-0xd2, 0xa4, 0xfb, 0x23, 0xa7, 0xed, 0x42, 0xd2, 0xb3, 0xfb, 0x9, 0x3d, 0xc2, 0x9c, 0xfb, 0xc1, 
-0x7d, 0xb4, 0xc9, 0x13, 0x3d, 0xc2, 0x9c, 0xfb, 0xc1, 0x7d, 0xb4, 0xc9, 0xc5, 0x44, 0x4d, 0x21, 
-0x0, 0x0, 0x3e, 0x10, 0x29, 0xeb, 0x29, 0xeb, 0xd2, 0xcc, 0xfb, 0x9, 0x3d, 0xc2, 0xc4, 0xfb, 
-0xc1, 0x7d, 0xb4, 0xc9, 0x7d, 0x2f, 0x6f, 0x7c, 0x2f, 0x67, 0x23, 0x7d, 0xb4, 0xc9, 0x7c, 0xb5, 
-0xca, 0x35, 0xfb, 0xc3, 0x29, 0xfb, 0x7c, 0xb2, 0x67, 0x7d, 0xb3, 0x6f, 0xb4, 0xc9, 0xeb, 0x7b, 
-0xe6, 0x1f, 0x5f, 0xca, 0x15, 0xfc, 0x7c, 0xb4, 0xf2, 0x5f, 0xfc, 0x7c, 0x37, 0x1f, 0x67, 0x7d, 
-0x1f, 0x6f, 0x1d, 0xc2, 0xfb, 0xfb, 0xb4, 0xc9, 0xeb, 0x7b, 0xe6, 0x1f, 0x5f, 0xca, 0x15, 0xfc, 
-0x29, 0x1d, 0xc2, 0x10, 0xfc, 0x7d, 0xb4, 0xc9, 0xeb, 0xa7, 0xed, 0x52, 0xc9, 0xeb, 0xe1, 0xc5, 
-0x42, 0x4b, 0x5e, 0x23, 0x56, 0x1b, 0x7a, 0xb7, 0xfa, 0x3d, 0xfc, 0x23, 0x79, 0xbe, 0xca, 0x37, 
-0xfc, 0x23, 0x23, 0x23, 0xc3, 0x25, 0xfc, 0x23, 0x78, 0xbe, 0xc2, 0x32, 0xfc, 0x23, 0x7e, 0x23, 
-0x66, 0x6f, 0xc1, 0xe9, 0xeb, 0xaf, 0xed, 0x52, 0x67, 0x3f, 0xce, 0x0, 0x6f, 0xc9, 0xeb, 0xaf, 
-0xed, 0x52, 0x67, 0xce, 0x0, 0x6f, 0xc9, 0xeb, 0x7b, 0xe6, 0x1f, 0x5f, 0xca, 0x15, 0xfc, 0x7c, 
-0xb7, 0x1f, 0x67, 0x7d, 0x1f, 0x6f, 0x1d, 0xc2, 0x5f, 0xfc, 0xb4, 0xc9, 0x7c, 0xaa, 0x67, 0x7d, 
-0xab, 0x6f, 0xb4, 0xc9, 0xd1, 0x21, 0x2, 0x0, 0x39, 0xc5, 0xd5, 0x11, 0xfd, 0x4, 0x1, 0x6, 
-0x0, 0xed, 0xb0, 0x21, 0x88, 0xfc, 0xe3, 0xe9, 0xc1, 0x7c, 0xb5, 0xc9, 0x23, 0x23, 0x7e, 0x23, 
-0x66, 0x6f, 0xb4, 0xc9, 0xc5, 0xaf, 0x32, 0x3, 0x5, 0x32, 0x4, 0x5, 0x32, 0x5, 0x5, 0x6f, 
-0x67, 0x22, 0x6, 0x5, 0xcd, 0xbf, 0xf5, 0x21, 0x4, 0x0, 0x39, 0x4e, 0x23, 0x46, 0xa, 0xfe, 
-0x2d, 0xc2, 0xba, 0xfc, 0x32, 0x3, 0x5, 0xc3, 0xbf, 0xfc, 0xfe, 0x2b, 0xc2, 0xc0, 0xfc, 0x3, 
-0xa, 0xfe, 0x30, 0xda, 0xef, 0xfc, 0xfe, 0x3a, 0xd2, 0xef, 0xfc, 0xf5, 0xcd, 0x1e, 0xfa, 0xcd, 
-0xa6, 0xf2, 0xf1, 0xd6, 0x30, 0x6f, 0x26, 0x0, 0xcd, 0xbf, 0xf5, 0xcd, 0xf, 0xf3, 0x3a, 0x5, 
-0x5, 0xb7, 0xca, 0xbf, 0xfc, 0x2a, 0x6, 0x5, 0x2b, 0x22, 0x6, 0x5, 0xc3, 0xbf, 0xfc, 0xfe, 
-0x2e, 0xc2, 0x1, 0xfd, 0x21, 0x5, 0x5, 0x7e, 0xb7, 0xc2, 0x1, 0xfd, 0x36, 0x1, 0xc3, 0xbf, 
-0xfc, 0x21, 0x0, 0x0, 0xf6, 0x20, 0xfe, 0x65, 0xc2, 0x4e, 0xfd, 0x3, 0xa, 0xfe, 0x2d, 0xc2, 
-0x18, 0xfd, 0x32, 0x4, 0x5, 0xc3, 0x1d, 0xfd, 0xfe, 0x2b, 0xc2, 0x1e, 0xfd, 0x3, 0xa, 0xfe, 
-0x30, 0xda, 0x38, 0xfd, 0xfe, 0x3a, 0xd2, 0x38, 0xfd, 0xd6, 0x30, 0x29, 0x54, 0x5d, 0x29, 0x29, 
-0x19, 0x5f, 0x16, 0x0, 0x19, 0xc3, 0x1d, 0xfd, 0x3a, 0x4, 0x5, 0xb7, 0xca, 0x46, 0xfd, 0x7c, 
-0x2f, 0x67, 0x7d, 0x2f, 0x6f, 0x23, 0xeb, 0x2a, 0x6, 0x5, 0x19, 0x22, 0x6, 0x5, 0x2a, 0x6, 
-0x5, 0x7c, 0xb7, 0xf2, 0x94, 0xfd, 0xfe, 0xff, 0xc2, 0xae, 0xfd, 0x7d, 0x2f, 0x3c, 0x4f, 0xfe, 
-0xa6, 0xd2, 0xae, 0xfd, 0xfe, 0x96, 0xda, 0x7b, 0xfd, 0xcd, 0xf4, 0xf1, 0x47, 0x23, 0x86, 0xf2, 
-0x6f, 0xc1, 0x0, 0x0, 0xcd, 0xe4, 0xf3, 0x79, 0xd6, 0x10, 0x4f, 0xcd, 0xa6, 0xf2, 0x21, 0x1, 
-0x0, 0xcd, 0xbf, 0xf5, 0xcd, 0x1e, 0xfa, 0xd, 0xc2, 0x84, 0xfd, 0xcd, 0xa6, 0xf2, 0xcd, 0xe4, 
-0xf3, 0xc3, 0xa4, 0xfd, 0xc2, 0xae, 0xfd, 0x7d, 0xb7, 0xca, 0xa4, 0xfd, 0x4f, 0xcd, 0x1e, 0xfa, 
-0xd, 0xc2, 0x9d, 0xfd, 0x3a, 0x3, 0x5, 0xb7, 0xca, 0xae, 0xfd, 0xcd, 0xb5, 0xf2, 0xc1, 0xc9, 
-0xcd, 0x90, 0xff, 0x21, 0x8, 0x0, 0x39, 0xe5, 0x21, 0xa, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 
-0xf4, 0xf1, 0x41, 0x5a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0xf, 0xf3, 0xe1, 0xcd, 0x28, 
-0xf2, 0x21, 0x8, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0xcd, 0xe2, 0xfd, 0xcd, 0x87, 
-0xff, 0xc9, 0xcd, 0xed, 0xfa, 0xf8, 0xff, 0x21, 0x10, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0x21, 0xcf, 
-0x1, 0xcd, 0xfb, 0xf1, 0xcd, 0x95, 0xf5, 0x28, 0x1e, 0x21, 0x10, 0x0, 0x39, 0xe5, 0xcd, 0x2, 
-0xf2, 0x41, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0x12, 0x0, 0x39, 0xcd, 0xfb, 0xf1, 
-0xcd, 0x8, 0xf3, 0xe1, 0xcd, 0x28, 0xf2, 0x21, 0x10, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0xf4, 
-0xf1, 0x44, 0x3b, 0x9a, 0xca, 0x0, 0x0, 0x0, 0x0, 0xcd, 0xb3, 0xf5, 0x28, 0xc, 0xcd, 0x2, 
-0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc9, 0x21, 0x10, 0x0, 0x39, 0xe5, 0x21, 
-0x12, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0x4a, 0xf2, 0xcd, 0x45, 0xec, 0xcd, 0x87, 0xff, 0xe1, 
-0xcd, 0x28, 0xf2, 0x21, 0x10, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0xf4, 0xf1, 0x42, 0x1, 0xe, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0xb3, 0xf5, 0x28, 0x1e, 0x21, 0x10, 0x0, 0x39, 0xe5, 0xcd, 
-0x2, 0xf2, 0x42, 0x2, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0x12, 0x0, 0x39, 0xcd, 0xfb, 
-0xf1, 0xcd, 0x8, 0xf3, 0xe1, 0xcd, 0x28, 0xf2, 0x21, 0x10, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 
-0xf4, 0xf1, 0x41, 0x5a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0xb3, 0xf5, 0x28, 0x1e, 0x21, 
-0x10, 0x0, 0x39, 0xe5, 0xcd, 0x2, 0xf2, 0x41, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 
-0x12, 0x0, 0x39, 0xcd, 0xfb, 0xf1, 0xcd, 0x8, 0xf3, 0xe1, 0xcd, 0x28, 0xf2, 0x21, 0x10, 0x0, 
-0x39, 0xe5, 0x21, 0xd7, 0x1, 0xcd, 0x9, 0xf2, 0xcd, 0xa6, 0xf2, 0xe1, 0xe5, 0xcd, 0x9, 0xf2, 
-0xcd, 0xe4, 0xf3, 0xe1, 0xcd, 0x28, 0xf2, 0x21, 0x4, 0x0, 0x39, 0xe5, 0x21, 0x12, 0x0, 0x39, 
-0xcd, 0x9, 0xf2, 0x21, 0x12, 0x0, 0x39, 0xcd, 0xfb, 0xf1, 0xcd, 0xe4, 0xf4, 0xe1, 0xcd, 0x28, 
-0xf2, 0x21, 0x4, 0x0, 0x39, 0xcd, 0x9, 0xf2, 0xcd, 0xf4, 0xf1, 0x3e, 0x2e, 0x2e, 0x53, 0xb4, 
-0xe4, 0xcc, 0xe9, 0xcd, 0xe4, 0xf4, 0xcd, 0xf4, 0xf1, 0xbf, 0xd, 0x0, 0xc0, 0x2a, 0x8e, 0x2f, 
-0x3e, 0xcd, 0xf, 0xf3, 0x21, 0x4, 0x0, 0x39, 0xcd, 0xfb, 0xf1, 0xcd, 0xe4, 0xf4, 0xcd, 0xf4, 
-0xf1, 0x40, 0x2, 0x22, 0x22, 0x1a, 0x42, 0x5c, 0xad, 0xcd, 0xf, 0xf3, 0x21, 0x4, 0x0, 0x39, 
-0xcd, 0xfb, 0xf1, 0xcd, 0xe4, 0xf4, 0xcd, 0xf4, 0xf1, 0xc0, 0x2a, 0xaa, 0xaa, 0xa9, 0x85, 0x76, 
-0xac, 0xcd, 0xf, 0xf3, 0x21, 0x4, 0x0, 0x39, 0xcd, 0xfb, 0xf1, 0xcd, 0xe4, 0xf4, 0x21, 0xbf, 
-0x1, 0xcd, 0xfb, 0xf1, 0xcd, 0xf, 0xf3, 0x21, 0x10, 0x0, 0x39, 0xcd, 0xfb, 0xf1, 0xc3, 0xe4, 
-0xf4, 0xeb, 0x2a, 0x3, 0x1, 0x1a, 0x77, 0x23, 0x13, 0x1a, 0x77, 0x23, 0x13, 0x1a, 0x77, 0x23, 
-0x13, 0x1a, 0x77, 0xc9, 0xeb, 0x2a, 0x3, 0x1, 0x7e, 0x12, 0x13, 0x23, 0x7e, 0x12, 0x13, 0x23, 
-0x7e, 0x12, 0x13, 0x23, 0x7e, 0x12, 0xc9, 0xe1, 0xd9, 0x21, 0x8, 0x0, 0x39, 0xf9, 0xd9, 0xe9, 
-0xe3, 0xc5, 0xcd, 0xec, 0xfa, 0xc1, 0xd1, 0x7c, 0xb5, 0xc9, 0x2a, 0x6, 0x0, 0xf9, 0xcd, 0xeb, 
-0xff, 0x1, 0x0, 0x0, 0xcd, 0x5, 0x0, 0xc3, 0xa1, 0xff, 0xcd, 0x74, 0xfc, 0xcd, 0xb5, 0xff, 
-0xeb, 0xc9, 0xcd, 0x74, 0xfc, 0x2a, 0xfd, 0x4, 0x44, 0x4d, 0x2a, 0xff, 0x4, 0xeb, 0xcd, 0x5, 
-0x0, 0xeb, 0x6f, 0x26, 0x0, 0xc9, 0xcd, 0x74, 0xfc, 0xcd, 0xd3, 0xff, 0x6f, 0x26, 0x0, 0xc9, 
-0xcd, 0x74, 0xfc, 0x2a, 0xfd, 0x4, 0xeb, 0x2a, 0x1, 0x0, 0x2b, 0x2b, 0x2b, 0x19, 0x19, 0x19, 
-0xeb, 0x2a, 0xff, 0x4, 0x44, 0x4d, 0x2a, 0x1, 0x5, 0xeb, 0xe9, 0xc3, 0x4e, 0x4, 0x1a, 0x1a, 
-0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 
-
-};
-dump_item dump_items[DUMP_NUM_ITEMS] = {
-{ "cpc6128_os", dump_cpc6128_os, 16384 },
+static const unsigned char dump_cpc6128_basic_lz4[] =
+"\xf0\x31\x80\x01\x02\x00\x40\xc0\x31\x00\xc0\xcd\xcb\xbc\xcd\x3f\xf5\xda\x00\x00\xaf\x32\x00\xac\x21\x33\xc0\xcd\x7d\xc3\xcd\xaa"
+"\xde\xcd\x37\xcb\xcd\xbb\xbd\xcd\xde\xc0\xcd\x45\xc1\x11\xf0\x00\xcd\xe9\xf7\x18\x25\x20\x42\x41\x53\x49\x43\x20\x31\x2e\x31\x0a"
+"\x0a\x00\x0c\x00\x51\xc3\x00\xcd\x48\xcf\x44\x00\xa0\x5c\xe8\xcd\x54\xe2\xcd\x01\xcb\x38\x5f\x52\x00\xf0\x1b\x66\xc1\xcd\xb5\xde"
+"\xdc\xb6\xbc\xcd\xd0\xc4\xcd\xd0\xc3\x3a\x2c\xae\xb7\xc4\x45\xc1\x3a\x90\xad\xd6\x02\x20\x09\x32\x90\xad\xcd\xaa\xcb\xeb\x38\xc9"
+"\x21\xd7\xc0\xcd\x8b\x6b\x00\xf0\x1d\x3a\x01\xac\xb7\x28\x1f\xcd\x0d\xc1\x30\xc3\xcd\x4d\xde\xcd\xcf\xee\x30\x0a\xcd\x4d\xde\xb7"
+"\x37\xcc\x64\xe8\x30\xe3\xd4\xde\xc0\x21\x8a\xac\x18\x08\xcd\xf9\xca\x30\xfb\xcd\x98\x22\x00\x30\xb7\x28\xca\x25\x00\xf0\x45\x0b"
+"\xcd\x4d\xfb\xcd\xa5\xe7\xcd\x8f\xc1\x18\xba\xcd\xa4\xdf\xcd\xd3\xc4\x2b\xc3\x60\xde\x52\x65\x61\x64\x79\x0a\x00\xaf\x18\x05\x22"
+"\x02\xac\x3e\xff\x32\x01\xac\xc9\x11\x0a\x00\x28\x02\xfe\x2c\xc4\x48\xcf\xd5\x11\x0a\x00\xcd\x41\xde\xdc\x48\xcf\xcd\x37\xde\xeb"
+"\x22\x04\xac\xe1\xcd\xe1\xc0\xc1\xc3\x87\xc0\x2a\x02\xac\xeb\xd5\xcd\x38\xe2\xf0\x00\xf0\x00\x01\xcb\xd1\xd0\xe5\x2a\x04\xac\x19"
+"\xd4\xe1\xc0\xe1\x37\xc9\x01\x01\xf0\x37\xc3\x58\xc0\xfe\xa3\x28\x0c\xe5\xcd\x78\xc1\xcd\x5f\xc1\xcd\x8f\xc1\xe1\xc9\xcd\x2c\xde"
+"\xc3\x3d\xbd\x2a\x62\xae\xeb\x2a\x5e\xae\xcd\xe4\xff\x62\x6b\x13\xaf\x77\xed\xb0\x32\x2c\xae\xcd\xea\xd5\xcd\x6f\xc1\xcd\x00\xd3"
+"\xaf\xcd\x97\xbd\xcd\xcc\xfb\xcd\x20\xda\xc3\xa1\xc1\xcd\xc5\xde\x5d\x00\x70\x89\xc1\xc5\xe5\xcd\x8c\xf6\x24\x00\xf0\x3f\x38\xd6"
+"\xcd\x4d\xea\xe1\xc1\xc9\xcd\x99\xf2\xcd\x61\xe7\xcd\xac\xcc\xcd\x7e\xcc\xcd\xa3\xc9\xcd\x4f\xf6\xcd\x0e\xd6\xc3\xd4\xdc\xaf\xcd"
+"\xb3\xc1\xaf\xe5\xf5\xfe\x08\xdc\xb4\xbb\xf1\x21\x06\xac\x18\x04\xe5\x21\x07\xac\xd5\x5f\x7e\x73\xd1\xe1\xc9\x3a\x06\xac\xfe\x08"
+"\xc9\x3a\x07\xac\xfe\x09\xc9\xcd\xfb\xc1\x18\xd7\x05\x00\xf0\x57\x18\xcd\xfb\xc1\xcd\xb3\xc1\xc1\xf5\xcd\xc4\xc1\xcd\xed\xc1\xf1"
+"\x18\xce\xcd\xfb\xc1\xfe\x08\x30\x31\xc1\xcd\xa6\xc1\xf5\x7e\xfe\x2c\xcd\xfc\xff\xf1\xc3\xa6\xc1\x7e\xfe\x23\x3e\x00\xc0\xcd\x0d"
+"\xc2\xf5\xcd\x41\xde\xd4\x37\xde\xf1\xc9\xcd\x25\xde\x23\x3e\x0a\xc5\xd5\x47\xcd\xb8\xce\xb8\xd1\xc1\xd8\xc3\x4d\xcb\x3e\x02\x18"
+"\xef\xcd\xe5\xc1\x01\x90\xbb\xc4\x3f\xc2\xcd\x41\xde\xd0\xcd\x20\xc2\x01\x9f\xbb\x18\x09\x15\x00\xf0\x13\x96\xbb\xcd\x71\xc2\xe5"
+"\xcd\xfc\xff\xe1\xc9\xcd\x62\xc2\xe5\xcd\x38\xbc\xe1\xc9\xcd\x71\xc2\xf5\xcd\x15\xde\xcd\x62\xc2\xf1\xe5\xcd\x32\x11\x00\x30\x6a"
+"\xc2\x41\x39\x00\xf0\x04\x3e\x20\xcd\x13\xc2\x4f\xc9\x3e\x10\x18\x9e\x3e\x03\xcd\x13\xc2\xe5\xcd\x0e\x1e\x00\xf0\x26\xe5\xc1\xe5"
+"\xcd\x6c\xbb\xe1\xc9\xcd\x0d\xc2\xfe\x08\x30\x8d\xf5\xcd\x1d\xde\xf1\xc3\xec\xc1\xcd\x89\xc2\xcd\x60\xbb\xc3\x78\xfa\xcd\x89\xc2"
+"\xe5\xcd\xc7\xc2\x18\x0a\xcd\x0d\xc2\xcd\x90\xc2\xe5\xcd\xb9\xc2\xcd\x32\x71\x00\xf2\x49\xbe\xc1\x3a\x08\xac\xc8\x3a\x0a\xac\xd0"
+"\xc3\xec\xc3\xcd\x78\xbb\xcd\x87\xbb\x7d\xc9\xcd\xbe\xc1\x28\x0d\xd0\xd5\xe5\xcd\x69\xbb\x7a\x94\x3c\xe1\xd1\x37\xc9\x3a\x09\xac"
+"\xfe\xff\xc9\xe5\x67\xcd\xcf\xc2\x3f\x38\x0e\x6f\xcd\xb9\xc2\x3d\x37\x28\x06\x84\x3f\x30\x02\x3d\xbd\xe1\xc9\xcd\xe5\xc1\xcd\x51"
+"\xc3\xe5\xeb\x24\x2c\xcd\x75\xbb\xe1\xc9\xfe\xe7\x28\x16\x13\x00\x10\xd5\xc4\x00\x80\x51\xc3\xe3\x7a\x55\x6f\xcd\x66\x9f\x00\xf0"
+"\x27\x2c\xde\xcd\x3e\xc3\x4f\xcd\x41\xde\x3e\x00\xdc\x3e\xc3\x47\xe5\xcd\xb7\xbb\xe1\xc9\x3e\x08\xc3\x13\xc2\xcd\xe5\xc1\x3e\xff"
+"\x18\x04\xcd\xe5\xc1\xaf\xc3\x63\xbb\xcd\x58\xc3\x53\xcd\x15\xde\xd5\xcd\xc3\xce\xd1\x5f\x1d\x61\x00\xc0\x28\x0a\xcd\x20\xc2\xb7"
+"\xcc\x84\xbb\xc4\x81\xbb\x09\x01\x00\x0e\x00\xf0\x37\xca\x7e\xbb\xc3\x7b\xbb\xe5\x21\x01\x84\x22\x08\xac\xcd\x69\xc4\xcd\xa1\xc1"
+"\xe1\xf5\xe5\x7e\x23\xb7\xc4\xa0\xc3\x20\xf8\xe1\xf1\xc9\xf5\x3e\x0a\xcd\xa0\xc3\xf1\xc9\xf5\xc5\xcd\xa8\xc3\xc1\xf1\xc9\xfe\x0a"
+"\x20\x0c\xcd\xbe\xc1\xca\xf5\xc3\xd2\x31\xc4\xc3\xe2\xc3\xf5\xc5\x4f\xcd\xc1\x19\x00\x01\x03\x02\xf0\x18\xca\xfc\xc3\xd2\x38\xc4"
+"\x79\xc3\xe9\xc3\xaf\xcd\x63\xbb\xaf\xe5\xcd\x9f\xbb\xe1\xcd\x54\xbb\xcd\xec\xc3\x3d\xc8\x3e\x0d\xcd\xe9\xc3\x3e\x0a\xc3\x5a\xbb"
+"\xc5\x49\x01\xf0\x30\x7c\xe1\xc1\xc9\x0e\x0d\xcd\xfc\xc3\x0e\x0a\xe5\x2a\x08\xac\xcd\x11\xc4\x32\x08\xac\xe1\x79\xcd\x2b\xbd\xd8"
+"\xcd\x72\xc4\x18\xf6\x79\xee\x0d\x28\x10\x79\xfe\x20\x7d\xd8\x24\x28\x08\xbc\x20\x05\xcd\x98\xc3\x3e\x01\x3c\xc0\x3d\xc9\xcd\xc3"
+"\xce\x32\x09\xac\x3c\x00\x20\x38\xc4\x3c\x00\x40\x0a\xac\x26\xff\x3e\x00\x10\x0a\x3e\x00\xf0\x03\x95\xbc\xd8\x20\x19\xc3\x37\xcc"
+"\xe5\xcd\x89\xbc\x28\xf7\x3f\x9f\xcd\x2d\xa3\x01\xf0\x23\x80\xbc\xd8\x28\xea\xee\x0e\xc0\xcd\x45\xcb\x1f\x3e\x01\x32\x0a\xac\xc9"
+"\xc3\x09\xbb\xcd\x09\xbb\xd0\xfe\xfc\xc0\xcd\xa1\xc4\xda\x3e\xcc\xe5\xc5\xd5\x11\x92\xc4\x0e\xfd\x3a\x0b\xac\xb7\xc4\x45\xbb\xd1"
+"\x53\x03\xf2\x46\x09\xbb\x30\x04\xfe\xef\x20\xf7\xcd\xa1\xc4\xc3\xf2\xc8\xc5\xd5\xe5\xcd\xb6\xbc\xf5\xcd\x40\xbd\x47\xcd\x81\xbb"
+"\xcd\x06\xbb\xfe\xef\x28\xf9\xcb\x48\xc4\x84\xbb\xfe\xfc\x37\x28\x0b\xfe\x20\xc4\x0c\xbb\xf1\xf5\xdc\xb9\xbc\xb7\xe1\xe1\xd1\xc1"
+"\xc9\xaf\x18\x02\x3e\xff\x32\x0b\xac\xe5\xcd\x48\xbb\x18\xa2\xcd\x8c\xc5\xc5\xd5\xcd\x41\xde\x30\x17\x0a\x00\x20\x15\xde\x08\x00"
+"\x91\xe3\xcd\xd2\xbb\xe1\xd1\xe3\xcd\xcf\x06\x00\x10\xc9\xde\x01\x80\x3d\xde\xd4\xb4\xc5\xe5\xcd\xdb\x0c\x00\xf0\x2d\x71\xc2\xe5"
+"\xf5\xcd\x64\xfc\xcd\xfc\xf6\x01\x1d\x00\xcd\xde\xff\x3e\x07\xda\x55\xcb\xeb\xf1\xcd\x52\xbd\xe1\xc9\x01\xc0\xbb\x18\x17\x01\xc3"
+"\xbb\x18\x12\x01\xf6\xbb\x18\x0d\x01\xf9\xbb\x18\x08\x01\xea\xbb\x18\x03\x01\xed\xbb\xc5\xcd\x8c\xc5\x6c\x00\x51\x05\xfe\x2c\xc4"
+"\xba\x0a\x00\x31\x0a\x3e\x04\xe9\x02\x71\x59\xbc\xe1\xe3\xc5\xe3\xc1\x29\x03\x20\x01\xf0\x2e\x00\x12\xf3\x2e\x00\x23\x1d\xde\x18"
+"\x00\x02\xd3\x02\x21\xd8\xce\x77\x02\xe4\xd8\xce\x42\x4b\xd1\xc9\xfe\xba\x28\x13\xcd\x25\xde\xbb\x4e\x00\x00\x7a\x03\xb0\xc3\x46"
+"\xbd\xcd\x2c\xde\xcd\x71\xc2\xc3\xe4\x7b\x03\x10\xc3\x1e\x00\x83\x28\x06\xcd\xb8\xce\xcd\x4c\xbd\x5b\x02\xf0\x5f\xc3\x49\xbd\xcd"
+"\xec\xd6\xe5\xc5\xd5\xcd\x76\xca\x22\x12\xac\xd5\xe5\xeb\xcd\xd9\xc6\xcc\x5d\xf6\xe1\xcd\x3d\xde\x11\x00\x00\xd4\xbf\xd6\x44\x4d"
+"\xe1\xe3\x7a\xb3\xc4\xd8\xff\xc2\x9e\xc6\xeb\xcd\xb1\xde\xe3\xcd\xad\xde\xe1\xf1\xe3\xd5\xc5\xe5\x01\x05\x16\xb9\x28\x09\x01\x02"
+"\x10\xb9\x3e\x0d\xc2\x55\xcb\x78\xcd\x72\xf6\x73\x23\x72\x23\xe3\xcd\x21\xde\xcd\x62\xcf\x79\xcd\xff\xfe\xe5\x21\x0d\xac\xcd\x83"
+"\xff\xe1\xcd\x25\xde\xec\xcd\x62\xcf\xe3\x14\x00\xf0\x03\xcd\x83\xff\xeb\xe3\xeb\x21\x01\x00\xcd\x35\xff\xeb\x7e\xfe\xe6\x20\x06"
+"\xa4\x00\x02\x30\x00\xc0\xe3\xcd\x83\xff\xcd\xc4\xfd\xeb\x77\x23\xeb\xe1\x6d\x05\x00\x4f\x00\x00\x74\x00\x10\xeb\x09\x00\x10\xd1"
+"\x05\x00\x40\xed\x5b\x12\xac\x08\x00\x20\x70\xd1\x5b\x00\xf0\x09\x87\xff\xaf\x32\x0c\xac\xe1\xcd\xad\xde\x2a\x12\xac\x18\x09\xcd"
+"\x45\xcb\x01\x3e\xff\x32\x0c\xac\xc5\x00\xf0\x15\x20\xf1\xeb\xcd\x5d\xf6\xeb\xe5\xcd\x02\xc7\x28\x0f\xf1\x23\x5e\x23\x56\x23\x7e"
+"\x23\x66\x6f\xcd\xad\xde\xeb\xc9\x01\x05\x00\x09\x5e\x23\x56\xe1\x21\x00\xf0\x20\xcd\x41\xde\x38\xcf\xc9\x2a\x6f\xb0\xe5\x2b\x46"
+"\x23\x7d\x90\x6f\x9f\x84\x67\xe3\x78\xfe\x07\x38\x0f\x20\x00\xe5\x2b\x2b\x7e\x2b\x6e\x67\xcd\xd8\xff\xe1\x20\x04\xeb\xe1\x78\xc9"
+"\xe1\x18\xda\x48\x00\xf0\x11\xe5\xfe\x10\x28\x2c\x01\x05\x00\x79\xeb\xcd\x6c\xff\xe1\x3a\x0c\xac\xb7\x28\x10\xe5\x09\xcd\x0c\xfd"
+"\xe1\xe5\x2b\x56\x2b\x5e\xeb\xf3\x00\xf1\x02\xe5\x0e\x05\xcd\x49\xfd\xe1\x01\x0a\x00\x09\x96\xc9\xeb\x5e\x23\x56\x27\x00\x42\x16"
+"\xe3\xe5\x23\x87\x00\xf1\x33\x4a\xdd\x3e\x06\xd2\x55\xcb\xeb\xe1\xe3\x72\x2b\x73\xe1\x7e\x23\xe5\x66\x6f\xeb\xcd\x02\xde\xe1\x23"
+"\x23\x23\x96\xc9\xcd\x62\xcf\xfe\xa0\x28\x04\xcd\x25\xde\xeb\xcd\xc4\xfd\xcc\x5b\xe9\xc8\xcd\x3d\xde\xd8\xfe\x1e\x28\x05\xfe\x1d"
+"\xc2\x8f\xde\xcd\x27\xe8\xc0\xeb\xc9\x06\x00\xa0\x0e\x00\xe5\x3e\x06\xcd\x72\xf6\x71\x23\x16\x01\x05\x2c\x01\xf9\x01\x36\x06\x23"
+"\xcd\x5d\xf6\xe1\xc9\xc0\xcd\xcf\xc7\xcd\x5d\xf6\x4e\xff\x00\x90\x79\xfe\x01\xd8\xca\x51\xc9\xc3\x61\xf6\x00\x50\x2b\x7e\xf5\x7d"
+"\x96\xf5\x00\xf5\x11\x23\xf1\xfe\x06\xc8\xb7\x20\xef\xcd\x45\xcb\x03\xe5\xcd\xc9\xca\xe5\xeb\x22\x14\xac\xcd\x5d\xc8\xcc\x5d\xf6"
+"\x3e\x07\xcd\x72\xf6\x5c\x00\x01\x88\x01\x21\xeb\xe3\x94\x01\x20\x36\x07\x68\x00\xf0\x0e\xeb\xd1\x18\x2a\xc0\xeb\xcd\x5d\xc8\x3e"
+"\x1e\xc2\x55\xcb\xe5\x11\x07\x00\x19\xcd\x5d\xf6\xcd\xb1\xde\x22\x14\xac\xe1\x31\x01\x10\xeb\x76\x01\x00\x09\x00\x00\x82\x01\xf0"
+"\x05\xd5\xcd\x62\xcf\xcd\xc4\xfd\xd1\xc0\x2a\x14\xac\xcd\xad\xde\x3e\x07\xcd\x62\xf6\x89\x01\x01\x8e\x00\x13\xe5\x8d\x00\x95\xe3"
+"\x7e\xfe\x07\x38\x0e\x20\x0e\x2b\x83\x01\xf0\x15\x20\x02\xe1\xc9\xe1\x18\xde\xfe\x9c\xca\xb8\xcc\xcd\xb8\xce\x4f\x7e\xfe\xa0\xf5"
+"\x28\x05\xcd\x25\xde\x9f\x2b\xcd\x2c\xde\x0d\x28\x0a\xcd\x48\xcf\xcc\x01\x20\xf5\xf1\x1a\x01\xf0\x20\xc4\xa3\xe9\xf1\xc2\x90\xc7"
+"\xeb\xc9\xaf\x32\x16\xac\xcd\xfb\xbc\x30\x1d\x47\x3a\x16\xac\xe6\x7f\x32\x16\xac\xc5\xe5\xcd\xfe\xbc\xe1\xc1\x3a\x16\xac\x17\xf5"
+"\x78\xd4\x01\xbd\xf1\x17\x30\xde\x1c\x00\x70\x04\xc4\x7f\xc4\x2a\x1b\xae\x0b\x00\xf0\x1c\x03\xc8\x1f\xda\x3e\xcc\x23\xf1\xc3\x77"
+"\xde\x22\x1c\xac\x3e\x04\x30\x52\x2a\x1a\xac\x7c\xb5\xc4\xb5\xde\x3e\x41\x30\x46\xc5\xcd\xb9\xbc\xc1\x11\x17\xac\x0e\x02\x18\x22"
+"\xd5\x81\x00\xf1\x18\xcd\x27\xe8\x42\x4b\xd1\xe5\x21\x0a\x00\x19\x71\x23\x70\xe1\xc9\x23\x23\x23\xeb\xcd\xb5\xde\x3e\x40\x30\x1a"
+"\x0e\x01\xd5\xcd\x93\xc7\x2a\x1b\xae\xeb\xe1\x70\xa3\x01\xf0\x01\x5e\x23\x56\xeb\x22\x1b\xae\x3e\xc2\x21\x16\xac\xb6\x77\xc9\x7e"
+"\x9a\x01\xf1\x02\xd5\x01\xf7\xff\x09\xcd\x01\xbd\xe1\x18\x11\x7e\x2a\x1c\xac\x01\xfc\x0e\x00\xf3\x0d\xcd\x7f\xc4\x2a\x18\xac\xf1"
+"\xc3\x60\xde\xcd\x7c\xc9\xc3\x2c\xde\xfe\x8b\xca\xd0\xc4\xfe\xce\x11\x00\x00\x28\x08\x76\x00\xf0\x02\x2b\xed\x53\x1a\xac\xc3\xd3"
+"\xc4\xe5\xcd\x04\xbd\xe1\xc9\xe5\xcd\x07\xa4\x06\xf0\x65\xa7\xbc\x21\x42\xac\x06\x04\xe5\xcd\xec\xbc\xe1\x11\x12\x00\x19\x10\xf5"
+"\xcd\x48\xbb\xcd\xf5\xbc\x21\x00\x00\x22\x1a\xac\xcd\x7f\xc4\x21\x1e\xac\x11\x05\x03\x01\x00\x08\xcd\xda\xc9\x21\x48\xac\x11\x0b"
+"\x04\x01\x01\x02\xc5\xd5\x0e\xfd\x11\x26\xc9\xcd\xef\xbc\xd1\xd5\x16\x00\x19\xd1\xc1\x79\xb7\x28\x02\xcb\x00\x15\x20\xe6\xc9\xcd"
+"\x19\xde\xcd\xb8\xce\xf5\xcd\x10\xca\xb7\x20\x1d\xcd\x1d\xde\xcd\x11\xc9\xf1\xe5\xeb\xcd\xb0\xbc\xe1\xc9\x1f\x11\x1e\xac\xd8\x1f"
+"\x11\x2a\x05\x00\x20\x36\xac\x02\x08\xe0\xcd\xce\xce\x01\x00\x00\x18\x05\xcd\xce\xce\x42\x4b\xd5\xd8\x04\xf0\x0a\x11\x00\x00\xdc"
+"\xd8\xce\xeb\xcd\x62\xca\xe5\x01\x06\x00\x09\xeb\xcd\x11\xc9\xd1\xc1\xe3\xeb\xcd\xe9\xd0\x07\xf1\x16\xb6\xfe\xcd\x62\xca\xcd\xec"
+"\xbc\x38\x03\x11\x00\x00\xeb\xc3\x35\xff\x7c\xb7\x20\xb9\x7d\xfe\x04\x30\xb4\x87\x87\x87\x85\x87\x6f\x01\x42\xac\x09\xc9\x7b\x02"
+"\xf3\x0c\x2b\x06\x01\x0e\x1a\xcd\xdd\xe9\xe5\xcd\x2c\xde\xfe\xb0\x28\x08\xe1\xfe\x9e\x20\xee\x04\x18\xeb\xf1\xeb\xe5\x96\x04\xf0"
+"\x01\xeb\x05\x28\x24\xcd\x2c\xde\x28\x0e\xc5\xd5\xcd\xbf\xd6\xd1\xc1\x5e\x05\x80\x02\x10\xf2\x2b\x78\xb7\x28\x0c\x43\x00\x01\xba"
+"\x04\x80\xeb\x18\xb9\xd1\xc3\x2c\xde\x2b\x11\x00\x63\xeb\x06\x00\x04\x0e\x1d\x54\x00\xb0\xe1\xfe\xd6\x28\xf1\xfe\xd5\x20\xee\x10"
+"\xec\xa7\x09\xf0\x42\x2c\xde\xcd\xf9\xca\xd8\xcd\xa1\xc1\x31\x00\xc0\xc3\x5d\xde\x21\x8a\xac\x36\x00\xc3\x5e\xbd\x21\x8a\xac\xcd"
+"\x5e\xbd\xc3\x98\xc3\xc5\x21\x8a\xac\xe5\x06\x00\x0e\xf5\x36\x00\xcd\x5c\xc4\x30\x1a\xfe\x0d\x28\x10\x4f\x04\x10\x04\xfe\x0a\x28"
+"\xeb\x77\x23\x10\xe9\xcd\x45\xcb\x17\x79\xfe\x0a\x28\xde\x37\xe1\xc1\xc9\xaf\x32\x91\xad\xc3\x0a\xf2\x1f\xb1\xde\x22\x8c\xad\xc9"
+"\xe3\x7e\x18\x0c\x3e\x02\x18\x08\x3e\x05\x18\x04\xcd\xc3\xce\xc0\xcd\x3b\xcb\x2a\x1b\xae\x22\x8e\xad\xcd\x83\xcc\xcd\x3c\xf6\x31"
+"\x00\xc0\x2a\x19\xae\xcd\x6e\xf6\x07\x0a\xf0\x28\xcd\xaa\xcb\x2a\x96\xad\xeb\x21\x98\xad\x30\x0c\x7a\xb3\x28\x08\xa6\x20\x05\x35"
+"\xeb\xc3\x77\xde\x36\x00\x3a\x90\xad\xcd\x8c\xce\x2a\x8c\xad\xcd\xad\xde\x3a\x90\xad\xee\x20\x20\x04\x3a\x91\xad\x17\xd4\x04\xcc"
+"\xc3\x58\xc0\x17\x00\xf0\x15\xb8\xde\xd8\x21\x00\x00\xc9\xd5\xe5\x21\xf6\xcd\x1e\x0b\x18\x07\xd5\xe5\x21\xbf\xcd\x1e\x06\xf5\xe5"
+"\x2a\x96\xad\x7c\xb5\xe1\x7b\xc2\x55\xcb\xaf\xe5\x09\xf0\x4d\xeb\xcd\x79\xce\xeb\xcd\x98\xc3\xf1\xcd\xa6\xc1\xf1\xe1\xd1\xc9\xcd"
+"\xd0\xc3\x21\xf1\xcb\xcd\x15\xcc\x18\x1c\x55\x6e\x64\x65\x66\x69\x6e\x65\x64\x20\x6c\x69\x6e\x65\x20\x00\x11\x1c\xcc\xcd\xa1\xc1"
+"\xcd\xd0\xc3\xcd\x79\xce\xcd\xb5\xde\xd0\xeb\x21\x21\xcc\xcd\x8b\xc3\xeb\xc3\x44\xef\x42\x72\x65\x61\xeb\x20\x69\x6e\x20\x00\xc0"
+"\xe5\xcd\x01\xcc\xe1\xcd\x66\xcc\x18\x32\xc0\x06\x00\xf0\x21\x23\x32\x91\xad\xcd\x45\xcb\x20\xcd\x01\xcc\x2a\x1b\xae\xcd\x83\xcc"
+"\x18\x1a\xcd\xb5\xde\x30\x12\xcd\x7e\xcc\x3a\x98\xad\xb7\x3e\x13\xc2\x55\xcb\xcd\xed\xd2\xcd\xf5\xd2\xcd\xaa\xde\xc3\x58\xc0\x3d"
+"\x03\xf0\x0a\xeb\xd0\x7e\xfe\x01\x28\x0b\x23\x7e\x23\xb6\x28\x07\x23\xcd\xad\xde\x23\x18\x05\x21\x00\x00\x18\x0c\x1d\x00\x10\xd0"
+"\x5c\x04\xf0\x06\x94\xad\xeb\x22\x92\xad\xc9\xc0\x2a\x92\xad\x7c\xb5\x3e\x11\xca\x55\xcb\xe5\x2a\x94\x0c\x01\xf0\x03\xcd\xb9\xbc"
+"\xe1\xc3\x60\xde\xaf\x32\x98\xad\x11\x00\x00\xed\x53\x96\xad\x79\x0b\xf1\x02\xcd\x25\xde\xa0\xcd\x48\xcf\xe5\xcd\x5c\xe8\xeb\xe1"
+"\x18\xe9\xcd\xb0\x7c\x00\xa0\xc8\xc3\x64\xcb\x28\x11\xfe\xb0\x28\x14\x4f\x05\x41\xcd\xfa\xcc\xeb\xf6\x03\x31\xcd\xfa\xcc\x79\x03"
+"\xa1\x2c\xde\xc0\xcd\xfa\xcc\x23\xc3\xa3\xe9\xa9\x00\xb0\x14\xca\x55\xcb\xaf\x32\x90\xad\x32\x98\xad\x60\x01\xf0\x64\xad\xde\x2a"
+"\x8e\xad\xc9\x70\xe5\x69\xee\x65\xf2\x65\xf8\x69\x6f\xee\x20\x66\xf5\x63\x6f\xed\x72\x61\xee\x74\x20\xef\x6d\x65\xee\x74\x65\xe4"
+"\x57\x45\x4e\xc4\x6f\x00\xee\x46\x69\x6c\x65\xa0\x6e\x6f\x74\xa0\x74\x6f\x6f\xa0\x20\x6d\x69\xf3\x4c\x01\x65\xa0\x4e\x45\x58\xd4"
+"\x73\x04\xa0\x05\x6c\xec\x20\x02\x72\x6f\xf2\x52\x45\x53\x55\x4d\xc5\x53\x74\x72\x01\x67\xa0\x20\x06\x6d\x61\x6e\xe4\x10\x73\x01"
+"\xe7\x55\x6e\x6b\x6e\x6f\x77\xee\x0f\x6c\x6f\x6e\xe7\x61\x6c\x72\xa9\x0c\xf0\xff\x03\xa0\x55\x6e\x03\x70\x65\x63\x0a\xa0\x69\x72"
+"\x65\x63\x74\x98\x1a\x95\x1d\x92\x53\x79\x6e\x74\x61\x78\x95\x1d\x52\x45\x54\x55\x52\xce\x44\x41\x54\x41\x20\x03\x68\x61\x75\x73"
+"\x8a\x49\x6d\x70\x72\x6f\x00\x72\x20\x61\x72\x67\x75\x09\xf4\x4f\x76\x02\x66\x6c\x6f\xf7\x4d\x65\x6d\x6f\x72\x79\x94\x11\x64\x6f"
+"\x65\x73\x20\x0e\x03\x69\x73\xf4\x53\x75\x62\x73\x63\x72\x69\x70\x08\x75\x08\x66\x20\x07\x67\xe5\x41\x72\x72\x61\x79\x20\x1c\x64"
+"\x69\x09\x73\x04\x65\xe4\x44\x69\x76\x69\x13\x62\x79\x20\x7a\x02\xef\x49\x6e\x76\x61\x6c\x69\x64\x20\x64\x9e\x54\x79\x00\x10\x6d"
+"\x61\x74\x63\xe8\x17\x73\x70\x61\x63\x65\x94\x17\x9b\x17\x03\x70\x72\x65\x73\x13\x0f\x06\x70\x6c\x83\x43\x61\x6e\x0e\x43\x4f\x4e"
+"\x54\x01\x75\xe5\x1a\x20\x75\x73\x02\x05\x6e\x63\x74\x84\x16\x99\x1d\x96\x44\x1e\x20\x66\x6f\x75\x6e\xe4\x4f\x00\x07\x64\x99\x11"
+"\x9b\x45\x4f\x46\x20\x6d\x65\xf4\x0d\x74\x79\x00\x95\x12\x99\x0d\x1c\x8c\x1a\x98\x0b\x99\x1d\x8b\x0d\x0e\x8c\x42\x72\x6f\x6b\x65"
+"\x6e\x20\x81\x11\x14\xcd\xcd\x92\xce\xd5\x1a\xe6\x7f\xfe\x20\xd4\xa0\xc3\xdc\x73\xce\xd1\x1a\x13\x17\x30\xee\xc9\x11\x94\xcd\xfe"
+"\x21\xd0\xb7\xc8\xc5\x47\x10\x00\x7f\xfb\x10\xf9\xc1\xc9\xd3\xc7\x01\x00\x04\xb1\xcd\xd8\xce\xf5\x7a\xb7\x20\x0b\xf1\x7b\xc9\x0b"
+"\x00\x61\xb3\x20\xf1\xc3\x4d\xcb\x0b\x00\x20\x17\x38\x32\x06\x90\x62\xcf\xf5\xeb\xcd\xb6\xfe\xeb\xf1\x7c\x07\xd0\xcd\x66\xff\x20"
+"\x0d\xe5\x2a\xa0\xb0\xcd\x58\xfb\xeb\xad\x0c\xa1\xcf\xf5\xc5\xe5\xcd\xeb\xfe\xeb\xe1\xc1\x20\x00\xf0\x00\xc3\xf5\xfb\xcd\x62\xcf"
+"\xc3\x5e\xff\x01\x01\x00\x11\xff\xff\x10\x0d\x00\x9f\x07\x41\x23\xc8\xfe\xf5\x87\x06\xe2\x42\x4b\xc8\xcd\x41\xde\xd8\xcd\x25\xde"
+"\xf5\x11\xff\xff\x0c\x00\xd2\x48\xcf\xc4\x41\xde\xeb\xcd\xde\xff\xda\x4d\xcb\xeb\xf7\x05\xd0\xfe\x1e\x28\x0e\xfe\x1d\xc2\x49\xcb"
+"\xe5\xeb\x23\x23\x08\x06\xc0\xe1\xc3\x2c\xde\xc5\x06\x00\xcd\x6d\xcf\xc1\x2b\xa4\x04\xf0\x09\xc5\xcd\x33\xd0\xe5\xe1\xc1\x7e\xfe"
+"\xee\xd8\xfe\xfe\xd0\xfe\xf4\x38\x45\xcc\x66\xff\x20\x12\xc5\x9b\x00\xf1\x1d\xe3\xcd\x33\xd0\xcd\x5e\xff\xe3\xcd\x1d\xf9\x18\xdc"
+"\x7e\xd6\xf4\x5f\x87\x83\xc6\xed\x5f\xce\xcf\x93\x57\xeb\x78\xbe\xeb\xd0\xc5\xcd\x74\xff\xd5\xc5\x1a\x47\xcd\x6e\xcf\xc1\xe3\x72"
+"\x08\x20\xeb\x79\x68\x07\xf1\x06\xfe\xff\x18\xae\x78\xfe\x0a\xd0\xc5\x7e\xd6\xed\x47\xcd\x66\xff\x11\x0b\xd0\x20\xd4\x50\x00\x31"
+"\xc5\x06\x0a\x2d\x00\xf1\x38\xc5\xcd\x3f\xf9\xc1\xcd\x13\xd0\x18\x86\x0c\x0c\xfd\x0c\x21\xfd\x12\x35\xfd\x12\x52\xfd\x16\x36\xd5"
+"\x10\x67\xfd\x06\x87\xfd\x0e\x79\xfd\x04\x92\xfd\x02\x9c\xfd\x0a\x0e\xd0\xc5\xcd\x49\xfd\xc1\xc6\x01\x8f\xa0\xc6\xff\x9f\xc3\x2d"
+"\xff\x06\x14\xcd\x6d\xcf\xe5\xcd\xb4\xfd\xe1\xc9\x06\x08\x0b\x00\x21\xa6\xfd\xf4\x0e\xf1\x39\x28\x1d\xfe\x0e\x38\x38\xfe\x20\x38"
+"\x52\xfe\x22\xca\x79\xf8\xfe\xff\xca\xda\xd0\xe5\x21\x59\xd0\xcd\xb4\xff\xe3\xc3\x2c\xde\xcd\x45\xcb\x16\x08\xd7\xd0\xf5\x1d\xd0"
+"\xf4\x36\xd0\x28\xd1\xd0\xfe\x28\xd0\xe3\x42\xd1\xe4\x8a\xd1\xac\xe2\xf9\x40\x4e\xd1\xcd\xc9\xd6\x30\x0b\xfe\x03\x28\x0f\xe5\x6f"
+"\x09\xf0\x25\xc9\xfe\x03\xc2\x1b\xff\x11\x91\xd0\xed\x53\xa0\xb0\xc9\x00\xd6\x0e\x5f\x16\x00\xfe\x0a\x38\x1b\x23\x5e\xfe\x0b\x28"
+"\x15\x23\x56\xfe\x0f\x38\x0f\xfe\x11\x38\x12\x20\x2a\x2b\x3e\x05\xcd\x6c\xff\x2b\x18\x18\xeb\x6b\x0a\x91\x18\x11\xe5\xfe\x0f\x20"
+"\x07\x13\xeb\x6b\x01\x40\xeb\xcd\x89\xfe\x6f\x01\x00\xc8\x01\xf0\x26\x1d\xde\xc3\x49\xcb\x23\x4e\xcd\x2c\xde\x79\xfe\x40\x38\x05"
+"\xfe\x4a\xda\x10\xd1\xcd\x19\xde\x79\x87\xc6\x1e\x4f\xfe\x59\x30\xe2\xfe\x1d\x38\x09\xcd\xd1\xd0\xe5\xcd\x02\xd1\xe1\xc9\x11\xe5"
+"\xd1\xe5\xeb\x06\x00\x09\xca\x08\xf1\x17\xe3\xc9\x87\x4f\x11\x97\xd0\x18\xee\x4f\xc4\x30\xd1\x48\xd1\x7e\xfa\x1d\xd5\xc1\xd5\x39"
+"\xd1\x61\xd1\x68\xd1\x2b\xd1\x3a\x91\xad\x18\x03\x3a\x90\xad\xe5\xad\x0b\x70\xe5\xcd\x0d\xbd\xcd\xa5\xfe\xa5\x07\xf0\x09\xaa\xcb"
+"\x18\x14\xe5\x2a\x5e\xae\x18\x0e\xcd\xc9\xd6\xd2\x4d\xcb\xe5\xeb\x78\xfe\x03\xcc\x58\xfb\x92\x00\x80\xc9\xe5\xcd\xc6\xbb\xeb\x18"
+"\x04\x07\x00\x20\xcd\x35\x15\x0d\x30\x25\xde\xe4\xf2\x04\x90\xeb\x3e\x0c\xd2\x55\xcb\xcd\xdb\xd6\x77\x09\x90\xeb\xc3\xa3\xe9\xcd"
+"\xdb\xd6\xc5\xe5\x58\x0a\xf0\x0d\xeb\x7c\xb5\x3e\x12\xca\x55\xcb\xcd\x2a\xda\x7e\xfe\x28\x20\x28\xcd\x2c\xde\xe3\xcd\x19\xde\xe3"
+"\xcd\x6a\xda\xe3\x6b\x09\x60\xe3\x78\xcd\x9f\xd6\xe1\x0c\x07\xb0\x06\xe3\xcd\x15\xde\x18\xe7\xcd\x1d\xde\xe3\xc6\x07\x22\x49\xda"
+"\xa9\x0b\xf0\x62\xc2\x49\xcb\xcd\x66\xff\xcc\x8a\xfb\xcd\x52\xda\xe1\xf1\xc3\xff\xfe\x64\xf9\x8f\xf9\x69\xf9\xe5\xfa\xd3\xf9\x43"
+"\xd2\x3f\xd2\xaa\xc2\xd8\xf9\x6a\xd2\x8d\xfa\x71\xc5\x76\xc5\x98\xc2\xa1\xc2\xb0\xfd\x6e\xfa\x7e\xd5\x74\xfa\xb6\xfe\x74\xd5\x14"
+"\xff\x60\xd5\x0e\xfe\x53\xfc\x56\xd4\x19\xf2\x13\xfe\x70\xd4\x69\xfa\x6a\xd5\x65\xd5\xec\xf8\x08\xf2\x50\xca\x2a\xff\x6f\xd5\xad"
+"\xfa\x7b\xd3\x31\xd5\xbc\xf9\x79\xd5\xeb\xfe\xfa\xf8\xbe\xfa\x06\xff\x18\x02\x06\x01\x00\x0a\xc0\x41\xde\xd2\x1d\xde\xcd\x74\xff"
+"\xcd\x62\xcf\xe5\x99\x02\x20\xc5\xe5\x2e\x0b\xa0\xc1\xb7\x28\x04\xb8\xc4\x6f\xff\xe1\x18\x42\x0c\x00\x1f\x00\x10\x41\x86\x0c\xf0"
+"\x07\xdc\xd8\xce\xcd\x1d\xde\xe5\xd5\x21\x27\x00\x19\x11\x4f\x00\xcd\xd8\xff\xd2\x4d\xcb\xd1\x37\x00\xf0\x1f\x43\xcd\xd5\xfd\xe1"
+"\xc9\xc0\xe5\xcd\x00\xd3\xcd\x2a\xf7\xcd\x9b\xbc\xca\x37\xcc\xe1\xc3\x61\xf7\xcd\xc7\xd2\xcd\x25\xf7\xcd\x69\xc4\xc3\x8c\xbc\xcd"
+"\xbe\xd2\xfe\x16\xc8\xcd\x45\xcb\x19\x16\x00\x50\x20\xf7\xc3\x77\xbc\x2c\x00\x70\x03\xcf\xe3\xeb\xcd\xdb\xd2\x31\x00\xf2\x13\xd8"
+"\xcd\x45\xcb\x1b\xd5\x78\xb7\x28\x0a\x7e\xfe\x21\x3e\x00\x20\x03\x23\x05\x2f\xc3\x6b\xbc\xe5\xcd\x7a\xbc\xe1\xc3\x59\xf7\xe5\xcd"
+"\x8f\x58\x00\x20\x5d\xf7\x5f\x0e\xb0\x7d\xbc\xcd\x59\xf7\xcd\x92\xbc\xcd\x5d\xf7\x43\x0e\x60\xcd\xb8\xce\x32\x99\xad\x00\x10\xb0"
+"\x4c\xd4\xed\x53\x9c\xad\xcd\x41\xde\x11\x14\xf2\x08\xf0\x00\xed\x53\xa0\xad\x01\x0c\x10\xcd\x5f\xd3\x32\x9f\xad\x0e\x00\x08\x00"
+"\x20\x9a\xad\x06\x00\x40\x9b\xad\x06\x20\x08\x00\xf0\x0d\x9e\xad\xcd\x37\xde\xe5\x21\x99\xad\xcd\xaa\xbc\xe1\xd8\xf1\xc3\x5d\xde"
+"\xcd\x41\xde\x79\xd0\x7e\xfe\x2c\x79\xc8\x53\x11\xb2\xd8\x18\x2b\x06\x08\xcd\x69\xd3\xe5\xcd\xb3\x2b\x09\xf0\x0e\x7d\xb7\x1f\x38"
+"\x06\x1f\x38\x03\x1f\x30\x12\xb4\x20\x0f\x7d\xcd\xad\xbc\xc3\x32\xff\xcd\xd8\xce\x7b\x87\x9f\xba\xc8\xd0\x04\xf0\x3b\xc3\xce\xfe"
+"\x10\x30\xf6\xf5\x11\xb7\xd3\xcd\x25\xd4\xf1\xe5\x21\xa2\xad\x71\xcd\xbc\xbc\xe1\xc9\x7e\xfe\xef\x20\x11\xcd\x2c\xde\x06\x10\xcd"
+"\x69\xd3\xf6\x80\x4f\xcd\x15\xde\xc3\xf5\xce\x06\x80\xcd\x69\xd3\x18\x40\xcd\x93\xd3\x7a\xb7\x7b\x28\x02\x2f\x3c\x5f\xb7\x28\xb9"
+"\xfe\x10\x30\xb5\xd5\x11\xfd\x41\x00\x10\xd1\x41\x00\x83\x7a\xe6\x80\xb1\x77\x7b\xcd\xbf\x46\x00\x10\x0d\xad\x0d\xe0\x4c\xd4\x7a"
+"\xc6\xf0\x4f\x43\x18\x0d\x06\xf0\xcd\x69\xd3\x4e\x00\x40\xcd\x93\xd3\x43\x03\x01\x80\xb8\xce\x57\x58\xc9\x01\x00\x05\x6f\x02\xf0"
+"\x04\x1c\xd5\xc5\xcd\xfe\xff\x79\xc1\xc5\xe5\x21\xa3\xad\x06\x00\x09\x09\x09\x77\x02\x0b\xf0\x09\xe1\xc1\x0c\xd1\x10\xdf\xc3\x37"
+"\xde\xcd\xd8\xce\x7a\xe6\xf0\xc2\x9b\xd3\xc9\xcd\xb6\xfe\x11\x50\xd7\x01\xf0\x05\x30\x22\x7d\xcd\x1e\xbb\x21\xff\xff\x28\x03\x69"
+"\x26\x00\xc3\x35\xff\xcd\x24\xbb\x97\x05\xf1\x04\x7c\xb5\x28\x02\x53\x2b\x7c\xb5\x7a\xca\x32\xff\xc3\x4d\xcb\xfe\x8d\x28\x16\x92"
+"\x0a\xf0\x01\x15\xde\xcd\x03\xcf\x48\xf1\x47\xe5\xeb\xcd\x0f\xbb\xe1\x30\xe4\xe8\x07\x23\x06\x50\x94\x00\xf1\x09\x06\x02\xcd\x69"
+"\xd3\x1f\x9f\x47\xc5\xe5\x79\xcd\x39\xbb\xe1\xc1\x11\x27\xbb\xcd\xcb\xd4\x11\x2d\x06\x00\x11\x33\x5c\x11\xf0\x11\xd5\xcd\xb8\xce"
+"\x47\xe3\x79\xcd\xfb\xff\xe1\xc9\xfe\xd9\x28\x26\xfe\xa4\x01\x3f\xbb\x28\x08\xfe\xa2\x01\x3e\xbc\xc2\x49\xcb\xc5\xed\x00\x21\xc3"
+"\xce\xe1\x00\xa1\xc3\xce\x5f\x51\xc1\xeb\xcd\xfc\xff\xeb\x65\x00\x00\x5c\x00\xe0\xe5\x21\xa7\x00\x3d\x3e\x32\x28\x02\x29\x0f\xcd"
+"\x68\xbc\xdb\x03\xf0\x6d\x41\xff\xcd\x45\xff\xcd\x9a\xbd\xe1\xc9\x3e\xff\x18\x01\xaf\xc3\x97\xbd\x01\x9d\xbd\x18\x16\xe5\xc5\xcd"
+"\x14\xff\xeb\x21\xb2\xad\xcd\x61\xbd\xc1\xe3\x79\xcd\x6c\xff\xd1\x01\xa0\xbd\xcd\x59\xd5\xd8\xca\xb5\xcb\xfa\xbe\xcb\xc3\x4d\xcb"
+"\xc5\xd5\xcd\x14\xff\xd1\xc9\x01\xa9\xbd\x18\xe7\x01\xa6\xbd\x18\xe2\x01\xa3\xbd\x18\xdd\x01\xac\xbd\x18\xd8\x01\xaf\xbd\x18\xd3"
+"\x01\xb2\xbd\x18\xce\x01\xb5\xbd\x18\xc9\x52\x61\x6e\x64\x6f\x6d\x20\x6e\x75\x6d\x62\x65\x72\x20\x73\x65\x65\x64\x20\x3f\x20\x00"
+"\x28\x06\x4a\x03\x60\x18\x18\xe5\x21\x83\xd5\x21\x15\x20\xec\xca\xf7\x14\x40\x6f\xed\x30\xef\x16\x15\x80\x20\xe9\xcd\x14\xff\xcd"
+"\xbe\xbd\x0a\x02\x30\x28\x20\x1b\xd7\x00\x20\x62\xcf\x53\x03\x00\x17\x00\xf0\x04\x94\xbd\x20\x05\xcd\x8b\xbd\xe1\xc9\xfc\xbe\xbd"
+"\xe1\xe5\xcd\x3e\xff\xcd\x7f\x47\x0c\xf0\x14\xfa\xd5\x2a\x66\xae\x22\x68\xae\x22\x6a\xae\x22\x6c\xae\xc9\x21\xb7\xad\x3e\x36\xcd"
+"\x07\xd6\x21\xed\xad\x3e\x06\x36\x00\x23\x3d\x20\xfa\xc9\x52\x0c\xf2\x11\xeb\xad\xc3\x4d\xea\x3e\x5b\xed\x4b\x68\xae\x0b\x87\xc6"
+"\x35\x6f\xce\xad\x95\x67\xc9\xed\x4b\x6a\xae\x0b\xe6\x03\x3d\x87\xc6\xed\x11\x00\xd0\x01\x5a\x41\x1e\x05\x79\x90\x38\x3d\xe5\x3c"
+"\x21\xb2\x0d\x02\xf0\x0a\x73\x2b\x3d\x20\xfb\xe1\xc9\x1e\x03\x18\x06\x1e\x02\x18\x02\x1e\x05\x7e\xcd\x92\xff\x30\x1e\x4f\x47\xde"
+"\x0b\x30\x2d\x20\x0c\xa3\x00\x50\x92\xff\x30\x0d\x4f\x09\x00\x20\x3d\xd6\xd9\x0d\x80\xdd\xc9\xc3\x49\xcb\xcd\x45\xcb\xe7\x0f\xa2"
+"\x0a\xfe\xf8\xca\x45\xf2\xcd\xbf\xd6\xd5\xc4\x04\x20\x78\xe3\xe5\x04\xf0\x0c\xc9\x47\xcd\x4b\xff\xb8\x78\xc4\xff\xfe\xcd\x66\xff"
+"\xc2\x83\xff\xe5\xcd\x94\xfb\xd1\xc3\x87\xff\xcd\xe0\xd7\x41\x00\xc3\xf8\xc9\xcd\x31\xd9\xcd\x06\xd8\x38\x42\x18\x28\x0a\x00\xf0"
+"\x0d\x38\xe5\x79\xcd\x19\xd6\xcd\x17\xd7\x18\x2d\xcd\x31\xd9\x38\x21\xe5\xcd\x17\xd6\xcd\x32\xd7\xd4\x6f\xd7\x18\x1c\x11\x00\x14"
+"\x10\x20\x00\xf1\x06\x3a\x9f\xb0\xd4\x7b\xd7\x18\x07\xe5\x2a\x68\xae\x2b\x19\xeb\xe1\x3a\x9f\xb0\x47\x4f\x50\x00\xf0\x1e\x7a\xe9"
+"\x18\xf2\xd5\xe5\x2a\x12\xae\x7c\xb5\x28\x10\x23\x23\xc5\x01\x00\x00\xcd\x40\xd7\xc1\x30\x04\xf1\xf1\x37\xc9\xe1\xd1\xd5\xe5\xcd"
+"\x40\xd7\xe1\x38\x02\xd1\xc9\xe1\xc3\x9e\xd7\x36\x06\xf0\x5f\xb4\xc8\x09\xe5\x23\x23\xed\x5b\x0e\xae\x1a\xbe\x20\x0d\x23\x13\x17"
+"\x30\xf7\x3a\x9f\xb0\x3d\xae\xe6\x07\xeb\xe1\x20\xde\x13\x37\xc9\x54\x5d\x23\x23\xcb\x7e\x23\x28\xfb\xc9\x3e\x02\xcd\x7b\xd7\x1b"
+"\x1a\xf6\x40\x12\x13\xc9\xd5\xe5\xc5\xf5\xcd\xa8\xd7\xf5\x2a\x6a\xae\xeb\xcd\xb8\xf6\xcd\x1a\xf6\xf1\xcd\xb8\xd7\xc1\xaf\x2b\x77"
+"\x10\xfc\xc1\xe3\xcd\xd0\xd7\xd1\xe1\x23\x7b\x91\x77\x23\x7a\x98\x77\x37\xc9\xc6\x03\x4f\x2a\x0e\xae\xaf\x47\x03\x3c\x49\x00\xf0"
+"\x00\xf9\xc9\x62\x6b\x09\xe5\xd5\x13\x13\x2a\x0e\xae\xcd\xec\xff\x6e\x00\x90\x12\x13\x42\x4b\xd1\xe1\xc9\x7e\x12\x33\x00\x90\x7e"
+"\xf5\x7a\x98\x77\xf1\x13\x12\x13\xd1\x00\x70\x7e\xfe\x28\x28\x05\xee\x5b\x16\x06\xf0\x0a\x83\xd8\xe5\xc5\x3a\x9f\xb0\xcd\x27\xd6"
+"\xcd\x40\xd7\xda\x85\xd6\xc1\x3e\xff\xcd\xb3\xd8\xe1\xc9\xf5\x24\x00\x74\x10\xee\x5b\x28\x0c\xf1\xd0\x11\x01\xf5\x03\x37\xc9\xcd"
+"\x83\xd8\xf1\xe5\x30\x07\x2a\x6a\xae\x2b\x19\x18\x15\xc5\xd5\x3a\x00\xf0\x19\x30\x0f\x13\x13\xe1\xcd\x9e\xd7\xc1\xeb\x78\x96\xc2"
+"\x81\xd6\x18\x0a\xe1\xc1\xaf\xcd\xb3\xd8\xcd\x9e\xd7\xeb\x11\x00\x00\x46\x23\xe5\xd5\x5e\x23\x56\xcd\x27\xd9\xd8\x05\xf2\x23\x81"
+"\xd6\xe3\xcd\x72\xdd\xd1\x19\xeb\xe1\x23\x23\x10\xe6\xeb\x44\x4d\x3a\x9f\xb0\xd6\x03\x38\x04\x29\x28\x01\x29\x09\x19\xeb\xe1\x37"
+"\xc9\xd5\xcd\x2c\xde\x3a\x9f\xb0\xf5\x06\x00\xcd\xce\xce\xe5\x3e\x02\x76\x12\x20\xe1\x04\xe2\x01\x80\xed\x7e\xfe\x29\x28\x05\xfe"
+"\x5d\xbd\x00\xf1\x02\x2c\xde\xf1\x32\x9f\xb0\xd1\xc9\xe5\x32\x0d\xae\xc5\x78\x87\xc6\x03\x3d\x01\x11\x6c\x3d\x01\x00\x3a\x01\xf0"
+"\x0e\x60\x69\xc1\xd5\x23\x23\x3a\x9f\xb0\x5f\x16\x00\x70\xe5\x23\xd5\x3a\x0d\xae\xb7\x11\x0a\x00\xeb\xc4\x27\xd9\xeb\x13\x4d\x11"
+"\x00\x89\x00\xf1\x16\xda\x81\xd6\xeb\xe1\x10\xe3\x42\x4b\x54\x5d\xcd\xbb\xf6\x22\x6c\xae\xc5\x2b\x36\x00\x0b\x78\xb1\x20\xf8\xc1"
+"\xe1\x5e\x57\xeb\x29\x23\x09\xeb\x2b\x2b\x2d\x00\x13\xeb\xef\x00\x00\x88\x01\x00\xb8\x01\x20\x62\xf6\xec\x01\x40\xc9\xcd\xaf\xd9"
+"\xda\x09\xf0\x18\x7a\xb3\x28\x0a\x23\x7e\x17\x30\xfb\xcd\x2c\xde\x37\xc9\x2b\x2b\xeb\xc1\x2a\x0e\xae\xe5\x21\x5e\xd9\xe5\xc5\xeb"
+"\xe5\xcd\x6c\xd9\xed\x53\x0e\xae\xd1\xc9\xe5\xa0\x01\xf0\x39\x6e\xf6\xe1\xe3\x22\x0e\xae\xe1\xc9\xe5\x7e\x23\x23\x23\x4e\xcb\xa9"
+"\xe3\xfe\x0b\x38\x17\x79\xe6\x1f\xc6\xf2\x5f\xce\xad\x93\x57\x1a\x32\x9f\xb0\x36\x0d\xfe\x05\x28\x03\xc6\x09\x77\xd1\x3e\x28\xcd"
+"\x72\xf6\xe5\x06\x29\x05\xca\x49\xcb\x1a\x13\xe6\xdf\x77\x23\x17\x30\xf3\xcd\x6e\xf6\xeb\x2b\xe6\x0e\xf0\x23\x7e\xfe\x0b\x38\x02"
+"\xc6\xf7\xfe\x04\x28\x09\x30\x04\xfe\x02\x30\x05\xc3\x49\xcb\x3e\x05\x32\x9f\xb0\xc9\xcd\x02\xd6\x2a\x6c\xae\xeb\x2a\x6a\xae\xcd"
+"\xd8\xff\xc8\xd5\xcd\x65\xd7\x7e\x23\xe6\x07\x3c\xe5\xec\x01\x21\xd0\xd7\xb5\x11\xa0\x19\xd1\x18\xe3\xcd\x4d\xea\xcd\xfc\xd9\x5b"
+"\x01\x01\x3d\x03\x13\xe5\xe5\x00\xf1\x09\x40\xd7\xd2\x4d\xcb\xeb\x4e\x23\x46\x23\x09\xcd\xe4\xff\xcd\xe5\xf6\xcd\x21\xf6\xcd\xc9"
+"\xd9\xe1\x12\x04\xb1\x12\xae\x22\x10\xae\xc9\xe5\x2a\x10\xae\xeb\x9b\x12\x30\x22\x10\xae\x22\x01\x80\xaf\x77\x23\x77\x23\xed\x5b"
+"\x12\x0d\x00\x11\xe1\x1f\x00\x70\x22\x12\xae\xe1\xc9\x2a\x10\xeb\x0e\x00\x1c\x12\x42\xed\x53\x10\xae\x9c\x09\x42\x22\x12\xae\xc9"
+"\xda\x01\xa0\xe3\xcd\xaf\xd9\xcd\x6c\xd9\xe3\xeb\x2a\x1c\x00\x00\x5b\x03\x20\xd0\xd7\x7b\x03\x60\x3c\xcd\x72\xf6\x78\x3d\x27\x14"
+"\x00\x41\x00\x40\x7c\xb5\x28\x0e\x8d\x00\x01\x7c\x03\x91\xe9\xda\xe1\x18\xee\x01\x41\x1a\xc5\xda\x03\xf0\x04\xe9\xda\xc1\x0c\x10"
+"\xf4\x3e\x03\xcd\x27\xd6\xe5\xe1\x4e\x23\x46\x78\xb1\xc8\xa1\x02\x20\x09\xe5\xf3\x00\x20\xd1\x23\x36\x00\x50\xe5\x09\xe3\x4e\x23"
+"\xa0\x06\xc0\xc1\xcd\xde\xff\x28\xda\xcd\x02\xdb\x23\x18\xf5\xbd\x01\x00\xa9\x03\x01\x27\x00\x00\x1b\x01\xb0\xfe\x02\xcc\x02\xdb"
+"\xe1\x18\xe7\xc5\xd5\x7e\x36\x00\x61\xe5\xeb\xb7\xc4\xfb\xff\x00\x08\xf0\x20\x25\xde\xa3\xcd\xd4\xc1\xcd\x8b\xdb\xcd\xbf\xd6\xcd"
+"\x5e\xff\xe5\xd5\xcd\x31\xdb\xcd\x8a\xf8\xe1\xcd\xa8\xd6\xe1\xc9\xcd\xc4\xc1\xd2\x57\xdc\xcd\xec\xca\x3a\x14\xae\xfe\x3b\xc4\x98"
+"\xc3\xc9\x2c\x00\x20\x5b\xdb\xa2\x10\x70\xe3\xaf\xcd\xbd\xdb\x23\xe3\x5e\x01\x20\xf1\xd1\x2a\x00\xf3\x2e\x30\x2b\xe5\xcd\x8b\xdb"
+"\xe5\xcd\x37\xdb\xeb\xe1\xcd\xcd\xdb\xc1\xd8\xc5\x21\x79\xdb\xcd\x8b\xc3\xe1\x18\xe7\x3f\x52\x65\x64\x6f\x20\x66\x72\x6f\x6d\x20"
+"\x73\x74\x61\x72\x74\x0a\x00\x7e\xfe\x3b\x32\x14\xae\xcc\x2c\xde\xfe\x22\x20\x0b\xcd\xb1\xdb\x72\x0c\xf0\x03\x3b\xcd\xc4\xc1\xd0"
+"\x3e\x3f\xcd\xa0\xc3\x3e\x20\xc3\xa0\xc3\xcd\x79\xf8\x83\x00\xb2\xf5\xfb\xc3\xd0\xf8\xd5\xcd\xf7\xdb\x30\x06\x2a\x05\xc0\xcd\x45"
+"\xcb\x0d\xd5\xe5\xd5\xcd\x0f\xd7\xe3\xaf\x17\x00\x60\x19\xfe\x03\xcc\xf5\xfb\x8c\x00\xf0\x22\xe3\x7e\x30\x08\xee\x2c\x20\x08\x23"
+"\xe3\x18\xe1\xb7\x20\x01\x37\xe1\xe1\xd1\xc9\x5f\xcd\x66\xff\xf5\x20\x06\xcd\x15\xdc\x37\x18\x09\xcd\xc4\xc1\xd4\x2c\xdc\xcd\x6f"
+"\xed\xf5\xdc\x4d\xde\xf1\xd1\x7a\xba\x00\xb1\x38\x06\xcd\x38\xdc\xc3\x8a\xf8\xcd\x4d\xde\xe3\x0b\xf1\x17\x7b\xc3\x94\xf8\xcd\x8e"
+"\xdc\x11\xb5\xdc\x38\x2b\xcd\x45\xcb\x18\xcd\x8e\xdc\x30\xf7\xfe\x22\x28\x05\x11\xb9\xdc\x18\x19\xcd\x99\xdc\x11\x54\xdc\x38\x11"
+"\x55\x11\xc1\xc9\xfe\x22\xc9\xcd\x99\xdc\x30\xd8\x11\xbc\xdc\x54\x11\xf0\x1a\xff\xcd\xfe\xff\x28\x0c\x77\x23\x05\x28\x05\xcd\x99"
+"\xdc\x38\xf1\xf6\xff\x36\x00\xe1\xc0\xfe\x0d\xc8\xfe\x22\xc4\xbf\xdc\xc0\xcd\x8e\xdc\xd0\xcd\xb9\xdc\xc4\x86\xbc\x37\x00\xf0\x09"
+"\xd0\xcd\xbf\xdc\x28\xf7\x37\xc9\xcd\x5c\xc4\xd0\xf5\xc5\x01\x0d\x0a\xb9\x28\x04\xb8\x20\x0a\x41\x94\x11\x50\x04\xb8\xc4\x86\xbc"
+"\xb2\x0d\xf1\x03\xbf\xdc\xc8\xfe\x2c\xc8\xfe\x0d\xc9\xfe\x20\xc8\xfe\x09\xc8\xfe\x0a\xc9\xa7\x0d\x00\x0b\x10\xf0\x1a\x2b\x18\x31"
+"\xe5\x2a\x64\xae\x18\x2b\xe5\x2a\x17\xae\xcd\x0a\xdd\xe3\xcd\xbf\xd6\xe3\x23\x3e\x01\xcd\xbd\xdb\x7e\xfe\x02\x38\x0d\xfe\x2c\x28"
+"\x09\x2a\x15\xae\xcd\xad\x24\x0c\x01\x1f\x01\x50\x38\xd9\x22\x17\xae\x49\x07\x80\x2c\xc8\xcd\xa3\xe9\xb7\x20\x0e\xa3\x10\xa0\x23"
+"\x3e\x04\xca\x55\xcb\x22\x15\xae\x23\xc0\x06\xf1\x21\x8c\x20\xe5\xc9\x44\xcd\xea\xdd\x18\x02\x06\x00\x1e\x00\x0e\x02\xc9\x7c\xb7"
+"\xfa\x42\xdd\xb0\xfa\xed\xdd\x37\xc9\xee\x80\xb5\xc0\x78\x37\x8f\xc9\xb7\xed\x5a\x37\xe0\xf6\xff\xc9\xeb\xb7\xed\x52\x09\x00\xf0"
+"\x67\xcd\x67\xdd\xcd\x72\xdd\xd2\x37\xdd\xf6\xff\xc9\x7c\xaa\x47\xeb\xcd\xea\xdd\xeb\xc3\xea\xdd\x7c\xb7\x28\x05\x7a\xb7\x37\xc0"
+"\xeb\xb5\xc8\x7a\xb3\x7d\x6b\x62\xc8\xfe\x03\x38\x10\x37\x8f\x30\xfd\x29\xd8\x87\x30\x02\x19\xd8\xfe\x80\x20\xf5\xc9\xfe\x01\xc8"
+"\x29\xc9\xcd\xab\xdd\xda\x37\xdd\xc9\x4c\xcd\xab\xdd\xeb\x41\x18\xf4\xcd\x67\xdd\x7a\xb3\xc8\xc5\xeb\x06\x01\x7c\xb7\x20\x09\x7a"
+"\xbd\x38\x05\x65\x2e\x00\x06\x09\x7b\x95\x7a\x9c\x38\x05\x04\x29\x30\xf6\x3f\x3f\x78\x44\x4d\x53\x11\xf1\x24\x0e\xcb\x18\xcb\x19"
+"\xeb\xed\x42\x30\x01\x09\xeb\x3f\xed\x6a\x3d\x20\xef\x37\xc1\xc9\x7c\xb7\xf0\xaf\x95\x6f\x9c\x95\xbc\x67\x37\xc0\xfe\x01\xc9\x7c"
+"\xb5\xc8\x7c\x87\x9f\xd8\x3c\xc9\x7c\xaa\x7c\xf2\x0d\xde\x0b\x00\xf0\x25\xba\x20\xf9\x7d\x93\x20\xf5\xc9\x3e\x2c\x18\x10\x3e\x28"
+"\x18\x0c\x3e\x29\x18\x08\x3e\xef\x18\x04\xe3\x7e\x23\xe3\xbe\x20\x0f\x23\x7e\xfe\x20\x28\xfa\xfe\x01\xd0\xb7\xc9\x7e\xfe\x02\xd8"
+"\x18\x6a\x7e\xfe\x02\xc9\xac\x15\x31\xee\x2c\xc0\x07\x05\x21\x7e\x23\x21\x00\x90\x09\x28\xf6\xfe\x0a\x28\xf2\x2b\xc9\x05\x13\xe0"
+"\x1b\xae\xcd\x21\xb9\xdc\xb2\xc8\xcd\x2c\xde\xc4\x8f\xde\x03\x12\x31\xec\x30\x31\x62\x01\xf0\x1c\x28\x0f\x22\x1d\xae\x23\x3a\x1f"
+"\xae\xb7\x28\xd9\xcd\xca\xde\x18\xd4\xc3\x49\xcc\x87\xd2\x89\xd6\xfe\xc3\x30\x10\xeb\xc6\xe0\x6f\xce\xde\x95\x67\x4e\x23\x46\xc5"
+"\xeb\xc3\x2c\xac\x01\x00\x9c\x08\x42\x1d\xae\xc9\x2a\x04\x00\x30\x7c\xb5\xc8\xd2\x03\x12\x37\x98\x09\xd0\x32\x1f\xae\xc9\x3e\x5b"
+"\xcd\xa0\xc3\xe5\x2a\x1d\xae\x18\x00\xf0\xff\x28\xcd\x44\xef\xe1\x3e\x5d\xc3\xa0\xc3\x22\xca\xea\xc0\x48\xc2\x5c\xf2\x96\xd2\xfd"
+"\xea\x2f\xc1\x06\xc5\xed\xd2\xf5\xd2\x80\xc2\x93\xcc\xa3\xe9\x71\xd1\x54\xd6\x58\xd6\x50\xd6\x29\xd5\xee\xe7\xb6\xd6\x39\xc5\x3e"
+"\xc5\x46\xc0\xad\xe9\x31\xcc\xd4\xd3\x9e\xd3\xf0\xd9\x51\xcb\x2a\xca\xd4\xc5\x8c\xc7\x86\xc7\x67\xc7\x51\xc2\x43\xdb\x86\xd4\x8e"
+"\xd6\x13\xdb\xcd\xe1\xb5\xea\xff\xc2\x6b\xf5\x54\xeb\x07\xfa\x75\xc2\x2f\xc5\x34\xc5\xa2\xc6\x28\xc1\x82\xc8\x76\xc9\xca\xcc\xf5"
+"\xc9\xb4\xd2\xa8\xd2\xde\xc4\x23\xf2\x39\xc2\x24\xc2\x43\xc5\x48\xc5\x0f\xf2\xa4\xf2\xa7\xe9\x2d\xd5\x99\xd5\xda\xdc\x70\xd3\xa7"
+"\xe9\x9e\xe8\xc8\xdc\xd5\xcc\xb0\xc7\x78\xea\xdc\xec\x13\xd3\xdb\xd4\x26\xcc\x84\xf7\x43\xc3\x4a\xc3\xc5\xde\xc1\xde\x29\xf2\x1a"
+"\xc8\xe7\xc7\x2a\xc4\x0e\xc3\x08\xf5\x9d\xf2\x97\xc9\x9d\xc9\x12\xc5\x9a\xc5\xc0\xc5\x19\xbd\x60\xc3\xd5\xed\x5b\x62\xae\xd5\xcd"
+"\x35\xe0\x01\x2c\x01\xcd\xc8\xdf\x7e\xb7\x20\xf9\x3e\x2d\x91\x4f\x3e\x01\x98\x47\xaf\x12\x13\x12\x13\x12\xe1\xd1\xc9\x7e\xb7\xc8"
+"\xcd\x92\xff\x38\x1c\xcd\xa0\xff\xda\xe2\xe0\xfe\x26\xca\x36\xe1\x23\xb7\xf8\xfe\x21\xd2\x5c\xe1\x3a\x00\xac\xb7\xc0\x3e\x20\x18"
+"\x1c\xcd\x3a\xe0\xd8\xfe\xc5\xca\xc3\xe1\xe5\x21\x12\xe0\xcd\xca\xff\xe1\x38\x18\xf5\xfe\x97\x3e\x01\xcc\x08\xe0\xf1\x12\x13\x0b"
+"\x79\xb0\xa9\x1b\xf0\x6b\x17\x8c\x8e\x90\x8f\x00\xcd\x08\xe0\x7e\xb7\xc8\xfe\x3a\x28\x14\x23\xb7\xfa\x1a\xe0\xfe\x20\x30\x02\x3e"
+"\x20\xfe\x22\x20\xe7\xcd\x95\xe1\x18\xe5\xaf\x32\x20\xae\xc9\xc5\xd5\xe5\x7e\x23\xcd\xab\xff\xcd\xa8\xe3\xcd\xeb\xe3\x30\x26\x79"
+"\xe6\x7f\xcd\x9c\xff\x30\x09\x1a\xfe\xe4\x7e\xc4\x9c\xff\x38\x15\xf1\x1a\xb7\xfa\xaf\xe0\xd1\xc1\xf5\x3e\xff\xcd\x08\xe0\xf1\xcd"
+"\x08\xe0\xaf\x18\x3a\xe1\xd1\xc1\xe5\x2b\x23\x7e\xcd\x9c\xff\x38\xf9\xcd\xd1\xe0\x38\x04\x3e\x0d\x18\x06\x23\xfe\x05\x20\x01\x3d"
+"\x21\x00\x03\x04\x00\x10\xe3\x21\x00\xf0\x09\x30\x07\x7e\xcd\x08\xe0\x23\x18\xf3\xcd\xb5\xe1\xe1\x3e\xff\x32\x20\xae\x37\xc9\xe5"
+"\x4f\x21\xc3\xbb\x00\xf0\x29\x9f\xe6\x01\x32\x20\xae\x79\xe1\xd1\xc1\xb7\xc9\xc7\x81\xc6\x92\x96\xc8\xe3\x97\xca\xa7\xa0\xeb\x9f"
+"\x00\xfe\x21\x28\x07\xfe\x26\xd0\xfe\x24\x3f\xd0\xde\x1f\xee\x07\x37\xc9\x3a\x20\xae\xb7\x28\x10\x7e\x23\xfa\x08\xe0\x2b\xd5\x32"
+"\x20\xf3\x34\x32\x3e\x1e\x18\x4d\xd5\xc5\xcd\x8a\xed\xc1\x30\x26\xcd\x66\xff\x3e\x1f\x30\x3e\xed\x5b\xa0\xb0\x7a\xb7\x3e\x1a\x20"
+"\x34\xe3\xeb\x7d\xfe\x0a\x30\x04\xc6\x0e\x18\x06\x3e\x19\xcd\x08\xe0\x7d\xe1\xc3\x08\xe0\x7e\x23\xe3\xeb\xcd\x08\xe0\xeb\xe3\xcd"
+"\xd8\xff\x20\xf2\xd1\xc9\x3e\x00\xf0\x07\xe8\xfe\x02\x3e\x1b\x28\x01\x3c\xd1\xcd\x08\xe0\xe5\x21\xa0\xb0\xcd\x4b\xff\xf5\x7e\x23"
+"\xed\x00\xf2\x2f\x3d\x20\xf6\xe1\xc9\xfe\x22\x28\x35\xfe\x7c\x28\x3f\xc5\xd5\xee\x3f\x06\xbf\x28\x10\x2b\x11\x36\xe7\xcd\xeb\xe3"
+"\x1a\x38\x02\x7e\x23\x47\xcd\x89\xe1\x32\x20\xae\x78\xd1\xc1\xfe\xc0\x28\x36\xc3\x08\xe0\x3d\xc8\xee\x22\xc8\x3a\x20\xae\x3c\xc8"
+"\x3d\xc9\x7e\x01\x80\x23\xfe\x22\x20\xf5\xc3\x08\xe0\x14\x01\x30\x32\x20\xae\x15\x00\x10\x23\x38\x01\xf1\x01\xf6\x2b\x1b\x1a\xf6"
+"\x80\x12\x13\xc9\x3e\x01\xcd\x08\xe0\x3e\xc0\x19\x00\xf1\x22\xb7\x20\xf8\x2b\xc9\xcd\x0f\xcf\xc5\xd5\xcd\xca\xc1\xcd\x37\xde\xcd"
+"\xaa\xde\xd1\xc1\xcd\xe3\xe1\xc3\x58\xc0\xd5\x50\x59\xcd\x64\xe8\xd1\x4e\x23\x46\x2b\x78\xb1\xc8\xcd\x72\xc4\xe5\x09\xe3\xd5\xe5"
+"\x99\x07\x10\xe1\xd1\x00\x60\xe3\x38\x12\xcd\x54\xe2\x08\x17\xf0\x00\x1d\xe2\x23\x7e\xb7\x20\xf8\xcd\x98\xc3\xb7\xd1\xe1\x30\xce"
+"\x4e\x1f\xf0\x29\x7e\x38\x0a\xcd\xb8\xc3\xfe\x0a\xc0\x3e\x0d\x18\x08\xfe\x20\x3e\x01\xdc\xb8\xc3\x7e\xc3\xb8\xc3\xcd\x64\xe8\x38"
+"\x17\xeb\xcd\x4a\xef\x11\x00\x01\x01\x8a\xac\x7e\x23\x02\x03\x15\xb7\x20\xf8\x02\x0b\xc3\xe8\xe2\xe5\xcd\x3d\xe2\xf7\x1a\xf1\x2d"
+"\x23\x7e\x02\xb7\xc8\xcd\x66\xe2\x18\xf7\xfa\xf8\xe2\xfe\x02\x38\x1c\xfe\x05\x38\x42\xfe\x0e\x38\x3e\xfe\x20\x38\x31\xfe\x7c\x28"
+"\x54\xcd\xd1\xe0\xd4\x9c\xff\xdc\xe6\xe2\x7e\x18\x0d\x23\x7e\xfe\xc0\x28\x5d\xfe\x97\x28\x69\x2b\x3e\x3a\x1e\x00\x04\x07\x10\xca"
+"\x90\x00\x10\xc8\x07\x01\xf0\x1e\x23\x18\x20\xcd\xe6\xe2\xcd\x2f\xe3\x1e\x01\xc9\xcd\xe6\xe2\x7e\xf5\x23\x23\x23\xcd\xdb\xe2\xf1"
+"\x1e\x01\xfe\x0b\xd0\x1e\x00\xee\x27\xe6\xfd\x02\x03\x15\xc0\x0b\x14\xc9\x1e\x01\xcd\x37\x00\xf0\x00\x23\xb7\xc0\x7e\xe6\x7f\xcd"
+"\xca\xe2\xbe\x23\x30\xf6\xc9\x1d\x00\x03\x40\xde\xcd\xfc\xe2\x27\x03\xf0\x17\xca\xe2\x23\x18\xf7\xfe\xc5\x28\xf0\x23\xfe\xff\x20"
+"\x02\x7e\x23\xf5\xe5\xcd\xb8\xe3\xb7\x28\x08\xf5\xcd\xe6\xe2\xf1\xcd\xca\xe2\x7e\xe6\x7f\xfe\x09\xc4\x3a\x00\xf0\x0a\x28\xf4\xcd"
+"\x9c\xff\x1e\x00\x30\x02\x1e\x01\xe1\xf1\xd6\xe4\xc0\x5f\xc9\xd5\x7e\x23\xfe\x1f\x28\x5d\xde\x08\xf0\x11\xfe\x1b\x28\x32\xfe\x1c"
+"\x28\x39\xfe\x1e\x28\x23\xfe\x1d\x28\x16\xfe\x1a\x28\x0b\x2b\x16\x00\xfe\x19\x28\x04\x2b\xd6\x0e\x5f\xe3\xa4\x12\x25\x18\x3a\x0a"
+"\x14\x10\xe3\x2d\x01\xf1\x16\x18\x2d\xe3\x3e\x58\x37\xf5\xc5\x01\x01\x01\x18\x07\xe3\xb7\xf5\xc5\x01\x0f\x04\xeb\xaf\xcd\xdf\xf1"
+"\xc1\x3e\x26\xcd\xca\xe2\xf1\xdc\xca\xe2\x18\x0a\xe5\x12\x70\xe3\xeb\xcd\x5a\xef\x7e\x23\x8f\x00\xf0\x01\xb7\x20\xf7\xe1\xc9\xe5"
+"\xd6\x41\x87\xc6\x18\x6f\xce\xe4\x95\x67\xe8\x1c\xf0\x10\xc9\xc5\x4f\x06\x1a\x21\x4c\xe4\xcd\xd7\xe3\x38\x0e\x23\x10\xf8\x21\x36"
+"\xe7\xcd\xd7\xe3\xd2\x49\xcb\x06\xc0\x78\xc6\x40\xc1\x0f\x04\xf1\x16\xe5\x7e\x23\x17\x30\xfb\x7e\x23\xb9\x28\x03\xf1\x18\xef\xe1"
+"\x37\xc9\x1a\xb7\xc8\xe5\x1a\x13\xfe\x09\x28\x04\xfe\x20\x20\x05\xcd\x4d\xde\x18\xf1\x4f\xc2\x03\x81\xa9\x28\xe8\xe6\x7f\x28\x0a"
+"\x1b\x76\x15\xf0\x35\x13\xe1\x18\xd6\xf1\x37\xc9\x20\xe7\x15\xe7\xcc\xe6\x92\xe6\x63\xe6\x4e\xe6\x3a\xe6\x30\xe6\x0f\xe6\x0b\xe6"
+"\x07\xe6\xdb\xe5\xb1\xe5\xa6\xe5\x6e\xe5\x4a\xe5\x49\xe5\xff\xe4\xbf\xe4\x93\xe4\x84\xe4\x7c\xe4\x5e\xe4\x56\xe4\x51\xe4\x4c\xe4"
+"\x4f\x4e\xc5\xda\x00\x50\x4f\xd3\x48\x05\x00\xf0\x13\x47\x4f\xd2\xfd\x00\x52\x49\x54\xc5\xd9\x49\x4e\x44\x4f\xd7\xd8\x49\x44\x54"
+"\xc8\xd7\x48\x49\x4c\xc5\xd6\x45\x4e\xc4\xd5\x41\x49\xd4\xd4\x26\x00\xf0\x74\x7f\x41\xcc\x1d\x00\x53\x49\x4e\xc7\xed\x50\x50\x45"
+"\x52\xa4\x1c\x4e\xd4\x1b\x00\x52\x4f\xce\xd3\x52\x4f\x46\xc6\xd2\xcf\xec\x49\x4d\xc5\x46\x48\x45\xce\xeb\x45\x53\x54\xd2\x7d\x45"
+"\x53\xd4\x7c\x41\xce\x1a\x41\x47\x4f\x46\xc6\xd1\x41\xc7\xd0\x41\xc2\xea\x00\x59\x4d\x42\x4f\xcc\xcf\x57\x41\xd0\xe7\x54\x52\x49"
+"\x4e\x47\xa4\x7b\x54\x52\xa4\x19\x54\x4f\xd0\xce\x54\x45\xd0\xe6\x51\xd2\x18\xd1\x17\x50\x45\x45\xc4\xcd\x50\xc3\xe5\x50\x41\x43"
+"\x45\xa4\x16\x4f\x55\x4e\xc4\xcc\x49\xce\x15\x47\xce\x14\x41\x56\xc5\xcb\x00\x55\xce\xca\x13\x00\xa1\x7a\x4e\xc4\x45\x49\x47\x48"
+"\x54\xa4\x79\x6f\x17\x11\xc9\xb9\x17\xf0\xff\xa9\xc8\x45\x53\x54\x4f\x52\xc5\xc7\x45\x4e\x55\xcd\xc6\x45\x4d\x41\x49\xce\x13\x45"
+"\xcd\xc5\x45\x4c\x45\x41\x53\xc5\xc4\x45\x41\xc4\xc3\x41\x4e\x44\x4f\x4d\x49\x5a\xc5\xc2\x41\xc4\xc1\x00\x00\x52\x49\x4e\xd4\xbf"
+"\x4f\xd3\x78\x4f\x4b\xc5\xbe\x4c\x4f\x54\xd2\xbd\x4c\x4f\xd4\xbc\xc9\x44\x45\xce\xbb\x45\x45\xcb\x12\x41\x50\x45\xd2\xba\x00\x55"
+"\xd4\xb9\x52\x49\x47\x49\xce\xb8\xd2\xfc\x50\x45\x4e\x4f\x55\xd4\xb7\x50\x45\x4e\x49\xce\xb6\x4e\x20\x53\xd1\xb5\x4e\x20\x45\x52"
+"\x52\x4f\x52\x20\x47\x4f\x09\x54\x4f\x20\xb0\xb4\x4e\x20\x42\x52\x45\x41\xcb\xb3\xce\xb2\x00\x4f\xd4\xfe\x45\xd7\xb1\x45\x58\xd4"
+"\xb0\x00\x4f\x56\x45\xd2\xaf\x4f\x56\xc5\xae\x4f\x44\xc5\xad\x4f\xc4\xfb\x49\xce\x77\x49\x44\xa4\xac\x45\x52\x47\xc5\xab\x45\x4d"
+"\x4f\x52\xd9\xaa\x41\xd8\x76\x41\x53\xcb\xdf\x00\x4f\x57\x45\x52\xa4\x11\x4f\x47\x31\xb0\x10\x4f\xc7\x0f\x4f\x43\x41\x54\xc5\xa9"
+"\x4f\x41\xc4\xa8\x49\x53\xd4\xa7\x49\x4e\xc5\xa6\x45\xd4\xa5\x45\xce\x0e\x45\x46\x54\xa4\x75\x00\x45\xd9\xa4\x00\x4f\xd9\x0d\x00"
+"\x4e\xd4\x0c\x4e\x53\x54\xd2\x74\x4e\x50\x55\xd4\xa3\x4e\xd0\x0b\x4e\x4b\x45\x59\xa4\x43\x4e\x4b\x45\xd9\x0a\x4e\xcb\xa2\xc6\xa1"
+"\x00\x49\x4d\x45\xcd\x42\x45\x58\xa4\x73\x00\x52\x41\x50\x48\x49\x43\xd3\xde\x4f\x09\x54\xcf\xa0\x4f\x09\x53\x55\xc2\x9f\x00\x52"
+"\xc5\x09\x52\x41\x4d\xc5\xe0\x4f\xd2\x9e\xce\xe4\x49\xd8\x08\x49\x4c\xcc\xdd\x00\x58\xd0\x07\x56\x45\x52\xd9\x9d\x52\x52\x4f\xd2"
+"\x9c\x52\xd2\x41\x52\xcc\xe3\x52\x41\x53\xc5\x9b\x4f\xc6\x40\x4e\xd6\x9a\x4e\xd4\x99\x4e\xc4\x98\x4c\x53\xc5\x97\xc9\xdc\x44\x49"
+"\xd4\x96\x00\x52\x41\x57\xd2\x95\x52\x41\xd7\x94\x49\xcd\x93\xc9\xdb\x45\x52\xd2\x49\x45\x4c\x45\x54\xc5\x92\x45\xc7\x91\x45\x46"
+"\x53\x54\xd2\x90\x45\x46\x52\x45\x41\xcc\x8f\x45\x46\x49\x4e\xd4\x8e\x45\xc6\x8d\x45\x43\xa4\x72\x41\x54\xc1\x8c\x00\x55\x52\x53"
+"\x4f\xd2\xe1\x1d\x00\xf0\x0c\x06\x4f\xd3\x05\x4f\x50\x59\x43\x48\x52\xa4\x7e\x4f\x4e\xd4\x8b\x4c\xd3\x8a\x4c\x4f\x53\x45\x4f\x55"
+"\xd4\x89\x08\x00\xf0\x61\x49\xce\x88\x4c\xc7\x87\x4c\x45\x41\xd2\x86\x49\x4e\xd4\x04\x48\x52\xa4\x03\x48\x41\x49\xce\x85\x41\xd4"
+"\x84\x41\x4c\xcc\x83\x00\x4f\x52\x44\x45\xd2\x82\x49\x4e\xa4\x71\x00\x55\x54\xcf\x81\x54\xce\x02\x53\xc3\x01\x4e\xc4\xfa\x46\x54"
+"\x45\xd2\x80\x42\xd3\x00\x00\xde\xf8\xdc\xf9\x3e\x09\xbd\xf0\x3d\x20\xbe\xf0\xbe\xee\x3c\x09\xbe\xf2\x3c\x09\xbd\xf3\x3d\x20\xbc"
+"\xf3\xbd\xef\xbc\xf1\xaf\xf7\xba\x01\xaa\xf6\xad\xf5\xab\xf4\xa7\xc0\x00\xaf\x2a\x64\xae\x29\x0d\xb0\x77\x23\x22\x66\xae\x18\x11"
+"\x3a\x21\xae\xb7\xd4\x22\xf5\x0d\x01\x86\xe7\xcd\xb9\xe9\xe1\xd1\xc1\xaf\x32\x21\xae\xc9\xcd\xfd\xe9\xfe\x02\xd8\xfe\x1d\x20\xf6"
+"\x56\x2b\x5e\x2b\x34\x04\x20\x36\x1e\x60\x13\xf0\x00\x18\xe1\x7e\xfe\x20\x20\x01\x23\xcd\x70\xe7\xcd\xa4\xdf\xe5\xff\x11\xf0\x04"
+"\x28\x28\xc5\xd5\x21\x04\x00\x09\xe5\xe5\xcd\x64\xe8\xe5\xdc\xe4\xe7\xd1\xc1\x42\x10\x31\x07\xf6\xeb\xcc\x1f\x01\x05\x00\xf0\x08"
+"\xc1\xeb\xe1\xed\xb0\xc9\xe1\xcd\x5c\xe8\x78\xb1\xc8\xeb\xcd\xe5\xf6\xc3\x07\xf6\xcd\x00\xe8\x1c\x06\xf0\x05\x4d\xfb\xcd\x1a\xe8"
+"\xcd\x8f\xc1\xc3\x58\xc0\xcd\x0f\xcf\xe5\xc5\xcd\x82\xe8\xd1\x4a\x00\xf0\x0b\x22\x22\xae\xeb\xe1\xb7\xed\x52\x22\x24\xae\xe1\xc9"
+"\xcd\x70\xe7\xed\x4b\x24\xae\x2a\x22\xae\xc3\xe4\xe7\xf3\x0e\x60\xfe\x1d\x28\x2a\xfe\x1e\xde\x18\x00\xd7\x27\xf1\x0c\xd8\xff\x30"
+"\x0a\xe1\xe5\x23\xcd\xad\xe9\x23\xcd\x68\xe8\xd4\x5c\xe8\x2b\xeb\xe1\x2b\x2b\x3e\x1d\x32\x21\xae\x16\x14\x00\x07\x18\x20\x64\xe8"
+"\x89\x15\x40\x08\x2a\x64\xae\x62\x0d\x00\x7e\x06\x03\x2d\x21\xc0\xeb\xcd\xd8\xff\xeb\xe1\x3f\xd0\xc8\x09\x18\xe6\x1e\x00\x10\xe5"
+"\xb7\x0d\x41\x78\xb1\x37\x28\x86\x17\x02\x1e\x00\xd1\xd8\x09\x18\xe8\x11\x0a\x00\xc4\x1a\xe9\xd5\x11\x00\xb0\x27\x00\x0a\x00\x07"
+"\xba\x27\x50\xe1\xeb\xe3\xeb\xd5\xb7\x00\x01\xbc\x00\xd1\xeb\xe1\xcd\xd8\xff\x38\x1d\xeb\xd1\xc1\xd5\xe5\xc5\x18\x0e\x40\x28\x13"
+"\x2b\x09\x6d\x1c\xf3\x08\x0c\x2b\xc1\xe5\xeb\x09\xeb\xe1\x30\xe8\xc3\x4d\xcb\x01\x20\xe9\xcd\xb9\xe9\xc1\xe1\xd1\xc5\x74\x00\x20"
+"\x28\x0c\xcc\x0e\xc0\xe1\x09\xc1\xeb\x09\xeb\x18\xea\xe1\xe1\x01\x44\x21\x00\x00\xeb\x27\x00\x2b\x28\x04\x9a\x01\xf3\x0e\x1e\x20"
+"\xf6\xe5\x56\x2b\x5e\xcd\x64\xe8\x30\x0e\x2b\xeb\xe1\xe5\x72\x2b\x73\x2b\x3e\x1d\x77\x32\x21\xae\xe1\x18\xdc\xbe\x01\x04\x24\x00"
+"\xc0\xb5\xde\xcd\xe6\xcb\xe1\x18\xe9\x06\x00\x2b\x04\x1b\x00\x90\xa1\x28\xf8\xfe\x02\x30\xf5\xb7\xc8\x0d\x00\xf1\x05\x97\x20\xef"
+"\x10\xea\xcd\x2c\xde\x04\xc9\x7e\xfe\x5b\x28\x03\xfe\x28\xc0\x06\x00\x26\x00\xf0\x24\x5b\x28\xf8\xfe\x28\x28\xf4\xfe\x5d\x28\x0b"
+"\xfe\x29\x28\x07\xfe\x02\x30\xe9\xc3\x49\xcb\x10\xe4\x23\xc9\x06\x01\x18\x08\x7e\xb7\xc8\x23\x18\xfa\x06\x00\x2b\xcd\xfd\xe9\xb7"
+"\xc8\xb8\x20\xf8\xc9\xcd\xb1\xde\xe8\x0c\x00\x4a\x0b\x21\x28\x13\x4f\x1d\xf0\x03\xc5\xcd\xfc\xff\xc1\x2b\xcd\xef\xe9\xb7\x20\xf4"
+"\x18\xe7\xe1\xc3\xad\xde\x0c\x00\x10\xc0\x22\x00\x84\x79\xca\x55\xcb\x23\x54\x5d\x23\xcf\x00\x60\x97\xc8\xfe\xeb\x20\xf3\xf8\x14"
+"\xf0\x14\xc8\xfe\x0e\x38\x25\xfe\x20\x38\x2b\xfe\x22\x28\x11\xfe\x7c\x28\x1b\xfe\xc0\x28\x30\xfe\xc5\x28\x2c\xfe\xff\xc0\x23\xc9"
+"\x23\x7e\xfe\x22\xc8\x5b\x08\x61\x3e\x22\xc9\x23\x23\xf5\xf1\x10\xe0\xf1\xc9\xfe\x18\xd8\xfe\x19\x28\x08\xfe\x1f\x38\x03\x23\x01"
+"\x00\x80\xc9\xf5\x23\xcd\xa7\xe9\xf1\x2b\x13\x0a\x32\x01\x5a\xea\xd8\x02\x60\xc9\xe5\xcd\xfd\xe9\xd1\xd6\x02\x40\x0e\x30\xf4\xeb"
+"\x45\x0d\x60\x0d\x38\x02\x36\x0d\x23\x36\x10\xf0\x11\xeb\x18\xe2\xcd\x3d\xde\xed\x5b\x64\xae\x38\x1d\xfe\x1e\x28\x15\xfe\x1d\x28"
+"\x11\xcd\xd1\xea\x21\xf1\xea\xd2\x13\xbd\xcd\x6d\xec\xc0\x0d\x10\x12\xbf\x1d\x10\xd5\x07\x18\x10\x78\x6b\x29\xf2\x12\xcd\x62\xc1"
+"\xe1\xe3\xcd\x43\xbd\xe1\x23\xc3\x77\xde\xcd\xd1\xea\x30\x06\xcd\x6d\xec\xc3\x58\xc0\xe5\xcd\xab\xf5\x2a\x26\xae\xcd\x83\xd1\x17"
+"\xb0\xed\xd2\xcd\x54\xec\xe6\x0e\xee\x02\x28\x08\xe9\x02\x40\x6f\xc1\x37\xc9\xea\x29\xb2\xf5\xce\xed\x53\x26\xae\xcd\x37\xde\xb7"
+"\xc9\x2d\x00\xa0\xe5\xdc\x7a\xbc\xe1\xc9\xee\xab\x32\x28\x71\x0f\x32\xcd\x54\xec\x63\x02\x81\x30\x06\x7e\xfe\x2c\xc4\xf5\xce\x34"
+"\x26\x00\x94\x21\x60\x92\xcd\x00\xe8\x37\xf5\x4b\x00\x20\x4d\xfb\x14\x26\xf0\x01\x0e\xd6\xf1\xdc\x1a\xe8\xcd\x47\xeb\xd1\x2a\x64"
+"\xae\x7a\xb3\xc8\x23\x2b\xf0\x05\x5c\xe8\x2b\xc9\x3a\x28\xae\xb7\xca\x62\xec\xcd\x89\xc1\xc3\x6d\xec\xcd\x54\xec\x32\x00\x40\x78"
+"\xc1\xcd\x62\xa3\x00\x30\xcd\x8f\xc1\xbb\x03\x60\x29\xf6\x2a\x66\xae\xeb\xee\x02\xf0\x0b\x22\x66\xae\xeb\xcd\xe4\xff\xeb\xcd\x07"
+"\xf7\xeb\x2b\xed\xb8\x13\xeb\xcd\x4b\xec\x30\x4a\xb3\x28\x4c\xd5\x09\x00\x73\x41\x7e\x23\xb6\x2b\x28\x1b\x2a\x03\x00\xab\x24\x90"
+"\x28\x07\x30\x0c\xcd\x19\xec\x18\xe6\x57\x13\x80\x2b\x19\xd1\xe5\x2a\x66\xae\x23\x1a\x04\x91\x11\x1d\x00\x19\xeb\xe1\xe3\xeb\x19"
+"\x99\x0a\xe1\x38\x25\xe3\xcd\x2c\xec\xe1\x38\xb1\xcd\xd9\xeb\x18\x36\x46\x00\x10\x05\x37\x00\x40\xf5\x2a\x66\xae\x76\x01\x00\x81"
+"\x04\xf0\x0b\xc3\xb0\xec\xcd\xd9\xeb\xcd\xaa\xde\x3e\x07\x18\x15\xcd\x80\xbc\xd8\xfe\x1a\x37\xc8\x32\x91\xad\x3f\xc9\xd2\x1f\xe0"
+"\x6f\xc1\x3e\x18\xf5\xcd\x00\xd3\xf1\xc3\x55\xcb\xc5\xd5\x31\x0a\xf0\x01\xed\x5b\x66\xae\xed\xb0\xed\x53\x66\xae\xd1\xc1\xc9\xeb"
+"\x2a\x66\xec\x11\x70\x23\x23\x23\x1b\x1b\x1b\x1b\xbb\x20\xf0\x07\xcd\xfc\xeb\x77\x23\x38\xf4\xc9\x22\x66\xae\x37\xc9\xcd\xfc\xeb"
+"\x5f\xdc\xfc\xeb\x57\xc9\xb5\x01\xf1\x11\xbe\xd2\x32\x29\xae\xed\x43\x2a\xae\xc9\x3a\x29\xae\xb7\xca\x63\xeb\xfe\x16\x20\x0b\x3a"
+"\x29\xae\xfe\x16\x28\x42\xe6\xfe\x28\x04\xbe\x19\xf0\x1e\x8f\xc1\xcd\x29\xf6\xed\x4b\x64\xae\x03\xcd\x07\xf7\x11\x80\xff\x19\xb7"
+"\xed\x42\xed\x5b\x2a\xae\xd4\xd8\xff\xda\xf5\xeb\xeb\x09\x22\x66\xae\x3a\x29\xae\x1f\x9f\x32\x2c\xae\x60\x69\xe3\x01\x80\x09\xec"
+"\xcd\x3c\xf6\xc3\xed\xd2\x53\x01\xa0\xaa\xde\xcd\x29\xf6\xcd\x0a\xcb\x30\xec\x12\x05\xf0\x05\xc4\xcd\xec\x18\xf2\xcd\xcf\xee\xda"
+"\xa5\xe7\x3e\x15\x28\x02\x3e\x06\xc3\x55\xcb\x88\x00\x30\xa8\xd2\x06\x3c\x04\xf3\x03\x30\x25\xcd\x25\xde\x0d\x23\x23\x7e\xe6\xdf"
+"\xf2\x49\xcb\xe5\x21\x00\xed\xab\x1c\xe0\x03\x49\xcb\xc1\x53\xed\xc2\x2b\xed\xd0\x0c\xed\x06\x01\xbf\x19\x10\xc5\xad\x01\x20\x4d"
+"\xea\xa9\x01\x00\xf1\x00\x50\xb7\xed\x52\xeb\xf1\x01\x23\x10\x20\x0f\x19\x00\x1b\x02\x30\x15\xde\xcd\x07\x00\x02\xc9\x1a\x00\x0a"
+"\x00\xf0\x00\x37\xde\x3e\x02\xc1\xd1\xe3\xcd\x98\xbc\xd2\x37\xcc\x18\x17\x45\x00\x20\x3e\x09\x87\x21\x03\x4e\x1e\x20\xe3\xe1\x88"
+"\x21\x82\xcd\xf5\xd2\xe1\xc9\xcd\x0f\xee\x7b\x09\x40\x2f\xfe\x26\x28\xad\x0d\xf0\x8f\x38\x26\xcd\x38\xff\xcd\x1b\xff\x37\xc9\xe5"
+"\xcd\x92\xed\xd1\xd8\xeb\xc9\x16\x00\x7e\xfe\x26\x20\x0f\xcd\xe7\xee\xeb\xf5\xcd\x35\xff\xf1\xeb\xd8\xc8\xc3\xbe\xcb\xe5\x7e\x23"
+"\xfe\x2e\xcc\x4d\xde\xcd\xa4\xff\xe1\x38\x06\x7e\xee\x2e\xc0\x23\xc9\xcd\x38\xff\xd5\x01\x00\x00\x11\x2d\xae\xcd\x1e\xee\xfe\x2e"
+"\x20\x0b\xcd\x94\xee\xcd\x41\xff\x0c\xcd\x1e\xee\x0d\xeb\x36\xff\xeb\xcd\x42\xee\xd1\x5f\xe5\xd5\x21\x2d\xae\xcd\x99\xee\xd1\xcd"
+"\x66\xff\x30\x08\xe5\x42\xcd\x2c\xfe\xe1\x38\x11\x7a\x4e\x23\xcd\xb8\xbd\x7b\xcd\x79\xbd\xeb\xcd\x3e\xff\xdc\x61\xbd\x3e\x0a\xe1"
+"\xd8\xc3\xbe\xcb\xcd\x4d\xde\x23\x16\xff\xfe\x2d\xc8\x14\xfe\x2b\xc8\x2b\xc9\x6d\x06\xf0\x16\x23\xcd\xa4\xff\x38\x04\xe1\xc3\xab"
+"\xff\xe3\xe1\xd6\x30\x12\xb0\x28\x07\x78\x04\xfe\x0c\x30\x01\x13\x79\xb7\x28\xdf\x0c\x18\xdc\xfe\x45\x20\x10\xe5\x7a\x00\x22\x0f"
+"\xee\xa0\x00\xf0\x32\x38\x04\xe1\xaf\x18\x1e\xe3\xe1\xcd\x41\xff\xd5\xc5\xcd\x00\xef\x30\x09\x7b\xd6\x64\x7a\xde\x00\x7b\x38\x02"
+"\x3e\x7f\xc1\xd1\x14\x20\x02\x2f\x3c\xc6\x80\x5f\x78\xd6\x0c\x30\x01\xaf\x91\x30\x09\x83\x38\x01\xaf\xfe\x01\xce\x80\xc9\x83\x30"
+"\x02\x3e\xff\xd6\x80\xc9\x85\x00\xf0\x07\xc9\xeb\x21\x3f\xae\x01\x01\x05\x2b\x36\x00\x10\xfb\x1a\xfe\xff\xc8\x77\x21\x3a\xae\x13"
+"\x09\x00\xf0\x13\xd5\x41\x16\x00\xe5\x5e\x62\x6b\x29\x29\x19\x29\x5f\x19\x5d\x7c\xe1\x73\x23\x10\xef\xd1\xb7\x28\xdf\x77\x0c\x18"
+"\xdb\xc5\xe5\xcd\x00\xef\x7a\x0b\xf0\x01\xeb\xc1\x30\x06\x7a\xb3\xc6\xff\x38\x03\x50\x59\xeb\xc1\xc9\x23\x53\x2e\xe0\xab\xff\x06"
+"\x02\xfe\x58\x28\x06\x06\x10\xfe\x48\x20\x04\x13\x00\xf0\x0b\x18\x02\x06\x0a\xeb\xcd\x2c\xef\x26\x00\x6f\x30\x1e\x0e\x00\xcd\x2c"
+"\xef\x30\x14\xd5\x16\x00\x5f\xd5\x58\xb4\x16\xf0\x03\x38\x03\x19\x30\x02\x0e\xff\xd1\x18\xe7\x79\xfe\x01\xeb\x78\xc9\x1a\x13\x0b"
+"\x01\xf0\x17\x0a\xcd\xab\xff\xfe\x41\x3f\x30\x05\xd6\x07\xd6\x30\xb8\xd8\x1b\xaf\xc9\xcd\x4a\xef\xc3\x8b\xc3\xd5\xc5\xcd\x35\xff"
+"\xcd\x03\xfd\xaf\xcd\x72\xef\x23\xc1\x24\x0e\xf0\xa0\xaf\xcd\x6a\xef\xc1\xd1\x7e\xfe\x20\xc0\x23\xc9\x3e\x40\x22\x52\xae\xf5\xcd"
+"\xf3\xfc\xf1\xc5\x57\xd5\xcd\x8a\xf1\xd1\xcd\x96\xef\xcd\x1a\xf1\xf1\x5f\x78\xb7\xcc\x2c\xf1\xcd\x45\xf1\xcd\x4f\xf1\xcd\x6f\xf1"
+"\x7a\x1f\xd0\x2b\x36\x25\xc9\x7a\x87\x30\x2d\xfa\xed\xef\x7b\x81\xd6\x15\xfa\x56\xf0\x7a\xf6\x41\x57\x18\x43\x41\x79\xb7\x28\x15"
+"\x83\x3d\x5f\xcd\xde\xf0\x06\x01\x79\xfe\x07\x38\x04\xcb\x72\x20\x26\xb8\xc4\x74\xf0\xc3\x32\xf0\x7b\xb7\xfa\xd0\xef\x20\xdc\x41"
+"\xc9\x43\xcd\xde\xf0\x78\xb7\x28\xf6\x93\x58\x47\x81\x83\xfa\xaa\xef\xcd\x87\xf0\xc3\x74\xf0\x3e\x06\x32\x52\xae\x18\x2e\xcd\xfb"
+"\xf0\x30\x03\xcb\xc2\xaf\x47\xcc\x13\xf1\x20\x0e\xcb\xc2\x04\x3a\x52\xae\xb7\x28\x05\x05\x3c\x32\x52\xae\xcb\x4a\xd9\x01\xf0\x35"
+"\x05\xd6\x04\x30\xfb\x79\xb7\x28\x04\x83\x90\x5f\x78\xf5\x47\xcd\x59\xf0\xf1\xb8\x28\x0d\x1c\x23\x05\xe5\x7e\xfe\x2e\x20\x01\x23"
+"\x36\x31\xe1\x3e\x04\xcd\xc2\xf0\xe5\x21\x45\x2b\x7b\xb7\xf2\x44\xf0\xaf\x93\x26\x2d\x22\x4c\xae\x2e\x2f\x2c\xd6\x0a\x30\xfb\xc6"
+"\x3a\x67\x22\x4e\x3c\x08\xf0\x09\x87\xf0\xcd\x13\xf1\x80\xb9\x30\x05\xcd\x9a\xf0\x18\x0a\xfe\x15\x38\x02\x3e\x14\x91\xc4\xc2\xf0"
+"\x71\x00\xf1\x19\xc8\x0e\x2e\x78\xc5\x47\x04\x85\x6f\x8c\x95\x67\x2b\x79\x4e\x77\x10\xfa\xc1\xc9\x7b\x81\x47\xf0\x2f\x3c\x06\x14"
+"\xb8\x30\x01\x47\x2b\x36\x30\x0c\x10\xfa\xc9\x4f\x21\x00\xf0\x48\xe5\xc5\x7e\xfe\x35\xd4\xb4\xf0\xc1\x38\x05\x2b\x36\x31\x04\x0c"
+"\xe1\x2b\x18\x38\x79\xb7\xc8\x2b\x0d\x7e\x34\xfe\x39\xd8\x36\x30\x18\xf2\xd5\xc5\xeb\x47\x7b\x90\x6f\x9f\x82\x67\xe5\x1a\x13\x77"
+"\x23\xb7\x20\xf9\x2b\x36\x30\x23\x10\xfb\xe1\xc1\xd1\xc9\x21\x50\xae\x2b\x7e\xfe\x30\x20\x05\x0d\x04\x20\xf6\x2b\xd5\xc5\x11\x4f"
+"\xae\x06\x00\xcd\xf5\xff\xeb\xa1\x01\xf1\x09\xc5\x7a\xe6\x04\x1f\x1f\x47\xcb\x62\x20\x07\x7a\x87\xb3\xf2\x0d\xf1\x04\x3a\x53\xae"
+"\x90\xc1\xc9\xa4\x00\xf0\x4b\x3d\xc9\xcb\x4a\xc8\x78\xd6\x03\xd8\xc8\xf5\x0e\x2c\xcd\x77\xf0\x04\xf1\x18\xf2\xe5\x7e\x23\x3d\xfe"
+"\x30\x38\xf9\x3c\x20\x01\x5f\xe1\x7a\xee\x80\xf4\xfb\xf0\xd8\xc8\x3e\x30\x18\x06\xcb\x52\xc8\x3a\x54\xae\x04\x2b\x77\xc9\x7b\x87"
+"\x3e\x2d\x38\x0e\x7a\xe6\x98\xee\x80\xc8\xe6\x08\x3e\x2b\x20\x02\x3e\x20\xcb\x62\x28\xe4\x32\x50\xae\xaf\x32\x51\xae\xc9\x7a\xb7"
+"\xf0\x65\x00\x80\xc8\x38\x0e\x47\xcb\x6a\x3e\x2a\x1f\x00\x00\xef\x19\xf0\x03\xc9\xcb\xc2\xc9\x11\x2d\xae\xaf\x47\xb6\x2b\x20\x05"
+"\x0d\x20\xf9\x18\x28\x11\x14\xf0\x26\xeb\xd5\x57\x18\x11\x1a\x1b\xd5\x37\x8f\x57\x58\x7e\x8f\x27\x77\x23\x1d\x20\xf8\x30\x03\x04"
+"\x36\x01\x21\x2d\xae\x7a\x87\x20\xea\xd1\x0d\x20\xe1\xeb\x21\x50\xae\x36\x00\x78\x87\x4f\xc8\x3e\x30\xeb\xed\x67\x1b\x12\x04\x00"
+"\xf0\x21\x23\x10\xf5\xeb\xfe\x30\xc0\x0d\x23\xc9\xd5\xeb\x21\x3e\xae\x36\x00\x3d\xf5\x7b\xa1\xf6\xf0\x27\xc6\xa0\xce\x40\x2b\x77"
+"\x78\xcb\x3a\xcb\x1b\x10\xfa\x47\xf1\x3d\xf2\xe7\xf1\x7a\xb3\x3e\x00\x20\x22\x26\x30\xeb\xfe\xe7\x7c\x1e\x00\xd0\x04\x40\x3f\xf2"
+"\xd1\x12\xc3\x1d\x40\x44\x4d\xed\x78\x14\x00\xf0\x0c\x3a\xf2\xed\x79\xc9\xcd\x3a\xf2\x57\x3e\x00\xc4\x3f\xf2\x5f\xed\x78\xab\xa2"
+"\x28\xfa\xc9\xcd\xf5\xce\x42\x4b\x78\x1e\xe1\xb8\xce\x23\x7e\xb7\x23\xe5\xcc\xd4\xbc\xeb\xe1\x30\x07\x76\x0e\x01\xba\x2b\xf0\x05"
+"\x1c\xcd\xf5\xce\x0e\xff\xed\x53\x55\xae\x79\x32\x57\xae\xed\x73\x5a\xae\x06\x20\x47\x1e\xf0\x1b\x08\xc5\xcd\xe3\xce\xc1\xd5\x10"
+"\xf3\xcd\x37\xde\x22\x58\xae\x3e\x20\x90\xdd\x21\x00\x00\xdd\x39\xdf\x55\xae\xed\x7b\x5a\xae\xcd\xcc\xfb\x2a\x58\xae\xc9\x3e\x0d"
+"\x18\x03\x73\x2e\xf0\x21\x5c\xae\xc9\xcd\xcf\xc1\xcd\x3d\xde\xda\x98\xc3\xfe\xed\xca\x7e\xf3\xeb\x21\xc3\xf2\xcd\xb4\xff\xeb\xcd"
+"\xfe\xff\xcd\x3d\xde\x30\xeb\xc9\x04\xd2\xf2\x2c\x19\xf3\xe5\x34\xf3\xea\x3d\xf3\x3b\x2c\x68\x20\xf1\x0d\xf5\xe5\xcd\x66\xff\x28"
+"\x0f\xcd\x68\xef\xcd\x8a\xf8\x36\x20\x2a\xa0\xb0\x34\x7e\x18\x1f\x2a\xa0\xb0\x46\x0e\x00\x3b\x23\xf0\x11\x04\x18\x0e\x7e\xfe\x20"
+"\x23\x30\x07\x3d\x20\x07\x05\x28\x04\x23\x0c\x10\xf0\x79\xcd\xe7\xc2\xd4\x98\xc3\xcd\xd0\xf8\xe1\xf1\xcc\xd6\x17\x60\x2c\xde\x3a"
+"\x5c\xae\x4f\x30\x30\xf0\x19\x91\x30\xfd\x2f\x3c\x47\x81\xcd\xe7\xc2\xd2\x98\xc3\x78\x18\x1e\xcd\x5d\xf3\xcd\x69\xf3\x7b\x18\x15"
+"\xcd\x5d\xf3\x1b\xcd\x69\xf3\xcd\xb9\xc2\x2f\x3c\x1c\x83\x38\x2c\x2f\xd0\x1d\x7b\x47\x04\x05\xc8\x3e\x20\xcd\xa0\xc3\x18\xf7\xeb"
+"\x1c\x10\x19\x17\x1f\x60\xc3\x1d\xde\x7a\x17\x30\x12\x29\xc1\xcd\xcf\xc2\xd0\xe5\xeb\x5f\x16\x00\xcd\xae\xdd\x4b\x23\x71\xcd\x09"
+"\xcf\xcd\x25\xde\x3b\xb2\x23\xb1\xcd\x62\xcf\xaf\x32\x5d\xae\xd1\xd5\xeb\x46\xa7\x00\xf0\x02\xeb\xcd\xcd\xf3\xd2\xab\xf4\xcd\x3d"
+"\xde\x38\x11\xcd\xef\xf3\x28\x0c\xff\x21\xf0\x0d\xd1\xcd\xcd\xf3\x30\xdc\x18\xea\xf5\x3e\xff\x32\x5d\xae\xcd\xcd\xf3\xf1\xdc\x98"
+"\xc3\xe3\xcd\x03\xfc\xe1\xc9\x78\xe2\x0f\xf0\x35\xfe\x5f\x20\x07\x13\x10\x0c\x04\x1b\x18\x08\xcd\xf7\xf3\xd4\x31\xf4\x38\x08\x1a"
+"\xcd\xa0\xc3\x13\x10\xe5\xb7\xe1\xc9\xfe\x3b\xca\x2c\xde\xc3\x15\xde\x1a\x0e\x00\xfe\x26\x28\x1e\x0c\xfe\x21\x28\x19\xee\x5c\xc0"
+"\xc5\xd5\x13\x05\x28\x0a\x0c\x1a\xfe\x5c\x28\x08\xfe\x20\x28\xf2\x57\x13\xf0\x05\xf1\xf1\x13\x05\xc5\xd5\x3a\x5d\xae\xb7\x20\x07"
+"\xcd\xdc\xf8\x79\xcd\x52\xf3\xd1\x4f\x09\x31\x48\xf4\xd0\x15\x00\xa0\x0b\xc5\xd5\x79\xcd\x6a\xef\xcd\x8b\xc3\x17\x00\xf0\x24\xc5"
+"\xd5\x0e\x80\x26\x00\x1a\xfe\x2b\x20\x07\x13\x05\x28\x24\x24\x0e\x88\x1a\xfe\x2e\x28\x20\xfe\x23\x28\x3e\x13\x05\x28\x14\xeb\xbe"
+"\xeb\x20\x0f\x24\x24\x2e\x04\xcd\x02\xf5\x28\x24\x2e\x20\xfe\x2a\x28\x11\x65\x00\xf0\x1c\x13\x05\x28\xf8\x1a\xfe\x23\x20\xf3\x1b"
+"\x04\x18\x15\x13\x05\x28\x0e\x1a\xcd\x02\xf5\x20\x08\x24\x2e\x24\x32\x54\xae\x13\x05\x79\xb5\x4f\xf1\xf1\xcd\xae\xf4\x7c\x85\xfe"
+"\x15\x8c\x2a\x40\xaf\x6f\xb0\xc8\x58\x00\xf6\x42\x0f\xfe\x23\x28\x06\xfe\x2c\x20\x10\xcb\xc9\x24\x13\x10\xed\xc9\x2c\x13\x05\xc8"
+"\x1a\xfe\x23\x28\xf7\xeb\xe5\xfe\x5e\x20\x16\x23\xbe\x20\x12\x23\xbe\x20\x0e\x23\xbe\x20\x0a\x23\x78\xd6\x04\x38\x04\x47\xe3\xcb"
+"\xf1\xe1\xeb\x04\x05\xc8\xcb\x59\xc0\x1a\xfe\x2d\x28\x05\xfe\x2b\xc0\xcb\xd9\xcb\xe1\x13\x05\xc9\xfe\x24\xc8\xfe\xa3\x64\x02\x32"
+"\xcd\x62\xcf\x3f\x02\x30\x08\xcd\x5a\xdd\x00\x60\x18\x0d\x3e\x22\xcd\xa0\x18\x02\x01\x08\x00\xa0\xe1\xf1\xca\x98\xc3\xcd\xef\xf3"
+"\x3e\x2c\xe2\x01\xf0\x1d\xd2\x01\x00\xac\xcd\xde\xff\xd0\x22\x5e\xae\x22\x73\xb0\x22\x60\xae\xeb\x22\x62\xae\x01\x2f\x01\x09\xd8"
+"\x22\x64\xae\xeb\x23\xed\x52\xd8\x7c\xfe\x04\xd8\xcd\x7f\xf7\x32\x6e\xae\x31\x03\x30\xe5\x2a\x60\x9f\x1b\xf1\x30\x38\x31\x13\xcd"
+"\xec\xf5\xdc\x8a\xf5\xeb\xcd\x08\xf8\x2a\x76\xb0\x22\x78\xb0\xe1\xc9\xcd\xae\xbb\xed\x4b\x5e\xae\xdc\xe0\xf5\x38\x12\x2a\x76\xb0"
+"\x2b\xcd\xe0\xf5\xd0\x3a\x75\xb0\xb7\xc8\xfe\x04\xca\x7f\xf7\xc3\x75\xf8\xd5\xeb\x09\x2b\xed\x4b\x62\xae\xe3\x6c\x34\xf0\x1e\xe0"
+"\xf5\xeb\xe3\xeb\xdc\xe0\xf5\x30\xe5\xed\x4b\x76\xb0\x21\xff\x0f\x09\xcd\xe0\xf5\xd1\xdc\xe0\xf5\xd8\xeb\x50\x59\xcd\xec\xf5\xc2"
+"\x7f\xf7\x22\x78\xb0\xc9\xd5\xe5\xb7\xed\x42\xeb\x04\x00\x30\x18\x06\xd5\xa5\x24\x10\x23\x52\x0a\xf1\x05\xd1\xc9\xd5\xe5\x2a\x71"
+"\xb0\xeb\x2a\x73\xb0\xcd\xe4\xff\xe1\xd1\xc9\x2a\x66\xae\x6e\x09\xf0\x07\x6e\xae\xb7\xc0\x2a\x68\xae\x09\x22\x68\xae\x2a\x6a\xae"
+"\x09\x22\x6a\xae\x2a\x6c\xae\x09\x2f\x20\x50\xcd\xfc\xf6\x44\x4d\xc2\x0a\xe0\xcd\xb8\xf6\x3e\xff\x32\x6e\xae\x18\xd7\xaf\x32\x6e"
+"\xae\x12\x00\x20\x2a\x68\xfb\x34\xf0\x18\xcd\xe5\xf6\x18\xc4\x21\x6f\xae\x22\x6f\xb0\x3e\x01\xcd\x72\xf6\x36\x00\x23\x22\x19\xae"
+"\x18\x0c\x2a\x6f\xb0\x2f\x3c\xc8\x85\x6f\x3e\xff\x8c\x67\x22\x6f\xb0\x15\x2e\x11\xe5\xdb\x05\x00\x29\x00\xf1\x07\x94\x85\x3e\x4f"
+"\x8c\xe1\xd0\xcd\x4f\xf6\xc3\x75\xf8\x2a\x73\xb0\x22\x71\xb0\xc9\x06\x00\xc9\x1c\xf0\x19\x71\xb0\xb7\xed\x42\x2b\x2b\xcd\xd8\xff"
+"\x30\x09\xcd\x64\xfc\x38\xea\xcd\x45\xcb\x0e\x22\x71\xb0\x23\x71\x23\x70\x23\xc9\xcd\x14\xf7\xc5\xd5\xd5\xe5\x09\x38\x0e\x47\x0b"
+"\x00\x25\x00\x10\x08\x25\x00\xf1\x02\xf3\xc3\x75\xf8\xe1\xc1\xd5\x7d\x91\x4f\x7c\x98\x47\x2b\x1b\xcd\xf5\xd2\x1b\x80\xc5\xd5\xeb"
+"\x09\xeb\xcd\x14\xf7\x75\x0b\xb5\xd1\xcd\xef\xff\xd1\x21\x00\x00\xc3\xe4\xff\x67\x00\xa0\x52\xc9\x3a\x6e\xae\xb7\x2a\x71\xb0\xc8"
+"\x0d\x20\x02\x0d\x00\xf0\x07\x6c\xae\xc8\x2a\x66\xae\xc9\x11\x01\x00\x18\x08\x11\x02\x08\x18\x03\x11\x00\x08\xc5\xe5\x91\x01\xf0"
+"\x10\x20\x18\xd5\x2a\x5e\xae\x23\x22\x78\xb0\x11\x00\xf0\x19\xd2\x75\xf8\xcd\x08\xf8\x22\x76\xb0\xd1\x3e\x04\xb3\x2a\x76\xb0\x1e"
+"\x93\x0b\x90\xc1\x18\x27\x3e\xfe\x18\x06\x3e\xfd\x8e\x32\xf0\x16\xe5\x21\x75\xb0\xa6\x77\xfe\x04\x20\x09\x2a\x76\xb0\xeb\xcd\xec"
+"\xf5\x28\x02\xe1\xc9\x2a\x78\xb0\xcd\x08\xf8\xe1\xaf\x32\x75\xb0\xc9\xfe\x80\x28\x29\x01\x2f\xf1\x14\xcd\x15\xde\x06\x08\x37\xd4"
+"\x41\xde\x9f\xdc\xb8\xce\xf5\xb7\x10\xf5\xeb\x79\xcd\xa5\xbb\xd2\x4d\xcb\x01\x08\x00\x09\xf1\x2b\x77\x0d\x20\xfa\xac\x22\x90\xcd"
+"\xd8\xce\xe5\x21\x00\x01\xcd\xd8\x7b\x28\xf0\x00\xd5\xcd\xae\xbb\xeb\x30\x1b\x2f\x6f\x26\x00\x23\x29\x29\x29\xfa\x01\xf0\x04\x4d"
+"\xcb\x19\xcd\x08\xf8\xcd\x61\xf7\x11\x00\x01\xcd\xab\xbb\xd1\xcd\xe9\xf7\xc9\x1d\x90\x01\xb7\xed\x52\xc8\xd5\x29\x29\x29\x40\x02"
+"\xf0\x09\xed\x52\x7c\xfe\x40\xda\x75\xf8\x23\xcd\x08\xf8\xd1\xc3\xab\xbb\xe5\xcd\x64\xfc\xeb\xcd\xf8\xf5\xef\x01\xf0\x1b\x3f\xdc"
+"\xd8\xff\x30\x5b\x2a\x5e\xae\xeb\x37\xed\x52\x22\x7a\xb0\xe5\x11\x65\xf8\xcd\x93\xda\xc1\x78\x07\x38\x14\xb1\x28\x2b\x2a\x73\xb0"
+"\x54\x5d\x09\xe5\xcd\xf8\xf5\xeb\x60\x01\x45\x18\x13\x2a\x71\x11\x00\xf0\x06\x23\x13\xcd\xef\xff\xeb\x2b\xd1\x22\x73\xb0\xeb\x22"
+"\x71\xb0\xe1\x2b\x22\x5e\xae\x23\x5e\x02\x00\x26\x03\xf0\x0c\x2a\x7a\xb0\x09\xeb\x72\x2b\x73\xc9\xcd\x45\xcb\x07\x23\xcd\xa7\xf8"
+"\x7e\xfe\x22\xca\x2c\xde\xb7\x28\x31\x04\xe6\x17\x20\xa7\xf8\xe6\x0e\xf0\x1d\x04\x18\xf9\xcd\xa7\xf8\x4f\x7e\xb7\x28\x1b\xb9\x28"
+"\x18\xfe\x2c\x28\x14\x23\x04\x18\xf1\x22\x9d\xb0\xd1\x06\x00\xcd\xfe\xff\x78\x32\x9c\xb0\xc3\xd6\xfb\xe5\x04\x05\x28\x12\x2b\x90"
+"\x1a\x90\xf7\xfe\x09\x28\xf3\xfe\x0d\x28\xef\xa8\x2d\xd1\xe1\xc9\xcd\xf5\xfb\xc8\x1a\x13\xcd\xb8\xc3\x10\xf9\x0c\x00\xf0\x0f\x79"
+"\x90\x30\x05\x80\x28\x02\x47\xaf\x4f\x18\xe8\x01\xf1\xf8\x18\x0c\xfe\x41\xd8\xfe\x5b\xd0\xc6\x20\xc9\x01\xab\xff\xc5\x12\x2a\xf0"
+"\x01\xf5\xfb\xcd\x41\xfc\x23\x4e\x23\x66\x69\xc1\x3c\x3d\xca\xd6\xfb\xc2\x17\x70\xfc\xff\x12\x13\xf1\x18\xf1\x16\x18\x30\x1a\x86"
+"\x30\xad\x0c\xf0\x21\x0f\xcd\x41\xfc\xcd\x59\xf9\xd5\xc5\x48\xcd\xd6\xfb\x79\xcd\xec\xff\xc1\xe1\x79\xc3\xec\xff\xcd\x59\xf9\xaf"
+"\xb9\x28\x0f\xb8\x28\x0a\x05\x0d\x1a\x13\x96\x23\x28\xf2\x9f\xc0\x3c\xc9\xb8\xc8\x9f\x7d\x00\x80\x48\xd5\xcd\x03\xfc\xeb\xd1\xc9"
+"\xee\x15\x50\x03\x01\x0f\x04\xc5\xd2\x23\x30\xcd\xeb\xfe\x76\x1c\x00\xe3\x01\xf0\x04\xfe\x11\xd2\x4d\xcb\x47\xcd\x1d\xde\x78\xeb"
+"\xe1\xc1\xd5\xcd\xdf\xf1\x18\x31\x4a\x27\x11\x15\x47\x27\x11\x03\xcf\x23\x00\x13\x27\x11\xd5\x60\x24\xd0\x78\xb7\xc4\x48\xf4\xd2"
+"\x4d\xcb\x78\xb7\xc2\x4d\xcb\x79\x05\x00\x54\x28\xf0\x03\x68\xef\xe5\x0e\xff\xaf\x0c\xbe\x23\x20\xfb\xe1\x79\xcd\xd3\xfb\xcd\xec"
+"\x62\x28\xe0\x43\xfa\x18\x18\xcd\x43\xfa\x1a\x90\x38\x11\x4f\x18\x0e\xed\x2f\xa0\x43\xfa\xca\x4d\xcb\x05\x48\xcd\x4f\xfa\x24\x24"
+"\x40\xeb\xcd\x60\xfa\xcf\x00\xb0\x03\xfc\xeb\xcd\xd6\xfb\x06\x00\x09\x18\x37\x25\x00\x02\xed\x1e\x70\xeb\xcd\x58\xfb\xe3\xcd\x55"
+"\x31\x00\x22\x3d\x4f\x31\x00\xa0\xcd\x21\xde\xc5\xcd\x03\xcf\x78\xc1\xe3\x9f\x09\x81\xcd\x60\xfa\x23\x46\x23\x66\x68\xfa\x2f\x01"
+"\x70\x00\xf1\x02\x09\xcf\xeb\x2a\xa0\xb0\xeb\x0e\x00\x18\x06\x06\xff\x7e\xfe\x29\xc8\xc6\x34\xe0\xb8\xce\x47\xd1\xb7\xc9\x7e\x91"
+"\x30\x01\xaf\xb8\xd8\x78\x10\x01\x50\x18\x03\xcd\xa6\xfa\x51\x08\xf4\x09\xd9\xfa\x37\x4f\x9f\xe6\x01\x18\x34\xcd\x6f\xc4\x30\xf5"
+"\xfe\xfc\x28\xf1\xfe\xef\x28\xed\x18\xea\x03\x26\x01\xcb\x24\x70\xcd\xa1\xfa\x4f\xf1\x18\x11\xbb\x2b\xf0\x20\x33\xcd\xf5\xfb\x28"
+"\x37\x1a\xc9\xcd\xd9\xfa\x0e\x20\x47\xcd\xd3\xfb\x79\x04\x05\xc8\x12\x13\x18\xfa\xcd\xf5\xfb\xca\x32\xff\xeb\xe5\x5f\x16\x00\x19"
+"\x5e\x72\xe3\xd5\xcd\x6f\xed\xd1\xe1\x73\x75\x12\x91\x0d\xe5\xcd\xb6\xfe\x7c\xb7\x7d\xe1\x47\x27\xf1\x01\x62\xcf\xcd\x66\xff\x0e"
+"\x01\x28\x0e\xcd\xd9\xfa\xb7\xca\x4d\xcb\x01\x26\x52\x09\xcf\xcd\x15\xde\x78\x07\x01\x6d\x01\x50\xe3\x79\x48\xd5\xf5\xb2\x01\x10"
+"\xf1\x4f\x00\xf0\x15\x2b\x78\x93\x3c\x47\x7b\xd1\x38\x25\x0c\x0d\x28\x22\xf5\x78\xb9\x38\x1b\xe5\xd5\xc5\x1a\xbe\x20\x0b\x23\x13"
+"\x0d\x20\xf7\xc1\xd1\xe1\xf1\x18\x0b\x06\x00\x71\x3c\x23\x05\x18\xe0\xf1\xaf\x14\x2a\xa0\xd5\xe5\x11\x65\xfb\xcd\x93\xda\xe1\xd1"
+"\xec\x21\xf0\x03\x4e\x23\x46\xeb\xb7\xc4\x65\xfb\xe1\xc9\x2a\x71\xb0\xcd\xde\xff\x30\x07\x6f\x05\xe0\xde\xff\xd0\xeb\x2b\x2b\xe5"
+"\xcd\xb9\xfb\xe1\x3a\x9c\xb0\x41\x21\x20\x9d\xb0\x82\x12\xb0\xc9\xcd\x37\xfc\xd8\xcd\xb9\xfb\xc3\xd6\xfb\x96\x02\x20\x1f\xfc\xcd"
+"\x07\x20\x2a\x64\x2f\x06\x40\x2a\x73\xb0\xeb\x93\x03\x10\x0a\x8e\x0f\xc1\xcd\xd8\xff\xd4\x37\xfc\xe1\xd8\x7e\xcd\x41\xfc\xba\x20"
+"\xf0\x19\x66\x69\xcd\xec\xff\xd1\x21\x9c\xb0\xc9\x21\x7e\xb0\x22\x7c\xb0\xc9\xcd\x41\xfc\xe5\x3e\x03\x32\x9f\xb0\x2a\x7c\xb0\x22"
+"\xa0\xb0\x11\x9c\xb0\xcd\xd8\xff\x3e\x10\x52\x2a\x50\x7c\xfb\x22\x7c\xb0\xd8\x26\x20\x5e\xff\x65\x00\xf0\x01\x03\xfc\xe1\x78\xb7"
+"\xc9\xcd\x1f\xfc\xc0\x78\xb7\xc8\x2a\x71\xb0\x55\x19\xa0\xd8\xff\xc0\x2b\x2b\x6e\x26\x00\x19\x2b\x8c\x05\x80\xe5\xed\x5b\x7c\xb0"
+"\x1b\x1b\x1b\xf8\x1a\x60\x04\xed\x53\x7c\xb0\x46\x0a\x14\xf0\x0c\xe1\xc9\x2a\xa0\xb0\x3e\x7d\x95\x3e\xb0\x9c\xc9\xe5\xc5\x4f\xb7"
+"\xc4\x93\xf6\x79\x32\x9c\xb0\x22\x9d\xb0\xeb\xc1\x37\x61\x66\xff\x20\x06\xcd\xf5\x30\x11\xd1\xfc\xf6\xc3\x89\xfe\xe5\xd5\xc5\x21"
+"\x7e\xb0\x18\x0c\x68\x21\x70\xeb\xb7\xc4\xe3\xfc\xeb\x23\x58\x00\x00\x55\x00\xa0\xeb\x11\xe3\xfc\xcd\x93\xda\x2a\x73\xb0\x91\x06"
+"\xf0\x12\x23\x5d\x54\x18\x14\x4e\x23\x46\x04\x05\x28\x0b\x2b\x0a\x4f\x06\x00\x03\x03\xed\xb0\x18\x02\x23\x09\xc1\xc5\xcd\xde\xff"
+"\x38\xe5\x1b\xb5\x06\x90\xcd\xe4\xff\xd1\xcd\xd8\xff\xf5\xd5\xc9\x0b\xf0\x02\x22\x71\xb0\xc1\x23\x18\x12\x5e\x23\x56\x2b\x1a\x77"
+"\x23\x36\x00\x23\x61\x04\x40\x6f\x26\x00\x19\x30\x00\x90\xe9\xf1\xc1\xd1\xe1\xc9\x2a\x6c\xae\x7e\x04\xf1\x24\x0b\x7a\x02\x0b\x0a"
+"\x12\x7b\x02\xc9\xcd\x4f\xff\xd2\x76\xbd\xcd\x2a\xdd\x22\xa0\xb0\x21\xa1\xb0\xc9\xcd\xeb\xfe\x21\xa1\xb0\xc3\x30\xdd\xcd\x3b\xfe"
+"\x30\x09\xcd\x4a\xdd\xda\x35\xff\xcd\x78\xfe\xcd\x7c\xbd\x12\x0f\x01\x15\x00\x14\x52\x15\x00\x52\x82\xbd\xd8\x18\xe9\x29\x00\x14"
+"\x5b\x14\x00\xf0\x0d\x85\xbd\xd8\x18\xd5\xcd\x3b\xfe\xda\x02\xde\xc3\x8e\xbd\xcd\x70\xfe\xeb\xd5\xcd\x88\xbd\xd1\x01\x05\x00\xed"
+"\xb0\x11\x28\x00\x58\x0f\x50\xc3\xfe\xeb\xcd\x9c\x31\x00\x90\x28\x10\x21\x00\x80\xc3\x89\xfe\xcd\x12\x00\x10\xa3\x12\x00\xf0\x00"
+"\xcd\x45\xcb\x0b\xcd\xc3\xfe\x7b\xa5\x6f\x7c\xa2\xc3\x34\xff\x0b\x00\x60\xb5\x6f\x7a\xb4\x18\xf3\x0a\x00\xf0\x05\xad\x6f\x7c\xaa"
+"\x18\xe9\xcd\xb6\xfe\x7d\x2f\x6f\x7c\x2f\x18\xdf\xcd\xc4\xfd\xf0\xc1\x00\x40\x91\xbd\xcd\xed\xc1\x00\x90\xd4\x89\xfe\xc9\xc5\xe5"
+"\xcd\xcc\xfd\x43\x3c\x91\x4f\xff\xda\xf9\xdd\xc3\x94\xbd\xe5\x32\x04\xf0\x34\xcd\x4f\xff\x78\x30\x0b\xb7\xf0\xcd\x93\xfe\xcd\xf4"
+"\xfd\xc3\xb6\xfe\xb7\x20\x05\x11\x6d\xbd\x18\x26\xd5\xc5\x78\xcd\x79\xbd\xdc\x6d\xbd\x78\xc1\xd1\x30\x08\xcd\x67\xbd\xaf\x90\xc3"
+"\x79\xbd\xeb\xc3\x6f\xff\x11\x70\xbd\x18\x03\x11\x73\xbd\xcd\x4f\xff\xd8\xcd\xfe\xff\xd0\x1e\x24\xe1\x2c\xfe\xd8\xcd\x45\xff\x78"
+"\xc3\x67\xbd\x79\xfe\x03\xd0\x5d\x1f\xf0\x2b\x37\xdd\xd0\xc3\x35\xff\x79\xfe\x03\x28\x2d\x3a\x9f\xb0\xfe\x03\x28\x26\xb9\x28\x17"
+"\x30\x0c\xe5\x21\x9f\xb0\x71\x23\xcd\x8c\xfe\xd1\xb7\xc9\xcd\x8c\xfe\xb7\xeb\x21\xa0\xb0\xc9\xee\x02\x20\xf7\x5e\x23\x56\x2a\xa0"
+"\xb0\x37\xc9\xc3\x62\xab\x26\x50\xb1\xfe\x02\x20\xc3\x7f\x02\x81\x93\xfe\x2a\x6f\xb0\xcd\x8c\xfe\x28\x00\x30\xaf\x18\x08\xc5\x01"
+"\xf2\x0d\x7a\x18\x08\x7c\xeb\x21\x9f\xb0\x36\x05\x23\xeb\xf5\xb7\xfc\xed\xdd\xf1\xc3\x64\xbd\x22\xa0\xb0\xeb\x22\xa2\xb0\x17\x00"
+"\xf0\x25\xaf\xc3\x67\xbd\xcd\xbc\xfe\xd8\x18\x3f\xcd\xce\xfe\x22\xa0\xb0\xc9\x79\xcd\xd5\xfe\xeb\xdc\xce\xfe\xd8\x18\x2d\x21\x9f"
+"\xb0\x7e\x36\x02\x23\xfe\x03\x38\x0d\xca\x62\xff\xc5\xcd\x6a\xbd\x47\xdc\x37\xdd\xc1\xc9\xb6\x00\x00\xf8\x01\x93\xd8\xcd\x6a\xbd"
+"\x30\x07\x47\xfc\x37\x78\x01\x10\x06\x9b\x02\x60\x9f\xb0\xbe\xc4\x0d\xff\x2a\x02\xf0\x00\xd6\x03\x38\xa5\xca\x5e\xff\xcd\x4f\xff"
+"\xda\x93\xfe\xc9\xe5\x72\x20\x70\xa0\xb0\x22\xa2\xb0\x22\xa3\xa0\x09\xf0\x00\xc4\xfd\x6f\x87\x9f\x18\x02\x6f\xaf\x67\x22\xa0\xb0"
+"\x3e\x02\x75\x25\xf0\x01\x21\xa0\xb0\x3e\x05\x18\xf5\x21\x9f\xb0\x4e\x23\xc9\x3a\x9f\xb0\x04\x00\x80\xfe\x03\x28\x0c\x2a\xa0\xb0"
+"\xd8\xfd\x00\x30\xcd\x66\xff\xa8\x2c\x11\x0d\x26\x01\xa0\xc9\x32\x9f\xb0\x11\xa0\xb0\x18\x13\xd5\x76\x25\x40\x4f\xcd\x72\xf6\x57"
+"\x38\x20\xd1\xc9\xff\x00\x00\x96\x27\x72\x4f\x06\x00\xed\xb0\xc1\xc9\x5f\x10\xf0\x1c\xd0\xfe\x5b\xc9\xcd\x92\xff\xd8\xfe\x2e\x37"
+"\xc8\xfe\x30\x3f\xd0\xfe\x3a\xc9\xfe\x61\xd8\xfe\x7b\xd0\xd6\x20\xc9\xf5\xc5\x46\x23\xe5\x23\x23\xbe\x23\x28\x03\x10\xf8\xe3\xf1"
+"\xdd\x00\x40\xc1\xf1\xc9\xc5\x34\x07\xf0\x22\x05\x23\xb9\x20\xf8\x37\x79\xc1\xc9\x7c\x92\xc0\x7d\x93\xc9\x7c\x90\xc0\x7d\x91\xc9"
+"\xe5\xb7\xed\x52\x44\x4d\xe1\xc9\x4f\x06\x00\x78\xb1\xc8\xed\xb0\xc9\x78\xb1\xc8\xed\xb8\xc9\xe9\xc5\xc9\xd5\xc9"
+;
+unsigned char dump_cpc6128_basic[16384];
+static const unsigned char dump_cpc6128_os_lz4[] =
+"\xf0\x9e\x01\x89\x7f\xed\x49\xc3\x91\x05\xc3\x8a\xb9\xc3\x84\xb9\xc5\xc9\xc3\x1d\xba\xc3\x17\xba\xd5\xc9\xc3\xc7\xb9\xc3\xb9\xb9"
+"\xe9\x00\xc3\xc6\xba\xc3\xc1\xb9\x00\x00\xc3\x35\xba\x00\xed\x49\xd9\xfb\xf3\xd9\x21\x2b\x00\x71\x18\x08\xc3\x41\xb9\xc9\x00\x00"
+"\x00\x00\xcb\xd1\x18\xe8\x21\x40\x00\x2d\x7e\x77\x20\xfb\x3e\xc7\x32\x30\x00\x21\xa6\x03\x11\x00\xb9\x01\xe4\x01\xed\xb0\xf3\x3a"
+"\xd9\xb8\xed\x5b\xd7\xb8\x06\xcd\x21\x2d\xb8\x36\x00\x23\x10\xfb\x47\x0e\xff\xa9\xc0\x47\x5f\x57\xc9\x7c\xb5\x79\x20\x04\x7d\x21"
+"\x06\xc0\x32\xd6\xb8\x32\xd9\xb8\x22\xd7\xb8\x21\xff\xab\x11\x40\x00\x01\xff\xb0\x31\x00\xc0\xdf\xd7\xb8\xc7\xf3\xed\x5b\xb6\xb8"
+"\x2a\xb4\xb8\xfb\xc9\xf3\xaf\x32\xb8\xb8\xed\x53\xb6\xb8\x22\x0e\x00\xf2\x09\x21\xb4\xb8\x34\x23\x28\xfc\x06\xf5\xed\x78\x1f\x30"
+"\x08\x2a\xb9\xb8\x7c\xb7\xc4\x53\x01\x2a\xbb\x08\x00\xf0\x1a\xcd\xd7\x20\x21\xbf\xb8\x35\xc0\x36\x06\xcd\xf4\xbd\x2a\xbd\xb8\x7c"
+"\xb7\xc8\x21\x31\xb8\xcb\xc6\xc9\x2b\x36\x00\x2b\x3a\x2e\xb8\xb7\x20\x0c\x22\x2d\xb8\x22\x2f\xb8\x16\x00\x50\xf6\xc9\xed\x5b\x2f"
+"\x0d\x00\xf0\x00\xeb\x73\x23\x72\xc9\xed\x73\x32\xb8\x31\xb4\xb8\xe5\xd5\xc5\x1c\x00\xf0\x0b\x76\x28\x1e\xcb\xfe\x2a\x2d\xb8\x7c"
+"\xb7\x28\x0e\x5e\x23\x56\xed\x53\x2d\xb8\x23\xcd\x09\x02\xf3\x18\xeb\x1e\x00\xf0\x2b\x46\x28\x10\x36\x00\x37\x08\xcd\x89\x01\xb7"
+"\x08\x21\x31\xb8\x7e\xb7\x20\xd2\x36\x00\xc1\xd1\xe1\xed\x7b\x32\xb8\xc9\x5e\x23\x7e\x23\xb7\xca\xe2\x01\x57\xd5\xcd\xe2\x01\xe1"
+"\x18\xf0\xe5\x23\x23\xcd\xd2\x01\xe1\x11\xb9\xb8\xc3\x79\x03\x06\x00\x24\x88\x03\x13\x00\x11\xbb\x13\x00\x52\xbb\xb8\xc3\x88\x03"
+"\xad\x00\xf0\x06\x5e\x23\x56\x23\x4e\x23\x46\x78\xb1\x28\x16\x0b\x78\xb1\x20\x0e\xd5\x23\x23\xe5\x23\x47\x00\xf1\x0a\x46\x2b\x4e"
+"\x2b\xd1\x70\x2b\x71\xeb\x18\xd9\xe5\x23\x23\xf3\x73\x23\x72\x23\x71\x23\x70\xe1\x11\xbd\x42\x00\xf2\x05\xbd\xb8\xcd\x88\x03\xd0"
+"\xeb\x23\x5e\x23\x56\xc9\xf3\x23\x23\x36\x00\x23\x70\x23\x23\x00\xf2\x60\xfb\xc9\x23\x23\xf3\x7e\x34\xfa\x01\x02\xb7\x20\x15\x23"
+"\x7e\x2b\xb7\xf2\x2e\x02\x08\x30\x11\x08\x87\xf2\xe8\x00\x35\x23\x23\x18\x21\x35\x08\x38\x01\xfb\x08\xc9\x08\xfb\x7e\x3d\xf8\xe5"
+"\xcd\x1b\x02\xe1\x35\xc8\xf2\x0d\x02\x34\xc9\x23\x23\x23\x7e\x23\x1f\xd2\xc1\xb9\x5e\x23\x56\xeb\xe9\x21\x00\x00\x22\xc1\xb8\xc9"
+"\xe5\x47\x11\xc3\xb8\xeb\x2b\x2b\x56\x2b\x5e\x7a\xb7\x28\x07\x13\x13\x13\x1a\xb8\x30\xef\xd1\x1b\x23\x7e\x12\x1b\x72\x2b\x7e\x12"
+"\x73\x4d\x00\x30\xf3\x2a\xc0\x39\x01\x20\x17\xe5\xcf\x00\xf0\x18\x23\x3a\xc2\xb8\xbe\x30\x0a\xf5\x7e\x32\xc2\xb8\xed\x53\xc0\xb8"
+"\xf1\xe1\xfb\xc9\x32\xc2\xb8\x23\x23\x35\xc8\xf3\xf2\x2e\x02\x34\xfb\xc9\xcd\x8d\x02\x11\xc0\x04\x01\xc1\x23\x23\x36\xc0\x2b\x2b"
+"\xc9\x21\xc2\xb8\xcb\xee\x06\x00\xa2\xae\xc9\xe5\xed\x5b\xd3\xb8\x22\xd3\xb8\xce\x00\xf0\x09\x70\xe1\xc9\x11\xc3\xb8\x01\x10\x00"
+"\xcd\xa1\xba\xeb\x2b\xcb\xfe\x2a\xd3\xb8\x7d\x18\x10\xe5\x23\x34\x01\xf0\x27\xcd\xf1\x02\xd1\xd8\xeb\x7e\x23\x66\x6f\xb4\x20\xed"
+"\x0e\xff\x0c\xcd\x7e\xba\xf5\xe6\x03\x47\xcc\xf1\x02\xdc\x1c\x06\xf1\x87\x30\xee\x79\xfe\x10\x38\xe9\xc9\x21\x04\xc0\x78\xb7\x28"
+"\x04\x60\x69\x0e\xff\xcd\x79\xba\xc5\xa2\x00\xf0\x52\xeb\x18\x17\x01\xc3\xb8\x0a\xbe\x20\x08\x23\x03\x87\x30\xf7\xeb\x18\x0c\x7e"
+"\x23\x87\x30\xfb\x13\x13\x13\x7e\xb7\x20\xe5\xc1\xc3\x87\xba\x0e\x0f\xcd\x30\x03\x0d\xf2\x28\x03\xc9\x3a\xd9\xb8\xb9\xc8\x79\xfe"
+"\x10\xd0\xcd\x79\xba\x3a\x00\xc0\xe6\x03\x3d\x20\x22\xc5\x37\xcd\x06\xc0\x30\x1a\xd5\x23\xeb\x21\xda\xb8\xed\x4b\xd6\xb8\x06\x00"
+"\x09\x09\x73\x23\x72\x21\xfc\xff\x19\xcd\xa0\x02\x2b\xd1\x43\x00\xf1\x10\x7e\xbb\x23\x7e\x2b\x20\x03\xba\x37\xc8\xb7\xc8\x6e\x67"
+"\x18\xf0\xeb\xf3\xcd\x69\x03\x38\x06\x73\x23\x72\x13\xaf\x12\xfb\xc9\x0f\x00\xf2\x3a\x30\x06\x1a\x77\x13\x23\x1a\x77\xfb\xc9\xf3"
+"\xd9\x21\xd5\xb8\x56\x77\xf6\xc0\xed\x79\x7a\xd9\xfb\xc9\xc3\x5f\xba\xc3\x66\xba\xc3\x51\xba\xc3\x58\xba\xc3\x70\xba\xc3\x79\xba"
+"\xc3\x9d\xba\xc3\x7e\xba\xc3\x87\xba\xc3\xa1\xba\xc3\xa7\xba\x3a\xc1\xb8\xb7\xc8\xe5\xf3\x18\x06\x21\xbf\xb8\x36\x01\xc9\x80\x01"
+"\x31\x07\x23\x23\x7d\x01\xf0\x6a\xe1\xfb\xc9\xf3\x08\x38\x33\xd9\x79\x37\xfb\x08\xf3\xf5\xcb\x91\xed\x49\xcd\xb1\x00\xb7\x08\x4f"
+"\x06\x7f\x3a\x31\xb8\xb7\x28\x14\xfa\x72\xb9\x79\xe6\x0c\xf5\xcb\x91\xd9\xcd\x0a\x01\xd9\xe1\x79\xe6\xf3\xb4\x4f\xed\x49\xd9\xf1"
+"\xfb\xc9\x08\xe1\xf5\xcb\xd1\xed\x49\xcd\x3b\x00\x18\xcf\xf3\xe5\xd9\xd1\x18\x06\xf3\xd9\xe1\x5e\x23\x56\x08\x7a\xcb\xba\xcb\xb2"
+"\x07\x07\x07\x07\xa9\xe6\x0c\xa9\xc5\xcd\xb0\xb9\xf3\xd9\x08\x79\xc1\xe6\x03\xcb\x89\xcb\x81\xb1\x18\x01\xd5\x4f\xed\x49\xb7\x08"
+"\xd9\x78\x00\x10\x79\x37\x00\x72\x15\xf3\xe5\xd9\xe1\x18\x09\x3d\x00\x30\x23\xe5\xeb\x76\x01\xf0\x0f\x08\x7e\xfe\xfc\x30\xbe\x06"
+"\xdf\xed\x79\x21\xd6\xb8\x46\x77\xc5\xfd\xe5\xfe\x10\x30\x0f\x87\xc6\xda\x6f\xce\xb8\x95\x67\xc8\x01\xf0\x06\xe5\xfd\xe1\x06\x7f"
+"\x79\xcb\xd7\xcb\x9f\xcd\xb0\xb9\xfd\xe1\xf3\xd9\x08\x59\xc1\x78\x31\x00\x81\x32\xd6\xb8\x06\x7f\x7b\x18\x90\x93\x00\x14\x08\x56"
+"\x00\xf2\x01\x08\x7a\xcb\xfa\xcb\xf2\xe6\xc0\x07\x07\x21\xd9\xb8\x86\x18\xa5\x18\x00\x00\xef\x00\xb0\xed\x53\x46\xba\xd9\xfb\xcd"
+"\x45\xba\xf3\xd9\xcf\x00\x00\x98\x00\xd0\xd9\x79\xcb\x91\x18\x13\xf3\xd9\x79\xcb\xd1\x18\x0c\x07\x00\x30\x99\x18\x05\x07\x00\x10"
+"\xd9\xe5\x04\x30\xc9\xf3\xd9\xd8\x00\x82\x4f\x18\xf2\xcd\x5f\xba\x18\x0f\xeb\x01\xf0\x00\x2a\x01\xc0\xf5\x78\xcd\x70\xba\xf1\xe5"
+"\xf3\x06\xdf\xed\x49\xb5\x00\xf1\x00\x71\x48\x47\xfb\xe1\xc9\x3a\xd6\xb8\xc9\xcd\xad\xba\xed\xb0\x06\x00\xf1\x03\xb8\xc9\xf3\xd9"
+"\xe1\xc5\xcb\xd1\xcb\xd9\xed\x49\xcd\xc2\xba\xf3\xd9\xc1\x52\x00\x11\xe5\x75\x00\x92\x59\xcb\xd3\xcb\xdb\xed\x59\xd9\x7e\x67\x00"
+"\x80\xd9\x79\xf6\x0c\xed\x79\xdd\x7e\x5a\x05\x31\xc9\x26\xc7\x01\x00\x90\xf3\x01\x82\xf7\xed\x49\x01\x00\xf4\x05\x00\x80\xf6\xed"
+"\x49\x01\x7f\xef\xed\x49\xee\x04\xf0\x1c\xe6\x10\x21\xd5\x05\x20\x03\x21\xe5\x05\x01\x0f\xbc\xed\x49\x2b\x7e\x04\xed\x79\x05\x0d"
+"\xf2\xb7\x05\x18\x20\x3f\x28\x2e\x8e\x26\x00\x19\x1e\x00\x07\x00\x00\x30\x00\xc0\x00\x10\x00\x44\x1f\x06\x19\x1b\x10\x00\xf1\x34"
+"\x11\x77\x06\x21\x00\x00\x18\x32\x31\x00\xc0\xe5\xcd\xe9\x1f\xf3\x01\xff\xf8\xed\x49\xcd\x5c\x00\xe1\xd5\xc5\xe5\xcd\x98\x1b\xcd"
+"\x84\x10\xcd\xd0\x0a\xcd\x5f\xba\xe1\xcd\x1e\x00\xc1\xd1\x38\x07\xeb\x48\x11\xf9\x06\x18\x03\x11\x37\x07\xf3\xed\x56\xd9\x01\x00"
+"\xdf\xed\x49\x33\x00\xf1\x08\x01\xc0\x7f\xed\x49\x01\x7e\xfa\xaf\xed\x79\x21\x00\xb1\x11\x01\xb1\x01\xf9\x07\x77\xed\xb0\x44\x06"
+"\x30\xd9\xaf\x08\x5f\x00\xf1\x0f\xc5\xd5\xcd\x44\x00\xcd\xbd\x08\xcd\x5c\x1b\xcd\xe9\x1f\xcd\xbf\x0a\xcd\x74\x10\xcd\xa8\x15\xcd"
+"\xbc\x24\xcd\xe0\x07\xfb\x61\x00\xf0\x5c\xe1\xc3\x77\x00\x21\x02\x02\xcd\x70\x11\xcd\x23\x07\xcd\xfc\x06\x21\x88\x06\x18\x74\x20"
+"\x31\x32\x38\x4b\x20\x4d\x69\x63\x72\x6f\x63\x6f\x6d\x70\x75\x74\x65\x72\x20\x20\x28\x76\x33\x29\x1f\x02\x04\x43\x6f\x70\x79\x72"
+"\x69\x67\x68\x74\x1f\x02\x04\xa4\x31\x39\x38\x35\x20\x41\x6d\x73\x74\x72\x61\x64\x20\x43\x6f\x6e\x73\x75\x6d\x65\x72\x20\x45\x6c"
+"\x65\x63\x74\x72\x6f\x6e\x69\x63\x73\x20\x70\x6c\x63\x1f\x0c\x05\x61\x6e\x64\x20\x4c\x4c\x00\xf0\x32\x6f\x74\x69\x76\x65\x20\x53"
+"\x6f\x66\x74\x77\x61\x72\x65\x20\x4c\x74\x64\x2e\x1f\x01\x07\x00\x21\x05\x07\x7e\x23\xb7\xc8\xcd\xfe\x13\x18\xf7\x2a\x2a\x2a\x20"
+"\x50\x52\x4f\x47\x52\x41\x4d\x20\x4c\x4f\x41\x44\x20\x46\x41\x49\x4c\x45\x44\x20\x2a\x2a\x2a\x0d\x0a\x00\x7d\x01\xf3\x09\x2f\xe6"
+"\x0e\x0f\x21\x38\x07\x3c\x47\x7e\x23\xb7\x20\xfb\x10\xf9\xc9\x41\x72\x6e\x6f\x6c\x64\x00\x89\x00\xf1\x26\x00\x4f\x72\x69\x6f\x6e"
+"\x00\x53\x63\x68\x6e\x65\x69\x64\x65\x72\x00\x41\x77\x61\x00\x53\x6f\x6c\x61\x76\x6f\x78\x00\x53\x61\x69\x73\x68\x6f\x00\x54\x72"
+"\x69\x75\x6d\x70\x68\x00\x49\x73\x70\x00\xfe\x03\xd0\xf3\xd9\x2c\x03\x70\x4f\xed\x49\xfb\xd9\xc9\xe5\x9f\x01\xf0\x1c\x04\xe5\x21"
+"\x01\x00\xd5\xc5\xeb\x01\x10\x7f\xcd\xaa\x07\x23\x0e\x00\xcd\xaa\x07\x19\x0c\x79\xfe\x10\x20\xf6\xc1\xd1\xe1\xc9\xed\x49\x7e\xe6"
+"\x1f\xf6\x40\xed\x79\xc9\xf5\xc5\x93\x00\xf0\x07\x1f\x30\xfb\xc1\xf1\xc9\xc5\x0f\x0f\xe6\x30\x4f\x7c\x1f\xe6\x03\xb1\x01\x0c\xbc"
+"\xed\x49\x15\x02\xf0\x77\x0c\xed\x49\x04\x7c\x1f\x7d\x1f\xed\x79\xc1\xc9\x21\xf7\x07\x11\x04\xb8\x01\x15\x00\xed\xb0\x21\xf1\x07"
+"\xc3\xb4\x0a\x03\xf1\xbd\xc3\x35\x08\x0a\xa0\x5e\xa1\x5c\xa2\x7b\xa3\x23\xa6\x40\xab\x7c\xac\x7d\xad\x7e\xae\x5d\xaf\x5b\xe7\x87"
+"\x3c\x4f\x06\x00\x11\x04\xb8\xfe\x2a\xdc\xa1\xba\xc9\xc5\xe5\x21\x04\xb8\x46\x04\x05\x28\x0a\x23\xbe\x23\x20\xf8\x7e\xfe\xff\x28"
+"\x03\xcd\xf1\xbd\xe1\xc1\xc9\x01\x32\x00\xcd\x58\x08\x30\x07\x10\xf9\x0d\x20\xf6\xb7\xc9\xc5\x06\xef\xe6\x7f\xed\x79\xf6\x80\xf3"
+"\xed\x79\xe6\x7f\xfb\xed\x79\xc1\x37\xc9\xc5\x4f\xa4\x00\xe0\x17\x17\x79\xc1\xc9\xf3\x06\xf4\xed\x79\x06\xf6\xed\x78\xce\x04\xf1"
+"\x06\xe6\x3f\xed\x79\x06\xf4\xed\x49\x06\xf6\x4f\xf6\x80\xed\x79\xed\x49\xfb\xc9\x01\x0e\x10\x00\x50\xed\x78\xe6\x30\x4f\x23\x00"
+"\xf0\xff\xff\x17\xed\x49\x04\x3e\x92\xed\x79\xc5\xcb\xf1\x06\xf6\xed\x49\x06\xf4\xed\x78\x46\x77\xa0\x2f\x12\x23\x13\x0c\x79\xe6"
+"\x0f\xfe\x0a\x20\xe9\xc1\x3e\x82\xed\x79\x05\xed\x49\xc9\x21\xde\x08\x11\x00\xbb\x01\xcf\xcb\xcd\xcc\x08\x01\xef\x20\x79\x12\x13"
+"\xed\xa0\x03\x2f\x07\x07\xe6\x80\xb6\x12\x13\x23\x10\xef\xc9\x5c\x1b\x98\x1b\xbf\x1b\xc5\x1b\xfa\x1b\x46\x1c\xb3\x1c\x04\x1c\xdb"
+"\x1c\xe1\x1c\x45\x1e\x38\x1d\xe5\x1d\xd8\x1e\xc4\x1e\xdd\x1e\xc9\x1e\xe2\x1e\xce\x1e\x34\x1e\x2f\x1e\xf6\x1d\xf2\x1d\xfa\x1d\x0b"
+"\x1e\x19\x1e\x74\x10\x84\x10\x59\x14\x52\x14\xfe\x13\x35\x13\xac\x13\xa8\x13\x08\x12\x52\x12\x4f\x15\x5a\x11\x65\x11\x70\x11\x7c"
+"\x11\x86\x12\x97\x12\x76\x12\x7e\x12\xca\x11\x65\x12\x65\x12\xa6\x12\xba\x12\xab\x12\xc0\x12\xc6\x12\x7b\x13\x88\x13\xd4\x12\xf2"
+"\x12\xfe\x12\x2b\x13\xd4\x14\xe4\x10\x03\x11\xa8\x15\xd7\x15\xfe\x15\xfb\x15\x06\x16\x0e\x16\x1c\x16\xa5\x16\xea\x16\x17\x17\x2d"
+"\x17\x36\x17\x67\x17\x75\x17\x6e\x17\x7a\x17\x83\x17\x80\x17\x97\x17\x94\x17\xa9\x17\xa6\x17\x40\x19\xbf\x0a\xd0\x0a\x37\x0b\x3c"
+"\x0b\x56\x0b\xe9\x0a\x0c\x0b\x17\x0b\x5d\x0b\x6a\x0b\xaf\x0b\x05\x0c\x11\x0c\x1f\x0c\x39\x0c\x8e\x0c\xa7\x0c\xf2\x0c\x1a\x0d\xf7"
+"\x0c\x1f\x0d\xea\x0c\xee\x0c\xb9\x0d\xbd\x0d\xe5\x0d\x00\x0e\x44\x0e\xf9\x0e\x2a\x0f\x55\x0c\x74\x0c\x93\x0f\x9b\x0f\xbc\x24\xce"
+"\x24\xe1\x24\xbb\x2b\xbf\x2b\xc1\x2b\xe5\x24\x50\x25\x57\x25\xa0\x25\x18\x26\x07\x26\x03\x26\xfe\x24\x7f\x25\x99\x25\xc6\x25\x53"
+"\x26\x92\x26\xaf\x29\xa6\x29\xc1\x29\xe9\x1f\x14\x21\xce\x21\xeb\x21\xac\x21\x50\x20\x6b\x20\x95\x24\x9a\x24\xa6\x24\xab\x24\x5c"
+"\x00\x26\x03\x30\x03\xa0\x02\xb1\x02\x63\x01\x6a\x01\x70\x01\x76\x01\x7d\x01\x83\x01\xb3\x01\xc5\x01\xd2\x01\xe2\x01\x27\x02\x84"
+"\x02\x55\x02\x19\x02\x76\x02\x94\x02\x9a\x02\x8d\x02\x99\x00\xa3\x00\xed\x05\x1c\x06\xb4\x07\x76\x07\xc0\x07\x86\x07\x8c\x07\xe0"
+"\x07\x1b\x08\x58\x08\x44\x08\x63\x08\xbd\x08\x3c\x1d\xfe\x1b\x60\x14\xec\x15\xd5\x19\xb0\x17\xac\x17\x2a\x16\xd9\x19\x45\x0b\x0c"
+"\x08\x97\x03\x02\x2c\x91\x2f\x9f\x2f\xc8\x2f\xd9\x2f\x01\x30\x14\x30\x55\x30\x5f\x30\xc6\x30\xa2\x34\x59\x31\x9e\x34\x77\x35\x04"
+"\x36\x88\x31\xdf\x36\x31\x37\x27\x37\x45\x33\x73\x2f\xac\x32\xaf\x32\xb6\x31\xb1\x31\x2f\x32\x53\x33\x49\x33\xc8\x33\xd8\x33\xd1"
+"\x2f\x36\x31\x43\x31\x4e\x06\x00\xea\x08\xf0\x4a\x23\xed\xb0\xc9\x11\x52\x10\xcd\x86\x07\x3e\xc0\x32\xc6\xb7\xcd\xd0\x0a\xc3\x12"
+"\x0b\xaf\xcd\x55\x0c\x21\xdd\x0a\xcd\xb4\x0a\xc3\xd8\x0c\x09\xe5\xbd\xc3\x8a\x0c\xc3\x71\x0c\xc3\x17\x0b\xe6\x03\xfe\x03\xd0\xf5"
+"\xcd\x55\x0d\xd1\xcd\xb3\x10\xf5\xcd\xce\x15\xe5\x7a\xcd\x31\x0b\xcd\xeb\xbd\xe1\xcd\xae\x15\xf1\xcd\xd1\x10\x18\x22\x3a\xc3\xb7"
+"\xfe\x01\xc9\x3e\x01\x18\x00\xf0\x1f\x55\x0d\x21\x00\x00\xcd\x37\x0b\x2a\xc5\xb7\x2e\x00\x54\x1e\x01\x01\xff\x3f\x75\xed\xb0\xc3"
+"\x42\x0d\x32\xc3\xb7\xc3\x76\x07\x3a\xc6\xb7\x18\x03\x2a\xc4\xb7\xcd\x45\x0b\xc3\xc0\x07\xe6\x80\x00\xf0\x36\xf5\x7c\xe6\x07\x67"
+"\xcb\x85\x22\xc4\xb7\xf1\xc9\x2a\xc4\xb7\x3a\xc6\xb7\xc9\xcd\x0c\x0b\x01\x18\x13\xd8\x06\x27\xc8\x06\x4f\xc9\xd5\xcd\x0c\x0b\x06"
+"\x04\x38\x05\x06\x02\x28\x01\x05\xc5\x5c\x16\x00\x62\xd5\x54\x5d\x29\x29\x19\x29\x29\x29\x29\xd1\x19\x10\xfd\xed\x5b\xc4\xb7\x19"
+"\x44\x00\xf2\x20\x3a\xc6\xb7\x84\x67\xc1\xd1\xc9\x7b\x95\x3c\x87\x87\x87\x5f\x7a\x94\x3c\x57\xcd\x6a\x0b\xaf\x82\x10\xfd\x57\xc9"
+"\xd5\xeb\x21\xc7\x00\xb7\xed\x52\x7d\xe6\x07\x87\x87\x87\x4f\x7d\xe6\xf8\x6f\x45\x00\xf9\x0d\xd1\xc5\xcd\xf6\x0b\x78\xa3\x28\x05"
+"\xcb\x09\x3d\x20\xfb\xe3\x61\x4d\xe3\x78\x0f\xcb\x3a\xcb\x1b\x0f\x38\xf9\x19\x5a\x00\x41\x81\x67\xd1\x4a\x99\x00\xf0\x0e\xaa\x01"
+"\xd8\x01\x88\x03\xc8\x01\x80\x07\xc9\x2c\xc0\x24\x7c\xe6\x07\xc0\x7c\xd6\x08\x67\xc9\x7d\x2d\xb7\xc0\x7c\x25\x0e\x00\xf6\x05\xc6"
+"\x08\x67\xc9\x7c\xc6\x08\x67\xe6\x38\xc0\x7c\xd6\x40\x67\x7d\xc6\x50\x6f\xd0\x28\x00\x00\x2d\x00\xe6\xe6\x38\xfe\x38\xc0\x7c\xc6"
+"\x40\x67\x7d\xd6\x50\x6f\xd0\x36\x00\xf0\x17\xe6\x03\x21\x74\x0c\x28\x0c\xfe\x02\x2e\x7a\x38\x06\x2e\x7f\x28\x02\x2e\x85\x3e\xc3"
+"\x32\xc7\xb7\x22\xc8\xb7\xc9\xc3\xc7\xb7\x78\xae\xa1\xae\x77\xc9\x78\x05\x00\x40\x79\x2f\xb0\xa6\x0b\x00\xf1\x23\xb6\x77\xc9\x7e"
+"\xc3\xb2\x0c\xc5\xd5\xcd\xc8\x0c\x5f\xcd\xf6\x0b\x06\x08\xcb\x0b\x17\xcb\x09\x38\x02\xcb\x03\x10\xf5\xd1\xc1\xc9\xc5\xf5\xcd\xf6"
+"\x0b\xf1\xcd\xb2\x0c\xc1\xc9\xd5\x11\x08\x00\x0f\xcb\x12\x1d\x00\xf3\x4c\x1a\x1d\x20\xf4\x7a\xcd\xc8\x0c\xd1\xc9\x57\xcd\x0c\x0b"
+"\x7a\xd0\x0f\x0f\xce\x00\x0f\x9f\xe6\x06\xaa\xc9\x21\x52\x10\x11\xd4\xb7\x01\x22\x00\xed\xb0\xaf\x32\xf6\xb7\x21\x0a\x0a\x22\xd2"
+"\xb7\xc9\x2a\xd2\xb7\xc9\xe6\x0f\x3c\x18\x01\xaf\x5f\x78\xcd\x10\x0d\x46\x79\xcd\x10\x0d\x4e\x7b\xcd\x35\x0d\x71\xeb\x70\x3e\xff"
+"\x32\xf7\xb7\xc9\xe6\x1f\xc6\x99\x6f\xce\x0d\x95\x67\x28\x00\xf0\x29\xcd\x35\x0d\x1a\x5e\xcd\x2a\x0d\x41\x7b\x0e\x00\x21\x99\x0d"
+"\xbe\xc8\x23\x0c\x18\xfa\x5f\x16\x00\x21\xe5\xb7\x19\xeb\x21\xef\xff\x19\xc9\x21\xf9\xb7\xe5\xcd\x70\x01\xcd\x73\x0d\x11\x61\x0d"
+"\x06\x81\xe1\xc3\x63\x01\x21\xf9\xb7\x12\x00\xf0\x18\x87\x0d\xc3\x86\x07\x21\xf8\xb7\x35\x28\x0c\x2b\x7e\xb7\xc8\xcd\x87\x0d\xcd"
+"\x8c\x07\x18\x0f\xcd\x87\x0d\x32\xf8\xb7\xcd\x8c\x07\x21\xf6\xb7\x7e\x2f\x77\xaf\x77\x00\xf0\x5c\x11\xe5\xb7\x3a\xf6\xb7\xb7\x3a"
+"\xd3\xb7\xc8\x11\xd4\xb7\x3a\xd2\xb7\xc9\x14\x04\x15\x1c\x18\x1d\x0c\x05\x0d\x16\x06\x17\x1e\x00\x1f\x0e\x07\x0f\x12\x02\x13\x1a"
+"\x19\x1b\x0a\x03\x0b\x01\x08\x09\x10\x11\x4f\xcd\x9b\x0b\xe5\x7a\xcd\xee\x0e\x30\x09\x42\x71\xcd\x05\x0c\x10\xfa\x18\x10\xc5\xd5"
+"\x71\x15\x28\x08\x4a\x06\x00\x54\x5d\x13\xed\xb0\xd1\xc1\xe1\xcd\x1f\x0c\x1d\x20\xd9\xc9\x78\xa9\x4f\xcd\x6a\x0b\x16\x08\xe5\xc5"
+"\x7e\xa9\x77\x2c\x00\x11\xf8\x1b\x00\xf0\x17\x15\x20\xee\xc9\x4f\xc5\x11\xd0\xff\x06\x30\xcd\x2a\x0e\xc1\xcd\xb4\x07\x78\xb7\x20"
+"\x0d\x11\xb0\xff\xcd\x3d\x0e\x11\x00\x00\x06\x20\x18\x0b\x11\x50\x00\x0d\x00\x58\xb0\xff\x06\x20\x2a\x9f\x02\x60\x50\x1e\x08\xc3"
+"\xbd\x0d\x13\x00\xf0\x13\xc3\x37\x0b\xf5\x78\xb7\x28\x30\xe5\xcd\x9b\x0b\xe3\x2c\xcd\x6a\x0b\x4a\x7b\xd6\x08\x47\x28\x17\xd1\xcd"
+"\xb4\x07\xc5\xe5\xd5\xcd\xaa\x0e\x86\x00\x10\xeb\x05\x00\xf2\x02\xc1\x10\xee\xd5\xe1\x51\x1e\x08\xf1\x4f\xc3\xbd\x0d\xe5\xd5\xcd"
+"\x9b\x2c\x00\xf0\x00\xd1\xe3\x28\xe9\xc5\x6b\x54\x1c\xcd\x6a\x0b\xeb\xcd\x6a\x0b\x88\x00\x50\xcd\x39\x0c\xe5\xeb\x05\x00\xf0\x13"
+"\xc5\xcd\xaa\x0e\xc1\xd1\xe1\x10\xee\x18\xc6\x06\x00\xcd\xec\x0e\x38\x16\xcd\xec\x0e\x30\x25\xc5\xaf\x95\x4f\xed\xb0\xc1\x2f\x3c"
+"\x81\x4f\x88\x02\x20\x18\x14\x1b\x00\x44\x12\xc5\xaf\x93\x16\x00\xe0\x7a\xd6\x08\x57\xed\xb0\xc9\x41\x7e\x12\xcd\x05\x0c\xeb\x04"
+"\x00\xf0\x00\x10\xf4\xc9\x79\xeb\x3d\x85\xd0\x7c\xe6\x07\xee\x07\xc0\x37\x03\x03\xf0\x1f\x38\x0d\x28\x06\x01\x08\x00\xed\xb0\xc9"
+"\x01\x88\x02\x18\x03\x01\xaa\x04\x3e\x08\xf5\xe5\x6e\x60\xaf\xcb\x05\x30\x01\xb1\xcb\x09\x30\xf7\x12\x13\x10\xf2\x44\xe1\x23\xf1"
+"\x3d\x20\xe7\xc9\x43\x01\x00\xc3\x03\xf0\x01\x08\x38\x36\x28\x0b\x7e\xa9\x2f\x12\x13\xcd\x1f\x0c\x10\xf6\xc9\xe5\x00\xc2\x5a\x0f"
+"\xcd\x05\x0c\xcd\x5a\x0f\x7b\xd1\x12\x13\xea\x00\xf0\x03\xe9\xc9\x16\x88\x06\x04\x7e\xa9\xa2\x20\x01\x37\xcb\x13\xcb\x0a\x10\xf4"
+"\x29\x00\x00\x12\x00\x21\xe6\xaa\x13\x00\x41\x7e\xa9\xe6\x55\x09\x00\x00\x90\x01\x16\xe9\x39\x00\xa0\xd9\xc9\xcd\xad\x0f\xcd\xc2"
+"\x0f\x18\x06\x08\x00\xf1\x30\x16\x10\x2a\x02\xb8\x7d\x32\xa3\xb6\x7c\x32\xb3\xb6\xc9\xe5\x2a\xa3\xb6\x32\xa3\xb6\x3a\xb3\xb6\x67"
+"\x3e\xff\x32\xb3\xb6\x22\x02\xb8\xe1\xc9\x37\xcd\x3b\x10\xcb\x00\x79\x30\x13\x1d\x20\x03\x15\x28\x2c\xcb\x09\x38\x28\xcb\x78\x28"
+"\x24\xb1\xcb\x00\x18\xed\x13\x00\x91\x0d\xcb\x09\x38\x09\xcb\x78\x20\x05\x13\x00\xf0\x12\xc5\x4f\x3a\xa4\xb6\x47\x3a\xb4\xb6\xb7"
+"\x18\x07\xc5\x4f\x3a\xa3\xb6\x47\xaf\xcc\xe8\xbd\xc1\xcb\x79\xc4\x05\x0c\x7a\xb3\x20\xb5\x78\x69\x00\x11\xb7\x54\x00\x50\x3a\xa3"
+"\xb6\x38\x09\x2a\x00\xfb\x2f\x20\x09\x3a\xa4\xb6\xc5\x47\xcd\xe8\xbd\xc1\xcd\x39\x0c\x1d\x20\xe4\x15\x20\xe1\x18\xd6\xe5\x30\x02"
+"\x62\x6b\xb7\xed\x42\xcd\x39\x19\x24\x2c\xe3\xcd\xaf\x0b\x3a\xb3\xb6\x47\xd1\xc9\x04\x04\x0a\x13\x0c\x0b\x14\x15\x0d\x06\x1e\x1f"
+"\x07\x12\x19\x04\x17\x11\x00\xf0\x06\x0a\x07\xcd\x84\x10\xaf\x32\x35\xb7\x21\x01\x00\xcd\x39\x11\xc3\x9f\x10\x21\x8d\x10\xb0\x05"
+"\x80\x64\x14\x0f\xcd\xbd\xc3\x5f\x12\x03\x00\xf4\x2b\x4b\x13\xc3\xbe\x13\xc3\x0a\x14\x3e\x08\x11\xb6\xb6\x21\x26\xb7\x01\x0e\x00"
+"\xed\xb0\x3d\x20\xf5\x32\xb5\xb6\xc9\x3a\xb5\xb6\x4f\x06\x08\x78\x3d\xcd\xe4\x10\xcd\xd0\xbd\xcd\xc0\x12\x32\x30\xb7\xcd\xba\x12"
+"\x32\x2f\xb7\x10\xea\x79\xc9\x1b\x00\xf0\x1a\xc5\x2a\x2f\xb7\xcd\x39\x11\xc1\x10\xf1\x79\xe6\x07\x21\xb5\xb6\xbe\xc8\xc5\xd5\x4e"
+"\x77\x47\x79\xcd\x26\x11\xcd\x1e\x11\x78\xcd\x26\x11\xeb\xcd\x1e\x11\x79\xd1\xc1\x50\x00\xd0\xf5\x79\xcd\xe4\x10\x78\x32\xb5\xb6"
+"\xcd\x26\x11\xd5\x23\x00\x81\xe1\xcd\x1e\x11\xf1\x18\xc6\xc5\x78\x00\xf1\x35\xc1\xc9\xe6\x07\x5f\x87\x83\x87\x83\x87\xc6\xb6\x5f"
+"\xce\xb6\x93\x57\x21\x26\xb7\xc9\xeb\x3e\x83\x32\x2e\xb7\x7a\xcd\xab\x12\x7b\xcd\xa6\x12\xaf\xcd\xa8\x13\xcd\x7b\x13\x21\x00\x00"
+"\x11\x7f\x7f\xcd\x08\x12\xc3\x59\x14\x3d\x21\x2a\xb7\x86\x2a\x26\xb7\x67\x18\x0e\x3d\x21\x29\x0b\x00\xf0\x16\x6f\x18\x03\xcd\x86"
+"\x11\xcd\xd0\xbd\x22\x26\xb7\xc3\xcd\xbd\x2a\x26\xb7\xcd\x93\x11\x3a\x2d\xb7\xc9\x3a\x29\xb7\x3d\x85\x6f\x3a\x2a\xb7\x3d\x84\x67"
+"\x0d\x00\x40\x95\x2f\x3c\x3c\x0f\x00\x81\x94\x2f\x3c\x3c\x67\xc9\xcd\xd0\x2b\x00\xf0\x10\xd6\x11\x22\x26\xb7\xd8\xe5\x21\x2d\xb7"
+"\x78\x87\x3c\x86\x77\xcd\x52\x12\x3a\x30\xb7\xf5\xdc\x44\x0e\xf1\xd4\x00\x0e\xe1\xc9\x5a\x00\xf0\x05\xd6\x11\xf5\xcd\x93\x11\xf1"
+"\xc9\x3a\x2c\xb7\xbc\xf2\xe2\x11\x3a\x2a\xb7\x67\x2c\x56\x00\x90\xbc\xfa\xef\x11\x3a\x2c\xb7\x67\x2d\x69\x00\xf5\x97\xbd\xf2\x02"
+"\x12\x3a\x2b\xb7\xbd\x37\xf0\x6f\x06\xff\xb7\xc9\x3c\x6f\x06\x00\xb7\xc9\xcd\x5d\x0b\x7c\xcd\x40\x12\x67\x7a\xcd\x40\x12\x57\xbc"
+"\x30\x02\x54\x67\x7d\xcd\x49\x12\x6f\x7b\xcd\x49\x12\x5f\xbd\x30\x02\x5d\x6f\x22\x29\xb7\xed\x53\x2b\xb7\x7c\xb5\x20\x06\x7a\xa8"
+"\x20\x02\x7b\xa9\x32\x28\xb7\xc3\x73\x11\xb7\xf2\x45\x12\xaf\xb8\xd8\x78\xc9\xb7\xf2\x4e\x12\xaf\xb9\xd8\x79\xc9\x2a\x29\xb7\xed"
+"\x5b\x2b\xb7\x3a\x28\xb7\xc6\xff\xc9\x3a\x2e\xb7\xe6\x03\xc0\xc5\xd5\xe5\xcd\xa7\x11\xed\x4b\x2f\xb7\xcd\xe5\x0d\xe1\xd1\xc1\xc9"
+"\xf5\x3e\xfd\xcd\x88\x12\xf1\xc9\xf5\x3e\x02\xcd\x99\x12\xf1\xc9\x3e\xfe\xf5\xcd\xd0\xbd\xf1\xe5\x21\x2e\xb7\xa6\x77\xe1\xc3\xcd"
+"\xbd\x3e\x01\x11\x00\xc1\xb6\x77\xe1\xc9\x21\x2f\xb7\x18\x03\x21\x30\xb7\x15\x00\xf0\x00\xcd\x8e\x0c\x77\xc3\xcd\xbd\x3a\x2f\xb7"
+"\xc3\xa7\x0c\x3a\x30\x06\x00\x00\x22\x01\xf2\x1f\x2f\xb7\x7c\x65\x6f\x22\x2f\xb7\x18\xe3\xd5\x5f\xcd\x2b\x13\x30\x09\x57\x7b\x92"
+"\x3f\x30\x03\x5f\x18\x03\x21\x00\x38\xf5\x16\x00\xeb\x29\x29\x29\x19\xf1\xd1\xc9\xeb\xcd\xd4\x12\xd0\xeb\xf8\x03\xf1\x61\xe5\x7a"
+"\xb7\x16\x00\x20\x19\x15\xd5\x4b\xeb\x79\xcd\xd4\x12\x7c\xaa\x20\x04\x7d\xab\x28\x08\xc5\xcd\xf8\x12\xc1\x0c\x20\xec\xd1\xcd\x2b"
+"\x13\xed\x53\x34\xb7\xd1\xed\x53\x36\xb7\xc9\x2a\x34\xb7\x7c\x0f\x7d\x2a\x36\xb7\xc9\x47\x3a\x2e\xb7\x07\xd8\xc5\xcd\xa4\x11\x24"
+"\x22\x26\xb7\x25\xf1\xcd\xd3\xbd\xc3\xcd\xbd\xe5\xcd\xd4\x12\x11\x38\xb7\xd5\xcd\xf9\x0e\xd1\xe1\xcd\x6a\x0b\x0e\x08\xc5\xe5\xc5"
+"\xd5\xeb\x4e\xcd\x77\x13\xcd\x05\x0c\xd1\x13\xc1\x10\xf1\x1c\x04\xf0\x05\x0d\x20\xe7\xc9\x2a\x31\xb7\xe9\x21\x92\x13\xb7\x28\x03"
+"\x21\xa0\x13\x22\x31\xb7\x11\x00\xf0\x14\x11\x6e\xec\x19\x7c\xb5\xc9\x2a\x2f\xb7\x79\x2f\xa4\x47\x79\xa5\xb0\x0e\xff\x18\x03\x3a"
+"\x2f\xb7\x47\xeb\xc3\x74\x0c\x32\x33\xb7\xc9\xe5\xd5\x73\x00\x80\xcd\xd6\xbd\xf5\xcd\xcd\xbd\xf1\x14\x0c\xf0\x16\x3a\x30\xb7\x11"
+"\x38\xb7\xe5\xd5\xcd\x2a\x0f\xd1\xd5\x06\x08\x1a\x2f\x12\x13\x10\xfa\xcd\xe1\x13\xd1\xe1\x30\x01\xc0\x3a\x2f\xb7\xcd\x2a\x0f\x0e"
+"\x00\xda\x00\xf0\x09\x11\x38\xb7\x06\x08\x1a\xbe\x20\x09\x23\x13\x10\xf8\x79\xfe\x8f\x37\xc9\x0c\x20\xe7\xaf\xc9\xf5\x9a\x01\xf0"
+"\x30\xd9\xbd\xe1\xd1\xc1\xf1\xc9\x4f\x3a\x33\xb7\xb7\x79\xc2\x40\x19\x21\x58\xb7\x46\x78\xfe\x0a\x30\x31\xb7\x20\x06\x79\xfe\x20"
+"\xd2\x35\x13\x04\x70\x58\x16\x00\x19\x71\x3a\x59\xb7\x5f\x21\x63\xb7\x19\x19\x19\x7e\xe6\x0f\xb8\xd0\x3a\x2e\xb7\xa6\x07\x38\x0b"
+"\x8b\x09\xf0\x0f\x21\x59\xb7\x79\xcd\x16\x00\xaf\x32\x58\xb7\xc9\x3e\x81\xcd\x99\x12\x18\xf4\x3e\x7e\xcd\x88\x12\x18\xed\x3a\x2e"
+"\xb7\xc9\x17\x00\x80\x21\x74\x14\x11\x63\xb7\x01\x60\x6e\x05\xf1\x77\x80\x13\x15\x81\x35\x13\x80\x97\x12\x80\x86\x12\x81\xe9\x0a"
+"\x81\x40\x19\x00\x59\x14\x80\xe1\x14\x80\x19\x15\x80\x1e\x15\x80\x23\x15\x80\x28\x15\x80\x4f\x15\x80\x3f\x15\x81\xab\x12\x81\xa6"
+"\x12\x80\x5e\x15\x80\x99\x15\x80\x8f\x15\x80\x78\x15\x80\x65\x15\x80\x52\x14\x81\xec\x14\x81\x55\x0c\x80\xc6\x12\x89\x0d\x15\x84"
+"\x01\x15\x00\xeb\x14\x83\xf1\x14\x82\xfa\x14\x80\x39\x15\x82\x47\x15\x21\x63\xb7\xc9\x87\x00\x00\x5a\x00\x00\x0b\x14\x00\xdd\xe5"
+"\x21\xd8\x14\xcd\x14\x21\xdd\xe1\xc9\x0f\x9f\xc3\x7b\x13\x23\x7e\x23\x46\x23\x4e\xc3\xf2\x0c\x07\x00\xf0\x2d\xf7\x0c\x23\x56\x23"
+"\x7e\x23\x5e\x23\x6e\x67\xc3\x08\x12\x23\x7e\x23\xc3\xf2\x12\xcd\xa4\x11\xc3\xcd\xbd\x11\x00\xff\x18\x0d\x11\x00\x01\x18\x08\x11"
+"\x01\x00\x18\x03\x11\xff\x00\xd5\xcd\xa4\x11\xd1\x7d\x83\x6f\x7c\x82\x67\xc3\x76\x11\x2a\x29\xff\x02\x20\xcd\xa4\x65\x03\x90\x18"
+"\xee\x23\x56\x23\x5e\xeb\xc3\x70\xdc\x03\x51\x2a\x29\xb7\x22\x26\x03\x03\xc4\x18\x44\xcd\xa4\x11\x54\x5d\x18\x3d\xcd\x8f\x15\x16"
+"\x03\xa0\x26\xb7\x6f\x2c\xbb\xd0\x18\x11\xcd\x99\x13\x00\xb0\x3a\x2c\xb7\x57\x3a\x26\xb7\x3d\x5f\xbd\xd8\xc9\x02\x60\xb9\x0d\xcd"
+"\xa4\x11\x5d\x15\x00\x70\x18\x09\xcd\xa4\x11\xeb\x6b\xc1\x03\xf0\x3b\xcd\x89\x15\xc3\xcd\xbd\xcd\xd7\x15\x21\x01\x00\x7c\xcd\x6e"
+"\x17\x7d\xcd\x67\x17\x21\x00\x00\x54\x5d\xcd\x0e\x16\x11\x00\x80\x21\xff\x7f\xe5\xd5\xcd\xa5\x16\xe1\xd1\xc3\xea\x16\xcd\x7a\x17"
+"\x67\xcd\x75\x17\x6f\xc9\xcd\xf0\x15\x21\xe0\x15\xc3\xb4\x0a\x09\xdc\xbd\xc3\x86\x17\xc3\x9a\x17\xc3\xb4\x17\x1c\x0b\xf0\x0c\xaf"
+"\xcd\xd5\x19\x2f\xcd\xb0\x17\xc3\xac\x17\xcd\x5d\x16\xed\x53\x97\xb6\x22\x99\xb6\xc9\xed\x5b\x97\xb6\x2a\x08\x00\xf0\x2a\x53\x93"
+"\xb6\x22\x95\xb6\x11\x00\x00\x62\x6b\x18\xe2\xed\x5b\x93\xb6\x2a\x95\xb6\xc9\xcd\x06\x16\xcd\xfe\x15\xe5\xcd\x0c\x0b\xed\x44\xde"
+"\xfd\x26\x00\x6f\xcb\x7a\x28\x03\xeb\x19\xeb\x2f\xa3\x5f\x7d\x2a\x93\xb6\x19\x0f\xdc\xe5\x16\x04\x00\xf0\x27\xd1\xe5\x7a\x07\x30"
+"\x01\x13\xcb\x83\x2a\x95\xb6\x19\xd1\xc3\xe5\x16\xe5\x2a\x97\xb6\x19\xd1\xe5\x2a\x99\xb6\x19\xd1\xc9\x2a\x9b\xb6\x37\xed\x52\xf2"
+"\x7e\x16\x2a\x9d\xb6\xb7\xed\x52\x37\xf0\xf6\xff\xc9\xaf\xc9\x2a\x9f\x0d\x00\x53\xfa\x7b\x16\x2a\xa1\x1f\x00\xf1\x09\x37\xc9\xcd"
+"\x27\x16\xe5\xcd\x6a\x16\xe1\xd0\xd5\xeb\xcd\x80\x16\xeb\xd1\xc9\xe5\xcd\xd1\x16\xd1\x05\x00\xf0\x07\x7b\x95\x7a\x9c\x38\x01\xeb"
+"\x7b\xe6\xf8\x5f\x7d\xf6\x07\x6f\xcd\x0c\x0b\x3d\xfc\xe1\x16\x04\x00\xf0\x02\xed\x53\x9b\xb6\x22\x9d\xb6\xc9\x7a\xb7\x21\x00\x00"
+"\xf8\x21\x7f\x02\x2b\x00\xf1\x02\xd0\xeb\xc9\xcb\x2a\xcb\x1b\xcb\x2c\xcb\x1d\xc9\xe5\xcd\x03\x17\xd1\x05\x00\xd4\x7d\x93\x7c\x9a"
+"\x38\x01\xeb\xed\x53\x9f\xb6\x22\xa1\x32\x00\x00\x2d\x0b\x33\x21\xc7\x00\x36\x00\x71\xed\x5b\x9b\xb6\x2a\x9d\xb6\x60\x00\xf0\x1c"
+"\x27\x17\x3d\xf0\x29\x23\xeb\x29\xeb\xc9\xed\x5b\x9f\xb6\x2a\xa1\xb6\x18\xf1\xcd\x17\x17\xb7\xed\x52\x23\xcd\xe5\x16\xcd\xe5\x16"
+"\xcb\x3d\x45\xed\x5b\xa1\xb6\x2a\x9f\xb6\xe5\x15\x00\x10\x4d\x3c\x00\xf0\x08\xe1\xc5\xcd\xaf\x0b\xd1\x3a\xa4\xb6\x4f\xcd\xbd\x0d"
+"\xc3\x15\x16\xcd\x8e\x0c\x32\xa3\xb6\xc9\x07\x00\xf0\x09\xa4\xb6\xc9\x3a\xa3\xb6\x18\x03\x3a\xa4\xb6\xc3\xa7\x0c\xcd\x5d\x16\xc3"
+"\xdc\xbd\xcd\x94\x16\xd0\x41\x07\x60\xa3\xb6\x47\xc3\xe8\xbd\x14\x00\x10\xdf\x14\x00\x81\xd2\x7a\x17\xcd\xaf\x0b\xc3\xe5\x12\x00"
+"\x20\xe2\xbd\x9a\x07\x90\x32\xb2\xb6\xc9\xe5\xcd\x8b\x18\xe1\x25\x01\x20\x2a\xa5\x3d\x01\x60\x7c\x32\xad\xb6\xfc\x39\x68\x01\x12"
+"\xa7\x0f\x00\x11\xae\x0f\x00\xf0\x1d\xb7\xed\x52\x19\x9f\x32\xaf\xb6\x3a\xae\xb6\x28\x04\xeb\x3a\xad\xb6\xf5\xed\x53\xab\xb6\x44"
+"\x4d\x3a\xb2\xb6\xb7\x28\x01\x03\xed\x43\xb0\xb6\xcd\x39\x19\xe5\x19\x22\xa9\xb6\xe1\x21\x01\x40\xf1\x07\x38\x12\x5a\x00\xe0\x2a"
+"\xad\xb6\x7c\x2f\x67\x7d\x2f\x6f\x22\xad\xb6\x18\x12\x2e\x00\xf0\x40\x20\x0d\x19\xe5\x3a\xaf\xb6\x07\xdc\xda\x18\xd4\x28\x19\xe1"
+"\x7a\xb3\xca\x98\x18\xdd\xe5\x01\x00\x00\xc5\xdd\xe1\xdd\xe5\xd1\xb7\xed\x5a\xed\x5b\xab\xb6\xf2\x53\x18\x03\xdd\x19\x19\x30\xfa"
+"\xaf\x93\x5f\x9f\x92\x57\x19\x30\x05\xdd\x19\x0b\x18\xf8\xed\x5b\xa9\xb6\x19\xc5\xe5\x2a\xb0\xb6\xb7\xed\x42\x30\x06\x09\x44\x4d"
+"\x4c\x16\xf0\x12\xb0\xb6\xcd\x98\x18\xe1\xc1\x30\x08\xed\x5b\xb0\xb6\x7a\xb3\x20\xb8\xdd\xe1\xc9\xd5\xcd\x24\x16\xed\x53\xa5\xb6"
+"\x22\xa7\xb6\xd1\xc9\x70\x00\xd0\x38\x4d\x78\xb1\x28\x38\x2a\xa7\xb6\x09\x2b\x44\x4d\x0b\x02\xf0\x07\x2a\xa7\xb6\xeb\x23\x22\xa7"
+"\xb6\x38\x06\x28\x21\xed\x4b\x9f\xb6\xcd\x80\x16\x38\x05\xc0\x7d\x01\x50\xd5\xed\x5b\xa5\xb6\x34\x02\xf3\x12\x38\x05\x21\xad\xb6"
+"\xae\xf0\xdc\x16\x10\x2a\xa5\xb6\x3a\xad\xb6\x07\x23\x38\x02\x2b\x2b\x22\xa5\xb6\x37\xc9\x78\xb1\x28\x39\x2a\xa5\x4d\x00\x40\x6a"
+"\x16\x2a\xa5\x4d\x00\x10\xa5\x4d\x00\x40\x22\xed\x4b\x9d\x3e\x00\x01\x4d\x00\x60\x9b\xb6\xd5\xed\x5b\xa7\x5c\x00\xe0\xe1\x38\x05"
+"\x21\xae\xb6\xae\xf0\xeb\xdc\xc2\x0f\x2a\xa7\x49\x01\x03\x4e\x00\xc0\xa7\xb6\x37\xc9\xaf\x95\x6f\x9f\x94\x67\xc9\xdd\xf6\x05\xf0"
+"\x04\xe5\xdd\xe1\xcd\x24\x16\xcd\x97\x16\x30\x4b\xe5\xd5\x01\x07\x00\xeb\x09\xeb\x18\x09\x80\x97\x16\xd1\xe1\x30\x39\xcd\xaf\x7a"
+"\x0b\xf0\x03\xdd\x5e\x00\x37\xcb\x13\xcd\xc4\x19\xcb\x09\xdc\x05\x0c\xcb\x23\x20\xf4\x0c\x06\xb0\xdd\x23\x15\x20\xe4\xdd\xe1\xcd"
+"\x06\x16\xeb\x2c\x0e\xf0\x0b\x08\x00\x28\x04\x30\x03\x09\x09\x09\x09\xeb\xc3\xfe\x15\x06\x08\xc5\xd5\xdd\x7e\x00\x37\x8f\xe5\xd5"
+"\xf5\x5c\x00\xf0\x0a\x08\xcd\xaf\x0b\xf1\xf5\xcd\xc4\x19\xf1\xd1\xe1\x13\x87\x20\xe9\xd1\x2b\xdd\x23\xc1\x10\xdb\x18\xbf\xa8\x09"
+"\x10\x08\xa8\x09\x10\xc0\xdb\x09\xf0\x02\xc3\xe8\xbd\x32\xb4\xb6\xc9\x22\xa5\xb6\x36\x01\x1b\xed\x53\xa7\xb6\x75\x02\x22\xaa\xb6"
+"\xa1\x00\xf0\x03\xdc\x42\x1b\xd0\xe5\xcd\xe7\x1a\xe3\xcd\x15\x1b\xc1\x3e\xff\x32\xa9\xb6\x55\x06\xf2\x29\x0b\x1a\xc1\xd1\xe1\xaf"
+"\x32\xab\xb6\xcd\xde\x1a\xcd\x97\x16\xdc\x50\x1a\x38\xf5\x2a\xa5\xb6\xe7\xfe\x01\x28\x2a\x32\xab\xb6\xeb\x2a\xa7\xb6\x01\x07\x00"
+"\x09\x22\xa7\xb6\xeb\x2b\xe7\x47\x2b\xe7\x4f\x2b\xe7\x57\x2b\xe7\x5f\xd5\x07\x00\x00\x5e\x01\xf0\x26\xeb\xd1\x18\xc6\x3a\xa9\xb6"
+"\x0f\xc9\xed\x43\xac\xb6\xcd\x42\x1b\x38\x09\xcd\xf1\x1a\xd0\x22\xae\xb6\x18\x11\xe5\xcd\x15\x1b\x22\xae\xb6\xc1\x7d\x91\x7c\x98"
+"\xdc\xcb\x1a\x60\x69\xcd\xe7\x1a\x22\xb0\xb6\xed\x4b\xac\x12\x02\xf1\x20\x09\x28\x11\x30\x08\xcd\xf1\x1a\xdc\x9d\x1a\x18\x07\xe5"
+"\x60\x69\xc1\xcd\xcb\x1a\x2a\xae\xb6\xed\x4b\xb0\xb6\x37\xc9\xd5\xe5\x2a\xa7\xb6\x11\xf9\xff\x19\xd1\x30\x1c\x22\xa7\xb6\x2a\xa5"
+"\xb6\xd6\x18\x13\xd1\x0d\x18\xf1\x07\x23\x3a\xab\xb6\x77\x22\xa5\xb6\xc9\xaf\x32\xa9\xb6\xd1\xc9\xcd\xd7\x1a\xcd\x42\x1b\xd4\x4c"
+"\x00\xf1\x02\x3a\xab\xb6\x2f\x32\xab\xb6\x1b\x3a\xab\xb6\xb7\xc8\x13\x13\xc9\xaf\x2f\x02\xf0\x40\xf3\x1a\x2b\xc9\x3e\xff\xc5\xd5"
+"\xe5\xf5\xcd\x4f\x1b\xf1\x47\xcd\x34\x1b\x04\x10\x04\x30\x47\xae\x77\x38\x43\xe3\x23\xe3\xed\x52\x28\x3c\x19\xcd\x39\x0c\x18\xe7"
+"\xc5\xd5\xe5\xed\x4b\xa1\xb6\xcd\x4f\x1b\xb7\xed\x52\x28\x27\x19\xcd\x1f\x0c\xcd\x34\x1b\x28\x1e\xae\x77\xe3\x2b\xe3\x18\xeb\x3a"
+"\xa3\xb6\xae\xa1\xc8\x3a\xaa\x06\x00\x20\x37\xc9\x43\x07\x50\xaf\x0b\xcd\x34\x1b\xd9\x08\x20\xc5\xd5\xf8\x03\x00\x0d\x0b\xf1\x44"
+"\xeb\xe1\xc9\x21\x02\x1e\xcd\xf6\x1d\xaf\x32\x55\xb6\x67\x6f\x22\x31\xb6\x01\xb0\xff\x11\xd6\xb5\x21\x92\xb6\x3e\x04\xeb\x09\xeb"
+"\x72\x2b\x73\x2b\x3d\x20\xf6\x21\xef\x1e\x01\xfa\x00\xed\xb0\x06\x0a\x11\x35\xb6\x21\x3f\xb6\xaf\x12\x13\x36\xff\x23\x10\xf9\xcd"
+"\x75\x1e\xcd\xf8\x1b\x11\x90\xb5\x21\x98\x00\xcd\x0a\x1c\x21\xb3\x1b\xcd\xb4\xd6\x10\xf0\x8b\x0b\x1e\x03\xee\xbd\xc3\xb8\x1d\x03"
+"\xf4\xbd\xc3\x40\x1d\xcd\xc5\x1b\x30\xfb\xc9\xe5\x21\x2a\xb6\x7e\x36\xff\xbe\x38\x27\x2a\x28\xb6\x7c\xb7\x20\x11\xcd\xe1\x1c\x30"
+"\x1b\xfe\x80\x38\x17\xfe\xa0\x3f\x38\x12\x67\x2e\x00\xd5\xcd\xb3\x1c\x38\x02\x26\x00\x2c\x22\x28\xb6\xd1\x30\xe0\xe1\xc9\x3e\xff"
+"\x32\x2a\xb6\xc9\xcd\xc5\x1b\x38\xfb\xc9\xcd\x0a\x1c\x3f\xfb\xc9\xf3\x7d\xd6\x31\x7c\xde\x00\xd8\x19\x22\x2d\xb6\xeb\x22\x2b\xb6"
+"\x01\x30\x0a\x36\x01\x23\x71\x23\x0c\x10\xf8\xeb\x21\x3c\x1c\x0e\x0a\xed\xb0\xeb\x06\x13\xaf\x77\x23\x10\xfc\x22\x2f\xb6\x32\x29"
+"\xb6\xc9\x01\x2e\x01\x0d\x05\x52\x55\x4e\x22\x0d\x78\xcd\xc3\x1c\xd0\x09\x01\xf0\x2f\x6a\x1c\x3f\xe1\xd1\xc1\xd0\x1b\x79\x0c\x12"
+"\x13\xe7\x23\x0d\x20\xf9\x21\x29\xb6\x78\xae\x20\x01\x77\x37\xc9\x06\x00\x60\x6f\x79\x95\xc8\x30\x0f\x7d\x69\x4f\x19\xeb\x09\xcd"
+"\xa7\x1c\x28\x23\xed\xb0\x18\x1f\x4f\x19\xe5\x2a\x2f\xb6\x09\xeb\x2a\x2d\xb6\x99\x05\xf0\x13\xe1\xd8\xcd\xa7\x1c\x2a\x2f\xb6\x28"
+"\x06\xd5\x1b\x2b\xed\xb8\xd1\xed\x53\x2f\xb6\xb7\xc9\x3a\x2f\xb6\x95\x4f\x3a\x30\xb6\x9c\x47\xb1\xc9\x6c\x00\xf0\x05\xbd\xc8\x3f"
+"\xd0\xe5\x26\x00\x19\x7e\xe1\x37\xc9\xe6\x7f\xfe\x20\xd0\xe5\x2a\x2b\xb7\x06\xc0\x3c\x19\x5e\x23\x3d\x20\xfa\x7b\xeb\xe1\x37\xc9"
+"\x05\x01\xf0\x54\xfb\xc9\xe5\xc5\xcd\x9d\x1e\x30\x3a\x79\xfe\xef\x28\x34\xe6\x0f\x87\x87\x87\x3d\x3c\xcb\x08\x30\xfb\xcd\x25\x1d"
+"\x21\x32\xb6\xcb\x7e\x28\x0a\xfe\x61\x38\x06\xfe\x7b\x30\x02\xc6\xe0\xfe\xff\x28\xd3\xfe\xfe\x21\x31\xb6\x28\x05\xfe\xfd\x23\x20"
+"\x05\x7e\x2f\x77\x18\xc2\x37\xc1\xe1\xc9\xcb\x11\xda\xce\x1e\x47\x3a\x31\xb6\xb1\xe6\x40\x78\xc2\xc9\x1e\xc3\xc4\x1e\x2a\x31\xb6"
+"\xc9\x22\x31\xb6\xc9\x11\x49\xb6\x01\xf6\x0e\xcd\x83\x08\x3a\x4b\xb6\xe6\xa0\x4f\x21\x37\xb6\xb6\x77\x21\x49\xb6\x11\x35\xb6\x06"
+"\x00\x1a\xae\xa6\xc4\xd1\x1d\x7e\xba\x14\xf0\xa3\xee\x79\xe6\xa0\xcb\x71\x4f\xc4\xee\xbd\x78\xb7\xc0\x21\x53\xb6\x35\xc0\x2a\x54"
+"\xb6\xeb\x42\x16\x00\x21\x35\xb6\x19\x7e\x2a\x91\xb6\x19\xa6\xa0\xc8\x21\x53\xb6\x34\x3a\x8a\xb6\xb7\xc0\x79\xb3\x4f\x3a\x33\xb6"
+"\x32\x53\xb6\xcd\x86\x1e\x79\xe6\x0f\x6f\x60\x22\x54\xb6\xfe\x08\xc0\xcb\x60\xc0\xcb\xf1\xc9\x21\x3d\xb6\xcb\x56\xc8\x79\xee\xa0"
+"\x20\x56\xc5\x23\x06\x0a\x8e\x2b\x10\xfc\xc1\xfe\xa4\x20\x49\xc7\xe5\xd5\x5f\x2f\x3c\xa3\x47\x3a\x34\xb6\xcd\xa1\x1d\x78\xab\x20"
+"\xf1\xd1\xe1\xc9\x3a\x3b\xb6\xe6\x7f\x6f\x3a\x3e\xb6\xe6\x7f\x67\xc9\x2a\x33\xb6\xc9\x22\x33\xb6\xc9\xcd\x0b\x1e\x21\x57\xb6\x06"
+"\x40\xcd\xd2\x01\x3e\xff\x32\x56\xb6\xc9\xc5\xd5\x21\x56\xb6\x36\x00\x23\xcd\x84\x02\xd1\xc1\xc9\x21\x56\xb6\x7e\x36\x00\x36\x0d"
+"\x00\x80\x1c\xf0\x12\x0e\xef\xcd\x86\x1e\xd1\xc1\xc9\x2a\x91\xb6\x18\x1c\xfe\x50\xd0\x2a\x91\xb6\xcd\x55\x1e\x2f\x4f\x7e\xa8\xa1"
+"\xa8\x77\xc9\xf5\x3a\x37\xfd\x00\x30\xf1\x21\x35\x16\x00\xf4\x3d\xa6\xc9\xd5\xf5\xe6\xf8\x0f\x0f\x0f\x5f\x16\x00\x19\xf1\xe5\x21"
+"\x6d\x1e\xe6\x07\x5f\x19\x7e\xe1\xd1\xc9\x01\x02\x04\x08\x10\x20\x40\x80\xf3\x21\x86\xb6\x36\x15\x23\xaf\x77\x23\x36\x01\x23\x77"
+"\x23\x77\xc9\x21\x86\xb6\xb7\x35\x28\x0e\xcd\xb4\x1e\x71\x23\x70\x21\x8a\xb6\x34\x21\x88\xb6\x37\x34\xc9\x21\x88\x17\x00\x90\x4e"
+"\x23\x46\x21\x8a\xb6\x35\x21\x86\x17\x00\xfa\x14\x23\x34\x7e\xfe\x14\x20\x02\xaf\x77\x87\xc6\x5e\x6f\x26\xb6\xc9\x2a\x8b\xb6\x18"
+"\x08\x2a\x8d\xb6\x18\x03\x2a\x8f\xb6\x85\x6f\x8c\x95\x67\x7e\x14\x00\x31\xfe\x50\xd0\x17\x00\xf1\x46\x70\xc9\xf0\xf3\xf1\x89\x86"
+"\x83\x8b\x8a\xf2\xe0\x87\x88\x85\x81\x82\x80\x10\x5b\x0d\x5d\x84\xff\x5c\xff\x5e\x2d\x40\x70\x3b\x3a\x2f\x2e\x30\x39\x6f\x69\x6c"
+"\x6b\x6d\x2c\x38\x37\x75\x79\x68\x6a\x6e\x20\x36\x35\x72\x74\x67\x66\x62\x76\x34\x33\x65\x77\x73\x64\x63\x78\x31\x32\xfc\x71\x09"
+"\x61\xfd\x7a\x0b\x0a\x08\x09\x58\x5a\xff\x7f\xf4\xf7\xf5\x50\x00\x14\xf6\x50\x00\xf4\x28\x7b\x0d\x7d\x84\xff\x60\xff\xa3\x3d\x7c"
+"\x50\x2b\x2a\x3f\x3e\x5f\x29\x4f\x49\x4c\x4b\x4d\x3c\x28\x27\x55\x59\x48\x4a\x4e\x20\x26\x25\x52\x54\x47\x46\x42\x56\x24\x23\x45"
+"\x57\x53\x44\x43\x58\x21\x22\xfc\x51\x09\x41\xfd\x5a\x50\x00\x94\xf8\xfb\xf9\x89\x86\x83\x8c\x8a\xfa\x50\x00\xf0\x28\x1b\x0d\x1d"
+"\x84\xff\x1c\xff\x1e\xff\x00\x10\xff\xff\xff\xff\x1f\xff\x0f\x09\x0c\x0b\x0d\xff\xff\xff\x15\x19\x08\x0a\x0e\xff\xff\xff\x12\x14"
+"\x07\x06\x02\x16\xff\xff\x05\x17\x13\x04\x03\x18\xff\x7e\xfc\x11\xe1\x01\xfe\x1a\x2c\x00\x71\xff\xff\xff\x7f\x07\x03\x4b\x0b\x00"
+"\x71\xab\x8f\x21\xed\xb1\x06\x04\x85\x1f\x50\x11\x8b\x20\x06\x81\xf6\x01\xf0\x67\x3f\x32\xb5\xb2\x21\xf8\xb1\x01\x3d\x00\x11\x08"
+"\x01\xaf\x77\x23\x72\x23\x73\x09\x3c\xeb\x29\xeb\xfe\x03\x20\xf2\x0e\x07\xdd\xe5\xe5\x21\xf0\xb1\x34\xe5\xdd\x21\xb9\xb1\x79\xcd"
+"\x09\x22\xf5\xc5\xcd\x86\x22\xcd\xe7\x23\xdd\xe5\xd1\x13\x13\x13\x6b\x62\x13\x01\x3b\x00\x36\x00\xed\xb0\xdd\x36\x1c\x04\xc1\xf1"
+"\x20\xdd\xe1\x35\xe1\xdd\xe1\xc9\x21\xee\xb1\xf3\x7e\x36\x00\xfb\xb7\xc8\x2b\x77\x2e\x03\x0e\x00\x3e\x07\x85\xcd\x63\x08\x2d\x20"
+"\xf7\x37\xc9\x11\xed\xb1\x1a\xb7\xc8\xd5\x50\x00\x00\x4f\x00\xf0\x0b\xdd\x7e\x0f\xdc\xde\x23\xf1\x20\xf3\xe3\x7e\x36\x00\x23\x77"
+"\xe1\xc9\xdd\xe5\x3a\xee\xb1\xb7\x28\x3d\xf5\x22\x00\xf0\x17\x01\x3f\x00\xdd\x09\xcb\x3f\x30\xfa\xf5\xdd\x7e\x04\x1f\xdc\x1f\x24"
+"\xdd\x7e\x07\x1f\xdc\x1f\x23\xdc\x13\x22\xf1\x20\xe2\xc1\x3a\xee\xb1\x2f\xa0\x28\x12\x2a\x00\xf2\x03\x11\x3f\x00\xdd\x19\xcb\x3f"
+"\xf5\xdc\xe7\x23\xf1\x20\xf5\xaf\x32\xf0\xb1\x87\x00\xf3\x39\x7e\xb7\xc8\x23\x35\xc0\x47\x34\x23\x7e\xb7\xc0\x2b\x36\x03\x21\xbe"
+"\xb1\x11\x3f\x00\xaf\x19\xcb\x38\x30\xfb\x35\x20\x05\x2b\xcb\x06\x8a\x23\x23\x35\x20\x05\x23\xcb\x06\x8a\x2b\x2b\x04\x10\xe6\xb7"
+"\xc8\x21\xf0\xb1\x77\x23\xc3\xe2\x01\xcd\x6b\x20\x7e\xe6\x07\x37\xc8\x4f\xb6\xfc\x1a\x20\x41\x64\x00\x20\xaf\xdd\x3b\x00\xf1\x08"
+"\xfa\xdd\x72\x1e\xdd\xbe\x1c\x3f\x9f\x04\x10\xef\xb7\xc0\x41\x7e\x1f\x1f\x1f\xb0\xe6\x0f\x4f\x2a\x01\x23\xe3\x23\x2b\x00\x02\x2a"
+"\x00\xf0\x30\xe5\xc5\xdd\x7e\x1b\xdd\x34\x1b\xdd\x35\x1c\xeb\xcd\x9c\x21\xe5\xeb\xdd\x7e\x01\x2f\xa1\x12\x13\x7e\x23\x87\x87\x87"
+"\x87\x47\x7e\x23\xe6\x0f\xb0\x12\x13\x01\x06\x00\xed\xb0\xe1\xdd\x7e\x1a\xdd\x34\x1a\xdd\xb6\x03\xcc\x1f\x22\xc1\xe1\x04\x10\xba"
+"\xe3\x35\xd9\x04\x91\x03\x87\x87\x87\xc6\x1f\xdd\xe5\xe1\xbe\x02\x80\xc9\x6f\xcd\x6b\x20\x7d\xe6\x07\xa8\x00\x02\x97\x01\x01\x47"
+"\x01\xc0\xcb\x03\x5e\xc4\x19\x22\xf1\x20\xf2\xe1\x35\xc9\x1d\x00\x10\xbc\xe8\x00\xe0\x19\x1f\x30\xfc\xf3\x7e\x87\x87\x87\x11\x19"
+"\x00\x19\xb6\x12\x20\x10\xfb\x1d\x00\xf3\x0c\xeb\x21\xd5\xb1\x01\x3f\x00\x09\x1f\x30\xfc\xaf\xf3\xbe\x20\x01\x7a\x23\x73\x23\x77"
+"\xfb\xc8\xeb\xc3\xe2\x01\x47\x01\xf0\x2f\xd8\x18\xf9\xdd\x7e\x1a\xb7\x28\x6d\xdd\x7e\x19\xcd\x9c\x21\x7e\xb7\x28\x0d\xcb\x5f\x20"
+"\x59\xe5\x36\x00\xcd\x90\x22\xe1\x30\x56\xdd\x36\x03\x10\x23\x7e\xe6\xf0\xf5\xae\x5f\x23\x4e\x23\x56\x23\xb2\xb1\x28\x08\xe5\xcd"
+"\x08\x24\xdd\x56\x01\xe1\x4e\x23\xfb\x20\xf0\x25\x66\x6f\xf1\xcd\xde\x22\x21\xee\xb1\xdd\x46\x01\x7e\xb0\x77\xa8\x20\x03\x23\x36"
+"\x03\xdd\x34\x19\xdd\x35\x1a\xdd\x34\x1c\xdd\x7e\x1e\xdd\x36\x1e\x00\xb7\xc8\x67\xdd\x6e\x1d\xc3\xe2\x01\xcb\x9e\xdd\x36\x03\x08"
+"\x2e\x00\xf0\x1f\x7e\x01\x2f\xa6\x77\xc9\xdd\xe5\x47\xdd\x4e\x01\xdd\x21\xf8\xb1\xcb\x47\x20\x0c\xdd\x21\x37\xb2\xcb\x4f\x20\x04"
+"\xdd\x21\x76\xb2\xdd\x7e\x03\xa1\x28\x27\x78\xdd\xbe\x01\x28\x19\xdd\xe5\x12\x00\x20\xcb\x57\x1a\x00\x12\x37\x1a\x00\x61\x0c\xcd"
+"\x19\x22\xdd\xe1\x05\x00\xf0\xba\x37\xc9\xe1\xdd\xe1\xdd\x70\x03\xb7\xc9\xcb\xfb\xdd\x73\x0f\x5f\x7d\xb4\x20\x01\x2b\xdd\x75\x08"
+"\xdd\x74\x09\x79\xb7\x28\x08\x3e\x06\xcd\x63\x08\xdd\x7e\x02\xb2\xcd\xe8\x23\x7b\xb7\x28\x0a\x21\xa6\xb2\x16\x00\x19\x7e\xb7\x20"
+"\x03\x21\x1b\x23\xdd\x75\x0a\xdd\x74\x0b\xcd\xcd\x23\x18\x0d\x01\x01\x00\xc8\xdd\x6e\x0d\xdd\x66\x0e\xdd\x5e\x10\x7b\xfe\xff\x28"
+"\x75\x87\x7e\x23\x38\x49\x28\x0c\x1d\xdd\x4e\x0f\xb7\x20\x04\xcb\x79\x28\x06\x81\xe6\x0f\xcd\xdb\x23\x4e\xdd\x7e\x09\x47\x87\x38"
+"\x1b\xaf\x91\xdd\x86\x08\x38\x0c\x05\xf2\x5d\x23\xdd\x4e\x08\xaf\x47\xdd\x70\x09\xdd\x77\x08\xb0\x20\x02\x1e\xff\x7b\xb7\xcc\xae"
+"\x23\xdd\x73\x10\xf3\xdd\x71\x06\xdd\x36\x07\x80\xfb\xb7\xc9\x57\x4b\x3e\x0d\xcd\x63\x08\x4a\x3e\x0b\xcd\x63\x08\x4e\x3e\x0c\xcd"
+"\x63\x08\x3e\x10\xcd\xdb\x23\xcd\xae\x23\x7b\x3c\x20\x8e\x21\x1b\x23\x87\x00\xf0\x36\x86\xaf\xdd\x77\x03\xdd\x77\x07\xdd\x77\x04"
+"\x37\xc9\xdd\x35\x0c\x20\x1e\xdd\x7e\x09\x87\x21\x1b\x23\x30\x11\xdd\x34\x08\x20\x06\xdd\x34\x09\x1e\xff\xc8\xdd\x6e\x0a\xdd\x66"
+"\x0b\x7e\xdd\x77\x0c\x23\x5e\x23\xdd\x75\x0d\xdd\x74\x0e\xc9\xdd\x77\x0f\x4f\xdd\x7e\x00\xc6\x08\xc3\x63\x8c\x00\xf0\x70\x7e\x01"
+"\xdd\xb6\x02\x21\xb5\xb2\xf3\xb6\xa8\xbe\x77\xfb\x20\x03\x78\xb7\xc0\xaf\xcd\xde\x23\xf3\x4e\x3e\x07\xc3\x63\x08\xcd\x81\x24\x7b"
+"\xcd\xab\x24\xd0\x7e\xe6\x7f\xc8\xdd\x75\x11\xdd\x74\x12\xcd\x70\x24\x18\x09\xdd\x6e\x14\xdd\x66\x15\xdd\x5e\x18\x4e\x23\x7b\xd6"
+"\xf0\x38\x04\x1e\x00\x18\x0e\x1d\x79\x87\x9f\x57\xdd\x7e\x16\x81\x4f\xdd\x7e\x17\x8a\x57\xcd\x81\x24\x4e\x7b\xb7\x20\x19\xdd\x7e"
+"\x13\x3d\x20\x10\xdd\x6e\x11\xdd\x66\x12\x7e\xc6\x80\x38\x05\xdd\x36\x04\x00\xc9\xcd\x70\x24\xdd\x73\x18\xf3\xdd\x71\x0f\x00\x61"
+"\x80\xfb\xc9\xdd\x77\x13\xa2\x00\xf0\x20\x14\xdd\x74\x15\x7b\xb7\xc0\x1c\xc9\xdd\x7e\x00\x87\xf5\xdd\x71\x16\xcd\x63\x08\xf1\x3c"
+"\x4a\xdd\x71\x17\xc3\x63\x08\x11\xa6\xb2\x18\x03\x11\x96\xb3\xeb\xcd\xae\x24\xeb\xd0\xed\xb0\xc9\x21\x11\x00\xf1\x13\x21\x96\xb3"
+"\xb7\xc8\xfe\x10\xd0\x01\x10\x00\x09\x3d\x20\xfc\x37\xc9\xcd\x57\x25\xcd\x99\x25\xaf\xcd\xe1\x24\xcd\xbf\x2b\x21\x4d\x01\x3e\x4c"
+"\x19\xf0\x1b\x29\x29\x0f\x0f\xe6\x3f\x6f\x22\xe9\xb1\x3a\xe7\xb1\x37\xc9\x32\x18\xb1\xc9\xdd\x21\x1a\xb1\xcd\x02\x25\xe5\xdc\xac"
+"\x26\xe1\xd0\xed\x5b\x34\xb1\xed\x4b\x37\xb1\x3a\x31\x19\x00\xd1\x5f\xb1\xdd\x7e\x00\xb7\x3e\x0e\xc0\xdd\xe5\xe3\x34\x5e\x0a\x00"
+"\x5d\x0a\xf0\x4b\xeb\xe1\xd5\x0e\x40\xaf\x12\x13\x0d\x20\xfb\xd1\xd5\x78\xfe\x10\x38\x02\x06\x10\x04\x48\x18\x07\xe7\x23\xcd\x26"
+"\x29\x12\x13\x10\xf7\x0d\x28\x09\x1b\x1a\xee\x20\x20\x03\x12\x18\xf4\xe1\xdd\x34\x15\xdd\x36\x17\x16\xdd\x35\x1c\x37\xc9\x3a\x1a"
+"\xb1\xb7\x3e\x0e\xc8\x21\x1a\xb1\x06\x01\x7e\x36\x00\xc5\xcd\x6d\x25\xf1\x21\xe4\xb1\xae\x37\xc0\x77\x9f\xc9\xfe\x04\xd8\x2e\x11"
+"\xf0\x0c\x6b\x62\x13\x36\x00\x01\xff\x07\xc3\xa1\xba\x3a\x5f\xb1\xfe\x03\x28\x13\xc6\xff\x3e\x0e\xd0\x21\x75\xb1\x35\x75\x23\xf0"
+"\x28\xb6\x37\xc4\x86\x27\xd0\x21\x5f\xb1\x06\x02\x18\xbc\xe5\xd5\xc5\x06\x05\xcd\xf6\x25\x20\x1a\x2a\x32\xb1\x7c\xb5\x37\xcc\xac"
+"\x26\x30\x0f\x2a\x32\xb1\x2b\x22\x32\xb1\x2a\x1d\xb1\xe7\x23\x22\x1d\xb1\x18\x2c\xe5\xd5\xc5\x4f\x31\x00\xf0\x15\x05\xcd\xf9\x25"
+"\x20\x1e\x2a\x77\xb1\x11\x00\x08\xed\x52\xc5\xd4\x86\x27\xc1\x30\x0f\x2a\x77\xb1\x23\x22\x77\xb1\x2a\x62\xb1\x71\x23\x22\x62\xb1"
+"\x38\x12\xf2\x07\x21\x1a\xb1\x7e\xb8\xc8\xee\x01\x3e\x0e\xc0\x70\xc9\xcd\xa0\x25\xd0\xe5\x2a\x32\xb1\x23\x53\x00\xf0\x22\x2b\x22"
+"\x1d\xb1\xe1\xc9\xeb\x06\x02\xcd\xf6\x25\xc0\xed\x53\x34\xb1\xcd\x3c\x26\x2a\x34\xb1\xed\x5b\x32\xb1\x19\x22\x34\xb1\xcd\xac\x26"
+"\x38\xf0\xc8\x2a\xbe\xb1\x37\xc9\x2a\x1b\xb1\xed\x4b\x32\xb1\x33\x0f\xd2\xda\xa1\xba\x09\x2b\xeb\x09\x2b\xeb\xc3\xa7\xba\xe5\x8c"
+"\x00\x10\x02\x8c\x00\xf0\x24\x2d\x79\xc1\xe1\x32\x76\xb1\xed\x53\x7c\xb1\xed\x43\x7e\xb1\x22\x60\xb1\xed\x53\x77\xb1\x21\xff\xf7"
+"\x19\x3f\xd8\x21\x00\x08\x22\x77\xb1\xeb\xed\x52\xe5\x2a\x60\xb1\x19\xe5\xcd\x86\x27\xe1\xd1\xd0\x18\xdc\x9c\x00\x00\x91\x01\x61"
+"\x36\x04\xed\x53\x1b\xb1\xde\x01\xf0\x33\xb3\x26\x38\xfb\xc3\x57\x25\x3a\x30\xb1\xb7\x3e\x0f\xc0\x01\x01\x83\xcd\xe5\x27\x30\x5f"
+"\x21\xa4\xb1\x11\x40\x00\x3e\x2c\xcd\xa6\x29\x30\x52\x06\x8b\xcd\x2f\x29\x28\x07\xcd\x37\x27\x20\x53\x06\x89\xcd\x04\x28\xed\x5b"
+"\xb7\xb1\x2a\x34\xb1\x3a\x1a\xb1\xfe\x02\x28\x0e\x72\x00\xc0\x3e\x04\x38\x2b\x2a\x1b\xb1\x22\x1d\xb1\x3e\x16\x34\x00\xf0\x41\x1e"
+"\x21\x2f\xb1\x34\x3a\xb5\xb1\x23\x77\xaf\x32\x36\xb1\x2a\xb7\xb1\x22\x32\xb1\xcd\x2f\x29\x3e\x8c\xcc\x7e\x28\x37\x18\x65\xb7\x21"
+"\x1a\xb1\x28\x58\x06\x85\xcd\x85\x28\x18\x94\xf5\x06\x88\xcd\x04\x28\xf1\x30\x8b\x06\x87\xcd\x83\x28\x18\x84\x3a\x36\xb1\xb7\x28"
+"\x1b\x3a\xbb\xb1\x2f\xb7\xc0\x3a\x1f\xb1\xb7\xc4\x60\x27\xc0\x90\x00\x40\x1f\xb1\x01\x40\x73\x1a\xf0\x23\xc9\xcd\x60\x27\xc0\xeb"
+"\x1a\xbe\xc9\x21\x1f\xb1\x11\xa4\xb1\x06\x10\x1a\xcd\x26\x29\x4f\x7e\xcd\x26\x29\xa9\xc0\x23\x13\x10\xf1\xc9\x7e\x36\x03\xcd\x6d"
+"\x25\xb7\x9f\xf5\xcd\xbf\x2b\xf1\xc9\x01\x02\x84\xd3\x00\xf3\x0e\x4a\x06\x8a\x11\x64\xb1\xcd\x07\x28\x21\x7b\xb1\xcd\xfa\x27\x30"
+"\x3a\x2a\x60\xb1\x22\x62\xb1\x22\x79\xb1\xe5\x21\x64\xed\x00\x80\xaf\x29\xe1\x30\x22\xed\x5b\x77\xc5\x00\xa0\xaf\x29\x21\x75\xb1"
+"\xdc\xfa\x27\x30\x11\x54\x0f\xf0\x06\x77\xb1\x21\x74\xb1\x34\xaf\x32\x7b\xb1\x37\x18\xa7\xb7\x21\x5f\xb1\x28\x9a\x06\x86\xbe\x00"
+"\xf0\x48\xb9\x21\xe4\xb1\x79\xbe\x71\x37\xe5\xc5\xc4\xd2\x28\xc1\xe1\x9f\xd0\xcd\xbb\x2b\x9f\xc9\x7e\xb7\x37\xc8\x01\x2c\x01\xc3"
+"\xe2\x2b\x11\xa4\xb1\x3a\x18\xb1\xb7\xc0\x32\x19\xb1\xcd\xf3\x28\xcd\x98\x28\x1a\xb7\x20\x0a\x3e\x8e\xcd\x99\x28\x01\x10\x00\x18"
+"\x2e\xcd\x2f\x29\x01\x00\x10\x28\x0d\x6b\x62\x7e\xb7\x28\x04\x0c\x23\x10\xf8\x78\x41\x4f\xcd\xfd\x28\xd3\x00\xf1\x0d\xb7\x20\x02"
+"\x3e\x20\xc5\xd5\xcd\x35\x13\xd1\xc1\x13\x10\xed\xcd\xce\x28\xeb\x09\xeb\x3e\x8d\xcd\x99\x28\x06\x02\x23\x00\xf0\x32\x14\x29\xcd"
+"\xce\x28\x13\xcd\x2f\x29\x20\x0b\x13\x1a\xe6\x0f\xc6\x24\xcd\xf0\x28\x18\x58\x1a\x21\x19\xb1\xb6\xc8\x18\x6d\xcd\x99\x28\x18\x68"
+"\x3e\xff\xf5\xcd\x91\x28\xf1\xc6\x60\xd4\xf0\x28\x18\x5a\xcd\x7c\x11\x25\xc4\xeb\x28\x78\xe5\xe6\x7f\x47\x21\x35\x29\x28\xa6\x21"
+"\x00\x72\x21\xf0\x1a\x7e\xb7\x28\x05\xcd\xb5\x28\x18\xf7\xe1\x23\xc9\xfa\x99\x28\xe5\x06\x00\x04\x7e\x23\x07\x30\xfa\xcd\xfd\x28"
+"\xe1\x7e\x23\xe6\x7f\xcd\xf0\x28\x10\xf7\x3e\x20\x18\x1e\xcb\x00\xf0\x49\x37\xc0\xcd\x91\x28\xcd\xfe\x1b\xcd\x76\x12\xcd\xdb\x1c"
+"\xcd\x7e\x12\xfe\xfc\xc8\x37\xcd\xf3\x28\x3e\x0a\xc3\xfe\x13\xf5\xe5\x3e\x01\xcd\x5a\x11\xe1\xf1\xc9\xd5\xcd\x52\x12\x5c\xcd\x7c"
+"\x11\x7c\x3d\x83\x80\x3d\xba\xd1\xd8\x3e\xff\x32\x19\xb1\x18\xd7\x06\xff\x04\xd6\x0a\x30\xfb\xc6\x3a\xf5\x78\xb7\xc4\x14\x29\xf1"
+"\x18\xca\xfe\x61\xd8\xfe\x7b\xd0\xc6\xe0\xdf\x03\xf0\x47\xfe\x04\xc9\x50\x72\x65\x73\xf3\x00\x50\x4c\x41\xd9\x74\x68\x65\xee\x61"
+"\x6e\xf9\x6b\x65\x79\xba\x00\x65\x72\x72\x6f\xf2\x00\x80\x81\x00\x80\x52\x45\xc3\x61\x6e\xe4\x81\x00\x52\x65\x61\xe4\x82\x00\x57"
+"\x72\x69\x74\xe5\x82\x00\x52\x65\x77\x69\x6e\xe4\x74\x61\x70\xe5\x00\x46\x6f\x75\x6e\x64\x20\xa0\x00\x4c\x6f\x61\x64\x69\x6e\xe7"
+"\x00\x53\x61\x76\x07\x00\xf0\x14\x00\x4f\xeb\x00\x62\x6c\x6f\x63\xeb\x00\x55\x6e\x6e\x61\x6d\x65\xe4\x66\x69\x6c\x65\x20\x20\x20"
+"\xa0\x00\xcd\xe3\x29\xf5\x21\x28\x2a\x18\x19\x09\x00\xe0\xcd\xd4\x2a\x21\x67\x2a\xdc\x0d\x2a\xdc\xe9\x2a\x18\x0f\x12\x00\xd2\x21"
+"\x37\x2a\xe5\xcd\x89\x2a\xe1\xdc\x0d\x2a\xd1\xf5\x40\x24\xf1\x0d\x10\xf6\xed\x49\xfb\x7a\xcd\xc1\x2b\xf1\xc9\x32\xe5\xb1\x1b\x1c"
+"\xe5\xd5\xcd\xe9\x1f\xd1\xdd\xe1\xcd\xbb\x2b\xf3\x71\x21\xb0\x01\xd0\xf6\xed\x49\x0e\x10\xed\x49\x01\x92\x70\x24\xf0\x20\x58\xf6"
+"\xed\x49\xc9\x7a\xb7\x28\x0d\xe5\xd5\x1e\x00\xcd\x1e\x2a\xd1\xe1\xd0\x15\x20\xf3\x01\xff\xff\xed\x43\xeb\xb1\x16\x01\xe9\xcd\x20"
+"\x2b\xd0\xdd\x77\x00\xdd\x23\x15\x1d\x20\xf3\x18\x12\x0f\x00\x81\x47\xcd\xd7\xba\xa8\x3e\x03\xc0\x14\x00\x40\xee\x15\x28\x06\x15"
+"\x00\x50\x18\xf7\xcd\x16\x2b\x09\x00\x30\xaa\x20\x07\x07\x00\xe1\xab\x37\xc8\x3e\x02\xb7\xc9\xcd\xd7\xba\xcd\x68\x2b\xd0\x2b\x00"
+"\x50\xf3\x15\x28\x07\xaf\x0e\x00\x20\x18\xf6\x2c\x00\xf0\x08\x68\x2b\xd0\x7b\xc3\x68\x2b\xd5\xcd\x93\x2a\xd1\xd8\xb7\xc8\x18\xf6"
+"\x2e\x55\xcd\x3d\x2b\xd0\x84\x14\x00\x08\x00\xf0\x02\xeb\x06\x00\x09\xeb\x25\x20\xf4\x61\x79\x92\x4f\x9f\x47\xeb\x09\xeb\x15\x00"
+"\xf0\x04\x7a\xcb\x3f\xcb\x3f\x8a\x94\x38\xea\x91\x38\xe7\x7a\x1f\x8a\x67\x22\xe6\xb1\x6d\x00\x40\x21\xe5\xb1\xae\xdb\x1b\xf0\x08"
+"\xf9\x2b\x21\x01\x08\xcd\xec\x2a\xd0\xb7\xcd\x78\x2b\xd0\x3a\xe5\xb1\xc3\x68\x2b\x21\x21\x00\x4b\x22\xf0\x16\xe6\x04\xc8\xe5\x37"
+"\xcd\x78\x2b\xe1\x2b\x7c\xb5\x20\xee\x37\xc9\x2a\xeb\xb1\xac\xf2\x10\x2b\x7c\xee\x08\x67\x7d\xee\x10\x6f\x37\xed\x6a\x22\xeb\xb1"
+"\x16\x00\xf3\x15\x7d\x2f\x5f\x7c\x2f\x57\xc9\xd5\x1e\x08\x2a\xe6\xb1\xcd\x44\x2b\xdc\x4d\x2b\x30\x0d\x7c\x91\x9f\xcb\x12\xcd\x00"
+"\x2b\x1d\x20\xea\x7a\x37\xd1\xc9\x51\x00\xf0\x14\xed\x5f\xc6\x03\x0f\x0f\xe6\x1f\x4f\x06\xf5\x79\xc6\x02\x4f\x38\x0e\xed\x78\xad"
+"\xe6\x80\x20\xf3\xaf\xed\x4f\xcb\x0d\x37\xc9\xaf\xed\x4f\x3c\x48\x00\xf0\x76\x57\xcb\x02\xcd\x78\x2b\x30\x03\x1d\x20\xf6\xd1\xc9"
+"\xed\x4b\xe8\xb1\x2a\xea\xb1\x9f\x67\x28\x07\x7d\x87\x80\x6f\x79\x90\x4f\x7d\x32\xe8\xb1\x2e\x0a\xcd\xa7\x2b\x38\x06\x91\x30\x0c"
+"\x2f\x3c\x4f\x7c\xcd\x00\x2b\x2e\x0b\xcd\xa7\x2b\x3e\x01\xc9\xed\x5f\xcb\x3f\x91\x30\x03\x3c\x20\xfd\x06\xf7\xed\x69\xf5\xaf\xed"
+"\x4f\xf1\xc9\x3e\x10\x18\x02\x3e\xef\xc5\x06\xf6\xed\x48\x04\xe6\x10\x3e\x08\x28\x01\x3c\xed\x79\x37\x28\x0c\x79\xe6\x10\xc5\x01"
+"\xc8\x00\x37\xcc\xe2\x2b\xc1\x79\xc1\xc9\xc5\xe5\xcd\xf9\x2b\x3e\x42\xcd\x45\x1e\xe1\xc1\x20\x07\x56\x2a\x80\xed\x37\xc9\xaf\xc9"
+"\x01\x82\x06\x0c\x00\x11\xfb\xc0\x10\xf0\x0a\xf2\x2d\x01\xff\x00\x7e\xfe\x30\x38\x07\xfe\x3a\xdc\x42\x2c\x38\xf4\x78\xb7\x7e\xc4"
+"\x42\x2c\xe5\x0c\xef\x24\xf0\x39\xfa\x32\x15\xb1\xe1\xcd\xe4\x2e\xc5\xe5\xcd\x56\x2f\xe1\xc1\xcd\x48\x2c\x30\xf4\xf5\xcd\x4f\x2e"
+"\xf1\xe1\xd1\xc1\xfe\xfc\xc9\x0c\x04\x23\xc3\x25\x2f\xe5\x21\x72\x2c\x5f\x78\xb1\x7b\x20\x0b\xfe\xf0\x38\x07\xfe\xf4\x30\x03\x21"
+"\xae\x2c\x56\x23\xe5\x23\x23\xbe\x23\x28\x04\x15\x20\xf7\xe3\xf1\xd3\x27\xf0\x5c\x7b\xe3\xc9\x13\x8a\x2d\xfc\xd0\x2c\xef\xce\x2c"
+"\x0d\xf2\x2c\xf0\x3c\x2d\xf1\x0a\x2d\xf2\x34\x2d\xf3\x02\x2d\xf8\x4f\x2d\xf9\x1d\x2d\xfa\x45\x2d\xfb\x14\x2d\xf4\x21\x2e\xf5\x26"
+"\x2e\xf6\x1c\x2e\xf7\x17\x2e\xe0\x65\x2e\x7f\xc3\x2d\x10\xcd\x2d\xe1\x81\x2d\x04\xfe\x2c\xf0\xbd\x2c\xf1\xc1\x2c\xf2\xc9\x2c\xf3"
+"\xc5\x2c\x3e\x0b\x18\x0a\x3e\x0a\x18\x06\x3e\x09\x18\x02\x3e\x08\xcd\xfe\x13\xb7\xc9\xcd\xf2\x2c\xf5\x21\xea\x2c\xcd\xf2\x2c\x49"
+"\x04\xf0\x4e\x28\x08\x3e\x0d\xcd\xfe\x13\xcd\xc1\x2c\xf1\xc9\x2a\x42\x72\x65\x61\x6b\x2a\x00\xf5\x7e\x23\xb7\xc4\x25\x2f\x20\xf8"
+"\xf1\x37\xc9\x3e\x07\x18\xc9\x16\x01\xcd\x1e\x2d\x28\xf5\xc9\xcd\x73\x2d\x79\x90\xba\x38\xec\x18\x0a\xcd\x73\x2d\x7a\x93\xc8\x57"
+"\x18\x01\x51\x78\xb9\xc8\xd5\xcd\xcd\x2e\x7e\xd4\x25\x2f\x04\x23\xd4\xe4\x2e\xd1\x15\x20\xec\x18\x3c\x16\x01\xcd\x50\x2d\x28\xc3"
+"\x32\x00\xc2\x78\xba\x38\xbb\x18\x0b\xcd\x73\x2d\x7b\xd6\x01\x32\x00\xf0\x08\xb7\xc8\xcd\xc7\x2e\x30\x07\x05\x2b\x15\x20\xf3\x18"
+"\x11\x78\xb7\x28\x0a\x05\x2b\xd5\xcd\xa2\x3b\x00\xb1\xf2\xcd\xe4\x2e\xf6\xff\xc9\xe5\xcd\x52\x12\xd5\x21\xf1\x5f\x7c\x11\x5c\xe1"
+"\xc9\x3a\x15\xb1\x2f\x32\x15\xb1\xb7\xc9\xb7\xc8\x5f\x3a\x15\xb1\xb7\x79\x28\x0b\xb8\x28\x08\x73\x23\x04\xb7\x7b\xc3\x25\x2f\xfe"
+"\xff\xca\xfe\x2c\xaf\x32\x14\xb1\xcd\x9b\x2d\x0c\xe5\x7e\x73\x5f\x23\xb7\x20\xf9\x77\xe1\x04\x23\xcd\xe4\x2e\x3a\x14\xb1\xb7\xc4"
+"\xa2\x2e\xc9\x78\xb7\xc4\xc7\x2e\xd2\xfe\x2c\x05\x2b\x78\xb9\xca\xfe\x2c\xe5\x23\x7e\x2b\x77\x23\xb7\x20\xf8\x2b\x36\x20\x32\x14"
+"\xb1\xe3\xcd\xe4\x2e\xe3\x36\x00\xe1\x0d\x2f\x00\xf0\x19\xa6\x2e\xc9\xaf\x32\x16\xb1\x32\x17\xb1\xc9\xed\x5b\x16\xb1\x7c\xaa\xc0"
+"\x7d\xab\xc0\x37\xc9\x4f\xcd\xc1\x2e\xc8\x7d\x81\x6f\xcd\xca\x11\x30\xdf\x22\x16\xb1\xc9\xf9\x18\x10\x0d\x03\x19\x30\x08\x11\xff"
+"\xfe\x18\xf1\x00\x01\x00\xc5\xe5\xcd\xc1\x2e\xcc\x7c\x11\x7c\x82\x67\x7d\x83\x29\x00\xf0\x08\x0b\xe5\xcd\x4f\x2e\xe1\x22\x16\xb1"
+"\xcd\x4a\x2e\xe1\xc1\xc9\x11\x65\x12\x18\x03\x11\x65\x12\x4b\x00\x50\xe5\xcd\x7c\x11\xe3\xe1\x27\x70\x16\x00\xe1\xc3\x70\x11\xc5"
+"\x10\x00\xf0\x03\xeb\xcd\xc1\x2e\x20\x0c\x78\xb1\x20\x26\xcd\x7c\x11\x22\x16\xb1\x18\x06\x21\x00\xe0\x65\x12\xcd\xac\x13\xf5\xeb"
+"\xcd\x70\x11\x2a\x16\xb1\x24\x80\x00\x12\x03\x52\x00\xf0\x00\xf1\xe1\xc1\xda\x8a\x2d\xc3\xfe\x2c\x16\x01\x18\x02\x16\xff\x66\x1f"
+"\xe1\x4f\x2e\xd1\xcd\xc1\x2e\x28\x09\x7c\x82\x67\xcd\x0e\x2e\x76\x00\x70\xb7\xc9\x2a\x16\xb1\x7c\xb5\x15\x22\x71\xff\x18\x04\xd5"
+"\x11\x09\x01\x6c\x00\xf0\x07\x7a\x84\x67\xcd\xca\x11\x7b\xdc\xfe\x13\xe1\xc1\xd1\xc9\xc5\xe5\xeb\xcd\x7c\x11\x4f\xeb\xf9\x01\xf1"
+"\x02\x02\x2f\x20\xf8\xcd\x7c\x11\x91\xeb\x85\x6f\xcd\x70\x11\xe1\xc1\xb7\x04\x1b\x10\x47\x13\x00\xf1\x06\x83\x5f\x48\xcd\xca\x11"
+"\x38\x05\x78\x87\x3c\x83\x5f\xeb\xcd\xca\x11\x79\xdc\x25\x2f\x1b\x1b\x00\x27\x1b\x00\x23\x00\xf0\x04\x4f\xc5\xcd\xca\x11\xc1\xdc"
+"\xfa\x2d\xf5\xdc\x4f\x2e\x78\xc5\xcd\x35\x13\xc1\x39\x00\x70\xc4\x06\x2e\xf1\x30\x07\x9f\xa6\x01\x21\x4a\x2e\x31\x00\x00\x6f\x00"
+"\x81\xcd\xca\x11\xcd\xfa\x2d\xda\xbf\x85\x06\xf0\x0c\x7c\x11\x91\xc4\x06\x2e\xcd\xbf\x1b\xc3\x7e\x12\x11\x78\x2f\x18\x19\xa2\xda"
+"\x0f\x49\x82\x11\x82\x2f\x18\x0f\x46\x2f\xc0\x81\xeb\x21\x0e\xb1\x18\x04\x11\x04\xb1\xeb\xe5\x02\x28\xf3\x71\x05\x00\xed\xb0\xc1"
+"\xd1\xe1\x37\xc9\xd5\xc5\xf6\x7f\x47\xaf\x12\x13\x12\x13\x0e\x90\xb4\x20\x0d\x4f\xb5\x28\x0d\x6c\x0e\x88\x18\x04\x0d\xcb\x25\x8f"
+"\xf2\xb7\x2f\xa0\xeb\x73\x23\x77\x23\x71\xc1\xe1\xc9\xc5\x01\x00\xa0\xcd\xd3\x2f\xc1\xc9\x06\xa8\xd5\xcd\x9c\x37\xd1\xc9\xe5\xdd"
+"\xe1\xaf\xdd\x96\x04\x28\x1b\xc6\x90\xd0\xd5\xc5\xc6\x10\xcd\x3d\x37\xcb\x21\xed\x5a\x28\x08\xdd\x7e\x03\xb7\x3f\xc1\xd1\xc9\x9f"
+"\x18\xf9\x6f\x67\x37\xc9\xcd\x14\x30\xd0\xf0\xe5\x79\x34\x20\x06\x23\x3d\x20\xf9\x34\x0c\xe1\x37\xc9\xe5\xd5\x3d\x00\x40\x20\x0a"
+"\x06\x04\xf0\x13\xf1\x05\x0e\x01\x18\x28\xc6\xa0\x30\x25\xe5\xcd\x3d\x37\xaf\xb8\x8f\xb1\x4d\x44\xe1\x71\x62\x2e\xf1\x07\x5f\x7e"
+"\x72\xe6\x80\x47\x0e\x04\xaf\xb6\x20\x05\x2b\x0d\x20\xf9\x0c\x7b\xb7\x37\xd1\xe1\x54\x00\xf0\x0b\xc8\xcb\x78\xc8\x18\xa7\xcd\x27"
+"\x37\x47\x28\x52\xfc\x34\x37\xe5\xdd\x7e\x04\xd6\x80\x5f\x9f\x57\x6b\x62\x88\x1d\x00\xf7\x24\xf0\x10\x19\x7c\xd6\x09\x4f\xe1\xc5"
+"\xc4\xc8\x30\x11\xbc\x30\xcd\xe2\x36\x30\x0b\x11\xf5\x30\xcd\x77\x35\xd1\x1d\xd5\x18\xed\x11\xc1\x13\x00\x11\x38\x13\x00\xf0\xa0"
+"\x04\x36\xd1\x1c\xd5\x18\xed\xcd\x01\x30\x79\xd1\x42\x3d\x85\x6f\xd0\x24\xc9\x5f\x77\x0e\x01\xc9\xf0\x1f\xbc\x3e\x96\xfe\x27\x6b"
+"\x6e\x9e\x2f\x3c\xb7\x37\xc8\x4f\xf2\xd1\x30\x2f\x3c\x11\x31\x31\xd6\x0d\x28\x15\x38\x09\xc5\xf5\xcd\xed\x30\xf1\xc1\x18\xee\x47"
+"\x87\x87\x80\x83\x5f\x3e\xff\x8a\x57\x79\xb7\xf2\x04\x36\xc3\x77\x35\x00\x00\x00\x20\x84\x00\x00\x00\x48\x87\x00\x00\x00\x7a\x8a"
+"\x00\x00\x40\x1c\x8e\x00\x00\x50\x43\x91\x00\x00\x24\x74\x94\x00\x80\x96\x18\x98\x00\x20\xbc\x3e\x9b\x00\x28\x6b\x6e\x9e\x00\xf9"
+"\x02\x15\xa2\x40\xb7\x43\x3a\xa5\x10\xa5\xd4\x68\xa8\x2a\xe7\x84\x11\xac\x21\x65\x89\x22\x02\xb1\x21\x07\x6c\x22\x00\xb1\xc9\xeb"
+"\xcd\x36\x31\xeb\xcd\x27\x37\xc8\x11\x00\xb1\x06\x04\x1a\xae\x7b\x28\xf0\x08\xf9\xc9\xe5\x2a\x02\xb1\x01\x07\x6c\xcd\x9c\x31\xe5"
+"\x2a\x00\xb1\x01\x65\x89\xcd\x9c\x31\xd5\x15\x00\xf0\x44\xcd\x9c\x31\xe3\x09\x22\x00\xb1\xe1\x01\x07\x6c\xed\x4a\xc1\x09\xc1\x09"
+"\x22\x02\xb1\xe1\xe5\xdd\xe1\x2a\x00\xb1\xed\x5b\x02\xb1\x01\x00\x00\xdd\x36\x04\x80\xc3\xac\x37\xeb\x21\x00\x00\x3e\x11\x3d\xc8"
+"\x29\xcb\x13\xcb\x12\x30\xf7\x09\x30\xf4\x13\x18\xf1\x11\x2a\x32\x18\x03\x11\x25\x32\xcd\x27\x37\x3d\xfe\x01\xd0\xd5\xcd\xd3\x36"
+"\xf5\x30\x00\xf0\x2c\x11\x20\x32\xcd\xdf\x36\x30\x06\xdd\x34\x04\xf1\x3d\xf5\xcd\x87\x2f\xd5\x11\x82\x2f\xd5\xcd\xa2\x34\xd1\xe3"
+"\xcd\x9a\x34\xd1\xcd\x04\x36\xcd\x40\x34\x04\x4c\x4b\x57\x5e\x7f\x0d\x08\x9b\x13\x80\x23\x93\x38\x76\x80\x20\x3b\xaa\x38\x82\xd5"
+"\x74\x01\xf0\x02\xe3\x7c\xb7\xf2\x10\x32\x2f\x3c\x6f\x7c\x26\x00\xcd\x9f\x2f\xeb\xe1\x3a\x00\xf0\x0d\xc3\x77\x35\x34\xf3\x04\x35"
+"\x80\xf8\x17\x72\x31\x80\x85\x9a\x20\x1a\x7f\x06\xe1\xcd\x92\x34\xd2\x7d\x2f\x11\xa2\x6e\x00\x50\xf2\xe8\x37\x11\xa7\x09\x00\xf0"
+"\x16\xfa\xe2\x37\x11\x9d\x32\xcd\x69\x34\x7b\xf2\x55\x32\xed\x44\xf5\xcd\x70\x35\xcd\x8d\x2f\xd5\xcd\x43\x34\x03\xf4\x32\xeb\x0f"
+"\x73\x08\xb8\xd5\x52\x7b\xe9\x02\xb0\x80\xe3\xcd\x43\x34\x02\x09\x60\xde\x01\x78\x55\x00\x10\x7e\x7b\x00\xf1\x06\xe5\xeb\xcd\x9a"
+"\x34\xeb\xe1\xcd\x04\x36\x11\x6b\x32\xcd\xa2\x34\xf1\x37\xdd\x8e\x04\xef\x0e\xf0\x03\x29\x3b\xaa\x38\x81\xc7\x33\x0f\x30\x87\xf8"
+"\x17\x72\xb1\x87\x11\x6b\x32\x68\x01\xb0\xeb\xca\x7d\x2f\xf5\xcd\x27\x37\x28\x25\x47\x59\x02\xf0\x2e\xcd\x24\x33\xe1\x38\x25\xe3"
+"\xe1\xfa\xea\x32\xc5\xd5\xcd\xb6\x31\xd1\xdc\x77\x35\xdc\x2f\x32\xc1\xd0\x78\xb7\xfc\x31\x37\x37\xc9\xf1\x37\xf0\xcd\xe8\x37\xaf"
+"\xc9\xaf\x3c\xc9\x4f\xf1\xc5\xf5\x79\x37\x8f\x30\xfd\x47\xcd\x8d\x2f\xeb\x78\x87\x28\x15\xaa\x00\xf0\x64\x30\x16\xf1\x30\xf4\xf5"
+"\x11\x04\xb1\xcd\x77\x35\x30\x0a\xf1\x18\xe8\xf1\x37\xfc\xfb\x35\x18\xbe\xf1\xf1\xc1\xfa\xe2\x37\xc3\xea\x37\xc5\xcd\x88\x2f\xcd"
+"\x14\x30\x79\xc1\x30\x02\x28\x03\x78\xb7\xc9\x4f\x7e\x1f\x9f\xa0\x47\x79\xfe\x02\x9f\xd0\x7e\xfe\x27\xd8\xaf\xc9\x32\x13\xb1\xc9"
+"\xcd\x27\x37\xfc\x34\x37\xf6\x01\x18\x01\xaf\xf5\x11\xb4\x33\x06\xf0\x3a\x13\xb1\xb7\x28\x05\x11\xb9\x33\x06\xf6\xcd\x92\x34\x30"
+"\x3a\xf1\xcd\x6a\x34\xd0\x7b\x1f\xdc\x34\x37\x06\xe8\x45\x01\xf0\x13\xe2\x37\xdd\x34\x04\xcd\x40\x34\x06\x1b\x2d\x1a\xe6\x6e\xf8"
+"\xfb\x07\x28\x74\x01\x89\x68\x99\x79\xe1\xdf\x35\x23\x7d\x28\xe7\x5d\xa5\x80\x24\x04\xf1\x19\x81\xc3\x77\x35\xf1\xc2\x7d\x2f\x3a"
+"\x13\xb1\xfe\x01\xd8\x11\xbe\x33\xc3\x77\x35\x6e\x83\xf9\x22\x7f\xb6\x60\x0b\x36\x79\x13\x35\xfa\x0e\x7b\xd3\xe0\x2e\x65\x86\x6f"
+"\x01\xa0\x49\x33\xe3\xdc\x53\x33\xd1\xda\x04\x36\x8f\x00\x60\xf5\xfc\x34\x37\x06\xf0\x7c\x00\xf0\x3c\x4a\x3d\xf5\xf4\xfb\x35\xcd"
+"\x40\x34\x0b\xff\xc1\x03\x0f\x77\x83\xfc\xe8\xeb\x79\x6f\xca\x78\x36\x7b\xd5\x3e\xb0\xb5\x7c\xb0\xc1\x8b\x09\x7d\xaf\xe8\x32\xb4"
+"\x7d\x74\x6c\x65\x62\x7d\xd1\xf5\x37\x92\x7e\x7a\xc3\xcb\x4c\x7e\x83\xa7\xaa\xaa\x7f\xfe\xff\xff\x7f\x80\xcd\x77\x35\xf1\x11\x9c"
+"\x33\xf4\x9e\x34\xd6\x00\xc0\x11\xc3\x33\xc4\x77\x35\xf1\xfc\x34\x37\x37\xc9\xea\x01\x90\x87\x2f\xe1\x46\x23\xcd\x90\x2f\x13\x01"
+"\x00\x90\xd5\x11\x09\xb1\x05\xc8\xc5\x11\x0e\x4f\x01\xd1\xc1\xd1\xd5\xc5\xcd\xa2\x34\xc1\xd1\x18\xe3\xaf\xf5\x45\x00\xe0\x6b\x32"
+"\xc4\xa2\x34\xe5\xcd\xd9\x2f\x30\x13\xd1\xe5\xf5\x2d\x00\x02\x6e\x02\xf0\x34\x9a\x34\xf1\xd1\x37\xc9\xe1\xaf\x3c\xc9\xcd\xd3\x36"
+"\xf0\xb8\xc8\x3f\xc9\x3e\x01\x18\x05\x3e\x80\x18\x01\xaf\xe5\xdd\xe1\xd5\xfd\xe1\xdd\x46\x03\xfd\x4e\x03\xb7\x28\x0a\xfa\xba\x34"
+"\x0f\xa9\x4f\x18\x02\xa8\x47\xdd\x7e\x04\xfd\xbe\x04\x30\x14\x50\x41\x4a\xb7\x57\xfd\x7e\x34\x02\xf0\x43\x28\x54\x92\xfe\x21\x30"
+"\x4f\x18\x11\xaf\xfd\x96\x04\x28\x59\xdd\x86\x04\xfe\x21\x30\x52\xe5\xfd\xe1\xeb\x5f\x78\xa9\xf5\xc5\x7b\xcd\x43\x37\x79\xc1\x4f"
+"\xf1\xfa\x3c\x35\xfd\x7e\x00\x85\x6f\xfd\x7e\x01\x8c\x67\xfd\x7e\x02\x8b\x5f\xfd\x7e\x03\xcb\xff\x8a\x57\xd2\xb7\x37\xcb\x1a\xcb"
+"\x1b\xcb\x1c\xcb\x1d\xcb\x19\xdd\x34\x04\xc2\xb7\x01\x02\xf0\x00\xfd\x7e\x02\xdd\x77\x02\xfd\x7e\x01\xdd\x77\x01\xfd\x7e\x00\x08"
+"\x0b\xb0\x70\x03\x37\xc9\xaf\x91\x4f\xfd\x7e\x00\x9d\x46\x00\x10\x9c\x46\x00\x12\x9b\x46\x00\xf0\x17\x9a\x57\x30\x16\x78\x2f\x47"
+"\xaf\x91\x4f\x3e\x00\x9d\x6f\x3e\x00\x9c\x67\x3e\x00\x9b\x5f\x3e\x00\x9a\x57\xc3\xac\x37\x11\x09\xb1\xcd\x90\x2f\xeb\xd5\xfd\xf2"
+"\x03\xf0\x04\xfd\x7e\x04\xb7\x28\x2a\x3d\xcd\xaf\x36\x28\x24\x30\x1f\xf5\xc5\xcd\xb0\x35\x9e\x00\xb0\xcb\x7a\x20\x0b\x3d\x28\x12"
+"\xcb\x21\xed\x6a\xfa\x03\x42\xdd\x77\x04\xb7\x88\x00\xf1\x02\xc3\xe2\x37\x21\x00\x00\x5d\x54\xfd\x7e\x00\xcd\xf3\x35\xfd\x7e\x01"
+"\x06\x00\x11\x02\x06\x00\xf6\x0e\x03\xf6\x80\x06\x08\x1f\x4f\x30\x14\x7d\xdd\x86\x00\x6f\x7c\xdd\x8e\x01\x67\x7b\xdd\x8e\x02\x5f"
+"\x7a\xdd\x8e\x03\x57\xd4\x00\xf2\x05\x10\xde\xc9\xb7\x20\xd6\x6c\x63\x5a\x57\xc9\xcd\x87\x2f\xeb\xd5\xcd\x7d\x2f\xd1\x8d\x00\x01"
+"\x32\x01\xb0\x5a\xcd\xaf\x36\xca\xe2\x37\x30\x4f\xc5\x4f\xa4\x31\x00\xb3\x09\xf1\x03\xeb\xfd\x46\x03\xcb\xf8\xcd\x9d\x36\x38\x06"
+"\x79\xb7\x20\x08\x18\x33\x0d\x90\x04\x91\xdd\x71\x04\xcd\x72\x36\xdd\x71\x03\x06\x00\x11\x02\x06\x00\xf1\x38\x01\xcd\x72\x36\x3f"
+"\xdc\x9d\x36\x3f\x9f\x69\xdd\x66\x01\xdd\x5e\x02\xdd\x56\x03\xc1\x4f\xc3\xb7\x37\xc1\xc3\xea\x37\xdd\x46\x03\xcd\xea\x37\xaf\xc9"
+"\x0e\x01\x38\x08\x7a\xb8\xcc\xa0\x36\x3f\x30\x13\x7d\xfd\x96\x00\x6f\x7c\xfd\x9e\x01\x67\x7b\xfd\x9e\x02\x5f\x7a\x98\x57\x37\xcb"
+"\x11\x9f\x60\x00\xf0\x0e\x3c\x20\xd8\xc9\x7a\xb8\xc0\x7b\xfd\xbe\x02\xc0\x7c\xfd\xbe\x01\xc0\x7d\xfd\xbe\x00\xc9\x4f\xdd\x7e\x03"
+"\xfd\xae\x03\xfb\x01\xf0\x09\xb7\xc8\x81\x4f\x1f\xa9\x79\xf2\xcf\x36\xdd\xcb\x03\xfe\xd6\x7f\x37\xc0\xfe\x01\xc9\xb7\xf8\xaf\xfa"
+"\x06\x80\xdd\x7e\x04\xb7\xc8\xd6\x80\x37\x0c\x00\x00\x3c\x02\x01\x29\x02\x62\x38\x2c\x20\x33\xb7\xc8\x41\x00\x30\xfa\x22\x37\x09"
+"\x00\xf1\x1d\x96\x03\x20\x17\xdd\x7e\x02\xfd\x96\x02\x20\x0f\xdd\x7e\x01\xfd\x96\x01\x20\x07\xdd\x7e\x00\xfd\x96\x00\xc8\x9f\xfd"
+"\xae\x03\x87\x9f\xd8\x3c\xc9\xdd\x7e\x03\x18\xf6\xe5\xdd\xe1\x54\x00\x21\x18\xf1\x0a\x00\xd0\x03\xee\x80\xdd\x77\x03\xc9\xfe\x21"
+"\x38\x02\x3e\x21\x29\x01\xf0\x0f\x4e\x23\x66\x69\xeb\xcb\xfa\x01\x00\x00\x18\x0b\x4f\x78\xb5\x47\x79\x4d\x6c\x63\x5a\x16\x00\xd6"
+"\x08\x30\xf1\xc6\x08\xc8\x5c\x20\x02\x53\x02\xf4\x10\x3d\x20\xf3\xc9\x20\x17\x57\x7b\xb4\xb5\xb1\xc8\x7a\xd6\x08\x38\x1a\xc8\x53"
+"\x5c\x65\x69\x0e\x00\x14\x15\x28\xf1\xf8\x3d\xc8\xf3\x01\x20\xf2\x8c\xa3\x0b\x00\x6b\x00\x30\x70\x04\x47\x60\x00\x01\x89\x01\xf0"
+"\x16\xdd\x7e\x04\x15\x14\xf4\x73\x37\xdd\x77\x04\xcb\x21\x30\x12\x2c\x20\x0f\x24\x20\x0c\x13\x7a\xb3\x20\x07\xdd\x34\x04\x28\x1f"
+"\x16\x80\x78\xf6\x7f\xa2\x2e\x14\xf0\x05\x73\x02\xdd\x74\x01\xdd\x75\x00\xdd\xe5\xe1\x37\xc9\xaf\xdd\x77\x04\x18\xf5\x06\x0d\x00"
+"\xf1\x06\x78\xf6\x7f\xdd\x77\x03\xf6\xff\xdd\x77\x04\x77\xdd\x77\x01\xdd\x77\x02\xc9\xff\xc3\x01\x00\x32\xff\xff\xc0\x01\x00\x12"
+"\x18\x01\x00\x22\xff\x03\x01\x00\xf0\x22\xff\x0c\x18\x30\x7e\x0c\x18\x30\x00\xff\xc3\xe7\xdb\xdb\xe7\xc3\xff\x00\x01\x03\x06\xcc"
+"\x78\x30\x00\x3c\x66\xc3\xc3\xff\x24\xe7\x00\x00\x00\x30\x60\xff\x60\x30\x00\x00\x00\x0c\x06\xff\x06\x0c\x00\x3f\x00\x80\xdb\x7e"
+"\x3c\x18\x18\x3c\x7e\xdb\x0c\x00\x40\x18\x5a\x3c\x99\x10\x00\x60\x00\x03\x33\x63\xfe\x60\x38\x00\xf0\x02\xff\xdb\xdb\xff\x66\x3c"
+"\x3c\x66\xc3\xdb\xdb\xc3\x66\x3c\xff\xc3\xc3\x83\x00\x71\xff\x3c\x7e\xdb\xdb\xdf\xc3\x18\x00\x40\xdf\xdb\xdb\x7e\x20\x00\x11\xfb"
+"\x08\x00\xf1\x02\x7e\xdb\xdb\xfb\xc3\x66\x3c\x00\x01\x33\x1e\xce\x7b\x31\x00\x7e\x66\x01\x00\x40\xe7\x03\x03\x03\xa4\x00\x30\x00"
+"\xff\x66\x6c\x00\x71\x66\xff\x18\x18\x3c\x3c\x3c\x0b\x00\x50\x66\x30\x18\x00\x18\xa0\x00\x20\xff\xc3\x60\x00\x10\xdb\x40\x00\x90"
+"\xc3\xff\xff\xc3\xc3\xfb\xdb\xdb\xdb\x08\x00\x11\xdf\x08\x00\x10\xdb\x70\x00\x20\xc3\xff\x95\x06\x00\x04\x00\x01\xac\x00\x60\x00"
+"\x18\x00\x6c\x6c\x6c\x0f\x00\xf0\x14\x00\x6c\x6c\xfe\x6c\xfe\x6c\x6c\x00\x18\x3e\x58\x3c\x1a\x7c\x18\x00\x00\xc6\xcc\x18\x30\x66"
+"\xc6\x00\x38\x6c\x38\x76\xdc\xcc\x76\x00\x18\x18\xf4\x00\xe0\x00\x00\x0c\x18\x30\x30\x30\x18\x0c\x00\x30\x18\x0c\x0c\x28\x01\xe1"
+"\x00\x66\x3c\xff\x3c\x66\x00\x00\x00\x18\x18\x7e\x18\x18\x4b\x00\x00\x0c\x00\x00\x2d\x00\x13\x7e\x0e\x00\x00\x10\x00\xf0\x04\x00"
+"\x06\x0c\x18\x30\x60\xc0\x80\x00\x7c\xc6\xce\xd6\xe6\xc6\x7c\x00\x18\x38\x82\x00\x81\x7e\x00\x3c\x66\x06\x3c\x60\x66\x08\x00\xf0"
+"\x02\x1c\x06\x66\x3c\x00\x1c\x3c\x6c\xcc\xfe\x0c\x1e\x00\x7e\x62\x60\x7c\x10\x00\xe0\x3c\x66\x60\x7c\x66\x66\x3c\x00\x7e\x66\x06"
+"\x0c\x18\x18\xe8\x00\x20\x66\x3c\x10\x00\x40\x3c\x66\x66\x3e\x20\x00\x01\x5d\x00\x01\x79\x00\x20\x18\x18\xa5\x00\x00\x67\x00\x00"
+"\xa0\x00\x31\x00\x00\x7e\x03\x00\x30\x60\x30\x18\x13\x00\x50\x00\x3c\x66\x66\x0c\x28\x01\xf2\x20\x7c\xc6\xde\xde\xde\xc0\x7c\x00"
+"\x18\x3c\x66\x66\x7e\x66\x66\x00\xfc\x66\x66\x7c\x66\x66\xfc\x00\x3c\x66\xc0\xc0\xc0\x66\x3c\x00\xf8\x6c\x66\x66\x66\x6c\xf8\x00"
+"\xfe\x62\x68\x78\x68\x62\xfe\x08\x00\x21\x60\xf0\x20\x00\x51\xce\x66\x3e\x00\x66\x37\x00\x30\x66\x00\x7e\xbf\x00\xf0\x1a\x18\x7e"
+"\x00\x1e\x0c\x0c\x0c\xcc\xcc\x78\x00\xe6\x66\x6c\x78\x6c\x66\xe6\x00\xf0\x60\x60\x60\x62\x66\xfe\x00\xc6\xee\xfe\xfe\xd6\xc6\xc6"
+"\x00\xc6\xe6\xf6\xde\xce\xc6\x48\x01\x51\xc6\xc6\xc6\x6c\x38\x70\x00\xb1\x60\x60\xf0\x00\x38\x6c\xc6\xc6\xda\xcc\x76\x10\x00\x00"
+"\x38\x00\x40\x3c\x66\x60\x3c\xd0\x00\x20\x7e\x5a\x59\x00\x10\x3c\x68\x00\x10\x66\xe8\x00\x01\xfe\x01\xe0\x3c\x18\x00\xc6\xc6\xc6"
+"\xd6\xfe\xee\xc6\x00\xc6\x6c\x38\x3b\x00\x00\x20\x00\x00\xfe\x01\xb0\x00\xfe\xc6\x8c\x18\x32\x66\xfe\x00\x3c\x30\x01\x00\x30\x3c"
+"\x00\xc0\xf1\x00\x50\x06\x02\x00\x3c\x0c\x01\x00\x41\x3c\x00\x18\x3c\xaa\x00\x04\x8b\x01\x12\xff\x1c\x01\x00\x0f\x00\x70\x78\x0c"
+"\x7c\xcc\x76\x00\xe0\x5f\x01\x80\x66\xdc\x00\x00\x00\x3c\x66\x60\x80\x01\x61\x0c\x7c\xcc\xcc\xcc\x76\x10\x00\xf0\x00\x7e\x60\x3c"
+"\x00\x1c\x36\x30\x78\x30\x30\x78\x00\x00\x00\x3e\x72\x01\xb0\x7c\xe0\x60\x6c\x76\x66\x66\xe6\x00\x18\x00\xc1\x01\xc0\x3c\x00\x06"
+"\x00\x0e\x06\x06\x66\x66\x3c\xe0\x60\x01\x01\x11\xe6\x16\x00\xf0\x00\x18\x18\x3c\x00\x00\x00\x6c\xfe\xd6\xd6\xc6\x00\x00\x00\xdc"
+"\xc3\x00\x01\x50\x00\x00\xd0\x00\x01\x10\x00\xf0\x00\x7c\x60\xf0\x00\x00\x76\xcc\xcc\x7c\x0c\x1e\x00\x00\xdc\x76\x10\x01\xf0\x02"
+"\x00\x00\x3c\x60\x3c\x06\x7c\x00\x30\x30\x7c\x30\x30\x36\x1c\x00\x00\xe2\x00\x22\x66\x3e\x08\x00\x10\x3c\x59\x02\x40\xc6\xd6\xd6"
+"\xfe\xac\x02\x40\xc6\x6c\x38\x6c\x58\x00\x11\x66\x90\x00\xf1\x00\x00\x00\x7e\x4c\x18\x32\x7e\x00\x0e\x18\x18\x70\x18\x18\x0e\x90"
+"\x03\x00\x28\x02\x00\x0d\x00\x50\x18\x18\x70\x00\x76\xdb\x00\x52\x00\x00\x00\xcc\x33\x02\x00\x00\xfa\x00\x00\x04\x00\x40\xf0\xf0"
+"\xf0\xf0\x08\x00\x31\x0f\x0f\x0f\x92\x0c\x00\x36\x1c\x00\x10\x00\x00\x04\x00\x00\x1c\x00\x04\x04\x00\x00\x20\x00\x00\x0c\x00\x00"
+"\x20\x00\x00\x08\x00\x00\x20\x00\x04\x14\x00\x00\x08\x00\x04\x04\x00\x00\x20\x00\x00\x0c\x00\x00\x20\x00\x00\x0c\x00\x00\x2c\x00"
+"\x00\x08\x00\x00\x14\x00\x00\x08\x00\x04\x04\x00\x01\x2a\x03\x01\x05\x00\x00\xa6\x00\x00\x2e\x00\x32\x00\x1f\x1f\x10\x00\x11\x1f"
+"\x89\x00\x00\xd1\x02\x00\x03\x02\x03\x04\x00\x52\x00\x00\x00\x0f\x1f\x0c\x00\x10\x1f\x08\x00\x52\x00\x00\x00\xf8\xf8\x30\x00\x11"
+"\xf8\xc1\x00\x30\x00\x00\xff\xd5\x03\x31\x18\x18\x18\x08\x00\x52\x00\x00\x00\xf0\xf8\x30\x00\x10\xf8\x08\x00\x10\x00\x20\x00\x02"
+"\x10\x00\x62\xff\xff\x18\x18\x18\x10\x3d\x01\x00\xc8\x03\x01\x7d\x00\x10\x66\xbc\x03\x01\x9e\x01\xf1\x12\x60\xf8\x60\x66\xfe\x00"
+"\x38\x44\xba\xa2\xba\x44\x38\x00\x7e\xf4\xf4\x74\x34\x34\x34\x00\x1e\x30\x38\x6c\x38\x18\xf0\x00\x18\x18\x0c\x30\x00\xf0\x08\x40"
+"\xc0\x44\x4c\x54\x1e\x04\x00\x40\xc0\x4c\x52\x44\x08\x1e\x00\xe0\x10\x62\x16\xea\x0f\x02\xb6\x00\x81\x7e\x18\x18\x7e\x00\x18\x18"
+"\x00\x05\x00\xc0\x00\x00\x00\x7e\x06\x06\x00\x00\x18\x00\x18\x30\xf8\x01\x00\x9d\x03\x02\xf2\x00\xf3\x01\x73\xde\xcc\xde\x73\x00"
+"\x7c\xc6\xc6\xfc\xc6\xc6\xf8\xc0\x00\x66\xd0\x03\x21\x60\x60\xd8\x03\x70\x00\x00\x1e\x30\x7c\x30\x1e\x20\x03\x10\xfe\x30\x03\x00"
+"\xd1\x02\x02\xb3\x00\xa3\x66\x66\x66\x7c\x60\x60\x00\x00\x00\xfe\xb4\x04\xf0\x02\x7e\xd8\xd8\x70\x00\x03\x06\x0c\x3c\x66\x3c\x60"
+"\xc0\x03\x06\x0c\x66\x08\x00\x70\x00\xe6\x3c\x18\x38\x6c\xc7\x38\x02\xd0\xc3\xdb\xdb\x7e\x00\xfe\xc6\x60\x30\x60\xc6\xfe\x00\x71"
+"\x00\x42\xc6\x6c\xee\x00\x86\x04\x71\x00\x00\x18\x0c\x06\x03\x01\xd2\x00\x00\xe2\x05\x10\x0c\x61\x02\x10\x80\x3c\x03\x50\x18\x3c"
+"\x66\xc3\x81\x60\x01\x51\x0c\x06\x03\x03\x06\x18\x00\x20\x81\xc3\x74\x05\x31\x30\x60\xc0\x20\x00\x40\x30\x60\xc1\x83\x8b\x04\x70"
+"\x0c\x06\x83\xc1\x60\x30\x18\x30\x00\x00\x20\x00\xf0\x0d\xc3\xe7\x7e\x3c\x3c\x7e\xe7\xc3\x03\x07\x0e\x1c\x38\x70\xe0\xc0\xc0\xe0"
+"\x70\x38\x1c\x0e\x07\x03\xcc\xcc\x33\x33\x04\x00\x22\xaa\x55\x02\x00\x04\xa5\x01\x02\x6f\x06\x22\x03\x03\x83\x00\x05\x8f\x06\xf0"
+"\x12\xc0\xff\xfe\xfc\xf8\xf0\xe0\xc0\x80\xff\x7f\x3f\x1f\x0f\x07\x03\x01\x01\x03\x07\x0f\x1f\x3f\x7f\xff\x80\xc0\xe0\xf0\xf8\xfc"
+"\xfe\xff\x46\x00\x00\x34\x00\x22\x0a\x05\x02\x00\x00\x0c\x00\x00\x14\x00\x22\xa0\x50\x02\x00\xf0\x19\xaa\x54\xa8\x50\xa0\x40\x80"
+"\x00\xaa\x55\x2a\x15\x0a\x05\x02\x01\x01\x02\x05\x0a\x15\x2a\x55\xaa\x00\x80\x40\xa0\x50\xa8\x54\xaa\x7e\xff\x99\xff\xbd\xc3\xff"
+"\x7e\x08\x00\xf1\x08\xc3\xbd\xff\x7e\x38\x38\xfe\xfe\xfe\x10\x38\x00\x10\x38\x7c\xfe\x7c\x38\x10\x00\x6c\xfe\xfe\x08\x00\x00\x10"
+"\x00\x00\x18\x00\x00\x59\x06\x00\x8f\x06\x82\x00\x3c\x7e\xff\xff\x7e\x3c\x00\x91\x06\x00\x5c\x05\x10\x7e\x01\x00\xa0\x00\x0f\x07"
+"\x0d\x78\xcc\xcc\xcc\x78\x3c\xae\x04\x20\x18\x7e\x16\x06\xf0\x08\x0c\x0c\x3c\x7c\x38\x18\x1c\x1e\x1b\x18\x78\xf8\x70\x99\x5a\x24"
+"\xc3\xc3\x24\x5a\x99\x10\x38\x01\x00\x50\x7c\xd6\x18\x3c\x7e\x87\x02\x01\x92\x02\xf0\x06\xff\x7e\x3c\x18\x10\x30\x70\xff\xff\x70"
+"\x30\x10\x08\x0c\x0e\xff\xff\x0e\x0c\x08\x00\xb2\x04\x01\x25\x01\x00\x6f\x00\xf0\x25\x18\x00\x80\xe0\xf8\xfe\xf8\xe0\x80\x00\x02"
+"\x0e\x3e\xfe\x3e\x0e\x02\x00\x38\x38\x92\x7c\x10\x28\x28\x28\x38\x38\x10\xfe\x10\x28\x44\x82\x38\x38\x12\x7c\x90\x28\x24\x22\x38"
+"\x38\x90\x7c\x12\x28\x48\x88\x00\x3c\x19\x07\x50\x18\x00\x3c\xff\xff\xf9\x05\x00\x98\x07\xd0\x18\x18\x7e\x3c\x18\x00\x24\x66\xff"
+"\x66\x24\x00\x00"
+;
+unsigned char dump_cpc6128_os[16384];
+static const unsigned char dump_cpc6128_amsdos_lz4[] =
+"\xf1\x78\x01\x00\x05\x00\x72\xc0\xc3\xbc\xc1\xc3\xb2\xc1\xc3\xd1\xcc\xc3\xd5\xcc\xc3\xe4\xcc\xc3\xfd\xcc\xc3\x01\xcd\xc3\x18\xcd"
+"\xc3\xda\xcd\xc3\xdd\xcd\xc3\xe4\xcd\xc3\xfe\xcd\xc3\x2e\xd4\xc3\x8a\xd4\xc3\xc4\xd4\xc3\x72\xca\xc3\x0d\xc6\xc3\x81\xc5\xc3\x66"
+"\xc6\xc3\x4e\xc6\xc3\x52\xc6\xc3\x63\xc7\xc3\x30\xc6\xc3\x03\xc6\xc3\x68\xc1\xc3\xdb\xc0\xc3\x89\xc3\xc3\x01\xc3\xc3\xdb\xc3\xc3"
+"\xf7\xc3\xc3\x35\xc4\xc3\x45\xc4\xc3\xe3\xc3\xc3\xff\xc3\xc3\x3a\xc4\xc3\x4b\xc4\x43\x50\x4d\x20\x52\x4f\xcd\x43\x50\xcd\x44\x49"
+"\x53\xc3\x44\x49\x53\x43\x2e\x49\xce\x07\x00\xe1\x4f\x55\xd4\x54\x41\x50\xc5\x54\x41\x50\x45\x2e\x49\xce\x07\x00\xf1\x5f\x4f\x55"
+"\xd4\xc1\xc2\x44\x52\x49\x56\xc5\x55\x53\x45\xd2\x44\x49\xd2\x45\x52\xc1\x52\x45\xce\x81\x82\x83\x84\x85\x86\x87\x88\x89\x00\x2a"
+"\x39\x00\x22\x3e\xad\x3e\xc3\x32\x33\xad\xaf\x32\x40\xad\xf3\xd9\xed\x43\x3c\xad\xd9\x21\xfa\xc0\x18\x1a\x21\x40\xad\xbe\xc8\xc5"
+"\x46\x77\xb7\x78\xc1\x28\xe7\xf3\x08\xd9\xed\x4b\x3c\xad\xb7\x08\xd9\x21\x32\xc1\x22\x34\xad\xfb\xc9\xf3\x08\xd9\x22\x38\xad\xe1"
+"\xed\x73\x36\xad\x31\x00\xc0\xd5\xc5\xf5\xfd\xe5\x22\x00\x30\xcd\x4f\xc1\x2d\x00\xf2\x07\x43\x3c\xad\x21\x63\xc1\x22\x39\x00\xfd"
+"\xe1\xf1\xc1\xd1\x2a\x38\xad\x08\xd9\xed\x7b\x36\x38\x00\x04\x35\x00\x00\x2b\x00\x12\xd9\x26\x00\x03\x1d\x00\xf3\x18\xed\x5b\x3e"
+"\xad\xed\x53\x39\x00\xfd\x21\x48\xac\x5e\x23\x56\xd5\x08\xd9\xfb\xc9\xcd\x33\xad\x38\x00\x22\x3a\xad\xe1\xe5\x23\x23\xe3\xe5\x2a"
+"\x3a\xad\xc3\x33\x5b\x00\x20\xeb\xe9\x76\x01\xf0\x4d\xbe\xc2\xc3\xe1\xc2\xc3\xc3\xc2\xc3\xc8\xc2\xc3\xd2\xc2\xc3\xd7\xc2\xc3\xdc"
+"\xc2\xc3\xe9\xc2\xc3\xf2\xc2\xc3\x24\xc5\xc3\x29\xc5\xc3\x1a\xc5\xc3\xf7\xc2\xc3\xfc\xc2\xc3\xcd\xc2\xc3\x5a\xc5\xcd\x12\xb9\x4f"
+"\x21\xdc\xc1\xc3\x16\xbd\x38\x06\xcd\x12\xb9\xb7\x28\x18\xfd\xe5\xd5\x11\x00\xfb\x19\xe5\x23\xe5\xfd\xe1\xcd\xdd\xc5\xcd\xa0\xcc"
+"\xe1\xd1\xfd\xe1\x37\xc9\x31\x00\xc0\x88\x00\xf0\x4a\x11\x33\xad\x01\xa5\x00\xcd\xaf\xca\x21\x41\xad\x35\x3e\x81\x32\x03\x00\xaf"
+"\x32\x04\x00\x21\x33\xc0\x11\x80\xbe\x01\x3f\x00\xed\xb0\xcd\xc0\xc0\xcd\xdd\xc5\x0e\x41\x11\x00\x00\x21\x00\x01\xcd\x66\xc6\xdc"
+"\xac\xc2\x30\x0a\xeb\x01\x7f\xc1\x31\x33\xad\xc3\x77\xc1\x3e\x0f\xcd\xb8\xca\x18\xdf\xcd\x6f\xc8\xcd\xb0\xc8\x01\x48\x01\x11\x00"
+"\x00\xe5\xcd\x99\xc2\xe1\x27\x00\xf0\x40\x51\xe5\x23\x5e\x23\x56\x21\xa4\xfc\x19\xeb\xe1\x01\x00\x02\xed\xb0\xeb\x01\x49\x0a\x11"
+"\x00\x00\xcd\x99\xc2\x30\x35\xeb\x21\x00\xea\x19\xe5\x21\x06\xf2\x19\x3e\xc3\x32\x05\x00\x22\x06\x00\x32\x00\x00\x21\x03\x00\x19"
+"\x22\x01\x00\x21\x7f\xc1\x01\x33\x00\xed\xb0\x21\x04\x00\x7e\xe6\x0f\xfe\x02\x38\x02\x36\x00\x4e\xd1\x6e\x00\x10\x0e\x6e\x00\xf0"
+"\x16\x92\xcd\x66\xc6\xd0\x79\x0c\xfe\x49\x38\x03\x0e\x41\x14\x24\x24\x10\xef\x37\xc9\xe5\x01\x02\x00\x7e\xbe\x23\x37\x20\x06\x10"
+"\xf9\x0d\x20\xf6\xb7\xe1\x5b\x01\xf0\x21\x2b\xc2\x21\x86\xc4\x18\x1c\x21\x8f\xc4\x18\x17\x21\x98\xc4\x18\x12\x21\xa1\xc4\x18\x0d"
+"\x21\xaa\xc4\x18\x08\x21\xbc\xc4\x18\x03\x21\x7d\xc4\xcd\x33\xad\x6a\xc4\xcd\x68\xc1\x1f\xc5\x21\x89\xbe\x34\x00\x10\xf0\x13\x00"
+"\xf0\x1f\x4c\xc5\xcd\x33\xad\x2e\xc5\x32\xc5\xad\x01\x81\x00\x11\x42\xad\xed\xb0\x21\x43\xad\x22\xc3\xad\xc9\x21\x41\xad\x7e\xb7"
+"\x28\x04\x35\xcc\x81\xbb\xcd\x09\xbb\xdc\x0c\xbb\x9f\xc9\x21\x42\x13\x00\xf5\x09\x1b\xcd\x09\xbb\x30\x0c\x21\xc5\xad\x34\x35\xc0"
+"\x21\x42\xad\x36\x00\xc9\x35\x2a\xc3\xad\x7e\x23\x35\x00\xd2\xc4\x81\xbb\x36\x00\xc3\x06\xbb\x3e\x1a\xc9\x3e\xff\x48\x00\xf0\x34"
+"\xcc\x84\xbb\x36\xff\x79\xcd\x5a\xbb\xfe\x20\xd0\xcd\x78\xbb\xcd\x87\xbb\xd8\xcd\x8a\xbb\xc3\x8d\xbb\xcd\x2e\xbd\x3f\x9f\xc9\x79"
+"\xcd\x2b\xbd\xd8\xcd\xd3\xc4\x18\xf6\xf3\x01\xdd\xfa\x11\xc6\xad\xcd\xbd\xc3\x03\x03\x13\xcd\xbd\xc3\x3e\x36\x1e\xdc\xcd\xae\xc3"
+"\x3e\x76\x1c\x06\x00\x10\xb6\x06\x00\xc0\xfb\xc9\x01\xdf\xfb\xed\x79\x4b\x7e\x23\xed\x79\x04\x00\x72\xc9\x3e\x18\xed\x79\x3e\x04"
+"\x0d\x00\xb2\x3e\x05\xed\x79\x7e\x12\x23\xed\x79\x3e\x03\x11\x00\xf0\x08\xc9\x01\xdd\xfa\x21\xc6\xad\x18\x06\x01\xdf\xfa\x21\xc7"
+"\xad\xed\x78\x0f\x9f\xd8\xcd\x24\xc4\x08\x00\x2d\x18\x29\x1c\x00\xf1\x11\x38\x12\xcd\x24\xc4\xcd\xc5\xc4\xfe\x1a\x28\x0c\xed\x78"
+"\x0f\x30\xf4\xcd\x20\xc4\x0b\xed\x78\xc9\x1e\x00\x18\x02\x1e\x80\xf3\xf5\x5f\x00\x70\xe6\x7f\xb3\xed\x79\xf1\xfb\x5a\x00\xf5\x18"
+"\x18\x03\x01\xdf\xfa\xed\x78\xe6\x04\xc8\x37\x9f\xc9\x79\x01\xdd\xfa\x18\x04\x79\x01\xdf\xfa\xf5\xcd\xd3\xc4\xcd\x3d\xc4\x30\xf8"
+"\xf1\x0b\xed\x79\xc9\x21\xb3\x86\x01\xf0\x2b\xa1\xc4\x46\x23\x3a\x03\x00\x07\x10\xfd\xe6\x06\x16\x00\x5f\x19\x5e\x23\x56\xeb\xe9"
+"\x01\xa7\xbe\x13\xc3\x5d\xc4\xb3\xbe\x01\xaa\xbe\x26\xc3\x62\xc4\xb6\xbe\x01\xb0\xbe\x5b\xc3\x67\xc4\xbc\xbe\x03\xad\xbe\x58\xc3"
+"\x79\xc3\xb9\xbe\x03\x12\x00\xf1\xa0\x7f\xc3\xbc\xbe\x05\xb0\xbe\x5a\xc3\xbc\xbe\x5b\xc3\x07\xa7\xbe\x58\xc3\xb3\xbe\x13\xc3\x07"
+"\xaa\xbe\x55\xc3\xb6\xbe\x26\xc3\xcd\xd3\xc4\xfe\x13\xc0\xe5\xc5\xcd\x26\xc3\xc1\xe1\xc9\xe5\xd5\xc5\xcd\x13\xc3\xb7\x28\x0f\xcd"
+"\x26\xc3\xfe\x03\x20\x08\x3e\x0d\xcd\xeb\xca\xc3\x2b\xc2\xc1\xd1\xe1\xc9\xff\x79\xfe\x02\x21\x00\x00\xd0\x7b\x1f\x38\x0f\x59\x3e"
+"\x18\xcd\x5c\xca\xb7\x20\x06\xe5\xcd\x6c\xc5\xe1\xd0\x79\x32\x53\xbe\x21\x10\x02\xb7\x28\x03\x21\x20\x02\xc3\x9f\xca\xed\x43\x60"
+"\xbe\xc9\xcd\x6f\xc8\x0e\x00\x79\x32\x54\xbe\xc9\x79\x32\x55\xbe\xc9\xc5\x79\xfe\x02\xcc\xeb\xc7\xcd\x00\xc8\xdc\x1b\xc8\xcd\x32"
+"\xc8\xc1\xd0\xcd\xb6\xc8\x0d\x37\xcc\x6f\xc8\xd0\x3e\x00\xc9\xaf\x32\x59\xbe\xcd\x32\xc8\xcd\xc7\x0e\x00\xf4\x44\x60\x69\xc9\x01"
+"\x7e\xfb\x3e\x4a\xcd\x5c\xc9\x7b\xcd\x5c\xc9\xc3\xf9\xc8\xcd\x76\xc9\x3e\x16\xcd\x5c\xca\x57\x0e\x10\x21\x5d\xc5\xcd\xff\xc6\xd0"
+"\x3a\x51\xbe\xf5\xaf\xcd\x63\xca\xe5\xeb\x21\x43\xca\x01\x16\x00\xed\xb0\xe1\xf1\xe6\xc0\xfe\x40\x37\xc8\x11\xca\xc5\xfe\xc0\x28"
+"\x03\x11\xc0\xc5\x1a\x13\x77\x23\x1a\x13\x77\x01\x04\x00\x09\x0b\x00\xf0\x1e\x07\x00\x09\xeb\x01\x06\x00\xed\xb0\x37\xc9\x20\x00"
+"\x9b\x00\x01\x00\x01\x08\x2a\x50\x24\x00\xb3\x00\x00\x00\xc1\x09\x2a\x52\x32\x00\xfa\x00\xaf\x0f\x0c\x01\x03\x11\x40\xbe\x01\x3d"
+"\xfa\x03\xc0\xcd\xf4\xc9\xcd\xe8\xc9\x21\xd4\xc5\xcd\x0d\xc6\x40\x04\xf0\x10\x06\x80\x21\x6d\xbe\x11\xd6\xc9\xcd\xef\xbc\x3e\x10"
+"\xe5\x2a\x66\xbe\x32\x66\xbe\x7d\xe1\xc9\x11\x44\xbe\x01\x07\x00\xed\xb0\xb8\x00\xf1\x16\x03\xcd\x5c\xc9\x3a\x4a\xbe\x3d\x07\x07"
+"\x07\x2f\xe6\xf0\xb6\xcd\x5c\xc9\x23\x7e\xc3\x5c\xc9\xcd\x38\xc6\xd0\x3a\x4c\xbe\xc9\xcd\x76\xc9\xf5\xcd\x47\xe2\x00\x50\x04\xcd"
+"\x5c\xc9\xf1\xe2\x00\xf0\x0a\x1c\xc9\x3e\x45\x18\x02\x3e\x4d\xcd\x76\xc9\x06\x11\xcd\x6d\xc6\x3a\x48\xbe\x3d\x03\x03\x03\x20\xfa"
+"\x2e\x00\xf3\x0b\x3e\x66\x06\x10\x22\x62\xbe\x67\x69\x22\x74\xbe\x48\x21\x7c\xc6\xc3\xff\xc6\x2a\x74\xbe\x01\x7e\xfb\x7c\x21\x01"
+"\xc0\x7c\xfe\x4d\x20\x16\x3e\x14\xcd\x59\xc9\x3e\x10\x05\x00\x10\x12\x05\x00\xf1\x03\x13\xcd\x5c\xca\x18\x1c\x7a\xcd\x5c\xc9\xaf"
+"\xcd\x5c\xc9\x7d\xcd\x5c\xc9\x22\x00\x01\x09\x00\x10\x11\x21\x00\xf1\x24\xff\xcd\xd1\xc6\xfb\xcd\x07\xc9\xd8\xc0\x3a\x4d\xbe\x87"
+"\xd8\xaf\xc9\xf3\xcd\x5c\xc9\x7c\x2a\x62\xbe\xfe\x66\x20\x18\x18\x06\x0c\xed\x78\x77\x0d\x23\xed\x78\xf2\xe5\xc6\xe6\x20\x20\xf1"
+"\xc9\x0c\x7e\xed\x79\x10\x00\x12\xf5\x10\x00\xf2\x24\x3a\x66\xbe\x47\xcd\x2b\xc7\xd8\x28\x19\x78\xe6\x04\x28\x09\xd5\x16\x27\xcd"
+"\x66\xc7\xd1\x18\xec\xe5\x3e\x17\xcd\x63\xca\x36\x00\xe1\x18\xe1\x79\xc5\xcd\x7a\xca\xc1\x20\xd5\xc9\xcd\x54\xc7\xd8\xc8\xcd\x47"
+"\x08\x00\xc1\x7a\xfe\x27\x05\x30\x0a\x04\x14\xcd\x66\xc7\x15\x19\x00\xa0\x7a\xb7\x20\x02\x05\xc9\x15\xcd\x66\xc7\x14\x00\xb0\xe5"
+"\xc5\xcd\x1e\x00\xc1\xe1\xd8\x20\xf3\x05\xfd\x00\x30\xe5\xd5\xc5\x6a\x00\x01\x55\x00\x50\x7e\xb7\x20\x1f\xc5\x62\x01\x13\x07\xf9"
+"\x00\x91\x3e\x28\xcd\xc7\xc7\x30\x2a\x3e\x16\x72\x00\x91\x23\x36\xff\xc1\x2b\x7e\x92\x28\x28\x24\x00\x13\x0f\x24\x00\x00\x02\x01"
+"\xf0\x1a\x96\x30\x02\x7e\x92\x72\xcd\xc7\xc7\xc1\x38\x0b\x20\xbd\x05\xca\xad\xc9\xcd\x47\xc9\x18\xb4\xc1\xd1\xe1\x37\xc9\xf5\x3a"
+"\x4a\xbe\xcd\xe0\xc7\xf1\x3d\x20\xf5\x3a\x49\x0a\x00\x20\x3e\x08\x92\x01\xf1\x28\xf9\xc8\xf5\x3e\xf6\x3d\x20\xfd\xf1\x3d\x20\xf6"
+"\xc9\x21\x53\xbe\x5e\x3e\x03\xcd\x5c\xca\x3c\x11\x59\xbe\x12\x13\x01\x03\x00\xed\xb0\xc9\x11\x59\xbe\x1a\xb7\xc8\x13\x21\x53\xbe"
+"\x06\x03\x1a\xae\x20\x06\x13\x23\x10\xf8\x37\xca\x02\xf0\x6d\xc9\xf5\x21\x59\xbe\x35\x23\x5e\x23\x23\x34\xaf\xcd\x5c\xca\xbe\x20"
+"\x04\x36\x00\x2b\x34\xf1\xc9\xf5\xcd\x54\xc8\x38\x19\xcd\x6f\xc8\xc1\xd0\xc5\xcd\x80\xc8\xf1\x38\x06\xcd\xa2\xc8\xcd\x66\xc6\xf5"
+"\x9f\x32\x5e\xbe\xf1\xc9\xf1\x37\xc9\x3a\x5e\xbe\xb7\xc8\x01\x53\xbe\x21\x56\xbe\x5e\x0a\xae\xc0\x03\x23\x0a\xae\xc0\xcd\x92\xc8"
+"\xae\xc0\x37\xc9\x21\x5e\xbe\x36\x00\x2b\x7e\xb7\x37\xc8\x34\xcd\xa2\xc8\xc3\x4e\xc6\x21\x56\xbe\x01\x53\xbe\x0a\x77\x5f\x23\x03"
+"\x0a\x77\xcd\x92\xc8\x77\xc9\x03\x23\x3e\x15\x25\x03\xf0\x09\x0a\xcb\x3a\xd8\xcb\x3f\x18\xf9\xed\x5b\x56\xbe\x3e\x0f\xcd\x5c\xca"
+"\x21\x58\xbe\x86\x4f\x21\xb0\x9c\x03\xf0\x02\xe5\xd5\xc5\xf5\x3e\xff\x32\x5d\xbe\xcd\xd6\xc8\xcd\x1b\xb9\x18\x0a\x11\x00\x70\xcd"
+"\xd6\xc8\xeb\xed\xb0\xf1\xe7\x03\x01\xeb\x00\x00\x46\x00\xf1\x1c\x3d\x23\x23\xa6\x11\x80\x00\x21\x30\x02\x3c\x19\x3d\x20\xfc\xeb"
+"\xcd\x98\xca\x2a\x60\xbe\x01\x80\x00\xc9\xcd\x1c\xc9\xd8\x3a\x4c\xbe\xe6\x08\xc8\x3e\x13\x18\x0d\xcd\xf9\xc8\x42\x02\xf1\x29\xe6"
+"\x02\xc8\x3e\x12\xcd\x7a\xca\xd8\xca\xad\xc9\xc9\xe5\xd5\x16\x00\x21\x4c\xbe\xe5\xed\x78\xfe\xc0\x38\xfa\x0c\xed\x78\x0d\x77\x23"
+"\x14\x3e\x05\x3d\x20\xfd\xed\x78\xe6\x10\x20\xe8\xe1\x7e\xe6\xc0\x2b\x72\xd1\xe1\xc0\x37\xc9\xad\x01\x00\x73\x01\xf1\x26\xcd\x1c"
+"\xc9\xfe\x80\x20\xf4\xc1\xc9\xcd\x5c\xca\xf5\xf5\xed\x78\x87\x30\xfb\x87\x30\x03\xf1\xf1\xc9\xf1\x0c\xed\x79\x0d\x3e\x05\x3d\x00"
+"\x20\xfc\xf1\xc9\x22\x76\xbe\xe3\xd5\xc5\xed\x73\x64\xbe\xe5\x21\xad\xc9\xe3\xbe\x00\xf1\x06\xdf\xc9\x3a\x5f\xbe\xb7\x20\x14\x01"
+"\x7e\xfa\x3e\x01\xed\x79\xed\x5b\x44\xbe\xcd\xcd\x14\x00\x20\x28\xfa\x82\x08\xb0\x76\xbe\xc9\xed\x7b\x64\xbe\xf5\xed\x5b\x46\x19"
+"\x00\x00\xe8\x00\xf0\x46\x3e\x00\xd8\x21\x4c\xbe\x7e\xe6\x08\x23\xb6\xf6\x40\x2b\x2b\xc9\x21\x67\xbe\x01\x00\x00\xc3\xe9\xbc\x21"
+"\x5f\xbe\x7e\x2f\x77\xb7\x28\x06\x21\x67\xbe\xc3\xec\xbc\xcd\xdf\xc9\x3e\x00\x01\x7e\xfa\xed\x79\xaf\x32\x5f\xbe\xc9\x21\x20\x02"
+"\x11\xd0\x01\xcd\x03\xca\x21\x10\x02\x11\x90\x01\xcd\x98\xca\xed\x53\x42\xbe\xd5\xcd\x9f\xca\x22\x40\xbe\xe5\x8a\x04\xf0\x0c\x19"
+"\x00\xed\xb0\x4b\x42\xe1\x36\x00\x23\x36\x00\x11\x07\x00\x19\x11\x30\x02\xcd\x98\xca\x73\x23\x72\x23\xd1\x05\x00\xf0\x16\x71\x23"
+"\x70\x23\xeb\x21\x10\x00\x09\xeb\x73\x23\x72\xc9\x24\x00\x03\x07\x00\xaa\x00\x3f\x00\xc0\x00\x10\x00\x02\x00\x41\x09\x2a\x52\xe5"
+"\x02\x04\x00\x25\x08\xf2\x1d\x63\xca\x7e\xe1\xc9\xd5\x2a\x42\xbe\x1d\x11\x40\x00\x20\x01\x19\x5f\x19\xd1\xc9\x2a\x78\xbe\x32\x78"
+"\xbe\x7d\xc9\xf5\x3a\x78\xbe\xb7\x20\x05\xf1\x4b\xc3\xb8\xca\xf1\xaf\xc9\xff\x01\x00\xf1\x65\xfd\xe5\xe3\x09\x44\x4d\xe1\xc9\xfd"
+"\xe5\xe3\x19\xeb\xe1\xc9\xd5\xfd\xe5\xd1\x19\xd1\xc9\xfe\x61\xd8\xfe\x7b\xd0\xc6\xe0\xc9\xaf\x12\x13\x0b\x78\xb1\x20\xf8\xc9\xcd"
+"\xeb\xca\x3e\x14\xcd\xeb\xca\xcd\x09\xbb\x38\xfb\xcd\x81\xbb\xcd\x06\xbb\xcd\xa6\xca\xfe\x43\x28\x11\xfe\x49\x37\x28\x0c\xfe\x52"
+"\x28\x07\x3e\x07\xcd\x5a\xbb\x18\xe6\xb7\xcd\x5a\xbb\xcd\x84\xbb\x3e\x00\xe5\xc5\xf5\xe6\x7f\x21\x86\xcb\x47\x04\x18\x05\x7e\x23"
+"\x3c\x20\xfb\x10\xf9\x7e\x23\xfe\xff\x28\x0b\x31\x06\xf0\x2c\xcb\xc1\xd1\xe1\x18\xef\xf1\xc1\xe1\xc9\xb7\xf2\x66\xcb\xfe\xfe\x28"
+"\x46\xfe\xfc\x28\x1a\xfe\xfd\x20\xc8\x06\x08\xcd\x2f\xcb\x3e\x2e\xcd\x83\xcb\x06\x03\x13\x1a\xe6\x7f\xcd\x83\xcb\x10\xf7\xc9\xeb"
+"\x16\x20\x01\x9c\xff\xcd\x4d\xcb\x01\xf6\x06\x00\xf0\x69\x7d\xc6\x30\x18\x36\x3e\xff\xe5\x3c\x09\x30\x04\xe3\xe1\x18\xf7\xe1\xb7"
+"\x28\x02\x16\x30\x82\x18\x22\x79\xc6\x41\x18\x1d\xf5\xfe\x20\x20\x17\xe5\xd5\xcd\x69\xbb\xcd\x78\xbb\x7a\xd6\x04\x3f\x30\x01\xbc"
+"\xd1\xe1\x30\x04\xf1\xc3\xe9\xca\xf1\xc3\x5a\xbb\x0d\x0a\xff\x20\x20\x20\xff\xfc\x4b\xff\x97\x82\x20\x66\x72\x65\x65\x97\xff\x80"
+"\x42\x61\x64\x20\x63\x6f\x6d\x6d\x61\x6e\x64\x80\xff\x9b\x61\x6c\x72\x65\x61\x64\x79\x20\x65\x78\x69\x73\x74\x73\x80\xff\x9b\x6e"
+"\x6f\x74\x20\x66\x6f\x75\x1d\x00\xf1\x40\x95\x64\x69\x72\x65\x63\x74\x6f\x72\x79\x20\x9a\xff\x98\x9a\xff\x98\x63\x68\x61\x6e\x67"
+"\x65\x64\x2c\x20\x63\x6c\x6f\x73\x69\x6e\x67\x20\xfd\x80\xff\x9b\x69\x73\x20\x9d\x20\x6f\x6e\x6c\x79\x80\xff\xfd\xff\x95\x75\x73"
+"\x65\x72\xfc\x80\xff\x2e\x2e\x2e\x5e\x43\xff\x96\x43\x50\x2f\x4d\x80\xff\x96\x62\x6f\x6f\x74\x20\x73\x4b\x00\xf0\x10\x80\xff\x95"
+"\x9d\x99\xff\x95\x9c\x99\xff\x98\x69\x73\x20\x9c\x20\x70\x72\x6f\x74\x65\x63\x74\x65\x64\x80\xff\x98\x6d\x69\x73\x56\x00\xf0\x4b"
+"\x80\xff\x80\x52\x65\x74\x72\x79\x2c\x20\x49\x67\x6e\x6f\x72\x65\x20\x6f\x72\x20\x43\x61\x6e\x63\x65\x6c\x3f\x20\xff\x80\x44\x72"
+"\x69\x76\x65\x20\xfe\x3a\x20\xff\x80\x46\x61\x69\x6c\x65\x64\x20\x74\x6f\x20\x6c\x6f\x61\x64\x20\xff\x80\x80\xff\x95\x64\x69\x73"
+"\x63\x20\xff\x20\x66\x61\x69\x6c\x80\xff\x66\x75\x6c\x6c\x80\xff\x80\xfd\x20\xff\x77\x72\x69\x74\x65\xff\xeb\x00\x02\x0f\x02\xf0"
+"\x09\xff\xaf\xfd\x77\x00\xfd\x77\x01\x3d\xfd\x77\x08\xfd\x77\x2c\xfd\x22\x7d\xbe\x21\x77\xbc\x11\x64\xb5\x02\xf0\x24\x01\x27\x00"
+"\xed\xb0\xeb\x36\x30\x23\x36\xcd\x23\xcd\x12\xb9\x77\x3e\xc9\x32\x7f\xbe\xaf\xcd\xe4\xcc\xd0\x21\x77\xbc\x06\x07\xcd\xe9\xcc\xd0"
+"\x21\x9b\xbc\x04\x18\x05\x21\x8c\xbc\x06\x05\xb7\x20\x3f\x11\x8b\x37\x00\x30\x36\xdf\x23\xc4\x02\xf0\x1f\x10\xf7\x37\xc9\xcd\x18"
+"\xcd\xd0\x21\x64\x01\x11\x77\xbc\x01\x15\x00\xcd\x21\xcd\xd0\x21\x88\x01\x11\x9b\xbc\x0e\x03\x18\x09\x21\x79\x01\x11\x8c\xbc\x01"
+"\x0f\x00\xb7\x20\x07\xcd\x9f\xca\x6b\x07\xf2\x53\x3e\x04\xc3\xeb\xca\xfd\x2a\x7d\xbe\xf3\x08\xd9\x79\xd1\xc1\xe1\xe3\xc5\xd5\x4f"
+"\x06\x7f\x11\xd2\x10\x19\xe5\xd9\x08\xfb\xc3\x7f\xbe\xc3\xaf\xce\xc3\xb6\xd1\xc3\xbc\xd1\xc3\x64\xcf\xc3\xf5\xcf\xc3\x69\xd0\xc3"
+"\x65\xd0\xc3\x37\xcf\xc3\xd8\xd1\xc3\xc2\xd1\xc3\x8f\xd0\xc3\xd8\xd0\xc3\x13\xd5\xcd\x77\xcd\xc9\xe5\x21\x06\x00\x39\xfd\x75\x06"
+"\xfd\x74\x07\xe1\xc9\xcd\x77\xcd\xf5\xfd\x7e\x08\x18\x07\x09\x00\xa0\x2c\xfe\xff\x28\x12\xcd\x16\xce\xf1\xc9\x15\x00\xf3\x4e\x03"
+"\xfd\x7e\x2c\xcd\x77\xcd\x3c\xc8\x3e\x0e\xb7\x18\x0a\x3e\x04\xcd\xca\xdb\xc6\x0c\xf6\x80\xbf\xfd\x6e\x06\xfd\x66\x07\xf9\xc9\x3d"
+"\x3d\xc8\xc3\xaf\xcd\xcd\xcf\xcd\x46\x23\xc3\xf9\xdb\xdd\x6e\x00\xdd\x66\x01\xdd\x23\xdd\x23\xc9\xaf\x18\x02\x3e\x01\xcd\x73\xcd"
+"\x18\x13\xcd\x73\xcd\xcd\xc2\xcd\xcd\xc7\xcd\x05\xc2\xaf\xcd\x7e\xcd\xa6\xca\xd6\x41\xcd\x16\xce\xfd\x77\x00\xc9\x1a\x00\xf0\x02"
+"\xcf\xcd\x11\x10\x00\xcd\xf3\xdb\xd2\xaf\xcd\xfd\x75\x01\xc9\x0a\x03\x91\x04\xf0\x0c\x4f\x1e\xff\xfd\x7e\x08\xb9\x28\x08\xfd\x7e"
+"\x2c\xb9\x28\x02\x1e\x00\xd5\xc5\xcd\xf0\xc4\xc1\xd1\x7c\xb5\xca\x27\x00\xa0\x03\xfd\x74\x04\xfd\x73\x05\xfd\x71\x02\x8a\x04\xf0"
+"\x05\xc9\x21\x50\x00\xcd\x5a\xce\xe5\x11\x42\x00\x19\x36\x80\xe1\xc9\x21\x9a\x00\xc5\x51\x04\x21\x36\x00\x6d\x01\x00\x71\x01\xf0"
+"\x01\xe5\xc5\x01\x45\x00\xeb\xcd\xaf\xca\xc1\x60\x69\xd1\xd5\x01\x0c\xed\x08\xa1\xd1\xe5\x01\x12\x00\x09\x36\x16\x23\x23\x27\x00"
+"\xf1\x37\x36\xff\xe1\xc1\xc9\xe5\x21\x00\x00\x54\x06\x43\xe3\x7e\x23\xe3\x5f\x19\x10\xf8\xeb\xe1\xc9\xe5\xcd\x92\xce\x73\x23\x72"
+"\xe1\xc3\xf9\xd3\xcd\x9d\xcd\xd5\xcd\x6f\xda\xcd\x14\xce\x21\x09\x00\x09\x7e\x3c\x28\x08\xcd\x51\xd6\xd2\x0c\xd5\x18\x1e\xcd\xa8"
+"\xd2\xcd\x51\xd6\x38\x16\xcd\xb3\x08\x00\x30\x0e\xcd\xb7\x08\x00\xf0\x26\xf5\xd4\xa8\xd2\xf1\xd2\x0c\xd5\xd1\xcd\x48\xce\xe5\x11"
+"\x08\x00\xcd\x98\xca\x0b\x0a\x12\xcd\x9c\xd7\x21\xe4\x00\xcd\x9f\xca\xcd\x92\xd3\x30\x1f\xe5\xd5\xcd\x92\xce\xcd\xf9\xdb\xcd\xf3"
+"\xdb\xd1\xe1\x20\x0d\x11\x55\x26\x00\xf0\x00\x01\x45\x00\xed\xb0\x18\x03\xcd\x9c\xd7\xe1\xe5\x11\x15\x00\xb0\x0a\xf0\x03\x23\x23"
+"\x4e\x23\x46\xe1\x37\x9f\xfd\x7e\x67\xc9\xcd\xa2\xcd\xd5\xcd\x6a\x88\x00\xf1\x01\xd1\xcd\x57\xce\xe5\xcd\xab\xd2\xcd\x76\xd6\x60"
+"\x69\x2b\x11\x2c\x3d\x00\x10\x0d\x45\x09\x10\x17\x7a\x09\x31\xe1\x37\x9f\x91\x0a\xf1\x1c\x74\xcf\xc1\xd1\xe1\xd0\xfe\x1a\x37\xc0"
+"\xb7\xc9\xcd\x84\xcd\xfd\xe5\xd1\x21\x50\x00\x19\x7e\xfe\x02\xca\xaa\xcd\x36\x01\x21\x95\x00\x19\x7e\x23\xb6\x23\xb6\x28\x36\x21"
+"\x68\x0b\x00\xf0\x01\x2b\xcc\xcb\xcf\x7e\x23\xb6\x28\x26\x46\x2b\x4e\x0b\x71\x23\x70\x22\x00\xd1\x06\x03\x7e\xd6\x01\x77\x30\x03"
+"\x23\x10\xf7\x21\x53\x93\x00\xf0\x27\xeb\xe7\xeb\x13\x72\x2b\x73\x37\xc9\x3e\x0f\xb7\xc9\xe5\xd5\xe5\x21\x51\x00\x19\xcd\xf9\xdb"
+"\xe5\x01\x10\x00\xcd\x49\xd0\x3e\x10\x91\x47\x0e\x00\xcb\x38\xcb\x19\xd1\xe1\x71\x23\x70\x01\xea\xff\x09\x73\x23\x72\xd1\xe1\x81"
+"\x00\x10\xe5\xb1\x01\x50\x9f\xca\x7e\xfe\x01\x81\x00\x31\x02\x11\x45\x50\x00\xf2\x0a\xe1\xd5\xe5\xeb\x3e\x07\xcd\xeb\xdb\x44\x4d"
+"\xe1\xcd\x49\xd0\xd1\x30\x1e\x7b\xe6\x7f\x28\x19\xf5\xe5\x2f\x01\x30\xe5\x01\x01\x58\x00\x60\xe1\xd1\xc1\x30\x05\x48\x80\x0a\x20"
+"\x21\x6f\x46\x01\xd0\x37\x9f\xc3\xf9\xdb\x18\x14\xcd\x92\xd3\xd0\x11\x67\x00\x01\x90\x1a\x1f\xdc\x52\xd2\x11\x80\x00\x19\xac\x05"
+"\xc0\xe8\x37\xc9\xcd\x64\xcf\xd0\xe5\xd5\xf5\x21\x53\x2e\x00\xf0\x0b\x5e\x23\x56\x1b\x72\x2b\x73\x54\x5d\x21\x42\x00\x19\xcd\xab"
+"\xd7\x21\x15\x00\x19\x34\x20\x02\x23\x34\xf1\x9a\x00\x20\x8d\xcd\x7c\x02\x00\x1f\x01\x17\x9a\x1f\x01\xf2\x09\xb2\x00\x19\xe5\xcd"
+"\xf9\xdb\x01\x00\xf8\x09\xd5\xdc\x18\xd1\xd1\xe1\x34\x23\x20\x01\x34\x21\xdf\x41\x00\x91\x9d\x00\x19\xf1\x4e\x23\x46\x2b\x02\x47"
+"\x00\x00\x10\x09\xa0\x9f\xc9\xcd\x8d\xcd\xf5\xe5\xd5\x21\x9a\x72\x00\x05\xe5\x00\xd1\x20\x00\x19\x70\x2b\x71\xc1\x2b\x70\x2b\x71"
+"\x11\x29\x0c\x00\xe1\x11\xd3\xff\x19\x71\x23\x70\xc1\x23\x71\x23\x70\x11\xe6\x0c\x00\x10\xf1\xef\x01\x10\x77\x82\x00\xb0\xb6\x00"
+"\x19\x7e\xb7\x28\x18\x21\xb1\x00\x19\xa3\x0e\xf0\x02\x06\x28\x0d\x21\x2c\x00\x19\xd5\xeb\xcd\xa7\xd7\xcd\x7d\xd7\xd1\x21\x96\x00"
+"\x70\x5e\x23\x56\x01\xe8\xff\x09\x75\x01\x42\xcd\x64\xd1\xc1\x33\x07\x20\x23\x23\x38\x07\x11\xe7\x4f\x00\xf0\x0b\x37\x9f\xc9\xd5"
+"\x3e\x07\xeb\xcd\xeb\xdb\xeb\x42\x4b\xcd\x88\xd1\xc1\x79\xe6\x7f\xc8\x4f\x06\x00\x11\xe4\x2a\x01\xe0\xd5\xcd\x1b\xb9\x3e\x1a\x12"
+"\xe1\x03\x18\x27\xe5\x11\xb1\x12\x00\x53\x1a\x1f\x30\x13\xc5\x1d\x00\xf4\x00\x01\x80\x00\xcd\x1b\xb9\xe1\xc1\xcd\x52\xd2\xcd\xaf"
+"\xd3\xe1\x52\x01\x10\xd5\xc1\x01\xe0\xcd\xe5\xc9\xfd\x36\x08\xff\x18\x6e\xcd\x8d\xcd\x11\x2d\x3a\x00\xf1\x00\xaf\xcd\x3c\xd8\x1b"
+"\x3e\xff\x12\xcd\x1f\xc5\x18\x58\x21\xdf\xfa\x00\x01\x54\x02\x72\xdd\xcd\x8d\xcd\xcd\x18\xd1\x9c\x02\xf2\x00\xd5\xcd\x8c\xd7\x01"
+"\x9f\x00\xcd\x90\xca\x21\x12\x00\x09\x5e\x47\x03\xf0\x25\x20\x16\x7b\xe6\x0e\x20\x05\xcd\xb3\xd2\x18\x0c\xfe\x02\x20\x05\xcd\xb7"
+"\xd2\x18\x03\xcd\xa8\xd2\x60\x69\x7b\xe6\x0f\xfe\x06\xc4\xa4\xce\xc1\x3e\xff\x02\x03\xcd\xda\xd2\x37\x9f\xc9\xfd\x66\x02\xfd\x36"
+"\x05\x00\x4e\x03\x22\x43\xd2\x55\x00\xf0\x71\x1a\xbc\xc0\x3e\xff\x12\x13\x3e\x09\xc3\xca\xdb\xe5\xc5\xe5\x11\x01\x01\x06\x81\x18"
+"\x0e\xe3\xe7\xe3\xae\xdd\xae\x00\xe3\x77\x23\xe3\xdd\x23\x23\x15\x20\x06\x16\x0b\xdd\x21\x81\xd2\x1d\x20\x05\x1e\x0d\x21\x8c\xd2"
+"\x10\xdf\xe1\xd1\xe1\xc9\x49\xb1\x36\xf0\x2e\x1e\x06\x2a\x28\x19\xea\xe2\x9d\xdb\x1a\x42\x29\x39\xc6\xb3\xc6\x90\x45\x8a\x20\x20"
+"\x20\x24\x24\x24\x42\x41\x4b\x42\x41\x53\x42\x49\x4e\xaf\x18\x0e\x3e\x03\x18\x0a\x3e\x06\x18\x06\x3e\x09\x18\x02\x3e\x0c\xd5\xc6"
+"\x99\x5f\xce\xd2\x93\x57\x18\x07\xd5\x11\xa8\xff\x00\x20\xe5\xc5\xcc\x00\xf0\x08\x01\x03\x00\xeb\xed\xb0\xc1\xe1\xd1\xc9\x21\x0c"
+"\x00\x09\x36\xff\x23\x23\x36\xff\xcd\x83\xd6\x55\x04\xf2\x0a\xe3\xcd\xa2\xd6\xe3\x30\x28\xcd\xaf\xd2\xcd\xd8\xd7\x30\x08\x26\x01"
+"\xcd\xd9\xd9\x38\x01\x24\xcd\xc3\x10\x00\x12\x2e\x10\x00\xf2\x15\x2c\x7c\xb7\x28\xd5\x7d\xb7\x28\xd1\xf1\x7d\xb7\x28\x43\x3d\x28"
+"\x66\x7c\xb7\x28\x3c\x3d\x28\x45\xcd\x83\xd6\xcd\xa2\xd6\xd0\xcd\x35\xd3\x18\xf7\x43\x00\x72\xda\xaa\xd4\xcd\x51\xd3\xd8\x40\x00"
+"\x90\xd0\xc5\x42\x4b\xcd\xaf\xd2\x18\x0d\x0b\x04\x21\xd8\xd7\x0f\x00\x64\xc3\xd2\xc1\xc3\x7a\xd9\x39\x00\x10\x3e\x39\x00\x03\x45"
+"\x00\x10\x7a\x0c\x00\x05\x3c\x00\xd0\xda\xaa\xd4\xc9\xcd\xc3\xd2\x50\x59\x3e\x0a\xc3\xb1\x00\x03\x03\xaa\x04\xf0\x02\xcd\x10\xd4"
+"\x30\x08\xeb\xe3\xcd\xe8\xd9\xd1\x18\x48\xe1\xc1\xd1\xe1\xe4\x03\x22\xc5\xe5\x73\x01\xf0\x1b\xcd\xc8\xd6\x38\x0b\x3e\x08\xc2\xb1"
+"\xcd\xcd\x8c\xd7\xcd\xfa\xd6\xcd\x2f\xd7\x0e\x00\x38\x18\xd5\xeb\xcd\x93\xd8\xeb\x3e\x08\xd2\xb1\xcd\x73\x78\xb7\x28\x02\x23\x72"
+"\xd1\x1a\x00\xd0\x02\xeb\xe3\xcd\xf3\xd9\xd1\xcd\x7d\xd7\xcd\xa7\xd7\x22\x03\x14\xc9\x47\x00\xc0\x9c\xd7\xcd\x10\xd4\xeb\xe1\x0e"
+"\x00\xda\xf3\xd9\x49\x06\xf0\x0d\xc8\xd6\x38\x12\xc0\xcd\xfa\xd6\xd5\x42\x4b\x03\xc5\xcd\xb3\xd7\xeb\xd1\xdc\xdf\xdb\xd1\xdc\x0c"
+"\xd7\xda\x2f\xd7\x30\x06\x52\x06\x00\xb7\x28\x06\x4f\x06\x20\xcd\xa6\x01\x05\xa0\xcd\xd0\xdb\x3e\x0c\xcd\x72\xd4\x65\xe5\xea\x00"
+"\xf0\x2a\x98\xd6\x30\x1a\xcd\xdf\xd9\x38\xf6\xe3\xc5\x7c\xbd\xc4\xc4\xdb\xcc\xe9\xca\xcd\xc8\xdb\x2d\x20\x01\x6c\xc1\xe3\x18\xe1"
+"\xe1\xc3\x71\xd5\xc6\x03\x67\xd5\xe5\xcd\x69\xbb\x7a\xe1\xd1\xc6\x04\x2e\x00\x2c\x94\x30\xfc\x2d\xc0\x2e\x01\x5c\x00\x03\x57\x00"
+"\x11\x8d\x57\x00\xf0\x11\x83\xd6\xcd\x98\xd6\x30\x6b\xcd\xb1\xd4\xcd\x98\xd6\x38\xf8\xc9\xcd\xb1\xd4\xd2\xb8\xcd\xc9\xcd\xd9\xd9"
+"\x3f\x3e\x0a\xd2\xca\xdb\xef\x02\x30\x3e\xe5\x12\x62\x01\x40\x73\xcd\xcd\xc1\xe0\x06\xf3\x0d\xcd\x5b\xda\xc5\xcd\xc7\xcd\xcd\x60"
+"\xda\xe1\x0a\xbe\xc2\xaf\xcd\xcd\x14\xce\x23\xe5\xcd\x44\xd6\xe1\xc5\x44\x4d\x9d\x00\xa1\x1b\xcd\xd9\xd9\xda\x8d\xd3\xe3\xe5\xc5"
+"\x82\x06\x60\xc1\xe1\xe3\xcd\x7a\xd9\x61\x00\xf1\x09\xe7\xe1\xc9\x50\x59\x3e\x06\xc3\xb1\xcd\xcd\x73\xcd\xd5\xdd\xe1\x01\x00\x08"
+"\xcd\xaf\xca\xcd\x86\x8c\x00\x43\xd0\xdb\xaf\xf5\x41\x00\x12\x0c\xde\x00\xf2\x3b\xcd\xaa\xd5\xe3\x38\xef\x3e\x11\xcd\x72\xd4\x55"
+"\xf1\x1e\x00\x1c\x92\x30\xfc\x82\x20\x01\x1d\xdd\xe5\xe1\x4b\x42\xe5\xcd\x7a\xd5\xd5\xeb\x26\x00\xcd\x3a\xd6\x19\xd1\x10\xf2\xe1"
+"\xd5\x11\x0e\x00\x19\xd1\x0d\x28\x04\x7e\xb7\x20\xe2\xcd\xc2\xd8\x3e\x03\xb7\xc3\xeb\xca\xe7\xb7\xc8\xe5\xd5\xc5\x78\xba\x25\x01"
+"\xf0\x0f\xeb\xcd\xc8\xdb\xcd\xd9\xd9\x3e\x2a\x38\x02\x3e\x20\xcd\x5a\xbb\x21\x0c\x00\x19\xe7\x5f\x23\xe7\x57\x3e\x02\xcd\xeb\xca"
+"\xd4\x0c\xf2\x04\xc5\x4c\x06\x00\xdd\xe5\xe1\xe7\xb7\x28\x50\x04\xcd\x23\xd6\x28\x0f\x30\x26\x59\x00\xd4\x78\xfe\x92\x38\xe9\x18"
+"\x56\xe5\xcd\xf2\xd8\xe3\x11\x37\x00\x10\x2b\x3f\x0b\xf1\x04\x73\x23\x72\x37\x18\x3d\x79\xfe\x92\x28\x38\xe5\xd5\xc5\xeb\x79\x90"
+"\x3c\x6f\x96\x00\xf0\x0b\x44\x4d\x19\x2b\xeb\x21\x0e\x00\x19\xeb\xcd\x1e\xb9\xc1\xd1\xe1\x0c\xc5\xd5\x36\xff\x23\x13\xeb\x01\x0b"
+"\x70\x04\xf0\x00\xeb\xe3\xeb\xcd\xf2\xd8\xeb\xe1\x73\x23\x72\xc1\x37\x61\xc1\xbf\x06\xf0\x01\x06\x0b\x13\x23\x1a\xe6\x7f\x4f\xe7"
+"\xe6\x7f\xb9\x20\x02\x10\xf2\x90\x00\xa3\xd5\x54\x5d\x29\x19\x29\x19\x29\xd1\xc9\x1a\x01\x30\x25\x3e\x05\x3e\x01\x02\xb8\x01\x40"
+"\x18\xe5\x21\x09\x82\x04\xf4\x06\xeb\xcd\xdf\xdb\xe1\xfd\x7e\x05\xb7\x37\xc0\xcd\xa2\xd6\x38\xfb\x37\xfd\x36\x05\xff\x32\x00\xe0"
+"\xf3\xcd\xaa\xd4\x18\xf6\xc5\xcd\x1f\xc5\xc1\x21\xff\xff\x26\x00\x91\xc0\xe5\xcd\x14\xd8\xe1\xc3\xa8\xd9\x6c\x03\x60\xd8\xd7\x30"
+"\xf7\xc9\x23\x18\x00\xf0\x14\x20\x11\xcd\x1c\xd9\xd0\x1a\xfe\xe5\x37\xc8\xcd\xa8\xd9\x3e\xff\xc3\x3c\xd8\xcd\xb8\xd9\xd0\xc3\x1c"
+"\xd9\x21\x21\x00\x19\xc3\xf9\xdb\x21\x23\xad\x05\xf0\x23\xc0\xcd\xc1\xd6\x7c\x1f\x1f\x1f\x1f\xe6\x0f\x47\x29\x7c\xe6\x1f\x4f\xc5"
+"\x21\x0f\x00\x19\x7e\xa8\x20\x0f\x3e\x04\xcd\x54\xda\x2f\x47\x2b\x2b\x7e\xa9\xa0\x20\x01\x37\xc1\x9f\xc9\x21\x0d\x00\x19\x71\x23"
+"\xca\x0c\x20\x01\x11\xaa\x07\x30\xeb\xc9\xd5\x3e\x00\xf0\x37\xe6\x0f\x67\xe5\x21\x10\x00\x19\x4e\x06\x00\x2b\x2b\x2b\x66\x68\x3e"
+"\x01\xcd\xeb\xdb\x09\xd1\x13\xcd\xf3\xdb\x3f\xd1\xc9\xcd\xc1\xd6\x3e\x03\xcd\x54\xda\xa5\x4f\x3e\x02\xcd\x54\xda\xcd\xeb\xdb\x3e"
+"\x06\xcd\x54\xda\x47\xb7\x7d\x21\x11\x00\x19\x28\x0e\xe6\x07\x87\x85\x6f\x8c\x95\x67\xae\x06\x42\x18\x0b\xe6\x0f\x0d\x00\x81\x6e"
+"\x26\x00\x7c\xb5\x28\x0f\xf1\x34\x00\xb0\x29\x3d\x20\xfc\x79\xb5\x6f\x37\xc9\xe1\xc9\x68\x00\xf0\x03\x7e\x34\xb7\xf0\x36\x01\x2b"
+"\x2b\x2b\x34\xc9\xd5\xd5\xcd\xbb\xd7\xe3\x23\x32\x01\x50\xcd\x7a\xd9\xd1\xc9\xdb\x00\x61\xaf\x77\x23\x77\x23\x77\x0b\x00\x30\x34"
+"\xc0\x23\x03\x00\x03\x3d\x01\xf0\x05\x18\x11\x21\xff\xff\x23\xcd\x1c\xd9\x3e\x07\xd2\xb1\xcd\x1a\xfe\xe5\x20\xf2\xf5\x2a\x01\xf3"
+"\x18\x3e\x09\xca\xb8\xcd\xf1\xc9\xc5\xd5\xe5\x60\x69\x1a\xae\x20\x2d\x23\x13\x06\x0b\x7e\xfe\x3f\x28\x06\x1a\xae\xe6\x7f\x20\x1e"
+"\x23\x13\x10\xf1\x7e\x3c\x28\x0c\x10\x01\xf2\x24\x1a\xae\xa0\x20\x0a\x23\x13\x23\x13\x7e\x3c\x28\x02\x1a\xae\xe1\xd1\xc1\xc0\x37"
+"\xc9\x3e\x05\xcd\x45\xda\x3e\x03\xcd\xeb\xdb\x23\xeb\x3e\x0e\xcd\x3f\xda\x36\x00\x23\x1b\x7a\xb3\x20\xf8\x3e\x09\xcd\x45\xda\x13"
+"\x00\x00\xf9\x0d\x40\xe5\xd5\xc5\x4f\xc3\x00\x41\x06\x10\x5e\x23\x07\x01\xb1\xb7\x28\x03\x05\x7e\x23\x57\xb3\x28\x0e\xe5\x44\x00"
+"\xa1\x7d\x93\x7c\x9a\xd4\x6c\xd8\xe1\x10\xdf\x73\x04\x41\xc5\xd5\xd5\xeb\x57\x00\x02\x43\x00\xf1\x0b\x19\xd1\x7b\xe6\x07\x5f\x3e"
+"\x01\x1c\x0f\x1d\x20\xfc\x47\xa1\x4f\x78\x2f\xa6\xb1\x77\xd1\xc1\xc9\xc5\xd5\x3d\x00\x02\x25\x00\xf1\x07\x01\x80\x08\x7e\xa1\x28"
+"\x0c\x0f\x4f\x7a\xb3\x28\x12\x1b\x10\xf3\x23\x18\xed\x7e\xb1\x77\x21\x00\x40\xb7\xed\x52\x37\x2f\x00\x00\xdc\x05\x02\x70\x00\x07"
+"\x33\x00\x61\x20\x03\xe3\x23\xe3\x79\x37\x00\xf0\x01\x06\x1b\x10\xef\x23\x18\xe9\xe1\xcd\x10\xd9\xeb\xe1\xc1\xc9\xd5\xb3\x00\x32"
+"\x11\x00\x10\xb2\x00\xf1\x01\x7e\x23\x28\x03\xb6\x15\x23\xb7\x28\x01\x1c\x15\x20\xec\xeb\xd1\xa3\x01\xe0\x3d\x3d\x3d\xc8\x29\x18"
+"\xfb\xe5\xc5\x7d\xe6\x03\x20\x11\x12\x09\x20\x45\xda\x00\x02\xf0\x0c\xeb\x30\x15\xcd\x48\xd9\xaf\x47\x3e\x08\xcd\x3f\xda\x11\x20"
+"\x00\x04\x18\x01\x19\x10\xfd\xeb\x37\xc1\xe1\xc9\xa7\x03\x21\xdb\xeb\x19\x00\x50\xcd\xe8\xd9\x3e\x0b\x29\x01\xf7\x11\xcd\xf3\xdb"
+"\xeb\xd0\x3e\x0c\xcd\x3f\xda\x19\xcd\xc8\xd9\xbe\xc8\xf5\xeb\x29\x29\xcd\xb8\xd9\xeb\xd1\xda\x33\xd2\x72\xc9\xe5\xc5\x34\x00\x47"
+"\x0e\x01\xcd\xf3\x36\x00\x25\x30\x0a\x37\x00\xf0\x01\x77\xc1\xe1\xcd\xb8\xd9\xd8\xd5\xe5\xeb\x13\x3e\x02\xcd\x35\xda\x09\x0b\x51"
+"\xd1\x37\xc9\xd5\xe5\x0e\x00\x40\x5e\x23\x56\xe1\xb8\x0a\x51\xc9\xc5\xe5\x06\x80\x7e\x00\x51\xaf\x86\x23\x10\xfc\x47\x0b\xc0\x09"
+"\x00\x18\x04\xe5\x21\x0a\x00\x19\x7e\x87\xe1\x10\x02\xf1\x52\xcd\x06\xda\xcd\x4c\xc5\x18\x0b\xc5\xd5\xe5\xc5\xcd\x06\xda\xc1\xcd"
+"\x2e\xc5\xb7\xc2\xb6\xcd\xe1\xd1\xc1\xc9\xd5\x44\x4d\xcd\x1a\xc5\xd1\x3e\x0d\xcd\x45\xda\x44\x4d\xaf\xcd\x45\xda\x0b\x03\x7b\x95"
+"\x5f\x7a\x9c\x57\x30\xf7\x19\xe5\xcd\x24\xc5\xc1\xaf\xcd\x3f\xda\xeb\xcd\x5a\xc5\x4d\x44\xc3\x29\xc5\xfd\x86\x03\x6f\xfd\x8e\x04"
+"\x95\x67\xc9\xcd\x35\xda\xc3\xf9\xdb\xf5\x3e\x0a\xcd\x3f\xda\xf1\xed\x02\x70\xc3\xf9\xdb\xe5\xcd\x45\xda\x4e\x14\xf0\x06\xe4\x00"
+"\x18\x03\x11\xf4\x00\x0e\x20\xcd\x74\xda\x18\x2b\xcd\x6f\xda\x18\x26\x0e\xff\xdb\x08\xf2\x0b\xa0\xda\xc5\x16\x0b\x03\x03\x0a\xfe"
+"\x3f\x28\x69\x15\x20\xf7\xc1\xc9\x06\x00\xcd\xa6\xda\x18\x08\x0e\x20\x1e\x00\x24\x21\x0d\xbb\x07\x72\xc9\xcd\xb6\xda\x28\x45\xc9"
+"\x19\x00\xf0\x19\xb6\xda\xc5\x0e\x0b\xcc\x8e\xdb\xc1\xc9\xe5\xcd\x98\xca\xd5\xfd\x7e\x00\x12\x13\xfd\x7e\x01\x12\x13\xc5\x41\x0e"
+"\x08\xcd\x85\xdb\x78\x0e\x03\xcd\x90\xdb\x01\x03\xce\x03\xf0\x3e\xc1\xd1\xe1\xd5\xcd\xed\xda\xd1\x30\x08\x42\x4b\x13\x13\x1a\xfe"
+"\x20\xc9\xc3\xaf\xcd\x2b\xcd\x97\xdb\x3f\xd8\x4f\xe5\xc5\xfe\x3a\x28\x06\xcd\xa5\xdb\x38\xf7\x37\xc1\xe1\x79\x38\x3e\x13\xfe\x30"
+"\x38\x1f\xfe\x3a\x30\x1b\xd6\x30\x4f\x12\xcd\xa5\xdb\xfe\x30\x38\x10\xfe\x3a\x30\x0c\xb7\x0d\xc0\xc6\xda\xfe\x10\xd0\x14\x00\xb0"
+"\x1b\xfe\x51\x30\x0a\xfe\x41\x38\x06\xd6\x41\x0f\x00\x61\xcd\x9b\xdb\xee\x3a\xc0\x50\x00\xd0\x13\x13\xfe\x2e\xc8\x0e\x08\xcd\x58"
+"\xdb\xd8\xee\x2e\x13\x00\xf1\x3c\x0e\x03\x30\x2d\xfe\x20\x38\x29\xe5\xc5\x47\x21\xb2\xdb\x7e\x23\xb7\x28\x04\xb8\x20\xf8\x37\x78"
+"\xc1\xe1\x38\x15\x0d\xf8\xfe\x2a\xcc\x8e\xdb\x12\x13\xcd\xa5\xdb\x30\x07\xfe\x20\x20\xd6\xcd\x9b\xdb\xf5\x3e\x20\xcd\x90\xdb\xf1"
+"\x3f\xc9\x3e\x3f\x0c\x0d\xc8\x12\x13\x18\xfa\xcd\xa5\xdb\xd0\xfe\x20\x37\xc0\xa5\x00\xf0\x27\xc9\x78\xb7\xc8\x23\x05\xe7\xe6\x7f"
+"\xcd\xa6\xca\x37\xc9\x3c\x3e\x2e\x2c\x3b\x3a\x3d\x5b\x5d\x5f\x25\x7c\x28\x29\x2f\x5c\x7f\x00\x3e\x01\x18\x02\x3e\x0b\xc5\xfd\x4e"
+"\x02\x18\x0a\xc5\x0a\x5f\x16\x00\x0b\x0a\x4f\x3e\x0c\x37\x06\x00\xbc\x05\x50\x01\x20\x00\xed\xb0\xb1\x05\xf0\x00\xcb\x3c\xcb\x1d"
+"\x3d\x20\xf9\xc9\xe5\xb7\xed\x52\xe1\xc9\xd5\x82\x17\x14\xd1\x77\x11\x03\x6e\x0f\x0f\x07\x00\xff\xff\xff\xe2\xf1\xcb\xc3\xfb\xec"
+"\xc3\xea\xec\xc3\x26\xed\xc3\x15\xed\xc3\xa9\xef\xc3\xbb\xef\xc3\xb5\xef\xc3\xd3\xed\xc3\xb0\xed\xc3\x1d\xee\xc3\x66\xee\xc3\x7d"
+"\xee\xc3\x45\xef\xc3\xa2\xee\xc3\xc6\xef\xc3\xce\xef\xc3\xd8\xef\xc3\xd2\xef\xc3\xf2\xef\xc3\x16\xf0\xc3\x32\xf0\xc3\x5c\xf0\xc3"
+"\x85\xf0\xc3\xae\xf0\xc3\x13\xef\xc3\x46\xef\xc3\x76\xef\xc3\xb0\xec\xc3\xb6\xe1\xc3\xf1\xe1\xc3\x70\xe2\xc3\x77\xe2\xc3\x83\xe2"
+"\xc3\x8f\xe2\xc3\x98\xe2\xc3\x9f\xe2\xc3\xae\xe2\xc3\xb5\xe2\xc3\xbc\xe2\xc3\xd5\xe2\xc3\xe4\xe2\xc3\xec\xe2\xc3\xfb\xe2\xc3\x0a"
+"\xe3\xc3\x13\xe3\xc3\x39\xe3\xc3\x40\xe3\xc3\x97\xe3\xc3\xb8\xe3\xc3\xd6\xe3\xc3\xfd\xe3\xc3\x03\xe4\xc3\x9a\xe4\xc3\xcd\xe4\xc3"
+"\xd3\xe4\xc3\xd9\xe4\xc3\x3c\xe5\xc3\x64\xe5\xc3\x72\xe5\xc3\x80\xe5\xc3\x87\xe5\xc3\x8e\xe5\xc3\xa4\xe5\xc3\xbd\xe5\xc3\x73\xe7"
+"\xc3\x8d\xe8\xc3\x45\xec\xc3\x9a\xff\xc3\xaa\xff\xc3\xb2\xff\xc3\xc6\xff\xc3\xd0\xff\xc3\xa1\x0c\x00\xf0\xd7\xeb\xff\xc3\x24\xfb"
+"\xc3\x90\xff\xc3\x74\xfc\xc3\x57\xfc\xc3\xdc\xfa\xc3\xec\xfa\xc3\x0f\xf3\xc3\xe4\xf3\xc3\x83\xf5\xc3\xb3\xf5\xc3\x09\xf2\xc3\xfb"
+"\xf1\xc3\xf4\xf1\xc3\x95\xf5\xc3\xe4\xf4\xc3\xb5\xf2\xc3\x7b\xf2\xc3\x4a\xf2\xc3\x08\xf3\xc3\x28\xf2\xc3\x89\xf7\xc3\x55\xfb\xc3"
+"\xcb\xf5\xc3\x54\xfb\xc3\xbc\xfb\xc3\xed\xfa\xc3\x83\xf7\xc3\xde\xfb\xc3\x4e\xfc\xc3\xaa\xf5\xc3\x9e\xf5\xc3\x8c\xf5\xc3\x30\xfb"
+"\xc3\x18\xfc\xc3\xbf\xf5\xc3\x0a\xfb\xc3\x3d\xfb\xc3\x3e\xfb\xc3\x08\xfc\xc3\x6a\xfb\xc3\x44\xfc\xc3\x4f\xfc\xc3\xbd\xf2\xc3\x61"
+"\xff\xc3\x74\xff\xc3\xd4\xfb\xc3\x1d\xfc\xc3\xe4\xfa\xc3\xe6\xfb\xc3\x45\xfc\xc3\x02\xf2\xc3\xa6\xf2\xc3\xee\xfb\xc3\x6c\xfc\xc3"
+"\x1d\xfb\xc3\xa4\xf1\xc3\xb9\xf1\xc3\x87\xff\xc3\x8e\xfc\xc3\x8c\xfc\xc3\xf2\xf0\xc3\x7f\xf1\xc3\x2b\xf1\xc3\x50\xf1\xc3\xac\xfa"
+"\xc3\x58\xfa\xc3\x82\xfa\xc3\x94\xfc\xc3\x66\xf8\xc3\xb0\xfd\xc3\xe2\xfd\x21\x00\x00\x22\x64\x04\x22\x60\x04\x2a\x97\x01\x2b\x22"
+"\x62\x07\x00\x80\x22\x68\x04\xcd\xd4\xfb\x22\x6a\x0c\x00\xf4\x02\x11\x01\x00\xeb\xcd\xee\xfb\x22\x70\x04\x2a\x99\x01\x22\x78\x04"
+"\x2b\x11\x00\xf2\x14\x72\x04\xc9\xcd\x98\xe2\x11\x01\x00\xcd\x24\xfb\x28\x15\x2a\x99\x01\xeb\x2a\x8d\x01\xcd\x0a\xfb\xe5\xcd\xae"
+"\xe2\x2b\xd1\xcd\xbc\xfb\x18\x03\x32\x00\x33\x2a\x5e\x04\x26\x00\x40\x0d\x2a\x8d\x01\x1f\x00\x66\xe5\xcd\xb0\xed\xd1\xd1\x3e\x00"
+"\x70\x05\xcd\xae\xe2\x18\x03\x21\xe6\x17\xf1\x00\x26\xed\xd1\x2a\x78\x04\x2b\x22\x66\x04\x2a\x78\x04\x22\x6c\x88\x00\xa0\x6e\x04"
+"\xcd\xff\xeb\x28\x03\xcd\xc4\xe5\x4b\x00\x10\x02\x71\x00\xf0\x00\xc8\xcd\x03\xe4\xc9\x2a\x5c\x04\x22\x5e\x04\xc9\xcd\x70\xe2\xc4"
+"\x00\x50\x5c\x04\xc3\xf1\xe1\x0c\x00\x31\x01\x00\x22\x0c\x00\x21\x21\x02\x09\x00\xf0\x01\x15\xed\xcd\x90\xff\x2a\x5c\x04\xc9\xcd"
+"\x90\xff\x21\x08\x00\x39\xac\x06\x21\x22\x5a\x0f\x00\x13\x2a\x07\x00\x11\x58\x0e\x00\x35\xcd\x73\xe7\x20\x00\xf1\x0c\x58\x04\xe5"
+"\xcd\x45\xef\xd1\xc3\x73\xe7\x21\x01\x00\x7d\x32\x55\x04\xcd\x39\xe3\x7d\x32\x54\x04\xc9\x21\x00\x0f\x00\x31\xc9\x21\x03\x08\x00"
+"\x32\xcd\xb5\xe2\x17\x00\x12\x02\x0f\x00\x03\x26\x00\x00\x72\x00\x40\x55\x04\x26\x00\x74\x00\x08\x57\x00\xa0\x56\x04\xcd\x73\xe7"
+"\xcd\x0a\xe3\x11\x03\xc5\x00\x41\xc0\x2a\x56\x04\x3e\x00\x00\x2f\x00\x11\x56\x84\x00\xe1\x21\xf3\x01\xcd\x09\xf2\xcd\x4a\xf2\xcd"
+"\xb0\xfd\xcd\x87\xb0\x00\x90\xcd\xfb\xf1\xcd\xe4\xf4\x21\xe7\x01\x09\x00\x56\x0f\xf3\xcd\x4a\xf2\x25\x00\x11\xe2\x25\x00\x30\x10"
+"\x00\x39\x1c\x00\x46\xe4\xf4\x21\xdf\x25\x00\x30\xcd\x8d\xe8\x57\x19\x20\x39\xf9\x84\x00\x10\x21\x23\x00\x01\x58\x00\x06\x0a\x00"
+"\x0a\x21\x00\x01\x78\x00\x00\xff\x00\x00\x4a\x00\x01\x66\x00\x70\xcd\xd6\xe3\xeb\xcd\x87\xff\x3f\x00\x00\xc3\x00\x20\xf3\x01\x00"
+"\x0a\x13\x39\x9e\x00\xf0\x00\x45\xec\xcd\x87\xff\xe1\xcd\x28\xf2\xcd\x89\xf7\x22\xfb\x01\x28\x01\xa0\xf3\x01\xc3\x09\xf2\x2a\x66"
+"\x04\xe5\x2a\x3d\x01\x30\xa2\xee\xd1\x3e\x01\x00\x74\x01\x05\x7c\x00\x60\xcd\x02\xe7\xcd\x87\xff\xc1\x00\x0e\x13\x00\x32\xcd\xd9"
+"\xe4\xaf\x00\xd0\x2a\x76\x04\xe5\x2a\x74\x04\xe5\xcd\x1c\xec\xd1\xd1\xf8\x01\xf0\x12\x42\x2a\x97\x01\xed\x5b\x74\x04\xcd\x6a\xfb"
+"\x22\x74\x04\x11\x00\x00\xeb\xcd\x54\xfb\x28\x0b\x2a\x97\x01\xeb\x2a\x74\x04\x19\x22\x74\x2a\x02\x31\xed\x5b\x76\x21\x00\x17\x76"
+"\x21\x00\x92\x78\x04\xeb\x2a\x76\x04\x19\x22\x76\x5a\x01\x05\x74\x00\x07\x03\x01\x14\x13\x75\x00\x35\x54\x04\xe5\x79\x00\x80\xda"
+"\xec\xd1\xd1\xd1\xc9\x21\xdf\xd0\x00\x20\x21\xe7\x06\x00\xf0\x06\xcd\xed\xfa\xf0\xff\x21\x18\x00\x39\xe5\x2a\x70\x04\xcd\xcb\xf5"
+"\xcd\xa6\xf2\xe1\xe5\x0a\x01\x20\x0f\xf3\x04\x01\x20\x21\x20\x1a\x00\x10\x72\x1a\x00\x22\x21\x22\x8c\x01\x12\x08\x19\x00\x24\x18"
+"\x00\x31\x01\x20\xc8\xe6\x4d\x01\x40\xeb\x22\x74\x04\x2e\x00\x00\x3c\x00\x34\x4a\xf2\xcd\x15\x00\x30\x76\x04\xc9\xe0\x01\x02\xa1"
+"\x01\x14\xdf\x02\x02\x05\x12\x01\xf0\x01\x74\x04\x22\xef\x01\x2a\x76\x04\x22\xf1\x01\xc9\xcd\x80\xe5\xc8\x8f\x01\x41\x00\x00\x22"
+"\xfd\x0e\x00\x30\xc0\x21\x01\x0b\x00\x30\xcd\x73\xe7\xaa\x01\x30\x2a\xfd\x01\xa3\x02\x20\x22\xff\x04\x11\x00\xbc\x02\x81\x22\xff"
+"\x01\x2a\x78\x04\x7c\xb5\x3f\x03\xf0\x06\xc3\x73\xe7\x2a\xf1\x01\xe5\x2a\xef\x01\xe5\xcd\xb0\xec\xd1\xd1\x28\x03\xcd\x51\x04\x27"
+"\x03\x00\x2f\x00\xa0\x90\xff\x2a\xff\x01\xc9\x18\x03\xcd\x3c\x21\x00\x04\x68\x01\x18\x30\x99\x00\x4e\xe5\x2a\x97\x01\xff\x00\x00"
+"\xae\x02\x04\xac\x00\x24\x18\xc1\x41\x00\x10\xeb\x2c\x00\x3f\x3d\xfb\x28\x41\x00\x0a\x02\x27\x01\x0f\x41\x00\x01\x10\xf1\x1a\x24"
+"\x01\xea\x01\x00\x41\x00\x30\xe5\x2a\x78\x5e\x01\x05\x78\x01\x05\x38\x00\x00\xf2\x02\x01\x37\x01\x05\x40\x02\x04\x82\x00\x30\xf1"
+"\x01\xeb\x35\x00\x6c\x3d\xfb\xc8\x21\xe7\x01\x40\x00\x02\xb8\x01\x00\x8a\x02\x0d\x6e\x01\x20\x18\xc2\x48\x01\x01\x0a\x03\x41\x09"
+"\xf2\x21\xcf\x51\x03\xa1\xaa\xf5\x28\x0d\xcd\x02\xf2\x40\x80\x00\x01\x00\x71\x18\x0b\xcd\x02\xf2\xc0\x7f\xe1\x0a\x11\xb8\x2a\x00"
+"\x80\xfb\xf1\xcd\x0f\xf3\xc3\x89\xf7\xef\x02\x12\x08\xf4\x01\x42\xf4\xf1\xc2\x3e\x30\x00\x51\xcd\xaa\xf5\x28\x1e\x27\x00\x64\x09"
+"\xf2\xcd\xf4\xf1\x42\x17\x00\x40\x9e\xf5\x28\x07\x17\x00\x00\x38\x06\x23\x51\x04\x3b\x00\xf1\x0a\x4e\x23\x46\x60\x69\x11\x80\x00"
+"\xcd\xdc\xfa\x28\x0a\x21\x00\xff\x50\x59\xcd\xe6\xfb\x44\x4d\x21\x0a\xb9\x04\x21\x21\x02\x19\x00\x90\x06\x60\x69\xcd\xd4\xfb\xc9"
+"\x60\x69\xab\x00\x01\x12\x02\x00\x78\x04\xf0\x04\x01\x02\x2a\xfb\x01\x23\x23\x23\x11\x06\x00\xeb\xcd\x0a\xfb\x11\x0f\x00\xeb\x34"
+"\x03\x23\x9c\x04\x17\x00\x11\x5a\x17\x00\x21\x22\x9a\x8e\x05\xf0\x01\xdc\xfa\x28\x0c\x2a\x9c\x04\x11\x0f\x00\xcd\x6c\xfc\x22\x9c"
+"\x04\x0c\x00\xf1\x26\x06\x00\xcd\xbc\xfb\x11\x28\x01\x19\x22\x98\x04\x2a\xef\x01\x22\x88\x04\x2a\xf1\x01\x22\x8a\x04\x21\x8c\x04"
+"\x44\x4d\x18\x08\x21\x04\x00\x50\x59\x19\x44\x4d\x50\x59\x21\x98\x04\xcd\x4e\xfc\x28\x7b\x21\xfc\xff\x09\x4f\x05\x43\x7a\x04\x21"
+"\xfe\x0b\x00\xf0\x15\x7c\x04\x2a\x9a\x04\xe5\x2a\x98\x04\x23\x22\x98\x04\x5e\x16\x00\xd5\xcd\x3d\xe7\xd1\xd1\xeb\x2a\x88\x04\x19"
+"\xeb\x60\x69\x73\x23\x72\xeb\x22\x7e\x23\x00\x1f\x23\x24\x00\x00\x70\x8a\x04\x19\xeb\x21\x02\x00\x5a\x18\xf0\x02\xeb\x22\x80\x04"
+"\x2a\x01\x02\xe5\x2a\x80\x04\xe5\x2a\x7e\x04\xe5\xcd\x96\x03\xf0\x0b\x2a\x01\x02\xe3\xcd\xb0\xe9\xd1\xc3\xdf\xe7\x2a\x94\x04\x22"
+"\x7a\x04\x2a\x96\x04\x22\x7c\x04\x2a\x88\x04\x54\x00\x23\x8a\x04\x34\x00\x00\x23\x00\x00\x1a\x01\x07\xe9\x03\x0f\x7a\x04\x1f\x20"
+"\x73\xe7\x03\x01\x11\x7a\x03\x01\x31\x7c\x04\x2a\x84\x03\x00\x66\x00\x01\x87\x03\x55\x22\x80\x04\x21\xdf\x11\x05\x01\x04\x04\x51"
+"\xe7\x01\xe5\x21\x12\xfb\x01\x00\x0f\x00\xf0\x01\xcd\xff\xeb\xca\xa0\xe9\xcd\x0a\xe3\xca\x9b\xe9\x2a\x54\x04\xe5\x93\x00\x20\x22"
+"\x9e\x7a\x01\x00\x4d\x07\x25\x44\x4d\x6d\x04\x01\x87\x03\x31\x61\x2a\x7e\xce\x00\x11\x80\xce\x00\x60\x9e\x04\x29\x11\x68\x04\x26"
+"\x1a\xd1\xd5\x21\x7a\x04\x09\x09\xd1\xe5\x7e\x23\x66\x6f\x19\x45\x13\x00\x88\x00\x20\x7e\x04\x0c\x04\x38\x80\x04\x2a\x29\x00\x1c"
+"\x7e\x29\x00\x20\x7e\x04\x1a\x05\xf4\x03\x80\x04\x22\x76\x04\xc3\x17\xe9\xcd\xc4\xe5\x18\x0d\xcd\x0a\xe3\x28\x08\x8e\x00\x30\xc3"
+"\x73\xe7\x73\x02\xb0\xff\xff\x22\x86\x04\x22\x84\x04\x22\xa2\x04\x45\x07\xf1\x02\x82\x04\x21\xff\xff\x22\xa0\x04\x2a\xa0\x04\x23"
+"\x22\xa0\x04\x11\x02\x6e\x05\xb3\xca\x57\xea\x21\xff\xff\x44\x4d\x03\x60\x69\x12\x00\x82\x28\x67\x60\x69\x29\x29\x11\x60\xa7\x00"
+"\xd1\x60\x69\x29\xe5\x2a\xa0\x04\x29\x29\xd1\x19\x11\x7a\x13\x00\x51\xeb\x22\xa4\x04\xd1\xbf\x03\x10\x14\xd7\x07\xf1\x01\xc5\x2a"
+"\xa0\x04\xe5\xcd\xa1\xea\xd1\xd1\xd1\x22\xa2\x04\x18\x28\x3d\x00\x11\x62\x2a\x00\x21\xd5\x2a\x2a\x00\x8b\x55\xfb\x28\x12\x21\x01"
+"\x00\xe5\x2a\x00\xf0\x02\x8d\xc3\xcb\xe9\x2a\x82\x04\x7c\xb5\x20\x3f\x2a\x7c\x04\xe5\x2a\x7a\x4b\x01\x55\xec\xd1\xd1\x20\x30\x19"
+"\x02\x00\x42\x01\x20\x20\x21\x49\x03\x00\x25\x29\x04\x17\x00\x05\x2e\x00\x30\x7d\xee\xeb\x3d\x03\x32\xf9\x2a\xa2\x07\x06\x63\x0a"
+"\x00\x39\x4e\x23\x46\x2f\x00\x41\xeb\x22\xa8\x04\xbd\x00\x10\xa8\x9b\x01\x37\xcd\x18\xfc\xc3\x00\x13\xd5\x19\x00\x07\x13\x00\xe1"
+"\xe1\xcd\x18\xfc\x22\xaa\x04\x7c\xb5\xca\xa7\xeb\x2a\xaa\x92\x04\x80\x4a\xf2\x21\x01\x00\x50\x59\xeb\x3c\x00\x38\xe5\x2a\xa8\x04"
+"\x01\x1a\xd5\x1a\x00\x00\x04\x09\x09\x61\x00\x00\x4e\x00\x00\x4e\x05\x41\x4a\xf2\x21\x1c\xde\x03\x30\xeb\x29\xe5\x19\x01\x23\xd1"
+"\x19\x58\x01\x40\xeb\x22\xac\x04\x12\x00\x0b\x58\x00\x04\x38\x00\x60\x7b\xf2\xcd\xe4\xf4\xcd\x06\x00\x00\x15\x08\x03\x4d\x06\x0b"
+"\x75\x00\x04\xbd\x00\x09\x44\x02\x0e\x56\x00\x00\x8a\x21\x81\x60\x69\x29\xeb\x21\x0c\x00\x39\x6d\x02\x70\x22\xa6\x04\xeb\x2a\x84"
+"\x04\xdb\x09\x10\x06\x61\x06\x30\x82\x04\x2a\x12\x00\x19\x86\x12\x00\x40\x84\x04\x22\x86\x18\x00\x20\x22\x84\x06\x00\x00\x72\x03"
+"\x30\x2a\xff\x01\xe7\x00\x41\x24\xfb\x28\x07\x76\x06\x10\x20\x55\x02\x31\xc9\x21\x01\x09\x09\x00\x1d\x00\x01\xbd\x09\x20\x28\x1a"
+"\x92\x01\x00\xae\x01\x04\x08\x00\x06\x8e\x06\x00\x46\x00\x00\x9d\x01\x54\xcd\x09\xf2\x21\xc7\x7d\x05\x10\x1c\x12\x00\x10\xe5\x10"
+"\x00\x2b\x09\xf2\x04\x06\x20\x18\xd2\x1c\x00\x00\x50\x07\x21\xf4\xf1\x9d\x05\x7f\x00\x00\x00\xcd\x95\xf5\x28\x33\x00\x02\x02\xf7"
+"\x05\x20\x18\xcd\x33\x00\x61\xc3\x09\xf2\xc5\x21\x04\x78\x01\x00\x8c\x1d\xf0\x29\x2a\x66\x04\x7c\x17\x38\x11\xed\x42\x38\x0d\x2a"
+"\x62\x04\xed\x52\x38\x06\xc1\x21\x00\x00\xa5\xc9\xc1\x21\x01\x00\xb5\xc9\xe1\x22\xae\x04\xcd\xb0\xec\x20\x03\xcd\x66\xee\x2a\xae"
+"\x04\xe9\x3a\x49\x00\xcd\x9b\xbe\x0e\xbc\x3a\x4a\x08\x00\xa0\x9e\xbe\xc7\xaf\x32\x48\x00\x3d\x32\x40\x0e\x00\xf0\x09\x11\xbc\x32"
+"\x49\x00\xaf\xcd\x9b\xbe\x9e\xbe\x32\x4a\x00\xc9\xc5\x3a\xb8\x01\xcd\x34\xee\x3e\x81\x1e\x00\x41\x50\xee\xc1\xc9\x76\x00\xf0\x54"
+"\x3a\x40\x00\xbe\xca\xae\xed\xe5\xf5\xcd\x43\xee\xf1\xb7\x3a\xb7\x01\xfc\x34\xee\xcd\x9b\xbe\x78\xbb\x3a\x40\x00\xe6\x7f\x3d\x85"
+"\x6f\xe3\x7e\x32\x40\x00\xd6\x01\x6f\xd2\x59\xed\x2e\x18\x3a\x47\x00\x67\x16\x00\x1e\x18\xcd\x9b\xbe\x66\xbb\xe1\xcd\x24\xee\x21"
+"\xc7\x00\x22\x4b\x00\x21\x00\x00\x11\x8f\x01\x3a\x40\x00\xb7\xca\x8c\xed\x6f\x29\x29\x29\x2b\x22\x4b\x00\x23\x29\x2b\xcd\xc5\xf0"
+"\x19\x22\x4d\x8c\x00\xf0\x05\xd2\xbb\x2a\x4b\x00\x23\xcd\xc5\xf0\x11\x90\x01\x19\x11\x40\x01\xcd\x9b\xbe\xc9\x63\x00\x21\xb7\xc4"
+"\x8a\x00\xf0\x0f\xcd\x43\xee\xcd\x5d\xee\xcd\xfd\xed\xda\xce\xed\xc2\xc8\xed\xcd\x9b\xbe\x6c\xbb\xc3\xce\xed\x78\xcd\x9b\xbe\x44"
+"\xbc\xcd\x23\x00\x00\x5d\x00\x26\xc8\xc5\x28\x00\x70\xf8\xed\x78\x06\xff\xc2\xf3\x2b\x00\x40\x4d\xbc\xc3\xf8\x08\x00\x12\x50\x2a"
+"\x00\xf2\x18\xcd\x9b\xbe\x99\xbb\xcd\x9b\xbe\x2c\xbc\x47\x1d\x2d\x26\x00\x3a\x47\x00\x57\x3e\x18\xbd\xd8\xbb\xd8\x7b\xee\x18\xc0"
+"\x7d\xb7\xc9\xc5\xcd\x5d\xee\xc1\x65\x6b\xe0\x00\xa1\x5f\x7d\x93\x6f\xcd\x9b\xbe\x75\xbb\xc9\x47\x01\xf2\x07\xcd\x9b\xbe\x69\xbb"
+"\x7a\x32\x47\x00\xc9\x21\x48\x00\x7e\xb7\xc0\x35\xcd\x9b\xbe\x7e\xbb\x0d\x00\x80\xc8\x34\xcd\x9b\xbe\x7b\xbb\xc9\xb4\x01\x50\x5e"
+"\x2b\x2b\x6e\xc9\x9b\x1b\xf0\x02\x39\xcd\xd6\xee\xcd\xf3\xee\xd5\xcd\x02\xef\xe1\xcd\x9b\xbe\xea\xbb\x57\x01\x27\x0d\x00\x17\x00"
+"\x77\xe3\xcd\x9b\xbe\xc0\xbb\xe1\x25\x00\x11\xf6\x25\x00\x70\x07\x00\x39\xcd\x0d\xef\xeb\x13\x01\xf0\x07\x8f\x01\xd5\x19\xeb\x2a"
+"\x4d\x00\xeb\xcd\xb9\xf0\xd2\xbf\xee\xeb\xd1\xd5\xcd\x9b\xbe\xd2\xc4\x00\x43\xdb\xbb\xd1\x2a\x40\x01\xf0\x0b\xc1\xc9\xcd\x0d\xef"
+"\x7a\x3d\xfe\x01\xca\xe1\xee\xaf\xe5\xcd\x9b\xbe\x59\xbc\xe1\x7b\xcd\x9b\xbe\xde\xbb\x68\x09\x00\x1d\x00\x40\xe5\x2a\x4b\x00\x50"
+"\x00\x00\x63\x24\x70\xcd\x0d\xef\xe5\x21\xc0\xfe\x0b\x00\x92\x56\x2b\x5e\x2b\x7b\xc9\xc5\x21\x0b\x96\x00\x37\x0d\xef\xd5\x8c\x00"
+"\xf0\x04\xc0\xbb\x3e\xff\xcd\x9b\xbe\x63\xbb\xe1\x7e\x23\xb7\xc4\x5a\xbb\xc2\x34\xef\x32\x02\x43\x63\xbb\xc1\xc9\x33\x00\xc2\x6c"
+"\xef\x47\xcd\x6c\xef\x4f\x87\x87\x87\x81\x80\x0a\x00\xc1\x81\x80\x47\x4f\xcd\x0d\xef\xcd\x9b\xbe\x32\xbc\x96\x00\xa1\xe6\x03\xfe"
+"\x03\xd8\xaf\xc9\xc5\x21\x05\xd4\x00\xf0\x0d\xcd\x9b\xbe\x35\xbc\x21\x41\x00\x3e\x06\x36\x00\x23\x3d\xc2\x88\xef\x68\x26\x09\xcd"
+"\xcf\xf0\x32\x43\x00\x26\x03\x08\x00\xf1\x0e\x41\x00\x7d\x32\x45\x00\x21\x41\x00\xc1\xc9\x11\x07\x00\x21\x04\x00\xcd\xde\xef\x26"
+"\x00\xc9\x11\x04\x00\xc3\xdb\xef\xe8\x01\x20\x11\x0a\x0b\x00\xe0\x2e\x07\xe5\xcd\xbb\xef\xe1\xc9\x2a\x06\x00\xc9\x11\x2b\x12\x00"
+"\xb0\x11\x0d\x00\x21\x02\x00\x39\xc5\x4e\x2a\x01\x50\x20\xb0\x66\x6f\xcd\xf1\xef\x6f\x67\xb7\xc1\xc9\xe9\x17\x00\xf0\x0d\xcd\x25"
+"\xf0\x21\x06\xf0\xe6\x0f\x5f\x16\x00\x19\x6e\x26\x00\xc9\xff\x00\x04\xff\x06\x07\x05\x06\x02\x01\x03\x02\x0c\x00\x04\x24\x00\xf0"
+"\x03\x00\x00\xe6\x30\xc8\x23\xc9\xeb\xcd\x9b\xbe\x24\xbb\xeb\x7e\xb7\x7a\xc8\x1f\x01\x02\xbc\x00\xf0\x02\x21\xf6\xff\x39\xf9\xe5"
+"\x06\x09\x1a\x77\x13\x23\x05\xc2\x42\xf0\xe1\x6a\x01\xb0\xaa\xbc\xd2\x4c\xf0\xe1\x11\x0a\x00\x19\xf9\xdf\x01\x03\x2a\x00\x11\xee"
+"\x2a\x00\x12\x11\x2a\x00\xef\x6c\xf0\xe1\xe5\x7e\x23\xcd\x9b\xbe\xbf\xbc\xe1\x11\x12\x29\x00\x08\x14\x95\x29\x00\x17\xbc\x29\x00"
+"\xf0\x33\x04\x00\x39\x7e\xcd\xb3\xbc\xc1\xc9\xc5\x47\x7c\xba\xc2\xc2\xf0\x7d\xbb\x78\xc1\xc9\xf5\x7c\x2f\x67\x7d\x2f\x6f\x23\xf1"
+"\xc9\x7c\xb7\xc8\xc5\x06\x08\x4c\x26\x00\xb7\x7d\x17\x6f\x7c\x17\x67\xb9\xda\xe9\xf0\x91\x67\x7d\xf6\x01\x6f\x05\xc2\xd8\xf0\x7d"
+"\x6c\xc1\x37\xc9\xdc\x00\x80\xc5\x01\xff\x7f\x5e\x23\x56\x23\x38\x05\xf0\x05\x78\xb1\xca\x16\xf1\x1a\xbe\xc2\x1b\xf1\xb7\xca\x16"
+"\xf1\x23\x13\x0b\xc3\x02\xf1\x48\x04\x50\xc9\xc1\xda\x25\xf1\x4a\x0e\x78\xb4\xc9\x21\xff\xff\x7d\xb4\x39\x00\x14\xd5\x3a\x00\x71"
+"\x4d\xf1\x7e\x12\xb7\xca\x4d\x37\x00\x41\x3c\xf1\xe1\xc1\x25\x00\x00\x56\x00\xe4\x11\x00\x00\xaf\xbe\xca\x65\xf1\x13\x23\xc3\x5c"
+"\xf1\xeb\x3e\x00\x00\x40\x05\x00\x30\x2f\x00\xbe\x04\x50\xeb\xd1\xc3\x02\xf1\x89\x00\x03\xd2\x04\x02\x54\x00\xf0\x08\xeb\x78\xb1"
+"\xca\x4d\xf1\x7e\xb7\xca\xa0\xf1\x23\x0b\xc3\x91\xf1\xeb\xc3\x3c\xf1\xd1\xe1\xe5\x41\x23\x60\xd5\xeb\x21\x00\x00\x39\x73\x27\x60"
+"\xaf\x67\x6f\xc9\xe1\xe1\xc1\x00\x00\xc6\x15\x10\xe1\x13\x00\xf5\x2b\x2b\xd1\xf9\xeb\x7c\xb5\xc9\xeb\x2a\x07\x01\xc5\x1a\x77\x23"
+"\xe6\x7f\xd6\x40\x77\x23\x36\x00\x06\x03\x23\x13\x1a\x77\x05\xc2\xe1\xf1\x06\x05\xaf\x23\x77\x05\xc2\xec\xf1\xc1\xc9\xd1\x21\x08"
+"\x00\x19\xe5\xeb\xeb\x2a\x09\x01\xc3\x0d\xf2\x0e\x00\x0b\x3a\x00\x12\x07\x3a\x00\xf0\x28\x1b\xf2\x23\x36\x00\xc1\xc9\xc5\xe5\xcd"
+"\x0d\xf6\xd1\x2a\x07\x01\x7e\xe6\x80\x47\x23\x7e\xc6\x40\xe6\x7f\xb0\x12\x23\x06\x07\x13\x23\x7e\x12\x05\xc2\x40\xf2\xc1\xc9\xe1"
+"\x22\xb0\x04\xcd\x0d\xf6\x2a\x07\x01\x11\x09\x00\x19\x4b\x03\x18\xd5\x05\x00\x11\x2b\x34\x00\xc0\x5f\x2b\x7e\xe6\x80\xb3\x5f\xd5"
+"\x2a\xb0\x04\xe9\x31\x00\x74\x2a\x09\x01\xd1\x73\x23\x7b\xaf\x00\x04\x61\x28\x00\xdc\x06\x02\x6b\x28\x20\x36\x00\x2b\x00\x30\x2a"
+"\x09\x01\xda\x00\x80\x22\x09\x01\xeb\x22\x07\x01\xc9\x87\x00\x30\xee\x80\x77\x08\x00\xf0\x07\x23\x7e\xfe\xc0\xc2\x35\xfb\xc3\x29"
+"\xfb\xaf\x3d\xc1\xc9\xaf\x3c\xc1\xc9\xc5\x2a\x07\x01\xdb\x00\xf0\x0e\x1a\xb7\xfa\xe6\xf2\xae\xfa\xce\xf2\xc3\xeb\xf2\xae\xfa\xca"
+"\xf2\xeb\x23\x13\x1a\xbe\xfa\xca\xf2\xc2\xce\xf2\x06\x09\x0c\x00\x11\xda\x0c\x00\xe0\x05\xc2\xf7\xf2\xaf\xc1\xc9\x2a\x09\x01\x7e"
+"\xee\x80\x77\x3d\x00\xf2\x01\x11\x0b\x00\x19\x06\x07\xaf\x77\x23\x05\xc2\x1a\xf3\x2a\x09\x01\x10\x00\x00\x0f\x00\x23\x29\xf3\x5c"
+"\x00\xc3\x23\x13\x1a\x96\xf2\x40\xf3\xeb\x2f\x3c\x1b\x2b\x95\x00\xa0\xfe\x09\xd2\x34\xf6\x4f\xe5\xd5\xc6\x09\x55\x03\xf0\x26\x22"
+"\xb2\x04\xd1\x21\x09\x00\x19\x22\xb4\x04\xe1\xeb\x1a\xae\xf2\xc6\xf3\x1a\xb7\xfa\x8d\xf3\x06\x07\x2a\xb2\x04\xeb\x2a\xb4\x04\x1a"
+"\x9e\x12\x1b\x2b\x05\xc2\x77\xf3\x1a\xde\x00\x12\x1b\x0d\xf2\x80\xf3\xeb\xc3\xa8\x1f\x00\x90\xb4\x04\xeb\x2a\xb2\x04\x1a\x9e\x77"
+"\x1f\x00\xf1\x08\x96\xf3\x3e\x00\x9e\x77\x2b\x0d\xf2\x9f\xf3\x23\x7e\xb7\x3e\x01\xf2\xbf\xf3\x11\x0f\x00\x19\x15\x00\xd6\x1d\xf2"
+"\xb4\xf3\x3e\x81\x2a\x07\x01\x77\xc3\x34\xf6\x58\x00\x11\x8e\x58\x00\x41\xcf\xf3\x1a\xce\x58\x00\x50\xd8\xf3\xc3\x34\xf6\xd5\x00"
+"\x01\x12\x01\x20\xae\x12\xb9\x00\x30\x4f\xd5\xe5\x35\x01\xf0\x0c\x01\xf4\xe1\xe1\xc3\xbf\xf6\x13\x23\x06\x08\x13\x23\x1a\xbe\xc2"
+"\x20\xf4\x05\xc2\x05\xf4\xe1\xe1\x0c\x71\x23\xf8\x29\xf0\x02\x01\x06\x08\xaf\xc3\x58\xf6\xd1\xe1\x71\xda\x29\xf4\x0c\x71\x2b\xd5"
+"\xd6\x01\xe3\x06\x08\x11\xe4\x04\x7e\x12\x2b\x13\x05\xc2\x33\xf4\xe1\x12\x00\x13\xec\x12\x00\x71\x45\xf4\x06\x08\x21\xdc\x04\x39"
+"\x01\xf0\x00\x53\xf4\x3e\x40\x32\xdb\x04\x21\xdc\x04\x06\x10\xb7\x7e\x8f\x3d\x01\x61\x64\xf4\x9f\xe6\x01\x4f\x42\x00\x70\x21\xec"
+"\x04\xb7\x1a\x9e\x12\x38\x04\xf0\x07\x79\xf4\x79\xde\x00\xc2\x96\xf4\x21\xdc\x04\x34\x21\xdb\x04\x35\xc2\x5e\xf4\xc3\xc8\xf4\x0a"
+"\x00\x20\xca\xc8\x15\x00\x05\x3f\x00\x37\xa3\xf4\x9f\x3d\x00\x11\x8e\x3d\x00\x40\xb6\xf4\x79\xce\x3d\x00\x30\xc3\x88\xf4\x77\x02"
+"\xfd\x06\x0c\x00\x19\x36\x00\x2b\x36\x00\x11\xdc\x04\x06\x08\x2b\x1a\x77\x13\x05\xc2\xd9\xf4\x00\x01\x81\xfe\xc0\xca\x4e\xf6\x86"
+"\x12\x7e\x08\x00\x04\xd6\x00\x04\xc4\x00\x24\x09\xf5\xd6\x00\x04\xe8\x00\x26\x1b\xf5\xd6\x00\x2d\x29\xf5\xd6\x00\xa1\x3a\xf5\xd2"
+"\x65\xf5\x06\x08\x11\xdc\x04\xd5\x00\x02\x98\x00\x40\x4e\xf5\x06\x08\x81\x01\x80\xd2\x65\xf5\x13\x05\xc2\x59\xf5\xcf\x00\x33\xc2"
+"\x34\xf5\xa4\x00\xf1\x05\x11\xe2\x04\x06\x0a\x1a\x77\x13\x2b\x05\xc2\x78\xf5\xc3\x34\xf6\xcd\xd2\xf2\xca\xc2\x02\x00\x09\x00\x94"
+"\x29\xfb\xc3\x35\xfb\xcd\xd2\xf2\xfa\x12\x00\x35\xfa\x35\xfb\x1e\x00\x15\xfa\x1e\x00\x31\x29\xfb\xca\x0c\x00\xc5\xc5\x7c\xb5\xca"
+"\x4e\xf6\xeb\x06\x00\xc3\xe1\xf5\x0c\x00\xf0\x0a\x7a\xb7\xf2\xe1\xf5\x2f\x57\x7b\x2f\x5f\x13\x06\x80\x2a\x07\x01\x70\x23\x7a\xb7"
+"\xc2\xf8\xf5\x36\x01\xd9\x01\x90\x73\x06\x07\xaf\xc3\x04\xf6\x36\x02\x0d\x00\x51\x72\x23\x73\x06\x06\x18\x04\x41\x04\xf6\xc3\x92"
+"\xbc\x03\x00\x30\x1c\xf2\x0f\xfe\x80\xd8\xc2\x21\xf6\x2b\x7e\xf6\x01\x77\xc9\xc5\x01\x00\x08\x37\x2b\x7e\x89\x77\x05\xc2\x26\xf6"
+"\xb7\xc2\x34\xf6\xc1\x77\x03\xf0\x10\x54\x5d\x23\x4f\xaf\xbe\xc2\x94\xf6\x06\x08\x23\xbe\xc2\x60\xf6\x0d\x05\xc2\x44\xf6\xaf\x2a"
+"\x07\x01\x06\x0a\x77\x23\x36\xc0\x6c\x04\xf0\x15\x58\xf6\xc1\xc9\x3e\x08\x90\x47\xca\x80\xf6\x2b\x79\x12\xd5\x13\x3e\x0f\x90\x4f"
+"\x7e\x12\x13\x23\x0d\xc2\x70\xf6\xaf\x12\x13\x05\xc2\x79\xf6\xd1\x17\x03\xf1\x06\xf6\xfe\x40\xda\x92\xf6\xc3\xbf\xf6\xfe\xc1\xda"
+"\xae\xf6\xc1\xc9\x0c\x79\x12\x06\x0f\xa7\x1d\xf1\x00\x54\x5d\x1b\x1a\x77\x2b\x05\xc2\xa0\xf6\x36\x00\xd1\xc3\x80\x60\x00\xc0\x23"
+"\x36\xc1\x23\x77\x23\x36\x01\x06\x08\xc3\x58\xb2\x00\xa0\x23\x36\x3f\x23\x36\x00\x3e\xff\x06\x07\x74\x00\x22\xcc\xf6\xaf\x04\x30"
+"\x2a\x07\x01\xc6\x02\x73\x03\x11\x04\x00\x19\x5d\x54\xfd\x04\x60\xe9\xf6\x06\x04\x2a\x03\x70\x0f\xf1\x0b\x7e\x2a\x03\x01\xb7\xf2"
+"\x10\xf7\x3e\x00\x9e\x12\x23\x1b\x05\xc2\xff\xf6\x1b\x3e\x80\x12\xc3\x34\xf6\x7e\x0f\x00\x21\x10\xf7\x37\x02\x42\x03\x01\x54\x5d"
+"\x81\x1f\xf0\x0f\x23\x77\x2a\x07\x01\x4e\x23\x7e\xb7\xca\x92\xf6\xfa\x92\xf6\xfe\x05\xd2\x61\xf7\x47\x23\x85\x6f\xd2\x43\xf7\x24"
+"\x7e\x12\xcb\x01\x62\x43\xf7\x79\xb7\xf2\x92\x61\x00\x00\xa1\x03\xf2\x04\x23\x05\xc2\x55\xf7\xc3\x92\xf6\xeb\x79\xb7\xfa\x75\xf7"
+"\x36\x7f\x23\x36\xff\x03\x00\x50\xc3\xdc\xf7\x36\x80\x7d\x01\x00\xa0\x00\xf0\x02\x00\xc3\xdc\xf7\xc5\x0e\x00\xc3\x8c\xf7\xc5\x0e"
+"\x01\x2a\x07\x01\x46\x63\x00\xf0\x01\x99\xf7\xf2\x9f\xf7\x21\x00\x00\xc3\x92\xf6\xfe\x03\xd2\xc3\xf7\x68\x00\x80\xab\xf7\x24\x5e"
+"\x2b\x56\xeb\x79\x81\x00\x10\x78\x69\x00\x03\xf3\x06\xf4\x0f\xc3\x92\xf6\x79\xb7\xc2\xce\xf7\x21\xff\xff\xc3\xdc\xf7\x78\xb7\xfa"
+"\xd9\xf7\x21\xff\x7f\xc3\xdc\xf7\x21\x00\x80\xc1\xc9\xfe\x10\x30\x40\x0c\xcc\x01\x00\xf0\x6b\xcd\x40\x01\x47\xae\x14\x7a\xe1\x48"
+"\x3f\x20\xc4\x9b\xa5\xe3\x54\x00\x3f\x03\x46\xdc\x5d\x63\x88\x66\x3e\x53\xe2\xd6\x23\x8d\xa3\xcd\x3e\x08\x63\x7b\xd0\x5a\xf6\xc8"
+"\x3d\xd6\xbf\x94\xd5\xe5\x7a\x66\x3d\x15\x79\x8e\xe2\x30\x8c\x3d\x3d\x02\x25\xc1\x7d\x04\xda\xd3\x3c\x36\xf9\xbf\xb3\xaf\x7b\x80"
+"\x3c\x05\x7f\x5f\xf8\x5e\x59\x26\x3b\x8c\xbc\xcc\x09\x6f\x50\x9a\x3b\x0e\x12\xe1\x34\x24\xbb\x43\x3b\x01\x68\x49\xb8\x6a\x12\xba"
+"\x3a\x24\x07\x5f\x3d\xce\xac\x33\x3a\x03\x9a\x56\x52\xfb\x11\x38\xc5\xa5\x0c\x01\x76\x10\x20\xf4\x04\xef\x06\x00\x2a\x0c\x50\x0f"
+"\x00\x22\xf6\x04\xca\x05\xf2\x0f\xb7\xf2\x93\xf8\xcd\xb5\xf2\x2a\xf4\x04\x36\x2d\x23\x22\xf4\x04\x01\x00\x00\xcd\xbd\xf2\xca\x19"
+"\xf9\xcd\xf4\xf1\x41\x0a\x21\x0c\xf0\x14\x2a\x07\x01\x23\x7e\xfe\x01\xfa\x12\xf9\xca\xf9\xf8\xfe\x02\xc2\xc1\xf8\x23\x23\x7e\xfe"
+"\x27\xda\x01\xf9\xcd\x12\xfa\xcd\xf4\xf1\x40\x19\x99\x01\x00\xe0\x9a\xcd\x1e\xfa\x03\xcd\x95\xf5\xc2\xcf\xf8\xcd\x12\xfa\x35\x00"
+"\x00\x27\x00\xb0\x0a\xda\x19\xf9\x0b\xcd\x1e\xfa\xc3\x19\xf9\x13\x00\x64\x7e\xfe\x01\xc2\x01\xf9\x19\x00\x73\xcd\xe4\xf3\x03\xc3"
+"\xef\xf8\x19\x00\xf3\x06\xf2\x19\xf9\xcd\x1e\xfa\x0b\xc3\x08\xf9\x2a\xf6\x04\x2b\x29\x29\x29\x11\xde\xf7\x19\x5f\x15\x06\x8e\x00"
+"\xf0\x2b\xcd\xaa\xf5\xca\x49\xf9\x21\x01\x00\xcd\xbf\xf5\x03\x2a\xf6\x04\x23\x22\xf6\x04\x60\x69\x22\xf8\x04\x3e\xff\x32\xfa\x04"
+"\x78\xb7\xfa\x61\xf9\x79\xfe\x0f\xd2\x68\xf9\xc3\x88\xf9\x79\x2f\xfe\x01\xda\x6f\xf9\xaf\x32\xfa\x04\xc3\x88\xf9\xe5\x00\xf4\x13"
+"\x30\x23\x36\x2e\x23\xb7\xca\x83\xf9\x36\x30\x23\x3d\xc2\x7c\xf9\x22\xf4\x04\x3e\xff\x4f\x06\xff\x04\x3a\xf6\x04\xb8\xda\xbd\xf9"
+"\xca\xbd\xa7\x00\xf0\x07\x3e\x30\xc2\xa7\xf9\x23\x23\x86\x36\x00\x2a\xf4\x04\x77\x23\x78\xb9\xc2\xb4\xf9\x36\x2e\x24\x01\x00\xce"
+"\x00\x10\x8b\x4e\x00\xf1\x3e\x2b\x7e\xfe\x30\xca\xc0\xf9\x3a\xfa\x04\xb7\xca\xd8\xf9\x7e\xfe\x2e\xca\x0e\xfa\x23\xc3\x0e\xfa\x23"
+"\x36\x65\x23\x36\x2b\x3a\xf9\x04\xb7\x3a\xf8\x04\xf2\xec\xf9\x36\x2d\x2f\x3c\x23\xfe\x64\xda\xf7\xf9\x36\x31\x23\xd6\x64\x06\x00"
+"\xfe\x0a\xda\x04\xfa\x04\xd6\x0a\xc3\xf9\xf9\xc6\x30\x5f\x3e\x30\x80\x77\x23\x73\x3b\x03\x20\xcd\xa6\x1f\x0f\x60\xcd\xbf\xf5\xc3"
+"\xe4\xf3\x3a\x06\x20\x23\x34\xe8\x05\xf4\x20\xaf\x06\x08\xc5\x5e\xeb\x26\x00\x29\x44\x4d\x29\x29\x09\xeb\x83\x23\x77\x7a\xce\x00"
+"\x2b\x2b\xc1\x05\xc2\x2b\xfa\x23\x77\xb7\xca\x34\xf6\x2b\x2b\x7e\xb7\xfa\x56\xfa\xfe\x40\xd2\xbf\xf6\xc1\x13\x0e\xf0\x0c\x4e\x23"
+"\x46\x50\x59\x21\x61\x00\xcd\x3d\xfb\x28\x13\x50\x59\x21\x7a\x00\xcd\x3e\xfb\x28\x09\x60\x69\x11\x20\xc5\x12\x03\x0f\x13\x00\x28"
+"\x0c\x02\x2a\x00\x15\x41\x2a\x00\x1f\x5a\x2a\x00\x09\x02\x40\x00\x80\x24\xfb\x20\x18\x60\x69\x11\x09\x98\x17\x61\x20\x0e\x60\x69"
+"\x11\x0a\x0a\x00\x05\xc0\x0e\x82\x7c\xa2\x67\x7d\xa3\x6f\xb4\xc9\x2b\x03\x50\xb4\xc9\xe9\xe1\xc5\x34\x09\x21\x44\x4d\x48\x09\xc0"
+"\x39\xf9\xd5\x60\x69\xcd\xec\xfa\xeb\xe1\xf9\xc1\x3b\x09\xf0\x07\x7a\xac\x32\xfc\x04\xcd\x7b\xfb\xeb\x3a\xfc\x04\xb7\xfa\xd4\xfb"
+"\x7d\xb4\xc9\xcd\x94\xfb\xbb\x09\xc0\xa7\xed\x52\x28\x0c\x21\x00\x00\xaf\x54\x5d\xc9\x0c\x00\x11\xf4\x16\x0a\xf1\x0a\x54\x5d\xc9"
+"\xeb\x7c\xaa\xfa\x4c\xfb\xaf\xed\x52\x67\x3f\xce\x00\x6f\xc9\x7a\x07\xe6\x01\x6f\x26\x00\x17\x00\x11\x62\x17\x00\x00\x16\x00\x13"
+"\x7c\x16\x00\x12\x7a\x5f\x00\x03\x5e\x00\x82\x7c\xb5\xc9\x7c\xb7\xf2\x86\xfb\xb9\x0a\x52\x7a\xb7\xf2\x94\xfb\xb2\x05\x41\xc3\x94"
+"\xfb\xc5\xa2\x00\xf4\x0b\x3e\x10\x29\xeb\x29\xeb\xd2\xa4\xfb\x23\xa7\xed\x42\xd2\xb3\xfb\x09\x3d\xc2\x9c\xfb\xc1\x7d\xb4\xc9\x13"
+"\x09\x00\x09\x28\x00\x10\xcc\x21\x00\x11\xc4\x21\x00\xc2\x7d\x2f\x6f\x7c\x2f\x67\x23\x7d\xb4\xc9\x7c\xb5\x3c\x06\xf6\x11\x7c\xb2"
+"\x67\x7d\xb3\x6f\xb4\xc9\xeb\x7b\xe6\x1f\x5f\xca\x15\xfc\x7c\xb4\xf2\x5f\xfc\x7c\x37\x1f\x67\x7d\x1f\x6f\x1d\xc2\xfb\xfb\x1a\x00"
+"\xf0\x03\x29\x1d\xc2\x10\xfc\x7d\xb4\xc9\xeb\xa7\xed\x52\xc9\xeb\xe1\xc5\x42\x4b\xb0\x2b\xf1\x08\x7a\xb7\xfa\x3d\xfc\x23\x79\xbe"
+"\xca\x37\xfc\x23\x23\x23\xc3\x25\xfc\x23\x78\xbe\xc2\x32\xfc\x06\x0b\x35\xc1\xe9\xeb\x02\x01\x01\x0a\x00\x00\xf5\x00\x05\x69\x00"
+"\x13\xb7\x64\x00\xd1\x5f\xfc\xb4\xc9\x7c\xaa\x67\x7d\xab\x6f\xb4\xc9\xd1\x83\x0b\x41\xd5\x11\xfd\x04\xc5\x36\xa1\x21\x88\xfc\xe3"
+"\xe9\xc1\x7c\xb5\xc9\x23\x50\x00\xf0\x06\xb4\xc9\xc5\xaf\x32\x03\x05\x32\x04\x05\x32\x05\x05\x6f\x67\x22\x06\x05\xcd\xbf\xf5\x35"
+"\x04\xf0\x1b\x4e\x23\x46\x0a\xfe\x2d\xc2\xba\xfc\x32\x03\x05\xc3\xbf\xfc\xfe\x2b\xc2\xc0\xfc\x03\x0a\xfe\x30\xda\xef\xfc\xfe\x3a"
+"\xd2\xef\xfc\xf5\xcd\x1e\xfa\xcd\xa6\xf2\xf1\xd6\x30\xe6\x26\xf1\x03\xbf\xf5\xcd\x0f\xf3\x3a\x05\x05\xb7\xca\xbf\xfc\x2a\x06\x05"
+"\x2b\x22\x06\x35\x00\xf0\x0d\x2e\xc2\x01\xfd\x21\x05\x05\x7e\xb7\xc2\x01\xfd\x36\x01\xc3\xbf\xfc\x21\x00\x00\xf6\x20\xfe\x65\xc2"
+"\x4e\xfd\x03\x5e\x00\xc0\x18\xfd\x32\x04\x05\xc3\x1d\xfd\xfe\x2b\xc2\x1e\x12\x00\xf0\x02\x30\xda\x38\xfd\xfe\x3a\xd2\x38\xfd\xd6"
+"\x30\x29\x54\x5d\x29\x29\x19\xde\x09\xa2\xc3\x1d\xfd\x3a\x04\x05\xb7\xca\x46\xfd\x5b\x02\xf5\x27\x23\xeb\x2a\x06\x05\x19\x22\x06"
+"\x05\x2a\x06\x05\x7c\xb7\xf2\x94\xfd\xfe\xff\xc2\xae\xfd\x7d\x2f\x3c\x4f\xfe\xa6\xd2\xae\xfd\xfe\x96\xda\x7b\xfd\xcd\xf4\xf1\x47"
+"\x23\x86\xf2\x6f\xc1\x00\x00\xcd\xe4\xf3\x79\xd6\x10\x4f\x69\x03\xf0\x01\xcd\x1e\xfa\x0d\xc2\x84\xfd\xcd\xa6\xf2\xcd\xe4\xf3\xc3"
+"\xa4\xfd\x3c\x00\x51\xb7\xca\xa4\xfd\x4f\x19\x00\xc5\x9d\xfd\x3a\x03\x05\xb7\xca\xae\xfd\xcd\xb5\xf2\x58\x03\x05\xd8\x19\x42\xf4"
+"\xf1\x41\x5a\x23\x05\x12\xcd\x2a\x11\x00\x4c\x03\x00\x5b\x11\x31\x4a\xf2\xcd\x6a\x1a\x63\xc9\xcd\xed\xfa\xf8\xff\x57\x15\x03\x1c"
+"\x17\x10\x95\xdd\x16\x92\x10\x00\x39\xe5\xcd\x02\xf2\x41\xb4\x3f\x00\x01\x09\x15\x32\xfb\xf1\xcd\xa7\x17\x03\x30\x00\x70\xcd\xf4"
+"\xf1\x44\x3b\x9a\xca\x22\x00\x80\xcd\xb3\xf5\x28\x0c\xcd\x02\xf2\x0c\x00\x00\x04\x00\x00\xbd\x26\x14\x39\x3f\x15\x00\x0e\x18\x05"
+"\x5f\x1a\x06\x3c\x00\x30\x42\x01\x0e\x2b\x00\x10\x00\x3c\x00\x10\x1e\x17\x00\x00\x71\x00\x31\x42\x02\x1c\x15\x00\x0f\x71\x00\x05"
+"\x05\xd0\x00\x1f\xb3\xa6\x00\x12\x31\xe5\x21\xd7\x7d\x19\x04\xdf\x19\x12\xe4\xc6\x19\x25\x04\x00\x9d\x00\x04\x69\x00\x20\xe4\xf4"
+"\xe6\x15\x00\x4a\x02\x00\x20\x01\xa0\xf4\xf1\x3e\x2e\x2e\x53\xb4\xe4\xcc\xe9\x92\x13\xd1\xf4\xf1\xbf\x0d\x00\xc0\x2a\x8e\x2f\x3e"
+"\xcd\x0f\xf3\x23\x00\x01\xc2\x1b\x00\x5a\x06\x7c\x02\x22\x22\x1a\x42\x5c\xad\x18\x00\x89\xc0\x2a\xaa\xaa\xa9\x85\x76\xac\x18\x00"
+"\x21\x21\xbf\xff\x12\x20\x0f\xf3\xed\x00\xc0\xcd\xfb\xf1\xc3\xe4\xf4\xeb\x2a\x03\x01\x1a\x77\x4c\x0d\x04\x04\x00\x10\xc9\x13\x00"
+"\x00\x08\x09\x06\x04\x00\x30\xc9\xe1\xd9\xb8\x01\x80\xf9\xd9\xe9\xe3\xc5\xcd\xec\xfa\x65\x31\x00\xcc\x0f\x40\xf9\xcd\xeb\xff\x0e"
+"\x07\xf0\x0e\x05\x00\xc3\xa1\xff\xcd\x74\xfc\xcd\xb5\xff\xeb\xc9\xcd\x74\xfc\x2a\xfd\x04\x44\x4d\x2a\xff\x04\xeb\xcd\x05\x00\xeb"
+"\x72\x04\x00\x1c\x00\x23\xd3\xff\x0a\x00\x60\x2a\xfd\x04\xeb\x2a\x01\xbe\x28\x60\x19\x19\x19\xeb\x2a\xff\x2c\x00\x88\x01\x05\xeb"
+"\xe9\xc3\x4e\x04\x1a\x01\x00\x50\x1a\x1a\x1a\x1a\x1a"
+;
+unsigned char dump_cpc6128_amsdos[16384];
+#include <string.h>
+static void _cpc_dump_init_lz4(const unsigned char* src, int src_size, unsigned char* dst) {
+    const unsigned char* end = src + src_size;
+    while (src < end) {
+        const unsigned char token = *src++;
+        int len = token >> 4;
+        if (len == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }
+        memcpy(dst, src, len); dst += len; src += len;
+        if (src >= end) { break; }
+        const unsigned char* m = dst - (src[0] | (src[1]<<8)); src += 2;
+        len = (token & 15) + 4;
+        if ((token & 15) == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }
+        while (len-- > 0) { *dst++ = *m++; }
+    }
+}
+static void cpc_dump_init(void) {
+    _cpc_dump_init_lz4(dump_cpc6128_basic_lz4, sizeof(dump_cpc6128_basic_lz4) - 1, dump_cpc6128_basic);
+    _cpc_dump_init_lz4(dump_cpc6128_os_lz4, sizeof(dump_cpc6128_os_lz4) - 1, dump_cpc6128_os);
+    _cpc_dump_init_lz4(dump_cpc6128_amsdos_lz4, sizeof(dump_cpc6128_amsdos_lz4) - 1, dump_cpc6128_amsdos);
+}
+#if defined(_MSC_VER)
+#pragma section(".CRT$XCU", read)
+__declspec(allocate(".CRT$XCU")) void (*_cpc_dump_init_ctor)(void) = cpc_dump_init;
+#else
+__attribute__((constructor)) static void _cpc_dump_init_ctor(void) { cpc_dump_init(); }
+#endif
+dump_item cpc_dump_items[CPC_DUMP_NUM_ITEMS] = {
 { "cpc6128_basic", dump_cpc6128_basic, 16384 },
+{ "cpc6128_os", dump_cpc6128_os, 16384 },
 { "cpc6128_amsdos", dump_cpc6128_amsdos, 16384 },
 };
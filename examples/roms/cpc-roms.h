@@ -1,10 +1,13 @@
 #pragma once
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include <stdint.h>
 extern unsigned char dump_cpc6128_basic[16384];
 extern unsigned char dump_cpc6128_os[16384];
 extern unsigned char dump_cpc6128_amsdos[16384];
+#ifndef DUMP_ITEM_DEFINED
+#define DUMP_ITEM_DEFINED
 typedef struct { const char* name; const uint8_t* ptr; int size; } dump_item;
-#define DUMP_NUM_ITEMS (3)
-extern dump_item dump_items[DUMP_NUM_ITEMS];
+#endif
+#define CPC_DUMP_NUM_ITEMS (3)
+extern dump_item cpc_dump_items[CPC_DUMP_NUM_ITEMS];
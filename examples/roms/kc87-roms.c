@@ -1,1168 +1,516 @@
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include "kc87-roms.h"
-unsigned char dump_kc87_os_2[8192] = {
-0xff, 0xff, 0xff, 0xc3, 0xd2, 0xe0, 0xc3, 0xf3, 0xe0, 0xc3, 0x57, 0xe1, 0x11, 0xe0, 0xc3, 0x0, 
-0xe6, 0xc9, 0x4e, 0x4b, 0x45, 0x59, 0x24, 0xca, 0x4f, 0x59, 0x53, 0x54, 0xd3, 0x54, 0x52, 0x49, 
-0x4e, 0x47, 0x24, 0xc9, 0x4e, 0x53, 0x54, 0x52, 0xd2, 0x45, 0x4e, 0x55, 0x4d, 0xc4, 0x45, 0x4c, 
-0x45, 0x54, 0x45, 0xd0, 0x41, 0x55, 0x53, 0x45, 0xc2, 0x45, 0x45, 0x50, 0xd7, 0x49, 0x4e, 0x44, 
-0x4f, 0x57, 0xc2, 0x4f, 0x52, 0x44, 0x45, 0x52, 0xc9, 0x4e, 0x4b, 0xd0, 0x41, 0x50, 0x45, 0x52, 
-0xc1, 0x54, 0xd0, 0x53, 0x45, 0x54, 0xcc, 0x49, 0x4e, 0x45, 0xc3, 0x49, 0x52, 0x43, 0x4c, 0x45, 
-0xa1, 0xd0, 0x41, 0x49, 0x4e, 0x54, 0xcc, 0x41, 0x42, 0x45, 0x4c, 0xd3, 0x49, 0x5a, 0x45, 0xda, 
-0x45, 0x52, 0x4f, 0xc8, 0x4f, 0x4d, 0x45, 0xa1, 0xc7, 0x43, 0x4c, 0x53, 0xd3, 0x43, 0x41, 0x4c, 
-0x45, 0xd3, 0x43, 0x52, 0x45, 0x45, 0x4e, 0xd0, 0x4f, 0x49, 0x4e, 0x54, 0xd8, 0x50, 0x4f, 0x53, 
-0xa1, 0xd9, 0x50, 0x4f, 0x53, 0x80, 0x19, 0xe4, 0xf5, 0xe4, 0x3c, 0xe4, 0xc1, 0xe4, 0xf8, 0xe1, 
-0xcd, 0xe5, 0xa7, 0xe3, 0x34, 0xe4, 0xb5, 0xe1, 0x79, 0xe1, 0x7d, 0xe1, 0x7e, 0xe1, 0x17, 0xe5, 
-0xd6, 0xa7, 0xd9, 0xa7, 0xdc, 0xa7, 0x4a, 0xca, 0xdf, 0xa7, 0xe2, 0xa7, 0xe5, 0xa7, 0xe8, 0xa7, 
-0xeb, 0xa7, 0x4a, 0xca, 0xee, 0xa7, 0xf1, 0xa7, 0xf4, 0xa7, 0xf7, 0xa7, 0xfa, 0xa7, 0x4a, 0xca, 
-0xfd, 0xa7, 0x78, 0xd6, 0x9, 0x38, 0x6d, 0xfe, 0x9, 0x38, 0x7, 0xcd, 0xf1, 0xe5, 0xfe, 0x16, 
-0x30, 0x62, 0x7, 0x4f, 0x6, 0x0, 0xeb, 0x21, 0x9e, 0xe0, 0x9, 0x4e, 0x23, 0x46, 0xc5, 0xeb, 
-0xc3, 0xbd, 0xc8, 0x7e, 0xfe, 0xdf, 0xd8, 0xfe, 0xe2, 0xd0, 0xfe, 0xe1, 0xca, 0x17, 0xe5, 0x3a, 
-0xfd, 0x3, 0xa7, 0x20, 0x3f, 0x3c, 0x32, 0xfd, 0x3, 0x3a, 0x27, 0x0, 0xf5, 0x7e, 0xfe, 0xdf, 
-0x28, 0xd, 0xcd, 0xbd, 0xc8, 0xcd, 0x7e, 0xe1, 0x7e, 0xfe, 0x3b, 0x28, 0x35, 0x18, 0x25, 0xcd, 
-0xbd, 0xc8, 0xcd, 0x7d, 0xe1, 0x7e, 0xfe, 0x3b, 0x28, 0x28, 0xcd, 0xd6, 0xc8, 0xfe, 0xe0, 0x20, 
-0x13, 0xcd, 0xbd, 0xc8, 0xcd, 0x7e, 0xe1, 0xcd, 0xcc, 0xc8, 0x3b, 0xcd, 0x3, 0xcb, 0xf1, 0x32, 
-0x27, 0x0, 0xc1, 0xc9, 0x3e, 0xe2, 0xd3, 0xb8, 0xc3, 0x48, 0xc3, 0x3e, 0xe2, 0xd3, 0xb8, 0xc3, 
-0x67, 0xc9, 0xcd, 0xbd, 0xc8, 0x18, 0xe4, 0x79, 0xd6, 0x3e, 0x38, 0xe8, 0xfe, 0x7, 0x38, 0xb, 
-0xcd, 0xf1, 0xe5, 0xfe, 0x32, 0x38, 0xdd, 0xfe, 0x3b, 0x30, 0xd9, 0xeb, 0x1, 0x96, 0xe0, 0xe1, 
-0x6f, 0x9, 0x4e, 0x23, 0x66, 0x69, 0xe5, 0xeb, 0xc9, 0x3e, 0x1, 0x18, 0x2, 0xf6, 0xaf, 0xf5, 
-0xcd, 0x21, 0xd4, 0xfe, 0x1, 0x38, 0x6e, 0xfe, 0x9, 0x30, 0x6a, 0x3d, 0x4f, 0xf1, 0xb7, 0x28, 
-0xb, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0x3d, 0x28, 0x17, 0xcb, 0x21, 0x41, 0xb7, 0x3a, 0x27, 
-0x0, 0x28, 0xa, 0xe6, 0x7, 0xb0, 0x32, 0x27, 0x0, 0x32, 0x28, 0x0, 0xc9, 0xe6, 0x70, 0x18, 
-0xf4, 0x79, 0xd3, 0x88, 0xc9, 0xe, 0x1d, 0xcd, 0x5, 0x0, 0xcd, 0xbe, 0xc8, 0x28, 0x2d, 0xcd, 
-0xf7, 0xe7, 0xf5, 0xcd, 0xf7, 0xe7, 0xf5, 0xcd, 0xf7, 0xe7, 0xf5, 0xcd, 0x21, 0xd4, 0x3c, 0x3c, 
-0x57, 0xfe, 0x2a, 0x30, 0x20, 0xf1, 0x5f, 0xf1, 0x3c, 0x3c, 0x47, 0xfe, 0x1a, 0x30, 0x16, 0xf1, 
-0x4f, 0x3c, 0xb8, 0x30, 0x10, 0x7b, 0x3c, 0xba, 0x30, 0xb, 0x18, 0x6, 0x1, 0x0, 0x19, 0x11, 
-0x0, 0x29, 0xc3, 0xe6, 0xe7, 0xc3, 0x4b, 0xe1, 0x1, 0xa, 0x0, 0xc5, 0x50, 0x58, 0x28, 0x27, 
-0xfe, 0x2c, 0x28, 0x9, 0xd5, 0xcd, 0x86, 0xc9, 0x42, 0x4b, 0xd1, 0x28, 0x1a, 0xcd, 0xd6, 0xc8, 
-0xcd, 0x86, 0xc9, 0x28, 0x12, 0xf1, 0xcd, 0xd6, 0xc8, 0xd5, 0xcd, 0x86, 0xc9, 0xc2, 0x44, 0xe1, 
-0x7a, 0xb3, 0x28, 0xd1, 0xeb, 0xe3, 0xeb, 0xd5, 0xc5, 0xcd, 0xbb, 0xc4, 0xd1, 0xd5, 0xc5, 0xcd, 
-0xbb, 0xc4, 0x60, 0x69, 0xd1, 0xcd, 0x89, 0xc6, 0xeb, 0x38, 0xba, 0xd1, 0xf1, 0xc1, 0xd5, 0xf5, 
-0x18, 0xe, 0x9, 0x38, 0xf4, 0xeb, 0xe5, 0x21, 0xf9, 0xff, 0xcd, 0x89, 0xc6, 0xe1, 0x38, 0xe9, 
-0xd5, 0x5e, 0x23, 0x56, 0x7a, 0xb3, 0xeb, 0xd1, 0x28, 0x7, 0x7e, 0x23, 0xb6, 0x2b, 0xeb, 0x20, 
-0xe1, 0xc5, 0xe, 0x80, 0xcd, 0x27, 0xc3, 0xaf, 0xcd, 0x9a, 0xe2, 0xaf, 0x3c, 0xcd, 0x9a, 0xe2, 
-0xc1, 0xd1, 0xc5, 0xcd, 0xbb, 0xc4, 0x60, 0x69, 0xc1, 0xd1, 0xf1, 0xd5, 0x5e, 0x23, 0x56, 0x7a, 
-0xb3, 0x28, 0xd, 0xeb, 0xe3, 0xeb, 0x23, 0x73, 0x23, 0x72, 0xeb, 0x9, 0xeb, 0xe1, 0x18, 0xeb, 
-0x3d, 0xcd, 0x9a, 0xe2, 0x1, 0x8a, 0xc4, 0xc5, 0x3e, 0x2, 0x32, 0x4e, 0x3, 0x2a, 0x5f, 0x3, 
-0x2b, 0xc5, 0xc5, 0x23, 0xc1, 0xc1, 0x44, 0x4d, 0x5e, 0x23, 0x56, 0x7a, 0xb3, 0xc8, 0xc5, 0xd5, 
-0x23, 0x23, 0xcd, 0xbd, 0xc8, 0xb7, 0x28, 0xeb, 0x4f, 0x3a, 0x4e, 0x3, 0xb7, 0x79, 0x28, 0x5f, 
-0xfe, 0xd, 0x20, 0xee, 0xe5, 0xe5, 0x23, 0x5e, 0x23, 0x56, 0x3a, 0x4e, 0x3, 0x3d, 0x28, 0x7e, 
-0x3d, 0x28, 0xe, 0xeb, 0x23, 0x23, 0x1b, 0xed, 0xa0, 0xed, 0xa0, 0xeb, 0xd1, 0xd1, 0x2b, 0x18, 
-0xd1, 0xd5, 0xeb, 0x13, 0x2a, 0xd7, 0x3, 0xed, 0x52, 0x44, 0x4d, 0xe1, 0xe3, 0xeb, 0xc5, 0xed, 
-0xb0, 0xc1, 0xd1, 0xe1, 0xe5, 0xc5, 0xaf, 0x6, 0x98, 0xcd, 0xae, 0xd6, 0xcd, 0x34, 0xd8, 0xc1, 
-0xd1, 0x23, 0x7e, 0xeb, 0x2b, 0xb7, 0x28, 0xaa, 0x23, 0xeb, 0xc5, 0xe5, 0xeb, 0x9, 0x54, 0x5d, 
-0x13, 0xed, 0x53, 0xd7, 0x3, 0x1b, 0x2b, 0xed, 0xb8, 0xe1, 0xed, 0xa0, 0xc1, 0x18, 0xe3, 0xfe, 
-0x88, 0x28, 0x19, 0xfe, 0x8c, 0x28, 0x15, 0xfe, 0x8b, 0x28, 0x11, 0xfe, 0xd4, 0x28, 0xd, 0xfe, 
-0xda, 0x28, 0x9, 0xfe, 0xd3, 0x28, 0x5, 0xfe, 0xa9, 0xc2, 0xb2, 0xe2, 0xcd, 0x87, 0xc9, 0xe5, 
-0xcd, 0xbb, 0xc4, 0xe1, 0x38, 0x14, 0x7e, 0xfe, 0x2c, 0x28, 0xf1, 0x2b, 0x18, 0xeb, 0xcd, 0xbb, 
-0xc4, 0xe1, 0x23, 0x71, 0x23, 0x70, 0xd1, 0xc3, 0xb2, 0xe2, 0xd5, 0xeb, 0x2a, 0xd7, 0x3, 0xed, 
-0x52, 0x23, 0xe5, 0xc1, 0x62, 0x6b, 0x1b, 0x1a, 0xfe, 0x2c, 0x28, 0x10, 0xfe, 0x3a, 0x30, 0xc, 
-0xf1, 0xe3, 0x2b, 0xe3, 0xf5, 0xc5, 0xd5, 0xed, 0xb0, 0xd1, 0x18, 0xe7, 0xeb, 0x9, 0x54, 0x5d, 
-0x13, 0x13, 0x13, 0x13, 0xed, 0x53, 0xd7, 0x3, 0x1b, 0xed, 0xb8, 0x3e, 0xd, 0x23, 0x77, 0x23, 
-0xd1, 0x73, 0x23, 0x72, 0xd1, 0xe3, 0x13, 0x13, 0x13, 0x73, 0x23, 0x72, 0x2b, 0xe3, 0xd5, 0xe5, 
-0xcd, 0x93, 0xc4, 0xe1, 0x23, 0x18, 0x9f, 0xcd, 0xbe, 0xc8, 0x20, 0x11, 0xcd, 0xf3, 0xdd, 0x20, 
-0xfb, 0xfe, 0x3, 0x28, 0x7, 0xfe, 0x1e, 0x20, 0xf3, 0xcd, 0xe4, 0xdd, 0xc9, 0xcd, 0x5e, 0xc9, 
-0x7a, 0xb3, 0xc8, 0xe5, 0x21, 0x1, 0x0, 0xdd, 0x21, 0xb, 0xe4, 0x3e, 0x5, 0xe, 0x8d, 0x6, 
-0xa, 0xdd, 0x86, 0x0, 0x10, 0xfb, 0xd, 0x20, 0xf6, 0x3d, 0x20, 0xf1, 0xa7, 0xeb, 0xed, 0x52, 
-0xeb, 0x28, 0x1b, 0xf5, 0xc5, 0xd5, 0xcd, 0xf3, 0xdd, 0x20, 0x8, 0xfe, 0x1e, 0x28, 0x9, 0xfe, 
-0x3, 0x28, 0x8, 0xd1, 0xc1, 0xf1, 0x18, 0xcf, 0xcd, 0xe4, 0xdd, 0xd1, 0xc1, 0xf1, 0xe1, 0xc9, 
-0xc3, 0xd, 0xc0, 0x42, 0x41, 0x53, 0x49, 0x43, 0x20, 0x20, 0x20, 0x0, 0xc3, 0x8c, 0xc0, 0x57, 
-0x42, 0x41, 0x53, 0x49, 0x43, 0x20, 0x20, 0x0, 0x0, 0xe5, 0xcd, 0xf3, 0xdd, 0x20, 0xf, 0x3e, 
-0x1, 0xcd, 0x7b, 0xd1, 0xcd, 0xe4, 0xdd, 0x2a, 0xc2, 0x3, 0x77, 0xc3, 0xa9, 0xd1, 0xaf, 0xcd, 
-0x7b, 0xd1, 0x18, 0xf7, 0xe, 0x2, 0x1e, 0x7, 0xcd, 0x5, 0x0, 0xc9, 0xcd, 0xcc, 0xc8, 0x28, 
-0xcd, 0xf7, 0xe7, 0xf5, 0xcd, 0x8e, 0xe4, 0xf5, 0xcd, 0xdb, 0xc8, 0xf1, 0xe3, 0x44, 0xe5, 0xf5, 
-0xd5, 0x4f, 0xaf, 0xb9, 0x28, 0xc, 0xb8, 0x28, 0x9, 0x79, 0x5, 0x28, 0x5, 0x81, 0x38, 0x29, 
-0x10, 0xfb, 0x47, 0xe, 0x0, 0xcd, 0xe1, 0xd1, 0xc1, 0xc5, 0xcd, 0x7e, 0xd1, 0xe1, 0xe3, 0x7c, 
-0xe1, 0xe3, 0x6f, 0x24, 0x25, 0xe5, 0xc5, 0x28, 0x7, 0xcd, 0xf2, 0xd2, 0xc1, 0xe1, 0x18, 0xf4, 
-0xc1, 0xe1, 0xd1, 0xcd, 0x2, 0xd3, 0xc3, 0xa9, 0xd1, 0x1e, 0x1c, 0xc3, 0x56, 0xc3, 0xcd, 0x3a, 
-0xcd, 0xe5, 0xcd, 0x30, 0xd3, 0x23, 0x23, 0x5e, 0x23, 0x56, 0xe1, 0xc9, 0x23, 0xe5, 0x2b, 0xd, 
-0xc5, 0xc, 0x13, 0x5, 0x28, 0x11, 0x23, 0xd, 0x28, 0x9, 0x1a, 0xbe, 0x28, 0xf4, 0xc1, 0xe1, 
-0xd1, 0x18, 0x2c, 0xe1, 0xe1, 0x18, 0x31, 0xd1, 0xe1, 0xd1, 0xd1, 0xa7, 0xed, 0x52, 0x7d, 0x18, 
-0x2a, 0xcd, 0xcc, 0xc8, 0x28, 0xcd, 0x8e, 0xe4, 0xd5, 0xf5, 0xcd, 0xd6, 0xc8, 0xcd, 0x8e, 0xe4, 
-0xf5, 0xcd, 0xdb, 0xc8, 0xf1, 0x28, 0x1a, 0x4f, 0xf1, 0x28, 0x6d, 0x47, 0xe3, 0xeb, 0xe5, 0xd5, 
-0x1a, 0xbe, 0x28, 0xb8, 0x23, 0xd, 0x20, 0xf9, 0xaf, 0xe1, 0xe1, 0x11, 0xf3, 0xcd, 0xd5, 0x18, 
-0x23, 0xd1, 0xe3, 0x18, 0xf6, 0xcd, 0xe1, 0xcd, 0xe5, 0x11, 0xf3, 0xcd, 0xd5, 0xcd, 0x24, 0xd4, 
-0xa7, 0x28, 0x45, 0xfe, 0x3, 0x30, 0x41, 0xe, 0x6, 0xcd, 0x5, 0x0, 0x38, 0x3a, 0xfe, 0x1, 
-0x28, 0x1, 0x48, 0x79, 0xc3, 0xc0, 0xd0, 0x3a, 0xfd, 0x3, 0xcb, 0x4f, 0xcb, 0xcf, 0x32, 0xfd, 
-0x3, 0x20, 0x25, 0xcd, 0xbd, 0xc8, 0xcd, 0xcc, 0xc8, 0x28, 0xcd, 0xf7, 0xe7, 0xf5, 0xcd, 0x21, 
-0xd4, 0xf5, 0xcd, 0xdb, 0xc8, 0xcd, 0xcc, 0xc8, 0x3b, 0xf1, 0x4f, 0xf1, 0xe5, 0x47, 0x78, 0xfe, 
-0x18, 0x30, 0x5, 0x79, 0xfe, 0x28, 0x38, 0x3, 0xc3, 0x4b, 0xe1, 0x2e, 0x0, 0x65, 0x55, 0x1e, 
-0x28, 0x4, 0x5, 0x28, 0x3, 0x19, 0x10, 0xfd, 0x59, 0x19, 0x11, 0x0, 0xec, 0x19, 0x54, 0x5d, 
-0x1, 0x0, 0xfc, 0x9, 0xe3, 0xd5, 0xfe, 0xd5, 0x38, 0x9, 0x3a, 0xfc, 0x3, 0xa7, 0x28, 0x3, 
-0xcd, 0x6, 0xe0, 0xcd, 0x3a, 0xcd, 0xe5, 0x3a, 0xae, 0x3, 0xb7, 0x20, 0xc, 0xcd, 0x34, 0xd8, 
-0xcd, 0x8a, 0xd1, 0x36, 0x20, 0x2a, 0xe5, 0x3, 0x34, 0xcd, 0xfe, 0xd2, 0xcd, 0xee, 0xd6, 0xe1, 
-0xdd, 0xe1, 0xfd, 0xe1, 0x3a, 0x27, 0x0, 0x57, 0x1c, 0x1d, 0x28, 0x13, 0xa, 0xcd, 0xbf, 0xe5, 
-0x30, 0xd, 0xdd, 0x77, 0x0, 0xfd, 0x72, 0x0, 0xdd, 0x23, 0xfd, 0x23, 0x3, 0x18, 0xea, 0xcd, 
-0xbe, 0xc8, 0x20, 0x2, 0xc1, 0xc9, 0xcd, 0xd6, 0xc8, 0xfd, 0xe5, 0xdd, 0xe5, 0x18, 0xa7, 0xe5, 
-0xdd, 0xe5, 0xe1, 0xd5, 0x11, 0xc0, 0xef, 0xa7, 0xed, 0x52, 0xd1, 0xe1, 0xc9, 0xc8, 0xcd, 0x86, 
-0xc9, 0xca, 0x42, 0xc4, 0xcd, 0xd6, 0xc8, 0xd5, 0xcd, 0x86, 0xc9, 0xe1, 0xc0, 0xeb, 0xe5, 0xcd, 
-0xbb, 0xc4, 0xd2, 0x4d, 0xc4, 0xd1, 0xf5, 0xc5, 0xcd, 0xbe, 0xc4, 0x30, 0xf5, 0xc1, 0xc3, 0x50, 
-0xc4, 0x47, 0xe5, 0x2a, 0xb0, 0xe0, 0x3e, 0xc3, 0xbe, 0x78, 0xe1, 0xc8, 0xc3, 0x44, 0xe1, 0xff, 
-0xcb, 0x6b, 0xc2, 0x0, 0x0, 0x22, 0x77, 0x0, 0xe5, 0xc5, 0x21, 0x1e, 0xe6, 0xe5, 0x7b, 0xe6, 
-0x7, 0x17, 0x4f, 0x6, 0x0, 0x21, 0x42, 0xe6, 0x9, 0x7e, 0x23, 0x66, 0x6f, 0xe9, 0xc1, 0xe1, 
-0xc9, 0xa, 0xd, 0x56, 0x65, 0x72, 0x69, 0x66, 0x79, 0x20, 0x28, 0x28, 0x59, 0x29, 0x2f, 0x4e, 
-0x29, 0x3f, 0x3a, 0x0, 0xa, 0x52, 0x65, 0x77, 0x69, 0x6e, 0x64, 0x20, 0x3c, 0x3d, 0x3d, 0xa, 
-0xd, 0x0, 0x52, 0xe6, 0x72, 0xe6, 0x34, 0xe7, 0x85, 0xe6, 0x82, 0xdc, 0x6e, 0xe6, 0x82, 0xdc, 
-0x82, 0xdc, 0xcb, 0x7b, 0x28, 0x11, 0xe, 0xb, 0xcd, 0x5, 0x0, 0xb7, 0x28, 0xe, 0xcb, 0xbb, 
-0x18, 0xa, 0xe, 0x9, 0xcd, 0x5, 0x0, 0xe, 0x1, 0xcd, 0x5, 0x0, 0x57, 0xc9, 0xe, 0x5, 
-0x18, 0x2, 0xe, 0x2, 0xd5, 0x5a, 0xcd, 0x5, 0x0, 0xd1, 0xcb, 0xbb, 0xc9, 0x16, 0xa, 0x18, 
-0xf1, 0x16, 0xd, 0x18, 0xed, 0xd5, 0xcb, 0x5b, 0x28, 0x22, 0xd5, 0xe, 0xf, 0xcd, 0x5, 0x0, 
-0x16, 0x20, 0xcd, 0x72, 0xe6, 0x1, 0xb, 0x0, 0x2a, 0x77, 0x0, 0x23, 0x23, 0x7e, 0x32, 0x75, 
-0x0, 0x11, 0x80, 0x0, 0xed, 0xb0, 0xd1, 0x21, 0x6e, 0x0, 0x36, 0xb, 0x21, 0x80, 0x0, 0x3a, 
-0x6e, 0x0, 0x4f, 0x6, 0x0, 0x9, 0x72, 0x3c, 0x32, 0x6e, 0x0, 0xcb, 0x73, 0x20, 0x8, 0x3a, 
-0x6e, 0x0, 0xfe, 0x80, 0xc2, 0x7d, 0xe7, 0x3a, 0x75, 0x0, 0xfe, 0xd5, 0x20, 0x1a, 0x21, 0x80, 
-0x0, 0x3a, 0x6e, 0x0, 0x47, 0x56, 0xcd, 0x72, 0xe6, 0x23, 0x10, 0xf9, 0x21, 0x0, 0x0, 0x6, 
-0x0, 0xe, 0x1, 0xa7, 0xed, 0x42, 0x20, 0xf7, 0x21, 0x80, 0x0, 0x22, 0x1b, 0x0, 0xe, 0x15, 
-0xcd, 0x5, 0x0, 0xaf, 0x32, 0x6e, 0x0, 0x16, 0x20, 0xcd, 0x72, 0xe6, 0xcb, 0x73, 0x28, 0x74, 
-0xaf, 0x32, 0x5a, 0x0, 0x11, 0x21, 0xe6, 0xcd, 0x62, 0xe6, 0xcd, 0x72, 0xe6, 0xcd, 0x7d, 0xe6, 
-0xcd, 0x81, 0xe6, 0xfe, 0x4e, 0x28, 0x66, 0x11, 0x34, 0xe6, 0xcd, 0x62, 0xe6, 0xcd, 0x7d, 0xe6, 
-0xcd, 0x81, 0xe6, 0x3a, 0x6b, 0x0, 0x47, 0xaf, 0x32, 0x6c, 0x0, 0xc5, 0xcd, 0x83, 0xe7, 0xc1, 
-0x10, 0xf9, 0x18, 0x49, 0xd5, 0xcb, 0x73, 0x20, 0x44, 0xcb, 0x5b, 0x28, 0x1b, 0xcd, 0x7d, 0xe6, 
-0x3e, 0x1, 0x32, 0x6c, 0x0, 0xcd, 0x83, 0xe7, 0xcd, 0x9d, 0xe7, 0xd1, 0x21, 0x8b, 0x0, 0x56, 
-0xd5, 0x21, 0x6e, 0x0, 0x36, 0xc, 0x18, 0x1c, 0x21, 0x80, 0x0, 0x3a, 0x6e, 0x0, 0x4f, 0x6, 
-0x0, 0x9, 0xd1, 0x56, 0xd5, 0x3c, 0x32, 0x6e, 0x0, 0xfe, 0x80, 0x20, 0x10, 0xcd, 0x83, 0xe7, 
-0xaf, 0x32, 0x6e, 0x0, 0xe, 0xb, 0xcd, 0x5, 0x0, 0xfe, 0x3, 0x28, 0x1d, 0xd1, 0xcb, 0xbb, 
-0xcb, 0x9b, 0xc9, 0x21, 0x80, 0x0, 0x22, 0x1b, 0x0, 0xe, 0x14, 0xcd, 0x5, 0x0, 0xd0, 0xcd, 
-0x67, 0xe6, 0xfe, 0xd, 0x28, 0xed, 0xfe, 0x3, 0x20, 0xf5, 0xc3, 0x82, 0xdc, 0x21, 0x80, 0x0, 
-0x6, 0xb, 0x56, 0xcd, 0x72, 0xe6, 0x23, 0x10, 0xf9, 0x2a, 0x77, 0x0, 0xe, 0xc, 0x9, 0x6, 
-0xb, 0x11, 0x8a, 0x0, 0x1a, 0xbe, 0x1b, 0x20, 0x4, 0x2b, 0x10, 0xf8, 0xc9, 0xd6, 0x4, 0xbe, 
-0x20, 0xd8, 0x3e, 0xff, 0x32, 0x5e, 0x3, 0x18, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x53, 0x3d, 0x0, 0xed, 0x43, 0x3b, 0x0, 0x51, 0x14, 
-0x1c, 0xe, 0x12, 0xcd, 0x5, 0x0, 0xc9, 0xcd, 0x21, 0xd4, 0xf5, 0xcd, 0xd6, 0xc8, 0xf1, 0xc9, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xc3, 0x64, 0xf6, 0xc3, 0xae, 0xf6, 0xc3, 0x56, 0xf7, 0xc3, 0x7f, 0xf7, 0xc3, 0x83, 0xf7, 0xc3, 
-0x9e, 0xf7, 0xc3, 0xae, 0xf7, 0xc3, 0xa8, 0xf7, 0xc3, 0xc4, 0xf7, 0xc3, 0xde, 0xf5, 0xc3, 0xb, 
-0xf8, 0xc3, 0xfc, 0xf7, 0xc3, 0xdf, 0xf7, 0xc3, 0x34, 0xf4, 0xc3, 0x6f, 0xf4, 0xc3, 0xa4, 0xf7, 
-0xc3, 0x33, 0xf7, 0xc3, 0x37, 0xf7, 0xc3, 0xde, 0xf5, 0xc3, 0xd2, 0xf7, 0xc3, 0xd9, 0xf7, 0xc3, 
-0xe5, 0xf7, 0xc3, 0xf4, 0xf7, 0x64, 0xf6, 0x9, 0xf0, 0xc, 0xf0, 0x15, 0xf0, 0x12, 0xf0, 0xf, 
-0xf0, 0x18, 0xf0, 0x39, 0xf0, 0x3c, 0xf0, 0xe2, 0xf3, 0x65, 0xf3, 0x6, 0xf0, 0xf3, 0xf3, 0xf8, 
-0xf3, 0x2d, 0xf4, 0x45, 0xf4, 0x6a, 0xf4, 0x3c, 0xf7, 0x3b, 0xf7, 0xde, 0xf5, 0x27, 0xf0, 0x2a, 
-0xf0, 0x1e, 0xf0, 0x21, 0xf0, 0xa8, 0xf4, 0xe3, 0xfa, 0x24, 0xf0, 0x3f, 0xf0, 0x42, 0xf0, 0x3e, 
-0xf7, 0x3d, 0xf7, 0xb9, 0xf5, 0xde, 0xf5, 0xd8, 0xf4, 0x21, 0x89, 0xf0, 0xe5, 0x21, 0x80, 0x0, 
-0x22, 0x1b, 0x0, 0x3e, 0x3e, 0xcd, 0x5, 0xf3, 0xcd, 0x5c, 0xf3, 0x38, 0x23, 0xcd, 0xb9, 0xf5, 
-0xd8, 0x21, 0xea, 0xf5, 0xe5, 0xcd, 0xea, 0xf1, 0xca, 0xe6, 0xf5, 0xc5, 0xcd, 0x8e, 0xf2, 0xc1, 
-0x28, 0x7, 0xcd, 0x26, 0xf5, 0xd8, 0x2a, 0x71, 0x0, 0xe9, 0x8, 0x30, 0x2a, 0xcd, 0xfe, 0xf2, 
-0xda, 0xae, 0xf6, 0x6, 0x4, 0x21, 0xe9, 0xef, 0x11, 0xd5, 0xfb, 0xcd, 0xe2, 0xf3, 0x3e, 0x3a, 
-0xcd, 0x5, 0xf3, 0xd5, 0x5e, 0x23, 0x56, 0x23, 0xe5, 0xcd, 0xe2, 0xf3, 0xe1, 0xd1, 0x13, 0x13, 
-0x13, 0xcd, 0xfe, 0xf2, 0x10, 0xe5, 0xc9, 0xcd, 0xea, 0xf1, 0x28, 0x2c, 0x8, 0xda, 0xe6, 0xf5, 
-0xc5, 0x1, 0x9, 0x4, 0x21, 0xd5, 0xfb, 0xcd, 0xb8, 0xf2, 0x58, 0xc1, 0x20, 0x50, 0x3e, 0x4, 
-0x93, 0x87, 0x32, 0x33, 0x0, 0x22, 0x40, 0x0, 0x79, 0xfe, 0x3a, 0x20, 0x5, 0xcd, 0xc4, 0xf1, 
-0xfe, 0x3d, 0xc2, 0xe2, 0xf5, 0xcd, 0xea, 0xf1, 0x28, 0x5b, 0xc5, 0xcd, 0xb2, 0xf2, 0xc1, 0x28, 
-0x17, 0xcd, 0xab, 0xf0, 0xd8, 0x0, 0xe5, 0xd5, 0x7c, 0x84, 0x85, 0x87, 0x16, 0x0, 0x5f, 0x21, 
-0xc9, 0xef, 0x19, 0x71, 0x23, 0x70, 0xd1, 0xe1, 0x3a, 0x4, 0x0, 0x8, 0x30, 0x37, 0x3a, 0x33, 
-0x0, 0x47, 0x4d, 0xbc, 0x28, 0xa, 0x95, 0x3c, 0xfe, 0x6, 0x28, 0x4, 0x3d, 0xb8, 0x20, 0x25, 
-0xd5, 0x58, 0x21, 0x4, 0x0, 0x6, 0x9, 0x3c, 0xcb, 0x1e, 0x3d, 0x20, 0x7, 0xcb, 0x39, 0xcb, 
-0x1e, 0xcb, 0x39, 0x5, 0x10, 0xf2, 0x43, 0xcd, 0xce, 0xf2, 0xd1, 0x30, 0xb, 0x8, 0x32, 0x4, 
-0x0, 0x3e, 0x4, 0x37, 0xc9, 0xc3, 0xe6, 0xf5, 0x2a, 0x40, 0x0, 0x73, 0x23, 0x72, 0xc3, 0xbd, 
-0xf0, 0x8, 0x38, 0x34, 0x6, 0x3, 0x3e, 0x17, 0x32, 0x2f, 0x0, 0xc5, 0xcd, 0xea, 0xf1, 0xc1, 
-0x20, 0xe3, 0xd8, 0x5f, 0x3a, 0x2f, 0x0, 0xbb, 0x3e, 0x3, 0xd8, 0x4d, 0x6c, 0x63, 0x8, 0x38, 
-0x10, 0x3e, 0x3b, 0x10, 0xe3, 0xc3, 0xe2, 0xf5, 0x22, 0x1e, 0x0, 0x79, 0x32, 0x1d, 0x0, 0xb7, 
-0xc9, 0x1e, 0x0, 0x8, 0x10, 0xe5, 0x18, 0xf0, 0x11, 0x1, 0x1, 0xcd, 0xa8, 0xf4, 0xcd, 0xe2, 
-0xf3, 0xc3, 0xfe, 0xf2, 0x21, 0x81, 0x0, 0x23, 0x7e, 0xfe, 0x20, 0x28, 0xfa, 0xcd, 0xd7, 0xf1, 
-0x4f, 0xc0, 0xfe, 0x1, 0xd8, 0xbf, 0xc9, 0x7e, 0xb7, 0xc8, 0xe5, 0xc5, 0x21, 0xab, 0xfc, 0x1, 
-0x5, 0x0, 0xed, 0xb1, 0xc1, 0xe1, 0x36, 0x20, 0x23, 0xc9, 0x11, 0x52, 0x1, 0xaf, 0x6, 0x51, 
-0x12, 0x1b, 0x10, 0xfc, 0xe5, 0xcd, 0xc4, 0xf1, 0x38, 0xd, 0x28, 0xb, 0x12, 0x4, 0x13, 0xcd, 
-0xd7, 0xf1, 0x20, 0xf8, 0xcd, 0xd0, 0xf1, 0x78, 0x32, 0x0, 0x1, 0x79, 0xe1, 0x8, 0x3a, 0x1, 
-0x1, 0xfe, 0x30, 0x38, 0x16, 0xfe, 0x3a, 0x30, 0x12, 0xe5, 0xc5, 0x11, 0x0, 0x1, 0xcd, 0x15, 
-0xf8, 0xc1, 0xe1, 0x38, 0x2, 0xbf, 0xc9, 0xbf, 0xc3, 0xe2, 0xf5, 0xfe, 0x40, 0x38, 0xf8, 0x37, 
-0xc9, 0xe5, 0xc5, 0xcd, 0x4d, 0xf2, 0xf5, 0xcb, 0x39, 0x18, 0x6, 0xe5, 0xc5, 0xcd, 0x4d, 0xf2, 
-0xf5, 0xcd, 0x69, 0xf2, 0xf1, 0xc1, 0xe1, 0xf5, 0xb7, 0xed, 0x52, 0xf1, 0xc9, 0x11, 0x0, 0x4, 
-0xaf, 0xed, 0x52, 0x3c, 0x30, 0xfb, 0x21, 0xc1, 0xef, 0xd6, 0x8, 0x23, 0x30, 0xfb, 0xc6, 0x8, 
-0x2b, 0x28, 0xfb, 0x6, 0x9, 0xcb, 0x16, 0x3d, 0xc8, 0x10, 0xfa, 0xc9, 0xe5, 0xd5, 0xeb, 0x1a, 
-0xfe, 0x20, 0x28, 0x4, 0xfe, 0x40, 0x38, 0x2, 0xe6, 0xdf, 0xbe, 0x13, 0x23, 0x20, 0xc, 0x10, 
-0xee, 0xd1, 0xd1, 0x6b, 0x62, 0x2b, 0x7e, 0x2b, 0x6e, 0x67, 0xc9, 0xd1, 0xe1, 0xc9, 0x21, 0x0, 
-0xfc, 0xe5, 0x3e, 0xc3, 0xed, 0xa1, 0x20, 0x12, 0x23, 0x23, 0xc5, 0x1, 0xb, 0x1, 0xcd, 0xb8, 
-0xf2, 0xc1, 0x28, 0xc, 0xaf, 0x2b, 0x2b, 0xbe, 0x20, 0xe8, 0xe1, 0x25, 0x20, 0xe3, 0x24, 0xc9, 
-0xc1, 0xc9, 0x1, 0x6, 0x2, 0x21, 0x26, 0xfc, 0x11, 0x1, 0x1, 0xc5, 0x41, 0x5, 0x5, 0xcd, 
-0x6c, 0xf2, 0xc1, 0xc8, 0x79, 0x23, 0x3d, 0x20, 0xfc, 0x10, 0xf0, 0xf6, 0x1, 0xc9, 0xf5, 0x16, 
-0x0, 0x58, 0x78, 0xb7, 0x3a, 0x4, 0x0, 0x28, 0x4, 0xcb, 0x3f, 0x10, 0xfc, 0xcb, 0x23, 0xe6, 
-0x3, 0x83, 0x5f, 0x21, 0xc9, 0xef, 0xf1, 0x19, 0x19, 0xe5, 0x5e, 0x23, 0x56, 0x21, 0xff, 0xff, 
-0xeb, 0xcd, 0xbc, 0xfc, 0xd1, 0x3f, 0xc9, 0xe5, 0xd5, 0xc5, 0xed, 0xb0, 0x18, 0xe, 0x3e, 0xd, 
-0xcd, 0x5, 0xf3, 0x3e, 0xa, 0xe5, 0xd5, 0xc5, 0x4f, 0xcd, 0x83, 0xf7, 0xc1, 0xd1, 0xe1, 0xc9, 
-0x3e, 0x20, 0x18, 0xf1, 0xed, 0x73, 0xb, 0x0, 0x31, 0xc0, 0x1, 0x37, 0x3f, 0xe5, 0xd5, 0xf5, 
-0xed, 0x43, 0xd, 0x0, 0x32, 0xf, 0x0, 0x21, 0x45, 0xf3, 0xe5, 0x3e, 0x21, 0xb9, 0xda, 0xde, 
-0xf5, 0x6, 0x0, 0x21, 0x45, 0xf0, 0x9, 0x9, 0x7e, 0x23, 0x66, 0x6f, 0x4b, 0x42, 0x3a, 0xf, 
-0x0, 0xe5, 0x2e, 0x3, 0xc9, 0x30, 0x6, 0xcd, 0xea, 0xf5, 0xf1, 0x37, 0xf5, 0xf1, 0xd1, 0xe1, 
-0x3a, 0xf, 0x0, 0xed, 0x4b, 0xd, 0x0, 0xed, 0x7b, 0xb, 0x0, 0xc9, 0x11, 0x80, 0x0, 0x3e, 
-0x50, 0x12, 0x3a, 0xf, 0x0, 0x6b, 0x62, 0x23, 0x4d, 0x44, 0x3, 0x36, 0x0, 0x32, 0x35, 0x0, 
-0xe5, 0xd5, 0xc5, 0xcd, 0x7f, 0xf7, 0xc1, 0xd1, 0xe1, 0xd8, 0xe5, 0x21, 0x17, 0x0, 0x34, 0x35, 
-0xe1, 0x20, 0x2b, 0xfe, 0x3, 0x20, 0x3, 0xaf, 0x37, 0xc9, 0xfe, 0x1f, 0x28, 0x1b, 0xfe, 0x2, 
-0x20, 0x7, 0xcd, 0xc6, 0xf3, 0x20, 0xfb, 0x18, 0xd7, 0xfe, 0xd, 0x28, 0x20, 0xfe, 0xb, 0x28, 
-0xcf, 0xfe, 0xa, 0x28, 0xcb, 0xfe, 0x8, 0x20, 0x5, 0xcd, 0xc6, 0xf3, 0x18, 0xc2, 0xfe, 0x10, 
-0x28, 0x3, 0x34, 0x2, 0x3, 0xcd, 0x5, 0xf3, 0xd8, 0x1a, 0xbe, 0x20, 0xb3, 0x3a, 0x35, 0x0, 
-0x32, 0xf, 0x0, 0xc3, 0xfe, 0xf2, 0x34, 0x35, 0xc8, 0xb, 0xa, 0xfe, 0x9, 0x28, 0xc, 0xfe, 
-0x20, 0x38, 0xf4, 0x3e, 0x8, 0xcd, 0x5, 0xf3, 0xcd, 0x10, 0xf3, 0x3e, 0x8, 0xcd, 0x5, 0xf3, 
-0x35, 0xc9, 0x1a, 0xb7, 0x20, 0x6, 0x3a, 0x17, 0x0, 0xb7, 0xc8, 0xaf, 0xcd, 0x5, 0xf3, 0xd8, 
-0x13, 0x18, 0xef, 0x21, 0x3, 0x1, 0x18, 0x38, 0xcd, 0x93, 0xf5, 0x3c, 0xd8, 0xe5, 0xaf, 0x32, 
-0x6c, 0x0, 0xcd, 0x34, 0xf4, 0xe1, 0x22, 0x1b, 0x0, 0xd8, 0xe5, 0x11, 0x11, 0x0, 0x19, 0x11, 
-0x6d, 0x0, 0x1, 0x8, 0x0, 0xed, 0xb0, 0xd1, 0x21, 0x5c, 0x0, 0x6, 0xb, 0xcd, 0x6c, 0xf2, 
-0x3e, 0xd, 0x37, 0xc0, 0x3a, 0x73, 0x0, 0xb7, 0xc8, 0x32, 0xc0, 0xef, 0xc9, 0x21, 0x6d, 0x0, 
-0x22, 0xd, 0x0, 0xc9, 0xcd, 0xd8, 0xf4, 0xd8, 0x22, 0x1b, 0x0, 0x21, 0x6c, 0x0, 0x34, 0xf5, 
-0xcd, 0x10, 0xf3, 0xf1, 0xc9, 0xcd, 0x93, 0xf5, 0x3c, 0xd8, 0xe5, 0x21, 0x5c, 0x0, 0x22, 0x1b, 
-0x0, 0x3e, 0x0, 0x32, 0x73, 0x0, 0x1, 0x70, 0x17, 0xaf, 0x32, 0x6b, 0x0, 0x3e, 0x2, 0x32, 
-0x6c, 0x0, 0xcd, 0x72, 0xf4, 0xe1, 0x22, 0x1b, 0x0, 0xc9, 0x3e, 0xff, 0x32, 0x6b, 0x0, 0x1, 
-0xa0, 0x0, 0xed, 0x5b, 0x1b, 0x0, 0x3a, 0xc0, 0xef, 0xb7, 0x28, 0x4, 0x3e, 0x9, 0x37, 0xc9, 
-0x2a, 0x36, 0x0, 0xd5, 0x11, 0x7f, 0x0, 0xed, 0x52, 0xd1, 0xcd, 0xbc, 0xfc, 0x3e, 0xa, 0x38, 
-0xed, 0xeb, 0xcd, 0x3b, 0xf2, 0x30, 0xe5, 0xcd, 0xd6, 0xfe, 0x22, 0x1b, 0x0, 0x21, 0x6b, 0x0, 
-0x7e, 0x32, 0xf, 0x0, 0x34, 0xc3, 0xe3, 0xfa, 0xd5, 0x1, 0x1d, 0x0, 0x16, 0x3, 0x21, 0x1, 
-0x1, 0xe5, 0x2b, 0x36, 0x3a, 0x23, 0xa, 0xc5, 0xb7, 0x28, 0x7, 0x47, 0xaf, 0xc6, 0x1, 0x27, 
-0x10, 0xfb, 0x77, 0x3e, 0x33, 0xed, 0x67, 0x23, 0x77, 0x23, 0x36, 0x0, 0xc1, 0x3, 0x15, 0x20, 
-0xe2, 0xe1, 0xd1, 0xe, 0x8, 0xc3, 0xf7, 0xf2, 0x2a, 0x36, 0x0, 0x11, 0x7f, 0x0, 0xed, 0x52, 
-0xed, 0x5b, 0x1b, 0x0, 0xcd, 0xbc, 0xfc, 0x3e, 0xa, 0xd8, 0xeb, 0xcd, 0x3b, 0xf2, 0x3e, 0x9, 
-0x30, 0x1d, 0xf5, 0xf1, 0xcd, 0x59, 0xff, 0xcd, 0xe3, 0xfa, 0xf5, 0xe5, 0x21, 0x6c, 0x0, 0x3a, 
-0x6b, 0x0, 0xbe, 0xe1, 0x38, 0xed, 0x28, 0x9, 0xfe, 0xff, 0x28, 0x5, 0xf1, 0x3e, 0xb, 0x37, 
-0xc9, 0xf1, 0x3e, 0xc, 0xd8, 0x3a, 0x6b, 0x0, 0x3c, 0x3e, 0x0, 0x20, 0x1, 0x3c, 0x32, 0xf, 
-0x0, 0xc9, 0xcd, 0xea, 0xf1, 0xc8, 0x21, 0xe6, 0xf5, 0xe5, 0x3a, 0x0, 0x1, 0xfe, 0x9, 0xd0, 
-0x11, 0x5c, 0x0, 0x3e, 0x8, 0xcd, 0x88, 0xf5, 0x8, 0x30, 0xe, 0x8, 0x21, 0x43, 0x4f, 0x22, 
-0x64, 0x0, 0x3e, 0x4d, 0x32, 0x66, 0x0, 0x18, 0x16, 0x79, 0xfe, 0x2e, 0xe1, 0xc2, 0xe2, 0xf5, 
-0xe5, 0xcd, 0xea, 0xf1, 0xc8, 0x3e, 0x3, 0xb8, 0xd8, 0x11, 0x64, 0x0, 0xcd, 0x88, 0xf5, 0xe1, 
-0x8, 0xd2, 0xe2, 0xf5, 0xcd, 0xf8, 0xf3, 0x30, 0x9, 0xb7, 0x37, 0xc8, 0xcd, 0xa3, 0xf5, 0xd8, 
-0x18, 0xf2, 0x2a, 0x6d, 0x0, 0x22, 0x1b, 0x0, 0xcd, 0x34, 0xf4, 0x30, 0x5, 0xcd, 0xa3, 0xf5, 
-0xd8, 0xaf, 0xb7, 0x28, 0xf3, 0xc3, 0xfe, 0xf2, 0x21, 0x1, 0x1, 0x47, 0x7e, 0x12, 0x23, 0x13, 
-0x10, 0xfa, 0xc9, 0x11, 0x48, 0xfc, 0xcd, 0xe2, 0xf3, 0xcd, 0x5c, 0xf3, 0x2a, 0x1b, 0x0, 0xd0, 
-0x3e, 0xff, 0xc9, 0xcd, 0xea, 0xf5, 0xcd, 0x99, 0xf5, 0xd8, 0x3a, 0xf, 0x0, 0xfe, 0x9, 0x37, 
-0x3f, 0xc0, 0xe, 0x1, 0xcd, 0x31, 0xf2, 0xb7, 0xc9, 0x13, 0x1a, 0xb7, 0x28, 0x1e, 0x6b, 0x62, 
-0xe5, 0x23, 0x13, 0x47, 0xe, 0x0, 0xeb, 0x3e, 0x1f, 0xbe, 0x30, 0x5, 0xed, 0xa0, 0x3, 0x3, 
-0x2b, 0x23, 0x10, 0xf5, 0xe1, 0x71, 0xeb, 0x79, 0xb7, 0x36, 0x0, 0xc0, 0x37, 0xc9, 0x3e, 0x7, 
-0x37, 0xc9, 0x3e, 0x2, 0x37, 0xc9, 0x3e, 0x1, 0x37, 0xc9, 0xd0, 0xfe, 0xff, 0x37, 0xc8, 0x32, 
-0xf, 0x0, 0xb7, 0x37, 0xc8, 0xf5, 0xaf, 0x32, 0x15, 0x0, 0xcd, 0xfe, 0xf2, 0xf1, 0x11, 0x5b, 
-0xfc, 0xd6, 0x5, 0x30, 0xc, 0xf5, 0xcd, 0xe2, 0xf3, 0xf1, 0xc6, 0x35, 0xcd, 0x5, 0xf3, 0x18, 
-0x4d, 0xd6, 0x2, 0xd8, 0xf5, 0x11, 0x56, 0xfc, 0xcd, 0xe2, 0xf3, 0x3e, 0x3a, 0xcd, 0x5, 0xf3, 
-0xcd, 0x10, 0xf3, 0xf1, 0x20, 0x4, 0x6, 0x8, 0x18, 0x3, 0x3d, 0x20, 0xf, 0x21, 0xcc, 0xfb, 
-0x11, 0x9, 0x0, 0xcb, 0x38, 0x4, 0x19, 0x10, 0xfd, 0xeb, 0x18, 0x1f, 0x11, 0x62, 0xfc, 0x3d, 
-0x28, 0x19, 0x11, 0x73, 0xfc, 0x3d, 0x28, 0x13, 0x11, 0x81, 0xfc, 0x3d, 0x28, 0xd, 0x11, 0x92, 
-0xfc, 0x3d, 0x28, 0x7, 0x11, 0x9d, 0xfc, 0x3d, 0x28, 0x1, 0x1b, 0xcd, 0xe2, 0xf3, 0xcd, 0xfe, 
-0xf2, 0xaf, 0x37, 0xc9, 0xf3, 0x31, 0x0, 0x2, 0xe, 0x0, 0x2a, 0x36, 0x0, 0x5d, 0x54, 0x13, 
-0x6, 0x1, 0xed, 0xb0, 0x3e, 0x2, 0xed, 0x47, 0x3c, 0xd3, 0x8a, 0x3e, 0xcf, 0xd3, 0x8a, 0xaf, 
-0xd3, 0x8a, 0xd3, 0x88, 0x21, 0x0, 0xfc, 0x6, 0x40, 0x7e, 0x2f, 0x77, 0x56, 0xba, 0x2f, 0x77, 
-0xe, 0x1, 0x28, 0x6, 0xd, 0x2b, 0x22, 0x36, 0x0, 0x23, 0xcd, 0x31, 0xf2, 0x10, 0xea, 0x21, 
-0x14, 0xf3, 0x22, 0x6, 0x0, 0xcd, 0xe0, 0xf6, 0x11, 0x30, 0xfc, 0xcd, 0xe2, 0xf3, 0xf3, 0x31, 
-0x0, 0x2, 0x3e, 0xc3, 0x32, 0x0, 0x0, 0x32, 0x5, 0x0, 0x21, 0xae, 0xf6, 0x22, 0x1, 0x0, 
-0x3a, 0x4, 0x0, 0xe6, 0xfc, 0xf6, 0x1, 0xcd, 0x12, 0xf7, 0x11, 0xf7, 0xfb, 0xcd, 0xe2, 0xf3, 
-0x21, 0x23, 0x0, 0x22, 0x82, 0x0, 0xcd, 0xea, 0xf1, 0xcd, 0x8e, 0xf2, 0xc2, 0x89, 0xf0, 0xe9, 
-0x21, 0xc9, 0xef, 0x11, 0xca, 0xef, 0x1, 0x1f, 0x0, 0x36, 0xff, 0xed, 0xb0, 0x11, 0x0, 0x2, 
-0x21, 0xb0, 0xfc, 0xe, 0xc, 0xed, 0xb0, 0x21, 0x24, 0xfc, 0x22, 0xeb, 0xef, 0x22, 0xed, 0xef, 
-0x22, 0xef, 0xef, 0x21, 0xb4, 0xf7, 0x22, 0xcd, 0xef, 0xaf, 0x32, 0x27, 0x0, 0x32, 0xc0, 0xef, 
-0x3e, 0x1, 0x32, 0x4, 0x0, 0x21, 0x26, 0xfc, 0x22, 0xe9, 0xef, 0x21, 0xf1, 0xf8, 0x22, 0xcb, 
-0xef, 0x22, 0xe3, 0xef, 0xed, 0x5e, 0x11, 0xff, 0xff, 0x1b, 0x7b, 0xb2, 0x20, 0xfb, 0x32, 0x15, 
-0x0, 0x3d, 0xe9, 0x2e, 0x7, 0x18, 0x7, 0x2e, 0x5, 0x59, 0x50, 0x2c, 0x2c, 0x2c, 0x7d, 0xcd, 
-0x58, 0xf7, 0xd8, 0xfe, 0x3, 0xc8, 0x4d, 0x44, 0xfe, 0x6, 0xd0, 0x22, 0xd, 0x0, 0xfe, 0x4, 
-0xc8, 0xed, 0x53, 0xbc, 0x1, 0xc9, 0x3e, 0x0, 0x6, 0x0, 0xc5, 0xd5, 0xcd, 0xce, 0xf2, 0xd1, 
-0x30, 0x4, 0xc1, 0x3e, 0x8, 0xc9, 0xe5, 0x21, 0x6f, 0xf7, 0xe3, 0x32, 0x2f, 0x0, 0xe9, 0xc1, 
-0x4f, 0x38, 0xf0, 0x3a, 0x2f, 0x0, 0xfe, 0x2, 0xd0, 0x79, 0x32, 0xf, 0x0, 0xb7, 0xc9, 0x3e, 
-0x1, 0x18, 0xd5, 0x79, 0xfe, 0x10, 0x20, 0x8, 0x3a, 0x15, 0x0, 0xee, 0x1, 0x32, 0x15, 0x0, 
-0x3e, 0x2, 0xc5, 0xcd, 0x58, 0xf7, 0xe1, 0x4d, 0xd8, 0x3a, 0x15, 0x0, 0xb7, 0xc8, 0x3e, 0x2, 
-0x6, 0x6, 0x18, 0xb6, 0x3e, 0x0, 0x18, 0xf8, 0x3e, 0x1, 0x6, 0x2, 0x18, 0xac, 0x3e, 0x2, 
-0x6, 0x4, 0x18, 0xa6, 0xfe, 0x1, 0x28, 0xf0, 0xfe, 0xff, 0x20, 0xe4, 0xcd, 0xaa, 0xf7, 0xd8, 
-0x3e, 0xff, 0x18, 0xdc, 0xcd, 0x8f, 0xfe, 0xed, 0x4b, 0x13, 0x0, 0xed, 0x43, 0xd, 0x0, 0xc3, 
-0xe9, 0xfa, 0x3a, 0x4, 0x0, 0x32, 0xf, 0x0, 0x4f, 0x79, 0x32, 0x4, 0x0, 0xb7, 0xc9, 0xed, 
-0x43, 0x1b, 0x0, 0xb7, 0xc9, 0x69, 0x60, 0xcd, 0x3b, 0xf2, 0x3e, 0x1, 0x38, 0x1, 0x3d, 0x32, 
-0xf, 0x0, 0xb7, 0xc9, 0x69, 0x60, 0x4f, 0xcd, 0x31, 0xf2, 0xb7, 0xc9, 0x3a, 0x1d, 0x0, 0x32, 
-0xf, 0x0, 0x2a, 0x1e, 0x0, 0x4c, 0x45, 0xed, 0x43, 0xd, 0x0, 0x32, 0x1d, 0x0, 0x68, 0x61, 
-0x22, 0x1e, 0x0, 0xb7, 0xc9, 0x1a, 0xb7, 0x37, 0xc8, 0x3e, 0x2, 0xcd, 0x36, 0xf8, 0xd8, 0x1, 
-0x2, 0x0, 0x1a, 0x13, 0xd6, 0x30, 0xd8, 0xfe, 0xa, 0x3f, 0xd8, 0x80, 0xd, 0xc8, 0x87, 0x47, 
-0x87, 0x87, 0x80, 0x47, 0x18, 0xec, 0x6b, 0x62, 0x13, 0xbe, 0xc8, 0x6, 0x0, 0x4e, 0x38, 0x13, 
-0x77, 0x91, 0x9, 0x5d, 0x54, 0x13, 0xc5, 0xed, 0xb8, 0xc1, 0xeb, 0x36, 0x30, 0xeb, 0x3, 0x3d, 
-0x20, 0xf0, 0xc9, 0xf5, 0x23, 0x23, 0x1a, 0xfe, 0x30, 0x20, 0xa, 0xd, 0xcd, 0xf7, 0xf2, 0x1b, 
-0x79, 0x12, 0xf1, 0x18, 0xd1, 0xf1, 0x37, 0xc9, 0xd6, 0x14, 0x38, 0x15, 0x28, 0x6, 0x6, 0xf8, 
-0x7b, 0xa0, 0xb1, 0xc9, 0x7b, 0x6, 0x8f, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0x18, 
-0xf0, 0xdb, 0x88, 0x6, 0xc7, 0xcd, 0x79, 0xf8, 0xd3, 0x88, 0xf1, 0x18, 0xe, 0x3a, 0x27, 0x0, 
-0x5f, 0x7e, 0xb7, 0x28, 0x9, 0xcd, 0x68, 0xf8, 0x32, 0x27, 0x0, 0xaf, 0x77, 0xc9, 0x79, 0xd6, 
-0x5, 0x28, 0x39, 0x3d, 0x20, 0x5, 0x7b, 0xee, 0x80, 0x18, 0xed, 0x3d, 0x20, 0x1d, 0xf3, 0xcd, 
-0xc4, 0xf8, 0xcd, 0xd, 0xff, 0x1, 0x30, 0x0, 0xcd, 0x31, 0xff, 0xed, 0xa1, 0xea, 0xb8, 0xf8, 
-0x3e, 0x3, 0xd3, 0x80, 0xdb, 0x88, 0xee, 0x80, 0xd3, 0x88, 0xc9, 0xd6, 0xa, 0x20, 0x6, 0x2b, 
-0x7e, 0xee, 0x1, 0x77, 0xc9, 0xd6, 0x3, 0x28, 0x3, 0x3d, 0x20, 0x2, 0x79, 0x77, 0x3d, 0x28, 
-0xa, 0xcd, 0x7d, 0xf9, 0x3a, 0x16, 0x0, 0xb7, 0xc8, 0x18, 0xc3, 0x7b, 0xcd, 0xd6, 0xfa, 0x18, 
-0xa7, 0x21, 0x17, 0x0, 0x3c, 0x20, 0x23, 0xf3, 0x21, 0x0, 0x19, 0x22, 0x3b, 0x0, 0x26, 0x29, 
-0x22, 0x3d, 0x0, 0x26, 0x0, 0x22, 0x23, 0x0, 0x22, 0x25, 0x0, 0x22, 0x13, 0x0, 0x22, 0x16, 
-0x0, 0xdb, 0x88, 0xe6, 0x38, 0xd3, 0x88, 0xc3, 0xe3, 0xfa, 0x3d, 0x20, 0x4, 0x3a, 0x25, 0x0, 
-0xc9, 0x3d, 0x20, 0x21, 0x3a, 0x25, 0x0, 0xb7, 0x28, 0xfa, 0xf5, 0xaf, 0x32, 0x25, 0x0, 0x32, 
-0x13, 0x0, 0x32, 0x14, 0x0, 0x7e, 0xb7, 0x28, 0xa, 0xf1, 0xfe, 0x39, 0x30, 0xe6, 0xd6, 0x31, 
-0x38, 0xe2, 0xf5, 0xf1, 0xc9, 0x3d, 0xca, 0x8d, 0xf8, 0xe, 0x0, 0x3d, 0xca, 0x33, 0xfa, 0x3d, 
-0xca, 0xf3, 0xf9, 0x3d, 0x20, 0x8, 0xcd, 0x7d, 0xf9, 0xed, 0x5b, 0x2b, 0x0, 0xc9, 0x3d, 0x28, 
-0x18, 0x3d, 0x28, 0x19, 0x3d, 0xc0, 0x21, 0x0, 0xec, 0xeb, 0xed, 0x52, 0xd8, 0x11, 0x28, 0x0, 
-0xed, 0x52, 0x3c, 0x30, 0xfb, 0x19, 0x2c, 0x67, 0xeb, 0xed, 0x53, 0x2b, 0x0, 0x21, 0xf3, 0xf9, 
-0xe5, 0xcd, 0x33, 0xfa, 0x79, 0xd6, 0x8, 0xd8, 0x28, 0x4e, 0x3d, 0x28, 0x30, 0x3d, 0x28, 0x3b, 
-0x3d, 0x28, 0x53, 0x3d, 0x28, 0xd, 0x3d, 0x28, 0x1e, 0xfe, 0x13, 0xd8, 0x71, 0x3a, 0x27, 0x0, 
-0x12, 0x18, 0x1a, 0x3a, 0x3b, 0x0, 0x3c, 0x32, 0x2c, 0x0, 0x47, 0x3a, 0x3c, 0x0, 0x90, 0x47, 
-0xc5, 0xcd, 0x4f, 0xfa, 0xc1, 0x10, 0xf9, 0x3a, 0x3d, 0x0, 0x32, 0x2b, 0x0, 0x21, 0x2b, 0x0, 
-0x11, 0x3e, 0x0, 0x34, 0x1a, 0xbe, 0xc0, 0x1b, 0x1a, 0x3c, 0x77, 0x21, 0x2c, 0x0, 0x34, 0x3a, 
-0x3c, 0x0, 0x3d, 0xbe, 0xd0, 0x77, 0x18, 0x77, 0x21, 0x2b, 0x0, 0x11, 0x3d, 0x0, 0x35, 0x1a, 
-0xbe, 0xc0, 0x13, 0x1a, 0x3d, 0x77, 0x21, 0x2c, 0x0, 0x35, 0x3a, 0x3b, 0x0, 0xbe, 0xd8, 0x3c, 
-0x77, 0x18, 0x5d, 0x3a, 0x2b, 0x0, 0x4f, 0x3a, 0x2c, 0x0, 0x47, 0x21, 0xd8, 0xeb, 0x11, 0x28, 
-0x0, 0x19, 0x10, 0xfd, 0x41, 0x2b, 0x23, 0x10, 0xfd, 0x22, 0x2d, 0x0, 0x3a, 0xc8, 0xef, 0xcb, 
-0x6f, 0x20, 0x6, 0x7e, 0x32, 0x3f, 0x0, 0x36, 0xff, 0x11, 0x0, 0x4, 0xe5, 0xed, 0x52, 0x7e, 
-0x32, 0x34, 0x0, 0x3a, 0x27, 0x0, 0xee, 0x80, 0x47, 0xae, 0xe6, 0xf0, 0x78, 0xcc, 0xd6, 0xfa, 
-0x77, 0xe1, 0xc9, 0x2a, 0x2d, 0x0, 0x3a, 0xc8, 0xef, 0xcb, 0x6f, 0x20, 0x4, 0x3a, 0x3f, 0x0, 
-0x77, 0x11, 0x0, 0x4, 0xe5, 0xb7, 0xed, 0x52, 0x3a, 0x34, 0x0, 0x77, 0xeb, 0xe1, 0xc9, 0x3e, 
-0xaf, 0xf5, 0x21, 0xd8, 0xeb, 0x11, 0x28, 0x0, 0x3a, 0x3b, 0x0, 0x3c, 0x4f, 0x3a, 0x3c, 0x0, 
-0x3d, 0x47, 0xf1, 0xc5, 0xb7, 0x28, 0x1, 0x41, 0x19, 0x10, 0xfd, 0xc1, 0xf5, 0x78, 0x91, 0x28, 
-0x37, 0x47, 0xf1, 0xe5, 0xb7, 0x28, 0x3, 0x19, 0x18, 0x2, 0xed, 0x52, 0xd1, 0xf5, 0xe5, 0xc5, 
-0x3a, 0x3d, 0x0, 0x3c, 0x47, 0x2b, 0x1b, 0x23, 0x13, 0x10, 0xfc, 0x4f, 0x3a, 0x3e, 0x0, 0x91, 
-0x4f, 0xcd, 0xf7, 0xf2, 0xc5, 0x1, 0x0, 0x4, 0xeb, 0xed, 0x42, 0xeb, 0xed, 0x42, 0xc1, 0xed, 
-0xb0, 0xc1, 0xe1, 0x11, 0x28, 0x0, 0x10, 0xca, 0xf1, 0x3a, 0x3d, 0x0, 0x3c, 0x4f, 0x47, 0x23, 
-0x10, 0xfd, 0x5d, 0x54, 0x2b, 0x3a, 0x3e, 0x0, 0x91, 0x4f, 0xd, 0x36, 0x20, 0xc5, 0xf5, 0xc4, 
-0xf7, 0xf2, 0x11, 0x0, 0x4, 0xed, 0x52, 0x3a, 0x27, 0x0, 0xcb, 0xbf, 0x77, 0xf1, 0xc1, 0xc8, 
-0x5d, 0x54, 0x13, 0xed, 0xb0, 0xc9, 0xe, 0x0, 0xcb, 0x27, 0xcb, 0x19, 0x7, 0x7, 0x7, 0xe6, 
-0x7f, 0xb1, 0xc9, 0xf3, 0xf5, 0xcd, 0xf7, 0xfa, 0xf1, 0xf5, 0xcd, 0x15, 0xfb, 0x3e, 0x83, 0xd3, 
-0x93, 0xaf, 0xd3, 0x90, 0xf1, 0xfb, 0xc9, 0x3e, 0x3, 0xd3, 0x80, 0xd3, 0x82, 0xd3, 0x8a, 0xaf, 
-0xd3, 0x80, 0x3e, 0xc7, 0xd3, 0x83, 0x3e, 0x40, 0xd3, 0x83, 0x3e, 0x27, 0xd3, 0x82, 0x3e, 0x96, 
-0xd3, 0x82, 0x3e, 0x3, 0xc9, 0x3e, 0xcf, 0xd3, 0x92, 0xaf, 0xd3, 0x92, 0x3e, 0x8, 0xd3, 0x93, 
-0x3e, 0xcf, 0xd3, 0x93, 0x3e, 0xff, 0xd3, 0x93, 0x3e, 0x17, 0xd3, 0x93, 0xaf, 0xd3, 0x93, 0x3d, 
-0xd3, 0x90, 0xc9, 0x18, 0x1e, 0x1f, 0x5d, 0x0, 0x8, 0x9, 0xa, 0xb, 0x2, 0xd, 0x3, 0x20, 
-0x19, 0x13, 0x1a, 0x5e, 0x0, 0x8, 0x9, 0xa, 0xb, 0x1b, 0xd, 0x3, 0x20, 0x0, 0x14, 0x0, 
-0x7e, 0x1c, 0x1d, 0x7d, 0xab, 0x8d, 0x82, 0x85, 0x86, 0x84, 0xcf, 0xc3, 0x96, 0x90, 0x9b, 0x9c, 
-0xaf, 0xc4, 0x95, 0x92, 0xae, 0x87, 0xac, 0x8c, 0x91, 0x83, 0xad, 0x80, 0x81, 0xc2, 0x0, 0x0, 
-0x0, 0x93, 0x0, 0x0, 0xec, 0xed, 0xee, 0xef, 0xf0, 0xca, 0xcc, 0xd0, 0xd1, 0xda, 0xde, 0xfc, 
-0xdf, 0xfd, 0xdb, 0xb3, 0xa0, 0xa1, 0x9e, 0x9f, 0xc0, 0xc7, 0xb4, 0xb0, 0xb1, 0x8f, 0xfe, 0xdc, 
-0xff, 0xdd, 0xbe, 0xb2, 0xa3, 0xf9, 0xaa, 0xa5, 0xa9, 0x88, 0xc8, 0xc6, 0xbc, 0xb6, 0xbb, 0xba, 
-0xfb, 0xfa, 0xbd, 0xb8, 0xa8, 0xc1, 0xa6, 0x89, 0xb5, 0xf8, 0xa4, 0xa2, 0xa7, 0xc5, 0x98, 0x0, 
-0xd7, 0xb9, 0xd2, 0xd3, 0xf2, 0xe0, 0xe2, 0xf4, 0xe8, 0xf5, 0xf6, 0x8a, 0xd4, 0x8b, 0xd8, 0xd9, 
-0xcd, 0xce, 0xd5, 0xd6, 0xea, 0xe7, 0xf3, 0xe6, 0xc9, 0xe1, 0xe9, 0xe3, 0xe4, 0xcb, 0x94, 0x9d, 
-0x97, 0x9a, 0x99, 0xe9, 0xef, 0x43, 0x4f, 0x4e, 0x53, 0x54, 0x20, 0x0, 0xeb, 0xef, 0x52, 0x45, 
-0x41, 0x44, 0x45, 0x52, 0x0, 0xed, 0xef, 0x50, 0x55, 0x4e, 0x43, 0x48, 0x20, 0x0, 0xef, 0xef, 
-0x4c, 0x49, 0x53, 0x54, 0x20, 0x20, 0x0, 0xa, 0xd, 0x4f, 0x53, 0xa, 0xd, 0x0, 0xff, 0xff, 
-0xc3, 0xba, 0xf0, 0x41, 0x53, 0x47, 0x4e, 0x20, 0x20, 0x20, 0x20, 0x0, 0xc3, 0x81, 0xf1, 0x54, 
-0x49, 0x4d, 0x45, 0x20, 0x20, 0x20, 0x20, 0x0, 0xc3, 0x22, 0xf5, 0x43, 0x4c, 0x4f, 0x41, 0x44, 
-0x20, 0x20, 0x20, 0x0, 0x1, 0x0, 0x43, 0x52, 0x54, 0x0, 0x2, 0x0, 0x42, 0x41, 0x54, 0x0, 
-0x14, 0x1, 0xc, 0x72, 0x6f, 0x62, 0x6f, 0x74, 0x72, 0x6f, 0x6e, 0x20, 0x20, 0x5a, 0x20, 0x39, 
-0x30, 0x30, 0x31, 0xa, 0xd, 0x14, 0x2, 0x0, 0xa, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x74, 
-0x61, 0x70, 0x65, 0xa, 0xd, 0x0, 0x7, 0x42, 0x4f, 0x53, 0x2d, 0x65, 0x72, 0x72, 0x6f, 0x72, 
-0x7, 0x0, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 
-0x65, 0x64, 0x0, 0x65, 0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 
-0x0, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 
-0x64, 0x0, 0x62, 0x61, 0x64, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x0, 0x66, 0x69, 0x6c, 
-0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x0, 0x20, 0x2c, 0x2e, 0x3a, 
-0x43, 0xff, 0x0, 0x0, 0xfb, 0xfc, 0xc2, 0xfc, 0xe4, 0xfc, 0xbd, 0xff, 0xe5, 0xb7, 0xed, 0x52, 
-0xe1, 0xc9, 0xfb, 0xe5, 0xc5, 0xf5, 0x21, 0x20, 0x0, 0x6, 0x2, 0x3e, 0x3c, 0x2b, 0x34, 0xbe, 
-0x20, 0xd, 0x36, 0x0, 0x10, 0xf7, 0x3e, 0x18, 0x2b, 0x34, 0xbe, 0x20, 0x2, 0x36, 0x0, 0xf1, 
-0xc1, 0xe1, 0xed, 0x4d, 0xf5, 0x3e, 0xa, 0x32, 0x23, 0x0, 0x3e, 0x7f, 0x32, 0x24, 0x0, 0x3e, 
-0xa5, 0xd3, 0x82, 0x3e, 0x96, 0xd3, 0x82, 0xf1, 0xfb, 0xed, 0x4d, 0xfb, 0xf5, 0xe5, 0x21, 0x23, 
-0x0, 0x35, 0x28, 0x13, 0x3e, 0x7, 0xa6, 0x20, 0x22, 0x23, 0xcd, 0x30, 0xfd, 0x28, 0x1c, 0xbe, 
-0x28, 0x19, 0x2b, 0x36, 0x28, 0x18, 0x7, 0x36, 0x6, 0xcd, 0x33, 0xfd, 0x28, 0xd, 0x23, 0x77, 
-0x3a, 0x25, 0x0, 0xfe, 0x3, 0x28, 0x4, 0x7e, 0x32, 0x25, 0x0, 0xe1, 0xf1, 0xfb, 0xed, 0x4d, 
-0x7e, 0xb7, 0xc8, 0xe5, 0xd5, 0xc5, 0x21, 0x68, 0xfe, 0xe5, 0xcd, 0x8f, 0xfe, 0x7a, 0xb7, 0xc8, 
-0x7b, 0xb7, 0xc8, 0x3a, 0x26, 0x0, 0xb7, 0x28, 0x6, 0xcb, 0xc3, 0xcb, 0xfa, 0xcb, 0xbd, 0xe5, 
-0xd5, 0x5a, 0xe, 0x8, 0xcd, 0x81, 0xfe, 0x67, 0xcd, 0x89, 0xfe, 0x6f, 0xd1, 0xc1, 0xc0, 0xc5, 
-0xe, 0x1, 0xaf, 0xcd, 0x83, 0xfe, 0xf5, 0x84, 0x67, 0xf1, 0x85, 0xbf, 0xcd, 0x89, 0xfe, 0x6f, 
-0xc1, 0xc0, 0xdb, 0x88, 0x5f, 0x7d, 0xfe, 0x48, 0x28, 0x6e, 0xfe, 0x41, 0x28, 0x6, 0xfe, 0x46, 
-0x20, 0xd, 0x3e, 0xa9, 0xd6, 0x2c, 0x6f, 0x7c, 0xfe, 0x38, 0xc0, 0x7d, 0xc3, 0x38, 0xfe, 0xfe, 
-0x40, 0x28, 0x6b, 0xd0, 0xd6, 0x39, 0xd8, 0x84, 0xcb, 0x78, 0x28, 0x2d, 0x1, 0x90, 0x0, 0x26, 
-0x5, 0xed, 0x61, 0xc, 0xed, 0x60, 0xd, 0xed, 0x41, 0xcb, 0x7c, 0xc8, 0x3c, 0xfe, 0xc, 0x38, 
-0x64, 0x28, 0x60, 0xfe, 0xe, 0x38, 0x5e, 0x28, 0x5a, 0xfe, 0xf, 0x28, 0x58, 0xd6, 0x2b, 0x38, 
-0x4e, 0xfe, 0xd, 0xd0, 0x21, 0x33, 0xfb, 0x18, 0x55, 0x3d, 0xd6, 0xa, 0xd8, 0xd6, 0x6, 0xc8, 
-0x30, 0xd, 0xfe, 0xfa, 0x20, 0x2, 0xd6, 0x1f, 0xcb, 0x73, 0xc8, 0xd6, 0x80, 0x18, 0x38, 0xfe, 
-0x1b, 0x38, 0x34, 0xfe, 0x1e, 0xc0, 0x18, 0x2f, 0x7c, 0xfe, 0xc, 0x38, 0x26, 0x28, 0x26, 0xfe, 
-0xe, 0x38, 0x20, 0x28, 0x20, 0xd6, 0x2b, 0x38, 0x18, 0x21, 0x40, 0xfb, 0x18, 0x20, 0x78, 0xa9, 
-0xba, 0xc0, 0x3e, 0x3, 0xa4, 0x7c, 0x20, 0xc2, 0xb7, 0x20, 0xa2, 0x3e, 0x5f, 0x18, 0x8, 0xc6, 
-0x20, 0xc6, 0x2b, 0xc6, 0x10, 0xc6, 0x20, 0xcb, 0x73, 0x28, 0x1d, 0x21, 0x53, 0xfb, 0x6, 0x0, 
-0x4f, 0x9, 0x7e, 0xfe, 0x5e, 0x28, 0xf0, 0xfe, 0x5d, 0x28, 0xec, 0xb7, 0xe1, 0x20, 0xa, 0x3e, 
-0x7f, 0x32, 0x24, 0x0, 0x3e, 0xa, 0x18, 0x43, 0xe1, 0xfe, 0x7e, 0x20, 0xd, 0x7b, 0xee, 0x40, 
-0xd3, 0x88, 0xaf, 0x32, 0x24, 0x0, 0x3e, 0x28, 0x18, 0x31, 0xfe, 0x7d, 0x20, 0xa, 0x3a, 0x26, 
-0x0, 0xee, 0x1, 0x32, 0x26, 0x0, 0x18, 0xea, 0xc1, 0xd1, 0xe1, 0xfe, 0x5d, 0x28, 0x6, 0xfe, 
-0x60, 0x20, 0x3, 0xd6, 0x21, 0x3c, 0xb7, 0xc9, 0x3e, 0x83, 0xd3, 0x93, 0xaf, 0xd3, 0x90, 0x3e, 
-0x25, 0xd3, 0x82, 0x3e, 0x96, 0xd3, 0x82, 0xaf, 0x32, 0x24, 0x0, 0x32, 0x23, 0x0, 0xaf, 0x18, 
-0xd7, 0x3e, 0xf7, 0x6, 0x8, 0x81, 0xcb, 0x3b, 0xd8, 0x10, 0xfa, 0xc0, 0x81, 0xbf, 0xc9, 0xf3, 
-0xdb, 0x91, 0x2f, 0x57, 0x3e, 0x3, 0xd3, 0x93, 0x3e, 0xfb, 0xd3, 0x90, 0xdb, 0x91, 0x67, 0x3e, 
-0xfe, 0xd3, 0x90, 0xdb, 0x91, 0x6f, 0x3e, 0xcf, 0xd3, 0x92, 0x3e, 0xff, 0xd3, 0x92, 0x3e, 0xcf, 
-0xd3, 0x93, 0xaf, 0xd3, 0x93, 0xd3, 0x91, 0xdb, 0x90, 0x2f, 0x5f, 0x3e, 0x80, 0xd3, 0x91, 0xdb, 
-0x90, 0x2f, 0x32, 0x13, 0x0, 0x3e, 0x40, 0xd3, 0x91, 0xdb, 0x90, 0x2f, 0x32, 0x14, 0x0, 0xcd, 
-0x15, 0xfb, 0xaf, 0xd3, 0x90, 0xc9, 0xf3, 0xaf, 0x32, 0x69, 0x0, 0xcd, 0xa, 0xfb, 0xd3, 0x93, 
-0xcd, 0xd, 0xff, 0xcd, 0x31, 0xff, 0xed, 0xa1, 0xea, 0xe3, 0xfe, 0xcd, 0x29, 0xff, 0x3a, 0x6b, 
-0x0, 0xcd, 0x18, 0xff, 0x2a, 0x1b, 0x0, 0x6, 0x80, 0x7e, 0xcd, 0x18, 0xff, 0x3a, 0x69, 0x0, 
-0x86, 0x32, 0x69, 0x0, 0x23, 0x10, 0xf2, 0xcd, 0x18, 0xff, 0x7a, 0x18, 0x2b, 0x3e, 0x85, 0xd3, 
-0x80, 0x3e, 0x40, 0xd3, 0x80, 0xfb, 0x57, 0xc9, 0xc5, 0x4f, 0x6, 0x8, 0xcb, 0x9, 0xf5, 0xdc, 
-0x31, 0xff, 0xf1, 0xd4, 0x2d, 0xff, 0x10, 0xf4, 0xc1, 0x1e, 0x80, 0x18, 0x6, 0x1e, 0x20, 0x18, 
-0x2, 0x1e, 0x40, 0x7a, 0xcd, 0x38, 0xff, 0x7a, 0x32, 0x6a, 0x0, 0x3a, 0x6a, 0x0, 0xb7, 0x20, 
-0xfa, 0x53, 0xc9, 0xf5, 0x3e, 0x3, 0xd3, 0x80, 0x3e, 0x85, 0xd3, 0x80, 0x3a, 0x6a, 0x0, 0xd3, 
-0x80, 0xaf, 0x32, 0x6a, 0x0, 0xf1, 0xfb, 0xed, 0x4d, 0xf3, 0xcd, 0xa, 0xfb, 0xd3, 0x93, 0xd3, 
-0x8a, 0x3e, 0x5, 0xd3, 0x80, 0x3e, 0xb0, 0xd3, 0x80, 0x3e, 0xf, 0xd3, 0x8a, 0x3e, 0xa, 0xd3, 
-0x8a, 0x3e, 0xe7, 0xd3, 0x8a, 0xfb, 0x6, 0x16, 0xcd, 0xd1, 0xff, 0x38, 0xf9, 0xfe, 0x90, 0x38, 
-0xf5, 0x10, 0xf5, 0x6, 0x2, 0xaf, 0x32, 0x69, 0x0, 0x4f, 0x32, 0x6a, 0x0, 0xcd, 0xe0, 0xff, 
-0xfe, 0x52, 0x30, 0xf1, 0x10, 0xef, 0xcd, 0xe8, 0xff, 0xd8, 0x32, 0x6b, 0x0, 0x6, 0x80, 0x2a, 
-0x1b, 0x0, 0xcd, 0xe8, 0xff, 0xd8, 0x77, 0x3a, 0x69, 0x0, 0x86, 0x32, 0x69, 0x0, 0x23, 0x10, 
-0xf1, 0xcd, 0xe8, 0xff, 0xd8, 0x47, 0x3a, 0x69, 0x0, 0xb8, 0xc8, 0x37, 0xc9, 0xf5, 0xdb, 0x80, 
-0xf5, 0x3e, 0x7, 0xd3, 0x80, 0x3e, 0xb0, 0xd3, 0x80, 0xf1, 0x32, 0x6a, 0x0, 0xf1, 0xfb, 0xed, 
-0x4d, 0xaf, 0x32, 0x6a, 0x0, 0x3a, 0x6a, 0x0, 0xb7, 0x28, 0xfa, 0x4f, 0xaf, 0x32, 0x6a, 0x0, 
-0x3a, 0x6a, 0x0, 0xb7, 0x28, 0xfa, 0x81, 0xc9, 0x16, 0x8, 0xaf, 0x5f, 0xcd, 0xd1, 0xff, 0x3f, 
-0x30, 0x4, 0xfe, 0x90, 0xd8, 0x37, 0xcb, 0x1b, 0x15, 0x20, 0xf1, 0xcd, 0xd1, 0xff, 0x7b, 0xc9, 
-
-};
-unsigned char dump_kc87_font_2[2048] = {
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x10, 0x10, 0x10, 0x0, 0x0, 0x10, 0x0, 
-0x28, 0x28, 0x28, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x28, 0x7c, 0x28, 0x7c, 0x28, 0x28, 0x0, 
-0x10, 0x3c, 0x50, 0x38, 0x14, 0x78, 0x10, 0x0, 0x60, 0x64, 0x8, 0x10, 0x20, 0x4c, 0xc, 0x0, 
-0x10, 0x28, 0x28, 0x30, 0x54, 0x48, 0x34, 0x0, 0x10, 0x10, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x8, 0x10, 0x20, 0x20, 0x20, 0x10, 0x8, 0x0, 0x20, 0x10, 0x8, 0x8, 0x8, 0x10, 0x20, 0x0, 
-0x0, 0x10, 0x54, 0x38, 0x54, 0x10, 0x0, 0x0, 0x0, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x10, 0x10, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x4, 0x8, 0x10, 0x20, 0x40, 0x0, 0x0, 
-0x38, 0x44, 0x4c, 0x54, 0x64, 0x44, 0x38, 0x0, 0x10, 0x30, 0x10, 0x10, 0x10, 0x10, 0x38, 0x0, 
-0x38, 0x44, 0x4, 0x8, 0x10, 0x20, 0x7c, 0x0, 0x7c, 0x8, 0x10, 0x8, 0x4, 0x44, 0x38, 0x0, 
-0x8, 0x18, 0x28, 0x48, 0x7c, 0x8, 0x8, 0x0, 0x7c, 0x40, 0x78, 0x4, 0x4, 0x44, 0x38, 0x0, 
-0x18, 0x20, 0x40, 0x78, 0x44, 0x44, 0x38, 0x0, 0x7c, 0x4, 0x8, 0x10, 0x20, 0x20, 0x20, 0x0, 
-0x38, 0x44, 0x44, 0x38, 0x44, 0x44, 0x38, 0x0, 0x38, 0x44, 0x44, 0x3c, 0x4, 0x8, 0x30, 0x0, 
-0x0, 0x30, 0x30, 0x0, 0x30, 0x30, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x10, 0x10, 0x20, 0x0, 
-0x8, 0x10, 0x20, 0x40, 0x20, 0x10, 0x8, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x7c, 0x0, 0x0, 0x0, 
-0x20, 0x10, 0x8, 0x4, 0x8, 0x10, 0x20, 0x0, 0x38, 0x44, 0x4, 0x8, 0x10, 0x10, 0x10, 0x0, 
-0x38, 0x44, 0x5c, 0x54, 0x5c, 0x40, 0x3c, 0x0, 0x38, 0x44, 0x44, 0x7c, 0x44, 0x44, 0x44, 0x0, 
-0x78, 0x44, 0x44, 0x78, 0x44, 0x44, 0x78, 0x0, 0x38, 0x44, 0x40, 0x40, 0x40, 0x44, 0x38, 0x0, 
-0x78, 0x24, 0x24, 0x24, 0x24, 0x24, 0x78, 0x0, 0x7c, 0x40, 0x40, 0x78, 0x40, 0x40, 0x7c, 0x0, 
-0x7c, 0x40, 0x40, 0x78, 0x40, 0x40, 0x40, 0x0, 0x38, 0x44, 0x40, 0x40, 0x4c, 0x44, 0x3c, 0x0, 
-0x44, 0x44, 0x44, 0x7c, 0x44, 0x44, 0x44, 0x0, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x0, 
-0x1c, 0x8, 0x8, 0x8, 0x8, 0x48, 0x30, 0x0, 0x44, 0x48, 0x50, 0x60, 0x50, 0x48, 0x44, 0x0, 
-0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7c, 0x0, 0x44, 0x6c, 0x54, 0x54, 0x44, 0x44, 0x44, 0x0, 
-0x44, 0x44, 0x64, 0x54, 0x4c, 0x44, 0x44, 0x0, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x0, 
-0x78, 0x44, 0x44, 0x78, 0x40, 0x40, 0x40, 0x0, 0x38, 0x44, 0x44, 0x44, 0x54, 0x48, 0x34, 0x0, 
-0x78, 0x44, 0x44, 0x78, 0x50, 0x48, 0x44, 0x0, 0x3c, 0x40, 0x40, 0x38, 0x4, 0x4, 0x78, 0x0, 
-0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x0, 
-0x44, 0x44, 0x44, 0x44, 0x44, 0x28, 0x10, 0x0, 0x44, 0x44, 0x44, 0x54, 0x54, 0x6c, 0x44, 0x0, 
-0x44, 0x44, 0x28, 0x10, 0x28, 0x44, 0x44, 0x0, 0x44, 0x44, 0x44, 0x28, 0x10, 0x10, 0x10, 0x0, 
-0x7c, 0x4, 0x8, 0x10, 0x20, 0x40, 0x7c, 0x0, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38, 0x0, 
-0x0, 0x40, 0x20, 0x10, 0x8, 0x4, 0x0, 0x0, 0x38, 0x8, 0x8, 0x8, 0x8, 0x8, 0x38, 0x0, 
-0x10, 0x28, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 
-0x0, 0x20, 0x10, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x34, 0x4c, 0x44, 0x44, 0x3a, 0x0, 
-0x40, 0x40, 0x58, 0x64, 0x44, 0x44, 0x78, 0x0, 0x0, 0x0, 0x38, 0x44, 0x40, 0x44, 0x38, 0x0, 
-0x4, 0x4, 0x34, 0x4c, 0x44, 0x44, 0x3a, 0x0, 0x0, 0x0, 0x38, 0x44, 0x7c, 0x40, 0x38, 0x0, 
-0x8, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x0, 0x0, 0x0, 0x34, 0x4c, 0x44, 0x3c, 0x4, 0x38, 
-0x40, 0x40, 0x58, 0x64, 0x44, 0x44, 0x44, 0x0, 0x10, 0x0, 0x10, 0x10, 0x10, 0x10, 0x8, 0x0, 
-0x10, 0x0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x40, 0x40, 0x48, 0x50, 0x70, 0x48, 0x44, 0x0, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x8, 0x0, 0x0, 0x0, 0x68, 0x54, 0x54, 0x54, 0x54, 0x0, 
-0x0, 0x0, 0x58, 0x64, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x38, 0x44, 0x44, 0x44, 0x38, 0x0, 
-0x0, 0x0, 0x58, 0x64, 0x44, 0x78, 0x40, 0x40, 0x0, 0x0, 0x34, 0x4c, 0x44, 0x3c, 0x4, 0x4, 
-0x0, 0x0, 0x58, 0x64, 0x40, 0x40, 0x40, 0x0, 0x0, 0x0, 0x38, 0x40, 0x38, 0x4, 0x78, 0x0, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x8, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x4c, 0x34, 0x0, 
-0x0, 0x0, 0x44, 0x44, 0x44, 0x28, 0x10, 0x0, 0x0, 0x0, 0x54, 0x54, 0x54, 0x54, 0x28, 0x0, 
-0x0, 0x0, 0x44, 0x28, 0x10, 0x28, 0x44, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x3c, 0x4, 0x38, 
-0x0, 0x0, 0x7c, 0x8, 0x10, 0x20, 0x7c, 0x0, 0x8, 0x10, 0x10, 0x20, 0x10, 0x10, 0x8, 0x0, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0, 0x20, 0x10, 0x10, 0x8, 0x10, 0x10, 0x20, 0x0, 
-0x0, 0x0, 0x0, 0x32, 0x4c, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xc0, 0x20, 0x10, 0x10, 0x10, 0x10, 0x20, 0xc0, 0x3, 0x4, 0x8, 0x8, 0x8, 0x8, 0x4, 0x3, 
-0x81, 0x81, 0x42, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x42, 0x81, 0x81, 
-0x10, 0x10, 0x20, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x4, 0x3, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x3, 0x4, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x20, 0x10, 0x10, 
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0xff, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
-0x0, 0x10, 0x28, 0x44, 0x82, 0x44, 0x28, 0x10, 0xff, 0xef, 0xc7, 0x83, 0x1, 0x83, 0xc7, 0xef, 
-0x3c, 0x42, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3c, 0xc3, 0x81, 0x0, 0x0, 0x0, 0x0, 0x81, 0xc3, 
-0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 
-0x1, 0x2, 0x4, 0x8, 0x10, 0x20, 0x40, 0x80, 0x80, 0x40, 0x20, 0x10, 0x8, 0x4, 0x2, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x3, 0xc, 0x30, 0xc0, 0x3, 0xc, 0x30, 0xc0, 0x0, 0x0, 0x0, 0x0, 
-0x3, 0xc, 0x30, 0xc0, 0xc0, 0x30, 0xc, 0x3, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x30, 0xc, 0x3, 
-0xc0, 0x30, 0xc, 0x3, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x30, 0xc, 0x3, 0x3, 0xc, 0x30, 0xc0, 
-0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x80, 0x1, 0x1, 0x2, 0x2, 0x4, 0x4, 0x8, 0x8, 
-0x81, 0x81, 0x42, 0x42, 0x24, 0x24, 0x18, 0x18, 0x80, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 
-0x8, 0x8, 0x4, 0x4, 0x2, 0x2, 0x1, 0x1, 0x18, 0x18, 0x24, 0x24, 0x42, 0x42, 0x81, 0x81, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0xff, 0xff, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x18, 0x18, 0x18, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0xf8, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x1f, 0x1f, 0x18, 0x18, 0x18, 0x0, 0x0, 0x0, 0xf8, 0xf8, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0xf8, 0xf8, 0x0, 0x0, 0x0, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x18, 0x7, 
-0x1, 0x1, 0x1, 0x2, 0x2, 0x4, 0x18, 0xe0, 0xe0, 0x18, 0x4, 0x2, 0x2, 0x1, 0x1, 0x1, 
-0x7, 0x18, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x81, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x81, 
-0xf0, 0xf0, 0xf0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xf0, 0xf0, 0xf0, 
-0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 
-0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 
-0xf0, 0xf0, 0xf0, 0xf0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf0, 0xf0, 0xf0, 0xf0, 
-0xf, 0xf, 0xf, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf, 0xf, 0xf, 0xf, 
-0x1, 0x3, 0x7, 0xf, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0xf, 0x7, 0x3, 0x1, 
-0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-0xff, 0x80, 0x80, 0x9c, 0x9c, 0x9c, 0x80, 0x80, 0xff, 0xff, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xff, 
-0x18, 0x3c, 0x7e, 0x3c, 0x18, 0x3c, 0x7e, 0xff, 0xff, 0x0, 0xff, 0x0, 0xff, 0x0, 0xff, 0x0, 
-0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 
-0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xff, 0x0, 0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x38, 0x10, 
-0x38, 0x10, 0x92, 0xfe, 0x92, 0x10, 0x38, 0x7c, 0x0, 0x6c, 0xfe, 0xfe, 0xfe, 0x7c, 0x38, 0x10, 
-0x10, 0x38, 0x7c, 0xfe, 0xfe, 0x7c, 0x10, 0x7c, 0xe7, 0xe7, 0x42, 0xff, 0xff, 0x42, 0xe7, 0xe7, 
-0xdb, 0xff, 0xdb, 0x18, 0x18, 0xdb, 0xff, 0xdb, 0x3c, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x3c, 
-0xc0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xc, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0xc0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0xc, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0xc0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x30, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x3f, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xfc, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0xc0, 
-0x0, 0x0, 0x0, 0x0, 0xc0, 0xc0, 0xc0, 0xc0, 0x0, 0x0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x0, 0x0, 
-0xc0, 0xc0, 0xc0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xf0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 
-0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 
-0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-
-};
-unsigned char dump_z9001_basic[8192] = {
-0x18, 0xb, 0xc3, 0x8c, 0xc0, 0x7f, 0x7f, 0x42, 0x41, 0x53, 0x49, 0x43, 0x0, 0x21, 0xbd, 0xc0, 
-0x11, 0x0, 0x3, 0x1, 0x67, 0x0, 0xed, 0xb0, 0xeb, 0xf9, 0xcd, 0x69, 0xc6, 0x32, 0xab, 0x3, 
-0x32, 0x0, 0x4, 0x21, 0x92, 0xc0, 0xcd, 0xc9, 0xd1, 0x21, 0xae, 0xc0, 0xcd, 0xc9, 0xd1, 0xcd, 
-0xae, 0xc5, 0x21, 0x62, 0x3, 0xcd, 0x86, 0xc9, 0x7a, 0xd6, 0x6, 0x21, 0x0, 0x3, 0x2b, 0x30, 
-0x3, 0x11, 0xff, 0xbf, 0x23, 0xcd, 0x89, 0xc6, 0x28, 0x9, 0x7e, 0x47, 0x2f, 0x77, 0xbe, 0x70, 
-0x28, 0xf2, 0x2b, 0x11, 0x0, 0xff, 0x22, 0xb0, 0x3, 0x19, 0x22, 0x56, 0x3, 0xcd, 0x41, 0xc6, 
-0x2a, 0x56, 0x3, 0x11, 0xef, 0xfb, 0x19, 0xcd, 0x29, 0xd8, 0x21, 0xa0, 0xc0, 0xcd, 0xc9, 0xd1, 
-0x2a, 0x4, 0xe0, 0x7e, 0xfe, 0x78, 0x20, 0x1, 0x3e, 0xaf, 0x32, 0xfc, 0x3, 0x31, 0x67, 0x3, 
-0x18, 0xa, 0x7f, 0x7f, 0x52, 0x45, 0x42, 0x41, 0x53, 0x49, 0x43, 0x0, 0xcd, 0x69, 0xc6, 0xc3, 
-0x88, 0xc3, 0xc, 0xa, 0xd, 0x48, 0x43, 0x2d, 0x42, 0x41, 0x53, 0x49, 0x43, 0xa, 0xd, 0x0, 
-0x20, 0x42, 0x59, 0x54, 0x45, 0x53, 0x20, 0x46, 0x52, 0x45, 0x45, 0xa, 0xd, 0x0, 0x4d, 0x45, 
-0x4d, 0x4f, 0x52, 0x59, 0x20, 0x45, 0x4e, 0x44, 0x20, 0x3f, 0x20, 0x3a, 0x0, 0xc3, 0x89, 0xc0, 
-0xc3, 0x67, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x6f, 0x7c, 0xde, 0x0, 0x67, 0x78, 
-0xde, 0x0, 0x47, 0x3e, 0x0, 0xc9, 0x0, 0x0, 0x0, 0x35, 0x4a, 0xca, 0x99, 0x39, 0x1c, 0x76, 
-0x98, 0x22, 0x95, 0xb3, 0x98, 0xa, 0xdd, 0x47, 0x98, 0x53, 0xd1, 0x99, 0x99, 0xa, 0x1a, 0x9f, 
-0x98, 0x65, 0xbc, 0xcd, 0x98, 0xd6, 0x77, 0x3e, 0x98, 0x52, 0xc7, 0x4f, 0x80, 0xb, 0xff, 0x1b, 
-0x0, 0xa, 0x0, 0xa, 0x0, 0x0, 0x0, 0xc3, 0xae, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x65, 0x4, 0xfe, 0xff, 0x0, 0x0, 0xc9, 0x0, 0x0, 0x1, 0x4, 0x0, 0x0, 
-0x0, 0xc5, 0x4e, 0x44, 0xc6, 0x4f, 0x52, 0xce, 0x45, 0x58, 0x54, 0xc4, 0x41, 0x54, 0x41, 0xc9, 
-0x4e, 0x50, 0x55, 0x54, 0xc4, 0x49, 0x4d, 0xd2, 0x45, 0x41, 0x44, 0xcc, 0x45, 0x54, 0xc7, 0x4f, 
-0x54, 0x4f, 0xd2, 0x55, 0x4e, 0xc9, 0x46, 0xd2, 0x45, 0x53, 0x54, 0x4f, 0x52, 0x45, 0xc7, 0x4f, 
-0x53, 0x55, 0x42, 0xd2, 0x45, 0x54, 0x55, 0x52, 0x4e, 0xd2, 0x45, 0x4d, 0xd3, 0x54, 0x4f, 0x50, 
-0xcf, 0x55, 0x54, 0xcf, 0x4e, 0xce, 0x55, 0x4c, 0x4c, 0xd7, 0x41, 0x49, 0x54, 0xc4, 0x45, 0x46, 
-0xd0, 0x4f, 0x4b, 0x45, 0xc4, 0x4f, 0x4b, 0x45, 0xc1, 0x55, 0x54, 0x4f, 0xcc, 0x49, 0x4e, 0x45, 
-0x53, 0xc3, 0x4c, 0x53, 0xd7, 0x49, 0x44, 0x54, 0x48, 0xc2, 0x59, 0x45, 0xa1, 0xc3, 0x41, 0x4c, 
-0x4c, 0xd0, 0x52, 0x49, 0x4e, 0x54, 0xc3, 0x4f, 0x4e, 0x54, 0xcc, 0x49, 0x53, 0x54, 0xc3, 0x4c, 
-0x45, 0x41, 0x52, 0xc3, 0x4c, 0x4f, 0x41, 0x44, 0xc3, 0x53, 0x41, 0x56, 0x45, 0xce, 0x45, 0x57, 
-0xd4, 0x41, 0x42, 0x28, 0xd4, 0x4f, 0xc6, 0x4e, 0xd3, 0x50, 0x43, 0x28, 0xd4, 0x48, 0x45, 0x4e, 
-0xce, 0x4f, 0x54, 0xd3, 0x54, 0x45, 0x50, 0xab, 0xad, 0xaa, 0xaf, 0xde, 0xc1, 0x4e, 0x44, 0xcf, 
-0x52, 0xbe, 0xbd, 0xbc, 0xd3, 0x47, 0x4e, 0xc9, 0x4e, 0x54, 0xc1, 0x42, 0x53, 0xd5, 0x53, 0x52, 
-0xc6, 0x52, 0x45, 0xc9, 0x4e, 0x50, 0xd0, 0x4f, 0x53, 0xd3, 0x51, 0x52, 0xd2, 0x4e, 0x44, 0xcc, 
-0x4e, 0xc5, 0x58, 0x50, 0xc3, 0x4f, 0x53, 0xd3, 0x49, 0x4e, 0xd4, 0x41, 0x4e, 0xc1, 0x54, 0x4e, 
-0xd0, 0x45, 0x45, 0x4b, 0xc4, 0x45, 0x45, 0x4b, 0xd0, 0x49, 0xcc, 0x45, 0x4e, 0xd3, 0x54, 0x52, 
-0x24, 0xd6, 0x41, 0x4c, 0xc1, 0x53, 0x43, 0xc3, 0x48, 0x52, 0x24, 0xcc, 0x45, 0x46, 0x54, 0x24, 
-0xd2, 0x49, 0x47, 0x48, 0x54, 0x24, 0xcd, 0x49, 0x44, 0x24, 0xcc, 0x4f, 0x41, 0x44, 0xd4, 0x52, 
-0x4f, 0x4e, 0xd4, 0x52, 0x4f, 0x46, 0x46, 0xc5, 0x44, 0x49, 0x54, 0xc5, 0x4c, 0x53, 0x45, 0x80, 
-0x1a, 0xc9, 0xde, 0xc7, 0xdc, 0xcc, 0x48, 0xca, 0xec, 0xcb, 0x1, 0xcf, 0x1f, 0xcc, 0x5d, 0xca, 
-0x7, 0xca, 0xeb, 0xc9, 0xcf, 0xca, 0xdf, 0xc8, 0xf6, 0xc9, 0x25, 0xca, 0x4a, 0xca, 0x18, 0xc9, 
-0xec, 0xd3, 0xb3, 0xca, 0xc0, 0xcb, 0xf7, 0xd3, 0xc4, 0xd0, 0x37, 0xd4, 0x4e, 0xd4, 0xfa, 0xc5, 
-0xea, 0xc6, 0xd0, 0xdd, 0xb9, 0xcb, 0xf4, 0xdf, 0x4a, 0xca, 0x38, 0xdb, 0xfa, 0xca, 0x48, 0xc9, 
-0xf2, 0xc6, 0xaa, 0xc9, 0x43, 0xdc, 0x41, 0xdd, 0x40, 0xc6, 0x2d, 0xc6, 0xb7, 0xc7, 0xb8, 0xc7, 
-0xe7, 0xc3, 0x4a, 0xca, 0xa6, 0xd6, 0x70, 0xd7, 0xbc, 0xd6, 0x3, 0x3, 0x90, 0xd0, 0xe3, 0xd3, 
-0xbd, 0xd0, 0x1f, 0xd9, 0xfd, 0xd9, 0x59, 0xd5, 0x6d, 0xd9, 0x70, 0xda, 0x76, 0xda, 0xd7, 0xda, 
-0xec, 0xda, 0x31, 0xd4, 0x44, 0xd4, 0xd5, 0xd6, 0x2c, 0xd3, 0x56, 0xd1, 0xbf, 0xd3, 0x3b, 0xd3, 
-0x4b, 0xd3, 0x5b, 0xd3, 0x89, 0xd3, 0x92, 0xd3, 0x79, 0x11, 0xd8, 0x79, 0x6a, 0xd4, 0x7c, 0x98, 
-0xd5, 0x7c, 0xf3, 0xd5, 0x7f, 0x28, 0xd9, 0x50, 0x5e, 0xce, 0x46, 0x5d, 0xce, 0x4e, 0x46, 0x53, 
-0x4e, 0x52, 0x47, 0x4f, 0x44, 0x46, 0x43, 0x4f, 0x56, 0x4f, 0x4d, 0x55, 0x4c, 0x42, 0x53, 0x44, 
-0x44, 0x2f, 0x30, 0x49, 0x44, 0x54, 0x4d, 0x4f, 0x53, 0x4c, 0x53, 0x53, 0x54, 0x43, 0x4e, 0x55, 
-0x46, 0x4d, 0x4f, 0x49, 0x4f, 0x20, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x7, 0x0, 0x20, 0x49, 0x4e, 
-0x20, 0x0, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x46, 0x4f, 0x55, 0x4e, 0x44, 0xd, 0x4f, 0x4b, 0xd, 
-0x0, 0x42, 0x52, 0x45, 0x41, 0x4b, 0x0, 0xe5, 0x2a, 0xdb, 0x3, 0x6, 0x0, 0x9, 0x9, 0x3e, 
-0xe5, 0x3e, 0xd0, 0x95, 0x6f, 0x3e, 0xff, 0x9c, 0x38, 0x4, 0x67, 0x39, 0xe1, 0xd8, 0x1e, 0xc, 
-0x18, 0x14, 0x2a, 0xca, 0x3, 0x22, 0x58, 0x3, 0x1e, 0x2, 0x1, 0x1e, 0x14, 0x1, 0x1e, 0x0, 
-0x1, 0x1e, 0x12, 0x1, 0x1e, 0x22, 0xcd, 0x69, 0xc6, 0x32, 0x43, 0x3, 0xcd, 0x55, 0xcb, 0x21, 
-0xdd, 0xc2, 0x57, 0x19, 0x44, 0x4d, 0xb, 0x3e, 0x3f, 0x1e, 0x3, 0xcd, 0xd6, 0xd1, 0x21, 0x5, 
-0xc3, 0xcd, 0xc9, 0xd1, 0x2a, 0x58, 0x3, 0x11, 0xfe, 0xff, 0xcd, 0x89, 0xc6, 0xca, 0xd, 0xc0, 
-0x7c, 0xa5, 0x3c, 0xc4, 0x21, 0xd8, 0x3e, 0xc1, 0xaf, 0x32, 0x43, 0x3, 0xcd, 0x55, 0xcb, 0x21, 
-0x1d, 0xc3, 0xcd, 0xc9, 0xd1, 0x37, 0xdc, 0xfd, 0xdd, 0xcd, 0xdf, 0xc6, 0x2b, 0x22, 0x58, 0x3, 
-0x21, 0xea, 0x3, 0x3a, 0x4d, 0x3, 0xb7, 0x28, 0x6b, 0xed, 0x5b, 0x4e, 0x3, 0xf2, 0xf0, 0xc3, 
-0xd5, 0xcd, 0x2a, 0xd8, 0xd1, 0xd5, 0xcd, 0xbb, 0xc4, 0x3e, 0x2a, 0x38, 0x2, 0x3e, 0x20, 0xcd, 
-0xae, 0xc6, 0xcd, 0xae, 0xc5, 0xd1, 0x30, 0x6, 0xaf, 0x32, 0x4d, 0x3, 0x18, 0xba, 0x2a, 0x50, 
-0x3, 0x19, 0x38, 0xf4, 0xd5, 0x11, 0xf9, 0xff, 0xcd, 0x89, 0xc6, 0xd1, 0x30, 0xea, 0x22, 0x4e, 
-0x3, 0x21, 0x62, 0x3, 0xf5, 0x18, 0x47, 0xc8, 0xcd, 0x97, 0xc6, 0xcd, 0x86, 0xc9, 0xc0, 0xc1, 
-0xcd, 0xbb, 0xc4, 0x30, 0x58, 0xd5, 0x7e, 0x23, 0xb6, 0x23, 0x28, 0x2, 0x3e, 0x7f, 0x32, 0x4d, 
-0x3, 0x7e, 0x23, 0x66, 0x6f, 0x22, 0x4e, 0x3, 0xcd, 0x98, 0xde, 0xd1, 0xc2, 0x96, 0xc3, 0x38, 
-0xb7, 0x3f, 0x18, 0xcd, 0x3e, 0x3e, 0xcd, 0xae, 0xc6, 0xcd, 0xae, 0xc5, 0xda, 0x96, 0xc3, 0x21, 
-0x61, 0x3, 0xcd, 0xbd, 0xc8, 0x3c, 0x3d, 0xca, 0x96, 0xc3, 0xf5, 0xcd, 0x86, 0xc9, 0xd5, 0xcd, 
-0xda, 0xc4, 0x47, 0xd1, 0xf1, 0xd2, 0x8a, 0xc8, 0xd5, 0xc5, 0xaf, 0x32, 0xcd, 0x3, 0xcd, 0xbd, 
-0xc8, 0xb7, 0xf5, 0xcd, 0xbb, 0xc4, 0x38, 0x8, 0xf1, 0xf5, 0xb7, 0x20, 0x3, 0xc3, 0x20, 0xca, 
-0xc5, 0x30, 0x11, 0xeb, 0x2a, 0xd7, 0x3, 0x1a, 0x2, 0x3, 0x13, 0xcd, 0x89, 0xc6, 0x20, 0xf7, 
-0xed, 0x43, 0xd7, 0x3, 0xd1, 0xf1, 0x28, 0x22, 0x2a, 0xd7, 0x3, 0xe3, 0xc1, 0x9, 0xe5, 0xcd, 
-0xab, 0xc4, 0xe1, 0x22, 0xd7, 0x3, 0xeb, 0x36, 0xff, 0xd1, 0x23, 0x23, 0x73, 0x23, 0x72, 0x23, 
-0x11, 0x62, 0x3, 0x1a, 0x77, 0x23, 0x13, 0xb7, 0x20, 0xf9, 0xcd, 0x4f, 0xc6, 0x23, 0xeb, 0x21, 
-0x96, 0xc3, 0xe5, 0x62, 0x6b, 0x7e, 0x23, 0xb6, 0xc8, 0x23, 0x7e, 0x23, 0xa6, 0x3c, 0xc8, 0x23, 
-0xaf, 0xbe, 0x23, 0x20, 0xfc, 0xeb, 0x73, 0x23, 0x72, 0x18, 0xe8, 0xcd, 0x30, 0xc3, 0xc5, 0xe3, 
-0xc1, 0xcd, 0x89, 0xc6, 0x7e, 0x2, 0xc8, 0xb, 0x2b, 0x18, 0xf6, 0x2a, 0x5f, 0x3, 0x44, 0x4d, 
-0x7e, 0x23, 0xb6, 0x2b, 0xc8, 0x23, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0xcd, 0x89, 0xc6, 0x60, 0x69, 
-0x7e, 0x23, 0x66, 0x6f, 0x3f, 0xc8, 0x3f, 0xd0, 0x18, 0xe4, 0xaf, 0x32, 0xaf, 0x3, 0xe, 0x5, 
-0x11, 0x62, 0x3, 0xaf, 0x32, 0xfb, 0x3, 0x7e, 0xfe, 0x20, 0xca, 0x71, 0xc5, 0x47, 0xfe, 0x22, 
-0xca, 0x91, 0xc5, 0xb7, 0xca, 0x97, 0xc5, 0x3a, 0xaf, 0x3, 0xb7, 0x7e, 0x20, 0x73, 0xfe, 0x3f, 
-0x3e, 0x9e, 0x28, 0x6d, 0x7e, 0xfe, 0x30, 0x38, 0x4, 0xfe, 0x3c, 0x38, 0x64, 0xd5, 0x11, 0x20, 
-0xc1, 0xc5, 0x1, 0x6d, 0xc5, 0xc5, 0x6, 0x7f, 0x7e, 0xfe, 0x61, 0x38, 0x7, 0xfe, 0x7b, 0x30, 
-0x3, 0xe6, 0x5f, 0x77, 0x4e, 0xeb, 0x23, 0xb6, 0xf2, 0x26, 0xc5, 0x4, 0x7e, 0xe6, 0x7f, 0x20, 
-0x15, 0x3a, 0xfc, 0x3, 0xa7, 0xc8, 0x3a, 0xfb, 0x3, 0xa7, 0xc0, 0x3c, 0x32, 0xfb, 0x3, 0x2a, 
-0xc, 0xe0, 0x7e, 0xe6, 0x7f, 0xc8, 0xb9, 0x20, 0xdd, 0xeb, 0xe5, 0x13, 0x1a, 0xb7, 0xfa, 0x69, 
-0xc5, 0x4f, 0x78, 0xfe, 0x88, 0x20, 0x4, 0xcd, 0xbd, 0xc8, 0x2b, 0x23, 0x7e, 0xfe, 0x61, 0x38, 
-0x2, 0xe6, 0x5f, 0xb9, 0x28, 0xe5, 0xe1, 0x18, 0xbb, 0x48, 0xf1, 0xeb, 0xc9, 0xeb, 0x79, 0xc1, 
-0xd1, 0x23, 0x12, 0x13, 0xc, 0xd6, 0x3a, 0x28, 0x4, 0xfe, 0x49, 0x20, 0x3, 0x32, 0xaf, 0x3, 
-0xd6, 0x54, 0x28, 0x5, 0xd6, 0xe, 0xc2, 0xe3, 0xc4, 0x47, 0x7e, 0xb7, 0x28, 0x9, 0xb8, 0x28, 
-0xe0, 0x23, 0x12, 0xc, 0x13, 0x18, 0xf3, 0x21, 0x61, 0x3, 0x12, 0x13, 0x12, 0x13, 0x12, 0xc9, 
-0x4c, 0x49, 0x53, 0x54, 0x0, 0x52, 0x55, 0x4e, 0x0, 0x43, 0x4f, 0x4e, 0x54, 0x0, 0xe5, 0x21, 
-0x62, 0x3, 0xe3, 0xcd, 0xe4, 0xdd, 0xe3, 0xfe, 0x1c, 0x11, 0x9f, 0xc5, 0x28, 0xe, 0xfe, 0x1d, 
-0x11, 0xa4, 0xc5, 0x28, 0x7, 0xfe, 0x1e, 0x11, 0xa8, 0xc5, 0x20, 0x14, 0x21, 0x61, 0x3, 0x23, 
-0x13, 0x1a, 0x77, 0xa7, 0x20, 0xf9, 0x21, 0x62, 0x3, 0xcd, 0xf1, 0xc5, 0xe1, 0xc3, 0x5e, 0xcb, 
-0xcd, 0xf, 0xdf, 0x20, 0x2, 0xe1, 0xc9, 0xcd, 0x27, 0xdf, 0x38, 0xf9, 0xcd, 0x32, 0xdf, 0x18, 
-0xc1, 0x7e, 0xb7, 0xc8, 0xcd, 0xd5, 0xdd, 0x23, 0x18, 0xf7, 0x11, 0xa, 0x0, 0xd5, 0x28, 0x17, 
-0xcd, 0x86, 0xc9, 0xeb, 0xe3, 0x28, 0x11, 0xeb, 0xcd, 0xd6, 0xc8, 0xed, 0x5b, 0x50, 0x3, 0x28, 
-0x6, 0xcd, 0x86, 0xc9, 0xc2, 0x48, 0xc3, 0xeb, 0x7d, 0xb4, 0xca, 0x67, 0xc9, 0x22, 0x50, 0x3, 
-0xcb, 0xff, 0x32, 0x4d, 0x3, 0xe1, 0x22, 0x4e, 0x3, 0xc1, 0xc3, 0x96, 0xc3, 0xcd, 0x5f, 0xde, 
-0x3a, 0x9, 0x3, 0xe6, 0x3, 0x28, 0xf3, 0x3e, 0xd5, 0xcd, 0xb2, 0xdc, 0xf1, 0xaf, 0x18, 0xea, 
-0xc0, 0x2a, 0x5f, 0x3, 0xaf, 0x32, 0x5e, 0x3, 0x77, 0x23, 0x77, 0x23, 0x22, 0xd7, 0x3, 0x2a, 
-0x5f, 0x3, 0x2b, 0x22, 0xcf, 0x3, 0x2a, 0xb0, 0x3, 0x22, 0xc4, 0x3, 0xaf, 0xcd, 0xdf, 0xc8, 
-0x2a, 0xd7, 0x3, 0x22, 0xd9, 0x3, 0x22, 0xdb, 0x3, 0xc1, 0x2a, 0x56, 0x3, 0xf9, 0x21, 0xb4, 
-0x3, 0x22, 0xb2, 0x3, 0xcd, 0x1d, 0xde, 0xaf, 0x6f, 0x67, 0x22, 0xd5, 0x3, 0x32, 0xcc, 0x3, 
-0x22, 0xdf, 0x3, 0xe5, 0xc5, 0x2a, 0xcf, 0x3, 0xc9, 0x7c, 0x92, 0xc0, 0x7d, 0x93, 0xc9, 0x7e, 
-0xfe, 0x41, 0xd8, 0xfe, 0x5b, 0x3f, 0xc9, 0x3a, 0x5e, 0x3, 0xa7, 0xc8, 0xcd, 0x69, 0xc6, 0xc3, 
-0x6e, 0xc3, 0xcd, 0x89, 0xc6, 0x3e, 0x8, 0x18, 0x2, 0x3e, 0x20, 0xc3, 0xd5, 0xdd, 0xf5, 0xc5, 
-0x4f, 0xfe, 0x20, 0x38, 0x13, 0x3a, 0x41, 0x3, 0x47, 0x3a, 0xac, 0x3, 0x4, 0x28, 0x5, 0x5, 
-0xb8, 0xcc, 0x61, 0xcb, 0x3c, 0x32, 0xac, 0x3, 0x79, 0xcd, 0xd5, 0xdd, 0xc1, 0xf1, 0xc9, 0x3e, 
-0x3f, 0xcd, 0xae, 0xc6, 0x3e, 0x9, 0xcd, 0xae, 0xc6, 0xcd, 0xdf, 0xc6, 0xc3, 0x4a, 0x3, 0x21, 
-0x0, 0x20, 0x22, 0x61, 0x3, 0x22, 0x63, 0x3, 0x65, 0xc9, 0xcd, 0x6c, 0xc9, 0xed, 0x53, 0x46, 
-0x3, 0xc9, 0xcd, 0x97, 0xc6, 0xcd, 0x25, 0xde, 0xcd, 0xc8, 0xdd, 0x28, 0x12, 0x3e, 0xd5, 0xcd, 
-0xb2, 0xdc, 0x2a, 0x46, 0x3, 0x22, 0x4e, 0x3, 0x21, 0xff, 0xff, 0x22, 0x46, 0x3, 0xe1, 0xcd, 
-0x86, 0xc9, 0xc0, 0xc1, 0xcd, 0xbb, 0xc4, 0xc5, 0xcd, 0x91, 0xc7, 0xe1, 0x4e, 0x23, 0x46, 0x23, 
-0x78, 0xb1, 0x28, 0x59, 0xcd, 0x67, 0xc7, 0xcd, 0xf9, 0xc8, 0xc5, 0x5e, 0x23, 0x56, 0x23, 0xe5, 
-0x21, 0xea, 0x3, 0xcd, 0x61, 0xcb, 0xcd, 0x2a, 0xd8, 0x3e, 0x20, 0xe1, 0xcd, 0xae, 0xc6, 0x7e, 
-0x23, 0xfe, 0x22, 0x28, 0x14, 0xb7, 0x28, 0xd3, 0xf2, 0x3c, 0xc7, 0xcd, 0x9a, 0xc7, 0xcd, 0xae, 
-0xc6, 0x1a, 0x13, 0xb7, 0xf2, 0x4e, 0xc7, 0x18, 0xe6, 0xcd, 0xae, 0xc6, 0x7e, 0x23, 0xb7, 0x28, 
-0xba, 0xfe, 0x22, 0x28, 0xd7, 0x18, 0xf2, 0xe5, 0x2a, 0x44, 0x3, 0x7d, 0xb4, 0x2b, 0x22, 0x44, 
-0x3, 0xe1, 0xc0, 0xcd, 0x91, 0xc7, 0xcd, 0xe4, 0xdd, 0xfe, 0x3, 0x20, 0xea, 0xcd, 0xc8, 0xdd, 
-0x28, 0xc, 0xcd, 0x61, 0xcb, 0xcd, 0xfd, 0xdd, 0x2a, 0x4e, 0x3, 0x22, 0x46, 0x3, 0xc3, 0x8c, 
-0xc0, 0xe5, 0x2a, 0x46, 0x3, 0x22, 0x44, 0x3, 0xe1, 0xc9, 0xd6, 0x7f, 0xfe, 0x56, 0x38, 0x8, 
-0xd6, 0x55, 0xed, 0x5b, 0xc, 0xe0, 0x18, 0x3, 0x11, 0x21, 0xc1, 0x47, 0x1a, 0x13, 0xb7, 0xf2, 
-0xac, 0xc7, 0x10, 0xf8, 0xe6, 0x7f, 0xc9, 0x3e, 0xaf, 0x32, 0xa, 0x3, 0xc9, 0x21, 0x4, 0x0, 
-0x39, 0x7e, 0x23, 0xfe, 0x81, 0xc0, 0x4e, 0x23, 0x46, 0x23, 0xe5, 0x69, 0x60, 0x7a, 0xb3, 0xeb, 
-0x28, 0x4, 0xeb, 0xcd, 0x89, 0xc6, 0x1, 0xd, 0x0, 0xe1, 0xc8, 0x9, 0x18, 0xe3, 0x3e, 0x64, 
-0x32, 0xcc, 0x3, 0xcd, 0x5d, 0xca, 0xc1, 0xe5, 0xcd, 0x48, 0xca, 0x22, 0xc8, 0x3, 0x21, 0x2, 
-0x0, 0x39, 0xcd, 0xc1, 0xc7, 0xd1, 0x20, 0x14, 0x9, 0xd5, 0x2b, 0x56, 0x2b, 0x5e, 0x23, 0x23, 
-0xe5, 0x2a, 0xc8, 0x3, 0xcd, 0x89, 0xc6, 0xe1, 0x20, 0xe8, 0xd1, 0xf9, 0xeb, 0xe, 0x8, 0xcd, 
-0x27, 0xc3, 0xe5, 0x2a, 0xc8, 0x3, 0xe3, 0xe5, 0x2a, 0x58, 0x3, 0xe3, 0xcd, 0x29, 0xcd, 0xcd, 
-0xcc, 0xc8, 0xa6, 0xcd, 0x26, 0xcd, 0xe5, 0xcd, 0xeb, 0xd6, 0xe1, 0xc5, 0xd5, 0x1, 0x0, 0x81, 
-0x51, 0x5a, 0x7e, 0xfe, 0xab, 0x3e, 0x1, 0x20, 0xe, 0xcd, 0xbd, 0xc8, 0xcd, 0x26, 0xcd, 0xe5, 
-0xcd, 0xeb, 0xd6, 0xcd, 0x97, 0xd6, 0xe1, 0xc5, 0xd5, 0xf5, 0x33, 0xe5, 0x2a, 0xcf, 0x3, 0xe3, 
-0x6, 0x81, 0xc5, 0x33, 0xcd, 0x16, 0xde, 0xcd, 0xf9, 0xc8, 0x22, 0xcf, 0x3, 0x7e, 0xfe, 0x3a, 
-0x28, 0x28, 0xb7, 0xc2, 0x48, 0xc3, 0x23, 0x7e, 0x23, 0xb6, 0xca, 0x22, 0xc9, 0x23, 0x5e, 0x23, 
-0x56, 0xed, 0x53, 0x58, 0x3, 0x3a, 0xa, 0x3, 0xb7, 0x28, 0xf, 0xe5, 0x3e, 0x3c, 0xcd, 0xae, 
-0xc6, 0xcd, 0x2a, 0xd8, 0x3e, 0x3e, 0xcd, 0xae, 0xc6, 0xe1, 0xcd, 0xbd, 0xc8, 0x11, 0x54, 0xc8, 
-0xd5, 0xc8, 0xd6, 0x80, 0xda, 0x5d, 0xca, 0xfe, 0x25, 0x38, 0x14, 0xd6, 0x50, 0x38, 0x34, 0xfe, 
-0x5, 0x38, 0xa, 0x47, 0x3a, 0xfc, 0x3, 0xa7, 0x28, 0x29, 0xc3, 0x3, 0xe0, 0xc6, 0x25, 0x7, 
-0x4f, 0x6, 0x0, 0xeb, 0x21, 0x40, 0xc2, 0x9, 0x4e, 0x23, 0x46, 0xc5, 0xeb, 0x23, 0x7e, 0xfe, 
-0x3a, 0xd0, 0xfe, 0x20, 0x28, 0xf7, 0xfe, 0x30, 0x3f, 0x3c, 0x3d, 0xc9, 0x7e, 0xe3, 0xbe, 0x23, 
-0xe3, 0x28, 0xea, 0xc3, 0x48, 0xc3, 0x3e, 0x2c, 0xbe, 0x18, 0xf6, 0x3e, 0x29, 0x18, 0xf9, 0xeb, 
-0x2a, 0x5f, 0x3, 0x28, 0xe, 0xeb, 0xcd, 0x86, 0xc9, 0xe5, 0xcd, 0xbb, 0xc4, 0x60, 0x69, 0xd1, 
-0xd2, 0x20, 0xca, 0x2b, 0x22, 0xdd, 0x3, 0xeb, 0xc9, 0xcd, 0xf3, 0xdd, 0xc0, 0xfe, 0x13, 0x28, 
-0x8, 0xfe, 0x3, 0xc0, 0xcd, 0xe4, 0xdd, 0x18, 0xf, 0xcd, 0xe4, 0xdd, 0xfe, 0x1e, 0xc8, 0xfe, 
-0xa, 0xc8, 0xfe, 0x3, 0x28, 0x2, 0x18, 0xf1, 0xc0, 0xf6, 0xc0, 0x22, 0xcf, 0x3, 0x21, 0xf6, 
-0xff, 0xc1, 0x2a, 0x58, 0x3, 0xf5, 0x7d, 0xa4, 0x3c, 0x28, 0x9, 0x22, 0xd3, 0x3, 0x2a, 0xcf, 
-0x3, 0x22, 0xd5, 0x3, 0xaf, 0x32, 0x43, 0x3, 0xcd, 0x1d, 0xde, 0xcd, 0x55, 0xcb, 0xf1, 0x21, 
-0x21, 0xc3, 0xc2, 0x71, 0xc3, 0xc3, 0x88, 0xc3, 0x2a, 0xd5, 0x3, 0x7c, 0xb5, 0x1e, 0x20, 0xca, 
-0x56, 0xc3, 0xeb, 0x2a, 0xd3, 0x3, 0x22, 0x58, 0x3, 0xeb, 0xc9, 0xcd, 0xbd, 0xc8, 0xcd, 0x26, 
-0xcd, 0xcd, 0x97, 0xd6, 0xf2, 0x6f, 0xc9, 0x1e, 0x8, 0xc3, 0x56, 0xc3, 0xcd, 0x26, 0xcd, 0x3a, 
-0xe8, 0x3, 0xfe, 0x90, 0xda, 0x45, 0xd7, 0x1, 0x80, 0x90, 0x11, 0x0, 0x0, 0xe5, 0xcd, 0x18, 
-0xd7, 0xe1, 0x51, 0xc8, 0x18, 0xe1, 0x2b, 0x11, 0x0, 0x0, 0xcd, 0xbd, 0xc8, 0xd0, 0xe5, 0xf5, 
-0x21, 0x98, 0x19, 0xcd, 0x89, 0xc6, 0xda, 0x48, 0xc3, 0x62, 0x6b, 0x19, 0x29, 0x19, 0x29, 0xf1, 
-0xd6, 0x30, 0x5f, 0x16, 0x0, 0x19, 0xeb, 0xe1, 0x18, 0xe0, 0x28, 0x3c, 0xcd, 0x5e, 0xc9, 0xcd, 
-0xbe, 0xc8, 0xe5, 0x2a, 0xb0, 0x3, 0x28, 0x10, 0xe1, 0xcd, 0xd6, 0xc8, 0xd5, 0xcd, 0x6c, 0xc9, 
-0xcd, 0xbe, 0xc8, 0xc2, 0x48, 0xc3, 0xe3, 0xeb, 0x7d, 0x93, 0x5f, 0x7c, 0x9a, 0x57, 0xda, 0x3e, 
-0xc3, 0xe5, 0x2a, 0xd7, 0x3, 0x1, 0x28, 0x0, 0x9, 0xcd, 0x89, 0xc6, 0xd2, 0x3e, 0xc3, 0xeb, 
-0x22, 0x56, 0x3, 0xe1, 0x22, 0xb0, 0x3, 0xe1, 0xc3, 0x53, 0xc6, 0xca, 0x4f, 0xc6, 0xcd, 0x53, 
-0xc6, 0x1, 0x54, 0xc8, 0x18, 0x10, 0xe, 0x3, 0xcd, 0x27, 0xc3, 0xc1, 0xe5, 0xe5, 0x2a, 0x58, 
-0x3, 0xe3, 0x3e, 0x8c, 0xf5, 0x33, 0xc5, 0xcd, 0x86, 0xc9, 0xcd, 0x4a, 0xca, 0xe5, 0x2a, 0x58, 
-0x3, 0xcd, 0x89, 0xc6, 0xe1, 0x23, 0xdc, 0xbe, 0xc4, 0xd4, 0xbb, 0xc4, 0x60, 0x69, 0x2b, 0xd8, 
-0x1e, 0xe, 0xc3, 0x56, 0xc3, 0xc0, 0x16, 0xff, 0xcd, 0xbd, 0xc7, 0xf9, 0xfe, 0x8c, 0x1e, 0x4, 
-0x20, 0xf0, 0xe1, 0x22, 0x58, 0x3, 0x23, 0x7c, 0xb5, 0x20, 0x7, 0x3a, 0xcd, 0x3, 0xb7, 0xc2, 
-0x87, 0xc3, 0x21, 0x54, 0xc8, 0xe3, 0x3e, 0xe1, 0x1, 0x3a, 0xe, 0x0, 0x6, 0x0, 0x79, 0x48, 
-0x47, 0x7e, 0xb7, 0xc8, 0xb8, 0xc8, 0x23, 0xfe, 0x22, 0x28, 0xf3, 0x18, 0xf4, 0xcd, 0x6, 0xcf, 
-0xcd, 0xcc, 0xc8, 0xb4, 0xd5, 0x3a, 0xae, 0x3, 0xf5, 0xcd, 0x3a, 0xcd, 0xf1, 0xe3, 0x22, 0xcf, 
-0x3, 0x1f, 0xcd, 0x2b, 0xcd, 0x28, 0x35, 0xe5, 0x2a, 0xe5, 0x3, 0xe5, 0x23, 0x23, 0x5e, 0x23, 
-0x56, 0x2a, 0x5f, 0x3, 0xcd, 0x89, 0xc6, 0x30, 0x12, 0x2a, 0x56, 0x3, 0xcd, 0x89, 0xc6, 0xd1, 
-0x30, 0x11, 0x21, 0xc0, 0x3, 0xcd, 0x89, 0xc6, 0x30, 0x9, 0x3e, 0xd1, 0xcd, 0x1b, 0xd3, 0xeb, 
-0xcd, 0x66, 0xd1, 0xcd, 0x1b, 0xd3, 0xe1, 0xcd, 0xfa, 0xd6, 0xe1, 0xc9, 0xe5, 0xcd, 0xf7, 0xd6, 
-0xd1, 0xe1, 0xc9, 0xcd, 0x21, 0xd4, 0x7e, 0x47, 0xfe, 0x8c, 0x28, 0x5, 0xcd, 0xcc, 0xc8, 0x88, 
-0x2b, 0x4b, 0xd, 0x78, 0xca, 0x92, 0xc8, 0xcd, 0x87, 0xc9, 0xfe, 0x2c, 0xc0, 0x18, 0xf3, 0xcd, 
-0x3a, 0xcd, 0x7e, 0xfe, 0x88, 0x28, 0x5, 0xcd, 0xcc, 0xc8, 0xa9, 0x2b, 0xcd, 0x29, 0xcd, 0xcd, 
-0x97, 0xd6, 0x20, 0x8, 0x23, 0x7e, 0xb7, 0xc8, 0xfe, 0xd4, 0x20, 0xf8, 0xcd, 0xbd, 0xc8, 0xda, 
-0x7, 0xca, 0xc3, 0x91, 0xc8, 0xcd, 0xbe, 0xc8, 0x18, 0x7, 0xaf, 0x32, 0xfd, 0x3, 0xcd, 0x25, 
-0xde, 0x28, 0x5e, 0xc8, 0xfe, 0xd5, 0x38, 0x9, 0x3a, 0xfc, 0x3, 0xa7, 0x28, 0x3, 0xcd, 0x6, 
-0xe0, 0xfe, 0xa5, 0xca, 0x92, 0xcb, 0xfe, 0xa8, 0x28, 0x78, 0xe5, 0xfe, 0x2c, 0x28, 0x5d, 0xfe, 
-0x3b, 0xca, 0xb2, 0xcb, 0xc1, 0xcd, 0x3a, 0xcd, 0xe5, 0x3a, 0xae, 0x3, 0xb7, 0x20, 0x20, 0xcd, 
-0x34, 0xd8, 0xcd, 0x8a, 0xd1, 0x36, 0x20, 0x2a, 0xe5, 0x3, 0x34, 0x2a, 0xe5, 0x3, 0x3a, 0x41, 
-0x3, 0x47, 0x4, 0x28, 0xa, 0x4, 0x3a, 0xac, 0x3, 0x86, 0x3d, 0xb8, 0xd4, 0x61, 0xcb, 0xcd, 
-0xcc, 0xd1, 0xe1, 0x18, 0xa0, 0x3a, 0xac, 0x3, 0xb7, 0xc8, 0x18, 0x5, 0x36, 0x0, 0x21, 0x61, 
-0x3, 0x3e, 0xd, 0xcd, 0xae, 0xc6, 0x3e, 0xa, 0xcd, 0xae, 0xc6, 0xaf, 0x32, 0xac, 0x3, 0x3a, 
-0x40, 0x3, 0x3d, 0xc8, 0xf5, 0xaf, 0xcd, 0xae, 0xc6, 0xf1, 0x18, 0xf6, 0x3a, 0x42, 0x3, 0x47, 
-0x3a, 0xac, 0x3, 0xb8, 0xd4, 0x61, 0xcb, 0x30, 0x29, 0xd6, 0xd, 0x38, 0x2, 0x20, 0xfa, 0x2f, 
-0x18, 0x15, 0xf5, 0xcd, 0x1e, 0xd4, 0xcd, 0xdb, 0xc8, 0x2b, 0xf1, 0xd6, 0xa8, 0xe5, 0x28, 0x3, 
-0x3a, 0xac, 0x3, 0x2f, 0x83, 0x30, 0xb, 0x3c, 0x28, 0x8, 0x47, 0x3e, 0x20, 0xcd, 0xae, 0xc6, 
-0x10, 0xfb, 0xe1, 0xcd, 0xbd, 0xc8, 0xc3, 0x3, 0xcb, 0xcd, 0x21, 0xd4, 0x32, 0x41, 0x3, 0xc9, 
-0xcd, 0x21, 0xd4, 0xc0, 0x3c, 0x32, 0x40, 0x3, 0xc9, 0x3f, 0x52, 0x45, 0x44, 0x4f, 0x20, 0x46, 
-0x52, 0x4f, 0x4d, 0x20, 0x53, 0x54, 0x41, 0x52, 0x54, 0xd, 0x0, 0x3a, 0xce, 0x3, 0xb7, 0xc2, 
-0x42, 0xc3, 0xc1, 0x21, 0xc9, 0xcb, 0xcd, 0xc9, 0xd1, 0xc3, 0x85, 0xc6, 0xcd, 0x37, 0xd1, 0xcd, 
-0x5f, 0xde, 0xaf, 0x32, 0x43, 0x3, 0x7e, 0xfe, 0x22, 0x20, 0x10, 0xcd, 0x8b, 0xd1, 0xcd, 0xcc, 
-0xc8, 0x3b, 0xe5, 0xcd, 0xcc, 0xd1, 0xcd, 0xd4, 0xc6, 0x18, 0x4, 0xe5, 0xcd, 0xcf, 0xc6, 0xc1, 
-0x38, 0x36, 0x21, 0x62, 0x3, 0x7e, 0xb7, 0x2b, 0xc5, 0x28, 0x37, 0x36, 0x2c, 0x18, 0x5, 0xe5, 
-0x2a, 0xdd, 0x3, 0xf6, 0xaf, 0x32, 0xce, 0x3, 0xe3, 0x18, 0x3, 0xcd, 0xd6, 0xc8, 0xcd, 0x6, 
-0xcf, 0xe3, 0xd5, 0x7e, 0xfe, 0x2c, 0x28, 0x1e, 0x3a, 0xce, 0x3, 0xb7, 0x20, 0x7d, 0x3e, 0x3f, 
-0xcd, 0xae, 0xc6, 0xcd, 0xcf, 0xc6, 0xd1, 0xc1, 0xda, 0x1f, 0xc9, 0x21, 0x62, 0x3, 0x7e, 0xb7, 
-0x2b, 0xc5, 0xca, 0x47, 0xca, 0xd5, 0x3a, 0xae, 0x3, 0xb7, 0x28, 0x21, 0xcd, 0xbd, 0xc8, 0x57, 
-0x47, 0xfe, 0x22, 0x28, 0xc, 0x3a, 0xce, 0x3, 0xb7, 0x57, 0x28, 0x2, 0x16, 0x3a, 0x6, 0x2c, 
-0x2b, 0xcd, 0x8e, 0xd1, 0xeb, 0x21, 0x88, 0xcc, 0xe3, 0xd5, 0xc3, 0x77, 0xca, 0xcd, 0xbd, 0xc8, 
-0xcd, 0xa1, 0xd7, 0xe3, 0xcd, 0xf7, 0xd6, 0xe1, 0xcd, 0xbe, 0xc8, 0x28, 0x5, 0xfe, 0x2c, 0xc2, 
-0xdb, 0xcb, 0xe3, 0xcd, 0xbe, 0xc8, 0x20, 0x93, 0xd1, 0x3a, 0xce, 0x3, 0xb7, 0xeb, 0xc2, 0xf4, 
-0xc8, 0xd5, 0xb6, 0x21, 0xab, 0xcc, 0xc4, 0xc9, 0xd1, 0xe1, 0xc9, 0x3f, 0x45, 0x58, 0x54, 0x52, 
-0x41, 0x20, 0x49, 0x47, 0x4e, 0x4f, 0x52, 0x45, 0x44, 0xd, 0x0, 0xcd, 0x48, 0xca, 0xb7, 0x20, 
-0x11, 0x23, 0x7e, 0x23, 0xb6, 0x1e, 0x6, 0xca, 0x56, 0xc3, 0x23, 0x5e, 0x23, 0x56, 0xed, 0x53, 
-0xca, 0x3, 0xcd, 0xbd, 0xc8, 0xfe, 0x83, 0x20, 0xe2, 0xc3, 0x56, 0xcc, 0x11, 0x0, 0x0, 0xc4, 
-0x6, 0xcf, 0x22, 0xcf, 0x3, 0xcd, 0xbd, 0xc7, 0xc2, 0x4e, 0xc3, 0xf9, 0xd5, 0x7e, 0x23, 0xf5, 
-0xd5, 0xcd, 0xdd, 0xd6, 0xe3, 0xe5, 0xcd, 0x61, 0xd4, 0xe1, 0xcd, 0xf7, 0xd6, 0xe1, 0xcd, 0xee, 
-0xd6, 0xe5, 0xcd, 0x18, 0xd7, 0xe1, 0xc1, 0x90, 0xcd, 0xee, 0xd6, 0x28, 0x9, 0xed, 0x53, 0x58, 
-0x3, 0x69, 0x60, 0xc3, 0x50, 0xc8, 0xf9, 0x2a, 0xcf, 0x3, 0x7e, 0xfe, 0x2c, 0xc2, 0x54, 0xc8, 
-0xcd, 0xbd, 0xc8, 0xcd, 0xdf, 0xcc, 0xcd, 0x3a, 0xcd, 0xf6, 0x37, 0x3a, 0xae, 0x3, 0x8f, 0xb7, 
-0xe8, 0x1e, 0x18, 0xc3, 0x56, 0xc3, 0xcd, 0xcc, 0xc8, 0x28, 0x2b, 0x16, 0x0, 0xd5, 0xe, 0x1, 
-0xcd, 0x27, 0xc3, 0xcd, 0xad, 0xcd, 0x22, 0xd1, 0x3, 0x2a, 0xd1, 0x3, 0xc1, 0x78, 0xfe, 0x78, 
-0xd4, 0x29, 0xcd, 0x7e, 0x16, 0x0, 0xd6, 0xb3, 0x38, 0x15, 0xfe, 0x3, 0x30, 0x11, 0xfe, 0x1, 
-0x17, 0xaa, 0xba, 0x57, 0xda, 0x48, 0xc3, 0x22, 0xc6, 0x3, 0xcd, 0xbd, 0xc8, 0x18, 0xe7, 0x7a, 
-0xb7, 0xc2, 0x84, 0xce, 0x7e, 0x22, 0xc6, 0x3, 0xd6, 0xac, 0xd8, 0xfe, 0x7, 0xd0, 0x5f, 0x3a, 
-0xae, 0x3, 0x3d, 0xb3, 0x7b, 0xca, 0xb3, 0xd2, 0x7, 0x83, 0x5f, 0x21, 0xc8, 0xc2, 0x19, 0x78, 
-0x56, 0xba, 0xd0, 0x23, 0xcd, 0x29, 0xcd, 0xc5, 0x1, 0x49, 0xcd, 0xc5, 0x43, 0x4a, 0xcd, 0xc8, 
-0xd6, 0x58, 0x51, 0x4e, 0x23, 0x46, 0x23, 0xc5, 0x2a, 0xc6, 0x3, 0x18, 0x90, 0xaf, 0x32, 0xae, 
-0x3, 0xcd, 0xbd, 0xc8, 0x1e, 0x24, 0xca, 0x56, 0xc3, 0xda, 0xa1, 0xd7, 0xcd, 0x8f, 0xc6, 0x30, 
-0x37, 0xfe, 0xac, 0x28, 0xe8, 0xfe, 0x2e, 0xca, 0xa1, 0xd7, 0xfe, 0xad, 0x28, 0x19, 0xfe, 0x22, 
-0xca, 0x8b, 0xd1, 0xfe, 0xaa, 0xca, 0xe3, 0xce, 0xfe, 0xa7, 0xca, 0xf0, 0xd0, 0xd6, 0xb6, 0x30, 
-0x28, 0xcd, 0x36, 0xcd, 0xc3, 0xdb, 0xc8, 0x16, 0x7d, 0xcd, 0x3d, 0xcd, 0x2a, 0xd1, 0x3, 0xe5, 
-0xcd, 0xc0, 0xd6, 0xcd, 0x29, 0xcd, 0xe1, 0xc9, 0xcd, 0x6, 0xcf, 0xe5, 0xeb, 0x22, 0xe5, 0x3, 
-0x3a, 0xae, 0x3, 0xb7, 0xcc, 0xdd, 0xd6, 0xe1, 0xc9, 0x6, 0x0, 0x7, 0x4f, 0xc5, 0xcd, 0xbd, 
-0xc8, 0x79, 0xfe, 0x33, 0x38, 0x7, 0x3a, 0xfc, 0x3, 0xa7, 0xc2, 0x9, 0xe0, 0xfe, 0x22, 0x28, 
-0x1e, 0xfe, 0x2d, 0x38, 0x17, 0xcd, 0x36, 0xcd, 0xcd, 0xd6, 0xc8, 0xcd, 0x2a, 0xcd, 0xeb, 0x2a, 
-0xe5, 0x3, 0xe3, 0xe5, 0xeb, 0xcd, 0x21, 0xd4, 0xeb, 0xe3, 0x18, 0x8, 0xcd, 0xe1, 0xcd, 0xe3, 
-0x11, 0xf3, 0xcd, 0xd5, 0x1, 0x94, 0xc2, 0x9, 0x4e, 0x23, 0x66, 0x69, 0xe9, 0x15, 0xfe, 0xad, 
-0xc8, 0xfe, 0x2d, 0xc8, 0x14, 0xfe, 0x2b, 0xc8, 0xfe, 0xac, 0xc8, 0x2b, 0xc9, 0xf6, 0xaf, 0xf5, 
-0xcd, 0x29, 0xcd, 0xcd, 0x6f, 0xc9, 0xf1, 0xeb, 0xc1, 0xe3, 0xeb, 0xcd, 0xe0, 0xd6, 0xf5, 0xcd, 
-0x6f, 0xc9, 0xf1, 0xc1, 0x79, 0x21, 0xb0, 0xd0, 0x20, 0x5, 0xa3, 0x4f, 0x78, 0xa2, 0xe9, 0xb3, 
-0x4f, 0x78, 0xb2, 0xe9, 0x21, 0x96, 0xce, 0x3a, 0xae, 0x3, 0x1f, 0x7a, 0x17, 0x5f, 0x16, 0x64, 
-0x78, 0xba, 0xd0, 0xc3, 0x97, 0xcd, 0x98, 0xce, 0x79, 0xb7, 0x1f, 0xc1, 0xd1, 0xf5, 0xcd, 0x2b, 
-0xcd, 0x21, 0xd9, 0xce, 0xe5, 0xca, 0x18, 0xd7, 0xaf, 0x32, 0xae, 0x3, 0xd5, 0xcd, 0xfe, 0xd2, 
-0x7e, 0x23, 0x23, 0x4e, 0x23, 0x46, 0xd1, 0xc5, 0xf5, 0xcd, 0x2, 0xd3, 0xcd, 0xee, 0xd6, 0xf1, 
-0x57, 0xe1, 0x7b, 0xb2, 0xc8, 0x7a, 0xd6, 0x1, 0xd8, 0xaf, 0xbb, 0x3c, 0xd0, 0x15, 0x1d, 0xa, 
-0xbe, 0x23, 0x3, 0x28, 0xed, 0x3f, 0xc3, 0xa2, 0xd6, 0x3c, 0x8f, 0xc1, 0xa0, 0xc6, 0xff, 0x9f, 
-0xc3, 0xa9, 0xd6, 0x16, 0x5a, 0xcd, 0x3d, 0xcd, 0xcd, 0x29, 0xcd, 0xcd, 0x6f, 0xc9, 0x7b, 0x2f, 
-0x4f, 0x7a, 0x2f, 0xcd, 0xb0, 0xd0, 0xc1, 0xc3, 0x49, 0xcd, 0xcd, 0xbe, 0xc8, 0xc8, 0xcd, 0xd6, 
-0xc8, 0x1, 0xfa, 0xce, 0xc5, 0xf6, 0xaf, 0x32, 0xad, 0x3, 0x46, 0xcd, 0x8f, 0xc6, 0xda, 0x48, 
-0xc3, 0xaf, 0x4f, 0x32, 0xae, 0x3, 0xcd, 0xbd, 0xc8, 0x38, 0x5, 0xcd, 0x8f, 0xc6, 0x38, 0xb, 
-0x4f, 0xcd, 0xbd, 0xc8, 0x38, 0xfb, 0xcd, 0x8f, 0xc6, 0x30, 0xf6, 0xd6, 0x24, 0x20, 0xa, 0x3c, 
-0x32, 0xae, 0x3, 0xf, 0x81, 0x4f, 0xcd, 0xbd, 0xc8, 0x3a, 0xcc, 0x3, 0x3d, 0xca, 0xdd, 0xcf, 
-0xf2, 0x48, 0xcf, 0x7e, 0xd6, 0x28, 0x28, 0x6f, 0xaf, 0x32, 0xcc, 0x3, 0xe5, 0x50, 0x59, 0x2a, 
-0xdf, 0x3, 0xcd, 0x89, 0xc6, 0x11, 0xe1, 0x3, 0xca, 0xe0, 0xd5, 0x2a, 0xd9, 0x3, 0xeb, 0x2a, 
-0xd7, 0x3, 0xcd, 0x89, 0xc6, 0x28, 0x10, 0x79, 0x96, 0x23, 0x20, 0x2, 0x78, 0x96, 0x23, 0x28, 
-0x38, 0x23, 0x23, 0x23, 0x23, 0x18, 0xeb, 0xe1, 0xe3, 0xd5, 0x11, 0xfb, 0xcd, 0xcd, 0x89, 0xc6, 
-0xd1, 0x28, 0x29, 0xe3, 0xe5, 0xc5, 0x1, 0x6, 0x0, 0x2a, 0xdb, 0x3, 0xe5, 0x9, 0xc1, 0xe5, 
-0xcd, 0xab, 0xc4, 0xe1, 0x22, 0xdb, 0x3, 0x60, 0x69, 0x22, 0xd9, 0x3, 0x2b, 0x36, 0x0, 0xcd, 
-0x89, 0xc6, 0x20, 0xf8, 0xd1, 0x73, 0x23, 0x72, 0x23, 0xeb, 0xe1, 0xc9, 0x32, 0xe8, 0x3, 0x21, 
-0x20, 0xc3, 0x22, 0xe5, 0x3, 0xe1, 0xc9, 0xe5, 0x2a, 0xad, 0x3, 0xe3, 0x57, 0xd5, 0xc5, 0xcd, 
-0x5b, 0xc9, 0xc1, 0xf1, 0xeb, 0xe3, 0xe5, 0xeb, 0x3c, 0x57, 0x7e, 0xfe, 0x2c, 0x28, 0xee, 0xcd, 
-0xdb, 0xc8, 0x22, 0xd1, 0x3, 0xe1, 0x22, 0xad, 0x3, 0x1e, 0x0, 0xd5, 0x11, 0xe5, 0xf5, 0x2a, 
-0xd9, 0x3, 0x3e, 0x19, 0xed, 0x5b, 0xdb, 0x3, 0xcd, 0x89, 0xc6, 0x28, 0x23, 0x7e, 0xb9, 0x23, 
-0x20, 0x2, 0x7e, 0xb8, 0x23, 0x5e, 0x23, 0x56, 0x23, 0x20, 0xe8, 0x3a, 0xad, 0x3, 0xb7, 0xc2, 
-0x51, 0xc3, 0xf1, 0x44, 0x4d, 0xca, 0xaa, 0xcf, 0x96, 0x28, 0x5f, 0x1e, 0x10, 0xc3, 0x56, 0xc3, 
-0x11, 0x4, 0x0, 0xf1, 0xca, 0x67, 0xc9, 0x71, 0x23, 0x70, 0x23, 0x4f, 0xcd, 0x27, 0xc3, 0x23, 
-0x23, 0x22, 0xc6, 0x3, 0x71, 0x23, 0x3a, 0xad, 0x3, 0x17, 0x79, 0x1, 0xb, 0x0, 0x30, 0x2, 
-0xc1, 0x3, 0x71, 0x23, 0x70, 0x23, 0xf5, 0xe5, 0xcd, 0x89, 0xd7, 0xeb, 0xe1, 0xf1, 0x3d, 0x20, 
-0xea, 0xf5, 0x42, 0x4b, 0xeb, 0x19, 0xda, 0x3e, 0xc3, 0xcd, 0x30, 0xc3, 0x22, 0xdb, 0x3, 0x2b, 
-0x36, 0x0, 0xcd, 0x89, 0xc6, 0x20, 0xf8, 0x3, 0x57, 0x2a, 0xc6, 0x3, 0x5e, 0xeb, 0x29, 0x9, 
-0xeb, 0x2b, 0x2b, 0x73, 0x23, 0x72, 0x23, 0xf1, 0x38, 0x22, 0x47, 0x4f, 0x7e, 0x23, 0x16, 0xe1, 
-0x5e, 0x23, 0x56, 0x23, 0xe3, 0xf5, 0xcd, 0x89, 0xc6, 0x30, 0x90, 0xe5, 0xcd, 0x89, 0xd7, 0xd1, 
-0x19, 0xf1, 0x3d, 0x44, 0x4d, 0x20, 0xe8, 0x29, 0x29, 0xc1, 0x9, 0xeb, 0x2a, 0xd1, 0x3, 0xc9, 
-0xed, 0x5b, 0xdb, 0x3, 0x21, 0x0, 0x0, 0x39, 0x3a, 0xae, 0x3, 0xb7, 0x28, 0xd, 0xcd, 0xfe, 
-0xd2, 0xcd, 0x9, 0xd2, 0xed, 0x5b, 0x56, 0x3, 0x2a, 0xc4, 0x3, 0x7d, 0x93, 0x4f, 0x7c, 0x9a, 
-0x41, 0x50, 0x1e, 0x0, 0x21, 0xae, 0x3, 0x73, 0x6, 0x90, 0xc3, 0xae, 0xd6, 0x3a, 0xac, 0x3, 
-0x47, 0xaf, 0x18, 0xed, 0xcd, 0x45, 0xd1, 0xcd, 0x37, 0xd1, 0x1, 0x48, 0xca, 0xc5, 0xd5, 0xcd, 
-0xcc, 0xc8, 0x28, 0xcd, 0x6, 0xcf, 0xe5, 0xeb, 0x2b, 0x56, 0x2b, 0x5e, 0xe1, 0xcd, 0x29, 0xcd, 
-0xcd, 0xdb, 0xc8, 0xcd, 0xcc, 0xc8, 0xb4, 0x44, 0x4d, 0xe3, 0x71, 0x23, 0x70, 0xc3, 0x84, 0xd1, 
-0xcd, 0x45, 0xd1, 0xd5, 0xcd, 0xe1, 0xcd, 0xcd, 0x29, 0xcd, 0xe3, 0x5e, 0x23, 0x56, 0x23, 0x7a, 
-0xb3, 0xca, 0x54, 0xc3, 0x7e, 0x23, 0x66, 0x6f, 0xe5, 0x2a, 0xdf, 0x3, 0xe3, 0x22, 0xdf, 0x3, 
-0x2a, 0xe3, 0x3, 0xe5, 0x2a, 0xe1, 0x3, 0xe5, 0x21, 0xe1, 0x3, 0xd5, 0xcd, 0xf7, 0xd6, 0xe1, 
-0xcd, 0x26, 0xcd, 0xcd, 0xbe, 0xc8, 0xc2, 0x48, 0xc3, 0xe1, 0x22, 0xe1, 0x3, 0xe1, 0x22, 0xe3, 
-0x3, 0xe1, 0x22, 0xdf, 0x3, 0xe1, 0xc9, 0xe5, 0x2a, 0x58, 0x3, 0x23, 0x7c, 0xb5, 0xe1, 0xc0, 
-0x1e, 0x16, 0xc3, 0x56, 0xc3, 0xcd, 0xcc, 0xc8, 0xa7, 0x3e, 0x80, 0x32, 0xcc, 0x3, 0xb6, 0x47, 
-0xcd, 0xb, 0xcf, 0xc3, 0x29, 0xcd, 0xcd, 0x29, 0xcd, 0xcd, 0x34, 0xd8, 0xcd, 0x8a, 0xd1, 0xcd, 
-0xfe, 0xd2, 0x1, 0x57, 0xd3, 0xc5, 0x7e, 0x23, 0x23, 0xe5, 0xcd, 0xe1, 0xd1, 0xe1, 0x4e, 0x23, 
-0x46, 0xcd, 0x7e, 0xd1, 0xe5, 0x6f, 0xcd, 0xf2, 0xd2, 0xd1, 0xc9, 0xcd, 0xe1, 0xd1, 0x21, 0xc0, 
-0x3, 0xe5, 0x77, 0x23, 0x23, 0x73, 0x23, 0x72, 0xe1, 0xc9, 0x2b, 0x6, 0x22, 0x50, 0xe5, 0xe, 
-0xff, 0x23, 0x7e, 0xc, 0xb7, 0x28, 0x6, 0xba, 0x28, 0x3, 0xb8, 0x20, 0xf4, 0xfe, 0x22, 0xcc, 
-0xbd, 0xc8, 0xe3, 0x23, 0xeb, 0x79, 0xcd, 0x7e, 0xd1, 0x11, 0xc0, 0x3, 0x2a, 0xb2, 0x3, 0x22, 
-0xe5, 0x3, 0x3e, 0x1, 0x32, 0xae, 0x3, 0xcd, 0xfa, 0xd6, 0xcd, 0x89, 0xc6, 0x22, 0xb2, 0x3, 
-0xe1, 0x7e, 0xc0, 0x1e, 0x1e, 0xc3, 0x56, 0xc3, 0x23, 0xcd, 0x8a, 0xd1, 0xcd, 0xfe, 0xd2, 0xcd, 
-0xee, 0xd6, 0x1c, 0x1d, 0xc8, 0xa, 0xcd, 0xae, 0xc6, 0xfe, 0xd, 0xcc, 0x66, 0xcb, 0x3, 0x18, 
-0xf2, 0xb7, 0xe, 0xf1, 0xf5, 0xed, 0x5b, 0x56, 0x3, 0x2a, 0xc4, 0x3, 0x2f, 0x4f, 0x6, 0xff, 
-0x9, 0x23, 0xcd, 0x89, 0xc6, 0x38, 0x7, 0x22, 0xc4, 0x3, 0x23, 0xeb, 0xf1, 0xc9, 0xf1, 0x1e, 
-0x1a, 0x28, 0xc2, 0xbf, 0xf5, 0x1, 0xe3, 0xd1, 0xc5, 0x2a, 0xb0, 0x3, 0x22, 0xc4, 0x3, 0x21, 
-0x0, 0x0, 0xe5, 0x2a, 0x56, 0x3, 0xe5, 0x21, 0xb4, 0x3, 0xed, 0x5b, 0xb2, 0x3, 0xcd, 0x89, 
-0xc6, 0x1, 0x1a, 0xd2, 0x20, 0x3f, 0x2a, 0xd7, 0x3, 0xed, 0x5b, 0xd9, 0x3, 0xcd, 0x89, 0xc6, 
-0x28, 0xa, 0x7e, 0x23, 0x23, 0xb7, 0xcd, 0x68, 0xd2, 0x18, 0xee, 0xc1, 0xed, 0x5b, 0xdb, 0x3, 
-0xcd, 0x89, 0xc6, 0x28, 0x49, 0xcd, 0xee, 0xd6, 0x7b, 0xe5, 0x9, 0xb7, 0xf2, 0x3b, 0xd2, 0x22, 
-0xc6, 0x3, 0xe1, 0x4e, 0x6, 0x0, 0x9, 0x9, 0x23, 0xed, 0x5b, 0xc6, 0x3, 0xcd, 0x89, 0xc6, 
-0x28, 0xda, 0x1, 0x59, 0xd2, 0xc5, 0xf6, 0x80, 0x7e, 0x23, 0x23, 0x5e, 0x23, 0x56, 0x23, 0xf0, 
-0xb7, 0xc8, 0x44, 0x4d, 0x2a, 0xc4, 0x3, 0xcd, 0x89, 0xc6, 0x60, 0x69, 0xd8, 0xe1, 0xe3, 0xcd, 
-0x89, 0xc6, 0xe3, 0xe5, 0x60, 0x69, 0xd0, 0xc1, 0xf1, 0xf1, 0xe5, 0xd5, 0xc5, 0xc9, 0xd1, 0xe1, 
-0x7d, 0xb4, 0xc8, 0x2b, 0x46, 0x2b, 0x4e, 0xe5, 0x2b, 0x2b, 0x6e, 0x26, 0x0, 0x9, 0x50, 0x59, 
-0x2b, 0x44, 0x4d, 0x2a, 0xc4, 0x3, 0xcd, 0xae, 0xc4, 0xe1, 0x71, 0x23, 0x70, 0x69, 0x60, 0x2b, 
-0xc3, 0xc, 0xd2, 0xc5, 0xe5, 0x2a, 0xe5, 0x3, 0xe3, 0xcd, 0xad, 0xcd, 0xe3, 0xcd, 0x2a, 0xcd, 
-0x7e, 0xe5, 0x2a, 0xe5, 0x3, 0xe5, 0x86, 0x1e, 0x1c, 0xda, 0x56, 0xc3, 0xcd, 0x7b, 0xd1, 0xd1, 
-0xcd, 0x2, 0xd3, 0xe3, 0xcd, 0x1, 0xd3, 0xe5, 0x2a, 0xc2, 0x3, 0xeb, 0xcd, 0xe9, 0xd2, 0xcd, 
-0xe9, 0xd2, 0x21, 0x46, 0xcd, 0xe3, 0xe5, 0x18, 0x6f, 0xe1, 0xe3, 0x7e, 0x23, 0x23, 0x4e, 0x23, 
-0x46, 0x6f, 0x2c, 0x2d, 0xc8, 0xa, 0x12, 0x3, 0x13, 0x18, 0xf8, 0xcd, 0x2a, 0xcd, 0x2a, 0xe5, 
-0x3, 0xeb, 0xcd, 0x1b, 0xd3, 0xeb, 0xc0, 0xd5, 0x50, 0x59, 0x1b, 0x4e, 0x2a, 0xc4, 0x3, 0xcd, 
-0x89, 0xc6, 0x20, 0x5, 0x47, 0x9, 0x22, 0xc4, 0x3, 0xe1, 0xc9, 0x2a, 0xb2, 0x3, 0x2b, 0x46, 
-0x2b, 0x4e, 0x2b, 0x2b, 0xcd, 0x89, 0xc6, 0xc0, 0x22, 0xb2, 0x3, 0xc9, 0x1, 0xc0, 0xd0, 0xc5, 
-0xcd, 0xfb, 0xd2, 0xaf, 0x57, 0x32, 0xae, 0x3, 0x7e, 0xb7, 0xc9, 0x1, 0xc0, 0xd0, 0xc5, 0xcd, 
-0x30, 0xd3, 0x28, 0x55, 0x23, 0x23, 0x5e, 0x23, 0x56, 0x1a, 0xc9, 0x3e, 0x1, 0xcd, 0x7b, 0xd1, 
-0xcd, 0x24, 0xd4, 0x2a, 0xc2, 0x3, 0x73, 0xc1, 0xc3, 0xa9, 0xd1, 0xcd, 0xda, 0xd3, 0xaf, 0xe3, 
-0x4f, 0xe5, 0x7e, 0xb8, 0x38, 0x2, 0x78, 0x11, 0xe, 0x0, 0xc5, 0xcd, 0xe1, 0xd1, 0xc1, 0xe1, 
-0xe5, 0x23, 0x23, 0x46, 0x23, 0x66, 0x68, 0x6, 0x0, 0x9, 0x44, 0x4d, 0xcd, 0x7e, 0xd1, 0x6f, 
-0xcd, 0xf2, 0xd2, 0xd1, 0xcd, 0x2, 0xd3, 0x18, 0xcf, 0xcd, 0xda, 0xd3, 0xd1, 0xd5, 0x1a, 0x90, 
-0x18, 0xcd, 0xeb, 0x7e, 0xcd, 0xde, 0xd3, 0x4, 0x5, 0xca, 0x67, 0xc9, 0xc5, 0x1e, 0xff, 0xfe, 
-0x29, 0x28, 0x6, 0xcd, 0xd6, 0xc8, 0xcd, 0x21, 0xd4, 0xcd, 0xdb, 0xc8, 0xf1, 0xe3, 0x1, 0x61, 
-0xd3, 0xc5, 0x3d, 0xbe, 0x6, 0x0, 0xd0, 0x4f, 0x7e, 0x91, 0xbb, 0x47, 0xd8, 0x43, 0xc9, 0xcd, 
-0x30, 0xd3, 0xca, 0xcf, 0xd4, 0x5f, 0x23, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0xe5, 0x19, 0x46, 0x72, 
-0xe3, 0xc5, 0x7e, 0xcd, 0xa1, 0xd7, 0xc1, 0xe1, 0x70, 0xc9, 0xeb, 0xcd, 0xdb, 0xc8, 0xc1, 0xd1, 
-0xc5, 0x43, 0xc9, 0xcd, 0x24, 0xd4, 0x4f, 0xed, 0x78, 0xc3, 0xc0, 0xd0, 0xcd, 0x14, 0xd4, 0x3a, 
-0x6, 0x3, 0x4f, 0x7b, 0xed, 0x79, 0xc9, 0xcd, 0x14, 0xd4, 0xf5, 0x1e, 0x0, 0xcd, 0xbe, 0xc8, 
-0x28, 0x6, 0xcd, 0xd6, 0xc8, 0xcd, 0x21, 0xd4, 0xc1, 0x3a, 0x6, 0x3, 0x4f, 0xed, 0x78, 0xab, 
-0xa0, 0x28, 0xfa, 0xc9, 0xcd, 0x21, 0xd4, 0x32, 0x6, 0x3, 0xcd, 0xd6, 0xc8, 0x2b, 0xcd, 0xbd, 
-0xc8, 0xcd, 0x26, 0xcd, 0xcd, 0x61, 0xc9, 0x7a, 0xb7, 0xc2, 0x67, 0xc9, 0xcd, 0xbe, 0xc8, 0x7b, 
-0xc9, 0xcd, 0x6f, 0xc9, 0x1a, 0x18, 0xb2, 0xcd, 0x6c, 0xc9, 0xd5, 0xcd, 0xd6, 0xc8, 0xcd, 0x21, 
-0xd4, 0xd1, 0x12, 0xc9, 0xcd, 0x6f, 0xc9, 0xeb, 0x46, 0x23, 0x7e, 0xc3, 0xb1, 0xd0, 0xcd, 0x6c, 
-0xc9, 0xd5, 0xcd, 0xd6, 0xc8, 0xcd, 0x6c, 0xc9, 0xe3, 0x73, 0x23, 0x72, 0xe1, 0xc9, 0x21, 0x4, 
-0xd9, 0xcd, 0xee, 0xd6, 0x18, 0x9, 0xcd, 0xee, 0xd6, 0x21, 0xc1, 0xd1, 0xcd, 0xc0, 0xd6, 0x78, 
-0xb7, 0xc8, 0x3a, 0xe8, 0x3, 0xb7, 0xca, 0xe0, 0xd6, 0x90, 0x30, 0xc, 0x2f, 0x3c, 0xeb, 0xcd, 
-0xc8, 0xd6, 0xeb, 0xcd, 0xe0, 0xd6, 0xc1, 0xd1, 0xfe, 0x19, 0xd0, 0xf5, 0xcd, 0x3, 0xd7, 0x67, 
-0xf1, 0xcd, 0x2a, 0xd5, 0xb4, 0x21, 0xe5, 0x3, 0xf2, 0xab, 0xd4, 0xcd, 0xa, 0xd5, 0x30, 0x4b, 
-0x23, 0x34, 0x28, 0x63, 0x2e, 0x1, 0xcd, 0x3e, 0xd5, 0x18, 0x40, 0xaf, 0x90, 0x47, 0x7e, 0x9b, 
-0x5f, 0x23, 0x7e, 0x9a, 0x57, 0x23, 0x7e, 0x99, 0x4f, 0xdc, 0x16, 0xd5, 0x68, 0x63, 0xaf, 0x47, 
-0x79, 0xb7, 0x20, 0x16, 0x4a, 0x54, 0x65, 0x6f, 0x78, 0xd6, 0x8, 0xfe, 0xe0, 0x20, 0xf0, 0xaf, 
-0x32, 0xe8, 0x3, 0xc9, 0x5, 0x29, 0xcb, 0x12, 0xcb, 0x11, 0xf2, 0xd4, 0xd4, 0x78, 0x5c, 0x45, 
-0xb7, 0x28, 0x8, 0x21, 0xe8, 0x3, 0x86, 0x77, 0x30, 0xe5, 0xc8, 0x78, 0x21, 0xe8, 0x3, 0xb7, 
-0xfc, 0xfd, 0xd4, 0x46, 0x23, 0x7e, 0xe6, 0x80, 0xa9, 0x4f, 0xc3, 0xe0, 0xd6, 0x1c, 0xc0, 0x14, 
-0xc0, 0xc, 0xc0, 0xe, 0x80, 0x34, 0xc0, 0xc3, 0x53, 0xd6, 0x7e, 0x83, 0x5f, 0x23, 0x7e, 0x8a, 
-0x57, 0x23, 0x7e, 0x89, 0x4f, 0xc9, 0x21, 0xe9, 0x3, 0x7e, 0x2f, 0x77, 0xaf, 0x6f, 0x90, 0x47, 
-0x7d, 0x9b, 0x5f, 0x7d, 0x9a, 0x57, 0x7d, 0x99, 0x4f, 0xc9, 0x6, 0x0, 0xd6, 0x8, 0x38, 0x7, 
-0x43, 0x5a, 0x51, 0xe, 0x0, 0x18, 0xf5, 0xc6, 0x9, 0x6f, 0xaf, 0x2d, 0xc8, 0x79, 0x1f, 0x4f, 
-0xcb, 0x1a, 0xcb, 0x1b, 0xcb, 0x18, 0x18, 0xf2, 0x0, 0x0, 0x0, 0x81, 0x3, 0xaa, 0x56, 0x19, 
-0x80, 0xf1, 0x22, 0x76, 0x80, 0x45, 0xaa, 0x38, 0x82, 0xcd, 0x97, 0xd6, 0xb7, 0xea, 0x67, 0xc9, 
-0x21, 0xe8, 0x3, 0x7e, 0x1, 0x35, 0x80, 0x11, 0xf3, 0x4, 0x90, 0xf5, 0x70, 0xd5, 0xc5, 0xcd, 
-0x6f, 0xd4, 0xc1, 0xd1, 0x4, 0xcd, 0xf5, 0xd5, 0x21, 0x48, 0xd5, 0xcd, 0x66, 0xd4, 0x21, 0x4c, 
-0xd5, 0xcd, 0xce, 0xd9, 0x1, 0x80, 0x80, 0x11, 0x0, 0x0, 0xcd, 0x6f, 0xd4, 0xf1, 0xcd, 0xb, 
-0xd8, 0x1, 0x31, 0x80, 0x11, 0x18, 0x72, 0x21, 0xc1, 0xd1, 0xcd, 0x97, 0xd6, 0xc8, 0x2e, 0x0, 
-0xcd, 0x58, 0xd6, 0x79, 0x32, 0xf7, 0x3, 0xeb, 0x22, 0xf8, 0x3, 0x1, 0x0, 0x0, 0x50, 0x58, 
-0x21, 0xbc, 0xd4, 0xe5, 0x21, 0xbc, 0xd5, 0xe5, 0xe5, 0x21, 0xe5, 0x3, 0x7e, 0x23, 0xb7, 0x28, 
-0x21, 0xe5, 0x2e, 0x8, 0x1f, 0x67, 0x79, 0x30, 0xb, 0xe5, 0x2a, 0xf8, 0x3, 0x19, 0xeb, 0xe1, 
-0x3a, 0xf7, 0x3, 0x89, 0x1f, 0x4f, 0xcb, 0x1a, 0xcb, 0x1b, 0xcb, 0x18, 0x2d, 0x7c, 0x20, 0xe4, 
-0xe1, 0xc9, 0x43, 0x5a, 0x51, 0x4f, 0xc9, 0xcd, 0xc8, 0xd6, 0x1, 0x20, 0x84, 0x11, 0x0, 0x0, 
-0xcd, 0xe0, 0xd6, 0xc1, 0xd1, 0xcd, 0x97, 0xd6, 0xca, 0x4b, 0xc3, 0x2e, 0xff, 0xcd, 0x58, 0xd6, 
-0x34, 0x34, 0x2b, 0x7e, 0x32, 0x14, 0x3, 0x2b, 0x7e, 0x32, 0x10, 0x3, 0x2b, 0x7e, 0x32, 0xc, 
-0x3, 0x41, 0xeb, 0xaf, 0x4f, 0x57, 0x5f, 0x32, 0x17, 0x3, 0xe5, 0xc5, 0x7d, 0xcd, 0xb, 0x3, 
-0xde, 0x0, 0x3f, 0x30, 0x7, 0x32, 0x17, 0x3, 0xf1, 0xf1, 0x37, 0xd2, 0xc1, 0xe1, 0x79, 0x3c, 
-0x3d, 0x1f, 0xfa, 0xec, 0xd4, 0x17, 0xcb, 0x13, 0xcb, 0x12, 0xcb, 0x11, 0x29, 0xcb, 0x10, 0x3a, 
-0x17, 0x3, 0x17, 0x32, 0x17, 0x3, 0x79, 0xb2, 0xb3, 0x20, 0xcf, 0xe5, 0x21, 0xe8, 0x3, 0x35, 
-0xe1, 0x20, 0xc7, 0x1e, 0xa, 0xc3, 0x56, 0xc3, 0x78, 0xb7, 0xca, 0x7c, 0xd6, 0x7d, 0x21, 0xe8, 
-0x3, 0xae, 0x80, 0x47, 0x1f, 0xa8, 0x78, 0xf2, 0x7b, 0xd6, 0xc6, 0x80, 0x77, 0xca, 0xe0, 0xd5, 
-0xcd, 0x3, 0xd7, 0x77, 0x2b, 0xc9, 0xcd, 0x97, 0xd6, 0x2f, 0xe1, 0xb7, 0xe1, 0xf2, 0xcf, 0xd4, 
-0x18, 0xd1, 0xcd, 0xeb, 0xd6, 0x78, 0xb7, 0xc8, 0xc6, 0x2, 0x38, 0xc7, 0x47, 0xcd, 0x6f, 0xd4, 
-0x21, 0xe8, 0x3, 0x34, 0xc0, 0x18, 0xbc, 0x3a, 0xe8, 0x3, 0xb7, 0xc8, 0x3a, 0xe7, 0x3, 0xfe, 
-0x2f, 0x17, 0x9f, 0xc0, 0x3c, 0xc9, 0xcd, 0x97, 0xd6, 0x6, 0x88, 0x11, 0x0, 0x0, 0x21, 0xe8, 
-0x3, 0x4f, 0x70, 0x6, 0x0, 0x23, 0x36, 0x80, 0x17, 0xc3, 0xb9, 0xd4, 0xcd, 0x97, 0xd6, 0xf0, 
-0x21, 0xe7, 0x3, 0x7e, 0xee, 0x80, 0x77, 0xc9, 0xeb, 0x2a, 0xe5, 0x3, 0xe3, 0xe5, 0x2a, 0xe7, 
-0x3, 0xe3, 0xe5, 0xeb, 0xc9, 0x1, 0x49, 0x82, 0x11, 0xdb, 0xf, 0x18, 0x3, 0xcd, 0xee, 0xd6, 
-0xed, 0x53, 0xe5, 0x3, 0xed, 0x43, 0xe7, 0x3, 0x50, 0x59, 0xc9, 0x21, 0xe5, 0x3, 0x5e, 0x23, 
-0x56, 0x23, 0x4e, 0x23, 0x46, 0x23, 0xc9, 0x11, 0xe5, 0x3, 0x6, 0x4, 0x1a, 0x77, 0x13, 0x23, 
-0x10, 0xfa, 0xc9, 0x21, 0xe7, 0x3, 0x7e, 0x7, 0x37, 0x1f, 0x77, 0x3f, 0x1f, 0x23, 0x23, 0x77, 
-0x79, 0x7, 0x37, 0x1f, 0x4f, 0x1f, 0xae, 0xc9, 0x78, 0xb7, 0xca, 0x97, 0xd6, 0x21, 0xa0, 0xd6, 
-0xe5, 0xcd, 0x97, 0xd6, 0x79, 0xc8, 0x21, 0xe7, 0x3, 0xae, 0x79, 0xf8, 0xcd, 0x32, 0xd7, 0x1f, 
-0xa9, 0xc9, 0x23, 0x78, 0xbe, 0xc0, 0x2b, 0x79, 0xbe, 0xc0, 0x2b, 0x7a, 0xbe, 0xc0, 0x2b, 0x7b, 
-0x96, 0xc0, 0xe1, 0xe1, 0xc9, 0x47, 0x4f, 0x57, 0x5f, 0xb7, 0xc8, 0xe5, 0xcd, 0xeb, 0xd6, 0xcd, 
-0x3, 0xd7, 0xae, 0x67, 0xfc, 0x69, 0xd7, 0x3e, 0x98, 0x90, 0xcd, 0x2a, 0xd5, 0x7c, 0x17, 0xdc, 
-0xfd, 0xd4, 0x6, 0x0, 0xdc, 0x16, 0xd5, 0xe1, 0xc9, 0x1b, 0x7a, 0xa3, 0x3c, 0xc0, 0xb, 0xc9, 
-0x21, 0xe8, 0x3, 0x7e, 0xfe, 0x98, 0x3a, 0xe5, 0x3, 0xd0, 0x7e, 0xcd, 0x45, 0xd7, 0x36, 0x98, 
-0x7b, 0xf5, 0x79, 0x17, 0xcd, 0xb9, 0xd4, 0xf1, 0xc9, 0x21, 0x0, 0x0, 0x78, 0xb1, 0xc8, 0x3e, 
-0x10, 0x29, 0x38, 0x6, 0xeb, 0x29, 0xeb, 0x30, 0x4, 0x9, 0xda, 0xb, 0xd0, 0x3d, 0x20, 0xf1, 
-0xc9, 0xfe, 0x2d, 0xf5, 0x28, 0x5, 0xfe, 0x2b, 0x28, 0x1, 0x2b, 0xcd, 0xcf, 0xd4, 0x47, 0x57, 
-0x5f, 0x2f, 0x4f, 0xcd, 0xbd, 0xc8, 0x38, 0x3d, 0xfe, 0x2e, 0x28, 0x16, 0xfe, 0x45, 0x20, 0x15, 
-0xcd, 0xbd, 0xc8, 0xcd, 0x4d, 0xce, 0xcd, 0xbd, 0xc8, 0x38, 0x4b, 0x14, 0x20, 0x7, 0xaf, 0x93, 
-0x5f, 0xc, 0xc, 0x28, 0xde, 0xe5, 0x7b, 0x90, 0xf4, 0xed, 0xd7, 0xf2, 0xe4, 0xd7, 0xf5, 0xcd, 
-0xe7, 0xd5, 0xf1, 0x3c, 0x20, 0xf2, 0xd1, 0xf1, 0xcc, 0xc0, 0xd6, 0xeb, 0xc9, 0xc8, 0xf5, 0xcd, 
-0x82, 0xd6, 0xf1, 0x3d, 0xc9, 0xd5, 0x57, 0x78, 0x89, 0x47, 0xc5, 0xe5, 0xd5, 0xcd, 0x82, 0xd6, 
-0xf1, 0xd6, 0x30, 0xcd, 0xb, 0xd8, 0xe1, 0xc1, 0xd1, 0x18, 0xa8, 0xcd, 0xc8, 0xd6, 0xcd, 0xa9, 
-0xd6, 0xc1, 0xd1, 0xc3, 0x6f, 0xd4, 0x7b, 0x7, 0x7, 0x83, 0x7, 0x86, 0xd6, 0x30, 0x5f, 0x18, 
-0xa5, 0xe5, 0x21, 0xd, 0xc3, 0xcd, 0xc9, 0xd1, 0xe1, 0xeb, 0xaf, 0x6, 0x98, 0xcd, 0xae, 0xd6, 
-0x21, 0xc8, 0xd1, 0xe5, 0x21, 0xea, 0x3, 0xe5, 0xcd, 0x97, 0xd6, 0x36, 0x20, 0xf2, 0x42, 0xd8, 
-0x36, 0x2d, 0x23, 0x36, 0x30, 0xca, 0xef, 0xd8, 0xe5, 0xfc, 0xc0, 0xd6, 0xaf, 0xf5, 0xcd, 0xf5, 
-0xd8, 0x1, 0x43, 0x91, 0x11, 0xf8, 0x4f, 0xcd, 0x18, 0xd7, 0xb7, 0xe2, 0x6e, 0xd8, 0xf1, 0xcd, 
-0xee, 0xd7, 0xf5, 0x18, 0xec, 0xcd, 0xe7, 0xd5, 0xf1, 0x3c, 0xf5, 0xcd, 0xf5, 0xd8, 0xcd, 0x5e, 
-0xd4, 0x3c, 0xcd, 0x45, 0xd7, 0xcd, 0xe0, 0xd6, 0x1, 0x6, 0x3, 0xf1, 0x81, 0x3c, 0xfa, 0x89, 
-0xd8, 0xfe, 0x8, 0x30, 0x4, 0x3c, 0x47, 0x3e, 0x2, 0x3d, 0x3d, 0xe1, 0xf5, 0x11, 0x8, 0xd9, 
-0x5, 0x20, 0x6, 0x36, 0x2e, 0x23, 0x36, 0x30, 0x23, 0x5, 0x36, 0x2e, 0xcc, 0xf5, 0xd6, 0xc5, 
-0xe5, 0xd5, 0xcd, 0xeb, 0xd6, 0xe1, 0x6, 0x2f, 0x4, 0x7b, 0x96, 0x5f, 0x23, 0x7a, 0x9e, 0x57, 
-0x23, 0x79, 0x9e, 0x4f, 0x2b, 0x2b, 0x30, 0xf0, 0xcd, 0xa, 0xd5, 0x23, 0xcd, 0xe0, 0xd6, 0xeb, 
-0xe1, 0x70, 0x23, 0xc1, 0xd, 0x20, 0xd2, 0x5, 0x28, 0xb, 0x2b, 0x7e, 0xfe, 0x30, 0x28, 0xfa, 
-0xfe, 0x2e, 0xc4, 0xf5, 0xd6, 0xf1, 0x28, 0x1a, 0x36, 0x45, 0x23, 0x36, 0x2b, 0xf2, 0xe4, 0xd8, 
-0x36, 0x2d, 0x2f, 0x3c, 0x6, 0x2f, 0x4, 0xd6, 0xa, 0x30, 0xfb, 0xc6, 0x3a, 0x23, 0x70, 0x23, 
-0x77, 0x23, 0x71, 0xe1, 0xc9, 0x1, 0x74, 0x94, 0x11, 0xf7, 0x23, 0xcd, 0x18, 0xd7, 0xb7, 0xe1, 
-0xe2, 0x65, 0xd8, 0xe9, 0x0, 0x0, 0x0, 0x80, 0xa0, 0x86, 0x1, 0x10, 0x27, 0x0, 0xe8, 0x3, 
-0x0, 0x64, 0x0, 0x0, 0xa, 0x0, 0x0, 0x1, 0x0, 0x0, 0x21, 0xc0, 0xd6, 0xe3, 0xe9, 0xcd, 
-0xc8, 0xd6, 0x21, 0x4, 0xd9, 0xcd, 0xdd, 0xd6, 0xc1, 0xd1, 0xcd, 0x97, 0xd6, 0x78, 0xca, 0x6d, 
-0xd9, 0xf2, 0x38, 0xd9, 0xb7, 0xca, 0x4b, 0xc3, 0xb7, 0xca, 0xd0, 0xd4, 0xd5, 0xc5, 0x79, 0xf6, 
-0x7f, 0xcd, 0xeb, 0xd6, 0xf2, 0x55, 0xd9, 0xd5, 0xc5, 0xcd, 0x70, 0xd7, 0xc1, 0xd1, 0xf5, 0xcd, 
-0x18, 0xd7, 0xe1, 0x7c, 0x1f, 0xe1, 0x22, 0xe7, 0x3, 0xe1, 0x22, 0xe5, 0x3, 0xdc, 0x1a, 0xd9, 
-0xcc, 0xc0, 0xd6, 0xd5, 0xc5, 0xcd, 0x59, 0xd5, 0xc1, 0xd1, 0xcd, 0x9a, 0xd5, 0xcd, 0xc8, 0xd6, 
-0x1, 0x38, 0x81, 0x11, 0x3b, 0xaa, 0xcd, 0x9a, 0xd5, 0x3a, 0xe8, 0x3, 0xfe, 0x88, 0xd2, 0x76, 
-0xd6, 0xcd, 0x70, 0xd7, 0xc6, 0x80, 0xc6, 0x2, 0xda, 0x76, 0xd6, 0xf5, 0x21, 0x48, 0xd5, 0xcd, 
-0x61, 0xd4, 0xcd, 0x91, 0xd5, 0xf1, 0xc1, 0xd1, 0xf5, 0xcd, 0x6c, 0xd4, 0xcd, 0xc0, 0xd6, 0x21, 
-0xad, 0xd9, 0xcd, 0xdd, 0xd9, 0x11, 0x0, 0x0, 0xc1, 0x4a, 0xc3, 0x9a, 0xd5, 0x8, 0x40, 0x2e, 
-0x94, 0x74, 0x70, 0x4f, 0x2e, 0x77, 0x6e, 0x2, 0x88, 0x7a, 0xe6, 0xa0, 0x2a, 0x7c, 0x50, 0xaa, 
-0xaa, 0x7e, 0xff, 0xff, 0x7f, 0x7f, 0x0, 0x0, 0x80, 0x81, 0x0, 0x0, 0x0, 0x81, 0xcd, 0xc8, 
-0xd6, 0x11, 0x98, 0xd5, 0xd5, 0xe5, 0xcd, 0xeb, 0xd6, 0xcd, 0x9a, 0xd5, 0xe1, 0xcd, 0xc8, 0xd6, 
-0x7e, 0x23, 0xcd, 0xdd, 0xd6, 0x6, 0xf1, 0xc1, 0xd1, 0x3d, 0xc8, 0xd5, 0xc5, 0xf5, 0xe5, 0xcd, 
-0x9a, 0xd5, 0xe1, 0xcd, 0xee, 0xd6, 0xe5, 0xcd, 0x6f, 0xd4, 0xe1, 0x18, 0xe9, 0xcd, 0x97, 0xd6, 
-0x21, 0x1b, 0x3, 0xfa, 0x5d, 0xda, 0x21, 0x3c, 0x3, 0xcd, 0xdd, 0xd6, 0x21, 0x1b, 0x3, 0xc8, 
-0x86, 0xe6, 0x7, 0x6, 0x0, 0x77, 0x23, 0x87, 0x87, 0x4f, 0x9, 0xcd, 0xee, 0xd6, 0xcd, 0x9a, 
-0xd5, 0x3a, 0x1a, 0x3, 0x3c, 0xe6, 0x3, 0x6, 0x0, 0xfe, 0x1, 0x88, 0x32, 0x1a, 0x3, 0x21, 
-0x60, 0xda, 0x87, 0x87, 0x4f, 0x9, 0xcd, 0x61, 0xd4, 0xcd, 0xeb, 0xd6, 0x7b, 0x59, 0xee, 0x4f, 
-0x4f, 0x36, 0x80, 0x2b, 0x46, 0x36, 0x80, 0x21, 0x19, 0x3, 0x34, 0x7e, 0xd6, 0xab, 0x20, 0x4, 
-0x77, 0xc, 0x15, 0x1c, 0xcd, 0xbc, 0xd4, 0x21, 0x3c, 0x3, 0xc3, 0xf7, 0xd6, 0x77, 0x2b, 0x77, 
-0x2b, 0x77, 0x18, 0xd5, 0x68, 0xb1, 0x46, 0x68, 0x99, 0xe9, 0x92, 0x69, 0x10, 0xd1, 0x75, 0x68, 
-0x21, 0xba, 0xda, 0xcd, 0x61, 0xd4, 0xcd, 0xc8, 0xd6, 0x1, 0x49, 0x83, 0x11, 0xdb, 0xf, 0xcd, 
-0xe0, 0xd6, 0xc1, 0xd1, 0xcd, 0xf5, 0xd5, 0xcd, 0xc8, 0xd6, 0xcd, 0x70, 0xd7, 0xc1, 0xd1, 0xcd, 
-0x6c, 0xd4, 0x21, 0xbe, 0xda, 0xcd, 0x66, 0xd4, 0xcd, 0x97, 0xd6, 0x37, 0xf2, 0xa6, 0xda, 0xcd, 
-0x5e, 0xd4, 0xcd, 0x97, 0xd6, 0xb7, 0xf5, 0xf4, 0xc0, 0xd6, 0x21, 0xbe, 0xda, 0xcd, 0x61, 0xd4, 
-0xf1, 0xd4, 0xc0, 0xd6, 0x21, 0xc2, 0xda, 0xc3, 0xce, 0xd9, 0xdb, 0xf, 0x49, 0x81, 0x0, 0x0, 
-0x0, 0x7f, 0x5, 0xba, 0xd7, 0x1e, 0x86, 0x64, 0x26, 0x99, 0x87, 0x58, 0x34, 0x23, 0x87, 0xe0, 
-0x5d, 0xa5, 0x86, 0xda, 0xf, 0x49, 0x83, 0xcd, 0xc8, 0xd6, 0xcd, 0x76, 0xda, 0xc1, 0xe1, 0xcd, 
-0xc8, 0xd6, 0xeb, 0xcd, 0xe0, 0xd6, 0xcd, 0x70, 0xda, 0xc3, 0xf3, 0xd5, 0xcd, 0x97, 0xd6, 0xfc, 
-0x1a, 0xd9, 0xfc, 0xc0, 0xd6, 0x3a, 0xe8, 0x3, 0xfe, 0x81, 0xda, 0x9, 0xdb, 0x1, 0x0, 0x81, 
-0x51, 0x59, 0xcd, 0xf5, 0xd5, 0x21, 0x66, 0xd4, 0xe5, 0x21, 0x13, 0xdb, 0xcd, 0xce, 0xd9, 0x21, 
-0xba, 0xda, 0xc9, 0x9, 0x4a, 0xd7, 0x3b, 0x78, 0x2, 0x6e, 0x84, 0x7b, 0xfe, 0xc1, 0x2f, 0x7c, 
-0x74, 0x31, 0x9a, 0x7d, 0x84, 0x3d, 0x5a, 0x7d, 0xc8, 0x7f, 0x91, 0x7e, 0xe4, 0xbb, 0x4c, 0x7e, 
-0x6c, 0xaa, 0xaa, 0x7f, 0x0, 0x0, 0x0, 0x81, 0xcd, 0x49, 0xdb, 0x28, 0x3, 0xcd, 0x6c, 0xc9, 
-0xe5, 0x21, 0x47, 0xdb, 0xe5, 0xeb, 0xe9, 0xe1, 0xc9, 0xfe, 0xae, 0xc0, 0x11, 0x0, 0x0, 0xcd, 
-0xbd, 0xc8, 0xc8, 0x38, 0xb, 0xfe, 0x94, 0x28, 0x16, 0xfe, 0x47, 0xd2, 0x48, 0xc3, 0xd6, 0x7, 
-0xd6, 0x30, 0xda, 0x48, 0xc3, 0xeb, 0x29, 0x29, 0x29, 0x29, 0xb5, 0x6f, 0xeb, 0x18, 0xe0, 0x7b, 
-0x87, 0x87, 0x87, 0x87, 0xf6, 0xd, 0x57, 0x1e, 0xef, 0x18, 0xd4, 0xd5, 0xe5, 0x36, 0x0, 0x23, 
-0xcd, 0x89, 0xc6, 0x20, 0xf8, 0xe3, 0xe5, 0xcd, 0xfe, 0xd2, 0xcd, 0x9, 0xd2, 0x2a, 0xc4, 0x3, 
-0xed, 0x5b, 0x56, 0x3, 0xaf, 0xed, 0x52, 0xd1, 0xe3, 0xed, 0x52, 0xe5, 0xcd, 0x28, 0xdd, 0x4f, 
-0xcd, 0xe4, 0xdd, 0x47, 0xe1, 0xcd, 0xe4, 0xdd, 0x12, 0x13, 0x2b, 0x7d, 0xb4, 0x20, 0xf6, 0xe1, 
-0xcd, 0xe4, 0xdd, 0x5f, 0xcd, 0xe4, 0xdd, 0x57, 0xaf, 0xed, 0x52, 0x38, 0x44, 0x2a, 0x56, 0x3, 
-0x23, 0xcd, 0xe4, 0xdd, 0x77, 0x23, 0x1b, 0x7b, 0xb2, 0x20, 0xf6, 0xd1, 0xe3, 0xc5, 0xcd, 0xf8, 
-0xdc, 0xe3, 0xed, 0x42, 0x20, 0x2d, 0xe1, 0xcd, 0x77, 0xdd, 0xe3, 0x2b, 0xd5, 0xed, 0x5b, 0xc4, 
-0x3, 0xed, 0xb8, 0xed, 0x53, 0xc4, 0x3, 0xe1, 0x42, 0x4b, 0x3, 0xd1, 0x2b, 0x70, 0x2b, 0x71, 
-0x2b, 0x35, 0x3, 0x20, 0xfc, 0xb, 0x2b, 0xcd, 0x89, 0xc6, 0x20, 0xf0, 0xe1, 0xcd, 0xfd, 0xdd, 
-0xc9, 0xd1, 0xe1, 0x36, 0x0, 0x23, 0xcd, 0x89, 0xc6, 0x20, 0xf8, 0x18, 0x29, 0xcd, 0x87, 0xdc, 
-0xe5, 0xe2, 0x7b, 0xdb, 0xeb, 0xed, 0x52, 0xe5, 0xcd, 0x28, 0xdd, 0x4f, 0xcd, 0xe4, 0xdd, 0x47, 
-0xe1, 0xcd, 0xe4, 0xdd, 0x12, 0x13, 0x2b, 0x7d, 0xb4, 0x20, 0xf6, 0xe1, 0xc5, 0xcd, 0xf8, 0xdc, 
-0xe1, 0xed, 0x42, 0xe1, 0x28, 0xc7, 0xcd, 0x1d, 0xde, 0x21, 0x3f, 0xdc, 0xc3, 0x71, 0xc3, 0x42, 
-0x41, 0x44, 0x0, 0xfe, 0xae, 0x28, 0xc6, 0xcd, 0xb0, 0xdc, 0xed, 0x5b, 0xd7, 0x3, 0x1b, 0x1b, 
-0x21, 0x0, 0x0, 0x39, 0x1, 0xd1, 0xff, 0xed, 0x52, 0x9, 0x44, 0x4d, 0xcd, 0x28, 0xdd, 0x6f, 
-0xcd, 0xe4, 0xdd, 0x67, 0xe5, 0xed, 0x42, 0xe1, 0xd2, 0x3e, 0xc3, 0xcd, 0xe4, 0xdd, 0x12, 0x13, 
-0x2b, 0x7d, 0xb4, 0x20, 0xf6, 0xed, 0x53, 0xd7, 0x3, 0x21, 0x12, 0xc3, 0xcd, 0xc9, 0xd1, 0xc3, 
-0x8a, 0xc4, 0x1e, 0x26, 0xc3, 0x56, 0xc3, 0xcd, 0xac, 0xdc, 0xe1, 0xcd, 0xcc, 0xc8, 0x3b, 0x3e, 
-0x1, 0x32, 0xcc, 0x3, 0xcd, 0x6, 0xcf, 0x32, 0xcc, 0x3, 0xe3, 0xe5, 0x60, 0x69, 0xeb, 0x19, 
-0xeb, 0x4e, 0x6, 0x0, 0x9, 0x9, 0x23, 0x3a, 0xae, 0x3, 0xb7, 0xc9, 0x3e, 0xd4, 0x23, 0x1, 
-0x3e, 0xd3, 0xf5, 0x3a, 0x5d, 0x3, 0xa7, 0x3e, 0x0, 0x32, 0x5d, 0x3, 0x28, 0x4, 0xf1, 0xc6, 
-0x4, 0xf5, 0xcd, 0xbe, 0xc8, 0xcd, 0x3a, 0xcd, 0xf1, 0xe3, 0xe5, 0xf5, 0xcd, 0x3f, 0xd3, 0x21, 
-0xf7, 0x3, 0x6, 0xd, 0x2b, 0x36, 0x20, 0x10, 0xfb, 0xd5, 0x11, 0x82, 0xdc, 0x73, 0x23, 0x72, 
-0xd1, 0x23, 0xf1, 0x77, 0x23, 0x77, 0x23, 0x77, 0x23, 0xeb, 0x6, 0x0, 0x79, 0xfe, 0x9, 0x38, 
-0x4, 0xd, 0x23, 0x18, 0xf7, 0xed, 0xb0, 0xc9, 0xe5, 0xaf, 0x47, 0x86, 0xcd, 0x3, 0xdd, 0x20, 
-0xfa, 0xe1, 0xc9, 0x4f, 0x30, 0x1, 0x4, 0x23, 0xcd, 0x89, 0xc6, 0x79, 0xc9, 0xf5, 0x3a, 0x7, 
-0x3, 0xcb, 0x4f, 0xcb, 0xcf, 0x32, 0x7, 0x3, 0x3e, 0x13, 0x20, 0x2, 0xc6, 0x8, 0x32, 0x8, 
-0x3, 0x21, 0xea, 0x3, 0xf1, 0xc3, 0xd5, 0xdd, 0x3a, 0x7, 0x3, 0xcb, 0x47, 0xcb, 0xc7, 0x32, 
-0x7, 0x3, 0x3e, 0x12, 0x20, 0x2, 0xc6, 0x8, 0x32, 0x9, 0x3, 0x21, 0xea, 0x3, 0xc3, 0xe4, 
-0xdd, 0xfe, 0xae, 0x28, 0x24, 0xcd, 0x97, 0xc6, 0xcd, 0xb0, 0xdc, 0x2a, 0xd7, 0x3, 0x11, 0xff, 
-0xfb, 0x19, 0x44, 0x4d, 0x11, 0x1, 0x4, 0xcd, 0xb5, 0xdd, 0xe1, 0xe5, 0x21, 0x7, 0x3, 0xcb, 
-0x8e, 0x11, 0x43, 0x3, 0xcd, 0xf6, 0xdf, 0xe1, 0xc9, 0xcd, 0x87, 0xdc, 0xe2, 0x89, 0xdd, 0xcd, 
-0xf8, 0xdc, 0xeb, 0xed, 0x52, 0x18, 0xe0, 0xe5, 0x1, 0x0, 0x0, 0x7e, 0x23, 0x77, 0x34, 0x81, 
-0x23, 0x23, 0xcd, 0x3, 0xdd, 0x20, 0xf4, 0xe1, 0xc9, 0xcd, 0x77, 0xdd, 0xc5, 0xcd, 0xf8, 0xdc, 
-0xeb, 0xed, 0x52, 0xcd, 0xb5, 0xdd, 0xc1, 0x79, 0xcd, 0xd5, 0xdd, 0x78, 0xeb, 0xcd, 0xd5, 0xdd, 
-0x2b, 0x2b, 0x78, 0xb1, 0x28, 0xb4, 0x56, 0x2b, 0x5e, 0x2b, 0x35, 0x28, 0xf3, 0x1a, 0xcd, 0xd5, 
-0xdd, 0x13, 0xb, 0x18, 0xf5, 0x23, 0xe5, 0x79, 0xcd, 0xd, 0xdd, 0x78, 0xe1, 0xcd, 0xd5, 0xdd, 
-0x2b, 0x7d, 0xb4, 0x1a, 0x13, 0x20, 0xf6, 0xc9, 0x3a, 0x8, 0x3, 0xe6, 0x7, 0xd6, 0x1, 0xc9, 
-0xcd, 0x1d, 0xde, 0x3e, 0xc, 0xf5, 0xd5, 0x57, 0x3a, 0x8, 0x3, 0x5f, 0x7a, 0xcd, 0xf6, 0xdf, 
-0x7b, 0xd1, 0x18, 0x3c, 0xd5, 0x3a, 0x9, 0x3, 0x5f, 0xcd, 0xf6, 0xdf, 0x7b, 0x32, 0x9, 0x3, 
-0x7a, 0x18, 0x6, 0xd5, 0x1e, 0x80, 0xcd, 0xf6, 0xdf, 0xcb, 0x7b, 0xd1, 0xc9, 0xf5, 0xe5, 0xd5, 
-0xc5, 0x11, 0x42, 0x3, 0x6, 0x6, 0x7a, 0x21, 0x7, 0x3, 0xcb, 0x3e, 0xdc, 0xf6, 0xdf, 0x1c, 
-0x10, 0xf8, 0xc1, 0xd1, 0xe1, 0x3e, 0xf5, 0x3e, 0x0, 0x32, 0x9, 0x3, 0x3e, 0xf5, 0x3e, 0x1, 
-0x32, 0x8, 0x3, 0xf1, 0xc9, 0x7e, 0xfe, 0x23, 0x20, 0x31, 0xcd, 0xbd, 0xc8, 0x30, 0x38, 0x23, 
-0xe5, 0xe6, 0x3, 0x28, 0x12, 0x21, 0x7, 0x3, 0x87, 0xfe, 0x4, 0x28, 0x12, 0x30, 0x16, 0xcb, 
-0x4e, 0xcb, 0xce, 0x20, 0x2, 0xc6, 0x8, 0x3c, 0x32, 0x8, 0x3, 0xe1, 0xc3, 0xbe, 0xc8, 0xcb, 
-0x5e, 0xcb, 0xde, 0x18, 0xee, 0xcb, 0x6e, 0xcb, 0xee, 0x18, 0xe8, 0xe5, 0xaf, 0x18, 0xe8, 0x7e, 
-0xfe, 0x23, 0x20, 0x30, 0xcd, 0xbd, 0xc8, 0xd2, 0x48, 0xc3, 0x23, 0xe5, 0xe6, 0x3, 0x28, 0x12, 
-0x21, 0x7, 0x3, 0x87, 0xfe, 0x4, 0x28, 0x10, 0x38, 0x14, 0xcb, 0x66, 0xcb, 0xe6, 0x20, 0x2, 
-0xc6, 0x8, 0x32, 0x9, 0x3, 0xe1, 0x18, 0xc4, 0xcb, 0x56, 0xcb, 0xd6, 0x18, 0xf0, 0xcb, 0x46, 
-0xcb, 0xc6, 0x18, 0xea, 0xe5, 0xaf, 0x18, 0xea, 0xc5, 0xcd, 0x2a, 0xd8, 0xe1, 0x23, 0x23, 0x23, 
-0x23, 0x1, 0x61, 0x3, 0xc5, 0x18, 0x3, 0xcd, 0xd7, 0xde, 0x7e, 0x23, 0xfe, 0x22, 0x28, 0x16, 
-0xb7, 0x28, 0x1f, 0xf2, 0xa7, 0xde, 0xc5, 0xcd, 0x9a, 0xc7, 0xc1, 0xcd, 0xd7, 0xde, 0x1a, 0x13, 
-0xb7, 0xf2, 0xbb, 0xde, 0x18, 0xe4, 0xcd, 0xd7, 0xde, 0x7e, 0x23, 0xfe, 0x22, 0x28, 0xd8, 0xb7, 
-0x20, 0xf4, 0x3e, 0x20, 0x3, 0x18, 0xc, 0x3, 0x2, 0xe5, 0x21, 0x56, 0xfc, 0x9, 0xe1, 0xd0, 
-0xe1, 0x3e, 0x2a, 0xcd, 0xd5, 0xdd, 0xaf, 0x2, 0xe1, 0x77, 0x23, 0xe5, 0xcd, 0xf1, 0xc5, 0xd1, 
-0x23, 0x36, 0x0, 0x2b, 0x36, 0x20, 0xcd, 0xe4, 0xdd, 0xfe, 0xa, 0x20, 0x5, 0xcd, 0x12, 0xdf, 
-0x3c, 0xc9, 0xcd, 0xf, 0xdf, 0xc8, 0xcd, 0x27, 0xdf, 0xd8, 0xcd, 0x32, 0xdf, 0x18, 0xe7, 0xfe, 
-0xd, 0xc0, 0x3e, 0x9, 0xcd, 0xd5, 0xdd, 0x23, 0x7e, 0xb7, 0x20, 0xf6, 0x2b, 0x7e, 0xfe, 0x20, 
-0x20, 0x2, 0x36, 0x0, 0xc3, 0x5e, 0xcb, 0xfe, 0x3, 0x28, 0x2, 0xa7, 0xc9, 0xcd, 0x12, 0xdf, 
-0x37, 0xc9, 0xfe, 0x8, 0x28, 0x44, 0xfe, 0x9, 0x28, 0x2a, 0xfe, 0x1f, 0x28, 0x47, 0xfe, 0x19, 
-0xca, 0xc5, 0xdf, 0xfe, 0x18, 0xca, 0xcf, 0xdf, 0xfe, 0x2, 0xca, 0xdb, 0xdf, 0xfe, 0x1a, 0x28, 
-0x48, 0xfe, 0xb, 0xc8, 0xfe, 0xa, 0xc8, 0xfe, 0x1, 0xc8, 0xfe, 0x20, 0x30, 0x5, 0x3f, 0xcd, 
-0xd5, 0xdd, 0xc9, 0x77, 0xcd, 0xd5, 0xdd, 0x23, 0x7e, 0xb7, 0xc0, 0x11, 0xab, 0x3, 0xcd, 0x89, 
-0xc6, 0x28, 0x7, 0x36, 0x20, 0x23, 0x36, 0x0, 0x18, 0x3, 0xcd, 0xa2, 0xc6, 0x2b, 0x7e, 0xb7, 
-0xc0, 0x3e, 0x9, 0x18, 0xdf, 0xe5, 0x23, 0xcd, 0xf1, 0xc5, 0xcd, 0xa9, 0xc6, 0xd1, 0xaf, 0x2b, 
-0x46, 0x77, 0xcd, 0xa2, 0xc6, 0x78, 0x20, 0xf7, 0xc9, 0xcd, 0xa9, 0xc6, 0xe5, 0xcd, 0xf1, 0xc5, 
-0x11, 0xab, 0x3, 0xcd, 0x89, 0xc6, 0x20, 0xc, 0xcd, 0xa2, 0xc6, 0xcd, 0xa9, 0xc6, 0xcd, 0xa2, 
-0xc6, 0x2b, 0x36, 0x0, 0xd1, 0x44, 0x4d, 0x3, 0x7e, 0x2, 0xb, 0xcd, 0xa2, 0xc6, 0x2b, 0x20, 
-0xf7, 0x23, 0x36, 0x20, 0xc9, 0xcd, 0xa2, 0xc6, 0x2b, 0x7e, 0xb7, 0x20, 0xf8, 0x18, 0xb2, 0x3e, 
-0x9, 0xcd, 0xd5, 0xdd, 0x23, 0x7e, 0xb7, 0x20, 0xf6, 0x18, 0x90, 0xcd, 0xc5, 0xdf, 0xe5, 0x7e, 
-0xb7, 0x28, 0x5, 0x36, 0x20, 0x23, 0x18, 0xf7, 0xe1, 0xcd, 0xf1, 0xc5, 0xcd, 0xc5, 0xdf, 0x23, 
-0x36, 0x0, 0x2b, 0xc9, 0x1e, 0xff, 0xc3, 0xe, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-
-};
-dump_item dump_items[DUMP_NUM_ITEMS] = {
+static const unsigned char dump_kc87_os_2_lz4[] =
+"\xf0\xff\x11\xff\xff\xff\xc3\xd2\xe0\xc3\xf3\xe0\xc3\x57\xe1\x11\xe0\xc3\x00\xe6\xc9\x4e\x4b\x45\x59\x24\xca\x4f\x59\x53\x54\xd3"
+"\x54\x52\x49\x4e\x47\x24\xc9\x4e\x53\x54\x52\xd2\x45\x4e\x55\x4d\xc4\x45\x4c\x45\x54\x45\xd0\x41\x55\x53\x45\xc2\x45\x45\x50\xd7"
+"\x49\x4e\x44\x4f\x57\xc2\x4f\x52\x44\x45\x52\xc9\x4e\x4b\xd0\x41\x50\x45\x52\xc1\x54\xd0\x53\x45\x54\xcc\x49\x4e\x45\xc3\x49\x52"
+"\x43\x4c\x45\xa1\xd0\x41\x49\x4e\x54\xcc\x41\x42\x45\x4c\xd3\x49\x5a\x45\xda\x45\x52\x4f\xc8\x4f\x4d\x45\xa1\xc7\x43\x4c\x53\xd3"
+"\x43\x41\x4c\x45\xd3\x43\x52\x45\x45\x4e\xd0\x4f\x49\x4e\x54\xd8\x50\x4f\x53\xa1\xd9\x50\x4f\x53\x80\x19\xe4\xf5\xe4\x3c\xe4\xc1"
+"\xe4\xf8\xe1\xcd\xe5\xa7\xe3\x34\xe4\xb5\xe1\x79\xe1\x7d\xe1\x7e\xe1\x17\xe5\xd6\xa7\xd9\xa7\xdc\xa7\x4a\xca\xdf\xa7\xe2\xa7\xe5"
+"\xa7\xe8\xa7\xeb\xa7\x4a\xca\xee\xa7\xf1\xa7\xf4\xa7\xf7\xa7\xfa\xa7\x4a\xca\xfd\xa7\x78\xd6\x09\x38\x6d\xfe\x09\x38\x07\xcd\xf1"
+"\xe5\xfe\x16\x30\x62\x07\x4f\x06\x00\xeb\x21\x9e\xe0\x09\x4e\x23\x46\xc5\xeb\xc3\xbd\xc8\x7e\xfe\xdf\xd8\xfe\xe2\xd0\xfe\xe1\xca"
+"\x17\xe5\x3a\xfd\x03\xa7\x20\x3f\x3c\x32\xfd\x03\x3a\x27\x00\xf5\x7e\xfe\xdf\x28\x0d\xcd\xbd\xc8\xcd\x7e\xe1\x7e\xfe\x3b\x28\x35"
+"\x18\x25\x0d\x00\x11\x7d\x0d\x00\x80\x28\xcd\xd6\xc8\xfe\xe0\x20\x13\x12\x00\xf1\x07\x7e\xe1\xcd\xcc\xc8\x3b\xcd\x03\xcb\xf1\x32"
+"\x27\x00\xc1\xc9\x3e\xe2\xd3\xb8\xc3\x48\xc3\x07\x00\xf0\x01\x67\xc9\xcd\xbd\xc8\x18\xe4\x79\xd6\x3e\x38\xe8\xfe\x07\x38\x0b\x85"
+"\x00\xf0\x20\x32\x38\xdd\xfe\x3b\x30\xd9\xeb\x01\x96\xe0\xe1\x6f\x09\x4e\x23\x66\x69\xe5\xeb\xc9\x3e\x01\x18\x02\xf6\xaf\xf5\xcd"
+"\x21\xd4\xfe\x01\x38\x6e\xfe\x09\x30\x6a\x3d\x4f\xf1\xb7\x28\x0b\xcb\x21\x02\x00\xf5\x1d\x3d\x28\x17\xcb\x21\x41\xb7\x3a\x27\x00"
+"\x28\x0a\xe6\x07\xb0\x32\x27\x00\x32\x28\x00\xc9\xe6\x70\x18\xf4\x79\xd3\x88\xc9\x0e\x1d\xcd\x05\x00\xcd\xbe\xc8\x28\x2d\xcd\xf7"
+"\xe7\xf5\x04\x00\xf0\x3e\x21\xd4\x3c\x3c\x57\xfe\x2a\x30\x20\xf1\x5f\xf1\x3c\x3c\x47\xfe\x1a\x30\x16\xf1\x4f\x3c\xb8\x30\x10\x7b"
+"\x3c\xba\x30\x0b\x18\x06\x01\x00\x19\x11\x00\x29\xc3\xe6\xe7\xc3\x4b\xe1\x01\x0a\x00\xc5\x50\x58\x28\x27\xfe\x2c\x28\x09\xd5\xcd"
+"\x86\xc9\x42\x4b\xd1\x28\x1a\xcd\xd6\xc8\xcd\x86\xc9\x28\x12\xf1\xcd\xd6\xc8\x15\x00\xf1\x01\xc2\x44\xe1\x7a\xb3\x28\xd1\xeb\xe3"
+"\xeb\xd5\xc5\xcd\xbb\xc4\xd1\x06\x00\xf0\x31\x60\x69\xd1\xcd\x89\xc6\xeb\x38\xba\xd1\xf1\xc1\xd5\xf5\x18\x0e\x09\x38\xf4\xeb\xe5"
+"\x21\xf9\xff\xcd\x89\xc6\xe1\x38\xe9\xd5\x5e\x23\x56\x7a\xb3\xeb\xd1\x28\x07\x7e\x23\xb6\x2b\xeb\x20\xe1\xc5\x0e\x80\xcd\x27\xc3"
+"\xaf\xcd\x9a\xe2\xaf\x3c\xcd\x9a\xe2\xc1\xd1\x4a\x00\x52\x60\x69\xc1\xd1\xf1\x2b\x00\xf1\x18\x28\x0d\xeb\xe3\xeb\x23\x73\x23\x72"
+"\xeb\x09\xeb\xe1\x18\xeb\x3d\xcd\x9a\xe2\x01\x8a\xc4\xc5\x3e\x02\x32\x4e\x03\x2a\x5f\x03\x2b\xc5\xc5\x23\xc1\xc1\x44\x4d\x57\x00"
+"\xf0\x92\xc8\xc5\xd5\x23\x23\xcd\xbd\xc8\xb7\x28\xeb\x4f\x3a\x4e\x03\xb7\x79\x28\x5f\xfe\x0d\x20\xee\xe5\xe5\x23\x5e\x23\x56\x3a"
+"\x4e\x03\x3d\x28\x7e\x3d\x28\x0e\xeb\x23\x23\x1b\xed\xa0\xed\xa0\xeb\xd1\xd1\x2b\x18\xd1\xd5\xeb\x13\x2a\xd7\x03\xed\x52\x44\x4d"
+"\xe1\xe3\xeb\xc5\xed\xb0\xc1\xd1\xe1\xe5\xc5\xaf\x06\x98\xcd\xae\xd6\xcd\x34\xd8\xc1\xd1\x23\x7e\xeb\x2b\xb7\x28\xaa\x23\xeb\xc5"
+"\xe5\xeb\x09\x54\x5d\x13\xed\x53\xd7\x03\x1b\x2b\xed\xb8\xe1\xed\xa0\xc1\x18\xe3\xfe\x88\x28\x19\xfe\x8c\x28\x15\xfe\x8b\x28\x11"
+"\xfe\xd4\x28\x0d\xfe\xda\x28\x09\xfe\xd3\x28\x05\xfe\xa9\xc2\xb2\xe2\xcd\x87\xc9\xe5\xcd\xbb\xc4\xe1\x38\x14\x7e\xfe\x2c\x28\xf1"
+"\x2b\x18\xeb\x0e\x00\xa1\x23\x71\x23\x70\xd1\xc3\xb2\xe2\xd5\xeb\x78\x00\xf1\x0c\x23\xe5\xc1\x62\x6b\x1b\x1a\xfe\x2c\x28\x10\xfe"
+"\x3a\x30\x0c\xf1\xe3\x2b\xe3\xf5\xc5\xd5\xed\xb0\xd1\x18\xe7\x70\x00\x22\x13\x13\x73\x00\xf0\x4e\xed\xb8\x3e\x0d\x23\x77\x23\xd1"
+"\x73\x23\x72\xd1\xe3\x13\x13\x13\x73\x23\x72\x2b\xe3\xd5\xe5\xcd\x93\xc4\xe1\x23\x18\x9f\xcd\xbe\xc8\x20\x11\xcd\xf3\xdd\x20\xfb"
+"\xfe\x03\x28\x07\xfe\x1e\x20\xf3\xcd\xe4\xdd\xc9\xcd\x5e\xc9\x7a\xb3\xc8\xe5\x21\x01\x00\xdd\x21\x0b\xe4\x3e\x05\x0e\x8d\x06\x0a"
+"\xdd\x86\x00\x10\xfb\x0d\x20\xf6\x3d\x20\xf1\xa7\xeb\xed\x52\xeb\x28\x1b\xf5\xc5\xd5\x3a\x00\xf3\x17\x08\xfe\x1e\x28\x09\xfe\x03"
+"\x28\x08\xd1\xc1\xf1\x18\xcf\xcd\xe4\xdd\xd1\xc1\xf1\xe1\xc9\xc3\x0d\xc0\x42\x41\x53\x49\x43\x20\x20\x20\x00\xc3\x8c\xc0\x57\x0d"
+"\x00\x30\x00\x00\xe5\x34\x00\xf1\x13\x0f\x3e\x01\xcd\x7b\xd1\xcd\xe4\xdd\x2a\xc2\x03\x77\xc3\xa9\xd1\xaf\xcd\x7b\xd1\x18\xf7\x0e"
+"\x02\x1e\x07\xcd\x05\x00\xc9\xcd\xcc\xc8\x28\x7d\x02\xf0\x42\x8e\xe4\xf5\xcd\xdb\xc8\xf1\xe3\x44\xe5\xf5\xd5\x4f\xaf\xb9\x28\x0c"
+"\xb8\x28\x09\x79\x05\x28\x05\x81\x38\x29\x10\xfb\x47\x0e\x00\xcd\xe1\xd1\xc1\xc5\xcd\x7e\xd1\xe1\xe3\x7c\xe1\xe3\x6f\x24\x25\xe5"
+"\xc5\x28\x07\xcd\xf2\xd2\xc1\xe1\x18\xf4\xc1\xe1\xd1\xcd\x02\xd3\xc3\xa9\xd1\x1e\x1c\xc3\x56\xc3\xcd\x3a\xcd\xe5\xcd\x30\xd3\x23"
+"\xd0\x01\xf0\x04\xe1\xc9\x23\xe5\x2b\x0d\xc5\x0c\x13\x05\x28\x11\x23\x0d\x28\x09\x1a\xbe\x28\x2e\x00\xf1\x01\x18\x2c\xe1\xe1\x18"
+"\x31\xd1\xe1\xd1\xd1\xa7\xed\x52\x7d\x18\x2a\x85\x00\x40\x8e\xe4\xd5\xf5\xbd\x02\x03\x89\x00\xf0\x15\x28\x1a\x4f\xf1\x28\x6d\x47"
+"\xe3\xeb\xe5\xd5\x1a\xbe\x28\xb8\x23\x0d\x20\xf9\xaf\xe1\xe1\x11\xf3\xcd\xd5\x18\x23\xd1\xe3\x18\xf6\xcd\xe1\xcd\xe5\x0e\x00\xf1"
+"\x16\xcd\x24\xd4\xa7\x28\x45\xfe\x03\x30\x41\x0e\x06\xcd\x05\x00\x38\x3a\xfe\x01\x28\x01\x48\x79\xc3\xc0\xd0\x3a\xfd\x03\xcb\x4f"
+"\xcb\xcf\x32\xfd\x03\x20\x04\x04\x04\xea\x00\x20\x21\xd4\xea\x00\x00\xfe\x03\xf0\x2b\xf1\x4f\xf1\xe5\x47\x78\xfe\x18\x30\x05\x79"
+"\xfe\x28\x38\x03\xc3\x4b\xe1\x2e\x00\x65\x55\x1e\x28\x04\x05\x28\x03\x19\x10\xfd\x59\x19\x11\x00\xec\x19\x54\x5d\x01\x00\xfc\x09"
+"\xe3\xd5\xfe\xd5\x38\x09\x3a\xfc\x03\xa7\x28\x03\xcd\x06\xe0\xe5\x00\xf0\x29\x3a\xae\x03\xb7\x20\x0c\xcd\x34\xd8\xcd\x8a\xd1\x36"
+"\x20\x2a\xe5\x03\x34\xcd\xfe\xd2\xcd\xee\xd6\xe1\xdd\xe1\xfd\xe1\x3a\x27\x00\x57\x1c\x1d\x28\x13\x0a\xcd\xbf\xe5\x30\x0d\xdd\x77"
+"\x00\xfd\x72\x00\xdd\x23\xfd\x23\x03\x18\xea\x08\x02\xf0\x0b\x02\xc1\xc9\xcd\xd6\xc8\xfd\xe5\xdd\xe5\x18\xa7\xe5\xdd\xe5\xe1\xd5"
+"\x11\xc0\xef\xa7\xed\x52\xd1\xe1\xc9\xbe\x03\x33\xca\x42\xc4\xbe\x03\x30\xe1\xc0\xeb\x9f\x02\xf2\xdd\xd2\x4d\xc4\xd1\xf5\xc5\xcd"
+"\xbe\xc4\x30\xf5\xc1\xc3\x50\xc4\x47\xe5\x2a\xb0\xe0\x3e\xc3\xbe\x78\xe1\xc8\xc3\x44\xe1\xff\xcb\x6b\xc2\x00\x00\x22\x77\x00\xe5"
+"\xc5\x21\x1e\xe6\xe5\x7b\xe6\x07\x17\x4f\x06\x00\x21\x42\xe6\x09\x7e\x23\x66\x6f\xe9\xc1\xe1\xc9\x0a\x0d\x56\x65\x72\x69\x66\x79"
+"\x20\x28\x28\x59\x29\x2f\x4e\x29\x3f\x3a\x00\x0a\x52\x65\x77\x69\x6e\x64\x20\x3c\x3d\x3d\x0a\x0d\x00\x52\xe6\x72\xe6\x34\xe7\x85"
+"\xe6\x82\xdc\x6e\xe6\x82\xdc\x82\xdc\xcb\x7b\x28\x11\x0e\x0b\xcd\x05\x00\xb7\x28\x0e\xcb\xbb\x18\x0a\x0e\x09\xcd\x05\x00\x0e\x01"
+"\xcd\x05\x00\x57\xc9\x0e\x05\x18\x02\x0e\x02\xd5\x5a\xcd\x05\x00\xd1\xcb\xbb\xc9\x16\x0a\x18\xf1\x16\x0d\x18\xed\xd5\xcb\x5b\x28"
+"\x22\xd5\x0e\x0f\xcd\x05\x00\x16\x20\xcd\x72\xe6\x01\x0b\x00\x2a\x77\x00\x23\x23\x7e\x32\x75\x00\x11\x80\x00\xed\xb0\xd1\x21\x6e"
+"\x00\x36\x0b\x21\x80\x00\x3a\x6e\x00\x4f\x06\x00\x09\x72\x3c\x32\x6e\x00\xcb\x73\x20\x08\x3a\x6e\x00\xfe\x80\xc2\x7d\xe7\x3a\x75"
+"\x00\xfe\xd5\x20\x1a\x22\x00\xf2\x13\x47\x56\xcd\x72\xe6\x23\x10\xf9\x21\x00\x00\x06\x00\x0e\x01\xa7\xed\x42\x20\xf7\x21\x80\x00"
+"\x22\x1b\x00\x0e\x15\xcd\x05\x00\xaf\x32\x6e\x67\x00\xf1\x0e\xcb\x73\x28\x74\xaf\x32\x5a\x00\x11\x21\xe6\xcd\x62\xe6\xcd\x72\xe6"
+"\xcd\x7d\xe6\xcd\x81\xe6\xfe\x4e\x28\x66\x11\x34\x13\x00\x01\x10\x00\xf0\x1f\x3a\x6b\x00\x47\xaf\x32\x6c\x00\xc5\xcd\x83\xe7\xc1"
+"\x10\xf9\x18\x49\xd5\xcb\x73\x20\x44\xcb\x5b\x28\x1b\xcd\x7d\xe6\x3e\x01\x32\x6c\x00\xcd\x83\xe7\xcd\x9d\xe7\xd1\x21\x8b\x00\x56"
+"\xd5\xaa\x00\x32\x0c\x18\x1c\x8a\x00\x00\xac\x00\x30\xd1\x56\xd5\xae\x00\x70\xfe\x80\x20\x10\xcd\x83\xe7\x7d\x00\x01\x1e\x01\xa3"
+"\xfe\x03\x28\x1d\xd1\xcb\xbb\xcb\x9b\xc9\x9b\x00\xf3\x09\x14\xcd\x05\x00\xd0\xcd\x67\xe6\xfe\x0d\x28\xed\xfe\x03\x20\xf5\xc3\x82"
+"\xdc\x21\x80\x00\x06\x0b\xcd\x00\xff\x12\x2a\x77\x00\x0e\x0c\x09\x06\x0b\x11\x8a\x00\x1a\xbe\x1b\x20\x04\x2b\x10\xf8\xc9\xd6\x04"
+"\xbe\x20\xd8\x3e\xff\x32\x5e\x03\x18\xf0\xff\x01\x00\x09\xd1\xed\x53\x3d\x00\xed\x43\x3b\x00\x51\x14\x1c\x0e\x12\xbb\x03\x00\xc9"
+"\x02\x4f\xd6\xc8\xf1\xc9\x36\x00\x09\x0f\x1c\x00\xff\xff\xff\xff\xff\xff\xff\xd8\xf1\x26\xc3\x64\xf6\xc3\xae\xf6\xc3\x56\xf7\xc3"
+"\x7f\xf7\xc3\x83\xf7\xc3\x9e\xf7\xc3\xae\xf7\xc3\xa8\xf7\xc3\xc4\xf7\xc3\xde\xf5\xc3\x0b\xf8\xc3\xfc\xf7\xc3\xdf\xf7\xc3\x34\xf4"
+"\xc3\x6f\xf4\xc3\xa4\xf7\xc3\x33\xf7\xc3\x37\x1b\x00\xf2\x44\xd2\xf7\xc3\xd9\xf7\xc3\xe5\xf7\xc3\xf4\xf7\x64\xf6\x09\xf0\x0c\xf0"
+"\x15\xf0\x12\xf0\x0f\xf0\x18\xf0\x39\xf0\x3c\xf0\xe2\xf3\x65\xf3\x06\xf0\xf3\xf3\xf8\xf3\x2d\xf4\x45\xf4\x6a\xf4\x3c\xf7\x3b\xf7"
+"\xde\xf5\x27\xf0\x2a\xf0\x1e\xf0\x21\xf0\xa8\xf4\xe3\xfa\x24\xf0\x3f\xf0\x42\xf0\x3e\xf7\x3d\xf7\xb9\xf5\xde\xf5\xd8\xf4\x21\x89"
+"\xf0\xe5\x0a\x09\xf0\x31\x3e\x3e\xcd\x05\xf3\xcd\x5c\xf3\x38\x23\xcd\xb9\xf5\xd8\x21\xea\xf5\xe5\xcd\xea\xf1\xca\xe6\xf5\xc5\xcd"
+"\x8e\xf2\xc1\x28\x07\xcd\x26\xf5\xd8\x2a\x71\x00\xe9\x08\x30\x2a\xcd\xfe\xf2\xda\xae\xf6\x06\x04\x21\xe9\xef\x11\xd5\xfb\xcd\xe2"
+"\xf3\x3e\x3a\xcd\x05\xf3\x58\x0e\xf0\x2f\x23\xe5\xcd\xe2\xf3\xe1\xd1\x13\x13\x13\xcd\xfe\xf2\x10\xe5\xc9\xcd\xea\xf1\x28\x2c\x08"
+"\xda\xe6\xf5\xc5\x01\x09\x04\x21\xd5\xfb\xcd\xb8\xf2\x58\xc1\x20\x50\x3e\x04\x93\x87\x32\x33\x00\x22\x40\x00\x79\xfe\x3a\x20\x05"
+"\xcd\xc4\xf1\xfe\x3d\xc2\xe2\xf5\x2e\x00\xf0\x0b\x5b\xc5\xcd\xb2\xf2\xc1\x28\x17\xcd\xab\xf0\xd8\x00\xe5\xd5\x7c\x84\x85\x87\x16"
+"\x00\x5f\x21\xc9\xef\x19\xe0\x0d\xf2\xf5\xe1\x3a\x04\x00\x08\x30\x37\x3a\x33\x00\x47\x4d\xbc\x28\x0a\x95\x3c\xfe\x06\x28\x04\x3d"
+"\xb8\x20\x25\xd5\x58\x21\x04\x00\x06\x09\x3c\xcb\x1e\x3d\x20\x07\xcb\x39\xcb\x1e\xcb\x39\x05\x10\xf2\x43\xcd\xce\xf2\xd1\x30\x0b"
+"\x08\x32\x04\x00\x3e\x04\x37\xc9\xc3\xe6\xf5\x2a\x40\x00\x73\x23\x72\xc3\xbd\xf0\x08\x38\x34\x06\x03\x3e\x17\x32\x2f\x00\xc5\xcd"
+"\xea\xf1\xc1\x20\xe3\xd8\x5f\x3a\x2f\x00\xbb\x3e\x03\xd8\x4d\x6c\x63\x08\x38\x10\x3e\x3b\x10\xe3\xc3\xe2\xf5\x22\x1e\x00\x79\x32"
+"\x1d\x00\xb7\xc9\x1e\x00\x08\x10\xe5\x18\xf0\x11\x01\x01\xcd\xa8\xf4\xcd\xe2\xf3\xc3\xfe\xf2\x21\x81\x00\x23\x7e\xfe\x20\x28\xfa"
+"\xcd\xd7\xf1\x4f\xc0\xfe\x01\xd8\xbf\xc9\x7e\xb7\xc8\xe5\xc5\x21\xab\xfc\x01\x05\x00\xed\xb1\xc1\xe1\x36\x20\x23\xc9\x11\x52\x01"
+"\xaf\x06\x51\x12\x1b\x10\xfc\xe5\xcd\xc4\xf1\x38\x0d\x28\x0b\x12\x04\x13\xcd\xd7\xf1\x20\xf8\xcd\xd0\xf1\x78\x32\x00\x01\x79\xe1"
+"\x08\x3a\x01\x01\xfe\x30\x38\x16\xfe\x3a\x30\x12\xe5\xc5\x11\x00\x01\xcd\x15\xf8\xc1\xe1\x38\x02\xbf\xc9\xbf\xc3\xe2\xf5\xfe\x40"
+"\x38\xf8\x37\xc9\xe5\xc5\xcd\x4d\xf2\xf5\xcb\x39\x18\x06\x0a\x00\xf0\x92\xcd\x69\xf2\xf1\xc1\xe1\xf5\xb7\xed\x52\xf1\xc9\x11\x00"
+"\x04\xaf\xed\x52\x3c\x30\xfb\x21\xc1\xef\xd6\x08\x23\x30\xfb\xc6\x08\x2b\x28\xfb\x06\x09\xcb\x16\x3d\xc8\x10\xfa\xc9\xe5\xd5\xeb"
+"\x1a\xfe\x20\x28\x04\xfe\x40\x38\x02\xe6\xdf\xbe\x13\x23\x20\x0c\x10\xee\xd1\xd1\x6b\x62\x2b\x7e\x2b\x6e\x67\xc9\xd1\xe1\xc9\x21"
+"\x00\xfc\xe5\x3e\xc3\xed\xa1\x20\x12\x23\x23\xc5\x01\x0b\x01\xcd\xb8\xf2\xc1\x28\x0c\xaf\x2b\x2b\xbe\x20\xe8\xe1\x25\x20\xe3\x24"
+"\xc9\xc1\xc9\x01\x06\x02\x21\x26\xfc\x11\x01\x01\xc5\x41\x05\x05\xcd\x6c\xf2\xc1\xc8\x79\x23\x3d\x20\xfc\x10\xf0\xf6\x01\xc9\xf5"
+"\x16\x00\x58\x78\xb7\x3a\x04\x00\x28\x04\xcb\x3f\x10\xfc\xcb\x23\xe6\x03\x83\xb4\x01\xf1\x42\xf1\x19\x19\xe5\x5e\x23\x56\x21\xff"
+"\xff\xeb\xcd\xbc\xfc\xd1\x3f\xc9\xe5\xd5\xc5\xed\xb0\x18\x0e\x3e\x0d\xcd\x05\xf3\x3e\x0a\xe5\xd5\xc5\x4f\xcd\x83\xf7\xc1\xd1\xe1"
+"\xc9\x3e\x20\x18\xf1\xed\x73\x0b\x00\x31\xc0\x01\x37\x3f\xe5\xd5\xf5\xed\x43\x0d\x00\x32\x0f\x00\x21\x45\xf3\xe5\x3e\x21\xb9\xda"
+"\xde\xf5\x06\x00\x21\x45\xf0\x09\x1f\x0d\xf0\x2a\x4b\x42\x3a\x0f\x00\xe5\x2e\x03\xc9\x30\x06\xcd\xea\xf5\xf1\x37\xf5\xf1\xd1\xe1"
+"\x3a\x0f\x00\xed\x4b\x0d\x00\xed\x7b\x0b\x00\xc9\x11\x80\x00\x3e\x50\x12\x3a\x0f\x00\x6b\x62\x23\x4d\x44\x03\x36\x00\x32\x35\x00"
+"\xe5\xd5\xc5\xcd\x7f\x6a\x00\xf0\x37\xd8\xe5\x21\x17\x00\x34\x35\xe1\x20\x2b\xfe\x03\x20\x03\xaf\x37\xc9\xfe\x1f\x28\x1b\xfe\x02"
+"\x20\x07\xcd\xc6\xf3\x20\xfb\x18\xd7\xfe\x0d\x28\x20\xfe\x0b\x28\xcf\xfe\x0a\x28\xcb\xfe\x08\x20\x05\xcd\xc6\xf3\x18\xc2\xfe\x10"
+"\x28\x03\x34\x02\x03\xcd\x05\xf3\xd8\x1a\xbe\x20\xb3\x3a\x35\x9c\x00\xf0\x03\xc3\xfe\xf2\x34\x35\xc8\x0b\x0a\xfe\x09\x28\x0c\xfe"
+"\x20\x38\xf4\x3e\x08\x40\x03\x21\x10\xf3\x08\x00\xc0\x35\xc9\x1a\xb7\x20\x06\x3a\x17\x00\xb7\xc8\xaf\x37\x00\xe0\x13\x18\xef\x21"
+"\x03\x01\x18\x38\xcd\x93\xf5\x3c\xd8\xe5\xd7\x0c\xf1\x03\xcd\x34\xf4\xe1\x22\x1b\x00\xd8\xe5\x11\x11\x00\x19\x11\x6d\x00\x01\x08"
+"\x71\x0d\xf2\x1d\x5c\x00\x06\x0b\xcd\x6c\xf2\x3e\x0d\x37\xc0\x3a\x73\x00\xb7\xc8\x32\xc0\xef\xc9\x21\x6d\x00\x22\x0d\x00\xc9\xcd"
+"\xd8\xf4\xd8\x22\x1b\x00\x21\x6c\x00\x34\xf5\xcd\x10\xf3\xf1\xc9\x4d\x00\x20\x21\x5c\x63\x0d\xe0\x3e\x00\x32\x73\x00\x01\x70\x17"
+"\xaf\x32\x6b\x00\x3e\x02\x1d\x0d\x11\x72\x60\x00\xf0\x22\xc9\x3e\xff\x32\x6b\x00\x01\xa0\x00\xed\x5b\x1b\x00\x3a\xc0\xef\xb7\x28"
+"\x04\x3e\x09\x37\xc9\x2a\x36\x00\xd5\x11\x7f\x00\xed\x52\xd1\xcd\xbc\xfc\x3e\x0a\x38\xed\xeb\xcd\x3b\xf2\x30\xe5\xcd\xd6\xfe\x62"
+"\x00\xf1\x2e\x6b\x00\x7e\x32\x0f\x00\x34\xc3\xe3\xfa\xd5\x01\x1d\x00\x16\x03\x21\x01\x01\xe5\x2b\x36\x3a\x23\x0a\xc5\xb7\x28\x07"
+"\x47\xaf\xc6\x01\x27\x10\xfb\x77\x3e\x33\xed\x67\x23\x77\x23\x36\x00\xc1\x03\x15\x20\xe2\xe1\xd1\x0e\x08\xc3\xf7\xf2\x2a\x36\x00"
+"\x57\x00\x00\x6e\x00\x01\x5a\x00\x10\xd8\x59\x00\xf0\x24\x3e\x09\x30\x1d\xf5\xf1\xcd\x59\xff\xcd\xe3\xfa\xf5\xe5\x21\x6c\x00\x3a"
+"\x6b\x00\xbe\xe1\x38\xed\x28\x09\xfe\xff\x28\x05\xf1\x3e\x0b\x37\xc9\xf1\x3e\x0c\xd8\x3a\x6b\x00\x3c\x3e\x00\x20\x01\x3c\x32\x0f"
+"\x00\x3b\x04\xf1\x1b\xc8\x21\xe6\xf5\xe5\x3a\x00\x01\xfe\x09\xd0\x11\x5c\x00\x3e\x08\xcd\x88\xf5\x08\x30\x0e\x08\x21\x43\x4f\x22"
+"\x64\x00\x3e\x4d\x32\x66\x00\x18\x16\x79\xfe\x2e\xe1\xc2\xe2\xac\x04\xf0\x11\xc8\x3e\x03\xb8\xd8\x11\x64\x00\xcd\x88\xf5\xe1\x08"
+"\xd2\xe2\xf5\xcd\xf8\xf3\x30\x09\xb7\x37\xc8\xcd\xa3\xf5\xd8\x18\xf2\x2a\x6d\x27\x01\x50\xcd\x34\xf4\x30\x05\x11\x00\x31\xaf\xb7"
+"\x28\xc4\x03\xf0\x00\x01\x01\x47\x7e\x12\x23\x13\x10\xfa\xc9\x11\x48\xfc\xcd\xe2\x01\x05\xf0\x6c\x2a\x1b\x00\xd0\x3e\xff\xc9\xcd"
+"\xea\xf5\xcd\x99\xf5\xd8\x3a\x0f\x00\xfe\x09\x37\x3f\xc0\x0e\x01\xcd\x31\xf2\xb7\xc9\x13\x1a\xb7\x28\x1e\x6b\x62\xe5\x23\x13\x47"
+"\x0e\x00\xeb\x3e\x1f\xbe\x30\x05\xed\xa0\x03\x03\x2b\x23\x10\xf5\xe1\x71\xeb\x79\xb7\x36\x00\xc0\x37\xc9\x3e\x07\x37\xc9\x3e\x02"
+"\x37\xc9\x3e\x01\x37\xc9\xd0\xfe\xff\x37\xc8\x32\x0f\x00\xb7\x37\xc8\xf5\xaf\x32\x15\x00\xcd\xfe\xf2\xf1\x11\x5b\xfc\xd6\x05\x30"
+"\x0c\xf5\xcd\xe2\xf3\xf1\xc6\x35\xcd\x05\xf3\x18\x4d\xd6\x02\xd8\xf5\x11\x56\x82\x00\x01\x4d\x05\x00\xe0\x01\xf0\x28\x20\x04\x06"
+"\x08\x18\x03\x3d\x20\x0f\x21\xcc\xfb\x11\x09\x00\xcb\x38\x04\x19\x10\xfd\xeb\x18\x1f\x11\x62\xfc\x3d\x28\x19\x11\x73\xfc\x3d\x28"
+"\x13\x11\x81\xfc\x3d\x28\x0d\x11\x92\xfc\x3d\x28\x07\x11\x9d\xfc\x3d\x28\x01\x1b\xc5\x00\xf0\x3c\xfe\xf2\xaf\x37\xc9\xf3\x31\x00"
+"\x02\x0e\x00\x2a\x36\x00\x5d\x54\x13\x06\x01\xed\xb0\x3e\x02\xed\x47\x3c\xd3\x8a\x3e\xcf\xd3\x8a\xaf\xd3\x8a\xd3\x88\x21\x00\xfc"
+"\x06\x40\x7e\x2f\x77\x56\xba\x2f\x77\x0e\x01\x28\x06\x0d\x2b\x22\x36\x00\x23\xcd\x31\xf2\x10\xea\x21\x14\xf3\x22\x06\x00\xcd\xe0"
+"\xf6\x11\x30\x93\x00\x00\x4a\x00\xf0\x0b\x3e\xc3\x32\x00\x00\x32\x05\x00\x21\xae\xf6\x22\x01\x00\x3a\x04\x00\xe6\xfc\xf6\x01\xcd"
+"\x12\xf7\x11\xf7\x02\x06\xf0\x2b\x21\x23\x00\x22\x82\x00\xcd\xea\xf1\xcd\x8e\xf2\xc2\x89\xf0\xe9\x21\xc9\xef\x11\xca\xef\x01\x1f"
+"\x00\x36\xff\xed\xb0\x11\x00\x02\x21\xb0\xfc\x0e\x0c\xed\xb0\x21\x24\xfc\x22\xeb\xef\x22\xed\xef\x22\xef\xef\x21\xb4\xf7\x22\xcd"
+"\xef\xaf\x64\x15\xf1\x3f\xc0\xef\x3e\x01\x32\x04\x00\x21\x26\xfc\x22\xe9\xef\x21\xf1\xf8\x22\xcb\xef\x22\xe3\xef\xed\x5e\x11\xff"
+"\xff\x1b\x7b\xb2\x20\xfb\x32\x15\x00\x3d\xe9\x2e\x07\x18\x07\x2e\x05\x59\x50\x2c\x2c\x2c\x7d\xcd\x58\xf7\xd8\xfe\x03\xc8\x4d\x44"
+"\xfe\x06\xd0\x22\x0d\x00\xfe\x04\xc8\xed\x53\xbc\x01\xc9\x3e\x00\x06\x00\xc5\xd5\xf5\x05\xf0\x0a\x04\xc1\x3e\x08\xc9\xe5\x21\x6f"
+"\xf7\xe3\x32\x2f\x00\xe9\xc1\x4f\x38\xf0\x3a\x2f\x00\xfe\x02\xd0\x79\x8b\x01\x00\x06\x16\xf0\x3a\xd5\x79\xfe\x10\x20\x08\x3a\x15"
+"\x00\xee\x01\x32\x15\x00\x3e\x02\xc5\xcd\x58\xf7\xe1\x4d\xd8\x3a\x15\x00\xb7\xc8\x3e\x02\x06\x06\x18\xb6\x3e\x00\x18\xf8\x3e\x01"
+"\x06\x02\x18\xac\x3e\x02\x06\x04\x18\xa6\xfe\x01\x28\xf0\xfe\xff\x20\xe4\xcd\xaa\xf7\xd8\x3e\xff\x18\xdc\xcd\x8f\xfe\xed\x4b\x13"
+"\x00\xab\x04\x50\xc3\xe9\xfa\x3a\x04\x15\x04\xf1\x08\x4f\x79\x32\x04\x00\xb7\xc9\xed\x43\x1b\x00\xb7\xc9\x69\x60\xcd\x3b\xf2\x3e"
+"\x01\x38\x01\x3d\x75\x00\x31\x69\x60\x4f\x43\x02\x20\x3a\x1d\x2a\x00\x50\x2a\x1e\x00\x4c\x45\x3c\x00\xf0\x5d\x32\x1d\x00\x68\x61"
+"\x22\x1e\x00\xb7\xc9\x1a\xb7\x37\xc8\x3e\x02\xcd\x36\xf8\xd8\x01\x02\x00\x1a\x13\xd6\x30\xd8\xfe\x0a\x3f\xd8\x80\x0d\xc8\x87\x47"
+"\x87\x87\x80\x47\x18\xec\x6b\x62\x13\xbe\xc8\x06\x00\x4e\x38\x13\x77\x91\x09\x5d\x54\x13\xc5\xed\xb8\xc1\xeb\x36\x30\xeb\x03\x3d"
+"\x20\xf0\xc9\xf5\x23\x23\x1a\xfe\x30\x20\x0a\x0d\xcd\xf7\xf2\x1b\x79\x12\xf1\x18\xd1\xf1\x37\xc9\xd6\x14\x38\x15\x28\x06\x06\xf8"
+"\x7b\xa0\xb1\xc9\x7b\x06\x8f\xe4\x16\x00\x04\x00\xf1\xe2\x18\xf0\xdb\x88\x06\xc7\xcd\x79\xf8\xd3\x88\xf1\x18\x0e\x3a\x27\x00\x5f"
+"\x7e\xb7\x28\x09\xcd\x68\xf8\x32\x27\x00\xaf\x77\xc9\x79\xd6\x05\x28\x39\x3d\x20\x05\x7b\xee\x80\x18\xed\x3d\x20\x1d\xf3\xcd\xc4"
+"\xf8\xcd\x0d\xff\x01\x30\x00\xcd\x31\xff\xed\xa1\xea\xb8\xf8\x3e\x03\xd3\x80\xdb\x88\xee\x80\xd3\x88\xc9\xd6\x0a\x20\x06\x2b\x7e"
+"\xee\x01\x77\xc9\xd6\x03\x28\x03\x3d\x20\x02\x79\x77\x3d\x28\x0a\xcd\x7d\xf9\x3a\x16\x00\xb7\xc8\x18\xc3\x7b\xcd\xd6\xfa\x18\xa7"
+"\x21\x17\x00\x3c\x20\x23\xf3\x21\x00\x19\x22\x3b\x00\x26\x29\x22\x3d\x00\x26\x00\x22\x23\x00\x22\x25\x00\x22\x13\x00\x22\x16\x00"
+"\xdb\x88\xe6\x38\xd3\x88\xc3\xe3\xfa\x3d\x20\x04\x3a\x25\x00\xc9\x3d\x20\x21\x3a\x25\x00\xb7\x28\xfa\xf5\xaf\x32\x25\x00\x32\x13"
+"\x00\x32\x14\x00\x7e\xb7\x28\x0a\xf1\xfe\x39\x30\xe6\xd6\x31\x38\xe2\xf5\xf1\xc9\x3d\xca\x8d\xf8\x0e\x00\x3d\xca\x33\xfa\x3d\xca"
+"\xf3\xf9\x3d\x20\x08\xcd\x7d\xf9\xed\x5b\x2b\x00\xc9\x3d\x28\x18\x3d\x28\x19\x3d\xc0\x21\x00\xec\xeb\xed\x52\xd8\x11\x28\x00\x1f"
+"\x07\xf0\x54\x19\x2c\x67\xeb\xed\x53\x2b\x00\x21\xf3\xf9\xe5\xcd\x33\xfa\x79\xd6\x08\xd8\x28\x4e\x3d\x28\x30\x3d\x28\x3b\x3d\x28"
+"\x53\x3d\x28\x0d\x3d\x28\x1e\xfe\x13\xd8\x71\x3a\x27\x00\x12\x18\x1a\x3a\x3b\x00\x3c\x32\x2c\x00\x47\x3a\x3c\x00\x90\x47\xc5\xcd"
+"\x4f\xfa\xc1\x10\xf9\x3a\x3d\x00\x32\x2b\x00\x21\x2b\x00\x11\x3e\x00\x34\x1a\xbe\xc0\x1b\x1a\x3c\x77\x21\x2c\x00\x34\x3a\x3c\x00"
+"\x3d\xbe\xd0\x77\x18\x77\x1b\x00\x90\x3d\x00\x35\x1a\xbe\xc0\x13\x1a\x3d\x1b\x00\xf4\x3c\x35\x3a\x3b\x00\xbe\xd8\x3c\x77\x18\x5d"
+"\x3a\x2b\x00\x4f\x3a\x2c\x00\x47\x21\xd8\xeb\x11\x28\x00\x19\x10\xfd\x41\x2b\x23\x10\xfd\x22\x2d\x00\x3a\xc8\xef\xcb\x6f\x20\x06"
+"\x7e\x32\x3f\x00\x36\xff\x11\x00\x04\xe5\xed\x52\x7e\x32\x34\x00\x3a\x27\x00\xee\x80\x47\xae\xe6\xf0\x78\xcc\xd6\xfa\x77\xe1\xc9"
+"\x2a\x2a\x00\x50\x04\x3a\x3f\x00\x77\x28\x00\xd2\xb7\xed\x52\x3a\x34\x00\x77\xeb\xe1\xc9\x3e\xaf\xf5\x57\x00\x00\xb5\x00\x10\x4f"
+"\x8e\x00\xf0\x39\x47\xf1\xc5\xb7\x28\x01\x41\x19\x10\xfd\xc1\xf5\x78\x91\x28\x37\x47\xf1\xe5\xb7\x28\x03\x19\x18\x02\xed\x52\xd1"
+"\xf5\xe5\xc5\x3a\x3d\x00\x3c\x47\x2b\x1b\x23\x13\x10\xfc\x4f\x3a\x3e\x00\x91\x4f\xcd\xf7\xf2\xc5\x01\x00\x04\xeb\xed\x42\xeb\xed"
+"\x42\xc1\xed\xb0\xc1\xe1\x11\x28\x00\x10\xca\xf1\x29\x00\x81\x4f\x47\x23\x10\xfd\x5d\x54\x2b\x29\x00\xf0\x2e\x0d\x36\x20\xc5\xf5"
+"\xc4\xf7\xf2\x11\x00\x04\xed\x52\x3a\x27\x00\xcb\xbf\x77\xf1\xc1\xc8\x5d\x54\x13\xed\xb0\xc9\x0e\x00\xcb\x27\xcb\x19\x07\x07\x07"
+"\xe6\x7f\xb1\xc9\xf3\xf5\xcd\xf7\xfa\xf1\xf5\xcd\x15\xfb\x3e\x83\xd3\x93\xaf\xd3\x90\xf1\xfb\xc9\x37\x02\x20\xd3\x82\x80\x04\xf0"
+"\x1a\x80\x3e\xc7\xd3\x83\x3e\x40\xd3\x83\x3e\x27\xd3\x82\x3e\x96\xd3\x82\x3e\x03\xc9\x3e\xcf\xd3\x92\xaf\xd3\x92\x3e\x08\xd3\x93"
+"\x3e\xcf\xd3\x93\x3e\xff\xd3\x93\x3e\x17\x3b\x00\xf1\x07\x93\x3d\xd3\x90\xc9\x18\x1e\x1f\x5d\x00\x08\x09\x0a\x0b\x02\x0d\x03\x20"
+"\x19\x13\x1a\x5e\x0d\x00\xf1\xb0\x1b\x0d\x03\x20\x00\x14\x00\x7e\x1c\x1d\x7d\xab\x8d\x82\x85\x86\x84\xcf\xc3\x96\x90\x9b\x9c\xaf"
+"\xc4\x95\x92\xae\x87\xac\x8c\x91\x83\xad\x80\x81\xc2\x00\x00\x00\x93\x00\x00\xec\xed\xee\xef\xf0\xca\xcc\xd0\xd1\xda\xde\xfc\xdf"
+"\xfd\xdb\xb3\xa0\xa1\x9e\x9f\xc0\xc7\xb4\xb0\xb1\x8f\xfe\xdc\xff\xdd\xbe\xb2\xa3\xf9\xaa\xa5\xa9\x88\xc8\xc6\xbc\xb6\xbb\xba\xfb"
+"\xfa\xbd\xb8\xa8\xc1\xa6\x89\xb5\xf8\xa4\xa2\xa7\xc5\x98\x00\xd7\xb9\xd2\xd3\xf2\xe0\xe2\xf4\xe8\xf5\xf6\x8a\xd4\x8b\xd8\xd9\xcd"
+"\xce\xd5\xd6\xea\xe7\xf3\xe6\xc9\xe1\xe9\xe3\xe4\xcb\x94\x9d\x97\x9a\x99\xe9\xef\x43\x4f\x4e\x53\x54\x20\x00\xeb\xef\x52\x45\x41"
+"\x44\x45\x52\x00\xed\xef\x50\x55\x4e\x43\x48\x20\x00\xef\xef\x4c\x49\x53\x54\x20\x20\x00\x0a\x0d\x4f\x53\x0a\x0d\x00\xff\xff\xc3"
+"\xba\xf0\x41\x53\x47\x4e\x20\x00\x18\x62\x81\xf1\x54\x49\x4d\x45\x0c\x00\x70\x22\xf5\x43\x4c\x4f\x41\x44\x18\x00\xf2\x47\x01\x00"
+"\x43\x52\x54\x00\x02\x00\x42\x41\x54\x00\x14\x01\x0c\x72\x6f\x62\x6f\x74\x72\x6f\x6e\x20\x20\x5a\x20\x39\x30\x30\x31\x0a\x0d\x14"
+"\x02\x00\x0a\x73\x74\x61\x72\x74\x20\x74\x61\x70\x65\x0a\x0d\x00\x07\x42\x4f\x53\x2d\x65\x72\x72\x6f\x72\x07\x00\x6d\x65\x6d\x6f"
+"\x72\x79\x20\x70\x72\x6f\x74\x65\x63\x74\x65\x64\x00\x65\x6e\x64\x20\x6f\x66\x20\x18\x00\xf2\x07\x00\x72\x65\x63\x6f\x72\x64\x20"
+"\x6e\x6f\x74\x20\x66\x6f\x75\x6e\x64\x00\x62\x61\x64\x20\x15\x00\x57\x00\x66\x69\x6c\x65\x1a\x00\xf0\x1d\x20\x2c\x2e\x3a\x43\xff"
+"\x00\x00\xfb\xfc\xc2\xfc\xe4\xfc\xbd\xff\xe5\xb7\xed\x52\xe1\xc9\xfb\xe5\xc5\xf5\x21\x20\x00\x06\x02\x3e\x3c\x2b\x34\xbe\x20\x0d"
+"\x36\x00\x10\xf7\x3e\x18\x0b\x00\xf2\x06\x02\x36\x00\xf1\xc1\xe1\xed\x4d\xf5\x3e\x0a\x32\x23\x00\x3e\x7f\x32\x24\x00\x3e\xa5\xe5"
+"\x01\xf0\x26\xf1\xfb\xed\x4d\xfb\xf5\xe5\x21\x23\x00\x35\x28\x13\x3e\x07\xa6\x20\x22\x23\xcd\x30\xfd\x28\x1c\xbe\x28\x19\x2b\x36"
+"\x28\x18\x07\x36\x06\xcd\x33\xfd\x28\x0d\x23\x77\x3a\x25\x00\xfe\x03\x28\x04\x7e\x32\x25\x00\xe1\x35\x00\x00\x59\x0b\xf0\x29\xd5"
+"\xc5\x21\x68\xfe\xe5\xcd\x8f\xfe\x7a\xb7\xc8\x7b\xb7\xc8\x3a\x26\x00\xb7\x28\x06\xcb\xc3\xcb\xfa\xcb\xbd\xe5\xd5\x5a\x0e\x08\xcd"
+"\x81\xfe\x67\xcd\x89\xfe\x6f\xd1\xc1\xc0\xc5\x0e\x01\xaf\xcd\x83\xfe\xf5\x84\x67\xf1\x85\xbf\x14\x00\xf2\xb0\xc1\xc0\xdb\x88\x5f"
+"\x7d\xfe\x48\x28\x6e\xfe\x41\x28\x06\xfe\x46\x20\x0d\x3e\xa9\xd6\x2c\x6f\x7c\xfe\x38\xc0\x7d\xc3\x38\xfe\xfe\x40\x28\x6b\xd0\xd6"
+"\x39\xd8\x84\xcb\x78\x28\x2d\x01\x90\x00\x26\x05\xed\x61\x0c\xed\x60\x0d\xed\x41\xcb\x7c\xc8\x3c\xfe\x0c\x38\x64\x28\x60\xfe\x0e"
+"\x38\x5e\x28\x5a\xfe\x0f\x28\x58\xd6\x2b\x38\x4e\xfe\x0d\xd0\x21\x33\xfb\x18\x55\x3d\xd6\x0a\xd8\xd6\x06\xc8\x30\x0d\xfe\xfa\x20"
+"\x02\xd6\x1f\xcb\x73\xc8\xd6\x80\x18\x38\xfe\x1b\x38\x34\xfe\x1e\xc0\x18\x2f\x7c\xfe\x0c\x38\x26\x28\x26\xfe\x0e\x38\x20\x28\x20"
+"\xd6\x2b\x38\x18\x21\x40\xfb\x18\x20\x78\xa9\xba\xc0\x3e\x03\xa4\x7c\x20\xc2\xb7\x20\xa2\x3e\x5f\x18\x08\xc6\x20\xc6\x2b\xc6\x10"
+"\xc6\x20\xcb\x73\x28\x1d\x21\x53\xfb\x06\x00\x4f\x09\x7e\xfe\x5e\x28\xf0\xfe\x5d\x28\xec\xb7\xe1\x20\x0a\x45\x01\xe0\x0a\x18\x43"
+"\xe1\xfe\x7e\x20\x0d\x7b\xee\x40\xd3\x88\xaf\x57\x01\x90\x28\x18\x31\xfe\x7d\x20\x0a\x3a\x26\xc6\x06\xf3\x05\x26\x00\x18\xea\xc1"
+"\xd1\xe1\xfe\x5d\x28\x06\xfe\x60\x20\x03\xd6\x21\x3c\xb7\xc9\x7b\x03\x22\x3e\x25\x80\x01\x00\x35\x00\xf0\x17\x32\x23\x00\xaf\x18"
+"\xd7\x3e\xf7\x06\x08\x81\xcb\x3b\xd8\x10\xfa\xc0\x81\xbf\xc9\xf3\xdb\x91\x2f\x57\x3e\x03\xd3\x93\x3e\xfb\xd3\x90\xdb\x91\x67\x3e"
+"\xfe\x07\x00\x10\x6f\x91\x03\x40\x3e\xff\xd3\x92\x8e\x03\xb1\xaf\xd3\x93\xd3\x91\xdb\x90\x2f\x5f\x3e\x80\x08\x00\x52\x32\x13\x00"
+"\x3e\x40\x0a\x00\xf2\x07\x14\x00\xcd\x15\xfb\xaf\xd3\x90\xc9\xf3\xaf\x32\x69\x00\xcd\x0a\xfb\xd3\x93\xcd\x0d\xff\x2b\x06\xf0\x4c"
+"\xe3\xfe\xcd\x29\xff\x3a\x6b\x00\xcd\x18\xff\x2a\x1b\x00\x06\x80\x7e\xcd\x18\xff\x3a\x69\x00\x86\x32\x69\x00\x23\x10\xf2\xcd\x18"
+"\xff\x7a\x18\x2b\x3e\x85\xd3\x80\x3e\x40\xd3\x80\xfb\x57\xc9\xc5\x4f\x06\x08\xcb\x09\xf5\xdc\x31\xff\xf1\xd4\x2d\xff\x10\xf4\xc1"
+"\x1e\x80\x18\x06\x1e\x20\x18\x02\x1e\x40\x7a\xcd\x38\xff\x7a\x32\x6a\x00\x3a\x6a\x00\xb7\x20\xfa\x53\xc9\xf5\x4d\x04\x00\x3b\x00"
+"\x90\x3a\x6a\x00\xd3\x80\xaf\x32\x6a\x00\x29\x02\x11\xf3\x7f\x00\xf0\x17\xd3\x8a\x3e\x05\xd3\x80\x3e\xb0\xd3\x80\x3e\x0f\xd3\x8a"
+"\x3e\x0a\xd3\x8a\x3e\xe7\xd3\x8a\xfb\x06\x16\xcd\xd1\xff\x38\xf9\xfe\x90\x38\xf5\x10\xf5\x06\x02\xae\x00\xf0\x0a\x4f\x32\x6a\x00"
+"\xcd\xe0\xff\xfe\x52\x30\xf1\x10\xef\xcd\xe8\xff\xd8\x32\x6b\x00\x06\x80\x2a\x1b\x00\x0c\x00\x15\x77\xaa\x00\x10\xf1\x0f\x00\xe2"
+"\x47\x3a\x69\x00\xb8\xc8\x37\xc9\xf5\xdb\x80\xf5\x3e\x07\x60\x00\x13\xf1\x78\x00\x00\x80\x00\x00\x9a\x00\x36\x28\xfa\x4f\x0b\x00"
+"\xf0\x0b\x81\xc9\x16\x08\xaf\x5f\xcd\xd1\xff\x3f\x30\x04\xfe\x90\xd8\x37\xcb\x1b\x15\x20\xf1\xcd\xd1\xff\x7b\xc9"
+;
+unsigned char dump_kc87_os_2[8192];
+static const unsigned char dump_kc87_font_2_lz4[] =
+"\x1f\xff\x01\x00\xec\x13\x00\x01\x00\xb1\x10\x10\x10\x10\x00\x00\x10\x00\x28\x28\x28\x12\x00\xf1\x14\x28\x28\x7c\x28\x7c\x28\x28"
+"\x00\x10\x3c\x50\x38\x14\x78\x10\x00\x60\x64\x08\x10\x20\x4c\x0c\x00\x10\x28\x28\x30\x54\x48\x34\x00\x10\x10\x20\x28\x00\xd0\x08"
+"\x10\x20\x20\x20\x10\x08\x00\x20\x10\x08\x08\x08\x14\x00\xb0\x10\x54\x38\x54\x10\x00\x00\x00\x10\x10\x7c\x52\x00\x00\x25\x00\x03"
+"\x2c\x00\x10\x7c\x0c\x00\x01\x04\x00\xf0\x06\x30\x30\x00\x00\x04\x08\x10\x20\x40\x00\x00\x38\x44\x4c\x54\x64\x44\x38\x00\x10\x30"
+"\x82\x00\x40\x38\x00\x38\x44\x19\x00\xf0\x07\x7c\x00\x7c\x08\x10\x08\x04\x44\x38\x00\x08\x18\x28\x48\x7c\x08\x08\x00\x7c\x40\x78"
+"\x04\x10\x00\x90\x18\x20\x40\x78\x44\x44\x38\x00\x7c\x27\x00\x60\x20\x20\x00\x38\x44\x44\x03\x00\x00\x08\x00\x80\x3c\x04\x08\x30"
+"\x00\x00\x30\x30\x03\x00\x00\x81\x00\x01\xa4\x00\x00\x66\x00\x00\xa0\x00\x40\x00\x00\x7c\x00\x81\x00\x30\x20\x10\x08\x3a\x00\x02"
+"\x68\x00\xa0\x10\x10\x00\x38\x44\x5c\x54\x5c\x40\x3c\x40\x00\x80\x7c\x44\x44\x44\x00\x78\x44\x44\x03\x00\xb0\x00\x38\x44\x40\x40"
+"\x40\x44\x38\x00\x78\x24\x01\x00\x93\x78\x00\x7c\x40\x40\x78\x40\x40\x7c\x08\x00\x11\x40\x20\x00\x71\x4c\x44\x3c\x00\x44\x44\x44"
+"\x38\x00\x10\x38\xbf\x00\xf1\x05\x10\x38\x00\x1c\x08\x08\x08\x08\x48\x30\x00\x44\x48\x50\x60\x50\x48\x44\x00\x40\x01\x00\x60\x7c"
+"\x00\x44\x6c\x54\x54\x60\x00\x70\x44\x44\x64\x54\x4c\x44\x44\x70\x00\x10\x44\xc8\x00\x00\x6d\x00\x20\x40\x40\x50\x00\x20\x44\x44"
+"\x58\x01\x00\x10\x00\x00\x38\x00\x91\x3c\x40\x40\x38\x04\x04\x78\x00\x7c\x58\x00\x10\x10\x68\x00\x01\x30\x00\x10\x44\x01\x00\x11"
+"\x28\x10\x00\xb0\x54\x54\x6c\x44\x00\x44\x44\x28\x10\x28\x44\x08\x00\x20\x44\x28\xc3\x01\x01\x18\x01\x50\x40\x7c\x00\x38\x20\x01"
+"\x00\x40\x38\x00\x00\x40\xf2\x00\x30\x00\x00\x38\x98\x00\x61\x08\x38\x00\x10\x28\x44\x83\x01\x01\x05\x00\x03\x11\x01\x01\x0c\x00"
+"\xf0\x00\x00\x34\x4c\x44\x44\x3a\x00\x40\x40\x58\x64\x44\x44\x78\x00\x9a\x01\x00\x00\x01\x22\x04\x04\x18\x00\x00\x10\x00\x61\x7c"
+"\x40\x38\x00\x08\x10\xea\x00\x20\x00\x00\x30\x00\x32\x3c\x04\x38\x30\x00\x40\x44\x00\x10\x00\xa9\x00\x13\x08\x08\x00\x91\x10\x20"
+"\x40\x40\x48\x50\x70\x48\x44\x16\x00\xe0\x10\x10\x08\x00\x00\x00\x68\x54\x54\x54\x54\x00\x00\x00\x60\x00\x00\x84\x00\x11\x38\xd0"
+"\x00\x01\x10\x00\x33\x78\x40\x40\x50\x00\x10\x04\x10\x00\x00\x10\x01\x91\x00\x00\x38\x40\x38\x04\x78\x00\x10\x70\x00\x00\x40\x00"
+"\x70\x44\x44\x44\x4c\x34\x00\x00\x0a\x01\x10\x28\x61\x02\x00\x4f\x00\x00\xac\x02\x01\x01\x01\x02\x18\x00\x40\x3c\x04\x38\x00\x3a"
+"\x02\x70\x20\x7c\x00\x08\x10\x10\x20\x78\x00\x00\x96\x00\x00\x18\x01\x00\x0d\x00\x03\x88\x02\x54\x32\x4c\x00\x00\x00\xf7\x03\x20"
+"\xc0\x20\x22\x00\x40\x20\xc0\x03\x04\x21\x01\x62\x04\x03\x81\x81\x42\x3c\x10\x01\xa0\x00\x00\x3c\x42\x81\x81\x10\x10\x20\xc0\x10"
+"\x00\x40\x08\x08\x04\x03\x08\x00\x00\x04\x00\x00\x2c\x00\x00\x08\x00\x00\x3c\x00\x12\x80\x01\x00\x32\xff\xff\x01\x01\x00\x00\x61"
+"\x01\xc0\x82\x44\x28\x10\xff\xef\xc7\x83\x01\x83\xc7\xef\x44\x00\x00\x54\x00\x20\xc3\x81\x32\x00\xf0\x05\x81\xc3\xff\xfe\xfc\xf8"
+"\xf0\xe0\xc0\x80\x80\xc0\xe0\xf0\xf8\xfc\xfe\xff\x01\x02\x8f\x02\x31\x40\x80\x80\xa8\x01\x20\x02\x01\x26\x00\x40\x03\x0c\x30\xc0"
+"\x04\x00\x04\x0c\x00\x31\xc0\x30\x0c\x7c\x00\x00\x08\x00\x00\x04\x00\x00\x18\x00\x00\x08\x00\x00\x24\x00\xf0\x0e\x10\x10\x20\x20"
+"\x40\x40\x80\x80\x01\x01\x02\x02\x04\x04\x08\x08\x81\x81\x42\x42\x24\x24\x18\x18\x80\x80\x40\x40\x20\xf5\x00\xf0\x01\x08\x04\x04"
+"\x02\x02\x01\x01\x18\x18\x24\x24\x42\x42\x81\x81\xff\x3d\x00\x32\x00\x00\x00\xb7\x00\x21\x80\x80\x0b\x01\x46\x00\x00\x00\x18\x01"
+"\x00\x10\xff\x24\x00\x81\x18\x18\x18\x1f\x1f\x18\x18\x18\x20\x00\x02\x1c\x00\x22\xf8\xf8\x08\x00\x22\xff\xff\x08\x00\x22\x1f\x1f"
+"\x4c\x00\x04\x28\x00\x04\x20\x00\x22\xf8\xf8\x60\x00\x61\x40\x40\x20\x18\x07\x01\x99\x00\x41\x18\xe0\xe0\x18\x87\x00\x31\x01\x07"
+"\x18\xaf\x00\xd0\x80\x81\x42\x24\x18\x18\x24\x42\x81\xf0\xf0\xf0\xf0\x47\x00\x40\x0f\x0f\x0f\x0f\x08\x00\x00\x04\x00\x04\x0c\x00"
+"\x00\x1c\x00\x04\x04\x00\x00\x14\x00\x00\x04\x00\x00\xb8\x01\x00\x24\x00\x00\x04\x00\x00\x0c\x00\x00\x20\x00\x00\x18\x00\x00\x04"
+"\x00\x04\x0c\x00\x04\x18\x00\x00\x08\x00\x00\x04\x00\x00\x18\x00\x00\x08\x00\x00\x24\x00\xf2\x00\x01\x03\x07\x0f\x1f\x3f\x7f\xff"
+"\xff\x7f\x3f\x1f\x0f\x07\x03\xb5\x01\x43\x01\x01\x01\xff\x11\x01\xf2\x0b\xff\x80\x80\x9c\x9c\x9c\x80\x80\xff\xff\xff\xe3\xe3\xe3"
+"\xff\xff\x18\x3c\x7e\x3c\x18\x3c\x7e\xff\xff\x00\x02\x00\x13\xaa\x01\x00\x22\x55\xaa\x02\x00\x03\x41\x00\xf0\x06\xff\x00\x10\x38"
+"\x7c\xfe\x7c\x38\x10\x38\x10\x92\xfe\x92\x10\x38\x7c\x00\x6c\xfe\xfe\x10\x00\x00\x17\x00\xf0\x05\xfe\x7c\x10\x7c\xe7\xe7\x42\xff"
+"\xff\x42\xe7\xe7\xdb\xff\xdb\x18\x18\xdb\xff\xdb\x53\x00\x51\xff\xff\x7e\x3c\xc0\x5e\x02\x01\xb7\x04\x00\xd3\x00\x31\x00\x0c\x0c"
+"\x07\x00\x21\x00\x03\xf2\x01\x00\x0c\x00\x0f\x22\x00\x51\x04\x7c\x01\x20\x3f\x3f\x72\x00\x00\x1e\x03\x02\x08\x00\x22\xfc\xfc\x08"
+"\x00\x02\xa4\x01\x22\x00\x00\x8c\x00\x20\xc0\xc0\x08\x00\x00\x06\x00\x0c\x04\x00\x00\x22\x00\x00\x1c\x00\x00\x08\x00\x0a\x3a\x00"
+"\x04\x4a\x00\x01\x5d\x02\x34\x00\x00\x00\x6a\x00\x04\x7a\x00\x04\xf0\x00\x22\x03\x03\x0a\x00\x00\x08\x00\x00\x0a\x00\x02\x08\x00"
+"\x06\x0a\x00\x00\x56\x00\x00\x14\x00\x00\x08\x00\x16\x00\x26\x01\x00\xb3\x02\x01\xab\x02\x01\x18\x00\x12\xff\x66\x00\x00\xf4\x01"
+"\x01\x15\x00\x01\x10\x00\x00\x0e\x00\x00\xc7\x01\x02\x08\x00\x80\xff\xff\xff\xff\xff\xff\xff\xff"
+;
+unsigned char dump_kc87_font_2[2048];
+static const unsigned char dump_z9001_basic_lz4[] =
+"\xf0\x1c\x18\x0b\xc3\x8c\xc0\x7f\x7f\x42\x41\x53\x49\x43\x00\x21\xbd\xc0\x11\x00\x03\x01\x67\x00\xed\xb0\xeb\xf9\xcd\x69\xc6\x32"
+"\xab\x03\x32\x00\x04\x21\x92\xc0\xcd\xc9\xd1\x21\xae\x06\x00\xf0\x2e\xcd\xae\xc5\x21\x62\x03\xcd\x86\xc9\x7a\xd6\x06\x21\x00\x03"
+"\x2b\x30\x03\x11\xff\xbf\x23\xcd\x89\xc6\x28\x09\x7e\x47\x2f\x77\xbe\x70\x28\xf2\x2b\x11\x00\xff\x22\xb0\x03\x19\x22\x56\x03\xcd"
+"\x41\xc6\x2a\x56\x03\x11\xef\xfb\x19\xcd\x29\xd8\x21\xa0\x41\x00\xf2\x07\x2a\x04\xe0\x7e\xfe\x78\x20\x01\x3e\xaf\x32\xfc\x03\x31"
+"\x67\x03\x18\x0a\x7f\x7f\x52\x45\x7f\x00\xc1\xcd\x69\xc6\xc3\x88\xc3\x0c\x0a\x0d\x48\x43\x2d\x12\x00\xf0\x18\x0a\x0d\x00\x20\x42"
+"\x59\x54\x45\x53\x20\x46\x52\x45\x45\x0a\x0d\x00\x4d\x45\x4d\x4f\x52\x59\x20\x45\x4e\x44\x20\x3f\x20\x3a\x00\xc3\x89\xc0\xc3\x67"
+"\xc9\x00\x01\x00\xd0\xd6\x00\x6f\x7c\xde\x00\x67\x78\xde\x00\x47\x3e\x00\x13\x00\xf0\x22\x35\x4a\xca\x99\x39\x1c\x76\x98\x22\x95"
+"\xb3\x98\x0a\xdd\x47\x98\x53\xd1\x99\x99\x0a\x1a\x9f\x98\x65\xbc\xcd\x98\xd6\x77\x3e\x98\x52\xc7\x4f\x80\x0b\xff\x1b\x00\x0a\x00"
+"\x0a\x00\x00\x00\xc3\xae\xc5\x46\x00\x01\x04\x00\x50\x65\x04\xfe\xff\x00\x44\x00\xf0\xff\xff\x2d\x01\x04\x00\x00\x00\xc5\x4e\x44"
+"\xc6\x4f\x52\xce\x45\x58\x54\xc4\x41\x54\x41\xc9\x4e\x50\x55\x54\xc4\x49\x4d\xd2\x45\x41\x44\xcc\x45\x54\xc7\x4f\x54\x4f\xd2\x55"
+"\x4e\xc9\x46\xd2\x45\x53\x54\x4f\x52\x45\xc7\x4f\x53\x55\x42\xd2\x45\x54\x55\x52\x4e\xd2\x45\x4d\xd3\x54\x4f\x50\xcf\x55\x54\xcf"
+"\x4e\xce\x55\x4c\x4c\xd7\x41\x49\x54\xc4\x45\x46\xd0\x4f\x4b\x45\xc4\x4f\x4b\x45\xc1\x55\x54\x4f\xcc\x49\x4e\x45\x53\xc3\x4c\x53"
+"\xd7\x49\x44\x54\x48\xc2\x59\x45\xa1\xc3\x41\x4c\x4c\xd0\x52\x49\x4e\x54\xc3\x4f\x4e\x54\xcc\x49\x53\x54\xc3\x4c\x45\x41\x52\xc3"
+"\x4c\x4f\x41\x44\xc3\x53\x41\x56\x45\xce\x45\x57\xd4\x41\x42\x28\xd4\x4f\xc6\x4e\xd3\x50\x43\x28\xd4\x48\x45\x4e\xce\x4f\x54\xd3"
+"\x54\x45\x50\xab\xad\xaa\xaf\xde\xc1\x4e\x44\xcf\x52\xbe\xbd\xbc\xd3\x47\x4e\xc9\x4e\x54\xc1\x42\x53\xd5\x53\x52\xc6\x52\x45\xc9"
+"\x4e\x50\xd0\x4f\x53\xd3\x51\x52\xd2\x4e\x44\xcc\x4e\xc5\x58\x50\xc3\x4f\x53\xd3\x49\x4e\xd4\x41\x4e\xc1\x54\x4e\xd0\x45\x45\x4b"
+"\xc4\x45\x45\x4b\xd0\x49\xcc\x45\x4e\xd3\x54\x52\x24\xd6\x41\x4c\xc1\x53\x43\xc3\x48\x52\x24\xcc\x45\x46\x54\x24\xd2\x49\x47\x48"
+"\x54\x24\xcd\x49\x44\x24\xcc\x4f\x41\x44\xd4\x52\x4f\x4e\xd4\x52\x4f\x46\x46\xc5\x44\x49\x54\xc5\x4c\x53\x45\x80\x1a\xc9\xde\xc7"
+"\xdc\xcc\x48\xca\xec\xcb\x01\xcf\x1f\xcc\x5d\xca\x07\xca\xeb\xc9\xcf\xca\xdf\xc8\xf6\xc9\x25\xca\x4a\xca\x18\xc9\xec\xd3\xb3\xca"
+"\xc0\xcb\xf7\xd3\xc4\xd0\x37\xd4\x4e\xd4\xfa\xc5\xea\xc6\xd0\xdd\xb9\xcb\xf4\xdf\x4a\xca\x38\xdb\xfa\xca\x48\xc9\xf2\xc6\xaa\xc9"
+"\x43\xdc\x41\xdd\x40\xc6\x2d\xc6\xb7\xc7\xb8\xc7\xe7\xc3\x4a\xca\xa6\xd6\x70\xd7\xbc\xd6\x03\x03\x90\xd0\xe3\xd3\xbd\xd0\x1f\xd9"
+"\xfd\xd9\x59\xd5\x6d\xd9\x70\xda\x76\xda\xd7\xda\xec\xda\x31\xd4\x44\xd4\xd5\xd6\x2c\xd3\x56\xd1\xbf\xd3\x3b\xd3\x4b\xd3\x5b\xd3"
+"\x89\xd3\x92\xd3\x79\x11\xd8\x79\x6a\xd4\x7c\x98\xd5\x7c\xf3\xd5\x7f\x28\xd9\x50\x5e\xce\x46\x5d\xce\x4e\x46\x53\x4e\x52\x47\x4f"
+"\x44\x46\x43\x4f\x56\x4f\x4d\x55\x4c\x42\x53\x44\x44\x2f\x30\x49\x44\x54\x4d\x4f\x53\x4c\x53\x53\x54\x43\x4e\x55\x46\x4d\x4f\x49"
+"\x4f\x20\x45\x52\x52\x4f\x52\x07\x00\x20\x49\x4e\x20\x00\x46\x49\x4c\x45\x20\x46\x4f\x55\x4e\x44\x0d\x4f\x4b\x0d\x00\x42\x52\x45"
+"\x41\x4b\x00\xe5\x2a\xdb\x03\x06\x00\x09\x09\x3e\xe5\x3e\xd0\x95\x6f\x3e\xff\x9c\x38\x04\x67\x39\xe1\xd8\x1e\x0c\x18\x14\x2a\xca"
+"\x03\x22\x58\x03\x1e\x02\x01\x1e\x14\x01\x1e\x00\x01\x1e\x12\x01\x1e\x22\x3c\x03\xf2\x21\x43\x03\xcd\x55\xcb\x21\xdd\xc2\x57\x19"
+"\x44\x4d\x0b\x3e\x3f\x1e\x03\xcd\xd6\xd1\x21\x05\xc3\xcd\xc9\xd1\x2a\x58\x03\x11\xfe\xff\xcd\x89\xc6\xca\x0d\xc0\x7c\xa5\x3c\xc4"
+"\x21\xd8\x3e\xc1\xaf\x32\x30\x00\x10\x1d\x21\x00\xf0\x33\x37\xdc\xfd\xdd\xcd\xdf\xc6\x2b\x22\x58\x03\x21\xea\x03\x3a\x4d\x03\xb7"
+"\x28\x6b\xed\x5b\x4e\x03\xf2\xf0\xc3\xd5\xcd\x2a\xd8\xd1\xd5\xcd\xbb\xc4\x3e\x2a\x38\x02\x3e\x20\xcd\xae\xc6\xcd\xae\xc5\xd1\x30"
+"\x06\xaf\x32\x4d\x03\x18\xba\x2a\x50\x03\x19\x38\xf4\xd5\x11\xf9\x5e\x00\xf2\x2c\xd1\x30\xea\x22\x4e\x03\x21\x62\x03\xf5\x18\x47"
+"\xc8\xcd\x97\xc6\xcd\x86\xc9\xc0\xc1\xcd\xbb\xc4\x30\x58\xd5\x7e\x23\xb6\x23\x28\x02\x3e\x7f\x32\x4d\x03\x7e\x23\x66\x6f\x22\x4e"
+"\x03\xcd\x98\xde\xd1\xc2\x96\xc3\x38\xb7\x3f\x18\xcd\x3e\x3e\x57\x00\xf0\x12\xda\x96\xc3\x21\x61\x03\xcd\xbd\xc8\x3c\x3d\xca\x96"
+"\xc3\xf5\xcd\x86\xc9\xd5\xcd\xda\xc4\x47\xd1\xf1\xd2\x8a\xc8\xd5\xc5\xaf\x32\xcd\x1c\x00\xf0\x77\xb7\xf5\xcd\xbb\xc4\x38\x08\xf1"
+"\xf5\xb7\x20\x03\xc3\x20\xca\xc5\x30\x11\xeb\x2a\xd7\x03\x1a\x02\x03\x13\xcd\x89\xc6\x20\xf7\xed\x43\xd7\x03\xd1\xf1\x28\x22\x2a"
+"\xd7\x03\xe3\xc1\x09\xe5\xcd\xab\xc4\xe1\x22\xd7\x03\xeb\x36\xff\xd1\x23\x23\x73\x23\x72\x23\x11\x62\x03\x1a\x77\x23\x13\xb7\x20"
+"\xf9\xcd\x4f\xc6\x23\xeb\x21\x96\xc3\xe5\x62\x6b\x7e\x23\xb6\xc8\x23\x7e\x23\xa6\x3c\xc8\x23\xaf\xbe\x23\x20\xfc\xeb\x73\x23\x72"
+"\x18\xe8\xcd\x30\xc3\xc5\xe3\xc1\xcd\x89\xc6\x7e\x02\xc8\x0b\x2b\x18\xf6\x2a\x5f\x03\x44\x4d\x7e\x23\xb6\x2b\xc8\x23\x23\xc6\x00"
+"\x50\xcd\x89\xc6\x60\x69\x09\x00\xf0\x79\x3f\xc8\x3f\xd0\x18\xe4\xaf\x32\xaf\x03\x0e\x05\x11\x62\x03\xaf\x32\xfb\x03\x7e\xfe\x20"
+"\xca\x71\xc5\x47\xfe\x22\xca\x91\xc5\xb7\xca\x97\xc5\x3a\xaf\x03\xb7\x7e\x20\x73\xfe\x3f\x3e\x9e\x28\x6d\x7e\xfe\x30\x38\x04\xfe"
+"\x3c\x38\x64\xd5\x11\x20\xc1\xc5\x01\x6d\xc5\xc5\x06\x7f\x7e\xfe\x61\x38\x07\xfe\x7b\x30\x03\xe6\x5f\x77\x4e\xeb\x23\xb6\xf2\x26"
+"\xc5\x04\x7e\xe6\x7f\x20\x15\x3a\xfc\x03\xa7\xc8\x3a\xfb\x03\xa7\xc0\x3c\x32\xfb\x03\x2a\x0c\xe0\x7e\xe6\x7f\xc8\xb9\x20\xdd\xeb"
+"\xe5\x13\x1a\xb7\xfa\x69\xc5\x4f\x78\xfe\x88\x20\x04\xcd\xbd\xc8\x2b\x23\x44\x00\xf0\x67\x02\xe6\x5f\xb9\x28\xe5\xe1\x18\xbb\x48"
+"\xf1\xeb\xc9\xeb\x79\xc1\xd1\x23\x12\x13\x0c\xd6\x3a\x28\x04\xfe\x49\x20\x03\x32\xaf\x03\xd6\x54\x28\x05\xd6\x0e\xc2\xe3\xc4\x47"
+"\x7e\xb7\x28\x09\xb8\x28\xe0\x23\x12\x0c\x13\x18\xf3\x21\x61\x03\x12\x13\x12\x13\x12\xc9\x4c\x49\x53\x54\x00\x52\x55\x4e\x00\x43"
+"\x4f\x4e\x54\x00\xe5\x21\x62\x03\xe3\xcd\xe4\xdd\xe3\xfe\x1c\x11\x9f\xc5\x28\x0e\xfe\x1d\x11\xa4\xc5\x28\x07\xfe\x1e\x11\xa8\xc5"
+"\x20\x14\x21\x61\x03\x23\x13\x1a\x77\xa7\x20\xf9\xa4\x05\xf0\xb3\xf1\xc5\xe1\xc3\x5e\xcb\xcd\x0f\xdf\x20\x02\xe1\xc9\xcd\x27\xdf"
+"\x38\xf9\xcd\x32\xdf\x18\xc1\x7e\xb7\xc8\xcd\xd5\xdd\x23\x18\xf7\x11\x0a\x00\xd5\x28\x17\xcd\x86\xc9\xeb\xe3\x28\x11\xeb\xcd\xd6"
+"\xc8\xed\x5b\x50\x03\x28\x06\xcd\x86\xc9\xc2\x48\xc3\xeb\x7d\xb4\xca\x67\xc9\x22\x50\x03\xcb\xff\x32\x4d\x03\xe1\x22\x4e\x03\xc1"
+"\xc3\x96\xc3\xcd\x5f\xde\x3a\x09\x03\xe6\x03\x28\xf3\x3e\xd5\xcd\xb2\xdc\xf1\xaf\x18\xea\xc0\x2a\x5f\x03\xaf\x32\x5e\x03\x77\x23"
+"\x77\x23\x22\xd7\x03\x2a\x5f\x03\x2b\x22\xcf\x03\x2a\xb0\x03\x22\xc4\x03\xaf\xcd\xdf\xc8\x2a\xd7\x03\x22\xd9\x03\x22\xdb\x03\xc1"
+"\x2a\x56\x03\xf9\x21\xb4\x03\x22\xb2\x03\xcd\x1d\xde\xaf\x6f\x67\x22\xd5\x03\x32\xcc\x03\x22\xdf\x03\xe5\xc5\x2a\xcf\x03\xc9\x7c"
+"\x92\xc0\x7d\x93\xc9\x7e\xfe\x41\xd8\xfe\x5b\x3f\xc9\x3a\x5e\x03\xa7\xc8\x10\x06\xf0\x27\x6e\xc3\xcd\x89\xc6\x3e\x08\x18\x02\x3e"
+"\x20\xc3\xd5\xdd\xf5\xc5\x4f\xfe\x20\x38\x13\x3a\x41\x03\x47\x3a\xac\x03\x04\x28\x05\x05\xb8\xcc\x61\xcb\x3c\x32\xac\x03\x79\xcd"
+"\xd5\xdd\xc1\xf1\xc9\x3e\x3f\xcd\xae\xc6\x3e\x09\xc0\x02\xf0\x09\xdf\xc6\xc3\x4a\x03\x21\x00\x20\x22\x61\x03\x22\x63\x03\x65\xc9"
+"\xcd\x6c\xc9\xed\x53\x46\x03\xc9\x0a\x03\x71\x25\xde\xcd\xc8\xdd\x28\x12\xc6\x00\x30\x2a\x46\x03\x27\x03\x64\xff\xff\x22\x46\x03"
+"\xe1\x24\x03\xf1\x33\xc5\xcd\x91\xc7\xe1\x4e\x23\x46\x23\x78\xb1\x28\x59\xcd\x67\xc7\xcd\xf9\xc8\xc5\x5e\x23\x56\x23\xe5\x21\xea"
+"\x03\xcd\x61\xcb\xcd\x2a\xd8\x3e\x20\xe1\xcd\xae\xc6\x7e\x23\xfe\x22\x28\x14\xb7\x28\xd3\xf2\x3c\xc7\xcd\x9a\xc7\xcd\xae\xc6\x1a"
+"\x13\xb7\xf2\x4e\xc7\x18\xe6\x1d\x00\xf0\x10\xb7\x28\xba\xfe\x22\x28\xd7\x18\xf2\xe5\x2a\x44\x03\x7d\xb4\x2b\x22\x44\x03\xe1\xc0"
+"\xcd\x91\xc7\xcd\xe4\xdd\xfe\x03\x20\xea\x85\x00\x10\x0c\x4f\x00\xc0\xfd\xdd\x2a\x4e\x03\x22\x46\x03\xc3\x8c\xc0\xe5\x90\x00\xf0"
+"\x07\x44\x03\xe1\xc9\xd6\x7f\xfe\x56\x38\x08\xd6\x55\xed\x5b\x0c\xe0\x18\x03\x11\x21\xc1\x47\x5b\x00\xf0\x07\xac\xc7\x10\xf8\xe6"
+"\x7f\xc9\x3e\xaf\x32\x0a\x03\xc9\x21\x04\x00\x39\x7e\x23\xfe\x81\xc0\xaa\x00\xf0\x39\xe5\x69\x60\x7a\xb3\xeb\x28\x04\xeb\xcd\x89"
+"\xc6\x01\x0d\x00\xe1\xc8\x09\x18\xe3\x3e\x64\x32\xcc\x03\xcd\x5d\xca\xc1\xe5\xcd\x48\xca\x22\xc8\x03\x21\x02\x00\x39\xcd\xc1\xc7"
+"\xd1\x20\x14\x09\xd5\x2b\x56\x2b\x5e\x23\x23\xe5\x2a\xc8\x03\xcd\x89\xc6\xe1\x20\xe8\xd1\xf9\xeb\x0e\x08\xcd\x27\xc3\x12\x00\xf3"
+"\x17\xe3\xe5\x2a\x58\x03\xe3\xcd\x29\xcd\xcd\xcc\xc8\xa6\xcd\x26\xcd\xe5\xcd\xeb\xd6\xe1\xc5\xd5\x01\x00\x81\x51\x5a\x7e\xfe\xab"
+"\x3e\x01\x20\x0e\xcd\xbd\xc8\x19\x00\x20\xcd\x97\x1c\x00\xf0\x26\xf5\x33\xe5\x2a\xcf\x03\xe3\x06\x81\xc5\x33\xcd\x16\xde\xcd\xf9"
+"\xc8\x22\xcf\x03\x7e\xfe\x3a\x28\x28\xb7\xc2\x48\xc3\x23\x7e\x23\xb6\xca\x22\xc9\x23\x5e\x23\x56\xed\x53\x58\x03\x3a\x0a\x03\xb7"
+"\x28\x0f\xe5\x3e\x3c\xa8\x01\x21\x2a\xd8\x70\x04\xf0\x0c\xe1\xcd\xbd\xc8\x11\x54\xc8\xd5\xc8\xd6\x80\xda\x5d\xca\xfe\x25\x38\x14"
+"\xd6\x50\x38\x34\xfe\x05\x38\x0a\x47\x73\x03\xf0\x52\x28\x29\xc3\x03\xe0\xc6\x25\x07\x4f\x06\x00\xeb\x21\x40\xc2\x09\x4e\x23\x46"
+"\xc5\xeb\x23\x7e\xfe\x3a\xd0\xfe\x20\x28\xf7\xfe\x30\x3f\x3c\x3d\xc9\x7e\xe3\xbe\x23\xe3\x28\xea\xc3\x48\xc3\x3e\x2c\xbe\x18\xf6"
+"\x3e\x29\x18\xf9\xeb\x2a\x5f\x03\x28\x0e\xeb\xcd\x86\xc9\xe5\xcd\xbb\xc4\x60\x69\xd1\xd2\x20\xca\x2b\x22\xdd\x03\xeb\xc9\xcd\xf3"
+"\xdd\xc0\xfe\x13\x28\x08\xfe\x03\xc0\xcd\xe4\xdd\x18\x0f\x93\x01\xf1\x18\x1e\xc8\xfe\x0a\xc8\xfe\x03\x28\x02\x18\xf1\xc0\xf6\xc0"
+"\x22\xcf\x03\x21\xf6\xff\xc1\x2a\x58\x03\xf5\x7d\xa4\x3c\x28\x09\x22\xd3\x03\x2a\xcf\x03\x22\xd5\x03\xac\x05\xf0\x0d\x1d\xde\xcd"
+"\x55\xcb\xf1\x21\x21\xc3\xc2\x71\xc3\xc3\x88\xc3\x2a\xd5\x03\x7c\xb5\x1e\x20\xca\x56\xc3\xeb\x2a\xd3\x11\x06\x22\xeb\xc9\x22\x01"
+"\xf0\x4f\xcd\x97\xd6\xf2\x6f\xc9\x1e\x08\xc3\x56\xc3\xcd\x26\xcd\x3a\xe8\x03\xfe\x90\xda\x45\xd7\x01\x80\x90\x11\x00\x00\xe5\xcd"
+"\x18\xd7\xe1\x51\xc8\x18\xe1\x2b\x11\x00\x00\xcd\xbd\xc8\xd0\xe5\xf5\x21\x98\x19\xcd\x89\xc6\xda\x48\xc3\x62\x6b\x19\x29\x19\x29"
+"\xf1\xd6\x30\x5f\x16\x00\x19\xeb\xe1\x18\xe0\x28\x3c\xcd\x5e\xc9\xcd\xbe\xc8\xe5\x2a\xb0\x03\x28\x10\xe1\xcd\xd6\xc8\xd5\xcd\x6c"
+"\x11\x00\xf1\x2b\xc2\x48\xc3\xe3\xeb\x7d\x93\x5f\x7c\x9a\x57\xda\x3e\xc3\xe5\x2a\xd7\x03\x01\x28\x00\x09\xcd\x89\xc6\xd2\x3e\xc3"
+"\xeb\x22\x56\x03\xe1\x22\xb0\x03\xe1\xc3\x53\xc6\xca\x4f\xc6\xcd\x53\xc6\x01\x54\xc8\x18\x10\x0e\x03\xcd\x27\xc3\xc1\xe5\xe6\x01"
+"\xb0\x3e\x8c\xf5\x33\xc5\xcd\x86\xc9\xcd\x4a\xca\x10\x00\x00\x0d\x02\x50\x23\xdc\xbe\xc4\xd4\x2f\x01\xf0\x29\x2b\xd8\x1e\x0e\xc3"
+"\x56\xc3\xc0\x16\xff\xcd\xbd\xc7\xf9\xfe\x8c\x1e\x04\x20\xf0\xe1\x22\x58\x03\x23\x7c\xb5\x20\x07\x3a\xcd\x03\xb7\xc2\x87\xc3\x21"
+"\x54\xc8\xe3\x3e\xe1\x01\x3a\x0e\x00\x06\x00\x79\x48\x47\x7e\xb7\xc8\xb8\xc8\x16\x03\xf0\x14\xf3\x18\xf4\xcd\x06\xcf\xcd\xcc\xc8"
+"\xb4\xd5\x3a\xae\x03\xf5\xcd\x3a\xcd\xf1\xe3\x22\xcf\x03\x1f\xcd\x2b\xcd\x28\x35\xe5\x2a\xe5\x03\xe5\x23\x10\x02\x20\x2a\x5f\x80"
+"\x02\x40\x30\x12\x2a\x56\x08\x00\x50\xd1\x30\x11\x21\xc0\x09\x00\xa0\x30\x09\x3e\xd1\xcd\x1b\xd3\xeb\xcd\x66\x07\x00\xf1\x20\xe1"
+"\xcd\xfa\xd6\xe1\xc9\xe5\xcd\xf7\xd6\xd1\xe1\xc9\xcd\x21\xd4\x7e\x47\xfe\x8c\x28\x05\xcd\xcc\xc8\x88\x2b\x4b\x0d\x78\xca\x92\xc8"
+"\xcd\x87\xc9\xfe\x2c\xc0\x18\xf3\xcd\x3a\xcd\x7e\xfe\x88\x1b\x00\x20\xa9\x2b\xc0\x02\xf1\x19\x97\xd6\x20\x08\x23\x7e\xb7\xc8\xfe"
+"\xd4\x20\xf8\xcd\xbd\xc8\xda\x07\xca\xc3\x91\xc8\xcd\xbe\xc8\x18\x07\xaf\x32\xfd\x03\xcd\x25\xde\x28\x5e\xc8\xfe\xd5\x38\x09\x64"
+"\x02\xf0\x22\x03\xcd\x06\xe0\xfe\xa5\xca\x92\xcb\xfe\xa8\x28\x78\xe5\xfe\x2c\x28\x5d\xfe\x3b\xca\xb2\xcb\xc1\xcd\x3a\xcd\xe5\x3a"
+"\xae\x03\xb7\x20\x20\xcd\x34\xd8\xcd\x8a\xd1\x36\x20\x2a\xe5\x03\x34\x2a\xe5\x03\x89\x04\xf0\x12\x04\x28\x0a\x04\x3a\xac\x03\x86"
+"\x3d\xb8\xd4\x61\xcb\xcd\xcc\xd1\xe1\x18\xa0\x3a\xac\x03\xb7\xc8\x18\x05\x36\x00\x21\x61\x03\x3e\x0d\x92\x04\xf1\x08\x0a\xcd\xae"
+"\xc6\xaf\x32\xac\x03\x3a\x40\x03\x3d\xc8\xf5\xaf\xcd\xae\xc6\xf1\x18\xf6\x3a\x42\xc7\x04\x00\x38\x00\xf1\x15\x30\x29\xd6\x0d\x38"
+"\x02\x20\xfa\x2f\x18\x15\xf5\xcd\x1e\xd4\xcd\xdb\xc8\x2b\xf1\xd6\xa8\xe5\x28\x03\x3a\xac\x03\x2f\x83\x30\x0b\x3c\x28\x08\x47\xee"
+"\x07\x20\x10\xfb\x29\x03\x90\xc3\x03\xcb\xcd\x21\xd4\x32\x41\x03\x0d\x01\xf0\x20\xc0\x3c\x32\x40\x03\xc9\x3f\x52\x45\x44\x4f\x20"
+"\x46\x52\x4f\x4d\x20\x53\x54\x41\x52\x54\x0d\x00\x3a\xce\x03\xb7\xc2\x42\xc3\xc1\x21\xc9\xcb\xcd\xc9\xd1\xc3\x85\xc6\xcd\x37\xd1"
+"\xcd\x5f\xde\xbe\x02\xf0\x33\x7e\xfe\x22\x20\x10\xcd\x8b\xd1\xcd\xcc\xc8\x3b\xe5\xcd\xcc\xd1\xcd\xd4\xc6\x18\x04\xe5\xcd\xcf\xc6"
+"\xc1\x38\x36\x21\x62\x03\x7e\xb7\x2b\xc5\x28\x37\x36\x2c\x18\x05\xe5\x2a\xdd\x03\xf6\xaf\x32\xce\x03\xe3\x18\x03\xcd\xd6\xc8\xcd"
+"\x06\xcf\xe3\xd5\x7e\xfe\x2c\x28\x1e\x5d\x00\x21\x20\x7d\x6f\x05\x83\xcd\xcf\xc6\xd1\xc1\xda\x1f\xc9\x39\x00\x30\xca\x47\xca\xf1"
+"\x01\xc0\xb7\x28\x21\xcd\xbd\xc8\x57\x47\xfe\x22\x28\x0c\x2d\x00\xf0\x05\x57\x28\x02\x16\x3a\x06\x2c\x2b\xcd\x8e\xd1\xeb\x21\x88"
+"\xcc\xe3\xd5\xc3\x77\xca\x22\x03\xf0\x09\xa1\xd7\xe3\xcd\xf7\xd6\xe1\xcd\xbe\xc8\x28\x05\xfe\x2c\xc2\xdb\xcb\xe3\xcd\xbe\xc8\x20"
+"\x93\xd1\x34\x00\xf0\x15\xeb\xc2\xf4\xc8\xd5\xb6\x21\xab\xcc\xc4\xc9\xd1\xe1\xc9\x3f\x45\x58\x54\x52\x41\x20\x49\x47\x4e\x4f\x52"
+"\x45\x44\x0d\x00\xcd\x48\xca\xb7\x20\x11\x5b\x04\x50\x1e\x06\xca\x56\xc3\x4d\x02\x30\xed\x53\xca\x94\x08\xf1\x16\xfe\x83\x20\xe2"
+"\xc3\x56\xcc\x11\x00\x00\xc4\x06\xcf\x22\xcf\x03\xcd\xbd\xc7\xc2\x4e\xc3\xf9\xd5\x7e\x23\xf5\xd5\xcd\xdd\xd6\xe3\xe5\xcd\x61\xd4"
+"\xe1\x76\x00\x21\xee\xd6\x84\x03\x70\xc1\x90\xcd\xee\xd6\x28\x09\x9c\x04\x70\x69\x60\xc3\x50\xc8\xf9\x2a\xbd\x04\x40\x2c\xc2\x54"
+"\xc8\xa3\x00\xf0\x00\xdf\xcc\xcd\x3a\xcd\xf6\x37\x3a\xae\x03\x8f\xb7\xe8\x1e\x18\xca\x03\xf0\x23\xcc\xc8\x28\x2b\x16\x00\xd5\x0e"
+"\x01\xcd\x27\xc3\xcd\xad\xcd\x22\xd1\x03\x2a\xd1\x03\xc1\x78\xfe\x78\xd4\x29\xcd\x7e\x16\x00\xd6\xb3\x38\x15\xfe\x03\x30\x11\xfe"
+"\x01\x17\xaa\xba\x57\xda\x48\xc3\x22\xc6\x98\x00\xf0\x27\x18\xe7\x7a\xb7\xc2\x84\xce\x7e\x22\xc6\x03\xd6\xac\xd8\xfe\x07\xd0\x5f"
+"\x3a\xae\x03\x3d\xb3\x7b\xca\xb3\xd2\x07\x83\x5f\x21\xc8\xc2\x19\x78\x56\xba\xd0\x23\xcd\x29\xcd\xc5\x01\x49\xcd\xc5\x43\x4a\xcd"
+"\xc8\xd6\x58\x51\xdd\x05\x90\xc5\x2a\xc6\x03\x18\x90\xaf\x32\xae\x47\x00\xf0\x3d\x1e\x24\xca\x56\xc3\xda\xa1\xd7\xcd\x8f\xc6\x30"
+"\x37\xfe\xac\x28\xe8\xfe\x2e\xca\xa1\xd7\xfe\xad\x28\x19\xfe\x22\xca\x8b\xd1\xfe\xaa\xca\xe3\xce\xfe\xa7\xca\xf0\xd0\xd6\xb6\x30"
+"\x28\xcd\x36\xcd\xc3\xdb\xc8\x16\x7d\xcd\x3d\xcd\x2a\xd1\x03\xe5\xcd\xc0\xd6\xcd\x29\xcd\xe1\xc9\xcd\x06\xcf\xe5\xeb\x22\xe5\x03"
+"\xd7\x02\xf0\x03\xcc\xdd\xd6\xe1\xc9\x06\x00\x07\x4f\xc5\xcd\xbd\xc8\x79\xfe\x33\x38\x07\x0e\x03\xe0\xc2\x09\xe0\xfe\x22\x28\x1e"
+"\xfe\x2d\x38\x17\xcd\x36\xcd\xfd\x01\xf0\x0b\x2a\xcd\xeb\x2a\xe5\x03\xe3\xe5\xeb\xcd\x21\xd4\xeb\xe3\x18\x08\xcd\xe1\xcd\xe3\x11"
+"\xf3\xcd\xd5\x01\x94\x90\x05\xf0\x07\x66\x69\xe9\x15\xfe\xad\xc8\xfe\x2d\xc8\x14\xfe\x2b\xc8\xfe\xac\xc8\x2b\xc9\xf6\xaf\xf5\x84"
+"\x03\xf0\x35\x6f\xc9\xf1\xeb\xc1\xe3\xeb\xcd\xe0\xd6\xf5\xcd\x6f\xc9\xf1\xc1\x79\x21\xb0\xd0\x20\x05\xa3\x4f\x78\xa2\xe9\xb3\x4f"
+"\x78\xb2\xe9\x21\x96\xce\x3a\xae\x03\x1f\x7a\x17\x5f\x16\x64\x78\xba\xd0\xc3\x97\xcd\x98\xce\x79\xb7\x1f\xc1\xd1\xf5\xcd\x2b\xcd"
+"\x21\xd9\xce\xe5\xca\x18\xd7\xfb\x00\xf2\x2d\xd5\xcd\xfe\xd2\x7e\x23\x23\x4e\x23\x46\xd1\xc5\xf5\xcd\x02\xd3\xcd\xee\xd6\xf1\x57"
+"\xe1\x7b\xb2\xc8\x7a\xd6\x01\xd8\xaf\xbb\x3c\xd0\x15\x1d\x0a\xbe\x23\x03\x28\xed\x3f\xc3\xa2\xd6\x3c\x8f\xc1\xa0\xc6\xff\x9f\xc3"
+"\xa9\xd6\x16\x5a\xcd\x3d\xcd\x88\x00\xf0\x10\x7b\x2f\x4f\x7a\x2f\xcd\xb0\xd0\xc1\xc3\x49\xcd\xcd\xbe\xc8\xc8\xcd\xd6\xc8\x01\xfa"
+"\xce\xc5\xf6\xaf\x32\xad\x03\x46\xcd\x8f\x78\x05\x22\xaf\x4f\x65\x01\xd0\x38\x05\xcd\x8f\xc6\x38\x0b\x4f\xcd\xbd\xc8\x38\xfb\x6a"
+"\x01\xb0\xf6\xd6\x24\x20\x0a\x3c\x32\xae\x03\x0f\x81\x15\x00\xf0\x09\x3a\xcc\x03\x3d\xca\xdd\xcf\xf2\x48\xcf\x7e\xd6\x28\x28\x6f"
+"\xaf\x32\xcc\x03\xe5\x50\x59\x2a\xdf\xbd\x04\x90\x11\xe1\x03\xca\xe0\xd5\x2a\xd9\x03\x0b\x0b\x00\x1d\x0f\xf2\x1a\x10\x79\x96\x23"
+"\x20\x02\x78\x96\x23\x28\x38\x23\x23\x23\x23\x18\xeb\xe1\xe3\xd5\x11\xfb\xcd\xcd\x89\xc6\xd1\x28\x29\xe3\xe5\xc5\x01\x06\x00\x2a"
+"\xdb\x03\xe5\x09\xc1\x21\x0b\xa0\xdb\x03\x60\x69\x22\xd9\x03\x2b\x36\x00\x44\x0b\x20\xf8\xd1\x29\x0b\xf0\x12\xeb\xe1\xc9\x32\xe8"
+"\x03\x21\x20\xc3\x22\xe5\x03\xe1\xc9\xe5\x2a\xad\x03\xe3\x57\xd5\xc5\xcd\x5b\xc9\xc1\xf1\xeb\xe3\xe5\xeb\x3c\x57\x97\x03\xf0\x0a"
+"\xee\xcd\xdb\xc8\x22\xd1\x03\xe1\x22\xad\x03\x1e\x00\xd5\x11\xe5\xf5\x2a\xd9\x03\x3e\x19\xed\x5b\xdb\x96\x00\x90\x28\x23\x7e\xb9"
+"\x23\x20\x02\x7e\xb8\x2a\x03\xf0\x2b\x23\x20\xe8\x3a\xad\x03\xb7\xc2\x51\xc3\xf1\x44\x4d\xca\xaa\xcf\x96\x28\x5f\x1e\x10\xc3\x56"
+"\xc3\x11\x04\x00\xf1\xca\x67\xc9\x71\x23\x70\x23\x4f\xcd\x27\xc3\x23\x23\x22\xc6\x03\x71\x23\x3a\xad\x03\x17\x79\x01\x0b\x00\x30"
+"\x02\xc1\x03\x1b\x00\xf5\x09\xf5\xe5\xcd\x89\xd7\xeb\xe1\xf1\x3d\x20\xea\xf5\x42\x4b\xeb\x19\xda\x3e\xc3\xcd\x30\xc3\x22\xdb\xb3"
+"\x00\xc0\x03\x57\x2a\xc6\x03\x5e\xeb\x29\x09\xeb\x2b\x2b\xbe\x00\x90\xf1\x38\x22\x47\x4f\x7e\x23\x16\xe1\x45\x09\x70\xe3\xf5\xcd"
+"\x89\xc6\x30\x90\x44\x00\xf0\x02\xd1\x19\xf1\x3d\x44\x4d\x20\xe8\x29\x29\xc1\x09\xeb\x2a\xd1\x03\xc9\xac\x00\x40\x21\x00\x00\x39"
+"\x98\x02\xf1\x28\x28\x0d\xcd\xfe\xd2\xcd\x09\xd2\xed\x5b\x56\x03\x2a\xc4\x03\x7d\x93\x4f\x7c\x9a\x41\x50\x1e\x00\x21\xae\x03\x73"
+"\x06\x90\xc3\xae\xd6\x3a\xac\x03\x47\xaf\x18\xed\xcd\x45\xd1\xcd\x37\xd1\x01\x48\xca\xc5\xd5\xcd\xcc\xc8\x28\xdb\x02\x00\xde\x08"
+"\x10\xe1\xf5\x01\x20\xdb\xc8\x83\x06\xf0\x00\x44\x4d\xe3\x71\x23\x70\xc3\x84\xd1\xcd\x45\xd1\xd5\xcd\xe1\x0f\x02\x10\xe3\x8b\x00"
+"\x50\x7a\xb3\xca\x54\xc3\x34\x0c\xf1\x05\xe5\x2a\xdf\x03\xe3\x22\xdf\x03\x2a\xe3\x03\xe5\x2a\xe1\x03\xe5\x21\xe1\x03\xd5\x22\x04"
+"\x10\x26\x29\x02\xe1\xc2\x48\xc3\xe1\x22\xe1\x03\xe1\x22\xe3\x03\xe1\x22\xdf\x80\x01\x01\x05\x07\x42\xe1\xc0\x1e\x16\x0f\x04\xd0"
+"\xa7\x3e\x80\x32\xcc\x03\xb6\x47\xcd\x0b\xcf\xc3\x29\x5f\x00\x02\x2a\x06\xe0\xcd\xfe\xd2\x01\x57\xd3\xc5\x7e\x23\x23\xe5\xcd\xe1"
+"\xd1\x52\x0a\xf1\x03\xcd\x7e\xd1\xe5\x6f\xcd\xf2\xd2\xd1\xc9\xcd\xe1\xd1\x21\xc0\x03\xe5\x77\x09\x0d\xf0\x1d\xe1\xc9\x2b\x06\x22"
+"\x50\xe5\x0e\xff\x23\x7e\x0c\xb7\x28\x06\xba\x28\x03\xb8\x20\xf4\xfe\x22\xcc\xbd\xc8\xe3\x23\xeb\x79\xcd\x7e\xd1\x11\xc0\x03\x2a"
+"\xb2\x03\x22\xe5\x03\x3e\x01\xa1\x02\xf0\x05\xfa\xd6\xcd\x89\xc6\x22\xb2\x03\xe1\x7e\xc0\x1e\x1e\xc3\x56\xc3\x23\xcd\x8a\xd1\x2e"
+"\x01\x50\xee\xd6\x1c\x1d\xc8\x6e\x06\xc3\xfe\x0d\xcc\x66\xcb\x03\x18\xf2\xb7\x0e\xf1\xf5\x41\x01\x50\x2f\x4f\x06\xff\x09\xad\x11"
+"\xf2\x05\x38\x07\x22\xc4\x03\x23\xeb\xf1\xc9\xf1\x1e\x1a\x28\xc2\xbf\xf5\x01\xe3\xd1\xc5\xb3\x0b\xe0\x21\x00\x00\xe5\x2a\x56\x03"
+"\xe5\x21\xb4\x03\xed\x5b\xb2\x36\x02\xb0\x01\x1a\xd2\x20\x3f\x2a\xd7\x03\xed\x5b\xd9\x0f\x00\xc0\x28\x0a\x7e\x23\x23\xb7\xcd\x68"
+"\xd2\x18\xee\xc1\xac\x01\x00\xde\x02\xf0\x01\x49\xcd\xee\xd6\x7b\xe5\x09\xb7\xf2\x3b\xd2\x22\xc6\x03\xe1\x4e\x29\x0f\x41\x23\xed"
+"\x5b\xc6\x30\x00\x81\xda\x01\x59\xd2\xc5\xf6\x80\x7e\xed\x07\x80\x23\xf0\xb7\xc8\x44\x4d\x2a\xc4\x1a\x00\xf2\x18\x60\x69\xd8\xe1"
+"\xe3\xcd\x89\xc6\xe3\xe5\x60\x69\xd0\xc1\xf1\xf1\xe5\xd5\xc5\xc9\xd1\xe1\x7d\xb4\xc8\x2b\x46\x2b\x4e\xe5\x2b\x2b\x6e\x26\x00\x09"
+"\x50\x59\x2b\x2f\x00\xd0\xae\xc4\xe1\x71\x23\x70\x69\x60\x2b\xc3\x0c\xd2\xc5\x3d\x08\x90\xe3\xcd\xad\xcd\xe3\xcd\x2a\xcd\x7e\x0d"
+"\x00\xf2\x17\xe5\x86\x1e\x1c\xda\x56\xc3\xcd\x7b\xd1\xd1\xcd\x02\xd3\xe3\xcd\x01\xd3\xe5\x2a\xc2\x03\xeb\xcd\xe9\xd2\xcd\xe9\xd2"
+"\x21\x46\xcd\xe3\xe5\x18\x6f\xe1\xe3\x3b\x04\xf0\x02\x6f\x2c\x2d\xc8\x0a\x12\x03\x13\x18\xf8\xcd\x2a\xcd\x2a\xe5\x03\xeb\x66\x08"
+"\x62\xc0\xd5\x50\x59\x1b\x4e\x98\x00\xc0\x20\x05\x47\x09\x22\xc4\x03\xe1\xc9\x2a\xb2\x03\x8b\x00\xf2\x09\x2b\x2b\xcd\x89\xc6\xc0"
+"\x22\xb2\x03\xc9\x01\xc0\xd0\xc5\xcd\xfb\xd2\xaf\x57\x32\xae\x03\x7e\xb7\x0f\x00\x41\x30\xd3\x28\x55\xdb\x00\xf1\x27\x1a\xc9\x3e"
+"\x01\xcd\x7b\xd1\xcd\x24\xd4\x2a\xc2\x03\x73\xc1\xc3\xa9\xd1\xcd\xda\xd3\xaf\xe3\x4f\xe5\x7e\xb8\x38\x02\x78\x11\x0e\x00\xc5\xcd"
+"\xe1\xd1\xc1\xe1\xe5\x23\x23\x46\x23\x66\x68\x06\x00\x09\x44\x4d\xcd\x7e\xd1\x0a\x02\xf0\x10\xcd\x02\xd3\x18\xcf\xcd\xda\xd3\xd1"
+"\xd5\x1a\x90\x18\xcd\xeb\x7e\xcd\xde\xd3\x04\x05\xca\x67\xc9\xc5\x1e\xff\xfe\x29\x28\x06\x7b\x05\x10\x21\x13\x08\xf2\x0b\xf1\xe3"
+"\x01\x61\xd3\xc5\x3d\xbe\x06\x00\xd0\x4f\x7e\x91\xbb\x47\xd8\x43\xc9\xcd\x30\xd3\xca\xcf\xd4\x5f\x01\x0f\xf0\x22\xe5\x19\x46\x72"
+"\xe3\xc5\x7e\xcd\xa1\xd7\xc1\xe1\x70\xc9\xeb\xcd\xdb\xc8\xc1\xd1\xc5\x43\xc9\xcd\x24\xd4\x4f\xed\x78\xc3\xc0\xd0\xcd\x14\xd4\x3a"
+"\x06\x03\x4f\x7b\xed\x79\xc9\xcd\x14\xd4\xf5\x1e\x00\x75\x07\x03\x5f\x00\x10\xc1\x1a\x00\x60\xed\x78\xab\xa0\x28\xfa\x54\x08\x20"
+"\x32\x06\xef\x07\x10\x2b\xfe\x06\x90\x26\xcd\xcd\x61\xc9\x7a\xb7\xc2\x67\x6c\x0a\xc2\x7b\xc9\xcd\x6f\xc9\x1a\x18\xb2\xcd\x6c\xc9"
+"\xd5\x98\x00\x20\xd1\x12\x13\x00\x74\xeb\x46\x23\x7e\xc3\xb1\xd0\x17\x00\xf0\x1d\x6c\xc9\xe3\x73\x23\x72\xe1\xc9\x21\x04\xd9\xcd"
+"\xee\xd6\x18\x09\xcd\xee\xd6\x21\xc1\xd1\xcd\xc0\xd6\x78\xb7\xc8\x3a\xe8\x03\xb7\xca\xe0\xd6\x90\x30\x0c\x2f\x3c\xeb\xcd\xc8\xd6"
+"\x18\x06\xf0\xf2\xc1\xd1\xfe\x19\xd0\xf5\xcd\x03\xd7\x67\xf1\xcd\x2a\xd5\xb4\x21\xe5\x03\xf2\xab\xd4\xcd\x0a\xd5\x30\x4b\x23\x34"
+"\x28\x63\x2e\x01\xcd\x3e\xd5\x18\x40\xaf\x90\x47\x7e\x9b\x5f\x23\x7e\x9a\x57\x23\x7e\x99\x4f\xdc\x16\xd5\x68\x63\xaf\x47\x79\xb7"
+"\x20\x16\x4a\x54\x65\x6f\x78\xd6\x08\xfe\xe0\x20\xf0\xaf\x32\xe8\x03\xc9\x05\x29\xcb\x12\xcb\x11\xf2\xd4\xd4\x78\x5c\x45\xb7\x28"
+"\x08\x21\xe8\x03\x86\x77\x30\xe5\xc8\x78\x21\xe8\x03\xb7\xfc\xfd\xd4\x46\x23\x7e\xe6\x80\xa9\x4f\xc3\xe0\xd6\x1c\xc0\x14\xc0\x0c"
+"\xc0\x0e\x80\x34\xc0\xc3\x53\xd6\x7e\x83\x5f\x23\x7e\x8a\x57\x23\x7e\x89\x4f\xc9\x21\xe9\x03\x7e\x2f\x77\xaf\x6f\x90\x47\x7d\x9b"
+"\x5f\x7d\x9a\x57\x7d\x99\x4f\xc9\x06\x00\xd6\x08\x38\x07\x43\x5a\x51\x0e\x00\x18\xf5\xc6\x09\x6f\xaf\x2d\xc8\x79\x1f\x4f\xcb\x1a"
+"\xcb\x1b\xcb\x18\x18\xf2\x00\x00\x00\x81\x03\xaa\x56\x19\x80\xf1\x22\x76\x80\x45\xaa\x38\x82\xcd\x97\xd6\xb7\xea\x67\xc9\x21\xe8"
+"\x03\x7e\x01\x35\x80\x11\xf3\x04\x90\xf5\x70\xd5\xc5\xcd\x6f\xd4\xc1\xd1\x04\xcd\xf5\xd5\x21\x48\xd5\xcd\x66\xd4\x21\x4c\xd5\xcd"
+"\xce\xd9\x01\x80\x80\x00\x0c\xc0\x6f\xd4\xf1\xcd\x0b\xd8\x01\x31\x80\x11\x18\x72\x2e\x01\xf4\x2a\x97\xd6\xc8\x2e\x00\xcd\x58\xd6"
+"\x79\x32\xf7\x03\xeb\x22\xf8\x03\x01\x00\x00\x50\x58\x21\xbc\xd4\xe5\x21\xbc\xd5\xe5\xe5\x21\xe5\x03\x7e\x23\xb7\x28\x21\xe5\x2e"
+"\x08\x1f\x67\x79\x30\x0b\xe5\x2a\xf8\x03\x19\xeb\xe1\x3a\xf7\x03\x89\x96\x00\xf0\x02\x2d\x7c\x20\xe4\xe1\xc9\x43\x5a\x51\x4f\xc9"
+"\xcd\xc8\xd6\x01\x20\x84\x66\x00\xf0\x0b\xe0\xd6\xc1\xd1\xcd\x97\xd6\xca\x4b\xc3\x2e\xff\xcd\x58\xd6\x34\x34\x2b\x7e\x32\x14\x03"
+"\x2b\x7e\x32\x10\x05\x00\xf0\x1a\x0c\x03\x41\xeb\xaf\x4f\x57\x5f\x32\x17\x03\xe5\xc5\x7d\xcd\x0b\x03\xde\x00\x3f\x30\x07\x32\x17"
+"\x03\xf1\xf1\x37\xd2\xc1\xe1\x79\x3c\x3d\x1f\xfa\xec\xd4\x17\xcb\x13\x62\x01\xf0\x39\x29\xcb\x10\x3a\x17\x03\x17\x32\x17\x03\x79"
+"\xb2\xb3\x20\xcf\xe5\x21\xe8\x03\x35\xe1\x20\xc7\x1e\x0a\xc3\x56\xc3\x78\xb7\xca\x7c\xd6\x7d\x21\xe8\x03\xae\x80\x47\x1f\xa8\x78"
+"\xf2\x7b\xd6\xc6\x80\x77\xca\xe0\xd5\xcd\x03\xd7\x77\x2b\xc9\xcd\x97\xd6\x2f\xe1\xb7\xe1\xf2\xcf\xd4\x18\xd1\xcd\xeb\x16\x02\xf0"
+"\x00\xc6\x02\x38\xc7\x47\xcd\x6f\xd4\x21\xe8\x03\x34\xc0\x18\xbc\x25\x02\xa0\xc8\x3a\xe7\x03\xfe\x2f\x17\x9f\xc0\x3c\x30\x00\xf2"
+"\x10\x06\x88\x11\x00\x00\x21\xe8\x03\x4f\x70\x06\x00\x23\x36\x80\x17\xc3\xb9\xd4\xcd\x97\xd6\xf0\x21\xe7\x03\x7e\xee\x80\x77\xc9"
+"\x9a\x08\x20\x2a\xe7\x9f\x08\xf0\x0b\xc9\x01\x49\x82\x11\xdb\x0f\x18\x03\xcd\xee\xd6\xed\x53\xe5\x03\xed\x43\xe7\x03\x50\x59\xc9"
+"\x21\xe5\x03\xf3\x05\x00\x4f\x09\xd0\xc9\x11\xe5\x03\x06\x04\x1a\x77\x13\x23\x10\xfa\xc9\x43\x00\xf0\x35\x07\x37\x1f\x77\x3f\x1f"
+"\x23\x23\x77\x79\x07\x37\x1f\x4f\x1f\xae\xc9\x78\xb7\xca\x97\xd6\x21\xa0\xd6\xe5\xcd\x97\xd6\x79\xc8\x21\xe7\x03\xae\x79\xf8\xcd"
+"\x32\xd7\x1f\xa9\xc9\x23\x78\xbe\xc0\x2b\x79\xbe\xc0\x2b\x7a\xbe\xc0\x2b\x7b\x96\xc0\xe1\xe1\xc9\x47\x4f\x57\x5f\xb7\xc8\x25\x0f"
+"\xf1\x11\xcd\x03\xd7\xae\x67\xfc\x69\xd7\x3e\x98\x90\xcd\x2a\xd5\x7c\x17\xdc\xfd\xd4\x06\x00\xdc\x16\xd5\xe1\xc9\x1b\x7a\xa3\x3c"
+"\xc0\x0b\x10\x02\xf0\x2f\xfe\x98\x3a\xe5\x03\xd0\x7e\xcd\x45\xd7\x36\x98\x7b\xf5\x79\x17\xcd\xb9\xd4\xf1\xc9\x21\x00\x00\x78\xb1"
+"\xc8\x3e\x10\x29\x38\x06\xeb\x29\xeb\x30\x04\x09\xda\x0b\xd0\x3d\x20\xf1\xc9\xfe\x2d\xf5\x28\x05\xfe\x2b\x28\x01\x2b\xcd\xcf\xd4"
+"\x47\x57\x5f\x2f\x7d\x08\xa0\x38\x3d\xfe\x2e\x28\x16\xfe\x45\x20\x15\xa2\x03\x20\x4d\xce\xa5\x08\xf0\x24\x4b\x14\x20\x07\xaf\x93"
+"\x5f\x0c\x0c\x28\xde\xe5\x7b\x90\xf4\xed\xd7\xf2\xe4\xd7\xf5\xcd\xe7\xd5\xf1\x3c\x20\xf2\xd1\xf1\xcc\xc0\xd6\xeb\xc9\xc8\xf5\xcd"
+"\x82\xd6\xf1\x3d\xc9\xd5\x57\x78\x89\x47\xc5\xe5\xd5\x0e\x00\xf0\x14\xd6\x30\xcd\x0b\xd8\xe1\xc1\xd1\x18\xa8\xcd\xc8\xd6\xcd\xa9"
+"\xd6\xc1\xd1\xc3\x6f\xd4\x7b\x07\x07\x83\x07\x86\xd6\x30\x5f\x18\xa5\xe5\x21\x0d\x93\x14\xb0\xe1\xeb\xaf\x06\x98\xcd\xae\xd6\x21"
+"\xc8\xd1\x04\x11\x00\x17\x01\xf1\x1b\x36\x20\xf2\x42\xd8\x36\x2d\x23\x36\x30\xca\xef\xd8\xe5\xfc\xc0\xd6\xaf\xf5\xcd\xf5\xd8\x01"
+"\x43\x91\x11\xf8\x4f\xcd\x18\xd7\xb7\xe2\x6e\xd8\xf1\xcd\xee\xd7\xf5\x18\xec\x86\x00\x00\x1d\x00\xf0\x22\xcd\x5e\xd4\x3c\xcd\x45"
+"\xd7\xcd\xe0\xd6\x01\x06\x03\xf1\x81\x3c\xfa\x89\xd8\xfe\x08\x30\x04\x3c\x47\x3e\x02\x3d\x3d\xe1\xf5\x11\x08\xd9\x05\x20\x06\x36"
+"\x2e\x23\x36\x30\x23\x05\x36\x2e\xcc\xf5\xd6\xa5\x00\xf0\x49\xeb\xd6\xe1\x06\x2f\x04\x7b\x96\x5f\x23\x7a\x9e\x57\x23\x79\x9e\x4f"
+"\x2b\x2b\x30\xf0\xcd\x0a\xd5\x23\xcd\xe0\xd6\xeb\xe1\x70\x23\xc1\x0d\x20\xd2\x05\x28\x0b\x2b\x7e\xfe\x30\x28\xfa\xfe\x2e\xc4\xf5"
+"\xd6\xf1\x28\x1a\x36\x45\x23\x36\x2b\xf2\xe4\xd8\x36\x2d\x2f\x3c\x06\x2f\x04\xd6\x0a\x30\xfb\xc6\x3a\x23\x70\x23\x77\x23\x71\xe1"
+"\xc9\x01\x74\x94\x11\xf7\x23\xa4\x00\xf0\x05\xe1\xe2\x65\xd8\xe9\x00\x00\x00\x80\xa0\x86\x01\x10\x27\x00\xe8\x03\x00\x64\x00\x11"
+"\x18\xb0\x01\x00\x00\x21\xc0\xd6\xe3\xe9\xcd\xc8\xd6\xc4\x04\x12\xdd\x35\x03\xf0\x10\x78\xca\x6d\xd9\xf2\x38\xd9\xb7\xca\x4b\xc3"
+"\xb7\xca\xd0\xd4\xd5\xc5\x79\xf6\x7f\xcd\xeb\xd6\xf2\x55\xd9\xd5\xc5\xcd\x70\xd7\xb1\x0a\xf0\x0e\x18\xd7\xe1\x7c\x1f\xe1\x22\xe7"
+"\x03\xe1\x22\xe5\x03\xdc\x1a\xd9\xcc\xc0\xd6\xd5\xc5\xcd\x59\xd5\xc1\xd1\xcd\x9a\xd5\x86\x03\x80\x38\x81\x11\x3b\xaa\xcd\x9a\xd5"
+"\x0a\x10\xf0\x00\x88\xd2\x76\xd6\xcd\x70\xd7\xc6\x80\xc6\x02\xda\x76\xd6\xf5\x14\x04\x60\x61\xd4\xcd\x91\xd5\xf1\x4a\x00\xf0\x21"
+"\x6c\xd4\xcd\xc0\xd6\x21\xad\xd9\xcd\xdd\xd9\x11\x00\x00\xc1\x4a\xc3\x9a\xd5\x08\x40\x2e\x94\x74\x70\x4f\x2e\x77\x6e\x02\x88\x7a"
+"\xe6\xa0\x2a\x7c\x50\xaa\xaa\x7e\xff\xff\x7f\x7f\x00\x00\x80\x81\x82\x04\x71\xcd\xc8\xd6\x11\x98\xd5\xd5\x8a\x02\xf0\x07\x9a\xd5"
+"\xe1\xcd\xc8\xd6\x7e\x23\xcd\xdd\xd6\x06\xf1\xc1\xd1\x3d\xc8\xd5\xc5\xf5\xe5\xcd\x16\x00\x00\xf5\x0c\xf0\x04\x6f\xd4\xe1\x18\xe9"
+"\xcd\x97\xd6\x21\x1b\x03\xfa\x5d\xda\x21\x3c\x03\xcd\xdd\x0c\x00\xb0\xc8\x86\xe6\x07\x06\x00\x77\x23\x87\x87\x4f\xb5\x05\x00\xa8"
+"\x00\xf1\x01\x1a\x03\x3c\xe6\x03\x06\x00\xfe\x01\x88\x32\x1a\x03\x21\x60\xda\x1b\x00\xf0\x30\x61\xd4\xcd\xeb\xd6\x7b\x59\xee\x4f"
+"\x4f\x36\x80\x2b\x46\x36\x80\x21\x19\x03\x34\x7e\xd6\xab\x20\x04\x77\x0c\x15\x1c\xcd\xbc\xd4\x21\x3c\x03\xc3\xf7\xd6\x77\x2b\x77"
+"\x2b\x77\x18\xd5\x68\xb1\x46\x68\x99\xe9\x92\x69\x10\xd1\x75\x68\x21\xba\xda\xcd\x61\xd4\x09\x01\x61\x49\x83\x11\xdb\x0f\xcd\x8f"
+"\x04\x10\xf5\x1a\x01\x01\x41\x01\x80\xcd\x6c\xd4\x21\xbe\xda\xcd\x66\xdc\x03\x60\x37\xf2\xa6\xda\xcd\x5e\x0a\x00\x50\xb7\xf5\xf4"
+"\xc0\xd6\x18\x00\xf0\x00\x61\xd4\xf1\xd4\xc0\xd6\x21\xc2\xda\xc3\xce\xd9\xdb\x0f\x49\xf4\x00\xf0\x07\x7f\x05\xba\xd7\x1e\x86\x64"
+"\x26\x99\x87\x58\x34\x23\x87\xe0\x5d\xa5\x86\xda\x0f\x49\x83\xcc\x02\x30\x76\xda\xc1\x02\x01\x00\x60\x06\xf0\x00\xcd\x70\xda\xc3"
+"\xf3\xd5\xcd\x97\xd6\xfc\x1a\xd9\xfc\xc0\xd6\x7c\x01\x40\x81\xda\x09\xdb\xd0\x12\x10\x59\x8d\x05\xf1\x1f\x66\xd4\xe5\x21\x13\xdb"
+"\xcd\xce\xd9\x21\xba\xda\xc9\x09\x4a\xd7\x3b\x78\x02\x6e\x84\x7b\xfe\xc1\x2f\x7c\x74\x31\x9a\x7d\x84\x3d\x5a\x7d\xc8\x7f\x91\x7e"
+"\xe4\xbb\x4c\x7e\x6c\xaa\xaa\x7f\x6a\x01\xf0\x04\x49\xdb\x28\x03\xcd\x6c\xc9\xe5\x21\x47\xdb\xe5\xeb\xe9\xe1\xc9\xfe\xae\xc0\x5f"
+"\x05\xf0\x20\xbd\xc8\xc8\x38\x0b\xfe\x94\x28\x16\xfe\x47\xd2\x48\xc3\xd6\x07\xd6\x30\xda\x48\xc3\xeb\x29\x29\x29\x29\xb5\x6f\xeb"
+"\x18\xe0\x7b\x87\x87\x87\x87\xf6\x0d\x57\x1e\xef\x18\xd4\xd5\xe5\x36\x00\x8e\x09\x40\x20\xf8\xe3\xe5\xbb\x09\x50\x09\xd2\x2a\xc4"
+"\x03\xab\x09\xf0\x0c\xaf\xed\x52\xd1\xe3\xed\x52\xe5\xcd\x28\xdd\x4f\xcd\xe4\xdd\x47\xe1\xcd\xe4\xdd\x12\x13\x2b\x7d\xb4\x20\xf6"
+"\x0b\x00\xf0\x34\x5f\xcd\xe4\xdd\x57\xaf\xed\x52\x38\x44\x2a\x56\x03\x23\xcd\xe4\xdd\x77\x23\x1b\x7b\xb2\x20\xf6\xd1\xe3\xc5\xcd"
+"\xf8\xdc\xe3\xed\x42\x20\x2d\xe1\xcd\x77\xdd\xe3\x2b\xd5\xed\x5b\xc4\x03\xed\xb8\xed\x53\xc4\x03\xe1\x42\x4b\x03\xd1\x2b\x70\x2b"
+"\x71\x2b\x35\x03\x20\xfc\x0b\xd3\x08\x94\x20\xf0\xe1\xcd\xfd\xdd\xc9\xd1\xe1\x86\x00\xaf\x18\x29\xcd\x87\xdc\xe5\xe2\x7b\xdb\xeb"
+"\x7c\x00\x04\x00\x5f\x00\xf0\x11\xe1\xed\x42\xe1\x28\xc7\xcd\x1d\xde\x21\x3f\xdc\xc3\x71\xc3\x42\x41\x44\x00\xfe\xae\x28\xc6\xcd"
+"\xb0\xdc\xed\x5b\xd7\x03\x1b\x1b\xbc\x0b\x50\x01\xd1\xff\xed\x52\xe0\x08\xe6\x28\xdd\x6f\xcd\xe4\xdd\x67\xe5\xed\x42\xe1\xd2\x3e"
+"\xc3\xc6\x00\x60\xed\x53\xd7\x03\x21\x12\x57\x04\x50\xc3\x8a\xc4\x1e\x26\x42\x0b\x30\xac\xdc\xe1\x8d\x10\x20\x3e\x01\xb1\x14\x50"
+"\x06\xcf\x32\xcc\x03\x18\x0a\x32\xeb\x19\xeb\x4e\x0a\x00\x0f\x0c\xf1\x0b\xc9\x3e\xd4\x23\x01\x3e\xd3\xf5\x3a\x5d\x03\xa7\x3e\x00"
+"\x32\x5d\x03\x28\x04\xf1\xc6\x04\xf5\xcd\xbe\xc8\x5c\x12\xf0\x0a\xe5\xf5\xcd\x3f\xd3\x21\xf7\x03\x06\x0d\x2b\x36\x20\x10\xfb\xd5"
+"\x11\x82\xdc\x73\x23\x72\xd1\x23\xf1\x9b\x16\xf0\x11\x77\x23\xeb\x06\x00\x79\xfe\x09\x38\x04\x0d\x23\x18\xf7\xed\xb0\xc9\xe5\xaf"
+"\x47\x86\xcd\x03\xdd\x20\xfa\xe1\xc9\x4f\x30\x01\x04\x88\x01\xf0\x06\x79\xc9\xf5\x3a\x07\x03\xcb\x4f\xcb\xcf\x32\x07\x03\x3e\x13"
+"\x20\x02\xc6\x08\x32\x08\x81\x19\x40\xf1\xc3\xd5\xdd\x1a\x00\x30\x47\xcb\xc7\x1a\x00\x11\x12\x1a\x00\x10\x09\x1a\x00\x70\xc3\xe4"
+"\xdd\xfe\xae\x28\x24\x53\x16\xf0\x2a\xb0\xdc\x2a\xd7\x03\x11\xff\xfb\x19\x44\x4d\x11\x01\x04\xcd\xb5\xdd\xe1\xe5\x21\x07\x03\xcb"
+"\x8e\x11\x43\x03\xcd\xf6\xdf\xe1\xc9\xcd\x87\xdc\xe2\x89\xdd\xcd\xf8\xdc\xeb\xed\x52\x18\xe0\xe5\x01\x00\x00\x7e\x23\x77\x34\x81"
+"\x23\x23\x86\x00\x60\xf4\xe1\xc9\xcd\x77\xdd\x60\x01\x70\xeb\xed\x52\xcd\xb5\xdd\xc1\xcf\x16\xf0\x13\x78\xeb\xcd\xd5\xdd\x2b\x2b"
+"\x78\xb1\x28\xb4\x56\x2b\x5e\x2b\x35\x28\xf3\x1a\xcd\xd5\xdd\x13\x0b\x18\xf5\x23\xe5\x79\xcd\x0d\xdd\x78\xe1\x20\x00\xf0\x19\x7d"
+"\xb4\x1a\x13\x20\xf6\xc9\x3a\x08\x03\xe6\x07\xd6\x01\xc9\xcd\x1d\xde\x3e\x0c\xf5\xd5\x57\x3a\x08\x03\x5f\x7a\xcd\xf6\xdf\x7b\xd1"
+"\x18\x3c\xd5\x3a\x09\x03\x5f\x0c\x00\xf0\x0b\x32\x09\x03\x7a\x18\x06\xd5\x1e\x80\xcd\xf6\xdf\xcb\x7b\xd1\xc9\xf5\xe5\xd5\xc5\x11"
+"\x42\x03\x06\x06\x7a\xab\x00\xf0\x29\x3e\xdc\xf6\xdf\x1c\x10\xf8\xc1\xd1\xe1\x3e\xf5\x3e\x00\x32\x09\x03\x3e\xf5\x3e\x01\x32\x08"
+"\x03\xf1\xc9\x7e\xfe\x23\x20\x31\xcd\xbd\xc8\x30\x38\x23\xe5\xe6\x03\x28\x12\x21\x07\x03\x87\xfe\x04\x28\x12\x30\x16\xcb\x4e\xcb"
+"\xce\x0f\x01\xf0\x09\x3c\x32\x08\x03\xe1\xc3\xbe\xc8\xcb\x5e\xcb\xde\x18\xee\xcb\x6e\xcb\xee\x18\xe8\xe5\xaf\x18\xe8\x3a\x00\x79"
+"\x30\xcd\xbd\xc8\xd2\x48\xc3\x3b\x00\x70\x10\x38\x14\xcb\x66\xcb\xe6\x3b\x00\xf0\x0c\x32\x09\x03\xe1\x18\xc4\xcb\x56\xcb\xd6\x18"
+"\xf0\xcb\x46\xcb\xc6\x18\xea\xe5\xaf\x18\xea\xc5\xcd\x2a\xd8\xe1\x2c\x0f\x91\x01\x61\x03\xc5\x18\x03\xcd\xd7\xde\x6b\x17\xf0\x00"
+"\x16\xb7\x28\x1f\xf2\xa7\xde\xc5\xcd\x9a\xc7\xc1\xcd\xd7\xde\x12\x17\x44\xbb\xde\x18\xe4\x1f\x00\xf0\x19\xd8\xb7\x20\xf4\x3e\x20"
+"\x03\x18\x0c\x03\x02\xe5\x21\x56\xfc\x09\xe1\xd0\xe1\x3e\x2a\xcd\xd5\xdd\xaf\x02\xe1\x77\x23\xe5\xcd\xf1\xc5\xd1\x23\x36\x00\x2b"
+"\x36\x20\xed\x15\xf0\x01\x0a\x20\x05\xcd\x12\xdf\x3c\xc9\xcd\x0f\xdf\xc8\xcd\x27\xdf\xd8\x1e\x19\x60\xe7\xfe\x0d\xc0\x3e\x09\x20"
+"\x19\xf0\x00\x7e\xb7\x20\xf6\x2b\x7e\xfe\x20\x20\x02\x36\x00\xc3\x5e\xcb\x15\x16\xf1\x19\xa7\xc9\xcd\x12\xdf\x37\xc9\xfe\x08\x28"
+"\x44\xfe\x09\x28\x2a\xfe\x1f\x28\x47\xfe\x19\xca\xc5\xdf\xfe\x18\xca\xcf\xdf\xfe\x02\xca\xdb\xdf\xfe\x1a\x28\x48\xfe\x0b\x45\x16"
+"\xc2\x01\xc8\xfe\x20\x30\x05\x3f\xcd\xd5\xdd\xc9\x77\x50\x00\x30\xc0\x11\xab\xf7\x0c\xf0\x1c\x28\x07\x36\x20\x23\x36\x00\x18\x03"
+"\xcd\xa2\xc6\x2b\x7e\xb7\xc0\x3e\x09\x18\xdf\xe5\x23\xcd\xf1\xc5\xcd\xa9\xc6\xd1\xaf\x2b\x46\x77\xcd\xa2\xc6\x78\x20\xf7\xc9\xcd"
+"\xa9\xc6\xb1\x00\x02\x35\x00\x80\x20\x0c\xcd\xa2\xc6\xcd\xa9\xc6\x34\x00\x90\x36\x00\xd1\x44\x4d\x03\x7e\x02\x0b\x0d\x00\x60\x20"
+"\xf7\x23\x36\x20\xc9\x0a\x00\x66\x7e\xb7\x20\xf8\x18\xb2\xbd\x00\xf0\x01\x18\x90\xcd\xc5\xdf\xe5\x7e\xb7\x28\x05\x36\x20\x23\x18"
+"\xf7\xe1\x62\x00\x20\xc5\xdf\xff\x00\xd0\xc9\x1e\xff\xc3\x0e\xe0\xff\xff\xff\xff\xff\xff\xff"
+;
+unsigned char dump_z9001_basic[8192];
+#include <string.h>
+static void _kc87_dump_init_lz4(const unsigned char* src, int src_size, unsigned char* dst) {
+    const unsigned char* end = src + src_size;
+    while (src < end) {
+        const unsigned char token = *src++;
+        int len = token >> 4;
+        if (len == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }
+        memcpy(dst, src, len); dst += len; src += len;
+        if (src >= end) { break; }
+        const unsigned char* m = dst - (src[0] | (src[1]<<8)); src += 2;
+        len = (token & 15) + 4;
+        if ((token & 15) == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }
+        while (len-- > 0) { *dst++ = *m++; }
+    }
+}
+static void kc87_dump_init(void) {
+    _kc87_dump_init_lz4(dump_kc87_os_2_lz4, sizeof(dump_kc87_os_2_lz4) - 1, dump_kc87_os_2);
+    _kc87_dump_init_lz4(dump_kc87_font_2_lz4, sizeof(dump_kc87_font_2_lz4) - 1, dump_kc87_font_2);
+    _kc87_dump_init_lz4(dump_z9001_basic_lz4, sizeof(dump_z9001_basic_lz4) - 1, dump_z9001_basic);
+}
+#if defined(_MSC_VER)
+#pragma section(".CRT$XCU", read)
+__declspec(allocate(".CRT$XCU")) void (*_kc87_dump_init_ctor)(void) = kc87_dump_init;
+#else
+__attribute__((constructor)) static void _kc87_dump_init_ctor(void) { kc87_dump_init(); }
+#endif
+dump_item kc87_dump_items[KC87_DUMP_NUM_ITEMS] = {
 { "kc87_os_2", dump_kc87_os_2, 8192 },
 { "kc87_font_2", dump_kc87_font_2, 2048 },
 { "z9001_basic", dump_z9001_basic, 8192 },
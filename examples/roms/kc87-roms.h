@@ -1,10 +1,13 @@
 #pragma once
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include <stdint.h>
 extern unsigned char dump_kc87_os_2[8192];
 extern unsigned char dump_kc87_font_2[2048];
 extern unsigned char dump_z9001_basic[8192];
+#ifndef DUMP_ITEM_DEFINED
+#define DUMP_ITEM_DEFINED
 typedef struct { const char* name; const uint8_t* ptr; int size; } dump_item;
-#define DUMP_NUM_ITEMS (3)
-extern dump_item dump_items[DUMP_NUM_ITEMS];
+#endif
+#define KC87_DUMP_NUM_ITEMS (3)
+extern dump_item kc87_dump_items[KC87_DUMP_NUM_ITEMS];
@@ -1,10 +1,13 @@
 #pragma once
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include <stdint.h>
 extern unsigned char dump_mz800_cgrom[2];
 extern unsigned char dump_mz800_monitor[5];
 extern unsigned char dump_mz800_dram2[24576];
+#ifndef DUMP_ITEM_DEFINED
+#define DUMP_ITEM_DEFINED
 typedef struct { const char* name; const uint8_t* ptr; int size; } dump_item;
-#define DUMP_NUM_ITEMS (3)
-extern dump_item dump_items[DUMP_NUM_ITEMS];
+#endif
+#define MZ800_DUMP_NUM_ITEMS (3)
+extern dump_item mz800_dump_items[MZ800_DUMP_NUM_ITEMS];
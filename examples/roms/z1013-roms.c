@@ -1,945 +1,471 @@
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include "z1013-roms.h"
-unsigned char dump_z1013_font[2048] = {
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x0, 0x0, 0x18, 0x24, 0x24, 0x18, 0x24, 0x42, 0xdb, 0xa5, 0x81, 0xff, 0x24, 0x24, 0x24, 0x42, 
-0x8, 0x34, 0x42, 0x81, 0x91, 0x69, 0x9, 0x31, 0x42, 0x7e, 0x81, 0xff, 0x0, 0x0, 0x0, 0x0, 
-0x18, 0x24, 0x42, 0x99, 0xbd, 0x99, 0x42, 0x24, 0x7e, 0x42, 0x99, 0xe7, 0x0, 0x0, 0x0, 0x0, 
-0x18, 0xdb, 0xc3, 0x18, 0x99, 0xe7, 0x81, 0x42, 0x18, 0x24, 0x18, 0xc3, 0xbd, 0x81, 0x81, 0x42, 
-0x24, 0x7e, 0x81, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x3c, 0x3c, 0x18, 0x3c, 0x7e, 
-0xdb, 0xff, 0xff, 0xff, 0x3c, 0x3c, 0x3c, 0x7e, 0x8, 0x3c, 0x7e, 0xff, 0xff, 0x6f, 0xf, 0x3f, 
-0x7e, 0x7e, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x18, 0x3c, 0x7e, 0xe7, 0xc3, 0xe7, 0x7e, 0x3c, 
-0x7e, 0x7e, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x18, 0xdb, 0xc3, 0x18, 0x99, 0xff, 0xff, 0x7e, 
-0x18, 0x3c, 0x18, 0xc3, 0xff, 0xff, 0xff, 0x7e, 0x3c, 0x3c, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x10, 0x10, 0x10, 0x0, 0x0, 0x10, 0x0, 
-0x28, 0x28, 0x28, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x7e, 0x24, 0x24, 0x24, 0x7e, 0x24, 0x0, 
-0x10, 0x3c, 0x50, 0x38, 0x14, 0x78, 0x10, 0x0, 0x60, 0x64, 0x8, 0x10, 0x20, 0x4c, 0xc, 0x0, 
-0x10, 0x28, 0x28, 0x30, 0x54, 0x48, 0x34, 0x0, 0x10, 0x10, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x8, 0x10, 0x20, 0x20, 0x20, 0x10, 0x8, 0x0, 0x20, 0x10, 0x8, 0x8, 0x8, 0x10, 0x20, 0x0, 
-0x0, 0x10, 0x54, 0x38, 0x54, 0x10, 0x0, 0x0, 0x0, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x10, 0x10, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x4, 0x8, 0x10, 0x20, 0x40, 0x0, 0x0, 
-0x38, 0x44, 0x44, 0x54, 0x44, 0x44, 0x38, 0x0, 0x10, 0x30, 0x10, 0x10, 0x10, 0x10, 0x38, 0x0, 
-0x38, 0x44, 0x4, 0x8, 0x10, 0x20, 0x7c, 0x0, 0x7c, 0x8, 0x10, 0x8, 0x4, 0x44, 0x38, 0x0, 
-0x8, 0x18, 0x28, 0x48, 0x7c, 0x8, 0x8, 0x0, 0x7c, 0x40, 0x78, 0x4, 0x4, 0x44, 0x38, 0x0, 
-0x18, 0x20, 0x40, 0x78, 0x44, 0x44, 0x38, 0x0, 0x7c, 0x4, 0x8, 0x10, 0x20, 0x20, 0x20, 0x0, 
-0x38, 0x44, 0x44, 0x38, 0x44, 0x44, 0x38, 0x0, 0x38, 0x44, 0x44, 0x3c, 0x4, 0x8, 0x30, 0x0, 
-0x0, 0x30, 0x30, 0x0, 0x30, 0x30, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x10, 0x10, 0x20, 0x0, 
-0x8, 0x10, 0x20, 0x40, 0x20, 0x10, 0x8, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x7c, 0x0, 0x0, 0x0, 
-0x20, 0x10, 0x8, 0x4, 0x8, 0x10, 0x20, 0x0, 0x38, 0x44, 0x4, 0x8, 0x10, 0x0, 0x10, 0x0, 
-0x38, 0x44, 0x5c, 0x54, 0x5c, 0x40, 0x3c, 0x0, 0x38, 0x44, 0x44, 0x7c, 0x44, 0x44, 0x44, 0x0, 
-0x78, 0x24, 0x24, 0x38, 0x24, 0x24, 0x78, 0x0, 0x38, 0x44, 0x40, 0x40, 0x40, 0x44, 0x38, 0x0, 
-0x78, 0x24, 0x24, 0x24, 0x24, 0x24, 0x78, 0x0, 0x7c, 0x40, 0x40, 0x78, 0x40, 0x40, 0x7c, 0x0, 
-0x7c, 0x40, 0x40, 0x78, 0x40, 0x40, 0x40, 0x0, 0x38, 0x44, 0x40, 0x40, 0x4c, 0x44, 0x3c, 0x0, 
-0x44, 0x44, 0x44, 0x7c, 0x44, 0x44, 0x44, 0x0, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x0, 
-0x1c, 0x8, 0x8, 0x8, 0x8, 0x48, 0x30, 0x0, 0x44, 0x48, 0x50, 0x60, 0x50, 0x48, 0x44, 0x0, 
-0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7c, 0x0, 0x44, 0x6c, 0x54, 0x54, 0x44, 0x44, 0x44, 0x0, 
-0x44, 0x44, 0x64, 0x54, 0x4c, 0x44, 0x44, 0x0, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x0, 
-0x78, 0x44, 0x44, 0x78, 0x40, 0x40, 0x40, 0x0, 0x38, 0x44, 0x44, 0x44, 0x54, 0x48, 0x34, 0x0, 
-0x78, 0x44, 0x44, 0x78, 0x50, 0x48, 0x44, 0x0, 0x3c, 0x40, 0x40, 0x38, 0x4, 0x4, 0x78, 0x0, 
-0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x0, 
-0x44, 0x44, 0x44, 0x44, 0x44, 0x28, 0x10, 0x0, 0x44, 0x44, 0x44, 0x54, 0x54, 0x6c, 0x44, 0x0, 
-0x44, 0x44, 0x28, 0x10, 0x28, 0x44, 0x44, 0x0, 0x44, 0x44, 0x44, 0x28, 0x10, 0x10, 0x10, 0x0, 
-0x7c, 0x4, 0x8, 0x10, 0x20, 0x40, 0x7c, 0x0, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38, 0x0, 
-0x0, 0x40, 0x20, 0x10, 0x8, 0x4, 0x0, 0x0, 0x38, 0x8, 0x8, 0x8, 0x8, 0x8, 0x38, 0x0, 
-0x10, 0x28, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 
-0x0, 0x20, 0x10, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x34, 0x4c, 0x44, 0x44, 0x3a, 0x0, 
-0x40, 0x40, 0x58, 0x64, 0x44, 0x44, 0x78, 0x0, 0x0, 0x0, 0x38, 0x44, 0x40, 0x44, 0x38, 0x0, 
-0x4, 0x4, 0x34, 0x4c, 0x44, 0x44, 0x3a, 0x0, 0x0, 0x0, 0x38, 0x44, 0x7c, 0x40, 0x38, 0x0, 
-0x8, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x0, 0x0, 0x0, 0x34, 0x4c, 0x44, 0x3c, 0x4, 0x38, 
-0x40, 0x40, 0x58, 0x64, 0x44, 0x44, 0x44, 0x0, 0x10, 0x0, 0x10, 0x10, 0x10, 0x10, 0x8, 0x0, 
-0x10, 0x0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x40, 0x40, 0x48, 0x50, 0x70, 0x48, 0x44, 0x0, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x8, 0x0, 0x0, 0x0, 0x68, 0x54, 0x54, 0x54, 0x54, 0x0, 
-0x0, 0x0, 0x58, 0x64, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x38, 0x44, 0x44, 0x44, 0x38, 0x0, 
-0x0, 0x0, 0x58, 0x64, 0x44, 0x78, 0x40, 0x40, 0x0, 0x0, 0x34, 0x4c, 0x44, 0x3c, 0x4, 0x4, 
-0x0, 0x0, 0x58, 0x64, 0x40, 0x40, 0x40, 0x0, 0x0, 0x0, 0x38, 0x40, 0x38, 0x4, 0x78, 0x0, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x8, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x4c, 0x34, 0x0, 
-0x0, 0x0, 0x44, 0x44, 0x44, 0x28, 0x10, 0x0, 0x0, 0x0, 0x54, 0x54, 0x54, 0x54, 0x28, 0x0, 
-0x0, 0x0, 0x44, 0x28, 0x10, 0x28, 0x44, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x3c, 0x4, 0x38, 
-0x0, 0x0, 0x7c, 0x8, 0x10, 0x20, 0x7c, 0x0, 0x8, 0x10, 0x10, 0x20, 0x10, 0x10, 0x8, 0x0, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0, 0x20, 0x10, 0x10, 0x8, 0x10, 0x10, 0x20, 0x0, 
-0x0, 0x0, 0x0, 0x32, 0x4c, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xc0, 0x20, 0x10, 0x10, 0x10, 0x10, 0x20, 0xc0, 0x3, 0x4, 0x8, 0x8, 0x8, 0x8, 0x4, 0x3, 
-0x81, 0x81, 0x42, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x42, 0x81, 0x81, 
-0x10, 0x10, 0x20, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x4, 0x3, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x3, 0x4, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x20, 0x10, 0x10, 
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0xff, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
-0x0, 0x10, 0x28, 0x44, 0x82, 0x44, 0x28, 0x10, 0xff, 0xef, 0xc7, 0x83, 0x1, 0x83, 0xc7, 0xef, 
-0x3c, 0x42, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3c, 0xc3, 0x81, 0x0, 0x0, 0x0, 0x0, 0x81, 0xc3, 
-0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 
-0x1, 0x2, 0x4, 0x8, 0x10, 0x20, 0x40, 0x80, 0x80, 0x40, 0x20, 0x10, 0x8, 0x4, 0x2, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x3, 0xc, 0x30, 0xc0, 0x3, 0xc, 0x30, 0xc0, 0x0, 0x0, 0x0, 0x0, 
-0x3, 0xc, 0x30, 0xc0, 0xc0, 0x30, 0xc, 0x3, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x30, 0xc, 0x3, 
-0xc0, 0x30, 0xc, 0x3, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x30, 0xc, 0x3, 0x3, 0xc, 0x30, 0xc0, 
-0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x80, 0x1, 0x1, 0x2, 0x2, 0x4, 0x4, 0x8, 0x8, 
-0x81, 0x81, 0x42, 0x42, 0x24, 0x24, 0x18, 0x18, 0x80, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 
-0x8, 0x8, 0x4, 0x4, 0x2, 0x2, 0x1, 0x1, 0x18, 0x18, 0x24, 0x24, 0x42, 0x42, 0x81, 0x81, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0xff, 0xff, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x18, 0x18, 0x18, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0xf8, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x1f, 0x1f, 0x18, 0x18, 0x18, 0x0, 0x0, 0x0, 0xf8, 0xf8, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0xf8, 0xf8, 0x0, 0x0, 0x0, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x18, 0x7, 
-0x1, 0x1, 0x1, 0x2, 0x2, 0x4, 0x18, 0xe0, 0xe0, 0x18, 0x4, 0x2, 0x2, 0x1, 0x1, 0x1, 
-0x7, 0x18, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x81, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x81, 
-0xf0, 0xf0, 0xf0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xf0, 0xf0, 0xf0, 
-0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 
-0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 
-0xf0, 0xf0, 0xf0, 0xf0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf0, 0xf0, 0xf0, 0xf0, 
-0xf, 0xf, 0xf, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf, 0xf, 0xf, 0xf, 
-0x1, 0x3, 0x7, 0xf, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0xf, 0x7, 0x3, 0x1, 
-0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-0xff, 0x80, 0x80, 0x9c, 0x9c, 0x9c, 0x80, 0x80, 0xff, 0xff, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xff, 
-0x18, 0x3c, 0x7e, 0x3c, 0x18, 0x3c, 0x7e, 0xff, 0xff, 0x0, 0xff, 0x0, 0xff, 0x0, 0xff, 0x0, 
-0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 
-0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xff, 0x0, 0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x38, 0x10, 
-0x38, 0x10, 0x92, 0xfe, 0x92, 0x10, 0x38, 0x7c, 0x0, 0x6c, 0xfe, 0xfe, 0xfe, 0x7c, 0x38, 0x10, 
-0x10, 0x38, 0x7c, 0xfe, 0xfe, 0x7c, 0x10, 0x7c, 0xe7, 0xe7, 0x42, 0xff, 0xff, 0x42, 0xe7, 0xe7, 
-0xdb, 0xff, 0xdb, 0x18, 0x18, 0xdb, 0xff, 0xdb, 0x3c, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x3c, 
-0xc0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xc, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0xc0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0xc, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0xc0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x30, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x3f, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xfc, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0xc0, 
-0x0, 0x0, 0x0, 0x0, 0xc0, 0xc0, 0xc0, 0xc0, 0x0, 0x0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x0, 0x0, 
-0xc0, 0xc0, 0xc0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xf0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 
-0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 
-0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-
-};
-unsigned char dump_z1013_mon_a2[2048] = {
-0x18, 0xd, 0x21, 0x4d, 0x0, 0x11, 0x4e, 0x0, 0x36, 0x0, 0x1, 0x15, 0x0, 0xed, 0xb0, 0x31, 
-0xb0, 0x0, 0x3e, 0xc3, 0x32, 0x20, 0x0, 0x21, 0xd5, 0xf0, 0x22, 0x21, 0x0, 0x3e, 0xcf, 0xd3, 
-0x3, 0x3e, 0x6f, 0xd3, 0x3, 0x21, 0xd, 0xf2, 0x11, 0x33, 0x0, 0x1, 0xc, 0x0, 0xed, 0xb0, 
-0xe7, 0x2, 0xc, 0xd, 0xd, 0x72, 0x6f, 0x62, 0x6f, 0x74, 0x72, 0x6f, 0x6e, 0x20, 0x5a, 0x20, 
-0x31, 0x30, 0x31, 0x33, 0x2f, 0x41, 0x2e, 0x32, 0x8d, 0x21, 0x90, 0x0, 0x22, 0x63, 0x0, 0xed, 
-0x5e, 0x18, 0x6, 0x31, 0xb0, 0x0, 0xe7, 0x2, 0xbf, 0xe7, 0x5, 0xed, 0x5b, 0x16, 0x0, 0xcd, 
-0x7, 0xf3, 0x47, 0x13, 0x1a, 0x4f, 0xc5, 0x13, 0xe7, 0x3, 0x20, 0x5, 0x1a, 0xfe, 0x3a, 0x28, 
-0xd, 0x22, 0x1b, 0x0, 0xe7, 0x3, 0x22, 0x1d, 0x0, 0xe7, 0x3, 0x22, 0x23, 0x0, 0xc1, 0x8, 
-0xed, 0x53, 0x25, 0x0, 0x21, 0xa7, 0xf0, 0x7e, 0xb8, 0x28, 0x11, 0x23, 0x23, 0x23, 0xb7, 0x20, 
-0xf6, 0x78, 0xfe, 0x40, 0x20, 0xbd, 0x21, 0xb0, 0x0, 0x41, 0x18, 0xeb, 0x23, 0x5e, 0x23, 0x56, 
-0xeb, 0x8, 0x1, 0x59, 0xf0, 0xc5, 0xe9, 0x42, 0xc4, 0xf5, 0x43, 0x9b, 0xf7, 0x44, 0xb, 0xf5, 
-0x45, 0xd6, 0xf5, 0x47, 0xf0, 0xf5, 0x49, 0x2, 0xf0, 0x4a, 0xe2, 0xf5, 0x4b, 0x48, 0xf5, 0x4c, 
-0x35, 0xf4, 0x4d, 0x62, 0xf3, 0x4e, 0x4b, 0xf7, 0x52, 0x1c, 0xf6, 0x53, 0xa6, 0xf3, 0x54, 0x5a, 
-0xf5, 0x57, 0xf5, 0xf6, 0x0, 0xe3, 0xf5, 0x7e, 0x32, 0x3, 0x0, 0x23, 0xf1, 0xe3, 0xe5, 0xc5, 
-0xf5, 0x21, 0xf5, 0xf0, 0x3a, 0x3, 0x0, 0xcb, 0x27, 0x4f, 0x6, 0x0, 0x9, 0x7e, 0x23, 0x66, 
-0x6f, 0xf1, 0xc1, 0xe3, 0xc9, 0x58, 0xf2, 0x19, 0xf2, 0xe2, 0xf2, 0x31, 0xf3, 0x19, 0xf1, 0xf0, 
-0xf2, 0x3e, 0xf3, 0x57, 0xf3, 0xa6, 0xf3, 0x35, 0xf4, 0x62, 0xf3, 0xf5, 0xf6, 0x4, 0xf6, 0x1, 
-0xf6, 0xc, 0xf6, 0x5a, 0xf5, 0xf6, 0xf2, 0x48, 0xf5, 0x21, 0x37, 0x0, 0x3e, 0x5b, 0xa6, 0x77, 
-0xdd, 0x21, 0xc6, 0xf7, 0xcd, 0xb9, 0xf1, 0x30, 0xd, 0xd5, 0xcb, 0xfe, 0xcd, 0xf9, 0xf1, 0x32, 
-0x13, 0x0, 0xd1, 0xcd, 0xc0, 0xf1, 0xdd, 0x21, 0xf6, 0xf7, 0x1e, 0x6, 0xcd, 0xce, 0xf1, 0x28, 
-0x3b, 0xcb, 0x41, 0x28, 0x8, 0xcb, 0x69, 0x28, 0x12, 0xcd, 0xf9, 0xf1, 0xc9, 0x3e, 0x2, 0xcb, 
-0x9e, 0xcb, 0x76, 0x20, 0x4, 0xcb, 0xf6, 0xae, 0x77, 0xaf, 0xc9, 0xcb, 0xee, 0xcb, 0x7e, 0x28, 
-0x1b, 0x3a, 0x13, 0x0, 0xcb, 0x77, 0x20, 0x2, 0xcb, 0xe7, 0xe6, 0x1f, 0xcb, 0x4e, 0xc8, 0xcb, 
-0xff, 0xc9, 0xcb, 0xb6, 0xcb, 0x7e, 0xc8, 0x3a, 0x13, 0x0, 0x18, 0xf0, 0x1e, 0x7, 0xcd, 0xce, 
-0xf1, 0x28, 0xc, 0xcb, 0x79, 0x28, 0x2d, 0xcb, 0x71, 0x20, 0xe7, 0xcb, 0x6e, 0x20, 0x25, 0xcb, 
-0x7e, 0xc8, 0x3a, 0x13, 0x0, 0xcb, 0x71, 0x28, 0x6, 0xcb, 0x5e, 0x28, 0xcf, 0x18, 0x4, 0xcb, 
-0x5e, 0x20, 0xc9, 0x47, 0xe6, 0x30, 0x78, 0xe2, 0xae, 0xf1, 0xcb, 0xa7, 0x18, 0x2, 0xcb, 0xe7, 
-0xcb, 0xef, 0x18, 0xb8, 0x3e, 0x8, 0xc3, 0x51, 0xf1, 0x1e, 0x0, 0xcd, 0xce, 0xf1, 0x37, 0xc0, 
-0x1c, 0x1, 0x8, 0x0, 0xdd, 0x9, 0x7b, 0xfe, 0x6, 0x20, 0xf0, 0x37, 0x3f, 0xc9, 0x7b, 0xd3, 
-0x8, 0xd3, 0x2, 0xdb, 0x2, 0xe6, 0xf, 0x4f, 0xcb, 0xe7, 0xd3, 0x2, 0xdb, 0x2, 0xcb, 0x27, 
-0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0x57, 0x81, 0x4f, 0xaf, 0xd3, 0x2, 0xdb, 0x2, 0xe6, 0xf, 
-0x82, 0xb9, 0x20, 0xda, 0x2f, 0xb7, 0x3e, 0x0, 0xc9, 0x11, 0x0, 0x0, 0x6, 0x8, 0xcb, 0x29, 
-0x30, 0x3, 0x1c, 0x10, 0xf9, 0xdd, 0x19, 0xdd, 0x7e, 0x0, 0xcb, 0xb6, 0xc9, 0xd0, 0x7, 0xe0, 
-0x3, 0x0, 0xc3, 0x53, 0xf0, 0x0, 0xec, 0x0, 0xf0, 0xdd, 0xe5, 0xc5, 0xd5, 0xe5, 0x1, 0x0, 
-0x10, 0xc5, 0xcd, 0x19, 0xf1, 0xc1, 0xdd, 0x21, 0x4, 0x0, 0xdd, 0xbe, 0x0, 0x20, 0x1b, 0xb7, 
-0x28, 0x16, 0xd, 0x20, 0xfd, 0xcb, 0x66, 0x20, 0x8, 0x11, 0x0, 0x8, 0x1b, 0x7b, 0xb2, 0x20, 
-0xfb, 0x10, 0xde, 0xcb, 0xe6, 0xaf, 0x18, 0x2, 0xcb, 0xa6, 0xdd, 0x77, 0x0, 0xb7, 0x28, 0xd1, 
-0xe1, 0xd1, 0xc1, 0xdd, 0xe1, 0xc9, 0xe6, 0x7f, 0xf5, 0xc5, 0xd5, 0xe5, 0x2a, 0x2b, 0x0, 0xf5, 
-0x3a, 0x1f, 0x0, 0x77, 0xf1, 0xfe, 0xd, 0x28, 0x53, 0xfe, 0xc, 0x28, 0x5e, 0xfe, 0x8, 0x28, 
-0x48, 0xfe, 0x9, 0x28, 0x1, 0x77, 0x23, 0xeb, 0x2a, 0x3d, 0x0, 0xaf, 0xed, 0x52, 0xeb, 0x20, 
-0x2a, 0xed, 0x5b, 0x3b, 0x0, 0x21, 0x20, 0x0, 0x19, 0xed, 0x4b, 0x35, 0x0, 0x78, 0xb1, 0x28, 
-0x2, 0xed, 0xb0, 0xd5, 0xe1, 0xe5, 0x13, 0x36, 0x20, 0x1, 0x1f, 0x0, 0xed, 0xb0, 0x2a, 0x16, 
-0x0, 0x11, 0x20, 0x0, 0xaf, 0xed, 0x52, 0x22, 0x16, 0x0, 0xe1, 0x7e, 0x32, 0x1f, 0x0, 0x36, 
-0xff, 0x22, 0x2b, 0x0, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0x2b, 0x18, 0xbb, 0x3e, 0xe0, 0xa5, 0xc6, 
-0x20, 0x4f, 0x36, 0x20, 0x23, 0x7d, 0xb9, 0x20, 0xf9, 0x18, 0xac, 0x2a, 0x35, 0x0, 0x1, 0x1f, 
-0x0, 0x9, 0xe5, 0xc1, 0x2a, 0x3b, 0x0, 0xe5, 0x36, 0x20, 0xe5, 0xd1, 0x13, 0xed, 0xb0, 0xe1, 
-0x18, 0xc9, 0xe3, 0x7e, 0x23, 0xf5, 0xcd, 0x56, 0xf2, 0xf1, 0xcb, 0x7f, 0x28, 0xf5, 0xe3, 0xc9, 
-0xcd, 0xe2, 0xf2, 0x20, 0x23, 0xa0, 0xe5, 0x2a, 0x2b, 0x0, 0x22, 0x16, 0x0, 0xe7, 0x1, 0xe7, 
-0x0, 0xfe, 0xd, 0x20, 0xf8, 0xe1, 0xc9, 0x1a, 0xfe, 0x20, 0xc0, 0x13, 0x18, 0xf9, 0xcd, 0x7, 
-0xf3, 0xaf, 0x21, 0x13, 0x0, 0x77, 0x23, 0x77, 0x1a, 0x2b, 0xd6, 0x30, 0xf8, 0xfe, 0xa, 0x38, 
-0x8, 0xd6, 0x7, 0xfe, 0xa, 0xf8, 0xfe, 0x10, 0xf0, 0x13, 0xed, 0x6f, 0x23, 0xed, 0x6f, 0x18, 
-0xe7, 0xc5, 0xcd, 0xe, 0xf3, 0x44, 0x4d, 0x6e, 0x3, 0xa, 0x67, 0xb5, 0xc1, 0xc9, 0xf5, 0x1f, 
-0x1f, 0x1f, 0x1f, 0xcd, 0x47, 0xf3, 0xf1, 0xf5, 0xe6, 0xf, 0xc6, 0x30, 0xfe, 0x3a, 0x38, 0x2, 
-0xc6, 0x7, 0xcd, 0x58, 0xf2, 0xf1, 0xc9, 0xf5, 0x7c, 0xcd, 0x3e, 0xf3, 0x7d, 0xcd, 0x3e, 0xf3, 
-0xf1, 0xc9, 0x2a, 0x1b, 0x0, 0xe7, 0x7, 0xe5, 0xe7, 0xe, 0x7e, 0xe7, 0x6, 0xcd, 0xf0, 0xf2, 
-0xed, 0x5b, 0x16, 0x0, 0x1a, 0x8, 0xe1, 0x2b, 0x23, 0xe5, 0xcd, 0x31, 0xf3, 0x28, 0xd, 0x7d, 
-0xe1, 0x77, 0xbe, 0x28, 0xf3, 0xe7, 0x2, 0x45, 0x52, 0xa0, 0x18, 0xd9, 0x1a, 0xfe, 0x20, 0x28, 
-0xee, 0xe1, 0x23, 0x22, 0x1d, 0x0, 0xfe, 0x3b, 0xc8, 0x8, 0xfe, 0x20, 0x28, 0xc7, 0x2b, 0xfe, 
-0x52, 0x20, 0xc2, 0x2b, 0x18, 0xbf, 0x2a, 0x1b, 0x0, 0xcd, 0xba, 0xf3, 0xeb, 0x2a, 0x1d, 0x0, 
-0xa7, 0xed, 0x52, 0xeb, 0xd8, 0xcd, 0xc0, 0xf3, 0x18, 0xf2, 0xed, 0x5b, 0x33, 0x0, 0x18, 0x3, 
-0x11, 0xe, 0x0, 0x6, 0x70, 0x10, 0xfe, 0xcd, 0x2e, 0xf4, 0x1b, 0x7b, 0xb2, 0x20, 0xf4, 0xe, 
-0x2, 0x6, 0x35, 0x10, 0xfe, 0xcd, 0x2e, 0xf4, 0xd, 0x11, 0x0, 0x0, 0x20, 0xf3, 0xd5, 0xdd, 
-0xe1, 0x6, 0x12, 0x10, 0xfe, 0xcd, 0xd, 0xf4, 0x6, 0xf, 0x10, 0xfe, 0xe, 0x10, 0x5e, 0x23, 
-0x56, 0xdd, 0x19, 0x23, 0xc5, 0xcd, 0xd, 0xf4, 0xc1, 0xd, 0x28, 0x6, 0x6, 0xe, 0x10, 0xfe, 
-0x18, 0xec, 0xdd, 0xe5, 0xd1, 0x6, 0x10, 0x10, 0xfe, 0xcd, 0xd, 0xf4, 0xc9, 0xe, 0x10, 0xcb, 
-0x3a, 0xcb, 0x1b, 0x30, 0x7, 0x6, 0x3, 0x10, 0xfe, 0x0, 0x18, 0x3, 0xcd, 0x2e, 0xf4, 0x6, 
-0x19, 0x10, 0xfe, 0xcd, 0x2e, 0xf4, 0xd, 0xc8, 0x6, 0x15, 0x10, 0xfe, 0x18, 0xe1, 0xdb, 0x2, 
-0xee, 0x80, 0xd3, 0x2, 0xc9, 0x2a, 0x1b, 0x0, 0xcd, 0x54, 0xf4, 0x28, 0xc, 0xcd, 0xe2, 0xf2, 
-0x43, 0x53, 0xbc, 0xcd, 0x57, 0xf3, 0xcd, 0xc, 0xf6, 0xeb, 0x2a, 0x1d, 0x0, 0xa7, 0xed, 0x52, 
-0xeb, 0xd8, 0x18, 0xe4, 0xcd, 0xf9, 0xf4, 0xcd, 0x3, 0xf5, 0xe, 0x7, 0x11, 0x10, 0x9, 0x3e, 
-0x7, 0x3d, 0x20, 0xfd, 0xcd, 0xf9, 0xf4, 0xcd, 0xf9, 0xf4, 0x20, 0xe8, 0x15, 0x20, 0xf8, 0xd, 
-0x28, 0xc, 0xdb, 0x2, 0xa8, 0xcb, 0x77, 0x20, 0xe3, 0x1d, 0x20, 0xf6, 0x18, 0xd6, 0xcd, 0x3, 
-0xf5, 0x3e, 0x44, 0x3d, 0x20, 0xfd, 0xcd, 0xf9, 0xf4, 0x20, 0xf3, 0xcd, 0x3, 0xf5, 0x3e, 0x1e, 
-0x3d, 0x20, 0xfd, 0xcd, 0xda, 0xf4, 0xe, 0x10, 0xd5, 0xdd, 0xe1, 0x3e, 0x1a, 0x3d, 0x20, 0xfd, 
-0xcd, 0xda, 0xf4, 0xdd, 0x19, 0xc5, 0x4d, 0x44, 0x2a, 0x1d, 0x0, 0xaf, 0xed, 0x42, 0x69, 0x60, 
-0xc1, 0x38, 0x5, 0x73, 0x23, 0x72, 0x18, 0x6, 0x3e, 0x1, 0x3d, 0x20, 0xfd, 0x23, 0x23, 0xd, 
-0x28, 0x7, 0x3e, 0x12, 0x3d, 0x20, 0xfd, 0x18, 0xd7, 0x3e, 0x12, 0x3d, 0x20, 0xfd, 0xcd, 0xda, 
-0xf4, 0xeb, 0xdd, 0xe5, 0xc1, 0xaf, 0xed, 0x42, 0xeb, 0xc9, 0xe5, 0x2e, 0x10, 0xcd, 0xf9, 0xf4, 
-0x20, 0x3, 0xaf, 0x18, 0x1, 0x37, 0xcb, 0x1a, 0xcb, 0x1b, 0xcd, 0x3, 0xf5, 0x2d, 0x28, 0x7, 
-0x3e, 0x1e, 0x3d, 0x20, 0xfd, 0x18, 0xe6, 0xe1, 0xc9, 0xdb, 0x2, 0xa8, 0xcb, 0x77, 0xf5, 0xa8, 
-0x47, 0xf1, 0xc9, 0xdb, 0x2, 0xa8, 0xcb, 0x77, 0x28, 0xf9, 0xc9, 0x2a, 0x1b, 0x0, 0xed, 0x5b, 
-0x1d, 0x0, 0x37, 0xe5, 0xed, 0x52, 0xe1, 0xd0, 0xe7, 0x7, 0x1, 0x0, 0x8, 0x1e, 0x0, 0xe7, 
-0x2, 0xa0, 0x7e, 0xe7, 0x6, 0x81, 0x4f, 0x30, 0x4, 0x3e, 0x0, 0x8b, 0x5f, 0x23, 0x10, 0xef, 
-0xe7, 0x2, 0xa0, 0x7b, 0xcd, 0x47, 0xf3, 0x79, 0xe7, 0x6, 0x18, 0xd2, 0x2a, 0x1b, 0x0, 0xed, 
-0x5b, 0x1d, 0x0, 0xed, 0x4b, 0x23, 0x0, 0xc9, 0xcd, 0x3c, 0xf5, 0x71, 0xe5, 0xaf, 0xeb, 0xed, 
-0x52, 0x44, 0x4d, 0xe1, 0x54, 0x5d, 0x13, 0xed, 0xb0, 0xc9, 0xcd, 0x3c, 0xf5, 0xaf, 0xe5, 0xed, 
-0x52, 0xe1, 0x38, 0x3, 0xed, 0xb0, 0xc9, 0x9, 0xeb, 0x9, 0xeb, 0x2b, 0x1b, 0xed, 0xb8, 0xc9, 
-0xed, 0x73, 0x13, 0x0, 0x31, 0x61, 0x0, 0xdd, 0xe5, 0xfd, 0xe5, 0xf5, 0xc5, 0xd5, 0xe5, 0xd9, 
-0x8, 0xf5, 0xc5, 0xd5, 0xe5, 0x18, 0x15, 0xed, 0x73, 0x13, 0x0, 0x31, 0x4d, 0x0, 0xe1, 0xd1, 
-0xc1, 0xf1, 0xd9, 0x8, 0xe1, 0xd1, 0xc1, 0xf1, 0xfd, 0xe1, 0xdd, 0xe1, 0xed, 0x7b, 0x13, 0x0, 
-0xc9, 0xcd, 0x70, 0xf5, 0xe1, 0xed, 0x73, 0x63, 0x0, 0x31, 0xb0, 0x0, 0x2b, 0x2b, 0x2b, 0x22, 
-0x61, 0x0, 0xed, 0x5b, 0xb, 0x0, 0x21, 0xd, 0x0, 0x1, 0x3, 0x0, 0xed, 0xb0, 0xcd, 0x21, 
-0xf6, 0xc3, 0x59, 0xf0, 0x2a, 0x1b, 0x0, 0x22, 0xb, 0x0, 0x11, 0xd, 0x0, 0x1, 0x3, 0x0, 
-0xed, 0xb0, 0xcd, 0x21, 0xf6, 0xc9, 0x2a, 0xb, 0x0, 0x36, 0xcd, 0x23, 0x11, 0xa1, 0xf5, 0x73, 
-0x23, 0x72, 0x2a, 0x1b, 0x0, 0x22, 0x61, 0x0, 0xed, 0x7b, 0x63, 0x0, 0xe5, 0xc3, 0x87, 0xf5, 
-0x2a, 0x61, 0x0, 0x22, 0x1b, 0x0, 0xed, 0x5b, 0xb, 0x0, 0xaf, 0xed, 0x52, 0x20, 0xd7, 0x18, 
-0xe1, 0xe7, 0x2, 0xba, 0x7e, 0xe7, 0x6, 0x2b, 0x7e, 0xe7, 0x6, 0x2b, 0xe7, 0x2, 0xa0, 0xc9, 
-0xe7, 0x2, 0x31, 0xa0, 0xc9, 0x20, 0xf9, 0xe7, 0x2, 0x30, 0xa0, 0xc9, 0xfe, 0x3a, 0xc2, 0x97, 
-0xf6, 0xe7, 0x2, 0xd, 0x42, 0xd0, 0x21, 0xc, 0x0, 0xe7, 0xd, 0xe7, 0x2, 0x42, 0x53, 0xba, 
-0x6, 0x3, 0x21, 0xd, 0x0, 0x7e, 0xe7, 0x6, 0x23, 0x10, 0xfa, 0xe7, 0x2, 0x20, 0x20, 0x20, 
-0x53, 0x20, 0x5a, 0x20, 0x43, 0xa0, 0x3a, 0x5b, 0x0, 0x6f, 0xcb, 0x7d, 0xcd, 0x15, 0xf6, 0xcb, 
-0x75, 0xcd, 0x15, 0xf6, 0xcb, 0x45, 0xcd, 0x15, 0xf6, 0x21, 0x64, 0x0, 0x6, 0x2, 0xe7, 0x2, 
-0x53, 0xd0, 0xe7, 0xd, 0xe7, 0x2, 0x50, 0xc3, 0xe7, 0xd, 0xe7, 0x2, 0x49, 0xd8, 0xe7, 0xd, 
-0xe7, 0x2, 0x49, 0xd9, 0xe7, 0xd, 0xe7, 0x2, 0x41, 0xc6, 0xe7, 0xd, 0xe7, 0x2, 0x42, 0xc3, 
-0xe7, 0xd, 0xe7, 0x2, 0x44, 0xc5, 0xe7, 0xd, 0xe7, 0x2, 0x48, 0xcc, 0xe7, 0xd, 0x10, 0xe6, 
-0x2a, 0x2b, 0x0, 0x2b, 0x36, 0x27, 0xc9, 0x1, 0x0, 0x4, 0x2a, 0x16, 0x0, 0x23, 0x23, 0x11, 
-0x60, 0xf6, 0x1a, 0xbe, 0x28, 0x17, 0x13, 0xe5, 0x21, 0x5, 0x0, 0x19, 0xeb, 0xe1, 0xc, 0x10, 
-0xf1, 0x6, 0x4, 0x79, 0xfe, 0x8, 0x20, 0xea, 0xf1, 0xff, 0x2b, 0x18, 0xea, 0x13, 0x23, 0x1a, 
-0xe6, 0x7f, 0xbe, 0x20, 0xf5, 0x23, 0x7e, 0xfe, 0x27, 0x79, 0x20, 0x2, 0xc6, 0x4, 0xcb, 0x27, 
-0x4f, 0x6, 0x0, 0x21, 0x64, 0x0, 0xed, 0x42, 0x44, 0x4d, 0xe7, 0xc, 0xcd, 0xf0, 0xf2, 0xed, 
-0x5b, 0x16, 0x0, 0xcd, 0x31, 0xf3, 0x20, 0x4, 0x1a, 0xfe, 0x3b, 0xc8, 0xeb, 0xc5, 0xe1, 0x72, 
-0x2b, 0x73, 0xc3, 0x21, 0xf6, 0xcd, 0x11, 0xf7, 0x38, 0x4c, 0x22, 0x35, 0x0, 0xed, 0x43, 0x3b, 
-0x0, 0x2a, 0x1d, 0x0, 0x22, 0x3d, 0x0, 0x2a, 0x2b, 0x0, 0x36, 0x20, 0xed, 0x43, 0x2b, 0x0, 
-0xc9, 0x3a, 0x1c, 0x0, 0xfe, 0xec, 0xd8, 0x3a, 0x1b, 0x0, 0xe6, 0xe0, 0x32, 0x1b, 0x0, 0x3a, 
-0x1d, 0x0, 0xe6, 0xe0, 0x32, 0x1d, 0x0, 0x2a, 0x1d, 0x0, 0xed, 0x4b, 0x1b, 0x0, 0xed, 0x42, 
-0xd8, 0x28, 0x11, 0x2b, 0x3e, 0x3, 0xbc, 0xd8, 0x23, 0x11, 0x40, 0x0, 0xed, 0x52, 0xd8, 0x11, 
-0x20, 0x0, 0x19, 0xc9, 0x37, 0xc9, 0xf1, 0xff, 0xfe, 0x97, 0xdf, 0x3e, 0xf7, 0xed, 0x47, 0xf3, 
-0x21, 0x48, 0xf7, 0x1, 0x3, 0x3, 0xed, 0xb3, 0x2a, 0xb, 0x0, 0x2b, 0x7e, 0x32, 0x69, 0x0, 
-0x36, 0xfb, 0xed, 0x73, 0x6a, 0x0, 0xed, 0x7b, 0x63, 0x0, 0xe5, 0xc3, 0x87, 0xf5, 0xf3, 0xcd, 
-0x70, 0xf5, 0x3e, 0x7, 0xd3, 0x3, 0x2a, 0xb, 0x0, 0x2b, 0x3a, 0x69, 0x0, 0x77, 0xe1, 0x22, 
-0xb, 0x0, 0x22, 0x61, 0x0, 0xed, 0x73, 0x63, 0x0, 0xed, 0x7b, 0x6a, 0x0, 0x11, 0xd, 0x0, 
-0x1, 0x3, 0x0, 0xed, 0xb0, 0x21, 0x21, 0xf6, 0xe5, 0xed, 0x4d, 0xcd, 0x3c, 0xf5, 0x1a, 0xbe, 
-0x20, 0x8, 0xb, 0x23, 0x13, 0x78, 0xb1, 0xc8, 0x18, 0xf4, 0xe7, 0x7, 0xe7, 0xe, 0x7e, 0xe7, 
-0x6, 0xe7, 0xe, 0xeb, 0xe7, 0x7, 0xe7, 0xe, 0xeb, 0x1a, 0xe7, 0x6, 0xe7, 0x2, 0x8d, 0xe7, 
-0x1, 0xfe, 0xd, 0xc0, 0x18, 0xdc, 0x31, 0x51, 0x41, 0x59, 0x32, 0x57, 0x53, 0x58, 0x33, 0x45, 
-0x44, 0x43, 0x34, 0x52, 0x46, 0x56, 0x35, 0x54, 0x47, 0x42, 0x36, 0x5a, 0x48, 0x4e, 0x37, 0x55, 
-0x4a, 0x4d, 0x38, 0x49, 0x4b, 0x2c, 0x39, 0x4f, 0x4c, 0x2e, 0x30, 0x50, 0x2b, 0x2f, 0x2d, 0x40, 
-0x2a, 0x5e, 0x5b, 0x5d, 0x5c, 0x5f, 0x0, 0xd, 0x8, 0x9, 0x20, 0x0, 0xb, 0xa, 0x6e, 0xf7, 
-
-};
-unsigned char dump_kc_basic[10783] = {
-0x0, 0x1, 0xff, 0x2a, 0x0, 0x3, 0xc0, 0x96, 0x44, 0x75, 0x63, 0x68, 0x43, 0xd3, 0xd3, 0xd3, 
-0x4b, 0x43, 0x2d, 0x42, 0x41, 0x53, 0x49, 0x43, 0x20, 0x6d, 0x2b, 0x20, 0x20, 0x20, 0x20, 0x20, 
-0xcb, 0x7b, 0x28, 0xa, 0xcd, 0x13, 0x1, 0xb7, 0x28, 0x7, 0xcb, 0xbb, 0x18, 0x3, 0xcd, 0x24, 
-0x1, 0x57, 0xc9, 0xc5, 0xd5, 0xaf, 0x32, 0x4, 0x0, 0xe7, 0x4, 0xb7, 0x28, 0x3, 0xcd, 0x26, 
-0x1, 0xd1, 0xc1, 0xc9, 0xe7, 0x1, 0xfe, 0x17, 0xd0, 0xfe, 0x13, 0xc8, 0xfe, 0x1, 0x28, 0xd, 
-0xfe, 0x5, 0x28, 0xb, 0xfe, 0x10, 0x28, 0x9, 0xfe, 0x12, 0xd8, 0xd6, 0x10, 0xc6, 0x5, 0xc6, 
-0x4, 0xc6, 0xf, 0xc9, 0xcd, 0xf5, 0x2a, 0x3e, 0x4e, 0xcd, 0xf1, 0xff, 0x18, 0xc, 0xcd, 0xf5, 
-0x2a, 0x2a, 0xd7, 0x2b, 0x22, 0x1d, 0x0, 0xcd, 0xf4, 0xff, 0x2a, 0x2b, 0x0, 0x1, 0x0, 0xec, 
-0xaf, 0xed, 0x42, 0x47, 0x11, 0x20, 0x0, 0xed, 0x52, 0x4, 0x30, 0xfb, 0x85, 0x83, 0x3c, 0x4f, 
-0xed, 0x43, 0x70, 0x0, 0xd9, 0xc9, 0x0, 0x0, 0x0, 0xcd, 0xe1, 0x10, 0xe5, 0x11, 0xf3, 0x10, 
-0xd5, 0xcd, 0x24, 0x17, 0xa7, 0x28, 0x15, 0xfe, 0x3, 0x30, 0x11, 0xf5, 0xcd, 0xbb, 0xff, 0x38, 
-0xa, 0xf1, 0xfe, 0x1, 0x28, 0x1, 0x48, 0x79, 0xc3, 0xc0, 0x13, 0xf1, 0xc3, 0x48, 0x6, 0xf3, 
-0xaf, 0x32, 0x2f, 0x0, 0xcd, 0xe6, 0x1, 0xed, 0xa1, 0xea, 0xa4, 0x1, 0xcd, 0xde, 0x1, 0x3a, 
-0x7b, 0x0, 0xcd, 0xcd, 0x1, 0x2a, 0x2d, 0x0, 0x6, 0x80, 0x7e, 0xcd, 0xcd, 0x1, 0x3a, 0x2f, 
-0x0, 0x86, 0x32, 0x2f, 0x0, 0x23, 0x10, 0xf2, 0xcd, 0xcd, 0x1, 0xfb, 0xc9, 0xc5, 0x4f, 0x6, 
-0x8, 0xcb, 0x9, 0xf5, 0xdc, 0xe6, 0x1, 0xf1, 0xd4, 0xe2, 0x1, 0x10, 0xf4, 0xc1, 0x1e, 0x7b, 
-0x18, 0x6, 0x1e, 0x18, 0x18, 0x2, 0x1e, 0x36, 0xd5, 0x3e, 0x80, 0xd3, 0x2, 0xcd, 0xf8, 0x1, 
-0xd1, 0xaf, 0xd3, 0x2, 0xcd, 0xf8, 0x1, 0xc9, 0x1d, 0x20, 0xfd, 0xc9, 0xf3, 0x21, 0x7b, 0x0, 
-0x6, 0x16, 0xcd, 0x42, 0x2, 0xfe, 0xdc, 0x38, 0xf7, 0x10, 0xf7, 0x6, 0x2, 0xe, 0x13, 0xcd, 
-0x47, 0x2, 0x38, 0xf7, 0x10, 0xf7, 0xcd, 0x36, 0x2, 0x2a, 0x2d, 0x0, 0x6, 0x80, 0x1e, 0x0, 
-0xcd, 0x36, 0x2, 0xd8, 0x7b, 0x86, 0x23, 0x5f, 0x10, 0xf6, 0x21, 0x2f, 0x0, 0xcd, 0x36, 0x2, 
-0xd8, 0x7b, 0xbe, 0xc8, 0x37, 0xc9, 0x16, 0x9, 0x3f, 0xcb, 0x1e, 0xcd, 0x42, 0x2, 0x15, 0x20, 
-0xf7, 0xc9, 0xe, 0x12, 0xcd, 0x47, 0x2, 0x3e, 0x18, 0x3d, 0x20, 0xfd, 0x8, 0xd5, 0x2f, 0x57, 
-0xd, 0xdb, 0x2, 0xaa, 0xe6, 0x40, 0x28, 0xf8, 0x7a, 0x8, 0x79, 0xfe, 0x30, 0xd1, 0xc9, 0x28, 
-0x63, 0x29, 0x6d, 0x61, 0x69, 0x6e, 0xf5, 0xf1, 0xcd, 0xfc, 0x1, 0xf5, 0xe5, 0x21, 0x7c, 0x0, 
-0x3a, 0x7b, 0x0, 0xbe, 0xe1, 0x38, 0xf0, 0x20, 0x4, 0xf1, 0x38, 0xa, 0xc9, 0x21, 0xe7, 0x2a, 
-0xf1, 0xcd, 0xd2, 0x2a, 0x37, 0xc9, 0x21, 0xdc, 0x2a, 0x18, 0xf6, 0xcd, 0xbe, 0xb, 0x20, 0xc, 
-0xcd, 0xf3, 0x20, 0xfe, 0x3, 0x28, 0x4, 0xfe, 0x1e, 0x20, 0xf5, 0xc9, 0xcd, 0x5e, 0xc, 0xe5, 
-0x21, 0x1, 0x0, 0xdd, 0x21, 0xe6, 0x2a, 0x3e, 0x4, 0xe, 0x84, 0x6, 0xa, 0xdd, 0x86, 0x0, 
-0x10, 0xfb, 0xd, 0x20, 0xf6, 0x3d, 0x20, 0xf1, 0xa7, 0xeb, 0xed, 0x52, 0xeb, 0x28, 0x10, 0xd5, 
-0xcd, 0xf3, 0x20, 0xfe, 0x1e, 0x28, 0x7, 0xfe, 0x3, 0x28, 0x3, 0xd1, 0x18, 0xd5, 0xd1, 0xe1, 
-0xc9, 0xcd, 0xbe, 0xb, 0x20, 0xf, 0xe5, 0x2a, 0x6e, 0x0, 0x22, 0x8, 0x0, 0x22, 0x9, 0x0, 
-0xcd, 0xeb, 0x2, 0xe1, 0xc9, 0xcd, 0xbd, 0xb, 0xc8, 0x18, 0xfa, 0xc5, 0xd5, 0xed, 0x4b, 0x9, 
-0x0, 0xed, 0x5b, 0x8, 0x0, 0xcd, 0xe8, 0x1, 0xdd, 0xbe, 0x0, 0x10, 0xf4, 0xd1, 0xc1, 0xc9, 
-0x18, 0x3, 0xc3, 0x8c, 0x3, 0xcd, 0x32, 0x26, 0x3e, 0x40, 0x32, 0x6e, 0x0, 0x21, 0xbd, 0x3, 
-0x11, 0x0, 0x2b, 0x1, 0x67, 0x0, 0xed, 0xb0, 0xeb, 0xf9, 0xcd, 0x69, 0x9, 0x32, 0xab, 0x2b, 
-0x32, 0x0, 0x2c, 0x21, 0x92, 0x3, 0xcd, 0xc9, 0x14, 0x21, 0xae, 0x3, 0xcd, 0xc9, 0x14, 0xcd, 
-0xae, 0x8, 0x21, 0x62, 0x2b, 0xcd, 0x86, 0xc, 0x7a, 0xd6, 0x2e, 0x21, 0x0, 0x2b, 0x2b, 0x30, 
-0x3, 0x11, 0xff, 0xe7, 0x23, 0xcd, 0x89, 0x9, 0x28, 0x9, 0x7e, 0x47, 0x2f, 0x77, 0xbe, 0x70, 
-0x28, 0xf2, 0x2b, 0x11, 0x0, 0xff, 0x22, 0xb0, 0x2b, 0x19, 0x22, 0x56, 0x2b, 0xcd, 0x41, 0x9, 
-0x2a, 0x56, 0x2b, 0x11, 0xef, 0xd3, 0x19, 0xcd, 0x29, 0x1b, 0x21, 0xa0, 0x3, 0xcd, 0xc9, 0x14, 
-0x2a, 0x4, 0x23, 0x7e, 0xfe, 0x78, 0x20, 0x1, 0x3e, 0xaf, 0x32, 0xfc, 0x2b, 0x31, 0x67, 0x2b, 
-0x18, 0xa, 0x7f, 0x7f, 0x52, 0x45, 0x42, 0x41, 0x53, 0x49, 0x43, 0x0, 0xcd, 0x69, 0x9, 0xc3, 
-0x88, 0x6, 0xc, 0xa, 0xd, 0x48, 0x43, 0x2d, 0x42, 0x41, 0x53, 0x49, 0x43, 0xa, 0xd, 0x0, 
-0x20, 0x42, 0x59, 0x54, 0x45, 0x53, 0x20, 0x46, 0x52, 0x45, 0x45, 0xa, 0xd, 0x0, 0x4d, 0x45, 
-0x4d, 0x4f, 0x52, 0x59, 0x20, 0x53, 0x49, 0x5a, 0x45, 0x3f, 0x20, 0x3a, 0x0, 0xc3, 0x89, 0x3, 
-0xc3, 0x67, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x6f, 0x7c, 0xde, 0x0, 0x67, 0x78, 
-0xde, 0x0, 0x47, 0x3e, 0x0, 0xc9, 0x0, 0x0, 0x0, 0x35, 0x4a, 0xca, 0x99, 0x39, 0x1c, 0x76, 
-0x98, 0x22, 0x95, 0xb3, 0x98, 0xa, 0xdd, 0x47, 0x98, 0x53, 0xd1, 0x99, 0x99, 0xa, 0x1a, 0x9f, 
-0x98, 0x65, 0xbc, 0xcd, 0x98, 0xd6, 0x77, 0x3e, 0x98, 0x52, 0xc7, 0x4f, 0x80, 0xb, 0xff, 0x1b, 
-0x0, 0xa, 0x0, 0xa, 0x0, 0x0, 0x0, 0xc3, 0xae, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x65, 0x2c, 0xfe, 0xff, 0x0, 0x0, 0xc9, 0x0, 0x0, 0x1, 0x2c, 0x0, 0x0, 
-0x0, 0xc5, 0x4e, 0x44, 0xc6, 0x4f, 0x52, 0xce, 0x45, 0x58, 0x54, 0xc4, 0x41, 0x54, 0x41, 0xc9, 
-0x4e, 0x50, 0x55, 0x54, 0xc4, 0x49, 0x4d, 0xd2, 0x45, 0x41, 0x44, 0xcc, 0x45, 0x54, 0xc7, 0x4f, 
-0x54, 0x4f, 0xd2, 0x55, 0x4e, 0xc9, 0x46, 0xd2, 0x45, 0x53, 0x54, 0x4f, 0x52, 0x45, 0xc7, 0x4f, 
-0x53, 0x55, 0x42, 0xd2, 0x45, 0x54, 0x55, 0x52, 0x4e, 0xd2, 0x45, 0x4d, 0xd3, 0x54, 0x4f, 0x50, 
-0xcf, 0x55, 0x54, 0xcf, 0x4e, 0xce, 0x55, 0x4c, 0x4c, 0xd7, 0x41, 0x49, 0x54, 0xc4, 0x45, 0x46, 
-0xd0, 0x4f, 0x4b, 0x45, 0xc4, 0x4f, 0x4b, 0x45, 0xc1, 0x55, 0x54, 0x4f, 0xcc, 0x49, 0x4e, 0x45, 
-0x53, 0xc3, 0x4c, 0x53, 0xd7, 0x49, 0x44, 0x54, 0x48, 0xc2, 0x59, 0x45, 0xa1, 0xc3, 0x41, 0x4c, 
-0x4c, 0xd0, 0x52, 0x49, 0x4e, 0x54, 0xc3, 0x4f, 0x4e, 0x54, 0xcc, 0x49, 0x53, 0x54, 0xc3, 0x4c, 
-0x45, 0x41, 0x52, 0xc3, 0x4c, 0x4f, 0x41, 0x44, 0xc3, 0x53, 0x41, 0x56, 0x45, 0xce, 0x45, 0x57, 
-0xd4, 0x41, 0x42, 0x28, 0xd4, 0x4f, 0xc6, 0x4e, 0xd3, 0x50, 0x43, 0x28, 0xd4, 0x48, 0x45, 0x4e, 
-0xce, 0x4f, 0x54, 0xd3, 0x54, 0x45, 0x50, 0xab, 0xad, 0xaa, 0xaf, 0xde, 0xc1, 0x4e, 0x44, 0xcf, 
-0x52, 0xbe, 0xbd, 0xbc, 0xd3, 0x47, 0x4e, 0xc9, 0x4e, 0x54, 0xc1, 0x42, 0x53, 0xd5, 0x53, 0x52, 
-0xc6, 0x52, 0x45, 0xc9, 0x4e, 0x50, 0xd0, 0x4f, 0x53, 0xd3, 0x51, 0x52, 0xd2, 0x4e, 0x44, 0xcc, 
-0x4e, 0xc5, 0x58, 0x50, 0xc3, 0x4f, 0x53, 0xd3, 0x49, 0x4e, 0xd4, 0x41, 0x4e, 0xc1, 0x54, 0x4e, 
-0xd0, 0x45, 0x45, 0x4b, 0xc4, 0x45, 0x45, 0x4b, 0xd0, 0x49, 0xcc, 0x45, 0x4e, 0xd3, 0x54, 0x52, 
-0x24, 0xd6, 0x41, 0x4c, 0xc1, 0x53, 0x43, 0xc3, 0x48, 0x52, 0x24, 0xcc, 0x45, 0x46, 0x54, 0x24, 
-0xd2, 0x49, 0x47, 0x48, 0x54, 0x24, 0xcd, 0x49, 0x44, 0x24, 0xcc, 0x4f, 0x41, 0x44, 0xd4, 0x52, 
-0x4f, 0x4e, 0xd4, 0x52, 0x4f, 0x46, 0x46, 0xc5, 0x44, 0x49, 0x54, 0xc5, 0x4c, 0x53, 0x45, 0x80, 
-0x1a, 0xc, 0xde, 0xa, 0xdc, 0xf, 0x48, 0xd, 0xec, 0xe, 0x1, 0x12, 0x1f, 0xf, 0x5d, 0xd, 
-0x7, 0xd, 0xeb, 0xc, 0xcf, 0xd, 0xdf, 0xb, 0xf6, 0xc, 0x25, 0xd, 0x4a, 0xd, 0x18, 0xc, 
-0xec, 0x16, 0xb3, 0xd, 0xc0, 0xe, 0xf7, 0x16, 0xc4, 0x13, 0x37, 0x17, 0x4e, 0x17, 0xfa, 0x8, 
-0xea, 0x9, 0xd0, 0x20, 0xb9, 0xe, 0xf4, 0x22, 0x4a, 0xd, 0x38, 0x1e, 0xfa, 0xd, 0x48, 0xc, 
-0xf2, 0x9, 0xaa, 0xc, 0x43, 0x1f, 0x41, 0x20, 0x40, 0x9, 0x2d, 0x9, 0xb7, 0xa, 0xb8, 0xa, 
-0xe7, 0x6, 0x4a, 0xd, 0xa6, 0x19, 0x70, 0x1a, 0xbc, 0x19, 0x3, 0x2b, 0x90, 0x13, 0xe3, 0x16, 
-0xbd, 0x13, 0x1f, 0x1c, 0xfd, 0x1c, 0x59, 0x18, 0x6d, 0x1c, 0x70, 0x1d, 0x76, 0x1d, 0xd7, 0x1d, 
-0xec, 0x1d, 0x31, 0x17, 0x44, 0x17, 0xd5, 0x19, 0x2c, 0x16, 0x56, 0x14, 0xbf, 0x16, 0x3b, 0x16, 
-0x4b, 0x16, 0x5b, 0x16, 0x89, 0x16, 0x92, 0x16, 0x79, 0x11, 0x1b, 0x79, 0x6a, 0x17, 0x7c, 0x98, 
-0x18, 0x7c, 0xf3, 0x18, 0x7f, 0x28, 0x1c, 0x50, 0x5e, 0x11, 0x46, 0x5d, 0x11, 0x4e, 0x46, 0x53, 
-0x4e, 0x52, 0x47, 0x4f, 0x44, 0x46, 0x43, 0x4f, 0x56, 0x4f, 0x4d, 0x55, 0x4c, 0x42, 0x53, 0x44, 
-0x44, 0x2f, 0x30, 0x49, 0x44, 0x54, 0x4d, 0x4f, 0x53, 0x4c, 0x53, 0x53, 0x54, 0x43, 0x4e, 0x55, 
-0x46, 0x4d, 0x4f, 0x49, 0x4f, 0x20, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x7, 0x0, 0x20, 0x49, 0x4e, 
-0x20, 0x0, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x46, 0x4f, 0x55, 0x4e, 0x44, 0xd, 0x4f, 0x4b, 0xd, 
-0x0, 0x42, 0x52, 0x45, 0x41, 0x4b, 0x0, 0xe5, 0x2a, 0xdb, 0x2b, 0x6, 0x0, 0x9, 0x9, 0x3e, 
-0xe5, 0x3e, 0xd0, 0x95, 0x6f, 0x3e, 0xff, 0x9c, 0x38, 0x4, 0x67, 0x39, 0xe1, 0xd8, 0x1e, 0xc, 
-0x18, 0x14, 0x2a, 0xca, 0x2b, 0x22, 0x58, 0x2b, 0x1e, 0x2, 0x1, 0x1e, 0x14, 0x1, 0x1e, 0x0, 
-0x1, 0x1e, 0x12, 0x1, 0x1e, 0x22, 0xcd, 0x69, 0x9, 0x32, 0x43, 0x2b, 0xcd, 0x55, 0xe, 0x21, 
-0xdd, 0x5, 0x57, 0x19, 0x44, 0x4d, 0xb, 0x3e, 0x3f, 0x1e, 0x3, 0xcd, 0xd6, 0x14, 0x21, 0x5, 
-0x6, 0xcd, 0xc9, 0x14, 0x2a, 0x58, 0x2b, 0x11, 0xfe, 0xff, 0xcd, 0x89, 0x9, 0xca, 0xd, 0x3, 
-0x7c, 0xa5, 0x3c, 0xc4, 0x21, 0x1b, 0x3e, 0xc1, 0xaf, 0x32, 0x43, 0x2b, 0xcd, 0x55, 0xe, 0x21, 
-0x1d, 0x6, 0xcd, 0xc9, 0x14, 0x37, 0xdc, 0xfd, 0x20, 0xcd, 0xdf, 0x9, 0x2b, 0x22, 0x58, 0x2b, 
-0x21, 0xea, 0x2b, 0x3a, 0x4d, 0x2b, 0xb7, 0x28, 0x6b, 0xed, 0x5b, 0x4e, 0x2b, 0xf2, 0xf0, 0x6, 
-0xd5, 0xcd, 0x2a, 0x1b, 0xd1, 0xd5, 0xcd, 0xbb, 0x7, 0x3e, 0x2a, 0x38, 0x2, 0x3e, 0x20, 0xcd, 
-0xae, 0x9, 0xcd, 0xae, 0x8, 0xd1, 0x30, 0x6, 0xaf, 0x32, 0x4d, 0x2b, 0x18, 0xba, 0x2a, 0x50, 
-0x2b, 0x19, 0x38, 0xf4, 0xd5, 0x11, 0xf9, 0xff, 0xcd, 0x89, 0x9, 0xd1, 0x30, 0xea, 0x22, 0x4e, 
-0x2b, 0x21, 0x62, 0x2b, 0xf5, 0x18, 0x47, 0xc8, 0xcd, 0x97, 0x9, 0xcd, 0x86, 0xc, 0xc0, 0xc1, 
-0xcd, 0xbb, 0x7, 0x30, 0x58, 0xd5, 0x7e, 0x23, 0xb6, 0x23, 0x28, 0x2, 0x3e, 0x7f, 0x32, 0x4d, 
-0x2b, 0x7e, 0x23, 0x66, 0x6f, 0x22, 0x4e, 0x2b, 0xcd, 0x98, 0x21, 0xd1, 0xc2, 0x96, 0x6, 0x38, 
-0xb7, 0x3f, 0x18, 0xcd, 0x3e, 0x3e, 0xcd, 0xae, 0x9, 0xcd, 0xae, 0x8, 0xda, 0x96, 0x6, 0x21, 
-0x61, 0x2b, 0xcd, 0xbd, 0xb, 0x3c, 0x3d, 0xca, 0x96, 0x6, 0xf5, 0xcd, 0x86, 0xc, 0xd5, 0xcd, 
-0xda, 0x7, 0x47, 0xd1, 0xf1, 0xd2, 0x8a, 0xb, 0xd5, 0xc5, 0xaf, 0x32, 0xcd, 0x2b, 0xcd, 0xbd, 
-0xb, 0xb7, 0xf5, 0xcd, 0xbb, 0x7, 0x38, 0x8, 0xf1, 0xf5, 0xb7, 0x20, 0x3, 0xc3, 0x20, 0xd, 
-0xc5, 0x30, 0x11, 0xeb, 0x2a, 0xd7, 0x2b, 0x1a, 0x2, 0x3, 0x13, 0xcd, 0x89, 0x9, 0x20, 0xf7, 
-0xed, 0x43, 0xd7, 0x2b, 0xd1, 0xf1, 0x28, 0x22, 0x2a, 0xd7, 0x2b, 0xe3, 0xc1, 0x9, 0xe5, 0xcd, 
-0xab, 0x7, 0xe1, 0x22, 0xd7, 0x2b, 0xeb, 0x36, 0xff, 0xd1, 0x23, 0x23, 0x73, 0x23, 0x72, 0x23, 
-0x11, 0x62, 0x2b, 0x1a, 0x77, 0x23, 0x13, 0xb7, 0x20, 0xf9, 0xcd, 0x4f, 0x9, 0x23, 0xeb, 0x21, 
-0x96, 0x6, 0xe5, 0x62, 0x6b, 0x7e, 0x23, 0xb6, 0xc8, 0x23, 0x7e, 0x23, 0xa6, 0x3c, 0xc8, 0x23, 
-0xaf, 0xbe, 0x23, 0x20, 0xfc, 0xeb, 0x73, 0x23, 0x72, 0x18, 0xe8, 0xcd, 0x30, 0x6, 0xc5, 0xe3, 
-0xc1, 0xcd, 0x89, 0x9, 0x7e, 0x2, 0xc8, 0xb, 0x2b, 0x18, 0xf6, 0x2a, 0x5f, 0x2b, 0x44, 0x4d, 
-0x7e, 0x23, 0xb6, 0x2b, 0xc8, 0x23, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0xcd, 0x89, 0x9, 0x60, 0x69, 
-0x7e, 0x23, 0x66, 0x6f, 0x3f, 0xc8, 0x3f, 0xd0, 0x18, 0xe4, 0xaf, 0x32, 0xaf, 0x2b, 0xe, 0x5, 
-0x11, 0x62, 0x2b, 0xaf, 0x32, 0xfb, 0x2b, 0x7e, 0xfe, 0x20, 0xca, 0x71, 0x8, 0x47, 0xfe, 0x22, 
-0xca, 0x91, 0x8, 0xb7, 0xca, 0x97, 0x8, 0x3a, 0xaf, 0x2b, 0xb7, 0x7e, 0x20, 0x73, 0xfe, 0x3f, 
-0x3e, 0x9e, 0x28, 0x6d, 0x7e, 0xfe, 0x30, 0x38, 0x4, 0xfe, 0x3c, 0x38, 0x64, 0xd5, 0x11, 0x20, 
-0x4, 0xc5, 0x1, 0x6d, 0x8, 0xc5, 0x6, 0x7f, 0x7e, 0xfe, 0x61, 0x38, 0x7, 0xfe, 0x7b, 0x30, 
-0x3, 0xe6, 0x5f, 0x77, 0x4e, 0xeb, 0x23, 0xb6, 0xf2, 0x26, 0x8, 0x4, 0x7e, 0xe6, 0x7f, 0x20, 
-0x15, 0x3a, 0xfc, 0x2b, 0xa7, 0xc8, 0x3a, 0xfb, 0x2b, 0xa7, 0xc0, 0x3c, 0x32, 0xfb, 0x2b, 0x2a, 
-0xc, 0x23, 0x7e, 0xe6, 0x7f, 0xc8, 0xb9, 0x20, 0xdd, 0xeb, 0xe5, 0x13, 0x1a, 0xb7, 0xfa, 0x69, 
-0x8, 0x4f, 0x78, 0xfe, 0x88, 0x20, 0x4, 0xcd, 0xbd, 0xb, 0x2b, 0x23, 0x7e, 0xfe, 0x61, 0x38, 
-0x2, 0xe6, 0x5f, 0xb9, 0x28, 0xe5, 0xe1, 0x18, 0xbb, 0x48, 0xf1, 0xeb, 0xc9, 0xeb, 0x79, 0xc1, 
-0xd1, 0x23, 0x12, 0x13, 0xc, 0xd6, 0x3a, 0x28, 0x4, 0xfe, 0x49, 0x20, 0x3, 0x32, 0xaf, 0x2b, 
-0xd6, 0x54, 0x28, 0x5, 0xd6, 0xe, 0xc2, 0xe3, 0x7, 0x47, 0x7e, 0xb7, 0x28, 0x9, 0xb8, 0x28, 
-0xe0, 0x23, 0x12, 0xc, 0x13, 0x18, 0xf3, 0x21, 0x61, 0x2b, 0x12, 0x13, 0x12, 0x13, 0x12, 0xc9, 
-0x4c, 0x49, 0x53, 0x54, 0x0, 0x52, 0x55, 0x4e, 0x0, 0x43, 0x4f, 0x4e, 0x54, 0x0, 0xe5, 0x21, 
-0x62, 0x2b, 0xe3, 0xcd, 0xe4, 0x20, 0xe3, 0xfe, 0x1c, 0x11, 0x9f, 0x8, 0x28, 0xe, 0xfe, 0x1d, 
-0x11, 0xa4, 0x8, 0x28, 0x7, 0xfe, 0x1e, 0x11, 0xa8, 0x8, 0x20, 0x14, 0x21, 0x61, 0x2b, 0x23, 
-0x13, 0x1a, 0x77, 0xa7, 0x20, 0xf9, 0x21, 0x62, 0x2b, 0xcd, 0xf1, 0x8, 0xe1, 0xc3, 0x5e, 0xe, 
-0xcd, 0xf, 0x22, 0x20, 0x2, 0xe1, 0xc9, 0xcd, 0x27, 0x22, 0x38, 0xf9, 0xcd, 0x32, 0x22, 0x18, 
-0xc1, 0x7e, 0xb7, 0xc8, 0xcd, 0xd5, 0x20, 0x23, 0x18, 0xf7, 0x11, 0xa, 0x0, 0xd5, 0x28, 0x17, 
-0xcd, 0x86, 0xc, 0xeb, 0xe3, 0x28, 0x11, 0xeb, 0xcd, 0xd6, 0xb, 0xed, 0x5b, 0x50, 0x2b, 0x28, 
-0x6, 0xcd, 0x86, 0xc, 0xc2, 0x48, 0x6, 0xeb, 0x7d, 0xb4, 0xca, 0x67, 0xc, 0x22, 0x50, 0x2b, 
-0xcb, 0xff, 0x32, 0x4d, 0x2b, 0xe1, 0x22, 0x4e, 0x2b, 0xc1, 0xc3, 0x96, 0x6, 0xcd, 0x5f, 0x21, 
-0x3a, 0x9, 0x2b, 0xe6, 0x3, 0x28, 0xf3, 0x3e, 0xd5, 0xcd, 0xb2, 0x1f, 0xf1, 0xaf, 0x18, 0xea, 
-0xc0, 0x2a, 0x5f, 0x2b, 0xaf, 0x32, 0x5e, 0x2b, 0x77, 0x23, 0x77, 0x23, 0x22, 0xd7, 0x2b, 0x2a, 
-0x5f, 0x2b, 0x2b, 0x22, 0xcf, 0x2b, 0x2a, 0xb0, 0x2b, 0x22, 0xc4, 0x2b, 0xaf, 0xcd, 0xdf, 0xb, 
-0x2a, 0xd7, 0x2b, 0x22, 0xd9, 0x2b, 0x22, 0xdb, 0x2b, 0xc1, 0x2a, 0x56, 0x2b, 0xf9, 0x21, 0xb4, 
-0x2b, 0x22, 0xb2, 0x2b, 0xcd, 0x1d, 0x21, 0xaf, 0x6f, 0x67, 0x22, 0xd5, 0x2b, 0x32, 0xcc, 0x2b, 
-0x22, 0xdf, 0x2b, 0xe5, 0xc5, 0x2a, 0xcf, 0x2b, 0xc9, 0x7c, 0x92, 0xc0, 0x7d, 0x93, 0xc9, 0x7e, 
-0xfe, 0x41, 0xd8, 0xfe, 0x5b, 0x3f, 0xc9, 0x3a, 0x5e, 0x2b, 0xa7, 0xc8, 0xcd, 0x69, 0x9, 0xc3, 
-0x6e, 0x6, 0xcd, 0x89, 0x9, 0x3e, 0x8, 0x18, 0x2, 0x3e, 0x20, 0xc3, 0xd5, 0x20, 0xf5, 0xc5, 
-0x4f, 0xfe, 0x20, 0x38, 0x13, 0x3a, 0x41, 0x2b, 0x47, 0x3a, 0xac, 0x2b, 0x4, 0x28, 0x5, 0x5, 
-0xb8, 0xcc, 0x61, 0xe, 0x3c, 0x32, 0xac, 0x2b, 0x79, 0xcd, 0xd5, 0x20, 0xc1, 0xf1, 0xc9, 0x3e, 
-0x3f, 0xcd, 0xae, 0x9, 0x3e, 0x9, 0xcd, 0xae, 0x9, 0xcd, 0xdf, 0x9, 0xc3, 0x4a, 0x2b, 0x21, 
-0x0, 0x20, 0x22, 0x61, 0x2b, 0x22, 0x63, 0x2b, 0x65, 0xc9, 0xcd, 0x6c, 0xc, 0xed, 0x53, 0x46, 
-0x2b, 0xc9, 0xcd, 0x97, 0x9, 0xcd, 0x25, 0x21, 0xcd, 0xc8, 0x20, 0x28, 0x12, 0x3e, 0xd5, 0xcd, 
-0xb2, 0x1f, 0x2a, 0x46, 0x2b, 0x22, 0x4e, 0x2b, 0x21, 0xff, 0xff, 0x22, 0x46, 0x2b, 0xe1, 0xcd, 
-0x86, 0xc, 0xc0, 0xc1, 0xcd, 0xbb, 0x7, 0xc5, 0xcd, 0x91, 0xa, 0xe1, 0x4e, 0x23, 0x46, 0x23, 
-0x78, 0xb1, 0x28, 0x59, 0xcd, 0x67, 0xa, 0xcd, 0xf9, 0xb, 0xc5, 0x5e, 0x23, 0x56, 0x23, 0xe5, 
-0x21, 0xea, 0x2b, 0xcd, 0x61, 0xe, 0xcd, 0x2a, 0x1b, 0x3e, 0x20, 0xe1, 0xcd, 0xae, 0x9, 0x7e, 
-0x23, 0xfe, 0x22, 0x28, 0x14, 0xb7, 0x28, 0xd3, 0xf2, 0x3c, 0xa, 0xcd, 0x9a, 0xa, 0xcd, 0xae, 
-0x9, 0x1a, 0x13, 0xb7, 0xf2, 0x4e, 0xa, 0x18, 0xe6, 0xcd, 0xae, 0x9, 0x7e, 0x23, 0xb7, 0x28, 
-0xba, 0xfe, 0x22, 0x28, 0xd7, 0x18, 0xf2, 0xe5, 0x2a, 0x44, 0x2b, 0x7d, 0xb4, 0x2b, 0x22, 0x44, 
-0x2b, 0xe1, 0xc0, 0xcd, 0x91, 0xa, 0xcd, 0xe4, 0x20, 0xfe, 0x3, 0x20, 0xea, 0xcd, 0xc8, 0x20, 
-0x28, 0xc, 0xcd, 0x61, 0xe, 0xcd, 0xfd, 0x20, 0x2a, 0x4e, 0x2b, 0x22, 0x46, 0x2b, 0xc3, 0x8c, 
-0x3, 0xe5, 0x2a, 0x46, 0x2b, 0x22, 0x44, 0x2b, 0xe1, 0xc9, 0xd6, 0x7f, 0xfe, 0x56, 0x38, 0x8, 
-0xd6, 0x55, 0xed, 0x5b, 0xc, 0x23, 0x18, 0x3, 0x11, 0x21, 0x4, 0x47, 0x1a, 0x13, 0xb7, 0xf2, 
-0xac, 0xa, 0x10, 0xf8, 0xe6, 0x7f, 0xc9, 0x3e, 0xaf, 0x32, 0xa, 0x2b, 0xc9, 0x21, 0x4, 0x0, 
-0x39, 0x7e, 0x23, 0xfe, 0x81, 0xc0, 0x4e, 0x23, 0x46, 0x23, 0xe5, 0x69, 0x60, 0x7a, 0xb3, 0xeb, 
-0x28, 0x4, 0xeb, 0xcd, 0x89, 0x9, 0x1, 0xd, 0x0, 0xe1, 0xc8, 0x9, 0x18, 0xe3, 0x3e, 0x64, 
-0x32, 0xcc, 0x2b, 0xcd, 0x5d, 0xd, 0xc1, 0xe5, 0xcd, 0x48, 0xd, 0x22, 0xc8, 0x2b, 0x21, 0x2, 
-0x0, 0x39, 0xcd, 0xc1, 0xa, 0xd1, 0x20, 0x14, 0x9, 0xd5, 0x2b, 0x56, 0x2b, 0x5e, 0x23, 0x23, 
-0xe5, 0x2a, 0xc8, 0x2b, 0xcd, 0x89, 0x9, 0xe1, 0x20, 0xe8, 0xd1, 0xf9, 0xeb, 0xe, 0x8, 0xcd, 
-0x27, 0x6, 0xe5, 0x2a, 0xc8, 0x2b, 0xe3, 0xe5, 0x2a, 0x58, 0x2b, 0xe3, 0xcd, 0x29, 0x10, 0xcd, 
-0xcc, 0xb, 0xa6, 0xcd, 0x26, 0x10, 0xe5, 0xcd, 0xeb, 0x19, 0xe1, 0xc5, 0xd5, 0x1, 0x0, 0x81, 
-0x51, 0x5a, 0x7e, 0xfe, 0xab, 0x3e, 0x1, 0x20, 0xe, 0xcd, 0xbd, 0xb, 0xcd, 0x26, 0x10, 0xe5, 
-0xcd, 0xeb, 0x19, 0xcd, 0x97, 0x19, 0xe1, 0xc5, 0xd5, 0xf5, 0x33, 0xe5, 0x2a, 0xcf, 0x2b, 0xe3, 
-0x6, 0x81, 0xc5, 0x33, 0xcd, 0x16, 0x21, 0xcd, 0xf9, 0xb, 0x22, 0xcf, 0x2b, 0x7e, 0xfe, 0x3a, 
-0x28, 0x28, 0xb7, 0xc2, 0x48, 0x6, 0x23, 0x7e, 0x23, 0xb6, 0xca, 0x22, 0xc, 0x23, 0x5e, 0x23, 
-0x56, 0xed, 0x53, 0x58, 0x2b, 0x3a, 0xa, 0x2b, 0xb7, 0x28, 0xf, 0xe5, 0x3e, 0x3c, 0xcd, 0xae, 
-0x9, 0xcd, 0x2a, 0x1b, 0x3e, 0x3e, 0xcd, 0xae, 0x9, 0xe1, 0xcd, 0xbd, 0xb, 0x11, 0x54, 0xb, 
-0xd5, 0xc8, 0xd6, 0x80, 0xda, 0x5d, 0xd, 0xfe, 0x25, 0x38, 0x14, 0xd6, 0x50, 0x38, 0x34, 0xfe, 
-0x5, 0x38, 0xa, 0x47, 0x3a, 0xfc, 0x2b, 0xa7, 0x28, 0x29, 0xc3, 0x3, 0x23, 0xc6, 0x25, 0x7, 
-0x4f, 0x6, 0x0, 0xeb, 0x21, 0x40, 0x5, 0x9, 0x4e, 0x23, 0x46, 0xc5, 0xeb, 0x23, 0x7e, 0xfe, 
-0x3a, 0xd0, 0xfe, 0x20, 0x28, 0xf7, 0xfe, 0x30, 0x3f, 0x3c, 0x3d, 0xc9, 0x7e, 0xe3, 0xbe, 0x23, 
-0xe3, 0x28, 0xea, 0xc3, 0x48, 0x6, 0x3e, 0x2c, 0xbe, 0x18, 0xf6, 0x3e, 0x29, 0x18, 0xf9, 0xeb, 
-0x2a, 0x5f, 0x2b, 0x28, 0xe, 0xeb, 0xcd, 0x86, 0xc, 0xe5, 0xcd, 0xbb, 0x7, 0x60, 0x69, 0xd1, 
-0xd2, 0x20, 0xd, 0x2b, 0x22, 0xdd, 0x2b, 0xeb, 0xc9, 0xcd, 0xf3, 0x20, 0xc0, 0xfe, 0x13, 0x28, 
-0x8, 0xfe, 0x3, 0xc0, 0xcd, 0xe4, 0x20, 0x18, 0xf, 0xcd, 0xe4, 0x20, 0xfe, 0x1e, 0xc8, 0xfe, 
-0xa, 0xc8, 0xfe, 0x3, 0x28, 0x2, 0x18, 0xf1, 0xc0, 0xf6, 0xc0, 0x22, 0xcf, 0x2b, 0x21, 0xf6, 
-0xff, 0xc1, 0x2a, 0x58, 0x2b, 0xf5, 0x7d, 0xa4, 0x3c, 0x28, 0x9, 0x22, 0xd3, 0x2b, 0x2a, 0xcf, 
-0x2b, 0x22, 0xd5, 0x2b, 0xaf, 0x32, 0x43, 0x2b, 0xcd, 0x1d, 0x21, 0xcd, 0x55, 0xe, 0xf1, 0x21, 
-0x21, 0x6, 0xc2, 0x71, 0x6, 0xc3, 0x88, 0x6, 0x2a, 0xd5, 0x2b, 0x7c, 0xb5, 0x1e, 0x20, 0xca, 
-0x56, 0x6, 0xeb, 0x2a, 0xd3, 0x2b, 0x22, 0x58, 0x2b, 0xeb, 0xc9, 0xcd, 0xbd, 0xb, 0xcd, 0x26, 
-0x10, 0xcd, 0x97, 0x19, 0xf2, 0x6f, 0xc, 0x1e, 0x8, 0xc3, 0x56, 0x6, 0xcd, 0x26, 0x10, 0x3a, 
-0xe8, 0x2b, 0xfe, 0x90, 0xda, 0x45, 0x1a, 0x1, 0x80, 0x90, 0x11, 0x0, 0x0, 0xe5, 0xcd, 0x18, 
-0x1a, 0xe1, 0x51, 0xc8, 0x18, 0xe1, 0x2b, 0x11, 0x0, 0x0, 0xcd, 0xbd, 0xb, 0xd0, 0xe5, 0xf5, 
-0x21, 0x98, 0x19, 0xcd, 0x89, 0x9, 0xda, 0x48, 0x6, 0x62, 0x6b, 0x19, 0x29, 0x19, 0x29, 0xf1, 
-0xd6, 0x30, 0x5f, 0x16, 0x0, 0x19, 0xeb, 0xe1, 0x18, 0xe0, 0x28, 0x3c, 0xcd, 0x5e, 0xc, 0xcd, 
-0xbe, 0xb, 0xe5, 0x2a, 0xb0, 0x2b, 0x28, 0x10, 0xe1, 0xcd, 0xd6, 0xb, 0xd5, 0xcd, 0x6c, 0xc, 
-0xcd, 0xbe, 0xb, 0xc2, 0x48, 0x6, 0xe3, 0xeb, 0x7d, 0x93, 0x5f, 0x7c, 0x9a, 0x57, 0xda, 0x3e, 
-0x6, 0xe5, 0x2a, 0xd7, 0x2b, 0x1, 0x28, 0x0, 0x9, 0xcd, 0x89, 0x9, 0xd2, 0x3e, 0x6, 0xeb, 
-0x22, 0x56, 0x2b, 0xe1, 0x22, 0xb0, 0x2b, 0xe1, 0xc3, 0x53, 0x9, 0xca, 0x4f, 0x9, 0xcd, 0x53, 
-0x9, 0x1, 0x54, 0xb, 0x18, 0x10, 0xe, 0x3, 0xcd, 0x27, 0x6, 0xc1, 0xe5, 0xe5, 0x2a, 0x58, 
-0x2b, 0xe3, 0x3e, 0x8c, 0xf5, 0x33, 0xc5, 0xcd, 0x86, 0xc, 0xcd, 0x4a, 0xd, 0xe5, 0x2a, 0x58, 
-0x2b, 0xcd, 0x89, 0x9, 0xe1, 0x23, 0xdc, 0xbe, 0x7, 0xd4, 0xbb, 0x7, 0x60, 0x69, 0x2b, 0xd8, 
-0x1e, 0xe, 0xc3, 0x56, 0x6, 0xc0, 0x16, 0xff, 0xcd, 0xbd, 0xa, 0xf9, 0xfe, 0x8c, 0x1e, 0x4, 
-0x20, 0xf0, 0xe1, 0x22, 0x58, 0x2b, 0x23, 0x7c, 0xb5, 0x20, 0x7, 0x3a, 0xcd, 0x2b, 0xb7, 0xc2, 
-0x87, 0x6, 0x21, 0x54, 0xb, 0xe3, 0x3e, 0xe1, 0x1, 0x3a, 0xe, 0x0, 0x6, 0x0, 0x79, 0x48, 
-0x47, 0x7e, 0xb7, 0xc8, 0xb8, 0xc8, 0x23, 0xfe, 0x22, 0x28, 0xf3, 0x18, 0xf4, 0xcd, 0x6, 0x12, 
-0xcd, 0xcc, 0xb, 0xb4, 0xd5, 0x3a, 0xae, 0x2b, 0xf5, 0xcd, 0x3a, 0x10, 0xf1, 0xe3, 0x22, 0xcf, 
-0x2b, 0x1f, 0xcd, 0x2b, 0x10, 0x28, 0x35, 0xe5, 0x2a, 0xe5, 0x2b, 0xe5, 0x23, 0x23, 0x5e, 0x23, 
-0x56, 0x2a, 0x5f, 0x2b, 0xcd, 0x89, 0x9, 0x30, 0x12, 0x2a, 0x56, 0x2b, 0xcd, 0x89, 0x9, 0xd1, 
-0x30, 0x11, 0x21, 0xc0, 0x2b, 0xcd, 0x89, 0x9, 0x30, 0x9, 0x3e, 0xd1, 0xcd, 0x1b, 0x16, 0xeb, 
-0xcd, 0x66, 0x14, 0xcd, 0x1b, 0x16, 0xe1, 0xcd, 0xfa, 0x19, 0xe1, 0xc9, 0xe5, 0xcd, 0xf7, 0x19, 
-0xd1, 0xe1, 0xc9, 0xcd, 0x21, 0x17, 0x7e, 0x47, 0xfe, 0x8c, 0x28, 0x5, 0xcd, 0xcc, 0xb, 0x88, 
-0x2b, 0x4b, 0xd, 0x78, 0xca, 0x92, 0xb, 0xcd, 0x87, 0xc, 0xfe, 0x2c, 0xc0, 0x18, 0xf3, 0xcd, 
-0x3a, 0x10, 0x7e, 0xfe, 0x88, 0x28, 0x5, 0xcd, 0xcc, 0xb, 0xa9, 0x2b, 0xcd, 0x29, 0x10, 0xcd, 
-0x97, 0x19, 0x20, 0x8, 0x23, 0x7e, 0xb7, 0xc8, 0xfe, 0xd4, 0x20, 0xf8, 0xcd, 0xbd, 0xb, 0xda, 
-0x7, 0xd, 0xc3, 0x91, 0xb, 0xcd, 0xbe, 0xb, 0x18, 0x7, 0xaf, 0x32, 0xfd, 0x2b, 0xcd, 0x25, 
-0x21, 0x28, 0x5e, 0xc8, 0xfe, 0xd5, 0x38, 0x9, 0x3a, 0xfc, 0x2b, 0xa7, 0x28, 0x3, 0xcd, 0x6, 
-0x23, 0xfe, 0xa5, 0xca, 0x92, 0xe, 0xfe, 0xa8, 0x28, 0x78, 0xe5, 0xfe, 0x2c, 0x28, 0x5d, 0xfe, 
-0x3b, 0xca, 0xb2, 0xe, 0xc1, 0xcd, 0x3a, 0x10, 0xe5, 0x3a, 0xae, 0x2b, 0xb7, 0x20, 0x20, 0xcd, 
-0x34, 0x1b, 0xcd, 0x8a, 0x14, 0x36, 0x20, 0x2a, 0xe5, 0x2b, 0x34, 0x2a, 0xe5, 0x2b, 0x3a, 0x41, 
-0x2b, 0x47, 0x4, 0x28, 0xa, 0x4, 0x3a, 0xac, 0x2b, 0x86, 0x3d, 0xb8, 0xd4, 0x61, 0xe, 0xcd, 
-0xcc, 0x14, 0xe1, 0x18, 0xa0, 0x3a, 0xac, 0x2b, 0xb7, 0xc8, 0x18, 0x5, 0x36, 0x0, 0x21, 0x61, 
-0x2b, 0x3e, 0xd, 0xcd, 0xae, 0x9, 0x3e, 0xa, 0xcd, 0xae, 0x9, 0xaf, 0x32, 0xac, 0x2b, 0x3a, 
-0x40, 0x2b, 0x3d, 0xc8, 0xf5, 0xaf, 0xcd, 0xae, 0x9, 0xf1, 0x18, 0xf6, 0x3a, 0x42, 0x2b, 0x47, 
-0x3a, 0xac, 0x2b, 0xb8, 0xd4, 0x61, 0xe, 0x30, 0x29, 0xd6, 0xd, 0x38, 0x2, 0x20, 0xfa, 0x2f, 
-0x18, 0x15, 0xf5, 0xcd, 0x1e, 0x17, 0xcd, 0xdb, 0xb, 0x2b, 0xf1, 0xd6, 0xa8, 0xe5, 0x28, 0x3, 
-0x3a, 0xac, 0x2b, 0x2f, 0x83, 0x30, 0xb, 0x3c, 0x28, 0x8, 0x47, 0x3e, 0x20, 0xcd, 0xae, 0x9, 
-0x10, 0xfb, 0xe1, 0xcd, 0xbd, 0xb, 0xc3, 0x3, 0xe, 0xcd, 0x21, 0x17, 0x32, 0x41, 0x2b, 0xc9, 
-0xcd, 0x21, 0x17, 0xc0, 0x3c, 0x32, 0x40, 0x2b, 0xc9, 0x3f, 0x52, 0x45, 0x44, 0x4f, 0x20, 0x46, 
-0x52, 0x4f, 0x4d, 0x20, 0x53, 0x54, 0x41, 0x52, 0x54, 0xd, 0x0, 0x3a, 0xce, 0x2b, 0xb7, 0xc2, 
-0x42, 0x6, 0xc1, 0x21, 0xc9, 0xe, 0xcd, 0xc9, 0x14, 0xc3, 0x85, 0x9, 0xcd, 0x37, 0x14, 0xcd, 
-0x5f, 0x21, 0xaf, 0x32, 0x43, 0x2b, 0x7e, 0xfe, 0x22, 0x20, 0x10, 0xcd, 0x8b, 0x14, 0xcd, 0xcc, 
-0xb, 0x3b, 0xe5, 0xcd, 0xcc, 0x14, 0xcd, 0xd4, 0x9, 0x18, 0x4, 0xe5, 0xcd, 0xcf, 0x9, 0xc1, 
-0x38, 0x36, 0x21, 0x62, 0x2b, 0x7e, 0xb7, 0x2b, 0xc5, 0x28, 0x37, 0x36, 0x2c, 0x18, 0x5, 0xe5, 
-0x2a, 0xdd, 0x2b, 0xf6, 0xaf, 0x32, 0xce, 0x2b, 0xe3, 0x18, 0x3, 0xcd, 0xd6, 0xb, 0xcd, 0x6, 
-0x12, 0xe3, 0xd5, 0x7e, 0xfe, 0x2c, 0x28, 0x1e, 0x3a, 0xce, 0x2b, 0xb7, 0x20, 0x7d, 0x3e, 0x3f, 
-0xcd, 0xae, 0x9, 0xcd, 0xcf, 0x9, 0xd1, 0xc1, 0xda, 0x1f, 0xc, 0x21, 0x62, 0x2b, 0x7e, 0xb7, 
-0x2b, 0xc5, 0xca, 0x47, 0xd, 0xd5, 0x3a, 0xae, 0x2b, 0xb7, 0x28, 0x21, 0xcd, 0xbd, 0xb, 0x57, 
-0x47, 0xfe, 0x22, 0x28, 0xc, 0x3a, 0xce, 0x2b, 0xb7, 0x57, 0x28, 0x2, 0x16, 0x3a, 0x6, 0x2c, 
-0x2b, 0xcd, 0x8e, 0x14, 0xeb, 0x21, 0x88, 0xf, 0xe3, 0xd5, 0xc3, 0x77, 0xd, 0xcd, 0xbd, 0xb, 
-0xcd, 0xa1, 0x1a, 0xe3, 0xcd, 0xf7, 0x19, 0xe1, 0xcd, 0xbe, 0xb, 0x28, 0x5, 0xfe, 0x2c, 0xc2, 
-0xdb, 0xe, 0xe3, 0xcd, 0xbe, 0xb, 0x20, 0x93, 0xd1, 0x3a, 0xce, 0x2b, 0xb7, 0xeb, 0xc2, 0xf4, 
-0xb, 0xd5, 0xb6, 0x21, 0xab, 0xf, 0xc4, 0xc9, 0x14, 0xe1, 0xc9, 0x3f, 0x45, 0x58, 0x54, 0x52, 
-0x41, 0x20, 0x49, 0x47, 0x4e, 0x4f, 0x52, 0x45, 0x44, 0xd, 0x0, 0xcd, 0x48, 0xd, 0xb7, 0x20, 
-0x11, 0x23, 0x7e, 0x23, 0xb6, 0x1e, 0x6, 0xca, 0x56, 0x6, 0x23, 0x5e, 0x23, 0x56, 0xed, 0x53, 
-0xca, 0x2b, 0xcd, 0xbd, 0xb, 0xfe, 0x83, 0x20, 0xe2, 0xc3, 0x56, 0xf, 0x11, 0x0, 0x0, 0xc4, 
-0x6, 0x12, 0x22, 0xcf, 0x2b, 0xcd, 0xbd, 0xa, 0xc2, 0x4e, 0x6, 0xf9, 0xd5, 0x7e, 0x23, 0xf5, 
-0xd5, 0xcd, 0xdd, 0x19, 0xe3, 0xe5, 0xcd, 0x61, 0x17, 0xe1, 0xcd, 0xf7, 0x19, 0xe1, 0xcd, 0xee, 
-0x19, 0xe5, 0xcd, 0x18, 0x1a, 0xe1, 0xc1, 0x90, 0xcd, 0xee, 0x19, 0x28, 0x9, 0xed, 0x53, 0x58, 
-0x2b, 0x69, 0x60, 0xc3, 0x50, 0xb, 0xf9, 0x2a, 0xcf, 0x2b, 0x7e, 0xfe, 0x2c, 0xc2, 0x54, 0xb, 
-0xcd, 0xbd, 0xb, 0xcd, 0xdf, 0xf, 0xcd, 0x3a, 0x10, 0xf6, 0x37, 0x3a, 0xae, 0x2b, 0x8f, 0xb7, 
-0xe8, 0x1e, 0x18, 0xc3, 0x56, 0x6, 0xcd, 0xcc, 0xb, 0x28, 0x2b, 0x16, 0x0, 0xd5, 0xe, 0x1, 
-0xcd, 0x27, 0x6, 0xcd, 0xad, 0x10, 0x22, 0xd1, 0x2b, 0x2a, 0xd1, 0x2b, 0xc1, 0x78, 0xfe, 0x78, 
-0xd4, 0x29, 0x10, 0x7e, 0x16, 0x0, 0xd6, 0xb3, 0x38, 0x15, 0xfe, 0x3, 0x30, 0x11, 0xfe, 0x1, 
-0x17, 0xaa, 0xba, 0x57, 0xda, 0x48, 0x6, 0x22, 0xc6, 0x2b, 0xcd, 0xbd, 0xb, 0x18, 0xe7, 0x7a, 
-0xb7, 0xc2, 0x84, 0x11, 0x7e, 0x22, 0xc6, 0x2b, 0xd6, 0xac, 0xd8, 0xfe, 0x7, 0xd0, 0x5f, 0x3a, 
-0xae, 0x2b, 0x3d, 0xb3, 0x7b, 0xca, 0xb3, 0x15, 0x7, 0x83, 0x5f, 0x21, 0xc8, 0x5, 0x19, 0x78, 
-0x56, 0xba, 0xd0, 0x23, 0xcd, 0x29, 0x10, 0xc5, 0x1, 0x49, 0x10, 0xc5, 0x43, 0x4a, 0xcd, 0xc8, 
-0x19, 0x58, 0x51, 0x4e, 0x23, 0x46, 0x23, 0xc5, 0x2a, 0xc6, 0x2b, 0x18, 0x90, 0xaf, 0x32, 0xae, 
-0x2b, 0xcd, 0xbd, 0xb, 0x1e, 0x24, 0xca, 0x56, 0x6, 0xda, 0xa1, 0x1a, 0xcd, 0x8f, 0x9, 0x30, 
-0x37, 0xfe, 0xac, 0x28, 0xe8, 0xfe, 0x2e, 0xca, 0xa1, 0x1a, 0xfe, 0xad, 0x28, 0x19, 0xfe, 0x22, 
-0xca, 0x8b, 0x14, 0xfe, 0xaa, 0xca, 0xe3, 0x11, 0xfe, 0xa7, 0xca, 0xf0, 0x13, 0xd6, 0xb6, 0x30, 
-0x28, 0xcd, 0x36, 0x10, 0xc3, 0xdb, 0xb, 0x16, 0x7d, 0xcd, 0x3d, 0x10, 0x2a, 0xd1, 0x2b, 0xe5, 
-0xcd, 0xc0, 0x19, 0xcd, 0x29, 0x10, 0xe1, 0xc9, 0xcd, 0x6, 0x12, 0xe5, 0xeb, 0x22, 0xe5, 0x2b, 
-0x3a, 0xae, 0x2b, 0xb7, 0xcc, 0xdd, 0x19, 0xe1, 0xc9, 0x6, 0x0, 0x7, 0x4f, 0xc5, 0xcd, 0xbd, 
-0xb, 0x79, 0xfe, 0x33, 0x38, 0x7, 0x3a, 0xfc, 0x2b, 0xa7, 0xc2, 0x9, 0x23, 0xfe, 0x22, 0x28, 
-0x1e, 0xfe, 0x2d, 0x38, 0x17, 0xcd, 0x36, 0x10, 0xcd, 0xd6, 0xb, 0xcd, 0x2a, 0x10, 0xeb, 0x2a, 
-0xe5, 0x2b, 0xe3, 0xe5, 0xeb, 0xcd, 0x21, 0x17, 0xeb, 0xe3, 0x18, 0x8, 0xcd, 0xe1, 0x10, 0xe3, 
-0x11, 0xf3, 0x10, 0xd5, 0x1, 0x94, 0x5, 0x9, 0x4e, 0x23, 0x66, 0x69, 0xe9, 0x15, 0xfe, 0xad, 
-0xc8, 0xfe, 0x2d, 0xc8, 0x14, 0xfe, 0x2b, 0xc8, 0xfe, 0xac, 0xc8, 0x2b, 0xc9, 0xf6, 0xaf, 0xf5, 
-0xcd, 0x29, 0x10, 0xcd, 0x6f, 0xc, 0xf1, 0xeb, 0xc1, 0xe3, 0xeb, 0xcd, 0xe0, 0x19, 0xf5, 0xcd, 
-0x6f, 0xc, 0xf1, 0xc1, 0x79, 0x21, 0xb0, 0x13, 0x20, 0x5, 0xa3, 0x4f, 0x78, 0xa2, 0xe9, 0xb3, 
-0x4f, 0x78, 0xb2, 0xe9, 0x21, 0x96, 0x11, 0x3a, 0xae, 0x2b, 0x1f, 0x7a, 0x17, 0x5f, 0x16, 0x64, 
-0x78, 0xba, 0xd0, 0xc3, 0x97, 0x10, 0x98, 0x11, 0x79, 0xb7, 0x1f, 0xc1, 0xd1, 0xf5, 0xcd, 0x2b, 
-0x10, 0x21, 0xd9, 0x11, 0xe5, 0xca, 0x18, 0x1a, 0xaf, 0x32, 0xae, 0x2b, 0xd5, 0xcd, 0xfe, 0x15, 
-0x7e, 0x23, 0x23, 0x4e, 0x23, 0x46, 0xd1, 0xc5, 0xf5, 0xcd, 0x2, 0x16, 0xcd, 0xee, 0x19, 0xf1, 
-0x57, 0xe1, 0x7b, 0xb2, 0xc8, 0x7a, 0xd6, 0x1, 0xd8, 0xaf, 0xbb, 0x3c, 0xd0, 0x15, 0x1d, 0xa, 
-0xbe, 0x23, 0x3, 0x28, 0xed, 0x3f, 0xc3, 0xa2, 0x19, 0x3c, 0x8f, 0xc1, 0xa0, 0xc6, 0xff, 0x9f, 
-0xc3, 0xa9, 0x19, 0x16, 0x5a, 0xcd, 0x3d, 0x10, 0xcd, 0x29, 0x10, 0xcd, 0x6f, 0xc, 0x7b, 0x2f, 
-0x4f, 0x7a, 0x2f, 0xcd, 0xb0, 0x13, 0xc1, 0xc3, 0x49, 0x10, 0xcd, 0xbe, 0xb, 0xc8, 0xcd, 0xd6, 
-0xb, 0x1, 0xfa, 0x11, 0xc5, 0xf6, 0xaf, 0x32, 0xad, 0x2b, 0x46, 0xcd, 0x8f, 0x9, 0xda, 0x48, 
-0x6, 0xaf, 0x4f, 0x32, 0xae, 0x2b, 0xcd, 0xbd, 0xb, 0x38, 0x5, 0xcd, 0x8f, 0x9, 0x38, 0xb, 
-0x4f, 0xcd, 0xbd, 0xb, 0x38, 0xfb, 0xcd, 0x8f, 0x9, 0x30, 0xf6, 0xd6, 0x24, 0x20, 0xa, 0x3c, 
-0x32, 0xae, 0x2b, 0xf, 0x81, 0x4f, 0xcd, 0xbd, 0xb, 0x3a, 0xcc, 0x2b, 0x3d, 0xca, 0xdd, 0x12, 
-0xf2, 0x48, 0x12, 0x7e, 0xd6, 0x28, 0x28, 0x6f, 0xaf, 0x32, 0xcc, 0x2b, 0xe5, 0x50, 0x59, 0x2a, 
-0xdf, 0x2b, 0xcd, 0x89, 0x9, 0x11, 0xe1, 0x2b, 0xca, 0xe0, 0x18, 0x2a, 0xd9, 0x2b, 0xeb, 0x2a, 
-0xd7, 0x2b, 0xcd, 0x89, 0x9, 0x28, 0x10, 0x79, 0x96, 0x23, 0x20, 0x2, 0x78, 0x96, 0x23, 0x28, 
-0x38, 0x23, 0x23, 0x23, 0x23, 0x18, 0xeb, 0xe1, 0xe3, 0xd5, 0x11, 0xfb, 0x10, 0xcd, 0x89, 0x9, 
-0xd1, 0x28, 0x29, 0xe3, 0xe5, 0xc5, 0x1, 0x6, 0x0, 0x2a, 0xdb, 0x2b, 0xe5, 0x9, 0xc1, 0xe5, 
-0xcd, 0xab, 0x7, 0xe1, 0x22, 0xdb, 0x2b, 0x60, 0x69, 0x22, 0xd9, 0x2b, 0x2b, 0x36, 0x0, 0xcd, 
-0x89, 0x9, 0x20, 0xf8, 0xd1, 0x73, 0x23, 0x72, 0x23, 0xeb, 0xe1, 0xc9, 0x32, 0xe8, 0x2b, 0x21, 
-0x20, 0x6, 0x22, 0xe5, 0x2b, 0xe1, 0xc9, 0xe5, 0x2a, 0xad, 0x2b, 0xe3, 0x57, 0xd5, 0xc5, 0xcd, 
-0x5b, 0xc, 0xc1, 0xf1, 0xeb, 0xe3, 0xe5, 0xeb, 0x3c, 0x57, 0x7e, 0xfe, 0x2c, 0x28, 0xee, 0xcd, 
-0xdb, 0xb, 0x22, 0xd1, 0x2b, 0xe1, 0x22, 0xad, 0x2b, 0x1e, 0x0, 0xd5, 0x11, 0xe5, 0xf5, 0x2a, 
-0xd9, 0x2b, 0x3e, 0x19, 0xed, 0x5b, 0xdb, 0x2b, 0xcd, 0x89, 0x9, 0x28, 0x23, 0x7e, 0xb9, 0x23, 
-0x20, 0x2, 0x7e, 0xb8, 0x23, 0x5e, 0x23, 0x56, 0x23, 0x20, 0xe8, 0x3a, 0xad, 0x2b, 0xb7, 0xc2, 
-0x51, 0x6, 0xf1, 0x44, 0x4d, 0xca, 0xaa, 0x12, 0x96, 0x28, 0x5f, 0x1e, 0x10, 0xc3, 0x56, 0x6, 
-0x11, 0x4, 0x0, 0xf1, 0xca, 0x67, 0xc, 0x71, 0x23, 0x70, 0x23, 0x4f, 0xcd, 0x27, 0x6, 0x23, 
-0x23, 0x22, 0xc6, 0x2b, 0x71, 0x23, 0x3a, 0xad, 0x2b, 0x17, 0x79, 0x1, 0xb, 0x0, 0x30, 0x2, 
-0xc1, 0x3, 0x71, 0x23, 0x70, 0x23, 0xf5, 0xe5, 0xcd, 0x89, 0x1a, 0xeb, 0xe1, 0xf1, 0x3d, 0x20, 
-0xea, 0xf5, 0x42, 0x4b, 0xeb, 0x19, 0xda, 0x3e, 0x6, 0xcd, 0x30, 0x6, 0x22, 0xdb, 0x2b, 0x2b, 
-0x36, 0x0, 0xcd, 0x89, 0x9, 0x20, 0xf8, 0x3, 0x57, 0x2a, 0xc6, 0x2b, 0x5e, 0xeb, 0x29, 0x9, 
-0xeb, 0x2b, 0x2b, 0x73, 0x23, 0x72, 0x23, 0xf1, 0x38, 0x22, 0x47, 0x4f, 0x7e, 0x23, 0x16, 0xe1, 
-0x5e, 0x23, 0x56, 0x23, 0xe3, 0xf5, 0xcd, 0x89, 0x9, 0x30, 0x90, 0xe5, 0xcd, 0x89, 0x1a, 0xd1, 
-0x19, 0xf1, 0x3d, 0x44, 0x4d, 0x20, 0xe8, 0x29, 0x29, 0xc1, 0x9, 0xeb, 0x2a, 0xd1, 0x2b, 0xc9, 
-0xed, 0x5b, 0xdb, 0x2b, 0x21, 0x0, 0x0, 0x39, 0x3a, 0xae, 0x2b, 0xb7, 0x28, 0xd, 0xcd, 0xfe, 
-0x15, 0xcd, 0x9, 0x15, 0xed, 0x5b, 0x56, 0x2b, 0x2a, 0xc4, 0x2b, 0x7d, 0x93, 0x4f, 0x7c, 0x9a, 
-0x41, 0x50, 0x1e, 0x0, 0x21, 0xae, 0x2b, 0x73, 0x6, 0x90, 0xc3, 0xae, 0x19, 0x3a, 0xac, 0x2b, 
-0x47, 0xaf, 0x18, 0xed, 0xcd, 0x45, 0x14, 0xcd, 0x37, 0x14, 0x1, 0x48, 0xd, 0xc5, 0xd5, 0xcd, 
-0xcc, 0xb, 0x28, 0xcd, 0x6, 0x12, 0xe5, 0xeb, 0x2b, 0x56, 0x2b, 0x5e, 0xe1, 0xcd, 0x29, 0x10, 
-0xcd, 0xdb, 0xb, 0xcd, 0xcc, 0xb, 0xb4, 0x44, 0x4d, 0xe3, 0x71, 0x23, 0x70, 0xc3, 0x84, 0x14, 
-0xcd, 0x45, 0x14, 0xd5, 0xcd, 0xe1, 0x10, 0xcd, 0x29, 0x10, 0xe3, 0x5e, 0x23, 0x56, 0x23, 0x7a, 
-0xb3, 0xca, 0x54, 0x6, 0x7e, 0x23, 0x66, 0x6f, 0xe5, 0x2a, 0xdf, 0x2b, 0xe3, 0x22, 0xdf, 0x2b, 
-0x2a, 0xe3, 0x2b, 0xe5, 0x2a, 0xe1, 0x2b, 0xe5, 0x21, 0xe1, 0x2b, 0xd5, 0xcd, 0xf7, 0x19, 0xe1, 
-0xcd, 0x26, 0x10, 0xcd, 0xbe, 0xb, 0xc2, 0x48, 0x6, 0xe1, 0x22, 0xe1, 0x2b, 0xe1, 0x22, 0xe3, 
-0x2b, 0xe1, 0x22, 0xdf, 0x2b, 0xe1, 0xc9, 0xe5, 0x2a, 0x58, 0x2b, 0x23, 0x7c, 0xb5, 0xe1, 0xc0, 
-0x1e, 0x16, 0xc3, 0x56, 0x6, 0xcd, 0xcc, 0xb, 0xa7, 0x3e, 0x80, 0x32, 0xcc, 0x2b, 0xb6, 0x47, 
-0xcd, 0xb, 0x12, 0xc3, 0x29, 0x10, 0xcd, 0x29, 0x10, 0xcd, 0x34, 0x1b, 0xcd, 0x8a, 0x14, 0xcd, 
-0xfe, 0x15, 0x1, 0x57, 0x16, 0xc5, 0x7e, 0x23, 0x23, 0xe5, 0xcd, 0xe1, 0x14, 0xe1, 0x4e, 0x23, 
-0x46, 0xcd, 0x7e, 0x14, 0xe5, 0x6f, 0xcd, 0xf2, 0x15, 0xd1, 0xc9, 0xcd, 0xe1, 0x14, 0x21, 0xc0, 
-0x2b, 0xe5, 0x77, 0x23, 0x23, 0x73, 0x23, 0x72, 0xe1, 0xc9, 0x2b, 0x6, 0x22, 0x50, 0xe5, 0xe, 
-0xff, 0x23, 0x7e, 0xc, 0xb7, 0x28, 0x6, 0xba, 0x28, 0x3, 0xb8, 0x20, 0xf4, 0xfe, 0x22, 0xcc, 
-0xbd, 0xb, 0xe3, 0x23, 0xeb, 0x79, 0xcd, 0x7e, 0x14, 0x11, 0xc0, 0x2b, 0x2a, 0xb2, 0x2b, 0x22, 
-0xe5, 0x2b, 0x3e, 0x1, 0x32, 0xae, 0x2b, 0xcd, 0xfa, 0x19, 0xcd, 0x89, 0x9, 0x22, 0xb2, 0x2b, 
-0xe1, 0x7e, 0xc0, 0x1e, 0x1e, 0xc3, 0x56, 0x6, 0x23, 0xcd, 0x8a, 0x14, 0xcd, 0xfe, 0x15, 0xcd, 
-0xee, 0x19, 0x1c, 0x1d, 0xc8, 0xa, 0xcd, 0xae, 0x9, 0xfe, 0xd, 0xcc, 0x66, 0xe, 0x3, 0x18, 
-0xf2, 0xb7, 0xe, 0xf1, 0xf5, 0xed, 0x5b, 0x56, 0x2b, 0x2a, 0xc4, 0x2b, 0x2f, 0x4f, 0x6, 0xff, 
-0x9, 0x23, 0xcd, 0x89, 0x9, 0x38, 0x7, 0x22, 0xc4, 0x2b, 0x23, 0xeb, 0xf1, 0xc9, 0xf1, 0x1e, 
-0x1a, 0x28, 0xc2, 0xbf, 0xf5, 0x1, 0xe3, 0x14, 0xc5, 0x2a, 0xb0, 0x2b, 0x22, 0xc4, 0x2b, 0x21, 
-0x0, 0x0, 0xe5, 0x2a, 0x56, 0x2b, 0xe5, 0x21, 0xb4, 0x2b, 0xed, 0x5b, 0xb2, 0x2b, 0xcd, 0x89, 
-0x9, 0x1, 0x1a, 0x15, 0x20, 0x3f, 0x2a, 0xd7, 0x2b, 0xed, 0x5b, 0xd9, 0x2b, 0xcd, 0x89, 0x9, 
-0x28, 0xa, 0x7e, 0x23, 0x23, 0xb7, 0xcd, 0x68, 0x15, 0x18, 0xee, 0xc1, 0xed, 0x5b, 0xdb, 0x2b, 
-0xcd, 0x89, 0x9, 0x28, 0x49, 0xcd, 0xee, 0x19, 0x7b, 0xe5, 0x9, 0xb7, 0xf2, 0x3b, 0x15, 0x22, 
-0xc6, 0x2b, 0xe1, 0x4e, 0x6, 0x0, 0x9, 0x9, 0x23, 0xed, 0x5b, 0xc6, 0x2b, 0xcd, 0x89, 0x9, 
-0x28, 0xda, 0x1, 0x59, 0x15, 0xc5, 0xf6, 0x80, 0x7e, 0x23, 0x23, 0x5e, 0x23, 0x56, 0x23, 0xf0, 
-0xb7, 0xc8, 0x44, 0x4d, 0x2a, 0xc4, 0x2b, 0xcd, 0x89, 0x9, 0x60, 0x69, 0xd8, 0xe1, 0xe3, 0xcd, 
-0x89, 0x9, 0xe3, 0xe5, 0x60, 0x69, 0xd0, 0xc1, 0xf1, 0xf1, 0xe5, 0xd5, 0xc5, 0xc9, 0xd1, 0xe1, 
-0x7d, 0xb4, 0xc8, 0x2b, 0x46, 0x2b, 0x4e, 0xe5, 0x2b, 0x2b, 0x6e, 0x26, 0x0, 0x9, 0x50, 0x59, 
-0x2b, 0x44, 0x4d, 0x2a, 0xc4, 0x2b, 0xcd, 0xae, 0x7, 0xe1, 0x71, 0x23, 0x70, 0x69, 0x60, 0x2b, 
-0xc3, 0xc, 0x15, 0xc5, 0xe5, 0x2a, 0xe5, 0x2b, 0xe3, 0xcd, 0xad, 0x10, 0xe3, 0xcd, 0x2a, 0x10, 
-0x7e, 0xe5, 0x2a, 0xe5, 0x2b, 0xe5, 0x86, 0x1e, 0x1c, 0xda, 0x56, 0x6, 0xcd, 0x7b, 0x14, 0xd1, 
-0xcd, 0x2, 0x16, 0xe3, 0xcd, 0x1, 0x16, 0xe5, 0x2a, 0xc2, 0x2b, 0xeb, 0xcd, 0xe9, 0x15, 0xcd, 
-0xe9, 0x15, 0x21, 0x46, 0x10, 0xe3, 0xe5, 0x18, 0x6f, 0xe1, 0xe3, 0x7e, 0x23, 0x23, 0x4e, 0x23, 
-0x46, 0x6f, 0x2c, 0x2d, 0xc8, 0xa, 0x12, 0x3, 0x13, 0x18, 0xf8, 0xcd, 0x2a, 0x10, 0x2a, 0xe5, 
-0x2b, 0xeb, 0xcd, 0x1b, 0x16, 0xeb, 0xc0, 0xd5, 0x50, 0x59, 0x1b, 0x4e, 0x2a, 0xc4, 0x2b, 0xcd, 
-0x89, 0x9, 0x20, 0x5, 0x47, 0x9, 0x22, 0xc4, 0x2b, 0xe1, 0xc9, 0x2a, 0xb2, 0x2b, 0x2b, 0x46, 
-0x2b, 0x4e, 0x2b, 0x2b, 0xcd, 0x89, 0x9, 0xc0, 0x22, 0xb2, 0x2b, 0xc9, 0x1, 0xc0, 0x13, 0xc5, 
-0xcd, 0xfb, 0x15, 0xaf, 0x57, 0x32, 0xae, 0x2b, 0x7e, 0xb7, 0xc9, 0x1, 0xc0, 0x13, 0xc5, 0xcd, 
-0x30, 0x16, 0x28, 0x55, 0x23, 0x23, 0x5e, 0x23, 0x56, 0x1a, 0xc9, 0x3e, 0x1, 0xcd, 0x7b, 0x14, 
-0xcd, 0x24, 0x17, 0x2a, 0xc2, 0x2b, 0x73, 0xc1, 0xc3, 0xa9, 0x14, 0xcd, 0xda, 0x16, 0xaf, 0xe3, 
-0x4f, 0xe5, 0x7e, 0xb8, 0x38, 0x2, 0x78, 0x11, 0xe, 0x0, 0xc5, 0xcd, 0xe1, 0x14, 0xc1, 0xe1, 
-0xe5, 0x23, 0x23, 0x46, 0x23, 0x66, 0x68, 0x6, 0x0, 0x9, 0x44, 0x4d, 0xcd, 0x7e, 0x14, 0x6f, 
-0xcd, 0xf2, 0x15, 0xd1, 0xcd, 0x2, 0x16, 0x18, 0xcf, 0xcd, 0xda, 0x16, 0xd1, 0xd5, 0x1a, 0x90, 
-0x18, 0xcd, 0xeb, 0x7e, 0xcd, 0xde, 0x16, 0x4, 0x5, 0xca, 0x67, 0xc, 0xc5, 0x1e, 0xff, 0xfe, 
-0x29, 0x28, 0x6, 0xcd, 0xd6, 0xb, 0xcd, 0x21, 0x17, 0xcd, 0xdb, 0xb, 0xf1, 0xe3, 0x1, 0x61, 
-0x16, 0xc5, 0x3d, 0xbe, 0x6, 0x0, 0xd0, 0x4f, 0x7e, 0x91, 0xbb, 0x47, 0xd8, 0x43, 0xc9, 0xcd, 
-0x30, 0x16, 0xca, 0xcf, 0x17, 0x5f, 0x23, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0xe5, 0x19, 0x46, 0x72, 
-0xe3, 0xc5, 0x7e, 0xcd, 0xa1, 0x1a, 0xc1, 0xe1, 0x70, 0xc9, 0xeb, 0xcd, 0xdb, 0xb, 0xc1, 0xd1, 
-0xc5, 0x43, 0xc9, 0xcd, 0x24, 0x17, 0x4f, 0xed, 0x78, 0xc3, 0xc0, 0x13, 0xcd, 0x14, 0x17, 0x3a, 
-0x6, 0x2b, 0x4f, 0x7b, 0xed, 0x79, 0xc9, 0xcd, 0x14, 0x17, 0xf5, 0x1e, 0x0, 0xcd, 0xbe, 0xb, 
-0x28, 0x6, 0xcd, 0xd6, 0xb, 0xcd, 0x21, 0x17, 0xc1, 0x3a, 0x6, 0x2b, 0x4f, 0xed, 0x78, 0xab, 
-0xa0, 0x28, 0xfa, 0xc9, 0xcd, 0x21, 0x17, 0x32, 0x6, 0x2b, 0xcd, 0xd6, 0xb, 0x2b, 0xcd, 0xbd, 
-0xb, 0xcd, 0x26, 0x10, 0xcd, 0x61, 0xc, 0x7a, 0xb7, 0xc2, 0x67, 0xc, 0xcd, 0xbe, 0xb, 0x7b, 
-0xc9, 0xcd, 0x6f, 0xc, 0x1a, 0x18, 0xb2, 0xcd, 0x6c, 0xc, 0xd5, 0xcd, 0xd6, 0xb, 0xcd, 0x21, 
-0x17, 0xd1, 0x12, 0xc9, 0xcd, 0x6f, 0xc, 0xeb, 0x46, 0x23, 0x7e, 0xc3, 0xb1, 0x13, 0xcd, 0x6c, 
-0xc, 0xd5, 0xcd, 0xd6, 0xb, 0xcd, 0x6c, 0xc, 0xe3, 0x73, 0x23, 0x72, 0xe1, 0xc9, 0x21, 0x4, 
-0x1c, 0xcd, 0xee, 0x19, 0x18, 0x9, 0xcd, 0xee, 0x19, 0x21, 0xc1, 0xd1, 0xcd, 0xc0, 0x19, 0x78, 
-0xb7, 0xc8, 0x3a, 0xe8, 0x2b, 0xb7, 0xca, 0xe0, 0x19, 0x90, 0x30, 0xc, 0x2f, 0x3c, 0xeb, 0xcd, 
-0xc8, 0x19, 0xeb, 0xcd, 0xe0, 0x19, 0xc1, 0xd1, 0xfe, 0x19, 0xd0, 0xf5, 0xcd, 0x3, 0x1a, 0x67, 
-0xf1, 0xcd, 0x2a, 0x18, 0xb4, 0x21, 0xe5, 0x2b, 0xf2, 0xab, 0x17, 0xcd, 0xa, 0x18, 0x30, 0x4b, 
-0x23, 0x34, 0x28, 0x63, 0x2e, 0x1, 0xcd, 0x3e, 0x18, 0x18, 0x40, 0xaf, 0x90, 0x47, 0x7e, 0x9b, 
-0x5f, 0x23, 0x7e, 0x9a, 0x57, 0x23, 0x7e, 0x99, 0x4f, 0xdc, 0x16, 0x18, 0x68, 0x63, 0xaf, 0x47, 
-0x79, 0xb7, 0x20, 0x16, 0x4a, 0x54, 0x65, 0x6f, 0x78, 0xd6, 0x8, 0xfe, 0xe0, 0x20, 0xf0, 0xaf, 
-0x32, 0xe8, 0x2b, 0xc9, 0x5, 0x29, 0xcb, 0x12, 0xcb, 0x11, 0xf2, 0xd4, 0x17, 0x78, 0x5c, 0x45, 
-0xb7, 0x28, 0x8, 0x21, 0xe8, 0x2b, 0x86, 0x77, 0x30, 0xe5, 0xc8, 0x78, 0x21, 0xe8, 0x2b, 0xb7, 
-0xfc, 0xfd, 0x17, 0x46, 0x23, 0x7e, 0xe6, 0x80, 0xa9, 0x4f, 0xc3, 0xe0, 0x19, 0x1c, 0xc0, 0x14, 
-0xc0, 0xc, 0xc0, 0xe, 0x80, 0x34, 0xc0, 0xc3, 0x53, 0x19, 0x7e, 0x83, 0x5f, 0x23, 0x7e, 0x8a, 
-0x57, 0x23, 0x7e, 0x89, 0x4f, 0xc9, 0x21, 0xe9, 0x2b, 0x7e, 0x2f, 0x77, 0xaf, 0x6f, 0x90, 0x47, 
-0x7d, 0x9b, 0x5f, 0x7d, 0x9a, 0x57, 0x7d, 0x99, 0x4f, 0xc9, 0x6, 0x0, 0xd6, 0x8, 0x38, 0x7, 
-0x43, 0x5a, 0x51, 0xe, 0x0, 0x18, 0xf5, 0xc6, 0x9, 0x6f, 0xaf, 0x2d, 0xc8, 0x79, 0x1f, 0x4f, 
-0xcb, 0x1a, 0xcb, 0x1b, 0xcb, 0x18, 0x18, 0xf2, 0x0, 0x0, 0x0, 0x81, 0x3, 0xaa, 0x56, 0x19, 
-0x80, 0xf1, 0x22, 0x76, 0x80, 0x45, 0xaa, 0x38, 0x82, 0xcd, 0x97, 0x19, 0xb7, 0xea, 0x67, 0xc, 
-0x21, 0xe8, 0x2b, 0x7e, 0x1, 0x35, 0x80, 0x11, 0xf3, 0x4, 0x90, 0xf5, 0x70, 0xd5, 0xc5, 0xcd, 
-0x6f, 0x17, 0xc1, 0xd1, 0x4, 0xcd, 0xf5, 0x18, 0x21, 0x48, 0x18, 0xcd, 0x66, 0x17, 0x21, 0x4c, 
-0x18, 0xcd, 0xce, 0x1c, 0x1, 0x80, 0x80, 0x11, 0x0, 0x0, 0xcd, 0x6f, 0x17, 0xf1, 0xcd, 0xb, 
-0x1b, 0x1, 0x31, 0x80, 0x11, 0x18, 0x72, 0x21, 0xc1, 0xd1, 0xcd, 0x97, 0x19, 0xc8, 0x2e, 0x0, 
-0xcd, 0x58, 0x19, 0x79, 0x32, 0xf7, 0x2b, 0xeb, 0x22, 0xf8, 0x2b, 0x1, 0x0, 0x0, 0x50, 0x58, 
-0x21, 0xbc, 0x17, 0xe5, 0x21, 0xbc, 0x18, 0xe5, 0xe5, 0x21, 0xe5, 0x2b, 0x7e, 0x23, 0xb7, 0x28, 
-0x21, 0xe5, 0x2e, 0x8, 0x1f, 0x67, 0x79, 0x30, 0xb, 0xe5, 0x2a, 0xf8, 0x2b, 0x19, 0xeb, 0xe1, 
-0x3a, 0xf7, 0x2b, 0x89, 0x1f, 0x4f, 0xcb, 0x1a, 0xcb, 0x1b, 0xcb, 0x18, 0x2d, 0x7c, 0x20, 0xe4, 
-0xe1, 0xc9, 0x43, 0x5a, 0x51, 0x4f, 0xc9, 0xcd, 0xc8, 0x19, 0x1, 0x20, 0x84, 0x11, 0x0, 0x0, 
-0xcd, 0xe0, 0x19, 0xc1, 0xd1, 0xcd, 0x97, 0x19, 0xca, 0x4b, 0x6, 0x2e, 0xff, 0xcd, 0x58, 0x19, 
-0x34, 0x34, 0x2b, 0x7e, 0x32, 0x14, 0x2b, 0x2b, 0x7e, 0x32, 0x10, 0x2b, 0x2b, 0x7e, 0x32, 0xc, 
-0x2b, 0x41, 0xeb, 0xaf, 0x4f, 0x57, 0x5f, 0x32, 0x17, 0x2b, 0xe5, 0xc5, 0x7d, 0xcd, 0xb, 0x2b, 
-0xde, 0x0, 0x3f, 0x30, 0x7, 0x32, 0x17, 0x2b, 0xf1, 0xf1, 0x37, 0xd2, 0xc1, 0xe1, 0x79, 0x3c, 
-0x3d, 0x1f, 0xfa, 0xec, 0x17, 0x17, 0xcb, 0x13, 0xcb, 0x12, 0xcb, 0x11, 0x29, 0xcb, 0x10, 0x3a, 
-0x17, 0x2b, 0x17, 0x32, 0x17, 0x2b, 0x79, 0xb2, 0xb3, 0x20, 0xcf, 0xe5, 0x21, 0xe8, 0x2b, 0x35, 
-0xe1, 0x20, 0xc7, 0x1e, 0xa, 0xc3, 0x56, 0x6, 0x78, 0xb7, 0xca, 0x7c, 0x19, 0x7d, 0x21, 0xe8, 
-0x2b, 0xae, 0x80, 0x47, 0x1f, 0xa8, 0x78, 0xf2, 0x7b, 0x19, 0xc6, 0x80, 0x77, 0xca, 0xe0, 0x18, 
-0xcd, 0x3, 0x1a, 0x77, 0x2b, 0xc9, 0xcd, 0x97, 0x19, 0x2f, 0xe1, 0xb7, 0xe1, 0xf2, 0xcf, 0x17, 
-0x18, 0xd1, 0xcd, 0xeb, 0x19, 0x78, 0xb7, 0xc8, 0xc6, 0x2, 0x38, 0xc7, 0x47, 0xcd, 0x6f, 0x17, 
-0x21, 0xe8, 0x2b, 0x34, 0xc0, 0x18, 0xbc, 0x3a, 0xe8, 0x2b, 0xb7, 0xc8, 0x3a, 0xe7, 0x2b, 0xfe, 
-0x2f, 0x17, 0x9f, 0xc0, 0x3c, 0xc9, 0xcd, 0x97, 0x19, 0x6, 0x88, 0x11, 0x0, 0x0, 0x21, 0xe8, 
-0x2b, 0x4f, 0x70, 0x6, 0x0, 0x23, 0x36, 0x80, 0x17, 0xc3, 0xb9, 0x17, 0xcd, 0x97, 0x19, 0xf0, 
-0x21, 0xe7, 0x2b, 0x7e, 0xee, 0x80, 0x77, 0xc9, 0xeb, 0x2a, 0xe5, 0x2b, 0xe3, 0xe5, 0x2a, 0xe7, 
-0x2b, 0xe3, 0xe5, 0xeb, 0xc9, 0x1, 0x49, 0x82, 0x11, 0xdb, 0xf, 0x18, 0x3, 0xcd, 0xee, 0x19, 
-0xed, 0x53, 0xe5, 0x2b, 0xed, 0x43, 0xe7, 0x2b, 0x50, 0x59, 0xc9, 0x21, 0xe5, 0x2b, 0x5e, 0x23, 
-0x56, 0x23, 0x4e, 0x23, 0x46, 0x23, 0xc9, 0x11, 0xe5, 0x2b, 0x6, 0x4, 0x1a, 0x77, 0x13, 0x23, 
-0x10, 0xfa, 0xc9, 0x21, 0xe7, 0x2b, 0x7e, 0x7, 0x37, 0x1f, 0x77, 0x3f, 0x1f, 0x23, 0x23, 0x77, 
-0x79, 0x7, 0x37, 0x1f, 0x4f, 0x1f, 0xae, 0xc9, 0x78, 0xb7, 0xca, 0x97, 0x19, 0x21, 0xa0, 0x19, 
-0xe5, 0xcd, 0x97, 0x19, 0x79, 0xc8, 0x21, 0xe7, 0x2b, 0xae, 0x79, 0xf8, 0xcd, 0x32, 0x1a, 0x1f, 
-0xa9, 0xc9, 0x23, 0x78, 0xbe, 0xc0, 0x2b, 0x79, 0xbe, 0xc0, 0x2b, 0x7a, 0xbe, 0xc0, 0x2b, 0x7b, 
-0x96, 0xc0, 0xe1, 0xe1, 0xc9, 0x47, 0x4f, 0x57, 0x5f, 0xb7, 0xc8, 0xe5, 0xcd, 0xeb, 0x19, 0xcd, 
-0x3, 0x1a, 0xae, 0x67, 0xfc, 0x69, 0x1a, 0x3e, 0x98, 0x90, 0xcd, 0x2a, 0x18, 0x7c, 0x17, 0xdc, 
-0xfd, 0x17, 0x6, 0x0, 0xdc, 0x16, 0x18, 0xe1, 0xc9, 0x1b, 0x7a, 0xa3, 0x3c, 0xc0, 0xb, 0xc9, 
-0x21, 0xe8, 0x2b, 0x7e, 0xfe, 0x98, 0x3a, 0xe5, 0x2b, 0xd0, 0x7e, 0xcd, 0x45, 0x1a, 0x36, 0x98, 
-0x7b, 0xf5, 0x79, 0x17, 0xcd, 0xb9, 0x17, 0xf1, 0xc9, 0x21, 0x0, 0x0, 0x78, 0xb1, 0xc8, 0x3e, 
-0x10, 0x29, 0x38, 0x6, 0xeb, 0x29, 0xeb, 0x30, 0x4, 0x9, 0xda, 0xb, 0x13, 0x3d, 0x20, 0xf1, 
-0xc9, 0xfe, 0x2d, 0xf5, 0x28, 0x5, 0xfe, 0x2b, 0x28, 0x1, 0x2b, 0xcd, 0xcf, 0x17, 0x47, 0x57, 
-0x5f, 0x2f, 0x4f, 0xcd, 0xbd, 0xb, 0x38, 0x3d, 0xfe, 0x2e, 0x28, 0x16, 0xfe, 0x45, 0x20, 0x15, 
-0xcd, 0xbd, 0xb, 0xcd, 0x4d, 0x11, 0xcd, 0xbd, 0xb, 0x38, 0x4b, 0x14, 0x20, 0x7, 0xaf, 0x93, 
-0x5f, 0xc, 0xc, 0x28, 0xde, 0xe5, 0x7b, 0x90, 0xf4, 0xed, 0x1a, 0xf2, 0xe4, 0x1a, 0xf5, 0xcd, 
-0xe7, 0x18, 0xf1, 0x3c, 0x20, 0xf2, 0xd1, 0xf1, 0xcc, 0xc0, 0x19, 0xeb, 0xc9, 0xc8, 0xf5, 0xcd, 
-0x82, 0x19, 0xf1, 0x3d, 0xc9, 0xd5, 0x57, 0x78, 0x89, 0x47, 0xc5, 0xe5, 0xd5, 0xcd, 0x82, 0x19, 
-0xf1, 0xd6, 0x30, 0xcd, 0xb, 0x1b, 0xe1, 0xc1, 0xd1, 0x18, 0xa8, 0xcd, 0xc8, 0x19, 0xcd, 0xa9, 
-0x19, 0xc1, 0xd1, 0xc3, 0x6f, 0x17, 0x7b, 0x7, 0x7, 0x83, 0x7, 0x86, 0xd6, 0x30, 0x5f, 0x18, 
-0xa5, 0xe5, 0x21, 0xd, 0x6, 0xcd, 0xc9, 0x14, 0xe1, 0xeb, 0xaf, 0x6, 0x98, 0xcd, 0xae, 0x19, 
-0x21, 0xc8, 0x14, 0xe5, 0x21, 0xea, 0x2b, 0xe5, 0xcd, 0x97, 0x19, 0x36, 0x20, 0xf2, 0x42, 0x1b, 
-0x36, 0x2d, 0x23, 0x36, 0x30, 0xca, 0xef, 0x1b, 0xe5, 0xfc, 0xc0, 0x19, 0xaf, 0xf5, 0xcd, 0xf5, 
-0x1b, 0x1, 0x43, 0x91, 0x11, 0xf8, 0x4f, 0xcd, 0x18, 0x1a, 0xb7, 0xe2, 0x6e, 0x1b, 0xf1, 0xcd, 
-0xee, 0x1a, 0xf5, 0x18, 0xec, 0xcd, 0xe7, 0x18, 0xf1, 0x3c, 0xf5, 0xcd, 0xf5, 0x1b, 0xcd, 0x5e, 
-0x17, 0x3c, 0xcd, 0x45, 0x1a, 0xcd, 0xe0, 0x19, 0x1, 0x6, 0x3, 0xf1, 0x81, 0x3c, 0xfa, 0x89, 
-0x1b, 0xfe, 0x8, 0x30, 0x4, 0x3c, 0x47, 0x3e, 0x2, 0x3d, 0x3d, 0xe1, 0xf5, 0x11, 0x8, 0x1c, 
-0x5, 0x20, 0x6, 0x36, 0x2e, 0x23, 0x36, 0x30, 0x23, 0x5, 0x36, 0x2e, 0xcc, 0xf5, 0x19, 0xc5, 
-0xe5, 0xd5, 0xcd, 0xeb, 0x19, 0xe1, 0x6, 0x2f, 0x4, 0x7b, 0x96, 0x5f, 0x23, 0x7a, 0x9e, 0x57, 
-0x23, 0x79, 0x9e, 0x4f, 0x2b, 0x2b, 0x30, 0xf0, 0xcd, 0xa, 0x18, 0x23, 0xcd, 0xe0, 0x19, 0xeb, 
-0xe1, 0x70, 0x23, 0xc1, 0xd, 0x20, 0xd2, 0x5, 0x28, 0xb, 0x2b, 0x7e, 0xfe, 0x30, 0x28, 0xfa, 
-0xfe, 0x2e, 0xc4, 0xf5, 0x19, 0xf1, 0x28, 0x1a, 0x36, 0x45, 0x23, 0x36, 0x2b, 0xf2, 0xe4, 0x1b, 
-0x36, 0x2d, 0x2f, 0x3c, 0x6, 0x2f, 0x4, 0xd6, 0xa, 0x30, 0xfb, 0xc6, 0x3a, 0x23, 0x70, 0x23, 
-0x77, 0x23, 0x71, 0xe1, 0xc9, 0x1, 0x74, 0x94, 0x11, 0xf7, 0x23, 0xcd, 0x18, 0x1a, 0xb7, 0xe1, 
-0xe2, 0x65, 0x1b, 0xe9, 0x0, 0x0, 0x0, 0x80, 0xa0, 0x86, 0x1, 0x10, 0x27, 0x0, 0xe8, 0x3, 
-0x0, 0x64, 0x0, 0x0, 0xa, 0x0, 0x0, 0x1, 0x0, 0x0, 0x21, 0xc0, 0x19, 0xe3, 0xe9, 0xcd, 
-0xc8, 0x19, 0x21, 0x4, 0x1c, 0xcd, 0xdd, 0x19, 0xc1, 0xd1, 0xcd, 0x97, 0x19, 0x78, 0xca, 0x6d, 
-0x1c, 0xf2, 0x38, 0x1c, 0xb7, 0xca, 0x4b, 0x6, 0xb7, 0xca, 0xd0, 0x17, 0xd5, 0xc5, 0x79, 0xf6, 
-0x7f, 0xcd, 0xeb, 0x19, 0xf2, 0x55, 0x1c, 0xd5, 0xc5, 0xcd, 0x70, 0x1a, 0xc1, 0xd1, 0xf5, 0xcd, 
-0x18, 0x1a, 0xe1, 0x7c, 0x1f, 0xe1, 0x22, 0xe7, 0x2b, 0xe1, 0x22, 0xe5, 0x2b, 0xdc, 0x1a, 0x1c, 
-0xcc, 0xc0, 0x19, 0xd5, 0xc5, 0xcd, 0x59, 0x18, 0xc1, 0xd1, 0xcd, 0x9a, 0x18, 0xcd, 0xc8, 0x19, 
-0x1, 0x38, 0x81, 0x11, 0x3b, 0xaa, 0xcd, 0x9a, 0x18, 0x3a, 0xe8, 0x2b, 0xfe, 0x88, 0xd2, 0x76, 
-0x19, 0xcd, 0x70, 0x1a, 0xc6, 0x80, 0xc6, 0x2, 0xda, 0x76, 0x19, 0xf5, 0x21, 0x48, 0x18, 0xcd, 
-0x61, 0x17, 0xcd, 0x91, 0x18, 0xf1, 0xc1, 0xd1, 0xf5, 0xcd, 0x6c, 0x17, 0xcd, 0xc0, 0x19, 0x21, 
-0xad, 0x1c, 0xcd, 0xdd, 0x1c, 0x11, 0x0, 0x0, 0xc1, 0x4a, 0xc3, 0x9a, 0x18, 0x8, 0x40, 0x2e, 
-0x94, 0x74, 0x70, 0x4f, 0x2e, 0x77, 0x6e, 0x2, 0x88, 0x7a, 0xe6, 0xa0, 0x2a, 0x7c, 0x50, 0xaa, 
-0xaa, 0x7e, 0xff, 0xff, 0x7f, 0x7f, 0x0, 0x0, 0x80, 0x81, 0x0, 0x0, 0x0, 0x81, 0xcd, 0xc8, 
-0x19, 0x11, 0x98, 0x18, 0xd5, 0xe5, 0xcd, 0xeb, 0x19, 0xcd, 0x9a, 0x18, 0xe1, 0xcd, 0xc8, 0x19, 
-0x7e, 0x23, 0xcd, 0xdd, 0x19, 0x6, 0xf1, 0xc1, 0xd1, 0x3d, 0xc8, 0xd5, 0xc5, 0xf5, 0xe5, 0xcd, 
-0x9a, 0x18, 0xe1, 0xcd, 0xee, 0x19, 0xe5, 0xcd, 0x6f, 0x17, 0xe1, 0x18, 0xe9, 0xcd, 0x97, 0x19, 
-0x21, 0x1b, 0x2b, 0xfa, 0x5d, 0x1d, 0x21, 0x3c, 0x2b, 0xcd, 0xdd, 0x19, 0x21, 0x1b, 0x2b, 0xc8, 
-0x86, 0xe6, 0x7, 0x6, 0x0, 0x77, 0x23, 0x87, 0x87, 0x4f, 0x9, 0xcd, 0xee, 0x19, 0xcd, 0x9a, 
-0x18, 0x3a, 0x1a, 0x2b, 0x3c, 0xe6, 0x3, 0x6, 0x0, 0xfe, 0x1, 0x88, 0x32, 0x1a, 0x2b, 0x21, 
-0x60, 0x1d, 0x87, 0x87, 0x4f, 0x9, 0xcd, 0x61, 0x17, 0xcd, 0xeb, 0x19, 0x7b, 0x59, 0xee, 0x4f, 
-0x4f, 0x36, 0x80, 0x2b, 0x46, 0x36, 0x80, 0x21, 0x19, 0x2b, 0x34, 0x7e, 0xd6, 0xab, 0x20, 0x4, 
-0x77, 0xc, 0x15, 0x1c, 0xcd, 0xbc, 0x17, 0x21, 0x3c, 0x2b, 0xc3, 0xf7, 0x19, 0x77, 0x2b, 0x77, 
-0x2b, 0x77, 0x18, 0xd5, 0x68, 0xb1, 0x46, 0x68, 0x99, 0xe9, 0x92, 0x69, 0x10, 0xd1, 0x75, 0x68, 
-0x21, 0xba, 0x1d, 0xcd, 0x61, 0x17, 0xcd, 0xc8, 0x19, 0x1, 0x49, 0x83, 0x11, 0xdb, 0xf, 0xcd, 
-0xe0, 0x19, 0xc1, 0xd1, 0xcd, 0xf5, 0x18, 0xcd, 0xc8, 0x19, 0xcd, 0x70, 0x1a, 0xc1, 0xd1, 0xcd, 
-0x6c, 0x17, 0x21, 0xbe, 0x1d, 0xcd, 0x66, 0x17, 0xcd, 0x97, 0x19, 0x37, 0xf2, 0xa6, 0x1d, 0xcd, 
-0x5e, 0x17, 0xcd, 0x97, 0x19, 0xb7, 0xf5, 0xf4, 0xc0, 0x19, 0x21, 0xbe, 0x1d, 0xcd, 0x61, 0x17, 
-0xf1, 0xd4, 0xc0, 0x19, 0x21, 0xc2, 0x1d, 0xc3, 0xce, 0x1c, 0xdb, 0xf, 0x49, 0x81, 0x0, 0x0, 
-0x0, 0x7f, 0x5, 0xba, 0xd7, 0x1e, 0x86, 0x64, 0x26, 0x99, 0x87, 0x58, 0x34, 0x23, 0x87, 0xe0, 
-0x5d, 0xa5, 0x86, 0xda, 0xf, 0x49, 0x83, 0xcd, 0xc8, 0x19, 0xcd, 0x76, 0x1d, 0xc1, 0xe1, 0xcd, 
-0xc8, 0x19, 0xeb, 0xcd, 0xe0, 0x19, 0xcd, 0x70, 0x1d, 0xc3, 0xf3, 0x18, 0xcd, 0x97, 0x19, 0xfc, 
-0x1a, 0x1c, 0xfc, 0xc0, 0x19, 0x3a, 0xe8, 0x2b, 0xfe, 0x81, 0xda, 0x9, 0x1e, 0x1, 0x0, 0x81, 
-0x51, 0x59, 0xcd, 0xf5, 0x18, 0x21, 0x66, 0x17, 0xe5, 0x21, 0x13, 0x1e, 0xcd, 0xce, 0x1c, 0x21, 
-0xba, 0x1d, 0xc9, 0x9, 0x4a, 0xd7, 0x3b, 0x78, 0x2, 0x6e, 0x84, 0x7b, 0xfe, 0xc1, 0x2f, 0x7c, 
-0x74, 0x31, 0x9a, 0x7d, 0x84, 0x3d, 0x5a, 0x7d, 0xc8, 0x7f, 0x91, 0x7e, 0xe4, 0xbb, 0x4c, 0x7e, 
-0x6c, 0xaa, 0xaa, 0x7f, 0x0, 0x0, 0x0, 0x81, 0xcd, 0x49, 0x1e, 0x28, 0x3, 0xcd, 0x6c, 0xc, 
-0xe5, 0x21, 0x47, 0x1e, 0xe5, 0xeb, 0xe9, 0xe1, 0xc9, 0xfe, 0xae, 0xc0, 0x11, 0x0, 0x0, 0xcd, 
-0xbd, 0xb, 0xc8, 0x38, 0xb, 0xfe, 0x94, 0x28, 0x16, 0xfe, 0x47, 0xd2, 0x48, 0x6, 0xd6, 0x7, 
-0xd6, 0x30, 0xda, 0x48, 0x6, 0xeb, 0x29, 0x29, 0x29, 0x29, 0xb5, 0x6f, 0xeb, 0x18, 0xe0, 0x7b, 
-0x87, 0x87, 0x87, 0x87, 0xf6, 0xd, 0x57, 0x1e, 0xef, 0x18, 0xd4, 0xd5, 0xe5, 0x36, 0x0, 0x23, 
-0xcd, 0x89, 0x9, 0x20, 0xf8, 0xe3, 0xe5, 0xcd, 0xfe, 0x15, 0xcd, 0x9, 0x15, 0x2a, 0xc4, 0x2b, 
-0xed, 0x5b, 0x56, 0x2b, 0xaf, 0xed, 0x52, 0xd1, 0xe3, 0xed, 0x52, 0xe5, 0xcd, 0x28, 0x20, 0x4f, 
-0xcd, 0xe4, 0x20, 0x47, 0xe1, 0xcd, 0xe4, 0x20, 0x12, 0x13, 0x2b, 0x7d, 0xb4, 0x20, 0xf6, 0xe1, 
-0xcd, 0xe4, 0x20, 0x5f, 0xcd, 0xe4, 0x20, 0x57, 0xaf, 0xed, 0x52, 0x38, 0x44, 0x2a, 0x56, 0x2b, 
-0x23, 0xcd, 0xe4, 0x20, 0x77, 0x23, 0x1b, 0x7b, 0xb2, 0x20, 0xf6, 0xd1, 0xe3, 0xc5, 0xcd, 0xf8, 
-0x1f, 0xe3, 0xed, 0x42, 0x20, 0x2d, 0xe1, 0xcd, 0x77, 0x20, 0xe3, 0x2b, 0xd5, 0xed, 0x5b, 0xc4, 
-0x2b, 0xed, 0xb8, 0xed, 0x53, 0xc4, 0x2b, 0xe1, 0x42, 0x4b, 0x3, 0xd1, 0x2b, 0x70, 0x2b, 0x71, 
-0x2b, 0x35, 0x3, 0x20, 0xfc, 0xb, 0x2b, 0xcd, 0x89, 0x9, 0x20, 0xf0, 0xe1, 0xcd, 0xfd, 0x20, 
-0xc9, 0xd1, 0xe1, 0x36, 0x0, 0x23, 0xcd, 0x89, 0x9, 0x20, 0xf8, 0x18, 0x29, 0xcd, 0x87, 0x1f, 
-0xe5, 0xe2, 0x7b, 0x1e, 0xeb, 0xed, 0x52, 0xe5, 0xcd, 0x28, 0x20, 0x4f, 0xcd, 0xe4, 0x20, 0x47, 
-0xe1, 0xcd, 0xe4, 0x20, 0x12, 0x13, 0x2b, 0x7d, 0xb4, 0x20, 0xf6, 0xe1, 0xc5, 0xcd, 0xf8, 0x1f, 
-0xe1, 0xed, 0x42, 0xe1, 0x28, 0xc7, 0xcd, 0x1d, 0x21, 0x21, 0x3f, 0x1f, 0xc3, 0x71, 0x6, 0x42, 
-0x41, 0x44, 0x0, 0xfe, 0xae, 0x28, 0xc6, 0xcd, 0xb0, 0x1f, 0xed, 0x5b, 0xd7, 0x2b, 0x1b, 0x1b, 
-0x21, 0x0, 0x0, 0x39, 0x1, 0xd1, 0xff, 0xed, 0x52, 0x9, 0x44, 0x4d, 0xcd, 0x28, 0x20, 0x6f, 
-0xcd, 0xe4, 0x20, 0x67, 0xe5, 0xed, 0x42, 0xe1, 0xd2, 0x3e, 0x6, 0xcd, 0xe4, 0x20, 0x12, 0x13, 
-0x2b, 0x7d, 0xb4, 0x20, 0xf6, 0xed, 0x53, 0xd7, 0x2b, 0x21, 0x12, 0x6, 0xcd, 0xc9, 0x14, 0xc3, 
-0x8a, 0x7, 0x1e, 0x26, 0xc3, 0x56, 0x6, 0xcd, 0xac, 0x1f, 0xe1, 0xcd, 0xcc, 0xb, 0x3b, 0x3e, 
-0x1, 0x32, 0xcc, 0x2b, 0xcd, 0x6, 0x12, 0x32, 0xcc, 0x2b, 0xe3, 0xe5, 0x60, 0x69, 0xeb, 0x19, 
-0xeb, 0x4e, 0x6, 0x0, 0x9, 0x9, 0x23, 0x3a, 0xae, 0x2b, 0xb7, 0xc9, 0x3e, 0xd4, 0x23, 0x1, 
-0x3e, 0xd3, 0xf5, 0x3a, 0x5d, 0x2b, 0xa7, 0x3e, 0x0, 0x32, 0x5d, 0x2b, 0x28, 0x4, 0xf1, 0xc6, 
-0x4, 0xf5, 0xcd, 0xbe, 0xb, 0xcd, 0x3a, 0x10, 0xf1, 0xe3, 0xe5, 0xf5, 0xcd, 0x3f, 0x16, 0x21, 
-0xf7, 0x2b, 0x6, 0xd, 0x2b, 0x36, 0x20, 0x10, 0xfb, 0xd5, 0x11, 0x82, 0x1f, 0x73, 0x23, 0x72, 
-0xd1, 0x23, 0xf1, 0x77, 0x23, 0x77, 0x23, 0x77, 0x23, 0xeb, 0x6, 0x0, 0x79, 0xfe, 0x9, 0x38, 
-0x4, 0xd, 0x23, 0x18, 0xf7, 0xed, 0xb0, 0xc9, 0xe5, 0xaf, 0x47, 0x86, 0xcd, 0x3, 0x20, 0x20, 
-0xfa, 0xe1, 0xc9, 0x4f, 0x30, 0x1, 0x4, 0x23, 0xcd, 0x89, 0x9, 0x79, 0xc9, 0xf5, 0x3a, 0x7, 
-0x2b, 0xcb, 0x4f, 0xcb, 0xcf, 0x32, 0x7, 0x2b, 0x3e, 0x13, 0x20, 0x2, 0xc6, 0x8, 0x32, 0x8, 
-0x2b, 0x21, 0xea, 0x2b, 0xf1, 0xc3, 0xd5, 0x20, 0x3a, 0x7, 0x2b, 0xcb, 0x47, 0xcb, 0xc7, 0x32, 
-0x7, 0x2b, 0x3e, 0x12, 0x20, 0x2, 0xc6, 0x8, 0x32, 0x9, 0x2b, 0x21, 0xea, 0x2b, 0xc3, 0xe4, 
-0x20, 0xfe, 0xae, 0x28, 0x24, 0xcd, 0x97, 0x9, 0xcd, 0xb0, 0x1f, 0x2a, 0xd7, 0x2b, 0x11, 0xff, 
-0xd3, 0x19, 0x44, 0x4d, 0x11, 0x1, 0x2c, 0xcd, 0xb5, 0x20, 0xe1, 0xe5, 0x21, 0x7, 0x2b, 0xcb, 
-0x8e, 0x11, 0x43, 0x3, 0xcd, 0xf6, 0x22, 0xe1, 0xc9, 0xcd, 0x87, 0x1f, 0xe2, 0x89, 0x20, 0xcd, 
-0xf8, 0x1f, 0xeb, 0xed, 0x52, 0x18, 0xe0, 0xe5, 0x1, 0x0, 0x0, 0x7e, 0x23, 0x77, 0x34, 0x81, 
-0x23, 0x23, 0xcd, 0x3, 0x20, 0x20, 0xf4, 0xe1, 0xc9, 0xcd, 0x77, 0x20, 0xc5, 0xcd, 0xf8, 0x1f, 
-0xeb, 0xed, 0x52, 0xcd, 0xb5, 0x20, 0xc1, 0x79, 0xcd, 0xd5, 0x20, 0x78, 0xeb, 0xcd, 0xd5, 0x20, 
-0x2b, 0x2b, 0x78, 0xb1, 0x28, 0xb4, 0x56, 0x2b, 0x5e, 0x2b, 0x35, 0x28, 0xf3, 0x1a, 0xcd, 0xd5, 
-0x20, 0x13, 0xb, 0x18, 0xf5, 0x23, 0xe5, 0x79, 0xcd, 0xd, 0x20, 0x78, 0xe1, 0xcd, 0xd5, 0x20, 
-0x2b, 0x7d, 0xb4, 0x1a, 0x13, 0x20, 0xf6, 0xc9, 0x3a, 0x8, 0x2b, 0xe6, 0x7, 0xd6, 0x1, 0xc9, 
-0xcd, 0x1d, 0x21, 0x3e, 0xc, 0xf5, 0xd5, 0x57, 0x3a, 0x8, 0x2b, 0x5f, 0x7a, 0xcd, 0xf6, 0x22, 
-0x7b, 0xd1, 0x18, 0x3c, 0xd5, 0x3a, 0x9, 0x2b, 0x5f, 0xcd, 0xf6, 0x22, 0x7b, 0x32, 0x9, 0x2b, 
-0x7a, 0x18, 0x6, 0xd5, 0x1e, 0x80, 0xcd, 0xf6, 0x22, 0xcb, 0x7b, 0xd1, 0xc9, 0xf5, 0xe5, 0xd5, 
-0xc5, 0x11, 0x42, 0x3, 0x6, 0x6, 0x7a, 0x21, 0x7, 0x2b, 0xcb, 0x3e, 0xdc, 0xf6, 0x22, 0x1c, 
-0x10, 0xf8, 0xc1, 0xd1, 0xe1, 0x3e, 0xf5, 0x3e, 0x0, 0x32, 0x9, 0x2b, 0x3e, 0xf5, 0x3e, 0x1, 
-0x32, 0x8, 0x2b, 0xf1, 0xc9, 0x7e, 0xfe, 0x23, 0x20, 0x31, 0xcd, 0xbd, 0xb, 0x30, 0x38, 0x23, 
-0xe5, 0xe6, 0x3, 0x28, 0x12, 0x21, 0x7, 0x2b, 0x87, 0xfe, 0x4, 0x28, 0x12, 0x30, 0x16, 0xcb, 
-0x4e, 0xcb, 0xce, 0x20, 0x2, 0xc6, 0x8, 0x3c, 0x32, 0x8, 0x2b, 0xe1, 0xc3, 0xbe, 0xb, 0xcb, 
-0x5e, 0xcb, 0xde, 0x18, 0xee, 0xcb, 0x6e, 0xcb, 0xee, 0x18, 0xe8, 0xe5, 0xaf, 0x18, 0xe8, 0x7e, 
-0xfe, 0x23, 0x20, 0x30, 0xcd, 0xbd, 0xb, 0xd2, 0x48, 0x6, 0x23, 0xe5, 0xe6, 0x3, 0x28, 0x12, 
-0x21, 0x7, 0x2b, 0x87, 0xfe, 0x4, 0x28, 0x10, 0x38, 0x14, 0xcb, 0x66, 0xcb, 0xe6, 0x20, 0x2, 
-0xc6, 0x8, 0x32, 0x9, 0x2b, 0xe1, 0x18, 0xc4, 0xcb, 0x56, 0xcb, 0xd6, 0x18, 0xf0, 0xcb, 0x46, 
-0xcb, 0xc6, 0x18, 0xea, 0xe5, 0xaf, 0x18, 0xea, 0xc5, 0xcd, 0x2a, 0x1b, 0xe1, 0x23, 0x23, 0x23, 
-0x23, 0x1, 0x61, 0x2b, 0xc5, 0x18, 0x3, 0xcd, 0xd7, 0x21, 0x7e, 0x23, 0xfe, 0x22, 0x28, 0x16, 
-0xb7, 0x28, 0x1f, 0xf2, 0xa7, 0x21, 0xc5, 0xcd, 0x9a, 0xa, 0xc1, 0xcd, 0xd7, 0x21, 0x1a, 0x13, 
-0xb7, 0xf2, 0xbb, 0x21, 0x18, 0xe4, 0xcd, 0xd7, 0x21, 0x7e, 0x23, 0xfe, 0x22, 0x28, 0xd8, 0xb7, 
-0x20, 0xf4, 0x3e, 0x20, 0x3, 0x18, 0xc, 0x3, 0x2, 0xe5, 0x21, 0x56, 0xd4, 0x9, 0xe1, 0xd0, 
-0xe1, 0x3e, 0x2a, 0xcd, 0xd5, 0x20, 0xaf, 0x2, 0xe1, 0x77, 0x23, 0xe5, 0xcd, 0xf1, 0x8, 0xd1, 
-0x23, 0x36, 0x0, 0x2b, 0x36, 0x20, 0xcd, 0xe4, 0x20, 0xfe, 0xa, 0x20, 0x5, 0xcd, 0x12, 0x22, 
-0x3c, 0xc9, 0xcd, 0xf, 0x22, 0xc8, 0xcd, 0x27, 0x22, 0xd8, 0xcd, 0x32, 0x22, 0x18, 0xe7, 0xfe, 
-0xd, 0xc0, 0x3e, 0x9, 0xcd, 0xd5, 0x20, 0x23, 0x7e, 0xb7, 0x20, 0xf6, 0x2b, 0x7e, 0xfe, 0x20, 
-0x20, 0x2, 0x36, 0x0, 0xc3, 0x5e, 0xe, 0xfe, 0x3, 0x28, 0x2, 0xa7, 0xc9, 0xcd, 0x12, 0x22, 
-0x37, 0xc9, 0xfe, 0x8, 0x28, 0x44, 0xfe, 0x9, 0x28, 0x2a, 0xfe, 0x1f, 0x28, 0x47, 0xfe, 0x19, 
-0xca, 0xc5, 0x22, 0xfe, 0x18, 0xca, 0xcf, 0x22, 0xfe, 0x2, 0xca, 0xdb, 0x22, 0xfe, 0x1a, 0x28, 
-0x48, 0xfe, 0xb, 0xc8, 0xfe, 0xa, 0xc8, 0xfe, 0x1, 0xc8, 0xfe, 0x20, 0x30, 0x5, 0x3f, 0xcd, 
-0xd5, 0x20, 0xc9, 0x77, 0xcd, 0xd5, 0x20, 0x23, 0x7e, 0xb7, 0xc0, 0x11, 0xab, 0x2b, 0xcd, 0x89, 
-0x9, 0x28, 0x7, 0x36, 0x20, 0x23, 0x36, 0x0, 0x18, 0x3, 0xcd, 0xa2, 0x9, 0x2b, 0x7e, 0xb7, 
-0xc0, 0x3e, 0x9, 0x18, 0xdf, 0xe5, 0x23, 0xcd, 0xf1, 0x8, 0xcd, 0xa9, 0x9, 0xd1, 0xaf, 0x2b, 
-0x46, 0x77, 0xcd, 0xa2, 0x9, 0x78, 0x20, 0xf7, 0xc9, 0xcd, 0xa9, 0x9, 0xe5, 0xcd, 0xf1, 0x8, 
-0x11, 0xab, 0x2b, 0xcd, 0x89, 0x9, 0x20, 0xc, 0xcd, 0xa2, 0x9, 0xcd, 0xa9, 0x9, 0xcd, 0xa2, 
-0x9, 0x2b, 0x36, 0x0, 0xd1, 0x44, 0x4d, 0x3, 0x7e, 0x2, 0xb, 0xcd, 0xa2, 0x9, 0x2b, 0x20, 
-0xf7, 0x23, 0x36, 0x20, 0xc9, 0xcd, 0xa2, 0x9, 0x2b, 0x7e, 0xb7, 0x20, 0xf8, 0x18, 0xb2, 0x3e, 
-0x9, 0xcd, 0xd5, 0x20, 0x23, 0x7e, 0xb7, 0x20, 0xf6, 0x18, 0x90, 0xcd, 0xc5, 0x22, 0xe5, 0x7e, 
-0xb7, 0x28, 0x5, 0x36, 0x20, 0x23, 0x18, 0xf7, 0xe1, 0xcd, 0xf1, 0x8, 0xcd, 0xc5, 0x22, 0x23, 
-0x36, 0x0, 0x2b, 0xc9, 0x1e, 0xff, 0xc3, 0xe, 0x23, 0x20, 0x52, 0x45, 0x57, 0x49, 0x4e, 0x44, 
-0x21, 0x0, 0x0, 0xc3, 0x22, 0x28, 0xc3, 0x8a, 0x23, 0xc3, 0xdc, 0x23, 0x11, 0x23, 0xc3, 0x1, 
-0x28, 0xc9, 0x4e, 0x4b, 0x45, 0x59, 0x24, 0xca, 0x4f, 0x59, 0x53, 0x54, 0xd3, 0x54, 0x52, 0x49, 
-0x4e, 0x47, 0x24, 0xc9, 0x4e, 0x53, 0x54, 0x52, 0xd2, 0x45, 0x4e, 0x55, 0x4d, 0x42, 0x45, 0x52, 
-0xc4, 0x45, 0x4c, 0x45, 0x54, 0x45, 0xd0, 0x41, 0x55, 0x53, 0x45, 0xc2, 0x45, 0x45, 0x50, 0xd7, 
-0x49, 0x4e, 0x44, 0x4f, 0x57, 0xc2, 0x4f, 0x52, 0x44, 0x45, 0x52, 0xc9, 0x4e, 0x4b, 0xd0, 0x41, 
-0x50, 0x45, 0x52, 0xc1, 0x54, 0xc8, 0x53, 0x41, 0x56, 0x45, 0xc8, 0x4c, 0x4f, 0x41, 0x44, 0xd0, 
-0x53, 0x45, 0x54, 0xd0, 0x52, 0x45, 0x53, 0x80, 0x3f, 0x26, 0x79, 0x1, 0xc7, 0x26, 0x59, 0x26, 
-0xf4, 0x23, 0xdd, 0x27, 0x8b, 0x2, 0xd1, 0x2, 0xd8, 0x25, 0xd4, 0x25, 0xd4, 0x25, 0xd4, 0x25, 
-0x26, 0x27, 0x4e, 0x1, 0x44, 0x1, 0x48, 0x6, 0x48, 0x6, 0x7e, 0xfe, 0xdf, 0xd8, 0xfe, 0xe6, 
-0xd0, 0xfe, 0xe1, 0xca, 0x26, 0x27, 0x3a, 0xfd, 0x2b, 0xa7, 0x20, 0x38, 0x3c, 0x32, 0xfd, 0x2b, 
-0x7e, 0xfe, 0xdf, 0x28, 0xd, 0xcd, 0xbd, 0xb, 0xcd, 0xd4, 0x25, 0x7e, 0xfe, 0x3b, 0x28, 0x27, 
-0x18, 0x22, 0xcd, 0xbd, 0xb, 0xcd, 0xd4, 0x25, 0x7e, 0xfe, 0x3b, 0x28, 0x1a, 0xcd, 0xcc, 0xb, 
-0x2c, 0xfe, 0xe0, 0x20, 0xf, 0xcd, 0xbd, 0xb, 0xcd, 0xd4, 0x25, 0xcd, 0xcc, 0xb, 0x3b, 0xcd, 
-0x3, 0xe, 0xc1, 0xc9, 0xc3, 0x48, 0x6, 0xcd, 0xbd, 0xb, 0x18, 0xf3, 0x79, 0xd6, 0x3e, 0x38, 
-0xf3, 0xfe, 0x7, 0xd2, 0xd4, 0x23, 0xeb, 0x1, 0x68, 0x23, 0xe1, 0x6f, 0x9, 0x4e, 0x23, 0x66, 
-0x69, 0xe5, 0xeb, 0xc9, 0xe5, 0x21, 0xa, 0x0, 0x22, 0x54, 0x2b, 0x2a, 0x5f, 0x2b, 0xf5, 0xe5, 
-0x23, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0x22, 0x4e, 0x2b, 0x22, 0x52, 0x2b, 0xed, 0x5b, 0xd7, 0x2b, 
-0x1b, 0x1b, 0xe1, 0xe5, 0x7e, 0x23, 0x66, 0x6f, 0xcd, 0x89, 0x9, 0xe3, 0x20, 0xf4, 0xd1, 0x23, 
-0x23, 0x7e, 0x23, 0x66, 0x6f, 0x22, 0x50, 0x2b, 0x6, 0x4, 0xf1, 0x21, 0x4e, 0x2b, 0xe3, 0x28, 
-0x20, 0xcd, 0x86, 0xc, 0xf5, 0x7a, 0xb3, 0xca, 0x67, 0xc, 0xf1, 0xe3, 0x73, 0x23, 0x72, 0x23, 
-0x28, 0xf, 0xf5, 0x5, 0x28, 0x7, 0xf1, 0xe3, 0xcd, 0xd6, 0xb, 0x18, 0xe2, 0xf1, 0xc2, 0x48, 
-0x6, 0x2a, 0x50, 0x2b, 0xed, 0x5b, 0x4e, 0x2b, 0xcd, 0x89, 0x9, 0xda, 0x67, 0xc, 0x2a, 0x5f, 
-0x2b, 0xcd, 0xbe, 0x7, 0x38, 0x4, 0x28, 0xcf, 0x18, 0xf7, 0xe1, 0xc5, 0xed, 0x5b, 0x50, 0x2b, 
-0x21, 0x0, 0x0, 0x22, 0x50, 0x2b, 0x60, 0x69, 0x4e, 0x23, 0x46, 0x78, 0xb1, 0x28, 0xb8, 0x23, 
-0x7e, 0x23, 0x66, 0x6f, 0xcd, 0x89, 0x9, 0x2a, 0x50, 0x2b, 0x23, 0x22, 0x50, 0x2b, 0x20, 0xe6, 
-0x23, 0x23, 0x29, 0x23, 0xed, 0x5b, 0xd7, 0x2b, 0x19, 0x38, 0xc0, 0xcd, 0x30, 0x6, 0x22, 0xd7, 
-0x2b, 0xaf, 0x2b, 0x77, 0x2b, 0x77, 0x1b, 0x1b, 0xeb, 0x73, 0x23, 0x72, 0x23, 0x3d, 0x77, 0x23, 
-0x77, 0x23, 0xeb, 0x2a, 0x52, 0x2b, 0x22, 0x4e, 0x2b, 0xe1, 0x4e, 0x23, 0x46, 0x23, 0xc5, 0x1, 
-0x4e, 0x2b, 0x7e, 0x12, 0xa, 0x77, 0x23, 0x13, 0x3, 0x7e, 0x12, 0xa, 0x77, 0x13, 0x2a, 0x4e, 
-0x2b, 0xed, 0x4b, 0x54, 0x2b, 0x9, 0x22, 0x4e, 0x2b, 0x2a, 0x50, 0x2b, 0x2b, 0x7c, 0xb5, 0x22, 
-0x50, 0x2b, 0x20, 0xd5, 0x12, 0xe1, 0x2a, 0x5f, 0x2b, 0xe5, 0xe1, 0x4e, 0x23, 0x46, 0x23, 0xc5, 
-0x7e, 0x23, 0xa6, 0x3c, 0x28, 0x26, 0x23, 0x7e, 0xb7, 0x28, 0xef, 0xfe, 0x88, 0x28, 0x2a, 0xfe, 
-0x8c, 0x28, 0x26, 0xfe, 0x8b, 0x28, 0x8, 0xfe, 0xd4, 0x28, 0x4, 0xfe, 0xa9, 0x20, 0xe7, 0xcd, 
-0x87, 0xc, 0x7b, 0xb2, 0xc4, 0x3d, 0x25, 0xc4, 0x6f, 0x25, 0x18, 0xdb, 0x2b, 0x22, 0xd7, 0x2b, 
-0x2b, 0x77, 0x2b, 0x77, 0xe1, 0xe1, 0xc3, 0x8a, 0x7, 0xcd, 0x87, 0xc, 0x7b, 0xb2, 0x28, 0xc7, 
-0xcd, 0x3d, 0x25, 0xc4, 0x6f, 0x25, 0x7e, 0xfe, 0x2c, 0x20, 0xbc, 0x18, 0xec, 0xe5, 0xd5, 0x11, 
-0xff, 0xff, 0xcd, 0xbb, 0x7, 0xd1, 0x3, 0x3, 0x3, 0x3, 0x60, 0x69, 0xed, 0x4b, 0x52, 0x2b, 
-0x7e, 0x23, 0xe5, 0xb6, 0x28, 0x16, 0x7e, 0x2b, 0x6e, 0x67, 0xcd, 0x89, 0x9, 0x28, 0xa, 0x2a, 
-0x54, 0x2b, 0x9, 0x44, 0x4d, 0xe1, 0x23, 0x18, 0xe7, 0x3e, 0xff, 0xb7, 0xe1, 0xe1, 0xc9, 0xc5, 
-0xeb, 0x2a, 0xd7, 0x2b, 0xed, 0x52, 0xe5, 0xc1, 0x62, 0x6b, 0x1b, 0x1a, 0xfe, 0x2c, 0x28, 0xb, 
-0xfe, 0x3a, 0x30, 0x7, 0xc5, 0xd5, 0xed, 0xb0, 0xd1, 0x18, 0xec, 0xeb, 0xd1, 0xe5, 0xc5, 0xaf, 
-0x6, 0x98, 0xcd, 0xae, 0x19, 0xcd, 0x34, 0x1b, 0xc1, 0xd1, 0x23, 0x13, 0x7e, 0xb7, 0x28, 0xf, 
-0xc5, 0xe5, 0xeb, 0x9, 0x54, 0x5d, 0x2b, 0xed, 0xb8, 0xe1, 0xed, 0xa0, 0xc1, 0x18, 0xed, 0xd5, 
-0xed, 0x5b, 0x5f, 0x2b, 0xcd, 0x93, 0x7, 0x23, 0x7e, 0x23, 0xb6, 0x20, 0xfa, 0xeb, 0x73, 0x23, 
-0x72, 0x13, 0x13, 0xed, 0x53, 0xd7, 0x2b, 0xe1, 0x54, 0x5d, 0x7e, 0xb7, 0x23, 0x20, 0xfb, 0xc1, 
-0xe3, 0xc5, 0xeb, 0xc9, 0xcd, 0x21, 0x17, 0xc9, 0xe5, 0xcd, 0x60, 0x2a, 0xe1, 0xcd, 0xbe, 0xb, 
-0x28, 0x55, 0xcd, 0x21, 0x17, 0xf5, 0xcd, 0xd6, 0xb, 0xcd, 0x21, 0x17, 0xf5, 0xcd, 0xd6, 0xb, 
-0xcd, 0x21, 0x17, 0xf5, 0xcd, 0xd6, 0xb, 0xcd, 0x21, 0x17, 0x3c, 0x3c, 0x57, 0xfe, 0x22, 0x30, 
-0x2e, 0xf1, 0x5f, 0xfe, 0x22, 0x30, 0x28, 0xf1, 0x3c, 0x3c, 0x47, 0xfe, 0x22, 0x30, 0x20, 0xf1, 
-0x4f, 0xfe, 0x22, 0x30, 0x1a, 0x3c, 0xb8, 0x30, 0x16, 0x7b, 0x3c, 0xba, 0x30, 0x11, 0xed, 0x53, 
-0x74, 0x0, 0xed, 0x43, 0x72, 0x0, 0x51, 0x14, 0x1c, 0xe5, 0xcd, 0xc9, 0x2a, 0xe1, 0xc9, 0xc3, 
-0x48, 0x6, 0xe5, 0xcd, 0x60, 0x2a, 0xe1, 0x1, 0x0, 0x21, 0x11, 0x0, 0x21, 0x18, 0xdf, 0xe5, 
-0xcd, 0xf3, 0x20, 0x20, 0xe, 0xf5, 0x3e, 0x1, 0xcd, 0x7b, 0x14, 0xf1, 0x2a, 0xc2, 0x2b, 0x77, 
-0xc3, 0xa9, 0x14, 0xaf, 0xcd, 0x7b, 0x14, 0x18, 0xf7, 0xcd, 0x36, 0x10, 0xcd, 0xd6, 0xb, 0xe5, 
-0xcd, 0x30, 0x16, 0x28, 0x38, 0x47, 0x23, 0x23, 0x5e, 0x23, 0x56, 0xe1, 0xd5, 0xc5, 0xcd, 0x3a, 
-0x10, 0xcd, 0xdb, 0xb, 0xc1, 0xd1, 0xe5, 0xd5, 0xc5, 0xcd, 0x30, 0x16, 0x28, 0x1f, 0x23, 0x23, 
-0x4e, 0x23, 0x66, 0x69, 0xc1, 0x4f, 0xd1, 0xe5, 0xc5, 0xd5, 0x1a, 0xbe, 0x28, 0x12, 0x23, 0xd, 
-0x20, 0xf9, 0xaf, 0xe1, 0xe1, 0xe1, 0x11, 0xf3, 0x10, 0xd5, 0xc3, 0xc0, 0x13, 0xc3, 0x67, 0xc, 
-0x23, 0xe5, 0x2b, 0x23, 0xd, 0x28, 0xf, 0x13, 0x5, 0x28, 0x12, 0x1a, 0xbe, 0x28, 0xf4, 0xe1, 
-0xd1, 0x79, 0xc1, 0x4f, 0x18, 0xd2, 0x13, 0x5, 0xe1, 0x20, 0xd7, 0x18, 0x1, 0xe1, 0xd1, 0xd1, 
-0xd1, 0xa7, 0xed, 0x52, 0x7d, 0x18, 0xcf, 0xcd, 0xcc, 0xb, 0x28, 0xcd, 0x21, 0x17, 0xf5, 0xcd, 
-0xd6, 0xb, 0xcd, 0x3a, 0x10, 0xcd, 0xdb, 0xb, 0xf1, 0xe5, 0xf5, 0xcd, 0x30, 0x16, 0x23, 0x23, 
-0x5e, 0x23, 0x56, 0xc1, 0xc5, 0xf5, 0xd5, 0x4f, 0xaf, 0xb9, 0x28, 0xc, 0xb8, 0x28, 0x9, 0x79, 
-0x5, 0x28, 0x5, 0x81, 0x38, 0x2b, 0x10, 0xfb, 0x47, 0xe, 0x0, 0xc5, 0xcd, 0xe1, 0x14, 0xc1, 
-0xc1, 0xc5, 0xcd, 0x7e, 0x14, 0xe1, 0xe3, 0x7c, 0xe1, 0xe3, 0x6f, 0x24, 0x25, 0xe5, 0xc5, 0x28, 
-0x7, 0xcd, 0xf2, 0x15, 0xc1, 0xe1, 0x18, 0xf4, 0xc1, 0xe1, 0xd1, 0xcd, 0x2, 0x16, 0xc3, 0xa9, 
-0x14, 0x1e, 0x1c, 0xc3, 0x56, 0x6, 0x3a, 0xfd, 0x2b, 0xcb, 0x4f, 0xcb, 0xcf, 0x32, 0xfd, 0x2b, 
-0x20, 0x28, 0xcd, 0xbd, 0xb, 0xcd, 0xcc, 0xb, 0x28, 0xcd, 0x21, 0x17, 0xf5, 0xcd, 0xd6, 0xb, 
-0xcd, 0x21, 0x17, 0xf5, 0xcd, 0xdb, 0xb, 0xcd, 0xcc, 0xb, 0x3b, 0xf1, 0x4f, 0xf1, 0xe5, 0x47, 
-0x78, 0xfe, 0x20, 0x30, 0x5, 0x79, 0xfe, 0x20, 0x38, 0x3, 0xc3, 0x48, 0x6, 0x2e, 0x0, 0x65, 
-0x55, 0x1e, 0x20, 0x4, 0x5, 0x28, 0x3, 0x19, 0x10, 0xfd, 0x59, 0x19, 0x11, 0x0, 0xec, 0x19, 
-0x54, 0x5d, 0xe1, 0xd5, 0xfe, 0xd5, 0x38, 0x9, 0x3a, 0xfc, 0x2b, 0xa7, 0x28, 0x3, 0xcd, 0x6, 
-0x23, 0xcd, 0x3a, 0x10, 0xe5, 0x3a, 0xae, 0x2b, 0xb7, 0x20, 0xc, 0xcd, 0x34, 0x1b, 0xcd, 0x8a, 
-0x14, 0x36, 0x20, 0x2a, 0xe5, 0x2b, 0x34, 0xcd, 0xfe, 0x15, 0xcd, 0xee, 0x19, 0xe1, 0xdd, 0xe1, 
-0x1c, 0x1d, 0x28, 0xe, 0xa, 0xcd, 0xc0, 0x27, 0x30, 0x8, 0xdd, 0x77, 0x0, 0xdd, 0x23, 0x3, 
-0x18, 0xef, 0xcd, 0xbe, 0xb, 0x20, 0x2, 0xc1, 0xc9, 0xcd, 0xd6, 0xb, 0xdd, 0xe5, 0x18, 0xb4, 
-0xe5, 0xdd, 0xe5, 0xe1, 0xd5, 0x11, 0x0, 0xf0, 0xa7, 0xed, 0x52, 0xd1, 0xe1, 0xc9, 0xd, 0xa, 
-0x56, 0x45, 0x52, 0x49, 0x46, 0x59, 0x3f, 0x20, 0x20, 0x0, 0xc3, 0x48, 0x6, 0xc8, 0xcd, 0x86, 
-0xc, 0xca, 0x42, 0x7, 0xcd, 0xd6, 0xb, 0xd5, 0xcd, 0x86, 0xc, 0xe1, 0xc0, 0xeb, 0xe5, 0xcd, 
-0xbb, 0x7, 0xd2, 0x4d, 0x7, 0xd1, 0xf5, 0xc5, 0xcd, 0xbe, 0x7, 0x30, 0xf5, 0xc1, 0xc3, 0x50, 
-0x7, 0xcb, 0x6b, 0xc2, 0x38, 0x0, 0x22, 0x77, 0x0, 0xe5, 0x21, 0x20, 0x28, 0xe5, 0x7b, 0xe6, 
-0x7, 0xcb, 0x27, 0xc6, 0x3c, 0x6f, 0x3e, 0x0, 0xce, 0x28, 0x67, 0x7e, 0x23, 0x66, 0x6f, 0xe9, 
-0xe1, 0xc9, 0x78, 0xd6, 0x9, 0x38, 0xb3, 0xfe, 0xd, 0x30, 0xaf, 0x7, 0x4f, 0x6, 0x0, 0xeb, 
-0x21, 0x70, 0x23, 0x9, 0x4e, 0x23, 0x46, 0xc5, 0xeb, 0xc3, 0xbd, 0xb, 0x0, 0x1, 0x4c, 0x28, 
-0x16, 0x29, 0x59, 0x28, 0x82, 0x1f, 0xd0, 0x29, 0x82, 0x1f, 0x82, 0x1f, 0xd5, 0xc5, 0x4a, 0xe5, 
-0xcd, 0xce, 0x29, 0xe1, 0xc1, 0xd1, 0xcb, 0xbb, 0xc9, 0xe5, 0xc5, 0xd5, 0xcb, 0x5b, 0x28, 0x2f, 
-0x2a, 0x77, 0x0, 0x1, 0xb, 0x0, 0x23, 0x23, 0x3e, 0xd5, 0xbe, 0xd5, 0x11, 0xa0, 0x0, 0x20, 
-0x3, 0x11, 0x0, 0x4, 0xed, 0x53, 0x79, 0x0, 0x11, 0x80, 0x0, 0xed, 0xb0, 0xd1, 0x21, 0x7b, 
-0x0, 0x36, 0x0, 0x21, 0x7e, 0x0, 0x36, 0xc, 0x21, 0x8b, 0x0, 0x72, 0xc3, 0xd, 0x29, 0x21, 
-0x80, 0x0, 0x3a, 0x7e, 0x0, 0x4f, 0x6, 0x0, 0x9, 0x3c, 0x32, 0x7e, 0x0, 0x72, 0xcb, 0x73, 
-0x20, 0x4, 0xfe, 0x80, 0x20, 0x67, 0x21, 0x80, 0x0, 0x22, 0x2d, 0x0, 0xd5, 0x3a, 0x7b, 0x0, 
-0xb7, 0x1, 0x70, 0x17, 0x28, 0x4, 0xed, 0x4b, 0x79, 0x0, 0x3c, 0x32, 0x7b, 0x0, 0xcd, 0x9f, 
-0x1, 0x21, 0x7e, 0x0, 0x36, 0x0, 0xcd, 0xcc, 0x29, 0xd1, 0xcb, 0x73, 0xca, 0x53, 0x29, 0x21, 
-0xce, 0x27, 0xcd, 0xd2, 0x2a, 0xcd, 0x24, 0x1, 0xfe, 0x59, 0x20, 0x31, 0x21, 0xf9, 0x22, 0xcd, 
-0xd2, 0x2a, 0xcd, 0x24, 0x1, 0x16, 0x2a, 0xcd, 0x4c, 0x28, 0x3a, 0x7b, 0x0, 0x47, 0xc5, 0xcd, 
-0xfc, 0x1, 0x30, 0xb, 0xcd, 0x24, 0x1, 0xfe, 0xd, 0x28, 0xf4, 0xfe, 0x3, 0x28, 0x5c, 0xcd, 
-0xf3, 0x20, 0xfe, 0x3, 0x28, 0x55, 0xcd, 0xcc, 0x29, 0xc1, 0x10, 0xe2, 0xf1, 0xd1, 0xc1, 0xe1, 
-0xcb, 0xbb, 0xcb, 0x9b, 0x57, 0xc9, 0xe5, 0xc5, 0xd5, 0xcb, 0x73, 0x20, 0xf0, 0xcb, 0x5b, 0x28, 
-0x3c, 0x21, 0x80, 0x0, 0x22, 0x2d, 0x0, 0xaf, 0x32, 0x7e, 0x0, 0x21, 0x7c, 0x0, 0x36, 0x1, 
-0xcd, 0x66, 0x2, 0x30, 0x9, 0xcd, 0x24, 0x1, 0xfe, 0x3, 0x20, 0xf4, 0x18, 0x1d, 0x3a, 0x7b, 
-0x0, 0x3d, 0x20, 0xf1, 0xcd, 0xcc, 0x29, 0xcd, 0x9c, 0x29, 0x21, 0x7e, 0x0, 0x36, 0xc, 0x21, 
-0x8b, 0x0, 0x7e, 0xf5, 0xcd, 0xf3, 0x20, 0xfe, 0x3, 0x20, 0xb1, 0x18, 0x6c, 0x21, 0x80, 0x0, 
-0x3a, 0x7e, 0x0, 0x4f, 0x6, 0x0, 0x9, 0x7e, 0xf5, 0x79, 0x3c, 0x32, 0x7e, 0x0, 0xfe, 0x80, 
-0x20, 0x9a, 0x3a, 0x7c, 0x0, 0x3c, 0x32, 0x7c, 0x0, 0xcd, 0x66, 0x2, 0x30, 0x9, 0xcd, 0x24, 
-0x1, 0xfe, 0x3, 0x20, 0xf4, 0x18, 0x42, 0x21, 0x7c, 0x0, 0x3a, 0x7b, 0x0, 0xbe, 0x38, 0xe9, 
-0x20, 0xec, 0xcd, 0xcc, 0x29, 0x21, 0x7e, 0x0, 0x36, 0x0, 0x18, 0xb8, 0x21, 0x80, 0x0, 0x6, 
-0xb, 0x56, 0xcd, 0x4c, 0x28, 0x23, 0x10, 0xf9, 0x2a, 0x77, 0x0, 0x1, 0xc, 0x0, 0x9, 0x6, 
-0xb, 0x11, 0x8a, 0x0, 0x1a, 0xbe, 0x1b, 0x20, 0x4, 0x2b, 0x10, 0xf8, 0xc9, 0xd6, 0x4, 0xbe, 
-0x20, 0x7, 0x3e, 0xff, 0x32, 0x5e, 0x2b, 0x18, 0xf0, 0xc3, 0x82, 0x1f, 0xe, 0x20, 0x18, 0x6, 
-0x79, 0xcd, 0xe8, 0xff, 0xc9, 0x0, 0x21, 0x45, 0x2a, 0xe5, 0xcd, 0x60, 0x2a, 0x79, 0xd6, 0x8, 
-0xd8, 0x28, 0x47, 0x3d, 0x28, 0x29, 0x3d, 0x28, 0x34, 0x3d, 0x28, 0x4c, 0x3d, 0x28, 0x6, 0x3d, 
-0x28, 0x17, 0x71, 0x18, 0x1a, 0x3a, 0x72, 0x0, 0x3c, 0x32, 0x71, 0x0, 0x47, 0x3a, 0x73, 0x0, 
-0x90, 0x47, 0xc5, 0xcd, 0x68, 0x2a, 0xc1, 0x10, 0xf9, 0x3a, 0x74, 0x0, 0x32, 0x70, 0x0, 0x21, 
-0x70, 0x0, 0x11, 0x75, 0x0, 0x34, 0x1a, 0xbe, 0xc0, 0x1b, 0x1a, 0x3c, 0x77, 0x21, 0x71, 0x0, 
-0x34, 0x3a, 0x73, 0x0, 0x3d, 0xbe, 0xd0, 0x77, 0x18, 0x3e, 0x21, 0x70, 0x0, 0x11, 0x74, 0x0, 
-0x35, 0x1a, 0xbe, 0xc0, 0x13, 0x1a, 0x3d, 0x77, 0x21, 0x71, 0x0, 0x35, 0x3a, 0x72, 0x0, 0xbe, 
-0xd8, 0x3c, 0x77, 0x18, 0x24, 0x21, 0x70, 0x0, 0x4e, 0x23, 0x46, 0x21, 0xe0, 0xeb, 0x11, 0x20, 
-0x0, 0x19, 0x10, 0xfd, 0xb, 0x9, 0x22, 0x2b, 0x0, 0x7e, 0x32, 0x1f, 0x0, 0x36, 0xff, 0xc9, 
-0x2a, 0x2b, 0x0, 0x3a, 0x1f, 0x0, 0x77, 0xc9, 0x3e, 0xaf, 0xf5, 0x21, 0xe0, 0xeb, 0x11, 0x20, 
-0x0, 0x3a, 0x72, 0x0, 0x3c, 0x4f, 0x3a, 0x73, 0x0, 0x3d, 0x47, 0xf1, 0xc5, 0xb7, 0x28, 0x1, 
-0x41, 0x19, 0x10, 0xfd, 0xc1, 0xf5, 0x78, 0x91, 0x28, 0x28, 0x47, 0xf1, 0xe5, 0xb7, 0x28, 0x3, 
-0x19, 0x18, 0x2, 0xed, 0x52, 0xd1, 0xf5, 0xe5, 0xc5, 0x3a, 0x74, 0x0, 0x6, 0x0, 0x4f, 0x9, 
-0xeb, 0x9, 0xeb, 0xc, 0x3a, 0x75, 0x0, 0x91, 0x4f, 0xed, 0xb0, 0xc1, 0xe1, 0x11, 0x20, 0x0, 
-0x10, 0xd9, 0xf1, 0xeb, 0x2a, 0x74, 0x0, 0x7c, 0x2c, 0x26, 0x0, 0x44, 0x95, 0x4f, 0x19, 0x54, 
-0x5d, 0x2b, 0xd, 0xc8, 0x36, 0x20, 0xed, 0xb0, 0xc9, 0x21, 0x70, 0x0, 0x73, 0x23, 0x72, 0xc3, 
-0x45, 0x2a, 0x7e, 0xb7, 0xc8, 0x57, 0xcd, 0x4c, 0x28, 0x23, 0x18, 0xf6, 0xd, 0xa, 0x62, 0x61, 
-0x64, 0x20, 0x72, 0x65, 0x63, 0x2e, 0x0, 0xd, 0xa, 0x72, 0x65, 0x63, 0x2e, 0x6e, 0x6f, 0x74, 
-0x20, 0x66, 0x2e, 0x0, 0x0, 0xd9, 0xfd, 0x26, 0x42, 0x21, 0xc0, 0x2b, 0x22, 0x1b, 0x0, 
-};
-dump_item dump_items[DUMP_NUM_ITEMS] = {
+static const unsigned char dump_z1013_font_lz4[] =
+"\x1f\xff\x01\x00\x5c\xf0\x0f\x00\x00\x18\x24\x24\x18\x24\x42\xdb\xa5\x81\xff\x24\x24\x24\x42\x08\x34\x42\x81\x91\x69\x09\x31\x42"
+"\x7e\x81\xff\x00\x00\x1e\x00\xa1\x42\x99\xbd\x99\x42\x24\x7e\x42\x99\xe7\x10\x00\xf3\x01\xdb\xc3\x18\x99\xe7\x81\x42\x18\x24\x18"
+"\xc3\xbd\x81\x81\x42\x24\x28\x00\xf2\x0c\x00\x00\x18\x3c\x3c\x18\x3c\x7e\xdb\xff\xff\xff\x3c\x3c\x3c\x7e\x08\x3c\x7e\xff\xff\x6f"
+"\x0f\x3f\x7e\x7e\xff\x48\x00\xa6\x3c\x7e\xe7\xc3\xe7\x7e\x3c\x7e\x7e\xff\x48\x00\xd2\xff\xff\x7e\x18\x3c\x18\xc3\xff\xff\xff\x7e"
+"\x3c\x3c\x28\x00\x00\x64\x00\x00\x04\x00\xb0\x10\x10\x10\x10\x00\x00\x10\x00\x28\x28\x28\x0f\x00\xf1\x15\x00\x24\x7e\x24\x24\x24"
+"\x7e\x24\x00\x10\x3c\x50\x38\x14\x78\x10\x00\x60\x64\x08\x10\x20\x4c\x0c\x00\x10\x28\x28\x30\x54\x48\x34\x00\x10\x10\x20\x28\x00"
+"\xd0\x08\x10\x20\x20\x20\x10\x08\x00\x20\x10\x08\x08\x08\x14\x00\xb0\x10\x54\x38\x54\x10\x00\x00\x00\x10\x10\x7c\x52\x00\x00\x25"
+"\x00\x03\x2c\x00\x10\x7c\x0c\x00\x01\x04\x00\xf0\x06\x30\x30\x00\x00\x04\x08\x10\x20\x40\x00\x00\x38\x44\x44\x54\x44\x44\x38\x00"
+"\x10\x30\x82\x00\x40\x38\x00\x38\x44\x19\x00\xf0\x07\x7c\x00\x7c\x08\x10\x08\x04\x44\x38\x00\x08\x18\x28\x48\x7c\x08\x08\x00\x7c"
+"\x40\x78\x04\x10\x00\x40\x18\x20\x40\x78\x30\x00\x10\x7c\x27\x00\x20\x20\x20\x40\x00\x10\x38\x10\x00\xb0\x38\x44\x44\x3c\x04\x08"
+"\x30\x00\x00\x30\x30\x03\x00\x00\x81\x00\x01\xa4\x00\x00\x66\x00\x00\xa0\x00\x40\x00\x00\x7c\x00\x81\x00\x30\x20\x10\x08\x3a\x00"
+"\x02\x68\x00\xa0\x00\x10\x00\x38\x44\x5c\x54\x5c\x40\x3c\x48\x00\xf0\x05\x7c\x44\x44\x44\x00\x78\x24\x24\x38\x24\x24\x78\x00\x38"
+"\x44\x40\x40\x40\x44\x38\x10\x00\x10\x24\x10\x00\x82\x7c\x40\x40\x78\x40\x40\x7c\x00\x08\x00\x11\x40\x20\x00\x71\x4c\x44\x3c\x00"
+"\x44\x44\x44\x38\x00\x10\x38\xbf\x00\xf1\x05\x10\x38\x00\x1c\x08\x08\x08\x08\x48\x30\x00\x44\x48\x50\x60\x50\x48\x44\x00\x40\x01"
+"\x00\x60\x7c\x00\x44\x6c\x54\x54\x60\x00\x70\x44\x44\x64\x54\x4c\x44\x44\x70\x00\x10\x44\xb8\x00\x60\x78\x44\x44\x78\x40\x40\x50"
+"\x00\x20\x44\x44\x58\x01\x00\x10\x00\x00\x38\x00\x91\x3c\x40\x40\x38\x04\x04\x78\x00\x7c\x58\x00\x10\x10\x68\x00\x01\x30\x00\x10"
+"\x44\x01\x00\x11\x28\x10\x00\xb0\x54\x54\x6c\x44\x00\x44\x44\x28\x10\x28\x44\x08\x00\x20\x44\x28\xc3\x01\x01\x18\x01\x50\x40\x7c"
+"\x00\x38\x20\x01\x00\x40\x38\x00\x00\x40\xf2\x00\x30\x00\x00\x38\x98\x00\x61\x08\x38\x00\x10\x28\x44\x83\x01\x01\x05\x00\x03\x11"
+"\x01\x01\x0c\x00\xf0\x00\x00\x34\x4c\x44\x44\x3a\x00\x40\x40\x58\x64\x44\x44\x78\x00\x9a\x01\x00\x00\x01\x22\x04\x04\x18\x00\x00"
+"\x10\x00\x61\x7c\x40\x38\x00\x08\x10\xea\x00\x20\x00\x00\x30\x00\x32\x3c\x04\x38\x30\x00\x40\x44\x00\x10\x00\xa9\x00\x13\x08\x08"
+"\x00\x91\x10\x20\x40\x40\x48\x50\x70\x48\x44\x16\x00\xe0\x10\x10\x08\x00\x00\x00\x68\x54\x54\x54\x54\x00\x00\x00\x60\x00\x00\x84"
+"\x00\x11\x38\xd0\x00\x01\x10\x00\x33\x78\x40\x40\x50\x00\x10\x04\x10\x00\x00\x10\x01\x91\x00\x00\x38\x40\x38\x04\x78\x00\x10\x70"
+"\x00\x00\x40\x00\x70\x44\x44\x44\x4c\x34\x00\x00\x0a\x01\x10\x28\x61\x02\x00\x4f\x00\x00\xac\x02\x01\x01\x01\x02\x18\x00\x40\x3c"
+"\x04\x38\x00\x3a\x02\x70\x20\x7c\x00\x08\x10\x10\x20\x78\x00\x00\x96\x00\x00\x18\x01\x00\x0d\x00\x03\x88\x02\x54\x32\x4c\x00\x00"
+"\x00\xf7\x03\x20\xc0\x20\x22\x00\x40\x20\xc0\x03\x04\x21\x01\x62\x04\x03\x81\x81\x42\x3c\x10\x01\xa0\x00\x00\x3c\x42\x81\x81\x10"
+"\x10\x20\xc0\x10\x00\x40\x08\x08\x04\x03\x08\x00\x00\x04\x00\x00\x2c\x00\x00\x08\x00\x00\x3c\x00\x12\x80\x01\x00\x32\xff\xff\x01"
+"\x01\x00\x00\x61\x01\xc0\x82\x44\x28\x10\xff\xef\xc7\x83\x01\x83\xc7\xef\x44\x00\x00\x54\x00\x20\xc3\x81\x32\x00\xf0\x05\x81\xc3"
+"\xff\xfe\xfc\xf8\xf0\xe0\xc0\x80\x80\xc0\xe0\xf0\xf8\xfc\xfe\xff\x01\x02\x8f\x02\x31\x40\x80\x80\xa8\x01\x20\x02\x01\x26\x00\x40"
+"\x03\x0c\x30\xc0\x04\x00\x04\x0c\x00\x31\xc0\x30\x0c\x7c\x00\x00\x08\x00\x00\x04\x00\x00\x18\x00\x00\x08\x00\x00\x24\x00\xf0\x0e"
+"\x10\x10\x20\x20\x40\x40\x80\x80\x01\x01\x02\x02\x04\x04\x08\x08\x81\x81\x42\x42\x24\x24\x18\x18\x80\x80\x40\x40\x20\xf5\x00\xe2"
+"\x08\x04\x04\x02\x02\x01\x01\x18\x18\x24\x24\x42\x42\x81\x65\x04\x32\x00\x00\x00\xb7\x00\x21\x80\x80\x0b\x01\x00\x78\x04\x15\x18"
+"\x01\x00\x01\x19\x04\x81\x18\x18\x18\x1f\x1f\x18\x18\x18\x20\x00\x02\x1b\x00\x22\xf8\xf8\x08\x00\x22\xff\xff\x08\x00\x20\x1f\x1f"
+"\x89\x00\x24\x00\x00\x28\x00\x04\x20\x00\x22\xf8\xf8\x60\x00\x61\x40\x40\x20\x18\x07\x01\x99\x00\x41\x18\xe0\xe0\x18\x87\x00\x31"
+"\x01\x07\x18\xaf\x00\xd0\x80\x81\x42\x24\x18\x18\x24\x42\x81\xf0\xf0\xf0\xf0\x47\x00\x40\x0f\x0f\x0f\x0f\x08\x00\x00\x04\x00\x04"
+"\x0c\x00\x00\x1c\x00\x04\x04\x00\x00\x14\x00\x00\x04\x00\x00\xb8\x01\x00\x24\x00\x00\x04\x00\x00\x0c\x00\x00\x20\x00\x00\x18\x00"
+"\x00\x04\x00\x04\x0c\x00\x04\x18\x00\x00\x08\x00\x00\x04\x00\x00\x18\x00\x00\x08\x00\x00\x24\x00\xf2\x00\x01\x03\x07\x0f\x1f\x3f"
+"\x7f\xff\xff\x7f\x3f\x1f\x0f\x07\x03\xb5\x01\x43\x01\x01\x01\xff\x11\x01\xf0\x04\xff\x80\x80\x9c\x9c\x9c\x80\x80\xff\xff\xff\xe3"
+"\xe3\xe3\xff\xff\x18\x3c\x7e\x67\x05\x32\xff\xff\x00\x02\x00\x13\xaa\x01\x00\x22\x55\xaa\x02\x00\x03\x41\x00\xf0\x06\xff\x00\x10"
+"\x38\x7c\xfe\x7c\x38\x10\x38\x10\x92\xfe\x92\x10\x38\x7c\x00\x6c\xfe\xfe\x10\x00\x00\x17\x00\xf0\x05\xfe\x7c\x10\x7c\xe7\xe7\x42"
+"\xff\xff\x42\xe7\xe7\xdb\xff\xdb\x18\x18\xdb\xff\xdb\xaf\x05\x00\x87\x05\x11\xc0\x5e\x02\x01\xb7\x04\x00\xd3\x00\x31\x00\x0c\x0c"
+"\x07\x00\x21\x00\x03\xf2\x01\x00\x0c\x00\x0f\x22\x00\x51\x04\x7c\x01\x20\x3f\x3f\x72\x00\x00\x1e\x03\x02\x08\x00\x22\xfc\xfc\x08"
+"\x00\x02\xa4\x01\x22\x00\x00\x8c\x00\x20\xc0\xc0\x08\x00\x00\x06\x00\x0c\x04\x00\x00\x22\x00\x00\x1c\x00\x00\x08\x00\x0a\x3a\x00"
+"\x04\x4a\x00\x01\x5d\x02\x34\x00\x00\x00\x6a\x00\x04\x7a\x00\x04\xf0\x00\x22\x03\x03\x0a\x00\x00\x08\x00\x00\x0a\x00\x02\x08\x00"
+"\x06\x0a\x00\x00\x56\x00\x00\x14\x00\x00\x08\x00\x16\x00\x26\x01\x01\xf4\x06\x05\xb8\x00\x12\xff\x66\x00\x00\xf4\x01\x01\xc0\x02"
+"\x01\x10\x00\x00\x0e\x00\x00\xc7\x01\x02\x08\x00\x80\xff\xff\xff\xff\xff\xff\xff\xff"
+;
+unsigned char dump_z1013_font[2048];
+static const unsigned char dump_z1013_mon_a2_lz4[] =
+"\xf0\x69\x18\x0d\x21\x4d\x00\x11\x4e\x00\x36\x00\x01\x15\x00\xed\xb0\x31\xb0\x00\x3e\xc3\x32\x20\x00\x21\xd5\xf0\x22\x21\x00\x3e"
+"\xcf\xd3\x03\x3e\x6f\xd3\x03\x21\x0d\xf2\x11\x33\x00\x01\x0c\x00\xed\xb0\xe7\x02\x0c\x0d\x0d\x72\x6f\x62\x6f\x74\x72\x6f\x6e\x20"
+"\x5a\x20\x31\x30\x31\x33\x2f\x41\x2e\x32\x8d\x21\x90\x00\x22\x63\x00\xed\x5e\x18\x06\x31\xb0\x00\xe7\x02\xbf\xe7\x05\xed\x5b\x16"
+"\x00\xcd\x07\xf3\x47\x13\x1a\x4f\xc5\x13\xe7\x03\x20\x05\x1a\xfe\x3a\x28\x0d\x22\x1b\x00\xe7\x03\x22\x1d\x05\x00\xf0\xf3\x23\x00"
+"\xc1\x08\xed\x53\x25\x00\x21\xa7\xf0\x7e\xb8\x28\x11\x23\x23\x23\xb7\x20\xf6\x78\xfe\x40\x20\xbd\x21\xb0\x00\x41\x18\xeb\x23\x5e"
+"\x23\x56\xeb\x08\x01\x59\xf0\xc5\xe9\x42\xc4\xf5\x43\x9b\xf7\x44\x0b\xf5\x45\xd6\xf5\x47\xf0\xf5\x49\x02\xf0\x4a\xe2\xf5\x4b\x48"
+"\xf5\x4c\x35\xf4\x4d\x62\xf3\x4e\x4b\xf7\x52\x1c\xf6\x53\xa6\xf3\x54\x5a\xf5\x57\xf5\xf6\x00\xe3\xf5\x7e\x32\x03\x00\x23\xf1\xe3"
+"\xe5\xc5\xf5\x21\xf5\xf0\x3a\x03\x00\xcb\x27\x4f\x06\x00\x09\x7e\x23\x66\x6f\xf1\xc1\xe3\xc9\x58\xf2\x19\xf2\xe2\xf2\x31\xf3\x19"
+"\xf1\xf0\xf2\x3e\xf3\x57\xf3\xa6\xf3\x35\xf4\x62\xf3\xf5\xf6\x04\xf6\x01\xf6\x0c\xf6\x5a\xf5\xf6\xf2\x48\xf5\x21\x37\x00\x3e\x5b"
+"\xa6\x77\xdd\x21\xc6\xf7\xcd\xb9\xf1\x30\x0d\xd5\xcb\xfe\xcd\xf9\xf1\x32\x13\x00\xd1\xcd\xc0\xf1\xdd\x21\xf6\xf7\x1e\x06\xcd\xce"
+"\xf1\x28\x3b\xcb\x41\x28\x08\xcb\x69\x28\x12\xcd\xf9\xf1\xc9\x3e\x02\xcb\x9e\xcb\x76\x20\x04\xcb\xf6\xae\x77\xaf\xc9\xcb\xee\xcb"
+"\x7e\x28\x1b\x3a\x13\x00\xcb\x77\x20\x02\xcb\xe7\xe6\x1f\xcb\x4e\xc8\xcb\xff\xc9\xcb\xb6\xcb\x7e\xc8\x3a\x13\x00\x18\xf0\x1e\x07"
+"\x42\x00\xd2\x0c\xcb\x79\x28\x2d\xcb\x71\x20\xe7\xcb\x6e\x20\x25\x1b\x00\xf0\x36\xcb\x71\x28\x06\xcb\x5e\x28\xcf\x18\x04\xcb\x5e"
+"\x20\xc9\x47\xe6\x30\x78\xe2\xae\xf1\xcb\xa7\x18\x02\xcb\xe7\xcb\xef\x18\xb8\x3e\x08\xc3\x51\xf1\x1e\x00\xcd\xce\xf1\x37\xc0\x1c"
+"\x01\x08\x00\xdd\x09\x7b\xfe\x06\x20\xf0\x37\x3f\xc9\x7b\xd3\x08\xd3\x02\xdb\x02\xe6\x0f\x4f\xcb\xe7\x09\x00\x22\xcb\x27\x02\x00"
+"\x40\x57\x81\x4f\xaf\x10\x00\xf0\xa6\xe6\x0f\x82\xb9\x20\xda\x2f\xb7\x3e\x00\xc9\x11\x00\x00\x06\x08\xcb\x29\x30\x03\x1c\x10\xf9"
+"\xdd\x19\xdd\x7e\x00\xcb\xb6\xc9\xd0\x07\xe0\x03\x00\xc3\x53\xf0\x00\xec\x00\xf0\xdd\xe5\xc5\xd5\xe5\x01\x00\x10\xc5\xcd\x19\xf1"
+"\xc1\xdd\x21\x04\x00\xdd\xbe\x00\x20\x1b\xb7\x28\x16\x0d\x20\xfd\xcb\x66\x20\x08\x11\x00\x08\x1b\x7b\xb2\x20\xfb\x10\xde\xcb\xe6"
+"\xaf\x18\x02\xcb\xa6\xdd\x77\x00\xb7\x28\xd1\xe1\xd1\xc1\xdd\xe1\xc9\xe6\x7f\xf5\xc5\xd5\xe5\x2a\x2b\x00\xf5\x3a\x1f\x00\x77\xf1"
+"\xfe\x0d\x28\x53\xfe\x0c\x28\x5e\xfe\x08\x28\x48\xfe\x09\x28\x01\x77\x23\xeb\x2a\x3d\x00\xaf\xed\x52\xeb\x20\x2a\xed\x5b\x3b\x00"
+"\x21\x20\x00\x19\xed\x4b\x35\x00\x78\xb1\x28\x02\xed\xb0\xd5\xe1\xe5\x13\x36\x20\x01\x1f\x00\xed\xb0\x2a\x16\x00\x11\x20\x29\x00"
+"\xf0\x40\x22\x16\x00\xe1\x7e\x32\x1f\x00\x36\xff\x22\x2b\x00\xe1\xd1\xc1\xf1\xc9\x2b\x18\xbb\x3e\xe0\xa5\xc6\x20\x4f\x36\x20\x23"
+"\x7d\xb9\x20\xf9\x18\xac\x2a\x35\x00\x01\x1f\x00\x09\xe5\xc1\x2a\x3b\x00\xe5\x36\x20\xe5\xd1\x13\xed\xb0\xe1\x18\xc9\xe3\x7e\x23"
+"\xf5\xcd\x56\xf2\xf1\xcb\x7f\x28\xf5\xe3\xc9\xcd\xe2\xf2\x20\x23\xa0\x9b\x00\xf0\x67\x22\x16\x00\xe7\x01\xe7\x00\xfe\x0d\x20\xf8"
+"\xe1\xc9\x1a\xfe\x20\xc0\x13\x18\xf9\xcd\x07\xf3\xaf\x21\x13\x00\x77\x23\x77\x1a\x2b\xd6\x30\xf8\xfe\x0a\x38\x08\xd6\x07\xfe\x0a"
+"\xf8\xfe\x10\xf0\x13\xed\x6f\x23\xed\x6f\x18\xe7\xc5\xcd\x0e\xf3\x44\x4d\x6e\x03\x0a\x67\xb5\xc1\xc9\xf5\x1f\x1f\x1f\x1f\xcd\x47"
+"\xf3\xf1\xf5\xe6\x0f\xc6\x30\xfe\x3a\x38\x02\xc6\x07\xcd\x58\xf2\xf1\xc9\xf5\x7c\xcd\x3e\xf3\x7d\xcd\x3e\xf3\xf1\xc9\x2a\x1b\x00"
+"\xe7\x07\xe5\xe7\x0e\x7e\xe7\x06\xcd\xf0\xf2\x15\x03\xf0\x47\x1a\x08\xe1\x2b\x23\xe5\xcd\x31\xf3\x28\x0d\x7d\xe1\x77\xbe\x28\xf3"
+"\xe7\x02\x45\x52\xa0\x18\xd9\x1a\xfe\x20\x28\xee\xe1\x23\x22\x1d\x00\xfe\x3b\xc8\x08\xfe\x20\x28\xc7\x2b\xfe\x52\x20\xc2\x2b\x18"
+"\xbf\x2a\x1b\x00\xcd\xba\xf3\xeb\x2a\x1d\x00\xa7\xed\x52\xeb\xd8\xcd\xc0\xf3\x18\xf2\xed\x5b\x33\x00\x18\x03\x11\x0e\x00\x06\x70"
+"\x10\xfe\xcd\x2e\xf4\x8e\x01\x51\xf4\x0e\x02\x06\x35\x0e\x00\xf1\x20\x0d\x11\x00\x00\x20\xf3\xd5\xdd\xe1\x06\x12\x10\xfe\xcd\x0d"
+"\xf4\x06\x0f\x10\xfe\x0e\x10\x5e\x23\x56\xdd\x19\x23\xc5\xcd\x0d\xf4\xc1\x0d\x28\x06\x06\x0e\x10\xfe\x18\xec\xdd\xe5\xd1\x06\x10"
+"\x24\x00\xf2\x06\xc9\x0e\x10\xcb\x3a\xcb\x1b\x30\x07\x06\x03\x10\xfe\x00\x18\x03\xcd\x2e\xf4\x06\x19\x4e\x00\xd0\xc8\x06\x15\x10"
+"\xfe\x18\xe1\xdb\x02\xee\x80\xd3\x02\xd3\x00\xf5\x02\xcd\x54\xf4\x28\x0c\xcd\xe2\xf2\x43\x53\xbc\xcd\x57\xf3\xcd\x0c\xf6\x9d\x00"
+"\xf0\x03\x18\xe4\xcd\xf9\xf4\xcd\x03\xf5\x0e\x07\x11\x10\x09\x3e\x07\x3d\x20\xfd\x10\x00\xf2\x0c\xf9\xf4\x20\xe8\x15\x20\xf8\x0d"
+"\x28\x0c\xdb\x02\xa8\xcb\x77\x20\xe3\x1d\x20\xf6\x18\xd6\xcd\x03\xf5\x3e\x44\x22\x00\x20\x20\xf3\x0d\x00\x10\x1e\x0d\x00\x92\xda"
+"\xf4\x0e\x10\xd5\xdd\xe1\x3e\x1a\x0d\x00\xf1\x17\xdd\x19\xc5\x4d\x44\x2a\x1d\x00\xaf\xed\x42\x69\x60\xc1\x38\x05\x73\x23\x72\x18"
+"\x06\x3e\x01\x3d\x20\xfd\x23\x23\x0d\x28\x07\x3e\x12\x3d\x20\xfd\x18\xd7\x07\x00\xf0\x14\xcd\xda\xf4\xeb\xdd\xe5\xc1\xaf\xed\x42"
+"\xeb\xc9\xe5\x2e\x10\xcd\xf9\xf4\x20\x03\xaf\x18\x01\x37\xcb\x1a\xcb\x1b\xcd\x03\xf5\x2d\x28\x07\x3e\x62\x00\x41\x18\xe6\xe1\xc9"
+"\x87\x00\x42\xf5\xa8\x47\xf1\x0a\x00\x20\x28\xf9\xd6\x00\xf0\x22\xed\x5b\x1d\x00\x37\xe5\xed\x52\xe1\xd0\xe7\x07\x01\x00\x08\x1e"
+"\x00\xe7\x02\xa0\x7e\xe7\x06\x81\x4f\x30\x04\x3e\x00\x8b\x5f\x23\x10\xef\xe7\x02\xa0\x7b\xcd\x47\xf3\x79\xe7\x06\x18\xd2\x2a\x1b"
+"\x00\x31\x00\xf0\x07\xed\x4b\x23\x00\xc9\xcd\x3c\xf5\x71\xe5\xaf\xeb\xed\x52\x44\x4d\xe1\x54\x5d\x13\xed\xb0\x12\x00\x10\xaf\x4b"
+"\x00\xf0\x0a\x38\x03\xed\xb0\xc9\x09\xeb\x09\xeb\x2b\x1b\xed\xb8\xc9\xed\x73\x13\x00\x31\x61\x00\xdd\xe5\xfd\xe5\x23\x03\x20\xd9"
+"\x08\x06\x00\x21\x18\x15\x17\x00\x11\x4d\xda\x02\x20\xd9\x08\xe0\x02\xf6\x24\xfd\xe1\xdd\xe1\xed\x7b\x13\x00\xc9\xcd\x70\xf5\xe1"
+"\xed\x73\x63\x00\x31\xb0\x00\x2b\x2b\x2b\x22\x61\x00\xed\x5b\x0b\x00\x21\x0d\x00\x01\x03\x00\xed\xb0\xcd\x21\xf6\xc3\x59\xf0\x2a"
+"\x1b\x00\x22\x0b\x00\x11\x14\x00\xd0\xc9\x2a\x0b\x00\x36\xcd\x23\x11\xa1\xf5\x73\x23\x72\x1e\x00\xe0\x61\x00\xed\x7b\x63\x00\xe5"
+"\xc3\x87\xf5\x2a\x61\x00\x22\xb7\x00\x10\x0b\x56\x03\xb0\x20\xd7\x18\xe1\xe7\x02\xba\x7e\xe7\x06\x2b\x04\x00\xf0\x36\xe7\x02\xa0"
+"\xc9\xe7\x02\x31\xa0\xc9\x20\xf9\xe7\x02\x30\xa0\xc9\xfe\x3a\xc2\x97\xf6\xe7\x02\x0d\x42\xd0\x21\x0c\x00\xe7\x0d\xe7\x02\x42\x53"
+"\xba\x06\x03\x21\x0d\x00\x7e\xe7\x06\x23\x10\xfa\xe7\x02\x20\x20\x20\x53\x20\x5a\x20\x43\xa0\x3a\x5b\x00\x6f\xcb\x7d\xcd\x15\xf6"
+"\xcb\x75\x05\x00\xd0\x45\xcd\x15\xf6\x21\x64\x00\x06\x02\xe7\x02\x53\xd0\x39\x00\x20\x50\xc3\x06\x00\x21\x49\xd8\x06\x00\x10\xd9"
+"\x06\x00\x20\x41\xc6\x06\x00\x11\x42\x18\x00\x20\x44\xc5\x0c\x00\xf1\x35\x48\xcc\xe7\x0d\x10\xe6\x2a\x2b\x00\x2b\x36\x27\xc9\x01"
+"\x00\x04\x2a\x16\x00\x23\x23\x11\x60\xf6\x1a\xbe\x28\x17\x13\xe5\x21\x05\x00\x19\xeb\xe1\x0c\x10\xf1\x06\x04\x79\xfe\x08\x20\xea"
+"\xf1\xff\x2b\x18\xea\x13\x23\x1a\xe6\x7f\xbe\x20\xf5\x23\x7e\xfe\x27\x79\x20\x02\xc6\x04\xe7\x05\x93\x21\x64\x00\xed\x42\x44\x4d"
+"\xe7\x0c\x6f\x03\xf0\x2f\xcd\x31\xf3\x20\x04\x1a\xfe\x3b\xc8\xeb\xc5\xe1\x72\x2b\x73\xc3\x21\xf6\xcd\x11\xf7\x38\x4c\x22\x35\x00"
+"\xed\x43\x3b\x00\x2a\x1d\x00\x22\x3d\x00\x2a\x2b\x00\x36\x20\xed\x43\x2b\x00\xc9\x3a\x1c\x00\xfe\xec\xd8\x3a\x1b\x00\xe6\xe0\x32"
+"\x1b\x00\x3a\x1d\x08\x00\x10\x1d\x26\x00\xf5\x2c\xed\x4b\x1b\x00\xed\x42\xd8\x28\x11\x2b\x3e\x03\xbc\xd8\x23\x11\x40\x00\xed\x52"
+"\xd8\x11\x20\x00\x19\xc9\x37\xc9\xf1\xff\xfe\x97\xdf\x3e\xf7\xed\x47\xf3\x21\x48\xf7\x01\x03\x03\xed\xb3\x2a\x0b\x00\x2b\x7e\x32"
+"\x69\x00\x36\xfb\xed\x73\x6a\x7e\x01\x80\xf3\xcd\x70\xf5\x3e\x07\xd3\x03\x1e\x00\x80\x3a\x69\x00\x77\xe1\x22\x0b\x00\xd3\x01\x65"
+"\x73\x63\x00\xed\x7b\x6a\xc3\x01\xf1\x08\x21\x21\xf6\xe5\xed\x4d\xcd\x3c\xf5\x1a\xbe\x20\x08\x0b\x23\x13\x78\xb1\xc8\x18\xf4\xe7"
+"\x07\x44\x04\x30\xe7\x0e\xeb\x0a\x00\xf0\x39\xeb\x1a\xe7\x06\xe7\x02\x8d\xe7\x01\xfe\x0d\xc0\x18\xdc\x31\x51\x41\x59\x32\x57\x53"
+"\x58\x33\x45\x44\x43\x34\x52\x46\x56\x35\x54\x47\x42\x36\x5a\x48\x4e\x37\x55\x4a\x4d\x38\x49\x4b\x2c\x39\x4f\x4c\x2e\x30\x50\x2b"
+"\x2f\x2d\x40\x2a\x5e\x5b\x5d\x5c\x5f\x00\x0d\x08\x09\x20\x00\x0b\x0a\x6e\xf7"
+;
+unsigned char dump_z1013_mon_a2[2048];
+static const unsigned char dump_kc_basic_lz4[] =
+"\xf0\x0d\x00\x01\xff\x2a\x00\x03\xc0\x96\x44\x75\x63\x68\x43\xd3\xd3\xd3\x4b\x43\x2d\x42\x41\x53\x49\x43\x20\x6d\x2b\x20\x01\x00"
+"\xf1\xe3\xcb\x7b\x28\x0a\xcd\x13\x01\xb7\x28\x07\xcb\xbb\x18\x03\xcd\x24\x01\x57\xc9\xc5\xd5\xaf\x32\x04\x00\xe7\x04\xb7\x28\x03"
+"\xcd\x26\x01\xd1\xc1\xc9\xe7\x01\xfe\x17\xd0\xfe\x13\xc8\xfe\x01\x28\x0d\xfe\x05\x28\x0b\xfe\x10\x28\x09\xfe\x12\xd8\xd6\x10\xc6"
+"\x05\xc6\x04\xc6\x0f\xc9\xcd\xf5\x2a\x3e\x4e\xcd\xf1\xff\x18\x0c\xcd\xf5\x2a\x2a\xd7\x2b\x22\x1d\x00\xcd\xf4\xff\x2a\x2b\x00\x01"
+"\x00\xec\xaf\xed\x42\x47\x11\x20\x00\xed\x52\x04\x30\xfb\x85\x83\x3c\x4f\xed\x43\x70\x00\xd9\xc9\x00\x00\x00\xcd\xe1\x10\xe5\x11"
+"\xf3\x10\xd5\xcd\x24\x17\xa7\x28\x15\xfe\x03\x30\x11\xf5\xcd\xbb\xff\x38\x0a\xf1\xfe\x01\x28\x01\x48\x79\xc3\xc0\x13\xf1\xc3\x48"
+"\x06\xf3\xaf\x32\x2f\x00\xcd\xe6\x01\xed\xa1\xea\xa4\x01\xcd\xde\x01\x3a\x7b\x00\xcd\xcd\x01\x2a\x2d\x00\x06\x80\x7e\xcd\xcd\x01"
+"\x3a\x2f\x00\x86\x32\x2f\x00\x23\x10\xf2\xcd\xcd\x01\xfb\xc9\xc5\x4f\x06\x08\xcb\x09\xf5\xdc\xe6\x01\xf1\xd4\xe2\x01\x10\xf4\xc1"
+"\x1e\x7b\x18\x06\x1e\x18\x18\x02\x1e\x36\xd5\x3e\x80\xd3\x02\xcd\xf8\x01\xd1\xaf\x07\x00\xf0\x0c\xc9\x1d\x20\xfd\xc9\xf3\x21\x7b"
+"\x00\x06\x16\xcd\x42\x02\xfe\xdc\x38\xf7\x10\xf7\x06\x02\x0e\x13\xcd\x47\x02\x0b\x00\x31\xcd\x36\x02\x64\x00\xe2\x1e\x00\xcd\x36"
+"\x02\xd8\x7b\x86\x23\x5f\x10\xf6\x21\x2f\x0d\x00\xf0\x7f\xbe\xc8\x37\xc9\x16\x09\x3f\xcb\x1e\xcd\x42\x02\x15\x20\xf7\xc9\x0e\x12"
+"\xcd\x47\x02\x3e\x18\x3d\x20\xfd\x08\xd5\x2f\x57\x0d\xdb\x02\xaa\xe6\x40\x28\xf8\x7a\x08\x79\xfe\x30\xd1\xc9\x28\x63\x29\x6d\x61"
+"\x69\x6e\xf5\xf1\xcd\xfc\x01\xf5\xe5\x21\x7c\x00\x3a\x7b\x00\xbe\xe1\x38\xf0\x20\x04\xf1\x38\x0a\xc9\x21\xe7\x2a\xf1\xcd\xd2\x2a"
+"\x37\xc9\x21\xdc\x2a\x18\xf6\xcd\xbe\x0b\x20\x0c\xcd\xf3\x20\xfe\x03\x28\x04\xfe\x1e\x20\xf5\xc9\xcd\x5e\x0c\xe5\x21\x01\x00\xdd"
+"\x21\xe6\x2a\x3e\x04\x0e\x84\x06\x0a\xdd\x86\x00\x10\xfb\x0d\x20\xf6\x3d\x20\xf1\xa7\xeb\xed\x52\xeb\x28\x10\xd5\x30\x00\xd0\x1e"
+"\x28\x07\xfe\x03\x28\x03\xd1\x18\xd5\xd1\xe1\xc9\x46\x00\xf0\x47\x0f\xe5\x2a\x6e\x00\x22\x08\x00\x22\x09\x00\xcd\xeb\x02\xe1\xc9"
+"\xcd\xbd\x0b\xc8\x18\xfa\xc5\xd5\xed\x4b\x09\x00\xed\x5b\x08\x00\xcd\xe8\x01\xdd\xbe\x00\x10\xf4\xd1\xc1\xc9\x18\x03\xc3\x8c\x03"
+"\xcd\x32\x26\x3e\x40\x32\x6e\x00\x21\xbd\x03\x11\x00\x2b\x01\x67\x00\xed\xb0\xeb\xf9\xcd\x69\x09\x32\xab\x2b\x32\x00\x2c\x21\x92"
+"\x03\xcd\xc9\x14\x21\xae\x06\x00\xf0\x2e\xcd\xae\x08\x21\x62\x2b\xcd\x86\x0c\x7a\xd6\x2e\x21\x00\x2b\x2b\x30\x03\x11\xff\xe7\x23"
+"\xcd\x89\x09\x28\x09\x7e\x47\x2f\x77\xbe\x70\x28\xf2\x2b\x11\x00\xff\x22\xb0\x2b\x19\x22\x56\x2b\xcd\x41\x09\x2a\x56\x2b\x11\xef"
+"\xd3\x19\xcd\x29\x1b\x21\xa0\x41\x00\xf1\x07\x2a\x04\x23\x7e\xfe\x78\x20\x01\x3e\xaf\x32\xfc\x2b\x31\x67\x2b\x18\x0a\x7f\x7f\x52"
+"\x45\x93\x02\xb3\x00\xcd\x69\x09\xc3\x88\x06\x0c\x0a\x0d\x48\xa5\x02\xf0\x18\x0a\x0d\x00\x20\x42\x59\x54\x45\x53\x20\x46\x52\x45"
+"\x45\x0a\x0d\x00\x4d\x45\x4d\x4f\x52\x59\x20\x53\x49\x5a\x45\x3f\x20\x3a\x00\xc3\x89\x03\xc3\x67\x0c\x00\x01\x00\xd0\xd6\x00\x6f"
+"\x7c\xde\x00\x67\x78\xde\x00\x47\x3e\x00\x60\x02\xf0\x22\x35\x4a\xca\x99\x39\x1c\x76\x98\x22\x95\xb3\x98\x0a\xdd\x47\x98\x53\xd1"
+"\x99\x99\x0a\x1a\x9f\x98\x65\xbc\xcd\x98\xd6\x77\x3e\x98\x52\xc7\x4f\x80\x0b\xff\x1b\x00\x0a\x00\x0a\x00\x00\x00\xc3\xae\x08\x46"
+"\x00\x01\x04\x00\x50\x65\x2c\xfe\xff\x00\x44\x00\xf0\xff\xff\x2d\x01\x2c\x00\x00\x00\xc5\x4e\x44\xc6\x4f\x52\xce\x45\x58\x54\xc4"
+"\x41\x54\x41\xc9\x4e\x50\x55\x54\xc4\x49\x4d\xd2\x45\x41\x44\xcc\x45\x54\xc7\x4f\x54\x4f\xd2\x55\x4e\xc9\x46\xd2\x45\x53\x54\x4f"
+"\x52\x45\xc7\x4f\x53\x55\x42\xd2\x45\x54\x55\x52\x4e\xd2\x45\x4d\xd3\x54\x4f\x50\xcf\x55\x54\xcf\x4e\xce\x55\x4c\x4c\xd7\x41\x49"
+"\x54\xc4\x45\x46\xd0\x4f\x4b\x45\xc4\x4f\x4b\x45\xc1\x55\x54\x4f\xcc\x49\x4e\x45\x53\xc3\x4c\x53\xd7\x49\x44\x54\x48\xc2\x59\x45"
+"\xa1\xc3\x41\x4c\x4c\xd0\x52\x49\x4e\x54\xc3\x4f\x4e\x54\xcc\x49\x53\x54\xc3\x4c\x45\x41\x52\xc3\x4c\x4f\x41\x44\xc3\x53\x41\x56"
+"\x45\xce\x45\x57\xd4\x41\x42\x28\xd4\x4f\xc6\x4e\xd3\x50\x43\x28\xd4\x48\x45\x4e\xce\x4f\x54\xd3\x54\x45\x50\xab\xad\xaa\xaf\xde"
+"\xc1\x4e\x44\xcf\x52\xbe\xbd\xbc\xd3\x47\x4e\xc9\x4e\x54\xc1\x42\x53\xd5\x53\x52\xc6\x52\x45\xc9\x4e\x50\xd0\x4f\x53\xd3\x51\x52"
+"\xd2\x4e\x44\xcc\x4e\xc5\x58\x50\xc3\x4f\x53\xd3\x49\x4e\xd4\x41\x4e\xc1\x54\x4e\xd0\x45\x45\x4b\xc4\x45\x45\x4b\xd0\x49\xcc\x45"
+"\x4e\xd3\x54\x52\x24\xd6\x41\x4c\xc1\x53\x43\xc3\x48\x52\x24\xcc\x45\x46\x54\x24\xd2\x49\x47\x48\x54\x24\xcd\x49\x44\x24\xcc\x4f"
+"\x41\x44\xd4\x52\x4f\x4e\xd4\x52\x4f\x46\x46\xc5\x44\x49\x54\xc5\x4c\x53\x45\x80\x1a\x0c\xde\x0a\xdc\x0f\x48\x0d\xec\x0e\x01\x12"
+"\x1f\x0f\x5d\x0d\x07\x0d\xeb\x0c\xcf\x0d\xdf\x0b\xf6\x0c\x25\x0d\x4a\x0d\x18\x0c\xec\x16\xb3\x0d\xc0\x0e\xf7\x16\xc4\x13\x37\x17"
+"\x4e\x17\xfa\x08\xea\x09\xd0\x20\xb9\x0e\xf4\x22\x4a\x0d\x38\x1e\xfa\x0d\x48\x0c\xf2\x09\xaa\x0c\x43\x1f\x41\x20\x40\x09\x2d\x09"
+"\xb7\x0a\xb8\x0a\xe7\x06\x4a\x0d\xa6\x19\x70\x1a\xbc\x19\x03\x2b\x90\x13\xe3\x16\xbd\x13\x1f\x1c\xfd\x1c\x59\x18\x6d\x1c\x70\x1d"
+"\x76\x1d\xd7\x1d\xec\x1d\x31\x17\x44\x17\xd5\x19\x2c\x16\x56\x14\xbf\x16\x3b\x16\x4b\x16\x5b\x16\x89\x16\x92\x16\x79\x11\x1b\x79"
+"\x6a\x17\x7c\x98\x18\x7c\xf3\x18\x7f\x28\x1c\x50\x5e\x11\x46\x5d\x11\x4e\x46\x53\x4e\x52\x47\x4f\x44\x46\x43\x4f\x56\x4f\x4d\x55"
+"\x4c\x42\x53\x44\x44\x2f\x30\x49\x44\x54\x4d\x4f\x53\x4c\x53\x53\x54\x43\x4e\x55\x46\x4d\x4f\x49\x4f\x20\x45\x52\x52\x4f\x52\x07"
+"\x00\x20\x49\x4e\x20\x00\x46\x49\x4c\x45\x20\x46\x4f\x55\x4e\x44\x0d\x4f\x4b\x0d\x00\x42\x52\x45\x41\x4b\x00\xe5\x2a\xdb\x2b\x06"
+"\x00\x09\x09\x3e\xe5\x3e\xd0\x95\x6f\x3e\xff\x9c\x38\x04\x67\x39\xe1\xd8\x1e\x0c\x18\x14\x2a\xca\x2b\x22\x58\x2b\x1e\x02\x01\x1e"
+"\x14\x01\x1e\x00\x01\x1e\x12\x01\x1e\x22\x3c\x03\xf2\x21\x43\x2b\xcd\x55\x0e\x21\xdd\x05\x57\x19\x44\x4d\x0b\x3e\x3f\x1e\x03\xcd"
+"\xd6\x14\x21\x05\x06\xcd\xc9\x14\x2a\x58\x2b\x11\xfe\xff\xcd\x89\x09\xca\x0d\x03\x7c\xa5\x3c\xc4\x21\x1b\x3e\xc1\xaf\x32\x30\x00"
+"\x10\x1d\x21\x00\x70\x37\xdc\xfd\x20\xcd\xdf\x09\x58\x00\xf0\x28\x21\xea\x2b\x3a\x4d\x2b\xb7\x28\x6b\xed\x5b\x4e\x2b\xf2\xf0\x06"
+"\xd5\xcd\x2a\x1b\xd1\xd5\xcd\xbb\x07\x3e\x2a\x38\x02\x3e\x20\xcd\xae\x09\xcd\xae\x08\xd1\x30\x06\xaf\x32\x4d\x2b\x18\xba\x2a\x50"
+"\x2b\x19\x38\xf4\xd5\x11\xf9\x5e\x00\xf2\x2c\xd1\x30\xea\x22\x4e\x2b\x21\x62\x2b\xf5\x18\x47\xc8\xcd\x97\x09\xcd\x86\x0c\xc0\xc1"
+"\xcd\xbb\x07\x30\x58\xd5\x7e\x23\xb6\x23\x28\x02\x3e\x7f\x32\x4d\x2b\x7e\x23\x66\x6f\x22\x4e\x2b\xcd\x98\x21\xd1\xc2\x96\x06\x38"
+"\xb7\x3f\x18\xcd\x3e\x3e\x57\x00\xf0\x12\xda\x96\x06\x21\x61\x2b\xcd\xbd\x0b\x3c\x3d\xca\x96\x06\xf5\xcd\x86\x0c\xd5\xcd\xda\x07"
+"\x47\xd1\xf1\xd2\x8a\x0b\xd5\xc5\xaf\x32\xcd\x1c\x00\xf0\x77\xb7\xf5\xcd\xbb\x07\x38\x08\xf1\xf5\xb7\x20\x03\xc3\x20\x0d\xc5\x30"
+"\x11\xeb\x2a\xd7\x2b\x1a\x02\x03\x13\xcd\x89\x09\x20\xf7\xed\x43\xd7\x2b\xd1\xf1\x28\x22\x2a\xd7\x2b\xe3\xc1\x09\xe5\xcd\xab\x07"
+"\xe1\x22\xd7\x2b\xeb\x36\xff\xd1\x23\x23\x73\x23\x72\x23\x11\x62\x2b\x1a\x77\x23\x13\xb7\x20\xf9\xcd\x4f\x09\x23\xeb\x21\x96\x06"
+"\xe5\x62\x6b\x7e\x23\xb6\xc8\x23\x7e\x23\xa6\x3c\xc8\x23\xaf\xbe\x23\x20\xfc\xeb\x73\x23\x72\x18\xe8\xcd\x30\x06\xc5\xe3\xc1\xcd"
+"\x89\x09\x7e\x02\xc8\x0b\x2b\x18\xf6\x2a\x5f\x2b\x44\x4d\x7e\x23\xb6\x2b\xc8\x23\x23\xc6\x00\x50\xcd\x89\x09\x60\x69\x09\x00\xf0"
+"\x79\x3f\xc8\x3f\xd0\x18\xe4\xaf\x32\xaf\x2b\x0e\x05\x11\x62\x2b\xaf\x32\xfb\x2b\x7e\xfe\x20\xca\x71\x08\x47\xfe\x22\xca\x91\x08"
+"\xb7\xca\x97\x08\x3a\xaf\x2b\xb7\x7e\x20\x73\xfe\x3f\x3e\x9e\x28\x6d\x7e\xfe\x30\x38\x04\xfe\x3c\x38\x64\xd5\x11\x20\x04\xc5\x01"
+"\x6d\x08\xc5\x06\x7f\x7e\xfe\x61\x38\x07\xfe\x7b\x30\x03\xe6\x5f\x77\x4e\xeb\x23\xb6\xf2\x26\x08\x04\x7e\xe6\x7f\x20\x15\x3a\xfc"
+"\x2b\xa7\xc8\x3a\xfb\x2b\xa7\xc0\x3c\x32\xfb\x2b\x2a\x0c\x23\x7e\xe6\x7f\xc8\xb9\x20\xdd\xeb\xe5\x13\x1a\xb7\xfa\x69\x08\x4f\x78"
+"\xfe\x88\x20\x04\xcd\xbd\x0b\x2b\x23\x44\x00\xf0\x67\x02\xe6\x5f\xb9\x28\xe5\xe1\x18\xbb\x48\xf1\xeb\xc9\xeb\x79\xc1\xd1\x23\x12"
+"\x13\x0c\xd6\x3a\x28\x04\xfe\x49\x20\x03\x32\xaf\x2b\xd6\x54\x28\x05\xd6\x0e\xc2\xe3\x07\x47\x7e\xb7\x28\x09\xb8\x28\xe0\x23\x12"
+"\x0c\x13\x18\xf3\x21\x61\x2b\x12\x13\x12\x13\x12\xc9\x4c\x49\x53\x54\x00\x52\x55\x4e\x00\x43\x4f\x4e\x54\x00\xe5\x21\x62\x2b\xe3"
+"\xcd\xe4\x20\xe3\xfe\x1c\x11\x9f\x08\x28\x0e\xfe\x1d\x11\xa4\x08\x28\x07\xfe\x1e\x11\xa8\x08\x20\x14\x21\x61\x2b\x23\x13\x1a\x77"
+"\xa7\x20\xf9\xa4\x05\xa0\xf1\x08\xe1\xc3\x5e\x0e\xcd\x0f\x22\x20\x02\x06\xf0\x69\x27\x22\x38\xf9\xcd\x32\x22\x18\xc1\x7e\xb7\xc8"
+"\xcd\xd5\x20\x23\x18\xf7\x11\x0a\x00\xd5\x28\x17\xcd\x86\x0c\xeb\xe3\x28\x11\xeb\xcd\xd6\x0b\xed\x5b\x50\x2b\x28\x06\xcd\x86\x0c"
+"\xc2\x48\x06\xeb\x7d\xb4\xca\x67\x0c\x22\x50\x2b\xcb\xff\x32\x4d\x2b\xe1\x22\x4e\x2b\xc1\xc3\x96\x06\xcd\x5f\x21\x3a\x09\x2b\xe6"
+"\x03\x28\xf3\x3e\xd5\xcd\xb2\x1f\xf1\xaf\x18\xea\xc0\x2a\x5f\x2b\xaf\x32\x5e\x2b\x77\x23\x77\x23\x22\xd7\x2b\x2a\x5f\x2b\x2b\x22"
+"\xcf\x2b\x2a\xb0\x2b\x22\xc4\x2b\xaf\xcd\xdf\x0b\x0f\x08\xf0\x29\xd9\x2b\x22\xdb\x2b\xc1\x2a\x56\x2b\xf9\x21\xb4\x2b\x22\xb2\x2b"
+"\xcd\x1d\x21\xaf\x6f\x67\x22\xd5\x2b\x32\xcc\x2b\x22\xdf\x2b\xe5\xc5\x2a\xcf\x2b\xc9\x7c\x92\xc0\x7d\x93\xc9\x7e\xfe\x41\xd8\xfe"
+"\x5b\x3f\xc9\x3a\x5e\x2b\xa7\xc8\x10\x06\xf0\x27\x6e\x06\xcd\x89\x09\x3e\x08\x18\x02\x3e\x20\xc3\xd5\x20\xf5\xc5\x4f\xfe\x20\x38"
+"\x13\x3a\x41\x2b\x47\x3a\xac\x2b\x04\x28\x05\x05\xb8\xcc\x61\x0e\x3c\x32\xac\x2b\x79\xcd\xd5\x20\xc1\xf1\xc9\x3e\x3f\xcd\xae\x09"
+"\x3e\x09\xc0\x02\xf0\x09\xdf\x09\xc3\x4a\x2b\x21\x00\x20\x22\x61\x2b\x22\x63\x2b\x65\xc9\xcd\x6c\x0c\xed\x53\x46\x2b\xc9\x0a\x03"
+"\x71\x25\x21\xcd\xc8\x20\x28\x12\xc6\x00\x30\x2a\x46\x2b\x27\x03\x64\xff\xff\x22\x46\x2b\xe1\x24\x03\xf1\x33\xc5\xcd\x91\x0a\xe1"
+"\x4e\x23\x46\x23\x78\xb1\x28\x59\xcd\x67\x0a\xcd\xf9\x0b\xc5\x5e\x23\x56\x23\xe5\x21\xea\x2b\xcd\x61\x0e\xcd\x2a\x1b\x3e\x20\xe1"
+"\xcd\xae\x09\x7e\x23\xfe\x22\x28\x14\xb7\x28\xd3\xf2\x3c\x0a\xcd\x9a\x0a\xcd\xae\x09\x1a\x13\xb7\xf2\x4e\x0a\x18\xe6\x1d\x00\xf0"
+"\x10\xb7\x28\xba\xfe\x22\x28\xd7\x18\xf2\xe5\x2a\x44\x2b\x7d\xb4\x2b\x22\x44\x2b\xe1\xc0\xcd\x91\x0a\xcd\xe4\x20\xfe\x03\x20\xea"
+"\x85\x00\x10\x0c\x4f\x00\xc0\xfd\x20\x2a\x4e\x2b\x22\x46\x2b\xc3\x8c\x03\xe5\x90\x00\xf0\x07\x44\x2b\xe1\xc9\xd6\x7f\xfe\x56\x38"
+"\x08\xd6\x55\xed\x5b\x0c\x23\x18\x03\x11\x21\x04\x47\x5b\x00\xf0\x07\xac\x0a\x10\xf8\xe6\x7f\xc9\x3e\xaf\x32\x0a\x2b\xc9\x21\x04"
+"\x00\x39\x7e\x23\xfe\x81\xc0\xaa\x00\xf0\x39\xe5\x69\x60\x7a\xb3\xeb\x28\x04\xeb\xcd\x89\x09\x01\x0d\x00\xe1\xc8\x09\x18\xe3\x3e"
+"\x64\x32\xcc\x2b\xcd\x5d\x0d\xc1\xe5\xcd\x48\x0d\x22\xc8\x2b\x21\x02\x00\x39\xcd\xc1\x0a\xd1\x20\x14\x09\xd5\x2b\x56\x2b\x5e\x23"
+"\x23\xe5\x2a\xc8\x2b\xcd\x89\x09\xe1\x20\xe8\xd1\xf9\xeb\x0e\x08\xcd\x27\x06\x12\x00\xf3\x17\xe3\xe5\x2a\x58\x2b\xe3\xcd\x29\x10"
+"\xcd\xcc\x0b\xa6\xcd\x26\x10\xe5\xcd\xeb\x19\xe1\xc5\xd5\x01\x00\x81\x51\x5a\x7e\xfe\xab\x3e\x01\x20\x0e\xcd\xbd\x0b\x19\x00\x20"
+"\xcd\x97\x1c\x00\xf0\x26\xf5\x33\xe5\x2a\xcf\x2b\xe3\x06\x81\xc5\x33\xcd\x16\x21\xcd\xf9\x0b\x22\xcf\x2b\x7e\xfe\x3a\x28\x28\xb7"
+"\xc2\x48\x06\x23\x7e\x23\xb6\xca\x22\x0c\x23\x5e\x23\x56\xed\x53\x58\x2b\x3a\x0a\x2b\xb7\x28\x0f\xe5\x3e\x3c\xa8\x01\x21\x2a\x1b"
+"\x70\x04\xf0\x0c\xe1\xcd\xbd\x0b\x11\x54\x0b\xd5\xc8\xd6\x80\xda\x5d\x0d\xfe\x25\x38\x14\xd6\x50\x38\x34\xfe\x05\x38\x0a\x47\x73"
+"\x03\xf0\x52\x28\x29\xc3\x03\x23\xc6\x25\x07\x4f\x06\x00\xeb\x21\x40\x05\x09\x4e\x23\x46\xc5\xeb\x23\x7e\xfe\x3a\xd0\xfe\x20\x28"
+"\xf7\xfe\x30\x3f\x3c\x3d\xc9\x7e\xe3\xbe\x23\xe3\x28\xea\xc3\x48\x06\x3e\x2c\xbe\x18\xf6\x3e\x29\x18\xf9\xeb\x2a\x5f\x2b\x28\x0e"
+"\xeb\xcd\x86\x0c\xe5\xcd\xbb\x07\x60\x69\xd1\xd2\x20\x0d\x2b\x22\xdd\x2b\xeb\xc9\xcd\xf3\x20\xc0\xfe\x13\x28\x08\xfe\x03\xc0\xcd"
+"\xe4\x20\x18\x0f\x93\x01\xf1\x18\x1e\xc8\xfe\x0a\xc8\xfe\x03\x28\x02\x18\xf1\xc0\xf6\xc0\x22\xcf\x2b\x21\xf6\xff\xc1\x2a\x58\x2b"
+"\xf5\x7d\xa4\x3c\x28\x09\x22\xd3\x2b\x2a\xcf\x2b\x22\xd5\x2b\xac\x05\xf0\x0d\x1d\x21\xcd\x55\x0e\xf1\x21\x21\x06\xc2\x71\x06\xc3"
+"\x88\x06\x2a\xd5\x2b\x7c\xb5\x1e\x20\xca\x56\x06\xeb\x2a\xd3\xb9\x05\x10\xeb\x76\x09\xf0\x52\xcd\x26\x10\xcd\x97\x19\xf2\x6f\x0c"
+"\x1e\x08\xc3\x56\x06\xcd\x26\x10\x3a\xe8\x2b\xfe\x90\xda\x45\x1a\x01\x80\x90\x11\x00\x00\xe5\xcd\x18\x1a\xe1\x51\xc8\x18\xe1\x2b"
+"\x11\x00\x00\xcd\xbd\x0b\xd0\xe5\xf5\x21\x98\x19\xcd\x89\x09\xda\x48\x06\x62\x6b\x19\x29\x19\x29\xf1\xd6\x30\x5f\x16\x00\x19\xeb"
+"\xe1\x18\xe0\x28\x3c\xcd\x5e\x0c\xcd\xbe\x0b\xe5\x2a\xb0\x2b\x28\x10\xe1\xcd\xd6\x0b\xd5\xcd\x6c\x11\x00\xf1\x2b\xc2\x48\x06\xe3"
+"\xeb\x7d\x93\x5f\x7c\x9a\x57\xda\x3e\x06\xe5\x2a\xd7\x2b\x01\x28\x00\x09\xcd\x89\x09\xd2\x3e\x06\xeb\x22\x56\x2b\xe1\x22\xb0\x2b"
+"\xe1\xc3\x53\x09\xca\x4f\x09\xcd\x53\x09\x01\x54\x0b\x18\x10\x0e\x03\xcd\x27\x06\xc1\xe5\xe6\x01\xb0\x3e\x8c\xf5\x33\xc5\xcd\x86"
+"\x0c\xcd\x4a\x0d\x10\x00\x00\x0d\x02\x50\x23\xdc\xbe\x07\xd4\x2f\x01\xf0\x29\x2b\xd8\x1e\x0e\xc3\x56\x06\xc0\x16\xff\xcd\xbd\x0a"
+"\xf9\xfe\x8c\x1e\x04\x20\xf0\xe1\x22\x58\x2b\x23\x7c\xb5\x20\x07\x3a\xcd\x2b\xb7\xc2\x87\x06\x21\x54\x0b\xe3\x3e\xe1\x01\x3a\x0e"
+"\x00\x06\x00\x79\x48\x47\x7e\xb7\xc8\xb8\xc8\x16\x03\xf0\x14\xf3\x18\xf4\xcd\x06\x12\xcd\xcc\x0b\xb4\xd5\x3a\xae\x2b\xf5\xcd\x3a"
+"\x10\xf1\xe3\x22\xcf\x2b\x1f\xcd\x2b\x10\x28\x35\xe5\x2a\xe5\x2b\xe5\x23\x10\x02\x20\x2a\x5f\x80\x02\x40\x30\x12\x2a\x56\x08\x00"
+"\x50\xd1\x30\x11\x21\xc0\x09\x00\xf0\x09\x30\x09\x3e\xd1\xcd\x1b\x16\xeb\xcd\x66\x14\xcd\x1b\x16\xe1\xcd\xfa\x19\xe1\xc9\xe5\xcd"
+"\xf7\x19\xe2\x0a\xf1\x12\x21\x17\x7e\x47\xfe\x8c\x28\x05\xcd\xcc\x0b\x88\x2b\x4b\x0d\x78\xca\x92\x0b\xcd\x87\x0c\xfe\x2c\xc0\x18"
+"\xf3\xcd\x3a\x10\x7e\xfe\x88\x1b\x00\x20\xa9\x2b\xc0\x02\xf1\x19\x97\x19\x20\x08\x23\x7e\xb7\xc8\xfe\xd4\x20\xf8\xcd\xbd\x0b\xda"
+"\x07\x0d\xc3\x91\x0b\xcd\xbe\x0b\x18\x07\xaf\x32\xfd\x2b\xcd\x25\x21\x28\x5e\xc8\xfe\xd5\x38\x09\x64\x02\xf0\x22\x03\xcd\x06\x23"
+"\xfe\xa5\xca\x92\x0e\xfe\xa8\x28\x78\xe5\xfe\x2c\x28\x5d\xfe\x3b\xca\xb2\x0e\xc1\xcd\x3a\x10\xe5\x3a\xae\x2b\xb7\x20\x20\xcd\x34"
+"\x1b\xcd\x8a\x14\x36\x20\x2a\xe5\x2b\x34\x2a\xe5\x2b\x89\x04\xf0\x12\x04\x28\x0a\x04\x3a\xac\x2b\x86\x3d\xb8\xd4\x61\x0e\xcd\xcc"
+"\x14\xe1\x18\xa0\x3a\xac\x2b\xb7\xc8\x18\x05\x36\x00\x21\x61\x2b\x3e\x0d\x92\x04\x00\x1a\x04\xf1\x04\xaf\x32\xac\x2b\x3a\x40\x2b"
+"\x3d\xc8\xf5\xaf\xcd\xae\x09\xf1\x18\xf6\x3a\x42\xc7\x04\x00\x38\x00\xf1\x15\x30\x29\xd6\x0d\x38\x02\x20\xfa\x2f\x18\x15\xf5\xcd"
+"\x1e\x17\xcd\xdb\x0b\x2b\xf1\xd6\xa8\xe5\x28\x03\x3a\xac\x2b\x2f\x83\x30\x0b\x3c\x28\x08\x47\xee\x07\x20\x10\xfb\x29\x03\xf0\x2d"
+"\xc3\x03\x0e\xcd\x21\x17\x32\x41\x2b\xc9\xcd\x21\x17\xc0\x3c\x32\x40\x2b\xc9\x3f\x52\x45\x44\x4f\x20\x46\x52\x4f\x4d\x20\x53\x54"
+"\x41\x52\x54\x0d\x00\x3a\xce\x2b\xb7\xc2\x42\x06\xc1\x21\xc9\x0e\xcd\xc9\x14\xc3\x85\x09\xcd\x37\x14\xcd\x5f\x21\xbe\x02\xf0\x33"
+"\x7e\xfe\x22\x20\x10\xcd\x8b\x14\xcd\xcc\x0b\x3b\xe5\xcd\xcc\x14\xcd\xd4\x09\x18\x04\xe5\xcd\xcf\x09\xc1\x38\x36\x21\x62\x2b\x7e"
+"\xb7\x2b\xc5\x28\x37\x36\x2c\x18\x05\xe5\x2a\xdd\x2b\xf6\xaf\x32\xce\x2b\xe3\x18\x03\xcd\xd6\x0b\xcd\x06\x12\xe3\xd5\x7e\xfe\x2c"
+"\x28\x1e\x5d\x00\x21\x20\x7d\x6f\x05\x83\xcd\xcf\x09\xd1\xc1\xda\x1f\x0c\x39\x00\x30\xca\x47\x0d\xf1\x01\xc0\xb7\x28\x21\xcd\xbd"
+"\x0b\x57\x47\xfe\x22\x28\x0c\x2d\x00\xf0\x05\x57\x28\x02\x16\x3a\x06\x2c\x2b\xcd\x8e\x14\xeb\x21\x88\x0f\xe3\xd5\xc3\x77\x0d\x44"
+"\x04\xf0\x03\xa1\x1a\xe3\xcd\xf7\x19\xe1\xcd\xbe\x0b\x28\x05\xfe\x2c\xc2\xdb\x0e\xe3\xc2\x0c\x20\x93\xd1\x34\x00\xf0\x15\xeb\xc2"
+"\xf4\x0b\xd5\xb6\x21\xab\x0f\xc4\xc9\x14\xe1\xc9\x3f\x45\x58\x54\x52\x41\x20\x49\x47\x4e\x4f\x52\x45\x44\x0d\x00\xcd\x48\x0d\xb7"
+"\x20\x11\x5b\x04\x50\x1e\x06\xca\x56\x06\x4d\x02\x30\xed\x53\xca\x94\x08\xf1\x16\xfe\x83\x20\xe2\xc3\x56\x0f\x11\x00\x00\xc4\x06"
+"\x12\x22\xcf\x2b\xcd\xbd\x0a\xc2\x4e\x06\xf9\xd5\x7e\x23\xf5\xd5\xcd\xdd\x19\xe3\xe5\xcd\x61\x17\xe1\x76\x00\x21\xee\x19\x84\x03"
+"\x70\xc1\x90\xcd\xee\x19\x28\x09\x9c\x04\x70\x69\x60\xc3\x50\x0b\xf9\x2a\xbd\x04\x40\x2c\xc2\x54\x0b\xa3\x00\xf0\x00\xdf\x0f\xcd"
+"\x3a\x10\xf6\x37\x3a\xae\x2b\x8f\xb7\xe8\x1e\x18\xca\x03\xf1\x13\xcc\x0b\x28\x2b\x16\x00\xd5\x0e\x01\xcd\x27\x06\xcd\xad\x10\x22"
+"\xd1\x2b\x2a\xd1\x2b\xc1\x78\xfe\x78\xd4\x29\x10\x7e\x16\x00\xd6\xb3\x38\xd3\x0e\xb0\xfe\x01\x17\xaa\xba\x57\xda\x48\x06\x22\xc6"
+"\x98\x00\xf0\x27\x18\xe7\x7a\xb7\xc2\x84\x11\x7e\x22\xc6\x2b\xd6\xac\xd8\xfe\x07\xd0\x5f\x3a\xae\x2b\x3d\xb3\x7b\xca\xb3\x15\x07"
+"\x83\x5f\x21\xc8\x05\x19\x78\x56\xba\xd0\x23\xcd\x29\x10\xc5\x01\x49\x10\xc5\x43\x4a\xcd\xc8\x19\x58\x51\xdd\x05\x90\xc5\x2a\xc6"
+"\x2b\x18\x90\xaf\x32\xae\x47\x00\xf0\x3d\x1e\x24\xca\x56\x06\xda\xa1\x1a\xcd\x8f\x09\x30\x37\xfe\xac\x28\xe8\xfe\x2e\xca\xa1\x1a"
+"\xfe\xad\x28\x19\xfe\x22\xca\x8b\x14\xfe\xaa\xca\xe3\x11\xfe\xa7\xca\xf0\x13\xd6\xb6\x30\x28\xcd\x36\x10\xc3\xdb\x0b\x16\x7d\xcd"
+"\x3d\x10\x2a\xd1\x2b\xe5\xcd\xc0\x19\xcd\x29\x10\xe1\xc9\xcd\x06\x12\xe5\xeb\x22\xe5\x2b\xd7\x02\xf0\x03\xcc\xdd\x19\xe1\xc9\x06"
+"\x00\x07\x4f\xc5\xcd\xbd\x0b\x79\xfe\x33\x38\x07\x0e\x03\x20\xc2\x09\xc6\x03\x80\x1e\xfe\x2d\x38\x17\xcd\x36\x10\xfd\x01\xf0\x05"
+"\x2a\x10\xeb\x2a\xe5\x2b\xe3\xe5\xeb\xcd\x21\x17\xeb\xe3\x18\x08\xcd\xe1\x10\xe3\xc3\x0f\x20\x01\x94\x90\x05\xf0\x07\x66\x69\xe9"
+"\x15\xfe\xad\xc8\xfe\x2d\xc8\x14\xfe\x2b\xc8\xfe\xac\xc8\x2b\xc9\xf6\xaf\xf5\x84\x03\xf0\x35\x6f\x0c\xf1\xeb\xc1\xe3\xeb\xcd\xe0"
+"\x19\xf5\xcd\x6f\x0c\xf1\xc1\x79\x21\xb0\x13\x20\x05\xa3\x4f\x78\xa2\xe9\xb3\x4f\x78\xb2\xe9\x21\x96\x11\x3a\xae\x2b\x1f\x7a\x17"
+"\x5f\x16\x64\x78\xba\xd0\xc3\x97\x10\x98\x11\x79\xb7\x1f\xc1\xd1\xf5\xcd\x2b\x10\x21\xd9\x11\xe5\xca\x18\x1a\xfb\x00\xf2\x2d\xd5"
+"\xcd\xfe\x15\x7e\x23\x23\x4e\x23\x46\xd1\xc5\xf5\xcd\x02\x16\xcd\xee\x19\xf1\x57\xe1\x7b\xb2\xc8\x7a\xd6\x01\xd8\xaf\xbb\x3c\xd0"
+"\x15\x1d\x0a\xbe\x23\x03\x28\xed\x3f\xc3\xa2\x19\x3c\x8f\xc1\xa0\xc6\xff\x9f\xc3\xa9\x19\x16\x5a\xcd\x3d\x10\x88\x00\xf0\x10\x7b"
+"\x2f\x4f\x7a\x2f\xcd\xb0\x13\xc1\xc3\x49\x10\xcd\xbe\x0b\xc8\xcd\xd6\x0b\x01\xfa\x11\xc5\xf6\xaf\x32\xad\x2b\x46\xcd\x8f\x78\x05"
+"\x22\xaf\x4f\x65\x01\xd0\x38\x05\xcd\x8f\x09\x38\x0b\x4f\xcd\xbd\x0b\x38\xfb\x6a\x01\xb0\xf6\xd6\x24\x20\x0a\x3c\x32\xae\x2b\x0f"
+"\x81\x15\x00\xf0\x09\x3a\xcc\x2b\x3d\xca\xdd\x12\xf2\x48\x12\x7e\xd6\x28\x28\x6f\xaf\x32\xcc\x2b\xe5\x50\x59\x2a\xdf\xbd\x04\x90"
+"\x11\xe1\x2b\xca\xe0\x18\x2a\xd9\x2b\x0b\x0b\x00\x1d\x0f\xf2\x1a\x10\x79\x96\x23\x20\x02\x78\x96\x23\x28\x38\x23\x23\x23\x23\x18"
+"\xeb\xe1\xe3\xd5\x11\xfb\x10\xcd\x89\x09\xd1\x28\x29\xe3\xe5\xc5\x01\x06\x00\x2a\xdb\x2b\xe5\x09\xc1\x21\x0b\xa0\xdb\x2b\x60\x69"
+"\x22\xd9\x2b\x2b\x36\x00\x44\x0b\x20\xf8\xd1\x29\x0b\xf0\x12\xeb\xe1\xc9\x32\xe8\x2b\x21\x20\x06\x22\xe5\x2b\xe1\xc9\xe5\x2a\xad"
+"\x2b\xe3\x57\xd5\xc5\xcd\x5b\x0c\xc1\xf1\xeb\xe3\xe5\xeb\x3c\x57\x97\x03\xf0\x0a\xee\xcd\xdb\x0b\x22\xd1\x2b\xe1\x22\xad\x2b\x1e"
+"\x00\xd5\x11\xe5\xf5\x2a\xd9\x2b\x3e\x19\xed\x5b\xdb\x96\x00\x90\x28\x23\x7e\xb9\x23\x20\x02\x7e\xb8\x2a\x03\xf0\x2b\x23\x20\xe8"
+"\x3a\xad\x2b\xb7\xc2\x51\x06\xf1\x44\x4d\xca\xaa\x12\x96\x28\x5f\x1e\x10\xc3\x56\x06\x11\x04\x00\xf1\xca\x67\x0c\x71\x23\x70\x23"
+"\x4f\xcd\x27\x06\x23\x23\x22\xc6\x2b\x71\x23\x3a\xad\x2b\x17\x79\x01\x0b\x00\x30\x02\xc1\x03\x1b\x00\xf5\x09\xf5\xe5\xcd\x89\x1a"
+"\xeb\xe1\xf1\x3d\x20\xea\xf5\x42\x4b\xeb\x19\xda\x3e\x06\xcd\x30\x06\x22\xdb\xb3\x00\xc0\x03\x57\x2a\xc6\x2b\x5e\xeb\x29\x09\xeb"
+"\x2b\x2b\xbe\x00\x90\xf1\x38\x22\x47\x4f\x7e\x23\x16\xe1\x45\x09\x70\xe3\xf5\xcd\x89\x09\x30\x90\x44\x00\xf0\x02\xd1\x19\xf1\x3d"
+"\x44\x4d\x20\xe8\x29\x29\xc1\x09\xeb\x2a\xd1\x2b\xc9\xac\x00\x40\x21\x00\x00\x39\x98\x02\xf1\x28\x28\x0d\xcd\xfe\x15\xcd\x09\x15"
+"\xed\x5b\x56\x2b\x2a\xc4\x2b\x7d\x93\x4f\x7c\x9a\x41\x50\x1e\x00\x21\xae\x2b\x73\x06\x90\xc3\xae\x19\x3a\xac\x2b\x47\xaf\x18\xed"
+"\xcd\x45\x14\xcd\x37\x14\x01\x48\x0d\xc5\xd5\xcd\xcc\x0b\x28\xdb\x02\x00\xde\x08\x10\xe1\xf5\x01\x20\xdb\x0b\x83\x06\xf0\x00\x44"
+"\x4d\xe3\x71\x23\x70\xc3\x84\x14\xcd\x45\x14\xd5\xcd\xe1\x0f\x02\x10\xe3\x8b\x00\x50\x7a\xb3\xca\x54\x06\x34\x0c\xf1\x05\xe5\x2a"
+"\xdf\x2b\xe3\x22\xdf\x2b\x2a\xe3\x2b\xe5\x2a\xe1\x2b\xe5\x21\xe1\x2b\xd5\x22\x04\x10\x26\x29\x02\xe1\xc2\x48\x06\xe1\x22\xe1\x2b"
+"\xe1\x22\xe3\x2b\xe1\x22\xdf\x80\x01\x01\x05\x07\x42\xe1\xc0\x1e\x16\x0f\x04\xd0\xa7\x3e\x80\x32\xcc\x2b\xb6\x47\xcd\x0b\x12\xc3"
+"\x29\x5f\x00\x02\x2a\x06\xe0\xcd\xfe\x15\x01\x57\x16\xc5\x7e\x23\x23\xe5\xcd\xe1\x14\x52\x0a\xf1\x03\xcd\x7e\x14\xe5\x6f\xcd\xf2"
+"\x15\xd1\xc9\xcd\xe1\x14\x21\xc0\x2b\xe5\x77\x09\x0d\xf0\x1d\xe1\xc9\x2b\x06\x22\x50\xe5\x0e\xff\x23\x7e\x0c\xb7\x28\x06\xba\x28"
+"\x03\xb8\x20\xf4\xfe\x22\xcc\xbd\x0b\xe3\x23\xeb\x79\xcd\x7e\x14\x11\xc0\x2b\x2a\xb2\x2b\x22\xe5\x2b\x3e\x01\xa1\x02\x10\xfa\x27"
+"\x08\xf0\x00\x22\xb2\x2b\xe1\x7e\xc0\x1e\x1e\xc3\x56\x06\x23\xcd\x8a\x14\x2e\x01\x50\xee\x19\x1c\x1d\xc8\x6e\x06\xc3\xfe\x0d\xcc"
+"\x66\x0e\x03\x18\xf2\xb7\x0e\xf1\xf5\x41\x01\x50\x2f\x4f\x06\xff\x09\xad\x11\xf2\x05\x38\x07\x22\xc4\x2b\x23\xeb\xf1\xc9\xf1\x1e"
+"\x1a\x28\xc2\xbf\xf5\x01\xe3\x14\xc5\xb3\x0b\xe0\x21\x00\x00\xe5\x2a\x56\x2b\xe5\x21\xb4\x2b\xed\x5b\xb2\x36\x02\xb0\x01\x1a\x15"
+"\x20\x3f\x2a\xd7\x2b\xed\x5b\xd9\x0f\x00\xc0\x28\x0a\x7e\x23\x23\xb7\xcd\x68\x15\x18\xee\xc1\xac\x01\x00\xde\x02\xf0\x01\x49\xcd"
+"\xee\x19\x7b\xe5\x09\xb7\xf2\x3b\x15\x22\xc6\x2b\xe1\x4e\x29\x0f\x41\x23\xed\x5b\xc6\x30\x00\x81\xda\x01\x59\x15\xc5\xf6\x80\x7e"
+"\xed\x07\x80\x23\xf0\xb7\xc8\x44\x4d\x2a\xc4\x1a\x00\xf2\x18\x60\x69\xd8\xe1\xe3\xcd\x89\x09\xe3\xe5\x60\x69\xd0\xc1\xf1\xf1\xe5"
+"\xd5\xc5\xc9\xd1\xe1\x7d\xb4\xc8\x2b\x46\x2b\x4e\xe5\x2b\x2b\x6e\x26\x00\x09\x50\x59\x2b\x2f\x00\xd0\xae\x07\xe1\x71\x23\x70\x69"
+"\x60\x2b\xc3\x0c\x15\xc5\x3d\x08\x90\xe3\xcd\xad\x10\xe3\xcd\x2a\x10\x7e\x0d\x00\xf2\x17\xe5\x86\x1e\x1c\xda\x56\x06\xcd\x7b\x14"
+"\xd1\xcd\x02\x16\xe3\xcd\x01\x16\xe5\x2a\xc2\x2b\xeb\xcd\xe9\x15\xcd\xe9\x15\x21\x46\x10\xe3\xe5\x18\x6f\xe1\xe3\x3b\x04\xf0\x02"
+"\x6f\x2c\x2d\xc8\x0a\x12\x03\x13\x18\xf8\xcd\x2a\x10\x2a\xe5\x2b\xeb\x66\x08\x62\xc0\xd5\x50\x59\x1b\x4e\x98\x00\xc0\x20\x05\x47"
+"\x09\x22\xc4\x2b\xe1\xc9\x2a\xb2\x2b\x8b\x00\x10\x2b\xad\x00\xf2\x04\xc0\x22\xb2\x2b\xc9\x01\xc0\x13\xc5\xcd\xfb\x15\xaf\x57\x32"
+"\xae\x2b\x7e\xb7\x0f\x00\x41\x30\x16\x28\x55\xdb\x00\xf1\x27\x1a\xc9\x3e\x01\xcd\x7b\x14\xcd\x24\x17\x2a\xc2\x2b\x73\xc1\xc3\xa9"
+"\x14\xcd\xda\x16\xaf\xe3\x4f\xe5\x7e\xb8\x38\x02\x78\x11\x0e\x00\xc5\xcd\xe1\x14\xc1\xe1\xe5\x23\x23\x46\x23\x66\x68\x06\x00\x09"
+"\x44\x4d\xcd\x7e\x14\x0a\x02\xf0\x10\xcd\x02\x16\x18\xcf\xcd\xda\x16\xd1\xd5\x1a\x90\x18\xcd\xeb\x7e\xcd\xde\x16\x04\x05\xca\x67"
+"\x0c\xc5\x1e\xff\xfe\x29\x28\x06\x7b\x05\x10\x21\x13\x08\xf2\x0b\xf1\xe3\x01\x61\x16\xc5\x3d\xbe\x06\x00\xd0\x4f\x7e\x91\xbb\x47"
+"\xd8\x43\xc9\xcd\x30\x16\xca\xcf\x17\x5f\x01\x0f\xf0\x22\xe5\x19\x46\x72\xe3\xc5\x7e\xcd\xa1\x1a\xc1\xe1\x70\xc9\xeb\xcd\xdb\x0b"
+"\xc1\xd1\xc5\x43\xc9\xcd\x24\x17\x4f\xed\x78\xc3\xc0\x13\xcd\x14\x17\x3a\x06\x2b\x4f\x7b\xed\x79\xc9\xcd\x14\x17\xf5\x1e\x00\x75"
+"\x07\x03\x5f\x00\x10\xc1\x1a\x00\x60\xed\x78\xab\xa0\x28\xfa\x54\x08\x60\x32\x06\x2b\xcd\xd6\x0b\x6d\x06\x00\xc3\x0a\x60\x61\x0c"
+"\x7a\xb7\xc2\x67\x6c\x0a\xc2\x7b\xc9\xcd\x6f\x0c\x1a\x18\xb2\xcd\x6c\x0c\xd5\x98\x00\x20\xd1\x12\x13\x00\x74\xeb\x46\x23\x7e\xc3"
+"\xb1\x13\x17\x00\xf0\x1d\x6c\x0c\xe3\x73\x23\x72\xe1\xc9\x21\x04\x1c\xcd\xee\x19\x18\x09\xcd\xee\x19\x21\xc1\xd1\xcd\xc0\x19\x78"
+"\xb7\xc8\x3a\xe8\x2b\xb7\xca\xe0\x19\x90\x30\x0c\x2f\x3c\xeb\xcd\xc8\x19\x18\x06\xf0\xf2\xc1\xd1\xfe\x19\xd0\xf5\xcd\x03\x1a\x67"
+"\xf1\xcd\x2a\x18\xb4\x21\xe5\x2b\xf2\xab\x17\xcd\x0a\x18\x30\x4b\x23\x34\x28\x63\x2e\x01\xcd\x3e\x18\x18\x40\xaf\x90\x47\x7e\x9b"
+"\x5f\x23\x7e\x9a\x57\x23\x7e\x99\x4f\xdc\x16\x18\x68\x63\xaf\x47\x79\xb7\x20\x16\x4a\x54\x65\x6f\x78\xd6\x08\xfe\xe0\x20\xf0\xaf"
+"\x32\xe8\x2b\xc9\x05\x29\xcb\x12\xcb\x11\xf2\xd4\x17\x78\x5c\x45\xb7\x28\x08\x21\xe8\x2b\x86\x77\x30\xe5\xc8\x78\x21\xe8\x2b\xb7"
+"\xfc\xfd\x17\x46\x23\x7e\xe6\x80\xa9\x4f\xc3\xe0\x19\x1c\xc0\x14\xc0\x0c\xc0\x0e\x80\x34\xc0\xc3\x53\x19\x7e\x83\x5f\x23\x7e\x8a"
+"\x57\x23\x7e\x89\x4f\xc9\x21\xe9\x2b\x7e\x2f\x77\xaf\x6f\x90\x47\x7d\x9b\x5f\x7d\x9a\x57\x7d\x99\x4f\xc9\x06\x00\xd6\x08\x38\x07"
+"\x43\x5a\x51\x0e\x00\x18\xf5\xc6\x09\x6f\xaf\x2d\xc8\x79\x1f\x4f\xcb\x1a\xcb\x1b\xcb\x18\x18\xf2\x00\x00\x00\x81\x03\xaa\x56\x19"
+"\x80\xf1\x22\x76\x80\x45\xaa\x38\x82\xcd\x97\x19\xb7\xea\x67\x0c\x21\xe8\x2b\x7e\x01\x35\x80\x11\xf3\x04\x90\xf5\x70\xd5\xc5\xcd"
+"\x6f\x17\xc1\xd1\x04\xcd\xf5\x18\x21\x48\x18\xcd\x66\x17\x21\x4c\x18\xcd\xce\x1c\x01\x80\x80\x00\x0c\xc0\x6f\x17\xf1\xcd\x0b\x1b"
+"\x01\x31\x80\x11\x18\x72\x2e\x01\xf4\x2a\x97\x19\xc8\x2e\x00\xcd\x58\x19\x79\x32\xf7\x2b\xeb\x22\xf8\x2b\x01\x00\x00\x50\x58\x21"
+"\xbc\x17\xe5\x21\xbc\x18\xe5\xe5\x21\xe5\x2b\x7e\x23\xb7\x28\x21\xe5\x2e\x08\x1f\x67\x79\x30\x0b\xe5\x2a\xf8\x2b\x19\xeb\xe1\x3a"
+"\xf7\x2b\x89\x96\x00\xf0\x02\x2d\x7c\x20\xe4\xe1\xc9\x43\x5a\x51\x4f\xc9\xcd\xc8\x19\x01\x20\x84\x66\x00\xf0\x0b\xe0\x19\xc1\xd1"
+"\xcd\x97\x19\xca\x4b\x06\x2e\xff\xcd\x58\x19\x34\x34\x2b\x7e\x32\x14\x2b\x2b\x7e\x32\x10\x05\x00\xf0\x1a\x0c\x2b\x41\xeb\xaf\x4f"
+"\x57\x5f\x32\x17\x2b\xe5\xc5\x7d\xcd\x0b\x2b\xde\x00\x3f\x30\x07\x32\x17\x2b\xf1\xf1\x37\xd2\xc1\xe1\x79\x3c\x3d\x1f\xfa\xec\x17"
+"\x17\xcb\x13\x62\x01\xf0\x29\x29\xcb\x10\x3a\x17\x2b\x17\x32\x17\x2b\x79\xb2\xb3\x20\xcf\xe5\x21\xe8\x2b\x35\xe1\x20\xc7\x1e\x0a"
+"\xc3\x56\x06\x78\xb7\xca\x7c\x19\x7d\x21\xe8\x2b\xae\x80\x47\x1f\xa8\x78\xf2\x7b\x19\xc6\x80\x77\xca\xe0\x18\xcd\x03\x1a\x77\x84"
+"\x0f\xc0\x19\x2f\xe1\xb7\xe1\xf2\xcf\x17\x18\xd1\xcd\xeb\x16\x02\xf0\x00\xc6\x02\x38\xc7\x47\xcd\x6f\x17\x21\xe8\x2b\x34\xc0\x18"
+"\xbc\x25\x02\xf2\x1e\xc8\x3a\xe7\x2b\xfe\x2f\x17\x9f\xc0\x3c\xc9\xcd\x97\x19\x06\x88\x11\x00\x00\x21\xe8\x2b\x4f\x70\x06\x00\x23"
+"\x36\x80\x17\xc3\xb9\x17\xcd\x97\x19\xf0\x21\xe7\x2b\x7e\xee\x80\x77\xc9\x9a\x08\x20\x2a\xe7\x9f\x08\xf0\x0b\xc9\x01\x49\x82\x11"
+"\xdb\x0f\x18\x03\xcd\xee\x19\xed\x53\xe5\x2b\xed\x43\xe7\x2b\x50\x59\xc9\x21\xe5\x2b\xf3\x05\x00\x4f\x09\xd0\xc9\x11\xe5\x2b\x06"
+"\x04\x1a\x77\x13\x23\x10\xfa\xc9\x43\x00\xf0\x35\x07\x37\x1f\x77\x3f\x1f\x23\x23\x77\x79\x07\x37\x1f\x4f\x1f\xae\xc9\x78\xb7\xca"
+"\x97\x19\x21\xa0\x19\xe5\xcd\x97\x19\x79\xc8\x21\xe7\x2b\xae\x79\xf8\xcd\x32\x1a\x1f\xa9\xc9\x23\x78\xbe\xc0\x2b\x79\xbe\xc0\x2b"
+"\x7a\xbe\xc0\x2b\x7b\x96\xc0\xe1\xe1\xc9\x47\x4f\x57\x5f\xb7\xc8\x25\x0f\xf0\x12\xcd\x03\x1a\xae\x67\xfc\x69\x1a\x3e\x98\x90\xcd"
+"\x2a\x18\x7c\x17\xdc\xfd\x17\x06\x00\xdc\x16\x18\xe1\xc9\x1b\x7a\xa3\x3c\xc0\x0b\xc9\x10\x02\xf0\x2f\xfe\x98\x3a\xe5\x2b\xd0\x7e"
+"\xcd\x45\x1a\x36\x98\x7b\xf5\x79\x17\xcd\xb9\x17\xf1\xc9\x21\x00\x00\x78\xb1\xc8\x3e\x10\x29\x38\x06\xeb\x29\xeb\x30\x04\x09\xda"
+"\x0b\x13\x3d\x20\xf1\xc9\xfe\x2d\xf5\x28\x05\xfe\x2b\x28\x01\x2b\xcd\xcf\x17\x47\x57\x5f\x2f\x7d\x08\xa0\x38\x3d\xfe\x2e\x28\x16"
+"\xfe\x45\x20\x15\xa0\x0a\x20\x4d\x11\xa5\x08\xf0\x24\x4b\x14\x20\x07\xaf\x93\x5f\x0c\x0c\x28\xde\xe5\x7b\x90\xf4\xed\x1a\xf2\xe4"
+"\x1a\xf5\xcd\xe7\x18\xf1\x3c\x20\xf2\xd1\xf1\xcc\xc0\x19\xeb\xc9\xc8\xf5\xcd\x82\x19\xf1\x3d\xc9\xd5\x57\x78\x89\x47\xc5\xe5\xd5"
+"\x0e\x00\xf0\x14\xd6\x30\xcd\x0b\x1b\xe1\xc1\xd1\x18\xa8\xcd\xc8\x19\xcd\xa9\x19\xc1\xd1\xc3\x6f\x17\x7b\x07\x07\x83\x07\x86\xd6"
+"\x30\x5f\x18\xa5\xe5\x21\x0d\x93\x14\xb0\xe1\xeb\xaf\x06\x98\xcd\xae\x19\x21\xc8\x14\x04\x11\x00\x17\x01\xf1\x1b\x36\x20\xf2\x42"
+"\x1b\x36\x2d\x23\x36\x30\xca\xef\x1b\xe5\xfc\xc0\x19\xaf\xf5\xcd\xf5\x1b\x01\x43\x91\x11\xf8\x4f\xcd\x18\x1a\xb7\xe2\x6e\x1b\xf1"
+"\xcd\xee\x1a\xf5\x18\xec\x86\x00\x00\x1d\x00\xf0\x22\xcd\x5e\x17\x3c\xcd\x45\x1a\xcd\xe0\x19\x01\x06\x03\xf1\x81\x3c\xfa\x89\x1b"
+"\xfe\x08\x30\x04\x3c\x47\x3e\x02\x3d\x3d\xe1\xf5\x11\x08\x1c\x05\x20\x06\x36\x2e\x23\x36\x30\x23\x05\x36\x2e\xcc\xf5\x19\xa5\x00"
+"\xf0\x49\xeb\x19\xe1\x06\x2f\x04\x7b\x96\x5f\x23\x7a\x9e\x57\x23\x79\x9e\x4f\x2b\x2b\x30\xf0\xcd\x0a\x18\x23\xcd\xe0\x19\xeb\xe1"
+"\x70\x23\xc1\x0d\x20\xd2\x05\x28\x0b\x2b\x7e\xfe\x30\x28\xfa\xfe\x2e\xc4\xf5\x19\xf1\x28\x1a\x36\x45\x23\x36\x2b\xf2\xe4\x1b\x36"
+"\x2d\x2f\x3c\x06\x2f\x04\xd6\x0a\x30\xfb\xc6\x3a\x23\x70\x23\x77\x23\x71\xe1\xc9\x01\x74\x94\x11\xf7\x23\xa4\x00\xf0\x05\xe1\xe2"
+"\x65\x1b\xe9\x00\x00\x00\x80\xa0\x86\x01\x10\x27\x00\xe8\x03\x00\x64\x00\x11\x18\xb0\x01\x00\x00\x21\xc0\x19\xe3\xe9\xcd\xc8\x19"
+"\xc4\x04\x12\xdd\x35\x03\xf0\x10\x78\xca\x6d\x1c\xf2\x38\x1c\xb7\xca\x4b\x06\xb7\xca\xd0\x17\xd5\xc5\x79\xf6\x7f\xcd\xeb\x19\xf2"
+"\x55\x1c\xd5\xc5\xcd\x70\x1a\xb1\x0a\xf0\x0e\x18\x1a\xe1\x7c\x1f\xe1\x22\xe7\x2b\xe1\x22\xe5\x2b\xdc\x1a\x1c\xcc\xc0\x19\xd5\xc5"
+"\xcd\x59\x18\xc1\xd1\xcd\x9a\x18\x86\x03\x80\x38\x81\x11\x3b\xaa\xcd\x9a\x18\x0a\x10\xf0\x00\x88\xd2\x76\x19\xcd\x70\x1a\xc6\x80"
+"\xc6\x02\xda\x76\x19\xf5\x14\x04\x60\x61\x17\xcd\x91\x18\xf1\x4a\x00\xf0\x21\x6c\x17\xcd\xc0\x19\x21\xad\x1c\xcd\xdd\x1c\x11\x00"
+"\x00\xc1\x4a\xc3\x9a\x18\x08\x40\x2e\x94\x74\x70\x4f\x2e\x77\x6e\x02\x88\x7a\xe6\xa0\x2a\x7c\x50\xaa\xaa\x7e\xff\xff\x7f\x7f\x00"
+"\x00\x80\x81\x82\x04\x71\xcd\xc8\x19\x11\x98\x18\xd5\x8a\x02\xf0\x07\x9a\x18\xe1\xcd\xc8\x19\x7e\x23\xcd\xdd\x19\x06\xf1\xc1\xd1"
+"\x3d\xc8\xd5\xc5\xf5\xe5\xcd\x16\x00\x00\xf5\x0c\xf0\x04\x6f\x17\xe1\x18\xe9\xcd\x97\x19\x21\x1b\x2b\xfa\x5d\x1d\x21\x3c\x2b\xcd"
+"\xdd\x0c\x00\xb0\xc8\x86\xe6\x07\x06\x00\x77\x23\x87\x87\x4f\xb5\x05\x00\xa8\x00\xf1\x01\x1a\x2b\x3c\xe6\x03\x06\x00\xfe\x01\x88"
+"\x32\x1a\x2b\x21\x60\x1d\x1b\x00\xf0\x30\x61\x17\xcd\xeb\x19\x7b\x59\xee\x4f\x4f\x36\x80\x2b\x46\x36\x80\x21\x19\x2b\x34\x7e\xd6"
+"\xab\x20\x04\x77\x0c\x15\x1c\xcd\xbc\x17\x21\x3c\x2b\xc3\xf7\x19\x77\x2b\x77\x2b\x77\x18\xd5\x68\xb1\x46\x68\x99\xe9\x92\x69\x10"
+"\xd1\x75\x68\x21\xba\x1d\xcd\x61\x17\x09\x01\x61\x49\x83\x11\xdb\x0f\xcd\x8f\x04\x10\xf5\x1a\x01\x01\x41\x01\x80\xcd\x6c\x17\x21"
+"\xbe\x1d\xcd\x66\xdc\x03\x60\x37\xf2\xa6\x1d\xcd\x5e\x0a\x00\x50\xb7\xf5\xf4\xc0\x19\x18\x00\xf0\x00\x61\x17\xf1\xd4\xc0\x19\x21"
+"\xc2\x1d\xc3\xce\x1c\xdb\x0f\x49\xf4\x00\xf0\x07\x7f\x05\xba\xd7\x1e\x86\x64\x26\x99\x87\x58\x34\x23\x87\xe0\x5d\xa5\x86\xda\x0f"
+"\x49\x83\xcc\x02\x30\x76\x1d\xc1\x02\x01\x00\x60\x06\xf0\x00\xcd\x70\x1d\xc3\xf3\x18\xcd\x97\x19\xfc\x1a\x1c\xfc\xc0\x19\x7c\x01"
+"\x40\x81\xda\x09\x1e\xd0\x12\x10\x59\x8d\x05\xf1\x1f\x66\x17\xe5\x21\x13\x1e\xcd\xce\x1c\x21\xba\x1d\xc9\x09\x4a\xd7\x3b\x78\x02"
+"\x6e\x84\x7b\xfe\xc1\x2f\x7c\x74\x31\x9a\x7d\x84\x3d\x5a\x7d\xc8\x7f\x91\x7e\xe4\xbb\x4c\x7e\x6c\xaa\xaa\x7f\x6a\x01\xf0\x04\x49"
+"\x1e\x28\x03\xcd\x6c\x0c\xe5\x21\x47\x1e\xe5\xeb\xe9\xe1\xc9\xfe\xae\xc0\x5f\x05\xf0\x20\xbd\x0b\xc8\x38\x0b\xfe\x94\x28\x16\xfe"
+"\x47\xd2\x48\x06\xd6\x07\xd6\x30\xda\x48\x06\xeb\x29\x29\x29\x29\xb5\x6f\xeb\x18\xe0\x7b\x87\x87\x87\x87\xf6\x0d\x57\x1e\xef\x18"
+"\xd4\xd5\xe5\x36\x00\x8e\x09\x40\x20\xf8\xe3\xe5\xbb\x09\x50\x09\x15\x2a\xc4\x2b\xab\x09\xf0\x0c\xaf\xed\x52\xd1\xe3\xed\x52\xe5"
+"\xcd\x28\x20\x4f\xcd\xe4\x20\x47\xe1\xcd\xe4\x20\x12\x13\x2b\x7d\xb4\x20\xf6\x0b\x00\xf0\x34\x5f\xcd\xe4\x20\x57\xaf\xed\x52\x38"
+"\x44\x2a\x56\x2b\x23\xcd\xe4\x20\x77\x23\x1b\x7b\xb2\x20\xf6\xd1\xe3\xc5\xcd\xf8\x1f\xe3\xed\x42\x20\x2d\xe1\xcd\x77\x20\xe3\x2b"
+"\xd5\xed\x5b\xc4\x2b\xed\xb8\xed\x53\xc4\x2b\xe1\x42\x4b\x03\xd1\x2b\x70\x2b\x71\x2b\x35\x03\x20\xfc\x0b\xd3\x08\x94\x20\xf0\xe1"
+"\xcd\xfd\x20\xc9\xd1\xe1\x86\x00\xaf\x18\x29\xcd\x87\x1f\xe5\xe2\x7b\x1e\xeb\x7c\x00\x04\x00\x5f\x00\xf0\x11\xe1\xed\x42\xe1\x28"
+"\xc7\xcd\x1d\x21\x21\x3f\x1f\xc3\x71\x06\x42\x41\x44\x00\xfe\xae\x28\xc6\xcd\xb0\x1f\xed\x5b\xd7\x2b\x1b\x1b\xbc\x0b\x50\x01\xd1"
+"\xff\xed\x52\xe0\x08\xe6\x28\x20\x6f\xcd\xe4\x20\x67\xe5\xed\x42\xe1\xd2\x3e\x06\xc6\x00\x60\xed\x53\xd7\x2b\x21\x12\x57\x04\x50"
+"\xc3\x8a\x07\x1e\x26\x42\x0b\x30\xac\x1f\xe1\x8d\x10\x20\x3e\x01\xb1\x14\x50\x06\x12\x32\xcc\x2b\x18\x0a\x32\xeb\x19\xeb\x4e\x0a"
+"\x00\x0f\x0c\xf1\x0b\xc9\x3e\xd4\x23\x01\x3e\xd3\xf5\x3a\x5d\x2b\xa7\x3e\x00\x32\x5d\x2b\x28\x04\xf1\xc6\x04\xf5\xcd\xbe\x0b\x5c"
+"\x12\xf0\x0a\xe5\xf5\xcd\x3f\x16\x21\xf7\x2b\x06\x0d\x2b\x36\x20\x10\xfb\xd5\x11\x82\x1f\x73\x23\x72\xd1\x23\xf1\x9b\x16\xf0\x11"
+"\x77\x23\xeb\x06\x00\x79\xfe\x09\x38\x04\x0d\x23\x18\xf7\xed\xb0\xc9\xe5\xaf\x47\x86\xcd\x03\x20\x20\xfa\xe1\xc9\x4f\x30\x01\x04"
+"\x88\x01\xf0\x0e\x79\xc9\xf5\x3a\x07\x2b\xcb\x4f\xcb\xcf\x32\x07\x2b\x3e\x13\x20\x02\xc6\x08\x32\x08\x2b\x21\xea\x2b\xf1\xc3\xd5"
+"\x20\x1a\x00\x30\x47\xcb\xc7\x1a\x00\x11\x12\x1a\x00\x10\x09\x1a\x00\x70\xc3\xe4\x20\xfe\xae\x28\x24\x53\x16\xf0\x2a\xb0\x1f\x2a"
+"\xd7\x2b\x11\xff\xd3\x19\x44\x4d\x11\x01\x2c\xcd\xb5\x20\xe1\xe5\x21\x07\x2b\xcb\x8e\x11\x43\x03\xcd\xf6\x22\xe1\xc9\xcd\x87\x1f"
+"\xe2\x89\x20\xcd\xf8\x1f\xeb\xed\x52\x18\xe0\xe5\x01\x00\x00\x7e\x23\x77\x34\x81\x23\x23\x86\x00\x60\xf4\xe1\xc9\xcd\x77\x20\x60"
+"\x01\x70\xeb\xed\x52\xcd\xb5\x20\xc1\xcf\x16\xf0\x13\x78\xeb\xcd\xd5\x20\x2b\x2b\x78\xb1\x28\xb4\x56\x2b\x5e\x2b\x35\x28\xf3\x1a"
+"\xcd\xd5\x20\x13\x0b\x18\xf5\x23\xe5\x79\xcd\x0d\x20\x78\xe1\x20\x00\xf0\x19\x7d\xb4\x1a\x13\x20\xf6\xc9\x3a\x08\x2b\xe6\x07\xd6"
+"\x01\xc9\xcd\x1d\x21\x3e\x0c\xf5\xd5\x57\x3a\x08\x2b\x5f\x7a\xcd\xf6\x22\x7b\xd1\x18\x3c\xd5\x3a\x09\x2b\x5f\x0c\x00\xf0\x0b\x32"
+"\x09\x2b\x7a\x18\x06\xd5\x1e\x80\xcd\xf6\x22\xcb\x7b\xd1\xc9\xf5\xe5\xd5\xc5\x11\x42\x03\x06\x06\x7a\xab\x00\xf0\x29\x3e\xdc\xf6"
+"\x22\x1c\x10\xf8\xc1\xd1\xe1\x3e\xf5\x3e\x00\x32\x09\x2b\x3e\xf5\x3e\x01\x32\x08\x2b\xf1\xc9\x7e\xfe\x23\x20\x31\xcd\xbd\x0b\x30"
+"\x38\x23\xe5\xe6\x03\x28\x12\x21\x07\x2b\x87\xfe\x04\x28\x12\x30\x16\xcb\x4e\xcb\xce\x0f\x01\xf0\x09\x3c\x32\x08\x2b\xe1\xc3\xbe"
+"\x0b\xcb\x5e\xcb\xde\x18\xee\xcb\x6e\xcb\xee\x18\xe8\xe5\xaf\x18\xe8\x3a\x00\x79\x30\xcd\xbd\x0b\xd2\x48\x06\x3b\x00\x70\x10\x38"
+"\x14\xcb\x66\xcb\xe6\x3b\x00\xf0\x0c\x32\x09\x2b\xe1\x18\xc4\xcb\x56\xcb\xd6\x18\xf0\xcb\x46\xcb\xc6\x18\xea\xe5\xaf\x18\xea\xc5"
+"\xcd\x2a\x1b\xe1\x2c\x0f\x91\x01\x61\x2b\xc5\x18\x03\xcd\xd7\x21\x6b\x17\xf0\x00\x16\xb7\x28\x1f\xf2\xa7\x21\xc5\xcd\x9a\x0a\xc1"
+"\xcd\xd7\x21\x12\x17\x44\xbb\x21\x18\xe4\x1f\x00\xf0\x19\xd8\xb7\x20\xf4\x3e\x20\x03\x18\x0c\x03\x02\xe5\x21\x56\xd4\x09\xe1\xd0"
+"\xe1\x3e\x2a\xcd\xd5\x20\xaf\x02\xe1\x77\x23\xe5\xcd\xf1\x08\xd1\x23\x36\x00\x2b\x36\x20\xed\x15\xf0\x01\x0a\x20\x05\xcd\x12\x22"
+"\x3c\xc9\xcd\x0f\x22\xc8\xcd\x27\x22\xd8\x1e\x19\x60\xe7\xfe\x0d\xc0\x3e\x09\x20\x19\x40\x7e\xb7\x20\xf6\x36\x1a\x70\x20\x02\x36"
+"\x00\xc3\x5e\x0e\x15\x16\xf1\x19\xa7\xc9\xcd\x12\x22\x37\xc9\xfe\x08\x28\x44\xfe\x09\x28\x2a\xfe\x1f\x28\x47\xfe\x19\xca\xc5\x22"
+"\xfe\x18\xca\xcf\x22\xfe\x02\xca\xdb\x22\xfe\x1a\x28\x48\xfe\x0b\x45\x16\xc2\x01\xc8\xfe\x20\x30\x05\x3f\xcd\xd5\x20\xc9\x77\x50"
+"\x00\x30\xc0\x11\xab\x77\x03\xf0\x1c\x28\x07\x36\x20\x23\x36\x00\x18\x03\xcd\xa2\x09\x2b\x7e\xb7\xc0\x3e\x09\x18\xdf\xe5\x23\xcd"
+"\xf1\x08\xcd\xa9\x09\xd1\xaf\x2b\x46\x77\xcd\xa2\x09\x78\x20\xf7\xc9\xcd\xa9\x09\xb1\x00\x02\x35\x00\x80\x20\x0c\xcd\xa2\x09\xcd"
+"\xa9\x09\x34\x00\x90\x36\x00\xd1\x44\x4d\x03\x7e\x02\x0b\x0d\x00\x60\x20\xf7\x23\x36\x20\xc9\x0a\x00\x66\x7e\xb7\x20\xf8\x18\xb2"
+"\xbd\x00\xb0\x18\x90\xcd\xc5\x22\xe5\x7e\xb7\x28\x05\x36\xee\x19\x10\xe1\x62\x00\x20\xc5\x22\xff\x00\xf0\x54\xc9\x1e\xff\xc3\x0e"
+"\x23\x20\x52\x45\x57\x49\x4e\x44\x21\x00\x00\xc3\x22\x28\xc3\x8a\x23\xc3\xdc\x23\x11\x23\xc3\x01\x28\xc9\x4e\x4b\x45\x59\x24\xca"
+"\x4f\x59\x53\x54\xd3\x54\x52\x49\x4e\x47\x24\xc9\x4e\x53\x54\x52\xd2\x45\x4e\x55\x4d\x42\x45\x52\xc4\x45\x4c\x45\x54\x45\xd0\x41"
+"\x55\x53\x45\xc2\x45\x45\x50\xd7\x49\x4e\x44\x4f\x57\xc2\x4f\x52\x44\x45\x52\xc9\x4e\x4b\xd0\x41\x50\x45\x52\xc1\x54\xc8\xad\x1e"
+"\x10\xc8\xb7\x1e\xf1\x0d\xd0\x53\x45\x54\xd0\x52\x45\x53\x80\x3f\x26\x79\x01\xc7\x26\x59\x26\xf4\x23\xdd\x27\x8b\x02\xd1\x02\xd8"
+"\x25\xd4\x02\x00\xf1\x15\x26\x27\x4e\x01\x44\x01\x48\x06\x48\x06\x7e\xfe\xdf\xd8\xfe\xe6\xd0\xfe\xe1\xca\x26\x27\x3a\xfd\x2b\xa7"
+"\x20\x38\x3c\x32\xfd\x2b\x7e\xfe\xdf\x28\x28\x14\x90\xd4\x25\x7e\xfe\x3b\x28\x27\x18\x22\xf2\x08\x02\x0d\x00\x92\x1a\xcd\xcc\x0b"
+"\x2c\xfe\xe0\x20\x0f\x13\x00\x00\x40\x04\xf0\x1c\xcd\x03\x0e\xc1\xc9\xc3\x48\x06\xcd\xbd\x0b\x18\xf3\x79\xd6\x3e\x38\xf3\xfe\x07"
+"\xd2\xd4\x23\xeb\x01\x68\x23\xe1\x6f\x09\x4e\x23\x66\x69\xe5\xeb\xc9\xe5\x21\x0a\x00\x22\x54\xac\x1a\x22\xf5\xe5\x3a\x0d\x62\x22"
+"\x4e\x2b\x22\x52\x2b\xc2\x04\x20\xe1\xe5\x10\x10\x00\x99\x0e\x33\x20\xf4\xd1\x1f\x00\xf0\x06\x50\x2b\x06\x04\xf1\x21\x4e\x2b\xe3"
+"\x28\x20\xcd\x86\x0c\xf5\x7a\xb3\xca\x67\x0c\xf1\xe3\x0c\xf0\x06\x23\x28\x0f\xf5\x05\x28\x07\xf1\xe3\xcd\xd6\x0b\x18\xe2\xf1\xc2"
+"\x48\x06\x2a\x50\x2b\xab\x1d\x00\xc5\x17\x20\x67\x0c\xdd\x16\xa0\xbe\x07\x38\x04\x28\xcf\x18\xf7\xe1\xc5\x61\x1b\xf4\x00\x21\x00"
+"\x00\x22\x50\x2b\x60\x69\x4e\x23\x46\x78\xb1\x28\xb8\xb9\x1c\xd0\x2a\x50\x2b\x23\x22\x50\x2b\x20\xe6\x23\x23\x29\x23\x88\x00\x30"
+"\x19\x38\xc0\x52\x11\x30\xd7\x2b\xaf\x44\x07\x20\x1b\x1b\x03\x1d\x20\x23\x3d\xcb\x04\x30\xeb\x2a\x52\xb1\x1a\x00\x4c\x10\xc0\x23"
+"\xc5\x01\x4e\x2b\x7e\x12\x0a\x77\x23\x13\x03\x07\x00\xf0\x03\x13\x2a\x4e\x2b\xed\x4b\x54\x2b\x09\x22\x4e\x2b\x2a\x50\x2b\x2b\x7c"
+"\xb5\x54\x00\x72\xd5\x12\xe1\x2a\x5f\x2b\xe5\x31\x00\x00\x56\x1d\xf0\x1d\x28\x26\x23\x7e\xb7\x28\xef\xfe\x88\x28\x2a\xfe\x8c\x28"
+"\x26\xfe\x8b\x28\x08\xfe\xd4\x28\x04\xfe\xa9\x20\xe7\xcd\x87\x0c\x7b\xb2\xc4\x3d\x25\xc4\x6f\x25\x18\xdb\x2b\x22\xd7\x2b\x7e\x00"
+"\x51\xe1\xe1\xc3\x8a\x07\x1a\x00\x31\x28\xc7\xcd\x1c\x00\xf0\x15\x7e\xfe\x2c\x20\xbc\x18\xec\xe5\xd5\x11\xff\xff\xcd\xbb\x07\xd1"
+"\x03\x03\x03\x03\x60\x69\xed\x4b\x52\x2b\x7e\x23\xe5\xb6\x28\x16\x7e\x2b\x6e\x67\x1a\x10\xf0\x03\x0a\x2a\x54\x2b\x09\x44\x4d\xe1"
+"\x23\x18\xe7\x3e\xff\xb7\xe1\xe1\xc9\xc5\x12\x13\xf2\x0c\xed\x52\xe5\xc1\x62\x6b\x1b\x1a\xfe\x2c\x28\x0b\xfe\x3a\x30\x07\xc5\xd5"
+"\xed\xb0\xd1\x18\xec\xeb\xd1\xe5\xc5\x65\x0a\xf0\x13\xcd\x34\x1b\xc1\xd1\x23\x13\x7e\xb7\x28\x0f\xc5\xe5\xeb\x09\x54\x5d\x2b\xed"
+"\xb8\xe1\xed\xa0\xc1\x18\xed\xd5\xed\x5b\x5f\x2b\xcd\x93\x07\xf6\x15\x20\x20\xfa\x15\x01\x20\x13\x13\x4e\x06\xc0\xe1\x54\x5d\x7e"
+"\xb7\x23\x20\xfb\xc1\xe3\xc5\xeb\xc0\x0e\x51\xc9\xe5\xcd\x60\x2a\x55\x16\x52\x55\xcd\x21\x17\xf5\xab\x0e\x0a\x07\x00\xf0\x25\x3c"
+"\x3c\x57\xfe\x22\x30\x2e\xf1\x5f\xfe\x22\x30\x28\xf1\x3c\x3c\x47\xfe\x22\x30\x20\xf1\x4f\xfe\x22\x30\x1a\x3c\xb8\x30\x16\x7b\x3c"
+"\xba\x30\x11\xed\x53\x74\x00\xed\x43\x72\x00\x51\x14\x1c\xe5\xcd\xc9\x2a\xe1\x5b\x02\x01\x5a\x00\xf1\x00\x01\x00\x21\x11\x00\x21"
+"\x18\xdf\xe5\xcd\xf3\x20\x20\x0e\xf5\xfb\x0f\xe2\xf1\x2a\xc2\x2b\x77\xc3\xa9\x14\xaf\xcd\x7b\x14\x18\xf7\x34\x15\x71\xe5\xcd\x30"
+"\x16\x28\x38\x47\x22\x10\x61\xe1\xd5\xc5\xcd\x3a\x10\x96\x0f\x30\xe5\xd5\xc5\x19\x00\x10\x1f\xcd\x14\xf0\x05\x66\x69\xc1\x4f\xd1"
+"\xe5\xc5\xd5\x1a\xbe\x28\x12\x23\x0d\x20\xf9\xaf\xe1\xe1\xe1\x56\x15\xf1\x1e\xc3\xc0\x13\xc3\x67\x0c\x23\xe5\x2b\x23\x0d\x28\x0f"
+"\x13\x05\x28\x12\x1a\xbe\x28\xf4\xe1\xd1\x79\xc1\x4f\x18\xd2\x13\x05\xe1\x20\xd7\x18\x01\xe1\xd1\xd1\xd1\xa7\xed\x52\x7d\x18\xcf"
+"\xf8\x12\x03\xe9\x00\x01\x64\x00\x61\xf1\xe5\xf5\xcd\x30\x16\x78\x00\xf3\x07\xc1\xc5\xf5\xd5\x4f\xaf\xb9\x28\x0c\xb8\x28\x09\x79"
+"\x05\x28\x05\x81\x38\x2b\x10\xfb\x47\x91\x10\xf0\x0b\xc1\xc5\xcd\x7e\x14\xe1\xe3\x7c\xe1\xe3\x6f\x24\x25\xe5\xc5\x28\x07\xcd\xf2"
+"\x15\xc1\xe1\x18\xf4\xc1\xe1\x4b\x11\xa2\xc3\xa9\x14\x1e\x1c\xc3\x56\x06\x3a\xfd\x18\x07\x40\xfd\x2b\x20\x28\x6d\x03\x00\x66\x13"
+"\x03\x6e\x00\x00\x07\x00\x01\x64\x13\x70\x3b\xf1\x4f\xf1\xe5\x47\x78\xf7\x04\xf9\x10\x79\xfe\x20\x38\x03\xc3\x48\x06\x2e\x00\x65"
+"\x55\x1e\x20\x04\x05\x28\x03\x19\x10\xfd\x59\x19\x11\x00\xec\x19\x54\x5d\xe1\xd5\x70\x19\x05\x5c\x19\x12\x0c\x32\x13\x02\x5c\x19"
+"\x00\x10\x09\xf0\x08\xee\x19\xe1\xdd\xe1\x1c\x1d\x28\x0e\x0a\xcd\xc0\x27\x30\x08\xdd\x77\x00\xdd\x23\x03\x18\xef\x1f\x18\xf1\x1f"
+"\x02\xc1\xc9\xcd\xd6\x0b\xdd\xe5\x18\xb4\xe5\xdd\xe5\xe1\xd5\x11\x00\xf0\xa7\xed\x52\xd1\xe1\xc9\x0d\x0a\x56\x45\x52\x49\x46\x59"
+"\x3f\x20\x20\x00\xc3\x48\x06\xc8\xcd\x86\x0c\xca\x42\x07\x2b\x1b\x50\x86\x0c\xe1\xc0\xeb\x05\x1c\xf0\x1a\xd2\x4d\x07\xd1\xf5\xc5"
+"\xcd\xbe\x07\x30\xf5\xc1\xc3\x50\x07\xcb\x6b\xc2\x38\x00\x22\x77\x00\xe5\x21\x20\x28\xe5\x7b\xe6\x07\xcb\x27\xc6\x3c\x6f\x3e\x00"
+"\xce\x28\x67\x07\x04\xc2\xe9\xe1\xc9\x78\xd6\x09\x38\xb3\xfe\x0d\x30\xaf\x7c\x1c\x22\x70\x23\x7c\x1c\xf0\x79\xc3\xbd\x0b\x00\x01"
+"\x4c\x28\x16\x29\x59\x28\x82\x1f\xd0\x29\x82\x1f\x82\x1f\xd5\xc5\x4a\xe5\xcd\xce\x29\xe1\xc1\xd1\xcb\xbb\xc9\xe5\xc5\xd5\xcb\x5b"
+"\x28\x2f\x2a\x77\x00\x01\x0b\x00\x23\x23\x3e\xd5\xbe\xd5\x11\xa0\x00\x20\x03\x11\x00\x04\xed\x53\x79\x00\x11\x80\x00\xed\xb0\xd1"
+"\x21\x7b\x00\x36\x00\x21\x7e\x00\x36\x0c\x21\x8b\x00\x72\xc3\x0d\x29\x21\x80\x00\x3a\x7e\x00\x4f\x06\x00\x09\x3c\x32\x7e\x00\x72"
+"\xcb\x73\x20\x04\xfe\x80\x20\x67\x21\x80\x00\x22\x2d\x00\xd5\x3a\x7b\x00\xb7\x01\x70\x17\x28\x04\xed\x4b\x79\x00\x3c\x32\x7b\x00"
+"\xcd\x9f\x01\x3e\x00\xf2\x0b\x00\xcd\xcc\x29\xd1\xcb\x73\xca\x53\x29\x21\xce\x27\xcd\xd2\x2a\xcd\x24\x01\xfe\x59\x20\x31\x21\xf9"
+"\x22\x0d\x00\xf0\x00\x16\x2a\xcd\x4c\x28\x3a\x7b\x00\x47\xc5\xcd\xfc\x01\x30\x0b\x1f\x00\x70\x0d\x28\xf4\xfe\x03\x28\x5c\x3f\x26"
+"\xf1\x03\x03\x28\x55\xcd\xcc\x29\xc1\x10\xe2\xf1\xd1\xc1\xe1\xcb\xbb\xcb\x9b\x57\xbd\x00\x72\x73\x20\xf0\xcb\x5b\x28\x3c\x7b\x00"
+"\xe0\xaf\x32\x7e\x00\x21\x7c\x00\x36\x01\xcd\x66\x02\x30\x09\x41\x00\xf0\x02\x03\x20\xf4\x18\x1d\x3a\x7b\x00\x3d\x20\xf1\xcd\xcc"
+"\x29\xcd\x9c\x29\x89\x00\x00\xc7\x00\x21\x7e\xf5\x55\x00\x46\x20\xb1\x18\x6c\xce\x00\x30\x7e\xf5\x79\xd1\x00\xb9\xfe\x80\x20\x9a"
+"\x3a\x7c\x00\x3c\x32\x7c\x00\x49\x00\x13\x42\x1a\x27\x61\x38\xe9\x20\xec\xcd\xcc\x4b\x00\xf0\x00\x00\x18\xb8\x21\x80\x00\x06\x0b"
+"\x56\xcd\x4c\x28\x23\x10\xf9\x48\x01\xf0\x1e\x0c\x00\x09\x06\x0b\x11\x8a\x00\x1a\xbe\x1b\x20\x04\x2b\x10\xf8\xc9\xd6\x04\xbe\x20"
+"\x07\x3e\xff\x32\x5e\x2b\x18\xf0\xc3\x82\x1f\x0e\x20\x18\x06\x79\xcd\xe8\xff\xc9\x00\x21\x45\x2a\xa7\x03\xf0\x3e\x79\xd6\x08\xd8"
+"\x28\x47\x3d\x28\x29\x3d\x28\x34\x3d\x28\x4c\x3d\x28\x06\x3d\x28\x17\x71\x18\x1a\x3a\x72\x00\x3c\x32\x71\x00\x47\x3a\x73\x00\x90"
+"\x47\xc5\xcd\x68\x2a\xc1\x10\xf9\x3a\x74\x00\x32\x70\x00\x21\x70\x00\x11\x75\x00\x34\x1a\xbe\xc0\x1b\x1a\x3c\x77\x21\x71\x00\x34"
+"\x3a\x73\x00\x3d\xbe\xd0\x77\x18\x3e\x1b\x00\x90\x74\x00\x35\x1a\xbe\xc0\x13\x1a\x3d\x1b\x00\xf2\x21\x35\x3a\x72\x00\xbe\xd8\x3c"
+"\x77\x18\x24\x21\x70\x00\x4e\x23\x46\x21\xe0\xeb\x11\x20\x00\x19\x10\xfd\x0b\x09\x22\x2b\x00\x7e\x32\x1f\x00\x36\xff\xc9\x2a\x2b"
+"\x00\x3a\x1f\x00\x77\xc9\x3e\xaf\xf5\x20\x00\x00\x7c\x00\x10\x4f\x55\x00\xf0\x4d\x47\xf1\xc5\xb7\x28\x01\x41\x19\x10\xfd\xc1\xf5"
+"\x78\x91\x28\x28\x47\xf1\xe5\xb7\x28\x03\x19\x18\x02\xed\x52\xd1\xf5\xe5\xc5\x3a\x74\x00\x06\x00\x4f\x09\xeb\x09\xeb\x0c\x3a\x75"
+"\x00\x91\x4f\xed\xb0\xc1\xe1\x11\x20\x00\x10\xd9\xf1\xeb\x2a\x74\x00\x7c\x2c\x26\x00\x44\x95\x4f\x19\x54\x5d\x2b\x0d\xc8\x36\x20"
+"\xed\xb0\xc9\x21\x70\x00\x73\x23\x72\xc3\x45\x2a\x7e\xb7\xc8\x57\x34\x01\xf0\x00\x18\xf6\x0d\x0a\x62\x61\x64\x20\x72\x65\x63\x2e"
+"\x00\x0d\x0a\x07\x00\xf0\x03\x6e\x6f\x74\x20\x66\x2e\x00\x00\xd9\xfd\x26\x42\x21\xc0\x2b\x22\x1b\x00"
+;
+unsigned char dump_kc_basic[10783];
+#include <string.h>
+static void _z1013_dump_init_lz4(const unsigned char* src, int src_size, unsigned char* dst) {
+    const unsigned char* end = src + src_size;
+    while (src < end) {
+        const unsigned char token = *src++;
+        int len = token >> 4;
+        if (len == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }
+        memcpy(dst, src, len); dst += len; src += len;
+        if (src >= end) { break; }
+        const unsigned char* m = dst - (src[0] | (src[1]<<8)); src += 2;
+        len = (token & 15) + 4;
+        if ((token & 15) == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }
+        while (len-- > 0) { *dst++ = *m++; }
+    }
+}
+static void z1013_dump_init(void) {
+    _z1013_dump_init_lz4(dump_z1013_font_lz4, sizeof(dump_z1013_font_lz4) - 1, dump_z1013_font);
+    _z1013_dump_init_lz4(dump_z1013_mon_a2_lz4, sizeof(dump_z1013_mon_a2_lz4) - 1, dump_z1013_mon_a2);
+    _z1013_dump_init_lz4(dump_kc_basic_lz4, sizeof(dump_kc_basic_lz4) - 1, dump_kc_basic);
+}
+#if defined(_MSC_VER)
+#pragma section(".CRT$XCU", read)
+__declspec(allocate(".CRT$XCU")) void (*_z1013_dump_init_ctor)(void) = z1013_dump_init;
+#else
+__attribute__((constructor)) static void _z1013_dump_init_ctor(void) { z1013_dump_init(); }
+#endif
+dump_item z1013_dump_items[Z1013_DUMP_NUM_ITEMS] = {
 { "z1013_font", dump_z1013_font, 2048 },
 { "z1013_mon_a2", dump_z1013_mon_a2, 2048 },
 { "kc_basic", dump_kc_basic, 10783 },
@@ -1,10 +1,13 @@
 #pragma once
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include <stdint.h>
 extern unsigned char dump_z1013_font[2048];
 extern unsigned char dump_z1013_mon_a2[2048];
 extern unsigned char dump_kc_basic[10783];
+#ifndef DUMP_ITEM_DEFINED
+#define DUMP_ITEM_DEFINED
 typedef struct { const char* name; const uint8_t* ptr; int size; } dump_item;
-#define DUMP_NUM_ITEMS (3)
-extern dump_item dump_items[DUMP_NUM_ITEMS];
+#endif
+#define Z1013_DUMP_NUM_ITEMS (3)
+extern dump_item z1013_dump_items[Z1013_DUMP_NUM_ITEMS];
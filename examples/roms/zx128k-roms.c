@@ -1,2061 +1,971 @@
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include "zx128k-roms.h"
-unsigned char dump_amstrad_zx128k_0[16384] = {
-0xf3, 0x1, 0x2b, 0x69, 0xb, 0x78, 0xb1, 0x20, 0xfb, 0xc3, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xef, 0x10, 0x0, 0xc9, 0x0, 0x0, 0x0, 0x0, 0xef, 0x18, 0x0, 0xc9, 0x0, 0x0, 0x0, 0x0, 
-0xef, 0x20, 0x0, 0xc9, 0x0, 0x0, 0x0, 0x0, 0xe3, 0xf5, 0x7e, 0x23, 0x23, 0x22, 0x5a, 0x5b, 
-0x2b, 0x66, 0x6f, 0xf1, 0xc3, 0x5c, 0x0, 0x0, 0xe5, 0x21, 0x48, 0x0, 0xe5, 0x21, 0x0, 0x5b, 
-0xe5, 0x21, 0x38, 0x0, 0xe5, 0xc3, 0x0, 0x5b, 0xe1, 0xc9, 0x1, 0xfd, 0x7f, 0xaf, 0xf3, 0xed, 
-0x79, 0x32, 0x5c, 0x5b, 0xfb, 0x3d, 0xfd, 0x77, 0x0, 0xc3, 0x21, 0x3, 0x22, 0x58, 0x5b, 0x21, 
-0x14, 0x5b, 0xe3, 0xe5, 0x2a, 0x58, 0x5b, 0xe3, 0xc3, 0x0, 0x5b, 0xf5, 0xc5, 0x1, 0xfd, 0x7f, 
-0x3a, 0x5c, 0x5b, 0xee, 0x10, 0xf3, 0x32, 0x5c, 0x5b, 0xed, 0x79, 0xfb, 0xc1, 0xf1, 0xc9, 0xcd, 
-0x0, 0x5b, 0xe5, 0x2a, 0x5a, 0x5b, 0xe3, 0xc9, 0xf3, 0x3a, 0x5c, 0x5b, 0xe6, 0xef, 0x32, 0x5c, 
-0x5b, 0x1, 0xfd, 0x7f, 0xed, 0x79, 0xfb, 0xc3, 0xc3, 0x0, 0x21, 0xd8, 0x6, 0x18, 0x3, 0x21, 
-0xca, 0x7, 0x8, 0x1, 0xfd, 0x7f, 0x3a, 0x5c, 0x5b, 0xf5, 0xe6, 0xef, 0xf3, 0x32, 0x5c, 0x5b, 
-0xed, 0x79, 0xc3, 0xe6, 0x5, 0x8, 0xf1, 0x1, 0xfd, 0x7f, 0xf3, 0x32, 0x5c, 0x5b, 0xed, 0x79, 
-0xfb, 0x8, 0xc9, 0x2a, 0x8b, 0x5b, 0xe9, 0x6, 0x8, 0x78, 0xd9, 0x3d, 0x1, 0xfd, 0x7f, 0xed, 
-0x79, 0x21, 0x0, 0xc0, 0x11, 0x1, 0xc0, 0x1, 0xff, 0x3f, 0x3e, 0xff, 0x77, 0xbe, 0x20, 0x51, 
-0xaf, 0x77, 0xbe, 0x20, 0x4c, 0xed, 0xb0, 0xd9, 0x10, 0xdf, 0x32, 0x88, 0x5b, 0xe, 0xfd, 0x16, 
-0xff, 0x1e, 0xbf, 0x42, 0x3e, 0xe, 0xed, 0x79, 0x43, 0x3e, 0xff, 0xed, 0x79, 0x18, 0x38, 0x0, 
-0xc3, 0xaf, 0x17, 0xc3, 0x38, 0x18, 0xc3, 0xcf, 0x1e, 0xc3, 0x4, 0x1f, 0xc3, 0x4a, 0x0, 0xc3, 
-0xa2, 0x3, 0xc3, 0x2a, 0x18, 0xc3, 0xa8, 0x18, 0xc3, 0x2d, 0x1, 0xc3, 0x5, 0xa, 0xc3, 0xa3, 
-0x11, 0xc3, 0xd8, 0x6, 0xc3, 0xca, 0x7, 0xc3, 0xa3, 0x8, 0xc3, 0xf0, 0x8, 0xef, 0x1, 0x3b, 
-0xc9, 0xd9, 0x78, 0xd3, 0xfe, 0x18, 0xfe, 0x42, 0x3e, 0x7, 0xed, 0x79, 0x43, 0x3e, 0xff, 0xed, 
-0x79, 0x11, 0x0, 0x5b, 0x21, 0x6b, 0x0, 0x1, 0x58, 0x0, 0xed, 0xb0, 0x3e, 0xcf, 0x32, 0x5d, 
-0x5b, 0x31, 0xff, 0x5b, 0x3e, 0x4, 0xcd, 0x64, 0x1c, 0xdd, 0x21, 0xec, 0xeb, 0xdd, 0x22, 0x83, 
-0x5b, 0xdd, 0x36, 0xa, 0x0, 0xdd, 0x36, 0xb, 0xc0, 0xdd, 0x36, 0xc, 0x0, 0x21, 0xec, 0x2b, 
-0x3e, 0x1, 0x22, 0x85, 0x5b, 0x32, 0x87, 0x5b, 0x3e, 0x5, 0xcd, 0x64, 0x1c, 0x21, 0xff, 0xff, 
-0x22, 0xb4, 0x5c, 0x11, 0xaf, 0x3e, 0x1, 0xa8, 0x0, 0xeb, 0xef, 0x61, 0x16, 0xeb, 0x23, 0x22, 
-0x7b, 0x5c, 0x2b, 0x1, 0x40, 0x0, 0xed, 0x43, 0x38, 0x5c, 0x22, 0xb2, 0x5c, 0x21, 0x0, 0x3c, 
-0x22, 0x36, 0x5c, 0x2a, 0xb2, 0x5c, 0x23, 0xf9, 0xed, 0x56, 0xfd, 0x21, 0x3a, 0x5c, 0xfd, 0xcb, 
-0x1, 0xe6, 0xfb, 0x21, 0xb, 0x0, 0x22, 0x5f, 0x5b, 0xaf, 0x32, 0x61, 0x5b, 0x32, 0x63, 0x5b, 
-0x32, 0x65, 0x5b, 0x21, 0x0, 0xec, 0x22, 0x24, 0xff, 0x3e, 0x50, 0x32, 0x64, 0x5b, 0x21, 0xa, 
-0x0, 0x22, 0x94, 0x5b, 0x22, 0x96, 0x5b, 0x21, 0xb6, 0x5c, 0x22, 0x4f, 0x5c, 0x11, 0x89, 0x5, 
-0x1, 0x15, 0x0, 0xeb, 0xed, 0xb0, 0xeb, 0x2b, 0x22, 0x57, 0x5c, 0x23, 0x22, 0x53, 0x5c, 0x22, 
-0x4b, 0x5c, 0x36, 0x80, 0x23, 0x22, 0x59, 0x5c, 0x36, 0xd, 0x23, 0x36, 0x80, 0x23, 0x22, 0x61, 
-0x5c, 0x22, 0x63, 0x5c, 0x22, 0x65, 0x5c, 0x3e, 0x38, 0x32, 0x8d, 0x5c, 0x32, 0x8f, 0x5c, 0x32, 
-0x48, 0x5c, 0xaf, 0x32, 0x13, 0xec, 0x3e, 0x7, 0xd3, 0xfe, 0x21, 0x23, 0x5, 0x22, 0x9, 0x5c, 
-0xfd, 0x35, 0xc6, 0xfd, 0x35, 0xca, 0x21, 0x9e, 0x5, 0x11, 0x10, 0x5c, 0x1, 0xe, 0x0, 0xed, 
-0xb0, 0xfd, 0xcb, 0x1, 0x8e, 0xfd, 0x36, 0x0, 0xff, 0xfd, 0x36, 0x31, 0x2, 0xef, 0x6b, 0xd, 
-0xef, 0x4, 0x3c, 0x11, 0x61, 0x5, 0xcd, 0x7d, 0x5, 0xfd, 0x36, 0x31, 0x2, 0xfd, 0xcb, 0x2, 
-0xee, 0x21, 0xff, 0x5b, 0x22, 0x81, 0x5b, 0xcd, 0x45, 0x1f, 0x3e, 0x38, 0x32, 0x11, 0xec, 0x32, 
-0xf, 0xec, 0xcd, 0x84, 0x25, 0xcd, 0x20, 0x1f, 0xc3, 0x9f, 0x25, 0x21, 0x66, 0x5b, 0xcb, 0xc6, 
-0xfd, 0x36, 0x0, 0xff, 0xfd, 0x36, 0x31, 0x2, 0x21, 0x1d, 0x5b, 0xe5, 0xed, 0x73, 0x3d, 0x5c, 
-0x21, 0xba, 0x2, 0x22, 0x8b, 0x5b, 0xcd, 0x8e, 0x22, 0xcd, 0xcb, 0x22, 0xca, 0xf8, 0x21, 0xfe, 
-0x28, 0xca, 0xf8, 0x21, 0xfe, 0x2d, 0xca, 0xf8, 0x21, 0xfe, 0x2b, 0xca, 0xf8, 0x21, 0xcd, 0xe0, 
-0x22, 0xca, 0xf8, 0x21, 0xcd, 0x45, 0x1f, 0x3a, 0xe, 0xec, 0xcd, 0x20, 0x1f, 0xfe, 0x4, 0xc2, 
-0xaf, 0x17, 0xcd, 0x97, 0x22, 0xca, 0xaf, 0x17, 0xe1, 0xc9, 0xfd, 0xcb, 0x0, 0x7e, 0x20, 0x1, 
-0xc9, 0x2a, 0x59, 0x5c, 0x22, 0x5d, 0x5c, 0xef, 0xfb, 0x19, 0x78, 0xb1, 0xc2, 0xf7, 0x3, 0xdf, 
-0xfe, 0xd, 0xc8, 0xcd, 0xef, 0x21, 0xfd, 0xcb, 0x2, 0x76, 0x20, 0x3, 0xef, 0x6e, 0xd, 0xfd, 
-0xcb, 0x2, 0xb6, 0xcd, 0x45, 0x1f, 0x21, 0xd, 0xec, 0xcb, 0x76, 0x20, 0x7, 0x23, 0x7e, 0xfe, 
-0x0, 0xcc, 0x81, 0x38, 0xcd, 0x20, 0x1f, 0x21, 0x3c, 0x5c, 0xcb, 0x9e, 0x3e, 0x19, 0xfd, 0x96, 
-0x4f, 0x32, 0x8c, 0x5c, 0xfd, 0xcb, 0x1, 0xfe, 0xfd, 0x36, 0xa, 0x1, 0x21, 0x0, 0x3e, 0xe5, 
-0x21, 0x1d, 0x5b, 0xe5, 0xed, 0x73, 0x3d, 0x5c, 0x21, 0x21, 0x3, 0x22, 0x8b, 0x5b, 0xc3, 0x38, 
-0x18, 0xed, 0x7b, 0xb2, 0x5c, 0x33, 0x21, 0xff, 0x5b, 0x22, 0x81, 0x5b, 0x76, 0xfd, 0xcb, 0x1, 
-0xae, 0x21, 0x66, 0x5b, 0xcb, 0x56, 0x28, 0x12, 0xcd, 0x45, 0x1f, 0xdd, 0x2a, 0x83, 0x5b, 0x1, 
-0x14, 0x0, 0xdd, 0x9, 0xcd, 0x56, 0x1d, 0xcd, 0x20, 0x1f, 0x3a, 0x3a, 0x5c, 0x3c, 0xf5, 0x21, 
-0x0, 0x0, 0xfd, 0x74, 0x37, 0xfd, 0x74, 0x26, 0x22, 0xb, 0x5c, 0x21, 0x1, 0x0, 0x22, 0x16, 
-0x5c, 0xef, 0xb0, 0x16, 0xfd, 0xcb, 0x37, 0xae, 0xef, 0x6e, 0xd, 0xfd, 0xcb, 0x2, 0xee, 0xf1, 
-0x47, 0xfe, 0xa, 0x38, 0xa, 0xfe, 0x1d, 0x38, 0x4, 0xc6, 0x14, 0x18, 0x2, 0xc6, 0x7, 0xef, 
-0xef, 0x15, 0x3e, 0x20, 0xd7, 0x78, 0xfe, 0x1d, 0x38, 0x12, 0xd6, 0x1d, 0x6, 0x0, 0x4f, 0x21, 
-0x6c, 0x4, 0x9, 0x9, 0x5e, 0x23, 0x56, 0xcd, 0x7d, 0x5, 0x18, 0x6, 0x11, 0x91, 0x13, 0xef, 
-0xa, 0xc, 0xaf, 0x11, 0x36, 0x15, 0xef, 0xa, 0xc, 0xed, 0x4b, 0x45, 0x5c, 0xef, 0x1b, 0x1a, 
-0x3e, 0x3a, 0xd7, 0xfd, 0x4e, 0xd, 0x6, 0x0, 0xef, 0x1b, 0x1a, 0xef, 0x97, 0x10, 0x3a, 0x3a, 
-0x5c, 0x3c, 0x28, 0x1b, 0xfe, 0x9, 0x28, 0x4, 0xfe, 0x15, 0x20, 0x3, 0xfd, 0x34, 0xd, 0x1, 
-0x3, 0x0, 0x11, 0x70, 0x5c, 0x21, 0x44, 0x5c, 0xcb, 0x7e, 0x28, 0x1, 0x9, 0xed, 0xb8, 0xfd, 
-0x36, 0xa, 0xff, 0xfd, 0xcb, 0x1, 0x9e, 0x21, 0x66, 0x5b, 0xcb, 0x86, 0xc3, 0xcb, 0x25, 0x3e, 
-0x10, 0x1, 0x0, 0x0, 0xc3, 0x4e, 0x3, 0xed, 0x43, 0x49, 0x5c, 0xcd, 0x45, 0x1f, 0x78, 0xb1, 
-0x28, 0x8, 0xed, 0x43, 0x49, 0x5c, 0xed, 0x43, 0x8, 0xec, 0xcd, 0x20, 0x1f, 0x2a, 0x5d, 0x5c, 
-0xeb, 0x21, 0xef, 0x3, 0xe5, 0x2a, 0x61, 0x5c, 0x37, 0xed, 0x52, 0xe5, 0x60, 0x69, 0xef, 0x6e, 
-0x19, 0x20, 0x6, 0xef, 0xb8, 0x19, 0xef, 0xe8, 0x19, 0xc1, 0x79, 0x3d, 0xb0, 0x20, 0x13, 0xcd, 
-0x45, 0x1f, 0xe5, 0x2a, 0x49, 0x5c, 0xcd, 0x4a, 0x33, 0x22, 0x49, 0x5c, 0xe1, 0xcd, 0x20, 0x1f, 
-0x18, 0x28, 0xc5, 0x3, 0x3, 0x3, 0x3, 0x2b, 0xed, 0x5b, 0x53, 0x5c, 0xd5, 0xef, 0x55, 0x16, 
-0xe1, 0x22, 0x53, 0x5c, 0xc1, 0xc5, 0x13, 0x2a, 0x61, 0x5c, 0x2b, 0x2b, 0xed, 0xb8, 0x2a, 0x49, 
-0x5c, 0xeb, 0xc1, 0x70, 0x2b, 0x71, 0x2b, 0x73, 0x2b, 0x72, 0xf1, 0xc9, 0x8c, 0x4, 0x97, 0x4, 
-0xa6, 0x4, 0xb0, 0x4, 0xc1, 0x4, 0xd4, 0x4, 0xe0, 0x4, 0xe0, 0x4, 0xf3, 0x4, 0x1, 0x5, 
-0x12, 0x5, 0x23, 0x5, 0x31, 0x5, 0x42, 0x5, 0x4e, 0x5, 0x61, 0x5, 0x4d, 0x45, 0x52, 0x47, 
-0x45, 0x20, 0x65, 0x72, 0x72, 0x6f, 0xf2, 0x57, 0x72, 0x6f, 0x6e, 0x67, 0x20, 0x66, 0x69, 0x6c, 
-0x65, 0x20, 0x74, 0x79, 0x70, 0xe5, 0x43, 0x4f, 0x44, 0x45, 0x20, 0x65, 0x72, 0x72, 0x6f, 0xf2, 
-0x54, 0x6f, 0x6f, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x62, 0x72, 0x61, 0x63, 0x6b, 0x65, 0x74, 
-0xf3, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x65, 0x78, 
-0x69, 0x73, 0x74, 0xf3, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x6e, 0x61, 0x6d, 0xe5, 
-0x46, 0x69, 0x6c, 0x65, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x65, 0x78, 
-0x69, 0x73, 0xf4, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 
-0xe5, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x62, 0x61, 0x75, 0x64, 0x20, 0x72, 0x61, 
-0x74, 0xe5, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x65, 0x20, 0x6e, 
-0x61, 0x6d, 0xe5, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x6f, 0x20, 0x62, 0x69, 
-0xe7, 0x4e, 0x6f, 0x74, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x61, 0x6e, 
-0x67, 0xe5, 0x4f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x61, 0x6e, 0x67, 0xe5, 0x54, 0x6f, 
-0x6f, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x74, 0x69, 0x65, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x65, 
-0xf3, 0x7f, 0x20, 0x31, 0x39, 0x38, 0x36, 0x20, 0x53, 0x69, 0x6e, 0x63, 0x6c, 0x61, 0x69, 0x72, 
-0x20, 0x52, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x4c, 0x74, 0xe4, 0x1a, 0xe6, 0x7f, 
-0xd5, 0xd7, 0xd1, 0x1a, 0x13, 0x87, 0x30, 0xf5, 0xc9, 0xf4, 0x9, 0xa8, 0x10, 0x4b, 0xf4, 0x9, 
-0xc4, 0x15, 0x53, 0x81, 0xf, 0xc4, 0x15, 0x52, 0x34, 0x5b, 0x2f, 0x5b, 0x50, 0x80, 0x1, 0x0, 
-0x6, 0x0, 0xb, 0x0, 0x1, 0x0, 0x1, 0x0, 0x6, 0x0, 0x10, 0x0, 0xe1, 0x1, 0xfd, 0x7f, 
-0xaf, 0xf3, 0x32, 0x5c, 0x5b, 0xed, 0x79, 0xfb, 0xed, 0x7b, 0x3d, 0x5c, 0x7e, 0x32, 0x5e, 0x5b, 
-0x3c, 0xfe, 0x1e, 0x30, 0x3, 0xef, 0x5d, 0x5b, 0x3d, 0xfd, 0x77, 0x0, 0x2a, 0x5d, 0x5c, 0x22, 
-0x5f, 0x5c, 0xef, 0xc5, 0x16, 0xc9, 0x3e, 0x7f, 0xdb, 0xfe, 0x1f, 0xd8, 0x3e, 0xfe, 0xdb, 0xfe, 
-0x1f, 0xd8, 0xcd, 0xac, 0x5, 0x14, 0xfb, 0x8, 0x11, 0x4a, 0x5b, 0xd5, 0xfd, 0xcb, 0x2, 0x9e, 
-0xe5, 0x2a, 0x3d, 0x5c, 0x5e, 0x23, 0x56, 0xa7, 0x21, 0x7f, 0x10, 0xed, 0x52, 0x20, 0x38, 0xe1, 
-0xed, 0x7b, 0x3d, 0x5c, 0xd1, 0xd1, 0xed, 0x53, 0x3d, 0x5c, 0xe5, 0x11, 0x10, 0x6, 0xd5, 0xe9, 
-0x38, 0x9, 0x28, 0x4, 0xcd, 0xac, 0x5, 0x7, 0xe1, 0x18, 0xef, 0xfe, 0xd, 0x28, 0xe, 0x2a, 
-0x5a, 0x5b, 0xe5, 0xef, 0x85, 0xf, 0xe1, 0x22, 0x5a, 0x5b, 0xe1, 0x18, 0xdd, 0xe1, 0x3a, 0x5c, 
-0x5b, 0xf6, 0x10, 0xf5, 0xc3, 0x4a, 0x5b, 0xe1, 0x11, 0x3d, 0x6, 0xd5, 0xe9, 0xd8, 0xc8, 0x18, 
-0xd3, 0xef, 0x18, 0x0, 0xef, 0x8c, 0x1c, 0xfd, 0xcb, 0x1, 0x7e, 0x28, 0x14, 0xef, 0xf1, 0x2b, 
-0x79, 0x3d, 0xb0, 0x28, 0x4, 0xcd, 0xac, 0x5, 0x24, 0x1a, 0xe6, 0xdf, 0xfe, 0x50, 0xc2, 0x12, 
-0x19, 0x2a, 0x5d, 0x5c, 0x7e, 0xfe, 0x3b, 0xc2, 0x12, 0x19, 0xef, 0x20, 0x0, 0xef, 0x82, 0x1c, 
-0xfd, 0xcb, 0x1, 0x7e, 0x28, 0x7, 0xef, 0x99, 0x1e, 0xed, 0x43, 0x71, 0x5b, 0xef, 0x18, 0x0, 
-0xfe, 0xd, 0x28, 0x5, 0xfe, 0x3a, 0xc2, 0x12, 0x19, 0xcd, 0xa1, 0x18, 0xed, 0x4b, 0x71, 0x5b, 
-0x78, 0xb1, 0x20, 0x4, 0xcd, 0xac, 0x5, 0x25, 0x21, 0xb8, 0x6, 0x5e, 0x23, 0x56, 0x23, 0xeb, 
-0x7c, 0xfe, 0x25, 0x30, 0xa, 0xa7, 0xed, 0x42, 0x30, 0x5, 0xeb, 0x23, 0x23, 0x18, 0xec, 0xeb, 
-0x5e, 0x23, 0x56, 0xed, 0x53, 0x5f, 0x5b, 0xc9, 0x32, 0x0, 0xa5, 0xa, 0x6e, 0x0, 0xd4, 0x4, 
-0x2c, 0x1, 0xc3, 0x1, 0x58, 0x2, 0xe0, 0x0, 0xb0, 0x4, 0x6e, 0x0, 0x60, 0x9, 0x36, 0x0, 
-0xc0, 0x12, 0x19, 0x0, 0x80, 0x25, 0xb, 0x0, 0x21, 0x61, 0x5b, 0x7e, 0xa7, 0x28, 0x6, 0x36, 
-0x0, 0x23, 0x7e, 0x37, 0xc9, 0xcd, 0xd6, 0x5, 0xf3, 0xd9, 0xed, 0x5b, 0x5f, 0x5b, 0x2a, 0x5f, 
-0x5b, 0xcb, 0x3c, 0xcb, 0x1d, 0xb7, 0x6, 0xfa, 0xd9, 0xe, 0xfd, 0x16, 0xff, 0x1e, 0xbf, 0x42, 
-0x3e, 0xe, 0xed, 0x79, 0xed, 0x78, 0xf6, 0xf0, 0xe6, 0xfb, 0x43, 0xed, 0x79, 0x67, 0x42, 0xed, 
-0x78, 0xe6, 0x80, 0x28, 0x9, 0xd9, 0x5, 0xd9, 0x20, 0xf4, 0xaf, 0xf5, 0x18, 0x39, 0xed, 0x78, 
-0xe6, 0x80, 0x20, 0xf1, 0xed, 0x78, 0xe6, 0x80, 0x20, 0xeb, 0xd9, 0x1, 0xfd, 0xff, 0x3e, 0x80, 
-0x8, 0x19, 0x0, 0x0, 0x0, 0x0, 0x2b, 0x7c, 0xb5, 0x20, 0xfb, 0xed, 0x78, 0xe6, 0x80, 0xca, 
-0x4b, 0x7, 0x8, 0x37, 0x1f, 0x38, 0xd, 0x8, 0xc3, 0x31, 0x7, 0x8, 0xb7, 0x1f, 0x38, 0x4, 
-0x8, 0xc3, 0x31, 0x7, 0x37, 0xf5, 0xd9, 0x7c, 0xf6, 0x4, 0x43, 0xed, 0x79, 0xd9, 0x62, 0x6b, 
-0x1, 0x7, 0x0, 0xb7, 0xed, 0x42, 0x2b, 0x7c, 0xb5, 0x20, 0xfb, 0x1, 0xfd, 0xff, 0x19, 0x19, 
-0x19, 0xed, 0x78, 0xe6, 0x80, 0x28, 0x8, 0x2b, 0x7c, 0xb5, 0x20, 0xf5, 0xf1, 0xfb, 0xc9, 0xed, 
-0x78, 0xe6, 0x80, 0x20, 0xec, 0xed, 0x78, 0xe6, 0x80, 0x20, 0xe6, 0x62, 0x6b, 0x1, 0x2, 0x0, 
-0xcb, 0x3c, 0xcb, 0x1d, 0xb7, 0xed, 0x42, 0x1, 0xfd, 0xff, 0x3e, 0x80, 0x8, 0x0, 0x0, 0x0, 
-0x0, 0x19, 0x2b, 0x7c, 0xb5, 0x20, 0xfb, 0xed, 0x78, 0xe6, 0x80, 0xca, 0xb7, 0x7, 0x8, 0x37, 
-0x1f, 0x38, 0xd, 0x8, 0xc3, 0x9d, 0x7, 0x8, 0xb7, 0x1f, 0x38, 0x4, 0x8, 0xc3, 0x9d, 0x7, 
-0x21, 0x61, 0x5b, 0x36, 0x1, 0x23, 0x77, 0xf1, 0xfb, 0xc9, 0xf5, 0x3a, 0x65, 0x5b, 0xb7, 0x28, 
-0xf, 0x3d, 0x32, 0x65, 0x5b, 0x20, 0x4, 0xf1, 0xc3, 0x72, 0x8, 0xf1, 0x32, 0xf, 0x5c, 0xc9, 
-0xf1, 0xfe, 0xa3, 0x38, 0xd, 0x2a, 0x5a, 0x5b, 0xe5, 0xef, 0x52, 0xb, 0xe1, 0x22, 0x5a, 0x5b, 
-0x37, 0xc9, 0x21, 0x3b, 0x5c, 0xcb, 0x86, 0xfe, 0x20, 0x20, 0x2, 0xcb, 0xc6, 0xfe, 0x7f, 0x38, 
-0x2, 0x3e, 0x3f, 0xfe, 0x20, 0x38, 0x17, 0xf5, 0x21, 0x63, 0x5b, 0x34, 0x3a, 0x64, 0x5b, 0xbe, 
-0x30, 0x8, 0xcd, 0x22, 0x8, 0x3e, 0x1, 0x32, 0x63, 0x5b, 0xf1, 0xc3, 0xa3, 0x8, 0xfe, 0xd, 
-0x20, 0xe, 0xaf, 0x32, 0x63, 0x5b, 0x3e, 0xd, 0xcd, 0xa3, 0x8, 0x3e, 0xa, 0xc3, 0xa3, 0x8, 
-0xfe, 0x6, 0x20, 0x1f, 0xed, 0x4b, 0x63, 0x5b, 0x1e, 0x0, 0x1c, 0xc, 0x79, 0xb8, 0x28, 0x8, 
-0xd6, 0x8, 0x28, 0x4, 0x30, 0xfa, 0x18, 0xf2, 0xd5, 0x3e, 0x20, 0xcd, 0xca, 0x7, 0xd1, 0x1d, 
-0xc8, 0x18, 0xf5, 0xfe, 0x16, 0x28, 0x9, 0xfe, 0x17, 0x28, 0x5, 0xfe, 0x10, 0xd8, 0x18, 0x9, 
-0x32, 0xe, 0x5c, 0x3e, 0x2, 0x32, 0x65, 0x5b, 0xc9, 0x32, 0xe, 0x5c, 0x3e, 0x2, 0x32, 0x65, 
-0x5b, 0xc9, 0x57, 0x3a, 0xe, 0x5c, 0xfe, 0x16, 0x28, 0x8, 0xfe, 0x17, 0x3f, 0xc0, 0x3a, 0xf, 
-0x5c, 0x57, 0x3a, 0x64, 0x5b, 0xba, 0x28, 0x2, 0x30, 0x6, 0x47, 0x7a, 0x90, 0x57, 0x18, 0xf2, 
-0x7a, 0xb7, 0xca, 0x22, 0x8, 0x3a, 0x63, 0x5b, 0xba, 0xc8, 0xd5, 0x3e, 0x20, 0xcd, 0xca, 0x7, 
-0xd1, 0x18, 0xf2, 0xf5, 0xe, 0xfd, 0x16, 0xff, 0x1e, 0xbf, 0x42, 0x3e, 0xe, 0xed, 0x79, 0xcd, 
-0xd6, 0x5, 0xed, 0x78, 0xe6, 0x40, 0x20, 0xf7, 0x2a, 0x5f, 0x5b, 0x11, 0x2, 0x0, 0xb7, 0xed, 
-0x52, 0xeb, 0xf1, 0x2f, 0x37, 0x6, 0xb, 0xf3, 0xc5, 0xf5, 0x3e, 0xfe, 0x62, 0x6b, 0x1, 0xfd, 
-0xbf, 0xd2, 0xda, 0x8, 0xe6, 0xf7, 0xed, 0x79, 0x18, 0x6, 0xf6, 0x8, 0xed, 0x79, 0x18, 0x0, 
-0x2b, 0x7c, 0xb5, 0x20, 0xfb, 0x0, 0x0, 0x0, 0xf1, 0xc1, 0xb7, 0x1f, 0x10, 0xda, 0xfb, 0xc9, 
-0x21, 0x72, 0x5b, 0x36, 0x2b, 0x21, 0x79, 0x9, 0xcd, 0x5f, 0x9, 0xcd, 0x15, 0x9, 0x21, 0x80, 
-0x9, 0xcd, 0x5f, 0x9, 0x21, 0x72, 0x5b, 0xaf, 0xbe, 0x28, 0x3, 0x35, 0x18, 0xe7, 0x21, 0x82, 
-0x9, 0xcd, 0x5f, 0x9, 0xc9, 0x21, 0x71, 0x5b, 0x36, 0xff, 0xcd, 0x26, 0x9, 0x21, 0x71, 0x5b, 
-0xaf, 0xbe, 0xc8, 0x35, 0x18, 0xf4, 0x11, 0x0, 0xc0, 0xed, 0x4b, 0x71, 0x5b, 0x37, 0xcb, 0x10, 
-0x37, 0xcb, 0x10, 0x79, 0x2f, 0x4f, 0xaf, 0xf5, 0xd5, 0xc5, 0xcd, 0x6d, 0x9, 0xc1, 0xd1, 0x1e, 
-0x0, 0x28, 0x1, 0x5a, 0xf1, 0xb3, 0xf5, 0x5, 0xcb, 0x3a, 0xcb, 0x3a, 0xd5, 0xc5, 0x30, 0xea, 
-0xc1, 0xd1, 0xf1, 0x6, 0x3, 0xc5, 0xf5, 0xcd, 0xa3, 0x8, 0xf1, 0xc1, 0x10, 0xf7, 0xc9, 0x46, 
-0x23, 0x7e, 0xe5, 0xc5, 0xcd, 0xa3, 0x8, 0xc1, 0xe1, 0x23, 0x10, 0xf5, 0xc9, 0xef, 0xaa, 0x22, 
-0x47, 0x4, 0xaf, 0x37, 0x1f, 0x10, 0xfd, 0xa6, 0xc9, 0x6, 0x1b, 0x31, 0x1b, 0x4c, 0x0, 0x3, 
-0x1, 0xa, 0x2, 0x1b, 0x32, 0xf3, 0xc5, 0x11, 0x37, 0x0, 0x21, 0x3c, 0x0, 0x19, 0x10, 0xfd, 
-0x4d, 0x44, 0xef, 0x30, 0x0, 0xf3, 0xd5, 0xfd, 0xe1, 0xe5, 0xdd, 0xe1, 0xfd, 0x36, 0x10, 0xff, 
-0x1, 0xc9, 0xff, 0xdd, 0x9, 0xdd, 0x36, 0x3, 0x3c, 0xdd, 0x36, 0x1, 0xff, 0xdd, 0x36, 0x4, 
-0xf, 0xdd, 0x36, 0x5, 0x5, 0xdd, 0x36, 0x21, 0x0, 0xdd, 0x36, 0xa, 0x0, 0xdd, 0x36, 0xb, 
-0x0, 0xdd, 0x36, 0x16, 0xff, 0xdd, 0x36, 0x17, 0x0, 0xdd, 0x36, 0x18, 0x0, 0xef, 0xf1, 0x2b, 
-0xf3, 0xdd, 0x73, 0x6, 0xdd, 0x72, 0x7, 0xdd, 0x73, 0xc, 0xdd, 0x72, 0xd, 0xeb, 0x9, 0xdd, 
-0x75, 0x8, 0xdd, 0x74, 0x9, 0xc1, 0xc5, 0x5, 0x48, 0x6, 0x0, 0xcb, 0x21, 0xfd, 0xe5, 0xe1, 
-0x9, 0xdd, 0xe5, 0xc1, 0x71, 0x23, 0x70, 0xb7, 0xfd, 0xcb, 0x10, 0x16, 0xc1, 0x5, 0xc5, 0xdd, 
-0x70, 0x2, 0x20, 0x9c, 0xc1, 0xfd, 0x36, 0x27, 0x1a, 0xfd, 0x36, 0x28, 0xb, 0xfd, 0xe5, 0xe1, 
-0x1, 0x2b, 0x0, 0x9, 0xeb, 0x21, 0x31, 0xa, 0x1, 0xd, 0x0, 0xed, 0xb0, 0x16, 0x7, 0x1e, 
-0xf8, 0xcd, 0x7c, 0xe, 0x16, 0xb, 0x1e, 0xff, 0xcd, 0x7c, 0xe, 0x14, 0xcd, 0x7c, 0xe, 0x18, 
-0x4c, 0xef, 0xa4, 0x1, 0x5, 0x34, 0xdf, 0x75, 0xf4, 0x38, 0x75, 0x5, 0x38, 0xc9, 0x3e, 0x7f, 
-0xdb, 0xfe, 0x1f, 0xd8, 0x3e, 0xfe, 0xdb, 0xfe, 0x1f, 0xc9, 0x1, 0x11, 0x0, 0x18, 0x3, 0x1, 
-0x0, 0x0, 0xfd, 0xe5, 0xe1, 0x9, 0xfd, 0x75, 0x23, 0xfd, 0x74, 0x24, 0xfd, 0x7e, 0x10, 0xfd, 
-0x77, 0x22, 0xfd, 0x36, 0x21, 0x1, 0xc9, 0x5e, 0x23, 0x56, 0xd5, 0xdd, 0xe1, 0xc9, 0xfd, 0x6e, 
-0x23, 0xfd, 0x66, 0x24, 0x23, 0x23, 0xfd, 0x75, 0x23, 0xfd, 0x74, 0x24, 0xc9, 0xcd, 0x4f, 0xa, 
-0xfd, 0xcb, 0x22, 0x1e, 0x38, 0x6, 0xcd, 0x67, 0xa, 0xcd, 0x5c, 0xb, 0xfd, 0xcb, 0x21, 0x26, 
-0x38, 0x5, 0xcd, 0x6e, 0xa, 0x18, 0xe9, 0xcd, 0x91, 0xf, 0xd5, 0xcd, 0x42, 0xf, 0xd1, 0xfd, 
-0x7e, 0x10, 0xfe, 0xff, 0x20, 0x5, 0xcd, 0x93, 0xe, 0xfb, 0xc9, 0x1b, 0xcd, 0x76, 0xf, 0xcd, 
-0xc1, 0xf, 0xcd, 0x91, 0xf, 0x18, 0xe8, 0x48, 0x5a, 0x59, 0x58, 0x57, 0x55, 0x56, 0x4d, 0x54, 
-0x29, 0x28, 0x4e, 0x4f, 0x21, 0xcd, 0xe3, 0xe, 0xd8, 0xdd, 0x34, 0x6, 0xc0, 0xdd, 0x34, 0x7, 
-0xc9, 0xe5, 0xe, 0x0, 0xcd, 0xc5, 0xa, 0x38, 0x8, 0xfe, 0x26, 0x20, 0xf, 0x3e, 0x80, 0xe1, 
-0xc9, 0xfd, 0x7e, 0x21, 0xfd, 0xb6, 0x10, 0xfd, 0x77, 0x10, 0x18, 0xf3, 0xfe, 0x23, 0x20, 0x3, 
-0xc, 0x18, 0xe1, 0xfe, 0x24, 0x20, 0x3, 0xd, 0x18, 0xda, 0xcb, 0x6f, 0x20, 0x6, 0xf5, 0x3e, 
-0xc, 0x81, 0x4f, 0xf1, 0xe6, 0xdf, 0xd6, 0x41, 0xda, 0x22, 0xf, 0xfe, 0x7, 0xd2, 0x22, 0xf, 
-0xc5, 0x6, 0x0, 0x4f, 0x21, 0xf9, 0xd, 0x9, 0x7e, 0xc1, 0x81, 0xe1, 0xc9, 0xe5, 0xd5, 0xdd, 
-0x6e, 0x6, 0xdd, 0x66, 0x7, 0x11, 0x0, 0x0, 0x7e, 0xfe, 0x30, 0x38, 0x18, 0xfe, 0x3a, 0x30, 
-0x14, 0x23, 0xe5, 0xcd, 0x50, 0xb, 0xd6, 0x30, 0x26, 0x0, 0x6f, 0x19, 0x38, 0x4, 0xeb, 0xe1, 
-0x18, 0xe6, 0xc3, 0x1a, 0xf, 0xdd, 0x75, 0x6, 0xdd, 0x74, 0x7, 0xd5, 0xc1, 0xd1, 0xe1, 0xc9, 
-0x21, 0x0, 0x0, 0x6, 0xa, 0x19, 0x38, 0xea, 0x10, 0xfb, 0xeb, 0xc9, 0xcd, 0x3e, 0xa, 0x38, 
-0x8, 0xcd, 0x93, 0xe, 0xfb, 0xcd, 0xac, 0x5, 0x14, 0xcd, 0xc5, 0xa, 0xda, 0xa2, 0xd, 0xcd, 
-0xf0, 0xd, 0x6, 0x0, 0xcb, 0x21, 0x21, 0xca, 0xd, 0x9, 0x5e, 0x23, 0x56, 0xeb, 0xcd, 0x84, 
-0xb, 0x18, 0xd9, 0xc9, 0xe9, 0xcd, 0xc5, 0xa, 0xda, 0xa1, 0xd, 0xfe, 0x21, 0xc8, 0x18, 0xf5, 
-0xcd, 0x1d, 0xb, 0x79, 0xfe, 0x9, 0xd2, 0x12, 0xf, 0xcb, 0x27, 0xcb, 0x27, 0x47, 0xcb, 0x27, 
-0x80, 0xdd, 0x77, 0x3, 0xc9, 0xc9, 0xdd, 0x7e, 0xb, 0x3c, 0xfe, 0x5, 0xca, 0x2a, 0xf, 0xdd, 
-0x77, 0xb, 0x11, 0xc, 0x0, 0xcd, 0x27, 0xc, 0xdd, 0x7e, 0x6, 0x77, 0x23, 0xdd, 0x7e, 0x7, 
-0x77, 0xc9, 0xdd, 0x7e, 0x16, 0x11, 0x17, 0x0, 0xb7, 0xfa, 0xf0, 0xb, 0xcd, 0x27, 0xc, 0xdd, 
-0x7e, 0x6, 0xbe, 0x20, 0x1b, 0x23, 0xdd, 0x7e, 0x7, 0xbe, 0x20, 0x14, 0xdd, 0x35, 0x16, 0xdd, 
-0x7e, 0x16, 0xb7, 0xf0, 0xdd, 0xcb, 0xa, 0x46, 0xc8, 0xdd, 0x36, 0x16, 0x0, 0xaf, 0x18, 0x1b, 
-0xdd, 0x7e, 0x16, 0x3c, 0xfe, 0x5, 0xca, 0x2a, 0xf, 0xdd, 0x77, 0x16, 0xcd, 0x27, 0xc, 0xdd, 
-0x7e, 0x6, 0x77, 0x23, 0xdd, 0x7e, 0x7, 0x77, 0xdd, 0x7e, 0xb, 0x11, 0xc, 0x0, 0xcd, 0x27, 
-0xc, 0x7e, 0xdd, 0x77, 0x6, 0x23, 0x7e, 0xdd, 0x77, 0x7, 0xdd, 0x35, 0xb, 0xf0, 0xdd, 0x36, 
-0xb, 0x0, 0xdd, 0xcb, 0xa, 0xc6, 0xc9, 0xdd, 0xe5, 0xe1, 0x19, 0x6, 0x0, 0x4f, 0xcb, 0x21, 
-0x9, 0xc9, 0xcd, 0x1d, 0xb, 0x78, 0xb7, 0xc2, 0x12, 0xf, 0x79, 0xfe, 0x3c, 0xda, 0x12, 0xf, 
-0xfe, 0xf1, 0xd2, 0x12, 0xf, 0xdd, 0x7e, 0x2, 0xb7, 0xc0, 0x6, 0x0, 0xc5, 0xe1, 0x29, 0x29, 
-0xe5, 0xc1, 0xfd, 0xe5, 0xef, 0x2b, 0x2d, 0xf3, 0xfd, 0xe1, 0xfd, 0xe5, 0xfd, 0xe5, 0xe1, 0x1, 
-0x2b, 0x0, 0x9, 0xfd, 0x21, 0x3a, 0x5c, 0xe5, 0x21, 0x76, 0xc, 0x22, 0x5a, 0x5b, 0x21, 0x14, 
-0x5b, 0xe3, 0xe5, 0xc3, 0x0, 0x5b, 0xf3, 0xef, 0xa2, 0x2d, 0xf3, 0xfd, 0xe1, 0xfd, 0x71, 0x27, 
-0xfd, 0x70, 0x28, 0xc9, 0xcd, 0x1d, 0xb, 0x79, 0xfe, 0x40, 0xd2, 0x12, 0xf, 0x2f, 0x5f, 0x16, 
-0x7, 0xcd, 0x7c, 0xe, 0xc9, 0xcd, 0x1d, 0xb, 0x79, 0xfe, 0x10, 0xd2, 0x12, 0xf, 0xdd, 0x77, 
-0x4, 0xdd, 0x5e, 0x2, 0x3e, 0x8, 0x83, 0x57, 0x59, 0xcd, 0x7c, 0xe, 0xc9, 0xdd, 0x5e, 0x2, 
-0x3e, 0x8, 0x83, 0x57, 0x1e, 0x1f, 0xdd, 0x73, 0x4, 0xc9, 0xcd, 0x1d, 0xb, 0x79, 0xfe, 0x8, 
-0xd2, 0x12, 0xf, 0x6, 0x0, 0x21, 0xe8, 0xd, 0x9, 0x7e, 0xfd, 0x77, 0x29, 0xc9, 0xcd, 0x1d, 
-0xb, 0x16, 0xb, 0x59, 0xcd, 0x7c, 0xe, 0x14, 0x58, 0xcd, 0x7c, 0xe, 0xc9, 0xcd, 0x1d, 0xb, 
-0x79, 0x3d, 0xfa, 0x12, 0xf, 0xfe, 0x10, 0xd2, 0x12, 0xf, 0xdd, 0x77, 0x1, 0xc9, 0xcd, 0x1d, 
-0xb, 0x79, 0xcd, 0xa3, 0x11, 0xc9, 0xfd, 0x36, 0x10, 0xff, 0xc9, 0xcd, 0x19, 0xe, 0xda, 0x81, 
-0xd, 0xcd, 0xac, 0xd, 0xcd, 0xb4, 0xd, 0xaf, 0xdd, 0x77, 0x21, 0xcd, 0xc8, 0xe, 0xcd, 0x1d, 
-0xb, 0x79, 0xb7, 0xca, 0x12, 0xf, 0xfe, 0xd, 0xd2, 0x12, 0xf, 0xfe, 0xa, 0x38, 0x13, 0xcd, 
-0x0, 0xe, 0xcd, 0x74, 0xd, 0x73, 0x23, 0x72, 0xcd, 0x74, 0xd, 0x23, 0x73, 0x23, 0x72, 0x23, 
-0x18, 0x6, 0xdd, 0x71, 0x5, 0xcd, 0x0, 0xe, 0xcd, 0x74, 0xd, 0xcd, 0xe3, 0xe, 0xfe, 0x5f, 
-0x20, 0x2c, 0xcd, 0xc5, 0xa, 0xcd, 0x1d, 0xb, 0x79, 0xfe, 0xa, 0x38, 0x12, 0xe5, 0xd5, 0xcd, 
-0x0, 0xe, 0xe1, 0x19, 0x4b, 0x42, 0xeb, 0xe1, 0x73, 0x23, 0x72, 0x59, 0x50, 0x18, 0xc9, 0xdd, 
-0x71, 0x5, 0xe5, 0xd5, 0xcd, 0x0, 0xe, 0xe1, 0x19, 0xeb, 0xe1, 0xc3, 0x3b, 0xd, 0x73, 0x23, 
-0x72, 0xc3, 0x9c, 0xd, 0xdd, 0x7e, 0x21, 0x3c, 0xfe, 0xb, 0xca, 0x3a, 0xf, 0xdd, 0x77, 0x21, 
-0xc9, 0xcd, 0xc8, 0xe, 0xdd, 0x36, 0x21, 0x1, 0xcd, 0xac, 0xd, 0xcd, 0xb4, 0xd, 0xdd, 0x4e, 
-0x5, 0xe5, 0xcd, 0x0, 0xe, 0xe1, 0x73, 0x23, 0x72, 0xc3, 0x9c, 0xd, 0xe1, 0x23, 0x23, 0xe5, 
-0xc9, 0xe1, 0xfd, 0x7e, 0x21, 0xfd, 0xb6, 0x10, 0xfd, 0x77, 0x10, 0xc9, 0xdd, 0xe5, 0xe1, 0x1, 
-0x22, 0x0, 0x9, 0xc9, 0xe5, 0xfd, 0xe5, 0xe1, 0x1, 0x11, 0x0, 0x9, 0x6, 0x0, 0xdd, 0x4e, 
-0x2, 0xcb, 0x21, 0x9, 0xd1, 0x73, 0x23, 0x72, 0xeb, 0xc9, 0xfb, 0xc, 0x85, 0xb, 0x90, 0xb, 
-0xa5, 0xb, 0xa6, 0xb, 0xc2, 0xb, 0x32, 0xc, 0x84, 0xc, 0x95, 0xc, 0xad, 0xc, 0xba, 0xc, 
-0xce, 0xc, 0xdd, 0xc, 0xee, 0xc, 0xf6, 0xc, 0x0, 0x4, 0xb, 0xd, 0x8, 0xc, 0xe, 0xa, 
-0x1, 0xf, 0x0, 0x21, 0xb7, 0xa, 0xed, 0xb1, 0xc9, 0x9, 0xb, 0x0, 0x2, 0x4, 0x5, 0x7, 
-0xe5, 0x6, 0x0, 0x21, 0xc, 0xe, 0x9, 0x16, 0x0, 0x5e, 0xe1, 0xc9, 0x80, 0x6, 0x9, 0xc, 
-0x12, 0x18, 0x24, 0x30, 0x48, 0x60, 0x4, 0x8, 0x10, 0xfe, 0x30, 0xd8, 0xfe, 0x3a, 0x3f, 0xc9, 
-0x4f, 0xdd, 0x7e, 0x3, 0x81, 0xfe, 0x80, 0xd2, 0x32, 0xf, 0x4f, 0xdd, 0x7e, 0x2, 0xb7, 0x20, 
-0xe, 0x79, 0x2f, 0xe6, 0x7f, 0xcb, 0x3f, 0xcb, 0x3f, 0x16, 0x6, 0x5f, 0xcd, 0x7c, 0xe, 0xdd, 
-0x71, 0x0, 0xdd, 0x7e, 0x2, 0xfe, 0x3, 0xd0, 0x21, 0x96, 0x10, 0x6, 0x0, 0x79, 0xd6, 0x15, 
-0x30, 0x5, 0x11, 0xbf, 0xf, 0x18, 0x7, 0x4f, 0xcb, 0x21, 0x9, 0x5e, 0x23, 0x56, 0xeb, 0xdd, 
-0x56, 0x2, 0xcb, 0x22, 0x5d, 0xcd, 0x7c, 0xe, 0x14, 0x5c, 0xcd, 0x7c, 0xe, 0xdd, 0xcb, 0x4, 
-0x66, 0xc8, 0x16, 0xd, 0xfd, 0x7e, 0x29, 0x5f, 0xcd, 0x7c, 0xe, 0xc9, 0xc5, 0x1, 0xfd, 0xff, 
-0xed, 0x51, 0x1, 0xfd, 0xbf, 0xed, 0x59, 0xc1, 0xc9, 0xc5, 0x1, 0xfd, 0xff, 0xed, 0x79, 0xed, 
-0x78, 0xc1, 0xc9, 0x16, 0x7, 0x1e, 0xff, 0xcd, 0x7c, 0xe, 0x16, 0x8, 0x1e, 0x0, 0xcd, 0x7c, 
-0xe, 0x14, 0xcd, 0x7c, 0xe, 0x14, 0xcd, 0x7c, 0xe, 0xcd, 0x4f, 0xa, 0xfd, 0xcb, 0x22, 0x1e, 
-0x38, 0x6, 0xcd, 0x67, 0xa, 0xcd, 0x8d, 0x11, 0xfd, 0xcb, 0x21, 0x26, 0x38, 0x5, 0xcd, 0x6e, 
-0xa, 0x18, 0xe9, 0xfd, 0x21, 0x3a, 0x5c, 0xc9, 0xe5, 0xd5, 0xdd, 0x6e, 0x6, 0xdd, 0x66, 0x7, 
-0x2b, 0x7e, 0xfe, 0x20, 0x28, 0xfa, 0xfe, 0xd, 0x28, 0xf6, 0xdd, 0x75, 0x6, 0xdd, 0x74, 0x7, 
-0xd1, 0xe1, 0xc9, 0xe5, 0xd5, 0xc5, 0xdd, 0x6e, 0x6, 0xdd, 0x66, 0x7, 0x7c, 0xdd, 0xbe, 0x9, 
-0x20, 0x9, 0x7d, 0xdd, 0xbe, 0x8, 0x20, 0x3, 0x37, 0x18, 0xa, 0x7e, 0xfe, 0x20, 0x28, 0x9, 
-0xfe, 0xd, 0x28, 0x5, 0xb7, 0xc1, 0xd1, 0xe1, 0xc9, 0x23, 0xdd, 0x75, 0x6, 0xdd, 0x74, 0x7, 
-0x18, 0xda, 0xcd, 0x93, 0xe, 0xfb, 0xcd, 0xac, 0x5, 0x29, 0xcd, 0x93, 0xe, 0xfb, 0xcd, 0xac, 
-0x5, 0x27, 0xcd, 0x93, 0xe, 0xfb, 0xcd, 0xac, 0x5, 0x26, 0xcd, 0x93, 0xe, 0xfb, 0xcd, 0xac, 
-0x5, 0x1f, 0xcd, 0x93, 0xe, 0xfb, 0xcd, 0xac, 0x5, 0x28, 0xcd, 0x93, 0xe, 0xfb, 0xcd, 0xac, 
-0x5, 0x2a, 0xcd, 0x4f, 0xa, 0xfd, 0xcb, 0x22, 0x1e, 0x38, 0x21, 0xcd, 0x67, 0xa, 0xcd, 0xd1, 
-0xa, 0xfe, 0x80, 0x28, 0x17, 0xcd, 0x20, 0xe, 0xdd, 0x7e, 0x2, 0xfe, 0x3, 0x30, 0xa, 0x16, 
-0x8, 0x82, 0x57, 0xdd, 0x5e, 0x4, 0xcd, 0x7c, 0xe, 0xcd, 0x6e, 0x11, 0xfd, 0xcb, 0x21, 0x26, 
-0xd8, 0xcd, 0x6e, 0xa, 0x18, 0xcf, 0xe5, 0xfd, 0x6e, 0x27, 0xfd, 0x66, 0x28, 0x1, 0x64, 0x0, 
-0xb7, 0xed, 0x42, 0xe5, 0xc1, 0xe1, 0xb, 0x78, 0xb1, 0x20, 0xfb, 0x1b, 0x7a, 0xb3, 0x20, 0xe6, 
-0xc9, 0x11, 0xff, 0xff, 0xcd, 0x4a, 0xa, 0xfd, 0xcb, 0x22, 0x1e, 0x38, 0x12, 0xd5, 0x5e, 0x23, 
-0x56, 0xeb, 0x5e, 0x23, 0x56, 0xd5, 0xe1, 0xc1, 0xb7, 0xed, 0x42, 0x38, 0x2, 0xc5, 0xd1, 0xfd, 
-0xcb, 0x21, 0x26, 0x38, 0x5, 0xcd, 0x6e, 0xa, 0x18, 0xdd, 0xfd, 0x73, 0x25, 0xfd, 0x72, 0x26, 
-0xc9, 0xaf, 0xfd, 0x77, 0x2a, 0xcd, 0x4f, 0xa, 0xfd, 0xcb, 0x22, 0x1e, 0xda, 0x5a, 0x10, 0xcd, 
-0x67, 0xa, 0xfd, 0xe5, 0xe1, 0x1, 0x11, 0x0, 0x9, 0x6, 0x0, 0xdd, 0x4e, 0x2, 0xcb, 0x21, 
-0x9, 0x5e, 0x23, 0x56, 0xeb, 0xe5, 0x5e, 0x23, 0x56, 0xeb, 0xfd, 0x5e, 0x25, 0xfd, 0x56, 0x26, 
-0xb7, 0xed, 0x52, 0xeb, 0xe1, 0x28, 0x5, 0x73, 0x23, 0x72, 0x18, 0x5e, 0xdd, 0x7e, 0x2, 0xfe, 
-0x3, 0x30, 0x9, 0x16, 0x8, 0x82, 0x57, 0x1e, 0x0, 0xcd, 0x7c, 0xe, 0xcd, 0x8d, 0x11, 0xdd, 
-0xe5, 0xe1, 0x1, 0x21, 0x0, 0x9, 0x35, 0x20, 0xd, 0xcd, 0x5c, 0xb, 0xfd, 0x7e, 0x21, 0xfd, 
-0xa6, 0x10, 0x20, 0x36, 0x18, 0x17, 0xfd, 0xe5, 0xe1, 0x1, 0x11, 0x0, 0x9, 0x6, 0x0, 0xdd, 
-0x4e, 0x2, 0xcb, 0x21, 0x9, 0x5e, 0x23, 0x56, 0x13, 0x13, 0x72, 0x2b, 0x73, 0xcd, 0xd1, 0xa, 
-0x4f, 0xfd, 0x7e, 0x21, 0xfd, 0xa6, 0x10, 0x20, 0x11, 0x79, 0xfe, 0x80, 0x28, 0xc, 0xcd, 0x20, 
-0xe, 0xfd, 0x7e, 0x21, 0xfd, 0xb6, 0x2a, 0xfd, 0x77, 0x2a, 0xfd, 0xcb, 0x21, 0x26, 0x38, 0x6, 
-0xcd, 0x6e, 0xa, 0xc3, 0xc8, 0xf, 0x11, 0x1, 0x0, 0xcd, 0x76, 0xf, 0xcd, 0x4f, 0xa, 0xfd, 
-0xcb, 0x2a, 0x1e, 0x30, 0x17, 0xcd, 0x67, 0xa, 0xdd, 0x7e, 0x2, 0xfe, 0x3, 0x30, 0xa, 0x16, 
-0x8, 0x82, 0x57, 0xdd, 0x5e, 0x4, 0xcd, 0x7c, 0xe, 0xcd, 0x6e, 0x11, 0xfd, 0xcb, 0x21, 0x26, 
-0xd8, 0xcd, 0x6e, 0xa, 0x18, 0xd9, 0xbf, 0xf, 0xdc, 0xe, 0x7, 0xe, 0x3d, 0xd, 0x7f, 0xc, 
-0xcc, 0xb, 0x22, 0xb, 0x82, 0xa, 0xeb, 0x9, 0x5d, 0x9, 0xd6, 0x8, 0x57, 0x8, 0xdf, 0x7, 
-0x6e, 0x7, 0x3, 0x7, 0x9f, 0x6, 0x40, 0x6, 0xe6, 0x5, 0x91, 0x5, 0x41, 0x5, 0xf6, 0x4, 
-0xae, 0x4, 0x6b, 0x4, 0x2c, 0x4, 0xf0, 0x3, 0xb7, 0x3, 0x82, 0x3, 0x4f, 0x3, 0x20, 0x3, 
-0xf3, 0x2, 0xc8, 0x2, 0xa1, 0x2, 0x7b, 0x2, 0x57, 0x2, 0x36, 0x2, 0x16, 0x2, 0xf8, 0x1, 
-0xdc, 0x1, 0xc1, 0x1, 0xa8, 0x1, 0x90, 0x1, 0x79, 0x1, 0x64, 0x1, 0x50, 0x1, 0x3d, 0x1, 
-0x2c, 0x1, 0x1b, 0x1, 0xb, 0x1, 0xfc, 0x0, 0xee, 0x0, 0xe0, 0x0, 0xd4, 0x0, 0xc8, 0x0, 
-0xbd, 0x0, 0xb2, 0x0, 0xa8, 0x0, 0x9f, 0x0, 0x96, 0x0, 0x8d, 0x0, 0x85, 0x0, 0x7e, 0x0, 
-0x77, 0x0, 0x70, 0x0, 0x6a, 0x0, 0x64, 0x0, 0x5e, 0x0, 0x59, 0x0, 0x54, 0x0, 0x4f, 0x0, 
-0x4b, 0x0, 0x47, 0x0, 0x43, 0x0, 0x3f, 0x0, 0x3b, 0x0, 0x38, 0x0, 0x35, 0x0, 0x32, 0x0, 
-0x2f, 0x0, 0x2d, 0x0, 0x2a, 0x0, 0x28, 0x0, 0x25, 0x0, 0x23, 0x0, 0x21, 0x0, 0x1f, 0x0, 
-0x1e, 0x0, 0x1c, 0x0, 0x1a, 0x0, 0x19, 0x0, 0x18, 0x0, 0x16, 0x0, 0x15, 0x0, 0x14, 0x0, 
-0x13, 0x0, 0x12, 0x0, 0x11, 0x0, 0x10, 0x0, 0xf, 0x0, 0xe, 0x0, 0xd, 0x0, 0xc, 0x0, 
-0xc, 0x0, 0xb, 0x0, 0xb, 0x0, 0xa, 0x0, 0x9, 0x0, 0x9, 0x0, 0x8, 0x0, 0xdd, 0x7e, 
-0x1, 0xb7, 0xf8, 0xf6, 0x90, 0xcd, 0xa3, 0x11, 0xdd, 0x7e, 0x0, 0xcd, 0xa3, 0x11, 0xdd, 0x7e, 
-0x4, 0xcb, 0xa7, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0xcd, 0xa3, 0x11, 0xc9, 0xdd, 0x7e, 0x1, 
-0xb7, 0xf8, 0xf6, 0x80, 0xcd, 0xa3, 0x11, 0xdd, 0x7e, 0x0, 0xcd, 0xa3, 0x11, 0x3e, 0x40, 0xcd, 
-0xa3, 0x11, 0xc9, 0x6f, 0x1, 0xfd, 0xff, 0x3e, 0xe, 0xed, 0x79, 0x1, 0xfd, 0xbf, 0x3e, 0xfa, 
-0xed, 0x79, 0x1e, 0x3, 0x1d, 0x20, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x16, 0x8, 0x1f, 0x6f, 
-0xd2, 0xc9, 0x11, 0x3e, 0xfe, 0xed, 0x79, 0x18, 0x6, 0x3e, 0xfa, 0xed, 0x79, 0x18, 0x0, 0x1e, 
-0x2, 0x1d, 0x20, 0xfd, 0x0, 0xc6, 0x0, 0x7d, 0x15, 0x20, 0xe3, 0x0, 0x0, 0xc6, 0x0, 0x0, 
-0x0, 0x3e, 0xfe, 0xed, 0x79, 0x1e, 0x6, 0x1d, 0x20, 0xfd, 0xc9, 0x21, 0x66, 0x5b, 0xcb, 0xee, 
-0x18, 0x13, 0x21, 0x66, 0x5b, 0xcb, 0xe6, 0x18, 0xc, 0x21, 0x66, 0x5b, 0xcb, 0xfe, 0x18, 0x5, 
-0x21, 0x66, 0x5b, 0xcb, 0xf6, 0x21, 0x66, 0x5b, 0xcb, 0x9e, 0xdf, 0xfe, 0x21, 0xc2, 0xbe, 0x13, 
-0x21, 0x66, 0x5b, 0xcb, 0xde, 0xe7, 0xc3, 0xbe, 0x13, 0xcd, 0xac, 0x5, 0xb, 0x22, 0x74, 0x5b, 
-0xdd, 0x7e, 0x0, 0x32, 0x71, 0x5b, 0xdd, 0x6e, 0xb, 0xdd, 0x66, 0xc, 0x22, 0x72, 0x5b, 0xdd, 
-0x6e, 0xd, 0xdd, 0x66, 0xe, 0x22, 0x78, 0x5b, 0xdd, 0x6e, 0xf, 0xdd, 0x66, 0x10, 0x22, 0x76, 
-0x5b, 0xb7, 0x28, 0xa, 0xfe, 0x3, 0x28, 0x6, 0xdd, 0x7e, 0xe, 0x32, 0x76, 0x5b, 0xdd, 0xe5, 
-0xe1, 0x23, 0x11, 0x67, 0x5b, 0x1, 0xa, 0x0, 0xed, 0xb0, 0x21, 0x66, 0x5b, 0xcb, 0x6e, 0xc2, 
-0xad, 0x1b, 0x21, 0x71, 0x5b, 0x11, 0x7a, 0x5b, 0x1, 0x7, 0x0, 0xed, 0xb0, 0xcd, 0x2e, 0x1c, 
-0x3a, 0x7a, 0x5b, 0x47, 0x3a, 0x71, 0x5b, 0xb8, 0x20, 0x6, 0xfe, 0x3, 0x28, 0x12, 0x38, 0x4, 
-0xcd, 0xac, 0x5, 0x1d, 0x3a, 0x66, 0x5b, 0xcb, 0x77, 0x20, 0x3a, 0xcb, 0x7f, 0xca, 0xdb, 0x12, 
-0x3a, 0x66, 0x5b, 0xcb, 0x77, 0x28, 0x4, 0xcd, 0xac, 0x5, 0x1c, 0x2a, 0x7b, 0x5b, 0xed, 0x5b, 
-0x72, 0x5b, 0x7c, 0xb5, 0x28, 0x8, 0xed, 0x52, 0x30, 0x4, 0xcd, 0xac, 0x5, 0x1e, 0x2a, 0x7d, 
-0x5b, 0x7c, 0xb5, 0x20, 0x3, 0x2a, 0x74, 0x5b, 0x3a, 0x71, 0x5b, 0xa7, 0x20, 0x3, 0x2a, 0x53, 
-0x5c, 0xcd, 0x7e, 0x13, 0xc9, 0xed, 0x4b, 0x72, 0x5b, 0xc5, 0x3, 0xef, 0x30, 0x0, 0x36, 0x80, 
-0xeb, 0xd1, 0xe5, 0xcd, 0x7e, 0x13, 0xe1, 0xef, 0xce, 0x8, 0xc9, 0xed, 0x5b, 0x72, 0x5b, 0x2a, 
-0x7d, 0x5b, 0xe5, 0x7c, 0xb5, 0x20, 0x6, 0x13, 0x13, 0x13, 0xeb, 0x18, 0x9, 0x2a, 0x7b, 0x5b, 
-0xeb, 0x37, 0xed, 0x52, 0x38, 0x9, 0x11, 0x5, 0x0, 0x19, 0x44, 0x4d, 0xef, 0x5, 0x1f, 0xe1, 
-0x3a, 0x71, 0x5b, 0xa7, 0x28, 0x2f, 0x7c, 0xb5, 0x28, 0xb, 0x2b, 0x46, 0x2b, 0x4e, 0x2b, 0x3, 
-0x3, 0x3, 0xef, 0xe8, 0x19, 0x2a, 0x59, 0x5c, 0x2b, 0xed, 0x4b, 0x72, 0x5b, 0xc5, 0x3, 0x3, 
-0x3, 0x3a, 0x7f, 0x5b, 0xf5, 0xef, 0x55, 0x16, 0x23, 0xf1, 0x77, 0xd1, 0x23, 0x73, 0x23, 0x72, 
-0x23, 0xcd, 0x7e, 0x13, 0xc9, 0x21, 0x66, 0x5b, 0xcb, 0x8e, 0xed, 0x5b, 0x53, 0x5c, 0x2a, 0x59, 
-0x5c, 0x2b, 0xef, 0xe5, 0x19, 0xed, 0x4b, 0x72, 0x5b, 0x2a, 0x53, 0x5c, 0xef, 0x55, 0x16, 0x23, 
-0xed, 0x4b, 0x76, 0x5b, 0x9, 0x22, 0x4b, 0x5c, 0x3a, 0x79, 0x5b, 0x67, 0xe6, 0xc0, 0x20, 0x10, 
-0x3a, 0x78, 0x5b, 0x6f, 0x22, 0x42, 0x5c, 0xfd, 0x36, 0xa, 0x0, 0x21, 0x66, 0x5b, 0xcb, 0xce, 
-0x2a, 0x53, 0x5c, 0xed, 0x5b, 0x72, 0x5b, 0x2b, 0x22, 0x57, 0x5c, 0x23, 0x18, 0xb3, 0x7a, 0xb3, 
-0xc8, 0xcd, 0x4b, 0x1c, 0xc9, 0xef, 0x8c, 0x1c, 0xfd, 0xcb, 0x1, 0x7e, 0xc8, 0xf5, 0xef, 0xf1, 
-0x2b, 0xf1, 0xc9, 0xe7, 0xcd, 0x85, 0x13, 0xc8, 0xf5, 0x79, 0xb0, 0x28, 0x1d, 0x21, 0xa, 0x0, 
-0xed, 0x42, 0x38, 0x16, 0xd5, 0xc5, 0x21, 0x67, 0x5b, 0x6, 0xa, 0x3e, 0x20, 0x77, 0x23, 0x10, 
-0xfc, 0xc1, 0xe1, 0x11, 0x67, 0x5b, 0xed, 0xb0, 0xf1, 0xc9, 0xcd, 0xac, 0x5, 0x21, 0xef, 0x8c, 
-0x1c, 0xfd, 0xcb, 0x1, 0x7e, 0x28, 0x40, 0x1, 0x11, 0x0, 0x3a, 0x74, 0x5c, 0xa7, 0x28, 0x2, 
-0xe, 0x22, 0xef, 0x30, 0x0, 0xd5, 0xdd, 0xe1, 0x6, 0xb, 0x3e, 0x20, 0x12, 0x13, 0x10, 0xfc, 
-0xdd, 0x36, 0x1, 0xff, 0xef, 0xf1, 0x2b, 0x21, 0xf6, 0xff, 0xb, 0x9, 0x3, 0x30, 0x11, 0x3a, 
-0x74, 0x5c, 0xa7, 0x20, 0x4, 0xcd, 0xac, 0x5, 0xe, 0x78, 0xb1, 0x28, 0xa, 0x1, 0xa, 0x0, 
-0xdd, 0xe5, 0xe1, 0x23, 0xeb, 0xed, 0xb0, 0xdf, 0xfe, 0xe4, 0x20, 0x53, 0x3a, 0x74, 0x5c, 0xfe, 
-0x3, 0xca, 0x19, 0x12, 0xe7, 0xef, 0xb2, 0x28, 0x30, 0x15, 0x21, 0x0, 0x0, 0xfd, 0xcb, 0x1, 
-0x76, 0x28, 0x2, 0xcb, 0xf9, 0x3a, 0x74, 0x5c, 0x3d, 0x28, 0x19, 0xcd, 0xac, 0x5, 0x1, 0xc2, 
-0x19, 0x12, 0xfd, 0xcb, 0x1, 0x7e, 0x28, 0x19, 0x4e, 0x23, 0x7e, 0xdd, 0x77, 0xb, 0x23, 0x7e, 
-0xdd, 0x77, 0xc, 0x23, 0xdd, 0x71, 0xe, 0x3e, 0x1, 0xcb, 0x71, 0x28, 0x1, 0x3c, 0xdd, 0x77, 
-0x0, 0xeb, 0xe7, 0xfe, 0x29, 0x20, 0xd8, 0xe7, 0xcd, 0xa1, 0x18, 0xeb, 0xc3, 0x19, 0x15, 0xfe, 
-0xaa, 0x20, 0x1f, 0x3a, 0x74, 0x5c, 0xfe, 0x3, 0xca, 0x19, 0x12, 0xe7, 0xcd, 0xa1, 0x18, 0xdd, 
-0x36, 0xb, 0x0, 0xdd, 0x36, 0xc, 0x1b, 0x21, 0x0, 0x40, 0xdd, 0x75, 0xd, 0xdd, 0x74, 0xe, 
-0x18, 0x4d, 0xfe, 0xaf, 0x20, 0x4f, 0x3a, 0x74, 0x5c, 0xfe, 0x3, 0xca, 0x19, 0x12, 0xe7, 0xef, 
-0x48, 0x20, 0x20, 0xc, 0x3a, 0x74, 0x5c, 0xa7, 0xca, 0x19, 0x12, 0xef, 0xe6, 0x1c, 0x18, 0xf, 
-0xef, 0x82, 0x1c, 0xdf, 0xfe, 0x2c, 0x28, 0xc, 0x3a, 0x74, 0x5c, 0xa7, 0xca, 0x19, 0x12, 0xef, 
-0xe6, 0x1c, 0x18, 0x4, 0xe7, 0xef, 0x82, 0x1c, 0xcd, 0xa1, 0x18, 0xef, 0x99, 0x1e, 0xdd, 0x71, 
-0xb, 0xdd, 0x70, 0xc, 0xef, 0x99, 0x1e, 0xdd, 0x71, 0xd, 0xdd, 0x70, 0xe, 0x60, 0x69, 0xdd, 
-0x36, 0x0, 0x3, 0x18, 0x44, 0xfe, 0xca, 0x28, 0x9, 0xcd, 0xa1, 0x18, 0xdd, 0x36, 0xe, 0x80, 
-0x18, 0x17, 0x3a, 0x74, 0x5c, 0xa7, 0xc2, 0x19, 0x12, 0xe7, 0xef, 0x82, 0x1c, 0xcd, 0xa1, 0x18, 
-0xef, 0x99, 0x1e, 0xdd, 0x71, 0xd, 0xdd, 0x70, 0xe, 0xdd, 0x36, 0x0, 0x0, 0x2a, 0x59, 0x5c, 
-0xed, 0x5b, 0x53, 0x5c, 0x37, 0xed, 0x52, 0xdd, 0x75, 0xb, 0xdd, 0x74, 0xc, 0x2a, 0x4b, 0x5c, 
-0xed, 0x52, 0xdd, 0x75, 0xf, 0xdd, 0x74, 0x10, 0xeb, 0x3a, 0x66, 0x5b, 0xcb, 0x5f, 0xc2, 0x1d, 
-0x12, 0x3a, 0x74, 0x5c, 0xa7, 0x20, 0x4, 0xef, 0x70, 0x9, 0xc9, 0xef, 0x61, 0x7, 0xc9, 0x21, 
-0xf5, 0xee, 0xcb, 0x86, 0xcb, 0xce, 0x2a, 0x49, 0x5c, 0x7c, 0xb5, 0x20, 0x3, 0x22, 0x6, 0xec, 
-0x3a, 0xdb, 0xf9, 0xf5, 0x2a, 0x9a, 0xfc, 0xcd, 0x4a, 0x33, 0x22, 0xd7, 0xf9, 0xcd, 0x22, 0x32, 
-0xcd, 0xd6, 0x30, 0xf1, 0xb7, 0x28, 0xc, 0xf5, 0xcd, 0xdf, 0x30, 0xeb, 0xcd, 0x6a, 0x32, 0xf1, 
-0x3d, 0x18, 0xf1, 0xe, 0x0, 0xcd, 0xb4, 0x30, 0x41, 0x3a, 0x15, 0xec, 0x4f, 0xc5, 0xd5, 0xcd, 
-0xdf, 0x30, 0x3a, 0xf5, 0xee, 0xcb, 0x4f, 0x28, 0x1d, 0xd5, 0xe5, 0x11, 0x20, 0x0, 0x19, 0xcb, 
-0x46, 0x28, 0x11, 0x23, 0x56, 0x23, 0x5e, 0xb7, 0x2a, 0x49, 0x5c, 0xed, 0x52, 0x20, 0x5, 0x21, 
-0xf5, 0xee, 0xcb, 0xc6, 0xe1, 0xd1, 0xc5, 0xe5, 0x1, 0x23, 0x0, 0xed, 0xb0, 0xe1, 0xc1, 0xd5, 
-0xc5, 0xeb, 0x21, 0xf5, 0xee, 0xcb, 0x46, 0x28, 0x2a, 0x6, 0x0, 0x2a, 0x6, 0xec, 0x7c, 0xb5, 
-0x28, 0xe, 0xe5, 0xcd, 0x41, 0x2e, 0xe1, 0x30, 0x12, 0x2b, 0x4, 0x22, 0x6, 0xec, 0x18, 0xeb, 
-0xcd, 0x41, 0x2e, 0xd4, 0x63, 0x2e, 0x21, 0xf5, 0xee, 0x36, 0x0, 0x78, 0xc1, 0xc5, 0x48, 0x47, 
-0xcd, 0x11, 0x2a, 0xc1, 0xd1, 0x79, 0x4, 0xb8, 0x30, 0x95, 0x3a, 0xf5, 0xee, 0xcb, 0x4f, 0x28, 
-0x21, 0xcb, 0x47, 0x20, 0x1d, 0x2a, 0x49, 0x5c, 0x7c, 0xb5, 0x28, 0x8, 0x22, 0x9a, 0xfc, 0xcd, 
-0x22, 0x32, 0x18, 0x9, 0x22, 0x9a, 0xfc, 0xcd, 0x52, 0x33, 0x22, 0x49, 0x5c, 0xd1, 0xc1, 0xc3, 
-0x36, 0x15, 0xd1, 0xc1, 0xbf, 0xf5, 0x79, 0x48, 0xcd, 0xb4, 0x30, 0xeb, 0xf5, 0xcd, 0x4, 0x36, 
-0xf1, 0x11, 0x23, 0x0, 0x19, 0xc, 0xb9, 0x30, 0xf3, 0xf1, 0xc8, 0xcd, 0x7, 0x2a, 0xcd, 0x78, 
-0x2b, 0x2a, 0x6, 0xec, 0x2b, 0x7c, 0xb5, 0x22, 0x6, 0xec, 0x20, 0xf2, 0xc3, 0x11, 0x2a, 0xc9, 
-0x6, 0x0, 0x3a, 0x15, 0xec, 0x57, 0xc3, 0x5e, 0x3b, 0x6, 0x0, 0xe5, 0x48, 0xcd, 0xb4, 0x30, 
-0xcd, 0x6a, 0x32, 0xe1, 0xd0, 0xcd, 0xdf, 0x30, 0xc5, 0xe5, 0x21, 0x23, 0x0, 0x19, 0x3a, 0x15, 
-0xec, 0x4f, 0xb8, 0x28, 0xe, 0xc5, 0xc5, 0x1, 0x23, 0x0, 0xed, 0xb0, 0xc1, 0x79, 0x4, 0xb8, 
-0x20, 0xf4, 0xc1, 0xe1, 0xcd, 0x18, 0x36, 0x1, 0x23, 0x0, 0xed, 0xb0, 0x37, 0xc1, 0xc9, 0x6, 
-0x0, 0xcd, 0x2b, 0x32, 0xd0, 0xc5, 0xe5, 0x3a, 0x15, 0xec, 0x4f, 0xcd, 0xb4, 0x30, 0xcd, 0x1e, 
-0x31, 0x30, 0x26, 0x1b, 0x21, 0x23, 0x0, 0x19, 0xeb, 0xc5, 0x78, 0xb9, 0x28, 0xc, 0xc5, 0x1, 
-0x23, 0x0, 0xed, 0xb8, 0xc1, 0x78, 0xd, 0xb9, 0x38, 0xf4, 0xeb, 0x13, 0xc1, 0xe1, 0xcd, 0x2c, 
-0x36, 0x1, 0x23, 0x0, 0xed, 0xb0, 0x37, 0xc1, 0xc9, 0xe1, 0xc1, 0xc9, 0xd5, 0x26, 0x0, 0x68, 
-0x19, 0x57, 0x78, 0x5e, 0x72, 0x53, 0x23, 0x3c, 0xfe, 0x20, 0x38, 0xf7, 0x7b, 0xfe, 0x0, 0xd1, 
-0xc9, 0xd5, 0x21, 0x20, 0x0, 0x19, 0xe5, 0x57, 0x3e, 0x1f, 0x18, 0x7, 0x5e, 0x72, 0x53, 0xb8, 
-0x28, 0x4, 0x3d, 0x2b, 0x18, 0xf6, 0x7b, 0xfe, 0x0, 0xe1, 0xd1, 0xc9, 0xb1, 0xc9, 0xbc, 0xbe, 
-0xc3, 0xaf, 0xb4, 0x93, 0x91, 0x92, 0x95, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x7f, 0x81, 
-0x2e, 0x6c, 0x6e, 0x70, 0x48, 0x94, 0x56, 0x3f, 0x41, 0x2b, 0x17, 0x1f, 0x37, 0x77, 0x44, 0xf, 
-0x59, 0x2b, 0x43, 0x2d, 0x51, 0x3a, 0x6d, 0x42, 0xd, 0x49, 0x5c, 0x44, 0x15, 0x5d, 0x1, 0x3d, 
-0x2, 0x6, 0x0, 0x67, 0x1e, 0x6, 0xcb, 0xe, 0x67, 0x19, 0x6, 0xc, 0x53, 0x1a, 0x0, 0xee, 
-0x1c, 0xc, 0x6f, 0x1a, 0x4, 0x3d, 0x6, 0xcc, 0x6, 0xe, 0x81, 0x19, 0x4, 0x0, 0xab, 0x1d, 
-0xe, 0x78, 0x21, 0xe, 0x8c, 0x21, 0xe, 0xd5, 0x21, 0xe, 0x62, 0x18, 0xc, 0xaa, 0x21, 0xd, 
-0x2, 0x1a, 0xe, 0x75, 0x1b, 0x8, 0x0, 0x80, 0x1e, 0x3, 0x4f, 0x1e, 0x0, 0x5f, 0x1e, 0xd, 
-0xd, 0x1a, 0x0, 0x6b, 0xd, 0x9, 0x0, 0xdc, 0x22, 0x6, 0x0, 0x3a, 0x1f, 0xe, 0xab, 0x19, 
-0xe, 0xeb, 0x19, 0x3, 0x42, 0x1e, 0x9, 0xe, 0xbe, 0x21, 0xc, 0xa7, 0x21, 0xe, 0x74, 0x21, 
-0xe, 0x71, 0x1b, 0xb, 0xb, 0xb, 0xb, 0x8, 0x0, 0xf8, 0x3, 0x9, 0xe, 0xae, 0x21, 0x7, 
-0x7, 0x7, 0x7, 0x7, 0x7, 0x8, 0x0, 0x7a, 0x1e, 0x6, 0x0, 0x94, 0x22, 0xe, 0x8c, 0x1a, 
-0x6, 0x2c, 0xa, 0x0, 0x36, 0x17, 0x6, 0x0, 0xe5, 0x16, 0xe, 0x41, 0x6, 0xa, 0x2c, 0xa, 
-0xc, 0xf0, 0x1a, 0xe, 0xc, 0x1c, 0xe, 0xe5, 0x1b, 0xc, 0x2b, 0x1b, 0xe, 0x17, 0x23, 0xfd, 
-0xcb, 0x1, 0xbe, 0xef, 0xfb, 0x19, 0xaf, 0x32, 0x47, 0x5c, 0x3d, 0x32, 0x3a, 0x5c, 0x18, 0x1, 
-0xe7, 0xef, 0xbf, 0x16, 0xfd, 0x34, 0xd, 0xfa, 0x12, 0x19, 0xdf, 0x6, 0x0, 0xfe, 0xd, 0xca, 
-0x63, 0x18, 0xfe, 0x3a, 0x28, 0xea, 0x21, 0x21, 0x18, 0xe5, 0x4f, 0xe7, 0x79, 0xd6, 0xce, 0x30, 
-0x13, 0xc6, 0xce, 0x21, 0xa9, 0x17, 0xfe, 0xa3, 0x28, 0x16, 0x21, 0xac, 0x17, 0xfe, 0xa4, 0x28, 
-0xf, 0xc3, 0x12, 0x19, 0x4f, 0x21, 0xdc, 0x16, 0x9, 0x4e, 0x9, 0x18, 0x3, 0x2a, 0x74, 0x5c, 
-0x7e, 0x23, 0x22, 0x74, 0x5c, 0x1, 0xfd, 0x17, 0xc5, 0x4f, 0xfe, 0x20, 0x30, 0xc, 0x21, 0xb5, 
-0x18, 0x6, 0x0, 0x9, 0x4e, 0x9, 0xe5, 0xdf, 0x5, 0xc9, 0xdf, 0xb9, 0xc2, 0x12, 0x19, 0xe7, 
-0xc9, 0xcd, 0xd6, 0x5, 0x38, 0x4, 0xcd, 0xac, 0x5, 0x14, 0xfd, 0xcb, 0xa, 0x7e, 0xc2, 0xa8, 
-0x18, 0x2a, 0x42, 0x5c, 0xcb, 0x7c, 0x28, 0x14, 0x21, 0xfe, 0xff, 0x22, 0x45, 0x5c, 0x2a, 0x61, 
-0x5c, 0x2b, 0xed, 0x5b, 0x59, 0x5c, 0x1b, 0x3a, 0x44, 0x5c, 0x18, 0x36, 0xef, 0x6e, 0x19, 0x3a, 
-0x44, 0x5c, 0x28, 0x1c, 0xa7, 0x20, 0x46, 0x47, 0x7e, 0xe6, 0xc0, 0x78, 0x28, 0x12, 0xcd, 0xac, 
-0x5, 0xff, 0xc1, 0xfd, 0xcb, 0x1, 0x7e, 0xc8, 0x2a, 0x55, 0x5c, 0x3e, 0xc0, 0xa6, 0xc0, 0xaf, 
-0xfe, 0x1, 0xce, 0x0, 0x56, 0x23, 0x5e, 0xed, 0x53, 0x45, 0x5c, 0x23, 0x5e, 0x23, 0x56, 0xeb, 
-0x19, 0x23, 0x22, 0x55, 0x5c, 0xeb, 0x22, 0x5d, 0x5c, 0x57, 0x1e, 0x0, 0xfd, 0x36, 0xa, 0xff, 
-0x15, 0xfd, 0x72, 0xd, 0xca, 0xc0, 0x17, 0x14, 0xef, 0x8b, 0x19, 0x28, 0xb, 0xcd, 0xac, 0x5, 
-0x16, 0xfd, 0xcb, 0x1, 0x7e, 0xc0, 0xc1, 0xc1, 0xdf, 0xfe, 0xd, 0x28, 0xb6, 0xfe, 0x3a, 0xca, 
-0xc0, 0x17, 0xc3, 0x12, 0x19, 0x24, 0x43, 0x46, 0x1e, 0x4c, 0x20, 0x53, 0x5e, 0x4d, 0x86, 0x57, 
-0x88, 0x6, 0x2, 0x5, 0xef, 0xde, 0x1c, 0xbf, 0xc1, 0xcc, 0xa1, 0x18, 0xeb, 0x2a, 0x74, 0x5c, 
-0x4e, 0x23, 0x46, 0xeb, 0xc5, 0xc9, 0xef, 0xde, 0x1c, 0xbf, 0xc1, 0xcc, 0xa1, 0x18, 0xeb, 0x2a, 
-0x74, 0x5c, 0x4e, 0x23, 0x46, 0xeb, 0xe5, 0x21, 0xf8, 0x18, 0x22, 0x5a, 0x5b, 0x21, 0x14, 0x5b, 
-0xe3, 0xe5, 0x60, 0x69, 0xe3, 0xc3, 0x0, 0x5b, 0xc9, 0xef, 0x1f, 0x1c, 0xc9, 0xc1, 0xef, 0x56, 
-0x1c, 0xcd, 0xa1, 0x18, 0xc9, 0xef, 0x6c, 0x1c, 0xc9, 0xe7, 0xef, 0x7a, 0x1c, 0xc9, 0xef, 0x82, 
-0x1c, 0xc9, 0xcd, 0xac, 0x5, 0xb, 0xef, 0x8c, 0x1c, 0xc9, 0xfd, 0xcb, 0x1, 0x7e, 0xfd, 0xcb, 
-0x2, 0x86, 0x28, 0x3, 0xef, 0x4d, 0xd, 0xf1, 0x3a, 0x74, 0x5c, 0xd6, 0xa7, 0xef, 0xfc, 0x21, 
-0xcd, 0xa1, 0x18, 0x2a, 0x8f, 0x5c, 0x22, 0x8d, 0x5c, 0x21, 0x91, 0x5c, 0x7e, 0x7, 0xae, 0xe6, 
-0xaa, 0xae, 0x77, 0xc9, 0xef, 0xbe, 0x1c, 0xc9, 0xf1, 0x3a, 0x66, 0x5b, 0xe6, 0xf, 0x32, 0x66, 
-0x5b, 0x3a, 0x74, 0x5c, 0xd6, 0x74, 0x32, 0x74, 0x5c, 0xca, 0xeb, 0x11, 0x3d, 0xca, 0xf2, 0x11, 
-0x3d, 0xca, 0xf9, 0x11, 0xc3, 0x0, 0x12, 0xc1, 0xfd, 0xcb, 0x1, 0x7e, 0x28, 0x10, 0x2a, 0x65, 
-0x5c, 0x11, 0xfb, 0xff, 0x19, 0x22, 0x65, 0x5c, 0xef, 0xe9, 0x34, 0xda, 0x63, 0x18, 0xc3, 0xc1, 
-0x17, 0xfe, 0xcd, 0x20, 0x9, 0xe7, 0xcd, 0xe, 0x19, 0xcd, 0xa1, 0x18, 0x18, 0x18, 0xcd, 0xa1, 
-0x18, 0x2a, 0x65, 0x5c, 0x36, 0x0, 0x23, 0x36, 0x0, 0x23, 0x36, 0x1, 0x23, 0x36, 0x0, 0x23, 
-0x36, 0x0, 0x23, 0x22, 0x65, 0x5c, 0xef, 0x16, 0x1d, 0xc9, 0xe7, 0xcd, 0xf9, 0x18, 0xfd, 0xcb, 
-0x1, 0x7e, 0x28, 0x2e, 0xdf, 0x22, 0x5f, 0x5c, 0x2a, 0x57, 0x5c, 0x7e, 0xfe, 0x2c, 0x28, 0xb, 
-0x1e, 0xe4, 0xef, 0x86, 0x1d, 0x30, 0x4, 0xcd, 0xac, 0x5, 0xd, 0x23, 0x22, 0x5d, 0x5c, 0x7e, 
-0xef, 0x56, 0x1c, 0xdf, 0x22, 0x57, 0x5c, 0x2a, 0x5f, 0x5c, 0xfd, 0x36, 0x26, 0x0, 0x22, 0x5d, 
-0x5c, 0x7e, 0xdf, 0xfe, 0x2c, 0x28, 0xc3, 0xcd, 0xa1, 0x18, 0xc9, 0xfd, 0xcb, 0x1, 0x7e, 0x20, 
-0xb, 0xef, 0xfb, 0x24, 0xfe, 0x2c, 0xc4, 0xa1, 0x18, 0xe7, 0x18, 0xf5, 0x3e, 0xe4, 0xef, 0x39, 
-0x1e, 0xc9, 0xef, 0x67, 0x1e, 0x1, 0x0, 0x0, 0xef, 0x45, 0x1e, 0x18, 0x3, 0xef, 0x99, 0x1e, 
-0x78, 0xb1, 0x20, 0x4, 0xed, 0x4b, 0xb2, 0x5c, 0xc5, 0xed, 0x5b, 0x4b, 0x5c, 0x2a, 0x59, 0x5c, 
-0x2b, 0xef, 0xe5, 0x19, 0xef, 0x6b, 0xd, 0x2a, 0x65, 0x5c, 0x11, 0x32, 0x0, 0x19, 0xd1, 0xed, 
-0x52, 0x30, 0x8, 0x2a, 0xb4, 0x5c, 0xa7, 0xed, 0x52, 0x30, 0x4, 0xcd, 0xac, 0x5, 0x15, 0xed, 
-0x53, 0xb2, 0x5c, 0xd1, 0xe1, 0xc1, 0xed, 0x7b, 0xb2, 0x5c, 0x33, 0xc5, 0xe5, 0xed, 0x73, 0x3d, 
-0x5c, 0xd5, 0xc9, 0xd1, 0xfd, 0x66, 0xd, 0x24, 0xe3, 0x33, 0xed, 0x4b, 0x45, 0x5c, 0xc5, 0xe5, 
-0xed, 0x73, 0x3d, 0x5c, 0xd5, 0xef, 0x67, 0x1e, 0x1, 0x14, 0x0, 0xef, 0x5, 0x1f, 0xc9, 0xc1, 
-0xe1, 0xd1, 0x7a, 0xfe, 0x3e, 0x28, 0xf, 0x3b, 0xe3, 0xeb, 0xed, 0x73, 0x3d, 0x5c, 0xc5, 0x22, 
-0x42, 0x5c, 0xfd, 0x72, 0xa, 0xc9, 0xd5, 0xe5, 0xcd, 0xac, 0x5, 0x6, 0xfd, 0xcb, 0x1, 0x7e, 
-0x28, 0x5, 0x3e, 0xce, 0xc3, 0xfe, 0x19, 0xfd, 0xcb, 0x1, 0xf6, 0xef, 0x8d, 0x2c, 0x30, 0x16, 
-0xe7, 0xfe, 0x24, 0x20, 0x5, 0xfd, 0xcb, 0x1, 0xb6, 0xe7, 0xfe, 0x28, 0x20, 0x3c, 0xe7, 0xfe, 
-0x29, 0x28, 0x20, 0xef, 0x8d, 0x2c, 0xd2, 0x12, 0x19, 0xeb, 0xe7, 0xfe, 0x24, 0x20, 0x2, 0xeb, 
-0xe7, 0xeb, 0x1, 0x6, 0x0, 0xef, 0x55, 0x16, 0x23, 0x23, 0x36, 0xe, 0xfe, 0x2c, 0x20, 0x3, 
-0xe7, 0x18, 0xe0, 0xfe, 0x29, 0x20, 0x13, 0xe7, 0xfe, 0x3d, 0x20, 0xe, 0xe7, 0x3a, 0x3b, 0x5c, 
-0xf5, 0xef, 0xfb, 0x24, 0xf1, 0xfd, 0xae, 0x1, 0xe6, 0x40, 0xc2, 0x12, 0x19, 0xcd, 0xa1, 0x18, 
-0xc9, 0x21, 0xe, 0xec, 0x36, 0xff, 0xcd, 0x20, 0x1f, 0xef, 0xb0, 0x16, 0x2a, 0x59, 0x5c, 0x1, 
-0x3, 0x0, 0xef, 0x55, 0x16, 0x21, 0x6e, 0x1b, 0xed, 0x5b, 0x59, 0x5c, 0x1, 0x3, 0x0, 0xed, 
-0xb0, 0xcd, 0x6b, 0x2, 0xcd, 0x20, 0x1f, 0xef, 0xb0, 0x16, 0x2a, 0x59, 0x5c, 0x1, 0x1, 0x0, 
-0xef, 0x55, 0x16, 0x2a, 0x59, 0x5c, 0x36, 0xe1, 0xcd, 0x6b, 0x2, 0xcd, 0x53, 0x1b, 0xed, 0x7b, 
-0x3d, 0x5c, 0xe1, 0x21, 0x3, 0x13, 0xe5, 0x21, 0x13, 0x0, 0xe5, 0x21, 0x8, 0x0, 0xe5, 0x3e, 
-0x20, 0x32, 0x5c, 0x5b, 0xc3, 0x0, 0x5b, 0x21, 0x0, 0x0, 0xe5, 0x3e, 0x20, 0x32, 0x5c, 0x5b, 
-0xc3, 0x0, 0x5b, 0x2a, 0x4f, 0x5c, 0x11, 0x5, 0x0, 0x19, 0x11, 0xa, 0x0, 0xeb, 0x19, 0xeb, 
-0x1, 0x4, 0x0, 0xed, 0xb0, 0xfd, 0xcb, 0x30, 0x9e, 0xfd, 0xcb, 0x1, 0xa6, 0xc9, 0xef, 0x22, 
-0x22, 0x3e, 0x3, 0x18, 0x2, 0x3e, 0x2, 0xfd, 0x36, 0x2, 0x0, 0xef, 0x30, 0x25, 0x28, 0x3, 
-0xef, 0x1, 0x16, 0xef, 0x18, 0x0, 0xef, 0x70, 0x20, 0x38, 0x18, 0xef, 0x18, 0x0, 0xfe, 0x3b, 
-0x28, 0x4, 0xfe, 0x2c, 0x20, 0x8, 0xef, 0x20, 0x0, 0xcd, 0xe, 0x19, 0x18, 0x8, 0xef, 0xe6, 
-0x1c, 0x18, 0x3, 0xef, 0xde, 0x1c, 0xcd, 0xa1, 0x18, 0xef, 0x25, 0x18, 0xc9, 0xed, 0x73, 0x81, 
-0x5b, 0x31, 0xff, 0x5b, 0xcd, 0x97, 0x1c, 0xed, 0x4b, 0x72, 0x5b, 0x21, 0xf7, 0xff, 0xf6, 0xff, 
-0xed, 0x42, 0xcd, 0xf3, 0x1c, 0x1, 0x9, 0x0, 0x21, 0x71, 0x5b, 0xcd, 0xac, 0x1d, 0x2a, 0x74, 
-0x5b, 0xed, 0x4b, 0x72, 0x5b, 0xcd, 0xac, 0x1d, 0xcd, 0x56, 0x1d, 0x3e, 0x5, 0xcd, 0x64, 0x1c, 
-0xed, 0x7b, 0x81, 0x5b, 0xc9, 0xef, 0x18, 0x0, 0xfe, 0x21, 0xc2, 0x12, 0x19, 0xef, 0x20, 0x0, 
-0xcd, 0xa1, 0x18, 0x3e, 0x2, 0xef, 0x1, 0x16, 0xed, 0x73, 0x81, 0x5b, 0x31, 0xff, 0x5b, 0xcd, 
-0xd2, 0x20, 0x3e, 0x5, 0xcd, 0x64, 0x1c, 0xed, 0x7b, 0x81, 0x5b, 0xc9, 0xef, 0x18, 0x0, 0xfe, 
-0x21, 0xc2, 0x12, 0x19, 0xcd, 0x93, 0x13, 0xcd, 0xa1, 0x18, 0xed, 0x73, 0x81, 0x5b, 0x31, 0xff, 
-0x5b, 0xcd, 0x5f, 0x1f, 0x3e, 0x5, 0xcd, 0x64, 0x1c, 0xed, 0x7b, 0x81, 0x5b, 0xc9, 0xed, 0x73, 
-0x81, 0x5b, 0x31, 0xff, 0x5b, 0xcd, 0x35, 0x1d, 0x21, 0x71, 0x5b, 0x1, 0x9, 0x0, 0xcd, 0x37, 
-0x1e, 0x3e, 0x5, 0xcd, 0x64, 0x1c, 0xed, 0x7b, 0x81, 0x5b, 0xc9, 0xed, 0x73, 0x81, 0x5b, 0x31, 
-0xff, 0x5b, 0x42, 0x4b, 0xcd, 0x37, 0x1e, 0xcd, 0x56, 0x1d, 0x3e, 0x5, 0xcd, 0x64, 0x1c, 0xed, 
-0x7b, 0x81, 0x5b, 0xc9, 0xe5, 0xc5, 0x21, 0x81, 0x1c, 0x6, 0x0, 0x4f, 0x9, 0x4e, 0xf3, 0x3a, 
-0x5c, 0x5b, 0xe6, 0xf8, 0xb1, 0x32, 0x5c, 0x5b, 0x1, 0xfd, 0x7f, 0xed, 0x79, 0xfb, 0xc1, 0xe1, 
-0xc9, 0x1, 0x3, 0x4, 0x6, 0x7, 0x0, 0x11, 0x67, 0x5b, 0xdd, 0xe5, 0xe1, 0x6, 0xa, 0x1a, 
-0x13, 0xbe, 0x23, 0xc0, 0x10, 0xf9, 0xc9, 0xcd, 0x12, 0x1d, 0x28, 0x4, 0xcd, 0xac, 0x5, 0x20, 
-0xdd, 0xe5, 0x1, 0xec, 0x3f, 0xdd, 0x9, 0xdd, 0xe1, 0x30, 0x63, 0x21, 0xec, 0xff, 0x3e, 0xff, 
-0xcd, 0xf3, 0x1c, 0x21, 0x66, 0x5b, 0xcb, 0xd6, 0xdd, 0xe5, 0xd1, 0x21, 0x67, 0x5b, 0x1, 0xa, 
-0x0, 0xed, 0xb0, 0xdd, 0xcb, 0x13, 0xc6, 0xdd, 0x7e, 0xa, 0xdd, 0x77, 0x10, 0xdd, 0x7e, 0xb, 
-0xdd, 0x77, 0x11, 0xdd, 0x7e, 0xc, 0xdd, 0x77, 0x12, 0xaf, 0xdd, 0x77, 0xd, 0xdd, 0x77, 0xe, 
-0xdd, 0x77, 0xf, 0x3e, 0x5, 0xcd, 0x64, 0x1c, 0xdd, 0xe5, 0xe1, 0x1, 0xec, 0xff, 0x9, 0x22, 
-0x83, 0x5b, 0xc9, 0xed, 0x5b, 0x85, 0x5b, 0x8, 0x3a, 0x87, 0x5b, 0x4f, 0x8, 0xcb, 0x7f, 0x20, 
-0x9, 0x19, 0x89, 0x22, 0x85, 0x5b, 0x32, 0x87, 0x5b, 0xc9, 0x19, 0x89, 0x38, 0xf5, 0xcd, 0xac, 
-0x5, 0x3, 0x3e, 0x4, 0xcd, 0x64, 0x1c, 0xdd, 0x21, 0xec, 0xeb, 0xed, 0x5b, 0x83, 0x5b, 0xb7, 
-0xdd, 0xe5, 0xe1, 0xed, 0x52, 0xc8, 0xcd, 0x87, 0x1c, 0x20, 0x3, 0xf6, 0xff, 0xc9, 0x1, 0xec, 
-0xff, 0xdd, 0x9, 0x18, 0xe6, 0xcd, 0x12, 0x1d, 0x20, 0x4, 0xcd, 0xac, 0x5, 0x23, 0xdd, 0x7e, 
-0xa, 0xdd, 0x77, 0x10, 0xdd, 0x7e, 0xb, 0xdd, 0x77, 0x11, 0xdd, 0x7e, 0xc, 0xdd, 0x77, 0x12, 
-0x3e, 0x5, 0xcd, 0x64, 0x1c, 0xc9, 0x3e, 0x4, 0xcd, 0x64, 0x1c, 0xdd, 0xcb, 0x13, 0x46, 0xc8, 
-0xdd, 0xcb, 0x13, 0x86, 0x21, 0x66, 0x5b, 0xcb, 0x96, 0xdd, 0x6e, 0x10, 0xdd, 0x66, 0x11, 0xdd, 
-0x7e, 0x12, 0xdd, 0x5e, 0xa, 0xdd, 0x56, 0xb, 0xdd, 0x46, 0xc, 0xb7, 0xed, 0x52, 0x98, 0xcb, 
-0x14, 0xcb, 0x14, 0xcb, 0x2f, 0xcb, 0x1c, 0xcb, 0x2f, 0xcb, 0x1c, 0xdd, 0x75, 0xd, 0xdd, 0x74, 
-0xe, 0xdd, 0x77, 0xf, 0xdd, 0x6e, 0x10, 0xdd, 0x66, 0x11, 0xdd, 0x7e, 0x12, 0x1, 0xec, 0xff, 
-0xdd, 0x9, 0xdd, 0x75, 0xa, 0xdd, 0x74, 0xb, 0xdd, 0x77, 0xc, 0xc9, 0x78, 0xb1, 0xc8, 0xe5, 
-0x11, 0x0, 0xc0, 0xeb, 0xed, 0x52, 0x28, 0x1d, 0x38, 0x1b, 0xe5, 0xed, 0x42, 0x30, 0xd, 0x60, 
-0x69, 0xc1, 0xb7, 0xed, 0x42, 0xe3, 0x11, 0x0, 0xc0, 0xd5, 0x18, 0x28, 0xe1, 0xe1, 0x11, 0x0, 
-0x0, 0xd5, 0xd5, 0x18, 0x1f, 0x60, 0x69, 0x11, 0x20, 0x0, 0xb7, 0xed, 0x52, 0x38, 0x5, 0xe3, 
-0x42, 0x4b, 0x18, 0x5, 0xe1, 0x11, 0x0, 0x0, 0xd5, 0xc5, 0x11, 0x98, 0x5b, 0xed, 0xb0, 0xc1, 
-0xe5, 0x21, 0x98, 0x5b, 0x3e, 0x4, 0xcd, 0x64, 0x1c, 0xdd, 0x5e, 0x10, 0xdd, 0x56, 0x11, 0xdd, 
-0x7e, 0x12, 0xcd, 0x64, 0x1c, 0xed, 0xa0, 0x7a, 0xb3, 0x28, 0x19, 0x78, 0xb1, 0xc2, 0x5, 0x1e, 
-0x3e, 0x4, 0xcd, 0x64, 0x1c, 0xdd, 0x73, 0x10, 0xdd, 0x72, 0x11, 0x3e, 0x5, 0xcd, 0x64, 0x1c, 
-0xe1, 0xc1, 0x18, 0x88, 0x3e, 0x4, 0xcd, 0x64, 0x1c, 0xdd, 0x34, 0x12, 0xdd, 0x7e, 0x12, 0x11, 
-0x0, 0xc0, 0xcd, 0x64, 0x1c, 0x18, 0xd4, 0x78, 0xb1, 0xc8, 0xe5, 0x11, 0x0, 0xc0, 0xeb, 0xed, 
-0x52, 0x28, 0x24, 0x38, 0x22, 0xe5, 0xed, 0x42, 0x30, 0x12, 0x60, 0x69, 0xc1, 0xb7, 0xed, 0x42, 
-0xe3, 0x11, 0x0, 0x0, 0xd5, 0x11, 0x0, 0xc0, 0xd5, 0xeb, 0x18, 0x24, 0xe1, 0xe1, 0x11, 0x0, 
-0x0, 0xd5, 0xd5, 0xd5, 0xeb, 0x18, 0x19, 0x60, 0x69, 0x11, 0x20, 0x0, 0xb7, 0xed, 0x52, 0x38, 
-0x5, 0xe3, 0x42, 0x4b, 0x18, 0x5, 0xe1, 0x11, 0x0, 0x0, 0xd5, 0xc5, 0xe5, 0x11, 0x98, 0x5b, 
-0x3e, 0x4, 0xcd, 0x64, 0x1c, 0xdd, 0x6e, 0x10, 0xdd, 0x66, 0x11, 0xdd, 0x7e, 0x12, 0xcd, 0x64, 
-0x1c, 0xed, 0xa0, 0x7c, 0xb5, 0x28, 0x25, 0x78, 0xb1, 0xc2, 0x91, 0x1e, 0x3e, 0x4, 0xcd, 0x64, 
-0x1c, 0xdd, 0x75, 0x10, 0xdd, 0x74, 0x11, 0x3e, 0x5, 0xcd, 0x64, 0x1c, 0xd1, 0xc1, 0x21, 0x98, 
-0x5b, 0x78, 0xb1, 0x28, 0x2, 0xed, 0xb0, 0xeb, 0xc1, 0xc3, 0x37, 0x1e, 0x3e, 0x4, 0xcd, 0x64, 
-0x1c, 0xdd, 0x34, 0x12, 0xdd, 0x7e, 0x12, 0x21, 0x0, 0xc0, 0xcd, 0x64, 0x1c, 0x18, 0xc8, 0xf5, 
-0x3a, 0x5c, 0x5b, 0xf5, 0xe5, 0xd5, 0xc5, 0xdd, 0x21, 0x6a, 0x5b, 0xdd, 0x73, 0x10, 0xdd, 0x72, 
-0x11, 0xdd, 0x36, 0x12, 0x4, 0xcd, 0xac, 0x1d, 0x3e, 0x5, 0xcd, 0x64, 0x1c, 0xc1, 0xd1, 0xe1, 
-0x9, 0xeb, 0x9, 0xeb, 0xf1, 0x1, 0xfd, 0x7f, 0xf3, 0xed, 0x79, 0x32, 0x5c, 0x5b, 0xfb, 0x1, 
-0x0, 0x0, 0xf1, 0xc9, 0xf5, 0x3a, 0x5c, 0x5b, 0xf5, 0xe5, 0xd5, 0xc5, 0xdd, 0x21, 0x6a, 0x5b, 
-0xdd, 0x75, 0x10, 0xdd, 0x74, 0x11, 0xdd, 0x36, 0x12, 0x4, 0xeb, 0xcd, 0x37, 0x1e, 0x18, 0xc8, 
-0x8, 0x3e, 0x0, 0xf3, 0xcd, 0x3a, 0x1f, 0xf1, 0x22, 0x58, 0x5b, 0x2a, 0x81, 0x5b, 0xed, 0x73, 
-0x81, 0x5b, 0xf9, 0xfb, 0x2a, 0x58, 0x5b, 0xf5, 0x8, 0xc9, 0xc5, 0x1, 0xfd, 0x7f, 0xed, 0x79, 
-0x32, 0x5c, 0x5b, 0xc1, 0xc9, 0x8, 0xf3, 0xf1, 0x22, 0x58, 0x5b, 0x2a, 0x81, 0x5b, 0xed, 0x73, 
-0x81, 0x5b, 0xf9, 0x2a, 0x58, 0x5b, 0xf5, 0x3e, 0x7, 0xcd, 0x3a, 0x1f, 0xfb, 0x8, 0xc9, 0xcd, 
-0x12, 0x1d, 0x20, 0x4, 0xcd, 0xac, 0x5, 0x23, 0xdd, 0x6e, 0xd, 0xdd, 0x66, 0xe, 0xdd, 0x7e, 
-0xf, 0xcd, 0xf3, 0x1c, 0xfd, 0xe5, 0xfd, 0x2a, 0x83, 0x5b, 0x1, 0xec, 0xff, 0xdd, 0x9, 0xfd, 
-0x6e, 0xa, 0xfd, 0x66, 0xb, 0xfd, 0x7e, 0xc, 0xfd, 0xe1, 0xdd, 0x5e, 0xa, 0xdd, 0x56, 0xb, 
-0xdd, 0x46, 0xc, 0xb7, 0xed, 0x52, 0x98, 0xcb, 0x14, 0xcb, 0x14, 0xcb, 0x2f, 0xcb, 0x1c, 0xcb, 
-0x2f, 0xcb, 0x1c, 0x1, 0x14, 0x0, 0xdd, 0x9, 0xdd, 0x75, 0x10, 0xdd, 0x74, 0x11, 0xdd, 0x77, 
-0x12, 0x1, 0xec, 0xff, 0xdd, 0x9, 0xdd, 0x6e, 0xa, 0xdd, 0x66, 0xb, 0xdd, 0x56, 0xc, 0x1, 
-0x14, 0x0, 0xdd, 0x9, 0x7a, 0xcd, 0x64, 0x1c, 0x3a, 0x5c, 0x5b, 0x5f, 0x1, 0xfd, 0x7f, 0x3e, 
-0x7, 0xf3, 0xed, 0x79, 0xd9, 0xdd, 0x6e, 0xa, 0xdd, 0x66, 0xb, 0xdd, 0x56, 0xc, 0x7a, 0xcd, 
-0x64, 0x1c, 0x3a, 0x5c, 0x5b, 0x5f, 0x1, 0xfd, 0x7f, 0xd9, 0x3e, 0x7, 0xf3, 0xed, 0x79, 0xdd, 
-0x7e, 0x10, 0xd6, 0x1, 0xdd, 0x77, 0x10, 0x30, 0x14, 0xdd, 0x7e, 0x11, 0xd6, 0x1, 0xdd, 0x77, 
-0x11, 0x30, 0xa, 0xdd, 0x7e, 0x12, 0xd6, 0x1, 0xdd, 0x77, 0x12, 0x38, 0x31, 0xed, 0x59, 0x7e, 
-0x2c, 0x20, 0x11, 0x24, 0x20, 0xe, 0x8, 0x14, 0x7a, 0xcd, 0x64, 0x1c, 0x3a, 0x5c, 0x5b, 0x5f, 
-0x21, 0x0, 0xc0, 0x8, 0xd9, 0xf3, 0xed, 0x59, 0x77, 0x2c, 0x20, 0xf, 0x24, 0x20, 0xc, 0x14, 
-0x7a, 0xcd, 0x64, 0x1c, 0x3a, 0x5c, 0x5b, 0x5f, 0x21, 0x0, 0xc0, 0xd9, 0x18, 0xac, 0x3e, 0x4, 
-0xcd, 0x64, 0x1c, 0x3e, 0x0, 0x21, 0x14, 0x0, 0xcd, 0xf3, 0x1c, 0xdd, 0x5e, 0xd, 0xdd, 0x56, 
-0xe, 0xdd, 0x4e, 0xf, 0x7a, 0x7, 0xcb, 0x11, 0x7, 0xcb, 0x11, 0x7a, 0xe6, 0x3f, 0x57, 0xdd, 
-0xe5, 0xd5, 0x11, 0xec, 0xff, 0xdd, 0x19, 0xd1, 0xdd, 0x6e, 0xa, 0xdd, 0x66, 0xb, 0xdd, 0x7e, 
-0xc, 0xb7, 0xed, 0x52, 0x91, 0xcb, 0x74, 0x20, 0x3, 0xcb, 0xf4, 0x3d, 0xdd, 0x75, 0xa, 0xdd, 
-0x74, 0xb, 0xdd, 0x77, 0xc, 0xdd, 0x6e, 0x10, 0xdd, 0x66, 0x11, 0xdd, 0x7e, 0x12, 0xb7, 0xed, 
-0x52, 0x91, 0xcb, 0x74, 0x20, 0x3, 0xcb, 0xf4, 0x3d, 0xdd, 0x75, 0x10, 0xdd, 0x74, 0x11, 0xdd, 
-0x77, 0x12, 0xdd, 0xe5, 0xe1, 0xd5, 0xed, 0x5b, 0x83, 0x5b, 0xb7, 0xed, 0x52, 0xd1, 0x20, 0xb1, 
-0xed, 0x5b, 0x83, 0x5b, 0xe1, 0xe5, 0xb7, 0xed, 0x52, 0x44, 0x4d, 0xe1, 0xe5, 0x11, 0x14, 0x0, 
-0x19, 0xeb, 0xe1, 0x1b, 0x2b, 0xed, 0xb8, 0x2a, 0x83, 0x5b, 0x11, 0x14, 0x0, 0x19, 0x22, 0x83, 
-0x5b, 0xc9, 0x3e, 0x4, 0xcd, 0x64, 0x1c, 0x21, 0x21, 0x21, 0x1, 0x2b, 0x21, 0xdd, 0x21, 0xec, 
-0xeb, 0xcd, 0xd6, 0x5, 0xdd, 0xe5, 0xe3, 0xed, 0x5b, 0x83, 0x5b, 0xb7, 0xed, 0x52, 0xe1, 0x28, 
-0x20, 0x54, 0x5d, 0xe5, 0xc5, 0xcd, 0x8a, 0x1c, 0xc1, 0xe1, 0x30, 0xe, 0x50, 0x59, 0xe5, 0xc5, 
-0xcd, 0x8a, 0x1c, 0xc1, 0xe1, 0x38, 0x3, 0xdd, 0xe5, 0xc1, 0x11, 0xec, 0xff, 0xdd, 0x19, 0x18, 
-0xd0, 0xe5, 0x21, 0x2b, 0x21, 0xb7, 0xed, 0x42, 0xe1, 0xc8, 0x60, 0x69, 0xcd, 0x35, 0x21, 0x18, 
-0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xc5, 0xe1, 0x11, 0x67, 0x5b, 0x1, 0xa, 0x0, 0xed, 0xb0, 
-0x3e, 0x5, 0xcd, 0x64, 0x1c, 0x2a, 0x81, 0x5b, 0xed, 0x73, 0x81, 0x5b, 0xf9, 0x21, 0x67, 0x5b, 
-0x6, 0xa, 0x7e, 0xe5, 0xc5, 0xef, 0x10, 0x0, 0xc1, 0xe1, 0x23, 0x10, 0xf5, 0x3e, 0xd, 0xef, 
-0x10, 0x0, 0xef, 0x4d, 0xd, 0x2a, 0x81, 0x5b, 0xed, 0x73, 0x81, 0x5b, 0xf9, 0x3e, 0x4, 0xcd, 
-0x64, 0x1c, 0xe1, 0xc9, 0x3e, 0x3, 0x18, 0x2, 0x3e, 0x2, 0xef, 0x30, 0x25, 0x28, 0x3, 0xef, 
-0x1, 0x16, 0xef, 0x4d, 0xd, 0xef, 0xdf, 0x1f, 0xcd, 0xa1, 0x18, 0xc9, 0xef, 0x30, 0x25, 0x28, 
-0x8, 0x3e, 0x1, 0xef, 0x1, 0x16, 0xef, 0x6e, 0xd, 0xfd, 0x36, 0x2, 0x1, 0xef, 0xc1, 0x20, 
-0xcd, 0xa1, 0x18, 0xef, 0xa0, 0x20, 0xc9, 0xc3, 0xf0, 0x8, 0xf3, 0xc3, 0x9d, 0x1, 0xdf, 0xfe, 
-0x2c, 0x20, 0x38, 0xe7, 0xef, 0x82, 0x1c, 0xcd, 0xa1, 0x18, 0xef, 0x2d, 0x23, 0xc9, 0xdf, 0xfe, 
-0x2c, 0x28, 0x7, 0xcd, 0xa1, 0x18, 0xef, 0x77, 0x24, 0xc9, 0xe7, 0xef, 0x82, 0x1c, 0xcd, 0xa1, 
-0x18, 0xef, 0x94, 0x23, 0xc9, 0xef, 0xb2, 0x28, 0x20, 0x11, 0xef, 0x30, 0x25, 0x20, 0x8, 0xcb, 
-0xb1, 0xef, 0x96, 0x29, 0xcd, 0xa1, 0x18, 0xef, 0x15, 0x2c, 0xc9, 0xcd, 0xac, 0x5, 0xb, 0xfd, 
-0xcb, 0x30, 0x46, 0xc8, 0xef, 0xaf, 0xd, 0xc9, 0x21, 0xfe, 0xff, 0x22, 0x45, 0x5c, 0xfd, 0xcb, 
-0x1, 0xbe, 0xcd, 0x8e, 0x22, 0xef, 0xfb, 0x24, 0xfd, 0xcb, 0x1, 0x76, 0x28, 0x2c, 0xdf, 0xfe, 
-0xd, 0x20, 0x27, 0xfd, 0xcb, 0x1, 0xfe, 0xcd, 0x8e, 0x22, 0x21, 0x21, 0x3, 0x22, 0x8b, 0x5b, 
-0xef, 0xfb, 0x24, 0xfd, 0xcb, 0x1, 0x76, 0x28, 0x11, 0x11, 0x8d, 0x5b, 0x2a, 0x65, 0x5c, 0x1, 
-0x5, 0x0, 0xb7, 0xed, 0x42, 0xed, 0xb0, 0xc3, 0x3e, 0x22, 0xcd, 0xac, 0x5, 0x19, 0x3e, 0xd, 
-0xcd, 0x6f, 0x22, 0x1, 0x1, 0x0, 0xef, 0x30, 0x0, 0x22, 0x5b, 0x5c, 0xe5, 0x2a, 0x51, 0x5c, 
-0xe5, 0x3e, 0xff, 0xef, 0x1, 0x16, 0xef, 0xe3, 0x2d, 0xe1, 0xef, 0x15, 0x16, 0xd1, 0x2a, 0x5b, 
-0x5c, 0xa7, 0xed, 0x52, 0x1a, 0xcd, 0x6f, 0x22, 0x13, 0x2b, 0x7c, 0xb5, 0x20, 0xf6, 0xc9, 0xe5, 
-0xd5, 0xcd, 0x45, 0x1f, 0x21, 0xd, 0xec, 0xcb, 0x9e, 0xf5, 0x3e, 0x2, 0xef, 0x1, 0x16, 0xf1, 
-0xcd, 0x69, 0x26, 0x21, 0xd, 0xec, 0xcb, 0x9e, 0xcd, 0x20, 0x1f, 0xd1, 0xe1, 0xc9, 0x2a, 0x59, 
-0x5c, 0x2b, 0x22, 0x5d, 0x5c, 0xe7, 0xc9, 0xcd, 0x8e, 0x22, 0xfe, 0xf1, 0xc0, 0x2a, 0x5d, 0x5c, 
-0x7e, 0x23, 0xfe, 0xd, 0xc8, 0xfe, 0x3a, 0x20, 0xf7, 0xb7, 0xc9, 0x47, 0x21, 0xbd, 0x22, 0x7e, 
-0x23, 0xb7, 0x28, 0x5, 0xb8, 0x20, 0xf8, 0x78, 0xc9, 0xf6, 0xff, 0x78, 0xc9, 0x2b, 0x2d, 0x2a, 
-0x2f, 0x5e, 0x3d, 0x3e, 0x3c, 0xc7, 0xc8, 0xc9, 0xc5, 0xc6, 0x0, 0xfe, 0xa5, 0x38, 0xe, 0xfe, 
-0xc4, 0x30, 0xa, 0xfe, 0xac, 0x28, 0x6, 0xfe, 0xad, 0x28, 0x2, 0xbf, 0xc9, 0xfe, 0xa5, 0xc9, 
-0x47, 0xf6, 0x20, 0xfe, 0x61, 0x38, 0x6, 0xfe, 0x7b, 0x30, 0x2, 0xbf, 0xc9, 0x78, 0xfe, 0x2e, 
-0xc8, 0xcd, 0xa, 0x23, 0x20, 0x11, 0xe7, 0xcd, 0xa, 0x23, 0x28, 0xfa, 0xfe, 0x2e, 0xc8, 0xfe, 
-0x45, 0xc8, 0xfe, 0x65, 0xc8, 0x18, 0xa4, 0xf6, 0xff, 0xc9, 0xfe, 0x30, 0x38, 0x6, 0xfe, 0x3a, 
-0x30, 0x2, 0xbf, 0xc9, 0xfe, 0x30, 0xc9, 0x6, 0x0, 0xdf, 0xc5, 0xef, 0x8c, 0x1c, 0xc1, 0x4, 
-0xfe, 0x2c, 0x20, 0x3, 0xe7, 0x18, 0xf3, 0x78, 0xfe, 0x9, 0x38, 0x4, 0xcd, 0xac, 0x5, 0x2b, 
-0xcd, 0xa1, 0x18, 0xc3, 0x85, 0x9, 0x21, 0xff, 0x5b, 0x22, 0x81, 0x5b, 0xcd, 0x45, 0x1f, 0xc3, 
-0xcb, 0x25, 0xa7, 0xed, 0x52, 0x44, 0x4d, 0x19, 0xeb, 0xc9, 0x1, 0x1, 0x0, 0xe5, 0xd5, 0xcd, 
-0x58, 0x23, 0xd1, 0xe1, 0xef, 0x55, 0x16, 0xc9, 0x2a, 0x65, 0x5c, 0x9, 0x38, 0xa, 0xeb, 0x21, 
-0x82, 0x0, 0x19, 0x38, 0x3, 0xed, 0x72, 0xd8, 0xfd, 0x36, 0x0, 0x3, 0xc3, 0x21, 0x3, 0x87, 
-0x87, 0x6f, 0x26, 0x0, 0x29, 0x29, 0x29, 0xc9, 0x21, 0x0, 0x0, 0x39, 0xed, 0x5b, 0x65, 0x5c, 
-0xb7, 0xed, 0x52, 0xc9, 0xfd, 0xcb, 0xc7, 0x86, 0xcd, 0x6f, 0x23, 0xe5, 0xed, 0x5b, 0x24, 0xff, 
-0x19, 0x54, 0x5d, 0xe3, 0xe5, 0xd5, 0x11, 0x0, 0x58, 0x19, 0xeb, 0xe1, 0x1, 0x20, 0x0, 0x3a, 
-0x8f, 0x5c, 0xcd, 0x9b, 0x24, 0xe1, 0x7c, 0x26, 0x0, 0x87, 0x87, 0x87, 0xc6, 0x40, 0x57, 0x5c, 
-0x19, 0xeb, 0xe1, 0x6, 0x20, 0xc3, 0xe1, 0x23, 0x16, 0xff, 0xcd, 0x6f, 0x23, 0x7a, 0xed, 0x5b, 
-0x24, 0xff, 0x19, 0x5d, 0x54, 0x13, 0x77, 0xb, 0xed, 0xb0, 0xc9, 0xcd, 0x88, 0x24, 0x11, 0x0, 
-0x40, 0x2a, 0x24, 0xff, 0x43, 0xcd, 0xe1, 0x23, 0x16, 0x48, 0xcd, 0xe1, 0x23, 0x16, 0x50, 0x6, 
-0xc0, 0x7e, 0xe5, 0xd5, 0xfe, 0xfe, 0x38, 0x4, 0xd6, 0xfe, 0x18, 0x36, 0xfe, 0x20, 0x30, 0x7, 
-0x21, 0x27, 0x25, 0xa7, 0x8, 0x18, 0x34, 0xfe, 0x80, 0x30, 0xe, 0xcd, 0x71, 0x23, 0xed, 0x5b, 
-0x36, 0x5c, 0x19, 0xd1, 0xcd, 0x28, 0xff, 0x18, 0x47, 0xfe, 0x90, 0x30, 0x4, 0xd6, 0x7f, 0x18, 
-0x11, 0xd6, 0x90, 0xcd, 0x71, 0x23, 0xd1, 0xcd, 0x20, 0x1f, 0xd5, 0xed, 0x5b, 0x7b, 0x5c, 0x37, 
-0x18, 0x7, 0x11, 0x2f, 0x25, 0xcd, 0x71, 0x23, 0xa7, 0x8, 0x19, 0xd1, 0x4a, 0x7e, 0x12, 0x23, 
-0x14, 0x7e, 0x12, 0x23, 0x14, 0x7e, 0x12, 0x23, 0x14, 0x7e, 0x12, 0x23, 0x14, 0x7e, 0x12, 0x23, 
-0x14, 0x7e, 0x12, 0x23, 0x14, 0x7e, 0x12, 0x23, 0x14, 0x7e, 0x12, 0x51, 0x8, 0xdc, 0x45, 0x1f, 
-0xe1, 0x23, 0x13, 0x10, 0x8c, 0xc9, 0xc5, 0xf3, 0x1, 0xfd, 0x7f, 0x3a, 0x5c, 0x5b, 0xee, 0x10, 
-0xed, 0x79, 0xfb, 0x8, 0x8, 0xf3, 0xe, 0xfd, 0xee, 0x10, 0xed, 0x79, 0xfb, 0xc1, 0xc9, 0x21, 
-0x56, 0x24, 0x11, 0x28, 0xff, 0x1, 0xe, 0x0, 0xed, 0xb0, 0xe5, 0x21, 0x2c, 0x24, 0xe, 0x20, 
-0xed, 0xb0, 0xe1, 0xe, 0xb, 0xed, 0xb0, 0xc9, 0xfd, 0xcb, 0xc7, 0x86, 0x11, 0x0, 0x58, 0x1, 
-0xc0, 0x2, 0x2a, 0x24, 0xff, 0x3a, 0x8d, 0x5c, 0x32, 0x8f, 0x5c, 0x8, 0xc5, 0x7e, 0xfe, 0xff, 
-0x20, 0x8, 0x3a, 0x8d, 0x5c, 0x12, 0x23, 0x13, 0x18, 0x5d, 0x8, 0x12, 0x13, 0x8, 0x23, 0xfe, 
-0x15, 0x30, 0x54, 0xfe, 0x10, 0x38, 0x50, 0x2b, 0x20, 0x8, 0x23, 0x7e, 0x4f, 0x8, 0xe6, 0xf8, 
-0x18, 0x43, 0xfe, 0x11, 0x20, 0xb, 0x23, 0x7e, 0x87, 0x87, 0x87, 0x4f, 0x8, 0xe6, 0xc7, 0x18, 
-0x34, 0xfe, 0x12, 0x20, 0x9, 0x23, 0x7e, 0xf, 0x4f, 0x8, 0xe6, 0x7f, 0x18, 0x27, 0xfe, 0x13, 
-0x20, 0xa, 0x23, 0x7e, 0xf, 0xf, 0x4f, 0x8, 0xe6, 0xbf, 0x18, 0x19, 0xfe, 0x14, 0x23, 0x20, 
-0x16, 0x4e, 0x3a, 0x1, 0x5c, 0xa9, 0x1f, 0x30, 0xe, 0x3e, 0x1, 0xfd, 0xae, 0xc7, 0x32, 0x1, 
-0x5c, 0x8, 0xcd, 0x13, 0x25, 0xb1, 0x8, 0xc1, 0xb, 0x78, 0xb1, 0xc2, 0x9c, 0x24, 0x8, 0x32, 
-0x8f, 0x5c, 0xc9, 0x47, 0xe6, 0xc0, 0x4f, 0x78, 0x87, 0x87, 0x87, 0xe6, 0x38, 0xb1, 0x4f, 0x78, 
-0x1f, 0x1f, 0x1f, 0xe6, 0x7, 0xb1, 0xc9, 0x0, 0x3c, 0x62, 0x60, 0x6e, 0x62, 0x3e, 0x0, 0x0, 
-0x6c, 0x10, 0x54, 0xba, 0x38, 0x54, 0x82, 0x15, 0xb, 0x94, 0x2a, 0xa, 0xb5, 0x2a, 0x8, 0xd7, 
-0x2a, 0x9, 0xe3, 0x2a, 0xad, 0x4f, 0x2a, 0xac, 0x25, 0x2a, 0xaf, 0xd4, 0x29, 0xae, 0xe1, 0x29, 
-0xa6, 0x83, 0x29, 0xa5, 0xab, 0x29, 0xa8, 0x87, 0x2a, 0xa7, 0x7a, 0x2a, 0xaa, 0x1b, 0x29, 0xc, 
-0x2b, 0x29, 0xb3, 0x17, 0x30, 0xb4, 0xbc, 0x2f, 0xb0, 0x72, 0x30, 0xb1, 0x3e, 0x30, 0xd, 0x44, 
-0x29, 0xa9, 0x9b, 0x26, 0x7, 0x4, 0x27, 0x4, 0xb, 0x2e, 0x27, 0xa, 0x31, 0x27, 0x7, 0x17, 
-0x27, 0xd, 0x17, 0x27, 0xcd, 0xbe, 0x28, 0x21, 0x0, 0x0, 0x22, 0x9a, 0xfc, 0x3e, 0x82, 0x32, 
-0xd, 0xec, 0x21, 0x0, 0x0, 0x22, 0x49, 0x5c, 0xcd, 0xbc, 0x35, 0xcd, 0x5e, 0x36, 0xc9, 0x21, 
-0xff, 0x5b, 0x22, 0x81, 0x5b, 0xcd, 0x45, 0x1f, 0x3e, 0x2, 0xef, 0x1, 0x16, 0x21, 0x44, 0x27, 
-0x22, 0xea, 0xf6, 0x21, 0x54, 0x27, 0x22, 0xec, 0xf6, 0xe5, 0x21, 0xd, 0xec, 0xcb, 0xce, 0xcb, 
-0xa6, 0x2b, 0x36, 0x0, 0xe1, 0xcd, 0xa8, 0x36, 0xc3, 0x53, 0x26, 0xdd, 0x21, 0x6c, 0xfd, 0x21, 
-0xff, 0x5b, 0x22, 0x81, 0x5b, 0xcd, 0x45, 0x1f, 0x3e, 0x2, 0xef, 0x1, 0x16, 0xcd, 0x68, 0x36, 
-0x21, 0x3b, 0x5c, 0xcb, 0x6e, 0x28, 0xfc, 0x21, 0xd, 0xec, 0xcb, 0x9e, 0xcb, 0x76, 0x20, 0x14, 
-0x3a, 0xe, 0xec, 0xfe, 0x4, 0x28, 0xa, 0xfe, 0x0, 0xc2, 0xc7, 0x28, 0xcd, 0x48, 0x38, 0x18, 
-0x3, 0xcd, 0x4d, 0x38, 0xcd, 0xd6, 0x30, 0xcd, 0x22, 0x32, 0x3a, 0xe, 0xec, 0xfe, 0x4, 0x28, 
-0x42, 0x2a, 0x49, 0x5c, 0x7c, 0xb5, 0x20, 0x15, 0x2a, 0x53, 0x5c, 0xed, 0x4b, 0x4b, 0x5c, 0xa7, 
-0xed, 0x42, 0x20, 0x6, 0x21, 0x0, 0x0, 0x22, 0x8, 0xec, 0x2a, 0x8, 0xec, 0xcd, 0x20, 0x1f, 
-0xef, 0x6e, 0x19, 0xef, 0x95, 0x16, 0xcd, 0x45, 0x1f, 0xed, 0x53, 0x49, 0x5c, 0x21, 0xd, 0xec, 
-0xcb, 0x6e, 0x20, 0xf, 0x21, 0x0, 0x0, 0x22, 0x6, 0xec, 0xcd, 0x2f, 0x15, 0xcd, 0xf2, 0x29, 
-0xcd, 0x44, 0x29, 0x31, 0xff, 0x5b, 0xcd, 0x68, 0x36, 0xcd, 0x7f, 0x36, 0xf5, 0x3a, 0x39, 0x5c, 
-0xcd, 0xec, 0x26, 0xf1, 0xcd, 0x69, 0x26, 0x18, 0xea, 0x21, 0xd, 0xec, 0xcb, 0x4e, 0xf5, 0x21, 
-0x77, 0x25, 0x20, 0x3, 0x21, 0x37, 0x25, 0xcd, 0xce, 0x3f, 0x20, 0x5, 0xd4, 0xe7, 0x26, 0xf1, 
-0xc9, 0xf1, 0x28, 0x5, 0xaf, 0x32, 0x41, 0x5c, 0xc9, 0x21, 0xd, 0xec, 0xcb, 0x46, 0x28, 0x4, 
-0xcd, 0xe7, 0x26, 0xc9, 0xfe, 0xa3, 0x30, 0xbb, 0xc3, 0xf1, 0x28, 0x3a, 0xe, 0xec, 0xfe, 0x4, 
-0xc8, 0xcd, 0x30, 0x16, 0x21, 0xd, 0xec, 0xcb, 0x9e, 0x7e, 0xee, 0x40, 0x77, 0xe6, 0x40, 0x28, 
-0x5, 0xcd, 0xbb, 0x26, 0x18, 0x3, 0xcd, 0xce, 0x26, 0x37, 0xc9, 0xcd, 0x81, 0x38, 0x21, 0xd, 
-0xec, 0xcb, 0xf6, 0xcd, 0x2d, 0x2e, 0xcd, 0x88, 0x3a, 0xcd, 0xdf, 0x28, 0x18, 0xb, 0x21, 0xd, 
-0xec, 0xcb, 0xb6, 0xcd, 0xbe, 0x28, 0xcd, 0x48, 0x38, 0x2a, 0x9a, 0xfc, 0x7c, 0xb5, 0xc4, 0x4a, 
-0x33, 0xcd, 0x2f, 0x15, 0xc3, 0xf2, 0x29, 0x3a, 0x38, 0x5c, 0xcb, 0x3f, 0xdd, 0xe5, 0x16, 0x0, 
-0x5f, 0x21, 0x80, 0xc, 0xef, 0xb5, 0x3, 0xdd, 0xe1, 0xc9, 0xdd, 0xe5, 0x11, 0x30, 0x0, 0x21, 
-0x0, 0x3, 0x18, 0xf0, 0xcd, 0xec, 0x29, 0x21, 0xd, 0xec, 0xcb, 0xce, 0x2b, 0x36, 0x0, 0x2a, 
-0xec, 0xf6, 0xcd, 0xa8, 0x36, 0x37, 0xc9, 0x21, 0xd, 0xec, 0xcb, 0x8e, 0x2b, 0x7e, 0x2a, 0xea, 
-0xf6, 0xe5, 0xf5, 0xcd, 0x3e, 0x37, 0xf1, 0xe1, 0xcd, 0xce, 0x3f, 0xc3, 0xf2, 0x29, 0x37, 0x18, 
-0x1, 0xa7, 0x21, 0xc, 0xec, 0x7e, 0xe5, 0x2a, 0xec, 0xf6, 0xdc, 0xa7, 0x37, 0xd4, 0xb6, 0x37, 
-0xe1, 0x77, 0x37, 0xc9, 0x5, 0x0, 0x31, 0x28, 0x1, 0x6c, 0x28, 0x2, 0x85, 0x28, 0x3, 0x47, 
-0x1b, 0x4, 0x16, 0x28, 0x6, 0x31, 0x32, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0xff, 0x54, 0x61, 
-0x70, 0x65, 0x20, 0x4c, 0x6f, 0x61, 0x64, 0x65, 0xf2, 0x31, 0x32, 0x38, 0x20, 0x42, 0x41, 0x53, 
-0x49, 0xc3, 0x43, 0x61, 0x6c, 0x63, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0xf2, 0x34, 0x38, 0x20, 0x42, 
-0x41, 0x53, 0x49, 0xc3, 0x54, 0x61, 0x70, 0x65, 0x20, 0x54, 0x65, 0x73, 0x74, 0x65, 0xf2, 0xa0, 
-0x5, 0x0, 0x42, 0x27, 0x1, 0x51, 0x28, 0x2, 0x11, 0x28, 0x3, 0x62, 0x28, 0x4, 0x1c, 0x28, 
-0x6, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0xff, 0x31, 0x32, 0x38, 0x20, 0x42, 0x41, 
-0x53, 0x49, 0xc3, 0x52, 0x65, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0xf2, 0x53, 0x63, 0x72, 0x65, 0x65, 
-0xee, 0x50, 0x72, 0x69, 0x6e, 0xf4, 0x45, 0x78, 0x69, 0xf4, 0xa0, 0x2, 0x0, 0x42, 0x27, 0x1, 
-0x1c, 0x28, 0x3, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0xff, 0x43, 0x61, 0x6c, 0x63, 
-0x75, 0x6c, 0x61, 0x74, 0x6f, 0xf2, 0x45, 0x78, 0x69, 0xf4, 0xa0, 0x16, 0x1, 0x0, 0x10, 0x0, 
-0x11, 0x7, 0x13, 0x0, 0x54, 0x6f, 0x20, 0x63, 0x61, 0x6e, 0x63, 0x65, 0x6c, 0x20, 0x2d, 0x20, 
-0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x42, 0x52, 0x45, 0x41, 0x4b, 0x20, 0x74, 0x77, 0x69, 0x63, 
-0xe5, 0xcd, 0x9b, 0x26, 0x18, 0x5e, 0xcd, 0x57, 0x38, 0xcd, 0xe9, 0x3b, 0x21, 0xd, 0xec, 0xcb, 
-0xb6, 0xcd, 0xbe, 0x28, 0x6, 0x0, 0x16, 0x17, 0xcd, 0x5e, 0x3b, 0xcd, 0x20, 0x1f, 0xc3, 0x9f, 
-0x25, 0xcd, 0x52, 0x38, 0x21, 0x3c, 0x5c, 0xcb, 0xc6, 0x11, 0xeb, 0x27, 0xcd, 0x7d, 0x5, 0xcb, 
-0x86, 0xcb, 0xf6, 0x3e, 0x7, 0x32, 0xe, 0xec, 0x1, 0x0, 0x0, 0xcd, 0x2b, 0x37, 0xc3, 0xf1, 
-0x1a, 0xcd, 0x88, 0x38, 0xd4, 0xe7, 0x26, 0x21, 0x0, 0x0, 0x22, 0x49, 0x5c, 0x22, 0x8, 0xec, 
-0x18, 0x3, 0xcd, 0x14, 0x1b, 0x21, 0xd, 0xec, 0xcb, 0x76, 0x20, 0x8, 0x21, 0x3c, 0x5c, 0xcb, 
-0x86, 0xcd, 0x48, 0x38, 0x21, 0xd, 0xec, 0xcb, 0xae, 0xcb, 0xa6, 0x3e, 0x0, 0x21, 0x90, 0x27, 
-0x11, 0xa0, 0x27, 0x18, 0x2c, 0x21, 0xd, 0xec, 0xcb, 0xee, 0xcb, 0xe6, 0xcb, 0xb6, 0xcd, 0xbe, 
-0x28, 0xcd, 0x4d, 0x38, 0x3e, 0x4, 0x32, 0xe, 0xec, 0x21, 0x0, 0x0, 0x22, 0x49, 0x5c, 0xcd, 
-0x2f, 0x15, 0x1, 0x0, 0x0, 0x78, 0xcd, 0xf8, 0x29, 0x3e, 0x4, 0x21, 0xcb, 0x27, 0x11, 0xd2, 
-0x27, 0x32, 0xe, 0xec, 0x22, 0xea, 0xf6, 0xed, 0x53, 0xec, 0xf6, 0xc3, 0x4, 0x26, 0xcd, 0x1f, 
-0x2e, 0xcd, 0x7f, 0x3a, 0xc3, 0xe8, 0x28, 0x6, 0x0, 0x16, 0x17, 0xcd, 0x5e, 0x3b, 0xc3, 0xad, 
-0x25, 0x6, 0x0, 0x0, 0x0, 0x4, 0x10, 0x14, 0x6, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x21, 
-0xd8, 0x28, 0x11, 0xee, 0xf6, 0xc3, 0xba, 0x3f, 0x21, 0xd1, 0x28, 0x11, 0xee, 0xf6, 0xc3, 0xba, 
-0x3f, 0x21, 0xd, 0xec, 0xb7, 0xb7, 0xcb, 0x46, 0xc2, 0xf2, 0x29, 0xcb, 0xbe, 0xcb, 0xde, 0xe5, 
-0xf5, 0xcd, 0xec, 0x29, 0xf1, 0xf5, 0xcd, 0x81, 0x2e, 0xf1, 0x78, 0xcd, 0x78, 0x2b, 0xe1, 0xcb, 
-0xfe, 0xd2, 0xf2, 0x29, 0x78, 0xda, 0xf8, 0x29, 0xc3, 0xf2, 0x29, 0x21, 0xd, 0xec, 0xcb, 0xde, 
-0xcd, 0xec, 0x29, 0xcd, 0x12, 0x2f, 0x37, 0x78, 0xc3, 0xf8, 0x29, 0x21, 0xd, 0xec, 0xcb, 0x86, 
-0xcb, 0xde, 0xcd, 0xec, 0x29, 0xcd, 0x5b, 0x2b, 0x3f, 0xda, 0xf2, 0x29, 0xcd, 0x12, 0x2f, 0x37, 
-0x78, 0xc3, 0xf8, 0x29, 0xcd, 0xec, 0x29, 0xf5, 0xcd, 0xb4, 0x30, 0xc5, 0x6, 0x0, 0xcd, 0x41, 
-0x2e, 0xc1, 0x38, 0xa, 0x21, 0x20, 0x0, 0x19, 0x7e, 0x2f, 0xe6, 0x9, 0x28, 0x1c, 0x3a, 0xd, 
-0xec, 0xcb, 0x5f, 0x28, 0x5, 0xcd, 0x8e, 0x2c, 0x30, 0x15, 0xcd, 0x4c, 0x2c, 0xcd, 0x78, 0x2b, 
-0xcd, 0xce, 0x2e, 0x6, 0x0, 0xf1, 0x37, 0xc3, 0xf8, 0x29, 0xf1, 0x37, 0xc3, 0xf2, 0x29, 0xf1, 
-0xc3, 0xf2, 0x29, 0x3a, 0xe, 0xec, 0xfe, 0x4, 0xc8, 0xcd, 0xec, 0x29, 0x21, 0x0, 0x0, 0xcd, 
-0x20, 0x1f, 0xef, 0x6e, 0x19, 0xef, 0x95, 0x16, 0xcd, 0x45, 0x1f, 0xed, 0x53, 0x49, 0x5c, 0x3e, 
-0xf, 0xcd, 0x96, 0x3a, 0xcd, 0x2f, 0x15, 0x37, 0xc3, 0xf2, 0x29, 0x3a, 0xe, 0xec, 0xfe, 0x4, 
-0xc8, 0xcd, 0xec, 0x29, 0x21, 0xf, 0x27, 0xcd, 0x20, 0x1f, 0xef, 0x6e, 0x19, 0xeb, 0xef, 0x95, 
-0x16, 0xcd, 0x45, 0x1f, 0xed, 0x53, 0x49, 0x5c, 0x3e, 0xf, 0xcd, 0x96, 0x3a, 0xcd, 0x2f, 0x15, 
-0x37, 0xc3, 0xf2, 0x29, 0xcd, 0xec, 0x29, 0xcd, 0xea, 0x2b, 0xd2, 0xf2, 0x29, 0x78, 0xc3, 0xf8, 
-0x29, 0xcd, 0xec, 0x29, 0xcd, 0x9, 0x2c, 0x30, 0x9, 0x78, 0x18, 0xc, 0xcd, 0x7, 0x2a, 0xc3, 
-0x4f, 0x36, 0xcd, 0x7, 0x2a, 0xc3, 0x40, 0x36, 0xcd, 0x11, 0x2a, 0xf5, 0xc5, 0x3e, 0xf, 0xcd, 
-0x96, 0x3a, 0xc1, 0xf1, 0xc3, 0x40, 0x36, 0x21, 0xee, 0xf6, 0x4e, 0x23, 0x46, 0x23, 0x7e, 0x23, 
-0xc9, 0x21, 0xee, 0xf6, 0x71, 0x23, 0x70, 0x23, 0x77, 0xc9, 0xe5, 0xcd, 0xb4, 0x30, 0x26, 0x0, 
-0x68, 0x19, 0x7e, 0xe1, 0xc9, 0xcd, 0xec, 0x29, 0x5f, 0x16, 0xa, 0xd5, 0xcd, 0x30, 0x2b, 0xd1, 
-0x30, 0xc0, 0x7b, 0xcd, 0x11, 0x2a, 0x43, 0xcd, 0xf9, 0x2a, 0x30, 0x6, 0x15, 0x20, 0xec, 0x7b, 
-0x38, 0xb6, 0xd5, 0xcd, 0xb, 0x2b, 0xd1, 0x43, 0xcd, 0xf9, 0x2a, 0x7b, 0xb7, 0x18, 0xa9, 0xcd, 
-0xec, 0x29, 0x5f, 0x16, 0xa, 0xd5, 0xcd, 0xb, 0x2b, 0xd1, 0x30, 0x96, 0x7b, 0xcd, 0x11, 0x2a, 
-0x43, 0xcd, 0x2, 0x2b, 0x30, 0x7, 0x15, 0x20, 0xec, 0x7b, 0xda, 0xf8, 0x29, 0xf5, 0xcd, 0x30, 
-0x2b, 0x6, 0x0, 0xcd, 0xd4, 0x2b, 0xf1, 0xc3, 0xf8, 0x29, 0xcd, 0xec, 0x29, 0xcd, 0x4c, 0x2c, 
-0xd2, 0xf2, 0x29, 0x78, 0xc3, 0xf8, 0x29, 0xcd, 0xec, 0x29, 0xcd, 0x31, 0x2c, 0xd2, 0xf2, 0x29, 
-0x78, 0xc3, 0xf8, 0x29, 0xcd, 0xec, 0x29, 0x5f, 0xd5, 0xcd, 0xb, 0x2b, 0xd1, 0xd2, 0xf2, 0x29, 
-0x43, 0xcd, 0x2, 0x2b, 0x7b, 0xda, 0xf8, 0x29, 0xf5, 0xcd, 0x30, 0x2b, 0x6, 0x0, 0xcd, 0xf9, 
-0x2a, 0xf1, 0xc3, 0xf8, 0x29, 0xcd, 0xec, 0x29, 0x5f, 0xd5, 0xcd, 0x30, 0x2b, 0xd1, 0xd2, 0xf2, 
-0x29, 0x43, 0xcd, 0x2, 0x2b, 0x7b, 0xda, 0xf8, 0x29, 0xd5, 0xcd, 0xb, 0x2b, 0xd1, 0x43, 0xcd, 
-0xf9, 0x2a, 0x7b, 0xb7, 0xc3, 0xf8, 0x29, 0xcd, 0xec, 0x29, 0xcd, 0x5b, 0x2b, 0xda, 0xf8, 0x29, 
-0xc3, 0xf2, 0x29, 0xcd, 0xec, 0x29, 0xcd, 0x78, 0x2b, 0xda, 0xf8, 0x29, 0xf5, 0xcd, 0xb, 0x2b, 
-0x6, 0x1f, 0xcd, 0xdf, 0x2b, 0xf1, 0xc3, 0xf8, 0x29, 0xd5, 0xcd, 0xd4, 0x2b, 0xd4, 0xdf, 0x2b, 
-0xd1, 0xc9, 0xd5, 0xcd, 0xdf, 0x2b, 0xd4, 0xd4, 0x2b, 0xd1, 0xc9, 0xcd, 0x7c, 0x2c, 0x30, 0x1f, 
-0xc5, 0xcd, 0xb4, 0x30, 0x6, 0x0, 0xcd, 0x41, 0x2e, 0xd4, 0x80, 0x2f, 0xc1, 0x21, 0xf1, 0xf6, 
-0x7e, 0xb9, 0x38, 0x9, 0xc5, 0xcd, 0x6f, 0x16, 0xc1, 0xd8, 0x79, 0xb7, 0xc8, 0xd, 0x37, 0xc9, 
-0xc5, 0xcd, 0xb4, 0x30, 0x6, 0x0, 0xcd, 0x41, 0x2e, 0xc1, 0x38, 0x3, 0xc3, 0x80, 0x2f, 0xcd, 
-0x68, 0x2c, 0x30, 0x16, 0x21, 0xf1, 0xf6, 0x23, 0x79, 0xbe, 0x38, 0xc, 0xc5, 0xe5, 0xcd, 0x39, 
-0x16, 0xe1, 0xc1, 0xd8, 0x23, 0x7e, 0xb9, 0xc8, 0xc, 0x37, 0xc9, 0x57, 0x5, 0xfa, 0x66, 0x2b, 
-0x58, 0xcd, 0xdf, 0x2b, 0x7b, 0xd8, 0xd5, 0xcd, 0xb, 0x2b, 0xd1, 0x7b, 0xd0, 0x6, 0x1f, 0xcd, 
-0xdf, 0x2b, 0x78, 0xd8, 0x7a, 0x6, 0x0, 0xc9, 0x57, 0x4, 0x3e, 0x1f, 0xb8, 0x38, 0x6, 0x58, 
-0xcd, 0xd4, 0x2b, 0x7b, 0xd8, 0x5, 0xc5, 0xe5, 0x21, 0xd, 0xec, 0xcb, 0x7e, 0x20, 0x31, 0xcd, 
-0xb4, 0x30, 0x21, 0x20, 0x0, 0x19, 0x7e, 0xcb, 0x4f, 0x20, 0x25, 0xcb, 0xce, 0xcb, 0x9e, 0x21, 
-0x23, 0x0, 0x19, 0xeb, 0xe1, 0xc1, 0xf5, 0xcd, 0x30, 0x2b, 0xf1, 0xcd, 0xb4, 0x30, 0x21, 0x23, 
-0x0, 0x19, 0xeb, 0xcb, 0x87, 0xcb, 0xdf, 0xcd, 0xd3, 0x2e, 0xcd, 0xf4, 0x35, 0x78, 0x37, 0xc9, 
-0xe1, 0xc1, 0xd5, 0xcd, 0x30, 0x2b, 0xd1, 0x78, 0xd0, 0x6, 0x0, 0xcd, 0xd4, 0x2b, 0x78, 0xd8, 
-0x7b, 0x6, 0x0, 0xc9, 0xd5, 0xe5, 0xcd, 0xb4, 0x30, 0xcd, 0x41, 0x2e, 0xc3, 0x65, 0x2c, 0xd5, 
-0xe5, 0xcd, 0xb4, 0x30, 0xcd, 0x63, 0x2e, 0xc3, 0x65, 0x2c, 0xd5, 0xe5, 0xcd, 0x5b, 0x2b, 0x30, 
-0x16, 0xcd, 0x1a, 0x2a, 0xfe, 0x20, 0x28, 0xf4, 0xcd, 0x5b, 0x2b, 0x30, 0xa, 0xcd, 0x1a, 0x2a, 
-0xfe, 0x20, 0x20, 0xf4, 0xcd, 0x78, 0x2b, 0x18, 0x5c, 0xd5, 0xe5, 0xcd, 0x78, 0x2b, 0x30, 0x1b, 
-0xcd, 0x1a, 0x2a, 0xfe, 0x20, 0x20, 0xf4, 0xcd, 0x78, 0x2b, 0x30, 0xf, 0xcd, 0x41, 0x2e, 0x30, 
-0xa, 0xcd, 0x1a, 0x2a, 0xfe, 0x20, 0x28, 0xef, 0x37, 0x18, 0x3a, 0xd4, 0x5b, 0x2b, 0xb7, 0x18, 
-0x34, 0xd5, 0xe5, 0xcd, 0xb4, 0x30, 0x21, 0x20, 0x0, 0x19, 0xcb, 0x46, 0x20, 0x7, 0xcd, 0xb, 
-0x2b, 0x38, 0xf0, 0x18, 0x20, 0x6, 0x0, 0xcd, 0xd4, 0x2b, 0x18, 0x19, 0xd5, 0xe5, 0xcd, 0xb4, 
-0x30, 0x21, 0x20, 0x0, 0x19, 0xcb, 0x5e, 0x20, 0x7, 0xcd, 0x30, 0x2b, 0x38, 0xf0, 0x18, 0x5, 
-0x6, 0x1f, 0xcd, 0xdf, 0x2b, 0xe1, 0xd1, 0xc9, 0x3a, 0xd, 0xec, 0xcb, 0x5f, 0x37, 0xc8, 0xcd, 
-0xb4, 0x30, 0x21, 0x20, 0x0, 0x19, 0xcb, 0x5e, 0x37, 0xc8, 0x18, 0x12, 0x3a, 0xd, 0xec, 0xcb, 
-0x5f, 0x37, 0xc8, 0xcd, 0xb4, 0x30, 0x21, 0x20, 0x0, 0x19, 0xcb, 0x46, 0x37, 0xc8, 0x3e, 0x2, 
-0xcd, 0xb4, 0x30, 0x21, 0x20, 0x0, 0x19, 0xcb, 0x46, 0x20, 0x8, 0xd, 0xf2, 0x90, 0x2c, 0xe, 
-0x0, 0x3e, 0x1, 0x21, 0x0, 0xec, 0x11, 0x3, 0xec, 0xf6, 0x80, 0x77, 0x12, 0x23, 0x13, 0x3e, 
-0x0, 0x77, 0x12, 0x23, 0x13, 0x79, 0x77, 0x12, 0x21, 0x0, 0x0, 0x22, 0x6, 0xec, 0xcd, 0x5f, 
-0x33, 0xcd, 0x67, 0x3c, 0xdd, 0xe5, 0xcd, 0x20, 0x1f, 0xcd, 0x6b, 0x2, 0xcd, 0x45, 0x1f, 0xdd, 
-0xe1, 0x3a, 0x3a, 0x5c, 0x3c, 0x20, 0x18, 0x21, 0xd, 0xec, 0xcb, 0x9e, 0xcd, 0x5e, 0x36, 0x3a, 
-0xe, 0xec, 0xfe, 0x4, 0xc4, 0x2f, 0x15, 0xcd, 0xfa, 0x26, 0xcd, 0x7, 0x2a, 0x37, 0xc9, 0x21, 
-0x0, 0xec, 0x11, 0x3, 0xec, 0x1a, 0xcb, 0xbf, 0x77, 0x23, 0x13, 0x1a, 0x77, 0x23, 0x13, 0x1a, 
-0x77, 0xcd, 0x63, 0x3c, 0x38, 0x4, 0xed, 0x4b, 0x6, 0xec, 0x2a, 0x6, 0xec, 0xb7, 0xed, 0x42, 
-0xf5, 0xe5, 0xcd, 0x7, 0x2a, 0xe1, 0xf1, 0x38, 0x11, 0x28, 0x2a, 0xe5, 0x78, 0xcd, 0x5b, 0x2b, 
-0xe1, 0x30, 0x22, 0x2b, 0x7c, 0xb5, 0x20, 0xf3, 0x18, 0x1b, 0xe5, 0x21, 0xd, 0xec, 0xcb, 0xbe, 
-0xe1, 0xeb, 0x21, 0x0, 0x0, 0xb7, 0xed, 0x52, 0xe5, 0x78, 0xcd, 0x78, 0x2b, 0xe1, 0x30, 0x5, 
-0x2b, 0x7c, 0xb5, 0x20, 0xf3, 0x21, 0xd, 0xec, 0xcb, 0xfe, 0xcd, 0x11, 0x2a, 0x3e, 0x17, 0xcd, 
-0x96, 0x3a, 0xb7, 0xc9, 0x21, 0x0, 0xec, 0xcb, 0x7e, 0x28, 0x7, 0x2a, 0x6, 0xec, 0x23, 0x22, 
-0x6, 0xec, 0x21, 0x0, 0xec, 0x7e, 0x23, 0x46, 0x23, 0x4e, 0xe5, 0xe6, 0xf, 0x21, 0x85, 0x2d, 
-0xcd, 0xce, 0x3f, 0x5d, 0xe1, 0x28, 0x2, 0x3e, 0xd, 0x71, 0x2b, 0x70, 0x2b, 0xf5, 0x7e, 0xe6, 
-0xf0, 0xb3, 0x77, 0xf1, 0xc9, 0x3, 0x2, 0xac, 0x2d, 0x4, 0xe9, 0x2d, 0x1, 0x8f, 0x2d, 0xcd, 
-0xb7, 0x32, 0xcd, 0xe, 0x2e, 0x30, 0x7, 0xfe, 0x0, 0x28, 0xf7, 0x2e, 0x1, 0xc9, 0xc, 0x6, 
-0x0, 0x2a, 0xdb, 0xf9, 0x79, 0xbe, 0x38, 0xe7, 0x6, 0x0, 0xe, 0x0, 0xe5, 0x21, 0xee, 0xf6, 
-0x7e, 0xb9, 0x20, 0xa, 0x23, 0x7e, 0xb8, 0x20, 0x5, 0x21, 0x0, 0xec, 0xcb, 0xbe, 0xe1, 0xcd, 
-0xb4, 0x30, 0xcd, 0xe, 0x2e, 0x30, 0x7, 0xfe, 0x0, 0x28, 0xe1, 0x2e, 0x2, 0xc9, 0x21, 0x20, 
-0x0, 0x19, 0xcb, 0x5e, 0x28, 0x5, 0x2e, 0x8, 0x3e, 0xd, 0xc9, 0x21, 0xf3, 0xf6, 0xc, 0x7e, 
-0xb9, 0x6, 0x0, 0x30, 0xda, 0x6, 0x0, 0xe, 0x1, 0xcd, 0xc3, 0x31, 0xcd, 0xe, 0x2e, 0x30, 
-0x7, 0xfe, 0x0, 0x28, 0xf7, 0x2e, 0x4, 0xc9, 0x21, 0x20, 0x0, 0x19, 0xcb, 0x5e, 0x20, 0x9, 
-0xc, 0x6, 0x0, 0x3a, 0xf5, 0xf6, 0xb9, 0x30, 0xe0, 0x2e, 0x8, 0x3e, 0xd, 0xc9, 0x3e, 0x1f, 
-0xb8, 0x3f, 0xd0, 0x68, 0x26, 0x0, 0x19, 0x7e, 0x4, 0x37, 0xc9, 0x1, 0x14, 0x1, 0x1, 0x21, 
-0x3c, 0x5c, 0xcb, 0x86, 0x21, 0x1b, 0x2e, 0x11, 0x15, 0xec, 0xc3, 0xba, 0x3f, 0x21, 0x3c, 0x5c, 
-0xcb, 0xc6, 0x1, 0x0, 0x0, 0xcd, 0x2b, 0x37, 0x21, 0x1d, 0x2e, 0x11, 0x15, 0xec, 0xc3, 0xba, 
-0x3f, 0x26, 0x0, 0x68, 0x19, 0x7e, 0xfe, 0x0, 0x37, 0xc0, 0x78, 0xb7, 0x28, 0xd, 0xe5, 0x2b, 
-0x7e, 0xfe, 0x0, 0x37, 0xe1, 0xc0, 0x7e, 0xfe, 0x0, 0x37, 0xc0, 0x23, 0x4, 0x78, 0xfe, 0x1f, 
-0x38, 0xf4, 0xc9, 0x26, 0x0, 0x68, 0x19, 0x7e, 0xfe, 0x0, 0x37, 0xc0, 0x7e, 0xfe, 0x0, 0x20, 
-0x7, 0x78, 0xb7, 0xc8, 0x2b, 0x5, 0x18, 0xf4, 0x4, 0x37, 0xc9, 0x26, 0x0, 0x68, 0x19, 0x7e, 
-0xc9, 0x21, 0xd, 0xec, 0xb7, 0xcb, 0x46, 0xc0, 0xc5, 0xf5, 0xcd, 0xb4, 0x30, 0xf1, 0xcd, 0xac, 
-0x16, 0xf5, 0xeb, 0xcd, 0x4, 0x36, 0xeb, 0xf1, 0x3f, 0x28, 0x31, 0xf5, 0x6, 0x0, 0xc, 0x3a, 
-0x15, 0xec, 0xb9, 0x38, 0x23, 0x7e, 0x5f, 0xe6, 0xd7, 0xbe, 0x77, 0x7b, 0xcb, 0xce, 0xf5, 0xcd, 
-0xb4, 0x30, 0xf1, 0x28, 0xd, 0xcb, 0x87, 0xcd, 0xd3, 0x2e, 0x30, 0x10, 0xcd, 0xf4, 0x35, 0xf1, 
-0x18, 0xcc, 0xcd, 0x41, 0x2e, 0xf1, 0x18, 0xc6, 0xf1, 0xcd, 0x6e, 0x31, 0xc1, 0xc9, 0xcd, 0xb4, 
-0x30, 0x3e, 0x9, 0xc5, 0xd5, 0x41, 0x21, 0xef, 0x2e, 0x4f, 0xc5, 0xcd, 0x75, 0x16, 0xc1, 0x79, 
-0x30, 0xa, 0x48, 0xcd, 0xb4, 0x30, 0x21, 0x20, 0x0, 0x19, 0x77, 0x37, 0xd1, 0xc1, 0xc9, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 
-0x0, 0x0, 0xc5, 0xcd, 0xb4, 0x30, 0xc5, 0x21, 0x20, 0x0, 0x19, 0xcb, 0x4e, 0x3e, 0x0, 0x28, 
-0x10, 0xc, 0x21, 0x23, 0x0, 0x19, 0xeb, 0x3a, 0x15, 0xec, 0xb9, 0x30, 0xea, 0xd, 0xcd, 0xc9, 
-0x31, 0xe1, 0xe5, 0xcd, 0xb4, 0x30, 0xe1, 0x47, 0x79, 0xbd, 0x78, 0xf5, 0x20, 0x3, 0x44, 0x18, 
-0x9, 0xf5, 0xe5, 0x6, 0x0, 0xcd, 0x41, 0x2e, 0xe1, 0xf1, 0xe5, 0x21, 0xf4, 0xf6, 0xcb, 0xc6, 
-0x28, 0x2, 0xcb, 0x86, 0xcd, 0xc1, 0x16, 0xf5, 0xc5, 0xd5, 0x21, 0xf4, 0xf6, 0xcb, 0x46, 0x20, 
-0xe, 0x6, 0x0, 0xcd, 0xd4, 0x2b, 0x38, 0x7, 0xcd, 0x80, 0x2f, 0xd1, 0xc1, 0x18, 0x5, 0xe1, 
-0xc1, 0xcd, 0x4, 0x36, 0xf1, 0xd, 0x47, 0xe1, 0xf1, 0x78, 0xc2, 0x32, 0x2f, 0x37, 0xc1, 0xc9, 
-0x21, 0x20, 0x0, 0x19, 0x7e, 0xcb, 0x46, 0x20, 0x29, 0xf5, 0xc5, 0x79, 0xb7, 0x20, 0x15, 0xc5, 
-0x2a, 0x9a, 0xfc, 0xcd, 0x4a, 0x33, 0x22, 0x9a, 0xfc, 0x3a, 0xdb, 0xf9, 0x4f, 0xd, 0xcd, 0xb7, 
-0x32, 0xc1, 0x18, 0x4, 0xd, 0xcd, 0xb4, 0x30, 0xc1, 0xf1, 0x21, 0x20, 0x0, 0x19, 0xcb, 0x8e, 
-0xb6, 0x77, 0x41, 0xcd, 0xb4, 0x30, 0xcd, 0xdf, 0x30, 0xc3, 0x48, 0x16, 0xcd, 0x84, 0x30, 0xe5, 
-0xcd, 0x95, 0x30, 0x28, 0x32, 0xcd, 0x5b, 0x2b, 0xe1, 0x30, 0x2d, 0xcd, 0x1a, 0x2a, 0xf5, 0xe5, 
-0xcd, 0x12, 0x2f, 0xe1, 0xf1, 0xfe, 0x20, 0x28, 0xe6, 0xe5, 0xcd, 0x95, 0x30, 0x28, 0x18, 0xcd, 
-0x5b, 0x2b, 0xe1, 0x30, 0x13, 0xcd, 0x1a, 0x2a, 0xfe, 0x20, 0x28, 0x7, 0xe5, 0xcd, 0x12, 0x2f, 
-0xe1, 0x18, 0xe6, 0xe5, 0xcd, 0x78, 0x2b, 0xe1, 0x78, 0xf5, 0xe5, 0x21, 0xf5, 0xee, 0xcb, 0x96, 
-0x3a, 0x15, 0xec, 0xc5, 0x6, 0x0, 0x4f, 0xbf, 0xcd, 0x5, 0x16, 0xc1, 0x21, 0xd, 0xec, 0xcb, 
-0xde, 0xe1, 0xcd, 0xf8, 0x29, 0xf1, 0xc9, 0xcd, 0x84, 0x30, 0xe5, 0xcd, 0x1a, 0x2a, 0xe1, 0xfe, 
-0x0, 0x37, 0x28, 0xd4, 0xf5, 0xe5, 0xcd, 0x12, 0x2f, 0xe1, 0xf1, 0xfe, 0x20, 0x20, 0xeb, 0xcd, 
-0x1a, 0x2a, 0xfe, 0x20, 0x37, 0x20, 0xc1, 0xe5, 0xcd, 0x12, 0x2f, 0xe1, 0x18, 0xf1, 0xcd, 0x84, 
-0x30, 0xe5, 0xcd, 0xb4, 0x30, 0x21, 0x20, 0x0, 0x19, 0xcb, 0x46, 0x20, 0xc, 0xcd, 0x5b, 0x2b, 
-0x30, 0x1b, 0xcd, 0x12, 0x2f, 0xe1, 0x18, 0xe9, 0xe5, 0x78, 0xfe, 0x0, 0x28, 0xf, 0x5, 0xcd, 
-0x1a, 0x2a, 0x4, 0xfe, 0x0, 0x28, 0x6, 0x5, 0xcd, 0x12, 0x2f, 0x18, 0xec, 0xe1, 0x37, 0xc3, 
-0xf8, 0x2f, 0xcd, 0x84, 0x30, 0xcd, 0x1a, 0x2a, 0xfe, 0x0, 0x37, 0x28, 0xf1, 0xe5, 0xcd, 0x12, 
-0x2f, 0xe1, 0x18, 0xf1, 0x21, 0xd, 0xec, 0xcb, 0x86, 0xcd, 0xec, 0x29, 0x21, 0xf5, 0xee, 0xcb, 
-0xd6, 0x21, 0xf1, 0xf6, 0xc9, 0xcd, 0xb4, 0x30, 0x21, 0x20, 0x0, 0x19, 0xcb, 0x46, 0x28, 0xe, 
-0x78, 0xfe, 0x0, 0x28, 0xd, 0x5, 0xcd, 0x1a, 0x2a, 0x4, 0xfe, 0x0, 0x28, 0x4, 0x3e, 0x1, 
-0xb7, 0xc9, 0xaf, 0xc9, 0x21, 0x16, 0xec, 0xf5, 0x79, 0x11, 0x23, 0x0, 0xb7, 0x28, 0x4, 0x19, 
-0x3d, 0x18, 0xf9, 0xeb, 0xf1, 0xc9, 0xd5, 0xcd, 0xb4, 0x30, 0x26, 0x0, 0x68, 0x19, 0xd1, 0xc9, 
-0x5, 0x0, 0x0, 0x0, 0xf8, 0xf6, 0x21, 0xd0, 0x30, 0x11, 0xf5, 0xf6, 0xc3, 0xba, 0x3f, 0xc5, 
-0xd5, 0x21, 0xf5, 0xf6, 0xe5, 0x7e, 0xb7, 0x20, 0x18, 0xe5, 0xcd, 0x5f, 0x33, 0x2a, 0xd7, 0xf9, 
-0xcd, 0x52, 0x33, 0x30, 0x3, 0x22, 0xd7, 0xf9, 0x44, 0x4d, 0xe1, 0xcd, 0xd6, 0x32, 0x3d, 0x18, 
-0x15, 0x21, 0xd, 0xec, 0xcb, 0x86, 0x21, 0xf8, 0xf6, 0x54, 0x5d, 0x1, 0x23, 0x0, 0x9, 0x1, 
-0xbc, 0x2, 0xed, 0xb0, 0x3d, 0x37, 0xd1, 0x12, 0x21, 0xf8, 0xf6, 0xd1, 0xc1, 0xc9, 0xc5, 0xd5, 
-0x21, 0x20, 0x0, 0x19, 0x7e, 0x2f, 0xe6, 0x11, 0x20, 0x15, 0xe5, 0xd5, 0x23, 0x56, 0x23, 0x5e, 
-0xd5, 0xcd, 0x5f, 0x33, 0xe1, 0xcd, 0x4a, 0x33, 0x30, 0x3, 0x22, 0xd7, 0xf9, 0xd1, 0xe1, 0xcb, 
-0x46, 0x21, 0xf5, 0xf6, 0xe5, 0x28, 0x5, 0x3e, 0x0, 0x37, 0x18, 0xca, 0x7e, 0xfe, 0x14, 0x28, 
-0xc5, 0x1, 0x23, 0x0, 0x21, 0xf8, 0xf6, 0xeb, 0xed, 0xb0, 0x21, 0xd6, 0xf9, 0x54, 0x5d, 0x1, 
-0x23, 0x0, 0xb7, 0xed, 0x42, 0x1, 0xbc, 0x2, 0xed, 0xb8, 0x3c, 0x37, 0x18, 0xa8, 0xc5, 0xd5, 
-0xf5, 0x6, 0x0, 0xe, 0x1, 0xe5, 0xcd, 0xc3, 0x31, 0xe1, 0xcb, 0x5e, 0xcb, 0x9e, 0x20, 0x20, 
-0xcd, 0x41, 0x2e, 0xf1, 0xcd, 0xac, 0x16, 0x28, 0x31, 0xf5, 0x6, 0x0, 0xc, 0x79, 0xfe, 0x15, 
-0x38, 0xe, 0x2b, 0x7e, 0x23, 0xfe, 0x0, 0x28, 0x7, 0xe5, 0x21, 0xd, 0xec, 0xcb, 0xc6, 0xe1, 
-0xcb, 0x4e, 0xcb, 0xce, 0xcb, 0x9e, 0xcd, 0xc3, 0x31, 0x20, 0xd5, 0xc5, 0xd5, 0xcd, 0xe6, 0x35, 
-0x36, 0x8, 0xd1, 0xc1, 0xcd, 0xf4, 0x35, 0xf1, 0x18, 0xca, 0x79, 0x32, 0xf5, 0xf6, 0xcb, 0xde, 
-0xd1, 0xc1, 0xc9, 0x21, 0xf8, 0xf6, 0xc3, 0xb7, 0x30, 0xc5, 0xd5, 0x21, 0xd, 0xec, 0xcb, 0x86, 
-0x3a, 0xf5, 0xf6, 0x4f, 0xb7, 0x3e, 0x0, 0x28, 0x42, 0xcd, 0xc3, 0x31, 0xf5, 0x6, 0x0, 0xcd, 
-0x41, 0x2e, 0x30, 0xe, 0xf1, 0xcd, 0xc1, 0x16, 0xf5, 0xc5, 0x6, 0x0, 0xcd, 0x41, 0x2e, 0xc1, 
-0x38, 0x24, 0x23, 0x7e, 0xf5, 0xc5, 0x79, 0xfe, 0x1, 0x20, 0x9, 0x3a, 0x15, 0xec, 0x4f, 0xcd, 
-0xb4, 0x30, 0x18, 0x4, 0xd, 0xcd, 0xc3, 0x31, 0xc1, 0xf1, 0x21, 0x20, 0x0, 0x19, 0xcb, 0x8e, 
-0xb6, 0x77, 0x21, 0xf5, 0xf6, 0x35, 0xf1, 0xd, 0x20, 0xbf, 0x37, 0xd1, 0xc1, 0xc9, 0x3, 0x0, 
-0xde, 0xf9, 0x21, 0x1e, 0x32, 0x11, 0xdb, 0xf9, 0xc3, 0xba, 0x3f, 0xc5, 0xd5, 0x21, 0xdb, 0xf9, 
-0xe5, 0x7e, 0xb7, 0x20, 0x1e, 0xe5, 0xcd, 0x5f, 0x33, 0x2a, 0x9a, 0xfc, 0xcd, 0x4a, 0x33, 0x30, 
-0x3, 0x22, 0x9a, 0xfc, 0x44, 0x4d, 0xe1, 0x23, 0x23, 0x23, 0x30, 0x11, 0xcd, 0xd6, 0x32, 0x3d, 
-0xeb, 0x18, 0xa, 0x2a, 0xdc, 0xf9, 0x1, 0x23, 0x0, 0xed, 0x42, 0x37, 0x3d, 0xeb, 0xe1, 0x30, 
-0x1, 0x77, 0x23, 0x73, 0x23, 0x72, 0xeb, 0xd1, 0xc1, 0xc9, 0xc5, 0xd5, 0x21, 0x20, 0x0, 0x19, 
-0x7e, 0x2f, 0xe6, 0x11, 0x20, 0xc, 0xd5, 0xe5, 0x23, 0x56, 0x23, 0x5e, 0xed, 0x53, 0x9a, 0xfc, 
-0xe1, 0xd1, 0xcb, 0x5e, 0x21, 0xdb, 0xf9, 0xe5, 0x28, 0x16, 0xe5, 0xcd, 0x5f, 0x33, 0x2a, 0x9a, 
-0xfc, 0xcd, 0x52, 0x33, 0x22, 0x9a, 0xfc, 0xe1, 0x23, 0x23, 0x23, 0x3e, 0x0, 0x37, 0x18, 0xbd, 
-0x7e, 0xfe, 0x14, 0x28, 0xe, 0x3c, 0x2a, 0xdc, 0xf9, 0x1, 0x23, 0x0, 0xeb, 0xed, 0xb0, 0xeb, 
-0x37, 0x18, 0xaa, 0xe1, 0xd1, 0xc1, 0xc9, 0x21, 0xde, 0xf9, 0xc3, 0xb7, 0x30, 0x8, 0xd, 0xcc, 
-0x35, 0x1, 0xda, 0x35, 0x12, 0x5a, 0x33, 0x13, 0x5a, 0x33, 0x14, 0x5a, 0x33, 0x15, 0x5a, 0x33, 
-0x10, 0x5a, 0x33, 0x11, 0x5a, 0x33, 0x54, 0x5d, 0x13, 0x13, 0x13, 0xd5, 0x21, 0x20, 0x0, 0x19, 
-0x36, 0x1, 0x23, 0x70, 0x23, 0x71, 0xe, 0x1, 0x6, 0x0, 0xc5, 0xd5, 0x3a, 0xe, 0xec, 0xfe, 
-0x4, 0xc4, 0x17, 0x35, 0xd1, 0xc1, 0x38, 0xf, 0x79, 0xfe, 0x1, 0x3e, 0xd, 0x20, 0x8, 0x78, 
-0xb7, 0x3e, 0x1, 0x28, 0x2, 0x3e, 0xd, 0x21, 0xbd, 0x32, 0xcd, 0xce, 0x3f, 0x38, 0x1d, 0x28, 
-0xd9, 0xf5, 0x3e, 0x1f, 0xb8, 0x30, 0xf, 0x3e, 0x12, 0xcd, 0x31, 0x33, 0x38, 0x5, 0xf1, 0x3e, 
-0xd, 0x18, 0xe4, 0xcd, 0xf4, 0x35, 0xf1, 0xcd, 0xc5, 0x35, 0x18, 0xbe, 0xe1, 0x79, 0xc8, 0x37, 
-0xc9, 0xf5, 0xcd, 0xe6, 0x35, 0xf1, 0xae, 0x77, 0x79, 0xfe, 0x14, 0xd0, 0xc, 0x21, 0x23, 0x0, 
-0x19, 0xeb, 0x21, 0x20, 0x0, 0x19, 0x36, 0x0, 0x37, 0xc9, 0xcd, 0xb6, 0x34, 0xd8, 0x21, 0x0, 
-0x0, 0xc9, 0xcd, 0x30, 0x34, 0xd8, 0x21, 0x0, 0x0, 0xc9, 0xcd, 0x17, 0x35, 0x3f, 0xd0, 0x21, 
-0x0, 0x0, 0x22, 0x9f, 0xfc, 0x22, 0xa1, 0xfc, 0x21, 0x74, 0x33, 0x11, 0xae, 0xfc, 0x1, 0xbc, 
-0x0, 0xed, 0xb0, 0xc9, 0xf3, 0x1, 0xfd, 0x7f, 0x16, 0x17, 0xed, 0x51, 0xfe, 0x50, 0x30, 0x31, 
-0xfe, 0x40, 0x30, 0x26, 0xfe, 0x30, 0x30, 0x1b, 0xfe, 0x20, 0x30, 0x10, 0xfe, 0x10, 0x30, 0x5, 
-0x21, 0x96, 0x0, 0x18, 0x21, 0xd6, 0x10, 0x21, 0xcf, 0x0, 0x18, 0x1a, 0xd6, 0x20, 0x21, 0x0, 
-0x1, 0x18, 0x13, 0xd6, 0x30, 0x21, 0x3e, 0x1, 0x18, 0xc, 0xd6, 0x40, 0x21, 0x8b, 0x1, 0x18, 
-0x5, 0xd6, 0x50, 0x21, 0xd4, 0x1, 0x47, 0xb7, 0x28, 0x9, 0x7e, 0x23, 0xe6, 0x80, 0x28, 0xfa, 
-0x5, 0x18, 0xf5, 0x11, 0xa3, 0xfc, 0xed, 0x53, 0xa1, 0xfc, 0x3a, 0x9e, 0xfc, 0xb7, 0x3e, 0x0, 
-0x32, 0x9e, 0xfc, 0x20, 0x4, 0x3e, 0x20, 0x12, 0x13, 0x7e, 0x47, 0x23, 0x12, 0x13, 0xe6, 0x80, 
-0x28, 0xf7, 0x78, 0xe6, 0x7f, 0x1b, 0x12, 0x13, 0x3e, 0xa0, 0x12, 0x3e, 0x7, 0x1, 0xfd, 0x7f, 
-0xed, 0x79, 0xfb, 0xc9, 0xf3, 0x1, 0xfd, 0x7f, 0x16, 0x17, 0xed, 0x51, 0x21, 0x96, 0x0, 0x6, 
-0xa5, 0x11, 0x74, 0xfd, 0x1a, 0xe6, 0x7f, 0xfe, 0x61, 0x1a, 0x38, 0x2, 0xe6, 0xdf, 0xbe, 0x20, 
-0x9, 0x23, 0x13, 0xe6, 0x80, 0x28, 0xed, 0x37, 0x18, 0xc, 0x4, 0x28, 0x8, 0x7e, 0xe6, 0x80, 
-0x23, 0x28, 0xfa, 0x18, 0xdc, 0xb7, 0x78, 0x16, 0x7, 0x1, 0xfd, 0x7f, 0xed, 0x51, 0xfb, 0xc9, 
-0xcd, 0xea, 0x34, 0xb7, 0x32, 0x9e, 0xfc, 0xcd, 0x20, 0x1f, 0xcd, 0xf6, 0x34, 0x30, 0x52, 0x20, 
-0xc, 0x78, 0xb1, 0x28, 0x8, 0xcd, 0xcf, 0x34, 0xcd, 0xd9, 0x34, 0x30, 0x44, 0x56, 0x23, 0x5e, 
-0xcd, 0x45, 0x1f, 0xd5, 0xe5, 0xdd, 0xe5, 0xdd, 0x21, 0xa3, 0xfc, 0xdd, 0x22, 0xa1, 0xfc, 0xeb, 
-0x6, 0x0, 0x11, 0x18, 0xfc, 0xcd, 0x95, 0x34, 0x11, 0x9c, 0xff, 0xcd, 0x95, 0x34, 0x11, 0xf6, 
-0xff, 0xcd, 0x95, 0x34, 0x11, 0xff, 0xff, 0xcd, 0x95, 0x34, 0xdd, 0x2b, 0xdd, 0x7e, 0x0, 0xf6, 
-0x80, 0xdd, 0x77, 0x0, 0xdd, 0xe1, 0xe1, 0xd1, 0x23, 0x23, 0x23, 0x22, 0x9f, 0xfc, 0xeb, 0x37, 
-0xc9, 0xcd, 0x45, 0x1f, 0xc9, 0xaf, 0x19, 0x3c, 0x38, 0xfc, 0xed, 0x52, 0x3d, 0xc6, 0x30, 0xdd, 
-0x77, 0x0, 0xfe, 0x30, 0x20, 0xb, 0x78, 0xb7, 0x20, 0x9, 0x3e, 0x0, 0xdd, 0x77, 0x0, 0x18, 
-0x2, 0x6, 0x1, 0xdd, 0x23, 0xc9, 0xcd, 0xea, 0x34, 0xb7, 0x32, 0x9e, 0xfc, 0xcd, 0x20, 0x1f, 
-0xcd, 0xf6, 0x34, 0x30, 0xcc, 0xeb, 0x7d, 0xb4, 0x37, 0xc2, 0x4d, 0x34, 0x3f, 0x18, 0xc2, 0xe5, 
-0x23, 0x23, 0x5e, 0x23, 0x56, 0x23, 0x19, 0xd1, 0xc9, 0x7e, 0xe6, 0xc0, 0x37, 0xc8, 0x3f, 0xc9, 
-0x78, 0xbe, 0xc0, 0x79, 0x23, 0xbe, 0x2b, 0xc0, 0x37, 0xc9, 0xe5, 0x21, 0x0, 0x0, 0x22, 0xa1, 
-0xfc, 0x22, 0x9f, 0xfc, 0xe1, 0xc9, 0xe5, 0xc1, 0x11, 0x0, 0x0, 0x2a, 0x53, 0x5c, 0xcd, 0xd9, 
-0x34, 0xd0, 0xcd, 0xe0, 0x34, 0xd8, 0x78, 0xb1, 0x37, 0xc8, 0xcd, 0xcf, 0x34, 0xcd, 0xd9, 0x34, 
-0xd0, 0xcd, 0xe0, 0x34, 0x30, 0xf4, 0xc9, 0x2a, 0xa1, 0xfc, 0x7d, 0xb4, 0x28, 0x1e, 0x7e, 0x23, 
-0xfe, 0xa0, 0x47, 0x3e, 0x0, 0x20, 0x2, 0x3e, 0xff, 0x32, 0x9e, 0xfc, 0x78, 0xcb, 0x7f, 0x28, 
-0x3, 0x21, 0x0, 0x0, 0x22, 0xa1, 0xfc, 0xe6, 0x7f, 0xc3, 0x8f, 0x35, 0x2a, 0x9f, 0xfc, 0x7d, 
-0xb4, 0xca, 0x91, 0x35, 0xcd, 0x20, 0x1f, 0x7e, 0xfe, 0xe, 0x20, 0x8, 0x23, 0x23, 0x23, 0x23, 
-0x23, 0x23, 0x18, 0xf3, 0xcd, 0x45, 0x1f, 0x23, 0x22, 0x9f, 0xfc, 0xfe, 0xa5, 0x38, 0x8, 0xd6, 
-0xa5, 0xcd, 0xae, 0xfc, 0xc3, 0x17, 0x35, 0xfe, 0xa3, 0x38, 0x10, 0x20, 0x5, 0x21, 0x94, 0x35, 
-0x18, 0x3, 0x21, 0x9c, 0x35, 0xcd, 0xfd, 0xfc, 0xc3, 0x17, 0x35, 0xf5, 0x3e, 0x0, 0x32, 0x9e, 
-0xfc, 0xf1, 0xfe, 0xd, 0x20, 0x9, 0x21, 0x0, 0x0, 0x22, 0xa1, 0xfc, 0x22, 0x9f, 0xfc, 0x37, 
-0xc9, 0x37, 0x3f, 0xc9, 0x53, 0x50, 0x45, 0x43, 0x54, 0x52, 0x55, 0xcd, 0x50, 0x4c, 0x41, 0xd9, 
-0x47, 0x4f, 0x54, 0xcf, 0x47, 0x4f, 0x53, 0x55, 0xc2, 0x44, 0x45, 0x46, 0x46, 0xce, 0x4f, 0x50, 
-0x45, 0x4e, 0xa3, 0x43, 0x4c, 0x4f, 0x53, 0x45, 0xa3, 0x2, 0x1, 0x5, 0x21, 0xb9, 0x35, 0x11, 
-0x6a, 0xfd, 0xc3, 0xba, 0x3f, 0x68, 0x26, 0x0, 0x19, 0x77, 0x4, 0xc9, 0xcd, 0xe6, 0x35, 0x7e, 
-0xf6, 0x18, 0x77, 0x21, 0x6a, 0xfd, 0xcb, 0xc6, 0x37, 0xc9, 0xcd, 0xe6, 0x35, 0xcb, 0xde, 0x21, 
-0x6a, 0xfd, 0xcb, 0xc6, 0x37, 0xc9, 0x68, 0x26, 0x0, 0x19, 0x3e, 0x20, 0xb8, 0xc8, 0x36, 0x0, 
-0x23, 0x4, 0x18, 0xf8, 0x3a, 0x6b, 0xfd, 0x6, 0x0, 0x26, 0x0, 0x68, 0x19, 0x36, 0x0, 0x4, 
-0x3d, 0x20, 0xf6, 0xc9, 0xc5, 0xd5, 0xe5, 0xe5, 0x21, 0xf5, 0xee, 0xcb, 0x56, 0xe1, 0x20, 0x4, 
-0x41, 0xcd, 0x1e, 0x3b, 0xe1, 0xd1, 0xc1, 0xc9, 0xc5, 0xd5, 0xe5, 0xe5, 0x21, 0xf5, 0xee, 0xcb, 
-0x56, 0xe1, 0x20, 0x4, 0x59, 0xcd, 0xbf, 0x3a, 0xe1, 0xd1, 0xc1, 0xc9, 0xc5, 0xd5, 0xe5, 0xe5, 
-0x21, 0xf5, 0xee, 0xcb, 0x56, 0xe1, 0x20, 0x4, 0x59, 0xcd, 0xc6, 0x3a, 0xe1, 0xd1, 0xc1, 0xc9, 
-0xf5, 0xc5, 0xd5, 0xe5, 0x78, 0x41, 0x4f, 0xcd, 0x9d, 0x3a, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0xf5, 
-0xc5, 0xd5, 0xe5, 0x78, 0x41, 0x4f, 0xcd, 0xb2, 0x3a, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0x3e, 0x0, 
-0x32, 0x41, 0x5c, 0x3e, 0x2, 0x32, 0xa, 0x5c, 0x21, 0x3b, 0x5c, 0x7e, 0xf6, 0xc, 0x77, 0x21, 
-0xd, 0xec, 0xcb, 0x66, 0x21, 0x66, 0x5b, 0x20, 0x3, 0xcb, 0x86, 0xc9, 0xcb, 0xc6, 0xc9, 0xe5, 
-0x21, 0x3b, 0x5c, 0xcb, 0x6e, 0x28, 0xfc, 0xcb, 0xae, 0x3a, 0x8, 0x5c, 0x21, 0x41, 0x5c, 0xcb, 
-0x86, 0xfe, 0x20, 0x30, 0xd, 0xfe, 0x10, 0x30, 0xe7, 0xfe, 0x6, 0x38, 0xe3, 0xcd, 0xa4, 0x36, 
-0x30, 0xde, 0xe1, 0xc9, 0xef, 0xdb, 0x10, 0xc9, 0xe5, 0xcd, 0x3b, 0x37, 0x21, 0x3c, 0x5c, 0xcb, 
-0x86, 0xe1, 0x5e, 0x23, 0xe5, 0x21, 0xec, 0x37, 0xcd, 0x33, 0x37, 0xe1, 0xcd, 0x33, 0x37, 0xe5, 
-0xcd, 0x22, 0x38, 0x21, 0xfa, 0x37, 0xcd, 0x33, 0x37, 0xe1, 0xd5, 0x1, 0x7, 0x8, 0xcd, 0x2b, 
-0x37, 0xc5, 0x6, 0xc, 0x3e, 0x20, 0xd7, 0x7e, 0x23, 0xfe, 0x80, 0x30, 0x3, 0xd7, 0x10, 0xf7, 
-0xe6, 0x7f, 0xd7, 0x3e, 0x20, 0xd7, 0x10, 0xfb, 0xc1, 0x4, 0xcd, 0x2b, 0x37, 0x1d, 0x20, 0xe1, 
-0x21, 0x38, 0x6f, 0xd1, 0xcb, 0x23, 0xcb, 0x23, 0xcb, 0x23, 0x53, 0x15, 0x1e, 0x6f, 0x1, 0x0, 
-0xff, 0x7a, 0xcd, 0x19, 0x37, 0x1, 0x1, 0x0, 0x7b, 0xcd, 0x19, 0x37, 0x1, 0x0, 0x1, 0x7a, 
-0x3c, 0xcd, 0x19, 0x37, 0xaf, 0xcd, 0xca, 0x37, 0xc9, 0xf5, 0xe5, 0xd5, 0xc5, 0x44, 0x4d, 0xef, 
-0xe9, 0x22, 0xc1, 0xd1, 0xe1, 0xf1, 0x9, 0x3d, 0x20, 0xef, 0xc9, 0x3e, 0x16, 0xd7, 0x78, 0xd7, 
-0x79, 0xd7, 0xc9, 0x7e, 0x23, 0xfe, 0xff, 0xc8, 0xd7, 0x18, 0xf8, 0x37, 0x18, 0x1, 0xa7, 0x11, 
-0xf6, 0xee, 0x21, 0x3c, 0x5c, 0x38, 0x1, 0xeb, 0xed, 0xa0, 0x38, 0x1, 0xeb, 0x21, 0x7d, 0x5c, 
-0x38, 0x1, 0xeb, 0x1, 0x14, 0x0, 0xed, 0xb0, 0x38, 0x1, 0xeb, 0x8, 0x1, 0x7, 0x7, 0xcd, 
-0x94, 0x3b, 0xdd, 0x7e, 0x1, 0x80, 0x47, 0x3e, 0xc, 0xc5, 0xf5, 0xd5, 0xef, 0x9b, 0xe, 0x1, 
-0x7, 0x0, 0x9, 0xd1, 0xcd, 0x7e, 0x37, 0xf1, 0xc1, 0x5, 0x3d, 0x20, 0xec, 0xc9, 0x1, 0xe, 
-0x8, 0xc5, 0x6, 0x0, 0xe5, 0x8, 0x38, 0x1, 0xeb, 0xed, 0xb0, 0x38, 0x1, 0xeb, 0x8, 0xe1, 
-0x24, 0xc1, 0x10, 0xed, 0xc5, 0xd5, 0xef, 0x88, 0xe, 0xeb, 0xd1, 0xc1, 0x8, 0x38, 0x1, 0xeb, 
-0xed, 0xb0, 0x38, 0x1, 0xeb, 0x8, 0xc9, 0xcd, 0xca, 0x37, 0x3d, 0xf2, 0xb1, 0x37, 0x7e, 0x3d, 
-0x3d, 0xcd, 0xca, 0x37, 0x37, 0xc9, 0xd5, 0xcd, 0xca, 0x37, 0x3c, 0x57, 0x7e, 0x3d, 0x3d, 0xba, 
-0x7a, 0xf2, 0xc5, 0x37, 0xaf, 0xcd, 0xca, 0x37, 0xd1, 0xc9, 0xf5, 0xe5, 0xd5, 0x21, 0x7, 0x59, 
-0x11, 0x20, 0x0, 0xa7, 0x28, 0x4, 0x19, 0x3d, 0x20, 0xfc, 0x3e, 0x78, 0xbe, 0x20, 0x2, 0x3e, 
-0x68, 0x16, 0xe, 0x77, 0x23, 0x15, 0x20, 0xfb, 0xd1, 0xe1, 0xf1, 0xc9, 0x16, 0x7, 0x7, 0x15, 
-0x0, 0x14, 0x0, 0x10, 0x7, 0x11, 0x0, 0x13, 0x1, 0xff, 0x11, 0x0, 0x20, 0x11, 0x7, 0x10, 
-0x0, 0xff, 0x1, 0x3, 0x7, 0xf, 0x1f, 0x3f, 0x7f, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 
-0x80, 0x0, 0x10, 0x2, 0x20, 0x11, 0x6, 0x21, 0x10, 0x4, 0x20, 0x11, 0x5, 0x21, 0x10, 0x0, 
-0x20, 0xff, 0xc5, 0xd5, 0xe5, 0x21, 0x2, 0x38, 0x11, 0x98, 0x5b, 0x1, 0x10, 0x0, 0xed, 0xb0, 
-0x2a, 0x36, 0x5c, 0xe5, 0x21, 0x98, 0x5a, 0x22, 0x36, 0x5c, 0x21, 0x12, 0x38, 0xcd, 0x33, 0x37, 
-0xe1, 0x22, 0x36, 0x5c, 0xe1, 0xd1, 0xc1, 0xc9, 0x21, 0x69, 0x27, 0x18, 0xd, 0x21, 0x72, 0x27, 
-0x18, 0x8, 0x21, 0x5e, 0x27, 0x18, 0x3, 0x21, 0x84, 0x27, 0xe5, 0xcd, 0x81, 0x38, 0x21, 0xa0, 
-0x5a, 0x6, 0x20, 0x3e, 0x40, 0x77, 0x23, 0x10, 0xfc, 0x21, 0xec, 0x37, 0xcd, 0x33, 0x37, 0x1, 
-0x0, 0x15, 0xcd, 0x2b, 0x37, 0xd1, 0xcd, 0x7d, 0x5, 0xe, 0x1a, 0xcd, 0x2b, 0x37, 0xc3, 0x22, 
-0x38, 0x6, 0x15, 0x16, 0x17, 0xc3, 0x5e, 0x3b, 0xcd, 0x20, 0x1f, 0xcd, 0x5, 0x3a, 0x7a, 0xb3, 
-0xca, 0xc0, 0x39, 0x2a, 0x96, 0x5b, 0xef, 0xa9, 0x30, 0xeb, 0x2a, 0x94, 0x5b, 0x19, 0x11, 0x10, 
-0x27, 0xb7, 0xed, 0x52, 0xd2, 0xc0, 0x39, 0x2a, 0x53, 0x5c, 0xef, 0xb8, 0x19, 0x23, 0x23, 0x22, 
-0x92, 0x5b, 0x23, 0x23, 0xed, 0x53, 0x6b, 0x5b, 0x7e, 0xef, 0xb6, 0x18, 0xfe, 0xd, 0x28, 0x5, 
-0xcd, 0xe, 0x39, 0x18, 0xf3, 0xed, 0x5b, 0x6b, 0x5b, 0x2a, 0x4b, 0x5c, 0xa7, 0xed, 0x52, 0xeb, 
-0x20, 0xd8, 0xcd, 0x5, 0x3a, 0x42, 0x4b, 0x11, 0x0, 0x0, 0x2a, 0x53, 0x5c, 0xc5, 0xd5, 0xe5, 
-0x2a, 0x96, 0x5b, 0xef, 0xa9, 0x30, 0xed, 0x5b, 0x94, 0x5b, 0x19, 0xeb, 0xe1, 0x72, 0x23, 0x73, 
-0x23, 0x4e, 0x23, 0x46, 0x23, 0x9, 0xd1, 0x13, 0xc1, 0xb, 0x78, 0xb1, 0x20, 0xdf, 0xcd, 0x45, 
-0x1f, 0xed, 0x43, 0x92, 0x5b, 0x37, 0xc9, 0xca, 0xf0, 0xe1, 0xec, 0xed, 0xe5, 0xf7, 0x23, 0x22, 
-0x79, 0x5b, 0xeb, 0x1, 0x7, 0x0, 0x21, 0x7, 0x39, 0xed, 0xb1, 0xeb, 0xc0, 0xe, 0x0, 0x7e, 
-0xfe, 0x20, 0x28, 0x1b, 0xef, 0x1b, 0x2d, 0x30, 0x16, 0xfe, 0x2e, 0x28, 0x12, 0xfe, 0xe, 0x28, 
-0x12, 0xf6, 0x20, 0xfe, 0x65, 0x20, 0x4, 0x78, 0xb1, 0x20, 0x4, 0x2a, 0x79, 0x5b, 0xc9, 0x3, 
-0x23, 0x18, 0xdc, 0xed, 0x43, 0x71, 0x5b, 0xe5, 0xef, 0xb6, 0x18, 0xcd, 0x36, 0x3a, 0x7e, 0xe1, 
-0xfe, 0x3a, 0x28, 0x3, 0xfe, 0xd, 0xc0, 0x23, 0xef, 0xb4, 0x33, 0xef, 0xa2, 0x2d, 0x60, 0x69, 
-0xef, 0x6e, 0x19, 0x28, 0xa, 0x7e, 0xfe, 0x80, 0x20, 0x5, 0x21, 0xf, 0x27, 0x18, 0x11, 0x22, 
-0x77, 0x5b, 0xcd, 0xb, 0x3a, 0x2a, 0x96, 0x5b, 0xef, 0xa9, 0x30, 0xed, 0x5b, 0x94, 0x5b, 0x19, 
-0x11, 0x73, 0x5b, 0xe5, 0xcd, 0x3c, 0x3a, 0x58, 0x1c, 0x16, 0x0, 0xd5, 0xe5, 0x6b, 0x26, 0x0, 
-0xed, 0x4b, 0x71, 0x5b, 0xb7, 0xed, 0x42, 0x22, 0x71, 0x5b, 0x28, 0x33, 0x38, 0x27, 0x44, 0x4d, 
-0x2a, 0x79, 0x5b, 0xe5, 0xd5, 0x2a, 0x65, 0x5c, 0x9, 0x38, 0x13, 0xeb, 0x21, 0x82, 0x0, 0x19, 
-0x38, 0xc, 0xed, 0x72, 0x3f, 0x38, 0x7, 0xd1, 0xe1, 0xef, 0x55, 0x16, 0x18, 0x11, 0xd1, 0xe1, 
-0xcd, 0x45, 0x1f, 0xa7, 0xc9, 0xb, 0x1d, 0x20, 0xfc, 0x2a, 0x79, 0x5b, 0xef, 0xe8, 0x19, 0xed, 
-0x5b, 0x79, 0x5b, 0xe1, 0xc1, 0xed, 0xb0, 0xeb, 0x36, 0xe, 0xc1, 0x23, 0xe5, 0xef, 0x2b, 0x2d, 
-0xd1, 0x1, 0x5, 0x0, 0xed, 0xb0, 0xeb, 0xe5, 0x2a, 0x92, 0x5b, 0xe5, 0x5e, 0x23, 0x56, 0x2a, 
-0x71, 0x5b, 0x19, 0xeb, 0xe1, 0x73, 0x23, 0x72, 0x2a, 0x6b, 0x5b, 0xed, 0x5b, 0x71, 0x5b, 0x19, 
-0x22, 0x6b, 0x5b, 0xe1, 0xc9, 0x2a, 0x4b, 0x5c, 0x22, 0x77, 0x5b, 0x2a, 0x53, 0x5c, 0xed, 0x5b, 
-0x77, 0x5b, 0xb7, 0xed, 0x52, 0x28, 0x1a, 0x2a, 0x53, 0x5c, 0x1, 0x0, 0x0, 0xc5, 0xef, 0xb8, 
-0x19, 0x2a, 0x77, 0x5b, 0xa7, 0xed, 0x52, 0x28, 0x5, 0xeb, 0xc1, 0x3, 0x18, 0xef, 0xd1, 0x13, 
-0xc9, 0x11, 0x0, 0x0, 0xc9, 0x23, 0x7e, 0xfe, 0x20, 0x28, 0xfa, 0xc9, 0xd5, 0x1, 0x18, 0xfc, 
-0xcd, 0x60, 0x3a, 0x1, 0x9c, 0xff, 0xcd, 0x60, 0x3a, 0xe, 0xf6, 0xcd, 0x60, 0x3a, 0x7d, 0xc6, 
-0x30, 0x12, 0x13, 0x6, 0x3, 0xe1, 0x7e, 0xfe, 0x30, 0xc0, 0x36, 0x20, 0x23, 0x10, 0xf7, 0xc9, 
-0xaf, 0x9, 0x3c, 0x38, 0xfc, 0xed, 0x42, 0x3d, 0xc6, 0x30, 0x12, 0x13, 0xc9, 0x8, 0x0, 0x0, 
-0x14, 0x0, 0x0, 0x0, 0xf, 0x0, 0x8, 0x0, 0x16, 0x1, 0x0, 0x0, 0x0, 0xf, 0x0, 0xdd, 
-0x21, 0x6c, 0xfd, 0x21, 0x6d, 0x3a, 0x18, 0x3, 0x21, 0x76, 0x3a, 0x11, 0x6c, 0xfd, 0xc3, 0xba, 
-0x3f, 0xd7, 0x7a, 0xd7, 0x37, 0xc9, 0xe6, 0x3f, 0xdd, 0x77, 0x6, 0x37, 0xc9, 0xdd, 0x7e, 0x1, 
-0x80, 0x47, 0xcd, 0xa0, 0x3b, 0x7e, 0xdd, 0x77, 0x7, 0x2f, 0xe6, 0xc0, 0xdd, 0xb6, 0x6, 0x77, 
-0x37, 0xc9, 0xdd, 0x7e, 0x1, 0x80, 0x47, 0xcd, 0xa0, 0x3b, 0xdd, 0x7e, 0x7, 0x77, 0xc9, 0xe5, 
-0x26, 0x0, 0x7b, 0x90, 0x18, 0x7, 0xe5, 0x7b, 0x58, 0x47, 0x93, 0x26, 0xff, 0x4f, 0x78, 0xbb, 
-0x28, 0x4b, 0xd5, 0xcd, 0x98, 0x3b, 0xc5, 0x4c, 0xef, 0x9b, 0xe, 0xeb, 0xaf, 0xb1, 0x28, 0x3, 
-0x4, 0x18, 0x1, 0x5, 0xd5, 0xef, 0x9b, 0xe, 0xd1, 0x79, 0xe, 0x20, 0x6, 0x8, 0xc5, 0xe5, 
-0xd5, 0x6, 0x0, 0xed, 0xb0, 0xd1, 0xe1, 0xc1, 0x24, 0x14, 0x10, 0xf2, 0xf5, 0xd5, 0xef, 0x88, 
-0xe, 0xeb, 0xe3, 0xef, 0x88, 0xe, 0xeb, 0xe3, 0xd1, 0x1, 0x20, 0x0, 0xed, 0xb0, 0xf1, 0xc1, 
-0xa7, 0x28, 0x3, 0x4, 0x18, 0x1, 0x5, 0xd, 0x67, 0x20, 0xbb, 0xd1, 0x43, 0xe1, 0xcd, 0xb8, 
-0x3b, 0xeb, 0x3a, 0x3c, 0x5c, 0xf5, 0x21, 0xd, 0xec, 0xcb, 0x76, 0xcb, 0x87, 0x28, 0x2, 0xcb, 
-0xc7, 0x32, 0x3c, 0x5c, 0xe, 0x0, 0xcd, 0x2b, 0x37, 0xeb, 0x6, 0x20, 0x7e, 0xa7, 0x20, 0x2, 
-0x3e, 0x20, 0xfe, 0x90, 0x30, 0xf, 0xef, 0x10, 0x0, 0x23, 0x10, 0xf0, 0xf1, 0x32, 0x3c, 0x5c, 
-0xcd, 0xb8, 0x3b, 0x37, 0xc9, 0xcd, 0x20, 0x1f, 0xd7, 0xcd, 0x45, 0x1f, 0x18, 0xeb, 0xcd, 0xb8, 
-0x3b, 0x7a, 0x90, 0x3c, 0x4f, 0xcd, 0x98, 0x3b, 0xc5, 0xef, 0x9b, 0xe, 0xe, 0x8, 0xe5, 0x6, 
-0x20, 0xaf, 0x77, 0x23, 0x10, 0xfc, 0xe1, 0x24, 0xd, 0x20, 0xf3, 0x6, 0x20, 0xc5, 0xef, 0x88, 
-0xe, 0xeb, 0xc1, 0x3a, 0x8d, 0x5c, 0x77, 0x23, 0x10, 0xfc, 0xc1, 0x5, 0xd, 0x20, 0xd9, 0xcd, 
-0xb8, 0x3b, 0x37, 0xc9, 0x3e, 0x21, 0x91, 0x4f, 0x3e, 0x18, 0x90, 0xdd, 0x96, 0x1, 0x47, 0xc9, 
-0xc5, 0xaf, 0x50, 0x5f, 0xcb, 0x1a, 0xcb, 0x1b, 0xcb, 0x1a, 0xcb, 0x1b, 0xcb, 0x1a, 0xcb, 0x1b, 
-0x21, 0x0, 0x58, 0x47, 0x9, 0x19, 0xc1, 0xc9, 0xf5, 0xe5, 0xd5, 0x2a, 0x8d, 0x5c, 0xed, 0x5b, 
-0x8f, 0x5c, 0xd9, 0x2a, 0xf, 0xec, 0xed, 0x5b, 0x11, 0xec, 0x22, 0x8d, 0x5c, 0xed, 0x53, 0x8f, 
-0x5c, 0xd9, 0x22, 0xf, 0xec, 0xed, 0x53, 0x11, 0xec, 0x21, 0x13, 0xec, 0x3a, 0x91, 0x5c, 0x56, 
-0x77, 0x7a, 0x32, 0x91, 0x5c, 0xd1, 0xe1, 0xf1, 0xc9, 0xcd, 0x56, 0x3c, 0xf3, 0xdb, 0xfe, 0xe6, 
-0x40, 0x8, 0x21, 0xe1, 0x58, 0x11, 0x6, 0x0, 0x43, 0x7a, 0x77, 0x19, 0x10, 0xfc, 0x21, 0x0, 
-0x0, 0x11, 0x0, 0x8, 0x1, 0xfe, 0xbf, 0xed, 0x78, 0xcb, 0x47, 0x28, 0x49, 0x6, 0x7f, 0xed, 
-0x78, 0xcb, 0x47, 0x28, 0x41, 0x6, 0xf7, 0xed, 0x78, 0xcb, 0x47, 0x28, 0x39, 0x1b, 0x7a, 0xb3, 
-0x28, 0x9, 0xdb, 0xfe, 0xe6, 0x40, 0x28, 0xf5, 0x23, 0x18, 0xf2, 0xcb, 0x15, 0xcb, 0x14, 0xcb, 
-0x15, 0xcb, 0x14, 0x8, 0x28, 0x7, 0x8, 0x3e, 0x20, 0x94, 0x6f, 0x18, 0x2, 0x8, 0x6c, 0xaf, 
-0x67, 0x11, 0x1f, 0x59, 0x6, 0x20, 0x3e, 0x48, 0xfb, 0x76, 0xf3, 0x12, 0x1b, 0x10, 0xfc, 0x13, 
-0x19, 0x3e, 0x68, 0x77, 0x18, 0xa8, 0xfb, 0x6, 0x19, 0x76, 0x10, 0xfd, 0x21, 0x3b, 0x5c, 0xcb, 
-0xae, 0x37, 0xc9, 0x3e, 0x1, 0x18, 0x2, 0x3e, 0x0, 0x32, 0x8a, 0xfd, 0x21, 0x0, 0x0, 0x22, 
-0x85, 0xfd, 0x22, 0x87, 0xfd, 0x39, 0x22, 0x8b, 0xfd, 0xcd, 0xea, 0x34, 0x3e, 0x0, 0x32, 0x84, 
-0xfd, 0x21, 0x74, 0xfd, 0x22, 0x7d, 0xfd, 0xcd, 0x20, 0x1f, 0xef, 0xb0, 0x16, 0xcd, 0x45, 0x1f, 
-0x3e, 0x0, 0x32, 0x81, 0xfd, 0x2a, 0x59, 0x5c, 0x22, 0x82, 0xfd, 0x21, 0x0, 0x0, 0x22, 0x7f, 
-0xfd, 0x2a, 0x85, 0xfd, 0x23, 0x22, 0x85, 0xfd, 0xcd, 0x9d, 0x3d, 0x4f, 0x3a, 0x81, 0xfd, 0xfe, 
-0x0, 0x20, 0x41, 0x79, 0xe6, 0x4, 0x28, 0x35, 0xcd, 0xe9, 0x3d, 0x30, 0x7, 0x3e, 0x1, 0x32, 
-0x81, 0xfd, 0x18, 0xdd, 0x2a, 0x7f, 0xfd, 0x7d, 0xb4, 0xc2, 0x1e, 0x3d, 0xc5, 0xcd, 0xcd, 0x3d, 
-0xc1, 0x3e, 0x0, 0x32, 0x81, 0xfd, 0x79, 0xe6, 0x1, 0x20, 0xd8, 0x78, 0xcd, 0x16, 0x3e, 0xd0, 
-0x2a, 0x85, 0xfd, 0x23, 0x22, 0x85, 0xfd, 0xcd, 0x9d, 0x3d, 0x4f, 0x18, 0xe9, 0x78, 0xcd, 0x16, 
-0x3e, 0xd0, 0x18, 0xad, 0xfe, 0x1, 0x20, 0xf5, 0x79, 0xe6, 0x1, 0x28, 0xbb, 0xc5, 0xcd, 0x7e, 
-0x3f, 0xc1, 0x38, 0x79, 0x2a, 0x7f, 0xfd, 0x7c, 0xb5, 0x20, 0x13, 0x79, 0xe6, 0x2, 0x28, 0xbc, 
-0xcd, 0xe9, 0x3d, 0x30, 0xaf, 0x2a, 0x7d, 0xfd, 0x2b, 0x22, 0x7f, 0xfd, 0x18, 0x83, 0xc5, 0x21, 
-0x74, 0xfd, 0xed, 0x5b, 0x7f, 0xfd, 0x7a, 0xbc, 0x20, 0x5, 0x7b, 0xbd, 0x20, 0x1, 0x13, 0x1b, 
-0x18, 0x1, 0x23, 0x7e, 0xe6, 0x7f, 0xe5, 0xd5, 0xcd, 0x16, 0x3e, 0xd1, 0xe1, 0x7c, 0xba, 0x20, 
-0xf1, 0x7d, 0xbb, 0x20, 0xed, 0xed, 0x5b, 0x7f, 0xfd, 0x21, 0x74, 0xfd, 0x22, 0x7f, 0xfd, 0xed, 
-0x4b, 0x7d, 0xfd, 0xb, 0x7a, 0xbc, 0x20, 0x18, 0x7b, 0xbd, 0x20, 0x14, 0x13, 0xe5, 0x21, 0x0, 
-0x0, 0x22, 0x7f, 0xfd, 0xe1, 0x78, 0xbc, 0x20, 0x7, 0x79, 0xbd, 0x20, 0x3, 0xc1, 0x18, 0x1f, 
-0x1a, 0x77, 0x23, 0x13, 0xe6, 0x80, 0x28, 0xf8, 0x22, 0x7d, 0xfd, 0x18, 0x81, 0xc5, 0xcd, 0x16, 
-0x3e, 0xc1, 0x21, 0x0, 0x0, 0x22, 0x7f, 0xfd, 0x3a, 0x81, 0xfd, 0xfe, 0x4, 0x28, 0x5, 0x3e, 
-0x0, 0x32, 0x81, 0xfd, 0x21, 0x74, 0xfd, 0x22, 0x7d, 0xfd, 0xc3, 0xb3, 0x3c, 0xcd, 0x54, 0x2d, 
-0x47, 0xfe, 0x3f, 0x38, 0xa, 0xf6, 0x20, 0xcd, 0xc6, 0x3d, 0x38, 0x17, 0x3e, 0x1, 0xc9, 0xfe, 
-0x20, 0x28, 0xd, 0xfe, 0x23, 0x28, 0x6, 0x38, 0xf3, 0xfe, 0x24, 0x20, 0xef, 0x3e, 0x2, 0xc9, 
-0x3e, 0x3, 0xc9, 0x3e, 0x6, 0xc9, 0xfe, 0x7b, 0xd0, 0xfe, 0x61, 0x3f, 0xc9, 0x21, 0x74, 0xfd, 
-0x22, 0x7d, 0xfd, 0x97, 0x32, 0x7f, 0xfd, 0x32, 0x80, 0xfd, 0x7e, 0xe6, 0x7f, 0xe5, 0xcd, 0x9c, 
-0x3e, 0xe1, 0x7e, 0xe6, 0x80, 0xc0, 0x23, 0x18, 0xf1, 0x2a, 0x7d, 0xfd, 0x11, 0x7d, 0xfd, 0x7a, 
-0xbc, 0x20, 0x5, 0x7b, 0xbd, 0xca, 0x13, 0x3e, 0x11, 0x74, 0xfd, 0x7a, 0xbc, 0x20, 0x4, 0x7b, 
-0xbd, 0x28, 0x6, 0x2b, 0x7e, 0xe6, 0x7f, 0x77, 0x23, 0x78, 0xf6, 0x80, 0x77, 0x23, 0x22, 0x7d, 
-0xfd, 0x37, 0xc9, 0x37, 0x3f, 0xc9, 0xf5, 0x3a, 0x89, 0xfd, 0xb7, 0x20, 0x12, 0xf1, 0xfe, 0x3e, 
-0x28, 0x8, 0xfe, 0x3c, 0x28, 0x4, 0xcd, 0x64, 0x3e, 0xc9, 0x32, 0x89, 0xfd, 0x37, 0xc9, 0xfe, 
-0x3c, 0x3e, 0x0, 0x32, 0x89, 0xfd, 0x20, 0x1a, 0xf1, 0xfe, 0x3e, 0x20, 0x4, 0x3e, 0xc9, 0x18, 
-0xe5, 0xfe, 0x3d, 0x20, 0x4, 0x3e, 0xc7, 0x18, 0xdd, 0xf5, 0x3e, 0x3c, 0xcd, 0x64, 0x3e, 0xf1, 
-0x18, 0xd4, 0xf1, 0xfe, 0x3d, 0x20, 0x4, 0x3e, 0xc8, 0x18, 0xcb, 0xf5, 0x3e, 0x3e, 0xcd, 0x64, 
-0x3e, 0xf1, 0x18, 0xc2, 0xfe, 0xd, 0x28, 0x20, 0xfe, 0xea, 0x47, 0x20, 0x7, 0x3e, 0x4, 0x32, 
-0x81, 0xfd, 0x18, 0xe, 0xfe, 0x22, 0x20, 0xa, 0x3a, 0x81, 0xfd, 0xe6, 0xfe, 0xee, 0x2, 0x32, 
-0x81, 0xfd, 0x78, 0xcd, 0x9c, 0x3e, 0x37, 0xc9, 0x3a, 0x8a, 0xfd, 0xfe, 0x0, 0x28, 0xa, 0xed, 
-0x4b, 0x85, 0xfd, 0x2a, 0x8b, 0xfd, 0xf9, 0x37, 0xc9, 0x37, 0x3f, 0xc9, 0x5f, 0x3a, 0x84, 0xfd, 
-0x57, 0x7b, 0xfe, 0x20, 0x20, 0x20, 0x7a, 0xe6, 0x1, 0x20, 0x14, 0x7a, 0xe6, 0x2, 0x20, 0x7, 
-0x7a, 0xf6, 0x2, 0x32, 0x84, 0xfd, 0xc9, 0x7b, 0xcd, 0xfb, 0x3e, 0x3a, 0x84, 0xfd, 0xc9, 0x7a, 
-0xe6, 0xfe, 0x32, 0x84, 0xfd, 0xc9, 0xfe, 0xa3, 0x30, 0x24, 0x7a, 0xe6, 0x2, 0x20, 0xb, 0x7a, 
-0xe6, 0xfe, 0x32, 0x84, 0xfd, 0x7b, 0xcd, 0xfb, 0x3e, 0xc9, 0xd5, 0x3e, 0x20, 0xcd, 0xfb, 0x3e, 
-0xd1, 0x7a, 0xe6, 0xfe, 0xe6, 0xfd, 0x32, 0x84, 0xfd, 0x7b, 0xcd, 0xfb, 0x3e, 0xc9, 0x7a, 0xe6, 
-0xfd, 0xf6, 0x1, 0x32, 0x84, 0xfd, 0x7b, 0xcd, 0xfb, 0x3e, 0xc9, 0x2a, 0x87, 0xfd, 0x23, 0x22, 
-0x87, 0xfd, 0x2a, 0x82, 0xfd, 0x47, 0x3a, 0x8a, 0xfd, 0xfe, 0x0, 0x78, 0x28, 0x25, 0xed, 0x5b, 
-0x5f, 0x5c, 0x7c, 0xba, 0x20, 0x1a, 0x7d, 0xbb, 0x20, 0x16, 0xed, 0x4b, 0x85, 0xfd, 0x2a, 0x87, 
-0xfd, 0xa7, 0xed, 0x42, 0x30, 0x4, 0xed, 0x4b, 0x87, 0xfd, 0x2a, 0x8b, 0xfd, 0xf9, 0x37, 0xc9, 
-0x37, 0x18, 0x2, 0x37, 0x3f, 0xcd, 0x20, 0x1f, 0x30, 0xd, 0x7e, 0xeb, 0xfe, 0xe, 0x20, 0x1d, 
-0x13, 0x13, 0x13, 0x13, 0x13, 0x18, 0x16, 0xf5, 0x1, 0x1, 0x0, 0xe5, 0xd5, 0xcd, 0x66, 0x3f, 
-0xd1, 0xe1, 0xef, 0x64, 0x16, 0x2a, 0x65, 0x5c, 0xeb, 0xed, 0xb8, 0xf1, 0x12, 0x13, 0xcd, 0x45, 
-0x1f, 0xed, 0x53, 0x82, 0xfd, 0xc9, 0x2a, 0x65, 0x5c, 0x9, 0x38, 0xa, 0xeb, 0x21, 0x82, 0x0, 
-0x19, 0x38, 0x3, 0xed, 0x72, 0xd8, 0x3e, 0x3, 0x32, 0x3a, 0x5c, 0xc3, 0x21, 0x3, 0xcd, 0x2e, 
-0xfd, 0xd8, 0x6, 0xf9, 0x11, 0x74, 0xfd, 0x21, 0x94, 0x35, 0xcd, 0x3b, 0xfd, 0xd0, 0xfe, 0xff, 
-0x20, 0x4, 0x3e, 0xd4, 0x18, 0x22, 0xfe, 0xfe, 0x20, 0x4, 0x3e, 0xd3, 0x18, 0x1a, 0xfe, 0xfd, 
-0x20, 0x4, 0x3e, 0xce, 0x18, 0x12, 0xfe, 0xfc, 0x20, 0x4, 0x3e, 0xed, 0x18, 0xa, 0xfe, 0xfb, 
-0x20, 0x4, 0x3e, 0xec, 0x18, 0x2, 0xd6, 0x56, 0x37, 0xc9, 0x46, 0x23, 0x7e, 0x12, 0x13, 0x23, 
-0x10, 0xfa, 0xc9, 0xfe, 0x30, 0x3f, 0xd0, 0xfe, 0x3a, 0xd0, 0xd6, 0x30, 0x37, 0xc9, 0xc5, 0xd5, 
-0x46, 0x23, 0xbe, 0x23, 0x5e, 0x23, 0x56, 0x28, 0x8, 0x23, 0x10, 0xf6, 0x37, 0x3f, 0xd1, 0xc1, 
-0xc9, 0xeb, 0xd1, 0xc1, 0xcd, 0xee, 0x3f, 0x38, 0x2, 0xbf, 0xc9, 0xbf, 0x37, 0xc9, 0xe9, 0x0, 
-0x4d, 0x42, 0x0, 0x53, 0x42, 0x0, 0x41, 0x43, 0x0, 0x52, 0x47, 0x0, 0x4b, 0x4d, 0x0, 0x1, 
-
-};
-unsigned char dump_amstrad_zx128k_1[16384] = {
-0xf3, 0xaf, 0x11, 0xff, 0xff, 0xc3, 0xcb, 0x11, 0x2a, 0x5d, 0x5c, 0x22, 0x5f, 0x5c, 0x18, 0x43, 
-0xc3, 0xf2, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x5d, 0x5c, 0x7e, 0xcd, 0x7d, 0x0, 0xd0, 
-0xcd, 0x74, 0x0, 0x18, 0xf7, 0xff, 0xff, 0xff, 0xc3, 0x5b, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xc5, 0x2a, 0x61, 0x5c, 0xe5, 0xc3, 0x9e, 0x16, 0xf5, 0xe5, 0x2a, 0x78, 0x5c, 0x23, 0x22, 0x78, 
-0x5c, 0x7c, 0xb5, 0x20, 0x3, 0xfd, 0x34, 0x40, 0xc5, 0xd5, 0xcd, 0x6e, 0x38, 0xd1, 0xc1, 0xe1, 
-0xf1, 0xfb, 0xc9, 0xe1, 0x6e, 0xfd, 0x75, 0x0, 0xed, 0x7b, 0x3d, 0x5c, 0xc3, 0xc5, 0x16, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xe5, 0x2a, 0xb0, 0x5c, 0x7c, 0xb5, 0x20, 0x1, 0xe9, 
-0xe1, 0xf1, 0xed, 0x45, 0x2a, 0x5d, 0x5c, 0x23, 0x22, 0x5d, 0x5c, 0x7e, 0xc9, 0xfe, 0x21, 0xd0, 
-0xfe, 0xd, 0xc8, 0xfe, 0x10, 0xd8, 0xfe, 0x18, 0x3f, 0xd8, 0x23, 0xfe, 0x16, 0x38, 0x1, 0x23, 
-0x37, 0x22, 0x5d, 0x5c, 0xc9, 0xbf, 0x52, 0x4e, 0xc4, 0x49, 0x4e, 0x4b, 0x45, 0x59, 0xa4, 0x50, 
-0xc9, 0x46, 0xce, 0x50, 0x4f, 0x49, 0x4e, 0xd4, 0x53, 0x43, 0x52, 0x45, 0x45, 0x4e, 0xa4, 0x41, 
-0x54, 0x54, 0xd2, 0x41, 0xd4, 0x54, 0x41, 0xc2, 0x56, 0x41, 0x4c, 0xa4, 0x43, 0x4f, 0x44, 0xc5, 
-0x56, 0x41, 0xcc, 0x4c, 0x45, 0xce, 0x53, 0x49, 0xce, 0x43, 0x4f, 0xd3, 0x54, 0x41, 0xce, 0x41, 
-0x53, 0xce, 0x41, 0x43, 0xd3, 0x41, 0x54, 0xce, 0x4c, 0xce, 0x45, 0x58, 0xd0, 0x49, 0x4e, 0xd4, 
-0x53, 0x51, 0xd2, 0x53, 0x47, 0xce, 0x41, 0x42, 0xd3, 0x50, 0x45, 0x45, 0xcb, 0x49, 0xce, 0x55, 
-0x53, 0xd2, 0x53, 0x54, 0x52, 0xa4, 0x43, 0x48, 0x52, 0xa4, 0x4e, 0x4f, 0xd4, 0x42, 0x49, 0xce, 
-0x4f, 0xd2, 0x41, 0x4e, 0xc4, 0x3c, 0xbd, 0x3e, 0xbd, 0x3c, 0xbe, 0x4c, 0x49, 0x4e, 0xc5, 0x54, 
-0x48, 0x45, 0xce, 0x54, 0xcf, 0x53, 0x54, 0x45, 0xd0, 0x44, 0x45, 0x46, 0x20, 0x46, 0xce, 0x43, 
-0x41, 0xd4, 0x46, 0x4f, 0x52, 0x4d, 0x41, 0xd4, 0x4d, 0x4f, 0x56, 0xc5, 0x45, 0x52, 0x41, 0x53, 
-0xc5, 0x4f, 0x50, 0x45, 0x4e, 0x20, 0xa3, 0x43, 0x4c, 0x4f, 0x53, 0x45, 0x20, 0xa3, 0x4d, 0x45, 
-0x52, 0x47, 0xc5, 0x56, 0x45, 0x52, 0x49, 0x46, 0xd9, 0x42, 0x45, 0x45, 0xd0, 0x43, 0x49, 0x52, 
-0x43, 0x4c, 0xc5, 0x49, 0x4e, 0xcb, 0x50, 0x41, 0x50, 0x45, 0xd2, 0x46, 0x4c, 0x41, 0x53, 0xc8, 
-0x42, 0x52, 0x49, 0x47, 0x48, 0xd4, 0x49, 0x4e, 0x56, 0x45, 0x52, 0x53, 0xc5, 0x4f, 0x56, 0x45, 
-0xd2, 0x4f, 0x55, 0xd4, 0x4c, 0x50, 0x52, 0x49, 0x4e, 0xd4, 0x4c, 0x4c, 0x49, 0x53, 0xd4, 0x53, 
-0x54, 0x4f, 0xd0, 0x52, 0x45, 0x41, 0xc4, 0x44, 0x41, 0x54, 0xc1, 0x52, 0x45, 0x53, 0x54, 0x4f, 
-0x52, 0xc5, 0x4e, 0x45, 0xd7, 0x42, 0x4f, 0x52, 0x44, 0x45, 0xd2, 0x43, 0x4f, 0x4e, 0x54, 0x49, 
-0x4e, 0x55, 0xc5, 0x44, 0x49, 0xcd, 0x52, 0x45, 0xcd, 0x46, 0x4f, 0xd2, 0x47, 0x4f, 0x20, 0x54, 
-0xcf, 0x47, 0x4f, 0x20, 0x53, 0x55, 0xc2, 0x49, 0x4e, 0x50, 0x55, 0xd4, 0x4c, 0x4f, 0x41, 0xc4, 
-0x4c, 0x49, 0x53, 0xd4, 0x4c, 0x45, 0xd4, 0x50, 0x41, 0x55, 0x53, 0xc5, 0x4e, 0x45, 0x58, 0xd4, 
-0x50, 0x4f, 0x4b, 0xc5, 0x50, 0x52, 0x49, 0x4e, 0xd4, 0x50, 0x4c, 0x4f, 0xd4, 0x52, 0x55, 0xce, 
-0x53, 0x41, 0x56, 0xc5, 0x52, 0x41, 0x4e, 0x44, 0x4f, 0x4d, 0x49, 0x5a, 0xc5, 0x49, 0xc6, 0x43, 
-0x4c, 0xd3, 0x44, 0x52, 0x41, 0xd7, 0x43, 0x4c, 0x45, 0x41, 0xd2, 0x52, 0x45, 0x54, 0x55, 0x52, 
-0xce, 0x43, 0x4f, 0x50, 0xd9, 0x42, 0x48, 0x59, 0x36, 0x35, 0x54, 0x47, 0x56, 0x4e, 0x4a, 0x55, 
-0x37, 0x34, 0x52, 0x46, 0x43, 0x4d, 0x4b, 0x49, 0x38, 0x33, 0x45, 0x44, 0x58, 0xe, 0x4c, 0x4f, 
-0x39, 0x32, 0x57, 0x53, 0x5a, 0x20, 0xd, 0x50, 0x30, 0x31, 0x51, 0x41, 0xe3, 0xc4, 0xe0, 0xe4, 
-0xb4, 0xbc, 0xbd, 0xbb, 0xaf, 0xb0, 0xb1, 0xc0, 0xa7, 0xa6, 0xbe, 0xad, 0xb2, 0xba, 0xe5, 0xa5, 
-0xc2, 0xe1, 0xb3, 0xb9, 0xc1, 0xb8, 0x7e, 0xdc, 0xda, 0x5c, 0xb7, 0x7b, 0x7d, 0xd8, 0xbf, 0xae, 
-0xaa, 0xab, 0xdd, 0xde, 0xdf, 0x7f, 0xb5, 0xd6, 0x7c, 0xd5, 0x5d, 0xdb, 0xb6, 0xd9, 0x5b, 0xd7, 
-0xc, 0x7, 0x6, 0x4, 0x5, 0x8, 0xa, 0xb, 0x9, 0xf, 0xe2, 0x2a, 0x3f, 0xcd, 0xc8, 0xcc, 
-0xcb, 0x5e, 0xac, 0x2d, 0x2b, 0x3d, 0x2e, 0x2c, 0x3b, 0x22, 0xc7, 0x3c, 0xc3, 0x3e, 0xc5, 0x2f, 
-0xc9, 0x60, 0xc6, 0x3a, 0xd0, 0xce, 0xa8, 0xca, 0xd3, 0xd4, 0xd1, 0xd2, 0xa9, 0xcf, 0x2e, 0x2f, 
-0x11, 0xff, 0xff, 0x1, 0xfe, 0xfe, 0xed, 0x78, 0x2f, 0xe6, 0x1f, 0x28, 0xe, 0x67, 0x7d, 0x14, 
-0xc0, 0xd6, 0x8, 0xcb, 0x3c, 0x30, 0xfa, 0x53, 0x5f, 0x20, 0xf4, 0x2d, 0xcb, 0x0, 0x38, 0xe6, 
-0x7a, 0x3c, 0xc8, 0xfe, 0x28, 0xc8, 0xfe, 0x19, 0xc8, 0x7b, 0x5a, 0x57, 0xfe, 0x18, 0xc9, 0xcd, 
-0x8e, 0x2, 0xc0, 0x21, 0x0, 0x5c, 0xcb, 0x7e, 0x20, 0x7, 0x23, 0x35, 0x2b, 0x20, 0x2, 0x36, 
-0xff, 0x7d, 0x21, 0x4, 0x5c, 0xbd, 0x20, 0xee, 0xcd, 0x1e, 0x3, 0xd0, 0x21, 0x0, 0x5c, 0xbe, 
-0x28, 0x2e, 0xeb, 0x21, 0x4, 0x5c, 0xbe, 0x28, 0x27, 0xcb, 0x7e, 0x20, 0x4, 0xeb, 0xcb, 0x7e, 
-0xc8, 0x5f, 0x77, 0x23, 0x36, 0x5, 0x23, 0x3a, 0x9, 0x5c, 0x77, 0x23, 0xfd, 0x4e, 0x7, 0xfd, 
-0x56, 0x1, 0xe5, 0xcd, 0x33, 0x3, 0xe1, 0x77, 0x32, 0x8, 0x5c, 0xfd, 0xcb, 0x1, 0xee, 0xc9, 
-0x23, 0x36, 0x5, 0x23, 0x35, 0xc0, 0x3a, 0xa, 0x5c, 0x77, 0x23, 0x7e, 0x18, 0xea, 0x42, 0x16, 
-0x0, 0x7b, 0xfe, 0x27, 0xd0, 0xfe, 0x18, 0x20, 0x3, 0xcb, 0x78, 0xc0, 0x21, 0x5, 0x2, 0x19, 
-0x7e, 0x37, 0xc9, 0x7b, 0xfe, 0x3a, 0x38, 0x2f, 0xd, 0xfa, 0x4f, 0x3, 0x28, 0x3, 0xc6, 0x4f, 
-0xc9, 0x21, 0xeb, 0x1, 0x4, 0x28, 0x3, 0x21, 0x5, 0x2, 0x16, 0x0, 0x19, 0x7e, 0xc9, 0x21, 
-0x29, 0x2, 0xcb, 0x40, 0x28, 0xf4, 0xcb, 0x5a, 0x28, 0xa, 0xfd, 0xcb, 0x30, 0x5e, 0xc0, 0x4, 
-0xc0, 0xc6, 0x20, 0xc9, 0xc6, 0xa5, 0xc9, 0xfe, 0x30, 0xd8, 0xd, 0xfa, 0x9d, 0x3, 0x20, 0x19, 
-0x21, 0x54, 0x2, 0xcb, 0x68, 0x28, 0xd3, 0xfe, 0x38, 0x30, 0x7, 0xd6, 0x20, 0x4, 0xc8, 0xc6, 
-0x8, 0xc9, 0xd6, 0x36, 0x4, 0xc8, 0xc6, 0xfe, 0xc9, 0x21, 0x30, 0x2, 0xfe, 0x39, 0x28, 0xba, 
-0xfe, 0x30, 0x28, 0xb6, 0xe6, 0x7, 0xc6, 0x80, 0x4, 0xc8, 0xee, 0xf, 0xc9, 0x4, 0xc8, 0xcb, 
-0x68, 0x21, 0x30, 0x2, 0x20, 0xa4, 0xd6, 0x10, 0xfe, 0x22, 0x28, 0x6, 0xfe, 0x20, 0xc0, 0x3e, 
-0x5f, 0xc9, 0x3e, 0x40, 0xc9, 0xf3, 0x7d, 0xcb, 0x3d, 0xcb, 0x3d, 0x2f, 0xe6, 0x3, 0x4f, 0x6, 
-0x0, 0xdd, 0x21, 0xd1, 0x3, 0xdd, 0x9, 0x3a, 0x48, 0x5c, 0xe6, 0x38, 0xf, 0xf, 0xf, 0xf6, 
-0x8, 0x0, 0x0, 0x0, 0x4, 0xc, 0xd, 0x20, 0xfd, 0xe, 0x3f, 0x5, 0xc2, 0xd6, 0x3, 0xee, 
-0x10, 0xd3, 0xfe, 0x44, 0x4f, 0xcb, 0x67, 0x20, 0x9, 0x7a, 0xb3, 0x28, 0x9, 0x79, 0x4d, 0x1b, 
-0xdd, 0xe9, 0x4d, 0xc, 0xdd, 0xe9, 0xfb, 0xc9, 0xef, 0x31, 0x27, 0xc0, 0x3, 0x34, 0xec, 0x6c, 
-0x98, 0x1f, 0xf5, 0x4, 0xa1, 0xf, 0x38, 0x21, 0x92, 0x5c, 0x7e, 0xa7, 0x20, 0x5e, 0x23, 0x4e, 
-0x23, 0x46, 0x78, 0x17, 0x9f, 0xb9, 0x20, 0x54, 0x23, 0xbe, 0x20, 0x50, 0x78, 0xc6, 0x3c, 0xf2, 
-0x25, 0x4, 0xe2, 0x6c, 0x4, 0x6, 0xfa, 0x4, 0xd6, 0xc, 0x30, 0xfb, 0xc6, 0xc, 0xc5, 0x21, 
-0x6e, 0x4, 0xcd, 0x6, 0x34, 0xcd, 0xb4, 0x33, 0xef, 0x4, 0x38, 0xf1, 0x86, 0x77, 0xef, 0xc0, 
-0x2, 0x31, 0x38, 0xcd, 0x94, 0x1e, 0xfe, 0xb, 0x30, 0x22, 0xef, 0xe0, 0x4, 0xe0, 0x34, 0x80, 
-0x43, 0x55, 0x9f, 0x80, 0x1, 0x5, 0x34, 0x35, 0x71, 0x3, 0x38, 0xcd, 0x99, 0x1e, 0xc5, 0xcd, 
-0x99, 0x1e, 0xe1, 0x50, 0x59, 0x7a, 0xb3, 0xc8, 0x1b, 0xc3, 0xb5, 0x3, 0xcf, 0xa, 0x89, 0x2, 
-0xd0, 0x12, 0x86, 0x89, 0xa, 0x97, 0x60, 0x75, 0x89, 0x12, 0xd5, 0x17, 0x1f, 0x89, 0x1b, 0x90, 
-0x41, 0x2, 0x89, 0x24, 0xd0, 0x53, 0xca, 0x89, 0x2e, 0x9d, 0x36, 0xb1, 0x89, 0x38, 0xff, 0x49, 
-0x3e, 0x89, 0x43, 0xff, 0x6a, 0x73, 0x89, 0x4f, 0xa7, 0x0, 0x54, 0x89, 0x5c, 0x0, 0x0, 0x0, 
-0x89, 0x69, 0x14, 0xf6, 0x24, 0x89, 0x76, 0xf1, 0x10, 0x5, 0xcd, 0xfb, 0x24, 0x3a, 0x3b, 0x5c, 
-0x87, 0xfa, 0x8a, 0x1c, 0xe1, 0xd0, 0xe5, 0xcd, 0xf1, 0x2b, 0x62, 0x6b, 0xd, 0xf8, 0x9, 0xcb, 
-0xfe, 0xc9, 0x21, 0x3f, 0x5, 0xe5, 0x21, 0x80, 0x1f, 0xcb, 0x7f, 0x28, 0x3, 0x21, 0x98, 0xc, 
-0x8, 0x13, 0xdd, 0x2b, 0xf3, 0x3e, 0x2, 0x47, 0x10, 0xfe, 0xd3, 0xfe, 0xee, 0xf, 0x6, 0xa4, 
-0x2d, 0x20, 0xf5, 0x5, 0x25, 0xf2, 0xd8, 0x4, 0x6, 0x2f, 0x10, 0xfe, 0xd3, 0xfe, 0x3e, 0xd, 
-0x6, 0x37, 0x10, 0xfe, 0xd3, 0xfe, 0x1, 0xe, 0x3b, 0x8, 0x6f, 0xc3, 0x7, 0x5, 0x7a, 0xb3, 
-0x28, 0xc, 0xdd, 0x6e, 0x0, 0x7c, 0xad, 0x67, 0x3e, 0x1, 0x37, 0xc3, 0x25, 0x5, 0x6c, 0x18, 
-0xf4, 0x79, 0xcb, 0x78, 0x10, 0xfe, 0x30, 0x4, 0x6, 0x42, 0x10, 0xfe, 0xd3, 0xfe, 0x6, 0x3e, 
-0x20, 0xef, 0x5, 0xaf, 0x3c, 0xcb, 0x15, 0xc2, 0x14, 0x5, 0x1b, 0xdd, 0x23, 0x6, 0x31, 0x3e, 
-0x7f, 0xdb, 0xfe, 0x1f, 0xd0, 0x7a, 0x3c, 0xc2, 0xfe, 0x4, 0x6, 0x3b, 0x10, 0xfe, 0xc9, 0xf5, 
-0x3a, 0x48, 0x5c, 0xe6, 0x38, 0xf, 0xf, 0xf, 0xd3, 0xfe, 0x3e, 0x7f, 0xdb, 0xfe, 0x1f, 0xfb, 
-0x38, 0x2, 0xcf, 0xc, 0xf1, 0xc9, 0x14, 0x8, 0x15, 0xf3, 0x3e, 0xf, 0xd3, 0xfe, 0x21, 0x3f, 
-0x5, 0xe5, 0xdb, 0xfe, 0x1f, 0xe6, 0x20, 0xf6, 0x2, 0x4f, 0xbf, 0xc0, 0xcd, 0xe7, 0x5, 0x30, 
-0xfa, 0x21, 0x15, 0x4, 0x10, 0xfe, 0x2b, 0x7c, 0xb5, 0x20, 0xf9, 0xcd, 0xe3, 0x5, 0x30, 0xeb, 
-0x6, 0x9c, 0xcd, 0xe3, 0x5, 0x30, 0xe4, 0x3e, 0xc6, 0xb8, 0x30, 0xe0, 0x24, 0x20, 0xf1, 0x6, 
-0xc9, 0xcd, 0xe7, 0x5, 0x30, 0xd5, 0x78, 0xfe, 0xd4, 0x30, 0xf4, 0xcd, 0xe7, 0x5, 0xd0, 0x79, 
-0xee, 0x3, 0x4f, 0x26, 0x0, 0x6, 0xb0, 0x18, 0x1f, 0x8, 0x20, 0x7, 0x30, 0xf, 0xdd, 0x75, 
-0x0, 0x18, 0xf, 0xcb, 0x11, 0xad, 0xc0, 0x79, 0x1f, 0x4f, 0x13, 0x18, 0x7, 0xdd, 0x7e, 0x0, 
-0xad, 0xc0, 0xdd, 0x23, 0x1b, 0x8, 0x6, 0xb2, 0x2e, 0x1, 0xcd, 0xe3, 0x5, 0xd0, 0x3e, 0xcb, 
-0xb8, 0xcb, 0x15, 0x6, 0xb0, 0xd2, 0xca, 0x5, 0x7c, 0xad, 0x67, 0x7a, 0xb3, 0x20, 0xca, 0x7c, 
-0xfe, 0x1, 0xc9, 0xcd, 0xe7, 0x5, 0xd0, 0x3e, 0x16, 0x3d, 0x20, 0xfd, 0xa7, 0x4, 0xc8, 0x3e, 
-0x7f, 0xdb, 0xfe, 0x1f, 0xd0, 0xa9, 0xe6, 0x20, 0x28, 0xf3, 0x79, 0x2f, 0x4f, 0xe6, 0x7, 0xf6, 
-0x8, 0xd3, 0xfe, 0x37, 0xc9, 0xf1, 0x3a, 0x74, 0x5c, 0xd6, 0xe0, 0x32, 0x74, 0x5c, 0xcd, 0x8c, 
-0x1c, 0xcd, 0x30, 0x25, 0x28, 0x3c, 0x1, 0x11, 0x0, 0x3a, 0x74, 0x5c, 0xa7, 0x28, 0x2, 0xe, 
-0x22, 0xf7, 0xd5, 0xdd, 0xe1, 0x6, 0xb, 0x3e, 0x20, 0x12, 0x13, 0x10, 0xfc, 0xdd, 0x36, 0x1, 
-0xff, 0xcd, 0xf1, 0x2b, 0x21, 0xf6, 0xff, 0xb, 0x9, 0x3, 0x30, 0xf, 0x3a, 0x74, 0x5c, 0xa7, 
-0x20, 0x2, 0xcf, 0xe, 0x78, 0xb1, 0x28, 0xa, 0x1, 0xa, 0x0, 0xdd, 0xe5, 0xe1, 0x23, 0xeb, 
-0xed, 0xb0, 0xdf, 0xfe, 0xe4, 0x20, 0x49, 0x3a, 0x74, 0x5c, 0xfe, 0x3, 0xca, 0x8a, 0x1c, 0xe7, 
-0xcd, 0xb2, 0x28, 0xcb, 0xf9, 0x30, 0xb, 0x21, 0x0, 0x0, 0x3a, 0x74, 0x5c, 0x3d, 0x28, 0x15, 
-0xcf, 0x1, 0xc2, 0x8a, 0x1c, 0xcd, 0x30, 0x25, 0x28, 0x18, 0x23, 0x7e, 0xdd, 0x77, 0xb, 0x23, 
-0x7e, 0xdd, 0x77, 0xc, 0x23, 0xdd, 0x71, 0xe, 0x3e, 0x1, 0xcb, 0x71, 0x28, 0x1, 0x3c, 0xdd, 
-0x77, 0x0, 0xeb, 0xe7, 0xfe, 0x29, 0x20, 0xda, 0xe7, 0xcd, 0xee, 0x1b, 0xeb, 0xc3, 0x5a, 0x7, 
-0xfe, 0xaa, 0x20, 0x1f, 0x3a, 0x74, 0x5c, 0xfe, 0x3, 0xca, 0x8a, 0x1c, 0xe7, 0xcd, 0xee, 0x1b, 
-0xdd, 0x36, 0xb, 0x0, 0xdd, 0x36, 0xc, 0x1b, 0x21, 0x0, 0x40, 0xdd, 0x75, 0xd, 0xdd, 0x74, 
-0xe, 0x18, 0x4d, 0xfe, 0xaf, 0x20, 0x4f, 0x3a, 0x74, 0x5c, 0xfe, 0x3, 0xca, 0x8a, 0x1c, 0xe7, 
-0xcd, 0x48, 0x20, 0x20, 0xc, 0x3a, 0x74, 0x5c, 0xa7, 0xca, 0x8a, 0x1c, 0xcd, 0xe6, 0x1c, 0x18, 
-0xf, 0xcd, 0x82, 0x1c, 0xdf, 0xfe, 0x2c, 0x28, 0xc, 0x3a, 0x74, 0x5c, 0xa7, 0xca, 0x8a, 0x1c, 
-0xcd, 0xe6, 0x1c, 0x18, 0x4, 0xe7, 0xcd, 0x82, 0x1c, 0xcd, 0xee, 0x1b, 0xcd, 0x99, 0x1e, 0xdd, 
-0x71, 0xb, 0xdd, 0x70, 0xc, 0xcd, 0x99, 0x1e, 0xdd, 0x71, 0xd, 0xdd, 0x70, 0xe, 0x60, 0x69, 
-0xdd, 0x36, 0x0, 0x3, 0x18, 0x44, 0xfe, 0xca, 0x28, 0x9, 0xcd, 0xee, 0x1b, 0xdd, 0x36, 0xe, 
-0x80, 0x18, 0x17, 0x3a, 0x74, 0x5c, 0xa7, 0xc2, 0x8a, 0x1c, 0xe7, 0xcd, 0x82, 0x1c, 0xcd, 0xee, 
-0x1b, 0xcd, 0x99, 0x1e, 0xdd, 0x71, 0xd, 0xdd, 0x70, 0xe, 0xdd, 0x36, 0x0, 0x0, 0x2a, 0x59, 
-0x5c, 0xed, 0x5b, 0x53, 0x5c, 0x37, 0xed, 0x52, 0xdd, 0x75, 0xb, 0xdd, 0x74, 0xc, 0x2a, 0x4b, 
-0x5c, 0xed, 0x52, 0xdd, 0x75, 0xf, 0xdd, 0x74, 0x10, 0xeb, 0x3a, 0x74, 0x5c, 0xa7, 0xca, 0x70, 
-0x9, 0xe5, 0x1, 0x11, 0x0, 0xdd, 0x9, 0xdd, 0xe5, 0x11, 0x11, 0x0, 0xaf, 0x37, 0xcd, 0x56, 
-0x5, 0xdd, 0xe1, 0x30, 0xf2, 0x3e, 0xfe, 0xcd, 0x1, 0x16, 0xfd, 0x36, 0x52, 0x3, 0xe, 0x80, 
-0xdd, 0x7e, 0x0, 0xdd, 0xbe, 0xef, 0x20, 0x2, 0xe, 0xf6, 0xfe, 0x4, 0x30, 0xd9, 0x11, 0xc0, 
-0x9, 0xc5, 0xcd, 0xa, 0xc, 0xc1, 0xdd, 0xe5, 0xd1, 0x21, 0xf0, 0xff, 0x19, 0x6, 0xa, 0x7e, 
-0x3c, 0x20, 0x3, 0x79, 0x80, 0x4f, 0x13, 0x1a, 0xbe, 0x23, 0x20, 0x1, 0xc, 0xd7, 0x10, 0xf6, 
-0xcb, 0x79, 0x20, 0xb3, 0x3e, 0xd, 0xd7, 0xe1, 0xdd, 0x7e, 0x0, 0xfe, 0x3, 0x28, 0xc, 0x3a, 
-0x74, 0x5c, 0x3d, 0xca, 0x8, 0x8, 0xfe, 0x2, 0xca, 0xb6, 0x8, 0xe5, 0xdd, 0x6e, 0xfa, 0xdd, 
-0x66, 0xfb, 0xdd, 0x5e, 0xb, 0xdd, 0x56, 0xc, 0x7c, 0xb5, 0x28, 0xd, 0xed, 0x52, 0x38, 0x26, 
-0x28, 0x7, 0xdd, 0x7e, 0x0, 0xfe, 0x3, 0x20, 0x1d, 0xe1, 0x7c, 0xb5, 0x20, 0x6, 0xdd, 0x6e, 
-0xd, 0xdd, 0x66, 0xe, 0xe5, 0xdd, 0xe1, 0x3a, 0x74, 0x5c, 0xfe, 0x2, 0x37, 0x20, 0x1, 0xa7, 
-0x3e, 0xff, 0xcd, 0x56, 0x5, 0xd8, 0xcf, 0x1a, 0xdd, 0x5e, 0xb, 0xdd, 0x56, 0xc, 0xe5, 0x7c, 
-0xb5, 0x20, 0x6, 0x13, 0x13, 0x13, 0xeb, 0x18, 0xc, 0xdd, 0x6e, 0xfa, 0xdd, 0x66, 0xfb, 0xeb, 
-0x37, 0xed, 0x52, 0x38, 0x9, 0x11, 0x5, 0x0, 0x19, 0x44, 0x4d, 0xcd, 0x5, 0x1f, 0xe1, 0xdd, 
-0x7e, 0x0, 0xa7, 0x28, 0x3e, 0x7c, 0xb5, 0x28, 0x13, 0x2b, 0x46, 0x2b, 0x4e, 0x2b, 0x3, 0x3, 
-0x3, 0xdd, 0x22, 0x5f, 0x5c, 0xcd, 0xe8, 0x19, 0xdd, 0x2a, 0x5f, 0x5c, 0x2a, 0x59, 0x5c, 0x2b, 
-0xdd, 0x4e, 0xb, 0xdd, 0x46, 0xc, 0xc5, 0x3, 0x3, 0x3, 0xdd, 0x7e, 0xfd, 0xf5, 0xcd, 0x55, 
-0x16, 0x23, 0xf1, 0x77, 0xd1, 0x23, 0x73, 0x23, 0x72, 0x23, 0xe5, 0xdd, 0xe1, 0x37, 0x3e, 0xff, 
-0xc3, 0x2, 0x8, 0xeb, 0x2a, 0x59, 0x5c, 0x2b, 0xdd, 0x22, 0x5f, 0x5c, 0xdd, 0x4e, 0xb, 0xdd, 
-0x46, 0xc, 0xc5, 0xcd, 0xe5, 0x19, 0xc1, 0xe5, 0xc5, 0xcd, 0x55, 0x16, 0xdd, 0x2a, 0x5f, 0x5c, 
-0x23, 0xdd, 0x4e, 0xf, 0xdd, 0x46, 0x10, 0x9, 0x22, 0x4b, 0x5c, 0xdd, 0x66, 0xe, 0x7c, 0xe6, 
-0xc0, 0x20, 0xa, 0xdd, 0x6e, 0xd, 0x22, 0x42, 0x5c, 0xfd, 0x36, 0xa, 0x0, 0xd1, 0xdd, 0xe1, 
-0x37, 0x3e, 0xff, 0xc3, 0x2, 0x8, 0xdd, 0x4e, 0xb, 0xdd, 0x46, 0xc, 0xc5, 0x3, 0xf7, 0x36, 
-0x80, 0xeb, 0xd1, 0xe5, 0xe5, 0xdd, 0xe1, 0x37, 0x3e, 0xff, 0xcd, 0x2, 0x8, 0xe1, 0xed, 0x5b, 
-0x53, 0x5c, 0x7e, 0xe6, 0xc0, 0x20, 0x19, 0x1a, 0x13, 0xbe, 0x23, 0x20, 0x2, 0x1a, 0xbe, 0x1b, 
-0x2b, 0x30, 0x8, 0xe5, 0xeb, 0xcd, 0xb8, 0x19, 0xe1, 0x18, 0xec, 0xcd, 0x2c, 0x9, 0x18, 0xe2, 
-0x7e, 0x4f, 0xfe, 0x80, 0xc8, 0xe5, 0x2a, 0x4b, 0x5c, 0x7e, 0xfe, 0x80, 0x28, 0x25, 0xb9, 0x28, 
-0x8, 0xc5, 0xcd, 0xb8, 0x19, 0xc1, 0xeb, 0x18, 0xf0, 0xe6, 0xe0, 0xfe, 0xa0, 0x20, 0x12, 0xd1, 
-0xd5, 0xe5, 0x23, 0x13, 0x1a, 0xbe, 0x20, 0x6, 0x17, 0x30, 0xf7, 0xe1, 0x18, 0x3, 0xe1, 0x18, 
-0xe0, 0x3e, 0xff, 0xd1, 0xeb, 0x3c, 0x37, 0xcd, 0x2c, 0x9, 0x18, 0xc4, 0x20, 0x10, 0x8, 0x22, 
-0x5f, 0x5c, 0xeb, 0xcd, 0xb8, 0x19, 0xcd, 0xe8, 0x19, 0xeb, 0x2a, 0x5f, 0x5c, 0x8, 0x8, 0xd5, 
-0xcd, 0xb8, 0x19, 0x22, 0x5f, 0x5c, 0x2a, 0x53, 0x5c, 0xe3, 0xc5, 0x8, 0x38, 0x7, 0x2b, 0xcd, 
-0x55, 0x16, 0x23, 0x18, 0x3, 0xcd, 0x55, 0x16, 0x23, 0xc1, 0xd1, 0xed, 0x53, 0x53, 0x5c, 0xed, 
-0x5b, 0x5f, 0x5c, 0xc5, 0xd5, 0xeb, 0xed, 0xb0, 0xe1, 0xc1, 0xd5, 0xcd, 0xe8, 0x19, 0xd1, 0xc9, 
-0xe5, 0x3e, 0xfd, 0xcd, 0x1, 0x16, 0xaf, 0x11, 0xa1, 0x9, 0xcd, 0xa, 0xc, 0xfd, 0xcb, 0x2, 
-0xee, 0xcd, 0xd4, 0x15, 0xdd, 0xe5, 0x11, 0x11, 0x0, 0xaf, 0xcd, 0xc2, 0x4, 0xdd, 0xe1, 0x6, 
-0x32, 0x76, 0x10, 0xfd, 0xdd, 0x5e, 0xb, 0xdd, 0x56, 0xc, 0x3e, 0xff, 0xdd, 0xe1, 0xc3, 0xc2, 
-0x4, 0x80, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x74, 0x61, 0x70, 0x65, 0x2c, 0x20, 0x74, 0x68, 
-0x65, 0x6e, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6b, 0x65, 0x79, 
-0xae, 0xd, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x3a, 0xa0, 0xd, 0x4e, 0x75, 0x6d, 0x62, 
-0x65, 0x72, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3a, 0xa0, 0xd, 0x43, 0x68, 0x61, 0x72, 0x61, 
-0x63, 0x74, 0x65, 0x72, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3a, 0xa0, 0xd, 0x42, 0x79, 0x74, 
-0x65, 0x73, 0x3a, 0xa0, 0xcd, 0x3, 0xb, 0xfe, 0x20, 0xd2, 0xd9, 0xa, 0xfe, 0x6, 0x38, 0x69, 
-0xfe, 0x18, 0x30, 0x65, 0x21, 0xb, 0xa, 0x5f, 0x16, 0x0, 0x19, 0x5e, 0x19, 0xe5, 0xc3, 0x3, 
-0xb, 0x4e, 0x57, 0x10, 0x29, 0x54, 0x53, 0x52, 0x37, 0x50, 0x4f, 0x5f, 0x5e, 0x5d, 0x5c, 0x5b, 
-0x5a, 0x54, 0x53, 0xc, 0x3e, 0x22, 0xb9, 0x20, 0x11, 0xfd, 0xcb, 0x1, 0x4e, 0x20, 0x9, 0x4, 
-0xe, 0x2, 0x3e, 0x18, 0xb8, 0x20, 0x3, 0x5, 0xe, 0x21, 0xc3, 0xd9, 0xd, 0x3a, 0x91, 0x5c, 
-0xf5, 0xfd, 0x36, 0x57, 0x1, 0x3e, 0x20, 0xcd, 0x65, 0xb, 0xf1, 0x32, 0x91, 0x5c, 0xc9, 0xfd, 
-0xcb, 0x1, 0x4e, 0xc2, 0xcd, 0xe, 0xe, 0x21, 0xcd, 0x55, 0xc, 0x5, 0xc3, 0xd9, 0xd, 0xcd, 
-0x3, 0xb, 0x79, 0x3d, 0x3d, 0xe6, 0x10, 0x18, 0x5a, 0x3e, 0x3f, 0x18, 0x6c, 0x11, 0x87, 0xa, 
-0x32, 0xf, 0x5c, 0x18, 0xb, 0x11, 0x6d, 0xa, 0x18, 0x3, 0x11, 0x87, 0xa, 0x32, 0xe, 0x5c, 
-0x2a, 0x51, 0x5c, 0x73, 0x23, 0x72, 0xc9, 0x11, 0xf4, 0x9, 0xcd, 0x80, 0xa, 0x2a, 0xe, 0x5c, 
-0x57, 0x7d, 0xfe, 0x16, 0xda, 0x11, 0x22, 0x20, 0x29, 0x44, 0x4a, 0x3e, 0x1f, 0x91, 0x38, 0xc, 
-0xc6, 0x2, 0x4f, 0xfd, 0xcb, 0x1, 0x4e, 0x20, 0x16, 0x3e, 0x16, 0x90, 0xda, 0x9f, 0x1e, 0x3c, 
-0x47, 0x4, 0xfd, 0xcb, 0x2, 0x46, 0xc2, 0x55, 0xc, 0xfd, 0xbe, 0x31, 0xda, 0x86, 0xc, 0xc3, 
-0xd9, 0xd, 0x7c, 0xcd, 0x3, 0xb, 0x81, 0x3d, 0xe6, 0x1f, 0xc8, 0x57, 0xfd, 0xcb, 0x1, 0xc6, 
-0x3e, 0x20, 0xcd, 0x3b, 0xc, 0x15, 0x20, 0xf8, 0xc9, 0xcd, 0x24, 0xb, 0xfd, 0xcb, 0x1, 0x4e, 
-0x20, 0x1a, 0xfd, 0xcb, 0x2, 0x46, 0x20, 0x8, 0xed, 0x43, 0x88, 0x5c, 0x22, 0x84, 0x5c, 0xc9, 
-0xed, 0x43, 0x8a, 0x5c, 0xed, 0x43, 0x82, 0x5c, 0x22, 0x86, 0x5c, 0xc9, 0xfd, 0x71, 0x45, 0x22, 
-0x80, 0x5c, 0xc9, 0xfd, 0xcb, 0x1, 0x4e, 0x20, 0x14, 0xed, 0x4b, 0x88, 0x5c, 0x2a, 0x84, 0x5c, 
-0xfd, 0xcb, 0x2, 0x46, 0xc8, 0xed, 0x4b, 0x8a, 0x5c, 0x2a, 0x86, 0x5c, 0xc9, 0xfd, 0x4e, 0x45, 
-0x2a, 0x80, 0x5c, 0xc9, 0xfe, 0x80, 0x38, 0x3d, 0xfe, 0x90, 0x30, 0x26, 0x47, 0xcd, 0x38, 0xb, 
-0xcd, 0x3, 0xb, 0x11, 0x92, 0x5c, 0x18, 0x47, 0x21, 0x92, 0x5c, 0xcd, 0x3e, 0xb, 0xcb, 0x18, 
-0x9f, 0xe6, 0xf, 0x4f, 0xcb, 0x18, 0x9f, 0xe6, 0xf0, 0xb1, 0xe, 0x4, 0x77, 0x23, 0xd, 0x20, 
-0xfb, 0xc9, 0xc3, 0x9f, 0x3b, 0x0, 0xc6, 0x15, 0xc5, 0xed, 0x4b, 0x7b, 0x5c, 0x18, 0xb, 0xcd, 
-0x10, 0xc, 0xc3, 0x3, 0xb, 0xc5, 0xed, 0x4b, 0x36, 0x5c, 0xeb, 0x21, 0x3b, 0x5c, 0xcb, 0x86, 
-0xfe, 0x20, 0x20, 0x2, 0xcb, 0xc6, 0x26, 0x0, 0x6f, 0x29, 0x29, 0x29, 0x9, 0xc1, 0xeb, 0x79, 
-0x3d, 0x3e, 0x21, 0x20, 0xe, 0x5, 0x4f, 0xfd, 0xcb, 0x1, 0x4e, 0x28, 0x6, 0xd5, 0xcd, 0xcd, 
-0xe, 0xd1, 0x79, 0xb9, 0xd5, 0xcc, 0x55, 0xc, 0xd1, 0xc5, 0xe5, 0x3a, 0x91, 0x5c, 0x6, 0xff, 
-0x1f, 0x38, 0x1, 0x4, 0x1f, 0x1f, 0x9f, 0x4f, 0x3e, 0x8, 0xa7, 0xfd, 0xcb, 0x1, 0x4e, 0x28, 
-0x5, 0xfd, 0xcb, 0x30, 0xce, 0x37, 0xeb, 0x8, 0x1a, 0xa0, 0xae, 0xa9, 0x12, 0x8, 0x38, 0x13, 
-0x14, 0x23, 0x3d, 0x20, 0xf2, 0xeb, 0x25, 0xfd, 0xcb, 0x1, 0x4e, 0xcc, 0xdb, 0xb, 0xe1, 0xc1, 
-0xd, 0x23, 0xc9, 0x8, 0x3e, 0x20, 0x83, 0x5f, 0x8, 0x18, 0xe6, 0x7c, 0xf, 0xf, 0xf, 0xe6, 
-0x3, 0xf6, 0x58, 0x67, 0xed, 0x5b, 0x8f, 0x5c, 0x7e, 0xab, 0xa2, 0xab, 0xfd, 0xcb, 0x57, 0x76, 
-0x28, 0x8, 0xe6, 0xc7, 0xcb, 0x57, 0x20, 0x2, 0xee, 0x38, 0xfd, 0xcb, 0x57, 0x66, 0x28, 0x8, 
-0xe6, 0xf8, 0xcb, 0x6f, 0x20, 0x2, 0xee, 0x7, 0x77, 0xc9, 0xe5, 0x26, 0x0, 0xe3, 0x18, 0x4, 
-0x11, 0x95, 0x0, 0xf5, 0xcd, 0x41, 0xc, 0x38, 0x9, 0x3e, 0x20, 0xfd, 0xcb, 0x1, 0x46, 0xcc, 
-0x3b, 0xc, 0x1a, 0xe6, 0x7f, 0xcd, 0x3b, 0xc, 0x1a, 0x13, 0x87, 0x30, 0xf5, 0xd1, 0xfe, 0x48, 
-0x28, 0x3, 0xfe, 0x82, 0xd8, 0x7a, 0xfe, 0x3, 0xd8, 0x3e, 0x20, 0xd5, 0xd9, 0xd7, 0xd9, 0xd1, 
-0xc9, 0xf5, 0xeb, 0x3c, 0xcb, 0x7e, 0x23, 0x28, 0xfb, 0x3d, 0x20, 0xf8, 0xeb, 0xf1, 0xfe, 0x20, 
-0xd8, 0x1a, 0xd6, 0x41, 0xc9, 0xfd, 0xcb, 0x1, 0x4e, 0xc0, 0x11, 0xd9, 0xd, 0xd5, 0x78, 0xfd, 
-0xcb, 0x2, 0x46, 0xc2, 0x2, 0xd, 0xfd, 0xbe, 0x31, 0x38, 0x1b, 0xc0, 0xfd, 0xcb, 0x2, 0x66, 
-0x28, 0x16, 0xfd, 0x5e, 0x2d, 0x1d, 0x28, 0x5a, 0x3e, 0x0, 0xcd, 0x1, 0x16, 0xed, 0x7b, 0x3f, 
-0x5c, 0xfd, 0xcb, 0x2, 0xa6, 0xc9, 0xcf, 0x4, 0xfd, 0x35, 0x52, 0x20, 0x45, 0x3e, 0x18, 0x90, 
-0x32, 0x8c, 0x5c, 0x2a, 0x8f, 0x5c, 0xe5, 0x3a, 0x91, 0x5c, 0xf5, 0x3e, 0xfd, 0xcd, 0x1, 0x16, 
-0xaf, 0x11, 0xf8, 0xc, 0xcd, 0xa, 0xc, 0xfd, 0xcb, 0x2, 0xee, 0x21, 0x3b, 0x5c, 0xcb, 0xde, 
-0xcb, 0xae, 0xd9, 0xcd, 0xd4, 0x15, 0xd9, 0xfe, 0x20, 0x28, 0x45, 0xfe, 0xe2, 0x28, 0x41, 0xf6, 
-0x20, 0xfe, 0x6e, 0x28, 0x3b, 0x3e, 0xfe, 0xcd, 0x1, 0x16, 0xf1, 0x32, 0x91, 0x5c, 0xe1, 0x22, 
-0x8f, 0x5c, 0xcd, 0xfe, 0xd, 0xfd, 0x46, 0x31, 0x4, 0xe, 0x21, 0xc5, 0xcd, 0x9b, 0xe, 0x7c, 
-0xf, 0xf, 0xf, 0xe6, 0x3, 0xf6, 0x58, 0x67, 0x11, 0xe0, 0x5a, 0x1a, 0x4e, 0x6, 0x20, 0xeb, 
-0x12, 0x71, 0x13, 0x23, 0x10, 0xfa, 0xc1, 0xc9, 0x80, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0xbf, 
-0xcf, 0xc, 0xfe, 0x2, 0x38, 0x80, 0xfd, 0x86, 0x31, 0xd6, 0x19, 0xd0, 0xed, 0x44, 0xc5, 0x47, 
-0x2a, 0x8f, 0x5c, 0xe5, 0x2a, 0x91, 0x5c, 0xe5, 0xcd, 0x4d, 0xd, 0x78, 0xf5, 0x21, 0x6b, 0x5c, 
-0x46, 0x78, 0x3c, 0x77, 0x21, 0x89, 0x5c, 0xbe, 0x38, 0x3, 0x34, 0x6, 0x18, 0xcd, 0x0, 0xe, 
-0xf1, 0x3d, 0x20, 0xe8, 0xe1, 0xfd, 0x75, 0x57, 0xe1, 0x22, 0x8f, 0x5c, 0xed, 0x4b, 0x88, 0x5c, 
-0xfd, 0xcb, 0x2, 0x86, 0xcd, 0xd9, 0xd, 0xfd, 0xcb, 0x2, 0xc6, 0xc1, 0xc9, 0xaf, 0x2a, 0x8d, 
-0x5c, 0xfd, 0xcb, 0x2, 0x46, 0x28, 0x4, 0x67, 0xfd, 0x6e, 0xe, 0x22, 0x8f, 0x5c, 0x21, 0x91, 
-0x5c, 0x20, 0x2, 0x7e, 0xf, 0xae, 0xe6, 0x55, 0xae, 0x77, 0xc9, 0xcd, 0xaf, 0xd, 0x21, 0x3c, 
-0x5c, 0xcb, 0xae, 0xcb, 0xc6, 0xcd, 0x4d, 0xd, 0xfd, 0x46, 0x31, 0xcd, 0x44, 0xe, 0x21, 0xc0, 
-0x5a, 0x3a, 0x8d, 0x5c, 0x5, 0x18, 0x7, 0xe, 0x20, 0x2b, 0x77, 0xd, 0x20, 0xfb, 0x10, 0xf7, 
-0xfd, 0x36, 0x31, 0x2, 0x3e, 0xfd, 0xcd, 0x1, 0x16, 0x2a, 0x51, 0x5c, 0x11, 0xf4, 0x9, 0xa7, 
-0x73, 0x23, 0x72, 0x23, 0x11, 0xa8, 0x10, 0x3f, 0x38, 0xf6, 0x1, 0x21, 0x17, 0x18, 0x2a, 0x21, 
-0x0, 0x0, 0x22, 0x7d, 0x5c, 0xfd, 0xcb, 0x30, 0x86, 0xcd, 0x94, 0xd, 0x3e, 0xfe, 0xcd, 0x1, 
-0x16, 0xcd, 0x4d, 0xd, 0x6, 0x18, 0xcd, 0x44, 0xe, 0x2a, 0x51, 0x5c, 0x11, 0xf4, 0x9, 0x73, 
-0x23, 0x72, 0xfd, 0x36, 0x52, 0x1, 0x1, 0x21, 0x18, 0x21, 0x0, 0x5b, 0xfd, 0xcb, 0x1, 0x4e, 
-0x20, 0x12, 0x78, 0xfd, 0xcb, 0x2, 0x46, 0x28, 0x5, 0xfd, 0x86, 0x31, 0xd6, 0x18, 0xc5, 0x47, 
-0xcd, 0x9b, 0xe, 0xc1, 0x3e, 0x21, 0x91, 0x5f, 0x16, 0x0, 0x19, 0xc3, 0xdc, 0xa, 0x6, 0x17, 
-0xcd, 0x9b, 0xe, 0xe, 0x8, 0xc5, 0xe5, 0x78, 0xe6, 0x7, 0x78, 0x20, 0xc, 0xeb, 0x21, 0xe0, 
-0xf8, 0x19, 0xeb, 0x1, 0x20, 0x0, 0x3d, 0xed, 0xb0, 0xeb, 0x21, 0xe0, 0xff, 0x19, 0xeb, 0x47, 
-0xe6, 0x7, 0xf, 0xf, 0xf, 0x4f, 0x78, 0x6, 0x0, 0xed, 0xb0, 0x6, 0x7, 0x9, 0xe6, 0xf8, 
-0x20, 0xdb, 0xe1, 0x24, 0xc1, 0xd, 0x20, 0xcd, 0xcd, 0x88, 0xe, 0x21, 0xe0, 0xff, 0x19, 0xeb, 
-0xed, 0xb0, 0x6, 0x1, 0xc5, 0xcd, 0x9b, 0xe, 0xe, 0x8, 0xc5, 0xe5, 0x78, 0xe6, 0x7, 0xf, 
-0xf, 0xf, 0x4f, 0x78, 0x6, 0x0, 0xd, 0x54, 0x5d, 0x36, 0x0, 0x13, 0xed, 0xb0, 0x11, 0x1, 
-0x7, 0x19, 0x3d, 0xe6, 0xf8, 0x47, 0x20, 0xe5, 0xe1, 0x24, 0xc1, 0xd, 0x20, 0xdc, 0xcd, 0x88, 
-0xe, 0x62, 0x6b, 0x13, 0x3a, 0x8d, 0x5c, 0xfd, 0xcb, 0x2, 0x46, 0x28, 0x3, 0x3a, 0x48, 0x5c, 
-0x77, 0xb, 0xed, 0xb0, 0xc1, 0xe, 0x21, 0xc9, 0x7c, 0xf, 0xf, 0xf, 0x3d, 0xf6, 0x50, 0x67, 
-0xeb, 0x61, 0x68, 0x29, 0x29, 0x29, 0x29, 0x29, 0x44, 0x4d, 0xc9, 0x3e, 0x18, 0x90, 0x57, 0xf, 
-0xf, 0xf, 0xe6, 0xe0, 0x6f, 0x7a, 0xe6, 0x18, 0xf6, 0x40, 0x67, 0xc9, 0xf3, 0x6, 0xb0, 0x21, 
-0x0, 0x40, 0xe5, 0xc5, 0xcd, 0xf4, 0xe, 0xc1, 0xe1, 0x24, 0x7c, 0xe6, 0x7, 0x20, 0xa, 0x7d, 
-0xc6, 0x20, 0x6f, 0x3f, 0x9f, 0xe6, 0xf8, 0x84, 0x67, 0x10, 0xe7, 0x18, 0xd, 0xf3, 0x21, 0x0, 
-0x5b, 0x6, 0x8, 0xc5, 0xcd, 0xf4, 0xe, 0xc1, 0x10, 0xf9, 0x3e, 0x4, 0xd3, 0xfb, 0xfb, 0x21, 
-0x0, 0x5b, 0xfd, 0x75, 0x46, 0xaf, 0x47, 0x77, 0x23, 0x10, 0xfc, 0xfd, 0xcb, 0x30, 0x8e, 0xe, 
-0x21, 0xc3, 0xd9, 0xd, 0x78, 0xfe, 0x3, 0x9f, 0xe6, 0x2, 0xd3, 0xfb, 0x57, 0xcd, 0x54, 0x1f, 
-0x38, 0xa, 0x3e, 0x4, 0xd3, 0xfb, 0xfb, 0xcd, 0xdf, 0xe, 0xcf, 0xc, 0xdb, 0xfb, 0x87, 0xf8, 
-0x30, 0xeb, 0xe, 0x20, 0x5e, 0x23, 0x6, 0x8, 0xcb, 0x12, 0xcb, 0x13, 0xcb, 0x1a, 0xdb, 0xfb, 
-0x1f, 0x30, 0xfb, 0x7a, 0xd3, 0xfb, 0x10, 0xf0, 0xd, 0x20, 0xe9, 0xc9, 0x2a, 0x3d, 0x5c, 0xe5, 
-0x21, 0x7f, 0x10, 0xe5, 0xed, 0x73, 0x3d, 0x5c, 0xcd, 0xd4, 0x15, 0xf5, 0x16, 0x0, 0xfd, 0x5e, 
-0xff, 0x21, 0xc8, 0x0, 0xcd, 0xb5, 0x3, 0xf1, 0x21, 0x38, 0xf, 0xe5, 0xfe, 0x18, 0x30, 0x31, 
-0xfe, 0x7, 0x38, 0x2d, 0xfe, 0x10, 0x38, 0x3a, 0x1, 0x2, 0x0, 0x57, 0xfe, 0x16, 0x38, 0xc, 
-0x3, 0xfd, 0xcb, 0x37, 0x7e, 0xca, 0x1e, 0x10, 0xcd, 0xd4, 0x15, 0x5f, 0xcd, 0xd4, 0x15, 0xd5, 
-0x2a, 0x5b, 0x5c, 0xfd, 0xcb, 0x7, 0x86, 0xcd, 0x55, 0x16, 0xc1, 0x23, 0x70, 0x23, 0x71, 0x18, 
-0xa, 0xfd, 0xcb, 0x7, 0x86, 0x2a, 0x5b, 0x5c, 0xcd, 0x52, 0x16, 0x12, 0x13, 0xed, 0x53, 0x5b, 
-0x5c, 0xc9, 0x5f, 0x16, 0x0, 0x21, 0x99, 0xf, 0x19, 0x5e, 0x19, 0xe5, 0x2a, 0x5b, 0x5c, 0xc9, 
-0x9, 0x66, 0x6a, 0x50, 0xb5, 0x70, 0x7e, 0xcf, 0xd4, 0x2a, 0x49, 0x5c, 0xfd, 0xcb, 0x37, 0x6e, 
-0xc2, 0x97, 0x10, 0xcd, 0x6e, 0x19, 0xcd, 0x95, 0x16, 0x7a, 0xb3, 0xca, 0x97, 0x10, 0xe5, 0x23, 
-0x4e, 0x23, 0x46, 0x21, 0xa, 0x0, 0x9, 0x44, 0x4d, 0xcd, 0x5, 0x1f, 0xcd, 0x97, 0x10, 0x2a, 
-0x51, 0x5c, 0xe3, 0xe5, 0x3e, 0xff, 0xcd, 0x1, 0x16, 0xe1, 0x2b, 0xfd, 0x35, 0xf, 0xcd, 0x55, 
-0x18, 0xfd, 0x34, 0xf, 0x2a, 0x59, 0x5c, 0x23, 0x23, 0x23, 0x23, 0x22, 0x5b, 0x5c, 0xe1, 0xcd, 
-0x15, 0x16, 0xc9, 0xfd, 0xcb, 0x37, 0x6e, 0x20, 0x8, 0x21, 0x49, 0x5c, 0xcd, 0xf, 0x19, 0x18, 
-0x6d, 0xfd, 0x36, 0x0, 0x10, 0x18, 0x1d, 0xcd, 0x31, 0x10, 0x18, 0x5, 0x7e, 0xfe, 0xd, 0xc8, 
-0x23, 0x22, 0x5b, 0x5c, 0xc9, 0xcd, 0x31, 0x10, 0x1, 0x1, 0x0, 0xc3, 0xe8, 0x19, 0xcd, 0xd4, 
-0x15, 0xcd, 0xd4, 0x15, 0xe1, 0xe1, 0xe1, 0x22, 0x3d, 0x5c, 0xfd, 0xcb, 0x0, 0x7e, 0xc0, 0xf9, 
-0xc9, 0x37, 0xcd, 0x95, 0x11, 0xed, 0x52, 0x19, 0x23, 0xc1, 0xd8, 0xc5, 0x44, 0x4d, 0x62, 0x6b, 
-0x23, 0x1a, 0xe6, 0xf0, 0xfe, 0x10, 0x20, 0x9, 0x23, 0x1a, 0xd6, 0x17, 0xce, 0x0, 0x20, 0x1, 
-0x23, 0xa7, 0xed, 0x42, 0x9, 0xeb, 0x38, 0xe6, 0xc9, 0xfd, 0xcb, 0x37, 0x6e, 0xc0, 0x2a, 0x49, 
-0x5c, 0xcd, 0x6e, 0x19, 0xeb, 0xcd, 0x95, 0x16, 0x21, 0x4a, 0x5c, 0xcd, 0x1c, 0x19, 0xcd, 0x95, 
-0x17, 0x3e, 0x0, 0xc3, 0x1, 0x16, 0xfd, 0xcb, 0x37, 0x7e, 0x28, 0xa8, 0xc3, 0x81, 0xf, 0xfd, 
-0xcb, 0x30, 0x66, 0x28, 0xa1, 0xfd, 0x36, 0x0, 0xff, 0x16, 0x0, 0xfd, 0x5e, 0xfe, 0x21, 0x90, 
-0x1a, 0xcd, 0xb5, 0x3, 0xc3, 0x30, 0xf, 0xe5, 0xcd, 0x90, 0x11, 0x2b, 0xcd, 0xe5, 0x19, 0x22, 
-0x5b, 0x5c, 0xfd, 0x36, 0x7, 0x0, 0xe1, 0xc9, 0xfd, 0xcb, 0x2, 0x5e, 0xc4, 0x1d, 0x11, 0xa7, 
-0xfd, 0xcb, 0x1, 0x6e, 0xc8, 0x3a, 0x8, 0x5c, 0xfd, 0xcb, 0x1, 0xae, 0xf5, 0xfd, 0xcb, 0x2, 
-0x6e, 0xc4, 0x6e, 0xd, 0xf1, 0xfe, 0x20, 0x30, 0x52, 0xfe, 0x10, 0x30, 0x2d, 0xfe, 0x6, 0x30, 
-0xa, 0x47, 0xe6, 0x1, 0x4f, 0x78, 0x1f, 0xc6, 0x12, 0x18, 0x2a, 0x20, 0x9, 0x21, 0x6a, 0x5c, 
-0x3e, 0x8, 0xae, 0x77, 0x18, 0xe, 0xfe, 0xe, 0xd8, 0xd6, 0xd, 0x21, 0x41, 0x5c, 0xbe, 0x77, 
-0x20, 0x2, 0x36, 0x0, 0xfd, 0xcb, 0x2, 0xde, 0xbf, 0xc9, 0x47, 0xe6, 0x7, 0x4f, 0x3e, 0x10, 
-0xcb, 0x58, 0x20, 0x1, 0x3c, 0xfd, 0x71, 0xd3, 0x11, 0xd, 0x11, 0x18, 0x6, 0x3a, 0xd, 0x5c, 
-0x11, 0xa8, 0x10, 0x2a, 0x4f, 0x5c, 0x23, 0x23, 0x73, 0x23, 0x72, 0x37, 0xc9, 0xcd, 0x4d, 0xd, 
-0xfd, 0xcb, 0x2, 0x9e, 0xfd, 0xcb, 0x2, 0xae, 0x2a, 0x8a, 0x5c, 0xe5, 0x2a, 0x3d, 0x5c, 0xe5, 
-0x21, 0x67, 0x11, 0xe5, 0xed, 0x73, 0x3d, 0x5c, 0x2a, 0x82, 0x5c, 0xe5, 0x37, 0xcd, 0x95, 0x11, 
-0xeb, 0xcd, 0x7d, 0x18, 0xeb, 0xcd, 0xe1, 0x18, 0x2a, 0x8a, 0x5c, 0xe3, 0xeb, 0xcd, 0x4d, 0xd, 
-0x3a, 0x8b, 0x5c, 0x92, 0x38, 0x26, 0x20, 0x6, 0x7b, 0xfd, 0x96, 0x50, 0x30, 0x1e, 0x3e, 0x20, 
-0xd5, 0xcd, 0xf4, 0x9, 0xd1, 0x18, 0xe9, 0x16, 0x0, 0xfd, 0x5e, 0xfe, 0x21, 0x90, 0x1a, 0xcd, 
-0xb5, 0x3, 0xfd, 0x36, 0x0, 0xff, 0xed, 0x5b, 0x8a, 0x5c, 0x18, 0x2, 0xd1, 0xe1, 0xe1, 0x22, 
-0x3d, 0x5c, 0xc1, 0xd5, 0xcd, 0xd9, 0xd, 0xe1, 0x22, 0x82, 0x5c, 0xfd, 0x36, 0x26, 0x0, 0xc9, 
-0x2a, 0x61, 0x5c, 0x2b, 0xa7, 0xed, 0x5b, 0x59, 0x5c, 0xfd, 0xcb, 0x37, 0x6e, 0xc8, 0xed, 0x5b, 
-0x61, 0x5c, 0xd8, 0x2a, 0x63, 0x5c, 0xc9, 0x7e, 0xfe, 0xe, 0x1, 0x6, 0x0, 0xcc, 0xe8, 0x19, 
-0x7e, 0x23, 0xfe, 0xd, 0x20, 0xf1, 0xc9, 0xf3, 0x3e, 0xff, 0xed, 0x5b, 0xb2, 0x5c, 0xd9, 0xed, 
-0x4b, 0xb4, 0x5c, 0xed, 0x5b, 0x38, 0x5c, 0x2a, 0x7b, 0x5c, 0xd9, 0x47, 0x3e, 0x7, 0xd3, 0xfe, 
-0x3e, 0x3f, 0xed, 0x47, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x62, 0x6b, 0x36, 0x2, 0x2b, 0xbc, 
-0x20, 0xfa, 0xa7, 0xed, 0x52, 0x19, 0x23, 0x30, 0x6, 0x35, 0x28, 0x3, 0x35, 0x28, 0xf3, 0x2b, 
-0xd9, 0xed, 0x43, 0xb4, 0x5c, 0xed, 0x53, 0x38, 0x5c, 0x22, 0x7b, 0x5c, 0xd9, 0x4, 0x28, 0x19, 
-0x22, 0xb4, 0x5c, 0x11, 0xaf, 0x3e, 0x1, 0xa8, 0x0, 0xeb, 0xed, 0xb8, 0xeb, 0x23, 0x22, 0x7b, 
-0x5c, 0x2b, 0x1, 0x40, 0x0, 0xed, 0x43, 0x38, 0x5c, 0x22, 0xb2, 0x5c, 0x21, 0x0, 0x3c, 0x22, 
-0x36, 0x5c, 0x2a, 0xb2, 0x5c, 0x36, 0x3e, 0x2b, 0xf9, 0x2b, 0x2b, 0x22, 0x3d, 0x5c, 0xed, 0x56, 
-0xfd, 0x21, 0x3a, 0x5c, 0xfb, 0x21, 0xb6, 0x5c, 0x22, 0x4f, 0x5c, 0x11, 0xaf, 0x15, 0x1, 0x15, 
-0x0, 0xeb, 0xed, 0xb0, 0xeb, 0x2b, 0x22, 0x57, 0x5c, 0x23, 0x22, 0x53, 0x5c, 0x22, 0x4b, 0x5c, 
-0x36, 0x80, 0x23, 0x22, 0x59, 0x5c, 0x36, 0xd, 0x23, 0x36, 0x80, 0x23, 0x22, 0x61, 0x5c, 0x22, 
-0x63, 0x5c, 0x22, 0x65, 0x5c, 0x3e, 0x38, 0x32, 0x8d, 0x5c, 0x32, 0x8f, 0x5c, 0x32, 0x48, 0x5c, 
-0x21, 0x23, 0x5, 0x22, 0x9, 0x5c, 0xfd, 0x35, 0xc6, 0xfd, 0x35, 0xca, 0x21, 0xc6, 0x15, 0x11, 
-0x10, 0x5c, 0x1, 0xe, 0x0, 0xed, 0xb0, 0xfd, 0xcb, 0x1, 0xce, 0xcd, 0xdf, 0xe, 0xfd, 0x36, 
-0x31, 0x2, 0xcd, 0x6b, 0xd, 0xaf, 0x11, 0x38, 0x15, 0xcd, 0xa, 0xc, 0xfd, 0xcb, 0x2, 0xee, 
-0x18, 0x7, 0xfd, 0x36, 0x31, 0x2, 0xcd, 0x95, 0x17, 0xcd, 0xb0, 0x16, 0x3e, 0x0, 0xcd, 0x1, 
-0x16, 0xcd, 0x2c, 0xf, 0xcd, 0x17, 0x1b, 0xfd, 0xcb, 0x0, 0x7e, 0x20, 0x12, 0xfd, 0xcb, 0x30, 
-0x66, 0x28, 0x40, 0x2a, 0x59, 0x5c, 0xcd, 0xa7, 0x11, 0xfd, 0x36, 0x0, 0xff, 0x18, 0xdd, 0x2a, 
-0x59, 0x5c, 0x22, 0x5d, 0x5c, 0xcd, 0xfb, 0x19, 0x78, 0xb1, 0xc2, 0x5d, 0x15, 0xdf, 0xfe, 0xd, 
-0x28, 0xc0, 0xfd, 0xcb, 0x30, 0x46, 0xc4, 0xaf, 0xd, 0xcd, 0x6e, 0xd, 0x3e, 0x19, 0xfd, 0x96, 
-0x4f, 0x32, 0x8c, 0x5c, 0xfd, 0xcb, 0x1, 0xfe, 0xfd, 0x36, 0x0, 0xff, 0xfd, 0x36, 0xa, 0x1, 
-0xcd, 0x8a, 0x1b, 0x76, 0xfd, 0xcb, 0x1, 0xae, 0xfd, 0xcb, 0x30, 0x4e, 0xc4, 0xcd, 0xe, 0x3a, 
-0x3a, 0x5c, 0x3c, 0xf5, 0x21, 0x0, 0x0, 0xfd, 0x74, 0x37, 0xfd, 0x74, 0x26, 0x22, 0xb, 0x5c, 
-0x21, 0x1, 0x0, 0x22, 0x16, 0x5c, 0xcd, 0xb0, 0x16, 0xfd, 0xcb, 0x37, 0xae, 0xcd, 0x6e, 0xd, 
-0xfd, 0xcb, 0x2, 0xee, 0xf1, 0x47, 0xfe, 0xa, 0x38, 0x2, 0xc6, 0x7, 0xcd, 0xef, 0x15, 0x3e, 
-0x20, 0xd7, 0x78, 0x11, 0x91, 0x13, 0xcd, 0xa, 0xc, 0xcd, 0x3b, 0x3b, 0x0, 0xcd, 0xa, 0xc, 
-0xed, 0x4b, 0x45, 0x5c, 0xcd, 0x1b, 0x1a, 0x3e, 0x3a, 0xd7, 0xfd, 0x4e, 0xd, 0x6, 0x0, 0xcd, 
-0x1b, 0x1a, 0xcd, 0x97, 0x10, 0x3a, 0x3a, 0x5c, 0x3c, 0x28, 0x1b, 0xfe, 0x9, 0x28, 0x4, 0xfe, 
-0x15, 0x20, 0x3, 0xfd, 0x34, 0xd, 0x1, 0x3, 0x0, 0x11, 0x70, 0x5c, 0x21, 0x44, 0x5c, 0xcb, 
-0x7e, 0x28, 0x1, 0x9, 0xed, 0xb8, 0xfd, 0x36, 0xa, 0xff, 0xfd, 0xcb, 0x1, 0x9e, 0xc3, 0xac, 
-0x12, 0x80, 0x4f, 0xcb, 0x4e, 0x45, 0x58, 0x54, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 
-0x20, 0x46, 0x4f, 0xd2, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6e, 0x6f, 0x74, 
-0x20, 0x66, 0x6f, 0x75, 0x6e, 0xe4, 0x53, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 
-0x77, 0x72, 0x6f, 0x6e, 0xe7, 0x4f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 
-0x72, 0xf9, 0x4f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x63, 0x72, 0x65, 0x65, 0xee, 0x4e, 
-0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x6f, 0x20, 0x62, 0x69, 0xe7, 0x52, 0x45, 0x54, 
-0x55, 0x52, 0x4e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x47, 0x4f, 0x53, 0x55, 
-0xc2, 0x45, 0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x69, 0x6c, 0xe5, 0x53, 0x54, 0x4f, 0x50, 
-0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0xf4, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 
-0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0xf4, 0x49, 0x6e, 0x74, 0x65, 0x67, 0x65, 
-0x72, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x61, 0x6e, 0x67, 0xe5, 0x4e, 0x6f, 
-0x6e, 0x73, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x42, 0x41, 0x53, 0x49, 0xc3, 0x42, 
-0x52, 0x45, 0x41, 0x4b, 0x20, 0x2d, 0x20, 0x43, 0x4f, 0x4e, 0x54, 0x20, 0x72, 0x65, 0x70, 0x65, 
-0x61, 0x74, 0xf3, 0x4f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x44, 0x41, 0x54, 0xc1, 0x49, 0x6e, 
-0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0xe5, 0x4e, 
-0x6f, 0x20, 0x72, 0x6f, 0x6f, 0x6d, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6c, 0x69, 0x6e, 0xe5, 0x53, 
-0x54, 0x4f, 0x50, 0x20, 0x69, 0x6e, 0x20, 0x49, 0x4e, 0x50, 0x55, 0xd4, 0x46, 0x4f, 0x52, 0x20, 
-0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x4e, 0x45, 0x58, 0xd4, 0x49, 0x6e, 0x76, 0x61, 
-0x6c, 0x69, 0x64, 0x20, 0x49, 0x2f, 0x4f, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0xe5, 0x49, 0x6e, 
-0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0xf2, 0x42, 0x52, 0x45, 0x41, 
-0x4b, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0xed, 0x52, 0x41, 
-0x4d, 0x54, 0x4f, 0x50, 0x20, 0x6e, 0x6f, 0x20, 0x67, 0x6f, 0x6f, 0xe4, 0x53, 0x74, 0x61, 0x74, 
-0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6c, 0x6f, 0x73, 0xf4, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 
-0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0xed, 0x46, 0x4e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 
-0x75, 0x74, 0x20, 0x44, 0x45, 0xc6, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x20, 
-0x65, 0x72, 0x72, 0x6f, 0xf2, 0x54, 0x61, 0x70, 0x65, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 
-0x67, 0x20, 0x65, 0x72, 0x72, 0x6f, 0xf2, 0x2c, 0xa0, 0x7f, 0x20, 0x31, 0x39, 0x38, 0x32, 0x20, 
-0x53, 0x69, 0x6e, 0x63, 0x6c, 0x61, 0x69, 0x72, 0x20, 0x52, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 
-0x68, 0x20, 0x4c, 0x74, 0xe4, 0x3e, 0x10, 0x1, 0x0, 0x0, 0xc3, 0x13, 0x13, 0xed, 0x43, 0x49, 
-0x5c, 0x2a, 0x5d, 0x5c, 0xeb, 0x21, 0x55, 0x15, 0xe5, 0x2a, 0x61, 0x5c, 0x37, 0xed, 0x52, 0xe5, 
-0x60, 0x69, 0xcd, 0x6e, 0x19, 0x20, 0x6, 0xcd, 0xb8, 0x19, 0xcd, 0xe8, 0x19, 0xc1, 0x79, 0x3d, 
-0xb0, 0x28, 0x28, 0xc5, 0x3, 0x3, 0x3, 0x3, 0x2b, 0xed, 0x5b, 0x53, 0x5c, 0xd5, 0xcd, 0x55, 
-0x16, 0xe1, 0x22, 0x53, 0x5c, 0xc1, 0xc5, 0x13, 0x2a, 0x61, 0x5c, 0x2b, 0x2b, 0xed, 0xb8, 0x2a, 
-0x49, 0x5c, 0xeb, 0xc1, 0x70, 0x2b, 0x71, 0x2b, 0x73, 0x2b, 0x72, 0xf1, 0xc3, 0xa2, 0x12, 0xf4, 
-0x9, 0xa8, 0x10, 0x4b, 0xf4, 0x9, 0xc4, 0x15, 0x53, 0x81, 0xf, 0xc4, 0x15, 0x52, 0xf4, 0x9, 
-0xc4, 0x15, 0x50, 0x80, 0xcf, 0x12, 0x1, 0x0, 0x6, 0x0, 0xb, 0x0, 0x1, 0x0, 0x1, 0x0, 
-0x6, 0x0, 0x10, 0x0, 0xfd, 0xcb, 0x2, 0x6e, 0x20, 0x4, 0xfd, 0xcb, 0x2, 0xde, 0xcd, 0xe6, 
-0x15, 0xd8, 0x28, 0xfa, 0xcf, 0x7, 0xd9, 0xe5, 0x2a, 0x51, 0x5c, 0x23, 0x23, 0x18, 0x8, 0x1e, 
-0x30, 0x83, 0xd9, 0xe5, 0x2a, 0x51, 0x5c, 0x5e, 0x23, 0x56, 0xeb, 0xcd, 0x2c, 0x16, 0xe1, 0xd9, 
-0xc9, 0x87, 0xc6, 0x16, 0x6f, 0x26, 0x5c, 0x5e, 0x23, 0x56, 0x7a, 0xb3, 0x20, 0x2, 0xcf, 0x17, 
-0x1b, 0x2a, 0x4f, 0x5c, 0x19, 0x22, 0x51, 0x5c, 0xfd, 0xcb, 0x30, 0xa6, 0x23, 0x23, 0x23, 0x23, 
-0x4e, 0x21, 0x2d, 0x16, 0xcd, 0xdc, 0x16, 0xd0, 0x16, 0x0, 0x5e, 0x19, 0xe9, 0x4b, 0x6, 0x53, 
-0x12, 0x50, 0x1b, 0x0, 0xfd, 0xcb, 0x2, 0xc6, 0xfd, 0xcb, 0x1, 0xae, 0xfd, 0xcb, 0x30, 0xe6, 
-0x18, 0x4, 0xfd, 0xcb, 0x2, 0x86, 0xfd, 0xcb, 0x1, 0x8e, 0xc3, 0x4d, 0xd, 0xfd, 0xcb, 0x1, 
-0xce, 0xc9, 0x1, 0x1, 0x0, 0xe5, 0xcd, 0x5, 0x1f, 0xe1, 0xcd, 0x64, 0x16, 0x2a, 0x65, 0x5c, 
-0xeb, 0xed, 0xb8, 0xc9, 0xf5, 0xe5, 0x21, 0x4b, 0x5c, 0x3e, 0xe, 0x5e, 0x23, 0x56, 0xe3, 0xa7, 
-0xed, 0x52, 0x19, 0xe3, 0x30, 0x9, 0xd5, 0xeb, 0x9, 0xeb, 0x72, 0x2b, 0x73, 0x23, 0xd1, 0x23, 
-0x3d, 0x20, 0xe8, 0xeb, 0xd1, 0xf1, 0xa7, 0xed, 0x52, 0x44, 0x4d, 0x3, 0x19, 0xeb, 0xc9, 0x0, 
-0x0, 0xeb, 0x11, 0x8f, 0x16, 0x7e, 0xe6, 0xc0, 0x20, 0xf7, 0x56, 0x23, 0x5e, 0xc9, 0x2a, 0x63, 
-0x5c, 0x2b, 0xcd, 0x55, 0x16, 0x23, 0x23, 0xc1, 0xed, 0x43, 0x61, 0x5c, 0xc1, 0xeb, 0x23, 0xc9, 
-0x2a, 0x59, 0x5c, 0x36, 0xd, 0x22, 0x5b, 0x5c, 0x23, 0x36, 0x80, 0x23, 0x22, 0x61, 0x5c, 0x2a, 
-0x61, 0x5c, 0x22, 0x63, 0x5c, 0x2a, 0x63, 0x5c, 0x22, 0x65, 0x5c, 0xe5, 0x21, 0x92, 0x5c, 0x22, 
-0x68, 0x5c, 0xe1, 0xc9, 0xed, 0x5b, 0x59, 0x5c, 0xc3, 0xe5, 0x19, 0x23, 0x7e, 0xa7, 0xc8, 0xb9, 
-0x23, 0x20, 0xf8, 0x37, 0xc9, 0xcd, 0x1e, 0x17, 0xcd, 0x1, 0x17, 0x1, 0x0, 0x0, 0x11, 0xe2, 
-0xa3, 0xeb, 0x19, 0x38, 0x7, 0x1, 0xd4, 0x15, 0x9, 0x4e, 0x23, 0x46, 0xeb, 0x71, 0x23, 0x70, 
-0xc9, 0xe5, 0x2a, 0x4f, 0x5c, 0x9, 0x23, 0x23, 0x23, 0x4e, 0xeb, 0x21, 0x16, 0x17, 0xcd, 0xdc, 
-0x16, 0x4e, 0x6, 0x0, 0x9, 0xe9, 0x4b, 0x5, 0x53, 0x3, 0x50, 0x1, 0xe1, 0xc9, 0xcd, 0x94, 
-0x1e, 0xfe, 0x10, 0x38, 0x2, 0xcf, 0x17, 0xc6, 0x3, 0x7, 0x21, 0x10, 0x5c, 0x4f, 0x6, 0x0, 
-0x9, 0x4e, 0x23, 0x46, 0x2b, 0xc9, 0xef, 0x1, 0x38, 0xcd, 0x1e, 0x17, 0x78, 0xb1, 0x28, 0x16, 
-0xeb, 0x2a, 0x4f, 0x5c, 0x9, 0x23, 0x23, 0x23, 0x7e, 0xeb, 0xfe, 0x4b, 0x28, 0x8, 0xfe, 0x53, 
-0x28, 0x4, 0xfe, 0x50, 0x20, 0xcf, 0xcd, 0x5d, 0x17, 0x73, 0x23, 0x72, 0xc9, 0xe5, 0xcd, 0xf1, 
-0x2b, 0x78, 0xb1, 0x20, 0x2, 0xcf, 0xe, 0xc5, 0x1a, 0xe6, 0xdf, 0x4f, 0x21, 0x7a, 0x17, 0xcd, 
-0xdc, 0x16, 0x30, 0xf1, 0x4e, 0x6, 0x0, 0x9, 0xc1, 0xe9, 0x4b, 0x6, 0x53, 0x8, 0x50, 0xa, 
-0x0, 0x1e, 0x1, 0x18, 0x6, 0x1e, 0x6, 0x18, 0x2, 0x1e, 0x10, 0xb, 0x78, 0xb1, 0x20, 0xd5, 
-0x57, 0xe1, 0xc9, 0x18, 0x90, 0xed, 0x73, 0x3f, 0x5c, 0xfd, 0x36, 0x2, 0x10, 0xcd, 0xaf, 0xd, 
-0xfd, 0xcb, 0x2, 0xc6, 0xfd, 0x46, 0x31, 0xcd, 0x44, 0xe, 0xfd, 0xcb, 0x2, 0x86, 0xfd, 0xcb, 
-0x30, 0xc6, 0x2a, 0x49, 0x5c, 0xed, 0x5b, 0x6c, 0x5c, 0xa7, 0xed, 0x52, 0x19, 0x38, 0x22, 0xd5, 
-0xcd, 0x6e, 0x19, 0x11, 0xc0, 0x2, 0xeb, 0xed, 0x52, 0xe3, 0xcd, 0x6e, 0x19, 0xc1, 0xc5, 0xcd, 
-0xb8, 0x19, 0xc1, 0x9, 0x38, 0xe, 0xeb, 0x56, 0x23, 0x5e, 0x2b, 0xed, 0x53, 0x6c, 0x5c, 0x18, 
-0xed, 0x22, 0x6c, 0x5c, 0x2a, 0x6c, 0x5c, 0xcd, 0x6e, 0x19, 0x28, 0x1, 0xeb, 0xcd, 0x33, 0x18, 
-0xfd, 0xcb, 0x2, 0xa6, 0xc9, 0x3e, 0x3, 0x18, 0x2, 0x3e, 0x2, 0xfd, 0x36, 0x2, 0x0, 0xcd, 
-0x30, 0x25, 0xc4, 0x1, 0x16, 0xdf, 0xcd, 0x70, 0x20, 0x38, 0x14, 0xdf, 0xfe, 0x3b, 0x28, 0x4, 
-0xfe, 0x2c, 0x20, 0x6, 0xe7, 0xcd, 0x82, 0x1c, 0x18, 0x8, 0xcd, 0xe6, 0x1c, 0x18, 0x3, 0xcd, 
-0xde, 0x1c, 0xcd, 0xee, 0x1b, 0xcd, 0x99, 0x1e, 0x78, 0xe6, 0x3f, 0x67, 0x69, 0x22, 0x49, 0x5c, 
-0xcd, 0x6e, 0x19, 0x1e, 0x1, 0xcd, 0x55, 0x18, 0xd7, 0xfd, 0xcb, 0x2, 0x66, 0x28, 0xf6, 0x3a, 
-0x6b, 0x5c, 0xfd, 0x96, 0x4f, 0x20, 0xee, 0xab, 0xc8, 0xe5, 0xd5, 0x21, 0x6c, 0x5c, 0xcd, 0xf, 
-0x19, 0xd1, 0xe1, 0x18, 0xe0, 0xed, 0x4b, 0x49, 0x5c, 0xcd, 0x80, 0x19, 0x16, 0x3e, 0x28, 0x5, 
-0x11, 0x0, 0x0, 0xcb, 0x13, 0xfd, 0x73, 0x2d, 0x7e, 0xfe, 0x40, 0xc1, 0xd0, 0xc5, 0xcd, 0x28, 
-0x1a, 0x23, 0x23, 0x23, 0xfd, 0xcb, 0x1, 0x86, 0x7a, 0xa7, 0x28, 0x5, 0xd7, 0xfd, 0xcb, 0x1, 
-0xc6, 0xd5, 0xeb, 0xfd, 0xcb, 0x30, 0x96, 0x21, 0x3b, 0x5c, 0xcb, 0x96, 0xfd, 0xcb, 0x37, 0x6e, 
-0x28, 0x2, 0xcb, 0xd6, 0x2a, 0x5f, 0x5c, 0xa7, 0xed, 0x52, 0x20, 0x5, 0x3e, 0x3f, 0xcd, 0xc1, 
-0x18, 0xcd, 0xe1, 0x18, 0xeb, 0x7e, 0xcd, 0xb6, 0x18, 0x23, 0xfe, 0xd, 0x28, 0x6, 0xeb, 0xcd, 
-0x37, 0x19, 0x18, 0xe0, 0xd1, 0xc9, 0xfe, 0xe, 0xc0, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x7e, 
-0xc9, 0xd9, 0x2a, 0x8f, 0x5c, 0xe5, 0xcb, 0xbc, 0xcb, 0xfd, 0x22, 0x8f, 0x5c, 0x21, 0x91, 0x5c, 
-0x56, 0xd5, 0x36, 0x0, 0xcd, 0xf4, 0x9, 0xe1, 0xfd, 0x74, 0x57, 0xe1, 0x22, 0x8f, 0x5c, 0xd9, 
-0xc9, 0x2a, 0x5b, 0x5c, 0xa7, 0xed, 0x52, 0xc0, 0x3a, 0x41, 0x5c, 0xcb, 0x7, 0x28, 0x4, 0xc6, 
-0x43, 0x18, 0x16, 0x21, 0x3b, 0x5c, 0xcb, 0x9e, 0x3e, 0x4b, 0xcb, 0x56, 0x28, 0xb, 0xcb, 0xde, 
-0x3c, 0xfd, 0xcb, 0x30, 0x5e, 0x28, 0x2, 0x3e, 0x43, 0xd5, 0xcd, 0xc1, 0x18, 0xd1, 0xc9, 0x5e, 
-0x23, 0x56, 0xe5, 0xeb, 0x23, 0xcd, 0x6e, 0x19, 0xcd, 0x95, 0x16, 0xe1, 0xfd, 0xcb, 0x37, 0x6e, 
-0xc0, 0x72, 0x2b, 0x73, 0xc9, 0x7b, 0xa7, 0xf8, 0x18, 0xd, 0xaf, 0x9, 0x3c, 0x38, 0xfc, 0xed, 
-0x42, 0x3d, 0x28, 0xf1, 0xc3, 0xef, 0x15, 0xcd, 0x1b, 0x2d, 0x30, 0x30, 0xfe, 0x21, 0x38, 0x2c, 
-0xfd, 0xcb, 0x1, 0x96, 0xfe, 0xcb, 0x28, 0x24, 0xfe, 0x3a, 0x20, 0xe, 0xfd, 0xcb, 0x37, 0x6e, 
-0x20, 0x16, 0xfd, 0xcb, 0x30, 0x56, 0x28, 0x14, 0x18, 0xe, 0xfe, 0x22, 0x20, 0xa, 0xf5, 0x3a, 
-0x6a, 0x5c, 0xee, 0x4, 0x32, 0x6a, 0x5c, 0xf1, 0xfd, 0xcb, 0x1, 0xd6, 0xd7, 0xc9, 0xe5, 0x2a, 
-0x53, 0x5c, 0x54, 0x5d, 0xc1, 0xcd, 0x80, 0x19, 0xd0, 0xc5, 0xcd, 0xb8, 0x19, 0xeb, 0x18, 0xf4, 
-0x7e, 0xb8, 0xc0, 0x23, 0x7e, 0x2b, 0xb9, 0xc9, 0x23, 0x23, 0x23, 0x22, 0x5d, 0x5c, 0xe, 0x0, 
-0x15, 0xc8, 0xe7, 0xbb, 0x20, 0x4, 0xa7, 0xc9, 0x23, 0x7e, 0xcd, 0xb6, 0x18, 0x22, 0x5d, 0x5c, 
-0xfe, 0x22, 0x20, 0x1, 0xd, 0xfe, 0x3a, 0x28, 0x4, 0xfe, 0xcb, 0x20, 0x4, 0xcb, 0x41, 0x28, 
-0xdf, 0xfe, 0xd, 0x20, 0xe3, 0x15, 0x37, 0xc9, 0xe5, 0x7e, 0xfe, 0x40, 0x38, 0x17, 0xcb, 0x6f, 
-0x28, 0x14, 0x87, 0xfa, 0xc7, 0x19, 0x3f, 0x1, 0x5, 0x0, 0x30, 0x2, 0xe, 0x12, 0x17, 0x23, 
-0x7e, 0x30, 0xfb, 0x18, 0x6, 0x23, 0x23, 0x4e, 0x23, 0x46, 0x23, 0x9, 0xd1, 0xa7, 0xed, 0x52, 
-0x44, 0x4d, 0x19, 0xeb, 0xc9, 0xcd, 0xdd, 0x19, 0xc5, 0x78, 0x2f, 0x47, 0x79, 0x2f, 0x4f, 0x3, 
-0xcd, 0x64, 0x16, 0xeb, 0xe1, 0x19, 0xd5, 0xed, 0xb0, 0xe1, 0xc9, 0x2a, 0x59, 0x5c, 0x2b, 0x22, 
-0x5d, 0x5c, 0xe7, 0x21, 0x92, 0x5c, 0x22, 0x65, 0x5c, 0xcd, 0x3b, 0x2d, 0xcd, 0xa2, 0x2d, 0x38, 
-0x4, 0x21, 0xf0, 0xd8, 0x9, 0xda, 0x8a, 0x1c, 0xc3, 0xc5, 0x16, 0xd5, 0xe5, 0xaf, 0xcb, 0x78, 
-0x20, 0x20, 0x60, 0x69, 0x1e, 0xff, 0x18, 0x8, 0xd5, 0x56, 0x23, 0x5e, 0xe5, 0xeb, 0x1e, 0x20, 
-0x1, 0x18, 0xfc, 0xcd, 0x2a, 0x19, 0x1, 0x9c, 0xff, 0xcd, 0x2a, 0x19, 0xe, 0xf6, 0xcd, 0x2a, 
-0x19, 0x7d, 0xcd, 0xef, 0x15, 0xe1, 0xd1, 0xc9, 0xb1, 0xcb, 0xbc, 0xbf, 0xc4, 0xaf, 0xb4, 0x93, 
-0x91, 0x92, 0x95, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x7f, 0x81, 0x2e, 0x6c, 0x6e, 0x70, 
-0x48, 0x94, 0x56, 0x3f, 0x41, 0x2b, 0x17, 0x1f, 0x37, 0x77, 0x44, 0xf, 0x59, 0x2b, 0x43, 0x2d, 
-0x51, 0x3a, 0x6d, 0x42, 0xd, 0x49, 0x5c, 0x44, 0x15, 0x5d, 0x1, 0x3d, 0x2, 0x6, 0x0, 0x67, 
-0x1e, 0x6, 0xcb, 0x5, 0xf0, 0x1c, 0x6, 0x0, 0xed, 0x1e, 0x0, 0xee, 0x1c, 0x0, 0x23, 0x1f, 
-0x4, 0x3d, 0x6, 0xcc, 0x6, 0x5, 0x3, 0x1d, 0x4, 0x0, 0xab, 0x1d, 0x5, 0xcd, 0x1f, 0x5, 
-0x89, 0x20, 0x5, 0x2, 0x2c, 0x5, 0xb2, 0x1b, 0x0, 0xb7, 0x11, 0x3, 0xa1, 0x1e, 0x5, 0xf9, 
-0x17, 0x8, 0x0, 0x80, 0x1e, 0x3, 0x4f, 0x1e, 0x0, 0x5f, 0x1e, 0x3, 0xac, 0x1e, 0x0, 0x6b, 
-0xd, 0x9, 0x0, 0xdc, 0x22, 0x6, 0x0, 0x3a, 0x1f, 0x5, 0xed, 0x1d, 0x5, 0x27, 0x1e, 0x3, 
-0x42, 0x1e, 0x9, 0x5, 0x82, 0x23, 0x0, 0xac, 0xe, 0x5, 0xc9, 0x1f, 0x5, 0xf5, 0x17, 0xb, 
-0xb, 0xb, 0xb, 0x8, 0x0, 0xf8, 0x3, 0x9, 0x5, 0x20, 0x23, 0x7, 0x7, 0x7, 0x7, 0x7, 
-0x7, 0x8, 0x0, 0x7a, 0x1e, 0x6, 0x0, 0x94, 0x22, 0x5, 0x60, 0x1f, 0x6, 0x2c, 0xa, 0x0, 
-0x36, 0x17, 0x6, 0x0, 0xe5, 0x16, 0xa, 0x0, 0x93, 0x17, 0xa, 0x2c, 0xa, 0x0, 0x93, 0x17, 
-0xa, 0x0, 0x93, 0x17, 0x0, 0x93, 0x17, 0xfd, 0xcb, 0x1, 0xbe, 0xcd, 0xfb, 0x19, 0xaf, 0x32, 
-0x47, 0x5c, 0x3d, 0x32, 0x3a, 0x5c, 0x18, 0x1, 0xe7, 0xcd, 0xbf, 0x16, 0xfd, 0x34, 0xd, 0xfa, 
-0x8a, 0x1c, 0xdf, 0x6, 0x0, 0xfe, 0xd, 0x28, 0x7a, 0xfe, 0x3a, 0x28, 0xeb, 0x21, 0x76, 0x1b, 
-0xe5, 0x4f, 0xe7, 0x79, 0xd6, 0xce, 0xda, 0x8a, 0x1c, 0x4f, 0x21, 0x48, 0x1a, 0x9, 0x4e, 0x9, 
-0x18, 0x3, 0x2a, 0x74, 0x5c, 0x7e, 0x23, 0x22, 0x74, 0x5c, 0x1, 0x52, 0x1b, 0xc5, 0x4f, 0xfe, 
-0x20, 0x30, 0xc, 0x21, 0x1, 0x1c, 0x6, 0x0, 0x9, 0x4e, 0x9, 0xe5, 0xdf, 0x5, 0xc9, 0xdf, 
-0xb9, 0xc2, 0x8a, 0x1c, 0xe7, 0xc9, 0xcd, 0x54, 0x1f, 0x38, 0x2, 0xcf, 0x14, 0xcd, 0x4d, 0x3b, 
-0x0, 0x20, 0x71, 0x2a, 0x42, 0x5c, 0xcb, 0x7c, 0x28, 0x14, 0x21, 0xfe, 0xff, 0x22, 0x45, 0x5c, 
-0x2a, 0x61, 0x5c, 0x2b, 0xed, 0x5b, 0x59, 0x5c, 0x1b, 0x3a, 0x44, 0x5c, 0x18, 0x33, 0xcd, 0x6e, 
-0x19, 0x3a, 0x44, 0x5c, 0x28, 0x19, 0xa7, 0x20, 0x43, 0x47, 0x7e, 0xe6, 0xc0, 0x78, 0x28, 0xf, 
-0xcf, 0xff, 0xc1, 0xcd, 0x30, 0x25, 0xc8, 0x2a, 0x55, 0x5c, 0x3e, 0xc0, 0xa6, 0xc0, 0xaf, 0xfe, 
-0x1, 0xce, 0x0, 0x56, 0x23, 0x5e, 0xed, 0x53, 0x45, 0x5c, 0x23, 0x5e, 0x23, 0x56, 0xeb, 0x19, 
-0x23, 0x22, 0x55, 0x5c, 0xeb, 0x22, 0x5d, 0x5c, 0x57, 0x1e, 0x0, 0xfd, 0x36, 0xa, 0xff, 0x15, 
-0xfd, 0x72, 0xd, 0xca, 0x28, 0x1b, 0x14, 0xcd, 0x8b, 0x19, 0x28, 0x8, 0xcf, 0x16, 0xcd, 0x30, 
-0x25, 0xc0, 0xc1, 0xc1, 0xcd, 0x5d, 0x3b, 0x28, 0xba, 0xfe, 0x3a, 0xca, 0x28, 0x1b, 0xc3, 0x8a, 
-0x1c, 0xf, 0x1d, 0x4b, 0x9, 0x67, 0xb, 0x7b, 0x8e, 0x71, 0xb4, 0x81, 0xcf, 0xcd, 0xde, 0x1c, 
-0xbf, 0xc1, 0xcc, 0xee, 0x1b, 0xeb, 0x2a, 0x74, 0x5c, 0x4e, 0x23, 0x46, 0xeb, 0xc5, 0xc9, 0xcd, 
-0xb2, 0x28, 0xfd, 0x36, 0x37, 0x0, 0x30, 0x8, 0xfd, 0xcb, 0x37, 0xce, 0x20, 0x18, 0xcf, 0x1, 
-0xcc, 0x96, 0x29, 0xfd, 0xcb, 0x1, 0x76, 0x20, 0xd, 0xaf, 0xcd, 0x30, 0x25, 0xc4, 0xf1, 0x2b, 
-0x21, 0x71, 0x5c, 0xb6, 0x77, 0xeb, 0xed, 0x43, 0x72, 0x5c, 0x22, 0x4d, 0x5c, 0xc9, 0xc1, 0xcd, 
-0x56, 0x1c, 0xcd, 0xee, 0x1b, 0xc9, 0x3a, 0x3b, 0x5c, 0xf5, 0xcd, 0xfb, 0x24, 0xf1, 0xfd, 0x56, 
-0x1, 0xaa, 0xe6, 0x40, 0x20, 0x24, 0xcb, 0x7a, 0xc2, 0xff, 0x2a, 0xc9, 0xcd, 0xb2, 0x28, 0xf5, 
-0x79, 0xf6, 0x9f, 0x3c, 0x20, 0x14, 0xf1, 0x18, 0xa9, 0xe7, 0xcd, 0x82, 0x1c, 0xfe, 0x2c, 0x20, 
-0x9, 0xe7, 0xcd, 0xfb, 0x24, 0xfd, 0xcb, 0x1, 0x76, 0xc0, 0xcf, 0xb, 0xcd, 0xfb, 0x24, 0xfd, 
-0xcb, 0x1, 0x76, 0xc8, 0x18, 0xf4, 0xfd, 0xcb, 0x1, 0x7e, 0xfd, 0xcb, 0x2, 0x86, 0xc4, 0x4d, 
-0xd, 0xf1, 0x3a, 0x74, 0x5c, 0xd6, 0x13, 0xcd, 0xfc, 0x21, 0xcd, 0xee, 0x1b, 0x2a, 0x8f, 0x5c, 
-0x22, 0x8d, 0x5c, 0x21, 0x91, 0x5c, 0x7e, 0x7, 0xae, 0xe6, 0xaa, 0xae, 0x77, 0xc9, 0xcd, 0x30, 
-0x25, 0x28, 0x13, 0xfd, 0xcb, 0x2, 0x86, 0xcd, 0x4d, 0xd, 0x21, 0x90, 0x5c, 0x7e, 0xf6, 0xf8, 
-0x77, 0xfd, 0xcb, 0x57, 0xb6, 0xdf, 0xcd, 0xe2, 0x21, 0x18, 0x9f, 0xc3, 0x5, 0x6, 0xfe, 0xd, 
-0x28, 0x4, 0xfe, 0x3a, 0x20, 0x9c, 0xcd, 0x30, 0x25, 0xc8, 0xef, 0xa0, 0x38, 0xc9, 0xcf, 0x8, 
-0xc1, 0xcd, 0x30, 0x25, 0x28, 0xa, 0xef, 0x2, 0x38, 0xeb, 0xcd, 0xe9, 0x34, 0xda, 0xb3, 0x1b, 
-0xc3, 0x29, 0x1b, 0xfe, 0xcd, 0x20, 0x9, 0xe7, 0xcd, 0x82, 0x1c, 0xcd, 0xee, 0x1b, 0x18, 0x6, 
-0xcd, 0xee, 0x1b, 0xef, 0xa1, 0x38, 0xef, 0xc0, 0x2, 0x1, 0xe0, 0x1, 0x38, 0xcd, 0xff, 0x2a, 
-0x22, 0x68, 0x5c, 0x2b, 0x7e, 0xcb, 0xfe, 0x1, 0x6, 0x0, 0x9, 0x7, 0x38, 0x6, 0xe, 0xd, 
-0xcd, 0x55, 0x16, 0x23, 0xe5, 0xef, 0x2, 0x2, 0x38, 0xe1, 0xeb, 0xe, 0xa, 0xed, 0xb0, 0x2a, 
-0x45, 0x5c, 0xeb, 0x73, 0x23, 0x72, 0xfd, 0x56, 0xd, 0x14, 0x23, 0x72, 0xcd, 0xda, 0x1d, 0xd0, 
-0xfd, 0x46, 0x38, 0x2a, 0x45, 0x5c, 0x22, 0x42, 0x5c, 0x3a, 0x47, 0x5c, 0xed, 0x44, 0x57, 0x2a, 
-0x5d, 0x5c, 0x1e, 0xf3, 0xc5, 0xed, 0x4b, 0x55, 0x5c, 0xcd, 0x86, 0x1d, 0xed, 0x43, 0x55, 0x5c, 
-0xc1, 0x38, 0x11, 0xe7, 0xf6, 0x20, 0xb8, 0x28, 0x3, 0xe7, 0x18, 0xe8, 0xe7, 0x3e, 0x1, 0x92, 
-0x32, 0x44, 0x5c, 0xc9, 0xcf, 0x11, 0x7e, 0xfe, 0x3a, 0x28, 0x18, 0x23, 0x7e, 0xe6, 0xc0, 0x37, 
-0xc0, 0x46, 0x23, 0x4e, 0xed, 0x43, 0x42, 0x5c, 0x23, 0x4e, 0x23, 0x46, 0xe5, 0x9, 0x44, 0x4d, 
-0xe1, 0x16, 0x0, 0xc5, 0xcd, 0x8b, 0x19, 0xc1, 0xd0, 0x18, 0xe0, 0xfd, 0xcb, 0x37, 0x4e, 0xc2, 
-0x2e, 0x1c, 0x2a, 0x4d, 0x5c, 0xcb, 0x7e, 0x28, 0x1f, 0x23, 0x22, 0x68, 0x5c, 0xef, 0xe0, 0xe2, 
-0xf, 0xc0, 0x2, 0x38, 0xcd, 0xda, 0x1d, 0xd8, 0x2a, 0x68, 0x5c, 0x11, 0xf, 0x0, 0x19, 0x5e, 
-0x23, 0x56, 0x23, 0x66, 0xeb, 0xc3, 0x73, 0x1e, 0xcf, 0x0, 0xef, 0xe1, 0xe0, 0xe2, 0x36, 0x0, 
-0x2, 0x1, 0x3, 0x37, 0x0, 0x4, 0x38, 0xa7, 0xc9, 0x38, 0x37, 0xc9, 0xe7, 0xcd, 0x1f, 0x1c, 
-0xcd, 0x30, 0x25, 0x28, 0x29, 0xdf, 0x22, 0x5f, 0x5c, 0x2a, 0x57, 0x5c, 0x7e, 0xfe, 0x2c, 0x28, 
-0x9, 0x1e, 0xe4, 0xcd, 0x86, 0x1d, 0x30, 0x2, 0xcf, 0xd, 0xcd, 0x77, 0x0, 0xcd, 0x56, 0x1c, 
-0xdf, 0x22, 0x57, 0x5c, 0x2a, 0x5f, 0x5c, 0xfd, 0x36, 0x26, 0x0, 0xcd, 0x78, 0x0, 0xdf, 0xfe, 
-0x2c, 0x28, 0xc9, 0xcd, 0xee, 0x1b, 0xc9, 0xcd, 0x30, 0x25, 0x20, 0xb, 0xcd, 0xfb, 0x24, 0xfe, 
-0x2c, 0xc4, 0xee, 0x1b, 0xe7, 0x18, 0xf5, 0x3e, 0xe4, 0x47, 0xed, 0xb9, 0x11, 0x0, 0x2, 0xc3, 
-0x8b, 0x19, 0xcd, 0x99, 0x1e, 0x60, 0x69, 0xcd, 0x6e, 0x19, 0x2b, 0x22, 0x57, 0x5c, 0xc9, 0xcd, 
-0x99, 0x1e, 0x78, 0xb1, 0x20, 0x4, 0xed, 0x4b, 0x78, 0x5c, 0xed, 0x43, 0x76, 0x5c, 0xc9, 0x2a, 
-0x6e, 0x5c, 0xfd, 0x56, 0x36, 0x18, 0xc, 0xcd, 0x99, 0x1e, 0x60, 0x69, 0x16, 0x0, 0x7c, 0xfe, 
-0xf0, 0x30, 0x2c, 0x22, 0x42, 0x5c, 0xfd, 0x72, 0xa, 0xc9, 0xcd, 0x85, 0x1e, 0xed, 0x79, 0xc9, 
-0xcd, 0x85, 0x1e, 0x2, 0xc9, 0xcd, 0xd5, 0x2d, 0x38, 0x15, 0x28, 0x2, 0xed, 0x44, 0xf5, 0xcd, 
-0x99, 0x1e, 0xf1, 0xc9, 0xcd, 0xd5, 0x2d, 0x18, 0x3, 0xcd, 0xa2, 0x2d, 0x38, 0x1, 0xc8, 0xcf, 
-0xa, 0xcd, 0x67, 0x1e, 0x1, 0x0, 0x0, 0xcd, 0x45, 0x1e, 0x18, 0x3, 0xcd, 0x99, 0x1e, 0x78, 
-0xb1, 0x20, 0x4, 0xed, 0x4b, 0xb2, 0x5c, 0xc5, 0xed, 0x5b, 0x4b, 0x5c, 0x2a, 0x59, 0x5c, 0x2b, 
-0xcd, 0xe5, 0x19, 0xcd, 0x6b, 0xd, 0x2a, 0x65, 0x5c, 0x11, 0x32, 0x0, 0x19, 0xd1, 0xed, 0x52, 
-0x30, 0x8, 0x2a, 0xb4, 0x5c, 0xa7, 0xed, 0x52, 0x30, 0x2, 0xcf, 0x15, 0xeb, 0x22, 0xb2, 0x5c, 
-0xd1, 0xc1, 0x36, 0x3e, 0x2b, 0xf9, 0xc5, 0xed, 0x73, 0x3d, 0x5c, 0xeb, 0xe9, 0xd1, 0xfd, 0x66, 
-0xd, 0x24, 0xe3, 0x33, 0xed, 0x4b, 0x45, 0x5c, 0xc5, 0xe5, 0xed, 0x73, 0x3d, 0x5c, 0xd5, 0xcd, 
-0x67, 0x1e, 0x1, 0x14, 0x0, 0x2a, 0x65, 0x5c, 0x9, 0x38, 0xa, 0xeb, 0x21, 0x50, 0x0, 0x19, 
-0x38, 0x3, 0xed, 0x72, 0xd8, 0x2e, 0x3, 0xc3, 0x55, 0x0, 0x1, 0x0, 0x0, 0xcd, 0x5, 0x1f, 
-0x44, 0x4d, 0xc9, 0xc1, 0xe1, 0xd1, 0x7a, 0xfe, 0x3e, 0x28, 0xb, 0x3b, 0xe3, 0xeb, 0xed, 0x73, 
-0x3d, 0x5c, 0xc5, 0xc3, 0x73, 0x1e, 0xd5, 0xe5, 0xcf, 0x6, 0xcd, 0x99, 0x1e, 0x76, 0xb, 0x78, 
-0xb1, 0x28, 0xc, 0x78, 0xa1, 0x3c, 0x20, 0x1, 0x3, 0xfd, 0xcb, 0x1, 0x6e, 0x28, 0xee, 0xfd, 
-0xcb, 0x1, 0xae, 0xc9, 0x3e, 0x7f, 0xdb, 0xfe, 0x1f, 0xd8, 0x3e, 0xfe, 0xdb, 0xfe, 0x1f, 0xc9, 
-0xcd, 0x30, 0x25, 0x28, 0x5, 0x3e, 0xce, 0xc3, 0x39, 0x1e, 0xfd, 0xcb, 0x1, 0xf6, 0xcd, 0x8d, 
-0x2c, 0x30, 0x16, 0xe7, 0xfe, 0x24, 0x20, 0x5, 0xfd, 0xcb, 0x1, 0xb6, 0xe7, 0xfe, 0x28, 0x20, 
-0x3c, 0xe7, 0xfe, 0x29, 0x28, 0x20, 0xcd, 0x8d, 0x2c, 0xd2, 0x8a, 0x1c, 0xeb, 0xe7, 0xfe, 0x24, 
-0x20, 0x2, 0xeb, 0xe7, 0xeb, 0x1, 0x6, 0x0, 0xcd, 0x55, 0x16, 0x23, 0x23, 0x36, 0xe, 0xfe, 
-0x2c, 0x20, 0x3, 0xe7, 0x18, 0xe0, 0xfe, 0x29, 0x20, 0x13, 0xe7, 0xfe, 0x3d, 0x20, 0xe, 0xe7, 
-0x3a, 0x3b, 0x5c, 0xf5, 0xcd, 0xfb, 0x24, 0xf1, 0xfd, 0xae, 0x1, 0xe6, 0x40, 0xc2, 0x8a, 0x1c, 
-0xcd, 0xee, 0x1b, 0xcd, 0x30, 0x25, 0xe1, 0xc8, 0xe9, 0x3e, 0x3, 0x18, 0x2, 0x3e, 0x2, 0xcd, 
-0x30, 0x25, 0xc4, 0x1, 0x16, 0xcd, 0x4d, 0xd, 0xcd, 0xdf, 0x1f, 0xcd, 0xee, 0x1b, 0xc9, 0xdf, 
-0xcd, 0x45, 0x20, 0x28, 0xd, 0xcd, 0x4e, 0x20, 0x28, 0xfb, 0xcd, 0xfc, 0x1f, 0xcd, 0x4e, 0x20, 
-0x28, 0xf3, 0xfe, 0x29, 0xc8, 0xcd, 0xc3, 0x1f, 0x3e, 0xd, 0xd7, 0xc9, 0xdf, 0xfe, 0xac, 0x20, 
-0xd, 0xcd, 0x79, 0x1c, 0xcd, 0xc3, 0x1f, 0xcd, 0x7, 0x23, 0x3e, 0x16, 0x18, 0x10, 0xfe, 0xad, 
-0x20, 0x12, 0xe7, 0xcd, 0x82, 0x1c, 0xcd, 0xc3, 0x1f, 0xcd, 0x99, 0x1e, 0x3e, 0x17, 0xd7, 0x79, 
-0xd7, 0x78, 0xd7, 0xc9, 0xcd, 0xf2, 0x21, 0xd0, 0xcd, 0x70, 0x20, 0xd0, 0xcd, 0xfb, 0x24, 0xcd, 
-0xc3, 0x1f, 0xfd, 0xcb, 0x1, 0x76, 0xcc, 0xf1, 0x2b, 0xc2, 0xe3, 0x2d, 0x78, 0xb1, 0xb, 0xc8, 
-0x1a, 0x13, 0xd7, 0x18, 0xf7, 0xfe, 0x29, 0xc8, 0xfe, 0xd, 0xc8, 0xfe, 0x3a, 0xc9, 0xdf, 0xfe, 
-0x3b, 0x28, 0x14, 0xfe, 0x2c, 0x20, 0xa, 0xcd, 0x30, 0x25, 0x28, 0xb, 0x3e, 0x6, 0xd7, 0x18, 
-0x6, 0xfe, 0x27, 0xc0, 0xcd, 0xf5, 0x1f, 0xe7, 0xcd, 0x45, 0x20, 0x20, 0x1, 0xc1, 0xbf, 0xc9, 
-0xfe, 0x23, 0x37, 0xc0, 0xe7, 0xcd, 0x82, 0x1c, 0xa7, 0xcd, 0xc3, 0x1f, 0xcd, 0x94, 0x1e, 0xfe, 
-0x10, 0xd2, 0xe, 0x16, 0xcd, 0x1, 0x16, 0xa7, 0xc9, 0xcd, 0x30, 0x25, 0x28, 0x8, 0x3e, 0x1, 
-0xcd, 0x1, 0x16, 0xcd, 0x6e, 0xd, 0xfd, 0x36, 0x2, 0x1, 0xcd, 0xc1, 0x20, 0xcd, 0xee, 0x1b, 
-0xed, 0x4b, 0x88, 0x5c, 0x3a, 0x6b, 0x5c, 0xb8, 0x38, 0x3, 0xe, 0x21, 0x47, 0xed, 0x43, 0x88, 
-0x5c, 0x3e, 0x19, 0x90, 0x32, 0x8c, 0x5c, 0xfd, 0xcb, 0x2, 0x86, 0xcd, 0xd9, 0xd, 0xc3, 0x6e, 
-0xd, 0xcd, 0x4e, 0x20, 0x28, 0xfb, 0xfe, 0x28, 0x20, 0xe, 0xe7, 0xcd, 0xdf, 0x1f, 0xdf, 0xfe, 
-0x29, 0xc2, 0x8a, 0x1c, 0xe7, 0xc3, 0xb2, 0x21, 0xfe, 0xca, 0x20, 0x11, 0xe7, 0xcd, 0x1f, 0x1c, 
-0xfd, 0xcb, 0x37, 0xfe, 0xfd, 0xcb, 0x1, 0x76, 0xc2, 0x8a, 0x1c, 0x18, 0xd, 0xcd, 0x8d, 0x2c, 
-0xd2, 0xaf, 0x21, 0xcd, 0x1f, 0x1c, 0xfd, 0xcb, 0x37, 0xbe, 0xcd, 0x30, 0x25, 0xca, 0xb2, 0x21, 
-0xcd, 0xbf, 0x16, 0x21, 0x71, 0x5c, 0xcb, 0xb6, 0xcb, 0xee, 0x1, 0x1, 0x0, 0xcb, 0x7e, 0x20, 
-0xb, 0x3a, 0x3b, 0x5c, 0xe6, 0x40, 0x20, 0x2, 0xe, 0x3, 0xb6, 0x77, 0xf7, 0x36, 0xd, 0x79, 
-0xf, 0xf, 0x30, 0x5, 0x3e, 0x22, 0x12, 0x2b, 0x77, 0x22, 0x5b, 0x5c, 0xfd, 0xcb, 0x37, 0x7e, 
-0x20, 0x2c, 0x2a, 0x5d, 0x5c, 0xe5, 0x2a, 0x3d, 0x5c, 0xe5, 0x21, 0x3a, 0x21, 0xe5, 0xfd, 0xcb, 
-0x30, 0x66, 0x28, 0x4, 0xed, 0x73, 0x3d, 0x5c, 0x2a, 0x61, 0x5c, 0xcd, 0xa7, 0x11, 0xfd, 0x36, 
-0x0, 0xff, 0xcd, 0x2c, 0xf, 0xfd, 0xcb, 0x1, 0xbe, 0xcd, 0xb9, 0x21, 0x18, 0x3, 0xcd, 0x2c, 
-0xf, 0xfd, 0x36, 0x22, 0x0, 0xcd, 0xd6, 0x21, 0x20, 0xa, 0xcd, 0x1d, 0x11, 0xed, 0x4b, 0x82, 
-0x5c, 0xcd, 0xd9, 0xd, 0x21, 0x71, 0x5c, 0xcb, 0xae, 0xcb, 0x7e, 0xcb, 0xbe, 0x20, 0x1c, 0xe1, 
-0xe1, 0x22, 0x3d, 0x5c, 0xe1, 0x22, 0x5f, 0x5c, 0xfd, 0xcb, 0x1, 0xfe, 0xcd, 0xb9, 0x21, 0x2a, 
-0x5f, 0x5c, 0xfd, 0x36, 0x26, 0x0, 0x22, 0x5d, 0x5c, 0x18, 0x17, 0x2a, 0x63, 0x5c, 0xed, 0x5b, 
-0x61, 0x5c, 0x37, 0xed, 0x52, 0x44, 0x4d, 0xcd, 0xb2, 0x2a, 0xcd, 0xff, 0x2a, 0x18, 0x3, 0xcd, 
-0xfc, 0x1f, 0xcd, 0x4e, 0x20, 0xca, 0xc1, 0x20, 0xc9, 0x2a, 0x61, 0x5c, 0x22, 0x5d, 0x5c, 0xdf, 
-0xfe, 0xe2, 0x28, 0xc, 0x3a, 0x71, 0x5c, 0xcd, 0x59, 0x1c, 0xdf, 0xfe, 0xd, 0xc8, 0xcf, 0xb, 
-0xcd, 0x30, 0x25, 0xc8, 0xcf, 0x10, 0x2a, 0x51, 0x5c, 0x23, 0x23, 0x23, 0x23, 0x7e, 0xfe, 0x4b, 
-0xc9, 0xe7, 0xcd, 0xf2, 0x21, 0xd8, 0xdf, 0xfe, 0x2c, 0x28, 0xf6, 0xfe, 0x3b, 0x28, 0xf2, 0xc3, 
-0x8a, 0x1c, 0xfe, 0xd9, 0xd8, 0xfe, 0xdf, 0x3f, 0xd8, 0xf5, 0xe7, 0xf1, 0xd6, 0xc9, 0xf5, 0xcd, 
-0x82, 0x1c, 0xf1, 0xa7, 0xcd, 0xc3, 0x1f, 0xf5, 0xcd, 0x94, 0x1e, 0x57, 0xf1, 0xd7, 0x7a, 0xd7, 
-0xc9, 0xd6, 0x11, 0xce, 0x0, 0x28, 0x1d, 0xd6, 0x2, 0xce, 0x0, 0x28, 0x56, 0xfe, 0x1, 0x7a, 
-0x6, 0x1, 0x20, 0x4, 0x7, 0x7, 0x6, 0x4, 0x4f, 0x7a, 0xfe, 0x2, 0x30, 0x16, 0x79, 0x21, 
-0x91, 0x5c, 0x18, 0x38, 0x7a, 0x6, 0x7, 0x38, 0x5, 0x7, 0x7, 0x7, 0x6, 0x38, 0x4f, 0x7a, 
-0xfe, 0xa, 0x38, 0x2, 0xcf, 0x13, 0x21, 0x8f, 0x5c, 0xfe, 0x8, 0x38, 0xb, 0x7e, 0x28, 0x7, 
-0xb0, 0x2f, 0xe6, 0x24, 0x28, 0x1, 0x78, 0x4f, 0x79, 0xcd, 0x6c, 0x22, 0x3e, 0x7, 0xba, 0x9f, 
-0xcd, 0x6c, 0x22, 0x7, 0x7, 0xe6, 0x50, 0x47, 0x3e, 0x8, 0xba, 0x9f, 0xae, 0xa0, 0xae, 0x77, 
-0x23, 0x78, 0xc9, 0x9f, 0x7a, 0xf, 0x6, 0x80, 0x20, 0x3, 0xf, 0x6, 0x40, 0x4f, 0x7a, 0xfe, 
-0x8, 0x28, 0x4, 0xfe, 0x2, 0x30, 0xbd, 0x79, 0x21, 0x8f, 0x5c, 0xcd, 0x6c, 0x22, 0x79, 0xf, 
-0xf, 0xf, 0x18, 0xd8, 0xcd, 0x94, 0x1e, 0xfe, 0x8, 0x30, 0xa9, 0xd3, 0xfe, 0x7, 0x7, 0x7, 
-0xcb, 0x6f, 0x20, 0x2, 0xee, 0x7, 0x32, 0x48, 0x5c, 0xc9, 0x3e, 0xaf, 0x90, 0xda, 0xf9, 0x24, 
-0x47, 0xa7, 0x1f, 0x37, 0x1f, 0xa7, 0x1f, 0xa8, 0xe6, 0xf8, 0xa8, 0x67, 0x79, 0x7, 0x7, 0x7, 
-0xa8, 0xe6, 0xc7, 0xa8, 0x7, 0x7, 0x6f, 0x79, 0xe6, 0x7, 0xc9, 0xcd, 0x7, 0x23, 0xcd, 0xaa, 
-0x22, 0x47, 0x4, 0x7e, 0x7, 0x10, 0xfd, 0xe6, 0x1, 0xc3, 0x28, 0x2d, 0xcd, 0x7, 0x23, 0xcd, 
-0xe5, 0x22, 0xc3, 0x4d, 0xd, 0xed, 0x43, 0x7d, 0x5c, 0xcd, 0xaa, 0x22, 0x47, 0x4, 0x3e, 0xfe, 
-0xf, 0x10, 0xfd, 0x47, 0x7e, 0xfd, 0x4e, 0x57, 0xcb, 0x41, 0x20, 0x1, 0xa0, 0xcb, 0x51, 0x20, 
-0x2, 0xa8, 0x2f, 0x77, 0xc3, 0xdb, 0xb, 0xcd, 0x14, 0x23, 0x47, 0xc5, 0xcd, 0x14, 0x23, 0x59, 
-0xc1, 0x51, 0x4f, 0xc9, 0xcd, 0xd5, 0x2d, 0xda, 0xf9, 0x24, 0xe, 0x1, 0xc8, 0xe, 0xff, 0xc9, 
-0xdf, 0xfe, 0x2c, 0xc2, 0x8a, 0x1c, 0xe7, 0xcd, 0x82, 0x1c, 0xcd, 0xee, 0x1b, 0xef, 0x2a, 0x3d, 
-0x38, 0x7e, 0xfe, 0x81, 0x30, 0x5, 0xef, 0x2, 0x38, 0x18, 0xa1, 0xef, 0xa3, 0x38, 0x36, 0x83, 
-0xef, 0xc5, 0x2, 0x38, 0xcd, 0x7d, 0x24, 0xc5, 0xef, 0x31, 0xe1, 0x4, 0x38, 0x7e, 0xfe, 0x80, 
-0x30, 0x8, 0xef, 0x2, 0x2, 0x38, 0xc1, 0xc3, 0xdc, 0x22, 0xef, 0xc2, 0x1, 0xc0, 0x2, 0x3, 
-0x1, 0xe0, 0xf, 0xc0, 0x1, 0x31, 0xe0, 0x1, 0x31, 0xe0, 0xa0, 0xc1, 0x2, 0x38, 0xfd, 0x34, 
-0x62, 0xcd, 0x94, 0x1e, 0x6f, 0xe5, 0xcd, 0x94, 0x1e, 0xe1, 0x67, 0x22, 0x7d, 0x5c, 0xc1, 0xc3, 
-0x20, 0x24, 0xdf, 0xfe, 0x2c, 0x28, 0x6, 0xcd, 0xee, 0x1b, 0xc3, 0x77, 0x24, 0xe7, 0xcd, 0x82, 
-0x1c, 0xcd, 0xee, 0x1b, 0xef, 0xc5, 0xa2, 0x4, 0x1f, 0x31, 0x30, 0x30, 0x0, 0x6, 0x2, 0x38, 
-0xc3, 0x77, 0x24, 0xc0, 0x2, 0xc1, 0x2, 0x31, 0x2a, 0xe1, 0x1, 0xe1, 0x2a, 0xf, 0xe0, 0x5, 
-0x2a, 0xe0, 0x1, 0x3d, 0x38, 0x7e, 0xfe, 0x81, 0x30, 0x7, 0xef, 0x2, 0x2, 0x38, 0xc3, 0x77, 
-0x24, 0xcd, 0x7d, 0x24, 0xc5, 0xef, 0x2, 0xe1, 0x1, 0x5, 0xc1, 0x2, 0x1, 0x31, 0xe1, 0x4, 
-0xc2, 0x2, 0x1, 0x31, 0xe1, 0x4, 0xe2, 0xe5, 0xe0, 0x3, 0xa2, 0x4, 0x31, 0x1f, 0xc5, 0x2, 
-0x20, 0xc0, 0x2, 0xc2, 0x2, 0xc1, 0xe5, 0x4, 0xe0, 0xe2, 0x4, 0xf, 0xe1, 0x1, 0xc1, 0x2, 
-0xe0, 0x4, 0xe2, 0xe5, 0x4, 0x3, 0xc2, 0x2a, 0xe1, 0x2a, 0xf, 0x2, 0x38, 0x1a, 0xfe, 0x81, 
-0xc1, 0xda, 0x77, 0x24, 0xc5, 0xef, 0x1, 0x38, 0x3a, 0x7d, 0x5c, 0xcd, 0x28, 0x2d, 0xef, 0xc0, 
-0xf, 0x1, 0x38, 0x3a, 0x7e, 0x5c, 0xcd, 0x28, 0x2d, 0xef, 0xc5, 0xf, 0xe0, 0xe5, 0x38, 0xc1, 
-0x5, 0x28, 0x3c, 0x18, 0x14, 0xef, 0xe1, 0x31, 0xe3, 0x4, 0xe2, 0xe4, 0x4, 0x3, 0xc1, 0x2, 
-0xe4, 0x4, 0xe2, 0xe3, 0x4, 0xf, 0xc2, 0x2, 0x38, 0xc5, 0xef, 0xc0, 0x2, 0xe1, 0xf, 0x31, 
-0x38, 0x3a, 0x7d, 0x5c, 0xcd, 0x28, 0x2d, 0xef, 0x3, 0xe0, 0xe2, 0xf, 0xc0, 0x1, 0xe0, 0x38, 
-0x3a, 0x7e, 0x5c, 0xcd, 0x28, 0x2d, 0xef, 0x3, 0x38, 0xcd, 0xb7, 0x24, 0xc1, 0x10, 0xc6, 0xef, 
-0x2, 0x2, 0x1, 0x38, 0x3a, 0x7d, 0x5c, 0xcd, 0x28, 0x2d, 0xef, 0x3, 0x1, 0x38, 0x3a, 0x7e, 
-0x5c, 0xcd, 0x28, 0x2d, 0xef, 0x3, 0x38, 0xcd, 0xb7, 0x24, 0xc3, 0x4d, 0xd, 0xef, 0x31, 0x28, 
-0x34, 0x32, 0x0, 0x1, 0x5, 0xe5, 0x1, 0x5, 0x2a, 0x38, 0xcd, 0xd5, 0x2d, 0x38, 0x6, 0xe6, 
-0xfc, 0xc6, 0x4, 0x30, 0x2, 0x3e, 0xfc, 0xf5, 0xcd, 0x28, 0x2d, 0xef, 0xe5, 0x1, 0x5, 0x31, 
-0x1f, 0xc4, 0x2, 0x31, 0xa2, 0x4, 0x1f, 0xc1, 0x1, 0xc0, 0x2, 0x31, 0x4, 0x31, 0xf, 0xa1, 
-0x3, 0x1b, 0xc3, 0x2, 0x38, 0xc1, 0xc9, 0xcd, 0x7, 0x23, 0x79, 0xb8, 0x30, 0x6, 0x69, 0xd5, 
-0xaf, 0x5f, 0x18, 0x7, 0xb1, 0xc8, 0x68, 0x41, 0xd5, 0x16, 0x0, 0x60, 0x78, 0x1f, 0x85, 0x38, 
-0x3, 0xbc, 0x38, 0x7, 0x94, 0x4f, 0xd9, 0xc1, 0xc5, 0x18, 0x4, 0x4f, 0xd5, 0xd9, 0xc1, 0x2a, 
-0x7d, 0x5c, 0x78, 0x84, 0x47, 0x79, 0x3c, 0x85, 0x38, 0xd, 0x28, 0xd, 0x3d, 0x4f, 0xcd, 0xe5, 
-0x22, 0xd9, 0x79, 0x10, 0xd9, 0xd1, 0xc9, 0x28, 0xf3, 0xcf, 0xa, 0xdf, 0x6, 0x0, 0xc5, 0x4f, 
-0x21, 0x96, 0x25, 0xcd, 0xdc, 0x16, 0x79, 0xd2, 0x84, 0x26, 0x6, 0x0, 0x4e, 0x9, 0xe9, 0xcd, 
-0x74, 0x0, 0x3, 0xfe, 0xd, 0xca, 0x8a, 0x1c, 0xfe, 0x22, 0x20, 0xf3, 0xcd, 0x74, 0x0, 0xfe, 
-0x22, 0xc9, 0xe7, 0xfe, 0x28, 0x20, 0x6, 0xcd, 0x79, 0x1c, 0xdf, 0xfe, 0x29, 0xc2, 0x8a, 0x1c, 
-0xfd, 0xcb, 0x1, 0x7e, 0xc9, 0xcd, 0x7, 0x23, 0x2a, 0x36, 0x5c, 0x11, 0x0, 0x1, 0x19, 0x79, 
-0xf, 0xf, 0xf, 0xe6, 0xe0, 0xa8, 0x5f, 0x79, 0xe6, 0x18, 0xee, 0x40, 0x57, 0x6, 0x60, 0xc5, 
-0xd5, 0xe5, 0x1a, 0xae, 0x28, 0x4, 0x3c, 0x20, 0x1a, 0x3d, 0x4f, 0x6, 0x7, 0x14, 0x23, 0x1a, 
-0xae, 0xa9, 0x20, 0xf, 0x10, 0xf7, 0xc1, 0xc1, 0xc1, 0x3e, 0x80, 0x90, 0x1, 0x1, 0x0, 0xf7, 
-0x12, 0x18, 0xa, 0xe1, 0x11, 0x8, 0x0, 0x19, 0xd1, 0xc1, 0x10, 0xd3, 0x48, 0xc3, 0xb2, 0x2a, 
-0xcd, 0x7, 0x23, 0x79, 0xf, 0xf, 0xf, 0x4f, 0xe6, 0xe0, 0xa8, 0x6f, 0x79, 0xe6, 0x3, 0xee, 
-0x58, 0x67, 0x7e, 0xc3, 0x28, 0x2d, 0x22, 0x1c, 0x28, 0x4f, 0x2e, 0xf2, 0x2b, 0x12, 0xa8, 0x56, 
-0xa5, 0x57, 0xa7, 0x84, 0xa6, 0x8f, 0xc4, 0xe6, 0xaa, 0xbf, 0xab, 0xc7, 0xa9, 0xce, 0x0, 0xe7, 
-0xc3, 0xff, 0x24, 0xdf, 0x23, 0xe5, 0x1, 0x0, 0x0, 0xcd, 0xf, 0x25, 0x20, 0x1b, 0xcd, 0xf, 
-0x25, 0x28, 0xfb, 0xcd, 0x30, 0x25, 0x28, 0x11, 0xf7, 0xe1, 0xd5, 0x7e, 0x23, 0x12, 0x13, 0xfe, 
-0x22, 0x20, 0xf8, 0x7e, 0x23, 0xfe, 0x22, 0x28, 0xf2, 0xb, 0xd1, 0x21, 0x3b, 0x5c, 0xcb, 0xb6, 
-0xcb, 0x7e, 0xc4, 0xb2, 0x2a, 0xc3, 0x12, 0x27, 0xe7, 0xcd, 0xfb, 0x24, 0xfe, 0x29, 0xc2, 0x8a, 
-0x1c, 0xe7, 0xc3, 0x12, 0x27, 0xc3, 0xbd, 0x27, 0xcd, 0x30, 0x25, 0x28, 0x28, 0xed, 0x4b, 0x76, 
-0x5c, 0xcd, 0x2b, 0x2d, 0xef, 0xa1, 0xf, 0x34, 0x37, 0x16, 0x4, 0x34, 0x80, 0x41, 0x0, 0x0, 
-0x80, 0x32, 0x2, 0xa1, 0x3, 0x31, 0x38, 0xcd, 0xa2, 0x2d, 0xed, 0x43, 0x76, 0x5c, 0x7e, 0xa7, 
-0x28, 0x3, 0xd6, 0x10, 0x77, 0x18, 0x9, 0xcd, 0x30, 0x25, 0x28, 0x4, 0xef, 0xa3, 0x38, 0x34, 
-0xe7, 0xc3, 0xc3, 0x26, 0x1, 0x5a, 0x10, 0xe7, 0xfe, 0x23, 0xca, 0xd, 0x27, 0x21, 0x3b, 0x5c, 
-0xcb, 0xb6, 0xcb, 0x7e, 0x28, 0x1f, 0xc3, 0x6c, 0x3b, 0xe, 0x0, 0x20, 0x13, 0xcd, 0x1e, 0x3, 
-0x30, 0xe, 0x15, 0x5f, 0xcd, 0x33, 0x3, 0xf5, 0x1, 0x1, 0x0, 0xf7, 0xf1, 0x12, 0xe, 0x1, 
-0x6, 0x0, 0xcd, 0xb2, 0x2a, 0xc3, 0x12, 0x27, 0xcd, 0x22, 0x25, 0xc4, 0x35, 0x25, 0xe7, 0xc3, 
-0xdb, 0x25, 0xcd, 0x22, 0x25, 0xc4, 0x80, 0x25, 0xe7, 0x18, 0x48, 0xcd, 0x22, 0x25, 0xc4, 0xcb, 
-0x22, 0xe7, 0x18, 0x3f, 0xcd, 0x88, 0x2c, 0x30, 0x56, 0xfe, 0x41, 0x30, 0x3c, 0xcd, 0x30, 0x25, 
-0x20, 0x23, 0xcd, 0x9b, 0x2c, 0xdf, 0x1, 0x6, 0x0, 0xcd, 0x55, 0x16, 0x23, 0x36, 0xe, 0x23, 
-0xeb, 0x2a, 0x65, 0x5c, 0xe, 0x5, 0xa7, 0xed, 0x42, 0x22, 0x65, 0x5c, 0xed, 0xb0, 0xeb, 0x2b, 
-0xcd, 0x77, 0x0, 0x18, 0xe, 0xdf, 0x23, 0x7e, 0xfe, 0xe, 0x20, 0xfa, 0x23, 0xcd, 0xb4, 0x33, 
-0x22, 0x5d, 0x5c, 0xfd, 0xcb, 0x1, 0xf6, 0x18, 0x14, 0xcd, 0xb2, 0x28, 0xda, 0x2e, 0x1c, 0xcc, 
-0x96, 0x29, 0x3a, 0x3b, 0x5c, 0xfe, 0xc0, 0x38, 0x4, 0x23, 0xcd, 0xb4, 0x33, 0x18, 0x33, 0x1, 
-0xdb, 0x9, 0xfe, 0x2d, 0x28, 0x27, 0x1, 0x18, 0x10, 0xfe, 0xae, 0x28, 0x20, 0xd6, 0xaf, 0xda, 
-0x8a, 0x1c, 0x1, 0xf0, 0x4, 0xfe, 0x14, 0x28, 0x14, 0xd2, 0x8a, 0x1c, 0x6, 0x10, 0xc6, 0xdc, 
-0x4f, 0xfe, 0xdf, 0x30, 0x2, 0xcb, 0xb1, 0xfe, 0xee, 0x38, 0x2, 0xcb, 0xb9, 0xc5, 0xe7, 0xc3, 
-0xff, 0x24, 0xdf, 0xfe, 0x28, 0x20, 0xc, 0xfd, 0xcb, 0x1, 0x76, 0x20, 0x17, 0xcd, 0x52, 0x2a, 
-0xe7, 0x18, 0xf0, 0x6, 0x0, 0x4f, 0x21, 0x95, 0x27, 0xcd, 0xdc, 0x16, 0x30, 0x6, 0x4e, 0x21, 
-0xed, 0x26, 0x9, 0x46, 0xd1, 0x7a, 0xb8, 0x38, 0x3a, 0xa7, 0xca, 0x18, 0x0, 0xc5, 0x21, 0x3b, 
-0x5c, 0x7b, 0xfe, 0xed, 0x20, 0x6, 0xcb, 0x76, 0x20, 0x2, 0x1e, 0x99, 0xd5, 0xcd, 0x30, 0x25, 
-0x28, 0x9, 0x7b, 0xe6, 0x3f, 0x47, 0xef, 0x3b, 0x38, 0x18, 0x9, 0x7b, 0xfd, 0xae, 0x1, 0xe6, 
-0x40, 0xc2, 0x8a, 0x1c, 0xd1, 0x21, 0x3b, 0x5c, 0xcb, 0xf6, 0xcb, 0x7b, 0x20, 0x2, 0xcb, 0xb6, 
-0xc1, 0x18, 0xc1, 0xd5, 0x79, 0xfd, 0xcb, 0x1, 0x76, 0x20, 0x15, 0xe6, 0x3f, 0xc6, 0x8, 0x4f, 
-0xfe, 0x10, 0x20, 0x4, 0xcb, 0xf1, 0x18, 0x8, 0x38, 0xd7, 0xfe, 0x17, 0x28, 0x2, 0xcb, 0xf9, 
-0xc5, 0xe7, 0xc3, 0xff, 0x24, 0x2b, 0xcf, 0x2d, 0xc3, 0x2a, 0xc4, 0x2f, 0xc5, 0x5e, 0xc6, 0x3d, 
-0xce, 0x3e, 0xcc, 0x3c, 0xcd, 0xc7, 0xc9, 0xc8, 0xca, 0xc9, 0xcb, 0xc5, 0xc7, 0xc6, 0xc8, 0x0, 
-0x6, 0x8, 0x8, 0xa, 0x2, 0x3, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0xcd, 0x30, 0x25, 
-0x20, 0x35, 0xe7, 0xcd, 0x8d, 0x2c, 0xd2, 0x8a, 0x1c, 0xe7, 0xfe, 0x24, 0xf5, 0x20, 0x1, 0xe7, 
-0xfe, 0x28, 0x20, 0x12, 0xe7, 0xfe, 0x29, 0x28, 0x10, 0xcd, 0xfb, 0x24, 0xdf, 0xfe, 0x2c, 0x20, 
-0x3, 0xe7, 0x18, 0xf5, 0xfe, 0x29, 0xc2, 0x8a, 0x1c, 0xe7, 0x21, 0x3b, 0x5c, 0xcb, 0xb6, 0xf1, 
-0x28, 0x2, 0xcb, 0xf6, 0xc3, 0x12, 0x27, 0xe7, 0xe6, 0xdf, 0x47, 0xe7, 0xd6, 0x24, 0x4f, 0x20, 
-0x1, 0xe7, 0xe7, 0xe5, 0x2a, 0x53, 0x5c, 0x2b, 0x11, 0xce, 0x0, 0xc5, 0xcd, 0x86, 0x1d, 0xc1, 
-0x30, 0x2, 0xcf, 0x18, 0xe5, 0xcd, 0xab, 0x28, 0xe6, 0xdf, 0xb8, 0x20, 0x8, 0xcd, 0xab, 0x28, 
-0xd6, 0x24, 0xb9, 0x28, 0xc, 0xe1, 0x2b, 0x11, 0x0, 0x2, 0xc5, 0xcd, 0x8b, 0x19, 0xc1, 0x18, 
-0xd7, 0xa7, 0xcc, 0xab, 0x28, 0xd1, 0xd1, 0xed, 0x53, 0x5d, 0x5c, 0xcd, 0xab, 0x28, 0xe5, 0xfe, 
-0x29, 0x28, 0x42, 0x23, 0x7e, 0xfe, 0xe, 0x16, 0x40, 0x28, 0x7, 0x2b, 0xcd, 0xab, 0x28, 0x23, 
-0x16, 0x0, 0x23, 0xe5, 0xd5, 0xcd, 0xfb, 0x24, 0xf1, 0xfd, 0xae, 0x1, 0xe6, 0x40, 0x20, 0x2b, 
-0xe1, 0xeb, 0x2a, 0x65, 0x5c, 0x1, 0x5, 0x0, 0xed, 0x42, 0x22, 0x65, 0x5c, 0xed, 0xb0, 0xeb, 
-0x2b, 0xcd, 0xab, 0x28, 0xfe, 0x29, 0x28, 0xd, 0xe5, 0xdf, 0xfe, 0x2c, 0x20, 0xd, 0xe7, 0xe1, 
-0xcd, 0xab, 0x28, 0x18, 0xbe, 0xe5, 0xdf, 0xfe, 0x29, 0x28, 0x2, 0xcf, 0x19, 0xd1, 0xeb, 0x22, 
-0x5d, 0x5c, 0x2a, 0xb, 0x5c, 0xe3, 0x22, 0xb, 0x5c, 0xd5, 0xe7, 0xe7, 0xcd, 0xfb, 0x24, 0xe1, 
-0x22, 0x5d, 0x5c, 0xe1, 0x22, 0xb, 0x5c, 0xe7, 0xc3, 0x12, 0x27, 0x23, 0x7e, 0xfe, 0x21, 0x38, 
-0xfa, 0xc9, 0xfd, 0xcb, 0x1, 0xf6, 0xdf, 0xcd, 0x8d, 0x2c, 0xd2, 0x8a, 0x1c, 0xe5, 0xe6, 0x1f, 
-0x4f, 0xe7, 0xe5, 0xfe, 0x28, 0x28, 0x28, 0xcb, 0xf1, 0xfe, 0x24, 0x28, 0x11, 0xcb, 0xe9, 0xcd, 
-0x88, 0x2c, 0x30, 0xf, 0xcd, 0x88, 0x2c, 0x30, 0x16, 0xcb, 0xb1, 0xe7, 0x18, 0xf6, 0xe7, 0xfd, 
-0xcb, 0x1, 0xb6, 0x3a, 0xc, 0x5c, 0xa7, 0x28, 0x6, 0xcd, 0x30, 0x25, 0xc2, 0x51, 0x29, 0x41, 
-0xcd, 0x30, 0x25, 0x20, 0x8, 0x79, 0xe6, 0xe0, 0xcb, 0xff, 0x4f, 0x18, 0x37, 0x2a, 0x4b, 0x5c, 
-0x7e, 0xe6, 0x7f, 0x28, 0x2d, 0xb9, 0x20, 0x22, 0x17, 0x87, 0xf2, 0x3f, 0x29, 0x38, 0x30, 0xd1, 
-0xd5, 0xe5, 0x23, 0x1a, 0x13, 0xfe, 0x20, 0x28, 0xfa, 0xf6, 0x20, 0xbe, 0x28, 0xf4, 0xf6, 0x80, 
-0xbe, 0x20, 0x6, 0x1a, 0xcd, 0x88, 0x2c, 0x30, 0x15, 0xe1, 0xc5, 0xcd, 0xb8, 0x19, 0xeb, 0xc1, 
-0x18, 0xce, 0xcb, 0xf8, 0xd1, 0xdf, 0xfe, 0x28, 0x28, 0x9, 0xcb, 0xe8, 0x18, 0xd, 0xd1, 0xd1, 
-0xd1, 0xe5, 0xdf, 0xcd, 0x88, 0x2c, 0x30, 0x3, 0xe7, 0x18, 0xf8, 0xe1, 0xcb, 0x10, 0xcb, 0x70, 
-0xc9, 0x2a, 0xb, 0x5c, 0x7e, 0xfe, 0x29, 0xca, 0xef, 0x28, 0x7e, 0xf6, 0x60, 0x47, 0x23, 0x7e, 
-0xfe, 0xe, 0x28, 0x7, 0x2b, 0xcd, 0xab, 0x28, 0x23, 0xcb, 0xa8, 0x78, 0xb9, 0x28, 0x12, 0x23, 
-0x23, 0x23, 0x23, 0x23, 0xcd, 0xab, 0x28, 0xfe, 0x29, 0xca, 0xef, 0x28, 0xcd, 0xab, 0x28, 0x18, 
-0xd9, 0xcb, 0x69, 0x20, 0xc, 0x23, 0xed, 0x5b, 0x65, 0x5c, 0xcd, 0xc0, 0x33, 0xeb, 0x22, 0x65, 
-0x5c, 0xd1, 0xd1, 0xaf, 0x3c, 0xc9, 0xaf, 0x47, 0xcb, 0x79, 0x20, 0x4b, 0xcb, 0x7e, 0x20, 0xe, 
-0x3c, 0x23, 0x4e, 0x23, 0x46, 0x23, 0xeb, 0xcd, 0xb2, 0x2a, 0xdf, 0xc3, 0x49, 0x2a, 0x23, 0x23, 
-0x23, 0x46, 0xcb, 0x71, 0x28, 0xa, 0x5, 0x28, 0xe8, 0xeb, 0xdf, 0xfe, 0x28, 0x20, 0x61, 0xeb, 
-0xeb, 0x18, 0x24, 0xe5, 0xdf, 0xe1, 0xfe, 0x2c, 0x28, 0x20, 0xcb, 0x79, 0x28, 0x52, 0xcb, 0x71, 
-0x20, 0x6, 0xfe, 0x29, 0x20, 0x3c, 0xe7, 0xc9, 0xfe, 0x29, 0x28, 0x6c, 0xfe, 0xcc, 0x20, 0x32, 
-0xdf, 0x2b, 0x22, 0x5d, 0x5c, 0x18, 0x5e, 0x21, 0x0, 0x0, 0xe5, 0xe7, 0xe1, 0x79, 0xfe, 0xc0, 
-0x20, 0x9, 0xdf, 0xfe, 0x29, 0x28, 0x51, 0xfe, 0xcc, 0x28, 0xe5, 0xc5, 0xe5, 0xcd, 0xee, 0x2a, 
-0xe3, 0xeb, 0xcd, 0xcc, 0x2a, 0x38, 0x19, 0xb, 0xcd, 0xf4, 0x2a, 0x9, 0xd1, 0xc1, 0x10, 0xb3, 
-0xcb, 0x79, 0x20, 0x66, 0xe5, 0xcb, 0x71, 0x20, 0x13, 0x42, 0x4b, 0xdf, 0xfe, 0x29, 0x28, 0x2, 
-0xcf, 0x2, 0xe7, 0xe1, 0x11, 0x5, 0x0, 0xcd, 0xf4, 0x2a, 0x9, 0xc9, 0xcd, 0xee, 0x2a, 0xe3, 
-0xcd, 0xf4, 0x2a, 0xc1, 0x9, 0x23, 0x42, 0x4b, 0xeb, 0xcd, 0xb1, 0x2a, 0xdf, 0xfe, 0x29, 0x28, 
-0x7, 0xfe, 0x2c, 0x20, 0xdb, 0xcd, 0x52, 0x2a, 0xe7, 0xfe, 0x28, 0x28, 0xf8, 0xfd, 0xcb, 0x1, 
-0xb6, 0xc9, 0xcd, 0x30, 0x25, 0xc4, 0xf1, 0x2b, 0xe7, 0xfe, 0x29, 0x28, 0x50, 0xd5, 0xaf, 0xf5, 
-0xc5, 0x11, 0x1, 0x0, 0xdf, 0xe1, 0xfe, 0xcc, 0x28, 0x17, 0xf1, 0xcd, 0xcd, 0x2a, 0xf5, 0x50, 
-0x59, 0xe5, 0xdf, 0xe1, 0xfe, 0xcc, 0x28, 0x9, 0xfe, 0x29, 0xc2, 0x8a, 0x1c, 0x62, 0x6b, 0x18, 
-0x13, 0xe5, 0xe7, 0xe1, 0xfe, 0x29, 0x28, 0xc, 0xf1, 0xcd, 0xcd, 0x2a, 0xf5, 0xdf, 0x60, 0x69, 
-0xfe, 0x29, 0x20, 0xe6, 0xf1, 0xe3, 0x19, 0x2b, 0xe3, 0xa7, 0xed, 0x52, 0x1, 0x0, 0x0, 0x38, 
-0x7, 0x23, 0xa7, 0xfa, 0x20, 0x2a, 0x44, 0x4d, 0xd1, 0xfd, 0xcb, 0x1, 0xb6, 0xcd, 0x30, 0x25, 
-0xc8, 0xaf, 0xfd, 0xcb, 0x1, 0xb6, 0xc5, 0xcd, 0xa9, 0x33, 0xc1, 0x2a, 0x65, 0x5c, 0x77, 0x23, 
-0x73, 0x23, 0x72, 0x23, 0x71, 0x23, 0x70, 0x23, 0x22, 0x65, 0x5c, 0xc9, 0xaf, 0xd5, 0xe5, 0xf5, 
-0xcd, 0x82, 0x1c, 0xf1, 0xcd, 0x30, 0x25, 0x28, 0x12, 0xf5, 0xcd, 0x99, 0x1e, 0xd1, 0x78, 0xb1, 
-0x37, 0x28, 0x5, 0xe1, 0xe5, 0xa7, 0xed, 0x42, 0x7a, 0xde, 0x0, 0xe1, 0xd1, 0xc9, 0xeb, 0x23, 
-0x5e, 0x23, 0x56, 0xc9, 0xcd, 0x30, 0x25, 0xc8, 0xcd, 0xa9, 0x30, 0xda, 0x15, 0x1f, 0xc9, 0x2a, 
-0x4d, 0x5c, 0xfd, 0xcb, 0x37, 0x4e, 0x28, 0x5e, 0x1, 0x5, 0x0, 0x3, 0x23, 0x7e, 0xfe, 0x20, 
-0x28, 0xfa, 0x30, 0xb, 0xfe, 0x10, 0x38, 0x11, 0xfe, 0x16, 0x30, 0xd, 0x23, 0x18, 0xed, 0xcd, 
-0x88, 0x2c, 0x38, 0xe7, 0xfe, 0x24, 0xca, 0xc0, 0x2b, 0x79, 0x2a, 0x59, 0x5c, 0x2b, 0xcd, 0x55, 
-0x16, 0x23, 0x23, 0xeb, 0xd5, 0x2a, 0x4d, 0x5c, 0x1b, 0xd6, 0x6, 0x47, 0x28, 0x11, 0x23, 0x7e, 
-0xfe, 0x21, 0x38, 0xfa, 0xf6, 0x20, 0x13, 0x12, 0x10, 0xf4, 0xf6, 0x80, 0x12, 0x3e, 0xc0, 0x2a, 
-0x4d, 0x5c, 0xae, 0xf6, 0x20, 0xe1, 0xcd, 0xea, 0x2b, 0xe5, 0xef, 0x2, 0x38, 0xe1, 0x1, 0x5, 
-0x0, 0xa7, 0xed, 0x42, 0x18, 0x40, 0xfd, 0xcb, 0x1, 0x76, 0x28, 0x6, 0x11, 0x6, 0x0, 0x19, 
-0x18, 0xe7, 0x2a, 0x4d, 0x5c, 0xed, 0x4b, 0x72, 0x5c, 0xfd, 0xcb, 0x37, 0x46, 0x20, 0x30, 0x78, 
-0xb1, 0xc8, 0xe5, 0xf7, 0xd5, 0xc5, 0x54, 0x5d, 0x23, 0x36, 0x20, 0xed, 0xb8, 0xe5, 0xcd, 0xf1, 
-0x2b, 0xe1, 0xe3, 0xa7, 0xed, 0x42, 0x9, 0x30, 0x2, 0x44, 0x4d, 0xe3, 0xeb, 0x78, 0xb1, 0x28, 
-0x2, 0xed, 0xb0, 0xc1, 0xd1, 0xe1, 0xeb, 0x78, 0xb1, 0xc8, 0xd5, 0xed, 0xb0, 0xe1, 0xc9, 0x2b, 
-0x2b, 0x2b, 0x7e, 0xe5, 0xc5, 0xcd, 0xc6, 0x2b, 0xc1, 0xe1, 0x3, 0x3, 0x3, 0xc3, 0xe8, 0x19, 
-0x3e, 0xdf, 0x2a, 0x4d, 0x5c, 0xa6, 0xf5, 0xcd, 0xf1, 0x2b, 0xeb, 0x9, 0xc5, 0x2b, 0x22, 0x4d, 
-0x5c, 0x3, 0x3, 0x3, 0x2a, 0x59, 0x5c, 0x2b, 0xcd, 0x55, 0x16, 0x2a, 0x4d, 0x5c, 0xc1, 0xc5, 
-0x3, 0xed, 0xb8, 0xeb, 0x23, 0xc1, 0x70, 0x2b, 0x71, 0xf1, 0x2b, 0x77, 0x2a, 0x59, 0x5c, 0x2b, 
-0xc9, 0x2a, 0x65, 0x5c, 0x2b, 0x46, 0x2b, 0x4e, 0x2b, 0x56, 0x2b, 0x5e, 0x2b, 0x7e, 0x22, 0x65, 
-0x5c, 0xc9, 0xcd, 0xb2, 0x28, 0xc2, 0x8a, 0x1c, 0xcd, 0x30, 0x25, 0x20, 0x8, 0xcb, 0xb1, 0xcd, 
-0x96, 0x29, 0xcd, 0xee, 0x1b, 0x38, 0x8, 0xc5, 0xcd, 0xb8, 0x19, 0xcd, 0xe8, 0x19, 0xc1, 0xcb, 
-0xf9, 0x6, 0x0, 0xc5, 0x21, 0x1, 0x0, 0xcb, 0x71, 0x20, 0x2, 0x2e, 0x5, 0xeb, 0xe7, 0x26, 
-0xff, 0xcd, 0xcc, 0x2a, 0xda, 0x20, 0x2a, 0xe1, 0xc5, 0x24, 0xe5, 0x60, 0x69, 0xcd, 0xf4, 0x2a, 
-0xeb, 0xdf, 0xfe, 0x2c, 0x28, 0xe8, 0xfe, 0x29, 0x20, 0xbb, 0xe7, 0xc1, 0x79, 0x68, 0x26, 0x0, 
-0x23, 0x23, 0x29, 0x19, 0xda, 0x15, 0x1f, 0xd5, 0xc5, 0xe5, 0x44, 0x4d, 0x2a, 0x59, 0x5c, 0x2b, 
-0xcd, 0x55, 0x16, 0x23, 0x77, 0xc1, 0xb, 0xb, 0xb, 0x23, 0x71, 0x23, 0x70, 0xc1, 0x78, 0x23, 
-0x77, 0x62, 0x6b, 0x1b, 0x36, 0x0, 0xcb, 0x71, 0x28, 0x2, 0x36, 0x20, 0xc1, 0xed, 0xb8, 0xc1, 
-0x70, 0x2b, 0x71, 0x2b, 0x3d, 0x20, 0xf8, 0xc9, 0xcd, 0x1b, 0x2d, 0x3f, 0xd8, 0xfe, 0x41, 0x3f, 
-0xd0, 0xfe, 0x5b, 0xd8, 0xfe, 0x61, 0x3f, 0xd0, 0xfe, 0x7b, 0xc9, 0xfe, 0xc4, 0x20, 0x19, 0x11, 
-0x0, 0x0, 0xe7, 0xd6, 0x31, 0xce, 0x0, 0x20, 0xa, 0xeb, 0x3f, 0xed, 0x6a, 0xda, 0xad, 0x31, 
-0xeb, 0x18, 0xef, 0x42, 0x4b, 0xc3, 0x2b, 0x2d, 0xfe, 0x2e, 0x28, 0xf, 0xcd, 0x3b, 0x2d, 0xfe, 
-0x2e, 0x20, 0x28, 0xe7, 0xcd, 0x1b, 0x2d, 0x38, 0x22, 0x18, 0xa, 0xe7, 0xcd, 0x1b, 0x2d, 0xda, 
-0x8a, 0x1c, 0xef, 0xa0, 0x38, 0xef, 0xa1, 0xc0, 0x2, 0x38, 0xdf, 0xcd, 0x22, 0x2d, 0x38, 0xb, 
-0xef, 0xe0, 0xa4, 0x5, 0xc0, 0x4, 0xf, 0x38, 0xe7, 0x18, 0xef, 0xfe, 0x45, 0x28, 0x3, 0xfe, 
-0x65, 0xc0, 0x6, 0xff, 0xe7, 0xfe, 0x2b, 0x28, 0x5, 0xfe, 0x2d, 0x20, 0x2, 0x4, 0xe7, 0xcd, 
-0x1b, 0x2d, 0x38, 0xcb, 0xc5, 0xcd, 0x3b, 0x2d, 0xcd, 0xd5, 0x2d, 0xc1, 0xda, 0xad, 0x31, 0xa7, 
-0xfa, 0xad, 0x31, 0x4, 0x28, 0x2, 0xed, 0x44, 0xc3, 0x4f, 0x2d, 0xfe, 0x30, 0xd8, 0xfe, 0x3a, 
-0x3f, 0xc9, 0xcd, 0x1b, 0x2d, 0xd8, 0xd6, 0x30, 0x4f, 0x6, 0x0, 0xfd, 0x21, 0x3a, 0x5c, 0xaf, 
-0x5f, 0x51, 0x48, 0x47, 0xcd, 0xb6, 0x2a, 0xef, 0x38, 0xa7, 0xc9, 0xf5, 0xef, 0xa0, 0x38, 0xf1, 
-0xcd, 0x22, 0x2d, 0xd8, 0xef, 0x1, 0xa4, 0x4, 0xf, 0x38, 0xcd, 0x74, 0x0, 0x18, 0xf1, 0x7, 
-0xf, 0x30, 0x2, 0x2f, 0x3c, 0xf5, 0x21, 0x92, 0x5c, 0xcd, 0xb, 0x35, 0xef, 0xa4, 0x38, 0xf1, 
-0xcb, 0x3f, 0x30, 0xd, 0xf5, 0xef, 0xc1, 0xe0, 0x0, 0x4, 0x4, 0x33, 0x2, 0x5, 0xe1, 0x38, 
-0xf1, 0x28, 0x8, 0xf5, 0xef, 0x31, 0x4, 0x38, 0xf1, 0x18, 0xe5, 0xef, 0x2, 0x38, 0xc9, 0x23, 
-0x4e, 0x23, 0x7e, 0xa9, 0x91, 0x5f, 0x23, 0x7e, 0x89, 0xa9, 0x57, 0xc9, 0xe, 0x0, 0xe5, 0x36, 
-0x0, 0x23, 0x71, 0x23, 0x7b, 0xa9, 0x91, 0x77, 0x23, 0x7a, 0x89, 0xa9, 0x77, 0x23, 0x36, 0x0, 
-0xe1, 0xc9, 0xef, 0x38, 0x7e, 0xa7, 0x28, 0x5, 0xef, 0xa2, 0xf, 0x27, 0x38, 0xef, 0x2, 0x38, 
-0xe5, 0xd5, 0xeb, 0x46, 0xcd, 0x7f, 0x2d, 0xaf, 0x90, 0xcb, 0x79, 0x42, 0x4b, 0x7b, 0xd1, 0xe1, 
-0xc9, 0x57, 0x17, 0x9f, 0x5f, 0x4f, 0xaf, 0x47, 0xcd, 0xb6, 0x2a, 0xef, 0x34, 0xef, 0x1a, 0x20, 
-0x9a, 0x85, 0x4, 0x27, 0x38, 0xcd, 0xa2, 0x2d, 0xd8, 0xf5, 0x5, 0x4, 0x28, 0x3, 0xf1, 0x37, 
-0xc9, 0xf1, 0xc9, 0xef, 0x31, 0x36, 0x0, 0xb, 0x31, 0x37, 0x0, 0xd, 0x2, 0x38, 0x3e, 0x30, 
-0xd7, 0xc9, 0x2a, 0x38, 0x3e, 0x2d, 0xd7, 0xef, 0xa0, 0xc3, 0xc4, 0xc5, 0x2, 0x38, 0xd9, 0xe5, 
-0xd9, 0xef, 0x31, 0x27, 0xc2, 0x3, 0xe2, 0x1, 0xc2, 0x2, 0x38, 0x7e, 0xa7, 0x20, 0x47, 0xcd, 
-0x7f, 0x2d, 0x6, 0x10, 0x7a, 0xa7, 0x20, 0x6, 0xb3, 0x28, 0x9, 0x53, 0x6, 0x8, 0xd5, 0xd9, 
-0xd1, 0xd9, 0x18, 0x57, 0xef, 0xe2, 0x38, 0x7e, 0xd6, 0x7e, 0xcd, 0xc1, 0x2d, 0x57, 0x3a, 0xac, 
-0x5c, 0x92, 0x32, 0xac, 0x5c, 0x7a, 0xcd, 0x4f, 0x2d, 0xef, 0x31, 0x27, 0xc1, 0x3, 0xe1, 0x38, 
-0xcd, 0xd5, 0x2d, 0xe5, 0x32, 0xa1, 0x5c, 0x3d, 0x17, 0x9f, 0x3c, 0x21, 0xab, 0x5c, 0x77, 0x23, 
-0x86, 0x77, 0xe1, 0xc3, 0xcf, 0x2e, 0xd6, 0x80, 0xfe, 0x1c, 0x38, 0x13, 0xcd, 0xc1, 0x2d, 0xd6, 
-0x7, 0x47, 0x21, 0xac, 0x5c, 0x86, 0x77, 0x78, 0xed, 0x44, 0xcd, 0x4f, 0x2d, 0x18, 0x92, 0xeb, 
-0xcd, 0xba, 0x2f, 0xd9, 0xcb, 0xfa, 0x7d, 0xd9, 0xd6, 0x80, 0x47, 0xcb, 0x23, 0xcb, 0x12, 0xd9, 
-0xcb, 0x13, 0xcb, 0x12, 0xd9, 0x21, 0xaa, 0x5c, 0xe, 0x5, 0x7e, 0x8f, 0x27, 0x77, 0x2b, 0xd, 
-0x20, 0xf8, 0x10, 0xe7, 0xaf, 0x21, 0xa6, 0x5c, 0x11, 0xa1, 0x5c, 0x6, 0x9, 0xed, 0x6f, 0xe, 
-0xff, 0xed, 0x6f, 0x20, 0x4, 0xd, 0xc, 0x20, 0xa, 0x12, 0x13, 0xfd, 0x34, 0x71, 0xfd, 0x34, 
-0x72, 0xe, 0x0, 0xcb, 0x40, 0x28, 0x1, 0x23, 0x10, 0xe7, 0x3a, 0xab, 0x5c, 0xd6, 0x9, 0x38, 
-0xa, 0xfd, 0x35, 0x71, 0x3e, 0x4, 0xfd, 0xbe, 0x6f, 0x18, 0x41, 0xef, 0x2, 0xe2, 0x38, 0xeb, 
-0xcd, 0xba, 0x2f, 0xd9, 0x3e, 0x80, 0x95, 0x2e, 0x0, 0xcb, 0xfa, 0xd9, 0xcd, 0xdd, 0x2f, 0xfd, 
-0x7e, 0x71, 0xfe, 0x8, 0x38, 0x6, 0xd9, 0xcb, 0x12, 0xd9, 0x18, 0x20, 0x1, 0x0, 0x2, 0x7b, 
-0xcd, 0x8b, 0x2f, 0x5f, 0x7a, 0xcd, 0x8b, 0x2f, 0x57, 0xc5, 0xd9, 0xc1, 0x10, 0xf1, 0x21, 0xa1, 
-0x5c, 0x79, 0xfd, 0x4e, 0x71, 0x9, 0x77, 0xfd, 0x34, 0x71, 0x18, 0xd3, 0xf5, 0x21, 0xa1, 0x5c, 
-0xfd, 0x4e, 0x71, 0x6, 0x0, 0x9, 0x41, 0xf1, 0x2b, 0x7e, 0xce, 0x0, 0x77, 0xa7, 0x28, 0x5, 
-0xfe, 0xa, 0x3f, 0x30, 0x8, 0x10, 0xf1, 0x36, 0x1, 0x4, 0xfd, 0x34, 0x72, 0xfd, 0x70, 0x71, 
-0xef, 0x2, 0x38, 0xd9, 0xe1, 0xd9, 0xed, 0x4b, 0xab, 0x5c, 0x21, 0xa1, 0x5c, 0x78, 0xfe, 0x9, 
-0x38, 0x4, 0xfe, 0xfc, 0x38, 0x26, 0xa7, 0xcc, 0xef, 0x15, 0xaf, 0x90, 0xfa, 0x52, 0x2f, 0x47, 
-0x18, 0xc, 0x79, 0xa7, 0x28, 0x3, 0x7e, 0x23, 0xd, 0xcd, 0xef, 0x15, 0x10, 0xf4, 0x79, 0xa7, 
-0xc8, 0x4, 0x3e, 0x2e, 0xd7, 0x3e, 0x30, 0x10, 0xfb, 0x41, 0x18, 0xe6, 0x50, 0x15, 0x6, 0x1, 
-0xcd, 0x4a, 0x2f, 0x3e, 0x45, 0xd7, 0x4a, 0x79, 0xa7, 0xf2, 0x83, 0x2f, 0xed, 0x44, 0x4f, 0x3e, 
-0x2d, 0x18, 0x2, 0x3e, 0x2b, 0xd7, 0x6, 0x0, 0xc3, 0x1b, 0x1a, 0xd5, 0x6f, 0x26, 0x0, 0x5d, 
-0x54, 0x29, 0x29, 0x19, 0x29, 0x59, 0x19, 0x4c, 0x7d, 0xd1, 0xc9, 0x7e, 0x36, 0x0, 0xa7, 0xc8, 
-0x23, 0xcb, 0x7e, 0xcb, 0xfe, 0x2b, 0xc8, 0xc5, 0x1, 0x5, 0x0, 0x9, 0x41, 0x4f, 0x37, 0x2b, 
-0x7e, 0x2f, 0xce, 0x0, 0x77, 0x10, 0xf8, 0x79, 0xc1, 0xc9, 0xe5, 0xf5, 0x4e, 0x23, 0x46, 0x77, 
-0x23, 0x79, 0x4e, 0xc5, 0x23, 0x4e, 0x23, 0x46, 0xeb, 0x57, 0x5e, 0xd5, 0x23, 0x56, 0x23, 0x5e, 
-0xd5, 0xd9, 0xd1, 0xe1, 0xc1, 0xd9, 0x23, 0x56, 0x23, 0x5e, 0xf1, 0xe1, 0xc9, 0xa7, 0xc8, 0xfe, 
-0x21, 0x30, 0x16, 0xc5, 0x47, 0xd9, 0xcb, 0x2d, 0xcb, 0x1a, 0xcb, 0x1b, 0xd9, 0xcb, 0x1a, 0xcb, 
-0x1b, 0x10, 0xf2, 0xc1, 0xd0, 0xcd, 0x4, 0x30, 0xc0, 0xd9, 0xaf, 0x2e, 0x0, 0x57, 0x5d, 0xd9, 
-0x11, 0x0, 0x0, 0xc9, 0x1c, 0xc0, 0x14, 0xc0, 0xd9, 0x1c, 0x20, 0x1, 0x14, 0xd9, 0xc9, 0xeb, 
-0xcd, 0x6e, 0x34, 0xeb, 0x1a, 0xb6, 0x20, 0x26, 0xd5, 0x23, 0xe5, 0x23, 0x5e, 0x23, 0x56, 0x23, 
-0x23, 0x23, 0x7e, 0x23, 0x4e, 0x23, 0x46, 0xe1, 0xeb, 0x9, 0xeb, 0x8e, 0xf, 0xce, 0x0, 0x20, 
-0xb, 0x9f, 0x77, 0x23, 0x73, 0x23, 0x72, 0x2b, 0x2b, 0x2b, 0xd1, 0xc9, 0x2b, 0xd1, 0xcd, 0x93, 
-0x32, 0xd9, 0xe5, 0xd9, 0xd5, 0xe5, 0xcd, 0x9b, 0x2f, 0x47, 0xeb, 0xcd, 0x9b, 0x2f, 0x4f, 0xb8, 
-0x30, 0x3, 0x78, 0x41, 0xeb, 0xf5, 0x90, 0xcd, 0xba, 0x2f, 0xcd, 0xdd, 0x2f, 0xf1, 0xe1, 0x77, 
-0xe5, 0x68, 0x61, 0x19, 0xd9, 0xeb, 0xed, 0x4a, 0xeb, 0x7c, 0x8d, 0x6f, 0x1f, 0xad, 0xd9, 0xeb, 
-0xe1, 0x1f, 0x30, 0x8, 0x3e, 0x1, 0xcd, 0xdd, 0x2f, 0x34, 0x28, 0x23, 0xd9, 0x7d, 0xe6, 0x80, 
-0xd9, 0x23, 0x77, 0x2b, 0x28, 0x1f, 0x7b, 0xed, 0x44, 0x3f, 0x5f, 0x7a, 0x2f, 0xce, 0x0, 0x57, 
-0xd9, 0x7b, 0x2f, 0xce, 0x0, 0x5f, 0x7a, 0x2f, 0xce, 0x0, 0x30, 0x7, 0x1f, 0xd9, 0x34, 0xca, 
-0xad, 0x31, 0xd9, 0x57, 0xd9, 0xaf, 0xc3, 0x55, 0x31, 0xc5, 0x6, 0x10, 0x7c, 0x4d, 0x21, 0x0, 
-0x0, 0x29, 0x38, 0xa, 0xcb, 0x11, 0x17, 0x30, 0x3, 0x19, 0x38, 0x2, 0x10, 0xf3, 0xc1, 0xc9, 
-0xcd, 0xe9, 0x34, 0xd8, 0x23, 0xae, 0xcb, 0xfe, 0x2b, 0xc9, 0x1a, 0xb6, 0x20, 0x22, 0xd5, 0xe5, 
-0xd5, 0xcd, 0x7f, 0x2d, 0xeb, 0xe3, 0x41, 0xcd, 0x7f, 0x2d, 0x78, 0xa9, 0x4f, 0xe1, 0xcd, 0xa9, 
-0x30, 0xeb, 0xe1, 0x38, 0xa, 0x7a, 0xb3, 0x20, 0x1, 0x4f, 0xcd, 0x8e, 0x2d, 0xd1, 0xc9, 0xd1, 
-0xcd, 0x93, 0x32, 0xaf, 0xcd, 0xc0, 0x30, 0xd8, 0xd9, 0xe5, 0xd9, 0xd5, 0xeb, 0xcd, 0xc0, 0x30, 
-0xeb, 0x38, 0x5a, 0xe5, 0xcd, 0xba, 0x2f, 0x78, 0xa7, 0xed, 0x62, 0xd9, 0xe5, 0xed, 0x62, 0xd9, 
-0x6, 0x21, 0x18, 0x11, 0x30, 0x5, 0x19, 0xd9, 0xed, 0x5a, 0xd9, 0xd9, 0xcb, 0x1c, 0xcb, 0x1d, 
-0xd9, 0xcb, 0x1c, 0xcb, 0x1d, 0xd9, 0xcb, 0x18, 0xcb, 0x19, 0xd9, 0xcb, 0x19, 0x1f, 0x10, 0xe4, 
-0xeb, 0xd9, 0xeb, 0xd9, 0xc1, 0xe1, 0x78, 0x81, 0x20, 0x1, 0xa7, 0x3d, 0x3f, 0x17, 0x3f, 0x1f, 
-0xf2, 0x46, 0x31, 0x30, 0x68, 0xa7, 0x3c, 0x20, 0x8, 0x38, 0x6, 0xd9, 0xcb, 0x7a, 0xd9, 0x20, 
-0x5c, 0x77, 0xd9, 0x78, 0xd9, 0x30, 0x15, 0x7e, 0xa7, 0x3e, 0x80, 0x28, 0x1, 0xaf, 0xd9, 0xa2, 
-0xcd, 0xfb, 0x2f, 0x7, 0x77, 0x38, 0x2e, 0x23, 0x77, 0x2b, 0x18, 0x29, 0x6, 0x20, 0xd9, 0xcb, 
-0x7a, 0xd9, 0x20, 0x12, 0x7, 0xcb, 0x13, 0xcb, 0x12, 0xd9, 0xcb, 0x13, 0xcb, 0x12, 0xd9, 0x35, 
-0x28, 0xd7, 0x10, 0xea, 0x18, 0xd7, 0x17, 0x30, 0xc, 0xcd, 0x4, 0x30, 0x20, 0x7, 0xd9, 0x16, 
-0x80, 0xd9, 0x34, 0x28, 0x18, 0xe5, 0x23, 0xd9, 0xd5, 0xd9, 0xc1, 0x78, 0x17, 0xcb, 0x16, 0x1f, 
-0x77, 0x23, 0x71, 0x23, 0x72, 0x23, 0x73, 0xe1, 0xd1, 0xd9, 0xe1, 0xd9, 0xc9, 0xcf, 0x5, 0xcd, 
-0x93, 0x32, 0xeb, 0xaf, 0xcd, 0xc0, 0x30, 0x38, 0xf4, 0xeb, 0xcd, 0xc0, 0x30, 0xd8, 0xd9, 0xe5, 
-0xd9, 0xd5, 0xe5, 0xcd, 0xba, 0x2f, 0xd9, 0xe5, 0x60, 0x69, 0xd9, 0x61, 0x68, 0xaf, 0x6, 0xdf, 
-0x18, 0x10, 0x17, 0xcb, 0x11, 0xd9, 0xcb, 0x11, 0xcb, 0x10, 0xd9, 0x29, 0xd9, 0xed, 0x6a, 0xd9, 
-0x38, 0x10, 0xed, 0x52, 0xd9, 0xed, 0x52, 0xd9, 0x30, 0xf, 0x19, 0xd9, 0xed, 0x5a, 0xd9, 0xa7, 
-0x18, 0x8, 0xa7, 0xed, 0x52, 0xd9, 0xed, 0x52, 0xd9, 0x37, 0x4, 0xfa, 0xd2, 0x31, 0xf5, 0x28, 
-0xe1, 0x5f, 0x51, 0xd9, 0x59, 0x50, 0xf1, 0xcb, 0x18, 0xf1, 0xcb, 0x18, 0xd9, 0xc1, 0xe1, 0x78, 
-0x91, 0xc3, 0x3d, 0x31, 0x7e, 0xa7, 0xc8, 0xfe, 0x81, 0x30, 0x6, 0x36, 0x0, 0x3e, 0x20, 0x18, 
-0x51, 0xfe, 0x91, 0x20, 0x1a, 0x23, 0x23, 0x23, 0x3e, 0x80, 0xa6, 0x2b, 0xb6, 0x2b, 0x20, 0x3, 
-0x3e, 0x80, 0xae, 0x2b, 0x20, 0x36, 0x77, 0x23, 0x36, 0xff, 0x2b, 0x3e, 0x18, 0x18, 0x33, 0x30, 
-0x2c, 0xd5, 0x2f, 0xc6, 0x91, 0x23, 0x56, 0x23, 0x5e, 0x2b, 0x2b, 0xe, 0x0, 0xcb, 0x7a, 0x28, 
-0x1, 0xd, 0xcb, 0xfa, 0x6, 0x8, 0x90, 0x80, 0x38, 0x4, 0x5a, 0x16, 0x0, 0x90, 0x28, 0x7, 
-0x47, 0xcb, 0x3a, 0xcb, 0x1b, 0x10, 0xfa, 0xcd, 0x8e, 0x2d, 0xd1, 0xc9, 0x7e, 0xd6, 0xa0, 0xf0, 
-0xed, 0x44, 0xd5, 0xeb, 0x2b, 0x47, 0xcb, 0x38, 0xcb, 0x38, 0xcb, 0x38, 0x28, 0x5, 0x36, 0x0, 
-0x2b, 0x10, 0xfb, 0xe6, 0x7, 0x28, 0x9, 0x47, 0x3e, 0xff, 0xcb, 0x27, 0x10, 0xfc, 0xa6, 0x77, 
-0xeb, 0xd1, 0xc9, 0xcd, 0x96, 0x32, 0xeb, 0x7e, 0xa7, 0xc0, 0xd5, 0xcd, 0x7f, 0x2d, 0xaf, 0x23, 
-0x77, 0x2b, 0x77, 0x6, 0x91, 0x7a, 0xa7, 0x20, 0x8, 0xb3, 0x42, 0x28, 0x10, 0x53, 0x58, 0x6, 
-0x89, 0xeb, 0x5, 0x29, 0x30, 0xfc, 0xcb, 0x9, 0xcb, 0x1c, 0xcb, 0x1d, 0xeb, 0x2b, 0x73, 0x2b, 
-0x72, 0x2b, 0x70, 0xd1, 0xc9, 0x0, 0xb0, 0x0, 0x40, 0xb0, 0x0, 0x1, 0x30, 0x0, 0xf1, 0x49, 
-0xf, 0xda, 0xa2, 0x40, 0xb0, 0x0, 0xa, 0x8f, 0x36, 0x3c, 0x34, 0xa1, 0x33, 0xf, 0x30, 0xca, 
-0x30, 0xaf, 0x31, 0x51, 0x38, 0x1b, 0x35, 0x24, 0x35, 0x3b, 0x35, 0x3b, 0x35, 0x3b, 0x35, 0x3b, 
-0x35, 0x3b, 0x35, 0x3b, 0x35, 0x14, 0x30, 0x2d, 0x35, 0x3b, 0x35, 0x3b, 0x35, 0x3b, 0x35, 0x3b, 
-0x35, 0x3b, 0x35, 0x3b, 0x35, 0x9c, 0x35, 0xde, 0x35, 0xbc, 0x34, 0x45, 0x36, 0x6e, 0x34, 0x69, 
-0x36, 0xde, 0x35, 0x74, 0x36, 0xb5, 0x37, 0xaa, 0x37, 0xda, 0x37, 0x33, 0x38, 0x43, 0x38, 0xe2, 
-0x37, 0x13, 0x37, 0xc4, 0x36, 0xaf, 0x36, 0x4a, 0x38, 0x92, 0x34, 0x6a, 0x34, 0xac, 0x34, 0xa5, 
-0x34, 0xb3, 0x34, 0x1f, 0x36, 0xc9, 0x35, 0x1, 0x35, 0xc0, 0x33, 0xa0, 0x36, 0x86, 0x36, 0xc6, 
-0x33, 0x7a, 0x36, 0x6, 0x35, 0xf9, 0x34, 0x9b, 0x36, 0x83, 0x37, 0x14, 0x32, 0xa2, 0x33, 0x4f, 
-0x2d, 0x97, 0x32, 0x49, 0x34, 0x1b, 0x34, 0x2d, 0x34, 0xf, 0x34, 0xcd, 0xbf, 0x35, 0x78, 0x32, 
-0x67, 0x5c, 0xd9, 0xe3, 0xd9, 0xed, 0x53, 0x65, 0x5c, 0xd9, 0x7e, 0x23, 0xe5, 0xa7, 0xf2, 0x80, 
-0x33, 0x57, 0xe6, 0x60, 0xf, 0xf, 0xf, 0xf, 0xc6, 0x7c, 0x6f, 0x7a, 0xe6, 0x1f, 0x18, 0xe, 
-0xfe, 0x18, 0x30, 0x8, 0xd9, 0x1, 0xfb, 0xff, 0x54, 0x5d, 0x9, 0xd9, 0x7, 0x6f, 0x11, 0xd7, 
-0x32, 0x26, 0x0, 0x19, 0x5e, 0x23, 0x56, 0x21, 0x65, 0x33, 0xe3, 0xd5, 0xd9, 0xed, 0x4b, 0x66, 
-0x5c, 0xc9, 0xf1, 0x3a, 0x67, 0x5c, 0xd9, 0x18, 0xc3, 0xd5, 0xe5, 0x1, 0x5, 0x0, 0xcd, 0x5, 
-0x1f, 0xe1, 0xd1, 0xc9, 0xed, 0x5b, 0x65, 0x5c, 0xcd, 0xc0, 0x33, 0xed, 0x53, 0x65, 0x5c, 0xc9, 
-0xcd, 0xa9, 0x33, 0xed, 0xb0, 0xc9, 0x62, 0x6b, 0xcd, 0xa9, 0x33, 0xd9, 0xe5, 0xd9, 0xe3, 0xc5, 
-0x7e, 0xe6, 0xc0, 0x7, 0x7, 0x4f, 0xc, 0x7e, 0xe6, 0x3f, 0x20, 0x2, 0x23, 0x7e, 0xc6, 0x50, 
-0x12, 0x3e, 0x5, 0x91, 0x23, 0x13, 0x6, 0x0, 0xed, 0xb0, 0xc1, 0xe3, 0xd9, 0xe1, 0xd9, 0x47, 
-0xaf, 0x5, 0xc8, 0x12, 0x13, 0x18, 0xfa, 0xa7, 0xc8, 0xf5, 0xd5, 0x11, 0x0, 0x0, 0xcd, 0xc8, 
-0x33, 0xd1, 0xf1, 0x3d, 0x18, 0xf2, 0x4f, 0x7, 0x7, 0x81, 0x4f, 0x6, 0x0, 0x9, 0xc9, 0xd5, 
-0x2a, 0x68, 0x5c, 0xcd, 0x6, 0x34, 0xcd, 0xc0, 0x33, 0xe1, 0xc9, 0x62, 0x6b, 0xd9, 0xe5, 0x21, 
-0xc5, 0x32, 0xd9, 0xcd, 0xf7, 0x33, 0xcd, 0xc8, 0x33, 0xd9, 0xe1, 0xd9, 0xc9, 0xe5, 0xeb, 0x2a, 
-0x68, 0x5c, 0xcd, 0x6, 0x34, 0xeb, 0xcd, 0xc0, 0x33, 0xeb, 0xe1, 0xc9, 0x6, 0x5, 0x1a, 0x4e, 
-0xeb, 0x12, 0x71, 0x23, 0x13, 0x10, 0xf7, 0xeb, 0xc9, 0x47, 0xcd, 0x5e, 0x33, 0x31, 0xf, 0xc0, 
-0x2, 0xa0, 0xc2, 0x31, 0xe0, 0x4, 0xe2, 0xc1, 0x3, 0x38, 0xcd, 0xc6, 0x33, 0xcd, 0x62, 0x33, 
-0xf, 0x1, 0xc2, 0x2, 0x35, 0xee, 0xe1, 0x3, 0x38, 0xc9, 0x6, 0xff, 0x18, 0x6, 0xcd, 0xe9, 
-0x34, 0xd8, 0x6, 0x0, 0x7e, 0xa7, 0x28, 0xb, 0x23, 0x78, 0xe6, 0x80, 0xb6, 0x17, 0x3f, 0x1f, 
-0x77, 0x2b, 0xc9, 0xd5, 0xe5, 0xcd, 0x7f, 0x2d, 0xe1, 0x78, 0xb1, 0x2f, 0x4f, 0xcd, 0x8e, 0x2d, 
-0xd1, 0xc9, 0xcd, 0xe9, 0x34, 0xd8, 0xd5, 0x11, 0x1, 0x0, 0x23, 0xcb, 0x16, 0x2b, 0x9f, 0x4f, 
-0xcd, 0x8e, 0x2d, 0xd1, 0xc9, 0xcd, 0x99, 0x1e, 0xed, 0x78, 0x18, 0x4, 0xcd, 0x99, 0x1e, 0xa, 
-0xc3, 0x28, 0x2d, 0xcd, 0x99, 0x1e, 0x21, 0x2b, 0x2d, 0xe5, 0xc5, 0xc9, 0xcd, 0xf1, 0x2b, 0xb, 
-0x78, 0xb1, 0x20, 0x23, 0x1a, 0xcd, 0x8d, 0x2c, 0x38, 0x9, 0xd6, 0x90, 0x38, 0x19, 0xfe, 0x15, 
-0x30, 0x15, 0x3c, 0x3d, 0x87, 0x87, 0x87, 0xfe, 0xa8, 0x30, 0xc, 0xed, 0x4b, 0x7b, 0x5c, 0x81, 
-0x4f, 0x30, 0x1, 0x4, 0xc3, 0x2b, 0x2d, 0xcf, 0x9, 0xe5, 0xc5, 0x47, 0x7e, 0x23, 0xb6, 0x23, 
-0xb6, 0x23, 0xb6, 0x78, 0xc1, 0xe1, 0xc0, 0x37, 0xc9, 0xcd, 0xe9, 0x34, 0xd8, 0x3e, 0xff, 0x18, 
-0x6, 0xcd, 0xe9, 0x34, 0x18, 0x5, 0xaf, 0x23, 0xae, 0x2b, 0x7, 0xe5, 0x3e, 0x0, 0x77, 0x23, 
-0x77, 0x23, 0x17, 0x77, 0x1f, 0x23, 0x77, 0x23, 0x77, 0xe1, 0xc9, 0xeb, 0xcd, 0xe9, 0x34, 0xeb, 
-0xd8, 0x37, 0x18, 0xe7, 0xeb, 0xcd, 0xe9, 0x34, 0xeb, 0xd0, 0xa7, 0x18, 0xde, 0xeb, 0xcd, 0xe9, 
-0x34, 0xeb, 0xd0, 0xd5, 0x1b, 0xaf, 0x12, 0x1b, 0x12, 0xd1, 0xc9, 0x78, 0xd6, 0x8, 0xcb, 0x57, 
-0x20, 0x1, 0x3d, 0xf, 0x30, 0x8, 0xf5, 0xe5, 0xcd, 0x3c, 0x34, 0xd1, 0xeb, 0xf1, 0xcb, 0x57, 
-0x20, 0x7, 0xf, 0xf5, 0xcd, 0xf, 0x30, 0x18, 0x33, 0xf, 0xf5, 0xcd, 0xf1, 0x2b, 0xd5, 0xc5, 
-0xcd, 0xf1, 0x2b, 0xe1, 0x7c, 0xb5, 0xe3, 0x78, 0x20, 0xb, 0xb1, 0xc1, 0x28, 0x4, 0xf1, 0x3f, 
-0x18, 0x16, 0xf1, 0x18, 0x13, 0xb1, 0x28, 0xd, 0x1a, 0x96, 0x38, 0x9, 0x20, 0xed, 0xb, 0x13, 
-0x23, 0xe3, 0x2b, 0x18, 0xdf, 0xc1, 0xf1, 0xa7, 0xf5, 0xef, 0xa0, 0x38, 0xf1, 0xf5, 0xdc, 0x1, 
-0x35, 0xf1, 0xf5, 0xd4, 0xf9, 0x34, 0xf1, 0xf, 0xd4, 0x1, 0x35, 0xc9, 0xcd, 0xf1, 0x2b, 0xd5, 
-0xc5, 0xcd, 0xf1, 0x2b, 0xe1, 0xe5, 0xd5, 0xc5, 0x9, 0x44, 0x4d, 0xf7, 0xcd, 0xb2, 0x2a, 0xc1, 
-0xe1, 0x78, 0xb1, 0x28, 0x2, 0xed, 0xb0, 0xc1, 0xe1, 0x78, 0xb1, 0x28, 0x2, 0xed, 0xb0, 0x2a, 
-0x65, 0x5c, 0x11, 0xfb, 0xff, 0xe5, 0x19, 0xd1, 0xc9, 0xcd, 0xd5, 0x2d, 0x38, 0xe, 0x20, 0xc, 
-0xf5, 0x1, 0x1, 0x0, 0xf7, 0xf1, 0x12, 0xcd, 0xb2, 0x2a, 0xeb, 0xc9, 0xcf, 0xa, 0x2a, 0x5d, 
-0x5c, 0xe5, 0x78, 0xc6, 0xe3, 0x9f, 0xf5, 0xcd, 0xf1, 0x2b, 0xd5, 0x3, 0xf7, 0xe1, 0xed, 0x53, 
-0x5d, 0x5c, 0xd5, 0xed, 0xb0, 0xeb, 0x2b, 0x36, 0xd, 0xfd, 0xcb, 0x1, 0xbe, 0xcd, 0xfb, 0x24, 
-0xdf, 0xfe, 0xd, 0x20, 0x7, 0xe1, 0xf1, 0xfd, 0xae, 0x1, 0xe6, 0x40, 0xc2, 0x8a, 0x1c, 0x22, 
-0x5d, 0x5c, 0xfd, 0xcb, 0x1, 0xfe, 0xcd, 0xfb, 0x24, 0xe1, 0x22, 0x5d, 0x5c, 0x18, 0xa0, 0x1, 
-0x1, 0x0, 0xf7, 0x22, 0x5b, 0x5c, 0xe5, 0x2a, 0x51, 0x5c, 0xe5, 0x3e, 0xff, 0xcd, 0x1, 0x16, 
-0xcd, 0xe3, 0x2d, 0xe1, 0xcd, 0x15, 0x16, 0xd1, 0x2a, 0x5b, 0x5c, 0xa7, 0xed, 0x52, 0x44, 0x4d, 
-0xcd, 0xb2, 0x2a, 0xeb, 0xc9, 0xcd, 0x94, 0x1e, 0xfe, 0x10, 0xd2, 0x9f, 0x1e, 0x2a, 0x51, 0x5c, 
-0xe5, 0xcd, 0x1, 0x16, 0xcd, 0xe6, 0x15, 0x1, 0x0, 0x0, 0x30, 0x3, 0xc, 0xf7, 0x12, 0xcd, 
-0xb2, 0x2a, 0xe1, 0xcd, 0x15, 0x16, 0xc3, 0xbf, 0x35, 0xcd, 0xf1, 0x2b, 0x78, 0xb1, 0x28, 0x1, 
-0x1a, 0xc3, 0x28, 0x2d, 0xcd, 0xf1, 0x2b, 0xc3, 0x2b, 0x2d, 0xd9, 0xe5, 0x21, 0x67, 0x5c, 0x35, 
-0xe1, 0x20, 0x4, 0x23, 0xd9, 0xc9, 0xd9, 0x5e, 0x7b, 0x17, 0x9f, 0x57, 0x19, 0xd9, 0xc9, 0x13, 
-0x13, 0x1a, 0x1b, 0x1b, 0xa7, 0x20, 0xef, 0xd9, 0x23, 0xd9, 0xc9, 0xf1, 0xd9, 0xe3, 0xd9, 0xc9, 
-0xef, 0xc0, 0x2, 0x31, 0xe0, 0x5, 0x27, 0xe0, 0x1, 0xc0, 0x4, 0x3, 0xe0, 0x38, 0xc9, 0xef, 
-0x31, 0x36, 0x0, 0x4, 0x3a, 0x38, 0xc9, 0x31, 0x3a, 0xc0, 0x3, 0xe0, 0x1, 0x30, 0x0, 0x3, 
-0xa1, 0x3, 0x38, 0xc9, 0xef, 0x3d, 0x34, 0xf1, 0x38, 0xaa, 0x3b, 0x29, 0x4, 0x31, 0x27, 0xc3, 
-0x3, 0x31, 0xf, 0xa1, 0x3, 0x88, 0x13, 0x36, 0x58, 0x65, 0x66, 0x9d, 0x78, 0x65, 0x40, 0xa2, 
-0x60, 0x32, 0xc9, 0xe7, 0x21, 0xf7, 0xaf, 0x24, 0xeb, 0x2f, 0xb0, 0xb0, 0x14, 0xee, 0x7e, 0xbb, 
-0x94, 0x58, 0xf1, 0x3a, 0x7e, 0xf8, 0xcf, 0xe3, 0x38, 0xcd, 0xd5, 0x2d, 0x20, 0x7, 0x38, 0x3, 
-0x86, 0x30, 0x9, 0xcf, 0x5, 0x38, 0x7, 0x96, 0x30, 0x4, 0xed, 0x44, 0x77, 0xc9, 0xef, 0x2, 
-0xa0, 0x38, 0xc9, 0xef, 0x3d, 0x31, 0x37, 0x0, 0x4, 0x38, 0xcf, 0x9, 0xa0, 0x2, 0x38, 0x7e, 
-0x36, 0x80, 0xcd, 0x28, 0x2d, 0xef, 0x34, 0x38, 0x0, 0x3, 0x1, 0x31, 0x34, 0xf0, 0x4c, 0xcc, 
-0xcc, 0xcd, 0x3, 0x37, 0x0, 0x8, 0x1, 0xa1, 0x3, 0x1, 0x38, 0x34, 0xef, 0x1, 0x34, 0xf0, 
-0x31, 0x72, 0x17, 0xf8, 0x4, 0x1, 0xa2, 0x3, 0xa2, 0x3, 0x31, 0x34, 0x32, 0x20, 0x4, 0xa2, 
-0x3, 0x8c, 0x11, 0xac, 0x14, 0x9, 0x56, 0xda, 0xa5, 0x59, 0x30, 0xc5, 0x5c, 0x90, 0xaa, 0x9e, 
-0x70, 0x6f, 0x61, 0xa1, 0xcb, 0xda, 0x96, 0xa4, 0x31, 0x9f, 0xb4, 0xe7, 0xa0, 0xfe, 0x5c, 0xfc, 
-0xea, 0x1b, 0x43, 0xca, 0x36, 0xed, 0xa7, 0x9c, 0x7e, 0x5e, 0xf0, 0x6e, 0x23, 0x80, 0x93, 0x4, 
-0xf, 0x38, 0xc9, 0xef, 0x3d, 0x34, 0xee, 0x22, 0xf9, 0x83, 0x6e, 0x4, 0x31, 0xa2, 0xf, 0x27, 
-0x3, 0x31, 0xf, 0x31, 0xf, 0x31, 0x2a, 0xa1, 0x3, 0x31, 0x37, 0xc0, 0x0, 0x4, 0x2, 0x38, 
-0xc9, 0xa1, 0x3, 0x1, 0x36, 0x0, 0x2, 0x1b, 0x38, 0xc9, 0xef, 0x39, 0x2a, 0xa1, 0x3, 0xe0, 
-0x0, 0x6, 0x1b, 0x33, 0x3, 0xef, 0x39, 0x31, 0x31, 0x4, 0x31, 0xf, 0xa1, 0x3, 0x86, 0x14, 
-0xe6, 0x5c, 0x1f, 0xb, 0xa3, 0x8f, 0x38, 0xee, 0xe9, 0x15, 0x63, 0xbb, 0x23, 0xee, 0x92, 0xd, 
-0xcd, 0xed, 0xf1, 0x23, 0x5d, 0x1b, 0xea, 0x4, 0x38, 0xc9, 0xef, 0x31, 0x1f, 0x1, 0x20, 0x5, 
-0x38, 0xc9, 0xcd, 0x97, 0x32, 0x7e, 0xfe, 0x81, 0x38, 0xe, 0xef, 0xa1, 0x1b, 0x1, 0x5, 0x31, 
-0x36, 0xa3, 0x1, 0x0, 0x6, 0x1b, 0x33, 0x3, 0xef, 0xa0, 0x1, 0x31, 0x31, 0x4, 0x31, 0xf, 
-0xa1, 0x3, 0x8c, 0x10, 0xb2, 0x13, 0xe, 0x55, 0xe4, 0x8d, 0x58, 0x39, 0xbc, 0x5b, 0x98, 0xfd, 
-0x9e, 0x0, 0x36, 0x75, 0xa0, 0xdb, 0xe8, 0xb4, 0x63, 0x42, 0xc4, 0xe6, 0xb5, 0x9, 0x36, 0xbe, 
-0xe9, 0x36, 0x73, 0x1b, 0x5d, 0xec, 0xd8, 0xde, 0x63, 0xbe, 0xf0, 0x61, 0xa1, 0xb3, 0xc, 0x4, 
-0xf, 0x38, 0xc9, 0xef, 0x31, 0x31, 0x4, 0xa1, 0x3, 0x1b, 0x28, 0xa1, 0xf, 0x5, 0x24, 0x31, 
-0xf, 0x38, 0xc9, 0xef, 0x22, 0xa3, 0x3, 0x1b, 0x38, 0xc9, 0xef, 0x31, 0x30, 0x0, 0x1e, 0xa2, 
-0x38, 0xef, 0x1, 0x31, 0x30, 0x0, 0x7, 0x25, 0x4, 0x38, 0xc3, 0xc4, 0x36, 0x2, 0x31, 0x30, 
-0x0, 0x9, 0xa0, 0x1, 0x37, 0x0, 0x6, 0xa1, 0x1, 0x5, 0x2, 0xa1, 0x38, 0xc9, 0xdd, 0xe5, 
-0xfd, 0xcb, 0x1, 0x66, 0x28, 0x3, 0xcd, 0x42, 0x3a, 0xcd, 0xbf, 0x2, 0xdd, 0xe1, 0xc9, 0xe, 
-0xfd, 0x16, 0xff, 0x1e, 0xbf, 0x42, 0x3e, 0x7, 0xed, 0x79, 0xed, 0x60, 0x3e, 0xe, 0xed, 0x79, 
-0xed, 0x78, 0xf6, 0xf0, 0x6f, 0xc9, 0x42, 0x3e, 0xe, 0xed, 0x79, 0x43, 0xed, 0x69, 0xc9, 0x42, 
-0x3e, 0xe, 0xed, 0x79, 0xed, 0x78, 0xc9, 0x7d, 0xe6, 0xfe, 0x6f, 0x18, 0xe9, 0x7d, 0xf6, 0x1, 
-0x6f, 0x18, 0xe3, 0x10, 0xfe, 0xc9, 0xc5, 0x6, 0x10, 0xcd, 0xb3, 0x38, 0xc1, 0x10, 0xf7, 0xc9, 
-0xc5, 0xcd, 0x9f, 0x38, 0xc1, 0xe6, 0x20, 0x28, 0x2, 0x10, 0xf5, 0xc9, 0xc5, 0xcd, 0x9f, 0x38, 
-0xc1, 0xe6, 0x20, 0x20, 0x2, 0x10, 0xf5, 0xc9, 0xcd, 0x7f, 0x38, 0x6, 0x1, 0x18, 0x5, 0xcd, 
-0x7f, 0x38, 0x6, 0x4, 0xc5, 0xcd, 0x9f, 0x38, 0xc1, 0xe6, 0x20, 0x28, 0x40, 0xaf, 0xc5, 0xf5, 
-0xcd, 0xad, 0x38, 0x6, 0xa3, 0xcd, 0xc0, 0x38, 0x20, 0x31, 0xcd, 0xa7, 0x38, 0x18, 0x2, 0xff, 
-0xff, 0x6, 0x2b, 0xcd, 0xb3, 0x38, 0xcd, 0x9f, 0x38, 0xcb, 0x6f, 0x28, 0x4, 0xf1, 0x37, 0x18, 
-0x3, 0xf1, 0x37, 0x3f, 0x1f, 0xf5, 0xcd, 0xad, 0x38, 0x6, 0x26, 0xcd, 0xb3, 0x38, 0xcd, 0xa7, 
-0x38, 0x6, 0x23, 0xcd, 0xb3, 0x38, 0xf1, 0xc1, 0x10, 0xc4, 0xc9, 0xf1, 0xc1, 0xcd, 0xad, 0x38, 
-0xaf, 0x32, 0x88, 0x5b, 0x3c, 0x37, 0x3f, 0xc9, 0xcd, 0x7f, 0x38, 0x3a, 0x88, 0x5b, 0xe6, 0x80, 
-0x20, 0x57, 0xcd, 0x9f, 0x38, 0xe6, 0x20, 0x28, 0xe4, 0x3a, 0x88, 0x5b, 0xa7, 0x20, 0xb, 0x3c, 
-0x32, 0x88, 0x5b, 0x3e, 0x4c, 0x32, 0x89, 0x5b, 0x18, 0x42, 0x3a, 0x89, 0x5b, 0x3d, 0x32, 0x89, 
-0x5b, 0x20, 0x39, 0xaf, 0x32, 0x88, 0x5b, 0x32, 0x89, 0x5b, 0x32, 0x8a, 0x5b, 0xcd, 0xa7, 0x38, 
-0x6, 0x21, 0xcd, 0xc0, 0x38, 0x20, 0xb6, 0xcd, 0xad, 0x38, 0x6, 0x24, 0xcd, 0xcc, 0x38, 0x28, 
-0xac, 0xcd, 0xa7, 0x38, 0x6, 0xf, 0xcd, 0xb6, 0x38, 0xcd, 0xdf, 0x38, 0x20, 0x9f, 0xcb, 0xff, 
-0xe6, 0xf0, 0x32, 0x88, 0x5b, 0xaf, 0xcb, 0x3f, 0xc9, 0xaf, 0x37, 0xc9, 0xaf, 0x3c, 0x37, 0xc9, 
-0xcd, 0x38, 0x39, 0x3a, 0x88, 0x5b, 0x2f, 0xe6, 0xc0, 0xc0, 0xdd, 0x21, 0x8a, 0x5b, 0x6, 0x5, 
-0xc5, 0xcd, 0xd8, 0x38, 0xc2, 0x3a, 0x3a, 0xcb, 0x7f, 0x28, 0x21, 0xcd, 0xdf, 0x38, 0x20, 0x7a, 
-0xc1, 0xc5, 0x4f, 0xdd, 0x7e, 0x0, 0xcb, 0x40, 0x28, 0xc, 0xcb, 0x39, 0xcb, 0x39, 0xcb, 0x39, 
-0xcb, 0x39, 0xe6, 0xf0, 0x18, 0x2, 0xe6, 0xf, 0xb1, 0xdd, 0x77, 0x0, 0xc1, 0xcb, 0x40, 0x20, 
-0x2, 0xdd, 0x2b, 0x10, 0xcb, 0x1e, 0x80, 0xdd, 0x21, 0x88, 0x5b, 0x21, 0x3f, 0x3a, 0x6, 0x3, 
-0xdd, 0x7e, 0x0, 0xa6, 0x28, 0x21, 0xcb, 0x7b, 0x28, 0x42, 0xc5, 0xf5, 0x78, 0x18, 0x2, 0xff, 
-0xff, 0x3d, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0xf6, 0x7, 0x47, 0xf1, 0xcb, 0x27, 0xda, 0x13, 
-0x3a, 0x10, 0xf9, 0x58, 0xc1, 0x20, 0x25, 0xdd, 0x23, 0x23, 0x10, 0xd4, 0xcb, 0x7b, 0x20, 0x7, 
-0x7b, 0xe6, 0xfc, 0x28, 0x2, 0x1d, 0x1d, 0x3a, 0x8a, 0x5b, 0xe6, 0x8, 0x28, 0x6, 0x7b, 0xe6, 
-0x7f, 0xc6, 0x12, 0x5f, 0x7b, 0xc6, 0x5a, 0x5f, 0xaf, 0xc9, 0xc1, 0xc9, 0xaf, 0x3c, 0xc9, 0xf, 
-0xff, 0xf2, 0x1e, 0x80, 0x3a, 0x78, 0x5c, 0xe6, 0x1, 0x20, 0x4, 0xcd, 0xa0, 0x39, 0xc0, 0x21, 
-0x0, 0x5c, 0xcb, 0x7e, 0x20, 0xc, 0x7e, 0xfe, 0x5b, 0x38, 0x7, 0x23, 0x35, 0x2b, 0x20, 0x2, 
-0x36, 0xff, 0x7d, 0x21, 0x4, 0x5c, 0xbd, 0x20, 0xe9, 0xcd, 0xae, 0x3a, 0xc0, 0x7b, 0x21, 0x0, 
-0x5c, 0xbe, 0x28, 0x2a, 0xeb, 0x21, 0x4, 0x5c, 0xbe, 0x28, 0x23, 0xcb, 0x7e, 0x20, 0x4, 0xeb, 
-0xcb, 0x7e, 0xc8, 0x5f, 0x77, 0x23, 0x36, 0xa, 0x23, 0x3a, 0x9, 0x5c, 0xcb, 0x3f, 0x77, 0x23, 
-0xcd, 0xd7, 0x3a, 0x73, 0x7b, 0x32, 0x8, 0x5c, 0x21, 0x3b, 0x5c, 0xcb, 0xee, 0xc9, 0x23, 0x36, 
-0xa, 0x23, 0x35, 0xc0, 0x3a, 0xa, 0x5c, 0xcb, 0x3f, 0x77, 0x23, 0x5e, 0x18, 0xe6, 0x7b, 0x21, 
-0x66, 0x5b, 0xcb, 0x46, 0x28, 0x6, 0xfe, 0x6d, 0x30, 0x1a, 0xaf, 0xc9, 0xfe, 0x80, 0x30, 0x14, 
-0xfe, 0x6c, 0x20, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0xaf, 0x3c, 0xc9, 0xe5, 0x7b, 0xd6, 0x5b, 0x16, 0x0, 0x5f, 0x21, 0x66, 
-0x5b, 0xcb, 0x46, 0x28, 0x5, 0x21, 0x13, 0x3b, 0x18, 0x25, 0x21, 0x25, 0x3b, 0xfe, 0x11, 0x38, 
-0x1e, 0x21, 0x21, 0x3b, 0xfe, 0x15, 0x28, 0x17, 0xfe, 0x16, 0x28, 0x13, 0x18, 0x3, 0x0, 0xff, 
-0xff, 0xfe, 0x17, 0x28, 0xa, 0x21, 0x18, 0x3b, 0xfe, 0x21, 0x30, 0x3, 0x21, 0x13, 0x3b, 0x19, 
-0x5e, 0xe1, 0xc9, 0x2e, 0xd, 0x33, 0x32, 0x31, 0x29, 0x28, 0x2a, 0x2f, 0x2d, 0x39, 0x38, 0x37, 
-0x2b, 0x36, 0x35, 0x34, 0x30, 0xa5, 0xd, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb, 0xc, 0x7, 0x9, 
-0xa, 0x8, 0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xfd, 0xcb, 0x1, 0x66, 0x20, 
-0x5, 0xaf, 0x11, 0x36, 0x15, 0xc9, 0x21, 0xf, 0x1, 0xe3, 0xc3, 0x0, 0x5b, 0xfd, 0xcb, 0x1, 
-0x66, 0x20, 0x5, 0xfd, 0xcb, 0xa, 0x7e, 0xc9, 0x21, 0x12, 0x1, 0x18, 0xec, 0xfd, 0xcb, 0x1, 
-0x66, 0x20, 0x4, 0xdf, 0xfe, 0xd, 0xc9, 0x21, 0x15, 0x1, 0x18, 0xdd, 0xcd, 0x8e, 0x2, 0xe, 
-0x0, 0x20, 0xd, 0xcd, 0x1e, 0x3, 0x30, 0x8, 0x15, 0x5f, 0xcd, 0x33, 0x3, 0xc3, 0x57, 0x26, 
-0xfd, 0xcb, 0x1, 0x66, 0xca, 0x60, 0x26, 0xf3, 0xcd, 0xa0, 0x39, 0xfb, 0x20, 0xc, 0xcd, 0xae, 
-0x3a, 0x20, 0x7, 0xcd, 0xd7, 0x3a, 0x7b, 0xc3, 0x57, 0x26, 0xe, 0x0, 0xc3, 0x60, 0x26, 0xfe, 
-0xa3, 0x28, 0xc, 0xfe, 0xa4, 0x28, 0x8, 0xd6, 0xa5, 0xd2, 0x5f, 0xb, 0xc3, 0x56, 0xb, 0xfd, 
-0xcb, 0x1, 0x66, 0x28, 0xf2, 0x11, 0xc9, 0x3b, 0xd5, 0xd6, 0xa3, 0x11, 0xd2, 0x3b, 0x28, 0x3, 
-0x11, 0xda, 0x3b, 0x3e, 0x4, 0xf5, 0xc3, 0x17, 0xc, 0x37, 0xfd, 0xcb, 0x1, 0x4e, 0xc0, 0xc3, 
-0x3, 0xb, 0x53, 0x50, 0x45, 0x43, 0x54, 0x52, 0x55, 0xcd, 0x50, 0x4c, 0x41, 0xd9, 0xc3, 0x1, 
-0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0xc3, 0xa0, 0x39, 0xc3, 0x10, 0x3c, 0xc3, 0x10, 0x3c, 0xc3, 0x10, 0x3c, 0xc3, 0x10, 0x3c, 
-0x3e, 0x7f, 0xdb, 0xfe, 0x1f, 0xd8, 0x3e, 0xfe, 0xdb, 0xfe, 0x1f, 0xd8, 0x3e, 0x7, 0xd3, 0xfe, 
-0x3e, 0x2, 0xcd, 0x1, 0x16, 0xaf, 0x32, 0x3c, 0x5c, 0x3e, 0x16, 0xd7, 0xaf, 0xd7, 0xaf, 0xd7, 
-0x1e, 0x8, 0x43, 0x50, 0x78, 0x3d, 0xcb, 0x17, 0xcb, 0x17, 0xcb, 0x17, 0x82, 0x3d, 0x32, 0x8f, 
-0x5c, 0x21, 0x8f, 0x3c, 0x4b, 0x7e, 0xd7, 0x23, 0xd, 0x20, 0xfa, 0x10, 0xe7, 0x43, 0x15, 0x20, 
-0xe3, 0x21, 0x0, 0x48, 0x54, 0x5d, 0x13, 0xaf, 0x77, 0x1, 0xff, 0xf, 0xed, 0xb0, 0xeb, 0x11, 
-0x0, 0x59, 0x1, 0x0, 0x2, 0xed, 0xb0, 0xf3, 0x11, 0x70, 0x3, 0x2e, 0x7, 0x1, 0x99, 0x0, 
-0xb, 0x78, 0xb1, 0x20, 0xfb, 0x7d, 0xee, 0x10, 0x6f, 0xd3, 0xfe, 0x1b, 0x7a, 0xb3, 0x20, 0xed, 
-0x1, 0x0, 0x0, 0xb, 0x78, 0xb1, 0x20, 0xfb, 0xb, 0x78, 0xb1, 0x20, 0xfb, 0x18, 0xd9, 0x13, 
-0x0, 0x31, 0x39, 0x13, 0x1, 0x38, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x10, 0x10, 0x10, 0x0, 0x10, 0x0, 
-0x0, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x7e, 0x24, 0x24, 0x7e, 0x24, 0x0, 
-0x0, 0x8, 0x3e, 0x28, 0x3e, 0xa, 0x3e, 0x8, 0x0, 0x62, 0x64, 0x8, 0x10, 0x26, 0x46, 0x0, 
-0x0, 0x10, 0x28, 0x10, 0x2a, 0x44, 0x3a, 0x0, 0x0, 0x8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x4, 0x8, 0x8, 0x8, 0x8, 0x4, 0x0, 0x0, 0x20, 0x10, 0x10, 0x10, 0x10, 0x20, 0x0, 
-0x0, 0x0, 0x14, 0x8, 0x3e, 0x8, 0x14, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3e, 0x8, 0x8, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 0x0, 0x0, 0x2, 0x4, 0x8, 0x10, 0x20, 0x0, 
-0x0, 0x3c, 0x46, 0x4a, 0x52, 0x62, 0x3c, 0x0, 0x0, 0x18, 0x28, 0x8, 0x8, 0x8, 0x3e, 0x0, 
-0x0, 0x3c, 0x42, 0x2, 0x3c, 0x40, 0x7e, 0x0, 0x0, 0x3c, 0x42, 0xc, 0x2, 0x42, 0x3c, 0x0, 
-0x0, 0x8, 0x18, 0x28, 0x48, 0x7e, 0x8, 0x0, 0x0, 0x7e, 0x40, 0x7c, 0x2, 0x42, 0x3c, 0x0, 
-0x0, 0x3c, 0x40, 0x7c, 0x42, 0x42, 0x3c, 0x0, 0x0, 0x7e, 0x2, 0x4, 0x8, 0x10, 0x10, 0x0, 
-0x0, 0x3c, 0x42, 0x3c, 0x42, 0x42, 0x3c, 0x0, 0x0, 0x3c, 0x42, 0x42, 0x3e, 0x2, 0x3c, 0x0, 
-0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x10, 0x10, 0x20, 
-0x0, 0x0, 0x4, 0x8, 0x10, 0x8, 0x4, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x3e, 0x0, 0x0, 
-0x0, 0x0, 0x10, 0x8, 0x4, 0x8, 0x10, 0x0, 0x0, 0x3c, 0x42, 0x4, 0x8, 0x0, 0x8, 0x0, 
-0x0, 0x3c, 0x4a, 0x56, 0x5e, 0x40, 0x3c, 0x0, 0x0, 0x3c, 0x42, 0x42, 0x7e, 0x42, 0x42, 0x0, 
-0x0, 0x7c, 0x42, 0x7c, 0x42, 0x42, 0x7c, 0x0, 0x0, 0x3c, 0x42, 0x40, 0x40, 0x42, 0x3c, 0x0, 
-0x0, 0x78, 0x44, 0x42, 0x42, 0x44, 0x78, 0x0, 0x0, 0x7e, 0x40, 0x7c, 0x40, 0x40, 0x7e, 0x0, 
-0x0, 0x7e, 0x40, 0x7c, 0x40, 0x40, 0x40, 0x0, 0x0, 0x3c, 0x42, 0x40, 0x4e, 0x42, 0x3c, 0x0, 
-0x0, 0x42, 0x42, 0x7e, 0x42, 0x42, 0x42, 0x0, 0x0, 0x3e, 0x8, 0x8, 0x8, 0x8, 0x3e, 0x0, 
-0x0, 0x2, 0x2, 0x2, 0x42, 0x42, 0x3c, 0x0, 0x0, 0x44, 0x48, 0x70, 0x48, 0x44, 0x42, 0x0, 
-0x0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7e, 0x0, 0x0, 0x42, 0x66, 0x5a, 0x42, 0x42, 0x42, 0x0, 
-0x0, 0x42, 0x62, 0x52, 0x4a, 0x46, 0x42, 0x0, 0x0, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x0, 
-0x0, 0x7c, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x0, 0x0, 0x3c, 0x42, 0x42, 0x52, 0x4a, 0x3c, 0x0, 
-0x0, 0x7c, 0x42, 0x42, 0x7c, 0x44, 0x42, 0x0, 0x0, 0x3c, 0x40, 0x3c, 0x2, 0x42, 0x3c, 0x0, 
-0x0, 0xfe, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0, 0x0, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x0, 
-0x0, 0x42, 0x42, 0x42, 0x42, 0x24, 0x18, 0x0, 0x0, 0x42, 0x42, 0x42, 0x42, 0x5a, 0x24, 0x0, 
-0x0, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x0, 0x0, 0x82, 0x44, 0x28, 0x10, 0x10, 0x10, 0x0, 
-0x0, 0x7e, 0x4, 0x8, 0x10, 0x20, 0x7e, 0x0, 0x0, 0xe, 0x8, 0x8, 0x8, 0x8, 0xe, 0x0, 
-0x0, 0x0, 0x40, 0x20, 0x10, 0x8, 0x4, 0x0, 0x0, 0x70, 0x10, 0x10, 0x10, 0x10, 0x70, 0x0, 
-0x0, 0x10, 0x38, 0x54, 0x10, 0x10, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x1c, 0x22, 0x78, 0x20, 0x20, 0x7e, 0x0, 0x0, 0x0, 0x38, 0x4, 0x3c, 0x44, 0x3c, 0x0, 
-0x0, 0x20, 0x20, 0x3c, 0x22, 0x22, 0x3c, 0x0, 0x0, 0x0, 0x1c, 0x20, 0x20, 0x20, 0x1c, 0x0, 
-0x0, 0x4, 0x4, 0x3c, 0x44, 0x44, 0x3c, 0x0, 0x0, 0x0, 0x38, 0x44, 0x78, 0x40, 0x3c, 0x0, 
-0x0, 0xc, 0x10, 0x18, 0x10, 0x10, 0x10, 0x0, 0x0, 0x0, 0x3c, 0x44, 0x44, 0x3c, 0x4, 0x38, 
-0x0, 0x40, 0x40, 0x78, 0x44, 0x44, 0x44, 0x0, 0x0, 0x10, 0x0, 0x30, 0x10, 0x10, 0x38, 0x0, 
-0x0, 0x4, 0x0, 0x4, 0x4, 0x4, 0x24, 0x18, 0x0, 0x20, 0x28, 0x30, 0x30, 0x28, 0x24, 0x0, 
-0x0, 0x10, 0x10, 0x10, 0x10, 0x10, 0xc, 0x0, 0x0, 0x0, 0x68, 0x54, 0x54, 0x54, 0x54, 0x0, 
-0x0, 0x0, 0x78, 0x44, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x38, 0x44, 0x44, 0x44, 0x38, 0x0, 
-0x0, 0x0, 0x78, 0x44, 0x44, 0x78, 0x40, 0x40, 0x0, 0x0, 0x3c, 0x44, 0x44, 0x3c, 0x4, 0x6, 
-0x0, 0x0, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x38, 0x40, 0x38, 0x4, 0x78, 0x0, 
-0x0, 0x10, 0x38, 0x10, 0x10, 0x10, 0xc, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x44, 0x38, 0x0, 
-0x0, 0x0, 0x44, 0x44, 0x28, 0x28, 0x10, 0x0, 0x0, 0x0, 0x44, 0x54, 0x54, 0x54, 0x28, 0x0, 
-0x0, 0x0, 0x44, 0x28, 0x10, 0x28, 0x44, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x3c, 0x4, 0x38, 
-0x0, 0x0, 0x7c, 0x8, 0x10, 0x20, 0x7c, 0x0, 0x0, 0xe, 0x8, 0x30, 0x8, 0x8, 0xe, 0x0, 
-0x0, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x0, 0x0, 0x70, 0x10, 0xc, 0x10, 0x10, 0x70, 0x0, 
-0x0, 0x14, 0x28, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x42, 0x99, 0xa1, 0xa1, 0x99, 0x42, 0x3c, 
-
-};
-dump_item dump_items[DUMP_NUM_ITEMS] = {
+static const unsigned char dump_amstrad_zx128k_0_lz4[] =
+"\xc0\xf3\x01\x2b\x69\x0b\x78\xb1\x20\xfb\xc3\xc7\x00\x01\x00\x41\xef\x10\x00\xc9\x08\x00\x13\x18\x08\x00\x12\x20\x08\x00\xf2\x6c"
+"\xe3\xf5\x7e\x23\x23\x22\x5a\x5b\x2b\x66\x6f\xf1\xc3\x5c\x00\x00\xe5\x21\x48\x00\xe5\x21\x00\x5b\xe5\x21\x38\x00\xe5\xc3\x00\x5b"
+"\xe1\xc9\x01\xfd\x7f\xaf\xf3\xed\x79\x32\x5c\x5b\xfb\x3d\xfd\x77\x00\xc3\x21\x03\x22\x58\x5b\x21\x14\x5b\xe3\xe5\x2a\x58\x5b\xe3"
+"\xc3\x00\x5b\xf5\xc5\x01\xfd\x7f\x3a\x5c\x5b\xee\x10\xf3\x32\x5c\x5b\xed\x79\xfb\xc1\xf1\xc9\xcd\x00\x5b\xe5\x2a\x5a\x5b\xe3\xc9"
+"\xf3\x3a\x5c\x5b\xe6\xef\x32\x5c\x5b\x01\xfd\x7f\xed\x79\xfb\xc3\xc3\x00\x21\xd8\x06\x18\x03\x21\xca\x07\x08\x36\x00\x32\xf5\xe6"
+"\xef\x37\x00\x82\xc3\xe6\x05\x08\xf1\x01\xfd\x7f\x0e\x00\xc1\xfb\x08\xc9\x2a\x8b\x5b\xe9\x06\x08\x78\xd9\x3d\x3b\x00\xf3\x5a\x21"
+"\x00\xc0\x11\x01\xc0\x01\xff\x3f\x3e\xff\x77\xbe\x20\x51\xaf\x77\xbe\x20\x4c\xed\xb0\xd9\x10\xdf\x32\x88\x5b\x0e\xfd\x16\xff\x1e"
+"\xbf\x42\x3e\x0e\xed\x79\x43\x3e\xff\xed\x79\x18\x38\x00\xc3\xaf\x17\xc3\x38\x18\xc3\xcf\x1e\xc3\x04\x1f\xc3\x4a\x00\xc3\xa2\x03"
+"\xc3\x2a\x18\xc3\xa8\x18\xc3\x2d\x01\xc3\x05\x0a\xc3\xa3\x11\xc3\xd8\x06\xc3\xca\x07\xc3\xa3\x08\xc3\xf0\x08\xef\x01\x3b\xc9\xd9"
+"\x78\xd3\xfe\x18\xfe\x42\x3e\x07\x44\x00\xf0\xab\x11\x00\x5b\x21\x6b\x00\x01\x58\x00\xed\xb0\x3e\xcf\x32\x5d\x5b\x31\xff\x5b\x3e"
+"\x04\xcd\x64\x1c\xdd\x21\xec\xeb\xdd\x22\x83\x5b\xdd\x36\x0a\x00\xdd\x36\x0b\xc0\xdd\x36\x0c\x00\x21\xec\x2b\x3e\x01\x22\x85\x5b"
+"\x32\x87\x5b\x3e\x05\xcd\x64\x1c\x21\xff\xff\x22\xb4\x5c\x11\xaf\x3e\x01\xa8\x00\xeb\xef\x61\x16\xeb\x23\x22\x7b\x5c\x2b\x01\x40"
+"\x00\xed\x43\x38\x5c\x22\xb2\x5c\x21\x00\x3c\x22\x36\x5c\x2a\xb2\x5c\x23\xf9\xed\x56\xfd\x21\x3a\x5c\xfd\xcb\x01\xe6\xfb\x21\x0b"
+"\x00\x22\x5f\x5b\xaf\x32\x61\x5b\x32\x63\x5b\x32\x65\x5b\x21\x00\xec\x22\x24\xff\x3e\x50\x32\x64\x5b\x21\x0a\x00\x22\x94\x5b\x22"
+"\x96\x5b\x21\xb6\x5c\x22\x4f\x5c\x11\x89\x05\x01\x15\x00\xeb\xed\xb0\xeb\x2b\x22\x57\x5c\x23\x22\x53\x5c\x22\x4b\x5c\x36\x80\x23"
+"\x22\x59\x5c\x36\x0d\x23\x09\x00\xf0\x3b\x61\x5c\x22\x63\x5c\x22\x65\x5c\x3e\x38\x32\x8d\x5c\x32\x8f\x5c\x32\x48\x5c\xaf\x32\x13"
+"\xec\x3e\x07\xd3\xfe\x21\x23\x05\x22\x09\x5c\xfd\x35\xc6\xfd\x35\xca\x21\x9e\x05\x11\x10\x5c\x01\x0e\x00\xed\xb0\xfd\xcb\x01\x8e"
+"\xfd\x36\x00\xff\xfd\x36\x31\x02\xef\x6b\x0d\xef\x04\x3c\x11\x61\x05\xcd\x7d\x05\x10\x00\xf4\x14\xfd\xcb\x02\xee\x21\xff\x5b\x22"
+"\x81\x5b\xcd\x45\x1f\x3e\x38\x32\x11\xec\x32\x0f\xec\xcd\x84\x25\xcd\x20\x1f\xc3\x9f\x25\x21\x66\x5b\xcb\xc6\x3b\x00\xf0\x0a\x21"
+"\x1d\x5b\xe5\xed\x73\x3d\x5c\x21\xba\x02\x22\x8b\x5b\xcd\x8e\x22\xcd\xcb\x22\xca\xf8\x21\xfe\x28\x05\x00\x10\x2d\x05\x00\x60\x2b"
+"\xca\xf8\x21\xcd\xe0\x15\x00\xf0\x50\xcd\x45\x1f\x3a\x0e\xec\xcd\x20\x1f\xfe\x04\xc2\xaf\x17\xcd\x97\x22\xca\xaf\x17\xe1\xc9\xfd"
+"\xcb\x00\x7e\x20\x01\xc9\x2a\x59\x5c\x22\x5d\x5c\xef\xfb\x19\x78\xb1\xc2\xf7\x03\xdf\xfe\x0d\xc8\xcd\xef\x21\xfd\xcb\x02\x76\x20"
+"\x03\xef\x6e\x0d\xfd\xcb\x02\xb6\xcd\x45\x1f\x21\x0d\xec\xcb\x76\x20\x07\x23\x7e\xfe\x00\xcc\x81\x38\xcd\x20\x1f\x21\x3c\x5c\xcb"
+"\x9e\x3e\x19\xfd\x96\x4f\x32\x8c\x56\x01\x95\xfe\xfd\x36\x0a\x01\x21\x00\x3e\xe5\x98\x00\xd2\x21\x03\x22\x8b\x5b\xc3\x38\x18\xed"
+"\x7b\xb2\x5c\x33\xd5\x00\x50\x76\xfd\xcb\x01\xae\xc6\x00\xf2\x24\x56\x28\x12\xcd\x45\x1f\xdd\x2a\x83\x5b\x01\x14\x00\xdd\x09\xcd"
+"\x56\x1d\xcd\x20\x1f\x3a\x3a\x5c\x3c\xf5\x21\x00\x00\xfd\x74\x37\xfd\x74\x26\x22\x0b\x5c\x21\x01\x00\x22\x16\x5c\xef\xb0\x16\xfd"
+"\xcb\x37\xae\x8c\x00\xf0\x41\xee\xf1\x47\xfe\x0a\x38\x0a\xfe\x1d\x38\x04\xc6\x14\x18\x02\xc6\x07\xef\xef\x15\x3e\x20\xd7\x78\xfe"
+"\x1d\x38\x12\xd6\x1d\x06\x00\x4f\x21\x6c\x04\x09\x09\x5e\x23\x56\xcd\x7d\x05\x18\x06\x11\x91\x13\xef\x0a\x0c\xaf\x11\x36\x15\xef"
+"\x0a\x0c\xed\x4b\x45\x5c\xef\x1b\x1a\x3e\x3a\xd7\xfd\x4e\x0d\x06\x00\xef\x1b\x1a\xef\x97\x10\x74\x00\xf0\x16\x28\x1b\xfe\x09\x28"
+"\x04\xfe\x15\x20\x03\xfd\x34\x0d\x01\x03\x00\x11\x70\x5c\x21\x44\x5c\xcb\x7e\x28\x01\x09\xed\xb8\xfd\x36\x0a\xff\xfd\xcb\x01\x9e"
+"\xb6\x00\xf0\x08\x86\xc3\xcb\x25\x3e\x10\x01\x00\x00\xc3\x4e\x03\xed\x43\x49\x5c\xcd\x45\x1f\x78\xb1\x28\x08\x0b\x00\x30\xed\x43"
+"\x08\x60\x01\xf3\x8d\x2a\x5d\x5c\xeb\x21\xef\x03\xe5\x2a\x61\x5c\x37\xed\x52\xe5\x60\x69\xef\x6e\x19\x20\x06\xef\xb8\x19\xef\xe8"
+"\x19\xc1\x79\x3d\xb0\x20\x13\xcd\x45\x1f\xe5\x2a\x49\x5c\xcd\x4a\x33\x22\x49\x5c\xe1\xcd\x20\x1f\x18\x28\xc5\x03\x03\x03\x03\x2b"
+"\xed\x5b\x53\x5c\xd5\xef\x55\x16\xe1\x22\x53\x5c\xc1\xc5\x13\x2a\x61\x5c\x2b\x2b\xed\xb8\x2a\x49\x5c\xeb\xc1\x70\x2b\x71\x2b\x73"
+"\x2b\x72\xf1\xc9\x8c\x04\x97\x04\xa6\x04\xb0\x04\xc1\x04\xd4\x04\xe0\x04\xe0\x04\xf3\x04\x01\x05\x12\x05\x23\x05\x31\x05\x42\x05"
+"\x4e\x05\x61\x05\x4d\x45\x52\x47\x45\x20\x65\x72\x72\x6f\xf2\x57\x72\x6f\x6e\x67\x20\x66\x69\x6c\x65\x20\x74\x79\x70\xe5\x43\x4f"
+"\x44\x19\x00\xf0\x03\x54\x6f\x6f\x20\x6d\x61\x6e\x79\x20\x62\x72\x61\x63\x6b\x65\x74\xf3\x46\x24\x00\xf1\x0b\x61\x6c\x72\x65\x61"
+"\x64\x79\x20\x65\x78\x69\x73\x74\xf3\x49\x6e\x76\x61\x6c\x69\x64\x20\x6e\x61\x6d\xe5\x1f\x00\x81\x64\x6f\x65\x73\x20\x6e\x6f\x74"
+"\x20\x00\x14\xf4\x1f\x00\x64\x64\x65\x76\x69\x63\xe5\x0e\x00\x85\x62\x61\x75\x64\x20\x72\x61\x74\x11\x00\x41\x6e\x6f\x74\x65\x43"
+"\x00\xf0\x00\x4e\x75\x6d\x62\x65\x72\x20\x74\x6f\x6f\x20\x62\x69\xe7\x4e\x17\x00\xd7\x6f\x75\x74\x20\x6f\x66\x20\x72\x61\x6e\x67"
+"\xe5\x4f\x0c\x00\x05\x9e\x00\x40\x74\x69\x65\x64\x72\x00\xf0\x38\x65\xf3\x7f\x20\x31\x39\x38\x36\x20\x53\x69\x6e\x63\x6c\x61\x69"
+"\x72\x20\x52\x65\x73\x65\x61\x72\x63\x68\x20\x4c\x74\xe4\x1a\xe6\x7f\xd5\xd7\xd1\x1a\x13\x87\x30\xf5\xc9\xf4\x09\xa8\x10\x4b\xf4"
+"\x09\xc4\x15\x53\x81\x0f\xc4\x15\x52\x34\x5b\x2f\x5b\x50\x80\x01\x00\x06\x00\x0b\x00\x01\x00\x08\x00\x31\x10\x00\xe1\x63\x05\x02"
+"\x3c\x05\xf0\x01\xed\x7b\x3d\x5c\x7e\x32\x5e\x5b\x3c\xfe\x1e\x30\x03\xef\x5d\x5b\x73\x05\xf0\x03\x2a\x5d\x5c\x22\x5f\x5c\xef\xc5"
+"\x16\xc9\x3e\x7f\xdb\xfe\x1f\xd8\x3e\xfe\x06\x00\xf0\x0f\xcd\xac\x05\x14\xfb\x08\x11\x4a\x5b\xd5\xfd\xcb\x02\x9e\xe5\x2a\x3d\x5c"
+"\x5e\x23\x56\xa7\x21\x7f\x10\xed\x52\x20\x38\xe1\x48\x00\xf1\x40\xd1\xd1\xed\x53\x3d\x5c\xe5\x11\x10\x06\xd5\xe9\x38\x09\x28\x04"
+"\xcd\xac\x05\x07\xe1\x18\xef\xfe\x0d\x28\x0e\x2a\x5a\x5b\xe5\xef\x85\x0f\xe1\x22\x5a\x5b\xe1\x18\xdd\xe1\x3a\x5c\x5b\xf6\x10\xf5"
+"\xc3\x4a\x5b\xe1\x11\x3d\x06\xd5\xe9\xd8\xc8\x18\xd3\xef\x18\x00\xef\x8c\x1c\xfd\xcb\x01\x7e\x28\x14\xef\xf1\x2b\x79\x3d\xb0\x41"
+"\x00\xf2\x08\x24\x1a\xe6\xdf\xfe\x50\xc2\x12\x19\x2a\x5d\x5c\x7e\xfe\x3b\xc2\x12\x19\xef\x20\x00\xef\x82\x29\x00\xf0\x0f\x07\xef"
+"\x99\x1e\xed\x43\x71\x5b\xef\x18\x00\xfe\x0d\x28\x05\xfe\x3a\xc2\x12\x19\xcd\xa1\x18\xed\x4b\x71\x5b\x78\xb1\x20\x80\x00\xf7\x53"
+"\x25\x21\xb8\x06\x5e\x23\x56\x23\xeb\x7c\xfe\x25\x30\x0a\xa7\xed\x42\x30\x05\xeb\x23\x23\x18\xec\xeb\x5e\x23\x56\xed\x53\x5f\x5b"
+"\xc9\x32\x00\xa5\x0a\x6e\x00\xd4\x04\x2c\x01\xc3\x01\x58\x02\xe0\x00\xb0\x04\x6e\x00\x60\x09\x36\x00\xc0\x12\x19\x00\x80\x25\x0b"
+"\x00\x21\x61\x5b\x7e\xa7\x28\x06\x36\x00\x23\x7e\x37\xc9\xcd\xd6\x05\xf3\xd9\xed\x5b\x5f\x5b\x2a\x5f\x5b\xcb\x3c\xcb\x1d\xb7\x06"
+"\xfa\xd9\x0c\x06\xf0\x0b\xed\x78\xf6\xf0\xe6\xfb\x43\xed\x79\x67\x42\xed\x78\xe6\x80\x28\x09\xd9\x05\xd9\x20\xf4\xaf\xf5\x18\x39"
+"\x0f\x00\x21\x20\xf1\x06\x00\x90\xeb\xd9\x01\xfd\xff\x3e\x80\x08\x19\x1e\x07\x50\x2b\x7c\xb5\x20\xfb\x17\x00\xf0\x02\xca\x4b\x07"
+"\x08\x37\x1f\x38\x0d\x08\xc3\x31\x07\x08\xb7\x1f\x38\x04\x09\x00\xf1\x03\x37\xf5\xd9\x7c\xf6\x04\x43\xed\x79\xd9\x62\x6b\x01\x07"
+"\x00\xb7\xed\x42\x30\x00\x60\x01\xfd\xff\x19\x19\x19\x36\x00\x20\x28\x08\x11\x00\x40\xf5\xf1\xfb\xc9\x0e\x00\x21\x20\xec\x06\x00"
+"\x61\xe6\x62\x6b\x01\x02\x00\x9f\x00\x22\xed\x42\x6c\x00\x00\x6b\x00\x10\x19\x2b\x00\x02\x6c\x00\x14\xb7\x6c\x00\x14\x9d\x6c\x00"
+"\xf1\x18\x9d\x07\x21\x61\x5b\x36\x01\x23\x77\xf1\xfb\xc9\xf5\x3a\x65\x5b\xb7\x28\x0f\x3d\x32\x65\x5b\x20\x04\xf1\xc3\x72\x08\xf1"
+"\x32\x0f\x5c\xc9\xf1\xfe\xa3\x38\x0d\xc6\x01\x20\x52\x0b\xc6\x01\xf0\x2e\x37\xc9\x21\x3b\x5c\xcb\x86\xfe\x20\x20\x02\xcb\xc6\xfe"
+"\x7f\x38\x02\x3e\x3f\xfe\x20\x38\x17\xf5\x21\x63\x5b\x34\x3a\x64\x5b\xbe\x30\x08\xcd\x22\x08\x3e\x01\x32\x63\x5b\xf1\xc3\xa3\x08"
+"\xfe\x0d\x20\x0e\xaf\x32\x63\x5b\x3e\x0d\xcd\xa3\x08\x3e\x0a\x12\x00\xf5\x29\x06\x20\x1f\xed\x4b\x63\x5b\x1e\x00\x1c\x0c\x79\xb8"
+"\x28\x08\xd6\x08\x28\x04\x30\xfa\x18\xf2\xd5\x3e\x20\xcd\xca\x07\xd1\x1d\xc8\x18\xf5\xfe\x16\x28\x09\xfe\x17\x28\x05\xfe\x10\xd8"
+"\x18\x09\x32\x0e\x5c\x3e\x02\x32\x65\x5b\xc9\x09\x00\xf3\x19\x57\x3a\x0e\x5c\xfe\x16\x28\x08\xfe\x17\x3f\xc0\x3a\x0f\x5c\x57\x3a"
+"\x64\x5b\xba\x28\x02\x30\x06\x47\x7a\x90\x57\x18\xf2\x7a\xb7\xca\x22\x08\x3a\x63\x5b\xba\xc8\x52\x00\x37\x18\xf2\xf5\xab\x01\xf1"
+"\x22\xcd\xd6\x05\xed\x78\xe6\x40\x20\xf7\x2a\x5f\x5b\x11\x02\x00\xb7\xed\x52\xeb\xf1\x2f\x37\x06\x0b\xf3\xc5\xf5\x3e\xfe\x62\x6b"
+"\x01\xfd\xbf\xd2\xda\x08\xe6\xf7\xed\x79\x18\x06\xf6\x08\xed\x79\x18\x00\x3e\x01\xf0\x0c\x00\x00\x00\xf1\xc1\xb7\x1f\x10\xda\xfb"
+"\xc9\x21\x72\x5b\x36\x2b\x21\x79\x09\xcd\x5f\x09\xcd\x15\x09\x21\x80\x09\x00\xc0\x21\x72\x5b\xaf\xbe\x28\x03\x35\x18\xe7\x21\x82"
+"\x10\x00\xf0\x06\xc9\x21\x71\x5b\x36\xff\xcd\x26\x09\x21\x71\x5b\xaf\xbe\xc8\x35\x18\xf4\x11\x00\xc0\x9d\x02\xf3\x7d\x37\xcb\x10"
+"\x37\xcb\x10\x79\x2f\x4f\xaf\xf5\xd5\xc5\xcd\x6d\x09\xc1\xd1\x1e\x00\x28\x01\x5a\xf1\xb3\xf5\x05\xcb\x3a\xcb\x3a\xd5\xc5\x30\xea"
+"\xc1\xd1\xf1\x06\x03\xc5\xf5\xcd\xa3\x08\xf1\xc1\x10\xf7\xc9\x46\x23\x7e\xe5\xc5\xcd\xa3\x08\xc1\xe1\x23\x10\xf5\xc9\xef\xaa\x22"
+"\x47\x04\xaf\x37\x1f\x10\xfd\xa6\xc9\x06\x1b\x31\x1b\x4c\x00\x03\x01\x0a\x02\x1b\x32\xf3\xc5\x11\x37\x00\x21\x3c\x00\x19\x10\xfd"
+"\x4d\x44\xef\x30\x00\xf3\xd5\xfd\xe1\xe5\xdd\xe1\xfd\x36\x10\xff\x01\xc9\xff\xdd\x09\xdd\x36\x03\x3c\xdd\x36\x01\xff\xdd\x36\x04"
+"\x0f\xdd\x36\x05\x05\xdd\x36\x21\x00\x58\x08\xf8\x6e\x00\xdd\x36\x16\xff\xdd\x36\x17\x00\xdd\x36\x18\x00\xef\xf1\x2b\xf3\xdd\x73"
+"\x06\xdd\x72\x07\xdd\x73\x0c\xdd\x72\x0d\xeb\x09\xdd\x75\x08\xdd\x74\x09\xc1\xc5\x05\x48\x06\x00\xcb\x21\xfd\xe5\xe1\x09\xdd\xe5"
+"\xc1\x71\x23\x70\xb7\xfd\xcb\x10\x16\xc1\x05\xc5\xdd\x70\x02\x20\x9c\xc1\xfd\x36\x27\x1a\xfd\x36\x28\x0b\xfd\xe5\xe1\x01\x2b\x00"
+"\x09\xeb\x21\x31\x0a\x01\x0d\x00\xed\xb0\x16\x07\x1e\xf8\xcd\x7c\x0e\x16\x0b\x1e\xff\xcd\x7c\x0e\x14\xcd\x7c\x0e\x18\x4c\xef\xa4"
+"\x01\x05\x34\xdf\x75\xf4\x38\x75\x05\x38\x68\x04\x90\xc9\x01\x11\x00\x18\x03\x01\x00\x00\x65\x00\xf2\x11\xfd\x75\x23\xfd\x74\x24"
+"\xfd\x7e\x10\xfd\x77\x22\xfd\x36\x21\x01\xc9\x5e\x23\x56\xd5\xdd\xe1\xc9\xfd\x6e\x23\xfd\x66\x24\x23\x23\x20\x00\xf0\x86\xc9\xcd"
+"\x4f\x0a\xfd\xcb\x22\x1e\x38\x06\xcd\x67\x0a\xcd\x5c\x0b\xfd\xcb\x21\x26\x38\x05\xcd\x6e\x0a\x18\xe9\xcd\x91\x0f\xd5\xcd\x42\x0f"
+"\xd1\xfd\x7e\x10\xfe\xff\x20\x05\xcd\x93\x0e\xfb\xc9\x1b\xcd\x76\x0f\xcd\xc1\x0f\xcd\x91\x0f\x18\xe8\x48\x5a\x59\x58\x57\x55\x56"
+"\x4d\x54\x29\x28\x4e\x4f\x21\xcd\xe3\x0e\xd8\xdd\x34\x06\xc0\xdd\x34\x07\xc9\xe5\x0e\x00\xcd\xc5\x0a\x38\x08\xfe\x26\x20\x0f\x3e"
+"\x80\xe1\xc9\xfd\x7e\x21\xfd\xb6\x10\xfd\x77\x10\x18\xf3\xfe\x23\x20\x03\x0c\x18\xe1\xfe\x24\x20\x03\x0d\x18\xda\xcb\x6f\x20\x06"
+"\xf5\x3e\x0c\x81\x4f\xf1\xe6\xdf\xd6\x41\xda\x22\x0f\xfe\x07\xd2\x22\x0f\xc5\x85\x07\xf0\x3d\xf9\x0d\x09\x7e\xc1\x81\xe1\xc9\xe5"
+"\xd5\xdd\x6e\x06\xdd\x66\x07\x11\x00\x00\x7e\xfe\x30\x38\x18\xfe\x3a\x30\x14\x23\xe5\xcd\x50\x0b\xd6\x30\x26\x00\x6f\x19\x38\x04"
+"\xeb\xe1\x18\xe6\xc3\x1a\x0f\xdd\x75\x06\xdd\x74\x07\xd5\xc1\xd1\xe1\xc9\x21\x00\x00\x06\x0a\x19\x38\xea\x10\xfb\xeb\xc9\xcd\x3e"
+"\x0a\x38\x08\xbb\x00\x00\x83\x05\x90\xcd\xc5\x0a\xda\xa2\x0d\xcd\xf0\x0d\x89\x01\x30\x21\xca\x0d\xe6\x07\x80\xeb\xcd\x84\x0b\x18"
+"\xd9\xc9\xe9\x1c\x00\xf2\x34\xa1\x0d\xfe\x21\xc8\x18\xf5\xcd\x1d\x0b\x79\xfe\x09\xd2\x12\x0f\xcb\x27\xcb\x27\x47\xcb\x27\x80\xdd"
+"\x77\x03\xc9\xc9\xdd\x7e\x0b\x3c\xfe\x05\xca\x2a\x0f\xdd\x77\x0b\x11\x0c\x00\xcd\x27\x0c\xdd\x7e\x06\x77\x23\xdd\x7e\x07\x77\xc9"
+"\xdd\x7e\x16\x11\x17\x00\xb7\xfa\xf0\x0b\x17\x00\x30\xbe\x20\x1b\x19\x00\xf4\x0b\xbe\x20\x14\xdd\x35\x16\xdd\x7e\x16\xb7\xf0\xdd"
+"\xcb\x0a\x46\xc8\xdd\x36\x16\x00\xaf\x18\x1b\xdd\x7e\x16\x4a\x00\x12\x16\x30\x00\x02\x47\x00\x23\xdd\x7e\x59\x00\xf3\x3c\x7e\xdd"
+"\x77\x06\x23\x7e\xdd\x77\x07\xdd\x35\x0b\xf0\xdd\x36\x0b\x00\xdd\xcb\x0a\xc6\xc9\xdd\xe5\xe1\x19\x06\x00\x4f\xcb\x21\x09\xc9\xcd"
+"\x1d\x0b\x78\xb7\xc2\x12\x0f\x79\xfe\x3c\xda\x12\x0f\xfe\xf1\xd2\x12\x0f\xdd\x7e\x02\xb7\xc0\x06\x00\xc5\xe1\x29\x29\xe5\xc1\xfd"
+"\xe5\xef\x2b\x2d\xf3\xfd\xe1\xfd\xe5\x4f\x02\x00\xb9\x0a\x62\xe5\x21\x76\x0c\x22\x5a\x0f\x0c\x61\xc3\x00\x5b\xf3\xef\xa2\x23\x00"
+"\x50\x71\x27\xfd\x70\x28\x52\x00\xd2\x79\xfe\x40\xd2\x12\x0f\x2f\x5f\x16\x07\xcd\x7c\x0e\x11\x00\x10\x10\x59\x00\xa0\x77\x04\xdd"
+"\x5e\x02\x3e\x08\x83\x57\x59\x18\x00\x03\x0c\x00\x52\x1e\x1f\xdd\x73\x04\x25\x00\xe0\x08\xd2\x12\x0f\x06\x00\x21\xe8\x0d\x09\x7e"
+"\xfd\x77\x29\x14\x00\x20\x16\x0b\x2b\x00\x20\x14\x58\x30\x00\x00\x4d\x01\x52\x3d\xfa\x12\x0f\xfe\x4c\x00\x10\x01\x20\x00\x50\x79"
+"\xcd\xa3\x11\xc9\x5a\x03\xf0\x05\xc9\xcd\x19\x0e\xda\x81\x0d\xcd\xac\x0d\xcd\xb4\x0d\xaf\xdd\x77\x21\xcd\xc8\x0e\x31\x00\xf2\x14"
+"\xb7\xca\x12\x0f\xfe\x0d\xd2\x12\x0f\xfe\x0a\x38\x13\xcd\x00\x0e\xcd\x74\x0d\x73\x23\x72\xcd\x74\x0d\x23\x73\x23\x72\x23\x18\x06"
+"\xdd\x71\x05\x16\x00\xa0\xcd\xe3\x0e\xfe\x5f\x20\x2c\xcd\xc5\x0a\x37\x00\xf3\x0a\xfe\x0a\x38\x12\xe5\xd5\xcd\x00\x0e\xe1\x19\x4b"
+"\x42\xeb\xe1\x73\x23\x72\x59\x50\x18\xc9\xdd\x71\x05\x15\x00\x40\xeb\xe1\xc3\x3b\x49\x00\xf2\x08\xc3\x9c\x0d\xdd\x7e\x21\x3c\xfe"
+"\x0b\xca\x3a\x0f\xdd\x77\x21\xc9\xcd\xc8\x0e\xdd\x36\x21\x01\x87\x00\x40\xdd\x4e\x05\xe5\x43\x00\xc5\x73\x23\x72\xc3\x9c\x0d\xe1"
+"\x23\x23\xe5\xc9\xe1\xc1\x02\x00\x85\x01\x51\x01\x22\x00\x09\xc9\x59\x01\xf0\x63\x11\x00\x09\x06\x00\xdd\x4e\x02\xcb\x21\x09\xd1"
+"\x73\x23\x72\xeb\xc9\xfb\x0c\x85\x0b\x90\x0b\xa5\x0b\xa6\x0b\xc2\x0b\x32\x0c\x84\x0c\x95\x0c\xad\x0c\xba\x0c\xce\x0c\xdd\x0c\xee"
+"\x0c\xf6\x0c\x00\x04\x0b\x0d\x08\x0c\x0e\x0a\x01\x0f\x00\x21\xb7\x0a\xed\xb1\xc9\x09\x0b\x00\x02\x04\x05\x07\xe5\x06\x00\x21\x0c"
+"\x0e\x09\x16\x00\x5e\xe1\xc9\x80\x06\x09\x0c\x12\x18\x24\x30\x48\x60\x04\x08\x10\xfe\x30\xd8\xfe\x3a\x3f\xc9\x4f\xdd\x7e\x03\x81"
+"\xfe\x80\xd2\x32\x0f\x4f\xe6\x01\xf0\x19\x20\x0e\x79\x2f\xe6\x7f\xcb\x3f\xcb\x3f\x16\x06\x5f\xcd\x7c\x0e\xdd\x71\x00\xdd\x7e\x02"
+"\xfe\x03\xd0\x21\x96\x10\x06\x00\x79\xd6\x15\x30\x05\x11\xbf\x0f\x18\x07\x2a\x02\xa0\x5e\x23\x56\xeb\xdd\x56\x02\xcb\x22\x5d\x3d"
+"\x04\x10\x5c\x2e\x00\x90\xcb\x04\x66\xc8\x16\x0d\xfd\x7e\x29\x3c\x00\xd2\xc9\xc5\x01\xfd\xff\xed\x51\x01\xfd\xbf\xed\x59\xc1\x0d"
+"\x00\x71\x79\xed\x78\xc1\xc9\x16\x07\x6f\x04\x40\x16\x08\x1e\x00\x39\x00\x03\x04\x00\x09\x2c\x04\x27\x8d\x11\x2c\x04\x00\x60\x02"
+"\x05\xab\x03\xa2\x2b\x7e\xfe\x20\x28\xfa\xfe\x0d\x28\xf6\x95\x03\x10\xd1\xc6\x03\x12\xc5\xc7\x03\xf0\x00\x7c\xdd\xbe\x09\x20\x09"
+"\x7d\xdd\xbe\x08\x20\x03\x37\x18\x0a\x2a\x00\x10\x09\x80\x08\x10\xb7\xb9\x03\x12\x23\x30\x00\x23\x18\xda\xb1\x03\x13\x29\x08\x00"
+"\x13\x27\x08\x00\x13\x26\x08\x00\x13\x1f\x08\x00\x13\x28\x08\x00\x14\x2a\x99\x00\x10\x21\xc5\x04\x91\xd1\x0a\xfe\x80\x28\x17\xcd"
+"\x20\x0e\x16\x01\xe1\x30\x0a\x16\x08\x82\x57\xdd\x5e\x04\xcd\x7c\x0e\xcd\x6e\xb4\x00\x10\xd8\xdf\x04\xa0\xcf\xe5\xfd\x6e\x27\xfd"
+"\x66\x28\x01\x64\x1d\x08\x31\xe5\xc1\xe1\x82\x0f\xb2\x1b\x7a\xb3\x20\xe6\xc9\x11\xff\xff\xcd\x4a\x17\x05\x20\x12\xd5\x43\x01\x00"
+"\x3b\x05\x96\xe1\xc1\xb7\xed\x42\x38\x02\xc5\xd1\xf7\x00\xb4\xdd\xfd\x73\x25\xfd\x72\x26\xc9\xaf\xfd\x77\x83\x00\x60\xda\x5a\x10"
+"\xcd\x67\x0a\x76\x03\x07\x1d\x02\x00\x43\x00\x10\xe5\x05\x00\x60\xfd\x5e\x25\xfd\x56\x26\x32\x07\x82\xe1\x28\x05\x73\x23\x72\x18"
+"\x5e\xa4\x00\x10\x09\xa4\x00\x01\x6b\x01\xd0\xcd\x8d\x11\xdd\xe5\xe1\x01\x21\x00\x09\x35\x20\x0d\x90\x05\x9e\x7e\x21\xfd\xa6\x10"
+"\x20\x36\x18\x17\x54\x00\x90\x13\x13\x72\x2b\x73\xcd\xd1\x0a\x4f\x9f\x02\xc0\xa6\x10\x20\x11\x79\xfe\x80\x28\x0c\xcd\x20\x0e\x10"
+"\x00\x51\xb6\x2a\xfd\x77\x2a\xab\x00\xa0\x06\xcd\x6e\x0a\xc3\xc8\x0f\x11\x01\x00\xbd\x05\x00\xef\x05\x72\x2a\x1e\x30\x17\xcd\x67"
+"\x0a\x7c\x00\x0f\x20\x01\x04\xf1\xd7\xd9\xbf\x0f\xdc\x0e\x07\x0e\x3d\x0d\x7f\x0c\xcc\x0b\x22\x0b\x82\x0a\xeb\x09\x5d\x09\xd6\x08"
+"\x57\x08\xdf\x07\x6e\x07\x03\x07\x9f\x06\x40\x06\xe6\x05\x91\x05\x41\x05\xf6\x04\xae\x04\x6b\x04\x2c\x04\xf0\x03\xb7\x03\x82\x03"
+"\x4f\x03\x20\x03\xf3\x02\xc8\x02\xa1\x02\x7b\x02\x57\x02\x36\x02\x16\x02\xf8\x01\xdc\x01\xc1\x01\xa8\x01\x90\x01\x79\x01\x64\x01"
+"\x50\x01\x3d\x01\x2c\x01\x1b\x01\x0b\x01\xfc\x00\xee\x00\xe0\x00\xd4\x00\xc8\x00\xbd\x00\xb2\x00\xa8\x00\x9f\x00\x96\x00\x8d\x00"
+"\x85\x00\x7e\x00\x77\x00\x70\x00\x6a\x00\x64\x00\x5e\x00\x59\x00\x54\x00\x4f\x00\x4b\x00\x47\x00\x43\x00\x3f\x00\x3b\x00\x38\x00"
+"\x35\x00\x32\x00\x2f\x00\x2d\x00\x2a\x00\x28\x00\x25\x00\x23\x00\x21\x00\x1f\x00\x1e\x00\x1c\x00\x1a\x00\x19\x00\x18\x00\x16\x00"
+"\x15\x00\x14\x00\x13\x00\x12\x00\x11\x00\x10\x00\x0f\x00\x0e\x00\x0d\x00\x0c\x00\x0c\x00\x0b\x00\x0b\x00\x0a\x00\x09\x00\x09\x00"
+"\x08\x00\xdd\x7e\x01\xb7\xf8\xf6\x90\xcd\xa3\x11\xdd\x7e\x00\x06\x00\x30\x04\xcb\xa7\xea\x05\x20\xcb\x27\x97\x04\x02\x1f\x00\x11"
+"\x80\x19\x00\x00\x1f\x00\x20\x3e\x40\x16\x00\x10\x6f\x0d\x0a\xf0\x00\x0e\xed\x79\x01\xfd\xbf\x3e\xfa\xed\x79\x1e\x03\x1d\x20\xfd"
+"\x1a\x0a\xa0\x7d\x16\x08\x1f\x6f\xd2\xc9\x11\x3e\xfe\xef\x08\x00\x1b\x00\x40\x18\x00\x1e\x02\x1d\x00\xc0\xc6\x00\x7d\x15\x20\xe3"
+"\x00\x00\xc6\x00\x00\x00\x1e\x00\x60\x1e\x06\x1d\x20\xfd\xc9\x04\x0e\x30\xee\x18\x13\x07\x00\x30\xe6\x18\x0c\x07\x00\x30\xfe\x18"
+"\x05\x07\x00\x10\xf6\x05\x00\x61\x9e\xdf\xfe\x21\xc2\xbe\x1e\x00\xf0\x37\xde\xe7\xc3\xbe\x13\xcd\xac\x05\x0b\x22\x74\x5b\xdd\x7e"
+"\x00\x32\x71\x5b\xdd\x6e\x0b\xdd\x66\x0c\x22\x72\x5b\xdd\x6e\x0d\xdd\x66\x0e\x22\x78\x5b\xdd\x6e\x0f\xdd\x66\x10\x22\x76\x5b\xb7"
+"\x28\x0a\xfe\x03\x28\x06\xdd\x7e\x0e\x32\x76\x5b\xdd\xe5\xe1\x23\x11\x67\x5b\x01\x0a\x00\xed\xb0\x55\x00\xf0\x12\x6e\xc2\xad\x1b"
+"\x21\x71\x5b\x11\x7a\x5b\x01\x07\x00\xed\xb0\xcd\x2e\x1c\x3a\x7a\x5b\x47\x3a\x71\x5b\xb8\x20\x06\xfe\x03\x28\x12\x38\xec\x0b\xd1"
+"\x1d\x3a\x66\x5b\xcb\x77\x20\x3a\xcb\x7f\xca\xdb\x12\x0c\x00\x01\x42\x0c\xf0\x00\x1c\x2a\x7b\x5b\xed\x5b\x72\x5b\x7c\xb5\x28\x08"
+"\xed\x52\x30\x2a\x00\xf0\x1f\x1e\x2a\x7d\x5b\x7c\xb5\x20\x03\x2a\x74\x5b\x3a\x71\x5b\xa7\x20\x03\x2a\x53\x5c\xcd\x7e\x13\xc9\xed"
+"\x4b\x72\x5b\xc5\x03\xef\x30\x00\x36\x80\xeb\xd1\xe5\xcd\x7e\x13\xe1\xef\xce\x08\xc9\x3d\x00\xf0\x12\x2a\x7d\x5b\xe5\x7c\xb5\x20"
+"\x06\x13\x13\x13\xeb\x18\x09\x2a\x7b\x5b\xeb\x37\xed\x52\x38\x09\x11\x05\x00\x19\x44\x4d\xef\x05\x1f\xe1\x48\x00\xf2\x06\x28\x2f"
+"\x7c\xb5\x28\x0b\x2b\x46\x2b\x4e\x2b\x03\x03\x03\xef\xe8\x19\x2a\x59\x5c\x2b\x54\x00\xd1\x03\x03\x3a\x7f\x5b\xf5\xef\x55\x16\x23"
+"\xf1\x77\xd1\x01\x06\x00\x70\x00\x00\xdb\x00\x10\x8e\xf2\x0e\x00\x29\x00\x30\xef\xe5\x19\x2c\x00\x30\x2a\x53\x5c\x27\x00\xf0\x0c"
+"\xed\x4b\x76\x5b\x09\x22\x4b\x5c\x3a\x79\x5b\x67\xe6\xc0\x20\x10\x3a\x78\x5b\x6f\x22\x42\x5c\xfd\x36\x0a\x00\x36\x00\x40\xce\x2a"
+"\x53\x5c\x98\x00\x01\x90\x11\x93\x18\xb3\x7a\xb3\xc8\xcd\x4b\x1c\xc9\x41\x0d\xf3\x23\xc8\xf5\xef\xf1\x2b\xf1\xc9\xe7\xcd\x85\x13"
+"\xc8\xf5\x79\xb0\x28\x1d\x21\x0a\x00\xed\x42\x38\x16\xd5\xc5\x21\x67\x5b\x06\x0a\x3e\x20\x77\x23\x10\xfc\xc1\xe1\x11\x67\x5b\xed"
+"\xb0\xf1\xc9\xcd\xac\x05\x21\x39\x00\xf0\x0c\x28\x40\x01\x11\x00\x3a\x74\x5c\xa7\x28\x02\x0e\x22\xef\x30\x00\xd5\xdd\xe1\x06\x0b"
+"\x3e\x20\x12\x13\x10\xfc\x37\x0a\xb0\xef\xf1\x2b\x21\xf6\xff\x0b\x09\x03\x30\x11\x25\x00\x01\x61\x0d\x80\x0e\x78\xb1\x28\x0a\x01"
+"\x0a\x00\xb2\x01\xf0\x07\xeb\xed\xb0\xdf\xfe\xe4\x20\x53\x3a\x74\x5c\xfe\x03\xca\x19\x12\xe7\xef\xb2\x28\x30\x15\xcb\x10\xf1\x05"
+"\xcb\x01\x76\x28\x02\xcb\xf9\x3a\x74\x5c\x3d\x28\x19\xcd\xac\x05\x01\xc2\x19\x12\xeb\x0d\x20\x19\x4e\x24\x08\x10\x0b\x05\x00\xf5"
+"\x12\x0c\x23\xdd\x71\x0e\x3e\x01\xcb\x71\x28\x01\x3c\xdd\x77\x00\xeb\xe7\xfe\x29\x20\xd8\xe7\xcd\xa1\x18\xeb\xc3\x19\x15\xfe\xaa"
+"\x20\x1f\x57\x00\x31\xcd\xa1\x18\x51\x08\xf5\x03\x36\x0c\x1b\x21\x00\x40\xdd\x75\x0d\xdd\x74\x0e\x18\x4d\xfe\xaf\x20\x4f\x23\x00"
+"\x50\xef\x48\x20\x20\x0c\xa5\x00\xf8\x00\xca\x19\x12\xef\xe6\x1c\x18\x0f\xef\x82\x1c\xdf\xfe\x2c\x28\x14\x00\xf1\x02\x04\xe7\xef"
+"\x82\x1c\xcd\xa1\x18\xef\x99\x1e\xdd\x71\x0b\xdd\x70\x0c\x09\x00\xf1\x01\x0d\xdd\x70\x0e\x60\x69\xdd\x36\x00\x03\x18\x44\xfe\xca"
+"\x28\x09\x6d\x00\x40\x0e\x80\x18\x17\x4e\x00\x10\xc2\xd5\x00\x06\x35\x00\x00\x2c\x00\x70\xdd\x36\x00\x00\x2a\x59\x5c\xc6\x01\xc0"
+"\x37\xed\x52\xdd\x75\x0b\xdd\x74\x0c\x2a\x4b\x5c\x0b\x00\x50\x0f\xdd\x74\x10\xeb\x89\x02\x40\x5f\xc2\x1d\x12\x3f\x00\xf0\x05\x20"
+"\x04\xef\x70\x09\xc9\xef\x61\x07\xc9\x21\xf5\xee\xcb\x86\xcb\xce\x2a\x49\x5c\x88\x02\xa0\x22\x06\xec\x3a\xdb\xf9\xf5\x2a\x9a\xfc"
+"\x11\x11\xf0\x35\xd7\xf9\xcd\x22\x32\xcd\xd6\x30\xf1\xb7\x28\x0c\xf5\xcd\xdf\x30\xeb\xcd\x6a\x32\xf1\x3d\x18\xf1\x0e\x00\xcd\xb4"
+"\x30\x41\x3a\x15\xec\x4f\xc5\xd5\xcd\xdf\x30\x3a\xf5\xee\xcb\x4f\x28\x1d\xd5\xe5\x11\x20\x00\x19\xcb\x46\x28\x11\x23\x56\x23\x5e"
+"\xb7\x2a\x49\x5c\xed\x52\x20\x05\x60\x00\xf0\x00\xc6\xe1\xd1\xc5\xe5\x01\x23\x00\xed\xb0\xe1\xc1\xd5\xc5\xeb\x13\x00\xf2\x25\x46"
+"\x28\x2a\x06\x00\x2a\x06\xec\x7c\xb5\x28\x0e\xe5\xcd\x41\x2e\xe1\x30\x12\x2b\x04\x22\x06\xec\x18\xeb\xcd\x41\x2e\xd4\x63\x2e\x21"
+"\xf5\xee\x36\x00\x78\xc1\xc5\x48\x47\xcd\x11\x2a\xc1\xd1\x79\x04\xb8\x30\x95\x68\x00\x51\x21\xcb\x47\x20\x1d\xaf\x00\xa0\x28\x08"
+"\x22\x9a\xfc\xcd\x22\x32\x18\x09\x08\x00\x10\x52\xc1\x11\xf0\x30\xd1\xc1\xc3\x36\x15\xd1\xc1\xbf\xf5\x79\x48\xcd\xb4\x30\xeb\xf5"
+"\xcd\x04\x36\xf1\x11\x23\x00\x19\x0c\xb9\x30\xf3\xf1\xc8\xcd\x07\x2a\xcd\x78\x2b\x2a\x06\xec\x2b\x7c\xb5\x22\x06\xec\x20\xf2\xc3"
+"\x11\x2a\xc9\x06\x00\x3a\x15\xec\x57\xc3\x5e\x3b\x06\x00\xe5\x35\x00\xe0\xcd\x6a\x32\xe1\xd0\xcd\xdf\x30\xc5\xe5\x21\x23\x00\x19"
+"\xe5\x00\x51\xb8\x28\x0e\xc5\xc5\xbf\x00\xb1\xc1\x79\x04\xb8\x20\xf4\xc1\xe1\xcd\x18\x36\x10\x00\xb0\x37\xc1\xc9\x06\x00\xcd\x2b"
+"\x32\xd0\xc5\xe5\x29\x00\x90\xcd\xb4\x30\xcd\x1e\x31\x30\x26\x1b\x3a\x00\x61\xeb\xc5\x78\xb9\x28\x0c\x38\x00\xd5\xb8\xc1\x78\x0d"
+"\xb9\x38\xf4\xeb\x13\xc1\xe1\xcd\x2c\x3a\x00\xf2\x30\xe1\xc1\xc9\xd5\x26\x00\x68\x19\x57\x78\x5e\x72\x53\x23\x3c\xfe\x20\x38\xf7"
+"\x7b\xfe\x00\xd1\xc9\xd5\x21\x20\x00\x19\xe5\x57\x3e\x1f\x18\x07\x5e\x72\x53\xb8\x28\x04\x3d\x2b\x18\xf6\x7b\xfe\x00\xe1\xd1\xc9"
+"\xb1\xc9\xbc\xbe\xc3\xaf\xb4\x93\x91\x92\x95\x98\x01\x00\xf1\x83\x7f\x81\x2e\x6c\x6e\x70\x48\x94\x56\x3f\x41\x2b\x17\x1f\x37\x77"
+"\x44\x0f\x59\x2b\x43\x2d\x51\x3a\x6d\x42\x0d\x49\x5c\x44\x15\x5d\x01\x3d\x02\x06\x00\x67\x1e\x06\xcb\x0e\x67\x19\x06\x0c\x53\x1a"
+"\x00\xee\x1c\x0c\x6f\x1a\x04\x3d\x06\xcc\x06\x0e\x81\x19\x04\x00\xab\x1d\x0e\x78\x21\x0e\x8c\x21\x0e\xd5\x21\x0e\x62\x18\x0c\xaa"
+"\x21\x0d\x02\x1a\x0e\x75\x1b\x08\x00\x80\x1e\x03\x4f\x1e\x00\x5f\x1e\x0d\x0d\x1a\x00\x6b\x0d\x09\x00\xdc\x22\x06\x00\x3a\x1f\x0e"
+"\xab\x19\x0e\xeb\x19\x03\x42\x1e\x09\x0e\xbe\x21\x0c\xa7\x21\x0e\x74\x21\x0e\x71\x1b\x0b\x0b\x0b\x0b\x08\x00\xf8\x03\x09\x0e\xae"
+"\x21\x07\x01\x00\xf0\x8c\x08\x00\x7a\x1e\x06\x00\x94\x22\x0e\x8c\x1a\x06\x2c\x0a\x00\x36\x17\x06\x00\xe5\x16\x0e\x41\x06\x0a\x2c"
+"\x0a\x0c\xf0\x1a\x0e\x0c\x1c\x0e\xe5\x1b\x0c\x2b\x1b\x0e\x17\x23\xfd\xcb\x01\xbe\xef\xfb\x19\xaf\x32\x47\x5c\x3d\x32\x3a\x5c\x18"
+"\x01\xe7\xef\xbf\x16\xfd\x34\x0d\xfa\x12\x19\xdf\x06\x00\xfe\x0d\xca\x63\x18\xfe\x3a\x28\xea\x21\x21\x18\xe5\x4f\xe7\x79\xd6\xce"
+"\x30\x13\xc6\xce\x21\xa9\x17\xfe\xa3\x28\x16\x21\xac\x17\xfe\xa4\x28\x0f\xc3\x12\x19\x4f\x21\xdc\x16\x09\x4e\x09\x18\x03\x2a\x74"
+"\x5c\x7e\x23\x22\x74\x5c\x01\xfd\x17\xc5\x4f\xfe\x20\x30\x0c\x21\xb5\x18\x06\x00\x09\x4e\x09\xe5\xdf\x05\xc9\xdf\xb9\xc2\x12\x19"
+"\xe7\x3c\x11\x01\xa6\x05\xf0\x06\x14\xfd\xcb\x0a\x7e\xc2\xa8\x18\x2a\x42\x5c\xcb\x7c\x28\x14\x21\xfe\xff\x22\x45\x5c\xe7\x13\xf0"
+"\x12\xed\x5b\x59\x5c\x1b\x3a\x44\x5c\x18\x36\xef\x6e\x19\x3a\x44\x5c\x28\x1c\xa7\x20\x46\x47\x7e\xe6\xc0\x78\x28\x12\xcd\xac\x05"
+"\xff\xc1\x31\x04\xf0\x06\xc8\x2a\x55\x5c\x3e\xc0\xa6\xc0\xaf\xfe\x01\xce\x00\x56\x23\x5e\xed\x53\x45\x5c\x23\x96\x08\xc0\x19\x23"
+"\x22\x55\x5c\xeb\x22\x5d\x5c\x57\x1e\x00\xad\x14\xf0\x02\x15\xfd\x72\x0d\xca\xc0\x17\x14\xef\x8b\x19\x28\x0b\xcd\xac\x05\x16\x3e"
+"\x00\xfc\x22\xc0\xc1\xc1\xdf\xfe\x0d\x28\xb6\xfe\x3a\xca\xc0\x17\xc3\x12\x19\x24\x43\x46\x1e\x4c\x20\x53\x5e\x4d\x86\x57\x88\x06"
+"\x02\x05\xef\xde\x1c\xbf\xc1\xcc\xa1\x18\xeb\x2a\x74\x5c\x4e\x23\x46\xeb\xc5\xc9\x12\x00\x44\xe5\x21\xf8\x18\x7f\x0c\x20\x60\x69"
+"\x8d\x18\x80\xc9\xef\x1f\x1c\xc9\xc1\xef\x56\x49\x04\xd0\xc9\xef\x6c\x1c\xc9\xe7\xef\x7a\x1c\xc9\xef\x82\x1c\x58\x05\x50\x0b\xef"
+"\x8c\x1c\xc9\x79\x00\xf0\x24\xfd\xcb\x02\x86\x28\x03\xef\x4d\x0d\xf1\x3a\x74\x5c\xd6\xa7\xef\xfc\x21\xcd\xa1\x18\x2a\x8f\x5c\x22"
+"\x8d\x5c\x21\x91\x5c\x7e\x07\xae\xe6\xaa\xae\x77\xc9\xef\xbe\x1c\xc9\xf1\x3a\x66\x5b\xe6\x0f\x32\x66\x5b\x29\x00\xf1\x03\x74\x32"
+"\x74\x5c\xca\xeb\x11\x3d\xca\xf2\x11\x3d\xca\xf9\x11\xc3\x00\x12\x05\x01\xf0\x0d\x28\x10\x2a\x65\x5c\x11\xfb\xff\x19\x22\x65\x5c"
+"\xef\xe9\x34\xda\x63\x18\xc3\xc1\x17\xfe\xcd\x20\x09\xe7\xcd\x0e\x00\x13\x20\x18\x18\x5e\x00\x50\x65\x5c\x36\x00\x23\x03\x00\x11"
+"\x01\x06\x00\x20\x00\x23\x2e\x00\x70\x16\x1d\xc9\xe7\xcd\xf9\x18\x94\x00\xf1\x04\x28\x2e\xdf\x22\x5f\x5c\x2a\x57\x5c\x7e\xfe\x2c"
+"\x28\x0b\x1e\xe4\xef\x86\x1d\x1d\x07\xf0\x05\x0d\x23\x22\x5d\x5c\x7e\xef\x56\x1c\xdf\x22\x57\x5c\x2a\x5f\x5c\xfd\x36\x26\x00\x12"
+"\x00\x00\x3f\x05\x41\xc3\xcd\xa1\x18\xd1\x00\xf0\x12\x20\x0b\xef\xfb\x24\xfe\x2c\xc4\xa1\x18\xe7\x18\xf5\x3e\xe4\xef\x39\x1e\xc9"
+"\xef\x67\x1e\x01\x00\x00\xef\x45\x1e\x18\x03\xef\x99\x1e\x80\x13\x93\xed\x4b\xb2\x5c\xc5\xed\x5b\x4b\x5c\xdf\x06\x30\xef\x6b\x0d"
+"\xb9\x00\xc3\x32\x00\x19\xd1\xed\x52\x30\x08\x2a\xb4\x5c\xa7\x91\x07\x81\x15\xed\x53\xb2\x5c\xd1\xe1\xc1\x25\x17\x11\xc5\xd1\x17"
+"\x90\xd5\xc9\xd1\xfd\x66\x0d\x24\xe3\x33\xb1\x16\x03\x13\x00\x00\x63\x00\xf0\x02\x14\x00\xef\x05\x1f\xc9\xc1\xe1\xd1\x7a\xfe\x3e"
+"\x28\x0f\x3b\xe3\xeb\xfe\x17\x10\xc5\x1b\x07\x91\x72\x0a\xc9\xd5\xe5\xcd\xac\x05\x06\xde\x00\xf0\x1a\x05\x3e\xce\xc3\xfe\x19\xfd"
+"\xcb\x01\xf6\xef\x8d\x2c\x30\x16\xe7\xfe\x24\x20\x05\xfd\xcb\x01\xb6\xe7\xfe\x28\x20\x3c\xe7\xfe\x29\x28\x20\xef\x8d\x2c\xd2\x12"
+"\x19\xeb\x1a\x00\x70\x02\xeb\xe7\xeb\x01\x06\x00\x79\x07\xf2\x12\x23\x36\x0e\xfe\x2c\x20\x03\xe7\x18\xe0\xfe\x29\x20\x13\xe7\xfe"
+"\x3d\x20\x0e\xe7\x3a\x3b\x5c\xf5\xef\xfb\x24\xf1\xfd\xae\x01\xe6\x40\x64\x14\xf0\x02\xc9\x21\x0e\xec\x36\xff\xcd\x20\x1f\xef\xb0"
+"\x16\x2a\x59\x5c\x01\x03\x3d\x00\x30\x21\x6e\x1b\xc6\x02\x20\x01\x03\xa4\x08\x26\x6b\x02\x1e\x00\x10\x01\x1e\x00\xb0\x2a\x59\x5c"
+"\x36\xe1\xcd\x6b\x02\xcd\x53\x1b\x2e\x15\xf6\x08\xe1\x21\x03\x13\xe5\x21\x13\x00\xe5\x21\x08\x00\xe5\x3e\x20\x32\x5c\x5b\xc3\x00"
+"\x5b\x21\x00\x0c\x00\x30\x2a\x4f\x5c\x60\x08\x81\x11\x0a\x00\xeb\x19\xeb\x01\x04\x34\x19\xf0\x0d\x30\x9e\xfd\xcb\x01\xa6\xc9\xef"
+"\x22\x22\x3e\x03\x18\x02\x3e\x02\xfd\x36\x02\x00\xef\x30\x25\x28\x03\xef\x01\x16\x42\x15\x40\x70\x20\x38\x18\x0e\x15\xf0\x00\x3b"
+"\x28\x04\xfe\x2c\x20\x08\xef\x20\x00\xcd\x0e\x19\x18\x08\x03\x07\x30\x03\xef\xde\xa5\x02\x70\xef\x25\x18\xc9\xed\x73\x81\x60\x1a"
+"\x30\xcd\x97\x1c\x72\x08\xf0\x07\x21\xf7\xff\xf6\xff\xed\x42\xcd\xf3\x1c\x01\x09\x00\x21\x71\x5b\xcd\xac\x1d\x2a\x74\x5b\x1a\x00"
+"\x61\xcd\xac\x1d\xcd\x56\x1d\x63\x1a\x50\xed\x7b\x81\x5b\xc9\x5a\x00\x12\x21\x83\x15\x84\xcd\xa1\x18\x3e\x02\xef\x01\x16\x4b\x00"
+"\x2e\xd2\x20\x27\x00\x30\xcd\x93\x13\x8e\x15\x03\x6d\x00\x26\x5f\x1f\x22\x00\x04\x36\x00\xbd\x35\x1d\x21\x71\x5b\x01\x09\x00\xcd"
+"\x37\x1e\x1d\x00\x59\x42\x4b\xcd\x37\x1e\x7f\x00\xa1\xe5\xc5\x21\x81\x1c\x06\x00\x4f\x09\x4e\xe6\x1b\x25\xf8\xb1\xe7\x1b\xb0\xc1"
+"\xe1\xc9\x01\x03\x04\x06\x07\x00\x11\x67\x3c\x0a\xd1\x06\x0a\x1a\x13\xbe\x23\xc0\x10\xf9\xc9\xcd\x12\x1d\x05\x0a\xf0\x05\x20\xdd"
+"\xe5\x01\xec\x3f\xdd\x09\xdd\xe1\x30\x63\x21\xec\xff\x3e\xff\xcd\xf3\x1c\x48\x09\x53\xd6\xdd\xe5\xd1\x21\x69\x0a\xf1\x11\xdd\xcb"
+"\x13\xc6\xdd\x7e\x0a\xdd\x77\x10\xdd\x7e\x0b\xdd\x77\x11\xdd\x7e\x0c\xdd\x77\x12\xaf\xdd\x77\x0d\xdd\x77\x0e\xdd\x77\x0f\xa2\x00"
+"\x00\xd9\x0c\xf2\x08\xec\xff\x09\x22\x83\x5b\xc9\xed\x5b\x85\x5b\x08\x3a\x87\x5b\x4f\x08\xcb\x7f\x20\x09\x19\x89\x91\x1b\x95\xc9"
+"\x19\x89\x38\xf5\xcd\xac\x05\x03\xbe\x1b\xf1\x0e\xed\x5b\x83\x5b\xb7\xdd\xe5\xe1\xed\x52\xc8\xcd\x87\x1c\x20\x03\xf6\xff\xc9\x01"
+"\xec\xff\xdd\x09\x18\xe6\xcd\x12\x1d\x45\x09\x1e\x23\x77\x00\x01\x6d\x00\x12\xc9\x44\x00\x80\xcb\x13\x46\xc8\xdd\xcb\x13\x86\xb1"
+"\x00\xf0\x10\x96\xdd\x6e\x10\xdd\x66\x11\xdd\x7e\x12\xdd\x5e\x0a\xdd\x56\x0b\xdd\x46\x0c\xb7\xed\x52\x98\xcb\x14\xcb\x14\xcb\x2f"
+"\xcb\x1c\x04\x00\x02\x11\x09\x35\xdd\x77\x0f\x2b\x00\x01\x6f\x00\xf0\x10\xdd\x75\x0a\xdd\x74\x0b\xdd\x77\x0c\xc9\x78\xb1\xc8\xe5"
+"\x11\x00\xc0\xeb\xed\x52\x28\x1d\x38\x1b\xe5\xed\x42\x30\x0d\x60\x69\x1a\x0e\xf0\x05\xe3\x11\x00\xc0\xd5\x18\x28\xe1\xe1\x11\x00"
+"\x00\xd5\xd5\x18\x1f\x60\x69\x11\x20\x1c\x15\x71\x38\x05\xe3\x42\x4b\x18\x05\x17\x00\xa3\xc5\x11\x98\x5b\xed\xb0\xc1\xe5\x21\x98"
+"\xa0\x1c\x40\x5e\x10\xdd\x56\x90\x00\x80\xcd\x64\x1c\xed\xa0\x7a\xb3\x28\x41\x1b\x22\x05\x1e\xba\x00\x51\x73\x10\xdd\x72\x11\xcb"
+"\x00\x42\xe1\xc1\x18\x88\x14\x00\xd7\x34\x12\xdd\x7e\x12\x11\x00\xc0\xcd\x64\x1c\x18\xd4\x8b\x00\x30\x24\x38\x22\x8b\x00\x15\x12"
+"\x8b\x00\x20\x00\xd5\x8f\x00\x33\xeb\x18\x24\x90\x00\x4f\xd5\xeb\x18\x19\x92\x00\x02\x24\xe5\x11\x8c\x00\x04\x1c\x01\x01\x8c\x00"
+"\x83\x7c\xb5\x28\x25\x78\xb1\xc2\x91\x8c\x00\x42\x75\x10\xdd\x74\x8c\x00\xf3\x00\xd1\xc1\x21\x98\x5b\x78\xb1\x28\x02\xed\xb0\xeb"
+"\xc1\xc3\x37\x20\x00\x01\x98\x00\x12\x21\x98\x00\xe1\xc8\xf5\x3a\x5c\x5b\xf5\xe5\xd5\xc5\xdd\x21\x6a\x5b\xdd\xc6\x00\x62\xdd\x36"
+"\x12\x04\xcd\xac\x0d\x03\x71\xc1\xd1\xe1\x09\xeb\x09\xeb\x3e\x1e\x02\xaa\x1e\x59\x01\x00\x00\xf1\xc9\x35\x00\x01\x6f\x00\x00\x35"
+"\x00\xf0\x05\xeb\xcd\x37\x1e\x18\xc8\x08\x3e\x00\xf3\xcd\x3a\x1f\xf1\x22\x58\x5b\x2a\x81\x5b\x00\x03\x70\xf9\xfb\x2a\x58\x5b\xf5"
+"\x08\xb1\x10\x11\x7f\x45\x00\x48\xc1\xc9\x08\xf3\x20\x00\x00\x1f\x00\x70\x3e\x07\xcd\x3a\x1f\xfb\x08\xc8\x02\x03\x2a\x02\x01\x39"
+"\x0d\x90\xdd\x7e\x0f\xcd\xf3\x1c\xfd\xe5\xfd\x3b\x1c\x00\x4c\x02\xbf\xfd\x6e\x0a\xfd\x66\x0b\xfd\x7e\x0c\xfd\xe1\x18\x02\x06\x01"
+"\x64\x1c\x12\xdd\x98\x00\x22\x77\x12\x14\x02\x81\x6e\x0a\xdd\x66\x0b\xdd\x56\x0c\x1c\x00\xf4\x03\x7a\xcd\x64\x1c\x3a\x5c\x5b\x5f"
+"\x01\xfd\x7f\x3e\x07\xf3\xed\x79\xd9\xdd\x1f\x00\x07\x1a\x00\x11\xd9\x1b\x00\xd0\xdd\x7e\x10\xd6\x01\xdd\x77\x10\x30\x14\xdd\x7e"
+"\x11\x0a\x00\x60\x11\x30\x0a\xdd\x7e\x12\x0a\x00\xe4\x12\x38\x31\xed\x59\x7e\x2c\x20\x11\x24\x20\x0e\x08\x14\x3a\x00\xf8\x00\x21"
+"\x00\xc0\x08\xd9\xf3\xed\x59\x77\x2c\x20\x0f\x24\x20\x0c\x18\x00\x31\xd9\x18\xac\x1a\x02\xf3\x16\x3e\x00\x21\x14\x00\xcd\xf3\x1c"
+"\xdd\x5e\x0d\xdd\x56\x0e\xdd\x4e\x0f\x7a\x07\xcb\x11\x07\xcb\x11\x7a\xe6\x3f\x57\xdd\xe5\xd5\x11\xec\xff\xdd\x19\xd1\x93\x00\x10"
+"\x7e\xf6\x02\x85\x91\xcb\x74\x20\x03\xcb\xf4\x3d\xda\x02\x05\xf1\x02\x36\xb7\xed\x52\x1d\x00\x00\xf8\x01\x71\xdd\x77\x12\xdd\xe5"
+"\xe1\xd5\x8b\x03\x50\xed\x52\xd1\x20\xb1\x0a\x00\xf0\x01\xe1\xe5\xb7\xed\x52\x44\x4d\xe1\xe5\x11\x14\x00\x19\xeb\xe1\x1b\x69\x1c"
+"\x20\x83\x5b\x0d\x00\x00\xdf\x03\x01\x94\x00\x60\x21\x21\x21\x01\x2b\x21\x84\x1f\x60\xcd\xd6\x05\xdd\xe5\xe3\x37\x00\xf3\x04\xb7"
+"\xed\x52\xe1\x28\x20\x54\x5d\xe5\xc5\xcd\x8a\x1c\xc1\xe1\x30\x0e\x50\x59\x0b\x00\x51\x38\x03\xdd\xe5\xc1\xa8\x00\xf0\x03\x18\xd0"
+"\xe5\x21\x2b\x21\xb7\xed\x42\xe1\xc8\x60\x69\xcd\x35\x21\x18\xb9\x6a\x0f\x02\x04\x00\x15\xff\x01\x00\x20\xe5\xc5\x85\x0d\x01\xe6"
+"\x0e\x01\x25\x03\x04\x1a\x02\x01\xa7\x0d\x61\x7e\xe5\xc5\xef\x10\x00\xf1\x17\x84\x3e\x0d\xef\x10\x00\xef\x4d\x0d\x20\x00\x01\x9b"
+"\x00\x22\xe1\xc9\x03\x06\x05\xff\x05\x50\x4d\x0d\xef\xdf\x1f\xa1\x07\x00\x12\x00\x30\x08\x3e\x01\x13\x06\x90\x6e\x0d\xfd\x36\x02"
+"\x01\xef\xc1\x20\xe8\x0c\xf4\x00\xa0\x20\xc9\xc3\xf0\x08\xf3\xc3\x9d\x01\xdf\xfe\x2c\x20\x38\xff\x0c\x30\x2d\x23\xc9\xdc\x07\x10"
+"\x07\x23\x00\x34\x77\x24\xc9\x17\x00\xf0\x03\x94\x23\xc9\xef\xb2\x28\x20\x11\xef\x30\x25\x20\x08\xcb\xb1\xef\x96\x29\x21\x00\x21"
+"\x15\x2c\xd9\x08\x92\xfd\xcb\x30\x46\xc8\xef\xaf\x0d\xc9\xc0\x09\x00\x4f\x0a\x70\xcd\x8e\x22\xef\xfb\x24\xfd\xeb\x0d\xe1\x2c\xdf"
+"\xfe\x0d\x20\x27\xfd\xcb\x01\xfe\xcd\x8e\x22\x21\x02\x1f\x04\x1b\x00\x90\x11\x11\x8d\x5b\x2a\x65\x5c\x01\x05\xb2\x12\xf0\x0f\xed"
+"\xb0\xc3\x3e\x22\xcd\xac\x05\x19\x3e\x0d\xcd\x6f\x22\x01\x01\x00\xef\x30\x00\x22\x5b\x5c\xe5\x2a\x51\x5c\xe5\x3e\xff\xc0\x00\x90"
+"\xe3\x2d\xe1\xef\x15\x16\xd1\x2a\x5b\x2b\x08\x50\x1a\xcd\x6f\x22\x13\x89\x19\x43\xf6\xc9\xe5\xd5\x8e\x1f\x21\x9e\xf5\x87\x06\x40"
+"\xf1\xcd\x69\x26\x9d\x1f\x60\x9e\xcd\x20\x1f\xd1\xe1\xcd\x1f\xc0\x2b\x22\x5d\x5c\xe7\xc9\xcd\x8e\x22\xfe\xf1\xc0\x3c\x1c\xf0\x60"
+"\x23\xfe\x0d\xc8\xfe\x3a\x20\xf7\xb7\xc9\x47\x21\xbd\x22\x7e\x23\xb7\x28\x05\xb8\x20\xf8\x78\xc9\xf6\xff\x78\xc9\x2b\x2d\x2a\x2f"
+"\x5e\x3d\x3e\x3c\xc7\xc8\xc9\xc5\xc6\x00\xfe\xa5\x38\x0e\xfe\xc4\x30\x0a\xfe\xac\x28\x06\xfe\xad\x28\x02\xbf\xc9\xfe\xa5\xc9\x47"
+"\xf6\x20\xfe\x61\x38\x06\xfe\x7b\x30\x02\xbf\xc9\x78\xfe\x2e\xc8\xcd\x0a\x23\x20\x11\xe7\xcd\x0a\x23\x28\xfa\xfe\x2e\xc8\xfe\x45"
+"\xc8\xfe\x65\xc8\x18\xa4\xf6\xff\xc9\xfe\x30\x38\x06\xfe\x3a\x27\x00\xb0\xfe\x30\xc9\x06\x00\xdf\xc5\xef\x8c\x1c\xc1\x8e\x07\x71"
+"\x03\xe7\x18\xf3\x78\xfe\x09\x06\x0b\x72\x2b\xcd\xa1\x18\xc3\x85\x09\x10\x20\x70\xcd\x45\x1f\xc3\xcb\x25\xa7\x8c\x02\xf0\x21\x19"
+"\xeb\xc9\x01\x01\x00\xe5\xd5\xcd\x58\x23\xd1\xe1\xef\x55\x16\xc9\x2a\x65\x5c\x09\x38\x0a\xeb\x21\x82\x00\x19\x38\x03\xed\x72\xd8"
+"\xfd\x36\x00\x03\xc3\x21\x03\x87\x87\x6f\x26\x00\x29\x29\x29\x28\x18\xf1\x34\x39\xed\x5b\x65\x5c\xb7\xed\x52\xc9\xfd\xcb\xc7\x86"
+"\xcd\x6f\x23\xe5\xed\x5b\x24\xff\x19\x54\x5d\xe3\xe5\xd5\x11\x00\x58\x19\xeb\xe1\x01\x20\x00\x3a\x8f\x5c\xcd\x9b\x24\xe1\x7c\x26"
+"\x00\x87\x87\x87\xc6\x40\x57\x5c\x19\xeb\xe1\x06\x20\xc3\xe1\x23\x16\xff\xcd\x6f\x23\x7a\x32\x00\xf0\x08\x5d\x54\x13\x77\x0b\xed"
+"\xb0\xc9\xcd\x88\x24\x11\x00\x40\x2a\x24\xff\x43\xcd\xe1\x23\x16\x48\x05\x00\xff\x44\x50\x06\xc0\x7e\xe5\xd5\xfe\xfe\x38\x04\xd6"
+"\xfe\x18\x36\xfe\x20\x30\x07\x21\x27\x25\xa7\x08\x18\x34\xfe\x80\x30\x0e\xcd\x71\x23\xed\x5b\x36\x5c\x19\xd1\xcd\x28\xff\x18\x47"
+"\xfe\x90\x30\x04\xd6\x7f\x18\x11\xd6\x90\xcd\x71\x23\xd1\xcd\x20\x1f\xd5\xed\x5b\x7b\x5c\x37\x18\x07\x11\x2f\x25\xcd\x71\x23\xa7"
+"\x08\x19\xd1\x4a\x7e\x12\x23\x14\x04\x00\x07\xd2\x51\x08\xdc\x45\x1f\xe1\x23\x13\x10\x8c\xc9\xc5\xf3\xb5\x23\xa1\xee\x10\xed\x79"
+"\xfb\x08\x08\xf3\x0e\xfd\x0a\x00\x81\xc1\xc9\x21\x56\x24\x11\x28\xff\x49\x22\xa0\xe5\x21\x2c\x24\x0e\x20\xed\xb0\xe1\x0e\xbd\x00"
+"\x00\x04\x01\xa1\x11\x00\x58\x01\xc0\x02\x2a\x24\xff\x3a\x8c\x22\xf0\x3b\x08\xc5\x7e\xfe\xff\x20\x08\x3a\x8d\x5c\x12\x23\x13\x18"
+"\x5d\x08\x12\x13\x08\x23\xfe\x15\x30\x54\xfe\x10\x38\x50\x2b\x20\x08\x23\x7e\x4f\x08\xe6\xf8\x18\x43\xfe\x11\x20\x0b\x23\x7e\x87"
+"\x87\x87\x4f\x08\xe6\xc7\x18\x34\xfe\x12\x20\x09\x23\x7e\x0f\x4f\x08\xe6\x7f\x18\x27\xfe\x13\x20\x0a\x23\x7e\x0f\x0e\x00\xf0\x9a"
+"\xbf\x18\x19\xfe\x14\x23\x20\x16\x4e\x3a\x01\x5c\xa9\x1f\x30\x0e\x3e\x01\xfd\xae\xc7\x32\x01\x5c\x08\xcd\x13\x25\xb1\x08\xc1\x0b"
+"\x78\xb1\xc2\x9c\x24\x08\x32\x8f\x5c\xc9\x47\xe6\xc0\x4f\x78\x87\x87\x87\xe6\x38\xb1\x4f\x78\x1f\x1f\x1f\xe6\x07\xb1\xc9\x00\x3c"
+"\x62\x60\x6e\x62\x3e\x00\x00\x6c\x10\x54\xba\x38\x54\x82\x15\x0b\x94\x2a\x0a\xb5\x2a\x08\xd7\x2a\x09\xe3\x2a\xad\x4f\x2a\xac\x25"
+"\x2a\xaf\xd4\x29\xae\xe1\x29\xa6\x83\x29\xa5\xab\x29\xa8\x87\x2a\xa7\x7a\x2a\xaa\x1b\x29\x0c\x2b\x29\xb3\x17\x30\xb4\xbc\x2f\xb0"
+"\x72\x30\xb1\x3e\x30\x0d\x44\x29\xa9\x9b\x26\x07\x04\x27\x04\x0b\x2e\x27\x0a\x31\x27\x07\x17\x27\x0d\x17\x27\xcd\xbe\x28\x21\x00"
+"\x00\x22\x9a\xfc\x3e\x82\x32\x0d\xec\x0b\x00\x95\x49\x5c\xcd\xbc\x35\xcd\x5e\x36\xc9\x69\x02\x01\x2e\x03\xd0\x21\x44\x27\x22\xea"
+"\xf6\x21\x54\x27\x22\xec\xf6\xe5\x37\x03\xfa\x02\xce\xcb\xa6\x2b\x36\x00\xe1\xcd\xa8\x36\xc3\x53\x26\xdd\x21\x6c\xfd\x30\x00\x30"
+"\xcd\x68\x36\xee\x1d\x30\x6e\x28\xfc\x2d\x00\xf2\x10\x9e\xcb\x76\x20\x14\x3a\x0e\xec\xfe\x04\x28\x0a\xfe\x00\xc2\xc7\x28\xcd\x48"
+"\x38\x18\x03\xcd\x4d\x38\xcd\xd6\x30\xcd\x22\x32\x1a\x00\x11\x42\x2c\x10\x20\x20\x15\xa8\x12\x80\x4b\x4b\x5c\xa7\xed\x42\x20\x06"
+"\x92\x00\x31\x08\xec\x2a\x23\x22\xd0\xef\x6e\x19\xef\x95\x16\xcd\x45\x1f\xed\x53\x49\x5c\x56\x00\x30\x6e\x20\x0f\x20\x00\xf0\x0c"
+"\x06\xec\xcd\x2f\x15\xcd\xf2\x29\xcd\x44\x29\x31\xff\x5b\xcd\x68\x36\xcd\x7f\x36\xf5\x3a\x39\x5c\xcd\xec\x26\xe4\x03\x20\x18\xea"
+"\x2c\x00\xf0\x0d\x4e\xf5\x21\x77\x25\x20\x03\x21\x37\x25\xcd\xce\x3f\x20\x05\xd4\xe7\x26\xf1\xc9\xf1\x28\x05\xaf\x32\x41\x5c\xc9"
+"\x20\x00\xe1\x46\x28\x04\xcd\xe7\x26\xc9\xfe\xa3\x30\xbb\xc3\xf1\x28\x91\x00\x40\xc8\xcd\x30\x16\x1b\x00\xf0\x07\x9e\x7e\xee\x40"
+"\x77\xe6\x40\x28\x05\xcd\xbb\x26\x18\x03\xcd\xce\x26\x37\xc9\xcd\x81\x38\x1a\x00\xc0\xf6\xcd\x2d\x2e\xcd\x88\x3a\xcd\xdf\x28\x18"
+"\x0b\x10\x00\x30\xb6\xcd\xbe\xda\x00\xf0\x1f\x2a\x9a\xfc\x7c\xb5\xc4\x4a\x33\xcd\x2f\x15\xc3\xf2\x29\x3a\x38\x5c\xcb\x3f\xdd\xe5"
+"\x16\x00\x5f\x21\x80\x0c\xef\xb5\x03\xdd\xe1\xc9\xdd\xe5\x11\x30\x00\x21\x00\x03\x18\xf0\xcd\xec\x29\x39\x00\xb1\xce\x2b\x36\x00"
+"\x2a\xec\xf6\xcd\xa8\x36\x37\x8e\x00\xf0\x2f\x8e\x2b\x7e\x2a\xea\xf6\xe5\xf5\xcd\x3e\x37\xf1\xe1\xcd\xce\x3f\xc3\xf2\x29\x37\x18"
+"\x01\xa7\x21\x0c\xec\x7e\xe5\x2a\xec\xf6\xdc\xa7\x37\xd4\xb6\x37\xe1\x77\x37\xc9\x05\x00\x31\x28\x01\x6c\x28\x02\x85\x28\x03\x47"
+"\x1b\x04\x16\x28\x06\x31\x32\x38\x20\x01\x00\xc0\xff\x54\x61\x70\x65\x20\x4c\x6f\x61\x64\x65\xf2\x14\x00\xf1\x03\x42\x41\x53\x49"
+"\xc3\x43\x61\x6c\x63\x75\x6c\x61\x74\x6f\xf2\x34\x38\x20\x12\x00\x01\x26\x00\xf5\x12\x54\x65\x73\x74\x65\xf2\xa0\x05\x00\x42\x27"
+"\x01\x51\x28\x02\x11\x28\x03\x62\x28\x04\x1c\x28\x06\x4f\x70\x74\x69\x6f\x6e\x73\x20\xff\x41\x00\x30\x52\x65\x6e\x92\x22\xf0\x03"
+"\xf2\x53\x63\x72\x65\x65\xee\x50\x72\x69\x6e\xf4\x45\x78\x69\xf4\xa0\x02\x3b\x00\x35\x1c\x28\x03\x32\x00\x06\x6a\x00\x01\x20\x00"
+"\xf0\x22\x16\x01\x00\x10\x00\x11\x07\x13\x00\x54\x6f\x20\x63\x61\x6e\x63\x65\x6c\x20\x2d\x20\x70\x72\x65\x73\x73\x20\x42\x52\x45"
+"\x41\x4b\x20\x74\x77\x69\x63\xe5\xcd\x9b\x26\x18\x5e\xcd\x57\x38\xcd\xe9\x3b\x15\x01\x00\x4e\x01\x72\x06\x00\x16\x17\xcd\x5e\x3b"
+"\xc6\x25\x30\xcd\x52\x38\x3d\x25\xf0\x10\xc6\x11\xeb\x27\xcd\x7d\x05\xcb\x86\xcb\xf6\x3e\x07\x32\x0e\xec\x01\x00\x00\xcd\x2b\x37"
+"\xc3\xf1\x1a\xcd\x88\x38\xd4\xe7\x26\x13\x02\xa0\x49\x5c\x22\x08\xec\x18\x03\xcd\x14\x1b\x49\x00\x30\x76\x20\x08\x38\x00\x31\x86"
+"\xcd\x48\xb6\x01\xd0\xae\xcb\xa6\x3e\x00\x21\x90\x27\x11\xa0\x27\x18\x2c\x20\x00\x40\xee\xcb\xe6\xcb\x6d\x00\x74\xcd\x4d\x38\x3e"
+"\x04\x32\x0e\x07\x03\xf3\x18\x2f\x15\x01\x00\x00\x78\xcd\xf8\x29\x3e\x04\x21\xcb\x27\x11\xd2\x27\x32\x0e\xec\x22\xea\xf6\xed\x53"
+"\xec\xf6\xc3\x04\x26\xcd\x1f\x2e\xcd\x7f\x3a\xc3\xe8\x28\xa3\x00\xa0\xc3\xad\x25\x06\x00\x00\x00\x04\x10\x14\x07\x00\xe4\x00\x01"
+"\x01\x21\xd8\x28\x11\xee\xf6\xc3\xba\x3f\x21\xd1\x09\x00\xf1\x19\x0d\xec\xb7\xb7\xcb\x46\xc2\xf2\x29\xcb\xbe\xcb\xde\xe5\xf5\xcd"
+"\xec\x29\xf1\xf5\xcd\x81\x2e\xf1\x78\xcd\x78\x2b\xe1\xcb\xfe\xd2\xf2\x29\x78\xda\xf8\x29\xc3\xf2\x14\x02\xb1\xde\xcd\xec\x29\xcd"
+"\x12\x2f\x37\x78\xc3\xf8\x10\x00\x21\x86\xcb\x12\x00\x55\x5b\x2b\x3f\xda\xf2\x19\x00\xf0\x01\xcd\xec\x29\xf5\xcd\xb4\x30\xc5\x06"
+"\x00\xcd\x41\x2e\xc1\x38\x0a\x92\x12\xf0\x19\x7e\x2f\xe6\x09\x28\x1c\x3a\x0d\xec\xcb\x5f\x28\x05\xcd\x8e\x2c\x30\x15\xcd\x4c\x2c"
+"\xcd\x78\x2b\xcd\xce\x2e\x06\x00\xf1\x37\xc3\xf8\x29\xf1\x37\xc3\xf2\x29\xf1\x9c\x02\x00\x93\x03\x10\xc8\x85\x02\x20\x00\x00\x7b"
+"\x0e\x08\x62\x03\x80\x3e\x0f\xcd\x96\x3a\xcd\x2f\x15\x2c\x00\x03\x10\x03\x52\xec\x29\x21\x0f\x27\x28\x00\x16\xeb\x8b\x03\x08\x29"
+"\x00\x00\xb4\x00\x20\xea\x2b\xc9\x00\x30\xc3\xf8\x29\x0d\x00\xd0\x09\x2c\x30\x09\x78\x18\x0c\xcd\x07\x2a\xc3\x4f\x36\x06\x00\x71"
+"\x40\x36\xcd\x11\x2a\xf5\xc5\x35\x00\xf0\x0d\xc1\xf1\xc3\x40\x36\x21\xee\xf6\x4e\x23\x46\x23\x7e\x23\xc9\x21\xee\xf6\x71\x23\x70"
+"\x23\x77\xc9\xe5\xcd\xb4\x30\x71\x13\xf0\x16\x7e\xe1\xc9\xcd\xec\x29\x5f\x16\x0a\xd5\xcd\x30\x2b\xd1\x30\xc0\x7b\xcd\x11\x2a\x43"
+"\xcd\xf9\x2a\x30\x06\x15\x20\xec\x7b\x38\xb6\xd5\xcd\x0b\x2b\xd1\x11\x00\x44\x7b\xb7\x18\xa9\x2a\x00\x52\x0b\x2b\xd1\x30\x96\x2a"
+"\x00\x40\x02\x2b\x30\x07\x2a\x00\xd3\xda\xf8\x29\xf5\xcd\x30\x2b\x06\x00\xcd\xd4\x2b\xf1\x99\x00\x27\x4c\x2c\xa6\x00\x17\x31\x0d"
+"\x00\x11\x5f\x56\x00\x86\xd2\xf2\x29\x43\xcd\x02\x2b\x7b\x3b\x00\x23\xf9\x2a\x3b\x00\x11\x5f\x8e\x00\x07\x21\x00\x01\x31\x00\x02"
+"\x87\x00\x03\x5d\x00\x22\x5b\x2b\xc8\x01\x00\x02\x01\x10\x78\x0c\x00\x81\xf5\xcd\x0b\x2b\x06\x1f\xcd\xdf\x7f\x00\xf1\x0c\xd5\xcd"
+"\xd4\x2b\xd4\xdf\x2b\xd1\xc9\xd5\xcd\xdf\x2b\xd4\xd4\x2b\xd1\xc9\xcd\x7c\x2c\x30\x1f\xc5\xcd\xb4\x30\xc8\x01\xf5\x08\xd4\x80\x2f"
+"\xc1\x21\xf1\xf6\x7e\xb9\x38\x09\xc5\xcd\x6f\x16\xc1\xd8\x79\xb7\xc8\x0d\x37\xc9\x20\x00\xf1\x1e\xc1\x38\x03\xc3\x80\x2f\xcd\x68"
+"\x2c\x30\x16\x21\xf1\xf6\x23\x79\xbe\x38\x0c\xc5\xe5\xcd\x39\x16\xe1\xc1\xd8\x23\x7e\xb9\xc8\x0c\x37\xc9\x57\x05\xfa\x66\x2b\x58"
+"\xcd\xdf\x2b\x7b\xd8\x9d\x00\x21\x7b\xd0\x7d\x00\xf1\x06\x78\xd8\x7a\x06\x00\xc9\x57\x04\x3e\x1f\xb8\x38\x06\x58\xcd\xd4\x2b\x7b"
+"\xd8\x05\xc5\xce\x05\x61\x7e\x20\x31\xcd\xb4\x30\x3e\x02\x81\xcb\x4f\x20\x25\xcb\xce\xcb\x9e\x1b\x15\x20\xe1\xc1\x39\x01\x10\xf1"
+"\x1c\x00\xf1\x04\x23\x00\x19\xeb\xcb\x87\xcb\xdf\xcd\xd3\x2e\xcd\xf4\x35\x78\x37\xc9\xe1\xc1\x09\x01\x21\x78\xd0\x58\x01\x50\x78"
+"\xd8\x7b\x06\x00\x4e\x11\x90\xb4\x30\xcd\x41\x2e\xc3\x65\x2c\xd5\xc6\x01\x23\xcd\x63\x0b\x00\xf1\x01\x5b\x2b\x30\x16\xcd\x1a\x2a"
+"\xfe\x20\x28\xf4\xcd\x5b\x2b\x30\x0a\x0c\x00\xe6\x20\xf4\xcd\x78\x2b\x18\x5c\xd5\xe5\xcd\x78\x2b\x30\x1b\x13\x00\x53\x30\x0f\xcd"
+"\x41\x2e\x24\x00\xb1\x28\xef\x37\x18\x3a\xd4\x5b\x2b\xb7\x18\x34\x52\x00\x00\xa4\x00\xb1\xcb\x46\x20\x07\xcd\x0b\x2b\x38\xf0\x18"
+"\x20\x7c\x00\x26\x18\x19\x1b\x00\x50\x5e\x20\x07\xcd\x30\x1b\x00\x11\x05\xf3\x00\x31\xe1\xd1\xc9\x0a\x03\x20\x37\xc8\xc4\x00\x00"
+"\xf7\x16\x5b\x5e\x37\xc8\x18\x12\x14\x00\x54\x46\x37\xc8\x3e\x02\x21\x00\xf0\x0a\x46\x20\x08\x0d\xf2\x90\x2c\x0e\x00\x3e\x01\x21"
+"\x00\xec\x11\x03\xec\xf6\x80\x77\x12\x23\x13\x3e\x00\x06\x00\x30\x79\x77\x12\x61\x04\xd0\x06\xec\xcd\x5f\x33\xcd\x67\x3c\xdd\xe5"
+"\xcd\x20\x1f\xa1\x11\x40\x45\x1f\xdd\xe1\x13\x29\x20\x20\x18\x52\x04\x41\x9e\xcd\x5e\x36\x34\x03\xb2\xc4\x2f\x15\xcd\xfa\x26\xcd"
+"\x07\x2a\x37\xc9\x4c\x00\x71\x1a\xcb\xbf\x77\x23\x13\x1a\x04\x00\xf0\x13\xcd\x63\x3c\x38\x04\xed\x4b\x06\xec\x2a\x06\xec\xb7\xed"
+"\x42\xf5\xe5\xcd\x07\x2a\xe1\xf1\x38\x11\x28\x2a\xe5\x78\xcd\x5b\x2b\xe1\x30\x22\xba\x0a\x31\xf3\x18\x1b\xa3\x01\x50\xbe\xe1\xeb"
+"\x21\x00\x5b\x0f\x11\xe5\x2f\x04\x21\x30\x05\x1d\x00\x00\x6e\x00\xa0\xfe\xcd\x11\x2a\x3e\x17\xcd\x96\x3a\xb7\x65\x00\xf0\x4c\xcb"
+"\x7e\x28\x07\x2a\x06\xec\x23\x22\x06\xec\x21\x00\xec\x7e\x23\x46\x23\x4e\xe5\xe6\x0f\x21\x85\x2d\xcd\xce\x3f\x5d\xe1\x28\x02\x3e"
+"\x0d\x71\x2b\x70\x2b\xf5\x7e\xe6\xf0\xb3\x77\xf1\xc9\x03\x02\xac\x2d\x04\xe9\x2d\x01\x8f\x2d\xcd\xb7\x32\xcd\x0e\x2e\x30\x07\xfe"
+"\x00\x28\xf7\x2e\x01\xc9\x0c\x06\x00\x2a\xdb\xf9\x79\xbe\x38\xe7\x06\x00\x0e\x00\xe5\x21\xee\xf6\x7e\xb9\xd2\x08\x90\xb8\x20\x05"
+"\x21\x00\xec\xcb\xbe\xe1\x44\x17\x03\x30\x00\x41\xe1\x2e\x02\xc9\x98\x01\xf6\x0a\x5e\x28\x05\x2e\x08\x3e\x0d\xc9\x21\xf3\xf6\x0c"
+"\x7e\xb9\x06\x00\x30\xda\x06\x00\x0e\x01\xcd\xc3\x31\x5a\x00\x13\x04\x2a\x00\xb1\x20\x09\x0c\x06\x00\x3a\xf5\xf6\xb9\x30\xe0\x33"
+"\x00\xf1\x02\x3e\x1f\xb8\x3f\xd0\x68\x26\x00\x19\x7e\x04\x37\xc9\x01\x14\x01\x01\xb3\x05\x60\x21\x1b\x2e\x11\x15\xec\x45\x05\x42"
+"\x3c\x5c\xcb\xc6\xea\x05\x23\x21\x1d\x14\x00\x01\x23\x04\xf0\x01\xfe\x00\x37\xc0\x78\xb7\x28\x0d\xe5\x2b\x7e\xfe\x00\x37\xe1\xc0"
+"\x06\x00\x95\xc0\x23\x04\x78\xfe\x1f\x38\xf4\xc9\x22\x00\xe2\x7e\xfe\x00\x20\x07\x78\xb7\xc8\x2b\x05\x18\xf4\x04\x37\x18\x00\x00"
+"\x6a\x07\x50\xb7\xcb\x46\xc0\xc5\x42\x05\xf1\x12\xf1\xcd\xac\x16\xf5\xeb\xcd\x04\x36\xeb\xf1\x3f\x28\x31\xf5\x06\x00\x0c\x3a\x15"
+"\xec\xb9\x38\x23\x7e\x5f\xe6\xd7\xbe\x77\x7b\xcb\xce\x25\x00\xf0\x20\x28\x0d\xcb\x87\xcd\xd3\x2e\x30\x10\xcd\xf4\x35\xf1\x18\xcc"
+"\xcd\x41\x2e\xf1\x18\xc6\xf1\xcd\x6e\x31\xc1\xc9\xcd\xb4\x30\x3e\x09\xc5\xd5\x41\x21\xef\x2e\x4f\xc5\xcd\x75\x16\xc1\x79\x30\x0a"
+"\xa6\x18\x00\x18\x01\x41\x77\x37\xd1\xc1\xdb\x2e\x02\xce\x0d\x0f\x06\x00\x03\x30\x09\x00\x00\xe2\x03\x10\xc5\x31\x00\x71\xcb\x4e"
+"\x3e\x00\x28\x10\x0c\x83\x03\x00\x88\x00\x70\x30\xea\x0d\xcd\xc9\x31\xe1\x52\x03\xd1\xe1\x47\x79\xbd\x78\xf5\x20\x03\x44\x18\x09"
+"\xf5\xe5\x2f\x04\xf0\x03\xe1\xf1\xe5\x21\xf4\xf6\xcb\xc6\x28\x02\xcb\x86\xcd\xc1\x16\xf5\xc5\xd5\x0f\x00\x31\x46\x20\x0e\x1c\x03"
+"\xb0\x38\x07\xcd\x80\x2f\xd1\xc1\x18\x05\xe1\xc1\x64\x19\xa1\x0d\x47\xe1\xf1\x78\xc2\x32\x2f\x37\xc1\x88\x01\xc3\x7e\xcb\x46\x20"
+"\x29\xf5\xc5\x79\xb7\x20\x15\xc5\x4c\x1a\xf1\x04\x9a\xfc\x3a\xdb\xf9\x4f\x0d\xcd\xb7\x32\xc1\x18\x04\x0d\xcd\xb4\x30\xc1\xf1\x93"
+"\x00\x40\x8e\xb6\x77\x41\xf4\x01\xe1\xdf\x30\xc3\x48\x16\xcd\x84\x30\xe5\xcd\x95\x30\x28\x32\xa8\x02\xf1\x00\x2d\xcd\x1a\x2a\xf5"
+"\xe5\xcd\x12\x2f\xe1\xf1\xfe\x20\x28\xe6\x1a\x00\x11\x18\x1a\x00\x11\x13\xd5\x03\x21\x28\x07\x1d\x00\x20\x18\xe6\xe9\x03\x40\xe1"
+"\x78\xf5\xe5\x59\x1a\x40\x96\x3a\x15\xec\xf3\x24\x50\xbf\xcd\x05\x16\xc1\xc7\x02\x71\xde\xe1\xcd\xf8\x29\xf1\xc9\x5b\x00\x85\x1a"
+"\x2a\xe1\xfe\x00\x37\x28\xd4\x56\x00\x21\x20\xeb\x4a\x00\x32\x37\x20\xc1\x4b\x00\x11\xf1\x27\x00\x02\xb3\x04\x40\xcb\x46\x20\x0c"
+"\x55\x04\x10\x1b\x82\x00\xf0\x10\x18\xe9\xe5\x78\xfe\x00\x28\x0f\x05\xcd\x1a\x2a\x04\xfe\x00\x28\x06\x05\xcd\x12\x2f\x18\xec\xe1"
+"\x37\xc3\xf8\x2f\xcd\x84\x30\x46\x00\x43\x00\x37\x28\xf1\x46\x00\x00\x78\x00\x10\x86\x00\x07\x70\xf5\xee\xcb\xd6\x21\xf1\xf6\xc7"
+"\x01\x01\xee\x00\x30\x46\x28\x0e\x47\x00\x14\x0d\x47\x00\xf3\x0b\x04\x3e\x01\xb7\xc9\xaf\xc9\x21\x16\xec\xf5\x79\x11\x23\x00\xb7"
+"\x28\x04\x19\x3d\x18\xf9\xeb\xf1\xc9\xd5\xac\x06\xd0\xd1\xc9\x05\x00\x00\x00\xf8\xf6\x21\xd0\x30\x11\xf5\xf7\x07\xf1\x13\xc5\xd5"
+"\x21\xf5\xf6\xe5\x7e\xb7\x20\x18\xe5\xcd\x5f\x33\x2a\xd7\xf9\xcd\x52\x33\x30\x03\x22\xd7\xf9\x44\x4d\xe1\xcd\xd6\x32\x3d\x18\x15"
+"\x7d\x00\xf1\x0a\x21\xf8\xf6\x54\x5d\x01\x23\x00\x09\x01\xbc\x02\xed\xb0\x3d\x37\xd1\x12\x21\xf8\xf6\xd1\xc1\xc9\xc5\x5e\x1a\x80"
+"\x7e\x2f\xe6\x11\x20\x15\xe5\xd5\xa9\x1b\x72\xd5\xcd\x5f\x33\xe1\xcd\x4a\x45\x00\x40\xd1\xe1\xcb\x46\x60\x00\xb0\x28\x05\x3e\x00"
+"\x37\x18\xca\x7e\xfe\x14\x28\xc2\x1a\x91\x21\xf8\xf6\xeb\xed\xb0\x21\xd6\xf9\x54\x00\x30\xb7\xed\x42\x56\x00\x80\xb8\x3c\x37\x18"
+"\xa8\xc5\xd5\xf5\x8c\x03\xb0\xe5\xcd\xc3\x31\xe1\xcb\x5e\xcb\x9e\x20\x20\xbe\x02\x32\xcd\xac\x16\xee\x02\xc1\x79\xfe\x15\x38\x0e"
+"\x2b\x7e\x23\xfe\x00\x28\x07\x6f\x04\x40\xc6\xe1\xcb\x4e\x07\x06\xe1\xcd\xc3\x31\x20\xd5\xc5\xd5\xcd\xe6\x35\x36\x08\xd1\xc1\xf8"
+"\x02\xf1\x03\xca\x79\x32\xf5\xf6\xcb\xde\xd1\xc1\xc9\x21\xf8\xf6\xc3\xb7\x30\xc5\xd5\xca\x00\xb0\x3a\xf5\xf6\x4f\xb7\x3e\x00\x28"
+"\x42\xcd\xc3\x41\x03\x00\xc3\x05\x21\x0e\xf1\x91\x02\x01\xa7\x02\xc3\xc1\x38\x24\x23\x7e\xf5\xc5\x79\xfe\x01\x20\x09\x84\x1b\x00"
+"\x60\x02\x26\xc3\x31\x60\x02\x80\x21\xf5\xf6\x35\xf1\x0d\x20\xbf\x2f\x03\xf0\x03\x03\x00\xde\xf9\x21\x1e\x32\x11\xdb\xf9\xc3\xba"
+"\x3f\xc5\xd5\x21\xdb\xf9\x4c\x01\x11\x1e\x4c\x01\x01\xf5\x1c\xd0\x30\x03\x22\x9a\xfc\x44\x4d\xe1\x23\x23\x23\x30\x11\x51\x01\x60"
+"\xeb\x18\x0a\x2a\xdc\xf9\xef\x1b\x80\x42\x37\x3d\xeb\xe1\x30\x01\x77\x36\x1f\x1a\xeb\x4c\x01\x30\x0c\xd5\xe5\x4c\x01\x80\xed\x53"
+"\x9a\xfc\xe1\xd1\xcb\x5e\x57\x00\x24\x28\x16\x55\x00\x50\x52\x33\x22\x9a\xfc\x51\x00\x00\x54\x01\x10\xbd\x54\x01\x22\x0e\x3c\x53"
+"\x00\x00\xc9\x30\x40\x37\x18\xaa\xe1\xf4\x00\xf1\x14\xde\xf9\xc3\xb7\x30\x08\x0d\xcc\x35\x01\xda\x35\x12\x5a\x33\x13\x5a\x33\x14"
+"\x5a\x33\x15\x5a\x33\x10\x5a\x33\x11\x5a\x33\x54\x5d\x13\x13\x13\xbc\x01\xc2\x36\x01\x23\x70\x23\x71\x0e\x01\x06\x00\xc5\xd5\x0d"
+"\x06\xf0\x02\x17\x35\xd1\xc1\x38\x0f\x79\xfe\x01\x3e\x0d\x20\x08\x78\xb7\x3e\x01\x8e\x05\xf0\x0d\x21\xbd\x32\xcd\xce\x3f\x38\x1d"
+"\x28\xd9\xf5\x3e\x1f\xb8\x30\x0f\x3e\x12\xcd\x31\x33\x38\x05\xf1\x3e\x0d\x18\xe4\x6f\x01\xf2\x06\xcd\xc5\x35\x18\xbe\xe1\x79\xc8"
+"\x37\xc9\xf5\xcd\xe6\x35\xf1\xae\x77\x79\xfe\x14\xd0\x1b\x04\x00\xaa\x02\xe3\x36\x00\x37\xc9\xcd\xb6\x34\xd8\x21\x00\x00\xc9\xcd"
+"\x30\x08\x00\x40\x17\x35\x3f\xd0\xa7\x06\xf0\x02\x9f\xfc\x22\xa1\xfc\x21\x74\x33\x11\xae\xfc\x01\xbc\x00\xed\xb0\xc9\x1d\x0f\xf0"
+"\x4e\x16\x17\xed\x51\xfe\x50\x30\x31\xfe\x40\x30\x26\xfe\x30\x30\x1b\xfe\x20\x30\x10\xfe\x10\x30\x05\x21\x96\x00\x18\x21\xd6\x10"
+"\x21\xcf\x00\x18\x1a\xd6\x20\x21\x00\x01\x18\x13\xd6\x30\x21\x3e\x01\x18\x0c\xd6\x40\x21\x8b\x01\x18\x05\xd6\x50\x21\xd4\x01\x47"
+"\xb7\x28\x09\x7e\x23\xe6\x80\x28\xfa\x05\x18\xf5\x11\xa3\xfc\xed\x53\xa1\xfc\x3a\x9e\xfc\xb7\x3e\x00\x32\x9e\xfc\x20\x04\xfb\x1f"
+"\xf1\x05\x7e\x47\x23\x12\x13\xe6\x80\x28\xf7\x78\xe6\x7f\x1b\x12\x13\x3e\xa0\x12\x3e\x07\x21\x33\x15\xfb\x80\x00\xf0\x07\x21\x96"
+"\x00\x06\xa5\x11\x74\xfd\x1a\xe6\x7f\xfe\x61\x1a\x38\x02\xe6\xdf\xbe\x20\x09\x23\x35\x00\xf1\x03\xed\x37\x18\x0c\x04\x28\x08\x7e"
+"\xe6\x80\x23\x28\xfa\x18\xdc\xb7\x78\x16\x3c\x00\xa0\x51\xfb\xc9\xcd\xea\x34\xb7\x32\x9e\xfc\x71\x07\x60\xf6\x34\x30\x52\x20\x0c"
+"\x43\x30\xf0\x17\xcd\xcf\x34\xcd\xd9\x34\x30\x44\x56\x23\x5e\xcd\x45\x1f\xd5\xe5\xdd\xe5\xdd\x21\xa3\xfc\xdd\x22\xa1\xfc\xeb\x06"
+"\x00\x11\x18\xfc\xcd\x95\x34\x11\x9c\xff\x06\x00\x11\xf6\x06\x00\x10\xff\x06\x00\xfb\x2c\xdd\x2b\xdd\x7e\x00\xf6\x80\xdd\x77\x00"
+"\xdd\xe1\xe1\xd1\x23\x23\x23\x22\x9f\xfc\xeb\x37\xc9\xcd\x45\x1f\xc9\xaf\x19\x3c\x38\xfc\xed\x52\x3d\xc6\x30\xdd\x77\x00\xfe\x30"
+"\x20\x0b\x78\xb7\x20\x09\x3e\x00\xdd\x77\x00\x18\x02\x06\x01\xdd\x23\x86\x00\xd0\xcc\xeb\x7d\xb4\x37\xc2\x4d\x34\x3f\x18\xc2\xe5"
+"\x23\x56\x1c\xf0\x07\x23\x19\xd1\xc9\x7e\xe6\xc0\x37\xc8\x3f\xc9\x78\xbe\xc0\x79\x23\xbe\x2b\xc0\x37\xc9\xe5\x8c\x01\xc0\xa1\xfc"
+"\x22\x9f\xfc\xe1\xc9\xe5\xc1\x11\x00\x00\x3d\x22\xb2\xd9\x34\xd0\xcd\xe0\x34\xd8\x78\xb1\x37\xc8\xc5\x00\x00\x0f\x00\xf2\x0e\x30"
+"\xf4\xc9\x2a\xa1\xfc\x7d\xb4\x28\x1e\x7e\x23\xfe\xa0\x47\x3e\x00\x20\x02\x3e\xff\x32\x9e\xfc\x78\xcb\x7f\x28\x03\x46\x00\xf1\x07"
+"\xe6\x7f\xc3\x8f\x35\x2a\x9f\xfc\x7d\xb4\xca\x91\x35\xcd\x20\x1f\x7e\xfe\x0e\x20\x08\x23\x01\x00\x50\x18\xf3\xcd\x45\x1f\xcd\x00"
+"\xf0\x0d\xfe\xa5\x38\x08\xd6\xa5\xcd\xae\xfc\xc3\x17\x35\xfe\xa3\x38\x10\x20\x05\x21\x94\x35\x18\x03\x21\x9c\x35\xcd\xfd\x14\x00"
+"\x11\xf5\xae\x01\x52\xf1\xfe\x0d\x20\x09\x55\x00\xf0\x2a\x22\x9f\xfc\x37\xc9\x37\x3f\xc9\x53\x50\x45\x43\x54\x52\x55\xcd\x50\x4c"
+"\x41\xd9\x47\x4f\x54\xcf\x47\x4f\x53\x55\xc2\x44\x45\x46\x46\xce\x4f\x50\x45\x4e\xa3\x43\x4c\x4f\x53\x45\xa3\x02\x01\x05\x21\xb9"
+"\x35\x11\x6a\xfd\xc3\xba\x3f\xb2\x07\xf0\x01\x77\x04\xc9\xcd\xe6\x35\x7e\xf6\x18\x77\x21\x6a\xfd\xcb\xc6\x37\x0e\x00\x23\xcb\xde"
+"\x0c\x00\x00\x21\x00\xf0\x00\x3e\x20\xb8\xc8\x36\x00\x23\x04\x18\xf8\x3a\x6b\xfd\x06\x00\x96\x07\xa1\x36\x00\x04\x3d\x20\xf6\xc9"
+"\xc5\xd5\xe5\x0d\x06\x80\x56\xe1\x20\x04\x41\xcd\x1e\x3b\x61\x03\x08\x14\x00\x4e\x59\xcd\xbf\x3a\x14\x00\x11\xc6\x14\x00\x90\xf5"
+"\xc5\xd5\xe5\x78\x41\x4f\xcd\x9d\x0e\x00\x24\xf1\xc9\x0f\x00\x12\xb2\x0f\x00\x40\x3e\x00\x32\x41\x00\x2e\x90\x0a\x5c\x21\x3b\x5c"
+"\x7e\xf6\x0c\x77\xa4\x04\xd3\x66\x21\x66\x5b\x20\x03\xcb\x86\xc9\xcb\xc6\xc9\xe5\xa0\x10\x71\xcb\xae\x3a\x08\x5c\x21\x41\x9a\x2e"
+"\xf1\x0a\x30\x0d\xfe\x10\x30\xe7\xfe\x06\x38\xe3\xcd\xa4\x36\x30\xde\xe1\xc9\xef\xdb\x10\xc9\xe5\xcd\x3b\x37\x8d\x08\xf1\x05\xe1"
+"\x5e\x23\xe5\x21\xec\x37\xcd\x33\x37\xe1\xcd\x33\x37\xe5\xcd\x22\x38\x21\xfa\x0e\x00\xf0\x1d\xd5\x01\x07\x08\xcd\x2b\x37\xc5\x06"
+"\x0c\x3e\x20\xd7\x7e\x23\xfe\x80\x30\x03\xd7\x10\xf7\xe6\x7f\xd7\x3e\x20\xd7\x10\xfb\xc1\x04\xcd\x2b\x37\x1d\x20\xe1\x21\x38\x6f"
+"\xd1\xcb\x23\x02\x00\xf0\x00\x53\x15\x1e\x6f\x01\x00\xff\x7a\xcd\x19\x37\x01\x01\x00\x7b\x07\x00\xc0\x00\x01\x7a\x3c\xcd\x19\x37"
+"\xaf\xcd\xca\x37\xc9\x46\x18\xf0\x0f\x44\x4d\xef\xe9\x22\xc1\xd1\xe1\xf1\x09\x3d\x20\xef\xc9\x3e\x16\xd7\x78\xd7\x79\xd7\xc9\x7e"
+"\x23\xfe\xff\xc8\xd7\x18\xf8\x0d\x10\xf0\x01\x11\xf6\xee\x21\x3c\x5c\x38\x01\xeb\xed\xa0\x38\x01\xeb\x21\x7d\x0b\x00\xf0\x24\x01"
+"\x14\x00\xed\xb0\x38\x01\xeb\x08\x01\x07\x07\xcd\x94\x3b\xdd\x7e\x01\x80\x47\x3e\x0c\xc5\xf5\xd5\xef\x9b\x0e\x01\x07\x00\x09\xd1"
+"\xcd\x7e\x37\xf1\xc1\x05\x3d\x20\xec\xc9\x01\x0e\x08\xc5\x06\x00\xe5\x08\x41\x00\x01\x33\x00\xd6\xe1\x24\xc1\x10\xed\xc5\xd5\xef"
+"\x88\x0e\xeb\xd1\xc1\x17\x00\xf1\x0e\xc9\xcd\xca\x37\x3d\xf2\xb1\x37\x7e\x3d\x3d\xcd\xca\x37\x37\xc9\xd5\xcd\xca\x37\x3c\x57\x7e"
+"\x3d\x3d\xba\x7a\xf2\xc5\xb0\x00\x10\xd1\xb1\x00\x70\x21\x07\x59\x11\x20\x00\xa7\x17\x07\xf0\x08\x20\xfc\x3e\x78\xbe\x20\x02\x3e"
+"\x68\x16\x0e\x77\x23\x15\x20\xfb\xd1\xe1\xf1\xc9\x16\x07\x07\xa3\x26\xf0\x3b\x10\x07\x11\x00\x13\x01\xff\x11\x00\x20\x11\x07\x10"
+"\x00\xff\x01\x03\x07\x0f\x1f\x3f\x7f\xff\xfe\xfc\xf8\xf0\xe0\xc0\x80\x00\x10\x02\x20\x11\x06\x21\x10\x04\x20\x11\x05\x21\x10\x00"
+"\x20\xff\xc5\xd5\xe5\x21\x02\x38\x11\x98\x5b\x01\x10\x00\xed\xb0\x2a\x36\x5c\xe5\x21\x98\x5a\x22\x36\x5c\x21\x12\x38\x85\x01\x30"
+"\x22\x36\x5c\x1c\x02\xf0\x04\x21\x69\x27\x18\x0d\x21\x72\x27\x18\x08\x21\x5e\x27\x18\x03\x21\x84\x27\xe5\xa0\x11\x60\xa0\x5a\x06"
+"\x20\x3e\x40\xb8\x24\x02\xb4\x01\xc0\x01\x00\x15\xcd\x2b\x37\xd1\xcd\x7d\x05\x0e\x1a\x30\x10\x71\x22\x38\x06\x15\x16\x17\xc3\x5d"
+"\x10\xf0\x0d\xcd\x05\x3a\x7a\xb3\xca\xc0\x39\x2a\x96\x5b\xef\xa9\x30\xeb\x2a\x94\x5b\x19\x11\x10\x27\xb7\xed\x52\xd2\xc0\x39\x5e"
+"\x25\xf0\x02\xb8\x19\x23\x23\x22\x92\x5b\x23\x23\xed\x53\x6b\x5b\x7e\xef\xb6\x18\xbc\x29\xa0\xcd\x0e\x39\x18\xf3\xed\x5b\x6b\x5b"
+"\x2a\xad\x12\x92\x52\xeb\x20\xd8\xcd\x05\x3a\x42\x4b\xdf\x03\x32\xc5\xd5\xe5\x4d\x00\xb0\xed\x5b\x94\x5b\x19\xeb\xe1\x72\x23\x73"
+"\x23\xe7\x0e\x30\x09\xd1\x13\xf1\x13\x20\x20\xdf\xc8\x12\xf0\x0e\x43\x92\x5b\x37\xc9\xca\xf0\xe1\xec\xed\xe5\xf7\x23\x22\x79\x5b"
+"\xeb\x01\x07\x00\x21\x07\x39\xed\xb1\xeb\xc0\x0e\x00\x24\x2a\xf0\x05\x1b\xef\x1b\x2d\x30\x16\xfe\x2e\x28\x12\xfe\x0e\x28\x12\xf6"
+"\x20\xfe\x65\x20\x04\x27\x1f\x80\x2a\x79\x5b\xc9\x03\x23\x18\xdc\xca\x32\xf1\x08\xe5\xef\xb6\x18\xcd\x36\x3a\x7e\xe1\xfe\x3a\x28"
+"\x03\xfe\x0d\xc0\x23\xef\xb4\x33\xef\xa2\x2d\x42\x35\xf7\x03\x28\x0a\x7e\xfe\x80\x20\x05\x21\x0f\x27\x18\x11\x22\x77\x5b\xcd\x0b"
+"\x3a\x95\x00\xf0\x01\x11\x73\x5b\xe5\xcd\x3c\x3a\x58\x1c\x16\x00\xd5\xe5\x6b\x26\x00\x67\x30\xf1\x02\xb7\xed\x42\x22\x71\x5b\x28"
+"\x33\x38\x27\x44\x4d\x2a\x79\x5b\xe5\xd5\x4d\x16\x12\x13\x4d\x16\x61\x0c\xed\x72\x3f\x38\x07\x65\x16\xf0\x11\x18\x11\xd1\xe1\xcd"
+"\x45\x1f\xa7\xc9\x0b\x1d\x20\xfc\x2a\x79\x5b\xef\xe8\x19\xed\x5b\x79\x5b\xe1\xc1\xed\xb0\xeb\x36\x0e\xc1\x23\x89\x2d\xb0\xd1\x01"
+"\x05\x00\xed\xb0\xeb\xe5\x2a\x92\x5b\x06\x2a\x20\x2a\x71\x08\x01\xf0\x07\x73\x23\x72\x2a\x6b\x5b\xed\x5b\x71\x5b\x19\x22\x6b\x5b"
+"\xe1\xc9\x2a\x4b\x5c\x22\x77\x5b\xf3\x13\xf0\x18\x5b\x77\x5b\xb7\xed\x52\x28\x1a\x2a\x53\x5c\x01\x00\x00\xc5\xef\xb8\x19\x2a\x77"
+"\x5b\xa7\xed\x52\x28\x05\xeb\xc1\x03\x18\xef\xd1\x13\xc9\x11\x00\x00\xc9\x23\x17\x01\xf0\x19\xfa\xc9\xd5\x01\x18\xfc\xcd\x60\x3a"
+"\x01\x9c\xff\xcd\x60\x3a\x0e\xf6\xcd\x60\x3a\x7d\xc6\x30\x12\x13\x06\x03\xe1\x7e\xfe\x30\xc0\x36\x20\x23\x10\xf7\xc9\xaf\x09\xcb"
+"\x05\x20\x42\x3d\x19\x00\xe1\xc9\x08\x00\x00\x14\x00\x00\x00\x0f\x00\x08\x00\x16\x01\x09\x00\x01\xb4\x14\x90\x6d\x3a\x18\x03\x21"
+"\x76\x3a\x11\x6c\xcc\x04\xc1\xd7\x7a\xd7\x37\xc9\xe6\x3f\xdd\x77\x06\x37\xc9\x3b\x03\x30\xcd\xa0\x3b\x8f\x2e\x76\x2f\xe6\xc0\xdd"
+"\xb6\x06\x77\x15\x00\x01\xfd\x2e\xf0\x16\xe5\x26\x00\x7b\x90\x18\x07\xe5\x7b\x58\x47\x93\x26\xff\x4f\x78\xbb\x28\x4b\xd5\xcd\x98"
+"\x3b\xc5\x4c\xef\x9b\x0e\xeb\xaf\xb1\x28\x03\x04\x18\x01\x05\x79\x03\xf1\x06\xd1\x79\x0e\x20\x06\x08\xc5\xe5\xd5\x06\x00\xed\xb0"
+"\xd1\xe1\xc1\x24\x14\x10\xf2\xf5\x68\x03\x10\xe3\x6d\x03\xa2\xe3\xd1\x01\x20\x00\xed\xb0\xf1\xc1\xa7\x33\x00\xf0\x00\x0d\x67\x20"
+"\xbb\xd1\x43\xe1\xcd\xb8\x3b\xeb\x3a\x3c\x5c\xf5\xb7\x04\xb0\x76\xcb\x87\x28\x02\xcb\xc7\x32\x3c\x5c\x0e\xeb\x12\xf0\x1d\xeb\x06"
+"\x20\x7e\xa7\x20\x02\x3e\x20\xfe\x90\x30\x0f\xef\x10\x00\x23\x10\xf0\xf1\x32\x3c\x5c\xcd\xb8\x3b\x37\xc9\xcd\x20\x1f\xd7\xcd\x45"
+"\x1f\x18\xeb\xcd\xb8\x3b\x7a\x90\x3c\x4f\x92\x00\x90\xef\x9b\x0e\x0e\x08\xe5\x06\x20\xaf\x0d\x03\x80\xe1\x24\x0d\x20\xf3\x06\x20"
+"\xc5\x7b\x00\x40\xc1\x3a\x8d\x5c\x14\x00\x51\xc1\x05\x0d\x20\xd9\x3f\x00\xf4\x05\x3e\x21\x91\x4f\x3e\x18\x90\xdd\x96\x01\x47\xc9"
+"\xc5\xaf\x50\x5f\xcb\x1a\xcb\x1b\x04\x00\x70\x21\x00\x58\x47\x09\x19\xc1\xee\x03\xf0\x1b\x2a\x8d\x5c\xed\x5b\x8f\x5c\xd9\x2a\x0f"
+"\xec\xed\x5b\x11\xec\x22\x8d\x5c\xed\x53\x8f\x5c\xd9\x22\x0f\xec\xed\x53\x11\xec\x21\x13\xec\x3a\x91\x5c\x56\x77\x7a\x32\x91\x5c"
+"\xfd\x03\xf1\x17\xcd\x56\x3c\xf3\xdb\xfe\xe6\x40\x08\x21\xe1\x58\x11\x06\x00\x43\x7a\x77\x19\x10\xfc\x21\x00\x00\x11\x00\x08\x01"
+"\xfe\xbf\xed\x78\xcb\x47\x28\x49\x06\x7f\x08\x00\x31\x41\x06\xf7\x08\x00\x60\x39\x1b\x7a\xb3\x28\x09\x35\x00\x90\x28\xf5\x23\x18"
+"\xf2\xcb\x15\xcb\x14\x04\x00\xf0\x1a\x08\x28\x07\x08\x3e\x20\x94\x6f\x18\x02\x08\x6c\xaf\x67\x11\x1f\x59\x06\x20\x3e\x48\xfb\x76"
+"\xf3\x12\x1b\x10\xfc\x13\x19\x3e\x68\x77\x18\xa8\xfb\x06\x19\x76\x10\xfd\xdc\x05\xc0\xae\x37\xc9\x3e\x01\x18\x02\x3e\x00\x32\x8a"
+"\xfd\xe6\x06\xf0\x08\x85\xfd\x22\x87\xfd\x39\x22\x8b\xfd\xcd\xea\x34\x3e\x00\x32\x84\xfd\x21\x74\xfd\x22\x7d\xfd\xd0\x12\x10\xb0"
+"\x57\x16\x50\x3e\x00\x32\x81\xfd\xd4\x39\x11\x82\x2f\x00\xf1\x23\x7f\xfd\x2a\x85\xfd\x23\x22\x85\xfd\xcd\x9d\x3d\x4f\x3a\x81\xfd"
+"\xfe\x00\x20\x41\x79\xe6\x04\x28\x35\xcd\xe9\x3d\x30\x07\x3e\x01\x32\x81\xfd\x18\xdd\x2a\x7f\xfd\x7d\xb4\xc2\x1e\x3d\xc5\xcd\xcd"
+"\x3d\xc1\x41\x00\xa7\x79\xe6\x01\x20\xd8\x78\xcd\x16\x3e\xd0\x3f\x00\x21\x18\xe9\x12\x00\xf0\x0f\x18\xad\xfe\x01\x20\xf5\x79\xe6"
+"\x01\x28\xbb\xc5\xcd\x7e\x3f\xc1\x38\x79\x2a\x7f\xfd\x7c\xb5\x20\x13\x79\xe6\x02\x28\xbc\x58\x00\xf0\x22\xaf\x2a\x7d\xfd\x2b\x22"
+"\x7f\xfd\x18\x83\xc5\x21\x74\xfd\xed\x5b\x7f\xfd\x7a\xbc\x20\x05\x7b\xbd\x20\x01\x13\x1b\x18\x01\x23\x7e\xe6\x7f\xe5\xd5\xcd\x16"
+"\x3e\xd1\xe1\x7c\xba\x20\xf1\x7d\xbb\x20\xed\x23\x00\x00\xc8\x00\xf1\x01\x7f\xfd\xed\x4b\x7d\xfd\x0b\x7a\xbc\x20\x18\x7b\xbd\x20"
+"\x14\x13\x73\x08\xe0\x7f\xfd\xe1\x78\xbc\x20\x07\x79\xbd\x20\x03\xc1\x18\x1f\x75\x10\xe0\xe6\x80\x28\xf8\x22\x7d\xfd\x18\x81\xc5"
+"\xcd\x16\x3e\xc1\x16\x01\x20\x7f\xfd\xdc\x00\x10\x04\x48\x0c\x23\x32\x81\x13\x01\xf0\x24\xc3\xb3\x3c\xcd\x54\x2d\x47\xfe\x3f\x38"
+"\x0a\xf6\x20\xcd\xc6\x3d\x38\x17\x3e\x01\xc9\xfe\x20\x28\x0d\xfe\x23\x28\x06\x38\xf3\xfe\x24\x20\xef\x3e\x02\xc9\x3e\x03\xc9\x3e"
+"\x06\xc9\xfe\x7b\xd0\xfe\x61\x3f\xc9\x84\x00\x90\x7d\xfd\x97\x32\x7f\xfd\x32\x80\xfd\xa7\x00\xf3\x01\xcd\x9c\x3e\xe1\x7e\xe6\x80"
+"\xc0\x23\x18\xf1\x2a\x7d\xfd\x11\x7d\xc9\x00\x50\xca\x13\x3e\x11\x74\x0c\x00\xf1\x04\x04\x7b\xbd\x28\x06\x2b\x7e\xe6\x7f\x77\x23"
+"\x78\xf6\x80\x77\x23\x22\x7d\xfd\x82\x08\xf1\x2e\xf5\x3a\x89\xfd\xb7\x20\x12\xf1\xfe\x3e\x28\x08\xfe\x3c\x28\x04\xcd\x64\x3e\xc9"
+"\x32\x89\xfd\x37\xc9\xfe\x3c\x3e\x00\x32\x89\xfd\x20\x1a\xf1\xfe\x3e\x20\x04\x3e\xc9\x18\xe5\xfe\x3d\x20\x04\x3e\xc7\x18\xdd\xf5"
+"\x3e\x3c\xcd\x64\x3e\xf1\x18\xd4\xf1\x12\x00\x61\xc8\x18\xcb\xf5\x3e\x3e\x12\x00\xc0\xc2\xfe\x0d\x28\x20\xfe\xea\x47\x20\x07\x3e"
+"\x04\xb0\x01\xf1\x15\x0e\xfe\x22\x20\x0a\x3a\x81\xfd\xe6\xfe\xee\x02\x32\x81\xfd\x78\xcd\x9c\x3e\x37\xc9\x3a\x8a\xfd\xfe\x00\x28"
+"\x0a\xed\x4b\x85\xfd\x2a\x8b\xfd\xf9\x86\x00\xf0\x17\x5f\x3a\x84\xfd\x57\x7b\xfe\x20\x20\x20\x7a\xe6\x01\x20\x14\x7a\xe6\x02\x20"
+"\x07\x7a\xf6\x02\x32\x84\xfd\xc9\x7b\xcd\xfb\x3e\x3a\x84\xfd\xc9\x7a\xe6\xfe\x0f\x00\x40\xfe\xa3\x30\x24\x1f\x00\x12\x0b\x10\x00"
+"\x00\x1e\x00\x10\xc9\x40\x36\xb1\xfb\x3e\xd1\x7a\xe6\xfe\xe6\xfd\x32\x84\xfd\x14\x00\x54\x7a\xe6\xfd\xf6\x01\x0d\x00\xb1\x2a\x87"
+"\xfd\x23\x22\x87\xfd\x2a\x82\xfd\x47\x7e\x00\xf1\x00\x78\x28\x25\xed\x5b\x5f\x5c\x7c\xba\x20\x1a\x7d\xbb\x20\x16\x8b\x00\x20\x87"
+"\xfd\x7c\x38\x44\x04\xed\x4b\x87\x97\x00\xf0\x01\x18\x02\x37\x3f\xcd\x20\x1f\x30\x0d\x7e\xeb\xfe\x0e\x20\x1d\x13\x01\x00\x32\x18"
+"\x16\xf5\xfe\x1b\xf0\x00\x66\x3f\xd1\xe1\xef\x64\x16\x2a\x65\x5c\xeb\xed\xb8\xf1\x12\x2f\x3b\x4d\xed\x53\x82\xfd\x0e\x1c\xf0\x22"
+"\x3e\x03\x32\x3a\x5c\xc3\x21\x03\xcd\x2e\xfd\xd8\x06\xf9\x11\x74\xfd\x21\x94\x35\xcd\x3b\xfd\xd0\xfe\xff\x20\x04\x3e\xd4\x18\x22"
+"\xfe\xfe\x20\x04\x3e\xd3\x18\x1a\xfe\xfd\x20\x04\x3e\xce\x18\x12\xfe\xd5\x0b\xe0\xed\x18\x0a\xfe\xfb\x20\x04\x3e\xec\x18\x02\xd6"
+"\x56\x37\x5b\x36\xf0\x07\x12\x13\x23\x10\xfa\xc9\xfe\x30\x3f\xd0\xfe\x3a\xd0\xd6\x30\x37\xc9\xc5\xd5\x46\x23\xbe\x02\x0b\xf0\x1a"
+"\x28\x08\x23\x10\xf6\x37\x3f\xd1\xc1\xc9\xeb\xd1\xc1\xcd\xee\x3f\x38\x02\xbf\xc9\xbf\x37\xc9\xe9\x00\x4d\x42\x00\x53\x42\x00\x41"
+"\x43\x00\x52\x47\x00\x4b\x4d\x00\x01"
+;
+unsigned char dump_amstrad_zx128k_0[16384];
+static const unsigned char dump_amstrad_zx128k_1_lz4[] =
+"\xf0\x05\xf3\xaf\x11\xff\xff\xc3\xcb\x11\x2a\x5d\x5c\x22\x5f\x5c\x18\x43\xc3\xf2\x15\xff\x01\x00\xf0\x04\x2a\x5d\x5c\x7e\xcd\x7d"
+"\x00\xd0\xcd\x74\x00\x18\xf7\xff\xff\xff\xc3\x5b\x33\x17\x00\xf1\x21\xff\xc5\x2a\x61\x5c\xe5\xc3\x9e\x16\xf5\xe5\x2a\x78\x5c\x23"
+"\x22\x78\x5c\x7c\xb5\x20\x03\xfd\x34\x40\xc5\xd5\xcd\x6e\x38\xd1\xc1\xe1\xf1\xfb\xc9\xe1\x6e\xfd\x75\x00\xed\x7b\x3d\x5c\xc3\xc5"
+"\x16\x34\x00\x60\xff\xff\xf5\xe5\x2a\xb0\x2a\x00\xf0\x60\x01\xe9\xe1\xf1\xed\x45\x2a\x5d\x5c\x23\x22\x5d\x5c\x7e\xc9\xfe\x21\xd0"
+"\xfe\x0d\xc8\xfe\x10\xd8\xfe\x18\x3f\xd8\x23\xfe\x16\x38\x01\x23\x37\x22\x5d\x5c\xc9\xbf\x52\x4e\xc4\x49\x4e\x4b\x45\x59\xa4\x50"
+"\xc9\x46\xce\x50\x4f\x49\x4e\xd4\x53\x43\x52\x45\x45\x4e\xa4\x41\x54\x54\xd2\x41\xd4\x54\x41\xc2\x56\x41\x4c\xa4\x43\x4f\x44\xc5"
+"\x56\x41\xcc\x4c\x45\xce\x53\x49\xce\x43\x4f\xd3\x54\x41\xce\x41\x53\xce\x41\x43\xd3\x41\x54\xce\x4c\xce\x45\x58\xd0\x38\x00\xf0"
+"\xd0\x51\xd2\x53\x47\xce\x41\x42\xd3\x50\x45\x45\xcb\x49\xce\x55\x53\xd2\x53\x54\x52\xa4\x43\x48\x52\xa4\x4e\x4f\xd4\x42\x49\xce"
+"\x4f\xd2\x41\x4e\xc4\x3c\xbd\x3e\xbd\x3c\xbe\x4c\x49\x4e\xc5\x54\x48\x45\xce\x54\xcf\x53\x54\x45\xd0\x44\x45\x46\x20\x46\xce\x43"
+"\x41\xd4\x46\x4f\x52\x4d\x41\xd4\x4d\x4f\x56\xc5\x45\x52\x41\x53\xc5\x4f\x50\x45\x4e\x20\xa3\x43\x4c\x4f\x53\x45\x20\xa3\x4d\x45"
+"\x52\x47\xc5\x56\x45\x52\x49\x46\xd9\x42\x45\x45\xd0\x43\x49\x52\x43\x4c\xc5\x49\x4e\xcb\x50\x41\x50\x45\xd2\x46\x4c\x41\x53\xc8"
+"\x42\x52\x49\x47\x48\xd4\x49\x4e\x56\x45\x52\x53\xc5\x4f\x56\x45\xd2\x4f\x55\xd4\x4c\x50\x52\x49\x4e\xd4\x4c\x4c\x49\x53\xd4\x53"
+"\x54\x4f\xd0\x52\x45\x41\xc4\x44\x41\x54\xc1\x52\x45\x53\x54\x4f\x52\xc5\x4e\x45\xd7\x42\x4f\x52\x44\x45\xd2\x43\x4f\x4e\x54\x49"
+"\x4e\x55\xc5\x44\x49\xcd\x52\x45\xcd\x46\x4f\xd2\x47\x4f\x20\x54\xcf\x47\x4f\x20\x53\x55\xc2\x49\x4e\x50\x55\xd4\x4c\x4f\x41\xc4"
+"\x45\x00\xf1\x01\x4c\x45\xd4\x50\x41\x55\x53\xc5\x4e\x45\x58\xd4\x50\x4f\x4b\xc5\x5f\x00\xf0\xff\x29\x50\x4c\x4f\xd4\x52\x55\xce"
+"\x53\x41\x56\xc5\x52\x41\x4e\x44\x4f\x4d\x49\x5a\xc5\x49\xc6\x43\x4c\xd3\x44\x52\x41\xd7\x43\x4c\x45\x41\xd2\x52\x45\x54\x55\x52"
+"\xce\x43\x4f\x50\xd9\x42\x48\x59\x36\x35\x54\x47\x56\x4e\x4a\x55\x37\x34\x52\x46\x43\x4d\x4b\x49\x38\x33\x45\x44\x58\x0e\x4c\x4f"
+"\x39\x32\x57\x53\x5a\x20\x0d\x50\x30\x31\x51\x41\xe3\xc4\xe0\xe4\xb4\xbc\xbd\xbb\xaf\xb0\xb1\xc0\xa7\xa6\xbe\xad\xb2\xba\xe5\xa5"
+"\xc2\xe1\xb3\xb9\xc1\xb8\x7e\xdc\xda\x5c\xb7\x7b\x7d\xd8\xbf\xae\xaa\xab\xdd\xde\xdf\x7f\xb5\xd6\x7c\xd5\x5d\xdb\xb6\xd9\x5b\xd7"
+"\x0c\x07\x06\x04\x05\x08\x0a\x0b\x09\x0f\xe2\x2a\x3f\xcd\xc8\xcc\xcb\x5e\xac\x2d\x2b\x3d\x2e\x2c\x3b\x22\xc7\x3c\xc3\x3e\xc5\x2f"
+"\xc9\x60\xc6\x3a\xd0\xce\xa8\xca\xd3\xd4\xd1\xd2\xa9\xcf\x2e\x2f\x11\xff\xff\x01\xfe\xfe\xed\x78\x2f\xe6\x1f\x28\x0e\x67\x7d\x14"
+"\xc0\xd6\x08\xcb\x3c\x30\xfa\x53\x5f\x20\xf4\x2d\xcb\x00\x38\xe6\x7a\x3c\xc8\xfe\x28\xc8\xfe\x19\xc8\x7b\x5a\x57\xfe\x18\xc9\xcd"
+"\x8e\x02\xc0\x21\x00\x5c\xcb\x7e\x20\x07\x23\x35\x2b\x20\x02\x36\xff\x7d\x21\x04\x5c\xbd\x20\xee\xcd\x1e\x03\xd0\x21\x00\x5c\xbe"
+"\x28\x2e\xeb\x21\x04\x5c\xbe\x28\x27\xcb\x7e\x20\x04\xeb\xcb\x7e\xc8\x5f\x77\x23\x36\x05\x23\x3a\x09\x5c\x77\x23\xfd\x4e\x07\xfd"
+"\x56\x01\xe5\xcd\x33\x03\xe1\x77\x32\x08\x5c\xfd\xcb\x01\xee\xc9\x1d\x00\xf0\xff\xc8\x35\xc0\x3a\x0a\x5c\x77\x23\x7e\x18\xea\x42"
+"\x16\x00\x7b\xfe\x27\xd0\xfe\x18\x20\x03\xcb\x78\xc0\x21\x05\x02\x19\x7e\x37\xc9\x7b\xfe\x3a\x38\x2f\x0d\xfa\x4f\x03\x28\x03\xc6"
+"\x4f\xc9\x21\xeb\x01\x04\x28\x03\x21\x05\x02\x16\x00\x19\x7e\xc9\x21\x29\x02\xcb\x40\x28\xf4\xcb\x5a\x28\x0a\xfd\xcb\x30\x5e\xc0"
+"\x04\xc0\xc6\x20\xc9\xc6\xa5\xc9\xfe\x30\xd8\x0d\xfa\x9d\x03\x20\x19\x21\x54\x02\xcb\x68\x28\xd3\xfe\x38\x30\x07\xd6\x20\x04\xc8"
+"\xc6\x08\xc9\xd6\x36\x04\xc8\xc6\xfe\xc9\x21\x30\x02\xfe\x39\x28\xba\xfe\x30\x28\xb6\xe6\x07\xc6\x80\x04\xc8\xee\x0f\xc9\x04\xc8"
+"\xcb\x68\x21\x30\x02\x20\xa4\xd6\x10\xfe\x22\x28\x06\xfe\x20\xc0\x3e\x5f\xc9\x3e\x40\xc9\xf3\x7d\xcb\x3d\xcb\x3d\x2f\xe6\x03\x4f"
+"\x06\x00\xdd\x21\xd1\x03\xdd\x09\x3a\x48\x5c\xe6\x38\x0f\x0f\x0f\xf6\x08\x00\x00\x00\x04\x0c\x0d\x20\xfd\x0e\x3f\x05\xc2\xd6\x03"
+"\xee\x10\xd3\xfe\x44\x4f\xcb\x67\x20\x09\x7a\xb3\x28\x09\x79\x4d\x1b\xdd\xe9\x4d\x0c\xdd\xe9\xfb\xc9\xef\x31\x27\xc0\x03\x34\xec"
+"\x6c\x98\x1f\xf5\x04\xa1\x0f\x38\x21\x92\x5c\x7e\xa7\x20\x5e\x23\x4e\x23\x46\x78\x17\x9f\xb9\x20\x54\x23\xbe\x20\x50\x78\xc6\x3c"
+"\xf2\x25\x04\xe2\x6c\x04\x06\xfa\x04\xd6\x0c\x30\xfb\xc6\x0c\xc5\x21\x6e\x04\xcd\x06\x34\xcd\xb4\x33\xef\x04\x38\xf1\x86\x77\xef"
+"\xc0\x02\x31\x38\xcd\x94\x1e\xfe\x0b\x30\x22\xef\xe0\x04\xe0\x34\x80\x43\x55\x9f\x80\x01\x05\x34\x35\x71\x03\x38\xcd\x99\x1e\xc5"
+"\xcd\x99\x1e\xe1\x50\x59\x7a\xb3\xc8\x1b\xc3\xb5\x03\xcf\x0a\x89\x02\xd0\x12\x86\x89\x0a\x97\x60\x75\x89\x12\xd5\x17\x1f\x89\x1b"
+"\x90\x41\x02\x89\x24\xd0\x53\xca\x89\x2e\x9d\x36\xb1\x89\x38\xff\x49\x3e\x89\x43\xff\x6a\x73\x89\x4f\xa7\x00\x54\x89\x5c\x00\x00"
+"\x00\x89\x69\x14\xf6\x24\x89\x76\xf1\x10\x05\xcd\xfb\x24\x3a\x3b\x5c\x87\xfa\x8a\x1c\xe1\xd0\xe5\xcd\xf1\x2b\x62\x6b\x0d\xf8\x09"
+"\xcb\xfe\xc9\x21\x3f\x05\xe5\x21\x80\x1f\xcb\x7f\x28\x03\x21\x98\x0c\x08\x13\xdd\x2b\xf3\x3e\x02\x47\x10\xfe\xd3\xfe\xee\x0f\x06"
+"\xa4\x2d\x20\xf5\x05\x25\xf2\xd8\x04\x06\x2f\x12\x00\x40\x3e\x0d\x06\x37\x08\x00\xf0\x15\x01\x0e\x3b\x08\x6f\xc3\x07\x05\x7a\xb3"
+"\x28\x0c\xdd\x6e\x00\x7c\xad\x67\x3e\x01\x37\xc3\x25\x05\x6c\x18\xf4\x79\xcb\x78\x10\xfe\x30\x04\x06\x42\x28\x00\xf4\x13\x06\x3e"
+"\x20\xef\x05\xaf\x3c\xcb\x15\xc2\x14\x05\x1b\xdd\x23\x06\x31\x3e\x7f\xdb\xfe\x1f\xd0\x7a\x3c\xc2\xfe\x04\x06\x3b\x10\xfe\xc9\xf5"
+"\x79\x01\x21\xd3\xfe\x1b\x00\xf0\x00\xfb\x38\x02\xcf\x0c\xf1\xc9\x14\x08\x15\xf3\x3e\x0f\xd3\xfe\x9c\x00\xf0\x11\xdb\xfe\x1f\xe6"
+"\x20\xf6\x02\x4f\xbf\xc0\xcd\xe7\x05\x30\xfa\x21\x15\x04\x10\xfe\x2b\x7c\xb5\x20\xf9\xcd\xe3\x05\x30\xeb\x06\x9c\x07\x00\xb0\xe4"
+"\x3e\xc6\xb8\x30\xe0\x24\x20\xf1\x06\xc9\x25\x00\xf0\x3e\xd5\x78\xfe\xd4\x30\xf4\xcd\xe7\x05\xd0\x79\xee\x03\x4f\x26\x00\x06\xb0"
+"\x18\x1f\x08\x20\x07\x30\x0f\xdd\x75\x00\x18\x0f\xcb\x11\xad\xc0\x79\x1f\x4f\x13\x18\x07\xdd\x7e\x00\xad\xc0\xdd\x23\x1b\x08\x06"
+"\xb2\x2e\x01\xcd\xe3\x05\xd0\x3e\xcb\xb8\xcb\x15\x06\xb0\xd2\xca\x05\x7c\xad\x67\x7a\xb3\x20\xca\x7c\xfe\x01\x52\x00\x91\xd0\x3e"
+"\x16\x3d\x20\xfd\xa7\x04\xc8\xa5\x00\xf0\x39\xd0\xa9\xe6\x20\x28\xf3\x79\x2f\x4f\xe6\x07\xf6\x08\xd3\xfe\x37\xc9\xf1\x3a\x74\x5c"
+"\xd6\xe0\x32\x74\x5c\xcd\x8c\x1c\xcd\x30\x25\x28\x3c\x01\x11\x00\x3a\x74\x5c\xa7\x28\x02\x0e\x22\xf7\xd5\xdd\xe1\x06\x0b\x3e\x20"
+"\x12\x13\x10\xfc\xdd\x36\x01\xff\xcd\xf1\x2b\x21\xf6\xff\x0b\x09\x03\x30\x0f\x23\x00\xf0\x1a\x20\x02\xcf\x0e\x78\xb1\x28\x0a\x01"
+"\x0a\x00\xdd\xe5\xe1\x23\xeb\xed\xb0\xdf\xfe\xe4\x20\x49\x3a\x74\x5c\xfe\x03\xca\x8a\x1c\xe7\xcd\xb2\x28\xcb\xf9\x30\x0b\x21\x00"
+"\x51\x00\x71\x3d\x28\x15\xcf\x01\xc2\x8a\x64\x00\x60\x18\x23\x7e\xdd\x77\x0b\x05\x00\xf6\x12\x0c\x23\xdd\x71\x0e\x3e\x01\xcb\x71"
+"\x28\x01\x3c\xdd\x77\x00\xeb\xe7\xfe\x29\x20\xda\xe7\xcd\xee\x1b\xeb\xc3\x5a\x07\xfe\xaa\x20\x1f\x4d\x00\xf6\x0a\xee\x1b\xdd\x36"
+"\x0b\x00\xdd\x36\x0c\x1b\x21\x00\x40\xdd\x75\x0d\xdd\x74\x0e\x18\x4d\xfe\xaf\x20\x4f\x23\x00\x40\x48\x20\x20\x0c\x99\x00\xf8\x00"
+"\xca\x8a\x1c\xcd\xe6\x1c\x18\x0f\xcd\x82\x1c\xdf\xfe\x2c\x28\x14\x00\xf1\x02\x04\xe7\xcd\x82\x1c\xcd\xee\x1b\xcd\x99\x1e\xdd\x71"
+"\x0b\xdd\x70\x0c\x09\x00\xf0\x02\x0d\xdd\x70\x0e\x60\x69\xdd\x36\x00\x03\x18\x44\xfe\xca\x28\x09\xcd\x6d\x00\x40\x0e\x80\x18\x17"
+"\x4e\x00\x10\xc2\xcb\x00\x06\x35\x00\x00\x2c\x00\xf0\x08\xdd\x36\x00\x00\x2a\x59\x5c\xed\x5b\x53\x5c\x37\xed\x52\xdd\x75\x0b\xdd"
+"\x74\x0c\x2a\x4b\x5c\x0b\x00\x50\x0f\xdd\x74\x10\xeb\x37\x00\xf1\x50\xca\x70\x09\xe5\x01\x11\x00\xdd\x09\xdd\xe5\x11\x11\x00\xaf"
+"\x37\xcd\x56\x05\xdd\xe1\x30\xf2\x3e\xfe\xcd\x01\x16\xfd\x36\x52\x03\x0e\x80\xdd\x7e\x00\xdd\xbe\xef\x20\x02\x0e\xf6\xfe\x04\x30"
+"\xd9\x11\xc0\x09\xc5\xcd\x0a\x0c\xc1\xdd\xe5\xd1\x21\xf0\xff\x19\x06\x0a\x7e\x3c\x20\x03\x79\x80\x4f\x13\x1a\xbe\x23\x20\x01\x0c"
+"\xd7\x10\xf6\xcb\x79\x20\xb3\x3e\x0d\xd7\xe1\xdd\x7e\x00\xfe\x03\xd6\x00\xf0\x10\x3d\xca\x08\x08\xfe\x02\xca\xb6\x08\xe5\xdd\x6e"
+"\xfa\xdd\x66\xfb\xdd\x5e\x0b\xdd\x56\x0c\x7c\xb5\x28\x0d\xed\x52\x38\x26\x28\x25\x02\xf0\x03\xfe\x03\x20\x1d\xe1\x7c\xb5\x20\x06"
+"\xdd\x6e\x0d\xdd\x66\x0e\xe5\xdd\xe1\x30\x01\xd2\x02\x37\x20\x01\xa7\x3e\xff\xcd\x56\x05\xd8\xcf\x1a\x36\x00\x10\xe5\x25\x00\x62"
+"\x13\x13\x13\xeb\x18\x0c\x4d\x00\xf0\x00\xeb\x37\xed\x52\x38\x09\x11\x05\x00\x19\x44\x4d\xcd\x05\x1f\x77\x00\xf0\x16\xa7\x28\x3e"
+"\x7c\xb5\x28\x13\x2b\x46\x2b\x4e\x2b\x03\x03\x03\xdd\x22\x5f\x5c\xcd\xe8\x19\xdd\x2a\x5f\x5c\x2a\x59\x5c\x2b\xdd\x4e\x0b\xdd\x46"
+"\x0c\xc5\x19\x00\xf1\x0a\x7e\xfd\xf5\xcd\x55\x16\x23\xf1\x77\xd1\x23\x73\x23\x72\x23\xe5\xdd\xe1\x37\x3e\xff\xc3\x02\x08\xeb\x28"
+"\x00\x33\x22\x5f\x5c\x2c\x00\x90\xcd\xe5\x19\xc1\xe5\xc5\xcd\x55\x16\x44\x00\xf4\x0f\x23\xdd\x4e\x0f\xdd\x46\x10\x09\x22\x4b\x5c"
+"\xdd\x66\x0e\x7c\xe6\xc0\x20\x0a\xdd\x6e\x0d\x22\x42\x5c\xfd\x36\x0a\x00\xd1\x43\x00\x03\x3a\x00\x72\x03\xf7\x36\x80\xeb\xd1\xe5"
+"\x5a\x00\x40\xcd\x02\x08\xe1\x8d\x01\xf0\x46\x7e\xe6\xc0\x20\x19\x1a\x13\xbe\x23\x20\x02\x1a\xbe\x1b\x2b\x30\x08\xe5\xeb\xcd\xb8"
+"\x19\xe1\x18\xec\xcd\x2c\x09\x18\xe2\x7e\x4f\xfe\x80\xc8\xe5\x2a\x4b\x5c\x7e\xfe\x80\x28\x25\xb9\x28\x08\xc5\xcd\xb8\x19\xc1\xeb"
+"\x18\xf0\xe6\xe0\xfe\xa0\x20\x12\xd1\xd5\xe5\x23\x13\x1a\xbe\x20\x06\x17\x30\xf7\xe1\x18\x03\xe1\x18\xe0\x3e\xff\xd1\xeb\x3c\x37"
+"\x3c\x00\x70\xc4\x20\x10\x08\x22\x5f\x5c\x4e\x00\xf0\x0a\xcd\xe8\x19\xeb\x2a\x5f\x5c\x08\x08\xd5\xcd\xb8\x19\x22\x5f\x5c\x2a\x53"
+"\x5c\xe3\xc5\x08\x38\x07\x2b\xf1\x00\x20\x18\x03\x06\x00\xf2\x1c\xc1\xd1\xed\x53\x53\x5c\xed\x5b\x5f\x5c\xc5\xd5\xeb\xed\xb0\xe1"
+"\xc1\xd5\xcd\xe8\x19\xd1\xc9\xe5\x3e\xfd\xcd\x01\x16\xaf\x11\xa1\x09\xcd\x0a\x0c\xfd\xcb\x02\xee\xcd\xd4\x15\x1d\x02\xa2\xcd\xc2"
+"\x04\xdd\xe1\x06\x32\x76\x10\xfd\x8c\x01\xf7\x39\x3e\xff\xdd\xe1\xc3\xc2\x04\x80\x53\x74\x61\x72\x74\x20\x74\x61\x70\x65\x2c\x20"
+"\x74\x68\x65\x6e\x20\x70\x72\x65\x73\x73\x20\x61\x6e\x79\x20\x6b\x65\x79\xae\x0d\x50\x72\x6f\x67\x72\x61\x6d\x3a\xa0\x0d\x4e\x75"
+"\x6d\x62\x65\x72\x20\x61\x72\x72\x61\x79\x3a\xa0\x0d\x43\x68\x61\x72\x61\x63\x74\x12\x00\xf0\x53\x42\x79\x74\x65\x73\x3a\xa0\xcd"
+"\x03\x0b\xfe\x20\xd2\xd9\x0a\xfe\x06\x38\x69\xfe\x18\x30\x65\x21\x0b\x0a\x5f\x16\x00\x19\x5e\x19\xe5\xc3\x03\x0b\x4e\x57\x10\x29"
+"\x54\x53\x52\x37\x50\x4f\x5f\x5e\x5d\x5c\x5b\x5a\x54\x53\x0c\x3e\x22\xb9\x20\x11\xfd\xcb\x01\x4e\x20\x09\x04\x0e\x02\x3e\x18\xb8"
+"\x20\x03\x05\x0e\x21\xc3\xd9\x0d\x3a\x91\x5c\xf5\xfd\x36\x57\x01\x3e\x20\xcd\x65\x0b\xf1\x32\x91\x5c\xc9\x26\x00\xf0\x18\xc2\xcd"
+"\x0e\x0e\x21\xcd\x55\x0c\x05\xc3\xd9\x0d\xcd\x03\x0b\x79\x3d\x3d\xe6\x10\x18\x5a\x3e\x3f\x18\x6c\x11\x87\x0a\x32\x0f\x5c\x18\x0b"
+"\x11\x6d\x0a\x18\x03\x0d\x00\xf0\x16\x0e\x5c\x2a\x51\x5c\x73\x23\x72\xc9\x11\xf4\x09\xcd\x80\x0a\x2a\x0e\x5c\x57\x7d\xfe\x16\xda"
+"\x11\x22\x20\x29\x44\x4a\x3e\x1f\x91\x38\x0c\xc6\x02\x4f\x54\x00\xf1\x26\x20\x16\x3e\x16\x90\xda\x9f\x1e\x3c\x47\x04\xfd\xcb\x02"
+"\x46\xc2\x55\x0c\xfd\xbe\x31\xda\x86\x0c\xc3\xd9\x0d\x7c\xcd\x03\x0b\x81\x3d\xe6\x1f\xc8\x57\xfd\xcb\x01\xc6\x3e\x20\xcd\x3b\x0c"
+"\x15\x20\xf8\xc9\xcd\x24\x0b\x39\x00\x10\x1a\x30\x00\xf2\x0c\x20\x08\xed\x43\x88\x5c\x22\x84\x5c\xc9\xed\x43\x8a\x5c\xed\x43\x82"
+"\x5c\x22\x86\x5c\xc9\xfd\x71\x45\x22\x80\xb4\x00\x90\x20\x14\xed\x4b\x88\x5c\x2a\x84\x5c\x2e\x00\x60\xc8\xed\x4b\x8a\x5c\x2a\x21"
+"\x00\xf0\x17\x4e\x45\x2a\x80\x5c\xc9\xfe\x80\x38\x3d\xfe\x90\x30\x26\x47\xcd\x38\x0b\xcd\x03\x0b\x11\x92\x5c\x18\x47\x21\x92\x5c"
+"\xcd\x3e\x0b\xcb\x18\x9f\xe6\x0f\x4f\x06\x00\xf1\x2f\xf0\xb1\x0e\x04\x77\x23\x0d\x20\xfb\xc9\xc3\x9f\x3b\x00\xc6\x15\xc5\xed\x4b"
+"\x7b\x5c\x18\x0b\xcd\x10\x0c\xc3\x03\x0b\xc5\xed\x4b\x36\x5c\xeb\x21\x3b\x5c\xcb\x86\xfe\x20\x20\x02\xcb\xc6\x26\x00\x6f\x29\x29"
+"\x29\x09\xc1\xeb\x79\x3d\x3e\x21\x20\x0e\x05\xe4\x00\xf0\x11\x28\x06\xd5\xcd\xcd\x0e\xd1\x79\xb9\xd5\xcc\x55\x0c\xd1\xc5\xe5\x3a"
+"\x91\x5c\x06\xff\x1f\x38\x01\x04\x1f\x1f\x9f\x4f\x3e\x08\xa7\xcf\x00\xf0\x09\x28\x05\xfd\xcb\x30\xce\x37\xeb\x08\x1a\xa0\xae\xa9"
+"\x12\x08\x38\x13\x14\x23\x3d\x20\xf2\xeb\x25\x1c\x00\xf1\x7a\xcc\xdb\x0b\xe1\xc1\x0d\x23\xc9\x08\x3e\x20\x83\x5f\x08\x18\xe6\x7c"
+"\x0f\x0f\x0f\xe6\x03\xf6\x58\x67\xed\x5b\x8f\x5c\x7e\xab\xa2\xab\xfd\xcb\x57\x76\x28\x08\xe6\xc7\xcb\x57\x20\x02\xee\x38\xfd\xcb"
+"\x57\x66\x28\x08\xe6\xf8\xcb\x6f\x20\x02\xee\x07\x77\xc9\xe5\x26\x00\xe3\x18\x04\x11\x95\x00\xf5\xcd\x41\x0c\x38\x09\x3e\x20\xfd"
+"\xcb\x01\x46\xcc\x3b\x0c\x1a\xe6\x7f\xcd\x3b\x0c\x1a\x13\x87\x30\xf5\xd1\xfe\x48\x28\x03\xfe\x82\xd8\x7a\xfe\x03\xd8\x3e\x20\xd5"
+"\xd9\xd7\xd9\xd1\xc9\xf5\xeb\x3c\xcb\x7e\x23\x28\xfb\x3d\x20\xf8\xeb\xf1\xfe\x20\xd8\x1a\xd6\x41\x06\x02\x60\xc0\x11\xd9\x0d\xd5"
+"\x78\x4f\x01\xf0\x0e\xc2\x02\x0d\xfd\xbe\x31\x38\x1b\xc0\xfd\xcb\x02\x66\x28\x16\xfd\x5e\x2d\x1d\x28\x5a\x3e\x00\xcd\x01\x16\xed"
+"\x7b\x3f\x71\x01\xf0\x03\xa6\xc9\xcf\x04\xfd\x35\x52\x20\x45\x3e\x18\x90\x32\x8c\x5c\x2a\x8f\x5c\xfc\x00\x13\xf5\x2a\x03\x23\xf8"
+"\x0c\x2a\x03\x00\x40\x01\xf1\x07\xde\xcb\xae\xd9\xcd\xd4\x15\xd9\xfe\x20\x28\x45\xfe\xe2\x28\x41\xf6\x20\xfe\x6e\x28\x3b\x50\x05"
+"\x00\x80\x02\xf5\x02\xe1\x22\x8f\x5c\xcd\xfe\x0d\xfd\x46\x31\x04\x0e\x21\xc5\xcd\x9b\x0e\x04\x01\xf0\x19\x11\xe0\x5a\x1a\x4e\x06"
+"\x20\xeb\x12\x71\x13\x23\x10\xfa\xc1\xc9\x80\x73\x63\x72\x6f\x6c\x6c\xbf\xcf\x0c\xfe\x02\x38\x80\xfd\x86\x31\xd6\x19\xd0\xed\x44"
+"\xc5\x47\x7d\x00\xf0\x15\x2a\x91\x5c\xe5\xcd\x4d\x0d\x78\xf5\x21\x6b\x5c\x46\x78\x3c\x77\x21\x89\x5c\xbe\x38\x03\x34\x06\x18\xcd"
+"\x00\x0e\xf1\x3d\x20\xe8\xe1\xfd\x75\x57\x6a\x00\x00\x33\x02\xf0\x01\xfd\xcb\x02\x86\xcd\xd9\x0d\xfd\xcb\x02\xc6\xc1\xc9\xaf\x2a"
+"\x8d\xd0\x00\xf0\x14\x46\x28\x04\x67\xfd\x6e\x0e\x22\x8f\x5c\x21\x91\x5c\x20\x02\x7e\x0f\xae\xe6\x55\xae\x77\xc9\xcd\xaf\x0d\x21"
+"\x3c\x5c\xcb\xae\xcb\xc6\xcd\x4d\xa3\x00\xf1\x0a\xcd\x44\x0e\x21\xc0\x5a\x3a\x8d\x5c\x05\x18\x07\x0e\x20\x2b\x77\x0d\x20\xfb\x10"
+"\xf7\xfd\x36\x31\x02\xf9\x00\x70\x2a\x51\x5c\x11\xf4\x09\xa7\x3a\x05\xf1\x09\x11\xa8\x10\x3f\x38\xf6\x01\x21\x17\x18\x2a\x21\x00"
+"\x00\x22\x7d\x5c\xfd\xcb\x30\x86\xcd\x94\x0d\xf7\x00\x82\xcd\x4d\x0d\x06\x18\xcd\x44\x0e\x30\x00\xd0\x73\x23\x72\xfd\x36\x52\x01"
+"\x01\x21\x18\x21\x00\x5b\x15\x02\x21\x20\x12\x84\x01\x20\x28\x05\xe3\x00\xa0\x18\xc5\x47\xcd\x9b\x0e\xc1\x3e\x21\x91\xf0\x03\xf1"
+"\x31\xc3\xdc\x0a\x06\x17\xcd\x9b\x0e\x0e\x08\xc5\xe5\x78\xe6\x07\x78\x20\x0c\xeb\x21\xe0\xf8\x19\xeb\x01\x20\x00\x3d\xed\xb0\xeb"
+"\x21\xe0\xff\x19\xeb\x47\xe6\x07\x0f\x0f\x0f\x4f\x78\x06\x00\xed\xb0\x06\x07\x09\xe6\xf8\x20\xdb\xe1\x24\xc1\x0d\x20\xcd\xcd\x88"
+"\x0e\x21\x00\x40\xed\xb0\x06\x01\x69\x01\x03\x45\x00\x03\x2d\x00\xf1\x03\x0d\x54\x5d\x36\x00\x13\xed\xb0\x11\x01\x07\x19\x3d\xe6"
+"\xf8\x47\x20\xe5\x36\x00\x83\xdc\xcd\x88\x0e\x62\x6b\x13\x3a\x26\x01\xc0\x03\x3a\x48\x5c\x77\x0b\xed\xb0\xc1\x0e\x21\xc9\xa9\x01"
+"\x80\x3d\xf6\x50\x67\xeb\x61\x68\x29\x01\x00\x70\x44\x4d\xc9\x3e\x18\x90\x57\xc3\x02\xf1\x21\xe0\x6f\x7a\xe6\x18\xf6\x40\x67\xc9"
+"\xf3\x06\xb0\x21\x00\x40\xe5\xc5\xcd\xf4\x0e\xc1\xe1\x24\x7c\xe6\x07\x20\x0a\x7d\xc6\x20\x6f\x3f\x9f\xe6\xf8\x84\x67\x10\xe7\x18"
+"\x0d\xf3\x21\x00\x5b\x06\x08\x20\x00\x70\x10\xf9\x3e\x04\xd3\xfb\xfb\x06\x01\xc1\x75\x46\xaf\x47\x77\x23\x10\xfc\xfd\xcb\x30\x8e"
+"\xb7\x04\xe1\x78\xfe\x03\x9f\xe6\x02\xd3\xfb\x57\xcd\x54\x1f\x38\x0a\x28\x00\xf0\x6b\xcd\xdf\x0e\xcf\x0c\xdb\xfb\x87\xf8\x30\xeb"
+"\x0e\x20\x5e\x23\x06\x08\xcb\x12\xcb\x13\xcb\x1a\xdb\xfb\x1f\x30\xfb\x7a\xd3\xfb\x10\xf0\x0d\x20\xe9\xc9\x2a\x3d\x5c\xe5\x21\x7f"
+"\x10\xe5\xed\x73\x3d\x5c\xcd\xd4\x15\xf5\x16\x00\xfd\x5e\xff\x21\xc8\x00\xcd\xb5\x03\xf1\x21\x38\x0f\xe5\xfe\x18\x30\x31\xfe\x07"
+"\x38\x2d\xfe\x10\x38\x3a\x01\x02\x00\x57\xfe\x16\x38\x0c\x03\xfd\xcb\x37\x7e\xca\x1e\x10\xcd\xd4\x15\x5f\xcd\xd4\x15\xd5\x2a\x5b"
+"\x5c\xfd\xcb\x07\x86\xcd\x55\x16\xc1\x23\x70\x23\x71\x18\x0a\x0e\x00\xf0\x04\x2a\x5b\x5c\xcd\x52\x16\x12\x13\xed\x53\x5b\x5c\xc9"
+"\x5f\x16\x00\x21\x99\x0f\x8e\x05\xf0\x14\x2a\x5b\x5c\xc9\x09\x66\x6a\x50\xb5\x70\x7e\xcf\xd4\x2a\x49\x5c\xfd\xcb\x37\x6e\xc2\x97"
+"\x10\xcd\x6e\x19\xcd\x95\x16\x7a\xb3\xca\x97\x10\xe5\xb1\x0b\x41\x21\x0a\x00\x09\x9e\x07\xf0\x18\xcd\x97\x10\x2a\x51\x5c\xe3\xe5"
+"\x3e\xff\xcd\x01\x16\xe1\x2b\xfd\x35\x0f\xcd\x55\x18\xfd\x34\x0f\x2a\x59\x5c\x23\x23\x23\x23\x22\x5b\x5c\xe1\xcd\x15\x16\xc9\x47"
+"\x00\xf0\x0a\x20\x08\x21\x49\x5c\xcd\x0f\x19\x18\x6d\xfd\x36\x00\x10\x18\x1d\xcd\x31\x10\x18\x05\x7e\xfe\x0d\xc8\x26\x00\xf1\x35"
+"\xc9\xcd\x31\x10\x01\x01\x00\xc3\xe8\x19\xcd\xd4\x15\xcd\xd4\x15\xe1\xe1\xe1\x22\x3d\x5c\xfd\xcb\x00\x7e\xc0\xf9\xc9\x37\xcd\x95"
+"\x11\xed\x52\x19\x23\xc1\xd8\xc5\x44\x4d\x62\x6b\x23\x1a\xe6\xf0\xfe\x10\x20\x09\x23\x1a\xd6\x17\xce\x00\x20\x01\x23\xa7\xed\x42"
+"\x09\xeb\x38\xe6\x66\x00\xf0\x0a\xc0\x2a\x49\x5c\xcd\x6e\x19\xeb\xcd\x95\x16\x21\x4a\x5c\xcd\x1c\x19\xcd\x95\x17\x3e\x00\xc3\x01"
+"\x16\x15\x01\xf0\x00\x28\xa8\xc3\x81\x0f\xfd\xcb\x30\x66\x28\xa1\xfd\x36\x00\xff\x4d\x01\xf0\x13\xfe\x21\x90\x1a\xcd\xb5\x03\xc3"
+"\x30\x0f\xe5\xcd\x90\x11\x2b\xcd\xe5\x19\x22\x5b\x5c\xfd\x36\x07\x00\xe1\xc9\xfd\xcb\x02\x5e\xc4\x1d\x11\x05\x05\x31\x6e\xc8\x3a"
+"\xad\x0d\xf0\x4d\xae\xf5\xfd\xcb\x02\x6e\xc4\x6e\x0d\xf1\xfe\x20\x30\x52\xfe\x10\x30\x2d\xfe\x06\x30\x0a\x47\xe6\x01\x4f\x78\x1f"
+"\xc6\x12\x18\x2a\x20\x09\x21\x6a\x5c\x3e\x08\xae\x77\x18\x0e\xfe\x0e\xd8\xd6\x0d\x21\x41\x5c\xbe\x77\x20\x02\x36\x00\xfd\xcb\x02"
+"\xde\xbf\xc9\x47\xe6\x07\x4f\x3e\x10\xcb\x58\x20\x01\x3c\xfd\x71\xd3\x11\x0d\x11\x18\x06\x3a\x0d\x5c\x11\xa8\x10\x2a\x4f\x5c\x23"
+"\xb2\x08\x20\x37\xc9\xa8\x03\xb1\xcb\x02\x9e\xfd\xcb\x02\xae\x2a\x8a\x5c\xe5\x00\x02\x21\x67\x11\x00\x02\x40\x2a\x82\x5c\xe5\x0b"
+"\x01\xf7\x18\xeb\xcd\x7d\x18\xeb\xcd\xe1\x18\x2a\x8a\x5c\xe3\xeb\xcd\x4d\x0d\x3a\x8b\x5c\x92\x38\x26\x20\x06\x7b\xfd\x96\x50\x30"
+"\x1e\x3e\x20\xd5\xcd\xf4\x09\xd1\x18\xe9\xde\x00\x00\xed\x00\x71\xed\x5b\x8a\x5c\x18\x02\xd1\x58\x01\xf1\x07\xc1\xd5\xcd\xd9\x0d"
+"\xe1\x22\x82\x5c\xfd\x36\x26\x00\xc9\x2a\x61\x5c\x2b\xa7\xed\x5b\x59\xed\x01\xf1\x29\xc8\xed\x5b\x61\x5c\xd8\x2a\x63\x5c\xc9\x7e"
+"\xfe\x0e\x01\x06\x00\xcc\xe8\x19\x7e\x23\xfe\x0d\x20\xf1\xc9\xf3\x3e\xff\xed\x5b\xb2\x5c\xd9\xed\x4b\xb4\x5c\xed\x5b\x38\x5c\x2a"
+"\x7b\x5c\xd9\x47\x3e\x07\xd3\xfe\x3e\x3f\xed\x47\x00\x01\x00\x90\x62\x6b\x36\x02\x2b\xbc\x20\xfa\xa7\xae\x01\xf0\x63\x30\x06\x35"
+"\x28\x03\x35\x28\xf3\x2b\xd9\xed\x43\xb4\x5c\xed\x53\x38\x5c\x22\x7b\x5c\xd9\x04\x28\x19\x22\xb4\x5c\x11\xaf\x3e\x01\xa8\x00\xeb"
+"\xed\xb8\xeb\x23\x22\x7b\x5c\x2b\x01\x40\x00\xed\x43\x38\x5c\x22\xb2\x5c\x21\x00\x3c\x22\x36\x5c\x2a\xb2\x5c\x36\x3e\x2b\xf9\x2b"
+"\x2b\x22\x3d\x5c\xed\x56\xfd\x21\x3a\x5c\xfb\x21\xb6\x5c\x22\x4f\x5c\x11\xaf\x15\x01\x15\x00\xeb\xed\xb0\xeb\x2b\x22\x57\x5c\x23"
+"\x22\x53\x5c\x22\x4b\x5c\x36\x80\x23\x22\x59\x5c\x36\x0d\x23\x09\x00\xf0\x22\x61\x5c\x22\x63\x5c\x22\x65\x5c\x3e\x38\x32\x8d\x5c"
+"\x32\x8f\x5c\x32\x48\x5c\x21\x23\x05\x22\x09\x5c\xfd\x35\xc6\xfd\x35\xca\x21\xc6\x15\x11\x10\x5c\x01\x0e\x00\xed\xb0\xfd\xcb\x01"
+"\xce\xcd\xdf\x0e\xfe\x04\x73\xcd\x6b\x0d\xaf\x11\x38\x15\xf5\x05\x21\x18\x07\x14\x00\x51\x95\x17\xcd\xb0\x16\x34\x06\x60\xcd\x2c"
+"\x0f\xcd\x17\x1b\x8d\x02\x21\x20\x12\x3e\x02\x70\x40\x2a\x59\x5c\xcd\xa7\x11\x57\x01\xf0\x17\x18\xdd\x2a\x59\x5c\x22\x5d\x5c\xcd"
+"\xfb\x19\x78\xb1\xc2\x5d\x15\xdf\xfe\x0d\x28\xc0\xfd\xcb\x30\x46\xc4\xaf\x0d\xcd\x6e\x0d\x3e\x19\xfd\x96\x4f\x32\x8c\xe9\x0f\x10"
+"\xfe\x2f\x00\xf0\x1d\xfd\x36\x0a\x01\xcd\x8a\x1b\x76\xfd\xcb\x01\xae\xfd\xcb\x30\x4e\xc4\xcd\x0e\x3a\x3a\x5c\x3c\xf5\x21\x00\x00"
+"\xfd\x74\x37\xfd\x74\x26\x22\x0b\x5c\x21\x01\x00\x22\x16\x5c\xcd\xb0\xb3\x02\x30\xae\xcd\x6e\xe9\x05\xf0\x23\xee\xf1\x47\xfe\x0a"
+"\x38\x02\xc6\x07\xcd\xef\x15\x3e\x20\xd7\x78\x11\x91\x13\xcd\x0a\x0c\xcd\x3b\x3b\x00\xcd\x0a\x0c\xed\x4b\x45\x5c\xcd\x1b\x1a\x3e"
+"\x3a\xd7\xfd\x4e\x0d\x06\x00\xcd\x1b\x1a\xcd\x97\x10\x56\x00\x80\x28\x1b\xfe\x09\x28\x04\xfe\x15\x2e\x13\xf3\x4e\x0d\x01\x03\x00"
+"\x11\x70\x5c\x21\x44\x5c\xcb\x7e\x28\x01\x09\xed\xb8\xfd\x36\x0a\xff\xfd\xcb\x01\x9e\xc3\xac\x12\x80\x4f\xcb\x4e\x45\x58\x54\x20"
+"\x77\x69\x74\x68\x6f\x75\x74\x20\x46\x4f\xd2\x56\x61\x72\x69\x61\x62\x6c\x65\x20\x6e\x6f\x74\x20\x66\x6f\x75\x6e\xe4\x53\x75\x62"
+"\x73\x63\x72\x69\x70\x74\x20\x77\x72\x6f\x6e\xe7\x4f\x75\x74\x20\x6f\x66\x20\x6d\x65\x6d\x6f\x72\xf9\x0d\x00\x63\x73\x63\x72\x65"
+"\x65\xee\x13\x0a\x71\x74\x6f\x6f\x20\x62\x69\xe7\xf2\x11\x15\x4e\x5b\x00\x80\x47\x4f\x53\x55\xc2\x45\x6e\x64\x3c\x00\xf2\x0f\x66"
+"\x69\x6c\xe5\x53\x54\x4f\x50\x20\x73\x74\x61\x74\x65\x6d\x65\x6e\xf4\x49\x6e\x76\x61\x6c\x69\x64\x20\x61\x72\x67\x75\x10\x00\x60"
+"\x74\x65\x67\x65\x72\x20\x95\x00\xf0\x12\x6f\x66\x20\x72\x61\x6e\x67\xe5\x4e\x6f\x6e\x73\x65\x6e\x73\x65\x20\x69\x6e\x20\x42\x41"
+"\x53\x49\xc3\x42\x52\x45\x41\x4b\x20\x2d\x20\xbc\x12\x83\x20\x72\x65\x70\x65\x61\x74\xf3\x91\x00\x00\xe3\x12\x04\x54\x00\x20\x66"
+"\x69\xce\x00\xf2\x03\x61\x6d\xe5\x4e\x6f\x20\x72\x6f\x6f\x6d\x20\x66\x6f\x72\x20\x6c\x69\x6e\x83\x00\x31\x69\x6e\x20\xe0\x12\x35"
+"\x46\x4f\x52\xac\x00\x00\xdc\x12\x04\x3e\x00\xa4\x49\x2f\x4f\x20\x64\x65\x76\x69\x63\xe5\x12\x00\x62\x63\x6f\x6c\x6f\x75\xf2\x7d"
+"\x00\x61\x69\x6e\x74\x6f\x20\x70\x15\x0b\x40\xed\x52\x41\x4d\xd4\x00\x83\x6e\x6f\x20\x67\x6f\x6f\xe4\x53\xdb\x00\x55\x74\x20\x6c"
+"\x6f\x73\xe0\x00\x76\x73\x74\x72\x65\x61\xed\x46\x17\x01\x90\x44\x45\xc6\x50\x61\x72\x61\x6d\x65\x3b\x0b\xf1\x03\x65\x72\x72\x6f"
+"\xf2\x54\x61\x70\x65\x20\x6c\x6f\x61\x64\x69\x6e\x67\x20\x12\x00\xf0\x25\x2c\xa0\x7f\x20\x31\x39\x38\x32\x20\x53\x69\x6e\x63\x6c"
+"\x61\x69\x72\x20\x52\x65\x73\x65\x61\x72\x63\x68\x20\x4c\x74\xe4\x3e\x10\x01\x00\x00\xc3\x13\x13\xed\x43\x49\x5c\x2a\x5d\x5c\xeb"
+"\x21\x55\x15\xe5\x2a\x61\x27\x0e\xf0\x05\xe5\x60\x69\xcd\x6e\x19\x20\x06\xcd\xb8\x19\xcd\xe8\x19\xc1\x79\x3d\xb0\x28\x28\x2d\x0d"
+"\x20\x03\x2b\xbb\x0c\xb0\xd5\xcd\x55\x16\xe1\x22\x53\x5c\xc1\xc5\x13\x08\x04\xf0\x13\x2b\xed\xb8\x2a\x49\x5c\xeb\xc1\x70\x2b\x71"
+"\x2b\x73\x2b\x72\xf1\xc3\xa2\x12\xf4\x09\xa8\x10\x4b\xf4\x09\xc4\x15\x53\x81\x0f\xc4\x15\x52\x0a\x00\xc0\x50\x80\xcf\x12\x01\x00"
+"\x06\x00\x0b\x00\x01\x00\x08\x00\x10\x10\xe0\x04\x20\x6e\x20\x28\x0b\xf1\x06\xde\xcd\xe6\x15\xd8\x28\xfa\xcf\x07\xd9\xe5\x2a\x51"
+"\x5c\x23\x23\x18\x08\x1e\x30\x83\x0c\x00\xf0\x11\x5e\x23\x56\xeb\xcd\x2c\x16\xe1\xd9\xc9\x87\xc6\x16\x6f\x26\x5c\x5e\x23\x56\x7a"
+"\xb3\x20\x02\xcf\x17\x1b\x2a\x4f\x5c\x19\x22\x51\x63\x08\x10\xa6\x35\x06\xf0\x04\x4e\x21\x2d\x16\xcd\xdc\x16\xd0\x16\x00\x5e\x19"
+"\xe9\x4b\x06\x53\x12\x50\x1b\x60\x00\x13\xc6\x34\x03\x20\xe6\x18\x68\x00\x80\x86\xfd\xcb\x01\x8e\xc3\x4d\x0d\xc6\x03\x50\xc9\x01"
+"\x01\x00\xe5\x2b\x0e\xf0\x06\xcd\x64\x16\x2a\x65\x5c\xeb\xed\xb8\xc9\xf5\xe5\x21\x4b\x5c\x3e\x0e\x5e\x23\x56\xe3\x8d\x04\xf0\x13"
+"\xe3\x30\x09\xd5\xeb\x09\xeb\x72\x2b\x73\x23\xd1\x23\x3d\x20\xe8\xeb\xd1\xf1\xa7\xed\x52\x44\x4d\x03\x19\xeb\xc9\x00\x00\xeb\x11"
+"\x8f\x16\xc3\x0d\x81\xf7\x56\x23\x5e\xc9\x2a\x63\x5c\x53\x0d\xb0\x23\xc1\xed\x43\x61\x5c\xc1\xeb\x23\xc9\x2a\x5d\x04\x33\x22\x5b"
+"\x5c\x60\x04\x11\x2a\x63\x04\x11\x2a\x66\x04\x90\xe5\x21\x92\x5c\x22\x68\x5c\xe1\xc9\x3f\x05\xf0\x37\xc3\xe5\x19\x23\x7e\xa7\xc8"
+"\xb9\x23\x20\xf8\x37\xc9\xcd\x1e\x17\xcd\x01\x17\x01\x00\x00\x11\xe2\xa3\xeb\x19\x38\x07\x01\xd4\x15\x09\x4e\x23\x46\xeb\x71\x23"
+"\x70\xc9\xe5\x2a\x4f\x5c\x09\x23\x23\x23\x4e\xeb\x21\x16\x17\xcd\xdc\x16\x4e\x06\x00\x09\xe9\x4b\x05\x53\x03\x50\x01\xe1\xc9\xdb"
+"\x12\xe0\x10\x38\x02\xcf\x17\xc6\x03\x07\x21\x10\x5c\x4f\x06\x00\x38\x00\xd3\x2b\xc9\xef\x01\x38\xcd\x1e\x17\x78\xb1\x28\x16\xeb"
+"\x3f\x00\xf0\x02\x7e\xeb\xfe\x4b\x28\x08\xfe\x53\x28\x04\xfe\x50\x20\xcf\xcd\x5d\x17\xd6\x0c\x00\xa7\x12\x20\x78\xb1\x23\x11\x70"
+"\xc5\x1a\xe6\xdf\x4f\x21\x7a\x61\x00\x20\x30\xf1\x63\x00\x10\xc1\x4d\x01\xf0\x13\x08\x50\x0a\x00\x1e\x01\x18\x06\x1e\x06\x18\x02"
+"\x1e\x10\x0b\x78\xb1\x20\xd5\x57\xe1\xc9\x18\x90\xed\x73\x3f\x5c\xfd\x36\x02\x10\xcd\xaf\x70\x04\x70\xc6\xfd\x46\x31\xcd\x44\x0e"
+"\x6a\x0a\xb0\xfd\xcb\x30\xc6\x2a\x49\x5c\xed\x5b\x6c\x5c\x4a\x01\xf1\x02\x38\x22\xd5\xcd\x6e\x19\x11\xc0\x02\xeb\xed\x52\xe3\xcd"
+"\x6e\x19\xc1\xcd\x0e\xf0\x04\x09\x38\x0e\xeb\x56\x23\x5e\x2b\xed\x53\x6c\x5c\x18\xed\x22\x6c\x5c\x2a\x6c\x86\x07\xf0\x1b\x28\x01"
+"\xeb\xcd\x33\x18\xfd\xcb\x02\xa6\xc9\x3e\x03\x18\x02\x3e\x02\xfd\x36\x02\x00\xcd\x30\x25\xc4\x01\x16\xdf\xcd\x70\x20\x38\x14\xdf"
+"\xfe\x3b\x28\x04\xfe\x2c\x20\x06\x1f\x11\x20\x18\x08\x3e\x11\x33\x03\xcd\xde\x29\x11\x61\x78\xe6\x3f\x67\x69\x22\xcf\x07\x61\x1e"
+"\x01\xcd\x55\x18\xd7\xcd\x0b\xf0\x00\xf6\x3a\x6b\x5c\xfd\x96\x4f\x20\xee\xab\xc8\xe5\xd5\x21\x6c\x52\x08\xf0\x1d\xd1\xe1\x18\xe0"
+"\xed\x4b\x49\x5c\xcd\x80\x19\x16\x3e\x28\x05\x11\x00\x00\xcb\x13\xfd\x73\x2d\x7e\xfe\x40\xc1\xd0\xc5\xcd\x28\x1a\x23\x23\x23\xfd"
+"\xcb\x01\x86\x7a\xa7\x28\x05\xd7\xb1\x0d\x60\xd5\xeb\xfd\xcb\x30\x96\xdc\x0b\x10\x96\x99\x08\x60\x28\x02\xcb\xd6\x2a\x5f\xde\x00"
+"\xf0\x10\x20\x05\x3e\x3f\xcd\xc1\x18\xcd\xe1\x18\xeb\x7e\xcd\xb6\x18\x23\xfe\x0d\x28\x06\xeb\xcd\x37\x19\x18\xe0\xd1\xc9\xfe\x0e"
+"\xc0\x9d\x02\x50\x23\x23\x7e\xc9\xd9\xb2\x0b\x42\xcb\xbc\xcb\xfd\x6f\x0b\xa1\x56\xd5\x36\x00\xcd\xf4\x09\xe1\xfd\x74\xa3\x0b\x40"
+"\xd9\xc9\x2a\x5b\x4d\x00\xc0\xc0\x3a\x41\x5c\xcb\x07\x28\x04\xc6\x43\x18\x16\x6c\x00\xa0\x9e\x3e\x4b\xcb\x56\x28\x0b\xcb\xde\x3c"
+"\xa7\x15\xf2\x01\x28\x02\x3e\x43\xd5\xcd\xc1\x18\xd1\xc9\x5e\x23\x56\xe5\xeb\x23\x62\x09\x10\xe1\x90\x00\xf0\x1d\xc0\x72\x2b\x73"
+"\xc9\x7b\xa7\xf8\x18\x0d\xaf\x09\x3c\x38\xfc\xed\x42\x3d\x28\xf1\xc3\xef\x15\xcd\x1b\x2d\x30\x30\xfe\x21\x38\x2c\xfd\xcb\x01\x96"
+"\xfe\xcb\x28\x24\xfe\x3a\x20\x0e\x30\x00\xf0\x1a\x20\x16\xfd\xcb\x30\x56\x28\x14\x18\x0e\xfe\x22\x20\x0a\xf5\x3a\x6a\x5c\xee\x04"
+"\x32\x6a\x5c\xf1\xfd\xcb\x01\xd6\xd7\xc9\xe5\x2a\x53\x5c\x54\x5d\xc1\xcd\x80\x19\xd0\xab\x01\xb0\xeb\x18\xf4\x7e\xb8\xc0\x23\x7e"
+"\x2b\xb9\xc9\xa0\x09\xd0\x5d\x5c\x0e\x00\x15\xc8\xe7\xbb\x20\x04\xa7\xc9\x23\xf4\x00\xf0\x2a\x22\x5d\x5c\xfe\x22\x20\x01\x0d\xfe"
+"\x3a\x28\x04\xfe\xcb\x20\x04\xcb\x41\x28\xdf\xfe\x0d\x20\xe3\x15\x37\xc9\xe5\x7e\xfe\x40\x38\x17\xcb\x6f\x28\x14\x87\xfa\xc7\x19"
+"\x3f\x01\x05\x00\x30\x02\x0e\x12\x17\x23\x7e\x30\xfb\x18\x06\x23\x17\x0a\x31\x23\x09\xd1\x57\x03\xf0\x09\x19\xeb\xc9\xcd\xdd\x19"
+"\xc5\x78\x2f\x47\x79\x2f\x4f\x03\xcd\x64\x16\xeb\xe1\x19\xd5\xed\xb0\xe1\x4b\x03\x50\x2b\x22\x5d\x5c\xe7\x37\x03\xf2\x3e\x65\x5c"
+"\xcd\x3b\x2d\xcd\xa2\x2d\x38\x04\x21\xf0\xd8\x09\xda\x8a\x1c\xc3\xc5\x16\xd5\xe5\xaf\xcb\x78\x20\x20\x60\x69\x1e\xff\x18\x08\xd5"
+"\x56\x23\x5e\xe5\xeb\x1e\x20\x01\x18\xfc\xcd\x2a\x19\x01\x9c\xff\xcd\x2a\x19\x0e\xf6\xcd\x2a\x19\x7d\xcd\xef\x15\xe1\xd1\xc9\xb1"
+"\xcb\xbc\xbf\xc4\xaf\xb4\x93\x91\x92\x95\x98\x01\x00\xf1\x83\x7f\x81\x2e\x6c\x6e\x70\x48\x94\x56\x3f\x41\x2b\x17\x1f\x37\x77\x44"
+"\x0f\x59\x2b\x43\x2d\x51\x3a\x6d\x42\x0d\x49\x5c\x44\x15\x5d\x01\x3d\x02\x06\x00\x67\x1e\x06\xcb\x05\xf0\x1c\x06\x00\xed\x1e\x00"
+"\xee\x1c\x00\x23\x1f\x04\x3d\x06\xcc\x06\x05\x03\x1d\x04\x00\xab\x1d\x05\xcd\x1f\x05\x89\x20\x05\x02\x2c\x05\xb2\x1b\x00\xb7\x11"
+"\x03\xa1\x1e\x05\xf9\x17\x08\x00\x80\x1e\x03\x4f\x1e\x00\x5f\x1e\x03\xac\x1e\x00\x6b\x0d\x09\x00\xdc\x22\x06\x00\x3a\x1f\x05\xed"
+"\x1d\x05\x27\x1e\x03\x42\x1e\x09\x05\x82\x23\x00\xac\x0e\x05\xc9\x1f\x05\xf5\x17\x0b\x0b\x0b\x0b\x08\x00\xf8\x03\x09\x05\x20\x23"
+"\x07\x01\x00\xf1\x0c\x08\x00\x7a\x1e\x06\x00\x94\x22\x05\x60\x1f\x06\x2c\x0a\x00\x36\x17\x06\x00\xe5\x16\x0a\x00\x93\x17\x0a\x2c"
+"\x06\x00\xf0\x46\x00\x93\x17\x00\x93\x17\xfd\xcb\x01\xbe\xcd\xfb\x19\xaf\x32\x47\x5c\x3d\x32\x3a\x5c\x18\x01\xe7\xcd\xbf\x16\xfd"
+"\x34\x0d\xfa\x8a\x1c\xdf\x06\x00\xfe\x0d\x28\x7a\xfe\x3a\x28\xeb\x21\x76\x1b\xe5\x4f\xe7\x79\xd6\xce\xda\x8a\x1c\x4f\x21\x48\x1a"
+"\x09\x4e\x09\x18\x03\x2a\x74\x5c\x7e\x23\x22\x74\x5c\x01\x52\x1b\xc5\x4f\xfe\x20\x30\x0c\x21\x01\x1c\x38\x04\x70\x09\xe5\xdf\x05"
+"\xc9\xdf\xb9\x4a\x14\x10\xc9\x79\x0c\xf0\x07\x02\xcf\x14\xcd\x4d\x3b\x00\x20\x71\x2a\x42\x5c\xcb\x7c\x28\x14\x21\xfe\xff\x22\x45"
+"\x5c\xf8\x05\x00\xc0\x04\xf0\x24\x1b\x3a\x44\x5c\x18\x33\xcd\x6e\x19\x3a\x44\x5c\x28\x19\xa7\x20\x43\x47\x7e\xe6\xc0\x78\x28\x0f"
+"\xcf\xff\xc1\xcd\x30\x25\xc8\x2a\x55\x5c\x3e\xc0\xa6\xc0\xaf\xfe\x01\xce\x00\x56\x23\x5e\xed\x53\x45\x5c\x23\xd4\x05\xc0\x19\x23"
+"\x22\x55\x5c\xeb\x22\x5d\x5c\x57\x1e\x00\x55\x08\xf0\x2b\x15\xfd\x72\x0d\xca\x28\x1b\x14\xcd\x8b\x19\x28\x08\xcf\x16\xcd\x30\x25"
+"\xc0\xc1\xc1\xcd\x5d\x3b\x28\xba\xfe\x3a\xca\x28\x1b\xc3\x8a\x1c\x0f\x1d\x4b\x09\x67\x0b\x7b\x8e\x71\xb4\x81\xcf\xcd\xde\x1c\xbf"
+"\xc1\xcc\xee\x1b\xeb\x2a\x74\x5c\x20\x05\xf0\x0e\xc5\xc9\xcd\xb2\x28\xfd\x36\x37\x00\x30\x08\xfd\xcb\x37\xce\x20\x18\xcf\x01\xcc"
+"\x96\x29\xfd\xcb\x01\x76\x20\x0d\xaf\x3b\x04\xf0\x04\xf1\x2b\x21\x71\x5c\xb6\x77\xeb\xed\x43\x72\x5c\x22\x4d\x5c\xc9\xc1\xcd\x56"
+"\x30\x04\xf0\x07\xc9\x3a\x3b\x5c\xf5\xcd\xfb\x24\xf1\xfd\x56\x01\xaa\xe6\x40\x20\x24\xcb\x7a\xc2\xff\x2a\x4d\x00\xa0\xf5\x79\xf6"
+"\x9f\x3c\x20\x14\xf1\x18\xa9\x65\x04\x80\xfe\x2c\x20\x09\xe7\xcd\xfb\x24\x52\x00\x33\xc0\xcf\x0b\x0a\x00\x70\xc8\x18\xf4\xfd\xcb"
+"\x01\x7e\xf0\x04\x31\xc4\x4d\x0d\x9c\x16\xc0\x13\xcd\xfc\x21\xcd\xee\x1b\x2a\x8f\x5c\x22\x8d\x55\x0f\x50\x7e\x07\xae\xe6\xaa\x53"
+"\x0f\x40\x30\x25\x28\x13\x29\x00\xf0\x10\xcd\x4d\x0d\x21\x90\x5c\x7e\xf6\xf8\x77\xfd\xcb\x57\xb6\xdf\xcd\xe2\x21\x18\x9f\xc3\x05"
+"\x06\xfe\x0d\x28\x04\xfe\x3a\x20\x9c\x33\x01\x60\xef\xa0\x38\xc9\xcf\x08\x3e\x01\xf0\x02\x28\x0a\xef\x02\x38\xeb\xcd\xe9\x34\xda"
+"\xb3\x1b\xc3\x29\x1b\xfe\xcd\x86\x00\x01\xdd\x15\xf0\x13\x18\x06\xcd\xee\x1b\xef\xa1\x38\xef\xc0\x02\x01\xe0\x01\x38\xcd\xff\x2a"
+"\x22\x68\x5c\x2b\x7e\xcb\xfe\x01\x06\x00\x09\x07\x38\x06\x0e\x0d\xdb\x13\xf0\x00\xe5\xef\x02\x02\x38\xe1\xeb\x0e\x0a\xed\xb0\x2a"
+"\x45\x5c\xeb\x74\x0f\xf0\x42\x56\x0d\x14\x23\x72\xcd\xda\x1d\xd0\xfd\x46\x38\x2a\x45\x5c\x22\x42\x5c\x3a\x47\x5c\xed\x44\x57\x2a"
+"\x5d\x5c\x1e\xf3\xc5\xed\x4b\x55\x5c\xcd\x86\x1d\xed\x43\x55\x5c\xc1\x38\x11\xe7\xf6\x20\xb8\x28\x03\xe7\x18\xe8\xe7\x3e\x01\x92"
+"\x32\x44\x5c\xc9\xcf\x11\x7e\xfe\x3a\x28\x18\x23\x7e\xe6\xc0\x37\xc0\x46\x23\x4e\xed\x43\x42\x5c\xc2\x03\xf0\x09\xe5\x09\x44\x4d"
+"\xe1\x16\x00\xc5\xcd\x8b\x19\xc1\xd0\x18\xe0\xfd\xcb\x37\x4e\xc2\x2e\x1c\x2a\x4d\x36\x0a\xf1\x28\x1f\x23\x22\x68\x5c\xef\xe0\xe2"
+"\x0f\xc0\x02\x38\xcd\xda\x1d\xd8\x2a\x68\x5c\x11\x0f\x00\x19\x5e\x23\x56\x23\x66\xeb\xc3\x73\x1e\xcf\x00\xef\xe1\xe0\xe2\x36\x00"
+"\x02\x01\x03\x37\x00\x04\x38\xa7\xc9\x38\x37\xc9\xe7\xcd\x1f\x7b\x17\x20\x29\xdf\xb3\x14\xf1\x0d\x57\x5c\x7e\xfe\x2c\x28\x09\x1e"
+"\xe4\xcd\x86\x1d\x30\x02\xcf\x0d\xcd\x77\x00\xcd\x56\x1c\xdf\x22\x57\x5c\x2a\x5f\x8c\x0c\x30\xcd\x78\x00\x3a\x17\x90\xc9\xcd\xee"
+"\x1b\xc9\xcd\x30\x25\x20\xa0\x01\xf1\x07\xfe\x2c\xc4\xee\x1b\xe7\x18\xf5\x3e\xe4\x47\xed\xb9\x11\x00\x02\xc3\x8b\x19\xcd\x99\x1e"
+"\xd5\x08\x00\x05\x0c\xf0\x09\xc9\xcd\x99\x1e\x78\xb1\x20\x04\xed\x4b\x78\x5c\xed\x43\x76\x5c\xc9\x2a\x6e\x5c\xfd\x56\x36\x18\x62"
+"\x17\x90\x60\x69\x16\x00\x7c\xfe\xf0\x30\x2c\xcd\x15\x80\x72\x0a\xc9\xcd\x85\x1e\xed\x79\x06\x00\xf0\x01\x02\xc9\xcd\xd5\x2d\x38"
+"\x15\x28\x02\xed\x44\xf5\xcd\x99\x1e\xf1\x0f\x00\x20\x18\x03\x8d\x04\xf5\x00\x01\xc8\xcf\x0a\xcd\x67\x1e\x01\x00\x00\xcd\x45\x1e"
+"\x18\x03\x5d\x00\x61\xb2\x5c\xc5\xed\x5b\x4b\x70\x16\xf0\x05\xcd\xe5\x19\xcd\x6b\x0d\x2a\x65\x5c\x11\x32\x00\x19\xd1\xed\x52\x30"
+"\x08\x2a\xb4\xf1\x05\xa0\x30\x02\xcf\x15\xeb\x22\xb2\x5c\xd1\xc1\xbd\x0c\x10\xc5\xb3\x0f\x90\xeb\xe9\xd1\xfd\x66\x0d\x24\xe3\x33"
+"\xa4\x0b\x11\xc5\xc6\x0d\x10\xd5\x5e\x00\xf0\x08\x14\x00\x2a\x65\x5c\x09\x38\x0a\xeb\x21\x50\x00\x19\x38\x03\xed\x72\xd8\x2e\x03"
+"\xc3\x55\x00\x76\x00\xf0\x01\x05\x1f\x44\x4d\xc9\xc1\xe1\xd1\x7a\xfe\x3e\x28\x0b\x3b\xe3\xeb\x47\x00\xf0\x0e\xc5\xc3\x73\x1e\xd5"
+"\xe5\xcf\x06\xcd\x99\x1e\x76\x0b\x78\xb1\x28\x0c\x78\xa1\x3c\x20\x01\x03\xfd\xcb\x01\x6e\x28\xee\x17\x09\x11\xc9\x65\x19\x60\xd8"
+"\x3e\xfe\xdb\xfe\x1f\x39\x01\xf0\x1b\x28\x05\x3e\xce\xc3\x39\x1e\xfd\xcb\x01\xf6\xcd\x8d\x2c\x30\x16\xe7\xfe\x24\x20\x05\xfd\xcb"
+"\x01\xb6\xe7\xfe\x28\x20\x3c\xe7\xfe\x29\x28\x20\xcd\x8d\x2c\xd2\x8a\x1c\xeb\x1a\x00\x70\x02\xeb\xe7\xeb\x01\x06\x00\x68\x02\xf5"
+"\x05\x23\x36\x0e\xfe\x2c\x20\x03\xe7\x18\xe0\xfe\x29\x20\x13\xe7\xfe\x3d\x20\x0e\xe7\x5a\x03\x40\xae\x01\xe6\x40\x4b\x19\x82\xee"
+"\x1b\xcd\x30\x25\xe1\xc8\xe9\xd4\x07\x00\x95\x03\x80\x01\x16\xcd\x4d\x0d\xcd\xdf\x1f\xb8\x01\xe0\xdf\xcd\x45\x20\x28\x0d\xcd\x4e"
+"\x20\x28\xfb\xcd\xfc\x1f\x08\x00\xf0\x12\xf3\xfe\x29\xc8\xcd\xc3\x1f\x3e\x0d\xd7\xc9\xdf\xfe\xac\x20\x0d\xcd\x79\x1c\xcd\xc3\x1f"
+"\xcd\x07\x23\x3e\x16\x18\x10\xfe\xad\x20\x12\x99\x03\x00\x12\x00\xf0\x09\x99\x1e\x3e\x17\xd7\x79\xd7\x78\xd7\xc9\xcd\xf2\x21\xd0"
+"\xcd\x70\x20\xd0\xcd\xfb\x24\xcd\xc3\x1f\xad\x03\xf0\x03\xcc\xf1\x2b\xc2\xe3\x2d\x78\xb1\x0b\xc8\x1a\x13\xd7\x18\xf7\xfe\x29\xc8"
+"\xc8\x1f\x20\x3a\xc9\x43\x08\x50\x14\xfe\x2c\x20\x0a\x46\x1a\xf0\x0a\x0b\x3e\x06\xd7\x18\x06\xfe\x27\xc0\xcd\xf5\x1f\xe7\xcd\x45"
+"\x20\x20\x01\xc1\xbf\xc9\xfe\x23\x37\xc0\x62\x00\x10\xa7\x63\x00\xb1\x94\x1e\xfe\x10\xd2\x0e\x16\xcd\x01\x16\xa7\x29\x01\x60\x08"
+"\x3e\x01\xcd\x01\x16\x66\x0d\x90\x36\x02\x01\xcd\xc1\x20\xcd\xee\x1b\x64\x13\x90\x3a\x6b\x5c\xb8\x38\x03\x0e\x21\x47\xc5\x15\x20"
+"\x3e\x19\x24\x14\x01\xf4\x03\x42\xd9\x0d\xc3\x6e\xdc\x00\xb0\xfe\x28\x20\x0e\xe7\xcd\xdf\x1f\xdf\xfe\x29\x60\x05\x70\xc3\xb2\x21"
+"\xfe\xca\x20\x11\xf0\x02\x40\xfd\xcb\x37\xfe\xb2\x00\x50\xc2\x8a\x1c\x18\x0d\x67\x01\xf0\x29\xaf\x21\xcd\x1f\x1c\xfd\xcb\x37\xbe"
+"\xcd\x30\x25\xca\xb2\x21\xcd\xbf\x16\x21\x71\x5c\xcb\xb6\xcb\xee\x01\x01\x00\xcb\x7e\x20\x0b\x3a\x3b\x5c\xe6\x40\x20\x02\x0e\x03"
+"\xb6\x77\xf7\x36\x0d\x79\x0f\x0f\x30\x05\x3e\x22\x12\x2b\x77\x8a\x10\x73\xcb\x37\x7e\x20\x2c\x2a\x5d\x0a\x10\x31\x3a\x21\xe5\x81"
+"\x0e\x10\x04\x16\x02\x24\x2a\x61\x85\x0e\x31\xcd\x2c\x0f\x3e\x06\x40\xb9\x21\x18\x03\x0c\x00\xf0\x03\x36\x22\x00\xcd\xd6\x21\x20"
+"\x0a\xcd\x1d\x11\xed\x4b\x82\x5c\xcd\xd9\x0d\x71\x00\x71\xae\xcb\x7e\xcb\xbe\x20\x1c\x02\x10\x31\xe1\x22\x5f\x94\x0e\x33\xcd\xb9"
+"\x21\x7b\x03\x80\x22\x5d\x5c\x18\x17\x2a\x63\x5c\x00\x10\x10\x37\x1c\x0b\x82\xcd\xb2\x2a\xcd\xff\x2a\x18\x03\xc5\x01\x30\xca\xc1"
+"\x20\x29\x10\xf0\x05\x22\x5d\x5c\xdf\xfe\xe2\x28\x0c\x3a\x71\x5c\xcd\x59\x1c\xdf\xfe\x0d\xc8\xcf\x0b\xea\x04\x10\xcf\x07\x12\x00"
+"\x20\x09\x90\x7e\xfe\x4b\xc9\xe7\xcd\xf2\x21\xd8\xc8\x03\xf0\x0a\xf6\xfe\x3b\x28\xf2\xc3\x8a\x1c\xfe\xd9\xd8\xfe\xdf\x3f\xd8\xf5"
+"\xe7\xf1\xd6\xc9\xf5\xcd\x82\x1c\xf1\x8b\x01\xf0\x2a\xf5\xcd\x94\x1e\x57\xf1\xd7\x7a\xd7\xc9\xd6\x11\xce\x00\x28\x1d\xd6\x02\xce"
+"\x00\x28\x56\xfe\x01\x7a\x06\x01\x20\x04\x07\x07\x06\x04\x4f\x7a\xfe\x02\x30\x16\x79\x21\x91\x5c\x18\x38\x7a\x06\x07\x38\x05\x07"
+"\x07\x07\x06\x38\x4f\x7a\x0a\x0f\xf0\x41\xcf\x13\x21\x8f\x5c\xfe\x08\x38\x0b\x7e\x28\x07\xb0\x2f\xe6\x24\x28\x01\x78\x4f\x79\xcd"
+"\x6c\x22\x3e\x07\xba\x9f\xcd\x6c\x22\x07\x07\xe6\x50\x47\x3e\x08\xba\x9f\xae\xa0\xae\x77\x23\x78\xc9\x9f\x7a\x0f\x06\x80\x20\x03"
+"\x0f\x06\x40\x4f\x7a\xfe\x08\x28\x04\xfe\x02\x30\xbd\x79\x21\x8f\x5c\xcd\x6c\x22\x79\x0f\x0f\x0f\x18\xd8\x76\x0b\x82\x08\x30\xa9"
+"\xd3\xfe\x07\x07\x07\x9e\x16\xf0\x27\x32\x48\x5c\xc9\x3e\xaf\x90\xda\xf9\x24\x47\xa7\x1f\x37\x1f\xa7\x1f\xa8\xe6\xf8\xa8\x67\x79"
+"\x07\x07\x07\xa8\xe6\xc7\xa8\x07\x07\x6f\x79\xe6\x07\xc9\xcd\x07\x23\xcd\xaa\x22\x47\x04\x7e\x07\x10\xfd\xe6\x01\xc3\x28\x2d\x11"
+"\x00\x91\xe5\x22\xc3\x4d\x0d\xed\x43\x7d\x5c\x1b\x00\xf0\x16\x3e\xfe\x0f\x10\xfd\x47\x7e\xfd\x4e\x57\xcb\x41\x20\x01\xa0\xcb\x51"
+"\x20\x02\xa8\x2f\x77\xc3\xdb\x0b\xcd\x14\x23\x47\xc5\xcd\x14\x23\x59\xc1\x51\x4f\x80\x04\xc0\xda\xf9\x24\x0e\x01\xc8\x0e\xff\xc9"
+"\xdf\xfe\x2c\x52\x02\x02\x31\x1c\xf0\x16\xef\x2a\x3d\x38\x7e\xfe\x81\x30\x05\xef\x02\x38\x18\xa1\xef\xa3\x38\x36\x83\xef\xc5\x02"
+"\x38\xcd\x7d\x24\xc5\xef\x31\xe1\x04\x38\x7e\xfe\x80\x30\x08\x1d\x06\xf0\x1d\xc1\xc3\xdc\x22\xef\xc2\x01\xc0\x02\x03\x01\xe0\x0f"
+"\xc0\x01\x31\xe0\x01\x31\xe0\xa0\xc1\x02\x38\xfd\x34\x62\xcd\x94\x1e\x6f\xe5\xcd\x94\x1e\xe1\x67\x22\x7d\x5c\xc1\xc3\x20\x24\x9c"
+"\x01\x00\x77\x06\x30\xc3\x77\x24\x19\x03\x00\x81\x06\xf2\x0f\xc5\xa2\x04\x1f\x31\x30\x30\x00\x06\x02\x38\xc3\x77\x24\xc0\x02\xc1"
+"\x02\x31\x2a\xe1\x01\xe1\x2a\x0f\xe0\x05\x2a\xe0\x01\x84\x00\x10\x07\x68\x00\x31\xc3\x77\x24\x7d\x00\xb1\x02\xe1\x01\x05\xc1\x02"
+"\x01\x31\xe1\x04\xc2\x06\x00\xf1\x30\xe2\xe5\xe0\x03\xa2\x04\x31\x1f\xc5\x02\x20\xc0\x02\xc2\x02\xc1\xe5\x04\xe0\xe2\x04\x0f\xe1"
+"\x01\xc1\x02\xe0\x04\xe2\xe5\x04\x03\xc2\x2a\xe1\x2a\x0f\x02\x38\x1a\xfe\x81\xc1\xda\x77\x24\xc5\xef\x01\x38\x3a\x7d\x5c\xcd\x28"
+"\x2d\xef\xc0\x0f\x01\x38\x3a\x7e\x0b\x00\xf4\x17\xc5\x0f\xe0\xe5\x38\xc1\x05\x28\x3c\x18\x14\xef\xe1\x31\xe3\x04\xe2\xe4\x04\x03"
+"\xc1\x02\xe4\x04\xe2\xe3\x04\x0f\xc2\x02\x38\xc5\xef\xc0\x02\xe1\x0f\x31\x39\x00\x10\x03\x8b\x06\x24\x01\xe0\x3d\x00\xb5\x03\x38"
+"\xcd\xb7\x24\xc1\x10\xc6\xef\x02\x02\x5c\x00\x15\x03\x5b\x00\x01\x1e\x00\xf0\x01\xc3\x4d\x0d\xef\x31\x28\x34\x32\x00\x01\x05\xe5"
+"\x01\x05\x2a\x38\x05\x06\xa0\x06\xe6\xfc\xc6\x04\x30\x02\x3e\xfc\xf5\x8d\x00\xf0\x0b\xe5\x01\x05\x31\x1f\xc4\x02\x31\xa2\x04\x1f"
+"\xc1\x01\xc0\x02\x31\x04\x31\x0f\xa1\x03\x1b\xc3\x02\x38\xc1\xec\x01\xf0\x59\x79\xb8\x30\x06\x69\xd5\xaf\x5f\x18\x07\xb1\xc8\x68"
+"\x41\xd5\x16\x00\x60\x78\x1f\x85\x38\x03\xbc\x38\x07\x94\x4f\xd9\xc1\xc5\x18\x04\x4f\xd5\xd9\xc1\x2a\x7d\x5c\x78\x84\x47\x79\x3c"
+"\x85\x38\x0d\x28\x0d\x3d\x4f\xcd\xe5\x22\xd9\x79\x10\xd9\xd1\xc9\x28\xf3\xcf\x0a\xdf\x06\x00\xc5\x4f\x21\x96\x25\xcd\xdc\x16\x79"
+"\xd2\x84\x26\x06\x00\x4e\x09\xe9\xcd\x74\x00\x03\xfe\x0d\xca\x8a\x1c\xfe\x22\x20\xf3\xcd\x74\x00\xfe\x22\xc9\xa6\x05\x42\x06\xcd"
+"\x79\x1c\x5c\x04\x00\x9a\x08\x00\x7e\x00\x70\x2a\x36\x5c\x11\x00\x01\x19\xb1\x02\xf0\x31\xe6\xe0\xa8\x5f\x79\xe6\x18\xee\x40\x57"
+"\x06\x60\xc5\xd5\xe5\x1a\xae\x28\x04\x3c\x20\x1a\x3d\x4f\x06\x07\x14\x23\x1a\xae\xa9\x20\x0f\x10\xf7\xc1\xc1\xc1\x3e\x80\x90\x01"
+"\x01\x00\xf7\x12\x18\x0a\xe1\x11\x08\x00\x19\xd1\xc1\x10\xd3\x48\xc3\xb2\x2a\xcd\x07\x23\x44\x00\xf0\x20\x4f\xe6\xe0\xa8\x6f\x79"
+"\xe6\x03\xee\x58\x67\x7e\xc3\x28\x2d\x22\x1c\x28\x4f\x2e\xf2\x2b\x12\xa8\x56\xa5\x57\xa7\x84\xa6\x8f\xc4\xe6\xaa\xbf\xab\xc7\xa9"
+"\xce\x00\xe7\xc3\xff\x24\xdf\x23\xe5\x9c\x06\x90\x0f\x25\x20\x1b\xcd\x0f\x25\x28\xfb\x6c\x05\xf0\x05\x11\xf7\xe1\xd5\x7e\x23\x12"
+"\x13\xfe\x22\x20\xf8\x7e\x23\xfe\x22\x28\xf2\x0b\xd1\xe8\x0c\x90\xb6\xcb\x7e\xc4\xb2\x2a\xc3\x12\x27\x67\x09\x03\x1d\x05\x50\x12"
+"\x27\xc3\xbd\x27\x35\x00\xf0\x0f\x28\xed\x4b\x76\x5c\xcd\x2b\x2d\xef\xa1\x0f\x34\x37\x16\x04\x34\x80\x41\x00\x00\x80\x32\x02\xa1"
+"\x03\x31\x38\xcd\xa2\x2d\xc0\x07\x90\x7e\xa7\x28\x03\xd6\x10\x77\x18\x09\x2f\x00\xf3\x03\x04\xef\xa3\x38\x34\xe7\xc3\xc3\x26\x01"
+"\x5a\x10\xe7\xfe\x23\xca\x0d\x27\x62\x00\xf0\x05\x28\x1f\xc3\x6c\x3b\x0e\x00\x20\x13\xcd\x1e\x03\x30\x0e\x15\x5f\xcd\x33\x03\xf5"
+"\xec\x00\x20\xf1\x12\xb5\x14\x11\xcd\x80\x00\xa0\xcd\x22\x25\xc4\x35\x25\xe7\xc3\xdb\x25\x0a\x00\x50\x80\x25\xe7\x18\x48\x09\x00"
+"\xe0\xcb\x22\xe7\x18\x3f\xcd\x88\x2c\x30\x56\xfe\x41\x30\x3c\x66\x08\x53\x23\xcd\x9b\x2c\xdf\x01\x07\xf0\x00\x36\x0e\x23\xeb\x2a"
+"\x65\x5c\x0e\x05\xa7\xed\x42\x22\x65\x5c\x6a\x14\xf0\x03\xcd\x77\x00\x18\x0e\xdf\x23\x7e\xfe\x0e\x20\xfa\x23\xcd\xb4\x33\x22\x5d"
+"\x3b\x05\xf0\x04\xf6\x18\x14\xcd\xb2\x28\xda\x2e\x1c\xcc\x96\x29\x3a\x3b\x5c\xfe\xc0\x38\x04\x1d\x00\xf1\x22\x18\x33\x01\xdb\x09"
+"\xfe\x2d\x28\x27\x01\x18\x10\xfe\xae\x28\x20\xd6\xaf\xda\x8a\x1c\x01\xf0\x04\xfe\x14\x28\x14\xd2\x8a\x1c\x06\x10\xc6\xdc\x4f\xfe"
+"\xdf\x30\x02\xcb\xb1\xfe\xee\x38\x02\xcb\xb9\xc5\x5f\x01\x40\xfe\x28\x20\x0c\x33\x06\xf0\x23\x20\x17\xcd\x52\x2a\xe7\x18\xf0\x06"
+"\x00\x4f\x21\x95\x27\xcd\xdc\x16\x30\x06\x4e\x21\xed\x26\x09\x46\xd1\x7a\xb8\x38\x3a\xa7\xca\x18\x00\xc5\x21\x3b\x5c\x7b\xfe\xed"
+"\x20\x06\xcb\x76\x20\x02\x1e\x99\xd5\x26\x01\xc3\x09\x7b\xe6\x3f\x47\xef\x3b\x38\x18\x09\x7b\xfd\xa4\x07\x01\x8a\x01\xc1\xf6\xcb"
+"\x7b\x20\x02\xcb\xb6\xc1\x18\xc1\xd5\x79\x5e\x00\xf1\x07\x15\xe6\x3f\xc6\x08\x4f\xfe\x10\x20\x04\xcb\xf1\x18\x08\x38\xd7\xfe\x17"
+"\x28\x02\xcb\xf9\x83\x00\xf1\x13\x2b\xcf\x2d\xc3\x2a\xc4\x2f\xc5\x5e\xc6\x3d\xce\x3e\xcc\x3c\xcd\xc7\xc9\xc8\xca\xc9\xcb\xc5\xc7"
+"\xc6\xc8\x00\x06\x08\x08\x0a\x02\x03\x05\x01\x00\x10\x06\x30\x01\x20\x35\xe7\xd6\x06\x80\x8a\x1c\xe7\xfe\x24\xf5\x20\x01\xad\x02"
+"\x10\x12\x53\x08\x30\x10\xcd\xfb\x5a\x04\x00\x3e\x08\x12\xf5\xf8\x01\x01\xad\x01\x50\xf1\x28\x02\xcb\xf6\x0f\x02\xb0\xe6\xdf\x47"
+"\xe7\xd6\x24\x4f\x20\x01\xe7\xe7\x95\x0e\xf1\x14\x2b\x11\xce\x00\xc5\xcd\x86\x1d\xc1\x30\x02\xcf\x18\xe5\xcd\xab\x28\xe6\xdf\xb8"
+"\x20\x08\xcd\xab\x28\xd6\x24\xb9\x28\x0c\xe1\x2b\x11\x00\x02\x87\x0a\xf0\x05\x18\xd7\xa7\xcc\xab\x28\xd1\xd1\xed\x53\x5d\x5c\xcd"
+"\xab\x28\xe5\xfe\x29\x28\x42\x8d\x01\xe1\x16\x40\x28\x07\x2b\xcd\xab\x28\x23\x16\x00\x23\xe5\xd5\xfb\x0b\x00\xfd\x00\x30\x20\x2b"
+"\xe1\xc1\x01\x36\x01\x05\x00\xc1\x01\xf0\x0d\xab\x28\xfe\x29\x28\x0d\xe5\xdf\xfe\x2c\x20\x0d\xe7\xe1\xcd\xab\x28\x18\xbe\xe5\xdf"
+"\xfe\x29\x28\x02\xcf\x19\xd1\xba\x0c\x90\x2a\x0b\x5c\xe3\x22\x0b\x5c\xd5\xe7\xb3\x02\xf0\x03\xe1\x22\x5d\x5c\xe1\x22\x0b\x5c\xe7"
+"\xc3\x12\x27\x23\x7e\xfe\x21\x38\xfa\x5d\x1c\x22\xf6\xdf\xf4\x00\xf0\x03\xe5\xe6\x1f\x4f\xe7\xe5\xfe\x28\x28\x28\xcb\xf1\xfe\x24"
+"\x28\x11\xcb\xe9\x4b\x02\x10\x0f\x05\x00\x70\x16\xcb\xb1\xe7\x18\xf6\xe7\x67\x09\x50\x3a\x0c\x5c\xa7\x28\x2c\x01\x40\xc2\x51\x29"
+"\x41\x33\x01\x90\x08\x79\xe6\xe0\xcb\xff\x4f\x18\x37\x07\x20\xe0\xe6\x7f\x28\x2d\xb9\x20\x22\x17\x87\xf2\x3f\x29\x38\x30\x00\x20"
+"\xf0\x02\x1a\x13\xfe\x20\x28\xfa\xf6\x20\xbe\x28\xf4\xf6\x80\xbe\x20\x06\x1a\x50\x00\x21\x15\xe1\xb1\x0f\xf0\x05\xc1\x18\xce\xcb"
+"\xf8\xd1\xdf\xfe\x28\x28\x09\xcb\xe8\x18\x0d\xd1\xd1\xd1\xe5\xdf\x1f\x00\xf0\x08\x03\xe7\x18\xf8\xe1\xcb\x10\xcb\x70\xc9\x2a\x0b"
+"\x5c\x7e\xfe\x29\xca\xef\x28\x7e\xf6\x60\x47\x1b\x01\x03\x19\x01\x60\xcb\xa8\x78\xb9\x28\x12\x96\x07\x20\x23\xcd\x03\x01\x30\xca"
+"\xef\x28\xfc\x00\xf0\x12\xd9\xcb\x69\x20\x0c\x23\xed\x5b\x65\x5c\xcd\xc0\x33\xeb\x22\x65\x5c\xd1\xd1\xaf\x3c\xc9\xaf\x47\xcb\x79"
+"\x20\x4b\xcb\x7e\x20\x0e\x3c\x09\x0c\xf0\x2d\x23\xeb\xcd\xb2\x2a\xdf\xc3\x49\x2a\x23\x23\x23\x46\xcb\x71\x28\x0a\x05\x28\xe8\xeb"
+"\xdf\xfe\x28\x20\x61\xeb\xeb\x18\x24\xe5\xdf\xe1\xfe\x2c\x28\x20\xcb\x79\x28\x52\xcb\x71\x20\x06\xfe\x29\x20\x3c\xe7\xc9\xfe\x29"
+"\x28\x6c\xfe\xcc\x20\x32\xdf\xe3\x0f\xd0\x18\x5e\x21\x00\x00\xe5\xe7\xe1\x79\xfe\xc0\x20\x09\x6c\x01\xf0\x16\x51\xfe\xcc\x28\xe5"
+"\xc5\xe5\xcd\xee\x2a\xe3\xeb\xcd\xcc\x2a\x38\x19\x0b\xcd\xf4\x2a\x09\xd1\xc1\x10\xb3\xcb\x79\x20\x66\xe5\xcb\x71\x20\x13\x42\x4b"
+"\x29\x00\x80\x02\xcf\x02\xe7\xe1\x11\x05\x00\x1f\x00\x10\xc9\x2f\x00\xc0\xcd\xf4\x2a\xc1\x09\x23\x42\x4b\xeb\xcd\xb1\x2a\x21\x00"
+"\x50\x07\xfe\x2c\x20\xdb\x28\x03\x40\xfe\x28\x28\xf8\x6e\x01\x00\xc9\x09\x30\xc4\xf1\x2b\x84\x02\xf0\x06\x50\xd5\xaf\xf5\xc5\x11"
+"\x01\x00\xdf\xe1\xfe\xcc\x28\x17\xf1\xcd\xcd\x2a\xf5\x50\x59\xae\x00\x31\xcc\x28\x09\x94\x02\xb1\x62\x6b\x18\x13\xe5\xe7\xe1\xfe"
+"\x29\x28\x0c\x1e\x00\xb0\xdf\x60\x69\xfe\x29\x20\xe6\xf1\xe3\x19\x2b\x2a\x14\xd0\x01\x00\x00\x38\x07\x23\xa7\xfa\x20\x2a\x44\x4d"
+"\xd1\x5c\x00\x00\xdd\x08\x10\xaf\x09\x00\x90\xc5\xcd\xa9\x33\xc1\x2a\x65\x5c\x77\xa8\x19\xc1\x23\x71\x23\x70\x23\x22\x65\x5c\xc9"
+"\xaf\xd5\xe5\xd1\x08\x00\x87\x03\x10\x12\x4b\x0c\xf0\x03\xd1\x78\xb1\x37\x28\x05\xe1\xe5\xa7\xed\x42\x7a\xde\x00\xe1\xd1\xc9\xeb"
+"\x25\x0f\x00\xa2\x00\xa0\xc8\xcd\xa9\x30\xda\x15\x1f\xc9\x2a\x4d\x69\x19\x90\x4e\x28\x5e\x01\x05\x00\x03\x23\x7e\xf9\x01\xf0\x09"
+"\x30\x0b\xfe\x10\x38\x11\xfe\x16\x30\x0d\x23\x18\xed\xcd\x88\x2c\x38\xe7\xfe\x24\xca\xc0\x2b\x79\xb6\x22\x01\x96\x0b\xb2\xeb\xd5"
+"\x2a\x4d\x5c\x1b\xd6\x06\x47\x28\x11\x93\x02\xf0\x13\xf6\x20\x13\x12\x10\xf4\xf6\x80\x12\x3e\xc0\x2a\x4d\x5c\xae\xf6\x20\xe1\xcd"
+"\xea\x2b\xe5\xef\x02\x38\xe1\x01\x05\x00\xa7\xed\x42\x18\x40\xf1\x03\xe0\x28\x06\x11\x06\x00\x19\x18\xe7\x2a\x4d\x5c\xed\x4b\x72"
+"\x77\x00\xf0\x02\x46\x20\x30\x78\xb1\xc8\xe5\xf7\xd5\xc5\x54\x5d\x23\x36\x20\xed\xb8\x30\x14\x20\xe1\xe3\x42\x1b\xf1\x04\x30\x02"
+"\x44\x4d\xe3\xeb\x78\xb1\x28\x02\xed\xb0\xc1\xd1\xe1\xeb\x78\xb1\xc8\xb4\x11\xf3\x16\x2b\x2b\x2b\x7e\xe5\xc5\xcd\xc6\x2b\xc1\xe1"
+"\x03\x03\x03\xc3\xe8\x19\x3e\xdf\x2a\x4d\x5c\xa6\xf5\xcd\xf1\x2b\xeb\x09\xc5\x2b\x22\x4d\x5c\x03\x03\x03\xaa\x00\x60\x2a\x4d\x5c"
+"\xc1\xc5\x03\xd7\x19\x00\x42\x16\x30\xf1\x2b\x77\x18\x00\x41\xc9\x2a\x65\x5c\xbb\x23\x50\x56\x2b\x5e\x2b\x7e\x36\x01\x30\xcd\xb2"
+"\x28\x48\x0c\xd1\x30\x25\x20\x08\xcb\xb1\xcd\x96\x29\xcd\xee\x1b\x38\x16\x23\x00\xa1\x16\xf0\x0c\xcb\xf9\x06\x00\xc5\x21\x01\x00"
+"\xcb\x71\x20\x02\x2e\x05\xeb\xe7\x26\xff\xcd\xcc\x2a\xda\x20\x2a\xe1\xc5\x24\xcb\x16\x30\xf4\x2a\xeb\xbf\x08\xf0\x08\xe8\xfe\x29"
+"\x20\xbb\xe7\xc1\x79\x68\x26\x00\x23\x23\x29\x19\xda\x15\x1f\xd5\xc5\xe5\x44\x4d\x70\x00\x00\x32\x01\x50\x77\xc1\x0b\x0b\x0b\xa6"
+"\x01\xf0\x03\xc1\x78\x23\x77\x62\x6b\x1b\x36\x00\xcb\x71\x28\x02\x36\x20\xc1\xed\xb8\x9a\x00\x20\x2b\x3d\xaf\x21\xf0\x33\x1b\x2d"
+"\x3f\xd8\xfe\x41\x3f\xd0\xfe\x5b\xd8\xfe\x61\x3f\xd0\xfe\x7b\xc9\xfe\xc4\x20\x19\x11\x00\x00\xe7\xd6\x31\xce\x00\x20\x0a\xeb\x3f"
+"\xed\x6a\xda\xad\x31\xeb\x18\xef\x42\x4b\xc3\x2b\x2d\xfe\x2e\x28\x0f\xcd\x3b\x2d\xfe\x2e\x20\x28\xe7\xcd\x1b\x2d\x38\x22\x18\x0a"
+"\x08\x00\xf0\x20\xda\x8a\x1c\xef\xa0\x38\xef\xa1\xc0\x02\x38\xdf\xcd\x22\x2d\x38\x0b\xef\xe0\xa4\x05\xc0\x04\x0f\x38\xe7\x18\xef"
+"\xfe\x45\x28\x03\xfe\x65\xc0\x06\xff\xe7\xfe\x2b\x28\x05\xfe\x2d\x20\x02\x04\x33\x00\x30\x38\xcb\xc5\xfc\x12\xb0\xd5\x2d\xc1\xda"
+"\xad\x31\xa7\xfa\xad\x31\x04\x8a\x0e\xf0\x04\xc3\x4f\x2d\xfe\x30\xd8\xfe\x3a\x3f\xc9\xcd\x1b\x2d\xd8\xd6\x30\x4f\x06\x00\xfb\x1a"
+"\xf0\x0c\xaf\x5f\x51\x48\x47\xcd\xb6\x2a\xef\x38\xa7\xc9\xf5\xef\xa0\x38\xf1\xcd\x22\x2d\xd8\xef\x01\xa4\x04\x0f\x38\x2a\x2d\x80"
+"\xf1\x07\x0f\x30\x02\x2f\x3c\xf5\x1e\x22\xf0\x11\x0b\x35\xef\xa4\x38\xf1\xcb\x3f\x30\x0d\xf5\xef\xc1\xe0\x00\x04\x04\x33\x02\x05"
+"\xe1\x38\xf1\x28\x08\xf5\xef\x31\x04\x38\xf1\x18\x21\x02\xf1\x3a\xc9\x23\x4e\x23\x7e\xa9\x91\x5f\x23\x7e\x89\xa9\x57\xc9\x0e\x00"
+"\xe5\x36\x00\x23\x71\x23\x7b\xa9\x91\x77\x23\x7a\x89\xa9\x77\x23\x36\x00\xe1\xc9\xef\x38\x7e\xa7\x28\x05\xef\xa2\x0f\x27\x38\xef"
+"\x02\x38\xe5\xd5\xeb\x46\xcd\x7f\x2d\xaf\x90\xcb\x79\x42\x4b\x7b\xd1\xe1\xc9\x57\x17\x9f\x5f\x4f\xaf\x94\x00\x80\x34\xef\x1a\x20"
+"\x9a\x85\x04\x27\xbe\x07\xf0\x58\xd8\xf5\x05\x04\x28\x03\xf1\x37\xc9\xf1\xc9\xef\x31\x36\x00\x0b\x31\x37\x00\x0d\x02\x38\x3e\x30"
+"\xd7\xc9\x2a\x38\x3e\x2d\xd7\xef\xa0\xc3\xc4\xc5\x02\x38\xd9\xe5\xd9\xef\x31\x27\xc2\x03\xe2\x01\xc2\x02\x38\x7e\xa7\x20\x47\xcd"
+"\x7f\x2d\x06\x10\x7a\xa7\x20\x06\xb3\x28\x09\x53\x06\x08\xd5\xd9\xd1\xd9\x18\x57\xef\xe2\x38\x7e\xd6\x7e\xcd\xc1\x2d\x57\x3a\xac"
+"\x5c\x92\x32\xac\x5c\x7a\xcd\x4f\x2d\xef\x31\x27\xc1\x03\xe1\xb6\x09\xf1\x7d\xe5\x32\xa1\x5c\x3d\x17\x9f\x3c\x21\xab\x5c\x77\x23"
+"\x86\x77\xe1\xc3\xcf\x2e\xd6\x80\xfe\x1c\x38\x13\xcd\xc1\x2d\xd6\x07\x47\x21\xac\x5c\x86\x77\x78\xed\x44\xcd\x4f\x2d\x18\x92\xeb"
+"\xcd\xba\x2f\xd9\xcb\xfa\x7d\xd9\xd6\x80\x47\xcb\x23\xcb\x12\xd9\xcb\x13\xcb\x12\xd9\x21\xaa\x5c\x0e\x05\x7e\x8f\x27\x77\x2b\x0d"
+"\x20\xf8\x10\xe7\xaf\x21\xa6\x5c\x11\xa1\x5c\x06\x09\xed\x6f\x0e\xff\xed\x6f\x20\x04\x0d\x0c\x20\x0a\x12\x13\xfd\x34\x71\xfd\x34"
+"\x72\x0e\x00\xcb\x40\x28\x01\x23\x10\xe7\x3a\xab\x5c\xd6\x09\x38\x0a\xfd\x35\x71\x3e\x04\xfd\xbe\x6f\x18\x41\xef\x02\xe2\x38\x60"
+"\x00\xf0\xe1\x3e\x80\x95\x2e\x00\xcb\xfa\xd9\xcd\xdd\x2f\xfd\x7e\x71\xfe\x08\x38\x06\xd9\xcb\x12\xd9\x18\x20\x01\x00\x02\x7b\xcd"
+"\x8b\x2f\x5f\x7a\xcd\x8b\x2f\x57\xc5\xd9\xc1\x10\xf1\x21\xa1\x5c\x79\xfd\x4e\x71\x09\x77\xfd\x34\x71\x18\xd3\xf5\x21\xa1\x5c\xfd"
+"\x4e\x71\x06\x00\x09\x41\xf1\x2b\x7e\xce\x00\x77\xa7\x28\x05\xfe\x0a\x3f\x30\x08\x10\xf1\x36\x01\x04\xfd\x34\x72\xfd\x70\x71\xef"
+"\x02\x38\xd9\xe1\xd9\xed\x4b\xab\x5c\x21\xa1\x5c\x78\xfe\x09\x38\x04\xfe\xfc\x38\x26\xa7\xcc\xef\x15\xaf\x90\xfa\x52\x2f\x47\x18"
+"\x0c\x79\xa7\x28\x03\x7e\x23\x0d\xcd\xef\x15\x10\xf4\x79\xa7\xc8\x04\x3e\x2e\xd7\x3e\x30\x10\xfb\x41\x18\xe6\x50\x15\x06\x01\xcd"
+"\x4a\x2f\x3e\x45\xd7\x4a\x79\xa7\xf2\x83\x2f\xed\x44\x4f\x3e\x2d\x18\x02\x3e\x2b\xd7\x06\x00\xc3\x1b\x1a\xd5\x6f\x26\x00\x5d\x54"
+"\x29\x29\x19\x29\x59\x19\x4c\x7d\xd1\xc9\x7e\x36\x00\xa7\xc8\x23\xcb\x7e\xcb\xfe\x2b\xc8\xc5\x01\x05\x00\x09\x41\x4f\x37\x2b\x7e"
+"\x2f\xce\x00\x77\x10\xf8\x79\xc1\xc9\xe5\xf5\x4e\x23\x46\x77\x23\x79\x4e\xc5\x23\x06\xe0\xeb\x57\x5e\xd5\x23\x56\x23\x5e\xd5\xd9"
+"\xd1\xe1\xc1\xd9\x0a\x00\xf0\x04\xf1\xe1\xc9\xa7\xc8\xfe\x21\x30\x16\xc5\x47\xd9\xcb\x2d\xcb\x1a\xcb\x1b\xd9\x05\x00\xf0\x1b\x10"
+"\xf2\xc1\xd0\xcd\x04\x30\xc0\xd9\xaf\x2e\x00\x57\x5d\xd9\x11\x00\x00\xc9\x1c\xc0\x14\xc0\xd9\x1c\x20\x01\x14\xd9\xc9\xeb\xcd\x6e"
+"\x34\xeb\x1a\xb6\x20\x26\xd5\x23\xe5\x2c\x05\x40\x23\x23\x23\x7e\x5f\x00\xb1\xe1\xeb\x09\xeb\x8e\x0f\xce\x00\x20\x0b\x9f\x74\x05"
+"\xf0\x2d\x2b\x2b\x2b\xd1\xc9\x2b\xd1\xcd\x93\x32\xd9\xe5\xd9\xd5\xe5\xcd\x9b\x2f\x47\xeb\xcd\x9b\x2f\x4f\xb8\x30\x03\x78\x41\xeb"
+"\xf5\x90\xcd\xba\x2f\xcd\xdd\x2f\xf1\xe1\x77\xe5\x68\x61\x19\xd9\xeb\xed\x4a\xeb\x7c\x8d\x6f\x1f\xad\xd9\xeb\xe1\x1f\x30\xe6\x0f"
+"\xf1\x0f\xdd\x2f\x34\x28\x23\xd9\x7d\xe6\x80\xd9\x23\x77\x2b\x28\x1f\x7b\xed\x44\x3f\x5f\x7a\x2f\xce\x00\x57\xd9\x7b\x2f\xce\x00"
+"\x0b\x00\xf0\x46\x30\x07\x1f\xd9\x34\xca\xad\x31\xd9\x57\xd9\xaf\xc3\x55\x31\xc5\x06\x10\x7c\x4d\x21\x00\x00\x29\x38\x0a\xcb\x11"
+"\x17\x30\x03\x19\x38\x02\x10\xf3\xc1\xc9\xcd\xe9\x34\xd8\x23\xae\xcb\xfe\x2b\xc9\x1a\xb6\x20\x22\xd5\xe5\xd5\xcd\x7f\x2d\xeb\xe3"
+"\x41\xcd\x7f\x2d\x78\xa9\x4f\xe1\xcd\xa9\x30\xeb\xe1\x38\x0a\x7a\xb3\x20\x01\x4f\xcd\x8e\x2d\xd1\xc9\xb2\x00\x50\xaf\xcd\xc0\x30"
+"\xd8\xb7\x00\xf3\x15\xeb\xcd\xc0\x30\xeb\x38\x5a\xe5\xcd\xba\x2f\x78\xa7\xed\x62\xd9\xe5\xed\x62\xd9\x06\x21\x18\x11\x30\x05\x19"
+"\xd9\xed\x5a\xd9\xd9\xcb\x1c\xcb\x1d\x05\x00\xf1\x12\x18\xcb\x19\xd9\xcb\x19\x1f\x10\xe4\xeb\xd9\xeb\xd9\xc1\xe1\x78\x81\x20\x01"
+"\xa7\x3d\x3f\x17\x3f\x1f\xf2\x46\x31\x30\x68\xa7\x3c\x20\x65\x02\xf1\x19\x7a\xd9\x20\x5c\x77\xd9\x78\xd9\x30\x15\x7e\xa7\x3e\x80"
+"\x28\x01\xaf\xd9\xa2\xcd\xfb\x2f\x07\x77\x38\x2e\x23\x77\x2b\x18\x29\x06\x20\xd9\xcb\x7a\xd9\x20\x12\x07\xf5\x02\x01\x05\x00\xf0"
+"\x25\x35\x28\xd7\x10\xea\x18\xd7\x17\x30\x0c\xcd\x04\x30\x20\x07\xd9\x16\x80\xd9\x34\x28\x18\xe5\x23\xd9\xd5\xd9\xc1\x78\x17\xcb"
+"\x16\x1f\x77\x23\x71\x23\x72\x23\x73\xe1\xd1\xd9\xe1\xd9\xc9\xcf\x05\xcd\x93\x32\xeb\xc0\x00\x20\x38\xf4\xbd\x00\x01\xc6\x00\x00"
+"\xbf\x00\xf1\x15\xd9\xe5\x60\x69\xd9\x61\x68\xaf\x06\xdf\x18\x10\x17\xcb\x11\xd9\xcb\x11\xcb\x10\xd9\x29\xd9\xed\x6a\xd9\x38\x10"
+"\xed\x52\xd9\xed\x52\xd9\x30\x0f\xd4\x00\x42\xa7\x18\x08\xa7\x11\x00\xf0\x04\x37\x04\xfa\xd2\x31\xf5\x28\xe1\x5f\x51\xd9\x59\x50"
+"\xf1\xcb\x18\xf1\xcb\x18\xd9\x00\xf0\x05\x91\xc3\x3d\x31\x7e\xa7\xc8\xfe\x81\x30\x06\x36\x00\x3e\x20\x18\x51\xfe\x91\x20\xb4\x19"
+"\xf0\x0e\x3e\x80\xa6\x2b\xb6\x2b\x20\x03\x3e\x80\xae\x2b\x20\x36\x77\x23\x36\xff\x2b\x3e\x18\x18\x33\x30\x2c\xd5\x2f\xc6\x91\x6f"
+"\x02\xf1\x0f\x2b\x2b\x0e\x00\xcb\x7a\x28\x01\x0d\xcb\xfa\x06\x08\x90\x80\x38\x04\x5a\x16\x00\x90\x28\x07\x47\xcb\x3a\xcb\x1b\x10"
+"\xfa\x7d\x01\xc0\x7e\xd6\xa0\xf0\xed\x44\xd5\xeb\x2b\x47\xcb\x38\x02\x00\xf0\x0f\x28\x05\x36\x00\x2b\x10\xfb\xe6\x07\x28\x09\x47"
+"\x3e\xff\xcb\x27\x10\xfc\xa6\x77\xeb\xd1\xc9\xcd\x96\x32\xeb\x7e\xa7\xc0\xca\x01\xf0\x0b\xaf\x23\x77\x2b\x77\x06\x91\x7a\xa7\x20"
+"\x08\xb3\x42\x28\x10\x53\x58\x06\x89\xeb\x05\x29\x30\xfc\xcb\x09\x9c\x01\x10\xeb\x16\x1d\xf7\x1a\x2b\x70\xd1\xc9\x00\xb0\x00\x40"
+"\xb0\x00\x01\x30\x00\xf1\x49\x0f\xda\xa2\x40\xb0\x00\x0a\x8f\x36\x3c\x34\xa1\x33\x0f\x30\xca\x30\xaf\x31\x51\x38\x1b\x35\x24\x35"
+"\x3b\x02\x00\x37\x14\x30\x2d\x0e\x00\xf1\x80\x3b\x35\x9c\x35\xde\x35\xbc\x34\x45\x36\x6e\x34\x69\x36\xde\x35\x74\x36\xb5\x37\xaa"
+"\x37\xda\x37\x33\x38\x43\x38\xe2\x37\x13\x37\xc4\x36\xaf\x36\x4a\x38\x92\x34\x6a\x34\xac\x34\xa5\x34\xb3\x34\x1f\x36\xc9\x35\x01"
+"\x35\xc0\x33\xa0\x36\x86\x36\xc6\x33\x7a\x36\x06\x35\xf9\x34\x9b\x36\x83\x37\x14\x32\xa2\x33\x4f\x2d\x97\x32\x49\x34\x1b\x34\x2d"
+"\x34\x0f\x34\xcd\xbf\x35\x78\x32\x67\x5c\xd9\xe3\xd9\xed\x53\x65\x5c\xd9\x7e\x23\xe5\xa7\xf2\x80\x33\x57\xe6\x60\x0f\x0f\x0f\x0f"
+"\xc6\x7c\x6f\x7a\xe6\x1f\x18\x0e\xfe\x18\x30\x08\xd9\x01\xfb\xff\x54\x5d\x09\xd9\x07\x6f\x11\xd7\x32\x26\xc5\x15\xf0\x08\x21\x65"
+"\x33\xe3\xd5\xd9\xed\x4b\x66\x5c\xc9\xf1\x3a\x67\x5c\xd9\x18\xc3\xd5\xe5\x01\x05\x00\x58\x1d\x23\xd1\xc9\x2e\x0a\x00\x56\x00\xf0"
+"\x18\xc9\xcd\xa9\x33\xed\xb0\xc9\x62\x6b\xcd\xa9\x33\xd9\xe5\xd9\xe3\xc5\x7e\xe6\xc0\x07\x07\x4f\x0c\x7e\xe6\x3f\x20\x02\x23\x7e"
+"\xc6\x50\x12\x3e\x05\x91\x23\x13\xbf\x25\xf0\x11\xc1\xe3\xd9\xe1\xd9\x47\xaf\x05\xc8\x12\x13\x18\xfa\xa7\xc8\xf5\xd5\x11\x00\x00"
+"\xcd\xc8\x33\xd1\xf1\x3d\x18\xf2\x4f\x07\x07\x81\xdd\x1c\x50\xc9\xd5\x2a\x68\x5c\xe1\x2f\xf0\x03\xc0\x33\xe1\xc9\x62\x6b\xd9\xe5"
+"\x21\xc5\x32\xd9\xcd\xf7\x33\xcd\xc8\x33\x80\x02\x22\xe5\xeb\x1f\x00\x10\xeb\xac\x0a\xf0\x25\xe1\xc9\x06\x05\x1a\x4e\xeb\x12\x71"
+"\x23\x13\x10\xf7\xeb\xc9\x47\xcd\x5e\x33\x31\x0f\xc0\x02\xa0\xc2\x31\xe0\x04\xe2\xc1\x03\x38\xcd\xc6\x33\xcd\x62\x33\x0f\x01\xc2"
+"\x02\x35\xee\xe1\x03\x38\xc9\x06\xff\x18\x06\xae\x03\xf2\x0b\x06\x00\x7e\xa7\x28\x0b\x23\x78\xe6\x80\xb6\x17\x3f\x1f\x77\x2b\xc9"
+"\xd5\xe5\xcd\x7f\x2d\xe1\x78\xb1\x2f\xa3\x03\x00\x24\x00\x93\xd5\x11\x01\x00\x23\xcb\x16\x2b\x9f\x13\x00\xa0\x99\x1e\xed\x78\x18"
+"\x04\xcd\x99\x1e\x0a\xd7\x11\xb0\x99\x1e\x21\x2b\x2d\xe5\xc5\xc9\xcd\xf1\x2b\x34\x1d\xf0\x09\x23\x1a\xcd\x8d\x2c\x38\x09\xd6\x90"
+"\x38\x19\xfe\x15\x30\x15\x3c\x3d\x87\x87\x87\xfe\xa8\x30\x0c\x82\x29\xf0\x01\x81\x4f\x30\x01\x04\xc3\x2b\x2d\xcf\x09\xe5\xc5\x47"
+"\x7e\x23\xb6\x02\x00\x51\x78\xc1\xe1\xc0\x37\x39\x04\x12\x3e\x93\x00\xf0\x08\x18\x05\xaf\x23\xae\x2b\x07\xe5\x3e\x00\x77\x23\x77"
+"\x23\x17\x77\x1f\x23\x77\x23\x77\xe1\xc9\x22\x18\x51\xeb\xd8\x37\x18\xe7\x09\x00\x42\xd0\xa7\x18\xde\x09\x00\xf0\x18\xd5\x1b\xaf"
+"\x12\x1b\x12\xd1\xc9\x78\xd6\x08\xcb\x57\x20\x01\x3d\x0f\x30\x08\xf5\xe5\xcd\x3c\x34\xd1\xeb\xf1\xcb\x57\x20\x07\x0f\xf5\xcd\x0f"
+"\x30\x18\x33\x0f\x94\x09\xf1\x1b\xd5\xc5\xcd\xf1\x2b\xe1\x7c\xb5\xe3\x78\x20\x0b\xb1\xc1\x28\x04\xf1\x3f\x18\x16\xf1\x18\x13\xb1"
+"\x28\x0d\x1a\x96\x38\x09\x20\xed\x0b\x13\x23\xe3\x2b\x18\xdf\xc1\xf1\xa7\x4d\x08\xe0\xf5\xdc\x01\x35\xf1\xf5\xd4\xf9\x34\xf1\x0f"
+"\xd4\x01\x35\xe0\x00\x02\x41\x00\xc3\xe5\xd5\xc5\x09\x44\x4d\xf7\xcd\xb2\x2a\xc1\xe1\x14\x0a\x03\x08\x00\x00\xf9\x16\x50\xfb\xff"
+"\xe5\x19\xd1\xb5\x12\x43\x38\x0e\x20\x0c\x79\x0f\x70\xcd\xb2\x2a\xeb\xc9\xcf\x0a\xac\x14\x41\x78\xc6\xe3\x9f\x8c\x00\x30\x03\xf7"
+"\xe1\xb7\x0d\x10\xd5\x47\x0f\x10\x36\xac\x1f\x11\xbe\x24\x0e\x54\x0d\x20\x07\xe1\xf1\xab\x0e\x02\x4f\x0f\x40\xfe\xcd\xfb\x24\x7a"
+"\x0d\x20\x18\xa0\xc7\x0f\x30\x22\x5b\x5c\x3f\x20\x02\x57\x26\x30\xcd\xe3\x2d\x45\x26\x12\xd1\x57\x1d\x21\x44\x4d\x69\x00\x00\xb1"
+"\x13\x80\x10\xd2\x9f\x1e\x2a\x51\x5c\xe5\xc1\x15\xd0\xe6\x15\x01\x00\x00\x30\x03\x0c\xf7\x12\xcd\xb2\x2a\x2f\x00\xb0\xc3\xbf\x35"
+"\xcd\xf1\x2b\x78\xb1\x28\x01\x1a\xc1\x01\xf0\x1c\xf1\x2b\xc3\x2b\x2d\xd9\xe5\x21\x67\x5c\x35\xe1\x20\x04\x23\xd9\xc9\xd9\x5e\x7b"
+"\x17\x9f\x57\x19\xd9\xc9\x13\x13\x1a\x1b\x1b\xa7\x20\xef\xd9\x23\xd9\xc9\xf1\xd9\xe3\xd9\xc9\x62\x32\xa1\xe0\x05\x27\xe0\x01\xc0"
+"\x04\x03\xe0\x38\xcc\x08\xf0\x0f\x04\x3a\x38\xc9\x31\x3a\xc0\x03\xe0\x01\x30\x00\x03\xa1\x03\x38\xc9\xef\x3d\x34\xf1\x38\xaa\x3b"
+"\x29\x04\x31\x27\xc3\x03\x24\x12\xf0\x14\x88\x13\x36\x58\x65\x66\x9d\x78\x65\x40\xa2\x60\x32\xc9\xe7\x21\xf7\xaf\x24\xeb\x2f\xb0"
+"\xb0\x14\xee\x7e\xbb\x94\x58\xf1\x3a\x7e\xf8\xcf\xe3\xb9\x08\xf0\x06\x20\x07\x38\x03\x86\x30\x09\xcf\x05\x38\x07\x96\x30\x04\xed"
+"\x44\x77\xc9\xef\x02\xa0\x4f\x00\x10\x31\x33\x19\x80\xcf\x09\xa0\x02\x38\x7e\x36\x80\x8a\x12\xf0\x4c\x34\x38\x00\x03\x01\x31\x34"
+"\xf0\x4c\xcc\xcc\xcd\x03\x37\x00\x08\x01\xa1\x03\x01\x38\x34\xef\x01\x34\xf0\x31\x72\x17\xf8\x04\x01\xa2\x03\xa2\x03\x31\x34\x32"
+"\x20\x04\xa2\x03\x8c\x11\xac\x14\x09\x56\xda\xa5\x59\x30\xc5\x5c\x90\xaa\x9e\x70\x6f\x61\xa1\xcb\xda\x96\xa4\x31\x9f\xb4\xe7\xa0"
+"\xfe\x5c\xfc\xea\x1b\x43\xca\x36\xed\xa7\x9c\x7e\x5e\xf0\x6e\x23\x80\x93\x04\x0f\x70\x00\xf2\x24\x34\xee\x22\xf9\x83\x6e\x04\x31"
+"\xa2\x0f\x27\x03\x31\x0f\x31\x0f\x31\x2a\xa1\x03\x31\x37\xc0\x00\x04\x02\x38\xc9\xa1\x03\x01\x36\x00\x02\x1b\x38\xc9\xef\x39\x2a"
+"\xa1\x03\xe0\x00\x06\x1b\x33\x03\xef\x39\x31\x0d\x13\xf0\x0b\x86\x14\xe6\x5c\x1f\x0b\xa3\x8f\x38\xee\xe9\x15\x63\xbb\x23\xee\x92"
+"\x0d\xcd\xed\xf1\x23\x5d\x1b\xea\x04\x2b\x01\xf2\x08\x1f\x01\x20\x05\x38\xc9\xcd\x97\x32\x7e\xfe\x81\x38\x0e\xef\xa1\x1b\x01\x05"
+"\x31\x36\xa3\x01\x43\x00\x23\xa0\x01\x44\x00\xf1\x1e\x8c\x10\xb2\x13\x0e\x55\xe4\x8d\x58\x39\xbc\x5b\x98\xfd\x9e\x00\x36\x75\xa0"
+"\xdb\xe8\xb4\x63\x42\xc4\xe6\xb5\x09\x36\xbe\xe9\x36\x73\x1b\x5d\xec\xd8\xde\x63\xbe\xf0\x61\xa1\xb3\x0c\xb0\x00\xc0\x31\x31\x04"
+"\xa1\x03\x1b\x28\xa1\x0f\x05\x24\x31\xc0\x00\x30\x22\xa3\x03\xa0\x00\xf0\x3d\x31\x30\x00\x1e\xa2\x38\xef\x01\x31\x30\x00\x07\x25"
+"\x04\x38\xc3\xc4\x36\x02\x31\x30\x00\x09\xa0\x01\x37\x00\x06\xa1\x01\x05\x02\xa1\x38\xc9\xdd\xe5\xfd\xcb\x01\x66\x28\x03\xcd\x42"
+"\x3a\xcd\xbf\x02\xdd\xe1\xc9\x0e\xfd\x16\xff\x1e\xbf\x42\x3e\x07\xed\x79\xed\x60\x3e\x0e\xed\x79\xed\x78\xf6\xf0\x6f\xc9\x42\x0b"
+"\x00\x32\x43\xed\x69\x09\x00\xf4\x18\xed\x78\xc9\x7d\xe6\xfe\x6f\x18\xe9\x7d\xf6\x01\x6f\x18\xe3\x10\xfe\xc9\xc5\x06\x10\xcd\xb3"
+"\x38\xc1\x10\xf7\xc9\xc5\xcd\x9f\x38\xc1\xe6\x20\x28\x02\x10\xf5\x0c\x00\x10\x20\x0c\x00\x70\xcd\x7f\x38\x06\x01\x18\x05\x07\x00"
+"\x14\x04\x24\x00\xf1\x1a\x40\xaf\xc5\xf5\xcd\xad\x38\x06\xa3\xcd\xc0\x38\x20\x31\xcd\xa7\x38\x18\x02\xff\xff\x06\x2b\xcd\xb3\x38"
+"\xcd\x9f\x38\xcb\x6f\x28\x04\xf1\x37\x18\x03\xf1\x37\x3f\x1f\x26\x00\x10\x26\x18\x00\xf0\x35\xa7\x38\x06\x23\xcd\xb3\x38\xf1\xc1"
+"\x10\xc4\xc9\xf1\xc1\xcd\xad\x38\xaf\x32\x88\x5b\x3c\x37\x3f\xc9\xcd\x7f\x38\x3a\x88\x5b\xe6\x80\x20\x57\xcd\x9f\x38\xe6\x20\x28"
+"\xe4\x3a\x88\x5b\xa7\x20\x0b\x3c\x32\x88\x5b\x3e\x4c\x32\x89\x5b\x18\x42\x3a\x89\x5b\x3d\x32\x89\x5b\x20\x39\x33\x00\xb0\x32\x89"
+"\x5b\x32\x8a\x5b\xcd\xa7\x38\x06\x21\x7d\x00\x10\xb6\x87\x00\x60\x24\xcd\xcc\x38\x28\xac\x14\x00\xf0\x27\x0f\xcd\xb6\x38\xcd\xdf"
+"\x38\x20\x9f\xcb\xff\xe6\xf0\x32\x88\x5b\xaf\xcb\x3f\xc9\xaf\x37\xc9\xaf\x3c\x37\xc9\xcd\x38\x39\x3a\x88\x5b\x2f\xe6\xc0\xc0\xdd"
+"\x21\x8a\x5b\x06\x05\xc5\xcd\xd8\x38\xc2\x3a\x3a\xcb\x7f\x28\x21\x32\x00\x60\x7a\xc1\xc5\x4f\xdd\x7e\x13\x0b\x32\x0c\xcb\x39\x02"
+"\x00\xf0\x1c\xe6\xf0\x18\x02\xe6\x0f\xb1\xdd\x77\x00\xc1\xcb\x40\x20\x02\xdd\x2b\x10\xcb\x1e\x80\xdd\x21\x88\x5b\x21\x3f\x3a\x06"
+"\x03\xdd\x7e\x00\xa6\x28\x21\xcb\x7b\x28\x42\xc5\xf5\x78\x00\x01\x30\x3d\xcb\x27\x02\x00\xf3\x37\xf6\x07\x47\xf1\xcb\x27\xda\x13"
+"\x3a\x10\xf9\x58\xc1\x20\x25\xdd\x23\x23\x10\xd4\xcb\x7b\x20\x07\x7b\xe6\xfc\x28\x02\x1d\x1d\x3a\x8a\x5b\xe6\x08\x28\x06\x7b\xe6"
+"\x7f\xc6\x12\x5f\x7b\xc6\x5a\x5f\xaf\xc9\xc1\xc9\xaf\x3c\xc9\x0f\xff\xf2\x1e\x80\x3a\x78\x5c\xe6\x01\x20\x04\xcd\xa0\x39\x8c\x37"
+"\x5a\x0c\x7e\xfe\x5b\x38\x91\x37\x61\xe9\xcd\xae\x3a\xc0\x7b\x92\x37\x12\x2a\x92\x37\x18\x23\x92\x37\x10\x0a\x92\x37\xc0\xcb\x3f"
+"\x77\x23\xcd\xd7\x3a\x73\x7b\x32\x08\x5c\xae\x12\x00\x8e\x37\x21\x0a\x23\x8e\x37\x00\x1b\x00\xf1\x0a\x5e\x18\xe6\x7b\x21\x66\x5b"
+"\xcb\x46\x28\x06\xfe\x6d\x30\x1a\xaf\xc9\xfe\x80\x30\x14\xfe\x6c\x20\xf6\xef\x28\x07\x05\x00\xa2\xaf\x3c\xc9\xe5\x7b\xd6\x5b\x16"
+"\x00\x5f\x2f\x00\xf0\x48\x05\x21\x13\x3b\x18\x25\x21\x25\x3b\xfe\x11\x38\x1e\x21\x21\x3b\xfe\x15\x28\x17\xfe\x16\x28\x13\x18\x03"
+"\x00\xff\xff\xfe\x17\x28\x0a\x21\x18\x3b\xfe\x21\x30\x03\x21\x13\x3b\x19\x5e\xe1\xc9\x2e\x0d\x33\x32\x31\x29\x28\x2a\x2f\x2d\x39"
+"\x38\x37\x2b\x36\x35\x34\x30\xa5\x0d\xa6\xa7\xa8\xa9\xaa\x0b\x0c\x07\x09\x0a\x08\xac\xad\xae\xaf\xb0\xb1\xb2\xb3\xb4\xcb\x02\xc1"
+"\x20\x05\xaf\x11\x36\x15\xc9\x21\x0f\x01\xe3\xc3\x71\x2d\x10\x66\xdb\x1b\x81\x0a\x7e\xc9\x21\x12\x01\x18\xec\x22\x00\xf0\x02\x04"
+"\xdf\xfe\x0d\xc9\x21\x15\x01\x18\xdd\xcd\x8e\x02\x0e\x00\x20\x0d\x26\x15\x11\x08\x26\x15\x30\xc3\x57\x26\x23\x00\xf0\x1b\xca\x60"
+"\x26\xf3\xcd\xa0\x39\xfb\x20\x0c\xcd\xae\x3a\x20\x07\xcd\xd7\x3a\x7b\xc3\x57\x26\x0e\x00\xc3\x60\x26\xfe\xa3\x28\x0c\xfe\xa4\x28"
+"\x08\xd6\xa5\xd2\x5f\x0b\xc3\x56\xd3\x30\xf0\x09\x66\x28\xf2\x11\xc9\x3b\xd5\xd6\xa3\x11\xd2\x3b\x28\x03\x11\xda\x3b\x3e\x04\xf5"
+"\xc3\x17\x0c\x37\xee\x2d\xf7\x04\xc0\xc3\x03\x0b\x53\x50\x45\x43\x54\x52\x55\xcd\x50\x4c\x41\xd9\xc3\x01\x3c\x18\x01\x0f\x0b\x00"
+"\x00\x85\xff\xff\xc3\xa0\x39\xc3\x10\x3c\x03\x00\x07\xbc\x1c\x11\xd8\x50\x2a\x10\x02\xaf\x32\xf0\x03\x32\x3c\x5c\x3e\x16\xd7\xaf"
+"\xd7\xaf\xd7\x1e\x08\x43\x50\x78\x3d\xcb\x17\x02\x00\xf0\x25\x82\x3d\x32\x8f\x5c\x21\x8f\x3c\x4b\x7e\xd7\x23\x0d\x20\xfa\x10\xe7"
+"\x43\x15\x20\xe3\x21\x00\x48\x54\x5d\x13\xaf\x77\x01\xff\x0f\xed\xb0\xeb\x11\x00\x59\x01\x00\x02\xed\xb0\xf3\x11\x70\x03\x2e\x07"
+"\x01\x99\x00\xb1\x07\xe2\xfb\x7d\xee\x10\x6f\xd3\xfe\x1b\x7a\xb3\x20\xed\x01\x00\x13\x00\x01\x18\x00\xaf\x18\xd9\x13\x00\x31\x39"
+"\x13\x01\x38\x36\xab\x00\x00\x0f\x13\x00\x4c\xa2\x10\x10\x10\x10\x00\x10\x00\x00\x24\x24\x69\x00\xf2\x13\x24\x7e\x24\x24\x7e\x24"
+"\x00\x00\x08\x3e\x28\x3e\x0a\x3e\x08\x00\x62\x64\x08\x10\x26\x46\x00\x00\x10\x28\x10\x2a\x44\x3a\x00\x00\x08\x10\x28\x00\x90\x04"
+"\x08\x08\x08\x08\x04\x00\x00\x20\x41\x00\xf0\x01\x20\x00\x00\x00\x14\x08\x3e\x08\x14\x00\x00\x00\x08\x08\x3e\x08\x8e\x39\x01\x0b"
+"\x00\x01\x2d\x00\x12\x3e\x32\x00\xf0\x15\x00\x00\x18\x18\x00\x00\x00\x02\x04\x08\x10\x20\x00\x00\x3c\x46\x4a\x52\x62\x3c\x00\x00"
+"\x18\x28\x08\x08\x08\x3e\x00\x00\x3c\x42\x02\x3c\x40\x7e\x08\x00\xf1\x02\x0c\x02\x42\x3c\x00\x00\x08\x18\x28\x48\x7e\x08\x00\x00"
+"\x7e\x40\x7c\x10\x00\x40\x3c\x40\x7c\x42\x18\x00\x10\x7e\x40\x00\x10\x10\x28\x00\x11\x3c\x10\x00\x51\x3c\x42\x42\x3e\x02\xee\x01"
+"\x20\x10\x00\xc8\x00\x00\x04\x00\x10\x10\x61\x00\x30\x04\x08\x10\xa0\x00\x41\x00\x00\x3e\x00\x81\x00\x30\x10\x08\x04\xbc\x00\xe0"
+"\x3c\x42\x04\x08\x00\x08\x00\x00\x3c\x4a\x56\x5e\x40\x3c\x48\x00\xc0\x42\x7e\x42\x42\x00\x00\x7c\x42\x7c\x42\x42\x7c\x10\x00\x20"
+"\x40\x40\x68\x00\x61\x78\x44\x42\x42\x44\x78\x80\x00\x10\x40\x98\x00\x61\x7e\x40\x7c\x40\x40\x40\x20\x00\x10\x4e\x20\x00\x10\x42"
+"\x37\x00\x40\x42\x00\x00\x3e\x08\x01\x61\x3e\x00\x00\x02\x02\x02\x90\x00\x90\x44\x48\x70\x48\x44\x42\x00\x00\x40\x01\x00\x70\x7e"
+"\x00\x00\x42\x66\x5a\x42\x60\x00\x60\x42\x62\x52\x4a\x46\x42\x40\x00\x11\x42\x28\x00\x00\x6e\x00\x02\x50\x00\x40\x42\x52\x4a\x3c"
+"\x80\x00\x20\x42\x7c\x38\x00\x31\x3c\x40\x3c\xf0\x00\x10\xfe\x58\x01\x40\x10\x00\x00\x42\x01\x00\x12\x3c\x08\x00\x22\x24\x18\x08"
+"\x00\xf0\x00\x5a\x24\x00\x00\x42\x24\x18\x18\x24\x42\x00\x00\x82\x44\x28\xc2\x01\x20\x00\x7e\x57\x01\x40\x7e\x00\x00\x0e\x90\x00"
+"\x61\x0e\x00\x00\x00\x40\x20\x00\x01\x10\x70\x48\x00\x61\x70\x00\x00\x10\x38\x54\x28\x00\x02\x8c\x01\xf0\x08\xff\x00\x1c\x22\x78"
+"\x20\x20\x7e\x00\x00\x00\x38\x04\x3c\x44\x3c\x00\x00\x20\x20\x3c\x22\x22\x48\x01\xb0\x1c\x20\x20\x20\x1c\x00\x00\x04\x04\x3c\x44"
+"\x18\x00\x40\x00\x38\x44\x78\x28\x01\x32\x0c\x10\x18\x40\x00\x00\x17\x00\x90\x04\x38\x00\x40\x40\x78\x44\x44\x44\x73\x01\xf0\x07"
+"\x30\x10\x10\x38\x00\x00\x04\x00\x04\x04\x04\x24\x18\x00\x20\x28\x30\x30\x28\x24\x00\x00\x77\x00\xd0\x10\x0c\x00\x00\x00\x68\x54"
+"\x54\x54\x54\x00\x00\x00\x2f\x00\x10\x44\x70\x00\x42\x44\x44\x44\x38\x10\x00\x11\x78\x01\x01\x70\x44\x44\x3c\x04\x06\x00\x00\x78"
+"\x00\x00\x48\x02\x50\x38\x40\x38\x04\x78\xb0\x00\x21\x10\x10\x40\x00\x13\x44\x30\x00\x40\x44\x44\x28\x28\x4f\x02\xc0\x44\x54\x54"
+"\x54\x28\x00\x00\x00\x44\x28\x10\x28\x50\x00\x10\x44\x40\x00\x80\x38\x00\x00\x7c\x08\x10\x20\x7c\x00\x01\x40\x30\x08\x08\x0e\x87"
+"\x02\x00\x09\x01\xb0\x00\x00\x70\x10\x0c\x10\x10\x70\x00\x00\x14\x34\x00\xa0\x00\x00\x3c\x42\x99\xa1\xa1\x99\x42\x3c"
+;
+unsigned char dump_amstrad_zx128k_1[16384];
+#include <string.h>
+static void _zx128k_dump_init_lz4(const unsigned char* src, int src_size, unsigned char* dst) {
+    const unsigned char* end = src + src_size;
+    while (src < end) {
+        const unsigned char token = *src++;
+        int len = token >> 4;
+        if (len == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }
+        memcpy(dst, src, len); dst += len; src += len;
+        if (src >= end) { break; }
+        const unsigned char* m = dst - (src[0] | (src[1]<<8)); src += 2;
+        len = (token & 15) + 4;
+        if ((token & 15) == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }
+        while (len-- > 0) { *dst++ = *m++; }
+    }
+}
+static void zx128k_dump_init(void) {
+    _zx128k_dump_init_lz4(dump_amstrad_zx128k_0_lz4, sizeof(dump_amstrad_zx128k_0_lz4) - 1, dump_amstrad_zx128k_0);
+    _zx128k_dump_init_lz4(dump_amstrad_zx128k_1_lz4, sizeof(dump_amstrad_zx128k_1_lz4) - 1, dump_amstrad_zx128k_1);
+}
+#if defined(_MSC_VER)
+#pragma section(".CRT$XCU", read)
+__declspec(allocate(".CRT$XCU")) void (*_zx128k_dump_init_ctor)(void) = zx128k_dump_init;
+#else
+__attribute__((constructor)) static void _zx128k_dump_init_ctor(void) { zx128k_dump_init(); }
+#endif
+dump_item zx128k_dump_items[ZX128K_DUMP_NUM_ITEMS] = {
 { "amstrad_zx128k_0", dump_amstrad_zx128k_0, 16384 },
 { "amstrad_zx128k_1", dump_amstrad_zx128k_1, 16384 },
 };
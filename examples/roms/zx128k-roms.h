@@ -1,9 +1,12 @@
 #pragma once
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include <stdint.h>
 extern unsigned char dump_amstrad_zx128k_0[16384];
 extern unsigned char dump_amstrad_zx128k_1[16384];
+#ifndef DUMP_ITEM_DEFINED
+#define DUMP_ITEM_DEFINED
 typedef struct { const char* name; const uint8_t* ptr; int size; } dump_item;
-#define DUMP_NUM_ITEMS (2)
-extern dump_item dump_items[DUMP_NUM_ITEMS];
+#endif
+#define ZX128K_DUMP_NUM_ITEMS (2)
+extern dump_item zx128k_dump_items[ZX128K_DUMP_NUM_ITEMS];
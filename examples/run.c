@@ -0,0 +1,990 @@
+//------------------------------------------------------------------------------
+//  run.c
+//
+//  Headless scripted runner for regression and batch checks of guest
+//  programs. Each script boots a system core without display, audio or
+//  throttling, types text, runs frames, and hashes or dumps the screen:
+//
+//      # comment
+//      boot c64                    cold boot a system (atom, c64, cpc6128,
+//                                  kc87, mz800, z1013, zx128k)
+//      load game.prg               quickload a .prg (C64), an AMSDOS binary
+//                                  (CPC), or a .sna/.z80 (ZX Spectrum)
+//      type RUN\n                  type text, \n is Return, \\ a backslash
+//      key 13                      press and release a key code
+//      wait 150                    run 150 frames (1/50 s each)
+//      hash 8c1e0b95e2a1f3d7       hash the screen, and compare if a hash is given
+//      png screen.png              write the screen as PNG file
+//
+//  The typed characters are the key codes of the system's keyboard
+//  matrix (kbd_key_down()/kbd_key_up()), each key is held for
+//  RUN_KEY_HOLD_FRAMES and followed by RUN_KEY_GAP_FRAMES frames
+//  without a key, so on the C64 'RUN' is the unshifted keys like with
+//  the host keyboard in the examples.
+//
+//  The systems which can skip their video decoding (CPC, KC87, Z1013 and
+//  ZX Spectrum, like in warp mode) only decode the frame before a hash
+//  or png step, the C64, Atom and MZ-800 always render their video. The
+//  hash is the 64-bit FNV-1a of the RGBA8 framebuffer, it is printed for
+//  every hash step so that the expected values can be copied into the
+//  script.
+//
+//  Usage:
+//
+//      chips-run [-j threads] [-validate] script...
+//
+//  With -j, the scripts are run concurrently on a pool of worker threads
+//  (-j 0 means one thread per CPU core), the output of each script is
+//  printed in order when all are done. The exit code is 10 if any script
+//  failed or a hash mismatched.
+//
+//  With -validate, each script also runs on an exact reference instance
+//  with all fast paths of the system disabled (the C64's lazy CIAs and
+//  batched SID, the CPC's scanline batching and batched PSG, the ZX
+//  Spectrum's batched audio, the Atom's batched MC6847, the KC87's batched
+//  CTC and the Z1013's idle loop skipping), on its own thread in lockstep
+//  with the optimized instance. After every frame, the CPU registers, RAM
+//  and framebuffer of both are hashed and compared. At the first divergent
+//  frame, both instances are rewound to the start of that frame and
+//  single-stepped instruction by instruction to find the first divergent
+//  tick, and the PCs of the last RUN_TRACE_STEPS instructions, the CPU
+//  registers and the first differing RAM bytes are logged. A divergence
+//  fails the script. Each validated script needs two threads, so -j should
+//  be at most half the number of cores. The MZ-800 has no fast paths, its
+//  validation only checks that the emulation is deterministic.
+//------------------------------------------------------------------------------
+#define CHIPS_IMPL
+#include "systems/atom.h"
+#include "systems/c64.h"
+#include "systems/cpc6128.h"
+#include "systems/kc87.h"
+#include "systems/mz800.h"
+#include "systems/z1013.h"
+#include "systems/zx128k.h"
+#include "common/thread.h"
+#include "common/quickload.h"
+#include "common/capture.h"
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h> /* offsetof */
+#include <inttypes.h>
+
+#define RUN_FRAME_HZ (50)
+#define RUN_KEY_HOLD_FRAMES (3)
+#define RUN_KEY_GAP_FRAMES (3)
+#define RUN_MAX_LINE (1024)
+#define RUN_LOG_SIZE (64 * 1024)
+#define RUN_TRACE_STEPS (32)
+#define RUN_MAX_RAM_DIFFS (8)
+
+/* type-erased wrappers for the system table */
+static void atom_run_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    atom_init((atom_t*)sys, &(atom_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static void atom_run_init_ref(void* sys, uint32_t* fb, uint32_t fb_size) {
+    atom_init((atom_t*)sys, &(atom_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .disable_vdg_batching = true });
+}
+static uint32_t atom_run_exec(void* sys, uint32_t ticks, bool decode) {
+    (void)decode;
+    return atom_exec((atom_t*)sys, ticks);
+}
+static kbd_t* atom_run_kbd(void* sys) {
+    return &((atom_t*)sys)->kbd;
+}
+static void c64_run_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    c64_init((c64_t*)sys, &(c64_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static void c64_run_init_ref(void* sys, uint32_t* fb, uint32_t fb_size) {
+    c64_init((c64_t*)sys, &(c64_desc_t){
+        .rgba8_buffer = fb,
+        .rgba8_buffer_size = fb_size,
+        .disable_cia_lazy = true,
+        .disable_audio_batching = true
+    });
+}
+static uint32_t c64_run_exec(void* sys, uint32_t ticks, bool decode) {
+    (void)decode;
+    return c64_exec((c64_t*)sys, ticks);
+}
+static kbd_t* c64_run_kbd(void* sys) {
+    return &((c64_t*)sys)->kbd;
+}
+static bool c64_run_load(void* sys, const char* path, const uint8_t* data, uint32_t size) {
+    (void)path;
+    return c64_quickload((c64_t*)sys, data, size);
+}
+static void cpc_run_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    cpc_init((cpc_t*)sys, &(cpc_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static void cpc_run_init_ref(void* sys, uint32_t* fb, uint32_t fb_size) {
+    cpc_init((cpc_t*)sys, &(cpc_desc_t){
+        .rgba8_buffer = fb,
+        .rgba8_buffer_size = fb_size,
+        .disable_line_batching = true,
+        .disable_audio_batching = true
+    });
+}
+static uint32_t cpc_run_exec(void* sys, uint32_t ticks, bool decode) {
+    cpc_t* cpc = (cpc_t*) sys;
+    cpc->skip_video = !decode;
+    const uint32_t ticks_executed = cpc_exec(cpc, ticks);
+    cpc->skip_video = false;
+    return ticks_executed;
+}
+static kbd_t* cpc_run_kbd(void* sys) {
+    return &((cpc_t*)sys)->kbd;
+}
+static bool cpc_run_load(void* sys, const char* path, const uint8_t* data, uint32_t size) {
+    (void)path;
+    return cpc_quickload((cpc_t*)sys, data, size);
+}
+static void kc87_run_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    kc87_init((kc87_t*)sys, &(kc87_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static void kc87_run_init_ref(void* sys, uint32_t* fb, uint32_t fb_size) {
+    kc87_init((kc87_t*)sys, &(kc87_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .disable_ctc_batching = true });
+}
+static uint32_t kc87_run_exec(void* sys, uint32_t ticks, bool decode) {
+    kc87_t* kc87 = (kc87_t*) sys;
+    /* the keyboard matrix lines are directly connected to the PIO2's Port B */
+    z80pio_write_port(&kc87->pio2, Z80PIO_PORT_B, ~kbd_scan_lines(&kc87->kbd));
+    kc87->skip_video = !decode;
+    const uint32_t ticks_executed = kc87_exec(kc87, ticks);
+    kc87->skip_video = false;
+    return ticks_executed;
+}
+static kbd_t* kc87_run_kbd(void* sys) {
+    return &((kc87_t*)sys)->kbd;
+}
+static void mz800_run_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    mz800_init((mz800_t*)sys, &(mz800_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static uint32_t mz800_run_exec(void* sys, uint32_t ticks, bool decode) {
+    (void)decode;
+    return mz800_exec((mz800_t*)sys, ticks);
+}
+/* the MZ-800's RAM is the VRAM and DRAM arrays at the end of the struct */
+static const void* mz800_run_ram(void* sys, uint32_t* size) {
+    *size = (uint32_t)(sizeof(mz800_t) - offsetof(mz800_t, vram));
+    return ((mz800_t*)sys)->vram;
+}
+static void z1013_run_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    z1013_init((z1013_t*)sys, &(z1013_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static void z1013_run_init_ref(void* sys, uint32_t* fb, uint32_t fb_size) {
+    z1013_init((z1013_t*)sys, &(z1013_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .disable_idle_skip = true });
+}
+static uint32_t z1013_run_exec(void* sys, uint32_t ticks, bool decode) {
+    z1013_t* z1013 = (z1013_t*) sys;
+    z1013->skip_video = !decode;
+    const uint32_t ticks_executed = z1013_exec(z1013, ticks);
+    z1013->skip_video = false;
+    return ticks_executed;
+}
+static kbd_t* z1013_run_kbd(void* sys) {
+    return &((z1013_t*)sys)->kbd;
+}
+static void zx_run_init(void* sys, uint32_t* fb, uint32_t fb_size) {
+    zx_init((zx128k_t*)sys, &(zx_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+}
+static void zx_run_init_ref(void* sys, uint32_t* fb, uint32_t fb_size) {
+    zx_init((zx128k_t*)sys, &(zx_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .disable_audio_batching = true });
+}
+static uint32_t zx_run_exec(void* sys, uint32_t ticks, bool decode) {
+    zx128k_t* zx = (zx128k_t*) sys;
+    zx->skip_video = !decode;
+    const uint32_t ticks_executed = zx_exec(zx, ticks);
+    zx->skip_video = false;
+    return ticks_executed;
+}
+static kbd_t* zx_run_kbd(void* sys) {
+    return &((zx128k_t*)sys)->kbd;
+}
+static bool zx_run_load(void* sys, const char* path, const uint8_t* data, uint32_t size) {
+    if (quickload_has_ext(path, ".z80")) {
+        return zx_quickload_z80((zx128k_t*)sys, data, size);
+    }
+    return zx_quickload_sna((zx128k_t*)sys, data, size);
+}
+
+/* the CPU registers, RAM and PC of a system for the validation mode */
+#define RUN_STATE_FUNCS(prefix, type, ram_field) \
+    static const void* prefix##_run_cpu(void* sys, uint32_t* size) { \
+        *size = (uint32_t)sizeof(((type*)sys)->cpu.state); \
+        return &((type*)sys)->cpu.state; \
+    } \
+    static const void* prefix##_run_ram(void* sys, uint32_t* size) { \
+        *size = (uint32_t)sizeof(((type*)sys)->ram_field); \
+        return ((type*)sys)->ram_field; \
+    } \
+    static uint16_t prefix##_run_pc(void* sys) { \
+        return ((type*)sys)->cpu.state.PC; \
+    }
+RUN_STATE_FUNCS(atom, atom_t, ram)
+RUN_STATE_FUNCS(c64, c64_t, ram)
+RUN_STATE_FUNCS(cpc, cpc_t, ram)
+RUN_STATE_FUNCS(kc87, kc87_t, mem)
+RUN_STATE_FUNCS(z1013, z1013_t, mem)
+RUN_STATE_FUNCS(zx, zx128k_t, ram)
+static const void* mz800_run_cpu(void* sys, uint32_t* size) {
+    *size = (uint32_t)sizeof(((mz800_t*)sys)->cpu.state);
+    return &((mz800_t*)sys)->cpu.state;
+}
+static uint16_t mz800_run_pc(void* sys) {
+    return ((mz800_t*)sys)->cpu.state.PC;
+}
+
+typedef struct {
+    const char* name;
+    uint32_t freq_hz;           /* emulated CPU clock frequency */
+    uint32_t state_size;        /* size of the system state struct */
+    int width;                  /* framebuffer size in pixels */
+    int height;
+    void (*init)(void* sys, uint32_t* fb, uint32_t fb_size);
+    uint32_t (*exec)(void* sys, uint32_t ticks, bool decode);
+    kbd_t* (*kbd)(void* sys);   /* 0 if the system has no keyboard */
+    bool (*load)(void* sys, const char* path, const uint8_t* data, uint32_t size);  /* 0 if no quickloader */
+    /* validation mode */
+    bool skips_video;           /* the framebuffer is only valid in frames which decoded the video output */
+    void (*init_ref)(void* sys, uint32_t* fb, uint32_t fb_size);    /* init with all fast paths disabled */
+    const void* (*cpu)(void* sys, uint32_t* size);
+    const void* (*ram)(void* sys, uint32_t* size);
+    uint16_t (*pc)(void* sys);
+} run_system_t;
+
+static const run_system_t systems[] = {
+    { "atom", ATOM_FREQ, sizeof(atom_t), MC6847_DISPLAY_WIDTH, MC6847_DISPLAY_HEIGHT,
+      atom_run_init, atom_run_exec, atom_run_kbd, 0,
+      false, atom_run_init_ref, atom_run_cpu, atom_run_ram, atom_run_pc },
+    { "c64", C64_FREQ, sizeof(c64_t), C64_DISP_WIDTH, C64_DISP_HEIGHT,
+      c64_run_init, c64_run_exec, c64_run_kbd, c64_run_load,
+      false, c64_run_init_ref, c64_run_cpu, c64_run_ram, c64_run_pc },
+    { "cpc6128", CPC_FREQ, sizeof(cpc_t), CPC_DISP_WIDTH, CPC_DISP_HEIGHT,
+      cpc_run_init, cpc_run_exec, cpc_run_kbd, cpc_run_load,
+      true, cpc_run_init_ref, cpc_run_cpu, cpc_run_ram, cpc_run_pc },
+    { "kc87", KC87_FREQ, sizeof(kc87_t), KC87_DISP_WIDTH, KC87_DISP_HEIGHT,
+      kc87_run_init, kc87_run_exec, kc87_run_kbd, 0,
+      true, kc87_run_init_ref, kc87_run_cpu, kc87_run_ram, kc87_run_pc },
+    { "mz800", MZ800_FREQ, sizeof(mz800_t), MZ800_DISP_WIDTH, MZ800_DISP_HEIGHT,
+      mz800_run_init, mz800_run_exec, 0, 0,
+      false, mz800_run_init, mz800_run_cpu, mz800_run_ram, mz800_run_pc },
+    { "z1013", Z1013_FREQ, sizeof(z1013_t), Z1013_DISP_WIDTH, Z1013_DISP_HEIGHT,
+      z1013_run_init, z1013_run_exec, z1013_run_kbd, 0,
+      true, z1013_run_init_ref, z1013_run_cpu, z1013_run_ram, z1013_run_pc },
+    { "zx128k", ZX128K_FREQ, sizeof(zx128k_t), ZX128K_DISP_WIDTH, ZX128K_DISP_HEIGHT,
+      zx_run_init, zx_run_exec, zx_run_kbd, zx_run_load,
+      true, zx_run_init_ref, zx_run_cpu, zx_run_ram, zx_run_pc },
+};
+#define NUM_SYSTEMS (sizeof(systems)/sizeof(systems[0]))
+
+/* validation mode: the instances and their differences */
+#define RUN_REF (0)                 /* the reference instance, all fast paths disabled */
+#define RUN_OPT (1)                 /* the optimized instance */
+#define RUN_DIFF_CPU (1<<0)
+#define RUN_DIFF_RAM (1<<1)
+#define RUN_DIFF_FB (1<<2)
+#define RUN_DIFF_TICKS (1<<3)
+#define RUN_DIFF_FRAMES (1<<4)      /* the reference stopped early */
+
+typedef struct {
+    uint64_t cpu;
+    uint64_t ram;
+    uint64_t fb;                    /* 0 if the framebuffer wasn't decoded */
+    uint64_t ticks;
+} run_hashes_t;
+
+/* the lockstep between the reference and optimized instance of a script */
+typedef struct {
+    run_hashes_t ref_hashes;        /* of the reference instance's last frame */
+    volatile uint32_t frames[2];    /* last frame published by RUN_REF and RUN_OPT */
+    volatile uint32_t done[2];      /* the script has ended on RUN_REF or RUN_OPT */
+    volatile uint32_t diverged;     /* first divergent frame, 0 if none */
+    uint32_t diff;                  /* RUN_DIFF_* bits of the divergent frame */
+} run_validate_t;
+
+/* the state of one script run */
+typedef struct {
+    const char* path;
+    int line;
+    const run_system_t* sys;
+    void* state;
+    uint32_t* fb;
+    uint32_t overrun_ticks;
+    bool decoded;               /* the last frame decoded the video output */
+    uint64_t frames;
+    uint64_t ticks;
+    uint32_t num_hashes;
+    uint32_t num_mismatches;
+    bool failed;
+    double wall_sec;
+    char* log;                  /* buffered output, printed when all scripts are done */
+    size_t log_len;
+    /* validation mode */
+    run_validate_t* val;        /* 0 if not validating */
+    int side;                   /* RUN_REF or RUN_OPT */
+    bool stopped;               /* the instances diverged, ignore the rest of the script */
+    void* prev_state;           /* the instance at the start of the last frame */
+    uint32_t* prev_fb;
+    uint64_t prev_ticks;
+    uint32_t prev_overrun_ticks;
+    uint32_t num_divergences;
+} run_script_t;
+
+static void run_log(run_script_t* rs, const char* fmt, ...) {
+    if (rs->log_len >= RUN_LOG_SIZE) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    const int len = vsnprintf(rs->log + rs->log_len, RUN_LOG_SIZE - rs->log_len, fmt, args);
+    va_end(args);
+    if (len > 0) {
+        rs->log_len += (size_t)len;
+        if (rs->log_len > RUN_LOG_SIZE - 1) {
+            rs->log_len = RUN_LOG_SIZE - 1;
+        }
+    }
+}
+
+/* log an error at the current script line and stop the script */
+static bool run_error(run_script_t* rs, const char* msg, const char* arg) {
+    run_log(rs, "%s:%d: %s%s%s\n", rs->path, rs->line, msg, arg ? " " : "", arg ? arg : "");
+    rs->failed = true;
+    return false;
+}
+
+static size_t run_fb_size(const run_system_t* sys) {
+    return (size_t)sys->width * sys->height * sizeof(uint32_t);
+}
+
+/* 64-bit FNV-1a */
+static uint64_t run_fnv(const void* data, size_t num) {
+    const uint8_t* ptr = (const uint8_t*) data;
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < num; i++) {
+        h = (h ^ ptr[i]) * 0x100000001b3ULL;
+    }
+    return h;
+}
+
+/* wait until a lockstep counter has reached a frame or the other side has ended */
+static void run_wait(const volatile uint32_t* frames, const volatile uint32_t* done, uint32_t frame) {
+    for (uint32_t spins = 0; (thread_atomic_load(frames) < frame) && !thread_atomic_load(done); spins++) {
+        if (spins > 1000) {
+            thread_sleep_us(50);
+        }
+    }
+}
+
+static run_hashes_t run_state_hashes(const run_script_t* rs) {
+    run_hashes_t h;
+    uint32_t size = 0;
+    const void* ptr = rs->sys->cpu(rs->state, &size);
+    h.cpu = run_fnv(ptr, size);
+    ptr = rs->sys->ram(rs->state, &size);
+    h.ram = run_fnv(ptr, size);
+    h.fb = (rs->decoded || !rs->sys->skips_video) ? run_fnv(rs->fb, run_fb_size(rs->sys)) : 0;
+    h.ticks = rs->ticks;
+    return h;
+}
+
+/* validation mode: wait until the last frame is validated and remember
+   the state at the start of the next frame, returns false if the
+   instances have diverged
+*/
+static bool run_validate_begin(run_script_t* rs) {
+    run_validate_t* val = rs->val;
+    if (RUN_REF == rs->side) {
+        /* the reference hashes of the last frame must have been consumed */
+        const uint32_t frame = (uint32_t) rs->frames;
+        run_wait(&val->frames[RUN_OPT], &val->done[RUN_OPT], frame);
+        if (thread_atomic_load(&val->frames[RUN_OPT]) < frame) {
+            /* the optimized instance has ended early */
+            rs->stopped = true;
+        }
+    }
+    if (thread_atomic_load(&val->diverged)) {
+        rs->stopped = true;
+    }
+    if (rs->stopped) {
+        return false;
+    }
+    memcpy(rs->prev_state, rs->state, rs->sys->state_size);
+    memcpy(rs->prev_fb, rs->fb, run_fb_size(rs->sys));
+    rs->prev_ticks = rs->ticks;
+    rs->prev_overrun_ticks = rs->overrun_ticks;
+    return true;
+}
+
+/* validation mode: publish (RUN_REF) or compare (RUN_OPT) the hashes of a finished frame */
+static void run_validate_end(run_script_t* rs) {
+    run_validate_t* val = rs->val;
+    const uint32_t frame = (uint32_t) rs->frames;
+    const run_hashes_t h = run_state_hashes(rs);
+    if (RUN_REF == rs->side) {
+        val->ref_hashes = h;
+        thread_atomic_store(&val->frames[RUN_REF], frame);
+        return;
+    }
+    run_wait(&val->frames[RUN_REF], &val->done[RUN_REF], frame);
+    uint32_t diff = 0;
+    if (thread_atomic_load(&val->frames[RUN_REF]) < frame) {
+        diff = RUN_DIFF_FRAMES;
+    }
+    else {
+        const run_hashes_t* ref = &val->ref_hashes;
+        diff |= (ref->cpu != h.cpu) ? RUN_DIFF_CPU : 0;
+        diff |= (ref->ram != h.ram) ? RUN_DIFF_RAM : 0;
+        diff |= (ref->fb != h.fb) ? RUN_DIFF_FB : 0;
+        diff |= (ref->ticks != h.ticks) ? RUN_DIFF_TICKS : 0;
+    }
+    if (diff) {
+        val->diff = diff;
+        thread_atomic_store(&val->diverged, frame);
+        rs->stopped = true;
+    }
+    thread_atomic_store(&val->frames[RUN_OPT], frame);
+}
+
+/* run frames, only the last one decodes the video output if decode_last is set */
+static void run_frames(run_script_t* rs, uint32_t num_frames, bool decode_last) {
+    const uint32_t ticks_per_frame = rs->sys->freq_hz / RUN_FRAME_HZ;
+    kbd_t* kbd = rs->sys->kbd ? rs->sys->kbd(rs->state) : 0;
+    for (uint32_t i = 0; i < num_frames; i++) {
+        if (rs->val && !run_validate_begin(rs)) {
+            return;
+        }
+        const bool decode = decode_last && (i == (num_frames - 1));
+        const uint32_t ticks_to_run = ticks_per_frame - rs->overrun_ticks;
+        const uint32_t ticks_executed = rs->sys->exec(rs->state, ticks_to_run, decode);
+        rs->overrun_ticks = ticks_executed - ticks_to_run;
+        rs->ticks += ticks_executed;
+        rs->frames++;
+        rs->decoded = decode;
+        if (kbd) {
+            kbd_update(kbd);
+        }
+        if (rs->val) {
+            run_validate_end(rs);
+        }
+    }
+}
+
+/* press and release a key */
+static void run_key(run_script_t* rs, int key) {
+    kbd_t* kbd = rs->sys->kbd(rs->state);
+    kbd_key_down(kbd, key);
+    run_frames(rs, RUN_KEY_HOLD_FRAMES, false);
+    kbd_key_up(kbd, key);
+    run_frames(rs, RUN_KEY_GAP_FRAMES, false);
+}
+
+/* make sure the framebuffer holds the video output of the last frame */
+static void run_decode(run_script_t* rs) {
+    if (!rs->decoded) {
+        run_frames(rs, 1, true);
+    }
+}
+
+static uint64_t run_hash(const run_script_t* rs) {
+    return run_fnv(rs->fb, run_fb_size(rs->sys));
+}
+
+static bool run_boot(run_script_t* rs, const char* name) {
+    const run_system_t* sys = 0;
+    for (size_t i = 0; i < NUM_SYSTEMS; i++) {
+        if (0 == strcmp(name, systems[i].name)) {
+            sys = &systems[i];
+        }
+    }
+    if (!sys) {
+        return run_error(rs, "unknown system", name);
+    }
+    if (sys != rs->sys) {
+        thread_aligned_free(rs->state);
+        free(rs->fb);
+        thread_aligned_free(rs->prev_state);
+        free(rs->prev_fb);
+        rs->sys = sys;
+        rs->state = thread_aligned_calloc(sys->state_size);
+        rs->fb = (uint32_t*) calloc(1, run_fb_size(sys));
+        if (rs->val) {
+            rs->prev_state = thread_aligned_calloc(sys->state_size);
+            rs->prev_fb = (uint32_t*) calloc(1, run_fb_size(sys));
+        }
+        if (!rs->state || !rs->fb || (rs->val && (!rs->prev_state || !rs->prev_fb))) {
+            return run_error(rs, "out of memory", 0);
+        }
+    }
+    if (rs->val && (RUN_REF == rs->side)) {
+        sys->init_ref(rs->state, rs->fb, (uint32_t)run_fb_size(sys));
+    }
+    else {
+        sys->init(rs->state, rs->fb, (uint32_t)run_fb_size(sys));
+    }
+    rs->overrun_ticks = 0;
+    rs->decoded = false;
+    return true;
+}
+
+static bool run_type(run_script_t* rs, const char* text) {
+    for (const char* p = text; *p; p++) {
+        int c = (uint8_t) *p;
+        if ('\\' == c) {
+            if ('n' == p[1]) {
+                c = 0x0D;
+                p++;
+            }
+            else if ('\\' == p[1]) {
+                p++;
+            }
+        }
+        if (c >= KBD_MAX_KEYS) {
+            return run_error(rs, "key code out of range in", text);
+        }
+        run_key(rs, c);
+    }
+    return true;
+}
+
+static bool run_load(run_script_t* rs, const char* path) {
+    if (!rs->sys->load) {
+        return run_error(rs, "no quickloader for", rs->sys->name);
+    }
+    uint32_t size = 0;
+    uint8_t* data = quickload_read(path, &size);
+    if (!data) {
+        return run_error(rs, "failed to read", path);
+    }
+    const bool ok = rs->sys->load(rs->state, path, data, size);
+    free(data);
+    rs->decoded = false;
+    return ok || run_error(rs, "failed to load", path);
+}
+
+/* execute one script line (without the line end), returns false to stop the script */
+static bool run_step(run_script_t* rs, char* line) {
+    while ((' ' == *line) || ('\t' == *line)) {
+        line++;
+    }
+    if ((0 == *line) || ('#' == *line)) {
+        return true;
+    }
+    char* arg = line;
+    while (*arg && (' ' != *arg) && ('\t' != *arg)) {
+        arg++;
+    }
+    if (*arg) {
+        *arg++ = 0;
+        while ((' ' == *arg) || ('\t' == *arg)) {
+            arg++;
+        }
+    }
+    if (0 == strcmp(line, "boot")) {
+        return run_boot(rs, arg);
+    }
+    if (!rs->sys) {
+        return run_error(rs, "no system booted before", line);
+    }
+    if (0 == strcmp(line, "wait")) {
+        const int num = atoi(arg);
+        if (num <= 0) {
+            return run_error(rs, "invalid frame count", arg);
+        }
+        run_frames(rs, (uint32_t)num, false);
+    }
+    else if (0 == strcmp(line, "type")) {
+        if (!rs->sys->kbd) {
+            return run_error(rs, "no keyboard on", rs->sys->name);
+        }
+        return run_type(rs, arg);
+    }
+    else if (0 == strcmp(line, "key")) {
+        const long key = strtol(arg, 0, 0);
+        if (!rs->sys->kbd) {
+            return run_error(rs, "no keyboard on", rs->sys->name);
+        }
+        if ((key <= 0) || (key >= KBD_MAX_KEYS)) {
+            return run_error(rs, "invalid key code", arg);
+        }
+        run_key(rs, (int)key);
+    }
+    else if (0 == strcmp(line, "load")) {
+        return run_load(rs, arg);
+    }
+    else if (0 == strcmp(line, "hash")) {
+        run_decode(rs);
+        if (rs->stopped) {
+            return false;
+        }
+        if (rs->val && (RUN_REF == rs->side)) {
+            /* the reference instance only runs the frames, RUN_OPT reports */
+            return true;
+        }
+        const uint64_t hash = run_hash(rs);
+        rs->num_hashes++;
+        if (*arg) {
+            const bool match = (hash == strtoull(arg, 0, 16));
+            run_log(rs, "%s:%d: hash %016"PRIx64" at frame %"PRIu64" %s\n", rs->path, rs->line, hash, rs->frames,
+                match ? "ok" : "MISMATCH");
+            if (!match) {
+                rs->num_mismatches++;
+            }
+        }
+        else {
+            run_log(rs, "%s:%d: hash %016"PRIx64" at frame %"PRIu64"\n", rs->path, rs->line, hash, rs->frames);
+        }
+    }
+    else if (0 == strcmp(line, "png")) {
+        run_decode(rs);
+        if (rs->stopped) {
+            return false;
+        }
+        if (rs->val && (RUN_REF == rs->side)) {
+            /* only RUN_OPT writes the file */
+            return true;
+        }
+        if (!capture_write_png(arg, rs->fb, rs->sys->width, rs->sys->height)) {
+            return run_error(rs, "failed to write", arg);
+        }
+        run_log(rs, "%s:%d: wrote '%s' at frame %"PRIu64"\n", rs->path, rs->line, arg, rs->frames);
+    }
+    else {
+        return run_error(rs, "unknown command", line);
+    }
+    return true;
+}
+
+static void run_script(run_script_t* rs) {
+    const uint64_t start = stm_now();
+    FILE* fp = fopen(rs->path, "r");
+    if (!fp) {
+        run_log(rs, "%s: failed to open script\n", rs->path);
+        rs->failed = true;
+        return;
+    }
+    char line[RUN_MAX_LINE];
+    while (!rs->stopped && fgets(line, sizeof(line), fp)) {
+        rs->line++;
+        line[strcspn(line, "\r\n")] = 0;
+        if (!run_step(rs, line)) {
+            break;
+        }
+    }
+    fclose(fp);
+    rs->wall_sec = stm_sec(stm_since(start));
+    if (!rs->val) {
+        /* in validation mode, the instances are needed to locate a divergence */
+        thread_aligned_free(rs->state);
+        free(rs->fb);
+        rs->state = 0;
+        rs->fb = 0;
+    }
+}
+
+static void run_free(run_script_t* rs) {
+    thread_aligned_free(rs->state);
+    free(rs->fb);
+    thread_aligned_free(rs->prev_state);
+    free(rs->prev_fb);
+    rs->state = 0;
+    rs->fb = 0;
+    rs->prev_state = 0;
+    rs->prev_fb = 0;
+}
+
+/* compare the CPU registers and RAM of the reference and optimized instance */
+static uint32_t run_compare(const run_system_t* sys, void* ref, void* opt) {
+    uint32_t diff = 0;
+    uint32_t size = 0;
+    const void* ref_ptr = sys->cpu(ref, &size);
+    if (0 != memcmp(ref_ptr, sys->cpu(opt, &size), size)) {
+        diff |= RUN_DIFF_CPU;
+    }
+    ref_ptr = sys->ram(ref, &size);
+    if (0 != memcmp(ref_ptr, sys->ram(opt, &size), size)) {
+        diff |= RUN_DIFF_RAM;
+    }
+    return diff;
+}
+
+static void run_log_diff(run_script_t* rs, uint32_t diff) {
+    static const char* names[] = { "cpu", "ram", "framebuffer", "ticks", "frames" };
+    const char* sep = "";
+    for (int i = 0; i < 5; i++) {
+        if (diff & (1<<i)) {
+            run_log(rs, "%s%s", sep, names[i]);
+            sep = ", ";
+        }
+    }
+}
+
+static void run_log_bytes(run_script_t* rs, const char* what, const uint8_t* ptr, uint32_t size) {
+    for (uint32_t i = 0; i < size; i++) {
+        if (0 == (i & 15)) {
+            run_log(rs, "%s  %s %02x:", (i > 0) ? "\n" : "", what, i);
+        }
+        run_log(rs, " %02x", ptr[i]);
+    }
+    run_log(rs, "\n");
+}
+
+/* single-step the reference and optimized instance from the start of the
+   divergent frame to the first tick at which their CPU registers or RAM
+   differ, and log the last instructions, registers and differing bytes
+*/
+static void run_find_tick(run_script_t* rs, run_script_t* ref) {
+    const run_system_t* sys = rs->sys;
+    run_script_t* inst[2] = { ref, rs };
+    uint64_t ticks[2];
+    for (int i = 0; i < 2; i++) {
+        memcpy(inst[i]->state, inst[i]->prev_state, sys->state_size);
+        memcpy(inst[i]->fb, inst[i]->prev_fb, run_fb_size(sys));
+        ticks[i] = inst[i]->prev_ticks;
+    }
+    const uint64_t frame_start = ticks[RUN_OPT];
+    const uint64_t limit = frame_start + 2 * (uint64_t)(sys->freq_hz / RUN_FRAME_HZ);
+    struct { uint64_t tick; uint16_t pc[2]; } trace[RUN_TRACE_STEPS];
+    uint32_t num_steps = 0;
+    uint32_t diff = 0;
+    while (!diff && (ticks[RUN_REF] < limit) && (ticks[RUN_OPT] < limit)) {
+        /* step the instance which is behind (a fast path may skip ticks), or both */
+        const bool step_ref = ticks[RUN_REF] <= ticks[RUN_OPT];
+        const bool step_opt = ticks[RUN_OPT] <= ticks[RUN_REF];
+        if (step_ref) {
+            ticks[RUN_REF] += sys->exec(ref->state, 1, false);
+        }
+        if (step_opt) {
+            ticks[RUN_OPT] += sys->exec(rs->state, 1, false);
+        }
+        if (ticks[RUN_REF] == ticks[RUN_OPT]) {
+            trace[num_steps % RUN_TRACE_STEPS].tick = ticks[RUN_OPT];
+            trace[num_steps % RUN_TRACE_STEPS].pc[RUN_REF] = sys->pc(ref->state);
+            trace[num_steps % RUN_TRACE_STEPS].pc[RUN_OPT] = sys->pc(rs->state);
+            num_steps++;
+            diff = run_compare(sys, ref->state, rs->state);
+        }
+    }
+    if (!diff) {
+        run_log(rs, "%s: single-stepping the frame shows no cpu or ram difference, "
+            "the divergence depends on the exec() slice boundaries\n", rs->path);
+        return;
+    }
+    run_log(rs, "%s: first divergent tick %"PRIu64" (tick %"PRIu64" of the frame, instruction %u), differs in ",
+        rs->path, ticks[RUN_OPT], ticks[RUN_OPT] - frame_start, num_steps);
+    run_log_diff(rs, diff);
+    run_log(rs, "\n      tick  ref pc  opt pc\n");
+    const uint32_t first = (num_steps > RUN_TRACE_STEPS) ? (num_steps - RUN_TRACE_STEPS) : 0;
+    for (uint32_t i = first; i < num_steps; i++) {
+        const uint16_t* pc = trace[i % RUN_TRACE_STEPS].pc;
+        run_log(rs, "  %10"PRIu64"    %04x    %04x%s\n", trace[i % RUN_TRACE_STEPS].tick, pc[RUN_REF], pc[RUN_OPT],
+            (pc[RUN_REF] != pc[RUN_OPT]) ? "  <<" : "");
+    }
+    uint32_t size = 0;
+    const uint8_t* ref_ptr = (const uint8_t*) sys->cpu(ref->state, &size);
+    run_log_bytes(rs, "ref cpu", ref_ptr, size);
+    run_log_bytes(rs, "opt cpu", (const uint8_t*) sys->cpu(rs->state, &size), size);
+    ref_ptr = (const uint8_t*) sys->ram(ref->state, &size);
+    const uint8_t* opt_ptr = (const uint8_t*) sys->ram(rs->state, &size);
+    uint32_t num_diffs = 0;
+    for (uint32_t i = 0; i < size; i++) {
+        if (ref_ptr[i] != opt_ptr[i]) {
+            if (num_diffs < RUN_MAX_RAM_DIFFS) {
+                run_log(rs, "  ram %05x: ref %02x opt %02x\n", i, ref_ptr[i], opt_ptr[i]);
+            }
+            num_diffs++;
+        }
+    }
+    if (num_diffs > 0) {
+        run_log(rs, "  %u differing ram byte(s)\n", num_diffs);
+    }
+}
+
+/* log the result of a validated script run */
+static void run_report(run_script_t* rs, run_script_t* ref) {
+    const run_validate_t* val = rs->val;
+    if (ref->failed && !rs->failed) {
+        run_log(rs, "%s: the reference instance failed:\n%s", rs->path, ref->log);
+        rs->num_divergences++;
+        return;
+    }
+    if (0 == val->diverged) {
+        if (ref->stopped && !rs->failed) {
+            run_log(rs, "%s: the optimized instance ended at frame %"PRIu64" before the reference\n", rs->path, rs->frames);
+            rs->num_divergences++;
+        }
+        return;
+    }
+    rs->num_divergences++;
+    run_log(rs, "%s:%d: fast paths DIVERGE at frame %u in ", rs->path, rs->line, val->diverged);
+    run_log_diff(rs, val->diff);
+    run_log(rs, "\n");
+    if (val->diff & RUN_DIFF_FRAMES) {
+        return;
+    }
+    if (val->diff & RUN_DIFF_FB) {
+        /* both framebuffers still hold the divergent frame */
+        const size_t num = run_fb_size(rs->sys) / sizeof(uint32_t);
+        for (size_t i = 0; i < num; i++) {
+            if (ref->fb[i] != rs->fb[i]) {
+                run_log(rs, "%s: first differing pixel at %d,%d: ref %08x opt %08x\n", rs->path,
+                    (int)(i % rs->sys->width), (int)(i / rs->sys->width), ref->fb[i], rs->fb[i]);
+                break;
+            }
+        }
+    }
+    if (val->diff & (RUN_DIFF_CPU|RUN_DIFF_RAM|RUN_DIFF_TICKS)) {
+        run_find_tick(rs, ref);
+    }
+}
+
+static void run_ref_thread(void* arg) {
+    run_script_t* ref = (run_script_t*) arg;
+    run_script(ref);
+    thread_atomic_store(&ref->val->done[RUN_REF], 1);
+}
+
+/* run a script on the optimized instance on this thread, and on the
+   reference instance on a second thread in lockstep
+*/
+static void run_validate(run_script_t* rs) {
+    run_validate_t val;
+    memset(&val, 0, sizeof(val));
+    run_script_t ref;
+    memset(&ref, 0, sizeof(ref));
+    ref.path = rs->path;
+    ref.val = &val;
+    ref.side = RUN_REF;
+    ref.log = (char*) malloc(RUN_LOG_SIZE);
+    thread_t thread;
+    if (!ref.log || !thread_start(&thread, run_ref_thread, &ref)) {
+        run_log(rs, "%s: failed to start the reference instance\n", rs->path);
+        rs->failed = true;
+        free(ref.log);
+        return;
+    }
+    ref.log[0] = 0;
+    rs->val = &val;
+    rs->side = RUN_OPT;
+    run_script(rs);
+    thread_atomic_store(&val.done[RUN_OPT], 1);
+    thread_join(&thread);
+    run_report(rs, &ref);
+    run_free(&ref);
+    run_free(rs);
+    free(ref.log);
+    rs->val = 0;
+}
+
+/* the scripts shared between the worker threads */
+typedef struct {
+    run_script_t* scripts;
+    int num_scripts;
+    volatile int32_t next_script;
+    bool validate;
+} run_job_t;
+
+static void run_worker(void* arg) {
+    run_job_t* job = (run_job_t*) arg;
+    int32_t i;
+    while ((i = thread_atomic_add(&job->next_script, 1)) < job->num_scripts) {
+        if (job->validate) {
+            run_validate(&job->scripts[i]);
+        }
+        else {
+            run_script(&job->scripts[i]);
+        }
+    }
+}
+
+static int usage(const char* exe) {
+    fprintf(stderr, "usage: %s [-j threads] [-validate] script...\n", exe);
+    return 10;
+}
+
+int main(int argc, char* argv[]) {
+    int num_threads = 1;
+    run_job_t job = { 0 };
+    job.scripts = (run_script_t*) calloc(argc, sizeof(run_script_t));
+    if (!job.scripts) {
+        return 10;
+    }
+    for (int i = 1; i < argc; i++) {
+        if ((0 == strcmp(argv[i], "-j")) && (i+1 < argc)) {
+            num_threads = atoi(argv[++i]);
+            if (num_threads < 0) {
+                return usage(argv[0]);
+            }
+        }
+        else if (0 == strcmp(argv[i], "-validate")) {
+            job.validate = true;
+        }
+        else {
+            job.scripts[job.num_scripts++].path = argv[i];
+        }
+    }
+    if (0 == job.num_scripts) {
+        return usage(argv[0]);
+    }
+    for (int i = 0; i < job.num_scripts; i++) {
+        job.scripts[i].log = (char*) malloc(RUN_LOG_SIZE);
+        if (!job.scripts[i].log) {
+            return 10;
+        }
+        job.scripts[i].log[0] = 0;
+    }
+    if (0 == num_threads) {
+        num_threads = thread_num_cores();
+    }
+    if (num_threads > job.num_scripts) {
+        num_threads = job.num_scripts;
+    }
+    stm_setup();
+    const uint64_t start = stm_now();
+    if (num_threads <= 1) {
+        run_worker(&job);
+    }
+    else {
+        thread_t* threads = (thread_t*) calloc(num_threads, sizeof(thread_t));
+        int num_started = 0;
+        for (int i = 0; i < num_threads; i++) {
+            if (thread_start(&threads[i], run_worker, &job)) {
+                num_started++;
+            }
+        }
+        if (0 == num_started) {
+            run_worker(&job);
+        }
+        for (int i = 0; i < num_started; i++) {
+            thread_join(&threads[i]);
+        }
+        free(threads);
+    }
+    const double wall_sec = stm_sec(stm_since(start));
+
+    int num_failed = 0;
+    for (int i = 0; i < job.num_scripts; i++) {
+        run_script_t* rs = &job.scripts[i];
+        fputs(rs->log, stdout);
+        const bool ok = !rs->failed && (0 == rs->num_mismatches) && (0 == rs->num_divergences);
+        double emu_sec = 0.0;
+        if (rs->sys) {
+            emu_sec = (double)rs->ticks / rs->sys->freq_hz;
+        }
+        printf("%s: %s, %"PRIu64" frames, %.1f emulated s in %.3f s (%.1fx realtime), %u hashes, %u mismatches%s\n",
+            rs->path, ok ? "ok" : "FAILED", rs->frames, emu_sec, rs->wall_sec,
+            (rs->wall_sec > 0.0) ? (emu_sec / rs->wall_sec) : 0.0, rs->num_hashes, rs->num_mismatches,
+            job.validate ? ((0 == rs->num_divergences) ? ", fast paths validated" : ", fast paths DIVERGE") : "");
+        if (!ok) {
+            num_failed++;
+        }
+        free(rs->log);
+    }
+    printf("%d script(s), %d failed, %.3f s on %d thread(s)\n", job.num_scripts, num_failed, wall_sec, num_threads);
+    free(job.scripts);
+    return (0 == num_failed) ? 0 : 10;
+}
@@ -0,0 +1,458 @@
+#pragma once
+/*
+    atom.h
+
+    Acorn Atom emulator core without any platform dependencies,
+    used by the atom example and the headless chips-bench.
+
+    The Acorn Atom was a very simple 6502-based home computer
+    (just a MOS 6502 CPU, Motorola MC6847 video
+    display generator, and Intel i8255 I/O chip).
+
+    NOT EMULATED:
+        - the audio beeper
+        - the optional VIA 6522
+        - REPT key (and some other special keys)
+
+    The MC6847 doesn't influence the CPU, except through the FSYNC pin
+    which is read through the PPI. So by default the video chip isn't
+    ticked together with the CPU, instead the CPU tick only counts the
+    pending video chip ticks, and those are run in one batch before the
+    CPU writes to the video memory or accesses the PPI (which reads FSYNC
+    or changes the video mode), and at the end of atom_exec().
+
+    Do this:
+        #define CHIPS_IMPL
+    before you include this file in *one* C file to create the
+    implementation.
+*/
+#include "chips/m6502.h"
+#include "chips/mc6847.h"
+#include "chips/i8255.h"
+#include "chips/kbd.h"
+#include "chips/mem.h"
+#include "common/thread.h"
+#include "common/snapshot.h"
+#include "common/iopage.h"
+#include "common/pcprof.h"
+#include "common/sched.h"
+#include "roms/atom-roms.h"
+
+#define ATOM_FREQ (1000000)
+
+/* what a 256-byte page of CPU address space is mapped to (see atom_t.io_pages) */
+enum {
+    ATOM_IOPAGE_MEM = 0,        /* regular RAM/ROM access */
+    ATOM_IOPAGE_PPI,            /* i8255 PPI (B000..B3FF) */
+    ATOM_IOPAGE_EXP,            /* expansion devices (B400..BFFF, not implemented) */
+};
+
+/* scheduled events (see atom_t.sched) */
+enum {
+    ATOM_EVENT_2_4KHZ = 0,      /* toggle the 2.4 kHz oscillator output */
+};
+
+/* Atom emulator state */
+typedef struct {
+    m6502_t cpu;
+    mc6847_t vdg;
+    i8255_t ppi;
+    kbd_t kbd;
+    mem_t mem;
+    sched_t sched;              /* periodic events, keyed by the emulated tick */
+    bool state_2_4khz;
+    iopage_t io_pages;          /* ATOM_IOPAGE_* per 256-byte page */
+    uint32_t* rgba8_buffer;     /* decoded video output */
+    uint32_t rgba8_buffer_size;
+    const uint8_t* rom_abasic;  /* 8 KB BASIC ROM (C000..CFFF and F000..FFFF) */
+    const uint8_t* rom_afloat;  /* 4 KB floating point ROM */
+    const uint8_t* rom_dosrom;  /* 4 KB DOS ROM */
+    pcprof_t* prof;             /* optional PC-sampling profiler */
+    bool vdg_batching;          /* defer MC6847 ticks until they're needed */
+    uint32_t vdg_pending_ticks; /* number of deferred MC6847 ticks */
+    uint8_t ram[1<<16];     /* only 40 KByte used */
+} atom_t;
+
+/* Atom emulator setup parameters */
+typedef struct {
+    uint32_t* rgba8_buffer;         /* the framebuffer for the decoded video output */
+    uint32_t rgba8_buffer_size;     /* size of the framebuffer in bytes */
+    /* optional ROM images (e.g. memory-mapped files), default are the embedded dumps */
+    const uint8_t* rom_abasic;      /* 8 KB BASIC ROM */
+    const uint8_t* rom_afloat;      /* 4 KB floating point ROM */
+    const uint8_t* rom_dosrom;      /* 4 KB DOS ROM */
+    pcprof_t* prof;                 /* optional PC-sampling profiler (see common/pcprof.h) */
+    bool disable_vdg_batching;      /* tick the MC6847 together with the CPU */
+} atom_desc_t;
+
+/* initialize an Atom emulator instance */
+extern void atom_init(atom_t* sys, const atom_desc_t* desc);
+/* run an emulator instance for at least the given number of ticks, returns executed ticks */
+extern uint32_t atom_exec(atom_t* sys, uint32_t ticks);
+/* size of an Atom snapshot in bytes */
+extern uint32_t atom_snapshot_size(void);
+/* save a snapshot of an instance into buf, returns number of bytes written (0 if buf is too small) */
+extern uint32_t atom_save_snapshot(const atom_t* sys, void* buf, uint32_t buf_size);
+/* restore a snapshot into an initialized instance, returns false if the snapshot doesn't match */
+extern bool atom_load_snapshot(atom_t* sys, const void* buf, uint32_t buf_size);
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#ifdef CHIPS_IMPL
+#include <string.h>
+#ifndef CHIPS_ASSERT
+    #include <assert.h>
+    #define CHIPS_ASSERT(c) assert(c)
+#endif
+
+/* the emulator instance running on the current thread */
+static CHIPS_THREAD_LOCAL atom_t* _atom_sys;
+
+uint64_t atom_cpu_tick(uint64_t pins);
+uint64_t atom_vdg_fetch(uint64_t pins);
+uint8_t atom_ppi_in(int port_id);
+uint64_t atom_ppi_out(int port_id, uint64_t pins, uint8_t data);
+
+/* xorshift randomness for memory initialization */
+static uint32_t _atom_xorshift32(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x<<13; x ^= x>>17; x ^= x<<5;
+    *state = x;
+    return x;
+}
+
+/* the Atom's memory map is fixed, this is also called to rebuild it after a snapshot restore */
+static void _atom_init_memory_map(atom_t* sys) {
+    mem_init(&sys->mem);
+    /* 32 KByte RAM + 8 KByte vidmem */
+    mem_map_ram(&sys->mem, 0, 0x0000, 0xA000, sys->ram);
+    /* hole in 0xA000 to 0xAFFF for utility roms */
+    /* 0xC000 to 0xFFFF are operating system roms */
+    mem_map_rom(&sys->mem, 0, 0xC000, 0x1000, sys->rom_abasic);
+    mem_map_rom(&sys->mem, 0, 0xD000, 0x1000, sys->rom_afloat);
+    mem_map_rom(&sys->mem, 0, 0xE000, 0x1000, sys->rom_dosrom);
+    mem_map_rom(&sys->mem, 0, 0xF000, 0x1000, sys->rom_abasic+0x1000);
+}
+
+/* Atom emulator initialization */
+void atom_init(atom_t* sys, const atom_desc_t* desc) {
+    CHIPS_ASSERT(sys && desc && desc->rgba8_buffer);
+    CHIPS_ASSERT(desc->rgba8_buffer_size >= (MC6847_DISPLAY_WIDTH*MC6847_DISPLAY_HEIGHT*sizeof(uint32_t)));
+    memset(sys, 0, sizeof(atom_t));
+    _atom_sys = sys;
+    sys->rgba8_buffer = desc->rgba8_buffer;
+    sys->rgba8_buffer_size = desc->rgba8_buffer_size;
+    sys->rom_abasic = desc->rom_abasic ? desc->rom_abasic : dump_abasic;
+    sys->rom_afloat = desc->rom_afloat ? desc->rom_afloat : dump_afloat;
+    sys->rom_dosrom = desc->rom_dosrom ? desc->rom_dosrom : dump_dosrom;
+    sys->prof = desc->prof;
+    sys->vdg_batching = !desc->disable_vdg_batching;
+
+    /* setup memory map, first fill memory with random values */
+    uint32_t xorshift_state = 0x6D98302B;
+    for (int i = 0; i < (int)sizeof(sys->ram);) {
+        uint32_t r = _atom_xorshift32(&xorshift_state);
+        sys->ram[i++]=r>>24; sys->ram[i++]=r>>16; sys->ram[i++]=r>>8; sys->ram[i++]=r;
+    }
+    _atom_init_memory_map(sys);
+    /* 0xB000 to 0xBFFF is memory-mapped IO area (not mapped to host memory) */
+    iopage_init(&sys->io_pages, ATOM_IOPAGE_MEM);
+    iopage_map(&sys->io_pages, 0xB000, 0x0400, ATOM_IOPAGE_PPI);
+    iopage_map(&sys->io_pages, 0xB400, 0x0C00, ATOM_IOPAGE_EXP);
+
+    /*  setup the keyboard matrix
+        the Atom has a 10x8 keyboard matrix, where the
+        entire line 6 is for the Ctrl key, and the entire
+        line 7 is the Shift key
+    */
+    kbd_init(&sys->kbd, 1);
+    /* shift key is entire line 7 */
+    const int shift = (1<<0); kbd_register_modifier_line(&sys->kbd, 0, 7);
+    /* ctrl key is entire line 6 */
+    const int ctrl = (1<<1); kbd_register_modifier_line(&sys->kbd, 1, 6);
+    /* alpha-numeric keys */
+    const char* keymap = 
+        /* no shift */
+        "     ^]\\[ "/**/"3210      "/* */"-,;:987654"/**/"GFEDCBA@/."/**/"QPONMLKJIH"/**/" ZYXWVUTSR"
+        /* shift */
+        "          "/* */"#\"!       "/**/"=<+*)('&%$"/**/"gfedcba ?>"/**/"qponmlkjih"/**/" zyxwvutsr";
+    for (int layer = 0; layer < 2; layer++) {
+        for (int col = 0; col < 10; col++) {
+            for (int line = 0; line < 6; line++) {
+                int c = keymap[layer*60 + line*10 + col];
+                if (c != 0x20) {
+                    kbd_register_key(&sys->kbd, c, col, line, layer?shift:0);
+                }
+            }
+        }
+    }
+    /* special keys */
+    kbd_register_key(&sys->kbd, 0x20, 9, 0, 0);      /* space */
+    kbd_register_key(&sys->kbd, 0x01, 4, 1, 0);      /* backspace */
+    kbd_register_key(&sys->kbd, 0x08, 3, 0, shift);  /* left */
+    kbd_register_key(&sys->kbd, 0x09, 3, 0, 0);      /* right */
+    kbd_register_key(&sys->kbd, 0x0A, 2, 0, shift);  /* down */
+    kbd_register_key(&sys->kbd, 0x0B, 2, 0, 0);      /* up */
+    kbd_register_key(&sys->kbd, 0x0D, 6, 1, 0);      /* return/enter */
+    kbd_register_key(&sys->kbd, 0x1B, 0, 5, 0);      /* escape */
+    kbd_register_key(&sys->kbd, 0x0C, 5, 4, ctrl);   /* Ctrl+L, clear screen, mapped to F1 */
+
+    /* initialize chips */
+    m6502_init(&sys->cpu, &(m6502_desc_t){
+        .tick_cb = atom_cpu_tick
+    });
+    mc6847_init(&sys->vdg, &(mc6847_desc_t){
+        .tick_hz = ATOM_FREQ,
+        .rgba8_buffer = desc->rgba8_buffer,
+        .rgba8_buffer_size = desc->rgba8_buffer_size,
+        .fetch_cb = atom_vdg_fetch
+    });
+    i8255_init(&sys->ppi, atom_ppi_in, atom_ppi_out);
+
+    /* initialize the 2.4 khz oscillator */
+    sched_init(&sys->sched);
+    sched_set_in(&sys->sched, ATOM_EVENT_2_4KHZ, ATOM_FREQ / 2400, ATOM_FREQ / 2400);
+    sys->state_2_4khz = false;
+
+    /* reset the CPU to go into 'start state' */
+    m6502_reset(&sys->cpu);
+}
+
+/* run the deferred MC6847 ticks */
+static inline void _atom_vdg_catchup(atom_t* sys) {
+    for (uint32_t i = sys->vdg_pending_ticks; i > 0; i--) {
+        mc6847_tick(&sys->vdg);
+    }
+    sys->vdg_pending_ticks = 0;
+}
+
+/* run the Atom emulation for at least the given number of ticks */
+uint32_t atom_exec(atom_t* sys, uint32_t ticks) {
+    _atom_sys = sys;
+    const uint32_t ticks_executed = m6502_exec(&sys->cpu, ticks);
+    /* the framebuffer must be complete when returning */
+    _atom_vdg_catchup(sys);
+    return ticks_executed;
+}
+
+/* CPU tick callback */
+uint64_t atom_cpu_tick(uint64_t pins) {
+    atom_t* sys = _atom_sys;
+    if (sys->prof) {
+        pcprof_tick(sys->prof, 1, 0 != (pins & M6502_SYNC), M6502_GET_ADDR(pins));
+    }
+    /* tick the video chip, or defer the tick */
+    if (sys->vdg_batching) {
+        sys->vdg_pending_ticks++;
+    }
+    else {
+        mc6847_tick(&sys->vdg);
+    }
+
+    /* scheduled events (the 2.4khz oscillator) */
+    if (sched_advance(&sys->sched, 1)) {
+        int id;
+        while ((id = sched_pop(&sys->sched)) >= 0) {
+            if (ATOM_EVENT_2_4KHZ == id) {
+                sys->state_2_4khz = !sys->state_2_4khz;
+            }
+        }
+    }
+
+    /* decode address for memory-mapped IO and memory read/write */
+    const uint16_t addr = M6502_GET_ADDR(pins);
+    const uint8_t page = iopage_get(&sys->io_pages, addr);
+    if (page != ATOM_IOPAGE_MEM) {
+        /* memory-mapped IO area */
+        if (page == ATOM_IOPAGE_PPI) {
+            /* port C reads the MC6847 FSYNC pin, port A and C writes change the video mode */
+            _atom_vdg_catchup(sys);
+            /* i8255 PPI: http://www.acornatom.nl/sites/fpga/www.howell1964.freeserve.co.uk/acorn/atom/amb/amb_8255.htm */
+            uint64_t ppi_pins = (pins & M6502_PIN_MASK) | I8255_CS;
+            if (pins & M6502_RW) { ppi_pins |= I8255_RD; }  /* PPI read access */
+            else { ppi_pins |= I8255_WR; }                  /* PPI write access */
+            if (pins & M6502_A0) { ppi_pins |= I8255_A0; }  /* PPI has 4 addresses (port A,B,C or control word */
+            if (pins & M6502_A1) { ppi_pins |= I8255_A1; }
+            pins = i8255_iorq(&sys->ppi, ppi_pins) & M6502_PIN_MASK;
+        }
+        else {
+            /* remaining IO space is for expansion devices */
+            if (pins & M6502_RW) {
+                M6502_SET_DATA(pins, 0x00);
+            }
+        }
+    }
+    else {
+        /* memory access */
+        if (pins & M6502_RW) {
+            /* memory read */
+            M6502_SET_DATA(pins, mem_rd(&sys->mem, addr));
+        }
+        else {
+            /* memory access, the video memory must be written after the pending video chip fetches */
+            if ((addr >= 0x8000) && (addr < 0xA000)) {
+                _atom_vdg_catchup(sys);
+            }
+            mem_wr(&sys->mem, addr, M6502_GET_DATA(pins));
+        }
+    }
+    return pins;
+}
+
+/* video memory fetch callback */
+uint64_t atom_vdg_fetch(uint64_t pins) {
+    atom_t* sys = _atom_sys;
+    const uint16_t addr = MC6847_GET_ADDR(pins);
+    uint8_t data = sys->ram[(addr + 0x8000) & 0xFFFF];
+    MC6847_SET_DATA(pins, data);
+
+    /*  the upper 2 databus bits are directly wired to MC6847 pins:
+        bit 7 -> INV pin (in text mode, invert pixel pattern)
+        bit 6 -> A/S and INT/EXT pin, A/S actives semigraphics mode
+                 and INT/EXT selects the 2x3 semigraphics pattern
+                 (so 4x4 semigraphics isn't possible)
+    */
+    if (data & (1<<7)) { pins |= MC6847_INV; }
+    else               { pins &= ~MC6847_INV; }
+    if (data & (1<<6)) { pins |= (MC6847_AS|MC6847_INTEXT); }
+    else               { pins &= ~(MC6847_AS|MC6847_INTEXT); }
+    return pins;
+}
+
+/* i8255 PPI output */
+uint64_t atom_ppi_out(int port_id, uint64_t pins, uint8_t data) {
+    atom_t* sys = _atom_sys;
+    /*
+        FROM Atom Theory and Praxis (and MAME)
+        The  8255  Programmable  Peripheral  Interface  Adapter  contains  three
+        8-bit ports, and all but one of these lines is used by the ATOM.
+        Port A - #B000
+               Output bits:      Function:
+                    O -- 3     Keyboard column
+                    4 -- 7     Graphics mode (4: A/G, 5..7: GM0..2)
+        Port B - #B001
+               Input bits:       Function:
+                    O -- 5     Keyboard row
+                      6        CTRL key (low when pressed)
+                      7        SHIFT keys {low when pressed)
+        Port C - #B002
+               Output bits:      Function:
+                    O          Tape output
+                    1          Enable 2.4 kHz to cassette output
+                    2          Loudspeaker
+                    3          Not used (??? see below)
+               Input bits:       Function:
+                    4          2.4 kHz input
+                    5          Cassette input
+                    6          REPT key (low when pressed)
+                    7          60 Hz sync signal (low during flyback)
+        The port C output lines, bits O to 3, may be used for user
+        applications when the cassette interface is not being used.
+    */
+    if (I8255_PORT_A == port_id) {
+        /* PPI port A
+            0..3:   keyboard matrix column to scan next
+            4:      MC6847 A/G
+            5:      MC6847 GM0
+            6:      MC6847 GM1
+            7:      MC6847 GM2
+        */
+        kbd_set_active_columns(&sys->kbd, 1<<(data & 0x0F));
+        uint64_t vdg_pins = 0;
+        uint64_t vdg_mask = MC6847_AG|MC6847_GM0|MC6847_GM1|MC6847_GM2;
+        if (data & (1<<4)) { vdg_pins |= MC6847_AG; }
+        if (data & (1<<5)) { vdg_pins |= MC6847_GM0; }
+        if (data & (1<<6)) { vdg_pins |= MC6847_GM1; }
+        if (data & (1<<7)) { vdg_pins |= MC6847_GM2; }
+        mc6847_ctrl(&sys->vdg, vdg_pins, vdg_mask);
+    }
+    else if (I8255_PORT_C == port_id) {
+        /* PPI port C output:
+            0:  output: cass 0
+            1:  output: cass 1
+            2:  output: speaker
+            3:  output: MC6847 CSS
+
+            NOTE: only the MC6847 CSS pin is emulated here
+        */
+        uint64_t vdg_pins = 0;
+        uint64_t vdg_mask = MC6847_CSS;
+        if (data & (1<<3)) {
+            vdg_pins |= MC6847_CSS;
+        }
+        mc6847_ctrl(&sys->vdg, vdg_pins, vdg_mask);
+    }
+    return pins;
+}
+
+/* i8255 PPI input callback */
+uint8_t atom_ppi_in(int port_id) {
+    atom_t* sys = _atom_sys;
+    uint8_t data = 0;
+    if (I8255_PORT_B == port_id) {
+        /* keyboard row state */
+        data = ~kbd_scan_lines(&sys->kbd);
+    }
+    else if (I8255_PORT_C == port_id) {
+        /*  PPI port C input:
+            4:  input: 2400 Hz
+            5:  input: cassette
+            6:  input: keyboard repeat
+            7:  input: MC6847 FSYNC
+
+            NOTE: only the 2400 Hz oscillator and FSYNC pins is emulated here
+        */
+        if (sys->state_2_4khz) {
+            data |= (1<<4);
+        }
+        /* FIXME: always send REPEAT key as 'not pressed' */
+        data |= (1<<6);
+        /* vblank pin (cleared during vblank) */
+        if (0 == (sys->vdg.pins & MC6847_FS)) {
+            data |= (1<<7);
+        }
+    }
+    return data;
+}
+
+#define ATOM_SNAPSHOT_ID SNAPSHOT_FOURCC('A','T','O','M')
+
+uint32_t atom_snapshot_size(void) {
+    return snapshot_size(sizeof(atom_t));
+}
+
+uint32_t atom_save_snapshot(const atom_t* sys, void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    return snapshot_save(buf, buf_size, ATOM_SNAPSHOT_ID, sys, sizeof(atom_t));
+}
+
+bool atom_load_snapshot(atom_t* sys, const void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    uint32_t* rgba8_buffer = sys->rgba8_buffer;
+    const uint32_t rgba8_buffer_size = sys->rgba8_buffer_size;
+    const uint8_t* rom_abasic = sys->rom_abasic;
+    const uint8_t* rom_afloat = sys->rom_afloat;
+    const uint8_t* rom_dosrom = sys->rom_dosrom;
+    pcprof_t* prof = sys->prof;
+    const bool vdg_batching = sys->vdg_batching;
+    if (!snapshot_load(buf, buf_size, ATOM_SNAPSHOT_ID, sys, sizeof(atom_t))) {
+        return false;
+    }
+    /* keep the framebuffer, ROMs and profiler of this instance */
+    sys->rgba8_buffer = rgba8_buffer;
+    sys->rgba8_buffer_size = rgba8_buffer_size;
+    sys->rom_abasic = rom_abasic;
+    sys->rom_afloat = rom_afloat;
+    sys->rom_dosrom = rom_dosrom;
+    sys->prof = prof;
+    sys->vdg_batching = vdg_batching;
+    /* restore the chip callbacks and rebuild the memory map */
+    sys->cpu.tick_cb = atom_cpu_tick;
+    sys->vdg.fetch_cb = atom_vdg_fetch;
+    sys->vdg.rgba8_buffer = rgba8_buffer;
+    sys->ppi.in_cb = atom_ppi_in;
+    sys->ppi.out_cb = atom_ppi_out;
+    _atom_init_memory_map(sys);
+    return true;
+}
+
+#endif /* CHIPS_IMPL */
@@ -0,0 +1,945 @@
+#pragma once
+/*
+    c64.h
+
+    The C64 (PAL) emulator core without any platform dependencies,
+    used by the c64 example and the headless chips-bench.
+
+    SID audio output goes through the audio_cb callback. No tape or disc emulation,
+    .prg files are loaded directly into RAM (c64_quickload()).
+    The original is part of the YAKC emulator: https://github.com/floooh/yakc
+
+    Do this:
+        #define CHIPS_IMPL
+    before you include this file in *one* C file to create the
+    implementation.
+*/
+#include "chips/m6502.h"
+#include "chips/m6526.h"
+#include "chips/m6569.h"
+#include "chips/m6581.h"
+#include "chips/kbd.h"
+#include "chips/mem.h"
+#include "common/thread.h"
+#include "common/snapshot.h"
+#include "common/clone.h"
+#include "common/iopage.h"
+#include "common/pcprof.h"
+#include "common/chiptime.h"
+#include "common/bustrace.h"
+#include "common/debugger.h"
+#include "common/heatmap.h"
+#include "roms/c64-roms.h"
+
+#define C64_FREQ (985248)
+/* ticks per PAL video frame (312 lines of 63 cycles, 50.12 Hz) */
+#define C64_FRAME_TICKS (312 * 63)
+#define C64_DISP_X (64)
+#define C64_DISP_Y (24)
+#define C64_DISP_WIDTH (392)
+#define C64_DISP_HEIGHT (272)
+
+#define C64_MAX_AUDIO_SAMPLES (1024)        /* max number of audio samples in the internal sample buffer */
+#define C64_DEFAULT_AUDIO_SAMPLES (128)     /* default number of samples per audio callback */
+#define C64_CIA_LAZY_MARGIN (8)            /* CIA ticks before a timer underflow which are never deferred */
+#define C64_CIA_LAZY_RECHECK (16)          /* CIA ticks to run directly before looking for a new deadline */
+
+/* what a 256-byte page of CPU address space is mapped to (see c64_t.io_pages) */
+enum {
+    C64_IOPAGE_MEM = 0,         /* regular RAM/ROM access through mem_cpu */
+    C64_IOPAGE_ZERO,            /* zero page, the M6510 IO port at 0/1, memory otherwise */
+    C64_IOPAGE_VIC,             /* VIC-II (D000..D3FF) */
+    C64_IOPAGE_SID,             /* SID (D400..D7FF) */
+    C64_IOPAGE_COLOR_RAM,       /* color RAM (D800..DBFF) */
+    C64_IOPAGE_CIA1,            /* CIA-1 (DC00..DCFF) */
+    C64_IOPAGE_CIA2,            /* CIA-2 (DD00..DDFF) */
+    C64_IOPAGE_EXP,             /* expansion system (DE00..DFFF, not implemented) */
+};
+
+/* chiptime slots (see common/chiptime.h, only used when compiled with CHIPS_CHIPTIME) */
+enum {
+    C64_CHIPTIME_CPU = 0,       /* CPU emulation between tick callbacks */
+    C64_CHIPTIME_SID,
+    C64_CHIPTIME_CIA1,
+    C64_CHIPTIME_CIA2,
+    C64_CHIPTIME_VIC,
+    C64_CHIPTIME_MEM,           /* memory and IO requests */
+    C64_CHIPTIME_NUM,
+};
+#define C64_CHIPTIME_NAMES "cpu", "sid", "cia1", "cia2", "vic", "mem"
+
+/* audio output callback, invoked with a batch of mono samples */
+typedef void (*c64_audio_callback_t)(const float* samples, int num_samples);
+
+/* C64 emulator state
+
+   The fields which are touched on every tick (CPU, VIC-II and their
+   memory page tables, the deferred chip tick counters and the optional
+   instrumentation pointers) are packed together at the start, followed
+   by the state which is only touched on IO accesses, per frame, or never
+   after setup, and the bulk RAM. Each group starts on its own cache line.
+*/
+typedef struct {
+    /* -- touched on every tick -- */
+    CHIPS_CACHE_ALIGNED m6502_t cpu;
+    uint32_t audio_pending_ticks; // number of deferred SID ticks
+    uint32_t cia_pending[2];    // number of deferred CIA ticks
+    uint32_t cia_safe[2];       // number of ticks in which the CIA IRQ output can't change
+    uint32_t cia_direct[2];     // number of ticks to run directly before the next deadline check
+    bool cia_lazy;              // defer CIA ticks until the next register access or timer deadline
+    bool cia_irq[2];            // last IRQ output of CIA-1 and CIA-2
+    uint8_t cia_imr[2];         // shadow copy of the CIA interrupt mask registers
+    bool audio_batching;        // defer SID ticks until a SID access or the end of c64_exec()
+    bool io_mapped;             // true when D000..DFFF is has IO area mapped in
+    uint8_t cpu_port;           // last state of CPU port (for memory mapping)
+    pcprof_t* prof;             // optional PC-sampling profiler
+    chiptime_t* chiptime;       // optional per-chip host time accounting
+    bustrace_t* trace;          // optional bus cycle trace recorder
+    dbg_t* dbg;                 // optional breakpoints and watchpoints
+    heatmap_t* heatmap;         // optional per-page access counters
+    mem_t mem_cpu;              // how the CPU sees memory
+    m6569_t vic;
+    mem_t mem_vic;              // how the VIC sees memory
+    iopage_t io_pages;          // C64_IOPAGE_* per 256-byte page, rebuilt in c64_update_memory_map()
+
+    /* -- touched on IO accesses, per frame, or only at setup -- */
+    CHIPS_CACHE_ALIGNED m6526_t cia_1;
+    m6526_t cia_2;
+    m6581_t sid;
+    kbd_t kbd;                  // keyboard matrix
+    uint16_t vic_bank_select;   // upper 4 address bits from CIA-2 port A
+    int num_samples;            // number of samples per audio callback
+    int sample_pos;             // current position in sample_buffer
+    c64_audio_callback_t audio_cb; // audio output callback
+    uint32_t* rgba8_buffer;     // decoded video output
+    uint32_t rgba8_buffer_size;
+    const uint8_t* rom_char;    // 4 KB character ROM
+    const uint8_t* rom_basic;   // 8 KB BASIC ROM
+    const uint8_t* rom_kernal;  // 8 KB KERNAL ROM
+
+    /* -- bulk memory -- */
+    CHIPS_CACHE_ALIGNED uint8_t color_ram[1024]; // special static color ram
+    uint8_t ram[1<<16];         // general ram
+    float sample_buffer[C64_MAX_AUDIO_SAMPLES];
+} c64_t;
+
+/* C64 emulator setup parameters */
+typedef struct {
+    uint32_t* rgba8_buffer;         /* the framebuffer for the decoded video output */
+    uint32_t rgba8_buffer_size;     /* size of the framebuffer in bytes */
+    /* optional audio output, audio_cb is called with batches of audio_num_samples samples */
+    c64_audio_callback_t audio_cb;
+    int audio_num_samples;          /* default is C64_DEFAULT_AUDIO_SAMPLES */
+    int audio_sample_rate;          /* playback sample rate, default is 44100 */
+    /* optional ROM images (e.g. memory-mapped files), default are the embedded dumps */
+    const uint8_t* rom_char;        /* 4 KB character ROM */
+    const uint8_t* rom_basic;       /* 8 KB BASIC ROM */
+    const uint8_t* rom_kernal;      /* 8 KB KERNAL ROM */
+    pcprof_t* prof;                 /* optional PC-sampling profiler (see common/pcprof.h) */
+    chiptime_t* chiptime;           /* optional per-chip host time accounting (see common/chiptime.h) */
+    bustrace_t* trace;              /* optional bus cycle trace recorder (see common/bustrace.h) */
+    dbg_t* dbg;                     /* optional breakpoints and watchpoints (see common/debugger.h) */
+    heatmap_t* heatmap;             /* optional per-page access counters (see common/heatmap.h) */
+    bool disable_cia_lazy;          /* tick the CIAs together with the CPU */
+    bool disable_audio_batching;    /* tick the SID together with the CPU */
+} c64_desc_t;
+
+/* initialize a C64 emulator instance */
+extern void c64_init(c64_t* sys, const c64_desc_t* desc);
+/* run an emulator instance for at least the given number of ticks, returns executed ticks */
+extern uint32_t c64_exec(c64_t* sys, uint32_t ticks);
+/* load a .prg file into RAM, BASIC programs (loaded at 0801) are started
+   with RUN, call after the system has booted into BASIC, returns false if
+   the data isn't a valid .prg
+*/
+extern bool c64_quickload(c64_t* sys, const uint8_t* ptr, uint32_t num_bytes);
+/* size of a C64 snapshot in bytes */
+extern uint32_t c64_snapshot_size(void);
+/* save a snapshot of an instance into buf, returns number of bytes written (0 if buf is too small) */
+extern uint32_t c64_save_snapshot(const c64_t* sys, void* buf, uint32_t buf_size);
+/* restore a snapshot into an initialized instance, returns false if the snapshot doesn't match */
+extern bool c64_load_snapshot(c64_t* sys, const void* buf, uint32_t buf_size);
+/* create a copy-on-write clone base from a snapshot of an instance (see common/clone.h), returns false if the snapshot doesn't match */
+extern bool c64_clone_base(clone_base_t* base, const void* buf, uint32_t buf_size);
+/* map a new instance from a clone base which shares all unwritten pages with the base, returns 0 on failure */
+extern c64_t* c64_clone(const clone_base_t* base, uint32_t* rgba8_buffer, uint32_t rgba8_buffer_size);
+/* release a cloned instance */
+extern void c64_free_clone(const clone_base_t* base, c64_t* sys);
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#ifdef CHIPS_IMPL
+#include <string.h>
+#ifndef CHIPS_ASSERT
+    #include <assert.h>
+    #define CHIPS_ASSERT(c) assert(c)
+#endif
+
+void c64_update_memory_map(c64_t* sys);
+uint64_t c64_cpu_tick(uint64_t pins);
+uint8_t c64_cpu_port_in(void);
+void c64_cpu_port_out(uint8_t data);
+void c64_cia1_out(int port_id, uint8_t data);
+uint8_t c64_cia1_in(int port_id);
+void c64_cia2_out(int port_id, uint8_t data);
+uint8_t c64_cia2_in(int port_id);
+uint16_t c64_vic_fetch(uint16_t addr);
+
+/* the emulator instance running on the current thread */
+static CHIPS_THREAD_LOCAL c64_t* _c64_sys;
+
+/* store a new audio sample, and hand the batch to the audio callback when full */
+static inline void _c64_audio_sample(c64_t* sys, float sample) {
+    sys->sample_buffer[sys->sample_pos++] = sample;
+    if (sys->sample_pos == sys->num_samples) {
+        if (sys->audio_cb) {
+            sys->audio_cb(sys->sample_buffer, sys->num_samples);
+        }
+        sys->sample_pos = 0;
+    }
+}
+
+/* run the deferred SID ticks, the samples go into the sample buffer as usual */
+static inline void _c64_sid_catchup(c64_t* sys) {
+    for (; sys->audio_pending_ticks > 0; sys->audio_pending_ticks--) {
+        if (m6581_tick(&sys->sid)) {
+            _c64_audio_sample(sys, sys->sid.sample);
+        }
+    }
+}
+
+/* run the deferred ticks of a CIA, this brings it up to the current tick */
+static inline void _c64_cia_catchup(c64_t* sys, int i) {
+    m6526_t* cia = i ? &sys->cia_2 : &sys->cia_1;
+    for (; sys->cia_pending[i] > 0; sys->cia_pending[i]--) {
+        sys->cia_irq[i] = 0 != (m6526_tick(cia, 0) & M6502_IRQ);
+    }
+}
+
+static inline uint8_t _c64_cia_read(m6526_t* cia, uint8_t reg) {
+    return M6502_GET_DATA(m6526_iorq(cia, M6526_CS|M6502_RW|reg));
+}
+
+/* the number of upcoming ticks in which a CIA's IRQ output can't change
+   without a CPU access to the CIA: the IRQ can only go active through an
+   enabled interrupt source, for the timers this can't happen before the
+   counter reaches zero, and the IRQ can only go inactive by reading the ICR
+*/
+static uint32_t _c64_cia_safe_ticks(c64_t* sys, int i) {
+    const uint8_t imr = sys->cia_imr[i];
+    if (imr & ((1<<2)|(1<<3))) {
+        /* TOD alarm or serial port interrupts enabled, no deadline known */
+        return 0;
+    }
+    m6526_t* cia = i ? &sys->cia_2 : &sys->cia_1;
+    uint32_t ticks = 0x10000;
+    const uint8_t cra = _c64_cia_read(cia, 0x0E);
+    const uint8_t crb = _c64_cia_read(cia, 0x0F);
+    /* timer A counts system clock ticks when started and CRA bit 5 is clear */
+    const bool ta_running = (cra & 0x21) == 0x01;
+    const uint32_t ta = _c64_cia_read(cia, 0x04) | (_c64_cia_read(cia, 0x05)<<8);
+    if ((imr & (1<<0)) && ta_running && (ta < ticks)) {
+        ticks = ta;
+    }
+    if ((imr & (1<<1)) && (crb & 0x01)) {
+        /* timer B counts system clock ticks, or timer A underflows (CRB bits 5..6) */
+        const uint8_t mode = (crb>>5) & 3;
+        const uint32_t tb = _c64_cia_read(cia, 0x06) | (_c64_cia_read(cia, 0x07)<<8);
+        if ((mode == 0) && (tb < ticks)) {
+            ticks = tb;
+        }
+        else if ((mode >= 2) && ta_running && (ta < ticks)) {
+            ticks = ta;
+        }
+    }
+    return (ticks > C64_CIA_LAZY_MARGIN) ? (ticks - C64_CIA_LAZY_MARGIN) : 0;
+}
+
+/* tick a CIA, in lazy mode the tick is deferred while its IRQ output can't change, returns the IRQ output */
+static inline bool _c64_cia_tick(c64_t* sys, int i, uint64_t pins) {
+    m6526_t* cia = i ? &sys->cia_2 : &sys->cia_1;
+    if (!sys->cia_lazy) {
+        return 0 != (m6526_tick(cia, pins & ~M6502_IRQ) & M6502_IRQ);
+    }
+    if (sys->cia_safe[i] > 0) {
+        sys->cia_safe[i]--;
+        sys->cia_pending[i]++;
+        return sys->cia_irq[i];
+    }
+    _c64_cia_catchup(sys, i);
+    sys->cia_irq[i] = 0 != (m6526_tick(cia, pins & ~M6502_IRQ) & M6502_IRQ);
+    if (sys->cia_direct[i] > 0) {
+        sys->cia_direct[i]--;
+    }
+    else {
+        sys->cia_safe[i] = _c64_cia_safe_ticks(sys, i);
+        if (0 == sys->cia_safe[i]) {
+            sys->cia_direct[i] = C64_CIA_LAZY_RECHECK;
+        }
+    }
+    return sys->cia_irq[i];
+}
+
+/* a CPU access to a CIA register, this also ends a lazy CIA's deferred period
+   (the interrupt mask is tracked in both modes, so snapshots can be loaded
+   into an instance with a different cia_lazy setting)
+*/
+static inline uint64_t _c64_cia_iorq(c64_t* sys, int i, uint64_t pins) {
+    m6526_t* cia = i ? &sys->cia_2 : &sys->cia_1;
+    _c64_cia_catchup(sys, i);
+    sys->cia_safe[i] = 0;
+    sys->cia_direct[i] = 0;
+    if (!(pins & M6502_RW) && ((M6502_GET_ADDR(pins) & 0x0F) == 0x0D)) {
+        /* bit 7 of a write to the ICR selects between setting and clearing mask bits */
+        const uint8_t data = M6502_GET_DATA(pins);
+        if (data & 0x80) {
+            sys->cia_imr[i] |= data & 0x1F;
+        }
+        else {
+            sys->cia_imr[i] &= ~data;
+        }
+    }
+    return m6526_iorq(cia, (pins & M6502_PIN_MASK)|M6526_CS) & M6502_PIN_MASK;
+}
+
+/* setup the CPU and VIC-II memory maps for the current CPU port state,
+   this is also called to rebuild them after a snapshot restore
+*/
+static void _c64_init_memory_map(c64_t* sys) {
+    mem_unmap_all(&sys->mem_cpu);
+    mem_unmap_all(&sys->mem_vic);
+
+    /* 0000..9FFF and C000.CFFF is always RAM */
+    mem_map_ram(&sys->mem_cpu, 0, 0x0000, 0xA000, sys->ram);
+    mem_map_ram(&sys->mem_cpu, 0, 0xC000, 0x1000, sys->ram+0xC000);
+    /* A000..BFFF, D000..DFFF and E000..FFFF are configurable */
+    c64_update_memory_map(sys);
+
+    /* the separate VIC-II memory map (64 KByte RAM) overlayed with
+       character ROMS at 0x1000.0x1FFF and 0x9000..0x9FFF
+    */
+    mem_map_ram(&sys->mem_vic, 1, 0x0000, 0x10000, sys->ram);
+    mem_map_rom(&sys->mem_vic, 0, 0x1000, 0x1000, sys->rom_char);
+    mem_map_rom(&sys->mem_vic, 0, 0x9000, 0x1000, sys->rom_char);
+}
+
+/* C64 emulator init */
+void c64_init(c64_t* sys, const c64_desc_t* desc) {
+    CHIPS_ASSERT(sys && desc && desc->rgba8_buffer);
+    CHIPS_ASSERT(desc->rgba8_buffer_size >= (C64_DISP_WIDTH*C64_DISP_HEIGHT*sizeof(uint32_t)));
+    memset(sys, 0, sizeof(c64_t));
+    _c64_sys = sys;
+    sys->rgba8_buffer = desc->rgba8_buffer;
+    sys->rgba8_buffer_size = desc->rgba8_buffer_size;
+    CHIPS_ASSERT(desc->audio_num_samples <= C64_MAX_AUDIO_SAMPLES);
+    sys->audio_cb = desc->audio_cb;
+    sys->num_samples = (desc->audio_num_samples > 0) ? desc->audio_num_samples : C64_DEFAULT_AUDIO_SAMPLES;
+    const int audio_hz = (desc->audio_sample_rate > 0) ? desc->audio_sample_rate : 44100;
+    sys->rom_char = desc->rom_char ? desc->rom_char : dump_c64_char;
+    sys->rom_basic = desc->rom_basic ? desc->rom_basic : dump_c64_basic;
+    sys->rom_kernal = desc->rom_kernal ? desc->rom_kernal : dump_c64_kernalv3;
+    sys->prof = desc->prof;
+    sys->chiptime = desc->chiptime;
+    sys->trace = desc->trace;
+    sys->dbg = desc->dbg;
+    sys->heatmap = desc->heatmap;
+    sys->cia_lazy = !desc->disable_cia_lazy;
+    sys->audio_batching = !desc->disable_audio_batching;
+    sys->cpu_port = 0xF7;        // for initial memory configuration
+    sys->io_mapped = true;
+
+    /* initialize the CPU */
+    m6502_init(&sys->cpu, &(m6502_desc_t){
+        .tick_cb = c64_cpu_tick,
+        .in_cb = c64_cpu_port_in,
+        .out_cb = c64_cpu_port_out,
+        .m6510_io_pullup = 0x17,
+        .m6510_io_floating = 0xC8
+    });
+
+    /* initialize the CIAs */
+    m6526_init(&sys->cia_1, c64_cia1_in, c64_cia1_out);
+    m6526_init(&sys->cia_2, c64_cia2_in, c64_cia2_out);
+
+    /* initialize the VIC-II display chip */
+    m6569_init(&sys->vic, &(m6569_desc_t){
+        .fetch_cb = c64_vic_fetch,
+        .rgba8_buffer = desc->rgba8_buffer,
+        .rgba8_buffer_size = desc->rgba8_buffer_size,
+        .vis_x = C64_DISP_X,
+        .vis_y = C64_DISP_Y,
+        .vis_w = C64_DISP_WIDTH,
+        .vis_h = C64_DISP_HEIGHT
+    });
+
+    /* initialize the SID audio chip */
+    m6581_init(&sys->sid, &(m6581_desc_t){
+        .tick_hz = C64_FREQ,
+        .sound_hz = audio_hz,
+        .magnitude = 1.0
+    });
+
+    /* initial memory map
+
+        the C64 has a weird RAM init pattern of 64 bytes 00 and 64 bytes FF
+        alternating, probably with some randomness sprinkled in
+        (see this thread: http://csdb.dk/forums/?roomid=11&topicid=116800&firstpost=2)
+        this is important at least for the value of the 'ghost byte' at 0x3FFF,
+        which is 0xFF
+    */
+    for (int i = 0; i < (1<<16); i++) {
+        sys->ram[i] = (i & (1<<6)) ? 0xFF : 0x00;
+    }
+
+    _c64_init_memory_map(sys);
+
+    /* put the CPU into start state */
+    m6502_reset(&sys->cpu);
+
+    /* setup the keyboard matrix
+        http://sta.c64.org/cbm64kbdlay.html
+        http://sta.c64.org/cbm64petkey.html
+    */
+    kbd_init(&sys->kbd, 1);
+    const char* keymap =
+        // no shift
+        "        "
+        "3WA4ZSE "
+        "5RD6CFTX"
+        "7YG8BHUV"
+        "9IJ0MKON"
+        "+PL-.:@,"
+        "~*;  = /"  // ~ is actually the British Pound sign
+        "1  2  Q "
+
+        // shift
+        "        "
+        "#wa$zse "
+        "%rd&cftx"
+        "'yg(bhuv"
+        ")ij0mkon"
+        " pl >[ <"
+        "$ ]    ?"
+        "!  \"  q ";
+    assert(strlen(keymap) == 128);
+    /* shift is column 7, line 1 */
+    kbd_register_modifier(&sys->kbd, 0, 7, 1);
+    /* ctrl is column 2, line 7 */
+    kbd_register_modifier(&sys->kbd, 1, 2, 7);
+    for (int shift = 0; shift < 2; shift++) {
+        for (int col = 0; col < 8; col++) {
+            for (int line = 0; line < 8; line++) {
+                int c = keymap[shift*64 + line*8 + col];
+                if (c != 0x20) {
+                    kbd_register_key(&sys->kbd, c, col, line, shift?(1<<0):0);
+                }
+            }
+        }
+    }
+
+    /* special keys */
+    kbd_register_key(&sys->kbd, 0x20, 4, 7, 0);    // space
+    kbd_register_key(&sys->kbd, 0x08, 2, 0, 1);    // cursor left
+    kbd_register_key(&sys->kbd, 0x09, 2, 0, 0);    // cursor right
+    kbd_register_key(&sys->kbd, 0x0A, 7, 0, 0);    // cursor down
+    kbd_register_key(&sys->kbd, 0x0B, 7, 0, 1);    // cursor up
+    kbd_register_key(&sys->kbd, 0x01, 0, 0, 0);    // delete
+    kbd_register_key(&sys->kbd, 0x0C, 3, 6, 1);    // clear
+    kbd_register_key(&sys->kbd, 0x0D, 1, 0, 0);    // return
+    kbd_register_key(&sys->kbd, 0x03, 7, 7, 0);    // stop
+    kbd_register_key(&sys->kbd, 0xF1, 4, 0, 0);
+    kbd_register_key(&sys->kbd, 0xF2, 4, 0, 1);
+    kbd_register_key(&sys->kbd, 0xF3, 5, 0, 0);
+    kbd_register_key(&sys->kbd, 0xF4, 5, 0, 1);
+    kbd_register_key(&sys->kbd, 0xF5, 6, 0, 0);
+    kbd_register_key(&sys->kbd, 0xF6, 6, 0, 1);
+    kbd_register_key(&sys->kbd, 0xF7, 3, 0, 0);
+    kbd_register_key(&sys->kbd, 0xF8, 3, 0, 1);
+}
+
+/* run the C64 emulation for at least the given number of ticks */
+uint32_t c64_exec(c64_t* sys, uint32_t ticks) {
+    _c64_sys = sys;
+    CHIPTIME_START(sys->chiptime);
+    const uint32_t ticks_executed = m6502_exec(&sys->cpu, ticks);
+    CHIPTIME_MARK(sys->chiptime, C64_CHIPTIME_CPU);
+    /* synthesize the deferred audio samples, and bring lazy CIAs up to
+       date, so that their state can be inspected between frames
+    */
+    _c64_sid_catchup(sys);
+    CHIPTIME_MARK(sys->chiptime, C64_CHIPTIME_SID);
+    _c64_cia_catchup(sys, 0);
+    CHIPTIME_MARK(sys->chiptime, C64_CHIPTIME_CIA1);
+    _c64_cia_catchup(sys, 1);
+    CHIPTIME_MARK(sys->chiptime, C64_CHIPTIME_CIA2);
+    return ticks_executed;
+}
+
+uint64_t c64_cpu_tick(uint64_t pins) {
+    c64_t* sys = _c64_sys;
+    CHIPTIME_MARK(sys->chiptime, C64_CHIPTIME_CPU);
+    const uint16_t addr = M6502_GET_ADDR(pins);
+    if (sys->prof) {
+        pcprof_tick(sys->prof, 1, 0 != (pins & M6502_SYNC), addr);
+    }
+
+    /* FIXME: tick the datasette, when the datasette output pulse
+       toggles, the FLAG input pin on CIA-1 will go active for 1 tick
+    */
+    uint64_t cia1_pins = pins;
+    /*
+    if (c64_tape_tick()) {
+        cia1_pins |= M6526_FLAG;
+    }
+    */
+
+    /* tick the SID, or defer the tick until the SID is accessed (the
+       SID's output only goes into the sample buffer, so audio samples can
+       be synthesized in batches)
+    */
+    if (sys->audio_batching) {
+        sys->audio_pending_ticks++;
+    }
+    else if (m6581_tick(&sys->sid)) {
+        _c64_audio_sample(sys, sys->sid.sample);
+    }
+    CHIPTIME_MARK(sys->chiptime, C64_CHIPTIME_SID);
+
+    /* tick the CIAs:
+        - CIA-1 gets the FLAG pin from the datasette
+        - the CIA-1 IRQ pin is connected to the CPU IRQ pin
+        - the CIA-2 IRQ pin is connected to the CPU NMI pin
+        - in lazy mode, CIA ticks are deferred until the CPU accesses
+          the CIA, or until a timer which can raise an interrupt gets
+          close to its underflow (once the datasette is implemented,
+          a FLAG pulse must also end the deferred period)
+    */
+    if (_c64_cia_tick(sys, 0, cia1_pins)) {
+        pins |= M6502_IRQ;
+    }
+    CHIPTIME_MARK(sys->chiptime, C64_CHIPTIME_CIA1);
+    if (_c64_cia_tick(sys, 1, pins)) {
+        pins |= M6502_NMI;
+    }
+    CHIPTIME_MARK(sys->chiptime, C64_CHIPTIME_CIA2);
+
+    /* tick the VIC-II display chip:
+        - the VIC-II IRQ pin is connected to the CPU IRQ pin and goes
+        active when the VIC-II requests a rasterline interrupt
+        - the VIC-II BA pin is connected to the CPU RDY pin, and stops
+        the CPU on the first CPU read access after BA goes active
+        - the VIC-II AEC pin is connected to the CPU AEC pin, currently
+        this goes active during a badline, but is not checked
+    */
+    pins = m6569_tick(&sys->vic, pins);
+    CHIPTIME_MARK(sys->chiptime, C64_CHIPTIME_VIC);
+
+    /* Special handling when the VIC-II asks the CPU to stop during a
+        'badline' via the BA=>RDY pin. If the RDY pin is active, the
+        CPU will 'loop' on the tick callback during the next READ access
+        until the RDY pin goes inactive. The tick callback must make sure
+        that only a single READ access happens during the entire RDY period.
+        Currently this happens on the very last tick when RDY goes from
+        active to inactive (I haven't found definitive documentation if
+        this is the right behaviour, but it made the Boulderdash fast loader work).
+    */
+    if ((pins & (M6502_RDY|M6502_RW)) == (M6502_RDY|M6502_RW)) {
+        if (sys->trace) {
+            bustrace_record(sys->trace, pins, 1);
+        }
+        return pins;
+    }
+
+    /* breakpoints are checked on opcode fetches, watchpoints on the
+       actual access (after a RDY stall), only pages with a breakpoint or
+       watchpoint take the slow path
+    */
+    if (sys->dbg && dbg_watched(sys->dbg, addr)) {
+        dbg_access(sys->dbg, addr, M6502_GET_DATA(pins), 0 != (pins & M6502_SYNC), 0 == (pins & M6502_RW), sys->cpu.state.PC);
+    }
+
+    /* handle memory and IO requests, the page table tells what the address is mapped to */
+    const uint8_t page = iopage_get(&sys->io_pages, addr);
+    if ((page == C64_IOPAGE_MEM) || ((page == C64_IOPAGE_ZERO) && !M6510_CHECK_IO(pins))) {
+        /* a regular memory access */
+        if (sys->heatmap) {
+            heatmap_count(sys->heatmap, HEATMAP_KIND(0 == (pins & M6502_RW), pins & M6502_SYNC), addr);
+        }
+        if (pins & M6502_RW) {
+            /* memory read */
+            M6502_SET_DATA(pins, mem_rd(&sys->mem_cpu, addr));
+        }
+        else {
+            /* memory write */
+            mem_wr(&sys->mem_cpu, addr, M6502_GET_DATA(pins));
+        }
+        CHIPTIME_MARK(sys->chiptime, C64_CHIPTIME_MEM);
+        if (sys->trace) {
+            bustrace_record(sys->trace, pins, 1);
+        }
+        return pins;
+    }
+    if (sys->heatmap) {
+        heatmap_count(sys->heatmap, HEATMAP_IO, addr);
+    }
+    switch (page) {
+        case C64_IOPAGE_ZERO:
+            /* the integrated IO port in the M6510 CPU at addresses 0 and 1 */
+            pins = m6510_iorq(&sys->cpu, pins);
+            break;
+        case C64_IOPAGE_VIC:
+            {
+                uint64_t vic_pins = (pins & M6502_PIN_MASK)|M6569_CS;
+                pins = m6569_iorq(&sys->vic, vic_pins) & M6502_PIN_MASK;
+            }
+            break;
+        case C64_IOPAGE_SID:
+            {
+                _c64_sid_catchup(sys);
+                uint64_t sid_pins = (pins & M6502_PIN_MASK)|M6581_CS;
+                pins = m6581_iorq(&sys->sid, sid_pins) & M6502_PIN_MASK;
+            }
+            break;
+        case C64_IOPAGE_COLOR_RAM:
+            /* read or write the special color Static-RAM bank */
+            if (pins & M6502_RW) {
+                M6502_SET_DATA(pins, sys->color_ram[addr & 0x03FF]);
+            }
+            else {
+                sys->color_ram[addr & 0x03FF] = M6502_GET_DATA(pins);
+            }
+            break;
+        case C64_IOPAGE_CIA1:
+            pins = _c64_cia_iorq(sys, 0, pins);
+            break;
+        case C64_IOPAGE_CIA2:
+            pins = _c64_cia_iorq(sys, 1, pins);
+            break;
+        default:
+            /* FIXME: expansion system (not implemented) */
+            break;
+    }
+    CHIPTIME_MARK(sys->chiptime, C64_CHIPTIME_MEM);
+    if (sys->trace) {
+        bustrace_record(sys->trace, pins, 1);
+    }
+    return pins;
+}
+
+uint8_t c64_cpu_port_in(void) {
+    /*
+        Input from the integrated M6510 CPU IO port
+
+        bit 4: [in] datasette button status (1: no button pressed)
+    */
+    uint8_t val = 7;
+    /* FIXME: datasette not implemented
+    if (!tape_playing) {
+        val |= (1<<4);
+    }
+    */
+    return val;
+}
+
+void c64_cpu_port_out(uint8_t data) {
+    c64_t* sys = _c64_sys;
+    /*
+        Output to the integrated M6510 CPU IO port
+
+        bits 0..2:  [out] memory configuration
+
+        bit 3: [out] datasette output signal level
+        bit 5: [out] datasette motor control (1: motor off)
+    */
+    /* FIXME: datasette not implemented
+    if (data & (1<<5)) {
+        tape_stop_motor();
+    }
+    else {
+        tape_start_motor();
+    }
+    */
+    /* only update memory configuration if the relevant bits have changed */
+    bool need_mem_update = 0 != ((sys->cpu_port ^ data) & 7);
+    sys->cpu_port = data;
+    if (need_mem_update) {
+        c64_update_memory_map(sys);
+    }
+}
+
+void c64_cia1_out(int port_id, uint8_t data) {
+    c64_t* sys = _c64_sys;
+    /*
+        Write CIA-1 ports:
+
+        port A:
+            write keyboard matrix lines
+        port B:
+            ---
+    */
+    if (port_id == M6526_PORT_A) {
+        kbd_set_active_lines(&sys->kbd, ~data);
+    }
+}
+
+uint8_t c64_cia1_in(int port_id) {
+    c64_t* sys = _c64_sys;
+    /*
+        Read CIA-1 ports:
+
+        Port A:
+            joystick 2 input
+        Port B:
+            combined keyboard matrix columns and joystick 1
+    */
+    if (port_id == M6526_PORT_A) {
+        /* joystick 2 not implemented */
+        return ~0;
+    }
+    else {
+        /* read keyboard matrix columns (joystick 1 not implemented) */
+        return ~kbd_scan_columns(&sys->kbd);
+    }
+}
+
+void c64_cia2_out(int port_id, uint8_t data) {
+    c64_t* sys = _c64_sys;
+    /*
+        Write CIA-2 ports:
+
+        Port A:
+            bits 0..1: VIC-II bank select:
+                00: bank 3 C000..FFFF
+                01: bank 2 8000..BFFF
+                10: bank 1 4000..7FFF
+                11: bank 0 0000..3FFF
+            bit 2: RS-232 TXD Outout (not implemented)
+            bit 3..5: serial bus output (not implemented)
+            bit 6..7: input (see cia2_in)
+        Port B:
+            RS232 / user functionality (not implemented)
+    */
+    if (port_id == M6526_PORT_A) {
+        sys->vic_bank_select = ((~data)&3)<<14;
+    }
+}
+
+uint8_t c64_cia2_in(int port_id) {
+    /*
+        Read CIA-2 ports:
+
+        Port A:
+            bits 0..5: output (see cia2_out)
+            bits 6..7: serial bus input, not implemented
+        Port B:
+            RS232 / user functionality (not implemented)
+    */
+    return ~0;
+}
+
+uint16_t c64_vic_fetch(uint16_t addr) {
+    c64_t* sys = _c64_sys;
+    /*
+        Fetch data into the VIC-II.
+
+        The VIC-II has a 14-bit address bus and 12-bit data bus, and
+        has a different memory mapping then the CPU (that's why it
+        goes through the mem_vic pagetable):
+            - a full 16-bit address is formed by taking the address bits
+              14 and 15 from the value written to CIA-1 port A
+            - the lower 8 bits of the VIC-II data bus are connected
+              to the shared system data bus, this is used to read
+              character mask and pixel data
+            - the upper 4 bits of the VIC-II data bus are hardwired to the
+              static color RAM
+    */
+    addr |= sys->vic_bank_select;
+    uint16_t data = (sys->color_ram[addr & 0x03FF]<<8) | mem_rd(&sys->mem_vic, addr);
+    return data;
+}
+
+void c64_update_memory_map(c64_t* sys) {
+    sys->io_mapped = false;
+    const uint8_t* read_ptr;
+    const uint8_t charen = (1<<2);
+    const uint8_t hiram = (1<<1);
+    const uint8_t loram = (1<<0);
+    /* shortcut if HIRAM and LORAM is 0, everything is RAM */
+    if ((sys->cpu_port & (hiram|loram)) == 0) {
+        mem_map_ram(&sys->mem_cpu, 0, 0xA000, 0x6000, sys->ram+0xA000);
+    }
+    else {
+        /* A000..BFFF is either RAM-behind-BASIC-ROM or RAM */
+        if ((sys->cpu_port & (hiram|loram)) == (hiram|loram)) {
+            read_ptr = sys->rom_basic;
+        }
+        else {
+            read_ptr = sys->ram + 0xA000;
+        }
+        mem_map_rw(&sys->mem_cpu, 0, 0xA000, 0x2000, read_ptr, sys->ram+0xA000);
+
+        /* E000..FFFF is either RAM-behind-KERNAL-ROM or RAM */
+        if (sys->cpu_port & hiram) {
+            read_ptr = sys->rom_kernal;
+        }
+        else {
+            read_ptr = sys->ram + 0xE000;
+        }
+        mem_map_rw(&sys->mem_cpu, 0, 0xE000, 0x2000, read_ptr, sys->ram+0xE000);
+
+        /* D000..DFFF can be Char-ROM or I/O */
+        if  (sys->cpu_port & charen) {
+            sys->io_mapped = true;
+        }
+        else {
+            mem_map_rw(&sys->mem_cpu, 0, 0xD000, 0x1000, sys->rom_char, sys->ram+0xD000);
+        }
+    }
+
+    /* rebuild the address decoding table */
+    iopage_init(&sys->io_pages, C64_IOPAGE_MEM);
+    iopage_map(&sys->io_pages, 0x0000, 0x0100, C64_IOPAGE_ZERO);
+    if (sys->io_mapped) {
+        iopage_map(&sys->io_pages, 0xD000, 0x0400, C64_IOPAGE_VIC);
+        iopage_map(&sys->io_pages, 0xD400, 0x0400, C64_IOPAGE_SID);
+        iopage_map(&sys->io_pages, 0xD800, 0x0400, C64_IOPAGE_COLOR_RAM);
+        iopage_map(&sys->io_pages, 0xDC00, 0x0100, C64_IOPAGE_CIA1);
+        iopage_map(&sys->io_pages, 0xDD00, 0x0100, C64_IOPAGE_CIA2);
+        iopage_map(&sys->io_pages, 0xDE00, 0x0200, C64_IOPAGE_EXP);
+    }
+}
+
+bool c64_quickload(c64_t* sys, const uint8_t* ptr, uint32_t num_bytes) {
+    CHIPS_ASSERT(sys && ptr);
+    /* a .prg file is the load address followed by the data */
+    if (num_bytes < 3) {
+        return false;
+    }
+    const uint16_t start = (uint16_t)(ptr[0] | (ptr[1] << 8));
+    const uint32_t len = num_bytes - 2;
+    if ((start + len) > 0x10000) {
+        return false;
+    }
+    memcpy(&sys->ram[start], ptr + 2, len);
+    /* the end address like after a KERNAL LOAD */
+    const uint16_t end = (uint16_t)(start + len);
+    sys->ram[0xAE] = (uint8_t)end;
+    sys->ram[0xAF] = (uint8_t)(end >> 8);
+    if (0x0801 == start) {
+        /* a BASIC program: the variables start behind it (VARTAB, ARYTAB,
+           STREND), and RUN is put into the keyboard buffer
+        */
+        for (int i = 0x2D; i <= 0x31; i += 2) {
+            sys->ram[i] = (uint8_t)end;
+            sys->ram[i + 1] = (uint8_t)(end >> 8);
+        }
+        static const uint8_t run[] = { 'R', 'U', 'N', 0x0D };
+        memcpy(&sys->ram[0x0277], run, sizeof(run));
+        sys->ram[0xC6] = sizeof(run);
+    }
+    return true;
+}
+
+#define C64_SNAPSHOT_ID SNAPSHOT_FOURCC('C','6','4',' ')
+
+uint32_t c64_snapshot_size(void) {
+    return snapshot_size(sizeof(c64_t));
+}
+
+/* restore the chip callbacks and memory maps of an instance whose struct
+   was copied from a snapshot or clone base, the framebuffer and ROM
+   pointers must already be the ones of the instance
+*/
+static void _c64_restore_pointers(c64_t* sys) {
+    sys->cpu.tick_cb = c64_cpu_tick;
+    sys->cpu.in_cb = c64_cpu_port_in;
+    sys->cpu.out_cb = c64_cpu_port_out;
+    sys->cia_1.in_cb = c64_cia1_in;
+    sys->cia_1.out_cb = c64_cia1_out;
+    sys->cia_2.in_cb = c64_cia2_in;
+    sys->cia_2.out_cb = c64_cia2_out;
+    sys->vic.fetch_cb = c64_vic_fetch;
+    sys->vic.rgba8_buffer = sys->rgba8_buffer;
+    _c64_init_memory_map(sys);
+}
+
+uint32_t c64_save_snapshot(const c64_t* sys, void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    return snapshot_save(buf, buf_size, C64_SNAPSHOT_ID, sys, sizeof(c64_t));
+}
+
+bool c64_load_snapshot(c64_t* sys, const void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    uint32_t* rgba8_buffer = sys->rgba8_buffer;
+    const uint32_t rgba8_buffer_size = sys->rgba8_buffer_size;
+    const uint8_t* rom_char = sys->rom_char;
+    const uint8_t* rom_basic = sys->rom_basic;
+    const uint8_t* rom_kernal = sys->rom_kernal;
+    c64_audio_callback_t audio_cb = sys->audio_cb;
+    pcprof_t* prof = sys->prof;
+    chiptime_t* chiptime = sys->chiptime;
+    bustrace_t* trace = sys->trace;
+    dbg_t* dbg = sys->dbg;
+    heatmap_t* heatmap = sys->heatmap;
+    const bool cia_lazy = sys->cia_lazy;
+    const bool audio_batching = sys->audio_batching;
+    if (!snapshot_load(buf, buf_size, C64_SNAPSHOT_ID, sys, sizeof(c64_t))) {
+        return false;
+    }
+    /* keep the instance's own framebuffer, ROMs, audio output and instrumentation */
+    sys->rgba8_buffer = rgba8_buffer;
+    sys->rgba8_buffer_size = rgba8_buffer_size;
+    sys->rom_char = rom_char;
+    sys->rom_basic = rom_basic;
+    sys->rom_kernal = rom_kernal;
+    sys->audio_cb = audio_cb;
+    sys->prof = prof;
+    sys->chiptime = chiptime;
+    sys->trace = trace;
+    sys->dbg = dbg;
+    sys->heatmap = heatmap;
+    sys->cia_lazy = cia_lazy;
+    sys->audio_batching = audio_batching;
+    _c64_restore_pointers(sys);
+    _c64_sid_catchup(sys);
+    /* deferred CIA ticks from the snapshot are applied right away, and the CIAs
+       look for a new deadline on the next tick (this also works when the
+       snapshot was saved with a different cia_lazy setting)
+    */
+    for (int i = 0; i < 2; i++) {
+        _c64_cia_catchup(sys, i);
+        sys->cia_safe[i] = 0;
+        sys->cia_direct[i] = 0;
+    }
+    return true;
+}
+
+bool c64_clone_base(clone_base_t* base, const void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(base);
+    return clone_base_init(base, buf, buf_size, C64_SNAPSHOT_ID, sizeof(c64_t));
+}
+
+c64_t* c64_clone(const clone_base_t* base, uint32_t* rgba8_buffer, uint32_t rgba8_buffer_size) {
+    CHIPS_ASSERT(base && rgba8_buffer);
+    c64_t* sys = (c64_t*) clone_map(base);
+    if (!sys) {
+        return 0;
+    }
+    /* the clone gets its own framebuffer, and doesn't share the audio output or the instrumentation of the base */
+    sys->rgba8_buffer = rgba8_buffer;
+    sys->rgba8_buffer_size = rgba8_buffer_size;
+    sys->prof = 0;
+    sys->chiptime = 0;
+    sys->trace = 0;
+    sys->dbg = 0;
+    sys->heatmap = 0;
+    sys->audio_cb = 0;
+    _c64_restore_pointers(sys);
+    return sys;
+}
+
+void c64_free_clone(const clone_base_t* base, c64_t* sys) {
+    CHIPS_ASSERT(base);
+    clone_unmap(base, sys);
+}
+
+#endif /* CHIPS_IMPL */
@@ -0,0 +1,1374 @@
+#pragma once
+/*
+    cpc6128.h
+
+    Amstrad CPC 6128 emulator core without any platform dependencies,
+    used by the cpc6128 example and the headless chips-bench.
+
+    No tape or disc emulation. The AY-3-8912 samples are passed in batches
+    to the optional audio callback in cpc_desc_t. Binary files with an
+    AMSDOS header are loaded directly into RAM and started (cpc_quickload()).
+
+    Do this:
+        #define CHIPS_IMPL
+    before you include this file in *one* C file to create the
+    implementation.
+*/
+#include "chips/z80.h"
+#include "chips/ay38910.h"
+#include "chips/i8255.h"
+#include "chips/mc6845.h"
+#include "chips/crt.h"
+#include "chips/kbd.h"
+#include "chips/mem.h"
+#include "common/thread.h"
+#include "common/snapshot.h"
+#include "common/clone.h"
+#include "common/iopage.h"
+#include "common/pcprof.h"
+#include "common/chiptime.h"
+#include "common/bustrace.h"
+#include "common/debugger.h"
+#include "common/heatmap.h"
+#include "roms/cpc-roms.h"
+
+#define CPC_FREQ (4000000)
+/* ticks per video frame with the firmware's CRTC setup (312 lines of 64 us, 50.08 Hz) */
+#define CPC_FRAME_TICKS (312 * 64 * 4)
+#define CPC_DISP_WIDTH (768)
+#define CPC_DISP_HEIGHT (272)
+/* 8-bit indexed video output: the 32 hardware colors, plus black for video sync */
+#define CPC_PAL8_NUM_COLORS (33)
+#define CPC_PAL8_BLACK (32)
+
+/* chips selected by the upper byte of an IO port address (see cpc_t.io_pages),
+   IO addresses are only partially decoded, so several chips can be selected at once
+*/
+#define CPC_IOPAGE_PPI      (1<<0)  /* i8255 PPI: ~A11 */
+#define CPC_IOPAGE_CRTC     (1<<1)  /* MC6845 CRTC: ~A14 */
+#define CPC_IOPAGE_GA       (1<<2)  /* gate array: ~A15 and A14 */
+#define CPC_IOPAGE_ROMSEL   (1<<3)  /* upper ROM bank select: ~A13 */
+#define CPC_IOPAGE_FDC      (1<<4)  /* floppy disk interface: ~A10 (A8 and A7 select the function) */
+
+#define CPC_MAX_AUDIO_SAMPLES (1024)        /* max number of audio samples in the internal sample buffer */
+#define CPC_DEFAULT_AUDIO_SAMPLES (128)     /* default number of samples per audio callback */
+
+/* chiptime slots (see common/chiptime.h, only used when compiled with CHIPS_CHIPTIME) */
+enum {
+    CPC_CHIPTIME_CPU = 0,       /* CPU emulation between tick callbacks */
+    CPC_CHIPTIME_MEM,           /* memory and IO requests, wait states */
+    CPC_CHIPTIME_PSG,           /* ay38910_tick */
+    CPC_CHIPTIME_CRTC,          /* mc6845_tick */
+    CPC_CHIPTIME_GA,            /* gate array interrupt and sync logic */
+    CPC_CHIPTIME_CRT,           /* crt_tick */
+    CPC_CHIPTIME_VIDEO,         /* cpc_ga_decode_video */
+    CPC_CHIPTIME_NUM,
+};
+#define CPC_CHIPTIME_NAMES "cpu", "mem", "psg", "crtc", "ga", "crt", "video"
+
+/* max number of gate array ticks in the scanline batch (the CRTC allows up to 256 per line) */
+#define CPC_LINE_BATCH_SIZE (256)
+
+/* audio output callback, invoked with a batch of mono samples */
+typedef void (*cpc_audio_callback_t)(const float* samples, int num_samples);
+
+/* CPC 6128 emulator state
+
+   The fields which are touched on every tick (CPU, CRTC, the gate array
+   counters, the memory page table, the scanline batch and the optional
+   instrumentation pointers) are packed together at the start, followed by
+   the state which is only touched on IO accesses, per scanline or frame,
+   or never after setup, and the bulk RAM and lookup tables. Each group
+   starts on its own cache line.
+*/
+typedef struct {
+    /* -- touched on every tick -- */
+    CHIPS_CACHE_ALIGNED z80_t cpu;
+    uint32_t tick_count;
+    uint32_t audio_pending_ticks;   // number of deferred PSG ticks
+    int line_batch_len;             // number of pending gate array ticks
+    int ga_hsync_irq_counter;       // incremented each scanline, reset at 52
+    int ga_hsync_after_vsync_counter;   // for 2-hsync-delay after vsync
+    int ga_hsync_delay_counter;     // hsync to monitor is delayed 2 ticks
+    int ga_hsync_counter;           // countdown until hsync to monitor is deactivated
+    bool ga_sync;                   // gate-array generated video sync (modified HSYNC)
+    bool ga_int;                    // GA interrupt pin active
+    bool audio_batching;            // defer ay38910_tick() until a PSG access or the end of cpc_exec()
+    bool line_batching;             // defer crt_tick() and video decoding
+    bool skip_video;                // don't decode pixels, the CRT beam still runs (warp mode)
+    uint64_t ga_crtc_pins;          // store CRTC pins to detect rising/falling bits
+    pcprof_t* prof;                 // optional PC-sampling profiler
+    chiptime_t* chiptime;           // optional per-chip host time accounting
+    bustrace_t* trace;              // optional bus cycle trace recorder
+    dbg_t* dbg;                     // optional breakpoints and watchpoints
+    heatmap_t* heatmap;             // optional per-page access counters
+    mc6845_t vdg;
+    mem_t mem;
+    /* CRT beam and video decoding of the current scanline, deferred until
+       the end of the scanline, or until the palette or video mode changes
+    */
+    struct {
+        uint8_t flags;              // _CPC_LINE_*
+        uint8_t data[2];            // the 2 video RAM bytes addressed by the CRTC
+    } line_batch[CPC_LINE_BATCH_SIZE];
+
+    /* -- touched on IO accesses, per scanline or frame, or only at setup -- */
+    CHIPS_CACHE_ALIGNED iopage_t io_pages;  // CPC_IOPAGE_* mask for each IO port address upper byte
+    ay38910_t psg;
+    i8255_t ppi;
+    crt_t crt;
+    kbd_t kbd;
+    uint8_t upper_rom_select;
+    uint8_t ga_config;              // out to port 0x7Fxx func 0x80
+    uint8_t ga_next_video_mode;
+    uint8_t ga_video_mode;
+    uint8_t ga_ram_config;          // out to port 0x7Fxx func 0xC0
+    uint8_t ga_pen;                 // currently selected pen (or border)
+    bool ga_decode_dirty;           // palette or video mode changed, rebuild decode table
+    uint32_t ga_palette[16];        // the current pen colors
+    uint32_t ga_border_color;       // the current border color
+    uint8_t ga_pen_index[16];       // hardware color numbers of the pens (for pal8 output)
+    uint8_t ga_border_index;        // hardware color number of the border (for pal8 output)
+    int num_samples;                // number of samples per audio callback
+    int sample_pos;                 // current position in sample_buffer
+    cpc_audio_callback_t audio_cb;     // audio output callback
+    uint32_t* rgba8_buffer;         // decoded video output
+    uint32_t rgba8_buffer_size;
+    uint8_t* pal8_buffer;           // decoded video output as color indices
+    uint32_t pal8_buffer_size;
+    const uint8_t* rom_os;          // 16 KB OS ROM (lower ROM)
+    const uint8_t* rom_basic;       // 16 KB BASIC ROM (upper ROM 0)
+    const uint8_t* rom_amsdos;      // 16 KB AMSDOS ROM (upper ROM 7)
+
+    /* -- bulk memory -- */
+    CHIPS_CACHE_ALIGNED uint8_t ram[8][0x4000];
+    /* byte => 8 RGBA pixels (or 8 color indices) for the current video mode and palette */
+    uint32_t ga_decode_table[256][8];
+    uint8_t ga_decode_table_pal8[256][8];
+    float sample_buffer[CPC_MAX_AUDIO_SAMPLES];
+} cpc_t;
+
+/* CPC 6128 emulator setup parameters, provide either an RGBA8 or an 8-bit indexed framebuffer */
+typedef struct {
+    uint32_t* rgba8_buffer;         /* the framebuffer for the decoded video output */
+    uint32_t rgba8_buffer_size;     /* size of the framebuffer in bytes */
+    uint8_t* pal8_buffer;           /* optional 8-bit indexed framebuffer instead of rgba8_buffer */
+    uint32_t pal8_buffer_size;      /* size of the indexed framebuffer in bytes */
+    /* optional audio output, audio_cb is called with batches of audio_num_samples samples */
+    cpc_audio_callback_t audio_cb;
+    int audio_num_samples;          /* default is CPC_DEFAULT_AUDIO_SAMPLES */
+    int audio_sample_rate;          /* playback sample rate, default is 44100 */
+    /* optional ROM images (e.g. memory-mapped files), default are the embedded dumps */
+    const uint8_t* rom_os;          /* 16 KB OS ROM */
+    const uint8_t* rom_basic;       /* 16 KB BASIC ROM */
+    const uint8_t* rom_amsdos;      /* 16 KB AMSDOS ROM */
+    pcprof_t* prof;                 /* optional PC-sampling profiler (see common/pcprof.h) */
+    chiptime_t* chiptime;           /* optional per-chip host time accounting (see common/chiptime.h) */
+    bustrace_t* trace;              /* optional bus cycle trace recorder (see common/bustrace.h) */
+    dbg_t* dbg;                     /* optional breakpoints and watchpoints (see common/debugger.h) */
+    heatmap_t* heatmap;             /* optional per-page access counters (see common/heatmap.h) */
+    bool disable_line_batching;     /* run the CRT and video decoding on every gate array tick */
+    bool disable_audio_batching;    /* tick the PSG on every gate array tick */
+} cpc_desc_t;
+
+/* initialize a CPC 6128 emulator instance */
+extern void cpc_init(cpc_t* sys, const cpc_desc_t* desc);
+/* run an emulator instance for at least the given number of ticks, returns executed ticks */
+extern uint32_t cpc_exec(cpc_t* sys, uint32_t ticks);
+/* get the RGBA8 colors for the 8-bit indexed video output */
+extern void cpc_pal8_colors(uint32_t colors[CPC_PAL8_NUM_COLORS]);
+/* load a binary file with AMSDOS header into RAM and jump to its entry
+   point, call after the system has booted into BASIC, returns false if
+   the data isn't a binary file with valid AMSDOS header
+*/
+extern bool cpc_quickload(cpc_t* sys, const uint8_t* ptr, uint32_t num_bytes);
+/* size of a CPC 6128 snapshot in bytes */
+extern uint32_t cpc_snapshot_size(void);
+/* save a snapshot of an instance into buf, returns number of bytes written (0 if buf is too small) */
+extern uint32_t cpc_save_snapshot(const cpc_t* sys, void* buf, uint32_t buf_size);
+/* restore a snapshot into an initialized instance, returns false if the snapshot doesn't match */
+extern bool cpc_load_snapshot(cpc_t* sys, const void* buf, uint32_t buf_size);
+/* create a copy-on-write clone base from a snapshot of an instance (see common/clone.h), returns false if the snapshot doesn't match */
+extern bool cpc_clone_base(clone_base_t* base, const void* buf, uint32_t buf_size);
+/* map a new instance from a clone base which shares all unwritten pages with the base, returns 0 on failure */
+extern cpc_t* cpc_clone(const clone_base_t* base, uint32_t* rgba8_buffer, uint32_t rgba8_buffer_size);
+/* release a cloned instance */
+extern void cpc_free_clone(const clone_base_t* base, cpc_t* sys);
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#ifdef CHIPS_IMPL
+#include <string.h>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define _CPC_SSE2 (1)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define _CPC_NEON (1)
+#endif
+#ifndef CHIPS_ASSERT
+    #include <assert.h>
+    #define CHIPS_ASSERT(c) assert(c)
+#endif
+
+/* the emulator instance running on the current thread */
+static CHIPS_THREAD_LOCAL cpc_t* _cpc_sys;
+
+/* cpc_t.line_batch[].flags */
+#define _CPC_LINE_DE        (1<<0)  /* CRTC display enable */
+#define _CPC_LINE_BLANK     (1<<1)  /* CRTC HSYNC or VSYNC active */
+#define _CPC_LINE_HSYNC     (1<<2)  /* gate array HSYNC to the monitor */
+#define _CPC_LINE_VSYNC     (1<<3)  /* VSYNC to the monitor */
+#define _CPC_LINE_DECODE    (1<<4)  /* decode pixels (not in warp mode) */
+
+/*
+    the fixed hardware color palette
+
+    http://www.cpcwiki.eu/index.php/CPC_Palette
+    http://www.grimware.org/doku.php/documentations/devices/gatearray
+
+    index into this palette is the 'hardware color number' & 0x1F
+    order is ABGR
+*/
+const uint32_t cpc_colors[32] = {
+    0xff6B7D6E,         // #40 white
+    0xff6D7D6E,         // #41 white
+    0xff6BF300,         // #42 sea green
+    0xff6DF3F3,         // #43 pastel yellow
+    0xff6B0200,         // #44 blue
+    0xff6802F0,         // #45 purple
+    0xff687800,         // #46 cyan
+    0xff6B7DF3,         // #47 pink
+    0xff6802F3,         // #48 purple
+    0xff6BF3F3,         // #49 pastel yellow
+    0xff0DF3F3,         // #4A bright yellow
+    0xffF9F3FF,         // #4B bright white
+    0xff0605F3,         // #4C bright red
+    0xffF402F3,         // #4D bright magenta
+    0xff0D7DF3,         // #4E orange
+    0xffF980FA,         // #4F pastel magenta
+    0xff680200,         // #50 blue
+    0xff6BF302,         // #51 sea green
+    0xff01F002,         // #52 bright green
+    0xffF2F30F,         // #53 bright cyan
+    0xff010200,         // #54 black
+    0xffF4020C,         // #55 bright blue
+    0xff017802,         // #56 green
+    0xffF47B0C,         // #57 sky blue
+    0xff680269,         // #58 magenta
+    0xff6BF371,         // #59 pastel green
+    0xff04F571,         // #5A lime
+    0xffF4F371,         // #5B pastel cyan
+    0xff01026C,         // #5C red
+    0xffF2026C,         // #5D mauve
+    0xff017B6E,         // #5E yellow
+    0xffF67B6E,         // #5F pastel blue
+};
+
+void cpc_init_keymap(cpc_t* sys);
+void cpc_update_memory_mapping(cpc_t* sys);
+uint64_t cpc_cpu_tick(int num_ticks, uint64_t pins);
+uint64_t cpc_cpu_iorq(cpc_t* sys, uint64_t pins);
+uint64_t cpc_ppi_out(int port_id, uint64_t pins, uint8_t data);
+uint8_t cpc_ppi_in(int port_id);
+void cpc_psg_out(int port_id, uint8_t data);
+uint8_t cpc_psg_in(int port_id);
+uint64_t cpc_ga_tick(cpc_t* sys, uint64_t pins);
+void cpc_ga_int_ack(cpc_t* sys);
+void cpc_ga_decode_video(cpc_t* sys, uint64_t crtc_pins);
+void cpc_ga_flush_line(cpc_t* sys);
+void cpc_ga_decode_pixels(cpc_t* sys, uint32_t* dst, uint64_t crtc_pins);
+void cpc_ga_decode_pixels_pal8(cpc_t* sys, uint8_t* dst, uint64_t crtc_pins);
+
+/* store a new audio sample, and hand the batch to the audio callback when full */
+static inline void _cpc_audio_sample(cpc_t* sys, float sample) {
+    sys->sample_buffer[sys->sample_pos++] = sample;
+    if (sys->sample_pos == sys->num_samples) {
+        if (sys->audio_cb) {
+            sys->audio_cb(sys->sample_buffer, sys->num_samples);
+        }
+        sys->sample_pos = 0;
+    }
+}
+
+/* run the deferred PSG ticks */
+static inline void _cpc_psg_catchup(cpc_t* sys) {
+    for (; sys->audio_pending_ticks > 0; sys->audio_pending_ticks--) {
+        if (ay38910_tick(&sys->psg)) {
+            _cpc_audio_sample(sys, sys->psg.sample);
+        }
+    }
+}
+
+/* build the IO address decoding table, bits 0..7 of the page index are A8..A15 */
+static void _cpc_init_io_pages(cpc_t* sys) {
+    for (int i = 0; i < 256; i++) {
+        uint8_t mask = 0;
+        if ((i & (1<<3)) == 0) {
+            mask |= CPC_IOPAGE_PPI;
+        }
+        if ((i & (1<<6)) == 0) {
+            mask |= CPC_IOPAGE_CRTC;
+        }
+        if ((i & ((1<<7)|(1<<6))) == (1<<6)) {
+            mask |= CPC_IOPAGE_GA;
+        }
+        if ((i & (1<<5)) == 0) {
+            mask |= CPC_IOPAGE_ROMSEL;
+        }
+        if ((i & (1<<2)) == 0) {
+            mask |= CPC_IOPAGE_FDC;
+        }
+        sys->io_pages.page[i] = mask;
+    }
+}
+
+/* CPC 6128 emulator init */
+void cpc_init(cpc_t* sys, const cpc_desc_t* desc) {
+    CHIPS_ASSERT(sys && desc && (desc->rgba8_buffer || desc->pal8_buffer));
+    CHIPS_ASSERT(!desc->rgba8_buffer || (desc->rgba8_buffer_size >= (CPC_DISP_WIDTH*CPC_DISP_HEIGHT*sizeof(uint32_t))));
+    CHIPS_ASSERT(!desc->pal8_buffer || (desc->pal8_buffer_size >= (CPC_DISP_WIDTH*CPC_DISP_HEIGHT)));
+    memset(sys, 0, sizeof(cpc_t));
+    _cpc_sys = sys;
+    sys->rgba8_buffer = desc->rgba8_buffer;
+    sys->rgba8_buffer_size = desc->rgba8_buffer_size;
+    sys->pal8_buffer = desc->pal8_buffer;
+    sys->pal8_buffer_size = desc->pal8_buffer_size;
+    CHIPS_ASSERT(desc->audio_num_samples <= CPC_MAX_AUDIO_SAMPLES);
+    sys->audio_cb = desc->audio_cb;
+    sys->num_samples = (desc->audio_num_samples > 0) ? desc->audio_num_samples : CPC_DEFAULT_AUDIO_SAMPLES;
+    const int audio_hz = (desc->audio_sample_rate > 0) ? desc->audio_sample_rate : 44100;
+    sys->rom_os = desc->rom_os ? desc->rom_os : dump_cpc6128_os;
+    sys->rom_basic = desc->rom_basic ? desc->rom_basic : dump_cpc6128_basic;
+    sys->rom_amsdos = desc->rom_amsdos ? desc->rom_amsdos : dump_cpc6128_amsdos;
+    sys->prof = desc->prof;
+    sys->chiptime = desc->chiptime;
+    sys->trace = desc->trace;
+    sys->dbg = desc->dbg;
+    sys->heatmap = desc->heatmap;
+    sys->line_batching = !desc->disable_line_batching;
+    sys->audio_batching = !desc->disable_audio_batching;
+    memset(sys->ga_pen_index, CPC_PAL8_BLACK, sizeof(sys->ga_pen_index));
+    sys->ga_border_index = CPC_PAL8_BLACK;
+    sys->upper_rom_select = 0;
+    sys->tick_count = 0;
+    sys->ga_next_video_mode = 1;
+    sys->ga_video_mode = 1;
+    sys->ga_decode_dirty = true;
+    sys->ga_hsync_delay_counter = 2;
+    cpc_init_keymap(sys);
+    cpc_update_memory_mapping(sys);
+    _cpc_init_io_pages(sys);
+
+    z80_init(&sys->cpu, cpc_cpu_tick);
+    i8255_init(&sys->ppi, cpc_ppi_in, cpc_ppi_out);
+    mc6845_init(&sys->vdg, MC6845_TYPE_UM6845R);
+    crt_init(&sys->crt, CRT_PAL, 6, 32, CPC_DISP_WIDTH/16, CPC_DISP_HEIGHT);
+    ay38910_init(&sys->psg, &(ay38910_desc_t){
+        .type = AY38910_TYPE_8912,
+        .in_cb = cpc_psg_in,
+        .out_cb = cpc_psg_out,
+        .tick_hz = 1000000,
+        .sound_hz = audio_hz,
+        .magnitude = 0.5
+    });
+
+    /* CPU start address */
+    sys->cpu.state.PC = 0x0000;
+}
+
+/* run the CPC emulation for at least the given number of ticks */
+uint32_t cpc_exec(cpc_t* sys, uint32_t ticks) {
+    _cpc_sys = sys;
+    CHIPTIME_START(sys->chiptime);
+    const uint32_t ticks_executed = z80_exec(&sys->cpu, ticks);
+    CHIPTIME_MARK(sys->chiptime, CPC_CHIPTIME_CPU);
+    /* the framebuffer must be complete when returning, and the audio samples synthesized */
+    cpc_ga_flush_line(sys);
+    _cpc_psg_catchup(sys);
+    CHIPTIME_MARK(sys->chiptime, CPC_CHIPTIME_PSG);
+    return ticks_executed;
+}
+
+void cpc_init_keymap(cpc_t* sys) {
+    /*
+        http://cpctech.cpc-live.com/docs/keyboard.html
+    
+        CPC has a 10 columns by 8 lines keyboard matrix. The 10 columns
+        are lit up by bits 0..3 of PPI port C connected to a 74LS145
+        BCD decoder, and the lines are read through port A of the
+        AY-3-8910 chip.
+    */
+    kbd_init(&sys->kbd, 1);
+    const char* keymap =
+        /* no shift */
+        "   ^08641 "
+        "  [-97532 "
+        "   @oure  "
+        "  ]piytwq "
+        "   ;lhgs  "
+        "   :kjfda "
+        "  \\/mnbc  "
+        "   ., vxz "
+
+        /* shift */
+        "    _(&$! "
+        "  {=)'%#\" "
+        "   |OURE  "
+        "  }PIYTWQ "
+        "   +LHGS  "
+        "   *KJFDA "
+        "  `?MNBC  "
+        "   >< VXZ ";
+    /* shift key is on column 2, line 5 */
+    kbd_register_modifier(&sys->kbd, 0, 2, 5);
+    /* ctrl key is on column 2, line 7 */
+    kbd_register_modifier(&sys->kbd, 1, 2, 7);
+
+    for (int shift = 0; shift < 2; shift++) {
+        for (int col = 0; col < 10; col++) {
+            for (int line = 0; line < 8; line++) {
+                int c = keymap[shift*80 + line*10 + col];
+                if (c != 0x20) {
+                    kbd_register_key(&sys->kbd, c, col, line, shift?(1<<0):0);
+                }
+            }
+        }
+    }
+
+    /* special keys */
+    kbd_register_key(&sys->kbd, 0x20, 5, 7, 0);    // space
+    kbd_register_key(&sys->kbd, 0x08, 1, 0, 0);    // cursor left
+    kbd_register_key(&sys->kbd, 0x09, 0, 1, 0);    // cursor right
+    kbd_register_key(&sys->kbd, 0x0A, 0, 2, 0);    // cursor down
+    kbd_register_key(&sys->kbd, 0x0B, 0, 0, 0);    // cursor up
+    kbd_register_key(&sys->kbd, 0x01, 9, 7, 0);    // delete
+    kbd_register_key(&sys->kbd, 0x0C, 2, 0, 0);    // clr
+    kbd_register_key(&sys->kbd, 0x0D, 2, 2, 0);    // return
+    kbd_register_key(&sys->kbd, 0x03, 8, 2, 0);    // escape
+}
+
+static const int cpc_ram_config_table[8][4] = {
+    { 0, 1, 2, 3 },
+    { 0, 1, 2, 7 },
+    { 4, 5, 6, 7 },
+    { 0, 3, 2, 7 },
+    { 0, 4, 2, 3 },
+    { 0, 5, 2, 3 },
+    { 0, 6, 2, 3 },
+    { 0, 7, 2, 3 },
+};
+
+void cpc_update_memory_mapping(cpc_t* sys) {
+    /* index into RAM config array */
+    int ram_table_index = sys->ga_ram_config & 0x07;
+    const uint8_t* rom0_ptr = sys->rom_os;
+    const uint8_t* rom1_ptr;
+    if (sys->upper_rom_select == 7) {
+        rom1_ptr = sys->rom_amsdos;
+    }
+    else {
+        rom1_ptr = sys->rom_basic;
+    }
+    const int i0 = cpc_ram_config_table[ram_table_index][0];
+    const int i1 = cpc_ram_config_table[ram_table_index][1];
+    const int i2 = cpc_ram_config_table[ram_table_index][2];
+    const int i3 = cpc_ram_config_table[ram_table_index][3];
+    /* 0x0000..0x3FFF */
+    if (sys->ga_config & (1<<2)) {
+        /* read/write from and to RAM bank */
+        mem_map_ram(&sys->mem, 0, 0x0000, 0x4000, sys->ram[i0]);
+    }
+    else {
+        /* read from ROM, write to RAM */
+        mem_map_rw(&sys->mem, 0, 0x0000, 0x4000, rom0_ptr, sys->ram[i0]);
+    }
+    /* 0x4000..0x7FFF */
+    mem_map_ram(&sys->mem, 0, 0x4000, 0x4000, sys->ram[i1]);
+    /* 0x8000..0xBFFF */
+    mem_map_ram(&sys->mem, 0, 0x8000, 0x4000, sys->ram[i2]);
+    /* 0xC000..0xFFFF */
+    if (sys->ga_config & (1<<3)) {
+        /* read/write from and to RAM bank */
+        mem_map_ram(&sys->mem, 0, 0xC000, 0x4000, sys->ram[i3]);
+    }
+    else {
+        /* read from ROM, write to RAM */
+        mem_map_rw(&sys->mem, 0, 0xC000, 0x4000, rom1_ptr, sys->ram[i3]);
+    }
+}
+
+/* number of wait states injected when the CPU samples the wait line at clock phase (tick_count & 3) */
+static const uint32_t _cpc_wait_states[4] = { 0, 3, 2, 1 };
+
+uint64_t cpc_cpu_tick(int num_ticks, uint64_t pins) {
+    cpc_t* sys = _cpc_sys;
+    CHIPTIME_MARK(sys->chiptime, CPC_CHIPTIME_CPU);
+    if (sys->prof) {
+        pcprof_tick(sys->prof, num_ticks, (pins & (Z80_M1|Z80_MREQ)) == (Z80_M1|Z80_MREQ), Z80_GET_ADDR(pins));
+    }
+    /* interrupt acknowledge? */
+    if ((pins & (Z80_M1|Z80_IORQ)) == (Z80_M1|Z80_IORQ)) {
+        cpc_ga_int_ack(sys);
+    }
+
+    /* memory and IO requests */
+    if (pins & Z80_MREQ) {
+        /* CPU MEMORY REQUEST */
+        const uint16_t addr = Z80_GET_ADDR(pins);
+        /* breakpoints are checked on opcode fetches (M1), only pages with
+           a breakpoint or watchpoint take the slow path
+        */
+        if (sys->dbg && dbg_watched(sys->dbg, addr)) {
+            dbg_access(sys->dbg, addr, Z80_GET_DATA(pins), 0 != (pins & Z80_M1), 0 != (pins & Z80_WR), sys->cpu.state.PC);
+        }
+        if (sys->heatmap) {
+            heatmap_count(sys->heatmap, HEATMAP_KIND(pins & Z80_WR, pins & Z80_M1), addr);
+        }
+        if (pins & Z80_RD) {
+            Z80_SET_DATA(pins, mem_rd(&sys->mem, addr));
+        }
+        else if (pins & Z80_WR) {
+            mem_wr(&sys->mem, addr, Z80_GET_DATA(pins));
+        }
+    }
+    else if ((pins & Z80_IORQ) && (pins & (Z80_RD|Z80_WR))) {
+        /* CPU IO REQUEST (the CPC decodes IO ports by the upper address byte) */
+        if (sys->heatmap) {
+            heatmap_count(sys->heatmap, HEATMAP_IO, Z80_GET_ADDR(pins));
+        }
+        pins = cpc_cpu_iorq(sys, pins);
+    }
+    
+    /*
+        tick the gate array and audio chip at 1 MHz, and decide how many wait
+        states must be injected, the CPC signals the wait line in 3 out of 4
+        cycles:
+    
+         0: wait inactive
+         1: wait active
+         2: wait active
+         3: wait active
+    
+        the CPU samples the wait line only on specific clock ticks
+        during memory or IO operations, wait states are only injected
+        if the 'wait active' happens on the same clock tick as the
+        CPU would sample the wait line, the CPU then stalls until
+        the next 'wait inactive' tick, so the number of wait states
+        only depends on the clock phase at the sampling tick
+    */
+    int wait_scan_tick = -1;
+    if (pins & Z80_MREQ) {
+        /* a memory request or opcode fetch, wait is sampled on second clock tick */
+        wait_scan_tick = 1;
+    }
+    else if (pins & Z80_IORQ) {
+        if (pins & Z80_M1) {
+            /* an interrupt acknowledge cycle, wait is sampled on fourth clock tick */
+            wait_scan_tick = 3;
+        }
+        else {
+            /* an IO cycle, wait is sampled on third clock tick */
+            wait_scan_tick = 2;
+        }
+    }
+    uint32_t wait_cycles = 0;
+    if ((wait_scan_tick >= 0) && (wait_scan_tick < num_ticks)) {
+        wait_cycles = _cpc_wait_states[(sys->tick_count + wait_scan_tick) & 3];
+    }
+    /* on every 4th clock cycle, tick the system */
+    const uint32_t total_ticks = num_ticks + wait_cycles;
+    const uint32_t first_ga_tick = (4 - (sys->tick_count & 3)) & 3;
+    sys->tick_count += total_ticks;
+    CHIPTIME_MARK(sys->chiptime, CPC_CHIPTIME_MEM);
+    if (total_ticks > first_ga_tick) {
+        const uint32_t num_ga_ticks = (total_ticks - first_ga_tick + 3) >> 2;
+        if (sys->audio_batching) {
+            /* the PSG ticks are deferred until the PSG is accessed */
+            sys->audio_pending_ticks += num_ga_ticks;
+        }
+        for (uint32_t i = num_ga_ticks; i > 0; i--) {
+            if (!sys->audio_batching) {
+                if (ay38910_tick(&sys->psg)) {
+                    _cpc_audio_sample(sys, sys->psg.sample);
+                }
+                CHIPTIME_MARK(sys->chiptime, CPC_CHIPTIME_PSG);
+            }
+            pins = cpc_ga_tick(sys, pins);
+        }
+    }
+    Z80_SET_WAIT(pins, wait_cycles);
+    if (sys->trace) {
+        bustrace_record(sys->trace, pins, total_ticks);
+    }
+    return pins;
+}
+
+uint64_t cpc_cpu_iorq(cpc_t* sys, uint64_t pins) {
+    /*
+        CPU IO REQUEST
+
+        For address decoding, see the main board schematics!
+        also: http://cpcwiki.eu/index.php/Default_I/O_Port_Summary
+
+        Z80 to i8255 PPI pin connections:
+            ~A11 -> CS (CS is active-low)
+                A8 -> A0
+                A9 -> A1
+                RD -> RD
+                WR -> WR
+            D0..D7 -> D0..D7
+
+        The chip selects only depend on the upper address byte, and are
+        looked up in the io_pages table.
+    */
+    const uint8_t chips = iopage_get(&sys->io_pages, Z80_GET_ADDR(pins));
+    if (chips & CPC_IOPAGE_PPI) {
+        /* i8255 in/out */
+        uint64_t ppi_pins = (pins & Z80_PIN_MASK)|I8255_CS;
+        if (pins & Z80_A9) { ppi_pins |= I8255_A1; }
+        if (pins & Z80_A8) { ppi_pins |= I8255_A0; }
+        if (pins & Z80_RD) { ppi_pins |= I8255_RD; }
+        if (pins & Z80_WR) { ppi_pins |= I8255_WR; }
+        pins = i8255_iorq(&sys->ppi, ppi_pins) & Z80_PIN_MASK;
+    }
+    /*
+        Z80 to MC6845 pin connections:
+
+            ~A14 -> CS (CS is active low)
+            A9  -> RW (high: read, low: write)
+            A8  -> RS
+        D0..D7  -> D0..D7
+    */
+    if (chips & CPC_IOPAGE_CRTC) {
+        /* 6845 in/out */
+        uint64_t vdg_pins = (pins & Z80_PIN_MASK)|MC6845_CS;
+        if (pins & Z80_A9) { vdg_pins |= MC6845_RW; }
+        if (pins & Z80_A8) { vdg_pins |= MC6845_RS; }
+        pins = mc6845_iorq(&sys->vdg, vdg_pins) & Z80_PIN_MASK;
+    }
+    /*
+        Gate Array Function (only writing to the gate array
+        is possible, but the gate array doesn't check the
+        CPU R/W pins, so each access is a write).
+
+        This is used by the Arnold Acid test "OnlyInc", which
+        access the PPI and gate array in the same IO operation
+        to move data directly from the PPI into the gate array.
+    */
+    if (chips & CPC_IOPAGE_GA) {
+        /* D6 and D7 select the gate array operation */
+        const uint8_t data = Z80_GET_DATA(pins);
+        switch (data & ((1<<7)|(1<<6))) {
+            case 0:
+                /* select pen:
+                    bit 4 set means 'select border', otherwise
+                    bits 0..3 contain the pen number
+                */
+                sys->ga_pen = data & 0x1F;
+                break;
+            case (1<<6):
+                /* select color for border or selected pen, the pending
+                   part of the scanline must be decoded with the old color
+                */
+                cpc_ga_flush_line(sys);
+                if (sys->ga_pen & (1<<4)) {
+                    /* border color */
+                    sys->ga_border_color = cpc_colors[data & 0x1F];
+                    sys->ga_border_index = data & 0x1F;
+                }
+                else {
+                    sys->ga_palette[sys->ga_pen & 0x0F] = cpc_colors[data & 0x1F];
+                    sys->ga_pen_index[sys->ga_pen & 0x0F] = data & 0x1F;
+                    sys->ga_decode_dirty = true;
+                }
+                break;
+            case (1<<7):
+                /* select screen mode, ROM config and interrupt control
+                    - bits 0 and 1 select the screen mode
+                        00: Mode 0 (160x200 @ 16 colors)
+                        01: Mode 1 (320x200 @ 4 colors)
+                        02: Mode 2 (640x200 @ 2 colors)
+                        11: Mode 3 (160x200 @ 2 colors, undocumented)
+                  
+                    - bit 2: disable/enable lower ROM
+                    - bit 3: disable/enable upper ROM
+                  
+                    - bit 4: interrupt generation control
+                */
+                sys->ga_config = data;
+                sys->ga_next_video_mode = data & 3;
+                if (data & (1<<4)) {
+                    sys->ga_hsync_irq_counter = 0;
+                    sys->ga_int = false;
+                }
+                cpc_update_memory_mapping(sys);
+                break;
+            case (1<<7)|(1<<6):
+                /* RAM memory management (only CPC6128) */
+                sys->ga_ram_config = data;
+                cpc_update_memory_mapping(sys);
+                break;
+        }
+    }
+    /*
+        Upper ROM Bank number
+
+        This is used to select a ROM in the
+        0xC000..0xFFFF region, without expansions,
+        this is just the BASIC and AMSDOS ROM.
+    */
+    if (chips & CPC_IOPAGE_ROMSEL) {
+        sys->upper_rom_select = Z80_GET_DATA(pins);
+        cpc_update_memory_mapping(sys);
+    }
+    /*
+        Floppy Disk Interface
+    */
+    if ((chips & CPC_IOPAGE_FDC) && ((pins & (Z80_A8|Z80_A7)) == 0)) {
+        /* FIXME: floppy disk motor control */
+    }
+    else if ((chips & CPC_IOPAGE_FDC) && ((pins & (Z80_A8|Z80_A7)) == Z80_A8)) {
+        /* floppy controller status/data register */
+        if (pins & Z80_RD) {
+            Z80_SET_DATA(pins, 0xFF);
+        }
+    }
+    return pins;
+}
+
+uint64_t cpc_ppi_out(int port_id, uint64_t pins, uint8_t data) {
+    cpc_t* sys = _cpc_sys;
+    /*
+        i8255 PPI to AY-3-8912 PSG pin connections:
+            PA0..PA7    -> D0..D7
+                 PC7    -> BDIR
+                 PC6    -> BC1
+    */
+    if ((I8255_PORT_A == port_id) || (I8255_PORT_C == port_id)) {
+        const uint8_t ay_ctrl = sys->ppi.output[I8255_PORT_C] & ((1<<7)|(1<<6));
+        if (ay_ctrl) {
+            uint64_t ay_pins = 0;
+            if (ay_ctrl & (1<<7)) { ay_pins |= AY38910_BDIR; }
+            if (ay_ctrl & (1<<6)) { ay_pins |= AY38910_BC1; }
+            const uint8_t ay_data = sys->ppi.output[I8255_PORT_A];
+            AY38910_SET_DATA(ay_pins, ay_data);
+            _cpc_psg_catchup(sys);
+            ay38910_iorq(&sys->psg, ay_pins);
+        }
+    }
+    if (I8255_PORT_C == port_id) {
+        // bits 0..3: select keyboard matrix line
+        kbd_set_active_columns(&sys->kbd, 1<<(data & 0x0F));
+
+        /* FIXME: cassette write data */
+        /* FIXME: cassette deck motor control */
+        if (data & (1<<4)) {
+            // tape_start_motor();
+        }
+        else {
+            // tape_stop_motor();
+        }
+    }
+    return pins;
+}
+
+uint8_t cpc_ppi_in(int port_id) {
+    cpc_t* sys = _cpc_sys;
+    if (I8255_PORT_A == port_id) {
+        /* AY-3-8912 PSG function (indirectly this may also trigger
+            a read of the keyboard matrix via the AY's IO port
+        */
+        uint64_t ay_pins = 0;
+        uint8_t ay_ctrl = sys->ppi.output[I8255_PORT_C];
+        if (ay_ctrl & (1<<7)) ay_pins |= AY38910_BDIR;
+        if (ay_ctrl & (1<<6)) ay_pins |= AY38910_BC1;
+        uint8_t ay_data = sys->ppi.output[I8255_PORT_A];
+        AY38910_SET_DATA(ay_pins, ay_data);
+        _cpc_psg_catchup(sys);
+        ay_pins = ay38910_iorq(&sys->psg, ay_pins);
+        return AY38910_GET_DATA(ay_pins);
+    }
+    else if (I8255_PORT_B == port_id) {
+        /*
+            Bit 7: cassette data input
+            Bit 6: printer port ready (1=not ready, 0=ready)
+            Bit 5: expansion port /EXP pin
+            Bit 4: screen refresh rate (1=50Hz, 0=60Hz)
+            Bit 3..1: distributor id (shown in start screen)
+                0: Isp
+                1: Triumph
+                2: Saisho
+                3: Solavox
+                4: Awa
+                5: Schneider
+                6: Orion
+                7: Amstrad
+            Bit 0: vsync
+        */
+        uint8_t val = (1<<4) | (7<<1);    // 50Hz refresh rate, Amstrad
+        /* PPI Port B Bit 0 is directly wired to the 6845 VSYNC pin (see schematics) */
+        if (sys->vdg.vs) {
+            val |= (1<<0);
+        }
+        return val;
+    }
+    else {
+        /* shouldn't happen */
+        return 0xFF;
+    }
+}
+
+void cpc_psg_out(int port_id, uint8_t data) {
+    /* this shouldn't be called */
+}
+
+uint8_t cpc_psg_in(int port_id) {
+    cpc_t* sys = _cpc_sys;
+    /* read the keyboard matrix and joystick port */
+    if (port_id == AY38910_PORT_A) {
+        uint8_t data = (uint8_t) kbd_scan_lines(&sys->kbd);
+        if (sys->kbd.active_columns & (1<<9)) {
+            /* FIXME: joystick input not implemented
+
+                joystick input is implemented like this:
+                - the keyboard column 9 is routed to the joystick
+                  ports "COM1" pin, this means the joystick is only
+                  "powered" when the keyboard line 9 is active
+                - the joysticks direction and fire pins are
+                  connected to the keyboard matrix lines as
+                  input to PSG port A
+                - thus, only when the keyboard matrix column 9 is sampled,
+                  joystick input will be provided on the keyboard
+                  matrix lines
+            */
+            // data |= sys->joymask;
+        }
+        return ~data;
+    }
+    else {
+        /* this shouldn't happen since the AY-3-8912 only has one IO port */
+        return 0xFF;
+    }
+}
+
+void cpc_ga_int_ack(cpc_t* sys) {
+    /* on interrupt acknowledge from the CPU, clear the top bit from the
+        hsync counter, so the next interrupt can't occur closer then 
+        32 HSYNC, and clear the gate array interrupt pin state
+    */
+    sys->ga_hsync_irq_counter &= 0x1F;
+    sys->ga_int = false;
+}
+
+/*
+    compute the source address from current CRTC ma (memory address)
+    and ra (raster address) like this:
+
+    |ma12|ma11|ra2|ra1|ra0|ma9|ma8|...|ma2|ma1|ma0|0|
+
+    Bits ma12 and m11 point to the 16 KByte page, and all
+    other bits are the index into that page.
+*/
+static inline const uint8_t* _cpc_ga_video_src(cpc_t* sys, uint64_t crtc_pins) {
+    const uint16_t ma = MC6845_GET_ADDR(crtc_pins);
+    const uint8_t ra = MC6845_GET_RA(crtc_pins);
+    const uint32_t page_index  = (ma>>12) & 3;
+    const uint32_t page_offset = ((ma & 0x03FF)<<1) | ((ra & 7)<<11);
+    return &(sys->ram[page_index][page_offset]);
+}
+
+static bool falling_edge(uint64_t new_pins, uint64_t old_pins, uint64_t mask) {
+    return 0 != (mask & (~new_pins & (new_pins ^ old_pins)));
+}
+
+static bool rising_edge(uint64_t new_pins, uint64_t old_pins, uint64_t mask) {
+    return 0 != (mask & (new_pins & (new_pins ^ old_pins)));
+}
+
+uint64_t cpc_ga_tick(cpc_t* sys, uint64_t cpu_pins) {
+    /*
+        http://cpctech.cpc-live.com/docs/ints.html
+        http://www.cpcwiki.eu/forum/programming/frame-flyback-and-interrupts/msg25106/#msg25106
+        https://web.archive.org/web/20170612081209/http://www.grimware.org/doku.php/documentations/devices/gatearray
+    */
+    uint64_t crtc_pins = mc6845_tick(&sys->vdg);
+    CHIPTIME_MARK(sys->chiptime, CPC_CHIPTIME_CRTC);
+
+    /*
+        INTERRUPT GENERATION:
+
+        From: https://web.archive.org/web/20170612081209/http://www.grimware.org/doku.php/documentations/devices/gatearray
+
+        - On every falling edge of the HSYNC signal (from the 6845),
+          the gate array will increment the counter by one. When the
+          counter reaches 52, the gate array will raise the INT signal
+          and reset the counter.
+        - When the CPU acknowledges the interrupt, the gate array will
+          reset bit5 of the counter, so the next interrupt can't occur
+          closer than 32 HSync.
+        - When a VSync occurs, the gate array will wait for 2 HSync and:
+            - if the counter>=32 (bit5=1) then no interrupt request is issued
+              and counter is reset to 0
+            - if the counter<32 (bit5=0) then an interrupt request is issued
+              and counter is reset to 0
+        - This 2 HSync delay after a VSync is used to let the main program,
+          executed by the CPU, enough time to sense the VSync...
+
+        From: http://www.cpcwiki.eu/index.php?title=CRTC
+        
+        - The HSYNC is modified before being sent to the monitor. It happens
+          2us after the HSYNC from the CRTC and lasts 4us when HSYNC length
+          is greater or equal to 6.
+        - The VSYNC is also modified before being sent to the monitor, it happens
+          two lines after the VSYNC from the CRTC and stay 2 lines (same cut
+          rule if VSYNC is lower than 4).
+
+        NOTES:
+            - the interrupt acknowledge is handled once per machine 
+              cycle in cpu_tick()
+            - the video mode will take effect *after the next HSYNC*
+    */
+    if (rising_edge(crtc_pins, sys->ga_crtc_pins, MC6845_VS)) {
+        sys->ga_hsync_after_vsync_counter = 2;
+    }
+    if (falling_edge(crtc_pins, sys->ga_crtc_pins, MC6845_HS)) {
+        /* end of scanline, and the video mode may change */
+        cpc_ga_flush_line(sys);
+        if (sys->ga_video_mode != sys->ga_next_video_mode) {
+            sys->ga_video_mode = sys->ga_next_video_mode;
+            sys->ga_decode_dirty = true;
+        }
+        sys->ga_hsync_irq_counter = (sys->ga_hsync_irq_counter + 1) & 0x3F;
+
+        /* 2 HSync delay? */
+        if (sys->ga_hsync_after_vsync_counter > 0) {
+            sys->ga_hsync_after_vsync_counter--;
+            if (sys->ga_hsync_after_vsync_counter == 0) {
+                if (sys->ga_hsync_irq_counter >= 32) {
+                    sys->ga_int = true;
+                }
+                sys->ga_hsync_irq_counter = 0;
+            }
+        }
+        /* normal behaviour, request interrupt each 52 scanlines */
+        if (sys->ga_hsync_irq_counter == 52) {
+            sys->ga_hsync_irq_counter = 0;
+            sys->ga_int = true;
+        }
+    }
+
+    /* generate HSYNC signal to monitor:
+        - starts 2 ticks after HSYNC rising edge from CRTC
+        - stays active for 4 ticks or less if CRTC HSYNC goes inactive earlier
+    */
+    if (rising_edge(crtc_pins, sys->ga_crtc_pins, MC6845_HS)) {
+        sys->ga_hsync_delay_counter = 3;
+    }
+    if (falling_edge(crtc_pins, sys->ga_crtc_pins, MC6845_HS)) {
+        sys->ga_hsync_delay_counter = 0;
+        sys->ga_hsync_counter = 0;
+        sys->ga_sync = false;
+    }
+    if (sys->ga_hsync_delay_counter > 0) {
+        sys->ga_hsync_delay_counter--;
+        if (sys->ga_hsync_delay_counter == 0) {
+            sys->ga_sync = true;
+            sys->ga_hsync_counter = 5;
+        }
+    }
+    if (sys->ga_hsync_counter > 0) {
+        sys->ga_hsync_counter--;
+        if (sys->ga_hsync_counter == 0) {
+            sys->ga_sync = false;
+        }
+    }
+
+    // FIXME delayed VSYNC to monitor
+
+    const bool vsync = 0 != (crtc_pins & MC6845_VS);
+    CHIPTIME_MARK(sys->chiptime, CPC_CHIPTIME_GA);
+    if (sys->line_batching) {
+        /* only remember what's needed to run the CRT and decode the pixels later,
+           nothing else in this tick depends on the CRT beam position
+        */
+        if (sys->line_batch_len == CPC_LINE_BATCH_SIZE) {
+            cpc_ga_flush_line(sys);
+        }
+        uint8_t flags = 0;
+        if (crtc_pins & MC6845_DE) { flags |= _CPC_LINE_DE; }
+        if (crtc_pins & (MC6845_HS|MC6845_VS)) { flags |= _CPC_LINE_BLANK; }
+        if (sys->ga_sync) { flags |= _CPC_LINE_HSYNC; }
+        if (vsync) { flags |= _CPC_LINE_VSYNC; }
+        if (!sys->skip_video) { flags |= _CPC_LINE_DECODE; }
+        const uint8_t* src = _cpc_ga_video_src(sys, crtc_pins);
+        sys->line_batch[sys->line_batch_len].flags = flags;
+        sys->line_batch[sys->line_batch_len].data[0] = src[0];
+        sys->line_batch[sys->line_batch_len].data[1] = src[1];
+        sys->line_batch_len++;
+    }
+    else {
+        crt_tick(&sys->crt, sys->ga_sync, vsync);
+        CHIPTIME_MARK(sys->chiptime, CPC_CHIPTIME_CRT);
+        if (!sys->skip_video) {
+            cpc_ga_decode_video(sys, crtc_pins);
+            CHIPTIME_MARK(sys->chiptime, CPC_CHIPTIME_VIDEO);
+        }
+    }
+
+    sys->ga_crtc_pins = crtc_pins;
+
+    if (sys->ga_int) {
+        cpu_pins |= Z80_INT;
+    }
+    return cpu_pins;
+}
+
+/*
+    byte => pen index tables for the 3 video modes, the pixels
+    are stretched to 8 output pixels per byte:
+
+    mode 0: 160x200 @ 16 colors     mode 1: 320x200 @ 4 colors
+    pixel    bit mask               pixel    bit mask
+    0:       |1|5|3|7|              0:       |3|7|
+    1:       |0|4|2|6|              1:       |2|6|
+                                    2:       |1|5|
+                                    3:       |0|4|
+    mode 2: 640x200 @ 2 colors, one bit per pixel, MSB first
+*/
+static inline uint8_t _cpc_mode0_pen(uint8_t c, int pixel) {
+    if (0 == pixel) {
+        return ((c>>7)&0x1)|((c>>2)&0x2)|((c>>3)&0x4)|((c<<2)&0x8);
+    }
+    else {
+        return ((c>>6)&0x1)|((c>>1)&0x2)|((c>>2)&0x4)|((c<<3)&0x8);
+    }
+}
+
+static inline uint8_t _cpc_mode1_pen(uint8_t c, int pixel) {
+    return ((c>>(7-pixel))&1)|(((c<<1)>>(3-pixel))&2);
+}
+
+/* rebuild the byte => color index decode table for the indexed video output */
+static void _cpc_ga_update_decode_table_pal8(cpc_t* sys) {
+    for (int c = 0; c < 256; c++) {
+        uint8_t* dst = sys->ga_decode_table_pal8[c];
+        switch (sys->ga_video_mode) {
+            case 0:
+                for (int i = 0; i < 8; i++) {
+                    dst[i] = sys->ga_pen_index[_cpc_mode0_pen(c, i>>2)];
+                }
+                break;
+            case 1:
+                for (int i = 0; i < 8; i++) {
+                    dst[i] = sys->ga_pen_index[_cpc_mode1_pen(c, i>>1)];
+                }
+                break;
+            case 2:
+                for (int i = 0; i < 8; i++) {
+                    dst[i] = sys->ga_pen_index[(c>>(7-i))&1];
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/* rebuild the byte => RGBA decode table after a video mode or palette change */
+static void _cpc_ga_update_decode_table(cpc_t* sys) {
+    sys->ga_decode_dirty = false;
+    if (sys->pal8_buffer) {
+        _cpc_ga_update_decode_table_pal8(sys);
+        return;
+    }
+    for (int c = 0; c < 256; c++) {
+        uint32_t* dst = sys->ga_decode_table[c];
+        switch (sys->ga_video_mode) {
+            case 0:
+                for (int i = 0; i < 8; i++) {
+                    dst[i] = sys->ga_palette[_cpc_mode0_pen(c, i>>2)];
+                }
+                break;
+            case 1:
+                for (int i = 0; i < 8; i++) {
+                    dst[i] = sys->ga_palette[_cpc_mode1_pen(c, i>>1)];
+                }
+                break;
+            case 2:
+                for (int i = 0; i < 8; i++) {
+                    dst[i] = sys->ga_palette[(c>>(7-i))&1];
+                }
+                break;
+            default:
+                /* mode 3 doesn't decode any pixels */
+                break;
+        }
+    }
+}
+
+/* copy 8 pixels */
+static inline void _cpc_copy8(uint32_t* dst, const uint32_t* src) {
+    #if defined(_CPC_SSE2)
+    _mm_storeu_si128((__m128i*)dst, _mm_loadu_si128((const __m128i*)src));
+    _mm_storeu_si128((__m128i*)(dst+4), _mm_loadu_si128((const __m128i*)(src+4)));
+    #elif defined(_CPC_NEON)
+    vst1q_u32(dst, vld1q_u32(src));
+    vst1q_u32(dst+4, vld1q_u32(src+4));
+    #else
+    memcpy(dst, src, 8 * sizeof(uint32_t));
+    #endif
+}
+
+/* fill 16 pixels with the same color */
+static inline void _cpc_fill16(uint32_t* dst, uint32_t color) {
+    #if defined(_CPC_SSE2)
+    const __m128i c = _mm_set1_epi32((int)color);
+    _mm_storeu_si128((__m128i*)dst, c);
+    _mm_storeu_si128((__m128i*)(dst+4), c);
+    _mm_storeu_si128((__m128i*)(dst+8), c);
+    _mm_storeu_si128((__m128i*)(dst+12), c);
+    #elif defined(_CPC_NEON)
+    const uint32x4_t c = vdupq_n_u32(color);
+    vst1q_u32(dst, c);
+    vst1q_u32(dst+4, c);
+    vst1q_u32(dst+8, c);
+    vst1q_u32(dst+12, c);
+    #else
+    for (int i = 0; i < 16; i++) {
+        dst[i] = color;
+    }
+    #endif
+}
+
+void cpc_ga_decode_pixels(cpc_t* sys, uint32_t* dst, uint64_t crtc_pins) {
+    if (sys->ga_video_mode > 2) {
+        return;
+    }
+    if (sys->ga_decode_dirty) {
+        _cpc_ga_update_decode_table(sys);
+    }
+    const uint8_t* src = _cpc_ga_video_src(sys, crtc_pins);
+    _cpc_copy8(dst, sys->ga_decode_table[src[0]]);
+    _cpc_copy8(dst + 8, sys->ga_decode_table[src[1]]);
+}
+
+/* same as cpc_ga_decode_pixels, but writes 16 color indices */
+void cpc_ga_decode_pixels_pal8(cpc_t* sys, uint8_t* dst, uint64_t crtc_pins) {
+    if (sys->ga_video_mode > 2) {
+        return;
+    }
+    if (sys->ga_decode_dirty) {
+        _cpc_ga_update_decode_table(sys);
+    }
+    const uint8_t* src = _cpc_ga_video_src(sys, crtc_pins);
+    memcpy(dst, sys->ga_decode_table_pal8[src[0]], 8);
+    memcpy(dst + 8, sys->ga_decode_table_pal8[src[1]], 8);
+}
+
+/* decode 16 pixels at the CRT beam position, src is the 2 video RAM bytes (only read with _CPC_LINE_DE) */
+static inline void _cpc_ga_decode_cell(cpc_t* sys, uint8_t flags, const uint8_t* src) {
+    if (!sys->crt.visible) {
+        return;
+    }
+    const int dst_x = sys->crt.pos_x * 16;
+    const int dst_y = sys->crt.pos_y;
+    if (sys->pal8_buffer) {
+        uint8_t* dst = &(sys->pal8_buffer[dst_x + dst_y * CPC_DISP_WIDTH]);
+        if (flags & _CPC_LINE_DE) {
+            if (sys->ga_video_mode <= 2) {
+                if (sys->ga_decode_dirty) {
+                    _cpc_ga_update_decode_table(sys);
+                }
+                memcpy(dst, sys->ga_decode_table_pal8[src[0]], 8);
+                memcpy(dst + 8, sys->ga_decode_table_pal8[src[1]], 8);
+            }
+        }
+        else if (flags & _CPC_LINE_BLANK) {
+            memset(dst, CPC_PAL8_BLACK, 16);
+        }
+        else {
+            memset(dst, sys->ga_border_index, 16);
+        }
+    }
+    else {
+        uint32_t* dst = &(sys->rgba8_buffer[dst_x + dst_y * CPC_DISP_WIDTH]);
+        if (flags & _CPC_LINE_DE) {
+            /* decode visible pixels */
+            if (sys->ga_video_mode <= 2) {
+                if (sys->ga_decode_dirty) {
+                    _cpc_ga_update_decode_table(sys);
+                }
+                _cpc_copy8(dst, sys->ga_decode_table[src[0]]);
+                _cpc_copy8(dst + 8, sys->ga_decode_table[src[1]]);
+            }
+        }
+        else if (flags & _CPC_LINE_BLANK) {
+            /* during horizontal/vertical sync: blacker than black */
+            _cpc_fill16(dst, 0xFF000000);
+        }
+        else {
+            /* border color */
+            _cpc_fill16(dst, sys->ga_border_color);
+        }
+    }
+}
+
+void cpc_ga_decode_video(cpc_t* sys, uint64_t crtc_pins) {
+    uint8_t flags = 0;
+    if (crtc_pins & MC6845_DE) {
+        flags |= _CPC_LINE_DE;
+    }
+    else if (crtc_pins & (MC6845_HS|MC6845_VS)) {
+        flags |= _CPC_LINE_BLANK;
+    }
+    _cpc_ga_decode_cell(sys, flags, _cpc_ga_video_src(sys, crtc_pins));
+}
+
+/* run the CRT and decode the pixels for the pending gate array ticks of the scanline */
+void cpc_ga_flush_line(cpc_t* sys) {
+    const int num = sys->line_batch_len;
+    for (int i = 0; i < num; i++) {
+        const uint8_t flags = sys->line_batch[i].flags;
+        crt_tick(&sys->crt, 0 != (flags & _CPC_LINE_HSYNC), 0 != (flags & _CPC_LINE_VSYNC));
+        CHIPTIME_MARK(sys->chiptime, CPC_CHIPTIME_CRT);
+        if (flags & _CPC_LINE_DECODE) {
+            _cpc_ga_decode_cell(sys, flags, sys->line_batch[i].data);
+            CHIPTIME_MARK(sys->chiptime, CPC_CHIPTIME_VIDEO);
+        }
+    }
+    sys->line_batch_len = 0;
+}
+
+void cpc_pal8_colors(uint32_t colors[CPC_PAL8_NUM_COLORS]) {
+    memcpy(colors, cpc_colors, sizeof(cpc_colors));
+    colors[CPC_PAL8_BLACK] = 0xFF000000;
+}
+
+#define _CPC_AMSDOS_HEADER_SIZE (128)
+
+bool cpc_quickload(cpc_t* sys, const uint8_t* ptr, uint32_t num_bytes) {
+    CHIPS_ASSERT(sys && ptr);
+    if (num_bytes <= _CPC_AMSDOS_HEADER_SIZE) {
+        return false;
+    }
+    /* the header checksum is the sum of bytes 0..66 */
+    const uint8_t* hdr = ptr;
+    uint16_t checksum = 0;
+    for (int i = 0; i < 67; i++) {
+        checksum += hdr[i];
+    }
+    if ((checksum != (hdr[67] | (hdr[68] << 8))) || (2 != (hdr[18] & 0x0E))) {
+        /* not a header, or not a binary file */
+        return false;
+    }
+    const uint16_t load_addr = (uint16_t)(hdr[21] | (hdr[22] << 8));
+    const uint32_t len = (uint32_t)(hdr[64] | (hdr[65] << 8) | (hdr[66] << 16));
+    const uint16_t exec_addr = (uint16_t)(hdr[26] | (hdr[27] << 8));
+    if (((_CPC_AMSDOS_HEADER_SIZE + len) > num_bytes) || ((load_addr + len) > 0x10000)) {
+        return false;
+    }
+    /* CPU writes always go to RAM, even with ROMs mapped */
+    mem_write_range(&sys->mem, load_addr, ptr + _CPC_AMSDOS_HEADER_SIZE, (int)len);
+    sys->cpu.state.PC = exec_addr;
+    return true;
+}
+
+#define CPC_SNAPSHOT_ID SNAPSHOT_FOURCC('C','P','C','6')
+
+uint32_t cpc_snapshot_size(void) {
+    return snapshot_size(sizeof(cpc_t));
+}
+
+/* restore the chip callbacks and memory map of an instance whose struct
+   was copied from a snapshot or clone base, the framebuffer and ROM
+   pointers must already be the ones of the instance
+*/
+static void _cpc_restore_pointers(cpc_t* sys) {
+    sys->cpu.tick = cpc_cpu_tick;
+    sys->ppi.in_cb = cpc_ppi_in;
+    sys->ppi.out_cb = cpc_ppi_out;
+    sys->psg.in_cb = cpc_psg_in;
+    sys->psg.out_cb = cpc_psg_out;
+    cpc_update_memory_mapping(sys);
+    sys->ga_decode_dirty = true;
+}
+
+uint32_t cpc_save_snapshot(const cpc_t* sys, void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    return snapshot_save(buf, buf_size, CPC_SNAPSHOT_ID, sys, sizeof(cpc_t));
+}
+
+bool cpc_load_snapshot(cpc_t* sys, const void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    uint32_t* rgba8_buffer = sys->rgba8_buffer;
+    const uint32_t rgba8_buffer_size = sys->rgba8_buffer_size;
+    const uint8_t* rom_os = sys->rom_os;
+    const uint8_t* rom_basic = sys->rom_basic;
+    const uint8_t* rom_amsdos = sys->rom_amsdos;
+    uint8_t* pal8_buffer = sys->pal8_buffer;
+    const uint32_t pal8_buffer_size = sys->pal8_buffer_size;
+    cpc_audio_callback_t audio_cb = sys->audio_cb;
+    pcprof_t* prof = sys->prof;
+    chiptime_t* chiptime = sys->chiptime;
+    bustrace_t* trace = sys->trace;
+    dbg_t* dbg = sys->dbg;
+    heatmap_t* heatmap = sys->heatmap;
+    const bool line_batching = sys->line_batching;
+    const bool audio_batching = sys->audio_batching;
+    if (!snapshot_load(buf, buf_size, CPC_SNAPSHOT_ID, sys, sizeof(cpc_t))) {
+        return false;
+    }
+    /* keep the instance's own framebuffers, ROMs, audio output and instrumentation */
+    sys->rgba8_buffer = rgba8_buffer;
+    sys->rgba8_buffer_size = rgba8_buffer_size;
+    sys->rom_os = rom_os;
+    sys->rom_basic = rom_basic;
+    sys->rom_amsdos = rom_amsdos;
+    sys->pal8_buffer = pal8_buffer;
+    sys->audio_cb = audio_cb;
+    sys->prof = prof;
+    sys->chiptime = chiptime;
+    sys->trace = trace;
+    sys->dbg = dbg;
+    sys->heatmap = heatmap;
+    sys->line_batching = line_batching;
+    sys->audio_batching = audio_batching;
+    sys->pal8_buffer_size = pal8_buffer_size;
+    /* restore the chip callbacks, memory map and decode table */
+    _cpc_restore_pointers(sys);
+    _cpc_psg_catchup(sys);
+    return true;
+}
+
+bool cpc_clone_base(clone_base_t* base, const void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(base);
+    return clone_base_init(base, buf, buf_size, CPC_SNAPSHOT_ID, sizeof(cpc_t));
+}
+
+cpc_t* cpc_clone(const clone_base_t* base, uint32_t* rgba8_buffer, uint32_t rgba8_buffer_size) {
+    CHIPS_ASSERT(base && rgba8_buffer);
+    cpc_t* sys = (cpc_t*) clone_map(base);
+    if (!sys) {
+        return 0;
+    }
+    /* the clone gets its own framebuffer, and doesn't share the audio output or the instrumentation of the base */
+    sys->rgba8_buffer = rgba8_buffer;
+    sys->rgba8_buffer_size = rgba8_buffer_size;
+    sys->pal8_buffer = 0;
+    sys->pal8_buffer_size = 0;
+    sys->prof = 0;
+    sys->chiptime = 0;
+    sys->trace = 0;
+    sys->dbg = 0;
+    sys->heatmap = 0;
+    sys->audio_cb = 0;
+    _cpc_restore_pointers(sys);
+    return sys;
+}
+
+void cpc_free_clone(const clone_base_t* base, cpc_t* sys) {
+    CHIPS_ASSERT(base);
+    clone_unmap(base, sys);
+}
+
+#endif /* CHIPS_IMPL */
@@ -0,0 +1,555 @@
+#pragma once
+/*
+    kc87.h
+
+    KC87 emulator core without any platform dependencies,
+    used by the kc87 example and the headless chips-bench.
+
+    Wiring diagram: http://www.sax.de/~zander/kc/kcsch_1.pdf
+    Detailed Manual: http://www.sax.de/~zander/z9001/doku/z9_fub.pdf
+
+    not emulated: beeper sound, border color, 40x20 video mode
+
+    Do this:
+        #define CHIPS_IMPL
+    before you include this file in *one* C file to create the
+    implementation.
+*/
+#include "chips/z80.h"
+#include "chips/z80pio.h"
+#include "chips/z80ctc.h"
+#include "chips/kbd.h"
+#include "common/thread.h"
+#include "common/snapshot.h"
+#include "common/glyphcache.h"
+#include "common/sched.h"
+#include "common/ctcbatch.h"
+#include "roms/kc87-roms.h"
+
+#define KC87_FREQ (2457600)
+#define KC87_DISP_WIDTH (320)
+#define KC87_DISP_HEIGHT (192)
+#define KC87_GLYPH_CACHE_SLOTS (8)     /* number of fg/bg color pairs in the glyph cache */
+#define KC87_BLINK_PERIOD ((KC87_FREQ * 8) / 25)   /* ticks between blink flip flop toggles */
+
+/* scheduled events (see kc87_t.sched) */
+enum {
+    KC87_EVENT_BLINK = 0,       /* toggle the blink flip flop */
+};
+
+/* KC87 emulator state */
+typedef struct {
+    z80_t cpu;
+    z80pio_t pio1;
+    z80pio_t pio2;
+    z80ctc_t ctc;
+    kbd_t kbd;
+    sched_t sched;              // periodic events, keyed by the emulated tick
+    bool blink_flip_flop;
+    uint64_t ctc_zcto2;
+    uint32_t ctc_pending;       // number of deferred CTC ticks
+    uint32_t ctc_safe;          // number of ticks in which no CTC channel can reach zero
+    bool ctc_batching;          // advance the CTC in batches between zero counts and CTC accesses
+    uint32_t* rgba8_buffer;     // decoded video output
+    uint32_t rgba8_buffer_size;
+    uint8_t mem[1<<16];
+    /* video decoding only redraws character cells which have changed */
+    bool vid_dirty_all;             // redraw all cells on next decode
+    bool skip_video;                // don't decode video memory (warp mode)
+    bool vid_blink_flip_flop;       // blink flip flop state of last decode
+    uint32_t vid_cells_redrawn;     // number of cells redrawn by the last decode
+    uint64_t vid_dirty[16];         // one dirty bit per video/color RAM cell
+    /* pre-rasterized character tiles, must be last, not part of snapshots */
+    glyph_cache_t glyph_cache;
+    glyph_slot_t glyph_slots[KC87_GLYPH_CACHE_SLOTS];
+} kc87_t;
+
+/* a copy of the video state at the end of a frame, so that it can be decoded
+   while the emulator already runs the next frame (see kc87_capture_video())
+*/
+typedef struct {
+    uint64_t dirty[16];             // the character cells to redraw
+    bool blink_flip_flop;
+    uint32_t cells_redrawn;         // output of kc87_decode_video()
+    uint8_t vidmem[0x400];          // copy of the ASCII buffer at EC00
+    uint8_t colmem[0x400];          // copy of the color buffer at E800
+} kc87_video_frame_t;
+
+/* KC87 emulator setup parameters */
+typedef struct {
+    uint32_t* rgba8_buffer;         /* the framebuffer for the decoded video output */
+    uint32_t rgba8_buffer_size;     /* size of the framebuffer in bytes */
+    bool disable_ctc_batching;      /* tick the CTC together with the CPU */
+} kc87_desc_t;
+
+/* initialize a KC87 emulator instance */
+extern void kc87_init(kc87_t* sys, const kc87_desc_t* desc);
+/* run an emulator instance for at least the given number of ticks, returns executed ticks */
+extern uint32_t kc87_exec(kc87_t* sys, uint32_t ticks);
+/* size of a KC87 snapshot in bytes */
+extern uint32_t kc87_snapshot_size(void);
+/* save a snapshot of an instance into buf, returns number of bytes written (0 if buf is too small) */
+extern uint32_t kc87_save_snapshot(const kc87_t* sys, void* buf, uint32_t buf_size);
+/* restore a snapshot into an initialized instance, returns false if the snapshot doesn't match */
+extern bool kc87_load_snapshot(kc87_t* sys, const void* buf, uint32_t buf_size);
+/* copy the video state for kc87_decode_video() and clear the dirty cells (use with skip_video) */
+extern void kc87_capture_video(kc87_t* sys, kc87_video_frame_t* frame);
+/* decode a captured frame into a framebuffer which is only written by this function,
+   can run on another thread while kc87_exec() runs (it only uses the glyph cache of sys)
+*/
+extern void kc87_decode_video(kc87_t* sys, kc87_video_frame_t* frame, uint32_t* dst);
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#ifdef CHIPS_IMPL
+#include <string.h>
+#include <stddef.h> /* offsetof */
+#ifndef CHIPS_ASSERT
+    #include <assert.h>
+    #define CHIPS_ASSERT(c) assert(c)
+#endif
+
+/* the emulator instance running on the current thread */
+static CHIPS_THREAD_LOCAL kc87_t* _kc87_sys;
+
+const uint32_t kc87_palette[8] = {
+    0xFF000000,     // black
+    0xFF0000FF,     // red
+    0xFF00FF00,     // green
+    0xFF00FFFF,     // yellow
+    0xFFFF0000,     // blue
+    0xFFFF00FF,     // purple
+    0xFFFFFF00,     // cyan
+    0xFFFFFFFF,     // white
+};
+
+uint64_t kc87_tick(int num, uint64_t pins);
+uint8_t kc87_pio1_in(int port_id);
+void kc87_pio1_out(int port_id, uint8_t data);
+uint8_t kc87_pio2_in(int port_id);
+void kc87_pio2_out(int port_id, uint8_t data);
+void kc87_decode_vidmem(kc87_t* sys);
+
+/* mark a character cell as dirty after a write to the video or color RAM */
+static inline void _kc87_vid_dirty(kc87_t* sys, uint16_t addr) {
+    const uint16_t cell = addr & 0x3FF;
+    sys->vid_dirty[cell >> 6] |= 1ULL << (cell & 63);
+}
+
+/* xorshift randomness for memory initialization */
+static uint32_t _kc87_xorshift32(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x<<13; x ^= x>>17; x ^= x<<5;
+    *state = x;
+    return x;
+}
+
+/* KC87 emulator initialization */
+void kc87_init(kc87_t* sys, const kc87_desc_t* desc) {
+    CHIPS_ASSERT(sys && desc && desc->rgba8_buffer);
+    CHIPS_ASSERT(desc->rgba8_buffer_size >= (KC87_DISP_WIDTH*KC87_DISP_HEIGHT*sizeof(uint32_t)));
+    memset(sys, 0, sizeof(kc87_t));
+    _kc87_sys = sys;
+    sys->rgba8_buffer = desc->rgba8_buffer;
+    sys->rgba8_buffer_size = desc->rgba8_buffer_size;
+    sys->ctc_batching = !desc->disable_ctc_batching;
+    glyph_cache_init(&sys->glyph_cache, sys->glyph_slots, KC87_GLYPH_CACHE_SLOTS);
+
+    /* initialize CPU, PIOs and CTC */
+    z80_init(&sys->cpu, kc87_tick);
+    z80pio_init(&sys->pio1, kc87_pio1_in, kc87_pio1_out);
+    z80pio_init(&sys->pio2, kc87_pio2_in, kc87_pio2_out);
+    z80ctc_init(&sys->ctc);
+    sched_init(&sys->sched);
+    sched_set_in(&sys->sched, KC87_EVENT_BLINK, KC87_BLINK_PERIOD, KC87_BLINK_PERIOD);
+
+    /* setup keyboard matrix, keep keys pressed for N frames to give
+       the scan-out routine enough time
+    */
+    kbd_init(&sys->kbd, 3);
+    /* shift key is column 0, line 7 */
+    kbd_register_modifier(&sys->kbd, 0, 0, 7);
+    /* register alpha-numeric keys */
+    const char* keymap =
+        /* unshifted keys */
+        "01234567"
+        "89:;,=.?"
+        "@ABCDEFG"
+        "HIJKLMNO"
+        "PQRSTUVW"
+        "XYZ   ^ "
+        "        "
+        "        "
+        /* shifted keys */
+        "_!\"#$%&'"
+        "()*+<->/"
+        " abcdefg"
+        "hijklmno"
+        "pqrstuvw"
+        "xyz     "
+        "        "
+        "        ";
+    for (int shift = 0; shift < 2; shift++) {
+        for (int line = 0; line < 8; line++) {
+            for (int col = 0; col < 8; col++) {
+                int c = keymap[shift*64 + line*8 + col];
+                if (c != 0x20) {
+                    kbd_register_key(&sys->kbd, c, col, line, shift?(1<<0):0);
+                }
+            }
+        }
+    }
+    /* special keys */
+    kbd_register_key(&sys->kbd, 0x03, 6, 6, 0);      /* stop (Esc) */
+    kbd_register_key(&sys->kbd, 0x08, 0, 6, 0);      /* cursor left */
+    kbd_register_key(&sys->kbd, 0x09, 1, 6, 0);      /* cursor right */
+    kbd_register_key(&sys->kbd, 0x0A, 2, 6, 0);      /* cursor up */
+    kbd_register_key(&sys->kbd, 0x0B, 3, 6, 0);      /* cursor down */
+    kbd_register_key(&sys->kbd, 0x0D, 5, 6, 0);      /* enter */
+    kbd_register_key(&sys->kbd, 0x13, 4, 5, 0);      /* pause */
+    kbd_register_key(&sys->kbd, 0x14, 1, 7, 0);      /* color */
+    kbd_register_key(&sys->kbd, 0x19, 3, 5, 0);      /* home */
+    kbd_register_key(&sys->kbd, 0x1A, 5, 5, 0);      /* insert */
+    kbd_register_key(&sys->kbd, 0x1B, 4, 6, 0);      /* esc (Shift+Esc) */
+    kbd_register_key(&sys->kbd, 0x1C, 4, 7, 0);      /* list */
+    kbd_register_key(&sys->kbd, 0x1D, 5, 7, 0);      /* run */
+    kbd_register_key(&sys->kbd, 0x20, 7, 6, 0);      /* space */
+
+    /* fill memory with randonmess */
+    uint32_t xorshift_state = 0x6D98302B;
+    for (int i = 0; i < (int) sizeof(sys->mem);) {
+        uint32_t r = _kc87_xorshift32(&xorshift_state);
+        sys->mem[i++] = r>>24;
+        sys->mem[i++] = r>>16;
+        sys->mem[i++] = r>>8;
+        sys->mem[i++] = r;
+    }
+    /* 8 KBytes BASIC ROM starting at C000 */
+    CHIPS_ASSERT(sizeof(dump_z9001_basic) == 0x2000);
+    memcpy(&sys->mem[0xC000], dump_z9001_basic, sizeof(dump_z9001_basic));
+    /* 8 KByte OS ROM starting at E000, leave a hole at E800..EFFF for vidmem */
+    CHIPS_ASSERT(sizeof(dump_kc87_os_2) == 0x2000);
+    memcpy(&sys->mem[0xE000], dump_kc87_os_2, 0x800);
+    memcpy(&sys->mem[0xF000], dump_kc87_os_2+0x1000, 0x1000);
+
+    /* execution starts at 0xF000 */
+    sys->cpu.state.PC = 0xF000;
+    sys->vid_dirty_all = true;
+}
+
+/* run the KC87 emulation for at least the given number of ticks, and
+   decode the video memory into the framebuffer
+*/
+uint32_t kc87_exec(kc87_t* sys, uint32_t ticks) {
+    _kc87_sys = sys;
+    uint32_t ticks_executed = z80_exec(&sys->cpu, ticks);
+    if (!sys->skip_video) {
+        kc87_decode_vidmem(sys);
+    }
+    return ticks_executed;
+}
+
+/* apply the deferred CTC ticks, this brings the CTC up to the current tick */
+static inline void _kc87_ctc_catchup(kc87_t* sys) {
+    if (sys->ctc_pending > 0) {
+        ctcbatch_advance(&sys->ctc, sys->ctc_pending);
+        sys->ctc_pending = 0;
+    }
+}
+
+/* tick the CTC channels, the CTC channel 2 output signal ZCTO2 is connected
+   to CTC channel 3 input signal CLKTRG3 to form a timer cascade
+   which drives the system clock, store the state of ZCTO2 for the
+   next tick
+
+   With ctc_batching, the ticks are only counted while no channel can
+   reach zero (see common/ctcbatch.h), and applied at once before the next
+   zero count or CTC access. The channel outputs and interrupt requests
+   can't change in that time, and CLKTRG3 stays inactive.
+*/
+static inline uint64_t _kc87_ctc_tick(kc87_t* sys, int num_ticks, uint64_t pins) {
+    if (sys->ctc_safe >= (uint32_t)num_ticks) {
+        sys->ctc_safe -= num_ticks;
+        sys->ctc_pending += num_ticks;
+        return pins;
+    }
+    _kc87_ctc_catchup(sys);
+    pins |= sys->ctc_zcto2;
+    for (int i = 0; i < num_ticks; i++) {
+        pins = ctcbatch_tick_cascade(&sys->ctc, pins);
+    }
+    sys->ctc_zcto2 = (pins & Z80CTC_ZCTO2);
+    sys->ctc_safe = (sys->ctc_batching && !sys->ctc_zcto2) ? ctcbatch_safe_ticks(&sys->ctc, 0) : 0;
+    return pins;
+}
+
+/* the CPU tick callback performs memory and I/O reads/writes */
+uint64_t kc87_tick(int num_ticks, uint64_t pins) {
+    kc87_t* sys = _kc87_sys;
+    pins = _kc87_ctc_tick(sys, num_ticks, pins);
+
+    /* the blink flip flop is controlled by a 'bisync' video signal
+       (I guess that means it triggers at half PAL frequency: 25Hz),
+       going into a binary counter, bit 4 of the counter is connected
+       to the blink flip flop.
+    */
+    if (sched_advance(&sys->sched, num_ticks)) {
+        int id;
+        while ((id = sched_pop(&sys->sched)) >= 0) {
+            if (KC87_EVENT_BLINK == id) {
+                sys->blink_flip_flop = !sys->blink_flip_flop;
+            }
+        }
+    }
+
+    /* memory and IO requests */
+    if (pins & Z80_MREQ) {
+        /* a memory request machine cycle */
+        const uint16_t addr = Z80_GET_ADDR(pins);
+        if (pins & Z80_RD) {
+            /* read memory byte */
+            Z80_SET_DATA(pins, sys->mem[addr]);
+        }
+        else if (pins & Z80_WR) {
+            /* write memory byte, don't overwrite ROM */
+            if (addr < 0xC000) {
+                sys->mem[addr] = Z80_GET_DATA(pins);
+            }
+            else if ((addr >= 0xE800) && (addr < 0xF000)) {
+                /* color RAM at E800, video RAM at EC00 */
+                const uint8_t data = Z80_GET_DATA(pins);
+                if (sys->mem[addr] != data) {
+                    sys->mem[addr] = data;
+                    _kc87_vid_dirty(sys, addr);
+                }
+            }
+        }
+    }
+    else if (pins & Z80_IORQ) {
+        /* an IO request machine cycle */
+
+        /* check if any of the PIO/CTC chips is enabled */
+        /* address line 7 must be on, 6 must be off, IORQ on, M1 off */
+        const bool chip_enable = (pins & (Z80_IORQ|Z80_M1|Z80_A7|Z80_A6)) == (Z80_IORQ|Z80_A7);
+        const int chip_select = (pins & (Z80_A5|Z80_A4|Z80_A3))>>3;
+
+        pins = pins & Z80_PIN_MASK;
+        if (chip_enable) {
+            switch (chip_select) {
+                /* IO request on CTC? */
+                case 0:
+                    /* CTC is mapped to ports 0x80 to 0x87 (each port is mapped twice),
+                       the access ends a deferred period
+                    */
+                    _kc87_ctc_catchup(sys);
+                    sys->ctc_safe = 0;
+                    pins |= Z80CTC_CE;
+                    if (pins & Z80_A0) { pins |= Z80CTC_CS0; };
+                    if (pins & Z80_A1) { pins |= Z80CTC_CS1; };
+                    pins = z80ctc_iorq(&sys->ctc, pins) & Z80_PIN_MASK;
+                    break;
+                /* IO request on PIO1? */
+                case 1:
+                    /* PIO1 is mapped to ports 0x88 to 0x8F (each port is mapped twice) */
+                    pins |= Z80PIO_CE;
+                    if (pins & Z80_A0) { pins |= Z80PIO_BASEL; }
+                    if (pins & Z80_A1) { pins |= Z80PIO_CDSEL; }
+                    pins = z80pio_iorq(&sys->pio1, pins) & Z80_PIN_MASK;
+                    break;
+                /* IO request on PIO2? */
+                case 2:
+                    /* PIO2 is mapped to ports 0x90 to 0x97 (each port is mapped twice) */
+                    pins |= Z80PIO_CE;
+                    if (pins & Z80_A0) { pins |= Z80PIO_BASEL; }
+                    if (pins & Z80_A1) { pins |= Z80PIO_CDSEL; }
+                    pins = z80pio_iorq(&sys->pio2, pins) & Z80_PIN_MASK;
+            }
+        }
+    }
+
+    /* handle interrupt requests by PIOs and CTCs, the interrupt priority
+       is PIO1>PIO2>CTC, the interrupt handling functions must be called
+       in this order
+    */
+    Z80_DAISYCHAIN_BEGIN(pins)
+    {
+        pins = z80pio_int(&sys->pio1, pins);
+        pins = z80pio_int(&sys->pio2, pins);
+        pins = z80ctc_int(&sys->ctc, pins);
+    }
+    Z80_DAISYCHAIN_END(pins);
+    return (pins & Z80_PIN_MASK);
+}
+
+uint8_t kc87_pio1_in(int port_id) {
+    return 0x00;
+}
+
+void kc87_pio1_out(int port_id, uint8_t data) {
+    if (Z80PIO_PORT_A == port_id) {
+        /*
+            PIO1-A bits:
+            0..1:    unused
+            2:       display mode (0: 24 lines, 1: 20 lines)
+            3..5:    border color
+            6:       graphics LED on keyboard (0: off)
+            7:       enable audio output (1: enabled)
+        */
+        // FIXME: border_color = (data>>3) & 7;
+    }
+    else {
+        /* PIO1-B is reserved for external user devices */
+    }
+}
+
+/*
+    PIO2 is reserved for keyboard input which works like this:
+
+    FIXME: describe keyboard input
+*/
+uint8_t kc87_pio2_in(int port_id) {
+    kc87_t* sys = _kc87_sys;
+    if (Z80PIO_PORT_A == port_id) {
+        /* return keyboard matrix column bits for requested line bits */
+        uint8_t columns = (uint8_t) kbd_scan_columns(&sys->kbd);
+        return ~columns;
+    }
+    else {
+        /* return keyboard matrix line bits for requested column bits */
+        uint8_t lines = (uint8_t) kbd_scan_lines(&sys->kbd);
+        return ~lines;
+    }
+}
+
+void kc87_pio2_out(int port_id, uint8_t data) {
+    kc87_t* sys = _kc87_sys;
+    if (Z80PIO_PORT_A == port_id) {
+        kbd_set_active_columns(&sys->kbd, ~data);
+    }
+    else {
+        kbd_set_active_lines(&sys->kbd, ~data);
+    }
+}
+
+/* decode a single character cell into the RGBA8 buffer */
+static void _kc87_decode_cell(kc87_t* sys, const kc87_video_frame_t* frame, uint32_t* fb, int offset) {
+    const int x = offset % 40;
+    const int y = offset / 40;
+    uint32_t* dst = &fb[(y * 8 * KC87_DISP_WIDTH) + (x * 8)];
+    const uint8_t chr = frame->vidmem[offset];
+    const uint8_t color = frame->colmem[offset];
+    uint32_t fg, bg;
+    if ((color & 0x80) && frame->blink_flip_flop) {
+        /* blinking: swap back- and foreground color */
+        fg = kc87_palette[color&7];
+        bg = kc87_palette[(color>>4)&7];
+    }
+    else {
+        fg = kc87_palette[(color>>4)&7];
+        bg = kc87_palette[color&7];
+    }
+    const uint32_t* tile = glyph_cache_tile(&sys->glyph_cache, sys->glyph_slots, dump_kc87_font_2, chr, fg, bg);
+    for (int py = 0; py < 8; py++) {
+        memcpy(dst, tile, 8 * sizeof(uint32_t));
+        tile += 8;
+        dst += KC87_DISP_WIDTH;
+    }
+}
+
+/* capture the video state of the current frame: the character cells which
+   have been written since the last capture (or which are blinking when the
+   blink flip flop has toggled), and a copy of the video and color RAM
+*/
+void kc87_capture_video(kc87_t* sys, kc87_video_frame_t* frame) {
+    /* FIXME: there's also a 40x20 video mode */
+    const int num_cells = 40 * 24;
+    if (sys->vid_dirty_all) {
+        memset(frame->dirty, 0xFF, sizeof(frame->dirty));
+    }
+    else {
+        if (sys->vid_blink_flip_flop != sys->blink_flip_flop) {
+            const uint8_t* colmem = &sys->mem[0xE800];
+            for (int i = 0; i < num_cells; i++) {
+                if (colmem[i] & 0x80) {
+                    _kc87_vid_dirty(sys, i);
+                }
+            }
+        }
+        memcpy(frame->dirty, sys->vid_dirty, sizeof(frame->dirty));
+    }
+    frame->blink_flip_flop = sys->blink_flip_flop;
+    memcpy(frame->vidmem, &sys->mem[0xEC00], sizeof(frame->vidmem));  /* 1 KB ASCII buffer at EC00 */
+    memcpy(frame->colmem, &sys->mem[0xE800], sizeof(frame->colmem));  /* 1 KB color buffer at E800 */
+    memset(sys->vid_dirty, 0, sizeof(sys->vid_dirty));
+    sys->vid_dirty_all = false;
+    sys->vid_blink_flip_flop = sys->blink_flip_flop;
+}
+
+/* decode a captured KC87 40x24 framebuffer to a linear 320x192 RGBA8 buffer */
+void kc87_decode_video(kc87_t* sys, kc87_video_frame_t* frame, uint32_t* dst) {
+    const int num_cells = 40 * 24;
+    int redrawn = 0;
+    for (int w = 0; w < 16; w++) {
+        const uint64_t bits = frame->dirty[w];
+        if (bits) {
+            for (int b = 0; b < 64; b++) {
+                const int i = (w << 6) | b;
+                if ((bits & (1ULL << b)) && (i < num_cells)) {
+                    _kc87_decode_cell(sys, frame, dst, i);
+                    redrawn++;
+                }
+            }
+        }
+    }
+    frame->cells_redrawn = redrawn;
+}
+
+/* decode the video memory into the emulator's framebuffer, only character
+   cells which have changed since the last decode are redrawn
+*/
+void kc87_decode_vidmem(kc87_t* sys) {
+    kc87_video_frame_t frame;
+    kc87_capture_video(sys, &frame);
+    kc87_decode_video(sys, &frame, sys->rgba8_buffer);
+    sys->vid_cells_redrawn = frame.cells_redrawn;
+}
+
+#define KC87_SNAPSHOT_ID SNAPSHOT_FOURCC('K','C','8','7')
+/* the glyph cache at the end of the struct isn't part of the snapshot */
+#define _KC87_SNAPSHOT_STATE_SIZE ((uint32_t)offsetof(kc87_t, glyph_cache))
+
+uint32_t kc87_snapshot_size(void) {
+    return snapshot_size(_KC87_SNAPSHOT_STATE_SIZE);
+}
+
+uint32_t kc87_save_snapshot(const kc87_t* sys, void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    return snapshot_save(buf, buf_size, KC87_SNAPSHOT_ID, sys, _KC87_SNAPSHOT_STATE_SIZE);
+}
+
+bool kc87_load_snapshot(kc87_t* sys, const void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    uint32_t* rgba8_buffer = sys->rgba8_buffer;
+    const uint32_t rgba8_buffer_size = sys->rgba8_buffer_size;
+    const bool ctc_batching = sys->ctc_batching;
+    if (!snapshot_load(buf, buf_size, KC87_SNAPSHOT_ID, sys, _KC87_SNAPSHOT_STATE_SIZE)) {
+        return false;
+    }
+    /* keep the instance's own framebuffer and restore the chip callbacks */
+    sys->rgba8_buffer = rgba8_buffer;
+    sys->rgba8_buffer_size = rgba8_buffer_size;
+    sys->cpu.tick = kc87_tick;
+    sys->pio1.in_cb = kc87_pio1_in;
+    sys->pio1.out_cb = kc87_pio1_out;
+    sys->pio2.in_cb = kc87_pio2_in;
+    sys->pio2.out_cb = kc87_pio2_out;
+    /* keep the instance's own CTC mode, deferred CTC ticks from the snapshot are applied right away */
+    sys->ctc_batching = ctc_batching;
+    _kc87_ctc_catchup(sys);
+    sys->ctc_safe = 0;
+    /* the framebuffer and glyph cache aren't part of the snapshot */
+    sys->vid_dirty_all = true;
+    glyph_cache_reset(&sys->glyph_cache, sys->glyph_slots);
+    return true;
+}
+
+#endif /* CHIPS_IMPL */
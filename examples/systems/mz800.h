@@ -0,0 +1,370 @@
+#pragma once
+//------------------------------------------------------------------------------
+// mz800.h
+//
+// Emulator core for the SHARP MZ-800 without any platform dependencies,
+// used by the mz800 example and the headless chips-bench.
+//
+// Do this:
+//     #define CHIPS_IMPL
+// before you include this file in *one* C file to create the
+// implementation.
+//------------------------------------------------------------------------------
+#include "chips/z80.h"
+#include "chips/z80pio.h"
+#include "chips/z80ctc.h"
+#include "chips/crt.h"
+#include "chips/kbd.h"
+#include "chips/mem.h"
+#include "gdg_whid65040_032.h"
+#include "common/thread.h"
+#include "common/snapshot.h"
+#include "roms/mz800-roms.h"
+
+#define MZ800_FREQ (3546895) // 3.546895 MHz
+#define MZ800_DISP_WIDTH (GDG_DISPLAY_WIDTH)
+#define MZ800_DISP_HEIGHT (GDG_DISPLAY_HEIGHT)
+#define MZ800_SCANLINE_TICKS (228)      // CPU ticks per PAL scanline (64us)
+#define MZ800_SCANLINES (312)           // scanlines per PAL frame
+#define MZ800_DISP_FIRST_LINE (56)      // first scanline of the display area
+
+/// MZ-800 emulator state
+typedef struct {
+    
+    // CPU Z80A
+    z80_t cpu;
+    uint32_t tick_count;
+    
+    // video beam position, the GDG decodes a display line when the beam leaves it
+    uint32_t scanline_ticks;
+    uint32_t scanline;
+    // true while the VRAM is mapped at 0x8000-0xbfff
+    bool vram_mapped;
+    // _MZ800_ROM_* bits of the ROMs which are mapped instead of DRAM
+    uint8_t rom_mapped;
+    
+    // PPI i8255, keyboard and cassette driver
+    // CTC i8253, programmable counter/timer
+    // PIO Z80 PIO, parallel I/O unit
+    // PSG SN 76489 AN, sound generator
+    
+    // GDG WHID 65040-032, CRT controller
+    gdg_whid65040_032_t gdg;
+    
+    // CRT
+    crt_t crt;
+    
+    // Keyboard
+    kbd_t kbd;
+    
+    // Memory
+    mem_t mem;
+
+    // Decoded video output
+    uint32_t* rgba8_buffer;
+    uint32_t rgba8_buffer_size;
+    
+    // ROM
+    uint8_t rom1[0x1000];  // 0x0000-0x0fff
+    uint8_t cgrom[0x1000]; // 0x1000-0x1fff
+    uint8_t rom2[0x2000];  // 0xe000-0xffff
+    // VRAM
+    uint8_t vram[0x4000];  // 0x8000-0xbfff
+    // RAM
+    uint8_t dram0[0x1000]; // 0x0000-0x0fff
+    uint8_t dram1[0x1000]; // 0x1000-0x1fff
+    uint8_t dram2[0x6000]; // 0x2000-0x7fff
+    uint8_t dram3[0x4000]; // 0x8000-0xbfff
+    uint8_t dram4[0x2000]; // 0xc000-0xdfff
+    uint8_t dram5[0x2000]; // 0xe000-0xffff
+} mz800_t;
+
+/// MZ-800 emulator setup parameters
+typedef struct {
+    uint32_t* rgba8_buffer;         // the framebuffer for the decoded video output
+    uint32_t rgba8_buffer_size;     // size of the framebuffer in bytes
+} mz800_desc_t;
+
+/// initialize a MZ-800 emulator instance
+extern void mz800_init(mz800_t* sys, const mz800_desc_t* desc);
+/// run an emulator instance for at least the given number of ticks, returns executed ticks
+extern uint32_t mz800_exec(mz800_t* sys, uint32_t ticks);
+/// size of an MZ-800 snapshot in bytes
+extern uint32_t mz800_snapshot_size(void);
+/// save a snapshot of an instance into buf, returns number of bytes written (0 if buf is too small)
+extern uint32_t mz800_save_snapshot(const mz800_t* sys, void* buf, uint32_t buf_size);
+/// restore a snapshot into an initialized instance, returns false if the snapshot doesn't match
+extern bool mz800_load_snapshot(mz800_t* sys, const void* buf, uint32_t buf_size);
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#ifdef CHIPS_IMPL
+#include <string.h>
+#ifndef CHIPS_ASSERT
+    #include <assert.h>
+    #define CHIPS_ASSERT(c) assert(c)
+#endif
+
+/* the emulator instance running on the current thread */
+static CHIPS_THREAD_LOCAL mz800_t* _mz800_sys;
+
+#define I(a) ((a) | Z80_RD | Z80_IORQ)
+#define O(a) ((a) | Z80_WR | Z80_IORQ)
+
+// Memory layout
+// Memory in the ranges 0x2000-0x7fff, 0xc000-0xdfff are always DRAM
+// The memory bank values below can be used directly as bit mask for Z80 pins.
+// | I/O        | 0x0000 | 0x1000 | 0x8000 | 0xe000 |
+// | Address    | 0x0fff | 0x1fff | 0xbfff | 0xffff |
+const uint32_t mz800_mem_banks[9] = {
+    I(0xe0), // | x      | CGROM  | VRAM   | x      |
+    I(0xe1), // | x      | DRAM   | DRAM   | x      |
+    O(0xe0), // | DRAM   | DRAM   | x      | x      |
+    O(0xe1), // | x      | x      | x      | DRAM   |
+    O(0xe2), // | ROM    | x      | x      | x      |
+    O(0xe3), // | x      | x      | x      | ROM    |
+    O(0xe4), // | ROM    | CGROM  | VRAM   | ROM    |
+    O(0xe5), // | x      | x      | x      | PROHIB | // Prohibited
+    O(0xe6)  // | x      | x      | x      | RETURN | // Return to previous state
+};
+#undef I
+#undef O
+
+// the switchable ROM banks (see mz800_t.rom_mapped)
+#define _MZ800_ROM_ROM1  (1<<0)     // ROM1 instead of DRAM0 at 0x0000-0x0fff
+#define _MZ800_ROM_CGROM (1<<1)     // CGROM instead of DRAM1 at 0x1000-0x1fff
+#define _MZ800_ROM_ROM2  (1<<2)     // ROM2 instead of DRAM5 at 0xe000-0xffff
+
+/// Colors - the MZ-800 has 16 fixed colors, see gdg_whid65040_032_colors.
+
+// MARK: - Function declarations
+
+void mz800_init_memory_mapping(mz800_t* sys);
+void mz800_update_memory_mapping(mz800_t* sys, uint64_t pins);
+uint64_t mz800_cpu_tick(int num_ticks, uint64_t pins);
+uint64_t mz800_cpu_iorq(mz800_t* sys, uint64_t pins);
+
+// MARK: - MZ-800 specific functions
+
+void mz800_init(mz800_t* sys, const mz800_desc_t* desc) {
+    CHIPS_ASSERT(sys && desc && desc->rgba8_buffer);
+    CHIPS_ASSERT(desc->rgba8_buffer_size >= (MZ800_DISP_WIDTH*MZ800_DISP_HEIGHT*sizeof(uint32_t)));
+    memset(sys, 0, sizeof(mz800_t));
+    _mz800_sys = sys;
+    sys->rgba8_buffer = desc->rgba8_buffer;
+    sys->rgba8_buffer_size = desc->rgba8_buffer_size;
+    sys->tick_count = 0;
+    
+    mz800_init_memory_mapping(sys);
+    gdg_whid65040_032_init(&sys->gdg);
+    z80_init(&sys->cpu, mz800_cpu_tick);
+    
+    /* CPU start address */
+    sys->cpu.state.PC = 0x2000;
+}
+
+/**
+ Run the MZ-800 emulation for at least the given number of ticks.
+ */
+uint32_t mz800_exec(mz800_t* sys, uint32_t ticks) {
+    _mz800_sys = sys;
+    return z80_exec(&sys->cpu, ticks);
+}
+
+/**
+ Map the memory banks selected by vram_mapped and rom_mapped.
+ */
+static void _mz800_apply_memory_mapping(mz800_t* sys) {
+    if (sys->rom_mapped & _MZ800_ROM_ROM1) {
+        mem_map_rom(&sys->mem, 0, 0x0000, 0x1000, sys->rom1);
+    } else {
+        mem_map_ram(&sys->mem, 0, 0x0000, 0x1000, sys->dram0);
+    }
+    if (sys->rom_mapped & _MZ800_ROM_CGROM) {
+        mem_map_rom(&sys->mem, 0, 0x1000, 0x1000, sys->cgrom);
+    } else {
+        mem_map_ram(&sys->mem, 0, 0x1000, 0x1000, sys->dram1);
+    }
+    mem_map_ram(&sys->mem, 0, 0x2000, 0x6000, sys->dram2);
+    mem_map_ram(&sys->mem, 0, 0x8000, 0x4000, sys->vram_mapped ? sys->vram : sys->dram3);
+    mem_map_ram(&sys->mem, 0, 0xc000, 0x2000, sys->dram4);
+    if (sys->rom_mapped & _MZ800_ROM_ROM2) {
+        mem_map_rom(&sys->mem, 0, 0xe000, 0x2000, sys->rom2);
+    } else {
+        mem_map_ram(&sys->mem, 0, 0xe000, 0x2000, sys->dram5);
+    }
+}
+
+/**
+ Setup the initial memory mapping with ROM1 and ROM2, the rest is DRAM.
+ */
+void mz800_init_memory_mapping(mz800_t* sys) {
+    // TODO: check if the initial setting is correct.
+    // 'load' custom program, copy it so that instances don't share writable memory
+    CHIPS_ASSERT(sizeof(dump_mz800_dram2) <= sizeof(sys->dram2));
+    memcpy(sys->dram2, dump_mz800_dram2, sizeof(dump_mz800_dram2));
+    sys->vram_mapped = false;
+    sys->rom_mapped = _MZ800_ROM_ROM1 | _MZ800_ROM_ROM2;
+    _mz800_apply_memory_mapping(sys);
+}
+
+/**
+ Updates the memory mapping for the bank switch IO requests.
+
+ @param pins Z80 pins with IO request for bank switching.
+ */
+void mz800_update_memory_mapping(mz800_t* sys, uint64_t pins) {
+    uint64_t pins_to_check = pins & (Z80_RD | Z80_WR | Z80_IORQ | 0xff);
+    if (pins_to_check == mz800_mem_banks[0]) {
+        sys->rom_mapped |= _MZ800_ROM_CGROM;
+        sys->vram_mapped = true;
+    } else if (pins_to_check == mz800_mem_banks[1]) {
+        sys->rom_mapped &= ~_MZ800_ROM_CGROM;
+        sys->vram_mapped = false;
+    } else if (pins_to_check == mz800_mem_banks[2]) {
+        sys->rom_mapped &= ~(_MZ800_ROM_ROM1 | _MZ800_ROM_CGROM);
+    } else if (pins_to_check == mz800_mem_banks[3]) {
+        sys->rom_mapped &= ~_MZ800_ROM_ROM2;
+    } else if (pins_to_check == mz800_mem_banks[4]) {
+        sys->rom_mapped |= _MZ800_ROM_ROM1;
+    } else if (pins_to_check == mz800_mem_banks[5]) {
+        sys->rom_mapped |= _MZ800_ROM_ROM2;
+    } else if (pins_to_check == mz800_mem_banks[6]) {
+        sys->rom_mapped |= _MZ800_ROM_ROM1 | _MZ800_ROM_CGROM | _MZ800_ROM_ROM2;
+        sys->vram_mapped = true;
+    } else {
+        // PROHIBIT and RETURN not implemented
+        return;
+    }
+    _mz800_apply_memory_mapping(sys);
+}
+
+uint64_t mz800_cpu_tick(int num_ticks, uint64_t pins) {
+    mz800_t* sys = _mz800_sys;
+    uint64_t out_pins = pins;
+    
+    // TODO: interrupt acknowledge
+    
+    // Memory request
+    if (pins & Z80_MREQ) {
+        const uint16_t addr = Z80_GET_ADDR(pins);
+        if (pins & Z80_RD) {
+            Z80_SET_DATA(out_pins, mem_rd(&sys->mem, addr));
+        }
+        else if (pins & Z80_WR) {
+            mem_wr(&sys->mem, addr, Z80_GET_DATA(pins));
+            if (sys->vram_mapped && (addr >= 0x8000) && (addr < 0xc000)) {
+                gdg_whid65040_032_vram_write(&sys->gdg, addr - 0x8000);
+            }
+        }
+    }
+    
+    // IO request
+    if ((pins & Z80_IORQ) && (pins & (Z80_RD|Z80_WR))) {
+        out_pins = mz800_cpu_iorq(sys, pins);
+    }
+    
+    // video beam, decode the display line which the beam just left (only if it is dirty)
+    sys->scanline_ticks += num_ticks;
+    if (sys->scanline_ticks >= MZ800_SCANLINE_TICKS) {
+        sys->scanline_ticks -= MZ800_SCANLINE_TICKS;
+        const int y = (int)sys->scanline - MZ800_DISP_FIRST_LINE;
+        if ((y >= 0) && (y < MZ800_DISP_HEIGHT)) {
+            gdg_whid65040_032_decode_line(&sys->gdg, y, sys->vram, sys->rgba8_buffer + y * MZ800_DISP_WIDTH);
+        }
+        if (++sys->scanline >= MZ800_SCANLINES) {
+            sys->scanline = 0;
+        }
+    }
+
+    return out_pins;
+}
+
+#define IN_RANGE(A,B,C) (((A)>=(B))&&((A)<=(C)))
+
+uint64_t mz800_cpu_iorq(mz800_t* sys, uint64_t pins) {
+    uint16_t address = Z80_GET_ADDR(pins) & 0xff; // check only the lower byte of the address
+    
+    // Serial I/O
+    if (IN_RANGE(address, 0xb0, 0xb3)) {
+        // TODO: not implemented
+    }
+    // GDG WHID 65040-032, CRT controller
+    else if (IN_RANGE(address, 0xcc, 0xcf)) {
+        gdg_whid65040_032_iorq(&sys->gdg, pins);
+    }
+    // PPI i8255, keyboard and cassette driver
+    else if (IN_RANGE(address, 0xd0, 0xd3)) {
+        // TODO: not implemented
+    }
+    // CTC i8253, programmable counter/timer
+    else if (IN_RANGE(address, 0xd4, 0xd7)) {
+        // TODO: not implemented
+    }
+    // FDC, floppy disc controller
+    else if (IN_RANGE(address, 0xd8, 0xdf)) {
+        // TODO: not implemented
+    }
+    // GDG WHID 65040-032, Memory bank switch
+    else if (IN_RANGE(address, 0xe0, 0xe6)) {
+        // Currently this isn't supported by the GDG emulation,
+        // so we do the bank switch directly here.
+        mz800_update_memory_mapping(sys, pins);
+    }
+    // GDG WHID 65040-032, palette register (write only)
+    else if ((address == 0xf0) && (pins & Z80_WR)) {
+        gdg_whid65040_032_iorq(&sys->gdg, pins);
+    }
+    // Joystick
+    else if (IN_RANGE(address, 0xf0, 0xf1)) {
+        // TODO: not implemented
+    }
+    // PSG SN 76489 AN, sound generator
+    else if (address == 0xf2) {
+        // TODO: not implemented
+    }
+    // QDC, quick disk controller
+    else if (IN_RANGE(address, 0xf4, 0xf7)) {
+        // TODO: not implemented
+    }
+    // PIO Z80 PIO, parallel I/O unit
+    else if (IN_RANGE(address, 0xfc, 0xff)) {
+        // TODO: not implemented
+    }
+    // DEBUG
+    else {
+        CHIPS_ASSERT(1);
+    }
+    
+    return pins;
+}
+#undef IN_RANGE
+
+#define MZ800_SNAPSHOT_ID SNAPSHOT_FOURCC('M','Z','8','0')
+
+uint32_t mz800_snapshot_size(void) {
+    return snapshot_size(sizeof(mz800_t));
+}
+
+uint32_t mz800_save_snapshot(const mz800_t* sys, void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    return snapshot_save(buf, buf_size, MZ800_SNAPSHOT_ID, sys, sizeof(mz800_t));
+}
+
+bool mz800_load_snapshot(mz800_t* sys, const void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    // keep the instance's own framebuffer, restore the CPU callback and rebuild the memory mapping
+    uint32_t* rgba8_buffer = sys->rgba8_buffer;
+    const uint32_t rgba8_buffer_size = sys->rgba8_buffer_size;
+    if (!snapshot_load(buf, buf_size, MZ800_SNAPSHOT_ID, sys, sizeof(mz800_t))) {
+        return false;
+    }
+    sys->rgba8_buffer = rgba8_buffer;
+    sys->rgba8_buffer_size = rgba8_buffer_size;
+    sys->cpu.tick = mz800_cpu_tick;
+    _mz800_apply_memory_mapping(sys);
+    // the kept framebuffer doesn't show the restored VRAM, decode all scanlines again
+    gdg_whid65040_032_invalidate(&sys->gdg);
+    return true;
+}
+
+#endif /* CHIPS_IMPL */
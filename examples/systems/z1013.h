@@ -0,0 +1,478 @@
+#pragma once
+/*
+    z1013.h
+
+    Z1013 emulator core without any platform dependencies,
+    used by the z1013 example and the headless chips-bench.
+
+    The Z1013 was a very simple East German home computer, basically
+    just a Z80 CPU connected to some memory, and a PIO connected to
+    a keyboard matrix. It's easy to emulate because the system didn't
+    use any interrupts, and only simple PIO IN/OUT is required to
+    scan the keyboard matrix.
+
+    It had a 32x32 monochrome ASCII framebuffer starting at EC00,
+    and a 2 KByte operating system ROM starting at F000.
+
+    No cassette-tape / beeper sound emulated!
+
+    I have added a pre-loaded KC-BASIC interpreter:
+
+    Start the BASIC interpreter with 'J 300', return to OS with 'BYE'.
+
+    Enter BASIC editing mode with 'AUTO', leave by pressing Esc.
+
+    Idle loop skipping: when the CPU sits in the operating system's
+    keyboard polling loop (INCH and INKEY at F119..F255) waiting for
+    a key, z1013_exec() doesn't simulate each loop iteration. Once the
+    complete machine state (CPU, PIO, keyboard latches and memory)
+    repeats at the same PC, the loop can only repeat identically until
+    the end of the z1013_exec() call (the keyboard matrix only changes
+    between calls), so the remaining whole loop iterations are skipped
+    and only the R register is advanced. This isn't observable, except
+    for the idle_ticks counter. The PC range is configurable in the
+    z1013_desc_t struct.
+
+    Do this:
+        #define CHIPS_IMPL
+    before you include this file in *one* C file to create the
+    implementation.
+*/
+#include "chips/z80.h"
+#include "chips/z80pio.h"
+#include "chips/kbd.h"
+#include "common/thread.h"
+#include "common/snapshot.h"
+#include "common/glyphcache.h"
+#include "roms/z1013-roms.h"
+
+#define Z1013_FREQ (2000000)
+#define Z1013_DISP_WIDTH (256)
+#define Z1013_DISP_HEIGHT (256)
+#define Z1013_GLYPH_CACHE_SLOTS (1)    /* the Z1013 is black and white */
+#define Z1013_IDLE_PC_MIN (0xF119)      /* default idle loop range, INKEY ... */
+#define Z1013_IDLE_PC_MAX (0xF255)      /* ... to the end of INCH */
+#define Z1013_IDLE_MAX_STEPS (4096)     /* max instructions to look for a repeating state */
+
+/* Z1013 emulator state */
+typedef struct {
+    z80_t cpu;
+    z80pio_t pio;
+    kbd_t kbd;
+    uint8_t kbd_request_column;
+    bool kbd_request_line_hilo;
+    uint32_t* rgba8_buffer;     /* decoded video output */
+    uint32_t rgba8_buffer_size;
+    /* idle loop skipping */
+    bool idle_skip;
+    uint16_t idle_pc_min, idle_pc_max;
+    uint32_t mem_gen;               /* incremented when a memory write changes a byte */
+    uint64_t idle_ticks;            /* number of skipped ticks */
+    uint8_t mem[1<<16];
+    /* video decoding only redraws character cells which have changed */
+    bool vid_dirty_all;             /* redraw all cells on next decode */
+    bool skip_video;                /* don't decode video memory (warp mode) */
+    uint32_t vid_cells_redrawn;     /* number of cells redrawn by the last decode */
+    uint64_t vid_dirty[16];         /* one dirty bit per video RAM cell */
+    /* pre-rasterized character tiles, must be last, not part of snapshots */
+    glyph_cache_t glyph_cache;
+    glyph_slot_t glyph_slots[Z1013_GLYPH_CACHE_SLOTS];
+} z1013_t;
+
+/* a copy of the video state at the end of a frame, so that it can be decoded
+   while the emulator already runs the next frame (see z1013_capture_video())
+*/
+typedef struct {
+    uint64_t dirty[16];             /* the character cells to redraw */
+    uint32_t cells_redrawn;         /* output of z1013_decode_video() */
+    uint8_t vidmem[0x400];          /* copy of the 32x32 framebuffer at EC00 */
+} z1013_video_frame_t;
+
+/* Z1013 emulator setup parameters */
+typedef struct {
+    uint32_t* rgba8_buffer;         /* the framebuffer for the decoded video output */
+    uint32_t rgba8_buffer_size;     /* size of the framebuffer in bytes */
+    bool disable_idle_skip;         /* simulate the keyboard polling loop cycle by cycle */
+    uint16_t idle_pc_min;           /* idle loop PC range (default: Z1013_IDLE_PC_MIN/MAX) */
+    uint16_t idle_pc_max;
+} z1013_desc_t;
+
+/* initialize a Z1013 emulator instance */
+extern void z1013_init(z1013_t* sys, const z1013_desc_t* desc);
+/* run an emulator instance for at least the given number of ticks, returns executed ticks */
+extern uint32_t z1013_exec(z1013_t* sys, uint32_t ticks);
+/* size of a Z1013 snapshot in bytes */
+extern uint32_t z1013_snapshot_size(void);
+/* save a snapshot of an instance into buf, returns number of bytes written (0 if buf is too small) */
+extern uint32_t z1013_save_snapshot(const z1013_t* sys, void* buf, uint32_t buf_size);
+/* restore a snapshot into an initialized instance, returns false if the snapshot doesn't match */
+extern bool z1013_load_snapshot(z1013_t* sys, const void* buf, uint32_t buf_size);
+/* copy the video state for z1013_decode_video() and clear the dirty cells (use with skip_video) */
+extern void z1013_capture_video(z1013_t* sys, z1013_video_frame_t* frame);
+/* decode a captured frame into a framebuffer which is only written by this function,
+   can run on another thread while z1013_exec() runs (it only uses the glyph cache of sys)
+*/
+extern void z1013_decode_video(z1013_t* sys, z1013_video_frame_t* frame, uint32_t* dst);
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#ifdef CHIPS_IMPL
+#include <string.h>
+#include <stddef.h> /* offsetof */
+#ifndef CHIPS_ASSERT
+    #include <assert.h>
+    #define CHIPS_ASSERT(c) assert(c)
+#endif
+
+/* the emulator instance running on the current thread */
+static CHIPS_THREAD_LOCAL z1013_t* _z1013_sys;
+
+uint64_t z1013_tick(int num, uint64_t pins);
+uint8_t z1013_pio_in(int port_id);
+void z1013_pio_out(int port_id, uint8_t data);
+void z1013_decode_vidmem(z1013_t* sys);
+
+/* mark a character cell as dirty after a write to the video RAM */
+static inline void _z1013_vid_dirty(z1013_t* sys, uint16_t addr) {
+    const uint16_t cell = addr & 0x3FF;
+    sys->vid_dirty[cell >> 6] |= 1ULL << (cell & 63);
+}
+
+/* Z1013 emulator initialization */
+void z1013_init(z1013_t* sys, const z1013_desc_t* desc) {
+    CHIPS_ASSERT(sys && desc && desc->rgba8_buffer);
+    CHIPS_ASSERT(desc->rgba8_buffer_size >= (Z1013_DISP_WIDTH*Z1013_DISP_HEIGHT*sizeof(uint32_t)));
+    memset(sys, 0, sizeof(z1013_t));
+    _z1013_sys = sys;
+    sys->rgba8_buffer = desc->rgba8_buffer;
+    sys->rgba8_buffer_size = desc->rgba8_buffer_size;
+    sys->idle_skip = !desc->disable_idle_skip;
+    if (desc->idle_pc_min || desc->idle_pc_max) {
+        sys->idle_pc_min = desc->idle_pc_min;
+        sys->idle_pc_max = desc->idle_pc_max;
+    }
+    else {
+        sys->idle_pc_min = Z1013_IDLE_PC_MIN;
+        sys->idle_pc_max = Z1013_IDLE_PC_MAX;
+    }
+    glyph_cache_init(&sys->glyph_cache, sys->glyph_slots, Z1013_GLYPH_CACHE_SLOTS);
+
+    /* initialize the Z80 CPU and PIO */
+    z80_init(&sys->cpu, z1013_tick);
+    z80pio_init(&sys->pio, z1013_pio_in, z1013_pio_out);
+
+    /* setup the 8x8 keyboard matrix (see http://www.z1013.de/images/21.gif)
+       keep keys pressed for at least 2 frames to give the
+       Z1013 enough time to scan the keyboard
+    */
+    kbd_init(&sys->kbd, 2);
+    /* shift key is column 7, line 6 */
+    const int shift = 0, shift_mask = (1<<shift);
+    kbd_register_modifier(&sys->kbd, shift, 7, 6);
+    /* ctrl key is column 6, line 5 */
+    const int ctrl = 1, ctrl_mask = (1<<ctrl);
+    kbd_register_modifier(&sys->kbd, ctrl, 6, 5);
+    /* alpha-numeric keys */
+    const char* keymap =
+        /* unshifted keys */
+        "13579-  QETUO@  ADGJL*  YCBM.^  24680[  WRZIP]  SFHK+\\  XVN,/_  "
+        /* shift layer */
+        "!#%')=  qetuo`  adgjl:  ycbm>~  \"$&( {  wrzip}  sfhk;|  xvn<?   ";
+    for (int layer = 0; layer < 2; layer++) {
+        for (int line = 0; line < 8; line++) {
+            for (int col = 0; col < 8; col++) {
+                int c = keymap[layer*64 + line*8 + col];
+                if (c != 0x20) {
+                    kbd_register_key(&sys->kbd, c, col, line, layer?shift_mask:0);
+                }
+            }
+        }
+    }
+    /* special keys */
+    kbd_register_key(&sys->kbd, ' ',  6, 4, 0);  /* space */
+    kbd_register_key(&sys->kbd, 0x08, 6, 2, 0);  /* cursor left */
+    kbd_register_key(&sys->kbd, 0x09, 6, 3, 0);  /* cursor right */
+    kbd_register_key(&sys->kbd, 0x0A, 6, 7, 0);  /* cursor down */
+    kbd_register_key(&sys->kbd, 0x0B, 6, 6, 0);  /* cursor up */
+    kbd_register_key(&sys->kbd, 0x0D, 6, 1, 0);  /* enter */
+    kbd_register_key(&sys->kbd, 0x03, 1, 3, ctrl_mask); /* map Esc to Ctrl+C (STOP/BREAK) */
+
+    /* 2 KByte system rom starting at 0xF000 */
+    CHIPS_ASSERT(sizeof(dump_z1013_mon_a2) == 2048);
+    memcpy(&sys->mem[0xF000], dump_z1013_mon_a2, sizeof(dump_z1013_mon_a2));
+
+    /* copy BASIC interpreter to 0x0100, skip first 0x20 bytes .z80 file format header */
+    CHIPS_ASSERT(0x0100 + sizeof(dump_kc_basic) < 0xF000);
+    memcpy(&sys->mem[0x0100], dump_kc_basic+0x20, sizeof(dump_kc_basic)-0x20);
+
+    /* execution starts at 0xF000 */
+    sys->cpu.state.PC = 0xF000;
+    sys->vid_dirty_all = true;
+}
+
+static inline bool _z1013_in_idle_range(const z1013_t* sys) {
+    const uint16_t pc = sys->cpu.state.PC;
+    return (pc >= sys->idle_pc_min) && (pc <= sys->idle_pc_max);
+}
+
+/* Step through the idle loop instruction by instruction until the machine
+   state at the start PC repeats, then skip the remaining whole loop
+   iterations that fit into the tick budget. Returns the number of
+   executed (and skipped) ticks, which is less than the budget.
+*/
+static uint32_t _z1013_idle_forward(z1013_t* sys, uint32_t ticks) {
+    z80_t cpu0;
+    z80pio_t pio0;
+    memcpy(&cpu0, &sys->cpu, sizeof(cpu0));
+    memcpy(&pio0, &sys->pio, sizeof(pio0));
+    const uint32_t mem_gen0 = sys->mem_gen;
+    const uint8_t column0 = sys->kbd_request_column;
+    const bool line_hilo0 = sys->kbd_request_line_hilo;
+    uint32_t ticks_executed = 0;
+    for (int step = 0; step < Z1013_IDLE_MAX_STEPS; step++) {
+        ticks_executed += z80_exec(&sys->cpu, 0);
+        if ((ticks_executed >= ticks/2) || !_z1013_in_idle_range(sys) || (sys->mem_gen != mem_gen0)) {
+            /* not an idle loop, or no room to skip anything */
+            break;
+        }
+        if (sys->cpu.state.PC == cpu0.state.PC) {
+            /* compare the complete state except the R register, which counts opcode fetches */
+            z80_t cpu;
+            memcpy(&cpu, &sys->cpu, sizeof(cpu));
+            cpu.state.R = (cpu.state.R & 0x80) | (cpu0.state.R & 0x7F);
+            if ((0 == memcmp(&cpu, &cpu0, sizeof(cpu))) &&
+                (0 == memcmp(&sys->pio, &pio0, sizeof(pio0))) &&
+                (sys->kbd_request_column == column0) &&
+                (sys->kbd_request_line_hilo == line_hilo0))
+            {
+                const uint32_t period = ticks_executed;
+                const uint32_t num_loops = (ticks - ticks_executed) / period;
+                const uint32_t r_inc = (uint32_t)((sys->cpu.state.R - cpu0.state.R) & 0x7F);
+                sys->cpu.state.R = (sys->cpu.state.R & 0x80) | ((sys->cpu.state.R + num_loops * r_inc) & 0x7F);
+                ticks_executed += num_loops * period;
+                sys->idle_ticks += num_loops * period;
+                break;
+            }
+        }
+    }
+    return ticks_executed;
+}
+
+/* run the Z1013 emulation for at least the given number of ticks, and
+   decode the video memory into the framebuffer
+*/
+uint32_t z1013_exec(z1013_t* sys, uint32_t ticks) {
+    _z1013_sys = sys;
+    uint32_t ticks_executed = 0;
+    if (sys->idle_skip && _z1013_in_idle_range(sys)) {
+        ticks_executed = _z1013_idle_forward(sys, ticks);
+    }
+    if ((0 == ticks_executed) || (ticks_executed < ticks)) {
+        ticks_executed += z80_exec(&sys->cpu, ticks - ticks_executed);
+    }
+    if (!sys->skip_video) {
+        z1013_decode_vidmem(sys);
+    }
+    return ticks_executed;
+}
+
+/* the CPU tick function needs to perform memory and I/O reads/writes */
+uint64_t z1013_tick(int num_ticks, uint64_t pins) {
+    z1013_t* sys = _z1013_sys;
+    if (pins & Z80_MREQ) {
+        /* a memory request */
+        const uint16_t addr = Z80_GET_ADDR(pins);
+        if (pins & Z80_RD) {
+            /* read memory byte */
+            Z80_SET_DATA(pins, sys->mem[addr]);
+        }
+        else if (pins & Z80_WR) {
+            /* write memory byte, don't overwrite ROM */
+            const uint8_t data = Z80_GET_DATA(pins);
+            if ((addr < 0xF000) && (sys->mem[addr] != data)) {
+                sys->mem[addr] = data;
+                sys->mem_gen++;
+                if (addr >= 0xEC00) {
+                    /* video RAM at EC00 */
+                    _z1013_vid_dirty(sys, addr);
+                }
+            }
+        }
+    }
+    else if (pins & Z80_IORQ) {
+        /* an I/O request */
+        /*
+            The PIO Chip-Enable pin (Z80PIO_CE) is connected to output pin 0 of
+            a MH7442 BCD-to-Decimal decoder (looks like this is a Czech
+            clone of a SN7442). The lower 3 input pins of the MH7442
+            are connected to address bus pins A2..A4, and the 4th input
+            pin is connected to IORQ. This means the PIO is enabled when
+            the CPU IORQ pin is low (active), and address bus bits 2..4 are
+            off. This puts the PIO at the lowest 4 addresses of an 32-entry
+            address space (so the PIO should be visible at port number
+            0..4, but also at 32..35, 64..67 and so on).
+
+            The PIO Control/Data select pin (Z80PIO_CDSEL) is connected to
+            address bus pin A0. This means even addresses select a PIO data
+            operation, and odd addresses select a PIO control operation.
+
+            The PIO port A/B select pin (Z80PIO_BASEL) is connected to address
+            bus pin A1. This means the lower 2 port numbers address the PIO
+            port A, and the upper 2 port numbers address the PIO port B.
+
+            The keyboard matrix columns are connected to another MH7442
+            BCD-to-Decimal converter, this converts a hardware latch at port
+            address 8 which stores a keyboard matrix column number from the CPU
+            to the column lines. The operating system scans the keyboard by
+            writing the numbers 0..7 to this latch, which is then converted
+            by the MH7442 to light up the keyboard matrix column lines
+            in that order. Next the CPU reads back the keyboard matrix lines
+            in 2 steps of 4 bits each from PIO port B.
+        */
+        if ((pins & (Z80_A4|Z80_A3|Z80_A2)) == 0) {
+            /* address bits A2..A4 are zero, this activates the PIO chip-select pin */
+            uint64_t pio_pins = (pins & Z80_PIN_MASK) | Z80PIO_CE;
+            /* address bit 0 selects data/ctrl */
+            if (pio_pins & (1<<0)) pio_pins |= Z80PIO_CDSEL;
+            /* address bit 1 selects port A/B */
+            if (pio_pins & (1<<1)) pio_pins |= Z80PIO_BASEL;
+            pins = z80pio_iorq(&sys->pio, pio_pins) & Z80_PIN_MASK;
+        }
+        else if ((pins & (Z80_A3|Z80_WR)) == (Z80_A3|Z80_WR)) {
+            /* port 8 is connected to a hardware latch to store the
+               requested keyboard column for the next keyboard scan
+            */
+            sys->kbd_request_column = Z80_GET_DATA(pins);
+        }
+    }
+    /* there are no interrupts happening in a vanilla Z1013,
+       so don't trigger the interrupt daisy chain
+    */
+    return pins;
+}
+
+/* PIO input callback, scan the upper or lower 4 lines of the keyboard matrix */
+uint8_t z1013_pio_in(int port_id) {
+    z1013_t* sys = _z1013_sys;
+    uint8_t data = 0;
+    if (Z80PIO_PORT_A == port_id) {
+        /* PIO port A is reserved for user devices */
+        data = 0xFF;
+    }
+    else {
+        /* port B is for cassette input (bit 7), and lower 4 bits for kbd matrix lines */
+        uint16_t column_mask = (1<<sys->kbd_request_column);
+        uint16_t line_mask = kbd_test_lines(&sys->kbd, column_mask);
+        if (sys->kbd_request_line_hilo) {
+            line_mask >>= 4;
+        }
+        data = 0xF & ~(line_mask & 0xF);
+    }
+    return data;
+}
+
+/* the PIO output callback selects the upper or lower 4 lines for the next keyboard scan */
+void z1013_pio_out(int port_id, uint8_t data) {
+    z1013_t* sys = _z1013_sys;
+    if (Z80PIO_PORT_B == port_id) {
+        /* bit 4 for 8x8 keyboard selects upper or lower 4 kbd matrix line bits */
+        sys->kbd_request_line_hilo = 0 != (data & (1<<4));
+        /* bit 7 is cassette output, not emulated */
+    }
+}
+
+/* decode a single character cell into the RGBA8 buffer */
+static void _z1013_decode_cell(z1013_t* sys, const z1013_video_frame_t* frame, uint32_t* fb, int offset) {
+    const int x = offset & 31;
+    const int y = offset >> 5;
+    uint32_t* dst = &fb[(y * 8 * Z1013_DISP_WIDTH) + (x * 8)];
+    const uint8_t chr = frame->vidmem[offset];
+    const uint32_t* tile = glyph_cache_tile(&sys->glyph_cache, sys->glyph_slots, dump_z1013_font, chr, 0xFFFFFFFF, 0xFF000000);
+    for (int py = 0; py < 8; py++) {
+        memcpy(dst, tile, 8 * sizeof(uint32_t));
+        tile += 8;
+        dst += Z1013_DISP_WIDTH;
+    }
+}
+
+/* capture the video state of the current frame: the character cells which
+   have been written since the last capture, and a copy of the video RAM
+*/
+void z1013_capture_video(z1013_t* sys, z1013_video_frame_t* frame) {
+    if (sys->vid_dirty_all) {
+        memset(frame->dirty, 0xFF, sizeof(frame->dirty));
+    }
+    else {
+        memcpy(frame->dirty, sys->vid_dirty, sizeof(frame->dirty));
+    }
+    memcpy(frame->vidmem, &sys->mem[0xEC00], sizeof(frame->vidmem));  /* the 32x32 framebuffer starts at EC00 */
+    memset(sys->vid_dirty, 0, sizeof(sys->vid_dirty));
+    sys->vid_dirty_all = false;
+}
+
+/* decode a captured Z1013 32x32 ASCII framebuffer to a linear 256x256 RGBA8 buffer */
+void z1013_decode_video(z1013_t* sys, z1013_video_frame_t* frame, uint32_t* dst) {
+    int redrawn = 0;
+    for (int w = 0; w < 16; w++) {
+        const uint64_t bits = frame->dirty[w];
+        if (bits) {
+            for (int b = 0; b < 64; b++) {
+                if (bits & (1ULL << b)) {
+                    _z1013_decode_cell(sys, frame, dst, (w << 6) | b);
+                    redrawn++;
+                }
+            }
+        }
+    }
+    frame->cells_redrawn = redrawn;
+}
+
+/* decode the video memory into the emulator's framebuffer, only character
+   cells which have been written since the last decode are redrawn
+*/
+void z1013_decode_vidmem(z1013_t* sys) {
+    z1013_video_frame_t frame;
+    z1013_capture_video(sys, &frame);
+    z1013_decode_video(sys, &frame, sys->rgba8_buffer);
+    sys->vid_cells_redrawn = frame.cells_redrawn;
+}
+
+#define Z1013_SNAPSHOT_ID SNAPSHOT_FOURCC('Z','1','0','1')
+/* the glyph cache at the end of the struct isn't part of the snapshot */
+#define _Z1013_SNAPSHOT_STATE_SIZE ((uint32_t)offsetof(z1013_t, glyph_cache))
+
+uint32_t z1013_snapshot_size(void) {
+    return snapshot_size(_Z1013_SNAPSHOT_STATE_SIZE);
+}
+
+uint32_t z1013_save_snapshot(const z1013_t* sys, void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    return snapshot_save(buf, buf_size, Z1013_SNAPSHOT_ID, sys, _Z1013_SNAPSHOT_STATE_SIZE);
+}
+
+bool z1013_load_snapshot(z1013_t* sys, const void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    uint32_t* rgba8_buffer = sys->rgba8_buffer;
+    const uint32_t rgba8_buffer_size = sys->rgba8_buffer_size;
+    const bool idle_skip = sys->idle_skip;
+    const uint16_t idle_pc_min = sys->idle_pc_min;
+    const uint16_t idle_pc_max = sys->idle_pc_max;
+    if (!snapshot_load(buf, buf_size, Z1013_SNAPSHOT_ID, sys, _Z1013_SNAPSHOT_STATE_SIZE)) {
+        return false;
+    }
+    /* keep the instance's own framebuffer and restore the chip callbacks */
+    sys->rgba8_buffer = rgba8_buffer;
+    sys->rgba8_buffer_size = rgba8_buffer_size;
+    sys->cpu.tick = z1013_tick;
+    sys->pio.in_cb = z1013_pio_in;
+    sys->pio.out_cb = z1013_pio_out;
+    /* keep the instance's own idle loop configuration */
+    sys->idle_skip = idle_skip;
+    sys->idle_pc_min = idle_pc_min;
+    sys->idle_pc_max = idle_pc_max;
+    /* the framebuffer and glyph cache aren't part of the snapshot */
+    sys->vid_dirty_all = true;
+    glyph_cache_reset(&sys->glyph_cache, sys->glyph_slots);
+    return true;
+}
+
+#endif /* CHIPS_IMPL */
@@ -0,0 +1,1055 @@
+#pragma once
+/*
+    zx128k.h
+
+    ZX Spectrum 128 emulator core without any platform dependencies,
+    used by the zx128k example and the headless chips-bench.
+
+    - the beeper and AY-3-8192 are mixed into a single audio_cb output
+    - contended memory and IO wait states are injected per memory or IO
+      machine cycle (not per T-state), using the 128K contention pattern
+    - video decoding works with scanline accuracy, not cycle accuracy
+    - no tape or disc emulation, programs are loaded directly into memory
+      from .sna and .z80 snapshot files (zx_quickload_sna/z80())
+
+    Do this:
+        #define CHIPS_IMPL
+    before you include this file in *one* C file to create the
+    implementation.
+*/
+#include "chips/z80.h"
+#include "chips/beeper.h"
+#include "chips/ay38910.h"
+#include "chips/mem.h"
+#include "chips/kbd.h"
+#include "common/thread.h"
+#include "common/snapshot.h"
+#include "common/clone.h"
+#include "common/pcprof.h"
+#include "common/sched.h"
+#include "roms/zx128k-roms.h"
+
+#define ZX128K_FREQ (3546894)
+#define ZX128K_DISP_WIDTH (320)
+#define ZX128K_DISP_HEIGHT (256)
+#define ZX128K_SCANLINES (311)
+#define ZX128K_TOP_BORDER_SCANLINES (63)
+#define ZX128K_SCANLINE_PERIOD (228)
+#define ZX128K_FRAME_TICKS (ZX128K_SCANLINES * ZX128K_SCANLINE_PERIOD)    /* 50.02 Hz, the vblank interrupt period */
+#define ZX128K_CONTENTION_START (14361)     /* frame tick of the first contended T-state on the 128K */
+/* 8-bit indexed video output: 8 colors at normal brightness, then 8 bright colors */
+#define ZX128K_PAL8_NUM_COLORS (16)
+
+#define ZX128K_MAX_AUDIO_SAMPLES (1024)        /* max number of audio samples in the internal sample buffer */
+#define ZX128K_DEFAULT_AUDIO_SAMPLES (128)     /* default number of samples per audio callback */
+
+/* scheduled events (see zx128k_t.sched) */
+enum {
+    ZX128K_EVENT_SCANLINE = 0,  /* decode the next scanline, and request the vblank interrupt */
+};
+
+/* audio output callback, invoked with a batch of mono samples */
+typedef void (*zx_audio_callback_t)(const float* samples, int num_samples);
+
+/* ZX Spectrum 128 emulator state */
+typedef struct {
+    z80_t cpu;
+    beeper_t beeper;
+    ay38910_t ay;
+    kbd_t kbd;
+    mem_t mem;
+    bool memory_paging_disabled;
+    bool contention;                // inject contended memory and IO wait states
+    uint32_t tick_count;
+    bool audio_batching;            // defer the beeper and AY ticks until they're accessed or zx_exec() returns
+    uint32_t audio_pending_ticks;   // number of deferred audio ticks
+    uint8_t last_fe_out;            // last out value to 0xFE port */
+    uint8_t blink_counter;          // incremented on each vblank
+    sched_t sched;                  // periodic events, keyed by the emulated tick
+    int scanline_y;
+    uint32_t display_ram_bank;
+    uint32_t upper_ram_bank;        // RAM bank mapped at 0xC000
+    uint32_t rom_bank;              // ROM mapped at 0x0000 (0 or 1)
+    uint32_t border_color;
+    uint8_t border_index;           // border color index (for pal8 output)
+    uint32_t* rgba8_buffer;         // decoded video output
+    uint32_t rgba8_buffer_size;
+    uint8_t* pal8_buffer;           // decoded video output as color indices
+    uint32_t pal8_buffer_size;
+    zx_audio_callback_t audio_cb;     // audio output callback
+    int num_samples;                // number of samples per audio callback
+    int sample_pos;                 // current position in sample_buffer
+    const uint8_t* rom[2];          // 16 KB ROM 0 (128K editor) and ROM 1 (48K BASIC)
+    pcprof_t* prof;                 // optional PC-sampling profiler
+    uint8_t ram[8][0x4000];
+    /* scanline decoding state, so that unchanged lines can be skipped */
+    int vid_redraw_lines;           // number of upcoming lines which must be redrawn
+    bool skip_video;                // don't decode scanlines (warp mode)
+    uint8_t vid_blink;              // blink phase of the last frame
+    uint32_t vid_dirty_rows[6];     // one dirty bit per 256x192 pixel row
+    uint32_t vid_line_border[ZX128K_DISP_HEIGHT];   // border color of each decoded line
+    uint32_t vid_attr_colors[2][256][2];    // attribute byte => fg/bg color per blink phase
+    uint8_t vid_attr_pal8[2][256][2];       // attribute byte => fg/bg color index per blink phase
+    float sample_buffer[ZX128K_MAX_AUDIO_SAMPLES];
+} zx128k_t;
+
+/* ZX Spectrum 128 emulator setup parameters */
+typedef struct {
+    uint32_t* rgba8_buffer;         /* the framebuffer for the decoded video output */
+    uint32_t rgba8_buffer_size;     /* size of the framebuffer in bytes */
+    uint8_t* pal8_buffer;           /* optional 8-bit indexed framebuffer instead of rgba8_buffer */
+    uint32_t pal8_buffer_size;      /* size of the indexed framebuffer in bytes */
+    /* optional audio output, audio_cb is called with batches of audio_num_samples samples */
+    zx_audio_callback_t audio_cb;
+    int audio_num_samples;          /* default is ZX128K_DEFAULT_AUDIO_SAMPLES */
+    int audio_sample_rate;          /* playback sample rate, default is 44100 */
+    /* optional ROM images (e.g. memory-mapped files), default are the embedded dumps */
+    const uint8_t* rom_0;           /* 16 KB ROM 0 */
+    const uint8_t* rom_1;           /* 16 KB ROM 1 */
+    pcprof_t* prof;                 /* optional PC-sampling profiler (see common/pcprof.h) */
+    bool disable_contention;        /* don't inject contended memory and IO wait states */
+    bool disable_audio_batching;    /* tick the beeper and AY together with the CPU */
+} zx_desc_t;
+
+/* initialize a ZX Spectrum 128 emulator instance */
+extern void zx_init(zx128k_t* sys, const zx_desc_t* desc);
+/* run an emulator instance for at least the given number of ticks, returns executed ticks */
+extern uint32_t zx_exec(zx128k_t* sys, uint32_t ticks);
+/* load a .sna snapshot file (48K or 128K) into an initialized instance, returns false if the data isn't a valid .sna */
+extern bool zx_quickload_sna(zx128k_t* sys, const uint8_t* ptr, uint32_t num_bytes);
+/* load a .z80 snapshot file (version 1 to 3, 48K or 128K), returns false if the data isn't a valid .z80 file */
+extern bool zx_quickload_z80(zx128k_t* sys, const uint8_t* ptr, uint32_t num_bytes);
+/* get the RGBA8 colors for the 8-bit indexed video output */
+extern void zx_pal8_colors(uint32_t colors[ZX128K_PAL8_NUM_COLORS]);
+/* size of a ZX Spectrum 128 snapshot in bytes */
+extern uint32_t zx_snapshot_size(void);
+/* save a snapshot of an instance into buf, returns number of bytes written (0 if buf is too small) */
+extern uint32_t zx_save_snapshot(const zx128k_t* sys, void* buf, uint32_t buf_size);
+/* restore a snapshot into an initialized instance, returns false if the snapshot doesn't match */
+extern bool zx_load_snapshot(zx128k_t* sys, const void* buf, uint32_t buf_size);
+/* create a copy-on-write clone base from a snapshot of an instance (see common/clone.h), returns false if the snapshot doesn't match */
+extern bool zx_clone_base(clone_base_t* base, const void* buf, uint32_t buf_size);
+/* map a new instance from a clone base which shares all unwritten pages with the base, returns 0 on failure */
+extern zx128k_t* zx_clone(const clone_base_t* base, uint32_t* rgba8_buffer, uint32_t rgba8_buffer_size);
+/* release a cloned instance */
+extern void zx_free_clone(const clone_base_t* base, zx128k_t* sys);
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#ifdef CHIPS_IMPL
+#include <string.h>
+#ifndef CHIPS_ASSERT
+    #include <assert.h>
+    #define CHIPS_ASSERT(c) assert(c)
+#endif
+
+/* the emulator instance running on the current thread */
+static CHIPS_THREAD_LOCAL zx128k_t* _zx_sys;
+
+uint32_t zx_palette[8] = {
+    0xFF000000,     // black
+    0xFFFF0000,     // blue
+    0xFF0000FF,     // red
+    0xFFFF00FF,     // magenta
+    0xFF00FF00,     // green
+    0xFFFFFF00,     // cyan
+    0xFF00FFFF,     // yellow
+    0xFFFFFFFF,     // white
+};
+
+uint64_t zx_cpu_tick(int num_ticks, uint64_t pins);
+bool zx_decode_scanline(zx128k_t* sys);
+
+/* video memory offset of each pixel row in the 256x192 area:
+    | 0| 1| 0|Y7|Y6|Y2|Y1|Y0|Y5|Y4|Y3|X4|X3|X2|X1|X0|
+*/
+static const uint16_t _zx_pixel_row_offset[192] = {
+    0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700,
+    0x0020, 0x0120, 0x0220, 0x0320, 0x0420, 0x0520, 0x0620, 0x0720,
+    0x0040, 0x0140, 0x0240, 0x0340, 0x0440, 0x0540, 0x0640, 0x0740,
+    0x0060, 0x0160, 0x0260, 0x0360, 0x0460, 0x0560, 0x0660, 0x0760,
+    0x0080, 0x0180, 0x0280, 0x0380, 0x0480, 0x0580, 0x0680, 0x0780,
+    0x00A0, 0x01A0, 0x02A0, 0x03A0, 0x04A0, 0x05A0, 0x06A0, 0x07A0,
+    0x00C0, 0x01C0, 0x02C0, 0x03C0, 0x04C0, 0x05C0, 0x06C0, 0x07C0,
+    0x00E0, 0x01E0, 0x02E0, 0x03E0, 0x04E0, 0x05E0, 0x06E0, 0x07E0,
+    0x0800, 0x0900, 0x0A00, 0x0B00, 0x0C00, 0x0D00, 0x0E00, 0x0F00,
+    0x0820, 0x0920, 0x0A20, 0x0B20, 0x0C20, 0x0D20, 0x0E20, 0x0F20,
+    0x0840, 0x0940, 0x0A40, 0x0B40, 0x0C40, 0x0D40, 0x0E40, 0x0F40,
+    0x0860, 0x0960, 0x0A60, 0x0B60, 0x0C60, 0x0D60, 0x0E60, 0x0F60,
+    0x0880, 0x0980, 0x0A80, 0x0B80, 0x0C80, 0x0D80, 0x0E80, 0x0F80,
+    0x08A0, 0x09A0, 0x0AA0, 0x0BA0, 0x0CA0, 0x0DA0, 0x0EA0, 0x0FA0,
+    0x08C0, 0x09C0, 0x0AC0, 0x0BC0, 0x0CC0, 0x0DC0, 0x0EC0, 0x0FC0,
+    0x08E0, 0x09E0, 0x0AE0, 0x0BE0, 0x0CE0, 0x0DE0, 0x0EE0, 0x0FE0,
+    0x1000, 0x1100, 0x1200, 0x1300, 0x1400, 0x1500, 0x1600, 0x1700,
+    0x1020, 0x1120, 0x1220, 0x1320, 0x1420, 0x1520, 0x1620, 0x1720,
+    0x1040, 0x1140, 0x1240, 0x1340, 0x1440, 0x1540, 0x1640, 0x1740,
+    0x1060, 0x1160, 0x1260, 0x1360, 0x1460, 0x1560, 0x1660, 0x1760,
+    0x1080, 0x1180, 0x1280, 0x1380, 0x1480, 0x1580, 0x1680, 0x1780,
+    0x10A0, 0x11A0, 0x12A0, 0x13A0, 0x14A0, 0x15A0, 0x16A0, 0x17A0,
+    0x10C0, 0x11C0, 0x12C0, 0x13C0, 0x14C0, 0x15C0, 0x16C0, 0x17C0,
+    0x10E0, 0x11E0, 0x12E0, 0x13E0, 0x14E0, 0x15E0, 0x16E0, 0x17E0,
+};
+
+/* pixel byte => 8 pixel masks, MSB is the leftmost pixel */
+#define _ZX_M(v,bit) (((v)&(1<<(bit)))?0xFFFFFFFF:0)
+#define _ZX_MASK1(v) {_ZX_M(v,7),_ZX_M(v,6),_ZX_M(v,5),_ZX_M(v,4),_ZX_M(v,3),_ZX_M(v,2),_ZX_M(v,1),_ZX_M(v,0)}
+#define _ZX_MASK4(v) _ZX_MASK1(v),_ZX_MASK1(v+1),_ZX_MASK1(v+2),_ZX_MASK1(v+3)
+#define _ZX_MASK16(v) _ZX_MASK4(v),_ZX_MASK4(v+4),_ZX_MASK4(v+8),_ZX_MASK4(v+12)
+#define _ZX_MASK64(v) _ZX_MASK16(v),_ZX_MASK16(v+16),_ZX_MASK16(v+32),_ZX_MASK16(v+48)
+static const uint32_t _zx_pixel_masks[256][8] = {
+    _ZX_MASK64(0), _ZX_MASK64(64), _ZX_MASK64(128), _ZX_MASK64(192)
+};
+#undef _ZX_MASK64
+#undef _ZX_MASK16
+#undef _ZX_MASK4
+#undef _ZX_MASK1
+#undef _ZX_M
+
+/* build the attribute byte => fg/bg color tables for both blink phases */
+static void _zx_init_attr_colors(zx128k_t* sys) {
+    for (int blink = 0; blink < 2; blink++) {
+        for (int clr = 0; clr < 256; clr++) {
+            uint8_t fg, bg;
+            if ((clr & (1<<7)) && blink) {
+                fg = (clr>>3) & 7;
+                bg = clr & 7;
+            }
+            else {
+                fg = clr & 7;
+                bg = (clr>>3) & 7;
+            }
+            if (clr & (1<<6)) {
+                // bright colors
+                fg += 8;
+                bg += 8;
+            }
+            sys->vid_attr_pal8[blink][clr][0] = fg;
+            sys->vid_attr_pal8[blink][clr][1] = bg;
+            sys->vid_attr_colors[blink][clr][0] = (fg & 8) ? zx_palette[fg & 7] : (zx_palette[fg] & 0xFFD7D7D7);
+            sys->vid_attr_colors[blink][clr][1] = (bg & 8) ? zx_palette[bg & 7] : (zx_palette[bg] & 0xFFD7D7D7);
+        }
+    }
+}
+
+/* mark the pixel rows affected by a write into the display RAM bank */
+static inline void _zx_vid_dirty(zx128k_t* sys, uint16_t offset) {
+    if (offset < 0x1800) {
+        /* pixel byte, reverse the address interleaving to get the row */
+        const uint32_t yy = ((offset>>5) & 0xC0) | ((offset>>8) & 0x07) | ((offset>>2) & 0x38);
+        sys->vid_dirty_rows[yy>>5] |= 1U << (yy & 31);
+    }
+    else if (offset < 0x1B00) {
+        /* attribute byte, affects 8 pixel rows */
+        const uint32_t row = (offset - 0x1800) >> 5;
+        sys->vid_dirty_rows[row>>2] |= 0xFFU << ((row & 3) * 8);
+    }
+}
+
+/* store a new audio sample, and hand the batch to the audio callback when full */
+static inline void _zx_audio_sample(zx128k_t* sys, float sample) {
+    sys->sample_buffer[sys->sample_pos++] = sample;
+    if (sys->sample_pos == sys->num_samples) {
+        if (sys->audio_cb) {
+            sys->audio_cb(sys->sample_buffer, sys->num_samples);
+        }
+        sys->sample_pos = 0;
+    }
+}
+
+/* map the RAM banks and ROM selected by upper_ram_bank and rom_bank, this
+   is also called to rebuild the memory map after a snapshot restore
+*/
+static void _zx_init_memory_map(zx128k_t* sys) {
+    mem_map_ram(&sys->mem, 0, 0x4000, 0x4000, sys->ram[5]);
+    mem_map_ram(&sys->mem, 0, 0x8000, 0x4000, sys->ram[2]);
+    mem_map_ram(&sys->mem, 0, 0xC000, 0x4000, sys->ram[sys->upper_ram_bank]);
+    mem_map_rom(&sys->mem, 0, 0x0000, 0x4000, sys->rom[sys->rom_bank]);
+}
+
+/* ZX Spectrum 128 emulator init */
+void zx_init(zx128k_t* sys, const zx_desc_t* desc) {
+    CHIPS_ASSERT(sys && desc && (desc->rgba8_buffer || desc->pal8_buffer));
+    CHIPS_ASSERT(!desc->rgba8_buffer || (desc->rgba8_buffer_size >= (ZX128K_DISP_WIDTH*ZX128K_DISP_HEIGHT*sizeof(uint32_t))));
+    CHIPS_ASSERT(!desc->pal8_buffer || (desc->pal8_buffer_size >= (ZX128K_DISP_WIDTH*ZX128K_DISP_HEIGHT)));
+    memset(sys, 0, sizeof(zx128k_t));
+    _zx_sys = sys;
+    sys->rgba8_buffer = desc->rgba8_buffer;
+    sys->rgba8_buffer_size = desc->rgba8_buffer_size;
+    sys->pal8_buffer = desc->pal8_buffer;
+    sys->pal8_buffer_size = desc->pal8_buffer_size;
+    CHIPS_ASSERT(desc->audio_num_samples <= ZX128K_MAX_AUDIO_SAMPLES);
+    sys->audio_cb = desc->audio_cb;
+    sys->num_samples = (desc->audio_num_samples > 0) ? desc->audio_num_samples : ZX128K_DEFAULT_AUDIO_SAMPLES;
+    sys->rom[0] = desc->rom_0 ? desc->rom_0 : dump_amstrad_zx128k_0;
+    sys->rom[1] = desc->rom_1 ? desc->rom_1 : dump_amstrad_zx128k_1;
+    sys->prof = desc->prof;
+    sys->contention = !desc->disable_contention;
+    sys->audio_batching = !desc->disable_audio_batching;
+    const int audio_hz = (desc->audio_sample_rate > 0) ? desc->audio_sample_rate : 44100;
+    sys->border_color = 0xFF000000;
+    sys->display_ram_bank = 5;
+    sched_init(&sys->sched);
+    sched_set_in(&sys->sched, ZX128K_EVENT_SCANLINE, ZX128K_SCANLINE_PERIOD, ZX128K_SCANLINE_PERIOD);
+    sys->vid_redraw_lines = ZX128K_DISP_HEIGHT;
+    _zx_init_attr_colors(sys);
+
+    z80_init(&sys->cpu, zx_cpu_tick);
+    beeper_init(&sys->beeper, ZX128K_FREQ, audio_hz, 0.5f);
+    ay38910_init(&sys->ay, &(ay38910_desc_t){
+        .type = AY38910_TYPE_8912,
+        .tick_hz = ZX128K_FREQ/2,
+        .sound_hz = audio_hz,
+        .magnitude = 0.5
+    });
+    sys->cpu.state.PC = 0x0000;
+
+    /* initial memory map */
+    _zx_init_memory_map(sys);
+
+    /* setup keyboard matrix */
+    kbd_init(&sys->kbd, 1);
+    /* caps-shift is column 0, line 0 */
+    kbd_register_modifier(&sys->kbd, 0, 0, 0);
+    /* sym-shift is column 7, line 1 */
+    kbd_register_modifier(&sys->kbd, 1, 7, 1);
+    /* alpha-numeric keys */
+    const char* keymap =
+        // no shift
+        " zxcv"         // A8       shift,z,x,c,v
+        "asdfg"         // A9       a,s,d,f,g
+        "qwert"         // A10      q,w,e,r,t
+        "12345"         // A11      1,2,3,4,5
+        "09876"         // A12      0,9,8,7,6
+        "poiuy"         // A13      p,o,i,u,y
+        " lkjh"         // A14      enter,l,k,j,h
+        "  mnb"         // A15      space,symshift,m,n,b
+
+        // shift
+        " ZXCV"         // A8
+        "ASDFG"         // A9
+        "QWERT"         // A10
+        "     "         // A11
+        "     "         // A12
+        "POIUY"         // A13
+        " LKJH"         // A14
+        "  MNB"         // A15
+
+        // symshift
+        " : ?/"         // A8
+        "     "         // A9
+        "   <>"         // A10
+        "!@#$%"         // A11
+        "_)('&"         // A12
+        "\";   "        // A13
+        " =+-^"         // A14
+        "  .,*";        // A15
+    for (int layer = 0; layer < 3; layer++) {
+        for (int col = 0; col < 8; col++) {
+            for (int line = 0; line < 5; line++) {
+                const uint8_t c = keymap[layer*40 + col*5 + line];
+                if (c != 0x20) {
+                    kbd_register_key(&sys->kbd, c, col, line, (layer>0) ? (1<<(layer-1)) : 0);
+                }
+            }
+        }
+    }
+
+    /* special keys */
+    kbd_register_key(&sys->kbd, ' ', 7, 0, 0);  // Space
+    kbd_register_key(&sys->kbd, 0x0F, 7, 1, 0); // SymShift
+    kbd_register_key(&sys->kbd, 0x08, 3, 4, 1); // Cursor Left (Shift+5)
+    kbd_register_key(&sys->kbd, 0x0A, 4, 4, 1); // Cursor Down (Shift+6)
+    kbd_register_key(&sys->kbd, 0x0B, 4, 3, 1); // Cursor Up (Shift+7)
+    kbd_register_key(&sys->kbd, 0x09, 4, 2, 1); // Cursor Right (Shift+8)
+    kbd_register_key(&sys->kbd, 0x07, 3, 0, 1); // Edit (Shift+1)
+    kbd_register_key(&sys->kbd, 0x0C, 4, 0, 1); // Delete (Shift+0)
+    kbd_register_key(&sys->kbd, 0x0D, 6, 0, 0); // Enter
+}
+
+/*  the ULA delays CPU accesses to contended memory (and IO ports) during the
+    128 T-states of each of the 192 display lines in which it fetches video
+    memory, the delay repeats in each group of 8 T-states, and depends on
+    the T-state at which the access starts, counted from the first
+    contended T-state:
+
+        6, 5, 4, 3, 2, 1, 0, 0
+
+    the delay table covers one scanline (the remaining 100 T-states of the
+    scanline aren't contended)
+*/
+#define _ZX_C8 6,5,4,3,2,1,0,0
+#define _ZX_C32 _ZX_C8,_ZX_C8,_ZX_C8,_ZX_C8
+static const uint8_t _zx_contention_delay[ZX128K_SCANLINE_PERIOD] = {
+    _ZX_C32, _ZX_C32, _ZX_C32, _ZX_C32
+};
+#undef _ZX_C32
+#undef _ZX_C8
+
+/* number of wait states for a contended access starting at the current T-state */
+static inline uint32_t _zx_contention_wait(const zx128k_t* sys) {
+    /* the frame tick is derived from the scanline counters, frame tick 0 is the vblank interrupt */
+    const uint32_t scanline_ticks_left = (uint32_t) sched_ticks_left(&sys->sched, ZX128K_EVENT_SCANLINE);
+    const uint32_t frame_tick = sys->scanline_y * ZX128K_SCANLINE_PERIOD + (ZX128K_SCANLINE_PERIOD - scanline_ticks_left);
+    /* wraps around before the first contended T-state */
+    const uint32_t t = frame_tick - ZX128K_CONTENTION_START;
+    if (t < (192 * ZX128K_SCANLINE_PERIOD)) {
+        return _zx_contention_delay[t % ZX128K_SCANLINE_PERIOD];
+    }
+    return 0;
+}
+
+/* RAM banks 1, 3, 5 and 7 are contended on the 128K, bank 5 is always mapped at 0x4000 */
+static inline bool _zx_contended_addr(const zx128k_t* sys, uint16_t addr) {
+    const uint16_t area = addr & 0xC000;
+    return (area == 0x4000) || ((area == 0xC000) && (sys->upper_ram_bank & 1));
+}
+
+/* run the beeper and AY-3-8912 ticks which were deferred since the last
+   audio chip access, the samples go into the sample buffer as usual
+*/
+static inline void _zx_audio_catchup(zx128k_t* sys) {
+    for (; sys->audio_pending_ticks > 0; sys->audio_pending_ticks--) {
+        sys->tick_count++;
+        if (beeper_tick(&sys->beeper)) {
+            /* new sample ready, mix the beeper with the last AY sample */
+            _zx_audio_sample(sys, sys->beeper.sample + sys->ay.sample);
+        }
+        /* the AY-3-8912 chip runs at half CPU frequency */
+        if (sys->tick_count & 1) {
+            ay38910_tick(&sys->ay);
+        }
+    }
+}
+
+/* a write to the Spectrum 128 memory control port 7FFD */
+static void _zx_memory_config(zx128k_t* sys, uint8_t data) {
+    if (!sys->memory_paging_disabled) {
+        // bit 3 defines the video scanout memory bank (5 or 7)
+        const uint32_t display_ram_bank = (data & (1<<3)) ? 7 : 5;
+        if (display_ram_bank != sys->display_ram_bank) {
+            sys->display_ram_bank = display_ram_bank;
+            sys->vid_redraw_lines = ZX128K_DISP_HEIGHT;
+        }
+        // only last memory bank is mappable
+        sys->upper_ram_bank = data & 0x7;
+        mem_map_ram(&sys->mem, 0, 0xC000, 0x4000, sys->ram[data & 0x7]);
+
+        // bit 4 set: ROM1, clear: ROM0
+        sys->rom_bank = (data & (1<<4)) ? 1 : 0;
+        mem_map_rom(&sys->mem, 0, 0x0000, 0x4000, sys->rom[sys->rom_bank]);
+    }
+    if (data & (1<<5)) {
+        /* bit 5 prevents further changes to memory pages
+            until computer is reset, this is used when switching
+            to the 48k ROM
+        */
+        sys->memory_paging_disabled = true;
+    }
+}
+
+uint32_t zx_exec(zx128k_t* sys, uint32_t ticks) {
+    _zx_sys = sys;
+    const uint32_t ticks_executed = z80_exec(&sys->cpu, ticks);
+    _zx_audio_catchup(sys);
+    return ticks_executed;
+}
+
+/* the CPU tick callback */
+uint64_t zx_cpu_tick(int num_ticks, uint64_t pins) {
+    zx128k_t* sys = _zx_sys;
+    if (sys->prof) {
+        pcprof_tick(sys->prof, num_ticks, (pins & (Z80_M1|Z80_MREQ)) == (Z80_M1|Z80_MREQ), Z80_GET_ADDR(pins));
+    }
+    /* contended memory and IO accesses, ULA ports (A0 low) are always contended */
+    uint32_t wait_cycles = 0;
+    if (sys->contention) {
+        if (pins & Z80_MREQ) {
+            if (_zx_contended_addr(sys, Z80_GET_ADDR(pins))) {
+                wait_cycles = _zx_contention_wait(sys);
+            }
+        }
+        else if ((pins & (Z80_IORQ|Z80_M1)) == Z80_IORQ) {
+            if (((pins & Z80_A0) == 0) || _zx_contended_addr(sys, Z80_GET_ADDR(pins))) {
+                wait_cycles = _zx_contention_wait(sys);
+            }
+        }
+        num_ticks += wait_cycles;
+    }
+
+    /* scheduled events: video decoding and vblank interrupt */
+    if (sched_advance(&sys->sched, num_ticks)) {
+        int id;
+        while ((id = sched_pop(&sys->sched)) >= 0) {
+            if (ZX128K_EVENT_SCANLINE == id) {
+                // decode next video scanline
+                if (zx_decode_scanline(sys)) {
+                    // request vblank interrupt
+                    pins |= Z80_INT;
+                }
+            }
+        }
+    }
+
+    /* tick audio systems, or defer the ticks until the beeper or AY are
+       accessed (their output only goes into the sample buffer)
+    */
+    sys->audio_pending_ticks += num_ticks;
+    if (!sys->audio_batching) {
+        _zx_audio_catchup(sys);
+    }
+
+    /* memory and IO requests */
+    if (pins & Z80_MREQ) {
+        /* a memory request machine cycle */
+        const uint16_t addr = Z80_GET_ADDR(pins);
+        if (pins & Z80_RD) {
+            Z80_SET_DATA(pins, mem_rd(&sys->mem, addr));
+        }
+        else if (pins & Z80_WR) {
+            mem_wr(&sys->mem, addr, Z80_GET_DATA(pins));
+            /* track writes into the display RAM for the video decoder */
+            if ((addr >= 0x4000) && (addr < 0x5B00) && (sys->display_ram_bank == 5)) {
+                _zx_vid_dirty(sys, addr - 0x4000);
+            }
+            else if ((addr >= 0xC000) && (addr < 0xDB00) && (sys->display_ram_bank == sys->upper_ram_bank)) {
+                _zx_vid_dirty(sys, addr - 0xC000);
+            }
+        }
+    }
+    else if (pins & Z80_IORQ) {
+        /* an IO request machine cycle
+            see http://problemkaputt.de/zxdocs.htm#zxspectrum for address decoding
+        */
+        if (pins & Z80_RD) {
+            /* an IO read
+                FIXME: reading from port xxFF should return 'current VRAM data'
+            */
+            if ((pins & Z80_A0) == 0) {
+                /* Spectrum ULA (...............0)
+                    Bits 5 and 7 as read by INning from Port 0xfe are always one
+                */
+                uint8_t data = (1<<7)|(1<<5);
+                /* MIC/EAR flags -> bit 6 */
+                if (sys->last_fe_out & (1<<3|1<<4)) {
+                    data |= (1<<6);
+                }
+                /* keyboard matrix bits are encoded in the upper 8 bit of the port address */
+                uint16_t column_mask = (~(Z80_GET_ADDR(pins)>>8)) & 0x00FF;
+                const uint16_t kbd_lines = kbd_test_lines(&sys->kbd, column_mask);
+                data |= (~kbd_lines) & 0x1F;
+                Z80_SET_DATA(pins, data);
+            }
+            else if ((pins & (Z80_A7|Z80_A6|Z80_A5)) == 0) {
+                /* FIXME: Kempston Joystick (........000.....) */
+            }
+            else {
+                /* read from AY-3-8912 (11............0.) */
+                if ((pins & (Z80_A15|Z80_A14|Z80_A1)) == (Z80_A15|Z80_A14)) {
+                    _zx_audio_catchup(sys);
+                    pins = ay38910_iorq(&sys->ay, AY38910_BC1|pins) & Z80_PIN_MASK;
+                }
+            }
+        }
+        else if (pins & Z80_WR) {
+            // an IO write
+            const uint8_t data = Z80_GET_DATA(pins);
+            if ((pins & Z80_A0) == 0) {
+                // Spectrum ULA (...............0)
+                // "every even IO port addresses the ULA but to avoid
+                // problems with other I/O devices, only FE should be used"
+                sys->border_color = zx_palette[data & 7] & 0xFFD7D7D7;
+                sys->border_index = data & 7;
+                // FIXME:
+                //      bit 3: MIC output (CAS SAVE, 0=On, 1=Off)
+                //      bit 4: Beep output (ULA sound, 0=Off, 1=On)
+                sys->last_fe_out = data;
+                _zx_audio_catchup(sys);
+                beeper_set(&sys->beeper, 0 != (data & (1<<4)));
+            }
+            else {
+                /* Spectrum 128 memory control (0.............0.)
+                    http://8bit.yarek.pl/computer/zx.128/
+                */
+                if ((pins & (Z80_A15|Z80_A1)) == 0) {
+                    _zx_memory_config(sys, data);
+                }
+                else if ((pins & (Z80_A15|Z80_A14|Z80_A1)) == (Z80_A15|Z80_A14)) {
+                    /* select AY-3-8912 register (11............0.) */
+                    _zx_audio_catchup(sys);
+                    ay38910_iorq(&sys->ay, AY38910_BDIR|AY38910_BC1|pins);
+                }
+                else if ((pins & (Z80_A15|Z80_A14|Z80_A1)) == Z80_A15) {
+                    /* write to AY-3-8912 (10............0.) */
+                    _zx_audio_catchup(sys);
+                    ay38910_iorq(&sys->ay, AY38910_BDIR|pins);
+                }
+            }
+        }
+    }
+    Z80_SET_WAIT(pins, wait_cycles);
+    return pins;
+}
+
+/* decode one line of the 256x192 area with left and right border */
+static void _zx_decode_line(zx128k_t* sys, uint32_t* dst, const uint8_t* pix_row, const uint8_t* clr_row) {
+    const uint32_t border_color = sys->border_color;
+    const uint32_t (*attr_colors)[2] = sys->vid_attr_colors[sys->vid_blink];
+
+    /* left border */
+    for (int x = 0; x < (4*8); x++) {
+        *dst++ = border_color;
+    }
+
+    /* valid 256x192 vidmem area */
+    for (int x = 0; x < 32; x++) {
+        const uint32_t* mask = _zx_pixel_masks[pix_row[x]];
+        const uint32_t fg = attr_colors[clr_row[x]][0];
+        const uint32_t bg = attr_colors[clr_row[x]][1];
+        const uint32_t fg_bg = fg ^ bg;
+        for (int px = 0; px < 8; px++) {
+            dst[px] = bg ^ (fg_bg & mask[px]);
+        }
+        dst += 8;
+    }
+
+    /* right border */
+    for (int x = 0; x < (4*8); x++) {
+        *dst++ = border_color;
+    }
+}
+
+/* same as _zx_decode_line, but writes color indices */
+static void _zx_decode_line_pal8(zx128k_t* sys, uint8_t* dst, const uint8_t* pix_row, const uint8_t* clr_row) {
+    const uint8_t (*attr_colors)[2] = sys->vid_attr_pal8[sys->vid_blink];
+    memset(dst, sys->border_index, 4*8);
+    dst += 4*8;
+    for (int x = 0; x < 32; x++) {
+        const uint32_t* mask = _zx_pixel_masks[pix_row[x]];
+        const uint8_t fg = attr_colors[clr_row[x]][0];
+        const uint8_t bg = attr_colors[clr_row[x]][1];
+        const uint8_t fg_bg = fg ^ bg;
+        for (int px = 0; px < 8; px++) {
+            dst[px] = bg ^ (fg_bg & (uint8_t)mask[px]);
+        }
+        dst += 8;
+    }
+    memset(dst, sys->border_index, 4*8);
+}
+
+bool zx_decode_scanline(zx128k_t* sys) {
+    /* this is called by the timer callback for every PAL line, controlling
+        the vidmem decoding and vblank interrupt
+
+        detailed information about frame timings is here:
+        for 48K:    http://rk.nvg.ntnu.no/sinclair/faq/tech_48.html#48K
+        for 128K:   http://rk.nvg.ntnu.no/sinclair/faq/tech_128.html
+
+        one PAL line takes 224 T-states on 48K, and 228 T-states on 128K
+        one PAL frame is 312 lines on 48K, and 311 lines on 128K
+
+        decode the next videomem line into the emulator framebuffer,
+        the border area of a real Spectrum is bigger than the emulator
+        (the emu has 32 pixels border on each side, the hardware has:
+
+        63 or 64 lines top border
+        56 border lines bottom border
+        48 pixels on each side horizontal border
+    */
+    const int top_decode_line = ZX128K_TOP_BORDER_SCANLINES - 32;
+    const int btm_decode_line = ZX128K_TOP_BORDER_SCANLINES + 192 + 32;
+    if (!sys->skip_video && (sys->scanline_y >= top_decode_line) && (sys->scanline_y < btm_decode_line)) {
+        const uint16_t y = sys->scanline_y - top_decode_line;
+        const uint32_t border_color = sys->border_color;
+        if (0 == y) {
+            /* start of a new decoded frame */
+            const uint8_t blink = (sys->blink_counter & 0x10) ? 1 : 0;
+            if (blink != sys->vid_blink) {
+                sys->vid_blink = blink;
+                sys->vid_redraw_lines = ZX128K_DISP_HEIGHT;
+            }
+        }
+        const bool redraw = sys->vid_redraw_lines > 0;
+        if (redraw) {
+            sys->vid_redraw_lines--;
+        }
+        if ((y < 32) || (y >= 224)) {
+            /* upper/lower border */
+            if (redraw || (sys->vid_line_border[y] != border_color)) {
+                if (sys->pal8_buffer) {
+                    memset(&sys->pal8_buffer[y * ZX128K_DISP_WIDTH], sys->border_index, ZX128K_DISP_WIDTH);
+                }
+                else {
+                    uint32_t* dst = &sys->rgba8_buffer[y * ZX128K_DISP_WIDTH];
+                    for (int x = 0; x < ZX128K_DISP_WIDTH; x++) {
+                        *dst++ = border_color;
+                    }
+                }
+            }
+        }
+        else {
+            /* only decode a line if its pixels, attributes or border have changed */
+            const uint16_t yy = y-32;
+            const uint32_t row_mask = 1U << (yy & 31);
+            if (redraw ||
+                (sys->vid_dirty_rows[yy>>5] & row_mask) ||
+                (sys->vid_line_border[y] != border_color))
+            {
+                sys->vid_dirty_rows[yy>>5] &= ~row_mask;
+                const uint8_t* vidmem_bank = sys->ram[sys->display_ram_bank];
+                const uint8_t* pix_row = &vidmem_bank[_zx_pixel_row_offset[yy]];
+                const uint8_t* clr_row = &vidmem_bank[0x1800 + ((yy & ~0x7)<<2)];
+                if (sys->pal8_buffer) {
+                    _zx_decode_line_pal8(sys, &sys->pal8_buffer[y * ZX128K_DISP_WIDTH], pix_row, clr_row);
+                }
+                else {
+                    _zx_decode_line(sys, &sys->rgba8_buffer[y * ZX128K_DISP_WIDTH], pix_row, clr_row);
+                }
+            }
+        }
+        sys->vid_line_border[y] = border_color;
+    }
+
+    if (++sys->scanline_y >= ZX128K_SCANLINES) {
+        /* start new frame, request vblank interrupt */
+        sys->scanline_y = 0;
+        sys->blink_counter++;
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+void zx_pal8_colors(uint32_t colors[ZX128K_PAL8_NUM_COLORS]) {
+    for (int i = 0; i < 8; i++) {
+        colors[i] = zx_palette[i] & 0xFFD7D7D7;
+        colors[i + 8] = zx_palette[i];
+    }
+}
+
+/*=== .sna and .z80 quickloading ===*/
+#define _ZX_SNA_HEADER_SIZE (27)
+#define _ZX_SNA48_SIZE (_ZX_SNA_HEADER_SIZE + 0xC000)
+#define _ZX_SNA128_SIZE (_ZX_SNA48_SIZE + 4 + 5 * 0x4000)
+#define _ZX_Z80_HEADER_SIZE (30)
+
+static inline uint16_t _zx_word(const uint8_t* ptr) {
+    return (uint16_t)(ptr[0] | (ptr[1] << 8));
+}
+
+/* setup the memory map and audio state for a quickloaded snapshot: a 48K
+   snapshot runs on the 48K BASIC ROM with paging locked, a 128K snapshot
+   gets its 7FFD memory configuration
+*/
+static void _zx_quickload_begin(zx128k_t* sys, bool is_128, uint8_t port_7ffd) {
+    _zx_audio_catchup(sys);
+    sys->memory_paging_disabled = false;
+    mem_map_ram(&sys->mem, 0, 0x4000, 0x4000, sys->ram[5]);
+    mem_map_ram(&sys->mem, 0, 0x8000, 0x4000, sys->ram[2]);
+    _zx_memory_config(sys, is_128 ? port_7ffd : 0x30);
+}
+
+static void _zx_quickload_end(zx128k_t* sys, uint8_t border) {
+    sys->border_color = zx_palette[border & 7] & 0xFFD7D7D7;
+    sys->border_index = border & 7;
+    sys->last_fe_out = border & 7;
+    beeper_set(&sys->beeper, false);
+    sys->vid_redraw_lines = ZX128K_DISP_HEIGHT;
+}
+
+bool zx_quickload_sna(zx128k_t* sys, const uint8_t* ptr, uint32_t num_bytes) {
+    CHIPS_ASSERT(sys && ptr);
+    const bool is_128 = (num_bytes == _ZX_SNA128_SIZE) || (num_bytes == (_ZX_SNA128_SIZE + 0x4000));
+    if ((num_bytes != _ZX_SNA48_SIZE) && !is_128) {
+        return false;
+    }
+    const uint8_t* hdr = ptr;
+    const uint8_t* ext = ptr + _ZX_SNA48_SIZE;
+    const uint8_t port_7ffd = is_128 ? ext[2] : 0x30;
+    const uint32_t paged_bank = port_7ffd & 7;
+    /* the 128K variant repeats the paged bank if it's bank 2 or 5 */
+    if (is_128 && (num_bytes != (_ZX_SNA128_SIZE + (((paged_bank == 2) || (paged_bank == 5)) ? 0x4000 : 0)))) {
+        return false;
+    }
+    _zx_quickload_begin(sys, is_128, port_7ffd);
+    const uint8_t* data = ptr + _ZX_SNA_HEADER_SIZE;
+    memcpy(sys->ram[5], data, 0x4000);
+    memcpy(sys->ram[2], data + 0x4000, 0x4000);
+    memcpy(sys->ram[is_128 ? paged_bank : 0], data + 0x8000, 0x4000);
+    if (is_128) {
+        /* the remaining banks in ascending order */
+        const uint8_t* bank_data = ext + 4;
+        for (uint32_t bank = 0; bank < 8; bank++) {
+            if ((bank != 5) && (bank != 2) && (bank != paged_bank)) {
+                memcpy(sys->ram[bank], bank_data, 0x4000);
+                bank_data += 0x4000;
+            }
+        }
+    }
+    z80_state_t* r = &sys->cpu.state;
+    r->I = hdr[0];
+    r->HL_ = _zx_word(&hdr[1]);
+    r->DE_ = _zx_word(&hdr[3]);
+    r->BC_ = _zx_word(&hdr[5]);
+    r->AF_ = _zx_word(&hdr[7]);
+    r->HL = _zx_word(&hdr[9]);
+    r->DE = _zx_word(&hdr[11]);
+    r->BC = _zx_word(&hdr[13]);
+    r->IY = _zx_word(&hdr[15]);
+    r->IX = _zx_word(&hdr[17]);
+    r->IFF1 = r->IFF2 = 0 != (hdr[19] & (1<<2));
+    r->R = hdr[20];
+    r->AF = _zx_word(&hdr[21]);
+    r->SP = _zx_word(&hdr[23]);
+    r->IM = hdr[25] & 3;
+    if (is_128) {
+        r->PC = _zx_word(&ext[0]);
+    }
+    else {
+        /* the 48K format has the PC pushed on the stack (it's resumed with a RETN) */
+        r->PC = (uint16_t)(mem_rd(&sys->mem, r->SP) | (mem_rd(&sys->mem, (uint16_t)(r->SP + 1)) << 8));
+        r->SP += 2;
+    }
+    _zx_quickload_end(sys, hdr[26]);
+    return true;
+}
+
+/* decompress a .z80 memory block (ED ED nn bb: nn times the byte bb) into
+   consecutive 16 KB banks, with dst == 0 the data is only validated
+*/
+static bool _zx_z80_decompress(const uint8_t* src, uint32_t src_len, uint8_t* const* dst, uint32_t dst_len) {
+    uint32_t si = 0, di = 0;
+    while ((si < src_len) && (di < dst_len)) {
+        uint32_t count = 1;
+        uint8_t val = src[si];
+        if (((si + 3) < src_len) && (src[si] == 0xED) && (src[si + 1] == 0xED)) {
+            count = src[si + 2];
+            val = src[si + 3];
+            si += 4;
+            if ((di + count) > dst_len) {
+                return false;
+            }
+        }
+        else {
+            si++;
+        }
+        if (dst) {
+            for (uint32_t i = 0; i < count; i++, di++) {
+                dst[di >> 14][di & 0x3FFF] = val;
+            }
+        }
+        else {
+            di += count;
+        }
+    }
+    return di == dst_len;
+}
+
+/* the RAM bank of a .z80 page number, or -1 */
+static int _zx_z80_bank(bool is_128, int page) {
+    if (is_128) {
+        return ((page >= 3) && (page <= 10)) ? (page - 3) : -1;
+    }
+    switch (page) {
+        case 4: return 2;   /* 8000..BFFF */
+        case 5: return 0;   /* C000..FFFF */
+        case 8: return 5;   /* 4000..7FFF */
+        default: return -1;
+    }
+}
+
+/* load the memory blocks of a .z80 file starting at pos, with write == false
+   the blocks are only validated (so that a broken file leaves the instance
+   untouched)
+*/
+static bool _zx_z80_load_blocks(zx128k_t* sys, const uint8_t* ptr, uint32_t num_bytes, uint32_t pos, uint8_t flags, bool is_128, bool write) {
+    if (_ZX_Z80_HEADER_SIZE == pos) {
+        /* version 1: a single 48K block, ending with 00 ED ED 00 if compressed */
+        uint8_t* const banks[3] = { sys->ram[5], sys->ram[2], sys->ram[0] };
+        uint32_t len = num_bytes - pos;
+        if (flags & (1<<5)) {
+            if ((len >= 4) && (0 == memcmp(&ptr[num_bytes - 4], "\x00\xED\xED\x00", 4))) {
+                len -= 4;
+            }
+            return _zx_z80_decompress(&ptr[pos], len, write ? banks : 0, 0xC000);
+        }
+        if (len != 0xC000) {
+            return false;
+        }
+        if (write) {
+            for (int i = 0; i < 3; i++) {
+                memcpy(banks[i], &ptr[pos + i * 0x4000], 0x4000);
+            }
+        }
+        return true;
+    }
+    /* version 2 and 3: 16 KB blocks with a 3-byte header (length, page number) */
+    while ((pos + 3) <= num_bytes) {
+        const uint32_t len = _zx_word(&ptr[pos]);
+        const int bank = _zx_z80_bank(is_128, ptr[pos + 2]);
+        pos += 3;
+        const uint32_t src_len = (len == 0xFFFF) ? 0x4000 : len;
+        if ((pos + src_len) > num_bytes) {
+            return false;
+        }
+        if (bank >= 0) {
+            uint8_t* const dst[1] = { sys->ram[bank] };
+            if (len == 0xFFFF) {
+                if (write) {
+                    memcpy(dst[0], &ptr[pos], 0x4000);
+                }
+            }
+            else if (!_zx_z80_decompress(&ptr[pos], src_len, write ? dst : 0, 0x4000)) {
+                return false;
+            }
+        }
+        pos += src_len;
+    }
+    return pos == num_bytes;
+}
+
+bool zx_quickload_z80(zx128k_t* sys, const uint8_t* ptr, uint32_t num_bytes) {
+    CHIPS_ASSERT(sys && ptr);
+    if (num_bytes < (_ZX_Z80_HEADER_SIZE + 2)) {
+        return false;
+    }
+    const uint8_t* hdr = ptr;
+    /* for compatibility, a flag byte of FF must be treated as 1 */
+    const uint8_t flags = (hdr[12] == 0xFF) ? 1 : hdr[12];
+    uint16_t pc = _zx_word(&hdr[6]);
+    bool is_128 = false;
+    uint8_t port_7ffd = 0x30;
+    uint32_t pos = _ZX_Z80_HEADER_SIZE;
+    if (0 == pc) {
+        /* version 2 or 3, with an additional header and 16 KB memory blocks */
+        const uint32_t ext_len = _zx_word(&hdr[30]);
+        pos += 2 + ext_len;
+        if ((ext_len < 4) || (pos > num_bytes)) {
+            return false;
+        }
+        pc = _zx_word(&hdr[32]);
+        const uint8_t hw_mode = hdr[34];
+        if (ext_len == 23) {
+            /* version 2: 0,1: 48K, 3,4: 128K */
+            is_128 = (hw_mode == 3) || (hw_mode == 4);
+            if ((hw_mode > 1) && !is_128) {
+                return false;
+            }
+        }
+        else {
+            /* version 3: 0,1,3: 48K, 4,5,6: 128K */
+            is_128 = (hw_mode >= 4) && (hw_mode <= 6);
+            if ((hw_mode == 2) || (hw_mode > 6)) {
+                return false;
+            }
+        }
+        port_7ffd = is_128 ? hdr[35] : 0x30;
+    }
+    if (!_zx_z80_load_blocks(sys, ptr, num_bytes, pos, flags, is_128, false)) {
+        return false;
+    }
+    _zx_quickload_begin(sys, is_128, port_7ffd);
+    _zx_z80_load_blocks(sys, ptr, num_bytes, pos, flags, is_128, true);
+    z80_state_t* r = &sys->cpu.state;
+    r->AF = (uint16_t)((hdr[0] << 8) | hdr[1]);
+    r->BC = _zx_word(&hdr[2]);
+    r->HL = _zx_word(&hdr[4]);
+    r->PC = pc;
+    r->SP = _zx_word(&hdr[8]);
+    r->I = hdr[10];
+    r->R = (uint8_t)((hdr[11] & 0x7F) | ((flags & 1) << 7));
+    r->DE = _zx_word(&hdr[13]);
+    r->BC_ = _zx_word(&hdr[15]);
+    r->DE_ = _zx_word(&hdr[17]);
+    r->HL_ = _zx_word(&hdr[19]);
+    r->AF_ = (uint16_t)((hdr[21] << 8) | hdr[22]);
+    r->IY = _zx_word(&hdr[23]);
+    r->IX = _zx_word(&hdr[25]);
+    r->IFF1 = 0 != hdr[27];
+    r->IFF2 = 0 != hdr[28];
+    r->IM = hdr[29] & 3;
+    _zx_quickload_end(sys, (flags >> 1) & 7);
+    return true;
+}
+
+#define ZX128K_SNAPSHOT_ID SNAPSHOT_FOURCC('Z','X','1','2')
+
+uint32_t zx_snapshot_size(void) {
+    return snapshot_size(sizeof(zx128k_t));
+}
+
+/* restore the CPU callback and memory map of an instance whose struct
+   was copied from a snapshot or clone base, the framebuffer and ROM
+   pointers must already be the ones of the instance
+*/
+static void _zx_restore_pointers(zx128k_t* sys) {
+    sys->cpu.tick = zx_cpu_tick;
+    _zx_init_memory_map(sys);
+    sys->vid_redraw_lines = ZX128K_DISP_HEIGHT;
+}
+
+uint32_t zx_save_snapshot(const zx128k_t* sys, void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    return snapshot_save(buf, buf_size, ZX128K_SNAPSHOT_ID, sys, sizeof(zx128k_t));
+}
+
+bool zx_load_snapshot(zx128k_t* sys, const void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(sys);
+    uint32_t* rgba8_buffer = sys->rgba8_buffer;
+    const uint32_t rgba8_buffer_size = sys->rgba8_buffer_size;
+    const uint8_t* rom_0 = sys->rom[0];
+    const uint8_t* rom_1 = sys->rom[1];
+    uint8_t* pal8_buffer = sys->pal8_buffer;
+    const uint32_t pal8_buffer_size = sys->pal8_buffer_size;
+    zx_audio_callback_t audio_cb = sys->audio_cb;
+    pcprof_t* prof = sys->prof;
+    const bool audio_batching = sys->audio_batching;
+    const bool contention = sys->contention;
+    const bool skip_video = sys->skip_video;
+    if (!snapshot_load(buf, buf_size, ZX128K_SNAPSHOT_ID, sys, sizeof(zx128k_t))) {
+        return false;
+    }
+    /* keep the instance's own framebuffers, ROMs, audio output, profiler and settings, the framebuffer content isn't part of the snapshot */
+    sys->rgba8_buffer = rgba8_buffer;
+    sys->rgba8_buffer_size = rgba8_buffer_size;
+    sys->rom[0] = rom_0;
+    sys->rom[1] = rom_1;
+    sys->pal8_buffer = pal8_buffer;
+    sys->audio_cb = audio_cb;
+    sys->prof = prof;
+    sys->audio_batching = audio_batching;
+    sys->contention = contention;
+    sys->skip_video = skip_video;
+    sys->pal8_buffer_size = pal8_buffer_size;
+    _zx_restore_pointers(sys);
+    _zx_audio_catchup(sys);
+    return true;
+}
+
+bool zx_clone_base(clone_base_t* base, const void* buf, uint32_t buf_size) {
+    CHIPS_ASSERT(base);
+    return clone_base_init(base, buf, buf_size, ZX128K_SNAPSHOT_ID, sizeof(zx128k_t));
+}
+
+zx128k_t* zx_clone(const clone_base_t* base, uint32_t* rgba8_buffer, uint32_t rgba8_buffer_size) {
+    CHIPS_ASSERT(base && rgba8_buffer);
+    zx128k_t* sys = (zx128k_t*) clone_map(base);
+    if (!sys) {
+        return 0;
+    }
+    /* the clone gets its own framebuffer, and doesn't share the audio output or the instrumentation of the base */
+    sys->rgba8_buffer = rgba8_buffer;
+    sys->rgba8_buffer_size = rgba8_buffer_size;
+    sys->pal8_buffer = 0;
+    sys->pal8_buffer_size = 0;
+    sys->prof = 0;
+    sys->audio_cb = 0;
+    _zx_restore_pointers(sys);
+    return sys;
+}
+
+void zx_free_clone(const clone_base_t* base, zx128k_t* sys) {
+    CHIPS_ASSERT(base);
+    clone_unmap(base, sys);
+}
+
+#endif /* CHIPS_IMPL */
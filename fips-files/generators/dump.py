@@ -1,9 +1,23 @@
 #-------------------------------------------------------------------------------
 #   dump.py
 #   Dump binary files into C arrays.
+#
+#   Optional yml attributes:
+#
+#   prefix: [name]  prefix for the dump item lookup table, this allows
+#                   to link several dump files into the same executable
+#                   (the table is called [name]_dump_items[] and the
+#                   number of items is [NAME]_DUMP_NUM_ITEMS)
+#   format: [array|string]
+#                   'array' (default) writes the data as an initializer
+#                   list of hex numbers, 'string' as a blob of escaped
+#                   string literals, which is much faster to compile
+#   compress: lz4   embed the data LZ4-compressed (as string blob), the
+#                   dump_*[] arrays are decompressed in place by a
+#                   constructor function before main() is called
 #-------------------------------------------------------------------------------
 
-Version = 5
+Version = 7
 
 import os.path
 import yaml
@@ -12,7 +26,7 @@ import genutil
 #-------------------------------------------------------------------------------
 def get_file_path(filename, file_path) :
     '''
-    Returns absolute path to an input file, given file name and 
+    Returns absolute path to an input file, given file name and
     another full file path in the same directory.
     '''
     return '{}/{}'.format(os.path.dirname(file_path), filename)
@@ -21,9 +35,95 @@ def get_file_path(filename, file_path) :
 def get_file_cname(filename) :
     return 'dump_{}'.format(os.path.splitext(filename)[0])
 
+#-------------------------------------------------------------------------------
+def get_items_cname(prefix) :
+    if prefix :
+        return '{}_dump_items'.format(prefix)
+    else :
+        return 'dump_items'
+
+#-------------------------------------------------------------------------------
+def get_num_items_cname(prefix) :
+    if prefix :
+        return '{}_DUMP_NUM_ITEMS'.format(prefix.upper())
+    else :
+        return 'DUMP_NUM_ITEMS'
+
+#-------------------------------------------------------------------------------
+def get_init_cname(prefix) :
+    if prefix :
+        return '{}_dump_init'.format(prefix)
+    else :
+        return 'dump_init'
+
+#-------------------------------------------------------------------------------
+def lz4_compress(data) :
+    '''
+    Greedy LZ4 block compressor (no frame header). Follows the LZ4 block
+    end conditions: the last 5 bytes are always literals, and the last
+    match starts at least 12 bytes before the end.
+    '''
+    out = bytearray()
+    n = len(data)
+
+    def write_len(l) :
+        while l >= 255 :
+            out.append(255)
+            l -= 255
+        out.append(l)
+
+    def write_seq(lit_start, lit_end, offset, match_len) :
+        lit_len = lit_end - lit_start
+        token = min(lit_len, 15) << 4
+        if offset > 0 :
+            token |= min(match_len - 4, 15)
+        out.append(token)
+        if lit_len >= 15 :
+            write_len(lit_len - 15)
+        out.extend(data[lit_start:lit_end])
+        if offset > 0 :
+            out.append(offset & 0xFF)
+            out.append(offset >> 8)
+            if match_len - 4 >= 15 :
+                write_len(match_len - 4 - 15)
+
+    table = {}
+    anchor = 0
+    i = 0
+    while i < n - 12 :
+        key = data[i] | (data[i+1]<<8) | (data[i+2]<<16) | (data[i+3]<<24)
+        cand = table.get(key)
+        table[key] = i
+        if (cand is not None) and (i - cand <= 0xFFFF) :
+            match_len = 4
+            max_len = n - 5 - i
+            while (match_len < max_len) and (data[cand + match_len] == data[i + match_len]) :
+                match_len += 1
+            write_seq(anchor, i, i - cand, match_len)
+            i += match_len
+            anchor = i
+        else :
+            i += 1
+    write_seq(anchor, n, 0, 0)
+    return out
+
+#-------------------------------------------------------------------------------
+def write_array(f, data) :
+    num = 0
+    for byte in data :
+        f.write(hex(byte) + ', ')
+        num += 1
+        if 0 == num%16:
+            f.write('\n')
+
+#-------------------------------------------------------------------------------
+def write_string(f, data) :
+    for i in range(0, len(data), 32) :
+        f.write('"' + ''.join('\\x{:02x}'.format(b) for b in data[i:i+32]) + '"\n')
+
 #------------------------------------------------------------------------------
-def gen_header(out_hdr, files) :
-    
+def gen_header(out_hdr, files, prefix) :
+
     with open(out_hdr, 'w') as f:
         f.write('#pragma once\n')
         f.write('// #version:{}#\n'.format(Version))
@@ -39,38 +139,79 @@ def gen_header(out_hdr, files) :
                 num_items += 1
             else :
                 genutil.fmtError("Input file not found: '{}'".format(file_path))
+        f.write('#ifndef DUMP_ITEM_DEFINED\n')
+        f.write('#define DUMP_ITEM_DEFINED\n')
         f.write('typedef struct { const char* name; const uint8_t* ptr; int size; } dump_item;\n')
-        f.write('#define DUMP_NUM_ITEMS ({})\n'.format(num_items))
-        f.write('extern dump_item dump_items[DUMP_NUM_ITEMS];\n')
+        f.write('#endif\n')
+        f.write('#define {} ({})\n'.format(get_num_items_cname(prefix), num_items))
+        f.write('extern dump_item {}[{}];\n'.format(get_items_cname(prefix), get_num_items_cname(prefix)))
+
+#-------------------------------------------------------------------------------
+def gen_lz4_decoder(f, prefix, names) :
+    init = get_init_cname(prefix)
+    f.write('#include <string.h>\n')
+    f.write('static void _{}_lz4(const unsigned char* src, int src_size, unsigned char* dst) {{\n'.format(init))
+    f.write('    const unsigned char* end = src + src_size;\n')
+    f.write('    while (src < end) {\n')
+    f.write('        const unsigned char token = *src++;\n')
+    f.write('        int len = token >> 4;\n')
+    f.write('        if (len == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }\n')
+    f.write('        memcpy(dst, src, len); dst += len; src += len;\n')
+    f.write('        if (src >= end) { break; }\n')
+    f.write('        const unsigned char* m = dst - (src[0] | (src[1]<<8)); src += 2;\n')
+    f.write('        len = (token & 15) + 4;\n')
+    f.write('        if ((token & 15) == 15) { unsigned char b; do { b = *src++; len += b; } while (b == 255); }\n')
+    f.write('        while (len-- > 0) { *dst++ = *m++; }\n')
+    f.write('    }\n')
+    f.write('}\n')
+    f.write('static void {}(void) {{\n'.format(init))
+    for name in names :
+        f.write('    _{}_lz4({}_lz4, sizeof({}_lz4) - 1, {});\n'.format(init, name, name, name))
+    f.write('}\n')
+    # run the decompression before main()
+    f.write('#if defined(_MSC_VER)\n')
+    f.write('#pragma section(".CRT$XCU", read)\n')
+    f.write('__declspec(allocate(".CRT$XCU")) void (*_{}_ctor)(void) = {};\n'.format(init, init))
+    f.write('#else\n')
+    f.write('__attribute__((constructor)) static void _{}_ctor(void) {{ {}(); }}\n'.format(init, init))
+    f.write('#endif\n')
 
 #-------------------------------------------------------------------------------
-def gen_source(out_src, files) :
+def gen_source(out_src, files, prefix, fmt, compress) :
 
     with open(out_src, 'w') as f:
         f.write('// #version:{}#\n'.format(Version))
         f.write('// machine generated, do not edit!\n')
         f.write('#include "{}.h"\n'.format(os.path.splitext(os.path.basename(out_src))[0]))
-        items = {}
+        items = []
         for file in files :
             file_path = get_file_path(file, out_src)
             if os.path.isfile(file_path) :
                 with open(file_path, 'rb') as src_file:
-                    file_data = src_file.read()
+                    file_data = bytearray(src_file.read())
                     file_name = get_file_cname(file)
-                    file_size = os.path.getsize(file_path)
-                    items[file_name] = file_size
-                    f.write('unsigned char {}[{}] = {{\n'.format(file_name, file_size))               
-                    num = 0
-                    for byte in file_data :
-                        f.write(hex(ord(byte)) + ', ')
-                        num += 1
-                        if 0 == num%16:
-                            f.write('\n')
-                    f.write('\n};\n')
+                    file_size = len(file_data)
+                    items.append((file_name, file_size))
+                    if compress == 'lz4' :
+                        lz4_data = lz4_compress(file_data)
+                        f.write('static const unsigned char {}_lz4[] =\n'.format(file_name))
+                        write_string(f, lz4_data)
+                        f.write(';\n')
+                        f.write('unsigned char {}[{}];\n'.format(file_name, file_size))
+                    elif fmt == 'string' :
+                        f.write('unsigned char {}[{}] =\n'.format(file_name, file_size))
+                        write_string(f, file_data)
+                        f.write(';\n')
+                    else :
+                        f.write('unsigned char {}[{}] = {{\n'.format(file_name, file_size))
+                        write_array(f, file_data)
+                        f.write('\n};\n')
             else :
                 genutil.fmtError("Input file not found: '{}'".format(file_path))
-        f.write('dump_item dump_items[DUMP_NUM_ITEMS] = {\n')
-        for name,size in items.items():
+        if compress == 'lz4' :
+            gen_lz4_decoder(f, prefix, [name for name,size in items])
+        f.write('dump_item {}[{}] = {{\n'.format(get_items_cname(prefix), get_num_items_cname(prefix)))
+        for name,size in items:
             f.write('{{ "{}", {}, {} }},\n'.format(name[5:], name, size))
         f.write('};\n')
 
@@ -79,5 +220,12 @@ def generate(input, out_src, out_hdr) :
     if genutil.isDirty(Version, [input], [out_src, out_hdr]) :
         with open(input, 'r') as f :
             desc = yaml.load(f)
-        gen_header(out_hdr, desc['files'])
-        gen_source(out_src, desc['files'])
+        prefix = desc.get('prefix', None)
+        fmt = desc.get('format', 'array')
+        compress = desc.get('compress', None)
+        if fmt not in ('array', 'string') :
+            genutil.fmtError("Unknown format '{}' in '{}'".format(fmt, input))
+        if compress not in (None, 'lz4') :
+            genutil.fmtError("Unknown compression '{}' in '{}'".format(compress, input))
+        gen_header(out_hdr, desc['files'], prefix)
+        gen_source(out_src, desc['files'], prefix, fmt, compress)
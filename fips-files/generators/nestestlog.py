@@ -1,44 +1,76 @@
 #-------------------------------------------------------------------------------
 #   nestestlog.py
 #   Parses the nestest.log text file (http://www.qmtpro.com/~nes/misc/nestest.log)
-#   into a C array.
+#   into a packed binary trace and a C header with rolling state hashes.
+#
+#   The binary trace (same name as the header, with .bin extension) has
+#   7 bytes per instruction: PC (little endian), A, X, Y, P, S. It is
+#   loaded at runtime, so that long traces don't need to be compiled in.
+#
+#   The header only contains the number of states, and an FNV-1a hash
+#   over the packed states, taken every HashInterval instructions
+#   (the hash is not reset between checkpoints).
 #-------------------------------------------------------------------------------
 
-Version = 5
+Version = 6
+
+HashInterval = 64
 
 import os.path
 import yaml
 import genutil
 
 #-------------------------------------------------------------------------------
-def gen_header(in_log, out_hdr):
+def parse_log(in_log):
+    states = bytearray()
+    with open(in_log, 'r') as fi:
+        for line in fi.readlines():
+            pc = int(line[0:4], 16)
+            states.append(pc & 0xFF)
+            states.append(pc >> 8)
+            states.append(int(line[50:52], 16))     # A
+            states.append(int(line[55:57], 16))     # X
+            states.append(int(line[60:62], 16))     # Y
+            states.append(int(line[65:67], 16))     # P
+            states.append(int(line[71:73], 16))     # S
+    return states
+
+#-------------------------------------------------------------------------------
+def rolling_hashes(states):
+    hashes = []
+    h = 0x811C9DC5
+    num_states = len(states) // 7
+    for i in range(num_states):
+        for b in states[i*7:(i+1)*7]:
+            h = ((h ^ b) * 0x01000193) & 0xFFFFFFFF
+        if ((i + 1) % HashInterval == 0) or (i + 1 == num_states):
+            hashes.append(h)
+    return hashes
 
+#-------------------------------------------------------------------------------
+def gen_header(states, out_hdr, out_bin):
+    hashes = rolling_hashes(states)
     with open(out_hdr, 'w') as f:
         f.write('// #version:{}#\n'.format(Version))
         f.write('// machine generated, do not edit!\n')
         f.write('#include <stdint.h>\n')
-        f.write('typedef struct {\n')
-        f.write('    const char* desc;\n')
-        f.write('    uint16_t PC;\n')
-        f.write('    uint8_t A,X,Y,P,S;\n')
-        f.write('} cpu_state;\n');
-        f.write('cpu_state state_table[] = {\n')
-        lines = []
-        with open(in_log, 'r') as fi:
-            lines = fi.readlines()
-        for line in lines :
-            f.write('  {{ "{}", 0x{},0x{},0x{},0x{},0x{},0x{} }},\n'.format(
-                line[16:48],    # desc
-                line[0:4],      # PC
-                line[50:52],    # A
-                line[55:57],    # X
-                line[60:62],    # Y
-                line[65:67],    # P
-                line[71:73]))   # S
-        f.write('};\n')
+        f.write('#define NESTESTLOG_TRACE_FILE "{}"\n'.format(os.path.basename(out_bin)))
+        f.write('#define NESTESTLOG_STATE_SIZE (7)\n')
+        f.write('#define NESTESTLOG_NUM_STATES ({})\n'.format(len(states) // 7))
+        f.write('#define NESTESTLOG_HASH_INTERVAL ({})\n'.format(HashInterval))
+        f.write('#define NESTESTLOG_NUM_HASHES ({})\n'.format(len(hashes)))
+        f.write('static const uint32_t nestestlog_hashes[NESTESTLOG_NUM_HASHES] = {\n')
+        for i, h in enumerate(hashes):
+            f.write('0x{:08X},'.format(h))
+            if (i % 8) == 7:
+                f.write('\n')
+        f.write('\n};\n')
 
 #-------------------------------------------------------------------------------
 def generate(input, out_src, out_hdr):
-    if genutil.isDirty(Version, [input], [out_hdr]):
-        gen_header(input, out_hdr)
-
+    out_bin = os.path.splitext(out_hdr)[0] + '.bin'
+    if genutil.isDirty(Version, [input], [out_hdr]) or not os.path.isfile(out_bin):
+        states = parse_log(input)
+        with open(out_bin, 'wb') as f:
+            f.write(states)
+        gen_header(states, out_hdr, out_bin)
@@ -0,0 +1,177 @@
+"""fips verb to run all test programs concurrently with a timing report"""
+
+import os
+import re
+import sys
+import json
+import time
+import threading
+import multiprocessing
+import subprocess
+
+from mod import log, util, settings
+
+# benchmarks are also cmdline targets in tests/, but they aren't tests
+ExcludeSuffixes = [ '-bench' ]
+# a test has regressed if it is this much slower than in the baseline...
+DefaultThreshold = 1.5
+# ...and at least this many seconds slower (short tests are too noisy)
+MinRegressionSec = 0.1
+
+#-------------------------------------------------------------------------------
+def find_tests(proj_dir) :
+    """get the test program names from the cmdline apps in tests/CMakeLists.txt"""
+    with open(proj_dir + '/tests/CMakeLists.txt', 'r') as f :
+        names = re.findall(r'fips_begin_app\((\S+)\s+cmdline\)', f.read())
+    return [n for n in names if not any(n.endswith(s) for s in ExcludeSuffixes)]
+
+#-------------------------------------------------------------------------------
+def run_test(deploy_dir, name, result) :
+    exe = '{}/{}'.format(deploy_dir, name)
+    if util.get_host_platform() == 'win' :
+        exe += '.exe'
+    if not os.path.isfile(exe) :
+        result.update(status='missing', exit_code=None, seconds=0.0, output='')
+        return
+    start = time.time()
+    p = subprocess.Popen([exe], cwd=deploy_dir, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    output = p.communicate()[0]
+    seconds = time.time() - start
+    result.update(status='ok' if p.returncode == 0 else 'failed',
+        exit_code=p.returncode, seconds=seconds,
+        output=output.decode('utf-8', 'replace'))
+
+#-------------------------------------------------------------------------------
+def run_all(deploy_dir, names, num_jobs) :
+    """run the tests on num_jobs worker threads, returns the results in test order"""
+    results = [{ 'name': n } for n in names]
+    lock = threading.Lock()
+    pending = list(range(len(names)))
+    def worker() :
+        while True :
+            with lock :
+                if not pending :
+                    return
+                i = pending.pop(0)
+            run_test(deploy_dir, names[i], results[i])
+            with lock :
+                log.info('> {}: {} ({:.2f}s)'.format(names[i], results[i]['status'], results[i]['seconds']))
+    threads = [threading.Thread(target=worker) for _ in range(num_jobs)]
+    for t in threads :
+        t.start()
+    for t in threads :
+        t.join()
+    return results
+
+#-------------------------------------------------------------------------------
+def check_baseline(results, baseline_path, threshold) :
+    """flag the tests which are slower than in the baseline"""
+    with open(baseline_path, 'r') as f :
+        baseline = dict((t['name'], t['seconds']) for t in json.load(f)['tests'])
+    for r in results :
+        base = baseline.get(r['name'])
+        r['baseline_seconds'] = base
+        r['regressed'] = (base is not None) and (r['status'] == 'ok') and \
+            (r['seconds'] > base * threshold) and ((r['seconds'] - base) > MinRegressionSec)
+
+#-------------------------------------------------------------------------------
+def print_summary(results, wall_sec) :
+    log.info('\n{:<20} {:<8} {:>10} {:>10}'.format('test', 'status', 'seconds', 'baseline'))
+    for r in results :
+        base = r.get('baseline_seconds')
+        line = '{:<20} {:<8} {:>10.2f} {:>10}'.format(r['name'], r['status'], r['seconds'],
+            '{:.2f}'.format(base) if base is not None else '-')
+        if r['status'] != 'ok' :
+            log.colored(log.RED, line)
+        elif r.get('regressed') :
+            log.colored(log.YELLOW, line + '  <== REGRESSED')
+        else :
+            log.info(line)
+    num_ok = len([r for r in results if r['status'] == 'ok'])
+    serial_sec = sum(r['seconds'] for r in results)
+    log.info('\n{} of {} tests passed, {:.2f}s wall time ({:.2f}s if run one by one)'.format(
+        num_ok, len(results), wall_sec, serial_sec))
+
+#-------------------------------------------------------------------------------
+def run(fips_dir, proj_dir, args) :
+    num_jobs = 0
+    cfg = settings.get(proj_dir, 'config')
+    json_path = None
+    baseline_path = None
+    save_baseline_path = None
+    threshold = DefaultThreshold
+    show_output = False
+    i = 0
+    while i < len(args) :
+        a = args[i]
+        if a == '-j' and i + 1 < len(args) :
+            i += 1
+            num_jobs = int(args[i])
+        elif a == '-json' and i + 1 < len(args) :
+            i += 1
+            json_path = args[i]
+        elif a == '-baseline' and i + 1 < len(args) :
+            i += 1
+            baseline_path = args[i]
+        elif a == '-save-baseline' and i + 1 < len(args) :
+            i += 1
+            save_baseline_path = args[i]
+        elif a == '-threshold' and i + 1 < len(args) :
+            i += 1
+            threshold = float(args[i])
+        elif a == '-v' :
+            show_output = True
+        elif not a.startswith('-') :
+            cfg = a
+        else :
+            log.error("invalid arg '{}', see 'fips help testrun'".format(a))
+        i += 1
+    if num_jobs <= 0 :
+        num_jobs = multiprocessing.cpu_count()
+
+    ws_dir = util.get_workspace_dir(fips_dir)
+    deploy_dir = '{}/fips-deploy/chips-test/{}'.format(ws_dir, cfg)
+    if not json_path :
+        json_path = deploy_dir + '/testrun.json'
+    names = find_tests(proj_dir)
+    log.colored(log.YELLOW, '=== running {} tests from {} on {} threads'.format(len(names), deploy_dir, num_jobs))
+    start = time.time()
+    results = run_all(deploy_dir, names, num_jobs)
+    wall_sec = time.time() - start
+    if baseline_path :
+        check_baseline(results, baseline_path, threshold)
+    if show_output :
+        for r in results :
+            if r['status'] == 'failed' :
+                log.colored(log.RED, '\n=== output of {}:'.format(r['name']))
+                log.info(r['output'])
+    print_summary(results, wall_sec)
+
+    report = {
+        'config': cfg,
+        'jobs': num_jobs,
+        'wall_seconds': wall_sec,
+        'threshold': threshold,
+        'tests': [dict((k, v) for k, v in r.items() if k != 'output') for r in results]
+    }
+    with open(json_path, 'w') as f :
+        json.dump(report, f, indent=2, sort_keys=True)
+    log.info("wrote summary to '{}'".format(json_path))
+    if save_baseline_path :
+        with open(save_baseline_path, 'w') as f :
+            json.dump(report, f, indent=2, sort_keys=True)
+        log.info("saved baseline to '{}'".format(save_baseline_path))
+    failed = any(r['status'] != 'ok' for r in results)
+    regressed = any(r.get('regressed') for r in results)
+    if failed or regressed :
+        sys.exit(10)
+
+#-------------------------------------------------------------------------------
+def help() :
+    log.info(log.YELLOW +
+             'fips testrun [config] [-j threads] [-json file] [-baseline file] [-save-baseline file] [-threshold factor] [-v]\n' +
+             log.DEF +
+             '    run all test programs from tests/ concurrently (built with fips build),\n' +
+             '    print a summary and write it as JSON (default: testrun.json in the\n' +
+             '    deploy dir), with -baseline, tests slower than threshold (default 1.5)\n' +
+             '    times their baseline time are flagged as regressed')
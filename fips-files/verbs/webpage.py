@@ -19,9 +19,11 @@ samples = [
 ]
 GitHubSamplesURL = 'https://github.com/floooh/chips-test/master/examples'
 BuildConfig = 'wasm-ninja-release'
+# WASM SIMD and pthreads, needs to be served with the COOP/COEP headers
+MTBuildConfig = 'wasm-ninja-mt-release'
 
 #-------------------------------------------------------------------------------
-def deploy_webpage(fips_dir, proj_dir, webpage_dir) :
+def deploy_webpage(fips_dir, proj_dir, webpage_dir, build_config) :
     """builds the final webpage under under fips-deploy/chips-webpage"""
     ws_dir = util.get_workspace_dir(fips_dir)
 
@@ -40,7 +42,7 @@ def deploy_webpage(fips_dir, proj_dir, webpage_dir) :
         content += '<div class="thumb">\n'
         content += '  <div class="thumb-title">{}</div>\n'.format(display_name)
         content += '  <div class="img-frame"><a href="{}.html"><img class="image" src="{}"></img></a></div>\n'.format(name,img_name)
-        content += '  <div class="thumb-bar">{}</div>\n'.format(note)
+        content += '  <div class="thumb-bar">{} <a class="main-menu-link" href="{}-bench.html">[bench]</a></div>\n'.format(note, name)
         content += '</div>\n'
 
     # populate the html template, and write to the build directory
@@ -63,12 +65,12 @@ def deploy_webpage(fips_dir, proj_dir, webpage_dir) :
         shutil.copy(proj_dir + '/webpage/' + name, webpage_dir + '/' + name)
 
     # generate sample HTML pages
-    emsc_deploy_dir = '{}/fips-deploy/chips-test/{}'.format(ws_dir, BuildConfig)
+    emsc_deploy_dir = '{}/fips-deploy/chips-test/{}'.format(ws_dir, build_config)
     for sample in samples :
         display_name = sample[0]
         name = sample[1]
         log.info('> generate emscripten HTML page: {}'.format(name))
-        for ext in ['wasm', 'js'] :
+        for ext in ['wasm', 'js', 'worker.js'] :
             src_path = '{}/{}.{}'.format(emsc_deploy_dir, name, ext)
             if os.path.isfile(src_path) :
                 shutil.copy(src_path, '{}/'.format(webpage_dir))
@@ -78,6 +80,18 @@ def deploy_webpage(fips_dir, proj_dir, webpage_dir) :
         html = templ.safe_substitute(name=display_name, prog=name, source=src_url)
         with open('{}/{}.html'.format(webpage_dir, name, name), 'w') as f :
             f.write(html)
+        # and the benchmark page, which runs chips-bench on this system
+        with open(proj_dir + '/webpage/bench.html', 'r') as f :
+            templ = Template(f.read())
+        html = templ.safe_substitute(name=display_name, prog=name)
+        with open('{}/{}-bench.html'.format(webpage_dir, name), 'w') as f :
+            f.write(html)
+
+    # the headless benchmark used by the benchmark pages
+    for ext in ['wasm', 'js', 'worker.js'] :
+        src_path = '{}/chips-bench.{}'.format(emsc_deploy_dir, ext)
+        if os.path.isfile(src_path) :
+            shutil.copy(src_path, '{}/'.format(webpage_dir))
 
     # copy the screenshots
     for sample in samples :
@@ -88,7 +102,7 @@ def deploy_webpage(fips_dir, proj_dir, webpage_dir) :
             shutil.copy(img_path, webpage_dir + '/' + img_name)
 
 #-------------------------------------------------------------------------------
-def build_deploy_webpage(fips_dir, proj_dir, rebuild) :
+def build_deploy_webpage(fips_dir, proj_dir, rebuild, build_config) :
     # if webpage dir exists, clear it first
     ws_dir = util.get_workspace_dir(fips_dir)
     webpage_dir = '{}/fips-deploy/chips-webpage'.format(ws_dir)
@@ -99,11 +113,11 @@ def build_deploy_webpage(fips_dir, proj_dir, rebuild) :
         os.makedirs(webpage_dir)
 
     # compile samples
-    project.gen(fips_dir, proj_dir, BuildConfig)
-    project.build(fips_dir, proj_dir, BuildConfig)
+    project.gen(fips_dir, proj_dir, build_config)
+    project.build(fips_dir, proj_dir, build_config)
     
     # deploy the webpage
-    deploy_webpage(fips_dir, proj_dir, webpage_dir)
+    deploy_webpage(fips_dir, proj_dir, webpage_dir, build_config)
 
     log.colored(log.GREEN, 'Generated Samples web page under {}.'.format(webpage_dir))
 
@@ -137,10 +151,11 @@ def serve_webpage(fips_dir, proj_dir) :
 #-------------------------------------------------------------------------------
 def run(fips_dir, proj_dir, args) :
     if len(args) > 0 :
+        build_config = MTBuildConfig if (len(args) > 1 and args[1] == 'mt') else BuildConfig
         if args[0] == 'build' :
-            build_deploy_webpage(fips_dir, proj_dir, False)
+            build_deploy_webpage(fips_dir, proj_dir, False, build_config)
         elif args[0] == 'rebuild' :
-            build_deploy_webpage(fips_dir, proj_dir, True)
+            build_deploy_webpage(fips_dir, proj_dir, True, build_config)
         elif args[0] == 'serve' :
             serve_webpage(fips_dir, proj_dir)
         else :
@@ -151,9 +166,10 @@ def run(fips_dir, proj_dir, args) :
 #-------------------------------------------------------------------------------
 def help() :
     log.info(log.YELLOW +
-             'fips webpage build\n' +
-             'fips webpage rebuild\n' +
+             'fips webpage build [mt]\n' +
+             'fips webpage rebuild [mt]\n' +
              'fips webpage serve\n' +
              log.DEF +
-             '    build chips samples webpage')
+             '    build chips samples webpage\n' +
+             '    (mt: WASM SIMD and pthreads, the page must be served cross-origin isolated)')
 
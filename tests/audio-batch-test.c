@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+//  audio-batch-test.c
+//
+//  Tests the batched audio synthesis of the C64, CPC and ZX Spectrum (the
+//  SID, AY-3-8912 and beeper ticks are deferred until the CPU accesses the
+//  audio chip or the frame ends) against ticking the audio chips with the
+//  CPU: while booting and while a program plays a tone with a changing
+//  frequency, the samples must be bit-identical.
+//------------------------------------------------------------------------------
+// force assert() enabled
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#define CHIPS_IMPL
+#include "systems/c64.h"
+#include "systems/cpc6128.h"
+#include "systems/zx128k.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+uint32_t num_tests = 0;
+#define T(x) { assert(x); num_tests++; }
+
+#define NUM_BOOT_FRAMES (150)
+#define NUM_PROG_FRAMES (100)
+
+/* C000: LDA #$0F; STA $D418; LDA #0; STA $D405; LDA #$F0; STA $D406; LDA #$21; STA $D404;
+         loop: INC $D401; LDY #0; dly: DEY; BNE dly; JMP loop
+*/
+static const uint8_t c64_prog[] = {
+    0xA9, 0x0F, 0x8D, 0x18, 0xD4, 0xA9, 0x00, 0x8D, 0x05, 0xD4, 0xA9, 0xF0, 0x8D, 0x06, 0xD4, 0xA9, 0x21, 0x8D, 0x04, 0xD4,
+    0xEE, 0x01, 0xD4, 0xA0, 0x00, 0x88, 0xD0, 0xFD, 0x4C, 0x14, 0xC0,
+};
+/* 4000: DI; LD BC,F782h; OUT (C),C; loop: LD A,7; LD E,3Eh; CALL wr; LD A,8; LD E,0Fh; CALL wr; XOR A; LD E,D; CALL wr;
+         INC D; LD L,0; dly: DEC L; JR NZ,dly; JR loop;
+         wr: LD B,F4h; OUT (C),A; LD BC,F6C0h; OUT (C),C; LD BC,F600h; OUT (C),C;
+             LD B,F4h; OUT (C),E; LD BC,F680h; OUT (C),C; LD BC,F600h; OUT (C),C; RET
+*/
+static const uint8_t cpc_prog[] = {
+    0xF3, 0x01, 0x82, 0xF7, 0xED, 0x49, 0x3E, 0x07, 0x1E, 0x3E, 0xCD, 0x21, 0x40, 0x3E, 0x08, 0x1E, 0x0F, 0xCD, 0x21, 0x40,
+    0xAF, 0x5A, 0xCD, 0x21, 0x40, 0x14, 0x2E, 0x00, 0x2D, 0x20, 0xFD, 0x18, 0xE5,
+    0x06, 0xF4, 0xED, 0x79, 0x01, 0xC0, 0xF6, 0xED, 0x49, 0x01, 0x00, 0xF6, 0xED, 0x49,
+    0x06, 0xF4, 0xED, 0x59, 0x01, 0x80, 0xF6, 0xED, 0x49, 0x01, 0x00, 0xF6, 0xED, 0x49, 0xC9,
+};
+/* 8000: DI; LD BC,FFFDh; LD A,7; OUT (C),A; LD B,BFh; LD A,3Eh; OUT (C),A; LD B,FFh; LD A,8; OUT (C),A; LD B,BFh; LD A,0Fh; OUT (C),A;
+         loop: LD B,FFh; XOR A; OUT (C),A; LD B,BFh; LD A,D; OUT (C),A; INC D; LD A,D; AND 10h; OUT (FEh),A;
+         LD E,0; dly: DEC E; JR NZ,dly; JR loop
+*/
+static const uint8_t zx_prog[] = {
+    0xF3, 0x01, 0xFD, 0xFF, 0x3E, 0x07, 0xED, 0x79, 0x06, 0xBF, 0x3E, 0x3E, 0xED, 0x79, 0x06, 0xFF, 0x3E, 0x08, 0xED, 0x79,
+    0x06, 0xBF, 0x3E, 0x0F, 0xED, 0x79, 0x06, 0xFF, 0xAF, 0xED, 0x79, 0x06, 0xBF, 0x7A, 0xED, 0x79, 0x14, 0x7A, 0xE6, 0x10,
+    0xD3, 0xFE, 0x1E, 0x00, 0x1D, 0x20, 0xFD, 0x18, 0xE9,
+};
+
+/* FNV-1a hash over the bits of all samples passed to the audio callback of the instance being run */
+uint64_t audio_hash[2];
+uint32_t audio_count[2];
+int audio_cur;
+void audio_cb(const float* samples, int num_samples) {
+    uint64_t h = audio_hash[audio_cur];
+    for (int i = 0; i < num_samples; i++) {
+        uint32_t bits;
+        memcpy(&bits, &samples[i], sizeof(bits));
+        h = (h ^ bits) * 0x100000001B3ULL;
+    }
+    audio_hash[audio_cur] = h;
+    audio_count[audio_cur] += (uint32_t)num_samples;
+}
+
+void c64_init_audio(void* sys, uint32_t* fb, uint32_t fb_size, bool batching) {
+    c64_init((c64_t*)sys, &(c64_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .audio_cb = audio_cb, .disable_audio_batching = !batching });
+}
+void c64_start_prog(void* sys) {
+    memcpy(&((c64_t*)sys)->ram[0xC000], c64_prog, sizeof(c64_prog));
+    ((c64_t*)sys)->cpu.state.PC = 0xC000;
+}
+uint32_t c64_exec_audio(void* sys, uint32_t ticks) {
+    return c64_exec((c64_t*)sys, ticks);
+}
+void cpc_init_audio(void* sys, uint32_t* fb, uint32_t fb_size, bool batching) {
+    cpc_init((cpc_t*)sys, &(cpc_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .audio_cb = audio_cb, .disable_audio_batching = !batching });
+}
+void cpc_start_prog(void* sys) {
+    mem_write_range(&((cpc_t*)sys)->mem, 0x4000, cpc_prog, sizeof(cpc_prog));
+    ((cpc_t*)sys)->cpu.state.PC = 0x4000;
+}
+uint32_t cpc_exec_audio(void* sys, uint32_t ticks) {
+    return cpc_exec((cpc_t*)sys, ticks);
+}
+void zx_init_audio(void* sys, uint32_t* fb, uint32_t fb_size, bool batching) {
+    zx_init((zx128k_t*)sys, &(zx_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .audio_cb = audio_cb, .disable_audio_batching = !batching });
+}
+void zx_start_prog(void* sys) {
+    mem_write_range(&((zx128k_t*)sys)->mem, 0x8000, zx_prog, sizeof(zx_prog));
+    ((zx128k_t*)sys)->cpu.state.PC = 0x8000;
+}
+uint32_t zx_exec_audio(void* sys, uint32_t ticks) {
+    return zx_exec((zx128k_t*)sys, ticks);
+}
+
+typedef struct {
+    size_t size;
+    uint32_t fb_size;
+    uint32_t ticks_per_frame;
+    void (*init)(void* sys, uint32_t* fb, uint32_t fb_size, bool batching);
+    void (*prog)(void* sys);
+    uint32_t (*exec)(void* sys, uint32_t ticks);
+} audio_system_t;
+
+void test_audio_batch(const audio_system_t* desc) {
+    void* sys[2] = { thread_aligned_calloc(desc->size), thread_aligned_calloc(desc->size) };
+    uint32_t* fb[2] = { (uint32_t*) calloc(1, desc->fb_size), (uint32_t*) calloc(1, desc->fb_size) };
+    T(sys[0] && sys[1] && fb[0] && fb[1]);
+    uint32_t overrun_ticks[2] = { 0, 0 };
+    for (int i = 0; i < 2; i++) {
+        audio_hash[i] = 0xCBF29CE484222325ULL;
+        audio_count[i] = 0;
+        desc->init(sys[i], fb[i], desc->fb_size, 0 != i);
+    }
+    for (int frame = 0; frame < NUM_BOOT_FRAMES + NUM_PROG_FRAMES; frame++) {
+        for (int i = 0; i < 2; i++) {
+            if (frame == NUM_BOOT_FRAMES) {
+                desc->prog(sys[i]);
+            }
+            const uint32_t ticks_to_run = desc->ticks_per_frame - overrun_ticks[i];
+            audio_cur = i;
+            overrun_ticks[i] = desc->exec(sys[i], ticks_to_run) - ticks_to_run;
+        }
+    }
+    T(audio_count[0] > 0);
+    T(audio_count[0] == audio_count[1]);
+    T(audio_hash[0] == audio_hash[1]);
+    T(0 == memcmp(fb[0], fb[1], desc->fb_size));
+    thread_aligned_free(sys[0]); thread_aligned_free(sys[1]);
+    free(fb[0]); free(fb[1]);
+}
+
+int main() {
+    test_audio_batch(&(audio_system_t){
+        sizeof(c64_t), C64_DISP_WIDTH * C64_DISP_HEIGHT * sizeof(uint32_t), C64_FREQ / 50,
+        c64_init_audio, c64_start_prog, c64_exec_audio
+    });
+    test_audio_batch(&(audio_system_t){
+        sizeof(cpc_t), CPC_DISP_WIDTH * CPC_DISP_HEIGHT * sizeof(uint32_t), CPC_FREQ / 50,
+        cpc_init_audio, cpc_start_prog, cpc_exec_audio
+    });
+    test_audio_batch(&(audio_system_t){
+        sizeof(zx128k_t), ZX128K_DISP_WIDTH * ZX128K_DISP_HEIGHT * sizeof(uint32_t), ZX128K_FREQ / 50,
+        zx_init_audio, zx_start_prog, zx_exec_audio
+    });
+    printf("%d tests run ok.\n", num_tests);
+    return 0;
+}
@@ -0,0 +1,100 @@
+//------------------------------------------------------------------------------
+//  debugger-test.c
+//
+//  Tests the debugger hooks of examples/common/debugger.h in the C64 and CPC
+//  tick callbacks: with an empty debugger, and with a breakpoint on the reset
+//  entry point and a write watchpoint, the emulation must be identical to
+//  running without a debugger, and the breakpoint and watchpoint must be hit.
+//------------------------------------------------------------------------------
+// force assert() enabled
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#define CHIPS_IMPL
+#include "systems/c64.h"
+#include "systems/cpc6128.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+uint32_t num_tests = 0;
+#define T(x) { assert(x); num_tests++; }
+
+#define NUM_FRAMES (150)
+
+void c64_init_dbg(void* sys, uint32_t* fb, uint32_t fb_size, dbg_t* dbg) {
+    c64_init((c64_t*)sys, &(c64_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .dbg = dbg });
+}
+uint32_t c64_exec_dbg(void* sys, uint32_t ticks) {
+    return c64_exec((c64_t*)sys, ticks);
+}
+void cpc_init_dbg(void* sys, uint32_t* fb, uint32_t fb_size, dbg_t* dbg) {
+    cpc_init((cpc_t*)sys, &(cpc_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .dbg = dbg });
+}
+uint32_t cpc_exec_dbg(void* sys, uint32_t ticks) {
+    return cpc_exec((cpc_t*)sys, ticks);
+}
+
+typedef struct {
+    size_t size;
+    uint32_t fb_size;
+    uint32_t ticks_per_frame;
+    uint16_t break_addr;        /* the reset entry point */
+    uint16_t watch_addr;        /* written during boot */
+    void (*init)(void* sys, uint32_t* fb, uint32_t fb_size, dbg_t* dbg);
+    uint32_t (*exec)(void* sys, uint32_t ticks);
+} dbg_system_t;
+
+void test_debugger(const dbg_system_t* desc) {
+    /* 0: no debugger, 1: empty debugger, 2: breakpoint and watchpoint */
+    void* sys[3];
+    uint32_t* fb[3];
+    dbg_t dbg[2];
+    uint32_t overrun_ticks[3] = { 0, 0, 0 };
+    dbg_init(&dbg[0]);
+    dbg_init(&dbg[1]);
+    dbg_add_breakpoint(&dbg[1], desc->break_addr);
+    dbg_add_watchpoint(&dbg[1], desc->watch_addr, 1, DBG_WATCH_WRITE);
+    for (int i = 0; i < 3; i++) {
+        sys[i] = thread_aligned_calloc(desc->size);
+        fb[i] = (uint32_t*) calloc(1, desc->fb_size);
+        T(sys[i] && fb[i]);
+        desc->init(sys[i], fb[i], desc->fb_size, (i > 0) ? &dbg[i - 1] : 0);
+    }
+    bool hit_break = false;
+    bool hit_watch = false;
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        for (int i = 0; i < 3; i++) {
+            const uint32_t ticks_to_run = desc->ticks_per_frame - overrun_ticks[i];
+            overrun_ticks[i] = desc->exec(sys[i], ticks_to_run) - ticks_to_run;
+        }
+        /* record the first hit per frame and continue */
+        if (dbg_stopped(&dbg[1])) {
+            hit_break |= (DBG_HIT_BREAK == dbg[1].hit);
+            hit_watch |= (DBG_HIT_WRITE == dbg[1].hit);
+            dbg_resume(&dbg[1]);
+        }
+    }
+    T(0 == dbg[0].num_hits);
+    T(hit_break);
+    T(hit_watch);
+    T(0 == memcmp(fb[0], fb[1], desc->fb_size));
+    T(0 == memcmp(fb[0], fb[2], desc->fb_size));
+    for (int i = 0; i < 3; i++) {
+        thread_aligned_free(sys[i]);
+        free(fb[i]);
+    }
+}
+
+int main() {
+    test_debugger(&(dbg_system_t){
+        sizeof(c64_t), C64_DISP_WIDTH * C64_DISP_HEIGHT * sizeof(uint32_t), C64_FREQ / 50,
+        0xFCE2, 0xD020, c64_init_dbg, c64_exec_dbg
+    });
+    test_debugger(&(dbg_system_t){
+        sizeof(cpc_t), CPC_DISP_WIDTH * CPC_DISP_HEIGHT * sizeof(uint32_t), CPC_FREQ / 50,
+        0x0000, 0xC000, cpc_init_dbg, cpc_exec_dbg
+    });
+    printf("%d tests run ok.\n", num_tests);
+    return 0;
+}
@@ -0,0 +1,92 @@
+//------------------------------------------------------------------------------
+//  heatmap-test.c
+//
+//  Tests the per-page access counters of examples/common/heatmap.h in the
+//  C64 and CPC: the per-frame counts must add up to the totals, every kind
+//  of access must be counted, and the emulation must be identical to
+//  running without counters.
+//------------------------------------------------------------------------------
+// force assert() enabled
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#define CHIPS_IMPL
+#include "systems/c64.h"
+#include "systems/cpc6128.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+uint32_t num_tests = 0;
+#define T(x) { assert(x); num_tests++; }
+
+#define NUM_FRAMES (150)
+
+void c64_init_heatmap(void* sys, uint32_t* fb, uint32_t fb_size, heatmap_t* heatmap) {
+    c64_init((c64_t*)sys, &(c64_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .heatmap = heatmap });
+}
+uint32_t c64_exec_heatmap(void* sys, uint32_t ticks) {
+    return c64_exec((c64_t*)sys, ticks);
+}
+void cpc_init_heatmap(void* sys, uint32_t* fb, uint32_t fb_size, heatmap_t* heatmap) {
+    cpc_init((cpc_t*)sys, &(cpc_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size, .heatmap = heatmap });
+}
+uint32_t cpc_exec_heatmap(void* sys, uint32_t ticks) {
+    return cpc_exec((cpc_t*)sys, ticks);
+}
+
+typedef struct {
+    size_t size;
+    uint32_t fb_size;
+    uint32_t ticks_per_frame;
+    void (*init)(void* sys, uint32_t* fb, uint32_t fb_size, heatmap_t* heatmap);
+    uint32_t (*exec)(void* sys, uint32_t ticks);
+} heatmap_system_t;
+
+void test_heatmap(const heatmap_system_t* desc) {
+    heatmap_t* heatmap = (heatmap_t*) malloc(sizeof(heatmap_t));
+    heatmap_frame_t* frame_counts = (heatmap_frame_t*) malloc(sizeof(heatmap_frame_t));
+    void* sys[2] = { thread_aligned_calloc(desc->size), thread_aligned_calloc(desc->size) };
+    uint32_t* fb[2] = { (uint32_t*) calloc(1, desc->fb_size), (uint32_t*) calloc(1, desc->fb_size) };
+    T(heatmap && frame_counts && sys[0] && sys[1] && fb[0] && fb[1]);
+    heatmap_init(heatmap);
+    for (int i = 0; i < 2; i++) {
+        desc->init(sys[i], fb[i], desc->fb_size, (0 != i) ? heatmap : 0);
+    }
+    uint32_t overrun_ticks[2] = { 0, 0 };
+    uint64_t frame_sums[HEATMAP_NUM_KINDS] = { 0 };
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        for (int i = 0; i < 2; i++) {
+            const uint32_t ticks_to_run = desc->ticks_per_frame - overrun_ticks[i];
+            overrun_ticks[i] = desc->exec(sys[i], ticks_to_run) - ticks_to_run;
+        }
+        heatmap_frame(heatmap, frame_counts);
+        for (int k = 0; k < HEATMAP_NUM_KINDS; k++) {
+            for (int p = 0; p < 256; p++) {
+                frame_sums[k] += frame_counts->counts[k][p];
+            }
+        }
+    }
+    T(0 == memcmp(fb[0], fb[1], desc->fb_size));
+    for (int k = 0; k < HEATMAP_NUM_KINDS; k++) {
+        T(frame_sums[k] == heatmap_total(heatmap, k));
+        T(frame_sums[k] > 0);
+    }
+    thread_aligned_free(sys[0]); thread_aligned_free(sys[1]);
+    free(fb[0]); free(fb[1]);
+    free(heatmap);
+    free(frame_counts);
+}
+
+int main() {
+    test_heatmap(&(heatmap_system_t){
+        sizeof(c64_t), C64_DISP_WIDTH * C64_DISP_HEIGHT * sizeof(uint32_t), C64_FREQ / 50,
+        c64_init_heatmap, c64_exec_heatmap
+    });
+    test_heatmap(&(heatmap_system_t){
+        sizeof(cpc_t), CPC_DISP_WIDTH * CPC_DISP_HEIGHT * sizeof(uint32_t), CPC_FREQ / 50,
+        cpc_init_heatmap, cpc_exec_heatmap
+    });
+    printf("%d tests run ok.\n", num_tests);
+    return 0;
+}
@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+//  kc87-ctc-test.c
+//
+//  Tests the KC87's batched CTC ticks (see examples/common/ctcbatch.h)
+//  against ticking the CTC with the CPU, while booting and waiting in the
+//  OS prompt (the CTC drives the OS clock interrupt through the channel 2
+//  to 3 cascade): the framebuffer and RAM must match after every frame,
+//  and the CTC state at the end.
+//------------------------------------------------------------------------------
+// force assert() enabled
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#define CHIPS_IMPL
+#include "systems/kc87.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+uint32_t num_tests = 0;
+#define T(x) { assert(x); num_tests++; }
+
+#define NUM_FRAMES (300)
+
+int main() {
+    const uint32_t ticks_per_frame = KC87_FREQ / 50;
+    const uint32_t fb_size = KC87_DISP_WIDTH * KC87_DISP_HEIGHT * sizeof(uint32_t);
+    /* 0: per-tick, 1: batched */
+    kc87_t* sys[2] = { (kc87_t*) thread_aligned_calloc(sizeof(kc87_t)), (kc87_t*) thread_aligned_calloc(sizeof(kc87_t)) };
+    uint32_t* fb[2] = { (uint32_t*) calloc(1, fb_size), (uint32_t*) calloc(1, fb_size) };
+    T(sys[0] && sys[1] && fb[0] && fb[1]);
+    for (int i = 0; i < 2; i++) {
+        kc87_init(sys[i], &(kc87_desc_t){
+            .rgba8_buffer = fb[i],
+            .rgba8_buffer_size = fb_size,
+            .disable_ctc_batching = (0 == i)
+        });
+    }
+    uint32_t overrun_ticks[2] = { 0, 0 };
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        for (int i = 0; i < 2; i++) {
+            const uint32_t ticks_to_run = ticks_per_frame - overrun_ticks[i];
+            overrun_ticks[i] = kc87_exec(sys[i], ticks_to_run) - ticks_to_run;
+        }
+        T(0 == memcmp(fb[0], fb[1], fb_size));
+        T(0 == memcmp(sys[0]->mem, sys[1]->mem, sizeof(sys[0]->mem)));
+    }
+    /* apply the pending ticks of the batched CTC */
+    _kc87_ctc_catchup(sys[1]);
+    T(0 == memcmp(&sys[0]->ctc, &sys[1]->ctc, sizeof(z80ctc_t)));
+    thread_aligned_free(sys[0]); thread_aligned_free(sys[1]);
+    free(fb[0]); free(fb[1]);
+    printf("%d tests run ok.\n", num_tests);
+    return 0;
+}
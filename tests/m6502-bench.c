@@ -0,0 +1,184 @@
+//------------------------------------------------------------------------------
+//  m6502-bench.c
+//
+//  6502 core throughput for a few representative instruction mixes, with
+//  a trivial tick callback (flat 64 KB memory, no IO devices):
+//
+//      alu     accumulator arithmetic and logic, register increments
+//      copy    512-byte block copies with absolute indexed addressing
+//      mem     indirect indexed, zero page read-modify-write and stack accesses
+//      irq     IRQ every 200 ticks, acknowledged by the service routine
+//
+//  Usage:
+//
+//      m6502-bench [-r runs] [million-ticks]
+//
+//  Each mix runs for the given number of emulated ticks (default 100
+//  million) and the best of the runs (default 3) is reported as JSON on
+//  stdout, as emulated MHz and ns per instruction. Instructions are
+//  counted by SYNC cycle.
+//------------------------------------------------------------------------------
+#define CHIPS_IMPL
+#include "chips/m6502.h"
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#define IRQ_PERIOD (200)
+#define IRQ_ACK_ADDR (0xD000)
+
+typedef struct {
+    const char* name;
+    const uint8_t* prog;
+    size_t prog_size;
+    bool interrupts;
+} mix_t;
+
+/* 0200: LDX #0; loop: CLC; ADC #3; EOR #$55; AND #$F7; ORA #1; ASL A; INX; DEY; JMP loop */
+static const uint8_t alu_prog[] = {
+    0xA2, 0x00, 0x18, 0x69, 0x03, 0x49, 0x55, 0x29, 0xF7, 0x09, 0x01, 0x0A, 0xE8, 0x88, 0x4C, 0x02, 0x02,
+};
+/* 0200: LDX #0; loop: LDA $4000,X; STA $8000,X; LDA $4100,X; STA $8100,X; INX; BNE loop; JMP $0200 */
+static const uint8_t copy_prog[] = {
+    0xA2, 0x00, 0xBD, 0x00, 0x40, 0x9D, 0x00, 0x80, 0xBD, 0x00, 0x41, 0x9D, 0x00, 0x81,
+    0xE8, 0xD0, 0xF1, 0x4C, 0x00, 0x02,
+};
+/* 0200: LDY #0; loop: LDA ($10),Y; CLC; ADC ($12),Y; STA ($12),Y; INC $20; DEC $21,X; PHA; PLA; INY; BNE loop;
+         INC $11; JMP $0200
+*/
+static const uint8_t mem_prog[] = {
+    0xA0, 0x00, 0xB1, 0x10, 0x18, 0x71, 0x12, 0x91, 0x12, 0xE6, 0x20, 0xD6, 0x21, 0x48, 0x68, 0xC8, 0xD0, 0xF0,
+    0xE6, 0x11, 0x4C, 0x00, 0x02,
+};
+/* 0200: CLI; loop: INX; STX $31; JMP loop */
+static const uint8_t irq_prog[] = {
+    0x58, 0xE8, 0x86, 0x31, 0x4C, 0x01, 0x02,
+};
+/* 0300: PHA; LDA $D000 (acknowledge); INC $30; PLA; RTI */
+static const uint8_t isr_prog[] = {
+    0x48, 0xAD, 0x00, 0xD0, 0xE6, 0x30, 0x68, 0x40,
+};
+
+static const mix_t mixes[] = {
+    { "alu", alu_prog, sizeof(alu_prog), false },
+    { "copy", copy_prog, sizeof(copy_prog), false },
+    { "mem", mem_prog, sizeof(mem_prog), false },
+    { "irq", irq_prog, sizeof(irq_prog), true },
+};
+#define NUM_MIXES (sizeof(mixes)/sizeof(mixes[0]))
+
+static m6502_t cpu;
+static uint8_t mem[1<<16];
+static uint64_t num_instr;
+static uint64_t num_irqs;
+/* interrupts */
+static bool irq_enabled;
+static bool irq_pending;
+static int irq_counter;
+
+static uint64_t tick(uint64_t pins) {
+    const uint16_t addr = M6502_GET_ADDR(pins);
+    if (pins & M6502_RW) {
+        M6502_SET_DATA(pins, mem[addr]);
+        if (pins & M6502_SYNC) {
+            num_instr++;
+        }
+        else if ((addr == IRQ_ACK_ADDR) && irq_pending) {
+            irq_pending = false;
+            num_irqs++;
+        }
+    }
+    else {
+        mem[addr] = M6502_GET_DATA(pins);
+    }
+    if (irq_enabled) {
+        if (--irq_counter <= 0) {
+            irq_counter = IRQ_PERIOD;
+            irq_pending = true;
+        }
+        if (irq_pending) {
+            pins |= M6502_IRQ;
+        }
+        else {
+            pins &= ~M6502_IRQ;
+        }
+    }
+    return pins;
+}
+
+static void init(const mix_t* mix) {
+    memset(mem, 0, sizeof(mem));
+    memcpy(&mem[0x0200], mix->prog, mix->prog_size);
+    memcpy(&mem[0x0300], isr_prog, sizeof(isr_prog));
+    /* zero page pointers for the mem mix */
+    mem[0x10] = 0x00; mem[0x11] = 0x40;
+    mem[0x12] = 0x00; mem[0x13] = 0x80;
+    /* reset and IRQ vectors */
+    mem[0xFFFC] = 0x00; mem[0xFFFD] = 0x02;
+    mem[0xFFFE] = 0x00; mem[0xFFFF] = 0x03;
+    m6502_init(&cpu, &(m6502_desc_t){
+        .tick_cb = tick
+    });
+    m6502_reset(&cpu);
+    cpu.state.PC = 0x0200;
+    num_instr = 0;
+    num_irqs = 0;
+    irq_enabled = mix->interrupts;
+    irq_pending = false;
+    irq_counter = IRQ_PERIOD;
+}
+
+static int usage(const char* exe) {
+    fprintf(stderr, "usage: %s [-r runs] [million-ticks]\n", exe);
+    return 10;
+}
+
+int main(int argc, char* argv[]) {
+    int runs = 3;
+    uint64_t num_ticks = 100 * 1000000ULL;
+    for (int i = 1; i < argc; i++) {
+        if ((0 == strcmp(argv[i], "-r")) && (i+1 < argc)) {
+            runs = atoi(argv[++i]);
+            if (runs <= 0) {
+                return usage(argv[0]);
+            }
+        }
+        else if (atoi(argv[i]) > 0) {
+            num_ticks = (uint64_t)atoi(argv[i]) * 1000000ULL;
+        }
+        else {
+            return usage(argv[0]);
+        }
+    }
+    stm_setup();
+    printf("{\n  \"cpu\": \"m6502\",\n  \"runs\": %d,\n  \"benchmarks\": [\n", runs);
+    for (size_t m = 0; m < NUM_MIXES; m++) {
+        double best_sec = 0.0;
+        uint64_t ticks = 0;
+        for (int r = 0; r < runs; r++) {
+            init(&mixes[m]);
+            ticks = 0;
+            const uint64_t start = stm_now();
+            while (ticks < num_ticks) {
+                ticks += m6502_exec(&cpu, 1000000);
+            }
+            const double sec = stm_sec(stm_since(start));
+            if ((0 == r) || (sec < best_sec)) {
+                best_sec = sec;
+            }
+        }
+        if (best_sec <= 0.0) {
+            best_sec = 1e-9;
+        }
+        printf("    { \"name\": \"%s\", \"ticks\": %"PRIu64", \"instructions\": %"PRIu64", \"interrupts\": %"PRIu64", "
+            "\"seconds\": %.6f, \"mhz\": %.3f, \"ns_per_instruction\": %.3f }%s\n",
+            mixes[m].name, ticks, num_instr, num_irqs, best_sec,
+            (ticks / best_sec) / 1000000.0, (best_sec * 1e9) / (double)num_instr,
+            (m + 1 < NUM_MIXES) ? "," : "");
+    }
+    printf("  ]\n}\n");
+    return 0;
+}
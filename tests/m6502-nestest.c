@@ -1,5 +1,15 @@
 //------------------------------------------------------------------------------
 //  m6502-nestest.c
+//
+//  Usage:
+//
+//      m6502-nestest [trace]
+//
+//  Without args, the CPU state is hashed after each instruction and the
+//  rolling hash is compared against the checkpoints in nestestlog.h every
+//  NESTESTLOG_HASH_INTERVAL instructions. With the path to the packed
+//  binary trace (nestest/nestestlog.bin), the trace is streamed from the
+//  file and every instruction is compared.
 //------------------------------------------------------------------------------
 // force assert() enabled
 #ifdef NDEBUG
@@ -9,6 +19,7 @@
 #include "chips/m6502.h"
 #include "chips/mem.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include "nestest/dump.h"
 #include "nestest/nestestlog.h"
 
@@ -17,6 +28,50 @@ mem_t mem;
 uint8_t ram[0x0800];
 uint8_t sram[0x2000];
 
+/* an unpacked trace entry */
+typedef struct {
+    uint16_t PC;
+    uint8_t A,X,Y,P,S;
+} cpu_state;
+
+/* streams the packed binary trace from a file */
+#define TRACE_BUFFER_STATES (4096)
+typedef struct {
+    FILE* fp;
+    int pos;
+    int num;
+    uint8_t buf[TRACE_BUFFER_STATES * NESTESTLOG_STATE_SIZE];
+} trace_t;
+
+bool trace_next(trace_t* t, cpu_state* state) {
+    if (t->pos == t->num) {
+        t->num = (int) fread(t->buf, NESTESTLOG_STATE_SIZE, TRACE_BUFFER_STATES, t->fp);
+        t->pos = 0;
+        if (0 == t->num) {
+            return false;
+        }
+    }
+    const uint8_t* p = &t->buf[t->pos++ * NESTESTLOG_STATE_SIZE];
+    state->PC = (p[1]<<8) | p[0];
+    state->A = p[2];
+    state->X = p[3];
+    state->Y = p[4];
+    state->P = p[5];
+    state->S = p[6];
+    return true;
+}
+
+/* FNV-1a over the packed state, must match the nestestlog generator */
+uint32_t hash_state(uint32_t h, const m6502_state_t* s) {
+    const uint8_t bytes[NESTESTLOG_STATE_SIZE] = {
+        (uint8_t)s->PC, (uint8_t)(s->PC>>8), s->A, s->X, s->Y, s->P, s->S
+    };
+    for (int i = 0; i < NESTESTLOG_STATE_SIZE; i++) {
+        h = (h ^ bytes[i]) * 0x01000193;
+    }
+    return h;
+}
+
 uint64_t tick(uint64_t pins) {
     const uint16_t addr = M6502_GET_ADDR(pins);
     /* memory-mapped IO range from 2000..401F is ignored */
@@ -35,9 +90,19 @@ uint64_t tick(uint64_t pins) {
     return pins;
 }
 
-int main() {
+int main(int argc, char* argv[]) {
     puts(">>> RUNNING NESTEST...");
 
+    trace_t* trace = 0;
+    if (argc > 1) {
+        trace = (trace_t*) calloc(1, sizeof(trace_t));
+        trace->fp = fopen(argv[1], "rb");
+        if (!trace->fp) {
+            printf("### failed to open trace file '%s'\n", argv[1]);
+            return 10;
+        }
+    }
+
     /* need to implement a minimal NES emulation */
     memset(ram, 0, sizeof(ram));
     memset(sram, 0, sizeof(sram));
@@ -65,27 +130,58 @@ int main() {
     m6502_reset(&cpu);
     cpu.state.PC = 0xC000;
 
-    /* run the test */
+    /* run the test, the state before each instruction is checked */
+    uint32_t hash = 0x811C9DC5;
     int i = 0;
-    while (cpu.state.PC != 0xC66E) {
-        cpu_state* state = &state_table[i++];
-        if ((cpu.state.PC != state->PC) ||
-            (cpu.state.A  != state->A) ||
-            (cpu.state.X  != state->X) ||
-            (cpu.state.Y  != state->Y) ||
-            (cpu.state.P  != state->P) ||
-            (cpu.state.S  != state->S))
-        {
-            printf("### NESTEST failed at pos %d, PC=0x%04X: %s", i, cpu.state.PC, state->desc);
-            assert(cpu.state.PC == state->PC);
-            assert(cpu.state.A == state->A);
-            assert(cpu.state.X == state->X);
-            assert(cpu.state.Y == state->Y);
-            assert(cpu.state.P == state->P);
-            assert(cpu.state.S == state->S);
-            return 10;
+    while (i < NESTESTLOG_NUM_STATES) {
+        if (trace) {
+            cpu_state state;
+            if (!trace_next(trace, &state)) {
+                printf("### NESTEST trace file ended at pos %d\n", i);
+                return 10;
+            }
+            if ((cpu.state.PC != state.PC) ||
+                (cpu.state.A  != state.A) ||
+                (cpu.state.X  != state.X) ||
+                (cpu.state.Y  != state.Y) ||
+                (cpu.state.P  != state.P) ||
+                (cpu.state.S  != state.S))
+            {
+                printf("### NESTEST failed at pos %d:\n", i);
+                printf("    expected: PC:%04X A:%02X X:%02X Y:%02X P:%02X SP:%02X\n",
+                    state.PC, state.A, state.X, state.Y, state.P, state.S);
+                printf("    got:      PC:%04X A:%02X X:%02X Y:%02X P:%02X SP:%02X\n",
+                    cpu.state.PC, cpu.state.A, cpu.state.X, cpu.state.Y, cpu.state.P, cpu.state.S);
+                assert(cpu.state.PC == state.PC);
+                assert(cpu.state.A == state.A);
+                assert(cpu.state.X == state.X);
+                assert(cpu.state.Y == state.Y);
+                assert(cpu.state.P == state.P);
+                assert(cpu.state.S == state.S);
+                return 10;
+            }
         }
-        m6502_exec(&cpu, 0);
+        hash = hash_state(hash, &cpu.state);
+        i++;
+        if ((0 == (i % NESTESTLOG_HASH_INTERVAL)) || (i == NESTESTLOG_NUM_STATES)) {
+            const int h = (i - 1) / NESTESTLOG_HASH_INTERVAL;
+            if (hash != nestestlog_hashes[h]) {
+                printf("### NESTEST failed between pos %d and %d (hash mismatch), run with %s for details\n",
+                    h * NESTESTLOG_HASH_INTERVAL, i - 1, NESTESTLOG_TRACE_FILE);
+                return 10;
+            }
+        }
+        if (i < NESTESTLOG_NUM_STATES) {
+            m6502_exec(&cpu, 0);
+        }
+    }
+    if (cpu.state.PC != 0xC66E) {
+        printf("### NESTEST did not end at 0xC66E (PC=0x%04X)\n", cpu.state.PC);
+        return 10;
+    }
+    if (trace) {
+        fclose(trace->fp);
+        free(trace);
     }
     puts(">>> NESTEST FINISHED SUCCESSFULLY");
     return 0;
@@ -2,6 +2,16 @@
 //  m6502-wltest.c
 //  Runs the CPU-parts of the Wolfgang Lorenz C64 test suite
 //  (see: http://6502.org/tools/emu/)
+//
+//  Usage:
+//
+//      m6502-wltest [-j threads]
+//
+//  Without args, the tests run chained like on a real C64 (each test
+//  loads the next one). With -j, the test chain is discovered from the
+//  'load next test' code in the dumps, and each test runs in its own
+//  CPU/memory instance on a pool of worker threads (-j 0 means one
+//  thread per CPU core), with a per-test pass/fail and cycle report.
 //------------------------------------------------------------------------------
 // force assert() enabled
 #ifdef NDEBUG
@@ -10,49 +20,72 @@
 #define CHIPS_IMPL
 #include "chips/m6502.h"
 #include "chips/mem.h"
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include "../examples/common/thread.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
 #include "testsuite-2.15/bin/dump.h"
 
-m6502_t cpu;
-mem_t mem;
-uint8_t ram[1<<16];
-bool text_enabled = true;
+#define MAX_TESTS (DUMP_NUM_ITEMS)
+#define MAX_NAME_LEN (32)
+#define TEST_OUTPUT_SIZE (1<<10)
 
-/* load a test dump into memory, return false if last test is reached ('trap17') */
-bool load_test(const char* name) {
-    if (0 == strcmp(name, "trap1")) {
-        /* last test reached */
-        return false;
-    }
-    else if (0 == strcmp(name, "sbcb(eb)")) {
+/* the CPU and memory of one running test, one per thread */
+typedef struct {
+    m6502_t cpu;
+    mem_t mem;
+    uint8_t ram[1<<16];
+    bool text_enabled;
+    bool failed;
+    /* in single-test mode, output goes into a buffer, and loading the next test stops */
+    bool single;
+    char* output;
+    int out_pos;
+} wltest_t;
+static CHIPS_THREAD_LOCAL wltest_t* wl;
+
+/* find a test dump by name */
+const dump_item* find_dump(const char* name) {
+    if (0 == strcmp(name, "sbcb(eb)")) {
         name = "sbcb_eb";
     }
-    const uint8_t* ptr = 0;
-    int size = 0;
     for (int i = 0; i < DUMP_NUM_ITEMS; i++) {
         if (0 == strcmp(dump_items[i].name, name)) {
-            ptr = dump_items[i].ptr;
-            size = dump_items[i].size;
-            break;
+            return &dump_items[i];
         }
     }
-    assert(ptr && (size > 2));
+    return 0;
+}
+
+/* load a test dump into memory, return false if last test is reached ('trap17') */
+bool load_test(const char* name) {
+    if (0 == strcmp(name, "trap1")) {
+        /* last test reached */
+        return false;
+    }
+    const dump_item* item = find_dump(name);
+    assert(item && (item->size > 2));
+    const uint8_t* ptr = item->ptr;
+    int size = item->size;
 
     /* first 2 bytes of the dump are the start address */
     size -= 2;
     uint8_t l = *ptr++;
     uint8_t h = *ptr++;
     uint16_t addr = (h<<8)|l;
-    mem_write_range(&mem, addr, ptr, size);
+    mem_write_range(&wl->mem, addr, ptr, size);
 
     /* initialize some memory locations */
-    mem_wr(&mem, 0x0002, 0x00);
-    mem_wr(&mem, 0xA002, 0x00);
-    mem_wr(&mem, 0xA003, 0x80);
-    mem_wr(&mem, 0xFFFE, 0x48);
-    mem_wr(&mem, 0xFFFF, 0xFF);
-    mem_wr(&mem, 0x01FE, 0xFF);
-    mem_wr(&mem, 0x01FF, 0x7F);
+    mem_wr(&wl->mem, 0x0002, 0x00);
+    mem_wr(&wl->mem, 0xA002, 0x00);
+    mem_wr(&wl->mem, 0xA003, 0x80);
+    mem_wr(&wl->mem, 0xFFFE, 0x48);
+    mem_wr(&wl->mem, 0xFFFF, 0xFF);
+    mem_wr(&wl->mem, 0x01FE, 0xFF);
+    mem_wr(&wl->mem, 0x01FF, 0x7F);
 
     /* KERNAL IRQ handler at 0xFF48 */
     uint8_t irq_handler[] = {
@@ -68,21 +101,22 @@ bool load_test(const char* name) {
         0x6C, 0x16, 0x03,   // JMP ($0316)
         0x6C, 0x14, 0x03,   // JMP ($0314)
     };
-    mem_write_range(&mem, 0xFF48, irq_handler, sizeof(irq_handler));
+    mem_write_range(&wl->mem, 0xFF48, irq_handler, sizeof(irq_handler));
 
     /* init CPU registers */
-    cpu.state.S = 0xFD;
-    cpu.state.P = 0x04;
-    cpu.state.PC = 0x0801;
+    wl->cpu.state.S = 0xFD;
+    wl->cpu.state.P = 0x04;
+    wl->cpu.state.PC = 0x0801;
 
     return true;
 }
 
 /* pop return address from CPU stack */
 uint16_t pop() {
-    cpu.state.S++;
-    uint8_t l = mem_rd(&mem, 0x0100|cpu.state.S++);
-    uint8_t h = mem_rd(&mem, 0x0100|cpu.state.S);
+    m6502_t* cpu = &wl->cpu;
+    cpu->state.S++;
+    uint8_t l = mem_rd(&wl->mem, 0x0100|cpu->state.S++);
+    uint8_t h = mem_rd(&wl->mem, 0x0100|cpu->state.S);
     uint16_t addr = (h<<8)|l;
     return addr;
 }
@@ -111,26 +145,42 @@ char petscii2ascii(uint8_t p) {
     }
 }
 
+void put_char(char c) {
+    if (wl->single) {
+        if (wl->out_pos < (TEST_OUTPUT_SIZE-1)) {
+            wl->output[wl->out_pos++] = c;
+        }
+    }
+    else {
+        putchar(c);
+    }
+}
+
 /* check for special trap addresses, and perform OS functions, return false to exit */
 bool trap() {
-    if (cpu.trap_id == 0) {
+    m6502_t* cpu = &wl->cpu;
+    if (cpu->trap_id == 0) {
         /* print character */
-        mem_wr(&mem, 0x030C, 0x00);
-        if (text_enabled) {
-            putchar(petscii2ascii(cpu.state.A));
+        mem_wr(&wl->mem, 0x030C, 0x00);
+        if (wl->text_enabled) {
+            put_char(petscii2ascii(cpu->state.A));
         }
-        cpu.state.PC = pop();
-        cpu.state.PC++;
+        cpu->state.PC = pop();
+        cpu->state.PC++;
     }
-    else if (cpu.trap_id == 1) {
+    else if (cpu->trap_id == 1) {
         /* load dump */
-        uint8_t l = mem_rd(&mem, 0x00BB);   // petscii filename address, low byte
-        uint8_t h = mem_rd(&mem, 0x00BC);   // petscii filename address, high byte
+        if (wl->single) {
+            /* the test is done when it wants to load the next one */
+            return false;
+        }
+        uint8_t l = mem_rd(&wl->mem, 0x00BB);   // petscii filename address, low byte
+        uint8_t h = mem_rd(&wl->mem, 0x00BC);   // petscii filename address, high byte
         uint16_t addr = (h<<8)|l;
-        int s = mem_rd(&mem, 0x00B7);   // petscii filename length
+        int s = mem_rd(&wl->mem, 0x00B7);   // petscii filename length
         char name[64];
         for (int i = 0; i < s; i++) {
-            name[i] = petscii2ascii(mem_rd(&mem, addr++));
+            name[i] = petscii2ascii(mem_rd(&wl->mem, addr++));
         }
         name[s] = 0;
         if (!load_test(name)) {
@@ -138,22 +188,23 @@ bool trap() {
             return false;
         }
         pop();
-        cpu.state.PC = 0x0816;
-        text_enabled = true;
+        cpu->state.PC = 0x0816;
+        wl->text_enabled = true;
     }
-    else if (cpu.trap_id == 2) {
+    else if (cpu->trap_id == 2) {
         /* scan keyboard, this is called when an error was encountered,
            we'll continue, but disable text output until the next test is loaded
         */
-        if (text_enabled) {
+        if (wl->text_enabled && !wl->single) {
             puts("\nSKIP TEXT OUTPUT UNTIL NEXT TEST\n");
         }
-        text_enabled = false;
-        cpu.state.A = 0x02;
-        cpu.state.PC = pop();
-        cpu.state.PC++;
+        wl->text_enabled = false;
+        wl->failed = true;
+        cpu->state.A = 0x02;
+        cpu->state.PC = pop();
+        cpu->state.PC++;
     }
-    else if ((cpu.state.PC == 0x8000) || (cpu.state.PC == 0xA474)) {
+    else if ((cpu->state.PC == 0x8000) || (cpu->state.PC == 0xA474)) {
         /* done */
         return false;
     }
@@ -164,45 +215,210 @@ uint64_t tick(uint64_t pins) {
     const uint16_t addr = M6502_GET_ADDR(pins);
     if (pins & M6502_RW) {
         /* memory read */
-        M6502_SET_DATA(pins, mem_rd(&mem, addr));
+        M6502_SET_DATA(pins, mem_rd(&wl->mem, addr));
     }
     else {
         /* memory write */
-        mem_wr(&mem, addr, M6502_GET_DATA(pins));
+        mem_wr(&wl->mem, addr, M6502_GET_DATA(pins));
     }
     return pins;
 }
 
-int main() {
-    puts(">>> Running Wolfgang Lorenz C64 test suite...");
-
-    /* prepare environment (see http://www.softwolves.com/arkiv/cbm-hackers/7/7114.html) */
-    memset(ram, 0, sizeof(ram));
-    mem_map_ram(&mem, 0, 0x0000, sizeof(ram), ram);
+/* prepare environment (see http://www.softwolves.com/arkiv/cbm-hackers/7/7114.html) */
+void init_env(void) {
+    memset(wl->ram, 0, sizeof(wl->ram));
+    mem_init(&wl->mem);
+    mem_map_ram(&wl->mem, 0, 0x0000, sizeof(wl->ram), wl->ram);
 
-    m6502_init(&cpu, &(m6502_desc_t){
+    m6502_init(&wl->cpu, &(m6502_desc_t){
         .tick_cb = tick
     });
-    m6502_reset(&cpu);
+    m6502_reset(&wl->cpu);
     /* trap for print character function */
-    m6502_set_trap(&cpu, 0, 0xFFD2);
+    m6502_set_trap(&wl->cpu, 0, 0xFFD2);
     /* trap for load dump function */
-    m6502_set_trap(&cpu, 1, 0xE16F);
+    m6502_set_trap(&wl->cpu, 1, 0xE16F);
     /* trap for 'scan keyboard' function */
-    m6502_set_trap(&cpu, 2, 0xFFE4);
+    m6502_set_trap(&wl->cpu, 2, 0xFFE4);
     /* traps for error and finished */
-    m6502_set_trap(&cpu, 3, 0x8000);
-    m6502_set_trap(&cpu, 4, 0xA474);
+    m6502_set_trap(&wl->cpu, 3, 0x8000);
+    m6502_set_trap(&wl->cpu, 4, 0xA474);
+    wl->text_enabled = true;
+    wl->failed = false;
+}
 
-    load_test("_start");
+/* run until trap() says stop, return executed ticks */
+uint64_t run(void) {
+    uint64_t ticks = 0;
     bool done = false;
     while (!done) {
-        m6502_exec(&cpu, (1<<30));
+        ticks += m6502_exec(&wl->cpu, (1<<30));
         if (!trap()) {
             done = true;
         }
     }
-    return 0;
+    return ticks;
 }
 
+/*
+    Each test ends with this code to load the next test:
+
+        load    jsr print
+        name    .text "adcax"
+                .byte 0
+                lda #0      ; A9 00
+                sta $0a     ; 85 0A
+                sta $b9     ; 85 B9
+                lda #len    ; A9 len
+                sta $b7     ; 85 B7
+
+    Look for the code following the name, and extract the PETSCII name.
+*/
+bool next_test_name(const dump_item* item, char* buf, int buf_size) {
+    static const uint8_t pat[] = { 0x00, 0xA9, 0x00, 0x85, 0x0A, 0x85, 0xB9, 0xA9 };
+    for (int i = 0; (i + (int)sizeof(pat) + 3) <= item->size; i++) {
+        if (0 == memcmp(&item->ptr[i], pat, sizeof(pat))) {
+            const int len = item->ptr[i + sizeof(pat)];
+            if ((len >= buf_size) || (len > i) || (item->ptr[i + sizeof(pat) + 1] != 0x85)) {
+                return false;
+            }
+            for (int c = 0; c < len; c++) {
+                buf[c] = petscii2ascii(item->ptr[i - len + c]);
+            }
+            buf[len] = 0;
+            return true;
+        }
+    }
+    return false;
+}
 
+typedef struct {
+    const char* name;
+    uint64_t ticks;
+    double dur;
+    bool failed;
+    char output[TEST_OUTPUT_SIZE];
+} test_job_t;
+
+typedef struct {
+    test_job_t* jobs;
+    int num_jobs;
+    volatile int32_t next_job;
+} test_pool_t;
+
+void run_job(test_job_t* job) {
+    init_env();
+    wl->single = true;
+    wl->output = job->output;
+    wl->out_pos = 0;
+    memset(job->output, 0, sizeof(job->output));
+    load_test(job->name);
+    uint64_t start_time = stm_now();
+    job->ticks = run();
+    job->dur = stm_sec(stm_since(start_time));
+    /* a test has passed when it got to loading the next test without error */
+    job->failed = wl->failed || (wl->cpu.trap_id != 1);
+}
+
+void worker(void* arg) {
+    test_pool_t* pool = (test_pool_t*) arg;
+    wl = (wltest_t*) calloc(1, sizeof(wltest_t));
+    int32_t i;
+    while ((i = thread_atomic_add(&pool->next_job, 1)) < pool->num_jobs) {
+        run_job(&pool->jobs[i]);
+    }
+    free(wl);
+    wl = 0;
+}
+
+/* discover the test chain from the dumps, and run each test on a thread pool */
+bool run_parallel(int num_threads) {
+    static char names[MAX_TESTS][MAX_NAME_LEN];
+    int num_tests = 0;
+    const dump_item* item = find_dump("_start");
+    while (item && (num_tests < MAX_TESTS)) {
+        char* name = names[num_tests];
+        if (!next_test_name(item, name, MAX_NAME_LEN)) {
+            printf("could not find the next test after '%s'!\n", item->name);
+            return false;
+        }
+        if (0 == strcmp(name, "trap1")) {
+            /* last test reached */
+            break;
+        }
+        item = find_dump(name);
+        if (!item) {
+            printf("unknown test '%s'!\n", name);
+            return false;
+        }
+        num_tests++;
+    }
+    test_job_t* jobs = (test_job_t*) calloc((size_t)num_tests, sizeof(test_job_t));
+    for (int i = 0; i < num_tests; i++) {
+        jobs[i].name = names[i];
+    }
+    test_pool_t pool = { .jobs = jobs, .num_jobs = num_tests, .next_job = 0 };
+    if (num_threads > num_tests) {
+        num_threads = num_tests;
+    }
+    printf("running %d tests on %d thread(s)\n", num_tests, num_threads);
+    thread_t* threads = (thread_t*) calloc((size_t)num_threads, sizeof(thread_t));
+    uint64_t start_time = stm_now();
+    for (int i = 0; i < num_threads; i++) {
+        if (!thread_start(&threads[i], worker, &pool)) {
+            /* run the remaining jobs with fewer threads */
+            num_threads = i;
+            break;
+        }
+    }
+    if (0 == num_threads) {
+        worker(&pool);
+    }
+    for (int i = 0; i < num_threads; i++) {
+        thread_join(&threads[i]);
+    }
+    double wall = stm_sec(stm_since(start_time));
+    free(threads);
+
+    int num_failed = 0;
+    uint64_t ticks = 0;
+    double total_dur = 0.0;
+    for (int i = 0; i < num_tests; i++) {
+        const test_job_t* job = &jobs[i];
+        printf("%-12s %s  (%"PRIu64" cycles, %.3f secs)\n",
+            job->name, job->failed ? "FAILED" : "ok", job->ticks, job->dur);
+        if (job->failed) {
+            printf("%s\n", job->output);
+            num_failed++;
+        }
+        ticks += job->ticks;
+        total_dur += job->dur;
+    }
+    printf("\n%d of %d tests passed, %"PRIu64" cycles\n", num_tests - num_failed, num_tests, ticks);
+    printf("%.3f secs wall time, %.3f secs total (%.2fx)\n", wall, total_dur, (wall > 0.0) ? total_dur / wall : 0.0);
+    free(jobs);
+    return 0 == num_failed;
+}
+
+int main(int argc, char* argv[]) {
+    stm_setup();
+    if ((argc == 3) && (0 == strcmp(argv[1], "-j"))) {
+        puts(">>> Running Wolfgang Lorenz C64 test suite in parallel...");
+        int num_threads = atoi(argv[2]);
+        if (num_threads <= 0) {
+            num_threads = thread_num_cores();
+        }
+        return run_parallel(num_threads) ? 0 : 10;
+    }
+    else if (argc != 1) {
+        printf("usage: %s [-j threads]\n", argv[0]);
+        return 10;
+    }
+    puts(">>> Running Wolfgang Lorenz C64 test suite...");
+    static wltest_t ctx;
+    wl = &ctx;
+    init_env();
+    load_test("_start");
+    run();
+    return 0;
+}
@@ -1,1546 +1,777 @@
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include "dump.h"
-unsigned char dump_nestest[24592] = {
-0x4e, 0x45, 0x53, 0x1a, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x4c, 0xf5, 0xc5, 0x60, 0x78, 0xd8, 0xa2, 0xff, 0x9a, 0xad, 0x2, 0x20, 0x10, 0xfb, 0xad, 0x2, 
-0x20, 0x10, 0xfb, 0xa9, 0x0, 0x8d, 0x0, 0x20, 0x8d, 0x1, 0x20, 0x8d, 0x5, 0x20, 0x8d, 0x5, 
-0x20, 0xad, 0x2, 0x20, 0xa2, 0x20, 0x8e, 0x6, 0x20, 0xa2, 0x0, 0x8e, 0x6, 0x20, 0xa2, 0x0, 
-0xa0, 0xf, 0xa9, 0x0, 0x8d, 0x7, 0x20, 0xca, 0xd0, 0xfa, 0x88, 0xd0, 0xf7, 0xa9, 0x3f, 0x8d, 
-0x6, 0x20, 0xa9, 0x0, 0x8d, 0x6, 0x20, 0xa2, 0x0, 0xbd, 0x78, 0xff, 0x8d, 0x7, 0x20, 0xe8, 
-0xe0, 0x20, 0xd0, 0xf5, 0xa9, 0xc0, 0x8d, 0x17, 0x40, 0xa9, 0x0, 0x8d, 0x15, 0x40, 0xa9, 0x78, 
-0x85, 0xd0, 0xa9, 0xfb, 0x85, 0xd1, 0xa9, 0x7f, 0x85, 0xd3, 0xa0, 0x0, 0x8c, 0x6, 0x20, 0x8c, 
-0x6, 0x20, 0xa9, 0x0, 0x85, 0xd7, 0xa9, 0x7, 0x85, 0xd0, 0xa9, 0xc3, 0x85, 0xd1, 0x20, 0xa7, 
-0xc2, 0x20, 0x8d, 0xc2, 0xa2, 0x12, 0x20, 0x61, 0xc2, 0xa5, 0xd5, 0x4a, 0x4a, 0x4a, 0xb0, 0x1c, 
-0x4a, 0xb0, 0xc, 0x4a, 0xb0, 0x27, 0x4a, 0xb0, 0x3, 0x4c, 0x81, 0xc0, 0x4c, 0x26, 0xc1, 0x20, 
-0x6f, 0xc6, 0xc6, 0xd7, 0x10, 0xdb, 0xa9, 0xd, 0x85, 0xd7, 0xd0, 0xd5, 0x20, 0x6f, 0xc6, 0xe6, 
-0xd7, 0xa5, 0xd7, 0xc9, 0xe, 0x90, 0xca, 0xa9, 0x0, 0x85, 0xd7, 0xf0, 0xc4, 0x20, 0x89, 0xc6, 
-0xa5, 0xd7, 0xf0, 0x6, 0x20, 0xed, 0xc0, 0x4c, 0x81, 0xc0, 0xa9, 0x0, 0x85, 0xd8, 0xe6, 0xd7, 
-0x20, 0xed, 0xc0, 0xe6, 0xd7, 0xa5, 0xd7, 0xc9, 0xe, 0xd0, 0xf5, 0xa9, 0x0, 0x85, 0xd7, 0xa5, 
-0xd8, 0xf0, 0x2, 0xa9, 0xff, 0x85, 0x0, 0x20, 0xed, 0xc1, 0x4c, 0x81, 0xc0, 0xa5, 0xd7, 0xa, 
-0xaa, 0xbd, 0xa, 0xc1, 0x8d, 0x0, 0x2, 0xbd, 0xb, 0xc1, 0x8d, 0x1, 0x2, 0xa9, 0xc1, 0x48, 
-0xa9, 0xde, 0x48, 0xa9, 0x0, 0x85, 0x0, 0x6c, 0x0, 0x2, 0x2d, 0xc7, 0x2d, 0xc7, 0xdb, 0xc7, 
-0x85, 0xc8, 0xde, 0xcb, 0xf8, 0xcd, 0xee, 0xce, 0xa2, 0xcf, 0x74, 0xd1, 0xfb, 0xd4, 0xd4, 0xc1, 
-0x4a, 0xdf, 0xb8, 0xdb, 0xaa, 0xe1, 0xa9, 0x0, 0x85, 0xd7, 0xa9, 0x92, 0x85, 0xd0, 0xa9, 0xc4, 
-0x85, 0xd1, 0x20, 0xa7, 0xc2, 0x20, 0x8d, 0xc2, 0xa2, 0xf, 0x20, 0x61, 0xc2, 0xa5, 0xd5, 0x4a, 
-0x4a, 0x4a, 0xb0, 0x1c, 0x4a, 0xb0, 0xc, 0x4a, 0xb0, 0x27, 0x4a, 0xb0, 0x3, 0x4c, 0x35, 0xc1, 
-0x4c, 0x72, 0xc0, 0x20, 0x6f, 0xc6, 0xc6, 0xd7, 0x10, 0xdb, 0xa9, 0xa, 0x85, 0xd7, 0xd0, 0xd5, 
-0x20, 0x6f, 0xc6, 0xe6, 0xd7, 0xa5, 0xd7, 0xc9, 0xb, 0x90, 0xca, 0xa9, 0x0, 0x85, 0xd7, 0xf0, 
-0xc4, 0x20, 0x89, 0xc6, 0xa5, 0xd7, 0xf0, 0x6, 0x20, 0xa1, 0xc1, 0x4c, 0x35, 0xc1, 0xa9, 0x0, 
-0x85, 0xd8, 0xe6, 0xd7, 0x20, 0xa1, 0xc1, 0xe6, 0xd7, 0xa5, 0xd7, 0xc9, 0xb, 0xd0, 0xf5, 0xa9, 
-0x0, 0x85, 0xd7, 0xa5, 0xd8, 0xf0, 0x2, 0xa9, 0xff, 0x85, 0x0, 0x20, 0xed, 0xc1, 0x4c, 0x35, 
-0xc1, 0xa5, 0xd7, 0xa, 0xaa, 0xbd, 0xbe, 0xc1, 0x8d, 0x0, 0x2, 0xbd, 0xbf, 0xc1, 0x8d, 0x1, 
-0x2, 0xa9, 0xc1, 0x48, 0xa9, 0xde, 0x48, 0xa9, 0x0, 0x85, 0x0, 0x6c, 0x0, 0x2, 0xa3, 0xc6, 
-0xa3, 0xc6, 0x1e, 0xe5, 0x3d, 0xe7, 0xd3, 0xe8, 0x16, 0xe9, 0x86, 0xeb, 0xf6, 0xed, 0x66, 0xf0, 
-0xd6, 0xf2, 0x46, 0xf5, 0xa9, 0x0, 0x85, 0x0, 0x20, 0x0, 0xd9, 0x20, 0xe0, 0xda, 0xea, 0xea, 
-0xea, 0xa5, 0x0, 0xf0, 0x2, 0x85, 0xd8, 0x4c, 0xed, 0xc1, 0x4c, 0x81, 0xc0, 0x20, 0x8d, 0xc2, 
-0xa9, 0x0, 0x85, 0xd3, 0xa5, 0xd7, 0x18, 0x69, 0x4, 0xa, 0x26, 0xd3, 0xa, 0x26, 0xd3, 0xa, 
-0x26, 0xd3, 0xa, 0x26, 0xd3, 0xa, 0x26, 0xd3, 0x48, 0xa5, 0xd3, 0x9, 0x20, 0x8d, 0x6, 0x20, 
-0x68, 0x9, 0x4, 0x8d, 0x6, 0x20, 0xa5, 0x0, 0xf0, 0x1d, 0xc9, 0xff, 0xf0, 0x26, 0x4a, 0x4a, 
-0x4a, 0x4a, 0xaa, 0xbd, 0x51, 0xc2, 0x8d, 0x7, 0x20, 0xa5, 0x0, 0x29, 0xf, 0xaa, 0xbd, 0x51, 
-0xc2, 0x8d, 0x7, 0x20, 0x4c, 0x94, 0xc2, 0xa9, 0x4f, 0x8d, 0x7, 0x20, 0xa9, 0x4b, 0x8d, 0x7, 
-0x20, 0x4c, 0x94, 0xc2, 0xa9, 0x45, 0x8d, 0x7, 0x20, 0xa9, 0x72, 0x8d, 0x7, 0x20, 0x4c, 0x94, 
-0xc2, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x41, 0x42, 0x43, 0x44, 0x45, 
-0x46, 0xa5, 0xd7, 0x18, 0x69, 0x4, 0xa8, 0xa9, 0x84, 0x8d, 0x0, 0x20, 0xa9, 0x20, 0x8d, 0x6, 
-0x20, 0xa9, 0x2, 0x8d, 0x6, 0x20, 0xa9, 0x20, 0x88, 0xc8, 0xd0, 0x2, 0xa9, 0x2a, 0x8d, 0x7, 
-0x20, 0x88, 0xca, 0xd0, 0xf1, 0xa9, 0x80, 0x8d, 0x0, 0x20, 0x4c, 0x94, 0xc2, 0xa5, 0xd2, 0xc5, 
-0xd2, 0xf0, 0xfc, 0x60, 0xa9, 0x0, 0x8d, 0x5, 0x20, 0x8d, 0x5, 0x20, 0xa9, 0x0, 0x8d, 0x6, 
-0x20, 0xa9, 0x0, 0x8d, 0x6, 0x20, 0x60, 0xa9, 0x0, 0x8d, 0x0, 0x20, 0x8d, 0x1, 0x20, 0x20, 
-0xed, 0xc2, 0xa9, 0x20, 0x8d, 0x6, 0x20, 0xa0, 0x0, 0x8c, 0x6, 0x20, 0xa2, 0x20, 0xb1, 0xd0, 
-0xf0, 0x20, 0xc9, 0xff, 0xf0, 0xd, 0x8d, 0x7, 0x20, 0xc8, 0xd0, 0x2, 0xe6, 0xd1, 0xca, 0xd0, 
-0xed, 0xf0, 0xe9, 0xc8, 0xd0, 0x2, 0xe6, 0xd1, 0xa9, 0x20, 0x8d, 0x7, 0x20, 0xca, 0xd0, 0xf8, 
-0xf0, 0xda, 0xa9, 0x80, 0x8d, 0x0, 0x20, 0xa9, 0xe, 0x8d, 0x1, 0x20, 0x60, 0xa9, 0x20, 0x8d, 
-0x6, 0x20, 0xa9, 0x0, 0x8d, 0x6, 0x20, 0xa2, 0x1e, 0xa9, 0x20, 0xa0, 0x20, 0x8d, 0x7, 0x20, 
-0x88, 0xd0, 0xfa, 0xca, 0xd0, 0xf5, 0x60, 0xff, 0xff, 0xff, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 
-0x2d, 0x20, 0x52, 0x75, 0x6e, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 
-0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x42, 0x72, 0x61, 0x6e, 0x63, 0x68, 0x20, 0x74, 0x65, 
-0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x46, 0x6c, 0x61, 0x67, 0x20, 
-0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x49, 0x6d, 0x6d, 
-0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 
-0x20, 0x2d, 0x2d, 0x20, 0x49, 0x6d, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x74, 0x65, 0x73, 0x74, 
-0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x53, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x74, 
-0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x41, 0x63, 0x63, 0x75, 
-0x6d, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 
-0x20, 0x20, 0x2d, 0x2d, 0x20, 0x28, 0x49, 0x6e, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x2c, 0x58, 
-0x29, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x5a, 
-0x65, 0x72, 0x6f, 0x70, 0x61, 0x67, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 
-0x20, 0x20, 0x2d, 0x2d, 0x20, 0x41, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x20, 0x74, 0x65, 
-0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x28, 0x49, 0x6e, 0x64, 0x69, 
-0x72, 0x65, 0x63, 0x74, 0x29, 0x2c, 0x59, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 
-0x20, 0x20, 0x2d, 0x2d, 0x20, 0x41, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x2c, 0x59, 0x20, 
-0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x5a, 0x65, 0x72, 
-0x6f, 0x70, 0x61, 0x67, 0x65, 0x2c, 0x58, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 
-0x20, 0x20, 0x2d, 0x2d, 0x20, 0x41, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x2c, 0x58, 0x20, 
-0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0xff, 0xff, 0x20, 0x20, 0x20, 0x20, 0x55, 0x70, 0x2f, 0x44, 
-0x6f, 0x77, 0x6e, 0x3a, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x74, 0x65, 0x73, 0x74, 
-0xff, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x3a, 0x20, 0x72, 0x75, 
-0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0xff, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x6c, 0x65, 
-0x63, 0x74, 0x3a, 0x20, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x6f, 0x70, 0x73, 0x21, 
-0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x52, 0x75, 0x6e, 
-0x20, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 
-0x2d, 0x20, 0x4e, 0x4f, 0x50, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 
-0x2d, 0x2d, 0x20, 0x4c, 0x41, 0x58, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 
-0x20, 0x2d, 0x2d, 0x20, 0x53, 0x41, 0x58, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 
-0x20, 0x20, 0x2d, 0x2d, 0x20, 0x53, 0x42, 0x43, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x28, 0x6f, 
-0x70, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x30, 0x45, 0x42, 0x68, 0x29, 0xff, 0x20, 0x20, 0x20, 0x20, 
-0x2d, 0x2d, 0x20, 0x44, 0x43, 0x50, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 
-0x20, 0x2d, 0x2d, 0x20, 0x49, 0x53, 0x42, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 
-0x20, 0x20, 0x2d, 0x2d, 0x20, 0x53, 0x4c, 0x4f, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 
-0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x52, 0x4c, 0x41, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 
-0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x53, 0x52, 0x45, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 
-0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x52, 0x52, 0x41, 0x20, 0x74, 0x65, 0x73, 0x74, 
-0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x20, 0x20, 0x20, 0x55, 0x70, 0x2f, 0x44, 0x6f, 
-0x77, 0x6e, 0x3a, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x74, 0x65, 0x73, 0x74, 0xff, 
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x3a, 0x20, 0x72, 0x75, 0x6e, 
-0x20, 0x74, 0x65, 0x73, 0x74, 0xff, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x6c, 0x65, 0x63, 
-0x74, 0x3a, 0x20, 0x4e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x6f, 0x70, 0x73, 0xff, 0x0, 0x48, 
-0x8a, 0x48, 0xad, 0x2, 0x20, 0xa9, 0x20, 0x8d, 0x6, 0x20, 0xa9, 0x40, 0x8d, 0x6, 0x20, 0xe6, 
-0xd2, 0xa9, 0x0, 0x8d, 0x5, 0x20, 0x8d, 0x5, 0x20, 0xa9, 0x0, 0x8d, 0x6, 0x20, 0xa9, 0x0, 
-0x8d, 0x6, 0x20, 0xa2, 0x9, 0x8e, 0x16, 0x40, 0xca, 0x8e, 0x16, 0x40, 0xad, 0x16, 0x40, 0x4a, 
-0x26, 0xd4, 0xca, 0xd0, 0xf7, 0xa5, 0xd4, 0xaa, 0x45, 0xd6, 0x25, 0xd4, 0x85, 0xd5, 0x86, 0xd6, 
-0x68, 0xaa, 0x68, 0x40, 0x40, 0xa2, 0x0, 0x86, 0x0, 0x86, 0x10, 0x86, 0x11, 0x20, 0x2d, 0xc7, 
-0x20, 0xdb, 0xc7, 0x20, 0x85, 0xc8, 0x20, 0xde, 0xcb, 0x20, 0xf8, 0xcd, 0x20, 0xee, 0xce, 0x20, 
-0xa2, 0xcf, 0x20, 0x74, 0xd1, 0x20, 0xfb, 0xd4, 0x20, 0x0, 0xd9, 0xa5, 0x0, 0x85, 0x10, 0xa9, 
-0x0, 0x85, 0x0, 0x20, 0xe0, 0xda, 0x20, 0x4a, 0xdf, 0x20, 0xb8, 0xdb, 0x20, 0xaa, 0xe1, 0x20, 
-0xa3, 0xc6, 0x20, 0x1e, 0xe5, 0x20, 0x3d, 0xe7, 0x20, 0xd3, 0xe8, 0x20, 0x16, 0xe9, 0x20, 0x86, 
-0xeb, 0x20, 0xf6, 0xed, 0x20, 0x66, 0xf0, 0x20, 0xd6, 0xf2, 0xa5, 0x0, 0x85, 0x11, 0xa9, 0x0, 
-0x85, 0x0, 0x20, 0x46, 0xf5, 0xa5, 0x0, 0x5, 0x10, 0x5, 0x11, 0xf0, 0xe, 0x20, 0x6f, 0xc6, 
-0xa6, 0x0, 0x86, 0x2, 0xa6, 0x10, 0x86, 0x3, 0x4c, 0x6e, 0xc6, 0x20, 0x89, 0xc6, 0x60, 0xa9, 
-0x3, 0x8d, 0x15, 0x40, 0xa9, 0x87, 0x8d, 0x0, 0x40, 0xa9, 0x89, 0x8d, 0x1, 0x40, 0xa9, 0xf0, 
-0x8d, 0x2, 0x40, 0xa9, 0x0, 0x8d, 0x3, 0x40, 0x60, 0xa9, 0x2, 0x8d, 0x15, 0x40, 0xa9, 0x3f, 
-0x8d, 0x4, 0x40, 0xa9, 0x9a, 0x8d, 0x5, 0x40, 0xa9, 0xff, 0x8d, 0x6, 0x40, 0xa9, 0x0, 0x8d, 
-0x7, 0x40, 0x60, 0xa0, 0x4e, 0xa9, 0xff, 0x85, 0x1, 0x20, 0xb0, 0xc6, 0x20, 0xb7, 0xc6, 0x60, 
-0xa9, 0xff, 0x48, 0xa9, 0xaa, 0xd0, 0x5, 0xa9, 0x34, 0x48, 0xa9, 0x55, 0x28, 0x4, 0xa9, 0x44, 
-0xa9, 0x64, 0xa9, 0xea, 0xea, 0xea, 0xea, 0x8, 0x48, 0xc, 0xa9, 0xa9, 0xea, 0xea, 0xea, 0xea, 
-0x8, 0x48, 0x14, 0xa9, 0x34, 0xa9, 0x54, 0xa9, 0x74, 0xa9, 0xd4, 0xa9, 0xf4, 0xa9, 0xea, 0xea, 
-0xea, 0xea, 0x8, 0x48, 0x1a, 0x3a, 0x5a, 0x7a, 0xda, 0xfa, 0x80, 0x89, 0xea, 0xea, 0xea, 0xea, 
-0x8, 0x48, 0x1c, 0xa9, 0xa9, 0x3c, 0xa9, 0xa9, 0x5c, 0xa9, 0xa9, 0x7c, 0xa9, 0xa9, 0xdc, 0xa9, 
-0xa9, 0xfc, 0xa9, 0xa9, 0xea, 0xea, 0xea, 0xea, 0x8, 0x48, 0xa2, 0x5, 0x68, 0xc9, 0x55, 0xf0, 
-0xa, 0xc9, 0xaa, 0xf0, 0x6, 0x68, 0x84, 0x0, 0x4c, 0x28, 0xc7, 0x68, 0x29, 0xcb, 0xc9, 0x0, 
-0xf0, 0x6, 0xc9, 0xcb, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xca, 0xd0, 0xe0, 0x60, 0xea, 0x38, 0xb0, 
-0x4, 0xa2, 0x1, 0x86, 0x0, 0xea, 0x18, 0xb0, 0x3, 0x4c, 0x40, 0xc7, 0xa2, 0x2, 0x86, 0x0, 
-0xea, 0x38, 0x90, 0x3, 0x4c, 0x4b, 0xc7, 0xa2, 0x3, 0x86, 0x0, 0xea, 0x18, 0x90, 0x4, 0xa2, 
-0x4, 0x86, 0x0, 0xea, 0xa9, 0x0, 0xf0, 0x4, 0xa2, 0x5, 0x86, 0x0, 0xea, 0xa9, 0x40, 0xf0, 
-0x3, 0x4c, 0x68, 0xc7, 0xa2, 0x6, 0x86, 0x0, 0xea, 0xa9, 0x40, 0xd0, 0x4, 0xa2, 0x7, 0x86, 
-0x0, 0xea, 0xa9, 0x0, 0xd0, 0x3, 0x4c, 0x7d, 0xc7, 0xa2, 0x8, 0x86, 0x0, 0xea, 0xa9, 0xff, 
-0x85, 0x1, 0x24, 0x1, 0x70, 0x4, 0xa2, 0x9, 0x86, 0x0, 0xea, 0x24, 0x1, 0x50, 0x3, 0x4c, 
-0x96, 0xc7, 0xa2, 0xa, 0x86, 0x0, 0xea, 0xa9, 0x0, 0x85, 0x1, 0x24, 0x1, 0x50, 0x4, 0xa2, 
-0xb, 0x86, 0x0, 0xea, 0x24, 0x1, 0x70, 0x3, 0x4c, 0xaf, 0xc7, 0xa2, 0xc, 0x86, 0x0, 0xea, 
-0xa9, 0x0, 0x10, 0x4, 0xa2, 0xd, 0x86, 0x0, 0xea, 0xa9, 0x80, 0x10, 0x3, 0x4c, 0xd9, 0xc7, 
-0xa2, 0xe, 0x86, 0x0, 0xea, 0xa9, 0x80, 0x30, 0x4, 0xa2, 0xf, 0x86, 0x0, 0xea, 0xa9, 0x0, 
-0x30, 0x3, 0x4c, 0xd9, 0xc7, 0xa2, 0x10, 0x86, 0x0, 0xea, 0x60, 0xea, 0xa9, 0xff, 0x85, 0x1, 
-0x24, 0x1, 0xa9, 0x0, 0x38, 0x78, 0xf8, 0x8, 0x68, 0x29, 0xef, 0xc9, 0x6f, 0xf0, 0x4, 0xa2, 
-0x11, 0x86, 0x0, 0xea, 0xa9, 0x40, 0x85, 0x1, 0x24, 0x1, 0xd8, 0xa9, 0x10, 0x18, 0x8, 0x68, 
-0x29, 0xef, 0xc9, 0x64, 0xf0, 0x4, 0xa2, 0x12, 0x86, 0x0, 0xea, 0xa9, 0x80, 0x85, 0x1, 0x24, 
-0x1, 0xf8, 0xa9, 0x0, 0x38, 0x8, 0x68, 0x29, 0xef, 0xc9, 0x2f, 0xf0, 0x4, 0xa2, 0x13, 0x86, 
-0x0, 0xea, 0xa9, 0xff, 0x48, 0x28, 0xd0, 0x9, 0x10, 0x7, 0x50, 0x5, 0x90, 0x3, 0x4c, 0x35, 
-0xc8, 0xa2, 0x14, 0x86, 0x0, 0xea, 0xa9, 0x4, 0x48, 0x28, 0xf0, 0x9, 0x30, 0x7, 0x70, 0x5, 
-0xb0, 0x3, 0x4c, 0x49, 0xc8, 0xa2, 0x15, 0x86, 0x0, 0xea, 0xf8, 0xa9, 0xff, 0x85, 0x1, 0x24, 
-0x1, 0x18, 0xa9, 0x0, 0x48, 0xa9, 0xff, 0x68, 0xd0, 0x9, 0x30, 0x7, 0x50, 0x5, 0xb0, 0x3, 
-0x4c, 0x67, 0xc8, 0xa2, 0x16, 0x86, 0x0, 0xea, 0xa9, 0x0, 0x85, 0x1, 0x24, 0x1, 0x38, 0xa9, 
-0xff, 0x48, 0xa9, 0x0, 0x68, 0xf0, 0x9, 0x10, 0x7, 0x70, 0x5, 0x90, 0x3, 0x4c, 0x84, 0xc8, 
-0xa2, 0x17, 0x86, 0x0, 0x60, 0xea, 0x18, 0xa9, 0xff, 0x85, 0x1, 0x24, 0x1, 0xa9, 0x55, 0x9, 
-0xaa, 0xb0, 0xb, 0x10, 0x9, 0xc9, 0xff, 0xd0, 0x5, 0x50, 0x3, 0x4c, 0xa2, 0xc8, 0xa2, 0x18, 
-0x86, 0x0, 0xea, 0x38, 0xb8, 0xa9, 0x0, 0x9, 0x0, 0xd0, 0x9, 0x70, 0x7, 0x90, 0x5, 0x30, 
-0x3, 0x4c, 0xb8, 0xc8, 0xa2, 0x19, 0x86, 0x0, 0xea, 0x18, 0x24, 0x1, 0xa9, 0x55, 0x29, 0xaa, 
-0xd0, 0x9, 0x50, 0x7, 0xb0, 0x5, 0x30, 0x3, 0x4c, 0xcf, 0xc8, 0xa2, 0x1a, 0x86, 0x0, 0xea, 
-0x38, 0xb8, 0xa9, 0xf8, 0x29, 0xef, 0x90, 0xb, 0x10, 0x9, 0xc9, 0xe8, 0xd0, 0x5, 0x70, 0x3, 
-0x4c, 0xe7, 0xc8, 0xa2, 0x1b, 0x86, 0x0, 0xea, 0x18, 0x24, 0x1, 0xa9, 0x5f, 0x49, 0xaa, 0xb0, 
-0xb, 0x10, 0x9, 0xc9, 0xf5, 0xd0, 0x5, 0x50, 0x3, 0x4c, 0x0, 0xc9, 0xa2, 0x1c, 0x86, 0x0, 
-0xea, 0x38, 0xb8, 0xa9, 0x70, 0x49, 0x70, 0xd0, 0x9, 0x70, 0x7, 0x90, 0x5, 0x30, 0x3, 0x4c, 
-0x16, 0xc9, 0xa2, 0x1d, 0x86, 0x0, 0xea, 0x18, 0x24, 0x1, 0xa9, 0x0, 0x69, 0x69, 0x30, 0xb, 
-0xb0, 0x9, 0xc9, 0x69, 0xd0, 0x5, 0x70, 0x3, 0x4c, 0x2f, 0xc9, 0xa2, 0x1e, 0x86, 0x0, 0xea, 
-0x38, 0xf8, 0x24, 0x1, 0xa9, 0x1, 0x69, 0x69, 0x30, 0xb, 0xb0, 0x9, 0xc9, 0x6b, 0xd0, 0x5, 
-0x70, 0x3, 0x4c, 0x49, 0xc9, 0xa2, 0x1f, 0x86, 0x0, 0xea, 0xd8, 0x38, 0xb8, 0xa9, 0x7f, 0x69, 
-0x7f, 0x10, 0xb, 0xb0, 0x9, 0xc9, 0xff, 0xd0, 0x5, 0x50, 0x3, 0x4c, 0x62, 0xc9, 0xa2, 0x20, 
-0x86, 0x0, 0xea, 0x18, 0x24, 0x1, 0xa9, 0x7f, 0x69, 0x80, 0x10, 0xb, 0xb0, 0x9, 0xc9, 0xff, 
-0xd0, 0x5, 0x70, 0x3, 0x4c, 0x7b, 0xc9, 0xa2, 0x21, 0x86, 0x0, 0xea, 0x38, 0xb8, 0xa9, 0x7f, 
-0x69, 0x80, 0xd0, 0x9, 0x30, 0x7, 0x70, 0x5, 0x90, 0x3, 0x4c, 0x91, 0xc9, 0xa2, 0x22, 0x86, 
-0x0, 0xea, 0x38, 0xb8, 0xa9, 0x9f, 0xf0, 0x9, 0x10, 0x7, 0x70, 0x5, 0x90, 0x3, 0x4c, 0xa5, 
-0xc9, 0xa2, 0x23, 0x86, 0x0, 0xea, 0x18, 0x24, 0x1, 0xa9, 0x0, 0xd0, 0x9, 0x30, 0x7, 0x50, 
-0x5, 0xb0, 0x3, 0x4c, 0xba, 0xc9, 0xa2, 0x23, 0x86, 0x0, 0xea, 0x24, 0x1, 0xa9, 0x40, 0xc9, 
-0x40, 0x30, 0x9, 0x90, 0x7, 0xd0, 0x5, 0x50, 0x3, 0x4c, 0xd0, 0xc9, 0xa2, 0x24, 0x86, 0x0, 
-0xea, 0xb8, 0xc9, 0x3f, 0xf0, 0x9, 0x30, 0x7, 0x90, 0x5, 0x70, 0x3, 0x4c, 0xe3, 0xc9, 0xa2, 
-0x25, 0x86, 0x0, 0xea, 0xc9, 0x41, 0xf0, 0x7, 0x10, 0x5, 0x10, 0x3, 0x4c, 0xf3, 0xc9, 0xa2, 
-0x26, 0x86, 0x0, 0xea, 0xa9, 0x80, 0xc9, 0x0, 0xf0, 0x7, 0x10, 0x5, 0x90, 0x3, 0x4c, 0x5, 
-0xca, 0xa2, 0x27, 0x86, 0x0, 0xea, 0xc9, 0x80, 0xd0, 0x7, 0x30, 0x5, 0x90, 0x3, 0x4c, 0x15, 
-0xca, 0xa2, 0x28, 0x86, 0x0, 0xea, 0xc9, 0x81, 0xb0, 0x7, 0xf0, 0x5, 0x10, 0x3, 0x4c, 0x25, 
-0xca, 0xa2, 0x29, 0x86, 0x0, 0xea, 0xc9, 0x7f, 0x90, 0x7, 0xf0, 0x5, 0x30, 0x3, 0x4c, 0x35, 
-0xca, 0xa2, 0x2a, 0x86, 0x0, 0xea, 0x24, 0x1, 0xa0, 0x40, 0xc0, 0x40, 0xd0, 0x9, 0x30, 0x7, 
-0x90, 0x5, 0x50, 0x3, 0x4c, 0x4b, 0xca, 0xa2, 0x2b, 0x86, 0x0, 0xea, 0xb8, 0xc0, 0x3f, 0xf0, 
-0x9, 0x30, 0x7, 0x90, 0x5, 0x70, 0x3, 0x4c, 0x5e, 0xca, 0xa2, 0x2c, 0x86, 0x0, 0xea, 0xc0, 
-0x41, 0xf0, 0x7, 0x10, 0x5, 0x10, 0x3, 0x4c, 0x6e, 0xca, 0xa2, 0x2d, 0x86, 0x0, 0xea, 0xa0, 
-0x80, 0xc0, 0x0, 0xf0, 0x7, 0x10, 0x5, 0x90, 0x3, 0x4c, 0x80, 0xca, 0xa2, 0x2e, 0x86, 0x0, 
-0xea, 0xc0, 0x80, 0xd0, 0x7, 0x30, 0x5, 0x90, 0x3, 0x4c, 0x90, 0xca, 0xa2, 0x2f, 0x86, 0x0, 
-0xea, 0xc0, 0x81, 0xb0, 0x7, 0xf0, 0x5, 0x10, 0x3, 0x4c, 0xa0, 0xca, 0xa2, 0x30, 0x86, 0x0, 
-0xea, 0xc0, 0x7f, 0x90, 0x7, 0xf0, 0x5, 0x30, 0x3, 0x4c, 0xb0, 0xca, 0xa2, 0x31, 0x86, 0x0, 
-0xea, 0x24, 0x1, 0xa2, 0x40, 0xe0, 0x40, 0xd0, 0x9, 0x30, 0x7, 0x90, 0x5, 0x50, 0x3, 0x4c, 
-0xc6, 0xca, 0xa9, 0x32, 0x85, 0x0, 0xea, 0xb8, 0xe0, 0x3f, 0xf0, 0x9, 0x30, 0x7, 0x90, 0x5, 
-0x70, 0x3, 0x4c, 0xd9, 0xca, 0xa9, 0x33, 0x85, 0x0, 0xea, 0xe0, 0x41, 0xf0, 0x7, 0x10, 0x5, 
-0x10, 0x3, 0x4c, 0xe9, 0xca, 0xa9, 0x34, 0x85, 0x0, 0xea, 0xa2, 0x80, 0xe0, 0x0, 0xf0, 0x7, 
-0x10, 0x5, 0x90, 0x3, 0x4c, 0xfb, 0xca, 0xa9, 0x35, 0x85, 0x0, 0xea, 0xe0, 0x80, 0xd0, 0x7, 
-0x30, 0x5, 0x90, 0x3, 0x4c, 0xb, 0xcb, 0xa9, 0x36, 0x85, 0x0, 0xea, 0xe0, 0x81, 0xb0, 0x7, 
-0xf0, 0x5, 0x10, 0x3, 0x4c, 0x1b, 0xcb, 0xa9, 0x37, 0x85, 0x0, 0xea, 0xe0, 0x7f, 0x90, 0x7, 
-0xf0, 0x5, 0x30, 0x3, 0x4c, 0x2b, 0xcb, 0xa9, 0x38, 0x85, 0x0, 0xea, 0x38, 0xb8, 0xa2, 0x9f, 
-0xf0, 0x9, 0x10, 0x7, 0x70, 0x5, 0x90, 0x3, 0x4c, 0x3f, 0xcb, 0xa2, 0x39, 0x86, 0x0, 0xea, 
-0x18, 0x24, 0x1, 0xa2, 0x0, 0xd0, 0x9, 0x30, 0x7, 0x50, 0x5, 0xb0, 0x3, 0x4c, 0x54, 0xcb, 
-0xa2, 0x3a, 0x86, 0x0, 0xea, 0x38, 0xb8, 0xa0, 0x9f, 0xf0, 0x9, 0x10, 0x7, 0x70, 0x5, 0x90, 
-0x3, 0x4c, 0x68, 0xcb, 0xa2, 0x3b, 0x86, 0x0, 0xea, 0x18, 0x24, 0x1, 0xa0, 0x0, 0xd0, 0x9, 
-0x30, 0x7, 0x50, 0x5, 0xb0, 0x3, 0x4c, 0x7d, 0xcb, 0xa2, 0x3c, 0x86, 0x0, 0xea, 0xa9, 0x55, 
-0xa2, 0xaa, 0xa0, 0x33, 0xc9, 0x55, 0xd0, 0x23, 0xe0, 0xaa, 0xd0, 0x1f, 0xc0, 0x33, 0xd0, 0x1b, 
-0xc9, 0x55, 0xd0, 0x17, 0xe0, 0xaa, 0xd0, 0x13, 0xc0, 0x33, 0xd0, 0xf, 0xc9, 0x56, 0xf0, 0xb, 
-0xe0, 0xab, 0xf0, 0x7, 0xc0, 0x34, 0xf0, 0x3, 0x4c, 0xaf, 0xcb, 0xa2, 0x3d, 0x86, 0x0, 0xa0, 
-0x71, 0x20, 0x31, 0xf9, 0xe9, 0x40, 0x20, 0x37, 0xf9, 0xc8, 0x20, 0x47, 0xf9, 0xe9, 0x3f, 0x20, 
-0x4c, 0xf9, 0xc8, 0x20, 0x5c, 0xf9, 0xe9, 0x41, 0x20, 0x62, 0xf9, 0xc8, 0x20, 0x72, 0xf9, 0xe9, 
-0x0, 0x20, 0x76, 0xf9, 0xc8, 0x20, 0x80, 0xf9, 0xe9, 0x7f, 0x20, 0x84, 0xf9, 0x60, 0xea, 0xa9, 
-0xff, 0x85, 0x1, 0xa9, 0x44, 0xa2, 0x55, 0xa0, 0x66, 0xe8, 0x88, 0xe0, 0x56, 0xd0, 0x21, 0xc0, 
-0x65, 0xd0, 0x1d, 0xe8, 0xe8, 0x88, 0x88, 0xe0, 0x58, 0xd0, 0x15, 0xc0, 0x63, 0xd0, 0x11, 0xca, 
-0xc8, 0xe0, 0x57, 0xd0, 0xb, 0xc0, 0x64, 0xd0, 0x7, 0xc9, 0x44, 0xd0, 0x3, 0x4c, 0x14, 0xcc, 
-0xa2, 0x3e, 0x86, 0x0, 0xea, 0x38, 0xa2, 0x69, 0xa9, 0x96, 0x24, 0x1, 0xa0, 0xff, 0xc8, 0xd0, 
-0x3d, 0x30, 0x3b, 0x90, 0x39, 0x50, 0x37, 0xc0, 0x0, 0xd0, 0x33, 0xc8, 0xf0, 0x30, 0x30, 0x2e, 
-0x90, 0x2c, 0x50, 0x2a, 0x18, 0xb8, 0xa0, 0x0, 0x88, 0xf0, 0x23, 0x10, 0x21, 0xb0, 0x1f, 0x70, 
-0x1d, 0xc0, 0xff, 0xd0, 0x19, 0x18, 0x88, 0xf0, 0x15, 0x10, 0x13, 0xb0, 0x11, 0x70, 0xf, 0xc0, 
-0xfe, 0xd0, 0xb, 0xc9, 0x96, 0xd0, 0x7, 0xe0, 0x69, 0xd0, 0x3, 0x4c, 0x62, 0xcc, 0xa2, 0x3f, 
-0x86, 0x0, 0xea, 0x38, 0xa0, 0x69, 0xa9, 0x96, 0x24, 0x1, 0xa2, 0xff, 0xe8, 0xd0, 0x3d, 0x30, 
-0x3b, 0x90, 0x39, 0x50, 0x37, 0xe0, 0x0, 0xd0, 0x33, 0xe8, 0xf0, 0x30, 0x30, 0x2e, 0x90, 0x2c, 
-0x50, 0x2a, 0x18, 0xb8, 0xa2, 0x0, 0xca, 0xf0, 0x23, 0x10, 0x21, 0xb0, 0x1f, 0x70, 0x1d, 0xe0, 
-0xff, 0xd0, 0x19, 0x18, 0xca, 0xf0, 0x15, 0x10, 0x13, 0xb0, 0x11, 0x70, 0xf, 0xe0, 0xfe, 0xd0, 
-0xb, 0xc9, 0x96, 0xd0, 0x7, 0xc0, 0x69, 0xd0, 0x3, 0x4c, 0xb0, 0xcc, 0xa2, 0x40, 0x86, 0x0, 
-0xea, 0xa9, 0x85, 0xa2, 0x34, 0xa0, 0x99, 0x18, 0x24, 0x1, 0xa8, 0xf0, 0x2e, 0xb0, 0x2c, 0x50, 
-0x2a, 0x10, 0x28, 0xc9, 0x85, 0xd0, 0x24, 0xe0, 0x34, 0xd0, 0x20, 0xc0, 0x85, 0xd0, 0x1c, 0xa9, 
-0x0, 0x38, 0xb8, 0xa8, 0xd0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0xf, 0xc9, 0x0, 0xd0, 0xb, 
-0xe0, 0x34, 0xd0, 0x7, 0xc0, 0x0, 0xd0, 0x3, 0x4c, 0xef, 0xcc, 0xa2, 0x41, 0x86, 0x0, 0xea, 
-0xa9, 0x85, 0xa2, 0x34, 0xa0, 0x99, 0x18, 0x24, 0x1, 0xaa, 0xf0, 0x2e, 0xb0, 0x2c, 0x50, 0x2a, 
-0x10, 0x28, 0xc9, 0x85, 0xd0, 0x24, 0xe0, 0x85, 0xd0, 0x20, 0xc0, 0x99, 0xd0, 0x1c, 0xa9, 0x0, 
-0x38, 0xb8, 0xaa, 0xd0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0xf, 0xc9, 0x0, 0xd0, 0xb, 0xe0, 
-0x0, 0xd0, 0x7, 0xc0, 0x99, 0xd0, 0x3, 0x4c, 0x2e, 0xcd, 0xa2, 0x42, 0x86, 0x0, 0xea, 0xa9, 
-0x85, 0xa2, 0x34, 0xa0, 0x99, 0x18, 0x24, 0x1, 0x98, 0xf0, 0x2e, 0xb0, 0x2c, 0x50, 0x2a, 0x10, 
-0x28, 0xc9, 0x99, 0xd0, 0x24, 0xe0, 0x34, 0xd0, 0x20, 0xc0, 0x99, 0xd0, 0x1c, 0xa0, 0x0, 0x38, 
-0xb8, 0x98, 0xd0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0xf, 0xc9, 0x0, 0xd0, 0xb, 0xe0, 0x34, 
-0xd0, 0x7, 0xc0, 0x0, 0xd0, 0x3, 0x4c, 0x6d, 0xcd, 0xa2, 0x43, 0x86, 0x0, 0xea, 0xa9, 0x85, 
-0xa2, 0x34, 0xa0, 0x99, 0x18, 0x24, 0x1, 0x8a, 0xf0, 0x2e, 0xb0, 0x2c, 0x50, 0x2a, 0x30, 0x28, 
-0xc9, 0x34, 0xd0, 0x24, 0xe0, 0x34, 0xd0, 0x20, 0xc0, 0x99, 0xd0, 0x1c, 0xa2, 0x0, 0x38, 0xb8, 
-0x8a, 0xd0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0xf, 0xc9, 0x0, 0xd0, 0xb, 0xe0, 0x0, 0xd0, 
-0x7, 0xc0, 0x99, 0xd0, 0x3, 0x4c, 0xac, 0xcd, 0xa2, 0x44, 0x86, 0x0, 0xea, 0xba, 0x8e, 0xff, 
-0x7, 0xa0, 0x33, 0xa2, 0x69, 0xa9, 0x84, 0x18, 0x24, 0x1, 0x9a, 0xf0, 0x32, 0x10, 0x30, 0xb0, 
-0x2e, 0x50, 0x2c, 0xc9, 0x84, 0xd0, 0x28, 0xe0, 0x69, 0xd0, 0x24, 0xc0, 0x33, 0xd0, 0x20, 0xa0, 
-0x1, 0xa9, 0x4, 0x38, 0xb8, 0xa2, 0x0, 0xba, 0xf0, 0x15, 0x30, 0x13, 0x90, 0x11, 0x70, 0xf, 
-0xe0, 0x69, 0xd0, 0xb, 0xc9, 0x4, 0xd0, 0x7, 0xc0, 0x1, 0xd0, 0x3, 0x4c, 0xf3, 0xcd, 0xa2, 
-0x45, 0x86, 0x0, 0xae, 0xff, 0x7, 0x9a, 0x60, 0xa9, 0xff, 0x85, 0x1, 0xba, 0x8e, 0xff, 0x7, 
-0xea, 0xa2, 0x80, 0x9a, 0xa9, 0x33, 0x48, 0xa9, 0x69, 0x48, 0xba, 0xe0, 0x7e, 0xd0, 0x20, 0x68, 
-0xc9, 0x69, 0xd0, 0x1b, 0x68, 0xc9, 0x33, 0xd0, 0x16, 0xba, 0xe0, 0x80, 0xd0, 0x11, 0xad, 0x80, 
-0x1, 0xc9, 0x33, 0xd0, 0xa, 0xad, 0x7f, 0x1, 0xc9, 0x69, 0xd0, 0x3, 0x4c, 0x33, 0xce, 0xa2, 
-0x46, 0x86, 0x0, 0xea, 0xa2, 0x80, 0x9a, 0x20, 0x3d, 0xce, 0x4c, 0x5b, 0xce, 0xba, 0xe0, 0x7e, 
-0xd0, 0x19, 0x68, 0x68, 0xba, 0xe0, 0x80, 0xd0, 0x12, 0xa9, 0x0, 0x20, 0x4e, 0xce, 0x68, 0xc9, 
-0x4d, 0xd0, 0x8, 0x68, 0xc9, 0xce, 0xd0, 0x3, 0x4c, 0x5f, 0xce, 0xa2, 0x47, 0x86, 0x0, 0xea, 
-0xa9, 0xce, 0x48, 0xa9, 0x66, 0x48, 0x60, 0xa2, 0x77, 0xa0, 0x69, 0x18, 0x24, 0x1, 0xa9, 0x83, 
-0x20, 0x66, 0xce, 0xf0, 0x24, 0x10, 0x22, 0xb0, 0x20, 0x50, 0x1e, 0xc9, 0x83, 0xd0, 0x1a, 0xc0, 
-0x69, 0xd0, 0x16, 0xe0, 0x77, 0xd0, 0x12, 0x38, 0xb8, 0xa9, 0x0, 0x20, 0x66, 0xce, 0xd0, 0x9, 
-0x30, 0x7, 0x90, 0x5, 0x70, 0x3, 0x4c, 0x9d, 0xce, 0xa2, 0x48, 0x86, 0x0, 0xea, 0xa9, 0xce, 
-0x48, 0xa9, 0xae, 0x48, 0xa9, 0x65, 0x48, 0xa9, 0x55, 0xa0, 0x88, 0xa2, 0x99, 0x40, 0x30, 0x35, 
-0x50, 0x33, 0xf0, 0x31, 0x90, 0x2f, 0xc9, 0x55, 0xd0, 0x2b, 0xc0, 0x88, 0xd0, 0x27, 0xe0, 0x99, 
-0xd0, 0x23, 0xa9, 0xce, 0x48, 0xa9, 0xce, 0x48, 0xa9, 0x87, 0x48, 0xa9, 0x55, 0x40, 0x10, 0x15, 
-0x70, 0x13, 0xd0, 0x11, 0x90, 0xf, 0xc9, 0x55, 0xd0, 0xb, 0xc0, 0x88, 0xd0, 0x7, 0xe0, 0x99, 
-0xd0, 0x3, 0x4c, 0xe9, 0xce, 0xa2, 0x49, 0x86, 0x0, 0xae, 0xff, 0x7, 0x9a, 0x60, 0xa2, 0x55, 
-0xa0, 0x69, 0xa9, 0xff, 0x85, 0x1, 0xea, 0x24, 0x1, 0x38, 0xa9, 0x1, 0x4a, 0x90, 0x1d, 0xd0, 
-0x1b, 0x30, 0x19, 0x50, 0x17, 0xc9, 0x0, 0xd0, 0x13, 0xb8, 0xa9, 0xaa, 0x4a, 0xb0, 0xd, 0xf0, 
-0xb, 0x30, 0x9, 0x70, 0x7, 0xc9, 0x55, 0xd0, 0x3, 0x4c, 0x20, 0xcf, 0xa2, 0x4a, 0x86, 0x0, 
-0xea, 0x24, 0x1, 0x38, 0xa9, 0x80, 0xa, 0x90, 0x1e, 0xd0, 0x1c, 0x30, 0x1a, 0x50, 0x18, 0xc9, 
-0x0, 0xd0, 0x14, 0xb8, 0x38, 0xa9, 0x55, 0xa, 0xb0, 0xd, 0xf0, 0xb, 0x10, 0x9, 0x70, 0x7, 
-0xc9, 0xaa, 0xd0, 0x3, 0x4c, 0x4b, 0xcf, 0xa2, 0x4b, 0x86, 0x0, 0xea, 0x24, 0x1, 0x38, 0xa9, 
-0x1, 0x6a, 0x90, 0x1e, 0xf0, 0x1c, 0x10, 0x1a, 0x50, 0x18, 0xc9, 0x80, 0xd0, 0x14, 0xb8, 0x18, 
-0xa9, 0x55, 0x6a, 0x90, 0xd, 0xf0, 0xb, 0x30, 0x9, 0x70, 0x7, 0xc9, 0x2a, 0xd0, 0x3, 0x4c, 
-0x76, 0xcf, 0xa2, 0x4c, 0x86, 0x0, 0xea, 0x24, 0x1, 0x38, 0xa9, 0x80, 0x2a, 0x90, 0x1e, 0xf0, 
-0x1c, 0x30, 0x1a, 0x50, 0x18, 0xc9, 0x1, 0xd0, 0x14, 0xb8, 0x18, 0xa9, 0x55, 0x2a, 0xb0, 0xd, 
-0xf0, 0xb, 0x10, 0x9, 0x70, 0x7, 0xc9, 0xaa, 0xd0, 0x3, 0x4c, 0xa1, 0xcf, 0xa2, 0x4d, 0x86, 
-0x0, 0x60, 0xa5, 0x0, 0x8d, 0xff, 0x7, 0xa9, 0x0, 0x85, 0x80, 0xa9, 0x2, 0x85, 0x81, 0xa9, 
-0xff, 0x85, 0x1, 0xa9, 0x0, 0x85, 0x82, 0xa9, 0x3, 0x85, 0x83, 0x85, 0x84, 0xa9, 0x0, 0x85, 
-0xff, 0xa9, 0x4, 0x85, 0x0, 0xa9, 0x5a, 0x8d, 0x0, 0x2, 0xa9, 0x5b, 0x8d, 0x0, 0x3, 0xa9, 
-0x5c, 0x8d, 0x3, 0x3, 0xa9, 0x5d, 0x8d, 0x0, 0x4, 0xa2, 0x0, 0xa1, 0x80, 0xc9, 0x5a, 0xd0, 
-0x1f, 0xe8, 0xe8, 0xa1, 0x80, 0xc9, 0x5b, 0xd0, 0x17, 0xe8, 0xa1, 0x80, 0xc9, 0x5c, 0xd0, 0x10, 
-0xa2, 0x0, 0xa1, 0xff, 0xc9, 0x5d, 0xd0, 0x8, 0xa2, 0x81, 0xa1, 0xff, 0xc9, 0x5a, 0xf0, 0x5, 
-0xa9, 0x58, 0x8d, 0xff, 0x7, 0xa9, 0xaa, 0xa2, 0x0, 0x81, 0x80, 0xe8, 0xe8, 0xa9, 0xab, 0x81, 
-0x80, 0xe8, 0xa9, 0xac, 0x81, 0x80, 0xa2, 0x0, 0xa9, 0xad, 0x81, 0xff, 0xad, 0x0, 0x2, 0xc9, 
-0xaa, 0xd0, 0x15, 0xad, 0x0, 0x3, 0xc9, 0xab, 0xd0, 0xe, 0xad, 0x3, 0x3, 0xc9, 0xac, 0xd0, 
-0x7, 0xad, 0x0, 0x4, 0xc9, 0xad, 0xf0, 0x5, 0xa9, 0x59, 0x8d, 0xff, 0x7, 0xad, 0xff, 0x7, 
-0x85, 0x0, 0xa9, 0x0, 0x8d, 0x0, 0x3, 0xa9, 0xaa, 0x8d, 0x0, 0x2, 0xa2, 0x0, 0xa0, 0x5a, 
-0x20, 0xb6, 0xf7, 0x1, 0x80, 0x20, 0xc0, 0xf7, 0xc8, 0x20, 0xce, 0xf7, 0x1, 0x82, 0x20, 0xd3, 
-0xf7, 0xc8, 0x20, 0xdf, 0xf7, 0x21, 0x80, 0x20, 0xe5, 0xf7, 0xc8, 0xa9, 0xef, 0x8d, 0x0, 0x3, 
-0x20, 0xf1, 0xf7, 0x21, 0x82, 0x20, 0xf6, 0xf7, 0xc8, 0x20, 0x4, 0xf8, 0x41, 0x80, 0x20, 0xa, 
-0xf8, 0xc8, 0xa9, 0x70, 0x8d, 0x0, 0x3, 0x20, 0x18, 0xf8, 0x41, 0x82, 0x20, 0x1d, 0xf8, 0xc8, 
-0xa9, 0x69, 0x8d, 0x0, 0x2, 0x20, 0x29, 0xf8, 0x61, 0x80, 0x20, 0x2f, 0xf8, 0xc8, 0x20, 0x3d, 
-0xf8, 0x61, 0x80, 0x20, 0x43, 0xf8, 0xc8, 0xa9, 0x7f, 0x8d, 0x0, 0x2, 0x20, 0x51, 0xf8, 0x61, 
-0x80, 0x20, 0x56, 0xf8, 0xc8, 0xa9, 0x80, 0x8d, 0x0, 0x2, 0x20, 0x64, 0xf8, 0x61, 0x80, 0x20, 
-0x6a, 0xf8, 0xc8, 0x20, 0x78, 0xf8, 0x61, 0x80, 0x20, 0x7d, 0xf8, 0xc8, 0xa9, 0x40, 0x8d, 0x0, 
-0x2, 0x20, 0x89, 0xf8, 0xc1, 0x80, 0x20, 0x8e, 0xf8, 0xc8, 0x48, 0xa9, 0x3f, 0x8d, 0x0, 0x2, 
-0x68, 0x20, 0x9a, 0xf8, 0xc1, 0x80, 0x20, 0x9c, 0xf8, 0xc8, 0x48, 0xa9, 0x41, 0x8d, 0x0, 0x2, 
-0x68, 0xc1, 0x80, 0x20, 0xa8, 0xf8, 0xc8, 0x48, 0xa9, 0x0, 0x8d, 0x0, 0x2, 0x68, 0x20, 0xb2, 
-0xf8, 0xc1, 0x80, 0x20, 0xb5, 0xf8, 0xc8, 0x48, 0xa9, 0x80, 0x8d, 0x0, 0x2, 0x68, 0xc1, 0x80, 
-0x20, 0xbf, 0xf8, 0xc8, 0x48, 0xa9, 0x81, 0x8d, 0x0, 0x2, 0x68, 0xc1, 0x80, 0x20, 0xc9, 0xf8, 
-0xc8, 0x48, 0xa9, 0x7f, 0x8d, 0x0, 0x2, 0x68, 0xc1, 0x80, 0x20, 0xd3, 0xf8, 0xc8, 0xa9, 0x40, 
-0x8d, 0x0, 0x2, 0x20, 0x31, 0xf9, 0xe1, 0x80, 0x20, 0x37, 0xf9, 0xc8, 0xa9, 0x3f, 0x8d, 0x0, 
-0x2, 0x20, 0x47, 0xf9, 0xe1, 0x80, 0x20, 0x4c, 0xf9, 0xc8, 0xa9, 0x41, 0x8d, 0x0, 0x2, 0x20, 
-0x5c, 0xf9, 0xe1, 0x80, 0x20, 0x62, 0xf9, 0xc8, 0xa9, 0x0, 0x8d, 0x0, 0x2, 0x20, 0x72, 0xf9, 
-0xe1, 0x80, 0x20, 0x76, 0xf9, 0xc8, 0xa9, 0x7f, 0x8d, 0x0, 0x2, 0x20, 0x80, 0xf9, 0xe1, 0x80, 
-0x20, 0x84, 0xf9, 0x60, 0xa9, 0x55, 0x85, 0x78, 0xa9, 0xff, 0x85, 0x1, 0x24, 0x1, 0xa0, 0x11, 
-0xa2, 0x23, 0xa9, 0x0, 0xa5, 0x78, 0xf0, 0x10, 0x30, 0xe, 0xc9, 0x55, 0xd0, 0xa, 0xc0, 0x11, 
-0xd0, 0x6, 0xe0, 0x23, 0x50, 0x2, 0xf0, 0x4, 0xa9, 0x76, 0x85, 0x0, 0xa9, 0x46, 0x24, 0x1, 
-0x85, 0x78, 0xf0, 0xa, 0x10, 0x8, 0x50, 0x6, 0xa5, 0x78, 0xc9, 0x46, 0xf0, 0x4, 0xa9, 0x77, 
-0x85, 0x0, 0xa9, 0x55, 0x85, 0x78, 0x24, 0x1, 0xa9, 0x11, 0xa2, 0x23, 0xa0, 0x0, 0xa4, 0x78, 
-0xf0, 0x10, 0x30, 0xe, 0xc0, 0x55, 0xd0, 0xa, 0xc9, 0x11, 0xd0, 0x6, 0xe0, 0x23, 0x50, 0x2, 
-0xf0, 0x4, 0xa9, 0x78, 0x85, 0x0, 0xa0, 0x46, 0x24, 0x1, 0x84, 0x78, 0xf0, 0xa, 0x10, 0x8, 
-0x50, 0x6, 0xa4, 0x78, 0xc0, 0x46, 0xf0, 0x4, 0xa9, 0x79, 0x85, 0x0, 0x24, 0x1, 0xa9, 0x55, 
-0x85, 0x78, 0xa0, 0x11, 0xa9, 0x23, 0xa2, 0x0, 0xa6, 0x78, 0xf0, 0x10, 0x30, 0xe, 0xe0, 0x55, 
-0xd0, 0xa, 0xc0, 0x11, 0xd0, 0x6, 0xc9, 0x23, 0x50, 0x2, 0xf0, 0x4, 0xa9, 0x7a, 0x85, 0x0, 
-0xa2, 0x46, 0x24, 0x1, 0x86, 0x78, 0xf0, 0xa, 0x10, 0x8, 0x50, 0x6, 0xa6, 0x78, 0xe0, 0x46, 
-0xf0, 0x4, 0xa9, 0x7b, 0x85, 0x0, 0xa9, 0xc0, 0x85, 0x78, 0xa2, 0x33, 0xa0, 0x88, 0xa9, 0x5, 
-0x24, 0x78, 0x10, 0x10, 0x50, 0xe, 0xd0, 0xc, 0xc9, 0x5, 0xd0, 0x8, 0xe0, 0x33, 0xd0, 0x4, 
-0xc0, 0x88, 0xf0, 0x4, 0xa9, 0x7c, 0x85, 0x0, 0xa9, 0x3, 0x85, 0x78, 0xa9, 0x1, 0x24, 0x78, 
-0x30, 0x8, 0x70, 0x6, 0xf0, 0x4, 0xc9, 0x1, 0xf0, 0x4, 0xa9, 0x7d, 0x85, 0x0, 0xa0, 0x7e, 
-0xa9, 0xaa, 0x85, 0x78, 0x20, 0xb6, 0xf7, 0x5, 0x78, 0x20, 0xc0, 0xf7, 0xc8, 0xa9, 0x0, 0x85, 
-0x78, 0x20, 0xce, 0xf7, 0x5, 0x78, 0x20, 0xd3, 0xf7, 0xc8, 0xa9, 0xaa, 0x85, 0x78, 0x20, 0xdf, 
-0xf7, 0x25, 0x78, 0x20, 0xe5, 0xf7, 0xc8, 0xa9, 0xef, 0x85, 0x78, 0x20, 0xf1, 0xf7, 0x25, 0x78, 
-0x20, 0xf6, 0xf7, 0xc8, 0xa9, 0xaa, 0x85, 0x78, 0x20, 0x4, 0xf8, 0x45, 0x78, 0x20, 0xa, 0xf8, 
-0xc8, 0xa9, 0x70, 0x85, 0x78, 0x20, 0x18, 0xf8, 0x45, 0x78, 0x20, 0x1d, 0xf8, 0xc8, 0xa9, 0x69, 
-0x85, 0x78, 0x20, 0x29, 0xf8, 0x65, 0x78, 0x20, 0x2f, 0xf8, 0xc8, 0x20, 0x3d, 0xf8, 0x65, 0x78, 
-0x20, 0x43, 0xf8, 0xc8, 0xa9, 0x7f, 0x85, 0x78, 0x20, 0x51, 0xf8, 0x65, 0x78, 0x20, 0x56, 0xf8, 
-0xc8, 0xa9, 0x80, 0x85, 0x78, 0x20, 0x64, 0xf8, 0x65, 0x78, 0x20, 0x6a, 0xf8, 0xc8, 0x20, 0x78, 
-0xf8, 0x65, 0x78, 0x20, 0x7d, 0xf8, 0xc8, 0xa9, 0x40, 0x85, 0x78, 0x20, 0x89, 0xf8, 0xc5, 0x78, 
-0x20, 0x8e, 0xf8, 0xc8, 0x48, 0xa9, 0x3f, 0x85, 0x78, 0x68, 0x20, 0x9a, 0xf8, 0xc5, 0x78, 0x20, 
-0x9c, 0xf8, 0xc8, 0x48, 0xa9, 0x41, 0x85, 0x78, 0x68, 0xc5, 0x78, 0x20, 0xa8, 0xf8, 0xc8, 0x48, 
-0xa9, 0x0, 0x85, 0x78, 0x68, 0x20, 0xb2, 0xf8, 0xc5, 0x78, 0x20, 0xb5, 0xf8, 0xc8, 0x48, 0xa9, 
-0x80, 0x85, 0x78, 0x68, 0xc5, 0x78, 0x20, 0xbf, 0xf8, 0xc8, 0x48, 0xa9, 0x81, 0x85, 0x78, 0x68, 
-0xc5, 0x78, 0x20, 0xc9, 0xf8, 0xc8, 0x48, 0xa9, 0x7f, 0x85, 0x78, 0x68, 0xc5, 0x78, 0x20, 0xd3, 
-0xf8, 0xc8, 0xa9, 0x40, 0x85, 0x78, 0x20, 0x31, 0xf9, 0xe5, 0x78, 0x20, 0x37, 0xf9, 0xc8, 0xa9, 
-0x3f, 0x85, 0x78, 0x20, 0x47, 0xf9, 0xe5, 0x78, 0x20, 0x4c, 0xf9, 0xc8, 0xa9, 0x41, 0x85, 0x78, 
-0x20, 0x5c, 0xf9, 0xe5, 0x78, 0x20, 0x62, 0xf9, 0xc8, 0xa9, 0x0, 0x85, 0x78, 0x20, 0x72, 0xf9, 
-0xe5, 0x78, 0x20, 0x76, 0xf9, 0xc8, 0xa9, 0x7f, 0x85, 0x78, 0x20, 0x80, 0xf9, 0xe5, 0x78, 0x20, 
-0x84, 0xf9, 0xc8, 0xa9, 0x40, 0x85, 0x78, 0x20, 0x89, 0xf8, 0xaa, 0xe4, 0x78, 0x20, 0x8e, 0xf8, 
-0xc8, 0xa9, 0x3f, 0x85, 0x78, 0x20, 0x9a, 0xf8, 0xe4, 0x78, 0x20, 0x9c, 0xf8, 0xc8, 0xa9, 0x41, 
-0x85, 0x78, 0xe4, 0x78, 0x20, 0xa8, 0xf8, 0xc8, 0xa9, 0x0, 0x85, 0x78, 0x20, 0xb2, 0xf8, 0xaa, 
-0xe4, 0x78, 0x20, 0xb5, 0xf8, 0xc8, 0xa9, 0x80, 0x85, 0x78, 0xe4, 0x78, 0x20, 0xbf, 0xf8, 0xc8, 
-0xa9, 0x81, 0x85, 0x78, 0xe4, 0x78, 0x20, 0xc9, 0xf8, 0xc8, 0xa9, 0x7f, 0x85, 0x78, 0xe4, 0x78, 
-0x20, 0xd3, 0xf8, 0xc8, 0x98, 0xaa, 0xa9, 0x40, 0x85, 0x78, 0x20, 0xdd, 0xf8, 0xc4, 0x78, 0x20, 
-0xe2, 0xf8, 0xe8, 0xa9, 0x3f, 0x85, 0x78, 0x20, 0xee, 0xf8, 0xc4, 0x78, 0x20, 0xf0, 0xf8, 0xe8, 
-0xa9, 0x41, 0x85, 0x78, 0xc4, 0x78, 0x20, 0xfc, 0xf8, 0xe8, 0xa9, 0x0, 0x85, 0x78, 0x20, 0x6, 
-0xf9, 0xc4, 0x78, 0x20, 0x9, 0xf9, 0xe8, 0xa9, 0x80, 0x85, 0x78, 0xc4, 0x78, 0x20, 0x13, 0xf9, 
-0xe8, 0xa9, 0x81, 0x85, 0x78, 0xc4, 0x78, 0x20, 0x1d, 0xf9, 0xe8, 0xa9, 0x7f, 0x85, 0x78, 0xc4, 
-0x78, 0x20, 0x27, 0xf9, 0xe8, 0x8a, 0xa8, 0x20, 0x90, 0xf9, 0x85, 0x78, 0x46, 0x78, 0xa5, 0x78, 
-0x20, 0x9d, 0xf9, 0xc8, 0x85, 0x78, 0x46, 0x78, 0xa5, 0x78, 0x20, 0xad, 0xf9, 0xc8, 0x20, 0xbd, 
-0xf9, 0x85, 0x78, 0x6, 0x78, 0xa5, 0x78, 0x20, 0xc3, 0xf9, 0xc8, 0x85, 0x78, 0x6, 0x78, 0xa5, 
-0x78, 0x20, 0xd4, 0xf9, 0xc8, 0x20, 0xe4, 0xf9, 0x85, 0x78, 0x66, 0x78, 0xa5, 0x78, 0x20, 0xea, 
-0xf9, 0xc8, 0x85, 0x78, 0x66, 0x78, 0xa5, 0x78, 0x20, 0xfb, 0xf9, 0xc8, 0x20, 0xa, 0xfa, 0x85, 
-0x78, 0x26, 0x78, 0xa5, 0x78, 0x20, 0x10, 0xfa, 0xc8, 0x85, 0x78, 0x26, 0x78, 0xa5, 0x78, 0x20, 
-0x21, 0xfa, 0xa9, 0xff, 0x85, 0x78, 0x85, 0x1, 0x24, 0x1, 0x38, 0xe6, 0x78, 0xd0, 0xc, 0x30, 
-0xa, 0x50, 0x8, 0x90, 0x6, 0xa5, 0x78, 0xc9, 0x0, 0xf0, 0x4, 0xa9, 0xab, 0x85, 0x0, 0xa9, 
-0x7f, 0x85, 0x78, 0xb8, 0x18, 0xe6, 0x78, 0xf0, 0xc, 0x10, 0xa, 0x70, 0x8, 0xb0, 0x6, 0xa5, 
-0x78, 0xc9, 0x80, 0xf0, 0x4, 0xa9, 0xac, 0x85, 0x0, 0xa9, 0x0, 0x85, 0x78, 0x24, 0x1, 0x38, 
-0xc6, 0x78, 0xf0, 0xc, 0x10, 0xa, 0x50, 0x8, 0x90, 0x6, 0xa5, 0x78, 0xc9, 0xff, 0xf0, 0x4, 
-0xa9, 0xad, 0x85, 0x0, 0xa9, 0x80, 0x85, 0x78, 0xb8, 0x18, 0xc6, 0x78, 0xf0, 0xc, 0x30, 0xa, 
-0x70, 0x8, 0xb0, 0x6, 0xa5, 0x78, 0xc9, 0x7f, 0xf0, 0x4, 0xa9, 0xae, 0x85, 0x0, 0xa9, 0x1, 
-0x85, 0x78, 0xc6, 0x78, 0xf0, 0x4, 0xa9, 0xaf, 0x85, 0x0, 0x60, 0xa9, 0x55, 0x8d, 0x78, 0x6, 
-0xa9, 0xff, 0x85, 0x1, 0x24, 0x1, 0xa0, 0x11, 0xa2, 0x23, 0xa9, 0x0, 0xad, 0x78, 0x6, 0xf0, 
-0x10, 0x30, 0xe, 0xc9, 0x55, 0xd0, 0xa, 0xc0, 0x11, 0xd0, 0x6, 0xe0, 0x23, 0x50, 0x2, 0xf0, 
-0x4, 0xa9, 0xb0, 0x85, 0x0, 0xa9, 0x46, 0x24, 0x1, 0x8d, 0x78, 0x6, 0xf0, 0xb, 0x10, 0x9, 
-0x50, 0x7, 0xad, 0x78, 0x6, 0xc9, 0x46, 0xf0, 0x4, 0xa9, 0xb1, 0x85, 0x0, 0xa9, 0x55, 0x8d, 
-0x78, 0x6, 0x24, 0x1, 0xa9, 0x11, 0xa2, 0x23, 0xa0, 0x0, 0xac, 0x78, 0x6, 0xf0, 0x10, 0x30, 
-0xe, 0xc0, 0x55, 0xd0, 0xa, 0xc9, 0x11, 0xd0, 0x6, 0xe0, 0x23, 0x50, 0x2, 0xf0, 0x4, 0xa9, 
-0xb2, 0x85, 0x0, 0xa0, 0x46, 0x24, 0x1, 0x8c, 0x78, 0x6, 0xf0, 0xb, 0x10, 0x9, 0x50, 0x7, 
-0xac, 0x78, 0x6, 0xc0, 0x46, 0xf0, 0x4, 0xa9, 0xb3, 0x85, 0x0, 0x24, 0x1, 0xa9, 0x55, 0x8d, 
-0x78, 0x6, 0xa0, 0x11, 0xa9, 0x23, 0xa2, 0x0, 0xae, 0x78, 0x6, 0xf0, 0x10, 0x30, 0xe, 0xe0, 
-0x55, 0xd0, 0xa, 0xc0, 0x11, 0xd0, 0x6, 0xc9, 0x23, 0x50, 0x2, 0xf0, 0x4, 0xa9, 0xb4, 0x85, 
-0x0, 0xa2, 0x46, 0x24, 0x1, 0x8e, 0x78, 0x6, 0xf0, 0xb, 0x10, 0x9, 0x50, 0x7, 0xae, 0x78, 
-0x6, 0xe0, 0x46, 0xf0, 0x4, 0xa9, 0xb5, 0x85, 0x0, 0xa9, 0xc0, 0x8d, 0x78, 0x6, 0xa2, 0x33, 
-0xa0, 0x88, 0xa9, 0x5, 0x2c, 0x78, 0x6, 0x10, 0x10, 0x50, 0xe, 0xd0, 0xc, 0xc9, 0x5, 0xd0, 
-0x8, 0xe0, 0x33, 0xd0, 0x4, 0xc0, 0x88, 0xf0, 0x4, 0xa9, 0xb6, 0x85, 0x0, 0xa9, 0x3, 0x8d, 
-0x78, 0x6, 0xa9, 0x1, 0x2c, 0x78, 0x6, 0x30, 0x8, 0x70, 0x6, 0xf0, 0x4, 0xc9, 0x1, 0xf0, 
-0x4, 0xa9, 0xb7, 0x85, 0x0, 0xa0, 0xb8, 0xa9, 0xaa, 0x8d, 0x78, 0x6, 0x20, 0xb6, 0xf7, 0xd, 
-0x78, 0x6, 0x20, 0xc0, 0xf7, 0xc8, 0xa9, 0x0, 0x8d, 0x78, 0x6, 0x20, 0xce, 0xf7, 0xd, 0x78, 
-0x6, 0x20, 0xd3, 0xf7, 0xc8, 0xa9, 0xaa, 0x8d, 0x78, 0x6, 0x20, 0xdf, 0xf7, 0x2d, 0x78, 0x6, 
-0x20, 0xe5, 0xf7, 0xc8, 0xa9, 0xef, 0x8d, 0x78, 0x6, 0x20, 0xf1, 0xf7, 0x2d, 0x78, 0x6, 0x20, 
-0xf6, 0xf7, 0xc8, 0xa9, 0xaa, 0x8d, 0x78, 0x6, 0x20, 0x4, 0xf8, 0x4d, 0x78, 0x6, 0x20, 0xa, 
-0xf8, 0xc8, 0xa9, 0x70, 0x8d, 0x78, 0x6, 0x20, 0x18, 0xf8, 0x4d, 0x78, 0x6, 0x20, 0x1d, 0xf8, 
-0xc8, 0xa9, 0x69, 0x8d, 0x78, 0x6, 0x20, 0x29, 0xf8, 0x6d, 0x78, 0x6, 0x20, 0x2f, 0xf8, 0xc8, 
-0x20, 0x3d, 0xf8, 0x6d, 0x78, 0x6, 0x20, 0x43, 0xf8, 0xc8, 0xa9, 0x7f, 0x8d, 0x78, 0x6, 0x20, 
-0x51, 0xf8, 0x6d, 0x78, 0x6, 0x20, 0x56, 0xf8, 0xc8, 0xa9, 0x80, 0x8d, 0x78, 0x6, 0x20, 0x64, 
-0xf8, 0x6d, 0x78, 0x6, 0x20, 0x6a, 0xf8, 0xc8, 0x20, 0x78, 0xf8, 0x6d, 0x78, 0x6, 0x20, 0x7d, 
-0xf8, 0xc8, 0xa9, 0x40, 0x8d, 0x78, 0x6, 0x20, 0x89, 0xf8, 0xcd, 0x78, 0x6, 0x20, 0x8e, 0xf8, 
-0xc8, 0x48, 0xa9, 0x3f, 0x8d, 0x78, 0x6, 0x68, 0x20, 0x9a, 0xf8, 0xcd, 0x78, 0x6, 0x20, 0x9c, 
-0xf8, 0xc8, 0x48, 0xa9, 0x41, 0x8d, 0x78, 0x6, 0x68, 0xcd, 0x78, 0x6, 0x20, 0xa8, 0xf8, 0xc8, 
-0x48, 0xa9, 0x0, 0x8d, 0x78, 0x6, 0x68, 0x20, 0xb2, 0xf8, 0xcd, 0x78, 0x6, 0x20, 0xb5, 0xf8, 
-0xc8, 0x48, 0xa9, 0x80, 0x8d, 0x78, 0x6, 0x68, 0xcd, 0x78, 0x6, 0x20, 0xbf, 0xf8, 0xc8, 0x48, 
-0xa9, 0x81, 0x8d, 0x78, 0x6, 0x68, 0xcd, 0x78, 0x6, 0x20, 0xc9, 0xf8, 0xc8, 0x48, 0xa9, 0x7f, 
-0x8d, 0x78, 0x6, 0x68, 0xcd, 0x78, 0x6, 0x20, 0xd3, 0xf8, 0xc8, 0xa9, 0x40, 0x8d, 0x78, 0x6, 
-0x20, 0x31, 0xf9, 0xed, 0x78, 0x6, 0x20, 0x37, 0xf9, 0xc8, 0xa9, 0x3f, 0x8d, 0x78, 0x6, 0x20, 
-0x47, 0xf9, 0xed, 0x78, 0x6, 0x20, 0x4c, 0xf9, 0xc8, 0xa9, 0x41, 0x8d, 0x78, 0x6, 0x20, 0x5c, 
-0xf9, 0xed, 0x78, 0x6, 0x20, 0x62, 0xf9, 0xc8, 0xa9, 0x0, 0x8d, 0x78, 0x6, 0x20, 0x72, 0xf9, 
-0xed, 0x78, 0x6, 0x20, 0x76, 0xf9, 0xc8, 0xa9, 0x7f, 0x8d, 0x78, 0x6, 0x20, 0x80, 0xf9, 0xed, 
-0x78, 0x6, 0x20, 0x84, 0xf9, 0xc8, 0xa9, 0x40, 0x8d, 0x78, 0x6, 0x20, 0x89, 0xf8, 0xaa, 0xec, 
-0x78, 0x6, 0x20, 0x8e, 0xf8, 0xc8, 0xa9, 0x3f, 0x8d, 0x78, 0x6, 0x20, 0x9a, 0xf8, 0xec, 0x78, 
-0x6, 0x20, 0x9c, 0xf8, 0xc8, 0xa9, 0x41, 0x8d, 0x78, 0x6, 0xec, 0x78, 0x6, 0x20, 0xa8, 0xf8, 
-0xc8, 0xa9, 0x0, 0x8d, 0x78, 0x6, 0x20, 0xb2, 0xf8, 0xaa, 0xec, 0x78, 0x6, 0x20, 0xb5, 0xf8, 
-0xc8, 0xa9, 0x80, 0x8d, 0x78, 0x6, 0xec, 0x78, 0x6, 0x20, 0xbf, 0xf8, 0xc8, 0xa9, 0x81, 0x8d, 
-0x78, 0x6, 0xec, 0x78, 0x6, 0x20, 0xc9, 0xf8, 0xc8, 0xa9, 0x7f, 0x8d, 0x78, 0x6, 0xec, 0x78, 
-0x6, 0x20, 0xd3, 0xf8, 0xc8, 0x98, 0xaa, 0xa9, 0x40, 0x8d, 0x78, 0x6, 0x20, 0xdd, 0xf8, 0xcc, 
-0x78, 0x6, 0x20, 0xe2, 0xf8, 0xe8, 0xa9, 0x3f, 0x8d, 0x78, 0x6, 0x20, 0xee, 0xf8, 0xcc, 0x78, 
-0x6, 0x20, 0xf0, 0xf8, 0xe8, 0xa9, 0x41, 0x8d, 0x78, 0x6, 0xcc, 0x78, 0x6, 0x20, 0xfc, 0xf8, 
-0xe8, 0xa9, 0x0, 0x8d, 0x78, 0x6, 0x20, 0x6, 0xf9, 0xcc, 0x78, 0x6, 0x20, 0x9, 0xf9, 0xe8, 
-0xa9, 0x80, 0x8d, 0x78, 0x6, 0xcc, 0x78, 0x6, 0x20, 0x13, 0xf9, 0xe8, 0xa9, 0x81, 0x8d, 0x78, 
-0x6, 0xcc, 0x78, 0x6, 0x20, 0x1d, 0xf9, 0xe8, 0xa9, 0x7f, 0x8d, 0x78, 0x6, 0xcc, 0x78, 0x6, 
-0x20, 0x27, 0xf9, 0xe8, 0x8a, 0xa8, 0x20, 0x90, 0xf9, 0x8d, 0x78, 0x6, 0x4e, 0x78, 0x6, 0xad, 
-0x78, 0x6, 0x20, 0x9d, 0xf9, 0xc8, 0x8d, 0x78, 0x6, 0x4e, 0x78, 0x6, 0xad, 0x78, 0x6, 0x20, 
-0xad, 0xf9, 0xc8, 0x20, 0xbd, 0xf9, 0x8d, 0x78, 0x6, 0xe, 0x78, 0x6, 0xad, 0x78, 0x6, 0x20, 
-0xc3, 0xf9, 0xc8, 0x8d, 0x78, 0x6, 0xe, 0x78, 0x6, 0xad, 0x78, 0x6, 0x20, 0xd4, 0xf9, 0xc8, 
-0x20, 0xe4, 0xf9, 0x8d, 0x78, 0x6, 0x6e, 0x78, 0x6, 0xad, 0x78, 0x6, 0x20, 0xea, 0xf9, 0xc8, 
-0x8d, 0x78, 0x6, 0x6e, 0x78, 0x6, 0xad, 0x78, 0x6, 0x20, 0xfb, 0xf9, 0xc8, 0x20, 0xa, 0xfa, 
-0x8d, 0x78, 0x6, 0x2e, 0x78, 0x6, 0xad, 0x78, 0x6, 0x20, 0x10, 0xfa, 0xc8, 0x8d, 0x78, 0x6, 
-0x2e, 0x78, 0x6, 0xad, 0x78, 0x6, 0x20, 0x21, 0xfa, 0xa9, 0xff, 0x8d, 0x78, 0x6, 0x85, 0x1, 
-0x24, 0x1, 0x38, 0xee, 0x78, 0x6, 0xd0, 0xd, 0x30, 0xb, 0x50, 0x9, 0x90, 0x7, 0xad, 0x78, 
-0x6, 0xc9, 0x0, 0xf0, 0x4, 0xa9, 0xe5, 0x85, 0x0, 0xa9, 0x7f, 0x8d, 0x78, 0x6, 0xb8, 0x18, 
-0xee, 0x78, 0x6, 0xf0, 0xd, 0x10, 0xb, 0x70, 0x9, 0xb0, 0x7, 0xad, 0x78, 0x6, 0xc9, 0x80, 
-0xf0, 0x4, 0xa9, 0xe6, 0x85, 0x0, 0xa9, 0x0, 0x8d, 0x78, 0x6, 0x24, 0x1, 0x38, 0xce, 0x78, 
-0x6, 0xf0, 0xd, 0x10, 0xb, 0x50, 0x9, 0x90, 0x7, 0xad, 0x78, 0x6, 0xc9, 0xff, 0xf0, 0x4, 
-0xa9, 0xe7, 0x85, 0x0, 0xa9, 0x80, 0x8d, 0x78, 0x6, 0xb8, 0x18, 0xce, 0x78, 0x6, 0xf0, 0xd, 
-0x30, 0xb, 0x70, 0x9, 0xb0, 0x7, 0xad, 0x78, 0x6, 0xc9, 0x7f, 0xf0, 0x4, 0xa9, 0xe8, 0x85, 
-0x0, 0xa9, 0x1, 0x8d, 0x78, 0x6, 0xce, 0x78, 0x6, 0xf0, 0x4, 0xa9, 0xe9, 0x85, 0x0, 0x60, 
-0xa9, 0xa3, 0x85, 0x33, 0xa9, 0x89, 0x8d, 0x0, 0x3, 0xa9, 0x12, 0x8d, 0x45, 0x2, 0xa9, 0xff, 
-0x85, 0x1, 0xa2, 0x65, 0xa9, 0x0, 0x85, 0x89, 0xa9, 0x3, 0x85, 0x8a, 0xa0, 0x0, 0x38, 0xa9, 
-0x0, 0xb8, 0xb1, 0x89, 0xf0, 0xc, 0x90, 0xa, 0x70, 0x8, 0xc9, 0x89, 0xd0, 0x4, 0xe0, 0x65, 
-0xf0, 0x4, 0xa9, 0xea, 0x85, 0x0, 0xa9, 0xff, 0x85, 0x97, 0x85, 0x98, 0x24, 0x98, 0xa0, 0x34, 
-0xb1, 0x97, 0xc9, 0xa3, 0xd0, 0x2, 0xb0, 0x4, 0xa9, 0xeb, 0x85, 0x0, 0xa5, 0x0, 0x48, 0xa9, 
-0x46, 0x85, 0xff, 0xa9, 0x1, 0x85, 0x0, 0xa0, 0xff, 0xb1, 0xff, 0xc9, 0x12, 0xf0, 0x4, 0x68, 
-0xa9, 0xec, 0x48, 0x68, 0x85, 0x0, 0xa2, 0xed, 0xa9, 0x0, 0x85, 0x33, 0xa9, 0x4, 0x85, 0x34, 
-0xa0, 0x0, 0x18, 0xa9, 0xff, 0x85, 0x1, 0x24, 0x1, 0xa9, 0xaa, 0x8d, 0x0, 0x4, 0xa9, 0x55, 
-0x11, 0x33, 0xb0, 0x8, 0x10, 0x6, 0xc9, 0xff, 0xd0, 0x2, 0x70, 0x2, 0x86, 0x0, 0xe8, 0x38, 
-0xb8, 0xa9, 0x0, 0x11, 0x33, 0xf0, 0x6, 0x70, 0x4, 0x90, 0x2, 0x30, 0x2, 0x86, 0x0, 0xe8, 
-0x18, 0x24, 0x1, 0xa9, 0x55, 0x31, 0x33, 0xd0, 0x6, 0x50, 0x4, 0xb0, 0x2, 0x10, 0x2, 0x86, 
-0x0, 0xe8, 0x38, 0xb8, 0xa9, 0xef, 0x8d, 0x0, 0x4, 0xa9, 0xf8, 0x31, 0x33, 0x90, 0x8, 0x10, 
-0x6, 0xc9, 0xe8, 0xd0, 0x2, 0x50, 0x2, 0x86, 0x0, 0xe8, 0x18, 0x24, 0x1, 0xa9, 0xaa, 0x8d, 
-0x0, 0x4, 0xa9, 0x5f, 0x51, 0x33, 0xb0, 0x8, 0x10, 0x6, 0xc9, 0xf5, 0xd0, 0x2, 0x70, 0x2, 
-0x86, 0x0, 0xe8, 0x38, 0xb8, 0xa9, 0x70, 0x8d, 0x0, 0x4, 0x51, 0x33, 0xd0, 0x6, 0x70, 0x4, 
-0x90, 0x2, 0x10, 0x2, 0x86, 0x0, 0xe8, 0x18, 0x24, 0x1, 0xa9, 0x69, 0x8d, 0x0, 0x4, 0xa9, 
-0x0, 0x71, 0x33, 0x30, 0x8, 0xb0, 0x6, 0xc9, 0x69, 0xd0, 0x2, 0x50, 0x2, 0x86, 0x0, 0xe8, 
-0x38, 0x24, 0x1, 0xa9, 0x0, 0x71, 0x33, 0x30, 0x8, 0xb0, 0x6, 0xc9, 0x6a, 0xd0, 0x2, 0x50, 
-0x2, 0x86, 0x0, 0xe8, 0x38, 0xb8, 0xa9, 0x7f, 0x8d, 0x0, 0x4, 0x71, 0x33, 0x10, 0x8, 0xb0, 
-0x6, 0xc9, 0xff, 0xd0, 0x2, 0x70, 0x2, 0x86, 0x0, 0xe8, 0x18, 0x24, 0x1, 0xa9, 0x80, 0x8d, 
-0x0, 0x4, 0xa9, 0x7f, 0x71, 0x33, 0x10, 0x8, 0xb0, 0x6, 0xc9, 0xff, 0xd0, 0x2, 0x50, 0x2, 
-0x86, 0x0, 0xe8, 0x38, 0xb8, 0xa9, 0x80, 0x8d, 0x0, 0x4, 0xa9, 0x7f, 0x71, 0x33, 0xd0, 0x6, 
-0x30, 0x4, 0x70, 0x2, 0xb0, 0x2, 0x86, 0x0, 0xe8, 0x24, 0x1, 0xa9, 0x40, 0x8d, 0x0, 0x4, 
-0xd1, 0x33, 0x30, 0x6, 0x90, 0x4, 0xd0, 0x2, 0x70, 0x2, 0x86, 0x0, 0xe8, 0xb8, 0xce, 0x0, 
-0x4, 0xd1, 0x33, 0xf0, 0x6, 0x30, 0x4, 0x90, 0x2, 0x50, 0x2, 0x86, 0x0, 0xe8, 0xee, 0x0, 
-0x4, 0xee, 0x0, 0x4, 0xd1, 0x33, 0xf0, 0x2, 0x30, 0x2, 0x86, 0x0, 0xe8, 0xa9, 0x0, 0x8d, 
-0x0, 0x4, 0xa9, 0x80, 0xd1, 0x33, 0xf0, 0x4, 0x10, 0x2, 0xb0, 0x2, 0x86, 0x0, 0xe8, 0xa0, 
-0x80, 0x8c, 0x0, 0x4, 0xa0, 0x0, 0xd1, 0x33, 0xd0, 0x4, 0x30, 0x2, 0xb0, 0x2, 0x86, 0x0, 
-0xe8, 0xee, 0x0, 0x4, 0xd1, 0x33, 0xb0, 0x4, 0xf0, 0x2, 0x30, 0x2, 0x86, 0x0, 0xe8, 0xce, 
-0x0, 0x4, 0xce, 0x0, 0x4, 0xd1, 0x33, 0x90, 0x4, 0xf0, 0x2, 0x10, 0x2, 0x86, 0x0, 0x60, 
-0xa9, 0x0, 0x85, 0x33, 0xa9, 0x4, 0x85, 0x34, 0xa0, 0x0, 0xa2, 0x1, 0x24, 0x1, 0xa9, 0x40, 
-0x8d, 0x0, 0x4, 0x38, 0xf1, 0x33, 0x30, 0xa, 0x90, 0x8, 0xd0, 0x6, 0x70, 0x4, 0xc9, 0x0, 
-0xf0, 0x2, 0x86, 0x0, 0xe8, 0xb8, 0x38, 0xa9, 0x40, 0xce, 0x0, 0x4, 0xf1, 0x33, 0xf0, 0xa, 
-0x30, 0x8, 0x90, 0x6, 0x70, 0x4, 0xc9, 0x1, 0xf0, 0x2, 0x86, 0x0, 0xe8, 0xa9, 0x40, 0x38, 
-0x24, 0x1, 0xee, 0x0, 0x4, 0xee, 0x0, 0x4, 0xf1, 0x33, 0xb0, 0xa, 0xf0, 0x8, 0x10, 0x6, 
-0x70, 0x4, 0xc9, 0xff, 0xf0, 0x2, 0x86, 0x0, 0xe8, 0x18, 0xa9, 0x0, 0x8d, 0x0, 0x4, 0xa9, 
-0x80, 0xf1, 0x33, 0x90, 0x4, 0xc9, 0x7f, 0xf0, 0x2, 0x86, 0x0, 0xe8, 0x38, 0xa9, 0x7f, 0x8d, 
-0x0, 0x4, 0xa9, 0x81, 0xf1, 0x33, 0x50, 0x6, 0x90, 0x4, 0xc9, 0x2, 0xf0, 0x2, 0x86, 0x0, 
-0xe8, 0xa9, 0x0, 0xa9, 0x87, 0x91, 0x33, 0xad, 0x0, 0x4, 0xc9, 0x87, 0xf0, 0x2, 0x86, 0x0, 
-0xe8, 0xa9, 0x7e, 0x8d, 0x0, 0x2, 0xa9, 0xdb, 0x8d, 0x1, 0x2, 0x6c, 0x0, 0x2, 0xa9, 0x0, 
-0x8d, 0xff, 0x2, 0xa9, 0x1, 0x8d, 0x0, 0x3, 0xa9, 0x3, 0x8d, 0x0, 0x2, 0xa9, 0xa9, 0x8d, 
-0x0, 0x1, 0xa9, 0x55, 0x8d, 0x1, 0x1, 0xa9, 0x60, 0x8d, 0x2, 0x1, 0xa9, 0xa9, 0x8d, 0x0, 
-0x3, 0xa9, 0xaa, 0x8d, 0x1, 0x3, 0xa9, 0x60, 0x8d, 0x2, 0x3, 0x20, 0xb5, 0xdb, 0xc9, 0xaa, 
-0xf0, 0x2, 0x86, 0x0, 0x60, 0x6c, 0xff, 0x2, 0xa9, 0xff, 0x85, 0x1, 0xa9, 0xaa, 0x85, 0x33, 
-0xa9, 0xbb, 0x85, 0x89, 0xa2, 0x0, 0xa9, 0x66, 0x24, 0x1, 0x38, 0xa0, 0x0, 0xb4, 0x33, 0x10, 
-0x12, 0xf0, 0x10, 0x50, 0xe, 0x90, 0xc, 0xc9, 0x66, 0xd0, 0x8, 0xe0, 0x0, 0xd0, 0x4, 0xc0, 
-0xaa, 0xf0, 0x4, 0xa9, 0x8, 0x85, 0x0, 0xa2, 0x8a, 0xa9, 0x66, 0xb8, 0x18, 0xa0, 0x0, 0xb4, 
-0xff, 0x10, 0x12, 0xf0, 0x10, 0x70, 0xe, 0xb0, 0xc, 0xc0, 0xbb, 0xd0, 0x8, 0xc9, 0x66, 0xd0, 
-0x4, 0xe0, 0x8a, 0xf0, 0x4, 0xa9, 0x9, 0x85, 0x0, 0x24, 0x1, 0x38, 0xa0, 0x44, 0xa2, 0x0, 
-0x94, 0x33, 0xa5, 0x33, 0x90, 0x18, 0xc9, 0x44, 0xd0, 0x14, 0x50, 0x12, 0x18, 0xb8, 0xa0, 0x99, 
-0xa2, 0x80, 0x94, 0x85, 0xa5, 0x5, 0xb0, 0x6, 0xc9, 0x99, 0xd0, 0x2, 0x50, 0x4, 0xa9, 0xa, 
-0x85, 0x0, 0xa0, 0xb, 0xa9, 0xaa, 0xa2, 0x78, 0x85, 0x78, 0x20, 0xb6, 0xf7, 0x15, 0x0, 0x20, 
-0xc0, 0xf7, 0xc8, 0xa9, 0x0, 0x85, 0x78, 0x20, 0xce, 0xf7, 0x15, 0x0, 0x20, 0xd3, 0xf7, 0xc8, 
-0xa9, 0xaa, 0x85, 0x78, 0x20, 0xdf, 0xf7, 0x35, 0x0, 0x20, 0xe5, 0xf7, 0xc8, 0xa9, 0xef, 0x85, 
-0x78, 0x20, 0xf1, 0xf7, 0x35, 0x0, 0x20, 0xf6, 0xf7, 0xc8, 0xa9, 0xaa, 0x85, 0x78, 0x20, 0x4, 
-0xf8, 0x55, 0x0, 0x20, 0xa, 0xf8, 0xc8, 0xa9, 0x70, 0x85, 0x78, 0x20, 0x18, 0xf8, 0x55, 0x0, 
-0x20, 0x1d, 0xf8, 0xc8, 0xa9, 0x69, 0x85, 0x78, 0x20, 0x29, 0xf8, 0x75, 0x0, 0x20, 0x2f, 0xf8, 
-0xc8, 0x20, 0x3d, 0xf8, 0x75, 0x0, 0x20, 0x43, 0xf8, 0xc8, 0xa9, 0x7f, 0x85, 0x78, 0x20, 0x51, 
-0xf8, 0x75, 0x0, 0x20, 0x56, 0xf8, 0xc8, 0xa9, 0x80, 0x85, 0x78, 0x20, 0x64, 0xf8, 0x75, 0x0, 
-0x20, 0x6a, 0xf8, 0xc8, 0x20, 0x78, 0xf8, 0x75, 0x0, 0x20, 0x7d, 0xf8, 0xc8, 0xa9, 0x40, 0x85, 
-0x78, 0x20, 0x89, 0xf8, 0xd5, 0x0, 0x20, 0x8e, 0xf8, 0xc8, 0x48, 0xa9, 0x3f, 0x85, 0x78, 0x68, 
-0x20, 0x9a, 0xf8, 0xd5, 0x0, 0x20, 0x9c, 0xf8, 0xc8, 0x48, 0xa9, 0x41, 0x85, 0x78, 0x68, 0xd5, 
-0x0, 0x20, 0xa8, 0xf8, 0xc8, 0x48, 0xa9, 0x0, 0x85, 0x78, 0x68, 0x20, 0xb2, 0xf8, 0xd5, 0x0, 
-0x20, 0xb5, 0xf8, 0xc8, 0x48, 0xa9, 0x80, 0x85, 0x78, 0x68, 0xd5, 0x0, 0x20, 0xbf, 0xf8, 0xc8, 
-0x48, 0xa9, 0x81, 0x85, 0x78, 0x68, 0xd5, 0x0, 0x20, 0xc9, 0xf8, 0xc8, 0x48, 0xa9, 0x7f, 0x85, 
-0x78, 0x68, 0xd5, 0x0, 0x20, 0xd3, 0xf8, 0xc8, 0xa9, 0x40, 0x85, 0x78, 0x20, 0x31, 0xf9, 0xf5, 
-0x0, 0x20, 0x37, 0xf9, 0xc8, 0xa9, 0x3f, 0x85, 0x78, 0x20, 0x47, 0xf9, 0xf5, 0x0, 0x20, 0x4c, 
-0xf9, 0xc8, 0xa9, 0x41, 0x85, 0x78, 0x20, 0x5c, 0xf9, 0xf5, 0x0, 0x20, 0x62, 0xf9, 0xc8, 0xa9, 
-0x0, 0x85, 0x78, 0x20, 0x72, 0xf9, 0xf5, 0x0, 0x20, 0x76, 0xf9, 0xc8, 0xa9, 0x7f, 0x85, 0x78, 
-0x20, 0x80, 0xf9, 0xf5, 0x0, 0x20, 0x84, 0xf9, 0xa9, 0xaa, 0x85, 0x33, 0xa9, 0xbb, 0x85, 0x89, 
-0xa2, 0x0, 0xa0, 0x66, 0x24, 0x1, 0x38, 0xa9, 0x0, 0xb5, 0x33, 0x10, 0x12, 0xf0, 0x10, 0x50, 
-0xe, 0x90, 0xc, 0xc0, 0x66, 0xd0, 0x8, 0xe0, 0x0, 0xd0, 0x4, 0xc9, 0xaa, 0xf0, 0x4, 0xa9, 
-0x22, 0x85, 0x0, 0xa2, 0x8a, 0xa0, 0x66, 0xb8, 0x18, 0xa9, 0x0, 0xb5, 0xff, 0x10, 0x12, 0xf0, 
-0x10, 0x70, 0xe, 0xb0, 0xc, 0xc9, 0xbb, 0xd0, 0x8, 0xc0, 0x66, 0xd0, 0x4, 0xe0, 0x8a, 0xf0, 
-0x4, 0xa9, 0x23, 0x85, 0x0, 0x24, 0x1, 0x38, 0xa9, 0x44, 0xa2, 0x0, 0x95, 0x33, 0xa5, 0x33, 
-0x90, 0x18, 0xc9, 0x44, 0xd0, 0x14, 0x50, 0x12, 0x18, 0xb8, 0xa9, 0x99, 0xa2, 0x80, 0x95, 0x85, 
-0xa5, 0x5, 0xb0, 0x6, 0xc9, 0x99, 0xd0, 0x2, 0x50, 0x4, 0xa9, 0x24, 0x85, 0x0, 0xa0, 0x25, 
-0xa2, 0x78, 0x20, 0x90, 0xf9, 0x95, 0x0, 0x56, 0x0, 0xb5, 0x0, 0x20, 0x9d, 0xf9, 0xc8, 0x95, 
-0x0, 0x56, 0x0, 0xb5, 0x0, 0x20, 0xad, 0xf9, 0xc8, 0x20, 0xbd, 0xf9, 0x95, 0x0, 0x16, 0x0, 
-0xb5, 0x0, 0x20, 0xc3, 0xf9, 0xc8, 0x95, 0x0, 0x16, 0x0, 0xb5, 0x0, 0x20, 0xd4, 0xf9, 0xc8, 
-0x20, 0xe4, 0xf9, 0x95, 0x0, 0x76, 0x0, 0xb5, 0x0, 0x20, 0xea, 0xf9, 0xc8, 0x95, 0x0, 0x76, 
-0x0, 0xb5, 0x0, 0x20, 0xfb, 0xf9, 0xc8, 0x20, 0xa, 0xfa, 0x95, 0x0, 0x36, 0x0, 0xb5, 0x0, 
-0x20, 0x10, 0xfa, 0xc8, 0x95, 0x0, 0x36, 0x0, 0xb5, 0x0, 0x20, 0x21, 0xfa, 0xa9, 0xff, 0x95, 
-0x0, 0x85, 0x1, 0x24, 0x1, 0x38, 0xf6, 0x0, 0xd0, 0xc, 0x30, 0xa, 0x50, 0x8, 0x90, 0x6, 
-0xb5, 0x0, 0xc9, 0x0, 0xf0, 0x4, 0xa9, 0x2d, 0x85, 0x0, 0xa9, 0x7f, 0x95, 0x0, 0xb8, 0x18, 
-0xf6, 0x0, 0xf0, 0xc, 0x10, 0xa, 0x70, 0x8, 0xb0, 0x6, 0xb5, 0x0, 0xc9, 0x80, 0xf0, 0x4, 
-0xa9, 0x2e, 0x85, 0x0, 0xa9, 0x0, 0x95, 0x0, 0x24, 0x1, 0x38, 0xd6, 0x0, 0xf0, 0xc, 0x10, 
-0xa, 0x50, 0x8, 0x90, 0x6, 0xb5, 0x0, 0xc9, 0xff, 0xf0, 0x4, 0xa9, 0x2f, 0x85, 0x0, 0xa9, 
-0x80, 0x95, 0x0, 0xb8, 0x18, 0xd6, 0x0, 0xf0, 0xc, 0x30, 0xa, 0x70, 0x8, 0xb0, 0x6, 0xb5, 
-0x0, 0xc9, 0x7f, 0xf0, 0x4, 0xa9, 0x30, 0x85, 0x0, 0xa9, 0x1, 0x95, 0x0, 0xd6, 0x0, 0xf0, 
-0x4, 0xa9, 0x31, 0x85, 0x0, 0xa9, 0x33, 0x85, 0x78, 0xa9, 0x44, 0xa0, 0x78, 0xa2, 0x0, 0x38, 
-0x24, 0x1, 0xb6, 0x0, 0x90, 0x12, 0x50, 0x10, 0x30, 0xe, 0xf0, 0xc, 0xe0, 0x33, 0xd0, 0x8, 
-0xc0, 0x78, 0xd0, 0x4, 0xc9, 0x44, 0xf0, 0x4, 0xa9, 0x32, 0x85, 0x0, 0xa9, 0x97, 0x85, 0x7f, 
-0xa9, 0x47, 0xa0, 0xff, 0xa2, 0x0, 0x18, 0xb8, 0xb6, 0x80, 0xb0, 0x12, 0x70, 0x10, 0x10, 0xe, 
-0xf0, 0xc, 0xe0, 0x97, 0xd0, 0x8, 0xc0, 0xff, 0xd0, 0x4, 0xc9, 0x47, 0xf0, 0x4, 0xa9, 0x33, 
-0x85, 0x0, 0xa9, 0x0, 0x85, 0x7f, 0xa9, 0x47, 0xa0, 0xff, 0xa2, 0x69, 0x18, 0xb8, 0x96, 0x80, 
-0xb0, 0x18, 0x70, 0x16, 0x30, 0x14, 0xf0, 0x12, 0xe0, 0x69, 0xd0, 0xe, 0xc0, 0xff, 0xd0, 0xa, 
-0xc9, 0x47, 0xd0, 0x6, 0xa5, 0x7f, 0xc9, 0x69, 0xf0, 0x4, 0xa9, 0x34, 0x85, 0x0, 0xa9, 0xf5, 
-0x85, 0x4f, 0xa9, 0x47, 0xa0, 0x4f, 0x24, 0x1, 0xa2, 0x0, 0x38, 0x96, 0x0, 0x90, 0x16, 0x50, 
-0x14, 0x30, 0x12, 0xd0, 0x10, 0xe0, 0x0, 0xd0, 0xc, 0xc0, 0x4f, 0xd0, 0x8, 0xc9, 0x47, 0xd0, 
-0x4, 0xa5, 0x4f, 0xf0, 0x4, 0xa9, 0x35, 0x85, 0x0, 0x60, 0xa9, 0x89, 0x8d, 0x0, 0x3, 0xa9, 
-0xa3, 0x85, 0x33, 0xa9, 0x12, 0x8d, 0x45, 0x2, 0xa2, 0x65, 0xa0, 0x0, 0x38, 0xa9, 0x0, 0xb8, 
-0xb9, 0x0, 0x3, 0xf0, 0xc, 0x90, 0xa, 0x70, 0x8, 0xc9, 0x89, 0xd0, 0x4, 0xe0, 0x65, 0xf0, 
-0x4, 0xa9, 0x36, 0x85, 0x0, 0xa9, 0xff, 0x85, 0x1, 0x24, 0x1, 0xa0, 0x34, 0xb9, 0xff, 0xff, 
-0xc9, 0xa3, 0xd0, 0x2, 0xb0, 0x4, 0xa9, 0x37, 0x85, 0x0, 0xa9, 0x46, 0x85, 0xff, 0xa0, 0xff, 
-0xb9, 0x46, 0x1, 0xc9, 0x12, 0xf0, 0x4, 0xa9, 0x38, 0x85, 0x0, 0xa2, 0x39, 0x18, 0xa9, 0xff, 
-0x85, 0x1, 0x24, 0x1, 0xa9, 0xaa, 0x8d, 0x0, 0x4, 0xa9, 0x55, 0xa0, 0x0, 0x19, 0x0, 0x4, 
-0xb0, 0x8, 0x10, 0x6, 0xc9, 0xff, 0xd0, 0x2, 0x70, 0x2, 0x86, 0x0, 0xe8, 0x38, 0xb8, 0xa9, 
-0x0, 0x19, 0x0, 0x4, 0xf0, 0x6, 0x70, 0x4, 0x90, 0x2, 0x30, 0x2, 0x86, 0x0, 0xe8, 0x18, 
-0x24, 0x1, 0xa9, 0x55, 0x39, 0x0, 0x4, 0xd0, 0x6, 0x50, 0x4, 0xb0, 0x2, 0x10, 0x2, 0x86, 
-0x0, 0xe8, 0x38, 0xb8, 0xa9, 0xef, 0x8d, 0x0, 0x4, 0xa9, 0xf8, 0x39, 0x0, 0x4, 0x90, 0x8, 
-0x10, 0x6, 0xc9, 0xe8, 0xd0, 0x2, 0x50, 0x2, 0x86, 0x0, 0xe8, 0x18, 0x24, 0x1, 0xa9, 0xaa, 
-0x8d, 0x0, 0x4, 0xa9, 0x5f, 0x59, 0x0, 0x4, 0xb0, 0x8, 0x10, 0x6, 0xc9, 0xf5, 0xd0, 0x2, 
-0x70, 0x2, 0x86, 0x0, 0xe8, 0x38, 0xb8, 0xa9, 0x70, 0x8d, 0x0, 0x4, 0x59, 0x0, 0x4, 0xd0, 
-0x6, 0x70, 0x4, 0x90, 0x2, 0x10, 0x2, 0x86, 0x0, 0xe8, 0x18, 0x24, 0x1, 0xa9, 0x69, 0x8d, 
-0x0, 0x4, 0xa9, 0x0, 0x79, 0x0, 0x4, 0x30, 0x8, 0xb0, 0x6, 0xc9, 0x69, 0xd0, 0x2, 0x50, 
-0x2, 0x86, 0x0, 0xe8, 0x38, 0x24, 0x1, 0xa9, 0x0, 0x79, 0x0, 0x4, 0x30, 0x8, 0xb0, 0x6, 
-0xc9, 0x6a, 0xd0, 0x2, 0x50, 0x2, 0x86, 0x0, 0xe8, 0x38, 0xb8, 0xa9, 0x7f, 0x8d, 0x0, 0x4, 
-0x79, 0x0, 0x4, 0x10, 0x8, 0xb0, 0x6, 0xc9, 0xff, 0xd0, 0x2, 0x70, 0x2, 0x86, 0x0, 0xe8, 
-0x18, 0x24, 0x1, 0xa9, 0x80, 0x8d, 0x0, 0x4, 0xa9, 0x7f, 0x79, 0x0, 0x4, 0x10, 0x8, 0xb0, 
-0x6, 0xc9, 0xff, 0xd0, 0x2, 0x50, 0x2, 0x86, 0x0, 0xe8, 0x38, 0xb8, 0xa9, 0x80, 0x8d, 0x0, 
-0x4, 0xa9, 0x7f, 0x79, 0x0, 0x4, 0xd0, 0x6, 0x30, 0x4, 0x70, 0x2, 0xb0, 0x2, 0x86, 0x0, 
-0xe8, 0x24, 0x1, 0xa9, 0x40, 0x8d, 0x0, 0x4, 0xd9, 0x0, 0x4, 0x30, 0x6, 0x90, 0x4, 0xd0, 
-0x2, 0x70, 0x2, 0x86, 0x0, 0xe8, 0xb8, 0xce, 0x0, 0x4, 0xd9, 0x0, 0x4, 0xf0, 0x6, 0x30, 
-0x4, 0x90, 0x2, 0x50, 0x2, 0x86, 0x0, 0xe8, 0xee, 0x0, 0x4, 0xee, 0x0, 0x4, 0xd9, 0x0, 
-0x4, 0xf0, 0x2, 0x30, 0x2, 0x86, 0x0, 0xe8, 0xa9, 0x0, 0x8d, 0x0, 0x4, 0xa9, 0x80, 0xd9, 
-0x0, 0x4, 0xf0, 0x4, 0x10, 0x2, 0xb0, 0x2, 0x86, 0x0, 0xe8, 0xa0, 0x80, 0x8c, 0x0, 0x4, 
-0xa0, 0x0, 0xd9, 0x0, 0x4, 0xd0, 0x4, 0x30, 0x2, 0xb0, 0x2, 0x86, 0x0, 0xe8, 0xee, 0x0, 
-0x4, 0xd9, 0x0, 0x4, 0xb0, 0x4, 0xf0, 0x2, 0x30, 0x2, 0x86, 0x0, 0xe8, 0xce, 0x0, 0x4, 
-0xce, 0x0, 0x4, 0xd9, 0x0, 0x4, 0x90, 0x4, 0xf0, 0x2, 0x10, 0x2, 0x86, 0x0, 0xe8, 0x24, 
-0x1, 0xa9, 0x40, 0x8d, 0x0, 0x4, 0x38, 0xf9, 0x0, 0x4, 0x30, 0xa, 0x90, 0x8, 0xd0, 0x6, 
-0x70, 0x4, 0xc9, 0x0, 0xf0, 0x2, 0x86, 0x0, 0xe8, 0xb8, 0x38, 0xa9, 0x40, 0xce, 0x0, 0x4, 
-0xf9, 0x0, 0x4, 0xf0, 0xa, 0x30, 0x8, 0x90, 0x6, 0x70, 0x4, 0xc9, 0x1, 0xf0, 0x2, 0x86, 
-0x0, 0xe8, 0xa9, 0x40, 0x38, 0x24, 0x1, 0xee, 0x0, 0x4, 0xee, 0x0, 0x4, 0xf9, 0x0, 0x4, 
-0xb0, 0xa, 0xf0, 0x8, 0x10, 0x6, 0x70, 0x4, 0xc9, 0xff, 0xf0, 0x2, 0x86, 0x0, 0xe8, 0x18, 
-0xa9, 0x0, 0x8d, 0x0, 0x4, 0xa9, 0x80, 0xf9, 0x0, 0x4, 0x90, 0x4, 0xc9, 0x7f, 0xf0, 0x2, 
-0x86, 0x0, 0xe8, 0x38, 0xa9, 0x7f, 0x8d, 0x0, 0x4, 0xa9, 0x81, 0xf9, 0x0, 0x4, 0x50, 0x6, 
-0x90, 0x4, 0xc9, 0x2, 0xf0, 0x2, 0x86, 0x0, 0xe8, 0xa9, 0x0, 0xa9, 0x87, 0x99, 0x0, 0x4, 
-0xad, 0x0, 0x4, 0xc9, 0x87, 0xf0, 0x2, 0x86, 0x0, 0x60, 0xa9, 0xff, 0x85, 0x1, 0xa9, 0xaa, 
-0x8d, 0x33, 0x6, 0xa9, 0xbb, 0x8d, 0x89, 0x6, 0xa2, 0x0, 0xa9, 0x66, 0x24, 0x1, 0x38, 0xa0, 
-0x0, 0xbc, 0x33, 0x6, 0x10, 0x12, 0xf0, 0x10, 0x50, 0xe, 0x90, 0xc, 0xc9, 0x66, 0xd0, 0x8, 
-0xe0, 0x0, 0xd0, 0x4, 0xc0, 0xaa, 0xf0, 0x4, 0xa9, 0x51, 0x85, 0x0, 0xa2, 0x8a, 0xa9, 0x66, 
-0xb8, 0x18, 0xa0, 0x0, 0xbc, 0xff, 0x5, 0x10, 0x12, 0xf0, 0x10, 0x70, 0xe, 0xb0, 0xc, 0xc0, 
-0xbb, 0xd0, 0x8, 0xc9, 0x66, 0xd0, 0x4, 0xe0, 0x8a, 0xf0, 0x4, 0xa9, 0x52, 0x85, 0x0, 0xa0, 
-0x53, 0xa9, 0xaa, 0xa2, 0x78, 0x8d, 0x78, 0x6, 0x20, 0xb6, 0xf7, 0x1d, 0x0, 0x6, 0x20, 0xc0, 
-0xf7, 0xc8, 0xa9, 0x0, 0x8d, 0x78, 0x6, 0x20, 0xce, 0xf7, 0x1d, 0x0, 0x6, 0x20, 0xd3, 0xf7, 
-0xc8, 0xa9, 0xaa, 0x8d, 0x78, 0x6, 0x20, 0xdf, 0xf7, 0x3d, 0x0, 0x6, 0x20, 0xe5, 0xf7, 0xc8, 
-0xa9, 0xef, 0x8d, 0x78, 0x6, 0x20, 0xf1, 0xf7, 0x3d, 0x0, 0x6, 0x20, 0xf6, 0xf7, 0xc8, 0xa9, 
-0xaa, 0x8d, 0x78, 0x6, 0x20, 0x4, 0xf8, 0x5d, 0x0, 0x6, 0x20, 0xa, 0xf8, 0xc8, 0xa9, 0x70, 
-0x8d, 0x78, 0x6, 0x20, 0x18, 0xf8, 0x5d, 0x0, 0x6, 0x20, 0x1d, 0xf8, 0xc8, 0xa9, 0x69, 0x8d, 
-0x78, 0x6, 0x20, 0x29, 0xf8, 0x7d, 0x0, 0x6, 0x20, 0x2f, 0xf8, 0xc8, 0x20, 0x3d, 0xf8, 0x7d, 
-0x0, 0x6, 0x20, 0x43, 0xf8, 0xc8, 0xa9, 0x7f, 0x8d, 0x78, 0x6, 0x20, 0x51, 0xf8, 0x7d, 0x0, 
-0x6, 0x20, 0x56, 0xf8, 0xc8, 0xa9, 0x80, 0x8d, 0x78, 0x6, 0x20, 0x64, 0xf8, 0x7d, 0x0, 0x6, 
-0x20, 0x6a, 0xf8, 0xc8, 0x20, 0x78, 0xf8, 0x7d, 0x0, 0x6, 0x20, 0x7d, 0xf8, 0xc8, 0xa9, 0x40, 
-0x8d, 0x78, 0x6, 0x20, 0x89, 0xf8, 0xdd, 0x0, 0x6, 0x20, 0x8e, 0xf8, 0xc8, 0x48, 0xa9, 0x3f, 
-0x8d, 0x78, 0x6, 0x68, 0x20, 0x9a, 0xf8, 0xdd, 0x0, 0x6, 0x20, 0x9c, 0xf8, 0xc8, 0x48, 0xa9, 
-0x41, 0x8d, 0x78, 0x6, 0x68, 0xdd, 0x0, 0x6, 0x20, 0xa8, 0xf8, 0xc8, 0x48, 0xa9, 0x0, 0x8d, 
-0x78, 0x6, 0x68, 0x20, 0xb2, 0xf8, 0xdd, 0x0, 0x6, 0x20, 0xb5, 0xf8, 0xc8, 0x48, 0xa9, 0x80, 
-0x8d, 0x78, 0x6, 0x68, 0xdd, 0x0, 0x6, 0x20, 0xbf, 0xf8, 0xc8, 0x48, 0xa9, 0x81, 0x8d, 0x78, 
-0x6, 0x68, 0xdd, 0x0, 0x6, 0x20, 0xc9, 0xf8, 0xc8, 0x48, 0xa9, 0x7f, 0x8d, 0x78, 0x6, 0x68, 
-0xdd, 0x0, 0x6, 0x20, 0xd3, 0xf8, 0xc8, 0xa9, 0x40, 0x8d, 0x78, 0x6, 0x20, 0x31, 0xf9, 0xfd, 
-0x0, 0x6, 0x20, 0x37, 0xf9, 0xc8, 0xa9, 0x3f, 0x8d, 0x78, 0x6, 0x20, 0x47, 0xf9, 0xfd, 0x0, 
-0x6, 0x20, 0x4c, 0xf9, 0xc8, 0xa9, 0x41, 0x8d, 0x78, 0x6, 0x20, 0x5c, 0xf9, 0xfd, 0x0, 0x6, 
-0x20, 0x62, 0xf9, 0xc8, 0xa9, 0x0, 0x8d, 0x78, 0x6, 0x20, 0x72, 0xf9, 0xfd, 0x0, 0x6, 0x20, 
-0x76, 0xf9, 0xc8, 0xa9, 0x7f, 0x8d, 0x78, 0x6, 0x20, 0x80, 0xf9, 0xfd, 0x0, 0x6, 0x20, 0x84, 
-0xf9, 0xa9, 0xaa, 0x8d, 0x33, 0x6, 0xa9, 0xbb, 0x8d, 0x89, 0x6, 0xa2, 0x0, 0xa0, 0x66, 0x24, 
-0x1, 0x38, 0xa9, 0x0, 0xbd, 0x33, 0x6, 0x10, 0x12, 0xf0, 0x10, 0x50, 0xe, 0x90, 0xc, 0xc0, 
-0x66, 0xd0, 0x8, 0xe0, 0x0, 0xd0, 0x4, 0xc9, 0xaa, 0xf0, 0x4, 0xa9, 0x6a, 0x85, 0x0, 0xa2, 
-0x8a, 0xa0, 0x66, 0xb8, 0x18, 0xa9, 0x0, 0xbd, 0xff, 0x5, 0x10, 0x12, 0xf0, 0x10, 0x70, 0xe, 
-0xb0, 0xc, 0xc9, 0xbb, 0xd0, 0x8, 0xc0, 0x66, 0xd0, 0x4, 0xe0, 0x8a, 0xf0, 0x4, 0xa9, 0x6b, 
-0x85, 0x0, 0x24, 0x1, 0x38, 0xa9, 0x44, 0xa2, 0x0, 0x9d, 0x33, 0x6, 0xad, 0x33, 0x6, 0x90, 
-0x1a, 0xc9, 0x44, 0xd0, 0x16, 0x50, 0x14, 0x18, 0xb8, 0xa9, 0x99, 0xa2, 0x80, 0x9d, 0x85, 0x5, 
-0xad, 0x5, 0x6, 0xb0, 0x6, 0xc9, 0x99, 0xd0, 0x2, 0x50, 0x4, 0xa9, 0x6c, 0x85, 0x0, 0xa0, 
-0x6d, 0xa2, 0x6d, 0x20, 0x90, 0xf9, 0x9d, 0x0, 0x6, 0x5e, 0x0, 0x6, 0xbd, 0x0, 0x6, 0x20, 
-0x9d, 0xf9, 0xc8, 0x9d, 0x0, 0x6, 0x5e, 0x0, 0x6, 0xbd, 0x0, 0x6, 0x20, 0xad, 0xf9, 0xc8, 
-0x20, 0xbd, 0xf9, 0x9d, 0x0, 0x6, 0x1e, 0x0, 0x6, 0xbd, 0x0, 0x6, 0x20, 0xc3, 0xf9, 0xc8, 
-0x9d, 0x0, 0x6, 0x1e, 0x0, 0x6, 0xbd, 0x0, 0x6, 0x20, 0xd4, 0xf9, 0xc8, 0x20, 0xe4, 0xf9, 
-0x9d, 0x0, 0x6, 0x7e, 0x0, 0x6, 0xbd, 0x0, 0x6, 0x20, 0xea, 0xf9, 0xc8, 0x9d, 0x0, 0x6, 
-0x7e, 0x0, 0x6, 0xbd, 0x0, 0x6, 0x20, 0xfb, 0xf9, 0xc8, 0x20, 0xa, 0xfa, 0x9d, 0x0, 0x6, 
-0x3e, 0x0, 0x6, 0xbd, 0x0, 0x6, 0x20, 0x10, 0xfa, 0xc8, 0x9d, 0x0, 0x6, 0x3e, 0x0, 0x6, 
-0xbd, 0x0, 0x6, 0x20, 0x21, 0xfa, 0xa9, 0xff, 0x9d, 0x0, 0x6, 0x85, 0x1, 0x24, 0x1, 0x38, 
-0xfe, 0x0, 0x6, 0xd0, 0xd, 0x30, 0xb, 0x50, 0x9, 0x90, 0x7, 0xbd, 0x0, 0x6, 0xc9, 0x0, 
-0xf0, 0x4, 0xa9, 0x75, 0x85, 0x0, 0xa9, 0x7f, 0x9d, 0x0, 0x6, 0xb8, 0x18, 0xfe, 0x0, 0x6, 
-0xf0, 0xd, 0x10, 0xb, 0x70, 0x9, 0xb0, 0x7, 0xbd, 0x0, 0x6, 0xc9, 0x80, 0xf0, 0x4, 0xa9, 
-0x76, 0x85, 0x0, 0xa9, 0x0, 0x9d, 0x0, 0x6, 0x24, 0x1, 0x38, 0xde, 0x0, 0x6, 0xf0, 0xd, 
-0x10, 0xb, 0x50, 0x9, 0x90, 0x7, 0xbd, 0x0, 0x6, 0xc9, 0xff, 0xf0, 0x4, 0xa9, 0x77, 0x85, 
-0x0, 0xa9, 0x80, 0x9d, 0x0, 0x6, 0xb8, 0x18, 0xde, 0x0, 0x6, 0xf0, 0xd, 0x30, 0xb, 0x70, 
-0x9, 0xb0, 0x7, 0xbd, 0x0, 0x6, 0xc9, 0x7f, 0xf0, 0x4, 0xa9, 0x78, 0x85, 0x0, 0xa9, 0x1, 
-0x9d, 0x0, 0x6, 0xde, 0x0, 0x6, 0xf0, 0x4, 0xa9, 0x79, 0x85, 0x0, 0xa9, 0x33, 0x8d, 0x78, 
-0x6, 0xa9, 0x44, 0xa0, 0x78, 0xa2, 0x0, 0x38, 0x24, 0x1, 0xbe, 0x0, 0x6, 0x90, 0x12, 0x50, 
-0x10, 0x30, 0xe, 0xf0, 0xc, 0xe0, 0x33, 0xd0, 0x8, 0xc0, 0x78, 0xd0, 0x4, 0xc9, 0x44, 0xf0, 
-0x4, 0xa9, 0x7a, 0x85, 0x0, 0xa9, 0x97, 0x8d, 0x7f, 0x6, 0xa9, 0x47, 0xa0, 0xff, 0xa2, 0x0, 
-0x18, 0xb8, 0xbe, 0x80, 0x5, 0xb0, 0x12, 0x70, 0x10, 0x10, 0xe, 0xf0, 0xc, 0xe0, 0x97, 0xd0, 
-0x8, 0xc0, 0xff, 0xd0, 0x4, 0xc9, 0x47, 0xf0, 0x4, 0xa9, 0x7b, 0x85, 0x0, 0x60, 0xa9, 0x55, 
-0x8d, 0x80, 0x5, 0xa9, 0xaa, 0x8d, 0x32, 0x4, 0xa9, 0x80, 0x85, 0x43, 0xa9, 0x5, 0x85, 0x44, 
-0xa9, 0x32, 0x85, 0x45, 0xa9, 0x4, 0x85, 0x46, 0xa2, 0x3, 0xa0, 0x77, 0xa9, 0xff, 0x85, 0x1, 
-0x24, 0x1, 0x38, 0xa9, 0x0, 0xa3, 0x40, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 0x30, 0x10, 0x50, 
-0xe, 0x90, 0xc, 0xc9, 0x55, 0xd0, 0x8, 0xe0, 0x55, 0xd0, 0x4, 0xc0, 0x77, 0xf0, 0x4, 0xa9, 
-0x7c, 0x85, 0x0, 0xa2, 0x5, 0xa0, 0x33, 0xb8, 0x18, 0xa9, 0x0, 0xa3, 0x40, 0xea, 0xea, 0xea, 
-0xea, 0xf0, 0x12, 0x10, 0x10, 0x70, 0xe, 0xb0, 0xc, 0xc9, 0xaa, 0xd0, 0x8, 0xe0, 0xaa, 0xd0, 
-0x4, 0xc0, 0x33, 0xf0, 0x4, 0xa9, 0x7d, 0x85, 0x0, 0xa9, 0x87, 0x85, 0x67, 0xa9, 0x32, 0x85, 
-0x68, 0xa0, 0x57, 0x24, 0x1, 0x38, 0xa9, 0x0, 0xa7, 0x67, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 
-0x10, 0x10, 0x50, 0xe, 0x90, 0xc, 0xc9, 0x87, 0xd0, 0x8, 0xe0, 0x87, 0xd0, 0x4, 0xc0, 0x57, 
-0xf0, 0x4, 0xa9, 0x7e, 0x85, 0x0, 0xa0, 0x53, 0xb8, 0x18, 0xa9, 0x0, 0xa7, 0x68, 0xea, 0xea, 
-0xea, 0xea, 0xf0, 0x12, 0x30, 0x10, 0x70, 0xe, 0xb0, 0xc, 0xc9, 0x32, 0xd0, 0x8, 0xe0, 0x32, 
-0xd0, 0x4, 0xc0, 0x53, 0xf0, 0x4, 0xa9, 0x7f, 0x85, 0x0, 0xa9, 0x87, 0x8d, 0x77, 0x5, 0xa9, 
-0x32, 0x8d, 0x78, 0x5, 0xa0, 0x57, 0x24, 0x1, 0x38, 0xa9, 0x0, 0xaf, 0x77, 0x5, 0xea, 0xea, 
-0xea, 0xea, 0xf0, 0x12, 0x10, 0x10, 0x50, 0xe, 0x90, 0xc, 0xc9, 0x87, 0xd0, 0x8, 0xe0, 0x87, 
-0xd0, 0x4, 0xc0, 0x57, 0xf0, 0x4, 0xa9, 0x80, 0x85, 0x0, 0xa0, 0x53, 0xb8, 0x18, 0xa9, 0x0, 
-0xaf, 0x78, 0x5, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 0x30, 0x10, 0x70, 0xe, 0xb0, 0xc, 0xc9, 
-0x32, 0xd0, 0x8, 0xe0, 0x32, 0xd0, 0x4, 0xc0, 0x53, 0xf0, 0x4, 0xa9, 0x81, 0x85, 0x0, 0xa9, 
-0xff, 0x85, 0x43, 0xa9, 0x4, 0x85, 0x44, 0xa9, 0x32, 0x85, 0x45, 0xa9, 0x4, 0x85, 0x46, 0xa9, 
-0x55, 0x8d, 0x80, 0x5, 0xa9, 0xaa, 0x8d, 0x32, 0x4, 0xa2, 0x3, 0xa0, 0x81, 0x24, 0x1, 0x38, 
-0xa9, 0x0, 0xb3, 0x43, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 0x30, 0x10, 0x50, 0xe, 0x90, 0xc, 
-0xc9, 0x55, 0xd0, 0x8, 0xe0, 0x55, 0xd0, 0x4, 0xc0, 0x81, 0xf0, 0x4, 0xa9, 0x82, 0x85, 0x0, 
-0xa2, 0x5, 0xa0, 0x0, 0xb8, 0x18, 0xa9, 0x0, 0xb3, 0x45, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 
-0x10, 0x10, 0x70, 0xe, 0xb0, 0xc, 0xc9, 0xaa, 0xd0, 0x8, 0xe0, 0xaa, 0xd0, 0x4, 0xc0, 0x0, 
-0xf0, 0x4, 0xa9, 0x83, 0x85, 0x0, 0xa9, 0x87, 0x85, 0x67, 0xa9, 0x32, 0x85, 0x68, 0xa0, 0x57, 
-0x24, 0x1, 0x38, 0xa9, 0x0, 0xb7, 0x10, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 0x10, 0x10, 0x50, 
-0xe, 0x90, 0xc, 0xc9, 0x87, 0xd0, 0x8, 0xe0, 0x87, 0xd0, 0x4, 0xc0, 0x57, 0xf0, 0x4, 0xa9, 
-0x84, 0x85, 0x0, 0xa0, 0xff, 0xb8, 0x18, 0xa9, 0x0, 0xb7, 0x69, 0xea, 0xea, 0xea, 0xea, 0xf0, 
-0x12, 0x30, 0x10, 0x70, 0xe, 0xb0, 0xc, 0xc9, 0x32, 0xd0, 0x8, 0xe0, 0x32, 0xd0, 0x4, 0xc0, 
-0xff, 0xf0, 0x4, 0xa9, 0x85, 0x85, 0x0, 0xa9, 0x87, 0x8d, 0x87, 0x5, 0xa9, 0x32, 0x8d, 0x88, 
-0x5, 0xa0, 0x30, 0x24, 0x1, 0x38, 0xa9, 0x0, 0xbf, 0x57, 0x5, 0xea, 0xea, 0xea, 0xea, 0xf0, 
-0x12, 0x10, 0x10, 0x50, 0xe, 0x90, 0xc, 0xc9, 0x87, 0xd0, 0x8, 0xe0, 0x87, 0xd0, 0x4, 0xc0, 
-0x30, 0xf0, 0x4, 0xa9, 0x86, 0x85, 0x0, 0xa0, 0x40, 0xb8, 0x18, 0xa9, 0x0, 0xbf, 0x48, 0x5, 
-0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 0x30, 0x10, 0x70, 0xe, 0xb0, 0xc, 0xc9, 0x32, 0xd0, 0x8, 
-0xe0, 0x32, 0xd0, 0x4, 0xc0, 0x40, 0xf0, 0x4, 0xa9, 0x87, 0x85, 0x0, 0x60, 0xa9, 0xc0, 0x85, 
-0x1, 0xa9, 0x0, 0x8d, 0x89, 0x4, 0xa9, 0x89, 0x85, 0x60, 0xa9, 0x4, 0x85, 0x61, 0xa0, 0x44, 
-0xa2, 0x17, 0xa9, 0x3e, 0x24, 0x1, 0x18, 0x83, 0x49, 0xea, 0xea, 0xea, 0xea, 0xd0, 0x19, 0xb0, 
-0x17, 0x50, 0x15, 0x10, 0x13, 0xc9, 0x3e, 0xd0, 0xf, 0xc0, 0x44, 0xd0, 0xb, 0xe0, 0x17, 0xd0, 
-0x7, 0xad, 0x89, 0x4, 0xc9, 0x16, 0xf0, 0x4, 0xa9, 0x88, 0x85, 0x0, 0xa0, 0x44, 0xa2, 0x7a, 
-0xa9, 0x66, 0x38, 0xb8, 0x83, 0xe6, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x19, 0x90, 0x17, 0x70, 0x15, 
-0x30, 0x13, 0xc9, 0x66, 0xd0, 0xf, 0xc0, 0x44, 0xd0, 0xb, 0xe0, 0x7a, 0xd0, 0x7, 0xad, 0x89, 
-0x4, 0xc9, 0x62, 0xf0, 0x4, 0xa9, 0x89, 0x85, 0x0, 0xa9, 0xff, 0x85, 0x49, 0xa0, 0x44, 0xa2, 
-0xaa, 0xa9, 0x55, 0x24, 0x1, 0x18, 0x87, 0x49, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x18, 0xb0, 0x16, 
-0x50, 0x14, 0x10, 0x12, 0xc9, 0x55, 0xd0, 0xe, 0xc0, 0x44, 0xd0, 0xa, 0xe0, 0xaa, 0xd0, 0x6, 
-0xa5, 0x49, 0xc9, 0x0, 0xf0, 0x4, 0xa9, 0x8a, 0x85, 0x0, 0xa9, 0x0, 0x85, 0x56, 0xa0, 0x58, 
-0xa2, 0xef, 0xa9, 0x66, 0x38, 0xb8, 0x87, 0x56, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x18, 0x90, 0x16, 
-0x70, 0x14, 0x30, 0x12, 0xc9, 0x66, 0xd0, 0xe, 0xc0, 0x58, 0xd0, 0xa, 0xe0, 0xef, 0xd0, 0x6, 
-0xa5, 0x56, 0xc9, 0x66, 0xf0, 0x4, 0xa9, 0x8b, 0x85, 0x0, 0xa9, 0xff, 0x8d, 0x49, 0x5, 0xa0, 
-0xe5, 0xa2, 0xaf, 0xa9, 0xf5, 0x24, 0x1, 0x18, 0x8f, 0x49, 0x5, 0xea, 0xea, 0xea, 0xea, 0xf0, 
-0x19, 0xb0, 0x17, 0x50, 0x15, 0x10, 0x13, 0xc9, 0xf5, 0xd0, 0xf, 0xc0, 0xe5, 0xd0, 0xb, 0xe0, 
-0xaf, 0xd0, 0x7, 0xad, 0x49, 0x5, 0xc9, 0xa5, 0xf0, 0x4, 0xa9, 0x8c, 0x85, 0x0, 0xa9, 0x0, 
-0x8d, 0x56, 0x5, 0xa0, 0x58, 0xa2, 0xb3, 0xa9, 0x97, 0x38, 0xb8, 0x8f, 0x56, 0x5, 0xea, 0xea, 
-0xea, 0xea, 0xf0, 0x19, 0x90, 0x17, 0x70, 0x15, 0x10, 0x13, 0xc9, 0x97, 0xd0, 0xf, 0xc0, 0x58, 
-0xd0, 0xb, 0xe0, 0xb3, 0xd0, 0x7, 0xad, 0x56, 0x5, 0xc9, 0x93, 0xf0, 0x4, 0xa9, 0x8d, 0x85, 
-0x0, 0xa9, 0xff, 0x85, 0x49, 0xa0, 0xff, 0xa2, 0xaa, 0xa9, 0x55, 0x24, 0x1, 0x18, 0x97, 0x4a, 
-0xea, 0xea, 0xea, 0xea, 0xf0, 0x18, 0xb0, 0x16, 0x50, 0x14, 0x10, 0x12, 0xc9, 0x55, 0xd0, 0xe, 
-0xc0, 0xff, 0xd0, 0xa, 0xe0, 0xaa, 0xd0, 0x6, 0xa5, 0x49, 0xc9, 0x0, 0xf0, 0x4, 0xa9, 0x8e, 
-0x85, 0x0, 0xa9, 0x0, 0x85, 0x56, 0xa0, 0x6, 0xa2, 0xef, 0xa9, 0x66, 0x38, 0xb8, 0x97, 0x50, 
-0xea, 0xea, 0xea, 0xea, 0xf0, 0x18, 0x90, 0x16, 0x70, 0x14, 0x30, 0x12, 0xc9, 0x66, 0xd0, 0xe, 
-0xc0, 0x6, 0xd0, 0xa, 0xe0, 0xef, 0xd0, 0x6, 0xa5, 0x56, 0xc9, 0x66, 0xf0, 0x4, 0xa9, 0x8f, 
-0x85, 0x0, 0x60, 0xa0, 0x90, 0x20, 0x31, 0xf9, 0xeb, 0x40, 0xea, 0xea, 0xea, 0xea, 0x20, 0x37, 
-0xf9, 0xc8, 0x20, 0x47, 0xf9, 0xeb, 0x3f, 0xea, 0xea, 0xea, 0xea, 0x20, 0x4c, 0xf9, 0xc8, 0x20, 
-0x5c, 0xf9, 0xeb, 0x41, 0xea, 0xea, 0xea, 0xea, 0x20, 0x62, 0xf9, 0xc8, 0x20, 0x72, 0xf9, 0xeb, 
-0x0, 0xea, 0xea, 0xea, 0xea, 0x20, 0x76, 0xf9, 0xc8, 0x20, 0x80, 0xf9, 0xeb, 0x7f, 0xea, 0xea, 
-0xea, 0xea, 0x20, 0x84, 0xf9, 0x60, 0xa9, 0xff, 0x85, 0x1, 0xa0, 0x95, 0xa2, 0x2, 0xa9, 0x47, 
-0x85, 0x47, 0xa9, 0x6, 0x85, 0x48, 0xa9, 0xeb, 0x8d, 0x47, 0x6, 0x20, 0x31, 0xfa, 0xc3, 0x45, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x37, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0xea, 0xf0, 0x2, 0x84, 0x0, 
-0xc8, 0xa9, 0x0, 0x8d, 0x47, 0x6, 0x20, 0x42, 0xfa, 0xc3, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 
-0x47, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0xff, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 
-0x6, 0x20, 0x54, 0xfa, 0xc3, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 0xfa, 0xad, 0x47, 0x6, 
-0xc9, 0x36, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0xeb, 0x85, 0x47, 0x20, 0x31, 0xfa, 0xc7, 0x47, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x37, 0xfa, 0xa5, 0x47, 0xc9, 0xea, 0xf0, 0x2, 0x84, 0x0, 0xc8, 
-0xa9, 0x0, 0x85, 0x47, 0x20, 0x42, 0xfa, 0xc7, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x47, 0xfa, 
-0xa5, 0x47, 0xc9, 0xff, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x54, 0xfa, 
-0xc7, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 0xfa, 0xa5, 0x47, 0xc9, 0x36, 0xf0, 0x2, 0x84, 
-0x0, 0xc8, 0xa9, 0xeb, 0x8d, 0x47, 0x6, 0x20, 0x31, 0xfa, 0xcf, 0x47, 0x6, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x37, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0xea, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x0, 
-0x8d, 0x47, 0x6, 0x20, 0x42, 0xfa, 0xcf, 0x47, 0x6, 0xea, 0xea, 0xea, 0xea, 0x20, 0x47, 0xfa, 
-0xad, 0x47, 0x6, 0xc9, 0xff, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x6, 0x20, 
-0x54, 0xfa, 0xcf, 0x47, 0x6, 0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 0xfa, 0xad, 0x47, 0x6, 0xc9, 
-0x36, 0xf0, 0x2, 0x84, 0x0, 0xa9, 0xeb, 0x8d, 0x47, 0x6, 0xa9, 0x48, 0x85, 0x45, 0xa9, 0x5, 
-0x85, 0x46, 0xa0, 0xff, 0x20, 0x31, 0xfa, 0xd3, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0x9e, 0x68, 
-0x28, 0x20, 0x37, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0xea, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x0, 0x8d, 0x47, 0x6, 0x20, 0x42, 0xfa, 0xd3, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0x9f, 0x68, 
-0x28, 0x20, 0x47, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0xff, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x6, 0x20, 0x54, 0xfa, 0xd3, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xa0, 0x68, 
-0x28, 0x20, 0x59, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x36, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xa1, 0xa2, 
-0xff, 0xa9, 0xeb, 0x85, 0x47, 0x20, 0x31, 0xfa, 0xd7, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x37, 
-0xfa, 0xa5, 0x47, 0xc9, 0xea, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x0, 0x85, 0x47, 0x20, 0x42, 
-0xfa, 0xd7, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x47, 0xfa, 0xa5, 0x47, 0xc9, 0xff, 0xf0, 0x2, 
-0x84, 0x0, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x54, 0xfa, 0xd7, 0x48, 0xea, 0xea, 0xea, 0xea, 
-0x20, 0x59, 0xfa, 0xa5, 0x47, 0xc9, 0x36, 0xf0, 0x2, 0x84, 0x0, 0xa9, 0xeb, 0x8d, 0x47, 0x6, 
-0xa0, 0xff, 0x20, 0x31, 0xfa, 0xdb, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xa4, 0x68, 0x28, 
-0x20, 0x37, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0xea, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 0x0, 
-0x8d, 0x47, 0x6, 0x20, 0x42, 0xfa, 0xdb, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xa5, 0x68, 
-0x28, 0x20, 0x47, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0xff, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x6, 0x20, 0x54, 0xfa, 0xdb, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xa6, 
-0x68, 0x28, 0x20, 0x59, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x36, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xa7, 
-0xa2, 0xff, 0xa9, 0xeb, 0x8d, 0x47, 0x6, 0x20, 0x31, 0xfa, 0xdf, 0x48, 0x5, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x37, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0xea, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x0, 
-0x8d, 0x47, 0x6, 0x20, 0x42, 0xfa, 0xdf, 0x48, 0x5, 0xea, 0xea, 0xea, 0xea, 0x20, 0x47, 0xfa, 
-0xad, 0x47, 0x6, 0xc9, 0xff, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x6, 0x20, 
-0x54, 0xfa, 0xdf, 0x48, 0x5, 0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 0xfa, 0xad, 0x47, 0x6, 0xc9, 
-0x36, 0xf0, 0x2, 0x84, 0x0, 0x60, 0xa9, 0xff, 0x85, 0x1, 0xa0, 0xaa, 0xa2, 0x2, 0xa9, 0x47, 
-0x85, 0x47, 0xa9, 0x6, 0x85, 0x48, 0xa9, 0xeb, 0x8d, 0x47, 0x6, 0x20, 0xb1, 0xfa, 0xe3, 0x45, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0xb7, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0xec, 0xf0, 0x2, 0x84, 0x0, 
-0xc8, 0xa9, 0xff, 0x8d, 0x47, 0x6, 0x20, 0xc2, 0xfa, 0xe3, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 
-0xc7, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x0, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 
-0x6, 0x20, 0xd4, 0xfa, 0xe3, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 0xda, 0xfa, 0xad, 0x47, 0x6, 
-0xc9, 0x38, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0xeb, 0x85, 0x47, 0x20, 0xb1, 0xfa, 0xe7, 0x47, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0xb7, 0xfa, 0xa5, 0x47, 0xc9, 0xec, 0xf0, 0x2, 0x84, 0x0, 0xc8, 
-0xa9, 0xff, 0x85, 0x47, 0x20, 0xc2, 0xfa, 0xe7, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0xc7, 0xfa, 
-0xa5, 0x47, 0xc9, 0x0, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0xd4, 0xfa, 
-0xe7, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0xda, 0xfa, 0xa5, 0x47, 0xc9, 0x38, 0xf0, 0x2, 0x84, 
-0x0, 0xc8, 0xa9, 0xeb, 0x8d, 0x47, 0x6, 0x20, 0xb1, 0xfa, 0xef, 0x47, 0x6, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0xb7, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0xec, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0xff, 
-0x8d, 0x47, 0x6, 0x20, 0xc2, 0xfa, 0xef, 0x47, 0x6, 0xea, 0xea, 0xea, 0xea, 0x20, 0xc7, 0xfa, 
-0xad, 0x47, 0x6, 0xc9, 0x0, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x6, 0x20, 
-0xd4, 0xfa, 0xef, 0x47, 0x6, 0xea, 0xea, 0xea, 0xea, 0x20, 0xda, 0xfa, 0xad, 0x47, 0x6, 0xc9, 
-0x38, 0xf0, 0x2, 0x84, 0x0, 0xa9, 0xeb, 0x8d, 0x47, 0x6, 0xa9, 0x48, 0x85, 0x45, 0xa9, 0x5, 
-0x85, 0x46, 0xa0, 0xff, 0x20, 0xb1, 0xfa, 0xf3, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xb3, 0x68, 
-0x28, 0x20, 0xb7, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0xec, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0xff, 0x8d, 0x47, 0x6, 0x20, 0xc2, 0xfa, 0xf3, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xb4, 0x68, 
-0x28, 0x20, 0xc7, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x0, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x6, 0x20, 0xd4, 0xfa, 0xf3, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xb5, 0x68, 
-0x28, 0x20, 0xda, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x38, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xb6, 0xa2, 
-0xff, 0xa9, 0xeb, 0x85, 0x47, 0x20, 0xb1, 0xfa, 0xf7, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0xb7, 
-0xfa, 0xa5, 0x47, 0xc9, 0xec, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0xff, 0x85, 0x47, 0x20, 0xc2, 
-0xfa, 0xf7, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0xc7, 0xfa, 0xa5, 0x47, 0xc9, 0x0, 0xf0, 0x2, 
-0x84, 0x0, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0xd4, 0xfa, 0xf7, 0x48, 0xea, 0xea, 0xea, 0xea, 
-0x20, 0xda, 0xfa, 0xa5, 0x47, 0xc9, 0x38, 0xf0, 0x2, 0x84, 0x0, 0xa9, 0xeb, 0x8d, 0x47, 0x6, 
-0xa0, 0xff, 0x20, 0xb1, 0xfa, 0xfb, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xb9, 0x68, 0x28, 
-0x20, 0xb7, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0xec, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 0xff, 
-0x8d, 0x47, 0x6, 0x20, 0xc2, 0xfa, 0xfb, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xba, 0x68, 
-0x28, 0x20, 0xc7, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x0, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x6, 0x20, 0xd4, 0xfa, 0xfb, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xbb, 
-0x68, 0x28, 0x20, 0xda, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x38, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xbc, 
-0xa2, 0xff, 0xa9, 0xeb, 0x8d, 0x47, 0x6, 0x20, 0xb1, 0xfa, 0xff, 0x48, 0x5, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0xb7, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0xec, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0xff, 
-0x8d, 0x47, 0x6, 0x20, 0xc2, 0xfa, 0xff, 0x48, 0x5, 0xea, 0xea, 0xea, 0xea, 0x20, 0xc7, 0xfa, 
-0xad, 0x47, 0x6, 0xc9, 0x0, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x6, 0x20, 
-0xd4, 0xfa, 0xff, 0x48, 0x5, 0xea, 0xea, 0xea, 0xea, 0x20, 0xda, 0xfa, 0xad, 0x47, 0x6, 0xc9, 
-0x38, 0xf0, 0x2, 0x84, 0x0, 0x60, 0xa9, 0xff, 0x85, 0x1, 0xa0, 0xbf, 0xa2, 0x2, 0xa9, 0x47, 
-0x85, 0x47, 0xa9, 0x6, 0x85, 0x48, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0x20, 0x7b, 0xfa, 0x3, 0x45, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x81, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 
-0xc8, 0xa9, 0x29, 0x8d, 0x47, 0x6, 0x20, 0x8c, 0xfa, 0x3, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 
-0x91, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 
-0x6, 0x20, 0x9e, 0xfa, 0x3, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 0xa4, 0xfa, 0xad, 0x47, 0x6, 
-0xc9, 0x6e, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0x7b, 0xfa, 0x7, 0x47, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x81, 0xfa, 0xa5, 0x47, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 0xc8, 
-0xa9, 0x29, 0x85, 0x47, 0x20, 0x8c, 0xfa, 0x7, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x91, 0xfa, 
-0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x9e, 0xfa, 
-0x7, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0xa4, 0xfa, 0xa5, 0x47, 0xc9, 0x6e, 0xf0, 0x2, 0x84, 
-0x0, 0xc8, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0x20, 0x7b, 0xfa, 0xf, 0x47, 0x6, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x81, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x6, 0x20, 0x8c, 0xfa, 0xf, 0x47, 0x6, 0xea, 0xea, 0xea, 0xea, 0x20, 0x91, 0xfa, 
-0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x6, 0x20, 
-0x9e, 0xfa, 0xf, 0x47, 0x6, 0xea, 0xea, 0xea, 0xea, 0x20, 0xa4, 0xfa, 0xad, 0x47, 0x6, 0xc9, 
-0x6e, 0xf0, 0x2, 0x84, 0x0, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0xa9, 0x48, 0x85, 0x45, 0xa9, 0x5, 
-0x85, 0x46, 0xa0, 0xff, 0x20, 0x7b, 0xfa, 0x13, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xc8, 0x68, 
-0x28, 0x20, 0x81, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x29, 0x8d, 0x47, 0x6, 0x20, 0x8c, 0xfa, 0x13, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xc9, 0x68, 
-0x28, 0x20, 0x91, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x6, 0x20, 0x9e, 0xfa, 0x13, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xca, 0x68, 
-0x28, 0x20, 0xa4, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x6e, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xcb, 0xa2, 
-0xff, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0x7b, 0xfa, 0x17, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x81, 
-0xfa, 0xa5, 0x47, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x29, 0x85, 0x47, 0x20, 0x8c, 
-0xfa, 0x17, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x91, 0xfa, 0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x2, 
-0x84, 0x0, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x9e, 0xfa, 0x17, 0x48, 0xea, 0xea, 0xea, 0xea, 
-0x20, 0xa4, 0xfa, 0xa5, 0x47, 0xc9, 0x6e, 0xf0, 0x2, 0x84, 0x0, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 
-0xa0, 0xff, 0x20, 0x7b, 0xfa, 0x1b, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xce, 0x68, 0x28, 
-0x20, 0x81, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 0x29, 
-0x8d, 0x47, 0x6, 0x20, 0x8c, 0xfa, 0x1b, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xcf, 0x68, 
-0x28, 0x20, 0x91, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x6, 0x20, 0x9e, 0xfa, 0x1b, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xd0, 
-0x68, 0x28, 0x20, 0xa4, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x6e, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xd1, 
-0xa2, 0xff, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0x20, 0x7b, 0xfa, 0x1f, 0x48, 0x5, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x81, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x6, 0x20, 0x8c, 0xfa, 0x1f, 0x48, 0x5, 0xea, 0xea, 0xea, 0xea, 0x20, 0x91, 0xfa, 
-0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x6, 0x20, 
-0x9e, 0xfa, 0x1f, 0x48, 0x5, 0xea, 0xea, 0xea, 0xea, 0x20, 0xa4, 0xfa, 0xad, 0x47, 0x6, 0xc9, 
-0x6e, 0xf0, 0x2, 0x84, 0x0, 0x60, 0xa9, 0xff, 0x85, 0x1, 0xa0, 0xd4, 0xa2, 0x2, 0xa9, 0x47, 
-0x85, 0x47, 0xa9, 0x6, 0x85, 0x48, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0x20, 0x53, 0xfb, 0x23, 0x45, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 
-0xc8, 0xa9, 0x29, 0x8d, 0x47, 0x6, 0x20, 0x64, 0xfb, 0x23, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 
-0x69, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 
-0x6, 0x20, 0x68, 0xfa, 0x23, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 0x6e, 0xfa, 0xad, 0x47, 0x6, 
-0xc9, 0x6f, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0x53, 0xfb, 0x27, 0x47, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 0xfb, 0xa5, 0x47, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 0xc8, 
-0xa9, 0x29, 0x85, 0x47, 0x20, 0x64, 0xfb, 0x27, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x69, 0xfb, 
-0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x68, 0xfa, 
-0x27, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x6e, 0xfa, 0xa5, 0x47, 0xc9, 0x6f, 0xf0, 0x2, 0x84, 
-0x0, 0xc8, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0x20, 0x53, 0xfb, 0x2f, 0x47, 0x6, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x59, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x6, 0x20, 0x64, 0xfb, 0x2f, 0x47, 0x6, 0xea, 0xea, 0xea, 0xea, 0x20, 0x69, 0xfb, 
-0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x6, 0x20, 
-0x68, 0xfa, 0x2f, 0x47, 0x6, 0xea, 0xea, 0xea, 0xea, 0x20, 0x6e, 0xfa, 0xad, 0x47, 0x6, 0xc9, 
-0x6f, 0xf0, 0x2, 0x84, 0x0, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0xa9, 0x48, 0x85, 0x45, 0xa9, 0x5, 
-0x85, 0x46, 0xa0, 0xff, 0x20, 0x53, 0xfb, 0x33, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xdd, 0x68, 
-0x28, 0x20, 0x59, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x29, 0x8d, 0x47, 0x6, 0x20, 0x64, 0xfb, 0x33, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xde, 0x68, 
-0x28, 0x20, 0x69, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x6, 0x20, 0x68, 0xfa, 0x33, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xdf, 0x68, 
-0x28, 0x20, 0x6e, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x6f, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xe0, 0xa2, 
-0xff, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0x53, 0xfb, 0x37, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 
-0xfb, 0xa5, 0x47, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x29, 0x85, 0x47, 0x20, 0x64, 
-0xfb, 0x37, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x69, 0xfb, 0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x2, 
-0x84, 0x0, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x68, 0xfa, 0x37, 0x48, 0xea, 0xea, 0xea, 0xea, 
-0x20, 0x6e, 0xfa, 0xa5, 0x47, 0xc9, 0x6f, 0xf0, 0x2, 0x84, 0x0, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 
-0xa0, 0xff, 0x20, 0x53, 0xfb, 0x3b, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xe3, 0x68, 0x28, 
-0x20, 0x59, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 0x29, 
-0x8d, 0x47, 0x6, 0x20, 0x64, 0xfb, 0x3b, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xe4, 0x68, 
-0x28, 0x20, 0x69, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x6, 0x20, 0x68, 0xfa, 0x3b, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xe5, 
-0x68, 0x28, 0x20, 0x6e, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x6f, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xe6, 
-0xa2, 0xff, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0x20, 0x53, 0xfb, 0x3f, 0x48, 0x5, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x59, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x4a, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x6, 0x20, 0x64, 0xfb, 0x3f, 0x48, 0x5, 0xea, 0xea, 0xea, 0xea, 0x20, 0x69, 0xfb, 
-0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x6, 0x20, 
-0x68, 0xfa, 0x3f, 0x48, 0x5, 0xea, 0xea, 0xea, 0xea, 0x20, 0x6e, 0xfa, 0xad, 0x47, 0x6, 0xc9, 
-0x6f, 0xf0, 0x2, 0x84, 0x0, 0x60, 0xa9, 0xff, 0x85, 0x1, 0xa0, 0xe9, 0xa2, 0x2, 0xa9, 0x47, 
-0x85, 0x47, 0xa9, 0x6, 0x85, 0x48, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0x20, 0x1d, 0xfb, 0x43, 0x45, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x23, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 
-0xc8, 0xa9, 0x29, 0x8d, 0x47, 0x6, 0x20, 0x2e, 0xfb, 0x43, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 
-0x33, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x14, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 
-0x6, 0x20, 0x40, 0xfb, 0x43, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 0x46, 0xfb, 0xad, 0x47, 0x6, 
-0xc9, 0x1b, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0x1d, 0xfb, 0x47, 0x47, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x23, 0xfb, 0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 
-0xa9, 0x29, 0x85, 0x47, 0x20, 0x2e, 0xfb, 0x47, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x33, 0xfb, 
-0xa5, 0x47, 0xc9, 0x14, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x40, 0xfb, 
-0x47, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x46, 0xfb, 0xa5, 0x47, 0xc9, 0x1b, 0xf0, 0x2, 0x84, 
-0x0, 0xc8, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0x20, 0x1d, 0xfb, 0x4f, 0x47, 0x6, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x23, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x6, 0x20, 0x2e, 0xfb, 0x4f, 0x47, 0x6, 0xea, 0xea, 0xea, 0xea, 0x20, 0x33, 0xfb, 
-0xad, 0x47, 0x6, 0xc9, 0x14, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x6, 0x20, 
-0x40, 0xfb, 0x4f, 0x47, 0x6, 0xea, 0xea, 0xea, 0xea, 0x20, 0x46, 0xfb, 0xad, 0x47, 0x6, 0xc9, 
-0x1b, 0xf0, 0x2, 0x84, 0x0, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0xa9, 0x48, 0x85, 0x45, 0xa9, 0x5, 
-0x85, 0x46, 0xa0, 0xff, 0x20, 0x1d, 0xfb, 0x53, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xf2, 0x68, 
-0x28, 0x20, 0x23, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x29, 0x8d, 0x47, 0x6, 0x20, 0x2e, 0xfb, 0x53, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xf3, 0x68, 
-0x28, 0x20, 0x33, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x14, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x6, 0x20, 0x40, 0xfb, 0x53, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xf4, 0x68, 
-0x28, 0x20, 0x46, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x1b, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xf5, 0xa2, 
-0xff, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0x1d, 0xfb, 0x57, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x23, 
-0xfb, 0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x29, 0x85, 0x47, 0x20, 0x2e, 
-0xfb, 0x57, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x33, 0xfb, 0xa5, 0x47, 0xc9, 0x14, 0xf0, 0x2, 
-0x84, 0x0, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x40, 0xfb, 0x57, 0x48, 0xea, 0xea, 0xea, 0xea, 
-0x20, 0x46, 0xfb, 0xa5, 0x47, 0xc9, 0x1b, 0xf0, 0x2, 0x84, 0x0, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 
-0xa0, 0xff, 0x20, 0x1d, 0xfb, 0x5b, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xf8, 0x68, 0x28, 
-0x20, 0x23, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 0x29, 
-0x8d, 0x47, 0x6, 0x20, 0x2e, 0xfb, 0x5b, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xf9, 0x68, 
-0x28, 0x20, 0x33, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x14, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x6, 0x20, 0x40, 0xfb, 0x5b, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xfa, 
-0x68, 0x28, 0x20, 0x46, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x1b, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xfb, 
-0xa2, 0xff, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0x20, 0x1d, 0xfb, 0x5f, 0x48, 0x5, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x23, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x6, 0x20, 0x2e, 0xfb, 0x5f, 0x48, 0x5, 0xea, 0xea, 0xea, 0xea, 0x20, 0x33, 0xfb, 
-0xad, 0x47, 0x6, 0xc9, 0x14, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x6, 0x20, 
-0x40, 0xfb, 0x5f, 0x48, 0x5, 0xea, 0xea, 0xea, 0xea, 0x20, 0x46, 0xfb, 0xad, 0x47, 0x6, 0xc9, 
-0x1b, 0xf0, 0x2, 0x84, 0x0, 0x60, 0xa9, 0xff, 0x85, 0x1, 0xa0, 0x1, 0xa2, 0x2, 0xa9, 0x47, 
-0x85, 0x47, 0xa9, 0x6, 0x85, 0x48, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0x20, 0xe9, 0xfa, 0x63, 0x45, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0xef, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 
-0xc8, 0xa9, 0x29, 0x8d, 0x47, 0x6, 0x20, 0xfa, 0xfa, 0x63, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 
-0xff, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x14, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 
-0x6, 0x20, 0xa, 0xfb, 0x63, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 0x10, 0xfb, 0xad, 0x47, 0x6, 
-0xc9, 0x9b, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0xe9, 0xfa, 0x67, 0x47, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0xef, 0xfa, 0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 
-0xa9, 0x29, 0x85, 0x47, 0x20, 0xfa, 0xfa, 0x67, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0xff, 0xfa, 
-0xa5, 0x47, 0xc9, 0x14, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0xa, 0xfb, 
-0x67, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x10, 0xfb, 0xa5, 0x47, 0xc9, 0x9b, 0xf0, 0x2, 0x84, 
-0x0, 0xc8, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0x20, 0xe9, 0xfa, 0x6f, 0x47, 0x6, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0xef, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x6, 0x20, 0xfa, 0xfa, 0x6f, 0x47, 0x6, 0xea, 0xea, 0xea, 0xea, 0x20, 0xff, 0xfa, 
-0xad, 0x47, 0x6, 0xc9, 0x14, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x6, 0x20, 
-0xa, 0xfb, 0x6f, 0x47, 0x6, 0xea, 0xea, 0xea, 0xea, 0x20, 0x10, 0xfb, 0xad, 0x47, 0x6, 0xc9, 
-0x9b, 0xf0, 0x2, 0x84, 0x0, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0xa9, 0x48, 0x85, 0x45, 0xa9, 0x5, 
-0x85, 0x46, 0xa0, 0xff, 0x20, 0xe9, 0xfa, 0x73, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xa, 0x68, 
-0x28, 0x20, 0xef, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x29, 0x8d, 0x47, 0x6, 0x20, 0xfa, 0xfa, 0x73, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xb, 0x68, 
-0x28, 0x20, 0xff, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x14, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x6, 0x20, 0xa, 0xfb, 0x73, 0x45, 0xea, 0xea, 0x8, 0x48, 0xa0, 0xc, 0x68, 
-0x28, 0x20, 0x10, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x9b, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xd, 0xa2, 
-0xff, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0xe9, 0xfa, 0x77, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0xef, 
-0xfa, 0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x29, 0x85, 0x47, 0x20, 0xfa, 
-0xfa, 0x77, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0xff, 0xfa, 0xa5, 0x47, 0xc9, 0x14, 0xf0, 0x2, 
-0x84, 0x0, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0xa, 0xfb, 0x77, 0x48, 0xea, 0xea, 0xea, 0xea, 
-0x20, 0x10, 0xfb, 0xa5, 0x47, 0xc9, 0x9b, 0xf0, 0x2, 0x84, 0x0, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 
-0xa0, 0xff, 0x20, 0xe9, 0xfa, 0x7b, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0x10, 0x68, 0x28, 
-0x20, 0xef, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 0x29, 
-0x8d, 0x47, 0x6, 0x20, 0xfa, 0xfa, 0x7b, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0x11, 0x68, 
-0x28, 0x20, 0xff, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x14, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x6, 0x20, 0xa, 0xfb, 0x7b, 0x48, 0x5, 0xea, 0xea, 0x8, 0x48, 0xa0, 0x12, 
-0x68, 0x28, 0x20, 0x10, 0xfb, 0xad, 0x47, 0x6, 0xc9, 0x9b, 0xf0, 0x2, 0x84, 0x0, 0xa0, 0x13, 
-0xa2, 0xff, 0xa9, 0xa5, 0x8d, 0x47, 0x6, 0x20, 0xe9, 0xfa, 0x7f, 0x48, 0x5, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0xef, 0xfa, 0xad, 0x47, 0x6, 0xc9, 0x52, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x6, 0x20, 0xfa, 0xfa, 0x7f, 0x48, 0x5, 0xea, 0xea, 0xea, 0xea, 0x20, 0xff, 0xfa, 
-0xad, 0x47, 0x6, 0xc9, 0x14, 0xf0, 0x2, 0x84, 0x0, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x6, 0x20, 
-0xa, 0xfb, 0x7f, 0x48, 0x5, 0xea, 0xea, 0xea, 0xea, 0x20, 0x10, 0xfb, 0xad, 0x47, 0x6, 0xc9, 
-0x9b, 0xf0, 0x2, 0x84, 0x0, 0x60, 0x18, 0xa9, 0xff, 0x85, 0x1, 0x24, 0x1, 0xa9, 0x55, 0x60, 
-0xb0, 0x9, 0x10, 0x7, 0xc9, 0xff, 0xd0, 0x3, 0x50, 0x1, 0x60, 0x84, 0x0, 0x60, 0x38, 0xb8, 
-0xa9, 0x0, 0x60, 0xd0, 0x7, 0x70, 0x5, 0x90, 0x3, 0x30, 0x1, 0x60, 0x84, 0x0, 0x60, 0x18, 
-0x24, 0x1, 0xa9, 0x55, 0x60, 0xd0, 0x7, 0x50, 0x5, 0xb0, 0x3, 0x30, 0x1, 0x60, 0x84, 0x0, 
-0x60, 0x38, 0xb8, 0xa9, 0xf8, 0x60, 0x90, 0x9, 0x10, 0x7, 0xc9, 0xe8, 0xd0, 0x3, 0x70, 0x1, 
-0x60, 0x84, 0x0, 0x60, 0x18, 0x24, 0x1, 0xa9, 0x5f, 0x60, 0xb0, 0x9, 0x10, 0x7, 0xc9, 0xf5, 
-0xd0, 0x3, 0x50, 0x1, 0x60, 0x84, 0x0, 0x60, 0x38, 0xb8, 0xa9, 0x70, 0x60, 0xd0, 0x7, 0x70, 
-0x5, 0x90, 0x3, 0x30, 0x1, 0x60, 0x84, 0x0, 0x60, 0x18, 0x24, 0x1, 0xa9, 0x0, 0x60, 0x30, 
-0x9, 0xb0, 0x7, 0xc9, 0x69, 0xd0, 0x3, 0x70, 0x1, 0x60, 0x84, 0x0, 0x60, 0x38, 0x24, 0x1, 
-0xa9, 0x0, 0x60, 0x30, 0x9, 0xb0, 0x7, 0xc9, 0x6a, 0xd0, 0x3, 0x70, 0x1, 0x60, 0x84, 0x0, 
-0x60, 0x38, 0xb8, 0xa9, 0x7f, 0x60, 0x10, 0x9, 0xb0, 0x7, 0xc9, 0xff, 0xd0, 0x3, 0x50, 0x1, 
-0x60, 0x84, 0x0, 0x60, 0x18, 0x24, 0x1, 0xa9, 0x7f, 0x60, 0x10, 0x9, 0xb0, 0x7, 0xc9, 0xff, 
-0xd0, 0x3, 0x70, 0x1, 0x60, 0x84, 0x0, 0x60, 0x38, 0xb8, 0xa9, 0x7f, 0x60, 0xd0, 0x7, 0x30, 
-0x5, 0x70, 0x3, 0x90, 0x1, 0x60, 0x84, 0x0, 0x60, 0x24, 0x1, 0xa9, 0x40, 0x60, 0x30, 0x7, 
-0x90, 0x5, 0xd0, 0x3, 0x50, 0x1, 0x60, 0x84, 0x0, 0x60, 0xb8, 0x60, 0xf0, 0x7, 0x30, 0x5, 
-0x90, 0x3, 0x70, 0x1, 0x60, 0x84, 0x0, 0x60, 0xf0, 0x5, 0x10, 0x3, 0x10, 0x1, 0x60, 0x84, 
-0x0, 0x60, 0xa9, 0x80, 0x60, 0xf0, 0x5, 0x10, 0x3, 0x90, 0x1, 0x60, 0x84, 0x0, 0x60, 0xd0, 
-0x5, 0x30, 0x3, 0x90, 0x1, 0x60, 0x84, 0x0, 0x60, 0xb0, 0x5, 0xf0, 0x3, 0x10, 0x1, 0x60, 
-0x84, 0x0, 0x60, 0x90, 0x5, 0xf0, 0x3, 0x30, 0x1, 0x60, 0x84, 0x0, 0x60, 0x24, 0x1, 0xa0, 
-0x40, 0x60, 0x30, 0x7, 0x90, 0x5, 0xd0, 0x3, 0x50, 0x1, 0x60, 0x86, 0x0, 0x60, 0xb8, 0x60, 
-0xf0, 0x7, 0x30, 0x5, 0x90, 0x3, 0x70, 0x1, 0x60, 0x86, 0x0, 0x60, 0xf0, 0x5, 0x10, 0x3, 
-0x10, 0x1, 0x60, 0x86, 0x0, 0x60, 0xa0, 0x80, 0x60, 0xf0, 0x5, 0x10, 0x3, 0x90, 0x1, 0x60, 
-0x86, 0x0, 0x60, 0xd0, 0x5, 0x30, 0x3, 0x90, 0x1, 0x60, 0x86, 0x0, 0x60, 0xb0, 0x5, 0xf0, 
-0x3, 0x10, 0x1, 0x60, 0x86, 0x0, 0x60, 0x90, 0x5, 0xf0, 0x3, 0x30, 0x1, 0x60, 0x86, 0x0, 
-0x60, 0x24, 0x1, 0xa9, 0x40, 0x38, 0x60, 0x30, 0xb, 0x90, 0x9, 0xd0, 0x7, 0x70, 0x5, 0xc9, 
-0x0, 0xd0, 0x1, 0x60, 0x84, 0x0, 0x60, 0xb8, 0x38, 0xa9, 0x40, 0x60, 0xf0, 0xb, 0x30, 0x9, 
-0x90, 0x7, 0x70, 0x5, 0xc9, 0x1, 0xd0, 0x1, 0x60, 0x84, 0x0, 0x60, 0xa9, 0x40, 0x38, 0x24, 
-0x1, 0x60, 0xb0, 0xb, 0xf0, 0x9, 0x10, 0x7, 0x70, 0x5, 0xc9, 0xff, 0xd0, 0x1, 0x60, 0x84, 
-0x0, 0x60, 0x18, 0xa9, 0x80, 0x60, 0x90, 0x5, 0xc9, 0x7f, 0xd0, 0x1, 0x60, 0x84, 0x0, 0x60, 
-0x38, 0xa9, 0x81, 0x60, 0x50, 0x7, 0x90, 0x5, 0xc9, 0x2, 0xd0, 0x1, 0x60, 0x84, 0x0, 0x60, 
-0xa2, 0x55, 0xa9, 0xff, 0x85, 0x1, 0xea, 0x24, 0x1, 0x38, 0xa9, 0x1, 0x60, 0x90, 0x1b, 0xd0, 
-0x19, 0x30, 0x17, 0x50, 0x15, 0xc9, 0x0, 0xd0, 0x11, 0xb8, 0xa9, 0xaa, 0x60, 0xb0, 0xb, 0xf0, 
-0x9, 0x30, 0x7, 0x70, 0x5, 0xc9, 0x55, 0xd0, 0x1, 0x60, 0x84, 0x0, 0x60, 0x24, 0x1, 0x38, 
-0xa9, 0x80, 0x60, 0x90, 0x1c, 0xd0, 0x1a, 0x30, 0x18, 0x50, 0x16, 0xc9, 0x0, 0xd0, 0x12, 0xb8, 
-0xa9, 0x55, 0x38, 0x60, 0xb0, 0xb, 0xf0, 0x9, 0x10, 0x7, 0x70, 0x5, 0xc9, 0xaa, 0xd0, 0x1, 
-0x60, 0x84, 0x0, 0x60, 0x24, 0x1, 0x38, 0xa9, 0x1, 0x60, 0x90, 0x1c, 0xf0, 0x1a, 0x10, 0x18, 
-0x50, 0x16, 0xc9, 0x80, 0xd0, 0x12, 0xb8, 0x18, 0xa9, 0x55, 0x60, 0x90, 0xb, 0xf0, 0x9, 0x30, 
-0x7, 0x70, 0x5, 0xc9, 0x2a, 0xd0, 0x1, 0x60, 0x84, 0x0, 0x24, 0x1, 0x38, 0xa9, 0x80, 0x60, 
-0x90, 0x1c, 0xf0, 0x1a, 0x30, 0x18, 0x50, 0x16, 0xc9, 0x1, 0xd0, 0x12, 0xb8, 0x18, 0xa9, 0x55, 
-0x60, 0xb0, 0xb, 0xf0, 0x9, 0x10, 0x7, 0x70, 0x5, 0xc9, 0xaa, 0xd0, 0x1, 0x60, 0x84, 0x0, 
-0x60, 0x24, 0x1, 0x18, 0xa9, 0x40, 0x60, 0x50, 0x2c, 0xb0, 0x2a, 0x30, 0x28, 0xc9, 0x40, 0xd0, 
-0x24, 0x60, 0xb8, 0x38, 0xa9, 0xff, 0x60, 0x70, 0x1c, 0xd0, 0x1a, 0x30, 0x18, 0x90, 0x16, 0xc9, 
-0xff, 0xd0, 0x12, 0x60, 0x24, 0x1, 0xa9, 0xf0, 0x60, 0x50, 0xa, 0xf0, 0x8, 0x10, 0x6, 0x90, 
-0x4, 0xc9, 0xf0, 0xf0, 0x2, 0x84, 0x0, 0x60, 0x24, 0x1, 0x38, 0xa9, 0x75, 0x60, 0x50, 0x76, 
-0xf0, 0x74, 0x30, 0x72, 0xb0, 0x70, 0xc9, 0x65, 0xd0, 0x6c, 0x60, 0x24, 0x1, 0x18, 0xa9, 0xb3, 
-0x60, 0x50, 0x63, 0x90, 0x61, 0x10, 0x5f, 0xc9, 0xfb, 0xd0, 0x5b, 0x60, 0xb8, 0x18, 0xa9, 0xc3, 
-0x60, 0x70, 0x53, 0xf0, 0x51, 0x10, 0x4f, 0xb0, 0x4d, 0xc9, 0xd3, 0xd0, 0x49, 0x60, 0x24, 0x1, 
-0x38, 0xa9, 0x10, 0x60, 0x50, 0x40, 0xf0, 0x3e, 0x30, 0x3c, 0xb0, 0x3a, 0xc9, 0x7e, 0xd0, 0x36, 
-0x60, 0x24, 0x1, 0x18, 0xa9, 0x40, 0x60, 0x70, 0x2d, 0xb0, 0x2b, 0x30, 0x29, 0xc9, 0x53, 0xd0, 
-0x25, 0x60, 0xb8, 0x38, 0xa9, 0xff, 0x60, 0x70, 0x1d, 0xf0, 0x1b, 0x10, 0x19, 0x90, 0x17, 0xc9, 
-0xff, 0xd0, 0x13, 0x60, 0x24, 0x1, 0x38, 0xa9, 0xf0, 0x60, 0x70, 0xa, 0xf0, 0x8, 0x10, 0x6, 
-0x90, 0x4, 0xc9, 0xb8, 0xf0, 0x2, 0x84, 0x0, 0x60, 0x24, 0x1, 0x18, 0xa9, 0xb2, 0x60, 0x70, 
-0x2a, 0x90, 0x28, 0x30, 0x26, 0xc9, 0x5, 0xd0, 0x22, 0x60, 0xb8, 0x18, 0xa9, 0x42, 0x60, 0x70, 
-0x1a, 0x30, 0x18, 0xb0, 0x16, 0xc9, 0x57, 0xd0, 0x12, 0x60, 0x24, 0x1, 0x38, 0xa9, 0x75, 0x60, 
-0x70, 0x9, 0x30, 0x7, 0x90, 0x5, 0xc9, 0x11, 0xd0, 0x1, 0x60, 0x85, 0x0, 0x24, 0x1, 0x18, 
-0xa9, 0xb3, 0x60, 0x50, 0x50, 0x90, 0x4e, 0x10, 0x4c, 0xc9, 0xe1, 0xd0, 0x48, 0x60, 0xb8, 0x18, 
-0xa9, 0x42, 0x60, 0x70, 0x40, 0xf0, 0x3e, 0x30, 0x3c, 0x90, 0x3a, 0xc9, 0x56, 0xd0, 0x36, 0x60, 
-0x24, 0x1, 0x38, 0xa9, 0x75, 0x60, 0x50, 0x2d, 0xf0, 0x2b, 0x30, 0x29, 0x90, 0x27, 0xc9, 0x6e, 
-0xd0, 0x23, 0x60, 0x24, 0x1, 0x18, 0xa9, 0xb3, 0x60, 0x50, 0x1a, 0x90, 0x18, 0x30, 0x16, 0xc9, 
-0x2, 0xd0, 0x12, 0x60, 0xb8, 0x18, 0xa9, 0x42, 0x60, 0x70, 0xa, 0xf0, 0x8, 0x30, 0x6, 0xb0, 
-0x4, 0xc9, 0x42, 0xf0, 0x2, 0x84, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x80, 0xff, 0x80, 0x80, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0xff, 0x1, 0x1, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xfe, 0x0, 0xc0, 0xc0, 0xfe, 0x7c, 0x0, 
-0xfe, 0xfe, 0x0, 0xf0, 0xc0, 0xfe, 0xfe, 0x0, 0xc6, 0xc6, 0x2, 0xfe, 0xc6, 0xc6, 0xc6, 0x0, 
-0xcc, 0xd8, 0x0, 0xf0, 0xd8, 0xcc, 0xc6, 0x0, 0xc6, 0xee, 0x2, 0xd6, 0xc6, 0xc6, 0xc6, 0x0, 
-0xc6, 0xc6, 0x2, 0xd6, 0xce, 0xc6, 0xc6, 0x0, 0x7c, 0xfe, 0x2, 0xc6, 0xc6, 0xfe, 0x7c, 0x0, 
-0xfc, 0xfe, 0x2, 0xfc, 0xc0, 0xc0, 0xc0, 0x0, 0xcc, 0xcc, 0x0, 0x78, 0x30, 0x30, 0x30, 0x0, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0, 0xfc, 0xfe, 0x2, 0x6, 0x1c, 0x70, 0xfe, 0x0, 
-0xfc, 0xfe, 0x2, 0x3c, 0x3c, 0x2, 0xfe, 0x0, 0x18, 0x18, 0xd8, 0xd8, 0xfe, 0x18, 0x18, 0x0, 
-0xfe, 0xfe, 0x0, 0x80, 0xfc, 0x6, 0xfe, 0x0, 0x7c, 0xfe, 0x0, 0xc0, 0xfc, 0xc6, 0xfe, 0x0, 
-0xfe, 0xfe, 0x6, 0xc, 0x18, 0x10, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x18, 0x18, 0x18, 0x18, 0x0, 0x18, 0x18, 0x0, 0x33, 0x33, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x66, 0x66, 0xff, 0x66, 0xff, 0x66, 0x66, 0x0, 0x18, 0x3e, 0x60, 0x3c, 0x6, 0x7c, 0x18, 0x0, 
-0x62, 0x66, 0xc, 0x18, 0x30, 0x66, 0x46, 0x0, 0x3c, 0x66, 0x3c, 0x38, 0x67, 0x66, 0x3f, 0x0, 
-0xc, 0xc, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x18, 0x30, 0x30, 0x30, 0x18, 0xc, 0x0, 
-0x30, 0x18, 0xc, 0xc, 0xc, 0x18, 0x30, 0x0, 0x0, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x0, 0x0, 
-0x0, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x30, 
-0x0, 0x0, 0x0, 0x6e, 0x3b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 
-0x0, 0x3, 0x6, 0xc, 0x18, 0x30, 0x60, 0x0, 0x3e, 0x63, 0x67, 0x6b, 0x73, 0x63, 0x3e, 0x0, 
-0xc, 0x1c, 0xc, 0xc, 0xc, 0xc, 0x3f, 0x0, 0x3e, 0x63, 0x63, 0xe, 0x38, 0x63, 0x7f, 0x0, 
-0x3e, 0x63, 0x63, 0xe, 0x63, 0x63, 0x3e, 0x0, 0x6, 0xe, 0x1e, 0x26, 0x7f, 0x6, 0x6, 0x0, 
-0x7f, 0x63, 0x60, 0x7e, 0x3, 0x63, 0x3e, 0x0, 0x3e, 0x63, 0x60, 0x7e, 0x63, 0x63, 0x3e, 0x0, 
-0x7f, 0x63, 0x6, 0xc, 0x18, 0x18, 0x3c, 0x0, 0x3e, 0x63, 0x63, 0x3e, 0x63, 0x63, 0x3e, 0x0, 
-0x3e, 0x63, 0x63, 0x3f, 0x3, 0x63, 0x3e, 0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 0x18, 0x18, 0x0, 
-0x0, 0x0, 0x18, 0x18, 0x0, 0x18, 0x18, 0x30, 0xe, 0x18, 0x30, 0x60, 0x30, 0x18, 0xe, 0x0, 
-0x0, 0x0, 0x7e, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x70, 0x18, 0xc, 0x6, 0xc, 0x18, 0x70, 0x0, 
-0x7e, 0x63, 0x3, 0x6, 0x1c, 0x0, 0x18, 0x18, 0x7c, 0xc6, 0xce, 0xee, 0xe0, 0xe6, 0x7c, 0x0, 
-0x1c, 0x36, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x0, 0x6e, 0x73, 0x63, 0x7e, 0x63, 0x63, 0x7e, 0x0, 
-0x1e, 0x33, 0x60, 0x60, 0x60, 0x33, 0x1e, 0x0, 0x6c, 0x76, 0x63, 0x63, 0x63, 0x66, 0x7c, 0x0, 
-0x7f, 0x31, 0x30, 0x3c, 0x30, 0x31, 0x7f, 0x0, 0x7f, 0x31, 0x30, 0x3c, 0x30, 0x30, 0x78, 0x0, 
-0x1e, 0x33, 0x60, 0x67, 0x63, 0x37, 0x1d, 0x0, 0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x0, 
-0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0, 0x1f, 0x6, 0x6, 0x6, 0x6, 0x66, 0x3c, 0x0, 
-0x66, 0x66, 0x6c, 0x78, 0x6c, 0x67, 0x63, 0x0, 0x78, 0x30, 0x60, 0x60, 0x63, 0x63, 0x7e, 0x0, 
-0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x0, 0x63, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x63, 0x0, 
-0x1c, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1c, 0x0, 0x6e, 0x73, 0x63, 0x7e, 0x60, 0x60, 0x60, 0x0, 
-0x1c, 0x36, 0x63, 0x6b, 0x67, 0x36, 0x1d, 0x0, 0x6e, 0x73, 0x63, 0x7e, 0x6c, 0x67, 0x63, 0x0, 
-0x3e, 0x63, 0x60, 0x3e, 0x3, 0x63, 0x3e, 0x0, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0, 
-0x73, 0x33, 0x63, 0x63, 0x63, 0x76, 0x3c, 0x0, 0x73, 0x33, 0x63, 0x63, 0x66, 0x3c, 0x18, 0x0, 
-0x73, 0x33, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x0, 0x63, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x63, 0x0, 
-0x33, 0x63, 0x63, 0x36, 0x1c, 0x78, 0x70, 0x0, 0x7f, 0x63, 0x6, 0x1c, 0x33, 0x63, 0x7e, 0x0, 
-0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x0, 0x40, 0x60, 0x30, 0x18, 0xc, 0x6, 0x2, 0x0, 
-0x3c, 0xc, 0xc, 0xc, 0xc, 0xc, 0x3c, 0x0, 0x0, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x30, 0x30, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x3f, 0x63, 0x63, 0x67, 0x3b, 0x0, 0x60, 0x60, 0x6e, 0x73, 0x63, 0x63, 0x3e, 0x0, 
-0x0, 0x0, 0x3e, 0x63, 0x60, 0x63, 0x3e, 0x0, 0x3, 0x3, 0x3b, 0x67, 0x63, 0x63, 0x3e, 0x0, 
-0x0, 0x0, 0x3e, 0x61, 0x7f, 0x60, 0x3e, 0x0, 0xe, 0x18, 0x18, 0x3c, 0x18, 0x18, 0x3c, 0x0, 
-0x0, 0x0, 0x3e, 0x60, 0x63, 0x63, 0x3d, 0x0, 0x60, 0x60, 0x6e, 0x73, 0x63, 0x66, 0x67, 0x0, 
-0x0, 0x0, 0x1e, 0xc, 0xc, 0xc, 0x1e, 0x0, 0x0, 0x0, 0x3f, 0x6, 0x6, 0x6, 0x66, 0x3c, 
-0x60, 0x60, 0x66, 0x6e, 0x7c, 0x67, 0x63, 0x0, 0x1c, 0xc, 0xc, 0xc, 0xc, 0xc, 0x1e, 0x0, 
-0x0, 0x0, 0x6e, 0x7f, 0x6b, 0x62, 0x67, 0x0, 0x0, 0x0, 0x6e, 0x73, 0x63, 0x66, 0x67, 0x0, 
-0x0, 0x0, 0x3e, 0x63, 0x63, 0x63, 0x3e, 0x0, 0x0, 0x0, 0x3e, 0x63, 0x73, 0x6e, 0x60, 0x60, 
-0x0, 0x0, 0x3e, 0x63, 0x67, 0x3b, 0x3, 0x3, 0x0, 0x0, 0x6e, 0x73, 0x63, 0x7e, 0x63, 0x0, 
-0x0, 0x0, 0x3e, 0x71, 0x1c, 0x47, 0x3e, 0x0, 0x6, 0xc, 0x3f, 0x18, 0x18, 0x1b, 0xe, 0x0, 
-0x0, 0x0, 0x73, 0x33, 0x63, 0x67, 0x3b, 0x0, 0x0, 0x0, 0x73, 0x33, 0x63, 0x66, 0x3c, 0x0, 
-0x0, 0x0, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x0, 0x0, 0x0, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x0, 
-0x0, 0x0, 0x33, 0x63, 0x63, 0x3f, 0x3, 0x3e, 0x0, 0x0, 0x7f, 0xe, 0x1c, 0x38, 0x7f, 0x0, 
-0x3c, 0x42, 0x99, 0xa1, 0xa1, 0x99, 0x42, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x6, 0x12, 0x33, 0x33, 0x6, 0x12, 0x33, 
-0x38, 0x6, 0x12, 0x33, 0x3a, 0x6, 0x12, 0x33, 0xf, 0x6, 0x12, 0x33, 0x33, 0x6, 0x12, 0x33, 
-0x38, 0x6, 0x12, 0x33, 0x3a, 0x6, 0x12, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc5, 0x4, 0xc0, 0xf4, 0xc5, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x80, 0x80, 0xff, 0x80, 0x80, 0x0, 0x0, 0x0, 0x80, 0x80, 0xff, 0x80, 0x80, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x1, 0x1, 0xff, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0xff, 0x1, 0x1, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x7c, 0xfe, 0x0, 0xc0, 0xc0, 0xfe, 0x7c, 0x0, 0x7c, 0xfe, 0x0, 0xc0, 0xc0, 0xfe, 0x7c, 0x0, 
-0xfe, 0xfe, 0x0, 0xf0, 0xc0, 0xfe, 0xfe, 0x0, 0xfe, 0xfe, 0x0, 0xf0, 0xc0, 0xfe, 0xfe, 0x0, 
-0xc6, 0xc6, 0x2, 0xfe, 0xc6, 0xc6, 0xc6, 0x0, 0xc6, 0xc6, 0x2, 0xfe, 0xc6, 0xc6, 0xc6, 0x0, 
-0xcc, 0xd8, 0x0, 0xf0, 0xd8, 0xcc, 0xc6, 0x0, 0xcc, 0xd8, 0x0, 0xf0, 0xd8, 0xcc, 0xc6, 0x0, 
-0xc6, 0xee, 0x2, 0xd6, 0xc6, 0xc6, 0xc6, 0x0, 0xc6, 0xee, 0x2, 0xd6, 0xc6, 0xc6, 0xc6, 0x0, 
-0xc6, 0xc6, 0x2, 0xd6, 0xce, 0xc6, 0xc6, 0x0, 0xc6, 0xc6, 0x2, 0xd6, 0xce, 0xc6, 0xc6, 0x0, 
-0x7c, 0xfe, 0x2, 0xc6, 0xc6, 0xfe, 0x7c, 0x0, 0x7c, 0xfe, 0x2, 0xc6, 0xc6, 0xfe, 0x7c, 0x0, 
-0xfc, 0xfe, 0x2, 0xfc, 0xc0, 0xc0, 0xc0, 0x0, 0xfc, 0xfe, 0x2, 0xfc, 0xc0, 0xc0, 0xc0, 0x0, 
-0xcc, 0xcc, 0x0, 0x78, 0x30, 0x30, 0x30, 0x0, 0xcc, 0xcc, 0x0, 0x78, 0x30, 0x30, 0x30, 0x0, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0, 
-0xfc, 0xfe, 0x2, 0x6, 0x1c, 0x70, 0xfe, 0x0, 0xfc, 0xfe, 0x2, 0x6, 0x1c, 0x70, 0xfe, 0x0, 
-0xfc, 0xfe, 0x2, 0x3c, 0x3c, 0x2, 0xfe, 0x0, 0xfc, 0xfe, 0x2, 0x3c, 0x3c, 0x2, 0xfe, 0x0, 
-0x18, 0x18, 0xd8, 0xd8, 0xfe, 0x18, 0x18, 0x0, 0x18, 0x18, 0xd8, 0xd8, 0xfe, 0x18, 0x18, 0x0, 
-0xfe, 0xfe, 0x0, 0x80, 0xfc, 0x6, 0xfe, 0x0, 0xfe, 0xfe, 0x0, 0x80, 0xfc, 0x6, 0xfe, 0x0, 
-0x7c, 0xfe, 0x0, 0xc0, 0xfc, 0xc6, 0xfe, 0x0, 0x7c, 0xfe, 0x0, 0xc0, 0xfc, 0xc6, 0xfe, 0x0, 
-0xfe, 0xfe, 0x6, 0xc, 0x18, 0x10, 0x30, 0x0, 0xfe, 0xfe, 0x6, 0xc, 0x18, 0x10, 0x30, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0xff, 0xff, 0x0, 0x0, 0x0, 0x18, 0x18, 0x18, 0xff, 0xff, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x18, 0x18, 0x18, 0x18, 0x0, 0x18, 0x18, 0x0, 0x18, 0x18, 0x18, 0x18, 0x0, 0x18, 0x18, 0x0, 
-0x33, 0x33, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0x33, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x66, 0x66, 0xff, 0x66, 0xff, 0x66, 0x66, 0x0, 0x66, 0x66, 0xff, 0x66, 0xff, 0x66, 0x66, 0x0, 
-0x18, 0x3e, 0x60, 0x3c, 0x6, 0x7c, 0x18, 0x0, 0x18, 0x3e, 0x60, 0x3c, 0x6, 0x7c, 0x18, 0x0, 
-0x62, 0x66, 0xc, 0x18, 0x30, 0x66, 0x46, 0x0, 0x62, 0x66, 0xc, 0x18, 0x30, 0x66, 0x46, 0x0, 
-0x3c, 0x66, 0x3c, 0x38, 0x67, 0x66, 0x3f, 0x0, 0x3c, 0x66, 0x3c, 0x38, 0x67, 0x66, 0x3f, 0x0, 
-0xc, 0xc, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0xc, 0x18, 0x30, 0x30, 0x30, 0x18, 0xc, 0x0, 0xc, 0x18, 0x30, 0x30, 0x30, 0x18, 0xc, 0x0, 
-0x30, 0x18, 0xc, 0xc, 0xc, 0x18, 0x30, 0x0, 0x30, 0x18, 0xc, 0xc, 0xc, 0x18, 0x30, 0x0, 
-0x0, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x0, 0x0, 0x0, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x0, 0x0, 
-0x0, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x0, 0x0, 0x0, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x30, 
-0x0, 0x0, 0x0, 0x6e, 0x3b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0x3b, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 
-0x0, 0x3, 0x6, 0xc, 0x18, 0x30, 0x60, 0x0, 0x0, 0x3, 0x6, 0xc, 0x18, 0x30, 0x60, 0x0, 
-0x3e, 0x63, 0x67, 0x6b, 0x73, 0x63, 0x3e, 0x0, 0x3e, 0x63, 0x67, 0x6b, 0x73, 0x63, 0x3e, 0x0, 
-0xc, 0x1c, 0xc, 0xc, 0xc, 0xc, 0x3f, 0x0, 0xc, 0x1c, 0xc, 0xc, 0xc, 0xc, 0x3f, 0x0, 
-0x3e, 0x63, 0x63, 0xe, 0x38, 0x63, 0x7f, 0x0, 0x3e, 0x63, 0x63, 0xe, 0x38, 0x63, 0x7f, 0x0, 
-0x3e, 0x63, 0x63, 0xe, 0x63, 0x63, 0x3e, 0x0, 0x3e, 0x63, 0x63, 0xe, 0x63, 0x63, 0x3e, 0x0, 
-0x6, 0xe, 0x1e, 0x26, 0x7f, 0x6, 0x6, 0x0, 0x6, 0xe, 0x1e, 0x26, 0x7f, 0x6, 0x6, 0x0, 
-0x7f, 0x63, 0x60, 0x7e, 0x3, 0x63, 0x3e, 0x0, 0x7f, 0x63, 0x60, 0x7e, 0x3, 0x63, 0x3e, 0x0, 
-0x3e, 0x63, 0x60, 0x7e, 0x63, 0x63, 0x3e, 0x0, 0x3e, 0x63, 0x60, 0x7e, 0x63, 0x63, 0x3e, 0x0, 
-0x7f, 0x63, 0x6, 0xc, 0x18, 0x18, 0x3c, 0x0, 0x7f, 0x63, 0x6, 0xc, 0x18, 0x18, 0x3c, 0x0, 
-0x3e, 0x63, 0x63, 0x3e, 0x63, 0x63, 0x3e, 0x0, 0x3e, 0x63, 0x63, 0x3e, 0x63, 0x63, 0x3e, 0x0, 
-0x3e, 0x63, 0x63, 0x3f, 0x3, 0x63, 0x3e, 0x0, 0x3e, 0x63, 0x63, 0x3f, 0x3, 0x63, 0x3e, 0x0, 
-0x0, 0x0, 0x18, 0x18, 0x0, 0x18, 0x18, 0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 0x18, 0x18, 0x0, 
-0x0, 0x0, 0x18, 0x18, 0x0, 0x18, 0x18, 0x30, 0x0, 0x0, 0x18, 0x18, 0x0, 0x18, 0x18, 0x30, 
-0xe, 0x18, 0x30, 0x60, 0x30, 0x18, 0xe, 0x0, 0xe, 0x18, 0x30, 0x60, 0x30, 0x18, 0xe, 0x0, 
-0x0, 0x0, 0x7e, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x7e, 0x0, 0x0, 0x0, 
-0x70, 0x18, 0xc, 0x6, 0xc, 0x18, 0x70, 0x0, 0x70, 0x18, 0xc, 0x6, 0xc, 0x18, 0x70, 0x0, 
-0x7e, 0x63, 0x3, 0x6, 0x1c, 0x0, 0x18, 0x18, 0x7e, 0x63, 0x3, 0x6, 0x1c, 0x0, 0x18, 0x18, 
-0x7c, 0xc6, 0xce, 0xee, 0xe0, 0xe6, 0x7c, 0x0, 0x7c, 0xc6, 0xce, 0xee, 0xe0, 0xe6, 0x7c, 0x0, 
-0x1c, 0x36, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x0, 0x1c, 0x36, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x0, 
-0x6e, 0x73, 0x63, 0x7e, 0x63, 0x63, 0x7e, 0x0, 0x6e, 0x73, 0x63, 0x7e, 0x63, 0x63, 0x7e, 0x0, 
-0x1e, 0x33, 0x60, 0x60, 0x60, 0x33, 0x1e, 0x0, 0x1e, 0x33, 0x60, 0x60, 0x60, 0x33, 0x1e, 0x0, 
-0x6c, 0x76, 0x63, 0x63, 0x63, 0x66, 0x7c, 0x0, 0x6c, 0x76, 0x63, 0x63, 0x63, 0x66, 0x7c, 0x0, 
-0x7f, 0x31, 0x30, 0x3c, 0x30, 0x31, 0x7f, 0x0, 0x7f, 0x31, 0x30, 0x3c, 0x30, 0x31, 0x7f, 0x0, 
-0x7f, 0x31, 0x30, 0x3c, 0x30, 0x30, 0x78, 0x0, 0x7f, 0x31, 0x30, 0x3c, 0x30, 0x30, 0x78, 0x0, 
-0x1e, 0x33, 0x60, 0x67, 0x63, 0x37, 0x1d, 0x0, 0x1e, 0x33, 0x60, 0x67, 0x63, 0x37, 0x1d, 0x0, 
-0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x0, 0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x0, 
-0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0, 
-0x1f, 0x6, 0x6, 0x6, 0x6, 0x66, 0x3c, 0x0, 0x1f, 0x6, 0x6, 0x6, 0x6, 0x66, 0x3c, 0x0, 
-0x66, 0x66, 0x6c, 0x78, 0x6c, 0x67, 0x63, 0x0, 0x66, 0x66, 0x6c, 0x78, 0x6c, 0x67, 0x63, 0x0, 
-0x78, 0x30, 0x60, 0x60, 0x63, 0x63, 0x7e, 0x0, 0x78, 0x30, 0x60, 0x60, 0x63, 0x63, 0x7e, 0x0, 
-0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x0, 0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x0, 
-0x63, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x63, 0x0, 0x63, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x63, 0x0, 
-0x1c, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1c, 0x0, 0x1c, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1c, 0x0, 
-0x6e, 0x73, 0x63, 0x7e, 0x60, 0x60, 0x60, 0x0, 0x6e, 0x73, 0x63, 0x7e, 0x60, 0x60, 0x60, 0x0, 
-0x1c, 0x36, 0x63, 0x6b, 0x67, 0x36, 0x1d, 0x0, 0x1c, 0x36, 0x63, 0x6b, 0x67, 0x36, 0x1d, 0x0, 
-0x6e, 0x73, 0x63, 0x7e, 0x6c, 0x67, 0x63, 0x0, 0x6e, 0x73, 0x63, 0x7e, 0x6c, 0x67, 0x63, 0x0, 
-0x3e, 0x63, 0x60, 0x3e, 0x3, 0x63, 0x3e, 0x0, 0x3e, 0x63, 0x60, 0x3e, 0x3, 0x63, 0x3e, 0x0, 
-0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0, 
-0x73, 0x33, 0x63, 0x63, 0x63, 0x76, 0x3c, 0x0, 0x73, 0x33, 0x63, 0x63, 0x63, 0x76, 0x3c, 0x0, 
-0x73, 0x33, 0x63, 0x63, 0x66, 0x3c, 0x18, 0x0, 0x73, 0x33, 0x63, 0x63, 0x66, 0x3c, 0x18, 0x0, 
-0x73, 0x33, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x0, 0x73, 0x33, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x0, 
-0x63, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x63, 0x0, 0x63, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x63, 0x0, 
-0x33, 0x63, 0x63, 0x36, 0x1c, 0x78, 0x70, 0x0, 0x33, 0x63, 0x63, 0x36, 0x1c, 0x78, 0x70, 0x0, 
-0x7f, 0x63, 0x6, 0x1c, 0x33, 0x63, 0x7e, 0x0, 0x7f, 0x63, 0x6, 0x1c, 0x33, 0x63, 0x7e, 0x0, 
-0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x0, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x0, 
-0x40, 0x60, 0x30, 0x18, 0xc, 0x6, 0x2, 0x0, 0x40, 0x60, 0x30, 0x18, 0xc, 0x6, 0x2, 0x0, 
-0x3c, 0xc, 0xc, 0xc, 0xc, 0xc, 0x3c, 0x0, 0x3c, 0xc, 0xc, 0xc, 0xc, 0xc, 0x3c, 0x0, 
-0x0, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x0, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 
-0x30, 0x30, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x30, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x3f, 0x63, 0x63, 0x67, 0x3b, 0x0, 0x0, 0x0, 0x3f, 0x63, 0x63, 0x67, 0x3b, 0x0, 
-0x60, 0x60, 0x6e, 0x73, 0x63, 0x63, 0x3e, 0x0, 0x60, 0x60, 0x6e, 0x73, 0x63, 0x63, 0x3e, 0x0, 
-0x0, 0x0, 0x3e, 0x63, 0x60, 0x63, 0x3e, 0x0, 0x0, 0x0, 0x3e, 0x63, 0x60, 0x63, 0x3e, 0x0, 
-0x3, 0x3, 0x3b, 0x67, 0x63, 0x63, 0x3e, 0x0, 0x3, 0x3, 0x3b, 0x67, 0x63, 0x63, 0x3e, 0x0, 
-0x0, 0x0, 0x3e, 0x61, 0x7f, 0x60, 0x3e, 0x0, 0x0, 0x0, 0x3e, 0x61, 0x7f, 0x60, 0x3e, 0x0, 
-0xe, 0x18, 0x18, 0x3c, 0x18, 0x18, 0x3c, 0x0, 0xe, 0x18, 0x18, 0x3c, 0x18, 0x18, 0x3c, 0x0, 
-0x0, 0x0, 0x3e, 0x60, 0x63, 0x63, 0x3d, 0x0, 0x0, 0x0, 0x3e, 0x60, 0x63, 0x63, 0x3d, 0x0, 
-0x60, 0x60, 0x6e, 0x73, 0x63, 0x66, 0x67, 0x0, 0x60, 0x60, 0x6e, 0x73, 0x63, 0x66, 0x67, 0x0, 
-0x0, 0x0, 0x1e, 0xc, 0xc, 0xc, 0x1e, 0x0, 0x0, 0x0, 0x1e, 0xc, 0xc, 0xc, 0x1e, 0x0, 
-0x0, 0x0, 0x3f, 0x6, 0x6, 0x6, 0x66, 0x3c, 0x0, 0x0, 0x3f, 0x6, 0x6, 0x6, 0x66, 0x3c, 
-0x60, 0x60, 0x66, 0x6e, 0x7c, 0x67, 0x63, 0x0, 0x60, 0x60, 0x66, 0x6e, 0x7c, 0x67, 0x63, 0x0, 
-0x1c, 0xc, 0xc, 0xc, 0xc, 0xc, 0x1e, 0x0, 0x1c, 0xc, 0xc, 0xc, 0xc, 0xc, 0x1e, 0x0, 
-0x0, 0x0, 0x6e, 0x7f, 0x6b, 0x62, 0x67, 0x0, 0x0, 0x0, 0x6e, 0x7f, 0x6b, 0x62, 0x67, 0x0, 
-0x0, 0x0, 0x6e, 0x73, 0x63, 0x66, 0x67, 0x0, 0x0, 0x0, 0x6e, 0x73, 0x63, 0x66, 0x67, 0x0, 
-0x0, 0x0, 0x3e, 0x63, 0x63, 0x63, 0x3e, 0x0, 0x0, 0x0, 0x3e, 0x63, 0x63, 0x63, 0x3e, 0x0, 
-0x0, 0x0, 0x3e, 0x63, 0x73, 0x6e, 0x60, 0x60, 0x0, 0x0, 0x3e, 0x63, 0x73, 0x6e, 0x60, 0x60, 
-0x0, 0x0, 0x3e, 0x63, 0x67, 0x3b, 0x3, 0x3, 0x0, 0x0, 0x3e, 0x63, 0x67, 0x3b, 0x3, 0x3, 
-0x0, 0x0, 0x6e, 0x73, 0x63, 0x7e, 0x63, 0x0, 0x0, 0x0, 0x6e, 0x73, 0x63, 0x7e, 0x63, 0x0, 
-0x0, 0x0, 0x3e, 0x71, 0x1c, 0x47, 0x3e, 0x0, 0x0, 0x0, 0x3e, 0x71, 0x1c, 0x47, 0x3e, 0x0, 
-0x6, 0xc, 0x3f, 0x18, 0x18, 0x1b, 0xe, 0x0, 0x6, 0xc, 0x3f, 0x18, 0x18, 0x1b, 0xe, 0x0, 
-0x0, 0x0, 0x73, 0x33, 0x63, 0x67, 0x3b, 0x0, 0x0, 0x0, 0x73, 0x33, 0x63, 0x67, 0x3b, 0x0, 
-0x0, 0x0, 0x73, 0x33, 0x63, 0x66, 0x3c, 0x0, 0x0, 0x0, 0x73, 0x33, 0x63, 0x66, 0x3c, 0x0, 
-0x0, 0x0, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x0, 0x0, 0x0, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x0, 
-0x0, 0x0, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x0, 0x0, 0x0, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x0, 
-0x0, 0x0, 0x33, 0x63, 0x63, 0x3f, 0x3, 0x3e, 0x0, 0x0, 0x33, 0x63, 0x63, 0x3f, 0x3, 0x3e, 
-0x0, 0x0, 0x7f, 0xe, 0x1c, 0x38, 0x7f, 0x0, 0x0, 0x0, 0x7f, 0xe, 0x1c, 0x38, 0x7f, 0x0, 
-0x3c, 0x42, 0x99, 0xa1, 0xa1, 0x99, 0x42, 0x3c, 0x3c, 0x42, 0x99, 0xa1, 0xa1, 0x99, 0x42, 0x3c, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-
-};
+unsigned char dump_nestest[24592] =
+"\x4e\x45\x53\x1a\x01\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4c\xf5\xc5\x60\x78\xd8\xa2\xff\x9a\xad\x02\x20\x10\xfb\xad\x02"
+"\x20\x10\xfb\xa9\x00\x8d\x00\x20\x8d\x01\x20\x8d\x05\x20\x8d\x05\x20\xad\x02\x20\xa2\x20\x8e\x06\x20\xa2\x00\x8e\x06\x20\xa2\x00"
+"\xa0\x0f\xa9\x00\x8d\x07\x20\xca\xd0\xfa\x88\xd0\xf7\xa9\x3f\x8d\x06\x20\xa9\x00\x8d\x06\x20\xa2\x00\xbd\x78\xff\x8d\x07\x20\xe8"
+"\xe0\x20\xd0\xf5\xa9\xc0\x8d\x17\x40\xa9\x00\x8d\x15\x40\xa9\x78\x85\xd0\xa9\xfb\x85\xd1\xa9\x7f\x85\xd3\xa0\x00\x8c\x06\x20\x8c"
+"\x06\x20\xa9\x00\x85\xd7\xa9\x07\x85\xd0\xa9\xc3\x85\xd1\x20\xa7\xc2\x20\x8d\xc2\xa2\x12\x20\x61\xc2\xa5\xd5\x4a\x4a\x4a\xb0\x1c"
+"\x4a\xb0\x0c\x4a\xb0\x27\x4a\xb0\x03\x4c\x81\xc0\x4c\x26\xc1\x20\x6f\xc6\xc6\xd7\x10\xdb\xa9\x0d\x85\xd7\xd0\xd5\x20\x6f\xc6\xe6"
+"\xd7\xa5\xd7\xc9\x0e\x90\xca\xa9\x00\x85\xd7\xf0\xc4\x20\x89\xc6\xa5\xd7\xf0\x06\x20\xed\xc0\x4c\x81\xc0\xa9\x00\x85\xd8\xe6\xd7"
+"\x20\xed\xc0\xe6\xd7\xa5\xd7\xc9\x0e\xd0\xf5\xa9\x00\x85\xd7\xa5\xd8\xf0\x02\xa9\xff\x85\x00\x20\xed\xc1\x4c\x81\xc0\xa5\xd7\x0a"
+"\xaa\xbd\x0a\xc1\x8d\x00\x02\xbd\x0b\xc1\x8d\x01\x02\xa9\xc1\x48\xa9\xde\x48\xa9\x00\x85\x00\x6c\x00\x02\x2d\xc7\x2d\xc7\xdb\xc7"
+"\x85\xc8\xde\xcb\xf8\xcd\xee\xce\xa2\xcf\x74\xd1\xfb\xd4\xd4\xc1\x4a\xdf\xb8\xdb\xaa\xe1\xa9\x00\x85\xd7\xa9\x92\x85\xd0\xa9\xc4"
+"\x85\xd1\x20\xa7\xc2\x20\x8d\xc2\xa2\x0f\x20\x61\xc2\xa5\xd5\x4a\x4a\x4a\xb0\x1c\x4a\xb0\x0c\x4a\xb0\x27\x4a\xb0\x03\x4c\x35\xc1"
+"\x4c\x72\xc0\x20\x6f\xc6\xc6\xd7\x10\xdb\xa9\x0a\x85\xd7\xd0\xd5\x20\x6f\xc6\xe6\xd7\xa5\xd7\xc9\x0b\x90\xca\xa9\x00\x85\xd7\xf0"
+"\xc4\x20\x89\xc6\xa5\xd7\xf0\x06\x20\xa1\xc1\x4c\x35\xc1\xa9\x00\x85\xd8\xe6\xd7\x20\xa1\xc1\xe6\xd7\xa5\xd7\xc9\x0b\xd0\xf5\xa9"
+"\x00\x85\xd7\xa5\xd8\xf0\x02\xa9\xff\x85\x00\x20\xed\xc1\x4c\x35\xc1\xa5\xd7\x0a\xaa\xbd\xbe\xc1\x8d\x00\x02\xbd\xbf\xc1\x8d\x01"
+"\x02\xa9\xc1\x48\xa9\xde\x48\xa9\x00\x85\x00\x6c\x00\x02\xa3\xc6\xa3\xc6\x1e\xe5\x3d\xe7\xd3\xe8\x16\xe9\x86\xeb\xf6\xed\x66\xf0"
+"\xd6\xf2\x46\xf5\xa9\x00\x85\x00\x20\x00\xd9\x20\xe0\xda\xea\xea\xea\xa5\x00\xf0\x02\x85\xd8\x4c\xed\xc1\x4c\x81\xc0\x20\x8d\xc2"
+"\xa9\x00\x85\xd3\xa5\xd7\x18\x69\x04\x0a\x26\xd3\x0a\x26\xd3\x0a\x26\xd3\x0a\x26\xd3\x0a\x26\xd3\x48\xa5\xd3\x09\x20\x8d\x06\x20"
+"\x68\x09\x04\x8d\x06\x20\xa5\x00\xf0\x1d\xc9\xff\xf0\x26\x4a\x4a\x4a\x4a\xaa\xbd\x51\xc2\x8d\x07\x20\xa5\x00\x29\x0f\xaa\xbd\x51"
+"\xc2\x8d\x07\x20\x4c\x94\xc2\xa9\x4f\x8d\x07\x20\xa9\x4b\x8d\x07\x20\x4c\x94\xc2\xa9\x45\x8d\x07\x20\xa9\x72\x8d\x07\x20\x4c\x94"
+"\xc2\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x41\x42\x43\x44\x45\x46\xa5\xd7\x18\x69\x04\xa8\xa9\x84\x8d\x00\x20\xa9\x20\x8d\x06"
+"\x20\xa9\x02\x8d\x06\x20\xa9\x20\x88\xc8\xd0\x02\xa9\x2a\x8d\x07\x20\x88\xca\xd0\xf1\xa9\x80\x8d\x00\x20\x4c\x94\xc2\xa5\xd2\xc5"
+"\xd2\xf0\xfc\x60\xa9\x00\x8d\x05\x20\x8d\x05\x20\xa9\x00\x8d\x06\x20\xa9\x00\x8d\x06\x20\x60\xa9\x00\x8d\x00\x20\x8d\x01\x20\x20"
+"\xed\xc2\xa9\x20\x8d\x06\x20\xa0\x00\x8c\x06\x20\xa2\x20\xb1\xd0\xf0\x20\xc9\xff\xf0\x0d\x8d\x07\x20\xc8\xd0\x02\xe6\xd1\xca\xd0"
+"\xed\xf0\xe9\xc8\xd0\x02\xe6\xd1\xa9\x20\x8d\x07\x20\xca\xd0\xf8\xf0\xda\xa9\x80\x8d\x00\x20\xa9\x0e\x8d\x01\x20\x60\xa9\x20\x8d"
+"\x06\x20\xa9\x00\x8d\x06\x20\xa2\x1e\xa9\x20\xa0\x20\x8d\x07\x20\x88\xd0\xfa\xca\xd0\xf5\x60\xff\xff\xff\xff\x20\x20\x20\x20\x2d"
+"\x2d\x20\x52\x75\x6e\x20\x61\x6c\x6c\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x42\x72\x61\x6e\x63\x68\x20\x74\x65"
+"\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x46\x6c\x61\x67\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x49\x6d\x6d"
+"\x65\x64\x69\x61\x74\x65\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x49\x6d\x70\x6c\x69\x65\x64\x20\x74\x65\x73\x74"
+"\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x53\x74\x61\x63\x6b\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x41\x63\x63\x75"
+"\x6d\x75\x6c\x61\x74\x6f\x72\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x28\x49\x6e\x64\x69\x72\x65\x63\x74\x2c\x58"
+"\x29\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x5a\x65\x72\x6f\x70\x61\x67\x65\x20\x74\x65\x73\x74\x73\xff\x20\x20"
+"\x20\x20\x2d\x2d\x20\x41\x62\x73\x6f\x6c\x75\x74\x65\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x28\x49\x6e\x64\x69"
+"\x72\x65\x63\x74\x29\x2c\x59\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x41\x62\x73\x6f\x6c\x75\x74\x65\x2c\x59\x20"
+"\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x5a\x65\x72\x6f\x70\x61\x67\x65\x2c\x58\x20\x74\x65\x73\x74\x73\xff\x20\x20"
+"\x20\x20\x2d\x2d\x20\x41\x62\x73\x6f\x6c\x75\x74\x65\x2c\x58\x20\x74\x65\x73\x74\x73\xff\xff\xff\x20\x20\x20\x20\x55\x70\x2f\x44"
+"\x6f\x77\x6e\x3a\x20\x73\x65\x6c\x65\x63\x74\x20\x74\x65\x73\x74\xff\x20\x20\x20\x20\x20\x20\x53\x74\x61\x72\x74\x3a\x20\x72\x75"
+"\x6e\x20\x74\x65\x73\x74\xff\x20\x20\x20\x20\x20\x53\x65\x6c\x65\x63\x74\x3a\x20\x49\x6e\x76\x61\x6c\x69\x64\x20\x6f\x70\x73\x21"
+"\xff\x00\xff\xff\xff\xff\x20\x20\x20\x20\x2d\x2d\x20\x52\x75\x6e\x20\x61\x6c\x6c\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d"
+"\x2d\x20\x4e\x4f\x50\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x4c\x41\x58\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20"
+"\x20\x2d\x2d\x20\x53\x41\x58\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x53\x42\x43\x20\x74\x65\x73\x74\x20\x28\x6f"
+"\x70\x63\x6f\x64\x65\x20\x30\x45\x42\x68\x29\xff\x20\x20\x20\x20\x2d\x2d\x20\x44\x43\x50\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20"
+"\x20\x2d\x2d\x20\x49\x53\x42\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x53\x4c\x4f\x20\x74\x65\x73\x74\x73\xff\x20"
+"\x20\x20\x20\x2d\x2d\x20\x52\x4c\x41\x20\x74\x65\x73\x74\x73\xff\x20\x20\x20\x20\x2d\x2d\x20\x53\x52\x45\x20\x74\x65\x73\x74\x73"
+"\xff\x20\x20\x20\x20\x2d\x2d\x20\x52\x52\x41\x20\x74\x65\x73\x74\x73\xff\xff\xff\xff\xff\xff\x20\x20\x20\x20\x55\x70\x2f\x44\x6f"
+"\x77\x6e\x3a\x20\x73\x65\x6c\x65\x63\x74\x20\x74\x65\x73\x74\xff\x20\x20\x20\x20\x20\x20\x53\x74\x61\x72\x74\x3a\x20\x72\x75\x6e"
+"\x20\x74\x65\x73\x74\xff\x20\x20\x20\x20\x20\x53\x65\x6c\x65\x63\x74\x3a\x20\x4e\x6f\x72\x6d\x61\x6c\x20\x6f\x70\x73\xff\x00\x48"
+"\x8a\x48\xad\x02\x20\xa9\x20\x8d\x06\x20\xa9\x40\x8d\x06\x20\xe6\xd2\xa9\x00\x8d\x05\x20\x8d\x05\x20\xa9\x00\x8d\x06\x20\xa9\x00"
+"\x8d\x06\x20\xa2\x09\x8e\x16\x40\xca\x8e\x16\x40\xad\x16\x40\x4a\x26\xd4\xca\xd0\xf7\xa5\xd4\xaa\x45\xd6\x25\xd4\x85\xd5\x86\xd6"
+"\x68\xaa\x68\x40\x40\xa2\x00\x86\x00\x86\x10\x86\x11\x20\x2d\xc7\x20\xdb\xc7\x20\x85\xc8\x20\xde\xcb\x20\xf8\xcd\x20\xee\xce\x20"
+"\xa2\xcf\x20\x74\xd1\x20\xfb\xd4\x20\x00\xd9\xa5\x00\x85\x10\xa9\x00\x85\x00\x20\xe0\xda\x20\x4a\xdf\x20\xb8\xdb\x20\xaa\xe1\x20"
+"\xa3\xc6\x20\x1e\xe5\x20\x3d\xe7\x20\xd3\xe8\x20\x16\xe9\x20\x86\xeb\x20\xf6\xed\x20\x66\xf0\x20\xd6\xf2\xa5\x00\x85\x11\xa9\x00"
+"\x85\x00\x20\x46\xf5\xa5\x00\x05\x10\x05\x11\xf0\x0e\x20\x6f\xc6\xa6\x00\x86\x02\xa6\x10\x86\x03\x4c\x6e\xc6\x20\x89\xc6\x60\xa9"
+"\x03\x8d\x15\x40\xa9\x87\x8d\x00\x40\xa9\x89\x8d\x01\x40\xa9\xf0\x8d\x02\x40\xa9\x00\x8d\x03\x40\x60\xa9\x02\x8d\x15\x40\xa9\x3f"
+"\x8d\x04\x40\xa9\x9a\x8d\x05\x40\xa9\xff\x8d\x06\x40\xa9\x00\x8d\x07\x40\x60\xa0\x4e\xa9\xff\x85\x01\x20\xb0\xc6\x20\xb7\xc6\x60"
+"\xa9\xff\x48\xa9\xaa\xd0\x05\xa9\x34\x48\xa9\x55\x28\x04\xa9\x44\xa9\x64\xa9\xea\xea\xea\xea\x08\x48\x0c\xa9\xa9\xea\xea\xea\xea"
+"\x08\x48\x14\xa9\x34\xa9\x54\xa9\x74\xa9\xd4\xa9\xf4\xa9\xea\xea\xea\xea\x08\x48\x1a\x3a\x5a\x7a\xda\xfa\x80\x89\xea\xea\xea\xea"
+"\x08\x48\x1c\xa9\xa9\x3c\xa9\xa9\x5c\xa9\xa9\x7c\xa9\xa9\xdc\xa9\xa9\xfc\xa9\xa9\xea\xea\xea\xea\x08\x48\xa2\x05\x68\xc9\x55\xf0"
+"\x0a\xc9\xaa\xf0\x06\x68\x84\x00\x4c\x28\xc7\x68\x29\xcb\xc9\x00\xf0\x06\xc9\xcb\xf0\x02\x84\x00\xc8\xca\xd0\xe0\x60\xea\x38\xb0"
+"\x04\xa2\x01\x86\x00\xea\x18\xb0\x03\x4c\x40\xc7\xa2\x02\x86\x00\xea\x38\x90\x03\x4c\x4b\xc7\xa2\x03\x86\x00\xea\x18\x90\x04\xa2"
+"\x04\x86\x00\xea\xa9\x00\xf0\x04\xa2\x05\x86\x00\xea\xa9\x40\xf0\x03\x4c\x68\xc7\xa2\x06\x86\x00\xea\xa9\x40\xd0\x04\xa2\x07\x86"
+"\x00\xea\xa9\x00\xd0\x03\x4c\x7d\xc7\xa2\x08\x86\x00\xea\xa9\xff\x85\x01\x24\x01\x70\x04\xa2\x09\x86\x00\xea\x24\x01\x50\x03\x4c"
+"\x96\xc7\xa2\x0a\x86\x00\xea\xa9\x00\x85\x01\x24\x01\x50\x04\xa2\x0b\x86\x00\xea\x24\x01\x70\x03\x4c\xaf\xc7\xa2\x0c\x86\x00\xea"
+"\xa9\x00\x10\x04\xa2\x0d\x86\x00\xea\xa9\x80\x10\x03\x4c\xd9\xc7\xa2\x0e\x86\x00\xea\xa9\x80\x30\x04\xa2\x0f\x86\x00\xea\xa9\x00"
+"\x30\x03\x4c\xd9\xc7\xa2\x10\x86\x00\xea\x60\xea\xa9\xff\x85\x01\x24\x01\xa9\x00\x38\x78\xf8\x08\x68\x29\xef\xc9\x6f\xf0\x04\xa2"
+"\x11\x86\x00\xea\xa9\x40\x85\x01\x24\x01\xd8\xa9\x10\x18\x08\x68\x29\xef\xc9\x64\xf0\x04\xa2\x12\x86\x00\xea\xa9\x80\x85\x01\x24"
+"\x01\xf8\xa9\x00\x38\x08\x68\x29\xef\xc9\x2f\xf0\x04\xa2\x13\x86\x00\xea\xa9\xff\x48\x28\xd0\x09\x10\x07\x50\x05\x90\x03\x4c\x35"
+"\xc8\xa2\x14\x86\x00\xea\xa9\x04\x48\x28\xf0\x09\x30\x07\x70\x05\xb0\x03\x4c\x49\xc8\xa2\x15\x86\x00\xea\xf8\xa9\xff\x85\x01\x24"
+"\x01\x18\xa9\x00\x48\xa9\xff\x68\xd0\x09\x30\x07\x50\x05\xb0\x03\x4c\x67\xc8\xa2\x16\x86\x00\xea\xa9\x00\x85\x01\x24\x01\x38\xa9"
+"\xff\x48\xa9\x00\x68\xf0\x09\x10\x07\x70\x05\x90\x03\x4c\x84\xc8\xa2\x17\x86\x00\x60\xea\x18\xa9\xff\x85\x01\x24\x01\xa9\x55\x09"
+"\xaa\xb0\x0b\x10\x09\xc9\xff\xd0\x05\x50\x03\x4c\xa2\xc8\xa2\x18\x86\x00\xea\x38\xb8\xa9\x00\x09\x00\xd0\x09\x70\x07\x90\x05\x30"
+"\x03\x4c\xb8\xc8\xa2\x19\x86\x00\xea\x18\x24\x01\xa9\x55\x29\xaa\xd0\x09\x50\x07\xb0\x05\x30\x03\x4c\xcf\xc8\xa2\x1a\x86\x00\xea"
+"\x38\xb8\xa9\xf8\x29\xef\x90\x0b\x10\x09\xc9\xe8\xd0\x05\x70\x03\x4c\xe7\xc8\xa2\x1b\x86\x00\xea\x18\x24\x01\xa9\x5f\x49\xaa\xb0"
+"\x0b\x10\x09\xc9\xf5\xd0\x05\x50\x03\x4c\x00\xc9\xa2\x1c\x86\x00\xea\x38\xb8\xa9\x70\x49\x70\xd0\x09\x70\x07\x90\x05\x30\x03\x4c"
+"\x16\xc9\xa2\x1d\x86\x00\xea\x18\x24\x01\xa9\x00\x69\x69\x30\x0b\xb0\x09\xc9\x69\xd0\x05\x70\x03\x4c\x2f\xc9\xa2\x1e\x86\x00\xea"
+"\x38\xf8\x24\x01\xa9\x01\x69\x69\x30\x0b\xb0\x09\xc9\x6b\xd0\x05\x70\x03\x4c\x49\xc9\xa2\x1f\x86\x00\xea\xd8\x38\xb8\xa9\x7f\x69"
+"\x7f\x10\x0b\xb0\x09\xc9\xff\xd0\x05\x50\x03\x4c\x62\xc9\xa2\x20\x86\x00\xea\x18\x24\x01\xa9\x7f\x69\x80\x10\x0b\xb0\x09\xc9\xff"
+"\xd0\x05\x70\x03\x4c\x7b\xc9\xa2\x21\x86\x00\xea\x38\xb8\xa9\x7f\x69\x80\xd0\x09\x30\x07\x70\x05\x90\x03\x4c\x91\xc9\xa2\x22\x86"
+"\x00\xea\x38\xb8\xa9\x9f\xf0\x09\x10\x07\x70\x05\x90\x03\x4c\xa5\xc9\xa2\x23\x86\x00\xea\x18\x24\x01\xa9\x00\xd0\x09\x30\x07\x50"
+"\x05\xb0\x03\x4c\xba\xc9\xa2\x23\x86\x00\xea\x24\x01\xa9\x40\xc9\x40\x30\x09\x90\x07\xd0\x05\x50\x03\x4c\xd0\xc9\xa2\x24\x86\x00"
+"\xea\xb8\xc9\x3f\xf0\x09\x30\x07\x90\x05\x70\x03\x4c\xe3\xc9\xa2\x25\x86\x00\xea\xc9\x41\xf0\x07\x10\x05\x10\x03\x4c\xf3\xc9\xa2"
+"\x26\x86\x00\xea\xa9\x80\xc9\x00\xf0\x07\x10\x05\x90\x03\x4c\x05\xca\xa2\x27\x86\x00\xea\xc9\x80\xd0\x07\x30\x05\x90\x03\x4c\x15"
+"\xca\xa2\x28\x86\x00\xea\xc9\x81\xb0\x07\xf0\x05\x10\x03\x4c\x25\xca\xa2\x29\x86\x00\xea\xc9\x7f\x90\x07\xf0\x05\x30\x03\x4c\x35"
+"\xca\xa2\x2a\x86\x00\xea\x24\x01\xa0\x40\xc0\x40\xd0\x09\x30\x07\x90\x05\x50\x03\x4c\x4b\xca\xa2\x2b\x86\x00\xea\xb8\xc0\x3f\xf0"
+"\x09\x30\x07\x90\x05\x70\x03\x4c\x5e\xca\xa2\x2c\x86\x00\xea\xc0\x41\xf0\x07\x10\x05\x10\x03\x4c\x6e\xca\xa2\x2d\x86\x00\xea\xa0"
+"\x80\xc0\x00\xf0\x07\x10\x05\x90\x03\x4c\x80\xca\xa2\x2e\x86\x00\xea\xc0\x80\xd0\x07\x30\x05\x90\x03\x4c\x90\xca\xa2\x2f\x86\x00"
+"\xea\xc0\x81\xb0\x07\xf0\x05\x10\x03\x4c\xa0\xca\xa2\x30\x86\x00\xea\xc0\x7f\x90\x07\xf0\x05\x30\x03\x4c\xb0\xca\xa2\x31\x86\x00"
+"\xea\x24\x01\xa2\x40\xe0\x40\xd0\x09\x30\x07\x90\x05\x50\x03\x4c\xc6\xca\xa9\x32\x85\x00\xea\xb8\xe0\x3f\xf0\x09\x30\x07\x90\x05"
+"\x70\x03\x4c\xd9\xca\xa9\x33\x85\x00\xea\xe0\x41\xf0\x07\x10\x05\x10\x03\x4c\xe9\xca\xa9\x34\x85\x00\xea\xa2\x80\xe0\x00\xf0\x07"
+"\x10\x05\x90\x03\x4c\xfb\xca\xa9\x35\x85\x00\xea\xe0\x80\xd0\x07\x30\x05\x90\x03\x4c\x0b\xcb\xa9\x36\x85\x00\xea\xe0\x81\xb0\x07"
+"\xf0\x05\x10\x03\x4c\x1b\xcb\xa9\x37\x85\x00\xea\xe0\x7f\x90\x07\xf0\x05\x30\x03\x4c\x2b\xcb\xa9\x38\x85\x00\xea\x38\xb8\xa2\x9f"
+"\xf0\x09\x10\x07\x70\x05\x90\x03\x4c\x3f\xcb\xa2\x39\x86\x00\xea\x18\x24\x01\xa2\x00\xd0\x09\x30\x07\x50\x05\xb0\x03\x4c\x54\xcb"
+"\xa2\x3a\x86\x00\xea\x38\xb8\xa0\x9f\xf0\x09\x10\x07\x70\x05\x90\x03\x4c\x68\xcb\xa2\x3b\x86\x00\xea\x18\x24\x01\xa0\x00\xd0\x09"
+"\x30\x07\x50\x05\xb0\x03\x4c\x7d\xcb\xa2\x3c\x86\x00\xea\xa9\x55\xa2\xaa\xa0\x33\xc9\x55\xd0\x23\xe0\xaa\xd0\x1f\xc0\x33\xd0\x1b"
+"\xc9\x55\xd0\x17\xe0\xaa\xd0\x13\xc0\x33\xd0\x0f\xc9\x56\xf0\x0b\xe0\xab\xf0\x07\xc0\x34\xf0\x03\x4c\xaf\xcb\xa2\x3d\x86\x00\xa0"
+"\x71\x20\x31\xf9\xe9\x40\x20\x37\xf9\xc8\x20\x47\xf9\xe9\x3f\x20\x4c\xf9\xc8\x20\x5c\xf9\xe9\x41\x20\x62\xf9\xc8\x20\x72\xf9\xe9"
+"\x00\x20\x76\xf9\xc8\x20\x80\xf9\xe9\x7f\x20\x84\xf9\x60\xea\xa9\xff\x85\x01\xa9\x44\xa2\x55\xa0\x66\xe8\x88\xe0\x56\xd0\x21\xc0"
+"\x65\xd0\x1d\xe8\xe8\x88\x88\xe0\x58\xd0\x15\xc0\x63\xd0\x11\xca\xc8\xe0\x57\xd0\x0b\xc0\x64\xd0\x07\xc9\x44\xd0\x03\x4c\x14\xcc"
+"\xa2\x3e\x86\x00\xea\x38\xa2\x69\xa9\x96\x24\x01\xa0\xff\xc8\xd0\x3d\x30\x3b\x90\x39\x50\x37\xc0\x00\xd0\x33\xc8\xf0\x30\x30\x2e"
+"\x90\x2c\x50\x2a\x18\xb8\xa0\x00\x88\xf0\x23\x10\x21\xb0\x1f\x70\x1d\xc0\xff\xd0\x19\x18\x88\xf0\x15\x10\x13\xb0\x11\x70\x0f\xc0"
+"\xfe\xd0\x0b\xc9\x96\xd0\x07\xe0\x69\xd0\x03\x4c\x62\xcc\xa2\x3f\x86\x00\xea\x38\xa0\x69\xa9\x96\x24\x01\xa2\xff\xe8\xd0\x3d\x30"
+"\x3b\x90\x39\x50\x37\xe0\x00\xd0\x33\xe8\xf0\x30\x30\x2e\x90\x2c\x50\x2a\x18\xb8\xa2\x00\xca\xf0\x23\x10\x21\xb0\x1f\x70\x1d\xe0"
+"\xff\xd0\x19\x18\xca\xf0\x15\x10\x13\xb0\x11\x70\x0f\xe0\xfe\xd0\x0b\xc9\x96\xd0\x07\xc0\x69\xd0\x03\x4c\xb0\xcc\xa2\x40\x86\x00"
+"\xea\xa9\x85\xa2\x34\xa0\x99\x18\x24\x01\xa8\xf0\x2e\xb0\x2c\x50\x2a\x10\x28\xc9\x85\xd0\x24\xe0\x34\xd0\x20\xc0\x85\xd0\x1c\xa9"
+"\x00\x38\xb8\xa8\xd0\x15\x90\x13\x70\x11\x30\x0f\xc9\x00\xd0\x0b\xe0\x34\xd0\x07\xc0\x00\xd0\x03\x4c\xef\xcc\xa2\x41\x86\x00\xea"
+"\xa9\x85\xa2\x34\xa0\x99\x18\x24\x01\xaa\xf0\x2e\xb0\x2c\x50\x2a\x10\x28\xc9\x85\xd0\x24\xe0\x85\xd0\x20\xc0\x99\xd0\x1c\xa9\x00"
+"\x38\xb8\xaa\xd0\x15\x90\x13\x70\x11\x30\x0f\xc9\x00\xd0\x0b\xe0\x00\xd0\x07\xc0\x99\xd0\x03\x4c\x2e\xcd\xa2\x42\x86\x00\xea\xa9"
+"\x85\xa2\x34\xa0\x99\x18\x24\x01\x98\xf0\x2e\xb0\x2c\x50\x2a\x10\x28\xc9\x99\xd0\x24\xe0\x34\xd0\x20\xc0\x99\xd0\x1c\xa0\x00\x38"
+"\xb8\x98\xd0\x15\x90\x13\x70\x11\x30\x0f\xc9\x00\xd0\x0b\xe0\x34\xd0\x07\xc0\x00\xd0\x03\x4c\x6d\xcd\xa2\x43\x86\x00\xea\xa9\x85"
+"\xa2\x34\xa0\x99\x18\x24\x01\x8a\xf0\x2e\xb0\x2c\x50\x2a\x30\x28\xc9\x34\xd0\x24\xe0\x34\xd0\x20\xc0\x99\xd0\x1c\xa2\x00\x38\xb8"
+"\x8a\xd0\x15\x90\x13\x70\x11\x30\x0f\xc9\x00\xd0\x0b\xe0\x00\xd0\x07\xc0\x99\xd0\x03\x4c\xac\xcd\xa2\x44\x86\x00\xea\xba\x8e\xff"
+"\x07\xa0\x33\xa2\x69\xa9\x84\x18\x24\x01\x9a\xf0\x32\x10\x30\xb0\x2e\x50\x2c\xc9\x84\xd0\x28\xe0\x69\xd0\x24\xc0\x33\xd0\x20\xa0"
+"\x01\xa9\x04\x38\xb8\xa2\x00\xba\xf0\x15\x30\x13\x90\x11\x70\x0f\xe0\x69\xd0\x0b\xc9\x04\xd0\x07\xc0\x01\xd0\x03\x4c\xf3\xcd\xa2"
+"\x45\x86\x00\xae\xff\x07\x9a\x60\xa9\xff\x85\x01\xba\x8e\xff\x07\xea\xa2\x80\x9a\xa9\x33\x48\xa9\x69\x48\xba\xe0\x7e\xd0\x20\x68"
+"\xc9\x69\xd0\x1b\x68\xc9\x33\xd0\x16\xba\xe0\x80\xd0\x11\xad\x80\x01\xc9\x33\xd0\x0a\xad\x7f\x01\xc9\x69\xd0\x03\x4c\x33\xce\xa2"
+"\x46\x86\x00\xea\xa2\x80\x9a\x20\x3d\xce\x4c\x5b\xce\xba\xe0\x7e\xd0\x19\x68\x68\xba\xe0\x80\xd0\x12\xa9\x00\x20\x4e\xce\x68\xc9"
+"\x4d\xd0\x08\x68\xc9\xce\xd0\x03\x4c\x5f\xce\xa2\x47\x86\x00\xea\xa9\xce\x48\xa9\x66\x48\x60\xa2\x77\xa0\x69\x18\x24\x01\xa9\x83"
+"\x20\x66\xce\xf0\x24\x10\x22\xb0\x20\x50\x1e\xc9\x83\xd0\x1a\xc0\x69\xd0\x16\xe0\x77\xd0\x12\x38\xb8\xa9\x00\x20\x66\xce\xd0\x09"
+"\x30\x07\x90\x05\x70\x03\x4c\x9d\xce\xa2\x48\x86\x00\xea\xa9\xce\x48\xa9\xae\x48\xa9\x65\x48\xa9\x55\xa0\x88\xa2\x99\x40\x30\x35"
+"\x50\x33\xf0\x31\x90\x2f\xc9\x55\xd0\x2b\xc0\x88\xd0\x27\xe0\x99\xd0\x23\xa9\xce\x48\xa9\xce\x48\xa9\x87\x48\xa9\x55\x40\x10\x15"
+"\x70\x13\xd0\x11\x90\x0f\xc9\x55\xd0\x0b\xc0\x88\xd0\x07\xe0\x99\xd0\x03\x4c\xe9\xce\xa2\x49\x86\x00\xae\xff\x07\x9a\x60\xa2\x55"
+"\xa0\x69\xa9\xff\x85\x01\xea\x24\x01\x38\xa9\x01\x4a\x90\x1d\xd0\x1b\x30\x19\x50\x17\xc9\x00\xd0\x13\xb8\xa9\xaa\x4a\xb0\x0d\xf0"
+"\x0b\x30\x09\x70\x07\xc9\x55\xd0\x03\x4c\x20\xcf\xa2\x4a\x86\x00\xea\x24\x01\x38\xa9\x80\x0a\x90\x1e\xd0\x1c\x30\x1a\x50\x18\xc9"
+"\x00\xd0\x14\xb8\x38\xa9\x55\x0a\xb0\x0d\xf0\x0b\x10\x09\x70\x07\xc9\xaa\xd0\x03\x4c\x4b\xcf\xa2\x4b\x86\x00\xea\x24\x01\x38\xa9"
+"\x01\x6a\x90\x1e\xf0\x1c\x10\x1a\x50\x18\xc9\x80\xd0\x14\xb8\x18\xa9\x55\x6a\x90\x0d\xf0\x0b\x30\x09\x70\x07\xc9\x2a\xd0\x03\x4c"
+"\x76\xcf\xa2\x4c\x86\x00\xea\x24\x01\x38\xa9\x80\x2a\x90\x1e\xf0\x1c\x30\x1a\x50\x18\xc9\x01\xd0\x14\xb8\x18\xa9\x55\x2a\xb0\x0d"
+"\xf0\x0b\x10\x09\x70\x07\xc9\xaa\xd0\x03\x4c\xa1\xcf\xa2\x4d\x86\x00\x60\xa5\x00\x8d\xff\x07\xa9\x00\x85\x80\xa9\x02\x85\x81\xa9"
+"\xff\x85\x01\xa9\x00\x85\x82\xa9\x03\x85\x83\x85\x84\xa9\x00\x85\xff\xa9\x04\x85\x00\xa9\x5a\x8d\x00\x02\xa9\x5b\x8d\x00\x03\xa9"
+"\x5c\x8d\x03\x03\xa9\x5d\x8d\x00\x04\xa2\x00\xa1\x80\xc9\x5a\xd0\x1f\xe8\xe8\xa1\x80\xc9\x5b\xd0\x17\xe8\xa1\x80\xc9\x5c\xd0\x10"
+"\xa2\x00\xa1\xff\xc9\x5d\xd0\x08\xa2\x81\xa1\xff\xc9\x5a\xf0\x05\xa9\x58\x8d\xff\x07\xa9\xaa\xa2\x00\x81\x80\xe8\xe8\xa9\xab\x81"
+"\x80\xe8\xa9\xac\x81\x80\xa2\x00\xa9\xad\x81\xff\xad\x00\x02\xc9\xaa\xd0\x15\xad\x00\x03\xc9\xab\xd0\x0e\xad\x03\x03\xc9\xac\xd0"
+"\x07\xad\x00\x04\xc9\xad\xf0\x05\xa9\x59\x8d\xff\x07\xad\xff\x07\x85\x00\xa9\x00\x8d\x00\x03\xa9\xaa\x8d\x00\x02\xa2\x00\xa0\x5a"
+"\x20\xb6\xf7\x01\x80\x20\xc0\xf7\xc8\x20\xce\xf7\x01\x82\x20\xd3\xf7\xc8\x20\xdf\xf7\x21\x80\x20\xe5\xf7\xc8\xa9\xef\x8d\x00\x03"
+"\x20\xf1\xf7\x21\x82\x20\xf6\xf7\xc8\x20\x04\xf8\x41\x80\x20\x0a\xf8\xc8\xa9\x70\x8d\x00\x03\x20\x18\xf8\x41\x82\x20\x1d\xf8\xc8"
+"\xa9\x69\x8d\x00\x02\x20\x29\xf8\x61\x80\x20\x2f\xf8\xc8\x20\x3d\xf8\x61\x80\x20\x43\xf8\xc8\xa9\x7f\x8d\x00\x02\x20\x51\xf8\x61"
+"\x80\x20\x56\xf8\xc8\xa9\x80\x8d\x00\x02\x20\x64\xf8\x61\x80\x20\x6a\xf8\xc8\x20\x78\xf8\x61\x80\x20\x7d\xf8\xc8\xa9\x40\x8d\x00"
+"\x02\x20\x89\xf8\xc1\x80\x20\x8e\xf8\xc8\x48\xa9\x3f\x8d\x00\x02\x68\x20\x9a\xf8\xc1\x80\x20\x9c\xf8\xc8\x48\xa9\x41\x8d\x00\x02"
+"\x68\xc1\x80\x20\xa8\xf8\xc8\x48\xa9\x00\x8d\x00\x02\x68\x20\xb2\xf8\xc1\x80\x20\xb5\xf8\xc8\x48\xa9\x80\x8d\x00\x02\x68\xc1\x80"
+"\x20\xbf\xf8\xc8\x48\xa9\x81\x8d\x00\x02\x68\xc1\x80\x20\xc9\xf8\xc8\x48\xa9\x7f\x8d\x00\x02\x68\xc1\x80\x20\xd3\xf8\xc8\xa9\x40"
+"\x8d\x00\x02\x20\x31\xf9\xe1\x80\x20\x37\xf9\xc8\xa9\x3f\x8d\x00\x02\x20\x47\xf9\xe1\x80\x20\x4c\xf9\xc8\xa9\x41\x8d\x00\x02\x20"
+"\x5c\xf9\xe1\x80\x20\x62\xf9\xc8\xa9\x00\x8d\x00\x02\x20\x72\xf9\xe1\x80\x20\x76\xf9\xc8\xa9\x7f\x8d\x00\x02\x20\x80\xf9\xe1\x80"
+"\x20\x84\xf9\x60\xa9\x55\x85\x78\xa9\xff\x85\x01\x24\x01\xa0\x11\xa2\x23\xa9\x00\xa5\x78\xf0\x10\x30\x0e\xc9\x55\xd0\x0a\xc0\x11"
+"\xd0\x06\xe0\x23\x50\x02\xf0\x04\xa9\x76\x85\x00\xa9\x46\x24\x01\x85\x78\xf0\x0a\x10\x08\x50\x06\xa5\x78\xc9\x46\xf0\x04\xa9\x77"
+"\x85\x00\xa9\x55\x85\x78\x24\x01\xa9\x11\xa2\x23\xa0\x00\xa4\x78\xf0\x10\x30\x0e\xc0\x55\xd0\x0a\xc9\x11\xd0\x06\xe0\x23\x50\x02"
+"\xf0\x04\xa9\x78\x85\x00\xa0\x46\x24\x01\x84\x78\xf0\x0a\x10\x08\x50\x06\xa4\x78\xc0\x46\xf0\x04\xa9\x79\x85\x00\x24\x01\xa9\x55"
+"\x85\x78\xa0\x11\xa9\x23\xa2\x00\xa6\x78\xf0\x10\x30\x0e\xe0\x55\xd0\x0a\xc0\x11\xd0\x06\xc9\x23\x50\x02\xf0\x04\xa9\x7a\x85\x00"
+"\xa2\x46\x24\x01\x86\x78\xf0\x0a\x10\x08\x50\x06\xa6\x78\xe0\x46\xf0\x04\xa9\x7b\x85\x00\xa9\xc0\x85\x78\xa2\x33\xa0\x88\xa9\x05"
+"\x24\x78\x10\x10\x50\x0e\xd0\x0c\xc9\x05\xd0\x08\xe0\x33\xd0\x04\xc0\x88\xf0\x04\xa9\x7c\x85\x00\xa9\x03\x85\x78\xa9\x01\x24\x78"
+"\x30\x08\x70\x06\xf0\x04\xc9\x01\xf0\x04\xa9\x7d\x85\x00\xa0\x7e\xa9\xaa\x85\x78\x20\xb6\xf7\x05\x78\x20\xc0\xf7\xc8\xa9\x00\x85"
+"\x78\x20\xce\xf7\x05\x78\x20\xd3\xf7\xc8\xa9\xaa\x85\x78\x20\xdf\xf7\x25\x78\x20\xe5\xf7\xc8\xa9\xef\x85\x78\x20\xf1\xf7\x25\x78"
+"\x20\xf6\xf7\xc8\xa9\xaa\x85\x78\x20\x04\xf8\x45\x78\x20\x0a\xf8\xc8\xa9\x70\x85\x78\x20\x18\xf8\x45\x78\x20\x1d\xf8\xc8\xa9\x69"
+"\x85\x78\x20\x29\xf8\x65\x78\x20\x2f\xf8\xc8\x20\x3d\xf8\x65\x78\x20\x43\xf8\xc8\xa9\x7f\x85\x78\x20\x51\xf8\x65\x78\x20\x56\xf8"
+"\xc8\xa9\x80\x85\x78\x20\x64\xf8\x65\x78\x20\x6a\xf8\xc8\x20\x78\xf8\x65\x78\x20\x7d\xf8\xc8\xa9\x40\x85\x78\x20\x89\xf8\xc5\x78"
+"\x20\x8e\xf8\xc8\x48\xa9\x3f\x85\x78\x68\x20\x9a\xf8\xc5\x78\x20\x9c\xf8\xc8\x48\xa9\x41\x85\x78\x68\xc5\x78\x20\xa8\xf8\xc8\x48"
+"\xa9\x00\x85\x78\x68\x20\xb2\xf8\xc5\x78\x20\xb5\xf8\xc8\x48\xa9\x80\x85\x78\x68\xc5\x78\x20\xbf\xf8\xc8\x48\xa9\x81\x85\x78\x68"
+"\xc5\x78\x20\xc9\xf8\xc8\x48\xa9\x7f\x85\x78\x68\xc5\x78\x20\xd3\xf8\xc8\xa9\x40\x85\x78\x20\x31\xf9\xe5\x78\x20\x37\xf9\xc8\xa9"
+"\x3f\x85\x78\x20\x47\xf9\xe5\x78\x20\x4c\xf9\xc8\xa9\x41\x85\x78\x20\x5c\xf9\xe5\x78\x20\x62\xf9\xc8\xa9\x00\x85\x78\x20\x72\xf9"
+"\xe5\x78\x20\x76\xf9\xc8\xa9\x7f\x85\x78\x20\x80\xf9\xe5\x78\x20\x84\xf9\xc8\xa9\x40\x85\x78\x20\x89\xf8\xaa\xe4\x78\x20\x8e\xf8"
+"\xc8\xa9\x3f\x85\x78\x20\x9a\xf8\xe4\x78\x20\x9c\xf8\xc8\xa9\x41\x85\x78\xe4\x78\x20\xa8\xf8\xc8\xa9\x00\x85\x78\x20\xb2\xf8\xaa"
+"\xe4\x78\x20\xb5\xf8\xc8\xa9\x80\x85\x78\xe4\x78\x20\xbf\xf8\xc8\xa9\x81\x85\x78\xe4\x78\x20\xc9\xf8\xc8\xa9\x7f\x85\x78\xe4\x78"
+"\x20\xd3\xf8\xc8\x98\xaa\xa9\x40\x85\x78\x20\xdd\xf8\xc4\x78\x20\xe2\xf8\xe8\xa9\x3f\x85\x78\x20\xee\xf8\xc4\x78\x20\xf0\xf8\xe8"
+"\xa9\x41\x85\x78\xc4\x78\x20\xfc\xf8\xe8\xa9\x00\x85\x78\x20\x06\xf9\xc4\x78\x20\x09\xf9\xe8\xa9\x80\x85\x78\xc4\x78\x20\x13\xf9"
+"\xe8\xa9\x81\x85\x78\xc4\x78\x20\x1d\xf9\xe8\xa9\x7f\x85\x78\xc4\x78\x20\x27\xf9\xe8\x8a\xa8\x20\x90\xf9\x85\x78\x46\x78\xa5\x78"
+"\x20\x9d\xf9\xc8\x85\x78\x46\x78\xa5\x78\x20\xad\xf9\xc8\x20\xbd\xf9\x85\x78\x06\x78\xa5\x78\x20\xc3\xf9\xc8\x85\x78\x06\x78\xa5"
+"\x78\x20\xd4\xf9\xc8\x20\xe4\xf9\x85\x78\x66\x78\xa5\x78\x20\xea\xf9\xc8\x85\x78\x66\x78\xa5\x78\x20\xfb\xf9\xc8\x20\x0a\xfa\x85"
+"\x78\x26\x78\xa5\x78\x20\x10\xfa\xc8\x85\x78\x26\x78\xa5\x78\x20\x21\xfa\xa9\xff\x85\x78\x85\x01\x24\x01\x38\xe6\x78\xd0\x0c\x30"
+"\x0a\x50\x08\x90\x06\xa5\x78\xc9\x00\xf0\x04\xa9\xab\x85\x00\xa9\x7f\x85\x78\xb8\x18\xe6\x78\xf0\x0c\x10\x0a\x70\x08\xb0\x06\xa5"
+"\x78\xc9\x80\xf0\x04\xa9\xac\x85\x00\xa9\x00\x85\x78\x24\x01\x38\xc6\x78\xf0\x0c\x10\x0a\x50\x08\x90\x06\xa5\x78\xc9\xff\xf0\x04"
+"\xa9\xad\x85\x00\xa9\x80\x85\x78\xb8\x18\xc6\x78\xf0\x0c\x30\x0a\x70\x08\xb0\x06\xa5\x78\xc9\x7f\xf0\x04\xa9\xae\x85\x00\xa9\x01"
+"\x85\x78\xc6\x78\xf0\x04\xa9\xaf\x85\x00\x60\xa9\x55\x8d\x78\x06\xa9\xff\x85\x01\x24\x01\xa0\x11\xa2\x23\xa9\x00\xad\x78\x06\xf0"
+"\x10\x30\x0e\xc9\x55\xd0\x0a\xc0\x11\xd0\x06\xe0\x23\x50\x02\xf0\x04\xa9\xb0\x85\x00\xa9\x46\x24\x01\x8d\x78\x06\xf0\x0b\x10\x09"
+"\x50\x07\xad\x78\x06\xc9\x46\xf0\x04\xa9\xb1\x85\x00\xa9\x55\x8d\x78\x06\x24\x01\xa9\x11\xa2\x23\xa0\x00\xac\x78\x06\xf0\x10\x30"
+"\x0e\xc0\x55\xd0\x0a\xc9\x11\xd0\x06\xe0\x23\x50\x02\xf0\x04\xa9\xb2\x85\x00\xa0\x46\x24\x01\x8c\x78\x06\xf0\x0b\x10\x09\x50\x07"
+"\xac\x78\x06\xc0\x46\xf0\x04\xa9\xb3\x85\x00\x24\x01\xa9\x55\x8d\x78\x06\xa0\x11\xa9\x23\xa2\x00\xae\x78\x06\xf0\x10\x30\x0e\xe0"
+"\x55\xd0\x0a\xc0\x11\xd0\x06\xc9\x23\x50\x02\xf0\x04\xa9\xb4\x85\x00\xa2\x46\x24\x01\x8e\x78\x06\xf0\x0b\x10\x09\x50\x07\xae\x78"
+"\x06\xe0\x46\xf0\x04\xa9\xb5\x85\x00\xa9\xc0\x8d\x78\x06\xa2\x33\xa0\x88\xa9\x05\x2c\x78\x06\x10\x10\x50\x0e\xd0\x0c\xc9\x05\xd0"
+"\x08\xe0\x33\xd0\x04\xc0\x88\xf0\x04\xa9\xb6\x85\x00\xa9\x03\x8d\x78\x06\xa9\x01\x2c\x78\x06\x30\x08\x70\x06\xf0\x04\xc9\x01\xf0"
+"\x04\xa9\xb7\x85\x00\xa0\xb8\xa9\xaa\x8d\x78\x06\x20\xb6\xf7\x0d\x78\x06\x20\xc0\xf7\xc8\xa9\x00\x8d\x78\x06\x20\xce\xf7\x0d\x78"
+"\x06\x20\xd3\xf7\xc8\xa9\xaa\x8d\x78\x06\x20\xdf\xf7\x2d\x78\x06\x20\xe5\xf7\xc8\xa9\xef\x8d\x78\x06\x20\xf1\xf7\x2d\x78\x06\x20"
+"\xf6\xf7\xc8\xa9\xaa\x8d\x78\x06\x20\x04\xf8\x4d\x78\x06\x20\x0a\xf8\xc8\xa9\x70\x8d\x78\x06\x20\x18\xf8\x4d\x78\x06\x20\x1d\xf8"
+"\xc8\xa9\x69\x8d\x78\x06\x20\x29\xf8\x6d\x78\x06\x20\x2f\xf8\xc8\x20\x3d\xf8\x6d\x78\x06\x20\x43\xf8\xc8\xa9\x7f\x8d\x78\x06\x20"
+"\x51\xf8\x6d\x78\x06\x20\x56\xf8\xc8\xa9\x80\x8d\x78\x06\x20\x64\xf8\x6d\x78\x06\x20\x6a\xf8\xc8\x20\x78\xf8\x6d\x78\x06\x20\x7d"
+"\xf8\xc8\xa9\x40\x8d\x78\x06\x20\x89\xf8\xcd\x78\x06\x20\x8e\xf8\xc8\x48\xa9\x3f\x8d\x78\x06\x68\x20\x9a\xf8\xcd\x78\x06\x20\x9c"
+"\xf8\xc8\x48\xa9\x41\x8d\x78\x06\x68\xcd\x78\x06\x20\xa8\xf8\xc8\x48\xa9\x00\x8d\x78\x06\x68\x20\xb2\xf8\xcd\x78\x06\x20\xb5\xf8"
+"\xc8\x48\xa9\x80\x8d\x78\x06\x68\xcd\x78\x06\x20\xbf\xf8\xc8\x48\xa9\x81\x8d\x78\x06\x68\xcd\x78\x06\x20\xc9\xf8\xc8\x48\xa9\x7f"
+"\x8d\x78\x06\x68\xcd\x78\x06\x20\xd3\xf8\xc8\xa9\x40\x8d\x78\x06\x20\x31\xf9\xed\x78\x06\x20\x37\xf9\xc8\xa9\x3f\x8d\x78\x06\x20"
+"\x47\xf9\xed\x78\x06\x20\x4c\xf9\xc8\xa9\x41\x8d\x78\x06\x20\x5c\xf9\xed\x78\x06\x20\x62\xf9\xc8\xa9\x00\x8d\x78\x06\x20\x72\xf9"
+"\xed\x78\x06\x20\x76\xf9\xc8\xa9\x7f\x8d\x78\x06\x20\x80\xf9\xed\x78\x06\x20\x84\xf9\xc8\xa9\x40\x8d\x78\x06\x20\x89\xf8\xaa\xec"
+"\x78\x06\x20\x8e\xf8\xc8\xa9\x3f\x8d\x78\x06\x20\x9a\xf8\xec\x78\x06\x20\x9c\xf8\xc8\xa9\x41\x8d\x78\x06\xec\x78\x06\x20\xa8\xf8"
+"\xc8\xa9\x00\x8d\x78\x06\x20\xb2\xf8\xaa\xec\x78\x06\x20\xb5\xf8\xc8\xa9\x80\x8d\x78\x06\xec\x78\x06\x20\xbf\xf8\xc8\xa9\x81\x8d"
+"\x78\x06\xec\x78\x06\x20\xc9\xf8\xc8\xa9\x7f\x8d\x78\x06\xec\x78\x06\x20\xd3\xf8\xc8\x98\xaa\xa9\x40\x8d\x78\x06\x20\xdd\xf8\xcc"
+"\x78\x06\x20\xe2\xf8\xe8\xa9\x3f\x8d\x78\x06\x20\xee\xf8\xcc\x78\x06\x20\xf0\xf8\xe8\xa9\x41\x8d\x78\x06\xcc\x78\x06\x20\xfc\xf8"
+"\xe8\xa9\x00\x8d\x78\x06\x20\x06\xf9\xcc\x78\x06\x20\x09\xf9\xe8\xa9\x80\x8d\x78\x06\xcc\x78\x06\x20\x13\xf9\xe8\xa9\x81\x8d\x78"
+"\x06\xcc\x78\x06\x20\x1d\xf9\xe8\xa9\x7f\x8d\x78\x06\xcc\x78\x06\x20\x27\xf9\xe8\x8a\xa8\x20\x90\xf9\x8d\x78\x06\x4e\x78\x06\xad"
+"\x78\x06\x20\x9d\xf9\xc8\x8d\x78\x06\x4e\x78\x06\xad\x78\x06\x20\xad\xf9\xc8\x20\xbd\xf9\x8d\x78\x06\x0e\x78\x06\xad\x78\x06\x20"
+"\xc3\xf9\xc8\x8d\x78\x06\x0e\x78\x06\xad\x78\x06\x20\xd4\xf9\xc8\x20\xe4\xf9\x8d\x78\x06\x6e\x78\x06\xad\x78\x06\x20\xea\xf9\xc8"
+"\x8d\x78\x06\x6e\x78\x06\xad\x78\x06\x20\xfb\xf9\xc8\x20\x0a\xfa\x8d\x78\x06\x2e\x78\x06\xad\x78\x06\x20\x10\xfa\xc8\x8d\x78\x06"
+"\x2e\x78\x06\xad\x78\x06\x20\x21\xfa\xa9\xff\x8d\x78\x06\x85\x01\x24\x01\x38\xee\x78\x06\xd0\x0d\x30\x0b\x50\x09\x90\x07\xad\x78"
+"\x06\xc9\x00\xf0\x04\xa9\xe5\x85\x00\xa9\x7f\x8d\x78\x06\xb8\x18\xee\x78\x06\xf0\x0d\x10\x0b\x70\x09\xb0\x07\xad\x78\x06\xc9\x80"
+"\xf0\x04\xa9\xe6\x85\x00\xa9\x00\x8d\x78\x06\x24\x01\x38\xce\x78\x06\xf0\x0d\x10\x0b\x50\x09\x90\x07\xad\x78\x06\xc9\xff\xf0\x04"
+"\xa9\xe7\x85\x00\xa9\x80\x8d\x78\x06\xb8\x18\xce\x78\x06\xf0\x0d\x30\x0b\x70\x09\xb0\x07\xad\x78\x06\xc9\x7f\xf0\x04\xa9\xe8\x85"
+"\x00\xa9\x01\x8d\x78\x06\xce\x78\x06\xf0\x04\xa9\xe9\x85\x00\x60\xa9\xa3\x85\x33\xa9\x89\x8d\x00\x03\xa9\x12\x8d\x45\x02\xa9\xff"
+"\x85\x01\xa2\x65\xa9\x00\x85\x89\xa9\x03\x85\x8a\xa0\x00\x38\xa9\x00\xb8\xb1\x89\xf0\x0c\x90\x0a\x70\x08\xc9\x89\xd0\x04\xe0\x65"
+"\xf0\x04\xa9\xea\x85\x00\xa9\xff\x85\x97\x85\x98\x24\x98\xa0\x34\xb1\x97\xc9\xa3\xd0\x02\xb0\x04\xa9\xeb\x85\x00\xa5\x00\x48\xa9"
+"\x46\x85\xff\xa9\x01\x85\x00\xa0\xff\xb1\xff\xc9\x12\xf0\x04\x68\xa9\xec\x48\x68\x85\x00\xa2\xed\xa9\x00\x85\x33\xa9\x04\x85\x34"
+"\xa0\x00\x18\xa9\xff\x85\x01\x24\x01\xa9\xaa\x8d\x00\x04\xa9\x55\x11\x33\xb0\x08\x10\x06\xc9\xff\xd0\x02\x70\x02\x86\x00\xe8\x38"
+"\xb8\xa9\x00\x11\x33\xf0\x06\x70\x04\x90\x02\x30\x02\x86\x00\xe8\x18\x24\x01\xa9\x55\x31\x33\xd0\x06\x50\x04\xb0\x02\x10\x02\x86"
+"\x00\xe8\x38\xb8\xa9\xef\x8d\x00\x04\xa9\xf8\x31\x33\x90\x08\x10\x06\xc9\xe8\xd0\x02\x50\x02\x86\x00\xe8\x18\x24\x01\xa9\xaa\x8d"
+"\x00\x04\xa9\x5f\x51\x33\xb0\x08\x10\x06\xc9\xf5\xd0\x02\x70\x02\x86\x00\xe8\x38\xb8\xa9\x70\x8d\x00\x04\x51\x33\xd0\x06\x70\x04"
+"\x90\x02\x10\x02\x86\x00\xe8\x18\x24\x01\xa9\x69\x8d\x00\x04\xa9\x00\x71\x33\x30\x08\xb0\x06\xc9\x69\xd0\x02\x50\x02\x86\x00\xe8"
+"\x38\x24\x01\xa9\x00\x71\x33\x30\x08\xb0\x06\xc9\x6a\xd0\x02\x50\x02\x86\x00\xe8\x38\xb8\xa9\x7f\x8d\x00\x04\x71\x33\x10\x08\xb0"
+"\x06\xc9\xff\xd0\x02\x70\x02\x86\x00\xe8\x18\x24\x01\xa9\x80\x8d\x00\x04\xa9\x7f\x71\x33\x10\x08\xb0\x06\xc9\xff\xd0\x02\x50\x02"
+"\x86\x00\xe8\x38\xb8\xa9\x80\x8d\x00\x04\xa9\x7f\x71\x33\xd0\x06\x30\x04\x70\x02\xb0\x02\x86\x00\xe8\x24\x01\xa9\x40\x8d\x00\x04"
+"\xd1\x33\x30\x06\x90\x04\xd0\x02\x70\x02\x86\x00\xe8\xb8\xce\x00\x04\xd1\x33\xf0\x06\x30\x04\x90\x02\x50\x02\x86\x00\xe8\xee\x00"
+"\x04\xee\x00\x04\xd1\x33\xf0\x02\x30\x02\x86\x00\xe8\xa9\x00\x8d\x00\x04\xa9\x80\xd1\x33\xf0\x04\x10\x02\xb0\x02\x86\x00\xe8\xa0"
+"\x80\x8c\x00\x04\xa0\x00\xd1\x33\xd0\x04\x30\x02\xb0\x02\x86\x00\xe8\xee\x00\x04\xd1\x33\xb0\x04\xf0\x02\x30\x02\x86\x00\xe8\xce"
+"\x00\x04\xce\x00\x04\xd1\x33\x90\x04\xf0\x02\x10\x02\x86\x00\x60\xa9\x00\x85\x33\xa9\x04\x85\x34\xa0\x00\xa2\x01\x24\x01\xa9\x40"
+"\x8d\x00\x04\x38\xf1\x33\x30\x0a\x90\x08\xd0\x06\x70\x04\xc9\x00\xf0\x02\x86\x00\xe8\xb8\x38\xa9\x40\xce\x00\x04\xf1\x33\xf0\x0a"
+"\x30\x08\x90\x06\x70\x04\xc9\x01\xf0\x02\x86\x00\xe8\xa9\x40\x38\x24\x01\xee\x00\x04\xee\x00\x04\xf1\x33\xb0\x0a\xf0\x08\x10\x06"
+"\x70\x04\xc9\xff\xf0\x02\x86\x00\xe8\x18\xa9\x00\x8d\x00\x04\xa9\x80\xf1\x33\x90\x04\xc9\x7f\xf0\x02\x86\x00\xe8\x38\xa9\x7f\x8d"
+"\x00\x04\xa9\x81\xf1\x33\x50\x06\x90\x04\xc9\x02\xf0\x02\x86\x00\xe8\xa9\x00\xa9\x87\x91\x33\xad\x00\x04\xc9\x87\xf0\x02\x86\x00"
+"\xe8\xa9\x7e\x8d\x00\x02\xa9\xdb\x8d\x01\x02\x6c\x00\x02\xa9\x00\x8d\xff\x02\xa9\x01\x8d\x00\x03\xa9\x03\x8d\x00\x02\xa9\xa9\x8d"
+"\x00\x01\xa9\x55\x8d\x01\x01\xa9\x60\x8d\x02\x01\xa9\xa9\x8d\x00\x03\xa9\xaa\x8d\x01\x03\xa9\x60\x8d\x02\x03\x20\xb5\xdb\xc9\xaa"
+"\xf0\x02\x86\x00\x60\x6c\xff\x02\xa9\xff\x85\x01\xa9\xaa\x85\x33\xa9\xbb\x85\x89\xa2\x00\xa9\x66\x24\x01\x38\xa0\x00\xb4\x33\x10"
+"\x12\xf0\x10\x50\x0e\x90\x0c\xc9\x66\xd0\x08\xe0\x00\xd0\x04\xc0\xaa\xf0\x04\xa9\x08\x85\x00\xa2\x8a\xa9\x66\xb8\x18\xa0\x00\xb4"
+"\xff\x10\x12\xf0\x10\x70\x0e\xb0\x0c\xc0\xbb\xd0\x08\xc9\x66\xd0\x04\xe0\x8a\xf0\x04\xa9\x09\x85\x00\x24\x01\x38\xa0\x44\xa2\x00"
+"\x94\x33\xa5\x33\x90\x18\xc9\x44\xd0\x14\x50\x12\x18\xb8\xa0\x99\xa2\x80\x94\x85\xa5\x05\xb0\x06\xc9\x99\xd0\x02\x50\x04\xa9\x0a"
+"\x85\x00\xa0\x0b\xa9\xaa\xa2\x78\x85\x78\x20\xb6\xf7\x15\x00\x20\xc0\xf7\xc8\xa9\x00\x85\x78\x20\xce\xf7\x15\x00\x20\xd3\xf7\xc8"
+"\xa9\xaa\x85\x78\x20\xdf\xf7\x35\x00\x20\xe5\xf7\xc8\xa9\xef\x85\x78\x20\xf1\xf7\x35\x00\x20\xf6\xf7\xc8\xa9\xaa\x85\x78\x20\x04"
+"\xf8\x55\x00\x20\x0a\xf8\xc8\xa9\x70\x85\x78\x20\x18\xf8\x55\x00\x20\x1d\xf8\xc8\xa9\x69\x85\x78\x20\x29\xf8\x75\x00\x20\x2f\xf8"
+"\xc8\x20\x3d\xf8\x75\x00\x20\x43\xf8\xc8\xa9\x7f\x85\x78\x20\x51\xf8\x75\x00\x20\x56\xf8\xc8\xa9\x80\x85\x78\x20\x64\xf8\x75\x00"
+"\x20\x6a\xf8\xc8\x20\x78\xf8\x75\x00\x20\x7d\xf8\xc8\xa9\x40\x85\x78\x20\x89\xf8\xd5\x00\x20\x8e\xf8\xc8\x48\xa9\x3f\x85\x78\x68"
+"\x20\x9a\xf8\xd5\x00\x20\x9c\xf8\xc8\x48\xa9\x41\x85\x78\x68\xd5\x00\x20\xa8\xf8\xc8\x48\xa9\x00\x85\x78\x68\x20\xb2\xf8\xd5\x00"
+"\x20\xb5\xf8\xc8\x48\xa9\x80\x85\x78\x68\xd5\x00\x20\xbf\xf8\xc8\x48\xa9\x81\x85\x78\x68\xd5\x00\x20\xc9\xf8\xc8\x48\xa9\x7f\x85"
+"\x78\x68\xd5\x00\x20\xd3\xf8\xc8\xa9\x40\x85\x78\x20\x31\xf9\xf5\x00\x20\x37\xf9\xc8\xa9\x3f\x85\x78\x20\x47\xf9\xf5\x00\x20\x4c"
+"\xf9\xc8\xa9\x41\x85\x78\x20\x5c\xf9\xf5\x00\x20\x62\xf9\xc8\xa9\x00\x85\x78\x20\x72\xf9\xf5\x00\x20\x76\xf9\xc8\xa9\x7f\x85\x78"
+"\x20\x80\xf9\xf5\x00\x20\x84\xf9\xa9\xaa\x85\x33\xa9\xbb\x85\x89\xa2\x00\xa0\x66\x24\x01\x38\xa9\x00\xb5\x33\x10\x12\xf0\x10\x50"
+"\x0e\x90\x0c\xc0\x66\xd0\x08\xe0\x00\xd0\x04\xc9\xaa\xf0\x04\xa9\x22\x85\x00\xa2\x8a\xa0\x66\xb8\x18\xa9\x00\xb5\xff\x10\x12\xf0"
+"\x10\x70\x0e\xb0\x0c\xc9\xbb\xd0\x08\xc0\x66\xd0\x04\xe0\x8a\xf0\x04\xa9\x23\x85\x00\x24\x01\x38\xa9\x44\xa2\x00\x95\x33\xa5\x33"
+"\x90\x18\xc9\x44\xd0\x14\x50\x12\x18\xb8\xa9\x99\xa2\x80\x95\x85\xa5\x05\xb0\x06\xc9\x99\xd0\x02\x50\x04\xa9\x24\x85\x00\xa0\x25"
+"\xa2\x78\x20\x90\xf9\x95\x00\x56\x00\xb5\x00\x20\x9d\xf9\xc8\x95\x00\x56\x00\xb5\x00\x20\xad\xf9\xc8\x20\xbd\xf9\x95\x00\x16\x00"
+"\xb5\x00\x20\xc3\xf9\xc8\x95\x00\x16\x00\xb5\x00\x20\xd4\xf9\xc8\x20\xe4\xf9\x95\x00\x76\x00\xb5\x00\x20\xea\xf9\xc8\x95\x00\x76"
+"\x00\xb5\x00\x20\xfb\xf9\xc8\x20\x0a\xfa\x95\x00\x36\x00\xb5\x00\x20\x10\xfa\xc8\x95\x00\x36\x00\xb5\x00\x20\x21\xfa\xa9\xff\x95"
+"\x00\x85\x01\x24\x01\x38\xf6\x00\xd0\x0c\x30\x0a\x50\x08\x90\x06\xb5\x00\xc9\x00\xf0\x04\xa9\x2d\x85\x00\xa9\x7f\x95\x00\xb8\x18"
+"\xf6\x00\xf0\x0c\x10\x0a\x70\x08\xb0\x06\xb5\x00\xc9\x80\xf0\x04\xa9\x2e\x85\x00\xa9\x00\x95\x00\x24\x01\x38\xd6\x00\xf0\x0c\x10"
+"\x0a\x50\x08\x90\x06\xb5\x00\xc9\xff\xf0\x04\xa9\x2f\x85\x00\xa9\x80\x95\x00\xb8\x18\xd6\x00\xf0\x0c\x30\x0a\x70\x08\xb0\x06\xb5"
+"\x00\xc9\x7f\xf0\x04\xa9\x30\x85\x00\xa9\x01\x95\x00\xd6\x00\xf0\x04\xa9\x31\x85\x00\xa9\x33\x85\x78\xa9\x44\xa0\x78\xa2\x00\x38"
+"\x24\x01\xb6\x00\x90\x12\x50\x10\x30\x0e\xf0\x0c\xe0\x33\xd0\x08\xc0\x78\xd0\x04\xc9\x44\xf0\x04\xa9\x32\x85\x00\xa9\x97\x85\x7f"
+"\xa9\x47\xa0\xff\xa2\x00\x18\xb8\xb6\x80\xb0\x12\x70\x10\x10\x0e\xf0\x0c\xe0\x97\xd0\x08\xc0\xff\xd0\x04\xc9\x47\xf0\x04\xa9\x33"
+"\x85\x00\xa9\x00\x85\x7f\xa9\x47\xa0\xff\xa2\x69\x18\xb8\x96\x80\xb0\x18\x70\x16\x30\x14\xf0\x12\xe0\x69\xd0\x0e\xc0\xff\xd0\x0a"
+"\xc9\x47\xd0\x06\xa5\x7f\xc9\x69\xf0\x04\xa9\x34\x85\x00\xa9\xf5\x85\x4f\xa9\x47\xa0\x4f\x24\x01\xa2\x00\x38\x96\x00\x90\x16\x50"
+"\x14\x30\x12\xd0\x10\xe0\x00\xd0\x0c\xc0\x4f\xd0\x08\xc9\x47\xd0\x04\xa5\x4f\xf0\x04\xa9\x35\x85\x00\x60\xa9\x89\x8d\x00\x03\xa9"
+"\xa3\x85\x33\xa9\x12\x8d\x45\x02\xa2\x65\xa0\x00\x38\xa9\x00\xb8\xb9\x00\x03\xf0\x0c\x90\x0a\x70\x08\xc9\x89\xd0\x04\xe0\x65\xf0"
+"\x04\xa9\x36\x85\x00\xa9\xff\x85\x01\x24\x01\xa0\x34\xb9\xff\xff\xc9\xa3\xd0\x02\xb0\x04\xa9\x37\x85\x00\xa9\x46\x85\xff\xa0\xff"
+"\xb9\x46\x01\xc9\x12\xf0\x04\xa9\x38\x85\x00\xa2\x39\x18\xa9\xff\x85\x01\x24\x01\xa9\xaa\x8d\x00\x04\xa9\x55\xa0\x00\x19\x00\x04"
+"\xb0\x08\x10\x06\xc9\xff\xd0\x02\x70\x02\x86\x00\xe8\x38\xb8\xa9\x00\x19\x00\x04\xf0\x06\x70\x04\x90\x02\x30\x02\x86\x00\xe8\x18"
+"\x24\x01\xa9\x55\x39\x00\x04\xd0\x06\x50\x04\xb0\x02\x10\x02\x86\x00\xe8\x38\xb8\xa9\xef\x8d\x00\x04\xa9\xf8\x39\x00\x04\x90\x08"
+"\x10\x06\xc9\xe8\xd0\x02\x50\x02\x86\x00\xe8\x18\x24\x01\xa9\xaa\x8d\x00\x04\xa9\x5f\x59\x00\x04\xb0\x08\x10\x06\xc9\xf5\xd0\x02"
+"\x70\x02\x86\x00\xe8\x38\xb8\xa9\x70\x8d\x00\x04\x59\x00\x04\xd0\x06\x70\x04\x90\x02\x10\x02\x86\x00\xe8\x18\x24\x01\xa9\x69\x8d"
+"\x00\x04\xa9\x00\x79\x00\x04\x30\x08\xb0\x06\xc9\x69\xd0\x02\x50\x02\x86\x00\xe8\x38\x24\x01\xa9\x00\x79\x00\x04\x30\x08\xb0\x06"
+"\xc9\x6a\xd0\x02\x50\x02\x86\x00\xe8\x38\xb8\xa9\x7f\x8d\x00\x04\x79\x00\x04\x10\x08\xb0\x06\xc9\xff\xd0\x02\x70\x02\x86\x00\xe8"
+"\x18\x24\x01\xa9\x80\x8d\x00\x04\xa9\x7f\x79\x00\x04\x10\x08\xb0\x06\xc9\xff\xd0\x02\x50\x02\x86\x00\xe8\x38\xb8\xa9\x80\x8d\x00"
+"\x04\xa9\x7f\x79\x00\x04\xd0\x06\x30\x04\x70\x02\xb0\x02\x86\x00\xe8\x24\x01\xa9\x40\x8d\x00\x04\xd9\x00\x04\x30\x06\x90\x04\xd0"
+"\x02\x70\x02\x86\x00\xe8\xb8\xce\x00\x04\xd9\x00\x04\xf0\x06\x30\x04\x90\x02\x50\x02\x86\x00\xe8\xee\x00\x04\xee\x00\x04\xd9\x00"
+"\x04\xf0\x02\x30\x02\x86\x00\xe8\xa9\x00\x8d\x00\x04\xa9\x80\xd9\x00\x04\xf0\x04\x10\x02\xb0\x02\x86\x00\xe8\xa0\x80\x8c\x00\x04"
+"\xa0\x00\xd9\x00\x04\xd0\x04\x30\x02\xb0\x02\x86\x00\xe8\xee\x00\x04\xd9\x00\x04\xb0\x04\xf0\x02\x30\x02\x86\x00\xe8\xce\x00\x04"
+"\xce\x00\x04\xd9\x00\x04\x90\x04\xf0\x02\x10\x02\x86\x00\xe8\x24\x01\xa9\x40\x8d\x00\x04\x38\xf9\x00\x04\x30\x0a\x90\x08\xd0\x06"
+"\x70\x04\xc9\x00\xf0\x02\x86\x00\xe8\xb8\x38\xa9\x40\xce\x00\x04\xf9\x00\x04\xf0\x0a\x30\x08\x90\x06\x70\x04\xc9\x01\xf0\x02\x86"
+"\x00\xe8\xa9\x40\x38\x24\x01\xee\x00\x04\xee\x00\x04\xf9\x00\x04\xb0\x0a\xf0\x08\x10\x06\x70\x04\xc9\xff\xf0\x02\x86\x00\xe8\x18"
+"\xa9\x00\x8d\x00\x04\xa9\x80\xf9\x00\x04\x90\x04\xc9\x7f\xf0\x02\x86\x00\xe8\x38\xa9\x7f\x8d\x00\x04\xa9\x81\xf9\x00\x04\x50\x06"
+"\x90\x04\xc9\x02\xf0\x02\x86\x00\xe8\xa9\x00\xa9\x87\x99\x00\x04\xad\x00\x04\xc9\x87\xf0\x02\x86\x00\x60\xa9\xff\x85\x01\xa9\xaa"
+"\x8d\x33\x06\xa9\xbb\x8d\x89\x06\xa2\x00\xa9\x66\x24\x01\x38\xa0\x00\xbc\x33\x06\x10\x12\xf0\x10\x50\x0e\x90\x0c\xc9\x66\xd0\x08"
+"\xe0\x00\xd0\x04\xc0\xaa\xf0\x04\xa9\x51\x85\x00\xa2\x8a\xa9\x66\xb8\x18\xa0\x00\xbc\xff\x05\x10\x12\xf0\x10\x70\x0e\xb0\x0c\xc0"
+"\xbb\xd0\x08\xc9\x66\xd0\x04\xe0\x8a\xf0\x04\xa9\x52\x85\x00\xa0\x53\xa9\xaa\xa2\x78\x8d\x78\x06\x20\xb6\xf7\x1d\x00\x06\x20\xc0"
+"\xf7\xc8\xa9\x00\x8d\x78\x06\x20\xce\xf7\x1d\x00\x06\x20\xd3\xf7\xc8\xa9\xaa\x8d\x78\x06\x20\xdf\xf7\x3d\x00\x06\x20\xe5\xf7\xc8"
+"\xa9\xef\x8d\x78\x06\x20\xf1\xf7\x3d\x00\x06\x20\xf6\xf7\xc8\xa9\xaa\x8d\x78\x06\x20\x04\xf8\x5d\x00\x06\x20\x0a\xf8\xc8\xa9\x70"
+"\x8d\x78\x06\x20\x18\xf8\x5d\x00\x06\x20\x1d\xf8\xc8\xa9\x69\x8d\x78\x06\x20\x29\xf8\x7d\x00\x06\x20\x2f\xf8\xc8\x20\x3d\xf8\x7d"
+"\x00\x06\x20\x43\xf8\xc8\xa9\x7f\x8d\x78\x06\x20\x51\xf8\x7d\x00\x06\x20\x56\xf8\xc8\xa9\x80\x8d\x78\x06\x20\x64\xf8\x7d\x00\x06"
+"\x20\x6a\xf8\xc8\x20\x78\xf8\x7d\x00\x06\x20\x7d\xf8\xc8\xa9\x40\x8d\x78\x06\x20\x89\xf8\xdd\x00\x06\x20\x8e\xf8\xc8\x48\xa9\x3f"
+"\x8d\x78\x06\x68\x20\x9a\xf8\xdd\x00\x06\x20\x9c\xf8\xc8\x48\xa9\x41\x8d\x78\x06\x68\xdd\x00\x06\x20\xa8\xf8\xc8\x48\xa9\x00\x8d"
+"\x78\x06\x68\x20\xb2\xf8\xdd\x00\x06\x20\xb5\xf8\xc8\x48\xa9\x80\x8d\x78\x06\x68\xdd\x00\x06\x20\xbf\xf8\xc8\x48\xa9\x81\x8d\x78"
+"\x06\x68\xdd\x00\x06\x20\xc9\xf8\xc8\x48\xa9\x7f\x8d\x78\x06\x68\xdd\x00\x06\x20\xd3\xf8\xc8\xa9\x40\x8d\x78\x06\x20\x31\xf9\xfd"
+"\x00\x06\x20\x37\xf9\xc8\xa9\x3f\x8d\x78\x06\x20\x47\xf9\xfd\x00\x06\x20\x4c\xf9\xc8\xa9\x41\x8d\x78\x06\x20\x5c\xf9\xfd\x00\x06"
+"\x20\x62\xf9\xc8\xa9\x00\x8d\x78\x06\x20\x72\xf9\xfd\x00\x06\x20\x76\xf9\xc8\xa9\x7f\x8d\x78\x06\x20\x80\xf9\xfd\x00\x06\x20\x84"
+"\xf9\xa9\xaa\x8d\x33\x06\xa9\xbb\x8d\x89\x06\xa2\x00\xa0\x66\x24\x01\x38\xa9\x00\xbd\x33\x06\x10\x12\xf0\x10\x50\x0e\x90\x0c\xc0"
+"\x66\xd0\x08\xe0\x00\xd0\x04\xc9\xaa\xf0\x04\xa9\x6a\x85\x00\xa2\x8a\xa0\x66\xb8\x18\xa9\x00\xbd\xff\x05\x10\x12\xf0\x10\x70\x0e"
+"\xb0\x0c\xc9\xbb\xd0\x08\xc0\x66\xd0\x04\xe0\x8a\xf0\x04\xa9\x6b\x85\x00\x24\x01\x38\xa9\x44\xa2\x00\x9d\x33\x06\xad\x33\x06\x90"
+"\x1a\xc9\x44\xd0\x16\x50\x14\x18\xb8\xa9\x99\xa2\x80\x9d\x85\x05\xad\x05\x06\xb0\x06\xc9\x99\xd0\x02\x50\x04\xa9\x6c\x85\x00\xa0"
+"\x6d\xa2\x6d\x20\x90\xf9\x9d\x00\x06\x5e\x00\x06\xbd\x00\x06\x20\x9d\xf9\xc8\x9d\x00\x06\x5e\x00\x06\xbd\x00\x06\x20\xad\xf9\xc8"
+"\x20\xbd\xf9\x9d\x00\x06\x1e\x00\x06\xbd\x00\x06\x20\xc3\xf9\xc8\x9d\x00\x06\x1e\x00\x06\xbd\x00\x06\x20\xd4\xf9\xc8\x20\xe4\xf9"
+"\x9d\x00\x06\x7e\x00\x06\xbd\x00\x06\x20\xea\xf9\xc8\x9d\x00\x06\x7e\x00\x06\xbd\x00\x06\x20\xfb\xf9\xc8\x20\x0a\xfa\x9d\x00\x06"
+"\x3e\x00\x06\xbd\x00\x06\x20\x10\xfa\xc8\x9d\x00\x06\x3e\x00\x06\xbd\x00\x06\x20\x21\xfa\xa9\xff\x9d\x00\x06\x85\x01\x24\x01\x38"
+"\xfe\x00\x06\xd0\x0d\x30\x0b\x50\x09\x90\x07\xbd\x00\x06\xc9\x00\xf0\x04\xa9\x75\x85\x00\xa9\x7f\x9d\x00\x06\xb8\x18\xfe\x00\x06"
+"\xf0\x0d\x10\x0b\x70\x09\xb0\x07\xbd\x00\x06\xc9\x80\xf0\x04\xa9\x76\x85\x00\xa9\x00\x9d\x00\x06\x24\x01\x38\xde\x00\x06\xf0\x0d"
+"\x10\x0b\x50\x09\x90\x07\xbd\x00\x06\xc9\xff\xf0\x04\xa9\x77\x85\x00\xa9\x80\x9d\x00\x06\xb8\x18\xde\x00\x06\xf0\x0d\x30\x0b\x70"
+"\x09\xb0\x07\xbd\x00\x06\xc9\x7f\xf0\x04\xa9\x78\x85\x00\xa9\x01\x9d\x00\x06\xde\x00\x06\xf0\x04\xa9\x79\x85\x00\xa9\x33\x8d\x78"
+"\x06\xa9\x44\xa0\x78\xa2\x00\x38\x24\x01\xbe\x00\x06\x90\x12\x50\x10\x30\x0e\xf0\x0c\xe0\x33\xd0\x08\xc0\x78\xd0\x04\xc9\x44\xf0"
+"\x04\xa9\x7a\x85\x00\xa9\x97\x8d\x7f\x06\xa9\x47\xa0\xff\xa2\x00\x18\xb8\xbe\x80\x05\xb0\x12\x70\x10\x10\x0e\xf0\x0c\xe0\x97\xd0"
+"\x08\xc0\xff\xd0\x04\xc9\x47\xf0\x04\xa9\x7b\x85\x00\x60\xa9\x55\x8d\x80\x05\xa9\xaa\x8d\x32\x04\xa9\x80\x85\x43\xa9\x05\x85\x44"
+"\xa9\x32\x85\x45\xa9\x04\x85\x46\xa2\x03\xa0\x77\xa9\xff\x85\x01\x24\x01\x38\xa9\x00\xa3\x40\xea\xea\xea\xea\xf0\x12\x30\x10\x50"
+"\x0e\x90\x0c\xc9\x55\xd0\x08\xe0\x55\xd0\x04\xc0\x77\xf0\x04\xa9\x7c\x85\x00\xa2\x05\xa0\x33\xb8\x18\xa9\x00\xa3\x40\xea\xea\xea"
+"\xea\xf0\x12\x10\x10\x70\x0e\xb0\x0c\xc9\xaa\xd0\x08\xe0\xaa\xd0\x04\xc0\x33\xf0\x04\xa9\x7d\x85\x00\xa9\x87\x85\x67\xa9\x32\x85"
+"\x68\xa0\x57\x24\x01\x38\xa9\x00\xa7\x67\xea\xea\xea\xea\xf0\x12\x10\x10\x50\x0e\x90\x0c\xc9\x87\xd0\x08\xe0\x87\xd0\x04\xc0\x57"
+"\xf0\x04\xa9\x7e\x85\x00\xa0\x53\xb8\x18\xa9\x00\xa7\x68\xea\xea\xea\xea\xf0\x12\x30\x10\x70\x0e\xb0\x0c\xc9\x32\xd0\x08\xe0\x32"
+"\xd0\x04\xc0\x53\xf0\x04\xa9\x7f\x85\x00\xa9\x87\x8d\x77\x05\xa9\x32\x8d\x78\x05\xa0\x57\x24\x01\x38\xa9\x00\xaf\x77\x05\xea\xea"
+"\xea\xea\xf0\x12\x10\x10\x50\x0e\x90\x0c\xc9\x87\xd0\x08\xe0\x87\xd0\x04\xc0\x57\xf0\x04\xa9\x80\x85\x00\xa0\x53\xb8\x18\xa9\x00"
+"\xaf\x78\x05\xea\xea\xea\xea\xf0\x12\x30\x10\x70\x0e\xb0\x0c\xc9\x32\xd0\x08\xe0\x32\xd0\x04\xc0\x53\xf0\x04\xa9\x81\x85\x00\xa9"
+"\xff\x85\x43\xa9\x04\x85\x44\xa9\x32\x85\x45\xa9\x04\x85\x46\xa9\x55\x8d\x80\x05\xa9\xaa\x8d\x32\x04\xa2\x03\xa0\x81\x24\x01\x38"
+"\xa9\x00\xb3\x43\xea\xea\xea\xea\xf0\x12\x30\x10\x50\x0e\x90\x0c\xc9\x55\xd0\x08\xe0\x55\xd0\x04\xc0\x81\xf0\x04\xa9\x82\x85\x00"
+"\xa2\x05\xa0\x00\xb8\x18\xa9\x00\xb3\x45\xea\xea\xea\xea\xf0\x12\x10\x10\x70\x0e\xb0\x0c\xc9\xaa\xd0\x08\xe0\xaa\xd0\x04\xc0\x00"
+"\xf0\x04\xa9\x83\x85\x00\xa9\x87\x85\x67\xa9\x32\x85\x68\xa0\x57\x24\x01\x38\xa9\x00\xb7\x10\xea\xea\xea\xea\xf0\x12\x10\x10\x50"
+"\x0e\x90\x0c\xc9\x87\xd0\x08\xe0\x87\xd0\x04\xc0\x57\xf0\x04\xa9\x84\x85\x00\xa0\xff\xb8\x18\xa9\x00\xb7\x69\xea\xea\xea\xea\xf0"
+"\x12\x30\x10\x70\x0e\xb0\x0c\xc9\x32\xd0\x08\xe0\x32\xd0\x04\xc0\xff\xf0\x04\xa9\x85\x85\x00\xa9\x87\x8d\x87\x05\xa9\x32\x8d\x88"
+"\x05\xa0\x30\x24\x01\x38\xa9\x00\xbf\x57\x05\xea\xea\xea\xea\xf0\x12\x10\x10\x50\x0e\x90\x0c\xc9\x87\xd0\x08\xe0\x87\xd0\x04\xc0"
+"\x30\xf0\x04\xa9\x86\x85\x00\xa0\x40\xb8\x18\xa9\x00\xbf\x48\x05\xea\xea\xea\xea\xf0\x12\x30\x10\x70\x0e\xb0\x0c\xc9\x32\xd0\x08"
+"\xe0\x32\xd0\x04\xc0\x40\xf0\x04\xa9\x87\x85\x00\x60\xa9\xc0\x85\x01\xa9\x00\x8d\x89\x04\xa9\x89\x85\x60\xa9\x04\x85\x61\xa0\x44"
+"\xa2\x17\xa9\x3e\x24\x01\x18\x83\x49\xea\xea\xea\xea\xd0\x19\xb0\x17\x50\x15\x10\x13\xc9\x3e\xd0\x0f\xc0\x44\xd0\x0b\xe0\x17\xd0"
+"\x07\xad\x89\x04\xc9\x16\xf0\x04\xa9\x88\x85\x00\xa0\x44\xa2\x7a\xa9\x66\x38\xb8\x83\xe6\xea\xea\xea\xea\xf0\x19\x90\x17\x70\x15"
+"\x30\x13\xc9\x66\xd0\x0f\xc0\x44\xd0\x0b\xe0\x7a\xd0\x07\xad\x89\x04\xc9\x62\xf0\x04\xa9\x89\x85\x00\xa9\xff\x85\x49\xa0\x44\xa2"
+"\xaa\xa9\x55\x24\x01\x18\x87\x49\xea\xea\xea\xea\xf0\x18\xb0\x16\x50\x14\x10\x12\xc9\x55\xd0\x0e\xc0\x44\xd0\x0a\xe0\xaa\xd0\x06"
+"\xa5\x49\xc9\x00\xf0\x04\xa9\x8a\x85\x00\xa9\x00\x85\x56\xa0\x58\xa2\xef\xa9\x66\x38\xb8\x87\x56\xea\xea\xea\xea\xf0\x18\x90\x16"
+"\x70\x14\x30\x12\xc9\x66\xd0\x0e\xc0\x58\xd0\x0a\xe0\xef\xd0\x06\xa5\x56\xc9\x66\xf0\x04\xa9\x8b\x85\x00\xa9\xff\x8d\x49\x05\xa0"
+"\xe5\xa2\xaf\xa9\xf5\x24\x01\x18\x8f\x49\x05\xea\xea\xea\xea\xf0\x19\xb0\x17\x50\x15\x10\x13\xc9\xf5\xd0\x0f\xc0\xe5\xd0\x0b\xe0"
+"\xaf\xd0\x07\xad\x49\x05\xc9\xa5\xf0\x04\xa9\x8c\x85\x00\xa9\x00\x8d\x56\x05\xa0\x58\xa2\xb3\xa9\x97\x38\xb8\x8f\x56\x05\xea\xea"
+"\xea\xea\xf0\x19\x90\x17\x70\x15\x10\x13\xc9\x97\xd0\x0f\xc0\x58\xd0\x0b\xe0\xb3\xd0\x07\xad\x56\x05\xc9\x93\xf0\x04\xa9\x8d\x85"
+"\x00\xa9\xff\x85\x49\xa0\xff\xa2\xaa\xa9\x55\x24\x01\x18\x97\x4a\xea\xea\xea\xea\xf0\x18\xb0\x16\x50\x14\x10\x12\xc9\x55\xd0\x0e"
+"\xc0\xff\xd0\x0a\xe0\xaa\xd0\x06\xa5\x49\xc9\x00\xf0\x04\xa9\x8e\x85\x00\xa9\x00\x85\x56\xa0\x06\xa2\xef\xa9\x66\x38\xb8\x97\x50"
+"\xea\xea\xea\xea\xf0\x18\x90\x16\x70\x14\x30\x12\xc9\x66\xd0\x0e\xc0\x06\xd0\x0a\xe0\xef\xd0\x06\xa5\x56\xc9\x66\xf0\x04\xa9\x8f"
+"\x85\x00\x60\xa0\x90\x20\x31\xf9\xeb\x40\xea\xea\xea\xea\x20\x37\xf9\xc8\x20\x47\xf9\xeb\x3f\xea\xea\xea\xea\x20\x4c\xf9\xc8\x20"
+"\x5c\xf9\xeb\x41\xea\xea\xea\xea\x20\x62\xf9\xc8\x20\x72\xf9\xeb\x00\xea\xea\xea\xea\x20\x76\xf9\xc8\x20\x80\xf9\xeb\x7f\xea\xea"
+"\xea\xea\x20\x84\xf9\x60\xa9\xff\x85\x01\xa0\x95\xa2\x02\xa9\x47\x85\x47\xa9\x06\x85\x48\xa9\xeb\x8d\x47\x06\x20\x31\xfa\xc3\x45"
+"\xea\xea\xea\xea\x20\x37\xfa\xad\x47\x06\xc9\xea\xf0\x02\x84\x00\xc8\xa9\x00\x8d\x47\x06\x20\x42\xfa\xc3\x45\xea\xea\xea\xea\x20"
+"\x47\xfa\xad\x47\x06\xc9\xff\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20\x54\xfa\xc3\x45\xea\xea\xea\xea\x20\x59\xfa\xad\x47\x06"
+"\xc9\x36\xf0\x02\x84\x00\xc8\xa9\xeb\x85\x47\x20\x31\xfa\xc7\x47\xea\xea\xea\xea\x20\x37\xfa\xa5\x47\xc9\xea\xf0\x02\x84\x00\xc8"
+"\xa9\x00\x85\x47\x20\x42\xfa\xc7\x47\xea\xea\xea\xea\x20\x47\xfa\xa5\x47\xc9\xff\xf0\x02\x84\x00\xc8\xa9\x37\x85\x47\x20\x54\xfa"
+"\xc7\x47\xea\xea\xea\xea\x20\x59\xfa\xa5\x47\xc9\x36\xf0\x02\x84\x00\xc8\xa9\xeb\x8d\x47\x06\x20\x31\xfa\xcf\x47\x06\xea\xea\xea"
+"\xea\x20\x37\xfa\xad\x47\x06\xc9\xea\xf0\x02\x84\x00\xc8\xa9\x00\x8d\x47\x06\x20\x42\xfa\xcf\x47\x06\xea\xea\xea\xea\x20\x47\xfa"
+"\xad\x47\x06\xc9\xff\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20\x54\xfa\xcf\x47\x06\xea\xea\xea\xea\x20\x59\xfa\xad\x47\x06\xc9"
+"\x36\xf0\x02\x84\x00\xa9\xeb\x8d\x47\x06\xa9\x48\x85\x45\xa9\x05\x85\x46\xa0\xff\x20\x31\xfa\xd3\x45\xea\xea\x08\x48\xa0\x9e\x68"
+"\x28\x20\x37\xfa\xad\x47\x06\xc9\xea\xf0\x02\x84\x00\xa0\xff\xa9\x00\x8d\x47\x06\x20\x42\xfa\xd3\x45\xea\xea\x08\x48\xa0\x9f\x68"
+"\x28\x20\x47\xfa\xad\x47\x06\xc9\xff\xf0\x02\x84\x00\xa0\xff\xa9\x37\x8d\x47\x06\x20\x54\xfa\xd3\x45\xea\xea\x08\x48\xa0\xa0\x68"
+"\x28\x20\x59\xfa\xad\x47\x06\xc9\x36\xf0\x02\x84\x00\xa0\xa1\xa2\xff\xa9\xeb\x85\x47\x20\x31\xfa\xd7\x48\xea\xea\xea\xea\x20\x37"
+"\xfa\xa5\x47\xc9\xea\xf0\x02\x84\x00\xc8\xa9\x00\x85\x47\x20\x42\xfa\xd7\x48\xea\xea\xea\xea\x20\x47\xfa\xa5\x47\xc9\xff\xf0\x02"
+"\x84\x00\xc8\xa9\x37\x85\x47\x20\x54\xfa\xd7\x48\xea\xea\xea\xea\x20\x59\xfa\xa5\x47\xc9\x36\xf0\x02\x84\x00\xa9\xeb\x8d\x47\x06"
+"\xa0\xff\x20\x31\xfa\xdb\x48\x05\xea\xea\x08\x48\xa0\xa4\x68\x28\x20\x37\xfa\xad\x47\x06\xc9\xea\xf0\x02\x84\x00\xa0\xff\xa9\x00"
+"\x8d\x47\x06\x20\x42\xfa\xdb\x48\x05\xea\xea\x08\x48\xa0\xa5\x68\x28\x20\x47\xfa\xad\x47\x06\xc9\xff\xf0\x02\x84\x00\xa0\xff\xa9"
+"\x37\x8d\x47\x06\x20\x54\xfa\xdb\x48\x05\xea\xea\x08\x48\xa0\xa6\x68\x28\x20\x59\xfa\xad\x47\x06\xc9\x36\xf0\x02\x84\x00\xa0\xa7"
+"\xa2\xff\xa9\xeb\x8d\x47\x06\x20\x31\xfa\xdf\x48\x05\xea\xea\xea\xea\x20\x37\xfa\xad\x47\x06\xc9\xea\xf0\x02\x84\x00\xc8\xa9\x00"
+"\x8d\x47\x06\x20\x42\xfa\xdf\x48\x05\xea\xea\xea\xea\x20\x47\xfa\xad\x47\x06\xc9\xff\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20"
+"\x54\xfa\xdf\x48\x05\xea\xea\xea\xea\x20\x59\xfa\xad\x47\x06\xc9\x36\xf0\x02\x84\x00\x60\xa9\xff\x85\x01\xa0\xaa\xa2\x02\xa9\x47"
+"\x85\x47\xa9\x06\x85\x48\xa9\xeb\x8d\x47\x06\x20\xb1\xfa\xe3\x45\xea\xea\xea\xea\x20\xb7\xfa\xad\x47\x06\xc9\xec\xf0\x02\x84\x00"
+"\xc8\xa9\xff\x8d\x47\x06\x20\xc2\xfa\xe3\x45\xea\xea\xea\xea\x20\xc7\xfa\xad\x47\x06\xc9\x00\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47"
+"\x06\x20\xd4\xfa\xe3\x45\xea\xea\xea\xea\x20\xda\xfa\xad\x47\x06\xc9\x38\xf0\x02\x84\x00\xc8\xa9\xeb\x85\x47\x20\xb1\xfa\xe7\x47"
+"\xea\xea\xea\xea\x20\xb7\xfa\xa5\x47\xc9\xec\xf0\x02\x84\x00\xc8\xa9\xff\x85\x47\x20\xc2\xfa\xe7\x47\xea\xea\xea\xea\x20\xc7\xfa"
+"\xa5\x47\xc9\x00\xf0\x02\x84\x00\xc8\xa9\x37\x85\x47\x20\xd4\xfa\xe7\x47\xea\xea\xea\xea\x20\xda\xfa\xa5\x47\xc9\x38\xf0\x02\x84"
+"\x00\xc8\xa9\xeb\x8d\x47\x06\x20\xb1\xfa\xef\x47\x06\xea\xea\xea\xea\x20\xb7\xfa\xad\x47\x06\xc9\xec\xf0\x02\x84\x00\xc8\xa9\xff"
+"\x8d\x47\x06\x20\xc2\xfa\xef\x47\x06\xea\xea\xea\xea\x20\xc7\xfa\xad\x47\x06\xc9\x00\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20"
+"\xd4\xfa\xef\x47\x06\xea\xea\xea\xea\x20\xda\xfa\xad\x47\x06\xc9\x38\xf0\x02\x84\x00\xa9\xeb\x8d\x47\x06\xa9\x48\x85\x45\xa9\x05"
+"\x85\x46\xa0\xff\x20\xb1\xfa\xf3\x45\xea\xea\x08\x48\xa0\xb3\x68\x28\x20\xb7\xfa\xad\x47\x06\xc9\xec\xf0\x02\x84\x00\xa0\xff\xa9"
+"\xff\x8d\x47\x06\x20\xc2\xfa\xf3\x45\xea\xea\x08\x48\xa0\xb4\x68\x28\x20\xc7\xfa\xad\x47\x06\xc9\x00\xf0\x02\x84\x00\xa0\xff\xa9"
+"\x37\x8d\x47\x06\x20\xd4\xfa\xf3\x45\xea\xea\x08\x48\xa0\xb5\x68\x28\x20\xda\xfa\xad\x47\x06\xc9\x38\xf0\x02\x84\x00\xa0\xb6\xa2"
+"\xff\xa9\xeb\x85\x47\x20\xb1\xfa\xf7\x48\xea\xea\xea\xea\x20\xb7\xfa\xa5\x47\xc9\xec\xf0\x02\x84\x00\xc8\xa9\xff\x85\x47\x20\xc2"
+"\xfa\xf7\x48\xea\xea\xea\xea\x20\xc7\xfa\xa5\x47\xc9\x00\xf0\x02\x84\x00\xc8\xa9\x37\x85\x47\x20\xd4\xfa\xf7\x48\xea\xea\xea\xea"
+"\x20\xda\xfa\xa5\x47\xc9\x38\xf0\x02\x84\x00\xa9\xeb\x8d\x47\x06\xa0\xff\x20\xb1\xfa\xfb\x48\x05\xea\xea\x08\x48\xa0\xb9\x68\x28"
+"\x20\xb7\xfa\xad\x47\x06\xc9\xec\xf0\x02\x84\x00\xa0\xff\xa9\xff\x8d\x47\x06\x20\xc2\xfa\xfb\x48\x05\xea\xea\x08\x48\xa0\xba\x68"
+"\x28\x20\xc7\xfa\xad\x47\x06\xc9\x00\xf0\x02\x84\x00\xa0\xff\xa9\x37\x8d\x47\x06\x20\xd4\xfa\xfb\x48\x05\xea\xea\x08\x48\xa0\xbb"
+"\x68\x28\x20\xda\xfa\xad\x47\x06\xc9\x38\xf0\x02\x84\x00\xa0\xbc\xa2\xff\xa9\xeb\x8d\x47\x06\x20\xb1\xfa\xff\x48\x05\xea\xea\xea"
+"\xea\x20\xb7\xfa\xad\x47\x06\xc9\xec\xf0\x02\x84\x00\xc8\xa9\xff\x8d\x47\x06\x20\xc2\xfa\xff\x48\x05\xea\xea\xea\xea\x20\xc7\xfa"
+"\xad\x47\x06\xc9\x00\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20\xd4\xfa\xff\x48\x05\xea\xea\xea\xea\x20\xda\xfa\xad\x47\x06\xc9"
+"\x38\xf0\x02\x84\x00\x60\xa9\xff\x85\x01\xa0\xbf\xa2\x02\xa9\x47\x85\x47\xa9\x06\x85\x48\xa9\xa5\x8d\x47\x06\x20\x7b\xfa\x03\x45"
+"\xea\xea\xea\xea\x20\x81\xfa\xad\x47\x06\xc9\x4a\xf0\x02\x84\x00\xc8\xa9\x29\x8d\x47\x06\x20\x8c\xfa\x03\x45\xea\xea\xea\xea\x20"
+"\x91\xfa\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20\x9e\xfa\x03\x45\xea\xea\xea\xea\x20\xa4\xfa\xad\x47\x06"
+"\xc9\x6e\xf0\x02\x84\x00\xc8\xa9\xa5\x85\x47\x20\x7b\xfa\x07\x47\xea\xea\xea\xea\x20\x81\xfa\xa5\x47\xc9\x4a\xf0\x02\x84\x00\xc8"
+"\xa9\x29\x85\x47\x20\x8c\xfa\x07\x47\xea\xea\xea\xea\x20\x91\xfa\xa5\x47\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x37\x85\x47\x20\x9e\xfa"
+"\x07\x47\xea\xea\xea\xea\x20\xa4\xfa\xa5\x47\xc9\x6e\xf0\x02\x84\x00\xc8\xa9\xa5\x8d\x47\x06\x20\x7b\xfa\x0f\x47\x06\xea\xea\xea"
+"\xea\x20\x81\xfa\xad\x47\x06\xc9\x4a\xf0\x02\x84\x00\xc8\xa9\x29\x8d\x47\x06\x20\x8c\xfa\x0f\x47\x06\xea\xea\xea\xea\x20\x91\xfa"
+"\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20\x9e\xfa\x0f\x47\x06\xea\xea\xea\xea\x20\xa4\xfa\xad\x47\x06\xc9"
+"\x6e\xf0\x02\x84\x00\xa9\xa5\x8d\x47\x06\xa9\x48\x85\x45\xa9\x05\x85\x46\xa0\xff\x20\x7b\xfa\x13\x45\xea\xea\x08\x48\xa0\xc8\x68"
+"\x28\x20\x81\xfa\xad\x47\x06\xc9\x4a\xf0\x02\x84\x00\xa0\xff\xa9\x29\x8d\x47\x06\x20\x8c\xfa\x13\x45\xea\xea\x08\x48\xa0\xc9\x68"
+"\x28\x20\x91\xfa\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xa0\xff\xa9\x37\x8d\x47\x06\x20\x9e\xfa\x13\x45\xea\xea\x08\x48\xa0\xca\x68"
+"\x28\x20\xa4\xfa\xad\x47\x06\xc9\x6e\xf0\x02\x84\x00\xa0\xcb\xa2\xff\xa9\xa5\x85\x47\x20\x7b\xfa\x17\x48\xea\xea\xea\xea\x20\x81"
+"\xfa\xa5\x47\xc9\x4a\xf0\x02\x84\x00\xc8\xa9\x29\x85\x47\x20\x8c\xfa\x17\x48\xea\xea\xea\xea\x20\x91\xfa\xa5\x47\xc9\x52\xf0\x02"
+"\x84\x00\xc8\xa9\x37\x85\x47\x20\x9e\xfa\x17\x48\xea\xea\xea\xea\x20\xa4\xfa\xa5\x47\xc9\x6e\xf0\x02\x84\x00\xa9\xa5\x8d\x47\x06"
+"\xa0\xff\x20\x7b\xfa\x1b\x48\x05\xea\xea\x08\x48\xa0\xce\x68\x28\x20\x81\xfa\xad\x47\x06\xc9\x4a\xf0\x02\x84\x00\xa0\xff\xa9\x29"
+"\x8d\x47\x06\x20\x8c\xfa\x1b\x48\x05\xea\xea\x08\x48\xa0\xcf\x68\x28\x20\x91\xfa\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xa0\xff\xa9"
+"\x37\x8d\x47\x06\x20\x9e\xfa\x1b\x48\x05\xea\xea\x08\x48\xa0\xd0\x68\x28\x20\xa4\xfa\xad\x47\x06\xc9\x6e\xf0\x02\x84\x00\xa0\xd1"
+"\xa2\xff\xa9\xa5\x8d\x47\x06\x20\x7b\xfa\x1f\x48\x05\xea\xea\xea\xea\x20\x81\xfa\xad\x47\x06\xc9\x4a\xf0\x02\x84\x00\xc8\xa9\x29"
+"\x8d\x47\x06\x20\x8c\xfa\x1f\x48\x05\xea\xea\xea\xea\x20\x91\xfa\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20"
+"\x9e\xfa\x1f\x48\x05\xea\xea\xea\xea\x20\xa4\xfa\xad\x47\x06\xc9\x6e\xf0\x02\x84\x00\x60\xa9\xff\x85\x01\xa0\xd4\xa2\x02\xa9\x47"
+"\x85\x47\xa9\x06\x85\x48\xa9\xa5\x8d\x47\x06\x20\x53\xfb\x23\x45\xea\xea\xea\xea\x20\x59\xfb\xad\x47\x06\xc9\x4a\xf0\x02\x84\x00"
+"\xc8\xa9\x29\x8d\x47\x06\x20\x64\xfb\x23\x45\xea\xea\xea\xea\x20\x69\xfb\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47"
+"\x06\x20\x68\xfa\x23\x45\xea\xea\xea\xea\x20\x6e\xfa\xad\x47\x06\xc9\x6f\xf0\x02\x84\x00\xc8\xa9\xa5\x85\x47\x20\x53\xfb\x27\x47"
+"\xea\xea\xea\xea\x20\x59\xfb\xa5\x47\xc9\x4a\xf0\x02\x84\x00\xc8\xa9\x29\x85\x47\x20\x64\xfb\x27\x47\xea\xea\xea\xea\x20\x69\xfb"
+"\xa5\x47\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x37\x85\x47\x20\x68\xfa\x27\x47\xea\xea\xea\xea\x20\x6e\xfa\xa5\x47\xc9\x6f\xf0\x02\x84"
+"\x00\xc8\xa9\xa5\x8d\x47\x06\x20\x53\xfb\x2f\x47\x06\xea\xea\xea\xea\x20\x59\xfb\xad\x47\x06\xc9\x4a\xf0\x02\x84\x00\xc8\xa9\x29"
+"\x8d\x47\x06\x20\x64\xfb\x2f\x47\x06\xea\xea\xea\xea\x20\x69\xfb\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20"
+"\x68\xfa\x2f\x47\x06\xea\xea\xea\xea\x20\x6e\xfa\xad\x47\x06\xc9\x6f\xf0\x02\x84\x00\xa9\xa5\x8d\x47\x06\xa9\x48\x85\x45\xa9\x05"
+"\x85\x46\xa0\xff\x20\x53\xfb\x33\x45\xea\xea\x08\x48\xa0\xdd\x68\x28\x20\x59\xfb\xad\x47\x06\xc9\x4a\xf0\x02\x84\x00\xa0\xff\xa9"
+"\x29\x8d\x47\x06\x20\x64\xfb\x33\x45\xea\xea\x08\x48\xa0\xde\x68\x28\x20\x69\xfb\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xa0\xff\xa9"
+"\x37\x8d\x47\x06\x20\x68\xfa\x33\x45\xea\xea\x08\x48\xa0\xdf\x68\x28\x20\x6e\xfa\xad\x47\x06\xc9\x6f\xf0\x02\x84\x00\xa0\xe0\xa2"
+"\xff\xa9\xa5\x85\x47\x20\x53\xfb\x37\x48\xea\xea\xea\xea\x20\x59\xfb\xa5\x47\xc9\x4a\xf0\x02\x84\x00\xc8\xa9\x29\x85\x47\x20\x64"
+"\xfb\x37\x48\xea\xea\xea\xea\x20\x69\xfb\xa5\x47\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x37\x85\x47\x20\x68\xfa\x37\x48\xea\xea\xea\xea"
+"\x20\x6e\xfa\xa5\x47\xc9\x6f\xf0\x02\x84\x00\xa9\xa5\x8d\x47\x06\xa0\xff\x20\x53\xfb\x3b\x48\x05\xea\xea\x08\x48\xa0\xe3\x68\x28"
+"\x20\x59\xfb\xad\x47\x06\xc9\x4a\xf0\x02\x84\x00\xa0\xff\xa9\x29\x8d\x47\x06\x20\x64\xfb\x3b\x48\x05\xea\xea\x08\x48\xa0\xe4\x68"
+"\x28\x20\x69\xfb\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xa0\xff\xa9\x37\x8d\x47\x06\x20\x68\xfa\x3b\x48\x05\xea\xea\x08\x48\xa0\xe5"
+"\x68\x28\x20\x6e\xfa\xad\x47\x06\xc9\x6f\xf0\x02\x84\x00\xa0\xe6\xa2\xff\xa9\xa5\x8d\x47\x06\x20\x53\xfb\x3f\x48\x05\xea\xea\xea"
+"\xea\x20\x59\xfb\xad\x47\x06\xc9\x4a\xf0\x02\x84\x00\xc8\xa9\x29\x8d\x47\x06\x20\x64\xfb\x3f\x48\x05\xea\xea\xea\xea\x20\x69\xfb"
+"\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20\x68\xfa\x3f\x48\x05\xea\xea\xea\xea\x20\x6e\xfa\xad\x47\x06\xc9"
+"\x6f\xf0\x02\x84\x00\x60\xa9\xff\x85\x01\xa0\xe9\xa2\x02\xa9\x47\x85\x47\xa9\x06\x85\x48\xa9\xa5\x8d\x47\x06\x20\x1d\xfb\x43\x45"
+"\xea\xea\xea\xea\x20\x23\xfb\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x29\x8d\x47\x06\x20\x2e\xfb\x43\x45\xea\xea\xea\xea\x20"
+"\x33\xfb\xad\x47\x06\xc9\x14\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20\x40\xfb\x43\x45\xea\xea\xea\xea\x20\x46\xfb\xad\x47\x06"
+"\xc9\x1b\xf0\x02\x84\x00\xc8\xa9\xa5\x85\x47\x20\x1d\xfb\x47\x47\xea\xea\xea\xea\x20\x23\xfb\xa5\x47\xc9\x52\xf0\x02\x84\x00\xc8"
+"\xa9\x29\x85\x47\x20\x2e\xfb\x47\x47\xea\xea\xea\xea\x20\x33\xfb\xa5\x47\xc9\x14\xf0\x02\x84\x00\xc8\xa9\x37\x85\x47\x20\x40\xfb"
+"\x47\x47\xea\xea\xea\xea\x20\x46\xfb\xa5\x47\xc9\x1b\xf0\x02\x84\x00\xc8\xa9\xa5\x8d\x47\x06\x20\x1d\xfb\x4f\x47\x06\xea\xea\xea"
+"\xea\x20\x23\xfb\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x29\x8d\x47\x06\x20\x2e\xfb\x4f\x47\x06\xea\xea\xea\xea\x20\x33\xfb"
+"\xad\x47\x06\xc9\x14\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20\x40\xfb\x4f\x47\x06\xea\xea\xea\xea\x20\x46\xfb\xad\x47\x06\xc9"
+"\x1b\xf0\x02\x84\x00\xa9\xa5\x8d\x47\x06\xa9\x48\x85\x45\xa9\x05\x85\x46\xa0\xff\x20\x1d\xfb\x53\x45\xea\xea\x08\x48\xa0\xf2\x68"
+"\x28\x20\x23\xfb\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xa0\xff\xa9\x29\x8d\x47\x06\x20\x2e\xfb\x53\x45\xea\xea\x08\x48\xa0\xf3\x68"
+"\x28\x20\x33\xfb\xad\x47\x06\xc9\x14\xf0\x02\x84\x00\xa0\xff\xa9\x37\x8d\x47\x06\x20\x40\xfb\x53\x45\xea\xea\x08\x48\xa0\xf4\x68"
+"\x28\x20\x46\xfb\xad\x47\x06\xc9\x1b\xf0\x02\x84\x00\xa0\xf5\xa2\xff\xa9\xa5\x85\x47\x20\x1d\xfb\x57\x48\xea\xea\xea\xea\x20\x23"
+"\xfb\xa5\x47\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x29\x85\x47\x20\x2e\xfb\x57\x48\xea\xea\xea\xea\x20\x33\xfb\xa5\x47\xc9\x14\xf0\x02"
+"\x84\x00\xc8\xa9\x37\x85\x47\x20\x40\xfb\x57\x48\xea\xea\xea\xea\x20\x46\xfb\xa5\x47\xc9\x1b\xf0\x02\x84\x00\xa9\xa5\x8d\x47\x06"
+"\xa0\xff\x20\x1d\xfb\x5b\x48\x05\xea\xea\x08\x48\xa0\xf8\x68\x28\x20\x23\xfb\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xa0\xff\xa9\x29"
+"\x8d\x47\x06\x20\x2e\xfb\x5b\x48\x05\xea\xea\x08\x48\xa0\xf9\x68\x28\x20\x33\xfb\xad\x47\x06\xc9\x14\xf0\x02\x84\x00\xa0\xff\xa9"
+"\x37\x8d\x47\x06\x20\x40\xfb\x5b\x48\x05\xea\xea\x08\x48\xa0\xfa\x68\x28\x20\x46\xfb\xad\x47\x06\xc9\x1b\xf0\x02\x84\x00\xa0\xfb"
+"\xa2\xff\xa9\xa5\x8d\x47\x06\x20\x1d\xfb\x5f\x48\x05\xea\xea\xea\xea\x20\x23\xfb\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x29"
+"\x8d\x47\x06\x20\x2e\xfb\x5f\x48\x05\xea\xea\xea\xea\x20\x33\xfb\xad\x47\x06\xc9\x14\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20"
+"\x40\xfb\x5f\x48\x05\xea\xea\xea\xea\x20\x46\xfb\xad\x47\x06\xc9\x1b\xf0\x02\x84\x00\x60\xa9\xff\x85\x01\xa0\x01\xa2\x02\xa9\x47"
+"\x85\x47\xa9\x06\x85\x48\xa9\xa5\x8d\x47\x06\x20\xe9\xfa\x63\x45\xea\xea\xea\xea\x20\xef\xfa\xad\x47\x06\xc9\x52\xf0\x02\x84\x00"
+"\xc8\xa9\x29\x8d\x47\x06\x20\xfa\xfa\x63\x45\xea\xea\xea\xea\x20\xff\xfa\xad\x47\x06\xc9\x14\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47"
+"\x06\x20\x0a\xfb\x63\x45\xea\xea\xea\xea\x20\x10\xfb\xad\x47\x06\xc9\x9b\xf0\x02\x84\x00\xc8\xa9\xa5\x85\x47\x20\xe9\xfa\x67\x47"
+"\xea\xea\xea\xea\x20\xef\xfa\xa5\x47\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x29\x85\x47\x20\xfa\xfa\x67\x47\xea\xea\xea\xea\x20\xff\xfa"
+"\xa5\x47\xc9\x14\xf0\x02\x84\x00\xc8\xa9\x37\x85\x47\x20\x0a\xfb\x67\x47\xea\xea\xea\xea\x20\x10\xfb\xa5\x47\xc9\x9b\xf0\x02\x84"
+"\x00\xc8\xa9\xa5\x8d\x47\x06\x20\xe9\xfa\x6f\x47\x06\xea\xea\xea\xea\x20\xef\xfa\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x29"
+"\x8d\x47\x06\x20\xfa\xfa\x6f\x47\x06\xea\xea\xea\xea\x20\xff\xfa\xad\x47\x06\xc9\x14\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20"
+"\x0a\xfb\x6f\x47\x06\xea\xea\xea\xea\x20\x10\xfb\xad\x47\x06\xc9\x9b\xf0\x02\x84\x00\xa9\xa5\x8d\x47\x06\xa9\x48\x85\x45\xa9\x05"
+"\x85\x46\xa0\xff\x20\xe9\xfa\x73\x45\xea\xea\x08\x48\xa0\x0a\x68\x28\x20\xef\xfa\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xa0\xff\xa9"
+"\x29\x8d\x47\x06\x20\xfa\xfa\x73\x45\xea\xea\x08\x48\xa0\x0b\x68\x28\x20\xff\xfa\xad\x47\x06\xc9\x14\xf0\x02\x84\x00\xa0\xff\xa9"
+"\x37\x8d\x47\x06\x20\x0a\xfb\x73\x45\xea\xea\x08\x48\xa0\x0c\x68\x28\x20\x10\xfb\xad\x47\x06\xc9\x9b\xf0\x02\x84\x00\xa0\x0d\xa2"
+"\xff\xa9\xa5\x85\x47\x20\xe9\xfa\x77\x48\xea\xea\xea\xea\x20\xef\xfa\xa5\x47\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x29\x85\x47\x20\xfa"
+"\xfa\x77\x48\xea\xea\xea\xea\x20\xff\xfa\xa5\x47\xc9\x14\xf0\x02\x84\x00\xc8\xa9\x37\x85\x47\x20\x0a\xfb\x77\x48\xea\xea\xea\xea"
+"\x20\x10\xfb\xa5\x47\xc9\x9b\xf0\x02\x84\x00\xa9\xa5\x8d\x47\x06\xa0\xff\x20\xe9\xfa\x7b\x48\x05\xea\xea\x08\x48\xa0\x10\x68\x28"
+"\x20\xef\xfa\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xa0\xff\xa9\x29\x8d\x47\x06\x20\xfa\xfa\x7b\x48\x05\xea\xea\x08\x48\xa0\x11\x68"
+"\x28\x20\xff\xfa\xad\x47\x06\xc9\x14\xf0\x02\x84\x00\xa0\xff\xa9\x37\x8d\x47\x06\x20\x0a\xfb\x7b\x48\x05\xea\xea\x08\x48\xa0\x12"
+"\x68\x28\x20\x10\xfb\xad\x47\x06\xc9\x9b\xf0\x02\x84\x00\xa0\x13\xa2\xff\xa9\xa5\x8d\x47\x06\x20\xe9\xfa\x7f\x48\x05\xea\xea\xea"
+"\xea\x20\xef\xfa\xad\x47\x06\xc9\x52\xf0\x02\x84\x00\xc8\xa9\x29\x8d\x47\x06\x20\xfa\xfa\x7f\x48\x05\xea\xea\xea\xea\x20\xff\xfa"
+"\xad\x47\x06\xc9\x14\xf0\x02\x84\x00\xc8\xa9\x37\x8d\x47\x06\x20\x0a\xfb\x7f\x48\x05\xea\xea\xea\xea\x20\x10\xfb\xad\x47\x06\xc9"
+"\x9b\xf0\x02\x84\x00\x60\x18\xa9\xff\x85\x01\x24\x01\xa9\x55\x60\xb0\x09\x10\x07\xc9\xff\xd0\x03\x50\x01\x60\x84\x00\x60\x38\xb8"
+"\xa9\x00\x60\xd0\x07\x70\x05\x90\x03\x30\x01\x60\x84\x00\x60\x18\x24\x01\xa9\x55\x60\xd0\x07\x50\x05\xb0\x03\x30\x01\x60\x84\x00"
+"\x60\x38\xb8\xa9\xf8\x60\x90\x09\x10\x07\xc9\xe8\xd0\x03\x70\x01\x60\x84\x00\x60\x18\x24\x01\xa9\x5f\x60\xb0\x09\x10\x07\xc9\xf5"
+"\xd0\x03\x50\x01\x60\x84\x00\x60\x38\xb8\xa9\x70\x60\xd0\x07\x70\x05\x90\x03\x30\x01\x60\x84\x00\x60\x18\x24\x01\xa9\x00\x60\x30"
+"\x09\xb0\x07\xc9\x69\xd0\x03\x70\x01\x60\x84\x00\x60\x38\x24\x01\xa9\x00\x60\x30\x09\xb0\x07\xc9\x6a\xd0\x03\x70\x01\x60\x84\x00"
+"\x60\x38\xb8\xa9\x7f\x60\x10\x09\xb0\x07\xc9\xff\xd0\x03\x50\x01\x60\x84\x00\x60\x18\x24\x01\xa9\x7f\x60\x10\x09\xb0\x07\xc9\xff"
+"\xd0\x03\x70\x01\x60\x84\x00\x60\x38\xb8\xa9\x7f\x60\xd0\x07\x30\x05\x70\x03\x90\x01\x60\x84\x00\x60\x24\x01\xa9\x40\x60\x30\x07"
+"\x90\x05\xd0\x03\x50\x01\x60\x84\x00\x60\xb8\x60\xf0\x07\x30\x05\x90\x03\x70\x01\x60\x84\x00\x60\xf0\x05\x10\x03\x10\x01\x60\x84"
+"\x00\x60\xa9\x80\x60\xf0\x05\x10\x03\x90\x01\x60\x84\x00\x60\xd0\x05\x30\x03\x90\x01\x60\x84\x00\x60\xb0\x05\xf0\x03\x10\x01\x60"
+"\x84\x00\x60\x90\x05\xf0\x03\x30\x01\x60\x84\x00\x60\x24\x01\xa0\x40\x60\x30\x07\x90\x05\xd0\x03\x50\x01\x60\x86\x00\x60\xb8\x60"
+"\xf0\x07\x30\x05\x90\x03\x70\x01\x60\x86\x00\x60\xf0\x05\x10\x03\x10\x01\x60\x86\x00\x60\xa0\x80\x60\xf0\x05\x10\x03\x90\x01\x60"
+"\x86\x00\x60\xd0\x05\x30\x03\x90\x01\x60\x86\x00\x60\xb0\x05\xf0\x03\x10\x01\x60\x86\x00\x60\x90\x05\xf0\x03\x30\x01\x60\x86\x00"
+"\x60\x24\x01\xa9\x40\x38\x60\x30\x0b\x90\x09\xd0\x07\x70\x05\xc9\x00\xd0\x01\x60\x84\x00\x60\xb8\x38\xa9\x40\x60\xf0\x0b\x30\x09"
+"\x90\x07\x70\x05\xc9\x01\xd0\x01\x60\x84\x00\x60\xa9\x40\x38\x24\x01\x60\xb0\x0b\xf0\x09\x10\x07\x70\x05\xc9\xff\xd0\x01\x60\x84"
+"\x00\x60\x18\xa9\x80\x60\x90\x05\xc9\x7f\xd0\x01\x60\x84\x00\x60\x38\xa9\x81\x60\x50\x07\x90\x05\xc9\x02\xd0\x01\x60\x84\x00\x60"
+"\xa2\x55\xa9\xff\x85\x01\xea\x24\x01\x38\xa9\x01\x60\x90\x1b\xd0\x19\x30\x17\x50\x15\xc9\x00\xd0\x11\xb8\xa9\xaa\x60\xb0\x0b\xf0"
+"\x09\x30\x07\x70\x05\xc9\x55\xd0\x01\x60\x84\x00\x60\x24\x01\x38\xa9\x80\x60\x90\x1c\xd0\x1a\x30\x18\x50\x16\xc9\x00\xd0\x12\xb8"
+"\xa9\x55\x38\x60\xb0\x0b\xf0\x09\x10\x07\x70\x05\xc9\xaa\xd0\x01\x60\x84\x00\x60\x24\x01\x38\xa9\x01\x60\x90\x1c\xf0\x1a\x10\x18"
+"\x50\x16\xc9\x80\xd0\x12\xb8\x18\xa9\x55\x60\x90\x0b\xf0\x09\x30\x07\x70\x05\xc9\x2a\xd0\x01\x60\x84\x00\x24\x01\x38\xa9\x80\x60"
+"\x90\x1c\xf0\x1a\x30\x18\x50\x16\xc9\x01\xd0\x12\xb8\x18\xa9\x55\x60\xb0\x0b\xf0\x09\x10\x07\x70\x05\xc9\xaa\xd0\x01\x60\x84\x00"
+"\x60\x24\x01\x18\xa9\x40\x60\x50\x2c\xb0\x2a\x30\x28\xc9\x40\xd0\x24\x60\xb8\x38\xa9\xff\x60\x70\x1c\xd0\x1a\x30\x18\x90\x16\xc9"
+"\xff\xd0\x12\x60\x24\x01\xa9\xf0\x60\x50\x0a\xf0\x08\x10\x06\x90\x04\xc9\xf0\xf0\x02\x84\x00\x60\x24\x01\x38\xa9\x75\x60\x50\x76"
+"\xf0\x74\x30\x72\xb0\x70\xc9\x65\xd0\x6c\x60\x24\x01\x18\xa9\xb3\x60\x50\x63\x90\x61\x10\x5f\xc9\xfb\xd0\x5b\x60\xb8\x18\xa9\xc3"
+"\x60\x70\x53\xf0\x51\x10\x4f\xb0\x4d\xc9\xd3\xd0\x49\x60\x24\x01\x38\xa9\x10\x60\x50\x40\xf0\x3e\x30\x3c\xb0\x3a\xc9\x7e\xd0\x36"
+"\x60\x24\x01\x18\xa9\x40\x60\x70\x2d\xb0\x2b\x30\x29\xc9\x53\xd0\x25\x60\xb8\x38\xa9\xff\x60\x70\x1d\xf0\x1b\x10\x19\x90\x17\xc9"
+"\xff\xd0\x13\x60\x24\x01\x38\xa9\xf0\x60\x70\x0a\xf0\x08\x10\x06\x90\x04\xc9\xb8\xf0\x02\x84\x00\x60\x24\x01\x18\xa9\xb2\x60\x70"
+"\x2a\x90\x28\x30\x26\xc9\x05\xd0\x22\x60\xb8\x18\xa9\x42\x60\x70\x1a\x30\x18\xb0\x16\xc9\x57\xd0\x12\x60\x24\x01\x38\xa9\x75\x60"
+"\x70\x09\x30\x07\x90\x05\xc9\x11\xd0\x01\x60\x85\x00\x24\x01\x18\xa9\xb3\x60\x50\x50\x90\x4e\x10\x4c\xc9\xe1\xd0\x48\x60\xb8\x18"
+"\xa9\x42\x60\x70\x40\xf0\x3e\x30\x3c\x90\x3a\xc9\x56\xd0\x36\x60\x24\x01\x38\xa9\x75\x60\x50\x2d\xf0\x2b\x30\x29\x90\x27\xc9\x6e"
+"\xd0\x23\x60\x24\x01\x18\xa9\xb3\x60\x50\x1a\x90\x18\x30\x16\xc9\x02\xd0\x12\x60\xb8\x18\xa9\x42\x60\x70\x0a\xf0\x08\x30\x06\xb0"
+"\x04\xc9\x42\xf0\x02\x84\x00\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x80\xff\x80\x80\x00\x00\x00"
+"\x00\x00\xff\x00\x00\x00\x00\x00\x01\x01\xff\x01\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x7c\xfe\x00\xc0\xc0\xfe\x7c\x00"
+"\xfe\xfe\x00\xf0\xc0\xfe\xfe\x00\xc6\xc6\x02\xfe\xc6\xc6\xc6\x00\xcc\xd8\x00\xf0\xd8\xcc\xc6\x00\xc6\xee\x02\xd6\xc6\xc6\xc6\x00"
+"\xc6\xc6\x02\xd6\xce\xc6\xc6\x00\x7c\xfe\x02\xc6\xc6\xfe\x7c\x00\xfc\xfe\x02\xfc\xc0\xc0\xc0\x00\xcc\xcc\x00\x78\x30\x30\x30\x00"
+"\x18\x18\x18\x18\x18\x18\x18\x00\xfc\xfe\x02\x06\x1c\x70\xfe\x00\xfc\xfe\x02\x3c\x3c\x02\xfe\x00\x18\x18\xd8\xd8\xfe\x18\x18\x00"
+"\xfe\xfe\x00\x80\xfc\x06\xfe\x00\x7c\xfe\x00\xc0\xfc\xc6\xfe\x00\xfe\xfe\x06\x0c\x18\x10\x30\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x18\x18\x18\xff\xff\x18\x18\x18"
+"\x18\x18\x18\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x18\x18\x18\x18\x00\x18\x18\x00\x33\x33\x66\x00\x00\x00\x00\x00"
+"\x66\x66\xff\x66\xff\x66\x66\x00\x18\x3e\x60\x3c\x06\x7c\x18\x00\x62\x66\x0c\x18\x30\x66\x46\x00\x3c\x66\x3c\x38\x67\x66\x3f\x00"
+"\x0c\x0c\x18\x00\x00\x00\x00\x00\x0c\x18\x30\x30\x30\x18\x0c\x00\x30\x18\x0c\x0c\x0c\x18\x30\x00\x00\x66\x3c\xff\x3c\x66\x00\x00"
+"\x00\x18\x18\x7e\x18\x18\x00\x00\x00\x00\x00\x00\x00\x18\x18\x30\x00\x00\x00\x6e\x3b\x00\x00\x00\x00\x00\x00\x00\x00\x18\x18\x00"
+"\x00\x03\x06\x0c\x18\x30\x60\x00\x3e\x63\x67\x6b\x73\x63\x3e\x00\x0c\x1c\x0c\x0c\x0c\x0c\x3f\x00\x3e\x63\x63\x0e\x38\x63\x7f\x00"
+"\x3e\x63\x63\x0e\x63\x63\x3e\x00\x06\x0e\x1e\x26\x7f\x06\x06\x00\x7f\x63\x60\x7e\x03\x63\x3e\x00\x3e\x63\x60\x7e\x63\x63\x3e\x00"
+"\x7f\x63\x06\x0c\x18\x18\x3c\x00\x3e\x63\x63\x3e\x63\x63\x3e\x00\x3e\x63\x63\x3f\x03\x63\x3e\x00\x00\x00\x18\x18\x00\x18\x18\x00"
+"\x00\x00\x18\x18\x00\x18\x18\x30\x0e\x18\x30\x60\x30\x18\x0e\x00\x00\x00\x7e\x00\x7e\x00\x00\x00\x70\x18\x0c\x06\x0c\x18\x70\x00"
+"\x7e\x63\x03\x06\x1c\x00\x18\x18\x7c\xc6\xce\xee\xe0\xe6\x7c\x00\x1c\x36\x63\x7f\x63\x63\x63\x00\x6e\x73\x63\x7e\x63\x63\x7e\x00"
+"\x1e\x33\x60\x60\x60\x33\x1e\x00\x6c\x76\x63\x63\x63\x66\x7c\x00\x7f\x31\x30\x3c\x30\x31\x7f\x00\x7f\x31\x30\x3c\x30\x30\x78\x00"
+"\x1e\x33\x60\x67\x63\x37\x1d\x00\x63\x63\x63\x7f\x63\x63\x63\x00\x3c\x18\x18\x18\x18\x18\x3c\x00\x1f\x06\x06\x06\x06\x66\x3c\x00"
+"\x66\x66\x6c\x78\x6c\x67\x63\x00\x78\x30\x60\x60\x63\x63\x7e\x00\x63\x77\x7f\x6b\x63\x63\x63\x00\x63\x73\x7b\x6f\x67\x63\x63\x00"
+"\x1c\x36\x63\x63\x63\x36\x1c\x00\x6e\x73\x63\x7e\x60\x60\x60\x00\x1c\x36\x63\x6b\x67\x36\x1d\x00\x6e\x73\x63\x7e\x6c\x67\x63\x00"
+"\x3e\x63\x60\x3e\x03\x63\x3e\x00\x7e\x5a\x18\x18\x18\x18\x3c\x00\x73\x33\x63\x63\x63\x76\x3c\x00\x73\x33\x63\x63\x66\x3c\x18\x00"
+"\x73\x33\x63\x6b\x7f\x77\x63\x00\x63\x63\x36\x1c\x36\x63\x63\x00\x33\x63\x63\x36\x1c\x78\x70\x00\x7f\x63\x06\x1c\x33\x63\x7e\x00"
+"\x3c\x30\x30\x30\x30\x30\x3c\x00\x40\x60\x30\x18\x0c\x06\x02\x00\x3c\x0c\x0c\x0c\x0c\x0c\x3c\x00\x00\x18\x3c\x7e\x18\x18\x18\x18"
+"\x00\x00\x00\x00\x00\x00\xff\xff\x30\x30\x18\x00\x00\x00\x00\x00\x00\x00\x3f\x63\x63\x67\x3b\x00\x60\x60\x6e\x73\x63\x63\x3e\x00"
+"\x00\x00\x3e\x63\x60\x63\x3e\x00\x03\x03\x3b\x67\x63\x63\x3e\x00\x00\x00\x3e\x61\x7f\x60\x3e\x00\x0e\x18\x18\x3c\x18\x18\x3c\x00"
+"\x00\x00\x3e\x60\x63\x63\x3d\x00\x60\x60\x6e\x73\x63\x66\x67\x00\x00\x00\x1e\x0c\x0c\x0c\x1e\x00\x00\x00\x3f\x06\x06\x06\x66\x3c"
+"\x60\x60\x66\x6e\x7c\x67\x63\x00\x1c\x0c\x0c\x0c\x0c\x0c\x1e\x00\x00\x00\x6e\x7f\x6b\x62\x67\x00\x00\x00\x6e\x73\x63\x66\x67\x00"
+"\x00\x00\x3e\x63\x63\x63\x3e\x00\x00\x00\x3e\x63\x73\x6e\x60\x60\x00\x00\x3e\x63\x67\x3b\x03\x03\x00\x00\x6e\x73\x63\x7e\x63\x00"
+"\x00\x00\x3e\x71\x1c\x47\x3e\x00\x06\x0c\x3f\x18\x18\x1b\x0e\x00\x00\x00\x73\x33\x63\x67\x3b\x00\x00\x00\x73\x33\x63\x66\x3c\x00"
+"\x00\x00\x63\x6b\x7f\x77\x63\x00\x00\x00\x63\x36\x1c\x36\x63\x00\x00\x00\x33\x63\x63\x3f\x03\x3e\x00\x00\x7f\x0e\x1c\x38\x7f\x00"
+"\x3c\x42\x99\xa1\xa1\x99\x42\x3c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x0f\x06\x12\x33\x33\x06\x12\x33\x38\x06\x12\x33\x3a\x06\x12\x33\x0f\x06\x12\x33\x33\x06\x12\x33"
+"\x38\x06\x12\x33\x3a\x06\x12\x33\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xaf\xc5\x04\xc0\xf4\xc5\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x80\xff\x80\x80\x00\x00\x00\x80\x80\xff\x80\x80\x00\x00\x00"
+"\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x01\x01\xff\x01\x01\x00\x00\x00\x01\x01\xff\x01\x01\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x7c\xfe\x00\xc0\xc0\xfe\x7c\x00\x7c\xfe\x00\xc0\xc0\xfe\x7c\x00"
+"\xfe\xfe\x00\xf0\xc0\xfe\xfe\x00\xfe\xfe\x00\xf0\xc0\xfe\xfe\x00\xc6\xc6\x02\xfe\xc6\xc6\xc6\x00\xc6\xc6\x02\xfe\xc6\xc6\xc6\x00"
+"\xcc\xd8\x00\xf0\xd8\xcc\xc6\x00\xcc\xd8\x00\xf0\xd8\xcc\xc6\x00\xc6\xee\x02\xd6\xc6\xc6\xc6\x00\xc6\xee\x02\xd6\xc6\xc6\xc6\x00"
+"\xc6\xc6\x02\xd6\xce\xc6\xc6\x00\xc6\xc6\x02\xd6\xce\xc6\xc6\x00\x7c\xfe\x02\xc6\xc6\xfe\x7c\x00\x7c\xfe\x02\xc6\xc6\xfe\x7c\x00"
+"\xfc\xfe\x02\xfc\xc0\xc0\xc0\x00\xfc\xfe\x02\xfc\xc0\xc0\xc0\x00\xcc\xcc\x00\x78\x30\x30\x30\x00\xcc\xcc\x00\x78\x30\x30\x30\x00"
+"\x18\x18\x18\x18\x18\x18\x18\x00\x18\x18\x18\x18\x18\x18\x18\x00\xfc\xfe\x02\x06\x1c\x70\xfe\x00\xfc\xfe\x02\x06\x1c\x70\xfe\x00"
+"\xfc\xfe\x02\x3c\x3c\x02\xfe\x00\xfc\xfe\x02\x3c\x3c\x02\xfe\x00\x18\x18\xd8\xd8\xfe\x18\x18\x00\x18\x18\xd8\xd8\xfe\x18\x18\x00"
+"\xfe\xfe\x00\x80\xfc\x06\xfe\x00\xfe\xfe\x00\x80\xfc\x06\xfe\x00\x7c\xfe\x00\xc0\xfc\xc6\xfe\x00\x7c\xfe\x00\xc0\xfc\xc6\xfe\x00"
+"\xfe\xfe\x06\x0c\x18\x10\x30\x00\xfe\xfe\x06\x0c\x18\x10\x30\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x18\x18\x18\xff\xff\x18\x18\x18\x18\x18\x18\xff\xff\x18\x18\x18"
+"\x18\x18\x18\xff\xff\x00\x00\x00\x18\x18\x18\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x18\x18\x18\x18\x00\x18\x18\x00\x18\x18\x18\x18\x00\x18\x18\x00\x33\x33\x66\x00\x00\x00\x00\x00\x33\x33\x66\x00\x00\x00\x00\x00"
+"\x66\x66\xff\x66\xff\x66\x66\x00\x66\x66\xff\x66\xff\x66\x66\x00\x18\x3e\x60\x3c\x06\x7c\x18\x00\x18\x3e\x60\x3c\x06\x7c\x18\x00"
+"\x62\x66\x0c\x18\x30\x66\x46\x00\x62\x66\x0c\x18\x30\x66\x46\x00\x3c\x66\x3c\x38\x67\x66\x3f\x00\x3c\x66\x3c\x38\x67\x66\x3f\x00"
+"\x0c\x0c\x18\x00\x00\x00\x00\x00\x0c\x0c\x18\x00\x00\x00\x00\x00\x0c\x18\x30\x30\x30\x18\x0c\x00\x0c\x18\x30\x30\x30\x18\x0c\x00"
+"\x30\x18\x0c\x0c\x0c\x18\x30\x00\x30\x18\x0c\x0c\x0c\x18\x30\x00\x00\x66\x3c\xff\x3c\x66\x00\x00\x00\x66\x3c\xff\x3c\x66\x00\x00"
+"\x00\x18\x18\x7e\x18\x18\x00\x00\x00\x18\x18\x7e\x18\x18\x00\x00\x00\x00\x00\x00\x00\x18\x18\x30\x00\x00\x00\x00\x00\x18\x18\x30"
+"\x00\x00\x00\x6e\x3b\x00\x00\x00\x00\x00\x00\x6e\x3b\x00\x00\x00\x00\x00\x00\x00\x00\x18\x18\x00\x00\x00\x00\x00\x00\x18\x18\x00"
+"\x00\x03\x06\x0c\x18\x30\x60\x00\x00\x03\x06\x0c\x18\x30\x60\x00\x3e\x63\x67\x6b\x73\x63\x3e\x00\x3e\x63\x67\x6b\x73\x63\x3e\x00"
+"\x0c\x1c\x0c\x0c\x0c\x0c\x3f\x00\x0c\x1c\x0c\x0c\x0c\x0c\x3f\x00\x3e\x63\x63\x0e\x38\x63\x7f\x00\x3e\x63\x63\x0e\x38\x63\x7f\x00"
+"\x3e\x63\x63\x0e\x63\x63\x3e\x00\x3e\x63\x63\x0e\x63\x63\x3e\x00\x06\x0e\x1e\x26\x7f\x06\x06\x00\x06\x0e\x1e\x26\x7f\x06\x06\x00"
+"\x7f\x63\x60\x7e\x03\x63\x3e\x00\x7f\x63\x60\x7e\x03\x63\x3e\x00\x3e\x63\x60\x7e\x63\x63\x3e\x00\x3e\x63\x60\x7e\x63\x63\x3e\x00"
+"\x7f\x63\x06\x0c\x18\x18\x3c\x00\x7f\x63\x06\x0c\x18\x18\x3c\x00\x3e\x63\x63\x3e\x63\x63\x3e\x00\x3e\x63\x63\x3e\x63\x63\x3e\x00"
+"\x3e\x63\x63\x3f\x03\x63\x3e\x00\x3e\x63\x63\x3f\x03\x63\x3e\x00\x00\x00\x18\x18\x00\x18\x18\x00\x00\x00\x18\x18\x00\x18\x18\x00"
+"\x00\x00\x18\x18\x00\x18\x18\x30\x00\x00\x18\x18\x00\x18\x18\x30\x0e\x18\x30\x60\x30\x18\x0e\x00\x0e\x18\x30\x60\x30\x18\x0e\x00"
+"\x00\x00\x7e\x00\x7e\x00\x00\x00\x00\x00\x7e\x00\x7e\x00\x00\x00\x70\x18\x0c\x06\x0c\x18\x70\x00\x70\x18\x0c\x06\x0c\x18\x70\x00"
+"\x7e\x63\x03\x06\x1c\x00\x18\x18\x7e\x63\x03\x06\x1c\x00\x18\x18\x7c\xc6\xce\xee\xe0\xe6\x7c\x00\x7c\xc6\xce\xee\xe0\xe6\x7c\x00"
+"\x1c\x36\x63\x7f\x63\x63\x63\x00\x1c\x36\x63\x7f\x63\x63\x63\x00\x6e\x73\x63\x7e\x63\x63\x7e\x00\x6e\x73\x63\x7e\x63\x63\x7e\x00"
+"\x1e\x33\x60\x60\x60\x33\x1e\x00\x1e\x33\x60\x60\x60\x33\x1e\x00\x6c\x76\x63\x63\x63\x66\x7c\x00\x6c\x76\x63\x63\x63\x66\x7c\x00"
+"\x7f\x31\x30\x3c\x30\x31\x7f\x00\x7f\x31\x30\x3c\x30\x31\x7f\x00\x7f\x31\x30\x3c\x30\x30\x78\x00\x7f\x31\x30\x3c\x30\x30\x78\x00"
+"\x1e\x33\x60\x67\x63\x37\x1d\x00\x1e\x33\x60\x67\x63\x37\x1d\x00\x63\x63\x63\x7f\x63\x63\x63\x00\x63\x63\x63\x7f\x63\x63\x63\x00"
+"\x3c\x18\x18\x18\x18\x18\x3c\x00\x3c\x18\x18\x18\x18\x18\x3c\x00\x1f\x06\x06\x06\x06\x66\x3c\x00\x1f\x06\x06\x06\x06\x66\x3c\x00"
+"\x66\x66\x6c\x78\x6c\x67\x63\x00\x66\x66\x6c\x78\x6c\x67\x63\x00\x78\x30\x60\x60\x63\x63\x7e\x00\x78\x30\x60\x60\x63\x63\x7e\x00"
+"\x63\x77\x7f\x6b\x63\x63\x63\x00\x63\x77\x7f\x6b\x63\x63\x63\x00\x63\x73\x7b\x6f\x67\x63\x63\x00\x63\x73\x7b\x6f\x67\x63\x63\x00"
+"\x1c\x36\x63\x63\x63\x36\x1c\x00\x1c\x36\x63\x63\x63\x36\x1c\x00\x6e\x73\x63\x7e\x60\x60\x60\x00\x6e\x73\x63\x7e\x60\x60\x60\x00"
+"\x1c\x36\x63\x6b\x67\x36\x1d\x00\x1c\x36\x63\x6b\x67\x36\x1d\x00\x6e\x73\x63\x7e\x6c\x67\x63\x00\x6e\x73\x63\x7e\x6c\x67\x63\x00"
+"\x3e\x63\x60\x3e\x03\x63\x3e\x00\x3e\x63\x60\x3e\x03\x63\x3e\x00\x7e\x5a\x18\x18\x18\x18\x3c\x00\x7e\x5a\x18\x18\x18\x18\x3c\x00"
+"\x73\x33\x63\x63\x63\x76\x3c\x00\x73\x33\x63\x63\x63\x76\x3c\x00\x73\x33\x63\x63\x66\x3c\x18\x00\x73\x33\x63\x63\x66\x3c\x18\x00"
+"\x73\x33\x63\x6b\x7f\x77\x63\x00\x73\x33\x63\x6b\x7f\x77\x63\x00\x63\x63\x36\x1c\x36\x63\x63\x00\x63\x63\x36\x1c\x36\x63\x63\x00"
+"\x33\x63\x63\x36\x1c\x78\x70\x00\x33\x63\x63\x36\x1c\x78\x70\x00\x7f\x63\x06\x1c\x33\x63\x7e\x00\x7f\x63\x06\x1c\x33\x63\x7e\x00"
+"\x3c\x30\x30\x30\x30\x30\x3c\x00\x3c\x30\x30\x30\x30\x30\x3c\x00\x40\x60\x30\x18\x0c\x06\x02\x00\x40\x60\x30\x18\x0c\x06\x02\x00"
+"\x3c\x0c\x0c\x0c\x0c\x0c\x3c\x00\x3c\x0c\x0c\x0c\x0c\x0c\x3c\x00\x00\x18\x3c\x7e\x18\x18\x18\x18\x00\x18\x3c\x7e\x18\x18\x18\x18"
+"\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\xff\xff\x30\x30\x18\x00\x00\x00\x00\x00\x30\x30\x18\x00\x00\x00\x00\x00"
+"\x00\x00\x3f\x63\x63\x67\x3b\x00\x00\x00\x3f\x63\x63\x67\x3b\x00\x60\x60\x6e\x73\x63\x63\x3e\x00\x60\x60\x6e\x73\x63\x63\x3e\x00"
+"\x00\x00\x3e\x63\x60\x63\x3e\x00\x00\x00\x3e\x63\x60\x63\x3e\x00\x03\x03\x3b\x67\x63\x63\x3e\x00\x03\x03\x3b\x67\x63\x63\x3e\x00"
+"\x00\x00\x3e\x61\x7f\x60\x3e\x00\x00\x00\x3e\x61\x7f\x60\x3e\x00\x0e\x18\x18\x3c\x18\x18\x3c\x00\x0e\x18\x18\x3c\x18\x18\x3c\x00"
+"\x00\x00\x3e\x60\x63\x63\x3d\x00\x00\x00\x3e\x60\x63\x63\x3d\x00\x60\x60\x6e\x73\x63\x66\x67\x00\x60\x60\x6e\x73\x63\x66\x67\x00"
+"\x00\x00\x1e\x0c\x0c\x0c\x1e\x00\x00\x00\x1e\x0c\x0c\x0c\x1e\x00\x00\x00\x3f\x06\x06\x06\x66\x3c\x00\x00\x3f\x06\x06\x06\x66\x3c"
+"\x60\x60\x66\x6e\x7c\x67\x63\x00\x60\x60\x66\x6e\x7c\x67\x63\x00\x1c\x0c\x0c\x0c\x0c\x0c\x1e\x00\x1c\x0c\x0c\x0c\x0c\x0c\x1e\x00"
+"\x00\x00\x6e\x7f\x6b\x62\x67\x00\x00\x00\x6e\x7f\x6b\x62\x67\x00\x00\x00\x6e\x73\x63\x66\x67\x00\x00\x00\x6e\x73\x63\x66\x67\x00"
+"\x00\x00\x3e\x63\x63\x63\x3e\x00\x00\x00\x3e\x63\x63\x63\x3e\x00\x00\x00\x3e\x63\x73\x6e\x60\x60\x00\x00\x3e\x63\x73\x6e\x60\x60"
+"\x00\x00\x3e\x63\x67\x3b\x03\x03\x00\x00\x3e\x63\x67\x3b\x03\x03\x00\x00\x6e\x73\x63\x7e\x63\x00\x00\x00\x6e\x73\x63\x7e\x63\x00"
+"\x00\x00\x3e\x71\x1c\x47\x3e\x00\x00\x00\x3e\x71\x1c\x47\x3e\x00\x06\x0c\x3f\x18\x18\x1b\x0e\x00\x06\x0c\x3f\x18\x18\x1b\x0e\x00"
+"\x00\x00\x73\x33\x63\x67\x3b\x00\x00\x00\x73\x33\x63\x67\x3b\x00\x00\x00\x73\x33\x63\x66\x3c\x00\x00\x00\x73\x33\x63\x66\x3c\x00"
+"\x00\x00\x63\x6b\x7f\x77\x63\x00\x00\x00\x63\x6b\x7f\x77\x63\x00\x00\x00\x63\x36\x1c\x36\x63\x00\x00\x00\x63\x36\x1c\x36\x63\x00"
+"\x00\x00\x33\x63\x63\x3f\x03\x3e\x00\x00\x33\x63\x63\x3f\x03\x3e\x00\x00\x7f\x0e\x1c\x38\x7f\x00\x00\x00\x7f\x0e\x1c\x38\x7f\x00"
+"\x3c\x42\x99\xa1\xa1\x99\x42\x3c\x3c\x42\x99\xa1\xa1\x99\x42\x3c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+;
 dump_item dump_items[DUMP_NUM_ITEMS] = {
 { "nestest", dump_nestest, 24592 },
 };
@@ -1,8 +1,11 @@
 #pragma once
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include <stdint.h>
 extern unsigned char dump_nestest[24592];
+#ifndef DUMP_ITEM_DEFINED
+#define DUMP_ITEM_DEFINED
 typedef struct { const char* name; const uint8_t* ptr; int size; } dump_item;
+#endif
 #define DUMP_NUM_ITEMS (1)
 extern dump_item dump_items[DUMP_NUM_ITEMS];
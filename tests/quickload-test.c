@@ -0,0 +1,233 @@
+//------------------------------------------------------------------------------
+//  quickload-test.c
+//
+//  Tests the quickloaders of the example systems: a BASIC .prg on the C64,
+//  a binary with AMSDOS header on the CPC, and the same 48K and 128K memory
+//  images as .sna and .z80 files on the ZX Spectrum. The loaded program
+//  must run in the next frames, and broken files must be rejected.
+//------------------------------------------------------------------------------
+// force assert() enabled
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#define CHIPS_IMPL
+#include "systems/c64.h"
+#include "systems/cpc6128.h"
+#include "systems/zx128k.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+uint32_t num_tests = 0;
+#define T(x) { assert(x); num_tests++; }
+
+#define NUM_BOOT_FRAMES (150)
+
+/* 10 POKE49152,42 */
+static const uint8_t c64_prg[] = {
+    0x01, 0x08, 0x0F, 0x08, 0x0A, 0x00, 0x97, '4', '9', '1', '5', '2', ',', '4', '2', 0x00, 0x00, 0x00,
+};
+/* 4000: DI; LD A,42; LD (5000h),A; JR $ */
+static const uint8_t cpc_code[] = { 0xF3, 0x3E, 0x2A, 0x32, 0x00, 0x50, 0x18, 0xFE };
+/* 8000: DI; LD A,5; OUT (FEh),A; JR $ */
+static const uint8_t zx_code[] = { 0xF3, 0x3E, 0x05, 0xD3, 0xFE, 0x18, 0xFE };
+
+void put_word(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+/* compress a .z80 memory block (runs of 5 or more, or of 2 or more ED bytes,
+   become ED ED nn bb, a byte following a single ED is never compressed)
+*/
+uint32_t z80_compress(const uint8_t* src, uint32_t len, uint8_t* dst) {
+    uint32_t si = 0, di = 0;
+    while (si < len) {
+        uint32_t run = 1;
+        while (((si + run) < len) && (src[si + run] == src[si]) && (run < 255)) {
+            run++;
+        }
+        if ((run >= 5) || ((run >= 2) && (src[si] == 0xED))) {
+            dst[di++] = 0xED; dst[di++] = 0xED; dst[di++] = (uint8_t)run; dst[di++] = src[si];
+            si += run;
+        }
+        else {
+            const bool ed = 0xED == src[si];
+            dst[di++] = src[si++];
+            if (ed && (si < len)) {
+                dst[di++] = src[si++];
+            }
+        }
+    }
+    return di;
+}
+
+/* the BASIC program is started with RUN through the keyboard buffer */
+void test_c64_prg() {
+    const uint32_t fb_size = C64_DISP_WIDTH * C64_DISP_HEIGHT * sizeof(uint32_t);
+    c64_t* sys = (c64_t*) thread_aligned_calloc(sizeof(c64_t));
+    uint32_t* fb = (uint32_t*) calloc(1, fb_size);
+    T(sys && fb);
+    c64_init(sys, &(c64_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+    c64_exec(sys, NUM_BOOT_FRAMES * (C64_FREQ / 50));
+    T(c64_quickload(sys, c64_prg, sizeof(c64_prg)));
+    for (int frame = 0; (sys->ram[0xC000] != 42) && (frame < 10); frame++) {
+        c64_exec(sys, C64_FREQ / 50);
+    }
+    T(42 == sys->ram[0xC000]);
+    /* too short for a load address and a byte of data */
+    T(!c64_quickload(sys, c64_prg, 2));
+    thread_aligned_free(sys);
+    free(fb);
+}
+
+/* a binary file with AMSDOS header, started at its entry point */
+void test_cpc_bin() {
+    const uint32_t fb_size = CPC_DISP_WIDTH * CPC_DISP_HEIGHT * sizeof(uint32_t);
+    cpc_t* sys = (cpc_t*) thread_aligned_calloc(sizeof(cpc_t));
+    uint32_t* fb = (uint32_t*) calloc(1, fb_size);
+    T(sys && fb);
+    cpc_init(sys, &(cpc_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+    cpc_exec(sys, NUM_BOOT_FRAMES * (CPC_FREQ / 50));
+    uint8_t file[128 + sizeof(cpc_code)] = { 0 };
+    memcpy(&file[1], "QUICKLD BIN", 11);
+    file[18] = 2;
+    put_word(&file[21], 0x4000);
+    put_word(&file[24], sizeof(cpc_code));
+    put_word(&file[26], 0x4000);
+    put_word(&file[64], sizeof(cpc_code));
+    uint16_t checksum = 0;
+    for (int i = 0; i < 67; i++) {
+        checksum += file[i];
+    }
+    put_word(&file[67], checksum);
+    memcpy(&file[128], cpc_code, sizeof(cpc_code));
+    T(cpc_quickload(sys, file, sizeof(file)));
+    cpc_exec(sys, CPC_FREQ / 50);
+    T(42 == mem_rd(&sys->mem, 0x5000));
+    T(0x4006 == sys->cpu.state.PC);
+    /* a broken checksum must be rejected */
+    file[67] ^= 1;
+    T(!cpc_quickload(sys, file, sizeof(file)));
+    thread_aligned_free(sys);
+    free(fb);
+}
+
+/* build a 48K or 128K .sna or .z80 (v1 compressed, or v3) file from 8 RAM banks, returns its size */
+uint32_t zx_make_file(uint8_t (*banks)[0x4000], bool is_128, bool is_z80, uint8_t* file) {
+    /* the 128K variants page bank 3 in at C000 with the 48K ROM */
+    const uint8_t port_7ffd = 0x13;
+    const int upper_bank = is_128 ? 3 : 0;
+    uint32_t size = 0;
+    memset(file, 0, 0x30000);
+    if (!is_z80) {
+        put_word(&file[23], is_128 ? 0xFF00 : 0xFEFE);
+        file[25] = 1;
+        file[26] = 2;
+        memcpy(&file[27], banks[5], 0x4000);
+        memcpy(&file[27 + 0x4000], banks[2], 0x4000);
+        memcpy(&file[27 + 0x8000], banks[upper_bank], 0x4000);
+        size = 27 + 0xC000;
+        if (is_128) {
+            put_word(&file[size], 0x8000);
+            file[size + 2] = port_7ffd;
+            size += 4;
+            for (int bank = 0; bank < 8; bank++) {
+                if ((bank != 5) && (bank != 2) && (bank != upper_bank)) {
+                    memcpy(&file[size], banks[bank], 0x4000);
+                    size += 0x4000;
+                }
+            }
+        }
+    }
+    else {
+        put_word(&file[8], 0xFF00);
+        file[12] = (2 << 1) | (is_128 ? 0 : (1<<5));
+        file[29] = 1;
+        if (!is_128) {
+            static uint8_t ram48[0xC000];
+            put_word(&file[6], 0x8000);
+            size = 30;
+            memcpy(ram48, banks[5], 0x4000);
+            memcpy(ram48 + 0x4000, banks[2], 0x4000);
+            memcpy(ram48 + 0x8000, banks[0], 0x4000);
+            size += z80_compress(ram48, sizeof(ram48), &file[size]);
+            memcpy(&file[size], "\x00\xED\xED\x00", 4);
+            size += 4;
+        }
+        else {
+            put_word(&file[30], 54);
+            put_word(&file[32], 0x8000);
+            file[34] = 4;
+            file[35] = port_7ffd;
+            size = 32 + 54;
+            for (int bank = 0; bank < 8; bank++) {
+                /* bank 1 is stored uncompressed */
+                const uint32_t len = (bank == 1) ? 0x4000 : z80_compress(banks[bank], 0x4000, &file[size + 3]);
+                if (bank == 1) {
+                    memcpy(&file[size + 3], banks[bank], 0x4000);
+                }
+                put_word(&file[size], (bank == 1) ? 0xFFFF : (uint16_t)len);
+                file[size + 2] = (uint8_t)(bank + 3);
+                size += 3 + len;
+            }
+        }
+    }
+    return size;
+}
+
+/* 48K as .sna and .z80 (v1, compressed), 128K as .sna and .z80 (v3) */
+void test_zx_sna_z80() {
+    const uint32_t fb_size = ZX128K_DISP_WIDTH * ZX128K_DISP_HEIGHT;
+    uint8_t (*banks)[0x4000] = (uint8_t(*)[0x4000]) calloc(8, 0x4000);
+    uint8_t* file = (uint8_t*) calloc(1, 0x30000);
+    zx128k_t* sys = (zx128k_t*) thread_aligned_calloc(sizeof(zx128k_t));
+    uint8_t* fb = (uint8_t*) calloc(1, fb_size);
+    T(banks && file && sys && fb);
+    for (int bank = 0; bank < 8; bank++) {
+        for (int i = 0; i < 0x4000; i++) {
+            /* a bank-specific pattern with runs, so that compression kicks in */
+            banks[bank][i] = (uint8_t)((i & 0x100) ? (bank * 17 + (i >> 9)) : ((i * 7) ^ bank));
+        }
+    }
+    memcpy(banks[2], zx_code, sizeof(zx_code));
+    /* the PC on the stack of the 48K .sna (at FEFE) */
+    banks[0][0x3EFE] = 0x00;
+    banks[0][0x3EFF] = 0x80;
+    for (int variant = 0; variant < 4; variant++) {
+        const bool is_128 = variant >= 2;
+        const bool is_z80 = variant & 1;
+        const int upper_bank = is_128 ? 3 : 0;
+        const uint32_t size = zx_make_file(banks, is_128, is_z80, file);
+        zx_init(sys, &(zx_desc_t){ .pal8_buffer = fb, .pal8_buffer_size = fb_size });
+        zx_exec(sys, NUM_BOOT_FRAMES * (ZX128K_FREQ / 50));
+        T(is_z80 ? zx_quickload_z80(sys, file, size) : zx_quickload_sna(sys, file, size));
+        for (int bank = 0; bank < 8; bank++) {
+            if (is_128 || (bank == 5) || (bank == 2) || (bank == 0)) {
+                T(0 == memcmp(sys->ram[bank], banks[bank], 0x4000));
+            }
+        }
+        T(0x8000 == sys->cpu.state.PC);
+        T(0xFF00 == sys->cpu.state.SP);
+        T(1 == sys->cpu.state.IM);
+        T(mem_rd(&sys->mem, 0xC000) == banks[upper_bank][0]);
+        T(sys->memory_paging_disabled == !is_128);
+        zx_exec(sys, ZX128K_FREQ / 50);
+        T(5 == sys->border_index);
+        T(0x8005 == sys->cpu.state.PC);
+        /* a truncated file must be rejected */
+        T(is_z80 ? !zx_quickload_z80(sys, file, size - 100) : !zx_quickload_sna(sys, file, size - 1));
+    }
+    free(banks);
+    free(file);
+    thread_aligned_free(sys);
+    free(fb);
+}
+
+int main() {
+    test_c64_prg();
+    test_cpc_bin();
+    test_zx_sna_z80();
+    printf("%d tests run ok.\n", num_tests);
+    return 0;
+}
@@ -1,1085 +1,549 @@
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include "zex-dump.h"
-unsigned char dump_zexall[8585] = {
-0xc3, 0x13, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x2a, 0x6, 0x0, 0xf9, 0x11, 0xda, 0x1d, 0xe, 0x9, 0xcd, 0xce, 0x1d, 0x21, 
-0x3a, 0x1, 0x7e, 0x23, 0xb6, 0xca, 0x2f, 0x1, 0x2b, 0xcd, 0xe2, 0x1a, 0xc3, 0x22, 0x1, 0x11, 
-0xf6, 0x1d, 0xe, 0x9, 0xcd, 0xce, 0x1d, 0xc3, 0x0, 0x0, 0xc2, 0x1, 0x22, 0x2, 0x82, 0x2, 
-0xe2, 0x2, 0x42, 0x3, 0xa2, 0x3, 0x2, 0x4, 0x62, 0x4, 0xc2, 0x4, 0x22, 0x5, 0x82, 0x5, 
-0xe2, 0x5, 0x42, 0x6, 0xa2, 0x6, 0x2, 0x7, 0x62, 0x7, 0xc2, 0x7, 0x22, 0x8, 0x82, 0x8, 
-0xe2, 0x8, 0x42, 0x9, 0xa2, 0x9, 0x2, 0xa, 0x62, 0xa, 0xc2, 0xa, 0x22, 0xb, 0x82, 0xb, 
-0xe2, 0xb, 0x42, 0xc, 0xa2, 0xc, 0x2, 0xd, 0x62, 0xd, 0xc2, 0xd, 0x22, 0xe, 0x82, 0xe, 
-0xe2, 0xe, 0x42, 0xf, 0xa2, 0xf, 0x2, 0x10, 0x62, 0x10, 0xc2, 0x10, 0x22, 0x11, 0x82, 0x11, 
-0xe2, 0x11, 0x42, 0x12, 0xa2, 0x12, 0x2, 0x13, 0x62, 0x13, 0xc2, 0x13, 0x22, 0x14, 0x82, 0x14, 
-0xe2, 0x14, 0x42, 0x15, 0xa2, 0x15, 0x2, 0x16, 0x62, 0x16, 0xc2, 0x16, 0x22, 0x17, 0x82, 0x17, 
-0xe2, 0x17, 0x42, 0x18, 0xa2, 0x18, 0x2, 0x19, 0x62, 0x19, 0xc2, 0x19, 0x22, 0x1a, 0x82, 0x1a, 
-0x0, 0x0, 0xff, 0xed, 0x42, 0x0, 0x0, 0x2c, 0x83, 0x88, 0x4f, 0x2b, 0xf2, 0x39, 0xb3, 0x1f, 
-0x7e, 0x63, 0x15, 0xd3, 0x89, 0x5e, 0x46, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x21, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x0, 0xff, 0xff, 0xd4, 
-0x8a, 0xd5, 0x19, 0x3c, 0x61, 0x64, 0x63, 0x2c, 0x73, 0x62, 0x63, 0x3e, 0x20, 0x68, 0x6c, 0x2c, 
-0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 0x2c, 0x68, 0x6c, 0x2c, 0x73, 0x70, 0x3e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x9, 0x0, 0x0, 0x0, 0xa5, 0xc4, 0xc7, 0xc4, 0x26, 0xd2, 0x50, 0xa0, 0xea, 
-0x58, 0x66, 0x85, 0xc6, 0xde, 0xc9, 0x9b, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x21, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x0, 0xff, 0xff, 0xd9, 
-0xa4, 0xca, 0x5, 0x61, 0x64, 0x64, 0x20, 0x68, 0x6c, 0x2c, 0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 
-0x2c, 0x68, 0x6c, 0x2c, 0x73, 0x70, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x9, 0x0, 0x0, 0xac, 0xdd, 0x94, 0xc2, 0x5b, 0x63, 0xd3, 0x33, 0x76, 
-0x6a, 0x20, 0xfa, 0x94, 0x68, 0xf5, 0x36, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 
-0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x0, 0xff, 0xff, 0xb1, 
-0xdf, 0x8e, 0xc0, 0x61, 0x64, 0x64, 0x20, 0x69, 0x78, 0x2c, 0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 
-0x2c, 0x69, 0x78, 0x2c, 0x73, 0x70, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xfd, 0x9, 0x0, 0x0, 0xc2, 0xc7, 0x7, 0xf4, 0xc1, 0x51, 0x96, 0x3e, 0xf4, 
-0xb, 0xf, 0x51, 0x92, 0x1e, 0xea, 0x71, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x21, 0xf8, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x0, 0xff, 0xff, 0x39, 
-0xc8, 0x58, 0x9b, 0x61, 0x64, 0x64, 0x20, 0x69, 0x79, 0x2c, 0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 
-0x2c, 0x69, 0x79, 0x2c, 0x73, 0x70, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xc6, 0x0, 0x0, 0x0, 0x40, 0x91, 0x3c, 0x7e, 0x67, 0x7a, 0x6d, 0xdf, 0x61, 
-0x5b, 0x29, 0xb, 0x10, 0x66, 0xb2, 0x85, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x51, 
-0xc1, 0x9c, 0x2e, 0x61, 0x6c, 0x75, 0x6f, 0x70, 0x20, 0x61, 0x2c, 0x6e, 0x6e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3e, 0xc5, 0x3a, 0x57, 0x4d, 0x4c, 0x3, 0x1, 0x9, 
-0xe3, 0x66, 0xa6, 0xd0, 0x3b, 0xbb, 0xad, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x0, 0x0, 0x0, 0x6, 
-0xc7, 0xaa, 0x8e, 0x61, 0x6c, 0x75, 0x6f, 0x70, 0x20, 0x61, 0x2c, 0x3c, 0x62, 0x2c, 0x63, 0x2c, 
-0x64, 0x2c, 0x65, 0x2c, 0x68, 0x2c, 0x6c, 0x2c, 0x28, 0x68, 0x6c, 0x29, 0x2c, 0x61, 0x3e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x84, 0x0, 0x0, 0xf7, 0xd6, 0x6e, 0xc7, 0xcf, 0xac, 0x47, 0x28, 0xdd, 
-0x22, 0x35, 0xc0, 0xc5, 0x38, 0x4b, 0x23, 0x20, 0x39, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x0, 0x0, 0x0, 0xa8, 
-0x86, 0xcc, 0x44, 0x61, 0x6c, 0x75, 0x6f, 0x70, 0x20, 0x61, 0x2c, 0x3c, 0x69, 0x78, 0x68, 0x2c, 
-0x69, 0x78, 0x6c, 0x2c, 0x69, 0x79, 0x68, 0x2c, 0x69, 0x79, 0x6c, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x86, 0x1, 0x0, 0xb7, 0x90, 0x2, 0x1, 0x2, 0x1, 0xfd, 0x32, 0x6e, 
-0x40, 0xdc, 0xc1, 0x45, 0x6e, 0xfa, 0xe5, 0x20, 0x38, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xd3, 
-0xf2, 0xd7, 0x4a, 0x61, 0x6c, 0x75, 0x6f, 0x70, 0x20, 0x61, 0x2c, 0x28, 0x3c, 0x69, 0x78, 0x2c, 
-0x69, 0x79, 0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0xcb, 0x1, 0x46, 0x75, 0x20, 0x2, 0x1, 0x2, 0x1, 0xfc, 0x3c, 0x9a, 
-0xa7, 0x74, 0x3d, 0x51, 0x27, 0x14, 0xca, 0x20, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x83, 
-0x53, 0x4e, 0xe1, 0x62, 0x69, 0x74, 0x20, 0x6e, 0x2c, 0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 
-0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xcb, 0x40, 0x0, 0x0, 0xf1, 0x3e, 0xfc, 0x9d, 0xcc, 0x7a, 0x3, 0x1, 0x61, 
-0xbe, 0x86, 0x7a, 0x50, 0x24, 0x98, 0x19, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0x0, 0x0, 0x5e, 
-0x2, 0xe, 0x98, 0x62, 0x69, 0x74, 0x20, 0x6e, 0x2c, 0x3c, 0x62, 0x2c, 0x63, 0x2c, 0x64, 0x2c, 
-0x65, 0x2c, 0x68, 0x2c, 0x6c, 0x2c, 0x28, 0x68, 0x6c, 0x29, 0x2c, 0x61, 0x3e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xed, 0xa9, 0x0, 0x0, 0xb6, 0xc7, 0xb4, 0x72, 0xf6, 0x18, 0x14, 0x1, 0xbd, 
-0x8d, 0x1, 0x0, 0xc0, 0x30, 0xa3, 0x94, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x13, 
-0x4b, 0x62, 0x2d, 0x63, 0x70, 0x64, 0x3c, 0x72, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xed, 0xa1, 0x0, 0x0, 0x48, 0x4d, 0x4a, 0xaf, 0x6b, 0x90, 0x3, 0x1, 0x71, 
-0x4e, 0x1, 0x0, 0x93, 0x6a, 0x7c, 0x90, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x2d, 
-0xa4, 0x2d, 0x19, 0x63, 0x70, 0x69, 0x3c, 0x72, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x27, 0x0, 0x0, 0x0, 0x41, 0x21, 0xfa, 0x9, 0x60, 0x1d, 0x59, 0xa5, 0x5b, 
-0x8d, 0x79, 0x90, 0x4, 0x8e, 0x9d, 0x29, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 
-0x2d, 0xd2, 0x13, 0x3c, 0x64, 0x61, 0x61, 0x2c, 0x63, 0x70, 0x6c, 0x2c, 0x73, 0x63, 0x66, 0x2c, 
-0x63, 0x63, 0x66, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x3c, 0x0, 0x0, 0x0, 0xdf, 0x4a, 0xd8, 0xd5, 0x98, 0xe5, 0x2b, 0x8a, 0xb0, 
-0xa7, 0x1b, 0x43, 0x44, 0x5a, 0x30, 0xd0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x81, 
-0xfa, 0x81, 0x0, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x61, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x4, 0x0, 0x0, 0x0, 0x23, 0xd6, 0x2d, 0x43, 0x61, 0x7a, 0x80, 0x81, 0x86, 
-0x5a, 0x85, 0x1e, 0x86, 0x58, 0xbb, 0x9b, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x77, 
-0xf3, 0x5a, 0x73, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x62, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x3, 0x0, 0x0, 0x0, 0x97, 0xcd, 0xab, 0x44, 0xc9, 0x8d, 0xe3, 0xe3, 0xcc, 
-0x11, 0xa4, 0xe8, 0x2, 0x49, 0x4d, 0x2a, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xd2, 
-0xae, 0x3b, 0xec, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x62, 0x63, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xc, 0x0, 0x0, 0x0, 0x89, 0xd7, 0x35, 0x9, 0x5b, 0x5, 0x85, 0x9f, 0x27, 
-0x8b, 0x8, 0xd2, 0x95, 0x5, 0x60, 0x6, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x1a, 
-0xf6, 0x12, 0xa7, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x63, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x14, 0x0, 0x0, 0x0, 0xea, 0xa0, 0xba, 0x5f, 0xfb, 0x65, 0x1c, 0x98, 0xcc, 
-0x38, 0xbc, 0xde, 0x43, 0x5c, 0xbd, 0x3, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xd1, 
-0x46, 0xbf, 0x51, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x64, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x13, 0x0, 0x0, 0x0, 0x2e, 0x34, 0x1d, 0x13, 0xc9, 0x28, 0xca, 0xa, 0x67, 
-0x99, 0x2e, 0x3a, 0x92, 0xf6, 0x54, 0x9d, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x21, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xae, 
-0xc6, 0xd4, 0x2c, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x64, 0x65, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x1c, 0x0, 0x0, 0x0, 0x2f, 0x60, 0xd, 0x4c, 0x2, 0x24, 0xf5, 0xe2, 0xf4, 
-0xa0, 0xa, 0xa1, 0x13, 0x32, 0x25, 0x59, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xca, 
-0x8c, 0x6a, 0xc2, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x65, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x24, 0x0, 0x0, 0x0, 0x6, 0x15, 0xeb, 0xf2, 0xdd, 0xe8, 0x2b, 0x26, 0xa6, 
-0x11, 0x1a, 0xbc, 0x17, 0x6, 0x18, 0x28, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x56, 
-0xf, 0x95, 0x5e, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x68, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x23, 0x0, 0x0, 0x0, 0xf4, 0xc3, 0xa5, 0x7, 0x6d, 0x1b, 0x4, 0x4f, 0xc2, 
-0xe2, 0x2a, 0x82, 0x57, 0xe0, 0xe1, 0xc3, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x21, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xfc, 
-0xd, 0x6d, 0x4a, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x68, 0x6c, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x23, 0x0, 0x0, 0x3c, 0xbc, 0x9b, 0xd, 0x81, 0xe0, 0xfd, 0xad, 0x7f, 
-0x9a, 0xe5, 0x96, 0x13, 0x85, 0xe2, 0xb, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 
-0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xa5, 
-0x4d, 0xbe, 0x31, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x69, 0x78, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xfd, 0x23, 0x0, 0x0, 0x2, 0x94, 0x7a, 0x63, 0x82, 0x31, 0x5a, 0xc6, 0xe9, 
-0xb2, 0xb4, 0xab, 0x16, 0xf2, 0x5, 0x6d, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x21, 0xf8, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x50, 
-0x5d, 0x51, 0xa3, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x69, 0x79, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x2c, 0x0, 0x0, 0x0, 0x31, 0x80, 0x20, 0xa5, 0x56, 0x43, 0x9, 0xb4, 0xc1, 
-0xf4, 0xa2, 0xdf, 0xd1, 0x3c, 0xa2, 0x3e, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xa0, 
-0xa1, 0xb4, 0x9f, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x6c, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x34, 0x0, 0x0, 0x0, 0x56, 0xb8, 0x7c, 0xc, 0x3e, 0xe5, 0x3, 0x1, 0x7e, 
-0x87, 0x58, 0xda, 0x15, 0x5c, 0x37, 0x1f, 0x1, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x28, 
-0x29, 0x5e, 0xce, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x28, 0x68, 0x6c, 
-0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x33, 0x0, 0x0, 0x0, 0x6f, 0x34, 0x82, 0xd4, 0x69, 0xd1, 0xb6, 0xde, 0x94, 
-0xa4, 0x76, 0xf4, 0x53, 0x2, 0x5b, 0x85, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x5d, 
-0xac, 0xd5, 0x27, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x73, 0x70, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x34, 0x1, 0x0, 0x6e, 0xfa, 0x2, 0x1, 0x2, 0x1, 0x28, 0x2c, 0x94, 
-0x88, 0x57, 0x50, 0x16, 0x33, 0x6f, 0x28, 0x20, 0x1, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xb, 
-0x95, 0xa8, 0xea, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x28, 0x3c, 0x69, 
-0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x24, 0x0, 0x0, 0x38, 0xb8, 0x6c, 0x31, 0xd4, 0xc6, 0x1, 0x3e, 0x58, 
-0x83, 0xb4, 0x15, 0x81, 0xde, 0x59, 0x42, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x6f, 
-0x46, 0x36, 0x62, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x69, 0x78, 0x68, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x2c, 0x0, 0x0, 0x14, 0x4d, 0x60, 0x74, 0xd4, 0x76, 0xe7, 0x6, 0xa2, 
-0x32, 0x3c, 0x21, 0xd6, 0xd7, 0xa5, 0x99, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x2, 
-0x7b, 0xef, 0x2c, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x69, 0x78, 0x6c, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x24, 0x0, 0x0, 0x36, 0x28, 0x6f, 0x9f, 0x16, 0x91, 0xb9, 0x61, 0xcb, 
-0x82, 0x19, 0xe2, 0x92, 0x73, 0x8c, 0xa9, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x2d, 
-0x96, 0x6c, 0xf3, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x69, 0x79, 0x68, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x2c, 0x0, 0x0, 0xc6, 0xd7, 0xd5, 0x62, 0x9e, 0xa0, 0x39, 0x70, 0x7e, 
-0x3e, 0x12, 0x9f, 0x90, 0xd9, 0xf, 0x22, 0x0, 0x1, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x36, 
-0xc1, 0x1e, 0x75, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x69, 0x79, 0x6c, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xed, 0x4b, 0x3, 0x1, 0xa8, 0xf9, 0x59, 0xf5, 0xa4, 0x93, 0xed, 0xf5, 0x96, 
-0x6f, 0x68, 0xd9, 0x86, 0xe6, 0xd8, 0x4b, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 
-0x45, 0xa9, 0xac, 0x6c, 0x64, 0x20, 0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 0x3e, 0x2c, 0x28, 0x6e, 
-0x6e, 0x6e, 0x6e, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x2a, 0x3, 0x1, 0x0, 0x63, 0x98, 0x30, 0x78, 0x77, 0x20, 0xfe, 0xb1, 0xfa, 
-0xb9, 0xb8, 0xab, 0x4, 0x6, 0x15, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 
-0x97, 0x24, 0x87, 0x6c, 0x64, 0x20, 0x68, 0x6c, 0x2c, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xed, 0x7b, 0x3, 0x1, 0xfc, 0x8d, 0xd7, 0x57, 0x61, 0x21, 0x18, 0xca, 0x85, 
-0xc1, 0xda, 0x27, 0x83, 0x1e, 0x60, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7a, 
-0xce, 0xa1, 0x1b, 0x6c, 0x64, 0x20, 0x73, 0x70, 0x2c, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x2a, 0x3, 0x1, 0xd7, 0xde, 0xfa, 0xa6, 0x80, 0xf7, 0x4c, 0x24, 0xde, 
-0x87, 0xc2, 0xbc, 0x16, 0x63, 0x96, 0x4c, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x85, 
-0x8b, 0xf1, 0x6d, 0x6c, 0x64, 0x20, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2c, 0x28, 0x6e, 
-0x6e, 0x6e, 0x6e, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xed, 0x43, 0x3, 0x1, 0x98, 0x1f, 0x4d, 0x84, 0xac, 0xe8, 0xed, 0xc9, 0x5d, 
-0xc9, 0x61, 0x8f, 0x80, 0x3f, 0xbf, 0xc7, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x64, 
-0x1e, 0x87, 0x15, 0x6c, 0x64, 0x20, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2c, 0x3c, 0x62, 0x63, 
-0x2c, 0x64, 0x65, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x22, 0x3, 0x1, 0x0, 0x3, 0xd0, 0x72, 0x77, 0x53, 0x7f, 0x72, 0x3f, 0xea, 
-0x64, 0x80, 0xe1, 0x10, 0x2d, 0xe9, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa3, 
-0x60, 0x8b, 0x47, 0x6c, 0x64, 0x20, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2c, 0x68, 0x6c, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xed, 0x73, 0x3, 0x1, 0xdc, 0xc0, 0xd6, 0xd1, 0x5a, 0xed, 0x56, 0xf3, 0xda, 
-0xaf, 0xa7, 0x6c, 0x44, 0x9f, 0xa, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x16, 
-0x58, 0x5f, 0xd7, 0x6c, 0x64, 0x20, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2c, 0x73, 0x70, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x22, 0x3, 0x1, 0xc3, 0x6c, 0x91, 0xd, 0x0, 0x69, 0xf8, 0x8e, 0xd6, 
-0xe3, 0xf7, 0xc3, 0xc6, 0xd9, 0xdf, 0xc2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xba, 
-0x10, 0x2a, 0x6b, 0x6c, 0x64, 0x20, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2c, 0x3c, 0x69, 0x78, 
-0x2c, 0x69, 0x79, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x1, 0x0, 0x0, 0x0, 0x1c, 0x5c, 0x46, 0x2d, 0xb9, 0x8e, 0x78, 0x60, 0xb1, 
-0x74, 0xe, 0xb3, 0x46, 0xd1, 0xcc, 0x30, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 
-0x39, 0x19, 0x69, 0x6c, 0x64, 0x20, 0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 0x2c, 0x68, 0x6c, 0x2c, 
-0x73, 0x70, 0x3e, 0x2c, 0x6e, 0x6e, 0x6e, 0x6e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x21, 0x0, 0x0, 0xe8, 0x87, 0x6, 0x20, 0x12, 0xbd, 0x9b, 0xb6, 0x53, 
-0x72, 0xe5, 0xa1, 0x51, 0x13, 0xbd, 0xf1, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 
-0x7d, 0xd5, 0x25, 0x6c, 0x64, 0x20, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2c, 0x6e, 0x6e, 
-0x6e, 0x6e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xa, 0x0, 0x0, 0x0, 0xa8, 0xb3, 0x2a, 0x1d, 0x8e, 0x7f, 0xac, 0x42, 0x3, 
-0x1, 0x3, 0x1, 0xc6, 0xb1, 0x8e, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0xff, 0x0, 0x0, 0xb0, 
-0x81, 0x89, 0x35, 0x6c, 0x64, 0x20, 0x61, 0x2c, 0x3c, 0x28, 0x62, 0x63, 0x29, 0x2c, 0x28, 0x64, 
-0x65, 0x29, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x6, 0x0, 0x0, 0x0, 0x7, 0xc4, 0x9d, 0xf4, 0x3d, 0xd1, 0x39, 0x3, 0x89, 
-0xde, 0x55, 0x74, 0x53, 0xc0, 0x9, 0x55, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0xf1, 
-0xda, 0xb5, 0x56, 0x6c, 0x64, 0x20, 0x3c, 0x62, 0x2c, 0x63, 0x2c, 0x64, 0x2c, 0x65, 0x2c, 0x68, 
-0x2c, 0x6c, 0x2c, 0x28, 0x68, 0x6c, 0x29, 0x2c, 0x61, 0x3e, 0x2c, 0x6e, 0x6e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x36, 0x1, 0x0, 0x45, 0x1b, 0x2, 0x1, 0x2, 0x1, 0xc1, 0xd5, 0xc7, 
-0x61, 0xc4, 0xbd, 0xc0, 0x85, 0x16, 0xcd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x26, 
-0xdb, 0x47, 0x7e, 0x6c, 0x64, 0x20, 0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 
-0x29, 0x2c, 0x6e, 0x6e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x46, 0x1, 0x0, 0x16, 0xd0, 0x2, 0x1, 0x2, 0x1, 0x60, 0x42, 0x39, 
-0x7f, 0x4, 0x4, 0x97, 0x4a, 0x85, 0xd0, 0x20, 0x18, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 
-0x11, 0x6, 0xa8, 0x6c, 0x64, 0x20, 0x3c, 0x62, 0x2c, 0x63, 0x2c, 0x64, 0x2c, 0x65, 0x3e, 0x2c, 
-0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x66, 0x1, 0x0, 0xe0, 0x84, 0x2, 0x1, 0x2, 0x1, 0x52, 0x9c, 0x99, 
-0xa7, 0xb6, 0x49, 0x93, 0x0, 0xad, 0xee, 0x20, 0x8, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 
-0x2a, 0x4d, 0x3, 0x6c, 0x64, 0x20, 0x3c, 0x68, 0x2c, 0x6c, 0x3e, 0x2c, 0x28, 0x3c, 0x69, 0x78, 
-0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x7e, 0x1, 0x0, 0xb6, 0xd8, 0x2, 0x1, 0x2, 0x1, 0x12, 0xc6, 0x7, 
-0xdf, 0xd0, 0x9c, 0x43, 0xa6, 0xe5, 0xa0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa5, 
-0xe9, 0xac, 0x64, 0x6c, 0x64, 0x20, 0x61, 0x2c, 0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 
-0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x26, 0x0, 0x0, 0x53, 0x3c, 0x40, 0x46, 0x79, 0xe1, 0x11, 0x77, 0x7, 
-0xc1, 0xfa, 0x1a, 0x81, 0xad, 0x9b, 0x5d, 0x20, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x24, 
-0xe8, 0x82, 0x8b, 0x6c, 0x64, 0x20, 0x3c, 0x69, 0x78, 0x68, 0x2c, 0x69, 0x78, 0x6c, 0x2c, 0x69, 
-0x79, 0x68, 0x2c, 0x69, 0x79, 0x6c, 0x3e, 0x2c, 0x6e, 0x6e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x40, 0x0, 0x0, 0x0, 0xa4, 0x72, 0x24, 0xa0, 0xac, 0x61, 0x3, 0x1, 0xc7, 
-0x82, 0x8f, 0x71, 0x97, 0x8f, 0x8e, 0xef, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0x0, 0x0, 0x74, 
-0x4b, 0x1, 0x18, 0x6c, 0x64, 0x20, 0x3c, 0x62, 0x63, 0x64, 0x65, 0x68, 0x6c, 0x61, 0x3e, 0x2c, 
-0x3c, 0x62, 0x63, 0x64, 0x65, 0x68, 0x6c, 0x61, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x40, 0x0, 0x0, 0xc5, 0xbc, 0x3, 0x1, 0x3, 0x1, 0x3, 0x1, 0xc2, 
-0x2f, 0xc0, 0x98, 0x83, 0x1f, 0xcd, 0x3b, 0x20, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0x0, 0x0, 0x47, 
-0x8b, 0xa3, 0x6b, 0x6c, 0x64, 0x20, 0x3c, 0x62, 0x63, 0x64, 0x65, 0x78, 0x79, 0x61, 0x3e, 0x2c, 
-0x3c, 0x62, 0x63, 0x64, 0x65, 0x78, 0x79, 0x61, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x32, 0x3, 0x1, 0x0, 0x68, 0xfd, 0xec, 0xf4, 0xa0, 0x44, 0x43, 0xb5, 0x53, 
-0x6, 0xba, 0xcd, 0xd2, 0x4f, 0xd8, 0x1f, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0xff, 0x0, 0x0, 0xc9, 
-0x26, 0x2d, 0xe5, 0x6c, 0x64, 0x20, 0x61, 0x2c, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x20, 0x2f, 
-0x20, 0x6c, 0x64, 0x20, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2c, 0x61, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xed, 0xa8, 0x0, 0x0, 0x52, 0x98, 0xfa, 0x68, 0xa1, 0x66, 0x6, 0x1, 0x4, 
-0x1, 0x1, 0x0, 0xc1, 0x68, 0xb7, 0x20, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x94, 
-0xf4, 0x27, 0x69, 0x6c, 0x64, 0x64, 0x3c, 0x72, 0x3e, 0x20, 0x28, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xed, 0xa8, 0x0, 0x0, 0x2e, 0xf1, 0x2a, 0xeb, 0xba, 0xd5, 0x6, 0x1, 0x4, 
-0x1, 0x2, 0x0, 0x47, 0xff, 0xe4, 0xfb, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x39, 
-0xdd, 0x3d, 0xe1, 0x6c, 0x64, 0x64, 0x3c, 0x72, 0x3e, 0x20, 0x28, 0x32, 0x29, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xed, 0xa0, 0x0, 0x0, 0x30, 0xfe, 0xcd, 0x3, 0x58, 0x60, 0x5, 0x1, 0x3, 
-0x1, 0x1, 0x0, 0x4, 0x60, 0x88, 0x26, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xf7, 
-0x82, 0xb0, 0xd1, 0x6c, 0x64, 0x69, 0x3c, 0x72, 0x3e, 0x20, 0x28, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xed, 0xa0, 0x0, 0x0, 0xce, 0x4a, 0x6e, 0xc2, 0x88, 0xb1, 0x5, 0x1, 0x3, 
-0x1, 0x2, 0x0, 0x14, 0x2d, 0x9f, 0xa3, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xe9, 
-0xea, 0xd0, 0xae, 0x6c, 0x64, 0x69, 0x3c, 0x72, 0x3e, 0x20, 0x28, 0x32, 0x29, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xed, 0x44, 0x0, 0x0, 0xa2, 0x38, 0x6b, 0x5f, 0x34, 0xd9, 0xe4, 0x57, 0xd6, 
-0xd2, 0x42, 0x46, 0x43, 0x5a, 0xcc, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd6, 
-0x38, 0xdd, 0x6a, 0x6e, 0x65, 0x67, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xed, 0x67, 0x0, 0x0, 0xcb, 0x91, 0x8b, 0xc4, 0x62, 0xfa, 0x3, 0x1, 0x20, 
-0xe7, 0x79, 0xb4, 0x40, 0x6, 0xe2, 0x8a, 0x0, 0x8, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0xff, 0x0, 0x0, 0xff, 
-0x82, 0x3e, 0x77, 0x3c, 0x72, 0x72, 0x64, 0x2c, 0x72, 0x6c, 0x64, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x7, 0x0, 0x0, 0x0, 0x92, 0xcb, 0x43, 0x6d, 0x90, 0xa, 0x84, 0xc2, 0x53, 
-0xc, 0xe, 0xf5, 0x91, 0xeb, 0xfc, 0x40, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x9b, 
-0xa3, 0x80, 0x7c, 0x3c, 0x72, 0x6c, 0x63, 0x61, 0x2c, 0x72, 0x72, 0x63, 0x61, 0x2c, 0x72, 0x6c, 
-0x61, 0x2c, 0x72, 0x72, 0x61, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0xcb, 0x1, 0x6, 0xaf, 0xdd, 0x2, 0x1, 0x2, 0x1, 0x3c, 0xff, 0xf6, 
-0xdb, 0xf4, 0x94, 0x82, 0x80, 0xd9, 0x61, 0x20, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x57, 0x0, 0x0, 0x0, 0x71, 
-0x0, 0x34, 0xcb, 0x73, 0x68, 0x66, 0x2f, 0x72, 0x6f, 0x74, 0x20, 0x28, 0x3c, 0x69, 0x78, 0x2c, 
-0x69, 0x79, 0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xcb, 0x0, 0x0, 0x0, 0xeb, 0xcc, 0x4a, 0x5d, 0x7, 0xe0, 0x3, 0x1, 0x95, 
-0x13, 0xee, 0x30, 0x43, 0x78, 0xad, 0x3d, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x0, 0x0, 0xa4, 
-0x25, 0x58, 0x33, 0x73, 0x68, 0x66, 0x2f, 0x72, 0x6f, 0x74, 0x20, 0x3c, 0x62, 0x2c, 0x63, 0x2c, 
-0x64, 0x2c, 0x65, 0x2c, 0x68, 0x2c, 0x6c, 0x2c, 0x28, 0x68, 0x6c, 0x29, 0x2c, 0x61, 0x3e, 0x2e, 
-0x2e, 0x24, 0xff, 0xcb, 0x80, 0x0, 0x0, 0xd5, 0x2c, 0xab, 0x97, 0xff, 0x39, 0x3, 0x1, 0x4b, 
-0xd1, 0xb2, 0x6a, 0x53, 0x27, 0x38, 0xb5, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0x0, 0x0, 0x8b, 
-0x57, 0xf0, 0x8, 0x3c, 0x73, 0x65, 0x74, 0x2c, 0x72, 0x65, 0x73, 0x3e, 0x20, 0x6e, 0x2c, 0x3c, 
-0x62, 0x63, 0x64, 0x65, 0x68, 0x6c, 0x28, 0x68, 0x6c, 0x29, 0x61, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0xcb, 0x1, 0x86, 0x44, 0xfb, 0x2, 0x1, 0x2, 0x1, 0x9, 0xba, 0xbe, 
-0x68, 0xd8, 0x32, 0x10, 0x5e, 0x67, 0xa8, 0x20, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xcc, 
-0x63, 0xf9, 0x8a, 0x3c, 0x73, 0x65, 0x74, 0x2c, 0x72, 0x65, 0x73, 0x3e, 0x20, 0x6e, 0x2c, 0x28, 
-0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x70, 0x1, 0x0, 0xd, 0x27, 0x2, 0x1, 0x2, 0x1, 0x3a, 0xb7, 0x7b, 
-0x88, 0xee, 0x99, 0x86, 0x70, 0x7, 0xca, 0x20, 0x3, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x4, 
-0x62, 0x6a, 0xbf, 0x6c, 0x64, 0x20, 0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 
-0x29, 0x2c, 0x3c, 0x62, 0x2c, 0x63, 0x2c, 0x64, 0x2c, 0x65, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x74, 0x1, 0x0, 0x64, 0xb6, 0x2, 0x1, 0x2, 0x1, 0xac, 0xe8, 0xf5, 
-0xb5, 0xfe, 0xaa, 0x12, 0x10, 0x66, 0x95, 0x20, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6a, 
-0x1a, 0x88, 0x31, 0x6c, 0x64, 0x20, 0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 
-0x29, 0x2c, 0x3c, 0x68, 0x2c, 0x6c, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0xdd, 0x77, 0x1, 0x0, 0xaf, 0x67, 0x2, 0x1, 0x2, 0x1, 0x13, 0x4f, 0x44, 
-0x6, 0xd7, 0xbc, 0x50, 0xac, 0xaf, 0x5f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0xcc, 
-0xbe, 0x5a, 0x96, 0x6c, 0x64, 0x20, 0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 
-0x29, 0x2c, 0x61, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xff, 0x2, 0x0, 0x0, 0x0, 0x3b, 0xc, 0x92, 0xb5, 0xff, 0x6c, 0x9e, 0x95, 0x3, 
-0x1, 0x4, 0x1, 0xc1, 0x21, 0xe7, 0xbd, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x7a, 
-0x4c, 0x11, 0x4f, 0x6c, 0x64, 0x20, 0x28, 0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 0x3e, 0x29, 0x2c, 
-0x61, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xe5, 0x7e, 0x23, 0x66, 0x6f, 0x7e, 0x32, 0x65, 0x1d, 0x23, 0xe5, 0x11, 0x14, 0x0, 
-0x19, 0x11, 0xda, 0x1c, 0xcd, 0x49, 0x1c, 0xe1, 0xe5, 0x11, 0x28, 0x0, 0x19, 0x11, 0x2, 0x1d, 
-0xcd, 0x49, 0x1c, 0x21, 0x2, 0x1d, 0x36, 0x1, 0xe1, 0xe5, 0x11, 0x42, 0x1d, 0x1, 0x4, 0x0, 
-0xed, 0xb0, 0x11, 0x3, 0x1, 0x1, 0x10, 0x0, 0xed, 0xb0, 0x11, 0x2c, 0x0, 0x19, 0xeb, 0xe, 
-0x9, 0xcd, 0xce, 0x1d, 0xcd, 0x71, 0x1e, 0x3a, 0x42, 0x1d, 0xfe, 0x76, 0xca, 0x3e, 0x1b, 0xe6, 
-0xdf, 0xfe, 0xdd, 0xc2, 0x3b, 0x1b, 0x3a, 0x43, 0x1d, 0xfe, 0x76, 0xc4, 0x2a, 0x1d, 0xcd, 0x89, 
-0x1c, 0xc4, 0xad, 0x1c, 0xe1, 0xca, 0x7a, 0x1b, 0x11, 0x3c, 0x0, 0x19, 0xcd, 0x32, 0x1e, 0x11, 
-0x5, 0x1e, 0xca, 0x71, 0x1b, 0x11, 0xc, 0x1e, 0xe, 0x9, 0xcd, 0xce, 0x1d, 0xcd, 0x99, 0x1d, 
-0x11, 0x27, 0x1e, 0xe, 0x9, 0xcd, 0xce, 0x1d, 0x21, 0x85, 0x1e, 0xcd, 0x99, 0x1d, 0x11, 0x2f, 
-0x1e, 0xe, 0x9, 0xcd, 0xce, 0x1d, 0xe1, 0x23, 0x23, 0xc9, 0xe5, 0x3e, 0x1, 0x32, 0xf0, 0x1b, 
-0x32, 0x14, 0x1c, 0x21, 0xda, 0x1c, 0x22, 0xf1, 0x1b, 0x21, 0x2, 0x1d, 0x22, 0x15, 0x1c, 0x6, 
-0x4, 0xe1, 0xe5, 0x11, 0x42, 0x1d, 0xcd, 0xa4, 0x1b, 0x6, 0x10, 0x11, 0x3, 0x1, 0xcd, 0xa4, 
-0x1b, 0xc3, 0x27, 0x1b, 0xcd, 0xad, 0x1b, 0x23, 0x5, 0xc2, 0xa4, 0x1b, 0xc9, 0xc5, 0xd5, 0xe5, 
-0x4e, 0x11, 0x14, 0x0, 0x19, 0x7e, 0xfe, 0x0, 0xca, 0xce, 0x1b, 0x6, 0x8, 0xf, 0xf5, 0x3e, 
-0x0, 0xdc, 0xf3, 0x1b, 0xa9, 0xf, 0x4f, 0xf1, 0x5, 0xc2, 0xbd, 0x1b, 0x6, 0x8, 0x11, 0x14, 
-0x0, 0x19, 0x7e, 0xfe, 0x0, 0xca, 0xe9, 0x1b, 0x6, 0x8, 0xf, 0xf5, 0x3e, 0x0, 0xdc, 0x17, 
-0x1c, 0xa9, 0xf, 0x4f, 0xf1, 0x5, 0xc2, 0xda, 0x1b, 0xe1, 0xd1, 0x79, 0x12, 0x13, 0xc1, 0xc9, 
-0x0, 0x0, 0x0, 0xc5, 0xe5, 0x2a, 0xf1, 0x1b, 0x46, 0x21, 0xf0, 0x1b, 0x7e, 0x4f, 0x7, 0x77, 
-0xfe, 0x1, 0xc2, 0xc, 0x1c, 0x2a, 0xf1, 0x1b, 0x23, 0x22, 0xf1, 0x1b, 0x78, 0xa1, 0xe1, 0xc1, 
-0xc8, 0x3e, 0x1, 0xc9, 0x0, 0x0, 0x0, 0xc5, 0xe5, 0x2a, 0x15, 0x1c, 0x46, 0x21, 0x14, 0x1c, 
-0x7e, 0x4f, 0x7, 0x77, 0xfe, 0x1, 0xc2, 0x30, 0x1c, 0x2a, 0x15, 0x1c, 0x23, 0x22, 0x15, 0x1c, 
-0x78, 0xa1, 0xe1, 0xc1, 0xc8, 0x3e, 0x1, 0xc9, 0xf5, 0xc5, 0xd5, 0xe5, 0x36, 0x0, 0x54, 0x5d, 
-0x13, 0xb, 0xed, 0xb0, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0xd5, 0xeb, 0x1, 0x28, 0x0, 0xcd, 0x38, 
-0x1c, 0xeb, 0x6, 0x14, 0xe, 0x1, 0x16, 0x0, 0x5e, 0x7b, 0xa1, 0xca, 0x5f, 0x1c, 0x14, 0x79, 
-0x7, 0x4f, 0xfe, 0x1, 0xc2, 0x59, 0x1c, 0x23, 0x5, 0xc2, 0x58, 0x1c, 0x7a, 0xe6, 0xf8, 0xf, 
-0xf, 0xf, 0x6f, 0x26, 0x0, 0x7a, 0xe6, 0x7, 0x3c, 0x47, 0x3e, 0x80, 0x7, 0x5, 0xc2, 0x7c, 
-0x1c, 0xd1, 0x19, 0x11, 0x14, 0x0, 0x19, 0x77, 0xc9, 0xc5, 0xd5, 0xe5, 0x21, 0xda, 0x1c, 0x11, 
-0x14, 0x0, 0xeb, 0x19, 0xeb, 0x34, 0x7e, 0xfe, 0x0, 0xca, 0xa8, 0x1c, 0x47, 0x1a, 0xa0, 0xca, 
-0xa4, 0x1c, 0x36, 0x0, 0xc1, 0xd1, 0xe1, 0xc9, 0x23, 0x13, 0xc3, 0x95, 0x1c, 0xc5, 0xd5, 0xe5, 
-0x21, 0x2, 0x1d, 0x11, 0x14, 0x0, 0xeb, 0x19, 0xeb, 0x7e, 0xb7, 0xca, 0xd5, 0x1c, 0x47, 0x1a, 
-0xa0, 0xc2, 0xd1, 0x1c, 0x78, 0x7, 0xfe, 0x1, 0xc2, 0xcf, 0x1c, 0x36, 0x0, 0x23, 0x13, 0x77, 
-0xaf, 0xe1, 0xd1, 0xc1, 0xc9, 0x23, 0x13, 0xc3, 0xb9, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf5, 0xc5, 0xd5, 0xe5, 0xf3, 0xed, 
-0x73, 0x8d, 0x1d, 0x31, 0x5, 0x1, 0xfd, 0xe1, 0xdd, 0xe1, 0xe1, 0xd1, 0xc1, 0xf1, 0xed, 0x7b, 
-0x11, 0x1, 0x0, 0x0, 0x0, 0x0, 0xed, 0x73, 0x8b, 0x1d, 0x31, 0x8b, 0x1d, 0xf5, 0xc5, 0xd5, 
-0xe5, 0xdd, 0xe5, 0xfd, 0xe5, 0xed, 0x7b, 0x8d, 0x1d, 0xfb, 0x2a, 0x3, 0x1, 0x22, 0x7d, 0x1d, 
-0x21, 0x89, 0x1d, 0x7e, 0xe6, 0xd7, 0x77, 0x6, 0x10, 0x11, 0x7d, 0x1d, 0x21, 0x85, 0x1e, 0x1a, 
-0x13, 0xcd, 0x49, 0x1e, 0x5, 0xc2, 0x6f, 0x1d, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 
-0xcd, 0xab, 0x1d, 0x23, 0x5, 0xc2, 0x8f, 0x1d, 0xc9, 0xf5, 0xc5, 0xe5, 0x6, 0x4, 0x7e, 0xcd, 
-0xab, 0x1d, 0x23, 0x5, 0xc2, 0x9e, 0x1d, 0xe1, 0xc1, 0xf1, 0xc9, 0xf5, 0xf, 0xf, 0xf, 0xf, 
-0xcd, 0xb4, 0x1d, 0xf1, 0xf5, 0xc5, 0xd5, 0xe5, 0xe6, 0xf, 0xfe, 0xa, 0xda, 0xc1, 0x1d, 0xc6, 
-0x27, 0xc6, 0x30, 0x5f, 0xe, 0x2, 0xcd, 0xce, 0x1d, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0xf5, 0xc5, 
-0xd5, 0xe5, 0xcd, 0x5, 0x0, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0x5a, 0x38, 0x30, 0x20, 0x69, 0x6e, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x65, 0x78, 0x65, 0x72, 0x63, 0x69, 
-0x73, 0x65, 0x72, 0xa, 0xd, 0x24, 0x54, 0x65, 0x73, 0x74, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70, 
-0x6c, 0x65, 0x74, 0x65, 0x24, 0x20, 0x20, 0x4f, 0x4b, 0xa, 0xd, 0x24, 0x20, 0x20, 0x45, 0x52, 
-0x52, 0x4f, 0x52, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x63, 0x72, 0x63, 0x20, 0x65, 0x78, 0x70, 
-0x65, 0x63, 0x74, 0x65, 0x64, 0x3a, 0x24, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x24, 0xa, 
-0xd, 0x24, 0xc5, 0xd5, 0xe5, 0x11, 0x85, 0x1e, 0x6, 0x4, 0x1a, 0xbe, 0xc2, 0x45, 0x1e, 0x23, 
-0x13, 0x5, 0xc2, 0x3a, 0x1e, 0xe1, 0xd1, 0xc1, 0xc9, 0xf5, 0xc5, 0xd5, 0xe5, 0xe5, 0x11, 0x3, 
-0x0, 0x19, 0xae, 0x6f, 0x26, 0x0, 0x29, 0x29, 0xeb, 0x21, 0x89, 0x1e, 0x19, 0xeb, 0xe1, 0x1, 
-0x4, 0x0, 0x1a, 0xa8, 0x46, 0x77, 0x13, 0x23, 0xd, 0xc2, 0x62, 0x1e, 0xe1, 0xd1, 0xc1, 0xf1, 
-0xc9, 0xf5, 0xc5, 0xe5, 0x21, 0x85, 0x1e, 0x3e, 0xff, 0x6, 0x4, 0x77, 0x23, 0x5, 0xc2, 0x7b, 
-0x1e, 0xe1, 0xc1, 0xf1, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0x7, 0x30, 
-0x96, 0xee, 0xe, 0x61, 0x2c, 0x99, 0x9, 0x51, 0xba, 0x7, 0x6d, 0xc4, 0x19, 0x70, 0x6a, 0xf4, 
-0x8f, 0xe9, 0x63, 0xa5, 0x35, 0x9e, 0x64, 0x95, 0xa3, 0xe, 0xdb, 0x88, 0x32, 0x79, 0xdc, 0xb8, 
-0xa4, 0xe0, 0xd5, 0xe9, 0x1e, 0x97, 0xd2, 0xd9, 0x88, 0x9, 0xb6, 0x4c, 0x2b, 0x7e, 0xb1, 0x7c, 
-0xbd, 0xe7, 0xb8, 0x2d, 0x7, 0x90, 0xbf, 0x1d, 0x91, 0x1d, 0xb7, 0x10, 0x64, 0x6a, 0xb0, 0x20, 
-0xf2, 0xf3, 0xb9, 0x71, 0x48, 0x84, 0xbe, 0x41, 0xde, 0x1a, 0xda, 0xd4, 0x7d, 0x6d, 0xdd, 0xe4, 
-0xeb, 0xf4, 0xd4, 0xb5, 0x51, 0x83, 0xd3, 0x85, 0xc7, 0x13, 0x6c, 0x98, 0x56, 0x64, 0x6b, 0xa8, 
-0xc0, 0xfd, 0x62, 0xf9, 0x7a, 0x8a, 0x65, 0xc9, 0xec, 0x14, 0x1, 0x5c, 0x4f, 0x63, 0x6, 0x6c, 
-0xd9, 0xfa, 0xf, 0x3d, 0x63, 0x8d, 0x8, 0xd, 0xf5, 0x3b, 0x6e, 0x20, 0xc8, 0x4c, 0x69, 0x10, 
-0x5e, 0xd5, 0x60, 0x41, 0xe4, 0xa2, 0x67, 0x71, 0x72, 0x3c, 0x3, 0xe4, 0xd1, 0x4b, 0x4, 0xd4, 
-0x47, 0xd2, 0xd, 0x85, 0xfd, 0xa5, 0xa, 0xb5, 0x6b, 0x35, 0xb5, 0xa8, 0xfa, 0x42, 0xb2, 0x98, 
-0x6c, 0xdb, 0xbb, 0xc9, 0xd6, 0xac, 0xbc, 0xf9, 0x40, 0x32, 0xd8, 0x6c, 0xe3, 0x45, 0xdf, 0x5c, 
-0x75, 0xdc, 0xd6, 0xd, 0xcf, 0xab, 0xd1, 0x3d, 0x59, 0x26, 0xd9, 0x30, 0xac, 0x51, 0xde, 0x0, 
-0x3a, 0xc8, 0xd7, 0x51, 0x80, 0xbf, 0xd0, 0x61, 0x16, 0x21, 0xb4, 0xf4, 0xb5, 0x56, 0xb3, 0xc4, 
-0x23, 0xcf, 0xba, 0x95, 0x99, 0xb8, 0xbd, 0xa5, 0xf, 0x28, 0x2, 0xb8, 0x9e, 0x5f, 0x5, 0x88, 
-0x8, 0xc6, 0xc, 0xd9, 0xb2, 0xb1, 0xb, 0xe9, 0x24, 0x2f, 0x6f, 0x7c, 0x87, 0x58, 0x68, 0x4c, 
-0x11, 0xc1, 0x61, 0x1d, 0xab, 0xb6, 0x66, 0x2d, 0x3d, 0x76, 0xdc, 0x41, 0x90, 0x1, 0xdb, 0x71, 
-0x6, 0x98, 0xd2, 0x20, 0xbc, 0xef, 0xd5, 0x10, 0x2a, 0x71, 0xb1, 0x85, 0x89, 0x6, 0xb6, 0xb5, 
-0x1f, 0x9f, 0xbf, 0xe4, 0xa5, 0xe8, 0xb8, 0xd4, 0x33, 0x78, 0x7, 0xc9, 0xa2, 0xf, 0x0, 0xf9, 
-0x34, 0x96, 0x9, 0xa8, 0x8e, 0xe1, 0xe, 0x98, 0x18, 0x7f, 0x6a, 0xd, 0xbb, 0x8, 0x6d, 0x3d, 
-0x2d, 0x91, 0x64, 0x6c, 0x97, 0xe6, 0x63, 0x5c, 0x1, 0x6b, 0x6b, 0x51, 0xf4, 0x1c, 0x6c, 0x61, 
-0x62, 0x85, 0x65, 0x30, 0xd8, 0xf2, 0x62, 0x0, 0x4e, 0x6c, 0x6, 0x95, 0xed, 0x1b, 0x1, 0xa5, 
-0x7b, 0x82, 0x8, 0xf4, 0xc1, 0xf5, 0xf, 0xc4, 0x57, 0x65, 0xb0, 0xd9, 0xc6, 0x12, 0xb7, 0xe9, 
-0x50, 0x8b, 0xbe, 0xb8, 0xea, 0xfc, 0xb9, 0x88, 0x7c, 0x62, 0xdd, 0x1d, 0xdf, 0x15, 0xda, 0x2d, 
-0x49, 0x8c, 0xd3, 0x7c, 0xf3, 0xfb, 0xd4, 0x4c, 0x65, 0x4d, 0xb2, 0x61, 0x58, 0x3a, 0xb5, 0x51, 
-0xce, 0xa3, 0xbc, 0x0, 0x74, 0xd4, 0xbb, 0x30, 0xe2, 0x4a, 0xdf, 0xa5, 0x41, 0x3d, 0xd8, 0x95, 
-0xd7, 0xa4, 0xd1, 0xc4, 0x6d, 0xd3, 0xd6, 0xf4, 0xfb, 0x43, 0x69, 0xe9, 0x6a, 0x34, 0x6e, 0xd9, 
-0xfc, 0xad, 0x67, 0x88, 0x46, 0xda, 0x60, 0xb8, 0xd0, 0x44, 0x4, 0x2d, 0x73, 0x33, 0x3, 0x1d, 
-0xe5, 0xaa, 0xa, 0x4c, 0x5f, 0xdd, 0xd, 0x7c, 0xc9, 0x50, 0x5, 0x71, 0x3c, 0x27, 0x2, 0x41, 
-0xaa, 0xbe, 0xb, 0x10, 0x10, 0xc9, 0xc, 0x20, 0x86, 0x57, 0x68, 0xb5, 0x25, 0x20, 0x6f, 0x85, 
-0xb3, 0xb9, 0x66, 0xd4, 0x9, 0xce, 0x61, 0xe4, 0x9f, 0x5e, 0xde, 0xf9, 0xe, 0x29, 0xd9, 0xc9, 
-0x98, 0xb0, 0xd0, 0x98, 0x22, 0xc7, 0xd7, 0xa8, 0xb4, 0x59, 0xb3, 0x3d, 0x17, 0x2e, 0xb4, 0xd, 
-0x81, 0xb7, 0xbd, 0x5c, 0x3b, 0xc0, 0xba, 0x6c, 0xad, 0xed, 0xb8, 0x83, 0x20, 0x9a, 0xbf, 0xb3, 
-0xb6, 0x3, 0xb6, 0xe2, 0xc, 0x74, 0xb1, 0xd2, 0x9a, 0xea, 0xd5, 0x47, 0x39, 0x9d, 0xd2, 0x77, 
-0xaf, 0x4, 0xdb, 0x26, 0x15, 0x73, 0xdc, 0x16, 0x83, 0xe3, 0x63, 0xb, 0x12, 0x94, 0x64, 0x3b, 
-0x84, 0xd, 0x6d, 0x6a, 0x3e, 0x7a, 0x6a, 0x5a, 0xa8, 0xe4, 0xe, 0xcf, 0xb, 0x93, 0x9, 0xff, 
-0x9d, 0xa, 0x0, 0xae, 0x27, 0x7d, 0x7, 0x9e, 0xb1, 0xf0, 0xf, 0x93, 0x44, 0x87, 0x8, 0xa3, 
-0xd2, 0x1e, 0x1, 0xf2, 0x68, 0x69, 0x6, 0xc2, 0xfe, 0xf7, 0x62, 0x57, 0x5d, 0x80, 0x65, 0x67, 
-0xcb, 0x19, 0x6c, 0x36, 0x71, 0x6e, 0x6b, 0x6, 0xe7, 0xfe, 0xd4, 0x1b, 0x76, 0x89, 0xd3, 0x2b, 
-0xe0, 0x10, 0xda, 0x7a, 0x5a, 0x67, 0xdd, 0x4a, 0xcc, 0xf9, 0xb9, 0xdf, 0x6f, 0x8e, 0xbe, 0xef, 
-0xf9, 0x17, 0xb7, 0xbe, 0x43, 0x60, 0xb0, 0x8e, 0xd5, 0xd6, 0xd6, 0xa3, 0xe8, 0xa1, 0xd1, 0x93, 
-0x7e, 0x38, 0xd8, 0xc2, 0xc4, 0x4f, 0xdf, 0xf2, 0x52, 0xd1, 0xbb, 0x67, 0xf1, 0xa6, 0xbc, 0x57, 
-0x67, 0x3f, 0xb5, 0x6, 0xdd, 0x48, 0xb2, 0x36, 0x4b, 0xd8, 0xd, 0x2b, 0xda, 0xaf, 0xa, 0x1b, 
-0x4c, 0x36, 0x3, 0x4a, 0xf6, 0x41, 0x4, 0x7a, 0x60, 0xdf, 0x60, 0xef, 0xc3, 0xa8, 0x67, 0xdf, 
-0x55, 0x31, 0x6e, 0x8e, 0xef, 0x46, 0x69, 0xbe, 0x79, 0xcb, 0x61, 0xb3, 0x8c, 0xbc, 0x66, 0x83, 
-0x1a, 0x25, 0x6f, 0xd2, 0xa0, 0x52, 0x68, 0xe2, 0x36, 0xcc, 0xc, 0x77, 0x95, 0xbb, 0xb, 0x47, 
-0x3, 0x22, 0x2, 0x16, 0xb9, 0x55, 0x5, 0x26, 0x2f, 0xc5, 0xba, 0x3b, 0xbe, 0xb2, 0xbd, 0xb, 
-0x28, 0x2b, 0xb4, 0x5a, 0x92, 0x5c, 0xb3, 0x6a, 0x4, 0xc2, 0xd7, 0xff, 0xa7, 0xb5, 0xd0, 0xcf, 
-0x31, 0x2c, 0xd9, 0x9e, 0x8b, 0x5b, 0xde, 0xae, 0x1d, 0x9b, 0x64, 0xc2, 0xb0, 0xec, 0x63, 0xf2, 
-0x26, 0x75, 0x6a, 0xa3, 0x9c, 0x2, 0x6d, 0x93, 0xa, 0x9c, 0x9, 0x6, 0xa9, 0xeb, 0xe, 0x36, 
-0x3f, 0x72, 0x7, 0x67, 0x85, 0x5, 0x0, 0x57, 0x13, 0x95, 0xbf, 0x4a, 0x82, 0xe2, 0xb8, 0x7a, 
-0x14, 0x7b, 0xb1, 0x2b, 0xae, 0xc, 0xb6, 0x1b, 0x38, 0x92, 0xd2, 0x8e, 0x9b, 0xe5, 0xd5, 0xbe, 
-0xd, 0x7c, 0xdc, 0xef, 0xb7, 0xb, 0xdb, 0xdf, 0x21, 0x86, 0xd3, 0xd2, 0xd4, 0xf1, 0xd4, 0xe2, 
-0x42, 0x68, 0xdd, 0xb3, 0xf8, 0x1f, 0xda, 0x83, 0x6e, 0x81, 0xbe, 0x16, 0xcd, 0xf6, 0xb9, 0x26, 
-0x5b, 0x6f, 0xb0, 0x77, 0xe1, 0x18, 0xb7, 0x47, 0x77, 0x88, 0x8, 0x5a, 0xe6, 0xff, 0xf, 0x6a, 
-0x70, 0x66, 0x6, 0x3b, 0xca, 0x11, 0x1, 0xb, 0x5c, 0x8f, 0x65, 0x9e, 0xff, 0xf8, 0x62, 0xae, 
-0x69, 0x61, 0x6b, 0xff, 0xd3, 0x16, 0x6c, 0xcf, 0x45, 0xa0, 0xa, 0xe2, 0x78, 0xd7, 0xd, 0xd2, 
-0xee, 0x4e, 0x4, 0x83, 0x54, 0x39, 0x3, 0xb3, 0xc2, 0xa7, 0x67, 0x26, 0x61, 0xd0, 0x60, 0x16, 
-0xf7, 0x49, 0x69, 0x47, 0x4d, 0x3e, 0x6e, 0x77, 0xdb, 0xae, 0xd1, 0x6a, 0x4a, 0xd9, 0xd6, 0x5a, 
-0xdc, 0x40, 0xdf, 0xb, 0x66, 0x37, 0xd8, 0x3b, 0xf0, 0xa9, 0xbc, 0xae, 0x53, 0xde, 0xbb, 0x9e, 
-0xc5, 0x47, 0xb2, 0xcf, 0x7f, 0x30, 0xb5, 0xff, 0xe9, 0xbd, 0xbd, 0xf2, 0x1c, 0xca, 0xba, 0xc2, 
-0x8a, 0x53, 0xb3, 0x93, 0x30, 0x24, 0xb4, 0xa3, 0xa6, 0xba, 0xd0, 0x36, 0x5, 0xcd, 0xd7, 0x6, 
-0x93, 0x54, 0xde, 0x57, 0x29, 0x23, 0xd9, 0x67, 0xbf, 0xb3, 0x66, 0x7a, 0x2e, 0xc4, 0x61, 0x4a, 
-0xb8, 0x5d, 0x68, 0x1b, 0x2, 0x2a, 0x6f, 0x2b, 0x94, 0xb4, 0xb, 0xbe, 0x37, 0xc3, 0xc, 0x8e, 
-0xa1, 0x5a, 0x5, 0xdf, 0x1b, 0x2d, 0x2, 0xef, 0x8d, 
-};
-unsigned char dump_zexdoc[8585] = {
-0xc3, 0x13, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x2a, 0x6, 0x0, 0xf9, 0x11, 0xda, 0x1d, 0xe, 0x9, 0xcd, 0xce, 0x1d, 0x21, 
-0x3a, 0x1, 0x7e, 0x23, 0xb6, 0xca, 0x2f, 0x1, 0x2b, 0xcd, 0xe2, 0x1a, 0xc3, 0x22, 0x1, 0x11, 
-0xf6, 0x1d, 0xe, 0x9, 0xcd, 0xce, 0x1d, 0xc3, 0x0, 0x0, 0xc2, 0x1, 0x22, 0x2, 0x82, 0x2, 
-0xe2, 0x2, 0x42, 0x3, 0xa2, 0x3, 0x2, 0x4, 0x62, 0x4, 0xc2, 0x4, 0x22, 0x5, 0x82, 0x5, 
-0xe2, 0x5, 0x42, 0x6, 0xa2, 0x6, 0x2, 0x7, 0x62, 0x7, 0xc2, 0x7, 0x22, 0x8, 0x82, 0x8, 
-0xe2, 0x8, 0x42, 0x9, 0xa2, 0x9, 0x2, 0xa, 0x62, 0xa, 0xc2, 0xa, 0x22, 0xb, 0x82, 0xb, 
-0xe2, 0xb, 0x42, 0xc, 0xa2, 0xc, 0x2, 0xd, 0x62, 0xd, 0xc2, 0xd, 0x22, 0xe, 0x82, 0xe, 
-0xe2, 0xe, 0x42, 0xf, 0xa2, 0xf, 0x2, 0x10, 0x62, 0x10, 0xc2, 0x10, 0x22, 0x11, 0x82, 0x11, 
-0xe2, 0x11, 0x42, 0x12, 0xa2, 0x12, 0x2, 0x13, 0x62, 0x13, 0xc2, 0x13, 0x22, 0x14, 0x82, 0x14, 
-0xe2, 0x14, 0x42, 0x15, 0xa2, 0x15, 0x2, 0x16, 0x62, 0x16, 0xc2, 0x16, 0x22, 0x17, 0x82, 0x17, 
-0xe2, 0x17, 0x42, 0x18, 0xa2, 0x18, 0x2, 0x19, 0x62, 0x19, 0xc2, 0x19, 0x22, 0x1a, 0x82, 0x1a, 
-0x0, 0x0, 0xc7, 0xed, 0x42, 0x0, 0x0, 0x2c, 0x83, 0x88, 0x4f, 0x2b, 0xf2, 0x39, 0xb3, 0x1f, 
-0x7e, 0x63, 0x15, 0xd3, 0x89, 0x5e, 0x46, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x21, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x0, 0xff, 0xff, 0xf8, 
-0xb4, 0xea, 0xa9, 0x3c, 0x61, 0x64, 0x63, 0x2c, 0x73, 0x62, 0x63, 0x3e, 0x20, 0x68, 0x6c, 0x2c, 
-0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 0x2c, 0x68, 0x6c, 0x2c, 0x73, 0x70, 0x3e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xc7, 0x9, 0x0, 0x0, 0x0, 0xa5, 0xc4, 0xc7, 0xc4, 0x26, 0xd2, 0x50, 0xa0, 0xea, 
-0x58, 0x66, 0x85, 0xc6, 0xde, 0xc9, 0x9b, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x21, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x0, 0xff, 0xff, 0x89, 
-0xfd, 0xb6, 0x35, 0x61, 0x64, 0x64, 0x20, 0x68, 0x6c, 0x2c, 0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 
-0x2c, 0x68, 0x6c, 0x2c, 0x73, 0x70, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xc7, 0xdd, 0x9, 0x0, 0x0, 0xac, 0xdd, 0x94, 0xc2, 0x5b, 0x63, 0xd3, 0x33, 0x76, 
-0x6a, 0x20, 0xfa, 0x94, 0x68, 0xf5, 0x36, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 
-0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x0, 0xff, 0xff, 0xc1, 
-0x33, 0x79, 0xb, 0x61, 0x64, 0x64, 0x20, 0x69, 0x78, 0x2c, 0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 
-0x2c, 0x69, 0x78, 0x2c, 0x73, 0x70, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xc7, 0xfd, 0x9, 0x0, 0x0, 0xc2, 0xc7, 0x7, 0xf4, 0xc1, 0x51, 0x96, 0x3e, 0xf4, 
-0xb, 0xf, 0x51, 0x92, 0x1e, 0xea, 0x71, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x21, 0xf8, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x0, 0xff, 0xff, 0xe8, 
-0x81, 0x7b, 0x9e, 0x61, 0x64, 0x64, 0x20, 0x69, 0x79, 0x2c, 0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 
-0x2c, 0x69, 0x79, 0x2c, 0x73, 0x70, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xc6, 0x0, 0x0, 0x0, 0x40, 0x91, 0x3c, 0x7e, 0x67, 0x7a, 0x6d, 0xdf, 0x61, 
-0x5b, 0x29, 0xb, 0x10, 0x66, 0xb2, 0x85, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x48, 
-0x79, 0x93, 0x60, 0x61, 0x6c, 0x75, 0x6f, 0x70, 0x20, 0x61, 0x2c, 0x6e, 0x6e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x80, 0x0, 0x0, 0x0, 0x3e, 0xc5, 0x3a, 0x57, 0x4d, 0x4c, 0x3, 0x1, 0x9, 
-0xe3, 0x66, 0xa6, 0xd0, 0x3b, 0xbb, 0xad, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x0, 0x0, 0x0, 0xfe, 
-0x43, 0xb0, 0x16, 0x61, 0x6c, 0x75, 0x6f, 0x70, 0x20, 0x61, 0x2c, 0x3c, 0x62, 0x2c, 0x63, 0x2c, 
-0x64, 0x2c, 0x65, 0x2c, 0x68, 0x2c, 0x6c, 0x2c, 0x28, 0x68, 0x6c, 0x29, 0x2c, 0x61, 0x3e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x84, 0x0, 0x0, 0xf7, 0xd6, 0x6e, 0xc7, 0xcf, 0xac, 0x47, 0x28, 0xdd, 
-0x22, 0x35, 0xc0, 0xc5, 0x38, 0x4b, 0x23, 0x20, 0x39, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x0, 0x0, 0x0, 0xa4, 
-0x2, 0x6d, 0x5a, 0x61, 0x6c, 0x75, 0x6f, 0x70, 0x20, 0x61, 0x2c, 0x3c, 0x69, 0x78, 0x68, 0x2c, 
-0x69, 0x78, 0x6c, 0x2c, 0x69, 0x79, 0x68, 0x2c, 0x69, 0x79, 0x6c, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x86, 0x1, 0x0, 0xb7, 0x90, 0x2, 0x1, 0x2, 0x1, 0xfd, 0x32, 0x6e, 
-0x40, 0xdc, 0xc1, 0x45, 0x6e, 0xfa, 0xe5, 0x20, 0x38, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xe8, 
-0x49, 0x67, 0x6e, 0x61, 0x6c, 0x75, 0x6f, 0x70, 0x20, 0x61, 0x2c, 0x28, 0x3c, 0x69, 0x78, 0x2c, 
-0x69, 0x79, 0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0x53, 0xdd, 0xcb, 0x1, 0x46, 0x75, 0x20, 0x2, 0x1, 0x2, 0x1, 0xfc, 0x3c, 0x9a, 
-0xa7, 0x74, 0x3d, 0x51, 0x27, 0x14, 0xca, 0x20, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa8, 
-0xee, 0x8, 0x67, 0x62, 0x69, 0x74, 0x20, 0x6e, 0x2c, 0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 
-0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0x53, 0xcb, 0x40, 0x0, 0x0, 0xf1, 0x3e, 0xfc, 0x9d, 0xcc, 0x7a, 0x3, 0x1, 0x61, 
-0xbe, 0x86, 0x7a, 0x50, 0x24, 0x98, 0x19, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0x0, 0x0, 0x7b, 
-0x55, 0xe6, 0xc8, 0x62, 0x69, 0x74, 0x20, 0x6e, 0x2c, 0x3c, 0x62, 0x2c, 0x63, 0x2c, 0x64, 0x2c, 
-0x65, 0x2c, 0x68, 0x2c, 0x6c, 0x2c, 0x28, 0x68, 0x6c, 0x29, 0x2c, 0x61, 0x3e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xed, 0xa9, 0x0, 0x0, 0xb6, 0xc7, 0xb4, 0x72, 0xf6, 0x18, 0x14, 0x1, 0xbd, 
-0x8d, 0x1, 0x0, 0xc0, 0x30, 0xa3, 0x94, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xa8, 
-0x7e, 0x6c, 0xfa, 0x63, 0x70, 0x64, 0x3c, 0x72, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xed, 0xa1, 0x0, 0x0, 0x48, 0x4d, 0x4a, 0xaf, 0x6b, 0x90, 0x3, 0x1, 0x71, 
-0x4e, 0x1, 0x0, 0x93, 0x6a, 0x7c, 0x90, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x6, 
-0xde, 0xb3, 0x56, 0x63, 0x70, 0x69, 0x3c, 0x72, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x27, 0x0, 0x0, 0x0, 0x41, 0x21, 0xfa, 0x9, 0x60, 0x1d, 0x59, 0xa5, 0x5b, 
-0x8d, 0x79, 0x90, 0x4, 0x8e, 0x9d, 0x29, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9b, 
-0x4b, 0xa6, 0x75, 0x3c, 0x64, 0x61, 0x61, 0x2c, 0x63, 0x70, 0x6c, 0x2c, 0x73, 0x63, 0x66, 0x2c, 
-0x63, 0x63, 0x66, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x3c, 0x0, 0x0, 0x0, 0xdf, 0x4a, 0xd8, 0xd5, 0x98, 0xe5, 0x2b, 0x8a, 0xb0, 
-0xa7, 0x1b, 0x43, 0x44, 0x5a, 0x30, 0xd0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xd1, 
-0x88, 0x15, 0xa4, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x61, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x4, 0x0, 0x0, 0x0, 0x23, 0xd6, 0x2d, 0x43, 0x61, 0x7a, 0x80, 0x81, 0x86, 
-0x5a, 0x85, 0x1e, 0x86, 0x58, 0xbb, 0x9b, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x5f, 
-0x68, 0x22, 0x64, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x62, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x3, 0x0, 0x0, 0x0, 0x97, 0xcd, 0xab, 0x44, 0xc9, 0x8d, 0xe3, 0xe3, 0xcc, 
-0x11, 0xa4, 0xe8, 0x2, 0x49, 0x4d, 0x2a, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xd2, 
-0xae, 0x3b, 0xec, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x62, 0x63, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xc, 0x0, 0x0, 0x0, 0x89, 0xd7, 0x35, 0x9, 0x5b, 0x5, 0x85, 0x9f, 0x27, 
-0x8b, 0x8, 0xd2, 0x95, 0x5, 0x60, 0x6, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xc2, 
-0x84, 0x55, 0x4c, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x63, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x14, 0x0, 0x0, 0x0, 0xea, 0xa0, 0xba, 0x5f, 0xfb, 0x65, 0x1c, 0x98, 0xcc, 
-0x38, 0xbc, 0xde, 0x43, 0x5c, 0xbd, 0x3, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x45, 
-0x23, 0xde, 0x10, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x64, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x13, 0x0, 0x0, 0x0, 0x2e, 0x34, 0x1d, 0x13, 0xc9, 0x28, 0xca, 0xa, 0x67, 
-0x99, 0x2e, 0x3a, 0x92, 0xf6, 0x54, 0x9d, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x21, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xae, 
-0xc6, 0xd4, 0x2c, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x64, 0x65, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x1c, 0x0, 0x0, 0x0, 0x2f, 0x60, 0xd, 0x4c, 0x2, 0x24, 0xf5, 0xe2, 0xf4, 
-0xa0, 0xa, 0xa1, 0x13, 0x32, 0x25, 0x59, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xe1, 
-0x75, 0xaf, 0xcc, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x65, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x24, 0x0, 0x0, 0x0, 0x6, 0x15, 0xeb, 0xf2, 0xdd, 0xe8, 0x2b, 0x26, 0xa6, 
-0x11, 0x1a, 0xbc, 0x17, 0x6, 0x18, 0x28, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x1c, 
-0xed, 0x84, 0x7d, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x68, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x23, 0x0, 0x0, 0x0, 0xf4, 0xc3, 0xa5, 0x7, 0x6d, 0x1b, 0x4, 0x4f, 0xc2, 
-0xe2, 0x2a, 0x82, 0x57, 0xe0, 0xe1, 0xc3, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x21, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xfc, 
-0xd, 0x6d, 0x4a, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x68, 0x6c, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x23, 0x0, 0x0, 0x3c, 0xbc, 0x9b, 0xd, 0x81, 0xe0, 0xfd, 0xad, 0x7f, 
-0x9a, 0xe5, 0x96, 0x13, 0x85, 0xe2, 0xb, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 
-0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xa5, 
-0x4d, 0xbe, 0x31, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x69, 0x78, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xfd, 0x23, 0x0, 0x0, 0x2, 0x94, 0x7a, 0x63, 0x82, 0x31, 0x5a, 0xc6, 0xe9, 
-0xb2, 0xb4, 0xab, 0x16, 0xf2, 0x5, 0x6d, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x21, 0xf8, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x50, 
-0x5d, 0x51, 0xa3, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x69, 0x79, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x2c, 0x0, 0x0, 0x0, 0x31, 0x80, 0x20, 0xa5, 0x56, 0x43, 0x9, 0xb4, 0xc1, 
-0xf4, 0xa2, 0xdf, 0xd1, 0x3c, 0xa2, 0x3e, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x56, 
-0xcd, 0x6, 0xf3, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x6c, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x34, 0x0, 0x0, 0x0, 0x56, 0xb8, 0x7c, 0xc, 0x3e, 0xe5, 0x3, 0x1, 0x7e, 
-0x87, 0x58, 0xda, 0x15, 0x5c, 0x37, 0x1f, 0x1, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xb8, 
-0x3a, 0xdc, 0xef, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x28, 0x68, 0x6c, 
-0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x33, 0x0, 0x0, 0x0, 0x6f, 0x34, 0x82, 0xd4, 0x69, 0xd1, 0xb6, 0xde, 0x94, 
-0xa4, 0x76, 0xf4, 0x53, 0x2, 0x5b, 0x85, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x5d, 
-0xac, 0xd5, 0x27, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x73, 0x70, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x34, 0x1, 0x0, 0x6e, 0xfa, 0x2, 0x1, 0x2, 0x1, 0x28, 0x2c, 0x94, 
-0x88, 0x57, 0x50, 0x16, 0x33, 0x6f, 0x28, 0x20, 0x1, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x20, 
-0x58, 0x14, 0x70, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x28, 0x3c, 0x69, 
-0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x24, 0x0, 0x0, 0x38, 0xb8, 0x6c, 0x31, 0xd4, 0xc6, 0x1, 0x3e, 0x58, 
-0x83, 0xb4, 0x15, 0x81, 0xde, 0x59, 0x42, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x6f, 
-0x46, 0x36, 0x62, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x69, 0x78, 0x68, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x2c, 0x0, 0x0, 0x14, 0x4d, 0x60, 0x74, 0xd4, 0x76, 0xe7, 0x6, 0xa2, 
-0x32, 0x3c, 0x21, 0xd6, 0xd7, 0xa5, 0x99, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x2, 
-0x7b, 0xef, 0x2c, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x69, 0x78, 0x6c, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x24, 0x0, 0x0, 0x36, 0x28, 0x6f, 0x9f, 0x16, 0x91, 0xb9, 0x61, 0xcb, 
-0x82, 0x19, 0xe2, 0x92, 0x73, 0x8c, 0xa9, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x2d, 
-0x96, 0x6c, 0xf3, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x69, 0x79, 0x68, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x2c, 0x0, 0x0, 0xc6, 0xd7, 0xd5, 0x62, 0x9e, 0xa0, 0x39, 0x70, 0x7e, 
-0x3e, 0x12, 0x9f, 0x90, 0xd9, 0xf, 0x22, 0x0, 0x1, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xfb, 
-0xcb, 0xba, 0x95, 0x3c, 0x69, 0x6e, 0x63, 0x2c, 0x64, 0x65, 0x63, 0x3e, 0x20, 0x69, 0x79, 0x6c, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xed, 0x4b, 0x3, 0x1, 0xa8, 0xf9, 0x59, 0xf5, 0xa4, 0x93, 0xed, 0xf5, 0x96, 
-0x6f, 0x68, 0xd9, 0x86, 0xe6, 0xd8, 0x4b, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 
-0x45, 0xa9, 0xac, 0x6c, 0x64, 0x20, 0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 0x3e, 0x2c, 0x28, 0x6e, 
-0x6e, 0x6e, 0x6e, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x2a, 0x3, 0x1, 0x0, 0x63, 0x98, 0x30, 0x78, 0x77, 0x20, 0xfe, 0xb1, 0xfa, 
-0xb9, 0xb8, 0xab, 0x4, 0x6, 0x15, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 
-0x97, 0x24, 0x87, 0x6c, 0x64, 0x20, 0x68, 0x6c, 0x2c, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xed, 0x7b, 0x3, 0x1, 0xfc, 0x8d, 0xd7, 0x57, 0x61, 0x21, 0x18, 0xca, 0x85, 
-0xc1, 0xda, 0x27, 0x83, 0x1e, 0x60, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7a, 
-0xce, 0xa1, 0x1b, 0x6c, 0x64, 0x20, 0x73, 0x70, 0x2c, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x2a, 0x3, 0x1, 0xd7, 0xde, 0xfa, 0xa6, 0x80, 0xf7, 0x4c, 0x24, 0xde, 
-0x87, 0xc2, 0xbc, 0x16, 0x63, 0x96, 0x4c, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x85, 
-0x8b, 0xf1, 0x6d, 0x6c, 0x64, 0x20, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2c, 0x28, 0x6e, 
-0x6e, 0x6e, 0x6e, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xed, 0x43, 0x3, 0x1, 0x98, 0x1f, 0x4d, 0x84, 0xac, 0xe8, 0xed, 0xc9, 0x5d, 
-0xc9, 0x61, 0x8f, 0x80, 0x3f, 0xbf, 0xc7, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x64, 
-0x1e, 0x87, 0x15, 0x6c, 0x64, 0x20, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2c, 0x3c, 0x62, 0x63, 
-0x2c, 0x64, 0x65, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x22, 0x3, 0x1, 0x0, 0x3, 0xd0, 0x72, 0x77, 0x53, 0x7f, 0x72, 0x3f, 0xea, 
-0x64, 0x80, 0xe1, 0x10, 0x2d, 0xe9, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa3, 
-0x60, 0x8b, 0x47, 0x6c, 0x64, 0x20, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2c, 0x68, 0x6c, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xed, 0x73, 0x3, 0x1, 0xdc, 0xc0, 0xd6, 0xd1, 0x5a, 0xed, 0x56, 0xf3, 0xda, 
-0xaf, 0xa7, 0x6c, 0x44, 0x9f, 0xa, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x16, 
-0x58, 0x5f, 0xd7, 0x6c, 0x64, 0x20, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2c, 0x73, 0x70, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x22, 0x3, 0x1, 0xc3, 0x6c, 0x91, 0xd, 0x0, 0x69, 0xf8, 0x8e, 0xd6, 
-0xe3, 0xf7, 0xc3, 0xc6, 0xd9, 0xdf, 0xc2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xba, 
-0x10, 0x2a, 0x6b, 0x6c, 0x64, 0x20, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2c, 0x3c, 0x69, 0x78, 
-0x2c, 0x69, 0x79, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x1, 0x0, 0x0, 0x0, 0x1c, 0x5c, 0x46, 0x2d, 0xb9, 0x8e, 0x78, 0x60, 0xb1, 
-0x74, 0xe, 0xb3, 0x46, 0xd1, 0xcc, 0x30, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 
-0x39, 0x19, 0x69, 0x6c, 0x64, 0x20, 0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 0x2c, 0x68, 0x6c, 0x2c, 
-0x73, 0x70, 0x3e, 0x2c, 0x6e, 0x6e, 0x6e, 0x6e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x21, 0x0, 0x0, 0xe8, 0x87, 0x6, 0x20, 0x12, 0xbd, 0x9b, 0xb6, 0x53, 
-0x72, 0xe5, 0xa1, 0x51, 0x13, 0xbd, 0xf1, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 
-0x7d, 0xd5, 0x25, 0x6c, 0x64, 0x20, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2c, 0x6e, 0x6e, 
-0x6e, 0x6e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xa, 0x0, 0x0, 0x0, 0xa8, 0xb3, 0x2a, 0x1d, 0x8e, 0x7f, 0xac, 0x42, 0x3, 
-0x1, 0x3, 0x1, 0xc6, 0xb1, 0x8e, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0xff, 0x0, 0x0, 0xb0, 
-0x81, 0x89, 0x35, 0x6c, 0x64, 0x20, 0x61, 0x2c, 0x3c, 0x28, 0x62, 0x63, 0x29, 0x2c, 0x28, 0x64, 
-0x65, 0x29, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x6, 0x0, 0x0, 0x0, 0x7, 0xc4, 0x9d, 0xf4, 0x3d, 0xd1, 0x39, 0x3, 0x89, 
-0xde, 0x55, 0x74, 0x53, 0xc0, 0x9, 0x55, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0xf1, 
-0xda, 0xb5, 0x56, 0x6c, 0x64, 0x20, 0x3c, 0x62, 0x2c, 0x63, 0x2c, 0x64, 0x2c, 0x65, 0x2c, 0x68, 
-0x2c, 0x6c, 0x2c, 0x28, 0x68, 0x6c, 0x29, 0x2c, 0x61, 0x3e, 0x2c, 0x6e, 0x6e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x36, 0x1, 0x0, 0x45, 0x1b, 0x2, 0x1, 0x2, 0x1, 0xc1, 0xd5, 0xc7, 
-0x61, 0xc4, 0xbd, 0xc0, 0x85, 0x16, 0xcd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x26, 
-0xdb, 0x47, 0x7e, 0x6c, 0x64, 0x20, 0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 
-0x29, 0x2c, 0x6e, 0x6e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x46, 0x1, 0x0, 0x16, 0xd0, 0x2, 0x1, 0x2, 0x1, 0x60, 0x42, 0x39, 
-0x7f, 0x4, 0x4, 0x97, 0x4a, 0x85, 0xd0, 0x20, 0x18, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 
-0x11, 0x6, 0xa8, 0x6c, 0x64, 0x20, 0x3c, 0x62, 0x2c, 0x63, 0x2c, 0x64, 0x2c, 0x65, 0x3e, 0x2c, 
-0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x66, 0x1, 0x0, 0xe0, 0x84, 0x2, 0x1, 0x2, 0x1, 0x52, 0x9c, 0x99, 
-0xa7, 0xb6, 0x49, 0x93, 0x0, 0xad, 0xee, 0x20, 0x8, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 
-0x2a, 0x4d, 0x3, 0x6c, 0x64, 0x20, 0x3c, 0x68, 0x2c, 0x6c, 0x3e, 0x2c, 0x28, 0x3c, 0x69, 0x78, 
-0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x7e, 0x1, 0x0, 0xb6, 0xd8, 0x2, 0x1, 0x2, 0x1, 0x12, 0xc6, 0x7, 
-0xdf, 0xd0, 0x9c, 0x43, 0xa6, 0xe5, 0xa0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa5, 
-0xe9, 0xac, 0x64, 0x6c, 0x64, 0x20, 0x61, 0x2c, 0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 
-0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x26, 0x0, 0x0, 0x53, 0x3c, 0x40, 0x46, 0x79, 0xe1, 0x11, 0x77, 0x7, 
-0xc1, 0xfa, 0x1a, 0x81, 0xad, 0x9b, 0x5d, 0x20, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x24, 
-0xe8, 0x82, 0x8b, 0x6c, 0x64, 0x20, 0x3c, 0x69, 0x78, 0x68, 0x2c, 0x69, 0x78, 0x6c, 0x2c, 0x69, 
-0x79, 0x68, 0x2c, 0x69, 0x79, 0x6c, 0x3e, 0x2c, 0x6e, 0x6e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x40, 0x0, 0x0, 0x0, 0xa4, 0x72, 0x24, 0xa0, 0xac, 0x61, 0x3, 0x1, 0xc7, 
-0x82, 0x8f, 0x71, 0x97, 0x8f, 0x8e, 0xef, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0x0, 0x0, 0x74, 
-0x4b, 0x1, 0x18, 0x6c, 0x64, 0x20, 0x3c, 0x62, 0x63, 0x64, 0x65, 0x68, 0x6c, 0x61, 0x3e, 0x2c, 
-0x3c, 0x62, 0x63, 0x64, 0x65, 0x68, 0x6c, 0x61, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x40, 0x0, 0x0, 0xc5, 0xbc, 0x3, 0x1, 0x3, 0x1, 0x3, 0x1, 0xc2, 
-0x2f, 0xc0, 0x98, 0x83, 0x1f, 0xcd, 0x3b, 0x20, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0x0, 0x0, 0x47, 
-0x8b, 0xa3, 0x6b, 0x6c, 0x64, 0x20, 0x3c, 0x62, 0x63, 0x64, 0x65, 0x78, 0x79, 0x61, 0x3e, 0x2c, 
-0x3c, 0x62, 0x63, 0x64, 0x65, 0x78, 0x79, 0x61, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x32, 0x3, 0x1, 0x0, 0x68, 0xfd, 0xec, 0xf4, 0xa0, 0x44, 0x43, 0xb5, 0x53, 
-0x6, 0xba, 0xcd, 0xd2, 0x4f, 0xd8, 0x1f, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0xff, 0x0, 0x0, 0xc9, 
-0x26, 0x2d, 0xe5, 0x6c, 0x64, 0x20, 0x61, 0x2c, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x20, 0x2f, 
-0x20, 0x6c, 0x64, 0x20, 0x28, 0x6e, 0x6e, 0x6e, 0x6e, 0x29, 0x2c, 0x61, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xed, 0xa8, 0x0, 0x0, 0x52, 0x98, 0xfa, 0x68, 0xa1, 0x66, 0x6, 0x1, 0x4, 
-0x1, 0x1, 0x0, 0xc1, 0x68, 0xb7, 0x20, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x94, 
-0xf4, 0x27, 0x69, 0x6c, 0x64, 0x64, 0x3c, 0x72, 0x3e, 0x20, 0x28, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xed, 0xa8, 0x0, 0x0, 0x2e, 0xf1, 0x2a, 0xeb, 0xba, 0xd5, 0x6, 0x1, 0x4, 
-0x1, 0x2, 0x0, 0x47, 0xff, 0xe4, 0xfb, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x5a, 
-0x90, 0x7e, 0xd4, 0x6c, 0x64, 0x64, 0x3c, 0x72, 0x3e, 0x20, 0x28, 0x32, 0x29, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xed, 0xa0, 0x0, 0x0, 0x30, 0xfe, 0xcd, 0x3, 0x58, 0x60, 0x5, 0x1, 0x3, 
-0x1, 0x1, 0x0, 0x4, 0x60, 0x88, 0x26, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x9a, 
-0xbd, 0xf6, 0xb5, 0x6c, 0x64, 0x69, 0x3c, 0x72, 0x3e, 0x20, 0x28, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xed, 0xa0, 0x0, 0x0, 0xce, 0x4a, 0x6e, 0xc2, 0x88, 0xb1, 0x5, 0x1, 0x3, 
-0x1, 0x2, 0x0, 0x14, 0x2d, 0x9f, 0xa3, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xeb, 
-0x59, 0x89, 0x1b, 0x6c, 0x64, 0x69, 0x3c, 0x72, 0x3e, 0x20, 0x28, 0x32, 0x29, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xed, 0x44, 0x0, 0x0, 0xa2, 0x38, 0x6b, 0x5f, 0x34, 0xd9, 0xe4, 0x57, 0xd6, 
-0xd2, 0x42, 0x46, 0x43, 0x5a, 0xcc, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6a, 
-0x3c, 0x3b, 0xbd, 0x6e, 0x65, 0x67, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xed, 0x67, 0x0, 0x0, 0xcb, 0x91, 0x8b, 0xc4, 0x62, 0xfa, 0x3, 0x1, 0x20, 
-0xe7, 0x79, 0xb4, 0x40, 0x6, 0xe2, 0x8a, 0x0, 0x8, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0xff, 0x0, 0x0, 0x95, 
-0x5b, 0xa3, 0x26, 0x3c, 0x72, 0x72, 0x64, 0x2c, 0x72, 0x6c, 0x64, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x7, 0x0, 0x0, 0x0, 0x92, 0xcb, 0x43, 0x6d, 0x90, 0xa, 0x84, 0xc2, 0x53, 
-0xc, 0xe, 0xf5, 0x91, 0xeb, 0xfc, 0x40, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x25, 
-0x13, 0x30, 0xae, 0x3c, 0x72, 0x6c, 0x63, 0x61, 0x2c, 0x72, 0x72, 0x63, 0x61, 0x2c, 0x72, 0x6c, 
-0x61, 0x2c, 0x72, 0x72, 0x61, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0xcb, 0x1, 0x6, 0xaf, 0xdd, 0x2, 0x1, 0x2, 0x1, 0x3c, 0xff, 0xf6, 
-0xdb, 0xf4, 0x94, 0x82, 0x80, 0xd9, 0x61, 0x20, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x57, 0x0, 0x0, 0x0, 0x71, 
-0x3a, 0xcd, 0x81, 0x73, 0x68, 0x66, 0x2f, 0x72, 0x6f, 0x74, 0x20, 0x28, 0x3c, 0x69, 0x78, 0x2c, 
-0x69, 0x79, 0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xcb, 0x0, 0x0, 0x0, 0xeb, 0xcc, 0x4a, 0x5d, 0x7, 0xe0, 0x3, 0x1, 0x95, 
-0x13, 0xee, 0x30, 0x43, 0x78, 0xad, 0x3d, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x0, 0x0, 0xeb, 
-0x60, 0x4d, 0x58, 0x73, 0x68, 0x66, 0x2f, 0x72, 0x6f, 0x74, 0x20, 0x3c, 0x62, 0x2c, 0x63, 0x2c, 
-0x64, 0x2c, 0x65, 0x2c, 0x68, 0x2c, 0x6c, 0x2c, 0x28, 0x68, 0x6c, 0x29, 0x2c, 0x61, 0x3e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xcb, 0x80, 0x0, 0x0, 0xd5, 0x2c, 0xab, 0x97, 0xff, 0x39, 0x3, 0x1, 0x4b, 
-0xd1, 0xb2, 0x6a, 0x53, 0x27, 0x38, 0xb5, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0x0, 0x0, 0x8b, 
-0x57, 0xf0, 0x8, 0x3c, 0x73, 0x65, 0x74, 0x2c, 0x72, 0x65, 0x73, 0x3e, 0x20, 0x6e, 0x2c, 0x3c, 
-0x62, 0x63, 0x64, 0x65, 0x68, 0x6c, 0x28, 0x68, 0x6c, 0x29, 0x61, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0xcb, 0x1, 0x86, 0x44, 0xfb, 0x2, 0x1, 0x2, 0x1, 0x9, 0xba, 0xbe, 
-0x68, 0xd8, 0x32, 0x10, 0x5e, 0x67, 0xa8, 0x20, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xcc, 
-0x63, 0xf9, 0x8a, 0x3c, 0x73, 0x65, 0x74, 0x2c, 0x72, 0x65, 0x73, 0x3e, 0x20, 0x6e, 0x2c, 0x28, 
-0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x70, 0x1, 0x0, 0xd, 0x27, 0x2, 0x1, 0x2, 0x1, 0x3a, 0xb7, 0x7b, 
-0x88, 0xee, 0x99, 0x86, 0x70, 0x7, 0xca, 0x20, 0x3, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x4, 
-0x62, 0x6a, 0xbf, 0x6c, 0x64, 0x20, 0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 
-0x29, 0x2c, 0x3c, 0x62, 0x2c, 0x63, 0x2c, 0x64, 0x2c, 0x65, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x74, 0x1, 0x0, 0x64, 0xb6, 0x2, 0x1, 0x2, 0x1, 0xac, 0xe8, 0xf5, 
-0xb5, 0xfe, 0xaa, 0x12, 0x10, 0x66, 0x95, 0x20, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6a, 
-0x1a, 0x88, 0x31, 0x6c, 0x64, 0x20, 0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 
-0x29, 0x2c, 0x3c, 0x68, 0x2c, 0x6c, 0x3e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0xdd, 0x77, 0x1, 0x0, 0xaf, 0x67, 0x2, 0x1, 0x2, 0x1, 0x13, 0x4f, 0x44, 
-0x6, 0xd7, 0xbc, 0x50, 0xac, 0xaf, 0x5f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0xcc, 
-0xbe, 0x5a, 0x96, 0x6c, 0x64, 0x20, 0x28, 0x3c, 0x69, 0x78, 0x2c, 0x69, 0x79, 0x3e, 0x2b, 0x31, 
-0x29, 0x2c, 0x61, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xd7, 0x2, 0x0, 0x0, 0x0, 0x3b, 0xc, 0x92, 0xb5, 0xff, 0x6c, 0x9e, 0x95, 0x3, 
-0x1, 0x4, 0x1, 0xc1, 0x21, 0xe7, 0xbd, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
-0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x7a, 
-0x4c, 0x11, 0x4f, 0x6c, 0x64, 0x20, 0x28, 0x3c, 0x62, 0x63, 0x2c, 0x64, 0x65, 0x3e, 0x29, 0x2c, 
-0x61, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-0x2e, 0x24, 0xe5, 0x7e, 0x23, 0x66, 0x6f, 0x7e, 0x32, 0x65, 0x1d, 0x23, 0xe5, 0x11, 0x14, 0x0, 
-0x19, 0x11, 0xda, 0x1c, 0xcd, 0x49, 0x1c, 0xe1, 0xe5, 0x11, 0x28, 0x0, 0x19, 0x11, 0x2, 0x1d, 
-0xcd, 0x49, 0x1c, 0x21, 0x2, 0x1d, 0x36, 0x1, 0xe1, 0xe5, 0x11, 0x42, 0x1d, 0x1, 0x4, 0x0, 
-0xed, 0xb0, 0x11, 0x3, 0x1, 0x1, 0x10, 0x0, 0xed, 0xb0, 0x11, 0x2c, 0x0, 0x19, 0xeb, 0xe, 
-0x9, 0xcd, 0xce, 0x1d, 0xcd, 0x71, 0x1e, 0x3a, 0x42, 0x1d, 0xfe, 0x76, 0xca, 0x3e, 0x1b, 0xe6, 
-0xdf, 0xfe, 0xdd, 0xc2, 0x3b, 0x1b, 0x3a, 0x43, 0x1d, 0xfe, 0x76, 0xc4, 0x2a, 0x1d, 0xcd, 0x89, 
-0x1c, 0xc4, 0xad, 0x1c, 0xe1, 0xca, 0x7a, 0x1b, 0x11, 0x3c, 0x0, 0x19, 0xcd, 0x32, 0x1e, 0x11, 
-0x5, 0x1e, 0xca, 0x71, 0x1b, 0x11, 0xc, 0x1e, 0xe, 0x9, 0xcd, 0xce, 0x1d, 0xcd, 0x99, 0x1d, 
-0x11, 0x27, 0x1e, 0xe, 0x9, 0xcd, 0xce, 0x1d, 0x21, 0x85, 0x1e, 0xcd, 0x99, 0x1d, 0x11, 0x2f, 
-0x1e, 0xe, 0x9, 0xcd, 0xce, 0x1d, 0xe1, 0x23, 0x23, 0xc9, 0xe5, 0x3e, 0x1, 0x32, 0xf0, 0x1b, 
-0x32, 0x14, 0x1c, 0x21, 0xda, 0x1c, 0x22, 0xf1, 0x1b, 0x21, 0x2, 0x1d, 0x22, 0x15, 0x1c, 0x6, 
-0x4, 0xe1, 0xe5, 0x11, 0x42, 0x1d, 0xcd, 0xa4, 0x1b, 0x6, 0x10, 0x11, 0x3, 0x1, 0xcd, 0xa4, 
-0x1b, 0xc3, 0x27, 0x1b, 0xcd, 0xad, 0x1b, 0x23, 0x5, 0xc2, 0xa4, 0x1b, 0xc9, 0xc5, 0xd5, 0xe5, 
-0x4e, 0x11, 0x14, 0x0, 0x19, 0x7e, 0xfe, 0x0, 0xca, 0xce, 0x1b, 0x6, 0x8, 0xf, 0xf5, 0x3e, 
-0x0, 0xdc, 0xf3, 0x1b, 0xa9, 0xf, 0x4f, 0xf1, 0x5, 0xc2, 0xbd, 0x1b, 0x6, 0x8, 0x11, 0x14, 
-0x0, 0x19, 0x7e, 0xfe, 0x0, 0xca, 0xe9, 0x1b, 0x6, 0x8, 0xf, 0xf5, 0x3e, 0x0, 0xdc, 0x17, 
-0x1c, 0xa9, 0xf, 0x4f, 0xf1, 0x5, 0xc2, 0xda, 0x1b, 0xe1, 0xd1, 0x79, 0x12, 0x13, 0xc1, 0xc9, 
-0x0, 0x0, 0x0, 0xc5, 0xe5, 0x2a, 0xf1, 0x1b, 0x46, 0x21, 0xf0, 0x1b, 0x7e, 0x4f, 0x7, 0x77, 
-0xfe, 0x1, 0xc2, 0xc, 0x1c, 0x2a, 0xf1, 0x1b, 0x23, 0x22, 0xf1, 0x1b, 0x78, 0xa1, 0xe1, 0xc1, 
-0xc8, 0x3e, 0x1, 0xc9, 0x0, 0x0, 0x0, 0xc5, 0xe5, 0x2a, 0x15, 0x1c, 0x46, 0x21, 0x14, 0x1c, 
-0x7e, 0x4f, 0x7, 0x77, 0xfe, 0x1, 0xc2, 0x30, 0x1c, 0x2a, 0x15, 0x1c, 0x23, 0x22, 0x15, 0x1c, 
-0x78, 0xa1, 0xe1, 0xc1, 0xc8, 0x3e, 0x1, 0xc9, 0xf5, 0xc5, 0xd5, 0xe5, 0x36, 0x0, 0x54, 0x5d, 
-0x13, 0xb, 0xed, 0xb0, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0xd5, 0xeb, 0x1, 0x28, 0x0, 0xcd, 0x38, 
-0x1c, 0xeb, 0x6, 0x14, 0xe, 0x1, 0x16, 0x0, 0x5e, 0x7b, 0xa1, 0xca, 0x5f, 0x1c, 0x14, 0x79, 
-0x7, 0x4f, 0xfe, 0x1, 0xc2, 0x59, 0x1c, 0x23, 0x5, 0xc2, 0x58, 0x1c, 0x7a, 0xe6, 0xf8, 0xf, 
-0xf, 0xf, 0x6f, 0x26, 0x0, 0x7a, 0xe6, 0x7, 0x3c, 0x47, 0x3e, 0x80, 0x7, 0x5, 0xc2, 0x7c, 
-0x1c, 0xd1, 0x19, 0x11, 0x14, 0x0, 0x19, 0x77, 0xc9, 0xc5, 0xd5, 0xe5, 0x21, 0xda, 0x1c, 0x11, 
-0x14, 0x0, 0xeb, 0x19, 0xeb, 0x34, 0x7e, 0xfe, 0x0, 0xca, 0xa8, 0x1c, 0x47, 0x1a, 0xa0, 0xca, 
-0xa4, 0x1c, 0x36, 0x0, 0xc1, 0xd1, 0xe1, 0xc9, 0x23, 0x13, 0xc3, 0x95, 0x1c, 0xc5, 0xd5, 0xe5, 
-0x21, 0x2, 0x1d, 0x11, 0x14, 0x0, 0xeb, 0x19, 0xeb, 0x7e, 0xb7, 0xca, 0xd5, 0x1c, 0x47, 0x1a, 
-0xa0, 0xc2, 0xd1, 0x1c, 0x78, 0x7, 0xfe, 0x1, 0xc2, 0xcf, 0x1c, 0x36, 0x0, 0x23, 0x13, 0x77, 
-0xaf, 0xe1, 0xd1, 0xc1, 0xc9, 0x23, 0x13, 0xc3, 0xb9, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf5, 0xc5, 0xd5, 0xe5, 0xf3, 0xed, 
-0x73, 0x8d, 0x1d, 0x31, 0x5, 0x1, 0xfd, 0xe1, 0xdd, 0xe1, 0xe1, 0xd1, 0xc1, 0xf1, 0xed, 0x7b, 
-0x11, 0x1, 0x0, 0x0, 0x0, 0x0, 0xed, 0x73, 0x8b, 0x1d, 0x31, 0x8b, 0x1d, 0xf5, 0xc5, 0xd5, 
-0xe5, 0xdd, 0xe5, 0xfd, 0xe5, 0xed, 0x7b, 0x8d, 0x1d, 0xfb, 0x2a, 0x3, 0x1, 0x22, 0x7d, 0x1d, 
-0x21, 0x89, 0x1d, 0x7e, 0xe6, 0xd7, 0x77, 0x6, 0x10, 0x11, 0x7d, 0x1d, 0x21, 0x85, 0x1e, 0x1a, 
-0x13, 0xcd, 0x49, 0x1e, 0x5, 0xc2, 0x6f, 0x1d, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0x0, 0x0, 0x0, 
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 
-0xcd, 0xab, 0x1d, 0x23, 0x5, 0xc2, 0x8f, 0x1d, 0xc9, 0xf5, 0xc5, 0xe5, 0x6, 0x4, 0x7e, 0xcd, 
-0xab, 0x1d, 0x23, 0x5, 0xc2, 0x9e, 0x1d, 0xe1, 0xc1, 0xf1, 0xc9, 0xf5, 0xf, 0xf, 0xf, 0xf, 
-0xcd, 0xb4, 0x1d, 0xf1, 0xf5, 0xc5, 0xd5, 0xe5, 0xe6, 0xf, 0xfe, 0xa, 0xda, 0xc1, 0x1d, 0xc6, 
-0x27, 0xc6, 0x30, 0x5f, 0xe, 0x2, 0xcd, 0xce, 0x1d, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0xf5, 0xc5, 
-0xd5, 0xe5, 0xcd, 0x5, 0x0, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0x5a, 0x38, 0x30, 0x20, 0x69, 0x6e, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x65, 0x78, 0x65, 0x72, 0x63, 0x69, 
-0x73, 0x65, 0x72, 0xa, 0xd, 0x24, 0x54, 0x65, 0x73, 0x74, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70, 
-0x6c, 0x65, 0x74, 0x65, 0x24, 0x20, 0x20, 0x4f, 0x4b, 0xa, 0xd, 0x24, 0x20, 0x20, 0x45, 0x52, 
-0x52, 0x4f, 0x52, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x63, 0x72, 0x63, 0x20, 0x65, 0x78, 0x70, 
-0x65, 0x63, 0x74, 0x65, 0x64, 0x3a, 0x24, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x24, 0xa, 
-0xd, 0x24, 0xc5, 0xd5, 0xe5, 0x11, 0x85, 0x1e, 0x6, 0x4, 0x1a, 0xbe, 0xc2, 0x45, 0x1e, 0x23, 
-0x13, 0x5, 0xc2, 0x3a, 0x1e, 0xe1, 0xd1, 0xc1, 0xc9, 0xf5, 0xc5, 0xd5, 0xe5, 0xe5, 0x11, 0x3, 
-0x0, 0x19, 0xae, 0x6f, 0x26, 0x0, 0x29, 0x29, 0xeb, 0x21, 0x89, 0x1e, 0x19, 0xeb, 0xe1, 0x1, 
-0x4, 0x0, 0x1a, 0xa8, 0x46, 0x77, 0x13, 0x23, 0xd, 0xc2, 0x62, 0x1e, 0xe1, 0xd1, 0xc1, 0xf1, 
-0xc9, 0xf5, 0xc5, 0xe5, 0x21, 0x85, 0x1e, 0x3e, 0xff, 0x6, 0x4, 0x77, 0x23, 0x5, 0xc2, 0x7b, 
-0x1e, 0xe1, 0xc1, 0xf1, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0x7, 0x30, 
-0x96, 0xee, 0xe, 0x61, 0x2c, 0x99, 0x9, 0x51, 0xba, 0x7, 0x6d, 0xc4, 0x19, 0x70, 0x6a, 0xf4, 
-0x8f, 0xe9, 0x63, 0xa5, 0x35, 0x9e, 0x64, 0x95, 0xa3, 0xe, 0xdb, 0x88, 0x32, 0x79, 0xdc, 0xb8, 
-0xa4, 0xe0, 0xd5, 0xe9, 0x1e, 0x97, 0xd2, 0xd9, 0x88, 0x9, 0xb6, 0x4c, 0x2b, 0x7e, 0xb1, 0x7c, 
-0xbd, 0xe7, 0xb8, 0x2d, 0x7, 0x90, 0xbf, 0x1d, 0x91, 0x1d, 0xb7, 0x10, 0x64, 0x6a, 0xb0, 0x20, 
-0xf2, 0xf3, 0xb9, 0x71, 0x48, 0x84, 0xbe, 0x41, 0xde, 0x1a, 0xda, 0xd4, 0x7d, 0x6d, 0xdd, 0xe4, 
-0xeb, 0xf4, 0xd4, 0xb5, 0x51, 0x83, 0xd3, 0x85, 0xc7, 0x13, 0x6c, 0x98, 0x56, 0x64, 0x6b, 0xa8, 
-0xc0, 0xfd, 0x62, 0xf9, 0x7a, 0x8a, 0x65, 0xc9, 0xec, 0x14, 0x1, 0x5c, 0x4f, 0x63, 0x6, 0x6c, 
-0xd9, 0xfa, 0xf, 0x3d, 0x63, 0x8d, 0x8, 0xd, 0xf5, 0x3b, 0x6e, 0x20, 0xc8, 0x4c, 0x69, 0x10, 
-0x5e, 0xd5, 0x60, 0x41, 0xe4, 0xa2, 0x67, 0x71, 0x72, 0x3c, 0x3, 0xe4, 0xd1, 0x4b, 0x4, 0xd4, 
-0x47, 0xd2, 0xd, 0x85, 0xfd, 0xa5, 0xa, 0xb5, 0x6b, 0x35, 0xb5, 0xa8, 0xfa, 0x42, 0xb2, 0x98, 
-0x6c, 0xdb, 0xbb, 0xc9, 0xd6, 0xac, 0xbc, 0xf9, 0x40, 0x32, 0xd8, 0x6c, 0xe3, 0x45, 0xdf, 0x5c, 
-0x75, 0xdc, 0xd6, 0xd, 0xcf, 0xab, 0xd1, 0x3d, 0x59, 0x26, 0xd9, 0x30, 0xac, 0x51, 0xde, 0x0, 
-0x3a, 0xc8, 0xd7, 0x51, 0x80, 0xbf, 0xd0, 0x61, 0x16, 0x21, 0xb4, 0xf4, 0xb5, 0x56, 0xb3, 0xc4, 
-0x23, 0xcf, 0xba, 0x95, 0x99, 0xb8, 0xbd, 0xa5, 0xf, 0x28, 0x2, 0xb8, 0x9e, 0x5f, 0x5, 0x88, 
-0x8, 0xc6, 0xc, 0xd9, 0xb2, 0xb1, 0xb, 0xe9, 0x24, 0x2f, 0x6f, 0x7c, 0x87, 0x58, 0x68, 0x4c, 
-0x11, 0xc1, 0x61, 0x1d, 0xab, 0xb6, 0x66, 0x2d, 0x3d, 0x76, 0xdc, 0x41, 0x90, 0x1, 0xdb, 0x71, 
-0x6, 0x98, 0xd2, 0x20, 0xbc, 0xef, 0xd5, 0x10, 0x2a, 0x71, 0xb1, 0x85, 0x89, 0x6, 0xb6, 0xb5, 
-0x1f, 0x9f, 0xbf, 0xe4, 0xa5, 0xe8, 0xb8, 0xd4, 0x33, 0x78, 0x7, 0xc9, 0xa2, 0xf, 0x0, 0xf9, 
-0x34, 0x96, 0x9, 0xa8, 0x8e, 0xe1, 0xe, 0x98, 0x18, 0x7f, 0x6a, 0xd, 0xbb, 0x8, 0x6d, 0x3d, 
-0x2d, 0x91, 0x64, 0x6c, 0x97, 0xe6, 0x63, 0x5c, 0x1, 0x6b, 0x6b, 0x51, 0xf4, 0x1c, 0x6c, 0x61, 
-0x62, 0x85, 0x65, 0x30, 0xd8, 0xf2, 0x62, 0x0, 0x4e, 0x6c, 0x6, 0x95, 0xed, 0x1b, 0x1, 0xa5, 
-0x7b, 0x82, 0x8, 0xf4, 0xc1, 0xf5, 0xf, 0xc4, 0x57, 0x65, 0xb0, 0xd9, 0xc6, 0x12, 0xb7, 0xe9, 
-0x50, 0x8b, 0xbe, 0xb8, 0xea, 0xfc, 0xb9, 0x88, 0x7c, 0x62, 0xdd, 0x1d, 0xdf, 0x15, 0xda, 0x2d, 
-0x49, 0x8c, 0xd3, 0x7c, 0xf3, 0xfb, 0xd4, 0x4c, 0x65, 0x4d, 0xb2, 0x61, 0x58, 0x3a, 0xb5, 0x51, 
-0xce, 0xa3, 0xbc, 0x0, 0x74, 0xd4, 0xbb, 0x30, 0xe2, 0x4a, 0xdf, 0xa5, 0x41, 0x3d, 0xd8, 0x95, 
-0xd7, 0xa4, 0xd1, 0xc4, 0x6d, 0xd3, 0xd6, 0xf4, 0xfb, 0x43, 0x69, 0xe9, 0x6a, 0x34, 0x6e, 0xd9, 
-0xfc, 0xad, 0x67, 0x88, 0x46, 0xda, 0x60, 0xb8, 0xd0, 0x44, 0x4, 0x2d, 0x73, 0x33, 0x3, 0x1d, 
-0xe5, 0xaa, 0xa, 0x4c, 0x5f, 0xdd, 0xd, 0x7c, 0xc9, 0x50, 0x5, 0x71, 0x3c, 0x27, 0x2, 0x41, 
-0xaa, 0xbe, 0xb, 0x10, 0x10, 0xc9, 0xc, 0x20, 0x86, 0x57, 0x68, 0xb5, 0x25, 0x20, 0x6f, 0x85, 
-0xb3, 0xb9, 0x66, 0xd4, 0x9, 0xce, 0x61, 0xe4, 0x9f, 0x5e, 0xde, 0xf9, 0xe, 0x29, 0xd9, 0xc9, 
-0x98, 0xb0, 0xd0, 0x98, 0x22, 0xc7, 0xd7, 0xa8, 0xb4, 0x59, 0xb3, 0x3d, 0x17, 0x2e, 0xb4, 0xd, 
-0x81, 0xb7, 0xbd, 0x5c, 0x3b, 0xc0, 0xba, 0x6c, 0xad, 0xed, 0xb8, 0x83, 0x20, 0x9a, 0xbf, 0xb3, 
-0xb6, 0x3, 0xb6, 0xe2, 0xc, 0x74, 0xb1, 0xd2, 0x9a, 0xea, 0xd5, 0x47, 0x39, 0x9d, 0xd2, 0x77, 
-0xaf, 0x4, 0xdb, 0x26, 0x15, 0x73, 0xdc, 0x16, 0x83, 0xe3, 0x63, 0xb, 0x12, 0x94, 0x64, 0x3b, 
-0x84, 0xd, 0x6d, 0x6a, 0x3e, 0x7a, 0x6a, 0x5a, 0xa8, 0xe4, 0xe, 0xcf, 0xb, 0x93, 0x9, 0xff, 
-0x9d, 0xa, 0x0, 0xae, 0x27, 0x7d, 0x7, 0x9e, 0xb1, 0xf0, 0xf, 0x93, 0x44, 0x87, 0x8, 0xa3, 
-0xd2, 0x1e, 0x1, 0xf2, 0x68, 0x69, 0x6, 0xc2, 0xfe, 0xf7, 0x62, 0x57, 0x5d, 0x80, 0x65, 0x67, 
-0xcb, 0x19, 0x6c, 0x36, 0x71, 0x6e, 0x6b, 0x6, 0xe7, 0xfe, 0xd4, 0x1b, 0x76, 0x89, 0xd3, 0x2b, 
-0xe0, 0x10, 0xda, 0x7a, 0x5a, 0x67, 0xdd, 0x4a, 0xcc, 0xf9, 0xb9, 0xdf, 0x6f, 0x8e, 0xbe, 0xef, 
-0xf9, 0x17, 0xb7, 0xbe, 0x43, 0x60, 0xb0, 0x8e, 0xd5, 0xd6, 0xd6, 0xa3, 0xe8, 0xa1, 0xd1, 0x93, 
-0x7e, 0x38, 0xd8, 0xc2, 0xc4, 0x4f, 0xdf, 0xf2, 0x52, 0xd1, 0xbb, 0x67, 0xf1, 0xa6, 0xbc, 0x57, 
-0x67, 0x3f, 0xb5, 0x6, 0xdd, 0x48, 0xb2, 0x36, 0x4b, 0xd8, 0xd, 0x2b, 0xda, 0xaf, 0xa, 0x1b, 
-0x4c, 0x36, 0x3, 0x4a, 0xf6, 0x41, 0x4, 0x7a, 0x60, 0xdf, 0x60, 0xef, 0xc3, 0xa8, 0x67, 0xdf, 
-0x55, 0x31, 0x6e, 0x8e, 0xef, 0x46, 0x69, 0xbe, 0x79, 0xcb, 0x61, 0xb3, 0x8c, 0xbc, 0x66, 0x83, 
-0x1a, 0x25, 0x6f, 0xd2, 0xa0, 0x52, 0x68, 0xe2, 0x36, 0xcc, 0xc, 0x77, 0x95, 0xbb, 0xb, 0x47, 
-0x3, 0x22, 0x2, 0x16, 0xb9, 0x55, 0x5, 0x26, 0x2f, 0xc5, 0xba, 0x3b, 0xbe, 0xb2, 0xbd, 0xb, 
-0x28, 0x2b, 0xb4, 0x5a, 0x92, 0x5c, 0xb3, 0x6a, 0x4, 0xc2, 0xd7, 0xff, 0xa7, 0xb5, 0xd0, 0xcf, 
-0x31, 0x2c, 0xd9, 0x9e, 0x8b, 0x5b, 0xde, 0xae, 0x1d, 0x9b, 0x64, 0xc2, 0xb0, 0xec, 0x63, 0xf2, 
-0x26, 0x75, 0x6a, 0xa3, 0x9c, 0x2, 0x6d, 0x93, 0xa, 0x9c, 0x9, 0x6, 0xa9, 0xeb, 0xe, 0x36, 
-0x3f, 0x72, 0x7, 0x67, 0x85, 0x5, 0x0, 0x57, 0x13, 0x95, 0xbf, 0x4a, 0x82, 0xe2, 0xb8, 0x7a, 
-0x14, 0x7b, 0xb1, 0x2b, 0xae, 0xc, 0xb6, 0x1b, 0x38, 0x92, 0xd2, 0x8e, 0x9b, 0xe5, 0xd5, 0xbe, 
-0xd, 0x7c, 0xdc, 0xef, 0xb7, 0xb, 0xdb, 0xdf, 0x21, 0x86, 0xd3, 0xd2, 0xd4, 0xf1, 0xd4, 0xe2, 
-0x42, 0x68, 0xdd, 0xb3, 0xf8, 0x1f, 0xda, 0x83, 0x6e, 0x81, 0xbe, 0x16, 0xcd, 0xf6, 0xb9, 0x26, 
-0x5b, 0x6f, 0xb0, 0x77, 0xe1, 0x18, 0xb7, 0x47, 0x77, 0x88, 0x8, 0x5a, 0xe6, 0xff, 0xf, 0x6a, 
-0x70, 0x66, 0x6, 0x3b, 0xca, 0x11, 0x1, 0xb, 0x5c, 0x8f, 0x65, 0x9e, 0xff, 0xf8, 0x62, 0xae, 
-0x69, 0x61, 0x6b, 0xff, 0xd3, 0x16, 0x6c, 0xcf, 0x45, 0xa0, 0xa, 0xe2, 0x78, 0xd7, 0xd, 0xd2, 
-0xee, 0x4e, 0x4, 0x83, 0x54, 0x39, 0x3, 0xb3, 0xc2, 0xa7, 0x67, 0x26, 0x61, 0xd0, 0x60, 0x16, 
-0xf7, 0x49, 0x69, 0x47, 0x4d, 0x3e, 0x6e, 0x77, 0xdb, 0xae, 0xd1, 0x6a, 0x4a, 0xd9, 0xd6, 0x5a, 
-0xdc, 0x40, 0xdf, 0xb, 0x66, 0x37, 0xd8, 0x3b, 0xf0, 0xa9, 0xbc, 0xae, 0x53, 0xde, 0xbb, 0x9e, 
-0xc5, 0x47, 0xb2, 0xcf, 0x7f, 0x30, 0xb5, 0xff, 0xe9, 0xbd, 0xbd, 0xf2, 0x1c, 0xca, 0xba, 0xc2, 
-0x8a, 0x53, 0xb3, 0x93, 0x30, 0x24, 0xb4, 0xa3, 0xa6, 0xba, 0xd0, 0x36, 0x5, 0xcd, 0xd7, 0x6, 
-0x93, 0x54, 0xde, 0x57, 0x29, 0x23, 0xd9, 0x67, 0xbf, 0xb3, 0x66, 0x7a, 0x2e, 0xc4, 0x61, 0x4a, 
-0xb8, 0x5d, 0x68, 0x1b, 0x2, 0x2a, 0x6f, 0x2b, 0x94, 0xb4, 0xb, 0xbe, 0x37, 0xc3, 0xc, 0x8e, 
-0xa1, 0x5a, 0x5, 0xdf, 0x1b, 0x2d, 0x2, 0xef, 0x8d, 
-};
+unsigned char dump_zexall[8585] =
+"\xc3\x13\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x2a\x06\x00\xf9\x11\xda\x1d\x0e\x09\xcd\xce\x1d\x21"
+"\x3a\x01\x7e\x23\xb6\xca\x2f\x01\x2b\xcd\xe2\x1a\xc3\x22\x01\x11\xf6\x1d\x0e\x09\xcd\xce\x1d\xc3\x00\x00\xc2\x01\x22\x02\x82\x02"
+"\xe2\x02\x42\x03\xa2\x03\x02\x04\x62\x04\xc2\x04\x22\x05\x82\x05\xe2\x05\x42\x06\xa2\x06\x02\x07\x62\x07\xc2\x07\x22\x08\x82\x08"
+"\xe2\x08\x42\x09\xa2\x09\x02\x0a\x62\x0a\xc2\x0a\x22\x0b\x82\x0b\xe2\x0b\x42\x0c\xa2\x0c\x02\x0d\x62\x0d\xc2\x0d\x22\x0e\x82\x0e"
+"\xe2\x0e\x42\x0f\xa2\x0f\x02\x10\x62\x10\xc2\x10\x22\x11\x82\x11\xe2\x11\x42\x12\xa2\x12\x02\x13\x62\x13\xc2\x13\x22\x14\x82\x14"
+"\xe2\x14\x42\x15\xa2\x15\x02\x16\x62\x16\xc2\x16\x22\x17\x82\x17\xe2\x17\x42\x18\xa2\x18\x02\x19\x62\x19\xc2\x19\x22\x1a\x82\x1a"
+"\x00\x00\xff\xed\x42\x00\x00\x2c\x83\x88\x4f\x2b\xf2\x39\xb3\x1f\x7e\x63\x15\xd3\x89\x5e\x46\x00\x38\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x21\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xff\xff\xd7\x00\xff\xff\xd4"
+"\x8a\xd5\x19\x3c\x61\x64\x63\x2c\x73\x62\x63\x3e\x20\x68\x6c\x2c\x3c\x62\x63\x2c\x64\x65\x2c\x68\x6c\x2c\x73\x70\x3e\x2e\x2e\x2e"
+"\x2e\x24\xff\x09\x00\x00\x00\xa5\xc4\xc7\xc4\x26\xd2\x50\xa0\xea\x58\x66\x85\xc6\xde\xc9\x9b\x30\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x21\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xff\xff\xd7\x00\xff\xff\xd9"
+"\xa4\xca\x05\x61\x64\x64\x20\x68\x6c\x2c\x3c\x62\x63\x2c\x64\x65\x2c\x68\x6c\x2c\x73\x70\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x09\x00\x00\xac\xdd\x94\xc2\x5b\x63\xd3\x33\x76\x6a\x20\xfa\x94\x68\xf5\x36\x00\x30\x00\x00\x00\x00\x00\x00\x21"
+"\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\xff\xff\xff\xff\xd7\x00\xff\xff\xb1"
+"\xdf\x8e\xc0\x61\x64\x64\x20\x69\x78\x2c\x3c\x62\x63\x2c\x64\x65\x2c\x69\x78\x2c\x73\x70\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xfd\x09\x00\x00\xc2\xc7\x07\xf4\xc1\x51\x96\x3e\xf4\x0b\x0f\x51\x92\x1e\xea\x71\x00\x30\x00\x00\x00\x00\x21\xf8\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\xff\xff\xff\xff\xd7\x00\xff\xff\x39"
+"\xc8\x58\x9b\x61\x64\x64\x20\x69\x79\x2c\x3c\x62\x63\x2c\x64\x65\x2c\x69\x79\x2c\x73\x70\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xc6\x00\x00\x00\x40\x91\x3c\x7e\x67\x7a\x6d\xdf\x61\x5b\x29\x0b\x10\x66\xb2\x85\x38\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x51"
+"\xc1\x9c\x2e\x61\x6c\x75\x6f\x70\x20\x61\x2c\x6e\x6e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x80\x00\x00\x00\x3e\xc5\x3a\x57\x4d\x4c\x03\x01\x09\xe3\x66\xa6\xd0\x3b\xbb\xad\x3f\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xd7\x00\x00\x00\x06"
+"\xc7\xaa\x8e\x61\x6c\x75\x6f\x70\x20\x61\x2c\x3c\x62\x2c\x63\x2c\x64\x2c\x65\x2c\x68\x2c\x6c\x2c\x28\x68\x6c\x29\x2c\x61\x3e\x2e"
+"\x2e\x24\xff\xdd\x84\x00\x00\xf7\xd6\x6e\xc7\xcf\xac\x47\x28\xdd\x22\x35\xc0\xc5\x38\x4b\x23\x20\x39\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xd7\x00\x00\x00\xa8"
+"\x86\xcc\x44\x61\x6c\x75\x6f\x70\x20\x61\x2c\x3c\x69\x78\x68\x2c\x69\x78\x6c\x2c\x69\x79\x68\x2c\x69\x79\x6c\x3e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x86\x01\x00\xb7\x90\x02\x01\x02\x01\xfd\x32\x6e\x40\xdc\xc1\x45\x6e\xfa\xe5\x20\x38\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xd3"
+"\xf2\xd7\x4a\x61\x6c\x75\x6f\x70\x20\x61\x2c\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\xcb\x01\x46\x75\x20\x02\x01\x02\x01\xfc\x3c\x9a\xa7\x74\x3d\x51\x27\x14\xca\x20\x00\x00\x38\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x53\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x83"
+"\x53\x4e\xe1\x62\x69\x74\x20\x6e\x2c\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xcb\x40\x00\x00\xf1\x3e\xfc\x9d\xcc\x7a\x03\x01\x61\xbe\x86\x7a\x50\x24\x98\x19\x00\x3f\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x53\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\x00\xff\x00\x00\x5e"
+"\x02\x0e\x98\x62\x69\x74\x20\x6e\x2c\x3c\x62\x2c\x63\x2c\x64\x2c\x65\x2c\x68\x2c\x6c\x2c\x28\x68\x6c\x29\x2c\x61\x3e\x2e\x2e\x2e"
+"\x2e\x24\xff\xed\xa9\x00\x00\xb6\xc7\xb4\x72\xf6\x18\x14\x01\xbd\x8d\x01\x00\xc0\x30\xa3\x94\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x0a\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x13"
+"\x4b\x62\x2d\x63\x70\x64\x3c\x72\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xed\xa1\x00\x00\x48\x4d\x4a\xaf\x6b\x90\x03\x01\x71\x4e\x01\x00\x93\x6a\x7c\x90\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x0a\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x2d"
+"\xa4\x2d\x19\x63\x70\x69\x3c\x72\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x27\x00\x00\x00\x41\x21\xfa\x09\x60\x1d\x59\xa5\x5b\x8d\x79\x90\x04\x8e\x9d\x29\x18\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\xd7\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6d"
+"\x2d\xd2\x13\x3c\x64\x61\x61\x2c\x63\x70\x6c\x2c\x73\x63\x66\x2c\x63\x63\x66\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x3c\x00\x00\x00\xdf\x4a\xd8\xd5\x98\xe5\x2b\x8a\xb0\xa7\x1b\x43\x44\x5a\x30\xd0\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x81"
+"\xfa\x81\x00\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x61\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x04\x00\x00\x00\x23\xd6\x2d\x43\x61\x7a\x80\x81\x86\x5a\x85\x1e\x86\x58\xbb\x9b\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x77"
+"\xf3\x5a\x73\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x62\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x03\x00\x00\x00\x97\xcd\xab\x44\xc9\x8d\xe3\xe3\xcc\x11\xa4\xe8\x02\x49\x4d\x2a\x08\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x21\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xd2"
+"\xae\x3b\xec\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x62\x63\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x0c\x00\x00\x00\x89\xd7\x35\x09\x5b\x05\x85\x9f\x27\x8b\x08\xd2\x95\x05\x60\x06\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x1a"
+"\xf6\x12\xa7\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x63\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x14\x00\x00\x00\xea\xa0\xba\x5f\xfb\x65\x1c\x98\xcc\x38\xbc\xde\x43\x5c\xbd\x03\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xd1"
+"\x46\xbf\x51\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x64\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x13\x00\x00\x00\x2e\x34\x1d\x13\xc9\x28\xca\x0a\x67\x99\x2e\x3a\x92\xf6\x54\x9d\x08\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x21\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xae"
+"\xc6\xd4\x2c\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x64\x65\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x1c\x00\x00\x00\x2f\x60\x0d\x4c\x02\x24\xf5\xe2\xf4\xa0\x0a\xa1\x13\x32\x25\x59\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xca"
+"\x8c\x6a\xc2\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x65\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x24\x00\x00\x00\x06\x15\xeb\xf2\xdd\xe8\x2b\x26\xa6\x11\x1a\xbc\x17\x06\x18\x28\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x56"
+"\x0f\x95\x5e\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x68\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x23\x00\x00\x00\xf4\xc3\xa5\x07\x6d\x1b\x04\x4f\xc2\xe2\x2a\x82\x57\xe0\xe1\xc3\x08\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x21\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xfc"
+"\x0d\x6d\x4a\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x68\x6c\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x23\x00\x00\x3c\xbc\x9b\x0d\x81\xe0\xfd\xad\x7f\x9a\xe5\x96\x13\x85\xe2\x0b\x00\x08\x00\x00\x00\x00\x00\x00\x21"
+"\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xa5"
+"\x4d\xbe\x31\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x69\x78\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xfd\x23\x00\x00\x02\x94\x7a\x63\x82\x31\x5a\xc6\xe9\xb2\xb4\xab\x16\xf2\x05\x6d\x00\x08\x00\x00\x00\x00\x21\xf8\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x50"
+"\x5d\x51\xa3\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x69\x79\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x2c\x00\x00\x00\x31\x80\x20\xa5\x56\x43\x09\xb4\xc1\xf4\xa2\xdf\xd1\x3c\xa2\x3e\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xa0"
+"\xa1\xb4\x9f\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x6c\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x34\x00\x00\x00\x56\xb8\x7c\x0c\x3e\xe5\x03\x01\x7e\x87\x58\xda\x15\x5c\x37\x1f\x01\x00\x00\x00\xff\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x28"
+"\x29\x5e\xce\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x28\x68\x6c\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x33\x00\x00\x00\x6f\x34\x82\xd4\x69\xd1\xb6\xde\x94\xa4\x76\xf4\x53\x02\x5b\x85\x08\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x21\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x5d"
+"\xac\xd5\x27\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x73\x70\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x34\x01\x00\x6e\xfa\x02\x01\x02\x01\x28\x2c\x94\x88\x57\x50\x16\x33\x6f\x28\x20\x01\x00\x00\xff\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x0b"
+"\x95\xa8\xea\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x24\x00\x00\x38\xb8\x6c\x31\xd4\xc6\x01\x3e\x58\x83\xb4\x15\x81\xde\x59\x42\x00\x01\x00\x00\x00\x00\x00\xff\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x6f"
+"\x46\x36\x62\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x69\x78\x68\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x2c\x00\x00\x14\x4d\x60\x74\xd4\x76\xe7\x06\xa2\x32\x3c\x21\xd6\xd7\xa5\x99\x00\x01\x00\x00\x00\x00\xff\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x02"
+"\x7b\xef\x2c\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x69\x78\x6c\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x24\x00\x00\x36\x28\x6f\x9f\x16\x91\xb9\x61\xcb\x82\x19\xe2\x92\x73\x8c\xa9\x00\x01\x00\x00\x00\xff\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x2d"
+"\x96\x6c\xf3\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x69\x79\x68\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x2c\x00\x00\xc6\xd7\xd5\x62\x9e\xa0\x39\x70\x7e\x3e\x12\x9f\x90\xd9\x0f\x22\x00\x01\x00\x00\xff\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x36"
+"\xc1\x1e\x75\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x69\x79\x6c\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xed\x4b\x03\x01\xa8\xf9\x59\xf5\xa4\x93\xed\xf5\x96\x6f\x68\xd9\x86\xe6\xd8\x4b\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4d"
+"\x45\xa9\xac\x6c\x64\x20\x3c\x62\x63\x2c\x64\x65\x3e\x2c\x28\x6e\x6e\x6e\x6e\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x2a\x03\x01\x00\x63\x98\x30\x78\x77\x20\xfe\xb1\xfa\xb9\xb8\xab\x04\x06\x15\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x5f"
+"\x97\x24\x87\x6c\x64\x20\x68\x6c\x2c\x28\x6e\x6e\x6e\x6e\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xed\x7b\x03\x01\xfc\x8d\xd7\x57\x61\x21\x18\xca\x85\xc1\xda\x27\x83\x1e\x60\xf4\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x7a"
+"\xce\xa1\x1b\x6c\x64\x20\x73\x70\x2c\x28\x6e\x6e\x6e\x6e\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x2a\x03\x01\xd7\xde\xfa\xa6\x80\xf7\x4c\x24\xde\x87\xc2\xbc\x16\x63\x96\x4c\x20\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x85"
+"\x8b\xf1\x6d\x6c\x64\x20\x3c\x69\x78\x2c\x69\x79\x3e\x2c\x28\x6e\x6e\x6e\x6e\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xed\x43\x03\x01\x98\x1f\x4d\x84\xac\xe8\xed\xc9\x5d\xc9\x61\x8f\x80\x3f\xbf\xc7\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\x00\x00\x00\x00\x64"
+"\x1e\x87\x15\x6c\x64\x20\x28\x6e\x6e\x6e\x6e\x29\x2c\x3c\x62\x63\x2c\x64\x65\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x22\x03\x01\x00\x03\xd0\x72\x77\x53\x7f\x72\x3f\xea\x64\x80\xe1\x10\x2d\xe9\x35\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\xa3"
+"\x60\x8b\x47\x6c\x64\x20\x28\x6e\x6e\x6e\x6e\x29\x2c\x68\x6c\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xed\x73\x03\x01\xdc\xc0\xd6\xd1\x5a\xed\x56\xf3\xda\xaf\xa7\x6c\x44\x9f\x0a\x3f\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x16"
+"\x58\x5f\xd7\x6c\x64\x20\x28\x6e\x6e\x6e\x6e\x29\x2c\x73\x70\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x22\x03\x01\xc3\x6c\x91\x0d\x00\x69\xf8\x8e\xd6\xe3\xf7\xc3\xc6\xd9\xdf\xc2\x20\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xba"
+"\x10\x2a\x6b\x6c\x64\x20\x28\x6e\x6e\x6e\x6e\x29\x2c\x3c\x69\x78\x2c\x69\x79\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x01\x00\x00\x00\x1c\x5c\x46\x2d\xb9\x8e\x78\x60\xb1\x74\x0e\xb3\x46\xd1\xcc\x30\x30\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xde"
+"\x39\x19\x69\x6c\x64\x20\x3c\x62\x63\x2c\x64\x65\x2c\x68\x6c\x2c\x73\x70\x3e\x2c\x6e\x6e\x6e\x6e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x21\x00\x00\xe8\x87\x06\x20\x12\xbd\x9b\xb6\x53\x72\xe5\xa1\x51\x13\xbd\xf1\x20\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x22"
+"\x7d\xd5\x25\x6c\x64\x20\x3c\x69\x78\x2c\x69\x79\x3e\x2c\x6e\x6e\x6e\x6e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x0a\x00\x00\x00\xa8\xb3\x2a\x1d\x8e\x7f\xac\x42\x03\x01\x03\x01\xc6\xb1\x8e\xef\x10\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\xff\x00\x00\xb0"
+"\x81\x89\x35\x6c\x64\x20\x61\x2c\x3c\x28\x62\x63\x29\x2c\x28\x64\x65\x29\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x06\x00\x00\x00\x07\xc4\x9d\xf4\x3d\xd1\x39\x03\x89\xde\x55\x74\x53\xc0\x09\x55\x38\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\xf1"
+"\xda\xb5\x56\x6c\x64\x20\x3c\x62\x2c\x63\x2c\x64\x2c\x65\x2c\x68\x2c\x6c\x2c\x28\x68\x6c\x29\x2c\x61\x3e\x2c\x6e\x6e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x36\x01\x00\x45\x1b\x02\x01\x02\x01\xc1\xd5\xc7\x61\xc4\xbd\xc0\x85\x16\xcd\x20\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x26"
+"\xdb\x47\x7e\x6c\x64\x20\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2c\x6e\x6e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x46\x01\x00\x16\xd0\x02\x01\x02\x01\x60\x42\x39\x7f\x04\x04\x97\x4a\x85\xd0\x20\x18\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcc"
+"\x11\x06\xa8\x6c\x64\x20\x3c\x62\x2c\x63\x2c\x64\x2c\x65\x3e\x2c\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x66\x01\x00\xe0\x84\x02\x01\x02\x01\x52\x9c\x99\xa7\xb6\x49\x93\x00\xad\xee\x20\x08\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfa"
+"\x2a\x4d\x03\x6c\x64\x20\x3c\x68\x2c\x6c\x3e\x2c\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x7e\x01\x00\xb6\xd8\x02\x01\x02\x01\x12\xc6\x07\xdf\xd0\x9c\x43\xa6\xe5\xa0\x20\x00\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xa5"
+"\xe9\xac\x64\x6c\x64\x20\x61\x2c\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x26\x00\x00\x53\x3c\x40\x46\x79\xe1\x11\x77\x07\xc1\xfa\x1a\x81\xad\x9b\x5d\x20\x08\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x24"
+"\xe8\x82\x8b\x6c\x64\x20\x3c\x69\x78\x68\x2c\x69\x78\x6c\x2c\x69\x79\x68\x2c\x69\x79\x6c\x3e\x2c\x6e\x6e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x40\x00\x00\x00\xa4\x72\x24\xa0\xac\x61\x03\x01\xc7\x82\x8f\x71\x97\x8f\x8e\xef\x3f\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xd7\xff\x00\x00\x74"
+"\x4b\x01\x18\x6c\x64\x20\x3c\x62\x63\x64\x65\x68\x6c\x61\x3e\x2c\x3c\x62\x63\x64\x65\x68\x6c\x61\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x40\x00\x00\xc5\xbc\x03\x01\x03\x01\x03\x01\xc2\x2f\xc0\x98\x83\x1f\xcd\x3b\x20\x3f\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xd7\xff\x00\x00\x47"
+"\x8b\xa3\x6b\x6c\x64\x20\x3c\x62\x63\x64\x65\x78\x79\x61\x3e\x2c\x3c\x62\x63\x64\x65\x78\x79\x61\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x32\x03\x01\x00\x68\xfd\xec\xf4\xa0\x44\x43\xb5\x53\x06\xba\xcd\xd2\x4f\xd8\x1f\x08\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\xff\x00\x00\xc9"
+"\x26\x2d\xe5\x6c\x64\x20\x61\x2c\x28\x6e\x6e\x6e\x6e\x29\x20\x2f\x20\x6c\x64\x20\x28\x6e\x6e\x6e\x6e\x29\x2c\x61\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xed\xa8\x00\x00\x52\x98\xfa\x68\xa1\x66\x06\x01\x04\x01\x01\x00\xc1\x68\xb7\x20\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x94"
+"\xf4\x27\x69\x6c\x64\x64\x3c\x72\x3e\x20\x28\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xed\xa8\x00\x00\x2e\xf1\x2a\xeb\xba\xd5\x06\x01\x04\x01\x02\x00\x47\xff\xe4\xfb\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x39"
+"\xdd\x3d\xe1\x6c\x64\x64\x3c\x72\x3e\x20\x28\x32\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xed\xa0\x00\x00\x30\xfe\xcd\x03\x58\x60\x05\x01\x03\x01\x01\x00\x04\x60\x88\x26\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xf7"
+"\x82\xb0\xd1\x6c\x64\x69\x3c\x72\x3e\x20\x28\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xed\xa0\x00\x00\xce\x4a\x6e\xc2\x88\xb1\x05\x01\x03\x01\x02\x00\x14\x2d\x9f\xa3\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xe9"
+"\xea\xd0\xae\x6c\x64\x69\x3c\x72\x3e\x20\x28\x32\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xed\x44\x00\x00\xa2\x38\x6b\x5f\x34\xd9\xe4\x57\xd6\xd2\x42\x46\x43\x5a\xcc\x09\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\xd7\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd6"
+"\x38\xdd\x6a\x6e\x65\x67\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xed\x67\x00\x00\xcb\x91\x8b\xc4\x62\xfa\x03\x01\x20\xe7\x79\xb4\x40\x06\xe2\x8a\x00\x08\x00\x00\xff\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\xff\x00\x00\xff"
+"\x82\x3e\x77\x3c\x72\x72\x64\x2c\x72\x6c\x64\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x07\x00\x00\x00\x92\xcb\x43\x6d\x90\x0a\x84\xc2\x53\x0c\x0e\xf5\x91\xeb\xfc\x40\x18\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x9b"
+"\xa3\x80\x7c\x3c\x72\x6c\x63\x61\x2c\x72\x72\x63\x61\x2c\x72\x6c\x61\x2c\x72\x72\x61\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\xcb\x01\x06\xaf\xdd\x02\x01\x02\x01\x3c\xff\xf6\xdb\xf4\x94\x82\x80\xd9\x61\x20\x00\x00\x38\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x80\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x57\x00\x00\x00\x71"
+"\x00\x34\xcb\x73\x68\x66\x2f\x72\x6f\x74\x20\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xcb\x00\x00\x00\xeb\xcc\x4a\x5d\x07\xe0\x03\x01\x95\x13\xee\x30\x43\x78\xad\x3d\x00\x3f\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x80\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\x57\xff\x00\x00\xa4"
+"\x25\x58\x33\x73\x68\x66\x2f\x72\x6f\x74\x20\x3c\x62\x2c\x63\x2c\x64\x2c\x65\x2c\x68\x2c\x6c\x2c\x28\x68\x6c\x29\x2c\x61\x3e\x2e"
+"\x2e\x24\xff\xcb\x80\x00\x00\xd5\x2c\xab\x97\xff\x39\x03\x01\x4b\xd1\xb2\x6a\x53\x27\x38\xb5\x00\x7f\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xd7\xff\x00\x00\x8b"
+"\x57\xf0\x08\x3c\x73\x65\x74\x2c\x72\x65\x73\x3e\x20\x6e\x2c\x3c\x62\x63\x64\x65\x68\x6c\x28\x68\x6c\x29\x61\x3e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\xcb\x01\x86\x44\xfb\x02\x01\x02\x01\x09\xba\xbe\x68\xd8\x32\x10\x5e\x67\xa8\x20\x00\x00\x78\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xcc"
+"\x63\xf9\x8a\x3c\x73\x65\x74\x2c\x72\x65\x73\x3e\x20\x6e\x2c\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x70\x01\x00\x0d\x27\x02\x01\x02\x01\x3a\xb7\x7b\x88\xee\x99\x86\x70\x07\xca\x20\x03\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\x00\x00\x00\x00\x04"
+"\x62\x6a\xbf\x6c\x64\x20\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2c\x3c\x62\x2c\x63\x2c\x64\x2c\x65\x3e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x74\x01\x00\x64\xb6\x02\x01\x02\x01\xac\xe8\xf5\xb5\xfe\xaa\x12\x10\x66\x95\x20\x01\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x6a"
+"\x1a\x88\x31\x6c\x64\x20\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2c\x3c\x68\x2c\x6c\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\xdd\x77\x01\x00\xaf\x67\x02\x01\x02\x01\x13\x4f\x44\x06\xd7\xbc\x50\xac\xaf\x5f\x20\x00\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\xcc"
+"\xbe\x5a\x96\x6c\x64\x20\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2c\x61\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xff\x02\x00\x00\x00\x3b\x0c\x92\xb5\xff\x6c\x9e\x95\x03\x01\x04\x01\xc1\x21\xe7\xbd\x18\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x7a"
+"\x4c\x11\x4f\x6c\x64\x20\x28\x3c\x62\x63\x2c\x64\x65\x3e\x29\x2c\x61\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xe5\x7e\x23\x66\x6f\x7e\x32\x65\x1d\x23\xe5\x11\x14\x00\x19\x11\xda\x1c\xcd\x49\x1c\xe1\xe5\x11\x28\x00\x19\x11\x02\x1d"
+"\xcd\x49\x1c\x21\x02\x1d\x36\x01\xe1\xe5\x11\x42\x1d\x01\x04\x00\xed\xb0\x11\x03\x01\x01\x10\x00\xed\xb0\x11\x2c\x00\x19\xeb\x0e"
+"\x09\xcd\xce\x1d\xcd\x71\x1e\x3a\x42\x1d\xfe\x76\xca\x3e\x1b\xe6\xdf\xfe\xdd\xc2\x3b\x1b\x3a\x43\x1d\xfe\x76\xc4\x2a\x1d\xcd\x89"
+"\x1c\xc4\xad\x1c\xe1\xca\x7a\x1b\x11\x3c\x00\x19\xcd\x32\x1e\x11\x05\x1e\xca\x71\x1b\x11\x0c\x1e\x0e\x09\xcd\xce\x1d\xcd\x99\x1d"
+"\x11\x27\x1e\x0e\x09\xcd\xce\x1d\x21\x85\x1e\xcd\x99\x1d\x11\x2f\x1e\x0e\x09\xcd\xce\x1d\xe1\x23\x23\xc9\xe5\x3e\x01\x32\xf0\x1b"
+"\x32\x14\x1c\x21\xda\x1c\x22\xf1\x1b\x21\x02\x1d\x22\x15\x1c\x06\x04\xe1\xe5\x11\x42\x1d\xcd\xa4\x1b\x06\x10\x11\x03\x01\xcd\xa4"
+"\x1b\xc3\x27\x1b\xcd\xad\x1b\x23\x05\xc2\xa4\x1b\xc9\xc5\xd5\xe5\x4e\x11\x14\x00\x19\x7e\xfe\x00\xca\xce\x1b\x06\x08\x0f\xf5\x3e"
+"\x00\xdc\xf3\x1b\xa9\x0f\x4f\xf1\x05\xc2\xbd\x1b\x06\x08\x11\x14\x00\x19\x7e\xfe\x00\xca\xe9\x1b\x06\x08\x0f\xf5\x3e\x00\xdc\x17"
+"\x1c\xa9\x0f\x4f\xf1\x05\xc2\xda\x1b\xe1\xd1\x79\x12\x13\xc1\xc9\x00\x00\x00\xc5\xe5\x2a\xf1\x1b\x46\x21\xf0\x1b\x7e\x4f\x07\x77"
+"\xfe\x01\xc2\x0c\x1c\x2a\xf1\x1b\x23\x22\xf1\x1b\x78\xa1\xe1\xc1\xc8\x3e\x01\xc9\x00\x00\x00\xc5\xe5\x2a\x15\x1c\x46\x21\x14\x1c"
+"\x7e\x4f\x07\x77\xfe\x01\xc2\x30\x1c\x2a\x15\x1c\x23\x22\x15\x1c\x78\xa1\xe1\xc1\xc8\x3e\x01\xc9\xf5\xc5\xd5\xe5\x36\x00\x54\x5d"
+"\x13\x0b\xed\xb0\xe1\xd1\xc1\xf1\xc9\xd5\xeb\x01\x28\x00\xcd\x38\x1c\xeb\x06\x14\x0e\x01\x16\x00\x5e\x7b\xa1\xca\x5f\x1c\x14\x79"
+"\x07\x4f\xfe\x01\xc2\x59\x1c\x23\x05\xc2\x58\x1c\x7a\xe6\xf8\x0f\x0f\x0f\x6f\x26\x00\x7a\xe6\x07\x3c\x47\x3e\x80\x07\x05\xc2\x7c"
+"\x1c\xd1\x19\x11\x14\x00\x19\x77\xc9\xc5\xd5\xe5\x21\xda\x1c\x11\x14\x00\xeb\x19\xeb\x34\x7e\xfe\x00\xca\xa8\x1c\x47\x1a\xa0\xca"
+"\xa4\x1c\x36\x00\xc1\xd1\xe1\xc9\x23\x13\xc3\x95\x1c\xc5\xd5\xe5\x21\x02\x1d\x11\x14\x00\xeb\x19\xeb\x7e\xb7\xca\xd5\x1c\x47\x1a"
+"\xa0\xc2\xd1\x1c\x78\x07\xfe\x01\xc2\xcf\x1c\x36\x00\x23\x13\x77\xaf\xe1\xd1\xc1\xc9\x23\x13\xc3\xb9\x1c\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xf5\xc5\xd5\xe5\xf3\xed\x73\x8d\x1d\x31\x05\x01\xfd\xe1\xdd\xe1\xe1\xd1\xc1\xf1\xed\x7b"
+"\x11\x01\x00\x00\x00\x00\xed\x73\x8b\x1d\x31\x8b\x1d\xf5\xc5\xd5\xe5\xdd\xe5\xfd\xe5\xed\x7b\x8d\x1d\xfb\x2a\x03\x01\x22\x7d\x1d"
+"\x21\x89\x1d\x7e\xe6\xd7\x77\x06\x10\x11\x7d\x1d\x21\x85\x1e\x1a\x13\xcd\x49\x1e\x05\xc2\x6f\x1d\xe1\xd1\xc1\xf1\xc9\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x7e\xcd\xab\x1d\x23\x05\xc2\x8f\x1d\xc9\xf5\xc5\xe5\x06\x04\x7e\xcd"
+"\xab\x1d\x23\x05\xc2\x9e\x1d\xe1\xc1\xf1\xc9\xf5\x0f\x0f\x0f\x0f\xcd\xb4\x1d\xf1\xf5\xc5\xd5\xe5\xe6\x0f\xfe\x0a\xda\xc1\x1d\xc6"
+"\x27\xc6\x30\x5f\x0e\x02\xcd\xce\x1d\xe1\xd1\xc1\xf1\xc9\xf5\xc5\xd5\xe5\xcd\x05\x00\xe1\xd1\xc1\xf1\xc9\x5a\x38\x30\x20\x69\x6e"
+"\x73\x74\x72\x75\x63\x74\x69\x6f\x6e\x20\x65\x78\x65\x72\x63\x69\x73\x65\x72\x0a\x0d\x24\x54\x65\x73\x74\x73\x20\x63\x6f\x6d\x70"
+"\x6c\x65\x74\x65\x24\x20\x20\x4f\x4b\x0a\x0d\x24\x20\x20\x45\x52\x52\x4f\x52\x20\x2a\x2a\x2a\x2a\x20\x63\x72\x63\x20\x65\x78\x70"
+"\x65\x63\x74\x65\x64\x3a\x24\x20\x66\x6f\x75\x6e\x64\x3a\x24\x0a\x0d\x24\xc5\xd5\xe5\x11\x85\x1e\x06\x04\x1a\xbe\xc2\x45\x1e\x23"
+"\x13\x05\xc2\x3a\x1e\xe1\xd1\xc1\xc9\xf5\xc5\xd5\xe5\xe5\x11\x03\x00\x19\xae\x6f\x26\x00\x29\x29\xeb\x21\x89\x1e\x19\xeb\xe1\x01"
+"\x04\x00\x1a\xa8\x46\x77\x13\x23\x0d\xc2\x62\x1e\xe1\xd1\xc1\xf1\xc9\xf5\xc5\xe5\x21\x85\x1e\x3e\xff\x06\x04\x77\x23\x05\xc2\x7b"
+"\x1e\xe1\xc1\xf1\xc9\x00\x00\x00\x00\x00\x00\x00\x00\x77\x07\x30\x96\xee\x0e\x61\x2c\x99\x09\x51\xba\x07\x6d\xc4\x19\x70\x6a\xf4"
+"\x8f\xe9\x63\xa5\x35\x9e\x64\x95\xa3\x0e\xdb\x88\x32\x79\xdc\xb8\xa4\xe0\xd5\xe9\x1e\x97\xd2\xd9\x88\x09\xb6\x4c\x2b\x7e\xb1\x7c"
+"\xbd\xe7\xb8\x2d\x07\x90\xbf\x1d\x91\x1d\xb7\x10\x64\x6a\xb0\x20\xf2\xf3\xb9\x71\x48\x84\xbe\x41\xde\x1a\xda\xd4\x7d\x6d\xdd\xe4"
+"\xeb\xf4\xd4\xb5\x51\x83\xd3\x85\xc7\x13\x6c\x98\x56\x64\x6b\xa8\xc0\xfd\x62\xf9\x7a\x8a\x65\xc9\xec\x14\x01\x5c\x4f\x63\x06\x6c"
+"\xd9\xfa\x0f\x3d\x63\x8d\x08\x0d\xf5\x3b\x6e\x20\xc8\x4c\x69\x10\x5e\xd5\x60\x41\xe4\xa2\x67\x71\x72\x3c\x03\xe4\xd1\x4b\x04\xd4"
+"\x47\xd2\x0d\x85\xfd\xa5\x0a\xb5\x6b\x35\xb5\xa8\xfa\x42\xb2\x98\x6c\xdb\xbb\xc9\xd6\xac\xbc\xf9\x40\x32\xd8\x6c\xe3\x45\xdf\x5c"
+"\x75\xdc\xd6\x0d\xcf\xab\xd1\x3d\x59\x26\xd9\x30\xac\x51\xde\x00\x3a\xc8\xd7\x51\x80\xbf\xd0\x61\x16\x21\xb4\xf4\xb5\x56\xb3\xc4"
+"\x23\xcf\xba\x95\x99\xb8\xbd\xa5\x0f\x28\x02\xb8\x9e\x5f\x05\x88\x08\xc6\x0c\xd9\xb2\xb1\x0b\xe9\x24\x2f\x6f\x7c\x87\x58\x68\x4c"
+"\x11\xc1\x61\x1d\xab\xb6\x66\x2d\x3d\x76\xdc\x41\x90\x01\xdb\x71\x06\x98\xd2\x20\xbc\xef\xd5\x10\x2a\x71\xb1\x85\x89\x06\xb6\xb5"
+"\x1f\x9f\xbf\xe4\xa5\xe8\xb8\xd4\x33\x78\x07\xc9\xa2\x0f\x00\xf9\x34\x96\x09\xa8\x8e\xe1\x0e\x98\x18\x7f\x6a\x0d\xbb\x08\x6d\x3d"
+"\x2d\x91\x64\x6c\x97\xe6\x63\x5c\x01\x6b\x6b\x51\xf4\x1c\x6c\x61\x62\x85\x65\x30\xd8\xf2\x62\x00\x4e\x6c\x06\x95\xed\x1b\x01\xa5"
+"\x7b\x82\x08\xf4\xc1\xf5\x0f\xc4\x57\x65\xb0\xd9\xc6\x12\xb7\xe9\x50\x8b\xbe\xb8\xea\xfc\xb9\x88\x7c\x62\xdd\x1d\xdf\x15\xda\x2d"
+"\x49\x8c\xd3\x7c\xf3\xfb\xd4\x4c\x65\x4d\xb2\x61\x58\x3a\xb5\x51\xce\xa3\xbc\x00\x74\xd4\xbb\x30\xe2\x4a\xdf\xa5\x41\x3d\xd8\x95"
+"\xd7\xa4\xd1\xc4\x6d\xd3\xd6\xf4\xfb\x43\x69\xe9\x6a\x34\x6e\xd9\xfc\xad\x67\x88\x46\xda\x60\xb8\xd0\x44\x04\x2d\x73\x33\x03\x1d"
+"\xe5\xaa\x0a\x4c\x5f\xdd\x0d\x7c\xc9\x50\x05\x71\x3c\x27\x02\x41\xaa\xbe\x0b\x10\x10\xc9\x0c\x20\x86\x57\x68\xb5\x25\x20\x6f\x85"
+"\xb3\xb9\x66\xd4\x09\xce\x61\xe4\x9f\x5e\xde\xf9\x0e\x29\xd9\xc9\x98\xb0\xd0\x98\x22\xc7\xd7\xa8\xb4\x59\xb3\x3d\x17\x2e\xb4\x0d"
+"\x81\xb7\xbd\x5c\x3b\xc0\xba\x6c\xad\xed\xb8\x83\x20\x9a\xbf\xb3\xb6\x03\xb6\xe2\x0c\x74\xb1\xd2\x9a\xea\xd5\x47\x39\x9d\xd2\x77"
+"\xaf\x04\xdb\x26\x15\x73\xdc\x16\x83\xe3\x63\x0b\x12\x94\x64\x3b\x84\x0d\x6d\x6a\x3e\x7a\x6a\x5a\xa8\xe4\x0e\xcf\x0b\x93\x09\xff"
+"\x9d\x0a\x00\xae\x27\x7d\x07\x9e\xb1\xf0\x0f\x93\x44\x87\x08\xa3\xd2\x1e\x01\xf2\x68\x69\x06\xc2\xfe\xf7\x62\x57\x5d\x80\x65\x67"
+"\xcb\x19\x6c\x36\x71\x6e\x6b\x06\xe7\xfe\xd4\x1b\x76\x89\xd3\x2b\xe0\x10\xda\x7a\x5a\x67\xdd\x4a\xcc\xf9\xb9\xdf\x6f\x8e\xbe\xef"
+"\xf9\x17\xb7\xbe\x43\x60\xb0\x8e\xd5\xd6\xd6\xa3\xe8\xa1\xd1\x93\x7e\x38\xd8\xc2\xc4\x4f\xdf\xf2\x52\xd1\xbb\x67\xf1\xa6\xbc\x57"
+"\x67\x3f\xb5\x06\xdd\x48\xb2\x36\x4b\xd8\x0d\x2b\xda\xaf\x0a\x1b\x4c\x36\x03\x4a\xf6\x41\x04\x7a\x60\xdf\x60\xef\xc3\xa8\x67\xdf"
+"\x55\x31\x6e\x8e\xef\x46\x69\xbe\x79\xcb\x61\xb3\x8c\xbc\x66\x83\x1a\x25\x6f\xd2\xa0\x52\x68\xe2\x36\xcc\x0c\x77\x95\xbb\x0b\x47"
+"\x03\x22\x02\x16\xb9\x55\x05\x26\x2f\xc5\xba\x3b\xbe\xb2\xbd\x0b\x28\x2b\xb4\x5a\x92\x5c\xb3\x6a\x04\xc2\xd7\xff\xa7\xb5\xd0\xcf"
+"\x31\x2c\xd9\x9e\x8b\x5b\xde\xae\x1d\x9b\x64\xc2\xb0\xec\x63\xf2\x26\x75\x6a\xa3\x9c\x02\x6d\x93\x0a\x9c\x09\x06\xa9\xeb\x0e\x36"
+"\x3f\x72\x07\x67\x85\x05\x00\x57\x13\x95\xbf\x4a\x82\xe2\xb8\x7a\x14\x7b\xb1\x2b\xae\x0c\xb6\x1b\x38\x92\xd2\x8e\x9b\xe5\xd5\xbe"
+"\x0d\x7c\xdc\xef\xb7\x0b\xdb\xdf\x21\x86\xd3\xd2\xd4\xf1\xd4\xe2\x42\x68\xdd\xb3\xf8\x1f\xda\x83\x6e\x81\xbe\x16\xcd\xf6\xb9\x26"
+"\x5b\x6f\xb0\x77\xe1\x18\xb7\x47\x77\x88\x08\x5a\xe6\xff\x0f\x6a\x70\x66\x06\x3b\xca\x11\x01\x0b\x5c\x8f\x65\x9e\xff\xf8\x62\xae"
+"\x69\x61\x6b\xff\xd3\x16\x6c\xcf\x45\xa0\x0a\xe2\x78\xd7\x0d\xd2\xee\x4e\x04\x83\x54\x39\x03\xb3\xc2\xa7\x67\x26\x61\xd0\x60\x16"
+"\xf7\x49\x69\x47\x4d\x3e\x6e\x77\xdb\xae\xd1\x6a\x4a\xd9\xd6\x5a\xdc\x40\xdf\x0b\x66\x37\xd8\x3b\xf0\xa9\xbc\xae\x53\xde\xbb\x9e"
+"\xc5\x47\xb2\xcf\x7f\x30\xb5\xff\xe9\xbd\xbd\xf2\x1c\xca\xba\xc2\x8a\x53\xb3\x93\x30\x24\xb4\xa3\xa6\xba\xd0\x36\x05\xcd\xd7\x06"
+"\x93\x54\xde\x57\x29\x23\xd9\x67\xbf\xb3\x66\x7a\x2e\xc4\x61\x4a\xb8\x5d\x68\x1b\x02\x2a\x6f\x2b\x94\xb4\x0b\xbe\x37\xc3\x0c\x8e"
+"\xa1\x5a\x05\xdf\x1b\x2d\x02\xef\x8d"
+;
+unsigned char dump_zexdoc[8585] =
+"\xc3\x13\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x2a\x06\x00\xf9\x11\xda\x1d\x0e\x09\xcd\xce\x1d\x21"
+"\x3a\x01\x7e\x23\xb6\xca\x2f\x01\x2b\xcd\xe2\x1a\xc3\x22\x01\x11\xf6\x1d\x0e\x09\xcd\xce\x1d\xc3\x00\x00\xc2\x01\x22\x02\x82\x02"
+"\xe2\x02\x42\x03\xa2\x03\x02\x04\x62\x04\xc2\x04\x22\x05\x82\x05\xe2\x05\x42\x06\xa2\x06\x02\x07\x62\x07\xc2\x07\x22\x08\x82\x08"
+"\xe2\x08\x42\x09\xa2\x09\x02\x0a\x62\x0a\xc2\x0a\x22\x0b\x82\x0b\xe2\x0b\x42\x0c\xa2\x0c\x02\x0d\x62\x0d\xc2\x0d\x22\x0e\x82\x0e"
+"\xe2\x0e\x42\x0f\xa2\x0f\x02\x10\x62\x10\xc2\x10\x22\x11\x82\x11\xe2\x11\x42\x12\xa2\x12\x02\x13\x62\x13\xc2\x13\x22\x14\x82\x14"
+"\xe2\x14\x42\x15\xa2\x15\x02\x16\x62\x16\xc2\x16\x22\x17\x82\x17\xe2\x17\x42\x18\xa2\x18\x02\x19\x62\x19\xc2\x19\x22\x1a\x82\x1a"
+"\x00\x00\xc7\xed\x42\x00\x00\x2c\x83\x88\x4f\x2b\xf2\x39\xb3\x1f\x7e\x63\x15\xd3\x89\x5e\x46\x00\x38\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x21\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xff\xff\xd7\x00\xff\xff\xf8"
+"\xb4\xea\xa9\x3c\x61\x64\x63\x2c\x73\x62\x63\x3e\x20\x68\x6c\x2c\x3c\x62\x63\x2c\x64\x65\x2c\x68\x6c\x2c\x73\x70\x3e\x2e\x2e\x2e"
+"\x2e\x24\xc7\x09\x00\x00\x00\xa5\xc4\xc7\xc4\x26\xd2\x50\xa0\xea\x58\x66\x85\xc6\xde\xc9\x9b\x30\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x21\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xff\xff\xd7\x00\xff\xff\x89"
+"\xfd\xb6\x35\x61\x64\x64\x20\x68\x6c\x2c\x3c\x62\x63\x2c\x64\x65\x2c\x68\x6c\x2c\x73\x70\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xc7\xdd\x09\x00\x00\xac\xdd\x94\xc2\x5b\x63\xd3\x33\x76\x6a\x20\xfa\x94\x68\xf5\x36\x00\x30\x00\x00\x00\x00\x00\x00\x21"
+"\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\xff\xff\xff\xff\xd7\x00\xff\xff\xc1"
+"\x33\x79\x0b\x61\x64\x64\x20\x69\x78\x2c\x3c\x62\x63\x2c\x64\x65\x2c\x69\x78\x2c\x73\x70\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xc7\xfd\x09\x00\x00\xc2\xc7\x07\xf4\xc1\x51\x96\x3e\xf4\x0b\x0f\x51\x92\x1e\xea\x71\x00\x30\x00\x00\x00\x00\x21\xf8\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\xff\xff\xff\xff\xd7\x00\xff\xff\xe8"
+"\x81\x7b\x9e\x61\x64\x64\x20\x69\x79\x2c\x3c\x62\x63\x2c\x64\x65\x2c\x69\x79\x2c\x73\x70\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xc6\x00\x00\x00\x40\x91\x3c\x7e\x67\x7a\x6d\xdf\x61\x5b\x29\x0b\x10\x66\xb2\x85\x38\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x48"
+"\x79\x93\x60\x61\x6c\x75\x6f\x70\x20\x61\x2c\x6e\x6e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x80\x00\x00\x00\x3e\xc5\x3a\x57\x4d\x4c\x03\x01\x09\xe3\x66\xa6\xd0\x3b\xbb\xad\x3f\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xd7\x00\x00\x00\xfe"
+"\x43\xb0\x16\x61\x6c\x75\x6f\x70\x20\x61\x2c\x3c\x62\x2c\x63\x2c\x64\x2c\x65\x2c\x68\x2c\x6c\x2c\x28\x68\x6c\x29\x2c\x61\x3e\x2e"
+"\x2e\x24\xd7\xdd\x84\x00\x00\xf7\xd6\x6e\xc7\xcf\xac\x47\x28\xdd\x22\x35\xc0\xc5\x38\x4b\x23\x20\x39\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xd7\x00\x00\x00\xa4"
+"\x02\x6d\x5a\x61\x6c\x75\x6f\x70\x20\x61\x2c\x3c\x69\x78\x68\x2c\x69\x78\x6c\x2c\x69\x79\x68\x2c\x69\x79\x6c\x3e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x86\x01\x00\xb7\x90\x02\x01\x02\x01\xfd\x32\x6e\x40\xdc\xc1\x45\x6e\xfa\xe5\x20\x38\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xe8"
+"\x49\x67\x6e\x61\x6c\x75\x6f\x70\x20\x61\x2c\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\x53\xdd\xcb\x01\x46\x75\x20\x02\x01\x02\x01\xfc\x3c\x9a\xa7\x74\x3d\x51\x27\x14\xca\x20\x00\x00\x38\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x53\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xa8"
+"\xee\x08\x67\x62\x69\x74\x20\x6e\x2c\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\x53\xcb\x40\x00\x00\xf1\x3e\xfc\x9d\xcc\x7a\x03\x01\x61\xbe\x86\x7a\x50\x24\x98\x19\x00\x3f\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x53\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\x00\xff\x00\x00\x7b"
+"\x55\xe6\xc8\x62\x69\x74\x20\x6e\x2c\x3c\x62\x2c\x63\x2c\x64\x2c\x65\x2c\x68\x2c\x6c\x2c\x28\x68\x6c\x29\x2c\x61\x3e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xed\xa9\x00\x00\xb6\xc7\xb4\x72\xf6\x18\x14\x01\xbd\x8d\x01\x00\xc0\x30\xa3\x94\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x0a\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xa8"
+"\x7e\x6c\xfa\x63\x70\x64\x3c\x72\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xed\xa1\x00\x00\x48\x4d\x4a\xaf\x6b\x90\x03\x01\x71\x4e\x01\x00\x93\x6a\x7c\x90\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x0a\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x06"
+"\xde\xb3\x56\x63\x70\x69\x3c\x72\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x27\x00\x00\x00\x41\x21\xfa\x09\x60\x1d\x59\xa5\x5b\x8d\x79\x90\x04\x8e\x9d\x29\x18\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\xd7\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x9b"
+"\x4b\xa6\x75\x3c\x64\x61\x61\x2c\x63\x70\x6c\x2c\x73\x63\x66\x2c\x63\x63\x66\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x3c\x00\x00\x00\xdf\x4a\xd8\xd5\x98\xe5\x2b\x8a\xb0\xa7\x1b\x43\x44\x5a\x30\xd0\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xd1"
+"\x88\x15\xa4\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x61\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x04\x00\x00\x00\x23\xd6\x2d\x43\x61\x7a\x80\x81\x86\x5a\x85\x1e\x86\x58\xbb\x9b\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x5f"
+"\x68\x22\x64\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x62\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x03\x00\x00\x00\x97\xcd\xab\x44\xc9\x8d\xe3\xe3\xcc\x11\xa4\xe8\x02\x49\x4d\x2a\x08\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x21\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xd2"
+"\xae\x3b\xec\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x62\x63\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x0c\x00\x00\x00\x89\xd7\x35\x09\x5b\x05\x85\x9f\x27\x8b\x08\xd2\x95\x05\x60\x06\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xc2"
+"\x84\x55\x4c\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x63\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x14\x00\x00\x00\xea\xa0\xba\x5f\xfb\x65\x1c\x98\xcc\x38\xbc\xde\x43\x5c\xbd\x03\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x45"
+"\x23\xde\x10\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x64\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x13\x00\x00\x00\x2e\x34\x1d\x13\xc9\x28\xca\x0a\x67\x99\x2e\x3a\x92\xf6\x54\x9d\x08\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x21\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xae"
+"\xc6\xd4\x2c\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x64\x65\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x1c\x00\x00\x00\x2f\x60\x0d\x4c\x02\x24\xf5\xe2\xf4\xa0\x0a\xa1\x13\x32\x25\x59\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xe1"
+"\x75\xaf\xcc\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x65\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x24\x00\x00\x00\x06\x15\xeb\xf2\xdd\xe8\x2b\x26\xa6\x11\x1a\xbc\x17\x06\x18\x28\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x1c"
+"\xed\x84\x7d\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x68\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x23\x00\x00\x00\xf4\xc3\xa5\x07\x6d\x1b\x04\x4f\xc2\xe2\x2a\x82\x57\xe0\xe1\xc3\x08\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x21\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xfc"
+"\x0d\x6d\x4a\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x68\x6c\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x23\x00\x00\x3c\xbc\x9b\x0d\x81\xe0\xfd\xad\x7f\x9a\xe5\x96\x13\x85\xe2\x0b\x00\x08\x00\x00\x00\x00\x00\x00\x21"
+"\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xa5"
+"\x4d\xbe\x31\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x69\x78\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xfd\x23\x00\x00\x02\x94\x7a\x63\x82\x31\x5a\xc6\xe9\xb2\xb4\xab\x16\xf2\x05\x6d\x00\x08\x00\x00\x00\x00\x21\xf8\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x50"
+"\x5d\x51\xa3\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x69\x79\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x2c\x00\x00\x00\x31\x80\x20\xa5\x56\x43\x09\xb4\xc1\xf4\xa2\xdf\xd1\x3c\xa2\x3e\x01\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x56"
+"\xcd\x06\xf3\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x6c\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x34\x00\x00\x00\x56\xb8\x7c\x0c\x3e\xe5\x03\x01\x7e\x87\x58\xda\x15\x5c\x37\x1f\x01\x00\x00\x00\xff\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xb8"
+"\x3a\xdc\xef\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x28\x68\x6c\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x33\x00\x00\x00\x6f\x34\x82\xd4\x69\xd1\xb6\xde\x94\xa4\x76\xf4\x53\x02\x5b\x85\x08\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x21\xf8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x5d"
+"\xac\xd5\x27\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x73\x70\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x34\x01\x00\x6e\xfa\x02\x01\x02\x01\x28\x2c\x94\x88\x57\x50\x16\x33\x6f\x28\x20\x01\x00\x00\xff\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x20"
+"\x58\x14\x70\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x24\x00\x00\x38\xb8\x6c\x31\xd4\xc6\x01\x3e\x58\x83\xb4\x15\x81\xde\x59\x42\x00\x01\x00\x00\x00\x00\x00\xff\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x6f"
+"\x46\x36\x62\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x69\x78\x68\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x2c\x00\x00\x14\x4d\x60\x74\xd4\x76\xe7\x06\xa2\x32\x3c\x21\xd6\xd7\xa5\x99\x00\x01\x00\x00\x00\x00\xff\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x02"
+"\x7b\xef\x2c\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x69\x78\x6c\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x24\x00\x00\x36\x28\x6f\x9f\x16\x91\xb9\x61\xcb\x82\x19\xe2\x92\x73\x8c\xa9\x00\x01\x00\x00\x00\xff\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x2d"
+"\x96\x6c\xf3\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x69\x79\x68\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x2c\x00\x00\xc6\xd7\xd5\x62\x9e\xa0\x39\x70\x7e\x3e\x12\x9f\x90\xd9\x0f\x22\x00\x01\x00\x00\xff\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xfb"
+"\xcb\xba\x95\x3c\x69\x6e\x63\x2c\x64\x65\x63\x3e\x20\x69\x79\x6c\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xed\x4b\x03\x01\xa8\xf9\x59\xf5\xa4\x93\xed\xf5\x96\x6f\x68\xd9\x86\xe6\xd8\x4b\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4d"
+"\x45\xa9\xac\x6c\x64\x20\x3c\x62\x63\x2c\x64\x65\x3e\x2c\x28\x6e\x6e\x6e\x6e\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x2a\x03\x01\x00\x63\x98\x30\x78\x77\x20\xfe\xb1\xfa\xb9\xb8\xab\x04\x06\x15\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x5f"
+"\x97\x24\x87\x6c\x64\x20\x68\x6c\x2c\x28\x6e\x6e\x6e\x6e\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xed\x7b\x03\x01\xfc\x8d\xd7\x57\x61\x21\x18\xca\x85\xc1\xda\x27\x83\x1e\x60\xf4\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x7a"
+"\xce\xa1\x1b\x6c\x64\x20\x73\x70\x2c\x28\x6e\x6e\x6e\x6e\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x2a\x03\x01\xd7\xde\xfa\xa6\x80\xf7\x4c\x24\xde\x87\xc2\xbc\x16\x63\x96\x4c\x20\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x85"
+"\x8b\xf1\x6d\x6c\x64\x20\x3c\x69\x78\x2c\x69\x79\x3e\x2c\x28\x6e\x6e\x6e\x6e\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xed\x43\x03\x01\x98\x1f\x4d\x84\xac\xe8\xed\xc9\x5d\xc9\x61\x8f\x80\x3f\xbf\xc7\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\x00\x00\x00\x00\x64"
+"\x1e\x87\x15\x6c\x64\x20\x28\x6e\x6e\x6e\x6e\x29\x2c\x3c\x62\x63\x2c\x64\x65\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x22\x03\x01\x00\x03\xd0\x72\x77\x53\x7f\x72\x3f\xea\x64\x80\xe1\x10\x2d\xe9\x35\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\xa3"
+"\x60\x8b\x47\x6c\x64\x20\x28\x6e\x6e\x6e\x6e\x29\x2c\x68\x6c\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xed\x73\x03\x01\xdc\xc0\xd6\xd1\x5a\xed\x56\xf3\xda\xaf\xa7\x6c\x44\x9f\x0a\x3f\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x16"
+"\x58\x5f\xd7\x6c\x64\x20\x28\x6e\x6e\x6e\x6e\x29\x2c\x73\x70\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x22\x03\x01\xc3\x6c\x91\x0d\x00\x69\xf8\x8e\xd6\xe3\xf7\xc3\xc6\xd9\xdf\xc2\x20\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xba"
+"\x10\x2a\x6b\x6c\x64\x20\x28\x6e\x6e\x6e\x6e\x29\x2c\x3c\x69\x78\x2c\x69\x79\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x01\x00\x00\x00\x1c\x5c\x46\x2d\xb9\x8e\x78\x60\xb1\x74\x0e\xb3\x46\xd1\xcc\x30\x30\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xde"
+"\x39\x19\x69\x6c\x64\x20\x3c\x62\x63\x2c\x64\x65\x2c\x68\x6c\x2c\x73\x70\x3e\x2c\x6e\x6e\x6e\x6e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x21\x00\x00\xe8\x87\x06\x20\x12\xbd\x9b\xb6\x53\x72\xe5\xa1\x51\x13\xbd\xf1\x20\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x22"
+"\x7d\xd5\x25\x6c\x64\x20\x3c\x69\x78\x2c\x69\x79\x3e\x2c\x6e\x6e\x6e\x6e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x0a\x00\x00\x00\xa8\xb3\x2a\x1d\x8e\x7f\xac\x42\x03\x01\x03\x01\xc6\xb1\x8e\xef\x10\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\xff\x00\x00\xb0"
+"\x81\x89\x35\x6c\x64\x20\x61\x2c\x3c\x28\x62\x63\x29\x2c\x28\x64\x65\x29\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x06\x00\x00\x00\x07\xc4\x9d\xf4\x3d\xd1\x39\x03\x89\xde\x55\x74\x53\xc0\x09\x55\x38\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\xf1"
+"\xda\xb5\x56\x6c\x64\x20\x3c\x62\x2c\x63\x2c\x64\x2c\x65\x2c\x68\x2c\x6c\x2c\x28\x68\x6c\x29\x2c\x61\x3e\x2c\x6e\x6e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x36\x01\x00\x45\x1b\x02\x01\x02\x01\xc1\xd5\xc7\x61\xc4\xbd\xc0\x85\x16\xcd\x20\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x26"
+"\xdb\x47\x7e\x6c\x64\x20\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2c\x6e\x6e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x46\x01\x00\x16\xd0\x02\x01\x02\x01\x60\x42\x39\x7f\x04\x04\x97\x4a\x85\xd0\x20\x18\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcc"
+"\x11\x06\xa8\x6c\x64\x20\x3c\x62\x2c\x63\x2c\x64\x2c\x65\x3e\x2c\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x66\x01\x00\xe0\x84\x02\x01\x02\x01\x52\x9c\x99\xa7\xb6\x49\x93\x00\xad\xee\x20\x08\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfa"
+"\x2a\x4d\x03\x6c\x64\x20\x3c\x68\x2c\x6c\x3e\x2c\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x7e\x01\x00\xb6\xd8\x02\x01\x02\x01\x12\xc6\x07\xdf\xd0\x9c\x43\xa6\xe5\xa0\x20\x00\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xa5"
+"\xe9\xac\x64\x6c\x64\x20\x61\x2c\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x26\x00\x00\x53\x3c\x40\x46\x79\xe1\x11\x77\x07\xc1\xfa\x1a\x81\xad\x9b\x5d\x20\x08\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x24"
+"\xe8\x82\x8b\x6c\x64\x20\x3c\x69\x78\x68\x2c\x69\x78\x6c\x2c\x69\x79\x68\x2c\x69\x79\x6c\x3e\x2c\x6e\x6e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x40\x00\x00\x00\xa4\x72\x24\xa0\xac\x61\x03\x01\xc7\x82\x8f\x71\x97\x8f\x8e\xef\x3f\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xd7\xff\x00\x00\x74"
+"\x4b\x01\x18\x6c\x64\x20\x3c\x62\x63\x64\x65\x68\x6c\x61\x3e\x2c\x3c\x62\x63\x64\x65\x68\x6c\x61\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x40\x00\x00\xc5\xbc\x03\x01\x03\x01\x03\x01\xc2\x2f\xc0\x98\x83\x1f\xcd\x3b\x20\x3f\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xd7\xff\x00\x00\x47"
+"\x8b\xa3\x6b\x6c\x64\x20\x3c\x62\x63\x64\x65\x78\x79\x61\x3e\x2c\x3c\x62\x63\x64\x65\x78\x79\x61\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x32\x03\x01\x00\x68\xfd\xec\xf4\xa0\x44\x43\xb5\x53\x06\xba\xcd\xd2\x4f\xd8\x1f\x08\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\xff\x00\x00\xc9"
+"\x26\x2d\xe5\x6c\x64\x20\x61\x2c\x28\x6e\x6e\x6e\x6e\x29\x20\x2f\x20\x6c\x64\x20\x28\x6e\x6e\x6e\x6e\x29\x2c\x61\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xed\xa8\x00\x00\x52\x98\xfa\x68\xa1\x66\x06\x01\x04\x01\x01\x00\xc1\x68\xb7\x20\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x94"
+"\xf4\x27\x69\x6c\x64\x64\x3c\x72\x3e\x20\x28\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xed\xa8\x00\x00\x2e\xf1\x2a\xeb\xba\xd5\x06\x01\x04\x01\x02\x00\x47\xff\xe4\xfb\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x5a"
+"\x90\x7e\xd4\x6c\x64\x64\x3c\x72\x3e\x20\x28\x32\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xed\xa0\x00\x00\x30\xfe\xcd\x03\x58\x60\x05\x01\x03\x01\x01\x00\x04\x60\x88\x26\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x9a"
+"\xbd\xf6\xb5\x6c\x64\x69\x3c\x72\x3e\x20\x28\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xed\xa0\x00\x00\xce\x4a\x6e\xc2\x88\xb1\x05\x01\x03\x01\x02\x00\x14\x2d\x9f\xa3\x00\x10\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xeb"
+"\x59\x89\x1b\x6c\x64\x69\x3c\x72\x3e\x20\x28\x32\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xed\x44\x00\x00\xa2\x38\x6b\x5f\x34\xd9\xe4\x57\xd6\xd2\x42\x46\x43\x5a\xcc\x09\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\xd7\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6a"
+"\x3c\x3b\xbd\x6e\x65\x67\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xed\x67\x00\x00\xcb\x91\x8b\xc4\x62\xfa\x03\x01\x20\xe7\x79\xb4\x40\x06\xe2\x8a\x00\x08\x00\x00\xff\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\xff\x00\x00\x95"
+"\x5b\xa3\x26\x3c\x72\x72\x64\x2c\x72\x6c\x64\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x07\x00\x00\x00\x92\xcb\x43\x6d\x90\x0a\x84\xc2\x53\x0c\x0e\xf5\x91\xeb\xfc\x40\x18\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\x25"
+"\x13\x30\xae\x3c\x72\x6c\x63\x61\x2c\x72\x72\x63\x61\x2c\x72\x6c\x61\x2c\x72\x72\x61\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\xcb\x01\x06\xaf\xdd\x02\x01\x02\x01\x3c\xff\xf6\xdb\xf4\x94\x82\x80\xd9\x61\x20\x00\x00\x38\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x80\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x57\x00\x00\x00\x71"
+"\x3a\xcd\x81\x73\x68\x66\x2f\x72\x6f\x74\x20\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xcb\x00\x00\x00\xeb\xcc\x4a\x5d\x07\xe0\x03\x01\x95\x13\xee\x30\x43\x78\xad\x3d\x00\x3f\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x80\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\x57\xff\x00\x00\xeb"
+"\x60\x4d\x58\x73\x68\x66\x2f\x72\x6f\x74\x20\x3c\x62\x2c\x63\x2c\x64\x2c\x65\x2c\x68\x2c\x6c\x2c\x28\x68\x6c\x29\x2c\x61\x3e\x2e"
+"\x2e\x24\xd7\xcb\x80\x00\x00\xd5\x2c\xab\x97\xff\x39\x03\x01\x4b\xd1\xb2\x6a\x53\x27\x38\xb5\x00\x7f\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\xd7\xff\x00\x00\x8b"
+"\x57\xf0\x08\x3c\x73\x65\x74\x2c\x72\x65\x73\x3e\x20\x6e\x2c\x3c\x62\x63\x64\x65\x68\x6c\x28\x68\x6c\x29\x61\x3e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\xcb\x01\x86\x44\xfb\x02\x01\x02\x01\x09\xba\xbe\x68\xd8\x32\x10\x5e\x67\xa8\x20\x00\x00\x78\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xd7\x00\x00\x00\xcc"
+"\x63\xf9\x8a\x3c\x73\x65\x74\x2c\x72\x65\x73\x3e\x20\x6e\x2c\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x70\x01\x00\x0d\x27\x02\x01\x02\x01\x3a\xb7\x7b\x88\xee\x99\x86\x70\x07\xca\x20\x03\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\xff\xff\x00\x00\x00\x00\x04"
+"\x62\x6a\xbf\x6c\x64\x20\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2c\x3c\x62\x2c\x63\x2c\x64\x2c\x65\x3e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x74\x01\x00\x64\xb6\x02\x01\x02\x01\xac\xe8\xf5\xb5\xfe\xaa\x12\x10\x66\x95\x20\x01\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x6a"
+"\x1a\x88\x31\x6c\x64\x20\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2c\x3c\x68\x2c\x6c\x3e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\xdd\x77\x01\x00\xaf\x67\x02\x01\x02\x01\x13\x4f\x44\x06\xd7\xbc\x50\xac\xaf\x5f\x20\x00\x00\x00\x00\x00\x01\x00\x01"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\xcc"
+"\xbe\x5a\x96\x6c\x64\x20\x28\x3c\x69\x78\x2c\x69\x79\x3e\x2b\x31\x29\x2c\x61\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xd7\x02\x00\x00\x00\x3b\x0c\x92\xb5\xff\x6c\x9e\x95\x03\x01\x04\x01\xc1\x21\xe7\xbd\x18\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x00\x00\x7a"
+"\x4c\x11\x4f\x6c\x64\x20\x28\x3c\x62\x63\x2c\x64\x65\x3e\x29\x2c\x61\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e\x2e"
+"\x2e\x24\xe5\x7e\x23\x66\x6f\x7e\x32\x65\x1d\x23\xe5\x11\x14\x00\x19\x11\xda\x1c\xcd\x49\x1c\xe1\xe5\x11\x28\x00\x19\x11\x02\x1d"
+"\xcd\x49\x1c\x21\x02\x1d\x36\x01\xe1\xe5\x11\x42\x1d\x01\x04\x00\xed\xb0\x11\x03\x01\x01\x10\x00\xed\xb0\x11\x2c\x00\x19\xeb\x0e"
+"\x09\xcd\xce\x1d\xcd\x71\x1e\x3a\x42\x1d\xfe\x76\xca\x3e\x1b\xe6\xdf\xfe\xdd\xc2\x3b\x1b\x3a\x43\x1d\xfe\x76\xc4\x2a\x1d\xcd\x89"
+"\x1c\xc4\xad\x1c\xe1\xca\x7a\x1b\x11\x3c\x00\x19\xcd\x32\x1e\x11\x05\x1e\xca\x71\x1b\x11\x0c\x1e\x0e\x09\xcd\xce\x1d\xcd\x99\x1d"
+"\x11\x27\x1e\x0e\x09\xcd\xce\x1d\x21\x85\x1e\xcd\x99\x1d\x11\x2f\x1e\x0e\x09\xcd\xce\x1d\xe1\x23\x23\xc9\xe5\x3e\x01\x32\xf0\x1b"
+"\x32\x14\x1c\x21\xda\x1c\x22\xf1\x1b\x21\x02\x1d\x22\x15\x1c\x06\x04\xe1\xe5\x11\x42\x1d\xcd\xa4\x1b\x06\x10\x11\x03\x01\xcd\xa4"
+"\x1b\xc3\x27\x1b\xcd\xad\x1b\x23\x05\xc2\xa4\x1b\xc9\xc5\xd5\xe5\x4e\x11\x14\x00\x19\x7e\xfe\x00\xca\xce\x1b\x06\x08\x0f\xf5\x3e"
+"\x00\xdc\xf3\x1b\xa9\x0f\x4f\xf1\x05\xc2\xbd\x1b\x06\x08\x11\x14\x00\x19\x7e\xfe\x00\xca\xe9\x1b\x06\x08\x0f\xf5\x3e\x00\xdc\x17"
+"\x1c\xa9\x0f\x4f\xf1\x05\xc2\xda\x1b\xe1\xd1\x79\x12\x13\xc1\xc9\x00\x00\x00\xc5\xe5\x2a\xf1\x1b\x46\x21\xf0\x1b\x7e\x4f\x07\x77"
+"\xfe\x01\xc2\x0c\x1c\x2a\xf1\x1b\x23\x22\xf1\x1b\x78\xa1\xe1\xc1\xc8\x3e\x01\xc9\x00\x00\x00\xc5\xe5\x2a\x15\x1c\x46\x21\x14\x1c"
+"\x7e\x4f\x07\x77\xfe\x01\xc2\x30\x1c\x2a\x15\x1c\x23\x22\x15\x1c\x78\xa1\xe1\xc1\xc8\x3e\x01\xc9\xf5\xc5\xd5\xe5\x36\x00\x54\x5d"
+"\x13\x0b\xed\xb0\xe1\xd1\xc1\xf1\xc9\xd5\xeb\x01\x28\x00\xcd\x38\x1c\xeb\x06\x14\x0e\x01\x16\x00\x5e\x7b\xa1\xca\x5f\x1c\x14\x79"
+"\x07\x4f\xfe\x01\xc2\x59\x1c\x23\x05\xc2\x58\x1c\x7a\xe6\xf8\x0f\x0f\x0f\x6f\x26\x00\x7a\xe6\x07\x3c\x47\x3e\x80\x07\x05\xc2\x7c"
+"\x1c\xd1\x19\x11\x14\x00\x19\x77\xc9\xc5\xd5\xe5\x21\xda\x1c\x11\x14\x00\xeb\x19\xeb\x34\x7e\xfe\x00\xca\xa8\x1c\x47\x1a\xa0\xca"
+"\xa4\x1c\x36\x00\xc1\xd1\xe1\xc9\x23\x13\xc3\x95\x1c\xc5\xd5\xe5\x21\x02\x1d\x11\x14\x00\xeb\x19\xeb\x7e\xb7\xca\xd5\x1c\x47\x1a"
+"\xa0\xc2\xd1\x1c\x78\x07\xfe\x01\xc2\xcf\x1c\x36\x00\x23\x13\x77\xaf\xe1\xd1\xc1\xc9\x23\x13\xc3\xb9\x1c\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xf5\xc5\xd5\xe5\xf3\xed\x73\x8d\x1d\x31\x05\x01\xfd\xe1\xdd\xe1\xe1\xd1\xc1\xf1\xed\x7b"
+"\x11\x01\x00\x00\x00\x00\xed\x73\x8b\x1d\x31\x8b\x1d\xf5\xc5\xd5\xe5\xdd\xe5\xfd\xe5\xed\x7b\x8d\x1d\xfb\x2a\x03\x01\x22\x7d\x1d"
+"\x21\x89\x1d\x7e\xe6\xd7\x77\x06\x10\x11\x7d\x1d\x21\x85\x1e\x1a\x13\xcd\x49\x1e\x05\xc2\x6f\x1d\xe1\xd1\xc1\xf1\xc9\x00\x00\x00"
+"\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x7e\xcd\xab\x1d\x23\x05\xc2\x8f\x1d\xc9\xf5\xc5\xe5\x06\x04\x7e\xcd"
+"\xab\x1d\x23\x05\xc2\x9e\x1d\xe1\xc1\xf1\xc9\xf5\x0f\x0f\x0f\x0f\xcd\xb4\x1d\xf1\xf5\xc5\xd5\xe5\xe6\x0f\xfe\x0a\xda\xc1\x1d\xc6"
+"\x27\xc6\x30\x5f\x0e\x02\xcd\xce\x1d\xe1\xd1\xc1\xf1\xc9\xf5\xc5\xd5\xe5\xcd\x05\x00\xe1\xd1\xc1\xf1\xc9\x5a\x38\x30\x20\x69\x6e"
+"\x73\x74\x72\x75\x63\x74\x69\x6f\x6e\x20\x65\x78\x65\x72\x63\x69\x73\x65\x72\x0a\x0d\x24\x54\x65\x73\x74\x73\x20\x63\x6f\x6d\x70"
+"\x6c\x65\x74\x65\x24\x20\x20\x4f\x4b\x0a\x0d\x24\x20\x20\x45\x52\x52\x4f\x52\x20\x2a\x2a\x2a\x2a\x20\x63\x72\x63\x20\x65\x78\x70"
+"\x65\x63\x74\x65\x64\x3a\x24\x20\x66\x6f\x75\x6e\x64\x3a\x24\x0a\x0d\x24\xc5\xd5\xe5\x11\x85\x1e\x06\x04\x1a\xbe\xc2\x45\x1e\x23"
+"\x13\x05\xc2\x3a\x1e\xe1\xd1\xc1\xc9\xf5\xc5\xd5\xe5\xe5\x11\x03\x00\x19\xae\x6f\x26\x00\x29\x29\xeb\x21\x89\x1e\x19\xeb\xe1\x01"
+"\x04\x00\x1a\xa8\x46\x77\x13\x23\x0d\xc2\x62\x1e\xe1\xd1\xc1\xf1\xc9\xf5\xc5\xe5\x21\x85\x1e\x3e\xff\x06\x04\x77\x23\x05\xc2\x7b"
+"\x1e\xe1\xc1\xf1\xc9\x00\x00\x00\x00\x00\x00\x00\x00\x77\x07\x30\x96\xee\x0e\x61\x2c\x99\x09\x51\xba\x07\x6d\xc4\x19\x70\x6a\xf4"
+"\x8f\xe9\x63\xa5\x35\x9e\x64\x95\xa3\x0e\xdb\x88\x32\x79\xdc\xb8\xa4\xe0\xd5\xe9\x1e\x97\xd2\xd9\x88\x09\xb6\x4c\x2b\x7e\xb1\x7c"
+"\xbd\xe7\xb8\x2d\x07\x90\xbf\x1d\x91\x1d\xb7\x10\x64\x6a\xb0\x20\xf2\xf3\xb9\x71\x48\x84\xbe\x41\xde\x1a\xda\xd4\x7d\x6d\xdd\xe4"
+"\xeb\xf4\xd4\xb5\x51\x83\xd3\x85\xc7\x13\x6c\x98\x56\x64\x6b\xa8\xc0\xfd\x62\xf9\x7a\x8a\x65\xc9\xec\x14\x01\x5c\x4f\x63\x06\x6c"
+"\xd9\xfa\x0f\x3d\x63\x8d\x08\x0d\xf5\x3b\x6e\x20\xc8\x4c\x69\x10\x5e\xd5\x60\x41\xe4\xa2\x67\x71\x72\x3c\x03\xe4\xd1\x4b\x04\xd4"
+"\x47\xd2\x0d\x85\xfd\xa5\x0a\xb5\x6b\x35\xb5\xa8\xfa\x42\xb2\x98\x6c\xdb\xbb\xc9\xd6\xac\xbc\xf9\x40\x32\xd8\x6c\xe3\x45\xdf\x5c"
+"\x75\xdc\xd6\x0d\xcf\xab\xd1\x3d\x59\x26\xd9\x30\xac\x51\xde\x00\x3a\xc8\xd7\x51\x80\xbf\xd0\x61\x16\x21\xb4\xf4\xb5\x56\xb3\xc4"
+"\x23\xcf\xba\x95\x99\xb8\xbd\xa5\x0f\x28\x02\xb8\x9e\x5f\x05\x88\x08\xc6\x0c\xd9\xb2\xb1\x0b\xe9\x24\x2f\x6f\x7c\x87\x58\x68\x4c"
+"\x11\xc1\x61\x1d\xab\xb6\x66\x2d\x3d\x76\xdc\x41\x90\x01\xdb\x71\x06\x98\xd2\x20\xbc\xef\xd5\x10\x2a\x71\xb1\x85\x89\x06\xb6\xb5"
+"\x1f\x9f\xbf\xe4\xa5\xe8\xb8\xd4\x33\x78\x07\xc9\xa2\x0f\x00\xf9\x34\x96\x09\xa8\x8e\xe1\x0e\x98\x18\x7f\x6a\x0d\xbb\x08\x6d\x3d"
+"\x2d\x91\x64\x6c\x97\xe6\x63\x5c\x01\x6b\x6b\x51\xf4\x1c\x6c\x61\x62\x85\x65\x30\xd8\xf2\x62\x00\x4e\x6c\x06\x95\xed\x1b\x01\xa5"
+"\x7b\x82\x08\xf4\xc1\xf5\x0f\xc4\x57\x65\xb0\xd9\xc6\x12\xb7\xe9\x50\x8b\xbe\xb8\xea\xfc\xb9\x88\x7c\x62\xdd\x1d\xdf\x15\xda\x2d"
+"\x49\x8c\xd3\x7c\xf3\xfb\xd4\x4c\x65\x4d\xb2\x61\x58\x3a\xb5\x51\xce\xa3\xbc\x00\x74\xd4\xbb\x30\xe2\x4a\xdf\xa5\x41\x3d\xd8\x95"
+"\xd7\xa4\xd1\xc4\x6d\xd3\xd6\xf4\xfb\x43\x69\xe9\x6a\x34\x6e\xd9\xfc\xad\x67\x88\x46\xda\x60\xb8\xd0\x44\x04\x2d\x73\x33\x03\x1d"
+"\xe5\xaa\x0a\x4c\x5f\xdd\x0d\x7c\xc9\x50\x05\x71\x3c\x27\x02\x41\xaa\xbe\x0b\x10\x10\xc9\x0c\x20\x86\x57\x68\xb5\x25\x20\x6f\x85"
+"\xb3\xb9\x66\xd4\x09\xce\x61\xe4\x9f\x5e\xde\xf9\x0e\x29\xd9\xc9\x98\xb0\xd0\x98\x22\xc7\xd7\xa8\xb4\x59\xb3\x3d\x17\x2e\xb4\x0d"
+"\x81\xb7\xbd\x5c\x3b\xc0\xba\x6c\xad\xed\xb8\x83\x20\x9a\xbf\xb3\xb6\x03\xb6\xe2\x0c\x74\xb1\xd2\x9a\xea\xd5\x47\x39\x9d\xd2\x77"
+"\xaf\x04\xdb\x26\x15\x73\xdc\x16\x83\xe3\x63\x0b\x12\x94\x64\x3b\x84\x0d\x6d\x6a\x3e\x7a\x6a\x5a\xa8\xe4\x0e\xcf\x0b\x93\x09\xff"
+"\x9d\x0a\x00\xae\x27\x7d\x07\x9e\xb1\xf0\x0f\x93\x44\x87\x08\xa3\xd2\x1e\x01\xf2\x68\x69\x06\xc2\xfe\xf7\x62\x57\x5d\x80\x65\x67"
+"\xcb\x19\x6c\x36\x71\x6e\x6b\x06\xe7\xfe\xd4\x1b\x76\x89\xd3\x2b\xe0\x10\xda\x7a\x5a\x67\xdd\x4a\xcc\xf9\xb9\xdf\x6f\x8e\xbe\xef"
+"\xf9\x17\xb7\xbe\x43\x60\xb0\x8e\xd5\xd6\xd6\xa3\xe8\xa1\xd1\x93\x7e\x38\xd8\xc2\xc4\x4f\xdf\xf2\x52\xd1\xbb\x67\xf1\xa6\xbc\x57"
+"\x67\x3f\xb5\x06\xdd\x48\xb2\x36\x4b\xd8\x0d\x2b\xda\xaf\x0a\x1b\x4c\x36\x03\x4a\xf6\x41\x04\x7a\x60\xdf\x60\xef\xc3\xa8\x67\xdf"
+"\x55\x31\x6e\x8e\xef\x46\x69\xbe\x79\xcb\x61\xb3\x8c\xbc\x66\x83\x1a\x25\x6f\xd2\xa0\x52\x68\xe2\x36\xcc\x0c\x77\x95\xbb\x0b\x47"
+"\x03\x22\x02\x16\xb9\x55\x05\x26\x2f\xc5\xba\x3b\xbe\xb2\xbd\x0b\x28\x2b\xb4\x5a\x92\x5c\xb3\x6a\x04\xc2\xd7\xff\xa7\xb5\xd0\xcf"
+"\x31\x2c\xd9\x9e\x8b\x5b\xde\xae\x1d\x9b\x64\xc2\xb0\xec\x63\xf2\x26\x75\x6a\xa3\x9c\x02\x6d\x93\x0a\x9c\x09\x06\xa9\xeb\x0e\x36"
+"\x3f\x72\x07\x67\x85\x05\x00\x57\x13\x95\xbf\x4a\x82\xe2\xb8\x7a\x14\x7b\xb1\x2b\xae\x0c\xb6\x1b\x38\x92\xd2\x8e\x9b\xe5\xd5\xbe"
+"\x0d\x7c\xdc\xef\xb7\x0b\xdb\xdf\x21\x86\xd3\xd2\xd4\xf1\xd4\xe2\x42\x68\xdd\xb3\xf8\x1f\xda\x83\x6e\x81\xbe\x16\xcd\xf6\xb9\x26"
+"\x5b\x6f\xb0\x77\xe1\x18\xb7\x47\x77\x88\x08\x5a\xe6\xff\x0f\x6a\x70\x66\x06\x3b\xca\x11\x01\x0b\x5c\x8f\x65\x9e\xff\xf8\x62\xae"
+"\x69\x61\x6b\xff\xd3\x16\x6c\xcf\x45\xa0\x0a\xe2\x78\xd7\x0d\xd2\xee\x4e\x04\x83\x54\x39\x03\xb3\xc2\xa7\x67\x26\x61\xd0\x60\x16"
+"\xf7\x49\x69\x47\x4d\x3e\x6e\x77\xdb\xae\xd1\x6a\x4a\xd9\xd6\x5a\xdc\x40\xdf\x0b\x66\x37\xd8\x3b\xf0\xa9\xbc\xae\x53\xde\xbb\x9e"
+"\xc5\x47\xb2\xcf\x7f\x30\xb5\xff\xe9\xbd\xbd\xf2\x1c\xca\xba\xc2\x8a\x53\xb3\x93\x30\x24\xb4\xa3\xa6\xba\xd0\x36\x05\xcd\xd7\x06"
+"\x93\x54\xde\x57\x29\x23\xd9\x67\xbf\xb3\x66\x7a\x2e\xc4\x61\x4a\xb8\x5d\x68\x1b\x02\x2a\x6f\x2b\x94\xb4\x0b\xbe\x37\xc3\x0c\x8e"
+"\xa1\x5a\x05\xdf\x1b\x2d\x02\xef\x8d"
+;
 dump_item dump_items[DUMP_NUM_ITEMS] = {
-{ "zexdoc", dump_zexdoc, 8585 },
 { "zexall", dump_zexall, 8585 },
+{ "zexdoc", dump_zexdoc, 8585 },
 };
@@ -1,9 +1,12 @@
 #pragma once
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include <stdint.h>
 extern unsigned char dump_zexall[8585];
 extern unsigned char dump_zexdoc[8585];
+#ifndef DUMP_ITEM_DEFINED
+#define DUMP_ITEM_DEFINED
 typedef struct { const char* name; const uint8_t* ptr; int size; } dump_item;
+#endif
 #define DUMP_NUM_ITEMS (2)
 extern dump_item dump_items[DUMP_NUM_ITEMS];
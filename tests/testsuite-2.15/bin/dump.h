@@ -1,5 +1,5 @@
 #pragma once
-// #version:5#
+// #version:7#
 // machine generated, do not edit!
 #include <stdint.h>
 extern unsigned char dump__start[3438];
@@ -267,6 +267,9 @@ extern unsigned char dump_tsxn[644];
 extern unsigned char dump_txan[616];
 extern unsigned char dump_txsn[620];
 extern unsigned char dump_tyan[616];
+#ifndef DUMP_ITEM_DEFINED
+#define DUMP_ITEM_DEFINED
 typedef struct { const char* name; const uint8_t* ptr; int size; } dump_item;
+#endif
 #define DUMP_NUM_ITEMS (265)
 extern dump_item dump_items[DUMP_NUM_ITEMS];
@@ -0,0 +1,187 @@
+//------------------------------------------------------------------------------
+//  z80-bench.c
+//
+//  Z80 core throughput for a few representative instruction mixes, with
+//  a trivial tick callback (flat 64 KB memory, no IO devices):
+//
+//      alu     8-bit and 16-bit register arithmetic and logic
+//      ldir    4 KB block moves with LDIR
+//      mem     memory-heavy loop with (HL), (IX+d) and stack accesses
+//      int     IM 2 interrupt every 200 ticks, similar to z80-int.c
+//
+//  Usage:
+//
+//      z80-bench [-r runs] [million-ticks]
+//
+//  Each mix runs for the given number of emulated ticks (default 100
+//  million) and the best of the runs (default 3) is reported as JSON on
+//  stdout, as emulated MHz and ns per instruction. Instructions are
+//  counted by opcode fetch (prefixed instructions count once).
+//------------------------------------------------------------------------------
+#define CHIPS_IMPL
+#include "chips/z80.h"
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#define INT_PERIOD (200)
+
+typedef struct {
+    const char* name;
+    const uint8_t* prog;
+    size_t prog_size;
+    bool interrupts;
+} mix_t;
+
+/* 0100: LD B,0; loop: ADD A,B; SUB C; AND D; XOR E; OR H; INC L; DEC B; RLCA; ADD HL,DE; JP loop */
+static const uint8_t alu_prog[] = {
+    0x06, 0x00, 0x80, 0x91, 0xA2, 0xAB, 0xB4, 0x2C, 0x05, 0x07, 0x19, 0xC3, 0x02, 0x01,
+};
+/* 0100: LD HL,4000h; LD DE,8000h; LD BC,1000h; LDIR; JP 0100h */
+static const uint8_t ldir_prog[] = {
+    0x21, 0x00, 0x40, 0x11, 0x00, 0x80, 0x01, 0x00, 0x10, 0xED, 0xB0, 0xC3, 0x00, 0x01,
+};
+/* 0100: LD HL,4000h; LD IX,8000h; LD B,0
+   loop: LD A,(HL); ADD A,(IX+1); LD (IX+0),A; INC HL; INC IX; PUSH AF; POP DE; DJNZ loop; JP 0100h
+*/
+static const uint8_t mem_prog[] = {
+    0x21, 0x00, 0x40, 0xDD, 0x21, 0x00, 0x80, 0x06, 0x00,
+    0x7E, 0xDD, 0x86, 0x01, 0xDD, 0x77, 0x00, 0x23, 0xDD, 0x23, 0xF5, 0xD1, 0x10, 0xF2,
+    0xC3, 0x00, 0x01,
+};
+/* 0100: LD SP,FF00h; IM 2; XOR A; LD I,A; EI; loop: INC A; LD (4000h),A; JR loop */
+static const uint8_t int_prog[] = {
+    0x31, 0x00, 0xFF, 0xED, 0x5E, 0xAF, 0xED, 0x47, 0xFB,
+    0x3C, 0x32, 0x00, 0x40, 0x18, 0xFA,
+};
+/* 0200: PUSH AF; PUSH HL; LD HL,(4002h); INC HL; LD (4002h),HL; POP HL; POP AF; EI; RETI */
+static const uint8_t isr_prog[] = {
+    0xF5, 0xE5, 0x2A, 0x02, 0x40, 0x23, 0x22, 0x02, 0x40, 0xE1, 0xF1, 0xFB, 0xED, 0x4D,
+};
+
+static const mix_t mixes[] = {
+    { "alu", alu_prog, sizeof(alu_prog), false },
+    { "ldir", ldir_prog, sizeof(ldir_prog), false },
+    { "mem", mem_prog, sizeof(mem_prog), false },
+    { "int", int_prog, sizeof(int_prog), true },
+};
+#define NUM_MIXES (sizeof(mixes)/sizeof(mixes[0]))
+
+static z80_t cpu;
+static uint8_t mem[1<<16];
+static uint64_t num_instr;
+static uint64_t num_ints;
+static bool prev_prefix;
+/* interrupts */
+static bool int_enabled;
+static bool int_pending;
+static int int_counter;
+
+static uint64_t tick(int num, uint64_t pins) {
+    if (pins & Z80_MREQ) {
+        const uint16_t addr = Z80_GET_ADDR(pins);
+        if (pins & Z80_RD) {
+            const uint8_t data = mem[addr];
+            Z80_SET_DATA(pins, data);
+            if (pins & Z80_M1) {
+                /* an opcode fetch, the byte after a prefix is part of the same instruction */
+                if (!prev_prefix) {
+                    num_instr++;
+                }
+                prev_prefix = !prev_prefix && ((data == 0xCB) || (data == 0xDD) || (data == 0xED) || (data == 0xFD));
+            }
+        }
+        else if (pins & Z80_WR) {
+            mem[addr] = Z80_GET_DATA(pins);
+        }
+    }
+    else if ((pins & (Z80_M1|Z80_IORQ)) == (Z80_M1|Z80_IORQ)) {
+        /* interrupt acknowledge, provide the interrupt vector */
+        Z80_SET_DATA(pins, 0xE0);
+        int_pending = false;
+        num_ints++;
+    }
+    if (int_enabled) {
+        int_counter -= num;
+        if (int_counter <= 0) {
+            int_counter += INT_PERIOD;
+            int_pending = true;
+        }
+        if (int_pending) {
+            pins |= Z80_INT;
+        }
+    }
+    pins &= ~Z80_RETI;
+    return pins;
+}
+
+static void init(const mix_t* mix) {
+    memset(mem, 0, sizeof(mem));
+    memcpy(&mem[0x0100], mix->prog, mix->prog_size);
+    /* IM 2 vector at 00E0h points to the interrupt service routine at 0200h */
+    mem[0x00E0] = 0x00; mem[0x00E1] = 0x02;
+    memcpy(&mem[0x0200], isr_prog, sizeof(isr_prog));
+    z80_init(&cpu, tick);
+    cpu.state.PC = 0x0100;
+    num_instr = 0;
+    num_ints = 0;
+    prev_prefix = false;
+    int_enabled = mix->interrupts;
+    int_pending = false;
+    int_counter = INT_PERIOD;
+}
+
+static int usage(const char* exe) {
+    fprintf(stderr, "usage: %s [-r runs] [million-ticks]\n", exe);
+    return 10;
+}
+
+int main(int argc, char* argv[]) {
+    int runs = 3;
+    uint64_t num_ticks = 100 * 1000000ULL;
+    for (int i = 1; i < argc; i++) {
+        if ((0 == strcmp(argv[i], "-r")) && (i+1 < argc)) {
+            runs = atoi(argv[++i]);
+            if (runs <= 0) {
+                return usage(argv[0]);
+            }
+        }
+        else if (atoi(argv[i]) > 0) {
+            num_ticks = (uint64_t)atoi(argv[i]) * 1000000ULL;
+        }
+        else {
+            return usage(argv[0]);
+        }
+    }
+    stm_setup();
+    printf("{\n  \"cpu\": \"z80\",\n  \"runs\": %d,\n  \"benchmarks\": [\n", runs);
+    for (size_t m = 0; m < NUM_MIXES; m++) {
+        double best_sec = 0.0;
+        uint64_t ticks = 0;
+        for (int r = 0; r < runs; r++) {
+            init(&mixes[m]);
+            ticks = 0;
+            const uint64_t start = stm_now();
+            while (ticks < num_ticks) {
+                ticks += z80_exec(&cpu, 1000000);
+            }
+            const double sec = stm_sec(stm_since(start));
+            if ((0 == r) || (sec < best_sec)) {
+                best_sec = sec;
+            }
+        }
+        if (best_sec <= 0.0) {
+            best_sec = 1e-9;
+        }
+        printf("    { \"name\": \"%s\", \"ticks\": %"PRIu64", \"instructions\": %"PRIu64", \"interrupts\": %"PRIu64", "
+            "\"seconds\": %.6f, \"mhz\": %.3f, \"ns_per_instruction\": %.3f }%s\n",
+            mixes[m].name, ticks, num_instr, num_ints, best_sec,
+            (ticks / best_sec) / 1000000.0, (best_sec * 1e9) / (double)num_instr,
+            (m + 1 < NUM_MIXES) ? "," : "");
+    }
+    printf("  ]\n}\n");
+    return 0;
+}
@@ -3,34 +3,59 @@
 //
 //  Runs Frank Cringle's zexdoc and zexall test through the Z80 emu. Provide
 //  a minimal CP/M environment to make these work.
+//
+//  Usage:
+//
+//      z80-zex [-j threads]
+//
+//  Without args, zexdoc and zexall run sequentially as one program each.
+//  With -j, the test table of each program is patched so that every
+//  instruction group runs as its own job (with its own memory and CPU)
+//  on a pool of worker threads (-j 0 means one thread per CPU core),
+//  the output is gathered in the original order, and the cycle count
+//  and wall time are reported per group.
 //------------------------------------------------------------------------------
 #define CHIPS_IMPL
 #include "chips/z80.h"
 #define SOKOL_IMPL
 #include "sokol_time.h"
 #include "roms/zex-dump.h"
+#include "../examples/common/thread.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <inttypes.h>
 
 enum {
     mem_size = 1<<16,
     mem_mask = mem_size-1,
-    output_size = 1<<16
+    output_size = 1<<16,
+    max_groups = 128,
+    group_output_size = 1<<10,
 };
 
-static uint8_t mem[mem_size];
-static int out_pos = 0;
-static char output[output_size];
+/* memory and output of one running test program, one per thread */
+typedef struct {
+    uint8_t mem[mem_size];
+    int out_pos;
+    int out_size;
+    char* output;
+    bool echo;
+} zex_t;
+static CHIPS_THREAD_LOCAL zex_t* zex;
 
 static void put_char(char c) {
-    if (out_pos < output_size) {
-        output[out_pos++] = c;
+    if (zex->out_pos < zex->out_size) {
+        zex->output[zex->out_pos++] = c;
+    }
+    if (zex->echo) {
+        putchar(c);
     }
-    putchar(c);
 }
 
 /* Z80 tick callback */
 static uint64_t tick(int num, uint64_t pins) {
+    uint8_t* mem = zex->mem;
     if (pins & Z80_MREQ) {
         if (pins & Z80_RD) {
             Z80_SET_DATA(pins, mem[Z80_GET_ADDR(pins)]);
@@ -44,6 +69,7 @@ static uint64_t tick(int num, uint64_t pins) {
 
 /* emulate character and string output CP/M system calls */
 static bool cpm_bdos(z80_t* cpu) {
+    uint8_t* mem = zex->mem;
     bool retval = true;
     if (2 == cpu->state.C) {
         // output character in register E
@@ -68,11 +94,22 @@ static bool cpm_bdos(z80_t* cpu) {
     return retval;
 }
 
-/* run CPU through the configured test (ZEXDOC or ZEXALL) */
-static bool run_test(z80_t* cpu, const char* name) {
+/* load a test program and init the CPU, traps at 0x0000 and 0x0005 */
+static void load_test(z80_t* cpu, const uint8_t* prog, size_t prog_size) {
+    memset(zex->mem, 0, sizeof(zex->mem));
+    memcpy(&zex->mem[0x0100], prog, prog_size);
+    z80_init(cpu, tick);
+    cpu->state.SP = 0xF000;
+    cpu->state.PC = 0x0100;
+    /* trap when reaching address 0x0000 or 0x0005 */
+    z80_set_trap(cpu, 0, 0x0000);
+    z80_set_trap(cpu, 1, 0x0005);
+}
+
+/* run the CPU until a warm boot (or the stop address) is reached, returns executed ticks */
+static uint64_t run_cpu(z80_t* cpu, uint16_t stop_addr) {
     bool running = true;
     uint64_t ticks = 0;
-    uint64_t start_time = stm_now();
     while (running) {
         /* run for a lot of ticks or until HALT is encountered */
         ticks += z80_exec(cpu, (1<<30));
@@ -82,11 +119,28 @@ static bool run_test(z80_t* cpu, const char* name) {
                 running = false;
             }
         }
-        else if (0 == cpu->state.PC) {
+        else if ((0 == cpu->state.PC) || (stop_addr == cpu->state.PC)) {
             running = false;
         }
         cpu->pins &= ~Z80_HALT;
     }
+    return ticks;
+}
+
+/* run CPU through the configured test (ZEXDOC or ZEXALL) */
+static bool run_test(const uint8_t* prog, size_t prog_size, const char* name) {
+    static zex_t ctx;
+    static char output[output_size];
+    memset(output, 0, sizeof(output));
+    ctx.output = output;
+    ctx.out_size = output_size;
+    ctx.out_pos = 0;
+    ctx.echo = true;
+    zex = &ctx;
+    z80_t cpu;
+    load_test(&cpu, prog, prog_size);
+    uint64_t start_time = stm_now();
+    uint64_t ticks = run_cpu(&cpu, 0);
     double dur = stm_sec(stm_since(start_time));
     printf("\n%s: %"PRIu64" cycles in %.3fsecs (%.2f MHz)\n", name, ticks, dur, (ticks/dur)/1000000.0);
 
@@ -103,42 +157,202 @@ static bool run_test(z80_t* cpu, const char* name) {
     return true;
 }
 
-/* run the ZEXDOC test */
-static bool zexdoc() {
-    memset(output, 0, sizeof(output));
-    memset(mem, 0, sizeof(mem));
-    memcpy(&mem[0x0100], dump_zexdoc, sizeof(dump_zexdoc));
-    z80_t cpu;
-    z80_init(&cpu, tick);
-    cpu.state.SP = 0xF000;
-    cpu.state.PC = 0x0100;
-    /* trap when reaching address 0x0000 or 0x0005 */
-    z80_set_trap(&cpu, 0, 0x0000);
-    z80_set_trap(&cpu, 1, 0x0005);
-    return run_test(&cpu, "ZEXDOC");
+/*
+    The ZEX main loop looks like this:
+
+    start:  ld hl,(6) / ld sp,hl / ld de,msg1 / ld c,9 / call bdos
+            ld hl,tests     ; 21 lo hi
+    loop:   ld a,(hl)       ; 7E
+            inc hl          ; 23
+            or (hl)         ; B6
+            jp z,done       ; CA lo hi
+            ...
+
+    Find the 'ld hl,tests' instruction to get the address of the test table,
+    the address where the loop starts, and the address of 'done'.
+*/
+typedef struct {
+    uint16_t loop_addr;     /* address of the 'ld hl,tests' instruction */
+    uint16_t tests_addr;    /* address of the zero-terminated test table */
+    uint16_t done_addr;     /* address reached after the last test */
+    int num_groups;
+} zex_layout_t;
+
+static bool find_layout(const uint8_t* prog, size_t prog_size, zex_layout_t* l) {
+    for (size_t i = 0; (i + 9) <= prog_size && (i < 0x100); i++) {
+        const uint8_t* p = &prog[i];
+        if ((p[0] == 0x21) && (p[3] == 0x7E) && (p[4] == 0x23) && (p[5] == 0xB6) && (p[6] == 0xCA)) {
+            l->loop_addr = (uint16_t)(0x0100 + i);
+            l->tests_addr = (uint16_t)((p[2]<<8) | p[1]);
+            l->done_addr = (uint16_t)((p[8]<<8) | p[7]);
+            l->num_groups = 0;
+            size_t t = l->tests_addr - 0x0100;
+            while (((t + 1) < prog_size) && (prog[t] | prog[t+1])) {
+                l->num_groups++;
+                t += 2;
+            }
+            return (l->num_groups > 0) && (l->num_groups <= max_groups);
+        }
+    }
+    return false;
 }
 
-/* run the ZEXALL test */
-static bool zexall() {
-    memset(output, 0, sizeof(output));
-    memset(mem, 0, sizeof(mem));
-    memcpy(&mem[0x0100], dump_zexall, sizeof(dump_zexall));
+/* a single instruction group of a test program */
+typedef struct {
+    const uint8_t* prog;
+    size_t prog_size;
+    const zex_layout_t* layout;
+    int group;
+    uint64_t ticks;
+    double dur;
+    char output[group_output_size];
+} zex_job_t;
+
+typedef struct {
+    zex_job_t* jobs;
+    int num_jobs;
+    volatile int32_t next_job;
+} zex_pool_t;
+
+/* patch the test table to only contain one group, and run it */
+static void run_job(zex_job_t* job) {
     z80_t cpu;
-    z80_init(&cpu, tick);
-    cpu.state.SP = 0xF000;
-    cpu.state.PC = 0x0100;
-    /* trap when reaching address 0x0000 or 0x0005 */
-    z80_set_trap(&cpu, 0, 0x0000);
-    z80_set_trap(&cpu, 1, 0x0005);
-    return run_test(&cpu, "ZEXALL");
+    load_test(&cpu, job->prog, job->prog_size);
+    const uint16_t t = job->layout->tests_addr;
+    const uint16_t entry = t + 2 * job->group;
+    zex->mem[t+0] = zex->mem[entry+0];
+    zex->mem[t+1] = zex->mem[entry+1];
+    zex->mem[t+2] = 0;
+    zex->mem[t+3] = 0;
+    /* skip the banner, the stack pointer is what 'ld hl,(6) / ld sp,hl' loads */
+    cpu.state.SP = (zex->mem[7]<<8) | zex->mem[6];
+    cpu.state.PC = job->layout->loop_addr;
+    z80_set_trap(&cpu, 2, job->layout->done_addr);
+    zex->output = job->output;
+    zex->out_size = group_output_size - 1;
+    zex->out_pos = 0;
+    zex->echo = false;
+    memset(job->output, 0, sizeof(job->output));
+    uint64_t start_time = stm_now();
+    job->ticks = run_cpu(&cpu, job->layout->done_addr);
+    job->dur = stm_sec(stm_since(start_time));
+}
+
+static void worker(void* arg) {
+    zex_pool_t* pool = (zex_pool_t*) arg;
+    zex = (zex_t*) calloc(1, sizeof(zex_t));
+    int32_t i;
+    while ((i = thread_atomic_add(&pool->next_job, 1)) < pool->num_jobs) {
+        run_job(&pool->jobs[i]);
+    }
+    free(zex);
+    zex = 0;
 }
 
-int main() {
+/* run each instruction group of zexdoc and zexall as a separate job */
+static bool run_parallel(int num_threads) {
+    static const struct {
+        const char* name;
+        const uint8_t* prog;
+        size_t prog_size;
+    } progs[2] = {
+        { "ZEXDOC", dump_zexdoc, sizeof(dump_zexdoc) },
+        { "ZEXALL", dump_zexall, sizeof(dump_zexall) },
+    };
+    zex_layout_t layouts[2];
+    int num_jobs = 0;
+    for (int i = 0; i < 2; i++) {
+        if (!find_layout(progs[i].prog, progs[i].prog_size, &layouts[i])) {
+            printf("%s: test table not found!\n", progs[i].name);
+            return false;
+        }
+        num_jobs += layouts[i].num_groups;
+    }
+    zex_job_t* jobs = (zex_job_t*) calloc((size_t)num_jobs, sizeof(zex_job_t));
+    int job_index = 0;
+    for (int i = 0; i < 2; i++) {
+        for (int g = 0; g < layouts[i].num_groups; g++) {
+            zex_job_t* job = &jobs[job_index++];
+            job->prog = progs[i].prog;
+            job->prog_size = progs[i].prog_size;
+            job->layout = &layouts[i];
+            job->group = g;
+        }
+    }
+    zex_pool_t pool = { .jobs = jobs, .num_jobs = num_jobs, .next_job = 0 };
+    if (num_threads > num_jobs) {
+        num_threads = num_jobs;
+    }
+    printf("running %d ZEX groups on %d thread(s)\n", num_jobs, num_threads);
+    thread_t* threads = (thread_t*) calloc((size_t)num_threads, sizeof(thread_t));
+    uint64_t start_time = stm_now();
+    for (int i = 0; i < num_threads; i++) {
+        if (!thread_start(&threads[i], worker, &pool)) {
+            /* run the remaining jobs with fewer threads */
+            num_threads = i;
+            break;
+        }
+    }
+    if (0 == num_threads) {
+        worker(&pool);
+    }
+    for (int i = 0; i < num_threads; i++) {
+        thread_join(&threads[i]);
+    }
+    double wall = stm_sec(stm_since(start_time));
+    free(threads);
+
+    /* gather the output in order */
+    bool ok = true;
+    double total_dur = 0.0;
+    job_index = 0;
+    for (int i = 0; i < 2; i++) {
+        uint64_t ticks = 0;
+        bool prog_ok = true;
+        printf("\n%s:\n", progs[i].name);
+        for (int g = 0; g < layouts[i].num_groups; g++) {
+            zex_job_t* job = &jobs[job_index++];
+            /* the group output is the test name and result, terminated by CR/LF */
+            char* line = job->output;
+            size_t len = strlen(line);
+            while ((len > 0) && ((line[len-1] == '\n') || (line[len-1] == '\r'))) {
+                line[--len] = 0;
+            }
+            printf("%s  (%"PRIu64" cycles, %.3f secs)\n", line, job->ticks, job->dur);
+            if (strstr(line, "ERROR") || (len == 0)) {
+                prog_ok = false;
+            }
+            ticks += job->ticks;
+            total_dur += job->dur;
+        }
+        printf("%s: %"PRIu64" cycles\n", progs[i].name, ticks);
+        if (prog_ok) {
+            printf("\n ALL %s TESTS PASSED!\n", progs[i].name);
+        }
+        ok &= prog_ok;
+    }
+    printf("\n%.3f secs wall time, %.3f secs total (%.2fx)\n", wall, total_dur, (wall > 0.0) ? total_dur / wall : 0.0);
+    free(jobs);
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
     stm_setup();
-    if (!zexdoc()) {
+    if ((argc == 3) && (0 == strcmp(argv[1], "-j"))) {
+        int num_threads = atoi(argv[2]);
+        if (num_threads <= 0) {
+            num_threads = thread_num_cores();
+        }
+        return run_parallel(num_threads) ? 0 : 10;
+    }
+    else if (argc != 1) {
+        printf("usage: %s [-j threads]\n", argv[0]);
+        return 10;
+    }
+    if (!run_test(dump_zexdoc, sizeof(dump_zexdoc), "ZEXDOC")) {
         return 10;
     }
-    if (!zexall()) {
+    if (!run_test(dump_zexall, sizeof(dump_zexall), "ZEXALL")) {
         return 10;
     }
     return 0;
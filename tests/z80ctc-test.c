@@ -1,5 +1,8 @@
 //------------------------------------------------------------------------------
 //  z80ctc_test.c
+//
+//  Also cross-checks the multi-tick advance of examples/common/ctcbatch.h
+//  against ticking the CTC tick by tick.
 //------------------------------------------------------------------------------
 // force assert() enabled
 #ifdef NDEBUG
@@ -8,7 +11,9 @@
 #define CHIPS_IMPL
 #include "chips/z80.h"
 #include "chips/z80ctc.h"
+#include "../examples/common/ctcbatch.h"
 #include <stdio.h>
+#include <string.h>
 
 uint32_t num_tests = 0;
 #define T(x) { assert(x); num_tests++; }
@@ -225,11 +230,71 @@ void test_interrupt() {
     T(mem[0x0001] == 4);
 }
 
+/* write a CTC channel register through the pins, like an OUT instruction */
+void ctc_out(z80ctc_t* ctc, int chn_id, uint8_t data) {
+    uint64_t pins = Z80CTC_CE|Z80_IORQ|Z80_WR;
+    if (chn_id & 1) pins |= Z80CTC_CS0;
+    if (chn_id & 2) pins |= Z80CTC_CS1;
+    Z80_SET_DATA(pins, data);
+    z80ctc_iorq(ctc, pins);
+}
+
+/* setup a CTC like the KC87 system clock: channel 2 cascades into channel 3
+   in counter mode, channel 0 and 1 run free with different prescalers
+*/
+void setup_cascade(z80ctc_t* ctc) {
+    z80ctc_init(ctc);
+    const uint8_t timer = Z80CTC_CTRL_EI|Z80CTC_CTRL_MODE_TIMER|Z80CTC_CTRL_TRIGGER_AUTO|Z80CTC_CTRL_CONST_FOLLOWS|Z80CTC_CTRL_CONTROL;
+    const uint8_t counter = Z80CTC_CTRL_EI|Z80CTC_CTRL_MODE_COUNTER|Z80CTC_CTRL_EDGE_RISING|Z80CTC_CTRL_CONST_FOLLOWS|Z80CTC_CTRL_CONTROL;
+    ctc_out(ctc, 0, timer|Z80CTC_CTRL_PRESCALER_16);
+    ctc_out(ctc, 0, 10);
+    ctc_out(ctc, 1, timer|Z80CTC_CTRL_PRESCALER_256);
+    ctc_out(ctc, 1, 3);
+    ctc_out(ctc, 2, timer|Z80CTC_CTRL_PRESCALER_16);
+    ctc_out(ctc, 2, 3);
+    ctc_out(ctc, 3, counter);
+    ctc_out(ctc, 3, 5);
+}
+
+/* the batched CTC must have the same counters and interrupt requests as the
+   per-tick CTC after any number of ticks
+*/
+void test_batch_crosscheck() {
+    z80ctc_t ref, ctc;
+    setup_cascade(&ref);
+    setup_cascade(&ctc);
+    uint64_t ref_pins = 0, pins = 0;
+    uint32_t num_ticks = 0, num_batched = 0, num_zcto = 0, num_batched_zcto = 0;
+    uint32_t xorshift = 0x6D98302B;
+    for (int step = 0; step < 500; step++) {
+        /* random step sizes, like the ticks between two tick callbacks or CTC accesses */
+        xorshift ^= xorshift<<13; xorshift ^= xorshift>>17; xorshift ^= xorshift<<5;
+        uint32_t ticks = 1 + (xorshift % ((step & 1) ? 7 : 40));
+        num_ticks += ticks;
+        for (uint32_t i = 0; i < ticks; i++) {
+            ref_pins = ctcbatch_tick_cascade(&ref, ref_pins);
+            num_zcto += (ref_pins & Z80CTC_ZCTO2) ? 1 : 0;
+        }
+        pins = ctcbatch_run_cascade(&ctc, pins, ticks, &num_batched, &num_batched_zcto);
+        for (int i = 0; i < Z80CTC_NUM_CHANNELS; i++) {
+            T(ref.chn[i].down_counter == ctc.chn[i].down_counter);
+            T(ref.chn[i].prescaler == ctc.chn[i].prescaler);
+        }
+        T(0 == memcmp(&ref.chn, &ctc.chn, sizeof(ref.chn)));
+        T((ref_pins & Z80CTC_ZCTO2) == (pins & Z80CTC_ZCTO2));
+    }
+    T(num_ticks > 2000);
+    T(num_zcto > 0);
+    T(num_zcto == num_batched_zcto);
+    T(num_batched > 0);
+}
+
 int main() {
     test_intvector();
     test_timer();
     test_timer_wait_trigger();
     test_counter();
     test_interrupt();
+    test_batch_crosscheck();
     return 0;
 }
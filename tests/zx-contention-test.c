@@ -0,0 +1,76 @@
+//------------------------------------------------------------------------------
+//  zx-contention-test.c
+//
+//  Tests the contended memory wait states of the ZX Spectrum 128: a loop
+//  which increments every byte of the display RAM must make less progress
+//  in the same number of ticks when contention is enabled, and the same
+//  loop on uncontended RAM must make the same progress either way (give or
+//  take the one increment by which the end of the boot phase can differ).
+//------------------------------------------------------------------------------
+// force assert() enabled
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#define CHIPS_IMPL
+#include "systems/zx128k.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+uint32_t num_tests = 0;
+#define T(x) { assert(x); num_tests++; }
+
+#define NUM_BOOT_FRAMES (100)
+#define NUM_PROG_FRAMES (50)
+#define NUM_BYTES (0x1B00)
+
+/* 8000: DI; LD SP,8000h; loop: LD HL,nn00h; LD BC,1B00h; inner: LD A,(HL); INC A; LD (HL),A; INC HL; DEC BC; LD A,B; OR C; JR NZ,inner; JR loop */
+uint8_t prog[] = {
+    0xF3, 0x31, 0x00, 0x80, 0x21, 0x00, 0x40, 0x01, 0x00, 0x1B, 0x7E, 0x3C, 0x77, 0x23, 0x0B, 0x78, 0xB1, 0x20, 0xF7, 0x18, 0xEF,
+};
+
+/* run the increment loop over the 0x1B00 bytes at addr, returns the number of increments */
+uint32_t run_prog(bool contention, uint16_t addr) {
+    const uint32_t fb_size = ZX128K_DISP_WIDTH * ZX128K_DISP_HEIGHT * sizeof(uint32_t);
+    zx128k_t* sys = (zx128k_t*) thread_aligned_calloc(sizeof(zx128k_t));
+    uint32_t* fb = (uint32_t*) calloc(1, fb_size);
+    uint8_t* before = (uint8_t*) calloc(1, NUM_BYTES);
+    T(sys && fb && before);
+    zx_init(sys, &(zx_desc_t){
+        .rgba8_buffer = fb,
+        .rgba8_buffer_size = fb_size,
+        .disable_contention = !contention
+    });
+    zx_exec(sys, NUM_BOOT_FRAMES * (ZX128K_FREQ / 50));
+    prog[6] = (uint8_t)(addr >> 8);
+    mem_write_range(&sys->mem, 0x8000, prog, sizeof(prog));
+    sys->cpu.state.PC = 0x8000;
+    for (int i = 0; i < NUM_BYTES; i++) {
+        before[i] = mem_rd(&sys->mem, (uint16_t)(addr + i));
+    }
+    zx_exec(sys, NUM_PROG_FRAMES * (ZX128K_FREQ / 50));
+    /* there are far less than 256 passes, so the bytes don't wrap around */
+    uint32_t num_incs = 0;
+    for (int i = 0; i < NUM_BYTES; i++) {
+        num_incs += (uint8_t)(mem_rd(&sys->mem, (uint16_t)(addr + i)) - before[i]);
+    }
+    thread_aligned_free(sys);
+    free(fb);
+    free(before);
+    return num_incs;
+}
+
+int main() {
+    /* the display RAM in bank 5 at 4000 is contended */
+    const uint32_t display_off = run_prog(false, 0x4000);
+    const uint32_t display_on = run_prog(true, 0x4000);
+    T(display_off > NUM_BYTES);
+    T(display_on > 0);
+    T(display_on < display_off);
+    /* bank 2 at 8000 is never contended */
+    const uint32_t ram_off = run_prog(false, 0x9000);
+    const uint32_t ram_on = run_prog(true, 0x9000);
+    T(ram_off > NUM_BYTES);
+    T(((ram_on + 1) >= ram_off) && ((ram_off + 1) >= ram_on));
+    printf("%d tests run ok.\n", num_tests);
+    return 0;
+}
@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+//  zx-frame-test.c
+//
+//  Tests that ZX128K_FRAME_TICKS is the vblank interrupt period of the
+//  ZX Spectrum 128: when every frame runs one frame budget (minus the
+//  overrun of the previous frame), each frame must end on the vblank
+//  interrupt, with the frame position of the video timing at exactly the
+//  overrun ticks.
+//------------------------------------------------------------------------------
+// force assert() enabled
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#define CHIPS_IMPL
+#include "systems/zx128k.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+uint32_t num_tests = 0;
+#define T(x) { assert(x); num_tests++; }
+
+#define NUM_FRAMES (200)
+
+int main() {
+    const uint32_t fb_size = ZX128K_DISP_WIDTH * ZX128K_DISP_HEIGHT * sizeof(uint32_t);
+    zx128k_t* sys = (zx128k_t*) thread_aligned_calloc(sizeof(zx128k_t));
+    uint32_t* fb = (uint32_t*) calloc(1, fb_size);
+    T(sys && fb);
+    zx_init(sys, &(zx_desc_t){ .rgba8_buffer = fb, .rgba8_buffer_size = fb_size });
+    T(0 == sys->blink_counter);
+    uint32_t overrun_ticks = 0;
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        const uint32_t ticks_to_run = ZX128K_FRAME_TICKS - overrun_ticks;
+        overrun_ticks = zx_exec(sys, ticks_to_run) - ticks_to_run;
+        T(overrun_ticks < ZX128K_SCANLINE_PERIOD);
+        /* exactly one vblank interrupt per frame budget */
+        T((uint8_t)(frame + 1) == sys->blink_counter);
+        /* ...and the frame ended on it */
+        const uint32_t scanline_ticks_left = (uint32_t) sched_ticks_left(&sys->sched, ZX128K_EVENT_SCANLINE);
+        T(overrun_ticks == (sys->scanline_y * ZX128K_SCANLINE_PERIOD + (ZX128K_SCANLINE_PERIOD - scanline_ticks_left)));
+    }
+    thread_aligned_free(sys);
+    free(fb);
+    printf("%d tests run ok.\n", num_tests);
+    return 0;
+}